@@ -176,7 +176,6 @@ MCU_COMMON_SRC = \
             drivers/bus_spi_stdperiph.c \
             drivers/dma_stm32f4xx.c \
             drivers/dshot_bitbang.c \
-            drivers/dshot_bitbang_decode.c \
             drivers/dshot_bitbang_stdperiph.c \
             drivers/inverter.c \
             drivers/light_ws2811strip_stdperiph.c \
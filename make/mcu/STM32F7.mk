@@ -177,7 +177,6 @@ MCU_COMMON_SRC = \
             drivers/bus_spi_ll.c \
             drivers/persistent.c \
             drivers/dshot_bitbang.c \
-            drivers/dshot_bitbang_decode.c \
             drivers/dshot_bitbang_ll.c \
             drivers/pwm_output_dshot_hal.c \
             drivers/pwm_output_dshot_shared.c \
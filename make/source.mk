@@ -10,11 +10,13 @@ COMMON_SRC = \
             $(addprefix config/,$(notdir $(wildcard $(SRC_DIR)/config/*.c))) \
             cli/cli.c \
             cli/settings.c \
+            cli/settings_index.c \
             config/config.c \
             drivers/adc.c \
             drivers/dshot.c \
             drivers/dshot_dpwm.c \
             drivers/dshot_command.c \
+            drivers/dshot_gcr.c \
             drivers/buf_writer.c \
             drivers/bus.c \
             drivers/bus_i2c_config.c \
@@ -121,9 +123,11 @@ COMMON_SRC = \
             sensors/boardalignment.c \
             sensors/compass.c \
             sensors/gyro.c \
+            sensors/gyro_fusion.c \
             sensors/gyro_init.c \
             sensors/initialisation.c \
             blackbox/blackbox.c \
+            blackbox/blackbox_compress.c \
             blackbox/blackbox_encoding.c \
             blackbox/blackbox_io.c \
             cms/cms.c \
@@ -154,6 +158,7 @@ COMMON_SRC = \
             io/pidaudio.c \
             osd/osd.c \
             osd/osd_elements.c \
+            osd/osd_screen.c \
             sensors/barometer.c \
             sensors/rangefinder.c \
             telemetry/telemetry.c \
@@ -193,9 +198,12 @@ SIZE_OPTIMISED_SRC  := ""
 
 ifneq ($(TARGET),$(filter $(TARGET),$(F1_TARGETS)))
 SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
+            blackbox/blackbox_compress.c \
+            common/crc.c \
             common/encoding.c \
             common/filter.c \
             common/maths.c \
+            common/sdft.c \
             common/typeconversion.c \
             drivers/accgyro/accgyro_mpu.c \
             drivers/accgyro/accgyro_mpu3050.c \
@@ -238,6 +246,7 @@ SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
             sensors/acceleration.c \
             sensors/boardalignment.c \
             sensors/gyro.c \
+            sensors/gyro_fusion.c \
             $(CMSIS_SRC) \
             $(DEVICE_STDPERIPH_SRC) \
 
@@ -245,6 +254,7 @@ SIZE_OPTIMISED_SRC := $(SIZE_OPTIMISED_SRC) \
             bus_bst_stm32f30x.c \
             cli/cli.c \
             cli/settings.c \
+            cli/settings_index.c \
             drivers/accgyro/accgyro_fake.c \
             drivers/barometer/barometer_bmp085.c \
             drivers/barometer/barometer_bmp280.c \
@@ -297,6 +307,7 @@ SIZE_OPTIMISED_SRC := $(SIZE_OPTIMISED_SRC) \
             cms/cms_menu_saveexit.c \
             osd/osd.c \
             osd/osd_elements.c \
+            osd/osd_screen.c \
             rx/rx_bind.c \
             sensors/gyro_init.c
 
@@ -317,6 +328,7 @@ SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
             drivers/bus_spi_ll.c \
             rx/frsky_crc.c \
             drivers/max7456.c \
+            drivers/dshot_gcr.c \
             drivers/pwm_output_dshot.c \
             drivers/pwm_output_dshot_shared.c \
             drivers/pwm_output_dshot_hal.c
@@ -0,0 +1,4429 @@
+	.file	"blackbox.c"
+	.section	.gnu.lto_.profile.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\254\t\255\""
+	.string	"6\250\226HpZRca\376\305D\236PN\345\306\202\201\0346\221p\250\332x\265\300/y\264\302\020\217vE&\200\007>\240d74\036\001D"
+	.string	"\021\215\2050\257\331\227\357\237\031\033C\370>\267?\336\231\271\r\"\267l\262\367\226Ddw"
+	.string	"{"
+	.string	"\211"
+	.string	"Y\347:59\337\357\277\345\276\005Ab\227\363~9\375b\342\260\301\357\007\217\023|\315}7\277\261y\315\261'\345\306\214\006o\316\256a\356\2424mh\366>\315\363\201\2379\3602\377}\337\275{`\246\222\227%\225\371mW\373\364\265\357\355}g\217\217\277~\375\333F\271=}\260k\013\255\003\243S\263\253l\3169\325\253\317\317?~\357\370\300\r\205\013n\211#`\327\031=,\021:74\343z\243\357\033\355\242\003}J\250-\255\245\235\217O\364}\342\331\241|\365C\352\2454\374\260\027l\307\236jU\222\220\212G\303\017\263z\3421q\370\005\024\264Y\024\252\305\250HA\202#\370/\343\201Q\301\021\t\001\r}Hx\234/\374\201\013o@X\340\354\367w\336!\360}\241\357\017\370~\320\276\200\f\024\340;\347\274w\316?\3679\333s5g"
+	.ascii	"\337<;\017#\220G\036y7\263)\301\302\023\301t\235\031(11\036!"
+	.ascii	"\324\236\324\013\363\t\342\303\363\333\223\264.\036\364\265\266"
+	.ascii	"+\203\256u\340\260AC\006}\235\203\200r_\312\246\030.\274o2\306"
+	.ascii	"\304\312B\2732\345\254\246\236*\260l\233\347\314\3015\341\370"
+	.ascii	"\343\2157\336"
+	.string	"\230\217\307\306cLCFH\263\355K\002\361\331\301\325\006\307K\177\031(%\375\345\371\353\203\364\367\211-\253\232b!\217~\255\230;#]L\307\342\213\353\213\307\373G\001\330U6\347\2347\364\022\212\247\264\361\333\242\225\344\253\006>\376\371\221\261\305Eg\364\362\274zX\221\361\237\332\216\250i\f\030\355\025S9\346\305\f\026iW\234\013\225\254\251#K\213oyM\001\303Bm.\221\232Z\241\257\223O&\317>\t\341\017p\364\316\244TEU\334\254\356HV\n\037\232\230\261+(\324\365\3316\204\353\304]8'\3135\023\372ZU\271\204\001I+A\023\364\025!\213\013#\341t\247;}7\275\351\372\272\351\254\232\025=\243\n\201\017\250\30159\"b\222\024\024\2442\034\341\004P2\207R\235\007\022\340\344\025\213\244fdd&*IR?\n\035\b'\210\253\243Zo\264\206V\225\367,\300\242GZ\325\251F"
+	.ascii	"\314=\214x\360SH\315g\007\243H\036(\343\354\312\223\250c\263"
+	.ascii	"U>\307\034\351\246\261X{Zbh\032\274\365h\023\350h1Pt7\007\265"
+	.ascii	"\n\0302r\nm\327\204\343\302,mA\210\001W\356\246\365f\331\302"
+	.ascii	"\212\034\271\375\320\270\335\222\256\030\177qy\023$\265)1}"
+	.string	"\247\252\245\374\f\030\327\271!\311\372\324@\233&-\272\003\345\265\253\030\230\227\tP\306C\255\227\370\022LJ\353\251\207A\031\320<\221\231#\314\306\006/\321\020\001\270s\232\276`\215\251-w\270\251\304+\303\350\263d7\361\377\332\340\221e\376\005\taI6I:\340\315\"\243r\270\263\002IbY\276< k*7\267^\257\356D\177\304k\370GL\214\34627\0061\013\3776g\354&\bm\217\b\b\356\360Y7\360\206\254E:@\305\303\347\222\214\362\246`\fG\335\264\031\353\223\357\313\316\341R8\344F\026%\250(j\363\205'\027g-\213rB\222slv>\020\341\356\236\254\3533\340\306\355\333\274\340\261\226\353\210\332\001y9\177.\357\300\267\363\350\323\367\021\331Q\264\002\206\267\355\341\3500\202k\232MS\243\374n\340j\331\340\022\307\177\2178\024\354\257\267\265\023t0\254\002C:\r:s/\244\355"
+	.ascii	"\036\f\235_\353\340\370*v\337P\007\035\256\343\212c\261EeK2\275"
+	.ascii	"\033\342\031x\004W\2332\364e-\3168\211;\261\240L\016\231D*\307"
+	.ascii	"\266\227\277\311\242\367\365b\301\037p>\273B\006]))9\"3)w\024"
+	.ascii	"\251\031t\022,y\266i\251\263\2548\265\340\220\273u\261\305\200"
+	.ascii	"\\\377\3233\f\234\3104\342X<"
+	.text
+	.section	.gnu.lto_.ipa_sra.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\205\002\355\007"
+	.string	"RG\026\032@W\032\003.\315M\240\n"
+	.string	"\2045\3050k\364\025\230&`r%kK\231R.\351\034\235\211\366?\024\320e\262\007\375Y\317\331\221\343F\223y_\030\275X*\224\311J<#\220\207\243\241\214\335^(\022\353\353\252\266\035x\b\203U&u2\373"
+	.string	"\005\202\t\246N\017^)M\250\300\326l\2226\003@\002\205\312l\036\022`\024!\204\225 Q0\321\314,,\317r\375\r\240n&\236\3505\263\340\217\3661bT\312\261\363>.C*70B4l\322\364\004\203\273\330\034AoywX^\211*S\037\226\346\363@\n2\225\030_\006\221\016\301\2148\342\013J\237\200\370(P,C\331#\363\230hRK\200\265\242\250MtFVA\f\346\177q[\332\013\221I\0275\264]\201\007"
+	.ascii	"\371CA\222\252\264\334\rv\311\333\323\260\370uJ4\305\270\327"
+	.ascii	"Q\301\360O\034n\211\021=.\n"
+	.text
+	.section	.gnu.lto_.inline.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\214\023\275/"
+	.string	"V\264\262F\240\332I\032\003\260)\021\240\033\376\233\234N6\217\311"
+	.string	"\233k\270\373\255(\035mf0\347\305\351\001%Fq<\205\261\f\027H\240U\025\241\007\253\317\016\253^\252=\343<0R=\241\346\227\033\335b\344\223F\266\334)\221"
+	.string	"\237"
+	.string	"\246"
+	.string	"\341\343>.O\307|c?p\271\273\322l\320\013_jw\247\036\367g"
+	.ascii	"\220\003\372\031}xvp:RJ\235\t3\350\212y\226K3l\314wfa\236\027"
+	.ascii	"\307\351\203\342\242\321\364\"\243\345G\370\250{\324\355"
+	.string	"\336\311]\256\021\270\356\272<\325\202b\205\245\203\273\222\001\244\360\217\346\332\332Z\033\275\375\030T\376;81G\305\017\256\370\247\224J\0131h\324\"\032-(U\272C]\223tw7|\245\371\305,kL\220\276\\\322.3bj\271Wpn\003\272|\232]\\f\220\t\330A\230#\227\253\334\026\022\365\300?\016Z\370Ksk\2310\261\021\321\237M\323\215\013\2603\333\232\005\002\346\337c\303)Q\357\307\307&-CU\245jd\322\027WWV\300$\360\271\274\221Tc\224\205\371\316$\214\234!\225\322\2462\324\2402L\002)\213\021!\220F\331\244\312\204C\032%o]c\226|Y\315\271\211z\362\345\316|R'\\\250\230\345\240\346\227\030\027\326\370\317\203\342\370\316\324\355\2725R\337\230\017MgP\034\024\213\024\211\316\273}'wp\3055\242\021=\333F\207\032\317 $\223\366~\354\256\356\017AJ\266\273"
+	.string	"\366\240\324\243\367vW\347\016SX~C|\344\230\346W\226\230%@kx)\345ai6\236\350\013\275K\232\237\227\024\033l\350iN\211S\344Kj\245\320\2518dlN\363\356\031\300jwj\200x\341g\001\345\332\335\004\006*\340^I\261v\367\246Uvw\234\302\3174w\210Q\362D\310i\256\201\001r\203\302(\364K\n\266\273\271\246\351ew\t\214\023^\312\253\256~_r\013j\2660#\246&\273F\b\267+H\213\322i\226\315\020K\022\264A\245\f7)\325\356F\330\003C%\315'0\247\345\255F\024\031Gr\350\2216V[8\224J<\322-\353\361\333\241\263\221\213\237\033c\276\262q\236\030F\307\226\253\234\213\224\024\305\342'\270z6\314\204\250~\277*\t\233x\206m\2712\302"
+	.string	"\253\212\007\020\005\267\022\257o\312\220d\371\361\ti\022\004\b$!\245\356(\352v \270\202G\272*\256\"o\356\270\216\272u\272U\267[w\274Un\221\034\004[\237\237\203\312\265\007\b|zx\320B\016\263I\341\200\355\236\344\021\253\020\263,2cV\232\024\257q\021\266C\310pc\004G\201{\250\321\261\231\231!\221$%I\032\003\321\004\2049\310\034C\363\022`Bq\214%I\212)b\224A#\"\"\201H \022\224$)H2\034\2201\020\304 {I\006\234\250'\321@\223\221Z\222\356\302\306A\265Zq\2608\344LB\031\032\237\262\036!i\207\213|\032\2170\216\251\336\003)L\274 \354\n&j\310\271\277|\367\245\006\212\256\301h\332\005\267\361\233p\217\005\034\355\345\016\376H\3509\002/\302\370\353zc\304\367#F\342\300C\264^\3164\370\333_\215\211\217\245f\336\260\201\363\214\260"
+	.string	"\0047I\203w\300\027\"\343\312\246\001\3047\023\365:I\274lM|\321\245\316\253\354\221vx\203\026!V\357\277Y\354\207\372\302j\357!\225\226\272{E\361\271(-\330\301\007g|\016\330\230\364\351\360V\361}\232\263\305\310\364_\3601;\223t2\262\214y\265\3439a|E\244\3107\234\3442\235\304<F\375\204\236\220\233Z\270\251\371\326\177\323K\374>\375\222%{\323\212\226\322\002{\363\344p<\\\227\316\374\346\\N\234$:\374N\022\267B\213Y\320YC\203\237.\260[/!\330\312\001\222M\371v\305\275\371Q\322fpt\363\337\317\001}\212\310,\336\342F\2542\310B\232"
+	.string	"n\263+\035\f\021`'\034\325\315}=\215\nf\325ps\017\210AH$\212#0\221\274>\352\371\335\336\233\031q8\316\230a\t\370k\366z\340\326f!\342\277^`\024\234-\033\267\f\f\276D\374\254\260\347\310\023\277\006P\201h\303F\314O\274U|\327\264`\036\2104\266sKy9\234w\253PR\351\331t\334]\255\003u8V~-\207\236 xmP\222\260\200c)s\034\341\305\224\252\330}F\211\036\250\322\250{\251\360c\271\255\t\350\230\034\247\002zS\301\003Yt\370*9\0200\027\237t\334\255\\\245!\201\275\275a\243\271\017\272"
+	.string	"\025\346\312:$\351\306\265?a\343P9U16\244?\371\"\333\333\361#\024\360\236\310\313\255\231\037f\226\225c\322\031\f5\210\177$l\b\304\006\246k>\030\327j(\337@\n\354"
+	.string	"uZ6\006\277\327\370\326\036Q\277\300\334\346J,\275\036.!\335.\f\266!@\364\211ne\207\366\221\221mv\346\035\246\215\006\2635\241\r\370\t|2\302\356\f\340R\035V\004\326\213\311\203\277\027\356q,\362\216\333p\333\275\341K\302\005\370\3168\034\366V|\315C\027\305\346\333\270\300\016X\302\207\265\001"
+	.string	"\327r\277\034\275\310\257\276 o\205\023-@\223Q\320\226L\016\026\244\253/\021\r~\024\366Y*\321\371\r\343E9I\352\031R\336\n\bjq&\bF;`\304\227Gv\023\341}\r\222\024\200\002\b\344 \247P"
+	.string	"1R\246\030\320]g\374PM\216\"\303\365\206\004\346\266\274#\257"
+	.ascii	"G\274-#\262\344\317\2003S~\017\243\2112\b1\224\354\326:WZo\305"
+	.ascii	"\311\240\354\227\325\337\305\3269Y\024\346U\031\346\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`m4\215]"
+	.ascii	"\332n\300\027>`,7\007P\251\330\031\315\n\334\026\253bg\253\270"
+	.ascii	"\265D\"}\021\265P\301\366\215\017\374^\226mW\240Elb\247\310\257"
+	.ascii	"&\235\354\204\016\307\312\032\270H]\001\363\305o\333\262\245"
+	.ascii	"m)S\nk\001i\001n\001\263l\303\024\t\221\037\333\2355b\304\254"
+	.ascii	"\375\274\230;\026\"&\006\244\001\3066.6*b\326\266$\371\265\r"
+	.ascii	"\251YRT+\003\024\374\332\0341o5b\326\265.\265'b\326\265#\265"
+	.ascii	"\037\273S~w%4\333\335\216\312\002\211\331\266\361\210\331\266"
+	.ascii	"\307\366\230]e\017\271DS\324\207\006\207\006\206f%\315viK@M\322"
+	.ascii	"\205\326lW\307\021\263\326ht\0261\333\264"
+	.string	"\222Y\250\031%F\263@m\266;#[3\3532\2732[\362I\314:\234\364f\273\241\2418\333\r\351\210y\207d\302+b\326\241\0221o9\333\r\211\344LYR\031\235\355f=v\266\233\337\220m7s\311O8\345\331.V\204\365\254\321\263]\274\005C\311/\016\362\233\370l\367+\371\331\356\227\275\234\007\264\335\017\363\317D\314z\352}\005m\267K\314\333\363\373\016\332\256*\346B\333\205!\346\355\301C\333\345\360/\242\355F\3008\321v\021\020X\264\335\233\230\365\325U\020\007\177\316\277\234g\264\335\331\277\301\177`#\215\337\2038\034s\340\243\355\276\230\303\277z\214\335f{\037\2441\266\302A+\034T\221\002\005\016\006\337\247\005 \360\016\264\277\003\215\237\301\207c\356\330\275\312\367\016Cw\377p\f\1778\366\216\037\030Ic|B\312\335\004\016\346\177\355\356\r\\W\271Op\02154\366\331\f@^\223\331"
+	.string	"\223\204L\200K4\200\334\205s\266\362\030\227c\201\377q\2700\217\361gy\020\004\376\025\370m\377\230t\367a'\032\277\257\357p\037\335u\344"
+	.ascii	"B\301\236\342\020\377\343\b\303\026g\026g\r\266`A\020\013\353"
+	.ascii	"\206;p\222\r\034ED\314\377\257\035; \260\257\300\301\251\177"
+	.ascii	"\\\343\037XE\277\330\213\205\356N\303\335g\310p\034\356\201W"
+	.ascii	"\002\004\200\360>\037v\341\356-\334Y\244\370\363\307K\2270\b"
+	.ascii	"\2665\330\366\n\203`\033,\244\321\036\354\316\235={t\240@\020"
+	.ascii	"\312\3124\212"
+	.string	"\b\017\341\265\366\0208\350\210T\234\203\016B\220\240*T\232<\030\366\340\356\026:\220\221E\201\362\357O\331\003\311\f$3S\370\244\033\360\340Q\222DC\236<\331\210g\"\271\bp\213\277\230\237\315\360\224\367J\372g\037\242\007v`\030`\027\357\201\037{\030j\375@1\2610\377\360 \016\365a\216\360\032\203z\374\351\361\007\263\330\343\367\247^P\357+&\366\016t\376\251\367u\240\377\315\343\317\357\353\205C\017\376\016\0368\207\356\026\362\373\202\211\375\b~\030\2528\361\177\370\377\\al\354}\320\255\223\230)\211Y;\272\021\";#\346\250\333\026|\303rC\"\346\r\fm\233\304\254)\340J@2\376b\034X\006h\006\377\221\017[8/uW\245N\373\326\256U\323*\367\2615\362|\350m\267#\245\324\225\314\302\271\271\222]\345Jn\215ZdO\312{+9\266\354z\362\306T\035Qr7\252\353\227\326"
+	.ascii	"\247r\224\344bQ3M\311\255\335\230\252gK\242\252o5\333\364\034"
+	.ascii	"w\353\001_\315\362\344\362ZQ\362\\M\266\312Ks\227~\261\351o4"
+	.ascii	"\331\037\225\243\352Nm\325\325g\345c\257\3137\256j\253\366\246"
+	.ascii	"\334\374\241$\327h\242\3459\266\352\026[R\271Y\252\275\233\263"
+	.ascii	"\346\372kI\223W\253r\366\364\"G\255_\226Y\n\360Umw$oT\333\037"
+	.ascii	"i`5[\364\344\031\360R\227\273*u4gy<\265\375\355F\223\353lwd\002"
+	.ascii	"7\265\310\325\344\"G\257u\324J\317\255VU{\354\270[\013\270\351"
+	.ascii	"\373jG\326l\311\365\346\251z\262\254\271\372z\352.G\266$\t*\357"
+	.ascii	"\300\352r;]\256D\315\323D\016\305"
+	.string	"\224\347(u7f^\352\262\273\367p\347\241\002\007U\234\356\330\323\373\n\364\277\002\275@\017.\354R\316\023\306)\f\023\006\fw\3024q\n\333\024\004\347\374\345q>\362\030w\006\317\327\t\363\024\276\030\017{\303@\351?\"\206gI\2029\021\242\200?\362\0300H\230\301\335\257\200H\200C\302\r?\3134-\017\007H\004\t\320\210\376#>\310\244\370\334<\016\256\245\2429\236\232+\323\0227\347\245\244\211\216\300\222\200%\341\202v\022\026P\023'j\242\220z\300\352\034\344p'\227\271Vyo=M\340\234\325\345X\235\366\264\267\252\274\364\314\225+\251\212\2502[\262\314\265+\331\2629-\225\205\225\263\272\354f\217Ls-\217\\G\244\270\345^\334|\315\275\330\351\331\213r\023m[u\335j\275\310^\224{\351\274(\314n\336\376|\355\317E\224\237\250@s\023%w\354x\363\253\237\256\326\242*\027\212\232;"
+	.string	"\376\323e\347\231kKfqm_U65c\264\251\271\256\277\035\316\315\336\331\372T\025\255\365\324\324,G\2265w\345\351\253rv\267\326\\\365y\231\343n\335\316jg\243Pu\335[\273\366\364\325\272\310/\032jr\231h\315I\244x\241E\366hT\245"
+	.ascii	"\254)\367\2615UZ\271\357W\246g\227\224GQy\221\250\271\216\275"
+	.ascii	"\325lO+OORkD\325\265M\325\335\310f\221T~\262)\271\266\004j\336"
+	.ascii	"ni\235f\327X\256d\327\252\362J\323\344Y\271\217\035\315\036\247"
+	.ascii	"\217\035y\274)/\2627\362xU\336\262"
+	.string	"\252\2325\362x5\234\333\\\312\273\310\257\261={':\366~ly\372\250j^\246dVI\232\345\330E~Iy\025\200\364\253\034\003Xa\261,\351\353RQ*\367\021\202\233\250\262\022!\202\316\310\214\210\210$I\222\3062\n\020\006Ei\226\310-\363\022\340\361p\b#9\214\202\220!\204\020D\210!\314\b\210!\"\"3\"\"\263sH\313\r\212\221\330\240\260\304De\330X:\313\252\320\f?\323\371\306;\33292\277\307g\216\362}\216\277\312\0047\242g6\376\326\217t\033\371\373\345B?\003\345VuX\220\270\341\316\372\221\022\217G\377\230'\377\205\256~\235\355W\262\262\024c\321,\361\262\273\226\3460O\032?\302\355\333\310ev\277Y%\213{\207R{rg)\ber\220t\317]\002\325\340\214\372>=qg\342y'\255\016\244\300O\263\004\0303mv\21712Lu_\002\320\032\272T\241\023"
+	.string	"\203\340\\\312\365?Z\263C+1-is6\036-\360\364\330a\217O\251,vH[('\241z\307\354J`)\002>\21385N\316\251\375 \223b\n\307< \306\2103\364\224-\252w\017l\352M\3413\277E\311\n\240\373\216\241]\233e1P\257p\307\345U\021\311\3061D\034l\232\317\017\201\313\265A\177oO\321.\313r\243\335\326\347'&\200\035\212[ \275\361\361\2424\003.k\224\373~0\0221\207/\364\300M\254\364\254\316\036U\ns\t?C\315\203\362\326\005l\321\236\337\220`>\206\352g\336;(\036<(\301\204M \016\035\325p\236\253\204\366\260\214O\244\305\244q\021Jy\001'H\311\263\315\036\313\362\361\235!A"
+	.ascii	"\304\270\343\340\210dQQ\314\\\021\006\225\225\305\311AW\277j"
+	.ascii	"\271\034:\220\274B\023\356u\244\264q$\335\320`<n\342U\233\224"
+	.ascii	"\332\322x|\re\020,<\231sW\3528\302\334\343"
+	.ascii	"d\367\203\216\335\232\260\232q0\317\t\212\365\034\3673\304\244"
+	.ascii	"\001\353\336\374\304\nPw'I\327\302i('\"\\\353\324/\202\001%\242"
+	.ascii	"\315&\025\260x7.o+\n\217FgJaW}\200CH\031\241\212>\372\305\222"
+	.ascii	"\254U1\355\237f\017\231xq\r\317!D\217\327v\016i\242\215\310\252"
+	.ascii	"\023x\220\217\251\331|B>\270\337t\300\255\340\023\265F;@\344"
+	.ascii	"\212\350g\324j.\t\016u\272\353;\333\202\236\325NFX\353\276\001"
+	.ascii	">\026\f\211{\021B\017\262O4&\207\352X\204UG\347\210CV\216F1\307"
+	.ascii	"\341$)Jzq\n\005\364\204XK\206/\377qg.t\034\025,\223y\203\324"
+	.ascii	"v\371\"\232\252\370\001SR:\205=\267F\314\022\236m\346h\317s\231"
+	.ascii	"\247\016"
+	.string	"\271{,o\300\243\366D\301\2278\200#\260\246\264\371\375\251P\"\373\345\232\315\273\216eh\023$\224\n_\032\030[\202R\202\351\325\241\253\273\260\346m\020:3'@\243\f`\325r\236\034h6\326\321o\363^H\363}\250>\325d\033\024jj\237bN\211f@\rY:\250\271\256~*\316,\364\024?^\324ft\373\202o\374~\207\340\242&\377H\264\260]e\020\361\264X\265\024\016\345\233J5o\235Wu\020>\037\267\223\224$\364\316\002\253\275a.\317\242\221\377\222\200\357\337\253\341\004\325i?\200\031\177\255\007\210O\212Y!4<!\002s\236\201B<\234F \215I\205\324\332\206\302{\256\261\252\227~e\333z\360\016\320U\216v\313\253\274\344!\375`\237\342\021\344\355\351\263\326\277\240\305\334F1\354\2277\177F\312\002W\240\246_]8\207\016e\341a\232\272\007\314\256\363\241F\325\261\002s\244y"
+	.string	"V\307!\342\377W\037\375\253po\013\256\267\214\255Xv\270k\323\353\363\2358\207e\351}\311\001U\213\007\214\315\026y\254a\030q\002"
+	.string	"\027\315\206\2023\017\3671^\007\374\260\001\020\210"
+	.string	"6\347\032\006W\212\3478\202\252\355\236\271\220\235\267\210y\2764'pm\372\034\216y\253\022\333zDp\333w\206\316AH\270n"
+	.string	"g\267\330W}\243\316\232H\311\311\006\246\374#\"=!\032'p*F\223\314p\373\357\275\274\2175\266\013t\206_P\210\255\237\356 \303\370\355:\030O\324\037\002\002gDg\227\202^\210"
+	.ascii	"\371f\314hbhBG\202\bC\223Z*\217&\252\310\270\255m\202\250\021"
+	.ascii	"\321\354\315\206\337\212\276\221\233\017\034\270\3508\006\275"
+	.ascii	"\241\026\375Q\023B\243\215$\006(+\032nW3L\245%p\255\36415[\363"
+	.ascii	"\332\0349W)\302XY\345\247\024M\\>H\301\n\207#\006P\200\335*&"
+	.ascii	"3\017\211\356d\361\257\007\377\211*\256^5\247a\312\fSW?\205v"
+	.ascii	"\325_S\210\217\312\303a\304*\331\370\374\035\226X\276\227\306"
+	.ascii	"\373\321\037\342\335\312\312\n\307\364\177(e[\306\331_M\364\277"
+	.ascii	"\305\332)\236J\240\221ZZ\241\271\2213(\035\013\212\025\266Kr"
+	.ascii	"\002\277\324\3463\034\035\t\223\325\004\036t\210\335\263U\242"
+	.ascii	"\345\200\300\rQg\233\033\330\232\363\004\345{\177\0056\271\374"
+	.ascii	"\200\352\306m\002\353\370\224\303\032\345D\355>\03539\326'U\254"
+	.ascii	"oO\264\254rN\264\b\0133\242\023\2138.e\217\033\353\300\357\335"
+	.ascii	"\207d\006\031e\316\322\315+\023\351.*C6\226\241U+)U%-\221\002"
+	.ascii	"\2624\336z\336\007|/2\305\307=\037\253\340\367Y\330\252^`\372"
+	.ascii	"\210\270_\225HI\347\270\221\376\023\263-\335\326#\024\0053\f"
+	.ascii	"}\360O\201\350l\267\226\314\270p\\\324\247\016\036n\001$1!\250"
+	.ascii	"\334\025\034\f\377\026\301h\270\004~4/\027\225\nL\t\272\260R"
+	.ascii	";Ro\205\210\020"
+	.text
+	.section	.gnu.lto_.pureconst.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375 n\335\002"
+	.string	"\342\306\025\035\200/4\0067\001\231\364\310\ny\305E\342\001\207\315\370a\340\366\375\232\200\r\026\345\263\003\036r)\027\310?\356\361\216s\\\033\327x\306\303\370E\263x\305)>\361$\036q\210?4\207\327\360\030\276\360\024Z\302\021\332A3h\004G\003E\002-\340"
+	.string	"W*\244\224T"
+	.text
+	.section	.gnu.lto_.ipa_modref.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\247\004}\021"
+	.string	"\266\022A> \3076\351"
+	.string	"\f"
+	.string	"\f"
+	.string	"\f\030\243L"
+	.string	"\201\231\034\342\335\335\335\335\341!\336\247\221\332\017\033\b$H\202\r\337\322j\362\322Q,\343,\2447\200\215$\f\252D\300"
+	.string	"/\366\356\356\326\266L\001+"
+	.string	"2"
+	.string	"3"
+	.string	"\325w}\327\247\361\027&\253e\031\376W\340d\347\264\344\3252\357g\333bL\352k\265]\307q,y\273e\357JR;\274\360U\f\267\242\314\262\246\365\240\022\003@U\304\367B\304\030\nq\324\005U\033\215\200\314\337*Y\245\247\207O\303\t\020:\200\020B\225\030\247\317"
+	.string	""
+	.ascii	"\362\252\332\365\005\230\323#;8:\312n\374De|\273.\2651b\234."
+	.ascii	"\2763\330\026\204\024t\t\020\0340P \t XL\300o\305\242,\305{{"
+	.ascii	"_0\315\375\202e\001o:\233\216's\235u<\231j\343RF\371/x\301<\331"
+	.ascii	"6\223\022\222\357\310W$\017\3716\030Q \337\374\030\303.\330\336"
+	.ascii	"\355^6]\022)\200\251\250\240\330L\222J\206\003\220\002\231\251"
+	.ascii	"\252n\021\240!\"H9\032I\222J\2419\345\005\353\246\260\001$o\016"
+	.ascii	"\026K\375$/\214\001\3265=\371\367g\202\2370\244(P\242I)\023\361"
+	.ascii	"\330l^<\3556\303\367\200%\035\232r\261\220}\322\3128wF=JH\315"
+	.ascii	"L\361\225\255\212\302\271,\027!\307m\035A\b\007\321a\036\260"
+	.ascii	"6q\255\202:yH~_\333%:\367\267\360\241\325\332R\212\326\001\320"
+	.ascii	"\366\2061[\30021\332\350\357\234\213\225\"\211\271],\335|$32"
+	.ascii	"\276\001\002\234\302U\302\267\206\020b\032\003\023&\353\3107"
+	.ascii	"Vw8H\200\241X\204\205Q\211E\3327\235v\201\365\023\357\217\234"
+	.ascii	"\217xj6\"\300\231\362\272\247\365\030\034\021\355&\210\322\026"
+	.ascii	"\310\026\013:\261\357\007\336\032\0352\214H12\302\323y\002\332"
+	.ascii	"\005\002\034\022\316@\264aG\022\007\030\241\006\215D%;\367\321"
+	.ascii	"\270\243\375&\"\277\302\0061s\354\241\276\214\351\220\273\332"
+	.ascii	"\363\276{\244\370z\216\206\363\263I\210\362\025\t\031\307-h\""
+	.ascii	"\004~\265$\331\002l"
+	.text
+	.section	.gnu.lto_.lto.56bb4f0a239f5aa2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxConfig_Registry.98.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375 \244\245\004"
+	.string	"4\bk"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\203\336\341\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\307\007us\336\006uq"
+	.string	"\005\001\006'\001\006\005\001\006\035\001'\001\205\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\005"
+	.string	"\001KEO\205\005\263x\212\272o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pgResetTemplate_blackboxConfig.100.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375 :\245\001"
+	.string	"\224\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\003\005\001\006'\001 ?\202\210\200(\177}\276\001{\275\001y\274\001w\273\001u\273\001"
+	.string	"\003"
+	.ascii	"@\210\224\241\007P\004"
+	.text
+	.section	.gnu.lto_blackboxHeader.101.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375 b\021\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"OH Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:2\n"
+	.text
+	.section	.gnu.lto_blackboxFieldHeaderNames.102.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\255\006"
+	.string	"t\013\265"
+	.string	""
+	.string	""
+	.string	"P"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\330\237\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\206\b{\370\374Qy\276\004\230\374\001}\301\003\330\367\001y\304\002\005\001'C\206\bw\367\001u\307'K\206\bs\330\366\001q\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tencoding"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\npredictor"
+	.string	"\007signed"
+	.string	"\005name"
+	.string	"\013"
+	.string	"\016\253\3044\244\006\226"
+	.ascii	"\302A\246YI\346\323}\\I\341\323\351\006\345\036\006\212"
+	.text
+	.section	.gnu.lto_blackboxMainFields.103.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\341\r\375)"
+	.string	"\306?\352A@\246N\007\003\203\352\263\342A\030V?\206\023\341?\024\2501j\357\315\206\247\355\242V\352h\207\243\r\214\2657\032\344\373\266v\241]\364\020\204\370\253\214\203y\006\3422\337\026=\374\323\204l\221R\332\001\326"
+	.string	"\341"
+	.string	"\321"
+	.string	"\027\274\b\221\374v1\006\337\032\222\037\017f]\013\352A\034H~\274\270\005\333\353R\006\350tP0\177\036\222\206@E\211\362\353\301\276\001\316\257/\277^\314A\357\320^\376>\270CL\210\331x\205\362\367\305"
+	.ascii	"<D\351\230mW\227\337\017^\205Ls~\230\r\350O~\277XhT\034\203{"
+	.ascii	"\373y\325\361\036f\363\211\313\377w\202\355\325h\375\017y\230"
+	.ascii	"\335\246'\277\024VA\2501\233m-\2774\356\020h\314\256C'\377\024"
+	.ascii	"v\021cs\230]F\226\177\032\037\207\316\022l\257?\034\321K\317"
+	.ascii	"\251~\"\033\3726\364\252\237\312~\352h8\314\016\303\352\321b"
+	.ascii	"Y[Z&\3424\211a{|_\322\254,gw\365\352c\350t\266W\037\255@\330"
+	.ascii	"k\367\003a\257j\234\252&-\nO\006'=\371\016\345'\353/l\257\002"
+	.ascii	"\362\f5\277,V\"4\250\371f\360\200:\272\346\233\305\004<\020\240"
+	.ascii	"\346\237\301\005\240>\327\247\371g\r\306\366j n\217\323\253\301"
+	.ascii	"\007\336\334\234^-^\312\203\307\351\327`\004kjN\2776c\350l/\266"
+	.ascii	"\327\004gpW\216V\207\016\215g\213k\f\235\315\305\366z\024@\201"
+	.ascii	"\217\221\315\261\361m\360\215\241\023\213\3555iAX\234\247w\213"
+	.ascii	"\031<\337<\375\033\334@\r\2335O\377\206c\350\274b{%:\350\351"
+	.ascii	"\0313\306\227\223b{}\340a\246:\352c\304\344\370\271v\350\204"
+	.ascii	"b{U\202\340\245\213\361\243p\004-Y\214\037\215%X\251b|:\330\035"
+	.ascii	":o\260\275N\370\232\322|\272\230\002\024\270\371up\005&^M\232"
+	.ascii	"_\027\307`{=`\301\223 \311o\007\007R\234\212\203\371\025\307"
+	.ascii	"\342[\234\213\177q0N\306\3138\032O\343m\334\215C\035\216\213"
+	.ascii	"\271\034/s3\267\343i\316\346w\\\217\2679\234\307\316\307\345"
+	.ascii	"\334\217\377qA\036u;\277\363B\216\347z\276\347\210\274\317\001"
+	.ascii	"=\320\027\271\364\263\376\307\013y\347w\221x#\177\344\225\374"
+	.ascii	"\222\367z'\017\345\243\374\327Sy+\177\345\265\214\370.\"\232"
+	.ascii	"\204w\317)GCv\224\313oq\341~0\214\241\263\323\330\300\317\362"
+	.ascii	"Xr\370\037\334fU\300\262\377\305?EJv@\030\300\023~\222\0350\254"
+	.ascii	"\t\223\354\322X\230\004I\366)l4\367E\236H\366i\334f\310sme\027"
+	.ascii	"\204\007\034\275\326\007y \331\005c\002D\237\016\nf\037\204\315"
+	.ascii	" )J\224}0\016\360\347\227\003j\325{\\\266Iw\331d\365\276T\002"
+	.ascii	"T\027y\\\256\252\214\246\025,\224G\036\255P\215\252j\221\310"
+	.ascii	"W\2051IT\227U\307\327j\351*\217\226-\324\016$"
+	.string	"u\251t\227\355\0137\267I\327\n\331*\345\026i\244.\251P\274\3116\305P=*\225\311UU\261\002\305\233\304\312CUj\371\276H\032FcKT\263\016(7J\250&\337\345\213\024\252\357\216\244\253\024\252F&\036/\324\224\261\245\202*V\035[d\321\230T\026\231\"\250\257\225\233,.\3377YDR\243\\\327J\031\325\272RD\265\305ZN\233\365Y\333\351\264\276\323x\332\255\337Z\256\373t\240\026\324w=\250\ru^\3635\242\376k\300^\324R\317\362\037.\304\235\316\345]n\304\217\270\022_\342N\374\211G\361\200\376\250\221hE\f\233\244|\nY\326 #\021!n\016\021@(\206\214A\b\223+\251\240\205\302p\314\037[\247\250?\233\276\372\245\002\360\250\322g\n\272&0\345Q\262\001;\030\201g;+\335\265\271X\\W\334\367\214t\325\027`+7\016\272\277\005Pcg\332\002nf\244\253\276"
+	.string	"\335\\\2257g\223\200\350\265++1\357\007\255\221\b\214\215g!\033\003)v>\017\374\037\255\215\310\250\233:5d\320XG{\0016I\335F\006BII\242Q\203\001\263\243\331\204\001\335\321h\203"
+	.string	"c\037@\324\345"
+	.string	"\006\334\223Y\275\243K\333c<\202\357O\202\033\230\231\240\300\352\262!\030\260\352\002\364\216\247\345,\201\272\305\001l\2229\020\332\310\333\"\357Zt\351X\036\376\322\374d{\007\370\334\351Y\317e\354\364\312\376\017\346b\247\n\214\346\300Ag\271\251\177\204P^T\202\312\016#p\226\343\016\264\337\346Y9\0307y\341_\313?\022\343&\317\321\256\243\036#t\367\326\223\027\376+\224{\210\371\317wC\254\317\360!\333x\244K<EH\233-\201\024'\357\313\376\"\334e\3307\332\262\255\324x\374\211\270K`uD]\300\224\370O\026\343\233\263\333\230\0226H\277\301\274Y\341GR0\007\001u\370\253\3627\226\264O\274F\246\213\362\224\334\370\n\264\005(Ucs\025\021\003\027\300\203q\001\\0\256\300^\b\253\255-"
+	.ascii	"$;j\220\032\336\nl\375\235\212\347\227B\364\001"
+	.text
+	.section	.gnu.lto_blackboxGpsGFields.104.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`<\001\025\013"
+	.string	"\204\021\272\001"
+	.string	""
+	.string	"v"
+	.string	"\005\001\006\035\001\001\005\001\006\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\255\222\361\312\n}\276?\202\210\2000{y\277\001w\275\001u\273\001s\273\001q\274\001o\273\025\001\006\005\001'A\206\bm\330\326\004k\302\303\005\005\001'L\206\bi\230\326\004g\306\307\004\007\001\005\001'Z\325\004k\314\315\001w\313\001u\274\001s\312\001q\273\003"
+	.string	"\230\325\004k\321\322\001w\320\002\005\001'e\206\be\330\324\004c\325\326\035\001\023\n\005\001'q\206\ba\230\324\004_\332\333\331\3308]3\334\0014\327\001\324\001\323\001\317\001\316\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\022GPS_ground_course"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\nspeed"
+	.string	"\raltitudecoord"
+	.string	"\013numSat"
+	.string	"\005time"
+	.ascii	"! \360\"\022\233\007 \030\376pC\030!\002A\2242qO\264\363\030"
+	.ascii	"\343\363u\221VpK\"\335F\207\3148Oh\250\247dlBP\376\033\222\303"
+	.ascii	"4\306\261\333\255\374\267\3212\376g\270yf\277m\255S\326\305\320"
+	.ascii	"\203)\002"
+	.text
+	.section	.gnu.lto_blackboxGpsHFields.105.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\204\007\177"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001\006\035\001\001\005\001\006\030'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\340\313\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\273\001q\273"
+	.string	"\330\335\004}\302\303\001w\301\020o3\304\0014\300\001"
+	.string	"\tGPS_home"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\n"
+	.string	"\303*PB\b`\223\252\f\005\222\301\n\257\243\354\002\373R\306\033"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_blackboxSlowFields.106.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"}\t"
+	.string	"\304\017!\001"
+	.string	""
+	.string	"\202"
+	.string	"\005\001\006\035\001\007\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\271\232\371\314\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\274\001q\273\001\005\001\006\025\001\004\005\001'E\206\bo\230\347\004m\302\303\003\005\001'W\206\bk\330\346\004i\306\307\002\001\005\001'f\206\bg\330\345\004e\313\314\312r\206\bc\230\345\004a\316\317_3\320\0014\315\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\026rxFlightChannelsValid"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\021rxSignalReceived"
+	.string	"\016failsafePhase"
+	.string	"\013stateFlags"
+	.string	"\020fModeFlags"
+	.string	"\025"
+	.ascii	"\022\007\001\013\253\016l.\003\207\001\363@\346S\226\001#\300"
+	.ascii	"\3506\222Q\246e\300\013`4\310\030xV\225y\302*IA\031\276\330J"
+	.ascii	"i\020\003p"
+	.text
+	.section	.gnu.lto_blackboxMayEditConfig.128.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375 \375\305\006"
+	.string	"\222\214.5Pm\222\016\244\034\021\256r\210\272Y7`"
+	.string	"@\356\321\223$\370\252\376\354\333\277[\032\352\250\340\216\001\260h\236\231YD\021}\270`Q3\346P\243\265\266\211L\001[\227\211+\303`a\0322\317a\001\243y\026\006\361.\003_\017\n\330\213\270.\354Y\266\354\210\004\037\004\335n\252\"bC\036\240\202\224\264\271\033Kp\\\265R\227S\225*\006T|\\\3517\217C\214\357\224x\361\273\321\271;\t\220J4'\231\242\322J\222P\"\035\177\347-\037 t\316\272i\210\3121\022\nQ\311\334\036f4\253\313n?:\241\230\244h#O\035@Bf\356\264\021E\307\376\005\277\301o\021\n"
+	.ascii	"`\251'3 \f3\205\273\021\312\022\327\304\307\210\274\204\310\341"
+	.ascii	"\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_testBlackboxConditionUncached.130.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`p\bm+"
+	.string	"\372JD\020Ep\334Q:\317Wk\300q*\242\n\300K\005\024\331H\360G\030dB\340\005\0226C\237\343\362\021F\235\216h\2210}\341\232\270\006\302\377\205\323\f\b\306-c\033r\025\275\200g\366*_\355\177\373?\211\225R\246\362"
+	.string	"\337"
+	.string	"\366"
+	.ascii	"(\037m\376\211\343\343N~\343\370\334\374-\260M\257\2665\246f"
+	.ascii	"\255\306\246\237\252<\303t\375\337\3774\376\336\177\346\177\305"
+	.ascii	"v\214\306\222\315\300\005\253T\222\251/\265\2329\370\003\335"
+	.ascii	"\236FKD\367\304\255\020\272\347\377C\210@\343\351\232e\031s;"
+	.ascii	"\226E+m\265\232\035\265\222Mw($\f\n\002\001\177\276\036o\247"
+	.ascii	"\313\241'\2569\375>\355\020\210\254\263&\364\301(G\250\265AZ"
+	.ascii	"\034\\\222\305@C\3105k\300\016o_\304\230?]\034\343\331\232\317"
+	.ascii	"j{8\"\233$v\026\034\325\374X0*+\346\265\241\032\2023\002\243"
+	.ascii	"\022\302;\001\306\2615\035P\327W\216g\314ZC\223|0\317\205\342"
+	.ascii	"Z\334\226\355I\325\246\024c\"\361\301\265}\254Ad+HU\321\206\024"
+	.ascii	"\257G\024\027zj\241m-\022\252\">\316!\325Z\317S=|\354\211\373"
+	.ascii	"\257\326\377\t\177."
+	.string	"*dQ\334\3746\367\026\377@q\363>\376\227T\360Nm\017\217A\224Q\375\364\265\262\2334kS{\342\267\005hZh\355\346\373\206H\307\253\032Q~\331\f\223^k\276i_VP;Z\t\235Y4\233&(<\023\213B\346[\006\350\355L,\212\230\357\230/sI3\277/_0_\346\322\252|]\276^z\347\251jd\342\245\345\273\205\307T\273\262X\366\354K\335\352t\035*\036\245X\224j\204\312\267\312\227\023\336\354\ft\317\225\362\177iAy\264\252\365i\217\377\227<U\025\354\031\354-[^\0325\343\261\022\341?\277Y\0247\326\277\335l6\331\274\257nt\376\200\363\213\316\017p>\200\363\211\316\037:\237x\376\360|\341\222\355\006w|\340\216\377;\337\327\374^\363y\347\357t|]\216\237\013O\307\3222\336)\242\036\026y\242\214B[\242\033\025S\355\327X\347\036\203e^\203\375u\216\377\327"
+	.string	"P_c}\267hK\016f\257\257\030\003\021\003\232k_\036*t\244\270\317\377\013\353\206\241ONA\361MX\230=\322.\tE;@\243p2,\237$]\255R\022\276l\273G\3037p\340\235\342\200\356\211\"\340\223\306$C\356\221t\270\242\036\036\223\\\226\323\322\344\210X\267\036\320\377\003\b\336\251\001=<\202QJeYN\033S\242\215u\021\350\331C]\324\2458\346!v)b\223Y\377c\354\235\021\b\262j\255\024H\254\235\022\272Z\253\204:2L\034\220\303\005\003\335\363\354M.!\003j6\233j\233"
+	.string	"\r6\256\321.6\216\3378+\007\306\227\353J)\316o\nt\317\356\035\020/aUPfv\313\026\204\036*\346\331Xf{\244\305\005\233\333\250qV\212\001LMK/\226P05)\355\256\364@F\323\t\025J&V\2348bZ2\301\342H\311\311\305\321\003\002oj\221\302\351\350ES\223\323Q\317\fjq\265\257\316_o<\204\303\3469ni@b\357\021\267&?\242\006\"\353\024\221B\302\366\2551y\370"
+	.string	"t\177\361I\323\005\350e\333\223+\352=\302\306\003\035\320N]VE\3449\3249<F,H\034\333X\241QG\021\331FIw\372`A\362n\212\372:\307\337Q\337){$\334\260\261\360l\257\205\275\3051\254\203w\210H\227\244[[\350\236\275\316)acVm\233\345$\232R(\210\301r\260\301\002\201=\024\032\325Z\203\372\252\013\3455\2031a\034i\327\r^O\230\023\334\024\3355\203Q!b\336\365\260\b\030\245Tr9Y\246\004j\254M\235\240\272&\366\211\226~1T\352\204+?\245OR(iX\032\266d\256\232=\022\320"
+	.string	"?\200\251\250a8\343 4C3\"\222$\251\024:\220\002\221!\263n\021 5b\026\211\214$I\322v\340\241C\017'\333B\265\263\367B3\317\227\006\217\230\313Q\300\224\252d\303\307\003\314\310T40^\"\316q\203\001`\031\007\005\263\2728J\207\257p\177\220\216n]\004x\306?_\301\270\3341\313\037W^)\345\343,r\353\271\206=\321r\307\360wj\021k\220\263\216\2107\b\242F=\341\273\005q\024\244R\264\267\005\032\230\007iU\357\212C\345\241\320\361\026\272\351\216x\242\365\036x\374,#\rS\212\231\271\374A\027\266&\261b\343\301O\327A\370\033]\003\220\006&\023\001\243\345\362\252\353C\201\362\340A\364"
+	.ascii	"\230\366\222\353k\b\263\261\020\327\3529{\276\200x\034\004?:"
+	.ascii	"d\217\211C\027\217\206 iW\342G\f\344\311\247Z\210\034\303\362"
+	.ascii	"\205\f\272\324\262\272+\3127\004i\360\244f\2151\0079\223\354"
+	.ascii	"\326\005V\236\270\233^\304X}\344n#\031\230\245\276R\367\260\250"
+	.ascii	"!\225J# \373\306J\310yy\344\312\232\321\"\365W\375\210\355\201"
+	.ascii	"\364\224=}\335\227o\325\261\341\006\016\366\341\376\226M{z\230"
+	.ascii	"\275b\303?\253\221\375\273\315p\274f\320\263\316\334\243d\344"
+	.ascii	"L\374Q\001"
+	.text
+	.section	.gnu.lto_blackboxBuildConditionCache.131.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\253\001\345\017"
+	.string	"\006\035gE\360\262&\035\202o\203I\016\323\036=\032\203\255E\362\342\360\222\343\227\211f\035\206}\337\346G\2209\344\250\346v\354[t\375\274O\206\317F\372\344\f<\003\327i\021\202Ig\320@\216B\177m\252~\262\367\2262\245R"
+	.string	"N"
+	.string	"U"
+	.ascii	">T(t\346\234\332\206\260\324\3223\031\341j\311\2679\\q7:\317"
+	.ascii	"\364\f*\f\026-@\236\n*\230\021\321\372we\361N*CZ/\217\033\016"
+	.ascii	"A\336\00582\347\364x(\335\177\217+\356\325y/\327\214\301\234"
+	.ascii	"\323\332y-7\310m\247l'\260?#45t\2740\366\347\256[Bu\204j\b\325"
+	.ascii	"\273jU\365A\242\0162J<\346\314\020\333\231\260\350\242\346\256"
+	.ascii	"\333\037\341\177\366\234\304K\224\356R\371l\231\357bZ\034\216"
+	.ascii	"9\277\003\217\016\201<\216\\D>\302\013\220\217\367\270d\333\370"
+	.ascii	"\0273\263\232p\r\310p\320\335\275\352\207\\\004\327\035\260\342"
+	.ascii	"b\244vN\032\373\016\031\025'`\005\371%\335\344\240\264\207CT"
+	.ascii	"\256]\262\355\277\007\240\201\343\002C\255is^\270`\330e\235H"
+	.ascii	"\337\304oN|\032\243\244\350\273G?E>f\257\230\216\216\025\215"
+	.ascii	"\331\237I\227e_$\rL\266\021\364(Da\023A\030\221D\020i&\017HJ"
+	.ascii	"\264\021\tE\013\025\360&\301\001I\233\260m$\315\363\315/\214"
+	.ascii	"m\363s8\036`+{\312\226\345\005]\374,\200\0315\013\001\020\207"
+	.ascii	"s\316)\227u\025)\367\263\026N\334+\365\341\2441\215qW\274\313"
+	.ascii	"\001w7\356U\032R\004' @\002\243\220\252\033`\352\305\003\177"
+	.ascii	"O/\332\"&\325\257\217\271\264\0020\327\342\330\303\026K\260\240"
+	.ascii	"\344\022n\034\262\030\212\235\302\004\203-,!\020k\317\214>\253"
+	.ascii	"\232\r,k\305\213\235\202Z_,\240\215\254\244\026\032\332B*\353"
+	.ascii	"\364\323Dw\f\205*R|\313\246eu\330\264o\022\314\023"
+	.text
+	.section	.gnu.lto_blackboxSetState.133.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\223\004\345\027"
+	.string	"Fg\215I\300RRc\252\242\200\337\274\245G~\f`u1\245\rgO\2274j\240@O\322\225\357`\006\303;r\346@.\220\tDw\276\253\374`\230\254\030\02596\330\246\220E\201AJ2\361S\336l8\230U\304\335\266\334R\246\024v"
+	.string	"t"
+	.string	"w"
+	.string	"$\266O\355\023\375D\356\302\031\303\356\005\252\341t\3570\201e\346m\201\233\224\267\344K\312[\347\354\254\0016W\267"
+	.string	"\330scd\274\367\316\252\210\347\0163_\245%+\315\371\006p\260v<\335aM\346\322+\251\024Z\005C@\362E7\255\200$\266\200z<\257\347M\007\033\016#\274\232\022\326\363%\035H\207\347E_\f\356\275\246;^\357\036\271\355\240\355\023\233\344\t/w\256\221\207\216\022qR\317\207Ta\370P"
+	.string	"\230\234\374\027$J?&\337\205Y\364K\272\322[\220\257\377\\`\360w\344\263\250\273\031*\374\025\3643\345\355\356\332Ga;\313\274Ww\237\333T\234!Q\360\376\334\003\267\266\306\252\2049>\367\244E\354\241\216\326 \373\344\255>\373\302\337R\352Z\251)\245~I-\230\363\201w\017Z\367\346\034\207\\\242}\032\n:'\225\221\370\0336,*\244\307\252\266\210\266\006U;\302\257l\002,\341V\023n\213\225\310\216+"
+	.string	"\265)\320*\211T5E\254\251:\373\266\322\256\335\206\315d\304\275\367\304\237:U\005_\350\326+,,\345\355\2063\n\301}\251\323h\271\341p\345\255\2063*htz\264\363\353\"k\020L\351G]\006\214/d\f2\364\273[_\246\274}\357\2042\372\240\241G?E\266\030ZL\212\214\315\305tM\226\341\246\302R\243YP\231\271\254\320Zf\265\027\230\231\214\200o\027l/\263\230\333\355eF2\274\257>\233E\023D\232Zc[\375 \0272\323"
+	.string	"\005\245\274\205p\356\350\352\031>V\004\326\343\361\330\005\253F ?j%\221\212!\376\364X\021\204Ik\017\007\270\035\227/\365\255\226\024\034\255/q^u\235M\217\025w^ZYV\301\245\307\252\216\304Rv\373\301u8F\016\034\017j\250a\\i\024:)E)(#\035\340\002\021)\353\006\021"
+	.ascii	"9\312\030\215\210\030\312\3653\240\200\023o\302n\364\312&\265"
+	.ascii	"\330\024\2767W\227\001|i\326\366q5(w\375\006\263]\001\277\275"
+	.ascii	"\013\026\234\027\374G(\027\274\004g.\333\241\350\271\224\310"
+	.ascii	"\2001\350C\342\212)VM0b*L\323\035^\005\364U\376\325\001\275\020"
+	.ascii	"\225s\002\223d<\"l\265,3\375%\f\351I@\315p\202\211\225S\251\335"
+	.ascii	"\002\2173\237\233x|\252,t\320\331\256\250(\210\327\334\023\261"
+	.ascii	"\347L\334P3~\357\271Z\201\b\362\235\310\374\244\345\203\025y"
+	.ascii	"Y\001\361\251:J\0043\021\316(c\004\344T\354F,Tb*\311X\301d\241"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_writeIntraframe.137.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\254\025\235U"
+	.string	"\272\212\210\036Q@R\322\351\177\375V\266\231\367\351\367\177\331]\337}\367\212\370\315\024<q\3761\320\272\222\317\2514GG\202Q\315\037\212\362\303V\376\361\027f\210&\355<\220\231\375\217@\325M\310\334U\201\242\350\357\306\206\364W\375\377\377\236\236FB\366\356\226RJ\001\310\001\260\001\343\001LCt\236!:\027\211\31621\316\304\240s\314\320y\270:\013\207\3160B\347 \320\031\030t^a\234\325\240s\nt\376\001\235\177u\366\325\271;*\004\037t\256J\027\325\323\211\335\252\350\336\215K\325\240\264\\\367[wX7\225\356+B\350\026\r_y7\304\361"
+	.string	"\31558\026\276\361Z_\"\267=\310\353\322\272\273\367>"
+	.ascii	"\264\241\333\230\232\214a\232fR\230\230\261\350\300\366\303\332"
+	.ascii	"\316\0363\206F\313{\036I3\243\001-\004\032\363\336k\326gNM\306"
+	.ascii	"\257\\\313r\342n\241\313\230\205\274\243\311x\306\f{\317\257"
+	.ascii	"{\257p\007\263\260Sa\263\320\320\036ca\225\266\322\366\225\247"
+	.ascii	"\342\225\273\255\254\353\032rw\257\230\f`\247,\006l\261\236\322"
+	.ascii	"6\025\037\277\313\024\273E\326#\363\316*\006\260\323\276\305"
+	.ascii	"\257\006k;\354\207\017\020\261\253\\\347\266`\370\n\352\224\207"
+	.ascii	"\200\235\372\364\215\332\351\257k\324N\271e\336AG\352B\271\350"
+	.ascii	"\0222e%\357\336K\364L\272s\370\373'\326\254~\333:9876543E\031"
+	.ascii	"b\314P\b\023\004\256j\372{o\271\307\332\204\223\017\252u~>rV"
+	.ascii	"R~>O<\207\004\"P\032g5`\256Ol\321\360\345\245\204\b\224\276q"
+	.ascii	"\3226N\232x\315V\323l\225\3403Z]\324\312r\031$MD\362\364\230"
+	.ascii	"\253\036^\035q\241\221\2061\342\364`\t%D\232\rl9\253f\217u\t"
+	.ascii	"\023\254\230\276\376\212\367^\242r\352\267\302\205(\217\256\302"
+	.ascii	"DYv\032B\377~@wi_\210J\251\337M\325\223\244P\t\304\277\341\032"
+	.ascii	"\250)\003\224\256L\271l_\r\270\367\262'\225D\232w\232\271\347"
+	.ascii	"\230\031\002f\033\244\3517\\\003\351\240N6\344\363\370\367^\250"
+	.ascii	"\377!\227\270\324\017/\2714\272\261\237I\253%\024\001\351PJ["
+	.ascii	"~['\300\024\370\317slvI.\035J\357\265^^\307\035\004\353C\033"
+	.ascii	"\245\250\256\311\223\332\251\377\316\031\226\260\037\357\007"
+	.ascii	"r\213B\253\202\017\367\227\306k\275\270\233p\273B\013\326\202"
+	.ascii	"}\217\2657\317\232L\037\347\026\232\327\324&k\350\001;fm\b$\340"
+	.ascii	"\235\344\024s"
+	.string	"xqR\017\305\355\326<\034\241\350\322w\fp7q\300\233\315\\\026\2009V\241%\275t[\353pt\223uoT'\271\355z\013\003\016\034\035\251\235v\033?\320P\tb\262\356\275E\335\326\r\034\253\306\222\313(\217\n5\335\023\001u\367^#n-\215\303\f\356&\2352\215\032\336\311\032j\247\t\374\232\304\354\204'\230Z\224G\231\305\216\376X\367\336\313?\002s\320\371\007\215s\0076\316>V\347\036\253\363\323\352\314cu\336\261:s\260:;\255\316M\2533\323\352\274\264:o\260:\353X\235\225V\347\244\325\031\251\337\232s\264\\s\006\035\326l\203\350LA\320y\202\325\271\306\352Lcu\236\321W\232\023h\271\346\030\375\326l\364\3160j\234\213j\234_\3208\273\240qnA\343\314\202\306Y\200w^\261:\023\021\235\207Vg\343\320Yhu\016\032:\003\255\316*\206\316)Vg\024C\347\237\240s"
+	.string	"Ag"
+	.ascii	"\206\316'\202\316&\206\316%f\234}V\347\236\2423O\321\231D\321"
+	.ascii	"y\304\320YD\214s\b\031\347\035\031g\235\3259\207\350\214\023"
+	.ascii	"t\276\221q\266\t:\327\254\036\256\245\235\n\361=\320\022\340"
+	.ascii	"\222K\233\036CJ\350{\237\276\207\334\323\367Y\315N\213\267.\356"
+	.ascii	"\266\363=P\255hrI\303c\b\223\035\317\243\206\035\337h:\302\031"
+	.ascii	"x\3605\235\347\201juI.grp>\347\373\214\355\301\323\330("
+	.string	"\020\347\333\213\363\254\310\301\020\022\222\370uz\016^p\372N\223\271\371\301\313n\236E3\252\027Fl\212N)2}\323\030\323w\f16-\2407X<\247\302\352\331|\017\024\tZr9\\\352\003n\360K,l\360\275&\254\371&c\203\360\025\332\253a\035\214\232g\321\374\342\025\006\243\003\b\026Sz\035R\224\276\331:\370\3434\024<\315\314\331T_4\332(\324\231\247\340\331\247\230\307\227\371\231\027a\005\311ud\371\274\213\215\026\277\317\264\302\234\313\243\260Q\250\366xT;\225y\365\256\331E\217\t\364l\003\001\370XL\325IL\252/P>\267S\250H\237\344\004\351\033K\253\230R%\313\023\214\351I\232\250\205C\312\263\332)\342\363@\217\340%\227.<\346\233l\3701\256\304Gh\203\310X\322\026yQ\227\016\277\367\232Z\364\324\2040/|\343\220?\333 ]%\353\252-R\004\363\252U3\213\227\332"
+	.string	"n\354\340\220\266\252\211\201\322\231m\221\340\363@\215\260\001A\b\301\213"
+	.ascii	"m\034\235\321\344r},^kHs\374\333yP\033\275\020c\033}\207A\373"
+	.ascii	"\247>\226\321\347x\231%N4O]\370\372\035\327l\215|\340U\355\025"
+	.ascii	"\221[$\376\001\001\353\017\320\\\323\343\2766\020\276~\217\305"
+	.ascii	"\255\227:\343\217P\331M\351a\316\016\210\003\3015\236\306\317"
+	.ascii	"\370\236b\036=\352B\222\320\370\037-\346\004_\343[}\241\236\340"
+	.ascii	"\373\206NM`\232A\351\256\354\035=\312\351\253\337\\\246\372\212"
+	.ascii	"F\037<\272)\t\307\322\222\023\00228\220n,]\2206%9)!\260\244\324"
+	.ascii	"\244\204\004\303\026\f\361P\252@\003\013n\344\250\200(\t\203"
+	.ascii	"\033HD\026,1\021\r\365\260\222\016\034KDMJJKDB\261\250\376\021"
+	.ascii	"X\0018.\275\273\250?\262\217\337\275Jd4\225\356;*\354\230\312"
+	.ascii	"\337\365'\260c-\260.\270\240v\332\303\311'\305\007"
+	.string	"\030\037\205\253\350\371\2378\201\361\215<\301\006\365\305\027\375\016\037\322\204\177\361-\336\305\357\254!\325X|\213\327\341\202|\002inS\005x\026\337\310\266\3433a\323\200\217\365$\260g,\032\233\306\246\251\002|\316\034\2241d\n\307%J\210\307'xI/+^\204'\234,$o%\351\345\257\236\200\177dE\220\222\215\353\t\246\026\201\377\370v\341\235G9u\337,c\327X\266\016\376\307/\217\200\037\202\217\357\340U>d\n\3072\026\013\360^ E>\276\313\332\2504\023\341\t\026F4\364Do\264\341\255\330\350\320w\rN:\2570\243\320\033\207\236J\210P\020\320\007\275\361\245~\n\311\302\0259\220\026/\025)^\205\361\241\334\376\262p)\262\240\370y\024{n\036\004\013\367\223\3469\263x\251\351<\026\007\355p2\370\267\273\021\352\0306>F\233\347\304\370\f\276\006\272\005\207|\036\003\370\316\002\300\233\370"
+	.string	"\276\317N<"
+	.ascii	"\337S}xm\220v\373\302n\351\265\023\337nZj%\336\3047\225\373\320"
+	.ascii	"\006\221\321\003\214\022\337s\235\3569\337\274\036\307\347m|"
+	.ascii	"\363M\365=\340\314\354\034\253\305;\351\363\037g\367C\334\361"
+	.ascii	"\241\370\307{x\276\347\215\3107\022?\342y\276\221\\G.\276\003"
+	.ascii	"\243\261t\374\002\277\240vJ\342\203\"~\304\353XA\336\371\226"
+	.ascii	"6H\001Yl\016n\307n)\022\361\235\347d\323S\273\t\201\003\016."
+	.ascii	"\001\201\235\250\2014%\021S\246DD$I\222\264\031\301\005\204\030"
+	.ascii	"\344\230K\036\021\300 c\214!D2"
+	.ascii	"$)I\222\264\006\301\"\037\244\327\371E\225\374,%\241\3710\257"
+	.ascii	"\265\312z\332\301m\233hT1\206\001=FC\372\366!\214@\331\353\311"
+	.ascii	"\260"
+	.string	"v\213\354\244 \245=8\326\265=\306\331\225\207\351+\026t\223C\306\302\025t\221\350\376\215\341\324X\002\230\200*l\375\002,\2453\256\310 i\311@\205\320lj\307a !\322Z\020\025\267Y1!W\215g^3n\033\326\310\214\f\244\346.\317\305\255\302NK\313\2378\207\241Z\264\323\367\260\213\306\214U\262:\034 O\360H\240\226\364]\362\327\341`U\276tO\324\254\263c\3753\310\t\036]\233\325\023\212z\304\364\375M\312\004g\031\356\fl\212g\237\223\306m2Ls\274\tl\330\332t\007\037\001\354c\212\370\357\255r\3076\224\"PB1*hD\316d\n\206+Y\342\213??]J\235\202J\255m\0074\247f[\241\207\232\215\311z\026\0132\252\325\204P}t\224\300\243\003\371\241\027>\214\211\3302\022\277\204pgy\031$:Q+'\b\316GF\360\\,$s\265\223\267\206tt\340I"
+	.string	"\267M\367z\310sX\206\022xtt\362W\277m\"\177\301\341`\206TG\370\031\26305xA\363A\204\221BE\274\301\021\337_~\330\234\022\210\330\254\025\007S\310\244\230\313\025\314\bp\005\225\376\021\n\232\377Nc\226\024\002\004\264$\216?\301\255U\265\245\250N,Iv`'\272\365\213]\253\363$\226\223\365p!\261\266\203\232\3434\023\302v\333\207\336\264%\270\211\032+\321\305\277\267\351}\265d\303j\001\213v\260e\363\213\003\006\273.\334\344hx\253:k\032\253w\340\367\312h"
+	.string	"\n\266\002\254E\221\365\207v\020w\005x\002\026\230t\001\337\226\213JT^\367\316\320V\023\\\264k\324O}\312\374\021Ss\205\361\017\212\241\306\313\225\343+nI\363\024[\217ta\324\360\231\231N\214,\367e#\355u@\025\2060\353\361\037`\341\220\236\236\026\215\255\350\215H\352\204\\1\374r\nn\317}\330\206$\223\366b\321(\270Q\304;\004\205\204<d\223\344\0324\310\237\331\316\322n;\003A\2717\332\203\nCH\0023F\375JC\230Ap\r\327\177\225\201\302\355<\233\244\3756\007-l\026\212\356wM\030p.\314 N\346\004\303\220\006\232\f\020y(&Y\366\240\320\245\364\004\275\365_\220\223j\267\260\252v\336Y3\227\033I\342\207\233Q\244\243HR\206N\216\037\272\246%\340\355\236<\007\223c0\022A\301\363_v\022\214\271\376*"
+	.string	"\tg\004\250b\364\025\302\254\247i\207?\267I\t`\306\240\215\027 \356\013"
+	.string	"\336[P\206+\020\256\253"
+	.ascii	"\f\217\0136\310e!:y\303\013\360>\227\371/BQ\003"
+	.text
+	.section	.gnu.lto_blackboxEncodeMainStateArrayUsingAveragePredictor.138.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`p\003\205\030"
+	.string	"\346\356\237H\240\230Q:\020g\232d\314\243o\001\007$\214\276\243e\037@9\260v9\202\277\234\341\022\353e\330\357\203c\373\n\224\247\332\321\265\"e\030\017\371\221\007\235<-\320\364X=\245\311\021\3646s6\007\177\351\223F6\2212\245\214"
+	.string	"\177"
+	.string	"\213"
+	.string	"E\030\250\3577p\307\341'\2605\177z)~\3149e\234@\2744"
+	.ascii	"^\355\327\270\r\334\221>\300Z\363'G\320\2179}2\236\021/\355{"
+	.ascii	"Lx)>@xi\234\375\004\226\233<\nb`\001\241Te\316)[\024N\215\343"
+	.ascii	"8\036\364\335\240\342.\301U\234\257t\2607\303\307\216\307s\t"
+	.ascii	"\246rA*\\x9\220&\n\352w\246+\020\317G\301\026%\276g\272\354\035"
+	.ascii	"%\331\361J\\S\013\346\234\326\035\217\304\035\336v\007\333\023"
+	.ascii	"\3545\0214)\242\240\274Dv\354H\377\2007\335\260'\375\002\244"
+	.ascii	"\372u\034\177\314\227n\227\252aT\335\022\325/)\265\213\252Y\252"
+	.ascii	"n\021\325\253\224\032\200\252U\242ZL\251S\241:\f\325\022T\203"
+	.ascii	"\240z\245ZA\365\t\260\230\030\361\276\202\312\234A\343\225\251"
+	.ascii	"D\376V\274\351_\262\277\303\347\341U\223\007\021D2F@\020\257"
+	.ascii	"\303g\362\352\322\366\222\237>I\314\207\250\"\003\bj\316y\340"
+	.ascii	"\322\017\304\313\257\354\244g-l\325IG\243eU\313Z\020\213nh\265"
+	.ascii	"-\027V\340\002X9E\\\325\376Ft,\210F\276\206=\220\320kwS*\035"
+	.ascii	"\214pu_k\325\r\351}$\224\033\356u.|t\264k\345\236\307%,9\202"
+	.ascii	"\262\273D$\307\333\013\371\220'\275\237\302X\222\221\237\314"
+	.ascii	"\177@v/\345D\322\214_\314\352\252\023\020YztDp\037\034\3049'"
+	.ascii	"\215\357\364\0364\337\350\322\030p\364;\234\360\362\373(B\243"
+	.ascii	"\225_\217\216\266\217G\267\310~\266\332mF\243pc\323Q\321~\313"
+	.ascii	"\331P\233I\017\266\332m\207\326 \307\301\355f\247B\205\b6[\215"
+	.ascii	"\353\266Ca=\233\351P\263\3010\253\311`#\313\241\325\340\310f"
+	.ascii	"\266\035\331L\001\327tnl\262[\255f\223\255|\363K\244\364\207"
+	.ascii	"x\362BI\317\372\310-\262Jhc\273M\364\300]\013$`]{\244\034H~4"
+	.ascii	"\352\340\234s\202[\344\332\330\236\351\022zGItC\n\263\003\326"
+	.ascii	"\236\335\350w6\220[\036\303\266\2650{'\035\213\227m\331\274|"
+	.ascii	"]\366\325;\032u0\036$> \200\002\031Bb\007\340\353E\007~\337\241"
+	.ascii	"\306\201\322\263\326\017#\21508G\356Cn\347\232\343\235c\317\240"
+	.ascii	"\013\354\275\027\261\246xp\307,\020\342\304o\212\371Z\245e-1"
+	.ascii	"\322\272\351'\033A\206\036\333\320\331b\365[*,X\265\b\370\316"
+	.ascii	"\023\315!Ft3|u\n?\330K\260\035\261v\331\205\324\034(\342\254"
+	.ascii	"{`\fsI<\302~H5J#\300u\0329_\310a\312!*\206W\2441\345\275\227"
+	.ascii	"\310\"/,\266\361\200\0231]\346\t"
+	.text
+	.section	.gnu.lto_writeInterframe.139.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\202\033\335q"
+	.string	"J\267\\(M \322\322\031\016.\236K\331Cw\334\035\327\r\fs\037JYm\270\242\214f\2016g\225\313`\206j\220\253X@\264\247X\351x\357\007c$\037"
+	.string	""
+	.ascii	"\004Bw\2440\363V\020w\267\221\3570\354\275Xg\267\336D\225\226"
+	.ascii	"Fdo)\223\f`\002G\002~\002;D\344\035\221\362\n\245\274A)/P\017"
+	.ascii	"\2571\345\375!\362\372\020y\213D\336\036\"/1\345M\207\274\303"
+	.ascii	"!\257\020\345\345\031\362\006\207\274\350\220\367Dy{\310\313"
+	.ascii	"(\357/\345\210\356-\017.\r\254\367\334\326\253;uV5\350\035\225"
+	.ascii	"\377\375n\376 \376\346\337\366\273\375p\177\227\377\313?\367"
+	.ascii	"\327\235\270\3737KDJ\342\266f\361\274\315\375\255\321\361c\201"
+	.ascii	"Lm\206\276%\022\001D\233U\340\313\357\n\337\022\233\213G'\355"
+	.ascii	"\314\227B6\327\203\372\335\246_a\350@\355\346"
+	.string	"\311\3710\307C\232\023x]g\3304\313X!s=!\230`\353\272\212\371\030\023~\267\235\265\347\304\204\335\357\3600\273\304\215\372\335:\005\261\306\\[\327\225xt7j\227x\264\370,\327\362\270{\271\016\247\273\335\022\353\246\232\220+H\220\026f\266\256nG\204r\007\243~n*\253\231\306\374[W7\022\334\204_P0\256k\326w\375\245\211\375\211 \334r.\352\273\0309\327.g\032\026\017\204GY(\230\303\337\324\303\245p\256]t\244\255\231\255+\226\223\360\350W\343\205\202nTB\244\261\331\020\036\335\257\235M}\333\342}]\262~\205\037\324\256\376\326uU:\272/\204G\221>\024<z^(xT\335uS\244d\255\232\221\366\245\214\243\263\256+SK9\317\323Dw\033\317\363\034n\377t\373\006Q\365'L\2240*\"\"14B(\b\310\370s\344S\354!\246C!O\020=\233\325=OS"
+	.ascii	"atU?\261\366\006\0076\201\345%x\232\336\\\200\271\27755(K\260"
+	.ascii	"\334H\355EjW\230\210\312I|\r\026\225\032x\210\206\217\240a\n"
+	.ascii	"\013\315\360\240\031d`\240\323\b\303O\214\215<M1,!\373\317\221"
+	.ascii	"\220\375\310\357)\326`\225\261\261\017\363Ef\030\367@Y\002v\342"
+	.ascii	"\032,\260\023\311\356\213\323\263G\017\255\311\327`59ex\311\351"
+	.ascii	"\275\357)\316\260\272x\230\"\206%^\027\3624\365\375L#\242\n\224"
+	.ascii	"%^\3479\215\353\272\372d)O\030l\225\205\344`Z\205\353\350\326"
+	.ascii	"\317\263\305\237\335\020>YJ\316\241\253\032\226\304\254$\334"
+	.ascii	"\347{\213/7o{_\262\270\316<M\353\272./\263\226|Q|\227\245v\327"
+	.ascii	"j\327\b\205\305\366\221\241\314GJ\024\216\241\330\037\344\255"
+	.ascii	"\315Y\342\245"
+	.string	"\273hJQ\313\374\262\324$\273j[\360\322\211\335\343E\245a\250IE\255Bt\242\354\252]\026cZ\351i\024o\311\305`A\320\370K\265A\210./\217g\304\376 \017\313\235%\227\nN[\270\252\232\212\005i\330i/)\355\b;\330\303>\021\230d2)A\330\017d-\336z\201Q\236~\2352\264\271\203m\024\2274C\362\235\345\253Y\202g\243m\304&y\206\304*r\366\177([b\027Z\350>\032>6\266R\263\b\227\227*\330\020N\231\n\036\345>\034_\033\2570%d\345\373vG\353|\231\001\274C\301[\367\305\013\376\356:D\36030\350\345\230\200\277\\\026ys\324(\351\252\375\036#qZ\301+W\355\330O\341\301^\337\276\nR\344\025\335\022\316\365\036\3504D\266\256H\276\334\027\361:;x89\005\217^o{\\\207\016\212d\353\272\322\270\336\317\272\256:\310\275/\\K\2473\305"
+	.string	"\331\234\020Z\352\213Nm\327\305\345L\325h\256\353\212\300>\316\205\320`?\345\350\372\340\200\277\344 x\364\251y\236\230\021\202\311v\207\204\357\354\272!\271\307\364\320\274\352\266a\330\205b\344\375\223 \336;\021c\206\201}5\361\352b2\344=\327\233\337o]\353X)\357\253\250\206\274*\034\031\362\032)r\302\220w*\352n\337!\237\373\206\360\272\357\323\377\276>\356\346\273\201\006\031\364x\333\027\203\267}\235\336\366\275\340A|y\274\371\265"
+	.string	"\345\335\001\304\253\003\210\267\002#/\005F\336\t\214\274\022\030ys\240\2748P\336\bR^\bR\336\033>\274\017\244\2746|x\233R^\007R\336\006\212\2745R^\006\212\274\013\244\274\n\374\360&\220\362\"\220\362\036\340\303K#\3455\300\207wF\312+#\345- \345\215\221\362\302Hy\231\212\274/R\336\245\"\257\213\224W)\345m\221\362\022\220\362\262HyW\370\360&\245\274\003\370\360\252Hy\005(\362\006\220\362\246(\362\"\245\274"
+	.ascii	"\244\274(\212\274G)\357\211"
+	.string	"\"\257\211\224\267D\312kT\344-Jy\211\212\274$\210\034n.\247\207\346\304\330c\033t\221\016\212\362%M\222\t\243\207{\241\032B\361\230z\251atQ \006}B\237r\222\314\027\315\004\250^\035\r\235\343\0351/z\351\216\207P\257\036\327<\006\262\234\343\035\027}\277\343\340\002\023\243v/9\275+?=\266?j\030\366v\377\230R\313M1\252\367\354\271\240\235\332\312K\006\241W?\215\217R\243i\321\004\264\222\213_\320Q}\342%\231\3107T-\372c\324*\366\243\"\240\217\006\214\256\330c;\200R\253\006\242\213\367p\311\262\223*\375\202\266\352\222\262n]}\037\216vq\351B\366\260\350S\316\022\316\212\036\240Y\264\221\234\244^\321\007\342,\251\217\246\254\255\007h4Ni\007\311|\252\022+*:\270\004\f\214Z\233\f/\271&\261\307\326\312\317\204\273\\\210\341\t\322z\026A&z\347\352\347\235"
+	.string	"-p?0\331\342T%\221.\025<\204I\fNbA}\002gK\215"
+	.string	"\235\242\2074\367%\315\002h\001\314\250W\037\323,3G\026@\177\f\037R\247\030\303d\324\253\031M\036T\255\025Hw`pjw\251\360Z\335mx\224\316\243\255N\036\347\272\256\353\220G_\253\177\242d\031\223d\002\020GE\324(\372D\003\320<xG\215\"\214zu\274\035\324\026\344\310\216\372x&\372\204\235zu"
+	.ascii	"\231\025\327\251-\2740\3217\363eG\355\256D\337\013\325\017\237"
+	.ascii	"Y\3021j\242.\321\3013I\263\2426\002\243^}\216LN\325\202+\352"
+	.ascii	"\317\225-\211&\352+\355\250\341/\352\025S3\213\275\250ZI$\372"
+	.ascii	"}G\333\276\002\001\273\212\220\214\232\344\210\036\312A\313P"
+	.ascii	"\226-n\033!\\\223\327\226f\311\305\323c\313\323\003\372\255\356"
+	.ascii	"6\254t\013\332\252\355\355\355%\247\247%\330c\026\364\267\372"
+	.ascii	"'\n\233\037\243*X\250\337&\250\201Z\250\337\2274C\342@u6M\265"
+	.ascii	"\233!\013\352\263\341;\256\3414\252s![\225\t\337P\243\t\324A"
+	.ascii	"\260/?\300;$\313\306\f\013\355\234j\260\026\346h\211\223\327"
+	.ascii	"&\t\023\261*\264\221\236\352+\273\220g\214\246f\331OY\325K\375"
+	.ascii	"\342/\325\257\340Q#\235T\326U\325*\364\333\305_\325\007\342\350"
+	.ascii	"Y\227\334\333\336\226:?m\354\367)\355\030-\350\237>\337\205{"
+	.ascii	"ols\222L$\243y\311\275\351\215\301Ib\352\02315J\002E.5\344\211"
+	.ascii	"\b\221\251\033?RQ?t\364<\221\360\203H\bh\024\b\301(\251!A\240"
+	.ascii	"J\220z\212\362\371!%\344\t\202\247\023\202H\001y\022\"\004\n"
+	.ascii	"\310\217\324\220)\250\033 \by\n\202C\310\217!PA\244J\200\n"
+	.string	"Z /\212@}0\002\220\037B>`\032\022\344\007\tL@\210D1\275"
+	.string	"`\241Jx\"\302$\005\005E\204\211\350\206\344h\177\200\177H\032\271)\300\031\351\202\302\271\256P\034\370\313\341h\027\334\256k\273\243\335q\207#\336\2210\272+B\354\35090:z[\207/;\372I+e\202\025\264\2166\nL\236!\273\202\236\240)h#\274\344\235\004=A\027\365%\231I\276f\2029Z\202~\322\f\262\341\216e\204\235C\277\035\307\034\311\034\313\034\313\004s4Q\036\231\275\344\r8\332-K\263M\t\327p\364\317\302\300"
+	.string	"F\320\215\303\024\t\262V\213[\302\351\264\276!\202\276\335\225\262\202h2\331\356\234\370P\372xm\305\211\250\331ha\216i\216>\374I\037J\2339\t\233\312\223\016\006&o@\2069\346\t\3275\t\215;\351\207\371R\226\234\023&[\033\004\375\273\033m\243!\350\245\244\331\003}C\206\263\007\372s|Mm\243\317\246\311\232\372b\300\354\250\221\305\211s\242\304\261\272\333\030)\335G[\211\271\017\023>\372X\375\023enN\222\351@]\003\315@;\320h`\322\254F7"
+	.ascii	"E\275\372\026\262'G\276\006\2325\372[\312\026h\006\216u-\246"
+	.ascii	"^-\035\367\232y\344KZ\240\377\346JU\366\326\230l%\024\350\355"
+	.ascii	"\001)\201V\240\371\215\r\027;\024\360\356\261\357\350\307_&\320"
+	.ascii	"\327S\206\231\001\376!\273\312\210\305|\357\336%\316\016j\212"
+	.ascii	"zl\305p\250\372*\366\002\263?\206H\256\207\313\227\032\300\277"
+	.ascii	"dW\245`c\226EbNI7\202\252\367\024\312\2405\bK\013k\027\300\372"
+	.ascii	"dr\360\322wK\234\243\034\265%\326\240\223\216s\342\240\r! \346"
+	.ascii	"\2006\240\021h\243\270\f\232\212F\037\320W\242*\2411\243\rh4"
+	.ascii	"\356\b\330H+3:F\226\336\025&\333\210\036K\311\324\260(\351\202"
+	.ascii	"\216\364\236@=:\203/4^\277\372e\204d\360P@\307h\031]\004\246"
+	.ascii	"G\037\271S@\237\356X\004\007R\305@\003v\0060\310\210A\357\351"
+	.ascii	"\343\324=\232\324`l\322?\003\324c;l\362S\244\207\224[mGJ\337"
+	.ascii	"\240\255\356\367KQn\315\375\234\320{\03695\006\033\364\003\202"
+	.ascii	"$\250\322\030-\021\302\0209C3\"\222&IsB\013\020\206\202i\\Zi"
+	.ascii	"\007\022@$-\313\243L!d\"\"\222$)dZ\003\240\242#\003\"\344\036"
+	.ascii	"\350i\301\367\"\233\\':"
+	.string	"\200Lf\225\357\305\025\301\365X%`C\315=\021Z\252\020\310\331\006\374 \0302\376\032f\302\017\347^\341\205\003V\343]\352*K\021\002\013\3653{33\201\236I\316\303\276TY\317N+\207\226\023H$#f\204P\031jE!O\323\225v(42:'\342\354\331\341|\346\204<8#\0013vD\0327\306%a}\317_b\236\236\026\207\325\205\202\033B\t\213\253\035{\ba\256\234\016\257\026\205\307\311\277\366r\013\f\307\002\273\b^\004\r\340\007N\023X\211\0074g  !\233tqA$\304\323\032\241\324\3511\t\035G_^\312\250\242@\024\343\020:\206\371Lt\261\232\004N\202N0n\374\302}\236=\305\306X}\316,\2031\t1C[\211\342\212\"'If\355Z\330\\\013\304\"$\317\363\231\023\002H\034\361\331\017KaUH_\376\232l\324\213\325R\365\237\b\212K\005\341\321\231\231\361"
+	.string	"\273\027\033\034\244\037\024\264\221\274\221\342V~\235\017\030\311\017N\004p\231\333\202\355A\332\315\370\207\005\257\331\033\016\035s<2\013+\355\253\225\225\006Uv\311*Gz\317\347\311\004\327\357\\\024\224\344\022\336\327\016\313\225\"Z)\331\024\311\006\276\230\f\2514T\017\300!\360\274\026A\333\273+\247\177B\343\366\254\f\030\352\235r\255\006\204b\250\333\355\364\224\332\270\003\341\260\354\324t\r\346\3306h\304\372\304\327\253\2633\247Q\231\366\005\327\260#\237\332\244\310Z~\217\001~\020W\243\037Olz\275\201i\335\220r3\313\230\266]\312\327\034[\001\224 \343k}t\221`\3341\263\341\033"
+	.string	"N\215H\001\\\271M=ml\265\367\247\203\300\177of<}#m\243j\250*\213\243\270t\361Ho\013\223\023\013l+\00711mU\301\b\244\233\255\370\332\255G\034\013\214]N\266\363\016\345\n"
+	.string	"\327j\f\357\230\250\032\200\246\362\204\002\323\227v1\316/\2366|c5\242j\343 j\035:\030W\223V.\001\022\212\220\305p~\3341\220\235\324\204\202OD<k\263\250\247\314\357_J\223\226p\367\327AY\354\367\030v\215\3302\2678\266\034`\0374\250,.\320\306\023\223^^7\270\2704T\334\307+\025\r\265s\354\221\\\036\351\231\365\036h\003\206l\320\2023\232\221\"\205\265\213\357\320\016B9\f\375\256y\313-v\250\275\356"
+	.string	"\235=;\330Y(*\033+c\035kR\022n\377\003\272/\351(^\325\342\272l\021\275\2565\004:\"^\3264\220t)5\0241\362\364}%\006b\r\006\302t\257"
+	.string	"c\353]\3130]\235a\026\020\231x\227H\271F"
+	.string	"\233\304\226\247\362\0324P\013e\334\244\201\325V\006dB7\275\210\232\347.\277\204\2206,xe(\227.\237\f\340\370\261F\027\024\001\002\b\232F\373\215\236\310J\037\003#B\205\221[S\263.-\242\004\363\227\347\340\330\002\007\373\303\252\177D\20370$\204U\343\363\201W4G\016\341b\026g\211XN\245rTRA\031\323S\216\007]9\b\b\345\204W\n\251\223\206Y\341\272\213f\332.\365\305*\340B2\f\2352\224A\262WOYX\017\310\327\336\222\364s\004\333X\364\300\346\227 \210Q\256\177S^M\026\347\030\217\300\314\371\236\231\356\017\270\336L\214D\221\fQ\n\275\214j\322"
+	.ascii	"\273\353D\360\361\205\363\343\205\371T\316\355\036'\261\304\341"
+	.ascii	"A2\357\325\370,\200vQ\355\t\005\363\2323\314\355\255Dh\342\035"
+	.ascii	"\323t\241PB\277_\210 \037\323t\343\362[sE\nW3\334\267t\2503\245"
+	.ascii	"\362:\323\347\237Ro\352>\300k)C6\223{%?'\303\356e\020\034\002"
+	.text
+	.section	.gnu.lto_writeSlowFrame.140.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\333\003\315\030"
+	.string	"\366+\233I\240\230Q:\216\340S\006A3,\217\270\031\031\333\315\225\276j6x \3068\257&\202$=\340\001\177\227\262m\310\006&\222\2152\f\376\366\245\360Xt=\306\2033\343\214\034\375\330W\275\262\372\032\016\003\344\243\222Ob\367N)|"
+	.string	"\177"
+	.string	"\217"
+	.string	"F\243\023M@\313\023#\373C^\264cF:\3212>)Av7v\322F\262c'\351\203\037:\006u!\347\205I_\026kZ\375t\364\230'}\004\340;\375\351<\220\004\315Z\331\277\250\372\355\250\332]\241s\322<\346\311\357e\345I\232\327\224'}\332T\003L\254R\317\217\t\305\2200\273;\2536~\236\236\376\207\207\361zJ\247/\b\273k\312\353\261\270\353m\037\260\355\300v\345\002orS\300\344Q6\n\343\356B\223\331\251P\302\363\362\342\223\334d7vu\347\371G\216\244\346\3478i\333\215\236w+O\276h\241\007\211fn\354\256\317\213w-y\221\265\2232\322BG\267l\250\035\2555\354\273\266\322\260_\32472\3242\030\265\315\213\032fR\233/\352\227I]\276\250\311\222\332ER\327\222\232\222\324\307\t"
+	.ascii	"&E\357Q\244vUle\355\221\214\342q\340/<\265\357\027y\303\023H"
+	.ascii	"\202\251\263\351\374]\2718\302*\025%\315\n\253\245\326\323\271"
+	.ascii	"l1\353\221/K\323k\247\254\257Z:9\203\237\302I\225X@\262\332f"
+	.ascii	"\360\341\317\314\324\3566\270\026\317\213\253\222\365\021\216"
+	.ascii	"\345\212\253\036\371\2604UZk\335A1\306\022^e\002\225\372(\337"
+	.ascii	"\024,\034\372j\232B\005\003\266\205G\271`\372O\016\005C\006 "
+	.ascii	"\240\372\341\251o\n\f`\ru\223\333Iy"
+	.string	"\342\203\032\336\345\270\024cw\213\0338\320\363\274\340\312\325\321DU\362\211\004E6\021C\264\021\245\215\210\226\353@\272\306s\204\013\362P\243\r\005\315>\b\321\210f\265\\\321\214\247\200q l\271Y\b\034.7\213A\351\356\332J\303\346U\217\243\256\356L\002\230\344\332\235\361\340\302\277JH\267\254s_\314\263~\374\034>q\234L'\323\3609L\250\234\226\234\254r\350M\275\221c\335\004L\2051\236<\316\036\262z\363/7\323\312\246\312j\251u\342\307\216n\371F\013=x\3720wK\370\330\324\033\277\323;\"c\351\t\210\200\236\370O\250aD\345\f\203Ff$*h\2113\006\240\002\221!\254\016\021\220\255SvKbh\317\240%\241\267\225t\370\225\331B\231[\365,\240\200\240|\234\352#\212ba-j\344\325\215\374\033\273\331s\020\353\340v%\003\031]`RHA j\344\243H\032\032\240)}"
+	.ascii	"w0\316tT\026\2047\337\241L\020\215\233b\1772\376|\242&\365\273"
+	.ascii	"\350\250&eD\313\353\234.f\037\233\021\n\354*:\376&\0313Hjh\t"
+	.ascii	"\206\210\377\347\b<\207\262\242\354\312\352\245jH\273\220\277"
+	.ascii	"\322a\217&\352\021w\220Z\343\252\3407\027\n\245\002"
+	.text
+	.section	.gnu.lto_loadSlowState.141.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`H\0015\r"
+	.string	"&\231XB"
+	.string	"s\233\016\263\222'\351\350\317\331HH.\342\366\273\031\257#\262\336\217\274-h\006,t\300\200\374h\t\021\213\330-\351\3026\304\307^\243$l\001@\001\332\212 @\245\240Fi\035\225H\223\275\245L)D"
+	.string	"A"
+	.string	"H"
+	.string	"\276\212\257\320\256br\315.\tf\306\256\227\300\234\352\321\3367\324cu\002\324\2435{G\001\016\273-HQBa\361\261\273\226\226\270\366\324\374\263x"
+	.string	"n\264=\0014\330]'7\002q\353m\037\260\255\300~\216\335=\f\003\002\023\273\242s\217~H?\242t\352\020B\224'\333\333RI\330\207\273\273V\222\035\323\325U~\n\246#L\303L\253\2463\323\327\f\370\341a\364\322\267\373\341\004dM\321\345D\306\366\323\001\252\366\204\307HU\325\026\224 \232\264+t\362\\\252\276|4L'\272\371j_\207\021R\355.\003\377E\366\021"
+	.string	"\323\231p1,w\021\342w\026\001%\210z\274R\020\321\003EJ\245\376JF\342w\251#\345+o\241\301\017%\330H\b\372\342l\300<\240\2533\342\261,\210tH\254+\013Y\034\003\306.|2+\003\206eV\306\333\303U\222\253\357\206I\244'\216j;\270\013ly\020\025\276|6\240\332\020.\243Dqp1\233\264#H\310sP\225\307W#\033"
+	.string	"`\251'\023Z\373\002\303\005\013P\004\300"
+	.ascii	"\203@\210Ze\006\242\302\265E\370\260\204\342\370\032\205b\205"
+	.ascii	"\200\270A\005l\325\360[\215\307U|\226\336\2100V=\030p\t\241Y"
+	.ascii	"M\001wy\321N2"
+	.text
+	.section	.gnu.lto_writeSlowFrameIfNeeded.142.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\342\002\025\025"
+	.string	"\206\345\204I\320\016)\035\200\227\247\306\222\240F\305\367\tsm9.\350\357\252\364\362\020\212\3513\213\237\036CVS\362\301~\243\262p\343\376}\016\375`\327\bkP/#A\242\026B\034k\275\034L\330\254\007\034\"\035\237\020B\210\334)\005q"
+	.string	"i"
+	.string	"n"
+	.string	"\341m\027\337\307\252\357f\036%og\304\034\244\247\035\310C\207\220\017\275\200\201\213g\007^\312&\217\036\250\230\241\247]\336Ju>{\212\034\305\020\3249\363G\021\b\265%\244\033\256|\312\346\244\013\032\233\017\0214\2719\212\03785\271\2070\275\227\tj\3408\\9p6\320cw\357\363)\203\253\3159\212\354\256\347\rWsk\334\366\215\355\007\366t\n%`SS\027\372\020\006\237\307*+\363\267\207\376\212\370\360\272!#\006\224\007\237\034mF\331\274r\252\316>\270\372\301\356"
+	.string	"\247S\337\335\243N\253NO\235\276"
+	.string	"\004F\265$\241\236\031\372\202\2673QP\353\013\211B\034\350\337}\332\267\377\343\367\254\362I\234\347r\240\226/\314\036\347\344\243\201i\227\246\001\357\005\304\207\344\007\210\017?b\361y\024\354\354.\005\361aJ\307\034%$\231\016\017Ug\220\253\306\202\226l\363\347"
+	.string	"\223\274Y\210\017z\021\021\2535\177S=\214\337\b\037\214\226A\357\275\310[\357\344\357\006\334\230\377y\212\027\271K;q\024->\317C\227\274^\342C\333\004e\376\346\233\370m\360\331\264\234\273[\252\352\264t\322\tB\262\315\237\247^G\275\212\230\237Z.\031K6\302\002;\031aq\245"
+	.ascii	"p\311^\261\b\025NV`\026TTn\205d\200\221\230\264X'$\253\224\027"
+	.ascii	"\013e\325\212\251\254B\022\030v\301\025[\311`\260\330J\305\333"
+	.ascii	"\223\377L48\276\305;T\306v\207\336\367;\362\321\264\006\246\b"
+	.ascii	"L[\302\204\"_\215\267[\222\252\363L\03457\003\242lJ\322Ql\001"
+	.ascii	"wq\034\034\350g\352\315(\247tE\311\313\300\316.\215C\311(? \240"
+	.ascii	"\002\031A[\007\240\365>\003\316\260e\030\330\223\354\246\265"
+	.ascii	"\"7\342\366q\024\202\344\242X\2156\270\276%V\016\317\026\263"
+	.ascii	"i\r\\\002\200&\244\3056\224f`M\013\307ytc(\b\243\241m\334\273"
+	.ascii	"\034\210\257\312\305K]\020\013\205&Y\"\231\303@\305\311\333\242"
+	.ascii	"\016\336Z\003qM)\3552x\370\370x\356\341\016\024\304i\300\202"
+	.ascii	"\021\26760e\372c\0057\337\227\032\007z\031\354\030\017\244^\313"
+	.ascii	"-\0305\037\303\0167\362\336\326v="
+	.text
+	.section	.gnu.lto_blackboxValidateConfig.143.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"\225\t"
+	.string	"\246\320@<\020\005+\035"
+	.string	""
+	.string	"\223\033\r\374\204x\256q\004N\023\334"
+	.string	"\355K\371\262\342\003:H\002\355Q+\277\362\373A\013\261\324"
+	.string	"\215"
+	.string	""
+	.string	"\200<Bq\231&\025\243\322\311\2317F\333[\356\224\002."
+	.string	"-"
+	.string	"0"
+	.string	"?=*<\371_\271\300\352\363x\034\370X\327hp#\301y>Udh\325X\004_\n\302\200\207\3355\\}!\267\274m\b\333\r\266u\001(\270\263g)\250/\373q\325e\037\372\262@\005\367}f\267\013\262\013\2606\t\203b\373\036\237l\232\317`\213\020;\371p\311\355\356\324\2221\271\032\370bs\033Q}\351\0238\327\003\232\214\n\352l\227\316\222\321\331U9\370\261\3134|\223Ks\230\340W\227\276\211sy\355h\325nd\001\026}6\274\320\204\bD\021\232\026\022\240\212)\"\225\346G\301\336E\004ibx\036izf\250\307UW\007\200\210\r\245\251\250\257\021\2076Z\200\355n\313SZ\001\021"
+	.ascii	"`\2517\023\032\200\002cx\r\343w\004\321X\t\313@\270I\310\002"
+	.ascii	"\305\343\357\007\001]\303\355C\360\227q\305\245\213\331N\274"
+	.ascii	"0\241"
+	.text
+	.section	.gnu.lto_blackboxStart.145.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\246\001\035\020"
+	.string	"\006\034hG\360\260(\035\366\262f\n\257-\214\301\351]W\206\357\242\272\373\323Qg\376\321\241O^3\277x\237\214\377\360\267\266\267\001\361\223\225\243\307\232\202\330#d\213g\340\246\305\f\037\310\025\342\021\351\034\302b^\355\223\275\367N)U"
+	.string	"L"
+	.string	"X"
+	.string	"\rftRhj\273\373\315\0227\335\323U:\245\311?\335\363iy\0272\342d3Z\210-\257\364\343E\204\315\0239P\0040f)w]\252\210+IA\"\313'%\220C\302\206'\252\350\202\021\207%\200\230\222\322\023\332]K\226\350\341\376\334vh\233\201\375\036\001\217\235\336F\034\333\013%s6,%g\313>\335\371bS\351:\245\017\332P[Q\021O\333\331]\311\361\330Y}a\302\366}\330c'\2271h\334\251\235\330\237\371\013\3452\016\031q(v\327{\265Ql\357Uz6\3314\003\253=\005 \326v\343$q\253\030\233\242j\350>G\262\032"
+	.ascii	"\244=ad\336u\0016;p\314R\363Dg\213\324\261 %\200\331\335\232"
+	.ascii	"\237\030e\324r\310\033\0359.s\266\346\017tu\026\220\321P\311"
+	.ascii	"\233\0373\311i\302\317\256\312\201/\273\212\013~\314\253KL\344"
+	.ascii	"Y&\335k\235\001\006A2\204#\022(\2420\372*\214\210H>\260T\362"
+	.ascii	"\201|8\264 \241\364a\b\303\322\347\301P\017\241f\3123@\332\020"
+	.ascii	"\"\310\263|\327C\251y\372\315%W\323\315\226E:\337\3467\"~\214"
+	.ascii	"E \330\275>\370\240c\013\201\2229\027\264\017\314v\330\021\253"
+	.ascii	"\340\365\257\203V\004( P\2021dy\003`\352\311\003\326p\\ag\002"
+	.ascii	"\001\2777\241-\265r\240\203\252\237y\250]\236\330(3`\002\224"
+	.ascii	"\322m\036\355\002[3u\255$\260I\342\016\241\206\227\212y]\005"
+	.ascii	"Y\252<.#R\274\027\204\233\210QC\027\242hrj\344\241\243\257\367"
+	.ascii	"\206\345\307\317\303\341\020 \335\213o\037\024"
+	.text
+	.section	.gnu.lto_blackboxFinish.146.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`d\001\245\r"
+	.string	"6\330V@\020Q\2351\250z\017\025xx"
+	.string	"\005\366\177\300\361\031\230\375\375\270\013\254c\340;m\272\0322lt\023h\t\353\001\331\316@\021e\0034\002l\242"
+	.string	"\020\201\324\251MPfbr\007\344F\222H\231RA"
+	.string	"B"
+	.string	"F"
+	.string	"\326\366\330\332\3555{\266yR\304%pBu!\365q\357\335j\210{\267W\245\236\377\322\003\204\342w+\371\225\211\033^A &\031\313\021\231h\241\322H\345\336k\032\212\032n\354\266\027\330>`\237F-\373\344Qt>\311\024:\364\341\255\337\301n_\025\264H\243\223\350CO\233\004\321\n\302~=\317\023\207\353\007\233R?\342\255B\031\304\203\260\356\r\235 \267\303\316 a\373\376\351(\317MF\320\301C{\241\217z\005\254\237\357\342\256|4\344c9\256\252\375\0306'5D\002\336a\252\2778\f\233\023\017Q\246\245\316\342-l\276Ub\304\341\335;\354\226\206\366U\3306\001\334\373}\004\326\020\033&\023\327\3035P"
+	.ascii	"\244\001\306P*p\027\007\030\313\203\313\006!c\321l\230\rg\243"
+	.ascii	"L\314E`\260\331&p\334f\323\310\317\257[\3721\234\254\216O\005"
+	.ascii	"\371+.;\200\332\r25\305_z\202\0342>n\320r,IWF}\r\366\363\034"
+	.ascii	"\346\243$p\350\003% P\202Qf\025\017`\324\023\207\202K\304[\002"
+	.ascii	"0\\\370\361\215\211\205x]e\354\366Y\204\n/\357\271\313\353\275"
+	.ascii	"\214\026\357\027Rq\350v\005vc4r\032Xx\345\266\331,t\253@\031"
+	.ascii	"ZX(\340\263\003\261\335\"\257\367\316\244\213\2663d\034^mf]\026"
+	.ascii	"\310"
+	.text
+	.section	.gnu.lto_startInTestMode.148.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`g\0015\017"
+	.string	"\306\\gE\360\260(\035\2733z`\350\3153YP\275\203\326\305\232\025\376\fV\337\360\210\227rP\2201\267\236Z\333'\023~-c\254\343\236\223o\374\006g\210|H\275-f\274b\251\275e)B\232\2542\023\2757\221;\245W"
+	.string	"N"
+	.string	"R"
+	.ascii	"!\252\365\032\300pXX\334\354\356\246%n\372\224\231F\223\037\340"
+	.ascii	"\363>\265\017\227\231\001\226\234\023\037\237*Kp\343\311t\276"
+	.ascii	"\225\230e\013\\fx8\250\312@j\220\250\351|\251\250\235o%C\260"
+	.ascii	"\273w=\266|\250\030=>\273\353\270\372:\334\036\267Mb"
+	.string	";\202}\023\0016.1 N1\264AT\324\226\375l\365\305>\354\3264Zc\364\001|D\bV\313\367\220\306.+\324\2613R\006\305a\267\257\302\007\037\363\227\3510\025\001kc\377\325\300rlvA\006\227\366h\227\006\0172/\265\023\230\227\357\330d\343\b+M\017\276\200M\270cF\245\236e\250X)2mYO\232\252]\354F*\342\374\005I\333M9\360[\334\005\347\303\\\032C\2514/U7\210\310\311\361\212\273\353\251\266\2342\257\241\030M*\342\330_\361X\212\017\343\f(\361\253K\037E\357\272\202/\f'\0357\301\244$A\244\344\001\004\221Q\007\262P\n\261\310\243\201\013\221\210@\027B[\311\b\210\264\211\272\322\3469`\316d\324m'\034\327m\035\360t}\361\347\244\2509 \332\024@\361+\337\365\017J\275\303xq\360\244\312\324Tza\030\243\371\210\377h~\357\030\323\2560\022\037\033"
+	.ascii	"5\263\007K=\231\001\353\034\242\365\022\336\3666C[ \212\304\n"
+	.ascii	"A\210xP8\016\267\357om\033\"{$\310\271`\3430L\b\256\211(\231"
+	.ascii	"\320\272\260\227U\226\227&\200\273W\205\320-a\\P\341\267\253"
+	.ascii	"\224\001"
+	.text
+	.section	.gnu.lto_inMotorTestMode.150.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`y\001\215\017"
+	.string	"\326\\hG\340\320(\035\320)\267\027a\016\202]\352\202\224\227\030\r\257h\273``"
+	.string	"\315\\e\246\354\241\214\330j\007s1\300o\367>\300\270g\303\"\244\331\2101\306\030C(\0062\035\213\030\345\361\nx\265\356\026\373{o)S\nZ"
+	.string	"K"
+	.string	"U"
+	.string	"6\210\023(h\261\212\300\313\352\006\202Z\211\326\216\2169e\334z\270\3522\302U\225\277\272\\\301\2011\213\013p\\\324\310\240\2714\034\302\221[-GH\214\b\017\304\345\242\013C~jj\214\\/p\004\266\"\303s\2560\256NUT2\347\264z.\f\267\350\266Ql\037\260\357\023:\217I\360CX\205E\357=\372,\362\361\373\234\213\004\355\334`:/\226~\266l\245{c\177\277\357\373\2746\266\325\244U\217\254\026A\265\204\352\b\325\020\252\327j]\365\005\210\\\260\2318\016\2379c\276\241i\213*F\250\336n\t<\f(\230L\362QYxA\006,\374$w\341\256P\005X\247\237\003\250\355\340D\357\355*P\207\036\266nW\266\215\023-b@\225\324U\0203\032"
+	.string	"\324NA\351=\335o\240\351vu\255\t\375\320\354\336\370%9\372x1\003rQ\036\376K\362;Zk\353\325=>\221L@\231\240\234L\017L8\b'\246\024\356\224R\341H\n\030\025\241A\212[A\241R\234l~m\374\031\265\024\255\236H\032\252\305xz\340\257\222\242\205\261-Z\227\260\266\203s\316)\345\306%\355[$hrK\037^\254\270\003h32;n+\023\3430\023\341\372(\036\037"
+	.string	"\263\312\371\256\213\253Nz\260\256A+N\310\315!"
+	.ascii	"\202;\004W\262`\306\202\005\260\2220\315aa\2259\257\314\354\003"
+	.ascii	"\253P\245\334U\013\\\230\\\231\316\257Z\026\245VY\\\030!\306"
+	.ascii	"H\360\366\252\240\0034\222)\227VW\263\254\271\007"
+	.text
+	.section	.gnu.lto_writeGPSHomeFrame.151.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\375\002\345\024"
+	.string	"\246\243\200J\240VN:\304\337\007\255\036\264}6\301p\310\344\034\303\347\335R\365\301\247\364:Mz\302-5\300\300\205\235\331Z\251?<\275bR\275P\372<\036\320\273\2606\216\002\257\006\341h={\017T\202\013\032c\345\261\206\220\275wJ\001c"
+	.string	"a"
+	.string	"s"
+	.ascii	"-]Bt\354\3438\317\036\275\363\235SrY\343C{\307\036\037\316\353"
+	.ascii	"<\3727\236d\273\022\317\312R\355\207\200PR\300\335\025\016\036"
+	.ascii	"\372\345\365\360{\026\361\341\312\005\210\017m\263\265\f\370"
+	.ascii	"lO\004\250\247\237\036\223\335\225Q\031\267}\332\374\353\216"
+	.ascii	"R\006\365|\002\240\260\273\236e\220\320Mo{\201m\b6m\021\\\347"
+	.ascii	"\335\211d\311\355\336^\372"
+	.string	"M\337\221\343#=4\215\234/I\361\341y\036q\235\211Xnwa\316{\3751\324\004g\345\304\3426\203\366\0167i\f\373uw\327\364\310\256\3231q\032\026N\217u\272\326iZ\247g\235~\200\0016\220\204\256\202i\027(\330d\177\241o\306\225~\373\276\216\367t\276s\324\345\347\311\355D\310\327o\2440*:IA\003\327\323\360\332E\0013\322\367\356\022\304\303\205Q\222\322t\371\324\020\332\262ED`\236\276\274\201\203\002\333\017\036D\346\265\273\022| \217\232\351@CC\257\373\314iI\371T\246\233\356(\361\273\353fs\t\313\250hwy7\037\346K\267\024Y\362\363\241=~\216?\221\fz\334\007m\022\335Y8)8\240\24727\264\232\232\207\320\263\227\023\244M\316\254\006\204\215,\004N\rM6\253\221\220\275$0)\342\246&+A\2225\331\270\273\275.=2\n\214\251\337\215\342\314Sw_L"
+	.ascii	"\362f\320\225v%\341\002nU\372\242\234\222\032>J\263d\020\344"
+	.ascii	"\\\341X3*WG\216\304\302\205\230\030\361!\255*\271n3xeE\033P1"
+	.ascii	"!\031%\371\016\314\030\375\322\253\310\002WFz\0302\300h,B\250"
+	.ascii	"qH\344\234\221\232\tF\202(li3\006\240\002\221\251\234\007\021"
+	.ascii	"\260\245Dc%\251a\177\003\240\241C\267C}\025\312\345\342\362\311"
+	.ascii	"Q\360a:<\3101\2227\026:@\361\347\200*b\356a\004\310h$\255h,>"
+	.ascii	"\324dC\335\307U$\300\326Zs\2641\264IR\341\321\305P6\273J\016"
+	.ascii	"\210\222Qw\222\314\222\321\274\315\216\347\373\214\033!\205\335"
+	.ascii	"\314cg&\203E6 \206\240%\022\377q\004\362\213X\374\212\275\202"
+	.ascii	"\362\b\231(\316\257\002\324\2363\005O\277\370\350\037"
+	.text
+	.section	.gnu.lto_writeGPSFrame.152.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\220\007\265%"
+	.string	"\272@,\016Cp\336M:\245aW\234\0064\033Y"
+	.string	"\376K\263\003\035\032\305\340\326\2266\3562\340t\243\301O\367\332B\374\376\200\274\234\245\310z\bg!TK\342Fb\260B\206\336hl\034\202\036mSkD\332\226)\005\277"
+	.string	"\300"
+	.string	"\327"
+	.ascii	"\272\335z\356\326K\256\377S\272\263\303\307\263\322j\315\232"
+	.ascii	"\223\253n\243\231\260\177\371\355\373c^|\36137 \202\031\364\""
+	.ascii	"\314\325`\374\314O\206\324\300\260\017\346h\266\3172~\346\036"
+	.ascii	"\261\214\357\243-\303\366}\2347\263\317.\273\027\372/3\220*\234"
+	.ascii	"\372-\270\2668\270Z{(\370h\t\274\217\257H_\373]>FOV\303e\255"
+	.ascii	"L\212l\265\226\375\f\305\373\310\364%\362\243\356I\344GS[\317"
+	.ascii	"\200\033\325\206\203\266=X`\006\325Z\201\363\311\351us\251\177"
+	.ascii	"\263\227C-\033\327\001\371\324%\200k\013d\244u\245[\312\2222"
+	.ascii	"\274\331W\207\226pwG\241\326\352\035j\371\270\307\333\306`\273"
+	.ascii	"\202\275\223\013[\302\263y\033\016>\230;x\360@~40_<\002/gr\270"
+	.ascii	"\306\266\226\326i7\032\362g7\013\261ix\270\216\324Z\325D\214"
+	.ascii	"\330\017\375\024G\220\333\215i\303\027\3634A\2473G\023\265D\356"
+	.ascii	"<$z\302\2542\303>W{[p\351\253V\253\017\3752g+\341\203}tTp?\f"
+	.ascii	"\222\037\257f\251\233\241(\372\252\265>\270\332ul[rB:b\204X\355"
+	.ascii	"\234]&\334\351e_Wg\227]\256\237\210\326N\276u\323n}`\2676p\262"
+	.ascii	"\177@\271^*\327J\274u\322n\035\240\267\006\260[#\365\326G\273"
+	.ascii	"\265Q\271.*\327D\345\332W\256{\345\272,\327\274r\275+\327\344"
+	.ascii	"n=\362\326\001a\016\366\006\265\002\265WD\363l\304\2658_o\226"
+	.ascii	"\323\367\333:w\250g\344r\205\b\225kb\f\226G\223\320%\273IN\336"
+	.ascii	"\374y\301\003\321\260\027!\330\264\311\001Q\257\to~\376\207>"
+	.ascii	"!R(P\310\217\273\371\"\321L\224\363\241a\300/S*\207\243V~\343"
+	.ascii	"\036r\276\013\261\030G\306\264\243n\216\363\207u\310j\347\256"
+	.ascii	"\374\016\315R\347v\250\230)\027:\266\037\322\261y-\304\242\030"
+	.ascii	"\231\216i\347\344\271\202\005\246\235\003\346\234_\3031Ex\341"
+	.ascii	"s8\360|940\360\300\252\310\217;"
+	.string	"O\206Hf\265s\277\303\251\342\325Z!\370n\177\223A\303\206\r\223\254BD\2133\363/Bplsz\231\003y`n\001\201\363\306O\034;WK\310L\265\376\21140\017\314c\005R+\242\250N\214U \244V\240\370\340\202\205\024\025\325\213`\221\203P1\246L\244\bF\2510\001d\201\"j\0050HU\005\204*\340\251\026RT@\027SST@_\231\325uuv\271t\262\306\315j\n=CW+\223\tp_&\225)aF6\n\030\224\2458\245\271D\032F\340\rk\277\250\327\321\223<\303>VQ\326\213\206-x\353\242V\232\232(\315W!\242\021K\2326\315\261Kh\226\243\267\373Y%\323\315\260\317\225\345\242Y\220$\315\233\035A\225\265.\2561\262\b\3734\237\266F\202\002\336\266\b\032\345A\263\234\346\323\016\t\362VH\323t\302\"D\243Z\274Z\257\0364\315\243\375\247UT\3025\026"
+	.string	"\300\f\360c\265z"
+	.string	"@:\232HAv\007\035\262:\216\310\210\031\025M\243\036\321,\232\244!\034[\204D\026\007\r\200\215\250Q8\006\025CjDFD\222\024$i\f\240\002\021\241*v\021@\245r\f\311\310PP\251]8\240\221\246\255%\335\3417\317_ql\3422\215t[T5\fG\205I\003\223\275\022\370+\255\377\020\240\342S\361\336\200\251#\001@\201\237C\236a\222\375G\300\267#a8(\006\254i\363]\022K\260#\006\215\210G\b\"\201"
+	.ascii	"\347\212|\300G\306*~\326\251\216%{0\312\317\364X\330l\215zF;"
+	.ascii	"{\354\3269\177\027\377\344\342\267\374\374\262\257_\305:\302"
+	.ascii	"\343\245U \217\253\260\f\242\240\231\264b\001\001/\031\235?F"
+	.ascii	"_\027\251Y\314\236\n\250\331\260\n\025\341\354o\226]iw\357\201"
+	.ascii	"\233\324\302\207\304\227\316\273\201l~fY\351FW\314.l\267\001"
+	.ascii	"\257\331R\206\210\356\372\313(^\210\345+\257\317\034\033\336"
+	.ascii	"E`\301<mo\325w#\325w\335tt\373n\344\302\236\202\212\3407~\376"
+	.ascii	"\022#\300t\001h\250\375y\224\306U\270i.\tj\2125\242MBh\244\016"
+	.ascii	".\3640\013p\242\277\034\351$,\247\220B\r"
+	.text
+	.section	.gnu.lto_loadMainState.153.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\020\017\375@"
+	.string	"\252m\350\027<@\350J\007|q\277\312\025\225\022s\362\217\353\001D\211X\347\260\234K\221\303"
+	.ascii	"\342jz#/\322M\007\337\031\354\346\345\325#\347\277`u\371\017"
+	.ascii	"\214\230\243\376\342\320\221\220\275\245L)\245e\001V\001n\001"
+	.ascii	"l\255s\255\316o\235\275:7\214\376\"\305I\223\263F\353KS'\205"
+	.ascii	"\224R?\253\247\354e7^\367\234n\273\356\272\356\271\3567\2152"
+	.ascii	"w\036S\t\235Iw\203rj\032\347\303^\340\230\206\303\035\207\231"
+	.ascii	"\352\230\031i\317\316\305\260\255m6M\307Lm\332\315\3557D\242"
+	.ascii	"\322\277\264\315\002"
+	.string	"\367\342\022\245\351\\\210\271aO\235sE:=K[\t\245\275\302Di\232\026\333r\206a[fngn5\035w[\316\b\023\323t\313]^\232\316m\261\204a\333\253\246:\333\326\236:\333^\346C\003\220\244`]{h\222\320EJ\323\224\353\331\230\335\237j\255L\377?\264\326\236\374]\347\232\353y\033\352\311\251\211i\2118D\243N+U\337/7]/H\002\2025T\245\372+\303R\263\362\256\370\223Z;\345ue*q\333r\246\326M\265I\320\233\225\376+K\253\024\252\334\tj:\255\200L\231\025gR\340\345\f\255\227P\016t\272\356Mr\333r\206\326\304*u\302]\022\037\242\034\274\234Qi\264\303\250tT]b\342-\373\257\254\255VH\222qk9H\374\\r\223\322v(\245\245j\324_\031\262N\360%fb^\335\240\364w\234\316B\006r3H\216\031\224v\224C\232\246\354G\263\263f"
+	.ascii	"\315\334"
+	.string	"X\230\371\005\363\223S7MG\272q\025\332\0365\244\273\246\203\007\357\243\207\263-\361[\r9\bNo\330\bD3B\177\030\242\025%B\2046\317A\021m\310\376I\242\005\t\005ZApUP\211\006\374\257'\032\320\337\237\377\276\203\004l\312\371\367\245\300\342\025\355\247\305\260\355\201>.\352\367\257\204c~\\4\037^V\b\004\323{`t\265\361\265\236\0302fx\037g\234m\373;N\333;H@8\2710/|O\307\340\020z\256\360\3144\032\217\215a\232\246\026\270\357\\)7\252\332\300\0209\333\nA\3665\323\302\274P\253\355\020\321\020\230\246\351\005n\275\336\303\301\r\246-\347\320\341}l\313\255\343l\333\365\350\026\274Fjqza^\310<\007\346\277\306\004c(\022\177\027\346\027(L\220\020\321s\315\030Z\256\273B\277i\356\352e\363V\3435k\365\234\346b\3335gu]s\004\2423\204\352\374"
+	.string	"uv\200:c\241\316\rPg\006D\347\005\326Y\201u\276\":[\241\316\t\2523\202\241\363\001\324\331"
+	.string	"\352\\\340t&P\235\007Tg\001\250s\325\351LU\235\003\240\316S\2473\200\352,\205:GUg(\324\371\351tv\252\316M\2503\323\351\274T\235\211\326yX\235Q\353|V\017\265\217\027g\273\3125\367r\311\214\204\306Bc\341\331\326\3007\235\266e\220\225\340\354,\025\220\340\\\256\322j\313%\253\"\360\005\2762\007\020\370\253eK\342"
+	.ascii	"G\3224\214\201\200\037@f\203\237\314W\354\"\361>\n\370\246k*"
+	.ascii	">6F~s`\304_cT\017j\342_0\252\330\305\342\260\370&\020U\265y\332"
+	.ascii	"Ub\265%q\264KF\365U_\035\005\240\302\340E&\327\211\3671\300\367"
+	.ascii	"]S\261a\353\343w\344\301\320(\213\342_P\252\330Y\277\204\231"
+	.ascii	"gVM\3234=\263\036\305C\255\251\325M\275\224\253\304\n4\363(\367"
+	.ascii	"\t\200\237\372J(\005 \351g\274\034z\231\233\335(Sn\225*g[\251"
+	.ascii	"o9m\311 \0335\377\223{O\310\354\257qK}\027F\365\374\213\177A"
+	.ascii	"/v\204_\262\325\021\276\345\334\b\036qI\315|{\373S\177-\302\277"
+	.ascii	"x\250\265\264\345\230\232\230\027rT\0234gr\337\240>\352+\340"
+	.ascii	"\022^v]\361\343\215\323\nt%Nv\261h\271\\\270\234m\241\276\363"
+	.ascii	"\220\203\315'\037\273\312\006mk\216\304\351\237\276\00269y\030"
+	.ascii	"/\037\264\2619\330\215\353*\364\364\"\357\227\033\306\373x\303"
+	.ascii	"\234m\233\276\323\220\206\340\364\230\236\360*\033\2705\245\373"
+	.ascii	"\266\364L_\007\223T\302r\3423\3373\027\356\354\343\322_\035y"
+	.ascii	"0n\362\362A9\032H\217\033__A<@\001\351\021\304\313\303\227\027"
+	.ascii	"\020/\036K?Z\334\340\221\203\005\220\0367\276\276\202\330pb\033"
+	.ascii	"\022\206x\325\320a\203\306\216\032\\=r\320\340\301e\343\353\007"
+	.ascii	"\227\004+\366\362q\343\213\013\210\227\327\027\027\323\\\332"
+	.ascii	"\337\205G\360\215i&\n{1\206\220\306\373\214\200\252\036<\204"
+	.ascii	"\257tc~h\2541\262\361>>\370Z'\251\310\301\363\331\303\227\307"
+	.ascii	"\001\0368\275\277\303\364:\276\247\347m\261\232\r~Ig\313\357"
+	.ascii	"\3464\270\003\307\340\355\256\022\201\033\217c\244\033\022\036"
+	.ascii	"\0279\234\253|\343tF\272:\243\235\335\331\226\301wZ\222\331\324"
+	.ascii	"[0\307\333|\037\274\005\377\204\222u\024,}\315;:.2\326\361\270"
+	.ascii	"\024\236\306\325\030\367\230F<x\316\266\n\276\251$\357\340\344"
+	.ascii	"\256\370\034.\305\240\212>\306>\357\343\325\327f\022\315O\354"
+	.ascii	"\301\330\352\231\215\177\334\214\021\220\205*\274\343\242\022"
+	.ascii	"\203\214\204\274\217V\001\370\222U\374\304\240~\215\211\202N"
+	.ascii	"\"\376\005\233\212\275\205\341\267\370\244d\202a\236\266^\304"
+	.ascii	"O\321\265\325%\370\267\253\2642\026"
+	.string	"r2\306A\004\237\340k\2371?]|\f/\305\270\322\210H\221\221\021\243\263-\202\357\274\266e\222o\232\235\344CX\306\351\300c\370&LR\t\2043\033!\031\233\336\307\003S\177\330\n\375\304\232\226H\374\013\022\213\255\365K\264\374\262\3341i=\211\207Z\303\3227\246f\340\223Wi\025h\234\344\310K\026\201'\250Q4%\021sfDdD$I\222B\007\361\005\204\030\346`\325\003\022`4U\215*\245\210\221\210(h\312i\232\003!&\244`\205\006\260\034\023\232Q\027\2414@Rc\322\260\226\027i\033\277\342.8\001wn\200\364 A\215r\325d\261s,T\360j\253FU\233q\177\2339\314/\242\230\257\354\252\331&\016\321|\355\342\260}S{\245)\231\337\016\362\213\017\317CL\371\023\032\226E\031`\022\"?\333\001T\024\230t\225\353\232^\016\355l2\360\016c\230_\210\357\257w\303\2371"
+	.string	"\226#`2\371\361\225foA\340\1770\377\001\024`\364\267\340\260\204\335x\t\221\003E\353\"\246wSF\222\367Q\003C\326\304$@\177\352P\316\343\206\265\314\2670\025~\013X\036_\274\300<r\026XDI"
+	.ascii	"%pFL\213\276g\372\267\224`\023\3360\f-\355\361\001\256C\t\370"
+	.ascii	"M],\250\324\376( i\273\214\327\277\346+\377\244[\242\223\271"
+	.ascii	"\013\304\347\346k\210wX:\265\307\f\303\324f \001\037a\323\376"
+	.ascii	"l\372Je\r\304'e\217SH\231\255v\202\310\260\340CQ\216\203\220"
+	.ascii	"#\374\215v\277\034\001>\256\032\312\3424\315\013\355\217\315"
+	.ascii	"Z7\212\207\375\250[m\376\3277dC?_\204\221aA\272H\f\f2R3\017\355"
+	.ascii	"6\224n\303o\233V\337\004\361^&b\223\017K\302W\357\327{\373\240"
+	.ascii	"<(\t\253\274i\013\273\203\374\260$\374\324\360\247\267a7\315"
+	.ascii	"}\261P\002LC:\216\346\t\264_\036*n\241qfp\222[x@o\r\270=\362"
+	.ascii	"`\222\335\307\304\304\273\2347Z}\271\032\261B\207`\260\037\005"
+	.ascii	"\330\005\250("
+	.string	"x\206\346\330=\314\r\021,j\032\f`\360\2615T\003\320K\313A>\225\363*\0341U\203_R>\243^\346z/\365\265\312\365.\035E\264a9"
+	.ascii	"\376C(\342\021\365\367\037\272!\025\232\017-\260\021\0130a0\242"
+	.ascii	"\331\337\t'v\035\035\t\037V\241\2019\204~/\017H\005"
+	.text
+	.section	.gnu.lto_sendFieldDefinition.154.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\324\020EU"
+	.string	"\332\221H N0\222\322\031\016\313\233\004\247K\323\np\030w@\301\201\367\351<\331\305\274\3649\030+GB1\020A\241N\306b`\354\221\377\307\272\376\252\357\350\n\377]}\215\020"
+	.string	"P\232\340\223\356\216V5\001\034\013\021*U\315\272!`$\264\311\2262\311\364\001\272\001\366\001+\221\277!V1@\274\265\353\375;\374W\376,\037\362\361\376-\017\356\036\214\336\217a\363\215o\315\023\236\313>o\207;\\\271e\261\"\354r/\273\303\305:\227\r\312\201yR\366\266\256\353\020kwx`\357\006\331c\271\226\347\360\347\016\267pp\\\367\326\217Ey\312aC\207\207\002\371\025\267\212\355PY\023\363\306\347\226E+\312k\310\002O\277'hW\264\320\225,n\035\013\nY\343{Kq\340\236\354\356\312\207"
+	.ascii	"\255t\260B\220\323\275.\310\253\354su\326\325\354L\226\360@$"
+	.ascii	"\372\237t\312\376\320c\275\230\f\3178l*@y\367q\267!\310\345\366"
+	.ascii	"\007\242\343\3725\327$\313\272\306\251X\006\342\036\224\036("
+	.ascii	"\374O\352\214\003\243\371o\"l\257k\031\016Y\326uU\261O\302\003"
+	.ascii	"Y\b\020dU\"!\\mV<\371\226T\370\3265\016\252\231\254\021\253W"
+	.ascii	"JB:\022aTD4$\024\004\364\343\323s4\026\211<\303\035\035a0\005"
+	.ascii	"\242\315\352\236\353J\301\250\2353\035\234\2641\033\223\362$"
+	.ascii	"\347\221\234p|\204\266\020\302\307\302\367\230N\224\247o\311"
+	.ascii	"\303\331\230o,\342{\314\032\236H\330\350\2051\267\027\005\243"
+	.ascii	"\210\332>\264\307l;\033s\215\205\2428\341 \240&\377A\233\330"
+	.ascii	"h\t\342{L54\210\210\023\260\2631"
+	.string	"\323\330\007\205\001\027\005\355{L\030\320\226\253\353\322\203\366#\332\031\033\301|i\217\331\206\"\213\250S\017P\216|\217Y\206\376\030\271\353\341\317$Ld\267\363\260\360\341\322N0\312ll\205\353\3541\217\030a\341\273\244<H6\024[r\212*-I\022\247(\246D\221yb\226\317\373\022\033S\n\003\321\246\262/E\276\307d\001\r\032\343\202\032!\214\026y\027\305\274P\344\272\256\177\236\303\304\276\230\203Q\353\272.\203\211\215}\221\337\345\247\335\177\267h$\277J\205-\325\374T\226\005[\330A\275\245\337\bN{W\205S\245\360\301\202}9J\276\232\313\203\257\241!\\\327/\002\366>\\\215\024\252\200\215\364`6\322\003\323\036@N\357\254\f\016O\347\214\032[\332\315\r\240\321\316\232\013s\343h\256\204g\320~\336\321/iX\332\234]\374\007\004f\246\004\330\315\335iC\327\350Q\244BV\3328\341\364(\322"
+	.string	":\354\351\335=\346\320\3542p\036\366)\264\333\300\311\340\b:[\327\365\305\230\3579\260W;ps\354\340\203\355H\017\354\216 \355J\034g\027\332M\24493$\364EHitw}a2\227\346\213\373\226;jF\313hn\021e\326\376\224\357\030\3752K\277.\376[\030}@\277\377<\260\017\206?/3t3x\361\337n\234\027ws\367\007,\257\210m/\331%\362N\021y1 \362^\300\243yw|\313W\307\362\346x\225\277\201\346\275\321\2746\232\267\306\337~\005\276\303W\352\316\237\306\257|\243n\345\237\361\273_\306\263|c\\\356\207\361)\377\001\315\353by[\\\357\313\342x\337"
+	.string	"\210\274+\210\274PD\336\247\346U\321\274NG\336\024\315\333\324\274"
+	.ascii	"4/\212\346=\321\303k\202\310\313\324\274%\200xI\024yG\020y\227"
+	.ascii	"\226\027\331\274J\315\233t\344E\372\341=\372\34152\362\026\025"
+	.ascii	"y\211\210\274C>\274B=\274A@^ #\357\217\221\327\307\310\333\323"
+	.ascii	"\274\307\34656o\261y\211E^\036\"\357\360\310\273\323\274:D^\241"
+	.ascii	"\2217X\344M\233\027H\344E\233\267yx\231\207\367=\234\272\314"
+	.ascii	"\221\231\362\354k3q\001uD\306\330\001\275`\247\3573\335UQPU\340"
+	.ascii	"\203-\333\255\301\331=\022\270\264\360\323\315\345\022\2164C"
+	.ascii	"\366\003iC\304!SR\302\242\223Z\251,\251u\314\302\274\225\301"
+	.ascii	"\221\241\031\241!\215\217\234\036\214\375\037\251\022\230\034"
+	.ascii	"\347\221G\263\350\2606G\352\233\261@j\266[{\212\371j\256\236"
+	.ascii	"\243\346\001\274\004\251Q\037\365\213\332\250\033\016QQ\377\004"
+	.ascii	"\325\b\223\275XVa\004.\352\n\034\244\007\022\365gH[\023\347H"
+	.ascii	"\222\204Ar\344\261\017\365\315\346\3200\nE\206\372`\216\276I"
+	.ascii	"[\323\346t\223\342\254\301x\225Nu\033\nn\270\334\220I\203A_\320"
+	.ascii	"S\375%\0313Y\354\n\211\232$Iz \006m\002\215lG_\320_\372\t\265"
+	.ascii	"\323w\364\275\034\310Fv7g\206n\210\240\026\352f\023x\250-\b\325"
+	.ascii	"\202\372aG~zF\003u\260LT\367\364O\027\301Q\262y1\236\227!H\212"
+	.ascii	"\357 \235\321-\007\006\312\034\032\237\206\321:\372k\2242\304"
+	.ascii	"\350\236\366\351\2432J\266\246\356\261\201\227V\306\313L\235"
+	.ascii	"_\223\361A\256\nQ\205\333\224!<\335\\\336\251\321%\254\ba\202"
+	.ascii	"\216\215v\321a\3512\030\207\251V\252\013.\244\007\362H\323\343"
+	.ascii	"{s\354!\274d\245\323\215}\354\236\303_\354\305]\306\216 M\257"
+	.ascii	"\315Y\354\375\034^\017\006\304\215&v\261\257|\3629\367\373\261"
+	.ascii	"W[\265\2512a\225Iz \261\225\320\310R0O\273\350\177\271\0345M"
+	.ascii	"\270\256\312\203\251M\204\312\2379\241\256\2511\360\301n4R\331"
+	.ascii	"\\\350P\201\256\301;4\332F\377]v\027\246\323\277J\207\315/\314"
+	.ascii	"\201\371\342>\037\027\"\b\236n3hx]\374\367\306\315\260\203t\351"
+	.ascii	"\211)\203s\246pd)\b\273y -G\324\004\273\251BIw:k.\r\023\353\320"
+	.ascii	"\240\266\361\301v\032)\325:\035l\272\231\031\006[\305\324kA\025"
+	.ascii	"\023\005\3005@\213\tI\305\204D.`Lb\351\320Jn\201\320\203\007"
+	.ascii	"Hrk\313*\013\202$\002X:\264\262\246|P\0353HVuV\262j*\351cXuL"
+	.ascii	"VYem\3458J\031w\266\200t\200%\265S\243\n\b\026UR+H\013\b\226"
+	.ascii	"\325\226\025\020\253\f\222\tTi\220\264"
+	.string	"\312\3408\265\245A\262\252\2305\345C*y5\225U\203\270TO\037`\365\370A5\245A\017( VSWPTYZPOJ\213\265A2\013j\013\013+\013j\030\327\365^\262K,I9\032\202&uuAf\362\347]G\255K\222:,@.\341-Z\364Fu\265\327\tJ\335\\\3219\032}.\243|\311[\321\023\250uI\352\246\016\354\245\313\231jO\2767P\375\274\n:\333\362_\245O\r\325\rG\313\2250\313S\353P{\2669_\360\316\355\330rPq\247\376G\352\324*\372\3122;\247\016AmK\033\031\0331K\244nn\212\346\27694NO\321.n8\201M\0346_\315u\240\016T\374\216\272\271\177\353b\267\304b\324\324\300\016\0036Q\nL\306\270!\203\346\213\373\216\212\300E\021\321\315m\240\233\232\235\314}\371\342>\272}\016\235\241\202C\350\314\224\246\036B\343\374\321u]W#"
+	.string	"\344\366)\303\006\0341\342P4"
+	.string	"M4\207\235\373\224\301p8b\274\241\200\222\003\263\244\361\250\324\300Wt\302m\2049%F\370\023*\357g\242O4\343 \003\323\240\266"
+	.ascii	"u\266*\027\317\240z\035\350t\306DC\241\341\031\377\376\376\376"
+	.ascii	"~\225.5SS5\355\260(\313\274\210Rp\211~\030\206\242\n1q\266\024"
+	.ascii	"*\317"
+	.string	"\267H!\315\265$\272D\017\233U~\330*Z\320\324\fuS\275\032\226\222\350\263\221\300kj\030\211\336@\215\256\315Y"
+	.ascii	"\217 \242\212\345P\033\321\177\2426\245\310]\036\034\241%\030"
+	.ascii	"\320\226:h\306\203\22228g\220\232\276\340A\232_\2247]\374\367"
+	.ascii	"\201I\250\221(\305\224R\n\221\214\210$I\222\346A\005\304(&)4"
+	.ascii	"\017\021@\265SN\315HL\205\306\213\236$01\f\021\34286qd\223\347"
+	.ascii	"\243OA\020\250<\207\2643\225V\272\233\007\236\007\217\302'L\377"
+	.ascii	"\354R^\375\177\346T\355\177\323c\030\236\177,G\340\244\311:\205"
+	.ascii	"\005\206\031\334\276\223\226\321\270\230\244\226Qr\366w& \243"
+	.ascii	"\250\334\312%\252Q\321-9b\311\003?I\214X]\362G\374\345B\241\227"
+	.ascii	"w\341\235s1\033\317\304\361\365&\242&3\t\b\230{\361FMh\256\f"
+	.ascii	"\177-U4\001\234\374\236\235 \026\365\227\313\001K\337=X\n\343"
+	.ascii	".4\302Y\352\260\266\351p\301\240\004[ &\341\346Ur~\rq\257\341"
+	.ascii	"\222\314\362\243\206e\233Q\250\210pQH{\233x\232\205\237X\007"
+	.ascii	"\007|\265\353\326\372!L{\204e\036\302S\367t^\306\236\033\303"
+	.ascii	"\365\2665\345\336\307\251\306u\006K\340\301\304\313=\021\221"
+	.ascii	"\244\3123Yk\302\374M\345\376\002\272:U\312-\360"
+	.string	"\004v\276\003\250\224g\373~Z\253_\016#\310\375$\033\240?NFN!\315W\204c7\232\262\200u\312\303\031}`x\331n\231v\0026\375\027R\0251\177\240\345\320\f0\277Y3\277\237E\201\230\317`\367\363\013\264\034@\260emLc\276#\007Pt`\335\361v\246v\320\273\237\025\334;!\323\354fW\3151l\332\271\353\005\353n\3465\263\350\220\367\\?\350\313\301\313O\214\362p\306\222\230\313\371\007\240N.\005A\373\023\242_\301\251\334\027<S3\225@\262\322EUq)8*O\257\331<D\300\323\020\221\f\003^\006\354\240\250J\371\211O\002\262wU\243\372|A\007\372\033\n\031\332\373\356\223\236\021J\204\313v~D\006R\004\267`\377\003]\252\031h\223\207^\272\223\370\377\373R\243-\013H\300\n\177\240X\302k\234\351\273\366+\306\\\237\232:&\005\005\311c\004R\021\341n\234\247\207\036"
+	.string	"\0229a\\\r\247\312\252\3021\r\200\"iH\035\013II\036}\033zI"
+	.ascii	"'\314\220\323\305Eb\201Q\027\266=\240\201G&\023\361\321\250:"
+	.ascii	"\333\013\244\270\204\233\264op&\240B7g\266.\325?\257\017\204"
+	.ascii	"\274\003\261|<\311\365\346h^4\304\354\333\305?\254:\006\360z"
+	.ascii	"\212H~;A\025]\370\226\025]E\217\002D\373\354\370\271\371\312"
+	.ascii	"\020\206\002\207\260\257\004\224\357y;\0165"
+	.text
+	.section	.gnu.lto_blackboxWriteSysinfo.156.56bb4f0a239f5aa2,"e",@progbits
+	.ascii	"(\265/\375`\324g\345=\001Z\020\316tR\020 gi\215\001\327\322Q"
+	.ascii	"\337\001!:\335\375[\235Cu*\352\345~\022\225\207\310x\206\352"
+	.ascii	"\337\247p\n\365\220\341l\221H<\266\370d+\222\"\366\t\265\357"
+	.ascii	"\200=\004y\b\3541\310\377\270\300s\265#\250\335\216dX\315\240"
+	.ascii	"#\363\262\312m\224-\245\224\002\321\006\001\007s\007E\347^\303"
+	.ascii	":\267\232\242s\247a\235\033M\321\271\317\260\316\215Wt\356\252"
+	.ascii	"\216s\337\261\316m\246\350\334eX\347&ctn;\326\271\251F\347\256"
+	.ascii	"c\235\233\256\350\334s\254s\217):\267\030\326\271\303\024\235"
+	.ascii	"\033\f\353\334rE\347\216c\235\033\256\350\334o\254s\273\025\235"
+	.ascii	"\273\215u\356/E\347fc\235{\255\350\334j\254s\247\025\235{\312"
+	.ascii	":\267\227\242s\243\261\316\335e\350\334\\\206\316\275\205u\356"
+	.ascii	"3\243s\233\261\316\255\305\350\334e\254s\223\031\235[\312:w\324"
+	.ascii	"\350\334YX\347\0363:7\026\326\271\305\214\316\035\306:\367\225"
+	.ascii	"\242s[a\235\273\212\321\271\301X\347\3762:\267\027\353\334]F"
+	.ascii	"\347\246\302:7W\321\271\267X\347\326*:w\026\353\334S\212\316"
+	.ascii	"-\205un\254\242sGa\235\373\312\350\334Px\234\373\t\353\334N\214"
+	.ascii	"\316\335\204\307\271\255X\347fb"
+	.string	"t\356%<\316\255\204u\356$F\347\256\342qn(\353\334H\212\316\235\003\217s\037a\235\033\207\242s\033\341q\356\"\254sS\025\235{\212\307\271\245X\347\216*:7\021\036\347\036\302:\367\323\350\334BX\347\016btn(\326\271o0:\367\017\036\347\266\201un\037E\347\356\301\343\334<X\347\336Qtn\035<\316\235\203un\034E\347\276\301\343\334O\254s;\025\235\333\006\217s\327\300:wS\321\271\235<\316]\203un\246\242s/\36187\r\326\271\233F\347~y\234]\326\231itny\234\225X\347$\2433\r<\3163Xg\031Fg$\036\347\030\2543\214\242\363\222\307\371\210uV\032\235/\300:\033\031\235\223<\316E\254\363\013\2433\021\217\263\005X\347\n\024\235\207x\234]\260\316-\212\316B<\316H\3269\250\350\f\304:\263(:\037Yg\n\024\235\177x\234'\300:\317Pt\226"
+	.string	"\353\034\201\2423\004X\347\007\024\235\035\300\343\334"
+	.string	"\326\231\001Eg\031X\347\005\024\235c`\235\025PtN"
+	.string	"\2173\f\254\363\013Eg\004\260\316.\024\235\017\300:\033\240\350\\"
+	.string	"\036\347\026Xg\002\030\235Y`\235W0:\017\200uV\301\350,"
+	.string	"\3269"
+	.string	"Eg"
+	.ascii	"\260\316+\212\316*X\347\024\212\316)Xg\024Eg\024X\347\023\212"
+	.ascii	"\316&\260\316'\212\316&X\347\022E\347\022Xg\022\212\316#\260"
+	.ascii	"\316\"\024\235C`\235A(:\223\320q\036\301:\373\3548\213`\235?"
+	.ascii	"\330q\366\340\203s\007\2543\007F\347\rXg\r\214\316!X\347\f\214"
+	.ascii	"\316\030\260\316\027\030\235-\320q\356a\235+(:S\300:O`t\226\200"
+	.ascii	"u\216\200u\206@\307\371\001\326\331\001\243s\003\2543\003Fg\020"
+	.ascii	"\2543\217\321\371\003\353l\334q\336a\235=\3548w\360\340\254\343"
+	.ascii	"\301\231\355\340\\\354\340\234\323\301\231\330\301y\250\343,"
+	.ascii	"d\235\203Eg`\216\363Jt\376\r\235\237\350\354C\347\3663&\300]"
+	.ascii	"\021\023\306\206\367u`\257\216\2768\257\334\332\245I\243u{u["
+	.ascii	"\351\306\322\235\245W\346\346dK\271\203\0253T\270\2734\032\267"
+	.ascii	"\027\316a\346\346\322^\240\207\2318\027\340\346\3029f}v\201\336"
+	.ascii	"r\324C\003\354m\022"
+	.string	"k\220Q\251\270i!\354\225\267\020\233\254\313\230s\030FKyMsw&\212\312\373\2769\2752\303`\316\351\365\231[\356\257\276\322c\035\345\234,H\277\027\272\202M\317\211\f\302\260\026k\033\013R\017\r\260wGN\215\263-\001\020\366\352\301\301\272J\333Vf\364\353|\205\3246\033g\336wG\n\302^\373\f\005\334T\272\253m\257\244\337\013\005\366\366\320\021[\223\243\342\346}\301>\350\225G\b{e\260\006\001\354U\330\037\200\275\262\b%\264\354:P\243\211\006\004\266j\223\230\233\367\005#\361H\332m\006\303r\034\307p\374\306n\334\306_\230\215\327X\215\323x\312^\030\215\2730\027\336\302gl\306Z\270\214\311X\312Q\316\302c\214\205\3058\214\257\260\025\256\302`*RH\201\002\205\023L8a\242D\t$\214 B\b \220\030\341#\342\003\017:\340`\003\rBd\200\301\005\026\364T@\301\004\022D"
+	.string	"\301\003\0164\300"
+	.ascii	"\b\236\017\306\035\017\035t\330b\016q(\f\002\327\337\273\313"
+	.ascii	"\335l\006\363\223\242\005g\244N\312\303G\263\034\307IPd)\013"
+	.ascii	"\003E\226\276\234\341\256\274\336\256\242\334\314\344x\302\327"
+	.ascii	"f\366\004\356K\033\263'fl\016g\366\304j\355I\224\332\223\034"
+	.ascii	"icrH\301M\265\230I\231y\361B\223\262\352R5\223\342b\306L*\307"
+	.ascii	"\226\034D\370\316t\210\320\231\265\311A\004N\313\234\031\021"
+	.ascii	"\263269\210x\221\231\021\221\232=\243fO\257,\024\210@\363\245"
+	.ascii	"\351l\354\355\tM\016,~\366\024W\025\213\203\013\2133\273\342"
+	.ascii	"\323\247\270(+|U\336\350\030\354\351\rN\005\335\323\233W\noV"
+	.ascii	")\370P\264\321\241\320sOm'\264\031\26263\023\332\254N\264\345"
+	.ascii	"0\301\306W\202\255Z\202\357=\261Y\221\220\367\304\0265\002\237"
+	.ascii	"\bjV!\250E\2010\206L-\007\211iu\004\234\317\024\213\210:\262"
+	.ascii	"\251\327\007S+\017\360\310\246Q\035x\034\031Z\225\203;24\263"
+	.ascii	"\r\272J\206\346\245A\307\221\241Y\205\340\313\340\216\214\213"
+	.ascii	"\031\006\316\206\214K\324\005xd_U\013\376\354\351\313\253\307"
+	.ascii	"\343\220}U\340}O]p\024\274\330S\227\325\004]Q\022\224=u\345\210"
+	.ascii	"`gJ\306\305\007\301\003\277\021j\270\031\"A\221\245,\277\342"
+	.ascii	"\233\2461\re\207\226;\240\305\327\200\261\357I\313\214\201\037"
+	.ascii	"\b\236\"F\2624\317\317\2033\\\332t\230\035L~ tX95\224\035K\374"
+	.ascii	"\203\331\323\224(\343\335\023\026\337\016\235\00782,\270\016"
+	.ascii	"pOXf:jdX^l\016V\016\305\351\023VTN\332\023V\016b\335\323\025"
+	.ascii	"\337\020\357\351\nN\330odW^AO{\272\262\002v\264]H\006mA\232\316"
+	.ascii	"l(b$K\257^]T\270\266\264\262\232X1Y\242$I\025T*\212\310\220\247"
+	.ascii	"\220 P:r\340\270\361\344d\243\206>\276\2758p\336\350\271\301"
+	.ascii	"\253\336\231)C\306\216\032\007\367\346\326\366\205m\355\314L"
+	.ascii	"K\031\2314\232\345\313\253\213\n\327VV\023+%I\252\240RQD\206"
+	.ascii	"<\205\004\001\316\360\304\245\213\354\200jr\002gx\342B\344Q\003"
+	.ascii	"8\303\023\027\236\"KQ\007\374<\030\211\366\377*\300AJO\207\007"
+	.ascii	"\323\257\247M\256\251\243\355O<\226\334\203+\336\367ew\342\321"
+	.ascii	"\243\231E3\017\221\314@&\263\003\346\002|{\030|\367UY\360\027"
+	.ascii	"\274Ok\374\340\350\375\3360\233\330\006\363\351\t\330\253\005"
+	.ascii	"\337\3216@\024\023:-\250\346\025\f\364<\263\213\344\227\347V"
+	.ascii	"\275\031\365\327\306)M\232\026~\317\2430uF-y\237\267\2324R\020"
+	.ascii	"\025|K\177k\334g\307\201\246a\276\365\035\024\016\005_\301C\240"
+	.ascii	"\205\211\343\207\367\273\373U\231:\204\357\373\362`\372\370\001"
+	.ascii	"\354\225\202\367\252\235\027\273\331\001\345\371#f\332\207|G"
+	.ascii	"\333\255n\300k\252\021\323\3636\007@\027\362>\344\273\tj\311"
+	.ascii	"\356G\306\255\002"
+	.ascii	"\302\f\022\004\330\253\013\371.\353\016\252\204\215\211\352\202"
+	.ascii	"\372\361a\202\272\2749\346\323\207JD\350t<\t~\202\367\251\324"
+	.ascii	"/\f\223\252\305\240\3144\362\003\303<\242\002\372\276o\211^\371"
+	.ascii	"\027\367\223c\"\251b*Q\002\354U\202o\261\252\036j\214\020|\004"
+	.ascii	"on3\005\324\251m.\020\037j\233\327\360\021|7\361=\004\357\323"
+	.ascii	"&>\035q;\017\2541\231\240\2402\233\b\235>Mc\276\371P\243-\234"
+	.ascii	"\317\372ev\246\367\245\201\0013\363\212\211\345\355\364\300\313"
+	.ascii	"0\305\364M\366\033\335Q)or\036\034\340\342>S@\317\\ >T*\r\274"
+	.ascii	"\003\357\323)\2772\262\006\266\230\244\351\331\350\300@\324}"
+	.ascii	"\242\030s\201\370@\275\t\210g@\353\027f\345w\205\311\325\305"
+	.ascii	"\374\372\002\366\n\"\213I\232\226\263y\205\016\017\230\373,A"
+	.ascii	"\365bV\271\"tz\016\037\236\347]\013S\354\307\205\364\323\372"
+	.ascii	"m1\307\242L22`\257\037\276\243\275\202\024&S=\257\245\346\025"
+	.ascii	"\254q\n\226\220\2357B\321\302D\333\361wZ\364\360-\3759q\237("
+	.ascii	"\374\006+wr~\223;\274\207\357&\276_\222\237\022\346\031\367\022"
+	.ascii	"fra\2429\023\r\330k\207\275\356\250\0244\271\034\376A\231So'"
+	.ascii	"\006\341\207\204\251\306dc\266y;\035q\237(\2140\337\342\204\316"
+	.ascii	"\346\033J\331\"\367\246y\005\221\207\372\223r\237\035\006%\302"
+	.ascii	"\004\303\024#t6\231\216v\333@vuF\357\214\363\233|\364{\337\""
+	.ascii	"*\032\255\373\214\025\357c\027\024@\207C\024\225\226\366\025"
+	.ascii	"f\235\035\263\314U\017\271\032\337\344\026\274\247\355\205\211"
+	.ascii	"'|\337\267\235\270\321\230h\230j\274\235\270\2754\221,\310\253"
+	.ascii	"w\206\351\233\334y\315+\206\354\353\330\3406U\374z\250\261\321"
+	.ascii	"\371\236\245o\262\n\316\314\324c\302\361vb?\206\251\245or\257"
+	.ascii	"\341\022\346|\361[\372\303\3416SP\267<\271R>\320*=M\277\032\230"
+	.ascii	"{\305\237\223\331\227\203fJp\370\304o\351\217\311m\366\230%\241"
+	.ascii	"\263\267h\2705\332K\223\320\331K~\257+\245\202\332D\370\\\033"
+	.ascii	"OBg;\375\336 \337\204\203\303\365\001l\247^\211?\204z7\257\347"
+	.ascii	"\352\370\365\022vy\270>\200>\200\275\016\237\307\016\212\206"
+	.ascii	"\367qW\273\243R\260\344\200%xK\277\215\013\244\303\202\b\235"
+	.ascii	"\355\032\367\231\202JD\350\234\261A\257-\3754\256"
+	.string	"\224\017\364}\235\355\344R\t\235\025\330\240Wf\327\210{\304\333\211c\230r~\223\273L\347\\\355ps\246\351{n\206F\232\365\217|\225\037/M\252\f\277\231\351\223\312o\347%\310\034?\035\232\2160\374b\272\340\210\343\227\343r\303\215\377m\213\223\223w\212\215\377\313\231\032\033N\336\2514~5\256\232\020\006e\206\306\357\205\253'\370\326\264\374\026~.eh\3428y\247\264\360\233\255\221I\371\311\270zb\017J:\306\237e-\032\306/\306\325\023q\240\262T\341\267\2626\346\305\377\305\325\023yPX\270\370\251\254\211e\361kq\365D\033\2500,~)\\=\301\346\n\024\376+\256\236X\263f\245\t\277\023\256\236\300\203\252\262\204\237\tWO\334\255\201U\361'\341\352c\241F\rQ\221\003?\022\256\222\bK\301\b?\016\\\035\321\007\225b\212\237j\r\005\021\376(\256\216\340\203BA\b\377\223\253#\342\234"
+	.string	"\204\037j\315\004\033\370\177puD\036\324\t\036\374=\270:\242\215\211\317\301\257\203\253#\330\224\370'\376\033\\\035\301\246\204\032\370m\220\020W\203\3379\002\334\323\340_\022\341\255\217\377\r\301-\016\373\036\b_\364\330\337\220Xk\303\2367\342L\r\373\032\037\2633\354hDH\357\330\253\037D\311\260\227\361\340\253\216\235\332\301\326\030\3669\016\264\300\260\207\331 \013\216=N\003\2536v\267\020L\326\330\3312X2eO\303@I\027v\264\013\222\234\261o\261\240\252\214]KOT\224]Z\301\020,\354c\024<\257\260\207M \004\214\275\212\004:\272\330\275\"\270\261\305\316\005\301\233\215)\354Y\017\360Ea\307r"
+	.string	"\316\023v(\r\270\261bo\302\300\235\022\366% \310@\331\253x\354\216\260\347\360\201\352\344\235*\302n\304\030\347\344\235\222b\237\342\252\217\231\265\235!\354D<\2349y\247\202\260\013\341\252\017]\207\033\330\201p\325\007\016J\307\007\273\r\254\226\223wj\007;\217b\023\307\301\236#\307\312\311;\345\304\376\264F\364&\366\032\270\352\2236t&\366\032\\\365\231\256\t\275\311N#\230\204\217\273\017X\345\344\235\202\303\035\207\253>^\240V7\334z\\\3659[\373\261\341n\363D\322p\253\361'\036\367\231\356\251\267M\210\223w\312\f\367\035W\205\355V\001{\355\032+[\026*Y\357\373v@\206\231\253\357CKV\024\225\367mvT\313\\u\247\367}\337\267\203^\205\317"
+	.string	"\330\222\226\363!i\252[%|\337\267\0047]\327\271J\230\270M\232"
+	.string	"{\025\276\004\230\224i\001?\370\301\271&>\032\336\307\314\356\223\036\343^\t\337\227\251\004w\230\026\343bq/\351\225\335)\256\226\253\005\354\025\370\3008L\306\364\274hx\037_\340\314n\227\373\345\355\3447~\304\323\0230\2753K\337\3547T}Y~\177\204\231\273\177\317\007\234\274\377#\f"
+	.string	"\340\372,\256\220a\3627L\2013X\363\024\310<"
+	.string	"\026\274\235\326\357\350\025\0349\246o\362\357\335\306\373\\\023\037\r\357c\b\374\237\331\205\027\200\355\364\373\036\246o2\267Z\267\361\031\367\022n\201\315\274\235z\375o(K\366\264\240hx\037\373{\r\357sM|4\274\217!\360~f\027^"
+	.string	"\266\223\177\017\3237\231[\255\327\370\214{\t'\200\315\274\235z\345f3`\257\375\035\355\017h\324\215\211\352\202\242\341}\314`K\375{\337\367\365?\302\334\277\367}_~\034\230u\234}\210\216\263\013i\257f\277\321X\232\335Fgi\366\032\330\331\231t\234}I\307\331i\260\2637Yg\177\213\316\335\307:7\037\353\334{F\347\216\303:7\034\243s\277a\300\271\365@8\267\033\326\271\363\212\316\335\206un6\001\3029\241\030a\026\225\357\256\251P\016)\216\312\026\253<\275\033"
+	.string	"\300\365\326vd\353\233KM\270\246\266\225\247\345\243y\305\n\255)\232\260G\326\267\026\233p\213\231\360L\251\355M).\016\330kgy\261j\263\243y\205\212)eR!\223\224\357)`\204cXZJ\232\025\033=\034\315+R\300\n\263\362&\3127\326\373TI\214\360K\330%\364R\232S\252S\262S\262\003\366\332Q\274\254\330hy95\257Hq\365-\025r\t\265\202T(\337WJe\204R\230TC\240\b\243<\371V\253\372\246\356(\327\027\n'\337R!\024\241\223\340\227&\337N\356\204L\2124Qb\365=\255b\352B\201I\225\373D\201D\tO\t\215\320\031<[\362\315D\215\020\007\350\222\"J\276\317\276\311uB\222)\367\231\0024\312\225\362\241\006\301\252\276\223\260\021>\231TVUA\240\337S>-\023\220"
+	.ascii	"q\237&\204?\202Rr\370F\222'\354\021%\007\341\216#\337gp\260N"
+	.ascii	"\340\360-\025\346\020\3360b\344\033\007=\241\215-#\302\246\""
+	.ascii	"\337jvn\236\230\240\372\226\nk\b\227\202>\246\276\251\340\b_"
+	.ascii	"\260)>\251\357\264*6R%\242\276\245\3018\3017\301\227\310w\224"
+	.ascii	"\322^0\017\013\0216C\276\325\354\322tG\271\210\224p\303w\220"
+	.ascii	"\357\347\2674\250\246\325\3530*\0323-\344\373YeRu\225*\"x\327"
+	.ascii	"b\365\234\231\216\023\362]\265\203\372\016B\206I\345\323\240"
+	.ascii	"]\213\345cT\252\030\024\352}Z\345\365\343\373\006\245\276 \035"
+	.ascii	"\223\312\333P\203s-\226W\241\3011mZ\313\345u\324\037\357m\354"
+	.ascii	"\302\330\360^g\207\327\035\345\372A\202\0179\367\331X\340\332"
+	.ascii	"f\273$t\002\275\364\370\366Q#\330\346\326\203\215\3077\234\231"
+	.ascii	"\356(\227\217\021v\250M\255\350\370\336\321\024\354\022F\307"
+	.ascii	"\226\034\337jv}\"\3400+\003Z\335\370\306a#\030\245\336\030{\372"
+	.ascii	"v\253\242c\023\202\323\2674(\026\274\002\034b\343\333\351)\b"
+	.ascii	"V\265\341U\303\267Z\225\0305 4Qq\237)\240\301-\240\016\347w\023"
+	.string	"\216\340\2245N\254\032\337^\354\344\320\220`\272r\237)\236\2705|\250\300\346\3227\223\216\240U\253\326\276Y\n.i\032\337\323*\177\353\216n\275\215h&\201\336\365\373\335\344\021<\362\366k\304\375v\373\322\346\303\244\222zk\237\351#8\304\331\006\205(}\247\251\261\211H\372\226\006\241\334g\n\301\033\332\037@\204\316U\013\r\237\024$\350\343\006\rA\0363\276\323\274\250} \343[\032\324\021\304\261n!\275\214g\320\251\007R\260\206\030\337jv\\\246\036\300\370\226\006\235\356\263\303\202LL0>\3245\207\345\303 \022l\266jP\313\276\243o\267*(\263\356\350\026Z\007F\257\374\226\002\367\334f\213\001\341\264R>\324\226J\350\\w\\\340\225F\200n.\360\rg\227|\243#\3006L\252\"\311\037\256)z\037\253\202\"\353\216nuq\360\342[\nL\343>UP\317\264H\332*\241\363\307G\364/\224"
+	.string	"\357\230TP\2422\026\370V\253\202\312\322\035\335\322\332\240\002\337R\240\035\260\356Wf\350+\300\0048\246U\023\002\237\230V-\327\320\017\303\270\370V\263\023\353\216nM\321\240\305\267\024(\347>K\300\211\021\372\026m\255Z\277\001\327\200_Z\254\366\302\026\245\345j\263\237\320\367[\032\362\333\314\nV\b\n<\213\017\362\322\205\r\350\203\316\314\264"
+	.string	"\035\237\005\2314\332q\216\357e?O\201\261V\315\361F"
+	.string	"\261\264X>'f\245\345\362\270\237w\274+\023x\217\373\222\312\340\001\037\201\237\241J\253W\002\370\365\343\"\201\237\201J\253\326c\240\\-V\253Q\267\246\022\370\036\003\201\217@V\253\346b\324)-V\357A\245t\033\b\274\213\3319\340\037\020\245U\363:\340U\213\345pP\266\264\\\356\346\200\367:'\rxw\243\022\004\003\005\374\002\236\001V\255\236\t\352\222V\317gL\206g@U\253\326tPh\213\325nT$iP\031\276\351b\370\005\034i\325\274\214\212C\213\325}P#\035'\206\3672\273\004\274\002\250Z5\307\363\001N\265X>G\225\202k\271<\016\232\200w<\"0\274\307UAiuG\267|\\`\200w\341_\370\226\002\237\300 ^\b\370\027\232"
+	.string	"oh\325z\356G\213\325n6L\021\360=w\200w\341\t\260G\253\346c<Z\254\346\333\321y\007x\037\253*\300\033\340}z\005\314\321\252\371\035\216\026\313\307@\271\235\002\274\321j\t\201OL3-\227\277Q\273\001\300^\013\360~W\345\005\254\001h\243\001]\355\327\027\260\327\026\336\337\354\240\244\354Y\240\302\257\360\004\370\226\002\235\255^\n \323\357\t\013O"
+	.string	"`\023\251\357\250U\200o{\245\033H\203g\246\217\217\205\357;\273\001\374\nq\220\334\rN{\305?X\3013\363Fo"
+	.string	"\357n\002x\025\362\220~\fZem\323^\361\n\212\340\231a\263F"
+	.ascii	"\377cUWy=)\374\212\017@\232V\257\304\031\267\351C\375%\001\300"
+	.ascii	"\007\340\316\275\3521fz\340\311\225!\003\200\3571U*~\005\325"
+	.ascii	"\275\3622h]\017<9\2729\025\357e)>\0051\356\225\257\241\212\255"
+	.ascii	"a\212\340\311\201\221K\361\276\306\316\t\232\nN\374\t\217\002"
+	.ascii	"\256\3253\001u\373Q\241\360(\330\334\253\236\243\256A\301\213"
+	.ascii	"\242\226\206\302\367\234\t\177\202\027\367\312\315\320\254\340"
+	.ascii	"E\351\302\305\204w\263*\023\177\342\314\275\362<\350\330j\326"
+	.ascii	"\222y\004a\360\242h)3\361\236\307\244\215\002\021\236\204/\361"
+	.ascii	"-]\245\255\236\t Y~8J\370\022\"V1\367\252\351\302Z\262n\300\312"
+	.ascii	"\025+%|\323\215\360$\370\254`\356\225\237Q\277Z2\337\t\343\325"
+	.ascii	"5\302\373\231]\b/\302\373\224W)+\227{\345{\320\367e:\301\334"
+	.ascii	"F\327\255\226\314'\350\201\007\215\242\362\276L%z\3554f\243U"
+	.ascii	"\253\325\022\214\233r\266F\345}\337\023\275\362:e\315j\317\270"
+	.ascii	"\264hS\236\002{\r\341}\257\252K\222\351\004 |K\327(\356\263\303"
+	.ascii	"V(\256\r\037\352OI<\bVk\223V\215\255mk\003\366J\342AT!\351\216"
+	.ascii	"NA\223@D\267t]\342>U$\t\223a\312\211Cwt\n\227\bF|KW$\356\323"
+	.ascii	"\004u=\322\352\371P\267\230\333\267\265\310:\265R\265q`Z1b\200"
+	.ascii	"\275\216x\020U^T_\020|\360>\337\3225\312m6\037u\035\342Ju\365"
+	.ascii	"\225\210x\237\2715\b\224\210w8;\017\376\203\207\340\255\255["
+	.ascii	"oh\355V\033\326\037m\031n\357Z\274\026\017\330\253\007\357}\321"
+	.ascii	"\264\272\007\272U\003\354\340{\353\212\035\223\277a\346\026\315"
+	.ascii	"\312\243U\263\356\350`\035\302\304\214^\224\003\034|K\327\034"
+	.ascii	"\356"
+	.string	"\323\0044o\275\301\254\342C\375\"\033<\007\274\326\260\332`Rq/\341\226M\233\327\346\001{\335\340ATA=\273\243S\244\344\032\270\3403x\r\276\245\253\263\325S\001m\341\b\235\017\2652\265{>\324\266O\350\374&\250or\210\327\240\2716\3277\304\267\233\035\006\237\301\322/\\\224\034::B*\215^$\201z\216\313\243\n;9\214lqT\"c\034\177d(\2211\206\226@G\t\224\311%\320Q\350'\271\204q|\200\203B\364\210\b\n\021\344#\020|4$\343\350\300\321\017\220\322\310GH%\214\345\021)4ddP\362\305O\013\030,\220A9\214\204At\214\361\203$\n\032\372Y&]\034\005\3550ryTv`\242$Pr\231T\032\375\274@2\372\371\300/\220\214~\202\220@E3\216\212`\374 \217`\354\260\022\0314\024#\2514\372\221\241$:\016)\221GF>\"B\026\025\035]"
+	.ascii	"\375@\300E\311"
+	.string	"! \345\016\277P\036\177\226G\312!\241\237\242\344\017\321\021\210\201\026\307\027,\037Y\3500\020\320\221e\032\\\374\b\031\345\030u\230\006\027;<L\203\013\017BFD?H\345\021)Hyta\374A:\316`9\250\350\310\"\350\210\f\032\356\360\013\030GACF,\023\031\3518\343\007\b\350\250\303\313\243d\222\305\217\220\320\220\177d\034_\374\b\t\031\331\002CFG?BB\035\330\350\350\007\271<\022%\215~\204\204\220HCGEG\345\362'HyDR&\205\202\220H\241\006\270h\350\330\342\347\347\210\305qg\350\303\016\3138\022!\225E6\202\021T4\2044\304\262\220Pr\t\003\310\005\3202Y\324\001\3518\243\003\323\340\342G\004\243\b\037\230\006\027?E3\202@0\r.~\216\216\216FHI\242\235\037%rI4$\364\363B\211\\\006\031[\034_\020!c \211\220\2163\202\254B\0130\270"
+	.ascii	"Z\016\031\rY\205\026` \"J*\205|\264\034z1DT\004r"
+	.string	"\322H\006\362\007H)\344\240\020\"\206|\204\\\036\225?@\312!\273\030\201$\032\022J*\215~\220\313\243\222(\251\\\026%\201H"
+	.string	"\tept\204\004J*\215~\202\206\214\214\374\"Y\204\f\372\001*\232\341\301(\231$\032\2622yT\204\214aY\204T*a"
+	.string	"\351\260\020R\271<\262\210!d\0210B\f\031\331\342\270$J\306 \"B\002-\217,bxX\036Y\304\310a\030!\236Y\b\341\007\b\350\030\344\240\020\"\202B"
+	.string	"\271\3102B\310"
+	.string	"ae$\321\021\350\350'\251\234\321\"G\306\361E\221\221D\313eR\351bY4\364\242\310\311\241\345Q\331\003\203\020\206\034\016\n\361Lt\214\241D.\213\206zZ\310a\344\213cQ\317R\350\250\024@\016#_\f-\227\312\343\362\250\247E\362"
+	.string	"\037\270(9\264<\276P&\205\212\206z\202\224\307d"
+	.string	"\214\fd\344\362\030\304\"\214\020a\004\t@Va\204\025\206\210\220\004`\371(DO\007G!8\3509\n\321s\024B\207\213\222CGC1\220J#/]\264\030\"\022*:\"\211\004P\344\243\020\317H\243\031\313\036\244\362\210\364B9\264\202\3162\310\227E- %\017\260\263,j\301E\213!\002,a\030-a\274\240L.\223/\214B0X\374qyT\241E\321\220\213e2\371\"\006 e\007\006\032!#\311\302\002@G\"\026$\212\206\216/H"
+	.ascii	")\217H\214\250\200\223FH%\211e2\251$\221\303\314\fF\243\037\007"
+	.ascii	"\356%j\232\214\235\375\272]`G[\030\207\215o\354\354\211m\355"
+	.ascii	"L\377\304\314\316\364\274\202\306/\361\f+\335\321\336i\273\346"
+	.ascii	"\025\337\327\307gw\364\245\247s\253:@\211sx\3554\336\227\376"
+	.ascii	"\211b\334*!1\214\323\370\027\243\205\032\325\325yXp"
+	.string	"\274(\260buK\211r\356\263\347\250p-\222>+\336\275M9\277\331?.\320\233\337[W\3100\371\033\366(gN\022K\032\363v\362\346\377L-}\223\377\256;J\367%7\001\177\331\324\212`\372\336\337(\321\213{\325\r,\225\231!\242\021\273t\337\267[\025\231)3\360m1+fI\"#\222\361\024\004\264\337\250|\017\242\356J\002p\276\367\242\314gk\201\216%iI:\023:\213J\342|\357\275O\271\020\303\230Tq\276\347\354\274\336|\303A#ZaR\275y\3272F*\002n\276\365\300\230\317\036\363*\362h\372\346\224\310\225\244\367=\246\312\213\215\250\225\324\346\346]\254\n\314\023\002yS\250XIoqBgN^\233\357<0D(m\276\341\252\340\202<@\3157\233o)\321\t\363\331b9xD\253\034\2665\337l\304\020\225\254\371\206\253\362\372V3G\254J\363\036\326\326\035\245\373!\347"
+	.string	"4\337R\"\022\367\331c\320#IuIvBg\016\330\231o4Ie\210E\210TItIw\302$`\257}\346\373\315\316k\255;J\347C\256\001x\337R\242\024\221H\016\223\3527^\022\036Q\b1Hu\213V\230\326\224\001w\337R\"\020\342\217\034#Ih\210=\222\324\020w\020y$\261I\312K\322K\322\003\366\332wYY|]d0\363-%\346 \336\310\001R\346\333\f\321F\022\234\266\255\314\237uG\305\350\311-\200\314\267\224\330D\254\221S\303\356\233L\322\036\221\006\261i\227\265W\326\274\"\006\352\267t\3307\334#\262\251\373\246&\365\r\337 u\232\236RS{qS\367%kO+\252"
+	.string	"\272o\351\260\315p\r\021\314\3347]s\210\306\275j\2673JM\235\2067\227&+\016\226\004\214\271+C\024\363=fiHu\257Z\215\312J5\206uJM=\205\276/\223\225!\235\030\270\2548W`\b3\306}vX\030\"\0250\337al\f\343\340\300\344\351\201\275 \347\366\205*\356[\356i\250\226\026\227\327\205"
+	.string	"\270o\351\320\213\373\3542h\027%\034J:\204N\242\363\355\033\216\307\360\314\354\255\215\336\226\013neC\351pM\333\267\233\217\341\230\330\020\213\322\017 JA\202\264ye\265\321\232r\200/\337\322\341\025\367\331X\252(=\225\210\b\235\3037\266\357/RC/*\303.%*#JG\216\260\235\311b\243\027\305"
+	.ascii	"k[Ygj\337kH\206X\356\325\3250\212R\225\022%&L\200\275\266Z\326"
+	.ascii	"\032\275'\005H\373\226\016\237\270\317\024\232\200M\277"
+	.string	"\323\232\f\227\f\223\f\225(=\271R\302\302\232\246e\341iY\265\340\345[:\204\016s\030BA\373\366\362>\23524\342^\025A[\301-\353NO\t\001\272L\271O\024\303(\346\233\017u\230\003\227\357.\357S'\334Yg\321\351-\337\\\276\235P\226\274\217\373\354{\313K\260\347<c\366}\366\2555\024\2024\204\032\006Q\342\352R\372\372\002\366\332f\337\321\376M1\202\205\032\325\005e\201\354[\313\267tx\203\333\354\260\241\rC\037e\337Z\252\fy\354(\373N\223~\223]\031\346\030\342\220\262\360\246I\230\326\221\025\306\276\243\337\322\341\223\333Lahc\310\224\345;*6t\016kd\371\366\202\345{ll\2704\244\201\205\205/V}E\006 \366-\035\276|\3024a\337bQ!\034\2447a]\254\370\364\244T\270\362-\025\272q\237\035&l#\204sZ\371\276B&T\343^\245\261\302\2475D"
+	.string	"_\337U\276\245\3023PaUI\213\322\231\320)\2146\330w\025.\3022Hd\300\276\325\354\274\276\277\320\204T\244:/\026\326X\305\321\013\322\274\""
+	.string	"]\337\322\207,\250\323\220f\241\200\252\310\020C#\"\"I\222dX\003#\033 \bG\2028M%+\017\023"
+	.string	"\004\310\307\244a8L\344$g\030\204H\247P\036\260Y"
+	.string	"\035z\314\002Nru\326h\003v\315\353]\262\025z{\211\332\342\222\310]ehX\374\302(\203\205{q\210\\O\200|r\001\362\217\363P\270\372\356\276r\f\377xG\354H%\332\\\033\007\352\275\013\226H\375\f\205\204s\221\224\310\027w\351\230\212oH\337\373'\270h\214\254d\224M\301!\302N\357\215_\t"
+	.string	"\371\"\330\2744q|\272\ni\316\242'E\363m\341\0255\252\020\336N\255\002\361<\204\307\370\336\t"
+	.ascii	"\340j\0164v@\374\210\372\312a\035 \241\302\1773\367\327=\227"
+	.ascii	"\210\366\021\214\340\363\266;\305*v;\3335\"\2272\360u\367\346"
+	.ascii	"`?\370_\030\223\315r\351\264\250J\367\342\204U\242\002g"
+	.string	"\0277\250\3216 \2677V\315L\321\330\233\213FGt3\024IgZFw2F\257^W\260z\335\250T\320y\360\203\332\276\266\301\247\t\360E/\200/\360B\350D?\177\362\215\250*\353P0rZ\232\244m\225eT]G\020X\267o\310\023\032,\300\243Z\214\203\261Ef@kJ\220\233xxt\373\3407*\204\223\236\035\252\225\036\315\227\327\037\315HT$\006\276\217\366\311V\340\021\340\003\037\024D\253\373\016^\222 \033r\370\377\270V\005\250\270\312\026\2761\263\260\001\272\311\342\202\251\321\377\226\364\303\351\266\2450\002\2063\244\337,\355\347B\301\256S(\201{\007\344\342\354\366\030\210\273M\036)\362\004\013\207\257\272e\364b\355\204\034\2108\306\360\035\216\262@\2706\261|\356\320,\207\204\0300_\002\207\344\217\247\351\253OB\215\343\016Iu\370\\/ N\017\3469\241p\344(\326\035X-E\325J"
+	.ascii	"0\035\210Rx\"h\361"
+	.string	"b&GRh\022."
+	.string	"\274\005\017^\307\025\3008BN:\320\"^;\2246\306\255\254c\224\257\264':^i\256\315\027s{\225\031F\252\260\343\203X\031\251L\264U^\272\240\2157C\235>,\317\224K!\334\254rw\252z"
+	.string	"^\216\036c\325\237\247\324\266\343\342Z\270Nx\024\357\325\210d\342+2\253\021G\315\226\211\037\302qaHj\247"
+	.string	"\021\214\2736\241\335\204\364\331h\241\0026\226i\366\276\317<\005\235\344H\201\205\264\342\252\220M\361o\362\3563d>!\245V\rE\030\226\n2|\b\220\302P{y\265\233\273\205\305\261U\357\224n\231]\214\211\260\342\227EJ\t_\257\003\233\250\274\312\212\232\325\221YfU\006\003\024mT\177\211\346\037_\205\376\035\322\032\035\327\021\303y\352$X<\001\333\260/\350\311\313*\223\2339$$\254\260\261\251\303r\230\311M\036"
+	.string	"J\353\233\032\345\236?\376\244m\3266\204J\360\024b\347\316F\320^\211\247!D\306\332\372f\310\230\333\202\036\342\330=$\303\231\264\354`\202~\373\371\356\323\250\203\026\301\0350[\247\013\333\2376\310\002\3713qr\373\222\3320Zc\342\314\365<\0034j\r\217\243\324\tB=\254\270&\316\273V\351\331\002\334j+l \344\264\274\243Ii\204\357\341\253\366\217\351Mx>\332\204uH\366\336\b\347a\343\240|\254\272\200o\336\350\r\212\252\215S\025\356\364ix\343\324'\020Q\220\243?t_dNF\377+sBd\253Py}\3257R\256{W\245*T\326\241\313"
+	.string	"\020\345>d\223\326T\001\f\301\032c\376<\326'H\314\236\306\366\003\273\260\373\346\314ym\263XO\017Q&\265\345\177\023+t\003\034\224\237\250\244\337\353<\255ak\235 \373\244\265\343\020\354B\267\353RI\237r\272\252\307\235\225\231rN5\274.d$\202\005\225\360\020\255L\365\3547p\311\3673\225\300mg\224"
+	.string	"\177\303T\333w\260`\221\253['\347\031\327\222\354\352\"oWb\327\226\311v\271\351!}@\002\300\244|\255\0346\\\207\211w\236\375\023\024T\377\357\206\250\345\017\211\352\023kK%P\244\236\373\300z\0313\365\211\265\205\032\340+\353\365\2545\242\3278\0237\255\273,\321\177\330\333\007\304Bk\020'\345'j\025U\360w\275\337N\177\255\267\336+\r\032y\361%\273\334%\265/\357\320\362\3134\267\004\305\207,\346\242f;\212\254\314Jx\340\347\254T\233\0135\353\247+\204\236\363\356%=\217\310\257\252\306\345\262\251\032\247\031\r"
+	.string	"J\0033\361gA$E\354\267\013\003}\364\265'\315\322(\246PU\2250\026\327\203\200\234Z`\2749l\341\354\376\265F\246\023\200\215\t\026\024o\302xJ1\327<l\317\024\324\314\313\233b\216\331\257\252\0026\270\316\n\213\313\235)k\367O\324+r{Gh8vmj9\240\201VC\024\017\31335\300\306.{.\304\2477!\312z\306U\377wO\013\255q\003\224\221\342\236\251\020\004\236\305\310\312"
+	.string	"g\365\002\220\207|\220M@\222\373\243 !\013\206^\243\212\260\347U\023\302u<"
+	.string	"\264\312\036\204\361\265\252\206\003\317=\202\240\276^=m\001j\270\377\376dEDn\255r3\360\374\241%\366\365\001\027\335|\037\305\002\350\021i\262f\224\314\244\f\250\002\356>\313\026 i\b\350/=/\220*\274}2<\271\203\270\365\265\236\246\020Rh\\%\372nM\341os\203\2259\220\231JE\3262l:(s_:\275\262\331.\013\362\177En\"\355\f\232\240=\317\374\250Vu\300\250\205\267\234\030cL\031G\323\352O3&u\355\021\300\203\376\2320\261\241}\217c\b\252\311\326,\023\340\340vd\3317X\024\\`\344\367Q\227@\363\020\031\224=\322\231i2\302c*\034\032)e\330<"
+	.ascii	"\366\021T\370G=\255x\233\016\367D\306\200\366S\220\261\260\257"
+	.ascii	"}\344%\322\235\2060\260b\006\021\231\b\246o\346V&\324Z\211?K"
+	.ascii	"\"\0175\371IXu)\315-2\264\231\270\207\022\315\205\324B\244\246"
+	.ascii	"\265\306G6\356j\212\037\"\275^_(\0015[\004OQ\277\220\013P\013"
+	.ascii	"\007o\027\263\354\214zS\311\310\356k\236\322\fY\3248-A\230)\304"
+	.ascii	"\255\007 \253\214d\245`\241\263\237\371\362\256\032;A\375y\355"
+	.ascii	"\315k<[,\312\362G\\8,M\305\315\303\275\362h6\212\036\357~\221"
+	.ascii	"\375>\334\252A\267\211v\370\326\255+\3426^\250\035\315_#\202"
+	.ascii	"\3477%\221e9\222\324\316\n:$\320\004\272\236r\271+\334U\341\234"
+	.ascii	"Ym\332\344\2107\267\353\364\036>\341W[I\026\032\317\336\355\035"
+	.ascii	"z\212C%O\3039W\343~\2610\263\315_\316\245s\013\213NO\rP\227h"
+	.ascii	"\036\032\317\bl\270N\307w:\237A\345)\027%\022\3722\256D\034\336"
+	.ascii	"\310\276\tr\231\347\327Jh\357\234\025\322\355\331@\026-7\326"
+	.ascii	"\315x\245<\261\273{\324VI2\225m\210h1\022\205?&\005\003\035\214"
+	.ascii	"\033\320\252eI7,\205\001\211\032\274\017zsg\346\371\245\026\275"
+	.ascii	"\335\2132\331kU\356\234\027\251N\0028k\206\255^\352\250/A\320"
+	.ascii	"\341\026\357A\005H\311--%wX_\354\037h\fl)\253\241\206\361\035"
+	.ascii	"\b\230\240A\362\350\373\306\205\2367\204jV\002\220\306\236\026"
+	.ascii	"`\022\032\313}\341\230\033\311\037f=K\354\312\364\256\324\204"
+	.ascii	"\177\364\257\215E\235u\322\217>\033_\233\322\0068\237\276\316"
+	.ascii	"\375T\273\024P\254\277k/\204\302\323\324Ty)\"R\006\021.\007\345"
+	.ascii	"H\230\341\213_\f\206\316WC_\214\354d\037\032\347mL\252GF\206"
+	.ascii	"\220\315\314K\351\017=_\nh\354V\0376i/\202\327\370\377\346\302"
+	.ascii	"\300=\327\027\370\357\217\267\210b+q\370\357N\200\213u}|\312"
+	.ascii	"\356\302\303\237\251@#\266,\033\342\356\230\341Fp\274a\345\210"
+	.ascii	"E\307\217s\002\306\342\"\217\333\331\276\372T{\\\031\0327rl\313"
+	.ascii	"\257\023w~\275\352&\257\250\253\034<K-?\t\376\324\327\346\207"
+	.ascii	"\327\300\256a\306y3\222\366\316\337\333\013\210JPY\237\235T\376"
+	.ascii	"J\243\246#Cj\344\360>\246\267\037o\335gx ^\214\257\266_dM\335"
+	.ascii	"H(/\313\221*\365\022\271\336\303_\3260\2719MZ\324.\204u=y3\343"
+	.ascii	"\305\315\260\322J\265\"\266\327\340\313\266"
+	.string	"L.\263\223\026\324\025e]\207\337\314p\270s\254T\254\255\b\365:\371r\252\0045\343\305\315\260\322J\265\"\266\327\340\313\266\314\340\204c.\363\\\210\313C\016\320\020\264\346A\333\307\336\347\240m\274_Gw\005\225\024\373\315\rsT\271,<\274\037\226UX\003\273\321\003\352K\fQ\036I\327\265xE\034\362y\256\3028\321!\315g\346\265\371\321\212\272\240\251k\021z`\017\320N\266\326\007\r\317\320\177HD\177\317\t#\322\020\251x\3510n\245\363TG\027-ZB\227\003\224\nO&2,\351-\301E\245\034\374\325\004-\3265\213\\\311e>D\306\345\307.\266\340\2504\352\315\351<\314(ip_.f\346\020\003\332\350\316t\332\254U\232H.\245\335I\262\272v\251\312\252q;z\262\2518w\240\034\032h\030\322I\303\241pR\323\362Q\354UY>\005\364\273\2070\306\031\204\231S\\\022W\022\204"
+	.string	"~\022\210\330\230\025\332\220\224\327\r\224\343S'\371D\351I@Fj>\371\204"
+	.ascii	"^\267\336\310n\024\037a\026\006H\006{<\036(-\354\034S\226\255"
+	.ascii	"\275J\037\326\374CQ\276\210\270\217M\2011\371\r\230\215\005\254"
+	.ascii	"\264\f\301\340<\320\325\333\313\2474N[\177\202\203\001\217\360"
+	.ascii	"7\266\017_\217#\023\251Ej\232\026\2627\034\273\356\325J\205i"
+	.ascii	"\016\321B\276\347\030\335\363\304\n\017:\374\247`\274\350\211"
+	.ascii	"\203\035>C\f\312[\214\276ra\313\342\027\316\217\310C\003_\306"
+	.ascii	"[\366\301\344\236G\365\301\353\033n\331\217\247y\200\330Y#\353"
+	.ascii	"\013\333xn\245\016l\3670\272<\336\326x\364\3760\335\344\356u"
+	.ascii	"xx\347S{\342\3666\b\262mG\023\331\027-Rpu\021"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.157.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"5\f"
+	.string	"\326VR@ S\223\016\340X$b\0050\003\007"
+	.string	"\n\264\231\237\370\306\"R?\276\302\013\t\021*Ne.\313\b\276\006\367\373<S\001jOK\023B"
+	.string	"\t5\t\004\246\rd\302\231\026\252j\020F\366\2262\245@"
+	.string	"A"
+	.string	"?"
+	.ascii	"/0\035"
+	.string	"\032\263{\234+Y\214\217\032\036J@v\267\322\025\307\37641\337\262e\177\324\210\353;\220r\242$`\033\275\005&*1\336=I6R&\200\315\356:\265-\304\ro\033\202\355\007\366#\004\207/\235\232>\205\200\305\007\021/\261c\027D\\Y\025\230\303\205\355_l'w\032\330Q4`\b,\251#q@\035\232\243\236\366e|\006\366\223\r\016\260\213\342\006\216]\256\2015\324\241\202\033\230\016_/VJ\364\231)\225\323\351 \245\020\017\2101\376xf\272\246\276\203\211\321KO\271\340\267\260\310H^\033\231\016\257\357\376`\230\360\bB\202CF\233\313RU\330\327\030c\264\246\260\217\362O?y\226\310\222\360D \017\006\017tG\223\341\342P\350X\0258\025h\202\365\251:!\221J\223\300\227\005O\250\022]W\250\272p\373w\0359\265e\340M\226C\376vw\237%'\205j\177\256\274f\250\331m\004\027"
+	.ascii	"`\251'3\bh\334\314\"\210-\f\230\265c\246\031`%Qm\201\224\026"
+	.ascii	"\001H\230p\222\206\3020\241\241k@1\214\006\302oj\n\334\013\246"
+	.ascii	"\246\210\273\334T{40\265\007"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogArmingBeep.158.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\374\001\335\021"
+	.string	"\306 uG\320\362&\035PF\n\036.\257\321i\004|\210d\314\207\366Zks\032[=\273\002\003:\024\002\346\214\376\231\326}_\233\205<\220\303om:\321\205\247\214\206\f0d\353z\214\203\026\217\215tw\016g\r\262\267\224)\005_"
+	.string	"Z"
+	.string	"c"
+	.string	"\361&\333\245mcs\227\347\334\262\231\b\344L\027\203\247\240\235\244\037s\316nK\274\365M\306\325\226\177\330E>\320\365-"
+	.string	"\030\342\022\304c,\240\344\223D\002\342D\004E4\330g9\2721\305\006m\207\004\324\211(?>P\207]7\200/\325\020\2269\247\365\003y\356\220\333v\261\355\300\326\b\001\372\357{\027\265%\332k]v\354\245\013d?\316\375\261W=\022\325\334\252w\325\272\352\227\030\030\342\360\341'v\314\331!\0042i\222\306\320c\277}?\305g6G\362\002\243%\2429'\367#_v\025_\321z\254\346\223g\376\023z\"j\232\323\203\202K\257"
+	.ascii	"\270L\371\311v\031\263\033%a\030\372\270\312\306\355\310^G\304"
+	.ascii	"KC\3730\036c\305ji\331.\271\375\354\021E\221\016\250\036\273"
+	.ascii	"\\\366rbb\316\331\200d'H\306\347\264\373\"&}N\273\227}\300\214"
+	.ascii	"\032\216G\215\b[\354\002Y\367\253\232\325p4\312\276\322Y\274"
+	.ascii	"\370B\206\361\244\357m\227\272\007x\364\334h\350\020\265g.\004"
+	.ascii	")\232\024\004\232\030\026\006\226\210W+\031<\325\313*UA\325\305"
+	.ascii	"\270\244`\272\225\314L\267\202b\317\002K\246\243\361<\231\216"
+	.ascii	"\213\335\034\366k\250A\321n\366\265\325\3049I<x\354\227]@\023"
+	.ascii	"\222\2065\230\364\233\t.\315\342\322 \322D\217t\231\204\355\310"
+	.ascii	"h\211\350\363'l\376\214BJ\377Y:G\017 Bq\201\256\262\215\254*"
+	.ascii	") @\002c\030J\036\240\352I\002:\274\271a\245\001\347\332;\242"
+	.ascii	"\027\356\036>+\252\003 \003\321\t\271\261\300XVM\323\330\\\225"
+	.ascii	"\024\027\241\2101Q\030\206m\037\311\365\232 \2765-\361\300\021"
+	.ascii	"\253s\246,\016\214\361\376@\354D\2030\266\226A\271\342\363a\005"
+	.ascii	"\340\203kc G\"\221\205\337g[v2\300{"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogFlightMode.159.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`[\004\345\033"
+	.string	"&\260\253H\240ZQ:\304\247;\255g\027\302w\f)\305p\277\366\243\265:D\004\237\276\213$\rY\251\366\253\023(\364\236\265\237uJ\335\365\253\372v=\256\323%\230N\035<EZ{\016ya\264\003\313\244\024\267\306f\367\336[&\031\226"
+	.string	"\214"
+	.string	"\232"
+	.string	"E\256\230T\335k\364\340\225yZ\257\374\373\216}m]\307\2762\307`~\275\366\213m\314e\006\314\2707\bWNEB4\367\336\330\024r\333]c\213e+\235m\343\263zFRw\273\213\325\203\264;\372\250"
+	.string	"i\307\343\255{1\342\r\257`\311\210G\263\350N\027 c\356\305\350\210:\350\221%GQ[\227n\307\253\216SJ"
+	.string	"\312\207\360F'\203.\360\021\231\036\234\321\363F\227\243\t\356\275gz\327\320\021u\263z\356\275\334\244nw~\235\231\227\230y\0023\035\021o:\024\232\223?\361\231\321h\366\365MoRk\335\213;\311_r&@\374\336+\223\250\365\311\232-q\242O~^\311\224\016bn\336\230\177D=\223\230O\357\f\302\\\233uZ\3159\265\031\326j\306a5\217\266\231\332\346Y\233\2336\177\200\201\322\006\216\367\206\367\336(\256\271\304*\205\310\223\374\2777\363\207P,+\251\214\be\021l\377\271\370\315\335\027\275\253,?\362`\214?\261\254\224z\275\211\017<\222;\331\376\203\361\273\273\337\005\225{n\315\246\026\350?\035\250\301\")\245\320\220\007\276\301\362\203\034:\364I\256\363\306Q\27469\350L:\003\013\233?\301-\001\212\305\342\2313\2608\0236\237\353A\244\345[<|"
+	.string	"\321 \354+\316\364E]\301\242\202\337\343\003i,+\245|\343\2742\243\t"
+	.ascii	"\020\206W\345VT<\221\250\305\224\356\305\205\260\257\343\264"
+	.ascii	"BzT5\216z2\2138\320gG\351\336+\341\244\325\024\037~\257\347\201"
+	.ascii	"\247j\312(\037\017\327\305\276\367\336\346Lz\360\317\237\240"
+	.ascii	"\030\031\255\206aM\317Xl\263\241\331\205!\024@,\200F\246\361"
+	.ascii	"\264\b\372)A\233\231\370\211\241\250\315N\304hB+b<\b8(\005\220"
+	.ascii	"Pl((H(\366\372\341N\357\f\302\364\323\230\212B\304M\"\227\213"
+	.ascii	"$\277p\204\272\320v\304\226%\225\021\331\3609+3J-\342u\316\345"
+	.ascii	"9S\247*g~x\272\344\213J\303c\233\323\205\026\002\024\r\241\""
+	.ascii	"\255\346$s\3419\f\207p!\255\242\\u\371\301\242sNU\240s\344\341"
+	.ascii	"\300<\214\005\f\0312\330\3279\317tJ\245$ca\320{\221(\374\367"
+	.ascii	"\003\017\253z\352\342\2272M\336\006\017_\250q0\305\034c\304d"
+	.ascii	"D\244@\005\225t\220\002\221\251\253\016\021P\275U6T\303\376\006"
+	.ascii	"\340K\242\2051\303\260=\317X,\247\212\334\\\032\212\351\036<"
+	.ascii	"$\275\260F\213\005\351\273gM\301f\237\201>\305W\364?tK\r3\325"
+	.ascii	"\002\213}4\321F\026]\\'\356\235#W\370bX\256\\F\200\232\223&Y"
+	.ascii	"\247c\0301\370Zb\344\372kP\r.\214|R\266S\256\273BL0\227L\025"
+	.ascii	"ok\354@\013@\222%\372B\345\2616\302F\0333\001\001\250\347{H\222"
+	.ascii	"d\003'\t\366\266\301\177\367\225Dj\344!^\322\360=\tDo&\372\275"
+	.ascii	"\013\265_\0230\352\357\b\203I\361\316\037\2539`\302\260dP\034"
+	.ascii	"\331\266\350i\350\266\344\375\001"
+	.text
+	.section	.gnu.lto_blackboxShouldLogGpsHomeFrame.162.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`^\002\315\022"
+	.string	"v!vG\3200'\035\333A\t2\252o\220NM\365\363\237\335\032.??\354#\240V\246\327\314\241\274\202\3469\273\260h\373:\204\256e\3045\242y\372\220\253\031d!c\034\251\350\233\301\252!%|5\206b#d\357-eJ\001f"
+	.string	"V"
+	.string	"f"
+	.ascii	"B4\346\314\231\3121[D%\016\266c\354\316\007\020\304\330\025\200"
+	.ascii	"\346U\003$\352Bl\204\2159\211X\273\341\256o2\302U\227\377\372"
+	.ascii	"\326\200v\242'\306\321\227\3412B\002<M\030>\276\030\004\340\242"
+	.ascii	"GF\367\321(\234\351\276\032\335\217\017\006A\346\234\247]o\276"
+	.ascii	"\032\325\215d\316i\265\371tn\356\266_\266W\266\372\004/JQaa\221"
+	.ascii	"\217\272\253'\003\007\341qs\316\005\376\320?\264\370A\217~\201"
+	.ascii	"\321\333<\3720\362\361{\332Cv\232\204x\206\224dt\312&z\351\316"
+	.ascii	"\354\303\271>\266\325\036\253\356V\335\241j\025TsP\275\251Z\256"
+	.ascii	":\252\032\252zU\255\252\376\307gt\310\301\331y\033\301\350\211"
+	.ascii	"[\225^\200\334\226\333\327x\200\245\270\212\007\020JJ\344\343"
+	.ascii	"\266\n\200dq\345>&u\244\2430\361\203\334B\321\333\240\310\307"
+	.ascii	"\270\327\241\325n\310\016wf\270\273*e\302\373\322\317Q\313\221"
+	.ascii	"\234J\300\375\022\320\3525\022\273\f\200\256s\316\327\356\367"
+	.ascii	"\304\bjFq\210\360VN\226p\243\226\220\2379g\202\020\001n\215X"
+	.ascii	"\360NTZ&+'\254\t)&,\254\226\313\013kd\200=\n(.\254\n\236\347"
+	.ascii	"\302\352\210\346\341\\\037k<\323W\2424\324\222\240\357\222\247"
+	.ascii	"\235\313\021%\253%\311\337%=\366\306\266\307\232Dfa\333\316\274"
+	.ascii	"80\244^H\021\331\355By\352\"\262c\273}L\006[\341\240c\317\342"
+	.ascii	"IV\240\250\306\024wf\325\3127 \220\002\031);\017\240\365.\037"
+	.ascii	"\272\006\023\212z77\267B'\rVd\025\311\370KF\023~\261\nd`R3\032"
+	.ascii	"G\334\216\036\245\037qX\274<\t2\303\177\253e+\375\027\242%\256"
+	.ascii	"\nH\200\236\241\001\020mc\277\362\361\034aA@(\276mE\262@\363"
+	.ascii	":@\221|\332\336Z\204\030\307$\343X(\021Zh\207\027\265\343\230"
+	.ascii	"Fd\201\373T\324\360\270P\007\236\025Bu\212~\323\233`\312"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.163.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\001\002\265\017"
+	.string	"v\232^C"
+	.string	"\221(\035\240\374.\213\210U,/,\202\350#N\204\362|\310EP\321\255\244\230,\346\264\0048\217\266\227\373\236:\322\321\261nLu3\326\356\252\352\317\2405\246\\\362\221\317\202\307\226\2206\356\275\245L)J"
+	.string	"B"
+	.string	"P"
+	.string	"\273\032n\330X\030\330\"\302\3665\223lW\200\013[B \363\001\245\362\332\335MA\234t\3704I>\307\007\226R\225\0165%\177\231\252\344\n@E\362\n\354\356\273g\006\325)\223\343cw\235)\325\206;\336\266\002\333\006\354\034\005\251\307\340\341t\022/\021\342\207\260\310H>u\350\217\304\303k\326\271\240\2612\345\r\033\245\224\312\262\377VMlMo4\255=\235\2754\366\264F\323Q\3230\323/\323\372t>\375\016\001.\031\034>b%%UV\246\032\355\244\300 \311\032\3064\323\243fL+\316\342\001\307\343\211\207\230\016\210\261\322\350YP3QY\256\362\211P#\212\247\370@"
+	.ascii	"\201\342!\324\003\335\313\311\323\225PT})?\021\002\341\270x\250"
+	.ascii	"\232\300\245\303*\325\304S3\376\220x\r\366x\214\270N\310\303"
+	.ascii	"\211\320\331$\2008 \233G$\262y\02007\341#\332(p\234h\323P\366"
+	.ascii	"o\325\004s\311\300\230\364\004;\322^\300 \237\262ji\237\262Z"
+	.ascii	"\374E\003\013]\353\025\263\321\226\212k\272qq\240\351\250k\235"
+	.ascii	"\254>\261\245B\367\362\212\311\335\r7 \300\002\0311\243\007\340"
+	.ascii	"\2527\"t\252\004>\3765q\356\345\262\366#M\t\204\206\030\263\211"
+	.ascii	"BQ\2632\304r\312\314\022\360\350\223\024\343|\331xl\304A\003"
+	.ascii	"&+\1777\244\270\321\263;{\341l\334\371\260<\ro\261\225\267\311"
+	.ascii	"\273y\026;H\324l\374b\325\265K\035\310\030n\220\243\266\370\225"
+	.ascii	"\251\331Q\033e)KL\023\rE\207\370\032,\224\211\006lO\036~zki\031"
+	.text
+	.section	.gnu.lto_blackboxLogIteration.164.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`0\006e!"
+	.string	"\326\366\305F\200\232Nc\374\2525]t\225\2576\343\310\023_P\003\211H]\215\261\325\252\362\237\306\017\201\327p\240\250\371$\256L\330\371?\337\372!\277\177\224!oc\300\271\231[\346\266\356s\241\037(F3\262\367\336[\312\224\002\263"
+	.string	"\242"
+	.string	"\265"
+	.string	"g\367\032\031\030\b}\351\363\035\363%\371"
+	.ascii	"\346K\247\266\230\0012n\320\201\231\"\023\231\334\275\367g\263"
+	.ascii	"\236>\007\247wc\303\253\331\241\247Y\222\266\246\376)\264k\""
+	.ascii	"\006\237\203\243\325#w\264X\261]m8E&\230\312\202\343\206\364"
+	.ascii	"I;2]m(E\372\256\250\346\3365\244\2526\247\020\357jC\036\357\032"
+	.ascii	"F\325\032\255\237\256\341\216\272\373\251r\202:\3325|\252\247"
+	.ascii	"\332\020j\214\251\232\247\320O\225\223\326\313\034'\311\004n"
+	.ascii	"S\342zD\031\344\216\r M<\242\260\332\036q\006\351s\357\275\330"
+	.ascii	"+\r\342R\255\247\320\275\327\265\211\350t\003\270\375\003\266"
+	.ascii	"%\330e\222:\216K6X\357\275A\353#S\307>I\275\365\200\333\262&"
+	.ascii	"\254g\354\233\375\311\221\317\345\022H\365MH\346K\035{'7\260"
+	.ascii	"\305\n\227\251\260'\245Zg\033\227\252\305\262O^{e\243\325>\264"
+	.ascii	"\272\007\255\346A\253u^\374s\316j\364\254>\317j\363\254.\315"
+	.ascii	"j\322\254\266eu-\253\357\323\223\005\345\306\277\352\356\265"
+	.ascii	"QGw\217%Z\020\277\311\235\260\270\321\r\276\270\310\261Xr2\027"
+	.ascii	"7Z\002\333\025\027\366\223|\354\305\215\216\360U\206\367\322"
+	.ascii	"~a\363^Z\236\355W\373`\017K_\214\341\335\275Ui\001J\265\316U"
+	.ascii	"\264X\261\331\244E\336\234zG\214j\331\033\221w\265W\373\252\324"
+	.ascii	"\253\332Z\326VW\263\302\274\005\022\250\277O\303L;\025\253`\337"
+	.ascii	"Fw\024\356,\304\2219\nmP\354\257\021\245\356\316\271-"
+	.string	"\331\240\215\367^\024\355\276/c\006\361,i>;a\253\370\323bAy\217\255F\224`\271\320c?v\004KV\204`@\313pfjh\003\343\2519\326\336\300\341\353(,\005T\333\303\207\265\266\"\246\022\206D\213\fa\362\360\220\212;\231A|J\b\364^a\220/\345g\"|\256\227\03614d\276\344\261'{\005;\3025\025V\354U\273\310\250\276\311/k\013)<\024!\035uPq\242\b\b\\Atc\"\240\026I$J\020\r\231 \361;q4\204\364#\002\246\370\001\371\234\204\242\b\370S\221\224\004\374\361\214J'\257\275\362\356-\354\250d\227n\030!x\373\312\221:\n\317\256\230\371\300A\355\311\340i\350\320\2409>'g\346d\342\325\203\223\213\352\231\266\2647\342\005/\223JQ\200`\247:N&\205\n\2023-\205-\264\250\217I\245\nh9\245\272[\332\303\247\365\262\255\264\307\001F6\247"
+	.string	"\214\331\231\033\213e\322Z\373\242\325\303\2009[\212\225\225nm\331\007k>\276\226\376@\357\275A~\227{I\203\244CR\")\021\363\245\2650\300\310\274\212\001\200\216\250\201<%\rsJD\202\024$I\n\215\001\300\002\021\2412n\0208\207\212H\2224\006 \345g=)\006\230\330jA\250\001\013%\331\016E\362\373m\213<yR\271?\264\021\331\235dm\bn\324^\003\r\304\271\276\0310\350b\005\270\"\271u\317\306\240\021\300\200R\207\244\265@\007\316x\201\026\036\3665X(\314.EC4[\225\350\364\315Zn\341\356\266i\224\237`\273\035\227\213\312\260\260-R\020\216\232;\367p_\204\210Q\376\001(J\274\363bd\261\304\004\335\355lR\274\323\017C\271\035\342\223W\177\213T\036\214i\250\350\264"
+	.ascii	"\327\314\355\376'A\\\223\207\036\247)\243\214\035\236O\324X\202"
+	.ascii	"\203\"h|\224\217\032\333\032\240%\241\347\242\225E\325\305IM"
+	.ascii	"\232K(-\365d\0045oLHL\b\252\216\026\322~\371Nb\221J\222\212\016"
+	.ascii	",*\333\314(\357\337\214\310\230M\374\255\371\216k\313\231<\243"
+	.ascii	"\277\311\035D\274\342\311\311yE\374-P5"
+	.text
+	.section	.gnu.lto_blackboxUpdate.165.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\007!\205z"
+	.string	"\n\267\314(O0R\332\031\003\253M\234o\322.\272n"
+	.string	"\314\033\221k'nADp\177\017e\273\331CDe\335@\005\237\350\251\202\r\251\277\030\362\355\326\324.\b\024@\004\021"
+	.ascii	"\3030\f\016\025\221\226\214\b\211\025\315\212.\323\231\211}\325"
+	.ascii	"\356\356-\245L)\245\202\002J\002\177\0021\316\301\2423[t"
+	.string	"^\213\316*\321\371\207\316.t\3566\322\210\003{{\"\305\3728\350\033d\372\367FW+Y\315\245\233\255\203\376\314=\327\205\027\020C\366\320q<\272\013\0179\241\300\271\365\233\333\\v\354$A_\247\233%9(\223\357}\217\013\b{e\250\260kX\036\314ml\214\245_\247\267\231\344\244^\356\336\367\005\352\225g\b\327\206\230]\3244`\356\361\245\205\245\235\265\360Dg\246\300\024+u\314d\024\025\005\270\244\275\357[6\324\f\343\365\276/YKY\241\241\334\316\346\324k\005\346\261\005\314\322\304\364\220$\243\336\367}\322a-4\224\377\312_\013\314\255C;q\241\241\274^\001\364J2\337\367-\366\312\354\002s\261W\020Efngnf7\335v\302\300\303\367\245rRy_h\020\307\020\366\272\3236l\257j\327\260\275\262\313l\327P\253\267\2044\311R\030\337\373\276B_\005m\025\332Lt\267\0218\300"
+	.string	"\002\006\220!@"
+	.string	""
+	.string	"\b\305\b\202\001\364\342\307\205O\213\036\026<+T\354\244\320\311\301Aq\302D\211\033\0226#jD\204"
+	.ascii	"A3#\023S$\016\207\204AvU\337]n\177\306\201\275\355\320d\324\b"
+	.ascii	"\034\360\344s\003\bpR\347\003\2506=\324@\367\"\271&\204\316e"
+	.ascii	"\b\240\312P\342\213\212\351[\342\322[G/\036\300\2279\007\300"
+	.ascii	"\0079\326\346\006,I\232\352(}!i\307\220\262yP\333\026\207!\006"
+	.ascii	"\264\366BM\213\377l\035\263\270\013/w>-\306Z\255\341\307\224"
+	.ascii	"\356\341\301Y\224Iq\23622_\021\254\001A\325\\\224)U\021\254A"
+	.ascii	"\3454\326;Q:\205j\002\212TX\273\035\237j\213e\364\253\343\242"
+	.ascii	"\270\316\230\323s\306\232\216\203\342\313O\230Xz\t*7YN\302\212"
+	.ascii	"\215\022\037aV\223\304E\234\205H\003qe\3454[nG)\237\t\326P\353"
+	.ascii	"n\222y\036\361\030\365\235\210\241\315hz]\365\326\021\312\213"
+	.ascii	"j+\204\251\335\216Q*\r\243/{\335f\304\211\301\03268\025\351a"
+	.ascii	"\037\025\351\241\235\255c\237\013Ul\035\221\036\354\265\346\371"
+	.ascii	"\021e.\331\036\276\252\240rZkU}qWE\257\335\216k\252M\020\034"
+	.ascii	"\214\375l\367\321\224\344\237\266\003\263\211\027\016X7$\227"
+	.ascii	"\224\210MH\254\252\367\224\245\251\216k2\036\254\361\276/\273"
+	.ascii	"\261\311\2519\201fV\321\230\331\001f\234hUemK\201G>U\371l\357"
+	.ascii	"K\313\360\225\334\315>\273\300\r=\022\032\330\3407\025\330\\"
+	.ascii	"\fgh3\026\226\331U\272U\336\306\340\373X\336\225h\222\360\225"
+	.ascii	"\314\276\372E`l\314e}\366\327\037z$\221\266\334e\217\334\022"
+	.ascii	"7\213\205\234\326\372=sNV\253\270Wcy\\?t?\2338\305\310+\275\013"
+	.ascii	"\276\222\233\373\213ca\200\254\223F\335\370$~\203\273$\241\304"
+	.ascii	"\257\334\254^\255\036\320\210\347\343\334k.\227\233\203\267\361"
+	.ascii	"\306\253Q\334\266p\273K\266\327\330\355r$\356\322\306\352}\337"
+	.ascii	"\002\330\251\274\006\367\213\033\253Wv\233\356\323}\262\275\266"
+	.ascii	"\3103>\240f\227\362)\006\032x\340\001\266\327\027\220g^a\216"
+	.ascii	"|z\304Nh\365\036\337\251\265&B\031\242%eI`\377\213p\2349\002"
+	.ascii	"\t\274\215\377=\227\007\325x\375\223G$\272N\200\247W\302\231"
+	.ascii	")\250\300\333\310=\207\367C\024\351\215b\246<\220\2519\254\216"
+	.ascii	"\357g\013\361\300\274$y\037w\347\260\376:\236}\t\211\344B|\310"
+	.ascii	"\005\031\330\260\301\366\352\257\002sM\332>4\r\221\227\357\316"
+	.ascii	"\310\001}\226\034y\362\257\364&v\247\230, \354A\212\200G\264"
+	.ascii	"|\260\313@\374\323\212\201\235ih\347J\354=\204kQ\246\227\037"
+	.ascii	"\261"
+	.string	"#\005\375\276\246\354/\253F\205\351\365\307\r\270\372\025\221r\367\251\177z\334{\237\226\307\035\306{\352\225\222i\275Sw\334`\330N\330\275\201R\220\f\312\364\262cf\273\337c\032u\322\215\357\217\372&=\220\271\2774\335\006\334X\314\301\ro\343\r\266\327\376\n\340\230\311&\362\310\247\314P$\177%s\377t:\255\302\217\204y\350\254\203\350\234\243\350,\202\3209\004\031g\020h\234\211\212\3167l\264\263;\201fk\016\022:\303\020:\003\t\235_\020\235\177\206\316.\210\316>D\347\026D\347\236\2423\213\2423O\321y\005\321Y\205\214\363\016\3219\005\321Y\207\350\234Ct\306):\243 :\237\020:\233 :\227 :\337\020\235I\020\235m\210\316#\210\3165Dg\0213\316!\212\316 f\234i\212\3163Eg\231\242s\214\214sQ\306\231(\343<\034:\013\0039'l\370L\267S\252\264W\274\215'"
+	.string	"\243I\306\376\331\223\342\\\340&\236\271\205\026\r\315\304\0175\377\244H\024%\262\224"
+	.ascii	"\263\324?{[\242'Z-\317n S\232S\322;\2447\272R\006\244J;5}\340"
+	.ascii	"3q\323n\271\371\236\333\343\212\"\355\031\361\244%\264\304+\371"
+	.ascii	"yh*\335\263\004\n]\262\031\245D\226\302\r\037>\331M%\2317$~H"
+	.ascii	"\257Q\3327\261\260\366\r\354\237\264m=\264ooWH\274N\322\2075"
+	.ascii	"\251\033ui\221pZaZ\371jb\305\253\313\212\215\3153\341\n\372\255"
+	.ascii	"6\216\215Z\362Y\355tF\363\254\205{\034^I\033\327\310&\032\026"
+	.ascii	"\033\274j\353\254lh\353\220\274\262\235\373\322\326\325\211\331"
+	.ascii	"\274N\362\013Z`\016#^\311RfG\314\242\214\230A=\322\254&\255\314"
+	.ascii	"\255f\304\017i\356v\312\372?\265y\357D\303\352\217m\236\360\201"
+	.ascii	"|\220\326\007\265\005\323\346\261m\036\333+Ps\224\021\257\223"
+	.ascii	"\214c\276E\364\272\374\270\246D\274\222\237\251\351\227\224|"
+	.ascii	"\217W:c\267\353\221\376\350\254\333\312\rL4\304\3374\r0\355\317"
+	.ascii	"/M\312\227\006\242\306\313\003\336o\267{,s+m\375\274\2155\357"
+	.ascii	"czCh^\351FZ\004\003\336P\317\303s\221ZJ\220\203q\225\330\250"
+	.ascii	";\273v:\2039\345c\327"
+	.string	"\310\353\\$\037\271\367M*\200a8\235\253\324\310\346\023\257^\277\260\0044\324\345\\\0374V]<\256\237X\275o\217\346:\250sq}\b\337\267G\033\331\335\374\315]br}\370\2402\366\303\r\342m\024\361:\311\347\337[\304\217O\n:#]\213\321\344j\214E-KZ\037\221l|a\\\331\255v\206\205\355\212Z\023\241\020y\245/\225\307%C\326!\276\267\300\346:\360*TB|O\031\017 \326&\314\275e\227\230W>\26148|\007\367I\370\276I\007\260G\3611w\210J\304\205b\241\330^i~\306\234\225#(a3\337as\316#\237\276\226\251\f\\\305W\262\001M\2066>x\303\020P\007\275\017\316\241\203\336\335zK\027\225\016D\231\007s\227M\347\244c^\346u\340\236\356R\350\214\371\246\273r\302\350\240\267\361&\304\225\241\025\237\331F<\267\031`\211_\374^\022\277\267\230zK\244"
+	.ascii	">|f\367\210+\265\223\364F,\374\341{\335R \315\013\277\333Z\203"
+	.ascii	"D:x\354 *bs\364\216\013\210t\344\260@\005\023\210\212\212x| "
+	.ascii	"\303\037\304`\341\004\034$|"
+	.string	"\340A\t8\204L\310\341\201\016\241\017\212v\b\305H\301'\240@T$\244\302\t'\024\t\025\241G\255\276\217\204i*\025=z$V\2154\327P\021\030\013\364\273q\342jr"
+	.string	"\214o*\034`\374\013O\266\245*\325{Z\322;\003\260\204X\225y\205i'\255\022UW\3142/\t\0019\036\307U\216o'\315\343\364D\256\207\355e2"
+	.string	"\220\227*\2403\031K>\027\210\2458\006\265E\200\027H^|\013y\232I\221\b\314@$/\200\237o*\246\237\367\261\300*\352\221\356@f\224\361\260\262\272"
+	.ascii	"\360JV\247X\245!g\372\245&\331\211L\223Zj\024\r8\244\214\251"
+	.ascii	"$\017d\346\326\207Z\304E\022\262\212T\241\332\037\034\244mjb"
+	.ascii	"{u\361\303\247\2770\311\246\323\321\224\202(\021z"
+	.string	"\345\f\315\344)\205/\214Y\323\253*\206\3177\225*\304\247\347\351/\232l:\205=\005B\265U\337]YP\213\3071\244\305\3130\245\r*\275\253k?\030\257d\025\210\030\021\277\246a\233\032\022\250\347g\232@\365|\220\313_\274\222Y\374\212\177\273\216\302\363,\036'Ler\227}\246\306\340f5\0269u\211\347\373l\305\367t\n\351\215\372GE\221\357\034i\245\274\215*~'\305\357|\253H4\244\370!g\233\364\330?}mQ#\007t\321\366i\361yb\321Z\361\305D\327\342\225\374\323\007\034k\"\224\036\235\227q\372\221PC[\245\363\275\345\312Y\344\374o\275Z\347|\203\231Jz\243\346\301\371\"0/{\317G\202\262\255\252b{\305\371!\247\331\022\371\243\177\372\276V\\\205\030\353\353R\261C}_*\032wN|\312#x\002J\332,\270+\257\364.\t\310\343\201\360wK\\\352\355\030\340z"
+	.ascii	"\204\357\271\006j\202\202\305O\307\203k\0309\340\016\221w\227"
+	.ascii	"\206k\273\372\006)\f\2236\316t\273d\271\343\332\257\266\271\276"
+	.ascii	"\321\036\220,)^\311\335.X\021\036\007\030\033\315t:\325k\027"
+	.ascii	"l\b/\002\\\b\337q\315\363T\306$\331D&\360<:\303\244Q(\236\271"
+	.ascii	"\325\241\341\334\245\215\234\021\357\243\337\203\273\004k\303"
+	.ascii	"\302\330"
+	.string	"^Q|\303\365\352\344\f[\"\207tUKtZ1\226\350\327\222S\035\362\336\346~\355\267\264b\355XK\346dl\257D\337R\332\347\r\215K\202\302\250\022A-MZ\247\020\215\210\210$I\222\341r\013\020\206BQVkg\007\022\340#1Ht\22294#$MA\352d\232\003 \232\306\001\251\251\262\223\353[\235q\310Ghv\263\200\020\230e\200\013\007\365\265(kT\354:\260k\301\320\343\301\260\307\031\350\330%\027\276\244\300lL\032*\026\304\017\177q\201'\244\001\201\316\037\021\3452\024\321\350\247.\2451\002\316]\345r\255\252\232\375w9\373\342\311\350<+f\355[\233\262\243\212\330\n8\372\f\\\313\253\345\231\326\303\313\341\252\035\016/\003-K$\267\225\214\277a\350\243 \356\277\005\262\272\203\360/\006\227\234\037LV#\361\342O\340\020\3749\2142F`Z\234p\317\006\001\324%[\202\351\363W"
+	.string	"\321\367\207rpg\017\333\013\355\2504\361#\206\254\326\266\251\002Z8\026\f\272\330\213\201B+\360\t\0232\033b\255\t\357\204\343\005\351\017\005\004R~\271A\353\236\307\3635\026\035\312h\270{JX\037\3466_\333\324\004g%\325\263N\242tMR1\330\t`k_\227\224\245h\217ST\350g\177[\263O0\334bc \007g<"
+	.ascii	"-\213/\223\232P\223S\247\243-\203\370\274 .\233I\364~\230W')"
+	.ascii	"\\\215\261TB\266\265\035V\233\f*+\302vx\202\262i\273z \213\301"
+	.ascii	"K\316^VH\276\345ko \307\314\272(\001Z\350\037\241\240\374\274"
+	.ascii	"\360\f\222OD\3435}\343\263\342\373\353\177tx\354\260\002\332"
+	.ascii	"\027\260\257\366\005*\206\351\232\340\2205\001E"
+	.string	"\247\370u\335S\325\220Pw\271T\334\326\360\017\346\036$&Lp\350\f*m\362\366\345M\r\272\337\257\274\325~s\372pm\304\325\004\263:<\314_\246\325\331Xe\362\212}6\201?\361\376\250\035V\2162j:\3004\343\317\272\257\0346\354S\272\367^C\266\2258>\0252\330\226\035/4\344\355\017\025S'|;\237Z@\315\323\345\350\244l\f\252\330\212(\022\260\336\257G\367B\"\277\253\260\242?oK\201\304\253\247#\331\030\177\346N\344\265\\/\230\034\200\216\216YD\363\265EM\024\020\337\301\323\222\312\203`%\271X[MH\371\030cZV\326-\355}\251\306\362\2113\3477r<\357\215\252\234!1\357\233S\352:\242\342\201\337\247(\350*r\237#9\210\020\326\031@+\335aN\343]<\262\0044\302e\226W_k\023\r\254&\270\006J[%\362[\025;\242\237\225\020\260O\301\245F/b"
+	.string	"\375\270{dp^\335\360\251E\"\256\274H\332\n\030&8\320\313\322\312\377\242\354\340\223\311\322\251\001\310\264\277\3629JJ\356}\001\307\314j\265\005\225\030m\324\235\036\035jR\273,\273%a\023\202<\024\267<\367\306\263\262Y^\334i\325\260q\033\342?\227R\026\326\001\314\303\373K\250+\334\315\203]\320\371\200\216\236\020\2502\007KxH#\260\221\301\202\303\271\3208\220\217\251\324V'\020yy\243I\031\241\034\337m\370\220\373D\360\276}m\3007\254d\364\255d\244,G\252>\n\332g\371\313ub\260\031\200\225-Vw\364\222\034N\216\204\317.\342\206\036\242\311)N\250\231\367\242\"\225\037K\217\030E\345\354\273"
+	.string	"h\330\022+"
+	.ascii	"\005\242@g\254\310\251JPo\247\304j\220\253\\9\301\240`E{\242"
+	.ascii	"\"\307\205;\036\3605$|)]'wb\3573\342;j\251\224\bLM\353*\337~"
+	.ascii	"\373^\234\230\303\323\321Y`\rkq\375\"OD\233*&\257\3656\365\271"
+	.ascii	"\255*\271\n\242\257+\327=c\rJ\254\310\f'\004(\271_\353\003\205"
+	.ascii	"\372\031\206\034\004i'1\242\335\371\365[\3047\246\017T\030\224"
+	.ascii	"\320\353`B\333\027|_\004\225\313\366\313k\316D\244l\344\324B"
+	.ascii	"2\224A\030]\306\277\377%\350\3362E\262\377l\020|\347\326v\341"
+	.ascii	"!Q\205\201\256@\352\n\215r\340\326\241j\263\235,h*\003\n\r\302"
+	.ascii	";\257\177\210 !v\213+\370\337{\303W\3673\335\275\365p\026\247"
+	.ascii	"\250:\311\227\212\337\355\254\371\357\235j0\376\"\016\347\307"
+	.ascii	"9\264\353\314\362\346$\036\321%=b\334,\317\t\"\207dj\330\370"
+	.ascii	";\210\361\220\\ \320\272\b\256\351\242*8\350\304<9\322\343\033"
+	.ascii	"\277\367\250\006\303LG\353e1.\217\346OY\357Y\3425\016#s`\323"
+	.ascii	"\344\351\210G\334\226\236\321\272\3235\337\262\321y-\346\277"
+	.ascii	"\320]c\034 \2514^D0\301\035\371\217\365\005\242\203\005F\235"
+	.ascii	"\234\326F\252\377\225\375\002\363\313jF%\273\351j\023\363\237"
+	.ascii	"\306`\007BB\016\206\fO\332E\032a\240\221\231\321\367\322\363"
+	.ascii	"\334\205t\024CS\206\270\364:&\325\266\242\315cY\300\004y\323"
+	.ascii	"u\242\334\020g$\244\214\277\247f\207}\371\230\303I\032\350<-"
+	.ascii	"\3032\371`mbq&\rb`\324!"
+	.text
+	.section	.gnu.lto_blackboxCalculatePDenom.166.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\325\t"
+	.string	"\246\322B;0\305*\035\236\313\371\207\201\320\363\353\221I\304\302=\341\355\205\323$\006\303\305\342\210\343.#\313\340c7\030\361\270]\364.\026\262HY\247\252PF@\311\267\003h\237\220M\244L)2"
+	.string	"0"
+	.string	"."
+	.string	"\206e`\007\253 \004\240z\025\330]n\363\214\366\230\235@{T\216\177\317\317\177\311\033T1\001+\226\351\271)\354\256s\305\272\270\365\266\rl'\330\317\004\361i}:3}\213\206@\005\306c+\273\026\241\201\035\020U@l\1776\306\006\003 <\3572\314\227]\r\224\224\335=0\307\362h\333\0379\311\347QSU\237\nAe\350k\352U\007n\362\023\222\377\341\211R~U\322\036\257\032\217\214S\2066hJ\335\260\237\255\266\354\247\267\203\277v\327\037\241N\004Z\270\204H\f\240Q\307\333\374\341Pt\236\207O\007\302\303\211\034:!\356\343Ip\034\215\273\b\220\307\215\272\316\3430\340>[mm\2729)\312\232\252n\032_)\221\021"
+	.ascii	"+!\201\245\236L\350\f\n\\\374b\201\031\314\320S\004\306.\327"
+	.ascii	"p\020Z\300&\204\003\346@f`DP\001\007\240\362\230\332I\006"
+	.text
+	.section	.gnu.lto_blackboxGetRateDenom.167.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375 \373\305\006"
+	.string	"rL.4PO\222\016\343"
+	.string	"\"k]\3431\317\256H\257\006R\201\3400\212\245_\310\266\255E\033\330\346\343h\0376\236\231%I(\016\340\265B>\243\266e\261\331Md\nO\234\013\312\3430u\036</\242\241\003\361\246j\342q6S\022\f\325\243\240\250\352i\264,\216\020\tB\210q\021\261XLIZRqC\266\370\270f\225\356\007\240RQ\240#\344\266\327.\207\037\337L\342\350w\243s7\263qA\341(\314\226\251\261\275\344\212\224\"\362\203^3B\002hk \343b)\330T0\223\226L\355!H\255:\353v\244\013X\314I&\272\352\002\0242s\227\2116:\3667\370\017~\217\n"
+	.ascii	"`\251'\0230\2013\3348T\204\272\3175<e\304[B\220p\347L\355|\002"
+	.text
+	.section	.gnu.lto_blackboxInit.168.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`w\004\365\032"
+	.string	"\366\354\237H\260XQ:\325\227\022\345\013\205|.X\016`\204\222%0\274"
+	.string	"(\366\243\365\347K\332\361\324\200\325\350\311.\265\326\037\236\034\007\035\033\277\332\030w\270|A\341h\377\177R\347\030e\234\313(\017\336<$\226\220\275\211\224I\006\214"
+	.string	"\205"
+	.string	"\211"
+	.string	"cQ\031\337\212]\235\005\244\334\207N\304\342B\013\201\267D\310\347.\213]\362\263\311\215\355\366\256\003\252\004J'\233\221\257\326\252j\036\217\235\034SbH'\330\034\333\207+^\322n\t\tNv\222\350\307\215\341JwP\207\f%\241'\037\236\033O\201\007\260\354\330@"
+	.string	"d\247\006\213\b\302.8\031_h\215\247\215\304\271`0\\\371\360\344\336\001p:\340\201Z\353\203\3161p4\346pUk]\276\341x\276"
+	.ascii	"\276\273Gv\327\301.\210\"o\260T\372z\206r\r\276g\362&\037@\330"
+	.ascii	"\330\330\350q\362%\335\3148\345\236\344H-XO\317\207C\367G\216"
+	.ascii	"\004'DN\016\375\234\351\345\356\242{\243\037\271\366=v\304\213"
+	.ascii	"\177{\321\317\357\256\340\313\230\246\036!13.wu4\356\237\335"
+	.ascii	"\203\265w\354R^\222\362\216!o\n\344\025)oHy)\345\235\223\027"
+	.ascii	"\004y\273y\271y_ \001\217&\032/\215\324:\243,S\225f\023\037\273"
+	.ascii	"\373}\221\357V\\h\003\264\303\036\300\364\242\254\021\241=\374"
+	.ascii	"\322\221O\314\352j\255\324\300\027P\356\206\372g\377,\355\331"
+	.ascii	"-vV\270i\317'\266\037\330\263\005\300x\241\305\366\003\373\207"
+	.ascii	"\206^\241\251P\223\202g\344\343Z\253\254\027\003\005\233\265"
+	.ascii	"c\322a\250\335\275p*\030\304Zu\"\354\245|J\206}\217\317\325\260"
+	.ascii	"a\003\375\004\033\3063\032B\324\275\207\362(4\034j"
+	.string	"j\350'G\335\300pw7\222\355\327\207\252wQ\356\327\210\320\270\\'.\017\257\367\203\002\333z\240\342\305r\265nD\260T$rnF\250Z0\023\252\007\006\366U\002\007\246:\361z\301T\244nv\260\366\216\035}\212\224fM[\262\311|\b\262\341\337\352\367\t\035\233\354\327\200\320\306\031\204\227D\323b\344Gn\030\240\245\037J2\216\032cCt\337\273Sl(V$A\002\375\354\220\353\362\204c\306eSO\004\252;5Ge\360y\335\307\243\033\365\311\213\214\243R\024h\252Y;.\023\316DaK\252a<%OD\242\330Y~\003\023\266\330]\305\366\233\035l\250Q@\007\2251\2042\222\202$\2514\006\220\002\221*#7\021\320-\223f\244M\373o\340\375Y\217\222H\333\3108Y,\341w'\022\024\317\026\251]\f\220\373\020S\322\024X\r\001D{\317\272\3638y\246\257\227\205\306\353\273-*\300"
+	.string	"Z\035\344\216\037\352\224\004}\354\273dq]\266\2440\347\377"
+	.ascii	"\267(\364\243\001\255\220U!P+>\357\244uSrt\311\"\207!\030\te"
+	.ascii	"Y\230\f\"\330\245]Y\203\237\334\177\344\211\024\0050\031\360"
+	.ascii	":zvj\030DY\t\256\371$\002\367V\304\027b-\224\237\241b:\240A\215"
+	.ascii	"\030\360\237\320\305\277/!\352v1\301\004rL\335\013G\032c\377"
+	.ascii	"\225=\250\037\2045Y\2326\013#\250\204\243.\265\264\211\214\265"
+	.ascii	"\252\006\311\303v\326\311l\337S\003"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.part.0.276.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\225\013"
+	.string	"\306\024J>0k\225\016h2\337\256\013\312*L\322\200\357\203X:LWM}#\277n.\345\360\n7\3139\037EjM)\354\353\304\224\031\024\035\340\004\305\243\251\261`\206(k\350\343\372\223\275\245L)7"
+	.string	"4"
+	.string	"9"
+	.string	"\241\213\227\202\022\013\266\273\333\24328\350P3\202|\b%\322y\241\303\354\274\003W\b\217\004)v\367\251'\001o\224\031\361\b\241\354\256\035\020\334\332mc\330\266\260\237\t9KEY\343\341\352\311\326t\204i\250i\315tf\372\017\371Mb\273\005f\261]\020+@\260\237\372\330\022\311\343?\333\037\333uU\2035`\220\355\222\020\260\001\206\032\365%\231\210\365\t\030\r\307i\217P+\034\230T\223U\222\245\256\276\241\303\360o\264k\352\007$\030\345\314\276\204\2536\376\003w<\371\356\321\367h\217\327\214\257\025\301$\n\276L>8\013\346R\311X6\216\215\212f\273p:\333d\302\\\207\006g\363\3408\316&\261\235\327\223#\256\327\005\221\216\240\242\274\321("
+	.string	"\370Z\260\f\372\334\335\220*\312QU\003\254,\220RC\036"
+	.ascii	"d)Og\b\201\301,\237H\301\n\204\200\301\301\017\t\326\341\214"
+	.ascii	"\201&\260p\026\334y\301\342\323\020Xl)\316@\225\205\200(\030"
+	.ascii	"\346\nw\207\t\2023bQ\347\002\323\235\006\206k\257(\\\232\232"
+	.ascii	"\022\334zm\031\003"
+	.text
+	.section	.gnu.lto_blackboxStart.part.0.340.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`E\004%\032"
+	.string	"\266j\232K\240\326Q:\225\241<4\277D\260\0162DW\304w\246V\032\370G\003\266\236>\245\332^\020@Y\374\207\336\250Pm\203\274\261\007\253f\013\226\002{\3505\310k\343\367\300\2545`\225\270\037\253\240\311\373\254\t`\"Q$\204l\231d\200"
+	.string	"\207"
+	.string	"\205"
+	.ascii	"|\003\244\225O&\275\027\267%\313MQ\372\200\301\017\336F\321\201"
+	.ascii	"\f\223v\035\213\230\263j\256\353\t\215c\031\035\3103ZC\214\370"
+	.ascii	"V\277::\220u\264\354R\337\275\367\210\344\377\220\230cb^~\006"
+	.ascii	"3#1\017\1775u\241\3302\017\t,\335\363\301oJS\326\361\336\033"
+	.ascii	"{YY\334\2766i\371\215\346\316\327c\275uC\033\223\033\271\250"
+	.ascii	"w\200\223.7\367^~\tq.\317\314\021\230\271\206\231\354\021\315"
+	.ascii	"\\\301B\355'_%\204\266z2\337\311V\023\341\227(\3513\020S\b\022"
+	.ascii	"\255#5/Bd\007_\b\317\201"
+	.string	" :\261\037\007r\001\303\316\0167\270\017\236\001S\367^\b|\036\357\221ACO\217\371\022f;\006\321\021I\275\205eZ\300\331\210I\363\003\257#\b6uo\022\216\347\220\361_\274d\240\240>\032d\n\r\365Q\376\3570\301$B\257\"S=\273\362\270\222'o\3351\003h._\232I\227\346j6w\331\001\315lQX\251>Z\353\177\277T\223\225\"\315\371Z\376eU\254\260<\236\211\224x\304\302\202\250{\327\275Z\320\322\341\021\307\274\202\343\"\007\301P\307e\251L\276\361U,\025\f\333\353\231/\177\365\005T\256HI}\\]\371\304\027k6\206\255\262U\346\313rKA\303ne\230\314v\206\375\365\321\256e\361\313J\250TON\320\314\022&t\260\n\017\257\342+\037\312\243\340\360_0\205\234>\232c\276l-\324X ,\263\3710\373\031\222\371l\370\211u\020\362\341\020\223\321j1\233\031\236y"
+	.ascii	"\242\305\210f3Z,\206\274u\3077I\325\306\265V\0363\367\355irC"
+	.ascii	"u\316\2366\273\264\324\253!%\375\235\250\231|b?\325\232l\025"
+	.ascii	"\326\031\344\262v\251\217\253\2547{s\262\270>j\004\321N\366\366"
+	.ascii	"dq\270J$u\304\213\254L9\333\203A\321q\333Zi\006\264QVD\r\t\363"
+	.ascii	"%Y\277\002K\360f\242V\276\261OKU\302\366\352\026jt\020r\250\201"
+	.ascii	"0G\231RB#A\222$\205b\003\240\002\221A\343\034\020P\311F\205t"
+	.ascii	"\240iY[N\252VI\346\242\253\355\005\256\321K]\247?9@\304\t\220"
+	.ascii	"\024\033*\336\215\332]8\344]\213&D\3153\273\365\231\t\226\334"
+	.ascii	"\021\320yB\355Ox,EU\"x/\313\031n\003\206\353\333w\f\020\365+"
+	.ascii	"\\\026\344A\236\r\020g\020\3021\361\334\266\237\t\326\265P\211"
+	.ascii	"\316\204\277$\362x\214\375_g\3153\217F\254\351\300\022\342t<"
+	.ascii	"B\220\016k\216?p\261@\t\215_\016R\260\251\2249\013\267J\013\340"
+	.ascii	"\321\346\3256\214\361b\266\375\343\242\317\r9\350\001<6\n\354"
+	.ascii	"v9R\354\026\032Vh30\273O\007\243M\021G\371\355iz\213=\256\267"
+	.ascii	"\003\300j\252\310\352H\217\032*"
+	.text
+	.section	.gnu.lto_startInTestMode.part.0.342.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`!\001\345\f"
+	.string	"f\327UC\020o\225\016(\243xA\212@\240\240'\365f\017\225\276\215|\t\241+*\321w\006\003\304w\007\374\203nV\214\245\232o(\300\240z\177\374\001@\251\b\031\211\300U*D"
+	.string	"\025!\324\205\256\217\310&{\247\024="
+	.string	"A"
+	.string	"I"
+	.string	"\313I\037\206\2629\356\364\"l\243l\222\327q[\026m\222N\302\246\fx\300\240 \022\333]\357tv\270\370)5\321O}V\\\030.\005\\\233dv\327\224\214\233\336v\001\333\013\354C\b\257J\006\331\004\215\330n\365N\245}?\344\035\276\2109\020\324?L\262\253\373j\035\346\203\324\223\020\377a\n\260,\366\256\026\036\262\222\335z95\206r\352z\002\333)\345\003\266S\237\336a\213l\305n\337v\372\214\261D\b\027*9\363D\332\241\003y\226\017\373+\214\270@\274(Y\315\224\234\034\236\332\265\235\033\266\246\245\260"
+	.string	"@c\367\302,\306n\240*><\344&\\\322VC\035_\023\0163\024#b\033\241^N.uu\f\376\220\300O\301(L\320\021\035@\320\361\200\232O\330\231\203y\360m@\034M\203\215'b\240\ty\0340\3640\026\177#\017\350\221\276\017\3648\333\362s\303\031\325\\\315\311q\320\346\217\374\004\310\367\340\320'\317:\365\003\033"
+	.string	"\\\tT\323y\262\350\207s\006~u\0234\326g\002\004D\3010W\270-+\004\004!\211\021\"\005\"J\2058\352p)\003.S'Z\350&\b,\352\006`\272\323"
+	.ascii	"p\355\0017ZD\277\253\214\001"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.part.0.343.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375``\b\275$"
+	.string	"\326\375\327G\220\332M:\007(\320.d}\235\222i\210\005`H\350q\227b-]\357\216\b\265>#\b48ds\0165\005"
+	.string	"\366\205E$&\221DBb\270\314\b\363\2359\265]\026\033\023!\247\203\332\326\326\214XB\310\226)\005\277"
+	.string	"\255"
+	.string	"\313"
+	.string	"\027\203\262u:\323}\030\024\261\306\240J\276\344<\223\024?;ujI\013\005\346I\023\315\335\023\241\236\344i$V\254+\357\332Gr\260\363I\236\214\253U\307\224*\265\022\023\234\264\220y\362w"
+	.string	"\345\311\361>\345I\373GlC]\371\264\321N\364Q\177\322\240T\205\305\251\265\006O\322\036?\277\323\345p\346\255$G\272\274\323_+\254\250\357Ll\351Ld\345F5\027\270\002\346\215\3506\376\310\\\325\030\177\265V\035V\325\226q\276H\022k\276\306\033\221\330\3152ih\332\350\210\261u\252ecjE\026U\016K\2524k\255\327q\265en\317y7\242Z\253\257\202\353\356\335\266\034\333\017l3@X\272\326\206\324\256\n\264\342_1\232\371\247\262\212\351\243^\275\253\246\211\031\362)\266\321\032L\331Rk\324o\330\037[\253\n<y*"
+	.ascii	"\216\224\232\265m\336-\245\277\245\224^\354A\\^\252\332Tl\321"
+	.ascii	"/\376\251<]\352\255\252!\265E\357\326aw\226\322VZ\332[\371b\377"
+	.ascii	"\217\262\"dS4j\251\227)\357c\255\265\232\362\260\313\265\317"
+	.ascii	"\\\373\224\353\236r\315C\256w\310\265\216\271\356\341\326<r\275"
+	.ascii	"3\327:s\235\273\255q\345\332,\327\267r]\226k\362a\377H\256\351"
+	.ascii	"\270\336\023\377\003\255\221\003[\265\302(\316\251]\344\025!"
+	.ascii	"\266o\007K:\272\243_S\325V_T\346\250\216\376\260Q\335\220\332"
+	.ascii	"b\222\215*Z\260\325\210@\216^\313\220m\215\376Wk\275Q/\217(q"
+	.ascii	"\324i\311\331\324:8\333\b \b\237c\344\303\321k\r\331\206X\016"
+	.ascii	",K+\315\b_\223\3608\023L*\034\302\371r`\031\030\362F\341jnnt"
+	.ascii	"\350M\226o\313\noc\341l.\224T8T[#;\260,\313\350[\222\332\030"
+	.ascii	"2\330\032\276f\303\316>\272\032$ \263Z+\2034'\222\374 '\375\024"
+	.ascii	"\345I\222\n\207n\206`U\37620\262\250e3\275\211\265VJ\275l4~\024"
+	.ascii	"\243\231f/\314\370g\204e\324\264\306\370d\006"
+	.string	"\220\235\201\361\303\350|IC\343\342w\351mQ\263\312\342k\341\005\376\320\004\342\347\241\351\327\201\t\202\356\250\304Q\207\261\004S\322\211$\322HB(\2328,!\035\201\340\020dR:\n\021Dr\"\021\024\"\340&\021IN\301\022MMNA\335\307Jy,\225\362\307n\242q\347\363\241>\3721\031{\243(Hc\271\316,\037z0#ck`e\016<+\242\333-\202\177\t\367NV\353\344\032`V+\325\255N\034&\325P\320\231\343\334\361\344\f\007\331\315\016<\343\312\365x\355\f\031'\220\036\332\240\tO\217\215q\376X\254\023\b\220\031\017\025\032\t[\333r\340\231\f\034pw\204\234_D\366\305Y\304\205Q\220\331\016\035*r\321\351Q\035+\026\275\342\3204\260<j\237\303\363\310\211d\251L\245\267+\214\200|\360\350P[\026\230\212\035\265\225\002\200\244\250Q<\004\235S4\"\201\210$IA\322\001"
+	.ascii	"\003\221\031\332\346\021\3008\306\250\241))L\263?\007 \220\342"
+	.ascii	"\353&\344\2611\322sB\362\222\262\b\377\"\240\001\361\037\205"
+	.ascii	"\016\270\f\217\001\003\344&-\370\327\020Bl\225\325\337\223}\362"
+	.ascii	"\246B\321\020rY\273\213\334\222^\"\345\035\005\372\310\221;\312"
+	.ascii	"\300\207\243\211<!\035<\256^\364\322\352\001\361\334!\274\254"
+	.ascii	"%\206\260\b\315M}\334\233X\241\037\t\341\216\326\200\272\255"
+	.ascii	"\304\226\315\275g\322\031\233\246m{\243\225@A\333\317\215\265"
+	.ascii	"]p\036\371<\033\007\232\325L\003\261\020\347\320\304\214\bl\023"
+	.ascii	"g\024\016\207C\031\202~\250h\341\t\220\335g[\\\314A\r\225=R\305"
+	.ascii	"o\232a\265n\216\260\362\237d`\345?\311H$D\334\321\315b\246\247"
+	.ascii	"r\370\317)\272\033\016\304\241h\263v'\t\255\220\273\272\271\032"
+	.ascii	"\030H%\2100\334\260T\217\024s\270\262\260\313\263\361\231\256"
+	.ascii	"\230}y\355\263\207\332\371{f\205\344\353\313S\305\001\304\002"
+	.ascii	"\323eO\217`\2641F`\211\203OQ\027=\004I\035\025\317|\177\347\263"
+	.ascii	"7\343\311^\230\006"
+	.text
+	.section	.gnu.lto_blackboxFinish.part.0.346.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`N\001U\r"
+	.string	"\346\326R@\020O&\035\343W\036t\242\311!U7@\036`\362_\370\340\177\002Y\344\373\023\221\272n\261\203\216\333h\30440\253|\277}\341\0165\r"
+	.string	"\240H\204p\201c\240bS\271\364\265\240\266\311\226)\005?"
+	.string	"?"
+	.string	"A"
+	.string	"\363/\333!\r\026\331\036\027[[ \334\3000\213\261\273\335\247\374p\321\245r\"\037v\365"
+	.ascii	"C\326A3\215./^O\036\245\016\232i\303U\300\271Hew-\341p\317\333"
+	.ascii	"^`;\201\375\025\001\213\340\363\300\370\252\215\364\246\222e"
+	.ascii	"\311\235[\271\2629\365#\\\310\"@"
+	.string	"j7\303(cU\223\003\204\355\373#.\373<\346\317h\221B}\374\360\"\3501K\323\270J\211\330]\220\372\260\220=\231<\227\027\355\340(\036\020\020\215\371\to@kw\025l\234\246\361]\237\206\260\321\203\033\310\247\274\201/H:ZC}\221\363\351\301\313\213\377\212D\207\232\355#\242\266\307\202\036\364M\214a\255$G3\211*\366(\027\276L\004\017#!\323M\330`8\235\327\361t\024\003\376(h:]\205\357\353t\023\333z\330%%n!l\037$Y\342P\320\025)Y\266\001\334\002\361S\\\205\305w\271\301E\017^ \237\fN.l\250) \200\202\231D\352\001\244\345un$#\b\025np\323\260\312\005\026h\"#Yhbq\317\260\001GH\301\320\241I\314Qu$\b;\254!\277\002\024\006\200\337\353\302&\211\3720\033.\335\006\031\005I\0228\215`\27746$\261|N\265\320LY1"
+	.ascii	"j/L\352\332\177\202\031\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\272\032mL"
+	.ascii	"Jw\\\031H\200\226N:c\026\201?ElHF\250H\226\202b1\026\252\t\\"
+	.ascii	"@<\313(\305\246\005\230\007\304\007\212\030D\237\364'`\336\270"
+	.ascii	"1_p\272\317a\230\356s\bU\362\276i;\246\231V\356t@\bX\0202\257"
+	.ascii	"\215r'\031x\001z\001\222\001\233V\241z\324+\373OA}\247*\3547"
+	.ascii	"U\240\013)\261k'VKp\267\004m\226\032\334\264\036\224\347\365"
+	.ascii	"{\340\365\227\352\036\246\037\003L\037F\025\006\263\356\372A"
+	.ascii	"\273\256du}\223\256\257c\256\237\243\226r]\251\304\365\221\340"
+	.ascii	".\243\227\354*V\337\372G_\326\213\333\223\214\330.\275\266e\363"
+	.ascii	"\262y\275.]\247\260\355\033\227>\023\202\265\256H[*\f-\257\312"
+	.ascii	"{\226>\215\252v\245\024"
+	.string	"v\265>\213\232VU\244u\bK-\321\032t\245\006\321\236\327\263\362=V\351+\325\263\376\213\nb\301\230\365[\324\262\327\365D\374$\353\273\250\310\273\215\365\223*\225~\r\261\rs\334/\275\016\037\372\224~Q\225\262x;Ovn\217\322_Q\241\274K\330\275\200\235\313\327\327\236|\213\223ki\362,L\256\346u\264\256\237-\271\231\222\247%Y\273\363)\222\227\031\317vd\345|\216\245x*\\\027\333\372\321\310\247\024\271\025\255C\351e\035\214H\037\307\220\177\365\204\254\232\004\242\257\243c\365m\324 \353F \212\215\356@\372A\365\352Lz\013t\253\265R\365&T_\302yyyW>\325\027V\251\345\362c\351\242v\016j\333\210'\372\330\272\247\276PuZ\270\246\215{\217M\366x\367e0\304\336!\270Y]\364v\327\027\024\n\203Dv{\367\313\3501\301`0x\246\376\260\356.\016V@\2561\303"
+	.string	"\231\206\346\304\0032\215\231\007\344\231_e\023\276m\035\220}\346o\307#\257\353A`L0\016\3107-"
+	.string	"\001\331\303\371\273\241\021u0\337C&\301\333\220\301\374vA\361\301\306c\376HN\312\342v\356\206s\312/Z$\306c\341n\030\307|\315\342\332\3222P\376K:\254,\321\224\367\031I\242\261r7\374\213\273a\231\362"
+	.ascii	"\264DY-\335\rW8\257I\221Q$\300\206kh\3167\001,\223\312\230_\004"
+	.ascii	"p\317\033\034\211\307M\n\340\337\371\364\353\025\303\354Z7\037"
+	.ascii	"'\351[\235\375+$} \306\376\220#}\"\305~\026W_k\253_\304H\337"
+	.ascii	"H\221\376\226V\337GV\277\215H\037kH\377\213\220\376\024V_*H\377"
+	.ascii	"\007\220\256FW}.\253>\222\252\276\221\252_\234\352\372B\252\353"
+	.ascii	"\212\037][Due\001\325\025\210\330U\350\243\177\344\251\253\220"
+	.ascii	"SW\242\246\256E=\372tf?\fS\337n\330\277\343\321\007\263\243/"
+	.ascii	"\247\243\237\314\321\217[\352\277\341\350\317\335\350\303\331"
+	.ascii	"\350\207)\365\243$\365\307j\364\2214\372Wf\364Q\244>\231\214"
+	.ascii	"~\225\030})G}'F}*\030\375'/\372A\\\364\243Z\364\225\260\350{"
+	.ascii	"\255\350w=\030\f\356\346\324\242>\324\253\212E\353\355\232\370"
+	.ascii	"\031!\202\203\017\321\242\275]\f#0\364\214\320 B\303\317\005"
+	.ascii	"\237\020\016\366\245P\035\n\347\207\302>7\271]\334)\206O\220"
+	.ascii	"Fu4|\260]\214\242D2yrR\031g\001\323&\375\246Q\031]\321\224,f"
+	.ascii	"\312\241t\306v\361\257\024n\027\337$\332.\3661]l\221y^\2440\266"
+	.ascii	"\31097\332\"\343lr\213\f4\013\244G\346\200\030[d\242\024\031"
+	.ascii	"E3\277\36258\244d\313\201\266\3102\306\327b0\b4\201\002?}\013"
+	.ascii	"\n|\343\207\007\212@\201g\202&\360\357d1\201}\345\315\t\334C"
+	.ascii	"4\201}\247\212\b\354+\213\"\360\315\025\021\330&h\207k\322\232"
+	.ascii	"\222f\346g\356"
+	.string	"\304\224;Ovna/w\270\207h\207}A\020\370)\004\356y\f\021\004>\021\244\303%\316\224D)\302\3749A\224\036\314M\352\260\007\237s\203\231\201\347\314)qR\003'\320|\203\034fH\003l\316\232\264FH\207i\316\031\363\213g\206T\344B\035\226)\317!\035\366\225g\251\303/\377\023\351\360Ly^BE\350\350\302\007\314\\\247\035\220yK\253\3142\261\256\254\322))(\223\350\324\304\304\303<\274;\2739\271\344[\333\311%]3\325\260\240)\327\226V\226\020,\363\252\234J\245N(\223X6\245Lg\035\232x\245]:w\312\231\311\262-\365rr1\327J\265\024\313\211\232[\247\226\231Ub\245V\247\224I,\317\324(\322\022\251\210\364'\3751A\234_/\261,[\327aC\371\2453z\3421s\314\003\346\201\362\016\3108\006\200\005\006\2346e\315\t&\373+\341\2011\256\262vl\n}"
+	.string	"\"I\250E\2232~\306K\351l\307\240\214\337\267\250)\265\365\372\372\320\251\274;S\223y"
+	.string	"V\310\222n.\352\343RK{\217\324mh\276i\330\302+\320*bCq~\300\330\027z'\343\223E\371\204\360"
+	.string	"\330\234\252\326lQ&\201\236\347^ \027\271(\377\230N\250oQ\006Q>-\312\037N\037F\340\242\354\301\354\340\263!\003\2170\007\247\334a\274Y\224\r\230+6\247U\266p\2132M\031\267(\317\224\277\224\270(\313\244n\2132\250Z:\017\265(\373\204{\\4@\336\223&\217Z\324I\025\230+\365H<F\355\331\242\361\205?\361H\024[\344\242\r\367l\335\366\214mN\035k\3066\303o\330\030\023(t\007\202\360\017\236;\206]k\306?\241\fJ\301X6$[3\366\tu\320-\256\331N12\344\211\302\232q\017\2175\343\031\343?\364\226|Z$\372UK\302CZ\344\226\265\3302\366\031\277X\222`\242\026\271d\374\222\214\027\304\004K_*c\376\312\231\024\301\322\"\021 \310a\332\244\346\334\"y"
+	.string	"\334\"\2138\026\371\260-\025@+\266cT\204`P\375\306\216\261\202\307\034W\214}\302\005\333#\337\306\036yA\215\0053Z0>j\263`I\013\3062J\013\306?\364\325\311>a\243-\036J\333v\244\212\332\272\255W\205\022we\307i\254\027\037*\210\330\024\202\002\250\242\300\\\023\246\316\310\214&)(\244\003b\f\be)eW\334\022\340\302DL\202@LD$\232\tDd\036"
+	.string	"F\306\243q\026\3225\035bq\263\032\023@\362\240v\030\312\326[\244\246~~\\=\216/d\361r\367\030\333s\033\271[g\215\262\256\031H\300\350'F\213\313\375\376\274W=\001\203\202\177\r\366u\316x7\215\366\025\243\277c\371}\235\364\360\320\"\331G\007\254\004Sc\347\265F\250\251UTuc-F5\312\005\320\210\224\277\265 \032\221o\310X.\224\r\246'\223@\022q\235/\002\3047\327\327\232\353q\006\327\035\247\277'\212"
+	.string	"\340\360+\r\224N0\262\005lCf\205>\201\364"
+	.string	"\323^+Q\345\032\316u\257\3028\340<\224\327\037\003\200\253\341\256\rp`\265\3275\335Cn3\256&T\212\013\353\361\362:i\340B3\177\206\204\263\033$o\013\\\367\347#.\300 \354\003\207\321\003\220\375\300i\351\223\262g\276v\f\023/N\315\353\343\330`\276\323u\334\233\n\372\351\221\201@\265\001\323\366\020\336\242"
+	.ascii	"\236y2)6\206\242\336\206`+\364B,\b2\351\0160s\324V1*\\]$\314"
+	.ascii	"O\255\343\002\332\346\227\022\245\217\214\265\001\336\302g\221"
+	.ascii	",\340h\234\246. \177\222\260\207\027\227\030\276\304\246\177"
+	.ascii	"\327\214s"
+	.ascii	"PD\242 \243n\202O\346\001\215\301\250-2&\336:\004\302\220\366"
+	.ascii	"\345\231\035L\224[\233\362\031J\274\223\017\231\211\205\275\220"
+	.ascii	"$\033\353\t\251\305G\251`Rs\224uRa9\022\324\327\306\373#\352"
+	.ascii	"\314+\303\315!\3673k)}E\320_r\375U\3116f>\373\263X\004 \255G"
+	.ascii	"\252\274\t\357`\273L6\327\204\026"
+	.string	"\004\232\315\261G%\212\245dA8\217\364M\231\253\227\306\220\300\243\337\222J\023\017Y4\037\250\241a`\352\255\021<P\217Vg;Ha)@.\221\370eF\336\313\376-\302\250\023\337\365\373\300\242\317}P\370\255U:\020\361\023f\322yb\270q\211*\235\343;\232E\223\231\"\305Hw\251\212\303\347\272,\005_e-\016\237\353\222\034t\313\2658|\256\312R\360.\327\342\360\251.\311\340\273\\\213C\347\252\224\031\004\366\226\305\353$+\214oIP\300\242=\033\375\n\376s\021\177\275\223*\255\342\306\027\336\024fe^\007\3708\231il\222\177\345\321\306rx\354\300cG\250)\225\235\025\n\2077\317\225\221>7,\342\333\216\267cc\343\262;`\035G(Q`\321I \002\240*l\357\331Q\3264\320\204b-I\313\024.ZIQU\317\030]\315SN\342B}*\013K\260\301b%\332\266\364\027\b"
+	.ascii	"\300\257C\335\241p\337\"\320(\323(\033\004#I\212sx\246\\\216"
+	.ascii	"+h8\257n\233U\3139.\331\004\253\325\2017\311-\260\030\343\201"
+	.ascii	"\260\272\2334\212\276ws\377_\364\341{\244\363+T\311-\001:2Q\316"
+	.ascii	"w\261\252\02333\277\372\2073\345\005\035\236\307T\300\016\237"
+	.ascii	"\300G6\031\256\273\323wo\005"
+	.text
+	.section	.gnu.lto_.refs.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375`\317\006M$"
+	.string	"\nW\334\016D\240\\M\032\003\f\214\006\2229\2419*\376\371\036/\274\3210\327]\306CA\246\376?\315\006^\013x\005\373r\353\016\3405\214S\230E\301Sl\254)\240\020\223c\371\037\267\247o\253\215D\332\222m\204l)S\324"
+	.string	"\347"
+	.string	"\327"
+	.string	"E|\330\2001{u\301\002\352u\305\237>{\360\330\241\003\307M\033\250_M\201\337\314\323O\306\311\351\007\343\245\351\347\332\242\321~,+\004~\253\361'\f\370\034\3237`\372\004\265\207Z\372&\357\007(\355D\002\376\226\364BHo\013\360\342|\331\321{"
+	.string	"^\215.\032\315\217\021\023\306\353\013\250\337\005\374\265\346\257e\352c\315\337\315\257\"\322#\020\275\016\324\247\300W0\377\300\370JD\272\200\251#\315\017"
+	.string	"\352"
+	.ascii	"\300\037o/4?\274\375\234\037\233\017\035\r\216:l|\035UH\376d"
+	.ascii	"{\246\332#\325~\210\3666\332\203\263\203`\337D}\234z-\324i\262"
+	.ascii	"\017\232z8u\331\324\301\251\303\246\376\201\272\214),<\350\373"
+	.ascii	"\351}L\376\267\357\351\357\276\352\307>\226\025\342\356\347\356"
+	.ascii	"a\273\367vU\262\245\204W\252#\354\006V\207\322}\201\325\237t"
+	.ascii	"\357\264z\223\356\t\344v\246\334\236\244\373#\335\023\351~\334"
+	.ascii	"\027\322=m\177\246\373P\3671\334{#\204\241i\253\317\364\203V"
+	.ascii	"\027\365\303\334>s;Ls;%{@1\375?~\362H\355\343\271\203\323\267"
+	.ascii	"\203\373\353\314\311\355s1\032\377\253\361\253\306\2070\376\203"
+	.ascii	"\361\027\214\017\325\364N\343\333\306\377\242^\346\366\315\355"
+	.ascii	"\203\242=\334K\334+n\007r\031e\352\022\312|\311\004\352\345\016"
+	.ascii	"\006/q4xY\303\366R\306\213\026L/U0\375\372\321sg\016\203\337"
+	.ascii	"7\013~\277\024\374\246I\360k&\f\202\337/]\266he\271\232\022\305"
+	.ascii	"I\223%\007~\223\0341\360kd\310\217\0356f\274\230\375\262\340"
+	.ascii	"\203g\216\2335g\310xuia\261z\322D\t\222\037UW\327\256T\353Av"
+	.ascii	"L\374o\347r\007\271\254\275\3565\207}\367\322\rzL\324eM\327\332"
+	.ascii	"\032\344D\242~\213\351C{\321\307\273\274\320]\272\215\352ks\321"
+	.ascii	"g\241\036$u\361\323CY\224>\347\322aM\272'\265{8]J\355\022\247"
+	.ascii	"\257\324\276\273\031n\013I\335\366\351\264\357g\241\267\245\307"
+	.ascii	"\336zX\224\356\205\212!\034\224\372\267\364R\352*\277\340-;\353"
+	.ascii	"\301\263t\035k\013r\035\022\323UH\220\036R\273\362\330\241\003"
+	.ascii	"\247k\016\0346\370\344\2412~\322\370\"\356A\334"
+	.string	"\303r\213\253p\373\254,W\276\362\225\177\312V~\352\253op\225O\332\352\213\246\362\343\200\247=\2758a\362)S\250-\333\351\261\335\376\355\366\225\275\206O\370.\nu\242\334>\224\333i\273\017\017g\227\263\265M!O\222\351G\242n\264\244\333\226tqI\227\325~z:\3547\377\205\272'u\371m\351\032\245(h\353\322't\3656\241+\021!@\366\342!\276\336\250\355\245k\r\245\021C\324\265E\240\230\236\275\376;s\375r\342\204\372pd\377\227\030\365\243\271\314_\177\0300\177u\375\245\\\263\331\327\322\2225\025\313k\366\257\252XM]\312j\366*Q\2270u\252\251\353D\035\302\324\247\246\342N\2633\020\365\005SW0\365\003\006\346\027x\232O`\352L\363\225@=\t\374\333|\233\250\327\246>\233z\020\250{c]\342*$t\204\210]\305C\350\237\250{SA\354J\373\002t\217\264\037@\367"
+	.string	"\366\215t\037T\373P\276W\333\372\203\354Q|\033m/?\003\305\207\005\200\211\2501p\205\brF\002\021\021\005I\n\222t\360\"\233\241\346\021\220O\222\2559L\026P\326\222\306\357\304{\235mnY\020}-\275XH\322R@k\262R\345\221\006l\362\23600X\024e\r@\263hQ\335\256\344V7\372%w)\247>\270\0234\214K\244-\336Tq(\217\375\237\356\211\027_<\364I_\261\223RB\325\327\324\211\246\250\3116'\330u\347\206Kl\254\214\007Gc\327\220\344\036!w\003\036\326\273k4\204O\373B=\004"
+	.ascii	"s3\r\377\351\373_\255\351\357\213.\272\266\350\321\034\006\240"
+	.ascii	"\337\273S\021^\200\205b\242k\2703\203g\004>\023\235\211\3166"
+	.ascii	"x\034\254.\\h\347\257h\036\242b!!\220\314GUrV\005"
+	.text
+	.section	.gnu.lto_.decls.56bb4f0a239f5aa2,"e",@progbits
+	.string	"(\265/\375\240($\001"
+	.string	"\005\220\004N"
+	.ascii	"\207\356\030T\0200d%5\006\nN}@\362\031\256\220:\r\021\345\364"
+	.ascii	"8\020Y\206Oqz\234Z|\017=\250T\341"
+	.string	"X\216\357\016\2101\326\024\031\212\025[\371\342\027i\203\344c*\001\031\242p\007\357\306\215\212\316\2362\212\277\262\002\t\3508+\255\264\022\273\345n\312&e\n\367\025^\031\262\031\333\007\234T\332\334\020!od\257\\\220\373\204\274N\235\023\252\242\346\315\367\243\007^\214)@\262>\006)\3738\352\363\341\353QF\204E\224\254\373z\260\005\3377\311\373\276\026\004\325\260\265=e}3>\036\377\331\341\027/3*Y\377>\036;\206I]\336\252\035>,\366\214\034\233\256\254\217al\037\203\227\017G\246S\"\203I\326\307 \244\312g\205\243\276+\315\346\372\214FS\344\273\322i4\336\n\306\356J\267\361Qa7\250\342[T\307F\372\276o\206\016:\300L\252\264\261S\265\257\311W#\214\226\r\337\224\357\006\216\372\250\356\243\322y\276\243\241\220\361}s\340iQ\371X\370\226\206E`\257\223:f\350\f\227\206\016:"
+	.ascii	"\"\341\250!\264\365\177_\224O\nG}5|4`\370f\f\241T\235\341\232"
+	.ascii	"\326\3609\371\236, :B!\215N\272\251\360H\333\241\352c\310\261"
+	.ascii	"\177\337\f\037\024\013\263!q1|2~0\240\334\322\262>\006\032;\306"
+	.ascii	"\261R\020\025kY\037C\323>\216^\214\357\305\353\262\330b(\311"
+	.ascii	"\372\030\220\3661\250\330\307 \264\037\202o\251\327\304\207\204"
+	.ascii	"\335\310>\264\325\371\224|L8\352[\362%\221\211\371\226|o\226"
+	.ascii	"1C C\272\224\250\372\025\230\331\372HQ\023->\027\276\026\257"
+	.ascii	"PXWC\215H\326\257\200n\277\202\270\375\337\267\302g\204\243\276"
+	.ascii	"#\237\n\337\221O\310Wd\001\321Q\210)5\276#\337\013\004\"\344"
+	.ascii	"\f\327z\205\366\305C\325\257 \311\376}E>\242\031Gex`>+P^|d\375"
+	.ascii	"\037G}C\232\315\233\0018\327\342\255\313\372\025\024\331\257"
+	.ascii	"\300\307~\005W\373\025D\355W\260\264\325\3505M\252\274\266\262"
+	.ascii	"~\005*\324\260\331\307I\2631\030\306Q3\340\330\225\271\303\253"
+	.ascii	"SZ\024-k-\325dpT\203\266\263\303\"j\312\3728s"
+	.string	"\033\005\357\2135\2508/\017kP\217\363\266\305d \276\250\321\344(\353\343H\331\017\201\213\366\322\2132\355':~H\347t\030\034\325t\032\216L\323\351/\032\fv#{\207^\030\300\214\035\035\324\364\311tM\fU\307i9\242\013\037FYY\037\207)\016G\305\376\215\264\213~\313Nc<\274t\321\262\177\363D\267\275\235Q\303\"\353\337ti-7B\366o\260\366o\242\366o\224\366o\2146\013\206qT\f\245f\377\232\312u\332\315r\336Bfj\2325V\223sM\345\254\312\n\274\254\217\274\333\230\t\313\306TZ\n\023\265'h.\262~\bVi4\023=\245m\f}\357[\205\247\365\276/\2161R*}\003\273AQ\200k\215\364}_\262*5\232\211\326\241\303\260\033\226f\253\223N5\023}5\225F\321O\264\023]\246\233h(\232\fG5\023\275\344ZL\217\355.=d\230\0255>\3038*"
+	.ascii	"0R=\022\312\216j!3\340\276\262>\222k\037\213i\261\r\025)\302"
+	.ascii	"\002\363\245\2754\022\275\245\217h.\r\246\223\350.m\004G\265"
+	.ascii	"\022M\344:G~\237{cA\326\204d\321\001D\213\326\0169-\036\332\307"
+	.ascii	"\260\367\276T[\264\264\022\375C+\321C\234\272bL\337\027l\310"
+	.ascii	"BIY\225\n\364\221H\373\3075\373\307\272\375\243\226\375#\224"
+	.ascii	"\375c\222\375\343\217\375\243\224\017"
+	.string	"\335\003S\241\321\222\226\265\316\3221\264\340\370\221\365\217O\373\307\244}\343\231}\343\227}c\227\035\304H\365F(\373\306\257}\343\220}#\326\r\260\367}1\030\2630\331\310\372\306\031[\333\310\303T\357+\366\276/\206u\311\213\322R\3267&\355_\327\3200\230\260\311X\232\321\224\244\024%EbZ\312\3210\264\223\013\251\206\241\223B@\323Qek\206\216\241ih)\r\245\243\264\f\034\3250\364\213\353\247\\\324;\363\205&-\352_\334~\261\313~\221m\277xe\277\210\266_|\262_\f\333/v\355_\273\320G?26c\220d\375\020\324\314\031\225\321\257\026\322C\232\250\327F\263\320+\264\221V\241\213zy\272\005\216\352\243\336\232\367\360zl\216\305\316\324\35103\006\215\230\273i\030-2j\2449c\360\264\352\330\350\243^\032:i\216>\352\331\365\356\206B`\257\220j\346T\325F\365\342\341c\n"
+	.string	"\215\2170\216j\304H\365E\246\375\342\273O\254\333'\276\355\023\251\354\023\225\354\023\201\354\023\241\366\335\325\243\242*\"Y\237x\264O\024\332\037\326\355\017\257\354\017\231\354\277'&\003\035\236\226\2660t\352\2206DaY\317\201Ey\3377\003\236\332H3\312\372\303\036\3738\311Zo\213\n\026\322\367}szq\275\267\036\034RO\256\007\246\367\005G{q=.\307d\275.\317"
+	.ascii	"\366\276Qzq=\267\036\032v\203\002{\235~VyFm\031:\330b\272\210"
+	.ascii	"\214\266\376{^\336\203+\023\301\213\201\250\366\332\255e\235"
+	.ascii	"\223\363\236\027\374\265&j%\353\017\2616~1\216\372\241\322\376"
+	.ascii	"\220\305\356\261\365\264\340h\206^[\027\"%\251\254?\034\332)"
+	.ascii	"xq\006\365y8\203z\341\335\376{Y\260\364Z()c\2265Xpi)\213\352"
+	.ascii	"\212\025\366\310\223\334\026\265\367\254\374\271G\257J\017-("
+	.ascii	"4*\033*\312\272\367b\034\265\227\226\363\236ZO\256i\n\214\254"
+	.ascii	"}=*hXN\253\006\033\332\224\256\247\034=\300\222\274\357Kd\247"
+	.ascii	"\254)\002\343\f\212\336\362\242M\221\254\237u,Y\243\325d\332"
+	.ascii	"\033c\"\006\245'\246Fj\326\213\322+\353I\351=\301\321\036\224"
+	.ascii	"\236\223\020\240\364\310^\235D\246\256\312\326\373\202\3459\031"
+	.ascii	"@Z\004\365\205a\373B\256}"
+	.string	"\341\220}!\326\316\200q\324\013\255\366\2052\302\250\242Hfl\341\301\224\365\016\2347\364\275/\325\232V\216\016-\322\034\253\036\016(d\342\354\246d3p\036v\303\242@\2225\322\0320\202\b\305\331M\311\246\312\202\304\331M\267\236r\232\342\354\266z\\\275$\275\"\275 =\255\236\222\236\221\336\217\336\220\036\221^W\357H\317\253\267\325\373\352\001\351\201\365\204\340h\017I/\353\275\036=\0379 \300\325&%\353!\351\331\350U\r\313^\320H\243\025\203\214Q\r\314\206\335\240\336\236\030.qv[WR\230M\365A&\316n\312\343F\234\335T\006.\033\366\336w\njJ\234\335\264\207\244\207\205\363\206C`/\323\n%\032g7\355!\351E\341\262\241\020\330\273\264\002\021\212\263\233\276/X\206\337\024Q\031\036\002t\246\3028\252\0010R}\020\314~\260\312~p\311~\260\307~\320i?X\344\324\273\022\272\311"
+	.ascii	"\363$\353\003\307\354\003\331z7pR\031\034F\262>\260\311\246\002"
+	.ascii	"\022\331\007^\355\003c\354\003\205\366\177^\366\177j\373\277"
+	.ascii	"\350\376/k\377\027c\377w\264\317\222\331g\261\354\277\367\242"
+	.ascii	"\347\344[\222\205k\250\347\364\336P\f-f\275\246\013\210`1\222"
+	.ascii	"\256\230zKh\264H\r\311\372\357-e8\274\004\210\226*YOU-I{h\341"
+	.ascii	"]y\261i}\255ie\035X.z\370\310\223\346\244\225i\3658\"f+I\233"
+	.ascii	"t\213\013\214\024\247Y\201D\212"
+	.ascii	"dn\253k\213\326\2176Z8\215P\022\255\253?O\341H\312J\177\356\001"
+	.ascii	"\304\212\215Xf\001dK\t\221\226)\036,\244XlG\013\255\251\234\003"
+	.ascii	"\t\227\301h\274F\370q\031|\346K\232\003\227\303\362\224\036\330"
+	.ascii	"\331\tDX\244JK;\264r\217 ok\362\213?#=\325p1\346\343e\302\232"
+	.ascii	"\262R\302i\360\032%Z\357\237\247n\250\200\2723R'-r\232\322*\203"
+	.ascii	"\315\220\3414*pp\345\036D\246Z\357\013\226{\fI#\305i\210\272"
+	.ascii	"\264\212\214\221f\272\214&O\363\230\336\233\343\362\\\257(c\311"
+	.ascii	"l\262[\266\313[\262\231L&s\311a\362]~\313k\231-\327\365\224\262"
+	.ascii	"4\347\3454\275\026YM^\223\273\364X\364\204r\233^R.\223\263d\271"
+	.ascii	"\f&\177\311bzF=\242\236\212\336PoE\306\353!\365\\\3443\331Kn"
+	.ascii	"\353\035e-8\232\341r\225g+\371J6"
+	.string	"B3\223f$\270\034#K\365\300\264@\214Ee\035i\345\241&\234\246\305\330\017\244$\034<\250\340\274\341P\361-\"\222\242\026E\212\247T3j\374y\312\006\034\r\255\242?\367\200\313B\324d\243\037\247\201\313Gc[\322\367\005\353 C\007+\026\326\033\236\217^\2510\216\3722\030\251\236\215\262\317*\331g{\354\2635\366\331\026\373\317K\236\247\374\031,G\363\031\246b\237\260\240I\311\332,C\257M\013)J\262>K\264\377\347(\031J.\313Op4K\311M\236\311\262\321\363\bc\270\254\007\246\2656\261\252!\366\347<K\311Np^\017\354l\033-\261!}_\260\343;\261\267)\255\367\005\3430B\226\222\231\3402\354\006\365\n\221\021aHT\007\221\351\373\202e\350\240\203\016:\360\355\200\262{\373\351o\271\255r\331\337[\366\267\226\375\275\266\361\222\234\347%\372\352\314\222\220\254\277\255l,\3058\252"
+	.string	"0R\375\036\333\337>\366\367\215\375\355\264\277\207\366\327\272\375Umg\200\221\352\327%\373+\221\375uj\177}\261\277\n\355\253v\373*\227}U\312\276\032\266\257\356\330W\2336\b\030\251\336\227\267\357\203\333\367\245\355\373\302\366\006<\366}26\t\030G\275\257h_\217\331\327Y\3665\223}\255d\037\f#\325O\263\214g\251?\303\310/r\224\b0\004y\300x\261%\353<#\323x\216\312Po\216\022\201\352}\207r\024\021\357}\207\210\030\017"
+	.ascii	"\343\001h.+ OT}\275\265qW\316\263\f\342\233\231\231\037Y_\367"
+	.ascii	"\330,F\252\3274\366\3110\216z}\264\337K\263\337\223\333\357\251"
+	.ascii	"\355\313a\034\365\275\257\3753\214T\3373\262\337\303\332\357"
+	.ascii	"\331\330\3575m\020\316\354\347\267\3753\264\375+`\373n\030G\305"
+	.ascii	"x\230\r\216j\200\333\034\253\301w\367\r\201\275`\357\013F\314"
+	.ascii	"Yl\234,\311\372\371\310>\326@\355\345\345a\r\324\347\252\235"
+	.ascii	"1R\275\033F\252\227b\034\365y\305>\236\333\307V\366\245\030\251"
+	.ascii	"\0261\216\372c;2R\204\246\232\262\306d\260T\207Q\tY,6\220\310"
+	.ascii	"\310\372\330\311\376\361\230\270\354e\306\216\027ua\224`\251"
+	.ascii	"\362\225\365\261\230\033\216\303nd&\210i!}\337\367?\026\203\351"
+	.ascii	"p\024\207\271\006\013\203\3470\034\0245\322\367\005\353 C\007"
+	.ascii	"B\272,\266-U\037+\331_\256\326\2132\355&>\216\24498\016s\301"
+	.ascii	"p\303\"\260\267\351W\306\302\250m*\207\301\340(\216\273\230\006"
+	.ascii	"`[\030\327T\325\307B6\356\202\337pt\003\354\005\214\310~\271"
+	.ascii	"\253A\226\365\361\216}\274\201J\334@=\266\261\217k\354\037o\331"
+	.ascii	"@\230\346\013\321V\033[W\025+\262\2541[\306kX\3131\033\316r\016"
+	.ascii	"#<X\204\331\364\373\016a<\200!\306\003\360\251\371\030Z\242\352"
+	.ascii	"c\031\373\307X4\254G\246\330\310qE\203]D\005J\022+i\300#pW\216"
+	.ascii	"d\375\020\3140\223aQ\361-\202\362D\353}\337\207\360c\262\237"
+	.ascii	"\303\b8\r;\301eC\241\342KD\027E\353}\301\376c5L\005W\301Q\234"
+	.ascii	"\206\317\216\247`\264k\260\367-z\337\3678\311\237\223\206\245"
+	.ascii	"`&\275(\323[\264D\215\003\0274M\216L\337\367\355\240\203\f\035"
+	.ascii	"\250/\274\276\364\330\032Sa\034\365\006#\325o`\177\205}\0236"
+	.ascii	"~\202\241\340\350\0058\3129\214\360\236P\330\233\344}\301\210"
+	.ascii	"\3026H\332\254\311\372\021\330\307"
+	.string	"\027\2508\017_\240\236\303.b\244\372\343&LzGHT/\331\373\202\031/\320\242E]\326\230\t\036\313T/\006 \220\030juYc/\374\205\243W\303a\307K\260\330\331\"\260W\354}_\"\336aEhG\326\031`\034Uc\244\372\016\366\261\352\035\341y\243x\337\367\305WS\327\274\274\274<|5\225C\316\261\222\037w\341$H\225\t\n\354%{\337\227\250n\245\335H\223\365\3010\216\2721R\365\302\216i\260^\2650bP\225\354;\025\214E\362C\362\253Pl\221\2375\362\377\266~5\352Wg\2504~5\372\253S\277j\365\253^\277\212C\355\361\253I~\365\307\317\006\371Y!\377\357\210\032\246\212\375\002U~u\354\013\370\215\275\036\266\237\021\227\216\004\315\265\303\376\331\355/k\r{\233\251/\rK\343\247\365#\256m&\005\376\"\025\271\f\273D\261\311\277\366\220\333VT\367B\002\310\277^\275"
+	.string	"\277\321\203\334\243L \303\226j\300v1\024v\314\211\224\237\217}\342Z\366\003~W\277\036J\277\272\304N\375+\207_\326\277Z\375?\036?Ke\255\262\266\020\202\265\345q\341_}\326\262\037c\301WT\374v\340\263\177\277\370aYYe\220Y\243?"
+	.string	""
+	.string	"@\003\013\324\246\237\325O\307\257+8\n~c\001~6\311\257\026\307\236\306\202\375k\t?\034k\324~\300\357\352_e\260d\242?"
+	.ascii	"X\375\277\033\377\317\306\257+8\003~#q\271F\375\366\021\360\n"
+	.ascii	"\376\342\330\277RE]\355\031H|\215\230\363\377j\374*\222\177\223"
+	.ascii	"\240\371\373\330He\375\254s\355\260F\340\322[\240v\375\352\217"
+	.ascii	"\023\3407\002\177Q\277jE\r\362s\343g\253\376\037\215\377R\"D"
+	.ascii	"\306\365\337)\320@\035{\215X\250\217~_\222\3777\303\267\344\367"
+	.ascii	"!\371}]\277/\307\357\003\373}6\376\037\324\257\326\375>\261\337"
+	.ascii	"\027\375}^\377O\206O\311\357k\362\373\336\337\327b\017\340\027"
+	.ascii	"#W\340\317#\374\331\001\177\236\300\237O\370\1770~\237\316\357"
+	.ascii	"\353\371\177O\276\241\337W\202\177_\360{\341\203\300\2775\374"
+	.ascii	"\234~\337\b\377\306\3715\375\276\342\277\215?\246_\227\371\365"
+	.ascii	"\231\177\013\177K\277>\362k\"\277f\362k\261_\177\375\232\354"
+	.ascii	"\377)i\257_7\371\265\223_/\371\365\326\277\331_\322\257c\374"
+	.ascii	"\372\351\337\276\037\322\217U\374\270\004\330\347\307+~\334\201"
+	.ascii	"\037\273\360c\021\374\370\371c\013\374?\027\270\375q\212\037"
+	.ascii	"#\375\030\372\343\023\374\330\305\217\227?\006\001\376\300\217"
+	.ascii	"y~\354\374\177-p\322\217\177\260\321\217[\3748\304\217S\370q"
+	.ascii	"\005\264\212\377\307\342\327D\277f\361\353\242\377w\364\215\177"
+	.ascii	"F\277N\302\323\317\036\362\357\035\177\326\303\277\242\371\255"
+	.ascii	"\300_?\376\361\343 \275\337\337\023\376T\374\275a\016\223\331"
+	.ascii	"\3749M\361g\215\377\257\350\317)\374\031\304\277\322\375\210"
+	.ascii	"\260\023\271u\3527\364\023b5\374>)\277\367g/\370\177)\370\241"
+	.ascii	" \203\337\tV\374L\360\263\277\377W\202\177-\376^\300mV-\277\024"
+	.ascii	"?\273\301\017\305\232\345\352\367\325\260\201\247"
+	.ascii	"x\340\304\377\003\372\177>?\333\306W\266V\301\030\374D\037\377"
+	.ascii	"\317\205_\275\362\343\270\3777\002,\367\377\230\377\276\373\365"
+	.ascii	"\374\333\313\217\347\307p?\236\273\226=\346\267\363\357\271\177"
+	.ascii	"\323\375"
+	.string	"\332\237\365\375\254\372\377t\326\263\337R\016\203JE\016O\361\300\305\3306\254~s\225R\302O\254\301>\177\026\372\377J\250E\254\tU\350_\231~J\026\305O\004l\320\317\226\340\377%\325\n\250\026\330,\260(\370\205\200\035\372\201@=AEA\375\260E\374\277\017\364\360\277\"\375<\340#\363\353\300\317\346\374?\016\374\232\003\177\036\361\257-~\033P!\240:@}\300\1771\265\001\277*\201_\235\200J\001\004d \221FW\360\345_\234\361\037\355\177\232j\301\257b0\376j\361c\352\361\202_\305\371U\r\353\321O\003\b`\333\260x\272\202G\340/\246\370\257\366\257\033~\031\370\330\231\220X38\006\177\221\004\377\275l+,\323\243\370\330\354\344\327\212E\202X\037\377:\302\257\205\377H\374\333-\202q\261S\240Z\371\005\340\303\337\210\303\234\"\203\314\327\326\253\337\374\305)\377\257\334\202\357\337\210\301\277F\177"
+	.string	"`\235?\r\377\376\360\257\036\3742\210\3750\374'\261+\200\363\027a\260\032Xe\220aA\360\263!\370\1777\352\007\033\304\017\371;\376\210l\007@\270\206\277\350B\335Q9\250\036\374\352\006*\007\277\332\301\377(\252\002T\020\356\201\265[\300\342\365\300l\024\212M\273\203\337\360g\215X\025>9\266\304O\310&\375\352\212_\3207\347\233>\303I\250*~\325\350\277\3307\360\027\203\344g\017\357x\261u"
+	.string	"/\376E\r\354\021~\300\237u\300\357\367\377\330\337\367\345\367\335\375>5_\231_\233\375\276\272\3377\346\367\221\371}a~\237\335\357\213\3733\364\367y\371}f\376\267\371\355\337\007&?\177\366\204\337\372\373\350~_\226\337'\346gG\370\251>9\037\334\317\256\360\363\375>\351\337\003\363\373\346\330\t\374,\005\376\237\3369,\t\266\205\377\327\373\325\336\006j\376}k|x\357\300\177\017\374\267\340\227\377#\340\031\376\037\376U*\377I\374\376\263m~\026o\315\340g\317\034\004\1771y\271\377q\377\303\354+l\231\377^V\036b\352\316\232\203\204:\345"
+	.string	"\370\211!\376\225\b{\367\337\013kGBM;\360'\252\360\261\271\262\276X\225\2542X2?6\362\263\322\037+\371\3311\377\312\305\326\375\233\355\277\027V\314\217+\360?\312\217W\370q\320\217E\374X\347_\217\354)6\f\002~l\343\307M\327\340\277\005k\221\237\350\302\257Na\351\376K\277\026"
+	.ascii	"v\356_Y0\277\332E\356\306\177\230\225\302\277^\340_+\360\257"
+	.ascii	"+\374\253\005\376u\304\320\312\277\266q\377\332[A\360\257\311"
+	.ascii	"\177\365\300\277\212"
+	.string	"\340_?\360\257:?\373\345\307\177X\306\302\375\253Oec\275\374\252\333\033\333\345\307v'\370\327\022\374\353\211\1775\301\277\246\370W\024\374\353\013\377:t\013~\"\373\257g?\313\205uc\267\260mg\177\242\325\277_\374\307\277\221\203\037K\3711\224\037G\371q\331\217\235\374\033\310\177\3657*\377\035\345\337g\3776\373w\331\277\235\374\033\312\277\245\374\033\355_\225\260Z6\331\277\233\260l\377\213\277Q\307\317\256\375,\226\237\265\362\263j?K\345g\247\374\254\331\317B\371Y'?\333\344g\307~v\311\317F\1776\311\317r\375\254\221\237\025\362\263?~\366\352g\253~\326\306\317F\375,\323\317*\375\254\321\317\252\370Y\242\237M\301\317\226\340gS\374\254\211\237\205\376,\320\317.\1776\004?\313\201\237\325\300\317\266\360\263\"~\026\205\237\245\300\317>\340g\027\360\2639?\313\301\317\026\340g\007\360\263\002\370Y"
+	.string	"\374\254\361g\205?\013\374Y\365\337e\376-\375w\230\177\303\375\233\313\277\267\374[\313\277\261\374[\355\337T\376\255\365o\253\177\337\370\267\215\177K\375[\306\277\237\376\335\364\357\367\337-\376\275\364\357\244\177\273\370\267\321\277U\374\233\350\337B\377v\377}\342\337A\377\356\3717\t\376\335\374\367\317\277]\3707\363\337\355\277K\374{\371\357\344\277?\360\357\016\374{\003\377\316\300\277[\370\367\210\177\263\360o\f\374[\304\277/\360\357\024\376]\201\177\243\360o\020\3776\341\337\022\3707\004\376M\302\277\027\360\357\234\177\177\360o\005\374\333\203\177\023\340\337\002\3707"
+	.ascii	"\376]\301\277\217\377\036\376\373"
+	.string	"\367o\365\337\371_\361\376U\315\277N\377\265\314\277\332\375k\335\277\206\371W\271\177\375\362\257^\376\265\313\277\272\375k\333\277f\371\327+\377Z\345_\323\376u\312\277J\371W\261\177\r\373\327\257\177U\362\257]\377z\344_\213\374k\220\177\375\361\257=\376\225\307\277b\375k\216\177\275\372W\252\177\235\372\327\250\177\235\361\257P\377\372\342W\305\376\325\351\367\251\375+\323\257V\340\327n\277z\302\277*\375+\322\277\266\370\325\t\374\352\007\377z\364\377\002\277o\372\373\326\374\353\212\037\317\375\377\362\237.?\377\267\371\327\r\377\305\376\217\375+\212\177\035\372W\242\177U\361\257E\377:\202\177\365\371W\027\3765\004?\276\362\257:\377\332\376+\317\277\356\374+\211\177\315\300\277\266\360\257\036\376\265\204\177\355\360\257\022\370\327\021\376\225\303\277~\360\257\036\374\272\202\177\325\340_9\370}l\376u\203\177\035\300\277\n\340_/\370\327"
+	.string	"\374\253\361_\213\377:\374W\340\277\262\377\272\376\330\356_}\377\332\373\327\377*\336\257\252\371q"
+	.ascii	"~\365\314\257\332\375j\335\257\316\375\252\334\257\302\375\352"
+	.ascii	"\332\257v\371U\267_\325\362\253"
+	.string	"l\277z\345\277\227_\265\362\237\304\377\346\217\001\360\253i\277:\345W\317~\325\354W\235\374*\331\2576\371U&\277:\366\253G\277\272\342W\213~\225\350W-\360\253!~\025\205_\005\361\253\024\370U\016\277\232\363\253 \374*\006\277*\200\337\227\346W}\277\257\315\337\303\373}x\277O\315\357\223\362\373\236\374>'\277\217\354\367\271\370}+~\237\004~\037\003~\337\315\257\325\374:\312\257i\374:\351\327'\376\036\316\337\033\376\275\374g\025\376l\301\237\177\377U\370q\230\037\323\375\030\313\217\255\374\030\355\307f?\216\376\030\354\307N?V\3721\323\217\227\376\223\371_\367_\314\377\266\377Z\376_\371o\345\177\225\377L\376\217\3701\210\377k\377\023\220\227\227\227\367c\320\363;\200\312\357DK\373!\b\255\204Ub\244\302+\034\025Z\to\344,P\346\352\264~\b\254\375\020L\373!XL=a\2235&\353\243"
+	.ascii	"\267\377\013\243\2044\204R\302\0318*\254!\204\361\213\001E\343"
+	.ascii	"i\r\332TXC\370$\254!\214\361{zZ\203\326\253#B\306\305O\037\205"
+	.ascii	"\265}\024\216\354\243\360c\037\005\252}\024\222\366OP\263\233"
+	.ascii	"\264\257k\t\224\215\254\177\302\332~\b.0\034\216\031ZB%a\322"
+	.ascii	"\217\310\323\032\264\251pI\310\204\243B%!\222\220\215t\352\244"
+	.ascii	"\352\237\200c\377\204\025\373 \322\354\203\240\333\277\220\205"
+	.ascii	"\360(\312\234\221V\326\302\243(;FY\213/#\341\n\" j\306\262\026"
+	.ascii	"\256\300c\275W\315\031%\025\007V\341\222\347\004%\353_X$\024"
+	.ascii	"B\203E\224$k$)j\264\200h\037\270\322H\363\204D\302!\341\213\243"
+	.ascii	"B\241 \336\203l\202m\204BZGp\215\005DG\332k*\024\n\226\341\261"
+	.ascii	"\246\021\316(}\341\362\3458\3632\364\323"
+	.string	"\252\034F\252\007\341EM\320\212\027\033\241\254\017\"K]P\0324\023\264\013\226\t\336\005\307\004\247A2A4\30138\032L\023<\313\320\345\2124\230&\350\345"
+	.ascii	"ROwg\323`\232 \334\001\236\236\356\316\246\357\373N]\321\242"
+	.ascii	"\325cK\320\312\232\326\226[\026)\026\266`\232\340\233\231\324"
+	.ascii	",h\345J\333\026\227`\233\005DG(T\301\"\r\246\t~\t\212\361z\272"
+	.ascii	";\3535\2059A\222A\323\005\303\314ya\032;\223\365AD\321\315\t"
+	.ascii	"\233\254\321\030\002\363\340\334\231\025xO\262\016\312\365\266"
+	.ascii	"\260\3111\024\367\237\025zi\305U\211\303c@\224\200\230\311\372"
+	.ascii	" \232\366A\264\3307\001o\337\204\273}\023\346\366M\340\262o\002"
+	.ascii	"\226}\023\320\330\202Z\326\260\020%T0\304\330\202kUYYY\036\\"
+	.ascii	"{\235\005JY]&t\355\2330$X%\315\305\021^\232\254o\302UP-\230\226"
+	.ascii	"\211\230\231\262\025\244\362`\032f\313wbt\324e}3A\264\377\354"
+	.ascii	"\357\214\023V\032\264\007\247\320q\3612\315:8%x\326dh\210(\353"
+	.ascii	"\233@c\337\204\027\373&\020\355\1778\023\005\312O\350\306\333"
+	.ascii	"\330\203P\3142\025\323[4\005\312\307\373\204\345b"
+	.string	"\002\n\312\313\311\203dhKG\216d\035$\273\231\360J\216\255\256&A\261\240\227\226%Q\202b\30106\255\240\030p\212\021%4N[L\202c8\032\024\013.\321\031\204J\232\256\204Q\365?H\367?\260\355?\030\r\202\r\235\330\334`\023\004\013~\3750\333\312\221\265\227\2662\024#\353\177\220\262\237_'a\304\306\346\304\350\2642\0230Fn6,*\276.T\324i\275\357\213$x$\250$\330\025L\022\344\302\321\340V\260Hp+HD\313\024\035D|ve\330\314\r\365?4\331\377\200d\377C\221\375\007\207\254sy\254\305\220\f!A\037yR\253\257 A-\260+oQ\262\006\342\324\224v%\353\177\270\261\203>\202W\030n\330\004\3666\255P\260\004{\004w\004y\004\263\202?p4\350#\210#\250\003\203\275GdXZ\214\332\246VY\264tTe\255\031\265M\203>\2027\262\330\214\332\242\252"
+	.string	"\301\n\352\177p\261\377`\216\237\375iA3C+\353\177(\332\367 \335\367\340\266\357Am\337C\223}\017F\366\037\244\312QG`F\\\004$JX\326\177\320F0J\315V\033\220\254\203QA\244`\214^\224\251\002ouR\026.\2024\2023\2025\202PA\251\340\024\216\006\243\2022\202QA\2435GDj\202Q\301\026S\251\320\212\215\233\327P\337\303\025\214\035P\236\250e}\0171\366\377\240S\260)\370\002G\203O\301%%\271$LVs\301\247`\022\036\253\261\242=q9\005\251$\261\253\261\365KX\263_\202\230\375\022\300\354\227"
+	.string	"\267_\002\227\375\022\260\354\227P\266_\002\330~\t]\373%\020\331\177p\205\216\021G\327\025,\n\022\341hPEp\350\005\266Q\022T\021\024\002\266qB\361$$\213&Z\002\206M\325/Ai\277\204\026\373%\254\330?0\017\330\306'\226\245L[\033-HDl\200xQ\266\253\271\254\201x@5A\252!3+\034k\324d\242#ga\324\244aK\"\263\312z\032\034\022C[\313\372\035\354\366\177`\034P\fP\016x\007\204\003\236\001\226\001\232\001\216\001J\201v\3009`\030`\035\020\f\360\013\220\f\220\016G\201h\200\\\016\354\002|K\2236%\265\302\236eEi\275\357\013D\003T\003V\241\223\322*\203\206\307\212\262x\030\255tPZ[XhMi4]&k\206VF\272BC\213m\235\353E\231N\310B\222\2269\343\222\366"
+	.string	"\242\001f\001\256)\271a8'y@4@,,\027(KZZ\\h\225\001\242\001N\321ez`g'd\371\220\312\241\001z\201\322\005D\003l[\347\262Zh\225\001\242\001R\301cY6\214\332|\030i9\203"
+	.string	"\375\016r{\027a\244\372\016i\373\035\314\366;\214\355w\350\332\357\020d\277\203\216\265\353;|e\216\211R\326\357Pc\277\303\323~\007\245\375\016G\300*\327wQ\314\b\221}\311\372\035\206\366)\200f\237\002r\373\024p\333\247"
+	.string	"\226}\n\244\355\037h&\005\250\214\222\271\262\003\245D\211 \213\241\341\305#k`\224\234\003\313\206H\204j\374\310\372\002\214T\177 \024\034O\200S@'dc\204\244\330\310\272\211\317H\032\034;\262>\005\300\366\022 \017\340\220^\224i\205%c\224\266Z\370\360\252\324\214\001\275\200]@%@.\340\0270\nD\002\024\003\206\001\223"
+	.string	"\231"
+	.string	"\301p\024\270\004X\344@#\300#><\25345\200T\275(\323F{\303\223\022\251\223\002gH\261\321Z\323\200K\200I,\244\300\0314\362|xW@\035\275(\3236[2\005.\001*\001\241zQ&\026p\034\001g,\001F\265\001\316X\002\274\001\244\202\262\236I\212\233\352 #\315\335\230a\201>\005\262\366\320\r#\325S@\306>\005T"
+	.string	"\207\374@,\340\016\240\220\274\261d\211\n\223u\220\337\027]^\222\254?\2010\033\b0K]\353E\231\330\026V`\244\300\037@-\034\005\002\001\366"
+	.string	"\002\001\372P\277\346\244\271M\213\252,\252\376\004\266\354O\200\311\376\004\222\354O\240\310\006Ra\034\025\023\301H\025\0070\207\017\211\035\016\251\254?\001)\034\023@\332\227@\232}\tx\331\227"
+	.string	"\031\320\206\232d\344\005\223\365%\300\0038%\001\030\373\021`\263\037\201\267\375\b\234m\f\206\221\252\fu.\352\026\225\365#@d\037'Yb\333Rk\300\027\300&-\322'`\f \f\240\023\216\002_"
+	.string	"\2314\360\305J\266\276\354\2149+\031?\375\bh\355G\340i?\002L\373\0210\332\207"
+	.string	"\233\375\003\221\200-\256\246\030i\313\372!"
+	.string	"["
+	.ascii	"\217"
+	.string	"\252,\3051M\201.p\024\330\002\310\"\203\320\212\212\305\023\255\017\201\263}\b\200\355\037h\204\246K\2207\353g\035N\266\232\34025R\350\264\246\340\262-\323_\336\217\315\357\313\317\313O\314\317\016\250\342\327\006\270\342\027\007\024\372\251\371\311\001\213~u?)\220\350\007\346\207\367\233\373\255\371\215\371\241\371\231\001\276?2\2770?\272\337\231_\232\337\335\017\356W\006G\201C\2777(uX\314\224\242,\310\302\216\264\250h\221\212\251\255I\357\242\364\266`7(\bl\211\221\026\265=\231\202\275\265 \263\202%G\213\356\001\345J\b\300\241\037\227_\227a\357}\257\276\264\2668a2\315\202\313\244H\317p\036\230*fs\322\2551<\245\26526\335#\212\0248\364Kc\223b2\264\021\312\236\214\031\312\323r#\003\016\375\304\260\232\245\267\255\0166\230\242\321\005\204>\004n\374\272\220\r\311S\262\313\372\020\210\332\207"
+	.string	"\213\375\007\240\331\177@\230\375\007@\331\177\200\220\375\007P\355?\240h\337\001h\366\035\020f\337\001n\373\016\310\262\357\200)\373\016 \333w\300\326\276\003\250\366\035p\264\337"
+	.string	"\274\375\006H\367\033\340\266\337\200'\373\r\360\332o@\217\375\0068\355\223p\267O\302\332>\tK\366I\310\261OB\322>\003\356\366\031"
+	.string	"\267\317"
+	.ascii	"\265}\0060\331g\200\221\375\377\276~^=(fJ\240~I~Jp\364\347\365"
+	.ascii	"\353\002\343\302\032\341\347\365C\202\026\354R\242\326B\325g"
+	.ascii	"\200\216}\0064\355/ o\377\277\255\"I\264\312\262~6\3021\305\n"
+	.ascii	"A\310"
+	.ascii	"\217\307\234\226\016\\V\367\242j\r\220\237\217\337\220\237\326"
+	.ascii	"\357\307\357\310\257\307\217\310\317\310/\310\257\b\216\376\204"
+	.ascii	"\374\262\362\335\016+\335C\310/\306\217\n\273a\35166WW\270,\315"
+	.ascii	"O\310\357\006\ng\360\244:\204\374r\264)\241q\302.\332\254\220"
+	.ascii	"e\320_\300\224\375\005D\367\0270d\177\0019\366\027@c\177\001"
+	.ascii	".\366GX\263?B\230\375\021\334\366G\240\262?\002\024\033=%Z\264"
+	.ascii	"\004\311\372# \331\377\1775~R8\372\233\372\311\370\217\006\217"
+	.ascii	"\272\337\024k\006F\035rg\326\244\352\343\2730Z\277\031\277\250"
+	.ascii	"\037\024\216\376h\\\314\217\306\320\001\252(\315U\231v\360\364"
+	.ascii	"\302\261f\353\217 \264/\202\230\375\377`\374\226\354\2608\te"
+	.ascii	"\375\\\324FNJ$6$\244\245H\367\370\271\370!\375\236~-~I\277\246"
+	.ascii	"\237\323\357\305\217\351\307\342\247\204\243\277\245\237\321"
+	.ascii	"\177Gx\372\274\342\212\321\357\305em/\033\335#+\261x\272\307"
+	.ascii	"o\211\315\333\"\315\371-\375T\214 D\351\013\327\364}\301\324"
+	.ascii	"\252\266\2673\031\364\020#\325\213\320\265/\302\217}\021\246"
+	.ascii	"\366Eh\332\027Ah?\004\351~\b]\366C8\333\017!\272\037B\221\375"
+	.ascii	"\020\260\366C\240\261\177v\215zG\346Ei\312Ja\267\364\300\316"
+	.ascii	"\266\024+)\351\224uc\311X%`\310\220\257)5l\032\366\fk\206E\203"
+	.ascii	"\243\354\224-sL\326\353\022\205\235\262wC\210\276\206X}MM\331"
+	.ascii	")k\367\342K\210\205\245\f-\250\037B\321>\2074\373\034\302H\311"
+	.ascii	"\236\254\240\342\252\"\206\255\303Qv\f\333\305\214\345\202\335"
+	.ascii	"\260P\340Z\223\262cX46\fv\303B\241\r\233T\0271\363eF\325t9\330"
+	.ascii	"b\252$\353sH\262\377\263`\3308V\216\375\202\243\354\034\353%"
+	.ascii	"\203\275/\031\234\231\326\373\276seZoR\264\3309\226\312\bPJB"
+	.ascii	"\360\210,\252\246\310\374\3649\260\330\317\021\263\237\003f?"
+	.ascii	"\207\312f\271\340\341\213\261-\032P\3324\004\327\276<y\263~\316"
+	.ascii	"\221\315\306\256\341(\253\205\235\202\306f\351\201\235m3+\027"
+	.ascii	"RV\013k\306\236Y\265\320\372\331\361\240\241j,\031\204:\250\212"
+	.ascii	"\330\310\37296\366\361\235\232\276k\243u\205\255\202\243\254"
+	.ascii	"\0256M\214\265\302"
+	.string	"R\321wKT\276\246\266\336\367\355 C\007\2754bZ\244\252~\316\214\375\034\025\3739\357>\bi\366A\200c\317\364\035\360\205\033\230\031Y\037\004.\373 H\331?[\306\022\3615\t{\232N-\355\320w8\306H\201\310\2619\360\244VF,|\320aM\337,1:\326h\031IEi\t\311\262\272i\371\001\346\312\350h\313\206\222\026\031\2166TM\222\244y\253\306\f-\262\033qHA\326\2449=\302HY\"\254V\233\264\312\310\205V\016K\204\345\001d\227\260]l\024\326\213M\302r\261FX2\366\213U\302:a\305X&,\024\266\b;\306n\261MX0\366\t{\204\215\262H\3300\034e\211\260C\216,\332\3428\350\203\020\335\007\201j\037\004\245}\020\206\366?\260\333\377\200\313\376\007Q\366?\030\262\377\301\324\376\007*\3667\230\331\337\020\267\277Am\177C\330\376\006\036\373\033b\354o\030\332W"
+	.string	"\231}\005`\331W@\331\276\002\222\354+`\307\276\002\234\366\025P\264\1776\212\2451\326\225\005\307\316`\241\330\030\254\f\026\006\216\2624\330\247\367\322\262\216\343\245\037\221\244\270\251)\323\bNKZMPZ,\r\366\005.\373I%\305Mm\275/X\206'F\342n\004\365\023\220\266\237"
+	.ascii	"(\373\t\360\332O@\217\375\004\310\330O\300\320\376Y%6)x\025\306"
+	.ascii	"\254,k\244\336\0174ijd}\017\352\366s\021\336\316\333\242\305"
+	.ascii	"\n\r\261D{\r\327\234\224\214%\3121\262\024v\203\322D\302\260"
+	.ascii	"D;\315V\203\335\260t\022:)\373\3566\303\336\373\016\265i\275"
+	.ascii	"\357\313\022m6\273\rv\203z\337\246\021\316\222\274\204LY#v\005"
+	.ascii	"{\304\272`\213\330\026\254\n\226\005\216\262D\354P~\021&\245"
+	.ascii	"\344\250\357A\221}\017x\354{P\265\357AT\233\343\262'\220\031"
+	.ascii	"L\262\276\0070\366=\020\332\357`n\253\301y\230X\306\207\232\036"
+	.ascii	"Y\277\203-\373\337S\036K]rY?\204\225\316\bR\326\323\024\356\313"
+	.ascii	"\023\351\373\276qrN\242a*X\217\225\bR\326\3234\311\031\206\233"
+	.ascii	"\2416\021Y\227V\246\265G/\312T\201%>\244\357\373B\301Z}\254Z"
+	.ascii	"=\242K\204\334\310\202\224\3654\325jKZn;no\331l\373\313\026\263"
+	.ascii	"\325\266\334\326\262\3276\230]f\327\355\266\335es\331g\266\231"
+	.ascii	"mec\331^6\231=f_\331\322\r\267\337v\225\235e\243\331v\373n\317"
+	.ascii	"\35508\272\3516\3327\225\2356\005\303i\345\330\241\202\365\242"
+	.ascii	"L\026 Z\223ZU\2211c\215\224\006\235ZC\245R\262\262!e=M\351v\224"
+	.ascii	"\233Y\300\342}\257D\251^HYOS0+\213U\tK\225\226%\331t*\232\372"
+	.ascii	"\326\2132]\300J\212:\305\213*\245\007\026\344}\257~\2544\220"
+	.ascii	"\262\236\2462\240\242\312 e=\251ft\352\231*\205\204\025L\254"
+	.ascii	"\213%W\244WiHYO[*\rUj\265C\312zRi\320\2518p\236\005*\336\227"
+	.ascii	"jjEC\312z\232\222\321m3\235\026\245n\251`\350\326\243.\351\246"
+	.ascii	"\333O\266\023\022V0U`\t\017\251\nf\323\251aV#\013X\274\357\220"
+	.ascii	"\017\025\017)\353iK\301e5T\225\006\235Z\205\331, z\337\251\031"
+	.ascii	"\353\0250uF\235U\022\020\372d\3000\216:\204\272\262\337\201\223"
+	.ascii	"\375\016\270\366;\b\262\337\001\216\375\016\242\366;P\332\347"
+	.ascii	"\340\314>\007s\233\214\r\233\025\265\254\317\201\226\275\307"
+	.ascii	"V*;J\302\n\246\023\336XH\205|\217\255E\326\263^\224\311\002o"
+	.ascii	"[l3\331Mpt\217\355\260\257?V k\220\261\275d\313\260\200\305\373"
+	.ascii	"VM\2511\220\262\236\200t4\312\300m}\016\316\3669X\262\221\316"
+	.ascii	"\2328\261\222\365\224}\265\306\3512\303\241\342\373Z\231\351"
+	.ascii	")\353\027}'B\027\321\0137\314\326\003\323Z\231Xi\221\276Zp\031"
+	.ascii	"QW\332TmB2d\265Be\253\370Z\345\300\254s\" \331W\233i[\365\242"
+	.ascii	"L\025 \032#U\253\346\244\357\013\346\303\333WJ\226\204\211\""
+	.ascii	"f]3T\005\001$/\206\332\356\300\264\031\234\336\322e\325\2256"
+	.ascii	"]\323\366\225\212\203\004%o]iS\275\326\265\004i_\351\251/\207"
+	.ascii	"\001\220X\025m\351z\353J\233j\355\245\004\034\241\322\2256\325"
+	.ascii	"f\373je\323=DP\362\302\247c\267x\363\222\276/\330\276\362!\361"
+	.ascii	"q!a\005\223\005\254\272\244\332\214\313\372\266&}_\260\256\027"
+	.ascii	"]iS\037\336\325ze]s\002A\311\220\256\264i\231}\265\322\351\264"
+	.ascii	"^\224\t\304[\231t\352j\305\333E$\254`b\227\336\310\244{k\007"
+	.ascii	"\331]\333\310\326\261\217\354\036[\311\036\262\177l\257\255\265"
+	.ascii	"wl!\033k\177m\260\215d\347\330Ev\222\rd\023\33186\327\316\332"
+	.ascii	">6\017\034\335Wk\213\257SV4 \222!\351\222\003t\025qF\325\024"
+	.ascii	"[\326\347`kj\327\33066\025\216\356\033;\352\253\332Z\345\306"
+	.ascii	"\236\261i\f\213\212\357k\225\245\265ol\030[F/\312\264\233,\351"
+	.ascii	"!E\3327\266\324\017\255\274\265o\354\246\375T\204\312\235\017"
+	.ascii	"\261/?}\016\204\354s\240\203\306\237\2676\324\2261\203\314\335"
+	.ascii	"\222\254\317\001\325\316/\306Q"
+	.ascii	"w\214\340P\f)\\\262>\0072\3669P\332\373I\227\301\323,D\214d\275"
+	.ascii	"\235r\276_\b\240LmJ\326+F\252\347\300h\237\203\241\255\364,R"
+	.ascii	"w#L\322F\342!\005\243\225\365F\022\242\203\022w\264Y\030\261"
+	.ascii	"E`8\tS\345\310\210\375\222D\312\231\025\337F=3S9|\344}A\3010"
+	.ascii	"\203\262\2110\2215\033\004\331\307\321=\264\205\326\2424amYo"
+	.ascii	"!\334U\367\206&\353\265\315\232\367\237\335ZKB*\326\274\325\305"
+	.ascii	"\225\26564\330\260d\340\266`\261\321w8\202H\351\312\372\033X"
+	.ascii	"m2\031zM\212\220d\375\177M\203\243\253\232\265\216lU\263\216"
+	.ascii	"Y\247V\034\320H\252\322\n\276,\322L\321\372_\247+\032%%\351Q"
+	.ascii	"\326\353\031\226\355\t\006\226\254\257A\231\375\257ept5S\267"
+	.ascii	"\301\215!NY\337\314z\367\237\315:\340\306\250\311\372_\357\276"
+	.ascii	"\3321\275MfdMf\255k\352\022\226\3655\350\262\245k]\276"
+	.string	"1\344\245)\353k\260e_\203\262}\r\310\3665\370\332\327\340\310\034\036\313Tgx+bd}\r\2566\326`\306\276\006I\373\032\020uY\337z`R\260t1\323\005\314>\002\326\366\021 e\037\001]\373\b\310\332G@\2155\013\321\355G\025)Y\037\001J+\026\004\b\355\037@\272}W0R\305\007\220\333H0\214\243\346-\214T\315\200Y\342\220jd\375\003TY\241\254O\360\030\033-(\353\326\332\204\013o\205\262\222\3413HYO[R\326\2625\n\216\256PV'_\207\254D2\020\340L\013l\353\037\200\311\376\001\210\354\037@\253\311\277\032Y\217\254L2\325\332\027\324Y\326cxDwA\262\376\001\260\366CH\222\323u\263^\224\251\202\026o.\274\230X!I\271\326\260\365k\215\256KV1\034]\301V%\307S0\332\n\266\"\021K@\220!\\1\246\035\254S]\256\234\005\365\017p\265\177"
+	.string	"\251\375\003\300\330?\200\322\376\001\214\366\017\360\356\033"
+	.string	"o\367\3340\216\n\001\351\326Q0R\315Z\030\251\366\f\340eg"
+	.string	"\3038j\357\b#\325\036\030F\252Y\005\370\222\"\312\372\006\260\262\247\234\344\2642RS\016\315e\265\302ndZ\272%M\216\025\307\234\216u\307\312c\305\302\3215\307z\245\263\264\200A\375\364\rp\266o\200%\373\307J\326\027\353\323Z\205\273\336\256\255\254o@q\"M\312\372\006\320\332k\2155\206\346\222\241\323\206\326\032+\224N\303nd\332\210\231t\215Z\245V\252\325\306:\205\243k\215u\006\031\214,Zk\215\225\306\220P\003\214 uI\262\257V\f\271\n\352\027\240\315~\001\350\366\013\320e\277"
+	.string	"k\373\0050\333/@\330\326`\030G=\031F\252/"
+	.string	"\222\375\002\364\330/"
+	.string	"\216\255\236\255Jk\022\031\330\224\243\254\221z\\\210DY\311\372\005\210\332\253\213\265\205\3125\206\210)\353\027\240i\277"
+	.ascii	"E\373\004\230\256F"
+	.string	"\277:\247\322\255+t\335\327\332P\326\253\212\240\2230E+\262>\001\344\366\377uh%\302\321\265H\035\243\327\"\265NL\221*]\205\260\033\231.S'%\3720\363\224\244\352_%\363U\350\307eT1\353\033\204e\313\215\254\363~8\322\246k\262>\001\250\354\343$@\262\326\250S5\215\212\247\266Q\321\250jpTe\243\336]-\243\232\371!'=\003&\210\2173rv`\244l\304\250.\244Yl\024\365\tp\266\261\033\306Q-\300H\365\004\350\332'\300\326V\215r\256\222\201@\326\025W\326'\200\220}\002T\355\023@\306^\t\320b\343\270a\0345\263a\244\272\202\231\331?\252\270\375\033\300\224\375\326\305i\006\023\254\254\271\250.\234D\305e\375\001(\331\377\3256u\013\216\252n*\233\352\246RQ\327\260\033\031\nhl\252\233\252E\375r\312\341B\312z\232\276\357\253\241\203\016\206XUvP\252\376"
+	.string	"\230\3663\300\333YZ\210\363\222\221\3653\220\356c\261*J\264\254\250iIT,\352\025\034U\255\250j,\222\033[+T\375\f\352\3663\350\262\237\001\333~\006e\373\031xm \025F\252\317"
+	.ascii	"k\007\2310R"
+	.string	"U\313\330&I_\332d\375\fd\250QT(\300\"wwg\352\223\253Pn&L\322\366\342(kULu\362\237%\016\321\261\201\241:Q\311\316\210Aqe\335\344H\022\264\247\254\237\201\322V\231\250cA\243\035U\214d\375\fT\354\233\271\331\177\026\027\221\202\344I\326\307\240n\037\203-;H\205\221\252\016\025K\375\002\346`S\003\225\265\327.\343au$\353cp\266\201\\\351\021uF\226\345\205E\372\343\212\326\373\276[C\332\260H\203\030\271\"\345\201\265\252`\361q\263!\373\276W\272\316T$\352\021\265KM\242\032Q\271T%*\021u\013G\325\"\252\020\265\210\252u\263a\021\330\333c\245#Zse\372\276/\020\352\354H\356F\037\203 \373\030T\355c`c\037\003\251}\ff\354c\020c\037\203\027\373\0300\355c\220\264\217A\213}\001\250\331\252\033\306Q\037\006#U!\023F\252\027\300\334\276"
+	.string	"\334\366\005\200\266/\200\255}\001X\2516\3264.\274p\311\372\002p\241N]\300f\377\002\351\376\005_\366\360\305H\365\027\260\355_"
+	.ascii	"e\017\231\324\030*\f\255\327\314M}R_\340\250\nCu\312`\357+v\307"
+	.ascii	"\244\357hh\2510\324&}\027\302\013:\256-\017\254\205I\243\352"
+	.ascii	"_\360\264\177\201\322\376\005F\373W\227T%\025I\354\344\262N\002"
+	.ascii	"+r\021c\r\233\254oA\335\376\bEH\264Tli\261P\221T\0278\252\266"
+	.ascii	"PW\\5\352\215\025\345\250-\324\243#V_\316|\304~\334\330\372\026"
+	.ascii	"t\355\036F\252\267\240j\337\002\250}\013Z\354_%R_#o-\222\262"
+	.ascii	"\326S\324W\243\351\264a\021\330+\244\212y\373\232\232\232\251"
+	.ascii	"\257>\273\373\232\232\252B\352\220/\317\327\006G\325\327\267"
+	.ascii	"\346><\037\033=E}\265"
+	.string	"\232\030-\365\325:|j\260\033\024\330+\264\226-\371\232bqD\351R\365\323\300\027\343\250X\013#\325\007\200\313NC\224\346\3074\353\007\340\312.\023\306\327\305\007\346\205\001\250Xi6\275\245\027e\332PT$I\265|E\226\344ii7]g\265\301\224%]iS,9j\003*D[a|Fn\206\335\310^\025\321\004|\275\275k\230\r\003o]i[8\215/\214\316\202\331\f0\345\256+\315\027FO}9HX\301T\001\034a|H|\\, :z_'\021\276\226\3404W\336!!\021\250\274\350J\233f$_\030m\246\205o\352\253\363\225\361\221\361\331\371\320\370\314\370\346|b|R\037\235\357\214\357\3167\006G}a|X\327U\264\225gH\022\306\247\303\007\204\204\025L\254\322\330\221/\214\036\243\313`7\254\367m\022a\312\220\256\264\351\373\276\303%Rgq\002\320r\230\210\212/\"Y?"
+	.string	"S_p\324\027\347{\363\305\371\274\370\340\260\033\331\3736%"
+	.string	"\311\013\256\030S\034\265F\264Ek\037\334uZ>\003\343T$\353\007@h\037"
+	.string	"b\366\001\320\266}n\032\210W:\206\340\262>"
+	.ascii	"\244l.\237\222\036\230\026\b\"%6\337\026\237\026\034\365\265"
+	.ascii	"\025\371\332|^>4\022V0\255@\224$m\363\255\235\315\002\242\243"
+	.ascii	"w\350\006\bA\326\b9\243\231`a\261\261\365\001\360b?\033=\321"
+	.ascii	"\200\335\260( \004\212\324\f\t\031\232\357\313\347\304\002\242"
+	.ascii	"\243\024"
+	.ascii	"\256D\221F\271\332\220}\337*2-)\\o\331\006\330\215\354\303Y\022"
+	.ascii	"\351\373\202\241\371\316\256\366cK\372\276\257\017\315\007E\203"
+	.ascii	"\272#\013\b\323\364\212/\213\217\212\317\212O\315W\305\207\305"
+	.ascii	"\227\206\243>4\337\224\016|L\306\246k\216\372\032\244\354kh\262"
+	.ascii	"\257\341k_\303\221}\r?\3665\350\330\327`c_\003\f\262(Bc\272,"
+	.ascii	"e}\rEc>&8\352k\342\213\202\371\226\\\211\321j\342\023\363-9\212"
+	.ascii	"\241\313\321\223BWfL\325\317\260d\377\276%a\3006Jj\264\t\363"
+	.ascii	"E\207^@\220\256\262~\206\254\375\fW\373\031j\354g\210\261\177"
+	.ascii	"_\222#\276\255\034%\002\237\023\026kFY\373\272r\356K\242\002"
+	.ascii	"\013\311)k\r0R}\206\245\375\f-v\006\3038\352\006\030\251\036"
+	.ascii	"C\336\020\037\021!\001H/\244\0272\252\332-\3051\005\277\324t"
+	.ascii	"Q\202\004;2\212\374r\022!\223 \223\020\303b\f\231\346+i\352v"
+	.ascii	"d\375\346\230\255-$\027Y\003p\224\271Cr$\327\223\027\252G\023"
+	.ascii	"\013\021\"H#X\264zB\320\312\340\0259\322HN\"\346%\251\311\004"
+	.ascii	"\251\205\324B\ni#5\006/\230\007\305K\220 G\ny\335\333\327\027"
+	.ascii	"\271\346\217\0349\220?l\254\\5\354\330\264\026\252)-\220XG\376"
+	.ascii	"@\372\320iDh]| {\\QZ\313\312:K\323\200\222\206%\3537Y y wL\341"
+	.ascii	"\240\021\227\365\177\3606R\007\316\363\022\227\004kh$X\306\205"
+	.ascii	"IY\326\377\211C^!\257\256\020\313\264\311b%\353\377\244!o o "
+	.ascii	"\253V\0325\350\246>\026NNh\220UpsG\334\200d\375\237+d\rd\r\244"
+	.ascii	"\215\fTBf~1`\320\t\351e\3050{CN\035i\203\250H\217\262\254of8"
+	.ascii	"dK\f\334\214\254\377C\344t\344\223\0232\252\367\005\203\275P"
+	.ascii	"TBd\032\260&\352\"\312E\306\221QG\322\3400\302\305l\031\3712"
+	.ascii	"\2245r\006\022\n\031\343b2\0211Hd\262F\302\270Z\020*n\252\003"
+	.ascii	"\371\202E\233\302Q\225\365\327'_\242\264\262\276\017\036\222"
+	.ascii	"\t\311$\035\256(\262A\307\202\005R\t\207\275K-\274q\305\330\022"
+	.ascii	"\316U\261HC&\035\251\024\203EUU\326H\244`\034\361\213\\\221 "
+	.ascii	"Y#]\004\343\260xH\031\311\032\331\"\030wFH\2316Z\214\214\216"
+	.ascii	"g\357\025Am\260\325\362\310\222\262\276\317\030R\005R\305\361"
+	.ascii	"\255-\210\344C\212\324\007R\b)\204$\302a\357\322\211&\035D\266"
+	.ascii	"\220\214\254\220CG\022\231=Q\222w\305'\006\0336\307\274\fTBh"
+	.ascii	"V\274\032_g\2048~\220\0359\266\3711\317\303\n\257!\027\304\254"
+	.ascii	"Ys<\203\204K\234\335\024\254\314\322\022\265\351\364\230&\003"
+	.ascii	"\225\020\031\003tM\211\263\023z\321\243+\r\036S\341\205\205d"
+	.ascii	"\311\321\314\321\314\361\f\215!\023N\302$\r\23338\357\227\025"
+	.ascii	"]q#\353\273\320egw\274\313@%\204F\315\"C\215t\312\003K\314\235"
+	.ascii	"\031T\026S\326w\341\307\021\356G\271#\334QJ<\222R\233\200H\346"
+	.ascii	"\214\244\321\375(\375q\f\207\021\256\026EN\013+"
+	.string	"\353c\335\215ywL\216\262\376Q\f\033$L\2246Y\037\303(\340?\233k\250\271\201\227\365q\356c\262L\231Fe}\004\3631\302(Q,\251\243\212^\233\325\033Q\326\307\270\343\027\027t\270\271\035\337\262H\215\301\233\016\217\276\304Du\371\361\315\007\206HY\224\254\217\\\212;\266\272v$\035\313\210S\"9\310\262\276\013K\301\252`\325\261m\307*U\343\b\032Q\351*\013Q\333Q\013[\033[[\326G\266\025\204\030\031\001\227\343\332\021\313\021\0130M\247)\222t%\353\217\240\314\212\025\"T\006*!3\300*RsLS<)IuY\177\004D\320\320\216jOOB\262la\273*$,\322~T[\263\332p8e}\244\242U\f\301\243\302z\362\344x6\267\266Y#\307e\366\343\031\214\245'M\262>J\371\345X\023\262\221\365\021\312\261\f\357\240\323RV\026%\0049'Z\301\271'[\314\214"
+	.string	"),\354HF\2475\204IIG\223\037\311\f\360cM\216\254\217L\212;\3060\341"
+	.ascii	"\222\365q\311q\254k\314\025\262\343\330QL\r\207\022\027j\336"
+	.ascii	"\226\320\324)Qr\004;\223\032\203\307Z\361\370\362\344\353G0\266"
+	.ascii	"\315\264\213\232\254\217^\305\035*\244x\204a\252\035\267\216"
+	.ascii	"[\307.\314\025c\310tk\345\242#z\344\302\321cW\321\332\223\254"
+	.ascii	"\217HzY\204yj\362\304\230K\206\f9\032\321\200\366\223z\252\n"
+	.ascii	"R\344G#D1e\214\240\262>\022)\356(r\267\243\211\331#\353G Y\307"
+	.ascii	" kZ\206\035\31055tL\247\357\221\324\006<9l\260i\375\030\344l"
+	.ascii	"j\336\330Y\325\361\307\032\007\267\026\226\365\321\207/\352\005"
+	.ascii	"\035\221\036?\033\304bk\263\313\372=g\366{\306\340\300q\334\221"
+	.ascii	"\201J\310\256\001i5r\234Q\313\274`Y;\216XJk\346\314\260\216:"
+	.ascii	"\3220\211\0265\331c\216"
+	.string	"\200\250\311\001,\362\377,\242a\262~\017\331\321\352hu\274\201D\313\013\251\247\213\212\352x\003\207\275K\026\224\251Q\325F\212\364J\213\343\215'O2\332\246Y\277'IJ\3528\205\303\336\245\006T\351\250\262\325S!\267VV\343\307)\017\270\234\304x\332\034_\034_\034i\024\t\323Q\205\250V4\307\3448\343G\032D\254(5e}\204\022>\t\263\245D\344\330B\221+h2\2161\270\230\231\362\224\365\021\006Pj\355,H\326\347\271\333\307'\375B\333\250!\343J\326\347\331r\\:.\035\2332P\t\221\331\300N\252\215\323t\r\233\302B\310\221\351\307&\f\267\202\213\254M\326<>\216I\307$\"\024N[\214!\323\251\026&?\242d}\236\027\307\243\343\321\321E\0065\354\f\027B\216-~t\321\245\253L\215\254\217,zhVN\312\230v\324\234\271\021\357\314q\005\221\f\277/\324KT\364N\331"
+	.ascii	"\300\026)41\246\357\021\324\006\3022\032H\250\330\374\270\342"
+	.ascii	"G!\016#\034U(\251U\235\311\3728t$\302\321\257\035\213\016F\034"
+	.ascii	"\242\0319Y\313\372;l\373\370kj\n\360\327\324\343\373!\224\026"
+	.ascii	"4i\3267\2661\346\375\354o\b\016\261#Y\177'm_\001a1\232\232\214"
+	.ascii	"jn\\\363\263@/\265\025oY\177'\3126NoL\363\2638\207\222[\227\254"
+	.ascii	"\277\323d\377F4?\033$\323#\006\217\254\277\023\266\277\323eg"
+	.ascii	"g,\203\223\304\0302\335\032\226i\002\003\357\356\3062j\030\r"
+	.ascii	"\2212<zh\304#k\\|\311\372;:\352\352\214R\034\366.\335L\245\306"
+	.ascii	"\340\251\301Rkc\034s\243TmimNI\326\357\241%\001\022\3276&.\316"
+	.ascii	"\030\346\275\242w\352K\235b[\034\001\343%wc\030#\335\016\025"
+	.ascii	"9\326\2626\316\255H?\234\274Y\277\235b\0043\006\206\310\r\243"
+	.ascii	"\254\337j\275\275\031\341p\330\273\244a+\306\220\251O\n\021\334"
+	.ascii	"\017/8j\204\363u\241\201\311(\373\317\372\254\316\2041\313\372"
+	.ascii	"m\025\027.F\033\031\250\204\310\034 K\214\2724\365H\215*W\262"
+	.ascii	"~\373\264e\013\021\n\207\275K\303'\2519\246\255\367\205\332@"
+	.ascii	"\003*U\332\2141\256\031\327\214Z2P\t\231Y\361dtQ\323\343b\361"
+	.ascii	"\305\006\333\215Z\204f\306\334\274\262\276\031\f\367\237U\333"
+	.ascii	"\226\360\324d}\2358\215\244\221\214X2P\t\221\341\200"
+	.ascii	"I\352\313\326\364}\2416\320:\324(\231\313\332\210\305x%\315\f"
+	.ascii	"*6Y\033\255\350\340h\222\226\365u\226\354\337\250fT#\276\310"
+	.ascii	"\305\367\265\232\236\275LP\036\374\336\234D\321\310\372:@\204"
+	.ascii	"\334\210\304(\304H\245w\004\365\276\350\340-\311\376\301\364"
+	.ascii	"\225%k4\260u(\356\013\226\254\257S\005%(\004\314\013#5r\321I"
+	.ascii	"\225\030\277\260\033\026\005\214l\221\372^`\233$sP\214Q#\231"
+	.ascii	"\224\251\364}_#\024c\022\\\206\335\240 \300%Wf\234b<3J1>1F1\232"
+	.ascii	"\341\250\021\212\021\314\b\305\330\005F\372\276`\3042]Md\024"
+	.ascii	"uP\350b, :B\301\253Njlbt\202\243F\262\033\311\3261F&\rh\223\352"
+	.ascii	"\222DC\007B;/rQ\252\376\215L\214cQ\300t\334em\024\203\222\261"
+	.ascii	"\246\"\353\353\f\355\337\030\206\243\306%\333\314\326\2245\027"
+	.ascii	"c\205\207\025\336\376r\3146zm8i\215\266\254\277\004\263\277\204"
+	.ascii	"\333_\266\355/\261\354/\323\266\321\210q\213\310u\226\003J\326"
+	.ascii	"7\036\371\317^\200\307\026(Y\353\"y\r\210VR\3267\022\031\312"
+	.ascii	"\375p\022\315\372\306!\377Y\037\224\27423\262\036\026\355\025"
+	.ascii	"K&\032\374jH\261\021\225\365\227?p\334\b\304\210\303\250\225"
+	.ascii	"\243`BC\"/)\017\362\333T\346\245\255\224\231~em\3142\3720\376"
+	.ascii	"\370Y\226\n\322\233T\326_\346\3307\366\300\352\342\243H\326\031"
+	.ascii	"_M5\356\270\221\307\317\256I\230\212\234d\375\345\215}\243\016"
+	.ascii	"#\326\317\366\330\260Qa\221\365\2273\366\2159\376\263)\240\273"
+	.ascii	"\201$\353\341\212\275b\331B\003v.LLV\326/A\267\177\243\225\321"
+	.ascii	"\n\303\241@5\344d\200-St\020\031J\031%\255\301r\343\0061,\277"
+	.ascii	"\357\373j\255W\362\306H\365\224\016\261)Y\277D\224\251)\243\215"
+	.ascii	"L\345%\257M\372BAm\300\206\321b\204J\326F\033e`\232\266\224d"
+	.ascii	"\375\022Gf\3140J\241\360\336\344a\321\201\261#\315\030u\243\224"
+	.ascii	"\0321\211\226\023\270\254\2154J\330\330\2771\206\321\311(C\210"
+	.ascii	"\366b\2034>J\270\330W\2321\276\300Q\343\013\343\323\357M\256"
+	.ascii	"7E\004nCr@e}\345\227\246\246\024YFm[C4fd\226\254,-\021\303\266"
+	.ascii	"P\006%?\202kTM\202d}%\3306&\031\223\210P(\274\330\007[\246\302"
+	.ascii	"\346\255-\353+y\030Y\030]\030Y\020\303\214-\214-\210a_N\262\340"
+	.ascii	"\021ae}e\324\276R\205\321\310hTLr\302\313\250mKjTaTA\f3\363\245"
+	.ascii	"\205f$\272\221\210\030\226\301\373\276+^\024e\314dIE@$\215Q("
+	.ascii	"\215\361-\252)\2521\276[(\303\335\023\250\r\200+\310\220\270"
+	.ascii	"\345"
+	.string	"\335\370\256;\356\254\330\262.\266\021^\371!\231ya+\262\211[Bb\205M\021\317\307\2200,\3046\226\224\223\030k\204F4h1Q7\276\262\276\b\254\366E\340\002\r\032\314\226\341\025\"\003\302\3274iwW4sW\246\314\227\232d\227\375$\224\375\342\030\\$C\006\227ex{tc\214\332\266\214\354c\\\246\376\302#\302#*\r\031j\244\300\033pX\222d-\246(&KLR\250HW\2443\313\022W\004\023''\247DL\224\375\020\034\331\177\021\256\b\027\025\002\034\\\212o\\\210a\352\373b0\252%\246\027\212i\203.]\210a\370e\022\001\215\215\020\254\330\007\201\333\376\360\013\027\333\212k\305-\030N\277d\357\220\223\bS\270@Pe\037\004O\366_d+\262\r\200\211x\306H\215\254\254\017\002\257,Y\210P LA\362\343\312\025b\330\221(\020L\355\037\250\006T\003V\331\200jH\310"
+	.ascii	"\322d\314=y`J\004F\3558ZT#6\365\216\250\336\246\b\340\t\323p"
+	.ascii	"\341\b\222\365?`\005h%\b\205+F]Z\220\r\207\023.W\200WX.\033P"
+	.ascii	"\rUe\240&F\027<a\020\2561\"`\026`\226 \231\016{\205\326\251\244"
+	.ascii	"\270\251\255\262-!-\316\316\210K(P\275M\r\360\032\346\020C\245"
+	.ascii	"E\326\377@\232\375\027\245\340hQJ\020\f\005\252\327\211\204-"
+	.ascii	"At\020\301Y\220\\p\311\372\037 \023%J1\t\025\256\267]|R|B\204"
+	.ascii	"\302]xQ\310\310\272\262>\240d\377A\253\240\025.\353\025\275S"
+	.ascii	"X\253\235\214.j\246fKd\004\311\032\f\2548\326\245E\354\305\261"
+	.ascii	"\341\025\035w_\262\276\231\342\222^\224'i\260\226\024\303"
+	.string	"\240l\321\001\005DK\365 \363%\032\304\021\324\361\277NVu[\262\376\007\226\274\274\210,\330\242w\210\013\310\305\262\370\342\243,\353\177\340h\027\271\212\\\305$\030\002S\306hu\275\230d\230DM\232&\353\233\3312\376\263I5\036\323\254\357\0015[[S\314\206\340hqH\321\b\n`\257\0201\351I\321\310_$R,\002L\343\343\007\030(Ygp\3038j\017\t#\325{ m\377\305 \305 4<\020\006\004\b1l\210\013\017\b\361\341\003\210\267\001\330+D\364Q\346\201\252\342U\361\252\230%B\221\"\217\027\263\264\022,?\316d]\314Q\3341D\311\313\244\270\243\210\245E\343\216\315\220*\006\221\032+E\035\301\241\032N=\276\262.\342X\327\332\254l\\\r\306\224.-Y\277\003\322\375\027\251\212T\305*\266\350\255\332R\331\226\342\230\354\272\254\be]\274\241\325\036C\272\266\262~\007\334\366;"
+	.ascii	"e\377E\251\242Tq*K\245\261\364\266\3453\3225\007\225u\261\306"
+	.ascii	"zd\315\017\273\254\337\001\260\375\016h\355\277\bU\204*\322\350"
+	.ascii	"\025\275T@~W~_dSy\305\031Mzt\301e\375\016\334\330\357@\322\376"
+	.ascii	"\213O\307\321\342S1\306\226\312\244\204\306\311H\324\213F\326"
+	.ascii	"E\030\275\030Tk~d}\016\260\331\347\200\334\376\213L\307\321\""
+	.ascii	"S\321i\003\252\367\005\007Y\224\276pM\271\216\334X\312\272\330"
+	.ascii	"\244\026f\254-\353s\240\312>\007\276\366_D:\216\026\221\212J"
+	.ascii	"\033P\r\r!a\310\335\327\324tm\215\223\265\254\213I\371\f\032"
+	.ascii	"/\251\254\317\201\035\373\034P\332\177\361\3508Z<*\266\360\025"
+	.ascii	"\275C>\206IT4n.\210\262.\262\220\002y\343\222\3659 \264\277\201"
+	.ascii	"1\373/\026\035G\213E\305\025\275\242w\250\353\307\225\0247%\245"
+	.ascii	"\302\365\026U\b\2477\246\322\262\376\006\330\3667 \266\177b\033"
+	.ascii	"\034%\266)\016m@\365\276\310iK\362\022\"\035\213*\025\207~b^"
+	.ascii	"\361-\n\241\035\001\203b\225\324\272\034\311\372\207u\205\207"
+	.ascii	"\207\313@\300\257\321\023\025I\322\367\275\342\201O\rZU\\\326"
+	.ascii	"\337@\323\376\211j\216\243D5D\0279E\357\220\215\037\024R\326"
+	.ascii	"\023\233'6\274d\375\r \2359C\234n@5\364d\200!T\350\270\226XU"
+	.ascii	"\265 \242\311hi[\310d}\r\334\355k@m\377\3042e\222h\240\311\376"
+	.ascii	"\211R\034%J\211v\031\250\336'\003\034\241\362\345,\306\221\251"
+	.ascii	"&\231hw\"\031\021\210=\315\321\330RRE.\353k\340j\377\304\272"
+	.ascii	"\343(\261\216\230\224!\354\025Z\315\254\276\246\344\242nh\262"
+	.ascii	"\276\006\250\366O\234\303Q\342\0341L\016{\205\200fv]1~f\310\314"
+	.ascii	"eM\244\013!\005J\226\254\257\001\247\375\f\344\311\311\351\273"
+	.ascii	"$\036\031\020\363\345\313\025\341\023'k\276\336\274xY\013\242"
+	.ascii	"y\321\210\311\372\031\350\322\205h\204\215E\357U\231\326\373"
+	.ascii	"\262y\360\233+\313z\263~\006\310\334"
+	.ascii	"\334\210F\034<\305\270\333\232\276/\233\007l\r\034DPY?\0037\366"
+	.ascii	"Od;\216\022\331\210m\031\250^'\b\004\031\252j\223Fe*#k\242\026"
+	.ascii	"\247,mWY?\003N\373-\264\311\222\345fg\213\336+rZ\357\013\345"
+	.ascii	"\001p\215\225\266.Y\277\205\272+Wn\206\002\225\212h\003\274b"
+	.ascii	"\324\245\365\224\262\330h\312\372-,\251R\205\b\205\245\256\205"
+	.ascii	"\037\373\230\r\023\251\374\034F \232\021\3230\233~\241^!\273"
+	.ascii	"\f\324\330\264p\265\337\002\324>F\202\211g8J<#N\031.\tC4\nR\261"
+	.ascii	"!=\255e}\022y\233\t\023\242\024L\006\004\265)\261\354D)@\025"
+	.ascii	"vc\246\262&F\341@\226\"\266\254\211Pr\024\021L\2250ZY\023\237"
+	.ascii	"\004\273$EQ\313\232\350\344c~uQ(L\262&\222]"
+	.string	"\255\267\344\310\034\233\254\211M\202_\244\346\324\262\276\231^\226\377,\320J\213\027-Y\237\004\335\376\211bb\030N\203\275M?\037J$\322\242Qb\030\0206a]\210\374x\222\365Il}}\341\262\fTBv\031Lct\301\323l\306|\331\221\365I<\355\237\250$JTB|\261\301\3736u@\224\004\312\003\022\024\335\220\313\372#\220\034G\211H\210](P\275/2\b\022\215\263\323f~T\021eM\344\2322\346\310H\326\037Q\267?\002\313\221#\275\245\336\021\325\220\225\bA\204T\265\231\276\357\025\017X-\\\314xe\375\021M\206\f!\026\331\357\373\n\325\021\211\234X\304\347\344\312\356H\250\026\365\242\"K\326\037\261c\237\b\004\023\203\004\021\242a\246\r\005\n\235tD\324>\026\242\251?\361\307\017<\246\213o\221\217\036Zk\366=\300\304\036=\360\030f\332O\222\262\244`\366O\344A\344\201\303d"
+	.string	"{\235~\\\030\265MY\330\262\177\"\026\021\013\217\241@5\3444"
+	.ascii	"!1\206L\037\020eA\307\376\2119~\016#\340(1\007f\303`\357\322"
+	.ascii	"\232\344\203\205\245]UE\274\302/\323\373\006\221\"^\275.\250"
+	.ascii	"dIL\231P\317\361\220\322e}\f\264\331?\221\212\n\347\211\330-"
+	.ascii	"|\324\220\316\355\023\2450qjJ\337\211\330-\222\260\244/\323\353"
+	.ascii	"\3011pe\037\353;\365'FE\211Q8/\203\275L?\037R`\036\034\003b\373"
+	.ascii	"\307f\330\f3a\213\336+\254\237\232'.\247\341\03138\220d}\"\f"
+	.ascii	"b\214\023eD\2112\210P\354\373\276/\324+t\227\001\032$\243\266"
+	.ascii	"\351\013\305\264\301\1773'B\005\031b\205\224\3651\220c\377\370"
+	.ascii	"\371W\337!\246\367}\235|`/\023QP\375\361\261\017\343\r~!\356"
+	.ascii	"a\002\374\327?\007\262z\336\267\207\032\221\367}q\231=\304l("
+	.ascii	"*\203\027\303\373\276MGE\257\020>\022\253j:\022\253b2\036\261"
+	.ascii	"U5\275EM[EUT\370\250\250\212\211\251\350\0252\276bULGoUS\361"
+	.ascii	"\025{e\034\211\r\t\341\243\242\267\351}\253\336\342{4\324\364"
+	.ascii	"\212\2011\031\217\304\252\230\216\304\252\232\214GbCMG/\325["
+	.ascii	"<\002\273bz\301\252\204\214.\304\206\232^1\252&\343+V\325\304"
+	.ascii	"B\310\224)\tH\233\342x\302D\f\013\026n:*z\225\222\244\206\230"
+	.ascii	"\212nG`T\257\334\373b\262\025/\323\353\366\276\004x_)*&\271!"
+	.ascii	"\031\370\214\310M\211(\312\020\025\006{\337WC\022\221\025\325"
+	.ascii	"[\344&\204_\267#\"T\357K\204\250\347Mz\337\367\025A\b\314\355"
+	.ascii	"\335\201\335\204\256\244^\244\025\357\013\200\027\354}\223\336"
+	.ascii	"W\b\277n\357\373\n\275\357\2732I\201\275/\215\342\221VR\322\373"
+	.ascii	"BeHz\245\204\246\254x\337L6w\326t$fE\2253\205\211\230\326k\004"
+	.ascii	"&\204\217\220\250^\255W\256\212i\213\tE_\244\367}\361\335\326"
+	.ascii	"jza\2275\030\330\373\202\021\201gSN\236\262&:\345\2201\245\224"
+	.ascii	"\365EH7\221i\0047\316"
+	.string	"\254d}\021`6Qi\230\346\215\tX\326\027\361\266\211Hct(ue}\021Z6\261\005\2274%HY_D\225M<\362zZ\341\225\365E\210m0\250\2432\257\254\177\342\nb\021\220\313\bKV\035\216\016\353\210EG&\r\340\220#\372\335\231\261\362\304\204\242\0301\310\2348\364\257K\3031D\241\255*s3\262&\276?#K\310\\\311\372\"p\240!\263\223Rd\006\312]\031\232/\262,fZCh\206e\242\244\031\266\031\342\r\247C6C5\303\274\341\032\034\035\242\031\236Qa\034\341rt\324\027\261b\177\0056\373+\230\331_!\314\376\n^\366P\232\363!\031*Q\260\204\311Z\004\214TGXa\212\030\272\236\023\026:\266\300D\207`\206tG&\r8\341\222\276LO\036\244\005\251\354\306\320\b\222\365pn\210\026\244\332\341\302\007\225\254\277\202\227\334\027\225\n\215\231\250+8:\2742\374\002"
+	.ascii	"06\340\362\f\037`HajQ\244C/\303\267 \022,\031_\262\3562\224j"
+	.ascii	"b\322\225\365W\230\361\243\t\2227\313\032\327\232\217\265\255"
+	.ascii	"\341\226a\333\320m\3106\3442\324\202\243\303\265!\226,\273#\271"
+	.ascii	"\241\376\nK\373\027\230\333\277\200\025+C\265)5\340|d}\214\004"
+	.ascii	"\017\307pt86TC\001\354\025\302\340\304\311\223\007i[L\b\222\247"
+	.ascii	"`\234\023 5\206T\376\2144d2D\013\376\304|i\231\312z\312\273:"
+	.ascii	"\251Q\202$\353"
+	.string	"_\340H\riQ\223a\331\320l\bex6\214\202\243C)C'OvH\337\027l(\245\347\326C#a\005\023\333\002\207\224\364\305P\312\220\f\207\r\243\266i~!\345\n\220\240\376\005\264\366/\300\264\177\001\243}\025\362\266O\2050\373\037\212\201)\241\362\332\312\032\354\006\352\210R\326\037~\341a4\212\3410\323~\222U'}\231\316<\270\ng\373\030\303\251\377\360Htxd\350\245\303\336&`\026\030(\017V)*DsY+\031r\221\276\220\312\372*,\031v\341\3500\311pk\230d\210d\310uE%\002\203N\310\220\214\023\037ez\310\205\341\262ZF\306W\223\254\257\302\325\276\n2\366U\030\332D\206E\206g\\\230\261\"\206\310P\b\025\215%CY?\005\270=\f\342\003G\207>\206@~L\027\020\343%}\231\230<\030\376\320bJ\324\222d\375\024\320\366Sh\262\377aVt\230\025\324\312"
+	.string	"\366:\021\223\276R\350\332\377\220\307\020+\207\335\222Uth5\304b\217\336\327)\203 a\214\332\246/\023\223\007\377P\307\207X\377\360j\210\243(\237em\235\311z\230#\347C\035\321-`\322\262\316P\030\251\032\3110\216\232g`\244\372\024t\354\177X5\274!\3641$\214hH\205\225\272Pa\223\365S\240\332\275)\"x\337\"\237\r3Paj\034G\2075\206Q\031\366[\304\266E\372\276P\036\004\347\224\216\344\310\372)$\355\177(5\214\3722\212R$k\032J\242\250M\311\372\026\310\333=7\341\333\232\326P\306p\006\216\016\241\206/>|\032\302\030B\rc\b\337\240\204U\265\311Q\256|mQ\365-p\2673\023\306Q\t\200\221\352-"
+	.ascii	"7t\022\001\033\037.\2660}\330t)!W8\262\026\256\345|\310\344\233"
+	.ascii	"\261v#+\351\303\245_\350e\250\224\243D\300\343I\n\232\254\361"
+	.ascii	"\026\306Q\205y9\037&\t\261z\0301s\361!\222\232\007\244\fR\326"
+	.ascii	"\031F\316\207.\212\236\236\374\030\262\370\260E\024\326\306S"
+	.ascii	"T\227\254\205n9\037"
+	.string	"\262P\333\244qAf\364\341\321\207YpXQ\312Z\230&\347C# \22456@T|\270\342HQPc\262\036\022\345|\250\"\003![[\033\016}X\364\017\211\262\322\013yl\320d-\304HU\347\310\371p\b\330VE\372\325\346C\241_\2307|\201\321-xH\262\306Z\030G\255"
+	.string	"#U!\231\234\013\333\020k\374\020\202\302\273\220\315\257\305\364X\216\022\201\217$\036O\262\026\212\311\271\020\317\254k\313\325\364\3025\2770\215P\r\206\361V\255\310\032Ca\034\025\211\221\252\320L\316\205S\326\211\232\034V\312\\\210\346\027\232\021\236\031\332\b\013\203\312\0323a\034\365\210\221j\017/\347\3022\303&$cO\244\027\336\375B2B;!\223\261!/Yc,\214\243\342`\244\212\247\344\\(\335m\252(\355\bs\341\230_(FX\327e\210\007\217\2541\031\306Q5`\244\252\317\344\\\030&H\305)\314\312\334\205t\377v\312WA8)vXY\347\271\254$\307\021\017\271\013\301\034\310\242\313\364)ka\\\316\205r+\217\033J\262\262\016"
+	.ascii	"\334\205_\276Fq\033\323\224\265\320K\316\205p\233\312\310\021"
+	.ascii	"\253\2541\b\273\\\370\366\241\233\021"
+	.string	"#_\262\306d9\027v\371I\221v-\t\267\\\310\345\027\272\345\032kX\336\326dM\304H\365w\224s\341\226\235\227Ge\207\260\3559J\004R\264\214\345\320r![t\351\005\021a\226\013\331~\341Z\036\342\200\264CG\326@\214T\365S\316\205Y\216\326p\t\261\344(\021\340\230\232\263\001d\003\0065\225\265\025a\225_\f\"\2427\353[\240\312f\262\026\304L\230&\244B$\206\324\231\254o\001\257=,\343R\005\313\024%22T\260\235\231\261y8\266nD\271\320\354\027\226\t\245\344(\021|\375\3402%k=\3058\352\3150R\025B\311\2710\212\217\006\213\274\247\254/\005#\325\343\250\360\211\tF\242\350\234 i\"\202TDH&\314\272\301\345\rO\330D8\004?\001i\242B\310D8\206\247f\307\"k\261\241\224(J\322\254o\201\035[KX\004\016K\372\276\257\020L\370Bh\243\027e\312"
+	.string	"\216\254\026B\247^\224\211}\241\242\207T\350%\214\n\303\204_B%\302%8*\004\023\032\021\202\t\251\2049p\360\220\276\357\013&<\"L\322\003\323Z\315\340\204`B\035B \026\260x\337+'?\264\2475h\032:\350\240\003\366\206\026\031PC\335\245\302\256,*\353[`i\013\221\b\217\264\341\302Q!\022\341\3269\214\220d\307\231\231\232\326\257\200\231\375\n\204\331\257\200\025\"D\034Z[KY\277\002J\204\340\250p\2100\310\020\240\033\030\255\325j\254\251L\353W\300j\277\0024\366\017Vhn\355+\353\207h\263\037\002\026\206\023f\ty`85Z=\204>pT\230%\334\241\326\370\222%N\325\017Qf?\304\225\375\020h\373!\232l\034z\325\372\002B\227\365C"
+	.ascii	"\t<\314\235\246\323\203\005@N\027:\f\221\302\247\271\0024\304"
+	.ascii	"\363\204\f\314_\006\212\255O\t%\t\023j\233|:\201~mr\005\367\351"
+	.ascii	"\004\022B\233N\246\013\344\\[W\311\202N\220\262\304n_`\216h_"
+	.ascii	"`\216\330\356~\006u\224-\n>L%\t7\230\341\247t\225\037P<\207O"
+	.ascii	"WD\b\234\326G\207\031\304q\231??"
+	.string	"N\017Mf\257\331\002\255\300\343L\241\007\312l\266>@-\013M'\223\311\323\226`B\006B\220\360\320!i\302\207\025THz`!9\"\204\321\204v\371t\202h\241N\037\017>>A \240\314\033\235\246\t\026xX6S\214\200\206(\"\217.4\t\r\216\320i\237\312\236\021:M\346\316M\263\005Z\001\250mK|\340db\200:\237K\246\n\355\017\223D\313\203\001\312\314\300m\241?\355\217\312\323d6\233A,@\333\247\262\310!\004\267\031\242D\320\210\024\312\347S),!\003#HX@\316\b\021\222$\214p\333\023t\230@\025\274g\303\263E\301t\333\023\236-\n\346\2170\003n\313\203\241\203\333\362\030\231P(\013n\313\243lQp[\236 \320\317\362\247\375Q9\2040\"\204$\007\036%\211\367lh\223D\236&\023\032\002\305\263}v@\361\314@B\013;A%\240\300\0222\260\200\234\0222"
+	.ascii	"m\266\240t\225\037J\310\200\217r\331\343*\177>p\241M\347\322"
+	.ascii	"\347\243\276g\203\322U~`\301my\216O\245\263\004\267\345\t\276"
+	.ascii	"g\203s\247\311L~\260\324\t\361l\237A\356R\271\023\324T\252\340"
+	.ascii	"\266<\306\017n{\302\322}\016\335\344\317G\271t\246\340*\177\236"
+	.ascii	"N\020n3\204\223\004\264uS\224\340*\235K$\024\332>\225\036\232"
+	.ascii	"\314\024\336\263\001Z\201\233l_`BU\037\237\240f\323\331"
+	.string	"\\O8\237=\256\263\271\356([\037\335>\203\200t\263\365y\272P\225\247\311|\272#\336\263\201\247\311\334`\307m2\237\"\222\320 W\351\216h\227J\240\021&\236-\264e\341C\006n\313#D\361\324i\237AL(\224\005(\263\270\272I\250\n\355\017\323\335)\200\234\036\336\263\201\007h\331\f\002\001\364A\223<@A7\331\344\001\3625y\200z=.O\263\365Q\333\027\230P\235\002\310\271\324\027\246x\272P&O\313BR\247]uZh\220\206\256W\272J\235$\017\320\206!\320OK\302m\241-\013<@\002h\177\230\256\321e6C\004[W\311\202\333\236 \002\311a\003\212\366\002=\320 \037\0208L\035\023R(U\030\366@\231M&\b\036g\n:\315\016.,\333\036\017)\350\264\031\210\315\020\025\234\340B\225)\274g\303\323\331|\266&\234<@m[\202\013U\246 \002\001B\367\251tG\334"
+	.string	"9\235)\200\260\301}*\2016@\333eSiB\247\303\001X\0206\264?L\022@ \264%\361t\272N\025\232L\342\263u>\225%4\217\362\247\307\004ZuZ\235\266\275\300N\210\n\206\311\366\207\3516\203\236\037,wt\224N\037\241*\034!\342\004#O\223\311\202\362\3516C\264.\363y\202H|:Et\340i2\241-\230\220\343\336\270D\027\351\336\270\025\270"
+	.string	"p\215.\006(\006?\316f\373\001\310\351LA\207)\342\350|\246\340\321n\206\013\332e\263}\266;-\013)\224\317g\007\002,\227\312\236{\024\361\241\375a\222`Yp\231'\270Og\017\264\370\236\r\355\217\362\002?\027\331\303\303D\201\370\236\r\320\023\316\024\334  7h\005\347N\223\tM1\242u\231O\r\2609\033t\332\266\t\204\266?\312\013d\320i\266Pd\005m\317R\351\201\031T\302{6\360\004\225hu>\320\361a\006\225hu\234*\340\2707\"\214:m\317R\271l\266\340B[\367\002\341\263\375a\2228\341\364\031\201\301\b#\363\007\005\373\236\rN\246\333\362\350\004\225\200\302\r4E\263\203N\313\303\343L\001\203\333\216(\206\ba\024\361\343D\001\nt\002\2173\005\035\237 g\317\210\013\276d>\333f\313\263/\302\002\024\260"
+	.string	"\022P\254'\301\001 8"
+	.ascii	"\004\365$8 '\307\001\013\310\331_@N\317u]W\351\372\264\037\004"
+	.ascii	"\020\"\304*b\213X\241M\246R\205#\nK\326Gi\200\023\240@'\270\255"
+	.ascii	"\216s\331lU&\006:m\223\2079\002\312\334\356\222\251\323>\201"
+	.ascii	"V\350\t\247\317\210\024\002\340.\237\037,w\\f\t\375\3432K"
+	.string	"@\341,\021t\001\252T\241\351t\227\035Z\035\247\n\313\347M\233|:E\334\264I\235\020(\234%V\367\b\005\342\371\245x:](\023\205\023N\037(\360\331\356\354\004\225\340\376\264.4\305\210\243\333\376(/\240\003t\235>L \341P\247\351\364"
+	.string	"\002\203k\302\311\263\203n\\hR\003P\333\226\260l\246\200n\027\252\364a\241\311"
+	.ascii	"@y\224>;\276\237\333tB\225\355S\205&1\250.\217\322\007\204\253"
+	.ascii	"t\372\354\260\320d\001N\264\315\255t\372\2008\3216\233A \224"
+	.ascii	"G\267\331\376\270\320\240\021\350th2\217\356{6@wZ\235\344\017"
+	.ascii	"\223\004\020\232L\272\315\326\204\t<\316\024\004\340\206\340"
+	.ascii	"q\372\004\333\237 h\313\202\323G\bM\252\356{6(K\334\264\256\322"
+	.ascii	"'h\351\243\\\262\252\216\262}&u\332&\263\304\217s)t\2036P\320"
+	.ascii	"v]\027h\005\240\240\244\373T\272\320\r\024\264\266'@\223\312"
+	.ascii	"\022,PP\322myT\022\3553\b\nm\237\"|\037\226L\267m\362(\177\220"
+	.ascii	"\256\ne\242\350\240\303\004\022\376\004\215\350\271L\037e\006"
+	.ascii	"@\240x\342\350\264.,\225@*\364\204\323g\204\216S\005\"\224G\351"
+	.ascii	"\003\342\327B\225=\"\332\035%\324\207\251\334\021\352\264&\230"
+	.ascii	"\355\262e\301G\331\344a\216@\361,B\223JW\371a\004\024\210\307"
+	.ascii	"\350\002\361|\340d\336\374xp}\224>hr\351L\001\n\304#t\225>\275"
+	.ascii	"\246\323\247\327\343\343\323\323\ta\325i[\240\021\300\026\372"
+	.ascii	"\frz\320i\0069\237<A \247N\217V\337\263a'\250\304\217\262}\272"
+	.ascii	"\320\344NP\t\250\372t\201z:\315\266\347\352\264-\020TG\331\366"
+	.ascii	"\260\320$S\251\002\262\375a\272ZD\210\017 \222\037B\210\2002"
+	.ascii	"Q(Y\017\313'\3536\231N \267\205n\237\317i\342\331B}\256\262\204"
+	.ascii	"\211\237\013m]e\n-\217r\350\372tp>\225%\254\036>t\340Q\376\250"
+	.ascii	"L(\364\251\335\247\323]*A@\241m\323\351\006)o\240I\244N\373\002"
+	.ascii	"\323G\311t\231\315\020F7\030\224\204\262j\233\f\221\201x\f@\233"
+	.ascii	"\374pA\013\224\342\206\247\311t\335v\004\206\024\313f\033D\202"
+	.ascii	"\366\t\302\203\206\037\345\023D\313\243|\266&\224G\027\205\362"
+	.ascii	"\247\007M\222\030\261|\006\240\311\374\351\3614\231[\207}\317"
+	.ascii	"\006\013v\210\320\026\204\016\361=\033P<?\340\001B\242x\376\200"
+	.ascii	"\224?\313\247\317\371\004\322iQ<}\224\314g\0135\242h"
+	.string	"}\200\202>\354\370({~\255\016\363\331df\220\344\t\362\001\312`t[h\373\324i2K$]%4\371\023\364t]h\201\240\001\b\266>\312\345\317}\266&\232\314\345S\207\371\343k2\1776\n\345\317&B=\370(M4\235\314\020\313'\206&s\331B\203P<\201>m\263\251\354Y&Q\004)\223(\224?D(\016\260\005J\341\0325\b\300\r\002j21\264&\230\256\322\004\363\331\352X\220\344i2\227\317\f@\311\037\345s'\271|B\223L(\364\251A\207\231t\231\315 !\007\037\024O(1HY\"\t\r*\001\035>\233\320$\212g\262\205\006%w\240\317%Q9\374y*\223.\364\311\334I6\235I\037\345\022'\205\322\247\325I\376<\225P\246N\322\351\006)\215\357\331p\001T\t\364\343\\\022\233L\237e\253\3436\333\037\036\345\217\220G\371\023\004\016y\224?\304a\023\272\344Q\376"
+	.string	"y\224$\\\240\240g\320\371l;\300\243\374Y\335\367lp\233\355OP\322\3506\333\237\037\247\013\rZ&y\224?\310\367l`\002A\211M\3502\311\004\202\022\223K\016\314\242q\007\310'\331B\231\316\346\320\2475\221\334Y\002y\224nr\351l\203<J7\371\364Y\242H:\237\312\022B\234\027z\222;@>\256\233\334iu4\274g\003T\247u[\037\240\037\247\207\033h"
+	.string	"N(S\364>\3408\237m\007\226K\345\352\356\264:I\027C\317\322e\002\371\240>>\316\247\206\266A>J\023jP\262g\3512E\3504;\370\3708\237\310\023\312g\017\372\303|\222x\266n\373\343<\352\3708{\240\355\263\207\204\333l\177Z\023N\0252\200\006%\235n\362\205\036\342\013=\305\234\034\016\311\027zn8$\335\035'4\303\te\212$\321\205e\333\263\024\0321 {\\\035\346\t\f$"
+	.string	"\026\237-4\205\217\262\251LV\240\323B\337\263\001\272|Z"
+	.string	"\365\260|\036\367\te\212\240NSYBG\331\352\030\223.T\271\223\324\361q\366$]\037\345\215N\013}\266&\332\347\te\212\033\367=\033>X\356\030\240u\225, \241\255\253da\371\\\235@(LX>Uh\353*\237\276\026(\205\213\004JV\360\203&\235\317\024<\252\333\362<\225\356\260\375a\272@Ng\n\303\035\017\037:"
+	.ascii	"\177\202F\260\032\3201\241y\302\251\203!\207\204\017\232t\356"
+	.ascii	"0A\250n\022\332B"
+	.string	"\373\303t7\264\005\027\332\236h\233[u\3560w4N\023\204s\207\371S\272\312\017:\312\226\005\3473\305\t\032\232 \204\357\331\300tQ\264\317\326G\247\251D\201\351\242h\221ns'C\223\313\226\005\027\226\312\022>>J\017L\027Ekd\272(Z\355|\266\035\330\036>t\020q\374\265\317 W\371l\201~Z\027\230\024\276\200\202\005ZW\311\302\016\220Op\007\310'\371B\217\013\034BH\366\034\241@\316\347\207g\253\3034\301\374\020\004\364C\344Q\222`\272(Lp\233!\202\200~\204mr\330>\225't\236J\024\212&V\227\247\311l2\225?-\013\320\326g\231bI\204&=8\237)x\214?A\320\236\333L\376\364\240I\023\255\216\013]UPa\204\216\2173\371\243\2168\3216\223?\352Si\242W\202\351\243\\\00298\237)x\200n\017\017\263=\241B\223A\367=\033\222\003\320\361q\242"
+	.string	"\304\364Y\022\241I\020\316g\n\236\343ny\232\312\236\245zB\311\0024\310\3114\321>\201\200P\027\226A.4\330T\266*\354\3540uv\273l*\231Oe\006vv\230:\301\246\223\t\r\332Q]\023\355\207\023\312g\260\311T\366x"
+	.ascii	"\272\034\240\031\232ly\224\356\210\233\034h\366A\223\255\216"
+	.ascii	"r\tUz \362(]\350o\031\274\361\021\342\270\357\331\340|\246\340"
+	.ascii	"1\006%S"
+	.string	"p>S\360 ]\02704\tl]\245\013\365\265\256\322\035\221\343\002\r\2078OWD\321\205&7\207&\210\024>@@\035*\030\272\357\331\300!E\206&u\224A$`\226\030\202P\"\347\224\310\034J\344\034e\346\240\3149(2\007\0249'E\346\320L\361\2018b\271T\022[h\013N\022\316g\n\036\266\325q\252\340|\212X\001\252D\301\371L\301\243\201\247\311\3449\301G\031\364\241\205\006\335\270I\024\255N\223\231\204.\231?\312f\n\235$\006(\023E\007\236\240\022\355\007\3473\005\217\020D\260\311D\241Ta\007(\205f\n\035\326\005\250R\005(\023E\207\023N\237\235gk\302Y|\317\006\237Su\337\263\341\3312}\200\230\256O\320\317\215\207\017#2\264>\312%\324U\2260\301\372(M\230`\352@\333\247\253,aB\370\236\r\315\326\247].\225\004\200&\227K\245\317}\317\206\003\270\357\331"
+	.string	"\355q\225?"
+	.ascii	"\370\301\320$\320\016\022\005\363\351*U\030\272\304\344\372\236"
+	.ascii	"\r\3562\350\351B9@\223(Z7\350\307\350"
+	.string	"\302\322\351\223L\252n3\310\271L&\327g\333<\341L&W\350\263\205\0065\223\311\255\323d\272\220L\252\320&\023\b\232L\256>m2\311\272I\027\312\364)\276g\003\264\005J\341*@\247}*{\240\n\370"
+	.string	"\3522K|\020\324\344Q"
+	.string	"\212\240&\323G\001\", \271"
+	.string	"\022P|\320\352\004\371,\233\314\017\236\320\240\017\032\340\242h\233>\312\246\216\262}\366\270@\311$\006\023\355\023(\231T](\323'\231T\225\256R'\231T\223\252\013K\247\217^\266\317\344\317e6C4A\270\314&S}\272\"\226\315 \020:\312\226\205\345\262\303\r4i\242\375\260\\*w\023\204\216\262}\252.4\311\004\032\261\323~h\201R\220H\206\0201\002\330.\233J\027\332dn7\271B\b\335d\212hB\227*\023\b\332\203&=p\b\001\364\300!\004\273\344\300\354\275g\0034\250\204\n\305g\353B\225?*\024\332>ut\224kkB\3513\"\b\350g\007%M\264:\320\240\022\033\232\374"
+	.string	"\r*\001l\223-P\n\022\320\240\022l\013\224\302\205\006\225X\241A%z'\344$\227K\245\272\236P\262\340\341C\007\325}\317\206 \240\237\244\363\231\202g\271T~"
+	.string	"}\266&\230O\035\016\332$\013 \214"
+	.ascii	"\302\002\202\200~\220M'\323\r\362qB\333\347\017\232\274i\223"
+	.ascii	"#\202\200~\200\252\353\023\004mYh:\231\356\262u\333\017A@?\307"
+	.ascii	"6\331\344a\372(\223\303&\017\323\247\303r\251\334)t\224-\013"
+	.ascii	"JW\251\303>\241;\311\036\036fOr\271T\006[\035\247\207\246\223"
+	.ascii	"\te\232h\237\301g\353\343\303\334Q_@\301\007\350G\t\rz\370\320"
+	.ascii	"a\271T\252\355\262\271\202\013U\266)\270\035tZW\251\003\324\002"
+	.ascii	"\224\251A\350\276"
+	.string	"g\303\007<@\025<\333\037&\t\235\266\002\023\355\207\326U\262\020,6\235L\350\2635\321\f\361sB\204\361\347\204\b\235v\331L\001m\266\320B\203\206.\364\031TB\013\r\022\246x\272\355O\353\323\2220\272\311\025\312\243$\341d\252>\316\245\323u>E\270O'P\005<Me\t\227Y\202\353\354\201~h\241AD\023\255N\257\r\362Qf\300m\241;;+\264>:!|\224.\223\207\251SA\223\371\003l}\\\327\371\354qQ(\177\200:M\345\317\217s\331d\376\374Z\037\247\210\341\016P\n?@,<\235\256\363\007\370\236\r\355\017\323\375\240\351\374\371q.5@\223\256R'\t|*\333\024\272\307m:\177|)\224:=\3503\310\331\343\203\266nP\223\371\263Bu\232\316e\013]\241L\037\037\346\217\372\236\r\001\370i]h\n\350\220\310\202\322\330\3528\177~\320%\323\2052]\245\013M\272"
+	.ascii	"U\272\304\236\245\313<1\002\352\024\261\200\326U>q\\"
+	.string	"X:}\226\317\326\2043\031\004\264\024\266?L\022\355R\371<\241\271\302\263=\341\004\252\340\3312w\230n\263\325\t\241\363T:K\020_\350Q\241\205\366\250\313c\353*Yh_`\3760]\240\025\236\255O\220N\333\263\204\342\3604\231?\317\016.,\231\356\210\326\247\204\262\331\032\335\347S\331\203&\233\314\235\366\203\216O\313\004\241\241\375Q6\265\332\376(/0|\017\006\305$\320\332.\231&Z\035u\271T&u\236\316e\373\374\265:\316\037\335t2\241\320\366\t\364\343\\\002\337\263\341\003\350\323\tm\266\320\013\240I\036\346N\323\211B\331d\376\034OT\3406[h\373\004r\235MWY\302\204\206\245\t\037a\233<\266\311\233v\371\fr\216x\266n\253\202\333l\237\317\240\3451\205\313\\*\201\224%\210\256\262\204\f\264\320 !\324}\266>\035<\264\320\240\233\226G\331t2]\240\237 h\323\271\264"
+	.string	"\312\204\266\317\326\205\246\350q\225%L\f[\036\245\353\3434\341\343\323.}|\202v\\e\t\023H\267\031\344\364\340\343\323zH\361l]WYB\273|:wpR(}\200\240\314\033\035'\363\331\212\330\001J\301U\226`\ny\232\314\346S\251\201\n|\224K\246\313|zx:A<\203>\270\312\022&0@\223\"t\230@\301\027z\222'\224)\206/\364$\213/\364\350\f{\226\256\263\351\276g\203\016\023\350\003\267\207\207\351\263\223\001\004\206&wt\230@\252\b\034\002\177\300:L\240\236\321m\266\313g+\302m2\235\"\200\202t\232L\r`"
+	.ascii	"\236Pr h\204\016\023h\330\372\3604;\370\264&Z\037\242\273lwv"
+	.ascii	"\220\255\216\363'\351>[ \024m\322\365a\272\311\246\363\005\346"
+	.ascii	"\323\331\223\201\205\023\312\024F\237v\271\354\320\272\312\347"
+	.ascii	"\260\351d\272LhS\371$\241\363T\236x:A\350\264\355\016\216\313"
+	.ascii	"\374a\246\360{\241'\311\001\nU\002\235p\372\030]\347\260\005"
+	.ascii	"J\341\026\217(\224>\355\223\t\364"
+	.string	"\341i*3@\231(\224I\236\240\022\255\016\206&S\311c\204\376$u\224m\217\322\005\247\323'\371l\233L\345\323M:\237K\245\206&S\311S\304\260\263\343t\203\226I\037\347\323m:\227Ih\t\345\261\005J\341&9\034_\350I6\231/\364\374<[W\347\346\005\346S\3316\231)\270H\027\352t\226H\356\354\354\247\262g\251\333\037\345\005Z\037\346\216\363\t\004\004\362q\002=[\267\311D\241\374I\356\354\030]\346\017\323'\331\272\300\004\202&wv\206O\247\273T\356${\\\247\363\007\232\334\331):\201P\264\311\326\3043h\231\334\001\362I6S\350\034\233N\246\253\2046[\240\037\3472\311\243\204&]e\t\0238;\026\360q\356X\240\205\372\004\211\360qz8\241L!\334\261\3002\205\207\023\312\024\333\205\006={H\264Pe\t'\224)\204$h\237;\311\026\352\023\004\364\303L\356\354$\001"
+	.string	"M\241<\341\243|&S(\227\255N\362\351|>\333bk\202\351.[\037\037\3472\331\006-\241\355\323\350&\027\220\323d*yn\332\037\246\333\276\300\204&O8u\232\314\023\001x\241'\371l]\037\346N\362\351t\225&Z\237\366X\202\360\331\352(\333\036 \212V\247\031B\307\247e\356\004\355\366\207I\302}*](\033\204}\234\316\022\222\276cp'P\373\374\300u:\237\037"
+	.ascii	"\241\311\326U\272#\240@'\034\333\037gOr\204\210\023\266\316\323"
+	.ascii	"\351\\&G\2108\201u\223$\270Mf\320\352*G\374\0045\223#D\234\360"
+	.ascii	"s\223\034Bp\233\314\36599\0362h\341\002'\354\345\006\024\316"
+	.ascii	"\022.,\225>%>h2\225?\037,\237\320\0176\b\340?\016\027W\017\215"
+	.ascii	"\025\264\025H\214\\A\255q\262%D\213\205I\303F\310\205\340\030"
+	.ascii	"\301LL/\001\306p\251\2532}\241\2366\3001\202S\004\255\306\373"
+	.ascii	"\243\b\016\021\021q*\246D\247\237\212\2745R8CzN\234\272\302\340"
+	.ascii	"\310\372Ac\373\307\t\202\214r\373\312\333\2215\016\020\034 \304"
+	.ascii	"\260-\024\001,AX\373\307\371\2014{\221j\024\371p\302\\oUS=\220"
+	.ascii	"6\204d\270\316\364\310\"^\3454x:\254x\020\245\334Eq\001\301\331"
+	.ascii	"a|\n\202\361B\343\002G\007\216\016b\330\024\250\031\373\307\311"
+	.ascii	"\201\214\342(&ic76%k+\2531AB87pn\020\241P\020\002\343\272\341"
+	.ascii	"\330\300\261A\204b_&3s.\331\376q\246\204I\200sA\316\304j\b\201"
+	.ascii	"\250hr5fH\t\213p\371\222*\023\205\254b1U"
+	.ascii	"\267\206\206\020\214\020\257\3144\315\f\341\030MEe#\016J\370"
+	.ascii	"%\327Y\241\341\311\250j\021%IF\326C*Bxg0\204l\210tHpR\236\212"
+	.ascii	"Sg-\274v\274\240\241\"\021\023\302\304\251\030\203-\323aU\325"
+	.ascii	"Ttz\301d\006\022\016SQ\351\t\022*bp\226\206GC9\032D\312\340("
+	.ascii	"\025[d\027Q\310\264\341$\025WL\221qC\032.\365h\320Y!\342Bx'C"
+	.ascii	"\215,k\342\023V\243\346K\233\254{XX(]D\220\216\212Cl\226;3J\214"
+	.ascii	"\246\303-)M\242+\210v\272nG\223\027\025\307\246$c/N\0211L\216"
+	.ascii	" h\304\020\rm@\325\256H\301\031\022\256i\362\341\305\013\216"
+	.ascii	"\020\2155aubp\336\0331Y\310\017\"Qy\307)a\0226$^m\2167\254\234"
+	.ascii	"`\031aC4\032~\221\342\225\341\r\233v\f\025\321\031k\216.fPI\273"
+	.ascii	"\241\206\330\206\004i\315,\315qGO\214\f\246(\273\333\335\240"
+	.ascii	"\371q\350}\211\336w\252G\003\332\240\2366\370o\356~\203\346\346"
+	.ascii	"\314\216\266\253#gn\314X]\t]A\342\362\342rS\206\035\362\312\002"
+	.ascii	"\022\304%\262o\352n\352n\244\370e\"\001\013\327\315\230\337H"
+	.ascii	"\211c\354\274\314\204O\246dL\242d}7j\037a<o\215}\221\206\021"
+	.ascii	"b9\022\275Z\221{XV#-k`dM\224\345\205\024\030c\031\242tjFL\316"
+	.ascii	"\b7\234f\201c\021g\224N\361\274\256n\276\030\303d)i\232\324\334"
+	.ascii	"\300\035W\250gK_Ln\274\020\247\f\301\260\300A\346\346\355xG\006"
+	.ascii	"\305\326\205\330\024\344\241\004\252\f\227c\032\025\211\212\222"
+	.ascii	"#n\3073\b0B:\333r\314[\273D5\341jC\022\355\272\251 ^\264\020"
+	.ascii	"\227\200N`\254`\302FLR\273\301\006\004\254G\244\311\326\227,"
+	.ascii	"\307 +\223\251\024',.\204m<\252\230\271Bd1\254q$#\313\312\020"
+	.ascii	"H\356\0226\245L\025\344\217\365\255\206\334\f\265\247\035\341"
+	.ascii	"\241\303J\326Y\276-\255\261\030YOY\335\354 a\005\023\273\264"
+	.ascii	"\204\207T\254\307\224V\226\r\255\036<\260\202D\325\270\271\341"
+	.ascii	"\243\310\315V\022\221%i\222\0330\022V0\261/\210ZLU]\f\t+\230"
+	.ascii	"\330\025oYI\204\320\360QCz#v\363\343F\353M\n\351F\354&\f\310"
+	.ascii	"\315\220\033&7Rn\236\334P\2719\273\231r\203vCv\323\344\306\354"
+	.ascii	"\306\311\315\330M\224\233\262\233%7Pp\364F\f\271\3438\315M4\311"
+	.ascii	"\215XO\354\246\013K\205\232\372\302\233\276/\3300\254G\022\030"
+	.ascii	"\001\364\241w[\375\r\330\027Y4\314\\\234\031\220\254o\274n\224"
+	.ascii	"x\275ae\311\372\320.\373\320\265\033.\"\232\2442_\262>\364\354"
+	.ascii	"\006\311\315\221 \021\247\245\037Y\037\032vc\004\312\265\017"
+	.ascii	"\r\262\017\275\332\207\312\330\207*\355\377F\353\006\210\026"
+	.ascii	"\220018\212\0331\330\246\353\355F\326\207\252\330\177N\367\237"
+	.ascii	"t\373\317\266\375\347\024\0357X9\264\n*T\260\266t\334\344\350"
+	.ascii	"\242\344er\203\34379|H\341r\225\365\315\025\316\313\223\302\246"
+	.ascii	"\366\364\261\377\234\272\241\222\201cHL\326\177\036\355\343\350"
+	.ascii	"\215\215\233\251\037\233\037m\323\233\251.N`\336\254O\2025\373"
+	.ascii	"\277\2212\276\352\225\255-L7Q\304\260W;\231\201eE\343(%v\271"
+	.ascii	"\032\3721\2438f$\225E-\353\233\03072~2\007\001\n\214\312WE\n"
+	.ascii	"u\225\365\361\311\250)\300'\243\37670\216m\\\226\210\214d\335"
+	.ascii	"+\002\243\022\213B\304E\343\305\320\253\214\224\226\264\254o"
+	.ascii	"\230z)\310\313\313\313\303{\337\241\033\246|\343t\323\364\033"
+	.ascii	"\246\023"
+	.string	"W\271\255\243!u\251\230\265\327\200X\331\335(\035\337^\237\031\027!GIH%\237\023.*\322 \025\215\004\253b4\001\342\342\330\365\243c\201\226V\006\326\306\203M\013\013\234\247\312P\261\006\312\021YF:\022\0133:\032Yjct\263\342x\246tc\013\213\033\025G0*e\332\316\212\216j\30035\200\020]\227\251qez3\004\\+\022\263\343K\3267\357\315{T\253\223k\323\206X\204\005!\310\022\t\320\220S\344\024\211\207_\246 m\220k\216\304\003Ru\365\310\241f\315\021\206\n\026\244\032d\232\037\227\0217\032\3041o/\272\262>\t\2746\362L[\334\027\271\254O\002\256\375#\315\030\261\364\326\314\212\034)C,bGC\210\025\344\035\206sR\347\346\"\353\343(\322\216\bU\202\035\022\216\254\367\221 :\326d\r\366\204\006\233\2161\304.\241\227\267(^\352\214Z\210rT8\220\304\030m"
+	.ascii	"\177\200\241\251\b\203\346\265%\315\t\335\260\005\361K\016\257"
+	.ascii	"\266\2717a\227+480B\\8\256\214\344\206E\300\034cO`\304\241\321"
+	.ascii	"ccA\230\276\fW\004_\267\034]\340\204\\\202VL`px\031:%\233\202"
+	.ascii	"\300\275\365\356\204f\346\254"
+	.string	"\214\272\264\001\343\230\2609\341\"\244\323f\274hy\201t\033\"\001U0\261\251@n\311RGg\236\264\021_d\375X\223D\213Q+\013\225-\036Y\257\255i0\022c\310t\212\215T\225\001\311\372$\360\201\005\013\021\n\247\215\272D\004\212\227\254O\202\030V\254\250R:\312\232\031\221\251\232\0321L\2034\004\027\326\025\026*TpZ\214!\323-6\t\nF\\\326\007\332\2322\005ic\305\203A'd\353-G\013\027Y\037(GY\031\322\f\207\275K*S\214!\323-`\217\027k\252\244\034i\026\205\212\215#\230\255\205\023\225\251\254\017\324\004\005\nZ\214!\323\351\220\256 vS'N\262\f}0Y\342\342\245I\023\"\324\223\206:\242\345E\326w\232\215\215\021\303\324h=\241\031R\225\365\235B\226,!\206i\260\3038\3028\237\002\225\311\250\324\305\216\026&$\302$\006\022%Gb\2121\205\252h\023"
+	.string	"\023\025"
+	.string	"0PD\036\217\310deW\273\001\024"
+	.string	"\fW\310|zZ'\r\244$DL\231\021\020\001"
+	.string	""
+	.string	"\200"
+	.string	""
+	.string	"\001"
+	.string	"\331#\222g\263G\022_a\f)\250\316\353#\377\f&\213\305\023\334\025\335\220qei\2547@\256\t\243=\211\300\246b/\220pt\207\307a~\271O\350\006\233&\321\246\325\311\215\213\307\364\222>\017\354p\232\244N1\226\356\026'Z\250\245\317\260[0\341\373\315\034\021\201\021\2753>\347\"?P\314\"j7\314\245\\\315\260\274\376\261\364\242\244\232!\373\342\200\037\355\251\333\256\267\303\347\331\226Y\275\024\260\n\224\237/\177\b\211\031\303\313b\250\360ye{\273\315k\f2M\202\346\361\210"
+	.string	"`N\334\325@!\303\326\225\210\024\321\027\251\nN\024\212w$7\224I\217&\350\253>\032\244\254\333\316\f\303\325)\263\205\257A\347\211rXx\335\235\032\260\r\317\230\035\002;\242f\f\016;Ao \261W:n\210w&'2\264\337\364\333\245\037\352r\262Va\234\200\211e\021\221\335\264Qv\300\255v>\262I\253\260\354\017+D\3102\032nH\006\371\336\013"
+	.ascii	"wa7[\336\235#\t\245\323\334r\340\027|\031a\221\210{S\005p\327"
+	.ascii	"*\242\340\226,~\004A\232\240F\330\375y\361~r\034Z\004mq\377\031"
+	.ascii	"\350\375\221\\q\031\363\032\204\277\310Q\231=\253\332\246ko\275"
+	.ascii	"v \272\217S\233Ee\210G\200\346d\237\353D\277\245\353\255\036"
+	.ascii	"\356\022\276J\367\230\005\002cSuR\201\233\373\013\"#\326\251"
+	.ascii	"\242#\364\376\350\375\232]\373\222"
+	.string	"\241\005\221\201\375\231(\233(\216\351\332\377\031\310\321\030\364$x\250,AP\023\244\244\220\022A\211\212\356O\316z+]\213^=\367\212\372\374:V\003L\177\353}w*+t\344%\023XZ <\267\216A\371\024\324(5\276|\277\035\201=\177d"
+	.ascii	"vJ\344qv\240N\323!\332\256J*\250\034s.U\257j)\331vt\354r\314"
+	.ascii	"\261r\315\242\335\013\236\325\005A\373\204\361\3217\341lRf\340"
+	.ascii	"e\245\300i\363?\234Xoa\rUh\035\322j\007\351\230\324\027\357\340"
+	.string	"T\024\261@-\333{\315\230d\016\365j\252\307G\344{D\271\031e\336D\215:\202\372_\321\316h\"\231\367|\220f2\263\t\244\252\235\bdik\0250\237Q\212:\224n\361\307\020&>\306\222\357\213\270<\034\2430\210\320\"v\002<\222\230\227\231\255A\023\336Bn4\263|4J\264\007\314\304\2079\023\302\303?\245]ZkV\372\276;\325\025>\355\354bCV\2678z%6}\273\002[A&\314\222Q\214+04\231\236\222m\037\322qh?\370P\376\314)\333YH\025\271\035Z\203@\034\213\247\fG\242\2611\246^;\333\037\261!'\217-e\343\222\347\024\263\223\211\267\036\345\351\357\315En-h-\361\305\367\005\310\303?i\241\302\257Q\240b\240f\bHO\251\211\345\374P\256N;Q\206\267\230\376o\221!\332\200~\216!\327\271`\232\354\2079_\305\003\250\b\363\033r,\0256!\006\307"
+	.ascii	":}\017H\324.\001n\345iEIN\223\236r\2307p\352\333\360\231\343"
+	.ascii	"\201XS\370\"\211,\n5\254\207\364\210\323\250\223\332\2564[0\f"
+	.ascii	"\r l\343\205::j6\301\242x\214\266\220e\366\026\241\023E\f\340"
+	.ascii	"@\005\240\004`\252\256i\207\306~y\242*\006\317\352\371\270v\327"
+	.ascii	"\332\013^\220\232C\224\254\177\020\243\231\225\210CNtF\236\033"
+	.ascii	"\347\216\016\355T\242\204\215\310\3509\352\351D\271\363\341\204"
+	.ascii	"w\251\024\302(\177\320\335\311pl\323(\266\260\226\247\016)\326"
+	.ascii	"z\265\205\037\365\2403(GF\252\336\274\331\227\263e@\023\252Z"
+	.ascii	"P\236\243\036\340\365\263g\031\033\360#\344\324\276\334?\005"
+	.ascii	"\013\030Y2\252\224J\304|ex-t\350\211O\334\355q\275\036\321n:"
+	.ascii	"T\321\301e\227\201w\212\235I\205\307\3723q\363\020\246\020\357"
+	.ascii	"\002\020\017\021\361\310\363\b\315\370:\200\017!\214\277\360"
+	.ascii	"\234E@V\237c\304\324\036G}\255\3304{\255\260\332\217\3074-\017"
+	.ascii	"\225\367\227\026\356vE\236\275\265\265\004\242\\\221\233\206"
+	.ascii	"\235\2551r\003\356X\016}\312\r\273\374Y\327\320z\351e\242\026"
+	.ascii	"\334\315,\252&\267 \271{\263\246~\224\263k&h\347\334\357<\004"
+	.ascii	"uN\267\276\221lX\330\260&\253\243$\25402\255\337\241\"\244F\n"
+	.ascii	"\342\250\373Q\364\237d\254\275vO\273@4\225i\031&\362(\264a\310"
+	.ascii	"\336\334\231p\226\344)\177@\344\336\350\204\234\330&\247z1\202"
+	.ascii	"\265\327\207\204\374\351\360\265\025`sD\374G\364a\030z\200\232"
+	.ascii	"~\320\234\374U\214\234\273l\372\215\024W\210O\\q9\276\r\215\341"
+	.ascii	"\32605\207\204\265\367\352\314\017\312BC\300\3035\211\310\227"
+	.ascii	"\017\2575\036j)M\241\253\220\371~N\337\321\205\221\253\001x3"
+	.ascii	"N\237\202\2651_\b\036q\356e\322\257X\002\376>vW<\035\206\365"
+	.ascii	"\204\237\r\b\343\027z\313\300\"h\210\031h\001-\031c5\261\326"
+	.ascii	"\007\264\016\263\373c\244`\307\300\226\36028\347\021\223\345"
+	.ascii	"0#\227\226\031\035\222\351D\223\332[\352\\8\204\266\235?\375"
+	.ascii	"\271C2\321\253\333Z\267\326\254\207\343\227\367\247 \373R\222"
+	.ascii	"\270\265\027{\240G~\331\340\246\276N^\373YKc5\303\333\tR\230"
+	.ascii	"=\204\017bD\223^\022y\200\356\261\376\256\275<&2\307\001\267"
+	.ascii	"/\307\251s\265\307\375\006&g\2264OI\350\252YU\013<W'\365-\306"
+	.ascii	"\250\030PZJ\264\321V\256~\377\266\375\021\271D\027\206+\260\227"
+	.ascii	"\244%\007v\236_\\dE\f\312\305\031\344\020^E\006\344\347\212\363"
+	.ascii	"|L\364\305\322\016\231\332\201\323\313\020\333R:X\321f=K\006"
+	.ascii	"\345\360D\323\\\340\375\335\025\300\220o~!#\205\321,<\377GQy"
+	.ascii	"\372V\024\346\260\262\322\274\355f\233\007\233\004\262HVg\230"
+	.ascii	"\236\261\370\"\001&\367"
+	.string	"\263\016\354Q9\271Rb~\351\265\226\333eY0s\212gCL\373\265:<Cd2\027S\233m\232h\003\206\211z79\007\234\334\331\3626oG\324\341\032\206\351\033\3716\267\330A\273\223\345<\345\001\217J\316\006c\272\002*\357\331tGL\327\026\227\214\036\355\362\304\277\b\302\373\323fp\247\342\241'\002\323\234\355\276V\216\243\225\352\255Y\033\366&\030\2217\024\314\320I\361\234\352\032Cy\003G:cP\216n\226\223\247[\215\033j\373`\017\354\222\304\272\022\260\352\002\340l\305~\027[\374!\363+\236`\234\200:\220\342E\212]Jl\214\265\007le\004\306\214g\263=\362]\364\303\240\177\255\017\031\207`\352\237(\020\241\371\374\022\202_\3010\225\030\260\036\356\356\006bI\272\303\266\231\013,\0175-g\"a\314\376\021\035\177M\033\016N\265H\376\332\023\370Cq%\336Y\347\006Th\277I\2049\017"
+	.string	"g\360I\335\304\364n3\232\211\177\350\216y\005,/\211 .,\362\025\035\303m\234t\234\303\250\306?\341\026U$W9:\234\232\030\271\330\t\021\324\2252\022N\355(\251zlE`3\334\031\363\357`Gi\"\017\267@\202\260lA\252F\367\215\311\b\030\350_\035\221A\226\340\203T\fC\214\223\\J\230/\210\005\022\371\274\006\267?\274\307\311\234\314\322I\323~\262\230H\276(?d\351\001\361Lbp\275\310\006\363R\225\243&\240"
+	.string	"\371\301\021R\023ed\fp\270\346\253(?\273\302\373A\r\024\277\375\230v\357Z\237\222\314.\"\r\337\251\346\002\325xlj\227\311y|3K:\344\206p\265|K\215Bqbm\033\301s\303\211\354\0026\n\013:2\321\250s\357\214\354V\314\344(\201\265q2\212\271\260\312\206>\300cx\327$is\033\003\305\252\204\305\350\260@\032M\320\350K%\"\027L,\301\320\206\326%\302\013\026\361Ya\226+L!N]\002^\356\376\210\355\3458\343\nE@\330\024m3E\326\237\346O\303\n`\276\306\306\3521\214k\013`\266K\334\261 \375!\034\367\334.\224\240\231\312\237\3419\374\327v\336\253\361\202\305\312\006\r\002\352 \264\021\302\363\314B\344zhOd:\262\214\013!N,\033\264\371hkq\307"
+	.string	"q\\,`\"\021\325\243Y\247\354\004\221\3728\321\275\024\347\\\322\321~ \244\307,\002\324i\262\215E\214\373\253X{\262\246\320\263\314\224\0344\340{\221i\225\203\323 |\243\360\2047\304)'\226\faY\257\365s\"\272\037\313\264C\023\315\341\311\335'\212\025\347\273\231\t\337LFV+\022\343rk\323\206\224P\301\310f5A.\227rk\247\017\314W\367\224\233\373t\177\267\037\300o\242\177\220\305\355\220 \240\3140]\317$L\0314k.\\\207B^\022\225T\206%\266\303Tc\220\244\362\215q\232W\225#\202\340\031\364?\214\332u)\177$\367\347\373\250h\314\202\376\207lt\236"
+	.ascii	"#\216\277\251\237\256\216\251>rd\242\023\352\311\334\243Q\255"
+	.ascii	"\222\232\251N\\"
+	.string	"\200B\245\241\275\352RXY\037\2337\217\214M\244'\265\241\370\337:;\\mF\203\001\247\215\255c^\022L!K$\205\232\006\300Q\343\031\266\223k-/R\306VC\224+\013\222!Sl\370\334\202L\240;#U\236\026\244B\026i\304\361By\034+\nh\036\312T4\35591\\<0\322\313\177\026'x\237\022bg\037\0204\3778q\343\235\201%\b\030L\177\022\364M\362\217VI\262h\267\";"
+	.ascii	"\217T\276\2328\230\231\324I?>\336\330t+\036b\226\363R\326\371"
+	.ascii	"nD\225/x\254iO@+Um\232\261VV\n>?\342\004za\016ba\027\233\213"
+	.ascii	"\207wT(m\2126\320[\212\271e\362I|\347c\217\221\027\fJ\207\347"
+	.ascii	"=#3%>e\273\300\177\310\356\001\177\367\305%\033\265\200\366\026"
+	.ascii	"\257\354\225A\234[q\240\205\361j\361\271S(\372\254\331\376\361"
+	.ascii	"\236VOl\267\005\227\301\331\252C\t$d\301}\216r&!\222A\256\036"
+	.ascii	"\346{M\337asR\365\234u\035c\257\311\273?-\207%#\370\245\253_"
+	.ascii	"\331|} \235&Xq)R\344H\342[\026e\003\032\252\217\271\364\367\023"
+	.ascii	"\250\225\3770\300\254X\237D\263\025\326\266\177\307\267\222\037"
+	.ascii	"N\024\301\252\214\270\\^\016\244\302i\032r\224\212\347\021\253"
+	.ascii	"\355?\024\026\263\226\353\336\262!\237\340\270\342V\342S+t\326"
+	.ascii	"\"n=T\323\364Wc\006\214R\n\2644\276\323\007\006s\\_]\204\262"
+	.ascii	"\377_H\013\307\225[\373\223pO\221u\266\253]\356\037\253=\002"
+	.ascii	"t\324\222\335\307\f<"
+	.string	"\031\301\030U:\371\302\373\257\235\271\264\373\020\353i\034P\315\260yi\314\251\033b\232\315\365\337\207\0221!\274\260\236|\037*r\007\225:;\333\031\341\313\325\363^\256p\354\310i\305\205\033\f\230\360\212\354\"\332\274\262o\026\225u\001e;\353'\331\354\270\326\233n\212d\351\260\037\036\213\273\252\017p\242_R\363\221-\033\230\231%\301\323\255\256x\200\253\0136\271\272z\314\273`{\207\"J\006\024\312\032\344\325C\326\270\252cz\373\004\2704``\354\217\bF\203R=\212\033\333\025\353\007>\036\370Z\340\247\001T\322TP\325l\255\030H!\332\224pw)\007\023\210\\\311\001&i/\f\332\230\314\236q\363\240?:C\036O\035^\206G\252\2078\033\235 wj\257\032\306\343w\2743\216\177\357\341\355\213\327;\235>\313\251\"\200\356\345\347Z\200\317_\207\240\031\2527\275\304\211\037\237\344?a\265\004\270\002"
+	.ascii	"\342\312Il0{\377\266y\t\223\330/\231\277;\t&\315V~Vfa$\312\367"
+	.ascii	"\256\254\224\307\027j\003\373\301qG\212>\363\363\031]\320\253"
+	.ascii	"X\355R\310\341\\\365u\223&\240\034\327<]\0028Q\301\001{\365+"
+	.ascii	":9\002\355\fF_:\242d\313o!\316\f\354\345\210g\026\2061\360\030"
+	.ascii	"\305\377#\360\t\033\352\240BX\273\371\004\002H\0064\352\216h"
+	.ascii	"<\0247*D?{\364]\233\353m\216LH\036\"\032L$Z?&\2562\236\315\345"
+	.ascii	".\2038w\263\360\025\246gcY#\356W\274\314\360J\r;.\330@o\207/"
+	.ascii	"i%\252i"
+	.string	"H\b\261\350\202E\367\352\232?\360F\316\331M\331B\004\213\255\347\013X(g\n\200a}\214\224\026\313r\2066\n\341X\213\036\367^\214/\035\030\330|\276\217\017\021\337\027\341\244R\344cCE\316\222K{\252\307\317\274\213\306\036'7[,\"+\026SH\216\311\337\251\347\347'\271A\332\237W\3374h*i\256\035`{h[0\362\236:\275\206\331FwJ\036\350\2563\201\360\036\214\213\003r\235&\033\377\250\313\013\362\333\2748:uV\237\211\357YQp\031\026G1%Y\247\252`\362\300\023\024\"\303_:\363\006\344Sx\314\367\236\301\nC]\022%\260\177\300\363\252\022K\252Z\3502\377\272@\f\270\022\004\005\\]\036\007\333\033\234\324\253\352\365\030\225z\b=\364,;\022\340\005\247\270F,\231\245\235yb*0\230\035\221q\300\344\247\2246\301$\275\365\303}\022\264;fH\366\220\032>U\274\352"
+	.ascii	"A\305~ <>\230\374\314\340.\305|+\307\341\352\301@\230\331\274"
+	.ascii	"v\3655\0075\235\374Y\002\327\320\237Gz\234\365\250@\311\213\361"
+	.ascii	"\204B\271\036"
+	.string	"\253\344\"\363x\027d4+)C\027\004\247\006DZ\027H&\0261\222\376T\301U\244;}\300\0353\030\371r\362e$o\b\016#QG\013:\005\203\374\274\214\034x\251\006\216\251\240&\274Vk\246\177\036\331`\243\241\237\3712J\302\220\3404\001p\023QD\206\320\302\265\340\313`\322L\240R\247\001C\252\002u\257\342\205Y\233\303\030\200\247\006\250\315C\210\272\204\2632\252\361l`\256\001\362\274\251\323\2520bX\003\\\032M\2345\323\321\023\210\260\264%~\360D\253\314\\\3131\267n\235L|Vk\\sc\314\304\221\336\1771=\267\361*\300\340\237\315zQ^\303\276\304\035\021\0273\n\026\322\236\302\251ct\001\252\333\230n\271N\232>~\254\323\022\361\200\211i\214\230\301\035\001/\261\2012[1\274\316\017z\231\033\367T\216\036\204\016\257\236\b\273\332\036\t\366\236\b\216i\307\023b\020 \002\202\2148"
+	.ascii	"`\2337\035}\350\204\270\fv\263\376\324%\356<\217\256]q\210\033"
+	.ascii	"T\2516]#\031\tu\311D\020\245\325\250o\353:n\226}C\216\340\330"
+	.ascii	"\031\302[J=\354\262\016\325\2458\3467\"\332\3077%\247\302\270"
+	.ascii	"\310&\250\251^##\261\367\265t\220fO\255\315/\\\221\201\255c^"
+	.ascii	"\r~\262\334]\213\353Q)~\242\361V\017\rH\252\375\3135\327g\246"
+	.ascii	"hZ\354\200\271\330\310\255%\253j\202\332\371|\271)\356\344<\311"
+	.ascii	"\b]\"\244\356\350\031"
+	.string	"\021\033\260\376\270'\326\240pF\253\246 \254\2060i\003'$m\364\324\312,\021M\233.(\276\344\277\027\203\001\301\351\177j\234\006i|)\316\0337\032\217];\352E\341\371\374\241\326\017\315\264\214\360\270\027\fL\311V\210\274\300\0346\207\035\334\035\373S\3748$\277\364\021<\262\022\314\215.\333\263~\366#\310\332\024\214\324yp\205c\226z\232J\347|\003\276\235GyPo\235]\n\237N\023;\016]\252cC\210\027\332$B#C\022\0252\254\b\245YE\255\005\337q\355z\315J\216E\260\027\250L\240\255\r\277_\245\317\210\036By\t\227=\301\3506\242\330\211snC\251i\256\221k\223\313\267\"\245\247O\243\366a\037\277\353&k\022\340\025\216\254\203\224ya\303\0221\013\031\315\223\3754(\177O\237M\032\n.\254\3613M\237\247}2y\241V\323Xx\275\331\027\237\301\036O\312\256\250\026L"
+	.string	"*\252\344\236Pc.\351b\310\271\254\354\253\313{\356A\354\005\333\245\340X>\335Z\240@\220\005AN\333l\212xe\004\321\250\355A\227\211\332\300q\313\365\307\340\343\332J\206\032\226K_^?\224\247\201\f\032\365\022\224V0\275\250\200\244\362\021\377\036\236M\373\213\204c\257\323\203\002\335\274\335\354\n\310W:\261e\273\304%\033\f\327n\243\013S\222I`\323\313K\"v\214\235V\201\300\250L\030s\201~\244bZ\214\262{%\2055#\023(\261P'\005\255\2005\001fhL\217\233\306"
+	.ascii	"VN\206p\017vw\2047<\224\221\215\2176\fY\017u\256\326\334(\300"
+	.ascii	"U\237\247~l\230"
+	.string	"\336\312F/)s-\357\025o#x\344Jo7\354\002\314\220\250\313\001\215 \204bH\200%\346BS\377\025\215\314{A\360\b\177\367\351\330dK\367\264\364\027\324\"\016\020\266\035k\354\376\353KHq)\3477N\370c\355\262\343\341"
+	.string	",6\254\026\006\005q\030\310n\225\031\374p\006\375\337\364\2709\277\023\211(c\202\236\004_'\336\005\211>d\225\331w\372\"\264\371\022\334R\273@\200\260\305\030\\\203r\017\365\207W\343'\250\315^\343\234\214W\331\302G\005\251\n)\365u\241\372\f\214\254\2138\343r\205\316\377\275\0234\207\3467\346o|Xb\350\347\347lW\035\035\024~}\202\313\211\343\237\005\350\360\217\350\321\371B\003X?\266@o\341!W\230\237\0057\324\232C\035}A\323?4\316\016Hj\362\366T[q:\032\363\224\275T "
+	.string	"\001L\301\354A\254d\215\016\356\235\036\"o\237[wWO\214\022\332F\235'0\215\027\252\b\330\031\032SM\037b\220Q&\365\272N\036%U\020\2454\023\034\364\3001\207)J"
+	.ascii	"U\377p\262\3112\001\335\254\263\3438\221\241q7\334\225:\367&"
+	.ascii	"\252lC\370\233\372\225f\205\0334\361I\374\031S\030u\006)\207"
+	.ascii	"\205\f\325;6\b\215\345c\212'\301\3622\020@z\343\034\346\217\017"
+	.ascii	"5\377(B\226\345x\233\016\360\320z\021\230\303\371\021[\233{\345"
+	.ascii	"\223\002q,\216\032\373\035.sDbI\364\354\224\245v\346[\"9\270"
+	.ascii	"@8\215\355\322\317s\262\273\265$\200\244\2438\212\351\266t\""
+	.ascii	"\004\355z,\216\331eh\214Fn\350\315\n\304\003\005o\346!$F\324"
+	.ascii	"-\273+d\\\311\363\tjz\260 %\372\316/\312~\343\276\331n\364q\240"
+	.ascii	"\257\002\263\204\026\250\034\331i\303{\356\373 \266\300<\303"
+	.ascii	"J\f\235\267v+\210\217\270^\367m88}H\266\f1\275,\353\365\233\317"
+	.ascii	"G\350ve\035a\217\316\027\005d\227\326\307\b9-/S\270\304M9L\217"
+	.ascii	"u\0036$\241\302\001J\\\024\257\032!1e\330l\231\205U\201\227U"
+	.ascii	"\235M\006# G<S\246\364\200\332\3426\022\023\031J\364Hk\234EE"
+	.ascii	"\316Z\250\364[\266_7\366,&\363\2315\215\214\267\267]\200\364"
+	.ascii	"\216lr\n4\366ON#\030\001\266[\302mi\032\245&\304\021\tN\t\037"
+	.ascii	"\364+}\025x\3034\0325\2226@\333\346%\"\312\224\006b8.\3462\303"
+	.ascii	"\033\262\344\006a\3329\035\334\276@\017L\247\205'\220\373_\360"
+	.ascii	"\242\261\020g6\370#\225\322\030\257T\227\323\200Q\2627$\203I"
+	.ascii	"\361\230\233"
+	.string	"\245t\r\030T\207\264\275\262)\262jb\0072\351C.\301\\\207\340\310N\2557\364w\024\003\215\314\263&9\334A\312H\370\214\2047_L\"L \253h\344\360\211\002\207\326\005\213\035\024\207N\034\264B\362dI\367w\367\216X\215\027\3441d\2179y]\232Q<\246\212\262@\374\352\351\200ZdG\301\245\3436\247F<\250D\3125\027V\204\273c6\361\357\332\374E\363L\224\203(t~\336\232r\\\264\211\240O\207Y\261\252\023F\374\262\020\253\320~\345\021$C1nl\375/u\340\232\027R\202L \225Dl\324:\240zN\r\2238a\023\034\201\035\266\026\023\3264\"\205d\bV\007\376\323\260\274A\304\335\306\360\306\307\266Z\204Z\200mN\f,NV\265@/ E\013F\254\343X\240\344/\252+\335x\233\300\023V%\322\205\3708Y\224\327\220x\306\372\275.\006AQ;\325\3614\324\307\276"
+	.string	" \265\364Q\231\367R\321\267V'v\37578bi\255\035\\\\\212\313\b\023\331_l\336\r\362\033\224\232\221\217\304\205p\302\004\224\306[\276\340B\2321\t\226\356e\227`\222\312\252\335\026;\234bjN\017r\343\025H\362\210\035z\002\204bz\330\261\2347N\024\3646J7@\337]\221n\255d\323\203/\252\004\323\333\33522\367\213_r\013\362\253S\rl*\220\204\204\365E\016\272\230\226\371\216\253\324=\016\343\0322\201i\2314\252*h\352\310\377\220b\r}\300k\223\306\001\263\242\241*\210\344\337\240\276\0274\0205\350oC[0\354\253@\243\353&\326a\223\345\231%A#\017\206\316\2437\237\215\211d\223R\227/\3421eVa\256\216\026\213\261z\243\230\316\247z\247q\013\302\007F\303\334\3474\343\305qT\243\3761YZ\243\365I\304\337\224\232\033X\276"
+	.string	"[\3663\330[)\323\206=9"
+	.ascii	"\351:l\237\246\307B"
+	.string	"J-\274\213/W\325\312\314X\035\216\216\335\376ue\226\372\272\310\177\245\371\323\002 9\262f&\200\332\\\221D\257\3266\200b\365Q\376R\026#\377\307\263\270\324 \341_\013\216\306\035\317\306\002\241\3413-\351\2223t\230i>\350\267Ta]\023\001i\210\203\\\254\241i\223\371\233\307awJ\312\0354\267\231Z\230\3469'\361\307\203,0\376H\226\365\235\005=H\266!`\310MF\302![cjS\027\372\366N\225|>UF\313\372\213\2213\315\345~\276i.\307\363L\301\312\221\350\210\320\037\336o3\262h?\267\265\2561F\354\345\017\255\346\203\333\220ZX\3756\006c\336\022\367A~[\025\177\030\202\230\036\261\030\266^bF\240,\235\013\\\341\276]P\2335 \264Z\3466\337\303\243a\003\2347(\005`\371\001\203\325\254\363uj\334?:H\355\245\215\321\033#\240\341\251\214\035\334\356\367u\376"
+	.ascii	"\241k\201\304B5~\222\300\355\332\373g.\316\004\037\361\030\326"
+	.ascii	"\302F\235a\221\223C\235\203A\251\220\361wr\215VxZ\347l\333:\r"
+	.ascii	"\032\211c\006t\264\367\202\227/,\234\222\250\310K\231\304\334"
+	.ascii	"\370\207\246\240\177\326bG,Ip\300I\334b\366\t<\245\323\214:\270"
+	.ascii	"\2559\367\373oOL\344\"\037p\023\314z5\203\330"
+	.string	"%\220\251\321j\234\223\bo\376\003\201\031o\273\033KQis\345\025\351\277%\354rWp\254YA_\361k\3562$\243q1\007\346\2672\236\213&\321\350\366\333]:\251\272*\264A\203D\264\3039=\224\031\337|\t\215\301\221\236\0272`\373\227V\f\207r\316\340k+\240\n\301\251]\261\003\013 \3505\023\302\261F\302\357\316\377\204+\367\f\231\201t,;\251\313}\313\331\202g\226~/O\364#/\220\3634\317\212\323'H\331Iza\027Lr\311\214`\310\271\234\375\325\006:\343\226\364\304\227|\271E\276\226\225\224\207r\256=8l\217\3254\005\347d\370\370\222\300>\r!\362w\214 \250\373&\321a\225S\265A\367Ma\266_\035\364\034\017\020W\215\222\323\f5\301\260\332\301\233\350\234q\326\034\206\016\250\302\316n<\202^\212\312\215\260/\226\270\215Jc\261D]\037\351U\2263\367\357\3248\307"
+	.ascii	"k\357v\272\372\033\262Z\342\257\217\271\351$\b\272W\215\210\253"
+	.ascii	"^\025\354\016(\254$\034~@k\027\254\337\212\232A\324@\202@\334"
+	.ascii	"\b\033\250jG\346+*\352+\326\0058\330kD\357Y\211\304x\030\243"
+	.ascii	"\334\323\315V\361y\026C#Ir\360\262_\317f\371\035\202{\022\301"
+	.ascii	"b\302\032\342\366\177\245R\\B\232\316u_b\260\002B\022\255g\251"
+	.ascii	"\"\221R\233\256/\355i\033X\206\364Y\272\335\263\035\207\304\202"
+	.ascii	"$\303\312\003\363\023\004\274\237\002\343\247\243\270\361\253"
+	.ascii	"\373{}\b!\212\216\324\331\320\"n\232\230\032\255Q\271\264"
+	.string	"\264\2170q\006\355\215\322\037\f\013NR\331p\302X\017\003"
+	.ascii	"\024\006I\021\272\270\021 K\326\322\243\030)\270\333H\214\362"
+	.ascii	"\177j\204\024\001X\377\342p\2446\025\340l:T\203\331\341\225{"
+	.ascii	"\3019\242V%B\036X\363\247@GZW _\003\204\370\210\360Pg\304\230"
+	.ascii	".\327:\331\243D9l\241l\004y\351\241e\373v\031\231,e\206\003$"
+	.ascii	"\356W\266\231\232\354g\307c\345Z\031P\276t\216\3048\\\264:\252"
+	.ascii	"CR\303\002g\213(\234\312?\264H\267T\246\305\310w}`\2556x\n~Z"
+	.ascii	"2m\257\177\276\362\237\020J\314S\311\316\325@hKS\305\203\370"
+	.ascii	"\213\005e\313\037\377\351\n\231\3155c^\216~?Aum\207\327\243@"
+	.ascii	"\3508\372\352\"\226\0244\221V\337\266\241\235\354\364\003\205"
+	.ascii	" *]\345\377`x\310\030\323N&C\250`o\035\032\222\033\247\346yO"
+	.ascii	"<P\252\036\366\372N\254\210\311\375\026\235\333\025iV\253\244"
+	.ascii	"2i\335'\032\366\213\261\255k#\331~\253\240\367\"\207\323\333"
+	.ascii	"\314\220\233%\301PN\023\222\243\204FE\273AP\353,\210\332\341"
+	.ascii	"N\346\315\306\027\fd\315\374\303\242\\IwC\370\235p\221\216`J"
+	.ascii	"\226<\366\273\300K\322b\367\031\361\2113\027\340\256KS{y\254"
+	.ascii	"735\307\335c\350\375\252\271Y\\\351\006\222\314XA\2101]\206u"
+	.ascii	"\004?\207`h\016\020|\301\3110\017=\020\316\034\022k9\023\324"
+	.ascii	"n\366Q\232\227M\257\2626\274\252\300l\227\"\333\354/M\256%a@"
+	.ascii	"\3003\267\255\267\245|\245!w\245aNAY\267|\305F\344z\021\347o"
+	.ascii	"HL\316~\255\002#\303\3500\356B\3139|\005^\267\326B\3673\006w"
+	.ascii	"K\372.\344h\311\223\3778\366\223\016u\263\272-M\242\020\363\347"
+	.ascii	"\353B\0313J)\0310\233\252\201\273\217\035$\330 \177\\A\376\202"
+	.ascii	"\214\001\367Rm\036\020d\233\001{n5\347\333\013\314\312\356H\013"
+	.ascii	"\314n9X\036\364V\251\340F&\324\013\274=6\021h\330B\231\024\355"
+	.ascii	"H\365w\3337\234\362yg\272WuF\257'3U\017Ab\340\236\374\323\016"
+	.ascii	"\020\220\314\300\n\f;\314C\006"
+	.string	"\345$,\262F\310\273t O\252\321VXI\031\345\373\nl\367\300\225\005r\204\357\275\256dLbX\227c\323J+?\025\225\\\247\021A\255\\3\221\353\177\333\347E\016i\341\261\021\214\326\f#\261\307\362\227h\212G\006\332\261\3779\203\205\327:\355\242\b\325\262\346E\271\325G\3533\302\252\371^\022\264\315\202\350\365\252rO\017\021\036&\357/V\264\354\367\201!\235)\355\037\322\023\330\217X\320\274\020\316`J<H_u|lo\253\266,\331D\177\267e`\214/\244%\245\250\376E 3Gy&\024\032\252\355\373YR\262\334X\250\272U9\351A\026\277\352\251\240[\001\345\254\347\037&\276\201 \351\266Tt\274\373\202K\006\311\253\240*\267\"\224%n\207\220\004\334{U\257\367\241\306Z\030'\005\006{\234\035\353\320\217<\0323\371\251'\310\201J9:(\352\027C\204\213nS\270sf\003\376\242\365"
+	.string	"R;W\2769u_8\217\305F\225\331NW\334\344\227\026\n-=\310\030\340\353\373z\357\301\177\345\354\275.\006\242t?p\335\272\252zk:\270@$\027\236\225D\270\277\350\005Z$\316>\007\342+\350\211\322\004\032\250\363\272l\327\356`\027,\204\341\246\331P\301v\317\003\305o\351\375(\352\234@\021\345\037;\317\335\030\306\301\320\215\373\333\226\373~\026\222\035\035\370\b\r\001\346\303\021\343\251\275\314\303\334\003\340\356\271I\270)V\251\367\336z\222\256\370^./\344\200|F\030-z\2110\331I\371\202\227\243?wV\337j\022\3472\316[\242\322\253\034\373\013\211\252\307B"
+	.string	"\017\215t\251\250\377\017\210K\341\337\002S\223\034Q(N^\261o\233w\026\345\226\213\214\312\206\304U\330@\241c\211\340\005c\304\243\303\342\f>k\007\221\340\326\324\223\321\312\031\257\222\334\3453\230\376R\326\020U\304\200\002\235\013\212h\033\222(\331\202#\207rRh}\243\307Q\305\354."
+	.ascii	"\332CA\0210\324$qE\203X\036y|\013ddN\323b\313\2643f\220\323\324"
+	.ascii	"\031\b\334|\243\231\226^\214> \261t\363H\322\342,\203\345|\213"
+	.ascii	"&Sj`A\263h\261\340\357\350*\201\240\202M\372\2659\254\361$\353"
+	.ascii	"\307\206O\236\2255\033\351\251\032c\261\306\n\r\035\346\316\035"
+	.ascii	"\314\242}NR\020\304\023\256\200\r\241I9#a\036\027\331i(\276\322"
+	.ascii	"/\234\224\r\207\371[7\277\376\307\013o#\337,\007\211\24090\\"
+	.ascii	"o'WsE\311A\350@\330\026\031K\333\317n\336#_=\340I\013\256\332"
+	.ascii	"\376\315c\220K\257F\024\tx2\225\300\235\003\316!\002\240\024"
+	.ascii	"\r\254\352\314\273\226~k\224?\024n\356\264U@i%\334\\q\275JQm"
+	.ascii	"ARM\242,v\317\033\336\300\253\304q.\376\312\375x\307\266\257"
+	.ascii	"\372\367\231r\247\322\226\251y8l\264\353\332J\276\r7g\345\375"
+	.ascii	"\003q\020\361\213XE\001\237wyX\tEJvZ;\301\233\025j[\370\324\202"
+	.ascii	"\020\233\021\215\n~\303\317\211C\326\227\235>K\202\006\"\254"
+	.ascii	"\276\3653\b\2778\n\236\207\261Q\006|\324\341i\022\333\320\220"
+	.ascii	"\221MO\267\n\245\021\204\221\344\fP\224\003\307\205="
+	.string	"\370\214\232\024\034\025x9\235e\206Q^UQ\246\037\346\311\356\276\222\317\235<\223\307=\355o\3238!\023X\001\004t\n1\223i\2425x{'*\312Q\201\315P,)\323\315\235\f\\\223\322F5\315*\002{m\226\276M[Sv\332\027\243,K)k\"\024De{\340\343K\312\323D\311\301\031\252NA1\241,\253\bl\362)cT3rW\360\236\362sz$&\315\340\353\016\354m\220\323OV\232\314\270J\032\033\222\034\364\263\257bj,\277^\341\265\200\250\235}\225\357\177\332J\334\340/\312\" \227\001:\364\3057<\314\323\205\312\344\177\2203\253\003\027\305\221\337\343\2443C\264\0343\321\261\203\"%\3334\007\257\031\"rL\355*\236\317\217\327K\036P\032\007y\213\374k\r\376;S\223}\255\244\331\023\251\222Hn\233\211\334y\264\214{x]\2675\022afiS\210u\231\376\303\274&\037"
+	.string	"\303K%Z\274\033\346\022a\036\360\366\366\b\200/@N'6\372\217\367\001\225\264p\002\262Y\276P\205\201\316\246.\336\342\0306x\021R\302\025R\255\264\227v\345\001Q\262\200"
+	.ascii	"\356\036c\252F\311_\253\254Yi\311\250\306\031>\207\217\256\006"
+	.ascii	"\270\221\376y\207NT>\035)\b\253.\333t\320\276\257\243\304\271"
+	.ascii	"\023\001R$\262rQ\274\274\020\254\325\364\005\006i\r\241\001q"
+	.ascii	"X\211v\204\251\255\356\247\305Q\245\213p\r\251\373\"c\214\nx"
+	.ascii	"\257\237\tG\316\360\004\\\003\222\310\354O40\320M\275\273PF\223"
+	.ascii	"\233\356u\024?=\264\001\321Z\f\300r\221\306\f]\261\247p\374\201"
+	.ascii	"\262rY2\323\3662r\342H\021V\233BY\2208\264\351\005<\243\211_"
+	.ascii	"\375\231nX\247\214\335\020t\274\220\354\230\324\234):U\245\036"
+	.ascii	"\274\317\245'\347\262n\005\217\317}\320\246Mh\364\362tO\300\212"
+	.ascii	"\213\2068\177\370\346T\177\370\302(\225\343\363=\345\370\027"
+	.ascii	"\377b\276\204\212\244Z\266;<\347d\244\364\277\300\r\314\2272"
+	.ascii	"\256\325\017\355r\013-YP\177ii\223"
+	.string	"|\361Cp\235*i\t\336\n\003\327\002N\373p\270\345\305\321$\222Q\340\301O;\321\226\321\336\215\021\347\202M\200.K\345\311\302ix\240\243\213=\276\261\346\233\f[\"\262\254[\256\213#\376a\265\221o\236I\233g$\001S\t\364\306w\354\bbVSi\373\246\b\356\321\026\365\307\215\220R\332#\024\016\224\353D\320\237\300\223\327\260R!\267\301{|\303\314\257\230^\254\343\323\313\327&\273\232\r]\013\355\360\345\217.\317:?\231\f\024 \310\354"
+	.string	":\304\250S\371\004\f\204,<G\021\224\240\264\210\274\371\242\226F \256I\352\301\212`\005\323`=s[\036=\317f\201\302\207_\246G\327\263\033\334\3507\016\276\003\264\316\353\300:\255\243\323\334q\225\247\371\t\311f\233\256\246\036\350\204}\3603\241\253B.'\307\347r\347\215\246\005\375\315\303w\206\323\326\272\322Na\325\301\273\336\fs"
+	.string	"\003m\204!\001\006\365\271\244CEsiZ7\272Ae\222\346\332\201\f}\375\242^GFU\232n\"z)\254L:t4\310\007't\277 vT\035T\275S\273n\335\2578\276\027\352\024\375s\220p\024\037\222Y"
+	.string	"\351@\005}\206\226b\350\317\376\031k\247\r\247\2647?\364\343 \341+H}~\326\217 \201\352E\252AxH\374\205j\342\257\336re\365\255T\216\224c\217\325?\350!\375\267\242'uq\311-$-"
+	.string	"`\305\322(h\3227\005\033\025\260\263\277\241\251sF0yG\264\375\227\006e`gs\256O\236\300\205\2119X\004E<g\272\312\277s\204v#\276\0365\320\261\221\027\b\342H;O\307\020\264\324\3243t\034\262K\337\346\203\032\304\240a\302;"
+	.string	"c\363\222P\364B?U\"\332q8-\2050Z\240-\324\316\232i\377\243\t\3279\036\236\354H\033 \030\0254\256\214o\020\360\005\212\315P\366\223\243Z}9\323\354\253H\302\357\f\332\255$%\375'w\033\317\334\311;\370\rE\031\376\316\246\352w\200\277\204\325\222P\024\226$D\203#\024\311oa\336+\265A6\265F\206dz\233\365d\t\233\350n\260!\351rck\270h&\001\354\207\310\242JUU-\243$\230_\305\315d\344\301J\357mI\034\345\214\211\307\225\355H\300}\365Y\351NQ\271\300\364e\246\353)\275a\354]x\247\203\350\312\020\314T\272\335\021"
+	.string	"\320\302/\270\034\244\323uc\323\315\2432y\332\n\326\363\035\330\036\033\032\354\255\357\005\352\2076\210\343\032\021\255B\315\227\262\b\266y\007M/%i\2374\247\022{;u\201\270\204\213\242c\310\027\260\225\204\310\215\\\224S\301!> \037+ \343\300\035\237\322\35104y\350:N6r\207\373\t\022\324P>>\204\013\253\367n\214!\227\330r\3261\237\215\214\n\232 \332\345\350\300\342\277\031\035\251\251\212\177\276NGz\222\247I\304\270\332+iN\022V\341H~\331\r\2034\242\017d\365\330\267=-\352\217\277|\027\371\370\320\366sIy\357|(2\276\217\211\336\215x\365\274\251j\314\264\230\264 \210*L-\232\323R\233j\370\240\2557\322\336\244\200\345X\32093\352\240"
+	.string	"N\003b\030\261\321\023C\310\251\036\367\343Cz\245a\004f6\\e\361 \311.\257z*w\037\323\315\204\365\214\016d\250%\245\377\303\005uo\342\232\013<\317\216\035$\366\277pU\323q|f\357\250\027\004E\256\272\r\245\221\2251+\2101\357\250u\263w:\206*\266\227\007\306\f\212\310\223\022\3407\244m\t/&\230Sr]\260c\222)\201\367\363\341\246c\243\364\203"
+	.string	"d\036H\221\211\243*\240\326\201?\343\2150]$\243\356X\372\265\261\210{\335d\016\361\212p\351d'\240\210\313?\231\377]2\242\017\335{\207!Q\365\334J\220v\003\333\343z\252\230k\301;\334\237<a\333\344\323&\033\001\f\346\177\331\214B\362jt3\2123\240\272\261\263\307\262%\022O4X<Qh\027L\251'\224\2712dR\342O\302\315\013\272\310IH\252O8\341<\273\324Rn=\366\225\0276a\027\327]\023\265\233?\241\035\313\252HTj;\277\325\024]3h\371\364\023\312o\320\257.\361\201"
+	.ascii	"\330\003\226\021\f\272\272\233\204\037\214\316\377,(\226\320"
+	.ascii	"p1\224\023Yd\225\036\240\322\206\236\234\021KT\340\024\032\275"
+	.ascii	"\036[8kn1o4XZ\302S\303\245\313\341-\030\272\265\321\244\0215"
+	.ascii	"\0016;\200\213\020\272a\212\177+\202\310\311b0y@\340\n[\216\251"
+	.ascii	"\002osh\321\310\244GS\343\251SA\35433\006\247`\220s\344+QB8\373"
+	.ascii	"\246\316\307\350\331H\377\357\231\206\205z\246~\200\316\347n"
+	.ascii	"\34770\222\026\322\023\302\212\t\241I\242i\355d\230+R\231\354"
+	.ascii	"?\341\312\312\264zc\365?\220~\021\377\270V\310%\365\355\360|"
+	.ascii	"e\325\236\276\031\036\tz\256\361Y\254\246\356\327KR4\207P^\320"
+	.ascii	"\365\350\223\2700e\206\252\007\302\320\345\037\212d\254)2G\303"
+	.ascii	"\365\207\260\246\343:/\273\336\224]3\262\335M\243\f\341,\356"
+	.ascii	"#\013\006A\036\227\357\"\361\233-~\330\337P\330\340YO~R\200\244"
+	.ascii	"\200S\021Omw\006\340\377\271\031-\247R\202ok@\0132\347\230*{"
+	.string	",\037\215\021\21128\177\315\t\327YR\007/\340\202q\034{D\206\302D\\\200\307\362\276\242\312\331)\261)\331H\207\254\003\033$\025\375(\3750\343\321\263\025\203-6\026\344i\310\365\226\263\2626W1T&q\213&\021\266\254k\236\254\360\004\340\246\352*\231\262\323\320\244\0230\207U.Q[\232\330\245)8\207w\0046\200\002\227h\032\347\n\020\2168\300\006\315\031\267\275?\302Q\303 \206\251\254\006\021\315\325\177\245\323t\032\246cN\314\005\377\214\333.\213\317-\243\374\0209\243\216i\237\277\320\214\303\315\200\2532\262f\363WG\033\034\316\264\217D\236R\027\221\265{\324\311\233U\342\326\002s\305\361\b\210\252\366\303k\344\260p\364\275c\"\273\334\035\357\003\211aKG\316K\302\321x\033I\311\033\031\372\303\222\315q\036\260@h\263\007\347\335\331\027mH`= \361\002E\231\0071GCS\332\372*\027"
+	.ascii	"b\354;\357Hy\323v J\033\314\003\374\320;U\217\227\031\343TV\322"
+	.ascii	"\324\347\264h\001\304\373\003\244\267M\307t\262/\005\360\323"
+	.ascii	"\327\\\371\254\326\216\261\205\017,\037#\247\363{\ny\244\225"
+	.ascii	"\303\244aHA\206\374\277\212\311\376\303\310\204\244\316\020-"
+	.ascii	"p]K\312\200uks\fV4\306\001\302\223\243\226i\"z\312\215\016\341"
+	.ascii	"g\354\017\0064?7\247\251\251\342\363u\351B\3147\r\222\353\203"
+	.ascii	"\210\027\317\303\361\334\004b\244\262;\361\030\024\300<\026K"
+	.ascii	"\272\277Pd{\350D\373\0264\262M \226\347\320\035+\361\342\260"
+	.ascii	";c\254\365\306\304\341\333N\311G\242\260\353\246mN\205b\252t"
+	.ascii	">(Q\317a|tI\023\303C\013\224e\344\265=\376O\333\3262\340\342"
+	.ascii	"\346|I\277\373\312\235\n\367k\034\371\237M\216\2226\341\247\304"
+	.ascii	"\246\023\343x\351\270\252l\345\226\216b?~g#\n\020\037\013^i\311"
+	.ascii	"r\344\"\001\216\006\235?\032\261\372\201\267^?\240U\222\313\232"
+	.ascii	"\267L\217\336\340\312\003\213`\017V\024B\355|K8\002H\270\323"
+	.ascii	"\205\244<05\302p\212\2614\365V\333\220\n\202\357\351\305SO\213"
+	.ascii	"G]c\036"
+	.string	"\361\025\265\242\231\210\336Y\245\334\260-+\350\337C\237\310>U_Xl\267;\320S\342F\304\221\255`\354\275n\216\237T`\377\377X\032\307\235\034e0\365^&,\354\025_/\3241\031\214\254W\221\355\235Q\327<\323\234\321ySX\352\256\276/\263c\320=\336\305\3726\357d\025?\342\371\261D3\343\030\230\3237N\274\367\354\032bz\317\251\332\024\034\327\224z\260(\271q\321\356\253"
+	.ascii	"\257\265\274\002\266\337\251`\rT}\006\025\266\037`\306=\377\273"
+	.ascii	"\013\240\367\242\220~`2t\373\207\310\237-G\201\300\035\321\273"
+	.ascii	"\177\366\367\210\353;\2277\216\263\230\023\262\307\302Q\240\362"
+	.ascii	"\203\266\367l66P\033\231;y\013\247\327\353\3469\301\013O\217"
+	.ascii	"\261\004\337\347\205\204f\212\333\203\365\367\\g\036\363\313"
+	.ascii	"\237w\276\016\351(\255\017!\364\360\372\2639?'u\037P\376\316"
+	.ascii	"\373`\373\245\340ms\nv\201Q\332\367\377\315\030_}c\325\bd\317"
+	.ascii	"i=c\303/\253p\207\\\226-\305\256-\277\032\362\177\\\035\277\002"
+	.ascii	"\363\204-\232bcz\021\261\332\210\233\352\225+\f\344\220%\236"
+	.ascii	"\330\322\f\341\373\311\265k\252z\222\001\373\242\022\3169\326"
+	.ascii	">]<\214C\307X~\376b7&\205[\003\213?H\305sp7lF\030O\300\335P\321"
+	.ascii	"\332\247\373K\221\372|\256\372\260a\\\370+\030\372\361\016\315"
+	.ascii	"]\376\313\320%\231\317cx\256W\301\355@\314\207\346"
+	.string	"{\250ZzP\310\033\363\301\220\351O\322\355|\213\311\022\371\016\025~\305p\2746L\006\036{\311\376D\335c\013\365L\f'\353\302\217\3229\227\365L\236,\214\024?\207\357\244\353\355m\332\370\367\263\356I\331\213\310Q\013\347\272_$\347fF\373.\334py\034k\252F\007\340\217\354i\375\334\317\037?\376\322\365\332`o\313\304|v\373\2165\262\333#\260\033\372q\262g\320\023\271G#[\327\3626 L(*\177\214\253\213Y_\213\375\325\365\204\034Fl\366n\341\261\305Z\367N\245w\223\302:\367\n}\224\324\235\351\346\356\315}2\253m\f\276\3710c\351\277\024K\026)T\016K/\263\0025u\355\341\343\005\341~?g\261@\013\311\240\035\037\256\353\256\307>7\343\301m,-\277\035\2159\003u\033\300\2544\341h.\177|8\177k =T\373\273\200\370\201\3705\353y%\246Wk\223?y\345$"
+	.ascii	"xqN\317\350\312\331\345O\303\323\226\200\344\240\261\366\004"
+	.ascii	"{\203\327\363v\007c\237\\\335\352W\230\272\255\2377\035\260U"
+	.ascii	"+\2270\256\223\200\357J\374\"#\033\237\364\305\360\341K\365\373"
+	.ascii	"\346% \275l\357u\267\217=Z\335\312\324\262@\334C\346w\340\334"
+	.ascii	"\227\202\376\3417\241\3563 \273\020\017\267]\250\317\005\315"
+	.ascii	"\331\331q.\373\f7\332~D\2533\264\267\377\352\370|mN_j\346\346"
+	.ascii	"\206\243t\032\323\336\215\244\271\030o\236>D\273\363\004\316"
+	.ascii	"=\373\277~gA0\026X\241\007\3016\317x\361\362\t\277\263\037\357"
+	.ascii	"p{\266\271\336\270\334\032\236\267\255\262\r.x\302\341\350\227"
+	.ascii	"\265\352\331@o\253\276\002\336\025\315\377\234\375\207}]\374"
+	.ascii	"7\325\276C\377\372\345\256}|\033m\343?\037l\027\203\235\325\354"
+	.ascii	"Y\206Jnn\303\303R\237i\360_X\3460\3541\303\255I\035W\375qU\362"
+	.ascii	"\221p\364\203\371\237\002\376?L\217ff\270\231\017\003,\024\341"
+	.ascii	"\205J\275\353u\314\335Oe\351\335\251#\030\267\226\372F\016\371"
+	.ascii	"\263|]\235\252\233\346\340\243|\350d\364;\324Z\360\314\301m`"
+	.ascii	"\2662\354\273\300\373!~xW\351Y\241rc\330\250\214<\234\244\364"
+	.ascii	"\244\267\024\340s\352\331\213\362\357\022}v9\302\300\344~\t\357"
+	.ascii	"\261\227"
+	.string	"Wu\377m\232\263\007'\376\310\370\026\005\363;\311\324\251\305DN/\252\2079{'j\347,\331p\342\016P.\276/\362\204\023\331?\365\375\232`/\t\223\373+\230\216\205\342\377\346I\221\277\317o\225pv\023O8\375S\216}\330>\032U\331sy\307\204n\214\177\016\327\f\324t\255\025C2\326\335W\364@b\364d\340#G\276\020,\342\233\373,\237\216)\224o;\302\347\256\316;\016\366c\3559a\213\307\254+R\270=\320>\213w\033\213\373\333\273\223\"\366f8G{\266\332U\351i\375\314O`o\007\226\274\032|_\177\333\254}b9.\207\202\247\261t\264F\301\346cM<3\306\177\035\f\353\004}\303:\221)K\2110\213A\317f#^\310\330\325\260oVl\346\373\213\001\305\001\3437\311\363\363\nK|\030syb\276dgL9\334\226\272!\223+\270\277:\320d\003j\016\243p\320Y"
+	.string	"\3749\267\336Jm(\226\217\034\334I\035Bg!\320\201\204\342\246\264n\212|\217\270\265wn\307\240DN\265\275\274\356\343\336\376a\216\203\371=\350\bW\016\310\026n7\366\336\244;Q"
+	.ascii	"N\331l7\272~\347\035\265'\035\345\324p\007\266\374\231\215\233"
+	.ascii	"\237A\352\027\233m\343\270\r\202\\\260\376\231\255c\261&\005"
+	.ascii	"\307X\t{\276\374\235\276\346xOA\341\002[\016k\006\250\r\336\366"
+	.ascii	" \"S\367p\365w\362\303\233f\377"
+	.text
+	.section	.gnu.lto_.symtab.56bb4f0a239f5aa2,"e",@progbits
+	.string	"blackboxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\007"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\b"
+	.string	""
+	.string	"blackboxValidateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\b"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\b"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\b"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\b"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\b"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\b"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\b"
+	.string	""
+	.string	"pgResetTemplate_blackboxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\b"
+	.string	""
+	.string	"blackboxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\b"
+	.string	""
+	.string	"blackboxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\b"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\007"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\007"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\007"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\007"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\007"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\007"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\007"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\007"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\007"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\007"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\007"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\007"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\007"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\007"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\007"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\007"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\007"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\007"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\007"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\b"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\b"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\b"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\b"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\b"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\b"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\b"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\b"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\b"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\b"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\007"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\b"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\b"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\b"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\b"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\b"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\b"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\b"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\b"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\b"
+	.string	""
+	.string	"govState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\b"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\b"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\b"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\b"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\b"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\b"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\b"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\b"
+	.string	""
+	.string	"blackboxPrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\b"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\b"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\t"
+	.string	""
+	.string	"blackboxDeviceCanCompress"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\t"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\t"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\t"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\t"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\t"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\t"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\t"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\t"
+	.string	""
+	.string	"blackboxEncodeSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\t"
+	.string	""
+	.string	"blackboxWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\t"
+	.string	""
+	.string	"blackboxEncodeUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\t"
+	.string	""
+	.string	"blackboxEncodeSigned16VBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\t"
+	.string	""
+	.string	"blackboxEncodeSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\t"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\t"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\t"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\t"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\t"
+	.string	""
+	.string	"blackboxEncodeTag2_3S32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\t"
+	.string	""
+	.string	"getHeadSpeed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\t"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\t"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\t"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\t"
+	.string	""
+	.string	"mixerGetInput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\t"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\t"
+	.string	""
+	.string	"blackboxEncodeTag8_4S16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\t"
+	.string	""
+	.string	"blackboxEncodeTag8_8SVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\t"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\t"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\t"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\t"
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\t"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\t"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\t"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\t"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\t"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\t"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\t"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\t"
+	.string	""
+	.string	"blackboxDeviceSyncCompression"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\t"
+	.string	""
+	.string	"blackboxDeviceEndCompression"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\t"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\t"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\t"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\t"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\t"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\t"
+	.string	""
+	.string	"blackboxDeviceFlushForceComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\t"
+	.string	""
+	.string	"blackboxDeviceBeginCompression"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\t"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\t"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\t"
+	.string	""
+	.string	"blackboxOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\t"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.56bb4f0a239f5aa2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
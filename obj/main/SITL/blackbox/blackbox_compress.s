@@ -0,0 +1,463 @@
+	.file	"blackbox_compress.c"
+	.section	.gnu.lto_.profile.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\002"
+	.string	"\003"
+	.string	""
+	.string	"\b"
+	.text
+	.section	.gnu.lto_.icf.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"U\005"
+	.string	"\304\006A\001"
+	.string	"\t"
+	.string	"\277\341\334\331\r\036\002"
+	.string	"\002\001\002\002\002\001\002\003\002\002\001\002\004\005"
+	.string	"\002\001\001\326\273\357\312\007\024\006\002\006\322\204\342\205\f\034"
+	.string	"\003\003\002\001\003\303\263\211\310\t\030\004\264\320\317\246\001"
+	.string	"\005\250\350\262\255\b\004\004\002\001\006\331\373\231\263\003\016\002\007\002\007\005\002\001\007\261\312\232\370\b\002\b\257\250\235\340\b\006\002\003\002\001"
+	.string	"\033"
+	.string	"@ \343\n\2209\274\222T\253;5\300\036\203P\013\204Px3"
+	.string	"\310\003\026\300"
+	.string	"X\200\354\266\341kg"
+	.string	",\354$"
+	.string	"\n"
+	.ascii	"4t^8\223\303Q\004v\371\276dm\227C\001\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375 \266\335\002"
+	.string	"\002D\013\022\300%\035\377\257\377\377\377FCo#\204\020\262\345N)\005\030u\256@P\241'\373\373\r\022\233\021\217\327n\237\326\022~u\357k\034\002\022"
+	.string	"x\030l\013ye\216\033:\254\t!C\335\313Q\200\200B\220@\0042*\343&5\0073"
+	.ascii	"\026\"@\3708K\277\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`\367\002\265\021"
+	.string	"\026^`B"
+	.string	"\221&\351\\\033\261n\271\307\342\323pR\327lu\216\021\225d?=\310\274\317\357\365\217\314P\004\377s3\300\374>\376\377[U\005"
+	.string	"\025"
+	.string	"T\2212\204t\342\256\337\256\305\303\177\324\272Y\373d\313\235\002J"
+	.string	"O"
+	.string	"R"
+	.string	"\031\250\244[\332V(\337{\023\252\265E\230\253]\020\336;\352\373QO\357=\f\373\021_\256)\276Q\\\303[\252\257*\300s,UWGP\004^\025\031k\004<94R\251\024~TWMW#\203\266p\200a\341\300_\347K\026\250\263\310\rr\250ks\034\312\274\034!e\361\013zaKAau`\305n\212x'\267\212#\020\353\203~TXG\212\262\245\244\0300\3561\331c\322\2631"
+	.ascii	"\246\331\315HEm\330@\\gg\245\252\274GA\300Y\347f\235\233}\360"
+	.ascii	"L;\242\016\341\275G2\2222\263;\377\215\233\3032\312\323{\257"
+	.ascii	"\343I9\243\006\313J\201R\276\320\370\200\202\340,e\211\n+:do"
+	.ascii	"\252\006\031'\022\022\024GSWL\270l\036\367\013\265Q\247\355B"
+	.ascii	"\016d\007r\327\201\034z\330\271\217\303w\335\247\332\272\326"
+	.ascii	"\r\223\\/\312\f\206\367J8[\3565\371oYn<\235\222@\n\035TXE\356"
+	.ascii	"\030\322\027.H\264\270\316\340\027*\307\f\371\335\270\215\333"
+	.ascii	"\221\252\262\245\234\320|\203\252\210q\022\302\243\003(\266\243"
+	.ascii	")UP-\233\201\253\264\016I\027\214\307\004\377N\250\301\224s\016"
+	.ascii	"1&4\222$J\341\030P\242Bd\347\001\021`\251\222\354hZZ\016c\370"
+	.ascii	"\240\247\033\215\367-\215\030b\037j\035S\"\322\216oy8\n5\024"
+	.ascii	"\255\373\203U\3255\260\230\2727\\Y\301\"\272\032\177fFW\350'"
+	.ascii	"\323\237\353Z\007o<\007\004\256\031?\216L\024\200\001U\367\r"
+	.ascii	"\270H\023\261\352{\305\022\243\267S\246\036~\307\374dD\317\214"
+	.ascii	"\324KXc\311\204\270\224\335\002\"B\313\362\007\004\317\361\246"
+	.ascii	"\226G\264\332r!\322\0020\216\303\220\225\372\320\344H\\\027O"
+	.ascii	"k|'}\345)0\337\334\307>\206\321\252\367c\237)\251\032,\205\200"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`\236\001\215\006"
+	.string	"\202\311\032!\220)\351\377\307\207#\337k\017\314?\347~\035\267;\323]\377w\037\332\315\277\020\241\326\3757\221I\006D\334_\310%\3570G\346\363t\rz\213\025\b_@\373\344\006\353\016C^\347\225\241!\377\270\357\370\306\345U\005=\353\335K\374hN\026\007\242\224\370L\212u\224\322wc\337X\347\265\036^\317$\025\025\246\356\241g\200e\004' @\002B\024;z\366\020\002\210\020\310\217\265-\006\231[\n+[hH\004\017W\266Q\237d\"\002\202\224\230\257Dm\310\202AJG\263\260\261w\n\036\bJ\232\203N\t\305\376\204\203\342@=\022/\004\326A\336\t@\035\223Ih\345\214N\274\235\315\025V\200k\305\314\202m\316\2150\320%\026R"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\230\004\005"
+	.ascii	"\232\004\006\232\004\007\231\004\b\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`\227\001u\007"
+	.string	"\302\310\027\035\260%\351\314\241 \314\013\030\200\243\214k\030\206l\271\017\032\342\326\252\335\2665B\244L\001?\353\t\230\265\020\222N^\301\306X\271\370l\\\3465\177\307\323\235\252\206\214\203\3660{\222#M=i\177\303`\033\266\016\252\017\375sw\242\212@V3*H\253\210\346\351\364\234\037-N\312\003\267\020> p\002\2219\333\003B\206\324Q\003|\032\201\\\300\215\\K\b\224|.r\366fX\362\r\034j\016\242\267\270\356\345Zj\212\213\341\271X\221\264\fR\004\356bDF\276"
+	.string	"q"
+	.ascii	"\232\315`D\007=X\206\366\\\226\351q\213\3018f\n\355\302b\200"
+	.ascii	"\207s\360\320\302\234\227A:\216\fG9+8\021\364\027@\302@\273n"
+	.ascii	"y\331\225\336/eVlo\245a\276l9z~p\255&\0068\302h\330(x^q\364a"
+	.ascii	"\357\342\302Z\031\002"
+	.text
+	.section	.gnu.lto_.lto.1fde09ca08b08307,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_compressShiftLow.4.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`\205\005\035!"
+	.string	"\206\271\311J\240\326Q:\225q\246c\0338\367u\342\231\342\025=\206\226\277\255B\247\021\277edF%\026\302SC\255\275\315\236\351\340\b\265\316\371\217\320a\345@[X%^#\207HQ\006/\322\03256\327O\361\243\375F\310\336D\356$\003\262"
+	.string	"\250"
+	.string	"\265"
+	.ascii	"\267\272\221kW)\262\246\264\250\320\340\001\321\253\206\316\273"
+	.ascii	"\303\304\262\241\004voQ\301+K\340\025\314\265\327\327\230\371"
+	.ascii	"\224\371A.\204\350D\026\007p/T\026%\367\026\0270\204\363\225"
+	.ascii	"\213\277\331\327\363\001\354+\0231oyQ\352\2326\222\202F0\367"
+	.ascii	"^\\\337\340J\211>;i\246\255eS\"\276\3713\023\016\213>3\177j\270"
+	.ascii	"p\372I\303\203\351\264\322DR\312q)KM\245\017\031\330\222\033"
+	.ascii	"_\240\307R\fj\302\270\r\036\201\2642\275\224\262\344T\033\036"
+	.ascii	"\321\236\031\376\312\235{\357\251N\223\206G\224\232?\367^\246"
+	.ascii	"\302\241\213s\355\314\f\204\231/0\327\022\001\3356T\200\310\037"
+	.ascii	"M\236\307\030&\253;\312&\226L&\237\300\322\016\262\352:\242d"
+	.ascii	"\374\246\375#A$\357\216\305;\357\275=\374\"\031<\2348^\371,\354"
+	.ascii	"\353\333\324\"2F4\242I\346\342\217vTV\322\030\0237\024s\215\362"
+	.ascii	"\316\214\262\016\215r\316\2142\201\2232\316I\371\246\346W\347"
+	.ascii	"\333\211\277\200W\235i*e"
+	.string	"[\245<S)\313X\3121\226r\315\244L\253\224g\225\362i)\233\226\2625)\327J\271\254\224\333R\246\225\362\017\330&Ql\254\334\253\224\fs\275\352\022\035\257\372\257\370C~\\q\"\334ZG~\274\310\001\275\323\234\323\354`\006R\027\361\217\207\362A\330\305\341\334\351\262L\370BG\303\237\200\3109\321\t\221\336{\213lG\361q\370 \322\236\374\220\275\3613(\036\310\262\246i:)\302u\026\247o\325\305\nJ\355\t\347\032\032\340\363#ox\023\016\266+\367\336\236\327\007Xd\3344\201\256eA$N3\321\361H]\030ft\235\275i\234\256e\300\247\337\221;\\K\3077\375\343)\226\220\251[\323t\355\023\235\270\200O\345\275\367\326\216b\240'\031\342\271R\323ux\034#\226}kZ\026D\336\310\337e\337\370Jl\022c\037)2\260\222g\273\273\206\325\327\316y\313\276\003C>\037\320\256\362N\204"
+	.ascii	"BQ}=\032\357\030\b\t\361|$D\364v:"
+	.string	"\025\275 \020;\240\020A\270\021\037\200D\340v>!\034\203\004\334#\301\363\341L\364z>\\\255ht\n\\^F\375c[\213\361\250\026\236\235i[?\330t\312\364L\333/\3000]x2=\243\2615E\214\341b\313\331Z\307to\311\325\372T7\300\205\311\214\326Yn\335%\f\2335\255[K\020is\366\254m\031\020\371\303\302;[f\230d\212ht\276\217\\HCZ\316\232M\277\254\276\314\256\222\323\221\252[\3020[2\231L>gm\233M\267\200O?\f\237\222\263}\343\021DA2ev\224\316z\351n=\026\250~x\241:\001r\250a(\311\030\"\310\251@D$\214$i\306`\002\03113;\020XG#M\2224\006\217\021\301 \007\276\033\377,TD\265m\f\256\005F\377T*\260\246\306b\350e\204\205\275\377\026^\210Y\323>\177\370S\220\312\n'\b\347\376\273\311zsP\336\250"
+	.string	"\240\215\335\020iQ\362\241\360\273\246\334?j.\370\003P\002n\373\373\025\344l\"\035J2\343\2412_\035(@\256\362\204f\203"
+	.string	"\036q#\212p\")\361\307\n\200\207>\223\0335\031\264\371\357(\236x!\271"
+	.ascii	"B\336\203\207W\266\361\"\320\250\007\2306<\305\\b \003\313\n"
+	.ascii	"\\\224\247Q\303D\234<\033Na72\371\231\020m\355\222\241\273\025"
+	.ascii	"\320c:#\376\215\025\3451\240B\301\245#S\3376\317\356\263\274"
+	.ascii	"\177\250B_mpq\340\315\256\346\211f\321\007vO\006\371\3112-\305"
+	.ascii	"\177\274qW8>\253\\6\021\324"
+	.text
+	.section	.gnu.lto_compressBit.5.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`\325\003M\031"
+	.string	"vm\235E\300XQct\2056\373\302nqf\262O\002\034\264\311H"
+	.string	"pU\001\0340\301b\214\361k\306\363K\013\335\304\0219\266^\b\334|\020\001\333\266Y\3016x\301\0304yJf,\203\253x\262\265\275\267\334I\246\024\212"
+	.string	"}"
+	.string	"\214"
+	.ascii	"\252is\001\344Ah\031\343\305\034\210\001\252i\033\362i\340\330"
+	.ascii	"Z\207w\314,\024\302\2539\177\234\f\2313w\240\nB\313\346\374\362"
+	.ascii	"Y\206\006\360Yv\326:qN\306D\325h\350\370\2402\347d=FMq\346\320"
+	.ascii	"$A\357qV\357\340p\034z`N\211\032NbB\205\267`\351\211QN4\201\f"
+	.ascii	"`\234\340\261\214<\006S\330;\341R\370-8\233\0273\347t\221\343"
+	.ascii	"\b\\-F\220\301\234\263q\007w\302=\271\255\210\266\023\3323\t"
+	.ascii	"\341\214\020\237\245o\202b\244\212\020-\356\332\034N\374\213"
+	.ascii	"\326\013d,=\351\177Z\367\260\005\230\310\205q\316~\261\220\035"
+	.ascii	"\340\261\253\307\252d\254\213\214m\001cY\300\330\024\030\213"
+	.ascii	"\222\261'\031kzl\370\305\202_\354\367\305\312\307z2\366\217\215"
+	.ascii	"\217u\f\350\203\204\300\2249K\354\254\314$id\303Dvk\027\025\325"
+	.ascii	"\226\250C\210c\"\fR\263\361d\316\234\001\313Bh\317\303C3\367"
+	.ascii	"\220\361\0023uO\351\006\204\272}zv::\332\021\030x\003)H\205w"
+	.ascii	"z\312\364\377t\337\200\344o:\205\036%7]x\"0?<\207\036\244\033"
+	.ascii	"\020x\243\013/K\274\023\345\273<x\337Z\300\374\373\205\350\350"
+	.ascii	"h4\036rA^\3368\n*\200bG\216[\346\023\360\001$\224\f5\261\305"
+	.ascii	"\245z\217\207yT\272\341"
+	.string	"\250\305]\177\357\326\321\321,$\302\253\006\361Y\376\240\217\021+Pn\221\317\217\227Wn\272Z1\030\b,\234s&\250\177H\210\005\0264l\210\265\344\315\253\365\0177\257\f\257\326L+&\253A\311b\247\272\020\330\330\320\310j`1W\005\017\261\026\006\327L\206\026K\303k\006\306r\311lX\bd\032\253\241\221\261nb1\031\013\225\233\376\217\003\026I\264\327\302\277(\270\333\355\f\373V\367\322\320Q\022lu\211D)H\310\336\234s\232T1\300\333\031W\364NSE<I\266\343Tu\024\256\256:\007\037\244\233\225\332\213\214\344\340$\350\322\362\337\205\345-\217Rtt.\342\324Y\376)\335t\265\253\002M\250q \250\220C\310\230\0043\"\242\305-\006`\002\221Av\036\021\200ADc\013Rf\2469W`@\035\251\270\244\342v\205\364\n\022K\020\334\025\355x\211\021`\265\037o\\l&\343\351\177\271"
+	.string	"\037~\302.\222{\366K\004\325\362\007k`\332\261\2311I\210\364\304\032\377\357P\335\371\303\347b\020\234\025}\317i\212N\374\364\"\030\312\001_wxd\333\227\004\372\310\243\\\021\262\n\342.%D/\231Z\312\256\b\233\307\265f\241%\371\325\ni]E\2624\036-\2611\251,\203\252\223"
+	.ascii	"\246\226\3443\370\222\324@\252\271\"\310\237r\230\353f\253?"
+	.text
+	.section	.gnu.lto_compressStartBlock.6.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`\037\006\275#"
+	.string	"v\276\332I\220VN:\201\016\365\232'\372|,8\256\260\367P\251\026\261\364\233\032\374<'t|\002'\274\312\363\303\300\266\177n1\f(z\332\311\205\004\2264Qp\023s<\213\351\224Fo\001?\366\277\217\030\346\251EB\310&r'\031\306"
+	.string	"\273"
+	.string	"\312"
+	.string	"\314?r\255\243\037c\034\300\275UV\230\334\213\344a\b\351-#\337;o\323\327\234\267\314G\314V\216\264\272\250\017'L^r\367\336_\003a\346zaj\255<6o\"\317\247y\364\030\031\336\016&EOkv=\342o\275"
+	.string	"\325\032\261\210\364\230\017\243.c\366\202\020\301\372\024'\035\346\202\2620\261+\245*/\307w\246O\\\332\2478\3410%\\\021\251\036v\002D\234nT\030\002?\236\242\236\242\023\2247\360\206\325\343)\307Q3F\255\b\216\231\"\223\331 \nL\355^I\365\334aA\335\332\2709S\224a\016H\2766\025\225j\337\353\013\244\314\210E\250Wt\302\275\227+\261\370t\2369\363y\230\031\004\263u\nIFq\262`z\357}\300\037K\241\202/$\306y\353k\245\226\221\343\273\366\231\352\206uit\261\027\351\275J\021\202\322%\237\004\267\357{\235\007\213\333\034\331\260.{7\225\244K\267\221\031\231T\273*\311D\nw\025sZY\347\254\234\203V\3069+\007\260\225ole\237M\257\346\307\177w\260\263\375\327\331|\327\271\315\312\265+\277"
+	.ascii	"*\227&@\354^\032K/\027\315\222\r9\330\377\365w\275\231\227\360"
+	.ascii	"\303\230\007\246\344\222\333\220*\277\336,\034\311\2230\256\204"
+	.ascii	"\273\350v$\337\213yI\316u\364..K\221\234\322$\327\331\225{\357"
+	.ascii	"\316-SHo\007\2300\230y\267\225\307\314\257\001'\263\317\335\200"
+	.ascii	"pr\177\210\223\331\303\333P,8\232\345r\271\274\202\223\371\303"
+	.ascii	"\327BX,orp\303\2238\231E\234\n\t\232o\375\300\330\033\332FF\317"
+	.ascii	"\254Mw[\335yw\223y.;\273\177\344jS\252t\217Q\253qv2x\267M\337"
+	.ascii	"\353&\235\224\231m\343\203'Z\260\307\226a+\013\016@\315i\235"
+	.ascii	"f\234\346\006;d4\022?\371(\302\224\b\005(\325i\363\013\021*\247"
+	.ascii	"\037\306T7,\361'-R\234\3369\316\035-\r\036Zf\033Y\302\203\347"
+	.ascii	"M\237K\013W\024\245J\307\2657\334\t\320\307v\357\215\360$\377"
+	.ascii	"\334\f\210\206\355\326A\025\035\276\016\320\366\013S\335M\227"
+	.ascii	"\005\017X\235\230e\370\340\351\353\233\266_\226\246\222\002"
+	.string	"<b\004\005\243\005:!\0242\213\214\200\212\204\204?h\360C\302\035\377\364\020\021\001\r\261\b\022\376\2240\022\232P\361\003\\a\342'\024\004\006\375~\206\210~=\nX\310\002h\350W$\024\016\375x\310\341\273\212\277\36549\2076\354\244\2306\362e\272\212yt\273\232\3566t\347\246\331\365\nmR\267\3063\273\246\257\274=N-\353\325\214]\033\231\247L{m\203\310\354\334vS\275\266\353\017\363\336{al\367\372YT\311\245\251$-g\346\242{\t\366\2601\263\213w\251\200\300\352\302\3510\370\302\316\203\304\213\034\\\323]\031\233K\333\230\341\\\266\244\235Y\303\343\202vlKz\037<\2319<K\020\006)\316\312\231;\374\n\020-\306e\001\003}\250\201(\345\034BH\311\214\210H\223$\035p\002\231\261+n\021\220\255c\210J\nR\234\016\217\217\300\360\305\n7J\200Pb\310\013:DK\313\350"
+	.string	"\022\3343\325\006\323FH44\273\034\260\315V\352\035\336\017IuB\316\t\204\343\t\251\267@\224\254\242\273d\240\352s4\236g\013S\034\217,5\307\350\3232R\2267~g\335x\n&\177\177\263\017\305\243 '\360\270\276FI\300\003/> (&\354\307\342A\201\316\363\351\275h"
+	.string	"\343\211\272\001\202\007\316\361\230\240\220\265\3531\315\253\002JC\310\350\264E\371\023\321\303\300\333\370\366\216:\n\032\346z\216\331\264st\372\022\277q)\b\245\017\243)\203\244\037\244.K1\245B\357i\271\347Y\342#\372\372\033("
+	.ascii	"\255\331\025\202\026W0W:A\234|\024\237\231\232\356\030$\350\316"
+	.ascii	"\222&\337\227\240R\204.\215PO\027\310\225Z\306#; \311\2758T\332"
+	.ascii	"\rC\274\310\216g\376"
+	.text
+	.section	.gnu.lto_compressEndBlock.7.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`)\005\335\035"
+	.string	"\3663\264G\240ZQ:\307;]\355\033\212\036\221\030hs\027\277W\337\337\033_\001O\321\344\332Rw\324\211\355(\364\265G\016\350\357\342B\217\324\300s"
+	.string	")\214\005\203\026\306\212&\252G\022y\304x\367\373\257\323\326\b!\233\310\235R\233"
+	.string	"\230"
+	.string	"\240"
+	.string	"Cj\2557\2476\n\373\346tol\177\3327\362#G\377\245\270\254\326\035b\234\324\n\004\262\203\362\324\300\323\306\323\362\263\361\324G6\231\003}\225\3241\324%QSk\255-\017\323\213\300[\234Gw\225\344H\305\235G>\031\341\351\004z\bw<\244\273\006\344xQ\343\345\026\246\032\301\017pb\2421\311\031\037a<\235\350\003\2654\251\370\262\252j\002\343\251\020\031\370pj\372\324'\013^\322\024\233b|?u\004\276\253\035/\306'\031\241\326\352\271\343\275\270_\267]\304\366\004\233\n\b\25721\263v6\321\231\330\312Zk\203% \212\022\370~\244\030O\277/\237p'#7\267l`\322\334\236\325\0171j\274;\354r\272g\234\346!\247w\306\351"
+	.ascii	"\3424M\234\326)\247g\343t\0169-\033\247\001\210\3231q\032\206"
+	.ascii	"\363\337\357\272\324M\322\351Q\234\246tZ\024\247W\234\236;\375"
+	.ascii	"\002\257 Z\004l\325\352b\253M\305\242O\200\\\352\366\201\376"
+	.ascii	"\224\222\013\217.e\253\022\211\251\024&\331\225\251\265\376\234"
+	.ascii	"ZBy\352#~6\006\247P\312\221\034\n\305\201\266 \f\217:\023\205"
+	.ascii	"Ei\262\261\270\026n\345\302NV\255\365\301\241\214\341U2\304\262"
+	.ascii	"\030|\261\241\263\001\226j\351\206\264\235b3\340\373\316L\356"
+	.ascii	"\266QgiK\265\016e\r\217b\235\245:B\344\267+\356u\303r\356.\320"
+	.ascii	"\3220\311\033\016\245\234\373\247\3778\t\211\374\350\366LRY\234"
+	.ascii	"]0\363\347\344\262\240\267\325H\356\177Q`\224&\233\213\265\326"
+	.ascii	"*&8\2718{\302w\265t#inY6;\004}\352oA5\003Ki\221v}@\201\261b\267"
+	.ascii	"g\0336\377\003\343\327\265\366\320\207\371\235}\226\026\311\016"
+	.ascii	"D\307\335^\026R`d4\204\023Qt\023\352P\342\346\301&\024\004\302"
+	.ascii	"C-\004QPQM\bgTSp\3007\021C\270\032\211\333\rW\273\001\346\376"
+	.ascii	"\364\222\252\t+\267I\256\355uy\232\234\235\255e\301\23713\313"
+	.ascii	"\251\3602\262r{\276\362\330h\016'\0234\206\217\201-\200\330\206"
+	.ascii	"\271:lcAk\370\027\330>Hw\\ \3350\347\205\256!\267g\033\271\330"
+	.ascii	"hY\024\236\206\240\341\231<\333\263\336Y/\300\241b\221|\250o"
+	.ascii	"\271\225Z2\224=+j\355d\360\354\253t\303\\\205g\031Q\356\354\317"
+	.ascii	"o\315\017A\024!F\306\355\031\302m#m\003j\250\201,\005\241R\206"
+	.ascii	"D\002\221 #M\322\001\200\002\031*3\017\021\200-E3\246 \005I\352"
+	.ascii	"t\377\027\201\367\322\006\230\366yu\017{\333\036w\347:\272\226"
+	.ascii	"\020\342\337W\006\364\tu,,-`:\037\266\360\377\276\365O3\364\253"
+	.ascii	"\272>V(\305\373x\361\224\247\372\025\237c\ns:n\340\264\324h\034"
+	.ascii	"\337\312\357\002\254\253\246\006<\rx\367@\247\210\311\2255\235"
+	.ascii	"\255\374$^V\365\0064\245hR[\025\361v\374\32550*!(\224\3410\313"
+	.ascii	"m0 \274\001,)?\363\250\2567\255T\317\361Km\201q\366a:s\304\007"
+	.ascii	"\236\361\216\203h\002<*S\013W \025\316_\033\034\271\363\312\372"
+	.ascii	"T\223k\257\244\207\252\003V\373H\362\00185\003\365\025\210\341"
+	.ascii	"8\323\327\3531\221\337\225\255^\003\331}nV\266\314[v\347\243"
+	.ascii	"\177"
+	.text
+	.section	.gnu.lto_blackboxCompressInit.8.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"=\n"
+	.string	"\026\323F= \345*\035 w\022%\th\033@3&\241Y\315\320\005\322\023\316\006\216\f\276\"j\331\217q\262\2135X\301\240\3057\203\026\220\034!\"9\02688!zW6\305\272YB\b\331;\2451"
+	.string	"4"
+	.string	"7"
+	.string	"\236\317\027|\3676'\370\356\331\264g~\212\354i\036\034\264\232\335\rk\310\315S\323\277\3129\256\327\352\024t\330]S\327\013v\327\333F\260\035a\377 \353\032\263\177\376\335e?\005;6\030\205\227\335\216\\\200\305y\267\022\333\367\330\246g\312@`[3\222\207S\373'G1/S}`7&c\333=\027\334\260y\366hA\3572mI\301\265\352\312]\265\313\263\244@X\r\300\307Q\237}\361\025\324fw\031\374\231FF@\314\210\352\273\007\336j&4,\232\263\317\025\255 \366\273\335\r%\b\321iD\242@r\354X\374\224\245\2104\221Fq\002c\fQ\210\240\212PX\032\201H\241H\226\341'\301\243ID\206\247q$C\317\271\357\266\306,\341\202c\325\rs(\255\001\020"
+	.ascii	"/\344\203\245\236L\350\021\007&.xI\245\376\364xhv\275\301.\273"
+	.ascii	"F\261\302x\240D0\"@E\001wy\321N2"
+	.text
+	.section	.gnu.lto_blackboxCompress.9.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\006\235$"
+	.string	"\252Cp\016G\220\332M:)q\234&\250"
+	.string	"\032\245\216)\240\b\215n#\337\336t~|(oF#\027\202\027*\352\263\264y)\216\353\372>\373\314M\025\275\"\341\"\276\b\316\325\215R\217\236\223#\253\217\004\252Q#\204\020\"wJ\001\317"
+	.string	"\305"
+	.string	"\323"
+	.ascii	"?\r\346\247\370`\276}9hFY\231_@\256\264Z+\203\217\316`~"
+	.string	"\374\315\366F\271\027\324\2458(\002\325\251 ZXj\255\016\214\301\374h$\322\337\f\001@u\312\013\253\302\251\375'\207\002\365.\032\017\252U\310\031\226Z\177\016,\301\374\350\337q\344G\363B\344GC\331m\376\313\252\007j\371\200sj\255IK\3046G\227\303\341px\361w\227\013u\263$Gq)\224\017\374\001.9\347U\324M\261\244\272a\344c\254\260D\245\265\264\262\203I\321\222\307I\261\264ae\306\347\252'*\275q\323\343e\247UWStL\242\343b\331E%[`\316+\035\337\203}\201\026\332y\305\343\264\244Pk5=\257p\334\266\333\006\3326a\217T\002\357-\221\242C\343\366\373\261\217XZn|\302\032t\250\364\246\207dw\210\375\213\242\245\024\2345^!\266\202\334\265\334G\tn\3456\272\330]\364\337o\340]?\201K\371\007\234\354&z\330=\364\257\033gR\0070\251\205Lj"
+	.ascii	";\324AK\r\264C\375\263\324>%u\217I\315cR\337D\352\035\033\265"
+	.ascii	"\315Fm\232\324\245HM.\365XR\213%\365RjJR\177\301\315\207\230"
+	.ascii	"\005`j\2751\254S\303\214eG\256\345'\373\303~+\277\330\377u\322"
+	.ascii	"\276\375,~\3207-.\306\250\2360a\361\313\310\034t\"\202\212_\345"
+	.ascii	"W>\346\233\230\0131\252\"\037L+0^{V\266\263\214\021\016fX.\f"
+	.ascii	"x$\255\326ff\304\234-+(\334\223\371\320V\231\032\361J3E\327."
+	.ascii	"\326Z\353\210t\242U\260/\373\370d\013L\017\310\321\3366\2674"
+	.ascii	"\350\313\321\340C{[\336\226\234^\035z\264;\2665\332\235=\233"
+	.ascii	"\336"
+	.string	"\022zw!\315\265\355{J\206\326\334/\331r\343\023>G\226{\264[\306\207E\264E[\356\203\037\225l\241\365\204Rt\270\373e\203\016\231h\"\352\347Hr\t\254\335\301\003\375i\243\336F\331\027\003\203\347\314\207\207\001\201D\356\203\255\261s\307\227\020\005\262N\333\274\237\211\200p\246\326\2524\342^\226>\036e\031-=;w\210;\356\315t.\272\b\376\226\013'h\220\037\305\375\211b\326\244k\267h\027\350\023\372f2\232L.\177\006\371q\367U=\276\006\226n\274&\022\3133\321\204\342i\324\271P\261\364b\324\351\234x\242\256\304\216\205\330t\026:\025\273\304[*!:\355v\314\204\364\364\244sj\261b\3074\"\306\216D\n\246%\025$\222X4-\255HbrzJB\312y\327B\347\224\304\333\355\234\222n\277\372\025\342\f?\302\324X)\007X5\f?B\013`\003\354{@\244V\310\302\3230"
+	.string	"\330\003\217@\315\f\235\256\032th\356\020\227kd\202\3354\224\301q\003\026\267\357\362\3622!\316\232\217\262\301q\233`\017vQ\250\205\026\264m@\354\225Sm"
+	.string	"\365Y\240\2653h\240?\203\326\210j\243\374\263@\273g\033\256\006\304\317B@\343\263/\270\314|\302\236E\203;\363S\215g{v\331\240\275hy\306\036\\c\224\334!\276\245\021\025\254\031\223-\357 I\264U\017^\fq\250a$\211 Rf\206hD\n\n\242\264\006p\002\031\302b\035\021\2201dF\232\0242\034\017\340\301p\371\2613P/1\207e\364\362A\024\245\021\350g\213\212'(I\310\360\240e\305\017\013Q\016\350F\211v\020\311\2371]\366\006\264%\334\310\231my`\366F\315\354%dpm@\333o\363\337\344^\\\031oXoS !]'(\332\216s=m\202\362\026T\236\240\216 \267\020\220\364\334\367;\264\305\212 \276\016\261\031\020\035\200s\357Y\fAak\242\271\021\373\030\266q\245\311,\344\351p5\327\306\016\301F-\223V\007\371\320\237\317bN\261\363\274O"
+	.ascii	"\226y\"\211\305\360\022\271\341Y\f\330j\244\2143(=\312\215\256"
+	.ascii	"\007\261\033\f\001\260]\301\242\034\256\032\305\004\204\212\177"
+	.ascii	"\314F\002\254\336\270P\027\230'\261\037KV\270A\217\223\265w\222"
+	.ascii	"\367\007"
+	.text
+	.section	.gnu.lto_blackboxCompressSync.10.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"E\013"
+	.string	"\306\325N@ Q\224\016\034\242\302@\204\270\213-L!n8\225H\026&\217\3309\031h\270\004e\3212\326\032\301\266\0225\017\231\264\035XbY"
+	.string	"\f\0044"
+	.string	"\257@\344\037\336\006c\301Y\253\004\221\275\245L)="
+	.string	"9"
+	.string	";"
+	.string	"\217\266\215 \001\310\333=\020 7\301 \245 \331\365,\375\360\355Ps\363'\035wXi\270\302J\251\003\216"
+	.string	"\235\b\026\2101B\272\310\363\243\033ev`v\327\351\321e\270\343\315\300\276\201Zr\374\351\207N\247\246_9 Ar\303\362b\027\344\313\261#\321\305\b\333\267\r\262)\2663\355\227x\b\350\247\317\005\354\226j\264\330\365,^P=\332;\001\352\261\372"
+	.string	"*\036Q\241r\266\307\375%\036\276\025\252&W\276{\250\253\006\305\214Q\226\330\326~\302\243\3007a\341B\265\273\027\361\350\177\250\307k\210\r68\204\234B\371\331\036\227j\262\017ww\035\0316\361u\321\264M\326\341`\327\003\f\230&\302\225\221\240\261&@\310p\254+\323\254\313\001c\235MfU\300\260\314\242x{\250Q/\362\0064d\250`\221\376F\245~\2501!\025A"
+	.string	"\t\325\306(\344\003\020"
+	.ascii	"/\344\203U\357\013\001a\030\224\305\225X\200pX\321P\355\342\226"
+	.ascii	"imc4\353sA\315\2452\323T{\030\n\353\007\007\007"
+	.text
+	.section	.gnu.lto_blackboxCompressFinish.11.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`9\001\365\f"
+	.string	"\306\327S@\020q\233\016\210a\344\020f\202\236"
+	.string	"-\017\371\301\270\215Q\207\334\205[\336\225\177'#\264B-b\243:\007&*\333\366G=4\272\252\352\351\274\007<,\321T\240\210\222\315\025\261Q#{K\231R>"
+	.string	"<"
+	.string	"C"
+	.string	"\267H\217\324\tH\217\336\354\223\177\036\366%'\"%5v\327\322\016\337\01657\177\342\250t\036w\250\341\032\300\353\300\002\273{\023O\f^H\346\304\261\273\316\316\033\271\343m3\260\275\300\376'\241\216r\366\307\245~\354\303\335]\253\307>\350\237b\032\302\264j:3\375\252Byq\031\355f\030\241l(\272"
+	.string	"Q\331~\332'\361\022\333A\037\037\260\353\221\321b\367;`\005\324\243\277*2\217P\241\250\333pU=\013\221\024?x\n\013i#w\227Sk\244+\206$F'o\330\3668\211\206\332\335\004\376\t\316\206\372\360\350\177H\217\327\030B4\002\004\222#S9\251-A\313wN\223\031\001\031\006\300\327E\3232\031g\203]\016*`\030\315\325\001\001cE\360\350\330XW\246Y\027\003\3068\231\314\232\200a\231U}{\270\352q\003Q\bDC\240~P\334\304\002\2432\222\"\202\206\200T\205\352T#\340p\341+(t\366\365\037"
+	.ascii	"/\344\203\245\336Lh\017c\354>\224\277\3558\031C\260\ff\246\001"
+	.ascii	"\221o\020\366wfCa\315\320A\300Q]y\tn\364R\"8\003\023%\030\200"
+	.ascii	"./\366\322\260u[\233U\n\340\272\330\325\254F\003w\t\030\260\250"
+	.ascii	"r\333U\364"
+	.text
+	.section	.gnu.lto_blackboxCompressSync.part.0.16.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\235\n"
+	.string	"\226\023G= \005)\035 \027K\036\f\221\307H\232\374\232\375A\026(\224U\266b\235Mm:\237\3247l\353-\3429\244\355\300\022\213"
+	.string	"\003P\366.\325\306\f!BT2\304\003\320\032\"\204\310\235R6"
+	.string	"3"
+	.string	"4"
+	.string	"\016\211X&_\252\274>\253\t\201\001\260[\202\3574\345\344ur\244?]\261\326\365\265/\260\364\240\344\310\304H>\r\316\t\214v\327\237\222\273\273m\b\333\021\366\025\002\366g\263\354\317:_\256NS%\224;\002\263N\373.\177a\235\246z\301\256L\307\266[:\274\363\303\347\235\313#x\357>?\360\336\331oqH\264\202\331\016v\306g\273\361\346\325\336\340\230w\371\265O\330\334\002\334@\2645uf\345\316\355\356Ze\266\247\347\313\377\036\003\017\201\311\356k\200\200=\351hVl\337~m\025\2438\340\020\224J\231F\324I\f):\304\222EH\272(\201\030\025\244\023\030\216)\020\324`\021e\032A\rQ\034\301\357\334\252L\002g'ff\376\2447UD=\362\320\017\253\352,\025"
+	.ascii	"/\344\203\245^\320\0305\033\230\022\361\315\b<\nCA2\233\355\356"
+	.ascii	"\\\002\274\007P\224\313 \022L\347\354C;\027\324DF\235\226$5p"
+	.ascii	"\315\373\257-c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"\r\b"
+	.string	"rL04Po\322\001D\266\3624]Z5\303\3574\2020\350\007\024*.7\322hzxc\177\230\231\275\211\231\261=\334Y\211I\344\203\236\031K\267F\310\336d\247\235diR\345\252_\266)t*q\360\001 \353\035\276\370\231E)\305\357OdO\314\304\207\337\257F\335\341\356\237\346\336\3014$?\260\200\214\334]~\207\212\006E\376\037\377\0203u\021\"i\016@\344g-\022\031\351o0C\244\333\335L\206\323\202r\254\240\233\004\325\300\b\231\021\202Z-\256\310\201V\r\033#\310\355\356\032\250\300\212\307h\246@a\313P\\\b\364y8L0\003J\275\215qC25\363\004\303iRQ\302:\352Zfz#\031"
+	.string	"\030\033\030\020H\205\363\0160rk\220\210\031\032+3\235fF+\\\031\361"
+	.string	"\346\n\\\246\001\235\235\0270\370\214N\002\200L\300\004\004\334"
+	.ascii	"A\367\024\374\301\211\001\236\341\351\206\266\246\023"
+	.text
+	.section	.gnu.lto_.refs.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1fde09ca08b08307,"e",@progbits
+	.string	"(\265/\375`2\021ER"
+	.ascii	"\312\210\274\035S0\222:J\007\302\251!J\207\006\315\376X\355\030"
+	.ascii	"14y]\002\301j`\022@\302\275\030\250\372\353\236\304\3608\341"
+	.ascii	"\237\255\375\304}\347 \243yN\327\241\034\356\207\213\271c*\210"
+	.ascii	"\210**\230\277\335=\353.\250\212\240\373\247\246\021\344P\nW"
+	.ascii	"2b\273I\231\002\206\001\305\001\314\001Kt\276\004\324\305\206"
+	.ascii	"\3717l\305\026\214\215\n\352\354\212\353\267\313\226-s\223@h"
+	.ascii	"\230\344\024\271.\021[\304~\r\255\227\257\021\373\345"
+	.string	"7a\332)/\241\363e\205k\320\2428\371\003\364;t\332\326\326v\350tQw\210\334\227\013\216\211)\353\r\327]\333\023'\004\271/\331\271\325e\252\t\256\237\201>\355\336\023g\320j\371\227\312VY\260\024\272\211\335\235\202\247\215q,\213\353v-\226\375j\261Y\016\201\004\267\005\253\264\262;\005\362\251\023D\2359\\\217\204\376\367\372\n\252\226\340<\350\327\266\305\271\313\334\367\312\211\323\210L\033h\261\fA\036\301\265\002Fk/\212\363\351\2368Qc\263)\304\277RVy\246\255\b$\331^\335\251P\325*#Nq}\272(NtO\234\350\317I\n\250=\350g\036\377>@\302P\003'X0\202\b<\001\374[\343\006\374\274#\001\334\317<\027!\2608\001?w\260\267\377`\376\345\177w\376\375\277<\013\302z\360\003~\326\340\337\025\033\354\256\006\027\372\231\306\277\350\234\177m\377\326\377`\377\353\320\371\367\\"
+	.string	"\316fp\025?O\360\357\005\377R\360o\321\277H\377\306\370\327\350_\005\376M\340\337\027\377\026\360o\317\177\265\177\003\370/\302\377/\377\263\374?\373?\364\337\204\377d\376\307\371W\350\337\240\177\201\376\375\371\327\347_\334\177\345\177\026\377\231\377\001X[[[\373m9~\236\341\307\035\005\315\3036\203VR\r\244G\367\212\246\356\340v\263\273\203\335\275c\224J\273\213\004\025\261\232\232\272\221*\232Z*H\326\243\233\275\322\214\035\213\313\252d\216\254k\211\325>\322\340b\365\031*#\272\fRi \335\275h(\326\021\00778h\251H\244z !\204y>\3310\007\354H\344\323\204\231\341\026\033\3510\324\224\250\"NC(\221\013\2302H\013\240\224H\223\02571\020\027\240\250`q\345\037*z\322\256%D\270\236\217\240\227"
+	.ascii	"\315\202m\023IA\2243g\\j\314\312\230Q\203\225Sb\333\374\004\205"
+	.ascii	"\272\255\300`qq\357\330\206\331\246\222\252T\342\214\353\337"
+	.ascii	"\224{\255\254\226m\"k\0246g\335=\205{\231X:,\206\305\r\324\226"
+	.ascii	"8k\256Q\376\271s\357\232E\342\207\247\233*\314\212Ib\231?\267"
+	.ascii	"\356d\032\254\237\211l\003\367\340!\0279\270k\314\264u\370\006"
+	.ascii	"\026\262\217\375\342^7_\264}s\025\351\367\013\367\236Y\3466\225"
+	.ascii	"X\240Ds\326\235>\202\177\267po\232\005c1\354>b$\005\0318b?\244"
+	.ascii	"u\247\f\250`\200\001\334\230\033%XV\320Q\353!\342\246\013\t\327"
+	.ascii	"\235\203\202V\232)d\350\277M\354\327\3129\033\\7\013\237!Df\026"
+	.ascii	"\256\013g\323|\326\344\254-\3236\216\215I\2107b\251\022\347\344"
+	.ascii	"\264$\311\365L\274\354?O\315\201LJ\230/\364]\351\231u\202.\233"
+	.ascii	"]b\277\316\334\263\003`\365\245\013\032\327\357\022\3645\354"
+	.ascii	"\231\3477\t\372\235B\277O\350\367\210~o@O\003\372\036\372\026"
+	.ascii	"P\030\213\342\334#v\314~\021-\231\257\331\2129\0171\355%\217"
+	.ascii	"\0314#^\\\257\204~\211N\240C(\273\004q\216\262\2236\351\n"
+	.string	"r\345-\206\332\341\"[#\207+C\251A\320\254,v\202\366\225\"=?\244\314\242\374pv\322\003\206&\213\022\256\254\305P>\3108^\226X:EH\240@i\"\t\373\220\204\233\234\335\233&\235\214J\224p\0234\330\035L\333i\221\030\361\244\225\326H$\021\256H\021\260$x87\341+V3\333b\202+_1/a&\347+\356\001G\344\253\332-\334}\361\263\373\342V\306Dh\345\254\267\241\241f\350mU\220 \341(4\250\207d\352`eUUq\0247\226*/\266#F\214\360\024c\355\200\r\231\234%\317Sn\332\240Aqe\035\030\352\024K\003%\213+\037a!6\247a\025\" \246.8C\256\267\tA\317C8\2073\221\023\341\250E\266\215\314\217'\255\255F\032\211~.r\216\372iu\245\345\203\241ncUB\224\201b\344\317\2344F\266\370\307\306\261\322\206\b\327/~Z7?:"
+	.string	"\t>\361\202\236\377\263\205\306\356\026rK\3338\304\235{\333%\372}\326\266\b\374\257m\273\003j\335W\3127\350\017b\302\250\273\350\255\356\240P\247m,.\251\202\305+c\216BiO\245\350\245U\027S\252cM6w\332\333D\252\343\013\3054i,\246\311`P\023\223\301\356\364\030T\364\022\006\267\270\244:\026\227\311\243P\023;\330K\341\024JL\036\213`\222\307\240\342Rx,\022\251\216BI\224K\212LR\306\204mV\221\330A\232\244\204\306\240f1M\366\231\356\365\352\321F\004\272\245\222\3063\302\247\035\0336\203\f\265\b\223\233v7\001M\303\252d\023\233E'\311n'\303\245n\212\021L\233\001\300\036\317\205\n\273\036\013<\035\275\035\270\237\322\222\256\356\200<f"
+	.string	"w\200"
+	.string	"\364\245\"\335Og\324\363\341\300\341\323\251"
+	.string	"\002y:]\322QN\367\323\365,\351\340\365x\031\f\020\004\344\3658\270\341\363\315H\272\301(\002\376\224r\024\351z<j\024\240B\017\203\031\300\237\022\260F"
+	.string	"@\336\214\236\353`\360y"
+	.string	"\\\201\267T#\350:\336o\327\333\261\200>\306\321\003G2b\330\271\f$\030H0\316\313@\312\345\220\216r\350\217r6\340\227\210\356\313\261\373\031\001}\276\237QO\t)z\031\354\200\274\037\f;:\222~>\032\002"
+	.string	"\223b\034\301\340\273a\333\261\320S\372\335xvK:%\335\r\030\303\016\330\363\351v\200\275\035>\032= \250\320\333\375\350~:\0330\t\202\bv2\360j\270\240\363\335\260\301\003L:\312\241<\200\274\033<\033J6|\277\034=\300$\031\300\036o\307\316s9\032.F\370@\003TW\244C\307\356\227\003\207O\227\024\203\317\206\013:\245\0336\214z<%\034F\272\237\016\243\242\241\337n\205\025v\3308\213h\002@\217!\222\213\b*\214\f\2061)[0'\323\0173'\346\202J\001\003\302\353l\210\251[\235.QM\270\236\311~\026\3431\336\202\013\013se\007\256D\213\342\274\231\345\316a\325\n\216\223\026W\006c-\347-\334\274%F\262[\310[\200\324\272\205@\273/v_\324(U>d9\353\253\232/\216\252\323\344\303\013\327t)"
+	.ascii	"\022J\020\256V\254p\027R\332\223V\332\225s\327\2116F\316\222"
+	.ascii	"+/9\214)\246\f\354V\005g\215\030\023\375\224Oa*[\245\235N,F3"
+	.ascii	"C\322\272\221D\270/Z\310xI\317T\226\271NLq\330pe\256e\376\030"
+	.ascii	"\311\342\202\246\205\2320$\304<Q*\313\260y\322\332ba\022e\\:"
+	.ascii	"<y\302Q\312\364\200\205\223\022\201e\250\241<f\0204\"2\"#\"I"
+	.ascii	"\222\244\003\021\005\204 f1\355\006\022`\3468P\"\207fD4\005\005"
+	.ascii	"I\255\215\003-B\224\213U\222\275\205\374\n\217\360\346\353\220"
+	.ascii	"\302N\375\220\230\310)\276\202j|U\365\365\237\233\235\277\346"
+	.ascii	"\247l\337\245\357\253\256\013"
+	.string	"\020\350\313|\324@Y\003\037\026"
+	.string	"\262\255\257!r\3024#\312q\220\232{\254%\310D`G\3104\350?vK\372%;\325t\001\337\315\350\274:\351\342j\224-TS\255x\360\252R\323r\224\325\231P\257S\224J\242E\277\276\210\340\371[L\027x8w\234\026X\251<\314,b\256@P6\263h\007j"
+	.string	"\026\261|\252\304\342\f]\"\274J\345\340g\344\257\330Q\331]\251`\200(S\225\025\033\3349\034.\025\212a\375\372\007\024R03m\244.4\314\032_hU\323\362M\byf\2674]([*P\207`\201\332\203h|\tf6\266V\033\220d#\206}\344@\034l Q\303r\202\253\265\310#\361\022B\212\017\325\337KU\254Uln\376\025\365\035~\366\347\213\266wI\376\t8\272k7\346\344\314o'\214\227\307d\\\312\007\275A\f\003\307\307\222\t\375\343\177\310yL\234'\177)\257\031\361(\201U\227\304\267\211~\256\357LK\276\177\277v?"
+	.string	"\334:P\334'\361Z%\230'\334\254\341\020=0a>q\210`\001wb\337\360;}\213\371!\311r\022\325\342\205\t\022c\304\266\234\275hu\2659#\013\340>y\007]6\227\357`\f\345\342\003\034i\177|\035\337\211\323}"
+	.string	"9\350>x\322\324\320\340\037\022\204\037\332^\220\016E\2312Z_\223\007s\250\302o9\024"
+	.string	",c\370\300\234\304PV\226\333\2200\262\357\254u\016$\3711\313\260\b\004)\366\327\025\374Dd?A\213\215\316t1\">b&\352\034\323\351\005\220\245\030F2\360e\325y|C\270\200"
+	.ascii	"8\334\277\312D\005\374\300^\377\026@y\312\233\202\252\307-='"
+	.ascii	"\355>\240\246\305{\223\276\247\274\231\364\034lo\213\317\364"
+	.ascii	"\330\227\240\327r\023\353{\227\377\245,\007\327ot\310\366\306"
+	.ascii	"\321L\277R\263[\324\222\370\346\230!\302z\313\033\235+\365\371"
+	.ascii	"\226\271'\037\f\346\rrd\371\202\334\201\213\303\273\233\037\351"
+	.ascii	"_\n\2726p\016\032\216\360\004 \035\t\247\325^\3176\301\247\253"
+	.ascii	"\361\027\320\355\351^\321?\310\341\253=z-\\\373\031\266\035\303"
+	.ascii	"s\375\351v\376\343\b\374\201s\275\362\325\035\267\003\276\330"
+	.ascii	"W\315\271z\336n\316\311f<\376Wp>\3641N\021W\370^\302s\006\375"
+	.ascii	"\240=(Nw\375\034\375go\363\342j\366z\357jA2\013s\025"
+	.text
+	.section	.gnu.lto_.symtab.1fde09ca08b08307,"e",@progbits
+	.string	"blackboxCompressInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"blackboxCompress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"blackboxCompressSync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"blackboxCompressFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"crc16_ccitt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1fde09ca08b08307,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1428 @@
+	.file	"blackbox_encoding.c"
+	.section	.gnu.lto_.profile.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`U\001\255\b"
+	.string	"T\016I\002"
+	.string	"\032"
+	.string	"\342\203\351\365\f"
+	.string	"\001\357\350\332\204\n\002\002"
+	.string	"\002"
+	.string	"\002\346\371\265\305\006\006\002\001"
+	.string	"\002"
+	.string	"\004\330\215\223\342\013"
+	.string	"\005\354\250\314\310\005\002\006\303\342\213\204\003"
+	.string	"\007\331\271\265\237\001\002\b\363\300\323V\002\002\003\002\003\t\374\306\367\250\013"
+	.string	"\n\233\225\332\360\005*\002\013\315\310\247\206\002.\002\f\301\272\250\264\r\026\002\r\215\321\330\276\r\004\002\016\244\216\224\271\001"
+	.string	"\017\320\305\233\354\005"
+	.string	"\020\225\374\365z\n\002\004\002\005\006\002\006\002\005\002\005\021\252\212\212\215\003"
+	.string	"\022\242\247\237\212\013\002\002\007\002\007\023\213\215\316\230\r\002\002\b\002\b\024\376\313\344\327\t\t\002\t\025\274\344\2654\n\002\n\026\307\252\365\247\007\027\222\344\204\211\017\013\002\013\030\306\332\312\260\004\f\002\f\031\317\336\254\344\007\r\002\r\032\274\320\320\213\f"
+	.string	""
+	.string	"\024"
+	.ascii	" \030@\n`\007\220\002\330\001\344\342\363\013\260FO\321\200\035"
+	.ascii	"\332J\026v\032\203,\002\314\210`\212\001\030\034\230\212\263"
+	.ascii	"\213\\v\005\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`b\003]\007"
+	.string	"\302\206\023\030\220+\215\001\377\377\250\377\377\017\r,\332\266\356\222\262!\271\375\211\3342\245\336`\230Z~QF\261'F\0344h\301\375\204&(w\016\356\304\b\356\316\300i\362\270\352\220\346\f\030\351\261\264Y\245\324\210=\256\217\311\262u\025Q\313Es\004L\250\340\322&\323\030\300\002\021\243\3326\022"
+	.string	"\265$\006\204\0221c\002\032\n(n2\263\260\274\215\001MQ\271\030k\016\3240\030\204\002\"\nz!\333'\315\027\036\250\321\202`\263\n\177i\357=Y\003\325o\2706,\270*X\301\034\366\321!\363U5\333\324\355"
+	.ascii	"KP[+)o\036\177\257\250|\352\305\314\017k\005\240\025\211\252"
+	.ascii	"Ioc\263\355iE\374\004\275\346\3113i\304\b\006s\214\234\305\301"
+	.ascii	"\372\204\372\252U\314\334y\304\322\254\221\264\356\2120\265\031"
+	.ascii	"\345\273G\345\237\226\331\002"
+	.text
+	.section	.gnu.lto_.inline.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`{\t\335\031"
+	.string	"\326auF\300\324M:9\272Q\313>\253p&SGM\371o\250\264\224\326\235\032Y\"\265\367\346W\r\251=l~\033n\233\355\362\323;\032\3577\350\323\240\354\256\233\020"
+	.string	""
+	.string	"\305\363_x\270\364\025\373d\315\034\331'h\313$SX"
+	.string	"g"
+	.string	"f"
+	.string	"&ys\342\r\032\372\rR\275\272\321\240\335Eq\311I\016N]\037\316yj\263\243\230\363\237\332\354He\023eW\332]\030\227\247\223\323\264]\237\235\206[:o\024\307\356r.i\327\227\266Sn?\366\335\335\315\236\260\273;\366m\263\236\231N\007\032bwKl\030\243@\b\372bwM\374/\355\333\315\n*#\027\327\242\026]\2766\231d\221I\224\335\037\3447_\233[G\320:\205[u*_[w\2354\341\341"
+	.string	"\203)\215\234\342\204\351\356n`\325\\\310\007\211\210\"1\t\001qGv\206`\310$\231\372\210(\301\224&\214\002\273\255r\022a\206\251\035f3h\\\367\314Q'\"\017@,\007\3279t\312\264\310F\024\222\001VYk\214\210Z\312\017:V\354\320p\2239/:\355G\357\245$\202fO\352?\301\277\n\276#iJ\n\346.x\017\013?4\bp\364<\006zBH\310\020\347\3509z4G\001u\303I\306\361\353Hs 5\031E8G\307\330\207\236\232\214\314\370\321\2175\207J\322#\265\371\353XV\030\226\027\273>e\031py\t\240\202\264\335]\305"
+	.string	"\210i\361y\354\256J\213e%S\236>~j*Vn}V\261\353S\265t\312\262Qn\005\247\305\253h\303\356@\317\r;\303Nv\236\0131\202\314\030v\236aW\243K\264\024E7\364\fa\237e"
+	.string	"\241\004\3559\0067\t\267\013d\367\b\267\td\027\200\234\250aEc\"R\222\202\224QIc`\002\031\"*\333\001\022\240C-E\362\024rF\t&\220\231@D\002\221@$#\223\244\205mA\375\244\023\322\005\005\211X\232\254\"\323\007p\257\217\227\275\3431\025p\343-9\203\f\372\350\224\\\222\324:@\3022\201Hk.d3|\003\021\232\361\226\027\340\274z\343\f@t,\322\0313\262\242{\207m\321\tPu\244\331\031L\020\013p\r\327\2351\025\357\256\231\206M!d\002\326S`K\204\263a\306\210\263\377\017\243\373\344\273\341\202\322X^\032\2710\356\313v\301\311"
+	.string	"\026\364\313\035\016\021\265\375\004\237\341\344%Qx\357\206\177\026\201\007\005x\376\227"
+	.ascii	"\027O\267\n\233\231\007\321 \300\036\244\340<\032\211\2407%\216"
+	.ascii	"\234@\263\214Z\372\333w\022\020\376\033\003\251\272^k\026\232"
+	.ascii	"\303#\367 \325\037\177@w\332\365\264\t*\201\345^\274\205\306"
+	.ascii	"\304=n\215\364\022\356\005\213\324.\212\034\225d6\002#Z\022 "
+	.ascii	"\316\027 e$\360\246\0208VrM'\223\002!\222&\365I\002\256o\203"
+	.ascii	"\t\351At\201~\236\373ZIR\234\354Mxn\202\353\207aDZ\005?\225L"
+	.ascii	",\003Q\013\025\220\rL\207\347\352C\300\251\326ga\204\314\351"
+	.ascii	"\022S%\020\303\"\300\235\332\340\307:2"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`\332\013\255\021"
+	.string	"\346\024>5`I\223t0(\b\006\201\242z\324\266\210Q#\032\003"
+	.string	""
+	.string	""
+	.string	"\270k\365\f\222d\300\316.\301M&\030B\336\002\264\246\277\277\265i\326\327?\315\332'\2104\231d,"
+	.string	"-"
+	.string	"4"
+	.string	"\344\004\356\232\301/\230\274uC\260\207\220\220\224!\025\024\270\315\035\301>\202uZ\032\351\375y{U|U\223}z\220\262\361\345\304\006E3\013\336\215\272\304\370\264\326\356\226Roxj\266)\214S\332k\322\223Z\307w\221\227K\245\342\340\360\255\035|\203\035gb`\215t\347\333O\373"
+	.string	"K\260n\321r|\253L\20030\032_x\bo\341\n_\006\360\360\340\376pEU\361D\204\211\227\360\325,\344\360\207\030\267&AQ3\315\243\327\r|$Iv\232x3\232L\261\205\242\032\004\213\255\007H\244\327\"\302\233\005\3521\017\231\302O\2707\021\357\321[\364\236\257"
+	.string	"^\033A7\351\203\274)\200\213\250\021a\206HH\222\024$\355\006\240\"\031\252\252m\022@\343 \004\001%\244\214\320\020B\210"
+	.string	"\031b\004\006\221@hfb\2108\305\006"
+	.string	"1\020\374\034"
+	.string	"5\2648|709\201\330GK\330\201p'd\257\257\341Jg\035\022:\356\244\356\214\001\304.h\370l\254\030\266N/\260\0200\352w^fR\222+\027bo\207\326\013b:\375\377R\222\371\356.\311\300"
+	.ascii	"\1771\027\335\266\255\222\264;2\261\367\227q\177\317\223\206"
+	.ascii	"hX\276\273{\r\202y\361\030j!\310#\344,\345\305\001\350\217\315"
+	.ascii	"jM\374N4\\P\020\205&\211g\321o|\027D\033)\030\314\201\357\024"
+	.ascii	"xy\033\343%\006A\346\201\204tg4h;\312\347\212\212Y\350V\303\264"
+	.ascii	"\026\312\026\334\340S\034\370I\030\344\\W*z\3760\377\362\004"
+	.ascii	"\260\354T\301!\337\253\032\253\276\233O\004\200(1\001\031\330"
+	.ascii	"&\276\274\314\306m[\272\311P\263(`\005\220\347\312\240\f\246"
+	.ascii	"\021o\352Z\306\217)U/KE4\004\200\177\220\266p\030\241\025\254"
+	.ascii	"\210\302\271O\203\321<\224e\004!\211\373\005Z\327\202\305\302"
+	.ascii	"gC5\350\352\005\364"
+	.text
+	.section	.gnu.lto_.pureconst.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375 S=\002"
+	.string	"2\305\020\034\2207\351\377\307(\271\273\273\343\273\273\027\242\307\307\307\307\307GkkkkrZ\333\001\236|\341\nO8\302\017np\005G\360\201\013<\340"
+	.string	"\0279\310=\316\361\3061nq\305%6t\304\017\257TU\214"
+	.text
+	.section	.gnu.lto_.ipa_modref.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\275\005"
+	.string	"\002\306\026\"\220+\303\001\377s\237\373So\361~\021\377\244\231"
+	.string	"GE\317\262hk#\347\007)\213\266\2667\331R\246?\t\345\301\226nTS\031\213\n\025\221\314\305BML\354\240\250\210\241\017\033~~\025\234'\2270X\340\b\264\312\275"
+	.string	"\377\336\223\217\273\254\215C1*!\363v\351\366\304\004( p\2022\226\334(\230\b\345\334@\023A\001\362\025\341\334f\322\223\333\210?N\2450I\2225\344\r(\310\030\301@0M\0205\202\005\246s\324\017K\365\264\032@(B^\302\030v\203-W\374\026$\034\016\247"
+	.ascii	"\034j\346*\257FJL\313w\330\034\332\305a\237\306x\021"
+	.text
+	.section	.gnu.lto_.lto.b45ed8f7145867f0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto__putc.16.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\275\b"
+	.string	"v\021>8@\305(\035\365\245{\326\017R,\342\001\013L\213O|\374N\031\3166\345\035\007\373\227\233\344\247\345\302#?\330t1E'\372\201p\b\342\321:}\301\207\376'M\312\224\002,"
+	.string	","
+	.string	","
+	.string	"\3164&\3008k\327\002\360\373\370GEU\022\340\277\226\036\356\214]m\022\013\254X(c\206\341\177q\305\332p\323m\r\332~\332\262\004\207e) m\275i\233\330\"$t~\027\315\237\343\344\365\277\323\005c\353\020\213t\036i\213\007\376\226\353\365\277N\0254\316\372\314\301\004\247\n\364\252\005\031\211\252\023\323\231\316\206\025\325\200\024\306\332\207\302\354h}\371\377f\253\365\2633\261x\301\032\2631\341\240\374\0321\001\001\233K\356\346\201 \215\036\270\215$r\260\340B\021\033H\"\244\221F\240\tm3\2354\317A\271\222\310\244Qp\234I\333\274\373\362l5s\301R\211\321\fb\266\001\n"
+	.ascii	"`\251'\023\372\374\002\213\013\316\313\250\340\032\373*\fVP\241"
+	.ascii	"\307\035^\264\223\f"
+	.text
+	.section	.gnu.lto_blackboxPrintf.18.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\255\f"
+	.string	"\226XXB q\232\016dG\270\\\247\024\202l\022FnD\020J\246I8\246!:Jb#\024\262\320h\2144r\024\025\177\f\3374\277\361\376\321\250"
+	.string	"\300\215\214\316\301\036\203\365\213\207\316lc\330@\2266\221;\245C"
+	.string	"C"
+	.string	"E"
+	.ascii	"\273*!\214\335o\201\031P\237\376(\333\276\212\2134[F\004\023"
+	.ascii	"\351\304\215\023"
+	.string	"\220\307\356Z\007N`\372\224>`\372T\023\327.5\377\340\021\270\214:\224\355\022\263\331]\313\016E\304\255\267\235\300\266\003\373\035\002j\343[o\324\203\2431c\2408\313o\337wyhW&y\213\365\305K\212hw+\022\273\372\274\255\371\240+{\345-\264\263\224lB\036\244\0249\304\335\020\231O7\240>_\340\322\376\212\263\320\376m\270\200;^RD\252w\001\322\241v\271w\326\3750\304#\337M\372\360\020@\354(\236\350fJf\376\226\203\027\f|\350l\021\f\362\235\357\215\030E\023\335\354/$\265\204}iU\305\226\244\247\177\277R\234MG\r\034\001W\0069\342\241\240\3064 \237\316\204\f\373|H\320\220qB\260\253\002\307\372t.\217\205\201D,\215\002g\026>@\326H\226\201\254\352\343nO\212\361\304Q\3444\344\022i\227\304\003qE\216\034@^\030\370\351\315\030E\016\272\031\200\234\001\023"
+	.ascii	"`\251'3 \f\013\263\2608\023l\220\030\027\344ku\372W\273$X\353"
+	.ascii	"\2720r\333lg\203\001\233\262\030\f\341S\344\340n\217j\245#L2"
+	.text
+	.section	.gnu.lto_blackboxPrintfHeaderLine.19.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`\340\001\355\020"
+	.string	"\246\237oF\360\322f8`\3129'\235\311\263l\335\367\2533\307\307\313\203\035J\025R\023O\016\205Z\272\371E\233i!\bY)\272\332\302\341\353\020Z;F\326\256\367\360wp\200\217\345\250\\\346V\263 v\344\336do)S\nX"
+	.string	"T"
+	.string	"b"
+	.ascii	"[\223\223\322\2633\356\346\224\2343\212\351\334\017\210C\036"
+	.ascii	"<\355\007\275\206\353B#>`\027\226"
+	.string	"t\264+\232\230\201\351\234\305\027(\2353}\244t\316.\333\307\305\027{\242\0236\261 \273\373\251\213\273\236.\377\261\003\buf\236\035\312\356:C\035\024\267\336\266\002\333\021\354\004\003\371\320$>*h#\t\235\261E\232\324\026\366\267\335]+\314\336\322\247\213\277w\241\277\333\322\272\245sK\237@\200\031O\212\036\034\345!.NM\310k\306\341\210\361\242\337\276o\3432\333s\314\215\334\340\006\306\023\264\273^\214\355\235\373c\366\374\241\023\271^$\363\246\240\222\017UJ\347\256\335\212\034\264\235W\326\334\245\b\311\317\221\201\264p\341\261W\370\001\242\215#\251\301\323\337\300\220\301\264\373z\370\335\227\255\240\362\341I/{\312\315\322F\033\235\261\200,\371\215\036S!0\021\332-\253\223O\020\332X\302\001\r\221\354\324f\201@\tJ3f]Zv#\225\354\027\020\001\250\020\t\303\342\240*\026\252\2659u\322\322Zm"
+	.ascii	"S-\325\212\b\220\245C\n\345\201\345k\255P\254/\345\362\362\235"
+	.ascii	",0\370A\345\362\301\200\240\313\347\211\257o\2530K\3701{)\215"
+	.ascii	"e\266]\026\020^\364\217CY\263\352\216\207@R\257\252\212T#\303"
+	.ascii	"\344'M\335z\324\360\320d\315\276\216'M\360a\004' p\202\021d\306"
+	.ascii	"\003 \352\215B\333\033\203\351\305(\020\327<\202\f\025i\216o"
+	.ascii	"\25401w\205\241Q\032\027\216/V\323\027!P\200_^\001\234\275\325"
+	.ascii	" k\223\201\007\313\265\036\327X\356\n\235\007L\255k\306\230 "
+	.ascii	"b\027(H\024\334\343\230sh\216\2035\"\300\243\200\227\027\355"
+	.ascii	"#\003"
+	.text
+	.section	.gnu.lto_blackboxEncodeUnsignedVB.20.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`j\001\265\016"
+	.string	"v\334cD\020\217(\035(\2204\323\007\022\243\020\204P\006A\005\026\037\307'\020)\377\321\023v`\225\365\231\355\017m\257\336\034\341\313\275\332\307\320Z_\004"
+	.string	"\200 T\242\006\204^\212h+\3016|\353j\204\220\275\245L)M"
+	.string	"M"
+	.string	"P"
+	.ascii	"\331\343v\001\331\243O\266\213{(\373O\205eB\306\356r\352\301"
+	.ascii	"0O\217P\363\344\347\353E\253C="
+	.string	"BmU\222\322\351V\320C&\306\345\337\223\244S%\004\341\272\376;\f\361biu\256\247\366\261\273\316V\227\341\316n\033d\373\303\376\210\356\3044g\363\225_s\330\257\035vG\230\2060\255\232NM\037\200\246a\005\201\030\273%\261\031\013\023]>\330\276\206\355\364^\342t\330\2105\273\034Z$\330\0367\340\323>\211\253\234\276R\341\001vMZP\354z\007\214`{\264\367\001\001\032\225\304\261\217dQ90t\370TXH\031\270\273\013\255\335)\262\250\033U\360z\2710\263\245\252F\355\b\245|\313\033+E9U\365'\276/\220]S\317r\2512\346\250W\323\253\2055\223\312\230\262\274\254:\325\023\333C\245\007\212L\214\325\304\001!\t\"\236\t\321T\002\251?\035\rD!\240\321G\024b@a\004\342\340\343\021\001\341D!\236\007\334\207T\342:\fx\004!D\342L\243\021\211\323\360\366\020F\355,\330"
+	.string	"\223R\225\267\204\034\205\372\357\034/\026\254\231\216r\324\331\202\221\312X\324\023\377\3736CD\212n\3240\265\034"
+	.ascii	"`\251\2473\020\216\335\315\276-\206^0\230^\301\373\230jpQ\341"
+	.ascii	"`0XM*\213\001j2\314\243\240\211\0269,\241I&@\021\217\006\302"
+	.ascii	"gj\024\\\226\246F\007\367\342\226*U\313@\275l\022\346\023"
+	.text
+	.section	.gnu.lto_blackboxEncodeSignedVB.21.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"U\t"
+	.string	"\206RB:0\305*\035\200CF\245\006\211\023\032w\211\334\320@\245&R\203\341"
+	.string	"F\226\200\031\214\240F\035\321v\fh\230ig<3\202\t\"\323\005\204\342\210 \303b\303\260m\023)S\n."
+	.string	"2"
+	.string	"-"
+	.string	"\037\270<f.py\264g\257<\374\330\307N2FZvwS\217{O\317\177\354\032p\365=1\237\335u\202\253\215[o\273\300\366\3076K\273\032\001"
+	.string	"\354,\232\200\330\376\306v\206\027\361\016\233\260f\227CE\266\273\035#d\0369\332\323~\353.\357/\212\007\354\262Jd\273a\307\007\231G\207\001jw\017y\320\034\f\375|IU[\025\221\007\257I\0222\273\320\317\016\277\324\016\373\332\356\256\225e\377\365\307\303~\325\3641\230V\n\001J#U\t\004\021S(\221\232\363,\230H\242\2163\215\024$\272\020\003\007*\2056\023\t\324\260q'\324\3461p\3470:m\251\256;m\233p\257\255\262\234\340\232U\250\2055y\215\001\013"
+	.ascii	"`\251'\023\372\376\002\017.@q\r(\206\3210\025\003\\\221\246\246"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxEncodeSignedVBArray.22.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`\357\001\305\021"
+	.string	"\226\"wG\360\320&\035\372\331\274\277\313#\312v\2202\310a\313\301\346\340\3527{\0264\031\265-\030e\2767S\330X\263\345)w>\263\343\225\275tSn\"\233\204n\203r\0078\377\\\344\017\036(/\317\320\236l\333[\312\224\002b"
+	.string	"b"
+	.string	"^"
+	.ascii	">s\202 n\260]\032\274\001\322\345\366\002\244K\263l\031\007o"
+	.ascii	"\346g1^vj\3149\273\375\340R\030\206\341#xGe]\306U\226\277s\004"
+	.ascii	"\262\031\261\257u\031K\260\230\020\001>X\02492\372y\355\n\363"
+	.ascii	"\2754\216\230\371\276\366\005\262\240\3307s-=\230sZc\237\314"
+	.ascii	"M\272\355\f\266%\330\232 \352\250\352\225j\225\352\013(\t\301"
+	.ascii	"8\320b\316\230\320\306$\222?\"\316\363\333\367i\357Q\271\n\357"
+	.ascii	"G\343)\374\2329\363\030hkq\330h\263\"\2439\347\307\245#X\305"
+	.ascii	"\346.\317\331^\024\237\261\256c\2408`\266x\350\3403\347\0041"
+	.ascii	"\204\355\322#*\310r\303\301\325\276\211\237`=g\303\t\314Y#\024"
+	.ascii	"\260m\331\244q\375\236\023O\037\353\330\367\334D+A\324\262-\373"
+	.ascii	",V.l |\226\375\n\030\032\227\206\326\345\330\335\273\340\304"
+	.ascii	"{\210\364\325\275\013\211\227\206\226\373}\355\022G\366\342\345"
+	.ascii	"\206K\303]Z\020\354\333\265\261\301\227^\344\346\310\310[c\223"
+	.ascii	"\324\035\334s~\323\301\237\343:\377v\236[n\251\247\2500x(\251"
+	.ascii	"\341\264Z\235d\n\n\311\032\025b\242J\221x(U\311\204\025o\204"
+	.ascii	"\002\352Ta\244S\245N'\035j\205\322\205(\260g\241d\325\245x\336"
+	.ascii	"\252\343@\327\267\306\337\371F\033\"r\355K\256\2159h\226\333"
+	.ascii	"-\322\217\313\205\331V\356sf.Z\364\350q\3169\243\031\\.'#\013"
+	.ascii	"r\221\001\320\2165\231\244\3641{\004& \200\002!\254\342\001\240"
+	.ascii	"\365\344\300\216#\253,\032e\255\032#]\224\r\243\3448\215eZ\225"
+	.ascii	"Vjc\331\306,d4\002\033U\013\305jpZ\323`wi+\330bd\341\256\243"
+	.ascii	"\260!\"\300{\3210\232(\340k\341\227}D@Q\362{I\026\371\302P\031"
+	.ascii	"\357!\322\271\372\023"
+	.text
+	.section	.gnu.lto_blackboxEncodeSigned16VBArray.23.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`\376\001%\022"
+	.string	"\206#zG\360\356&\035\202w$Ju,\277\273\242\311\242A\037~0\n\320\f\023(\213\237[\245\003,\337\337=\330\335\255\205Q\202a\271\347\203\262\336\030xX\234\254\327ji\232j\216\007\205\343y\337\"H\240 \226l\"eJ\001e"
+	.string	"c"
+	.string	"`"
+	.ascii	"\213c$\264\033\212X\301\367\350\360\002\274\307\357\001\274G"
+	.ascii	"\267\354\027\017u\3666\0302>I\273{R\0166\345r\271\334\273\360"
+	.ascii	"\356\262\365\330i\266|\237\027\250\265\230\321\\\217\235IF\343"
+	.ascii	"\301\203&\353H\226\220\206\216{\316\320`\331\201\260\271\036"
+	.ascii	"\367\003\265\240\031\315\346ib\260\273\316\031\255\346\366n\233"
+	.ascii	"\202\355\007v&\b\231\326\230\316\230\376\207)\211\005\201\333"
+	.ascii	".M.\306\036\305\241\017\377\371\355\373\267\003\271\034\205\225"
+	.ascii	"&C\304\356\376\204\2173\350\037\023}.\f\337\315\246\204\264\273"
+	.ascii	"!\217v`\027\033|<h[M\334\326z\217\211\272\217\215m\310 \264\273"
+	.ascii	"\"n\360=\202t\031\302\f\370\330\230\355\302\202\247}\022/\321"
+	.ascii	":\217\205\003\330Q} \225\225\374\254C\017\364\215\333\210\243"
+	.ascii	"\230\272\334i\324\247\260\257\342e\365u\360a\274\317\334\274"
+	.ascii	"tCU\037\263\223\367\n\357\232\372\230\020\260\314\331\323\353"
+	.ascii	"q\217;\265\"\231\031\257\314\251\336\212d4\325\034;\204\345I"
+	.ascii	"t\226\220\2548\266)\335\301q\236\037|\370o\274\347\327\370\317"
+	.ascii	"\355i:z\351.)oQMX\245b\005\024\213\205\212-,&\352\324\b\212*"
+	.ascii	"\305d\225R\235@xY\225\250\244P\021JN\252\024\324\312)\305b9\215"
+	.ascii	"\030\360J\302\t\353\324\262Z\261N`\370\272\342\370>\377nJG/\205"
+	.ascii	"E\315\261\306\215r\250\272\310\220{:\243\241\236\236\307f\024"
+	.ascii	"\313\245w\273\273\235\021\334S\216\232ZP\214\006\217\354P\360"
+	.ascii	"\004%?3\210L]\0063& p\002\241T\305\003`\365\304\300\256#k\026"
+	.ascii	"\345\266\026\321\"5\212\251Q\b>=jZ\025+\313\367\306\315\352\322"
+	.ascii	"\227@\3133\355\203\254\254\\=\264\270\205i\"\246sKf\331:\262"
+	.ascii	"\033\"\002|/\f\273\211\022|)\354a\001\204\316\357EY$\nCu\274"
+	.ascii	"\217H\347\352O"
+	.text
+	.section	.gnu.lto_blackboxEncodeS16.24.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"\215\n"
+	.string	"\366\224I>0\211*\035\340`"
+	.string	"\203\312\201,j(^\370\"<\340Y\031Q\202\246\001i\355w\241\364\366q\304\240\r\250\026\037\027\365\017\006WP\305Pu\206+\241\272O\343\302:-\220\356A6\2212\2455"
+	.string	"8"
+	.string	"4"
+	.string	"\353UL\021\017\355\035\";\214\177\310\016\335\331\023\356\245\366\254Wi\001\205\335\325\324\300\273g\347\237u\006\323I\364\\\270\354\256\323t\np\353mO\330\276\330\277\004\306`Z5\235X\372\023\211"
+	.string	"\t\021\337.\200\257\302\272\340\203\003\266?\261\255\336\025t_\201\030\356\022\210\320\332\335\212+\342aC>\355#x\202\356\252\220;\354\242\032\2646\231\252R\034\214\274H\3719fjT\233\003\2247YBDE\276\246>\323\253$\305\240\364\032\345g{\242\324\002\366\261\335]+\312\276\352\217_\375\231\246!\226\001\233\216\016\306\003\206@\032\365f\301\360p4\334\346\331\\|p\231\214\r\323\311h\036\016FC\333> \315B1\267\261\371h!\216\373h\023o\217\255\242l1\3005R\222cBL\241*\026o\bY\017"
+	.ascii	"`\251'\023\232\210\006\306\005\276+4\\\310\210T\244\2009\200"
+	.ascii	"\340\032Q\f\243a*\006\270\"MM\001wy\321N2"
+	.text
+	.section	.gnu.lto_blackboxEncodeTag2_3S32.25.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`\304\022\235R"
+	.ascii	"\272\215l\036M \222\312I\007}\026\207\337\374l^\361i\232\327"
+	.ascii	"\246\340[\244\026Eo\356*R\335b:\260:\272\002\260&\345\265\036"
+	.ascii	"\3049W(f\372I\231\252\327xu{\265\004\314\273\263\256e\255\374"
+	.ascii	"O#~f\267\373\377o\373\232"
+	.string	"\233\265\233\354$\245\f\326\001\242\001\327\001[D{\211h\357\320\354\025\242\275A\264\027\210\366\376\314\336\341\354\365\241\275B\332\333C{yfop\366\356\224\275\300\262\367\307A\360\372\312^Z\366\226\263wv\357\337\333\357e\246\3224\007\315\n\262\312\361\340*\225\275:\265MiD\026\026\303\034\206y\b\346 \230\347\352\206\325\311\225:6\"|pi\263,\3042\230!\226\f\321\t\\%\263\2416\307m\316\217\037\227g9\246\333\340\334\222!\002kMs\241\210\035?\006\202\343\2748\210%\363\373\032\373\331=\341\002\247\326\372\304\345:\360\343\2228\033\016\005:5\270w\331\215\275x\361[\023\376\251\225\206\272\"j\205\213\332\031?.\027\216\207(\227?\016\242\\\356z\355\276a8,\225\345\250\030\345\346\324Z\247~eih\317\023\216\0278\275\230iI)\t\351\310\250\210hH(\b\350g\350#\354\341\t6\355"
+	.ascii	"\177>Z\316\267\327r\213/r\304\310\276\230\351\255.K/ya%,\222"
+	.ascii	"\242@Z\243\303\221\216+i\250H+sc#.?\320\341X\033\035\326Z\273"
+	.ascii	"\314\242:n78n?\244\225ya\2429\\\233Th=\344\253\252\241,\007\026"
+	.ascii	"\n\002\302\341\206\376\361U\245\225\251\361\320\006-cX\332'\206"
+	.ascii	"I$\202\235\264\214\251\265pJ\217\017\212\016<\276*:\306\201\324"
+	.ascii	"\243\"\255\354\215\2039p\323\027\030\254p\332\330\013\224\307"
+	.ascii	"\211\035\316\326)m\354\255\334\231\303\263I\325G\262\260\006"
+	.ascii	":\325P\346\002\377|\223\270\304X\025c\323\256\302\245\220\254"
+	.ascii	"8\211\265\326 \331\223\236\323\206\2276\033\204dN\346\201\240"
+	.ascii	"3\303Z\306\316\372\f\206c\250\315q\303\"\255\314\005n_U\255u"
+	.ascii	"[\214\254\214\227\310\273]w\027\310\356p\211\324\352\354\346"
+	.ascii	"\016\255\254\340\034\3748\344G\316V\324\372\007\305V\327\361"
+	.ascii	"\036kx\305+6M\022f^|G\356\231\213\002\317k\r<\263\260\306\246"
+	.ascii	"\210F\217\344%C\255^\3011X\243+^\301<\264a\311\242\364a.\372"
+	.ascii	"\373\375\316$\207\275\"ZX\347\301\031s\305<\362\006sQ\372%qk"
+	.ascii	"\2344\235%2\027-O\317E\264\227\277\024\306\344\362\030&Z?\265"
+	.ascii	"e\024\316\307\263~\326\177.n\231\274"
+	.string	"j(\277\317E-a\275\267C\316g0\354B\213\2338<\272$X\357\275\326\372\365#w\341\276\232y\005*k*\354i\330\235\"%\312Ql\3662\024\006\373\342\352\325\325$\205\331K\002\2771k\315^%\2637I\331\213\344H\331+\302\3545\302p\314Y\2637\204\331\213\305bx\2578\f/\021\036\202w\210\220 \036t\300s\274V<\307\313\301\354\335`\366j0{\201\314\336\037\263\327\307\354\315\240{1x\357\005\357\3551{y\314^\013fo\005\263w\307\354\245`\366\352\230\275\023t\257\004\357\315\361^\034\2637\202\331\013\301\354}\240{\035xo\003\357\255\232\2757\272\227\201\367.\360^\033\263\267\306\354\245\341\353U\200\366&@{g\224\275\b\224\275\007\224\275\006\224\275\005\314^\031\335K\300{\251\336;5{\245fo\324\354\205\362\365>\321\336\030\264\027\006\355}1{\007\230\275\002\370z]\320\336"
+	.string	"h/"
+	.string	"\264\267\305\354u\242\275\304\331\3334{\231f\357\022\355U\242\275I\264\027i\366\036\315^#\332\001oqw\365\200\363\226.vE4\2505gc|\216\344\242\006\234\323\342\356\2344\035.Z\300\r\220\361\002>\305\214\361\262\"\203\352Y'\200\355x\352TD>u\032Y\004y\327\231\bvaE\2318\274\271:h\334x\230A8\005\013\226:O\311\223\232\202\2450\035\317\035d\340\275\250\263\224o\033\253D\235\265\264\341A=\035*\306\237\316^\225\267(\214\307\270\301[\364\305a\f\360\027\003\234\313\264\261a\303]\267B\217"
+	.string	"..@"
+	.string	"w\001\300\211\017\300,\354\r\2678"
+	.ascii	"Noq\237\2341\t\226\347t\332\304\361\254\351\304\227w\306$\023"
+	.ascii	"\314\364\246s\261N\030\036\323\371\254\215\356x\006\326KJ_\342"
+	.ascii	"-\232t\245\227>\274E\221\236tt\244\323\243s\231,{\307\263;\356"
+	.ascii	"0z<\3016\272\326w\217$i\026[\342\223\177m\321\215\316b\214I\242"
+	.ascii	"\007\275\350Jd\214f\347-:t\"\241\017}I\317\230\004\313\373\t"
+	.ascii	"}\351\016\350\302\007\335(\216\321\214\207\267\350\317\201\206"
+	.ascii	"\377\3412\354\363\341\223\232\300\353b\233>G\222;\236\365\\\370"
+	.ascii	"\222\214X\025T\274Ey\336s6V\t\236\347lL\202\355<x#\271b\235\260"
+	.ascii	".\266\235\363\231,x\3073V\303r\332|\265^\360H%\230[o\231\227"
+	.ascii	"\240p\353\241i\002\255\336\246f\355Q\334\001/\261R\373\346tg"
+	.ascii	"Z\254\3266\313f\214bk6*\311V"
+	.string	"eHb\241\366\315\257\326\257m\261\372$\013\266Z+\2144\313h?,u\254\302U\030\\v\260\023&N\233b'\217;G.0\357w$\207\234\335\220\037w\37688\027\243]?\261\325\217Q<\344S,|\211\313s\322tx\326Z+\360\310e0\f|\342n\215O\307w\006L\370'c\211V\tE\260\220`m\001\267\260\270\220\\\231@K\330\002\341[D*K\211\021\020\264\212(\301\032\302D\353\203#E\256\220|0\245\304\310U\222\251\"K\266\246\244^\254\326\bXK\246J\320\322Z2\025\204\253|\032x\350\265\001{\3302\032f:\036c:r\2037(\245\360\362\006\242'\276\372\221\353xJL\251\311w\022\371.\344\307\275:\277Y\022\362&\367\311\025\223P|\365\024\316[\334\344\024\321\354\340\264^+%A\362$\367\031\211p$\247\311\r.B\022l\2033\333\027:#\032\334\310\013\f\344\032"
+	.ascii	"\331\013\341\307C\360\361\037i|\310\301\312\340Xi2\270\340Y\307"
+	.ascii	"\240\307/\3501\205\024\026\332\241I\202\302\343\feh\301yX`\206"
+	.ascii	"\204\035'\241\315\230\202\357\240\300N\311\004W\362f\202\034"
+	.ascii	"\317\272\0048\236\003\307\231\355\215\356\310B\273/H\307\b\316"
+	.ascii	"\307\037\004\217\340e\023\305$\004S\210=p\026\353\242\363@\003"
+	.ascii	"\317\272\003Uo\240\n\017\n\013\355|8\212r\304\215s\024\260\033"
+	.ascii	"\013<\353\f\330\370\002W\267qf\363bgL\032\331\207\315h\312J\271"
+	.ascii	"\211\262l\206\215\330F\251i\025V\250\032\257\234\201Sk\215\227"
+	.ascii	"\235\334(\026\362\032\347:\236I\267=c\225\242\241 \367\375HC"
+	.ascii	"\201\323H\340\nT\361\026\235\361\004\316F3\337g\224[\334\330"
+	.ascii	"\020\035\271A:B\f\006\304\022\247\256\211\3130\021!\017\200j"
+	.ascii	"q\320\232\2368H\237\201a\207\270\274\255\372j=\226\203\244\002"
+	.ascii	"\315\320\221{\202\023A^?a\016\210\353O\250a\310_g7r\246\b\273"
+	.ascii	"\356\201\024\0239\203\235\337\270\340\t\035\331u\257\327\260"
+	.ascii	"\"\350\3102\365&t\301\013\2660\207\004\320\221\353\333C`V\004"
+	.ascii	"\316m]\330\024\321~\216\334\256\363\327M\350b\306hF\224E\212"
+	.ascii	"\r\303#\367{\007\234\003\201m\250a0%\021c\246HFR\222$i\016\221"
+	.ascii	"\005\304 \007\231\325\r\021 %c\222\315\310H\013*\351\252\347"
+	.ascii	"\017\272"
+	.string	"/\3241-o\371\356/0\3215\177?_b]#K\363\021\177\3043\324q\324\342\020\025\266X{O\374\2213\253\261\350]y\204\033hy\370\216$N)\002t\234\365\241\332\312\237N\254\230\363\351\0303\260\262Xh\333H\344\264\366S\314\305\273!\204'\350\031DR\034\245s\312C\341\006\3452UFT\326KH\266\216\022D\205\272\203^\254\322\345\310\304\204\\5\307`\027 \325\317\013\025\325\350]\347\340k\201\022\247l\0240R||\347\020"
+	.string	"'['r@\311F\027]O:\310\242\343\256\331\030Ps+I\366O\t\271_\215\223\t\227:\f\006\372OIy&\001\374T,-`{|\347R\257tG\326\302\257\352"
+	.string	"\bXY\005\224\310\266>G\030\037\313m)\333Y\021\354\322\212g\356;\216\326\347f\306\007z<e\312l\223!\252\261\262\321uE-\341\262\230V\031\374\020|w\315v;{X\240(\233\247\326\336\243\334"
+	.string	"\206V9S\026\340)\377\034\005[\267U\336*\347y\233j\255]\r\025G\247\024H\374\260\006D\036\r;\316\262\267a\247(\245E\262\253\307\025}\321[/\"a\025\2273*\354\260C\347\275\355\362\027\352\003\347\341\0235ux\030\315\3311{E!\360\221\277c\001\235\320\331\300\227\r\021\306Q\325]\022*\256tR\3446\222\217\214\003\373\351\377,\334\260\333\326\3244kY\255\302\344w\323\306\314\263P\255\203\331\001\304\302\301\2117\210\260\340\307N\204x$F\036j\304\217\247#\246\003\317\004\340C:#\325w\373Q\037\301\262\213\310\027\250Q\323VD\311\347s=Z\031"
+	.string	"\032\244e\257\252.mLRF_\364\343\333\261\350\017\202,);j\"\211\336\235\007!x~K\326\277P}P\213IV\233\376\035\303\367S;*\027\224\371\377@\2774ln\242<\302|\035\205_\361Y\"\013Q\314\215\374\036\276\037\356\267`\204c\215\2226\230\361\231\202o\220\253=&\206\210\223;i\300\307\302H\004\227o\2323\217\3248L\030\240\n\336\367Ug\312\273\304"
+	.ascii	"\2320\370\225\bs\027\277$\333Obk\341\"\344\250\326\2172\331\255"
+	.ascii	"@\243u\356\301|2\204IG\363N\341\204\360Uk\003B0\212m\345\243"
+	.ascii	"\254\207U\325\262\260\326\003\355\231\262)\361\306\310g\275\272"
+	.ascii	"\344\030:\360\354\375d\270:\361\177\304`y&c\270\202M\377/#\371"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_blackboxEncodeTag2_3SVariable.26.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`^\024UV"
+	.ascii	"z\225\244\037L \322RI\007\221\003\001\340?\023tq\226>{3\244\f"
+	.ascii	"CZx\377\377&\252L4\274\250Q\025`\306\225m\307\313\250\0343\215"
+	.ascii	"\244\224\203F\007\246\202\346ID\232\377\377\331\025\321\375\220"
+	.ascii	"\223\343\"*b\246Z3[66B6IR\312\360\001\252\001\371\001v\274R\264"
+	.ascii	"7\212\366\252\240\275P\357}z\257\023\355m\242\275L\264w\351\275"
+	.ascii	"J\357MB\242\275G\264\327\210\366\026\275\227\210\366\006i\357"
+	.ascii	"\020\355\025zo\320{\201h/\220\366\376\274\327\247\354\375\225"
+	.ascii	"\275'\177\3415\337K\337[\226\275/{\373\275\314*l!\361\246\202"
+	.ascii	"\026)\217\203\254h}z\252\033j\246\006\036\303l\307\374\2059\f"
+	.ascii	"\227\273\214g\267eY\314\362\335\002\355t\244\241\263\343\307"
+	.ascii	"\264w\305\226\301p\335\002\303\004\253\231\0261q8\370\313\352"
+	.ascii	"I\231!k\032\027\236\0309,\246k\343\327sP\372fp\3572\020\354E"
+	.ascii	"\214\221%0Q\255.\024\021D\255\310\254\225\361c\272\310\037\373"
+	.ascii	"\300rb\273z%\022\2064\326b,\202\231\242\326\272%\305H&\323\222"
+	.ascii	"\215L\246\177\241j\317%\222\327\352b\274\242\212jJ*J\005\324"
+	.ascii	"\223U\023\323\222R\022\322\221Q\021QpH(\b\b\370\343\363;\235"
+	.ascii	"LZ\276\305\226\317\256r\2076ugic\274\002\017\357\207\256\312"
+	.ascii	"\2426\206\251\344L\255\221BcC\324\215-xN`Q\273c\025b\274\230"
+	.ascii	"\301#\020f\360hWB\341q\363!\345x\300\2426\206\237\312\240\\\t"
+	.ascii	"C\206\266:\273\262\250\345q\323\024\323\022\017;\264\322\331"
+	.ascii	"\205E\255\007N\252\201\206F\232\341\256\207>\002\242`\344\223"
+	.ascii	"\307\206\".2t\344\356`Q\303c\2427G-A\030\206\336\034Y\020*\233"
+	.ascii	"\336\370\326\370\315\361\255\2642\242\205%\202J\027t\204\220"
+	.ascii	"\202\337\034W(\221\320h8\343\033\21614\220\n\300*?n>\345\025"
+	.ascii	"^\0228\360\233c[\231\204C[\036\377J\256;<r\374\346\310V\006u"
+	.ascii	"\211\362eK\237L\226\307NE\223H\243\224f\027J++\245j\255\\\307"
+	.ascii	"S7\034}\350>\273j\255\333gij\274,x\267\235\330]\036\273E\300"
+	.ascii	"p\033\305a\346y\023\202\347\271\216\3511\257\256<\316\235p6-"
+	.ascii	"\317{\274f\363\352\231R7nc\361R,\336c\361\226&\026#\335\270\314"
+	.ascii	"\314\265\326\352D\004\323\337\025\2634\363p;\004\3233?z xs\214"
+	.ascii	"\301\271\023\256P\261\332Y\350\370\314\032\017O\231\035\347\312"
+	.ascii	"\355c\241Y\336\311\262\231\222\241\034\b^\034\343\316\235p\305"
+	.ascii	"\354\207\353\3430\363\037B\307\306\254\361lW"
+	.string	"\0163\373?\023\337\312\272o\371\375\353\025\223L\306\204\243\360Wke\031\226\241\230L\371\217\002\016]\2341nd\335\267\213\034\353\303\3552\233\035\347P\330\273\260[\305\255\215\215\3238\f/\037\321\250L\221\302F>{\257\030#\231Kx/\t\357\205R\366\216P\366\212\360\336'<\307\034\366\336\341{\233\360\030^%B\260$H\336{\344\275 \274\327\310{?xo\221\367z\320\275_g/\221\263\327\353\275C\336+\344\275\035\2747\310{9\350\336\r\316^ g\357\217\367\372xo\217\367j\320\275\031\234\275<\316\336\035\357\325\321\275\030\234\275\027\234\275\026\274\267\202\367R`\366N@{s\320^\034e\257\004e\357\215\2627\202\262\027\202\367>\320\275\016\234\275\r\234\275\f\274w\001\263\327\006\355U\200\366v\321\336\032\357\245A{\023x/\002\357\235\361\336\003\314^\003ho\001\264W\006\355%\340\275\003\274W"
+	.string	"\332\033\300{\271\336\033\343\2750\314\336-\332\253E{\263h\357\213\367b\275\327\205\331{E{[\320^"
+	.string	"h/\213\367Z\321\336\025\357\255z/\325{\2478g\237\004e\225\340\274\203\2329\3047\245\027\214v'j\342\024\327\312\334\324Z\223n\234\201\240[s\343\314EM\033\342[\031#k\035C\342\b\316X\350\3260\004\217\340\201C\3602\357\211\007\316\r<\354\016\234\211\\\312\2120\031x\003g\342\r\3023p\037c\222\234\245\234\357\330\252N\031\2728a\364\274\326Jv\264\200\215/\240\300mt=\201+04k\274\213\306k\234\241\361\223\t\004\236\3009\343\b\230\231q^CSw\200\001?\240\200\033 \343\001\274\200\265\262:L\300e\fp\002\004\370"
+	.ascii	"g\322#&\313\314\b\360\263\016\327\003\270\t\307\214q.21\372`"
+	.ascii	"l\035\206\326\267\206f\326\265N\365j\360\320|\361,\254\277\340"
+	.ascii	"c\331!&\357\034\314\235\025\214\\\\\335E\213_\235\001\370\212"
+	.ascii	"\267\270\tg\210\207&\213\003`u\026_:c\365\223\211\252\257\270"
+	.ascii	"\t\207\352U\247u\210z\250\316ke\366\214n\300\236\212\372\224"
+	.ascii	"\2127=\212yhB]\305\323\241\216`\247?%\235\336\004\206\207&\323"
+	.ascii	"\233N\365h\360\320\\:\223\322\227^0_\351\346\261L\031+m\326."
+	.ascii	"\005\037\212\200\235\364\022\276{$I\363\331JE\371\330\036=\351"
+	.ascii	"\234WL\032=\370\243?\351\025\327\316C\263\350FD/:\324\236b\222"
+	.ascii	"\354\f\321\241\326\f\035\370\340\227\352\024\327\200xh\n}(\350"
+	.ascii	"B\274\307@\017\272\023\034\2407\2011\272\301\340\241\371s\340"
+	.ascii	"\271\310\346\363\237s1Y\362}n\036\311\314!\352)\353\276m\342"
+	.ascii	"\007C=\326Z\257z\2104n\306z\317\262\rqDF0-\333\220A7\334\367"
+	.ascii	"\363\226\0342\201\223G?\350\021\342<1\362D\t:\207\231\277\376"
+	.ascii	"=\207\234;1r\200\236pr\237\340\253\001x\262\320\244\207\312\""
+	.ascii	"\207\343\274l\3719\334*\301\322htP\370\034n\207\240\262"
+	.string	"\304\371\0256d~\017O\370\307\265D\330\304\353\013\311\027\023\037&_C$B\234\230M\230\020\371zi\025\0013BD\350\005\366\025\344\211p\310\021/!H\206l\201\031\021\222d\313k\t\223-\255\026+T\362\265d\253\211P\270d\013\210\254l\304{\274E/x\211\252\262\230\2177\036\037\202\227z\207\016\331\3138\312\017\0314rS\324q\327X\357Yq\270\005\366@\305g\2471<a\261\222\033\031\217\267\334\250\330\370-\237\314\203\335\270M\320)Q\005v6\376\314#&\313\224\234\317\3169\360\325\021\337\354\350Td\275\342\336C\005e\204C\371\271$\302G\270\231<r\021\222dG\366\236\200\360'V\330\310A0Rf\370\301\207E\376\001\227\"\34786uM<x\023.\036\020y\330\277\274N\304\253/\215\205\366~\230b\033rf\013\n\371\020!q\304:\270X\267q\220w\020\244\r\t\034\234\204/\034"
+	.ascii	"y\3307\370q ?\316qk\366\320Xh\017\007)7\037g\267_\217\3738\205"
+	.ascii	"CL\366\350k\3535\326\340\334\026\204\006<\036\366\fv\234\307"
+	.ascii	"\016;\305$\331\024\026\332\253\022\305U\206\260\302}:\316U\276"
+	.ascii	"]d+C\243\343\202\207\035\2031\266\340\027(\271\005\3478\2766"
+	.ascii	"\305d\033YiM\305\341\266\325V\213\315q\031M\032*\233\265}V\215"
+	.ascii	"yq\325J\275j)[\353\030\277\365Q-n\271\243\303\264\202\323Nn\026"
+	.ascii	"\203\275\2023\036\227I\2762E6\250\322*\311\315\033)\230\340\024"
+	.ascii	"\344\370\004<4q<\307\271\270Vv\034\\\212\230SL\222=\335q\326"
+	.ascii	"Y\023\247}\235\244.\274q\233\220|K'\244'\351!C\036:%\314\032"
+	.ascii	"\0173\227V\207[\326\201\310\304S\316]\222Xb*\347.a\222\030\355"
+	.ascii	"\314"
+	.string	"D\027\032\216X\312\221\334\270\253\305\302s\3329\2104v\272)k\312\177\3201\035n\217\312\235\250\261\003\243\326\272t\270\r\201\231\250a8$\021CffDDD\222$Ic\321\005\304\030\006\235\321\003\021"
+	.string	"%d\220\331H\322Be8\252b\n\252\0223\240\326\235tu\231j\303\367\240\373\230\361p\303\034\027)^\032\307\334\001W\332aYQ\236\2722"
+	.ascii	"\005\270\311\200#:\373\245\320\234(]\316\317\315\231z\362\316"
+	.ascii	"hR\335\372yb\227\004\201?\0027]\275\264\276x\367T\353a\337e\306"
+	.ascii	"\355\013Q\274-/D z\207n\032\271Nj\026\352M\202\nEN\005\276\201"
+	.ascii	"U\332!7\331_g\275\340|\026J[\025\325\331\353\216&!0\324\362\002"
+	.ascii	"\320n!\374\337\017\275\301n\356\360\265\nk\303\343\330\305\305"
+	.ascii	"\267\352\200!\263\254I\344C\253\301\216\270sH"
+	.string	"\376*\226n*_\016m\374b\016F\265\276\016u\216H\212\211:\024\002\364\325\3714\317>\252\340\031U\"\205W,\334\231\370\224}v\201\004\025\007\221\354l\213\304Dh\317\371\027\240G{\270\255{\377\245\253<-\356\270\343X\f\007\202\2629\270,)b]2\256\244\302\313\215lDS:\261\313;\244\211\254\215o\"\257b\206D\373\234\342\214\221Ig\247-K\374\204m6\306mn\316G\332Wf\177#\023\325<\2413\020\331\301\226\363\020\031\320\233\337\326pw\355\bGm\300\310Vn\016}\007\3738_\330\025o\354\250\233{\266\316Z\266\313\360\210\254,\227\237\023\212\261\205\307:5\216\375]\334 8\271\3001\016\326\312\266\350\374\366\276q9vQ0\266GZ\353\3537\334/\301\bI\355)\222@C\203o9\303\r\f\276\341\340j\n\303\"\025\034P\0302\025D\024fp\251\260\220\201\271\0204+6"
+	.string	"\003w\005\354\365\224bP\201\273VF\372\232\311\255\235p2:\3174\234#jS#Uk,%s3\252\342\277\036\356+\027\332-`\0040\334\220A\27147\004\273\253\007lU\234?\240<d\245\375\222\361g\254\324\222"
+	.ascii	"\252\236)\003\327\244\255k (t\213~\253\335\275\211\213\247\\"
+	.ascii	"D\366\334\332\362\327\334\204C~\004\335\310\274\357\007i\304"
+	.ascii	"r\312\372@\r-\023\350\212EmkjT!\"\027\223}\250\030\r\265i\205"
+	.ascii	"u\225\r4B'\356\b\327\362|\331:\211\246\223\b\241\271\276\350"
+	.ascii	"\007\2566-2fSRn\n\3019e\272V\016M\310\202\022J\305\340\373\375"
+	.ascii	"8$\332.\225\027U\373\263?\200]\367\035\202\214m\333\013\305\276"
+	.ascii	"\345:`\024\266\341\347M\315\005\301\222\336\316\016wb\026\350"
+	.ascii	"\203\256Ly}7#\263\336\360\016@K\351*\275\3450\2564\332\366\265"
+	.ascii	"v\024\232\316\300\362o\025;~{(8\260S\003\023\2025\365kH\\\267"
+	.ascii	"\005\220\201\227\325\302\006\177T"
+	.text
+	.section	.gnu.lto_blackboxEncodeTag8_4S16.27.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`Y\rU?"
+	.ascii	"jn\304\027<@\350\312p\201\250\270\212\357v_\271\225\253\202]"
+	.ascii	"\351T\372\314\353 \205h@2\274\316\3061\026\004\024\3750*,\b$"
+	.ascii	"\337\317\255:B\251\304\360\251?\024\305\rAk{\357\275\245L2t\001"
+	.ascii	"C\001m\001m\362\262\311{\025\002\274\004R;\\W\"\207\224V@\247"
+	.ascii	"\035-\357\373\345\374j~7\377\033\277\255\036\306\265\007\226"
+	.ascii	"3y\217\263\347[\242\234\275>%(\324\237\3745\337;\234%\276\271"
+	.ascii	"\033\241\236\315\333\314\335\315\376\251tJ\325\r\2262\213\326"
+	.ascii	"u\345\240\376\3342\0318\230\273\032\033\352\232\227\356a1\263"
+	.ascii	"h]\365\300~\256\231\312z8&Q8\357\336\314\317\314\035\215\216"
+	.ascii	"C\255+\024?:\353\252'\266\020\324\237\253w*\364\247z)\364\347"
+	.ascii	"\356\334\256\242\353MY/\3070\331&\322\272\256\307\226r\265\346"
+	.ascii	"M\275/S\317]+\013\353\312\252\212jJ*\n\312\370\344\324T$2-\251"
+	.ascii	")z\232\315s{8' \t\020H\021\272k\225y\226I\346#\322\222\013R\226"
+	.ascii	"1\213\223\222\204\016\207\fc\215Y\302WbnUE\225\005\013OIEY\251"
+	.ascii	"\302P\254\345\306)\177\322r'\223\212H\026 \027\244lb~-\252\363"
+	.ascii	"\350~\347\342\242\304\343&*LP\243\362\njTj1\213~\027;\263\345"
+	.ascii	"\211\0211'\232E\301.I.H\251\304$\273\343\023<\3379H\021\036\314"
+	.ascii	"\224\226E1\222\344K\\jjn\tR\332%\031M\313\236\030\271\373YG,"
+	.ascii	"\342\203M\247\"=\314-.\312;\356\363\375\304\242\204\321\023#"
+	.ascii	"I\316i\331\272\256\313@\212\030\371\002\370.3\355\256\332.\221"
+	.ascii	"P\373t9"
+	.string	"\024\355gY\323G\275\034z6\332\257\303\353\263\177\204p/i\270\343|\202]\354\314^\356\013\324\354\2705\203=x\322\356\355\324x\241^\331\343\350\007I\322h\335\375:/\3467\020}s\277\216KY\277I\fBJ\032\356\340\303\345w\241\027z\255\317w\023\317\240\241:J<\370\260\357\370\004\267t/w\365\350\270\241\bv\271\243\263\re\367\344}C\272\265\261\255\245PK;yO\2308yK\210\270\336\217\226\362\206HyA\234\274\037\216\346\367\220\362vHy9\274\357\273\341L\203Y\206\313\371\226a\270`\341\344\255\220\362R8y'\234\274\022N\336\b'/\204\224\367\201\312\353@\345mp\362\222\235\274\f\230w\201\311\253\300\344=\236\274c'\257\330\311\033\306\274`&\357\227\311\353\225\362v\235\274\t\256\346\213\340n\276\007\376\346k\340\344-\220\362\022Py\271T\336\255\223w\300\311+\200y\003\230\274"
+	.string	"L^\255\2237\213y\261L\336+\223\327\352\344\255Jy\251T\336)\225W\352\344\215b^(\223\327h\362>\245\274N'o\023\363\026M^\242\311\313t\362\252(o\212\362\242(\357y\362\232\314\033"
+	.ascii	"\264\372y\024\315\221\352\345~\270\337\315;N|4\335\376\241Y\375"
+	.ascii	"\301\216\207\207\254\253Fk,\253\276\262\352\347%\202\2244\334"
+	.ascii	"\021\005I\320\213\201c\240\376\303\016\016\037c/\267\212\252"
+	.ascii	"\253\232\373@\364YSQ\365%\217L5\210^~:\034*\325S\375\244]TK5"
+	.ascii	"\352(-\312\330h\r\365\324\306\247>\236D{\\\205\362\224O\275\354"
+	.ascii	"B\235\332Dw\233:JM\355\324f\241\267&b\243u\361t\316\324\304\r"
+	.ascii	"\315\324W\"*\\6}\203f\234z\271`7\353.0Z\326\f\002\272\326\021"
+	.ascii	"@t\\\251\251\320>P\321\240\375\036>\201\366\200\253H]W\272e "
+	.ascii	"\353\2208y\253\223\325\353\317\036O\235\262*W\275\325\353'\207"
+	.ascii	"\276\337/dO%@>\330p\3736P\f\315\241S\273-E\223\351B\033(\262"
+	.ascii	"\332\036zwE\013>\220\335\362\321tk\240\325\257C"
+	.string	"s\210\275\334\224p\t\251J\272\203\206\305^\326A\326\\\262\320\207s\325\321\035<\336\333@/\034\275\024\256!\354\301\223n\256\353\2722\365r\377\227Ge\353\377\201I\333\372\177HN\267\376\230;\206\275\326\026:\310\356\330\313\032\3319\006\3770\227\245fk\026\207Tn\3534\302?i/\367\207\227C\323\257i\337\216\020\260\016\017\355\345\003\240k\355\326i\204s\222Gx\360!\337\331\3135\036\007'\243\r\351\002)\247\326@\272\301\340\200t\301\306\266\002\0061\016\371\3666\203\r\225C\316p\261F\003\225!\347\326\3336\246\002\306\n7\2706\030H\265\032pl-\332\326\\\260\035a\254X{ql\213\223;\216u-\\\fd\334Q\006\034\\\334\221\250\267\276\241,\212/\200v4\017\255\n\b\272\202\311E\322\336\024\237F\211\262\256\316\032\301\225Y\037\b\373\001\2663\203\265\307JM\225\004\350\207\b\366\rV\032"
+	.string	"\375\210\017\374\231U\006\265\020 \032\"\330\315\300\252X\245\3505\211\006\032\303\206>~\201t\325\313\275\236<N&\272\017\030)\021\275\246\361,\020#\274\252\264\263\326\320A\356\367S\217\240S\330\327\2242\353\373}\311Q \236\021\354[e\326k\026\315:\003c\350\024}\376\325\031\206}C\253\365\215C\205ux~~\256dE\241\323&4\205%\023\372\312HsJH\350\022/|\204\226\260$\302!\204\007\r!D\237\365\003\007\035\242A; \353\006\235:J\0322h\262F+-a\240\240\321z\301\261\025\034\373y\n\013\253\336\306\372m\f\360\004\242\213\365\t5\254\305\372,47%\354\253\321\032\314\253\277\274\372y\205s\250\302\244!\364b`\237\251^\032zW\213H\320]\t\372JE\177\212\\\200@\027\350\320gM\200\253;|\360[\3155\240\267:M\2244\334!\240\0074Z\251\316\360L"
+	.string	"\200F\353"
+	.string	"Z\035\201\t\250a@\004\021T2#\"\022$I\222\264\006\201\005\004\031)\325\331\001\021@\241cN\331H\323:\035 \232&AnT\316\351\310\314g\334G\344L\210\326I\251\024\007\233C\355\341\2570\037XJU\353\340\003XJZ\255O\237\375\203I\355S-\372\302\030Ouo\035\312\376Y\360\216b\253\3033\307=K\213\245\210\007\324\036Qh\003\3348*\207D\027-\364\352u9|I\363%\265\372\324v\367\233\333a,\264\031\214{9\3704\231\b\331\267Vg\022\347\244\305%\2162\317\345\332\325#$P\206\342Y\022\225\020\026\312\022\261y\214\215\371\273\006~\bt\366\241\225\227+d\300D\206-KT\341\213\0074a\362`\334-\003\217k\013)\034\366\242\001\314\027\030s\354u!\213\364\343|\215!C\204\266\266a\022\030\270|s"
+	.string	"\260\243\323\236SHCp\263u|\235\030U\0049\344[hL/\364\307\030\314F\230u\350,v\373\3264\250,\320[\370|\327h9\250+*\032\247G{y\231\373\323)T\344\324O\245\245\r'w/\332\334\346\356\257\327 :<\224nvo\330\r\301\2167\250\343\214x\223\346GD\330\304E\f=\006v\\)\017\305\343\003u\"\355\207a\313\356e\323\362l\335PF\345%r^[\341\252\205\236\241(\245\226\002:1x\250\2074\350\310\375\353\262\334?F\216\206\253\016"
+	.ascii	"\337\t>\363\035\f\2379\250S-@\376@\342\264c\331\031p)z\372U\\"
+	.ascii	"si\344\324\0348\321fF\\]g\220\243:\021\036\310\317\264l\242\322"
+	.ascii	"y\217-\325@\367v\276\025@\225\214\277\350m\020\247Hc\374\002"
+	.ascii	"(\342g/\036Z\3602\275\242\355,"
+	.ascii	"\246NE\265\214\350&=\202\200\245L\001\013 \227\330\200\204\325"
+	.ascii	"->XB\253V&\352\262\3155rc\232\023*"
+	.text
+	.section	.gnu.lto_blackboxEncodeTag8_8SVB.28.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`:\005U\""
+	.string	"F~\333J\220TR:\273\006\363\234\253\013\227\021\267\213\330\376\257\227\003\225<\t\247\003\336H\373\353\207"
+	.string	"\376W_\333w\207\337\357i\221\263W\247-\022\365\244z\326\255\305H<\225\005\362\007\376w\223tfd\032\260\366\354\377\204\020\262\345N2\315"
+	.string	"\267"
+	.string	"\304"
+	.string	"T\216\234\272\377\252A$\222\345\336\013l\032;F\227\313\345\362\026y\276\365\360\274\235\316%\207\273\245\350i\332\256C~\362\002\254\030\241m5\021\235\007\325\365\233\252\"\214\272\233a|\272\356\353\004\234\224@\324\242\214Nw\261\007\224G\256\374\254\350d_\230p(\275\252\030\243\346\272\016T\242#\312\370t\234E\221\230p\374\254\370\302:XS\206}+\251\336P\b3\214.\236\336D\031[\034\265\277\263b\013\373\273\367\346\232\210\365\374\326'P\005\251\022etq\363EP\267v\001R\226\030\273&$\353\262FtrT\333\316<\221\251x\327o\316\212P\266\200\231\f)O\276.5\031\325\212B\270\367rUj2\236{g~\005f\276\300lQ\004\177\314\257~\230\227\017\371}\347\322:\363v\272g\235q]\371V+\247ge\364\254|ve\263+\333Z\271\317\312\365\254\374\337"
+	.ascii	"0\263\022e\3672-\331n\0233\214\352\\\277\326\237\365f>\237\353"
+	.ascii	"_\3149\026\272\027\233cS\272~G\275{D\245$\207\020s\356E\370["
+	.ascii	"Z,\226\022\025S#_A\224\367^\013\351\315\372$\347\0240\030>\213"
+	.ascii	"Dzs\240I*\033\312{\22187\231\002s\0139\326\360CX\314\366\356"
+	.ascii	"\221\214\024`\367\336\004\034!\275\371\263\025ib\355\301+\363"
+	.ascii	"\201\334j\370\253\023\007p\257\224\027\330\275\310\004\334 \275"
+	.ascii	"\311\310\277\2347\323\373\316\233C\346&\237\304\271\323`\265"
+	.ascii	"\274\275\367\336[\037\371U\324\256P\232\276\231Z\212s\246u\275"
+	.ascii	"\304\353\232~\222\232\366\3616\347L\323\364\020[\031Q\305\321"
+	.ascii	"\242\b)\202\366\221\337s\332~\025"
+	.string	"V\332\221\f\365\2446\370&\316\233\266\277\364\242vLw?i\207=/9\337\265\237T\305\353\367\b\2661b[Q]\362o\340\334\365L\213`K&\261\031\325e'\307\220\232\316\234\373\372\245\277uK\246e\231\364dT\227\016\246\326\224&\256\3064L3\207\020\326+\261\331D\273\343\r\036\026\301}]c\205\206\005%\313k\212F\367\221q\356\353\030\253\037XL\216\352\0323\322\250\366\021\313\030\2132n)f\264\262M\r\315\214\314\221\001=\377\t\362\350\004=\234A>BB\t8\240\240\020\b\235\021g\020\020O\363NN\007\237\036\036\341\216Op\303\220\220\303\207\035\035\020\034\200>=:!\200;?@\300\034\003,\024\021\374\001\006\t\205?\300\034\262\350-\305O>-;\322\244\250\215x}\344\\\232N\246\3154\034\316{\275\344\353^\277\r\213l\327\307^\313\340<\221\202\365$K\307\001\252M\303`\310"
+	.string	"\240\336\232\377\265A\247^\311\246\377u\013?\300\324\224GM\304\202\352\312\n\227>\212\375\346sC;\246\323\207\375l\264\327g\277\353\366\312\2261b[\316\336v\215\333U3\330\341\207\324D\214k\323\372`[\022\333\212p}d\235\217\264\346\326\003K\233\371\322\274^b\233\352\372\311\337t`\361\ne\250Q(\304\220C\204!\021\032\tF$N:p\002\031\302*\017\021\260-Eu\222\264\337\001(2\201\201\346\274/\007\023\204\253*\006 \005\177\344\303H\360'(&}\b=X\253\250J\007\372\262-1\243\300H\211u\033n\305\341\245"
+	.ascii	"\275\213y\337\252\241z\0013'\214\245]\034\342\022\027:\223\205"
+	.ascii	"\234\004\262]\224{\351r\320\210?C\306k\325\366\340\252\033\354"
+	.ascii	"\021)<\177+\304\344\341\246\201\036\257N\253\201.\001\241\031"
+	.ascii	"\366\344P\2770al)o\301,\037\367\002\024\3046\251>s\266\f\023"
+	.ascii	"\fJ\311\324\224k\263U\237 \264C\ta\272Ep\240 D\25107 \371\325"
+	.ascii	"\371\277:\252c\266\364\336\031\230k\307Y\021$\213T\322\337\212"
+	.ascii	"\356O\202\231\201g\352\374\311_\213O\r"
+	.text
+	.section	.gnu.lto_blackboxEncodeU32.29.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`/\001\255\f"
+	.string	"&\230T@ \217\223\016\004,%B\032\216>"
+	.string	"z`\177\016J\""
+	.string	"\214\264\216\r\246\b(\277\352\211\250\211\005y\030\317sho\f4\320.$"
+	.string	"\244\204H=\"U@\021)\340\335\267\356\207\021K6I2\245A"
+	.string	">"
+	.string	"A"
+	.string	"\0354\257Dp\200L\023\210\227\314\255\323\004\226_7\017\250\374,\013\250\374\252\265*\274iH\207HA\372\340\"3\257g\260f\324j\2678SJ\031\0311\034\231Y,\245Tp\357\266\006\332r\264\336\002\345\034\2739V\343\025\3332\213]\035\373(,Ea\177,\036\353\214\002+NH@\221I\241{\221\247'bC[c\264\305\315\0364\263\2244\223y\241\304Kfv\252\300\362\323\240\214\25598\234\t\307\305xN\006\236\204\3536\b,\370\033\313\035QU\367I\270\026(\034\0065\267\336\212F\320\245\272\305"
+	.string	"L\2208M\370\250\356\\RU\327\274HR9\301\256\335Fx\f\255\251\314\314\336\324\036\003\237\221\020\317\203'\"\372x\261\215\005 \220\217\f\003}: d\036\f0O\210\307\005\002\3614\270\260\220\350\3328\320\314\301't\211dY\350\302\330\322T\336\324\016\026'\223\237\024\203O\203\372{\207\300O\335(\\\365\337*\235\013)\032"
+	.ascii	"`\251'\023\232\230\006\306\203\313\314\330\036\302\013:\"\216"
+	.ascii	"0r\b\007\027\333\352?P\004\030\n\b\346U6\020\320\322\264\303"
+	.ascii	"W\245\332T(\216kD1\214\206\251\030\340\21245\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_blackboxEncodeFloat.30.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"\245\t"
+	.string	"\206\323D:P\245j8\224{\025\370\225\024\256\336\324\177\016\263\303\031\232%\335\235\2503h\263\333 \333\2700w\317\314\247W\277\347\317\314,\177\030\357<\314\232@\"\2539\270\311\336[\312\224\0020"
+	.string	"6"
+	.string	"/"
+	.string	"\327<\376`\273\306\335`\273f\320&\360\221c\317z\235D\f\354n\247\033\007\237\240\377\220ODT\370\224`v\327)\2420n\275m\005\333\030\373\032\347\022`\003\300\002\273\027\261\327\2724"
+	.string	"\035\266O\261\235\343A\300\257\314\362d7\200\200\326\356Z\334\300]\253dO\373\036\377"
+	.string	"\257\232x\301nj\244\265;Z\314\300\005_^t\305BC_S-'\230)c\226d\246\366\250\224\027\257\b\031\007\\\025\032\332c\230\252a?\333\335\265\246\354\253\376\355\253?\313\322\251\351\235\322G\023\241\221F\034\265wq\by8\237\027\352d$\276\315\203\247\371l\272\220G\003\352<\321\250\273,\370\203\350\210:\322\367\211:\312\270\317VS\316\304\\&\2450A\246nj\203\002\013"
+	.ascii	"`\251'\023\372\200\006v\\\200\346\032p\f\243\0031\300\025ij\n"
+	.ascii	"\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_blackboxWriteUnsignedVB.31.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`i\001\335\016"
+	.string	"\266\232aF\360\260(\035z\fy\323\005\032\366\300yt\nw6\274\226TO1\310\336\212\355\274\244ct\235A\002\\\364%BG]\334)v\306\204\233\262\245\031x\006\226\250T\215\340\264\364 ~NL\367\323a\312o7\221;\245H"
+	.string	"J"
+	.string	"R"
+	.string	"\363\373\271\264\217\342)\300\267.\330\263\353b\343bW\374\260\002\356\323\343\0028\237\333\003p>\r\3321.\306l\001\026\207\226\231\032\273\333)\314\301K\320\177\354\236P\205\272\3544\330]\313P\365\341\326\333F`\373\201}\032\001\376\266\273k}\261\337\372;\034i\235\322r\223~G\007\214\214\352\032\306\335\016\243\215\225\315\027#\356\372a\177=f\216\025\237\001\017;}Y\226\233\301Z9\340>A\363\342U\200w\251|v\266_\325X!j\273\036\022|z\001\367-78\225\272\335\260\220H\311\321\334\356\206\\1\254jL\264"
+	.ascii	"\310\216\236\346\257\021\216D\"\037\0324+!\313\240(\237\3465"
+	.ascii	"\337\001\332Y\274\305\311\227\3714@3\f\223\337\2042\036\373\006"
+	.ascii	"\304\204\366\204\277*8\244\223\332`\023\202X\221\243-\242\244"
+	.ascii	"\212p\021RD\212r\"\242\243\224\222\020\205i\017d\244D\022\371"
+	.ascii	"\274\322\b\202\205OD\342\205JD]\211\0242\351<\323I\007\002\362"
+	.ascii	"'ad\352P\276\317\324q\210\373m\365\305\334\354\204lESVq\235\266"
+	.ascii	"]\027\006\207\3755\227\034\375\221\032\373\b\320B\236\207T\325"
+	.ascii	"\217\" `\202!u\352\001`\352\211\241\303\t\214\002b\\b\206k\233"
+	.ascii	"O\2642\226\325nB\302\314\306\364\033\252\027\372,\231u\007=\360"
+	.ascii	"\350\302\213\206]6\346J\006\360\264\212d\033\372\200\354\013"
+	.ascii	"\230\265\002\216k\004\275\256\270{\375\355\302\311+ \311\213"
+	.ascii	"\353\221\001"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVB.32.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\r\b"
+	.string	"\322\31788@o\323\001\230NLo\262\216\221\225\250\227b&Y\b\340\223\330\024AZ\007kx\302\3451\023t\f\033\210\t:\f\303#\227\352\226%\205\004"
+	.string	"\026X\235\020m\"wJ\001\231\004\350\232\220\306:\f\332ga\303\264L\241b\3634`\027\3103\265\317\34501.4;\034o\017\0317#\266\215\233\232pO\255\212l\235ZL\030\232a+^m\210P\374\347\215\214\2526\205E\374w\345\234XL\032\352\331\241\027\025\304>\265\273k\025\331\037\375\032\243_\005\214\224\300\177)\273\03410k\222+$\032\333\217\366M~\322}t\341\314\356GIew\r|`]n>P]R\027\250.\335\331.\017E\226\240\304c\203\364\262\273SC\336=v\376Q\236\371@\357\021 aw\035?\260\343\326\333.\260\215`\233\024\n"
+	.ascii	"`\251'\023:\371\002\303E\003g\030\003\243.a\021\253\321\340."
+	.ascii	"/\332I\006"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVBArray.33.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`\317\001-\021"
+	.string	"\346\241sE\360\356&\035\302e\300Q\325\r\027\321\224; -\340\007C\n\365m]\225\033\354\362\303_0\007\320\260\262\333\210\225\273C\336q\215zt\213\262qz\"{\212\255m\2429D\215\001\265Y\323\207\272\273\265\275\245L)^"
+	.string	"^"
+	.string	"["
+	.string	">`z\264w\001\244G\323\003\220\036\375\262W\334\243\331\00175+;F\273\233\322\f.}\337\367\035z7\314\327#\324|\371:\20712\022\\w\362\bK)-6\031]\n\3648\"\372\371\354)\353b\to^\256\237=\306pE\\\367\362,%\330]'\327\271\334\244\333&\261\275\300\316R0\2350\375\f\f\233\232\356\034\213\335\226\317\305\n\305\037\r\347\371\355\373;\357)y\b\033\260\020t\020\376\314\232y\f\364u\331\263\030\335\330\020\355\356\306\243\025\270\304\326\036\257\331N\357\037^\3171\220O\273\030T\370\354.\207\021\230\0365\340\323~\207{x\035\307\344"
+	.ascii	"veL\370\354z\034\001P\375\236\215B\236\323\364=?\315P\t!\024"
+	.ascii	"=\261/\202D\304T\343\233\220>B\006\003\313\317\251'U\275\n\007"
+	.ascii	"x\237 ]S\257\262!\226\237\243^?{\203\030\367\255\274\200\345"
+	.ascii	"\247:\013J\351Tgl/\226\367\2409\"\262\312\3301\255\241\216\363"
+	.ascii	"\237\236\363\233\316s\307L\303\2475\254\217\264*l\253X\242r\271"
+	.ascii	"T\321\253\016\b-\326\203m\325\002q@\262}\204\254T\021>R-\226"
+	.ascii	"JBj\345\022Iu\020\3606\001\304\225\032\3316WJ\363`W\031_\347"
+	.ascii	"g\031j!\004\323X\324\031\237`\024\245\232\"7\036Uf\322\250\307"
+	.ascii	"\321A\201\222G\207\273\273\320\005\036\025\305 \206+R\271\200"
+	.ascii	"\221\032+$\317Y\343\224\001# `\002!\310\214\007`\365\304\300"
+	.ascii	"\277#\354\326\207\266V\314\"9\212\306QpD\271\216Q\206A/\336\345"
+	.ascii	"\206NX\254\314\361\200\221\275\253\232r\271\301gf\260\0320\332"
+	.ascii	"\f\326}\371l{\361Q\242s\f\256H\353\224\345^&\213\254\260\330"
+	.ascii	"\216\007 b\272\350\023"
+	.text
+	.section	.gnu.lto_blackboxWriteSigned16VBArray.34.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`\336\001\205\021"
+	.string	"\206\342uF\340\360&\035Z\036`.\"\314\214\222\031;>6\327\003\002#\361\212\b\232\372\367\205P\360f\371\263\037|\350\271\325\353X\350\230\331\006\333:\030\346A\206\372\001fW\2109\\\f\247\2349\246\204ij\237\354-eJ\001a"
+	.string	"^"
+	.string	"^"
+	.ascii	"\337\207\027\230\036\375\275\200\366h:\001\355\321/[\306\277"
+	.ascii	"\234=\2403\342\005HiwS\332\301\033\263\331lv\370\3350_\217P\363"
+	.ascii	"\345\377\034\332\304\310b\236\312#\334h\221\371\020\300k\201"
+	.ascii	"!KID\227=;\017\226P\207\346z\331\243M\207\024\363h\236\033\r"
+	.ascii	"v\327\031\363fn\355\266Ol?\260\323@0\2350}\001\250\235\030\357"
+	.ascii	"\035\214]\231\031\215=\212D \036\364\333\367\201.\204\362\023"
+	.ascii	"V"
+	.string	"\240\241\205\210\335\275\t_\346\315A.\372\316\354a\224tx\222v\327\343\321\016\214bo\217\337l\347\367\022\257\373\270\310\247]\016HC\273\373a\006\246\307\016\370\264O\342<\257\367\244|\300\356\215\321\320nB%\\>\206\322\013\3759.T\034\261\250\212\241F}\n\373(N.\230<\370)\332\273\232\025\345P\325\273\204\310\233\205vM\275\313\016,g\326\364z\331#\300\272\031/5Vr\246*[\321\342\251\342\330\037,\037\222\263\224d\275\261\2654j{\317\317q\237\377\364\240[\313t\214i\370\264\006\254\233\2642p\253\210\242r\271T\321+\020\222\026k\002\267j\215H8\341D(\254T\025DR-\226\252$\265raH\201 0ga\304\2252\3418Wj\373V\2567\376\317\017\363\302;ZQXT\034\237jtS\215\221\036\327\264;\251\246\357\3711b\311\245\303\335]\350\004\327t\203`\323!\271l"
+	.ascii	"\220(\022V>\346\016\216\214\352\007$ `\002!\310\214\007`\365"
+	.ascii	"\304\300\277#\354\326\337\266\026\320\"9J\311\242\f\210\">F\031"
+	.ascii	"\006m\274\345\317h\306\364\341\214\200\3063\332\203Y\242\257"
+	.ascii	"\272*\310\327<[\323\2225\007\366\232\356\226\210#\356\205\341"
+	.ascii	"7\221F,A\273\214\023\231f\261\035\017@\304t\321'"
+	.text
+	.section	.gnu.lto_blackboxWriteS16.35.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`\376\001e\021"
+	.string	"\246\240rF\360\320h8p\305\260\237\243@i&\241\202.\032\372\273\24488\367\232X\356z\031\343\004-&\362@"
+	.string	"\355\001\013\254\305}ot\241\211[.\007\236!r\f\352O\265i6=Ne\016'j\235\217\273\271\233\224)\005["
+	.string	"U"
+	.string	"e"
+	.string	"\257\317^PKc_S\224\363S\264\353a\30197\360\316}Q\231\366w\256\342u\036\r\346vG\254\210\261\273\"f\340\235C]"
+	.string	"\351\\>\204t\316/\033\307e7[ \247\205\214\310cwA5\361\327\363\345_\374GH\003\363\354\036\354\2563\244\371p\353m'\260\035\301N\016\001\262Xj\t\373\243\335]\253\r\210\227>}\244M\231.y\351\357<\177\227i\355\322IJ?@I\007\207\34633v;\334zl\020\007t\342\263\277\366\264\357\367\334\307\376\354\372h"
+	.ascii	"5D\237\313\376\316\375\264\213\376l\327\\\2761\373\335\221\343"
+	.ascii	"\002\202w\316\227\235E#[\215\215\024<0\220\223\202\230\364\344"
+	.ascii	"\3352H\235\2324k4\241\321\026\313\233QY\322\217\247\245"
+	.string	">\356\210\b\341\243Z\345C#\330\2400\376\264\244\227\351\364\323\373<\201j1\242\036\333\307\303`\035\250\361\237\277p\361q\316\031\250\341\033\244\223\017\205:.\262\006\334\2046\312i,&\351b39B\020\260\274\331\001\025\\%\332\302b\242+WJ\n\003g\325\310\211\n\313\244\245RYQ\310\320*AQ\245RJ@\025V\312\002\250Za\001G\024\270ua\265\002\266\264Z+\340'\203}\264jcO\bE\020Lc~\231\271\214vI8x\355/\232\345\315!\251\372\361\"\213\200%LHU\025\221\261y\232:\032\212\321\361v\227\344z\361\001' @\002d\352\254\007`\352\211\241?\004\246\001=nr\036_g\367Q\326.a\323\317\236\205p\375\263\\\267Q1\2547\"\374\036=\027\326Em\007\3237\350\201G.\304d\023\212]G#\340D\353\311\320\270QG\310\031VL`\3154`\2175\361eD"
+	.string	"\307s/\334\250"
+	.ascii	"//\332N\006"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3S32.36.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`l\001\345\016"
+	.string	"\246\232aE"
+	.string	"\261h8\233G\232\177\205\203W`\353\033\373\007\202\302%.D\023\357fZ%*\300N\213(\312"
+	.string	"\242\346\016\340\346\0070\316\367\021\334b\001\374\377\377w\260\310\243\311\334\251\316\226\302\032S!\225K\310\336R\246\024G"
+	.string	"L"
+	.string	"R"
+	.string	"_\320\323\376\211\243\b\357\312\360"
+	.string	"\273,\033\026\273\243\210\031t\347<~\200\347\\w\001\236s\016m\033\037e\326@\013\306\313\314\316\356z*\342\3413\364/;"
+	.ascii	"q\225z~\036\354\256S\\y\270\365\266\025\330\216`\177'!\354o\273"
+	.ascii	"\273V\226}\327\377\361\244\225K\347\226\376\307\207\211\232\325"
+	.ascii	"ah\354r\250\351\330\031\347\202\304_\177\354\260\313\354\241"
+	.ascii	"\3423\341c\250\257\313v:\255\030\020h \037\237\"\374\213\005"
+	.ascii	"\2643\36619-\0319\273\035\026\234s\203\356\\*\362\262\243\323"
+	.ascii	"\324\r\307\245\204*k\356v\227\344\252!F'\207\013$?z\232\303L"
+	.ascii	":\322I^t\310M\213\331\006M\3714\267\001\021\320^\363\025(\177"
+	.ascii	"\304\271\0034\327H9\216x\3432\220\200\214hW8\354\202I>*\030\034"
+	.ascii	"\342\207\226\254\331c*5\023VD\252r*\321\323h\005%d\301\343o\304"
+	.ascii	"\244D*\001\277\322H\002\006Pt\362\205PD^\211\024J\361>\323\311"
+	.ascii	"\033\t1Had\362T@\320\344y\214\373m\225\345\356\346\305\254EU"
+	.ascii	"fy\241\266]\020\016\036\373s^Y3(U\006\026\240\205\276\004\251"
+	.ascii	"\032# `\202!e\353\001`\352\211\320\341\007f\001;.\221\341\272"
+	.ascii	"\315&Z\215e\267\233\2300\2631}\206\352C\237)\263\216A\005\236"
+	.ascii	"\\\200\315\320\273\306\274\222\001<\355\"\331\206>0\373\202F"
+	.ascii	"\255\210\303UJ\362\270\227\355y\263\233\310\223W@\222\027\327"
+	.ascii	"#\003"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3SVariable.37.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`\265\001\255\020"
+	.string	"f\336mH\340\320(\035\372-~<\312{w\361\2122\2423\276G\210%4\003\tb#\370\004\0230\274\207/\234J6\232t\210\037\332_Ds|\330T\333\2030\006\013\304\320\212\253\354L\001\003\f\314m\223at\305\330,!r\247\024T"
+	.string	"Y"
+	.string	"["
+	.ascii	"\367\354\340\2737\355\327\334f|\211\341 \2732,xvK\0217\370\356"
+	.ascii	"\271\374l\373$^b\264Wt\345\214l\300\354E\313M\215\335\005CN "
+	.ascii	"t\257\273\200\320=\005\361\361s\364_{I\354\305\005)\203}\212"
+	.ascii	" \354\256')\203\271\365\266\023\330\226`O\006\001\243\227\277"
+	.ascii	"H4\255\241\351\351M\337\003\200\r\215\354.@\273/\271\033k\363"
+	.ascii	"zB\234\366\343\374:W{\364M<\3475w\330(\236b\274\316\353\313\262"
+	.ascii	"\037\215Y\214\b7\217\023\277\031\217\243\362\261-\3661\270\031"
+	.ascii	"\020n\227C\311w\357\373q\332\205/\314~\303\215Y\020nw\027\004"
+	.ascii	"*\322\222\343\323\251\335\017\213\210\330\314\371\333]\222k\206"
+	.ascii	"\030\034#j\002L\221~\3479\341\207r\232'G\252<>3l\032\024\346"
+	.ascii	"\357\274'\205\340v\236\253x\3714\367\016\334\f#\345?\244\214"
+	.ascii	"\327R\005fH[|\216\313$\352b\203\354\2602sv\t\233\372\301~\267"
+	.ascii	"*c\237v\007\023\\%m\261Nt%\266L!*d}\254\320\205\"U\b\3314\202"
+	.ascii	"\242:\235\210&UhbA,\245\230H\250\022\250:\221R\240i\305\002G"
+	.ascii	"\024X\244\020\256\300\226(\256\300\216r\337\255\312\214\3646"
+	.ascii	"\237 \333\212\306\254\202\363\352v=<\270\316\217\243\315\234"
+	.ascii	"A\246\326R\006n&\244y\322!S5' \200\"\251\322\036`\352\211\241"
+	.ascii	"\307\005\2762\344\307%d\270\262\331\"\315\006k\213\310E1<\240"
+	.ascii	"I;\001\335\236[wP\003\217.\344hxfcn\311\357\323\241\244e\316"
+	.ascii	"p\324\221\200\t\211\004P\324\261\016\t\211\3732\264+\023\320"
+	.ascii	"\225\310\001\200R#Hd\236xJ+&\241\223\001"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_4S16.38.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`l\001\345\016"
+	.string	"\366ZbF"
+	.string	"\221(\035\233\267\030\025i'\203\250\267\270@\277\362\261l\256\262#QX\267|9\220\331\227\247\2679E_\022\245\213\3207\212\r\350\301\177\260\354\377\377\367\322\322z\370Q\016\312\f\255\031+\361B\201|\262\211\334)\005G"
+	.string	"L"
+	.string	"R"
+	.string	"\363\333\271\264\237\342*\300\2572<\300\256\212\306\305\256\030b\006\334\247\305\017\330>\271\013\330>\r\3324.\302\254\201\0233\027\231\233\335\355\224\304\301K\320\377\370\216\020e\272\344<\330]\313\020\365\341\326\333V`;\202\375\233RG\330\327vw\255*\373\253\237\263I\353\224\226\232\364?>d\314\240\236\032w;\314p,l\2760q\326\357z\353\243=X\\\006\274\253\364mY\316F\f\007\b\257\216\213_\001\236\265\322\331\030\373\224,&\224\355zX\360\351\006\334\003.98\225\252\325\264\2408\311\231\271\335\035\271jxq\335X\001\220\034\375\353\255\022.d\"\037\032\304\346\005\266AM\376\3534\037\202\330g\336\242\344\227\370<\020\363\214\355\323FyMX\343\343G"
+	.string	"&\264+\274u\301#\234S\nF\b\202E\316l\321\024\023T>\232B\"Q\022H\345\304ca\263'R\"\n\221|\236\b$\001\303\3671\361<'\237N\024\362\240t\336\210\324\211\200\370\243"
+	.string	"\032u)\3377\352<\304\275\266\2522g\023\002\306\242'\257\260J\332\256\b\007w\3752\226\234\271#u\374\n\304<^\002\251\252!\001\" p\202\221\272\365 \352I\241C\013\214\001?.!\303\025\233%Z\032\313\312n\002\302\314c\372\017\325\r}\226\314\272\203\f<~\001F\343n#"
+	.ascii	"\212v\221BC30\327\005\r\255\210\300UJb\034\227\355y3M\344\355"
+	.ascii	"+\020\311\213\313\220\001"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.39.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`\313\001\r\021"
+	.string	"F\037pH\340\262(\035\302\341\340"
+	.string	"\203$\214\305\240nYe\256\313\305\220\256d\240B\004\227\247\210\272\303\177\t\200=\333\361E\036\376\327\316\223\237k\343\335\033\016ct,\320\207G\037\004\260\205\220\017\217#`^\325\372\333J\376\226)\005U"
+	.string	"W"
+	.string	"_"
+	.ascii	"4\366qi\367e\007\317\356\242\fa\336\023\021]\355\273\370\213"
+	.ascii	"\3603"
+	.string	"\036N`7G\203gwD\371\301\274\347\361\006F\367\346\013\214\3569\264}|\214\331\0042.-5Av\367\2230\017\257\241\177\335K\342\215v%I\330]\253x\033q\313\333f`\373\202\255\025\002\366g\376\222\252\347i~\222\252\345H\255\236\372\003\002\350\340q;ng7\304N\310\376x=+n\363\347\330\327\261M\377\315u6\341|F\370\234\331\327\266sH\246\204\205yOq\034\\\306k\302\333\254\234\026\307\336EH\306\204\320\256\210\221{\2460\357}O:>F\370\" \033\213\271\273%\227\037p;-f\004\350\224\245\233\223\331BQ\335GN\330$\315\363\366\031\221\344\224\327y\t\006\005\356\207m\250\246;_\3476\300\005A\257\361\236\231\257\342\236\202 \367P9\220\b\344:\360@\214ho\370\215\314%\244\032\356\206H\202Ew\366HS\231\302\276hw\3272\027\031d*\031\203\231\310\230K\006N"
+	.string	""
+	.string	"c\311RR\034F^\221\234\270Z&\340\312\305\302\320\001T\241\254R)\252\317\325J\251|\253\027\354#i`P\003\353\365\305@\360\365\231\306\275\314y\346\200\361\303\"k^\261\231\211v_\"<\347\027\242\321\235O*u \202\240\324J/Z\004\204\244Y\245\224\250\226!S\252\f' `\2021\204\325\003\024\202\201\251'\037\360G\316@\0011.y\206\2146\303\310a$\021\200\217I\n"
+	.string	"\303$J\241\021\303\210\313ah\373\272\203\016<\276"
+	.ascii	"\304\320\335\306\274\222\201\234\026\225\266\0037\206\304Eb\026"
+	.ascii	"\216\031UJ\360+F|\335\3552>\213\205\027\"\315\247\300\\^\264"
+	.ascii	"\206\f"
+	.text
+	.section	.gnu.lto_blackboxWriteU32.40.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`^\001\305\016"
+	.string	"\346\032bF\360\260(\035\332\034\243>kzU?\310\274\212c+X\337\365u\370^\271\231\335\371 \213>\3139\001.\372\022\241\243.\356\324*\252\300_\331\322\f<\003KT\252FpZ>\231\237\023\323\375A\230g\263\233\310\235RH"
+	.string	"K"
+	.string	"S"
+	.string	"\227\337\320\243\375\023G\361\275e\301\240\335\231\024.vw\304\t\270\313\220\007\360\\n\007\340\271\364g\357\334U\263\004X#bB\034\273\333\251\210\177\217\237\377\360 p\225z\3740\330]Gp\325\341\326\333>`\333\201\375\031\001QC\330\337vw\2554\366[\377\307\023\2552:n\321\377\370\330\321\260\272\f\316\356\206\232\216\225\311\027%\376\372c\207=\264\207\355\030\352\013\263\317p\203E\242\001wi\273\256\342\373\313%\2641\366\037h,\033\332.\007\004\227V\300\0051;8\215\272\345\300\230P\305\232\271\335-\271^"
+	.string	"\201\223\243\005\022?\372\233\303N\270\022J<h\021\035\0302\f\232\362o\336b\032\230}\305Y\240|\233\313\002\263\313\355\246\341Qy\016h\343\341\024P\003\332\022\016\243\340\222\217JF\006\350\341%\326lW*\020ZF\312\262b\242\244\226\024\321\004i\217\344\304T2\231\236\211\364\240\302\034\241x\242\224Qg*\211T:\357\264\322\221\210xF \235:\2269O\235\207k\277\255\322\230\323\251!{Q\225]^\250mwf\301c?\355\025k\016E\r\347\200\231\310\013\211\252:\022  P\202!\345\330\003\240\352\211\320\241\006\206\001?.9\3035\233%Z\031\313n7!a\3461}\207\352\204>;\263\216A\006>}6\242]\257\021"
+	.ascii	"ESH\241\241\r\234\177\241\241\035\313\317\027\277\b\261\\q\341"
+	.ascii	"\232\n\360\362\242\305d"
+	.text
+	.section	.gnu.lto_blackboxWriteFloat.41.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\245\b"
+	.string	"\346\220=7@\217\322\001\203\364?\241\273\307\243\234\261v+\242G\307)\240\353}*\177\334\254\345H\265\311h3V\224md\214\243\350\030\335\275\335\330\357\002\260`Kk\t!R\246\024+"
+	.string	"."
+	.string	"*"
+	.string	"\017\330\256\331\263U\356\342\330\201\017\220\324H\313\356B\335\270\367\364\374\267\316}\252\3233\203\260\273\316O\205q\353m\023\330>\260}\022\3174\235\231~\006`\245C\365\214\224\335\213\030\314\2764\023\217\215\355\247\375\220\213xg\231\304\334.J\253dw;6\320\\\343\\`\273\226\005\\\246\332\361!\377\231sM\355\244bP\031\363\226\231\332\246\211\374wM\026\230\313\313BO\266\353\224\252a?\333\335\265\256\354\263\036!\323\350#\241\271\363,\220D\n\261#\205\022(\"\210\241\373\214@\220$\3724\300\256\004\001=\005\216\016\241\022\214\210\261\0047\256}\266\272\262\006\366\362Bi\205\003\n"
+	.ascii	"`\251'\023Z\373\002\303E#Q\341\035L\271\004\333\254\246\200\273"
+	.ascii	"\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxEncodeTag8_8SVB.part.0.59.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`z\002\345\022"
+	.string	"&\241tI\360\320&\035\370|3\233>/\036\314\021,#\320\037!*\320f\237\346)\373\212\024\037\224\013\n:\225\215=\255!\300+\2560v\307\027:brK\360\312z\222y\030\327\374\272\310\034\016XH\337\377W\226\225Z\333d\357\224\002Z"
+	.string	"^"
+	.string	"b"
+	.ascii	"\037"
+	.string	"h\236\323>\212\247\030O\243r\216]\227\236r\227D\360\352\004\335\253\311\023(\275v\037Pz\265?c[\244y\264c\234<\261\267\301l\2709\332\335\357\225\232\370x:\271\321\347\271\307\214\330\351\313s\310X1\312i\001\361\331q\316\304`w\335\205\270\353m/\260-\301\236E\001\267\275\264=\273\336c\223\213\241\335\365\\\246>\216\350\357\234\307\236\r\022\"^G\234\020V&\242\334\335:\355\2578\213\3619\016\352\330s0\262\301\334v7B\367z\342\256\302\336\253AB\306\337\\\350V\306\204S\213\271\355\222\007^\335\2403\235\267\251\201\321\032\030\r\005s\236\024O\243R\200\334/2\204~\214\017+\275N*R\303\326a\204l&M\372b\312qK]\354\223?g\232\246uz\336\346\177\347!Bb\327C\222\215-Q}j\337\371\201\376\241_\347\234\375\026E\256B0\216\206\210\204\204N3\001;\253\021\311"
+	.string	"\275\307\017\372\021}\232\221\333B\303\361\177\354\3718\250\213\321:\035\033\315H\253\277X)\241\003"
+	.string	"-P\205\002)\224\\`\312\t\312B\351\345RQ\247>JX+U\230b\201\0230\204$&)\324\t\311\307Z\241P\276T\313\365}\030pX\001l}\2570l}\363<\177pc\221n2\272B\351\213\355"
+	.string	"\223R\016,\231g\361I\003\215\331\233\223\372\245\t\312<\013\245/?2S\"\335f4f?> \220\002\231\032\264\r\207\b7\255<\325p\036FPX\024\003\272D\276\253"
+	.string	"!\312\303\374\256\321\241lg\305\356S\272\002\214\223\022l#\254\200u\013\350\234\023\026*\331\252\237\203c\tlUZ\360Z+t\001 \034\030\3008\356w\021\362\242\335\035\312<\030\367\0063\r%\254\017\311\224\300%\342ubz\003_\333\002\330\341\277\036\256\001\005\2124\006/2\026I\312\241e"
+	.ascii	"c\362R\263\200\366F2\033D-=\341\215\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`\215\006\245\026"
+	.string	"\206\341|K\320\362&\035\350\031\375\226b\304\263\361\033\316fo\225\20303\221\311\005\340\265\350\250\003\335"
+	.string	"i\020\\vn$\213Fc;\037Xx\301\025^\362\344\357\025\262\004\035$\220Fj\215\214hm\367\324\237\177ck\3130\214X\222\210\334\001m"
+	.string	"b"
+	.string	"l"
+	.ascii	"\255\022\240Sh\032e\246E\231\306\305\364\r\246\303\227\246.\r"
+	.ascii	"\266\364\tK\333&\017\246\240\031+m2\233\222\204b\250t\215\355"
+	.ascii	"\317\222OJ\323\030\350\202\210\n(=\023\273\004\327\262[\307\302"
+	.ascii	"&\251\271\234=A;\007\005\316\007\0379\300\206\321\023\231\223"
+	.ascii	"\255_]\256j0\351\221\257\346r+L\314\331s\302\370a\257\326Ze\355"
+	.ascii	"\352\346\234(\237\347K\001\234kx \3472\0049/y\2503\031\242\236"
+	.ascii	"\300\373.\206_x\372\350\235\376]\352\275\005\023\005\f\324\373"
+	.ascii	"\307\267;\227\335\231\354\316\026\354\256#\326\272\357\230\360"
+	.ascii	"ul|\361\204\277S\233G\3207\007\332\306@\323\344\364L\201\216"
+	.ascii	"!\320-8\3752\240]\270\326:'\370C@\303\360M\263\330\364JM\f\354"
+	.ascii	"\002\220\244\225\\#\364\242\211\256\036+9\264\201\364CWW\225"
+	.ascii	"tuV\272I$\216J\243\"\242;d\271\203m\222'\215\036\313\254:O\331"
+	.ascii	"\300\236E\217\rTu\220\244]\236.2\244\240\252\277.\363\b$\252"
+	.ascii	":\033\335\"\242\241\2229\364\204\333#\301B 9vd\001\004M\375\201"
+	.ascii	"U@\216%X\2732\362U\262\355\206\n%\232\nsd\257\326Zg\264\2137"
+	.ascii	"\332\354ck\366\317\226\234s\254\222\363\305\311V\262\363\305"
+	.ascii	"\305>\252b$\037S$G\341`\377H\230\353\365r\215\214\270DD\316\027"
+	.ascii	"\347\372\350\271Z!\027o!G}\226I\035\366j\353\255%\217\365\026"
+	.ascii	"\311\034t\264\003(d=\305\372\310-\017!J\234X\217@2L\206\016\034"
+	.ascii	"tu\036\0077\200\205\2501$\315k'MI\245\\\f\020\003\241\031\247"
+	.ascii	"\003\021@\f\215a\350L0\321D\262\320\001 \334\355\365\034\210"
+	.ascii	"\361\200-0\311\311A\353\361z\375\307\244\354\006\f8\331u\236"
+	.ascii	"H\3340\211\277\264Z\177-\355\2352\342J\247u\364\364\364\0133"
+	.ascii	"\222WG\363Y\031\332\353P\305\272\275F`\375\004\r\350T\257\352"
+	.ascii	"W&|\001\030_\313\361oe\213\212\177\025\327\324c\323\004l\210"
+	.ascii	"\353\003\274\333\210\263 \031\036\022\256V\373)\316`\267\274"
+	.ascii	"Q\220%\314\266\220r|\353\247\252k\222\217\312\227\302\017K\316"
+	.ascii	"\276YH\360\266\235\203\227\223\031\265Db\214\312\021\241#\311"
+	.ascii	"\261$\201\355P;\204\316\314\251\236\271\200\3119\241\235\030"
+	.ascii	"Z)b\236\250\252\247\320Pt\370\2019d'\004\025\341?n\240\200\204"
+	.ascii	"^G\025"
+	.text
+	.section	.gnu.lto_.refs.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\001\001\002"
+	.string	"\002"
+	.string	"\003\002\002"
+	.string	"\006"
+	.string	""
+	.string	"\003\t"
+	.string	"\001\003\f"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b45ed8f7145867f0,"e",@progbits
+	.string	"(\265/\375`e#-\215"
+	.ascii	"\n\330\364/O0R\312I\007\353\272\377\251\376\373\357\356\357\353"
+	.ascii	"\277\377\257\273b\306\356\236\273\375;*\306q\237\210\307\177"
+	.ascii	"\334\231\205\243\272\366}|w\375H\n\372\200P\334\007\214\271;"
+	.ascii	"3C\314\314\0203U\271\304Z\304\034\205*\"\255.3\377_\f\325\"\331"
+	.ascii	"R\246v\002\345\002\006\003\255\356p\211"
+	.string	"\242\f\223(\362\223\343\031O\265*l\342j\365N}\342\373\003k\365\\\307d|\307sg:\266r\035\351\275R\356\275\3470*\034w\243\034q\257\225X\364^\351W\374\307;\256\302qV\272u\257\225\024\216\222\017\211\320\360^\251\316\003\017\250K&Z\254\024U\276\\\242\230\343b=\n\353IX\343\246s\203v\255\302u^\235\216e\253\354\306S\230\354\004\277]\005\005\267J\263\033v\257\024\307\006Q\t\342a\253\357`=\237(r\"\237hcc\270+\261\034\255r\024\226\302d\004p\332Y\215\327.S$\225Jo\302\3445}i5\207K\024\333\202\325\207{\231\200\"'&2\001hPV\364A\211\266\312Sn\302d\207c'\347'|\366\031#\251tZ\343\207vG\330*\002\\\242\250\256Xs0\362\341\212?3a3\313\324\361\224\216\220!4,\024k\225\311\330\354g)\227\335\256\346y\257\321\275w"
+	.ascii	"\021jNODZe\035&Q\024\300\354R\360^\217G0\016#QlBI\357\331\275"
+	.ascii	"\027\207\311\016\313\344Z\275\224K\024W&Q\344yq\305\032[$&\036"
+	.ascii	"\371N\314a\017\207,\024\022\362\360E\005\266\343\272\003\360"
+	.ascii	"\267`\tL\347\245\313\237\221\277\373=\200\277\363\370\372\350"
+	.ascii	"\364|\332~\236a\316\347\311\317bU^g\345?\334\377\274\237i\310"
+	.ascii	"~nA\345g/\271\023N\363w\222\"\024\304\275\304\337?o6\177CW\270"
+	.ascii	":\343\267\327\374\035\204\216\b\3165\035\266\343\374\235t\006"
+	.ascii	"\003\224\337\374\375\200\333\317\\m\027\3617\016?\033i\3403\177"
+	.ascii	"\277\300\320\265\027\360\267\223\332\317A\322~\276\372YJ\024"
+	.ascii	"\264\237\313F\374]\301\317Hd\377M\320\370\372w\003?\217\375\234"
+	.ascii	"\344\347\256\237\265~\306\372Y\310\317\317\237y\374\234\364\363"
+	.ascii	"\362\347\037~\356\341g\036~\326\341\347\033?\333\360s\215\237"
+	.ascii	"g\374\354\363s\317\3171\374\354\302\317*~^\341g\023~\026\341"
+	.ascii	"\347\016~\306\340g\013~\346\371\031\202\237\027\3709\201\237"
+	.ascii	"M\374_\373\177\302\317:?\007\3603\211\237k~\236\371O\343\277"
+	.ascii	"\336\3172\377\371\376\263\360\263\372\377\354\347\377\027\363"
+	.ascii	"\277\360\277\227\377\177\377\373\376\357\375\317\362\377\356"
+	.ascii	"\177\334\177\266\377P\376\273\370o\366_\203\377t\377\rHLLL\374"
+	.ascii	"\215Q\277\372\364\353,\020\3130rCx\016\310\216,2\037E\273&1a"
+	.ascii	"\324\252\310\272\212\367T\263\353L\241\212\223\227\341\275P\020"
+	.ascii	"XP\246\365\367\264JI\365\324z\245\314\204\311\23615e=\337S[V"
+	.ascii	",`\203@Z\355 5UP\322\232c\326\037?:\212/\363^\250k\375\002\241"
+	.ascii	"vDd\251r\013\323jG\301\025\233\350\374\304\224l\302\264\370\354"
+	.ascii	"\266\254\375\324@0\331NC\341\314\354\t\0029\323[\317;E\234\235"
+	.ascii	"b\217vrN\377\330Z}3u\323\273I\326\315vZ\245\267\251\005\225\034"
+	.ascii	"\206\206\027\252\271\363\367\216\267\323\267\324\\\0236\211f"
+	.ascii	"[\270\264\332\316\007\212\370\303\372A\330G\275\305J\\\225\327"
+	.ascii	"\372\376\213\267\250y\357\335!#\275\315eM\221e\230w~\033\266"
+	.ascii	"\254\300\177\365Z\001\006\357}:2\270v\255\025\005\201\300\375"
+	.ascii	"\272W9\342Jo\2239\245R2\233`q\216\220\336\251\001\356\324\352"
+	.ascii	"2\245TN\365y\373J/_#*\247\rL\351\263\311\224>\2259\327\350\251"
+	.ascii	"\274W\352\314a\236\025)\2319\245r2\247O\347\210kt\225wZ4\265"
+	.ascii	"\032=\235L+Og\016sZ\344d\032Q9G\3648r5\206\203\b\025\026;\231"
+	.ascii	"F\227i)\252\250\231s\205)}\336\276{\371\f\3516\025\2707\352\331"
+	.ascii	"\354+\002\202\331\226W\230\226R\212\236L\300\322\262\352y\215"
+	.ascii	"\2560\217<\357=\262\234q\227&PJ\257\\(_QZE]\035H\367\026\260"
+	.ascii	"t\257\222\357\225{\257\362\336klFI\357\375\221\303\214.-\335"
+	.ascii	"\013\245\263t\243\224mH\367\366\231\037\233\2239\255z\036\333"
+	.ascii	"\234L\2437I\252\344\350\355\243j\256Se\331\325!\270F\235NC\364"
+	.ascii	"R\353\260)\322e\266\354\034:\314\204e\312\230V\317JJ8p\300x\b"
+	.ascii	"\311ji\330L\333!\222\036\2556\222\375A\fR7\263\223\336H\227\342"
+	.ascii	"\030\373\276\230EE\265\227m\364>\352\242\333G\023<\357-\352#"
+	.ascii	"\0341\367\026\3410'\300\234\200\272\244J\013\255\250\236\217"
+	.ascii	"\224}\257|\005\211\266\372\276\237\332ly\223\026i\225\021\217"
+	.ascii	"\347\304\013\210X-i\325\216\021S\254\352\363c1?\207\341\303\033"
+	.ascii	"(rVv\264\332\016\030\036\317`\254\327Z\226$\255\356|)\024\021"
+	.ascii	"U&E\260\325s\341\317\203L\330K@\303\264V\177\306%\2123`\307\263"
+	.ascii	" N\336\032\241\221!\274\334\364\215\201m\265z\366\3623\027\356"
+	.ascii	"\222\201\224\326\264\325\367q\211\242M\340\361\274\205\306.\256"
+	.ascii	"\013Y\2535L\002\360\017\251\f\bV\253\347\277KG\3145\203\264\252"
+	.ascii	"\342x\366+~\275M\201\321\322\247^m\251\201]\351\020B,\235|{Z"
+	.ascii	"LZ\204w\n\225SB\365\262\370]\251\035\265z\316\3623\026\316c8"
+	.ascii	"\032x\207\034\225VE\300%\216\350\217\333\347m\220'M<( V\ni\013"
+	.ascii	"lJm\265A\330\250\025I\213\326\227\361\254\201\231)>\002\023\243"
+	.ascii	"\207YFZ\265>\036h4F\006\244U\013\325=DL\261S\302k\325\002\321"
+	.ascii	"J\253\221\324\336\230Ql\305q\273\204\303\362\220\021\273w)\201"
+	.ascii	"t\331w\231P;\306\302\301!zN\267<h\230^N\222\330\0352M\332\350"
+	.ascii	"\n\355\016\353\254\301;Bdj\325i\231l\223\246KS\242\263\351\237"
+	.ascii	"\241a\263\352\322\225\265\336(\265\332\034\267:\334\244\256\250"
+	.ascii	"\236\326\337*\241\355\005at\2567\336\365GG6\211\315\016\260\342"
+	.ascii	"\344\365u/\324\216\214\332R\317\210E\272M\332\"\003\346&\005"
+	.ascii	"\002N\246\252\020pm\b\253\264J\273\354ZbS\325\245G\305\026\335"
+	.ascii	".;l\232e\351.1\261\363\240\321U\b\264=\037jc\306tAEW/\312\213"
+	.ascii	"%\311\341a\023R\331J\354R8\370u\370\374\362\245\301t\324\370"
+	.ascii	"\266\005\330\305\370\245P\351i\370\006\003gtn\025i\026\227\202"
+	.ascii	"\202MH\367\f\274[\032|\023\376\325\021\2721\237\315X\224/\016"
+	.ascii	"\220\013\227\366\302\367\242\231\220\203:\353\362\366\302\205"
+	.ascii	"m\b \235\237_\007\202\031\205\370ei\002\276\003\327'v\206]\255"
+	.ascii	"\366\037kQ\345\350\332\356\230\236^\367\361\275Y*S\024\350\025"
+	.ascii	"\276w_\r\335\022J\331j\3571\337L!\327 b\025\036^\347\361m\006"
+	.ascii	"\321\033B\226\204\345\235\307h\027*Kf\251\356u}\307P\027l1\315"
+	.ascii	"\360\300*\253b\367\276S\363\310\366\372\b\251Pi:1\321\376\242"
+	.ascii	"\245Do\356MW\245\007\020\036\255v\225\206\332\310)\311\r\256"
+	.ascii	"!QS\202\206\027\027\327`\\\376\242+\036\217*\244\265\267\267"
+	.ascii	"N\213\202x\004\204\310\224$kk\355\006\315\221\303\320\360f\213"
+	.ascii	"\353\371\326j\273\301\331\264!F\235Zm6\037hh\235\266^\275&\233"
+	.ascii	"2A\304A)\357\264(\252\262I\223>[\225\210s]"
+	.ascii	"\372\f[\355\263\264&\245`\253\355\244\241*\023\215\252\007\367"
+	.ascii	"\335D\007\263\224\\\310\310\232\t\227\250\210'RC\002\315\336"
+	.ascii	"L\0300r(\244\325."
+	.string	"\223\341\322\274\322j\265\245\334f\004\343B\345\254m\025\023k\256\234\273\314\353\213\312|\361!x\004\311\372\365\325`ys6X\270\264X-y\203\341\004\016&A\265\332J\032J\203D\020\352\344\275\242\226#SIRk\221\356*\322^\305{Y\372lj\"y{\311h9\222&\245\325>\322P\373\005\006]b4\034\303#B\316Z5b\244\271\3706\271`\3450\374\302\3211\305\n\337\326\233\353\246G\023\332\223V;\332P!t\312 \255\266\026\2431\364\257.\355pj\2176\260\272Vo\221\3267\337\325U\023Y\357\025\263\200\n\2307\2547\221\031DC,aZm!\r\345\243(,\300V\205\240\211\376\020\034\3239\214O\001\311  +\3031\206\343\f27\340\030\221I\244\007\311\240\021\204X \372I\352\300A\222\b\351C\3423N\310@\356 \003h\207\032\026-\320\310\b\002\032J\272H\016!\223D"
+	.string	"|\006\n\033\006\020\021\375\370\370 \2132\034cX1\203L\022YcH(F\217\215\030I\021\b"
+	.string	"\275@\366\334@\244\003Q\216\fd\262'I\004D\243\307\006\007\241\241\031I\241 c\f\344\017\r\025F\320O\017\362\206\236 \240$\r\240\033/zzrl"
+	.string	"P\261\242\005\001\0040\301s\3141Q@\211$\320\320\013I\244\020\r\020H\250X\321\302\b\236\243\213\tzX\374\320x\201\004\032B\272pB\305\n\027+zT\360\034G\360\034O\350\200\034\032\332\300"
+	.string	"\027\002\f \001\212\344\020\322\006\n\016\\p\301\242\207\205\f$\013\007p\340\002\214\237 \031@DA-\374|\360\031(\204\200\024H\376\310\200q\203\203"
+	.ascii	"~\202\200J\030\372\201\201\374\021A'F2\bh(\205\233\365;>\311"
+	.ascii	"\0336zd\356\0034\364\023\364#c\375\004<\021\360\260\310\301x"
+	.ascii	"\026-$h!A\361,Z\034\217-x\216\353y\2166\211\234\341\243~\006"
+	.ascii	"\212\0307^\324@\376\f%\211R\004\t\325\250!\344s\300\205l\374"
+	.ascii	"\f\245H\n\t\r\245\240!\352\211q\343\005Qq(i\303\302\b\372\261"
+	.ascii	"\311\036\026\311 \240\033\306d\017\3171\331\243bE2\b\310\370"
+	.ascii	"\343\261\003\004Z8!\204\325\007\205\214  \030B>A?=9\b\275\250"
+	.ascii	"\301\007I\343E\212  d\215\024>CD)P4\200\227g\277\310\271!]\341"
+	.ascii	"Z\231\246\356p\334\271\315\034-5Q\262u7v|{}\255~\306\311J\032"
+	.ascii	"\335\335\024\020\314\230\2711\021\1778\334\336\2524X\r\222&\304"
+	.ascii	"$*IZ,\254\311\225k\2575<.f\253\026\316\276\331\270[\270[\245"
+	.ascii	"\324\3021"
+	.string	"'\320]R\234\020\213S\232\210\315\224A;6\267\256\232\272\247\271\035mZ\205@\264\330\260p\272\030\022N\327x\254yR]Y\324\236E \006\211\344\245\231\321\030\246\361])VHq\312\351\020\212eb\231X\264U\311\302\3166\271E\273\205b\247J_\230\316z\013\n-k\325:\261O\214L\250\246\352f\226\032\270\251\302\004\0236]\307\254\266\214\306G\220\271@B\251M2\234\323\303\321\252\022%v\254\316\311\313\020oH\231\021+v;f\303\303\210\016\255U\273\304\206%\206I\234\3320\013f\225\304\006\327j\232\232\210<\363\220 \261In\215\256\224\222\250\321\254\r\007\227\327m\022FZr\206\270\256mm\331\256\342\223\251*\267\026|Q\004\271n\273\332\207SX\326\030\253\254,\253\245\363\264\200hIQ\206<\004\225\022\034\326\310\255\226\221\210\335\325\216Vm\221\206\036u\211y\256PB\ba\261\330\354"
+	.string	";'\257\257\233\301'=\304X\350-\026\334\227#\203X\255\204\223\3440\307^\253_\215\250n\255\250\254\020\2311\373\344\304n\356\352V\310\215\337\020\312e\253ZcVw\255\332*/O\377\223}\262\331m\n@L\2128g\030\203\t\250\202\0011\206\022\031B3$\"\"I\222\244\003\"\013\020\204\002\201\234\346\264\003\022`4%\224\"\247\f\251\022\031\221$%\005)\f\273\001\222\211h%\303\n\211\326\277"
+	.string	"#j$~\202\021\276er-\272\211ydE\350^\232\30654+=\230\344R\002j5\274\203i!\322\247T"
+	.string	",e\005\233R\232\276u\274\304\372y\200\355\006\033=+1\017\355\355\351\327\242\230\007bb\377F7ev\001G~\312\303\210\202v\357\315\236\205\024\344\004\353\250\031\025\213eF\301\226`\361\373\223\362\t\221s\326=zt\0345\342r\254^l\364fv\235<\244\2108\362\nZb\301\202\367\"a@\333\226/\241a\257?\232F\244Y#\255\216B\343\\Ac6\320\201F\201\345\276\237>\255\362\244K9\034fO\025quC\237\026Q\212\367 G\263}N\233\242\230\316\265R\025\334\375\224\030\257\216\247\345\n\220\372\253\256\273\311\270\333\243=\253\307b\\\332C.\202\240o\33369\260UQ(\225\253Z"
+	.string	"\242\325\367h\217\312x\205\316\200s\253v\305!#\024\006\025\234z\367\242\r\205\261RX:\265C\240S\231\201;~\265\373\t\\t0\377\021\262\355\300-\370\255n\201+}X\224J\243\261\374\374"
+	.ascii	"M\022\220\310,\361\031\247\301+Fv\353;VK\233u}\203\027\027\005"
+	.ascii	"\013\213'\033\022A)`\272\025\222t\214\b:A\265i\311M\023\365O"
+	.ascii	"\274?\226\216M@T\003CHyB\300\f`\302>\3024;\320\003y\372D\340"
+	.ascii	"K\n\231\216\006\366\214\240lC\004\257\265\264\332\345\257\202"
+	.ascii	"t\272p\247\352Wx\221O\345\264f\177\001\225`M\020\022\327\027"
+	.ascii	"\240\22720]\270\32455'\271\223\221r~\020\341\351c\352\211\300"
+	.ascii	"#d.j\356\177*\\)\030\320am\244\262\2370\330j\025\027\233\030"
+	.ascii	"4Q\315\245/E+\363\345\3308\221\f\356\235\322\322\374~\32168\204"
+	.ascii	"\004:\277\275Z\360\344j*p\245J\b\325\264P?\310N7\323\373cG\235"
+	.ascii	"\363\020\223N\361e\206\213h%\036\032\354x+t\255\2740y\243O\361"
+	.ascii	"<\177\033\033\243%+\350\300\206}0~/n\242\"\2722\342A\352j\252"
+	.ascii	"\261\372\241IRL\2144YR\222%\312~|\nA\273*|\031\313\255\225\302"
+	.ascii	"5\331;\332v\377dM{\354\322\206\216\222D\252\007\213\210\024\007"
+	.ascii	"J\245\370\255\227$\221\027\222fqU%U\372+\357l`\260sP\027\005"
+	.ascii	"\273&\244\217\350#\247\362\335'\315\273\256a(K\266\214P\377\031"
+	.ascii	"r\377\316^s\334F\257\027\001\232\243*D\26078\361\314\007S\n\224"
+	.ascii	"U\317\037\020\234\001P\304P>i\333\271\323;d`\266`\212\252\006"
+	.ascii	")\262E\035A\353H\210\364\210\241\212\234\210Z\367)F\306\026\210"
+	.ascii	"!<\254\273\002^\005\320\036\235\177\311\\\306j\360`Lb\002\222"
+	.ascii	"B\263\200\001aC\307\032\001\247H\b\356\020\254\230SkN\031\356"
+	.ascii	"6\025\213e\243l\236M\310\207\241\277\270/\342\216\251\337\253"
+	.ascii	"q\303\321H\3532v\003T\3247f\352&\210U\2052/\222\215\310d-\027"
+	.ascii	")J\361{\370U\304HI\270z\177\203\252\314\006],\227\340\203\020"
+	.ascii	"\007|\266\202A/\223dN\306U|\201\301\035M\300iK\251\360\324ZZ"
+	.ascii	"I\bZx'\276\366\260\365@\240\020\206x\244r\212\030\275<\222S\212"
+	.ascii	"\366\344\230\003\317"
+	.ascii	"A\374\352\342fcg.E5\326\342o\370&t\007\240\316\221\354\205\r"
+	.ascii	"D\f0h\242x)\333i\f\233U\331e_)O\017\272\217\203\022\302A\312"
+	.ascii	"j1\004\234&=9H\032@\340kP\006/X\356\206\223`\347q\252\201T\250"
+	.ascii	"\361\367C\005\025\214-\323%\253\213\235\311^\017d\351\276\204"
+	.ascii	".\242\200\033\003\375\212>\020\177o'\346\354\nU\017\300\261r"
+	.ascii	"\340\217\023L\245\n\306uWm\273\037\205u\372\341,\377\034,2\221"
+	.ascii	"h\021\212z:\237\003B\2048wyd\231\377\212a.\334a\360\3104\314"
+	.ascii	"\334\321\266\240 \267_o<\327\333V\301\376"
+	.string	"\f#s\204\235\031\211\034\227\353E\376n\344\364}\325\355\263\247I\271T\334\235\"\361\317\346\224\017\232\210'\203\347W\257v,\343\303\375Z\001\227\346{\230\0055\\nN\273\021\215r\023b\375\250\376\215\254\237\205A\232\007\037\361\323\322D\242{8i\272}\214\305K\350z\302\3657J\337\236\316/\320\025\3329\277O>\256\220s[\372\300#\227\340\375\021v\032\317\276\273A>b\2228\r\374\241<\024\226_\274\"qY\307\360\363_\004\252\225\370J5\020\360\2034\337\002/0\335GB\276Y|\236\270\"\033\265;\305\213c\244<Dr\341~\243x}\356%\313\323\023KA\274=\232!\177)x\302\344\251\236\365\220\255c\373\340\370nv9H\217B\321X\354@\277\003\310<p\271\376\340]1G\347\246d\177q:\267\321\202E\357\020t\225\336o\204a\307se\3453c\270k\214\202c\272s\356\341\370\221"
+	.string	"6\036\245~\240\223u\273O.\303\313_\034zn\274\023\372_\336;\310\273\204;\211\347s\b{\213\353\344\375\r\262\373\370o\177\f\371x}I"
+	.ascii	"o\321\311\316\261\354][\361\251~\323\264\273\022\037\007\037"
+	.ascii	"\274\316B\037g[\345\276Ko\3268\353\277\367\205\370_\351#\354"
+	.ascii	"i\346\270\\=m\355\303LZ\001"
+	.text
+	.section	.gnu.lto_.symtab.b45ed8f7145867f0,"e",@progbits
+	.string	"blackboxPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"blackboxEncodeUnsignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"blackboxEncodeSignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"blackboxEncodeSignedVBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"blackboxEncodeSigned16VBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"blackboxEncodeS16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"blackboxEncodeTag2_3S32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"blackboxEncodeTag2_3SVariable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"blackboxEncodeTag8_4S16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"blackboxEncodeTag8_8SVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"blackboxEncodeU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"blackboxEncodeFloat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"blackboxWriteS16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"blackboxWriteTag2_3SVariable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"blackboxWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"blackboxWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b45ed8f7145867f0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
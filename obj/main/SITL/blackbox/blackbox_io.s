@@ -0,0 +1,1522 @@
+	.file	"blackbox_io.c"
+	.section	.gnu.lto_.profile.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\235\013"
+	.string	"4\021\364\001"
+	.string	"("
+	.string	"\335\316\320\353\003\022\002"
+	.string	"\001\002\001\002\002\002\003\002\004\001\240\342\234\212\n\002\005\006\272\304\332\276\007\002\002\005\002\005\007\352\263\360\321\b\b\352\344\207\261\002\024\005\002\005\002\002\003\t\n\367\203\200\352\006"
+	.string	"\013\f\326\221\301\367\001"
+	.string	"\r\226\223\225\252\r\002\016\376\201\211\336\n\006\006\002\006\017\020\256\375\321\353\r"
+	.string	"\021\361\331\227\256\016\002\002\007\002\007\022\023\342\326\223\246\n\004"
+	.string	"\002\b\024\311\231\247\372\017"
+	.string	"\025\223\230\223\352\013\004\026\263\363\245\275\016\t\002\t\027\231\234\240\352\005\030\274\205\242\255\006"
+	.string	"\031\222\345\311\225\006\002\002\001\002\n\033\204\372\265\211\b\034\233\312\344\255\f\022\002\006\002\006\002\001\002\013\002"
+	.string	"\002\f\002\r\002\013\001\002\001\036 \361\307\257\255\n!\222\252\354\340\007"
+	.string	"\"#\267\344\272\254\r$%\307\276\344\257\003"
+	.string	"&\330\370\241\354\t"
+	.string	"'(\246\227\274\312\003\004)\352\326\271\264\013"
+	.string	"*\266\310\363\237\013\n\002\016+,\327\316\273\360\002\004\002\001\002\n"
+	.string	"* `\002b\212\324\003$\302&ro\017\352\nA\206\224]"
+	.string	"\t\203Q;\252\277BX+\247\370\370/\355#r\r\330\031p\273W\313\340\212\341\"e\003\216\306\252<"
+	.ascii	"\374\355\253\026vI\326\005\303\fb\246\300\306\023\b\275\200\002"
+	.ascii	"t$\340\226A\304\032\234\b\232}\034\316\005\352NrH\003C"
+	.text
+	.section	.gnu.lto_.ipa_sra.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"\365\004"
+	.string	"\362\006\024\032PU\322\0010333333o(\351\021\376\362\204\203\307#\260\325\344N)\226\372\223\263\231\232\231\231\230}\231\226\ne'S\022Q\037\216\3062\312\335\342ZEB\021\363`\210\266PN\002\224\336\003H\237\216;`d\t\364\323\326\353\nq@# @\002C\235\335h\210R\2218A0\256\013s(\306\315!2\306\311\344\352~\227\315\222\371\036@\316@!q\346\013\201\036\344\016&{\226\001W\304{p\001"
+	.string	"\336\262\340>\2640\260\026C\020\\\036\3366F\001\304(\270\245"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.inline.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\226\004-\021"
+	.string	"\244\024\212\005"
+	.string	"\036"
+	.string	""
+	.string	"\034\335\236\212\330\003g\001"
+	.string	""
+	.string	"\002.\335\236\212\210\002g"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	"\002\002\013\006"
+	.string	"\b\200\200\200\220\001"
+	.string	"\001\002\017"
+	.string	""
+	.string	""
+	.string	"\002\002c\003\f\220N"
+	.string	"\220N"
+	.string	"\001\n\b"
+	.string	"\033\350\251\311\223\002h&\303\367\235\342\003f\001\220N\n"
+	.string	"\007\200\200\200\340\003f"
+	.string	""
+	.string	"\201\200\200\200~\004\r"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\220N"
+	.string	"\f"
+	.string	"\n\200\200\200\260\r\016"
+	.string	"\013\272\223\261\300\002g\300\002e\020"
+	.string	"\005\200\200\200\240"
+	.string	""
+	.string	"\021\300\023"
+	.string	"\te\f\024"
+	.string	"\013\257\334\215\356\004d\025"
+	.string	"\r\374\250\270\225\002\003\006\003d\002\241\341\365\321\002b\002"
+	.string	"\004"
+	.string	"\001"
+	.string	""
+	.string	"\026"
+	.string	"\020\373\345\215\301\003i\001"
+	.string	"\001\001\001\002\020\020\337\266\362\246\002h\001\004"
+	.string	"\340\301\257\230\003b\001\027"
+	.string	"\020\365\270\326\255"
+	.string	"\002\020\324\334\203\200"
+	.string	"\030"
+	.string	"\003\031"
+	.string	"\b\314\325\276\316"
+	.string	"\033\034"
+	.string	"-\235\372\312\3154\327\307\271\352\t\022"
+	.string	""
+	.string	""
+	.string	"\007\220N\001"
+	.string	""
+	.string	" "
+	.string	"\b\364\246\342\200\002\200!\"#"
+	.string	"\007\262\346\314\211\006$%&'("
+	.string	"\b\330\307\302\353\002e\n\260\217\205\327)*"
+	.string	"\020\312\262\231\264\024\362\203\275\246\002f,"
+	.string	"\f\300\223\242\333\f\275\224\334\276"
+	.string	"_\250\2015R\202\t\326\330\036s`\"\t\214\235y\022"
+	.string	"\365D\302HD\021D\020\025X \201H \201\210\344\270\0160\003\252\2628\266\330\"a\376\262\222^\3565\234?\241\310\001n'j\315C\213\277\243\264.\342H3\357\350U&\032176\261\270Z\031\357"
+	.ascii	"r\213\246\026\033?\346\312\025\243\314\026\\\263\361\242\260"
+	.ascii	"z\315$\324\200\266\344g\021\036\027\216\320-y\252e_\n\243\005"
+	.ascii	"m\233\307\232\226-\331\231\342\031\352P\372\313\234\241\337l"
+	.ascii	"\200H#H\027\313_\307\262\031u0\320?\232\354\003\370iBCX\333C"
+	.ascii	"A\033\242\247\267B\2106\215\240\003\323\361I\340 \362\"\242Q"
+	.ascii	"\365\345\313Y\323n~\202s\367d{,ty:\201.@q\032t\235\2640\3110"
+	.ascii	"aV\335\271\030"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`-\002\215\t"
+	.ascii	"rO+,pK\222\016\374\377\377\252A\330\200\252\252\302\347i+\366"
+	.ascii	"\270\255\365\377\363\372\032M\244\1777w\261\373\372o\300\266"
+	.string	"\251\205\351}\t\2212\005\177\374\241L\274\304C\037\021\351\223\020\377\360;\374\r\317\360\223\177!\272\252\022\262\tY\331\226\025\326\231\265\326\"\005\373\030\265\250X\302\217\360\037|\204\213\022#%V:\006\252\3519z\f\331\002\n\313E\360\254X\377\302\013\337\260\252\347\351%\322\201\364\233\007\026\240\006\231\301:m\311\200\217\247\376\370\251\243\305H\213\225_@\232\254)\035\345\203\354\243\037\013\360\\\274\252h\252\210\257\230^\"M\3414\t6 P\002!\246\316<\220\b8N\243\027s1\b\021\020\263\021V\231\265\253\tOl\241\205 \273\371\025@\346\006{\273\3678H ,:;\240d!\001v\366\216)~\t\232:\320\b\257r\b\216l\037mF~\002|\341\200\027 6\"3\223\001RX\230][\016\031\341va\\\224GB\204\350\016\035pA\021\251\3513P\"\244b\027lY\034U\263a\275\244\0133\033"
+	.ascii	"\345\252\317,gE\341\206"
+	.text
+	.section	.gnu.lto_.pureconst.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375 _\245\002"
+	.string	"\362\005\024\037\220+\215\001\377\217\340\230 \203\231\231\314\314\001\025m\333\266z\260\357\273\212pB\020B\336(\003*\213W<\212j\342I\274\210\007\361\207;\274\206\307\360\205+\341\b?x\0063\005\027\301\007.\020\023p\200O.y\344\220?\356x\343\2460\263K"
+	.text
+	.section	.gnu.lto_.ipa_modref.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\345\006"
+	.string	"\242\b\033#\220+\303\001\367;\004\376\334\377\240\377\334\343\273\323n\267\247\243\273\021\262\3759\374\256\301n\003\217N\276\224)\277\214\346\022\270\234O\265\371\241\212\226U\276*\245\224\023\311G\036\244"
+	.string	"\327~\245\324\306\317\370\305\353\037\203\016\025\254\234%F\220*\247\332\203\001sa\3027\372\250\234S\371\324\351\312]g+o\235\216r\251\320\223-xz\0023 \220\002!\303z\365"
+	.ascii	"E\202f\023\256\342m\024\344z.\341\360\263\223e\264\021\256`v"
+	.ascii	";v\2511\220\333k\332\206\221\0263\226%8\034t#6\344\026\\ml\006"
+	.ascii	"u-\224\005\270\2247P\300\372dZ\"\356\340\221\205\376\021\032"
+	.ascii	"0\200`\247\263&V\nd\300\201\0250\317\030\020:N\340L\356\177f"
+	.ascii	"r\200\021\006\355\362\263\275\203*\002"
+	.text
+	.section	.gnu.lto_.lto.ce90bac158a33b54,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxOpen.38.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\345\n"
+	.string	"\306\323KD \251*\035(\027ln\t[=\016\340K\343\244\264\034P\002\0131\022f\017\375\001\2625\3560B0\242\254a\244\031\024\"\007\330\231\250\320."
+	.string	"@\330\bZUa\214f0\261"
+	.string	"\335 \370o?!{\357\224\0026"
+	.string	"8"
+	.string	"7"
+	.string	"\nZ\004(\354nG\001<|\2453\364?\273F\034U\257,\247\265Sk\360j\030Y\325\323\342b\340\263O\223q5'Fbw=\305q\345\336n\273\302\266\205\375\031\030\230\203\316\201\335\224\013\026\266\334\020\b\270\354\267\377\2317>\354\261\360\262\324\267DE#\326\030L\330%!\2769\"\363\315\344\037\270o\231;p\337\034\332\021N\006\330\323\002\003J\326\034\037\234,\240\324\345\024W)\007E\002\r\002kV\3606\377\017\356{'\340\354\020\221y\261\322\256\365*I\250\312&U\223\272\354\327\335]\323\027\373\262\273r\001\250\317\3038\201\027#\323\004\305\210\364\2014@\216E\037\257\224\001\342\2056D \216Pg*\201::\321\007v\037\217\275\023\351\353P\236\367u\033r\037+G\350\252ff\245\266\0078/\232\241@\020"
+	.string	"8\263\002K=\231\001a\330`ay6\350\030\2265\332"
+	.ascii	"\020N6\016X\323e\364W\227\005l\021\227y\252&\247hj\017"
+	.text
+	.section	.gnu.lto_blackboxUpdateOutputRate.43.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`i\003]\027"
+	.string	"v*\223J\300\020)\035\377\207y\"\307s\266\224"
+	.string	"\335\215\272\035\226\2658U\325\336l\324\310\207\332\244U\3472\335\030Y\336\366K\2139\277q\213#\007\263\355\273\r\365m\212\002\241>\"\322\234}\235\314G\310\242\273\201\375\204\220\275\211\224I\006\200"
+	.string	"r"
+	.string	"|"
+	.ascii	"{\023?q\373\320\314\210\273\031\221\312\0346j\375\215|\256\202"
+	.ascii	"\361S\344 \3643<\214~\356m\267\352\277\020U\354\251\342\035\345"
+	.ascii	"\250\265\306\032\304o'G\221\316\260\371\266\027M\310\236\017"
+	.ascii	"wR4\341\301\321\371X\200\007'\347\242\313\307c\232\003\334\361"
+	.ascii	"\364\3600D\260\363\324\001\200\257&\004\221\352\241q \r\367\324"
+	.ascii	"\215N(Rk=\321\231\203O\307,\232\324Z\227{>\234o\353\273\353\263"
+	.ascii	"\273\rv{C./\374\336\347\376\245\305%,\241\234\034\007\227\344"
+	.ascii	"\335\332\005~\357\325\002xVQ\272\306\355\376p\334?\273\017k\373"
+	.ascii	"\354\276\374\302>\364}M\336\017\312\353\232\274\255\220\227l"
+	.ascii	"\336\261y\305\346\245\315;\2337l\336n^n\336\017h\345H\021\b\326"
+	.ascii	"j\023\354Q\243&\223\210\227\377\320y\367\273\377\355\201E7\272"
+	.ascii	"\275\224\031\253\322\330+y,\030?\003\360O\264\256;!%\205~\276"
+	.ascii	"w\325\352\020\250\257\213\032\233\240\320\301U(\331\377PR]\351"
+	.ascii	"K*+2\031\375$[,\312\022\032\033\326\334\304\313\312%]\354\261"
+	.ascii	"C\260h\317\026{\342\330\225x\277\2326\255\261\013\232\247\321"
+	.ascii	"\260g\317\244\326i\264;\354\357F\250\370\n\032KK\013\375\354"
+	.ascii	">\360\007\212\260tp\255\025\327\375\363j\356Y\371D\303;ve|\206"
+	.ascii	"\276\271\277\333\321qp\367HG1\263\007\332,1\262\b\263\031\315"
+	.ascii	"P\203\351\245\225\324\\V4\324f/4\031\205Y\f\306EV!F\263a\210"
+	.ascii	"\225\030\330\232\005\026[,\246V\263\305\\\277\372\260\266\317"
+	.ascii	"\022}L\241\023\225k\035\331?4:\225;\"q\343\325Q\363\n8~\220<"
+	.ascii	"\006\312\201P\037\035\2025b\204\344$\366\017\323\311&\261\t\226"
+	.ascii	"T\260\2061\255\202B\247\260v\265\255|r\372\013\031\b''\364\323"
+	.ascii	"\325\263(k\266zw\023\274\005\312\203\031\265V\006{\026o\222\260"
+	.ascii	"\007\372\fJ\250a0\246\234BHU)HIQs\f\220\002\021*\263\016\020"
+	.ascii	"`g%Ik\340Ki\225X\024\267\256p\202D\200\255\256\303j<\234\002"
+	.ascii	"\305 y\245\004\250\311\333~\311\365\316\"\"\202b\355\255\\Y\372"
+	.ascii	"Q!\200\272\310\302\020G\314\025\217\302\243\022\350\252q\206"
+	.ascii	"\341(\204N\321\375\024\346\311v\336\217\371V\240\323\335\360"
+	.ascii	"<\204\037\3575<\246\252D\013\244\351w\232\3020\336\375\371\327"
+	.ascii	"\367\253\266\275m\303#\375\024\305\264 \3313\231\277bf\301\306"
+	.ascii	"\002C\327\262\364\036\270B\245\364X\337\037"
+	.text
+	.section	.gnu.lto_blackboxDeviceWriteByte.46.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\005\003%\025"
+	.string	"v\246\205I\260\022R:s\3549m\273\"\356;l[\336\261a\326+\245\377i|\021&Z\211&\003|x\323\361\220x\324\352\254\203\210\242O[\353\341=_\260L\341\307\216\037\364\201\243k\211k\034\034\345P^\265\375omo\"eJ\001u"
+	.string	"a"
+	.string	"t"
+	.string	"\266\033\341x\347\344A-\315\371#\340\002\255G\333\354\037\377\225\230\254\236P\216\005\325\234S\266$n\273\253\305\2221\\\265\371\257]\316]\277\005\275\365\2433\350=M\211\350\t:\253\303e\016\266\343\321\030\006\030\372P\365\034\034\200\302\023'`nGC\237o\230\302{\362\031\331\351\204"
+	.string	"p\214\220\372\321U\303\016\247\312Z\231sZu\273\236\373u\333A\266\021\330\233\022\362\253{\036\036\356\277\247\240\371D\256\331\350u\217\276\215|\374\336w\025\362\021\302\363\001\3354h\377p\272=\373\341\334!\373F?\211T\213\254:\266j\230T\277\242\332\265\352\326\252Y\253\226\241:\252zW\255\253\276\211\013\220jj"
+	.ascii	"\22097\004\205L`\234q\302\366\355\037\331\260\303l\253\332\006"
+	.ascii	"\016\004rQ~\220\302\327\332V9S\313\223x\3149\023\3704^\343\201"
+	.ascii	"O\364h\b..R\356kK\206\344\256n\032\374M\350x\300\335\236\027"
+	.ascii	"\034G\272\366(V\364\320Q+\3731\276\204\3632\233\311G\327\272"
+	.ascii	"n;\212Z0\3644\311\332\326\013\326F\025:\252F4\256-\023A\257\223"
+	.ascii	"{\242\2639\366\225\336\002\303\f\r\215|\214\213\364\003\202\347"
+	.ascii	"\003\322M\272.H\353\2642\026jf\027\242cTj3/\031j041\263\032\030"
+	.ascii	"\231\204\231\031M\026sCA\246\"\300\265\t27\262\n\265\332\215"
+	.ascii	"\f\366\273=\234;\344\225\333\342\\%\272k7p\240\327\371\276\257"
+	.ascii	"\220\354\2565wu\253\020A\027-\226\310B\375F\313\225\242\364f"
+	.ascii	"\212\255\310\232@\271\351\312\206\007\271=\031w\255\202\037\037"
+	.ascii	"1'\226\237&a\033kb\261\201m\354\221\252\322\235\250Y\024\267"
+	.ascii	"\347\243\310> \240\002\221)3\017\240\325\023\032Zib\220pI\242"
+	.ascii	"{\311\365\222n\361\276\206_@3\274\324\b\226\025J\305\235\"I\260"
+	.ascii	"H\205|\330\320\347\034\243\025\037&\276rm\030\234(}\324\341\270"
+	.ascii	"m\213.\301\253\263p\2143F\273\222\204\f\236\203\0250o\342\355"
+	.ascii	"\024Xi\003S<\270\332\271\300\365\340j\023\035.\366\302f\233W"
+	.ascii	"\241\306#\317R\324\262\305N\264h\217\250\312\347\306\267\207"
+	.ascii	"\024\332~\364\352M\227q\336\370\026\202\335\224B\354\001"
+	.text
+	.section	.gnu.lto_blackboxWrite.48.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"}\f"
+	.string	"\026\027TA\020S\233\016"
+	.string	"\374*$\005\\/01\202`\005~\302\250\256r5\262\332Ba\030\r\223ol\f\033\341eY6\230%\247v\356\271sEX\001\200\025\b\273\323\334\fD"
+	.string	"K\347\221\377\2657\2212\245B"
+	.string	">"
+	.string	"A"
+	.string	"\346\354\036\017U\354i\254(A\t\262\273\227\2468\367Xir~"
+	.string	"\260{\2544/p|`\210k\225\200\244\002\002\003\216*\003(\023<nzv"
+	.string	"I2\001lv\327\371\201\037n\353\266!\330v`_B\217\276\310z\274\336\364\002*#Dx\231\262\303.\025\205\375j\365\204V\351\324\364-\230\025\324\003 \273\036RC\366\024o\264\260\375\213\355L[\323\200{i\203u\227TJ\331MY`\006\226\307\003R\301\177r\023\205K\307\356\376\373\311gh\226]\357\237/\343(\036\337\344\321\037M\263\036\355\355B\376\263\200\032>N\034\264;\213\217tR\217XWN\214\035\243\024b\037\306\303\021\337\304\"\242\374\027\035\021\b\313\020\235e6\317\004\r\033\347\223a \316U\301\203iW\026\022\2712\b\274Y\350\204.\f\333\026\272.\341~\343)I$\220\2526\226\035\030i\347T\325\227\254\274\364\324\b9\\\220\3602\2256~\240JT\001\030"
+	.ascii	"`\251'3 \f\313-\354\310\002A\315\336\255\315\327\260\t\346J "
+	.ascii	"%V\334\022\ti\241a\021+d\r\013\272\220\273\214\341\232jN\245"
+	.ascii	"\320\215k\256E\250T\0310\355\242i\025\024"
+	.text
+	.section	.gnu.lto_blackboxWriteData.49.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`+\002\275\022"
+	.string	"f$}G\340\320(\035:\307\251\300k\007\244\204\305\337\221\004\315e\025>F\2439\023\373\254\372\255\206\326\271\215\221\363bo\255\236\027\305"
+	.string	"\340\340E\340oc\205f\2141\304\271\243n\377<\2107BQ6K\211\326\022B\366\226;\245h"
+	.string	"e"
+	.string	"f"
+	.string	"\264\021#\370>M\373\200\356\363\273\200\356\323+\373\350\264\235\275\355\006\373I\332\335\223\352\330\013\3030\274\244\3353\256\336M\251^\\\371\254w\322\243\271\031\361!\253\221%9\244\241\343^q\232J\340\\\022\270~8\367d\002\232\244\016\0372\230\004\220\203\341x\355\321F\346\212\3213\331]\307\230\354\302\375\335v\3146\003;>\b>\277|\317\2572\372  (n4(\332\275\ty\254\2159D\342\267\337\276\017\3437\037w\333J\346/\354\300H\305\356\376\307\267\031\264\314\201L\364\261,|8\333\006\244\335\025\371\364\002\313\330\340\347A\333\221v\027\253\373\230\310\245\335\017:\204vw\304\n\276\317\020\371h\237\305[\254\3363\363"
+	.string	"\2739AB\273\001\252\237\276\346\204+\206\356\324\323\343>M\360\024\301z\250\255\210F&\rF\251\252\266\nK|\314SY\0373\021)Tg\376KvrH\236c\272\353Im\307+\346\354\307\270\214\030?\204U.\3611\227\356\363\372\332\r`\310\301\243\241\025C\233\346\212:\003\232\261\243c\315\261\301\030m\352\242K\217\376f\264\367\333\335=)oAYQ\024\f*\202t\212D\225\002\241\202\352D%\205Z99\265\244\240XN\251\027\n'\222\002VM@y9\301\250T/'\220\326\272IK]\235\316\\Z!A\235 <\221wj\323\251\324\037\325j\274bN\356\356\316\003\357\024\324g\340\t\252\361"
+	.ascii	"\022M\352\337R(!/e\271\244&\275\021\254\307i\264H\370L\367Y\322"
+	.ascii	"\333ph\305\320\236\006( `\002!s\332\001`\324\023\013\250\036"
+	.ascii	"\fL$g\310\256]\315k\245VRa\034f\343\227|\004\001\333\022A\360"
+	.ascii	"\260\237\257F2afm\\\020{}\034\343!\007<b\212CZ\206!\273;#\260"
+	.ascii	"w5l;\370\250\323\331\006M\244\001\313\322.\343D\326\315\345\n"
+	.ascii	"u\341\212{\353\346h`y\017"
+	.text
+	.section	.gnu.lto_blackboxWriteString.50.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`'\0025\023"
+	.string	"\226d\200G\340\360&\035[F\fs\274\322\304\202\030\205Z\233\245Ic\0356W\344c\004k=\346p%n\223r\026\270y\243\276\365\032\303\025k\374(q\224\b\004\200E\031\211\303wxW\021\317\261\034\331\207\307\265\021\262\367\2262\245k"
+	.string	"i"
+	.string	"k"
+	.string	"&\371\036}\373^\342&Z\266\022\274\005\321n[\212\341\232\346\234*\221\013\220\217\360\001\344\343\332\034\265uOF\270\237\266|\327=\223\243\235\214\326s\t=\235\035\017\0374\0304q\322%\345h\004\020\242v8\340\373\325\376\301\022\235\246\f\227\301\343\003SN\261\031\307]g\264\227\252\207`\316i\225\321*\334\250\333\236`\373\304V\006\001\267\227.\220\321\212 \233\367\307\006y\321\355\361\333\237\202j\324'\325^TK\250\216\037\272!T\353\252\037\362\236\331\304t\262\233sg\227c\306\210I\037>\364\027\265|\242\343\334\341\027Y\351s\361|F\266\032\2729\347\201\241\233O\030\017j\026\263\241\233\363V\340\321%\337\243\332G\361\024\255\337$<d\316\037\244\026s\336\f\004\376\215|\224\253"
+	.string	"\307\f\003\234s\316H\362oAv\301Q\016&\342\245;\177h\\[eE/\263H\316\272,7\356\272`AD#\367\264\271\027:4\350\016M\255\335\362\242\227\351\302u}"
+	.string	"u \261\013\344\337$\310I\367\331F~Q\210n\344\250\223\375\334U\330\370Bf\311\350e\217\276\214|\374^\330"
+	.string	"B\303\t\037\034\335\331\001\017jV`T\\$\r+fi\356\224\021\026\213\203\b,\224\226\224\225\013\212\n\206e\365\242J\231\241Q\215\0200+FeFU\303b\315\250:n8\337\037\037\367\217\251\366$=\326\253\2132ju_\036\214\337\302\235\331\336z\254\342bO8\272sj\341z\333\340\b\006l\304Kw\222C\215\002\004Y\b\026\226\276\324~;[I\271\t\220`V\337\234\363B\001( P\0021F\241\007\240\365\366\002\256\236\020,@\224\254\230\216\366\030\310\326\027\312\253\212\212\337\021\363\205\340\002\\\035\3011\001F]\235l\202l\263\347J\354\36734\215\3030j\020b\261\211\325R\220\341T5\by"
+	.ascii	"\006\265`\303\277Kw\340;\353\201\260\226\3255\265k\t]o\217-\\"
+	.ascii	"\221\301\354\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.51.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375 \311M\005"
+	.string	"RI#+pm:\240\275\031 \200\200#`9>\260&6X\035X\321\336V!\324g'\206J\243~\353\257xv2\245\212\213\020\375\275S\n\316\254\252)(\025kd\227\003\243\020\355z\320l\223P\253\340\032YltR\353F+\261\373\f\t\335\364l\321\223Sc\037\2603\264\3453\246\361\224\b\355^R\250%\005F\035\333\257\314\331\245\213\234\275\350c\001\215\273K\347\346\334%\347\337\363\301\007V.\005\210\335\265\374@\314=o\333`\373`\233\021\t"
+	.ascii	"`\25173\340\234\031\003\276\3345\334-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.52.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"M\n"
+	.string	"\206SG; \261\322\001<\204\240]_$ 0\2036N\206\273\245\253\333\262[\013"
+	.string	"\263\250\306\332\326b+R\271\303\234a\302\177\020\244PX@.\017\250\n\005J}\264\007m\210\220-\245L\0016"
+	.string	"3"
+	.string	"8"
+	.string	"\243\226\265\230\212\350^(\273\3562d\232\216:y\307k\207\\\351\374(O"
+	.string	"\336\253\305C\266f\202\306\316#\200t\355nB\335\375\205\221\035\372O\3773\374?\370\365\023\232\002\365[V\233\356\215\226\003\271\341X\333\373\313\326\362\354\327\331,\373\277\237\337\363\356w\243%1;\031\207^w\254G\323\271\217\205\344\277\352\367\034AA\3657\211\2530f\346\225\216Sk\216\3566\020\230\311\255\266\346.+\270\020\346\031+\001\270<p\362\342Z\336\377\n5Aq\272]\013\327\233\342.\256#\372\035#\265\n\323\357\001'\201\304\322C\2068\212 \211$F\341DId\nI'T\b*\270H\001q\n-D\361\024zJ\226\262\354j\323\006\230\217\024\225\275\216\340\231y\362\306\377\311\017\261\2705;\373\017"
+	.ascii	"`\325{B\300z:\236a\366\322\252\025_\200\311\260V\321\"\2610\""
+	.ascii	"\272\206\327\217x`\b2\356\\K\323oa\226\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForceComplete.53.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\025\f"
+	.string	"\306\326R@\020Q\225\016<\305\327\265\035\345\032\021\b\366\032\275G\312\273\253\370I\f\347\271\177\320\340\204\205)\205m\004\343\247t\342\241\260\033`2\241\bP\026,\346\265\254\361\2618Bq\200\322\315\222-wJ\001A"
+	.string	"<"
+	.string	"@"
+	.string	"\n\030x\354}L\215\256R\211^\035\273#\247#\356}\252\364\374\263>c.``\370}\006\b?\\\247"
+	.string	"\017\021\214-\004\315\005\034:J\003\302\220\224\221\007\273k\t\206\036n\355\266!\330N`_B%P\230\\\342G~\330#H*\312\376\\=\331\226\236\226V\225~d\2622\225T+\235\215;\372\300\2612\255\305\t\333\367]\027;o\371\200\211\223\251\265\273\3335\273co\367\330\233\003\337\313\266g\206$\265\244\335Ep\215@\r\331'sx\026\023C\250\242\254/"
+	.string	"\271^\374I\210\237\215\0271B\322\303v\367\025\030$\273\241\006\376x\025\033\177u\315\0328\362\3405\237\003\271vu\020\266L\272\313\204\r]\005c\241T\250p\026.\224\fg\321l\270\211\001w\027(h\270\f]\247\341\266\361\363\271z\322\b2@\260\200I\337\203L\355`{\352Y\007 \"\005\351\006\215\217\202\346&}\021\223\221\007UU\003\024"
+	.ascii	"`\325c#4\327\n\324\tf\342C.\331\nPt\375\231\3655\303p\026\016"
+	.ascii	"M\026\026\216\021\234=\256\211D\231\320\204\206@C\344q\347h\266"
+	.ascii	"\024/L("
+	.text
+	.section	.gnu.lto_blackboxDeviceOpen.54.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\311\005\235&"
+	.string	"\252F\230\017Fp\336M:s\307\242\202c|\225+v\360\3203N\363\247\367\027gY\036GOZ\340sp\371\221k\037\026\254\004/\362$\033?4\220\330J=b\351\205\\\347.-SKOSs\225ukjM\332&D\356$\003\351"
+	.string	"\322"
+	.string	"\344"
+	.string	"I\276\225\233=\375\314\351\353TQ\307\303MM\004\022\375\357R\251Q\245F\003\372\363d/{:\362\006\nUD\271\270\255\275\255+\362\301O\236\200\376D\360\001\367\247\371\337\305\301\234\376<\363\023s\312\024,<\261z\344\221\035\367*Ce\246\\W$\260\273\256\336\327\343\245;\035\232\273\247\331V\345C\335\027\340\013\313\235\255+\343{J\336N*\313T\232\270\255\253\254\247CL\004\273\263)\nA{\202%\305,\253\313mH\336\004\343\306&%n\353\212\310\321%E,\023\301\272\256gS\fbs@~M\007\3064=|VS\346\2005\\s\250\354y\241\361\246\t\001\013M\315g%e\376\332\302\270\236\274\255\262\212\262m\362\372P\271I\255\206f\005)e\226\317*\312\332\334\206u]\331\022\255\256\316"
+	.ascii	"\316\374\223\231\227\230O\020\001E%g\037\337O\236\330\tc\336"
+	.ascii	"\351\376\232\b\254K\200\375\372\024\227Y\305\n{\342\257\237\374"
+	.ascii	"\303\200Da\213j\250:\350\221\265\270\256k\003\002alP\026\020"
+	.ascii	"\267y!\323\352>r\177\350\276\203\252\304\211\262}\230\231"
+	.string	"\305\267\024\241\353\032u\201\237\345Z\214\370I~\362\021\f{\342O>\214\373\363\375(\267cJ\340\030\307\310\204v\311\214\034\332>2\337\\\333\b3[\036J-\013\241\226\013\234\3129\350g\347\037[\366\035y\356]\313\274\324r\212Z\336\241\226u\250etg9\247\263|Q\313\347\265l\346,\367\265\374\003\030\224\306,/3\335\206\\w,\377\254l'\030\260#\177*\377\331\233\371\374\261\243\341\370\025Vj\2424JY\327\365R\370S^\345\001g\374\260\351\372\210\274\332u\371sNG\355B\242zy\335\237\27535e\036\241]:\245\261\305\275-hs\005\b\332G~\331\236\313\277q\257\247L\315i\177\343\366\272\212\350\026\030\252\001X.\227yNt\203\272@\263\2352\016\355\222s\315w\36372\324/\025L\005\273?;\215\b\307\300\366\332^er\317\006\236\2576\271\377\362\333\314\252\023U\314\236\230k"
+	.string	"=V!j\224\257\251c\267{c\314\304r}\004\022\031\352\270m\204}9\326\253e\367\354oq\211\247Q\3132\360\317\034\r\007\263\203\207\353\341\376<;w\374#\006\306\354\240n5\252@\374\341e\302\240\b\201\256\353j\266N\017\0371\262n~\332\307\210\340'\341\021$Hl!\302\021\260\377\362_3\2338aO\354\266_c^\342\336\244\032*\231\f\034C\002\215\030MEI@\245`RR\320\310"
+	.string	"\f\244\027J\301\016;\033G.\224B\0345\025\225p\341T\324\242GC)\210\324\264D\242\211)\270\224\262\221\204 \022\013\033\301\0262\214\212f\264"
+	.string	"*!\025%\001\215\230h"
+	.string	"%(\340\340\322\021\023\260)\030d\002\246\302\233k\033\341"
+	.string	"_X\250\272\364D\270\311Iv1\371\352\365uU\363\006a\017}}d\0317\327C\r~\274\031\266%\305\f{}\344\024ai\332)~\354\030yN\273G\273N\213\314\233[\027\035\204\013u\0253\257\371\234\b'\324\274\bgk\303\266$/m\323r\223\022\335]\017\375\340\252\242&\312\366!\300eJr\327G~\360\264\217v\213\345C)\004O\2338\273N\373\352\241\n$\314\243\353]\013\231MA\031^-r\321\326\365\247\226\f\177\347pj\021.\365xl\013akbXB\273\324Z\033\370\002e\250Q,\003\225QH124\222\242DcP\002!\204\354\356\021\240=4F\223T\206\003\213\334\264\262\004n\362c=Op\325B\216\350W\236\275\342\246\007/\027EJ\341\002r\022\351e\267\344\352\215"
+	.string	"u\330%g\272d\025\316o& xo\305\223\206\273\203]z\206\213\300\3021\234\307\376X(\256\013\215\027\345\267:E\203\036\254\232yf(\270m\006\262}\374\334\021H\035\026\210T"
+	.ascii	"$\230\3319\204\332\031\345aA\304\361E\013\252\364\253\210\314"
+	.ascii	"\360\367K!\351{r\211\237G\321\215J\272\223\201\261\031\315\226"
+	.ascii	"\030\341\026&&\225\0351g(\017\215>\220Z\351+a\201\b\365b\340"
+	.ascii	"\231G3\002\005Q\343a}%\033\024>0_\362M^#O\224\206\356\257\222"
+	.ascii	"\242\330T_\343u\f}\026\024q\344\204MMz\346\260\270\251\002"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.55.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\260"
+	.string	"\345\n"
+	.string	"\226SJ@0\305*\035\200?"
+	.string	"\347\336\362{\236\333\367\327@\250\006\321\330\362\342\004\370\310\355h\211\247\310R\201\035}2\241\013u\305\230\205j\341~CA!\260\272\374\334\200zma`\205?\215\021B\366N)7"
+	.string	"6"
+	.string	"9"
+	.string	"\261}\013\013k\345\334\335\260\226\034u\257R\224\177\224\033\220\345x\017\341\325\323\344X\0012\245\312s\3708I\016\312\025\245\005\024\273kJ\226\"\367w\333\023\266\033\354?\0047M\276\314\035'z\362\237\177\002\377E\230\263\326\fA\212\356\354\232\212V\230}o\353\313>\365A\260t\235\007<\f\354\202\354\022\354\355{1\261\375\214Qv\201\327\002#&\266!\273\273Y8\271\215Tg\001.\246\253VX\275\002\370\232`#\260\2429\333\242\333D\314\356\n\302O\271\212\206/\373gR\251\004\376{\2250\007\264h\346M\240O\013\376pDP\005\207\350\t}:\027\236\020\003\324\021\205\237\021)\3440X\314\260\030\205\033\2428\n3\265\324\275\255/\f\200\221[\252\252\\\273\371\016w\342F\252\3634\324\006\205\350I\327\032\022"
+	.ascii	"`\2517\023z\207\002\267\3702[\221\263\314\262Y\333\267\264\250"
+	.ascii	"\354\020n\222\271O\251LG\252=\027r\367`\375e\\q\351b\266\363"
+	.ascii	"\026f\031"
+	.text
+	.section	.gnu.lto_blackboxDeviceCanCompress.56.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375 \307\205\005"
+	.string	"D\tl"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\n\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\231\261\024\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\327\211\001\221\216\217\366b\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\203\003\002\006\177\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\n"
+	.ascii	"`\251'3 \0306*lV\341\270\206{E\f\"D\016w\356\266\305\t"
+	.text
+	.section	.gnu.lto_blackboxDeviceBeginCompression.57.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375 \312m\005"
+	.string	"bI$.pU\323\001"
+	.string	"\345\276\023\270p\275C\244\033o\344\030](\311,\253-l\223o\316\374:\355\355\246\252\036 \201\215m\262 \204\300\376\275S\n\246S\265\030\224Z]\224rT\023bQ\217I1\311\234\020\256\221\0066'\265bS\002\265\313\357\240\311\315\006\267(7\366\005+?;RM\207\361~\tw\273p`\001\006#\217\355K\316\354\200\203\2355|B\026\221\300\356N\311y\366\230\371\007\275\300y\225G\302bw\0359/s\313\333N\330V\330\276\002\t"
+	.ascii	"`\25173\340\234\031\004\276\3345|.\204\3612\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceSyncCompression.58.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\335\b"
+	.string	"\006\320<: \005)\035\340\334\026Kl\204\026\200\017{q\216G\036N\327zL\260\234\301n\035\272\265_\277\357\260\320\r\263R\320\372"
+	.string	"\t\200\026!\032\340y "
+	.string	"\007g\246\333 dK\231R+"
+	.string	"+"
+	.string	"+"
+	.string	"%\377\256\013x\237\351\220\363q\205\b1\030\033\202/\005\013T#\336]\317\215\017\225\031\260\260\273N\357\363\270\265\333f\260\235`\273%pw\327\312\262\237\2766`\302\361\275\203eW5\013\2600-\206\304\366;.\3315\177\265\326\240\304Ec\345fw\243\206\274t\250\031\252\246\267d\261\0275i\273r*3\251\224\331Gy\n\311\027q\306(\357]\363G\333\265\253\302\212\006\300\352\2243\373eJ\005\261\037\006y\272P\003F\307=\200>\020\\\224\b}\"\"HD\021=\007\356&\034D\261\242\353D\261\363\332\303U\22692'\260\223\242\340\226\266\305E\336s\016"
+	.ascii	"`\2517\023\232\372b`\r\006\206\275\200j\037\244\206\210\013c"
+	.ascii	"\bP.\243\274\f!.]\314vh`\n\n"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndCompression.59.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"\345\b"
+	.string	"\006\220<90\345(\035\300q\324\\f\330i\2036\247(\230\273^\340:\371-\177\205\255\362et\377\327\357\203z\310\br\\'\333p0@\"i"
+	.string	"\376#\036\250\221\243\206,\331R\246\024+"
+	.string	"*"
+	.string	"+"
+	.string	"\"\377\253\017tq\364'\320q}\b1\025\030\202hz\005(\222\356\253\347F,e\006(\354\256\263\213\034\267v\333\013\266\023l\303\002\366\337j\312~\372\332\266\202:\305\237\\\273\250Y\200m\321`%\266\257\261\310~yK\265\006&,\032)1\273\013U\344\242?\315V\035]%\213\275\324\241\314\265\203\342bJ\231}\326OB\376\2103@\371\356\232\017\312\\\273jt\245@X\036\244\234\331\255QjH\3366\234\247\001\203\353<l\034\210\016\224\360p\"\340\366\241\200\233\003s\023\016\037X\301q\037\250i\355\337j\312\f\037/"
+	.string	"1\222\226^&m\213\213|\027\017"
+	.ascii	"`\2517\023\032\373bd\r,\206e\201j\037\244\212\210+f\b\3205|1"
+	.ascii	"\004\177\031W\\\272\230\355\320\300\024\024"
+	.text
+	.section	.gnu.lto_blackboxDeviceBeginLog.60.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375 \321\365\005"
+	.string	"d\nm"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\243\316\233\276\004\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\214\267\024\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\357\270\001\221\216\217\276n\002"
+	.string	""
+	.string	"\244\003"
+	.string	"\200\200\200\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001"
+	.string	"\244\003\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\b"
+	.ascii	"`\325\273B\300<\207l\025\274]\363\232\020$\3349X;\313"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndLog.61.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375 \365\325\006"
+	.string	"\242\f05Po\322\030 v\210Y\230\013\335\2349\340)\337\"DUSH \324\262\265o\271\250\265\207\213:\301\016\3013\313\250K\021\354\327\341\023\335\211\375@\333\310\3362\005\020\320\341sU O\024\330\342\300\353\301\002v\"\254J\242\363>W5\361\254X\3618\006C\nO| \b\343\333L\221\272\322*5\005\"7\3729j\256\343\225\332\335\335\225\276\301\024,#\323\021\224],\006fY2* \177\3507\177kj\222\004\372r2\255\354N\204\023\0024\363\257\260\020Z\352\374\300\006BDH&\247\335\371\234\207JmrU\022\245J6\\8ZN\262\013m"
+	.string	"\r\273{\303\3104t\247\377\301\317\360\223\002\b"
+	.ascii	"`\325\223C\300<\207l\025\274]\363\316\020Gx\036\204\265\263\f"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceFull.62.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375 \307\205\005"
+	.string	"D\tl"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\n\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\352\267\024\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\337\276\001\221\216\217\232r\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\203\003\002\006\177\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\n"
+	.ascii	"`\251'3 \0306*lV\341\270\206{E\f\"D\016w\356\266\305\t"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceWorking.63.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\235\013"
+	.string	"\246\025PA Q\224\016<0C\341\020s\204\370\2138\f\206J\022\335\262\003\017\005V\344"
+	.string	"\312"
+	.string	"@D\206\324\347'\261\270\306}v\304\303L\027\263m0"
+	.string	"`\275\200\031\361q\335\002\353G\344\346\246\311\336R\246\024?"
+	.string	"7"
+	.string	"A"
+	.string	"\332\277\220n\300HGJ\201c\367\2734\304\265CM\315\027\035\036uxb2I\315X\341y\\!\001\031 jT<\016&\370\210\341\021\300\033e\002\270\354\256\263\344y\270\343m?\260\255\300\276\203\371\322\243\377\261\036\257G=M,`\220l\271\262?.\365d\037\256\202\330NG\247U\323\231\351[\331\215\216\203w\025%\273\335J\307\252\242\213\021\266Cv\305\013\030\204\034\334SG\001\362E\314\351t\254\307\324\f&\223\034\037\266\\\331\240\204l\207\335E\220\221P\211r\307E\224>T\252'\275\001\353Z Ec\224'\266\261\237\250@\331\0355\360M\234\304\343\213<\372\302'\326X\260\r\004\fX\206\243\301H\310\\\0236\230\316\245\311<\227\345\2001\n\021\262\313\002\206eW\345\333\016WA\254a\244DI\213\3645\353\250\013\320\250\252\033\324\227M9\250'\203\254\324\250'\275\b\022"
+	.ascii	"`\325\213#\364\245\215VG(,[\2625\206\212Z/\r\251\270\005R6u\212"
+	.ascii	"\213\202\303\264\350B.\210Yi\203\345q\315Q\245CQ\253\240"
+	.text
+	.section	.gnu.lto_blackboxGetLogNumber.64.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375 \334%\006"
+	.string	"\022\313*3pK\323\001\220\025\267t\375\257\0256D\212Y\247L\375]\304\242\325\026\355I>Vd\372\0270\210VU\342P\r\266\013,kv\260\275,5\243F\366N)\256\244i\t,L\212\240\232\n(y`M\006\262\272\022\244T\361D\030\270\244\302\234\227\204\274\354\221\243\247O\224E\315\3664\030%\3547\273\273\216\234\r%\025\036\365\032\337.D\b\310v8\034\024\2661\033\362/\336a\246"
+	.string	"\016Y\265Xt\017\031\037\273+\243S\236;\315'\317\2358qzH\375c<@\333\370\266\332p\030\311\354\256\341V#\356x\333\027\333\030\333\f\001\b"
+	.ascii	"`\251'3`\236\031\007\016\251\256yY\b2\334\025S;\311"
+	.text
+	.section	.gnu.lto_blackboxReplenishHeaderBudget.65.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\013\002\265\022"
+	.string	"\306\244\200H\300\322Q:rP\220\334f\332\240\003?\314\026\252.i\253\310S\226\3771\333\221\356(\312\0139\nI\261\314\257\251U\331\017\n,\t\343\326\207o\306\241\b\rA\300\227YKj\232?\314t(\206\264EAm#\233H\231Rj"
+	.string	"b"
+	.string	"n"
+	.string	"\217\277\217U>\317{j\347\265|g\3660J;\032;v\227\344\321\tR\217#\037\020>\202\027\020>\272f\353xOg\013\354\220r@M\273\333R\022\257\035\324\254\371i\003\344\373\t\351\\\016\336\347\340\211\032\246\333OH\007\342\n\256\234r6T\272\033\250\240CS\rK\207\313D5\330]g\214n\346\216\267\355\3006\003;5\0041\217>-|\274\242\212~87=<[>\331\275[j\216}pw\327\212c\3074+\246C\376s\257T\347\335\250\230\016c:f\032\004\323\252\351\314\364\003\210"
+	.ascii	"\371j\244\330\315\320_o=<\365\330\244hd\342??\357i\337>\n\337"
+	.ascii	"\367\343#pW\254-D\211O\006\021O\223I\352\321~\317V\005\nB\003"
+	.ascii	"j\324\347~|\350D\022&\270\\z\337#RQ\016\235\233\036\032PsT\245"
+	.ascii	"\211\224\373\001 S\355\027,"
+	.string	"\037\243:\202S\027\373,\336\202\203\277\343\n\261X\370\230\032\241f\211\007\215-\237R:\373aw\021\320`$\271\244\017\377\210x#Ts\254\027\t\257\004|7p\351d[\345A+\251]\334\002\037\350*d\376\316\2431\320\362\001)\256\204\275PX\036\300`3\n ~\225\310b\256\r\262\024\225\027\212\205\224\326\205\030\312J\3535\243\265J\fX\306\002\233\2652\310d\263\226\252g;\270\212c\023\230\\P\222\374;;\034\271!U)JeRL\"\222lz3Kc\334\347\267)\221{\037\205!\312\322\367~@fi\245(\r\321\026\027/J\267|r\250QW\252r\364rs3\372\213\026\b''\341c\030  `\2021\223r\036`\365\214\b\215Q\242\225,\320\340FqA}[\305q\320\371\205[\234G\263\214\270\242\t\210!Y\346ZT\347\271\366\330^\007']V\2024%\351\261\300\330\223q\362"
+	.ascii	"\202Hw\352k\252o#r[D3\213\255+\022\016\024"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.66.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`)\001-\016"
+	.string	"&\233bF\340\262(\035\222H\200>\243\260\314\331Q\271c\314\332\247\025aD\270\022)\\\230\332r@\317\245\321\350}\373_C\271\b\323\032[\243Z|O\206\"\310q<\216`r\300\036C\367\002v\005Ix\265c\357-eJ\001O"
+	.string	"J"
+	.string	"Q"
+	.ascii	":8/\236\036\273\264\215\344\242x\370> \036j\210\247\016\237f"
+	.ascii	"\312\027\351T\207\242\277W \206\241F\250k=\022\030<88a:W\352"
+	.ascii	"KP#c\006@\307z\242\232\315\215\317\236/\235+"
+	.string	"3\344dw\235\260N\303\035o\333\201m\023\3732\0015&hV\371c\323X\2511\373o\025\204}\331\037a\3729\255/\235\232~\b\313\206\030\230\3561V\354\306\374\374X\037\350\002\307\266\213\035\262\235yY\313\023\260-\033\032\026\273\253\300\013@\207\266}\235\227pq\252\201k%\303 \b*\004\361Q%\220\307:\324^<=\201\230:\262c\303\020\256\302\004\332m\231\370)\316\223\342\337\034Z\205\343\342a*\213\207\236\034Y\266\330Q\373\240\032s\324\353h\247\247\225>\354\2378\212\026\377\306\024Py\330\241\217\212\207\327\317~@\007\016\032\001\250\322\312\205\0214\251\2043=\260\300\215RH(\021F\233\004\023\212\312F:\241\266\022\003\346&\224N\333\n\307\235\266\020m\365\367\236\216\274rfh>\025?\373g^$F\244\237\212\252/\352\223\225\262`\200\214j\223Jy\330\323\247\252\034 \021\233aw\003\025"
+	.ascii	"`\325\333B@\030V\303F\256\"@\246Y\201\253^|\001n\203\025\032"
+	.ascii	"\204\302I\234\0208\210<\215 Y$\023\266k\342\231\026\232d\202"
+	.ascii	"$~flizTA\235\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceWriteByte.part.0.89.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\203\001\335\016"
+	.string	"\306\033bE"
+	.string	"\317&\035sB\030\304\353\212\273\237\203W\353#\t\316\b\241\277\257\342\354\0319'\307\021\340\333\343\030\033\202\0073\327\335\206\341G\344D-\302\277\356\262\366\347\001\352\001,\375q\020\204\320\350<\254\314\332M\244L)H"
+	.string	"N"
+	.string	"P"
+	.ascii	"%\217\273\342\262\246\275\301\361\235\246\304\272\013\323b\305"
+	.ascii	"nTph\r\321\241\375\021\266=\227?\333\347\021\266\241\327\206"
+	.ascii	"\224\233\330\356n\207\332\341\3375\263\317o]G,\031\236\003\236"
+	.ascii	"\205:v\327\"\r7\274m\r\333'\373.\002\327\0311\313@\204\265\214"
+	.ascii	"\\~0\270\304v\343v\350(J\373>\211\333"
+	.string	"\3709\326p<\273^\3427\337M\230\207\204\022\227\345\201L\234\3118\364\002\321!\351\005@\207\331\t\200\342\310m\254;<!vWK?z\266\246Y\3635\336\340\360N\023\332\262\237\342*T\276\214;\221\274\312\241/\002:T\005\360rM}\3163\021\037^\244\374\230d\214\324\2275{\266\032c\203\322\252\351|\315\377P\002\037\0010\273+1`,\007\270\003\3428G\341\231\225\355K\204\2650\360\3203\023[\224\230\341\023\001\226P:\300q)\007*ne\241\001\311J\343X \246\n\320\250R\347\001\201\244;}\240L \247m\202\207)dC\245T[\t\201;\n\\j[u]j\323l\3475\306\035&z\242\372\262\035 m.\302\343G:,zN\264e-SU\355\217\220\274\212I\027\002\" `\202Q\322u\003\341\261AV\b\3128t\037\032\321db#\006\020y\034a\034cx\305\203\342\356\\"
+	.string	"\3030\232\300!\032\022\3271\337\244o\027\002\003\320v\300\331\262\335\205"
+	.ascii	"0|u\367\325V3\373f\336\272\005\260\366\352F#\372]a\f"
+	.text
+	.section	.gnu.lto_blackboxWriteData.part.0.92.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\\\001\315\r"
+	.string	"\026\031XD"
+	.string	"\221&\351\360\215\344u\373?\301Kb\016\001\250\276q\031\252\030!\272VB\004'\2233K\370\261\346h\267J\375^\304\377\0322\304\021\314\255\352\255\377\327\306\007\360,%\337\353\337\243\001\364\270\207%\204\220$\003?"
+	.string	"F"
+	.string	"D"
+	.string	"\307j\027\340\034\253;8\307\366\022m1S\263\226\306\032\210|{\271\200\302\221\231\326\361}8\3739\230uW:\221~o\303\021&n\224N\032v\004\206"
+	.string	"B2\263\325\206\033o\013\322\226A;\214\033\207\032\231\231\340X\220jt\337\260\266\323\351s\2430\250\345\311\324\227b\025\331+j\323"
+	.ascii	"\231+2h2\363\243:\036\200\316\255a\273\244\030\3202\203\251\316"
+	.ascii	"\265\237\030E\266K\312\0032YZ\320dj\n\216]P\005!\316\311\004"
+	.ascii	"w\251o7\350\020\303\302#\271\327\322\007a>\226v\324\273\265?"
+	.ascii	"v|\334db\310q\223\036b\215\210g\276\275\313<\323Y\264\323\366"
+	.ascii	"\030lt\252\016f\220\310\314\316K\217\031\rS\233\212d\252`\002"
+	.ascii	"\240MFH\236\007\305\003\001\366\343q\201\036P\270D\"|<$\"\226"
+	.ascii	"\t\310Sb}D'\226\007\202^\022FD\026\312u\211,w\210\312\253\360"
+	.ascii	"^\213\r\231T\276\225\np\356\375N\375\"Te\252\270\270\246\244"
+	.ascii	"\2078\366\n\271K\307\036% `\002\231Tv\003\263\362\233\3025\374"
+	.ascii	"+\254\267\201P\323PQ\264\243\301\334\b\225\344\371\b\207\303"
+	.ascii	"r\026\003\264\f\237\023\352\233\2749\260\230\336\343\316\307"
+	.ascii	"\2545ct=D\250\241\331\300\214D(\020\217+\214\206$wh\261`%o6\013"
+	.ascii	"\326\036\n\013cKOPc"
+	.text
+	.section	.gnu.lto_blackboxWriteString.part.0.94.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\343\001U\020"
+	.string	"&_lG\360\260(\035r\237{\373\306\033\277\256,\177\306\003o\255\224N\225d\036~\312C\271.\342\342\316\220\332\312\265\355\225S\262-\264\203\330m\241\374-\237\201\317\300\215^<\310\001\243\363\245#\002\313\301\313\234\315\356-wJ\001T"
+	.string	"Z"
+	.string	"Y"
+	.string	")/\260;\273Q\261\0136\370\264\203\356\323`g_F\025\263\355\227x\314\312\326\221 \214\3544\027/\033\317\356z\237\t~\340\363)o\340\363\251\264\257\256Q\256\374\b\223\261\256\017\277\3005\343\304\213P\266\341\221\343\0224\332]w\034\356y\333\021lS\260\243\204*\240\007\212O:@\030\227\t#d\364\360\354\202\336\247\3327\312m\25495B\367o*\037\367\320\241\032\325m*\257|\333k\034\372\364i\254\323\261b\035\r\rFnw!\240\300\360]\211\001`y\305\310\355\202\036\237~\3209\306\317\250^K\351"
+	.string	"\327%\346\030\355\2338\270z-\361\260O\337\364\0019\305\303, E\213\235\025e9\252j\264\275l\264\342\r\007\210W{\344\213\207E}\370wha\261\243\242\254\250/Vy\271:\263A\321\362\270[?\321\3613\377A\fH\f\360\260\333r\243g?L\034\021\307\375\267\337\370d\344\322\220A\2062\271\030\236\r\016\021!\b1\001!1\211|R_\211\246\356\222\350;U\270\360}X(\221D><\222\023i\304+\241R\236H\201\277\022\023\3123\371>\224\027\272\\\235\371\3419\242\252T\026\333R=j\251K\365\245F\243\347\266\n\302\004\242\352\3656\3171u\273\255\303\374\025\307!\371!>]2\005$ p\"bv\363\246\030\003U\017\212\030\247\024\032^\032\020\251\200\322\240"
+	.string	"!\352aF\270q.tA\220c,E'\207a\361"
+	.ascii	"\301\270\004\001A\243\303Z\306D\242?\257Z\020\342\001t\020C\016"
+	.ascii	"\235\274\223\335\376\355\006\013\371\036\232l\272v'\f\\\273\377"
+	.ascii	"Z<\006"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.part.0.97.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\375\013"
+	.string	"\346UO?\020Q\225\016@\357BH\361\215"
+	.string	"\262\312\311\203\032\350\0203\224\022\233a\030P\307\215\213\372\235@\325-\207\322\211\207\"\362-\223\t\220G"
+	.string	"\200-@1B\036\303\b\357\313\222\212\306\266\211\224)\005<"
+	.string	"C"
+	.string	":"
+	.string	"'l\271x*\333\266\\F&=t\245.\"v\301\205l7\344\0365\304I\327\324H~\242V\245\353\301\037\370f,j\274V\033\236\223k\035\230\335u\204\303\035o;\201m\005\3669\001\037"
+	.string	"x\330M}x,\210\b#\261\302s\bs\302`A{\305\260\201B\266_H\t\257B\344\320\200\320\245aA\211\0330\207\027"
+	.string	"y\214<"
+	.string	"\344\267\350)\2543<L\354\356v\037\364\354\315\036\331\333\343\003Z\340\323\222\375\027\207A\301\037a\t\240<\352\321\007i\374f9:\230\362\243\205m/\026q\255jw\021<\036\274D\006\016\032\245\234\245\266\254\332\265U\226\355\264:\2351}\b%nP!\340M\245\3530\250\320i\034l2\0174\034\204N\306\303m> \256b\300]\004\316\207\233\320u\037n\273\266\312\362\301O2U5\203mUcLzRm\331\226\344\325\366tyT\006\031"
+	.ascii	"F1\003V\275\234\305\230\267\241\321\016*?\0139\207\3605\315\360"
+	.ascii	"\bm\3462@\024\fs\205\233h\"\377\f\221\347\226\005\233\372\320"
+	.ascii	"\223\216\267\016\347\252\232x\251\323\276\244\246\250y\377\265"
+	.ascii	"e\f"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.part.0.102.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\241\001\r\017"
+	.string	"&Z`E\340\224(\035\020\2425f\236\325O5\0216\246\213\001O\300\233x\002\331Q3\346zaYC3\310\251\360\217\352k\025=W\006\317|)\275n\304\330H\212\221iB\370\355\013\0132\300T8n\376$\222\275\245L)I"
+	.string	"M"
+	.string	"M"
+	.ascii	"\361-l\233>\370d\003\371G\263\317a\0033C\266\273\334\243\226"
+	.ascii	"\370\351P3\236\374\273\016\300[\241\016\323[\205\270\302\006"
+	.ascii	"/2\022%+\025\024\240\003\323\343\256g\207U*\263\300#\t\312\356"
+	.ascii	"z\213\271\265\333~`\033\202}\"\001\216\351\204\351o0\2057\200"
+	.ascii	"\265\353a\266\263\255\b;\001\303d\026\224\024\207\027h\263\023"
+	.ascii	"\253\221\255\352c\360\375E\213Y\016|4 \"\254\020\002\223\355"
+	.ascii	"~\334\243\277\233h\217\333\rh\217\267\357\226\277\214\340\345"
+	.ascii	"\203U\263\273\236\373.\223\355\361<\366o\034\207h\302h\244=\246"
+	.ascii	":p\241\202\345\372\212f#\342\344\310\206\004\310\253\255\322"
+	.ascii	"\345=+P)\312>\215\327X\361M8C)\357=\372%U\0219,F\270\344L\206"
+	.ascii	"m\323\311v\362hb\004E\221 \250<\222:c\215\207\2532\016\246\360"
+	.ascii	"I\340\320\247\033I\330\320\245T\b\201,\244p\027F \025.D*q\237"
+	.ascii	"\005\3560\210H\234\206\256#q\036\270*\343\215GL\314ES\260V+o"
+	.ascii	"f1H mP(\357\271\344fG,\245(\353\215\243\343\325R\235q^\244\245"
+	.ascii	"\222b\374P\245N( p\202\0313\273\030\346\230\001_\357\036\207"
+	.ascii	"\001\304\306\271\231\326\221c\215\b\233\221\030\001x\317E\300"
+	.ascii	"9h\354\026W\310\236z\306\301u\263\256\265=]\355\270\233\026m"
+	.ascii	"0\216\252\315\204\2149\362`\204\217\301\364\341\277\270\331["
+	.ascii	"\314\244\301\002\031j(k\336\256\205P{3\342\320j\334\273\360\030"
+	.text
+	.section	.gnu.lto_blackboxDeviceSyncCompression.part.0.106.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\375\007"
+	.string	"\202\01645Po\322\001 [.\326_O\017\034#\330C\342\327\321\266*\326\230\257\223g\333P>\004\002aeC\275\016\332\233\231\305\356t\371\325\210b\230\210\201\215{K\231R\2766\321\2430\021;\f\027\247\241\003\037<\034\007xa\037\270)p\204X\300`D\214\030\264l\347\335*\311U\312\004%R\013\253j\311\266&\217r\225\254\332\025\235\236\362\361E\376,\221\345\267??\003\370\263)*\362\233\317\222*A]h(\265duw\253$[\263\003\301c7cFf?\236\313\210}\023\310\266\254\277\237\330\006iX\263a~\nY\002\222\026\214\225\230\335\205\177\nr\355\232N\363oz\3006\n]\005F\033\317\201;M\302\356\272\342\270\337m\037\3306\260\375\022\022"
+	.ascii	"g\325\343\232\300x@\2730\353C\205\007\210\202a\256p\027&,\316"
+	.ascii	"\210E\235\323i\241\315\224\235\006\200k/\246\234\226\323\257"
+	.ascii	"-c"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndCompression.part.0.107.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"M\t"
+	.string	"\266P>;0\345(\035\200\037\177IR\\-4\037`\235SE\205];\253\263&\202\332\310+D\375\372}\340\"~DK\325\306d\033\016\006\026\005\024\342\216\262 \001\005\370A\032\331{\357\224\002,"
+	.string	"."
+	.string	","
+	.string	"\257\325\026\264R,`"
+	.string	"v\227~\306\216\223\036\241$\371w=\340;\225\0363\247\214C\202KL\302\356z\323\270\347m#\330>\260-\013\"\355\023cR\262B\205\274\230\340\fF\225\243\274\334\230\262\245l\261\f\240v/f\262\345\230'\036\366]#\233\343>\017b{\204a\222\335\3621o\3335\375\363I\016\363\370\254OW\317\323>mP\004\374g\201\330\306G"
+	.string	"\227\212X\262\037\322\374\221\277B>\313\023\"\370\357\323\017\3564\265\243 Q9\f\335\246\201C\035:\033\017\355> \2521p}X\370P\210Z?\224\263\r/7\246\274\255\240\250\230\"E\214*\333\031x\221\007\022"
+	.string	"g\325#X\201\361\300\343\006\362\026\252\f\001Q0\314\025\016\303\304\305\031\261\250s:-\264\231\262\323"
+	.ascii	"p\355\305\224\323r\372\265e\f"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.part.0.114.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\354\001\205\021"
+	.string	"\366 tG\320VM:d\345\026\241\003\207\201W\027p\2029\002\242\030}\013\003\303\233h\0225\346\314\365\216\236\333\241>\276\246\270x\036-\326\202\034m\035=`\276\342\033\264\302i@`g\023h_\350\204 \252\202X\262\267\224)\005`"
+	.string	"b"
+	.string	"Z"
+	.string	"2\370\331\274\035\333\376\320\211h,\253\200cS\202\302P\020\355\210i\367S=\256\274"
+	.ascii	"\367\bO"
+	.string	"\200{\324\027\227=BMN\346g\216W\363\210\301G\351\206\004\207w\342\020B\020\001\244\006`\311\205\020\2247K\r\340\341\300\225\335\275\321S\307\273\311\034p\356\304\262\273\356P\334\247\333^\331\276`\247\202\247tr\351\237`\221\216\212\212]\022MOvE\374\021T#\346\030\270=\237\215G\345H\020&\"\246\235}\f\216NC\3061\007>\033\217\005\030L\222\374u\267o\231\337<\301\207H\214\335E\3357\212\331(\233\306FY\363_\354[o\307\232\2371\003\005\354\254EO\217\335u\360\350\007\335\243\375\242\230\003\372\334\335\032\325\232\355\026\227\372\272%\231\245\023\333\254\363hu\273\033\301\337\021B\203\017\004\343\036SSd<\307u\300| \273\274\344s\036\375\027}\371(\t\365\330d\323\r\333\261%\235mwvw\301\343\215~[\223\246\"5\t%\265f\345\016W\177\354\224t\374\367\303.\255\001\336\220B"
+	.ascii	"k\301\314\254\242Y)\227K\006\020\256\325\013\253\205\303J\345"
+	.ascii	"\301\245\245\203\212\365\202\251R\t\354\372\320z\251`\\\256\227"
+	.ascii	"\ne;\017W\177l\200&\224\004\3632.\365>n\202&\024%\177\031\027"
+	.ascii	"U\307vT\263\330\350\21556\030\261Ddc\225\205\365\022\220R(\201"
+	.ascii	"Z\203\252\232FnCRU9$Z\224' `\002!\347\350\034\354\354\237\252"
+	.ascii	"\3363\305B\2740\322\214\360s\301\216\3137&\267_+\353\304\213"
+	.ascii	"/\225\300dH?\341K\230\261\b\206\334F\242\036f\034.\030\n\035"
+	.ascii	"\016\321\277\020\363\2462p\210\2601]\336\266g\213\354\222u\215"
+	.ascii	"l\3358%\022/lG\003k\256VMv\003O\300x"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`^\005\245\022"
+	.string	"\326[jJ\300\224Q:\330VY\266\236?$=\316\f\341,\304>\316\267\374\357\254\314\234a\304p\024j\223\\Mr\216\3757EQ\320\b\365\006\022\001"
+	.string	""
+	.string	"\200)2\330\267\377\355\177\373b\350'\320\247\273\344\300u\227\331\226\025\020-\267L\001Q"
+	.string	"V"
+	.string	"W"
+	.ascii	"\263\205\355.\265\373\bm&\234\335E\244Ov\023\211\265\2045\267"
+	.ascii	"\020\232\233I\316\334>T0\037\354\356!\363\022_\247\2211.\026"
+	.ascii	"\314\275$_b\\l\024\332f\2658\350z\t\327V\337l\301\204s\034'\013"
+	.ascii	"\373\366Q\217\226\3149'\313e\244mq'2,\334E\025\356\031:\347\264"
+	.ascii	"\r$\241p\327\320\t7PZ\204\204V\030\341\206\001\341~\361\3409"
+	.ascii	"\016\216\323\3407\fn\263\340<\251\363\235\202\353d\202\347\020"
+	.ascii	"\034w\3009\302\034\226\020\307H7\277\331\334&y\246\021\356^\323"
+	.ascii	"\235\226\373\314EGB)p\227\335\036\223cK\270\224\\\312\352\334"
+	.ascii	"T\353\262\241\320R\253A\324C\220\\\240\250\245f'2\324\366b\250"
+	.ascii	"\230\311\006\370\2516\375$1\022O\253@\247\355\211\253\243\226"
+	.ascii	"Lq]\336\020\367\021\210\033\307\316"
+	.string	"\235\364\341\216\341\341&\352p+q\270yl\270wh\270ud\270o`\270m\\\270\003V\240j\220\t&%\001\260U\240\232\227\312\265<\252BMF\220PZ\253\277\024k\001\350V\253D\352`\260gh\267Z\365\361V\005V\307\023\002\253\277\025\324\312\212\243nPi\204\317Iey4\025\244b\205\211\312*Pe\022\022\246\237\223\016\2218\361#6`{*}\200\224\bY\2501\024\207\203\325HIR\320\322\030\360\002\031\242\322\034\021\200\214\203\235\200\b\215\021H0\001\245\231\007b&\024\234~\306\271Y\006tohZ\270k]q\376\376\267\314j\277z\025\223\200uy\"\321\201\221\340'\201f\344R\034J2\222\0218\311\310\371\357\t\024\244\215\274\022\026\351\200\353K\215U\"\363\227gX\034&6\031\315xpHv\006\265\367\313\204\267\007|\262\005\307\373\235\350\353[m\347\217\302\300\312*Dn\207\321\026"
+	.ascii	"r4|\374\307\203\333R\261\352\f\362,4\026Hz#A\301\256\333%Pf\247"
+	.ascii	";8j"
+	.text
+	.section	.gnu.lto_.refs.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\005\005"
+	.string	"\242\214\035\021p\232\316\030U\336Q\361P7f2\315n\264I\006\272(\035b\344| \313@T\251|4\3075\030{\224\2133Q\355\244P\251Z(Y&\241\t4\"9\354\224\206\302\204]N'\3555\347\203\005\027m\203~V`Ws\316\336\034\263\022\333h\331gQ\207\355\262T\271\005\234\262D\327\355\247\302x\211\200-\334\022\336\211\355\240m\324\024b\353,m\247\267.z \020"
+	.ascii	"-\302\232E\030B`J\260\256\007\235\202a`\r\330Ni\334\262\310L"
+	.ascii	"\031AE\032*t\253`)\321\320\037\250("
+	.text
+	.section	.gnu.lto_.decls.ce90bac158a33b54,"e",@progbits
+	.string	"(\265/\375`j7m\342"
+	.ascii	"\352P\025KX LI9\351\352\277\257\273\272\273\352b6&\262\373n\366"
+	.ascii	"r\327\t\250=\252\264s{\377[\346\326\177\375\273w[oo=\317\340"
+	.ascii	"\340_\355<\262\370\255\b\241Z\234)\307\257Y\212\207\033\236B"
+	.ascii	"\332\256I\314\f*\247q\177c\365qR\213\351d\265?s\234\246\265\275"
+	.ascii	"\345N\001\376\003\207\004\326\004Z\226\362t:w\323\211H\305\033"
+	.ascii	"\334\251\240\250\233\261g\355j\232\031r\323\312\305W\002\246"
+	.ascii	"P\341!Y*VO\004\024N\030\244\272);\244\221\332\250\217n\364\353"
+	.ascii	"\345\207\025\215,|\326\356\2269\325\037fRy9G\223\272E3\265\213"
+	.ascii	"\206\352\250\226\352\245V\352\247v\366\212vj\026\255\242\233"
+	.ascii	"\254\264\221\272\350\215\242S<'\232s3\347|K\366\3534\222\335"
+	.ascii	"b\003o\23137\261\226\004(\312\002%\325\227s\264\203\234\016j"
+	.ascii	"|t%E5\240\351\242\243\013 \022U\230\255\006\341\247-Dm\242\264"
+	.ascii	"2\274\273(\256\021\205\b\215\306of\316\021\362\250\323\222\033"
+	.ascii	"S\3377\270\330.6Z\222\262@\331\342re\377fn4-y=Y\277c\037O\232"
+	.ascii	"\313|\232#\322\370\255\244\276\213\324\333>\365v\212\232\241"
+	.ascii	"\211\372[\275_\t~\321\360A\245\261\255b\255X\351\0056\357.}L"
+	.ascii	"mf\272\214\325\305\220So/\020\332@{\201\360\266M\355`\317\324"
+	.ascii	"\333\034\352-\227j\237X(V\352\301F\271mb\353\016\323\214\346"
+	.ascii	"3\030(X\250\322\032\337\306Po=\bm\254\007\341-\013\265\203\325"
+	.ascii	" \304\026G\030bj5\314Y:%\270\350\355M\253\361I0\247"
+	.string	"D\330dGFKr\253\304\006\2065&W\215m\021+\027\270\246$\256\2615b\217X)\007\026I\324\246gpQ3k|\244z\313\201\360\006\006Z\016\204\337;\025\031#\\Vt\215\377\243^\003\352\243\026Gh\333\240\260\230T\032\237\004\365Vj\331\210\304p\361\242\353\373 \204W\231\311\231,\347\314\201\246I\223\224\334\370!\250g\2638B\016\324\346[\020\262 @\\\210\212\342\321\370\026\210U\263\317lA\215\2234\314Ec\353\303\232Y\351\006\213v\373\303\246=\310\214\346\250\325\323\"bj\234\301j\0206\002T\034f\016\341\255\232 \347\300@\273Ah\243:\267e8BgT4\333\214\230q%\326\370Z\034\341\206\227\034m0\262x\\`\023}J\272\332a\311<\\\243\025\317\234\226s\364\206\306\017\nQX\343G\255\006\241jq\204\277\265\221c\321\343o\022,\340\266\376n\200\223\372\337\030\nh\032"
+	.string	"\220\026\177\207\300\224\244\343\374\006\312\210D"
+	.string	"m\n\226Z\351\357\0256\377]\177;\327(\344\224\354(\272\206\037\323`\030\016\370\006\336\377\002b\201{\223\301\366\227\377\302\260\322\377\215\321\315\323\374\327\tKg\200\350\267\022\370\233\371[*\277\255\322\313\337\242\320\371\357\235\023\374\335c\202\006\330\001t\t\376\377\375=\202\020\37752\363\337\263V\376\026\204NJe\376\213t\373\337 =\032\311\001\026\226\266"
+	.ascii	"\277=\321!8\005\277\025z\206\377\016\201u\006V\205\361\034~\363"
+	.ascii	"\337\037\277\375\352\240\316)\332o\370oO\267\300\325 hb\003\375"
+	.ascii	"\035\323?\377\rp\016\3779x\316\177!\360\367\t&\376Na=\314\177"
+	.ascii	"\315\376\366\371\373\003\177k\340o\n\374\215\302\337%\374\355"
+	.ascii	"\200\277G\374=\302\337\"\376\376\340o\r\376\336\3607\316\337"
+	.ascii	"2\277\245\373[\375[\3707\376\333\3766\360\267\\~\353\367\333"
+	.ascii	"\267\337\022\371\255\226\337\356\375\026\313o\257\374\326\312"
+	.ascii	"o\247\374V\312o\245\277}\362\333\350o\305~[\367[&\277]\362\333"
+	.ascii	"\"\277\205\373-\333o\205\374\026\310o\321~[\366\333\261\337\346"
+	.ascii	"\370-\330oq\374\266\306o\273~\313\365[\255\337f\375\366\352\267"
+	.ascii	"\320\337R\340\267T\277\025\300o_\374\217\362[\251\377H\376\247"
+	.ascii	"\375W\373\255\006\377\273\374\247\373-\324oY\374\266\351\267"
+	.ascii	"+~\213\364\237\205\337\252\377K\374v\205\337Z\340\267\025\370"
+	.ascii	"\255\210\337\032\340\267\034~\273\301o1\370\355\005\377\203\374"
+	.ascii	"\007\362\237\307\377\035\377\311\376w\340\177\222\377\030\004"
+	.ascii	"\006\006\006\376\352\210?F\001\177\001\236\004Y\326\016K\371"
+	.ascii	"r\273\262\322{u]X\247\n\304\352./;\243\036\\=S\177a\334\347o"
+	.ascii	"\214\337\030\027\332U\362r\224\323\303\377\275_\350\203Mnx\001"
+	.ascii	"i|u\206*\314Lg\316\271)\030\315N\242\031\241\rZ\353\341\247\261"
+	.ascii	"\027\347\354a\315\231)\265\313\242\332 \302|\361\016\371\301"
+	.ascii	"i\316M\350\322\001P\246&\024\312\350\f\232\227M\257\345\2153"
+	.ascii	"C\227Fg9\337\344fsY\3023\337\030\235e\246\\\324\204\311\346("
+	.ascii	"t\231\233\317|\223\233\231\331\301\250\te2:c2\335\030\235A\231"
+	.ascii	"\362\0314g\310M\246\363\250\231\2357\371\fz%\237=\2312\030\235"
+	.ascii	"=\231\214\316\240Z\326\305\021\264H\323\231\035\226\221eb\324"
+	.ascii	"\314JISLg\206\251Q\364\231\355r\266i(\262S\203\234\247\236N;"
+	.ascii	"&\224e#\232*\021\ta>\355\206$\"\253gnN\215n<s\276A\004\224\223"
+	.ascii	"@XF\247y\313N\227WSy\005\212\234\003\220\224\363\322\346i\316"
+	.ascii	"y\231s~qNEsv\221\301\350+))\347\250\234\244<\265lC\221s\247\335"
+	.ascii	"\2611\031\235Y=u\332\320\316\276r\212\350\322~e;\250S=[\226\345"
+	.ascii	"\025X\324/&"
+	.string	"'\275\306\227\252&\013\252JiO\275/\204N\266\332\356\242\\)\037\254\037pt\027\252\206\017i\317\210\232z\237\036wYl\031Yn\22595\215\261\310\352\202i\003\304\321\242\361]\272\316_\246\253\224/\023\b\317\234\231\227\311fK\316L\033k3\2606\003,fE\003\210\020\377\205L\275H-H\225}5\334\255\264\341.\022\214Q\316N \274\345?\275\276\354tzpU\310D\321f\2744\325\207\200g\2277\255B\327_R\246|\345u\226\232\345M\316WJ\262\004\366\264\243\330\251\026&\243\322G\002[\256\347\3544\n\213U\311\3139\267\221\300\346\353-\034\210\214N\330b%\213\035^`[\261v509C\347\356\254\\M0\347\347\335m\336\242\313\274)n\356.\367\250\271\\\243\273\274(\254\264\003{\357\035\327E\236\223\026\330S\254\234\235j9\200LJ`Sy\231\221\307\307\327\301\f\233\236\326\217"
+	.ascii	"l\001\224y\322C\303j\334\177\036\250q\307\303\254\317J\333\217"
+	.ascii	"E3\t\220\306\255\245e\320\004\376\005\2365\376\336\343p\213\266"
+	.ascii	"\261\2711\365\302,\265\257\264\236\225>Icy\314\225\034\034\226"
+	.ascii	"\306\027R\251?\201}\022\341\205R\352\205N\352\205G\352\205D\352"
+	.ascii	"\203\200\352\203V\324\007\247\352\203J\324\007\335\3247]/i(\027"
+	.ascii	"*\225\327\325\370\r\345o'\375\304\312\331\247\215\024\025\177"
+	.ascii	"F\215;\344lq\204\335D\347]7\243B\005X\226\3066\320\342\b?\320"
+	.ascii	"y3\021\206\301\305\360k\374 \232\372h\356\271F\322G\037\3100"
+	.ascii	"W\234l`\215;\211\316[\211\375\301\"\212I\343\006\364PqvZ\034"
+	.ascii	"\241:E\263\013v\275E\343\230\250\\qk\3535\035ac\215\337f\327"
+	.ascii	"Ogn\n\237\2605\347\330\210\300$\3711$\332x-Zs\264\004/(\245\006"
+	.ascii	"i \235\326?ZH\253Yi\017\351\263\267\324N\217\353\214\332\007"
+	.ascii	"\021\"\274\274\016C\353k\035bV\206\264\331\224\274\036#\313\220"
+	.ascii	"\211\352\252|\r\351\035}"
+	.ascii	"T\263\214\346%\006\260\3355\205\345\034\315\351\240\003\031+"
+	.ascii	"2\250\214\324\340c)\352\f.\242\036\253u\231=\373\261\005\330"
+	.ascii	"\370\270\206\332<\272\207\225v4\323\310`\261\2451\033\237xy\234"
+	.ascii	"\360\370\251\036+\251O\323\242\236\355H\216\032K\234\272\340"
+	.ascii	"\320\332\002\264i]}\315\3253\372\250\346\346\\\345\367\245S\303"
+	.ascii	"n\351#;\215\032!\366\027C\333\350\033\215\243\301\254\264k\264"
+	.ascii	"\327\233F\177\275\023\3205\032\006+W\303\214f\347\b+Ut}\007E"
+	.ascii	"C\305\f\016a5\b\205\027M\375\345\241\376\346P\177\273\324\234"
+	.ascii	"\373T=X\r2\262\256\212\035Y\210ttfii\306\023\313j\254\210UZ\343"
+	.ascii	"\266\352\206\366\325\333\252c\3144\333\n\347\314\2646\203\032"
+	.ascii	"k3\b\306\301\3004\023\342_\027\317\206a&'\306l\3340\252\250j"
+	.ascii	"\252\370\230\262\244zO\345\340\222a\244\361\213\234`\330\227"
+	.ascii	"\364\251\361o\222\372\026g\227,\231q\345\325\335U}1\221\002\343"
+	.ascii	"\313\211\026\226\027yC\354\232uS\252\203\301N\177\235>\013\b"
+	.ascii	"\244.)/\215q\221\366\361\242\345jI\334\215\272\364j\315Fc\fg"
+	.ascii	"\227\330l\335\211\0315\306o\247\322\274\002K\322\030\273Y;\262"
+	.ascii	"*7$\215q\233\r\264\200lP\216,\340E\333z\302\203+H\020\274\226"
+	.ascii	"\363\\^\0311\206\347\236m*\206\034\257a&\fG\344\326\2441\026"
+	.ascii	"b\345\234D!\323\272Q3C\230\240\ri|\234\026hhX\rj#,\254f\211\207"
+	.ascii	"t\225v\254\206\245\024\0359\3758\224;\300)\376\201\227\212\376"
+	.ascii	"\344\316\366|\334\007>\263\031\242Dx\\\3620\023\031Def\307g\302"
+	.ascii	"\253\256\032)\350x\360\300Q\032Q>\276\226\241%\225\242\307q\264"
+	.ascii	"\267\320\205\355\341'\233\325\216'jdd\267D\223\215\260\260\036"
+	.ascii	"\200uU-\302\302\260X\016\022\266\273\246\333\306\025\370\247"
+	.ascii	"\343X,&\353\305\222\214\tf\312\307GA\321\215\0338\006\213\005"
+	.ascii	"\003\212M\306nM\252\205q\034\307@\303\366\304\265&\345\352\230"
+	.ascii	"\353\n\327\270zj\324sy\205\001q\177^p}\331(\312\003\315\020\027"
+	.ascii	":\2363\216k\034\323\370 \004\f\246\024\007\345k\214\277j\334"
+	.ascii	"R\250%\t\242b\257\327D\315\271\345ua\030~\230\030\033Xg9\314"
+	.ascii	"\324#@\365\361\304\304\204\265\216\267x\304\241\250\033Sq\326"
+	.ascii	"\261\214\037\306f)M\233\304\200u\245\353\211\013L\375\r\327\213"
+	.ascii	"\027\030J\344\213\217/\030c\315l*\3061\364%\352\205\266l\214"
+	.ascii	"\251\360\363\245G\033\336\037~b\030\200wTaW\205\325bv\345\251"
+	.ascii	"\252\367j`\254X\306\320\030O\335H\265x\013,\025\302\346\024h"
+	.ascii	"\322\245<\341\234\325Q\020\034u,e\355f\260\352\272\2540\324L"
+	.ascii	"t\231\253@=\301\350\341Mi\326\020\275\370\222\321\3707)\222\222"
+	.ascii	"\260\223\225&A\261ia\002\306\326t\354\244>\351\333r\324\030+"
+	.ascii	"a\246\236\001\007\205\231\260\363\210R\222\031/\262\213 pH\360"
+	.ascii	"R\027\315Ta\271\210\002\250^\205\n\214$Tc\312p\366\345\034\345"
+	.ascii	"\001\313\370\333q\207\221\256\013?\251'\027l\204\215n\213\023"
+	.ascii	"2\223i\0030\266(\017f\354\254\272`a\024\030\305\021\035syN\372"
+	.ascii	"\242\364\262\210\210p\363\031\262\324\013\224\245\273\333\262"
+	.ascii	"\201\233\267\205\260\210\207\226\216\306\317\300\244\342%^^\351"
+	.ascii	"\t\371\205)\217\t\f\200F~\201\201W\312\345)\203\326\204\t\312"
+	.ascii	"\t \340\345\"\324b#\245\205\005\311\335\362\313\245\205\274\301"
+	.ascii	"\310\321V3*\232\336\252\210\370\371\345+Q\f\246)\272\204\251"
+	.ascii	"Z\264d\250)\f\035\222\251\220\306\267\221R\367\366\256tO\350"
+	.ascii	"\344\374\323\353\243\001\204\301\357F \026,\326\356\204'\263"
+	.ascii	"i\203%mZ\246j\246R$\001\302]\271\322G9y\251\327\001\354Y\003"
+	.ascii	"F\205\312\265r\30237\215\260\361\274k\352\313y\312\0035\253H"
+	.ascii	"\312\216[\305\242E\315\340\032G+\210\312\241$c\312\224+\265a"
+	.ascii	"\013\200\272\325\260\220\"\345J5\340\210\311/\306\360\260Dy\224"
+	.ascii	"[\325>\362\022\331\245\212\256/\210\366\244Kn\356"
+	.string	"\311\223\013\265PyS\036\354\221-\032Ujuu\027l\210\355O/,X66\207eLe\302\344B\325<&\314Z\213\356\360:r\227\034\271t\006@\202\344\322\335:\2319\023\345\\\325\343\005G\336\237^_\f\036QT\215+\367Kw\347\360VQV\222\306I\256\222\227\025^j4\316$-\204Rn\304HaE\375\314\217\"E\332*'/\257\204xs\316\330p\273pnoo#\300\226|\251QR5\362\032\177\346I\275\214\236\272v\331\326.\224\b\221\013\345\023J\345\275l\031\351\"\202S/CC\210\220;%\202\215,\363\"\355\002I\273P5\265\013\335\340\027\325\232\241\325l|\231\024\352c\360\314.\232\331\225\236\235]\251\245\232\376\351\205\t\323\342\312\312\032K\333\n\006\314\206\325\2127\36516\324\035\267l\307\215\362\340q\243\f\220A\227\027\\\013\203aI\343\033\215\263Znd\341\272N69"
+	.string	"\221b`\250\217i\252:\356\230\216\366\023\273X\373\251\313\234s\374\234Q\036b\362td!\323S\017\223#\207\265;!3\2336\330\021mS\177m\330\213\003GS]\243\314\204\212"
+	.string	"\226\327TB\257[\303\353\202\ts\266\321\347\222\223\006\215\013f\2633\347\250\274\274\002\302[\364O\257\357~Y\351\005\033s\213B\365Q\320\212\017\017\246K=LR\227\225\336.+\347!3\231\033\354\370\372\323\353\203!\342\222^.\013\344\301f\276\332\361\225s\224\0074`bR\".ZVz\265\372\310\372\310K1)\312d<\365\345|\304\003\314\305\n\224-$Y\001?D\023\306#\211\232u'\006H9\f\002a<\006\005\035{\214\304!R\2314\036{`V#1\b\271*W\237\n\214\253\320\261\306g\3651\022MT\340c\002\205\344p-\256+`@4aG(\031\224\\\225\303\236c\261\370"
+	.string	"\241d\020"
+	.string	"J\364\330\274\240\024\n\202\200\222\030\2244\016\221,\224H\022\005p\240$\210\325g\250\330c$\202@&\207@"
+	.string	"@\271\263\216\200\230\024\026\213CF\343\321\370\"\202#\022Hy4\276\230\030\256E\274\"\207\204\260q-\"\225I\341\2124\341\004\01372\007\372\020\200$\261X$\006\t\327\037\237!\240$\321\270\026\205\326\025\220+O\320\020\005~\216\023P\256\0210\022[@\0363`A\2618d\002\tI\242\217\021\002?\307\t\030\217D\342\317J\202qHb\303\201>\370\020\205@(\201~\210E\0239k\320q\002>D\025\224\353\017r\250\2741\256J\024\220\253\nI\344zb\230\202\006I\230U\271\026\203Ve\362\205\022\032h\214\253P\005v\222C\312\241\262D\207\241P\211\325\005\344\232\\W\340\340\307\310\301\307\b\001\002\\`<\022{\214/\224\330@\005\234\344\261H\"\247\007y4\001(9T4\001\003\034e\211"
+	.string	"\334$\205\216\310\022xx^fB|P\"\207B\037V\345\013$\2240\200\023\303\024xx`\202\007\372"
+	.string	"\302\247H\034\332\3603\304\263\372\300$\225D\022xx\204\311\024\220\303\265\330\243L\016'\300\303C\243\034\022R\016U`U\016}\204.\220\363\036\"r5\256?\352A\020\201"
+	.ascii	"\021\"\234x\271\b#\204\030!\204\360\"\214\240\2433\202\b\035"
+	.ascii	"\365\"t\256r\335\3711\022\221C\240\022\312\235d\nk\020Q\251\256"
+	.ascii	";&"
+	.string	"T\200\034\002\365\340k\240<\320\207\035\017\031\260\300h\302\252$\"E\360\222\334\251@\271\003\202\b\021\034\213w\3751\016\221A\230\025\250g\330\023T\236X\225\306c\317\213\3228t$!\243\202\217q\255\351A\366\334\026z\216E\036\230\027\224\304\"\221g\310sD\n\311\360\b\221G\022\024()8\022-x\001\251\\\203\326\342\252\264\200\202\026\222\303\024z\214C&f\326\035\024"
+	.string	" \224\fJ\n\375\334\234X}\214(\254\312!r\007"
+	.ascii	"\007\372\200Ar\347\207h\302x$\221\341HT\016\221;B/k\017\321\205"
+	.ascii	"\325G\330\3233\334\361A\036{Vd\214\361HL&W\244P\320\261G\246"
+	.ascii	"x<\222\260\023T\036\350\003\210$ru\201\210\364\341\360\243\320"
+	.ascii	"\212\004\241<\036\221 d\220+\321\004Qi\\}\2101\311\235\031\f"
+	.ascii	"(\221G\0252\254E\236!\013.\b\327\235\325\347\230B\314\352s\f"
+	.ascii	"\302\353N\005\224\310\243\020M\322x$*\205\216/\253r\270\202\317"
+	.ascii	"\320\220G]G@,\241*wDxQ\252\310\031\237\341z\202r\347\203\004"
+	.ascii	"\024\211C\026\220\253\t\023C$\234P\316\270@\\{\326\025r\206\324"
+	.ascii	"\230\241rX\302\td\rR\251\002\n\305!\021\271&5\264\3203\344)\026"
+	.ascii	"\207$\326\242\017qF\271#BGi$\276\\G\207D\207\013P \002j\317\207"
+	.ascii	"#q\347\304\221\247\205\236a\221\007\204\2218\f\002\321\203L\202"
+	.ascii	"\370\220A\2133\231.I)\216\260\210\242 \212\352\341$\026\203U"
+	.ascii	"E\311WS\f\252_\034\013?\246\032B\266\245\036hA'v\332\253\312"
+	.ascii	"\221\265\024T\222{\013\343\302F\262\364\365h\0344\n\032\005W"
+	.ascii	"\300,c\236\272T\321\005W\004\221\334\250\262\027RP\205\nQ\212"
+	.ascii	"\372.ULQ \340T\360\250\275\232\306\360f\250\1770\305\245\363"
+	.ascii	"c\372\013\242\270-\232\206\022\215\275`\321U\223\322\262\n6\217"
+	.ascii	"\224\261\230c6\216\276\224Ya\203\0132\257\225\231\252\255\"("
+	.ascii	"\301\345\235"
+	.string	"R\303\340\234n\301\214\247[fbg\201\330\211\236\224\330\221\306\230\213\f\225\031m\025<\361\026\314\207\371\360\237u:\365\016`\304G\023\027}9\212\205\207\037\373\035\377\005Q\340e\351{\034\240Z\017'\215\261\226\307\275$\241\263\202\201\003\270w\245$\350\255\300\312r\253z\206\027 \031\226\250M^\337\336\231^\373M9r\203k\214\363p^\373-q\342\324Y\301P<\006\315TU.XM\237\334\223#*X*&\212\213\327\034\236\225\023B\025\001\006\231\322G]7\267\202\350\316\332\251jU\246HR\256\013\032L\376\226vHI\210\340\310\3218\212Z\nUlX\240\254\325Q\331I5n\322\004;Y{\242\2257c\265W\324\243\356\330\t\335\026\267\374cMN\016O/\360u\327\024\326\200\034N\244K\216\247wJ\375\241\245#Jc\234\004\323\005m\344a\021\241\303sS\271'\350\332\20649&%}&"
+	.ascii	"*FCt\260\261\341#\031\210\3365\205]\036|otF\216\217p\351X\201"
+	.ascii	"#\204\343\250\003\363#\222T\332b\b"
+	.string	"1gFdF\232$\215\001\023\025@@P\\2\025\255\323\332\r\023@\223'\364\311\036G\225B%\"3\005E\311\260\033\313\020?\311?\r,\243&&\242\333:\005\352\233\351\261\214gl\0216\275<\203\271'6\222\360\211\213\224\217( \300\301\255R\221\237\201\233U\215`qV\334z \374\235t\303\317\027\236\022\365\243c\345J\006\023\253LT.\372n\212/u\n(\250|\277\223\340\032\2654\253\370\231\027\266\327\247\361\361\242\220\244I\177\2016s\222\024\0137\024\226+MX\264z\267\023'\t\030N\351\304\261\237\207\307Ci`\021pG\337\b\r\f\2721*9\005\262\254RT\347\334\025\364-\261\365\306p\034\260\206\264i\231QC\374\301\272\210\r\335\221\231M\31501\017\036*\366v\035\310\351_\365\027o[\270\341\374\307\323\366\302\331^\301I\265\237qS\311c\310\023yq\034\006\317G\356\307\340\276"
+	.string	"Q\325H\340\031\370\225\371\343\315\025>\322m\312\365]\2210\256R\364*z\025V\322W\027` \254G\021gg0vi\307\034\302\233d\357b\024\307\327\355\351\nS\300v\272d9\234%\312E\t\212e\266\235\312\232S2M\207\316i8\177\306UT\206\255\251\271i|o\347-\322\306e\247fMM\220\313\206\326\266O\037\316\336\300\332E{\t\n\201X\250\007\307?F4N\001\031;\023+\300ki\203\234"
+	.string	"\345\202\243\270\001\303\"\340\007m\266v\023I'\225\240>\270\003M\300L\031uV\355\024T\241\237\334|\264\330\237\276lLM@=\2739\021\274\272\300\334\214\343\202\027\344\016\032vP\023\212\342\255@\037\355\b\305\003\357j\013\332\364\013\205\327\344t\212\331\362j\377\r\034Fb\242\013\355Ip\3743D\351pJ\223\312\327\327\024\337\343\310\271P\022\343.\2000\231\334\3049w\203H\264\226\313\003R\320\263(\003\316\026\323\222<\tER\317I\354\260\343\314+A\307>\253\243#\230yO^\207\302A\263`\232D1\035\332F\372b\261peZD\274\225\310q\2748@P\261\234\227\236k\371\017\211\326wJN?}(\351`\270\336&\242\271j\346{\253c,\311\351X\214c~e>\372\322\355\347R4\203[\330'\263\250L\240\310\324\213,Q\202"
+	.ascii	"\371W\016\314x\275\276\213\374\223\372^(\242\260\"5\304\271V"
+	.ascii	"\253\343\271\324\n\tKC\336\322\313\203\037z\327\224\373\312_"
+	.ascii	"P\376\345\310 \362P\234\025J\331\264hS\335\352\006\274\260@\234"
+	.ascii	"\263p\253\001\027\332\324\2552nB\231\225N}|\003k\f\243\330\207"
+	.ascii	"*L\244\255\003Q\227\034\264\217)\300\370\212\031\020\033\254"
+	.ascii	"\302\340\304Y\2076\224\360x\316S\3143\"?\270~\243=;\232Kk\027"
+	.ascii	"\326\021\3038b?.\350\261H\313\2041\336G1\272\017*X<\213\035\373"
+	.ascii	"o\004\220\325\362u\n'v\233W_N\275\370\001(\335\304\262*\002\361"
+	.ascii	"\212\024\303.\371t3\267E\263tY\371[\350\315\013\016\256\351\013"
+	.ascii	"\367\211\247_z\232\350B\337\201D\363\332\177\317v\374\364?\260"
+	.ascii	"\332\313\220\217D,\036\002\n\234\225?\315\016\035R\325\003e\312"
+	.ascii	"!-p\351\n\334\212\227\321\006\203Hl\250L\224\245\367\266\275"
+	.ascii	"\377\201\0252\303Q\377\304\250F\003Q\2126;\245\002\205\367\237"
+	.ascii	"\304\f\352\326\214\212x\251\374\263H\310\275\377\017\021\027"
+	.ascii	"7\r\307~6~\273\347\330\371C'K\342\210\240c\232\305y\001]\036"
+	.ascii	"\200Z\300\252\276\371g\341\253{a\310\033}t;\337xN`;\374\227\240"
+	.ascii	"/{\304\366\016\260[\324\305\t\363\030\2010\002\001B\377\020\037"
+	.ascii	"=TR\271x\037\3608\253\363\202,\207r\013,\345\310\225U\333{H6"
+	.ascii	"1JY\250\362\226\005\236\377\252/\026%\373\343\031\222,\357\365"
+	.ascii	"$\262KbN5\247R\341v\305f\354\\\327|n\017\343b\207\340\366N\301"
+	.ascii	"\374\002\t\351\177\332\260\264\006'\034\230\233e\326/\205\260"
+	.ascii	"\273\244\275\323\005\250\243\214\200\324y\241\354\r\320M\217"
+	.ascii	"\357\332v5$\r\302\210\025\032\347\206\tr\b\231Ia\341\243*W@\001"
+	.ascii	"\344\271\214j&R\374!\201\271\007\002T0\311\220\261\304\272q\032"
+	.ascii	"\0207\022\301\276\023\277/v/\312\327\023\361\256\n\213\272q?"
+	.ascii	"\004\216_\335\373\246\335\310\365\31083`#j\343\220g\325\005"
+	.ascii	"4z\364\244\221\373\326\350\003\021\200\315}\331\313?Z\246k\036"
+	.ascii	"\330\330JO\215\263\352\371\2656\tE\354\rB\347\343\324i\361\222"
+	.ascii	"\2374*\bp0\345\320\362\371?\031)\234\372\005k!\315\320\b\032"
+	.ascii	"\270%u\343D\316"
+	.string	"\217\020\372n#\306\"\260X<\261(+\021\340d\024~\t\031d\271?\022x^\200\364\b\316\312\204\333\312\272\206[]\340\035R\222\332\301N\262\t\261OT\343I\376b\013E \021VX\0279[QA\206\\~\345\201\212wkl\013\001\374\017\205jJ\234\001\032\301\345\030\323\271\316ND\311\331\023\335\351q@\320\257\023Pf\301`\323?\007\355\211\0041\353\334\360\342s\252\256T\371\213\221\3206\236\307\246ss\304\260K\370*\017\034\300\221\236~=)\351?mo\304Kv\211\250q\237K\354\267\323\206\b\370\326\350%(\214`&\177fl\212$YpG?}\371\017\231\371/\340\240\236\237\243\300\001-\262&U\252.YR\302^\373\373\257\207L\321\263\204\323\275\374[jw\235\003\200\020\221\361\370\313R\324\205\302\270\266$p\240\006\230\003\\\220\375f\330\023\027\214\243\363\226-\003OD\376D8\236O\n"
+	.string	"\240\221\267=wt&1\366`r\344\316\372V\366\362'\376\022Z\033U\"J\274\022\n\036\366|w\005\315\022\t\255\301@P\316 \371:U\311\344\215\021\251\022L\004\025e\345~E(\221\340y1\273"
+	.string	"\317\274().&t@/\rk$\226\312\3159\214\021\230\345? u\004\371\351h\210bD\030\006\303\034g\234\215\230\n\022IxK\373\352\327\024\203\034n\254r\004`\306\373\344!k.5:}\320Q\322\351\307\335,Ok\300I\337*iB\252\262\301\245\231\r[\325\215Y\030!"
+	.string	"P\030\2721\245:\272\323\001W\322\377R$\005\017\225\361\207HKs\350_\332\021\202\326rr\260\221Y\177,\360\306K\365\367:\037\f\246\236\220\334!\355ot\330\351\007Yj\373Sk\016poH\300{o\2320\267~\254\235\311F\313\233\2213\263\026v+q\350t"
+	.string	"*\3223\322f-\3749\227\371\022q\030q\005\331\n>\373:\275\f\323\321\001\212\227\255u\301]\250\325ud\177\017\261\001\365\211\237W\004\\\236L\332\253\2339\373\\\361>\253\365\336\3306\261\354E\307,\276\370Y0K\344}\211\317m,\200\207K\314\240\342\246\177"
+	.ascii	"~\355C5\347\212j+,<\374\370\236\227\236\216\227\266N!\251\372"
+	.ascii	"\266\017.\002\235\0073\027p8\213\005@,\324\r\344JcI\257\354\177"
+	.ascii	"\300\332\272qq\tG\220\034\005\243\200\333\344\331?\337o\331\347"
+	.ascii	"\271\203\343\372Q\230\273\017\243\312\314\363dU\251J\275XT<S"
+	.ascii	"UYlD\333i\210\334\035\333E"
+	.string	"\266[<\nYN\253\037-\024\345\264\343\2430'\002\3160[\376\303\334\001\351\002\024\352\227\336\310?\322\210\347cR\001\366\274\245\001\321\330(\266\237\255@\216_+\336V\321\306\233A\350\303JWc\210\\&}\032\332\005x4\252u\354\355\241\332\256%\240\037\355\357i\305\245\320rY\222\264z\330\273\032\247\\\365\314\277\353\270>\234Q\313_N\177\026~C\004\177\225}\365\346\026\022}2\264i\306\253&\357\215\325C\220]\372:b\361\257Q\317|\311u\036\270\314\267$Cs\013f\263\027o\367\\O\302j\340\036\242\354\260\r\367\377V:\0057A\374zA\321\256\343\277\276N\367\274Y\335~\250z(\216\313\203\314R|7\267\333t\034\021\367.\027\355La\311\334\007\362\270\364n\236\217\"L\023i/Qp\032\3469\267\037o7>\r\351\261\363\260s\310\376\017\277\251h>\377\036\251\370\323\325\367\204\013\026"
+	.string	"\206H\303\001\316\270\235\001\231{x\002.\316&p\371\316\316\032H_\203\366\\1\236s{\320#w\272\223\177\276\333\205-\220\177_\254\217+\236\320\264\227O\314\026\262\001\203\301\300g6wt\372"
+	.string	"Cv\037jS\277\273\035\303\325\357.\234_h\223>V\231\332\211\272\337\016\217\351?\234/\004\270\0330\016\333\260\273[\257\212{\301?\336\230\346;s\367\335.\362\271\204\351A\350\336\001_\274th>\344\336\017)x\210>\3262\3723\336do\321=\344\335\276\f\3777\t\275\212\300\336\341\221\036\001\243\361\030\352-\213[\3542\234w\206W"
+	.string	"\275/\373\024\3453y\027Hq\316X=<"
+	.ascii	"m\022O8\260\213\334\013\270:m{\320\3315o\227\353\317O\263\316"
+	.ascii	"\257&\2749=-t\t\365'Yy\353#\255\237\207\032\231g\243\355\214"
+	.ascii	":\310\261)o\275b\272FG\264`G\215\352\n"
+	.text
+	.section	.gnu.lto_.symtab.ce90bac158a33b54,"e",@progbits
+	.string	"blackboxOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"blackboxWriteData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"blackboxDeviceFlushForceComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"blackboxDeviceCanCompress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"blackboxDeviceBeginCompression"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"blackboxDeviceSyncCompression"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"blackboxDeviceEndCompression"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"isBlackboxDeviceWorking"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"blackboxGetLogNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"blackboxCompress"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"blackboxCompressSync"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"blackboxCompressFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ce90bac158a33b54,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
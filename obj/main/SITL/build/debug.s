@@ -0,0 +1,230 @@
+	.file	"debug.c"
+	.section	.gnu.lto_.profile.2773fe00891e94ab,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2773fe00891e94ab,"e",@progbits
+	.string	"(\265/\375 &\375"
+	.string	""
+	.string	"\270\032"
+	.string	"\004"
+	.string	"\355\273\304\350\f\001\240\342\234\212\n\002\003\240\342\234\212\n"
+	.string	"\002"
+	.string	")Bm"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.2773fe00891e94ab,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.2773fe00891e94ab,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2773fe00891e94ab,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.2773fe00891e94ab,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.2773fe00891e94ab,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.2773fe00891e94ab,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_debugModeNames.6.2773fe00891e94ab,"e",@progbits
+	.string	"(\265/\375`\033\013\2656"
+	.string	"zc\304\02560lM\007\003\324\215\317\227s\217~5I\342!]\343\350]\205v\013"
+	.ascii	"C\005\bt\255\332\236\374^\322\215\237\375\336\334\030?$\311U"
+	.ascii	"Ah\233\256\177K\013i)\311P\001\\\001K\001~W\341\265\274\371\235"
+	.ascii	"\357\224\366l!y\244s\274:%\322\267\247=_\370*q\216\347\313\323"
+	.ascii	"\2361HI.\322\236\365\223c\235'z\361\224H\337\037\3559\003"
+	.string	"\223\243\235;J\356)\221>9\332\263\206Ob\272\243\367,\221\276\r\217\204\363GI\037\207'\202\372\243\027\255D\372\230h\317\035~n\207CJ~,\355\331\303\254\324!\275j%\362\365\264\3470XC\217\224\024k5\364Hk\211|<\355\371\203\2525\257\304\226\310\007q\352\315+\275O\247=\207 etKI1\332\263\bQF\267\304\242D~\024\355y\354S\233_jQ\"]\225\366L\326\351\205_rK\244O\322\236\3134\301\360<\031%\322\367h\317fyn\236G\243Dz\235\366<\242R\r\347d\243D\372\027\355\231\204$8\347\364z\025\355\271\004\2447\357\224\243D\372\022\355\331D\243\035\336\351\005\242=\237P\264\303\365z\224\310\032\3323\212\2738\327s\241=\2470\004\347\236\222?J\344\232\366\254bP\234{z\203\224\310 \037@r\276\227D\321\247\217\234\357\275e~\364\310\371\250\244\330\037?"
+	.string	"\364\214\035\217\034\027\227w\022\026YssHW\342\371X\"_{\306\276,\030\227p\001\206\036\321\337}\242W\364\214\276\321?zH\377\276\244\247\364\225\376\322\347}\246\327\364\234\276\323{\372O\037\352E\375(\262/\365\246\036\325\247\372U\317\352]\375\253\217\365\262\236\326\327\362\t\031\363\021\021q\224\243"
+	.string	"\323\034\222!*\260o\210[\207$\200*\2769\270\016/\200\237\205zH\002\020\242=\373`\255yx\177\255\326\302\222\300\254\n\r\003\002O\305\211%\201w\3323"
+	.string	"RF\261\027\210G\357\301\215\275\321\236\267@\r\307^\340\030\355\231K\017\216,\t\304\242=\007\330$G\366\002\245h\317]\230\216veI\340\020\355\331\313\322\321\256\354E\245=\013\230\364f\366\025\351Hg\366\346M\332\363"
+	.string	"Go'\222\222\264g\260Eo'\336D\3323\001\274c\035\212d\037\355\271\300\241c\035\2127\033 \364\226\"\231\321h\317\007\002\255\245xs\026\355\031\201\237\243\235\212dV\242='\330s\264S\001K{V\360y\214\016\350\367I{^P\347\346\200^M\3323\003:r\036(\371\243\244=7\220\023\347\201~\016\376M\352\202\222\277\007l\336\\\320\317\215\366\f!\315\261\316\007\375\300h\317\021\336\f\234\017\372Y\321\236%\374\0307G\224\374A\321\236'\2009\3329\242\3677\247=S\350r\244\013\016\360fQ\\\200\211,\326\240\313\236i\313\246\255\331\262\256\032\221\335'\003\274n\363,\343`ZtQ\265m\327\235\326\272\250\361d\321\355\262E4\005\330\214\314\r\242\254\221h\344\302m:LUW(\334\302A\2645\325\265\270\321\226\230\272B\341"
+	.string	"\334\032\213\255qu\331\3263\265\323T\317\006`T-\016M\326]w\033Z\027F#\246\303\264u\3316\027\336+KDYw\r\335\302.\f\"\204\210\215\262F \226\021F\003.\206\333\f\261\0317j\300\305\020\303Q\003\306\233\230\f\036=\304\302\026\340\034:\334x\210\371\310\221\203\207X"
+	.string	"<\266Q\326\b\304\236\307\355|\217\363q?\376\307\003\271 '\344\205\374\220#r<O\344\213\234\221;\362G\036\311_\237\344\224\334\222_rL\236\31179'\327sO\016\312C\371\236\217\362Rn\312Qy*_\345\254\334\225\277\362X.\313iy\255\027\362C\276\310\033\371#\217\344\225\374\222o\362N\036\312G\371)O\345\255\374\225\307\362Y~\313sy/\377\345\303\274\230'\363e\376\314\243y5\277\346\333\274\233\207\363q~\316\323}\235\267\363w\036\317\333\275\236\347\363}\376\317\003zA?\350\013}\030%\256\304\214\252g\333\311\205\3336\332\266\346Y\211\203\250"
+	.string	"t\270nTE\317\342\272\252\301\264Xv\235\033\fU\321\210&\027\016\2007\252\032\203h\332\311ra\265\323lY \036\026wq\330\272'\213~a4hl\323V5\267p+\024\3760:L[\267\025\n\267\332\324\330-d\3314\241\327\026fan\001X(L\203_\370\013\253\235\253z\226\221\215\231\261\231C0\314\032\317\330\214\333\275\026\205@\334\205\333\332T5\215k\356F\203\304T\210\242\021\315m"
+	.string	"\013[w\233\301T\335\302\252I<\203\246\027\006!bM\203ln\211\350\336\306\363\013\237\261\306\037\336+q\243+V\264-\234\326\356\037f3Ut\273\303\215\266i\027\336(15w\353\256\3734\275\260\027f\331UuU\223\210\226~a\2645\267\213FL\323\332u\035\262\356\271\t\340\020c\302\242\352\022\333\202%N\213\254;4\356V\r-\262.\333\036\200\333v\213\016Q\025m\r\340\215\266j*D\317m\\\331"
+	.string	"\230\270\246\355\211\356\275\236\356i\n\300\247\251\232\247\253\232\306 \030f\367\2727\352\016\213\333m\32746\b\206\213\306\200\304\250A,b\254\265d*)J\222\2440\034\340\"!\032\242\007\021\260\214c\025I\255=\003jH\347\260\020&\234\037\354\360\004\021(\344!\200\267\304\004\025\213\265\276\270\271\221\006\3618\337\rI\207$o@\3740\007>X\027 \374dDG\315\312{\302\005*\243c\343\0231\221Z-!\202&\210\302\305\277q\236\367\201i\003\026\212\261\305\027S\373J\340\274V\254\326\023\361\225\255o\250<\256\242\201\\PH\304\323-T\252\350\276u\032\201\020\307\324.\261\347\367\020\227H\267gy\301Ez!\225\203d<\035#\254YE\327U\356\312\237\016\317\016B\236\232\024\242y&U\001\003\204x\373\377\371k\377\346\260\233\351t\270\2719\347\033\203\337\003A\2719\335\273\254\\"
+	.string	"\200\245}q\020d(A\335\373\250?\232N\370\220T\357\3632R\215\031)\033\344\223\277\335\374\202\344 f\312\277\376\340\342\234\351g\322.2\372\260\002\372\305\210\013\344\244"
+	.string	">\310\347T\234\272o\306\311K,T\315=8\207\250\322iD\317y\355t\314L$x\221\343\203\335A\"\262\362\307\375\305\024\236\235"
+	.ascii	"y\343\205\220nd\031$n;Ac\024\354\r\343\353\316r\016\240\314\205"
+	.ascii	"2\377\021C\221z\334+\222\340\321C\270\203\242H\263\247\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2773fe00891e94ab,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	"\201\204\001\005\001\004\002\003\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.2773fe00891e94ab,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2773fe00891e94ab,"e",@progbits
+	.string	"(\265/\375`h\n\3752"
+	.string	"\332^\274\023B`^N:\347^\237\225\"\270\230\343!\216#\365ss\255\377\007\366F\036?\307\261\336tr\266\243\260p#\356\231?\3056\026\274\203\362N\302dy\260\231\330\221T\300\001G\005\255\227\235\250E\276\207L)\367"
+	.string	"1\0013\001g[}7\373bn\366\266#d\232J\245iz@\310dI'h\253\375\2663\207\212F\244r\200\260\314\312\353\212RL0\216\220\227\253\255W\373\232\317\36643q\360\020\220e*&M\323\263m@\246i\324\331\204~i\032%\374!\374\020*\331V\230\333Y\255\001x%\352\217\261\217\366e\322y\304R\246\3144M\205\3023{ik[\255\374\360\004\216y\322\351\237\331\3002\345\340\001\300\b\351\207gE>\351\364\002m\223\261\237\302>\n\373'\354\233\260O\302\376\b\373\"\354\207\260\377\301\276\007\373\034\354o\260\277d\037\203\375\013\366-\330\237`_\202\375\007\366\035\330O`_\311\276\001\373C\373\002\354\013\355\037\3317\262\177\332'\262\277\366o\373\317v!\333|\266\005\331\376c\333\217m\n\366\233\330\336c\373\316\366\234\3557\333\325\266\234\355m6\233M\333J\333U6"
+	.string	"\242\200\376\004\330\313\2635d\253\377\307~\336\375\234\rF\232J\025\245\246\210m\315\360\341y\362A\375>CxTqW[\211\236\204g3qx\362x\337\343\2414\2152\246%=\272\271p\332\t\333+\333z<\317\363$\203\353\t\3607\366Gh\253o\004\372\f\3167\317\340\364\243\350\222\247\373\335\007\244)\027\231\026"
+	.string	"r\342\270\244\356\354\034\231\246L\244*\2650Y[_\3679O*\335\316\247\363:&\212R\246\312\377\251\022\204j\253\200\017\317\365\001\374\221\246W:\337l^\3514\021h\037.y\270\317\005\213U\254-/=b]h\221\234\352\332\352\317\3317\3633\217\263\333gD\373\333\352\307\261\257\346k.\267\3104};\301\254\351\302e\353\331\274\315\223\025\356\306\177s8\016J)\323\2644U\n\203w\200\2400\267>\270\001\364+\234\302W8/\340I\347\321\240~\032\020`\\d[\207\236t2\241~\334\031F\215V\337\326}\340\002\350\217\375e\311\227\375-XLS%h\024\343\026?|\351\361\311\005\341\2369\263>2EL\314\210\234Q\032a\025\313\004\273\265\\Hu_\276\334m}\361\303s\200\032\324;\005"
+	.ascii	"\\^Y\022\255E\372\351\361\365m\365\"\355\215\262R\214\210\330"
+	.ascii	"\361Ym\375\202'\250\027J\321\227\226\031\330V\005N\262*\022)"
+	.ascii	"\345\316Vo\226\275J\266\211]\324\327\327\326o\021\324\213u\224"
+	.ascii	"F\311\262\r\223%z\214v\340\266z\227\330k\265W\213\345\310\227"
+	.ascii	"\333\326'P\202z\253\202f\312\350\270\266*-\325\036\357\254\305"
+	.ascii	"i\333\352=\332\347\263I\340\346\324\274\266Vx\203z\221T\256@"
+	.ascii	"I\270\0341.\237-4~[\275F{\213\254\221\263\301x\253\353C\265\365"
+	.ascii	"\b\236tn\021\365\022\001\"\277\200\331\332z`\207\b!B+\006r\333"
+	.ascii	"\352\025b\177\320N\035}]U\321m5\363\303\363h\250W\212\216\231"
+	.ascii	"\275,\033d\243\356\274\316\344l\365F\275\005\245X9\261C\275@"
+	.ascii	"\316\277>#\314\255\302\346\237\321\3241\316\324V\377\317\276"
+	.ascii	"\337\013\235\3150=\343V\237\371\360\0040\b\365\t\031IY\271e\331"
+	.ascii	"\032\354\343\003.\231Bk\262\325\347\263\037\350\202\002<\341"
+	.ascii	"\302U\367\341y\244\207\372{DM\344\264\300\266\032\005\304\027"
+	.ascii	"\036\210ON=\212\202\304\027\035P\342\223S\021\021\361\005\223"
+	.ascii	"\006\342\223S\017 \217\246\034N,\236\240\234\2103\232x\034Y\311"
+	.ascii	"P:\232v,\021\241\240v,\031\355\210acF5\212\226x\320b\005\n\340"
+	.ascii	"\f\fK4p8\365\220\261\364\344\024#\307\322\214\035<\2260 \340"
+	.ascii	"\321\224#\306\212&\032P*j\364\220\321D\003\251\215\231\245\325"
+	.ascii	"Ud\231N\203\253\362\225\307\266\346\245\346"
+	.string	"v\265\325\273f/\225U\363\321,\204\027\b\365\246\311a\223\227\034\263\334:\342\331\245\275\351\242\035\311\275\241\303g\005\365*\233\3154V\222gjj[\216[\275g\366\212Y3$)\313%\326\326\037?<\tl\241\3362$\252157\262\261\027T[v\214\rF!,F\350\266.\030\324\033\246A\2315q[\213\276xA\302\313\022\323\333\352\365bo\227\025C\202\323\325\006\311\326#?<\013lA\275\\\214\310\310\025\n\333\232\244%\f-I\225\330Vo\230}\275\315\302d\264Be\253\335\370\241^,a\212\204\310\256\200\035\245u^v[\275`\366Z\331\2575:\301\352\263\325y\037\236HTPo\225\rc\312\311m\r\340\325e\307\205\306\316Vo\227\035\200\266\25010E\024$\214\023\021\031)H\222,\007\240\"\021+\252m\021\220\241\202D\2602\262u\003\203%D5\222f[*\203z\261\022\203\275"
+	.ascii	"\t\327\366\326&AC\340\030\223\006\013\021\201A\367,\r\b\355\032"
+	.ascii	"9\341\021\th\t&\204\003B\274\253\323\240\351\t\203\204\356x\330"
+	.ascii	"Bh\220\002&\2021\026eM\334\374\260\306\006\323\227\002/\357l"
+	.ascii	"D\204!\256\370D,.\\G\262\213\345,-\2633b\226!\031C\336\201\306"
+	.ascii	"C\3278\322\"-|\313\013\002\236\322:\333#f\031\3222\344]idt\261"
+	.ascii	"\034\374\225\026\212f\301\036\001\275\313e\245\263\210\255\024"
+	.ascii	"RG\312\362pB\205\036t\037\305`P\361\313\210\226\363\330\306\222"
+	.ascii	"\340\0046\b\f\234]\032\215\3319N@\316VZ\037\266\206A \026l\356"
+	.ascii	"\315\334\327q\204\366\210n\220\030\304'\226\027\325\325\341\324"
+	.ascii	"\321[\366T\324\215\314\363\001\303P\216\247%vt\3142I\230;}\254"
+	.ascii	"\325\324\306\336\261\345\001\n\324\263&2\253\225\246\356\313"
+	.ascii	"\254h\354N\333\302\177\302\326\013\340\036\261\320\016\017\200"
+	.ascii	"5s \214\276w\220b'\252\241'F\370\"\032\272\204>v\377\007\367"
+	.ascii	"Am\305\262\\\272\241`\373X\326#\fr\364\360\230\320\232\330\257"
+	.ascii	"\034\337O\267\222)5\237\227\007\nj\361U\236\342s\371\023\177"
+	.ascii	"\240\n"
+	.text
+	.section	.gnu.lto_.symtab.2773fe00891e94ab,"e",@progbits
+	.string	"debugModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"sectionTimes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"debug"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2773fe00891e94ab,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,236 @@
+	.file	"version.c"
+	.section	.gnu.lto_.profile.a0573c417fc329bb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a0573c417fc329bb,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\340\032"
+	.string	"\004"
+	.string	"\213\353\203\232\005\001\254\370\305\373\007\002\274\222\266\373\007\003\353\221\235\221\r"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.a0573c417fc329bb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.a0573c417fc329bb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a0573c417fc329bb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.a0573c417fc329bb,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.a0573c417fc329bb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.a0573c417fc329bb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_shortGitRevision.4.a0573c417fc329bb,"e",@progbits
+	.string	"(\265/\375 W\271\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\236\364\320\363\t}\273\001"
+	.string	""
+	.string	"\013norevision"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_buildDate.5.a0573c417fc329bb,"e",@progbits
+	.string	"(\265/\375 X\301\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\237\366\330\203\t}\273\001"
+	.string	""
+	.string	"\fOct 15 2026"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_buildTime.6.a0573c417fc329bb,"e",@progbits
+	.string	"(\265/\375 U\251\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\234\360\340\203\t}\273\001"
+	.string	""
+	.string	"\t23:13:07"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a0573c417fc329bb,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	"\201\204\001\005\001\004\002\003\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.a0573c417fc329bb,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a0573c417fc329bb,"e",@progbits
+	.string	"(\265/\375`\333\002]\024"
+	.string	"\026%\207J\300\020\2531\370\267rT\024\210\264?\026a\314\221\233@\234\356\350<\001@?\206\023M\020$\257"
+	.string	"0\303dt'I\tVNb\360\344\245bn'X|^\353Q\341MQ\2720\236\313l\2751\246d1\375\307[;YeJ\001_"
+	.string	"w"
+	.string	"v"
+	.string	"\377\335\310\007>5I\211;2\030]\337\275\367@\005<\367\352\016\214\341\270W\027\373A~\020;$\342\304\260\264\0361}\"\313\252n\211a\246\323\317J\363\262\322\325\264me\033\331\301\366\321\266\224\007\333P\266\237lW\3738\266\233l\017m\013m\007m\027m\333\254\254\254,\333(\266wv\265\021w"
+	.ascii	",)\352\310\247Z\004\237\225\255\313\312\303\250\371H\262\262"
+	.ascii	"&'\275B\313\303\242\t\252\326^V\016\207CV\bHLVk\026\241\360\301"
+	.ascii	"\177\334\313\353\241\b\300K\245\202\2525\004\323\027\372{E\357"
+	.ascii	"=\330\261\273\272\020#\311\231\236b\362\326\030C\312\341\325"
+	.ascii	"\217.}\345\354\220\210\252\265\177d\337\367\026w\321\261\233"
+	.ascii	"\341\271\302{\323\217X\357\306\007"
+	.string	"(\215\271\226n\254\300\2516\366\243.\005`'\210\327S\255\247>+aN5\337\330\322)\202\370)B\301~46*\252\365\241\354;\375\211d\206\304\210j\355\364Y\371\212Q\363e\224,v7\206\252\365`\372\233\232\200\210\267\306\030b\336P\245\240\252\326\030L\177\351L';\311{e\316\301\225#E\022\231\210\257\253\240\361E\265'\2322\027\016$\240\341+\252\326'\332O\272\322\201\021\356\325po\247\213-%w\262\240\266\234\207QTN\034\264n1g\203\334\315$\207\342Z`\004\2349\033\203\002\306U8QZ\016\207Ci/\324\326\262b]\253-0\360 \305\304\\\021y\301\335`\3203\206F{\271\331\\h+(\fM\204\300\351rS\231@\341fA\202k\206U\353\267\303\032V\353[\331\257:\022V\002\307\346X\255\205\237\225._\315\247\212!\225j\230\230:\232\0376\374t\252\365\217\0013 "
+	.ascii	"\003\0211r\003-\204\365\236\201\342j\037<\322\335\206Sf\3457"
+	.ascii	"\2626\276\237\245\231J\260dQf9c\313E\330O\226\20685\301\220\305"
+	.ascii	"\250\313W\313mbiM\376*\310\345\312*_;v\314\301\340~\025#6\342"
+	.ascii	"\2466\327X-\363nw|\325\2058\r+C6\270\320\366\347\227A\203\242"
+	.ascii	"\225(\006\3172s\2220\013\342\001"
+	.text
+	.section	.gnu.lto_.symtab.a0573c417fc329bb,"e",@progbits
+	.string	"buildTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310"
+	.string	""
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312"
+	.string	""
+	.string	""
+	.string	"targetName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a0573c417fc329bb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
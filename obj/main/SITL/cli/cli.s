@@ -0,0 +1,8692 @@
+	.file	"cli.c"
+	.section	.gnu.lto_.profile.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001G"
+	.text
+	.section	.gnu.lto_.icf.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\335\016\345?"
+	.string	"\252`\030\0269 \342Nc\021\022\020\037\300_\023\024\023^\"\350.\370R\340\001\227y\240z\360\373\022J\371C\020\364\377\277\177\355\377?F"
+	.string	""
+	.string	"\002;\214[\2721\273\335h\251\321R#I\312Y\001W\001K\001\036\364\264+\007\331\325AS\311\272\026\215q\320\360\233\231\255\303\r\332\332\b\271\246\246A\307\3325\214\227\031bM@2d0\\\006,\304\323\274 \275t\377M2\2439;\202,H\237\203y\\X\025\344wW\255e\361\242\260/\377P\301>\256\337\004\035\355\3721\242I\320L\350\360\351\213\200t\2447\006\246\235D\b\232\372f\250\006\363\201\206^\215\331B:\320\316>|\32686@:\322\263\212G\322m\021\003'j|\3003@\212\013\364%\261\356X6=\027\347\352\220)\230V\336\251Y\224"
+	.string	"\301\321\217\376%do\264\016<\353\f\341\2712\200\255n\372\361\211\021\bp"
+	.string	"\227\377B\0313\214[\322\373\217\253X7k8\214\316\234\242\3225i\372Ehfr@\374\370\217\2429\204\310K\200\365\372RX\363\355\261\213\024\023j\365\"\217.#:\243y\027"
+	.string	"\200,\225\301\312\374lc\351\345b\"\235\025E\030\234cUO\255\304\276\350P\341\352\253\377\366\262m\313\233\352\367QK\253)}f\006n9\213\276RCK9I(\365\317\207\231k+|\302\207\377Sr\245\3059\247\237\376\320\277\2667@i\364\205>\227\234\206Y\006\357\266\363\316\357\377\373\372G\324L\302G;\275\321\264l\030J\2073<\303\354\004\303\211\365i\207PO}\241l[\233XB\240p"
+	.string	"\r^\006\251\312\371I2\002\301\360\371M\027>co\341\372\r\250Z\263C\204?\3422\213\202\032\371\250p\270\302a\nO\340\020\013{\350\267)2+\343\241e=\341\362\261\033\314 :\312\035\021$<\3025\204?\370\001\353\341\034.2\035\016\034\034~\203\303gp\375\243w\265\321\326Q=\253$\363\304\301\341\364\371\013\276\340\322\035\3265\303\272!#\321\233\236\215\246\317Wp\354\245\361\242[\03515\364\346\2333'\016\215\004\227/\225\277(\331\\\315@\240\021\\\217\340Lw\212\363,\361\314\246\f\374z\340\327\033\270\276\2013\375A\2129\262G\030\005\216\275\022\374\027\331(\357\205\266\366\031\303\312r\241\235[\214\227R\272j\310\013\f\262\005\213\227\221{Ho\005\2745\246\017\232\212\024J\207\227N\340K\237\225\016_\277\364:F\262qQ\350\353\244\244'\351_xJ\":\236\231\030\360't\233\210\350HB"
+	.string	"L6v'9\342\271\351G\373%\342\321/\260\315=!\364\263r\f\321d\224\216\246\245\301\303\230\325_\273j\224\005J\337j\220Q\034\210W\253\033\206\313\207\352\342]\335\344\223\2462\362\363\203\0315>?\246j\265\0165\367\027\355\024\004S\363g{\321\362\027\330\243\345\366\242q\032\361_\247\036\327Msw\351\315\245\rR\321\3562u=C\177\352\362\324eL\335\371\030VJ\312=\274\315\365\242\261\342\223\265\267\240\016\005\343/\\\334\305\005|\f\321e\330\326J\375z\251\313\227\272\276\224\363"
+	.ascii	"\342<3pr;\313\304M\264\270>\213\353\025?q\025'R\374\310y\204"
+	.ascii	"\342L'\216\2567q\347\211H\ti&\212m\253\254\210\022/Q\342N\022"
+	.ascii	"\005^`\304\261\"\236\275\016k\334f^\345\256\n\361\020\330Wn;"
+	.ascii	"\347\013\226\250GE=\n\206:\210\353g\237=\324\341\2038\210'xn"
+	.ascii	"em\337\256|\370\207\017O\363\237~\375\323\251\367p}\254\274\327"
+	.ascii	"\325\265\265\002\005+\223eWE\276\274\017\200\332\350\217.\215"
+	.ascii	"J5\332\230H\255j\n<\3652v\b&\245\303\347\303O\263=i\272Q\364"
+	.ascii	"\033\b\0201\013\312\376\374\351\247\034\316\341\032\276\341\032"
+	.ascii	"\256u\bY\220N\r\321\211\276\034\253\302\310&\363\245U\302\277"
+	.ascii	">+%R+4\304\255$/\223\"@BH\266\341$\331\331\021M\325\223\006\227"
+	.ascii	"iD[\313\302\364\336\024y\312Ze\302p\211\004\032\336\032\323\007"
+	.ascii	"m\017z\270\256\302q\226\271\312\270-8\315\034\344%h\007\356."
+	.ascii	"B\277\356\226#\263q\251q\263\373\254\211\222W\214\233O\311\225"
+	.ascii	"<\311\223\034\311\347\0379|#7\362\"\337p\"\327\037\362\371B\256"
+	.ascii	"\037\344\363[\350%\231h\277\211b\262\341\343gs\201|\376\251\220"
+	.ascii	"\215~b{OG\305\344\fen=Y\315\215+\315v\243\343F\276<ov\236\216"
+	.ascii	"\323\270\261\\\263\361t|\245m\223\271\357\266\235\276\376\361"
+	.ascii	"\343?6\234m\321\232\226]\247\255\211\022\273\335\335\246K\321"
+	.ascii	"-p\323\351j\0344>\302=\247\245]6r\342\266\234\207k\037\321F`"
+	.ascii	"\366*\367V>\003\204\206\273\331\234>;}\276\217__\215\327\324"
+	.ascii	"\034\017\267\032\365o\274\267\255\022\334iQ\262/9\202\033\255"
+	.ascii	"G\217\303I\347n\002\332\331g\272\212Y\365\245\273\311\354\370"
+	.ascii	"\016\036\027\232v\334\231\315\241\343\330\034\317\236\252\200"
+	.ascii	"\036;\310]\226\275q\252SQ\335\211\343\330\033\317\236io\331\023"
+	.ascii	"\307n\217e\237}B\317\306\324=n1Z\016,D&p\213\3550\357\033\251"
+	.ascii	"H\207\267\303tT\221\020nr\203\331\270\215\327\357M[\266\277\366"
+	.ascii	"\367vn\371\351e\206\032\025m0r\201C\250q)ad\210DFD$I\222\f\007"
+	.ascii	"\001\005RB\207\206\314\003\022@\023:\032\b\rRDfF$\212\024$\005"
+	.ascii	"Ia\030\0035\024\371\270\335\210>\330\262(\260-,,(\377\357\250"
+	.ascii	"\216\nD\276\003\254\361*\005\357\343\305#\027\320d\020\251\n"
+	.ascii	"\330U\327\275\007\242\237\207\267gq\271\225\331\354<\225y\320"
+	.ascii	"\235\275\2610\243$\326\201H\335h\036\n\007\333.z\r\225\362\210"
+	.ascii	"\262\031\357\027\243\332\270\027} Vz\004\301\021\2307\246\316"
+	.ascii	"\261-\236\321\264\240w\304\357\276\340\207\251\3416^\351\332"
+	.ascii	"\f{\317\341<c\346oc\3661Ip\254\347Z\265\372.sAG\360,FQ5Q\315"
+	.ascii	"F\b\023\233\353\235T\200\247\274\332\020\327|\267\316(\325\342"
+	.ascii	"EK3\235\227/{]Cu\244\":\033\027\023\333\270\323\362\255\323?"
+	.ascii	"\203\376\036-*\233(Q\222\340\335,\257\271n@\317\223Q\216\252"
+	.ascii	"\274\327hO\212\0373,;N\326]c\235\230\006\366\343\202q\322\271"
+	.ascii	"Gh\013\263\206\371U>\271@\367\332V-\357\360\215\355\275n\317"
+	.ascii	"E\245v\321\036\021b^\374\020B_2s\256\345.\237\371D+\203JE\234"
+	.ascii	"nG3\002,\367q\336~\207\320\335\266_&<\356\342C\020\312\326\037"
+	.ascii	"\260\233M6Q\026\367`?\240\"\323\224\nJu\211\256\361\341\272\243"
+	.ascii	",\274\031d\337t\030\017Z\217\257\325\007\210hb\327\321\f\332"
+	.ascii	"\263\251g\302TB\332\353\354\225\033\274P[,9\232{\023_b\331w\303"
+	.ascii	"l\3151\337\276\261\300\030\306\200\310\274\337\305\004\ru\223"
+	.ascii	";7\272\252\262\260\233u\351\361\271g\266Ev\261\033,\255\220\220"
+	.ascii	"K\3640\244\302z\363\300>\006Rz\236\n&\253\365\337l;\250\332\016"
+	.ascii	"\273\034\207!\344\027x\372X\004\334r\013\264\b\321\333QEx\fe"
+	.ascii	"\264\004\366b`\231\226e$\204:<>\\\326J\325\306\364n\3378\234"
+	.ascii	"\315g\013\035(!\225UW\222\240<\367XNO'\0312z\363lA\006\013&\203"
+	.ascii	"+m\240._\322\337\350\3447\210\0300\363e&#N2\211\316\025\202\013"
+	.ascii	"\363Q\025\235!:\252"
+	.string	" 0\013\0320\276\241G\277\310\363\0203\306\210\370hBP\017\"F\224\017b\256N\276\211QW\324L(UOF\372\262%CC"
+	.ascii	"5R\222]]\371\365&0,\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\207 u:"
+	.string	"\326\243b.\240\262\244\320\001\300+\211\0329^nZ\006b\224.\273\3649\326\023\204\332\327\0356\274\271\250\"j\346\253\203\201\211\315\266\275\233%{\357$\003P"
+	.string	"Z"
+	.string	"X"
+	.string	"\343\250\365\240\001\203\005O\3558"
+	.string	"\021\250\216\324u\002\312H\331\n\352^\t\016\301\201\252\325\200\025@R\351\262\t\334^@\326"
+	.ascii	"\331\236\320]Tl\001\270\227\364?\375\274\275\322\365m'\264\022"
+	.ascii	"\3353\273,\253\202\252\354{\355c+\250\266^\252\003(\001yY\273"
+	.ascii	"\315\031M\031\330\222\206\266\321\305\270\006#_\270\270\267\370"
+	.ascii	"\271\327\256\315\342\372\344%\276\342\256\212\024(N\230(1\211"
+	.ascii	"\233#\262D\204\310\033\304\007\017\0358\3646T[\2334T\325\316"
+	.ascii	"P\265\303\220\255\335Ny\027\316BV\205\264)\344\204,!*\1777\t"
+	.ascii	"\021"
+	.string	"\276\020\260$\241\035\013\342]\371\321n\262\202\255\366\332\242\313\354\257R\263V\267\321\227\266\247\230u)\367(?\301\253\275*\233MN\260wj\322crK2k%\231\244\b\211H\346\020!\331f\220\002\351\017\0376\364=x\344\355\370GG]?\312aw8\354\273\221\223\r\254\254\341C\003\003\275\275\322\357YO\333\346\261\026\317\350Ni;x\035\244\203\3759''\213\327jq\260\303y\343&\333\324]\025\2335x\346j\322\240\301:s\315XY}\031\253\311\324\266\307\274\030\3740`\276T\365\272\336\354F\205\244\366\202m\357\302%m\313ok\371\317\322\203\016\250\202\\\223&I\241\3152\n0\220$Q\232\266\330z\022\340\341P\212hQ\224S\b\0313#\"\"\"\"AJR\222$\303\030\313\232\354y\324\317\262\207&\331\322\301\303\037V\243=D<sd\214\231t\311\035\027\232\362BO\\Y\357N?"
+	.string	"\224[\t\341p\002\244\245{\324Q\361\202\370R\342Z\300cVk\230\275Y\205I_\335\215\217\224\317\244\\\300\355\274*\307\311\252\214\241i\213\365)\025Z\205\024\256\266rA\304\b>#\345& "
+	.ascii	"\263\001\320\026b\261<(\210\013\301\321\374N\231sdc*\t\363.\355"
+	.ascii	"aj\006K\017P*\177|@K\342\363\336\004~\220\3508\252\362!\017F"
+	.ascii	"\264\375>(\206\367\306\372\316\rt*\033\206\205\267\2248\236\201"
+	.ascii	"/1N\030#\267\005-m\331\020\314i\336\260\"\266\3060g\367v\021"
+	.ascii	"\202\370G,[\021\003\r\203\302S#\026\252\213\003\310F&\246\251"
+	.ascii	"i\032\353\341\337y\344\206\375Rs%\211\r\314w\312\225kY\340\215"
+	.ascii	"ii\363\026K-\243,:\214:\240\313\265+\004\277\246\213\017\033"
+	.ascii	"V\031\223\016\213U,\374\244.\355\024\007@Wmj\250\242\004\357"
+	.ascii	"\217\351\017\306\220\337\350o@\373\bv\374\350\206\302\221}\301"
+	.ascii	"\326\215\016\301Z\311\201Aq\026Y\233\341\307\264\315\375x4\356"
+	.ascii	"\310\304\025>\304\370@d\207\326=\362G\232\355|\347\363\266xG"
+	.ascii	"\244\315\202\f@\002\213Q\033\321K|\301"
+	.string	"P\b/\177\022X\264;8\337a5oT\200\"G\357\357\254F\316\370@o5\302\355\341\322\305\323\363\351Q\026\202\370\217w\026\234\262\367\231 \211I_Iy\3604#\256\244\236\230\021\312\303$\240-\3057^a=\223\255t\233^lF\240\216\310\264\025\027P\211\367C\337\356\363;\021\220K\031`\020X=\376`({\rE\2331\347>\336\323\321\262E,\230\300;\314\251\340\363\213\203\036\030\020{q~\231|\251c\225\207\220\236\002\316.S\033/\224f\313e\351\247\001o\333\250\020\354\340\211*\036\004\325q\033\304@n\032[\245\226\bA\251\013@\367=ax\026\312\250^\310\330D\326\200\204qI\f \330X\b\350\251`%B4\354e\336\345\022\215c\b,\273\276\003f\244\310 E_j\265m\\K\371\002D;\337\022\233\327\247\225\324\240\265\177w\257O9|Sw\256\256\b\251\230\221\216\265IH"
+	.string	"\225\316\354d\212\272\351\306G\353\207\0244\365y\002\374n\345\337Ge\271\323\351\274\355\244\230N=\035\360\001\255\217*\350\350\363T\225\270\205\267\237vIG\227//\3556\024\027\333\313\357\237d;\260\"q\2721$\326)]v`N\006\240C\246\3467\222\003\013\202\316\020\254z\224\313\3416\362\214\355\337\236'\b\364k\311)\341\025;-\206\021\267#\355\217\027rB\276M\t\274\376p\237\267b\007\245Q\347bL\356f+q\260\223\223\306\005\025\201v2[A\306\221\353\267m\202\3057'h\320Y.lN\213?\334\023\276 k\250\2168\r\016\234\221\365\377 `\016X\030\360AgW"
+	.string	"M\360\256\376\253\325\331g\315\013p\245J\356\004x\024\343\024r\253\354\370\271E\023M"
+	.ascii	"\302A\242\020\302+\210J\343\217\270-\324\335O\366\240\325\352"
+	.ascii	"w\020\033\310\324\037\261\006\344e\335\377\340\261x\025\343\363"
+	.ascii	"\352\303p\363\224\216C\305\261\370y$|\302\202\177\224F\3263\024"
+	.ascii	"2\265\266\fY#\024\204t\335F\245[$\300\364\207\205M\026\343\355"
+	.ascii	"\342YNk\345\251`\030\373t\311U\362\303\272\354\324\f\344\343"
+	.ascii	"`\373\276\301\272\305:\347s\234\327\256\271\2332\242\365\352"
+	.ascii	"&\373\233\207\304\255\355Q|3\013\223J5\245\032\337\261\337\221"
+	.ascii	"\301\265\227y@U\327\033pz\224\332i\326\007\211y\024\342\217\377"
+	.ascii	"\365\246\360,\303\207\004?\2621\324C\"\367\272\300\240\271\331"
+	.ascii	"\265\034\266`\312bD\023\2749\212WWc\246&\3247_-\021B\312\024"
+	.ascii	"\263!\253\200@}\337\255cI&\365n@\273\312%\344:fD \302\221\250"
+	.ascii	"\324\205m@\304\271\327\006\301\0308\002\224\255\375\315\016i"
+	.ascii	"\322\211\363\337\231!\356^L\241W3\177g\331\360@\f\255T\031\364"
+	.ascii	"\221\354\267\207m\220\336\2023\013\261\230A\005\232\261\372\203"
+	.ascii	".\340&\230\226\202\003X\033\356\343\307\343\342\204\221\251\306"
+	.ascii	"\272\321\275\020e\245\366\263\223\372#\t\251\021M\2364\017\261"
+	.ascii	"\355,\314\233BI\342\213\t\024\323\016\302\2276Aby^\270\004\037"
+	.ascii	"\346RXb\3768\215!\031 f*@\3043\202.\343\005!\301\244\313kn\355"
+	.ascii	"{\344\346_\311\330\327\201W9\b[\202zKh0\202\027\362JB\320\032"
+	.ascii	"\264H\036\340\325\246hj#\232\2341.\013\266\0166x\251\277\003"
+	.ascii	"s\020\206\n\254\336,s\023\305\005\352\3142\237$GwZF\212\020k"
+	.ascii	"P\003\363Ng\022R\260\336\324Q\fx\035\t\225\261~\177Cp\240\013"
+	.ascii	"\262X\3209;@\314I`\260\261\251-w\022\352g\322\254\352\214SF\365"
+	.ascii	"\257\277\233\260\341P#6j\352\366\254\367B`\200*\"\374\340\214"
+	.ascii	"\026\260\324\310\344(\253Y\342\021\351\374M\2156\035\301\240"
+	.ascii	"\324\271{\270C#/\002\344\026I\223\357R\220\026+H\330A(\255\372"
+	.ascii	"\352a\327\216R\372\266\b\003ud\247\222r ;@)CQ\230\013\"3Z\007"
+	.ascii	"\207D4.\337\313k2\243r\334_Wu\024\225\035\316u\002G[\021\223"
+	.ascii	"\344\206\003\374\354\031\253\230\333\304\364\016"
+	.text
+	.section	.gnu.lto_.inline.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\233G\035\274"
+	.string	"\312\342,.N \324RI\007\f\336\3533\205\317\244L\253\300\274\034.\237\221\341\207\357X\231G\341\262\277\022\30745G\370\214\221\364]o\217<\260\2529=\005\201\300\003)\232\n\020\257\305r<\327\016^\025\341\335\004\337!\007\314j\272E,i{K\231\002\222\002\340\002\335\002x@w\261\337\363\223\335-T\244"
+	.string	"\367\221,^\222\250\340\377K\254&\f\t\021\002\216\300\252-\035\222G\266\304|\213\"\362@2\314$\374\001E\344\356\2054\211.\201%E\205h\211\212aa\003\266\342\006\f\267\t"
+	.string	"b\270\356\026\002\243G\217\b\341W\354\203\316\3234\317\365\365|\264\346\267\351g\230aH\277J\314\325\335\301\013P\315?8|=_\215\370u\370z\304q{w\\\365g\371\037\007\336\375_\003\357w\241\210\224\317\201\221\366_\005J\034\330io`\0376\260\017~\003[\003?\275~\215\264M_\037\037\023\017 \211\247\344\221-\231\032\223g\345|\221\212\323\222\272\241\225\031c\236h\2054\211\251\256\034\201'\370+q\2372%\334\f\200\345d\215N"
+	.ascii	"G\361\007\325\251\362_\242S\306\324\362\b\371_\033l$\313kO\320"
+	.ascii	"\207\350\277A\225\211~\231\332\213\"\304\377\342\340\264\037"
+	.ascii	"L\362\b\375\304\261\374\215\\eL\210\223\242\2530>K\234\270\320"
+	.ascii	"\377\"\262\376\027\372\375\177p\225\270I\330\232\027\341\203"
+	.ascii	"~ f\276\360E\344\276\376@L\003/\024\222\222\006~:\237meI\363"
+	.ascii	"s \312\377y\360~\277F\236\023\266\346\005x\340\213\310\027\221"
+	.ascii	"\374_H\377\363\177\035\274\273_#M\232^w\306\330\202A\334\031"
+	.ascii	"c3\377\303\377&\375^\377/\361\222;cl&\377\273\304R\356\214\261"
+	.ascii	"\375\234\376\277I\274Y\203&\273\247~g\223x6\2158\217L+n?<R\375"
+	.ascii	"\375\364;\030\310\373\237~\241\264J\035\354\364\177\275,\220"
+	.ascii	"\237\376\177\233J ;\375\367M\242TdZn\346\371\257qa\357\317\237"
+	.ascii	"F\216\27236\204\350\303\017\223h\225.x\320\316\023O\334\376v"
+	.ascii	"\022-\242LX\234\241s\237\333\310J\320\200|\251\270i\366\315#"
+	.ascii	"\236\272\032\313\242g\3234\373\\\315>W\032\\wd\313\332\276\366"
+	.ascii	"\227\030\211\27023\b\234k\327\240}}}X\345\257D\237\214\251\025"
+	.ascii	")\203\232\352\262(\251\323\242\255\335\332%\201_\033\324\315"
+	.ascii	"\312\212\313\333\276\377\177\016\177\016\317\341\371\034\236"
+	.ascii	"\303s\310}>\207\302\263\360,<\242\335\035E/\334>\013\267\317"
+	.ascii	"B#\356\356\343\236x$\232\354n\023g\342\371h\317g$\356\356.\177"
+	.ascii	"\250\356>\376\302\313\240\177\342\375e\320\347\340\375\211\364"
+	.ascii	"M\274g\253e\235\370\351k\266\274,\312;1\322\022\351\227E\351"
+	.ascii	"\304N\377\371\0329\331\335(\376\245\272\214\253\334Q\364$Q9\017"
+	.ascii	"\0365aD\370-\375q\006\314\355pw\341Ed\325\373\275~M\224\334\366"
+	.ascii	"\373\327D\331`u\202\254\r\346\232\242\027\006\274\371%j\004\025"
+	.ascii	"1mWsk\300~~&\312\303\226\250\276\240\337\377\003\312\312\003"
+	.ascii	"\2328\231\344\013N\002o\341(\226\026\346\214Iv'\316\252\350,"
+	.ascii	"\274\210d\321\244|\375\236?&\340\312\177\317\237\377J,66\004"
+	.ascii	"O\210\213\022I\246*\030\036\262'B\006\3700+\r\270\301YO\330\260"
+	.ascii	"\300\370\n\273\013\374\217\"x$E\204\252\216\232\032\350TZ\226"
+	.ascii	"$^G\250\302\n.\340\353\027EPh\r\370/\212\340\377jd,$^E\224\224"
+	.ascii	"\214\3568&\201\23372\235\020 b\224\370.\212\331[\320\317\304"
+	.ascii	"^^q\316@\360\373O\300\007%\001>\254\321\303\367\272\247p*\364"
+	.ascii	"\033\352\n\276~\211\200\356\202\377\022\001-\361\\\017`\272\020"
+	.ascii	"\335\274\022\267\024\335\232j\203\335L\005A\243\242\376g\301"
+	.ascii	"\313\377w\204\222\005?1\177q0\017B\212\300yp\024\\p\277\2365"
+	.ascii	"\230\257\017\217\231\372\272\375\212\304Z\276\220\275\225'\036"
+	.ascii	"\211k\377\370i\343\226\327\354\0312%|\361?\341E$\353uwy\023N"
+	.ascii	"\374~f'Y\254\354\352\253W\033]\037\241]\024=zg\224\223d\331\034"
+	.ascii	"\031\277\377;\206\013\245U\356\340\247\257\335\366\340S~\217"
+	.ascii	"\\\302\036\331\007\377j\266\007\237r\0077u!\"\305\353o/\001\350"
+	.ascii	"\177\n\341\036\353\240"
+	.string	"\250\311\355\017&\366:#W\304\002\331\021\376\375~\317\237w\235\231=p\t\330\321\362&N\214\207\360\263M\304\273t\277\254\016\341A \"\":\221\222*]\356\352\207\275p\273q\373\364s\335\026\352J\364\207\2654Z&\212>8\220\271\257\346_\203\343\366\356\272\352\317#\321\362\270\r\325\243\257\334f\247\035\256\213\362>\\\224PW\342#\2366d'\212\210\036tp\0166\370\353I\377\367\340\266\355\261PSe\017~:\375.Q1\335-t\r^Df\240D\033\203\030\027\374\026T\260_.\n\214lGk\314\232\237O@\255\214\251\3211\351\231\252\2704\340%\250F\346M#\n\204nJ\311\320\317#\205pQ\364\314\t\376F6\313\022vL\341\367\177\2071\273\003\024\220r\007\272\344j\314\352j\217\240~\211^\207%\242\3038[l\277E\213\355s\013\032\334\335G\347\366O\032\333\347\223\006\361Il\327\335"
+	.ascii	"\234\211\300\265\265=\327\314\242eQ\226_#5\323\335E\207\240\326"
+	.ascii	"\372\033\350s(\231\177\361\"\322Di\236\301\025\263Av\272Q\006"
+	.ascii	"\371i\231\344\221m\005\375\001\007\222\200\245\031cF!\237P\235"
+	.ascii	"(j\340g`\215\324\256\273\177\276\300.\177\2258OnM_s\250\334\022"
+	.ascii	"+*/\2307\216\211\374\2767\230\314\354\214I\214\343\260\247\320"
+	.ascii	"\357<\2373\250\036\2758=\246}\352\216\234\2317o\326\250\037>"
+	.ascii	"\211\341\272\217Bj',\351\276Q'Z\2776\330\016l\ny\301o\250\362"
+	.ascii	"\001\355\311\317\2330>0I\261a\360\260\341s\300m8[-\305\nry\021"
+	.ascii	"\311\033\334\027\257\366P\312\037\007\267%\303\226X\220\203\345"
+	.ascii	"\314z\t\f^Cm\346\375*\321$\r[\277@\274\335\374\013)\335\356?"
+	.ascii	"\250\232\007bs\330\301\275\320\217\214U\220.\017\222\330\b\237"
+	.ascii	"\233!\350Ma\377l\n{\006\273\261s\344\333\263[\006FB\256\n\210"
+	.ascii	"\372\031t\2105+4\277\33210\022rUx{v\267\f\274&\316\036\260Jl"
+	.ascii	"#Z\244\314\254\b\341\315\332\265\215\352M\363\210\277\370z\200"
+	.ascii	"#t\323l\323l\032\224\016\232$\333\3174\373\346\331G\346\3539"
+	.ascii	"\354\376\365\f\266\022;\366\336<\371<\371\034n\017\207\333C\223"
+	.ascii	"H$\022\267\207;\334\263\373lr\313@\323\302\314\265\331\233f\367"
+	.ascii	"\315$\336sdK\225\0277\273\273\317G\274L\n\240\227A\277S\274{"
+	.ascii	"\031\313\343\007\016R\274\034\305\313NL\351Ss\331\341\262(\321"
+	.ascii	"\264\244u9K\232\355\323.\332\226ub\247-\372\332\240o[G\310m\226"
+	.ascii	"\271\343\351\177+\351\356\241\343\270\022\260\350F\222P\036&"
+	.ascii	"\236\203S%\344<\373\232C\022\300m<\310\322{\2117l\244\244\270"
+	.ascii	"\322\r\236Ss\203w\336\270E\344\356\271\037\016\267\207\304\017"
+	.ascii	"\211G\f\246\313\024*\341\207\334\037\036\321\306c\"V\317\375"
+	.ascii	"$\312\004J\022\312P\020\267;Xp\330\355\216>#\204;\324\354\216"
+	.ascii	"\212\203\205\200\021rv\274'\005w\t\350H\304\037\210\201\270\334"
+	.ascii	"\244\322\343\263\"\305\200\327~\r:'\346\215\234z\032\3216X\276"
+	.ascii	"\272\352+\017\311#\353*\277\375%\232\367"
+	.string	"6\025\305\354\2737>%\\\374\320\bx\231n\2328\030q\013U\267\021\260S\2232\002~b\363\333\304ep\322\306Nw\243*F\205v\345\032\226\031<|[2\340\177\233\030\317lH\220\257}\006[\030:\252\3632"
+	.string	"\275~S\b\201\376M!\374\317D\223jm\334\006hzGE\314\333\360\305W\371\"\007\033\321\222\366u\266\307\260?P\2044(\304o\215\211\253\274\035\321\244\305\315/q\262\310\022>\025I\371\337\3403y\352"
+	.string	"a\240\376o \254l\200*Q\305\215\231\327\035\206\027\221W\373\372\013\375\212W/^!q^\226\261\255\005\353\022vw\202K\212\216\216\231D[\212\256\316\317o\203\271\244\366\250\244\370\375W"
+	.ascii	"\210R\001&\326;\263z"
+	.string	"\362b\370\002e\321Ui\006i\365_\241\237\360F\363\365I\001\177\021YD\n\353\272;\200/\333\036=zD\374|\327v\277\273a\220t\\\033\204\177\212\203b\375\240\245j\205p\261\311\372z\3047\251\270\317\366\260S.\0257\235\277I\234D\343-\315|uk{\204\272\342\360A\"\300\367\354\315\230\274 \202_3+ydZ\300\257\226+q\022:YS\202\337\262\315\362\357\207\200Uk{v\213\344\222\314\223f\253v\205xsu\037\201\276Xh\230#`\324\262\322\324\200\300\370^\271\225\375\222m=\355\353\353\353\343\233z\324\324\361\262B\312\320\274dm\234\257\017O\266\210\\S\016\r\276C$\217\217o\276\006\317\035\203x\3623\342\"m{R\033%&\205\304\036\t\345\003XnX\360.\367\365:r\035\261\262d\013\25635T0\276]\277Y^\256\373x~\271\276RN\320\332\260\220\360U\025\306\303\273"
+	.string	"\267\207u\302\377m]Y\253\002\306l\324\253\216\022*\246\372\236\335\332\377Up\266\250\030\327\224\220\331;\336p\265^D\356\212$\373\241$^D\362rm\341\022\242%\340\260%[z>\306\\%\247F\340\264\372\206\270\346\364\231\r\360\315:\362\227T\233\255\026I$\231\273\263\340\213$\217\217\004\027\013\2003\274\274G\374\305f\007\366\233A\211\370BF\267<D\2159\243\332>U\007\233\325\301O\373S\006\026\252\207R\007;-\3752\321:O\272\374\340-s\215"
+	.string	"\311\274\210\344 6t\201\037\370\352\352Al\370\337\255:#om\024\220QcD\314\203o\021dP\345\261fyp\323\376\277\205\312*yp\216\245_#\017!\366F\006\370\275\332\237\307\022\215\322\335CBk5\005g\316QCC\243\342K\244\317\331V\225\biT\272\260\034\356[\305Gp\242"
+	.string	"\201\347\310\006\313)K\023\3655t\203|\337\367\326\027\027C,\353\013\314\361b,\020\272E\344\377\363\357\020\360[D\356\251\326\362\320\205\361\017]ZQu|%\306\376\330\377\301\377D@/\"w\353\352\350F\271\272\244l\331b6\257\333\246\346\027\210\277Bz\342\220H\354\036\232}\366\360<i\233\324\244\265\373\\k\307@\303X1\tb_\211\375zD\245\224\221\"f\350\346M%&\022\344\013\230"
+	.string	"7\221x\211-\254,\277\263Y\315\363<O\346\3563\023\267\373L\234\301e\244\224\341\332\023{\305\231\270W\344\202\0132\236\002}\223\331\231\231\026<.G\273C\361]\242hlh\346\356v\037/\"\367u\367ST\357\215\035*E\332\326\344,\357y\227\003Uo\242<\023v\206\212\221\177z\203\036\021\266\345\365\273'{,\025\355\260/\"W\\\371\231I\\\2067\007D=\361F6\302\311\326^\231\304e\356\276\344\324\017o\3442w\001\205r\250\023\b[\030\003A\307\030\"\022\021\232$\315\001C\023@\320\200D\026\023\013\246\343\256\017\023"
+	.string	"\003\311\310\001\022=\016\203$\246\020#\210\210\214\310\210\004\"\")h\n\351\227\021:\243\001\353[0B\017:\362\321K%m\3363\231\216[\306&a<\241|=\360H\374\035\236O\364\3111\3674CL\r\t\200(\377\215\224\265o\234\337vV\022\261\330MGn\264\031\223\021\023\355?\307e\026]\323-\0032\257\021%\251\362\362GL\214\230N;\303\240\222\005\226\270\232\347\325i\3251\251(ov\320\003f\377\244&_\247\370\261\370Hrzo\221\303n~v\372\321@\233h\024=\273\204Ss\2046i\326\004'.\352\215\233\005O\241\243\362\306\353\246\367f\177\036\327\334\356\255\025,\226\226\013\f[\245yC\035\236\206\264W\351W\276"
+	.string	"\rF\326\322\211\350J\353\337-\371\035\037\fY\013\3166\323\241BE\013)o\244\003N? \204`\353\210O\255\202Z=\030\225\353\203\225\236\240\0255\275j\264%2\275\377\001\f\260\250\241\210VM\n\267V\3573h\304\213l`\347\027\222f0\246\027\333r`\177\234m^\213\341\026\203\2719\217\004om\303\263"
+	.ascii	"\177\001B\225\020|\310\261H\200R\373w\274\037"
+	.string	"2\023E\357\212,\b\b\230l2$'\177+y\234\301En\0055\213\234\246\030\033\\\240\366k%\364\024U\240\322\005\035\020zqk\307\232\254np\253'Gt\333\314\254\307\213\206\373g\002\316\305z\007\341|\005w^\001\222N\006Uj\003#\342\013\020\360y\376\216\343\371\342v\b\274Z\366\222.mQ\020+\354\372N\266\315*\202\213\032+\217\202\333\324s\347\367&\367\337\267{\362\0025HS%\210\2110\2000DP\347m\f\352\340\324^\033\335\035F\352`\270\026<\020\241\253\204Je\252}-\321\001,7\331\005\251\203\225\342\027O\207N\223\005\324\325\361\005\r\273\2338\306\200\377\006\016\334\262\235v\3728(b\304\230\377\024'\305D\002\234\236d\334\3244\322D5\353\366\005\311R\211\3341\004\340\217\256h\321{\207\013\272\316u\"\326\r\367\352r\333'\373\021\257\n\256x\013\215_(db\026\367V"
+	.ascii	"\n\266$F\327\224W&\033 \261\344\260\204m\316PZ\346\225#\020\236"
+	.ascii	"\021\343\351\341/Z\326\316\306m\034Z\217\346\215L\266\363y%\027"
+	.ascii	"\225)\216\265\353\221\350\036\032\217=\353\205+\251v\227\274"
+	.ascii	"<$\336v\032\306\321\234c\251>\223\313\002,C\372\243+0\243i\262"
+	.ascii	"P}\214\003Zx\036\re\004\204\030\016\221\230\277_LMP+\2660\t!"
+	.ascii	"\022\262^z8\255fN3\270\240Ouo\334@l+#\364o\247c\005\202\177\223"
+	.ascii	"\267\003\311/BU\357\363\035\216\264w\207\352\267 Q\f\343\245"
+	.ascii	"\243C\257\374\016\274p\302e\274T\323\317\274\326\356\"p\375\304"
+	.ascii	"f\340\016\305RGLT\225\303\321\202\247\267C~\365\304\304v\\+f"
+	.ascii	"\024\356^e\374\005W\220\027/\234\311\311\202\325\023\361\310"
+	.ascii	"\264\b*\340\206\263^Y\265\243O\321\254\201\361\373\304\020n\351"
+	.ascii	"p\222\267\0254\376\350=\202=k\311T\304\357{*dL\\\003\314F\374"
+	.ascii	"[O\323\2312:t$@\302M\327#\033\337\361'|\350\260\017\035J\305"
+	.ascii	"E\004S\3675\tz+\355\003\223\025\240\316U\030f,H\271\246\021\255"
+	.ascii	"*\326\007\007\213\315^\365\t\320\346\177\274+\246\016L\315\340"
+	.ascii	"\336\340T\273]$\017\214<\2468;\364\205\232\266\035\240\243\023"
+	.ascii	"\251\271/\234\002{\346\313\366J\251\242U\317\315\004W\260M8'"
+	.ascii	"]\345k\333\272\351\266\016\356m\016\272\337U7Q\374F\313\253\352"
+	.ascii	"\342\2510\212^\032\027\250\335\222^\244\341\232\220\317H&\025"
+	.ascii	"\030\352\240\005\027\301\324\221\024\\Y\354\3405"
+	.string	"\240\035A\316\013X\321\344\362\315\223(\330j\001d\007A\275\215\343\333b\241j\317\373t\201{\312\022w\216\032\024\232~\250]\246.\237:v\222\274\252\307\372\025Q0\302,\211\265\223\245k:\005\006\207\332:\203W\217\215\322\237\\\001\246\2249\235\331'4\202\226S*\n\212\021\326\023\325\331\375\t\250\0301\245'nJ\222\240"
+	.string	"\025\204ie\201$\350SC-h\020\376\316\"3_L\001\240N\367j\211V\325\316\220\232$C\f{H\323\001\340\013\270\353:\337\257\205\2415\260\253Kb\020"
+	.string	"\303WhM\007\366\022\243m\210\206\2110\211\021C\201\026\226\233G\332\267\221\323\376\224s\366~\035\202\262|\313\362\331\347{/\377B\371\210\221\243\304\315\206\001q\230y\271\337\344\207\315\277u"
+	.ascii	"\346\242\023#\253\373\203\264\313@;\250\305{\261p\314\251x\304"
+	.ascii	"W-MIh\002W\302\300V]o\307\211G\"\213;}\002/}\235\246\362W0U\n"
+	.ascii	"\342\r6\327m\242,XW\037\360\342-\357 \222~\224c\376^\030\340"
+	.ascii	"7\002\b\3244x\346k0\275#*a -"
+	.string	"uO\340\003\237\332)b`\t\307w:\2715e8\003=\234\370\bZ\031\350\266\362S\310\004\303c!\306\nAAr\242\317\212f=\210v\362i\001\207\004\247b\td\370\002\321\265\273*\274\2444\006\036\375\036\231MS\362J\"\200\374x\240E\261fl\320:?\004\2232S\335\322\024^\232\t1|0C\317\2626$\370\231Y\275\252\220\367\023M\360\367\336\264\207O\233\002sd<|\266\336p\007\321\0208\220\301\371Y%\324[\303\003\266n,\002\247\242\265\264j\306C\204\2346'\352\246\371\033w\374\357\372\322zPW\346\033\361\270+\315%g\226a\034\361\235\266)\231g\034\241W\244v\035\302O\257\371\221\252\024\242\021\257\327\226\363<\005\375{g\3064tyI\333 \321>\253R.\202\177%r\316\233\244K\211Qq\265\036\312\214\274\365\336\374tq*r\335i\332\341\354a\026b\b\024\2779u\316"
+	.string	"\352\210\351\344\2118&\362\203"
+	.string	"\277\272\221\213c\f\227\0067#\260&'\310\006^\340h\251nm\233\377\212\036\3600\3535)\211\340\252\n%[=\301\034\n\213\t\205\317fy\017\\#\342\276\005~\r\257d*\031^\321\032\262\375\033\025\323p*8E\b\b\373~z9\246\023\335\321\nX\350\231\374\246\204qn\2402u)\233v\245u\306I\353\376p\307\301\242jNn\013\200D\226\251=\300X\326\273A\021n\320\3565FL\274L\rA\201\351\224[7\"j\266\037(\fHO \304\310\205\005\326\n\251-\005\273!\001\013`\347nQ\007\312:\272\346\253\255\230\r\221{\257\223n\344\275_V\222jo\241o\274B\232k\310\222\246O\373\347S\2658\276W\220\372"
+	.ascii	"\325\037\234\230JH\316G\"\234\354[L\t\214\275\275\261\203}\024"
+	.ascii	"\264\3414\247\374\300t\367\"\253cV\271O9\3674\324\305\354\022"
+	.ascii	"\303\335\242\222\035\357[\250\302\324\304\223o|\215t:\001\361"
+	.ascii	"\262\"V!M\261G\005\022\370\232\244\266\005=\275\352E\275\352"
+	.ascii	"\027\340Wc#`\351SB\305r\224\241\342\376\210~3\352$\302\365\204"
+	.ascii	"\272Rl\277,D\357D\227\3068g\224\306Py\373\333\2575Qn |\226+\227"
+	.ascii	"|\320\016\356!\333kh\0177~\336\356\217\270\t\224\034\362\255"
+	.ascii	"x\013\3540B\004\274r\335\311\t\2278\317V\276\245\024\214\357"
+	.ascii	"\201\352/\030/\017\326\246\3426\t\376\344\036\320\304\347Q\260"
+	.ascii	"P\335\300\315\314\001\212DZ\262S\344\003i\354\266q;\214\342l"
+	.ascii	"\234^\267\370\267\203\366\345]\275\003\3772\3041c\352\340\212"
+	.ascii	"\213~j96b\320>\311\250[B\322\332\276f\243\351?\217{F\303\240"
+	.ascii	"w\310\036\f\322\203-j\325Q\001s\232ZA\324\360v\032\245A\261j"
+	.ascii	"\344XLc\205>\277V6wH\235.UW\213K\016\313\261\006\023-9\001\352"
+	.ascii	"\005\237`,\344;\332\273c\250\021-\3346)\216f\337\020\270\t\216"
+	.ascii	"\032\2115Q\304\221\205t9a\363\002\226m#\001\024nq\034\210\263"
+	.ascii	"G\271 H\005=^8\3218x2z\354=\260\271G\005\365\343\334\023\364"
+	.ascii	"\216!;\277?\r\210Ev\f\036$\203\363G[\327\340\377r\301\226\351"
+	.ascii	"L\237\262D\307\237\020BRI\n\223\226\241\332\216d\211P\002\250"
+	.ascii	"+Z7\303\201\210\032\345af1\354g8w\007\343\357\277i\253\360\013"
+	.ascii	"\2014\245d\305\331\303\212\213\244\032o\260\225\001\230\334\217"
+	.ascii	"G\020bW\353p\341XK[\004\020\313\025zW\364'\324\034J\246\371\327"
+	.ascii	"\322\033\3053;K\347$\032\224\266\312! \313\255\363\300\216`\032"
+	.ascii	"\350\222#Ex\334\336\240\355\031xV\354\337\246\200+6U\237q\217"
+	.ascii	"\222\337\200\361\006\234f\261\031\0052\351\002\034 \245K\013"
+	.ascii	"\215\006/\243\rIzt\001\003\026\017S\377@\321\237 \241\346q4,"
+	.ascii	"\231\376\fJ^\031\315\307\205\"K\007\260\373\330\020=\006[\242"
+	.ascii	"\025\232\225C\306\343\221pP\t<\022;\035\324\211\032ieLd\264\233"
+	.ascii	"\020QqG\003 \347\317.!\320\206\247CEN\225\"v\207N^\027kK\247"
+	.ascii	"\331I\305\315\024#\206\311\272@\307\034\237\246\004M\005mb\027"
+	.ascii	"\247\221\025P\254\211\240\312A\"c\333\215,R\017\255\361kR\322"
+	.ascii	"\250\204}.7\352\3729q\2315H\027"
+	.string	"\025J\b\300\323$\353\262\212\t+\245\022h\277\016,\262\235\342I^\216\206\n\317&_d(\274\316f\034x\016\233\364O\237\325\221\321x\246N\026\036X\354;\332\202\334\213<Tz\004\321@\"\206D\\\024\377\2059%\330\241\210\350\300\320Lj31\b$\235\026\\\230\344\0057\305]Xt\243m\336\013\340\207:/\n\366b\r+*\230DhV\372\267\230\366\371S\001\355kC[m\265\302\007Zj\267\267\032\031\355S\274\365\375qVDua\2502\352'}\261G\2110\201\224\334\242\210#8\023\036\300\261W\024\204!7\214{'AFB\262\234\251k\220F\263t\342w\240\207\322\364\370\374\342\340\234\300\306\243\206\216T\337m*.\242HO:\022\305\276k\r\345\372\305\201\336a\206\3043\353\020Tl\333\342\300\253\200\262\317\347\022\304YM\211\f\2406\364\307wa\361\030\301\325UA\340@e?c|"
+	.string	"\216\265\262\234h\361\243ni\302\341gF"
+	.ascii	"\234\r\362eW\324\017X\204"
+	.string	"\023\356\211N\362Qp\025!\204*\342\322\232\232\301\353%\222(\230\244\027Mp`\204S\305?n\247\224\320\201\355T0\265C\2551\2414\327V\312\260\2718F\342l\027&J\217\233\332\267\024\277C%\371q\201\207\336\2124\241\005\013\351B \rf\311\216\"\315g\274\340\001$\003hN=\3027\0235\302M{\327\364\304\330\305\254k\235\360v\201A\t\356R^\305\205\002\305\244M\321\be\344\025b\311\312 \3443\371\327R\215\223\232|\224Y\234f\336\2412\312\342v  \3230\342k\316\354\354T\373g\37138\303\200Ff\035\256]W\307\302wq\362\025\266G\270T\311\300M7\320D|7\222\032\027\276\345W\343^\253\205\001g\375o\317\006\025<Ql\324\320\370H0W\344\257w\311|\213NkK|\177\243M\256\243}B,m\224\224m\200ALq\020i\001\315\324\b\001\370\026(\240\360+\207"
+	.ascii	"{\r\324"
+	.ascii	"\325\215\334\245\r\303\312\335\201ZP\230\345*\273\350\332\"0"
+	.ascii	"N\"\237ya0\315\304\210\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.597e4a5ad7feb860,"e",@progbits
+	.ascii	"(\265/\375`\004\204\375\t\001j:)AZ \224\242\332\034C\236H/\370"
+	.ascii	"U9\2300\375\017j\246\216\277c/xk\001\314]\f\346-x\361\212\243"
+	.ascii	"\232\201\2138\217Fb\323^2x\332\2747\241\273v9'B\324\277\020u"
+	.ascii	"zb\203F4\346v\346\2726l\301F\342\256\270\231\352{,\324L\341H"
+	.ascii	"\337l\233\330\235RJ\001\275\003\017\004\031\004\367;^r\277K\301"
+	.ascii	"\375\356D\305\375\312R\334?=q\337\233\270\3371\243}\001/=\005"
+	.ascii	"\261\344h?1o\332\275<\361p\202\300}&\274\211\244\"\270A\300I"
+	.ascii	"\032H:\302\273\2076\235\232{P\333T\331\270\237\204\227\326\026"
+	.ascii	"\334\277\301\275T\263\301d\252*\250M\334\367\316\001Jxi%\342"
+	.ascii	"\276{\321\357Ft\222\2247\312=\325\355\264\212\204\350;i\211\352"
+	.ascii	"5\207\373\036\360R\223\r\356{\031\355\356Ch\013\231dp\037\205"
+	.ascii	"b\302KMc\334\357L.\270\357lb\301}\347'\255tDE\227Z\351\210\352"
+	.ascii	"\215\212Nx\251\311\b\016\177\351\227\252\267\013I\322\317\335"
+	.ascii	"B\2726\356\243@\034\005\202v\016\324\241\235k\020-$\027\002/"
+	.ascii	"\355\324\270)@tN|8\352\243\032QB\004IP8\003j\257\321\265\205"
+	.ascii	"\370\32050(o\226\243,G\027P\273\306{h!\271\232N\005)8\232\202"
+	.ascii	"\243\n\250JG\3246@\221w#i)\274\264\253\342:z\235\225\274K@\255"
+	.ascii	";t \270iwHx(o$"
+	.string	"G\221N38\251\036\201f\264\273$)\224\367\312\321\325\307P\224\204\266\242\372\021\332\275\216\207\373\235\322M\322\024IT\260\013\357)\377\240\256\253\350\223>\245\240\274Mp\324\004\231\255U\035I\t\377n\017\355T\252(\207\352\214t#\345(*\326Dh\257Eh\324\n/\3755n\240\274k\034\255\371\341G\273\232\222\242\032B\367{\361\202\362\246q\224\306Q%\357\372\n\0303\352h\347(G_>=\026eFo\320\336)\361\322\217\342\276\023\367\273\245\245\0068\022\376\225\371I\323T\313\2716\211\320\320\250\300K\237\003\237\373\\\013\351%^\372K\367;\215v\030\366T\252z\005\322\007pu]\026^\352E\250\321\302K\035\215\3739TOi\341\242\205\013\037\370`\013/\365\030\334\367R\356(\377T\267\3470\243\356\002/\365\026\334\347Vy/\216*\ri\255V\336\241\274{\311Q%G}t\367\033@\210\257"
+	.string	"\006V\322\241\372\013J:\024\240\013/\365)\356;s\022\001\230Q\034\366\302K\235\002\335"
+	.ascii	"<\355\\p\007\303K{\007-\230L0\360\322\336\242\262\320U\b\200"
+	.ascii	"\271\223\232Tw\346\025\230Y\005f4\b\222\243\355\255\352v \374"
+	.ascii	"\271\234\373w\377\340\366\376n\037\334,F\373\321\216\321\036"
+	.ascii	"\303K\373\210\373)\2347\316;\345(\312\275\237\350\356\356z\310"
+	.ascii	"\300K\033\311M\nN\274\024w\037\205\032xi\003*\2172\274\324\346"
+	.ascii	">\312\206\271Sh\257'\240\256\031^\032\303/\267k\264k+\272O\320"
+	.ascii	"h\347gx\251\352>3\352\215\304\035\205Bw\377\327'x\347\232\246"
+	.ascii	"v\323T\357\3165\2437\367\225n_9\347\222\320\354\2446\223\366"
+	.ascii	"\346\\\345\\s\223\212\242\334S\216\242t\273\t\314h\312\031\345"
+	.ascii	"\314\335n;\213n&]\203\233\371\\\256\331I\345f'\325\373s\271f"
+	.ascii	"q\376n\035\334\247\\.\367\244\271I\305----5\332|\344\250\221"
+	.ascii	"\fJ_\321\255\244\321\360\322\323}\367\356\030f\206a\346\227\316"
+	.ascii	"Q\025GQ\216\2720w\207\205\265\315M\252\243\274\275\373\006w\256"
+	.ascii	"\321NJ\243v'\245Q\275\223\324\360\322\276\265kaf^aF\033\355\320"
+	.ascii	"NZ\243v'\255Q\275Y\211\007\177\217\033\2117\312;\325\355*\316"
+	.ascii	"\234\3427\224\356Dq\347\232\231Q\357\260\340\356\260hnF\273\256"
+	.ascii	"\310Q#\357\225n\367R\216\246\034Uu\373\211\271K=\312\321\357"
+	.ascii	"\366\336\301\321\336\241\337\321w\264\235\205t\367s\247\314\242"
+	.ascii	"\303|\222 \216\002n+N\300]\005\023\325M\340\342\202\262T*\370"
+	.ascii	"\311}O\225`G\020v\230q\337\237\b=\005\337\220\200\245 c\007\030"
+	.ascii	"Z\354P\262\203\212\373\274\343\211\373\276\203\210\373\276\003"
+	.ascii	"\311}\237\302Kg\312\270\3573(\016\272\231,\356\263*\227\233\271"
+	.ascii	"\342\276\322\0313M\334\277\001\022Ja(\231Q\304}\033\314\fq\277"
+	.ascii	"\214\031 \220\220\226 e\201D\003o&\002"
+	.string	"\367\225\234\270\247\343\b\367\225f \204\373h\027H^\260\013?\206\307\30447\251:\326\270\357\225\340uh\321E\321'\035G\334w\035>\334w\035:\334\367\016Iw;\364\013\3216\265?\0052>\270\177\306}g\025\030\226\220\021\203\0032[0\271\337\261\314\0252Q0*\263\204L\0212\022\270\357,\363C\257l\200c\220\220\203\373\356y\236\362O\"&\214\373\235R#\301F\2431\360\357\232\370w]\037\3213h\217Qr\3373B\003H2@\032\203]p!\332a\3401\035\360\230$1>\b\321\217\204\032\243\303}\357\"\336\214\256\242\272R\030\256\372\242ej\321\bZ\246z\243%4M\255\2519\234\334\277\200\352\013\325\027'\035\234t\220C\214\373\252/\372\326\223\016\372VoU.\007\013\356\367\223\034%\270\337u\026\310\301\201\373]\216$5\360R\0305\356\327\224wW\340\205x\300\222\306---A"
+	.string	"F\f\030%\367;\024\306\003)\"&\34057\251?D\031^\n3\304}\357\027^@z\3226\325\227t\2516\214\320~\343\236\303@\205Ir\277\210n&\335fx)\2162\356\303"
+	.ascii	"\007\223*\001f\034J\356w8Dp\2773\t\201C\211\373\3364\365\241"
+	.ascii	"h\357O\342\035\204\177\321~R\362>\035E\271\263\200`F\035\307"
+	.ascii	"\020\367;S\323T>\365\017/H\270\357l\334\367\0272\356{\027\367"
+	.ascii	"\235O\271\\\277\254\340\376\013\023\367\273\027\037\356w/9\334"
+	.ascii	"w\027#\334wqr\277\013\343\276\273<q\277s\371\300}\227$\356[\340"
+	.ascii	"\276\273\360p\337\333\2076\332\215\350\024Z\213n\026\2647\332"
+	.ascii	"\350\013\374;\026\3421Z[ZL+\335\336H\226\350\316\345\\\226^\210"
+	.ascii	"F\303Kotq\277\273\342\276?\021m\202\033"
+	.string	"L\334\367\256\273\241\304\375\033\351\375\332R\204\373^\n\355}\312\345r-i\334O\231P\356\251\026'\367\275%o\311\273\005\335-Mn\013\n\356w\316F{m\331\300}g\264\323\360\322\226 \356\327o\201\200\032\325\213\334G\257Q\235\271{P\235\321\0254\356w\317\202\305\375\312\242\304\375\372\003/U\r\341~\365\342~\005\202\227\252\230\270\357!\t\301KWr\367=\013\377\025'\367;&\376HF\250\356\314E\367\026\355HG\250\316^T\204\366$T\357\b\254\220q\037)W\275\272\036\220\224\303\312\027+KT+N\334\257:x\351J\022+=\334\357T;x\251\n\033\367\353\017\356\253\354@\005\007*Y\334w\225\212\222\373\257\342\304\375\252\262\001\225\312\017)D\270\337\211q\277\362\340\245)Q\334\257)\024xIIu{/\241\344\356w\214v\032\367k\223\373\016F\347PRp\277C\361\300\375\352\203\227\242"
+	.ascii	"q\337Q\306\002\013\264Sk\270\263\26047\251\316C7Ke\264S/\260"
+	.ascii	"\226kj\311\375\037\2744e\201\373h\n\311}\357Pm\334\357~\245\333"
+	.ascii	"\225\202\360R\024\024\367\035\325\201\373\316\244}I{\3274\243"
+	.ascii	"(p\277\362\347T9!\274\324\003\302"
+	.ascii	"\375\033\214z<\270\337\271\264M\345\266\251\3365\215\364\271"
+	.ascii	"\\\256=\027\334\367\206\360R/\003\367S\234J\302!U~\364\310\321"
+	.ascii	"+\216*\332qW/\t\021^\352\351\200\362Vr\224\305\271\275C\271\233"
+	.ascii	"\236tw"
+	.string	"\267\twb\343~\307\355\177C\017\356\347\340~\307~\002\303d\324\355\216\362\306\351\356\277q\177.W\001/=\275\340\2763\027\001\344h-\316\013[\034\030\361\004K\213C\2366\024\315R4\022Kk\243\225\247]\001 \274}\266\207\375\001\223\203[\330\336<\037\201e\331j\341\360\263=\210\316\241Q\254\331\241\221V\236@9\370\005\2637;;0\213c\206\342\rd\255\326\212a\036\341gq~fp\331\330\360\2638EdD^\256\036\023x\366Y\034\235W\020l\307\306\\\262\234V\254U$g\007\273bA\262\326\213\b\017P\n\307\025\324\323\212\301\312^\256X,(\307\262t\\D^\255\"9\366\325\312\261\346\207\002\263\354)\002\251\306!\232\251\302\246\315G\r<\311\323\016\031\2016\004\311\032\016\264Y\363\346c\310\b\264\326\274\371\300\2016kq \362!\236`i\213\360i\322j\326\006\023\224\245\330\3620\005"
+	.string	"\344\263\261=l\030\344\307\247\342p"
+	.string	"a\013,|'p\310\302\327q\330\302g\303\001"
+	.ascii	"\371\354H\322\316\331x\333\2616\314D\242\034;C\314\362\n\237"
+	.ascii	"\375\276\020\310\307\n\005\020\344\263<zZ<1\027\220\035\032i"
+	.ascii	"\341\2556\303\2116\266\006\236\244\214\265B\341S4Slq\304[\r4"
+	.ascii	"\262g\355\006\n\211:,l~\266\207\255l~\250\224J\345k~\327\306"
+	.ascii	"`;\026\310U$G\326\362\261\260\327\013\3378\337\276\347\312\341"
+	.ascii	"\367|\342\027\354yg\007\326\261\371=\207\237}\301\232\237\305"
+	.ascii	"!\302\263\363\202\345X\035\227\354'(\026\203\345\350`\025V`\001"
+	.ascii	"1q\020V\020\326\n\225uT8\211\206h\265\035ZM,\242\302\363\323"
+	.ascii	"\262?@><\314\317\306\232\237\365a\315\317\256R\340\312\241\b"
+	.ascii	"\303\241\030\216\242%\232\235\340\021\033\216\240\315F\346\274"
+	.ascii	"p8\212\035\233'\266\221e\307\245\030\202d\355$\311#\326\007\026"
+	.ascii	"\263#\315\016\215\264\263\004OS,M`\004\3240\223R\251\334\\\004"
+	.ascii	"\b\001\200\3240s\200 5\314\240\260g\275\216O\223\254YS\034\032"
+	.ascii	"A\242\231\rE#\320\034o\366F\fI\233\345\351\311\261C#\315\b\024"
+	.ascii	"k\227CS\254\335J[\2128\232m\305\341gYxV\243\201B\270R\205q7P"
+	.ascii	"\206\315\317\026\201\266\023\233_\217\0246?+\226\267\023\024"
+	.ascii	"\205P8\374\254\371Y\261\006\316L\034\315\246\342S4\305\262r\255"
+	.ascii	"\006\322J\321\244\341\2204*Es\206\357O\217\253\310\2654\304d"
+	.ascii	"\366F\347\325\362\361\201\345\330\227\f\260\027\002^A;\370\274"
+	.ascii	"\025\215\264\3123\270t^<\225\1778 \004W\334\343z\275ZEr<\276"
+	.ascii	"}\270\262\205q\240\315\307H\263Yqh\004\313\0256?\213#\332\300"
+	.ascii	"\321\256R**lW)\025\023\017\215\264\223$\217\210\261\224J\n_W"
+	.ascii	"\f-\240k_\256\"2;\003\317N\t\314\n\305\263$\213\212n\246=\311"
+	.ascii	"\227j\206\027\020~,\326\217\032\354\016\314\272tx\200dA0\353"
+	.ascii	"\352\341\331\201\305~\254K\326\212Y\036I\332YD\332\220V\003\215"
+	.ascii	"F\036\025\207\237\325y\265l\370\331\227\313%\203\3145\304\312"
+	.ascii	"`/k~2\354\"\362j\305\354\016\314\312\202`0\254\343\352\341i\355"
+	.ascii	"X\"/\036\240X\353G\305\262W\020,\307\312^.\237 \"\261\226\325"
+	.ascii	"\341\351i\305\360\342\311\301D^<A/\036\331\013\226c]1\330\216"
+	.ascii	"k\210\225\301\305\023\203+f]@-W\317\217\355au\\\262\034\227\314"
+	.ascii	"\245c]1\227\f\026\250\005N\251<[\234\030,\026s\255V+\024\266"
+	.ascii	"8\317\253\325\252c\\\371\214;\237qA~|&%\036\370\223AFs\223\272"
+	.ascii	"\206\277\307\355\204\227Z \356/-5R\bv\270`\346\336BH\256k\332"
+	.ascii	"\250ir\277\262\b\274\264f\211\373^\315\004\356\373\251\246\007"
+	.ascii	"\257\311\241\204'%\234q\277Sr\245\256\004/\356w\334-iwf\356\230"
+	.ascii	"43\022\024\325\275Y\n/-\001\311\375\024\246\261\301}\357\213"
+	.ascii	"\373U\334w\306\242\323+\270s}:\232RR+\r\0244I\320\364p\3379|"
+	.ascii	"\213j\"\321\265%io\306\362v\212\245%O{O\032N\274V,::}J\361\034"
+	.ascii	"])\025\026\030\207\">\341\367\202\r3\262\226c\315\317\006\345"
+	.ascii	"\370\2700\356\303\375\2608\246)\226a\b\3320\003O\240\023,\016"
+	.ascii	"\264\341@3\355\215\371Y\234\034\037\214\023Z\223,\217\210\260"
+	.ascii	"p\370\241\330\374^0\277\312\263\217\325\261\031\216\344L4mQ\220"
+	.ascii	"\0166e\366\306\205m\342i\036\001\315\020\203\305h boB\332y\363"
+	.ascii	"}\341\207\023\364\223\263\303<\216J\361<\301#\026(\374ll\f@~"
+	.ascii	"\260~X\024\300\263"
+	.string	"F\306p\313\322es\202\360\250\030\307\034\002kB6\264C#\315V\266`N?*6a\230\305b\r\215\264p\244\rA1\242\023k\301\206\2400\313\236\"\020\013{l\212'XV\026K\360\206\260\004\211P\214b\261\004\217\230x$if)\032y1)L\236\326\206\034\255\311\302\036W\233Rqa\024\027\201\266\216O\214\273\201\035\243\330\343\023\227\342i\202\266\323\212\305\232h\332\0328\322\206h%i\305\222<M\261\274`y\033\242\t\215\344\314\205E#\3204\361\314\212D\247\rG\021\206S6p4\022\226 yd\205-N\212\255\371u&\306i\241\260X;\002\326h\240\0218\336R\330\244\351\240\330\345\261\371\331\216ux\214\304\\\261 YNk'\350\325\362aa\226=E \034l\226by;g\240\320m\004m.\214s\341\307gC\232\221\333\314\366\302BB$\f\2078\270&\206\035\213\265[ib"
+	.string	"\204\"\221I\033iB7\362\310\216\"\321\rV4\002MK\236V,o\246\025\207\330\025\217\312\241\n\207\237\3051K\362$m\266V\003U\314\n?\333\302,\363\274\025\2357\322\326j\240\035\032if\220\013\263BV\3145\304'\350eeA?\262 X"
+	.string	"X\347\025\004\003\262D^<4\264z~\354\013\207\237\305\211\341H\263%)D\276`\302\317\206\343\2154\355\320H;\002k?8\330\342\230\347(\226\345-\307\205{8\323 \373\361q\335\036\327\306`\026(\374z"
+	.ascii	"\001\n\362\261D^<1\031\320\017\266\344iO\321\264\346\207\302"
+	.ascii	"+\\\331\345\323z\251\2105\232\020Y\026\211'X\252Xf\207F\032\321"
+	.ascii	"I\2226 \233\023\263+\030\216\271d=<;'\2668\242\r,\205\354\f1"
+	.ascii	"\033\212\347L<E\035\273\232\341\036\013{\245\330\264\205*\374"
+	.ascii	"\370X\341\227:oE#\217]\305\360\311\006Utt\332R<k4!\035\273\242"
+	.ascii	"\261\261\036\333X\034\210\302\317\342\b\t\221\347m\006\032\321"
+	.ascii	"J1\264\242\021\355\234\265\354j\305<\204\204H\023\363 \317\033"
+	.ascii	"X\231G\r\274\215\240\315\343\027\214G\326\352\201\375\304\\\262"
+	.ascii	"\027\317\n\003\005\031q\311Z=\036\213'X\263\346-$\313\243!\013"
+	.ascii	"\332R<\205@k\336\004!O\323\304\241XTD\236\246l\205\213l\267\320"
+	.ascii	"\304\346go\314s\024\215\304\031X\236FB\221hf\332\325\016\033"
+	.ascii	"L\360\\\341\333g\215D\025\227\2449\212\246\221\231)\242\2608"
+	.ascii	"\222\243\211\303\317\226\342\021\333m\2640\236\221\366\023\303"
+	.ascii	"\242\r"
+	.string	"4\255X\2026\310\b\312p\370\025\335\340\024f\211G\354I\2166\254\335\310\331\216\360\204P\034\305\"r\307)\232=^\270\031\305\"\322\036\205\240X\326@k\322R*\254\360\263\344i\303\317\332\310R\310\206\341w\226\344\317\307\254P\254\035\001G\321\016\001\n\2627\360\210\005r\226\344\017\017f\2354\234h\311sv4\263\245x\003Ydo\206FZX\2027\224\344\316\212\255\263y;\301\323<q\n/\240\006\033~6\007\243XH\210\204\021CZY\212F$\016\256\325\300\216\205\204\310\216m\264\36241\f6Zy\026\300\302\260*@\t<\243\325fG\263\023\267\260\3075\320V\006\2075\250\243'\243\026\306\031RHDdd$I\322\001\243\022@@\210L2\224\013&\343\350;\023"
+	.string	"\201\t\004\321xH\030\r\006\343X\222\003A\206\3419D\f1\306 \223\031\021I\222\016\210\005\331\025\346(\376\246*\001I\020\371s\240\020\321p\034\371P\353Z\220h\332k\307#\241\b\361\022\204\365Nk"
+	.ascii	"JE\336\365\335\377\334$B\323\026h\026+\217\332C\021\244#\330"
+	.ascii	"\037\005o\272\3429\252\374\316\373$\243\240\321\257\253<\023"
+	.ascii	"o\236\224wA"
+	.string	"\017d\213\344IX\"MN\240%\027\224\373\314\265Y\2652\330<\327\271\327N-\330#q.\337\317\360\305NE\025\326C>arYvuO9`\277\236\301\025\3240\331\247\030W\016X$a\307\243\nPm\221\305\3604\251\364\177\316J\311\371\227\272\252>\353yX\200Y$\314\004@W\024\332\263\304\335\237<\354\205\305+\211$\227\001*\234\250;\231\221\026?\n\351\013\3135\n\363\036\352\bYr\332\370\022\272\255Kj\201\232\210l\2645\323p\225y.\364\210\375\317r\225\007\r\204\2039[f\370\207>\370q\317G-\2233J\206\200\347\370\214\321\312\311\027!\202\344\030\373\233\036\033\302\202sN\262*\265OL\221\254\222Q\205\r^t\230\251[\200)\254\n%\317\271\007/\020\340\n\335\245\"\n\351\351:>\377\345y9u\243\203'\200\275b\002n\335\237\354\245\227H-n\020\211*\205/4//\244"
+	.string	"\r\035-\016]\217\304Z\264D\246_'\357]\371\370\2079\305\235\332\342\346\243\254M\207\203.D\221\272\352JW4U&>\202]YEv.\320\273\212IG>\376\222Pw\221F\271+\341\213\264\005J\365\016I\260\327\035\232\265JR\t\342\212U%Hx\241\f\351\033-\255T\205\2427Q\355-\371\004W\247d\341\324$W0E\217G\0374`\"\367\017\334Pn\024\337(rm\276"
+	.string	"\233\323\3570\257\253\002"
+	.string	"86#\202\0369\372\r\211\336!\005X\261n\207\312\020\221\314\273\020\232'\206\264'\324\247W\006\267\017\\\021K\363\007\255\274\307"
+	.string	"W\023\363\302\243!Q\343\221G\f\357\242}X\361\032Z9\252\235\244$\340\021\275\214\354\351>\357\355\362\362\023\271\346/\r\326\376R4\373\324\256m0\273"
+	.string	":o"
+	.string	"\325\004\203\021n\361c\271\3451\317\352"
+	.string	"\\@WR\276\242\224Z~"
+	.string	"\373R\245\276w\020\3659\322\247^\300\355\263A\341\377\236"
+	.string	"\021"
+	.string	"\037B\363\004\367\257\021D\217z\033\226P\324o"
+	.string	"\240*\304,\353h\342!$\023\027\232\370\370\363E\322\035\360\333s\305*\002\364\352\304G}'v\234s\333\036\253{\005\035\304\t\222\313\265\205\270g:\206\241\214\2676\360\235\325\366\321\223\023\252\261\344\235\352[\232\242\370\306AL\2079}_\306,,\303\035\363\235D~\241\027\250_u\333m\3434\266i\243\342,\004)'\005\361\334j\b\240\354~\021iE\2743\266\243*\252\222`\t\342\271\037\353\212]\220\222\320!t\033\223\232\252\341r#-mq\255\310\013b3pkx\024\341d5*\t\346{Vx\251|\254\345\021\335\2022\032-lt\310\007\351\260k`\242\375N(C\211\373Y\272\004#\262\224\024\270\\iN\346\344Tn\2279\306\301s\357p\023D\027v\205kL\270\365d\343\231\326\023\206\034\247\205\033\227\036S,BK\032\226+\320\025\206H\024\362\333\261\037\213{j"
+	.ascii	"\0014)\366\375f\226Yv\261-\366@\340tI\017\273\236\271\305\336"
+	.ascii	"w\007 \373\243\212\240>\263\246\237\220\240/\213\326\251\222"
+	.ascii	"X8\037h\215\247\020=a\203\342\201\262\227\017x\303\027\\\326"
+	.ascii	"\033\373\320\302\267\251\260\275\272\250$V\2202E\373\300v\312"
+	.ascii	"\304\246\235H\002 \310 \311\277\fz\006\311\324\220\366\365\210"
+	.ascii	"\236E\252\\\314\231\275\034\320<\033\205\301\r\215\n\b\373M\271"
+	.ascii	"\004\313\310\341\266`I\256\245\223H\353\304\n\326\020\304\372"
+	.ascii	"\321R\360\367\024\370u\341!d\302\2068\344(V\206\362\006y(\360"
+	.ascii	"\374P\340>\020PBG\313\341p\037>\254\210\002\034M1NN\016v1\032"
+	.ascii	"K\254\251&\273YQ0C\216\224m\320\204\037Yk\"'\246\244\0168H"
+	.string	"\2448\346\367\273\243\312\325\2523mC\376\312\b\357e\252\263\240\021\271<\0304\341\366QJ\245Y\001<D\200\225>\227\036\265\275'\336\366\261\272\307\177\2077[M\t\032\352\351\314p\026\364!b\036*s\325~.N\334km*\334\354\213\270R\323T\312C\201m4f\320\035\007\230Bs\344\030\216V\375\031gh|W\027\3346\206\300b\313\323\271\332D\b\017D\270\352\336\350\307\370\246\364\317&D4g\007_IE\023\232x\377\335\376n\233R\232\206\266}\030j\001\304\342\200:PWs*C)\201\215c\371\272R\367\206\024\315\261[\367\213\365,\370$\211\336\016\342\0375G\027\370\344\231\215\355gb\006\2177\032\204\361\224\3015J\027\033\243\256\353\252U(u;\336H4O\b \271q\017S\362\266A\353-\b\231Rn\303\203\016\022\026\341\0026BJ-_\177L\246\257B\344R\033\013\265\320r\r"
+	.string	"{l\323!\004{Fh`)F\375?M\306\337^\357\276\007(\353\032(8\271X68\372V\362w\234\252n\214L\372UL\200\345\025\302\276\005\246\350\f\003\177\350\346\001w"
+	.ascii	"=P/>\220\260\253\240\202b\215` \227\021\177\373\365\234Q\206"
+	.ascii	"\207[\207\3142>7\017\366\206\210\203pO]\036$\366\312X\264\262"
+	.ascii	"\271\350l\204JMv\356Z\243\256\307\266\304C\200\232\337\034\215"
+	.ascii	"0+d\211\342J\311\223*\321l\243\242i\234\3070O\373L+\031\031("
+	.ascii	"\023\363\301kX\002c\354V\016\203\306\371\310\365X#!X\2757L\004"
+	.ascii	"\245 A\270)|<\241[\244\204\022\336\320*\237r(8)\221\245\275\375"
+	.ascii	"4\314\266\304\253H\342V\246{\331m\023\370\231u\357In\001\016"
+	.ascii	"\2120\024d\257\267\210\\)Rh'd\347}\204I\253I\320\353\204\225"
+	.ascii	"/\246\366\274bf\361\237\247\324)\321\250B\340\275F\375\350\r"
+	.ascii	"l\250\221\023\327\223a\234/\373,\016iHE\223\375N\030di\366!{"
+	.ascii	":\177\352\360\036e\004\244\325\355T\274\307\020\271\241Lz\333"
+	.ascii	"NE\252\204:v\317\326\001`R\264x\220\022\333\340A\035\214\323"
+	.ascii	"\322\203\026\350\240.i\351hp\354U\333\312_\224\326\267\214\365"
+	.ascii	"O\rY\206\023!\371b}sF\271\233\202\333_\236<\317\377X\306\016"
+	.ascii	"\230C\227\352\331Ai1\217E\233\016\334z\304U\365\221I\260\230"
+	.ascii	"\330r\310#\325\307\332\216\202f\240\201\005\021p\267j\3626Pn"
+	.ascii	"F\027@\220%\212Q\2328\b\301\021"
+	.string	"\202\232\002\267Qf\311\2379o\370\205hK\340\323\274\245\233\217\366\330"
+	.string	"}/o\330*}A\345p\026\257=+\321\002\324\322\330\217z\037V(\315\026\334.\331\204\260h\r\001\336\2070$}\037\376|\205=\370\304\317\017N\036\2449\026WiKL\360\300\305\332#\220\372j\034\321\377\346\234\252\323"
+	.string	"8:c1\372\316\0020\242D\266\366\214\336\r}\037<*\216D~\332*\254\254?\351\335"
+	.string	"\236\"-\371\001{\303\231\305\335\t\350KJe\206\261\n\037\2710\223Vc\035(c\306:\025v\2268\374\031\253\036`\001\277Y6\"\372bk\303(\373\270\2325\222\321dY-\020\361I3\024m9H#\320\260;]^\330`\327\202\346\375\377*\242W\256\240l_\032\206o\357\n/!\373\377d\267\220\333\342\004\377[\312\177V\374\026\371\345\n\305\311_\315d\257\rct\360\024\340\316 \234kN\332l\213\307N\322\025n\222\030w\\\252s\254u\316\236\345\003\253+\201W,\306\203v>L\220\371t\370\375yT\354\371\361\307\006\210b\023\212?\310\306\013<Z\342\251 \252\275c+\371\240\236\370\220E?q\376\020vP+\267\354\340\320Y\236\002\207\375!\rQ\210\177\330?\216g\304y-\234\240\307\326\261\b\247r\350\367|"
+	.string	"\374C`\216}\366\017\204\220Kx\353\242RR\236z@*\301\033n@\300\266\034\312\275\257q}F\345\345O\317{\204\"\206\324\006`\2075B\036\f\n\321\f\245+\260\001\330\234\214\204'\026\302\336\266\034\351C\221\200\356M\003\234\351\314\362\013\367\r\334\023\t1|\276+`\202\246\267\3329\367\251G\201\b\025\0177_\333F\2108d\307e\335\205\231Z\317\334?\343A\"q\357\004\220\0075\362HL\324\370\256B<\217\345\211\313S\303\374\013\324u\217\230\020\205\360\317\b"
+	.string	"L6+!\307\027\352\227!\313\310\243\355z\334F\021\3744\335gJ\034jd\256\331\020\035&\301\002\327\202\036,\034\266\322\"\025f\227\013\205\317\301>4\371N8[\330\037\343\271\223-\f!\321\262\314\225\234\374V\263\376\314\372\376\272\346[\362\317 \007_\2027\341\331]\210\362\225\367\261\306\311n\017\206\340,\353N\372\272HEWl<YX\030\200\231\303L\007\213\207\336\214\266B/*\237\211q<2\346\376\256\313\226\301\312\n\304\213\205\217\305V\001r\270x\234L\366_cyq*\214\270Q\005"
+	.string	"A.\216\r\241rm.\210\356\361\314\360\304{\205\312\351\2046\347\rT\237\241a\033q\330\2668031\016\253\301\"\001~\275\222\211\b\251\217\204a\274\314\341\032\255\333\200_\245#\315F\252\006\264\332\226H\023\3349\243\307kr\351\t\304\326\253T\244c\030\276P\326pH81\272\205P\240\305\302XJ\252MR\323]+\200H\"A\373|^\017H\326\223;9o\303*\376\b\243\373e\270\347\272\377Y%\001MqJ\005%'\205\365a\333\212"
+	.string	"\335\223(\244\006$3!bE>\233\346\2433\300Qq\340\215\253\34075\313-\254\345U\353\314\226D\244\326d\373P\235[\357\007\232HD/*\020d\223\031.\346!\316z\263\237k:\035\254\227)7\204\376h\321\3738\033\003\016\263\016@\315=\215\204)3n\004\026/%U\240\221\021_\3403Y+\2308\366p\350\\\202\342\371\342O\210\271"
+	.string	"\032\304\3474\205v\305\322\223w\212\f\334kbD\346\354\374\356\316\266\241\241\347C\356\016\371 \353\235\347KC\203M\270T\240\255.\316d\350\360%t\2708k2\264_O\b\370\334\3110@\004QrMv\243.\257\r\210\006(:v\206\002\265M\217\212\266\004=d\004\335\247\201}{g\256\205\270n.\n\225g\265b\252\262q\200\266\032C^(\213\367E-nN\212\314\032\357\3422\301Dwc\247\356\327\256\245.H\226\223\344<g=x\032\365c\270\201<\3352\226\267\254\325){\037X-\304Ov\203@Y\037O\365\2550a\362\025W\002\331\241\2467\306\224>\272\362\262\246\320\341\324\347y@\276)#\276P-\312\\\304\021\2770\246\263-\017\203\211\247m\244W\240\212U\224\363`B\203\353\317\370B9\205\330N\303q\301\003\"M\345\0356"
+	.string	"\223r\233\252\322\317\020\211\246\365\263\252\265\316\247\030\265\257\306S%\357Gm(\264\305d|\214P\237@\371\255\252\377\275\306\334W-$@NK\320\247\226tQ\240\006H\365\214<\313\372\371\357#.\211\001\024\377\345\270\264\024 &\b\273\016SD\246&I6\222\313\007 \377\232b.\231^\003\364\310*\351\317G\336\177s]\344{\004\247\217b\222\017\177U\315\252\366\260\246\222T\f|g\353\022\246\276C\226.2\001\322\024M\3314A\022\371\351\005\356\332,DP\363\225[a\323\001 \331\255\310P\211sj=\260"
+	.string	"1\312\227A\247\214S\245\225'\337\037\271\f$\246\304\013m\034\366\231}\235Na#\304\017\f\210\223\271X\366;\355 \nT\252\227\337\226\355#"
+	.string	"\216\027\314\232\"%\361\337\355 Iy\307\t\017\205\307\260?7\b\267\211=\326"
+	.string	"\034\027\314\"\307\033C(\325\363\022\322l\301\fB\fY\026\301\305\016\306A\004\032\3069\241.*}|\2770T\207\225\257=\367\341@\203K\264\007\322\"\264D\366>\013\\\352{\243f+P\344\257y;K\314?\256\017\344\372k\375\372s\251\323\2274?\272\200PY,\n\201\032\276\345\301\304\203\023\323 s$R\017\226\204Na:\336(\354\226\023\326"
+	.string	"Z\007y\271@\335s\370ul\203\375\035e\243$m\206\005\257\207\357%l-\376i\204\266K,\332\361\234d\206t\034\256%\326}(\032f\306C\214?\026\3337\2530\036i]\274\270\322"
+	.string	"1\005\202\026(\\\257Yq\251\220\205\021k\315\026\312\277\374[\252\310\020\320\351\027\205\242\225G\347\004\377m.\031\001\346\244\220p\373\221,k\034"
+	.string	".\242O\307*\342T\3043\347\214\356)\253lB\370!\001\264\206p\365\377\305\366;\237\246G\370\220\353\211\321\243\312\023=\231\001\305\211g\275[\217\200\032\217\372\217\361j5\233B\225n\214\222\302I\206`\033\303\276ivg\262C\303\020\345\222\b\217\255\024\005\267\035V8\310\224\270\025s\321\310\222\021P.=d\270\244\352\263\212\00439\272\267\335\257b\031\212\024 \203k\3356rbi\231@z\003\221\225\317\256\235\303`\342\274\326\327\374\016\025\360\220P\203\262|\027\343"
+	.ascii	"\337=t\036\316#=\362a\262\211d\235,\002\344\362\214\273\361\274"
+	.ascii	"\375\360%y[\225\352\274>\315\377\347\337\374\357\331\345\212"
+	.ascii	"`V\263}\221\0335\177RO\334\243\234\347\263\n\202\372,\"\300\244"
+	.ascii	"E\3706\363\343\252\335w\233\356r\251\365\225V\277\232\267\265"
+	.ascii	"\362\224\034\235o\360\032[F\240\373\021W\fp\327\353\027%\256"
+	.ascii	"\0169\266n\330\313rp\216\005\243\231XdS\035\371I\355\323Y\201"
+	.ascii	"~o\303\254\312\227XD\331c\002\210}\223\213#\004r\232\326lax6"
+	.ascii	"K\273\024\016\024K\241\210\2617(\r\023\331\230g\037\320\263\233"
+	.ascii	"e\366;\334q\360\347\253y>6\276\207\341R\271wQ\223M\221\370\004"
+	.ascii	"\025x\034\201w\004\377\260_\037A!I\245\252A-VFI~\242\277\257"
+	.ascii	"\022\226\272\212?s\3736\t\025CSz\206\311\313^\207d`"
+	.string	"\253\217nT\022\335\247\"fF!\205g)hQs!H\254\302F4\371B\205\n(\2620\002=\217\237\216b|\227\bHV\374H`\344\035\f\376d\245\016\002b7\315\242\243\2501\226\271R3\022\370a\210\356k\013\032\003Y\342@\324M\251\266r\336o\016\366sqE\354>\223\0357~\262\006\036\302\"\271~|2dE\032\347@\277\354\360?\007{`hpra\243\375\230v\007\3172\372\250\031\253\324/\335\237\262\245\003\330\221\f`16\031\03268\251\3710\272\205)\371\232\214\327r\332\251\004\311C\312\004\2123\243\250\025\f?5\222\005I_\212R~\232*\3750\202\347\321\246\305\333*\361R\203\024\357\350{\027\003}\320?\242\210\301Y\245\264\211\311"
+	.ascii	"\225\\\345j\3077q\360\026T\314\240\312\201\224\375"
+	.string	"\246\016ow\016@\351\023\236\311\202\366(\355cM\321}\267o\"\027-h\264\276a}\2575P\206b)A\375\320\214\361+\246{IN\352\221\335\246T\202=\202\312\t\356\217\021\271\n _XZ\365\244\034\277ov\310wU9\252*D-{\342\320%U\250\355\322up\201\336\243 _\002\337\331\207\254\366w\267\315\2134\232Jz\"\017\036\364o\251\244\377\331\021\207\375\031\256\257t\222\006\322\201\264u\025\203\241V\345\372\366\036\216\377\373\006\375:\260\032\223\307A,\313!$IWY\377\256O\215\013Y\334iDB\317G\311S\244\031.\367\007\352[WlK\037\344\327w\2511\323\246\211\030X\260\324\237\356\301\206\212\350\246\233\303@s\216\006\227s\265\373=L\326\235\007\331n\224\006>\207\306z\026\242\334\203\335*\221\001t\203\f\334c\"*\230\370\245\030U>\272;\263i\254X\327/\241\333\342N@V"
+	.ascii	"\356m\333\235\037wh\320N\263A\373\325\313\226\003\270b\255\241"
+	.ascii	"\344%^+\370,'p\272(\316\202\350\205\300\300s"
+	.text
+	.section	.gnu.lto_.pureconst.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"\315\t"
+	.string	"\346[M*\260\264B\241\003\274\331\t\312\330s\247\330\234{\262\214\210\250\327\3072\276\315\244\310{\020\314\033"
+	.string	""
+	.string	"\200\002\305\324\025\306N}d\013F"
+	.string	"B"
+	.string	"C"
+	.ascii	"\005\302\372\340"
+	.string	"\036\274\203s\360\r\256\30138\006\277\340\026\234*4\240\340\023,\t\036\301\202\340@\006=p\007\316\300h\201B\n\254\004\216\300\017\270\001/\340\004|\200C\002\\\207\002(\004@\241\031\375\214\313\317\317\354\004V\021'b\r\261\204XA, \326\017\367a\365p\036\326\016K\207\347p\034~\303\311\206Q\r#\032\326\f\227\3411\034\206\277p\027\336\302Y\370\nW\341)\034\205\237p\023^\302I\370\b#\021V\b\003;\3433c\2642J#\343\033\343\023\343\013\343\003c\355\213\321\274(\255\213\321\202\214\266\305I\213\225E\t\213_q\262\002T\305\242\342S\\\212\025\305\241\370\023w\342M\234\211/q%JI\234\220\370\021\313H\276>>>N\333c\320\364\370\362\370\360\370\356\370\354\370&\237d\264:>:\326\206|s|r|q\254\301\261\366\306\232\033km\254\261\361\2551\232\032_\371\366\245Q\032\032\017"
+	.text
+	.section	.gnu.lto_.ipa_modref.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\243\r\3454"
+	.string	"\252C8\016ApjM:\361\035\273Z\017EVy\b\334\342\020\232z\374\330o\021A\207\206\304q\033F\316\373/\361\213$\0222\252\325@\005\004Q\321\335\203=\031@\311eP|i\216\361\337F \310\232%D\312\024\275"
+	.string	"\340"
+	.string	"\323"
+	.ascii	"\207\342\300\033\216\204\367v\373\241(\274T\373t\r\267\333\315"
+	.ascii	"6\374m\006\f{\301\002o\205S\210\342\365\025\232vnB\024\257qM"
+	.ascii	"\262\004F\323\232k\363\327L\202\021 \360\2035\364\323\272\263"
+	.ascii	"\353nv\360\267`\346\261\301\202\355\365\353+\022\276\335\306"
+	.ascii	"#\314\337\036\257\202'\2202\353\253]\3329\004\007\376\337\304"
+	.ascii	"U\304|Q\214a3;\330\364T\300\351L\340\027\020\200\351?\2003\341"
+	.ascii	"]\372/V[e\333\273C\376i\275\340\277\313\246\271\337*(\274\207"
+	.ascii	"\302|Q\244\375\247UZE\001\356\317\343\370\357\362\023\336\217"
+	.ascii	"\267\347"
+	.string	"\371&bQ|\375~\177\376\"\342\375_\003\253\2019\201\337\363\025~\001F\002g\025\207\247\367\223,\344ADEf%M\313Yo\311J\273\317@\370?|\334\026\251\254\331\364\256\322\216\362\207>\341\021\263f,\267\224r\034\307\357\206\2044[\356\264O,D\331\331\246\273'I\342\357#\2311\2076\226\312N6`\025\277\220B]X#\212\367\305X\002x_d\274/-\262\246\013i\204>\261\332\226\234\237\325\271\253r\273=\252\351f,W\3138\342\243\002\213t\353\246V\314\2321\255\256\365X\353\361Rxi\225\371gZ:\216_G\f~\033\305\b}b_j\327\003@\270F\200p\205\272\317\374$\214x\235\234j\272P\212\321\024\227#\243\026\306\213G\3513gxY\274L\231\025\213x\317*R\360\257o\373\331~ \212\237\270\211\022'Q\323\355\b\021K6\004\210\017\036:\374\017\335Yi\371\250\374\365"
+	.string	".o\252tz5\001j\323\334PG\362n\321\312j2P\273\222\221\340b}\265\374X\2560\270Y\316\304\343-\356D[\225ui\353uc\351y-\026\035](v\335{J^+'\177[T92K\256\235\005zK`m\252\351\346s+\271\002\265\213\332\347\202\205qX\030\243/\367-\321Va\340\253]\315\272\263R\023E\3208*\374\237M\341_K\t}bL\271\3365J\b\013\345\201\205\246\215\022*\315\357\021\376Fa\220\f\2410:\250\3124\321\247\326j\262e*\252%\264'\313L\262\223s\023'\022dr^\222\367\244i.\311\343(\212\313\007kNd\250\344?\327t\234\244\b\200\036\221\023\335C$\244\351\263\273\314hs,\037\247F\332G)\250)\250\251\036\031l\207\332"
+	.ascii	"%\325c\203\355\343T\217\f4p\317W\317\326\245,\274u7\254\316>"
+	.ascii	"\330\245\347\227Y\257n\351D1\311\213\316\001\013}\265'}\005\t"
+	.ascii	"b\276\2348p\336\360.\035C\323\256n\232\256v[q~*\265W\037\263"
+	.ascii	"\222\326\3253\267\316*\2562\243i\243)\353\222\214\327W\350So"
+	.ascii	"}W\n\363\371\212\3015S\346\251\31731\021O\257O_m?Tp^]\265\275"
+	.ascii	"\300n\246\252\037\231o\016Aw\372\245\317\333\265c\226\253|t\332"
+	.ascii	"\350\222\313T\323\\z\021\322\266\002\353:\365\264\321fR>v\270"
+	.ascii	"\272\377\374a\266\342\rs\334\202\371\027\376\022p\271VD\3329"
+	.ascii	"s\275lua\3523i\302\276\322M\306\353\320L\332\275\265\334\201"
+	.ascii	"y\250\341<\310\230\231\021\021I\222$\303\001\221\004\2061\346"
+	.ascii	"\240\205=\022`\225-\206\231shHS\220\222d\2179W\300\370\204\313"
+	.ascii	"\221d\222\342oWTE\2501sKhuy$\265\200\363\236\231q\224\317h\231"
+	.ascii	"\n\013S\\\026e\221\250o`\033\"\203\364\326\213\303\"\200g\354"
+	.ascii	"]\274\346\201Y'/\326\022\3218o\323\220\252\207\266@\013a\333"
+	.ascii	"R\365\265+\376\241O\251\034\336tl\220CyS<Vrb\361R\f\331\036\262"
+	.ascii	"\357"
+	.string	"\336#lI\034O\331\322BP\033,\372\307t{\221\301\006\244\340\034\237\022z\026\333\202\361R5[T\244pEw\254q\375\360E\241\345\263\224.x\236\340\033\020\233\364\2165m\251\214H\005\355\005\007\027NSb \264\235D\313<T\324\210\221\215\340\255\336\370e5z\3668k\216\005\035,9\036\310|c:\035.{\357\262\246\247\304\336\003}h\247lvM\362U\021\227\346Hn\257([\bl{!\34165\331\212\022L\246;v\251F\006\354y\035\260\213\362\334\333<\036\0172[\377\230\334%\3102\322\323\305UW)\245\016\327\242\220\303\263\215+D>M\352w<\343\263\330\256\2712\337\177\335\r\337\306O\030\250\230\277\260q\200\365=E\246\363\261\33468O\030\274\347u|o\207;\362^a{\320F\264K\242v\334\332\2641Z\273E\360\353\301 Zn\036S\366^\225\247\275\227\0010\033\363\005"
+	.string	"u\331\036\376\261?\375\020\327\213\354;C~\203!M0\362\272\304\277\020v\\\030\216m\235\201tb\n\021>E\327j\267]"
+	.string	"0\340\367\242\202i\212\345\320,(\212"
+	.string	"\017g\217\006\032\270\260\177\204O\276 \023\327\211\354\345\200\364UxS*T\337\354)Q\013\311\366\326g\1777\262JR\342\210\320\323\373\352\241\350\321\302\335\265GSm\246W4;"
+	.string	"\251\0226\247:V+a{\345\024t\207\3122okFN*\342!\272\241!\323\267\363Kl>\035Zt\"\207\033\235C\031\264\266@"
+	.string	"\260|>J\001\262\305\235\327\314\247\263\264\342\374,\022\3668\323h\225}+\007d&s\210/\210\337\377F\303\260\200\001\327?\307[Yv\340\b$\212\0349\206\355e\264\335\262/\221\231e\204\320p\377=\006;\301?\352\324\262\355\203$\234\242u\223\350\314\227k\217\332\030f\025\231~\350\230\376\245\301\363\003\310N,\362\022u\325\215]\036s\263L\252(\\\225\214\005'\316Xa\330\352.\375\271Y5I\250\035\372\270.9pF\322O\\\304=X\t\213@>\370\277\177P\021?\334kh\005M\375v\022]\241\331\250d&CN\220\325\246\311\027K&\372\027\021\025x\354I8Yc\n\n\004\023\244| \031\302\027P#2`\007\351\334W\246\202\002\364\275"
+	.ascii	"Z|\247\002\344zq\t\350>z\363\311[\217b\254z"
+	.text
+	.section	.gnu.lto_.lto.597e4a5ad7feb860,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_featureNames.202.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\312\003\265\026"
+	.string	"fh\227J\240\330m\306\007\263\350\271\376F:\357\006\355U\\\264\240\267\346\2470\307\311\361\360Uh\230\017<\315\354\261{\362\254#q\f?\024\377^a\006\365\264\324\035\005\b[M\215\361\220\225\243\300\253\303\331\311#\017e\352\203\242\310-\223\f\206"
+	.string	"\204"
+	.string	"\200"
+	.string	"\275\f\305\002\211k\206}\215\003E\315P\255\200&A9\212\025\022\327\336\276\036\240D\315Q-\201#j\246bsZ5S\265\005\206\250\271\2125\020D\315U\355\201\240\232\255\020P\re+\"q\365\331\327\t~\2509\330A\\y\373Z\001\324/\007[\334\276^\320\303\227\261\330\017\342Ja_3h\002\221\261\332\020\342\372`_7\310\361\213I]y\231\341\005\004\256W\2726\022W\274\257\035<\347\"d\256\357\326\275a0K\020.\344&`\322\321\204\213e\f\205\\\327\3020\324\220\253\305\270\005O\330\305\362\304\365Y\373:\304*zaW;\265\257\263\322/\364b\332\327\032\233PC\257V\006\227\370\205_\354m\354\353\031<\"(\374j_c\207\251!\030K\343\345\013\301\332\323\330\327\2610\2750\354K\373Z\306\245\206a5]\324\354\004@\213Ovj1\210\353\221\366u"
+	.ascii	",C\371\2115\332\3276U\322\374\324\376\210\253o_\337L\t\032z\263"
+	.ascii	"\rB?D\263^\221o\246\223sU\016@E3\017\252Z4\223\335s\334\225\344"
+	.ascii	"-\305\231\247\354\376\306q\\\307\231\276\343<\356\364\247G\335"
+	.ascii	"\307\245>\365\252[\375\352@.\344X\317:\221\027\271\221#y\222"
+	.ascii	"/9\223;\371\223G\271"
+	.string	"\224k\235\312\255\374\312\263|\353[\316\345^\376\345]\007s1\037\363\257\203a\240\004|\204I`$\274\342$|\002\243\300)\360\n\314\002\273\300/p\214\b8\027g\232%\255\226\326j\264tWa\207,o9\022'vM\335\016MO\335N\207\223\335\222F\236#\272\273\351P\331E\315\235|\317\321\226#o\343N\216v\326\\\336\271\033qc9\356b\027\307c\246\345X\226\264\223f\246=\347\3155Q\\\315FKI\024=i\256I\236;4\265\215e\354\332P]\276\244\211\246=\347\314}\r\035e\367\324\241\271\021M-\214\347\255\246F\342h9\236\315\346\366t\204\002E\250!0B\034K\005\267\240\214Ra9P\203H\3336\020\030\202\320\t\223\202\007]\353T\225\201e\376\253\256D\377\177&\255h|\331\f*=\317G\376\373|\376\335$\320L-\252F9F\240r\025\370!\013\326\365@\206\265\323\310"
+	.ascii	"\323^\270\372\355#\335\177Xp\370\331\271\242\263\3677\342F9\227"
+	.ascii	"w\224\33477\224A\225\303\270\362\034\273{g\001\021\271\013\336"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_mixerOpNames.203.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375 \267\345\004"
+	.string	"t\bv"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\336T}\273\001"
+	.string	"\005\001\006\025\001\003\005\001')\330\335\004}\276\002\005\001'.\230\335\004}\301'3\206\b{\330\334\004y\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004mul"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\004add"
+	.string	"\004set"
+	.string	"\002-"
+	.string	"\007"
+	.ascii	"\274\007\b\205\324\300j\260\265\317\254\003\324~\003(\002"
+	.text
+	.section	.gnu.lto_mixerInputNames.204.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\211\003\035\023"
+	.string	"\006\344\202E\240\332I:\257\016[\374G{[R\034\023\020\001@\002"
+	.string	"\n\3605\270D\257\360<\307j#j+H4 \206\300\315\3553\234\227\322\022\205\024\341Eg\020B\370\023}\313\361\256x9m\227"
+	.string	"\362\230\377R\356\235vm"
+	.string	"m"
+	.string	"n"
+	.string	"\364C\237\025l\001\227\254v\3503O\026p\313(\212\332\216C\237\027X\t\267\254&\365\231\301\224p\317\350\206>7\210\022\356Y\325\320g\007N\302E\243\031\372\374`I\270h\365B\237!`\205\233F\207\372\034\301H\270i\325\247\317\022\206\204\033\207R\350\363\204\363\344\234\343\201\204:Yf\225\236\351t\273S\235S\324v\262\317\361G\214\023+\262\305\267]9\372\234#\243\276\355\302\321g"
+	.string	"q\276\365\272\321h\337zU\033}\016\360\346\333/z\325g\235\262o\277\252U\237w\304\276\005\243U}\026\260\346[\260j\242\266\273T\237\007\200\201\033\366\250>\023H\003nX\r\373\\\300\f\270b\364D\237\rl\201+V\241\372|\200\f\270c\324\251\317\b\302\200;V\233\372\234\300\013\270d\001X\256\345\365\\\336\345_\016\346b>\346e\256u\256w\375\314\321\334\353_\017\273\232\263y\233\217\235\354fws8?{\232\220\324I\025r\205d!wRJ\272\220T\362\205\204!\255\244\fI#H\326"
+	.string	"\312M3\335T\024\206(\257H\254\026Tmw\037=\343\333-\332\243\3172\306\267[\225G\237g\325\267\\tG\237w\352[.\035}\346\261\202\2147\243\031\177\214fD\302\315x\204\233Q\t7c\022nF\0177#\2227\343\2217\243\2227c\2227\243\347\315x\373\001\n\022\032\"*\262\300\344m\364\271\375"
+	.string	"\005\t\r\021-\3654\205X\26295y\020a[z\202\262\365\360\304\334\b\020O\266\022\271\334\223m'\026\335\230<\216\017r!'\362\"?r$Or%g\362&\177r(\227\362\254Sy\225_yM\250\021\260\214"
+	.string	"\301\031\262_s\240\203$\351\020(D\232\204\353"
+	.string	"\210"
+	.string	"\024"
+	.ascii	"\b@f!'pW\210\345\260\2102\324\277\324\021\251-\244\320\247r$"
+	.ascii	"be\250\333\352\373-\206\276\t\235\340\334}Z\304%\217\3418\304"
+	.ascii	"\341p`8\206\343\020g\336\220(\f\025\334\024"
+	.text
+	.section	.gnu.lto_mixerOutputNames.205.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\265\007"
+	.string	"\"\31515@s\322\001\3030\fd\361\330\320\336\347P\213C\017CaU\004\002\254\030\2110B!\313\261D\022\005i\377K\024}5\262l\325\200\370\324q\215\211h$\313\226R\376,\032\264\350\320\242\261E\213\026\215\260\350\204E\217\026\375!\2413Oi\"{\025\245\b\212\227m\027\317sY\263\220\330\036\206\246mo\300 \022\372!\0279\211\350&?y\312U\316\362\226\277\034\346\247\243\236\372\314k\260\337\2042\236\352:6\026|\033\007\245i\320gG\206A\237\030\243\240O"
+	.string	"\227\221>s\005\323g\205\302Y\007\372\f\370U\225py\3021\320\021\316*\320\247\300\257\352\351\203p\020(\216\217\234\2563\335\343\251a\231:\372\364\203}\202\023"
+	.string	"\317\036\304\211a\004\026\003\374\201L"
+	.ascii	"\256 c\200?\220\t\300\025d\f\360\3073;\237\033q\332gs\033O\353"
+	.ascii	"\002\324&\003\200\003"
+	.text
+	.section	.gnu.lto_rxFailsafeModesTable.207.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375 [-\002"
+	.string	"D\003N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\002\005\001\006\025\177\001\001\003\005\001?\202\210\200\030}3\276\0014\275\001\274\001\273"
+	.string	"\300?\202\210\200\020{3\301\0014\277\001"
+	.string	"\006"
+	.ascii	"\200\b(\327\316\t\340\\J\353\030(\002"
+	.text
+	.section	.gnu.lto_sensorTypeNames.208.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"e\007"
+	.string	"T\f\331"
+	.string	""
+	.string	""
+	.string	"T"
+	.string	"\005\001\006\177\001\025\001\007\005\001'\002\206\b}\005\001\212\001\206\200\200\374\233\336\320\333\n{\275\006\005\001'-\206\by\bw\300\005\005\001'2\206\bus\303\004\005\001'?\306\003\005\001'D\206\bqo\311\002\005\001'J\314'O\316\001"
+	.string	"?\202\210\200\300\001m3\317\0014\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\001\274\001\273\001"
+	.string	"\bGPS+MAG"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\004GPS"
+	.string	"\fRANGEFINDER"
+	.string	"\004\005BARO"
+	.string	"\004ACC"
+	.string	"\005GYRO"
+	.string	"\020"
+	.string	"\270\212nv\201y\212\033\260\004\340\032d\f\b\203\214U\305\037\310\r\220\3103;\220cA%N\261o"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_sensorHardwareNames.209.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375 \233\375\003"
+	.string	"\264\006l"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\206\200\200\374\342\203\344\365\031\001\177}"
+	.string	"\005\001\006\025\001\004\350\317\001\177{\003\2507\177y\002\037\177w"
+	.string	"\002\177u"
+	.string	"?\202\210\200(s3\302\0014\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli/cli.c"
+	.string	"\007"
+	.ascii	"T\021\002\344\326\034\004\362\2659t\235\271\r\240\b"
+	.text
+	.section	.gnu.lto_mcuTypeNames.210.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\200\001\025\r"
+	.string	"&\226VD\360T\234\016\300\352~\3571~\357\245\022\017^\004\351@\213\006\236$C30i\361\254C\345I~\274s\362\2775\230\001\\\354g>e\367\320\303\231\313\362\322\177\227o\375X3\337\213K\\\203\217\261\032\f\224dB"
+	.string	"@"
+	.string	"F"
+	.string	"w)-L\1773\203\376\245\2762\262\302\36490:\374\245\374\220\221\016\246O\240\005\35405\301\364;*`\207)E\323/`\217\306_\237\200mPRbbM\306\221\364\b\037DFf\246\277\261]\237\004\033\256R[\031i\0233\t\275JY\247\237A\241_\251%\246\017\240\b\375JIb\372\001Jz\226JN\377@\350Y<N_\323\203\276\245z\230\276"
+	.ascii	"\035\364-\245k\342\240w\251\341\364\007\330\240\001\233K\024"
+	.ascii	"Y\033g5\t \016*\323\201O\347\221J\2355\n\247\360\n\263\260\013"
+	.ascii	"\277p\f\3130\r\327\360\r\2378\307\347\035\346a\037\376\341 \026"
+	.ascii	"\342!&b#>b$N\261\022\317L:\3211\243\210\020\b\326K\002kz\020"
+	.ascii	"A\001\203S\203\005\0206\333q!\360\333q\035\370Eq\241\220\347"
+	.ascii	"\201_\221\350\033y\337\210\004~\271\217T\372j\341K\f/\204\247"
+	.ascii	"\217\201\325&h\250\024h\205!\265\205+\n\031\266\024\253\265\201"
+	.ascii	"<+jP\261\002% `\203T5\006Q\214z\325\256h<\026\243F\"8<\tc\374"
+	.ascii	"\260G/!\373\232\227\037\363\362c\236\363\373\3465g\335\224\254"
+	.ascii	"om\262v,\266\372\326\263\336Z\326\231\313z\346Yck\267\254\025"
+	.ascii	"\366\033n\021"
+	.text
+	.section	.gnu.lto_configurationStates.211.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375 \256\315\004"
+	.string	"d\bT"
+	.string	""
+	.string	""
+	.string	"N"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\370\336\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'0\206\b{\by\276'A\206\bwu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\013CONFIGURED"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\020CUSTOM DEFAULTS"
+	.string	"\rUN\006"
+	.string	"\211`\215w\001\332$\3153\214\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_cliWriterFlushInternal.212.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"-\t"
+	.string	"\246\320>80s\322\001l\006\276\344aj\232\005j0pd\346\217\234bsw\224\n\2133.\213\026m\001\33381\235m\204\22048]\003\326\331\2746$\215\275&\254%{o\231R-"
+	.string	"-"
+	.string	"1"
+	.string	"\217P;\377\262\003\270\274\325\343\307a<\270\231\201\tx\255\210"
+	.string	"\022\322r\331u\303c\251\206\030v\327\352\362<ny\333\r\266\025l\313\004\266\257\366S\256\322=\246\372\300\356\013\307e\367[p\202\350\322\337I\332\245\350\004\332\245;[\347\037\311\206LJ4X|vw\302\221w\00114\263\026\\\251g\303\001\003\255\322\024\026\300PVrZ\372c\177+\205\"\366\343\356\256\341\313~\354Wi\300S\003\261\263\333\021\004\2643\371r2\n\234)u\342,4o\245S\3046'N\017\022s\343*f\211d\024\205\211\233)\024\212\233\243o\037\027\276\354\3203\313\200\254\030U\241}\201\241w9 \017"
+	.string	"\357b\314\304\023\277p]\0034\302\212F\265"
+	.ascii	"\004\016\rA\ba\025\314\273\004\320\254\246\210\273<U\223S4\265"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_cliPrintInternal.213.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"\035\n"
+	.string	"\206\322D>@\305(\035\2406\367y\335\002\353\316\035R\253\222*s\333\362\016\021\363\202\226\373\314\203\004w\034\332\361\221q\3316\244\362pY\247\252\350\230x\002\204\005\327\036\246\316\366=#\226l\"wJ\0012"
+	.string	"1"
+	.string	"4"
+	.string	"\235\212|\361\273\246\361\363\037\236"
+	.string	"\005\226\256q\035WM\003\322\0223"
+	.string	"O\032C\254$\344\341c\n4\305\210y\330]G\024\310q\313\333\206\260\315\261_\020.$\266\237\261\035'\306l\341\321~\312U\276\267H?\330U\275\\\273\263\301\n\334\245\3477\333%w\315v\351\317\036\360\311Z\314\b\212\006\213\201\335\r\027\361(K-9\260d\004TW>i\223\212`R`E\300)\312\354Y\212\272r\235\204\001\254*\373\363\337\336\372\345\347\255\\\202\307\213\004\200\335\215\331\201\205\311\236(\244\236G\364\361F\233;\234\317D\247\253\370DPt\035/\324q6\006Yx\274N\004\002y]f\356U\025\236{}\3002\324\244iqS\325\224-\343\246R\355Q\022"
+	.ascii	"\357b\310\204v\342p\b\036\022V\270\004\033B\265\r'\202\3138B"
+	.ascii	"\r\332\n\343\201j\340\n\230\033\240\242\214\273\034U\22340\265"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_cliWriterFlush.214.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375 \362m\006"
+	.string	"\002\214,2PO\323\001\240\363i\275\242hT\b\324D\032\002i\221*\247\031\216!\260\021B\217\205\2000\255 #)0SnL\275\\\003\236\243Yw\023\"eJ\001\206\322D\3017Q\360)L\007\t\017Z\fO\002p\265\200`\275\206\252\262^\324\355\2253"
+	.string	"\301h*\341'\257\266\303C>Z`B3\373\"\037\211\3609\fq\345\343\035\377z\356\\\013PX.\264\314\330]\226\232a\277Y\345\354\247\337\004|\234P*\273\025\231\226\3058&\036\266\037\031\263S\336m,\324QBA\262\262\273O5\216=1\377!\277\304-{B\004\273\353\214\233\305\255\037\260\215\021\t"
+	.ascii	"3\00178\203s|\241k8]\b\3762.\270tc\266\266\353\264"
+	.text
+	.section	.gnu.lto_cliPrint.215.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\265\007"
+	.string	"\322\31766Po\322\001 \033\273\325\373\314X\031\211\354\215\347\255\270\231\002D\333\275C\205\032A\314\356\310\222C'\233\261&\334L\272\252\032Yp\345\312C\355\254Y\332M\312\224\002X(S[\236O\203\005\035>\013 ha\031\364t|=0`0t]\030\344\304=f\265\263B\3514R\ngR\365jg\020y\316\003\025\272\331'y\211\204\337\341\bQ\236\373\363E\325\3375\001\365\2211\312\224\035\267T\r\373\230\335]kg\337\364k\246\377\004@Z@,\273\027\251\227==\025\017\216\355\247\375\220\213h7M\034`\267+\241\354\306\003\027h\376\034\337\251\3764\017\250\376\254\331\250G\216\375\311\212\205\211\313\356B\335\270\366\324\374\217|\303\221\266g\006aw\235\034\t\343\326\333&\260m`;%\t"
+	.ascii	"\357b\310\304\253\276h\217\013;`\324%\254f5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliPrintLinefeed.216.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375 \345U\006"
+	.string	"r\213+3PO\222\016 [n\325\331\367\371|\252<tI%\213b2\254W\2631bm\017!Q\342\347\023k\371\316\314\270*\354VrF\222:j\034z\315n\"S\017\020\340\223f\34309\316\206\341\301MU\204\323\030LA4TN\202\242*'aY\004\275\200\222] \306Q+HC&\nB\231\235>\212\200NB\246\321WX\264\276[\212I\226\201\327cWC\216/&\021\364xp\262\302\031\311\364\274\270d\026\225x\374\225\266\236\245X(K\242\242!\322\222\231\016;j\265Y\267\037\025x\237\253\r@!3o\357\263\321\261?\302\237\371=\001\t"
+	.ascii	"\357b\310\204\006\340q\200\013\3335\221,\004\3742\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_cliPrintLine.217.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"M\007"
+	.string	"b\31624Pm\323\001$\213\363+Z\t"
+	.string	"\024\210]m\b\025\215\304\312PF\251\361\217\035!\024\177sj\330 Y\306\314\"\262\303z\206\202;\007\235\305\333\377\335\266L)\025\310z\235:\036\205)~<\b\013q\252\254\330\331\224bH\250\"\210\242\252\250\341n\351O\353\001J\027\361B\275dk5pD\272\320\303*e\276\326\341!\2355AB:\211\207\265\034\226\317\242\265\364\377}Z\353\315N\3109\031\371\230\374\024+*\357\340G\206\246\255\263\265\2067.o\020\006\370\265\221\307\317\025t"
+	.string	"cX\316\033\213!\306\001\026\303^m\2119\214\273\203d\202#\345\177|\027\276\234W\355\2213\231\bs^\f\37673Q\205\373\334V\240-A\333-\n"
+	.string	"\357b\310\304\023\276hq\241\264\031\\\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliPrintHashLine.218.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"\222\01775`o\032\003\334@\b,i\231\024\362W\336\201\300\225;\303B\002\004S\217\261\207\202\016\t\263L\275\242\261"
+	.string	""
+	.string	"\tP\226\267\326~\003\274\034\210\266\333\312&eJ\001=\350\004\bDM\024\202\305>\240\007LF\200\032 $\246\205\344\207\323L\302A\223\242,\323\344f\336\231CS\031<T\031P\243\326\203\260\235X!Y\317\323&\024\003\247\177\344\256\342\032)$8\266\026\027\317]\237\312J\265\001\271vr\017~\264\316\374\177\241\2515\312\206\321\240\304\222\271\374\035+\230\253bJd\323\326\257\365\210I6\2430L\360\233RP\376\351)\302\345\330i\216\345x\271\300r\354\326\266x\236\256\t\211\3418y\371/!\2107\277\255v\211\001:\022\347\247Y\370\337\327\221J.t\333N[O\333T\013"
+	.ascii	"\357b\310\304\263\276hq\241\202i@\352\352\202!\227`\233\325\024"
+	.ascii	"p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_cliPutp.219.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"u\b"
+	.string	"F\321;5@\217\322\001[A\316\354//cj\354\335\013V\2324h\227\364\3040\370\242\375\313"
+	.string	"\254Q\t\250\"\374UQ\004\322\t\204\240|I\366guo\030i\204H\231R+"
+	.string	"+"
+	.string	"*"
+	.string	"\030\017\\\234\265kS\374@\256\2454H%\256\377[~\2703v\265I\fP2\211\214\032\303\377b\311\304\341\246\333\032\264Mh\333\n'\251\266\316\264Ml\025\026:\277\213\346\1772Y\375\337\024\301\330Z\304#\235UmY\340G\205\254\376\267\351\001\306Y\2375\027g\001NLg:\003\\+\244\226\021\276\332'\302\364h\215\375\177\023\325Zeg~v&\0261\2545\202\023\212\205\312\277\361b9+\013\020\034~\\\216\323\211\340\266\211\216\203\304\306\201B\033GS\317\347\001\264Qx<\240-\363n\354\211jC\007k\224\030\325\0203\3136T\201.\265 #E\r\n"
+	.string	"\357b\310\304\213\277h\300\005\002\346"
+	.ascii	"\346\032\373*\fVP\241\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_cliPrintfva.220.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\035\f"
+	.string	"\326\226RA"
+	.string	"s\233\016\270\007\350\n\372$\3607\220\020/\252Q\253bX){\204%\242\325\021u\262J\321l\303\217\221W\334N\003~b\320\342\252z\225\240"
+	.string	"-&X\220m\024\260\256\332\347\361\351\223\275\245L)@"
+	.string	">"
+	.string	"?"
+	.ascii	"\217\326\354"
+	.string	"\035\367L\354\005%\304\211\n\217\335\255\264\304\265CM\315\177\351\030\256\333\016=\\a\001\034,(\004t&\360\200\210\0211^zj\350D\231\227\006\273\353\344\272\016w\274m\007\266\031\330\177\020\361\244\037j\372\324\206d\003Dc\227C\313\217\375\342\f\024\333\317\330\316\364]\244`\320\261\300\367l\314\243\023<\355\2578\013\355\244\f\037\260;Z\221\261\353)0\002\352\321\3365\323#u\002S\033:w\265+|\362\234\001\260\244\370Nt\313\356\306\206\032j\320t\215P\312a\222>\354\253\034\006\310?a\013%y\256dz\274\352\207\225\036 B\331b{[*\t\373pw\327:\262\237\362\007\326\205\274BF>\006D2\213\"\261<\031&a\362\305\351L\270*\n\035\313S]\331\247\342h\214\215\204d\025\t\206eU\306\333\303\325\221!\264\370B*\202\001\322\026\351lT|\"\335\f\222Q\241\376\205\007\2436\025"
+	.ascii	"\357b\314\304\263\242p\034\006X\370\025E\350\002\242V\001\201"
+	.ascii	"C\204p\215\030\b&Xq\215]\206!\3014p\305\251\2711\003\005\250"
+	.ascii	"(\342.O\325\344\024M\355\001"
+	.text
+	.section	.gnu.lto_cliDumpPrintLinef.221.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\321\001\265\021"
+	.string	"v\242yH\340\360&\035\330\210\343w\203\035\241\025\255\315\353\261\204o\233~\220\017\310d\26059RZF\307q\307\205\353\337\272*\234\303\207o\323\347\350\232*\\!\036P\262\035*N\0272RT\002\321\200\372F\243Q2\b\331[\246\024c"
+	.string	"`"
+	.string	"g"
+	.ascii	"7\361\272O\006\003\330\305q1\264;\226x\300\367N\344 \336\273"
+	.ascii	"\371\017\357\235m\0278\3602\354c\210\232\215\032\0212\265\334"
+	.ascii	"\356\bJ\020\207\275\233Ra>\207\030{\327\341\363$\306L\221\335"
+	.ascii	"\355\020g*\247\201\230\234\207\016Q6\0030\311\274x\355J#\316"
+	.ascii	"T7Nv\327:#r\270\275\333v`\033\305V\2222\307>\320\377}\374\273"
+	.ascii	"\373\374\323j\365\324G]i(G\003\003\321nMS\r\030\243\216\005\317"
+	.ascii	"\205n\037\205\177\363\311\267=\350u"
+	.string	"!\327W\203\r\003\236\035\334\256\r\311;+\370\336}\f\271\375\262O\266\347\317i\257\003]\b\361\330\031mg\b\301\370I\375\b\013\271RPOQ\311\367\316\252\366{\002a*L\312-\341f2f\224\"}\322\236\240\242J2\342P\222?\305o+\001\033v\36736\253E?\343\337\376\035%\025-\341bd\314:\002\351\2038a^'Sh2f\312t\217\261\313\033\236\023GR\352x\304\273\214@\2131S&{|\304\233\362\362\265\023 jA\203a\273\221i\223=\306T\352\330\237\273\273\016\241\005}\tW-V\212\367\262\342\nST(.+\241\253E\205\242\340\0226`Y\271$|N\231\250\254\244\300\n*\341\nL\265\\@\023\020\263XT-\360\205\305j\201\247q?W\346\370\265\203%l6y\025\377\355\013f\220\260\255\230?\314SIc[\245O`\244\354\235k\356\342$\300\375h\223?\324~"
+	.string	"Ai\227p2\031\263\207\006\037"
+	.ascii	"\3571\270\026/,\013zm%nv\005c\315\017\321\242\"\b&\2129@fTC\242"
+	.ascii	"\226+RH\200\205\004-\230|\030\204]f\353B\212\213\f'\362h\357"
+	.ascii	"\bK\201\234R\301\340\n#\006\027\341\016\002\332L\020\304\273"
+	.ascii	"\252\\\357*{"
+	.text
+	.section	.gnu.lto_cliWrite.222.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\325\t"
+	.string	"\206\322C;0%i8N\260\347\017\271<\372\001^\305U\204\232q\223\242@H\253\250\362\275{\353\316hF\210\275q\024\220\367N@\334!3\202\300\214la\025\247\270\241V\224*\261{K\231R1"
+	.string	"3"
+	.string	"2"
+	.string	"\273\236\252\034<\247\t\372\237} \024U\347F\256\234\201\316M\013\201\330\342\022LPd>{~\210\254\314\217\303\356:CQ\344\356n\373\301\366\202\375\007\231NM\377s\360\302\341\210\331\r\271\331\266\326\321\304l?d;\323\0365\200\227uXwO\\fvG\006+\200\336\031\264\003|\\\331O\214\346\202\021\260\001\256\002)\346\200\330\250S\236\253\304\013\200V\022\260O\373\230\362Y\274\201\312\207\357|\224\347\335UIv\006\274Vy\263GUj\212}n\025f_\366w\001\024_\372\023\221*>\357\202\024a\341}\246\223'*p\tc\302\344i\224J&/4\356\271U\230!Jj+eq\240L\275\332\031\247|h\004\017U\271\323\324\221\255&\017"
+	.ascii	"\357b\314\304;\240p\t\006(\343\025H\325\034|\r\261\027\324\260"
+	.ascii	"\240\013yK\306>\225\032'\356\334T\355L\321\024\024"
+	.text
+	.section	.gnu.lto_cliDefaultPrintLinef.223.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\356\001}\022"
+	.string	"\346c\177I\300\322Q:\250\0020\267vA\r\0023\270\320\301\270\301oX\303\314*\310\343\r\003\234\"T\316V\021\004\212\376\321\337ri\307\321\027e\225\321\342\331\266\257\303\fm\326\303\024rc\234\263h`*\262\034L\177}M\310\3362\245l"
+	.string	"d"
+	.string	"m"
+	.ascii	"A_1\273\220\006\253j\355\271\201T\353\270b\002\251\177'o\201"
+	.ascii	"\377\350K\300\177\266m\340\300\314\264\217&r\"9\030\035vP\265"
+	.ascii	"\216\341,q\332?:\227\346\003\320\325\376\2018\245)d\222\217\225"
+	.ascii	".\207\266r'p,\335m'm-\221pb\351rh\212\b\033\037\276\373\352\350"
+	.ascii	"l\273\"-\265V/N\347\341\006o\033\202m\027{\031\004\237eY\226"
+	.ascii	"\236>\366\213~\325\307\377\273\320O\275^p}\326\207\214P<6\224"
+	.ascii	"\265\346J!8J\237\f\240\037\335~\013\277\347\225\317\273\321\354"
+	.ascii	"G\262W\016<\r\200j\220\265\362\250\374\263\202\324\277\217&\267"
+	.ascii	"g\366\3126\035:\321\354E\031LH\352\215\b\b\t\301\230\232\373"
+	.ascii	"\221f\362\037J"
+	.string	"A4VR\377\274k?\022&0E\221$\313\244\232\266\350z\005A\032Y\225\337\305{\026\004\354\324Z\217\263ab\304 FQd\316\254Y\265\003\356\031\240\r\253\331\343\374\336\277\223#\205\322m\326\354'\0268t\320\371\343\323\300o.\212{\254}\223z,\215\230\363\307(\340'\005\242\246\333\002\361\311Q@:?\277{\001\025N\266\035\274\020\266-\355\261\266\363\307\016\"\206\275\021gb\260\027\360FF&\276\274\\ldDY\315k$\306Ft@3#\253\220\262\213\005F\306\025^\200\021gBW\314&di\031F\363\212\20570X,\\\215\365\264N\037\357\356\0366\361x\363/\376\336\027<1\361b\320\237\006\356\324\261\275\323-8\323vZk\255\237\214\326\332\223\200\034\332\322\001\326~\020\201\214\"m\263\346\222\r\" \200\202\031\301\365\237\030x\211\027\243x\265A\024\020\266\017\302d\347\300 \225\255"
+	.ascii	"\035\210m\2170\271\202\035\310\031\306m<a\234\316\b7E\036\361"
+	.ascii	"c\333@#\216\024\336\335|{\307\227\"\247\016\346\025\006\203\013"
+	.ascii	"\356 @3A\342\025\267\240Q"
+	.text
+	.section	.gnu.lto_cliPrintf.224.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"]\n"
+	.string	"F\023F=0\305*\035"
+	.string	"\336\237\200\315\255S5\344AG\230\332\365{(I\306\352\251\031r\307\204\224\034\215\b\362\204\331\026&\006F.wFD8M\322\fB8c\252\322\003t\037}n\264wJ\0010"
+	.string	"4"
+	.string	"4"
+	.string	"\323\364\035\3553s\002\355\323\236\035;=\331\267\304<Xd\273\273I\223{\217\236\177\3305\240\352{\304(\354\256#\250\n\271\345m#\330\376\330\017\005\013R\013\240\004\314"
+	.string	"\254\277~\373\207yc\323\253x\177\235\276\035\251\005\226,\334My>\355\311|\276\340\321~\353)\336]\030\347\354\256Z"
+	.string	"v\351\307\t\231\007\2375\321`\200\2246'\321\251#Z\364\374+\207Q\034|\200\266\305E<hN\025\231\205\034\362\263\351\027e\211\375\313\356\256\345\312\276\353\227\230W*#\220Q7\242\212h\022\225:\256A\363\bDz\030m\020$Qi\033u\023\033\250c.\202\241\333L\034\327m\033\272\277\254\\yV:\013QR\303\247\313.I(|\305\352\201Hr@\231\205\0332\023"
+	.ascii	"\357b\314\304\2131\\\340G\355\230`\203\304E\300\003\0326J\n\b"
+	.ascii	"\203\350\370U\023\230]S\320pp\247,\006C\344)*\340./\332I\006"
+	.text
+	.section	.gnu.lto_cliPrintLinef.225.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"\005\013"
+	.string	"6\324JA \3458\035 \013\213\005\021`\300\220\004:\260\343\377\3742&^"
+	.string	"2\b\224\007\006"
+	.string	"\351s\310\315\013C\215\025\2220\202\267?=\341Y\245$"
+	.string	",W\"L\326(\250\"\242$d\300\211I\354\336)\0053"
+	.string	"9"
+	.string	"9"
+	.string	"~\350\276\331\274\207\373\326]\201\373f\3216p\223\265\037P\033\001\200`w\275\352r\361T\364\377:\207,\307\323\202\210\3355%\313\224\273\336\266\203m\220}\211'\345I\004\354\252j\tP\262\215\300\313]\277-\372/wl\3634\342]'\204\235mw \246\344\334E\371|\363\247\373\366\205S\3732\237\021\337\372x\302\356\n\026\3335A\001\224T\001\243\235 u4\2072\024\250\325\0063\002\2240\034\375\3745\177m4\230\220v\207\007=i*R\262hgH\035ms\244\265\305\376fw\327ue\277\365\327nBE\025\"\016j\022\225B\220\202\363\027\"Y|\336\005IT\362\276P\303\013y\fb\214B\317\004\202\241\3271\367\233\255\253n\266\"C\325\224O\233]\026\210\323Ek>\240\3667\212\321\316T\035m\020\024"
+	.string	"\357b\314\3043|\264X;U3\353\213\220\035\220\370\b\356"
+	.ascii	"\301G]\001m\024E\017kl\263k\312\310D\004\204\f\206\310ST\300"
+	.ascii	"]^\264\223\f"
+	.text
+	.section	.gnu.lto_cliPrintErrorVa.226.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\272\002\345\023"
+	.string	"\346\243\201I\300\322Q:R\345\355\305l\033\240?-\300\320\034\206e\305\277WJW\020\030@\002\004\315\224\330\315u\366\217\032u\026V\203\003\375\241n\273\335\255+\2011\017\312\233\375\275\202\331n\200\330}\320+fz\"\233\021\2737\221R\246i"
+	.string	"c"
+	.string	"q"
+	.string	"\277\306P!\234\016uP\001\335>L6\272\177'G\020\252\374OI\246\312P\tL\225\307\375AJv-.p\341\3331\022\322\3350^\2418\235\022\344\305]U+#\275Q\324iB%k\344\201\256\356\336-HB\0314\320\243\351\005k\324\201\007P\250\240\241F\272 F\235]\325Jw\177{\343\b\275J\377\313\374w\371\027*3\024)\347\312\34246\253=\233\251R\231\307\242\037=B\276\334N\375?q\371\347W\260\273\373\354\363k\221jK\177\252,\035R]\201\373\311{\311{\220\367\314\373\345\275\026x\211\342\0211\352\007\245n\236)\"\355$q\264\370\257\253\377\273W\242\"\016%\001ZG\324\303\340*\343\037Qy\005\277\"\tt\003R\356\220\314\243\021P\217\020\311\266\370\237@\001"
+	.string	"\257\204\007)(\035\213\037\260-f\261\036U\260\020v\347\264\007\362/\233\355\350"
+	.ascii	"9\305\247$\225\203\006\023\362XLT\362\r\346\222$\246\025\257"
+	.ascii	"k\307b\322r\212/)h\265z\2445dN\200\272y\332\253\205\274\006&"
+	.ascii	"\277m\303j\357\212\364\004\303i\307\342\216O!\230\3709S\371\205"
+	.ascii	"\b\210n\207\374\032\177\275^\340]*|\227JK\254\245\305\301\353"
+	.ascii	"\365Z\311nvF\233\241q\301\334da\215\254v\263a\230\264\232,\302"
+	.ascii	"\205\332L\365\031JL\206\031LC\214\254\006\233\335h`($\267\315"
+	.ascii	"\320n\260\032\233\355\006[\375Z\331\347\301\211\024RP9\326\231"
+	.ascii	"\374\2438\323\007\313\215oIHTn\247\272[\2248s:)\017\034\b\261"
+	.ascii	"kl\252\234\234\342[\n\002\233$\270\204\274\230\211\0066 \360"
+	.ascii	"\002\0211\353/b\f\f\2551n\311\215p\254[e\016\023\332\3351g\350"
+	.ascii	"(c\357\022\033\306\260\315\276\224\333\311\002\214e\314\036\263"
+	.ascii	"\220\343\244\035q.B\310\354\346\205\033\3073\276\307\342\374"
+	.ascii	"Ig7\250\354\305J3\334\246\255\345\002\027XD\b\023\214\341\327"
+	.ascii	"\302u\234#\n\214c\360\207\271A\223,\226\317\r\030Q\204K\034\260"
+	.ascii	"\370r\353F\206\233R\324="
+	.text
+	.section	.gnu.lto_cliPrintError.227.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`j\001\035\017"
+	.string	"\326\333dE"
+	.string	"\263f8@(\235\257<\244\270YW \224\350\313\260\366j\346\330\230\026\035{\273\315\307\373q\264\271\f\324V\320$\353\017\240,\340&\357\240"
+	.string	"\365J\320\241\232Xl\376\200\354\257\232\216\320\237\205{\357\275\245L)N"
+	.string	"M"
+	.string	"S"
+	.ascii	"\273c\211\023t\327<>d\273\326\335\300v\315'{G$\265 J\213\346"
+	.ascii	"\303\213gw=]\361\3233\315\223\377\327\001\204\"\370\254\3045"
+	.ascii	"C\331!\242\020 \272d \022;8\376z\276\210-\231\334\203\335u\206"
+	.ascii	"\342\210[\273m\b\266\033\330\247\021\317vw\255,\373\343\317\335"
+	.ascii	"\365o\232NM\037\364\315\300\204\020\377\302c\027\346\307\007"
+	.ascii	"\245\243\345\264\370\315o\377/\203\374\232\333\234~\3032`kl\327"
+	.ascii	"\243\345\212\355\212 \271\346\005\335\265\213\214>\n\236\366"
+	.ascii	"i\376\342t\227\207\023\330e\341\310\b'\253\034\236\221\302\307"
+	.ascii	"\214j\214W\266+\005\033\035.\371\303>\214\307X\361Y\370\302("
+	.ascii	"\037\216\266k\327\223\325\r\027+T\376\030$Gd8\335\324&\225`'"
+	.ascii	"\266'\246R\320\\\222\374\260\277R\016\200\b\355\r\035\362\241"
+	.ascii	"Se\202\247'\226R\320\036\301\324\030;\006\t\240!\016\251\022"
+	.ascii	"\"\231J\0266\021)\024\241\002\351\343\374\231\2140|^\206Q\210"
+	.ascii	"\344}\246\024\317$\304%\r\"\223\247R*\231<\320\270\317VY\235"
+	.ascii	"\215\226\016J[\314\222\355\252p\020\253\311\237\254@\036\366"
+	.ascii	"\034\t%2\273\252\207\023:\025\203\021;\364!H)\210#J\r  \220\202"
+	.ascii	"\021\301\352\001\377bL\343\215\031\255>\247>\262\204\315\336"
+	.ascii	"R\035\2067\203X\224\034\227\365\317\017\237M\320\216\312p\254"
+	.ascii	"o\340\326\222%*r\027A\262\202\355lC_\226\255k\034C\016\3155X"
+	.ascii	"#\002.\212|y\322\344\024\315\357\001"
+	.text
+	.section	.gnu.lto_cliPrintErrorLinef.228.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"\005\r"
+	.string	"\246\230YD\020\221\232\016\b\342}\313"
+	.string	"y\344\005\t\354>\251\033\361\327/@\200\325=&\f\223\002\226M,'\246\266q$K\207y($d\333\016\003"
+	.string	"\212"
+	.string	"\233c\330\352U\003W\004\205\023\016\213\002\373mi\223-S\nC"
+	.string	"E"
+	.string	"F"
+	.string	"'\216\242\273\313\311AvA32\273\242\001\023\250>->\204\372\254\016\200\372tg\317\340\240\254\207\240\345\305\206\321\306\356Z\222\304\273k\347\177<\007\030zW\r\203\335\265\202a\210[\336\366"
+	.string	"\333\n\354\207\001\323\356\256%\310\276\370\317\273\374\223T\237\003\223I\371\020\336\003\214\335\224\322\215\217h\2660\361\230\337\376Gw\370/\207\351\036c\362\2611\266\252\32123\332\005!\362\351\003\325\3479\342\t\347c5\300p(p\265\037\035\033\363\350A\013x\212\253\300\340\227p\204L\017f\324\347\345F\205\006I\345\243%o\264\3032\345$mm\013\255\210H\243Oz\326\250\310\037\372H\022\240\003hW\270\240\007\255\337\212\013\322\bEz\266\350\251\034a?\336x\310\313\202\226\\\032\267A\240<\332\325\340\201\206i\214\215d\0220kBvi\026\306\221X#!\336(x8\253d\3338\253C\334O+A\256d\260\020}d\006\233L\273\"\026\214^\264d\020}\350+\034tXv\277\203W\365%\b\026"
+	.string	"\357b\310\304\323\274h\361\250HM\340\244!\257qj\334\330\002\r'%\\\321c\374\3066t\r4\230#\342\254\3038&\344"
+	.ascii	"\f\203a\001*4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_getMinMax.229.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\033\003%\023"
+	.string	"\246\340rF\320\224M:\257\n\354\330k\246z-\301HW\022\267\364\366L3LT\315K&\2268\353\206\236\031\2518\322d\205\300L\273\236\253\307\331v\256\2257\271\206\223\310\302\201\301\033\034\230\256\245\317\244k\246\304\356M\244L)]"
+	.string	"X"
+	.string	"_"
+	.ascii	"\366_\034\006\3543\232\017\330\335\3511\264Ks\361\001\356\320"
+	.ascii	"\264\253\304C\356\251xh\230\235\264\022b=\006>Fp\204\230\354"
+	.ascii	"n\247+\016;\3344a\276\201\017GL\346\035j\016\323\366\240?H\221"
+	.ascii	"c\024\223\235\270\332l\005v\027\200\354&\023\345`w\2351\031\211"
+	.ascii	";\3366\214\355\316V\021\001{\323\300\027\272\300\201\343\241"
+	.ascii	"\211\207W\b\337\222\237YM6\261i^\252\n\373\333\352\216\255\351"
+	.ascii	"\324\201~\001\247\375\001>\373S`\372$\2469\230F\305t\204i\270"
+	.ascii	"\2457\230\326-\235\232>\201\224#\036\331G\b\331\315i\322\264"
+	.ascii	"5H\324\302\366Ql \247\005Is\321\221\226g\261$\251\252\307y\252"
+	.ascii	"Q\235h\345\302\3022\317\201\201\005\211\365\241\f\207*H\251w"
+	.ascii	"\361)-\235\306W>j^:\345\356z\352\033NZQ\372\362,\261\206o\003"
+	.ascii	"\"\351\331\265?\303v\022\267\353\035\305\257\263>L=\253\263\t"
+	.ascii	"\016S\372\240+\320\271\311'"
+	.string	"\243\316\022\257)u\342|6n=\206\213\333 T-\235a\265\364\245\372\240^\275\2604\254\272\031\226\252\325\255^\035\272\027\025\2736\310\274:\017.\327\253C\241\355\267\325\035sEJ\324j\324\006\236pz\002\363\243!5n\t\025\023\025\025\341A$ \230p \024~D\275\211\357\351G\306[\210(m\320\302\246\260\302y\030\355\330\232~f\252~Q\214u\244\370.\212\207W\022I\250QT#\025BE\023\244\240 %i\306\320\002\221)\272\r\021 A\247L\025iR\2509O\374\344\373'\325pY\t\305\317]P\b9Q\035s\032\027\032\001\020\234y\005.]+Qg\307\245\033\003\231\037x\0028\243\020[\222\002 \202\006\307\017`\223_RA\327\020\326x&\221\234\241\323H\362\343\373HM|\330\374\356\354\016\b\326,D\236\2753\353\307<0\343\362C;\336\367HE\322:HH\262ECS\224\033"
+	.ascii	"W\007R\b\020\223\204\315a\331\211\213\n"
+	.text
+	.section	.gnu.lto_printValuePointer.230.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\275\024\275Z"
+	.string	"Z\225\024!N0\220\322\351Z/\021a\026\207\322#\323\343\317\363;\256\341\271\243A\210\335\273~\245-\363\363+\341 \212cb\247\271\302\026\031\005\301\f\003\372y\236\017\017P\252\262\262X\307\303\324\250+\027\350\324\211\321\f\275Dq4\276\230\tY\331RJ)\373\001\316\001\b\002\316\304\241\363\320:\253\252\263%:\013\207\316\257:\273\352\334TAg\254\276\274\220\026\302\367\271] \2039\\\251\305K\322v\335w\335s\335TZ\310\334\314]\307m\245\361\270x\307y\302\033\307BM\310\331\275\317\027\304\266v\234\267\274r\273\\E2\263\351\332\r\367>\023\240\343b\333\271\017\316\244\351\261 \266en8n9.N\351\270\265\251p^\337\256\333 \224\245\215"
+	.ascii	"x\357]j\313*\210m\227B/2\263uf\022Ok\277\220A\273)\207\304\255"
+	.ascii	"\351\235\370(\\&\311"
+	.string	"\bw\343\340g\347^\275\215\300\324\316\334k\315\266v\233\007}\274\227\310\236\225{\335D\360\021\261-\2735RmK\354\036\265-\257\314\177?X\267i\"m+K\312\r\367^\247_\201{\260\205n\315F_\033D\022\022\363\310\250\210h9\244L\n}\b\002\372\361\320\001\351\323\303s\334\321\311\3011\026ol\210C\325\n_\311W\356\241\224\224.\202\236\261\352\223\343j6\210$\244\272f\322\325\371\221QQ\0259'Z\332\321\305\371\220r(\225\024b[\363\017O\332<\310\256\201\\\300s\342?z\355A/\211w\340{\"\021.\321\236v\216lB\307\202\373\314Q\201rD\317\366\254\341\021<\376\355\370)\321\241k\342\231\264.f\306\272\214tN\021\2632\024z\354\031\246\336\344\025\311c\242\261\247\021\025G8\304\002\202\244\371\236zB\001\004\001\361Z\256}\213\313\312\215*t\t\351\"\321X\027X\337\bC"
+	.ascii	"\336\331\320|O0!\022\b\022\255F{B\335&\216\370d\210D-a\246\304"
+	.ascii	"\266\\'@\366%]\013\034\353\372ja\217=\275\262\234X\2521L\032"
+	.ascii	"\364\206\353\312~\377\020\322J\302\020a[Hh\276\347\020!2\006"
+	.ascii	"\262\031ZJ\023\241=\265\270\017\245\356\275\354Z\\]\315!\232"
+	.ascii	"\371\233\230\331\004\346#\231\275\363\307\235W\276\201e\371b"
+	.ascii	"f\250sC\316\353\240\241Z\241L\240\266\3151~\324\343x\363\236"
+	.ascii	"Z|\343\267\023\255\370\312/\3202\322,\352\r\r6\177SFG\212\034"
+	.ascii	"j[\233\341G=q\370J2\350\024.\335\3230l\226\225\256~Wi2S\311\351"
+	.ascii	"\275\316\326:\200\350\224\221\324B"
+	.string	"\001o-^b}\223\355\253\357tYk~\264\237\017\027\334;\324\266\366{\013\372\037\365\302o\347\022+\037\344\247\377W\276}y\311Z\323{-\301\231\264\351jx\217k\211\230\360\243}\334S!\233\f\334`\276I\f\334|n\244\013\267\227\266agW\354*ma\346?\342\275\315\016\353\026\273i^g\367^\245\266-\236\2109}\r\017;\251\372\267\320\342\337r-\004\374\232\022\370S\262`=\377\243\334-@\231`\027%\267N\252(\276\2454\221\357M\314\225\013rK;\251\366\243x\366,/+\206\321y1\210\367^AqcY\257\030 \036\341@m\333\377wsK\302\330\332~\370 \263[\323?\312\334\035\305\233\n\362\023a\236\321m\3352\372\205n\027\252s\013\325y\212\305\n\025=\327\234\242\347\232\245:Jw\224\352\214\242\335\272O \235\003\350\271f\250\246\322\374\324\316&|\234KXg\022\326\031"
+	.string	"\353<Buvj\347\246\036g\021Eg\246\242\363R\217s\b\353\254\244:\203\340qN\262\316H\326\231yt>::\033\035\235\213t\234\211p\234\2277\316C\252\263\322:'Ug!\353\374\301:\007\251\316@G\347\237\035g\017E\347\016Eg\244u\366\321q\356\311q\346):\037\213\316;\326Y\007\3079\307\350\214St6\026\235\213\326\371\346\306\331\306&\317\274\202\255C\032\257y\342\374\330\244\316o\3460\361\"\3739b\262\24204M\201\350\204\300\247~iR\254o\366\220f\013\036>\312\031\250.\236"
+	.ascii	"\021Th\326\360\305\357\312\005\367\300\020\351\360Q>z\243o42"
+	.ascii	"O[\243Oh\"\216\276\261@\2478iS\272\321w\235\237A\275\321\337"
+	.ascii	"\220\225\225\311Z3d\"G\005\331So\233X\322\336\3048Y\033\341\356"
+	.ascii	"\316\002\001\221\177|3\370|\224U(p<R\257Bq\036S\274\312\006\267"
+	.ascii	"\243\342U6\247\316\212G\302=\251\313a\361\030\244\351e\331\341"
+	.ascii	",5\324o\035ag\341\252\325\231\261\027\221\336\260\326D\005\366"
+	.ascii	"\025\226Xo\304m\255\t\021\366 j[c\256u/\2127\302\335\211\005"
+	.ascii	"\002:\220nW\363\325S\364R\353]\237\024\365A\323\360\020}\212"
+	.ascii	"w.\353]\331\210\276H\206\202\227\227\343\362U\274sY\357\ne\331"
+	.ascii	"gB\226\235\241_Qf\275)\206\276H\0266\205\204\356\270>(:\317\342"
+	.ascii	"\235\313z]\020\225_$\033\322\267\005u\256\236\240\005\036!+h"
+	.ascii	"\311q0\356)\016_\334`\312\234\300\3157\306K\360\342]\354Ax\317"
+	.ascii	"\237L,\273\317\3536\365M\327\307\270>5i\226\257\341\206\241\373"
+	.ascii	"\247\310\230\375\t\301\371(\353h\025g\274-\242\264\324O\277\225"
+	.ascii	"\374\376\023\372\344\b1\234DX\325\230B8\022z'\263\266\037>\330"
+	.ascii	"\302{\3575\366\323\317x\245\225W\032/2yWq\255\325,Y\266\032!"
+	.ascii	":g$\261\260&\361\270\276/\351\3257\333\204$6|\335"
+	.string	"|\224\237\376\303\367\330[\227\246\016\372\017o\3218\303\200>\350[\211g\305H*\3435\315\235\253\332Q\331\312\304\261V'm\205\312\200\276\205|\201\021\263\371\371\256\342V\017\260\337\005\326'\021\250m\177\336\351:|\324{\020\"\277\003\362\225_\300\006\303\340@\364Q\323\363>\2023V\266\032j\333\236\343G=O\327\020L\305\\\236X^\300\\\016p@\013\003^\300X\261d1\325\300\002\016\310\220\001cE\020\213p\276\200\371l\200\0010\204\374\002\306\222\212\271\034r\017\346r\304Re&\347\036\314g*\346\353\270\221\3435\240\221\343\355\215\306\201\243\207\004B\03660\320qc\307\0026z\340\240\341\303\310\203\206\217\267\221\203\306\013\252\0345\206\\\243\351\006\216\032N:n\320\310\341T\203\307\005NMH\336a\201\r\036N\030\354\330\301\303\251x\373\211H\351\376`\314\235\364\307[\261\247\320,\325t5bB"
+	.string	"\361\302\241\336\004`\025\030\244\262>\242\263\203\244\2662\236\271JL\325\030\002\304\262\276I\306\311T\2511\361\252\027\364/\260\r\001g\2562SUC\005M\244VI/$_I\037\345\207\201\311\356\267\232\265\224\351\006Im\037\206\243\250\017\340\267\002\230Ny\350!D\372\2503\273\n\215Z\342}\274\371\271\f\353\255B\343\201\332\266\304+\277\034\031\334\202\032\351\216\0333Dz\304W\225&Y\025HtZp\202Q\327\271\027\034c\202\334\244Q\322B\321R\223\360cj"
+	.string	"\236\304w\226\327\210\207z"
+	.ascii	"\336\351\234k\234~\3047\016\276%\006\323t\357\310\351\033\r*"
+	.ascii	"\203\223\2626\302e\001\f\004$j\372+\275\225H\225\232\265\251"
+	.ascii	"\266mb\372\020/\202\270\364LP\277\364@`\252\006=om6\334\024\313"
+	.ascii	"\212\225Tv%\304\253P(\027'm?\226J ^\311\312\357b4\\\331\231["
+	.ascii	"Y\261\220\246\367^\tP\347"
+	.string	"vk\226\220W\020\264\332r\257[j[\020\337pf\"\370\334\n\244"
+	.ascii	".\257\262\00611\225c\232&}\003B\267\004\266E\333\317\214tH\351"
+	.ascii	"ji\322$\3223\243\254%\234@tRi\221:\275\320\314\204>\352K\272"
+	.ascii	"H\fO\027\006\204\017H\357H\336\266\3305\3227\211\361\n\262\273"
+	.ascii	"cQ\200Q|p\b6\327\005\004\365\314\273f\276\006P,\201^P\337W\234"
+	.ascii	"\215\002+%\274\257\264\225\276\322x\214E\353D\201\235\250q<\343"
+	.ascii	"\030cdFDD$I\222\264\006\241\005\304\030\306\030\263;\022\300"
+	.ascii	"SA\211\244\314\231!\222\202\224\324\250\323\001\347'\345}R?g"
+	.ascii	"wW\227\344n?\263/^I\325\271\2242\341\006t\\&\344\006\334#\327"
+	.ascii	"\244B@\275\247\257-\351\373\333T\002\361\031\337\254iX\214\246"
+	.ascii	" /\362\336\256\353\225\321\371\271My.\231\323]^(\034(\333\336"
+	.ascii	"\352\310\256\001\326ogA\364n\210\305\325c\233y\352\361\200\313"
+	.ascii	"\266W\202\031!\220*\216\371\355\016q\373\336\007\n\224\301\305"
+	.ascii	"\030\346P\215r\204\327\003\"\207\272si\254r\337\261\255b\354"
+	.ascii	"\207W(\331\363\245\341"
+	.string	"\372v\302{\223W\020\350u\325\254\210\326B\030o9\243\217\214\270\254\033+\221\363is\274h\366'\330z\274Tu(+lR\224Ep%\372\317I\232\025\323\3322c\370\311t\232Z\234\017\317zN\226-\016\256{\213k~\206\337\037\305\233\272#\301\213s/T+\204?\\\004\275w-oo\346\036G&\224>uVL\336\367\203\213<\006\224X\273o\322#I\360\317\257d\271\226\017\026\370\351OB\312\206\250\344\200<I<\037\215:\241\024\335\345wS,\033t\211\"\323\023\351\254\267\232\273\200\306'\224t\001\275\333o\3472\276]_\325\016\016\306/\351\017\240\035\311\354rI\324\255\237_\277\335L\205G\255 ;\002\364\367\277\200~\202\362\210G\212\370\035\221\030\264\255F!1\270\302\017pN\032\232\323\254\225A\b\016\204~\343&\t\376o\241\361'+>\232\322\242\b$:\246\303\323P\261\"\327c\225"
+	.string	"4?\363\264#{h\334\252\013\254\357\021\375\221q\366\370\213R'U\254\246\023eg\310\271i\314W"
+	.ascii	"\3076\215|7\321#\031\224\221\221\344\242\r\321\305\310\310\333"
+	.ascii	"\270\327\244\240\225\374\310\023\216\032Z|\006\3623\217<\236"
+	.ascii	"7f\372\005\246\2206\032\177\372\253\021\242I\203\275\\\307\034"
+	.ascii	"\032\005`\347$\243P\026\366W\035c\343SPS\\\305Y\302\211\262\254"
+	.ascii	"`\332\354\373\f\215\006\256\030J\017\220!@\r&H\023\213\213\250"
+	.ascii	"\273\317\251\264wb~\226K%\230\320\316\020\355\301\340\311#\203"
+	.ascii	"'<\236\031\007x\233'\320\020Y\361\337\277\332y\374*\241YJC\332"
+	.ascii	"\223\334p\235\206\220~R\212|f\220\001\312\216T\321z\027aR\377"
+	.ascii	"j\210\250\216)\275\030\224Q\\x\242_-\022\213\003`\240\204\017"
+	.ascii	"\212q\221\017q\n(d\204\005\310\237@\230\2061N\325\345\3105\313"
+	.ascii	"P|\035\267}g\312A`Yp6\270\3029\274,\024R\213\001D\321i+v\257"
+	.ascii	"\213i\222\321*\264\232\0060N:G5\273>^\232\331\022\351\241I\304"
+	.ascii	"ns\016\375\202\034^,\026\220\242\305\205\022\016\276\205\350"
+	.ascii	"\276>E\251\322.(*q\006$^\026+\334|0\341\024B\341\233=\333\221"
+	.ascii	"\225\271A9*^\272[I\330j"
+	.text
+	.section	.gnu.lto_valuePtrEqualsDefault.231.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`I\f\2359"
+	.string	"\272d"
+	.string	"\026BP\244N\007m^t\200$\322\302\357\215\350\257!\022\212\362\0326\213\360\264`9A\200EZJ+\021^Q\324K0\252\202\210R"
+	.ascii	"\020\221\351\372\231O>\373\002[D\3142\253\213\232\320&r\357\224"
+	.ascii	"R\nY\001-\001I\001a\351\365q\037\016\034\037\335\224{\241\033"
+	.ascii	"\3568\257/\332\355\033q\346\372\374\356\275\021\326V\265\364"
+	.ascii	"\026\260\346B\303\211\fz\317\206vp\201tS\255\362\203\265U\247"
+	.ascii	"4\013\034\363\241\254'I\350\222\331\351\210rgn\272\276\002\326"
+	.ascii	"u5:yo\033\036"
+	.string	"2\367B\017\360\200\265U\206\266\221mum\"\333\252\202\006`\034\226T&\366\207`\356\216sK\340\275\320\252?\302\035\355\024\332\274\364\260nZ2)\227\224\222\220\216\214\212\210\206\222BAH\240\243\261H\\\207VM\337\303\270\207Yx\255a\254\212\236\034gb\335\224\016\313v\300\365\233g]j5\350g\246\3058}i\004\355J3!QZ\351\245*V\\\251\n\025OZC\212\353#\27087\202c\342E@\210\224\364P\022%\236L\202\304\205R);\234\004\ri\244\334s\210\003\255\t\361\343\312G\212\331\037\033\032]\033\371\211\r\rH\027\345\236@\234\370\346\251\226:=\311=\177\370:e\311[\220f{\372\260\305\274$y\374\304\366\244\263\303a\326\275\267\305\264\210\271\350\037\033\332\225\266i\2556\313<\355\321\237\032XS\323\003yF\226\032\271)\202\247\361\332\315\316\306\334\207Y\367^\366\034gh\315"
+	.string	"\232\331W03\b\346b3j\205T\210x\224\025>\264\227\226\3017^\257o\354\352\220\371 \367^/m?\203gw\372\030c\022]\246\304z/\231\003n2aO\023\353\222V\271k\330V\373\257\324\b\005\353lx\224\031*\346\357\306\334Vo\203\204\374m\314\026*dQ\230 !Bg\351\306jh\367\025\004\253\256\353~\240:7P\235\031X\347\005\326Y\201uN`\235\021X\347\252\016\323L\325\\\232\017\364]3s\252\2774\033 :K\021\235\243\210\316\005\222\316\004\210\316PI\347\001Gg\001G\347"
+	.string	"B\316OA\316NB\316"
+	.string	"\202\234\233\216\316\313\2433\023\321YIt^B:+!\235\223\200\234\221\220\316G@\316FG\347\242\2433\221\321y\250\350\2344:\013\025\235\203\206\316H\2423\020\321\371\250:\033U\347\342\352LT\235\327\325y8t\266\326Y\265\316\251\352\374\252\263\253\316}A\2517\006G\313\034\236\247\003\275;\242\204wO5\023\327a\272\271t\337u\177\351\224\271\231\033\f\267\0306\206\341\274\270@\272\300\017k\253\315\f\306\335\245\2754\036\033\271\277\004\032\206\260>\371Jr"
+	.ascii	"Shha[\025B\376\325\007!_-\004z7=m\005N\367]\037\220\343\273\261"
+	.ascii	"\027\247z\210\206\310\354\252\252\257\360.\307\032\337-\265\032"
+	.ascii	"\364+S\3746\032\026\350\273\317\201?>\320\267\323\207\361\217"
+	.ascii	"\337\316?\305_\337\370\303<\3164\256\"\326\023_\271\245\t\245"
+	.ascii	"\377`lX\271\273l\253\353\267\231\232\r\217\262\375\253\037~7"
+	.ascii	"\241P\275}\033\246\241\b\361\314\210\035f\247~XF\215\022;;/\320"
+	.ascii	"\366\304\274\220\361\004\323\322\326w\343\316\303\335\227\016"
+	.ascii	"\261\303}\347\203\320\341\346\363\037q\270\345\264\216&\227\210"
+	.ascii	"\033\3567\334\267\336+\326k\334K\013F\344J\301\321\344\336+\325"
+	.ascii	"m\230\271\257{\215\373\326\267\373\274\320+\325j\203o1\235\274"
+	.ascii	"\353;\333s\372\037\0366\370.zeg\303wc\333\346\214\n\341\355\232"
+	.ascii	">iP4\032\215v\224=\360fl\325\207\360\r\230>\263\325\367\274&"
+	.ascii	"\341\230G\371?\375\346\320iJ\fxC\303\364\366\337O\265?"
+	.string	"\202\352\2731R\263\r\334[\375\221\313\232>g6\363\315\366^LoO\352o\365\016\350\374c\243C\353\225`\362\261\207>\003\002\212/D\347\215hu\311\347\337r\001,\372\213KF\214-/\373\365BF\327\205\257\027[.\266\270\266\216-bh\271H\277\270dh\255\330\302\340\365\005\243\350\365\005\343\275\264f<\253\240b\301\245\242\352\005\013-\027U*\274bTQ\031q\027\214-\257\252\257\256.\257*\343\365\353t9\365\021\"$\367\372\322\354\331\3701\277\246wcc\016&\013\0378\027u\216\261SM\365f\2342\031\2103\227\3079\306\266\031\3253_\375\323\213\332\261!\363\301N\357\275w\t\330TJx\273\347\f\322\204\267{\214\020Qx\3737'(\253\323\232\177p\306\n\317\351p\352\r0\233\352-\374\321X\\\264\271\306\246\333\013\275\214iI\211\331\013\026\274\004\345\222T\324K\025x\250\217\222\243Q"
+	.string	"\353\t\370\r\213B\003\205m\025J\300_\375\2004\300\013\b\240\264\246\b\036,IGF\314V\240\340' \035=="
+	.ascii	"\302\260\272\013OX\357\364J\200\204\026.h\331V\001,\377\352\233"
+	.ascii	"\332O3\375\222\351\355\026#?u\250\024\r%\231\235 \301S \032\372"
+	.ascii	"\266=\255\\z\245\322/%\375\321+\375\020"
+	.string	"P\360C\206$\254Gze\236\240\210\f[\266\325\243\242\277z#oNc\211\276\350\273)G\3646/yg\316\023!$\020\263\021 \370\254\240wK)\220y\231\202\3746\036z\241\023\001\200\370\250QD#\031S##\"A$I\2224\006\360\002\021\031\252\315\001\021 %cZ\325\202\246\320\030/`\357\214\030S G\251\025\253K\365I%\373\365R\217\336\262\370#o\243\342.w\242|2O\344\323oC\324:\254#\234P \212\357\301sM\201{\177\353\3662\026\312\357a.\256N\366k\021\264\224\217\361\363\253\234T\200+w\025Hz7\b\375\272\272\377\222x\bF*\3206\357\223\246\203\222\264\006Ve\355\255\177`\232\213\332.\031\007\375\2228e(\315v\212^R\320UpJ\324\300L\001\313\212\226%\336\254\372\256\342c\377\231\313\366_\242\373\301\276\377\277;\374\313\365\177\200rx\305.c\006S"
+	.string	"\2178Q\270\321^\312\222\370\026\345\300]w\245F\fAD{k\267\311\302\020\272\33108;Ld\227r\032\266\306\336\253\306\337\254\261\367S-\236W\0246\374\005B0\306\n\b\301%Au<\365\254\347\205f\346h\3063\352\201\316\307\237\260\311\265<#\307\301"
+	.string	"}\0037x\017\361\r\200\363\343\256\022"
+	.ascii	"#\264W\336\372p\314\331\332\371\003\247u\020d\272]\322i\004S"
+	.ascii	"\323\2676eP \307\230jm1\017\365\212|\275\327m\023\024S\327\343"
+	.ascii	"\252\230\241\024sW\332\240\2544\007[[\264\301J&\202Eh\004\034"
+	.ascii	"\377\r\t\242\330&\377\237_\353\233\244\262B\013\314\007\205$"
+	.ascii	"?\214\225\244!E\222\336\031\310\312\204K\221\321\221\310\302"
+	.ascii	"d@6\002\016\301\332\t\252\236^\001\334s=\350 \225\231S2\222&"
+	.ascii	"\3126\214\251\272\242\350M1\217\032"
+	.text
+	.section	.gnu.lto_cliPrintSectionHeading.232.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`e\001\315\017"
+	.string	"6\035lH\340\320(\035r\021\243,q#^\240\\\225?[\025OmF\275\017\202}a\307\361Ds\217\f\020Q\347\232\337\216\277\317\341\324^\275K\260f\350K\230\207\032\344i\bR\030\313\324\344x\225\325\355\235\241\031\310\330{o\231RY"
+	.string	"X"
+	.string	"S"
+	.string	"\341\347\360$\364\323{"
+	.ascii	"\372\031A<v:e\334\230/;e\320a\006\215\215\036p\303\247,\335\204"
+	.ascii	"0\002\300\003\243&\345\202\0364b\210\2004Ie\036lH`m\243$\265"
+	.ascii	" 2!\002V\220\bN\274\270\370\3167\006\234\355~\234\324Z\2750`"
+	.ascii	"\206\373\343\266S\266\033\330\027\021*\f2\027\300\343\370\324"
+	.ascii	"*"
+	.string	"s\304\243\006\315\027#l\303l\222m\357ub\002F*m\207\342G\201\\\373@\002\330u-\017\007\334n\344\200J\336\247w\355\347<\005\354!\005\203\324:\223\343\247\326\260\344\002\336'\001i\333\307y\016\346X|\251\271\314\030\300\335\330vv\324\032,\206\210\202hQ\346k\350\341\240\233-\224\306-\332\355\032\035\021\001\311\022\372\370\022;\241\221\227\320\031\037\245\f\333m\266G\2174$t\204\242cT\306\233\205!\025:j\340\240m\221\035\3126\332\330\227\265\326\352Xc_\367\323\207\377\274\316/\275\336\271>H,\027\004\225\024\n\305\224\022!D\305\264\342\300\365Z\271^\252\020\t-\323\203\025\313\013\305\363\311\004\265r\372R(\023\313wb\265>\023\022\253V)\254\317\245R\261>RX\037k\274+\343?\340rl>R\306\357\334\343\201\313\361\370\314\257\370\306\230\350\023\2278\243\336\312hOh\355a\374\034"
+	.ascii	"\3571\330\020Z\260\016\251[\200\033[\261\016\315\300*B\325\260"
+	.ascii	"`\027\330\"UqY\305\002QI\343v\021\304\320\n\252]\003\t6\2341"
+	.ascii	"$\202\276}\256%\240\344\301]R\332 \026:0\241\353Q\233C\255\363"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_backupPgConfig.233.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\225\t"
+	.string	"\266\022B7@\223\206\003\033`\302'\372\356\306/\373\267\265||\257D\265\\C\352\245\304W\262\255\327`,c!\033Y\315Q\024\003\034\231\357\342\222\333\001}\356\265\377\336[\312\224\0021"
+	.string	"0"
+	.string	"3"
+	.string	"\343;\3335\356\004\3335\2036L\001\306\206\n!*(\224\231\335\355\364\343\340\023\364O\362\200\224*|\0024\354\2563\245\332\270\365\266\017l'\330g\b,\373\342\277e\351,K\253\2463\323\34782.\325_-\273\0321\232\205i, \033\333O\373\257\217\200\027M\037\330e\275\254\354\216\036#p\327\034O\311T\240%\216~\342\251\032\264\256\251\036T\215'nR\342v/\026\374\222\257\202s]\363M\333\265\3539V.\"\342)c\366\030\246z\330\317vw\255\001!R\032\364\021E\200:\t\221\303\250\003}\245\356\323\261Gz\370:\n\317\373\272\315\270\317VY\346bV\260\223Z\230\223\251\252\231\332!Q>\345MG\206\206\266!\002\017"
+	.ascii	"\357b\310\304S\274h\304\005\204\250\364\300\220\237r\202U3\232"
+	.ascii	"\312\302f\30280\353\022V\263\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_restorePgConfig.234.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\225\t"
+	.string	"\266\022B7@\223\206\003\273x\276\261\362\331\"\362U\214\357-\237(\313\244r\2101OV\377\311\266^\203\261\214\205ld5GQ\fpd\276\213K\220\342\033-\206]\367\336R\246\0241"
+	.string	"0"
+	.string	"3"
+	.string	"\343?\3335\356\004\3335\203\366L\001\306\206\n%/\252\025\233\335\355\024\344\340\023\364\177\362\200\025+|\0024\354\256s\305\332\270\365\266\017l'\330g\b-\373\342\277e\351,K\253\2463\323\347<5.\254\273Zv5b8\373\322bF:\266\237\366M\356\002/\242>\260\333\202\301\354\216 #p\327\034g\311T D,]\305S5\200]SA\252\034O<\345\304\355^,\370(_\005'r\315Gm\327\256\347\350\220\271\021S\031\263\3070\365\303~\266\273k\r#SZ\024\"E\210:\t\222C\251\023}\247.\364\261gz\370:\n\317\373\272\316\270\317V[\346hH^)\265\260'SU3\265G\244\374\312\035\217\f\rmC\004\017"
+	.ascii	"\357b\310\304S\274h\304\005\204\250\364\300\220\237r\202U3\232"
+	.ascii	"\312\302f\30280\353\022V\263\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_backupConfigs.235.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\206\001\215\017"
+	.string	"\266\234gF\360\260(\035z\263\027b+\177\\P\241\216\fH\031\214\227\r\373\177s\233Pp\211\306\na\"\227\33192\263\026\375\251E\210["
+	.string	"Yc\323\226g\340\031x\nd\305\373QuJ\017\254\274\253]\357\t!{K\231RS"
+	.string	"S"
+	.string	"R"
+	.string	"sz\313\301\033\f\013\215\f\030\026\232\031\217\341\035u\364M\306\345t\344\203\244o\030.#wR\201\360"
+	.string	"OQ\204&\253yX\322\030@\304\352\333\255\316E\004-\261\225\007\250\022=06\330x\353\272\002\242T\271\2219\2475\005^\270\273\333^\331\006\261\037\006$]\226\215\007\233\017^\027\373\257\327\255\252>\200O\246\262"
+	.ascii	"\336\2253\247\252\246c\336\310\232\020\177\335>\t?t\307w]f\364"
+	.ascii	"W\005\0013\306<\250#\246\206l\3160\301\245\rt\227\016\357\331"
+	.ascii	".\273\177l\227\357xd\337 p\232$\00511\025\023\263\031\321\007"
+	.ascii	"\376\261\351vK\002\223y\201\032Q\322\2329\325\265O&\350S~\370"
+	.ascii	"\00139-nLKZ\207\244\357\211\025'p\227\345_\244\003M\306\255\213"
+	.ascii	"E\333\267\001\f\307\2444\373%\016\023\371/\246\200\242O]\372"
+	.ascii	"(\373\326\013\200.f-\256\f)Z\263\303\017L\324\237\020\020\204"
+	.ascii	"\217\027\001\304\240\304\373\204N\274\020\217?\023\007!O\302"
+	.ascii	"\367\205\274N8?\222\262\245mY\027m*\336zd\241!\307\f\207\\\226"
+	.ascii	"\027\340l\267\034\2153\350\003\241\241\273\222\342\353\346D\315"
+	.ascii	"\034\005I\374\313\245K\276\355\333.uw\007,fR\332\343\234s\006"
+	.ascii	"  P\0022U\324\003\257\030\362\320\364!\300D\210Cv,\266\331\272"
+	.ascii	"T\370u%\230Y[\224\030\204\230B\032\276\302G\035%,\b\346\202\311"
+	.ascii	"\030\033\2541\256fL)$\262\nI8\364q\305\313\214\262;\374\214\267"
+	.ascii	"\221=\256\360p\r\367\321\030\340\036"
+	.text
+	.section	.gnu.lto_restoreConfigs.236.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\275\n"
+	.string	"\266TK= O]8@\b6v0\264L\220\200\b\276t\034\203\007\205C\312\2176\340\274\t\252\240\217\350F\330fCN\205\262\220\203\254 \200\300He\210)\205\213\232\n\370\375\222\030\215l)S\n;"
+	.string	":"
+	.string	"8"
+	.string	"\001(\254w`\304hA\305\214\335\325\264C\227\335/\315\316\327"
+	.string	"\275_\220\320\365*0b\021\312\300\316\025q\301!\306M\317\017\350\311|Pv\327\371\201\031n\354\266\023\330&`_\022\376\203\023\201>\340C\325.\250\305\332\026\330\n\021\017o\337\204/:\363O?\321=\234\260\261/\366 \253\304\205\325\256h\340\230\007@\216Y|\304q\fr"
+	.string	"\216c\317\334\3312\002\352\335\242w\004\036\306\225j\311\033\307u\001\n\206'G\373(\216\332\370!,A\223\377\216\371\032\275\351\002@\325jt\322\300\311\226-z\251\245\324\207\024\b+\311~xkf\r0\351\312\304\342\240\242=\260(\270h\025.\243M\"\3360\f8\r\302\266qZ&\356\225d\nG;\227\226|\361\2221}\331.\332\220\202\304n\205\177\252\030\354G\332\231\b\371\317\032\017"
+	.ascii	"\357b\314\fM\3478\374>\323c\357\0016\331\301\004\3532\016P\205"
+	.ascii	"\326\205$.\364\313\025\343\322\2654M\003SP"
+	.text
+	.section	.gnu.lto_getPidProfileIndexToUse.239.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"e\n"
+	.string	"\246\023H<0\305*\035\336\016\373uw\243\"\266g+\033\301\242\243\031\351\201$\356\374J[\240m\360\242o\237d\025\003R\217\230v\f]\241\003\203\fP\327\376\207m\242^\3405\001\322\366\226R\2466"
+	.string	"6"
+	.string	"8"
+	.string	"\373\355\224\315\337wg\213Q\311\260\215\241\b\356l\255\024\020[\333\022A\205\303\330\210)\251\311\255Vv\266\314\022Q\314\235B\255\365\034\212\026\373\313\376_\370O\360/\007\177\r\344\216\375+k\303\376\363\273\363\347\371\314\374\305l>(\304\265\005\250\265b\024PQf\211\354\277\351\317\374 \301\364\217\243\002\001t<NV#\270Zk\2645\002#\267K\026\222\"1\374G\214x\303\256\227\343\205jp\317BB{u\307\276%]\2665\035\"\267\024\347\376\005Y\032\351\273\361\211\022o\270\363[\272\354\334.\270\271N<\006\367<\037\220G? \217>|\030\034\250'\032Q\317\300C\020\r\"*\021\n\211h\246VW\326\206\335\300D\316\316\\t\327\334\254\377\334\235S\243\344\354X\317\346\264\254\006\2348\017"
+	.ascii	"s\2046a\303\360\243\\\313\304\004\001\021=+\204\305\340C\333"
+	.ascii	".\214\351\230\351=X\006\256=A\211\377T\215\032\227\202\002"
+	.text
+	.section	.gnu.lto_getRateProfileIndexToUse.240.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"]\n"
+	.string	"\226\023H? \211L:\257BG\030\371L\360!\300U`\026\030\255\"\003\260\347\347\205\032\212'B\202\336\2445\222g\334f!\215\243s "
+	.string	"\b\b\001@\204h\201K\006(\206\372\305@%\244\355-eJ\0014"
+	.string	"6"
+	.string	"7"
+	.string	"\367.\343\252\347\237uH\354\005\213\201\341wYzT\bK\337h\021\315"
+	.string	"L\302P\224\320F\016\316\272\222B\220\352&1\347\264\202a\307\375\270\355\t\333\016\3665\266\353\323M\331\217sQ\266\325\233\325\322jU\365!\023\226*<l\301\234\0345\t\223\201T\260\262\355\261#\206\210\360\330c\020}\020(\005d#\004\2639]\334\006\b5]\323\352@\203\bQ;c\243\007\267=\201\023h\277;\226\240u\332My\347<\276\022\332\353AHi\366\r\274\305\361U\336\350\350\301K\277\363\270\374>\b0}\264\026\356*\027L\307]0\035wq\241\260\340:\315\206\253,8\203Q\241\34142\031\r\027q\315\307\271([dQnd\300n\253K\262\255K\371,(\312\257\334\206\b\243\t\037\r\017"
+	.ascii	"s\2046a\303\360C\t\237\227\200\025D;\b\261b\360Al\327\304t,\364"
+	.ascii	"\036\"\003wOP\355?\245\243F\253\240"
+	.text
+	.section	.gnu.lto_getValueOffset.241.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\217\002\215\022"
+	.string	"\326\242uF\340\320(\035UX\035\336\"l\316\013\352\017@\034}I\271@D\001Y3\274&\361i\311\303h\257F\325n\033\311a@\320#\034@\f\036\347\006\361`\303,3\020\316\313\351\f\363E4\366\257^\023\371do)S\nc"
+	.string	"Y"
+	.string	"e"
+	.string	"\347\271\007\227\177-\027\260k\003Ch\367;\340\217\356\321_g\333\337y\007\027\263@b^^>t\210^\037\210v?\324\351\035\334c~"
+	.string	"\367\250\031\316:\027\241&\313\367\316)\360YA\213\235\314\341{\236"
+	.string	"\003-\006,&s\215\201iq\247\335%\305\\0G#\273\353\204\305,\334\243\333^\331\016\261\363E\371\232i\371\301\177V\335.\f\002\337g\301J\247\341\321o\341\036\257\3579LAc\323\341y\311\"\373\363Ro\354\303\335]\253\215\255i\223\323\034N\227\376\375$\247;\230\036\3014\247\351\b\323\020\246S\323?\231ZL\210\235F\333\245Ptc\207\342\211\r\266]l"
+	.ascii	"\2663\355*\240\222\\\3701q\226\n\261\224$\265O\030\344a\251P"
+	.ascii	"=\177\304Ad\330\240\3368\345(T\034JBs\253q\020_\321\030\362\322"
+	.ascii	"v5\220k\036\267\231]\3574_\350\264\023\201\204_\242\273\341\354"
+	.ascii	",\204/\302\265n\327\273\314q\266:6p\036d\273\366\313l\327\022"
+	.ascii	"\266!\217&\0033W\336L\340\005\270\253I\035&+(%,\321)\221\023"
+	.ascii	"\224\024\252\301II\n*\245\262B\211tX\345\300D\005\005A\245RA"
+	.ascii	"\371\333\303U\033\233^9<\351\263\270\232W\216,\226\3642A5,\224"
+	.ascii	"C;\225`\273\323\324\226\017t\217@n\244PK\2523\\2\217\2638NG:"
+	.ascii	"r\341\342\320\312\"G\345\364\257[\200\264S&yX\324\333f-\365\002"
+	.ascii	"5 \260\002\221\271b\007n10e@\b\031t6\266I\"d|\030\222$\256>\207"
+	.ascii	"\316\254\375l{{\223\264:\243\313\333)\264\017!^,q\250\027\214"
+	.ascii	"\333)\227`\016\r\202\345\034\311A'\330\324\336\231`\240\331\273"
+	.ascii	"\277\362\342\002\316\"E\205\"\344-$\034\206\\\004\311\035\001"
+	.ascii	"|\200\023Z\300\222{b\241\304sW\020\032\354\322\243\210|\341\002"
+	.ascii	"\f\261\336<_\310\254\313:\031"
+	.text
+	.section	.gnu.lto_cliGetValuePointer.242.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\025\002\255\021"
+	.string	"\326\242vG\340\322&\035\222@\022\242BU# \3008\276\262u\013\363\225\005xh\242tt&\344:\255)\0139\333\r\265\323c\317\342,\220\3120\030\311\342\024\202\020m0\r\241^\001 \001\306G\337\325\207-K\b\331[\312\224\002a"
+	.string	"["
+	.string	"f"
+	.ascii	"\337\201G\033\360\036\363?2G\355\352\364\230\261\373\231\270"
+	.ascii	"\200\367h\333\367\271\212\227\355C=p\200\345(\360\261\241q\021"
+	.ascii	"d\367S\371;\t\367\350=\305=j\211\277\036\241\346\313\237yT\243"
+	.ascii	"#\b`\204\021\215\031-\304\325D\223\301\222\335\275\355YC\213"
+	.ascii	"ev(\273\353\234\321@\334\334m\247\3306\261\223&\252c{\351\224"
+	.ascii	"\227F\221\322\247\177\267\351?\377\210\227&ui\017\246;.\315u"
+	.ascii	"\351\b\323\220KkL'L_\200i\207\020\3555n\273\037nC\326F,2\361"
+	.ascii	"\357"
+	.string	"\267\357\2678\220]\362\313Y\030AM(\310\356\226^\354\322\343\355\227os\311\366\027\023`o\354i8|n~\354\006\020b\024\2466\224\273;\243\272c\273\205;\345\215\215\216\034 G<d)\304>\214\307h\361y\034A%?S\341\036Oz\240\023\260\345\300\021\261\342\346\224\251\366\212\225\237\231\264D\2463\276\246*\021\232\"\246\360\027-oW\226\300\017\232P\301\343y\364e\270\307\353m\217(jB)~`y\263\277X\352\216}\270\001+\226KY\032XV6D\257NZ,+\225\205\326J\213j\345\302\240:!\261\313\005\226K\225\301\305\305\245*}\260\303U\035w=A\020\265\240\207\204\246\224\2445\266Ij\024\230\306\242\247\234\242:\365:}\017\203\027q\nS#\202QUS\232C\035N\304\362f\250Q? G\324n\220\222\237A}\r\307vp\031\017\210$\004# `\002\0312\263\003\277\030"
+	.ascii	"\304;S\304u\202\375\362\212\232\2466\234\b\331\020\233h\315\242"
+	.ascii	"n\326*\b\026\260\220\354.Z1\032K6\257\027\252\215\357mxl@\007"
+	.ascii	"\206\301\033\234e\013[\214\254\216-\262\263\341\221\304\310 "
+	.ascii	"\307\233\r\340\345\300\347\342&\216\264\263\t\241\f"
+	.text
+	.section	.gnu.lto_dumpPgValue.243.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\233\004\355\035"
+	.string	"\2666\302H\220\234Q\007\204be\235-\263\220\311.|\004\365\332\240\025\211\363\212\201\362\013\262\267\376\202>\300\327\355\\d\235\255a\334b\3207k\310\221\352\355\324eO\r\213\374rT\257)\236*@kXl\207m\262\367\336{\247\224R\257"
+	.string	"\240"
+	.string	"\255"
+	.string	"f\327\226\231\252\005M2\007\254\365\312\251\302\030\245\257\220Z\312\214\221v\201?\274\200\316&\325\221\037\n\215,\b\336\326\340\241] q\211\201\267\325\332"
+	.ascii	"\356\205\372\202\345\336\266\001\0338\233dfn\252\256B\342\365"
+	.ascii	"m("
+	.string	"%\371x@\025Dx\305\346\336\326\306m\357\224M\236\035\240l\362\201\364\332\247Y\222\343\373\312m\006m\370}\341\302\016}}\232A>\232\234\332\314\321\345\250 \215\226\232t(\034w\226\212\260\262a\320Ia:T\362\021\t\223\023\320_6\374\215\352\275\267\251\264\337\030\002\335\315\240{/;;ljF\233\231\231\230Y\307<6\005\214\242\257\2448\357\005J\340\266\"B\3059\244In\032e\223\376@b\212RON\254\222\374\213g\256\363\314\270\2347\333?`\212\222\266M\032\340\373\230[\237\177\024s\217\367\241\230\333\252\373\247\261\232}\032\253\273\247\245t\363tVs\255\241t\013\350\266[\007u\246\231\3163v\226\241\3169\246s\214\235\323\2303,\346\214\246\316'\314\331D\235K\323\231D\235\307\323\371Mg/\235\273\300\317\030bW\024*!_\246\275K_o.\027\231\305Hgu3#qS\341\224!"
+	.ascii	"!uVO\365\265w)\303\342\220\247\252{\203\315^8\203&\020`\320\340"
+	.ascii	"\315\362\004\036J\274\241\2678t)\321\241F\331d\372\275d\007\230"
+	.ascii	")+\013E\330\247\362\243\266t\355\275I\267\367^\362\243\2644\354"
+	.ascii	"wD/\025\366)\321\313\225\037{e\355}\t\321\013\350n\332\357\275"
+	.ascii	"\276OP\242\277\202x\006\350n\230\326\tJ\236G?\375y\231\"t\352"
+	.ascii	"\361\236?\237\347\231A\204\360f}\236\004\017\363\317oa\234\332"
+	.ascii	"\233\337?\266\276\204:\004\370\370\345\2230\341\315\326^\r\276"
+	.ascii	"\217\377\311/\377\341\004\245~'Z\213|\013B\254\376\375\307\357"
+	.ascii	"\240\324\317\277\270\377\377\341\b\343p0V)\250\274\003\352Q\216"
+	.ascii	"W =\"\352\335X\3442\360\210n\275\030\271\234\335\321\210\026"
+	.ascii	"0\206\204n9\027\260\027\274\233\007#]O\350la\344\271\036\321"
+	.ascii	"M\006\231\323\335>\b\351p&\343\034\f\021\341l0\206n:\033n\307"
+	.ascii	"\2639\330\341\"\243\334\316vTT\264\263\245\355\355\361>\224\317"
+	.ascii	"7\327\032\034\\I\377;\247.m\366\264\357*ff\237j\025\337\310\236"
+	.ascii	"\233\314J\304\354Q\f\262\0329\203\270\b]\262o\246\035a\246\336"
+	.ascii	"D\340\314k\222U\211\311\244e\223\346\367>6\340\013:\347u\376"
+	.ascii	"\347\231\327\251\225J\025\306>\347\273\030\224\372\205\211\375"
+	.ascii	"\354H\021\315\223\023\002\236>7\230\365\t\032W\250q,\206\004"
+	.ascii	"\216!efF\242\321\304\222\016\300\002\021\242b\007\021\240-dc"
+	.ascii	"\265N\016\203)\365}\"\317\264\340\237\215\277+=?\375\246U\212"
+	.ascii	"\242tj9*\230c\332\246\300{\223\325\233\235z'\306t\340\244\267"
+	.ascii	"\267\232q\344I\355!j;\253\246t\232\230v\366\273\025\001\030\027"
+	.ascii	"x\036-\252q\254\217&\375\023\323\202!5@\276\252\244\277\360\216"
+	.ascii	"|,\346\b\331\021\003I\275{\237\265\3540\002f\3737\343\201\177"
+	.ascii	"\253BU+\303\300\210h\030\200?m63Px\240m*\352d\333\031\200[\273"
+	.ascii	"\274\250\324\255\036L\271Z\271(\333\334s\310\322\217\315\246"
+	.ascii	"T"
+	.text
+	.section	.gnu.lto_dumpAllValues.244.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\001\b\0351"
+	.ascii	"zY\264\023DP^R\007#\030\211\275\201\356s\342\261\201\035$~\001"
+	.ascii	"f\0237\304h@\270\357H\244\267\304\021\321\256\003\n"
+	.string	"x\350\336\276\3215\006A~/\330\200\021\202v\371\237\375\327\305\351\224I(\315rK\333\366\336I\246\024+\001\031\001.\001\335Z\266\326\214V\315f\3065\273>\022\b\024\274\216\245K\331\254f\262v\355\256\352\244/\347j\223\263\r\325V`\f\035\2633n\214\204U\212Oy\235\312\213\365\230\235k@\034\004\235U\256_u(\257G\361j6\3474=NAg\217\330q\267;\361\267\327\341`8P\316ls\\r\256\036h\002Ag\273\352\311\326\331\240#[g\373\355\326\033\n\313\315\004T\271\347\224\276\234\363\362{\264\021\277\376c,\022\335\2410\bl\331\365\361\333.\347\353\232\2330\320h\323\177V`\030\231\020\317+\333\2616\360\343\353\342t`\330\310\303l\352E\"\020\002\033u\017\03553\251\273F\312r\340\341\232$\023\002\365\2742\035+\023\037\035\036\257\363##e8\260\360H\315\354\206\007\363\312n"
+	.string	"\327\004r\2428\214\321\347\352\316\320c\343F\312\320p\353F\3050\273*\363\312\244\2532\347\354F\303\360\2722M\355\316\214Q\347\232D\263&\307\353\034\217E\305\360;\235w\240\332\321Q3\233:\006B\31097\206F\315\274\217\336\355\005\272\333\253\033\030\025\013\360<\270\023\251^\237\031?s\325:\353\377A\272\327\004\316\355\256\222\334\344\354thwo\3602\036\226>rv6\030\343d@\254\036\304\331\0261\242u\350\210\326\331\243\367:_\361H\365\342\332`\251\361\205\377\276J\230\260\3507\0206\372&/\372\356\022L\354P\345'\237\3244=|b\337\354\256\202\341o\353\366\006>\374\370\372\331\272]\334NML\016\347\276\244\224\344\342F\362(\356\003\334\213\367\221\322\255\270\0339\025\367\242!n\"\347\342\035@(\351X\274\203\220"
+	.ascii	"\\\2137\220[\261\342\375c\304mtq\027\215\270\211\217\333-\342"
+	.ascii	"\036\026q\013\211\270\203.n\340\343n]\334\254\213{}\334\377\270"
+	.ascii	"\361\020\267\0370\232\002\226F\nu\313\267\251f\262\277=\031\217"
+	.ascii	"\3552\304\275\270sq\307\342\256\305\327no\237s0\335n\267\360"
+	.ascii	"/\235%\265\303\244K{\235\227\253c\316\313\036\225C\275\343;\341"
+	.ascii	"[\332\351\332\345\202\245tVst\230\346\016\317D\213n\327Y\367"
+	.ascii	",.\327n\007\323\374j\370@\225\271#\256w\265A/D\263\267\027\007"
+	.ascii	"\307\241\317+q\206\337\326lU\236\310\b*\t}\320\217y\235\273\215"
+	.ascii	"\347\3334\230\364\275\002\221\017\364cK-\361]-\016\316\321\227"
+	.ascii	"\332\242'\2761\315\2313L\204M\356\276\322\257r\317.J8\370\302"
+	.ascii	"\037~\367\233\344]\202\035\352\276\333H\023\373f\023\3073\374"
+	.ascii	"'78\252\333y\337\204\317\300\r\370\301_\357\336'^'\302\213DC"
+	.ascii	"0\347\f\374\266\206tO\0238#\334~w\005\013\330\241I\257t~\263"
+	.ascii	"\331o\037\337\331\203\352\323\233\303\276\237I\355\3509\303A"
+	.ascii	"'I\320\351\327w%qp\372\202\307\201r\"R;p\336\254M\315\275\264"
+	.ascii	"\251\200?\367j\221\336\351\207\3568\230\306\340l\240\202\276"
+	.ascii	"&\204\206Fz\007\343H1\336\342\304\274\301\3750\233\342\001\267"
+	.ascii	"Z\344\263\315\275\265\336\362\204[\322~[\236\023}\021\016{\215"
+	.ascii	"!x\316X\367j\007\374\033q\034\344\214\034\267\365\333^+\356\215"
+	.ascii	"\023\373\365\200\377_\327\020=F~y\366\031\362\242\326\237\350"
+	.ascii	"\033?\321\300\232\203\243\211\372 \335c\222\2633\255\342\211"
+	.ascii	"*kI\225\205d\253\234*\013sYu1SLQ\330\262bv\265\250@\225\365\243"
+	.ascii	"\305\025E\305\242\n\005sJ\305p\305\026\023*\353\252\013E\220"
+	.ascii	"\005V\025\227\324T\324T\227\025\323\005q\352\212\231\001\305"
+	.ascii	"\225\024\260\245\236\252\254\244\226,\252\230WK)\255\255\345"
+	.ascii	"S\262\261\262\246\264\226\\XXZK\267\372\345\317&\347\036\303"
+	.ascii	"\217\006\336\327\203\375|[\027\311\024\205A\250v\3179\334\311"
+	.ascii	"\240\032\252\030?\027\002\240\206:\367\234\303\256\306\221\305"
+	.ascii	"\237w9\027\372\240\222y\316a\345\037\177,\300\033\177\202\231"
+	.ascii	"\342\033\337\237}p\306\315\b\253\007\351w\355m{\333Zg\213k\237"
+	.ascii	"T\257\t\332\027\376\3635\347\234\215\253\320\267\353\336\325"
+	.ascii	"61\350\233\025\372$\362\333\005\372&\002}\263\310\007\360c\275"
+	.ascii	"\036\277W\367\370\322\347\223>D\246\357\225=\376\317\217u\273"
+	.ascii	"c\265\001\276\351\235\316G\254\335\265\021\233\202\341?<\243"
+	.ascii	"\370m\370\370E\017\364G\277\344\366\002\301\016e\372\0072\376"
+	.ascii	"\366d\264o\266\001\334\375\016y\213`\207\266\273\311\303\007"
+	.ascii	"\017\354\233\235\366d\317I\\\003\200\227\250\201(\202\fcJ\231"
+	.ascii	"\231\031\221 #j\306\200\002\021\272*n\021\300E\034\242T\n\313"
+	.ascii	"\030\335\rB^\353\263\037\007~\307\f\022\342\333\344}'\273B\272"
+	.ascii	"b\211\323\330\216\335\263\004\177W\001\277F\027\372|r\327\326"
+	.ascii	"\345\332O\033\003\351\351}\310\231s\227\bS8\257\304\3560\276"
+	.ascii	"\307\336\227\031T\354\303m[ts%l\002\313\006\224\340\334Y\317"
+	.ascii	"\2008V\237GH\322W\r:&\236\007P\017A\320\013\253\026H\314\234"
+	.ascii	"\350\353\377\340T\324\367\006\266O\342\366\301\177\"\364R\330"
+	.ascii	"5\363\235\232\3207CH\023\b\003\021\370K\203\204\220\346$\002"
+	.ascii	"\300\333\337Hc\222\002gi\244\233\313\237\313\340a\200\360\002"
+	.ascii	"\234&\330\317c\364\366\243.R\232\222\331:]`\177\027PW\203\260"
+	.ascii	"(_\346x)p\023'\\\272eX\370\337f\005\363\324\304\b\3215\254\216"
+	.ascii	"\204\204z\200x\006\347t\304\222e\371r\302\231\n\3652\335\336"
+	.ascii	"1\033^\260\214}\026i\242\026\361D\336_;\303H\250\263\2239yq\220"
+	.ascii	"\020(\3569\300h\016\256\212\371\205s\331(%\233\030B0\246\276"
+	.ascii	"\211~\177"
+	.text
+	.section	.gnu.lto_cliPrintVar.245.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"=\013"
+	.string	"F\226O@\020Q\234\016;\242BP\313\205\243F\264d\274j\320eh\244\340\n'\215B\320\204%=\215\373\204\254[\201\331\266#:0QU\245\375\312\267/\250\0340$Z\001NNJ\261@$\264\211\334)\005;"
+	.string	"@"
+	.string	"9"
+	.string	"\033\256`\261;\023\330"
+	.string	"\344\322\363\024\353\022r\001\326\245;[F%\303z\fH\033D\250\216\335\305\224\304\273\307\316?\352\221\017\364\036/\007\273\353\370\201\036n\275\355\002\266\033\330\177\020\333\341\203\306\246d\013\023?\375\366\217\262\304\366\311\034\223}\261\007C\022\207\031\273\363\300\245/v\025\355\005\227\356\246\n\237\003>\250\030\271P\020\247\205\312dC(4 x\264?:\251{\351\302\003l\266\364\372\0201R\210j\200\342\207\257\250jw>\361\237\324\330\341\001\"\025R\317\236^T\021\366\253\335]kh\277\364_7\375\326O\267\374\374\265\212~\004\300\210\022\340apl\234\207\243\233\315GB\305a(hF\303@\210\240e\2273\213f\223a\0234\030\r\313\270\016f\241x\343d8\314\263m\034&\231\373j54\304\343D\n\244\030\274\021\257RU/\265\265-\3763\001\221z\001\017"
+	.ascii	"\357b\314\304s\242pF\347\205\b\\s,vw0\020\013\"\200\023`/(\f"
+	.ascii	"\206\005\250\320\340./\332I\006"
+	.text
+	.section	.gnu.lto_cliPrintVarRange.246.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\257\013\3259"
+	.string	"\232a\240\025A@dR\007c\214$\fs\302@\265\207A\374\360 \353]W\364\"n\023\331\307\224\276\021U\211\225\351\253))M%\376\200\035\260.\247\217\321\237\375\364E0\035[4\371\020\252\261u\333\275w\222)\005G\0014\001K\001-\213\233mq\257,\356_q\343\307\355\022\f"
+	.string	"\266\3719\023}\362\201\244\371+PQ\236\262o\2648\032w\266\266\366\2673\356\366:\032\344qK\232\301\210~\356\246\024\\g\217\2533\265.m7\323Dg{\202\205\327\331\204\034\227\322\374\0254\273\243\243\326\227\263\364\201\263\215t\235ubw;\356v5\217\276\2766\304\2139\237Q\345r\226B\350\005\256\263-\365\246\326Y\327\231Zg\373\355\306sb\346e\205\250\030\227[_\316Y\352\247\364\021~}\251\250\224\204tdD\034\n\335`\313\256\217\337v\005yy]`K_\252\246\025\363\224\006%\261f\204\372\324\374\220\326 \363+\213\367q>\327\f\177zo\374\315\021pq2\301GR\302\240\270QY\330\023'\"(\013\023\363\341\352@o\216\317\2718\305\326\246\257,]\336\307\351\004\013W\246&l"
+	.string	"y\037\347\2235\nP\027'\316\305\331\004\273oN\302\354n\n\305\203jm\2070i\254\227\361\022f\202\350\250\371\225\205U\361u\213\3316U\241\2632\004k\376C\251\214q\r\301\264\332!]\025:/sViq\020D\316\271q\027X\2307\223w;UwK\273\207A\002\016\367Wg\312\266\021\343w\251\337\261x\242\346\334\364\256\026n\323\002\224\213\027\330\273z\003\031\363\227\335\r\303\355b|\240\266\f\247N9\213\201\212\337\001\237q\374\326\262\352\374\270\324\007\020m\375\323\016h\205\372i<\003r\350`\177j\371\264\313]\331\323\215"
+	.string	"D\256\213\212\321\313dH\020L\f\330A\244\273\361 \234i\237\336\022/\312"
+	.ascii	"\375\303\373G\273\323\216\307\363\035\235\366:\323>\272v9R\346"
+	.ascii	"\343I\325\302\274i\207s\204\333\222\311\342\332\345\032\317\315"
+	.ascii	"y\351\317\366'\262\034}n\31197h\323\335x\356O\027\232\235Y\232"
+	.ascii	"\0338\013\365^\306\037\220qa\300\366\251?\265\376P\337\230\213"
+	.ascii	"\211V\323p5I7\347\255\013\355i\33617\334+\316\266\017i\235\365"
+	.ascii	"g\227{{\317\350Z\026\016\354\226.\361\243\315!\3423\326\177\326"
+	.ascii	"\035\365\270\221\217\033\312\327\334\0238\032\357\002\004\234"
+	.ascii	"\315{@\213[\300\343vjq\033\037w\200\026w\323\343\006\260\342"
+	.ascii	"fz\334KD\334E\"n%!\356\244!n\244!\356#!n#\0277\261\305=\f\342"
+	.ascii	"\026\266\270\335 \356`\213;\355\216l\013|\324\033\360s\027\250"
+	.ascii	"\371\324\302\201\030\314\250\370\016\207\235\274H\236\250A\300"
+	.ascii	"\230\277,\376\320\214P\234\035\021\016+y\221\034H\3426}`ju\254"
+	.string	"\355\242\270!\032>Z\273\220\226\300\263l|d\360\232\">\252\360\321\372]\322*\275\227\265\t\332\302\177\335\030l\306\273\304m\177\305Zg\225\336\275\234 \275\321'\2757\275\270\336w\332\243Gzor)\360G\277\346i\202\217\274bA\265\306\201\215\274P\222\346\370\316\236j9oep\266\261\027.\362\216\255\375Fy\315Z\357z\321Zg\215\336\337\034*\215\317\313\277\315a:\335(\354m\230\310K\245\t\372Zq\2335\240^,\257\026\207\253&\231n\3752\r7\337.\036\007\372\0053_0\316\206\212\267\316\020\337\3158\t\271g\235\337\234#\253`\323\240\373\303w)\316\022\376P\214\007\276Q\177\003\f\261H\370\376\026|\367%\343\3257\352{\3362\376\027\302\361\370\305\t~\013\370\314\243\347P\273~\233H\304\b\267\211\342\330\374e\263\337\226\360\275\023\036wh\205\2371\304\001\312\276\307\331\375\257\357\204\270"
+	.ascii	"\263L\270\336\t\317K\341y+\274\016\212\347x\240\377\301\265\347"
+	.ascii	"\0341\001\255b\3051\212\004\211\025N7\254\250\224W,\214\032p"
+	.ascii	"\\\335\260JV\035\201L)\225!\212\315\203\301\3671\352\373\250"
+	.ascii	"\201G\262G\325\224\217b\327\250\301\300\330=\030\034!\034%\034"
+	.ascii	"5$oXM)\2175\222?tTU\205\b@\345@\224WV#\256x(\251l\f\225S>\276"
+	.ascii	"iD\240\252\242!eE5\225C\212\206\222\207T\204\246\326\261#\251"
+	.ascii	"\224\272\322\241C)E\354\354\177\326n\265:\315z\255v6\356x\021"
+	.ascii	"\223%\227b0X\211\214T,?\267\351\320C>\307\221\325BE\343\013\360"
+	.ascii	"\"\302\350N\247\027P\305iIw\333\362.=h\271\340\364\356f\267\026"
+	.ascii	"\340\215X\2130\226\244\327Q\261\002\361\225w\351y\240V\350\002"
+	.ascii	"|0\354\311g\307\221"
+	.string	"\325:JMT^*F*\026\200ozo\243\205\245$=01\332\313\205\001\237I\001x\357{\356\371\255y\034\3672\356\320\352\\\322\006\334\375z\275F\314\270\027y\273#\347\247\247\365K=\244G\353\2441FQB\265(\033\256\270`{\365j4\300\335\213\256\341\212\013\272W\201gz\\\326\246g\351\231\336\277\360X\222\310\306\267\345\te\351=\314\023\220\030_s\316\371\350\321\332\337\334\237\\w\262\0201\022\357\325%\360\003\336\253\003\200\334\250Q0\245\230r\306\320\210\004\221$I\322\030\220\002\221\031*\253\003\021\320,\007\235*\222\321$\205e3p9 \201\265\233\037\310Il\003\230\332\377\031/\352\313p,/FsvG\bEJ\003\247U\211\204\0052\004\205\337\357\334r\271\n\037%\035\013C\377f\230\322\035q\315r\r\376\f\013K\314\373\272\2271\007\223+^\326\217\307\003\036\260\335\366\001%\017$"
+	.string	"\244\034J\027\263O\245U\f\345\256\220QW\271\340\030\341\360C\030\321\t\f\225\036\r\342\3149s\311(\003.\306\t\211\206\312\215J\035V\033?[\307r\373\232)\217v\230L\3266_\361!\343f\2356\002j\370T(\213\300\237j\360\266\353u|]t"
+	.ascii	"\005\350\254\217\231\355\204\335\275\f\246\225Ns\215\227\004"
+	.ascii	"G\032s\243\261;\fW:\263\273\357\246\221\324\274\224[\262&x\354"
+	.ascii	"`\234\304\370\344\233\342\350\2523\334\224:NE\021\370\362\215"
+	.ascii	"\307W\025g\341\216\203\017\221x\\(\326\301\033\027\201eDQH\265"
+	.ascii	"\025\251RA\265\232\226\301\324\004\203\261\274m\016\333\006p"
+	.ascii	"\305Ze\221\225\210'J7\242\030\324a\017\033\006\250a\177P?REe"
+	.ascii	"0\363\217\027\2636\f{\235\250\210\b\f\363\001\305\nr\370\270"
+	.ascii	"j5\027\334p#\315UB\"\230\\\314WU\3409{F\315\221K\007\263\032"
+	.ascii	"\216O\336\364\250gC\243^Wr\262\001\365qR\343(\356'?\306\3172"
+	.ascii	"\365\003\334\262\303t\330\274\224\201\021X6\361E!\362\207\262"
+	.ascii	"\222i3\377\347\243A\375&_5\210;\021\264\024Dz \221\023\367\247"
+	.ascii	"\336\244\366Q?\217!\372\312\023\260oN3!\035a[V2\237aeh\206i\357"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_cliSetVar.247.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\206\n-0"
+	.string	"JQ\300\021D`\236N\007@\030\307-\264n\366\216\205\035@\262\327x\370ps5\325\357\215\034\n\036v\313\260a\353\023,\216\265\364B\215\237\340\225\f\375\023\261\351g\367yvN\231K5C\273\001\221\b\331{\313\235RJ\001\022\001\353"
+	.ascii	"\t\001K~C\274t\267\275\334\264\331\210C!\356\005z\227\026\332"
+	.ascii	"\270\322\036\300\275\350\013v\273\206^[W\234{\335\030\264e%f"
+	.ascii	"w\353(\307\226\002\203\177\367\2265\265\334\013\227\304\t\326"
+	.ascii	"\266Fh;s?i(\307f\223\321\305{\205\210\321r\257[\022\037X\333"
+	.ascii	"\262[\033\323\266k\377\244m\371\310|7D\343^5Ay\"\247\350\335"
+	.ascii	"{\227~H\037;\310\b\364\343S$\016\205=<A\340oUS\213\276\037\271"
+	.ascii	"\r<\353\270\276\256:h\317\370\006h\315O\2059\0371E$G\214\024"
+	.string	"\3512/\")P\256\210\\J\2542\024\222u\317\330\017\347A\333\326\224\004\325(\240\032\005\326\243\177t^b\250\321\022/\036\276\252Qk\235629e`h\255\356\350T\215\332\321V\370\265\205\032\335{i8\352\243\313\274\302\200_Z)\261@\231\027\032\372\350\202\2612:\232\316\353\f5\242I\272i*\355]_Y\356j\324\275\227\235\353\013\254Y\250\231{\b3G1\377r\004\356d\025\252\321\270\306\230\377\364tok\264\234\217\233\331Di\377\323\263#\303\262\374\311\314R}ej\275W\313\211\333\312\261\t\325z\244-\267\214\264m?\024Y\334\036\033\226?\231\307\r<3\211\022\336\\\b\336\227\316\034L\255\277bv\273\3627cn\364\276\020f\353<\301:K@\235\241P\347\b\250\363\223\023\204&\007\r\230\224\222\032\256\031\251\245t\037\365\262\031A\263u\0330\"\320q\315E?g\"\325y\300\352,"
+	.ascii	"u\016\220:\003H\235\207Rg!\353\034d\235\215\2503\220\352\374"
+	.ascii	"\223:\373\244\316E\325\231\230:\017Ug\241u\356\261\316<\250s"
+	.ascii	"\020u\006\246\316\277\324yE\235\325\3249E\235\255uF\255\363\243"
+	.ascii	"\316\216:7\205\341\363\306W\353)\357\305\361\354\273L\313%I\303"
+	.ascii	"u\307u/\373\231\273\247\264\262\251p\220\231\003O\340\177~\370"
+	.ascii	"vG\031\364\371\3427`z\237O\247 \305\210_$\346\001\231~\370\016"
+	.ascii	"\204?dsT\343\320!m+\374a\222\357\367f\315$\022\236\351\237=/"
+	.ascii	"\201\347\221\272'\370<uj\202rkl_\272\227\316.\353\233\261J'."
+	.ascii	"\205\360DJ:h\326\351\213\276\213\031\370B;\2569E\017\314S\177"
+	.ascii	"\277>\204\377\271\246\377\275m\"\325_\325\272\264\351\323w\372"
+	.ascii	"\237C\352\260\2376\335Q\355\303\312\r\"mk\177\230\334\003\323"
+	.ascii	"%\206\345O#\232\244\033\3330\322\243\267W}uol&|\3237\225\366"
+	.ascii	"\221C:\237\315r)\372\023\376\221\032}on\365\371\3777\322\211"
+	.ascii	"\025\242\315L\035\331\261\210\236\033\321\266\310\316\277\305"
+	.ascii	"\310\254\254u\227\2361\306\274\362&\003)\3120\350\233q\217\341"
+	.ascii	"&"
+	.string	"\203:\001\303\035\306\211\244] ^\270\345\370n\275\367\252\307\330\342H\273\367*h.<\326\r\344\266aI\273nWA[\250\342\322\371\203I#V+R<\025\013\023R\036JXU\271\370\225P!u\002\245baB\252\205\265\222j\361<\245D\302\304\324\022\n\022R'\226\246\254T,)\031\271*\005\225\325\322\212\252*\253\245\240\333\355\027\302\353s\217\211\365Y\334[\272\377\371|\346\005\035\365\255\371x\2361\022=\373\326Q\355\002\206\264-\321\017\223\316\272>0@\003~\300\017\337\234J\276\266\037\001\317\236uT\313 \264\323\220\266\025\360\303\254f]^\367\362\311\304'\300\321\007\370a\262\251D:\361\3728\366t\306wW\274\334d\3404\271\235\337\346\016w\2303z\334{M\306N\226\b\317\037L\244;\271\265t\177\004\337\202\207&\bqoK\230\364D\312\274\273\036\24572z\241]\f\2624kaC"
+	.ascii	"?\364IH\017`\350\207\311>\245\020\351\205^I\316Q\355\305\206"
+	.ascii	"\264\255\320\017\223w\362z\232yA\217\364.\207t\032\037\251\203"
+	.ascii	"\336\361\200\336\bg\352\350\354\356\f\350;\214\314\214\230<\036"
+	.ascii	"<5\300\006O\244\304\303\362s\360\004\276\213\371'\200\337\250"
+	.ascii	"qH\345\230RB2\222\024$\205Jc\360\002\021\231Z7\021\340<\250\234"
+	.ascii	"\"\221\231\024\0243\006/\240\201\365\260\213\325Mp\336"
+	.string	"\271\302D\262'\311\224\347* V2\004Q\202\341h\026$h\206\376\f\244<\230y\253\b\024\005Z`\377\305\007\276\030\242W#}\207E\207\200\341\023*\267\340H\352Z\325i\342\326\205\346\273\204\031\351&\221I\021\276I\265\301yn\367M1\001\235\305\032\371\330\340\031\242\375\375\275\210\222\210\256\003\331\031u\310J\f\320\330(\220\205\232r\234\316\t1\203*\177#\370\005\b=U\232x\373\310\371E\020\"f\200E\350\034\367[qSy\206\263{\013\256Rp8L\177=\3007\272\351\215=\004}\033\371\242\230\322\005\251\273\310\032`\223\344u\335\212\211N\005\204K\272V+$\263\210\322\300\305\017\335kg%\236M,\2729'\234=b\017\202\371\360\360{\344\322\310\343\216gr\2343\216\321{lZ\250f\267\242_;Wb\336\013\232\026\312\235\021$\002\370\320\347!R\207\333\030|\263\007\266\267`Om\367\277"
+	.string	"\367\276S\210\252\213<\360\321\021s\037\203\027\3362\310+f\374\224\224\316\302\3026N\345\302:?\227i\002\013{#\355\370\003TL\n$W"
+	.ascii	"\016x\212E\220\363\304\3206-e\214\t\373.K\361p]L^\350\324\177"
+	.ascii	"\001\3141\240\356@\240\236`ntZO?\263\nV\037]Z\200\n<f\3302\374"
+	.ascii	"\f\341\325"
+	.text
+	.section	.gnu.lto_cliPrompt.248.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375 \353\235\006"
+	.string	"\322\313-5PO\222\016 [ne\267\253\003\304\260\343\027\022\274\266\226.\221\207\371\002k\304\332\036B\242\304\243\331\264\316\314L#\315;\373\004\374\254\302=\262\364\257\215Md\n\037t\006\b\246+\317\347\241z\021\237\006\210W]\023\317\303\331\222p\270\036\205e]oS\312\"ij\004\263e\240\306\223kJU*8%\231\240j\026\002 \204\204N\177\201\341\252]\226\321\313\266\201\331\2272\207#_\200D\322c\201\311\207\250\0361\231 54\271M.'\1777c/c\300\221\331B\213H\307\312Lf>$)V\207\335\242\224\322BY]"
+	.string	"Cf\356\264\220\250c\377\316\257\360\207\004\t"
+	.ascii	"\357b\310\204&\340q\202\013\3335\321-\004\3742\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_cliShowParseError.249.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\265\b"
+	.string	"6\320>= \0057\035 !H\204\"\n(p\tD\2451\203\264\022\006\335\005\331\232 \252\376hB\306\006\214C\021\031^\367\003t4|\266\005?HA\373 z\024\b\310\267\030}?5\262wJ\001*"
+	.string	"-"
+	.string	","
+	.string	"\317\f\3325\005\250\r\031bZ$/"
+	.string	"v\267\322\223\203\237\240\177\226wDU\370\311q\330]OQ\265\272\351m\037\330n\260\355\022\256\177b\004-\224\325\305\327n\311+\300\226\231L\212\307\366\247}\225\257\200w\205\\`w\234\201\331%\027\f\332\236\231\374G{\266}@\0137\245\b\035\2616O\276\245\003D\263\233\272\350\261\245\024\020\236Mj\177\200\314\213N`\331\224(\032\332d8\251\211}lw\327t\264\037~\200\230\030\211\"\f$H#\213\n\021E\200\251+\221.:\216c.t\302\340j\306\251\324U\356\333\250\241\217=\r\323W9<\357\253\036r\217-\035\335a\005\t"
+	.ascii	"\357b\310\304;\276h\203\013\373`\310%\330f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliShowInvalidArgumentCountError.250.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\365\b"
+	.string	"\326\320@< \005)\035\214\320\026;9\r"
+	.string	"{9\263\2316\020\004A\353@\bt\026\307\036i\202\214\rx\3771\034\033\242\201\306\316AJ\272V \005x\r\234\247D\241\033\305x\311'\204\354\235R,"
+	.string	"."
+	.string	"0"
+	.string	"\027\350\316Y\264g\nDv\\xA\031\241\321\354n\245'\027?E\377+\357\220\256\361\223\303\260\273\236\244\353u\323\3336\260M\262M\013\2461\373\263\177n\003\262\226\327IbvK\002\334l\215\203\221yl\177\332O\271\212\370\331\307\003vc5.\273\245\202C\3369\227\377t\347\274\333\322\230;0"
+	.string	"5\020\032\342nN\372\362,\033!\231\335\326I\016\257\225ppnR\273\303c\2364\002\314\246\326\242\243]\216\223\232\330\337vw\0036}'\t\022\310\3649D\234\036&F\240\206\022\304\210\342+\021\244B\324W\021\202\034\203\"\225\005X/T\250\260\202\254\214*\372x\205\221bU\215\325\212U=\345>\t"
+	.ascii	"\357b\310\304K\276h\205\013\373`\310%\330f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliShowArgumentRangeError.251.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`;\001-\016"
+	.string	"\006\032`E"
+	.string	"\221(\035\320\\\3651.\216P\313\327\243\262\326\324\201w 2\354\272\373X'\366\274\003\007E\017Vu\003\206\336_\335[\344\201m\335\357\223=\244\367\260\b\366\274\031\305\316x\377\332\2438h\313\345\267{\313\235RJ"
+	.string	"M"
+	.string	"H"
+	.string	"S;\b\347\323\236\255C\204\303\262\020\324\310t\210\261cw9Eq\357Sj\364\374\307\334\363\201\254O\255\345\022"
+	.string	"\330r\225 \256\231Y"
+	.string	"\260%If0\022\217y\364"
+	.string	"\252\304\330Y\260\273\216\037\310rsn\033\202\355\b\366A\004\017\377{\006\300r\260\374\303\214\335\020=n\326f\322Xa\373\037[\246\"\201\302x\314;\214k\310\217m\271\224\240\331\335\022\037\320>7\031C\024\221\217m\305>\222G\373.\376\302\373\313\206\013\330}\341\240\331\rKL@\373t\370\020\316\00333\026R\213S\245^/s\031\026\n\330\330]\371\267\322V\024\030\370T\2651d\210\377<\"\242\305\315\216PV\234\301\\5j\024\316USd)b7Z\221\207\035\262\242\236\260/ww\255/\373\262\177\036\346\227\177\3715.\2016\007\"\006[\t\264\211B!\t'\241\006\333\311\003\321\266\002\215h\030u\212:uj\352F(i\352F\242RG\352\230dr\242@\342P\247Q\307\221T+\316$\304\251\n&\025w!\225Rq\237p/W_\366\270\230\260IQ\225\371\211\023\272\370\317\362\256\034"
+	.string	"\357b\314\304\243\244p7\206\005\274eBu\333jmp\245@\220\002\016\0225\221\nv\251k@\217\031\003\314\201\314\202\032\001q\0031\340\212\022\306\005\205\301\260"
+	.ascii	"\025z\334\345\235M6\205\271F\253\240"
+	.text
+	.section	.gnu.lto_nextArg.252.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`Y\001\345\016"
+	.string	"F\233cE"
+	.string	"\223\223\016\270Gu\372M*J\020*\341\2458\214>\021%\203=\210\217\375\203\265\321\235\336sx\332'"
+	.string	"\306\326,\372#\320\206\030\022#\177O\377\377\177\307 \222>\306'\320\240\376\311"
+	.string	"\320w\226\220\275\245L)L"
+	.string	"N"
+	.string	"P"
+	.ascii	"\037\311\036=\027\220=*\210.\341w\303\354\236E\250\331\371\332"
+	.ascii	"iC\r\312#=\373x\246\214PejnD\274\025\310\200\005\212\020w=S\336"
+	.ascii	")a\211\226\353]\177\260\243\272\201\362Z\236Z\203\335u\242<\226"
+	.string	"[\273\355\222m\005\366;\004?\374wg\246\357\031\220\"\206\345\252\233]\016\261 \013\2131H\374\373m\025\337\345\217\355\257\003\260:{o\365\312\341\261\373\031x\364\226ou\017\260\273\302\201\261\373\035p\001\317\343U|\205\212;\325p*\275 x\315\310@\343c\367\333\374\005\"(\027\032\232)\001\033\227VFMM\271\313Rc\311E\217\231\034\030\022\b\334\335\205\t\236\232\251vR\355X1a\312\230\276\370\260\302Q\307$\271edP\355\n\026\362\250\250\371\003\346\004\354\244$\373#\245\262\354/\320\311\021a]\331Z\026\337\n\334(E#p\016F(&\034G\001\024bP\311\211\004\320\206r\002a\302\006\342D[\311\210C)&\3346\n\205\270\355\363\355u\245\206\360-\256i\372\0320/XIM#2e\231\344\242\354\372\227\031\034\247\271 \362\304\\CvT7R\036J\031\273\r\03526QY\016\036"
+	.ascii	"\357bd\025M\3519\231Y$\243\365\231y\002\3133!\032\355\306\227"
+	.ascii	"\212\033\355\246} \205PW\233j8S+o\221\nBP\342\276\025\017o\302"
+	.ascii	"q\024a\241\362\3753C\235\262\204#V*C\021Zy\315\203\201\242l\272"
+	.ascii	"\346\023"
+	.text
+	.section	.gnu.lto_processChannelRangeArgs.253.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\001\004\245\034"
+	.string	"\206\364\271K\260\224U:\352H\317F\274\3708\325p@j\332\211\311~\205\326b}w\016\343,g=\n\342\223p\367W\304wv\327\275i0\376\370?\3156]\332\177\254\335\313\005\347\316\372f<l@*-n\033\216O\370\215\020B\266\334I\006\245"
+	.string	"\231"
+	.string	"\247"
+	.string	"\365D\272\277\356\rR\006\271\267\350\200\023\2447\277\343<tX\327(z;\240\007MQN\024)\357-\316\270x\331y3}\354\274\3312\270\336\026\317\253\252;k\225\242\247i\273\352\370\307S\350\r\243~A\023gY\331\214\0336\276d\205\217]\340\264\004\344\310W\236\340N]\305\020\366<\005\022\016\217\266\370\311\n\266\270i\025PI\t\001\020\364\331\001= \215V\260W\255\215\365$\235<y\004KV\fm\003'8|ZA^\355#\217\241iJ\025 a\317+\032\341\336\313\365\027\024\236[gf#3\3330\267RMd.\356\324\317\030\302\002\005w\020s\314\215\277\200\027\377\030\354J\347\227\353\254\fs\242\377\305\345H\347\364Dg\024\255|\242\225M\264\262E+\367Y\271\236\225O "
+	.ascii	"\223\244\360*\240\356\005.\253\356\223)\244\306\225~\244W\346"
+	.ascii	"\363\213\316"
+	.string	"$\342K\254A\250Jy\357m%\361\223J\354\024\324\244\224\272\367ZH\377\203\217d\243\037\351\034)\347Wx\237b\250i\212\324\275E\0067YBz\363\200}\354\024\301\334\272yf\035\346\0263\267\221D\017\231Z,\021\343\272\274\343\217\202\266\2319\374\210\355X\017\250e\230\345F\324\331\304f\356p#\264\364\336\013\201_$\303\214\001\241\241\233\374\022\347\315\377\254\300\272;V\004\204:\261eW\227Ld\227d2s\316\264M\343Q\324\361\t\2017\254\353\222O\307\210*\230\276I$Tu\2042z\201\362j\3034W_\026W\216\263\323\371\352\332g\272\3251T\304\001ete\247.\371\245\272\232\271\346\246\376\367\352'\017\233\202Q\345T\224\313\036\266\211\254;]\335\306#\037G(\274J\305\254\2126s\355V\377s\365\221\177M\301@\362\304k\023\325iH\312T\007l#\003\302&G\253\315l\267Z\355V"
+	.string	"\207\026\242G\320x\260U\250\301\321\322\234-\3476!g\243\251\345\324\340$x\270\301\241\205\200\321\324\330h8\023\227\373\320<#s\20333\263\335\320j\263\031\034\210\231\214\214o\037hp\263\334\355\206\233\265\212\273\333\025\332..\375\343_Jb\270x\332\365\016\253\211\374B\225\306\264,\351'I=\221\247\315s\344\017L\372\241\222\272\232m}i\264y*\224\333{\357]51fC\023\025Q\276J\225\236-\023\372\317\312O;\315>\333b\361\275\340#\271@K\371$\316\233f\263\212\206G<>\273\272D\003M\250A0\210\214BH\021\022\232h&H\352bp\002\241:b\007\020X\311\244I\2265\036\306\352\313\256\253\330,\"zb\026\234BFy{ \207uhq\260\343\256\037\277h}\2443\241\305\224\266Y+\325P\350"
+	.string	"V{W\026\316a\255@2\246\"\023\256a(B\346\266\364\005\007\240z%\277\253\325!\373)@\252\325\255\334Q\373\217\206`\036\344Cs;\017\020d\r\037\211\236B\\\335\232\261:\b\204\340f\206\2100\020I\336\354\314v\260T\246\201\221\002\257\361\333\225\235\202\374"
+	.ascii	"\250h}\362\345\214\226K/[\321\233:\365\003"
+	.text
+	.section	.gnu.lto_isEmpty.254.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"e\013"
+	.string	"\306\225O@ Q\224\016\017\241\303%\344\025\201\340W\2140\353C\004\346\210\343\023\343p(e\273@\242h\201\375\267\275\376\305\262\037\361\037\262\021\031"
+	.string	"\t\020\001\252\234S>\034\264\372\373)\374\313\004\355\275\245L)="
+	.string	">"
+	.string	"="
+	.string	"\207O\223\344\177\344PE\006\022\037\\\210\310J\207\226\205?J\226z\230\335\235d\250\324\227\351T \224\354\364*ZI\367\221gG\206\312\334P\260\273N\n\331\307\035o\233\201m\002\366/\001\353\261\242\261+\340\211\r\266G\366\304v\246\375\016\3670\272\210\350"
+	.string	"v\267\020%v9\003\036`\035\232\273%\036Z\257\304C\333F\220`dR\200T\t\306\001\024\032\007\b\031\273\334\245\030N\n\272\205\342\365B\022\203\305I&\204,\rW\001\247\026#@L\271\312\354T\232\t\265(\252.x\201\312\0316WJ\r\261\377vw\255\233\341E~}\351\324\364\343/p\360\250\360q-\305\006\017:\034\f\364\211\336h8\0206W\207\323 \302\265\301>\227\306b\217\004\007\330\005\362x\260k\302\355usj\201\347\313<\265\3036T\214ION\205z\216\032\246\\E\250!\376\263\244Si/\020"
+	.ascii	"\3571\226\020\032\241\0162\fEe\225\271\325\321J\023\tD\001\215"
+	.ascii	"\353\t\341s\031\345\252\361\023\313\302D\302UU\r\351]\005\n"
+	.text
+	.section	.gnu.lto_printRxFailsafe.255.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\242\007\335)"
+	.string	"\272Kx\020C`\246\316p\223?;1\275qy-\024zeI\264\326\247U\232\321a5K\025\"w\201\340\214G\301O\033\260\201\241 \216\013\367\355H,\375B\256\336\302\310\352\317\017=3\374\255\227\b\331{\357-e\222\001\366"
+	.string	"\332"
+	.string	"\364"
+	.ascii	"o\373\333\376\334\272*|\331\320\020\307\004J\331.[\227\271\212"
+	.ascii	"-\327\035F^\306\332\034\371 \202\361b\270\314Ul\355\27219X\252"
+	.ascii	"\310P\377e\277\266\277\237\273\013\006\206\020l\271\206\371\352"
+	.ascii	"\306\334\260\374Y\327\345\323\317u\241\376\344\337\356v\232\f"
+	.ascii	"AU]\274\f\221\342\345\267\030\317\245\353hh\005Ck\022\245\376"
+	.ascii	"\334\245z\336=\226g1\376l\306\366\326\325\310\031\267u]Fm\002"
+	.ascii	"\365\247\360A\364\247\371\"\364\347\032w\355\034\325X\275 \304"
+	.ascii	"\221!\275\374Y"
+	.string	"\327u\330I\226\350\346\362\233\262\361j\212\236f\263q\257v\004\312=^W\315v\242\007\307\337\350\0203)\274\341\330\363\265/N\243\3708\332\343\247/\254\307M\323\211L\r\017\241\260\032f\320\315\221:\177;\337\b\003\343\376\332\235\224r_vka>\316i\205u]\227\223a;\276\275\357n\331\356\232\331M\221\002r\307)\374M\203\276\271\177\224\362\305y\313\324\357\277]\252\217R\016\315N\r\217\006\347u\235\r\273\"\275@V\320Oo\352\335\024V\374$\203\016&\251\350\270\303sl\257\335\245\027\267\331\356\221\374\210\315m\227\355B\030^\3147\352l_\250w\371\237\356\366u:\227\277\001\203\247\375\n~\3667\035\314\227\351i_a\312\273\344\343=\220\362*\251\274I)\257\001\037/R\312[@\345=Jy\t\370x\215R\336\240\312; \345-Jy\211R^\001*\357P\312\033\300\307+\224\362\002U^"
+	.string	")\357/\345\365\245\274=\225WMy\323\036/\232\362\236*\257\231\3626\312\313(\357#4\330\363E\327%nH\333-\327\034y\202\3266'\334\223\213\371\331~\267\037\314\315\335\303=\314~L\035\2543\240\217\247\204swF\203\315\211\272(\357s\027\320DC-\200\316\222\241>\031e\235\2253%\376u\200f\352\275\234\f\347\241T\363g]\217OnP\217\277\262\340\347\331\034<\360\223k\256?\332k\205:\300N\275\356\303\204=\335\341\2000W\004\t\364I\022\350O\241\206\232\003\007\240\201}7"
+	.ascii	"\032\r\242\234\263rv\332\361\365\257S3 e\216d\005\276rh\257}"
+	.ascii	"\335k\216R\324\356\365K|\r\022\265\017\3673\217r\356\356\354"
+	.ascii	"e}\304\364\230m\266\374\023\250\331\315e\f\035\332\0340\006\264"
+	.ascii	"@\026v\332\303FA\004\355\264\217\304C\373H2Q}6j6\226\207\304"
+	.ascii	"\3335\3613'\324u\005\223\2607c\\\202Bm\322\325\300<c\252\220"
+	.ascii	"e9{zwT\363\032$\334\020_\356P\355\324\273\304\"?\331\255 I\305"
+	.ascii	"\215\373\251\241\372\034\243\353\006\355\324g\013\334\251&a\261"
+	.ascii	"I\310\325$\274\262\"V\305\320\032*\006\2230l]\021\271\\P\001"
+	.ascii	"\213\251\326\013\021)\260\254\246\210T*|!^\\q\021\253\250\246"
+	.ascii	"\226\266RXUae]\270\242\302\302\"\252\270@UE\334\272\262\"J\305"
+	.ascii	"\320:Z\261E\364\320\202\005\327\224\272E\007VW\305!\226\025\221"
+	.ascii	"\305\260\250\2655t\020\334\254\026TZ\303\027YYZ\303\337r}\227"
+	.ascii	"\355\325\256\256eY\357\360\320\350\2576j\233-\020\r\332k\022"
+	.ascii	"\267\004\331\306{\343o\357U\211{\202lC\207}\265\367\224\304)"
+	.ascii	"\221m\314\240\205}\203\337\240\321\001c@7\327u]\323\037\006\312"
+	.ascii	"\324\020\372k?\321\244\221}q\036\243K\007z\251S3!e0\034o\320"
+	.ascii	"\201\244V\n\224d\307\300\235Q\313y(\343XP\217\017\263\340'\007"
+	.ascii	"\261\366Z\2446\320\251Y\020?\035\336\207\017\322Q\027\320s\324"
+	.ascii	"\217\273T\020e\035+\274\334\301\346\344T\342\242&p\301\250\t"
+	.ascii	"\344\215\370\035;F\003\002\200\207\250QD\305\210B\304\320\310"
+	.ascii	"L\220$MZ\003\240\002\221\271\2629\021P\251C\316\225\246\225j"
+	.ascii	"5\210Pg/\242d\023\201i\272\021\242\3700:\024\336C\244\376\273"
+	.ascii	"p2\020\3779\351\266Jj\214q\222'\021\233\003:f\226D\001r\232\f"
+	.ascii	"$\371\006\326\220Q\373\024L\2324\034|\273E\306\341\220B\244\264"
+	.ascii	"\212\310\255\236\003-\255\312\001\337\334\243\220\3535\200\311"
+	.ascii	"A4<\271\226\036\034\205C:\237\334o 7\361O\250Er\036\355\3506"
+	.ascii	"\346}\300\210\227\375\340\334\325\307\370>\013`\017p\304\244"
+	.ascii	"y\340}TLv.\034\353\nU6\224R\354\262\204\017\367v\216\2108\225"
+	.ascii	"\313\367\263\247\320\272@\367<)\026\243\336\375\232vm\225\270"
+	.ascii	"v\332\321\034\324\243)\277\r3\203\240\352+\334\0061\255\035\215"
+	.ascii	"d.\326\021\030/\004\240\310\034r%\"\024\254ZV\342\231[\230&\217"
+	.ascii	"s\222\022\206\200v+5\3608G\273\346\027l\253\203\341\031\0132"
+	.ascii	"\"X\374\316k/Y\037\024\350!H_\007\375\003"
+	.text
+	.section	.gnu.lto_cliRxFailsafe.256.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`l\f\355D"
+	.string	"zx\274\032@@dR\007\377_\256\n\211\211+\331\252\242j\177\225\340d\016\214\020\261s\325"
+	.ascii	"j\225X\207\233\254\220@\341\264\347\340\017\362d\366\377\277"
+	.ascii	"\204w!^R\244\016\240\246.\210\332\026\262\331\275w\222)\005\232"
+	.ascii	"\001s\001\236\001=|\023\346\371,\3733\020\265\254\253\215\273"
+	.ascii	"y\375n\306\221l\232\315\234\242k|p\213X\004\235=\256\356\324"
+	.ascii	"\262\241\201#\n\025H\211\240\263jl\034\225\323,D(g\205\017N\203"
+	.ascii	"\237i\257\353!\232\035L\271\232\335L\013\036$\255\240\263\357"
+	.ascii	"rN\327\303\007\021^\237\033\273q\b/\220_\316\323,/\343q\257\233"
+	.ascii	"\301\341\271\231\203}\360\004\371\345\f\265r\266!\004\235\225"
+	.ascii	"z<\325\321w\345\270\333\341\\\314\353cvx1\347(vmr\2362h\003A"
+	.ascii	"g{\352\306\326\331\240;\265\316\366\333\335'\325#+!\340\375q"
+	.ascii	"\312-\3129#\177J7\371:\365^\361\353QP\306'\247\246\"\323\222"
+	.ascii	"\022\321\035\n\223\202\300\226]_\n\277\355fJ\217\202\242\273"
+	.ascii	"\342\306''\240\226\332\231\025o\252B\251\254G\252\024\027\007"
+	.ascii	"\250\235\2619\223\335\322\232\265&\333y\025\272\266\002\337\376"
+	.ascii	"\334\374\r\232\206\225\324\316\326\234\230\207\032\306\255B\231"
+	.ascii	"\330Y\202\207M\336\240J\260\020\250\245\205*%\244v\326\346I\353"
+	.ascii	"\203:36^\205&Y\211[\372\336\374\r\212\206\203k\013\305\315\024"
+	.ascii	"\257B\321V\nt\332\364\\\017\t\006\256Nhj\366x\025\312\266^\355"
+	.ascii	"\311\222\304\251N\334\256F!mO\257B\253\254\013\374\334$\362\272"
+	.ascii	"&f\327o3\364\303\253P+k\0057?\0169\235\34323&^\205nD\374\203"
+	.ascii	"D\\J\311\254\307z\3149;\235\017x\203z\301\030\250\225sn\3744"
+	.ascii	";\363\236\362n\237v\267]\267\320M\016BO\232\242\246\026&\376"
+	.ascii	"c?\332\304\347[x\366\217T\227\3416_s\316y\375\250\217\265So\341"
+	.ascii	"\251z\244\3315\2330\361_G\341\377\003\337\375\232\300\376\354"
+	.ascii	"c\217W\266\021\013\275\251\255\237q9\024\301'\376\356\024+\260"
+	.ascii	"?\377\217\315W\366\324\343\007F\323\3408#-\361\3377\200cd\345"
+	.ascii	"?\332\356T\212\220\360I}\224\246\321\372\267\210\373C\206\033"
+	.ascii	"u\021\023\370n\026[\330\237\376N\347\376\243N\214\037#?\262W"
+	.ascii	"vO\231\370\243\335\036\241\317m\332\037\245\333\202\253\361\316"
+	.ascii	"rq?h\200\364;o,\237\343\315\300\343x_Y-pq+\3607\336\t|\214\373"
+	.ascii	"\201*G\343m\300\305]\300\247\356\004\234\2157\225\317yO\271\270"
+	.ascii	"\245\\\334Q.n(\027\267\321\305\375D\304\355"
+	.string	"\344\342n\"\342.\022q3\021q/\271\270\225\\\334D\027\267\353\342\036*\341\026\272\270\223X\334A\"n`\213\273uq\263.\356\025\343~\0277nq\373\005+9&\0363x\200\236\3174\013\371{\224\371\330\273+>\307=\216\273\032w6\356w\356o\334\321\270\233q\237\363\244no\267\343|\335\303\376\362\275\346!\335\363\222s\356\341W\367PN;\2359/rT\241*y\221\327\256\027g\307\232\221L\363\331R\224\355\f\334\242/0\317\353\026*53\354\3664\355k\334\316\361\234\032/Em\202\311q\246\340\211l\"\351\036\223\317\\\023\266\357\301+\370\306\315D\305\272\365\037\274\363\371\n\246\312\024\017\316\334\241\377s\177m\340\376JH\352h]\002&\r\361\321H\021\341'\032\231\333t\254w;\216`I\345\323J\301\263\0336x\266\f\325\252\301cF\322=\344/\311I\0079\357\222r\333\232\360\243\370"
+	.string	"\2237\r\373\221\342\361\221\275\362\333\\Y\223\364\321~\237\321bU\225\241B\211\363C\206\033ya\346\373dB\033^\276P \254\345L\226\345l\343\214\225ot\312\313\306\326:\213\365\001\330\356\030\374\360\001\310\261\361\021>\203_\353Dz\335\202\220\256^\370N\307WD\331\366\232\\\206oPD\301\217\"\362\253g\313\274\001\264"
+	.string	"'\275\313qG\257\333\325Z\316M\177\2663\362F\257\225\365\275\362|\335\3327\313\273\005\373\363\352\203\237\364\253'z\327\336.U\202\357z\036\254\312\261\331\225%Y\272m\352 \002\356h\255\236]\276\301\023\367\247"
+	.ascii	"6\020\346\025\203\375i\365XO\232\306\207}\254\005\376\202/!\235"
+	.ascii	"\213\343Cw\307\304\177d\274\320\230\027\317\336`i\"\301\341t"
+	.ascii	"\277^\234\020\206v\352\216\"&#\270\234s\326 \367\313\320^\305"
+	.ascii	"\331\336\320\001\373\363C\353,\360\3333\351\334\2271\355'x\266"
+	.ascii	"\316\332\276S=\330'\267\266\347\204\363?oj\313~\201o\354D\322"
+	.ascii	"\324\303nJ\373\321\242\217\265U\377e\354\376\342\352\260_\365"
+	.ascii	"xMS\211 \201\375\311\376\321\201\023x\003\357u\001\035b\303\210"
+	.ascii	"\021\030<d\b6\261\273\252\216\\UG\033UG\030_[.n\2101\265\027"
+	.ascii	"\026\r\257\032[`\310\030a``a\\T\355\205uC\fyC\314)\331\025&\242"
+	.ascii	"+Y\203F\222(\303\2232p\324X\327\244\r\030['\222b_6f$\305\\\261"
+	.ascii	"d\r\256-\261-\257\f\311\25600\242X\r\031\017#\031#\306\226\027"
+	.ascii	"\027\320\205\215\026\237\214\361\005#\t\2665\242\013\214\013"
+	.ascii	"\330\\X_0\270\2201\276\266\300\220\\b4\220X\306\016\223\221\024"
+	.ascii	"C\326\b\013\023C\016\247K\327Z>\363\243TH\251_\332\245\231%\024"
+	.ascii	"\2165g\265\013t^\364+\203\377\034\tH\320\030\243\026.Z\271\247"
+	.ascii	"\301T^%\2045f\260\351t\b\234=\320\343u\342:/\372\241\362\307"
+	.ascii	"\347|e\220\020\232/ORk\257\217\262`\323\2774\245^\030\275b\347"
+	.ascii	"\214\344D\001C}\324"
+	.string	"\027x\317\303\321W\210\200>\257Y\260\351k\b\206\274E\216\316Wv\326G\341\037n|\250\027F\333\366\232Mp\020\177z\343?\244\346\233\323?\251\215\021\253p\274<q\342\304\322\221*\3722\246U\312\3355\351\271\247=\251v\230\220\377T\347\306N\273\340\251\276\254\352T\317.\341P\211\373\243\0027y\273XpF\230I\326\033\331\356\226\337\364\356\214\244d\314\215\313<\277$hE\016m\244}_\306,\361\237\313,\213\026\231\310\340#cI\325\274<F\212`=\323GE\255\3309#-[6h\206\230\216Pa\202\300\221\333\022\202\267\274.zr\364\224\226\320\360\331\330P-\017\233a\250?\013)\375\322SE\253\360qF\232\"\276R\200\362\250q0\245\024S\246fFD\244)H\322\030\200\002\021\2422n\003\021\240\27536\222$\2054\006!\243\364\336?\027*6\034\374U\303\354\037.'\331^\277\027"
+	.ascii	"\372\240\301\247\254\261\034\032\232\356\021\030\315+\213cR!"
+	.ascii	"r\212\343\372u%\027\350E\220\207\201b\217qa \3135\244\376c\335"
+	.ascii	"\266\202\343\250(\006\314p\340\324\273\245\216\323\377\271\222"
+	.ascii	"#\276\274C\201\335:\333\264jn\337\232\244\235t\230\376\232\024"
+	.ascii	":/1\271?\001\246na\036\332\022\326\311\373\t\212\n?\216\315\221"
+	.ascii	"mq\372\3442\030\\)\330\n\260\311\035\026&.j\027R\024W\317?%."
+	.ascii	"\306u\240\370e%W\206;rf\210\365@\r\327\007\200th\342\031&s\270"
+	.ascii	"\213\202\013A\232\033\352\365\235d%\310z\326\210\254\300)\320"
+	.ascii	"\340\362b\233d:\204\277\300o\272\323j\206Q\210\230\364\001+\310"
+	.ascii	"\370\250\264?^\375\030\366\024\373\331jI\261\n\264\321I\261\276"
+	.ascii	"\254CP\266x\244\226\253\276\302"
+	.string	""
+	.string	"\261\302\314(\213\375\223-\001}\256\feQ\225!W$\375\331d\357,B\262\243}y\305V\323<p\352\304\2672v\260\034\t\360\263ti+\017<\343\214\276\366\016"
+	.string	"\323Az\2021\346\254n\277\222\002\320\247\036\345/\034\301\2050|\002\362&9\201\373.\352;\205+8;[p\216I&\232D\\\"EI\216<\264da |\222q\332I\017a\212\013[N\355Q\214\307\031{\207\237\265\324\307t7Q\320\254\246\202\205sK\306\037"
+	.ascii	"\302Sp0\027\225S\016Y\200\374\313&\220/\201\"+\240-\220\341Q"
+	.ascii	"\232C\201Zv<\2707v \276\3254\365\036@\343\302\206T.no`\317\273"
+	.ascii	"WD\023;\232m!\242i\352\321_\266\036\364\352\365F\373!\360\266"
+	.ascii	"\032\377\001"
+	.text
+	.section	.gnu.lto_printAux.257.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\013\2258"
+	.string	"\272e$\026AP\244N\007\323p\t[\273\316\314\001\306>\226\215!\241T\236\256'VP-\013\334\326\360\001!b\016m\344\317,`\373\255\0205@"
+	.ascii	"\245\341s\264[*\247\032\335\256\b\317\243\336$\311\336;\245\224"
+	.ascii	"\002V\001,\001T\001\317\036H\254\037\333l\203O7A6*X\214t_\326"
+	.ascii	"p\263\351\273v\323o\270\230\327c\211\256\211G\004\302\004d\343"
+	.ascii	"\205=\2219\331\"Cf\223\257\3316c\034\222AF<\347\260\370`\266"
+	.ascii	"\033C\3316'\313V\244\0033\030v;\rw\035\027;ef5:\236\314\234\354"
+	.ascii	"\332\232\247\231Fn\220e\235T\235\362\215\333i\027\231\371\317"
+	.ascii	"\360\360\023\303\f][\bw\366\030d\223\351\321\204\304\232\225"
+	.ascii	"q\253\272\235\262\363\2663\267\\\207A\366\334\017&\262,\\\035"
+	.ascii	"\036\313:\253X\352v\372\324Jj\247h'\251\2352\2229\260\351\214"
+	.ascii	"%\223\360\024\242\244\033dY\366\352\247\260\200F\235\315FG\366"
+	.ascii	"\221\321\250\250\270\022\357PM\321w$7\232\216j\003\223\200uk"
+	.ascii	"d}\204\376\331 \223\366Sk\202f(\244\304\323uI7Ja{k#(86\267.b"
+	.ascii	"\322E&qjK|u{\323PqjJ\234x\244o\303\261\265\365\260\375\324\332"
+	.ascii	"\232O\351j\227%\351\024MJb\367g"
+	.string	"\\;C\037\374eQR\\Cs\0245p\247oK\3635\224\237Z\0224\212\311\2235\375\246=m\315\314\277\353:e6\323\310\021\302\261\275\265\0179\260,\313\276\\ckFj\346f\300\314\\\230\327\245\027\276\300\021@2Aw\366\230y!\366\257\360\026>\335C\323\222\364\3028j\277\177\243\305%\275\220\251\276\277\337t\210\270\226M\022\020M\2422/|@\274\271'\317F\227\360T\035\341\231\271dx/)\274\322R\020K(\210\366d\314N2\177&s7]\031\323\307\037\205\271\304u\036\321v\315\"\272M3\210\353\334\241\365\232\261z\257y\203\206~6ch3\335\027:\257\331B\223\351\256@\241\317tK\350\271\356\b\327\331\352:W5^\363\203V\323L\345\240\31747\270\316\f\256\363\324\352\274\340:+X\235\245\256s\202\353\034u\235\241V\347\247\353\214\340:\037\270\316\006V\347\002Eg\002\253\363"
+	.string	"\242\263\023\321\271\351:3\255\316K\327Yiu\026p\235\223\256s\200\353\f`uF\272\316G\327\331x\235\215V\347\242\242squ^\211\316D\242\363\275\316C\325Y\275\316\251\352\214\016\235}\350\334YT\201\311;f\236C\036\320\311\026)<\304\326I\363\256\264^\367^\367\263\333\256\273M7^w^\267\232\276\314z\334{\r\247\371\270\030t\232@<\017B\".\232R\271\226Ns\216\370Lv\225\252;\312\263U\336\r;|\325\2471Oy\325\027\377\350\223^\351\231\236\352\271\t!\263\f\341\344xy\223cY\264^\"\267\\\264v\233\352t\370\310.\310\246\367\222Q\326\355\311x\351\231\006\345A\262&\226\336F\013G\300+\201\351@Y\002\036H\373l\316\225\371\351"
+	.string	"\237\324}\032\300\007@z"
+	.string	"aZ\360\017\322\223pnhf\374#\2647\247\346=\325\350\215\377\210\320\342\212\336\350\033)\246\371dM\240\302X\275\307C\247Uz\212\276\365Z9\3159\020\255GD\361\201\264r\b\321\273~\207_\231_\350(\0231\223\350\277\254<@\016\231X\277\261\264s\232\013\355L\201\033\342i\254O\331\346\\)\323\\\306\004\016\252\317L\307\324\r\237\226\315i\31309\021\353{\311\211\366#~\037j\365\b\231\374>3\n\025\336\313\r\337kN\314xE\323iqY\326\214\002\267\034\344\322\305\255\322\351\375\016\324\3525\347\214\356\340\323\327\360\357\306\212\230:\352\017\325o?J%\350\247\337J"
+	.ascii	"\216\341-<\363\213\243\367\022\375\007d%L\235\263'c\377\013\217"
+	.ascii	"\341\233\257W\3205\377\240iI\272Y\237\2206\364\231\334=\324<"
+	.ascii	"\246\340i\307\330\321I\353\350\265j\035\275\376CX\215\343\330"
+	.ascii	"\r.\243\035`0\036,\305\026\027\215\257\256\032\267\253q\210\241"
+	.ascii	"\220\361\325\265u\344\232\261\232\020\2531v\214\301\265\205 "
+	.ascii	"\254k\353\013\314\303\027X\227\3301G\227\230\026\026\327\026"
+	.ascii	"\230W\023\215\260\243\t\033^c[\227\265\254\272jh]}u\035\275\256"
+	.ascii	"\264p\204]Y)1\230\r.\034Wb``8\256\212N\266?\n\232\276u\206\234"
+	.ascii	"\204\202e\237\254s\364L&~1\"Vy&Q\3369\2471j\324\340\033M\023"
+	.ascii	"\251<\333\224wN\341\035|Z\007j\224eY\326\250C\245"
+	.string	"\372\022\217\244\265+\003x\346-\351\205n\264R\265\330S\215\362\2568\342\255\254\236\300#\370\004\257\340\247\030\\y\360\f\276\225\211\026\374\224\013\0012h\301\263h\363H\275\002_fI=\213\366\257\031\365\t\240>\352\351\241\302x\020\345\323\037\341\201G`\340\017\374\317)\360\006\374,kJ\217\233IQ)\360\375\326\002z\031\021\002\317\242\005,\032\360#~\310\224\273sVp\300w[\333\247\003\007\227\312\242\210\004y}S|\257\245S\262>\223\233\257\211}\236o\312\273T\275\203\236K\224w\317\035\246>\370\264\346\353v[\nJ\224jxF\337\3017\3704\020\377d\372\2408\211\3706r\210\210\3237\2346\200\301\250Q0(\021\202\204Dd$HAA\223t\240\002\221\261*\325\001\021\360\254T\020\322HR\2224\006~fa\036\r\375\322q\202@C\372\037\202\t\270\347;\r\033Z\371QE\026g}\2348"
+	.string	"\341\337\024A\222\373Tq\031\226V\242\"\233\026QE\340VST\353\316\360\025&Z\377\231\260D\243\t\006\321\211\261P\362\311\223\211\343\3408\035N\342\210\003JI:\033\210K2\030'\033\255\206\017\035\202<\303\274\"\304\255\225\227\024\265i\265O(:\203\b\034\302N6_\340!\0264\210d5VB\235%;\006i\213\232\346v\005\323\235\251V\216\005='\0218=\200\375<\025\307T\277\314\263\316\321\321\221\t\325\032T\336\203z\016\200Z\362\225\357\241\261\330]\305n\350 \304\370D`,\212\226\rQ\024\274\\q\244;\354*\034\266\006X\261\330\230\202\251\323v\020}\261\376\377w]\346\236\347\031)\203]\222B.\372\031&\226fD\332\265\033\320\206A"
+	.string	"@YtI\313\336\017\212\342m\331,?\325\235\262\331\317\264G\316~\024\276j\330\007o=\335\246\304\020w\227\201\3121Y\036\017\0170\355\264<,1\375X\207\005\246g\006\032\f0Q\274mGM \304\351\023\257@|\261\f\001d\0327\300\264`\223\032V\236cC\"Xj\337A5\354q\221s\263#\333,*\3373\334\313"
+	.ascii	"\342\320\310\034M\371\207\031\235\n"
+	.text
+	.section	.gnu.lto_cliAux.258.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`9\001=\016"
+	.string	"\026[aE\020\221\223\016|\252KI\254"
+	.string	"\304\304\036\277\330\037qe\331\0013-\352\362\336\241\002\352\235\366\217\373\300\356\326\372\177.\345u\002\2622;\211t\265\"\3143@\221\202\2120$\005\020\276\255p\321zk\367&[\246\024M"
+	.string	"J"
+	.string	"O"
+	.string	"\340?\363\262\363\001\363\322$\273F\201\222--\230\211a\262\342\306\356bq\304I\227WT\222\177\227wx_\351\262\223\362\013\300\227\362x!h\265\250\021\360\241\256O\312\204w\227\353\207\357\244\312i\260\273V\357C\271\347mG\260\375\300>\210\006O\032E\330\217a\030\206\216*\373-\377<\370\313K\375\316Q\274H\235\240\234%\334M\2058\226F\272X\331\276;\\\205\025\220\250I\261\273\236{l+\350A\306\307\325\376\312YHo!\271\307\256\352Ef\027L\340\003\235K\007g\235E(\332P\3315\335;\313\376xL\326\261:\241\241\261\262\273\f^\016\243\371%.ma\323{\333\274\3741L\233\353\364\236\017\263\202Acr\225\233\226L4\207\371H\2015\003\2457\346\250\214\366h\203\336{\f\020\223\343\204M\013\025K\016\276"
+	.string	"\032i!\035\007\222\211\260\254\202\001md\023\321\270\020\204\020.\3438\003m\"\0316\262\2058,\023\2150\320\307]\006M\204i\350:\021\346\001M\2776\252\354 \004h\3232\305\323\265\273+\t\250\2143\332\022&H\235)I\255.\017\365I\246\0172\003\032"
+	.string	"I\231^\t\377.\306L\274K\nWz\021\301A\242\335fX\f\034\314\032D\267\211\252\370\202"
+	.string	"\t\261\232(\031\354\023\2561V\270\017T\003W\300\334"
+	.ascii	"\025e\334\345\235M6\205\271F\253\240"
+	.text
+	.section	.gnu.lto_printSerial.259.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`l\n51"
+	.ascii	"zU\360\022DP\236N\007\003\022x\034\276!\37105\004\316~\306AR"
+	.ascii	"\b4\fY\244(\311\314\312\236\240\202\003c\346\254 \325\325\253"
+	.ascii	"\020\354\213\326\001 \016p\fl\321*\020\376#'\350\252\316AQ\333"
+	.ascii	"\273\333\336;\311\224\002\030\001\005\001&\001\355\022\242\276"
+	.ascii	",\t\363\250p\276P\032\237%\336\211\313\260\201K\334\317\235\257"
+	.ascii	"\333\263\264\377\265\261\245\250\224\356\027\226$&\215\317\212"
+	.ascii	"\321\351\341\225\353X\332\373\332\350lw\363\321HbJc(\234f\nh"
+	.ascii	"W'\216\245\013\234m\024\256\263n\354\356\327\253q\205-D\036\025"
+	.ascii	"B\226:\025\245W\261Q\024 fZ\331\021\345:\333R\327s\267\333\371"
+	.ascii	"\235\322\361n\364\033\307p\177\200q,\215\352%\327\331$\027j\235"
+	.ascii	"]=\250u\266\225\335o\212\310b\261)\352\233\346\225:q\034\037"
+	.ascii	"\337H\273\276J\275\337\254t\370u\213-\273~V\266\357\271\022\335"
+	.ascii	"\227ea\037T\314\341\265h\306C\215\237\341\301\266Z!\302a\363"
+	.ascii	">\317O\3502\277E\320\326\334-\002\361vE\"\034\003\345\007\332"
+	.ascii	"\\\225\332\206d1B\3132\013F\275\203\b\207\246\346\353\nu\270"
+	.ascii	"\205\216\021J\266"
+	.string	"\n\235)q\372\237g3(3\277\3679\033\235\002\332U\341\320\326<\027-\304q\334\331\tE\3636zw\363uwY7\f\024\231\t\035\303=vu\213\037\316=M\r\372\\?\332\036\326\346\367\262\262\206\231\355\364P\366\357.a\"\2733\377\2047f\243p.W\236'7\347\201H\n\206q\314\264R\341[\260\3348fV\001*\325\262\246\344\346l\264\316\372\373\237\257M\306\n\333\270\335\341\215\345\304\3373\253n\371\366\311\016~\201\037\277\233E2\273S\352\205\236BxT\017\313^\254[*\226?\332\355V\210eL\372\343\272#XUy\236;\225Wq\177 \345z\356\016\034\317\375\350~\336P\316\347\255\340\311\311\365\274\233\334\334Lm\356%8w\0028\267\222\233\033\301\233;\t\316}\300\315m\340\315\215\004\347>rs\027xs\023\200s\033\271\271\213\336\334Dm\356!8\267\020\234{\200\233;\350\315-"
+	.string	"\316\r\344\346\016\360\346\006"
+	.string	"\347\376qs\373\274\271{\340\334F77\374\346~\335\334.\233\273\350\346n\335\334l1\367Z\314\375l\356\334\346T\206\371\211\234\222\313N&C\242\367q\342&\316\355\256\370\224\215\377\363@?\340\205~\350;\343P6)\302\025\226q\263\213\3432w*\237\270eI'g\333WBQF\311\356l\244\2643a\342\266LvU\225\231\310\251\274l\032\372\250+T\274\272,v\241*\307\310\251\304&\241wA:\275\272\023\216\347\316"
+	.string	"\001\037$\305\355T\353\b\320\253\246p:s\200"
+	.ascii	"|\200;\227\023\007\021@\235\226\303y\363\323\363>\312)\336\206"
+	.ascii	"\315\232\236\275\252\0137\274\340\266\253\361\302\fko\340\320"
+	.ascii	"\272\223C\353\254\361\221\216\004\276\017\2777\363\264\007G\363"
+	.ascii	"\241\002!r\302\231\343\373~\207\316\257\016\317'?\275\373V\037"
+	.ascii	"\366V|\367\275\370\336\354R\365\355\027\243\202\323f\236\261"
+	.ascii	"\234\330\013\234\375\252\1771\315\300eNl\243\334\343=\330\376"
+	.ascii	"\257\337-bDv'\3737\336\312\\\314\214&\3030\310\n\203T\353\257"
+	.ascii	"n\234iN\235\341zrq\314t\247 \322\325\200\361\221\345a\376\263"
+	.ascii	"\310\004\367\234iN\204\214P\257\375\350\324\251~h\212\031D\302"
+	.ascii	"\315\245\305\224"
+	.string	"\204\364\305\205\0256c\313'\351^`$X\304Hjam\265\200\301\270\302\260Vli\bb\221\\\021\243+\003\027V\322k\353\253\347\305\027\026\b\0310\302\264\334\316j\220\344\312:\306Hb\3018fy}\035\033\bu\227\214-\257#XW\227\327\321(\215\375\343\366\334\315\002EZ=\034\373%\374\321~\221\270\021\346\250v\232\323\334\317^]\247\367=\177\345\250\325\3464K\375\323?\275\317\3378V\3268\216\343\267\330\364\275\256O\357\364\317nw\032\255\202\217\360>\346\360,\013\365\334\22691sq?\332\336f\020Gs\332V=\0305Os\312\272\027\207\372\347`\216\346^k\365\275\262O\337\364O\243?\372\003\257\364\t~\211\211n\215\333^\254\241\236\351\333(\225\314\334U\022$K\037\245eM\356\002\003#H\247\"G\206\t\336\235\320iQ\332\3458\"JI\217@J\036\362&$\251\016C\016\322v"
+	.ascii	"\351\r\334e\26655\244i\265CN\313?\216\236\210\300\027\310=\320"
+	.ascii	"\240\004\336\277\320u\t\221\317\262\231\321\023\021}Q\326\361"
+	.ascii	"!\200\276\250Q@&\021bdDFD\224\246I\032\003\320\002\221\241\241"
+	.ascii	"q\003\021\020\2513\016UIY\310n\323H:\362|\331\005\234\202p>5"
+	.ascii	"\221>\270\243\220\305\341\370\213G\036\271\200m\341\004\373\\"
+	.ascii	"\307\366P\215\355J:\215r\267<\313\376\302{\nL\327\2275\b\243"
+	.ascii	"\3637\202\275\305\240\331g\032\321\b\344V:\252\255\262I\277:"
+	.ascii	">\270\357:c\200\226H\024\316A*\244\305\020\211\004\343^3\220"
+	.ascii	"\026w\025\267\325\346\260\223t\024\200\351\237\271\017\210g\362"
+	.ascii	"\222\210\221\207m\262\364\207\022\275\017\3159\340\270\375\357"
+	.ascii	"\260\346\301\315N(q\352\212\253\201\200^\223\204\005)\021\337"
+	.ascii	"\016\260@.\247\034&\303X\017\022\311h\237a\223{\230\254\007r"
+	.ascii	"\005\344\230\003\026\213\350\"\017\t\303\221\354\0301\006\321"
+	.ascii	"%\222m\ri\276{uG\346\325|\200\005\323\342\213\213\030\\f\346"
+	.ascii	"\265\202\007\\\024\250\b\222\353x\224\307\177\335\260h\354\365"
+	.ascii	"\n\003\256\215\344B\310\374\324\342\"\316D8a\256C\213\247\236"
+	.ascii	"#\027\326\232\246\244DT\204\206\3126\301\220\366\232\031d\332"
+	.ascii	"1\364\271rm\017P\2000\303\250\234Z\351\316.\3028o\246\211\306"
+	.ascii	"s.!y\342\036\245\003\236\271\321p\200\001\306\177\200B_\200\035"
+	.ascii	"\035\363'/\035D\177.-V\353?\267\024\206\210?"
+	.text
+	.section	.gnu.lto_cliSerial.260.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\260\r\335F"
+	.string	"\332y\024\033>0\240R\007\347\247\264!\250`\275\312\333=Fhj\316\001\314\334\227;\f\210\271/\375\327\n\251\260\030\027\276\343\241\002DBF\202\302`@\231\266\267\222\216\346\327\331UVi%\266\311N2\245\247\001\205\001\240\001\330n\242\3614R\017,[j\263|\333\234\251-\264N\254\007R?c\346\231-\347"
+	.string	"\224\375\363\2404\323\303(#f\207\263\313\002ns\276jP:\262]\214\217\221:\231&\364\034\227\375\007\235l\232m\316\331\202\322\221S\256'\275at\270Y\356\232\343\236\326\302\355\036c\316\327*G\266\203n|\345\221'\201\343n\337s>\251\367\365\360\243\234\355"
+	.string	"\325\344|U\320\004\224\216\354\253C_G*=\351udK\273\3710\255\3453\007\331\273\2661\2149\347\253\177\322\256\273Wo',u\251h\024\324\223S\023\323\222\022\024@\022\322\221Q\321\223\310\331d.\225\311\027\351>\226\266\303\235\271T\264.\016\214Gu\031\376\365\201rD*\337\036~r\235v\264\034qD\252\236\333`\016\215\035\037\234\303NN\342\276x\023S\336\322\235\222\225;\f\235\002"
+	.string	"J\022\225)\030\211\356(\251egx\244\217Q\224,T(\270\210\314\360\255O]\234\027\1772\255\211\332<'r\021l\327\brDj\325\205\276\335M\275\r\035vJQ\362\032\345\234\275\216\232\3445\242Vq\233H\230\356\0046E\336\274\215\007@\244\036q\361\024<}|\320\003d\241\352\341%\376\342\312"
+	.string	"uqr\236t\243\346\034rqD\252\234+ \t\023\3006\374\026q\244\2334\207\306\316\023\216\315M`G\313\221&\334\032v_k\366\315^c]\\\237\277\213\240Z8\344\t\247\346B\3454Qt\254c7\2704\214\223Z9\347\306S\2708\357)\357\306 \272\273JwSJ9g\b>\252(6\312\241\341\307B;)I\220:\336\005\377h|\346\004\300V\337-\005S\001\373t\301#\377\360\350\264\321\f\033\260O\255~\212\201W\275\202O\326)\\d\333\222\206\037\373\t;\275\263o\225\273\032\307\352xB\231v\177"
+	.string	"\201\001\361\264\215[6O\313\243\335\272L\270\275\307\333N\342\3655~\230\002C\005\305\3701\356\345\214V\350\206&\332\2518\262O\244\300>M\361:\322]\305\333\275\242\005\366i\373_\227@\332\266\366\013\324\306\344\337\3326^\177\027~y\3240\2416\302U\337\275\305\205}\352\357X\377\200Ge\334\252\375Y\3675\r\277\265\333\275L\234D\270~\273n\357s\307\240E\301\t\275\263$D\200\340"
+	.string	"\313\303x/p2\336V\n\374\352^\305\304M%\300\005\315xKE\243\\\320\033\352\211\b\267\323\022w\323\0227S\023\367\222\023\267\322\0227\264\211\033\200\023w\322\0227R\023\367\221\023\267\321\022wQ\023\367\323\211\233\310\211\333\351\304\335t\342f\372\031\357\345\022\267\262\211;\311\304\375.q#\227\270_\211\033'q;\007\253E\2779b\262V\376\3165\277=\032\312Z\244\240\025't\027t\017\343N\306\335\214\373\031\367@Ov{\267\263io\323MB\035vYC[\031\256\246}\260\233\202M8\245v\315p\3111\207\332\275\0307\\M\177\334\236\304\352^\316\271\211\335\317\313\370\237\003zDn\366:\035\235\277\264\226g\321\021\016T\210\232;B"
+	.ascii	"Iom$\022\r\320c!>$\"\201GF\256\233\275M\234=\353\233\257T\007"
+	.ascii	"\017\266\321\375\357\013\226\242,#\2165[\332rW&\217B\0339m\317"
+	.ascii	"\267V\363\327\271\324\035\031C\242\267v\323\315^\346{\235\337"
+	.ascii	"\241\032&d\366f=\363\225\352$\306a\253\246\rr\3772D{\206\017"
+	.ascii	"u\234\265't\234\217mE\305P\373!\354\310*\241V w%/\311T\214\335"
+	.ascii	"\315G"
+	.string	"\231\363\231W\335\227d\303\351\225\2343\225#\247\336\377\276\b\321\256aGl\210\210\022j\363\255\255|\344\217\325pA\3229e\316j\022\332\001y )\022WJ'U\362J\225\374R\220\352\223\037\306\304Y\364G\237\361\276O\365\215\333\344\336\317z\234\346\n#\233H\255\330\247\357OIx\344#Y\343\334is\214\342\b\022\002M\323\374ad\276\265#\374\207Y\324\363\303#\025\341\275\215\0375\342e\265j\177\366sh\354`Y\276\265\361\240+\031\263\212m\330d\225C\275\033~\261\336\261\256T\314\032\266a\223X/\340\335\332}\237\036'!\274\203wkW\2765\217?=\204\177\3269\304\262U\377\211c\245Q|\352\007\377\277\307U\001\224v\247\214#\002\314\364&|\333\245U^,+R,\330\247\370\275\021\017\214\226\215L\337\240\273\344[;\nP\357\016\351n\366>\001\363\252n\273\331\373\364nZ\307*d"
+	.ascii	"+\340\"\305\303>\305z\207\203\247\247U{\363\034+\325\203&\006"
+	.ascii	"\r\326U`*\252cX\201m}\215y\335\270\022\373Z\312\341\325\025\326"
+	.ascii	"\301\213l\253DW\331\226\013\242/\037\023\253\301$\013+\243Q\006"
+	.ascii	"c\254B\327\027\330\026\016\2441\262\032\017\266\205\343a|\275"
+	.ascii	"\b\023\273@\026\34656V\306E\344\025\366\005\346Ec+D\027\r\256"
+	.ascii	"dsY}\201q]\205}m\321\270\342\032\273qe\005m\261\032^cWdbbcW\315"
+	.ascii	"+\232\020\327B\3734\027\"\365q{\024\253|\276=\334{\023-ss\256"
+	.ascii	"\243\340\201\356\3330\370\261-\340\242Gz\3503}\323;}c;\037\207"
+	.ascii	"\222u{\264l>\365\361\250ds\352\001GVyK\317\244iI\336\2529\311"
+	.ascii	"\237\265\323#\263\b\332\253\3625}\tA^\252|#p\225\216I\351\227"
+	.ascii	"\214(\375\216;\305F\024\370\310\0344\351\001\020I\312c\201\213"
+	.ascii	"\020A2\372#!F\277\343nO\243\013\034\207\341\212\036\032E\220"
+	.ascii	"\350\237\357m\216J\242O\n\n\332V\371\372\320\360cO\300>'*qA\233"
+	.ascii	"\024\b\225\336\234\233\263)zQY\030C\020\351\033\306\372\321\237"
+	.ascii	"\036\\\002<\\\360\240\234\242\337\314e\364\227"
+	.string	"\357\326k\276\034\200\026\350\321\317\320\317\323[\333\007\335\225\270\361\0056iA\375\324\273\275\001\362\0356E\370V\nx\251w\353\246\250oW\351\340\243\3576U\300\317\242\026wws\316\331))\372\255\024\375v\211\242N\007\350&\220\211\302\267k\024\375\250w\353N\340S\257\365>\350\"\306\034\336\301M\321\247\360\317:z\356\004\320\312t\f\201l\3635S\271;f\325\350\230\340\372\356\n\227\224\002\201\020\250QD\003\025SfDDF$I\2224\006a\005\004!'\035\226\007\021`\261Snj\322\024\2069\037\313\243\324\262h+\"\223\312\351;j2\320\037/\216\013\357 \005\"\243\266\345(aC\032F\373bz~\n@\225\367\202\032\\\332\021\317j\333\331\033\210\240\317,p\203/\351\373\361\211\\\356wI\277\037\352%Zc\377\257\217\350#6Slx\213N\004m-KN\314\247\354>]\322\023I\207\310"
+	.string	"\371\320L}\013\007z\020\376P*\020\037\304r\025\244y\215\202x\244\335\240\003 \362\\\030\306\250\364^\371(\314\203\005z\364u\031"
+	.ascii	"\315\023\013\221\017\302\034M\276'%\236-@c\023<p\320\247N\343"
+	.ascii	"\326\377\355\370\356\350\310\310\225\357b\211\212i\374?83 q2"
+	.ascii	"\242\217\212\031\213\316\005\276\330\275\326#\004]\355\034\007"
+	.ascii	"\352\242oh\347&\371\245\261AsD)c[\336\271\005"
+	.string	"\254\257hP\245\337\275G\263\231\210j\030\371\202b\367\234\362\375\333\354Z\300(\330\222\320\001RO\265\376B\201\224\222\002:\306u\0259#h]\feZ\257J\321\211\3157\322\340\335}\026\211,\345\351p_\314 d\363\006!\020\3243\217o\2156!\f_\024\006\230OF\032ii\004\313\255?\322c\201K g\335\312G\241F\"\371\323\373Y\\\352S\323F\376\001N\300\332&\275\352\277\225\240ZAn|q"
+	.ascii	"+\031\024h\205I\016\205o\305\261\344\017\350\267G\016\243n\334"
+	.ascii	"\007\232 \024\351\234-G\223\202\002qN\021h\3139\317\317\034\021"
+	.ascii	">l\266\360\262\234\243\372\f\201\347\314\263\260X\217\0160\312"
+	.ascii	"\004\304\347\351\020\002\366_H\270\330\241\363\030\347\n\307"
+	.ascii	"\315\231\263\242^*v)\361\006\250\241\305\025(\f\267\243\2475"
+	.ascii	"P'\357\344\273pG\266\310jG\235v\"\2671\250\353g&J\241\376TM`"
+	.ascii	"\220\b\312\313\034\272\376\275\2677\247\232:\361@?b\350\246N"
+	.ascii	"Q\003"
+	.text
+	.section	.gnu.lto_cbCtrlLine.261.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\266\001=\020"
+	.string	"F^jE"
+	.string	"\221(\035\3639\257\030kMl\316\275w \351\005E\001\360a\204$\206\242\037\257\257\204\220\376\317k<\372?:Fn\004U\350y\366\327\337U\325\372'L\032F\332F\363f:v\377f\265~B\310&R\246\024T"
+	.string	"T"
+	.string	"T"
+	.string	"F\340=Zv\020\367\350\235"
+	.ascii	"\367h\320\246\031X-\252\301K\f\213\205\306\356~\332\341\340\271"
+	.ascii	"\270i\202\376g\337\264B\3249\224G\023N\270\312\r@\230\341\272"
+	.ascii	"%\230I1\343\023\226l\240\223\017\255\317\236\030BUf\367`w\235"
+	.ascii	"\255\320uw\267=\262\355\300N/?\247i\325tn\351\007(0\002\206\353"
+	.ascii	"4\026\273'5\033\013\023U\200x\313o\3773s\374\022g\001\337\342"
+	.ascii	"\025_\327\376B\213\027\231\231\335\365x4\003\357\221cS\331I\200"
+	.ascii	"W!q\334\345\340B\201\367( \237\366C\\\004\370\024\313|\300\356"
+	.ascii	"+\305eW\266 \037M\375\354\020`\264\032\353F\252\203\353\350G"
+	.ascii	";\024U\326\374\223p\033\355\250\223\245Au\01753.\2520{\274SM"
+	.ascii	"\321\304VbJ\262\306\327N\217\202\323\353gE\213\301\272\221\312"
+	.ascii	"\232-C\245\302\354o\273\273\326\227\035\323\237\230\366\304t"
+	.ascii	"\347*\377\346-)\001\243\n\244\217\b\035\222\351$\332N\026F'\221"
+	.ascii	"\222\250\263(\004B\022}\" \037!\237\3104\362\205@.M\030\231\276"
+	.ascii	"S\251d\3728\262\375\266\372\332\304j0)Uq\234\264%\204\374D\254"
+	.ascii	"\006\214JQQa\356\340<\007R42V^\230\370F=\233\227\251\2526\205"
+	.ascii	"\221|\313\034+E9\2447\331\020% P\002\"\205\327\r\301\271~6\006"
+	.ascii	"\333\203\2205\217\266B\206I \207\020)\275\263\210fH\213\362\340"
+	.ascii	"U\f\241\201\2570\315\240\227\020_\252P\f\276\224\"\265w\274\001"
+	.ascii	"\346\030\222\034\205\246\330e \373\332e=\313\262~\023*\215\311"
+	.ascii	"\0355\270\221\027!\003\024\327\024o\3235\204\005\005"
+	.text
+	.section	.gnu.lto_cliParseSerialMode.262.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`v\001]\016"
+	.string	"V\233`E\020\221\223\016\030|\025\355\310n\251h\017\275\035\017$\317l\223\036b"
+	.string	"\022\206\333X(\037\002\377\016\351o\006\373\026\331\330\366\336+\022\215\215d"
+	.string	""
+	.string	" \037\024\201t\310\017\224\263\200"
+	.string	"\334\364j\036!do)S\nN"
+	.string	"I"
+	.string	"O"
+	.ascii	"\253\006\"\026\017\001\215\006\027\0247\273\253\021x\310\365"
+	.ascii	"\b\017r=\352\207s\277\"\324\344\374\253\316@\204SC\362@\2776"
+	.ascii	"<\216D\ta\256\020$\306E\013\200\327\002GZ"
+	.string	"2\034\256zv^(\023[\260\273N\222W\272\261\333N\261\255\300\376\212O\335\232\351\314\364\263\0015 J\277\221\261\373\222\263cY1F\210\247~\233\363U\366\360S^}K\373\f5h:\034\273+\362\350\003\331c\332G\335\004\367\017\303\005\354\232f\274\330\375H\\ {\364\227\331\366I\274\004g\007zr\200\316\346\206\216\374c\306\006\225\"W\355T<[$H\021PO\331\222\211\201\241\276p]\037\250l\264\244\016c\371\023O\241\222\355\216N\242\220\215H\f<^jW\260\220']\317\002\325\201%R\220\375\201RO\366\341\252\311\306\376\375\027\f^\371\250W<j\002aC\201\021\266\217\272Sr\"\241\243\245\2348@\321:\036\025\255$\304\333\004\023\217\366\3316\217\346\361\355\341\252\311W\375/]\016\017\021SC\250\n\265\263\r\3654P#X,\032\272\234\367\352R\3054\342\314\270\300\2042'\006\035"
+	.ascii	"\3571\346\2107\350\025\b\254\240\207\r\315\260\027\264\016\034"
+	.ascii	"\001\333\001f`\t+\344HB\212\212\270F3\001\272\206\213\254 -Q"
+	.ascii	"\214\212\027\267`\212B\215\240\212\fNL\322\006\261 \022(\003"
+	.ascii	"\362\005fL)\024\024"
+	.text
+	.section	.gnu.lto_cliSerialPassthrough.263.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\310%\315\257"
+	.string	"\312\027\021?P Fa;c\243\024\b\211\227\375\377\"\264\341\036i\242\213o%\246\256\034\273\310\317-V$\236\035R\302\364\233\225\354\356\370\346\270\0347\200J\204\334\340\034\3349"
+	.string	""
+	.string	"\365bP;\345;V\002\200\221 ) %\212\024\310\323\326\213H\224D\246\224R\352\003\221\003\351\003zX\360\312~\257\355\035\222\030\347\255\026\277\2305\233\356\300n5\335i\272\373\272\321t\227\351\326\353&\323=\246;L\367\225n\267n\270n-\335\\\272\347\272\273t\177\351\016\241\177\230\233\271\007\271\3330\017\233\035]|m\200\364\001r\0132O`\322\253:\210\b(f\004\3565\314\243f\001\375:_\037\177\203q"
+	.string	"\353\322p\377\035U\2206h\b\350\327w\264\363\026\266\345\f\367\036\363\240\331!\013\322\245\255J\225;\257\3150\217\036\323\365\353\3656\0206\201T\300(m\027\313TIx\006i\323\240\305c\2361d\026\300\3351\317\230\2347h\265\307\332\266\343\026\201y\302\364\260p&N5\215\360\253\355\342\332\323~\353\270\336\322rMm/\r\246\353\230\347\001M\327\354\020$\270\222\020\205\003\310E\244\355\342\277\"\332\207\375\002\2070M\352\354\302t\353\013\367\256Q\303\266w\2029\037\353\213\344\3753\206piR\bH\230h6\027\037\356U\333;\204\215\032vq@\013\005NY@\026\300\263\022\345}\273"
+	.ascii	"\240\205\243`\302\233\3676\327\037^\032\340\373\266\315h\261"
+	.ascii	"t\226f\2731\235\253\325\366v\261QC\276\027F\333Ewm\037\366\n"
+	.ascii	"\005\353\213\244\355\365b\367\224T\323\b\337\267-\251\213\\\242"
+	.ascii	"\355b\033\005\207J\355\314\235\326j\315^[6\205\367\035#\323\345"
+	.ascii	"}\333\226\230\250\355\"\2675\020\333\305\266}\330.6\231\325\\"
+	.ascii	"\370\361^\225\300\013{f!|\337\267\351\311\330\315\204{\006\316"
+	.ascii	"ILLL\354\265\255\371\247\330l\216c8~c7\316\302Xx\312W\030\004"
+	.ascii	"n{\341\242\005\213\025*R\240H\340\204\211\022\b\220\030!\242"
+	.ascii	"\211iI)\t)\304\221\021\210\"\242\017\036:\270\0346\f\ti\310\200"
+	.ascii	"\341B\220\005"
+	.string	"\326\002\364\343S\201\302\004\t\307\036#\317\216N\233\303\026\327\367&w\216\323Us\034\\\021\261&_\315oBbYC\376\2008\273\3455\021\322\234e-\202\345G\254I\220\346\251\220X\226\005\026\304\262\266\234\257\bB\235Ah\023dM\257\027\210eU\340\3346h(\244_\374\365\252D,kH\242\273@\354\026\210g\\\207\316\002\361\214+\216\257(4t\025\206\235\242\020\216\243 \354\004V$@/n:\217\213p\005\032\322\001t\215\237P\203\307\346&4\360\032\241K \360\227\306I\370\365\210\325\025S}r\030\013+\3543\256>\027\341\307\347MLx\275D\306\314\235+%\3458!\211\021\301C\020\005\302yR\217\302\330\271\021\265AP\347\274H\314K\256\211\344Vw\217\213\177\030\343!\217K\313\031\327\026\357@fA\365\257\335\325\347\213\013\232\316\343\212[\225\320x\220\244\315\3009\207\034'\274.\222Y"
+	.ascii	"\227V(\3465BoX\363\241\265\026J[]5\327\260\002mp&\245\363\270"
+	.ascii	"\254\254HtrT3\317P\2451\034\347\214 ^@\273\223z\020\005\242@"
+	.ascii	"'\026\032\253J\263\226\025\205\334K\025\022\313J\262\346\234"
+	.ascii	"%J\3513\256\016\034(\217\213\203\037\376\323A\003/(\355S\301"
+	.ascii	"\264B\016\2204\024TH\263L\360\022xp$\254,\324\244N:\217\353\311"
+	.ascii	"\372W\336\352\372\214+\314\217`=y\\KV\367\214\353\211\033\213"
+	.ascii	"\207\206<9Nu\275V1S\223\265\247\245\353\202\336\271\240ur\234"
+	.ascii	"\274\236t\273\016\351\221\231\322y\\_\253"
+	.string	"\007%L\266t]w8\343B\3429\376\244\331\r\234\224)\301\200m\305\270\222\260\355\373\276;]O\266u\266E\366\214!aZ\241\230\027\224^\233\b\357\311\223ZD\254\t\222\376\025\tlL\221c\227\326\nT\246\311_\327\265oue\271\3478\275\357\313\016\355\362j\006@3\263\314\354]\314\033\222\002PA\n\377a\362\272\302\022'|\224\211\266\034\"\036\373\310\037\375\0263\003~\364\306\334+\342\353k\235\016\304\210\231\2069\202\367\261\rV\177\260\237\224P\302Gy\355\004\260\023\276\317\246d\372\310Ox\2373\211o}\344\32786\274\252\226\204!\035@\217\022\276\327\2560\327\004\266N\307\222\360B[\207\033\300\306\030\351\351c\237\f\357\371\266s6f\033\346\233\326\331\206F],d\032zC\217\357\302pfb\363\312\033\332\003f\211\027\243\361\255\034\361\274\321\305\217\346\323\033\312\243\226\304\n\317\316K\241,"
+	.ascii	"\335Au~G\347\277\217\215JU\013Iw\034\333\224\352N;e\205o5\203"
+	.ascii	"xC[\237B\266\260\252\220\327\226\031\235\217\2361\235\020\337"
+	.ascii	"\373\276J]\327\034\022T\366\276/\212.\376\bPA,O\354\362(M\"\355"
+	.ascii	"\373j\235`7[bi\032\351\301v1\347\373\314\fM\341Z\to\337n~a\320"
+	.ascii	"\\\262\344[\204\356\264\255\302\266B@\367\t\224,\355G\271)`\331"
+	.ascii	"o1\021\336v\276A\223I\333\244u\366\032\243.\306\2106\311\274"
+	.ascii	"\241\354{\034\233\221\352\217\013\272\220\213\020\360\312\017"
+	.ascii	"s>Z\244\331\351\312\017\271\373\237Xww\254\006\354dl\240\220"
+	.ascii	"(M\330\307\212?r\200\330\245I3`g\262&\022\246I\301\230\211/\n"
+	.ascii	"\006\354J\274\231\216\355\342]\224/^\372Q<\354\222&}3"
+	.string	"8\302J\254\246}\337\253\006c\346\f^\274\270(n\204\231\325t\2039\364\r\321E\250\35786\256!`\357\227#\276^\232+Z\212I\336v\275\245\371\344\207\017\332v\356\325\344\240\210\357}\235\rm\232\265\316\3763\352\342\001\2444=\360\206\342\370\237-o\332\n\001\235\177\305\376Cr4T\320\203\034\221x\362-(\022\3533\317\360\n\230\216\304\206\351\031-\202\377\353\367\023\021\313\023\247\370\263I\345\004{\026\003\232h-\224.\376\353\254\271\226\377\310\301\r\205\233V\232j\336\320\246\032\333E\377\23610\016\220\344`\231\233l~\225\243\017\233\031F'\036q\037\261\314O\035\007\252ej\346\031\r\207\351\370\0043\217\350:\032\214\242\213\f0\253\223\262\301\362D!D7\035\254\031\274\305\236\231\001\001xC\271\343\326\350\252\3077v\\\377Qn\037l\277\215\251\237\226\303\341 ?\3003;\360\2007\264\277\353\032"
+	.ascii	"m\270\b\001\265\376\212\271-\313?\312\334In\346\330\370\307\230"
+	.ascii	"{\255\273\305\232I\207u\230\346^\322GZH\227in.}4\233f\253\016"
+	.ascii	"lV\266\232f\036\335\327\234\304\301\343\214\354\266\356\003t"
+	.ascii	"\232\346\032}\245\231F\243i^\240\3114\317\220\321n\315P\r\327"
+	.ascii	"\034\343I\001\030N/\\\364\227\346\026;\316,v\234W\3608\247\350"
+	.ascii	"1\315(\214\316\t\3608\237\330q6\361\343\\\302\307\031\201w&\361"
+	.ascii	"\316#\232K\263\210\236kn\332qf\332q^\252\340\254D\3019\351\350"
+	.ascii	"\214tt\016qtt6j\275f\020;\316EGg\242\243\363\207\243\263\207"
+	.ascii	"\243s\207\035g\327\350\314a\307yCwi\036::\013\031\2355\030\235"
+	.ascii	"3\030\2351\030\235/\030\235\203\214\316\026\216\316@F\347\237"
+	.ascii	"\243\263\217\321\271\202\321\231\302\004\347\tFg\tF\347\243\004"
+	.ascii	"\347\236\243\263\321\350\314st\3361:\353\030\235\333\036\347"
+	.ascii	"\034wf\215\316"
+	.ascii	"E\243\363\312\343\374;\316\376\316\335\032\250\240N\003\017\244"
+	.ascii	"\225\276\305\214\274\031\223M\351y\240\325\221\260r\244/&\006"
+	.ascii	"`\220>\t\312*\204\255\372l-\206}#\036\351\033q\311;a\206\265"
+	.ascii	"I\257\324\327\">\312HdGH\257D\243\242\2555\205\2102\2314i\235"
+	.ascii	"\3177%\372bP?|\315\265&Z\327\361\205\370\024ra\230t\270\321\273"
+	.ascii	"N\230O<`\300\215\316|\030\223\003\263\326\371U\244T\235\177\025"
+	.ascii	"\006\226d\311H\t\224\321\347\020\341\222\006\246\266\346&\371"
+	.ascii	"B\322f\272\306\036\022<v-\355\003\245\013\230T\206~\t\232\256"
+	.ascii	"\244\2172\321/\2110\245\fy\320:\235p\312a\325\211dJ\026\322G"
+	.ascii	"\331\313\224\2601\031\324c\243\370\375\ba\246[6\201\324'\325"
+	.ascii	"h\371 @|\363=\027\223\n\007\264\326\351b\342\364\232\262\024"
+	.ascii	"9*\372#%kW\203zE\377Ar(\275\005\315!:zne`i\277\345wPA\033\316"
+	.ascii	"\315Tc?<\321757\223\215e\020\230Soh\321\257o\222\247\377\001"
+	.ascii	"\225\326\323\344M\n\226F\364E0o\037d\035\265\033\226\017?b\372"
+	.ascii	"&5\202\361\357Q\316\340[\031X\032\210\217\262\227\005\222yR\211"
+	.ascii	"<L\367X\240\bO\352\207~\323\013x@<\032*\343\363\3609M\336\306"
+	.ascii	"\212\376\312\333P\254!S\252\206\220\315G9\"G\364Q\377\353\016"
+	.ascii	"\337b\205PB|\035\276\367\332\210\210\333\037\230\032[5\373\372"
+	.ascii	"\340~\3471\263\370\233\034n\230/\363\315}\020NZGL\312\235\207"
+	.ascii	"\217rW\261\315=\0038\207-L9oh\363[\312 \323\365\003\312z\216"
+	.string	"\217\303\263]\244\177hkJ=\343\227\257B\2727\335s\353\001K3\327\341\243`\357\213\265`\027\007\270\033\376\247nfS\277\300\034J\200\016\330\034\322J\244g\244k$\340\206\302\244\362\206o3\275V\221\236\231\356mI\242\324\225\246\305A\032\270\366\244\016y\230\226\3023{R\205\372M\267\370-\336\360\321\237\240o\301i\037\017\006n\322\206*P\275X\021j(V\350m\244\201\022\372\"%Sh\201\312\037\241\206\217r\216\b\0304\374\373\325Hj\031-\343\213\203Y<\230\366\264l\212\220\f\037\345\013\257\241\217\351\005L\353\3649\031\257a\006\331\026\325\221>\230\223b\b\222\361(~\353\304\234\0212A\027\276\370[\305\317\360M\306\3210\351\206\352Z\247[qQ|\206\317!\203\276q\272\225\302\273\013\037e\246\306\360J\007\374\202\030\346\2357\024\303\257\310 \217\351N0\005M\\\370\276\353\242\b\322\020\n\225"
+	.string	"\341\214\0041Pe\342\005\225i\235\316$.\317K\3653\b!\317\302G\271\373\302 \232\020j\374<\275\210\337\342\037\030\337\364\363\342\207~+\350-\274\215;\246#*\333\300\027\364DN\326\3040\335\217\222\004\013_$\202%\016\230\332Z\0215)\320Gy\202\300$a/\205\247\006\365[\r\b\304\340I\365i&:cxiO\352\212\343c(P\345\311\351\361\320\236ok\277i\030\277\305\253\217\213\227\302\223>\251kR\277\370-~\3221\276\354\310\2322\203z\353\373Q\346\265\347iG\212\267\345Im=L\263\361\351\371\370\364\314>\275\002\277\305=0\236\327\026\206\337\223j\354\366\301\362\021\006\214w\372\255\256\353\016\333rH\246'\251\271}\361\274\032_\354\214\341\255yRye_\274\213\337j"
+	.string	"\030\224\272&\007\315\006\f\nS\217m&\337\205yT\252J\r\365\035\366,\244rY{n`Y\236\310m\331\313F\343\264\245\021\276mo\210\366\303\253\n\350|\200\276\034\375<\320OX\264;.oI\005\037\352R\205\367\251\360\337\227\367%\326\306\271\256(\205\024\260\232K\216\b\244X\b\331P\320\302tKr\001\354\016\200"
+	.string	"1\\\036I\245\224\253L\366p3\223\325\324\004H7iUU\344\"u\334\360q\303U\"%H\362p\225pPMI)\243$P&e|`&)W\001\007\036p\225\310\b\222\256U\224rD\210\244\325\216\244R\001\256\024\022\007U\024\0047\\\244TrG\021\016\252)++d\225\253\344C*\n\251\324\021\345VM-\355\3640I\025\271-\\\251\036Q6\\)W\211\210\231\244\220TH\036I\027i\303\265JR\271R:z$o\270REB\354J\025\271*\244\212\214RE\025\030\271#\252\312E*\243\\\022\256\024U\224\333"
+	.string	"\006\226*r\225H\033;zP\271\002\240A5\325\200+5\245#*\002*\032\027\030I\225\244*2\313U\t\270Q\205\344a\327\223S\216TFI \245\214Z@\211\3341e\325\203#\312\352\255\250z$\237\252\224I\253\344\016\036+\035=\242\024\200\214\201\254z\240jj\002\215\007t\246\032\307\224\002\250\222O;UE\033OR=\242\024@\352\260\021E\2054*\255b$\247\250\246\032\350QZ\305\240\022\300"
+	.string	"FX)\223<$@\200\243GR\t\201UUUT\003\312d\025\025\322\201\033U\310\037\245\025\017d\004QU99\222V?\001R\212j\252\210\304\021UU\205d\300\nY\205T\032\221TS:\220;\242\002 \265\343F\016\337`\232\322q\243\211j*jG\323\reU\023\023\020'y \225MV\311\244\262\211\247\r\253\235\260>\253\215\206\316{\035B\001Sk 5\032\214Y@\213\004\353\373\212\275\350\020\272\001\257\230\371\3535\367\262\t\273\342YD\227d\317\277*\243\264\241\214\305\353\340\345\360\245\245\025HU\250h3>\312=P(\037_\204\363\242\017\273\306o%\277\306\273\330t\f\320\037\024+2\372\210\255\361>\276\377\272"
+	.ascii	"\3170<('K3%1>\272\201s\2604\3738\277\257\036S\203{\032b\221:"
+	.ascii	"y=\304\246x\344\263?\221d-\245\274\335\322\203\226\037\f3\311"
+	.ascii	"rJ\212o%U\262\024\256\215yR\243-\255\024\251\376`\342I\375\275"
+	.ascii	"dc\255@XN\375\210T\235K\336\226q\336P\253\3576\355S\350\327U"
+	.ascii	"\325\372+\2073\354R\240\223\254\362\213Sj\342\324/\211' \267"
+	.ascii	"\244zC\225\357\362\370\004\276\005\033\001\317\2607O\304\275"
+	.ascii	"%P\030\037\345\005\260<\276\230E}\343\367\324\005\264@\301\274"
+	.ascii	"\364\362sK0&\370\226t/\267\254k*{_\255\023]\344\337\362\\\226"
+	.ascii	"a\226b\226\313;\266\213<\336\r\032\"\332\027,O<\3029\211s:\361"
+	.ascii	"\311w\272'\"W\231\245\2367\364\304\257 \354\265\251f\005\361"
+	.ascii	"b/\367X\346e\3372\315\236`\265+p\346\345\232e\240_S\210\333\013"
+	.ascii	"\254f\275\020\361\237E\2652u\361Q\247\227\370\266[\266Y\2761"
+	.ascii	"\361\314\313\302\245\341\324\210\317\304\353\254!\360%\276\345"
+	.ascii	"\236\210C\217\300\337 \003\243>\021\261\322\002\273\264\370("
+	.ascii	"\211\347\321\233[3\365\033\361MO\342\373Y$\251\207~\304\263d"
+	.ascii	"K\326<\037\220\345\211\335&v\305\342\243\\\364S\301\017\302\362"
+	.ascii	"\220\007\332\236t\231\330:\213ZF]\374*)\370\331\230WVhh\244Y"
+	.ascii	"\255\263\210e\324E\032\277\265f\332\307\200\323\370\266{5\346"
+	.ascii	"\017\240g\353\\\311\204\330[1B\007}\243\321\"\"\250\242\354\002"
+	.ascii	"3)~\254\351?k\216\312\024\005\005\276\364m\327\276/VC\231\266"
+	.ascii	"\230A\2449\214EL\257\343\200\034F\267\245'\201f\246\320\356?"
+	.ascii	"`\016\t*\353j\235\353\007D\320\034V\265r\306\260\004\023h\201"
+	.ascii	"D\311\032&\203z@\310\316"
+	.string	"\234(\321B\376\3756$\365\214\265+_z|&Z\3107^\257p\244f\246{nIe\334"
+	.ascii	"\226\370\250\024&\233PY'A\253[\263l\020E\340\243\034\203\031"
+	.ascii	"\250\022\301$\320\302\234c\b\321\214\310h\222$\035\202\n\020"
+	.ascii	"\006\243q\236\326\262\007\022\200tIIC\205\304F$I\222\354\214"
+	.ascii	"\001\321\351\332O\307_[\223\256\324k0\301\201\210\360\310r\336"
+	.ascii	"r}\300\030\200\200\272@a\302\362\313\321\357\006\300\356\305"
+	.ascii	"\221\320\335\265>k\204\200\374\342\031\241\234q\2014\272+\330"
+	.ascii	"\032\354H\246<@,\301z8\t\215{<w:\303\023\373\362\306\305\f\375"
+	.ascii	"O\024\361a\245\372PeK\232\216\001\274s\230\210\2624\304\252b"
+	.ascii	"4\264P\362\213\346\373\300\004\342\344\0060\rVs\206^}\220\216"
+	.ascii	"\246\260h\274\006e\365]\345\216\301O\222\365w;A\256\263\315\031"
+	.ascii	"%\360\f\367\337>\367)X,\307\215\3722]I\370\240\223]):1\222\006"
+	.ascii	"|\275:!$\254\372\341\2002"
+	.string	"\004\360\374\305\263%b\"\255\001e\024\222\245\354\037\032\307\201\024\3142@y\017RF\335\251\2615:x\352\026\374f\303\251,+\246\233?\343k\322\r4\037[\035Hs\032[Em$\306\243\026G\356\202`\n\243\214\364\254LI\266\371\272msl\244\235\323\220\372\212\236\331\276\177\027\232\234r\272w3\027\266k\322\211\250\341\004Tc\332\322\371\332\250\214Dl\353\366\340\371B\3400\231\255\363\254z\363\333\216\233\361[\220:jZ\255\023\226\006a\260\342\230\017\311U54~\373\013\270,)\271\0047\354\313#\001ZR6\3461\236@\304\034:\216e\240\003\361\371\333N\305B\207\372\212\214\221l=\371\361\275\376\243%\024\227\312\310^\013esb\220z\272\027&\371\315\224\246\020\n\372\306\367\021\250\027\235\366\316\266(\\AS\317sY6L\225o\255^\361\304\367\326\377h\035\235&\334r\177\252\232\325@\023\275"
+	.string	"\254\316/\243\024@\233\340\275\031\351\221\242\031\265\225"
+	.ascii	"\231\252\334\027\3044{\343W&=\323|\254\334\254R\305aR\245\276"
+	.ascii	"_*\016\252\177)\314}\220\350\245\353\037\221\027\240\006P\207"
+	.ascii	"_\242^\343\030(MRU\f\024M)G\200\230\250\225\277\274Z\355cX-\206"
+	.ascii	"\213D\200\246\216\342\017#nq\221\235\361\314\262\371\367\236"
+	.ascii	"Y\222u>\220\336\005a7\231\326\232\316\322\276A\301\016\313<\351"
+	.ascii	"#6?\003\366\325\351\224\362\332\360yb]\306\230u \004|\222\240"
+	.ascii	"- s\007\363\237\3720\321\2707\004\323\214AFA\2122ED\nM\003M]"
+	.ascii	"\022\363\333D\352\311Q;f\266\230\2665w\023\227\335R\321\224)"
+	.ascii	"\207\313\226\326\020\002\232\316\016\3765_\363\340O\0275[9\307"
+	.ascii	"Kz4\205\214\004'\306a\274(_X\3516{a\302\036\222e:\211\021\001"
+	.ascii	"\r\035\223!\026\227@-l\26002\350\035P3\225\374~\211\024\021j"
+	.ascii	"\356\267\007\300U\n\324W\004\223\346\272:\206\230\341\377\235"
+	.ascii	"&\251\327Z\026$\236\212\202\304\222N\352C\365'\306\353\017>\036"
+	.ascii	"\354P\323L"
+	.string	"Xb\376\016S\262\304\274\372\021\242\320\315I\257\223\026\264)\307%{:soc\347H\324+\256\315\004\200I\307\b\252\367\211\261P>\013w\344\241\373\347q\325\251k\262\367\327\244\337z\004\021\270\017c\353>\030)`\205\256\356\344\262\036Pc\217i\030\021\001\306-\b/i\303\262\235Z\256N}dN\005\037T&\234\252I\212\253\327A/\211\237\314\371G\336\302q\273>*1!\247\210\324\207,\217]\326\365\210\022\016\275\355\304\026@v\245\030\201\251\305\255\214\002P\365\232$9\006\224\212\305\313tw\340\254\204)\344\326M>S\022<9\223\255\013\345b)\032\361\3759/\004\\\2444\002VG![\220\257\004\006\377\034k\227(\256\277\256\276\3351\t\031\207<Z@&\242\272\207Ie\265\350od\006\270\001\267'\327\215q\024^\n\233\314\fm\bM\310\2559\335`G\b{\0212\375\034\002\261\346\252\341"
+	.string	"\323\335\030\301UIp"
+	.ascii	"\331\361\233\342\362=X\267\275J\352\337\3632\320PX\301\371c+"
+	.ascii	"\330\340h\251\b\245\\\207~\377\013\n\312b\254\reS >_\n\372Wu"
+	.ascii	"\263$<cuK\252\003\332`\334(\306&\332\307pp<\020\215\374H*y\034"
+	.ascii	"\252\207\316\257[\256\210e\220\244\235\236\305\0342\366\201e"
+	.ascii	"0\211\177U\222\307$\037\034,U1>T\373\350E\024\322\021nD.\201"
+	.ascii	"\200\275\272s\3127\372\003\207\372\206H\241\316\242\016\343\345"
+	.ascii	"\304N\241\214\336U\004\345\345\230[\343\344\336\364\316\n\205"
+	.ascii	">\326\005\205a\321\241\0018\223)0\374J\301\332>S{\331z\032\233"
+	.ascii	"\004D'\236\320\n\226\365\301\356\330\027\272\365\203\030\276"
+	.ascii	"\276\314\222\007\037\341\017Fc\355\254\202\177\325\350\330\204"
+	.ascii	"\021d=*\370o\352\214\322\bP0\252f\264\246\037G\323[W\343\354"
+	.ascii	":\271g\314\2276\316\357Zh[uR\254\224\023'\317/_\337A\212\246"
+	.ascii	"\205\fI(\265L\2465\240\277\224\3624\306\222\234\025Q\213A\251"
+	.ascii	"z\3544\236\242;\327\001/\235.&\303\216r\3711zu\001\026\355 Y"
+	.ascii	"1\320*\346\324/\301\357i(Uzr\247\367\300eT0:\326\013\027>\232"
+	.ascii	"\2227\025\3508\222\313\374\267\364H8\020\032\t\t\0340@\240\007"
+	.ascii	"x\002R\213vHF\206\351hw\351\231P\274<\210\037\316\322\211a\200"
+	.ascii	"\272\243\366\267\021\310\366\221@\202\351\360\033\206\275\321"
+	.ascii	"\035\233)\177-\024j\024\364k\276|(\207S\351}#\301\237\215 \227"
+	.ascii	"\215\3279\177\017e9\007vT\317\023\214-6\025\341\370\305 \274"
+	.ascii	"J\264\236\007\314\226\230=\342B\f\021\345O#]\035\276\361+\216"
+	.ascii	"@\201C6\301\274\242Q\320\035\007A\032\\\256\372T[/\003\356\246"
+	.ascii	"W\007E\312c\302]7\001\246U]-\265\177i\357\256\213\3408\2702\331"
+	.ascii	"\346>\0368|\"\017\020j\253SEbp\t>u\361\354\370\b\2734i\007\326"
+	.ascii	"\262\b\350Z\210(W\bja(\334D\b\254^\250C"
+	.text
+	.section	.gnu.lto_printAdjustmentRange.264.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\213\b\205-"
+	.string	"JR\320\021A`\346\312psqo\335\270Bk\247\254g\f \220\f\302\316d\026\002\331\212\343)\237\213\303\263\031^\231\035\004\365h\274r\247c\303\275\202\275\023l'\021vm"
+	.string	"\344\233\255\356\320{o\262\267\224I\006\n\001\356"
+	.ascii	"\023\001\253\216A\200V5\247\037\224\203\371\273\374}\377\336"
+	.ascii	"\315\335\357\376\313\336o\207\300$\351\315\2211r\331{\271r\207"
+	.ascii	"\372f\230+\220\344\272\003Io.\t\243\001\204\264wA\033\252%W\035"
+	.ascii	"\250\334\334\226\260\364[\366|;\364sw\367b\f\331\222+\234\220"
+	.ascii	" \023?u~\3265y\365s\213\351\317\017\355n\347\311\320\262'\002"
+	.ascii	"\017\220\027'\177%\355Xf0\035\255lY\226`\245?7\231\236w_w\273"
+	.ascii	"\264\337\321Xu]\215\240\371\262\256I\254\235J\177\016\257$\374"
+	.ascii	"i>I"
+	.string	"\370s\323v\3530\335X\325\036\f29j\361\263\256+\261\345\026\352f\362+\344\264\243\302\323lN\333\353=\n\311gM\220\017N\355\250\3118\274\250\031\301\035\315\256>S\006\235o\215\205BR|\374\354q\323|\nDS\305\b\356\206\031%\244\b\227+\317opl\334\347\273\025rL\026A>8\037g\364k]\327e7\270\035\337\364\273\013dw\213\354\246\030\002\334\021ZB\233\177mT\204\276f\204o\356\267MY\343A\233\325\357+\177\336A\236Y\023\324\023d\203\007\265\035+?\226\275D\374\240\257\356\240w\311V\360\335\264Z)\307\237\232\345\235\266V\333M\252q'\331\375\021\036\034\034\333Hv\277\272\270\016\346\273u\274\177\302\373\276\022\216\345\217\240\365\274\377\301\357~\007\357\362%~\357\233\205\365\274\357\002\224\367\n\345\265Ry\025\240\274\tP\336*\224\027\201\312K\205\362N\241\274R(o\224\312{"
+	.string	"\345\035\252\274\006P^(\225\367\t\345uJy\013\240\274\004R\336&\224\227I\345]By\007\240\274J(\257"
+	.string	"\2257\t\345EBy\003\240\274G*/"
+	.string	"\224\327H\345-By\211T\336!\224W(\345UQ\3364\345EQ^\341\311{\242\274&\312\333B^\026\362\236\302\026\237\265@\274\301\271\026L\006wr\024h/\344\036\272\246&\320B9'\312:%r4I\351\031\203$\316\216\317!\247-\324Dm\324H=\240\231:\253\367s(\240G\376\242\304\325\255k\333\335*\244m5\252~\232}!\003\337m\3155\256\325v\251\2314<\016\330R\033\221m\350\356l\264\271R\017x\340\005\264RR\013\330p\3017Im\330\0024R[\\\323\367Ox\324\001\272\001\333\246\364Q\237\303\331\200e\301\331\016_\343\341g\225\022"
+	.string	"}$\322\r]Q\033\201x\232\2426\"\335,\207\232(\304\001\301\206\350\324\026\032q3j\033\221o\226wh\247}\216\202vI\274L\211t]\331\264\366b\322\334L\244M~\242\275%\030\344\216\210\261Z\330]\215F\344la\377\354\037\303p\265\331\250\334\234\235\343\325\273\271\272\001\217~"
+	.ascii	"\370a\276\325\022z7l\214\357\326\335x\344,\325pO\350\255\276"
+	.ascii	"\337A\350\315\245i\243\262\3068\370\304}1?C8\241\235\206<\271"
+	.ascii	"\242'P\016\033\377\331\313`\210F54S!V\2242+\252fE\266p\306\242"
+	.ascii	"\210\006c\254\210\354fF\020(\312\310\304\212c)\204(\030Y\240"
+	.ascii	"\025O\214\211-\235\215\241(+~0\226\215\2650\236\241\251\020+"
+	.ascii	"\036\2558+rx\321\002M,\335\260,2\026a\3042\262b\013b\230\331"
+	.ascii	"\0311Ki]\274\0303#\032]\2700#\016%\3277\022\275\247}\200\311"
+	.ascii	"\345\035\033\275\206v\222U\221\347\227\332d\020\312Q\311\373"
+	.ascii	"\266\346\271\240\257wU\311\340\223\243\222\265\032\253\337\270"
+	.ascii	"n\310\334\232\233\353\272\256\302N\262s\006\353\216J\223+\335"
+	.ascii	"3HwT\366\036MH\354\267\373]\2053hwT\232]\275fc\365\202~\333\375"
+	.ascii	"c\b\263\372\253\317\367\323\007rL\026\301\274!\023h\247\206\352"
+	.ascii	"aOu\202\266\272J\263#\366U\377(HA[\001\002S\320^H:\313\252N\200"
+	.ascii	"\240\253\232\003Q5\202?K*\251\236\212j\251\346@\007:\252\017"
+	.ascii	"\030\225\022>Op\016\364y \353,\r\364p\217\001\272\247\206\312"
+	.ascii	"\003\366\324^H;\313\002\355\024\200\231\250a,&\221rfDD$\030\321"
+	.ascii	"4Ic\260\002\2211\252y\021\0209\207\220S\243IA\2325\032\001\375"
+	.ascii	"6\263\006\243\350\004\354\275k\372\306\304*\0209\204JP@\213Y"
+	.ascii	"z.r}\1770\254\006mt{\322\356I\371\001\345\330\013I-bb\007\022"
+	.ascii	"V\240\201\024li\\$\240\002\211\375\016\227+q!\201c\370;\211\005"
+	.ascii	"S\265\375\233B5\315\245?l\243\003\t6R\310\274\275\316\341@H\035"
+	.ascii	"e8\007\007BH\001T\216\341\2244\244\323\201\265\372\001\320\264"
+	.ascii	"\r\376\034j\222A\201\310\207\2450%\025WC\264Re\251\t\233y\267"
+	.ascii	"\237,\373\221\214\360]+\222\214\233\312\246\255\024\355W\317"
+	.ascii	"\177\233\377\242\371\376\240\204\245\246\221\024l\357'\235\352"
+	.ascii	":H\214\2130\331\251\233\035 \2047Vip}[~=\222H\037\016\324\204"
+	.ascii	"\305\240\026\317\314n|\315`\263{\226Mm\326\2200\355rz\246\364"
+	.ascii	"_\004\372\020\352~\037\325\320\311\fr/\bPE-\007[<\031\256\203"
+	.ascii	"M\336p.\254;V\020G2\003h\367\266\215\177\301\370/R\314f\3218"
+	.ascii	"_\363;o\333\256\357\277fJ\005"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.265.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`<\001-\016"
+	.string	"\206\232_D"
+	.string	"\221(\035\3435\\g\220\201b\233=\274\224\337\300_!\021\330\205\223\271\235P\325\312i!\247Q\330\267zD\030\302\346\372Elf$b\203\020\020\r\252#$\2419J\326[\021\320>\274\0164K\366\226;\245J"
+	.string	"I"
+	.string	"M"
+	.string	"\237\006\357\301>7\017\200}\332d\307\f \331S\002\0311%.4v7\323\0177}J\215&\377\364\2719\271\344\370N\256\322\300+\305\f"
+	.string	"\237JzV)\336[\0365|\251\0305\036\273\353\350}\034n\354\266\027\330n`\377\013*=\331`*\252\007\373\032\206ahE\261\317\362\313\203\277\312\350o\036\303\2652\351\360\224pw\025\332X\230\251B\305\366\215\341$\214 \304\r\3169\266#\230a\246\343\321\376\312E\230\3162\362\316.\n\013\327.x\300\0056\001'@\352\302\332E\335{\313\356\270\tM3\302\204\005cew\025\224\370\313\346\203\370\264\004.\336\343\260\317\277\002fw\242x\317\177y1\003Sr\226\314\313\245\276\200]!\264\\\250\242\2145Q\325&\211\304{\327\267\374\033P\264"
+	.string	"k\274\002\236\360!\225B[W\"\211P"
+	.string	"\001}h\243L\213@`\013q![\007b"
+	.string	"\322i\032k\037.D\313B\034\250\313\264\021)\373x,\262\260\215\262\222H4\3128 \352\036(M\311\335\335) \252J\265\035<\230q\005\311JEv\242?\202\371\037\330[\017\034"
+	.ascii	"I\231^\t\377.\206\314\320tF\316\037 d\202\200+D\033\315\260."
+	.ascii	"\270\2225Hi\023U\362\005\001\022r5\0214\330\342\256\331kD\263"
+	.ascii	"\302}\240\032\270\002\346\006\250(\343n\276\231]S\223k\\\n\n"
+	.text
+	.section	.gnu.lto_printRxRange.266.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\017\005e!"
+	.string	"V>\331J\220\026R:"
+	.string	"\3337\211$n\223R@\2027\205\267\\\313\375\341\337\360\200\227\302,\220\021\205\246\363\344\016\251\357~\302%\306e\221\250\243L\202\233\274\363f\021\374\rFh\354=4\305_-B\203\267X\020\337\032!\204\020)\223\f\302"
+	.string	"\272"
+	.string	"\305"
+	.string	"D\366\306\275\335\334\3350\246\034T\261\016mH\343\031\021\255\326b\320\315-Jo\376\266\273\375\025\202\311\005\257!&\030p\361A\232.D\204\316L\205\352\262\022Jon1=\357\236x M\347\032\261\265Zc\024)\253\265(\264>\351\315\334q\347\315\3626\347\315m\332\325\242C\242\006\017$\265\204C\320j\255\273\306Z\363e\361{r\323\321\323,\233\233\366`\327\021\221]H\3430x\264\264%!;\312\f\205%\002-\0359n|\342\323\226\243\352\346\212\227\345\216\331\223\0362C\022\245\316\005\f\261\223\235\247\206P\3347\236"
+	.string	"q\311\023\3228\254:\243\013j\255\313RC\024\337\364\273\313bwK\354\226f\001_\2348\355RN\030w\224}\265\027q\346\332\205\225\215\340\026\263+P\334\245\265\216\2440\321{\343\235\016\272\200\336\355p\304\227\342i\034\325\212\262\344YT\007w\213A\356\253$[X\320\266g\354\002\371\350.\344\357\271\327\237\343\371\327\277s\256_\300\307\276:\017\373\346\340\374\353\213CyoP^\233\224\267\006\345\245Iyg\230\027\300\311+s\362\306\240\2740)\357\r\345\265\245\2745\22475yQ\224\367DyM\346-\231\267O^>y?@\001\262\313\314+I\243\221\305J\225\346\245F1\215\334\370\330\037\266{\261=\331\336\326"
+	.ascii	"\202\246\217\001s\301b\245B\261\214h\276\364\001m\343\244\246"
+	.ascii	"_E\2342\3234}b\215\035\233d\370\251\242\201\347\2235\323?V"
+	.string	"\270\234\272\247\001\364\243x\274\3541-\023\323?A\244\362\204\004c3\207m\r\3239\275g\"\001\2251\005\207\025\261\326\250KMH\243\230\200n\236M\241\002_j\313\332\242\203{k\030\013Wr{\222\344\252\265\r\212\360\313.\206#\311\260\313\252\025*\301\276\f\004O\250\312\326\315Z\237H\204\342\203\313\211\323\366\3068\235\266O\003\321N\373h_\210D\327g\243XbK\202n\266\256\333\211\320\210\f\277\354\335e\357\366\212\370Rf\217x\301\335\323e\227Y\270s\335\215r\211\342Q~\233\234o\356G\351x\342\264\315\351\367\017K\354(\f\013\374\311\001\177r\300\237\\\022\210$\032\007JF<\340\207^\214\357IK\022\212~>\"^\217\203\255\301\222\021\220\267\241G\024@\251\310\267\341\207\324\240W\364\343E0\352\375~<\016C6\035\224x\017<\034\001\211\322\035*\3403\032\332\375|\274\243\335P\222\322\256"
+	.ascii	"n\221<\364\222vKHHI\273[\261\276g\354\301\236\036[\234%\317\234"
+	.ascii	"\372\t\355\253\255i\231@\265\255\244\r\341\221wjK\023\327\007"
+	.ascii	"{-+YCxd\236\306\351)\223\211V4\202\274\254\265\326\263\257\366"
+	.ascii	"X\222>\204\307R\327K\311\033\302c\357\201\247NO\235\354\265*"
+	.ascii	"\311\037\302c\351\323[6N\343zj\367g:s\032\250o\274\251\342\313"
+	.ascii	"\212i\332\346\006\202N\337\364\205_j\002Y\2501$\345\220RD\031"
+	.ascii	"DF\202\t\246\002m\213\001p\002\231:*n\021\24055R\245\240\345"
+	.ascii	"j\310\3348\034\343oz\351\371/\270\263\314\372>\275R\266X\001"
+	.ascii	"$\214hab \220\024\302\226\255b\211\263\337JV\211U\260.\353\031"
+	.ascii	"\030\244\364p\223 \345n\351l-\322\220@\330\302F\223\372\217\f"
+	.ascii	"D\030m=MyP|;\327+z\2307\323\206\364\304V\325\3253F\027Nw\274"
+	.ascii	"H\273\215\330\006\267\2064\247\315\022\r\355(\302\177\333\314"
+	.ascii	"\to<\214\274\302\302M6\373E\252\234h.\371\361$\016\340M\300q"
+	.ascii	"2\016#\315\266\210\221\020\260\340S3\227\026\314\321\022\243"
+	.ascii	"r#\200/6e\357\305.:\257\231\372\001"
+	.text
+	.section	.gnu.lto_cliRxRange.267.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\007\002\025\022"
+	.string	"&\341wH\300\324M:\344Uu\225e\301\034\020\216>#\314\030\3302\356\007\372?\020C\001t\220\332\345:\201C\025\177P\033\317Fj\235>\316\250t>4\211&\031P\270\320\3543\2013,\375/\017H!G\365Lk{\223-S\n`"
+	.string	"^"
+	.string	"e"
+	.ascii	"\273BKL\273\266\005>\260\272\264\355)\363ru\224y\351\230]De\266"
+	.ascii	"2\0068\037<6\222\354\256\027_<v\325\224]\324\230\377\243\233"
+	.ascii	"\2005\331U\253\237O\271\303\252\315\264;\251\375<v\t\302\246"
+	.ascii	")\0015\235.\205\026\003\374\321\025E-GU\365`w\255`M\305\275\272"
+	.ascii	"\355\031\333-\266:\b:\252\304&\332E\373\025B\017>\002\320\301"
+	.ascii	"\"\304\205:Qf\333r4\016\331\217\271\\.\347(d\337\350\227\267"
+	.ascii	"\375\335T\253T\377\344S!\255\307\3479\236vi\271%\013%w\310\260"
+	.ascii	"}\217\210r\021\004d\022Gr\364\211\"\n*\332]\226\262l\253\255"
+	.ascii	"\204\324\312\325~\321k\304nt\363\001\001BT\364Ho\262\260\332"
+	.ascii	"\3359xa\265#\001\301%\206\fzP#\001Z\213\024\270p\246O3\332\214"
+	.ascii	"\016E\375\233\351k\230O\372\222K\374A\264\213s\360I\366\312q"
+	.ascii	"\274\230\234\240!!R\264\273\r\224~\003\306\207q\351\326\247\007"
+	.ascii	"\277y\371w\230\266\353\203\036\364\225\2164A\361\234HI\310\024"
+	.ascii	"-b>n\270\r\t\256\371h>\330\264\007\026\033\230g\003C\371f\\1"
+	.ascii	"\237\fL\013\007\231\226\312-\026WL\313\233q\301\310x-\030\215"
+	.ascii	"\307\222\342\027\210\017\346\325\274^0\217e\303y\267Q\250\002"
+	.ascii	"\215\305\20581\247\333\335U\031\320.\312hC\210 \017D\252\307"
+	.ascii	"g\026\320\337\336\303E\006\2719\275\004\350\341\341\t\024\234"
+	.ascii	"\240ld\205\fH\306!+\270F\023\267* \240\202\231\252\262\003\351"
+	.ascii	"L\217\302\377c\314\212\207$\321(\\D\203\344H\007\030\230\022"
+	.ascii	"f4\331\005+M\276\246\366\001#\343\362\304\037\234\254\301\200"
+	.ascii	"\b\nY\262\256Ks\253\354K\314!\356\212\242\261\036\273\b#FHlY"
+	.ascii	"6\275\242\215\005E\300Y\tn\344^\310\344H\n{\212G\3235\204\n\005"
+	.text
+	.section	.gnu.lto_printServo.268.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`E\007E'"
+	.string	"\372H\260\017E\200\334\321p[5V\251\r>Q\331\2401%\225~\246\037\331\337\323\356\205\216\370\357_\251\256\033R\277!.\304*\254\300\021\004\335I\266\277#T\006K\361M\026rI\370\001\r\003p\300AE\324\366\336{K\231d\352"
+	.string	"\322"
+	.string	"\347"
+	.ascii	"\30153\262\354\265<\271\2673\034\346*\304\270n\t\025\203[X<\220"
+	.ascii	"\300\273\331\016\3273\256=\322b\360\213\t\365\310}\331\336~\356"
+	.ascii	".\026\0338-\343J\364a\023D\206\335YW#\203\237[B\375\371\333\356"
+	.ascii	"\366\225\033d\303\016cY*\260\361Tx\257\202\343hh\325\262\"|R"
+	.ascii	"\177\256Q=\357>\354Sx\027\313\261\266u\3552\333\262"
+	.string	"\256\306\247mR\177\342n\204\3764_\204\376\\\336.\234#\035k/\3022\017\220\354\316\272\256\271N\262\352M\343\027e\336S\3644\233y\373\343\227\220e|ke\304\336S3\345\341CM\020\021hR\230\023g\310\313|\214\372<\001\362\363\307MSI\255\214\224 \242\016s\211\310\221,O\236\207D-\356\227}\001r\314\312Z\031\021\3109\265\260\256\353\262\220\270\365U\277\273Bv\267\310nj\006g\030$\231o\355\270'\213\227}\344\241D\353\375\341\005\315\340\nz\267\312\005_\330\240\215\266\210\253R\316\257{\273\306\036\367\327\356)\314\3719\331\366\332\205\020u\264\257\203\217\375\271\237}\241^\345\177j\360+\377\202\213\375\nn\366u:\226o\023\323\257|\227R^\0046^\\\312{@\3455\220\362*\251\274I)/\222\312[ \345%\240\362\036\245\274\003T^\001)\257\221\312\033\300\306[\224\362\022\251\274"
+	.string	"R\336!\225W(\345\rRy\201R\336\037\225\367\226\362\372\250\274\266\224WUy\323\224\027=y\317\224\327Ly\033\345e\224\367\0234\224\361\251\215-\365\364\232q\355\261\314\263\2369\323\232\034\3557\373\317~,7w\277\373-\373\264\275\241\021\025\003l\272\0028\245!K\3035\205\317$V\333\247\177:\250\207\232\250\213z\277\266!E\262\314\303\025\266\256\277\0139\250\277g%\370i\266\207\017|\341\232k\221\356\355o\003m\352\242\376\217\013@\023\205\270\032"
+	.string	"0\241\036\032q4BZ\224@\035D\342f\200\300n\375S\342dngJ[\373\230\270\030\033\230X\332j\247\305\035\307\335\023\007\223B]W\255\t\373.<.\025\352\222\237i\177\013\231T\212e1S\243\r\241wF\316F\373g\037\310%\252\315N\213\301%\220\301\273\243\272\311"
+	.ascii	"\323\204\370\\\356\240\241zW\212\212/\354n:]E\316p\347\332A?"
+	.ascii	"\355\"\212\3018\277(\276\327Ybgi\366\327\356q\240\271N\362B\322"
+	.ascii	"\253\243\326F\213\361,\367SCu\277\371E\371\371\212A\337\334"
+	.string	"\377A\361\361r\233\372\375\344\003;\345\204\3339\341\220\206V\304\260\272`\303\200\365B\267\233A\005T\365+\032#X\304\250\232\322Q\265\360\031A\343\305N\267\202j\212\b\013\206\356J\007\302\252\306\025\025\326\315\005\226\316\203\f\030\273)u\245\240\252^H\345bT\351`\344\244\256\260rPFk%\203\352*G\303\312\352*w3\256o\257\343\325\264 F\245\234\254\366\245\375\2656%'\316\306\204\270\003\230\344\035\256y.\365\217\267\025\211A`\222\0334S\017_v\016\363\352:rs]\327\025\355\257}\332mo\210<\200I3\252\237\274j\2078\004&{\277C\235z\370\264\237\304\036\300\243\t\241\327l\246^\352\241Q\017h\002\215\324J}\240q\b285\202>p\317\323\274\251q\006\372@\035\003`I\2554'\251Q \273(\0134R\234\002`GM\340\315Q\243@zQ\n\350\001n\0044\n\344\230"
+	.string	"m\324hQ\350%\177\250a8%\211B\204Dd$\020\021\0225\215\001\320\002\021\262\215\033\021\020EG\306L\204$\305\003\322\270L\202"
+	.ascii	"{\356.\234H\036\313\247''\374\240\002\322B\"Y$\265\334Q\324\242"
+	.ascii	"\326\0244\210\034~y\363\367\253\005j,\270\036*)\201I\b\027\225"
+	.ascii	"\207\213\256\213\207n\303\030\n\342\037\246\021\224k\3669\216"
+	.ascii	"\264\226x\013\217\265\252\273\354\354.!\373\272\"\327x\034\313"
+	.ascii	"\"\244\300\376\257\261\213L\365Y\266f\350\204\370\214]\201.E"
+	.ascii	"\206!?\274\032Z~\221\036\225\252y\274)\353\327\366\376*\351\326"
+	.ascii	"\345\362\240#\371\362\241\"\231\374\272[j\226\225L\r\244\366"
+	.ascii	"\367\314\353w\023V\257\212gQtC D\033%\362\261Rx\330\333\034:"
+	.ascii	"\231\262\002\001\367B\254\037\357\370&\030r\244.z,\203\335o\220"
+	.ascii	"\326.\255x2\260\374.AC\213-\363\325\303~5\350\236\371\372 \025"
+	.text
+	.section	.gnu.lto_cliServo.269.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\313-\225\273"
+	.string	"\252*YBJ Di;ckc\022\001RLVa\226p\013[\021XgEt\206]u\354B\022\353\\\203p\372\023\\\366\376\np\277e&\307\323"
+	.string	"\221\034?\375z\226\371\335\267M\r#\335\357y\001\037f\264"
+	.string	"\002\t\tm\"eJ)\005+\004\223\0036\004\030\222}\312\252\031\241?q)n\263\362\004]\212\223\\V\304=;\016\337@\271\024\377]^b\027\232\277}W\346\022#y\210\325\257\317\0254\211|x\210\225n\317c5\021mO\t\334Y\254qf\215%\360\0169\255<\334z\270\311H\347\212\226\220\345\035\356\305\260=h{\022\351 \017\357\306\240\372\016\263xc]\\\206m\0071\221\220;\021N\217\331 7\353\316\254\024\376q\323\001\202\343\232#\227\330\305\005\370\307\354\034\b]\\r\332\257\217\361\234\356\373R\253u?\226\335\346\001Z\021{\303\035\247\t\267\365\207\327p\230\233\374A\277\341!pqf\357\373\352q\263\333<0+T\020,?`n\272\341f\035\325\031\326\036\3569\3566\334\254c<\347\224\332\213\305\204\223\262\007\215G"
+	.ascii	"z\216?kMb\027\332\373\276\315\241nk\267\206k9nZ\233\r\264\343"
+	.ascii	"\006\220#\n\245\305\202#\363\276\257\216e\267\037\2431$\337\232"
+	.ascii	"8\245\264\324\275o\335\2155M*\274\201oc\231\301\262&\276\257"
+	.ascii	"\332\214e\253\3515h\2631^\277U\336\206B\007\213M\342\373\276"
+	.ascii	"G\335\262\213e\267N\326\325\232\024\242hgn\264F\003\355\264\002"
+	.ascii	"\264\205\367\375\262\326\275\257Z\n\036\261\354\226\325:(\331"
+	.ascii	"\355\2621$\273e\2062\037jx\362J\275\300J\233\266\355y\337\027"
+	.ascii	"\351\277\374`XrX\222HA\343_\306r\271d\3438V6\253\326\3146\241"
+	.ascii	"\315\177\354\307},\207\3718\016\3571\034~\303z\234\307x|\307"
+	.ascii	"n\330\216\333p\035\323\361\034\313q\034\263\341A\2662\034\277"
+	.ascii	"\261\033\257\341"
+	.string	"6f\3435V\303$\260\032\327\301q\303F\r\0323XPF\f\003`0\235\027.Z\024\300b\005\222\212\024(\216N\230(aD\242\210\347\214\020A@\b'\210\017\036\210:p\330\240aH((\003\206\013\026*P\340@\240\t?M\246\273d@e\262e\337\241\334L,\251\346?\277\267\346>9|q\320\366D\200s\366\206E\272b3\206\210\0325c+ \226i\2437&O\f^\230\27317`\354\304\332T\353\302\350\270\314\021Q\243]n5\202\263\034\273\334\302\306\270\322\342\034\307\206\253y\020\r\235\263\225\341\370m\217\335\264\374\245\342\274\206\210\032\335\232\342\334\006\305\231-C\340\232\032\253f\022X\016UlQ\237f\261P\243T\316j\025\274\2424\327!\242F\245\3149\016\326\231\345\3527l\324X\361\370\3504\370\364\f>\315\202l\205\367}\211\250\3218v\305\342\241\313p\354\030_tE\313\224\316"
+	.ascii	"\266\006\032\263j\007^\355a_\215\233^\353At\030\216\315t:\360"
+	.ascii	"\nR\210\032\225\363\027W\242L\335\\\340\271\343-\212\256@)\300"
+	.ascii	"\216\035CgQ\330+\b\355\024:R\037?W"
+	.string	"1\310\347)\3444\212\301BEj\0259}\324\027\307OD\356\271\211\022l\226\021\0359'1\327Es\315s\350\330\370\b+pS7\021ql\234\200\"+hBX\341\334\371\326 \322\274\371\207\264\366\200\306/\315\211X\020_\\\034;\360\352\r\353\214\3637E\363\016q\316\234\203\227*\"\364\006e\2168\275\324c\205K\221ZE\204\326\340/\254lM\351\262\250^iz\210m\361d\017W\007^\231\261?\217S\301>\300\325\030\027\022\243g\346A#\204\361\fn\2708\0060}\301\202XW\250\272\ts\n`\232\003\331\023]|Y\035x5\306\006\001z\335\021\242F\255\016\004\207uv\371\004V9\345\252\016\0215\232\306\306PD\314\242\345?^\252pu3\004S\231\203ZEK\273YXg\233\016q\200\253-_\266\023\256f@\326\031x\265\205u\276\357+D\215\302\2712\003\325+\255\223\354\211\3046%"
+	.ascii	"aM\331 *b\252\232XRo\331\345\373\276@XO\330\030n\205\025u\226"
+	.ascii	",\253\277\345\232\r\341m0:h\305\312jW\346x\337\227\275\n\253"
+	.ascii	"J3\222f^\2221\367\033\363\b\035\001\235\370\306\350\310x\201"
+	.ascii	"$,\272\017\306\320\262d\362\233*\306\305@\313\330\307<\f\324"
+	.ascii	"\f\364\f\364"
+	.string	"\fz\226\3546\371\335\246Y\3107\306\263\006\323\026\025\\>\030w\007\231\205\361I\372/n\237\311\032\001\336s.\006E\263\204\246YJ{j\324-\373\314\007$\340]\325\276\r\020\236\274\024\212\226k\262d_y\267fO\027\032;'~Uzp\356\002$\271\031H6\235\1779\340t\302\336\327IW5\0353\n\367\342\321>\206\211\306A\353\226\275\213S!\340\036\353\226%\350\341]\325#\331m\367\217$s\220\n\274\253\270\345\332\202\325\353\354o\232d\331#\377s\324?\257\341+\004\300<s\n\247\374\261}0\016\262\333\212\374\261\333J\363\243>\362V\024\354\264L\371V\363\023\354\266\372\274\241\274\221\267rJ\376'`8\345\217\354\337\377\357mS\255d3^\362\310\373\277\334T\204n\2224\362\375J\252(\215\323;\366}\337\227%@\327\330\026\221f\354\032\023\222T\363\375\350E\366g\344\231\371I\246\345\232"
+	.ascii	"\021\276\357\033c\250P\313\211_\031E\037\371N\363\314\302(Wi"
+	.ascii	"W\324\257\257\366\276R\317\027\274\347\032.\203\t\204U=\347V"
+	.ascii	"\210| |_iW%-\245H\214\272m\3513+-yW5\224o\271n)v[u\216\211\322"
+	.ascii	"\227bV\2136\253=\230\332\1771\253i\266\346N\323u\315=B\3335w"
+	.ascii	"\b\275\327\334e\235\327\334d-\330\334d\232\257\271\303t_s\217"
+	.ascii	"\265bs\2075cs\177\351\302\346\246\266aswi\310\346\346\322\327"
+	.ascii	"\346\326r*\315\215\305\245\315m\325i\335M\325k\232\033J\253u"
+	.ascii	"\267\324\2514G5d3T;6?\265b\263\007m\330\274\244\3534;\265`\263"
+	.ascii	"\222\346kN\322}\315M\275\327\334A\3475\003\240\355\232\231\272"
+	.ascii	"\256\031I\2635\037\3515\315F\\\347%\327\271\210\353\254\344:"
+	.ascii	"s\340:'\271\316\0330\235\2110\2355`:g\300t\306\200\351|\001\323"
+	.ascii	"y\210\353,\304u\266\300u\256\300u\246\300u\016\342:\003i:\377"
+	.ascii	"h:\373p\235{\270\316\023\270\263\004\256s\004Lg\b\\\347\007\230"
+	.ascii	"\316<~\234w\3748;\300tn\200\351\314\300\217\263\216\037\347\005"
+	.ascii	"\230\316\n\270\316\t4\235\021h:\037\340\3169\\g\034\256\363\r"
+	.ascii	"\246\263\r\327\271\206\353L\203\351<\303u\226\341:\307p\235\r"
+	.ascii	"`:\303\370q~\361\343\354\342\307\271\005\323\271\200\2463\213"
+	.ascii	"\246\363\n\327\031\211\351\254\242\351\234\242\351\214\242\351"
+	.ascii	"|\344\316'\\g\023\356\\\302u6r\235I0\235\213\\\347\021Lg\021"
+	.ascii	"\2563\001L\347\020Kg\347\322\031\304\322\371C\323\331C\323\231"
+	.ascii	"\250\351\334\301u\346\340\316\033\\g\r\356<\304t\026j:\0075\235"
+	.ascii	"3\270\316\030\334\371\202\353l\301u\256\340:S`:\003\271\316\023"
+	.ascii	"\232\255\371\307un\272\316L\327\331u\235\227Lg%\3239\351:\267"
+	.ascii	"\356\314.\235\177\351\354K\347n6<\344D\347\264a\245\371A\265"
+	.ascii	"\227\312\025\362\375k\355\3068\225vi{U\367\265\033\262\333\261"
+	.ascii	"\233\261[\261\273\260\333\260"
+	.string	"\273N\267`7_w_\367^w^\267]w]7[\367\232\356\267\356\270\026bnf\217\302~\305\315\272\352\025\307\304)Q\370\357\370\302\272\320<\n+\031\371\314\246n\305M(N\005\365*\017\330\367\35551F\r\315Li\331m\377\021u\375\364\364\356\324\035\037\032\006\360\371)O\305\242\247\217a\3007\253bn\323H\030oUE\365\342a|\273\370\026\377\302\305'\345\n\370\026ShY\363\353\016\022FC2?\263\274\224\207k\375\251\177\342@\262\333\002\276\037\373\350\353\016\262\013\315\214:c]\212\374\027\273{1:\354\225bKG\355\301[y\360N\375-\262'2<\370\016\373^\354\037\325\260\253S\255t\305hl\254\240\330f"
+	.string	"d\263\350\343\323+\236\305\227_\361BpU\272i\244\223/\377r\322\256\350#}\277\324\263qB\231\273?G\346'\327\277W\025\337z\272\315\263\306\235\245M\t\302h\3342\270\264\244\301\274H {$|qx\3309Rd\221\271x\306fJ\246\350\307fJ\242\370\024\324G\301BZ\333\242~T\264Z$&\306\240\343* M\332\212\356\362Cvi\272\220\216z\t_\037-\371\243\007*\344\322x\202\372\027\2000u\342\t"
+	.string	"\027\351\310\242D\227\177\353\227F+\304,+L|S\357x\t>f\324m\t\023%\276\355@\236\031\240\257\f\022\335\031\326K\213\241\n\024F\337\032\036\035\265\223\323+\331\350\276\270\200\212{)H\274\3217\241/>\025\237y\226R\317\342\364FEOB\217#>\033\333\202 ]\330\024\214.d~\202\340\207^\034O\321\367`\353\340\202\323s\226\266\324\213\202\241\260\363t\364\360\344\263\2246\2376\374\322\246\352\320\314\321\203\315][1U\\N\214 |\366y^\227\322\3263\342{\361\013\032\0238\274\251\242\320'\206_\316|e\371\225\020\001\025\301\005\241e \346\210\370\026o\032\251\242\233\236"
+	.string	"\023\\|\214\366\212\232\314+\305\224\216Z\211\222wj\322\260\216\035\t%\337d\036C\225+\004\325\001\241eE\177!\276\351\364\0178.\304i\222j\256K\021\003j\221)5\365\327\"\240\342\0345d\002G"
+	.string	"\002\262\250\316\021\261\245\235\206 \376\303;\277\3553\325\002\361\312\266\351\235\\{\370\017\337S4\217k\242\367\220\344\211XH8\277\316\263\327F\300\2349\235\303\206\035\310\020g\304\200\3500?dwf\312\207\243N\302\224\354\360Mm\372\016\017T\250\305o\032\351\334\020\346\335\013#\b3\207\036z\354\207\354\314\314\021\035u\323[q\330\333\300\341\177\270\333\206\357+8\275\0172|hL\216\326\034\020<h\370s\274D\243n\2074\f}\373\3419\222\255!\201\350\301X\316\213\305\213\003B\207\r]\366\255\241\206\243\356\240\003\f#8\231\302\241\203\357\262\277P\335\032\024\n\3636\3202\020au]\265\b\200\027\372\216\323m\026\334\334\332\240\333[\360\322\005q\303\2031\221\035\331\241P\223\265\001\354\310\322\202\216\032"
+	.string	"o\305Y\177 h\250\341M\365\334p\240TP+8\235c\352\245@dY\207~\264\232)\031\324G\341z\205,\323L\311\f\037\324d\237\341/T\265\2562\374\3023C\251@\261\310\376\255^\266\374M\275To=\232\021\302\360M}\343V\250\225+Ki\3331\352\366\002\206\377\221\342\302\267^\267Wpmg^\306h\030\364`\354?EYnW%U]U\206\007c7\313\205\016\341[C\016\216\232\351\255\316\026\235\203[\310`\350\020\376B\225\212\333\205\no\241\rj\200\242\255\245\264\361,"
+	.ascii	"}\205\301i\244\023\013\024\276\357\\\rTK\321\226\245\264\323"
+	.ascii	"\2360=\205oV\251\350\001Y\307\322*<\330\230\006\372>\300\230"
+	.ascii	"\247I\003\372v\323m\326\033\244\207\2547\220\024\336\216\255"
+	.ascii	"\f\007?\377lni\326"
+	.string	"\230|Yi@\0176\001\r\312\245\313R\332e&\374\242\227\234\277'/5\341\301X\271\327\354\021\276\025K:j$o\205\344;p\255[\255\317\230\337O\217\360\024\252R\256\336d~\323\f\352\005\266\2246W3\371\314gV\247\370M#\231\017\306K;7\003\255\202 \004\263\2246\025#h\030\350\030'\212F\362\356\267\264K\371\313w\271i\244\023\277\036\200\214L\371\001\334\3019\303)\312\271\024\225\364\344\f\301E\204\270))\311\223\223\022\247sF\221\242\f\274\004\365\264\304d\351i\311JLMJ\003PRZ\340\0335\2347D\324p:E|\340$LOQ-75%\261,\027)\nb#F\234\204\330\345\f\226\2120==-1q\272\3009\304E\212\234E\212\234?\f\365ATR\024\224\222\221\250\200rb\362\264\004\205\024\205\344\bS\223\221\016\354t\250\246$&l\022\246' MIQNQ\256"
+	.ascii	"\226\212(aj\227>hJb\32225\324\221\247$\366)j\311\022\223$(\345"
+	.ascii	"S\324\222\217R\362\201\223R\273\244\204\251i)IR\004E\222()YI"
+	.ascii	"\005S\223\022\222\022\246\244$HJOPH*\202\330i\311\322\023R\224"
+	.ascii	"\223\323\023RS\315I\263Z\016'\037\005\332\300m\357\342\004\343"
+	.ascii	"hM\2114y\353\036@\307\375\324\370\032t\324\340I\327Q\354\032"
+	.ascii	"_\307\304/y\202\031t\242\032\337\340\223\236\203W\372\"\277\364"
+	.ascii	"=\236\277\204\247\033\245\240\236"
+	.string	"Y\027\032\336R\372a\214\272=j~\352=\341\260\357\226\227b \277\364E^\3519\370\244\337\340\223\3253\304\252E\"\277\230\250\230(\344\211\fj\020\347\017\357\340\271c\301k\3407\215\314\340\r\t\013\t+\370\f\276Y=\323\303@\316\327\021\244#H\301c@w\201\337\007\376\001\376\005\371\013\276Iu6\004\360\373\240e/\310\207\346R\230\013@\370r\370\200\374\220oR\231]{|[\275kfG\312j\3660\360\200}_*\016\257j\267j\021w|c]h\022\325\370u\312\224\316!\306\216\335\005\375\250d\344\373\002\005m\310S*\344'd\361y\255\361m\021\342\330s\201B,x\345\035\237\327Z\337\031\230\005\017\306m\301O\270\323\273\336\265\026\274\0176lg_=S\001\205:wJ\357\272\326\327N\261\241`\t\231\n\376\305\235\036\237:\266\333\n\336\207\365\352\350\312:7A\202\374/\256\3615\335\346"
+	.ascii	"\241\340\201\274\213Y\353SA\301w\031\353\365\314\202\232\252"
+	.ascii	"\037\017\306A\036\310\277\227\346\320f\345#\256\2034\226\320"
+	.ascii	"\"\245G\220\237\220\245\227'H\327(\241\315\004\024\004\225wz"
+	.ascii	"y\326\372\230/\214\212\004\017\306\317\006\310O\230\322C\\\223"
+	.ascii	"3\345\217)\200\274\017k\344YG\360`\034\326?\376i\255\357\277"
+	.ascii	"\264\217\377\321\343}\374\343Y\366x\267j\326\316\332\307\021"
+	.ascii	"\002C\036\215\345[\261#G\035\365Vm\201\314\307E\277\007\242\276"
+	.ascii	"\261<\006\2701t\322\t\336\255\030/\003\241\343\251Z\224`\202"
+	.ascii	"'\362\304\"\301\373U\267W\326>gv.\033\2662\036=F\314\330\221"
+	.ascii	"\377R\262zfv\200\301\343C\2743\016D\260\366V\020|\004\337x\324"
+	.ascii	"\236\215=\364\225\007\351Si\322 \370$\243\025\3211\315\037\370"
+	.ascii	"\326z\227z\264\347\034\017O:K\251\0272\360\017\274\262\032\246"
+	.ascii	"q\032\311\343\317\030\243fgv<\017\007~G\003\357\200\031\306h"
+	.ascii	"\231\262\006~\307!\2344\006\236\214\314\030\035\317\300\002\257"
+	.ascii	"\343\333>\322E\005~\201\3570\320\262\346T^\242;a~\356\37110\n"
+	.ascii	"<"
+	.ascii	"\212jZk}\002\"X\017\243\203k8\216\254\256\001\177\342O\214\306"
+	.ascii	"\3700\360`\254l\246$\002\337\324\353\265\231\222\007<\002Z\177"
+	.ascii	"\300\003\025\206q\313\241\225\343\375\035t\264s\222\247\217\215"
+	.ascii	"\216\007c_\223W\326\201e\234,\220@s\371\326\320\310QC-n\r\216"
+	.ascii	")\320\\\376B\025\fb\0028\276\334\016\3077\253ct\322\256\250G"
+	.ascii	"\306\361A\340\306w\344wy\016>\013\227RG\003\3657\276Y\005s\225"
+	.ascii	"vy\201\373:\340\331\230\264\3417\345\217v~\313\263\321-\203\267"
+	.ascii	"\347\312\374\324z\256\327b\343\273O\267X\254~gJ0,\\r0\266\221"
+	.ascii	"b\344\277\360\362\270\336\023*8j\374\326\023\017\342R\352ej|"
+	.ascii	"/\2125\336\020St+4!\330\240\361K\276\357\374\225\247\"\b\032"
+	.ascii	"\317\254\212\rV-\316\250\002-k\262\341\215\341a\206Fy\254\253"
+	.ascii	"\031\237\224\263\344e\354\250\212\371\315\220#UcF\214W\212\025"
+	.ascii	"9\n\203\244\250\002\001%\217\223\222)C#\"\"I\222d\030\003B\013"
+	.ascii	"\020\204\343h\036\246\364\006\022\2403=\n\264\214\251\032\221"
+	.ascii	"\2214I\007\206\024\304\036e\300\236\002\240X\363\375\007Z!N\247"
+	.ascii	"\t\235vE\255\211!\202c\217\300|nB\036Y`q\001\270\276\331\255"
+	.ascii	"9\bP\332I\230\267\005a\271\272\3341\370\355\030"
+	.string	"\027\350'+\257\013\300\355V\301\246\346.\200\274F\310\243P\275\025i\235\367\f/\004\331\212o\231\313\322\363\211\201C,\032\2666\3522\025\023\331N\366T\271@<\033\205\241\021%\376>\332\3343<\017[~\024\221R\037\364\366\257}_\330&\365\363\254\367[9\024\0074\253j\007\210\256\274\200\245\320\311\273\364\206\267\311\214s\375\374\032u!.|\207zI}\302\360\211\270p\227\374\300i@\016\313\270\272\001xd\265It\036\254\226k\352\267\005cx\227\3220\254\210\312\020\344\207\325\320\374f\246QR)\323$9a&\t\205\250DK\020_4\357\0033\0040w\222\217\035m0\365Si\247\253\\\266\034=\377\271L\307Z;\233l\220\262\332\250\203\303\362\343\321\350\\\232\275B\030v\222\356\013\300!\313%A,\022'\243\230\212\263\223\304j\264p?\240\265\034esf\020\206,\307\267\330\354#\221P\250\335"
+	.string	"}\357;\220ow\006\020\364\230:\023\377\235\274Q\024\242Q\261\033'Uc\261on`#\0068\324\360\005z\\\017\320-\001\030`\321\225}\317n\025\b&@\372\"\231\357\270\300u\346q\002\335M\342Fi\031J\237\016I\254k&2k1\200\033[K\t1L\352'\342\307\257\262\212G\352d7W\312\221l\362\250T\346\213\202\264\\\340\306z,H\216\026\350\bt\206M\325\254C\307\314\3679\234\202\352q\233v\t\274\3348\032\305\331E\032}\212`M\226\342i\021\233\036\333\\U5>\3257\215\rf7"
+	.string	"xt1K^\244K\347Y\r\n\213\301+U\266b\304\253S\216\006\304\324\301\343\206\366b<\304\267!\002\3764\377\031\023\373\007\234~\f\261MzM\3158u~\3767,.\226\302DF\351Nc\013\307\345\020U}\247g:\354\237\274>T\023\342'\030!\020D\021\342p\350\"B`@a\320i`c\036\352\242[\005\270\0278\230\247\031\027\215g]\253\246\r\005\\\013\212\251[\032\267\020\3309\3215\214d\317\254W\275,\211>\365\t\016{)V\242uE\304\246vz\262U\245\026\373L[\216K\f\234\332<J\021R;\334\347\036\304c\374ZX\245\266r\200\303-\341h\022\200\221\371C\221\232\207\037\036t\020d\306p\376\373\372\245\336\203\252\343\\6\006\304\033@\305\340dH\006\"\241\225Q\317\326\352\230\243\330\271L\323\t?n"
+	.string	"|.j\365\274x\bXt\3351\325\024\2071Cn\263j\335''\330\031\235O\3066}\374"
+	.string	"\2705A\311\233\314\244\330\301\004\366\301\231\245\013\n$8\315\"\017\026\253\256r.\346\303\320dtu\324\334w\327\217\276\002Sg:\230\276mTR\216\245l\f1\021\200\223\266\2133N\033&m35\225\225E\233\tk\001\324\f\372H\035r\367\352\340\317\334\035\033\231M\3708\355)\314\227\210\361\220\217.\227\331\032\201\215\372\034\214\021+\336u}\020\366Z\004|\300\031\005\007\177\205=\351\204\246\327"
+	.ascii	"\271\343\bczF\310\316\270\027\244\300\026p\260\361\032h\233\236"
+	.ascii	"\307\003\032\304H\030\251\322\347\215\205\016\265\"\335\342\351"
+	.ascii	"\245\036\033$\221}\n\364\2008\270\326\264\274~\200&\262\367\244"
+	.ascii	"\322\020 \310\2168-=0\207\354\006D\303\356D\303|\327\214\316"
+	.ascii	"`\370\352<\214{\237\256\247S!h\260\026=~\345\325.h\310\252-%"
+	.ascii	"\\\276e\233\365S`\225\300`\264L\275\350W\233`n8\263\316p\377"
+	.ascii	"|\311T\211\336\376\255\312\274\326\217(\n\213w\355\\\276\266"
+	.ascii	"`\2070\b\257\2118\211\223\376\013\373\260g\326\004H\177\212e"
+	.ascii	"\377a\2410\336\017^\037\020\353cL\331Fi15fT\304\205Y\ty\0044"
+	.ascii	"\305\2019:\257\260\324"
+	.string	"L\002\355\b\037\271X\256\fP\302>\340\310&\277-\2607\334{\330\242\343p\020\334b\334M\234\321\311\274^\366\343*z=O\274q6\224\314\216S\265)\212\335\325\302[5\277\033\254v\350\265\346\266\332\260\252\327\017W\t\302\334\205\323\n\3221\371\0201\017YM3*\256\344\223\303\003\310\n-\354\2075w\255mC\257!\247L\200\345\305H\346\266\304\330\034\003\2416\347\273\211\321\001\023\270\230Av\353\325;\007\357\247\236\002V\340{\355\223\362\013\262\210\220\361\314\236\367\263\313l\376\256t\343\302_v\361;?\210\376wH\3036\227\345%0d\312\214\213\2609gvx\207\017\311\237z\007b\337\350Z\314m\226p\304\224\246\311&\324\023\b\205\222\306l\225\226\312X\316<\027o\205\207\301&\3161W\330\343bY\006\312K\367K\224e\323du\"\241-\3411\206pm\252\355s\267\226B\237\034\352\323\310\266"
+	.string	"\303\346\246\034\031\n\2576\274\345\203\310\374ZIV!`\366\rG6R\375\315<\261\366\215\233\225f\302\034C\033\370~\251\032s/\t\322S\220C\254\344\022\270\304\237\031\317F\fy\317n3\337=x\"\032(\232\344\320\214\264K/c\373\252\305,\217\245\341\032?\251$\267\231b\035\356\221\035o\0136|\311$\230m\300W\005p\304l\213\340\276\2706\372F\ff\237\216\002~o\235\036\004B\225tb_\002"
+	.string	"\232\210\314\222@F\"\321\220\210\310H$\232\021\221*\0314=s\246\353\233kc\260\223;\021L\345\253COQ|\331\2022\221\377\220\370\364\2127\306j\337\376\304d\352\373\\\002\226\002\337\245o7\032Lnb\"\025py\020\033\347\233=\220\250\245\275:\271\320\2105]i\333\037"
+	.ascii	"\232,\217\341)oE\241-MD\243a(\335\001\256H\366f\333\212\377S"
+	.ascii	"\344xJvF\340 aDC\232\350\256\202\315\375\277`\302j\366\006\227"
+	.ascii	"\234kJb\254I h\306\272\205AZ\256BH\205\2448M\211\347'\374\320"
+	.ascii	"\372)\214\034\254\030\364<\002\274\211\327\240\211t=U\221al\206"
+	.ascii	"\270\317\2559\215\371\237p\241vW\251\305\234c\355\bMb*\300P\236"
+	.ascii	"\232\335\367\025\263\314\326\005\215X\024O@\025\205\275\351,"
+	.ascii	"\360B\256\230\347\255\242Xb\342e4\207\215\021UZ\305\202\003"
+	.ascii	"\223\022\n\242_+\232\0130\003\212\026"
+	.text
+	.section	.gnu.lto_printMixerRules.270.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\327\t\3752"
+	.ascii	"\252[\374\023?P\350M\007\273\217\263\204A#w\230\244\211S\311"
+	.ascii	")\003n9*\202\302*N\341j\342\204\241\266 f\275\233\356\024}\362"
+	.ascii	"\202:\202J\3250T\034\005\220\236T\215\335\0045\021\241M\344\336"
+	.ascii	")\245\0241\001\017\0011\001\375\344\240\235Fk~\302\344p\323\341"
+	.ascii	" \317\001\302t\003\335F\002Z\343\303\350\253\343p\313q\320i,"
+	.ascii	"\2325/\022x\267\254\343\245v\332\035\307A\2060am8<\212d\315\233"
+	.ascii	"\304\262\2755\337\362\356mfu\312(\230\337\215\217I \330\244\261"
+	.ascii	"\340\315V\263\366\032 PL\327\f\016\315\201\332)7\325v\346~\353"
+	.ascii	"\345\332\314 \374\273\367\212\236:\3676\035\260\002\265\323b"
+	.ascii	"?\331N\321v\262\235\362\312\254\bj\310%\233\260\266<\266\311"
+	.ascii	"\273\367j\375\026.6\332l&\372\332K\304\2410\b\374\251>\233\242"
+	.ascii	"\357+7Y/\241\235\027%Q\007J\243\202f8\nR\322rN\234\330Z\324\222"
+	.ascii	"=\234\322\302)R<HuE-J\003Q,Fv \365S\222/h\355\226"
+	.string	"\006\305\177\375l\252@iQ\3504\225[\332\023W=\331\276\265\266\350T\335\334\030\"\362\210\"\220b\305\031D\236y\332niT\034E\261\222}\226<\001\302\202(\2104\363G\235\236\310\021\"\"\207\240\r\b\205\201\322q\355F\220e\356>\r\367^v4\244Z3S3\267\0253?a\376\005\003\377fsi\340\226\324\314\025J_\311Y\335/\324\322\250\220(t\350+\231\251\031X\1771\270\273\255f`#\274\177S\334\233\335\321I\231\357\361\320\3776\363\261[\017\341\231c\204y\243\365\377\263m\355\317\331\223\005\013\205y\373\006b\267\276\343\332\235(\361\3248\2523d\346\223\230\233d\376J\346fb\024\007\307\237\205\371B\303i\256\320v\232)\364\234f\256v\323-\241\231\335\021zM7\204f\323\275\225\325\316f\254w\276\262\316\f\336\331\312:/\3709W\275\263\002\353\234\340\347\214\300:S\001\235\213\326\371"
+	.ascii	"\320\331\200u\236\002:\027\260\316\004\200\316R?\347(\353\f\365"
+	.ascii	"\316\003\254\263\200w~\262\316\001~\316N\357\334d\235\001\374"
+	.ascii	"\234\231\254\363\022\320\231h\235\207@g\241u\016\002\235\201"
+	.ascii	"\326\371\007tV\177\316>\353lUgTu~\237\263[\347\3060\342\r\\]"
+	.ascii	"\2335\346\3335o\222\275J\367O\372lk;\335s\272\235\335p\032e\256"
+	.ascii	"\303\001\317\274\206Y\307x\2431z\223O\306\025\036\352DGz\324"
+	.ascii	"\220V2fV4+\032\333\351\200\237\300\366\364\275\200?p\307\244"
+	.ascii	"s\324S\321\216\0325\336\272\\\323l\330`;}z\256;\247\017\300\241"
+	.ascii	"\0279\275]\342|d\246E'\362P\201\373P#\372\200r\b\021\266"
+	.string	"\321D\330N\233\236\002\333\223\351\001|\223\350\273.\246\267M\234\217$\021\177\251D\333\021\315\b\177h\242\007\t!I\002~\020E\327\001\3150\325\377=\220\215\371\346\250\307\234\242\001\255P\277\3618#Ib2^\036$D\200]\326\367}\005\216Y\364\\\227z\257\031\0277\2365\315\205z\357m/\235\372\376\207s\221$fV\333\257\360\357\347\370l>M\341\271\354?^\333\022\375\255\247\360\375\354\022E\226\213\234O\2335+\277W\336\351\255\1776s\216\340\f\241\017\341\271\376\333\234\211\021\376\243\337gnX\377\337tz\005\333\222\356\250'\304\367\236\021\323\312\023\365\225\354i\357\351\226\353f\362\244\364\305r\033m\326\033\341\366\275\322%<\263\327\2277\032w\23460\177\314Te\035\026\353\303J\b\374b\254\252h\254*\202\3210\212\025\023\bk\244a\335a\214\206\2271\007\330PL\007\212\0306\302^x\201\311"
+	.ascii	"\352\240a\364\202\001\366b8&\006\326#\214D\215\033:\306\214_"
+	.ascii	"\302\031c^$p\3240\276P\371\353A\030\215/-\033a^5\264\276\304"
+	.ascii	"\306\264\036<\361\r\034`bZ:n\334\020\323\n6ok\020\362eK\257\344"
+	.ascii	"\226\353\2533\303\013\317\250/\353\261\336H\343\301\031\352F"
+	.ascii	"\357\275\227\370\3126Z\254\277\360-\327i\023g\2422;7\3112\337"
+	.ascii	"s(C\002?\365\007\236\352\025\274\325_eu\227u\214\241\266\274"
+	.ascii	"$\311/\216\364\264\253w\020\365\f^\212-\315\242\243\236\233#"
+	.ascii	"\361#V\257\305V\365\013\334\210Z\325w\036\347\336Z\306\2138\021"
+	.ascii	"\005\257u\367D\360\t\276\217$\374\254\013\301\017\361\320U*>"
+	.ascii	"U\t7+V1\360\007L\270\020\003Y\n\374\024\n\277\005\270$\227L\251"
+	.ascii	"'\360\026\234zevo\364VH\375\217\215 /\215\345P\234<!]G\275X\245"
+	.ascii	".\265\250\252,t\210\222Kf\360\312\177\037\374\341/}\323?\375"
+	.ascii	"\200\307z\356Ik\233/\213\237J\311\267{\317\032m\005\243\236\355"
+	.ascii	"\260\352\024\352#\004\200\261\250Q$e\225bh\244D$\210$I\222\016"
+	.ascii	"\300\002\221\241\242\325\001\021 \265c\314\215\264ev\340\202"
+	.ascii	"\235\331\022\313\224\347\367\025p)\261L\277\231h\371\002\253"
+	.ascii	"\fwH\022\220\312u7\262u\321\303'Bp \216ZBXi\362\262\017\244\204"
+	.ascii	"\312B\327\221\rTf\022\004T2ye\027*6=p\030N<\307l\204\234\365"
+	.ascii	"\r+N\327\324\035A\2476\036\275:\2659\267t58\304\210A_x\301\033"
+	.ascii	"\356\032\313\222\271g\264\333\fp\260\006`A\361^\033\354m\335"
+	.ascii	"\200+\245\250\326\327F\016U\001a\215a\241=.\027O\376@5\016O8"
+	.ascii	"\332\216\351\227>+|7=21)\340\036Xv\377\251\024\001\242!\222\007"
+	.ascii	"\242C\233V\354\257\314\367 eT-.\336\232O_w`T\306\2272\2541#f"
+	.ascii	"8x\006\274T\377\214\311\252\221\021?\241\3621\310\226\244\017"
+	.ascii	"\005\031a$\342F\007~\256\227\363\fy\354\351/J@\257\177\2644\317"
+	.ascii	"u\244I\3205\210\306\357\205\263a\236\362d\271\320In\023\241\361"
+	.ascii	"j\013o\273\365\013\352dh?\230r\353\327\323\222\027\250\340\217"
+	.ascii	"\206L\0070L\r(\035\270\203xz\201\260WgK&\232\273\016\207?\250"
+	.ascii	"\251X\322o\337KR\222c\330\233\260ge\342\017"
+	.text
+	.section	.gnu.lto_cliMixer.271.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\245 u\216"
+	.string	":\345H3H \f\343\031\003\203\031\313_\264\004\3705\2760\361\024\251n\314<\027\3161H\223AH\031v\344\265\262\352\356\351n\017\341\275\362\013\001\303;`\272\034\360\027\264\201Q&\250\272\300\030\357v='\034\276\031\t-\331R\246\224R)\003\324\0023\003\201\fh\344|\337\270\267\276\367}i"
+	.ascii	"\226\211\300\266w\325\334\301\374\354=n?~za@\2430\2737\315\245"
+	.ascii	"vI\244bUA\357\361\257\235\241\302\027\364\036\267ag\022\341\250"
+	.ascii	"\274\357\373\204\266\226\346\322\324\256\3623\257\273D[/\203"
+	.ascii	"*0\262\226\215H\b\357\373\276hv\333\276\355\323\327<K\274\036"
+	.ascii	"F^n}\357\333\247bK\017\013/\231\267\323H`{s|_;\023\315F\241\357"
+	.ascii	"\242\235\205\001\373U{\233"
+	.string	"\354\f\033\234\343\373\276K\335rT\263[#\326\355zX\231\332\231\233JW\211\266\025\016\372\302\373\316\345\365\275\257]\023\0375\273e\273\366Yv\333l\236e\267\314Q\346k\220\330\353%\305\306&\325\022\371\276\357\323'!\"\"\322)***\"\"\"\002r]W\252\250\250H\004\313\262M\314\315\017\3546k\327\314:\243\315]8\217\251\214\307\\x\013k\341,|\307(0\026\266[\241\"\005\212\023&JPM\221\220\212\202\032\301{\"B<91_\023\323\022\b\356\373\240\304^\222< \035u\340\260\301\250\210\210\253\032\2062`\020\n\002\372\361\351\341\331\271`A\007\232\203\363d=\327\331d.[\366=\312\355\325\334\205\363\230\352C\220\334\334\030o\221\213\233\340\220\346-?\234\265\370p\316\322\201\363\335\2313\nf\316X\312\234\355\310|E\245\253\240\364\024+8\2127~B\00571\351%$\235\212\305"
+	.string	"\027f\r)\322\247\206\342\300\200(6:\t\266M\374\343\322d\320\256\254\t!M\352\372Q\321\245\030;j\261\241\026\037\323\370\b\306\346=\2705b\\\204\265C$\366S\342\032Cw\2626\363\2618h\242\264\r\305\201\025a\241\330\364\320\264\343\2407\0256S\230^\n\303\0329\022:\210\302\346>\226\371\003\r\315P\034\230\022\226JMc[_\005\375\003\230V\002\323\354\205\316\223\330\242\271\"\222Cq`l\254\021\341\241\224\317=0\253:"
+	.ascii	"/|R\2765\244\243\352\241\236w\330\353\342\034\366\362|\203\021"
+	.ascii	"\353\357\b&Tv\241\266\030+^t\245\211\2564W\361\330\017\342\300"
+	.ascii	"\336\\\003\273\026'\347\326CU2\260Pb\221D\232\f\332\t,\316\244"
+	.ascii	"\324\f\025\3070\245\205\352\246xP\223A\223\022\246\211\003=\351"
+	.ascii	"\037'\355\343\004\004\357aV\205\351f\0336B5qjO\232\207\211\240"
+	.ascii	"\024\3371\202\202\266\304/P\253tn\201u\262\252\327P\034X\033"
+	.ascii	"\233\002\022J\245\233\353 Q+\322\320\r9\314\25285\270\306y\363"
+	.ascii	"\353\rP\320\210\370\263\277\2124\353\031\275\357\373\023\007"
+	.ascii	"F\304]$\266)R\2765g\223Akk(hl\336dA\300\205Yk2hJX\2371r\213\r"
+	.ascii	"\005m\2103{\342\344\332z\311\202p\364\342\006"
+	.string	"\232&e}\20081{\246\215y\3132\305\2008\201\246\211\261T\223\216~]m?K\003sV\204\265\376\2566[\202\336\227;\304\274\264\265vf\325\373\276\354fij\3153\232yYe\346=f!\312^\325\036M\366\233\254~_^\3318\212l\206\315\2372S/_\003\022'G\220\304\274#0\177\352\334\034,\271[,\273\317\315\260\034P\311\373~\265Y\36713y\231\013\317\220v\275\243R\351\226]\352d0\270\233t\3131\254\274\315\254\226\335v_-\231\0138\300\333\214\273\332\027\362\240\030\036J\337k'o\222\312\222eY\374r\251\227\037\204\204\t\0266e\254a>\331\376\224}\376\2028\301\371\363\340\352K\315\342\317t\376\202X\371&\373\234\277 ?\334\201\007\340\317$X\376\267P\f\363I\366\357\377w-\322!\316f\300%\213\367\377\252tJ\367X\002\360\375\314\262<>\351\027\366}\337\227\335"
+	.string	"\256I\245\002\375\b\327\204\306\262\311\276'\241\004\036\002\360\314\3345\331\325\036\320\304\367}\251\200\254C\276\274\222\231\232\305\267\330\273\326\274\300180\257|.\201bi\317>\336{ME '\321\254\367ZR\001\242\304\367\035k\263\005\232c\r$u\313\30033\340\200\267\231\003\337\325n\037\177A^I\307\261\367b\266\003\363\23727\225\222IG\3769\346&k\261~\2736\320@\307y\253\r\233\265\332Jw\004\020\340\270\221e\243Foiv\240\355\272\031h6\315W\255\246YF76[5c\363"
+	.string	"]\330\034\243\t\233\005h\300f\030/\\t`s"
+	.ascii	"\355\245\271\005\213\336\322\f\300\323\271\352\351\274\342\351"
+	.ascii	"\254\342\351\234\002\352\214\002\352|\002\352l\302u.\341:S\271"
+	.ascii	"\316S\2563\t\327Y\312u\216r\235\241p\234G\270\316\"\\\347\020"
+	.ascii	"\256\363\223;;\265s\223\353\314\344:/\2713\210v\376\340:+\271"
+	.ascii	"\316I\356\354\241\235\221\\\347#w\356\340:sp\347\r9\316F9\316"
+	.ascii	"E\2563\021\216\263\006w\036r\2353\2703\206\247\263\320\3239\310"
+	.ascii	"\351\f\344t\376q:\373\3408\367\270\316<\356\274\343:_hg\013\256"
+	.ascii	"\263\216;C]\347\034w\306"
+	.string	"i\347\247\353\354\266\263\363\351\334t\235\231\235\245y\351:\267\356\314:\235\337\351\354N\347\356\016\256\336\200\225\321\302\326\366\210v/\220\3127\357a\353\367\244\331t\253\351n\354f\354\266v\033v\027v\023v\003v\007v{\351\316\322\275\245\033\257[\257u\230\233)h7\214Au1\222\237\217S\326\260/\236\0137\020Bp\254\342\246$\r\367\225\237^\350\334\340\034\027\323\360U\033E~\"vb\264\255[^L:0\211\n4\273u#G\315\2634\323g(\3501\234@\225\213\024\n\230\237d\306\360\225\336!?\003\333\270u\340(\346I\345;\244\022\t\206;\214\022#\033a\177\351A\346'\357h0,\343\315\220\367}Sh\301K$h\306\250\351\001B\206\305\003\0312]\025\366^HF\277\324[\177\330\375\343O\204CI\307>\343`\260\276MW\234\013\272`\253J\002\267\276\317t\001)\274%\326\t\311\373"
+	.ascii	"\247\350\215\276\031"
+	.string	"\307\240|\321\267\326\033\021}\r:A\310\261\020\\Jxv\364S\306\261\324\360\\w\205Z\257\341\241e\202\215R\312\024>\244\365\013\030\t\033\372>l\366MuK\035\220\022\204t\310\320\227%\251[\f\03104\341\026A\340\360S\366\023\026\231\334Y\203\340\254\bn\020Z\343z\321\251\206.B\337\202\225`\214\024\211 \370V\361j\251c\374\031\223\216\361\275\346\203!\237\233\242\030\017\301\003Q\371\020\307\340\202~\321\251\321i\221\022\2746[\003\343\203\276\305\364\f*\337+Iy\362F\324I\214\f^\275\350\220\005\261\361\316\352{X\242h\350\201\327\316\f\330\367\215[\321z\215h\006\256\212#\n^\311U\036\301s\017F\275\242`\203]\325$\362\203\241\237\362]\303x\346\b\210W\356\304\374\244\342b\206\237\362\317\337\333\236\020\216\367\371{s\022\344,s\346`\r\364\\w\212?\357\363@_D\335\203\224\256Y"
+	.ascii	"\007\343\177\336\265\356UJ\245\0205\216e\317\373|K\251\274\370"
+	.ascii	"\236\337\261\356AJ)1\354\340\330Q\214\002F\b\310\305\373\374"
+	.ascii	"\271\375\330Y\352\027\177\306s\345JR\267;"
+	.ascii	"<\177\302\251x\267;\217A?\345\251\301\237\033o\205\307\353Z\200"
+	.ascii	"?c\366'\200o\301\356\017\376\334\234\360\330x\027\31654\215\254"
+	.ascii	"\267\030\210\004(L\367\333\237\233\030\237\254g\266\307\305\007"
+	.ascii	"\320\255\264\024\340o\374\026]\325\360G\200\317z\250\265\332"
+	.ascii	"(\245\374\362J$!U\216\370\\\370\206b\341\241\027~\001#bW7\241"
+	.ascii	"\004\013\337a\272\215\324\273\326\371\3459\231D\241'\205C\245"
+	.ascii	"\3212o3\033\357\212QH8\f\363*a\314\360\350<\027\030\217\022="
+	.ascii	"\363\321\034\353)I\335Bu\376D\023\364#\365\020%\375\276T\250"
+	.ascii	"\303\333\371i\316\023\234\034\234o\262\266\323\r\033\264\013"
+	.ascii	"M\275\354\360\005M\224;\rl\221F,\374\224\237K\2405\276]\"\343"
+	.ascii	"\214[|\223\271k1\262\037\207:?m\3615\376\207\332\245\321\241"
+	.ascii	"\356?\227D\201\2445\307zn,\t\222\3477\027\272\346\273\357\322"
+	.ascii	"\351\361I)\371\013\245\017+9$\334\371\375\347s\321 E\211B\232"
+	.ascii	"c\355#\211-\352F\343H\364\255\371\276aT\354E\334H\264\b{$*\267"
+	.ascii	"\224[v\353\374%\234\236\241\344R\231FA\034g\231\216N\227\315"
+	.ascii	"\357\270H'\022\235\262\267\271[4I\224.\312$\312\344\333\257\331"
+	.ascii	"7z\206u\334\357\230\025\202<\177\312\335,\222\264.2~\2169$\n"
+	.ascii	"\302\223\346X\2031\237\310\003!v\222\216b\357\325M=\271 n\222"
+	.ascii	"\377\333L\270\\\352\346\3635\253\326\007\213\007\034\215\022"
+	.ascii	"%!\017J\233\303\261\367zsCu\376\224\333o4wG\336{\216\026\255"
+	.ascii	"kFOh\216m\220\324-\373\314\321*\321+\336f\355g`D\354\003\234"
+	.ascii	"\245\243\002\256\226ud\331`Y\326\241\003\213e\033H>|\343\306"
+	.ascii	"\226\321\016$#\243\037\316\262\221\203\213+\313\202-'\363\310"
+	.ascii	"\332\221\305\265\344\007\234\270\2620\310!\301\023\217\007p\344"
+	.ascii	"\320q\003\003\033\371\016\035X\026\260\030d\331\320\312\321f"
+	.ascii	"U\240\003\313\2026G\357\300\301\205\305r\361\230 \313\002\254"
+	.ascii	"\035L.\036\023<\017\255\n\266j\264YZ9tdI"
+	.string	"\200E\200\r\tj0\271\206S\016\0355\236\264r`I\360T\203k\307\223\223\017oM\220\305\365\304ck\213\353\351i\367\325\374\365`K\253~\2517_\204\003\320\360\b\b\273\n;\370\253r(\351\b}\343\230\027cK\261/\264\002,.\006\361\001\243\312\360\2214\032\231\316\225\370\252\177R\305pY1\346\343\336\0341B\365+\376I-\254TQ\346\341\"\337\210L\275\212\177Z\013!S\234\371\266\350\264\r\273>\262\r!\361)\032Q \376\007\216A\326\244\036\305C\351\n\021OX_m1\r-\352O<\264\254\320PJi\342\231\273\322\374\217.\3066\354J\242!\231\243D\336\207\013\226\347\310\237}\007XK\2507\361\335\246\255\254\205\201R\312/\305\027?\345\022O\365_B\013\350\242\304\t\001\224\370\234/W\023\312\232%~F\025\261\256\005\325;\303\256&4\315\261\240\372\234\307k\024)\223J\222\007\251"
+	.ascii	"\200\365\324;\327\256Q\232\004\265\252\237\362WO\275\316\b\327"
+	.ascii	"'b\313\251\237QES\347\212r+t\372\234#\\\237\264_\270\250\370"
+	.ascii	")O\020\002\211\327Y\2732y\257\226\204\344\223\356G\n\251g>^\231"
+	.ascii	"\374\370\271\241\220z\0353\327$\220R?\243z\246\316C\bo'\210\242"
+	.ascii	"\236i\346\232\344\260\316D\324\213x\274\3129EI\366\327Y\265\004"
+	.ascii	"\324?\303\256r\036&\304\215\n\352s\302\030+\357\f\241~F\325L"
+	.ascii	"\335K\241\0042\365\327#D\374\210\177F\021\337\212\315\372U\r"
+	.ascii	"IL\211\322\340\333I\002<M_\375\231\322\362\212\n\317\214\227"
+	.ascii	"\324\325k\360ZV\302\300\250\020\220W\037\342u\250\204\210B\204"
+	.ascii	"H\304\240\236\232\336\351\351i@\262Nf\274\r\033\177\354jT\323"
+	.ascii	"\305\206\315\262\333\246\357\307n\037\253\205\222~P%\350\225"
+	.ascii	"\215 \340\347x\252-\304\006\337N\026\340iZ\306\237\361\224\226"
+	.ascii	"\321ssL\342D\310\370\r^\213n\2601\304O"
+	.string	"_\3063\275\016\335`\245\224\222\217Z\006\370\264\364\341A,9\201@\343W\306\017\337k\272u\254\006\326\371\025Q\363`\211S\001?\307RS\230\272\276\2354\200\317\224\226V\337n\204\006!Sh\372i][}\327C`\035\344\302\244\364?\211fk\254^\351u\312\006\003\033\227\222\276\343\220\336C\322\323\360\360Gt\211\216\306\214\237\351j\303vAvI.\273$\227\335\"};v+X\375\302=x\206b@\030\360s\374lS\352\367\333%\007\234]\235\346\344\336>\f\360\375\376\017\035\030\310\243Wd\300\236DF\2635\035\216\336\201.\305\016\337\327n\321\252|\222~\037\324\316\220(\265jB\"\017\3709\016\206]*t\255\320\034kjR\267\0338lp\347\2368&}u\202\252\250\342(\035R\262P1C\"#\"I\222\2441B\013\020\006\003y\230[\351\001\022\300DA\b\264\316\f\215DI\233\001c"
+	.string	"\261\3564.\2364\226\260X\312\207q\357\177\276\321\033\200\224\352\304\340\022k\272g\216Aik\b\337[\027\227\274N\004]\003\347B\242\225E\007X\257\346^<e\252k\335y\307\020\346IRV^\022fv\bO*\300<\331%\\\250"
+	.ascii	"\363d\227p\241\302a4B\030\bm\311`\222\020\206T\200y\312n\225"
+	.ascii	"\303&\340\315l\225hd\031al>Y\325\006A+\26707\231}\033\263}\017"
+	.ascii	"%G\370\025a\225\240dC\301\334\265\3470\232[O\300\302\013\373"
+	.ascii	"g\177}\033\t\350%\036y\353\305\221)\r*>\222\354\243I2]\314$\312"
+	.ascii	"&\344\346)%\205\363\027\214\n.b\327\254mdD\313"
+	.string	"\001\311\205\271W\253\327\366D\341\2158\027\tb.\337\013s\217N\326\n\304\332\215B\270\334\300\322V\353\304\200o\0163d\365T\nK\346iV\312J\023l\235\212\217E\273t\3011o\321\335\032\347A\f\032\252\024-\252\360\277C-\276s\006q\271\203\275P\276\02662R\340\023\264L.r\001k\217\024~\236\341.N[sX($2y\377,h\366% \211V\310O\0265h\332\260C\260\037 \262\350\2272Nz\364\004c\366\346s\316\307:\267\337\3605>\001NdW\327\2134\213%B\336\203\313n\366p\313(\325\342\203\016p\347\016q)\bgT\315\300\023\262?\021\334I[L \202\020\020\007\265\363`4f\305\370\033V\337\266:o~\370\021\203\221\205\346\021\365:-@C\301pP\327\025C\217\024\031P\335b\330\214\020\032\373\212\032\377y\237?\237\357\023\b\213RW#Zb\003\355\233_"
+	.string	"\336}\3352\037\270\306\r\006\256\313\271\372\302\331giFD&B"
+	.string	"R\030z\356\271H\200\327`\226\205\263\244i\b"
+	.ascii	"\275+\247\364\362\017\321\316-\250N\366\002\004\343\240\302\356"
+	.ascii	"\026\305L\310\300\303\\Di\370\030jx\bC|:\271\325\221S\216\246"
+	.ascii	"\314\027Bz5}P\234*&<\324b\333\217Kj4\305b\232\222JV\227eq\344"
+	.ascii	"KQ\261\210\207\365e\tf\002o\023\275\252Jd\277ce\243\273*E\237"
+	.ascii	"\256\022\373)\231\037\363g\320\036\344Y\330\305/\217\227n\300"
+	.ascii	"}\023\210}\336\f\253\251\013\267&\227\236\210'I\201\267m\002"
+	.ascii	"\324\334\3424\314L\007\202\3471\343,&C\202\342\377\002\033\271"
+	.ascii	"?\362\315]\335\322\344\207\210\247\270|\004\217\354G\310\303"
+	.ascii	"\261\302\316\b\177[\350"
+	.ascii	"B\354]%+\314\255\204\246\301n\261\352<5\322\311\261\267\n\251"
+	.ascii	"\274\216\001'\020\026\353\340\210\242\251\317,\351I@X\r\247\365"
+	.ascii	"\234\331\300\255\315\321%\277Al\250\346eaI_\003\320\177|\327"
+	.ascii	"Jo\t\031\341\200\224}\371T!$\251N\241\214\037\374\023\031\244"
+	.ascii	"\344\021@*b^p\240@l\002d\215\324\265\345\310Q\260!.H\220\333"
+	.ascii	"\371W\232\2671\200\252Wx\235\225)\217;\n\254\344\225z\271\361"
+	.ascii	"\2747#\341(\"\234\275\335\206t\007HlD\322\013'\001\351s\370M"
+	.ascii	"+*\216\007\035o\256\321A{X\346\346\tE\201\367\357\264\n\214\021"
+	.ascii	"\226R\005\314V?\3643\244l\361FGK1\004e=\225?\022\013\032\030"
+	.ascii	"03!FE\340}\253\272m\301\377\311W\315>\033%\257\222\t\246\356"
+	.ascii	"\343DB\026\357T\366\224:\254C\355\201\273\374\271f,p\326\263"
+	.ascii	"\341\223\227\001\273\027\220k\270<\235\031)\b\033\216M\311}\021"
+	.ascii	"\364~\365g\342y]H\221\b\231\232\224\266\026G\303z\245\243r\374"
+	.ascii	"\342\375I\366;\021\r\331\320\316f\242\333\263\027\244|\371.\241"
+	.ascii	"<\337$p7X\307\n\311\244TQ\230\263\310\346d{\177\212\031\006/"
+	.ascii	"%f\007Dc&OHJ\236\224TU\351\333\031U\315&=\327B\262\250I\301D"
+	.ascii	"\352\356P\t\ta/>\352\331\022\303\001\214\036\346\205\022\030"
+	.ascii	"\254nI\323/\370\272Rat_\226\302jj\233@\227\333{\017\272\250\007"
+	.ascii	"\356\035\300?\271\234\267\242\300\305\267V\354~.e\270\234^\035"
+	.ascii	"\020\245\254A0\245T+\221)\247M\003[J=\326\022\201\234\343\232"
+	.ascii	"\236\202\366 \025\310.\\8\020\305B\037Gw\324\305$\2276\337C\310"
+	.ascii	"\273 ~l\361\020\322\017\350az\345\025\372\343\301\021\004+\215"
+	.ascii	";\323\314\211\016[\320Xy~hc1\310\002M\001\324\317\310q\b\271"
+	.ascii	"\261\353\330D\306\302K\031\235l@]+$Tf\224u4D~g8\247\247\006\\"
+	.ascii	"\367\316\307\257\233\212\023\371Ut\204\366\243\3451\360d1\234"
+	.ascii	"L;\030\203\275H\326\326\316B\215\204R\t\263\355i\001"
+	.text
+	.section	.gnu.lto_printMixScales.272.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\221\004\375\035"
+	.string	"\246\366\300G\220XN:\300;\341\321s\337(\321ON\304s9\327\255\356+\303\n\241\345\215\022\274z\345\035U\275\342\357\273\033\007)\345R\024\376Hb\322\033D\225\343\r\263j8\263\037\250\361 ~\210~|\264}B\b!r\247\024\252"
+	.string	"\243"
+	.string	"\255"
+	.string	"\303\240\223\006q\236|\316\366\206\271p\243\001\314\211\020\035~\211\357L^\024\020P\201_1$\234'=<O\355w=\211\357^P\306\251\325\207\025\264Z\207\022\334\340<\t\364\236\362\344\370\001\345I\373\3541\005`\324_\205\034k\202M\324\324Zu\013\304\n>\016\357\222\372n\226\344\270\324\347\213\235\301\331\331\357\346H\251\314~"
+	.string	"\254\202\343\2054D\212'\223\242%n\310\325I\033\037\307\004lZ\212"
+	.string	"\260\20212\320\321\343\311\315N\253\254\200tO\366\bf\305\257/dVW\247&\206Z\253\251\320\212\306}\3366\016\333K\366\b\025%\201\325\001\304G\2172l`\200t\315\222Ar\343m\235\243<\033\364\235\265U$\321\013\335SC\t\332\233\333\324\376\354\341\217\256\226}\001`D*o\226\375\343s&\177\317\301~\002\017\373y\356\365\357\274\354\326\371\330\235cR\347\226\032gR\343\234\324\247Im.uiR\223'\365hRoIMK\352\033\360p\366\305\326$\007\233\3752\2542\212m\352\0262M\310\313\3761\373O|3\347L\241\202\357eN@\277a\225ar\021\207C\347\235\370d\316\235\264=\366\004\004\034V+\\\333\232\232.5\265\006EJ\036\240\344\226\353\263q0\263\310\270au\325:ua\207sj\007\341\244\271;k\177"
+	.string	"A/\364Xq\354\317>kn\031:\257\345k\"F\223(Q^X\242<Y\032I\033\227\\\223\213\270\026|\203e\327`\353\n\002\342\270\237q\026\366\226\026\364]\237\335,\3014)Z4\017\245\367\225\362K\3276q\202^\270\013\305\343Uz\017\210TvBSB\030\351\350\216b\256\326\273\260U+\360B\333(\236\266\273\024b\255@\013'm\242G\341\235\265\002\205\320F\030\335l+\310\311\257\2021b\025\341U\024-R*4Xh\343j\371/\002.r"
+	.string	"\324s"
+	.string	"\324\353!\355\234X\360t\216\316\3244d\264\342\250h\307K\201kBr\332\241\340e\b\300C\332\021\r\2658J:U\364v\035\226\222\234\212N\023M8B\"\322\2558\332%\351\210\230z\272\t=VZ\3421\351\232\224\224\230t\271a\375f\211\375TSC{s\213Z)s\265\234[C\376,y\204>\314s\266j\301\237\312\034\332\365\243\310\345c\255\265\226\253\345\213\331!\fB\031}\366f?\317\354\240\nBY\337\251\324\331*\373\177*s\366gOv\322+\f\353"
+	.string	"\305Y\\n\203\316\346\332\210\270\262\267sq\266\344j\023\363\322\345\\\034\240\031\"V\222\264(\032T\250A4\306\fT\202\221\021\031\231`D\244i\003\200\002\2319\253m\021`A4ScA\213u\003\b\267\332v#=>\317\007\022V"
+	.ascii	"\350@\255g\320\226\223\n\r\343\350\210Y\234\354\232Gn9\006k\230"
+	.ascii	"\307y\031\271b\247\342\362\352\2560\321\366tBJ\036\211H\244\n"
+	.ascii	">\016\315\023\2479\255\3401d\\\004w2\f\345!\353\004\325\342T"
+	.ascii	"\377\b\204&\033(;\361\3635\224\334m6\034Q&\201W,\355\320\316"
+	.ascii	"\304\270\226\331\301\344,\311\245:\317\271\031\"X\030\2044\371"
+	.ascii	"\342|\037\2528l\034\277\002\025\371\033\361i`J-#\341H\234\314"
+	.ascii	"\357b\354?_\273\033z\311\306\017"
+	.text
+	.section	.gnu.lto_cliMixScale.273.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\036\f\235C"
+	.string	"\232t\340\031?@\246N\007\314\301+\326QNGJ\r\302\225\335\252\034)\035\330\212\356\030\205\302\322Z\242\027\2364jh)v\320.z\305\356\256O\355\347V\252\223dT\260\234\207\b\230\211\320&{\357$S\n\221\001s\001\216\001?X57,9g\017\256\263\376\344K-\233/&\030\22389\307\301\240\346+\231\377\262\243qQ\2532\230\363\264\202\353g|\356u4\235\3479-\373\017>jo\2039\347)g\033\202\353,s\235~\005R9\356v9\037\363:\231\036\256\314\271\255.N\316\323\006\035\345:\333S_\266\316\272\276\324:\333\375v\013z\362\221\301\"\2509)KC\230s\256\372)\305\002\005\n(u\343c\277\257S\357\225}="
+	.string	"\200'\247\246%\323\222\2222\211\034pL\202B2\026\211\002\334a\313\256\217\337vL\255\212\351i\203\006\346\001"
+	.string	"\030x\032^\361\371\032\rB\3504\224\n\032\224+\204\222\366\305\233\342\316\256\340%\234\025\314\344\177gp\256\367\206\227\252\3649\301Jn\2564"
+	.string	"%M\352I\351\312\354\243\202\221n>`]\272\305e\361\2773\271\225A^\035\034\247\243\206\217k\236\264\346Pk\2016'\205\376w\006fe\326\361+\363\270\2631\030\311\2034\220O\256\320\270\342\274\305\213\377\2351Y/T\335\320\371\235\033\210;S\202\213\303+)iK\234\350aK\\"
+	.string	"3\356L\fvW\006k}E\374\357\254\311\272\314\023%\320\343\316\222\340\341\360\nJZ\030oW\006\203v\211\216he\353r\310\025\250\021\215\f\263k2\347|D\363\261Za341\274f)\342\357u\276v\241\356\315\371i\203V\304\361\360*\347\334\030\212\226\346M\300\273q\263\273\261t\023\035\005Q\317\364f6\332\177\016\200\306\360\242\306\357\377\217\323\224%\301\336y\355\362\361\177]Y\030\377j\231\336\177\b\004P\265LN\0362\212\252+\217\2657>Y~h\355\315E[\341}Q\030C~L\337\335)\274\356\353H\301\351O\2220\\m*_\376\204/\376\t\264\206lM\fW]:dI\376Nb\247:\035V\022`\316\331\241Nu<Y\004"
+	.ascii	"s&sh\323%;!\345\354\201\357\226\241\205\035\032\365Ixy~\205\203"
+	.ascii	"d\017\326=\025\303\037\355v\npwr\177[w\205\t\017\254\234\214"
+	.ascii	"\273\002\251(\237\272\037pq3\275\216\367\223\317\361vr;\357\246"
+	.ascii	"\245\253\361fr\334K.n\245\"n\245\243\361N\272\270\221D\334G\""
+	.ascii	"\356$\0277\222\213\333\350\342.b\334D\307\355\272\270\207\030"
+	.ascii	"w\353\342f1\356u\210\373\207\270\361\020\267[\030Q\025\323\223"
+	.ascii	"F\215\312\373\231\346!\325F\331\217\275\203\363:\356s\334\363"
+	.ascii	"\334\355\334\321\270\253qg\343\376\306\335n\357S0F\215\316^;"
+	.ascii	"\2356\332\001\221\252\361\271\034\347\3536\366\r\337\353\021"
+	.ascii	"\215\222\344\234\365\332\230\367L\033J\003\tE\2707\272\215Nm"
+	.ascii	"\277k\243]\3471\307\246\031\255H\0278\225#\f\341:\273\":\264"
+	.ascii	"\326\244s8\265\277H\242\2675\271\234\263\261\3654\276\306\351"
+	.ascii	"\274"
+	.string	"\256\215m\334\315\353ov\\\211\005\205\236\336\370H\251\240\237\262G\212\036]\211&?Z|\207\342>\261\370(\330|P\021?J:\002\223\275pn\316c\024\032\217a\037o\226\365\325\362ri_.\357}\316\016R\005\013\357~P\243\2766\310\001\337\326F\267\244\007\317\272AM\271\323\2339\275\027\262\202\2021;:\375\203o\242\023|\275\316c\002\304\202\320BQ\270\375\356\027\314+\006;t\370/\330\306J\264\357t\234=\243\006\026>\263\314\b^RR,\312\027\250ok\007\324\362\244\300[\036\036$'\344>\350\016\307\253\217\002\271\030$\306\217\266\321\215(\365\254\233\200)oz\263\246\367\2779\257C+tW\374h\323K}\023]\340\032\262\265!\240\277c\332\356>\341\205\357\030**\335o\031'\324\020%\301YE~\347\354\027\352\036\302Caj\372\3042\361\243\355\336r\031d'\340\333\232}\3573G"
+	.string	"Q\007\367\203KVC\312\331\365\273A\204\300\016e\177\007\233\217\007\253\373r\327o\360\347.\fW\035)\020\236(\356G\233\312\223\0175\005.O\202\2774Y\206"
+	.string	"p{\217\266\235D\353q|\220\n\254\3143H\314\212\\\316a\202.\310D\373\233\263\215B\005v\250\212\326Y\367\025m7\213\026\330\241\355u\256l\023\206\221_\331\203)\325%\201\323\256\353\362\223S\236\374\247)p`\206\364\374\031\303\213\330\217\366\022oO\310Ox$\274<*\236\362\345\233!\361\366\326\276\202 \034m"
+	.ascii	"Fs\306S\213K+\006\263\351\304b\336\350\332\301\344j\316\310\301"
+	.ascii	"dvy1\233\316\033Ofs\003\023\301\202\206\221\200\371L\300"
+	.string	"l\322\300\312z\352\320\332B\266W\363\331t\266=\303\201\263\251Ck\253\312k\206\f-\0321\0024\023?i`\341X\265\374)\303\211\265:\275j4q`=\207N\257\032\357\305u\243+\213mri\321hna\215\200\261\2255\354,\007Z4\262\252\270\264\260\266\252\262\234\317*\007\313\356\252\321tVyuu9\253\214\3230\377\266.\212q\344\027\366b\375\305\246w\274q\037<\203\253\036\200\002V\200\366\022\361 xx\246\205\203c\017\206\224\306M\001\360\\s\206\222A\317\225\203g\236\"`\005\337\316\367\"y\225\360\371\325\330\203\035\331\314\2209Ya\337\303l/\0235\227\314\313\034\220\030;~c\017\326V\030\371K\357{X\355}\002\005\370Fq\311rH\275\321w\212\005\266%J\226\336\t\251\211\n\357\246\260\3223\253\274V\364\034#=\363\033+\375P*\310\2172\006>\202\215\340\"\320B\310W\276"
+	.ascii	":A{\376\367\027\327\204\214ClS\024e\316\016\013w\304o\371\321"
+	.ascii	"\256\201\005\371\310=\211\252sx\306\360\242\006\310?A=\004\246"
+	.ascii	"x\307\312\224\351\243\r\345[\355\361\235sv\220\325j\265\352["
+	.ascii	"m\322\037\337\221>\351\037Q\331#\027\351]\317\327;\352\240\245"
+	.ascii	"\217\366\204%J\253g\027\rhO\264\346\234\263\322G]A\373\364V\317"
+	.ascii	"%\025\334\303J#U\023\240C\003\200\365\250q,\346\220S\206\204"
+	.ascii	"$\020\021I\232\2441`\002\22113\333\021p9DH\232$\303n\224\tT+"
+	.ascii	"95\365\376\351\0029\177\372\277\277\276 \253\300\213v9\315'\257"
+	.ascii	"\003\027\013\205u\320\024<<\351L\240\262\373=Z\031\233\344Le"
+	.ascii	"4A)\022Az\b\"\306o\241\323\251C'\305$\364\304I\352J\322F\201"
+	.ascii	"\344\024sNb\312\204q\237\313\212\357f;\f\354M\364\262H.\177\275"
+	.ascii	"[\211o[.]\232\227\263b\347|\216\247[2\216\266'\321\375\t\277"
+	.ascii	"\335\013\352\245\n\266Z\220a\030\270m\rD\306\365\024*s\333\367"
+	.ascii	"\214\262\275\002\013\020;,'\304q91$\016\262\332\207\321\323\265"
+	.ascii	"\005\332\234\366H+\317\236\013\215\364\024\270w\304\017$N \320"
+	.ascii	"\003F\204\213\033\226\231\304BEM\346n\333\212\276\001\r\356\b"
+	.ascii	"R\032Y1\034\220\275\231\350\346\037\036\256al\316\360\004\213"
+	.ascii	"\b&H\017)\261Qb\310$\034\205\272\275\030`\230eI\034\225\366\227"
+	.ascii	"Kl\225\3715\204\245\216\271\362\302\2042!\277\273\265\261\367"
+	.ascii	"\317\341\253\3173\275\004,$\304q\023\233x\376h\230\320\0234\t"
+	.ascii	"\221\226$\331\3561\236\276w\252?\323\242\341\016j\033"
+	.ascii	"DP\324\343\240V08\271\257N!@\257\262\370\203\f}c\032\245tp\336"
+	.ascii	"\260\221h\0363A\323W\366\224\231\242\311\260\231\2474\177\306"
+	.ascii	"\203\235p.\024a!}\366%4\376I\246\366\202\377X$\331\227\227\r"
+	.ascii	"\230\225\r\215{?\241e\2405\214\345\335\2166P~.J\345\035q\266"
+	.ascii	"X\023\233\241\001uag\242\005\262\037<B\332\002\025Aw\002\335"
+	.ascii	"\340e\320\253\330\227\032\271n\301\266\340\257\246I\235\n\006"
+	.ascii	"bb\233\373\367D\214Qg\222t\340\371q\204-WX\344\225\243*\205\343"
+	.ascii	"\351Y\227\346\202:\027z\301S\320\216\272\265 }0\005\377\001"
+	.text
+	.section	.gnu.lto_printName.274.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\257\001U\021"
+	.string	"\266!xF\340\322h8Rw\b\217\033\001\311k\bPf\267.\321\321\225\234\241<\265e\025\221`z\306\236't~\243\342AY\373\32400\220!e\252e*\005J?\271\255]\223En\355\004>\004\220\"\214\355\266\367\2262\245]"
+	.string	"_"
+	.string	"d"
+	.string	"k#\022Q\341?\217\341\323~\320O\314.\244\301\"\273!Z\034\355\216(\027\b\377\235n\002\376\363>"
+	.ascii	"\374\347\231\275\343d\303\322V\200~n\271\245\335M\251\210\317"
+	.ascii	"\356i\316|\023\213\210\210\243\335\353p\005\200\303\361N\273"
+	.ascii	"\373\334S\007g\3134\261\354\256S\304q\270\277\333n\261=\301\316"
+	.ascii	"/7\340\277\353y\310\230\361CW\313\235=\322R{\354{\273\273V\036"
+	.ascii	"\373B\177\b\246M/\272\301\017\375\037\230\326/\235^\372#\025"
+	.ascii	"h\020\331\310\001\225\320\033\343\356\354\202,"
+	.string	"\322\247\373y\321o\3779\2238\301\312\354E\031N\264qwLJ#\214\202\226v\307\003\377\314\300\316\361(f\037\2729\t\020G\027T|vs.\252\302\234\026\224\177\251\241\332+V^\364\351\2464\203\232\212\272\r\251\345\316\363\264\347\005\314k\370\354\332.\272h]\207I/z\250\345.swi\252=>\213_]b(\021\341\260%\020\3731\340\025\324\013\271\351pr\207\340+b\034$\355\356\002\373u#X\270kS\240BF\243\222D\"F\245c\006N\rX/\225\314\211\300HI\211\314e\243zaA\210\271T64\254\022\230\326\213\f\354\201\f\346j\315\220\304\304T\021f^6\030B\257RZ\256UJ\246\245z\245V5\261T\212\211a3\254\232\224\f\006\253I\221\214{o\225\307\251&5\0012q\203\221\276\216\202\204\017=@\004Y\bs\\P\376\251\352\214\344\360\201TS\034\013H\325\247x\034"
+	.ascii	"\357bT\215goB$\275\276\017\263\220e5\210p\b,L\006\307c\320aC"
+	.ascii	"\234\210\206\2531\301bBk(X\337\013VqM,\230#\342l\be.\260\277"
+	.ascii	"\251)p/\230\232\002\334%`\300\242\312mW\321\003"
+	.text
+	.section	.gnu.lto_printBoardName.275.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\r\001\355\f"
+	.string	"\226\330WB\020\2176\035\244\025\001N\037"
+	.string	"w\017\240&*\354\036\f\272\206\226f\254F\251\363\223\017N\030\366\215\210\337\202\340\326h\245\360'\213w\227\001@\240B*\220\"a\377\331\n]\220\206\351f\243F\366\2262\245B"
+	.string	"A"
+	.string	"E"
+	.string	"\217\360\003\250G\203\354\027\005D\313%\360\300rB\002\306\356f\312\341\240G\250\t\362\253\216\213\367q\217(\207\242\353\013\245b\276\016b\273\373\020\317\321\027\312\254:v\327\351}\024n\352\266\033\330V`?$\025\272<\331%.u\203}\270\273kM\261\277\362W\232\2060\255\232\316L?@F\305\004\312I)v'\234d\254)\242\350p\331~\332\377p\020\240\257H\360eW\203\212\023\273\245\214\rX\217\3305\250y\317\230H9\250/\321b\301\324)g\205\032\245\272\300\205?\"\202f\221\374\215zT\325\031\243\013%yr\225\366\207$\357\245^%C\247\334sw9\365\006u\365\020\321\"\2241,\340\033T\245\327kDZq\022\376\034\3008\232F\304\301\207G\263y`@>\032\006#\032\311\207\345\rG'd\223\211t4Z\266\361|2\016\ro#\034O\006a\333<\331U\332\303\325\024"
+	.string	"-\030L%\332ELB}\351,\034\002,vM\356=\260L2\b\036\355\016H\030"
+	.ascii	"\357b\314\304\003|\2641\356\022m\331(\326\310\023`\002\026X\267"
+	.ascii	"\t-NX\231\312\262\007\254\246\332\005\031\354;0\340\022\002\261"
+	.ascii	"\232\022\334%`\300\253\212\253\231\242\245\351M(e"
+	.text
+	.section	.gnu.lto_cliBoardName.276.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`:\004\255\036"
+	.string	"&\370\311J\220\026R:\200!X\006\352\334d\247)\023v\340\023\250\215\233\215)\346\264\227|\206\005=\203\251>\355\034z\337fVt\343\241\207\325\031\235\002\260`\301\207U\024ek\203\245\367\313\3274\020\f\354\025\326\313\377Z?!\204\310\235d\267"
+	.string	"\251"
+	.string	"\262"
+	.string	"YdY\356E.\370\311\016j\026i\342\n\203[\346\013\371\326\372!I\247\271\227\n\211\222{\221\r\030A\355'#_\203\376\254="
+	.ascii	"\372\223"
+	.string	"Wf\264\001Lw\370 \013J\223\027\230{\357\256m|}\016w\263\311\244\350i\266]\371`?0\366\205X\245\310q\370\\:\001g\200\006\224\324oJ\036O/\254\215\307\223T\224\225Aq\\\231\tI\243\001\005\343)j\252d\311\246\231c\321\274\241\222\221v;6\331S\275\367\336\216L\326T>\271\270\035\227l\2335N9\214W>I\2319Y\226x9\330-\212#\321\332t\302\275\227\255\361\bu\23693+\231\371\004sw\005I\350O\333f\027\024QJvy\373\204\311IGw\025#\241\271n&'[\272\254,\3310\234\263\314#\206\354\215\272n+gZIb\017\371\235\353\366j\032\243d\227l\263\270f\016\032\331\033\3377+\310\246\322\262,\365\220\0319\264]\305\374^.\227Kn*f\323\262\315\207\3744\347:\353\376u\316\035\371\343P\313)j\031M-\237\246e\023\265\334\247ekZ\376"
+	.string	"{&\305)\205\212_%\271\327i)\346&O&X\347\372\277\336u0\276\021\271\327\372/\244_\250\373\023S\262\306$\324~\252&W\022\200\253\274?V\0055f\304\260uU\222\243\375\036Q>&\344[q\257\307\336\330\203\376D\233\304\030\226\264\026V[\300@\311\020\260\272~\330\237\\\270\330\215\f\265b\020\347\347\303.\346\243\300\354\336\342\215\032j\305\035\234\2374\315\274\001\310\336\310/r\026$\331\324C\3169\262\210\221.\370\33139\004X\233\306\265\256\231=|\2607\236\235\302\230*\366\320,\360\205I\022\355*\266i\263q@lVg\366\301^\241\311\224\356L\206\276m\232mS\013\242]6\204#\027\311)D\273-\032\215e\016\022\2627v\177k\212\330C\313Z\242\206R\346\017\265\375\032|# ~5+~\254\003\f\n\025\005\251%\200\033"
+	.string	"p/\003\317\027D\341\207\347\263sc\034a\002\0345B\017\b\003\257\203\312\301\327\373\371\001\342Qu(\364z|<\013<joG\345\340\343\363\361xTa\202\234\" Q\037\t\031\205\220\001\026\r\021\001\203B>\021\301_\312?\235!\242\337\256hH(\270\373\035\tw:5lD\002x\264+adt\264\273!\357\315\333T\266\263\262\244R\023\315{\357\315\345\330\332\327+\224y\305ZwDI.\365\260\305\320\314\2248\005\366a\237\262f\335\254Z\265\"\022\316O\346\365\307\032d\306I\331/D\313\326\255G\215q\361\301EU\356\300\272\245m\225*\217\307\336\230\366\265\246\226\250\004M\250a \244\f\204\210P@2\023\320(,h\016p\002\031*4\017\020P\tU\315\001"
+	.ascii	"3\253\036^\300\275\336t\033EzP\344\375\214L7@\266:\373\200\242"
+	.ascii	"\025#\005?D\234\270V\355'zr&+\231\313L\346\321\211\375\036I!"
+	.ascii	"\024\276[hC\363\340{5\343f\001\345\032Z\226/\032}\013i\257\361"
+	.ascii	"FZ\315\322\214\202\177\363\352\233\376~\326\301\267o\b\321\\"
+	.ascii	";\343\032D\250r\361\216A\262\\\270&\242\031\033i-\301\034 \240"
+	.ascii	"\214\352\253\367\036\037\217\324M\235n\360\213\225\272\252\367"
+	.ascii	"\b\251\260>a\004\273\363\375f5\370\017"
+	.text
+	.section	.gnu.lto_printManufacturerId.277.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\022\001\035\r"
+	.string	"\346XYB \217\223\016\f\227\217m("
+	.string	"<\005h$\251E\315\007\026\340\237 \024"
+	.string	"\317\234"
+	.string	"3\301hF\020\251\023\306\020NXp4g\235\036!\002 \200\321@"
+	.string	"\222\305\265D-\217\357\200J\250\021B\366\2262\245B"
+	.string	"C"
+	.string	"F"
+	.string	"\325#\274F\365h\221\255b"
+	.ascii	"i\271\003\032ZL>\264\354n\246\030.z\204\232\"\337\322"
+	.string	"\\\274\217{<9$a\337(5\343\353 fw\277\362,}\243LK\263\273N\357\223pW\267\255\300\266\306>H%L&t\231\262O\\\352\005\373pw\327\212b_\345\2674\raZ5\235\231>\200\314J\312\311M\"v#\244\\,*\2220a\266\237\3667\234\203\350*\020|\331\265`b\304\356)c\002\327#\346\033\001\366|\344=cH\312A}\b\226\025\250N9+\324*U\004)|\017\017\264+\305\377T\217\252\372\242D\201$S\266\322\006\205\362^\3523T\350\224{\356.\247\346\250\256\f:\240\030%\013\0078Ge\351\025+\231\002\006\025\300xx\026l\235-4\302\3314\b\205l4\215\017\320&\201\210\026\362\270\314\351\360\200p\262\020\317F\3138\033(\353\330\360G\244\263e#\237\317\226a\247=\\E\301`i\201\"\321.f$\324\237\016\242#\340\304n\311=\007WI\306\300\243\003\030"
+	.ascii	"\357b\314\304\003|\2641\356\022m\331(\326\310\023`\002\026X\267"
+	.ascii	"\t-NX\231\312\262\007\254\246\332\005\031\354;0\340\022\002\261"
+	.ascii	"\232\022\334%`\300\253\212\253\231\242\245\351M(e"
+	.text
+	.section	.gnu.lto_cliManufacturerId.278.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`J\004e\036"
+	.string	"68\310K\240\326Q:\304k\360\021\306\001\3373\0349\2318\336\370A\013\034\243\233\263\223N\247\315X\223\363t\302p\343gm\316\345{\330\351\204\265\325\036+e\217\346k\360k\346\322\302$\262\027\205x `7\206\344O\371\221\020B\210\334I\006\264"
+	.string	"\246"
+	.string	"\256"
+	.ascii	"U\353\327\275\300\006'\031\302i\201(\2668\270e>\220\007Q/\304"
+	.ascii	"\350\002\356\215\022\032\271\027\370\200\025\234'\031\370\230"
+	.ascii	"\362\344\371\001\345IV\231\275\f$\335]\004\035E_V\226{\357\254"
+	.ascii	"g\\}\f\205\275\234fI\216mU\276y\223@X\344\n\312\220\337\3561"
+	.ascii	"\363\006E\020\203\351\3510b\216%'\3732\326|\035\301\362\034K"
+	.ascii	"Oc\214\322\215\365\304%\027\366,k\360\030\002\321\022\203\351"
+	.ascii	"\305\315rL\205C\237\354\327\033g\242`hA\177>K&\331\261\t\375"
+	.ascii	"!\331&.=\215\351\275\367\301[\025?\236\265\346\315\275\227\355"
+	.ascii	"\372c:\00383\023\231\271\211\271\261\0022`,3\017\316~\265\375"
+	.ascii	"\001\212\327\273\277[\212O\224\261\356$'TWR\220\354\026\006`"
+	.ascii	"\231K\370\330\257\262\036\271\274X\fy\275\343w\254;\313\327\345"
+	.ascii	"\310\026\031f\321f\006\022\262_\3373-\246,i\371B\352\0353pg["
+	.ascii	"\212\371],\026\213\334Q\314\243e\231\013\371anu\226]\353\034"
+	.ascii	";\360GI\313&i\2714-\223\243\345\261\264\334\244e;Z~\001\353\345"
+	.ascii	"Ci\005\213\363\b\336\253T\344r\207$\027\325\255~\255_=\310(\326"
+	.ascii	"\263\324k\235\370e\272O\321U\225\242v\236LG+#\230K\274\377I\005"
+	.ascii	"\375*(\244\336Y\254.\337\325KK\021y\331\337\301\344M\212\370"
+	.ascii	"Sl\303\261_q\312\223e\233\020\006{4\031\261\361\305;\017XY\177"
+	.ascii	"\353J0\034\t\r\rgOGs\362[G\262\201A\224{{_9\234=\034\232\223"
+	.ascii	"0\315\334a\307~\345\017\361r1\364\365\216g\\J\\\314\006'[\206"
+	.ascii	"\205\200\225i\264e\315\374\001\204\375J\266y\004\252\327\273"
+	.ascii	"\261l)\226\351\261c^0+\033\373\301Wx\002\025\340,,\3372\315\326"
+	.ascii	"\327\304\263\305f\340\275\227\fQv[*\374\"#B\234S|\243\362d\267"
+	.ascii	"\201+*\234\216l\321\336{\357XT\332~l\323\343#\"%\312u\210a\n"
+	.ascii	"\027D\344\330rvtj\264\n;7\232\006\030\246\031Z@\223J\260\355"
+	.ascii	"d\240yHun\266\234\234\235ZjC\301\206s\243Y\250\245\266\t\251"
+	.ascii	"\316\206\333\215VK\207\026\324\004\345~\272\347\202.\247+\"\302"
+	.ascii	"\361\220(\n\342\001\222\345\202|~r@<\267\036 \234\3118\033\237"
+	.ascii	"\037\334,\310\207\007h\206\323\r\315lbX\310DN7#\022\022\322\315"
+	.ascii	"P\340\375x;\n\346\365cx\324<\036c5\366\274j\243dV\251T\034UC"
+	.ascii	"\244\3365\312\300~\353]\252\216\031\265\352\354\235Gs\222Y\355"
+	.ascii	"\241\376\220%\251\362\027\225O\324 w\022\006\263X\221Y2\345\004"
+	.ascii	"f\266%\246\264\232\375j\006N\250a,\204\220\203\306H@3\"$\005"
+	.ascii	"\246\306\240\002\221\251:\017\020P\351D)\fc\230u\256\231\363"
+	.ascii	"\277\033\236\371\242D\027\377\376\274,\013\034\267\201\016O="
+	.ascii	"F\321\210\365\264\017\3258\356_{\rz\204\240U\r\313d3\300\303"
+	.ascii	"T\003\021\b\305\274k\266\3119xu-9\030G\271\307\202&p5\217\302"
+	.ascii	"\331\r\244\315\307\2200\361\252C\315\355'\212\271x\335g\332\266"
+	.ascii	"#D\353\332\331k`\241\352b]\f6w\373A\242\224i\245\241\001'@\234"
+	.ascii	"\300\244\270\177\007\360\340O=\216\324uT\273{\247\354J\311\211"
+	.ascii	"\017\243\245\3431T"
+	.text
+	.section	.gnu.lto_writeSignature.279.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\317\001\375\020"
+	.string	"\326\240qF\360\262&\0352E\026u\265*\207\203C\210f\233\217-U\202\303\374b\3537\025\204!K\205\254&\\\323h\217\214\024%[\323\261\005Z\353]\331\030<\003\255~\236\273\326\3502\2469\351\355\275\275\247\022K\366\2262\245\\"
+	.string	"Y"
+	.string	"["
+	.ascii	".\300=\372;\311\366\310}\300\366\350\226=D f]\frP\274fE\273\213"
+	.ascii	"\322\023>\035~7\314\326#\324l\371;\2076\236\017\230\314\365\b"
+	.ascii	"_DB\310$\213\201\017^<@\234\366\214\311`\022\262\230\271\236"
+	.ascii	"\366h\343\371\300d3\317\021\204\335u\302d2\367v\333,\333\021"
+	.ascii	"\354\004\020\337O\372\354\346\236\036iz\333\3221\246!Lk\246S"
+	.ascii	"\323\0371\t\272\tq\317\306\356\207\232\220\375\2118V|v\3730|"
+	.ascii	"\232I>\317c\264>+\371\312\354=\250\310IA\264\373!x"
+	.string	"t\003\356\361\004O\262\235\237\013\020\005O\373.\376\242u\035\016\017\260KC\343\306\356g\022q\244\366\212*\017\363\251S\2277-\351H\337\323\341D\335\364\371\222\215\323\250P\250k\241\n\365=\257!\376\214\r\030\270\033\337e{T}l\304K\326|%i\352;\034\230\254\231\323\353i\237\020\363v\274\206\274dM\225H\307\204\b\325\032\373s\345\310\216\016 +\215m\272\316_z\326\260 \201\201\230\272\310\212%Ae\225\201\205\302B!\325Rr\312I\312B\n\212%\205\262\202JY\265\240NH\254\272\240\262B\261T\252\025\212\364\355w~\330P\216\237\027\205\211Zc\021OM\032\275t\354?xzt\310 \367\347:\334\335\205ZcR\001A\236OW\242\224P/\3435R&@\273\335a\025\270\316\301\201\007% `\202Bg\245\003A\265\276\030\261h8\271\240\201\005Y$\336z\367X{\315\002\025\036Q"
+	.ascii	"\312\307\341b\320c\365?\311:x?\212\317\210\002\b\332\023\275"
+	.ascii	"/\220\254\021+\007+[d\312]\313M\247\310\306\214\"`+\337.\203"
+	.ascii	"E\270W\254\307\003%b\272\304\023"
+	.text
+	.section	.gnu.lto_cliSignature.280.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`z\n%;"
+	.ascii	"\nf\334\026@@\244N\007\347\200\016\bK\332Zb\263<\342v\372\365"
+	.ascii	"\350\232\254\267\210\350\273\312\005\251\323\314\004[\037\n"
+	.string	"\213\206a\260C\251\345Uu;\365\364\277\020\372k\037!\315\314|\324Q\245M\366\3362\245\024T\001A\001_\001$Z_\335\353\334\214\343\365\261\375\214\243y\375\316\206g\264\354=\020\245q\2059\347\020\255\257\256J\306\313\274nw#\220\324\313T\353\353g\327\3058\335\353cpxv\346\366\216tOa\316\320\006\276v\204\326W\265\207+\303\3744l\217\003\377n\227\363\271\327\277\350p\244\234\241\344\351\345<}\320\bZ_{\352J\326\327\326\225X_\373\355\346\003\200,7%H\257\224\325\021\3129Ka)\355\272:\365n\377u&\345\222R\022\322\221Q\022Yt$2\266EvU\233\360\277\355DgMgR:\261\241Y\361%\245\2447\244A\250\233\352\302A\247\374Q\361\r\f\24177jk\362I8h\333 T\355\221L)\241>lhT\274h\311\037\231\300A\225<\221\372\024w\330\347\203\32065"
+	.string	"\031\262)\216\347Np\320$oT\235\220\222=\236\241l\316\020\327#\373\266\350\024\005\r\211\263*\026S\306/yV\246b\230\353\342\346~\316_\035\317\253\336\344\246r\206lhU\\u\036H\274IeP\250F\220\017B\257\250J!V\236c\217\325"
+	.string	"jo\210\270\236;\rB\323\324\2478O\3648\236\277\331\231\330\177qC\316\271\377y\206\346\r\300\273=\256\273\013\273\333\272X\305\030\320\271E\fc\354e\207\336\025\260J\374\330\375\034\013\215\334 '\234\330'\342\302/N\222\254L\337So>\326\t{\236\007j9\260\223\263\323\237(Zg\013(_\023\340n\025,\336\237\355x\370 \n\226\341\246\322\354\016P\305\321vgp'\3535a(=\255\003\034D\207g\354\0175"
+	.ascii	"\302\253\202q\264m\260N\030\223\001\376\241\013\034\373\303\276"
+	.ascii	"\361+\240\334\316-\374\001\032B\035;aG,;\304\343\023\033\351"
+	.ascii	"]\334\355\342\305\373\323\261\343\271\033\351\033\0045,\034\303"
+	.ascii	"\315\356i\363qT\217\233\224Hc(\335\017\374\213{\002\277\363v"
+	.ascii	"\362\251\273\353i\274\225\311\357%\344\267\022\362;)\371\215"
+	.ascii	"\204\374>B~\033%\277\223E\337\310\344w\021\362\373X\364Mt\374"
+	.ascii	"6\376wK\364]\374o\266\370\275\376\267j\374\306\355\367\027\277"
+	.ascii	"\235\303\373Y\"$H\021\367R&g!\211\206\262\340\272w\305\367\334"
+	.ascii	"\373\334\323\270\217q\267s\277s\266[M\373\032\367\353#\033\347"
+	.ascii	"{\275\357\313\350&\305\323j}\005\200]\211\335\013;\312\203\331"
+	.ascii	"\317\252H\333\024\346\254g\242\365\274v\275>\372\232F\201\217"
+	.ascii	"9\351]a\316\323v\362\276\307{\304\371\332\322Z\247\333A\371\352"
+	.ascii	"y\357|\225$`\322:\235\311\031\302>\020>Y\367:\031\320\366\344"
+	.ascii	"\215\222%\261\237!\204#(\206\233\375n\300\370(\302\321n\340H"
+	.ascii	"\374\\\034\274\353!\330\"3\257\333\373"
+	.string	"\366Vy\177\"\261gYS\220\345\325\362\376,\302\036\350\3334\304#G&{\304\036\205\016\317\323w\277\3227\356\375y\304*\326\304p\323\001\354\0214B\204\243n\034\216\027\272@\034\277\002\n\317\325-\177\202\f\241\027\004\331\351\031q\264\215\207\354\003\274\0366\265\331\002\262@-\256\346\234s\213\243\315\324W\310\312\312\342\026\233\265\361\352\217\320\220\351\211\002\275^\242\336\271\326\351\3315b\"\374xe\207\332\375tqQi\017c}5\266u\362\314\021\232%\021 \305\311\235\"\216>\300\256\347Xy\344\3528\325\302\366\276\324\234\3314\024\212\371\304.\342\356\316r3/\030\002mO?+.b#4sp\312\016\361\3403\222\210\205\305Q\026\267\353\t\033\320V\300Wg\243\273\343{\316\342\025\177{\342\220\030\370\2436\276\206\252]V\275?W\214\017\t\265\b:\235\213\245\343~\\Kvr\316\024\336W\026u\332"
+	.string	"\022\360\357!X\025{\033\367\033\301d\347\331M\302\304\2055'n6\306n\375\365\344\";\312\005cb\031\365\362J+k\312\252\n\004\026QC}=A\271\026\226Z\"\246N\270YV\313\253+-*7\252\303\262\312j\311\301\315\"ae5E\345~=1\350-+-\022\036\334\253e\026\325\324\325\324\007\252\001\275\240\3032\213jY\"\305R\201\013\343\311\265\360!\253\312j)\302\355"
+	.string	"B\304\324\t+\020\007\272\277\306\f&\230\n\243\213\211\271\274\213)\003\033\275\300\260\230^6\300^t\305\340\372*bvq\311`\316xa\005c\306V\261\267\242\270dlIuq\275\230!\265\345\365%\025\245l\0325\230^R`4hxI\035\263o\340\201\305\334\b\223\021\363\005\256\251\3159\0048>d\2248\306\334\260[\352"
+	.string	"\265\266\303\260\311\316\216B\255\323\345\354@\334\221\350'M\220\f7+,\361QF\t\302/-a\307\343g\210\340\002 _\232$)\341\347\242\204=\213"
+	.string	"-l\210 %a\267\222\226\204S\274\0313\241N\233\333\221\206\367\274?\362\212\031h#k\235\276\006\312\327\356\267\354\365\201\2070Qp\f\251"
+	.string	"\022N\366%\352\031\026\2723Y\250Y\216?DB\200~K\0345\243#\374\203\025^\310{\366\376<\302.]\033\303\315/JQ3%\211\243\355\206\334\b{\277\331\377`\266S\351w\310[\344\375\371\026a}5\3025\376\020\343\2200\rq\022\004\351p\002\200\322\250q(\303\030TH\211\214\210\214\264\240\240\031\003\200\002\221\251\262z\022"
+	.string	"\326M\210Q-\250e\377\331\f\3070\312$Z\350\f\3640\304<~\245\200\331\207)?l\030\363U#\037f\342\330\255\201\366a\252t\002\006\0165\305\004} Y$\246\325\0310\bD\177\002.y\354\331AX.\315h\336\336\3437C!\236ON\032n4\346\253x;\213\217\251P`\276"
+	.ascii	"\025S\254[\366\033\230\371\233K6_N\353\371\2538\316D\374\004"
+	.ascii	"\034\260q\r\306\274\"\022e\307V%\r\343\215*\306\353z\225\327"
+	.ascii	"bQ]\032\317\b \263>\2473W\230\017\332\261\336\034\024\215\317"
+	.ascii	"\336\222\370\342\037\026t\020\256\255,\312r]\3358_E\267\256U"
+	.ascii	"[I\2513\376\027\030\02752~\347\204i\273\266\272G@LT\207]\247"
+	.ascii	"\221\005\355U\207\267\355\260\266\bS\233G[\345\356\324\210\024"
+	.ascii	"\264\212w\240b\346u\271\3667K\022\256T\006\234\003\276\270\334"
+	.ascii	"P\3149oo\234Nv\005_\030<1\016\212\265\232?\350\bt\006\337qbN"
+	.ascii	"\266g1\006\262\200B\266g\355\237+Ezh\322\036RG\324\353\270o\330"
+	.ascii	"@\321\343\270/\237\343\300\246\321\351\314\234\301\206\004<p"
+	.ascii	"\302\310\313W\245\226{9\377m\203\376V2\361.N\272\b\330\241\b"
+	.ascii	"\026\306\222@\365*\007\034\355p\004\207\001G\3265\360\027_\317"
+	.ascii	"(\266\3651\367F61\263\3343\t\244\n\333<Ov\0233d\306\245(\224"
+	.ascii	"\300\376~\006M\020\312\037\354\036\004\351\034\327\200\206t\243"
+	.ascii	"_\324_+\215\032"
+	.text
+	.section	.gnu.lto_cliMcuId.281.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"5\t"
+	.string	"\366\020@:0q\323\001 \344o\324\351\3258\352\300\327\256\343~\020pX\247BH\372L~*!\303F\303\236\377o\2053\335\256A-\003\002;\365\365b.\357"
+	.string	"\023\275\226w\023\261{\247\024,"
+	.string	"/"
+	.string	"."
+	.string	"\037\320\236Y\264s\n>v\204@\031a\275\354\354n\245%\027?E\377,\007 [\343\347&\261\273\236d+\344\246\267}`{\302vM\246\236\t\216\310atvAzx\026\226\315\234\330>\310\366,7nB\237\366S\256\"~\205\343\002\273\256\030\231\335\262\301\b\3343\227\357\264g\\\035\324\303\333\234\367K\013\235\341o\271K\252\263\331]\235Tq\253\007\205g6\206\306<\351\205\330\013\306\242\243]\216\223\222\330\377\354\356\232\272\034\316\210pH0\030\201\025\252/$ \231\300\022)\024Q\214\302o\363\347\201\245\257\232@QX?T\252z\235O\026$T\2758\235P\025T\356?K]\016\210\321\300\002\016"
+	.ascii	"v\264V\302\277\213!\023\317\374\242).l\273\006\261\302x\240\032"
+	.ascii	"\270\002\346\006\250(\340./\332I\006"
+	.text
+	.section	.gnu.lto_printFeature.282.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`H\b\275/"
+	.string	"\232W\360\022Gp\336Q\007s1M\235\024\204\205\251I\305\273\005\022PF$!\326t"
+	.string	"}\265\003H\341\033\362\034\220\321\002\243^\256\323\310\306Mj\245)\341l\307\2366\260\235\236\207=\r\332\177"
+	.ascii	"@\323\233\3456\262\267\334;\311\224\002\036\001\013\001\024\001"
+	.ascii	"\276l\266\223 Ty\032\025\320\n\231\267\3307\245\027\r\253_iO"
+	.ascii	"6\213\005\006\020\013\231\273toJdY\234\234\221\013<\355\f\253"
+	.ascii	"\247\227\355\356\257\342gUn%\306\317\227\261\314\302T@\256\356"
+	.ascii	"\203\251\310@}\031\013\310X\322E\312\210S\313\271\nR#\255\236"
+	.ascii	"\266\337n/\363(U.eF\347r\376\221E-g$R\027\255\236\002\375\007"
+	.ascii	"{\212\272\017\366\264\253\272\327\374\262\262\025\0042#\355Y"
+	.ascii	"\234\234\263\360\205\364Z\310Q\2447\376*\007\320\343\355X]nU"
+	.ascii	"}8E\377V\265\243\371P\223\215\225\003\350\301loO]\n\342\025\346"
+	.ascii	"<\036\276\003\333q\331\340\017/\035\256s2\\:\\-\307\315\361"
+	.string	"\360U\315\203d\270\300P`\316\331\231\036\\\302\205\343\252~\025\346>T\315\332:\342d\270\206\240Js\236k\236\364k\354\"^\254Sb\303\323\032\216\242\n\236Z\340\364\272\262\320\237\255#E\266\013\353\276']A\263It&\273l\370U\227r\316}\213]^\336<\336\355\030\272\373E\267\232\025\3150fN4\267\201\004\316\027\372\307v(,\341\243\314\322`\3359\355J\347R\002j\035kw\302\236JxO:\n\245\3314s*s\\\335\270Gc\313\352\372\336]\244_\340G\337\375\244\342zQ\370?7j<\345<\265\336\252\033iu\377\330\355JC\346<\373\305\272-P\3604\357\t\271\333\022\224\"\270\026\357\007\216tOr*\356\016r\267\033\b\335\212;\222Kq?\362,\336F\216\305\273\210h(\350V\274\201\177[H\275\035\264\336>\240\3366\200o\027\300\267\201\360m\002\370\366O\275=`\275-"
+	.ascii	"\337\376\301\267\003\340\333>\370v\017\276\315\243\336\366\375"
+	.ascii	"\355\236z\233\267\336\336\341\333,\276\255\303\267s\352\355u"
+	.ascii	"\275\255\252\2671\276\235\342\333\250z\373\361\355\213o\373\222"
+	.ascii	"\b6\3042gdG\336\211\314[qur[\272\206\304\265\270gqOs\307\342"
+	.ascii	"h\267\226\366\265\336\333\022Y\026G\255\233ez\366\312N\303\b"
+	.ascii	"\031\226\247\262\003oT\256\344\376\330\267\316\224b\273\376\261"
+	.ascii	"\2137Ps.K\r\336\231nD\247R\365\275X\263\311\324B\316\b\331\223"
+	.ascii	"\226y\235\315\213\336\330h\n|G\363\034\0212$-\363\n?\370F\357"
+	.ascii	"\200{\357i\2348\231\016k\316XJ\355m>\346\003\352c\2366\b&\354"
+	.ascii	"E&\354i/\201\233[[X\224\265\253\033\347h\3169\343?\266/=\207"
+	.ascii	"\206\254\254e\242\024\276\321\017>\360\215\335\3560p\321[`2*"
+	.ascii	"\321\264\302\2107\356\2468D\217\355F\233\234g\317\355};\230\021"
+	.ascii	"\271\243\333\231\260\262\234\265\274Hb\325\n\201\300S\336\037"
+	.ascii	"}\367\260\351z\261\201\355[\365\356y\354\357\336\341\332-\272"
+	.ascii	"G\237\375\037\227\026,\367\272W\227\355W\356\203\336\224l\332"
+	.ascii	"\034\273\033\374\365)<\225\017\365Wg\363\364\325\367vm\302\343"
+	.ascii	"W\213(\235\3550p\372\023\376\332i\267\240\177?}\025\256\005\373"
+	.ascii	"G\337\333;E\177\344\377?.Zu\222\336\377"
+	.string	">\206k\277\2107\256\035\274\277/=M\022-e\304\266\224\021\022\320)\212jj\350tbwAj\305\220\352\205\023\357\311\243\246>\240`\361db\350\224B7\265\202jx\302\311\004\253Bj\b\205\252\220\032np\001Eeb\355&\006O+\232\204,\236\206P\302\246()!\203\237n\341\302)J8\325\242E\224\220Ef\17714_\331t\264\311y^=\021\300\037\233M\362\224\214\240\370\234\315\215\336\330\274\241o\324\027|\2427\226q!&\016\247F(\201\233\031\261\336\232\347\344\220}i\231\273\b\337\350J\364Cb\334\350\225\230\214iL^\356hf\314\300M\266i\322v\211>(\302\3178\360A\357\007\036\274\201\327\025Y2\013\374\203\3770@\317\363\005\376\267$\360@\257\236\021x_\363\324MS\r\321\211\266\373%=\317\377\236U\246\305\265`l\317\025\372v\347\006\377j\272\305\341\260j\235@\340\351"
+	.string	"\001?\340\347\005\374]\266[\002<\317\377\374\357M\013\346\363\001^}\343\363@E\322\330\264\255\274A\247\250\373c\317\373\017\007\317\363=\377p\276\3471\372#\367\275\253\271\007e\232S\253\016\261L\200\222\250A0\303\034R\306\021\022\021\021\021\322$\215\001\220\002\221\261\"z\021`\265$vZ\230\202\244\003\240w\221d\324\235\217ft\005"
+	.ascii	"\fBR\367\211\335\201\323o\2239\263\n\263\313z\301\025\261D\202"
+	.ascii	"\207PV\247\374\233'\217\216\221\262X\362\206\202<\212\244\323"
+	.ascii	"[X$\346,dpp\025z\363\305a\256`\275\240T8\271I\334\307\360\233"
+	.ascii	"O(F|D\"2\310\261\240dLg_b\346x\216\3243\213\0361\b;\264\203\310"
+	.ascii	"S\re\250\340b\255\032\302$|\232\005f\033\020\216\364\220\020"
+	.ascii	"4\327\272\361,\375A\t|\016\b\331\230\315p\362b7\366\036\265B"
+	.ascii	"\"\r\r;\205\006\351\365v\b\221\3660\214L*a\037\3730\337\207\260"
+	.ascii	"R\342tB\033\377\243\212m\300\231`\332\363\301\210\211/\027\333"
+	.ascii	"\247\001e\365\020\302\367T5\311\370E\r\340\260\352\2745\266\245"
+	.ascii	"\320A&\256\264O\340\251\203&s8A{\234l\205\235\t\252C\317\037"
+	.ascii	"h\005(\005n\342\031\325\340\r\340'\r\333\316g\344f\322o\247\n"
+	.ascii	"\217\006\301\252\273@v\273\005\264\316~\366|$-!O\342|\311\235"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_cliFeature.283.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`8\013\215="
+	.string	":j\364\027B@\242Nc\223\331\343\367\276\251\277\337\327T\255\252\364t\030xb\236_\337\242\372\033\366\024\003\033wh/F\334B\261C\3147@\312\\\2162\001\030\203K\202\230v\243.\216\330s\023\332d\357-e\222\001l\001R\001q\001\373u\277\313H;\255\037\326i\234\n\227\373\034|\272\035\217\307\342\003Y\233\3121\214c\352\202\2679\302\373\226\311j*\0179\f\256s>\334\343\340s\351qe\034?\361\342\027\307\324\246\214\340}\233\251_\272o\337\027\271o3\234s\235"
+	.string	"^\361\226\204\351\033h\335\2368\216\233;\n\213\314Jg\251\317E,\374$$\002\003\004\0048\002\2604*\"R\016\t%\203\200\220G\343[t[vk8\177\353I`e\336\300Y\241\214\251\035\t\360F\351\333\033\002\003\336.\2000\272\205e\262E\247:\200\333\333\227;GZ\256h"
+	.ascii	"plQ+zyT+\263\307\210\275\020\247%\355\204\321*\354\226\273\013"
+	.ascii	"< \025]\2046\246v\242)W\262\n\316\006\311N\030\235\302.\3258"
+	.ascii	"\231s0iz\310\203\232 \025\316*\344\345\013\310\370\301M\241\214"
+	.ascii	"%y\362\354AglQ3\rt\302\250\022/K4r\tm,\311\217,\004\257=JN\030"
+	.ascii	"\225\302\002%B\331\234-Z\246\215w_B\033\213\373{\275\263~\203"
+	.ascii	"\210s\205zkd/\032\271\233\024\203\"\305\236\272e)$\032\376%\305"
+	.ascii	"\274\330\242W\230\225\353}\211-zD\263d\337\254\002C0\207'\214"
+	.ascii	"\"a\227aV\276~w\r"
+	.string	"&\346\324\272\250!\216\343\254\277\304\306\236\013<g\355\224sF\313\331\350\024q\334E!\037\315\323\214`K\230pM\270o\365N\034D\264\376q\351\253n\213\023\223\303\002\320\307\373 \212\245\2248~\376K\305\373$\301\304\302\205\376W\276^\0363\325%8O\344\366\226f-7io\257\302\26698]:1\347\f\343dv4I\211\343\256\t\371c\036(#\237\312\333\374\004\325\346C\271o\225\366\212A=V.\337I\373z\240\177\270\3645\007i\244\235s\215)\375\257\357\337\375E\214\2301\261\032v\355\255\234\251N\275\245n\272xY\363~\2223\204\346Q\347\246s\371\025\334\357\371\200\201%\346\351\236\225\\\235\013$\235\372#\031\235\357\271\350{\317D\317{V\336\356y\350\324g\241\377='\213:\007\025u\006\272\316HW\347\343u6\032u~\257s\261\250\263\373\352\334\276:\263E\235\367u\326\256\316\227"
+	.ascii	"\343\320\271\246n\ng\027R\343\260k\237\270\332\376]\371\337\317"
+	.ascii	"\367\373\375{\177\336O\367\333\275\230\363s\376_>`F\346!\345"
+	.ascii	"\224\251\302\355\351;\230\214|\353\247\305\354\242\306b\307="
+	.ascii	"A?\017\357\333\374@\002|\276,\346\0265\016+\252\tV\341\366dx"
+	.ascii	"\275\2601^\314\252\221\301\203\323r\274|\275< q\323:\030\336"
+	.ascii	"\267\001i\320>\345\322k\235\306\201\366\r%\355\241\rv0nC\224"
+	.ascii	"\314\235\331!\244-\264\3012\321\322>\202\225\351{\2369\3655;"
+	.ascii	"8\322f\356\025g\3028\013\355\260\020\365\3755Qni\323\253\334"
+	.ascii	"w_\335\352\241\212\307>\230\263d\316\360\315\025\356\225M 43"
+	.ascii	"eh\315\320j\350\024js\242\335\334\037;C7\227,\356\177\371!\216"
+	.ascii	"\303$\t\206@\323\202\2664\333p\233\376\345xp\330x\251\344\303"
+	.ascii	"j\356\333\246}\342\214\235\263p\257\214+\033n\0312"
+	.string	"\005J6\367Q\340\332\331\361\202'\332`j^lqC;\305}/g\023\317\324M\363\237*duH:p\225\245\224+\3573\352P,(\317S\310q\301\335\355c\016\016\223.\260\217\3678p\333\013\273\275\317\030Lo\341,\360T\377\313%\222\313s\255>\367V\026\272^\257\327g3\356w\201\2355\364\2103\323\211Q\223\305h@\347\f\307\301]\202\004.\251Z\r\235\357\226^\313Un\b\373c\203\210\316B\273\263)\305-\325z\177\357l8$\275qz\237,>\200\320zy\020\253^e\242\034\261s\267T\360m\034\245\315\356vk=\320#N}\315{\263\373\320?\312\315\340{\353\030\364\343,\264\353\343\024\003\244\223\326ni6\226\025!\354\243@\263:\373\202Wn\260\036\256\336G\313/^\r\361\0069J\212j\306\223\225\323\233\243\260\246:\030\363\223U\026Pv\032\261\201\004\263\003\b\021\033R\220"
+	.string	"\021\224\261\0220\331l\201j\352I\307\006d\316\2015E\325f&V\00263-DIQ\315x\262r:J]e\345x\222\242Q\224\322q\243J\352\312\235\272\225\024\325\266\201\365T\305JYMQIU=\221\210\252\202*f\250\006STPM\253\251\247\252&\324\025V\263\3012\337\300!u\325\314q\343\306U\023I\345J\274\006\256\355LL2\332\006\3068w\236\331\2230H\310\3750\232\b\007% \210]\252^{\213@\024\006\023\362>_\266%l: \b,\246D\344}>\252\021\261T%\350\003F`$q\020\333\252G\2766>\002\372\274h\315RI\341a\200\037p\222\004f\357\363Nx\t\340_$pJm\327\334\374\034\261K\243\235\334`\327\363V\005\332\2674n\344\0063^\313M\356\266\256\316\225\240}`\357/\311\315\340A[H\315L\232g\037\247\276\016\3403\313\003"
+	.string	"h\037\355\270\215[\bh3\207\366q\037\325\314\004B\377\3545r\344\360\226M\3750\332\t;i\360F\372>\263\230\336*\210\002\247\031\005\272U\255\206HdqZ\214\220\f\354\243@7>\242\013\336\310\230B\307W\343>\340\231\304\320\301r\026\367\307\306q\034\027mi\376\332\333\022h\237\362\317r\263\336\224@\373\206\362\263\334\"c\223\267\200\323\250Q,\004\231c\206dF\202\221\2460\205\306\220\002\021)+v\021 -U\220\3156\231\346MP\021q\252l\250=\366\343\275\230\212u\336\310\302\377\214\326TN\254\t\247Q\333\336t~\201\224\212\307\246\374\334K\203$\036*\351</\334\361\245\310\006\315\002]\332\237\277\037"
+	.string	"\036\230\366u4\316\322/\270\323q\234\266"
+	.string	"DAa\272M`\312\246\026\274\375\027\335\3550\004s\206\356\355\222=\272!\354\373\341P\033\241\275m\271-\214\367_O\256\013\274=\244s\235\355\371i\316\324$7\231E\347\t\344y\277\374\3540\320\202\022/\223/\200\323\b\2555\221\037\272\313M\334\222\262E\005\313\213\330\"\024\302\035\246\205|d\021\262\342-\216\rWw\025\202\205\227\026-\276\tO\3120\220q\035\177\232\254\261\343\237\323H\207{\020z\374K~\207\274\004\030\357!\ff\221\307sc\234\306\t\364\004\201\227N\255c\202i\375\261p\215-\347yC\021\023HE\324Ti\314\340\230\235\234\360l\357B"
+	.string	"\266\255\227\034\354 \277\tx\375\351\375\215%\317\374+\330\227\202\032m\245a\"TJ\311U\t\275\023C\220%\340m\020\005\363\330\322V|wSK\234\bl\240\262\365\325\225B\034B\2269\242/\363Y\213\026_\002\366#\362vU\317(\301\272\202\343\013?s\020+4\365\342_4\366%"
+	.ascii	"\373\371\272\237\205\317[\016%z\013\303\321M\374\336-u2\022\354"
+	.ascii	"\005\365\207\371\307\322!\301\242\254i\026\274B\313\241\375\360"
+	.ascii	"w\334\214\2460\256\025\341x\333>\356S2fW\003"
+	.text
+	.section	.gnu.lto_cliRxBind.284.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\315\013"
+	.string	"\246\225N? O\234\016\240\220\347\307\201z\030\330\005\004\330\271\334\002\300\247\375\005bI\311\023\372\311\353\306\036\314\354\347H\233l\3533\013\230\004\301\242\005\0340\245`@f\304\200F\205k\2765\242M\266L)="
+	.string	":"
+	.string	":"
+	.string	"-<.\354W`\304\007\f'`\354.&;\334\373\234\244z>\204\022\001\303\357S\022z>U\236K+\344L\037\273{\022\327\f\341F\025B\331]+\030n\270\251\333V`\333\200}\004\001\247.\376*\325\217`.<xN\032\355j\230!c\307\031\002a\373\226m\025)\210\004\\\355\207\270\b\357\240\n\337\330\375\250X\261+\0160\200\352\323\342'\324gu\016\352\323\236\035U\207@\200O{c\360\024\245\321\310\371\246\210R\322\356\034\350AO*=\201\272\\`B\304Q\222)\265#H\320\203\227\017\225^\214\033\371\331\342\247\222\203\375iw\327\362c\037\364\276\256\353\302m\026n;`i\334\206\3212\225\004\226L\006qvm\230\f\343\266J\006\3134\017\260k\342\256\201\246\301 t\235\006\263\304\375\264\362cI)\306hAn\246\206\276\304Qh\035,v;\007/\001\031"
+	.ascii	"+\341\337\305\220\211\227G\243\341!&\314\212\260\352q\324\202"
+	.ascii	" \266B\211\007\311\200IU\273\372\202}\344\032\320\nC\203Bp\031"
+	.ascii	"\030\021\240\242\004w\t\030\330\324}CM\336\256R\006"
+	.text
+	.section	.gnu.lto_printMap.285.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\256\005-%"
+	.string	"*B\314\016Gp\236Q:\335\016\353\fy\222\304X"
+	.string	"\373S\371\002\211\311\\\2127\353\316r\027Lqi\314~}\260\356\334\300\375(.)\331S\243\013\004m\035\026\330 \023\212\004m92:M\027\245.}:\312o\t!\204\354\235d\326"
+	.string	"\313"
+	.string	"\333"
+	.string	"B\001\262\260\212\223\bW\371)\300Syq\0019\013q:`\237\266\222\375\355>\224G\001^\n\214\256\345\234\325\025\226\263\322A'`\237\022\035\247>E\037\244>m`\267\034\241\0309\210\224\344\"^\321\223s\316a\"\315\036U\276k\027\370[k\253\261\253\232\242\370\002\373\250\3263K\361\030\374\255(\313j\307[\364\300\330\231\255\2531\356@\215v"
+	.ascii	"\361\272\022\243\216kC\327\031F,4\351l\016\326\231\277UG\252"
+	.ascii	"[\033b\225\343l\226\325\325W\034WQ\006=\312\330\300\245\t\002"
+	.ascii	"\247=\022o\nt\034\242D9\347\366\030\343\242hP\216/6Wc\274B\033"
+	.ascii	"\260Y\202\325\036\205\027\237y\246d\230\263,\253\034\277\353"
+	.ascii	"\204\234s\337\342\321\352\375\363\356.\353\356\025\335)\205O"
+	.ascii	"\234e\006\032\023\367\355\006\341\243\017\300\335\274\023\367"
+	.ascii	"E\034\306\341@3C3\033\342`\2672x1\262\373Ig\303#\215\205t\033"
+	.ascii	"\025\235\312?t+\277\320\261\274q\307\362\007]\312?\200\275\375"
+	.ascii	"s\256\367\255\265=\354]co\263\352\355\225\275\255\262\267\323"
+	.ascii	"\3656Z\273\215\331\333w\275}\004\"\322\250\306\256$\265\3406"
+	.ascii	"\312L\343\231\226\321\244bH\316\365\177\375[\376\260\243\335"
+	.ascii	"\277\226\203}yf\267\020\220\200\017\363\021\005\225\231\206\252"
+	.ascii	"\225\0266b\313\017\315WJI\257$!\330\247\375\256{\001\377\365"
+	.ascii	"{\036\346_\225%\277\314r6.\261O\237\003<H\345ZA$T\346\343\352"
+	.ascii	"\225F\006EO\316\312\243\247\275\241\033ci1\347\202\225\027\001"
+	.ascii	"\254\r\357\222]\304\345}U\272\345\034\253\342\006\3159\347\032"
+	.ascii	"F\366\231?\0170|\266\254E\270Q\334b\333\277B\275a#\f\244\325"
+	.ascii	"'\313\260\007\325}^\026#\373\252Go\235\244\r\376\203\253\272"
+	.ascii	"\177p\021\306f\324\025#\321+\203\211\261\206\212\205\240\370"
+	.ascii	"\270B\231\360\356\371} y\254I\357S[\334n9\353H\035\254W\200L"
+	.ascii	"5S\244\203\342\364\214\210\234\231\f\273\005(>\224f\034\264+"
+	.ascii	"\245\353\t\027\212\221\\.\204SgY\0257\302\273\2471\356n\027_"
+	.ascii	"\366\200\212\344\234\223P\260\"\2351\035\330\207\271\030\017"
+	.ascii	"\350\007\020\352\213 \324\247\030#\225\211\035_|\242s\352>\235"
+	.ascii	"\376E\304P\221\234\205I\335\272{ibs\026F\350BaG\200\314\310\013"
+	.ascii	"\365\351\361z\305\271\246G\024\261\251\033\355S@\004\245\353"
+	.ascii	"\255>\024\272\237\212\335\217\323o\004\266\340\364\033a\343="
+	.ascii	"Jj\251D\n\036\t\335\316\204\215\203\024\212\237\316iG\002@\t"
+	.ascii	"\236S\212\247\n,\242\330\023>\235\022T\357G\202\355\246\007<"
+	.ascii	"\024M\271\024<]/\327\024\345\313=\300\365\023\324.*'\365\364"
+	.ascii	"\024\225k\225\371\266\347\031\232)L\365\365Cs\316\222`F\345>"
+	.ascii	"\227J\307\323\314\203\201\301\263y3p/v0"
+	.string	"%\325F\023\317\033\r.\232w\232\344<|q\003;\204Z\360T]bz\327\223\f\032\"\016\366\331\034\254\207#;\323\304\323\304\316\320\326\r1-Zkq\rW\341\030O$\267\213\303,n\246\037+fW|\"V\r\253\370Z\316%\321\371\236:\366e\357V$\2519G\217\235\251\373Lb\303\310^\261X#|\346\331\263d\030\342\362vU\243\001o\250q$\303\224r\006\241\021\221`dF\333\214\001\200\002\031:\242n\021\260\2754tRh3%\236\001#:\346\364\201\204\320\272\206\375\001\212O\372\027>\002\016\f\024\263\224\001\013\227\262\026b\177\337\245\267\310\021\212\220\350\220\0012`\211dp\245\245\016\353v\317\355\371)\302X\006\320\337a$\205!'\243\243=h\326fP\022\320\225\205A>r}\031\342\265\317\023\f\"s\177\021_$\342\031\341\225h$8\017\264\305{\272\300\263\tE\306\244\314-L"
+	.ascii	"\266yn\331\2775\240\327s\006\362\341_\230i\322\256nc\315j\266"
+	.ascii	"\244~\312\274\275]\277\nn\265)d(.\375t\211\200\232\342\235\364"
+	.ascii	"\004\266F7\3516\003\344\247\206[e.J#@X\250\306\272\0070QKO\344"
+	.ascii	"\031\234f\202%\241\007+k\fESzqW30\364\233h\363\007"
+	.text
+	.section	.gnu.lto_cliMap.286.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\331\007U."
+	.string	"\212Q\364\021CP^N:7\300yF\226\367\\\320I\311\265e\327O4\271h\335v\023\237\2130\204\025\273\373\331\333u\206\177\322\275\025`@D\345\310\001\310)\020\217\221%\350(\361\377\3141\326\326\326\214l#D\356$\003\016\001\367"
+	.ascii	"\016\001t8~\315\356\305\372\360\211\335\271W\016\301Uv\260^m"
+	.ascii	"J\255\\\0165\tn\231\257\345[\232\347\262\343B\3672\271#s\257"
+	.ascii	"\\\024?\255WY\356F\304\253\353\211\210W\231\233\314u\220\300"
+	.ascii	".\327\203.\177\302\352\370\334{\245\332\t3\007\035y}*wN\323\346"
+	.ascii	"\211\206\204\202\230Ke\022y4\256E\242\232v\221m\362\313\270N"
+	.ascii	"4\304v\241'Hl\320\332\231m\313\264\001\030\037#\027$3\222&\375"
+	.ascii	"\204\265I\263\312w\255=\t53r\344\005\311\212 \313\234\366\370"
+	.ascii	"\274\257y\370\220\020B\315\240\3348\240\211\031\332\3274\n\016"
+	.ascii	".:\244\2477\344T\310\206\330bj\331\006\t/HF$\235\340'\004\b\262"
+	.ascii	",\314\022\257\370\206\020B\315\320\256\246\305\037do\226e`\351"
+	.ascii	"\024\241\035\264\347\335\216\225y\331\3648\345\354\275\236\275"
+	.ascii	"(\205JCsvA\262#\251\321\232%s\236\367\001T\310\332\254-Z\270"
+	.ascii	"\367\262}\226\231\235\215\316\3742f\246b&\262\ta\206|27\264\326"
+	.ascii	"{\357\333\3709\372ch\266\235\272\373\3168/{\310Im{\311\207\030"
+	.ascii	"\234\266"
+	.string	"=\326\360\326\272\325\370\037@\227\027\245\250\231\340 >u;\351\234\314\r~Y?\374~\352\347\t3\354\262\207\254\264N\315\314\002\313\376\371~\336\207\330@\313\002\277\232\213Y\316\313\266\232 \237\0228n&\314\f\242\240\316\345'p\272\363\323\345~'\246%\245\2079'\255\226\221\216\226\001\030-\037Y\313F\267\\T\264Ld-\017\035-\013\255\226\231G\313\313\243e\245\321rr\265\214\264\226\217E\313\306\325\362z\264\\<Z&\032-\253\253\345\324Z\356\242eK\264|\007\016\336\332\202\374\020\316\275@\016\001\335@\265\357\355t\377\335\037\346\315|\256q=\326\021\365C\376u\307{\036#\303t\t$a\005s\273\346\357l\374:\357:\330\305\360\316\275dSw\306\177\371\\\363\001\034\362\240e\002\301\232+\365SX\207\\\241Z}\252\367\273\222R\253z\350\330$\350[cxT\262\004\232\371C\b+\007\272%"
+	.ascii	"\336\337\240\261\325\312\\\251\241\232\351\306\303\316\231\346"
+	.ascii	"\225v\033j\221?\204\220Y\215\272\241\314\r\026\265Q\0370\tQ\363"
+	.ascii	"\361FP\210>\213\232\230g\301\215M\324Ht^\340\310\036\266\342"
+	.ascii	"P\037:\027\347\310\n\365\365\236\206j\275\327\371'\037\315\001"
+	.ascii	"K\244o\273\312&\250\210\177R\235@a\377"
+	.string	"\034\352&\260\346bf\013\365\321\215\207\2320Cf\207e3\225\313d+\221\235t\2014\266S\037\225\332\330K>x\354\205\031\0320C\007\013\261\325X\213\270w<\255\245\210\250\335\225\302.{\250\266\032\027\317tT\253\317\"\036\3431O\352s\231\213\363e\375\334\215\316\331_\332j\307AL\352\250f\272\211\251q\246\255\315\314\036\216\247U\264v\357\235\372\023O\261\327\266n\202,\261\231\253\254\354\237\305nR\233\3306m\265;O<\203@S\214\252\254\"\267PpcK\212E\f\"\254\257\250\221\242a\\\275\350+\030X/\256\262\252@\250\310\262*\262\225\002\254\027VR0\260\252\262\244\254\266fH)0b\255\030W[R4\264\264\266\244\220r]q\267\320\325^\217#\212\020\335\353s \260\210\327\220\215\364^h\205\337\375w\276\330C\206\262L\327{a\323\315(\332|[\235$\f4\2474\341\354\237\214"
+	.string	"\332\347\177ONE\001\371\024\n\345\335"
+	.string	"\032\223As\232d\352\245\245~\224?\275\367\336\240\245f\320K\267\347!\222\210\024\360\211\307N\263\312Z\007\251!\f\366\0355\200\376\206\317iZ\021\260v\357\327\024s\023\313\3454\263"
+	.string	"\210\336\373\005\341j\234\243\326\021E\203\245\257\355~\364\341c6\267\2040\243\024B\207\266l5\366\373S\267\236:6\366\322\343\017L\331jl\221\367\273\f\276\267\260=\345\375\316\324c<E\350\224\222l\262\027s8\031\212h=\342\f\265\334\333\345\346o.0\206\f6\003\361\352\365\2167\""
+	.string	"\263\206\200\241\250q4\305\2204S\"\"#\222$I\032\003\200\002\231\251\262n\020P\251D\223\fcS8\367@\037\270x(\302\245\030\375\2102\224hc\036,}\275\264\335\372\327 \274v\261\331\202\3247a\227L\003\016\212\234&\206!\023\215==\326s6dh\354V\372\233\321\233\203\363\340\234A\254Q;\263\203c7\270\224B\206\231!I\223\204y"
+	.ascii	"\235y\322\004\202\223\343\270\031\204\220\375,\003KR\244\311"
+	.ascii	"\017\207\325\374bM\205\032 \224\321\250-\334\217\232C@=_\031"
+	.ascii	"\204W\266j\366\r{!\261\037_\304\252\320\324\027\275\344\335\200"
+	.ascii	"\234@Vp!^\237\270\253\235DB\262\202\177\336\320_\nP/\024K)\230"
+	.ascii	"6\002\352)\344\001.\r\265\216\227]R\270\375\233l\267\037\025"
+	.ascii	"C&\210\301\375\347m\3703OV\027Z\017\246+\275\001\220\251q\247"
+	.ascii	"\203\246\237\t(\027\030\022\370\365\336\323\026\234\313\270\311"
+	.ascii	"0\306X\231\303\272^\365\213>\203\342\317\006\337\001\371\277"
+	.ascii	"\346\320-\025\303\031@\3401\314\032B\234\027x\311?FQ\346\031"
+	.ascii	"\007Wa\303\224\336o?\026\254U\320\001\361\372\035a\207\024\006"
+	.ascii	"\255\013\251#\262\206\272\232~b\\\\\0279Y\r"
+	.text
+	.section	.gnu.lto_skipSpace.287.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\275\013"
+	.string	"\326\325O@ Q\224\016\234\b\270XA\034*'\217\223\353\030\211A\020#o\007\351\003Q\017\315\001N\266\312\306c\336l\303\36681@\005\223\276M\002@*\b\330n\365Hq\nfZ\344\254\032\331{K\231R<"
+	.string	"?"
+	.string	"="
+	.string	"PE\370\345u\3704/\237*e5F\032\350\360Q\230\351\003\200\206=\314\311D\344\334\223\244\211\362\231\340\270\236;\203\222,d\244q<\251\005\273\353\034i\033\356x\333\032\333\005\354#\b\231\351S\tN\274\340\360\fd\327trcI\240H\t\333\037\273b\333\371\355z\200\335\216\r\306ng\300\004(\207W\361\025\037_\252\001\013\201P\020\203\313\340\302\306nW\271\273%\036R. >\361\372\024-h\\\310\223}\026\026<\024\022\376\025\017\257T)\013!y\b\275\335\335\347\003O\215J\225d#\030P\210\362DAF0M\325\303\356@\211\031q2\261v\330\021~\373\365\333\035\226f\263\251\340 :s\341<\310T\0218\r T\031kBu\261\270#AcU\024:\035\253\252t\373\367R!\324\317\b\361\201$\244\"\250\036>\367\233dt\370\320\250~\251\232J\262\355\001\367\004\025"
+	.ascii	"\3571\216\020\rN\244\214i\250\r\275\017-D\226\005 !\241\f\300"
+	.ascii	"l\024\210h\271C\261\313\226\275\233\261\347\317\f\205\312\022"
+	.ascii	"\334\322\247j\031\250\227M\302|\002"
+	.text
+	.section	.gnu.lto_checkCommand.288.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\266\001\365\020"
+	.string	"vatG\340\322&\035\"u\030c\"\025i\244\374%s\364E\017\017o\322>c\272\345D\231\200\005jhU5.f\364=\303\351\354\372\344\375h\274d\030c\214Q\2313X(\257\003\215c\227\027iu\203~#\204\354-eJ\001f"
+	.string	"X"
+	.string	"_"
+	.string	"?A\343\324NX\325p8 4\204\023;\232\023\364\f\336$\273\334^\222]\256\317S\317d\\M\371\252g!.\227Q\353\265s\031IR\300X\241\220\360\360#F\225\325Q\006\221\327M\354|\340\330\340^+\335\310\351\324\200\211\274Xq\205\207\006\024\207]s^6\252\032\313\234\323\332zU\270\265\333>\331V\2615$\037y\321a\004\321\315\252lP\245\333c\177\3030\f\275<.\375\347\357\016\376\234\325$\253\267L\255Eu\026\325R\252\243\325\033\325\272\352\213\254\224\240\260s\027\2139uB \223H\272"
+	.string	"a\233\306\346l+(aG\001\375O\352#s\362\250h1'\210\342\001\333\245m\337D\273EW\241\0201h\304l\027"
+	.string	"\341"
+	.string	"\240r\355\357E\337\312\366$\256\334\353\300\t\342\307\"\314ls\316\177\360S\331e\334\347\\\250\321\320\337nwKV\270f\260D\330h\350\243\312\321c\267\307\004\256\253"
+	.string	"\350\306\215\372p\247_n\273\265M\f\364-\335\023\326\252LRnm\224\003}\353{X.1-\247\023\352\323^bL0.\247O\363\227b\202\371\274\030S\313\311\373d\036x)&F5x\221\361 \240P2\036\007\316\307\271<V}\320\003`(\212\017\372a'\221\245%m\216m\322\232\245fm\342\234sf$\272\255\215 \201\276U\322\266\333m5f\340_m\005\270\\F\254\r\032\2630$C\316d1\036"
+	.ascii	"\3571\376\210\267\244\t\002\007\205h\324\r\034-fP 0\330\255\217"
+	.ascii	"580-\300*\240\332\031\246\b\306xzlq\360l\307\005\3105\225\220"
+	.ascii	"#\"\327\004\016\n\301e`\004\250{\307O>\027\226\273\340SG\031"
+	.ascii	"\reM3"
+	.text
+	.section	.gnu.lto_cliRebootEx.289.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`F\001\205\016"
+	.string	"f\332aF\340\2246\035\004B\307\360\354\007\001\013\005\361-\b\260\3748"
+	.string	"\206\030\ne\301s\032-f\004zp\n\377\250YL\n\232\305\331L\263\337\207\022\312\361`\bC\021\377\017\251W\240\021\3468:\026`M\277\365&[\246\024M"
+	.string	"K"
+	.string	"M"
+	.string	"\237\327\007`\237>\331F\bxXp\301\017\221\017=Jv\227\223+~\372\274\244\236|\026\225\216P\004?/\343\016vT>\241X\342\327vym@\253\"\232\210\272\016\334\370 \021@L\251f\rv\327\032\212#n\354\266\037\330f`\177'\241\206PM\002\003\237\366\006\016\372\320\bV<\306\224\004\355\026\2502\307\376\265\273k\211c\237\347\317T}M\201\220\033&\016\002\310n\210 &;\316\034.4\333W\3730\036\343t\236\031\237\354\252\330\201c\267\305\342\002\241O\225oXrud\004\265\311[\2047\243\2249\366g\260Lb>Ah\fI\351\022\013P\273\202\213\\\375H\321K{DRy\317kt\360Y\270\324\351\303O\277\303>//$Q\331\320h\220Ej\303x=F\224\004\235\351[\237!\223\242\263[\363.\305t\020D"
+	.string	"PL\244\322\367\"\301\344y\026H\037\212G-\035\206\021\027\323\275\300p\243O\206k\331\354e }\234\311\363>Nk\355\257\2258\326X/F\032\211\232\021\\n\203ubD\241\330\025\311\262\321\037$@)\256M\355\t\024$\350\220\316\212\330\335\225\034"
+	.ascii	"d\n{\027c&^0\205s|\330\210]\266\303\354\301\032o\314Z\200/\240"
+	.ascii	"\212\326+K\264Ada\365\230tD\023\fb\034\341x\2521o\241\021#\205"
+	.ascii	"\365\300\250KX\304j\364\270\3130[\244)\364}M="
+	.text
+	.section	.gnu.lto_cliReboot.290.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375 \325\355\005"
+	.string	"4\n\203"
+	.string	""
+	.string	""
+	.string	"#\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\234\3235\201\200\205\030\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\357\231\001\226\354\3474\003"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\201\003\204\340\275\246+"
+	.string	"\212\001\002}{"
+	.string	""
+	.string	"\006y\001"
+	.string	"\002\004"
+	.string	"\203\003\202\340\277\246\013\244\003\001\200\300\013/root/repo"
+	.string	"\025./src/main/cli/cli.c"
+	.string	"\t"
+	.ascii	"3\003\226:#\\\270\3175\334-\204\3612\004\270tc\266\266\353\264"
+	.text
+	.section	.gnu.lto_cliDFU.291.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"\315\007"
+	.string	"\342\01665PU3\006"
+	.string	"Q\246\252\347\252b\276\262 \244\256\227x\310\016g\3307h)\320\217?\033\324\346\277(\371\325\210\271\332x\316$\325>U\377\020\270\211\220&eJ\001\330(\023\205\264\253\3024PCH\273\252^\237Lt\315Q\006\322\346\305=\314\217\247\233\003\306M\210m\343\246\025\336\234K\260\026HL\311B^\224\212v\004\325JLD\1775"
+	.string	"\201)aH\257\r\275(?Zs\376\277\022l\245\302\314J\207=^\376\215\033\233\227\246\226\221\266\266\332\306\220B\346\300\2615\211K:\233T8\340\007SX\376\020\241\005\035O\r\355\241<u,@yj\327\322\fd\334[p\021\321@\251\371?e\210;\307\256\366\211\001>\222\347X1\374o\374H\034\256t[\202\266\tmU\002\f"
+	.string	"\357b\310\304s\276h\302\005b\327 V\030\017T\003W\300\334"
+	.ascii	"\025\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliBootloader.292.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`y\001\345\017"
+	.string	"\226\235lH\360\222(\035 !\373\311 \254}Q\330i\200\266\025F\224\025\310v3\336\337\024\220\360\277\022%\024\3057e}\226#5\364\021\343H\"\250-n\232@\025n\221\245\252\026S\032]\221\263\220r\257X\370#\315\022\262\267L)Y"
+	.string	"Q"
+	.string	"]"
+	.string	"\"\356\033\350\003\270o^\331:\004\\\225\325 \207\013\230\233\235Zk7g_\235\333\350\334\225?B\262\316\231|\2139\245"
+	.ascii	"x`x\220\220.\312\300\265c\"D\266v\322\004An\b!!_\250\b\226b<"
+	.ascii	"\315\027\004\331\332\375\254\324Z\275#)\342\376\334v\213m\013"
+	.ascii	"\366Y\004Nm\330\217\237\247y\tMF\244"
+	.string	"\326\232,\273d\355\224\261Ok\255\3253f\177\346\347^\376\224\256w\256?\242\302\023\"\346%rj\205\365\024\251\265\r\207\n\333\017\331\336\262\203\216\202\257}\030\217\261\372\214\207\227\324\032\313\261Qk\271\300\b@\337\\>\0238\233B\005\224\231\f\001\373\232\327\270`\340D\013\350\345\340\344\233M*\355G\2376\0331_\320\350\241\203N\031\243|\347G\2063\304\306G\200\235w\341^\363\031\037\250\326\327\307\f\240\227\312\31170\334\217;O\223\365\324^\273\303\005[1\315\201\373\234/\034 6?Z\313\343\317\322\351\366L!8\022=\023)<\251\302\020\303\350\001\213\204\021\352\033\271\240>\225HR\245<\361\200\301P\244\036\352;y \t\202\t,}\\J\371N\245\016\365\221\300\256$\246\272\024\221C\r\236\330\251\302P\354Be\375\214y\345\303|\341\n,7m\226\b\373\321\3247-H\240\330L\366\017\035"
+	.ascii	"+\341\337\305\220\031\232\316\344\301_\222\233\275\204j\037\\"
+	.ascii	"q\202 \2441\\v\347\022- \214F\260\t\024\f\327\312~\220\325\325"
+	.ascii	"\256\326`\013\272\306\266\302x\240\032\270\002\346\006\250(\300"
+	.ascii	"\035ii\357+\341\212[\250("
+	.text
+	.section	.gnu.lto_cliExit.293.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\032\001\355\r"
+	.string	"\246\231_F\360\2606\035\357\305\347G\213\244\354.Gx\261M\320\360\020\2218\343T$hs\241\323\373o\3220,61/\002\221\352\324h\211Y\243\310\310&\224EE9\332\305\031\311"
+	.string	"\"\211VB\334\317\220W\375\177[\357\235RG"
+	.string	"L"
+	.string	"L"
+	.string	"\322\376\211\317\230\216\202\303\001\354\246hjvG\003&\3609\365\370\220z\372y\200zj\223\215C\200\207\r\023\320\270\361\241\305\315\356bSu\323\245\311\277\212\177\210\250\360\322\303`w-ET\210{\336\366"
+	.string	"\333!\373/\001\356\276\002\252\034\253\323\f\355\221_q\026\240H\211\335\226\213*\237\026\004#\247v\006\r\362\242e\215\231\026N\253\303\f\3551\224\223\204}\217\335]\317\224\3751a^\\@\210\370\b\033\273.;;vEg\230\260}\220m9n\260!y:\"\322\246`\222b\205\323:\375\244\3725\227qR!\024\252\247\013X:2(\325\207\361\030(~\214-dY=\235\300\312\271\361\265j\373\300i4i\263\273\n|\027\177\261\3711\247\036q\362\"WO%\260rdt\260\310\035\203H\007N\001?\322\005n#/\273\240]\242m%\003=\225\213d\023}\335\345\340A\203k\344q+\331F\032\331<\216\264u\031\004Q\247y\254\225p$\r\363\270\254\303\264\022\210\225\204\370\303\260\225\260\224\357+a\240q\357\2613e\020\fj\3052O\021L\246*\031"
+	.ascii	"+\341\337\305\220\211GI\243\341\"\326\274\006\346H\246A\300w"
+	.ascii	"3&\201m \307Ge\005\222\313j\277\"\263A\220Z\033.\254\2550\036"
+	.ascii	"\250\006\256\200\271\001*\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliGpsPassthrough.294.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\335\b"
+	.string	"\266\320=80q\323\001 <\320\214NzU\243\205\f\343\374\264\330\r&\b\213oC\007\023\266\221\2713j^\375B\341\b\365R\240\003.%nM\353\021E\225Mi\212\232\b\331;\245,"
+	.string	"/"
+	.string	","
+	.string	"\003\327-\2076\r\201\305\212\236\027\214\213\225\232\335\255\364\343\341g\350\037\345"
+	.string	"\243I\374\304\026v\327s4i\334\364\266\rl+\330\236\t\036\217\323\306Abv3R7\213\262\\Dl_\263=K\t\033\204O\373%7\t\1772q\201]\022\246e\267L\360Av\313\3459\327\255\354\001\266\303h~tA\005\025\355\247\\%\302?\031\2024?\222\256[\247\0012,$\034\245\231\262Kq\322\016\373\325\356\256)i\323\351W\001\234\250\013\201\274\r\343\274\017\003\310\3330o\235.\264UQ\367\361\352\006\216j\207\343\257\201\003\353\303\367\201U+\367\325R\322Z\310\b\252D)\234\315\323\r"
+	.ascii	"\357b\310\304{\277h\301CkC\260r\rm\205\361@5p\005\314\rPQ\300"
+	.ascii	"]^\264\223\f"
+	.text
+	.section	.gnu.lto_parseOutputIndex.295.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\023\003-\031"
+	.string	"\266\257\253H\220\232Q:0de\310\350\206H\227)\2524\362\032\300\231\021\234\333\277\242\263L\002\023\370,r\337\350n\254\377\362\344\215\341\021\263\2607U\211\253'#n\220\261\0200f^?\301B\200y\037\350\363^I>!D\356\224\002\226"
+	.string	"\211"
+	.string	"\231"
+	.string	"\037\306\270N\255RX\246\324:|\340\004\346I\017M\333~\222+\331\331\305\rLK\301\bE,MN\332\324Zi\347y\312\223\343w\312\223\033\344\273\347\230\260\222\034\227\356|\336s\256\365\034\037E\2573?\234\242n~)\3520"
+	.string	"\301\247\227c-\n\352_n@\215\026\246\302\214\211\005\177\224,\253\252\304"
+	.string	"\203O\037G\006f\270\326\360\330\030\002\214\005}tG\037+7VdA\246\361"
+	.string	"\221i\352Z\2474\202=Ja\027j\255\246\300\240\323\r\340\266\237l\347\260\251\226e\260\274\370\250\033\233T\300\332+t\364@\331^\353\004\336P\035\351\362-\317\036\362\350\n\355\217\265\326\352\225\262?\374w\236\365\353\234x\313\336\344\0270R\233#5l\244.Ijr\251\307\245\336\221\232\222\324/@\275\330 1\262\346URj\265\361\005\247v\221T\210\234\370\333;_\3131\237\350\342\253S\375\f0\305,fj\255\rN\272\2029R[\302\204\335\263^|\210"
+	.ascii	"jK\311\025\b\264\t\2146\016N\355/9\223]\217\362\343AnI\256\201"
+	.ascii	"4T\\]=(@\262\314\025~\337\030\331r\005\373\326\271L\2340\177"
+	.ascii	"&\256\272|\313;\"\004\215\217r\205\376\213r\\\031X^:\273;\356"
+	.ascii	"\222i\202\372\327],e\273\333S\243\252L\023\225\036\375Z+59\300"
+	.ascii	"\220\003\250l\277u(\266\2361\265\376\016\274\231\277\240\005"
+	.ascii	"D(\350\201\376\023*\253.\246\345\331D\240\327\216q\205\226\241"
+	.ascii	"\301\352\342\243n\374\245\373\2468K\364\3131j\2530\242\007~\177"
+	.ascii	"\325\243\267\274\277J\221\251)\273B7\270l\367g%\236\r\371\234"
+	.ascii	"\017N\b'\005 \rB? \316\031\b \f\035jB\247\210\332\007\0215\017"
+	.ascii	"g\206 \016?#\204\202\024x\246\303\341l;\236\r\371\234'\212\243"
+	.ascii	"\"]M\307\005\321\320Q\220\022\013$%\026\271\230\356\246\003\302"
+	.ascii	"\341~Z\344p8[\200\0247\244%2\262\t\r\031\335`\276\315\212p7\332"
+	.ascii	"Q\221\315\210vK\322\321f<\316!\021%\321\224r\271$ZlX?\326\225"
+	.ascii	"\262L\007\227.\260\343\320\301e\2109\273\2714l\233\353\013K\333"
+	.ascii	"\313\351\241\260b\b\0055\363\227[prgm\022%\316\337\362<{\271"
+	.ascii	"\260\r1 \220\002\021\262\253\007i\036\031\345E\247<\002\217\177"
+	.ascii	"<y\211\230s\357}dEz\230Y\303+\374\310\267\372\270\345\356?c\013"
+	.ascii	"\017\221\256\215\3574.\321#\3650r\232\347\261\350\271B\002k\270"
+	.ascii	"\333\017\253=&\3712\301\337\336\026\306\007\266\305\363'J-\230"
+	.ascii	"\211W{rk_\213\245\215&\340\025`\356v-)\240\237\032\300\367\203"
+	.ascii	"5\372{M\316VY\253\201\002"
+	.text
+	.section	.gnu.lto_cliMotor.296.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\374\b\0356"
+	.string	"\272]\354\024EP\344U\007\243\243i\336\311\004\302\210\271\337\020\316\333qCsR\324\036\360\0018\224\016)\211\233\313,8\036\360\277\200o\020$\374Xk\222\001\202\202\363\016\005\020\346\221Ba*\204\n\327]I\333{\357-eJ\0017\001,\001>\001j\030`3\252\337\256\356o\342\211\223\300\355\035\265"
+	.ascii	"\177;\366d\307/s4\277\265\366\363\220\023+\201\333{#}\353\023"
+	.ascii	"\340o\203l\216R\275\021?\273?\364\305\216\017f\307\023\355\355"
+	.ascii	"u\246\266w4\311\027\300\337z\364\201\356\267\360\033\271\337"
+	.ascii	"\036\335\363\b\300\332H\n1\017\245\230\270\275wQC\371\377\371"
+	.ascii	"{\275^\257\317F\337s\372\370\300#\243\"\242\237\257\007\2007"
+	.ascii	"\264\323\345\340\327mY\235\217\376\272,\344\003\217\244T\336"
+	.ascii	"\250\210\210}\261\202T\371j3\n[!\020\334\332\263-\311\277\257"
+	.ascii	"\367\365\276\352\353\001T\233U\324\234\231\367j\350\322\222\362"
+	.ascii	"C\325\246\0226\270\367\376\260f\222\274c\023x-\001\364\325&\030"
+	.ascii	"\033lCU~X\023I\326U\233G\260rN\370D\213\353\341\327\nSm\353_"
+	.ascii	"\366\202X\227(_mn\261zl\214\232\227\2760\2549%\273J]V\322\005"
+	.ascii	"\202\241\221\342\302\256\346\226n\237bg\334\245\305\365\254k"
+	.ascii	"\205\207\033\024P\227\326\224\327,\004\247\233!\275\254+\026"
+	.ascii	"\030\307\311\235\227~ffY\345\374j\330{{^fi\275\007x\367\337\342"
+	.ascii	"\356E\334_\257\356y\376\235\360\327n\356\350~\360\255O\017\265"
+	.ascii	"\t\201\003\004w\225\013i\253\235\2612\355Q\376\264/\223\342\310"
+	.ascii	"m\371i\277F\305\320m\357\344/Y\300I\250\006\337\272P\312\277"
+	.ascii	"4\2403Z\325\01359\264\332S\305\3662\002\355n\204\221\177\351"
+	.ascii	"\217V5B5\352\021\247L\353\247\337p_\277 \253s\225\003\371.\013"
+	.ascii	"\320\3562\236\362/_\277\364\337G[\026\023@pW\032\351\036Ef\375"
+	.ascii	"t\377"
+	.string	"\n?\330\314\\{\271\027\223\210\020\206?}\027>\230\177\004p\366\003\006\340\354\004\340\354\003>\372/\340\327\336\177\2767{\357\361\206v:8{\356\315\016\377\331\373\373e\357\256\233\275}3\357l\233]\267\3313\233\375%\340\360Cf\025\023\367\320t\242;\310u\320\246\266kV~\355\177\372_\366o\366O\346\377\354\337\314\277\356g\374\331|\267\326\343-f\363\004\177\232\277\232\357\276\235\346\b^Ew\326n\352\203\n\215\333;\272\002\376\366_\314\217\3712\217\366R\337\231q4\354&\323!\336\272\262\367.q\306\345\201\f\225\006+\036 b$W\366\016j\257\333\247}\236\r\023\2768\300\311\250\006\337v\370`\307J\204\252\324\310\227\013\212rH?\335~\312\325:\212\254\315w\275\306m\375\224\233\265\326\377\352LB\217\217\251\262PU\276\366\302\322~\354r>\355j\246\347x\372\315\3554\253\231\376\216\306u\265"
+	.string	"h\030\222\217\365\315\300\020\261.:\375\364\0341T9\205\223\2641V\242\234\262H\357\323\314\035\261\230r\n\027\207\264\tIc\r\350\036<\324BH\021\026\351y\260\016\b\213\364;\315\244r{\332\001\024J\030>Vv\357\275s\372\351/\3756\356\242\034\363B\320\356\362\264\267<=\244\231\316\276\273\334[\034E9u\211\332\331v\247u\232\251\3039e\216\212\357\343\234\002\302-\352\027T\025D|\237N\322\357\224I'\351\264\312W\3776\377\232\315  H\230@\356iw\021$\362/!\304\324+8\377hU8\324W?=\302\023\265\003(X\030>\326\267"
+	.string	"\231\370=m\342D\376%Qk\266*\0335\251\221\376o\036\001\221\035\007\207\314\204\276\211\023;b\\\375\244z\022\226o\031\007\355\262\231\2649\321\363\300{#\337\311\004\031\177=p\343\001\3164\fZ\250\021trR\3629\3230h\201i\030\344y\207\023!6\240p=\230\233^j\212\206\324\024\211\037\b\343\224\223\022\212(()\250']\224\024\r\243\r\245\032o\214%\032\032\207\221iFSk\234\321\344d|R\032\301\364\264\364\372R\204&\247\245\342\214&\245\247\342RT\215b\004\240C\3210F\025\245\240\240\242\212\273\350\226\276\206*m\225=\212\224\002\337\262,N%\005"
+	.string	"\025!rD\305\356\335\225\341\311\374\303\215\345\353\033\021\241Y\331xq\364H)\022t\\\322\004N\276\362\013\221~:/\220o\250_0"
+	.string	"H\377\323\314\237\316\351\\\205\254\r\3269\375\312B\021\262\373\361y\204\222\177\t\353G\302\304J#_\350e\214\221\037\361\177z\250\013\350\371\241\206"
+	.string	"\333\027\331\261r\371i\002\372@\365L\217\017)\0135\253\377\314\3779JI\340v\244\002's48Z9b\321\326+\f\262P\037\320r\344\242\366Eh\326%T\254=\317\352\003\332\263r\313*_\307\300\340\364^\247\031\364\005@{]Y\335*\315\276\220\325i\265Pg?\3116\005y\200v?~9\212\345_\266\372\325\036\210f\345z\365"
+	.string	"\355y\271\247*_y\301\354\013\200\273\250q4\304\220RF\031\021\031\031i\222\244\003p\002\231\2612z\021\240\301D5I2\254\001e\0204\360\037\351K\353\215\021j\230\376\332\207m\302\263\202\217\303\210*\230\021\027\210\327\237\251\234\035\022\265+\021\246mF\f3\341\t\260%JY\320\321\320\211\002\362}\003\003\334\315a\350w\355C\303:\271\0373\323\270\013\023\004\250\375\220o\317(\204\023\031\275\316\nV\344\264M\273H\f\\\020(\261\200\327\025\346m\241\r%\247t+\025E\3456\236DKxi\361\016\006\033\025\305\3715+\345\344\272>\326\005\230\266\200fN\237\365\205$\270\253\205(\f|\360\255\205R\214h!\252<\217"
+	.string	"\327$\212j\337|^\217\330\325s[\377\234\263#\313\263\nd_\233~=\002\"\222K\220\2571n\277g\377\320\315\323/\007m\253\304%\360\324\260"
+	.string	"pm\034\336n\325Z\303gEY\317\236\235u\263\271-\216)7\375\"\025\305W\013\234\317@\"\372&\256\001\264\276#\032(\267\322)\004\374\032hz\246\236\216t\347\331"
+	.ascii	"\234\350U\016;\215\370\327\177\236\275\230\330\245HS_;?LI\213"
+	.ascii	"\201pf\314\261f\201Y@\356\353\247\246\035\333z\223\217\302\301"
+	.ascii	"\f(\345'\2143\343\342\275\023\001\007\026H\373>5\022`\230\223"
+	.ascii	"\022B\332\337\016\204\026\270\0240\336\361O\314\364\363\033k"
+	.ascii	"\374\fy\321\223Z=+\303b\034rS#\324"
+	.text
+	.section	.gnu.lto_cliPlaySound.297.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\032\005\275\""
+	.string	"v\276\340Hp\334Q:\353\307\327\271\3773\344O[\003\235\331\232A\326\203GArT.&\345\233\320\3203l\257\251\356\215\007\223\340\0214:\002\030}\326P@0i~\352H'\320\002\024\312_\253=y\350I\212\366\244\021B\344N2\313"
+	.string	"\274"
+	.string	"\320"
+	.ascii	"k\3672\215\2362\003f\313t\261\346\350\226\371O\036F<\224\252"
+	.ascii	"\003\270\327\013K\226{\231\n8\301\372\224\231\017R\237\256\007"
+	.ascii	"R\2372\221\231M\200\253[l\300\306\0069\005\316\275\367\327@\030"
+	.ascii	"\265\304\363\354\344p\253\356\246\246hO[\"?\227U<\317\201\235"
+	.ascii	"\233\221\0349\364\201\230\"_\324\037Z\200\034L\251\303\342nH"
+	.ascii	"\031\214\340X{\362\364\241\265\343\353\356\253\306uWSv\201)q"
+	.ascii	"\330\033*!\214I\020]\026\022m\2612//\373\0010\345\226Um<\325"
+	.ascii	"e"
+	.string	"\035\257,\272\326x\017z\344D\242\343j\312-\024(\207\231\363`J.\333j\312\034\250\357\336\373\262[\254,\243\2657\244{/\333d\226\326\331\347\314W\231\371\0053*#O\n\265\rCfN\363\350\266y\3751\307.\343\257\334\214\321\370C\230\212\271\330'\231\213\372\324\266\n8t\2368`\330:WR\345\252L\367\222Y\250o\022ci\254l\034\306Y\237f\036\246\260O\276_\366\313H\343\301|\256Yu\221\231Y\264\275d\276]\243\205u\205\333\213\371P~\001C=!\336\317\356\314\337\347b\347\034n=\331\371\246ZVS\313ij\031M-wj\331\242\226\217\240\235`h\314\270\361\031u\356\245QG\316m\246[\214\264\275\330O\366f\376\307^\306;|)\237B<\031\243\375j\335\307(\303\006g\355\336\373`}\352C\017\244\212U\355\256\332}\326\222\355\031\031\326\343R\321\006%]\032\222,\3175"
+	.ascii	"m\230Jr\275\344\237\226\032C\263\373i\033\306\331\244\307\301"
+	.ascii	"\203}r\327W\343\\\322\264\352\"\216gO\345h \030\234\271\367\370"
+	.ascii	"d\210\365\030\241\350\251\200f\0261\302>\311V\215s\253y\325\305"
+	.ascii	"!,\\mkW\341\362\362\242k/^;Est\264\323\376\026\264qo\314\216"
+	.ascii	"t\2055\0315bVn\275\344^\332WWj\364\002_G\264\327kca\371P\232"
+	.ascii	"u\210+\355\253\207\332K{\357-\246\250n\355(\2669\310\263\036"
+	.ascii	"^\337\032\253\327\335\007\033\033\343c\231\235\200\366\311n\252"
+	.ascii	"\036\306[\367\372\303S\212\321\fY\227\021\275\367^\264\227\374"
+	.ascii	";P\013#\244\247\275\252T\241\226\032C\303cy\315\034<"
+	.string	"a\003<E\344\203\360DdB\030\244j\202Z\n\342'\"_\013\340\2230\350\223\032\226\360=\tW\f\247|\303$!\256\220\344A\211\203\357B\022\006\020\0234,\371\230\224\230\230,\360\202\007F5\tQ\2400\b\005\214jJz\212r\272\261\323\202 \224\323O\030l\212\3729IM\375\026\004\361\020\005P\352\247b8\224\372\3550\357\221`\264\321\214\207\215\016\262\254\205\372D\332v \317p?\3755mI\344\231:\324\271\306j\336\352\246m\013y\206\3335\243\352\332\270\306b.\262*\022b\022_\002\213kfb\023\242\023\373\244\332F\316/\003l\256qMbX\0201\312z4\321\316.\315c\027\331\200e\246`\301\310\211\3264v\221q-\246\303\223\213e\236\021\371\2613\300\356\372T\016\006\003\201c\2501<\344\020C\306\210\220\00422$J\033`\002\231\242\263\016\020hi\232\264\006\377v-\310\277G"
+	.string	"\264#B\211u\225\002ch\247\f\302@nm\200@\n}\201\274\256\230\253#%\255\372\265\251Xa;$4t8\370&\020\037\244\300\001z\t\266=\3535\007z\225\206aC\343\355I\027]L\351\037>-\263w\274-ES\227QP\241c\036FDG\307'\230\342{\226\232=\360R\261i\272\264\177\350\376\330\214Z\361\376\034\232mUK\316\341\034\361\337\345\035\230\252\311\347\275"
+	.ascii	"\301\321u%\030\336\221\002\367\247\362\002\"\237\220\337\271"
+	.ascii	"cs\200\251\367H6'\202A\314y\343\374\251\035.\366SD\322\370\337"
+	.ascii	"\235\333q\232\t\200\007P\203\027~\034\341\017"
+	.text
+	.section	.gnu.lto_cliProfile.298.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`:\002m\023"
+	.string	"\306$\201I\300\224Q:h\246\253\006j:\317\035Cj\020\303\267L\023Z\256\214L\355\350\250L|\274\205\312\252\007\261\350\021\277\257\313\254\325o&6m\207;J\307]\003\b\016L\213\202\325m\220\274\241\361\037\240\252Lk\244\021B\244L)k"
+	.string	"c"
+	.string	"o"
+	.ascii	"s\336\222j\314Y*p\001\361\240\313\253\204\007\305\243\204\007"
+	.ascii	"\035\263\205\004\310\2312\006\274 \235\\\323\234S\265*|\257\306"
+	.ascii	".\236B\360[\215\3715\331\305\317z~J\3010\361\320\244\246s\035"
+	.ascii	"MA\026O\210H\n[\317\277\017f(h\205I-\347[\334\321\215\027]wj"
+	.ascii	"8\272(\327S\314\234\323J\326l7\352\266I\330v`\353*\377\346\234"
+	.ascii	"s\027\310\327\027\036:Xxo\366\211\376\361\271;\025\252Q/o\361"
+	.ascii	"\345\017\236\324_\250^P\255\237\372'0\274$\024\367\2411'OO\311"
+	.ascii	"\\\002m\274x\356\366q\276\316\243o\364\030\261\347B|\332\346"
+	.ascii	"K\270\340\021\r\231s\"8\350\005\342\301\226\357\243m-E\354\022"
+	.ascii	"\\\355\013}(v\242\021?\t#\223\222\355\261\303!\201\013d;Ew\217"
+	.ascii	"\273\222\205\025 \027DZ\003c\310\240'\335\222\2632\353\356~\206"
+	.ascii	"\316\222\231\366\f@\355\025KOj\312\216\351\310\322\215\200\023"
+	.ascii	"CA\237\356\004r\204?:\022\207\333\220\370h\232\223v\262%\322"
+	.ascii	"^\016\034\364\247\340\212\273\003\"\374j0\n\202\243I\234Rqm\327"
+	.ascii	"KO~_\364\221\311\310\022\316\312\354R\026\2361\320\302\242im"
+	.ascii	"x\301lF\277uVM\213\206\345\222\2210\343Z\235\274ri\321\254T5"
+	.ascii	"-\031\227j\005\363\240rQ\361\313\206\005S}x\275`\252\261\234"
+	.ascii	"\337\233cf{\323B\034\240\343\332\017 \024=\206E\351\207wbQ\324"
+	.ascii	"\332\021&\\\367\223\335\217ZjQk%\213\314\264'\343\347\206#\\"
+	.ascii	" \353;\204\337\302\214v\354\267#\217Oo\205B\005=\231\332\353"
+	.ascii	"\036. \220\202\022\252\365c\370\307\030\242h\271s\334\257\326"
+	.ascii	"V\265p\205\227\357\310!\255\363xc\233\021\250\371\003\344\262"
+	.ascii	"\003\274\231&^\327>\031\332j\242\355}\335\253p\273^\267\365\002"
+	.ascii	"#\202k\314(%\2128S8w\323\215Y\213G5\256pn\200Q\362\2124\251\350"
+	.ascii	"\310\332F\217\237~o\343\027\334\030\237s\256\265\324\t"
+	.text
+	.section	.gnu.lto_cliRateProfile.299.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`>\002\245\023"
+	.string	"\006\345\202I\260\226Q:\024\307\320\330\355\354\253P\003q\3630a|b\377\244O\2648\317\t~\335\026\265\302\230\346\323\311};u\016\354\343_)\013\304\230\341\001\357\216\233\035!\373&\223\373\3707\312U\220\3612"
+	.string	"\2405\322\b!R\246\024m"
+	.string	"e"
+	.string	"p"
+	.ascii	"*s\342\232n\314\231S\340\002\343C\347\316\">\034\277\">t\314"
+	.ascii	"&\022\240g\312\030\370\232|vJ\346\234\253E\341{5\366\021%\206"
+	.ascii	"\340j\314\267\311>~&t\224\312\305\210\213(6\237\363h\032\226"
+	.ascii	"\276\036GN\004\t\035\004e\214\210R\240\330z\300\325)\3518\322"
+	.ascii	"\365\307\306\243\273rE\315\3149\2555[\320\235\272\355\020\266"
+	.ascii	"ile\0059\331\3019\347\334\035\3625\006\b\017\025^\234\375\243"
+	.ascii	"\237\374\356"
+	.string	"V\211\352\324s\367\370\334\037\242\324\240\250\336P\255\240\372*2Mh\224\370\315\306\234@?'\323)\314\321\342\273\333\327\371<\223~\322c\304\276\363\360\0314/\202\205\357\207\2219'\202\207^0>|\001O\332\326\334\207\"\t\256\366\213n\024\373\021\210\007\347\235\354\025m\220'\335R\270C\266\001\350\356ug\242\320\"\244\302Hk`\013\027\3645\277\364\254\314\272\273\257\341\363d\246?\247\250\315*\3655e\231\321\203\341\264#\200\204\021\021\310;\201\035\342\225\276\244\341&\226$Q2'\355\265\326H\2139\360\320\240\206;\356O\007\361\213!i\b\2172\261J\307\265]/}\355{\244\223\275\027N<+\263\003\2661\360R\336\2642\274`9\245N\r,\305o\275\304i\335\224\256\032\b6.\026\312,\230\326\rk\205\323\252q\255X0\016+\030\026\277rJ\330J\347\365\202\255\310\334\374\342<3\333\235\025\343"
+	.ascii	"%\327\246q\200\364\031\027\246\233\017\345\242\251\265\037D8"
+	.ascii	"\357*O=\034\252M\255\265\206d\246?\0317\\\223\270C\016\277A\004"
+	.ascii	"\027\226\344c\301%\201n\277\026\t\023\3645\325\006. \220\202"
+	.ascii	"\022\252\365c\370\307\030\242h\271s\334\257\326V\265p\205\227"
+	.ascii	"\357\310!\255\363xc\233\021\250\371\003\344\262\003\274\231&"
+	.ascii	"^\327>\031\332j\242\355}\335\253p\273^\267\365\002#\202k\314"
+	.ascii	"(%\2128S8w\323\215Y\213G5\256pn\200Q\362\2124\251\350\310\332"
+	.ascii	"F\217\237~o\343\027\334\030\237s\256\265\324\t"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.300.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"}\f"
+	.string	"F\327TB \217\232\016\013b\0011\240\005\324\322\204\f\325\277dF\204\214\216sW\255\2260\202I\254a\210\b+[@\203\2145XS\207\020+D\302\003\204\302\r\303\003d\204\013K){d\026O\262do\271S\nA"
+	.string	"B"
+	.string	"?"
+	.string	"\321\2477\333\205\201\221\3456^\274t\341\313\356NJ\342\333\247\324\270\371"
+	.string	"<\356ss\351\341*\017|%0\002x \231\301\342\322=|\334\340\211\304\230\341\354\256#\211\327\341\216n;\202\355\007\3669\002\273\034B1\3532Y\230\260}\215m\231\342)\333U.\310\001\013\022q\322@\372\314\220\032m\006\033\333A\020\353.\210\030\005\217\366O\034\305v\224\f'\260\373\261\254\330\005\0278\201\364i\360\233\350Sz\201\032\224\363u\252c\027#$\206\016\023\"\244B\252I\034i\331\023\325\317\361 \321\365\341\021t+-RZ@\021\306\006\271\250&\366\345\356\256\365\363\274\312/\217\362\353\301\377\222\203\021%>\274d%\025>\035\t\036\354\243\2220X\225\007\004\253\343\242\220i\034\325\345\021`a\235\t\025FeLi\\\035\324\344qu\260\211\322>\223\306\306\231\307\322&\013Y\246M\032p\317\tQ\221Og\242\324\251\252\366\347#\236\304\017\317\t\027"
+	.ascii	"\357b\310\204\346\343\210\206\0010\034\024\212\361\fA`^<\252"
+	.ascii	"c\334\022]X\375\205%}\230\027\302?\302(\\\006\t\003\200\021\001"
+	.ascii	"*\312\270\313-\3555%\334\224B\355\001"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.301.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\355"
+	.string	"\215\f"
+	.string	"VWUC\020\221\232\016\177\215\001\n\b\004\350(V \224\325\365\365\002(\305\001P\267\"\264\345\366\255o\210\b\371\265\214\210\027\r\262x\243Q]\325\001*#\306_n\252\201\241\321\255\241e\336@\303K\226\354-wJ\001B"
+	.string	"C"
+	.string	"?"
+	.ascii	"\002\244Oo\266\213\001(\313u\274\330"
+	.string	"\320\2051v\227R\020\337>\245\306\315\337\360\270O\316e\206\253$\360u\220\001\300\023\311\316\n\230\356\341c\005\357$\306\214gw\035S<\f\267t\333\fl+\260\377\021!Z\354^\030\315X\230\231b\305\3665\266\245\211\267lw\211 7+\3720\302c\372\354H\215v\202\216\355`\211u\227\003\215\003\217\366I\274\304v\226\t\017\260\373\261@\261\013\"\260\201\351\323\3409\322\347\364\341=\024\224\363u\252cW\303$\216\036\343atB\252JDyY\021\252\237\347K\244\353\303\027\350T\300hy\021\305\030\033\344\242\252\330\227\273\273\326\317\363.\277<\313\257\007\377O\036+\0264<\020BU\003\021\214\3443I\270>!\013.\020\320\203L\373\270F*msa\225\203\017felq\200@,*\004Ta\224\245\205(\016\2163\221K\243F\262L\2434\340\336c\242'\237\316D\251SU\355\020I|\212\037\027"
+	.ascii	"\357b\310\204\346\343\210\206\0010\034\024\212\361\fA`^<\252"
+	.ascii	"c\334\022]X\375\205%}\230\027\302?\302(\\\006\t\003\200\021\001"
+	.ascii	"*\312\270\313-\3555%\334\224B\355\001"
+	.text
+	.section	.gnu.lto_cliPrintCommandBatchWarning.302.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\352"
+	.string	"\025\r"
+	.string	"\306W\\G\360\2226\035\260\314\201\002\363:<\034{\242\n\250:\335\361\310\310'C\245\276q\226\270\227;\020jm\204Zx\216\215y\347\036&\266(%M\316h\260\3217\350\373\350\370\252\002\214\027\206*\212b\264B#\275\311\336)\005E"
+	.string	"B"
+	.string	"K"
+	.string	"\037\200\235\032\264\201\220\304l\230 H\214\031\032Bvw\233*\016\376\232\022\364\177\363\021\225\030\376\"\361y\021\340\241\303\005"
+	.string	"1u\0258\201\"\3477\227\037D\030)3\006\273k\251\022E\334\364\266Wl[\260o\0223\205\375kw\327se\177\374\351m\376\231-hQC\363\232\032\273!\212\020Y\026\275\301\302\366=\366\210\"\t\260)\234\022&\227\366_\034\006x\033\324\005\354\256~\330\330\035O\\\3229\365\370\017v\332\t\233\206\323\351\333<\343\376\332\271\262\247e\202\345a\302\\\230\244\3639-\032)\356"
+	.string	"\221c\032\205\3219gp\254\300\361\221\222C\214\311\313\370\214\r%=ve\256z\351\310 0p:\247\315\241\203\274\312\007Z#X13\264\307P\006^\341@\0228\220\210\013\245h\265\013=\250\016\264\226\n\232P;\255\2624\250\020\"h'\232J\025\245TQU\321jW[4\226.\324uUA\005\023\311\364\215^2\227\322\210\243P\3622{(\244\013\336f\"\215J\233\367e\330P>>ap\371\002\022"
+	.ascii	"\357b\314\304\223\241p\001\206\215\361\262\244-3\001\022\320"
+	.ascii	"Z\302.\306\301Bp\rh\2051\200a0,@\205\026wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_resetCommandBatch.303.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\r\007"
+	.string	"\344\013\265"
+	.string	""
+	.string	""
+	.string	"#\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\317\3655\201\200\205\030\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\307\255\001\227\216\217\266\353\003\004"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\377\002\202\364\274\236\344\326\207\007\005\001\006}\001"
+	.string	"\005\001\212\001\002}{"
+	.string	"\254\001"
+	.string	"y\276\001\275\001"
+	.string	"\006y\001\350\326\367\005w\301\001\277\001"
+	.string	"\203\003\202\360\371\260\333^\244\003\001\200\300\013/root/repo"
+	.string	"\025./src/main/cli/cli.c"
+	.string	"\r"
+	.ascii	"3\001\2138\303\361.\201\035hl(\234\221\024)\256\211t!\344\227"
+	.ascii	"!\300\245\033\263\265]\247\005"
+	.text
+	.section	.gnu.lto_cliBatch.304.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\307\001m\020"
+	.string	"\006\036lE"
+	.string	"s\2341[\264\322\333\b\023\352\303\240=\204|\273q\302\032\276\001\334D\223!k\252\374\376\322M\213\366\277\260#"
+	.string	"\nx\233\335y\335\004\227\277>\"\022 \305\306\004\2265\347\376\360[x\022ro\221[\312\224\002T"
+	.string	"U"
+	.string	"Z"
+	.string	"\333\253\311o\354\353\366\002\366\325%\033\b\202\223kr\020\304\005\004\214!\367^\216\242x\351\232\255\031\235%_\353"
+	.string	"\020G\323\265mu\253u\304q\365Z\342Yf<IM*`Te\234{\357]|\206\030Qsj\235{\257\2478\222\270\267\333\016mO\260/$\rF^-\265G\035\346\305S\315\313\016\027\314\245\242&\233DM\332\262O\313\262,MY\366W~\355\344o\263\351I\247\257\241?\212\240\210X]E\314\275(%\221\333\243\346Xa\373\031\333\223\364"
+	.ascii	"\263\340\323\276\312[\224\276\362\341\003\356e\321\270q/\311"
+	.ascii	"\300\t\002v\347\315\213\326\274\270\2200W\212\232*m\315\270\215"
+	.ascii	"\217\026\243#\345\204\312\353'\331\032\037\021{\ry\335{ov\222"
+	.ascii	"\235\024l\361\341\307\270\f\222\237\302\031@\363\"\310\276N\372"
+	.ascii	" \366ba\3424\313S\332\262\202\237\226\264\300\244f\314\001f\375"
+	.ascii	"g\317\362\027\242\355^\325E\016\233*\366|B\260\013G\034\r^\330"
+	.ascii	"\225p<\241\356\373D\021\f8\004\273pd?!\220\311\347\353$x>O\263"
+	.ascii	"G\0022\361\270\020\250\3738\017\034q$\033\2136|@.\024\211@.C"
+	.ascii	"\236\236\235\262.\360p\301\\'\212\312\264\315\264T\2436\205\n"
+	.ascii	"\225\232\246%0\317r\034\026\016\244`\330T\020F^\003+ \320\202"
+	.ascii	"!1;\223\360\277b\314\310\213\021\364X3-A\0264\215ywc\2064\211"
+	.ascii	"5\002C\262nbm\223\332\035B#f\204u\271\274T:\034\301\340\202G"
+	.ascii	"m<\264\273\314\333`\310B\265\003Z\016\275\320e\030\021PQ\006"
+	.ascii	"\2274\340\343\200\345w\265\334t]!\335\326\n="
+	.text
+	.section	.gnu.lto_prepareSave.305.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\242\001\305\016"
+	.string	"fY^F\360\260(\035\270\355\337!\2005\356\362\337k|\264f\337Z\251\027!\305\245\314\252S>o\027\036w\231\340\260Xl\323\312\345~\317\234\345\345\023\262\211l\"\346d\241\347\301\201po@\330\034\305\267F\b\331[\312\224\002M"
+	.string	"G"
+	.string	"J"
+	.string	"\357\200\246stun"
+	.ascii	"\206\025\325\267\303PQ\241\250f\3412z\324\234\230\301\001J\210"
+	.ascii	"\037T\207\317\003\236h\214\036,\230\n\237\027\031f\376Ae\245"
+	.ascii	"\313\001\232D\001s\316\277\256)\340Iu\003\231sZ?p\345\356\334"
+	.ascii	"\366\312v\207}\026\001-\252\022\rm\230I\327e\177\3030\f\275-"
+	.ascii	"\333jiu\264z\325\337X\032\033\024\205\324A\270\230\023\025\322"
+	.ascii	"\2302\022\205\007\333$\266\307\005\f\220\330\003pb\222A`\366"
+	.ascii	"\241\214\260\231\023\326-\313\275s\270M\223q\325s\rF\364\237"
+	.ascii	"_\202&\205\314iM\237\300bi!wCb\261\007\273\233\212ii\270\251"
+	.ascii	"\221\305u\271\\\367\200\b\b\272\0016\374\273.\333\236\366\r\211"
+	.ascii	"\3050\321\033\373-\017\341\371\034\034\241\244\377.\375\222v"
+	.ascii	"\371\375\353\035)\230\031V\006}\204D@]H\004\324-\b!\020u \322"
+	.ascii	"H\367\361\361\210A\002R\347`4\"u\036\330|\234\333\262h\366z\221"
+	.ascii	"q\177\235\2531\273\360\"\333\273\\n\212m\271\006)\331S\234sN"
+	.ascii	"\316\2728\0051[$!\212[R\261\302\204\306\251\035* \300\202!1\253"
+	.ascii	"\003\b24\225\024\250\026\211\301\340\205#\273\f\261\034\202)"
+	.ascii	"\005|2\243\211N\230\006\3550\213\013k\320\207\271\262\232\350"
+	.ascii	"\306\212on\364\241\027\353\212\355\2208\006C\034\260\364\b\033"
+	.ascii	"\313d\243\303>\262L\250\275J4_\302)\206Ge\003\307C\005\3250\210"
+	.ascii	"\276]\242\f"
+	.text
+	.section	.gnu.lto_tryPrepareSave.306.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\276"
+	.string	"\215\013"
+	.string	"v\226P@ O\234\0160\036#\333+n\032\031\027\200\231\211C\314b\333\003:\211y\224\r"
+	.string	"#\030\247\320\237\323!l!S\354>zR\330\032\220\b 1\270\246'\204\355\210\b\261I\327NP\243M\244L)>"
+	.string	"?"
+	.string	";"
+	.string	"\266\023(\360X{\f!\232\224<PG\310n\274\024\304\265O\232\232\017\240\333>Y\034\256S\005C\210\007I\367\231\002\214\200Z\374{j\350\270\314\312\262\273\316P\267\341\206\267\315\300v\305\376\202,:J$\024$\256h\206\214]\001Sp<\376\266\307\377,\361\243F`\213+\2428H\221d\340\320\007\254L\373\244\217\360\334\353\\\300\356\350\204\307nD\340\002\326\241\343'\324\241\365\001\324\241\003\017]'\203xx\037T7|\215\202\252\240\017\021%\\|r\3040\355\n\026\362!\250\377\376\016\037\"+\022\203\323\315\216[\352\206\375iw\327:\262\357\375\325\343\r\323\327\350\300\340\002Y\206\3010\nY\205\321\\\0328\320`\2251J\346\001vA\310\\4\027\306\311.\312\304\233\b\030\3165a\263\341\\\222\270\327\221\377\335zQRa\002E\376\032e\275\246fP[.(7YY\251-!\313\020"
+	.ascii	"\3571\300\020ZP\007c-\300.\2540TS]9N\234(\272\f.\277<3\273=\221"
+	.ascii	"\277\tV\313S\3154%\036\215A\355\001"
+	.text
+	.section	.gnu.lto_cliSave.307.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"u\n"
+	.string	"V\223G>0\3058\035\336!\350=\377\277\267\027\"\214wIu\373\005\352\347\220F\333\371HE\353\003\n\0038\b54J~\202 \372\277\253g\004\030V}$-\306'\230@\270\323\266\240\247F\344N)5"
+	.string	"7"
+	.string	"3"
+	.string	"+\006v\267S\222\207\317t\206\376W\327\214\244\370\214\013\271f\t0\030\002\005\344)\353\240L\306\257>?H\323\234\231\207\335\365\034I\220[\273m\b\333\f\3669\001/\273\250\004\007\266\245\305\234\330\376\306\366,5\\\n\237\366Q\236\022^\265q\203\335\024\013k\267\\0\002w\315\345;\3335\356\234\355\232C[\300A\307\212\r\005\\\036\0011\030K\235\261]%T\002\234f\314\333T\265/0\346\307\353[^"
+	.string	"Z'\025\355R\234:b?\333\335\265\246\354\227\277v\325\257:}\316\001\201\213\310U\001!\222h\004\372\274L\350\373D\200>/c\317#\032y\035I\364\371:\257T\321y:\006'B\245\316\002\004K\335\246\334g\253)o^\003Z\034j\3124\323\006)\346G\353K\002\022"
+	.string	"\357b\314\304\313\240\341\260\206\245\3022\240\332\004\016\257\256`\030\326#\027\206V\030\032\024\202\313\300\210"
+	.ascii	"\025E\334\345\230M\322\300\324\036"
+	.text
+	.section	.gnu.lto_cliDefaults.308.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`J\002-\025"
+	.string	"fg\220L\260\022R:,\370\034\257-\373\032&\337 \326\321\020t\377P\b\005\353\007\253\274\255Pv\311Oq\371v\251\275Q93\031+\2542{\367\035Q+\033\036"
+	.string	"\224\360@\fZ\317\216\207gM$d$a\203ALj=\020B\b\3312\311y"
+	.string	"r"
+	.string	"\200"
+	.string	"I\273+\215\270\200{\207j\330\270wU\300*\347I^\177R\236<O\240<\311;f!)\275\233\276`\375\374\206\305{\357\313\242\370\356fI\216\266w|"
+	.string	"jz\363\024z\371k\251\276&]\262\202\b\245f\250B\037G\222\253_\017\023\2257.\350\025M\264\324^\333\021\001\325S\225\211\3323\236\004Y"
+	.string	"/|\373\250\275n\023\346\336\313\rT\203\316\347\2319\0043\327\230\233&9\210\276\326\321\013\266\260\327\225\267\035\204S\274\276b\263K\313\214\323\351\003o/|\315\021P\221\212gS\3465mK\304\374\361\336{\331\0161_\3517\277\376\345\227\316vln\333\374\222\035\031\302\250!\026\t+\265\336\340\021#\227HB\031}\351g\376\205\334b\227\227\335\227t\256t\275\301\322hG\021\251x\357\312r\222\031\234\275\212"
+	.string	"\222\340\315|\244\007'\322!QS\037\236\017\365\033:\276\n\206"
+	.string	"#\371\260\362$\207,\253\"\021\236>\302\006\232y\302\314\023\261\307\246\214\342T\001\245\350\302\351\323\260r\2229\003\r\213U\022\221g_4\371\300A\016\3503\235\306\006\225\242\232\323\027a\345\244i\231c\262>\220Ix\300"
+	.string	"*B\325\343\241\213\022+FK\304,o\273#\374Q\322\345q\3123\275iv\336\353;\320\303\351\203Y9I\263\365\201m[X\025\214\313\345\350\304nP\033\227-\347\302\251\315r9\024\207\336\n\260\314\f\314\002\205\031\227\003\230\204\006\030d`\001\330V3q8\263\233\232-\006\005\021\303\265\320\332,\007\245\305dlh2\223e-\263\034\331\2536\213\321^\262\033\356\325r\302\266\017\350\355\225\263\331n\257\326z\017\303c{\314\003\035\363\240\017\344\321\246\177\220\357\347WZ\"\376\021V\212\237\223\375\360(V\360\347\324\277\256\264\326\207\231\255M\211\021* \200\202\231A\363\203\"\354c~\004\026B\343\221F\005x0\320Z\366\322h|\374\2425m\337t\217\230\267\242\267\004\n\367\265\221\237\366\271\245\351\312V\016\335\261(#\026i2\374\306~\262\364\006"
+	.ascii	"x[\004\177b>G&\033LM\254\310\306@\021pVB\215\244\305\2634\222"
+	.ascii	"d\366\366\030-\254("
+	.text
+	.section	.gnu.lto_cliPrintVarDefault.309.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\357\002}\027"
+	.string	"\026m\237G\240\034Q:\214f\220\032\203\207\302\304b\317\247\231\n\243\351\220\303\204\227ub\350\245k\314z\026\331x\335*Y4\353\371\324\004\005\355%\001\267\031\235\213\371`\260\301B\370\357\251-\026\203\357\032\2565B\b\331DJ\231\002\212"
+	.string	"\201"
+	.string	"\214"
+	.ascii	"b\352\362\312P\001\211\252\365t\260\364>#\2375\b\270*\256\267"
+	.ascii	"{\260\374\257\322.\225\313dc\003\324z\364\345J\255'\204+\030"
+	.ascii	"\227\376\334\236p\351\270\002\302\245/\3776\004\210\252\371C"
+	.ascii	"\265+\362I\325Zc\215\264\345R\260\271\374noI\035\317\\\352cA"
+	.ascii	"\260A\024\2268,\036\021\330\263C\242k\361p\334\240\2011a\224"
+	.ascii	"\254\323\362\016\036\021\210 \310\220)\333[\316\301\2731\213"
+	.ascii	"\026j\255g\035\257\307>\334\377&\376\207\370\333'@c\2558\t\337"
+	.ascii	"((X\214Gj\204K\267YH?2FKL8\270\352?Mn\"\377\202\265\326\372>"
+	.ascii	"\372\227i\227g}\373\3276\355]{\356\266H>K\344"
+	.string	"\257\226O\222\374Q\344\213$?\034\371T\344\203\224\337!\237)\177\007\334\340r\033\343\243\372\321f\316\272\253\242S\241h\226$\353\333m\372\367\311\327\351\254\373\374\224\353\233\0013\317\272[\271AsFI\352g\\\272\333;\353\177\023\rW\r\253{\005!Dm\376\347\260Z:\220\275K\352X\221s/F\336\f\001g\204\257n(\2779\0058\354\261?\200\340\325\275\032\226k\363\264\305\036\033\004\223K\272\205\330+b\257\257\bm\260\303\336\\\322\215\253\336M\033\004#b\253\214\240b\202\304\004\244\337\357\305\255\376K\234\340\325u\257\323\362L\231j\002\205k\223ybt<u\023\371\322\b]\335E?5\27548\236\372\016s\3773\032\257\316\3250\\\233\337\346n8Eu\276b\245\004\207Q\240\331j2\0310W\214\232M\246\202\226\001FMf{A\003\260\302\005\323l5\231\fJ\013\222yH\0214\023?\213"
+	.string	"T\233\305Z"
+	.string	"\311\202b\263!\030\261\b=\027rA\033\212\305\020\022\032\212\261\316\272`\355\243\336n\216\251'(\034}\243\013\370/\225\224L\016l\341!\025uk\363\t\330\301\262\272\325<\375\227N\312%XQ\233\247\275jV/\233\\\322\355i\325;L\340\b1Z\2021\331\337.\027\310.\2775FJ\265\346V\207a\314a`\260\364\327\260\201\003. p\202\021\251\254\003\033\346{eC\266G>\3336\033}\356e}\354\030p\261\356\005\354\204^\004\020\217\373\201(\022\266e'[)"
+	.string	"oi\341AL9H4\\\303\233z\360\r\222\314<\200\0170N \030\312\321B\213B\242\271\017`\331\204"
+	.ascii	"b95c\372\234Tk\235\371\364\355NH\314x\257\2059,\240C\217\227"
+	.ascii	"\2237\231l\315D\001"
+	.text
+	.section	.gnu.lto_cliGet.310.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`X\007\275,"
+	.string	"\nO|\021F`ZR:\333J\306\330\200L&<\225@\247\372\373WwjE\230\224Ka\213\331\023\362\272&K\331\276\3736l\201,\334\034\362},2X8\345G\224U\3207Jp\001\264+\255\254b#\372\337\376O\b\331;\311\002\001\362"
+	.ascii	"\t\001\335h;\002d\270\374%\2314\f\232s\363\303\265\334\254\375"
+	.ascii	"Y\217y\256\312\007\022'\025\203\346\234\207\276v\205\337\327"
+	.ascii	" \3656y\274\021\375v\177\354d\355\313|\\@\316]im97%4\203\337"
+	.ascii	"\327n\336\207\375\372{\017\373\265\333n;\003\307\\\264 \215\222"
+	.ascii	"\334\222\227s.\302KZx\333\363\020\207\302 \360\347cW\025\337"
+	.ascii	"\266\357\274\372\225w\247\\\026\317\223u\242\032\001\n\006\357"
+	.ascii	"pTY\252\317T\024\345\235_0\205\n\311\035\252\276\343T\224\303"
+	.ascii	"Q\035Q1\350A\303\234\355Wj\031u\205J\252\214<\270\200\253\252"
+	.ascii	"\310\201R9)? S\232&\016W\025\326}W\301e\222\365q2\306\353\\T"
+	.ascii	"X\230%\362Um \246G\206g\211T\017\240\035\235\b\227\307\253\252"
+	.ascii	"=Xkn\016GUD%rC\245\210pi\274\370l_!M\213\303Ue\344\327\307!\347"
+	.ascii	"\334W\271\254z\003x\367\211\335\035\243\233}\013I?c\324\200I"
+	.ascii	"\316F\fen\006\205\372'_;\205\nV\005\373u\305g\273\220\033^W\026"
+	.ascii	"Y\031\324\335\303N\267c\025^\361DE\340\366\325Z\270\270W\366"
+	.ascii	"\325\036tZ\265\331\201\252b^\3404\030\25300\306tzv\236\027\367"
+	.ascii	"\333\016\346\250\377\244\221\224\356\225J\354W<F)\347\370\342"
+	.ascii	"'\247Pw\257\207\267{i\306\275\362\370G\313\r\314\0164\n\027\273"
+	.ascii	"\233Q\0273\273\217\201\211\336\\\343\256n!\bG{\003\275\371\377"
+	.ascii	"\274\354O\300\336\356\371\332\2338\024"
+	.string	"\002o\007\177\267\201\354\355\337\317\336\276{\233\375\355\325w[eoc\337\355\313\336>Q\213f\306f\213\364\013\277i\346\251\275;\371\271\206\371\372\332\177\366\243\035w\247\365\331Z\270\206#\310\330\314\313\340]]s,O\004\227\253u\013[\307\323:8}\013\3139\013ut\013\277\336o\271\263\205\035t\3214O\243\335\233C\361J\355\200\321\226I\224$\313\234\237.J\366\233p\357\345y-\323\301\222\0372\305\203\257MZ\257+\207\036G\253<\213W\332sM\3020}\230I\247_'\200\032\260\274\025\247/\247\355~\277+`\277\376[E\351\031\260\337u\267\335\217:W9\027\237u\225Y\350k\217\212e\313x\247m\340\n\330\037\356\301}\223WQw\017\312\353\332/\033\323\272<:\243\036\323\2700\271\317\355\3006\246uvp\024\354\301\035:\020N\200\273[*\255\025\255'\022\027\233\301]\361\275<\256\025+"
+	.string	"'g\344\225-\226\037\222\304\203\226\254\315B\027E\362<\342\"\333\035n\227(\326\363\306%tc+f\366\320\207xM\342}\231\251\351\257\331\341s\345\323\b\350\r\b\007\277\352\334\224Dn\331\035<9\0253\233\007\313b'\2639\343\325\353\237\373\203W\334\r\"\304\275\222\305\031\266\216=\342hJ8\200\223\263\361Bw\007\r\302\250\303\211\240\017#Lt`qb\004\261\337A\032\202\236\032\260K\247q\224\003?%\3258bbj\362\220\244$\003\351\306\021\023"
+	.ascii	"\245\032K4\224\230\216N$1!\371\032i\302\022\r\244\242\032KGL"
+	.ascii	"EHNOE\023|\272\311\206\222S\321\215\246&\247\"a\023\352\270k"
+	.ascii	"j\344\t\205\243x6\334\247]\251\366\230\374!U\004i\245\004t\231"
+	.ascii	"Z\rP\323\033#\252\302!\366\r\335\207q\362\216\227\231\334E\036"
+	.ascii	"\310\213\034{ga\355\217\330~\333=\336\230\356\345\321\201\272"
+	.ascii	"{\255\020\027\316\337+\032}B\207\230\331\3043A!\fE\232\226\374"
+	.ascii	"r[\252\325\240\020\337\371_\234T,\371\345\016}\330M\304A\354"
+	.ascii	"\001\210\203}\363-\266S\352\237t\273l\207\264C\330\257@\374\243"
+	.ascii	"\r\326\025\324\335\273\2321\363YZoY@\b\270U<\304B,\325\375\343"
+	.ascii	"`\211X\b#\370\252s^\253 \321\207\030\002\0060u\367\005\231e\341"
+	.ascii	"\002a\253\026K\r\205\013\204\244\325b\273\200\200\215\250A,\346"
+	.ascii	"\024B\f\321\210\210\214$i\322\001p\002\221\241+\363\021pADF\233"
+	.ascii	"Ba9\013\312W&\236\356\013o\033Q\034\036\033\013#@p\273B-\263"
+	.ascii	"wA\2412\2523\317\\M*k\006\032\0227R\373\355\346\353\312\370H"
+	.ascii	"\336\322\276\373Q\302Gj2\035\203\354\250`\303#Vf\372|S\013?\202"
+	.ascii	"\024\005\251\201\\\313\211i,\024\212Hem\366\220\257\332|\351"
+	.ascii	"S\225\"\345\021\t\030\307:UAq\002\264\016\260)\250\325P=L\371"
+	.ascii	"\336(\177$\206F\240\210p\fpN\333|\211\"4O\210\216\017\\)\007"
+	.ascii	"D\"\331l0\265\351\321\353\216\271\036M\317\370\"=)%\365\316\024"
+	.ascii	"\231\301\255\272\376\r#\243\326\2568B\377M\f\226Z\037H&\266\317"
+	.ascii	"^M\206\354?Zn\262\332t\312\254)T\326\300\020\226\235-\"M\203"
+	.ascii	"\331\211{\324C3\007h;\036\004:C\b\024:\245a\240\226\237=\020"
+	.ascii	"\266S\004\033^\0352O\232\306\350\326:0\001\363\326=\305\263\001"
+	.ascii	"\375_T\037\321;\311e '\245\2376\030!\27653\321C\204\301V\233"
+	.ascii	"(\226\277\tyT"
+	.text
+	.section	.gnu.lto_getWordLength.311.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\026\001E\r"
+	.string	"\346\030ZC \217\223\0163\217\345\311\262+\300`\004\232kS=\221\306\371U\177\302\265A\234"
+	.string	"\220\306/\375\355\254Y\264\037K|\240\262i\036Zc!\004\300\f\r\300\207\022O\204D\232\341BH4K\b\331[\312\224\002G"
+	.string	"D"
+	.string	"F"
+	.string	"\244P\213\001\337fR\342\305n\207\251\006\303\324\036\241\246\346kP\036\252\304\205\036\241E\332T"
+	.string	"p$\370\221\212y\371\351i\342F\t=\234\\\177:\003\224\347R\342N\236V\202\335u\226\270\013wu\333\034\333\006\354g\001+\277\365\356\217\020\246U\323\371\356\276\006A\212\026\f\367Xv\267\017\306\242\210/\035l\203\354\f\273c\321\221i?\304E\200\276B\362"
+	.string	"\273(-&v\273\016\023\270\036\335}\243z\274\256Q=\0268"
+	.string	"\262& \206\031\025\252\311\2669>R\245~\305\b\025\0262e\237D\205\221\213\203v\222\3521\325\332<\027S\006\021\334\335\205\326\256QA\315\250\205\362`J>\214\362S\026\030\022\247\232bw\241\374\330\220\212\261\242\330\031\247\257\007\016<\013BD@*O\347\001GA\210\b\310\345\215G\007\302\006\363t\032D\3006\331\004\314c\303\037\t\234\f\243\360\371dXF\267\207\020\352/\345\020\351\310\252\227\336$\206(?[zU-\0011\312/j\212\177\372\267\023.T4\243\001\031"
+	.ascii	"\3571\274\020\rN\b\3154G\364\370\332\365\376\207jK\313\002\220"
+	.ascii	"\020Qfa6\nD\264\334a\323\352`\214D\237\205\300\b\030\007\206"
+	.ascii	"\005\204\016T\270\270\245O\3252P/\233\204\371\004"
+	.text
+	.section	.gnu.lto_cliGetSettingIndex.312.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\335\b"
+	.string	"\226\321>8@\305(\035\265\026\243\214\210\265 8Y\2475\004)\373CP\374<u\260\330jX\262P\263\332vf7\203\337\351\030\036\370F\031|\250\204x\330\3173\253|B\310\2262\245/"
+	.string	"-"
+	.string	"-"
+	.string	"\250N\023\323P\205\254\354F\030p\214\366,?\240=\323\214\237\236'\377 g`\301LV\255\356\271-\354\256s\325\252\270\365\266\013lC\333*\001\2669\373b\373\245\215\220\300\375\025a\335\275@\321d\332\367\370\007\367(q\201]\227\b\311n<0\201\345\231\243\305\266\317\361\016\316'\203T\231\224vN\275^\025"
+	.string	"\2251;v\251\030\366\337\356\256\325e;\255=\376\357\257?_\372\233B\n\205\305a#\273\254\030\200=\311J6\002\016\246\006\221\007\244yB\034\321sg\363\001u\240\350\303\t\301\016\251\0047\030\217\036<$h\032\215H\360\022\367\3264\203\322\toy}j\227 \362+M\003\013"
+	.ascii	"\357b\310\f\rF\210\b\267\234kv\217\t\002\214\020\250pp\327H\265"
+	.ascii	"b\022&\031"
+	.text
+	.section	.gnu.lto_cliSet.313.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\351!\r\236"
+	.ascii	"\032\007i:O \206Y:\303\001\306\2628\030 \031\334\221\375\304"
+	.ascii	"\021\223\034X\266\254\354\tT\t\007\303\361\253q\035\352@\007"
+	.ascii	"\345\001\362qi\303\336\320 \345M\332\017\017[\312\334^\261?\245"
+	.ascii	"\353)\20022\363\240\314v\330\213r\211(\032\b\013\354!B\244L2"
+	.ascii	"\231\0033\003\237\003D\274F%o\021\210\227x\336\036\342\345$\357"
+	.ascii	"\277\326\317;\271\275\271*[\363\305\255b\325?\253\264\330\002"
+	.ascii	"\333\373\374~\376?\377\341O\375\371\374z~\302\037\206\177\360"
+	.ascii	"\357\373\377~<\377\235?\357\337\373\345\374t\376:?\234\177\315"
+	.ascii	"\317\346w\341O\363\233\371\311\374t_\332\275\237\377\371\341"
+	.ascii	"\251\257.\222\fo\312\201\220\026\332\232Ts\222\375M\351\\\035"
+	.ascii	"\327-@td\200[\344\\\021\272\210\232I\373P\021BE\315\372\334\n"
+	.ascii	"\263\034\013w\210\331S\345$\273\022C\2175:2'y\0269h\245FG\366"
+	.ascii	"5\275\340~\272\310\301\017^l}\255Z'\264\210.)\254\342w\300\007"
+	.ascii	".\022\317\225\320*]\203\316\350\240vQ\376D\3405\fm\035jB\007"
+	.ascii	"\2053%\301\f\023\025Q%k\334\n_\330\363-\362\316\021\027Q\260"
+	.ascii	"\270w\351\335\316\"\367\366\016\3053\316\355\313\272\256\t8\346"
+	.ascii	"\205@\\\313\326\254<*\242\317\3028!s^\347x\213\204\363\265e]"
+	.ascii	"\327':{w\314\032;\322A\237[\326u\f\310\361E9{G\\\313\254ZdM\321"
+	.ascii	"/8c\036\304\201sd\311\025\267B\203\354\252ex\330\335\315.r\207"
+	.ascii	"\374n?V"
+	.string	"\025D\262y\013o\263H\027\202|u\256H\322\252v\0028\276H\\\313\342V&\035\006\251k6\305\212\346\327\204\260\314\212[\305\200\330\250R\267\302\b\206\354\"\321\354\325,2M\021\350au\314\213\227\331\237Y\344\213f\216\274U\341\0348\276\210\274\334\353\026\271\302\347\232\247C\362\225\311\372$\321\352\227\005\216/.\211W\032\311\210 \264\352\255\037\013\254\202\231\256k\334\323\213\253b\227\343D\300\203:\357\336\355o\315\303a=\271\256'\224Y\263\256qQ\333t|q\343^d|\361x\245\361\305m\356\n\"u\255Y+\252Z\274\346\n\327u\235\352\265\005\332\245}\365\304\270\257\023\261y\026+T \220\002\305\211)\251(\250'\023%\016 1\302\251I\204\001!\226 >0yXRJB:2*\"R\016%\205\202:p\330\200\324\220\341\bd,\022\233\233{\r\320\254\263X\001\364\"\331\024\2652U\201"
+	.string	"\236\247"
+	.ascii	"l\363\307(NL\375\341\261\324_\333X\035\216\352\243\303P}s\370"
+	.ascii	"I\216\211k\311y\211\005\034\2407\006\247\032\207I\350\265\215"
+	.ascii	"\301\361\210@\026\330I\215\211\2327\241\210\022\347\006F\004"
+	.ascii	"\233\001f!\214dJ\242KeSTL\232\346 \320\2341SfL\361C\340\207\\"
+	.ascii	"D\225\300Qs\2466\27516\366@l2uo\2567\346Gt\361\366\305\312\371"
+	.ascii	"\334xI\215\211\230+\205yR\0300\214\024\206\b\3256\366\205\217"
+	.ascii	"\370>\324\024\005\023s#-/\312b"
+	.string	"G\013\023)\201^La\002\370\241\344\225\2661+,\2447\206\002q\211W\205\203BLa\362\367\016\200q\314\230\303\231\024\336`\367\206\305\270a\312X\024\343\206;\\\236l\210)c\200E$\020\0335\316\315p\n\023\301k\270\336\030\2246O8\003Q\351$\315\235\353\215\005\022\241\356py\362\272\207h\033s\302G\"P\227\230\226\353\215\t\022[\364\231\266\3603N\006\2126\271\361gNl\253\342m\361\235\2016y\261\213\211D\023fsF\270\336X\031\261(\217\n\036$\224\213\233hb\312fO\007\350\026\261HL\313\363ug0h\0273\320\213u]\227\237P&\337\004\276K\274`\367R\273L\033\004}\246dp\362B-4{+\213\200\217w\3034d\372\341?\251\372n\376%gz\266\030N9\350c\017\211\035\016\302\340\003\364.\263\332\314\342?u4\243\251zA\361\034}\200\006\262;|\343\354\342"
+	.ascii	"\347\350\256\246\027\377\311A\277\315\277vf85\234*p\305\315\231"
+	.ascii	"\f[\317\321L\271?\006\270\201\357\235Q\003\260\246\022\3763G"
+	.ascii	"\277\356J4U'\322\256\316Z6\204~m\307N\333\240'\306\237u\261O"
+	.ascii	"q\301d4P\307\250cl '\374\244)F<\226mB\233dd\306\027\215\335d"
+	.ascii	"\245L\213\253'\256\235v\304(\243\177\326?s\003\260\371\341\343"
+	.ascii	"4[\301\273\315&M']\035A\272\325Y\233\202\213}(\275A\3576\245"
+	.ascii	"4\317\226\316\316Zb\027\373^T\316:\216&6\020\333\037;\2576[\\"
+	.ascii	"\335)\356>\013<B\223\312Q_\332\321y4kM+\f\240um\023\005\2066"
+	.ascii	"\263H\261\030k\262E\211u?L\325\016\030\270e%EF\364\255+\327\237"
+	.ascii	"\273\313\214\201\303\232l*\252\254+W\213\027\227\237\f\326\214"
+	.ascii	"\022\217\345\305mry6S0\276x(}5\257`\320O\365Y\202\026W\273\353"
+	.ascii	"\336tA\215M\3742\374\325\004sTe]\235\1776\305\034\235\367B\242"
+	.ascii	"\371\326\034\303\177\356\321P\r\245-\252\364\231\026;m"
+	.string	"M<\207\221\373\324e.f\232\034G,{\021\214/r\027\325\200=\321\342*\203\200K\301\004b\247\355\217\304\210\243\177E\316\217\213\373|\343\266\276sX AIw\332\036\211\021G\267\327\341\240\234\037\027\367\3317\216\346\027\274\250Z\\]\020\254A\357\306\220\301\177\276_\367K9\343\263\032N\271:k7n\353\177F\2613\205;m\367\177F\2613e\373\204\335\347}\257f\304{\264\233\371\376\354i\276\207r8\337\223\275\316\367b\277\363\375\222\357}\377|\337\367I\376\367\375\327\007\277w\036\206\357\267N\370\375z=_\254\363\371\"\371\337\367\310\361|\215\274\317\027\004#\336 \367\363\375\361?\337\017~\370\365\340\324\257\225\021\257\017#\336\036I\336\016\316\346[\225\344\345q2_\035D\274T'\363=\300]\370rp\270\177\203\223\371\3468\335\027\307\343~\r\224\2747\336\367\265\361\277o\215\337\371R\360\274/"
+	.string	"\276\367\245\3615\337\t\276\346;\343k\276\022\334\314W\306y#P\362\306H\342\205@\311\013\243\210\367E\022\357\003I^\007\212x\033"
+	.ascii	"\342u\001\304\313\200\222w\201$^\005\206x[$\361&`\304\313\"\311"
+	.ascii	"\273B\311\253\202y\021(\342M\221\344E\221\344=\221\344\235J\342"
+	.ascii	"\225\362\300\033\245\344\205J\362>%yM$\361\226 \342=@\311K\""
+	.ascii	"\311;\"\311\353\224\304\333\264\304+B\311k\200\022o\210$\336"
+	.ascii	"\245\021/\b%\357\007%^\246$^\017E\274KF\274JE\274IJ^\244\363"
+	.ascii	"\036!\361\032%y\213\222\274DH\274\312#\336\241\"\336\244\222"
+	.ascii	"WH\311\033T\304\333!\311\313\301\210\027\251\344\325@\304\233"
+	.ascii	"A\311{,\342\005\n\375\205U\310<\2632\240E\030\320\005\bS#!D/"
+	.ascii	"\373[M\f\f\321Iz\226\375<g\30105\350\236?\360\234%\214\212\237"
+	.ascii	"%\210\336\346\302\312\023\344C\337\007t\236y>4\210&\006\022\200"
+	.ascii	"\217|h\003\204Q!dj\017}g\023\365\330h\246V\232\363\242\006\341"
+	.ascii	"**\3144\376\323C\177z.\f\243\202'\345\030\276\201\212\033i\026"
+	.ascii	"\037n\360\013\334\002\321i\333\3532\231/\207\313\324>\363\303"
+	.ascii	"dK\370,\027\236huB\017\267\350\331%\216`D\007\005\234\366x\341"
+	.ascii	"d\352r\334\221\335\243\306\221\356"
+	.string	"\251\036\2245&\204}X\343<W\017Xa\030\230(\270\2502e\346\031\205\312\350\334\006\005\215\364\003_\301\336\027\237!\234\326\027'RC\246N[\016{Zn\260\013\317C\247\355\003O\224\276\344gt\320/PN\301\325^\002\035\224\r"
+	.ascii	"J\022\034\365T\361x"
+	.string	"\331\031q\337g4\030\005\275\324\034\366\310\325Q\352\245~\026\306s\245$T6'\005\374Sj\017\266\276\346\200\201\333\272>6|\226:m\371\210\373\316I\314\367\363]\331\247\327\304\fi\037\202\361j\r\266\304\243\031DS\275&\324\244?\004\343\022\221f\264\004\334\344\024\364\227t\220\235(X\035+%Q\320I`|\236y:\364\241`%\351\351H\275A\213\017\326\321GQ&\027\376\023\251\215R\016\225\347\315\r\251\323\366\315,\306\243\336\240E\356o\317\202f\026\246\027\343\213G}\260'E\255l\243\276\263\313\361+\307H\324E}g\033\005M\324F5)\260\224\351\2458T6g\207\211\207\361\230`\220\224\312\346\276\320\341:L1\3147\346\030\246\n\306\027\225}\276\027\333\312\346\354\230\275\301\305A\321\f\217:mu\220@W\364g\353 A\215\350\3514\032l\215\206\372\317&\316\311\261\034\346\034\213*u\274"
+	.ascii	"\246\031\251\2768\314<\242R\331\334\0268o\206zi\353\313M\221"
+	.ascii	"\230\373\350\3339\021N\331\334\232\234\037\247\3602zdRC\"\345"
+	.ascii	"\343(\200\314\220\234u\312\003S2\\]\f8\271\354\352\254d\337N"
+	.ascii	"\364\253\352E]@03I\241\3460rxr.\324S~\274\002\0310!\261\016\242"
+	.ascii	"s:\017\352\240\275\257:0e8\370\322\317\271\364u\266\315\263J"
+	.ascii	"\r\323.*l\212\023)\001X\207\013\314;\261>\336\211\312\350A\213"
+	.ascii	"I\270H\b\302\200O\326Uq\230r\320T\r\245+"
+	.string	"x\305\260\003Yw\350\353\311\341qq\037:l\006\211T\037\023\217\3130\3632\274\251\342y\261\216\256C#\337T\361\230\275\301q\350\223u\353\361\242\336`\r\337;\343\236\371\202Q\007\037\323\217\377\344\320\217s\"\302*\241\324\311,`\351\343\320iK<\2231H]uO\316\017(H\333A\034N\013\247Y|\b\364f\313\341\006\270\3451_\245\270\255 \322\n\177\314\242\200Y\016\023\027\246\200e/\313c\225\025E\222\251\333\227\025\215\313r\227\025<\256k\326\315\366LhY\325\301-\034\335]\301\337\214\237k\211\027}\020\271\240y1u/=\223\021\331>z\331\253l\213\253\200\254\345\312-K\223\rYW\255b\346\206\002c)b|\021\331\305\272\352\027\2637+E\232<\340*M6\251\265\252n:\317\022\250ZC\037\211Q\337\214\350\022C\036$\r\376\035\2471\007\241\2300\034\235o\201\304\213\033\0202\365"
+	.string	"V\307H\207\364\344\301\321\320iK\325\031Z\210\034\035.\016+c"
+	.string	"5`d\320a\227A\210,\2078!W\003\f\002`C\306\322\202\n$X\222\210\"\261\264\240\202\345\005\026\310\300 \006\f\013`L\020c\311\303)\n\305R\006\004K\f.\030\200\215\345\214\0334,\300\340\202\023\033\305+\303\006\214\033\313\bh\324\200\221\301\r\032\034v\331\300r\210\223q\227\013\f\351\001\304\212\b\221\252!K\"@\252\204\b)\022CY\365C\007\bE2P\021\241\342ADB%D\b\025R\b\221"
+	.ascii	"\374\2402b\314 \b\001U<\200\320 \242\201G\225\217\035D\250\256"
+	.ascii	"\200\200X]5\002\250\256\272\350\203H\017 U5\252~\350\240\262"
+	.ascii	"\022Bed\210GU\017 T>bT\025\371Aed\303\017*#mu U?Z\b\021\020B"
+	.ascii	"\250*V\001\261\372QuEu\203\307\325\016\240\335!e\365c\307\024"
+	.ascii	"\020+\252\253\251\035B\206LI\025m\020\020\252\204L\021\t\022"
+	.ascii	"D\310\0242N\353}\302\276\320\352\2555\026LX\203\306\242\203\205"
+	.ascii	"\347$\354\212\013Hf\230\364\255\330\243\242\323\270j\017\353"
+	.ascii	"\005/}\006\213\017\312\357\350d\264\260+]\244][\276KW\334\020"
+	.ascii	"\"\300O\257b\n\273\022\225Nq\004\375\273\246\303\002\304\n<:"
+	.ascii	"y\204\226kf)\n\271\221Q!\202\342\226\2626nfop\310\247\331V\n"
+	.ascii	"\342\322\214f'\346\273\024'\231\034/\273\021\314\367%z\230\321"
+	.ascii	"\023L\320\255\302\034\025\025\b\367\214l\324\251[\341\032\267"
+	.ascii	"\226"
+	.string	"x\233\277\310\342\303 -y\207(b\300a\r\252\300\332\213\321H*\317\025\266\370\352\250\305\303>bNt\232\223;h\253\206@\017\026\237!h\020\264\006ak\"\246\\S0\232\333\344\376:h^\033\f\226\341\021\313\317\321y)\211\027a\024\317:\372\025\335\301\027\217\034\023\244^|\320/\3721D\317\360\236\305\016\364\323\037\350]\254*3k\371@/\177\264\003\375.\321\2637^T\255\250\006\232\377\344\360~t\003\335'P\213L\004\t\241L<]i\252\367&X\002\3527\032\314E\277M\356\017\204f\240]t\037z\225m\235\003\243\007\315@\363\227\350Y\203\320\307\0235\033|Z\240\215L\346\321\n\264U\027s\201>\0274gg) \"I\330\032^P\265Z\255\256h\036m\002\310\004@'%\230I\214-\332\350\246\314\316\213\234_\2635\307\230I\260\214/\266h%5`O\022\350\303\200\306\325Y|"
+	.ascii	"\227\037M\2029evb\344\374\270\370\234E\037\r\254\261\\5\200\002"
+	.ascii	"\223\214\305\025f\036\222]\027\263(V\252\260\350\357"
+	.string	")\263\353b\366\246\244\325\322N\330Be\312\217=`\304\032\355*\201>h\2371\311T\264\0313\257(Tf\207\245\245t\224\017:h/\211\036C8\255\366\240\211V+\032G\330\332\035\f\326a\325\257\236\303\204\255\261y\023C\242F#\263VP@\036\341\336\tGt\332\0369\311XH\322Ft\320\005x\3311=\335F\203}p\222\245\361\262k\372Ws\241\036\224%L:\272\206\215V\321\254g\244Ut\007\271\257@9\276:j\013aNP\267\321O\322\377\022\215r\004\372_\335/\024a\250#M\230N\370O\004z\252\007&\316p\332\265\244)Eo\227\300\f;\262\003E\247hb \257p\226\373\021\024~N\264T#!N\365\211)\251~!\237*\f\"\242z\033\312\344bB\251\202\352(\2506@\230Z\234\247.\321X\375\274\211~2Q\242\277G\355\356\317\030\003\016\350m%XT\246\224\036$\372"
+	.string	"\022\315A\230\232\227\021\335\324_\233x\310N=\302\251\225\356\232\3721\234\373\204\251q1T\223\022BDo\202\211\250\342\360 N\302$cL\321\214\310H\222dX\003\242\n\020\006Ci\036\307\324z\022"
+	.string	"E=\007\204\312\021\022\021\222$\331\237\003\021#\306\rX+h\034\0016\210\344\220\035[$V\rs\253\212:\363\254\372\205\313\365T5:\302"
+	.ascii	"-;\215\361d\016\340\201~\211X\350}\312\f\302\255\301M\016\f\361"
+	.ascii	"~3n\226\363\002#L+\001\245\3676\275?G\210J\026\202\306\225\250"
+	.ascii	"r\003\217\266(\312`H\205=_\037-\243\036.\002:\347\315R\265\260"
+	.ascii	"/\253\374\313\021\262(\246S\274\245\030z}\260\356\020G1\035/"
+	.ascii	"$0\304\227w\345\007J\361{!\004\004I\311\021\0377\b4\233\227_"
+	.ascii	"B\206\023W\342\201\036w\302D\001\207C\2555\005<5i\366\364\313"
+	.ascii	"E\212\204\n\303\234r\356\372N\260\210\273\303\374$\363r(!\236"
+	.ascii	"\004\356=\361\315-\024.\335\027I\231@A\276N"
+	.ascii	"CuR.\022\231Q-8\353\264\034\305\257\273?D\374r8\302\036X\324"
+	.ascii	"\230j\230\275u\023~[p\001\243\244\324%\331&\222\304\346/\203"
+	.ascii	"6\2517\373\202*^\232\036?\325d\261`%\177\272\352\232\240\265"
+	.ascii	"\252\327\262*\216\230?\002Z-\305*x\276\213-J\n\366\372p6\313"
+	.ascii	"Z\025\314\207\301\233\227"
+	.string	" \022D\324]\213\347\016b\223\002j-4#\214\226$9\255j\3168\004Z\020\036\217H\341K\256\b =/7\376\210\023\243\004\f\"Y\310\360\367\013\215B\022\242h\026a\232\340&\324xq\375\036\271\334M\234^2\307\355T5sQ's\216_\227\373\261&\227\344uB\342\3725\225J\375Z\004\320\322\224\347m\302\234\236\333\237\321}D\355h\252\326\177\021\3218\263\230\315gv\310\036%\223\346\261?\215\306>\232\226u6\231\242>\226\324\243!\361\375\317\371<\236\007\233\200\033x\233\224v\323\340ZT\202\035b\261\365\315u\265\2476\013\315\326;\306\254\367U\230\242?N7\004\273\016\037\303\035\b!\005$\"\333\210\016p\0166\tF\301\343\354K(e\022\223\230\325+\211\207\260\251\265\001\351*(%\002{\300\361\244w\370P\245\177E\205@\245\335+\221\003\201\337}\337\004M\345\354\003\2277q\276q"
+	.ascii	":\302\325\331\2653-)\200\351\356\271c\024\036\365\362cA\257\302"
+	.ascii	"\234\250\034\343\006\036\334\332\327\322\235\376 \"\356\325\322"
+	.ascii	"\020P\213zP\024\360"
+	.string	")\232[\364\245Q\212\242Rb\265;\210\270\270y\245y\033x\273\306\372\221`%\024&a\"W\373\243\344}\324m\02197K+\tg\203.\223b\214\340\232Vk\032\227\341\035C\230\343\300\303\304E\324\022i\262\2551\361\030lmQc\302\1771\207Cr\222\374\265W\315}\354\037I%\344\211\246Z\030\226J\2044\025\344$\036Jg\2464a\001\364\314F\206\315v\250<\200\322\321\275\346\341[TWc\001\212M \3541<_\213\334\201\263H\004J\250T\242t\017Z\342\\\242\"\033\236\273\264L\220*y\235\342\365\236~\327\013\325\004\334\024{L\b\267\367\302\266\002\212\2709\323i\216\314\204\017\321;\020\337G\2375\310\313\237-\243;\266\343#\225)q\262\231[\264\272\242\310\240\217\376\364\317a\302\250\344\177\033\306\346\270\270C\215:\241\370LQ\tf\201(\240f\236W\215\300\320E}\005\343~\205\273"
+	.ascii	"\202\"S\207\030\331\030\032\004N\226\316\323\352U\362\340J\376"
+	.ascii	"Mv\207[\222\036X\211\364d\202X\200\306\376v\344\204\366[\264"
+	.ascii	"\261\"\252\034\301\001a\034\220\210\200\202\266p>\035\245\003"
+	.ascii	"\034\373P\314V\373\200t\243\216u\236\237x|\313\201\362\005"
+	.string	"4\177;bq\2504\271j.RCs\n\1778S\\\2355\033\200\261\002m\374.@\237\260z\373\030\207\312\022\221\013*{\327\354\313v\331T\320L\372\177]\"\266a\342\352\265\264F\031\2238\005\242PcG\005\216E\355}\316dy\025\327\031\025\253\020\357i\345\306b\256\376\330\336\003\365\354\202\367\225m\013\326\003J\023\221T2\020\331\361\261\006x\371\221.2\2641el\3431\206\244b\b\234\035\001gT\350\275&\314\206i1u\325\373\251\201\262\270\004\272v\360Ze>\236\022u\273\231\025\314\2070P\004i\207\030]\300?$\320\022J\"\013`Cbjcqpx\347\275\232\025\037\200\330\216\203*p\256Bl\230 V\022\343\334o9\177\374K\027\202:\2562\235\306R\036\370\235\264\355;QM[\220\203Xq\203\344y\266^\316\344!W\327i8\254\004\021H\253#7r\357\340\362\025L\006\337N"
+	.ascii	"\t<du\3570\037\262\"\030\227\220=\013(/G\305\345\266\237\347"
+	.ascii	"\207\r\205\021t\374;\224C\302\366W\217*Cp\255\215\034\205+\242"
+	.ascii	"8\220\372)\366\225\320\242'\022\305\030B2N\236\332\360\312\260"
+	.ascii	"XR\375\214^\247\221\224\2334\214\243\326\006"
+	.text
+	.section	.gnu.lto_getMcuTypeById.314.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\265\013"
+	.string	"\266\325OD"
+	.string	"\217*\035\353kd\250j\032\354i\270\277\315MV\326V\233\2066\362\305n)e\302\177\240\340\312\206\020\336\261l\366\257\226\255?\201\304U\032\207\020Pk\334\021j6\250{N\220\25551F\020\331{\313\224\0029"
+	.string	"="
+	.string	"<"
+	.string	".\025\273!\347\360\027\355s{\207\366\031#\274\273\214\332\371\245K\313\346\004\206\t\">\220\301\243\006x\222\230\335}\353\232\002=U\313fw\255\037\270\340\236\267Mb\233\263?\022\341\257V\177z\304PxP]B\212]\0053\026kb\302,\330&\331\031\266U\355w8\213\364p\344\213\335\007$^\273!\210?\266O\214\264\355o8\007\222\273\220}\255\034h\r*$\b\246\350I\004\017\321m\273+\342\203\270\313\200O\341\323\007D\372\357\323\027\305\r\357+\241\001f\322\231\356n)\266\370H\323\370\326\345\005U\214\365Av\322\025vX\322\b\301\276\334\270\262|\346\240\230pJ8'\233\212G\335\321x"
+	.string	"t8\001\236\224"
+	.string	"\\\007\024\3424\027\177\006\254\200\270\002\237\017\210s\270\227\033WV\365G\020\300\360>Y\206]\324\277\320\206\312d>\337:G\224\3611\025\275\t\024"
+	.string	"\3561\322\026\220K\033\204\213"
+	.ascii	"\323X\031\302\300A\230\363\030C\240+\351\202TX\315\205\334h\f"
+	.ascii	"\007\252=\232\214=hW\224\022\220\252\322:\343lW)\003"
+	.text
+	.section	.gnu.lto_cliStatus.315.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`[\024\235k"
+	.string	":\274\300)L \324\322\032\003\026\336\3712\212\316\007\256\001\217P\236\002\007\265I\367\303\243\017}c\205\321Y\201a\357\0205\273V\322\324H\257\344h.M\346\r\274j\307\353\022^\225\302,\372\3364\235\004\\\300g=\024\003\323\353PK\312&SJ)\205\002U\002\227\002\300v&\3729\017\261\316B\2543\313:\007\t9\003\265\363\017\353\374\023r\366a\235I\0049\257@\316\276\237\263\372s\356\265s\372\343\374?g\3779wo\311"
+	.string	"\263e\315\312\333\221\034\036N\333[$O\317\033\355\305\235u]\367\232\356hw\232\3563\335r\335X\272\337\272\273t\207\351\206\353\216\353\037\346vS\367\343Kt\355\216\227\032n6\335&z\305&y\013\333b\367\276m(\254A\372\373\\\362\022\275\360\026\306\305\356\252\007\3569\376\2459\266P5\273\265;>\320\360\357L\261\335j{\277d\250\301\255Yy\3376\036]\206\233\007\376\3115\t\241i\321\035k\367\276\263\264\226\366\322bzL\223\341\337\f\032\311\216\033!}\305^\345\020+\240ig>\200;\202\305\200\252mq`\375\322`\222\035&\210\320\033}[\005f\230\036\005\326\356\265\335\211\006\252[\232K\262\273\224 \244\\\3626\013\3140<\273\367\365J"
+	.string	"\316\247\201\352\033\313\t\rY\362\016=\337\306\304\354\336\367\225\352\035\332-\331X\264\322w\313;\304H\023\364\013\334\332\235\367ms\352\036\013\260v\257M\275\355\2049\302v\346^k\266d_A\366\320\373:\361\002\367\276mO\274b\355\036\267u\221\332\275\265\201j\3678\311\034\304\277po\022\365\310\225\256,w\336\367\205z\031\230\251\347\303\276N\333\232\3274\331'\230L,)%!\035\031\025\225"
+	.string	"\022\r\t\261A@??\037\022\253O\355\245\357I\356\024\nFL\363K\331'R\037W\021\263\246\363\272\222F\341\261\213k2k\316\024\003\030[\233\020B\277\234Y\273c\002\306\326Kj\255\244\206\203'\2455R\332\246Y\361#&`gmtf\346ET\272\004\0252S\034\350C"
+	.string	"M\227X\001U\203[\273\213\001\314\205&\212\322CQ\240\270P\372\202l\216\205.j\323\004\210n\363\304Y%\035\324t^J\032\315\213\314\201\346\222\370O\233(\215\346\365\202\377R\032Q\320\240=\327)\350\274\220\244>r`\3044\232N\201\346%\305}R0\001s\241I\244+\235\327X\032\345\316\257\245\2571\200\211\265/\254U\237\257\026\272\227\276\260\033sD\320\0273-*b\326\374}qy\032\364\325\225\266\357\373\376\276\266\374\233\207\306"
+	.ascii	"\232\026]\273c\002&\326\356C\340}_\366\346\027X3\212f\366)\346"
+	.ascii	"\266\303,dD\256B\023\360\275|\243\2453\314\322}\255\017}\233"
+	.ascii	"q/w\210#\267\316\312t\026\270^\311\335M*\001?\364\276&N978od"
+	.ascii	"K\317S\315\370\3235\202\311\265\2632\375\313\305\323,\207\350"
+	.ascii	"\326+Y\007\346\2241\275/\343\021\324\250\257@l.Og)b\226B\372"
+	.ascii	"e\354\324Bot\233\263\345xX\330\354\013}w\211\021\360A\317~\323"
+	.ascii	"a\356Yz\036\003}\220{\347)\\\255\357\273U\203\235\351]n\036\027"
+	.ascii	"\317\315s\363\324\356\001}\363\320)\021bsE\220\261]\371&\331"
+	.ascii	"\334\327\363\001\336e|+\271d\237p\255L\177\273\222Dj\210n\371"
+	.ascii	"\236\304\377|\227qe\322Y\244\302\312l\270d\221\256W23\373\350"
+	.ascii	"=\310(n=\215\227\3742\222<rD\355\336\317\273\2348\237\377}\207"
+	.ascii	"5\236\344\330\372\276o\r\356;}\227D\302=\245{\234L\222T\222T"
+	.ascii	"\242v"
+	.string	"\317\347[\b(W\326'\361O]{\240\232$\313\274\233\353\373 Y\"\204\222\224\342\335\364\375\217\031Y\357i\206$\332{\265N\222J\362le\266\024\250\372-\213\032\2227x7{\377c\006\026U\341\314I\265$[\023\035\233\266;\273\326\375\323\3572M'\0016\316\3732\273\211cevX\213\005\032\360nr\313|%/\371?s\004\022x7\323o\267^\311H\316lA\016\357\346\177\273|%\337\330j\353\242\332\357\337L\034\226\355C\303)rO\341\ftx7u\250\335\353\367\021\343\201\00626\261!\236\307\334\266\364/c\356\250'x\354\370\2350\267\\s/Y\347~\335\256kFj\261\316X\375\326\374\243\337\232E`\235}\364\231\346\020zMs\007\035m\346\240\3234o\320p\315:Xg\003X\347\033\215\245\331F\2775\027\320g\232\245Z\256\231\200\216k\216\352\270\346\001\332\271\306\317\231\006\353,"
+	.string	"\353\034"
+	.string	"\353<\203u\226\021\344\034\203u\206\022r\206\321\316O\254\2630\310\331\211u~\001tv\001tnb\235[\260\316,\200\316A\240\363\212 g\025@g"
+	.string	"\200\316)X\347\226uF\341s>\361sf\3729\233`\235\227\210\234\225X\347\244!g$ \347# g\243!\347\242\237s\t\3269H?\276\267\324\031Y\341\310\251\013x\247\227f\361?60\213\267\361DKK\n\376\217\367,+\202\237\252\021\341W\274[\201r1\303\2643\301\002\233\025\244/c/rj\244-u_{\214|\374\215w\212\3601\304\334\300Q\361\"|\203q\221$U\374\213'\0324=\002\340}<\022\030\346\232\024\317b\272\b\260\227\271i\353}\207\250"
+	.string	"\340\225\3360{h?\305+\3411\355\206x^\227n_\305[\262\365\3126\3722n7\211\212\342\177b"
+	.ascii	"\342\336.\f*\263\333\304E\361RO4%\321-\264\260h\221\320\337\022"
+	.ascii	"(r.?h^Q\256W\262\325O\234.\323b\\('\342Hq\251$=\317\362\242D"
+	.ascii	"]\360\254\225 \322'~\207\017\3572\355\305\205\256Mf\267\212["
+	.ascii	"\203w\363\304'=\317\360\230\256\2707\260i+\323\315|q\332USM<"
+	.ascii	"\323?1q\030\346\340\352\340\3354\361\275(]\236\327\235]\0368"
+	.ascii	"\340\227Q\320\304\251f\006\242\245\033\\7\246,+\323\241(\375"
+	.ascii	"\322\267\023(\233\226\256=>\"\342\214\ry\240*\275\243i\361*\036"
+	.ascii	"@1\273\\\034\315\365\362\364\244{\35438\324\005#\306\0353F\355"
+	.ascii	"\236\322C\265\035\"Q\204rp\223\323z\007O\364M\347T\\2r+\323\231"
+	.ascii	"0=\317\220D\231\257d\351<\212k\006\315\312t\262\263\260\243\027"
+	.ascii	"\360\332\004I}\005bk\244\270\315q\031&p\3414\226'S\270AP\273"
+	.ascii	"\327\301?\030\247\013G_\364H\337L\032\326\3464\252\321\037}3"
+	.ascii	"\3218x\243G\312\322\265\307\t\b+\023o\342\246Q\343\262a\243v"
+	.ascii	"\257\350Q4q\272\271[\222\034k,O\234\314\225\270m\352\3347o\324"
+	.ascii	"\356q\360\335\246'\250s\272I\3437\350\026\020@\375\372\314\221"
+	.ascii	"S\201\337\357\263\367\223\216\210\231\237/cG\322%6x\035_\342"
+	.ascii	"\375\tT-\257K\f\370\033\374g\351\332#\365\302\006^\340\346d\263"
+	.ascii	"\204\363\246g9\206\305\310\331\357\313\330\327\003Q\b\337h\232"
+	.ascii	"\350\f\235\0353\022\334EU\352\235H\225\350\215nr\232>\346\302"
+	.ascii	"\211b\017s1WN\372\203KG\245\243v\217\350{\256)X:\325\334\305"
+	.ascii	"\371\030:+(\361q\205\320\361\035<\315\352<\2413\"zg\267|%\211"
+	.ascii	"/\343_\323\327\313>\362\026\366B\227\030g'\247\276\001\276\311"
+	.ascii	"t?\337\302\220t\211q'\322Q\357\364a\322\277\203\0263\312U\355"
+	.ascii	"\036A\345\364\243~\200w"
+	.string	"2\007|\f\266)K\265\307*\252\266\007V\325\2251\001#>\032\213F\343\002-\216\031\017\260\354\342\030l\237Z-#1+k\270\243\315A\025lj5\220\021\003F\214\366E\333c\230eU\324\240\005opA+\244\312\032\032[\n.\340\240\201V\330\022\255\246\264\246Za0H\025\224\312\240\002\034\f\360\021\2036\013\213h4\006\301\321\n\201|\244\302*N\021\217\355UU\026\220\f\332+b\326Q+\207\022O\005a\244|\f\3368\006Un\205_4j\365hI\260\320Y\252=\026\215Z\r\b\261\325\216\241U\325\220\204a+dx%<\006[)\254bU\326\320\030\244G\025\017\254\"\016(\026\022\024\022\243\225:\036\211F*\252a+\244\n\266RD\023\252\216\355\217\251aV\216\025l\202\003\022P\005o\374\230*Z\341h\217\3016\003\034\022"
+	.string	"\217E YU;T!D*\254\007\200D\343\260\004*\343\320\201c\320\217\343\360*\255\352c\021\310Sa\005)\362\350\3758\016%8\032\213G,b\016*b\326\0241\213H\005\344\021d\307gQ91kx\201\020\243z\3541\264\342\321#bUY\021\257\206\023P]M\371x\nF\225\325\024\024V\325\360\nj\312x\204\202Q\304E D#TV\261h\204\372\265\r\351w\362\254R%:\344\227\\B\227 \351\37329\240\303t\333\355\340yE\317*|\342\313\270\335\364\320\235\272\2615&\334O\341\352\306\314\226\264\336\306;\265T\033\251\0251\037\316R\246\032\337o<\b\327\255\350\353\270[\376\003R\216\317A\312a\344\017H:\216\244\243v\257\306\253M\236p\322\342l<\215w\277\361\272\304\004x\032\001\274"
+	.ascii	"\357r]. _\330\001|[\201~\021\202\251'\351\221\357j\232Dt\nn\343"
+	.ascii	"\231\221C \353\250\335L\372v\323\276\366\2542\366Z\314p}\231"
+	.ascii	"Hrj\2448uF\302(a\275\001\315\345\314H;\310;\357\246\326C\360"
+	.ascii	"\254r\344\r2\017\022oe\376\\\025#\321-\247\3562N\207\314S\256"
+	.ascii	"\314\377\202f'\312\365\364P/\203\215\273t\271V\346;\211\3612"
+	.ascii	"\376\251+\306w\036\030\017u\202\323U\301\273\t\343U\271%B\276"
+	.ascii	"\\#\336\315'\271\350\322\200/\340o\374\213\237\201\306=\342\206"
+	.ascii	"\255LW\263\342\035s#\374\031\317\316,\302\351\205_\002\312E\210"
+	.ascii	"\261\244\323C=\321\330\242\313W\276\370\336\023M-\272\265\344"
+	.ascii	"\342\261\036\211N\223\213_\312\322\342\233~I\315\230n\361\337"
+	.ascii	"E\251\255\316\210Y\201w\250q(\345\020s\244HFD$I\222\264\0061"
+	.ascii	"\005\204('\241\264\016\021 \255dP\315H\222d9\272W\230\313\274"
+	.ascii	"On6$\004j\301@VXP\316\217\376\323h\004\220\002\274A1G\002\231"
+	.ascii	"\251(*\346\026%\337\363\300S-\266\277\355q\201\244cz\b\302\344"
+	.ascii	"\334\\\217\202MP;\302C\360\202\036\212U<\212x\357$\215\022\243"
+	.ascii	"h\353$\243\377\334:<\360\001U\304PE\367\231\342\200\025~sD\200"
+	.ascii	"\313\331;L<o\002\202h\"\227\2118\274m\251\363um\254\333\016\365"
+	.ascii	"\312mn.(QL\b\262#~`2\2458\206$C\213k\300\364\310\327\201!\351"
+	.ascii	"E%ZM\354\347D\332\361\022\002\377\242\305\376U\351B7\032k\035"
+	.ascii	"\360\025MCb\243o=\333\316Z\016\241\314e\356w\307#\231\264\365"
+	.ascii	"\263\325\213\236\307T$\362\033\"(\240\361f\210,\224\212\271\277"
+	.ascii	"\212\377@/J`\354<d\r\346l\235\315W\270\251/,\236\216\323\277"
+	.ascii	"\211L\026\326\034\n\033j\0051\036\016c3\235pn\223\317\221\303"
+	.ascii	"\266\331\f0O\f\204B2\262[ >\002 +4oJ[NQ\t\245Hs\203\327\213\273"
+	.ascii	"j\\\265\300<\275\332\306\352\347\200X$\335m\365z_\214\251\267"
+	.ascii	"%;I*\334\337\326\236n\007\267\022bQh\234\352H4M\350\n\357Ef:"
+	.ascii	"\036\211\316\215\021\023\376~8\253\220q\213\261\350\320\020\033"
+	.ascii	"\036D\214\343\345\037\222!\026\372\b\023\367a\236h\365A\034\341"
+	.ascii	"\277\227N\r\356#\312\001\rc\2657\332\260\202\026,\374\265\267"
+	.ascii	"\220)\212p\217h\314HD\354\320\214)\214\2273=8J=mC\215\373\265"
+	.ascii	"\252\304I\302\365\245\002hD\n6\3558\\$\023\240\207\b\352\343"
+	.ascii	"+&\223\3678\317\273\027D\355\313\366\247\005\234\221f\031\022"
+	.ascii	"\200\2406,\261\337P\237\007\257\243:m8`~\220\364\363F\367\363"
+	.ascii	"\373\221\356\212\243C\262\024\\$\233\205}}\240e\006\026<\242"
+	.ascii	"\243\246{\371\t\034\347\241K^Q2\230g\275\300\t\277\240\262cE"
+	.ascii	"x\227\310\335\271%C\360\303\017j\200J\341\246\212\240\023y\216"
+	.ascii	"\203V#H\240`)\360e\006f\372{\255SO\360\2549\252\2607b\320v\250"
+	.ascii	"d\212\332F\327rLp%\312?1\204*<\241D\225\205\215\303\357\253\216"
+	.ascii	"a[\321\037\2023\345\204\371\202)xz\025\3269\240dy^\022\213\311"
+	.ascii	"\033Hf\032\241\004,\325\261\022MT\003\363R\321\307\207\307\034"
+	.ascii	"\0356\311Y\330\205\363\f\350n\213\377\006\340\0373m\306z\016"
+	.ascii	"\276\007\215a3!\370\207\312a\220;+][8 \205\232]\264\360P\200"
+	.ascii	"\334\b\262\001\016F\221\305G\r\035!>=e\213\245hK\027f\250\313"
+	.ascii	"I\223\232\022\036j\0314\261\036H%\001\215|\360a|\313;\304\n\220"
+	.ascii	"\341\030\023\247E\"\030'\377\001"
+	.text
+	.section	.gnu.lto_cliTasks.316.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\367\013\365A"
+	.ascii	"jsX\031;0\350\316\030\360\326\345\256\220VC\230\223+\232\374"
+	.ascii	"B\261\233\311N\277\205.o\213\366e\241\372\031\367\351=\f\350"
+	.ascii	"f\033\351\356f`\206\352\310#\374q\260V6\256\354\225+\267L)\245"
+	.ascii	"\205\001i\001\212\001\276:7\007&\242?j\224t\240\242\367\025\222"
+	.ascii	"8\3515,\016r\351:\335r\272\337t\263\351\366#\344v\260\351@\273"
+	.ascii	"\316\332\022\317\217\311\025\027l\027\273I\220\271en8\334\322"
+	.ascii	"\216\323\201\320\226\203\303_:(o#\211\336I\232\276\257\335\t"
+	.ascii	"\266\213\377r\365rm7\334\200\334v\361\215\216#~w\210\323\367"
+	.ascii	"\355\003\301v\321\273M\377q\353\307\204,\233\035\353w7\250\313"
+	.ascii	"W\253\3515\320f\303\204MmP^':\277;B\323\367}\261\272\310\017"
+	.ascii	"\330.\272\252\367\361 \224\325\316\334f\372\f\264\321\364h\247"
+	.ascii	"\367\325\003\024|\337>-N\300v\221\373:j\355\"\333\313\265\213"
+	.ascii	"\feN\364\257\340\213\267\336\355\211k\003\351}\337\346Sa\246"
+	.ascii	"C{J*\212\271|rjbR.%[\344\2215\256*\324;\224\333h\341(7\204\255"
+	.ascii	"\247\270\264\224\312`:\347Q\003\262\343\242F\t\331\"\327\177"
+	.ascii	"[<J5\302\t\331\322\200\354\264\250\023\020\247\203\r\030u\246"
+	.ascii	"\321\302\024\"cz\211\245\237\234\256t\223\225*\316d@\n\221'\255"
+	.ascii	"T\225]\374\2705 \273'j\227\024\n\245\366b\347\304\227\360:\211"
+	.ascii	"\327\304[&\215d\242\272^\354\226\370\361\256\331;\3016\340\305"
+	.ascii	"N\211\033U\027\220\035\026i\234\257j\267\215i(\243\005)D\262"
+	.ascii	"\364+\207\274\251\356\373\276\375\327>7\304\315\335h\341}_v\271"
+	.ascii	"!D\232\251\232\271\355\230\033\214\031\371\024l\365\366\276m"
+	.ascii	"\b\326\357h\0367O\344\377\342S\265\211N\333<\261y\221\243?z\354"
+	.ascii	"\357q\177\255\377=\305\253\245_\377-\330(\362\350\022\373\320"
+	.ascii	"\220\0327F\033\253?Z\206\226\332`\337\367\215\340\337\346\321"
+	.ascii	"U\212$\300[\260\245`\254\234\3263w\370 \215d\b\367\177w\340\206"
+	.ascii	"\254\177B\214`\243\r\346\216\356\213\037\365\367\330\277\373"
+	.ascii	"t\003\366S\341\341\223-*\267\216U@\030\036\022\025\253\233~\316"
+	.ascii	"\037\253\333\315!^\020\025\253\273~\216\033J\312\333M\36391U"
+	.ascii	"\345}\243-\227\202\215\222-X\301\302[\216\251\350\276\3501|{"
+	.ascii	"6\001F\316\214\371\337\343\027k?"
+	.string	"\2145\205\336\034\221\231[4\236\027\354\373\276E\340\276\323\205N\356,]\34401o9\261\265\213\375\355!\335#2h\332<\221\271\317\315\177\217\271'TA\234\362\3531\203a\370J:_H:{\265\316\025\272\222\316\\I\347f\353\274\245\225\205\305\340\312jA\353\254\240u\256j\235\023\264\316\bX\347\003\254\263\001\326\331e\235\013\254\316\004\372M\263\200\3269@\353\f\240u\246j\235\231\254\363\024\353,\265:G\261\316P\254\363\222u~b\235\235\232Xg&\326Y\311:/\261\316I\326\271m6\315H\326\371\330\316,\322\331xt^\217\316\305\366kVY\3477:\007\257\224\n\322v\232\252\361D_:p-&P\274\001ta\316\030>U\202>\211\302F\333\321\025]\0301\206p\317\346d\345S\317|\252\007\360\001\236\351\217\277%\t\232W`\217\215\266 \025\250\030o9V\337&\317\026\340;Z\246\371"
+	.ascii	" 5\327S}#\233\tW\256g~G\007\335\244~\352[\217\2570\321\212\324"
+	.ascii	"\233\345\325\305\211\324\364{\334\202\r\325w\310'G\211!\353\031"
+	.ascii	"\374\\\013\366\322\360\220\017\215\362\353Y]\272\372\005?\327"
+	.ascii	"y:\352[\312#GQ\317tX\367G\206\231\270>\3531\274C\341+\024\324"
+	.ascii	"\374\253\377\372\236\362\025\372\211:\351.\203g\344\224m3j\252"
+	.ascii	"\351!\237\223\344\205\347\3729\266u\254Z/B\311!,KP\177\341\251"
+	.ascii	"\246\275|\250\277\nlE\375\364\313\267\ntz\246\177rz&=\276Bi\362"
+	.ascii	"\310-ceN\017\371\202 \275\276\311\364ID,-\375b\372\251\274:6"
+	.ascii	"\255\362\275\236\351(\256\222qP\177\255K\257\374\002\201\242"
+	.ascii	"e\026\374\350\2575\371KO P\324I\373\307O~G\275l}\373\312.|\205"
+	.ascii	"\177q\225\220\277\307n\304jws\370$\021[\341\267~\256\005\365"
+	.ascii	"\361\223e\240Z\216/\225W\307\206\f\032+g_\353{N#\202\362M\r\202"
+	.ascii	"~a\243\335\007\005\003\025\343F\237\215LK{\260o\314\243K\214"
+	.ascii	"\244\036\215_\341=0\256\322\001_\237\031z\006\232fm9\343\273"
+	.ascii	"\305gi7\"\022|\345\301\013\214D\206\022\256\f\263\261\347\032"
+	.ascii	"YX\0161+\327\304\026?!4\240\320U\345\232\235\215\251\271_\256"
+	.ascii	"\n\022.?#T\251\374\244PU\365\354\252\332z>\220P\345>#T%`\367"
+	.ascii	"*\rBW\225\225\253\345>\033pU11\222\323\312\232dN\26535\367\351"
+	.ascii	"<#\313\341,\223q\303\351\272ik\315\034\3162\327\3351\243)\246"
+	.ascii	"\346Ds\325\322\306\310\\\032iN\023\033\302\314\3264\320\b\023"
+	.ascii	"\233\021\266t\026\303\214}\202\321Hs\252\2559\234e\310\262\265"
+	.ascii	"\022O\347\231\0071\031N4\261\033N\245\230\331\030\231X\231\023"
+	.ascii	"\304\263,\314\310a[cdaM\2631gY3\f-\255\271\025\305g5\304\320"
+	.ascii	"\232jggh\315\266\257\255_\217\377\332\211.\314\"\303\266w\233"
+	.ascii	"\342\265\251\032Od/g\366\221\be\013\303\307\320\355\331\330\312"
+	.ascii	"\021|\202\257z\005vP\267)86\352L\224<\233\002\365\253\022 \037"
+	.ascii	"\301?\371\362(\212\016\272\271o\340\017|\333\361:h\334\024\020"
+	.ascii	"6"
+	.string	"\332\210n\334\263\315\035\2503\360G4m\005\336\375\016\024\322\204\005\276\251\034\326\331!#\301\333N\023B\2130C\217@\223\020\206\271\363\004\210hF\212\231\365\310\237c\225y\365*\201\207\341p\376F\340\373\257;\034\326\325\211\002\354\346\225%\3303\224\200\327\302z\206j\372\254\237\343\245\325\263\n\325\365WKd\231\356V\231O\f\236\327\254\307\3729~Z\360\254\256Wo\325`\337\200\335\016\342\223\336\211:\301\241\276\001\200\355\250a,\304\024CJ\031\031!\221&I\032\003p\002\031**r\003\020H\247\206&I:\334\003\205@3n9mT\236\250x\024\267\303\252\3048ZM\276\320\002\230\250\022m\b\321i\324\017\243\277H\321\254\367H[\340\232\350\t\275m@ZjHF\334\225\204\375z|\350P\212C\374\326\2228\213\307\213\305\\N\231Ek\006\007\210\315]E\257FL\017\0350.\004o\300\260i\022"
+	.string	"\222[\022\033\336HBZ0\001\264\341\002A\n]\216~\272\252] E`\007\330ka@\023\313\202\227{\035\270\260f\217\004\374\017h\325\306\334B\022#S\342\264<\276~\263un\032\365\263\300a\366\215\211.\375\233\203\345\325h\322)"
+	.string	"C\302.A\271E\210\030\001\252\300.\332\200D\f\035 #\036\253\231\322>\370-\274\305\243i\001aM6<"
+	.string	""
+	.ascii	"L\214s?\374\320G~>\037\306\322\214\220\224\211\337\017$Fs\016"
+	.ascii	"\215\221\025\306w\306\023\222\253\033*C&\302!h\002\275\f\315"
+	.ascii	"\271\017`Yi\023\3729\017\\\331\203\177\035\351\2308Q\224oY\256"
+	.ascii	"\203\016X%m\210@\txGPN\210\213\345\367\026\261\372\257QC\210"
+	.ascii	"%\004{s\013\360]{\260+\360wwO\372i\323\310\354\332\247/\\!\220"
+	.ascii	"\373.\364\371\311\320\207?.\376\265P}\363"
+	.ascii	"\237\204\252F/\332\230bR\214 \026\f\ba\260\036\243\002\371\224"
+	.ascii	"\337\321\373\203\270\347\034/\343\273\342\2507\213\361}\\*G\234"
+	.ascii	"\013\201\351\222n\237\252\252\201Ed5\222\021\260\256O\316dV]"
+	.ascii	"\200a\207\200Q\335\347\003\375?}\256\323\241\263\275\365\321"
+	.ascii	"h\306\022%\273\221\013\031\016d\303\222 \333c\243\367B,\354("
+	.ascii	"\\*\375\260\250\207\201*j\001\363\357\267\304\372\312f\260\032"
+	.text
+	.section	.gnu.lto_cliSchedTrace.317.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`'\n]:"
+	.string	"\372f\360\026BP\346Q\007\377_\356TlTZ\307\233\204\032b{\273{\325\377\022\266\240\r\031\362\201\210\214"
+	.string	"\035\215\007\372`Uv\205\210s\302'\020I\377\200\211V\373\024\366\020\365\210\032f\3051Y\333M\366N2\245^\001L\001^\0019\217i\310\013\\\211G\246\335\255\f\214\340\227\220,\344\301\026\255\243\340\216i\237\263\355l.\346\365\266\030kn\313_eUR\346L\267Dp\235\035\256\256\326\016f\315\013g\250\220\234\264\203-\352\345.\347)\225\263\355\300u\366}\335\215\2472\354\252\034w\373\026\347\362z\027/\027\346l\004\315[\316\323\004m\300u\266\247\276\304s\326u%\236\263o\267\335\347\267\374\203\027\335\342\fS(\347l\365H\332j\265Z\365u\352\255\324\302\177}\t\200R\022\2230\b\374!\035\371\214zn\313c\327\307o\273\021\031\323\227"
+	.string	"\254\355\214\033O\\n\314\311\032\341\320]\032_\263\004+\035)c\342I\376\305\304\231\326?s\233s\271\261'\253\2049\264\036\356\226\004\013\217\224)\361`k\301\315\035\312\026\255\363C\244L\211\003\203\370\017\310:\034\023\004#\311\21559\3621e\354\007\366\031\255\b\356\340\006\271\334Xt]\272\361\344\351_\374i\312X\017\334{r[\013\255\231\217\314\211y?\266h\031?D\312\2348\273>\240\362\245\245WFQ\030\037\331\f\274\256>\034vs?\262\346\352`\017Y\017\007\023\206_n\354l\035\346\234\375\213c120\214[\0139\347\306O\2622\357&\357v(\335>\354v9\004\353\324;\275\030\035w\322\262VG"
+	.string	";}7\006\r\336f\007\313\233\241;\004\212\3724\3419a\257V\275\331\360\250\334\303\270\334\225\203$\033\334\346\211(g\233\276\273\303\007\354\317\036"
+	.string	"M\323Au>\263y4v8\331\030\274\251\217`f\207d-N\023\226\372\356\020#\260?\247\336\177\b\t{\246KM\315hY_\332^<\251\36773\273\"ku"
+	.ascii	"p\t\023\330\237R\257\005j\245J\rc\340\234\201\366/\245r\377\024"
+	.ascii	"ky\302\360\241\026b\326Q\360\\\315\341\020\335\234\233\376,\272"
+	.ascii	"M\022Q\3162}\267q\005\366\247\277\177q\327N\032\265\320]\363"
+	.ascii	"\231\335S&~\251\234\215\347\\\277\221\356\026\367\224\257yKA"
+	.ascii	"=\265\270\235\274\315[\200wqo\362\251;\023\306-t5\336A/\343\r"
+	.ascii	"\364\341\376\265\270\221\214p\037\265\270}=\334F-\356^\017\267"
+	.ascii	"\353\270\333\0267\317\305\315\266\270W\027\367\267\270q\213\333"
+	.ascii	"\0250\240s\263\345\n[\224\313\343\231\346\033\325D\231\312\246"
+	.ascii	"\201\342m\334\325\270\277\271\227qos_s^7\233\366\2706\311$)["
+	.ascii	"4\021\bw\215\232f\243\243\031Et\227s\366\340\232i\207;\343h^"
+	.ascii	"\177\353r\037\315\250\236"
+	.string	"\273\300\207zws_!)s\342\232@\300p\265\273\326\234\211T\270S\303\3256\200y\337>\360=\rv\276P\006\320\375\351e\325\341\274\332\377\345a:\334\013\346\346\234\037\360\276\005X\rBX\272|\341jO\300\236\306\341^\247\373\004\322x\305\340\034\377\200\246\275\241\316x\346\377\034\332Y\232\340K\373{\374\032\347+\237\313\023\345\354\367@j_t\345q\350\234\032\345\254\360\305\272\r`\341\013x'\343\211\336\032Mt7\334\246\257\r\233\317\\\201/\305Gshf\2777\342\201\234}\025ku\020p\274:\260?\331\367\202\246\251\241\202=\263\035\340\356\367\354\215b\177\nx\037\223\006G\005\013\3406\027\005i}|\304\355\334\325\234\020\227\365\375LH\363\231\316\364\265\206\316\021\222\367\277d\360\006y\207`\177\376KA\323\270P\303\206v\207\326\370\324\374\317\013\245\351\311QZ\026j\3303[\001\356~\245/\222"
+	.ascii	"\3204,T\260\240\331\223\216\021\376\345\312\347U\3422q\233\236"
+	.ascii	"\004\177\022hZ\032\265\331\233\302\036\306\353^(\003\222Hq\233"
+	.ascii	"~\206\366VA\243\206\271\006\260\323{\030\307\363b\031@\367jq"
+	.ascii	"\233*\242^.\257\027:;X\356\f\335\315xf/u!\324\246}i#=\237\312"
+	.ascii	"\243\232\3216'\232}Df)\267\220C\254,-\342\213\343\025\260\273"
+	.ascii	"\240\206/\214\300\306\202\032&\241~n\2578f\035\217]\\n'\241\206"
+	.ascii	"U\311!\026\224\022\005\226\221E19,\340\324[.\272\260\266\266"
+	.ascii	"\220l\377\332\250$j\r\223]XPC\243V1Fq\210\344\212\261bH\034r"
+	.ascii	"\031\225*\210\303\344\026R\231\034Va\031\207\306\"\221KD\203"
+	.ascii	"\0161\002\205\006\021\0278\270\255\344\"*\223<\345\321\370\302"
+	.ascii	"\310f9R\305\321\305\272j\221$*y\312c\027\262\310r)\267\336x\314"
+	.ascii	"\3222\272 z\300rQl\273\250 K\253hu\314\"\272\260*r%\255\024,"
+	.ascii	"5r\313\310e\245D\"\271"
+	.string	"\254|\323\354\026\276\036\314\227@`W\303f\313;\007\310\352,\355\234A\263\340\240\266Dr\030\001\360\322\356\301Izzv\t\023\225\007\005|\360\335n-\216\323\311\021\273\242T\345\301\177z_\343FT\244\320\241\223l\323{\337#\375\357\335\r\316\261\274\263\304\34361\263\245\222\315\236\231\307\343\226z~OA\311\321#\361\361\270e\237\243w3F\357\363c\364>\307\375\336;\037\347\242% \217[\nr\377\205\235\032\325\f\330\335x\334\322P\360\273\227\210\226\212\342\0209\2321\2513\351\245\355Lo\244\201uA\250g\017\001[L\t\327\371\232s\316\302\227:\f^\200\303\250a \005\225T\206DDDDdDIc\220\002\221\261*n\020P\250\204&I\007\202J\030Xp\200w\016\220C\331\032\002\325r\005,\355Wv)z\366{\364##\255\334.\224+\253\250>!\260}\274D\035\220\224\233z\005\031"
+	.string	"9\364:2N\364w\243\216\261N6\013> \371w\330\031\365u!d\024\216l"
+	.string	"\016JCt?\244\235\275\331\363\26007>\236(;|\320t\023"
+	.string	"\ro\223\303\343\230w\366E\212\232kq\210\202K\n\247\001\033\354\375\345If\224\321\007W\331KS6\360\332\266a\264\233Z\317\304\277\272\031\301\246=N\213l\302\225\371\013-:\241u\277\257f\320"
+	.string	"\347\001\2465p\366\204\265\334\355A\002\347\261 \316\f\021\222\354\336\b\334+nC\236\005\260\355]\034\274_\325UW\234\301g\202!\024#\2220\333S\334\327s\234l\313\353 *\226-\226pq\231y\271\376`.~\316\357\217b\370\234\212\035\b_\247\300\275\252Q~2\022\344$\t\20475\224\270\373\337\310\323U\216G\215Q\017fO\217\032B\r\bJ\332~\276\216\350 \243j\365~\245"
+	.string	"\267\322\331\030\323\377dM\304b\376\254m\203|0\004\240\177\340\276O\300\207\364@3\321N\377\242@K\316\377e\253"
+	.string	"p\321\b\025\340\203\305\t\347W\263\016\302\033d\227\314X\240R\342\274\235\005_\300\230\213"
+	.ascii	"J\363|\3211\22415\347\306\372\376"
+	.text
+	.section	.gnu.lto_printVersion.318.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\205\001\005\020"
+	.string	"\006\235lI\320TQ:dcV\232[\324\035\365\0168\304\216\347\265\251\201\017\352\203\335^\331\325\217'\026\363&\247\366\315\275\351h_\312:\224\314M6\341\207\261\214y\371\223y\303\231\322"
+	.string	"h-\307\364\204*\217\252YA\032\331d\357\224\002Q"
+	.string	"R"
+	.string	"["
+	.string	"\260\347H\250<\311.g\267\340\323~\316u`\3371q\002\2738\036=\2739\006>"
+	.string	"\276:\367\224\357\025|\201\357\3250\333\b\335\236\275\371nl'l,\331]\221\2768\354\023\346\177\306Oj6\261OQ\204\335\365\254\331\250\270\351m\257\330\216\331\377\t\273\202\306t\254\274\034%\2751b\322\223\323x\r\227w\034\323\324|\257\325|\257\247"
+	.string	"nBB,tn\2629d\347f\223\272\260\357\355\356\232\342\354O{\237\246\237\236\237>x\034;1$Cn\017\032\332M1\324d\201\252\017\f\333G\261M\247mr\020Gdtf\003\323\276\360RQ\310P\0024\2431\253\314\353\036$\003\265\001\331\305\200\264\022\245I\351\217\006j\373\261\333"
+	.string	"\322h\356\203\303{\334\247\203\217\363j\017\037\246\350.\362]w\236\323\327\302\306\023c\004i\251\322\353u\337\201\032\020\264K{-\005\322 \224^mR\304|\315^fi\t\033T\233BS\330\362\231\002\313+D\212TU U(\013\001\354\"\215\036\270\300H\030\301\304\274$p\221\020\210#\027i\264\242\240\004\301r\221i\235\312\t/\026\331\232\021\200Z\2350\310\254F\221\307\220T\215\"\213<\255\304\261\345\022\303\024\2273\250\226\370*\313\226\210\222\223\335[\2123HD\3102\t\" \260\002\242\242\333\363\003[\220 \343\275c\310\211\227\235hi"
+	.string	"\006q/\273\247]s\273\301;\273\303c\253\f[\335`\241\033\362\357hL,\355\276\354\020\354|\031\303p\317\243\354\r,\235\001M\f\343n"
+	.ascii	"\255D[^\b\236\f"
+	.text
+	.section	.gnu.lto_cliVersion.319.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\035\b"
+	.string	"\262\21787Pm\323\001\2040.\002i\265\342\251f,"
+	.string	""
+	.string	"{\027\203\350zx\311c\224.\241&\b\3372^\351\347\342\224jf\221E\244\030\366\256\364\f\236t6$B\233\354\235R\230'\353p\264\253\302\264M\002G\273*_\232\254sUO\266\321\352\305-T\r\306\233\002\306U\206m\343\352%\334O;A[$q,\215\021S\302Tf.\247\335\340 \377\271\200$\216J\343\304\364\354\320\223\023\303\376\264\273\353\t\332\017\375r:H\007IJ\311\305Q\304\335\212\026\226\035Q\021\r\333\277\330\226\341\203I\346\322\376\3069\272\207 \036\260\013\206\210vC\003\023X\247\016\217\241N\255\013P\247\356\354\223\271\242\005Q\240\025\212\017\225\335\2553\343\335e\347\337\343"
+	.string	"\337\307\273\254\020v\327\362\373X\334\363\266\007l\037\330\036\t\f"
+	.string	"\357b\310\304\333\276h\306\005b\327\320V\030\017T\003W\300\334"
+	.ascii	"\025%\334\345E;\311"
+	.text
+	.section	.gnu.lto_cliRcSmoothing.320.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`x\n\0055"
+	.string	"\032Y \024B@dR\007\267\253*\204HbWe.q\031d\252*\3604\227\304\216~\231\240\351 \266\311\367\033\230\267\327\b.\340g\270\263\245\r\303\035\352\225\360\362k\034X9\205Z,\212\221\326\310\336\273\211L)\005$\001 \001/\001\300\357\226\375f\333\357\225\375V\333\357\037\373\235\327\357W\277\275\301\023\243BZv8\24280\fm\264\b\326S\3154\361.\356Z\360\332\275\264\260}\213sy\275K\013\243Z\020\330\b$\226\363\241\325\272j|\367i\013\273[\313\213\207\237A\340\244\270X\316\006 \030\2763\340j3h\377.\306\237\003\376\335\216\305\263\274.\225\341H0\\d\r\031\030\276C\320\004ZW\373\316\231VW[WZ]\355\267\333O\206\311\300q\253\234\323m\013\"\030\206\263\262\021\177])\t\311X$\036\r\205A`\313\256\352/\377\333\316R"
+	.string	":\243j\256\224\204d<\362s\241\274\321}1\211\023\347\274\311\001\371\243a\234\013\177\370\370\240"
+	.string	" Ka\310\215\036\336\316y\343\341S\027"
+	.string	"\345m\307\263p\276\006\243p\256\022\243\361\317\205aX\030m\373\337\257"
+	.string	"\2402\206\334\213\277\215\250\333\217\t\312\304)\214\262}\376\025"
+	.ascii	"\342&\207\317yC\362c\222C\204\217O\375iD\233\377,\005\030"
+	.string	"\206\373\235\321\033\336K\336\355\022\272}Dw\233\027E\236$\352\022\233i~\243U\357\2352U\245\215\375\251\001\353)\315\022\300\215\227Bj\213\325*w\330\261\350\320\027w\363\3269\275W\332\370L\352)\255\313\331*g;n\214\372\315\342l:\257\205a\270A\373\232\327\312k\327*y\261\272\232\263{\361\023Sh\030\276\007u\321<\277v\264\365\263r\252g\352\273-\\xw~\226zJ\247\240\311\340\264\325\306+4@=\245Q\364\330\234\211\023\210^\316s\336\265zN1\315\303\366\211\272\233\203\223\351ja\230\255A\273\030\037\343\241]\211\253\375\001\304\273\023D\016\322\201\202\251\223\256}\243^z\307s0\"\212t0\034\273\223D\033{\260r\265\333\004\212wg\253O\251\234\036[V\353\342w#\223\357\316\001\271\304S\032\247\327\314j\335w\315\317s\335\376\203s\221n\357\342m\345Z\274\007\250\337Q\303o"
+	.ascii	"\3547T\373\3754\374v\362\357&\3407\223\360{I\370\2554\374N\002"
+	.ascii	"~#\251\337F\366\273\330~\023\375\373\b\370=\024~\013\205\337"
+	.ascii	"\301\34070Z\337\315\344c*\352kA\202\210\234\031F\231}Rt\314F"
+	.ascii	"m\3743\370\"\300)\262!\314\376\266\255Nj_\343msz\323\224\035"
+	.ascii	"\357i\354\301\361\365\3065-e\244\314\344}\\)/e\251\274\244\254"
+	.ascii	"\324|\267\267-){\337\267\275sn\347\327\236\35552a\357\233\003"
+	.ascii	"\220\262\222\016\364M]\020\357\341\327MjF\033\273\234@\300\276"
+	.ascii	"\fR\316\346M\253i\203:i\337\032\2531+i8\337[\303\230\213Mh\032"
+	.ascii	"\276\342\241\027\312\024mc\277\202\203\230"
+	.string	"\213\331\303\350pB/\0341\247\230B\323\324I\257\376(;\236\013zy8\371hc\037\322\346\177\302\336\270\366wnu\365({\030\032=\204\271\315\303\354\261\224\326\273\315\032\314\302\034\300N\f\005\230\203\331\345\234\317+\004\230\335\320\021)\021\327\363\3169\234\275;\236\34752\201\016\206\331\034\340\361\275\367\310\357M\342|\227\254\256\n\360\316\313>\365\366\017\021h\036{\365jf\263\177\361:\357\224\251=\270\367\311\033\345\335\331n\234\325z\315\254\313q\253\274f\217\255\374\262\232\235\335s\253\325*\377\262\007\315\325\265\365UaCW\007\257\013_\\[\304vm\254\26003\265\257\300\250\334\366\310BL\231\324\302\032;\246\225\035\311\256\200\215e\266L;^\261\355\302X\001V\345B\b\0133[\246!\305\334$\013\261%\262\202K%\325hUKW\231\\\216\211\205\271\313\264\263\262-\227\352\251\321\310\300\026(\250J"
+	.string	"V\025\354\r\025\2702l}p\273\270\202\313\243\322\rsCx\271`\311%2\271Lj\271TQ\355u\341k\303\026\006\266]\b\311\263\027_\256k\301\313\245jB\003\221$;*1\270\360R\301\3428<.\217Z*\312\304V,\315\314\310> \225\305d\231\330X\222\354\310\005F\206d\033\231@l\f\231U&v$\313B*\321\262\0220\265\331YR\231\26543Sf\t\357\326\374\007\347\"O\273+zk\271\251D\307\244\343d\247\215\037\214]\025=\266/SH\216\220\2449f\337\324T\016i\b\023\0173O\033?\026;\037\020\350\270\\1\346\271D\036\225}\310\236\227{kD\345\244&\364N\035\2412\317C\3058f\237?m\374T\354t\020\033"
+	.string	"\017"
+	.string	"u\240\340\230\201\230\203\332\370o<e(f\241\317\361\224\303\232\320:G\001\200\312\250q8\244\220t\204D$\020\021I\222$\035\300\002\021\241\"\333\021\360\250t\212\325\204!I\212\305\344+\224O\365\375\210\320\264\032\243Z\030\335|\001\315S\370\003\211N\025\351\350\004\030<\375\020\247\243\356\337\231\254X\314\204\013\"\235\244\027A-{\366\211>b]\250\355auu\270\376Z"
+	.string	"6|\312\035\177\236\023\007\366\017\306\253M(:\274*|79C\243\222\034\372\020\2227\025zK"
+	.ascii	"\203ePyQ\030\255Z\257{\262x\342O`I\306\326\252\235?}}F\023\254"
+	.ascii	"\212/\275wk\244\240\255^\350\324o\256\304k\221$\3265u\214\337"
+	.ascii	"\310\274\343\352\343\343\2579\25073F\317\240n|3\265E\023A\005"
+	.ascii	"\022l\305\035\301\261\257\216\273\301\2549M\307\366\016\022\205"
+	.ascii	"[M$\223|]\367\203A\233\225\3137M\343\222\246\267>|\240wm\252"
+	.ascii	"N\366\004\370\3077\247\223\223@\342\352\240\245\\Y1\b\020\271"
+	.ascii	"\202>\004?\r\360\207\223\007\210\fS4\250\021}\n\003\302\230\t"
+	.ascii	"9Mu\020\212\210Qw\321\340\210A\007H.T\022Mu\321B\254fPqZ\021"
+	.ascii	"\226r\273\034\013\261h\305~_z\021\222\240A\364\301\206\260\374"
+	.ascii	")\023\217d\302\322\305\274\007\264\021\321\246\244\360\253\335"
+	.ascii	"\017\271\342\005\2632)OB\200\030\005\364\3766Z]\005b\323D\nA"
+	.ascii	"\371G\230x\243\216\236\030By\267\3004\201D\315\005\312\021 \303"
+	.ascii	"\346\001\323-\t\310Q\013;\305\034\325\324\016\252\006"
+	.text
+	.section	.gnu.lto_printConfig.321.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`X\033mz"
+	.string	"\232\302\364,N \220R\352\252QB\262\346\007\247\0033\017\207\203\350\275=\325\b\353\202\031\004\242\224\030(\325Q\373\321\327\301\377v\333\003\311\276\307\210\246\366vt\260\024"
+	.ascii	"\240\204\351\372OV)\261)\266\252JK\200H\026\374k\321\304\313"
+	.ascii	"\350o\211\335I\246\024\247\002\255\002\315\002\271\231|\2127"
+	.ascii	"\222G\361>\362\"\336H\247\3636*\"r%\336Cmn\241\235\334A\307\334"
+	.ascii	"@"
+	.string	"m\356\237\235\334>\307\334\035\332\334=;\2719\264\271yvr\357\360\344>\356\344\326is\347\360\344\306\331\311}\323\346\2669\346\2569\346\2469\346\2369\346v\217\271\215\307\334\305cn\3421\367\347\3349\347v\021N\304\001^\205\320\025\322\370?\2718\306\341\r1\226\330D\315\247\270Gq/\342N\347\256\244o\312\n\367\n\314\2453\354\001\303\224+%\312\2126F\022c\215\035`\025\022\006\004(\276\327]\323I\267k\232\351\022,\365\232\354\256qb?\035*\313\224\265 \263\334\303\216 8\345v-\004e\220z\326\364#\301\355\372\207`)\353\247\333\265\007M\365\302P\257q\034\327\330\270\021?\342u]\343H<\t\324\225T\351`\265\020\037W\240+\244\016r\340:\021\331:O\221\016\005\005\262`\304X6\230\254fa*(rB\033\227\305W\204\036\2544f\270\206\211c9\020Nl\003\272\333\334Mb"
+	.string	"\250\313p\202\313\025\225!\271\316`\"\313\241\300\205\311s\267_\375\r\352p\257\037\343\030\307\035^\034\313\205h\017\256\023[\316{\212Nt\235\247\350Dhw\340\307x1\215b\341\231\324H\2308\216\235>G\261XD\352\367V\316\233\350\241\036\202\t\204"
+	.string	"\037\226\224\002H\362"
+	.string	""
+	.string	"\322\021\322\250\210h\250I(\b\350\307\247C\017\007\236\235\243N\016\316\215M\r\315\214k,\022\333\317\320\366\026\315\255\314\334\237\222\260+\017\3014%\203\020\240OJ\376\260\024e\206\254\024@R\237{\270\263\313"
+	.ascii	"\2643byD\334\nX]K@\027\037q\336\227$#\271 \246\304\217\214\n"
+	.ascii	"\364\371\216\007\353\020\300k\366\206\230\022G\"q#$q\271\250"
+	.ascii	"\325\201kEH\271f\"\027\304\336|\350\315\233\254\200-\001\002"
+	.ascii	"FC\026\342\363 \267!\031\250\315\177\332\204d\0375\357\240\346"
+	.ascii	"#\367\364p\016=xd\036\035\276\343X;\374\330\226\330\ns\346V\300"
+	.ascii	"t\2646b\244X\034\b\330\013Yg\007\020\260\264\234\323\n0\230\007"
+	.ascii	"\306\255\2001i{b\370\350\252\221qn\2504\262\215Q\201\033bT\257"
+	.ascii	"q+`g\323L3\303g\254\200\315h\221q\034\233e\367\350\206X\231\033"
+	.ascii	"[\0363\273,8a\322\226)\313Z1J\334j\265\276\255\031\013\314\202"
+	.ascii	"\023\226\325\232\340\0226\303\353\374\b\bXY\316F\005\3428\356"
+	.ascii	"\334\025&\346\355\344\335o\325\235ytwX\n\r\033\302\331\354]p"
+	.ascii	"\266\350\304\24210\231-m\330\255 \035\\\217\335w\254U\007\225"
+	.ascii	"\274\036\032\320\254$\370\020\312\265\245F\0023\240YF\200[n4"
+	.ascii	"\223)91\205\024\312\005\030\230\207\227\035D2C+\344\360\3256"
+	.ascii	"\212\026v\22129\272\237P\264\241+\344\2232\311\361@G\276\227"
+	.ascii	"\353KE\343;\3472\f\343g\036\326\264?\251\227\030\266\200\\\024"
+	.ascii	"\003\032v\263\005\f\253\325\3201h\333!6\213'\f*\303\210\314\215"
+	.ascii	"\346\350\027\025\240fIS7\352}\037\276\376\nkp\310\275\260\363"
+	.ascii	"\325\343W;{y\361\375\306\234\226\237\342\343\\i\273!\253\013"
+	.ascii	"J\203\250\206\033u<\033Q\260ZR(\232QZ\325\215\272\225\350\353"
+	.ascii	"o\017{\002+\270\246\363\325\356\377'2E\214\215\302+Z\2302\bO"
+	.ascii	"\361\335P\035\320\035@_\177q\037\262\333\345,\n\210\322\334\207"
+	.ascii	"\222\023\273\241j\320\037H\002\335\260\331A\255\277\36241\203"
+	.ascii	"x9n`\033\224\033\024\337\255\r\321\367D\013\353\244Lj\n\370\242"
+	.ascii	"\367Z*\022g|\251X\364\304\367:\327`\256-p\356\357\310\332"
+	.string	"\023\f\233\224\333\367\240Vh[\366\256\366=\2479B\206\227\035\314\372\253\366\033\274\350\377s\020+\215#\322\262\254|\210\223c\024g\202\b\\\2430n\362\030\250\233\013}s\243\236\226\177\351\353\317\314\006\351KE\242/\340O\234\361\275\013U\270\230\324|\265\275\316w\360\002\255efN|\267\356\320\023\275\227?\013C\006\\\252\222\023\215\374\201\276\376d\320\350\370Rq\350O\274\247Y\247\207\322\025\262\362\241\317|\2653\222@+\234\261\351\231\326h\261\3043\331\262\020I<\223\215\256\035\361?C \233\217\027\241Bvz\243\367\312H\002\327\002\215.\350L+\013E\027\f\321\257\240\264\255W\025\231l1|\366\252b\306\013d\243f\367\252\342\320{\235P$\340EL\357\306\270_\335\021\243b|\034%\036\356\002\215[\300\215\272Y\t\302\003\340\256E\022[\030p\300\215z\f\022}\231O\313\007q\304\303\177\020\230"
+	.ascii	"\224\300"
+	.string	"\215:\214\021Qr\216`e\265_\255\342\"\036\306B\201\t@\013\334(T\304\033\360\225E\017\333Q\250``\370\2576\nE\247g1\267E+\213\351\237\354v\216U\021\"-\216\243\336\265\201\0335A\311\211M\337\335\201\007\331\273\234>c\003\331\342\354\340\326_u\313e\345\257v\373\037\036\036\036\366\343\350V>9\234{\212\002P\234p\031\334\t8\3466Q\202\304\b\021N'\347\336t\f=^5\265/]6\334<\316\273\264\314\373\343\317\336\265\237\361\323\227\315\372\266\265\025\235x\363^\347!\240\271\335e\213\276\332'\272\206\224o\024\323\324^6@\334J\020\254!D+\212G\257\374\033\254U\310a\224z#\027\275\315\247x{\343\242\177\325&\336\346]\212\317\004\261\266\035\221\2269z\023\337\271\313\006\254|\370:\376\256\270\f9\212\273xI\323\343\250y\2771\267\205\005/\372\232w@\253\020\303\025T "
+	.string	"\302\315\204j\204\251H\240\350\177\274\365\212)\346^#\2012\260\322'oB\322\202PL\247\344"
+	.string	":\373RA\2443\335ki\350\275\327\233\344\277\350u3}\327[7A\021u\220\353er\367:y\351\353D\t\360\267>\3722\311{\2358\321{\367\310\214e\267{,\n\204\212\246{\203\324k\273\302\223\217_\276\247\362\344\360\355\213@\247\006\340\017\030e\336*T^\277\033^\277"
+	.string	"\304\3441o\225+\257\237\337\337\253%\333e\310\200P\320t\017\360\3018\311_\336.o\304\211\227W\360}\b\375b\370(|\013_\302\327\220\3605lJ\023\314\203o\341\373\3455|\r\337\354;\346\013Vz\305\005\0327\2643\335\303\3465\311[\336\303\377\322D\013|\325\366\020r\371\022\004\204\267\262`\256,0\027\226\354\007oIa../\370\213J\234\035\264\252\242\342\247h\n%\f\365\372jy\231\nL\226{\232\024\271S\273\322"
+	.string	"\217\205\301dS`\262$)\231\017\036\223\001\223\221\231\301\3237,\t{\3208\343\317\024\312 \365\372bxY\017\256\272Q\036]]\231\353\023\330F\r\270\332\004\256zH\303\313y\260\r4\270Z\315\001\353\340\223\313\016\212p\307"
+	.ascii	"\220\316\024J\032\365\232\2750\311u\360Z>V\021\364\372\272*\201"
+	.ascii	"\325z\300kH\3405\2454\272|\004V\373\001\257\255\261\301V\031"
+	.ascii	"Os\260\033\320\317\024J\013\324+\374\346F3vI&\002\307e\275%r"
+	.ascii	"0\221,\024\026"
+	.string	"X\367\025\007\033\231\203\223\274\301I\224"
+	.string	"\335\362\0256r\004N\222\244\016\276\253!\354\003!\020"
+	.ascii	"\355d8%'\372]\216\001\316\313~i~\327\315\224\331`'D1=\270\224"
+	.ascii	"\240pb\020xO\017\346s\273\f\004\346KJ\203!\377\200\367\242\300"
+	.ascii	"||}0\0252X\fzP\340]\262\231\022\315\027]\201\375\220\322\277"
+	.ascii	"za\205\033\307\261\016\270\313\037LH\3638Z\340\260\032\326\222"
+	.ascii	"s\3005\270q\254E@\347jv\001\356\"\b\023\022\026\2358\363#\\\031"
+	.ascii	"\322\227\205\303\312\207?O\244\317\207\215\302+>\017\240\301"
+	.ascii	"Y\017\200q\214\345]\235m\344\033\360\227v\036N\f\r\305T\322@"
+	.ascii	"1\225\035\232"
+	.string	"\330<J\375\244\224R>\221H\251$s\331b\351l\"\225\316&\325S\351\004\240\245\226\311(+\247\321\312\351Z9[0\223N\021\240\2223TL\345\024\325\263J\004\250\244Q[U%[%Tsj\305\223\323\351)\n\250\215\355\242I*\271l.}\372Er\252m\027MVN\247\026/xZ)\225|zZ-\247f\032Is\303\323.\232\234J\253\345TP\027\333E\323\263Y\202S\371t\242r\321b)\025%\324Jg\025UR\031\345\266\267\262\204\344\263\311D\352\364\263\005sIE\245|\"\221M*d\322Y\325b\031\305l>!\251\224O\245s\251\2216\215\204b&\247\246\232OH\245\013*$\2253I\365\374ifs\371t*KpY\020\373I%U\225\214RB\315\264\224T\262m\2453i\002\2243\351b\246\237\305~\341\266SI\365LN\031\251\222\316\031+%\024S\002\245\3242\252\351\314"
+	.string	"j\371\"g\204g\322\202\027SUP\356\223\331\\R\275h\032\241\224R,\222L\007\224PM\013\\<Q%Y\350DE-\033hB\025\225\314\245\224r*y\001\324\324\223\261\237\232\226RON\314er\312\351\311\371tj\352\351\346\013\245\323\211\252\331t:\325\310ay\033\177\t\216\301b}\326\373E\374\022\314\266q\034\307!~\357\215\341\363\206\271Q\342\r*\377\344\035#ze\270Q\242\227`\337\210:\302\032\230\276\332\"\246T\254\316\002\216\254<\020BA/\364\216\307$\350\205\346\334\274\324q\311q&"
+	.string	"P\013\004w\304\375jPa\354\303\217\317\377\274\327)\361y!47\301,\\\023\316\270:[\352\360p\356\360\216\305\372f(-\313{[1`P\352A\343\360=\237\357\350\214px\2439\267.Y8,\236\235\347\371|'\003\221\2357Bs\343\222\205\023\032\264J\t \316\365\222\004flIR\232\2779uJ\303\225z\365\202\225\017\335\240nFi\304\255\227\f\372Cp\f\253%\004vSJk\t\005\303\260Z\177\305\006\315j2#\003\344\235\322p\243m\222\254\207>\301\243Z\215W\255%\243\363G\033\337\203\207\316\234\333\224,\034"
+	.string	"_\355\021[\216\236\336(\006\371e\216\364^+\212H\377V>\005/-E\220\276\312\202#\375\323\333\b\261\016\021\314Ac\372\234\367\276!\206H\317\224\235\300\001\2029\372\252\277;\2129x\346\334\364\302xA~\025\232\305\364V\241\\y\330\255\277\361\346Pzu\270\321\266\032\342+\360m\007J\227\330\350\203\351\024\3039-8\337O\375\032\357\216v\036\375\006\202F\250\302\360(U\302\240R\312\314\210\210\214$I:\242\013\020\212bY`3\363\022"
+	.string	"DI\020\204\f\322$I\007\020\254::'r[\302\214-\330\365s\365\024x\036\320\232O\352\242\006`l\203\205[B\r\222"
+	.string	"\210\205\235#?\366\036\272\263\232gm\356u2\223h0IZ&\276\\\037\034\027\\\265\3525\253\253\241\023\242\230\025/D\334\216Po\237pa\034\013J\323F\357\372\373\225\266G\264V1\341XG+i\022\365\034[\356[G\255\336{\233\032\030a\252\032s\fL/\n\354\221/\246\347\223\344\366Dv\177:\022\371v\322\227}F\023\337~*!\233\2105\303\360\rH\230\246\200\233Fle\350\316\032\333\265\211\320m\301\255F\314\337\r\262\016\320@\210\277~\357ul\374\373K\"\357\240\223\273\317\025\351\301\236\200\376J\337\301\3778\363\235Q[\016\202v\214L\036\023\n}\266g\024\263\by[^\005\364\237\241=SL9vp\b\212\200t\366\251\373+>\336\024\267\316"
+	.string	"4\252\n\221\213\222<(\032\030\271\2278\341d\313!Hw\340\272\366\210\312\3454H\335\336\035"
+	.string	"\022\274\177(\231\036\364\335ug\335\237\204F\273\005;\\\246\r\230\204\355\020\301\016\032\200\"\003\024\367\346tH\214k\314\n\327\032\327\274\350\013~ZgyY\244\034\261\317\305w\224-\345\337\013v\024\207DC\237T\3679\242^\233c\030\361w\026\216\023\362Z\351b\222\205\242c\004\243!Y\032af\272\330\254\253\301(\220\257\023\265bb&\007\325\315\r\354\323\210\200Pe\\\t\b\005\343\202h6\264\277\316a\317T\033Zr\340}+\f\311\035\370\227F\376\317A)'\020*\022\226M\251\254\262p\210\031\250\240\351-"
+	.string	"\343b\270g\260\204iH^\325\236\023!\240C\250 \302\204_\307\007\312\032>F\260\226\240\212\306\256\370t\324\034U!=9q|CY\243/\262\004U`N\025F\031 e%*0x!\3640\345\312\005\243l\"i\270Y\246\n\231\340\342\267\203=\247g\263\0040\347G!\301\261\205\236R\200\257'\006h\276\253C\333\341\314\036\240\234\220G\364\377rr\033\241z4\353[\346N'\375\022\214\006\342\2336\322.y\345%\254\341E@\310\f\344\226\352r.\006\340w\322\214\260B\332\030\367H\274'\006\357\006\253\377\353q\205\r\345\214\343\340*\3537?\2146\027\026\377\223z=\350\314vj\315\n`\350NX\370\351\374\2349R\3030\212\226\260\361\035\250PB\326["
+	.string	"\264\303b\022\020F\267*\364n\030&i\272\025\005\343\367D"
+	.string	"\020P\002\034\n\355\t\035\356_\376\351\351\200)OJf24O9Mb=\204\031\306\366\212m\321\251\214"
+	.string	"\351MG\t0\236\tu#3\227\277_\361\263\202\333cL\210\177\370D5\203\232\351~PD?\\\227\260\030 \275\303vk\210|\355mg\022\361\241\032\034\026\322\347Z\016\305<\005\362\211\204\3024\271\034\025\002\274\006\017\002\007\363\nfR9\r\223\340M)I\007\366\211\n\037w\213\306\207\251P\025\035\007\033'^\363&\202s\337\305Q\205\261\204O$\314\235a\351\331\352G]1KJ\235\313\240\271\273\235"
+	.string	"\351\205\365[\026\323\005\035\006"
+	.ascii	"\300>\200\257]\342\224\212\261V\233g\226\007\261\033\225\035"
+	.ascii	"\323\031Z\207A\005\253F\t\300\320:J\345\246v\002\331\355\254"
+	.ascii	"\240\034\213\245\35350o\314\236QW\200\020\317\275Ps\271n\302"
+	.ascii	"\230\366o\031\334\365\325\314\004F=;!\263D\222\034\260\r\235"
+	.ascii	"\201p\323U\203\273\302:\266\351L\274\245\302 C\315A\334\224\275"
+	.ascii	"\177\031:\275\242\031\377\315\311\352\204\347\321-\003\304V\364"
+	.ascii	" ^8\231A\016\304\236+\240P\202L\233\222\300kB\213y\364*^e\307"
+	.ascii	"\242\3151\221\230\311!"
+	.text
+	.section	.gnu.lto_cliDump.322.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"}\b"
+	.string	"&P;7Po\322\001 M\367\363\327P\233x\373x\270\335\002\025\013xTe\020R\030\306\337\020\247\207\341'&\317E\320;\313\250\242!j\006\202\324\264'q\030\204\320nr\247\024)"
+	.string	","
+	.string	")"
+	.string	"\321\236\275\242k\332\r\253ee1\342\262\273R?\356\035z\376K\007\020}\241\303Kaw\rE_\306\255\267=`;\301\366)%$\273\027\253\227E\211' \266\237\261\rg\204\312\301\241\375\220\213x'I<`wdb\332\235\b&\300\036=\257\261\036\261\013X\017\216\320\340\252P\355\007\bx\221\013P\037\206*U\241!{\206\240z\330\307\354\356ZG\366\347\257'\3750\376\324QbI\321x\332g\363t\270\354\3228\316B\207\313.g\233\315\223\311\317\306\341d\006j\220\033\215;\006\r$\035\272\016$3s\217Y\035\031C}\034\252\324\204R\004\f"
+	.ascii	"\357b\310\304\023\277h\300\005=\256\261\2550\036\250\006\256"
+	.ascii	"\200\271\001*J\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliDiff.323.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\205\b"
+	.string	"&\220;9@\3056\035\340-\253\341\204-3[\237"
+	.string	">\\\333+\361\036\276\"\341\r\200\303\247\262\006\361\273*L\333v\t!PTX\fG\340\355%\332\306o\340\2701\021\332V\356\224\002)"
+	.string	","
+	.string	")"
+	.string	"\321\235\235\242+Z\r\352dQ!\262\262\273R;\336\035v\376C\036\360\371\274\303*aw\r?\037\306\255\267M`\033\301\366(#\245\335\213"
+	.string	""
+	.string	"\226\024K<l\377b\033N\b\224\314\241\375\217\203t\017E\\`\027D\"\332\235\007.\260\036=\217\241\036\255\017P\017\2160sU\250\266\303\003\374\307\006\245\217t2Q\250gO\017*\207}\313\356\256\025d\177\376\372\320\017\343G\033&*'\031\017\230'\353p\264\253\302\264\215\002G\273*_\232\254sIO\266\321\344\3051H\r\306\333\002\306\311\206m\343\344e\356-\253 [\245\317t2I\350D\f"
+	.ascii	"\357b\310\304\023\277h\300\005=\256\261\2550\036\250\006\256"
+	.ascii	"\200\271\001*J\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cmdTable.324.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`M\025\r]"
+	.string	"\232\220\260 Q0\330\252\351\325\324\243\205\021\215\0317\242\230\322\206s\201\367D\307\344K\033l>\221\031d\270;\263\333\005\321\253\003\034\261\367\242\332^\251M\260\021Y{~4\340\"<\340\001\332\bC\232\302\003\177\256\017\344\356\017}4(tv<~%\332\242LR\006\024\002\031\002\335\001\347\035\234\302\200T\201\222PT[F\217e\177\021\272\227\342O\365S\260\030\264\234\\\370\n\234\276\270\262\240Q\376\367\212\203\005\n\364\342\t\217\224O\n\306S\331_Eg\245\370[\031\342\324s\362\301\351+\215\020!\274\223\263\017*\344De\205"
+	.string	"N\366\003\241\373(\376R\242\274\260\036\312k\352\311\016T\206\023\025\327"
+	.ascii	"\257d\377\022\335C\361g\362>\274\202\350\001u\302=p\372z\222"
+	.ascii	"\361\020\302\377^C|\240\007@Qq\305\310A\007\376;\374\323\017"
+	.ascii	"\037\031\022t\211\221/\352\007\215\fx\272\bx\"_\204\277\221\277"
+	.ascii	"\341\007\313\006\024\b\r8\375\221\"\344\350g\370 \374kx\032~"
+	.ascii	"\230\310\200\240D\214|QEp\372\363\303\b\237.\031\357\364=\370"
+	.ascii	"\373\370\024=\202\004\247?<>\206{\347\t\265VTY\024\220g\333="
+	.ascii	":\233\005\377\246>6\360\335\342\203&Q\202\323\373E\017\272\344"
+	.ascii	"\177P8\275K\230\240\335\211\252\217\001Upq{\005\236\213\304\n"
+	.ascii	"\264\211\221/\352\tN\357\016(]\272f<\261m\024:[\207\333)\354"
+	.ascii	"\240Q\246\340\364\353H\201R\301Up\372C@\201Z\371\337\025\234"
+	.ascii	"\332\255,\250\275\002Uuu\200\226\034n\3478a\263d[\035\030\371"
+	.ascii	"\242\300\240Z\304d6\333\272\321\3317\3346\301\004:\205V\341\324"
+	.ascii	"z\221ei\260\001N-\021m:\370\337\0078\265>\200\200\312\320\252"
+	.ascii	"\032\203@\231m\315\350,\032n\325\244\ta\004\234Z$gH\300MM\251"
+	.ascii	"\t85eJ\330\370\337R\r4\347Tu&\201$\302p+\006\013\005\025p\332"
+	.ascii	"\002\030\0335\234\326\260\241Q\300\252\013\267W^\222@\234\212"
+	.ascii	"\300\345\246qzA\016\265VUi\26045\361X\300\302\200\331\227\325"
+	.ascii	"\262\255\224\316Rqk\304\350Bn\372\301#\203*\022\2338\2451\225"
+	.ascii	"\303\310\027\325\324\224\352\300\351\0022\373\252\366\005\230"
+	.ascii	"}U\030P\330\255rc\025gOS\023\017;\203}U #\265\026E\005DydjN5"
+	.ascii	"\377#\022\363\204\336\260\232\272z\254}\307\350n\031~\315(\221"
+	.ascii	"\204\211\256dd\316$JpJ\304D\214\215\377\021\345\260\004\215Q"
+	.ascii	"\300S\024[>\251\353\005\t~\223\370B$\344\352\264c\344\213\032"
+	.ascii	"\242\003\225\346\347N\355[\245\273[\370\265:\342dr6\301\351\220"
+	.ascii	"\034#\320&x\bKF\225\364\277!/O\320#\255)7]\257!\366%Bw\261\360"
+	.ascii	"[D\226S\017\036*\342\312\t%\nN\207\212\310\254\344\370\337P\217"
+	.ascii	")\350\r\250\2517X`\027\312\276Qtw\n\277Tn\020BzdRN*g\025\234"
+	.ascii	"\neE\235\\\377\023\022c\005\275iM9\201\005\310\207\373\003\277"
+	.ascii	"N\232\b}\22119\263\214|QBQ"
+	.string	"\256\314\271;\354\353\323]\036\370\355a\211P\023%g\026-8\r\312\"\311\024:#\306S\035)\237T\254\310\276Ft\367\b\277Hr@\217\340.\034\266d7\234U\377;\267\3404h\212\025:jM\355\351\n\2725l+u\207\bA\217\030\371\242\202\236tA\255\325T\037,B\267\307\276>tW\006~\201\314@\342 \036\356\217\240 \262\264\203\377\305\362\234Wh\214\243';{|RC{\366g\241\273M\374\362\270;b\\}\316/`p\032\203\303\007\205\377\305\326`\241GPTXD\\W\360\307\242+\366\005OL\3129FLQ\024\373\353\350~\n\376T\334\2119\261s\2261\203\323\230\r2)n\377\213\3558\321\240i\241\265_\216\356\347\360\247\363\303S8q\252Y\203S\314e\013S9\333\250\351r\361l\366\273\321\375\033\376\217\243dYg\026\0238\305C\332\220\377\303>N8\350\f+*7"
+	.string	"\230A\303_M\032\240>g\320$F\276(\240\255S+\353E\022\373\303\350^\f\1772c\200\262dX7\f\024\006\314)g\016Nal\350\240\266\212\025UVW"
+	.string	"[\366[\351\276\013\377+/'\024X\n\234\302\310\310\270\240@0\214\312\021\247\2358\220\334m\020\227\231:\322\214\312\324q%{\336i13\365\002\352\253\226\343\250\244{\016E0k\034 \351\"i\250\352\033\330\313,\216\2734o\232I\347\256wf\250\227n\344Q\265\361\270\031\326r/\363\306\222\314\275l\243\221f\036\273\216\\\326%\270\233\325r\331\301\222\224\325\001\352\213J\003)\227\260A\ny,\263\004\271\354#/\363\261\343\300\022\f\363\016\334]\223y)g\216}\251$I\220gA\265\321h\320\240\021\356R\223\272\367h\343\0267/\3672\234\365\2648\212:\034\371\254\226m4\tB\023T\232\3252M\202p\317H\250\260J\2168z7s\033'\2167"
+	.ascii	"j\251\311\237\232\023w\251s\"\270tkQm4m\356@\0343\fh\232\203"
+	.ascii	"\342\254\006@P\315\232\247\243\314a\007G\245\254\227\312\\j2"
+	.ascii	"#\345R\347\024\2506\335\315\022\024s\233\254\r\001U\322\034\252"
+	.ascii	"$\254\222%X\222YG\202\245\013\\\305q\223]\343\3109\306%\222\250"
+	.ascii	"\336\"\330\273\033\222\270A\216t\353$R\0040\352\310\323\035\251"
+	.ascii	"\034\307\216$T\355\026{\204E\302~\261c,\031\273\204]c\341\330"
+	.ascii	"8\366g\351\330;\226\n\333e\261\370\035\317\343\177\274\f/\344"
+	.ascii	"\207<\016\177\344\223\274\357\177\370&?\345\203x\"\376\312W\275"
+	.ascii	"\021\217\304\177\3712\257\304/\361k\036\316\307\371'\036\212"
+	.ascii	"\257\342\255\370<\257\347:\335\030n\220K\303%rm\270:\334\247"
+	.ascii	"\013U\301}r\201\270B\334*W\313\225\272\\n\227\013\346\206\271"
+	.ascii	"g.\232\233E\301\2253\301Y\344\347w\337\354\333\204\356\306\341"
+	.ascii	"wK\253E\0208("
+	.string	"\021\\d\207\211\323\310\377\216\340\264h\b\022\324B\261\232\272\302\222f\337%t\227\r\277n\332\024\001Ys\303\001U\347D\260\337\b\301X)j^\222\346\215\020\264\321\272.E}\233\325\312\233\336\351\233h\3424i\212&\013\225\311\004\177*\251\303\361\266s\343n\226i\241\250;X2\231\340,\323\036\250\260J.\335JP)\203\271\217\b\324P\324\2717T\231z\022\2564DX\341\204\032\271\217\031\204\022j\344\025N\310}\304\205\342V\332\345\0267\003u\247t\007\2506>\366\032\254&\t\325\235\016\307\006jD5f@\265\365F\261VTM\\\b\216\273\214\202\007\034\344\261\024w\226Qq\270\035\276*\251s\016\324W\315\001T\030t\007\225zd\2713A\234\016_\3106\335\301\034a\007\227zd\257\327uI\202\274FA-7\223~U\\I\215\243A0\213\005\021\225\344\336\345~j\326;%pw\020G"
+	.ascii	"\325V\003\252$/\327\202\344\345\362\321\253\362vz\211\363\361"
+	.ascii	"\226\311\035\302\250\266\234\270{I\346\245[\0075Ys\341\242>P"
+	.ascii	"ma7M\021\344\265\027\225\007\362\237\332u\330\307[\227Qm4\036"
+	.ascii	"\310g5\\\303\235d\3368P\355z\267\033{)\216\267\261\3376\307\215"
+	.ascii	"9\334G\025V]T\032\0167\366v`/\334\275k\034c,\210h\247C&P\334"
+	.ascii	"|\226i\232\304\341Js\234e\332\316\344\2750\004{\245\336"
+	.string	"\263\254wfw\241j\246\315cyF\215\005\021\321\372X\336@\\\326;\360F\3162\2554y\342\316]3m>c"
+	.string	"V\373X\216\274\324\271\242Z~QC\321\034\311$\035\340\216'\204\207\252\336m\334\330y=\353\234Q\265\321\230t(\356Y-\250\2168q'\275\330\201`\327\2741\347\304\275T\216#'\223n=\313*S\007\252d\201\342\250q \3149\246F\204DJ\222$Y\016\201\005\304(D\331\235\007\021"
+	.ascii	"9\245\2341#M\332\f\300\251E\030?\221X"
+	.string	"MUN\276\r\203\212\250q\210\330\037\305N\345\246\230\343cb\314V\344\340\256\311\373\376~\024\263\304\204{]\350\306\267\001\247\353\223\302\003}\026\260\352\274;\0372\353\250`\342\2257\324\006\360\317\241\365F^S\n\303T\306\217\360wq\205\006\nn[\335\020\236\202\364\256@\003\f\217i\333Z\215-\226x}\027\233\333\343\340\360\322&D\r\212\330\322\022].\261\rb\332t\350N\271\362\362\177B\340\024\223\201 1\033@\364\334\240\222\240\215\225(\310\352\321\263\333\231i\325l\n\257\365\326\026T>\325\346\216\332X\b\244\313\200Y\214\031\t]Po:L\337\355\254\222\223\355Qnq>bS\022q\031C\006y\3403\320\027 \020\b@\306!\315b\017\327\bu\250\201\204%\0138\320\241\317\327T\223d\026\"\177)6\021\007\023\262\002\034\300c\205\003\276\255%t\300(z\002\307\313\013\005\037\177o\"\233\335"
+	.string	"\357m;\\Z\026\261\r\n\352E\277"
+	.ascii	"\247[\270U\256\201\307\354\257\326Y@N\303\301\006G}\304\244\237"
+	.ascii	"\200\317\025\270\302NC\030\260O'\271\231\274\004\255\030\030"
+	.ascii	"\317w\034)\377\341\263\374\233\230\217_\023ZDFc\327*\025dG\333"
+	.ascii	"t\230tm\242N+\236=\025\227\222\224\351\2069\344\210{~\227\224"
+	.ascii	"\210\220\225Xj\307\232B\366\022\2148\316\213`\217`\313\215@{"
+	.ascii	"c\0364\250\341\304\346-\303\312\233\365\240<\273y\236\305\340"
+	.ascii	"\330s\236Nz\242\324\364\013\274f\n\372>\240\220\271}R\311\377"
+	.ascii	"DW\261\020\"\254k\346\345y\023L)kh\023$\2646\202\260|\2373F\213"
+	.ascii	"\371\327F\336`w\031\233\313\274\267Qj\240T\341\215\314\207Rq"
+	.ascii	"\255L!\240h\341\236\311%w\303\f\023\217\211+\3127\3073Ai\301"
+	.ascii	"\335\2337l\363&nv\271\311\200\277\016\337&\006.]i\341\356\220"
+	.ascii	"d jv;D\205\230,\366?\022v=\323\237\301gQ\027k~\2462e\222\363"
+	.ascii	"4\241\374\035\317\246\323\"\r\352\371\232\347\341\241\326\350"
+	.ascii	"<\024\250\020\025\\\rd\277\364x\315\020\307\331\f\016|\037c\322"
+	.ascii	"2\216\214\033y\302\\Fw9\336\313\242\345\3000e\354\307\245\332"
+	.ascii	"8\322Rga\264k\311\304b\f74Q\340\276\202 \265\340\\\354=\210\356"
+	.ascii	"B\007\341\2242\020\336&\013\336\240\261\037l\336\306u8\366\345"
+	.ascii	"\242\021\253[\376\314R\351\215\023\222\334\323\300\\V\331\267"
+	.ascii	"\036c\307x\320z\266\314\270l\276\300A\220`\320\360\336\241n\364"
+	.ascii	"\355\272\357=(,\310\302)h_9\027V\177Ap\265\356\306\314\354\370"
+	.ascii	"h\361\027\004\372\245\"\310!\225\315\366k\225\211vf\203\3216"
+	.ascii	"\022\3303\252CZ)\206u;\003y'\343\025,K`\366\271(\307\210\335"
+	.ascii	"\363x\233z@Xv\006\241\233\324m\351\030\2162\235\241F\263\036"
+	.ascii	"1R`\212jq.\032M\327b\b\220\315\034\202\223\222@\033\227K*\236"
+	.ascii	"\260R]\004,\376\314\002j\t\247\307\367\262\271~Z\024\333\013"
+	.ascii	"\261=\356\032\255\207\354FZN\234\336\266?\363g\245\006&^M\033"
+	.ascii	"\330C\364KCP\330x\002"
+	.text
+	.section	.gnu.lto_cliHelp.325.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\373\005\205$"
+	.string	"JA\230\016Gp^U:\361\3418\212\353:\205+\306{\006\\%\314Ok0Y\330RE5\021%7\263\311\242\357\033\261\233\025\215\305\317\200S9\324\201\340"
+	.string	"\350\232\234{\226"
+	.string	"M\321'a8\013\326\3550\214e\321\032!d\357$\003\326"
+	.string	"\306"
+	.string	"\334"
+	.ascii	"\316\257\234Y\007\215`\366\264\331\003P\237\316~S\237\266\257"
+	.ascii	"[\016\316_9\210\332&\245\262\354\3119\353\360\221F:\312\276m"
+	.ascii	"\327\367!\241  \333Z\243\315dj\212\342\353\353\3134\240D\224"
+	.ascii	"\355RlK\361\367!\344\205\302\210BnP\023\"\022\305-o \214\230"
+	.ascii	"u\201\320\227\231\302|\0301\b\212\001\311\244\362&\360\332\214"
+	.ascii	"\030\261\276n\031\257^\263:\315\352\316\033hB\004rg\006\266\214"
+	.ascii	"U\227\241Gm\324@y\030\261\n=\2005\204\313Z\224\272\352\303\210"
+	.ascii	"W)z\003\322\345MP\221\007\332\340\215\023"
+	.string	"\253\265(\274(\272\200\016\030=A\305 \n\300G\222\341\235\277SE\341\305o^E\024?lrl\313\210\365+\323\220s\356;,\032\337D\357>\207\356\336u\247#\002\352\323\213\237u\365\347I\026WW\324m\357\227\250#jP|l(\365\370i\t'x\371\264\354\336pw\017\307\375\360\370\316\023=\347\214i\215\321\t\342\037\266\203\305I\030\214\217\335\354\357\002U\351\222\244q\221n\001F\357\372\213\316\376\267ky\333\326_y\327\360m\332o\317~[\366\333\352\275\235\3766zo\343\337\276\370\366\007Th\367$\2450[.,\306f\037\255\237\f\226\206Qr-\377\025g\037K\277\331\353\323~\2263}\327\222\003\315\315\034el\020\305\017\233a\366\024\207\376\313^\033\302\004\337\257@\241\271*\377\352 \210\322\207NrO\316,\203\247-\241\373\262:\236\r~\273\237<\227\357];N\224s\221\317\241\332\260"
+	.string	"\374\346\211\022\264Q\272\001\2121\263\200\267\275\353\321\355\006!\342\210\252\275\003\006\304\277\332,N\21044|d\363\031\211?\305\336\314\364\214\315\002\\\031\376\226\273I:z\346,\374\360\304L\270!\227b\205\002\252\266\f\030\017\374;\037%\220\211\214I\225\2011\021@\256\341\rx\252\221a!\2402\317\224\242\253\342n\026-\356\207}A+\210\206\t\301\363\f\257"
+	.string	"\322\214\212o\274j\265\262\270\260\230\244\225V\305\3070O\361\215\240)f\341\342d\230\034 \307\360rO1(6Z*\305\306\332\215\325\221M\361\261\257C\305\370[C\367\206/\356V\332\335\0171N\241\305\003\377\272{\351_L\271g\316A\n\335\035\343^\274\004\310\234\203\026\274\374\313\f\364H\236v\223\223\372\241S\235\353!\345p(\222>\340Rx\b\321A\305\206\022\270$\023E\335C\242\325\200\324\356!\341\034\340T\336{K2v7\224J@\325P\252-\325\340\321XjR2\001\243i'\353\335\003\036\215\235\256\006O\251I\267{\352\351\036"
+	.string	"h'\033KO\272\033NNO\272\225\315\307E\250\332\026,\n\003\207\016\334\033>\226\343\361q%\360)g\302\244\334\323\"\334\275\241C"
+	.ascii	"\252\266\017\230\020\377\372b5I\"\204\217mD\223\263T\323\274"
+	.ascii	"\251\nBm+6\302S\\N\303/hD_sZv\t\020>v\004*\253\200\377`\266M"
+	.ascii	")\257\333S\215\2565\374\345\337\203\331vIy\335s\371\212\247\220"
+	.ascii	"rV\326\330\371\335i\363f\177Gs\316\331\206\217}\347\217%l\327"
+	.ascii	"Hy\325~(\265\321t\3055<\325\375o\250A<\344\0243\310\230\210\004"
+	.ascii	"\"\"i\322\034\220\002\031\252\262\016\020H\247Dj\222V\0033\300"
+	.ascii	"G&Fp\217\226/\307n[x\250\273\033\305z#\340\025\373\207\247\230"
+	.ascii	"\225\2207\214}\246\344\253\372L\212\245)\353G&Z\240\022\037\f"
+	.ascii	"p\356G\"\350*?\032\016I\024!s\370\330\354$\216\347\331bK\"ir"
+	.ascii	"?l\322:\2212'\305\030\260\217\262\273h\315\207\2751\310\236\251"
+	.ascii	"\241\251\t0\366\324<\313\333\203\327 \3437\365`F\303W\274I\276"
+	.ascii	"\036\023\306\367oT\324\2140\367d\227z\ns\245*\311\202#y\002\267"
+	.ascii	"*\330\262\220\214\203\224\366q\332\307\335\213\364A\0320\021"
+	.ascii	"\345\362\341I\300Q\302\013\236 \016\377\177(\276\024\332p\223"
+	.ascii	"\005\361\242\265 A\213\342\276j\201\240qJ#\347\340\211F\377\251"
+	.ascii	"Aa\275S\001"
+	.text
+	.section	.gnu.lto_processCharacter.326.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\221\tE7"
+	.string	"j_,\025AP\246\326\030/\370\337=\034@\314}U\251\210c'\035\202\255'E\206MR\270O>\361!L\020\254\251\370t[{\020 \002\356N\323\301\225\035\236\214\263\370)\241\203\005\240Av\257$R\312\224R\nD\001$\001G\001;\242\224?\336$\223\fO {m|\357\373\326\240WN\360\326F\266\327\266\213l\257-dfw\346\b\024\334n\353\301\377\276cl\312\274o\326\003nj{u\231\365\374[\346\025\3735\201l\311\361\275\357\013\365O\234Z}k&r\373n\017\020\020 \351hD*\036\031\001(\"\016\211\204A`\373cW\365\335\345\0166\261z\200"
+	.string	"5\002\230\346\230\341\025=i\235\306d\363"
+	.ascii	"\3175O\242\342G\266)n\374E\035\027<\177\254i\353#\363bk$u\251"
+	.ascii	"\211\222\276Nc\242\251Ln\360\266\244L6/F\351##2/(\r\240\245\314"
+	.ascii	"\2634\246\231\027\251\255\3469\327R\246\022U\203\331\034[C\303"
+	.ascii	"\234x\300\211\327X\017[\312\024Kc*q\242_\024\264\273\013\332"
+	.ascii	"\344\302\207\314k\254\205QT\2464f\022\017\n\233[\016T\037\016"
+	.ascii	"\252\246\245L$j\006\267\265\263\206\353\003i\314#\336\376\242"
+	.ascii	"\234x\201\365\317\301\232\375\352U-\036\tC\207\330\324R\035\320"
+	.ascii	"QC\322p>\\U\031\354\231\td\0242e)lf\371K\231RT\246\367}\333\255"
+	.ascii	"\235\253\251t\377E\275\357\313\276lz5\023h\346.\304\314S\314"
+	.ascii	"m\204\353;\231{\007\273\364\026\302\344\312\222\034As\032\226"
+	.ascii	"\033\315TPN\224\314\332\373&\353\372\f\nn\264^Y\305\324\024\333"
+	.ascii	"+\363\n\026\336\313\245\357\274>C\366"
+	.string	"\372\366|<\026\0339s\013\027\336K>\322E\226\004O\371X\\A\352\006\212\372N\356\033\254\372\215\345\337_}\365n\213\310\360\177\225\343`\367`\225\336\377\357\266\352\224>\355v\026\242\003\362\357d*\266\377E\234\235,\037\304\334_\032\f\0257\032\307\220\341\275\354\225[\306\267[w\020=\260\244O\231\337\260\374\235\314\355t}_C\370\2330;5!\350.\315K\335\326\255\324^\232\217FwFZ\235\213B\347#\241\263\021\353\\\004t&\006\235\207@g\242\326Y\270:\007Wg\340\352\334\366\\\363ouf\177\316+\353\254\262\316\317:\373\352\334O\027\204\224i[\2036\227_\347\355\0252-\364\342\255uT\332K\367\\w\227~\3468n\271\206\262pN\207\277A\226\274Gc\320\246\333\036\204\326\013\231\203'\327\202\266\267p\303\261\260Wn.\375\346v\227\337\320\016\241\214\322\351\333\222\364\351\021\032\235\032"
+	.string	"\242\361\231\310\370\277\347b\225\330v}uD\213\250\351\217}RMf|\307\274\337\233\b\233S+z'_\2002t\372\325\216\2207H\02503>W\264\001IM\310\343\366\323\177\\.\352\006\251\366}\265\200K\232\363\260\275\032\337\331\342\336d\371\240\266\353C\003C|g\2215\276\323\023\315\236\\S-+J\237\272k\201\036\3723\264\353\246\3574%'\372\216\366\336\324S\336\036\366"
+	.ascii	"\302{\331\364\335\\\342\203C4\236\021\355\373fU\340\276\223\242"
+	.ascii	"D\243\351`{%z\003r\242s\236[\304\004\302\003%z'\222ef\032\235"
+	.ascii	"\207L2\253\323\320F\241\214\336\361\375!PE\212\235\360\235\354"
+	.ascii	"\300\366\037\257O\0218-\367\002\026\370\\\300;Q\202\357d\246"
+	.ascii	"F\262B\275,\0374\243\345 \333\367}-H\205\377tVW4\235N\247M\305"
+	.ascii	"\266\037\374\237\030\255\261\227s\007\016\f\360\235t\335\276"
+	.ascii	"\223\305i\277H\031\265\353\003\353V\337\367}\333\340]\343=\227"
+	.ascii	"\202\226}\222\377E\254\211\335\217e\337\315\213Y\366Y\237=\224"
+	.ascii	"l6S\355\232\245_\377\250\214\242\211\2533\207%A\024.\202\002"
+	.ascii	"\254\300\204\210\016\037\0240\2558\221\202\311\001\007\022\033"
+	.ascii	"F\214(!\305Db\252\004\211\020$T\024`\0349\254lT\2610jP\375\r"
+	.ascii	"\033\310*\034V\310\237US5S=U\321\240\202\262Q\345\242\006\024"
+	.ascii	"\325\325\r\250'##\255b\\A\341@\"\257\240\204o\357WG%_\3715@\202"
+	.ascii	"#=\263\233\304\025c\312z,Vz\244\207\361\024\002\335:\224df\036"
+	.ascii	"n\004i\364/\247\263\260\244O\271\350D\226}\212\337|\317\256)"
+	.ascii	"\006\350\232\032\001m'N\357\tK\335W\200~\013a\320,qz,\347\034"
+	.ascii	"\323&\tNW\261G/\325x]\305\032\375\321\267\326\230\322\033\375"
+	.ascii	"\257{I'f\345\250n\t\203\252\305\335\025\371b\3233\272J\\\b\350"
+	.ascii	"*S3@z\247\013\351\235c\272\350\257\234\313\203\334p\231\270e"
+	.ascii	"\336K\267\214\355\265\350\177e\321=}`\017\334\337f7l\203\356"
+	.ascii	"8\3771\205d\346[\356\023\367\254\354\211\247\365Xh\305wr\177"
+	.ascii	"\361,bY\024\017\337\237\244O\217\030xG=\351Jq`F\245\325\302\240"
+	.ascii	"\240\327"
+	.string	"\216\372\353VYr\325Z\255\t\n\334+n\026b\331\030\236\217\307\002fI\313\214\020\370\361\211\317\303g\024\206F\020?\301\231\226&\344\272Y\r\003\200\273\250q\030\206\230SJ\241\221\021\021\222$i\f`\002\221\241\253\342\001\020H\207\204F\222$\035?\244\200z\031;\271\343\305\244fb\222\337\210<\242\343t'+\270\255P_\213\270\216D\003p\fw\301d\363\204y\223\346.2\032A\302\240\301\322\3172+h\260\222\316\034\003\355\0212\177\232\\\302\264\t*<\212\017c\254\231h?#\240\331\3160\370=\222\302:`\276\200\2642Bw8\261Q\244\310\036j\246\013\375\216\220\334s\3231\031\3219J \321\315\361\353\004\344]t\257k\\\260\027\303\026w\tQQ\372\234\030\345L\177\b3\352\365\353HWG\325\r\333zP\314\275\032\005\276c\251v\304\021\317\"\205\n\264Y\325\303D\201\2168\226\225\354\257"
+	.string	"\2538\244\360\312O\217\222\315\353\263\327\243B}\301\207\264:\250\003\315H\236\343\334(I\352\023-2\332\001p\027\007\372\371\230\340\364\030\267\367\017\215aV\300\373]\356B5\016\346\241"
+	.ascii	"\365\"\241|\352\266\275\305\315@\036y\234\272@\371n\327\213\377"
+	.ascii	"\350\316\243y\366\334yw\371D/6\316@\221J\322\340,$\264:\330\370"
+	.ascii	"Oz\361+f\006b%d\347\247X\237`i\"\326\207\213\244\2503UOT\017"
+	.ascii	"\355B\027\312\330a\346+\223\n\337\231\255\303ow\ffv\311\236\022"
+	.ascii	"\326=}d\006\035\250\250+\316l\263\214po}d\226\241e\240\236:^"
+	.ascii	"#Th8\243p\214MyZ\221\331\301\210\235Gb\373\017\013vF\250\324"
+	.text
+	.section	.gnu.lto_processCharacterInteractive.327.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\022\rUG"
+	.string	"Jw\264\032A@dR\007\027\006\261:\020\252\333\tBq\260\0329P\316j\301D\207H9QR\032t+\311\307\205~H\375\351\343\004v\300\016UU\262\345D\"\200\347\354\343\\\240\275\237\003\264F\366\336{'\231d\234\001\177\001\234\001`ol\177\363\354f\300_\035@\366W\351F\330_\327\213\260\277>\334Z3p\300t6 \372\347y\214\017\335<{!\320U\262\277L\255\375\374L77\211\277\016A\313\374\315\363l\365Q\366n\222g\243&j"
+	.ascii	"\356\272\271\026\276L\247\232Z*\245\242\222PONML\310\243q"
+	.string	"\251\250\224\204tdTD\254\032\n\203r\f\277\356o\246v\341W\227SM-\345\340\266\322\225:s\002\350y\3238W\031\007\017\352\327\351\333\226\212r\257\204\374\211y\3364\214K\f\204\332\361\353\264m'\211\332*\232\2762\252\234C\271Xg\3464\361u\233\305\257S\266\375\004fm;\311y\331MXg\332XG^\361\243\033\0139b\305\363\246V\\\254@@uT\266\021\n\265\212/\305Z\332\352Z_\031\265\212\027\257(y\336T\212_\247Sv\022\264\332\244\017\nU\314\221\216\332\352\224\2762j\232\037\241]\247N\266\021\232\253\274N\307v\221+\001\214\2274\317\2336q\177\214\326\316\343|y\235\246m\2427\305\274*o\232v\235\316\355\241\353vX3\2367e\342R@3\363\305\343\274\266\020\n5\314\203K\331=\200G-\314\363\246K\334\342\2229<~\235\202\355xI[%\322WF]\342\260["
+	.ascii	"\220\032B\306#V\242\303\257\347~\215\276\240\303/!\333\215\265"
+	.ascii	"\342\334\211h\253\321\2762j\230\177\336\364\213\253\234\347\331"
+	.ascii	"\301\370\226~9\367\216\265\346y\326;\372Eu\r\300\265\336zZ\353"
+	.ascii	"\022Z\013\353\002O\204\004\302\006\034~'t\334\356\277\357r\376"
+	.ascii	"&\205<\317M\217j\267s7'4\212\024\333\243)T\254\330\036\205\337"
+	.ascii	"\253d\317\357\322Z\263p6.\344y\366z\240}\r\206-\231\312\017\330"
+	.ascii	"\337\367'\354\2655\367V_\275\373\356\031h\242\346\336\272\003"
+	.ascii	"\226-\331{\271\340\253'!6w\345\375\310\250\325\271oM\343t\\\332"
+	.ascii	"\251\350\0302\266G\375\325.\003\366\367\352=\316]6bsgc`\300\232"
+	.ascii	"EksV\376\255\332\007\374\377\"\313\347\265\003\365~\377\377="
+	.ascii	"\007\212$k\377\227\201\006\035\b\\\340\375\035\214k\320{\333"
+	.ascii	":\363h\353\234{\253\265[\327~\253\326\356T\bL\216\3763\255\265"
+	.ascii	"\262&\\9\233{\201*\252\251\245\322\305\270\226\212r8\327\311"
+	.ascii	"\2755\224\227q\375$o\355\344Z\327M\362\326L\362\326Hy\353\343"
+	.ascii	"\336\3328\334zI\270u1\336ZI\336:I\336\032I\336\372H\270\265Q"
+	.ascii	"\274uQ\2745Q\270\3650\336Z\030\334:(o-\307[\307{k8\336\372\205"
+	.ascii	"\267v\337\255\377\335z\277[\273\005\267c\250\253/O\314\217\374"
+	.ascii	"\231\347#\333C3\336[w\305\305\270\227q\327\272\303\271\253\265"
+	.ascii	"k\355m\332\307\270\031\177\3638"
+	.string	"=\204\373\241\354J\232\3473,]\003\3556\373cs\203@\316:\031\246\227\371\241\345\03427\255XX0\267\001n\262\3660\356\306t1\\\356\37467\251\003\260\001KQ\333\345|\233\001\271A~b\t\350\360a{T'\215@\031\204\347\365]ZX\247jW|\253~\372\246w\276,_\260\231\207\215\222\032O\372\035\207\222>6\203\223\203MB\n\334\343\362#\375>\303.\3113|\2555\016\377\253\221,\264\361\260a\177\242~|\206\240~Ho\325\356\233\237\332\235\221\374L-\\P \244\023\256\215\027\245\327\200\265\326\"\034P\r)\264y\236\261\376X\241\t:\372>\036\365s\347\202\231\376\350\267\036lX\232\347\230so\235\325(GoE\344\\\260\374_\226\235\363`[\344\214\021\020x\370Ps\210\372$b\022V\364V\243\037\276_\2630\200\030\021\277\350\343;O-\316<\034\210\017!\255\255\351wh"
+	.ascii	"\321\356\002\366w\370.\rk~\374\302\367\247\026\371\203\357z\362"
+	.ascii	"W\355\2015\367\266\016\210X\204\036\034\032\3006-(K\034\022\342"
+	.ascii	"[\265{\220\313\230\262*!\325?\t\227\337\364\322&*1v\360\324\t"
+	.ascii	"\244\207e\350\006\247\376\016*G\025T\276\224\266:\004\232\346"
+	.ascii	"\245\020\370\202Z\377Jy=\242\304\021-\371R9\277+\221@\317<?\345"
+	.ascii	"\370\234\020\356\210\022\362<?\203d\256\373\300\376&\337\221"
+	.ascii	"\210\315M\311\312\361\332\201\356\374V\275\343\244\022\235\237"
+	.ascii	"\332\030L\365S/\325n\274,\272\371eI$'_\273\360\362\225/\325Z"
+	.ascii	"\351E8\371Z_\364\207\005\263{jq\356\355\016\276U\037\352\233"
+	.ascii	"\373\344?\253\363\345Zv\357\311\314\252\270\211\335\261\371\313"
+	.ascii	"\266\256\013ZV\312\256\346\260 \302\002\025O\036\030\250x\032"
+	.ascii	"j\327\037T<\t\213`\0307\266\276\307\016\027=x\350\200a\340\210"
+	.ascii	"\241\303\235\341[\256\267\022\314\260\261e\205c\206\213\033V"
+	.ascii	"[;xX%0"
+	.string	"\352\034:b\354\260\352\221#\307\016\253\241\333\354\177\246\265\232\357\364;*\005\033\352\265f>a\232\025x\250\207\201\035\263s\001\277\236SfL+2\212\374\f\021%\f\236\017r\255\265\207MV\003\351D\026\344\364M\334AQ\277\355v\273u.\030\371N\357l\330&\205\034\216\030#K,14\205\262|o\022* \345[\365\366\217\360\210\031!\251-xN0f\232\021m\212\374\254\240\266\337\334\310E\275\225\202\030\2320D\273CnI\002\333\3336\222\024G=Uo\333_\314+Kz\230Y\344g\026S\215\271\245\311H\024&xB\276K\353\245\361\003E(\273\007\317\301\243\344\t\371A\262{E\220\036\234px\2548\021\220\302\224\365\332EJ}\325K\365\037\377\302\335\226\036\337\230\006\346\256\003\267@\3654\355\361\252\317\372\215\206\025\263{\216\031_\271\364\306\367>\305_\342\262\207\324\2207\264\370Gzpw"
+	.string	"\353\232{\273\371"
+	.string	"\256ua\372\363\303\0329\272\032\337t~Y\306\224\256^\352\245\332\221U[k&\226\271\266\305s\036\343\034Ati\302k\267\330\364Q/\325\377\364\373\232\245\243\353\344\211cb|+\034\217\372\t\377dX&t\236Z\226;\350\272\r\25453L\005#(\201xQ[\351M\220y}\327\356\262\240\364Gfpw\330\267{r!\023\201\024\250q<\244\020DhfDD$I\2224\006\321\004\3040\t\251\\\017\021`\275dV\322\264\033O>\300\313\361\2733\341\033\355\310\020\234\263\022\237\003n\206\336C\323 \023\261G^\370\366\013\210\003UX\226\220\n\227\267\3473\207.a7\f;\362\324P\021\344\033\341B\360N\377\177\013\365\3130\003-\336\210h}\244\242&\340i\352\350\372\357\0340\251\325\354*%cKb,]\244\265\005'\353\377\nu\304=OG"
+	.string	"{O\214g\n\207A\032\313\006K\200\232\370\217\200\302\314\240\342\361\373\t\325\ty\2145Z\356\223\370\210\370\347\270<\366\017Y\226\207\265u]\325\021\035K"
+	.ascii	"\n\363\314\263\251\025\004]\322h\260\210\235\023KT\001\315\325"
+	.ascii	",\3103\017\340\275\252A\226\341L\277\366j\231\260W2\240\307/"
+	.ascii	"d\3579\321\031o\310`Y\315S>B\372UY,I\263\345\342\211n\350=I\217"
+	.ascii	"\231:i\201@\274\213s<N\004\302\253t\245/\3328\017o,\201\370\001"
+	.string	"\242pt(e\033+h\305 \232k\t\306-,\377|\2473>A\206\202\341\354cY\030\337}a\242\231QV\263\227\325\007\373\226~\"\354\317E\372\310GE6\266\034:Th2P\270;\030\254\004\376\346\352\205\266\244\253\024\210\004\035\037+=\321TO\335P\264\376\350C\177*@|U/\013t%8\247\030:\306\241G\305\241\027\243?\321h\032\"\204g0\002\343/3o\037\356+OD\233\246\351:\201\346\3446E+\212\214+\0300\200\242>\277\275\377\f<H\225\\\026\232\302\025J\204+\262`P\353Tf7\322p\310#LJ\"\331\362\371\033\255u\005\207\200\277\337k\022\004\020<*\221\360\302\366\302>\323{M\020G"
+	.ascii	"\350\302z\0266\332\261\226\027\261\r 6\327\332\310\350'\237\313"
+	.ascii	"\323\376\353\003\r\321n\372\216\020\027\037\350{\200\312\250"
+	.ascii	"\330d\2063@M\2721\211\227\225\274\3518\326\304\236,\315\220\265"
+	.ascii	"\243\232xlJ\210\307\034j\316%.6\207e\200u\233\212\202\344\251"
+	.ascii	"\275N\317\304:V\034\215\216\366\007"
+	.text
+	.section	.gnu.lto_cliProcess.328.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"u\b"
+	.string	"\022\01799@s\322\001\320\267s\006<us1Z\365\340\203K\261\2657\332\034\017P*\253L\265m$\351\365^\021\240(tLrG\371\002\20146\337\375\b\236\243\0355B\210\224)\005\336@\234h\223\234h\223\020\034\303\203\334<\t\t\"p\027\341\340\311\211\256\363\344g5\037*\255\t\323\324\246\250\320\207\336\005\023J\\9k\222\366mp\3019\251\313\376\312YH\276\211-F\372\360\231?\322\236}\257\372B\212\365RA\225t\264W\240\356\210\f\314\307\216W\304\276\372\231\001\rJ\013\310C\30697\306\327\264\311fNl\377\343\317n\025\\L\fOG+\343Eg\316)\227\344\323\357\330\352\347\007\210\3401"
+	.string	"\217/\206\200b\325\b\210&l\340&%u\325UC<\251zBsNk(r\334\331m+\330>\260\035\023\017"
+	.ascii	"2\003\302p\301\204\245\032h\f{\375\264o\240\350\201\301\b\305"
+	.ascii	"a\273\214#R\201\274\f1.]SM\323\300\024\024"
+	.text
+	.section	.gnu.lto_cliEnter.329.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\363\001\335\022"
+	.string	"\226\243\200J\300\226M:\224\\T\026V"
+	.string	"\251F;a\367wa\200`^?\273!2\333q\3630h\217\373\303\027n\2725\271`K\022a\217G\bK\365~\242\2243\255I\004\302\333]p\342\005\233\354\325\306\300\212M\212\320,\221\266wJ\001d"
+	.string	"h"
+	.string	"r"
+	.string	"V\251\250k\245\246\224\372\005N\244\bS\222!@?\332\261[\"\212\223\315u=\216Tl\237\332O:\256\274\322\316\t\354\n\341\236v\317\026\257\260\336\371|\313{\307\272\001\357\235K\033\t\002\022\333\263:1uk\232\332]\260\016\275<-\375/\035\200\371C;]E\330]S\363\307\304]o\233\201\355\320\2466\001?\257\343\305\332\255\335\364s\334I\203_\364\3166\257\027,\254\016|\210\232\344n\225\346"
+	.string	"tU\355\230\007z\323\235\017\021\223\034O\245yU\375\246\343\330\301\021E\357\235\202\250#A)\200~\035\317gz\r\035\277\310\037f\364\346;\177\346\275\203"
+	.ascii	"\024e$(II\215F\261O\033\255+"
+	.string	"\354\253vw]\205\354+\375\253\216\0061J\031F*V\350\317\013)\221Z,v{n\2264X=\240\353\235]\342\312\245\001F(r\013\250\252\33201\364\246\277ZU\3657(\265\313x\264\326\332r\373a\263\204G\311\260vy^|\250\003\2310CC\343\275\2435\201\r\247\033HJ>,\334\005\322\321\022S\252\372O\3471\302/\362\205\232\032\357\335\237\230R\007\350\252\376\304\220!\310\r\345\005v\345\334\204\035\\\337(~,\262\021\004\031\216\237H~.2\026\"t}a\216\b\362c\t7\2103\237\f\005\230\217\203,6\206\244,&E\300\0139\212\025n^\2611\234\245\030\346\022\273\201\201\262\330\013\007\204\2153\320\245e1'\034AR\024GP\345\254]\265U\310\3661\302\345j\32564\343\001\265K\242\262\005\214\234\255\322\334\200\372\334\227/<\273\f# `\002\221cf\033\277\030\022\361\306d\344"
+	.ascii	"\t\306\270\023\273n\214\350\270%\233\026\373\362\3012\322\376"
+	.ascii	"\372\306\305\314\323\300.\303\0076\232\263=6\026\206\233\t\355"
+	.ascii	"\017;/xq)\347\203\334mG\3603\306#`\204DI\333\242|\326\n\253Y"
+	.ascii	"\214\206]^\264\201\f"
+	.text
+	.section	.gnu.lto_cliPrintInternal.part.0.503.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`q\001U\016"
+	.string	"&\334_C"
+	.string	"\221(\035\023\353`\210\033X\324\036\200\266w\210\026\021"
+	.string	"\375\026r\254\367u \236j\322\3162t5m\365T\3259\013@\225\360k\373\270*\001PAG03\220D\326_\f\324'-\335\310\336[\312\224\002L"
+	.string	"L"
+	.string	"J"
+	.string	"~\212mQ\211G\266\214o({\221H\031\341h\354.v\250\"\2549:|\232q\344\237\373\006J#\035&J\353\360\367\256\023I\211\001\232\351y\264`X\347\236)\255\224\n\340\204\311\223\343\361j\260\273\316x\270\257\333\356\330\336\330g\005i\b\323\357\2455\277\272\037\240"
+	.string	"\203\230]\222.fC@\226\t\333\267\317\211l\215\346\360\253\225\220\256\204\272\004\231\337DW\t1\260-\207\022g\332W\361\025\243\253\204\234\300\256\252\305\305\356\246\340\320\b2\207\336\336\021\0173\347\210\207\016\037\376\b?\024\017U\037\274\314H\201\370\333\335U=\261\275\221P\243\332\237\013y\224\017\234\224\344\247P\257O_\214\221\032\245\354\274\340\327\324\243x\3514\244\020\311\316ze\301r\322RO\254\321\003\245\005cU\331_\375\327\267?\306\031\bD\263\016\310\223a\210\346l<\0238X\005O\004\n\030'\003\3016\035\376X\350d\030\350\363\3110\215\355\274\252\f\341\203KIE\240\005dT[\202'\217\362\271\177C\213\211\213II\357\305K\363\005K\215L\275\246\354\217\250\352"
+	.ascii	"\206)[\366[d\b  \240\002\261\263\035\1778\364#\213\266\234\227"
+	.ascii	"3;0\224\202Q[\003c\216\357\376s\301\377\365\310\275<\007\330"
+	.ascii	"\236\207m\330\020XF6\273\232W\242\233\025$\271Ck\013F\362j\366"
+	.ascii	"m\r\207\177.\016W\343\272\323\257\025c"
+	.text
+	.section	.gnu.lto_cliShowArgumentRangeError.part.0.504.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`k\001=\016"
+	.string	"\366\230\\G\360\2208\035\360\\|\245\232p\362\361\025\200x7\317\355\232\035\221\005\325\362t\253\035v*\337\r\271\376\035BP\2243\205"
+	.string	"\201^\262]\"\243z\033\272\233\017 c\312d\034q(\004S\344\307\251\201\177\321\337{\357\224\002B"
+	.string	"I"
+	.string	"G"
+	.string	"\017m^\261\2036\257\366Q\330\376l\232\217+{b\320\246\021\225l\310"
+	.string	"\306\213\006\027\033\273\253\275\316\022\007?%\005\375\313\274#\242\204\237"
+	.string	"P:\\\n8\3458\330]c\036\356z\333$\333'\3733\002g\361\026\340_,\203~\226\204\005\342\265\273\n\260\327\214\036\264yKK$\013C\034x\365l\211\210>K\322\022\021`\257\036K\371\361;\313\210h\\\016'\226\322~\212\253"
+	.string	"\3172\362"
+	.ascii	"\273)5^\273c\202W\023\300^=\006\027)`&\r\f\274\206X\220\027}"
+	.ascii	"\027\353\303L\311\f\345T\361\244tg\212\375\361?\225+\013jv7\334"
+	.ascii	"\250\331\0215\306\211\267\374\256?\346\323\276\375\025\237\357"
+	.ascii	"r\027\227\261'\006\006\306\004\ts}Yg\227\304Ri\007\346\3500\225"
+	.ascii	"<\262\007\247\354\003\344\224}\2308 \200tx\224\006\\\330\272"
+	.ascii	"\251Ju\023\325m*\212\3526S\204\216\343\230\033\245$p\232*\265"
+	.ascii	"u\032\267\n\321F!{\023P+\255\202\347\2554\317Y\"f0\314\fs\252"
+	.ascii	"\330\356\310\277\370\313+@c\327$& \260\002\241\032vo1j\0053\\"
+	.ascii	"*,f(ci\244\fJ\242\030f\2726\241\332n\205\354\264,\234\370=\\"
+	.ascii	"B\226\026n\365e\227V(h\275\305\222\215.FHj\267\323j\013\037 "
+	.ascii	"B\271\213\314t\352\303_X\270\002\260\274\320\235R\323OXc"
+	.text
+	.section	.gnu.lto_getValueOffset.part.0.506.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`C\001\215\r"
+	.string	"VZYA \221\222\016\233\360\370\271\213\216\320p\310C_\3763G2\021\312WV\273\262\372\217\244\207\250\367\2445\344\226\250\205\247\030]^[U\226\201"
+	.string	"2[Px*\232\260 \227\272q\325@\310\336[\312\224\002G"
+	.string	"D"
+	.string	"H"
+	.ascii	">\211\313Xr\242m\263\355\213\370\210\2161\003\025>\237\217\020"
+	.ascii	"0*(`v\271\3520\300="
+	.string	"\342a~@<\324\016\307\256\3710?\265\025\317\365\243+8\321\242\323V2<3\177\222\310\356z\322p\303\333N`\033\304>\214i\351\245\343K\303\227~0\255/\235\177\371\017 7\024`\331\275\320\351X\020|\361\301\376\350\262)\273cS\326\374\313u\027\016\001n1l\326\264o\342\\\347.\234\013\330\r\315p\261\313\0358\364\307thnr\331Y\365\351UvPi38\311k\252\217\001\312\324c\333\372\212\007\323.\005\004\276\212\t(\276\207C\237\023\017S\027\260t9J|\262Ka\373\2521\211v[\320\202\034~\364\213l\304\310\360dLj\213\365\375\255\206\354\027$\021LF$@kBJL4U\203\222\221\223J\263A\251B<l9 \331T\020,kSQ\266\363o5\344\217\236\311\250\222Z\260-ij\306\302\366\225\232ET[lCM\215\2528R8d7\216\305\247P#\215\024\020Y\036"
+	.ascii	"\332\343E\337`\037\023Z\363\002,\3601\214\270\205\217Y\274d\266"
+	.ascii	"^!\332m\rX0AkZ\340\001\344\3416@\024\fs\205\203\254\305.G($\204"
+	.ascii	"\316y';\355A\273_\t\271y\\xZ\210\324\024\232\227^[\306"
+	.text
+	.section	.gnu.lto_restoreConfigs.part.0.507.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`_\001\245\016"
+	.string	"\326\333aE\360\260(\035\262\344h\317\230\210e<]2bde\265\b@\213d\334\303\234\237\365x\344\366\300\377\234e\274\372\353)\204\257jQ\320\353S\3113\360\f<\005\262\342\375\b\235\312\201\255\255hpc\333\336[\312\224\002P"
+	.string	"L"
+	.string	"K"
+	.string	"\266\215\307jQ\006>\320\036\220\230\261\273\333\241nptY\241q\341\262B\363\342\257\2735O\207O3\236|\016u\230,\256\302\337\343\254T8"
+	.string	"\340T/\2046\253y\354\231\302\245R7<Pxr<rDv\327\035\0137\347\266Kl\177\330\177\t\253R\273\331\f\260\246\303a\277}\037v\021~\314\036\031\323cL\322\243\333\t\255\277|\031\177\304\273\323cL\004l\213=w\003\003a\266\333\0258\364\200\316\241\273w\304\303\3169\342\341\375\227\311\366x\016\037\302\266\311\266y\307\262-\237\002fP\212g\035\372\245xx\325\0320\026\252\244Y\377vwU]\266\th\252\b6#Cy9\311\232a^m\007%y\226\037\373#\310\270\026\215\231JQ\326\253L\305\212KuYc\b\013mf\325`\347a\3679\017FB"
+	.ascii	"\f\033 \222\364\007$\244\340\263-\b!\030\331>\244\322\006\322"
+	.ascii	"\341\021I\002\322\326`4\"m\036\333y\221\224\236@u\201\242\217"
+	.ascii	"\342)@~\213C\242\024\275\376V\\(\001BF*kO]\346\320\242GJ\037"
+	.ascii	"0\016\304\310\324k\212}\242\324\331E\231\271\211\321{\313a  "
+	.ascii	"`\202a(\355\257p\334\245\261\360m\311u\016NZ\r\205u\353/\233"
+	.ascii	")\325\310\306\226C\3372\310\255m\021\355\316\201\275\322\356"
+	.ascii	"\261qi\201\277*\340\206\301\005\013e@\350.@\270\215\262+p\306"
+	.ascii	"kd\256\306\365\247_\033\306"
+	.text
+	.section	.gnu.lto_cliRebootEx.part.0.508.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"u\n"
+	.string	"v\022D; \223\322\001\f%hJ\302D\f\357\004D\266 \240\300\223}u#\306\203\037\253\375q\b\222\225\220\r\234\027Ky\253(\b\202\"(\002\262\255Lv\2205J\004L\016\331d\357\224\0023"
+	.string	"0"
+	.string	"4"
+	.string	"\005\033K&\310\340p\274\360\354\356\367JK>\236\316m\364I 4,\027y\372\331\031NZ9,\227\307\347\3007\200\205\335u\367q\327\333V\260\215`\277\024\342\313U(d\364\3529\355\263\274e|\271r\300\356HM\314nIz\265A\367\032:\210{\335N\300\275z\257W\261-\332\265\227&\333\341\321\256\005\266\270\230g\3710\257\035\232\006%]l\213\242N\364:z\351\320\310\3513i\314t\373\266\024f\323ys`\263\333\372\351Y\221:\203r\331\355\257\210\376\314\236,*\324ChjP\201\240\003*\024\360\251\224\2028}\022)S\304w\n)\276\022\310\340\004*\374T \030~\236\355\371m)\314\036I\n\r\203fP\032\263\315M\277\202s\031"
+	.string	"\332\343\r\255\300x\340XA\256\016\2415C\300\270\242m63\243\003\242`\230+\034\256\t\241GK!\030\270\007L\270\247\225\242\332\005\253;\027"
+	.ascii	"N\036\314\3434[zB\031\003"
+	.text
+	.section	.gnu.lto_cliRxRange.part.0.512.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\206\b\205/"
+	.string	"\232Sl\022IpXR:\363\356\006\b\361\217\362\263\253\235\016A_n\301\323\270Zz\017vl5\224$\267\322?\007\200\270s=\f[\326-o\027\213%\347b'\331z\264|\020I\013\253\307\214\036\226c\303\t\362\357lF\032!d\357$\003\013\001\t\001\025\001Y\312\247$O\245\317\236\253\362_@\243j\320\234\263\003\366jOz\235\365P\236,]\237'K8\371-\277\231\025]\203\346\354\364\271\332@\354\325\266\361\375\323I\013\354\244E\230\237{\357dz\223\245"
+	.string	"\316\\\305\354{\273\377u\260\344\233,='\347,\261\262\234\235\013\256\266\001\366j;\317\263^e\257\263^\355>\223\356f\352\246\273\223+3;\331M\027 *7\001E\321\224av9\347\341U\274\365\344\2016\355\317\307\366V5\3057\230\354\233\275\300\227\332\223\334\224f\323\2016\004\332\337\026\232\323+\372\313\341{cZ\025a\342\270\354{T]\275\227\362\270\371\230\373\033\363F\252"
+	.string	"KmF\333T\3365me\320\305\005\233\312\024h\256)u\325\273l\322x\232\352X\211\305\005\233Q\351O\234\021\034\177\203\2728\345\241\032\262\374\033SG\252"
+	.ascii	"j\245\356f\277S\315\247{\205\017\366\"\344\234\373NX\357\233"
+	.ascii	"ww]w#\351\356\215\005P\270\351b\255\306\301\247\031gu\377n\363"
+	.ascii	"\374n\357\374n\353\374n\013}\267s|\267q\330\3337\354\355 {\033"
+	.ascii	"\310\336\266i\357\374\177\276\213\275\331\263\275{\353\335\336"
+	.ascii	"\352\241\274S\366"
+	.string	"6>\331\373\376\371\177@\232F\311\rV\316Tyj2\017\365\n\221_\371\311~\261\037\312\357\366\263\375p\027\243\"\251U\364x\320\345\006prU1\301\364Q\232o8\271\252z[U\242x\331e(\247\017\213>\302/\242\234\262\036<\327(\313\330\345\354\034^\375u\377\213\\C\340R{\227~\\\267p^\216\274\034UyI\203\343\004\233v,}.\177\353\326\255\255\rHY\316\271\004\333\332Z\237\t\267\306\354\274\354@\260i\335m\330\226\243%\311\361\300\322\221\324\375\263g\351n\233\305\2614\226!\307\205\345\225snY\340~\030S?\312\253\274\354f\335^\261b%M\003\331\330X\237\365\370r\356aU\206\201\275*\306\324=P\316\334d\346\034`p\255\200\2333\345g\376._\303\241\001W\316R_v`\245\016#\301\325\017!\272\332\224\270\211J\023\223\272\037\326\272\373\r\016z\364A|\323\303A,"
+	.ascii	"\316\371T\342\371\260V\253\366\343\n\304\007{\262\335\344\345"
+	.ascii	"\335U\375\270\332` \276\024\326\323\315\353\026\333`\035\271"
+	.ascii	"-y\370\335\366\343.\215\335\271?\334=\202\304\375\262\257\224"
+	.ascii	"\272\253:\266\031g=\254\325h\356K\362\004\363\363\3761\226h%"
+	.ascii	"\037~\215\257\260%wPk\017\277\256*\307\0167!+\326\352\001T;\300"
+	.ascii	"R\025\357\220]\341a\225\356}\266\266x\352o\377\005\211\252Q\222"
+	.ascii	"\245?\277\331YhTMI\206}\316\342)2_\261\3724\347#]\361E3\223\247"
+	.ascii	"\002o\252b\354f\006\315\241\314.\033\351\322\232b\365I.\314\023"
+	.ascii	"\f\016Q\350~\231\342\277]\210f\306L\333\325\022E\325\205\261"
+	.ascii	"V\247?\256\030#\237kP\367\256/"
+	.string	"\306\270U\216\241Q\3429\335\274\006\336\343n\242\342\375\362\342 \331UY\024\032\235a\302\206\r\022*\004\261\235t@\t\231\323JD\243\241\261h\324\023l\024\f\224\220C%\244\016Q\361\204\361\030\344\241h\310h$\242\020\022\032\213JD\rCDF\"\222E\"\032!\217'\326\342\221\214I\307 $\343\220Q\022\021R\202\211b\021q\205\020\211\224\002\017\031\213ECF\304\r&\214\204z-\304\240X$44\026\211FC!\344\321\220\001O\037S\f!\207H\307#rx\237f\234\325\276:2mN\370\t\230\372\374Xn\214$\021 \256.V\352Cn\366\307 ;R\026\205*\271\356\240e6\b\256\016\346\301\027\367\235J\036\351\371\210\233\303\362J&a\245\256#\301U\237\367\223K\326\356$\223\344\327\375\262\323l\205\233z\007\363\370vp_!\326\271\260\2056F\210\373\346\340\356d\223\253\204JE\345`"
+	.string	"[hrJ<\034\334-\341>\005\371\214\314\315a5\370\227n\027\327i\302\232\343\206\367\214:\310\267\211B?\310\325\266\200\341~y\264^\375\262\214\023\016~\334El\241q\341\321\n\200\251\250a<\304\230B\206fF$\210$Mr\260\002\221\241\253:\021`5\204p\222\324\250\321\030\332\016Z\206\007$\356\305\263b/\273\277\376v\303AL?\370\211~7S,_\215\345\265P\211\213P\243"
+	.string	"U@\237\002\233ti%+M\345\320D\315-\373\350dA\037\332G\224\244\372b;\236<**2:oI\007\007\223\374\260r7\367\353}5\254\227\033\265\207\301u\363\315\306\357F\004pa\002m\001\307iGk\317U\237c\275\376\374>g"
+	.ascii	"0)\036@x\002\r(l\252Do{\277W\226Qr\247\234\310\206\302X)\254"
+	.ascii	"\256\2019\341%\221\324\351\204k\367\035\223\310?\344\f]\350m"
+	.ascii	"\253\270.*f*\324\224:\240g&\034\222,\361\013\344\250\371'[\316"
+	.ascii	"u\346\321?\242\357\354\374`\350#Z\361\210\323_\307\212\221$\330"
+	.ascii	"\260\367\313l\364\355\246\274F\"\242\215\206\021<\300\227F]\376"
+	.ascii	"\240\022\321x\237\0373\212oK \206\320-\276(3\252\235bB\354\373"
+	.ascii	"\307/\324?\333 @~\340\301\367u\220<\252K\215i\026R\356cP\273"
+	.ascii	"\006\204\364\223]\224\206;\217\331\262s-wC\300\366\350\264\027"
+	.ascii	"\222x)\354\241\342\220\004\333\325\265\317\346\236\006"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.part.0.514.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\245\017mD"
+	.ascii	"\332q$\031?@\244N\007\257Q}iAn\003P\001\245\002y\r\004\3668\264"
+	.ascii	"n\235\215\005\374\003\007\243\004\036{\223Z\256=\332\001\356"
+	.ascii	"@\374\027}\354\277\246\373u\031\021T\202\020aX7ZjdwK)\245z\001"
+	.ascii	"e\001\205\001\025|t\035'\217QUh\273\216\223\3715\275E\220l^\346"
+	.ascii	"\310\025\336{\027\302H\206\031\331\305\334qZ\0163\222w4\034\246"
+	.ascii	"\372\262\250p\207s\223\361\301m\246\327\364]\3431\362\215\033"
+	.ascii	"7\205\033\332\260a\303q\230\307{\323\224\334i0\266\252\306\007"
+	.ascii	"3\301\246\227l\354\336{\246\321\264\235\206\343\364-\273\035"
+	.ascii	"d\220\220\341\340\275\367\202\261U&\261\227\326\266+\343\345"
+	.ascii	"Qe\274\220\356\235\333dj\204\016\r\336;\215j\225)\030[E\362{"
+	.ascii	"\327\211\351\361bz \222r\357\251\217\006\343\3654\275ec\354\316"
+	.ascii	"\334sM\3276\030\257N\272Wm\357\356\336)\204VY\201\261U\236\366"
+	.ascii	"rm\325\330Kk\253\314-ef\037\314\201=m\273c\3342\007>\001\271"
+	.ascii	"_\024\b\005\212\221)\274\3676[}\266n\273i\311\264\244\224\204"
+	.ascii	"td\244L\"\331\243\261\270\252\304w\247\226\233%\373\352\246e"
+	.ascii	"\261\003^3\271\365\222\033\025W\232\322IS\2448\222\225>\2723"
+	.ascii	"\326\346\304\215\242\255\2146\361d\224\211#\317\232=\3132\266"
+	.ascii	"\304\217g\007\262\214)q\343\201\2642\263.2\357\275H21_\373\316"
+	.ascii	"\230Y\230\253\016%C\322"
+	.string	"D\342\222\0225{\214\310\200\020\245\366\300-i?0\177\342\262\210\025h\337\031\253B|0\350\246P\343\265\013!{\272+\265S\261\303\275\227\373\307\225\346\247f\3563f^c6j\021\rU\337\351\004\236\375q;\327\326\353\366\353\005x{nQ\271Am\247\001i\021\023\361\201\362\350?+\324\274\266{\357\205>\355\247\005\267[\253\354\342\2057\364\305\267\235N!\210\311]\227.h\222\374\360C\376\366< E\260\374\2571\201\3468\353\377\327\355\261\325\361\201\371!F\362~\346*+o\350?\023\354\277XB\367\3737^\023\277H\307<\001\313hy\372\241\377\032\277S\377\341\341\341!\277\032\263\322y\002\353L\245t\226\240t\216\240tn\262\316SJg\bJg)\245s\024\353\374@\351\354\200un\240t\206b\235\031(\235\027$\235\025(\235\023$\235\021$\235\0170\r$\235\013\020\030\320\323n\001\254s"
+	.string	"\326\031"
+	.ascii	"\353\374\304:;\035\235\233\226L\254\363\022\353\254\304:'\035"
+	.ascii	"\235\221\216\214\224H\347$\353\214d\235Y\326\371xt6\266\232"
+	.string	"\346\342\252\026\235\211\335\246\371\333\256\331\273\256\273Q\020\r\333\216\242\367\0269Lt\321\3247W\372Mw\233n5\335v\335}\335z\255'k\007g\2455\361\260\026\361\232M\333\312\212lV\006\345\n/\3304\252\213\265>\b\220\037jPO4a\205\n\357\2356[527\367\234\266\323\325\177\314\200\317\275\227N\303\341\336k\277>>->\25524CP\026zL\025NG0\216'i\346\266\212/\361CSbV&\035\344e\020w\373\2662\267W\034I\373\366\204}\211\216\0309\"\025,\034\244\347\017\021#HN\342\275i\034Z\257\217\203b\374\220\t\024\002d\346~\0323p\001[\332.-\250%\201\263\315zkT\023\245\355\2347\224\375\214 \334_\330\177\005Z\362\305\344\350\327xm\347\032\340;-\300\267\231\024P\234\231\021\200\247\007\360\264'\316\314\351\231[0>\304\251\022\366\271\t\201.\337\351\235"
+	.ascii	"\345\374\224\204\335\264\374\246?\262\223\313cZ\276\033\n\032"
+	.ascii	"I2\275\372\354\203b\304t\210\\R\372%\245\276\270\244g\366\340"
+	.ascii	"a\200\034\210\203\035}\3227\331I\375\330\003\215\265\"\035=\322"
+	.ascii	"\037\331I\363\214\216\b\217F\257>\371\360(\215\276\003\373\n"
+	.ascii	"x\377\365^\bc\362\327g\0261\302\033\252|f\230\242\253%3\211N"
+	.ascii	"TB\t\307\247EEt(\371,\340\027A\250\021\371\255\327\203\315>\362"
+	.ascii	";,\372\324k\366;*\205chv|\346\023]\350T\t\371"
+	.string	"\320\242r\367^\013\206V\250K;z\236R9B]Hkm\265\241\202\212\177\374&\266/vb\213\2700\210Y\232\342\257q\262\261V\343w\226:\276\342\033\377\310.\356Pl\021\222\257\305w\303\300\271\365\327\004{5\244\256q\177`\377\245\376\232\022`\\\036TP\017\216\275%!z\255\352\253\317=i\235\037'\367gN\241\302\003\314\"\004\b\023#V\216\300\354Z\300\224A\003G\325\226\215\030U\t\270\306\224\223\313\331e#F\025\f\253\255\246\325\f\003[U\316\205\243+\353\003\027\016\031X]4\266<\304\270\272Q\245C\211\253\nk+k\306z\3257\252t\374\026W\216\227\201\343\352\206\f\254*\0231\260\254\212l5uu\303\252\211\343\252\n\253i\265\345lN-9+\207\214\255&WV\326V\323\233x_\215;\374\370'\177\023\357\275\267\t\2037`Gu\303\3616m\021\nmd\306\260v\002\325\252"
+	.string	"#-\022\274n\"m\214\334\031\016\212\375W\333\241\301\273eS\360\004\277\340\241\336\301Cx\t?\341\377\331\323\264J\212P\362\376\302\032\332\236\031\303\274\240Z\215j\356\266\211\223\366\t\361F\377\213\251~\302\t\267s\226!C\345F\327\021^\202\317u\363#L}\023\212\327\211\301\022f:\205%:G\007&\365\020\312D\001D\275\324?_X\226\007\037\365-\266\346rN\2506f\022.-Q$\314\363%\356\301\037\361\344\321\322\340\035t\361\302eK\003/\f\036\n\316\231\345\215\201\234\202_p\345\317J\025\005\177\3219:\004\237\3403\310\215\251\003\264[D\245}\233\"\005\301\253py\362D\347\350\244\234\271\225\322R\351#x\370\367\374/\246_\373(\200\326\324\230\177\340\227\330\300\370\031`\022Z2"
+	.string	"8\300\300\267\340\240R\201Gk\337T8?-N\242\004\276\300/\331\321\t\016 @\007-\020\226\266\244\001\257>\375\2560\r\370\201F\250qP\004\rBB3\"\n\222$)t\341\005\204(\306\234\331\006\021\020\251B\022\311\224\220$\226Bc~"
+	.string	" \321s\226'D\376O9\362\217\264\312\212\270\246R\313\246r:\360-I\022J\351 \312s\321\276\260@\352\364\242\337\216\343\247\272\371\200\\7\357|q6\035\310;\370\255\246\327\240\230\273\007o>\233JA\224S\363\243\263\333\300S\25271T\221D4\256\323\307X)\032\037f&s\254\352\302<\317\020\203\372;\245O\0306J\343\276\215\245\023{\241d\204\362Jvf\2203\234\021;\ni\356`\267\f\335\347\n\016\\\017\275\003)\305C\347\247\032\2451\230\237\351\022\207\220\333W\251\332.\027|\264\035K`\001\272\321{\333\023[\204\210p\360\3222\375\026\242Gs\305U\342I\031{7\210\002\3217\001.\002\201o\343\246\364\006\232:jM\235\220::\247J\366"
+	.string	"\234\n\\\013G#f&\005F[\261\t\376%\342\260&\215\036\341\331dL\210\207\247\305f\002\034\227\272\301\311\316\234Z\3106\254\221B\303\327\254s#T\334c\306Z\226\034Y\277b\266\370\271>\240\320i\033\360\275<\360\341\324\303\277\313\331\346\201[s\334\236\331\r\303\020\035;e"
+	.string	"\301H\221\251Y\242\034\360\033\305\017\210\230\3355P\355\b|\211W\001^N\333\263\020\235\001'D\226\344\036O\245"
+	.string	"\304\250\311\242\240%@_\034\177\243\b\036\210\310"
+	.string	"\031\020\303\207\207\364\232\204\262m\t\227\031B\021\301\241\231"
+	.ascii	"l\217\314M\020\206\341&(\230E\004\374\312\265\232C\2302\343\020"
+	.ascii	"M[\322\226\0260@\005~\265_\272/\314\345^\244\376B\327\366\267"
+	.ascii	"\340\331Y\263XF\246\324\324\356\200\374ni8\321\017E\225\361\t"
+	.ascii	"\375\254\337\227\332\302T\330\t\364\335\236I\306\205\257\360"
+	.ascii	"\031z\230?\277Op\353\254|B\017\334>\273\352r\344]\2573\313r\020"
+	.ascii	"#\272\313\200\341\251\332\002u\364o\264\257F1\331\346\311\234"
+	.ascii	"A\200\210\002\177ZCW\2269[<\007I\324^\223-\036\361\306#\2131"
+	.ascii	"\325k\0234\327Y\342\277\3044\251\265)\213\025*"
+	.text
+	.section	.gnu.lto_cliBootloader.part.0.515.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`:\001\005\016"
+	.string	"\006\331[E"
+	.string	"\2614\035\330\244U\220,\222\252\b3x\026a\375\001\300!\224\363\303\347\362\021\374\001\265\204\273Y\311\321\bC\250\031A\210\233\200\242\320\020\273\344\346\203\266\312h\024\013\340\321\226\276f8\031\221"
+	.string	"\022m\267\275S\nC"
+	.string	"J"
+	.string	"G"
+	.string	"\224:H\347\324>\n\333\237]\372(bA\006\355\222\b\313\206\frLl\270\311\261\273\327\351\2249\370)'\320\227b(\374<\351\016F\300\320\020C\036.\007|\362(\331]S\037nz\333$\266#\330\027\005\033\002\261x\013\360\243\224\257\313\236C\211\234\0237\026P\247\326t\220\316mjT\254\020\006\301\251g\215J)\001uZY\312\217\337iVD\306u\001YJ\373)\256\002<\315\312\005\354\212`\304\330\035\025\234\272"
+	.string	"u\352\361!\235\007\177Q\r\324\330m\271X\201jip\340\364\323F\261 /\372\244W233Xf(g\214\3474\355\024\331\037\377O\322\006\311\313n\207\035:\026\004\225A\3428\277\315\245}\373+>\377\346$W8\337G)\2664\214\001\346\352\346\235T\313d\363`\027\270\007\001<\215B\207I\360j\235\240u"
+	.ascii	"4n\363h\037\f\202\311'\363p6\262y\262\213\333\260\317\225u(\327"
+	.ascii	"H\210\353\211\326]^\255\335U}\332)r\t\206\231a\316\030\333\004"
+	.ascii	"fp\274\214v\206\360\207\274\213! p\0022U\253\003s\370W\214\231"
+	.ascii	"\r\207\233hp\037\016%\033\362|\204}\330A\262\002b\242ko\334\240"
+	.ascii	"\263\340\313Z\320;\275@\210\361b\344I\331\355\266\332B.\033\244"
+	.ascii	"D;\206\324^\336\222\277\273\264\026\210 \350\003I\216\276\326"
+	.ascii	"\340\001"
+	.text
+	.section	.gnu.lto_cliBatch.part.0.518.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\013\003u\030"
+	.string	"\026m\242H\260XQ:\300\021\013;r\023\023\30193\033\242\3215\023\271\274\237\026\216|E\364\315\314\251\301\321\224\033\304\257u\323d\344\372\370\256\277\234\205\246\215\275E\352@v|\340xh\342\271\237\bS\025=\343\243\222F\b\221;\245\211"
+	.string	"\205"
+	.string	"\222"
+	.string	"P\242j\005B8\351\034\363\244\201\307)O\2327P\236\264\177\304\366\220=\346\300\246\3523\221=\346\300\256\352&\220\311\"Cx\246\326\352:\271?N\364\032sU\222\343R\033\"\237\022\213\272\327\230\302/\360QC\307W\264\367\313\361\362O\247\304/\301.P~9N\n\370\361X\277\035\035\005\374x\254\337\021\335\021\007IH\357\\|Ic\203\341\2242\027\236\316\370\031QZ\3406\253\013\265V\277h\307\315\272m \266q\330\224I\033#\b\346\210\022\r\200\356m\345\235\016\245\302\254\225\367\336\315\344I\3209\371\265s,\350{to\224\262D\241\031\362VG\227\311k\263\305b\261\350]\262\017\374\311\222z,\251\227\244\246\017\376\017@\222)\016P\252\025\251\230\246\366 \251\f\261}\337\311\237\\\334\311+%\205D\tI\255\325\305}\341\220\315by\351\203M^l\223\027`\036Pz\340\320\227\3008"
+	.ascii	"\2545|\246\324~\222+!\372\022\030'P\353RU\304\251\335\233\210"
+	.ascii	"\303(3\001\265a\035\240\252\314L\031\255\256\310\n\001\275\323"
+	.ascii	"\255\360(h\002a\362X\350\364\204\020\3764\264l\361\241\031\036"
+	.ascii	"\255nF\022\325\215\362\206\376\311\253\220\310\241*a\362*\350"
+	.ascii	"\234$\327\1772q\202\276\347?\335F\313\025\037\232\341nu\336\033"
+	.ascii	"J\314\017\036\3442E}\334\027\025\331\2709@\356\245\212\206\215"
+	.ascii	"\361A\345.P0\214\037\345R\202\374 \236\325\350{'\375Zyr\327\002"
+	.ascii	"\321\214\221\244\"Z\364\236J\355\220\210\3542\331\301i\306\345"
+	.ascii	"lB+r-\232\355G\326\002\007\033`Z\215\206\253\265R\314\204d(Z"
+	.ascii	"4\234\354v\313\275n\314a\007\026b\007\346\263\303\363j\2351\236"
+	.ascii	"\rg\206\326\210\023&\342\214\265\316\036\f\247\207\017-\b-\r"
+	.ascii	"\247\317\353\36495\264\316\3309\242\325\023\343\211\305N\n\246"
+	.ascii	"\341jc\rg\373\251\335d;\264\333l\345Y\004\333\317\314\205\263"
+	.ascii	"\311n\256\031P\220+\002\216s+j@.\241\\\016\310\305\262M?\326"
+	.ascii	"]2\253\2528U\264F\336\217\265\326Zs\203\345\305\200\3524y\347"
+	.ascii	"y\003; \220\202\031\263\252\003\263\360\372\305k\227\030\300"
+	.ascii	"\305\352.\026\2150\251\351\303\230A\234\267\203\233\032\264\024"
+	.ascii	"\373\\b\265\263\207\3508\005\366\277\364\242\351\030\355\344"
+	.ascii	"WQ\360\343Q\302\275\271A\226\025h\340\306\371\317\n\262\335\222"
+	.ascii	"W#\322\036Dl\277hl&\321\323\023~V\233\321\315\252\326\025\350"
+	.ascii	"\346\006\311\357p\006\233\026\f\332\013\374\261_\003B\260\335"
+	.ascii	"\036\346d\246\200t\277\241\215Vt\341\006\266\3151\3018\001"
+	.text
+	.section	.gnu.lto_cliRateProfile.part.0.545.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`G\0015\016"
+	.string	"\306\031^G\360\2226\035\220\263\016\2519\037\340d\320\347!\244g\200:5\230\261A*ZV\016U\210\3159F\366\204\240\b\236\214W\004\266Go\031\006\373XK\rD\373\330\276\017\017PC'\233n\032un\327\344\240o\273\355\235RC"
+	.string	"J"
+	.string	"I"
+	.ascii	"\247\036\220\235z|\310s\232]\200\347\324>\013\333\240\255\363"
+	.ascii	"\021\305\272\034\332:\242\017+.\330\311\001A\003dw\271\323y\342"
+	.ascii	"\341\247\304B_\374\004\3202\3422\300\261\017iw\235\221\270\351"
+	.ascii	"m'\260]\301\376\212-\256\030\337\006\306c\204\257I\371\272\354"
+	.ascii	"C\244\330\311\361cw\025d\247\025\273\037\003\3724\326l\177FF"
+	.ascii	"\245\212%\f\234z\312\250\370\030e\247\232\245\374\b\036fE4\256"
+	.ascii	"\213\313R\332oq\027\341aV\016\332}\345\320\330\035\017\0043\276"
+	.ascii	"\021\217\335\326Y2d-\006\005N?m\224\r\362,>\316A=v\334\320\321"
+	.ascii	"\232\242\234/\236\030\266\273\353\371\262?\376\307d\220\0068"
+	.ascii	"vE\f\021\262&h\r\025\277\371g.\355\3737\177\341\343X\263\001"
+	.ascii	"_\223\342\352a\334\276PB`\333\020X\250&T-=8M\030\241\200\252"
+	.ascii	"%\b'\023*%\241\226F\034\244\252w\325\211g\242Z\221D(Yu\037w\233"
+	.ascii	"g\322q'\036\311\212\353X(\334\026\362\207A\305\3424|\037\213"
+	.ascii	"\323>_&q\230\035<\347|\261-\"\351m\303s\031\017! \220\002\"2"
+	.ascii	"\336[\370\3071C\t\026s\006^SV\003J\264\303\304\274\2756\201\334"
+	.ascii	"\276x\005\247\202|\r\220\031L\037\n\307Vl\025\321\363e\335\353"
+	.ascii	"\241\215M\f<B\223\213X\350\364\016\303`\301\002\260\275\270Q"
+	.ascii	"\022\375\2565\006"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.part.0.546.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\\\002\305\023"
+	.string	"f\345\201I\300\020)\035zd\035\2127lj\324\002\351\235\252\232\022*\232\226\006A \314\373\355\376\301\314\2376W\250\273ae5\377\212B\346\326A\350/\020\002\031\204\004\227\323\313\016\207rG\304\327\270\3517\231*?"
+	.string	"\"\273\311\226)\005e"
+	.string	"k"
+	.string	"l"
+	.ascii	"\035t P\375\210"
+	.string	"{\221\016\311\270\030zV\265o\342'\304\027\351\\\300.P\214\337\356\230\340\323%\341\247\307\217\260>\303\017`}\332'\262\215\263\245>\nm\317\242-E\322\2639\025\252\r;\244\252\335u}\312\020\027/\025\024}\345\375\344.\357\273\362~2\\E\016z\260\354\256C\r\367\274m\005\266el-\021W\372'\250\006?\376\322C\255?\372\017\242V.\016\273>W9\326\303l\032:\323\355\247\300\371>\1770\341\276ts+7n\256\347\253\370\n\361K\267\257nC\032TCS\273\275\223O3\230\002\371\360\324+\341\306\375\231HG!>\t\007\f\331\013 \210V\302\317\026\b\352\217\234\242\202\273Q\316\307\365\001\325NQ\021o\224c\271\033\241.\306\344\363\277\373`\b@\355\356yvL\204\226N\346|\t\312\017\215H\332\355\020\321\377\356B\202\001\250]\335y\023B\035\214\311\247\224\366\013&\243\234\236zd\316"
+	.string	"\324\2460\323\363|\022\005\343\211G\346\254\322g\361\246\031\237\204i5=\357\323\257\261>\317\263q\251\362\276\273\324\020\361b\267cG\257T\006Y\202\340\356\256%\220\035\216\035h\331\004\360m7/ 3\267W\213\r\r'\026Z\220\305j\032\310hf25\333\003\331\315\313\026\"\243\275\\b4\230\207a(3\032\230\253f\366\242\271`\266\233\013e\3045\033\231\315uS\253\331\\\037\266\365,;\222\307R\312 \3337p\367\303\2023\375SFze\3613\254\031\025\254dT\341(\240+BS\206\334-X\016Zn<\355d\316$\n\312\377\356\004\241\344%2 \220\002\222\263\352\214\240Cq\223\2757x\314\335d\204\304\f%\221f4\020\275\262F3\354\206\377\304\240\b\230\236\261~NS\027u\216\300V\214\215\f"
+	.string	"\362\300\210q\037TC`\273}\363\007\f\242\215L\320\216X\t\356\336\345aZ\263|\271P\210\3757\244\275,\216Q\335\007\200DV\220\374\016g\260\263"
+	.ascii	"\320^)\226\020\355<\241\217\001"
+	.text
+	.section	.gnu.lto_cliProfile.part.0.547.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`B\001\005\016"
+	.string	"v\231\\F\360r\234\016\220\263\237\033\267\263{\031p\317Xh\231\252*t\251V\371a/-+\317u\032R\n5\257\215 Q\361\351\345\305G\245\277\037\203\333\225LXO\201\236O\344\201\223OVL\b\251\220j\310o\273\355\235RC"
+	.string	"H"
+	.string	"H"
+	.string	"\325\005\264W\227\357h^\265\017\320\274\332\217a[\264e^\262\330\227G[\306#bI\00730F\264"
+	.string	"\331]\357\225\256\370x:\263\321'O\003\224\230\370\024\360l\003\332]k'\356z\333\013lS\260\377\"*\376\013\215\327\030\357\322\372\232\354I\264\230A\371\261\273\r\264W.\273\257\"\372-\336l\237eE\204#S x5]\021\211\371h\257\233\347|)>e\304S\256\311\313s\332\227q\224\361)#\347\354\302b8v\313\004\017>v]'\341\240\271\036\034x=\265Y\036\346I\374\33091=P\360pQr\322\023\323,\333\3355\205\331/\377g3\b\203\035\273%\206\bY\0255\207\213\303\374,\237\366}\230\317\360c\336^\304\273\264\314\205(\267\344\025\326`2\320u\n2p\"\022\027\2020\262p\001\003\211\013E\030\211H\025&\020"
+	.ascii	"\177R\201\250S\252$\301\224\3726\376:\020\365y*\260\224\362\276"
+	.ascii	"\025\313\353:\0167\234V^\2070\\y\333)\314\240\017\024\204)\245"
+	.ascii	"'\266\001\314y\353\320\334\306o\204\237! \220\002\"2\336[\370"
+	.ascii	"\3071C\t\026s\006^SV\003J\264\303\304\274\2756\201\334\276x\005"
+	.ascii	"\247\202|\r\220\031L\037\n\307Vl\025\321\363e\335\353\241\215"
+	.ascii	"M\f<B\223\213X\350\364\016\303`\301\002\260\275\270Q\022\375"
+	.ascii	"\2565\006"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.part.0.549.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`S\002\235\023"
+	.string	"F%\201I\300\322Q:B!\204cW\3766y\252y\223\375\300\303\243\201\311\305\327+G%(c\220\3004\231O-#Dd;`\352\325\237\322\r\324^B\207\210\340\004\033\212\250\262\275?'j4\211\211*\30677\217\262\332\275\367N)d"
+	.string	"k"
+	.string	"j"
+	.string	"S\r\244\374\210\373\320M\311\270!x\226\322\376\213\303\b?ts\002\273?9|\273\243\203W+"
+	.string	"_=\236D\365\n\276\200\352\325~\013\3338\373\351c\320\362\034\332O%:+\252\370\210\322\031E\355n\353u\242x\370)i\350\313\035\217\370\371\336\345\216\247\347r\3444dew\r\372\334\365\266!\330\206\261\245\212\177\245\322\364\343?C\244\345\213\376\007\220R\f\\\354\356\374\246\266D]\022\272\322\355\317\300\371=\257\224pO\272\231%\216+\362|\032G\n\237t\373\346\026\334\001\004\004\324.\357\344\325\023|\"+W\371#\334\270<\325\3501\302\313\250\241\003\366\303\t\026\021\300W\026\245\362ENQ\301\235\310\346\343\356Pi\247\250\204'\262\361\334\035\021&\257\367\275\207\301@\323\356~gg\320\300\312M\321\237t^(\210\207.\310\210\274\3577`\0204\355\346\276\333"
+	.string	"\346\\L^\347\264]\257\351\344\303\2443E\003\220v\007\231\374\316'N=L9S\264\234~\215/\305\370)<\243\311\357^}\232\352\365\273\036\237r\276\367\226\036\211\237.\b\216\374\311\t\344I\351\356\256\347\217\375\243\206-`\255|\033\315KM$\346\346b\251\315j`\240\207\030l\206BLF\306\201fs\201\311j\002b3W\013l\366\n\361\013E&\363j\315\310\\\263\326\313vk\241\220\230V\213\331Z44\232\255\265\262-\277\2023s<\347\004\262}\243\273&$\\\351\207\"\222?\207\217Q\351\240\221BZ\361\343\200|P'x\333PU`\021\301\244\233\242K$\235\367\035\207\205\004/`\356B1 \220\002\222\263\352`.\316\315{\202\337\334\215DH\224P\022q\206\003\321\033ktC6\366\213\033\265\305t\217\365s\232\272\250s\004\266bld"
+	.string	"\220\007F\214\373\240\032\002\333\355\233?`\020md\202v\304Jp\367.\017\323\232\345\313\205B\354\277!\355eq\214\352>"
+	.ascii	"$\262\202\344w8\203\235\005\200\366J\261\204h\347\t}\f"
+	.text
+	.section	.gnu.lto_cliRxBind.part.0.562.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\215\013"
+	.string	"\266TLB \251*\035\200)#\224>\214\007@7\273\273[{\304\226\017 7;\221)\003\270\314\026r\006e\203`\254\"\212J\006\326\242\210`\013\244l\2410\021\347I~\306&\013\224#L\204Zlh\223\275S\n6"
+	.string	"9"
+	.string	"9"
+	.string	"F\331\264\227"
+	.string	"ve\321\246aR;^\274\002\200\310$\354n\367JO.\236\316M\364I\326xz\331'\311\032\371t\370V\311\330]s$w\275m\f\333\032\3667\0021\230)3\226L\274\232\302L\020(\270W\213\347|\211\372\353\204)Wd\3459\355\027\270\001\361\257\323\033v[\013\030\354\226\025\257\206\340^]\376By\345\376@y\265?\300\016\t8\"\036\354\252N\2168\225\205\304\353\251]\352\230'}\005\265\b\263\024\035'u\231n\333\322\226\375\362\3776\035t\004vC*PX\223\332@\300c\267\177"
+	.string	"\345\313l\261\375\326t>R\b\212D\245Q\206\004n\030\276\220\347\363\2018\233\016\310\253\330\323x>^\027\362p@\235\027\216:\315\305\240\350\013;\022\b\206\235\345\333\322\226\027j\023f\036\364\203R\227mn\036\301\003\032"
+	.string	"+\341\337cp-\\\325\212\206\013\261X\021\r\310\003#\\\207\247X6\352\266\"!\023\214u\301>P\r\256\030\202\b\215\273H0\235\263\017\203\205\235+"
+	.ascii	"'\236\313\350\230w^[\306"
+	.text
+	.section	.gnu.lto_cliAux.part.0.563.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`*\020\235J"
+	.string	":|\250\033B@\236R\007\317\r\360\f\354\343\253/\305p\326\323b[\034\030P\035\205\354\021eE"
+	.ascii	"e\001A\316\b \017\260\213\271\007\004\f@Ayu\025\306\t,\251{\016"
+	.ascii	"\274.j\311\n\376\203[\332\266\367\2262\245\233\001\221\001\260"
+	.ascii	"\001{\313](\272\271\303W\356\217\346\323\270\303\216\343\347"
+	.ascii	"\274)\317\327\336\033\306\321\372\273\361\360\027\363e^\316\341"
+	.ascii	"3f\3148"
+	.string	"\035\323\270\367\030\230\234\205\342\273q<\234\251u\335]\322\2757\334\217\211\237\214\323\375\366\332\357\203\260N\220p\357]\241\370.\263}\345\373oav\344\2460;\206v\337\376.\262\2727\204{_\233\336\365\247\342\273\260\353\374mX\035\032\253C\257A\316\177\345\361l;\220\256\333K\3529\273\277\227_\213\237m\307\023\355M&Fn\357\253\203w\035A\361]\277\376\362}\267\370\312\367]\367\357\342\356<\334\347\374\265lK=v\237\203\264\265\261\236\352\332p\271\031\356\275\233\357\352(\037\377\221\321\262H\231$\032\022\n\002B\302Gc\221\370\272\255\316H\261\2771\332\205\365GFr\2574\346u\366\313\242\226\311f\217\353\373\244fm\0012\261\303\257J\251Y\231\244R\225N\311D\304\fc^f?\3242\350\223Ji\227|P\006\313\262\220\330\007\211U\245a\031(\360\225\372\244bM2\222\311\303\355\022\037\224A"
+	.string	"axF\276*]\222\217L\224\252R%\331\2504\346\005\366E\346\336\373\253\322\257L\374>)\030W~s\264\013\311\273\255\022,\0160\250\013\3326"
+	.string	"DS\002wm\345\266\035\340\246M\226w\363yH\027\2645\300\344\t\231\307\323\312\272]\022\251\022\375>i\225\226\001\341\\\236\227\373\f\244++\347\344#\0213\354\275\375\237[\336\223\336\375\253\356^\304=\350.\277\204FO0L\355\316\267\371\302\252\027\214`4\307\327)\361\006V\240\363\204&\374\251\357\372\211\024\371\243)\364\267y\025^M\256iI\306 y\346\254\353\317u[D\254h=u\345;\335\253\265\306\352\271i\313\323\312{<\231_\273\257`\221?\2525SKc9\204\177\2355q\272\226\205b\311\312\331\254\247\256\221t6\233\315\272&s\377\353\377\3231\273\0048{\204bv\b\310\354\017\216\331\233pv\247cv\007\307\354\r\216\331\233\340\354\f\216\331\027\034\263+8fg\202\263'\020\312\276t\314\216"
+	.string	"\316~\240\230\335"
+	.string	"2\273\022\234\235\tg/"
+	.string	"g'\200\314>"
+	.ascii	"\316. \3001;\200$$8\373\021\234"
+	.string	"\335\b(\373\262H\231\f\312N\004g\037\202\263\013\301\331\203\200\262\003!ad\366#\234\335\370}\357\305cv\342\307\275\277.1{\373g\336\365\277\275\347o\373\177\022\355\335\240P\330\336D\262}\266\023\027\315\331\237\371\217\373\177\373g\363o\367\337\367\017\370q\246p\370\024\224\003o\274\252\335_\3272/\342\324\013\241\232\341\326\2726]y\225\366\261\365\2342e\331A\013\r\367\2766\3375\272\277\377_ `\206,\037\036\356\266X\331\373<\1777\016\367\361Q\361Qu\031\326\3751\241\206\356\333\\}\2367\313\366\336j~\316\377\356\361\034f\263\246jM\225\327^\335\341\b;\2170\201\307\3279]\032aB\374uN&\326u\023\201\247lrj\206\001z\206w\374\316\\\220<C\355;_\246\376\261\2667Zy\017\323\375\242\352Y\205\n\020\320\005\b\344\035~\r\220\222\305\376\004\303\232\264y\002\364\200\274\304\203"
+	.string	"\375V\250yAzz\370\001\264\213\375\013\004\020\240\210\257ZG\317'i"
+	.ascii	"HI\372\003?yX\325\003B\322\356\363\257\213\022I\347\273*\033"
+	.ascii	"\344\221\221>2\242\263~-\251d$\261\031\361\371Gv\304\210rk\314"
+	.ascii	"\231ha\237\025O\032,\365.\213\364R\033M\307\274)\213\330\216"
+	.ascii	"J>I\245\376*\027\005\371\363\376.\276R$\3220Z\234%\1774\251\231"
+	.ascii	"\320,$j\351\036\247\345 \261\025\b\353G\350\002\211\022\351\343"
+	.ascii	"\037\\`\3248\244\337\3563\326\013\351!\375\320\260\267{!\375"
+	.ascii	"a\324\270\303\257\240.\331\207\223\370\364\333\313\\~2\364\243"
+	.ascii	"\205H\035\244\215\334\340\336\270\376\270\241\217/2E=u\344K\275"
+	.ascii	"@\372\253myH\r\244\205\334\304d\271\376<a\244\316\207\325&\204"
+	.ascii	"\322+H\210z\212\347a\355>\375\322\\X?\336'\357\252`{Z\032\353"
+	.ascii	"\325S\345\237\2303G\355\036{\311;f#>\375\234\204\251\355\275"
+	.ascii	")dK\274I|\203YV5?\377\247\252L\264\320\250\217\372\271\376\270"
+	.ascii	"kx>\033\212{kQ\360\337C\243\203Q?\023*\030\353\3323gwU/\212K"
+	.ascii	"\365\026\265\213\325\313\n\310D\355\376\001D\376h\261\210\357"
+	.ascii	"\314\317g_M\324\236\271\276"
+	.string	"\222\331}\365\273\371\344\341\031\037\375\237\246EIZ\273\343u\265\373\324\263\323\006')g\355.bD\376\250\253\363\335\231\236=\177\347\213\027\216\242\003\207\020\037^\277Zb\346\270\202J\362\030NN)\027TS,\242\254\232Q/\222rP\265\320QPS\332\006\215+\252\r6hHM]\301\260\322\340B\306\f\250\033I\031?\003\352\206\266\262QCK\321\2201Cj\n*\204\213\251(\242G9\311\230\021\325\244!\003j\252\031e\345l:-\235\252\206\224U\323\006\025\225U\023~M\346F\264\273\275\247\316r\375\355\336{\037\351\351\313\371\246\377\271\214\327#\373\204U\204\276\020\246w\237\262\342-\271'z\203\226f\217\353\313\366\020\312\0319\333\275\3070\020bs\326-d\004zI/\320\016tSK\320Z\177^\266\213\177\020(\333\033\372\321\030H\021\352d\212\205\304D\332\275Dcy\004-\201\216I\004\355\364"
+	.string	"\002\032\2779\271\007\232\004u\320I7\3158],\240`\2318'\215\202*\307\272\366t\373\006\332A\006\363M\272\001\003\335\324\225\307\300\r\212yc \347\220\250\245@/\200\206%1i\005Z\347A\253\t4\223\376\"\271\315\311$\210\215\255\306'\340\227k\002\375a\3249\3265\300;^\324\2264\n\352\234\303\003\032\201&N\343\262\361\221\314%\346r@7\245<e%\260xI\376\250\001\315L\213\331\\/@C-Y\2244\t*\035\353\032\204\354\036\213\305O\376\rZ\223\275\254+K\247<\364\316\346m\372v\032G\311\037\365\f\207\006\266\007\325Xp[I"
+	.ascii	"\213\336\26368G\264\bne\236\362geU\314\376\266\304\371QbM\272"
+	.ascii	"n!`\224>,O+\021\333+%fs\261\200N\312\242\364\240\372m\271\363"
+	.ascii	"\261\331K\026\233\271\330\277>P\306\244\324\201N\250q<\345\220"
+	.ascii	"R\206fDD\222$)t\241\005\204(\345$;\017\021\0201T\320\310\214"
+	.ascii	"\220\024\326\310\260g\2354\311i\376\347i\376\234\303G\240\002"
+	.ascii	"d9\001\305\212\026\273\243~m\264X\311\336D$\016\233\251\377\024"
+	.ascii	"\233\372U\220\351\r(\215Z\244\305\3774\321<~Z\"\376\237\214\217"
+	.ascii	"\032\300(\271(\255-/\355A\230$b\206\020\277\bWdHK\260\300!\336"
+	.ascii	"[\366\343\017%\355h\365KF\275+\270\345\313.\013},\236Jr\032\251"
+	.ascii	"u\325o\021{\nE\211c\311\177\232\006(\376\367\211\274\270\223"
+	.ascii	"\nI}<\020yDi\337\254\2072\344,\\\261-\233k\177\035\271l\320\004"
+	.ascii	"\254\226\234MbH\353fw\266\r\210\201\017\204\032\336\240\312-"
+	.ascii	"\205\333wG<\355\302\262\""
+	.string	"*p\356^\364i,\005\226\302\261\236\332\262\001-/\323\3217\207\270x\252\373\305\303\354c\237\212G\335\367\220o^\2561\316\341\265c!.\260:V\277\346[\221E\277?\n\275\252\031\273\036G\022\b\rT;\324I\312\342\251\324\244\265\307\3215\323/2n\346Zn\256\234\201\331\031KT\344\311"
+	.string	"\320P_j-mf\375\264\001\326\212\222\007XMP0\221C\270\244\177i\372\207\253\317\202G\300\230B\204\007\314\255\0311\266\357\262\2741\343\220/Lf\221\031_\372\264\0231\325\032n~\260\"r{#\302\333s\020\320\227\311\334\360?\346#,\347\2443\037\256~\247Z\260\363J~\267N\210\005!\t\244vCY.\213D\260V\243\255\3015\341\217$\373\273H\205\\P\356\332}m\352\023d,I\006\215\303#\006\035d\235\3603@"
+	.string	"\214\330\345\221\2378\026\231B\217\241\016\257\b\205\271\221\342$\304\217\366\3410\254@\243T\265\373\226[0\261;2\207\303\320\003x\211\315\235\346\376\017"
+	.string	"\206G\331\360\256\231I\346\201`n7\036&\376\351\026DC\225(\036\001e\344q\235\205Yh\262\376%}\221Z\335\312W{\336\370x\265_\212\306\232\312\025\220\2503\245\233"
+	.ascii	"\020Sm\362\336\311\202FP\201H\002m\337\020\267XNt=\005\022\205"
+	.ascii	"\356\247\032\201b]*D\222k;\0371\035Sk\220\245\357\236\nf]e\235"
+	.ascii	"=y\323\344_\375LY\347Q\001"
+	.text
+	.section	.gnu.lto_tryPrepareSave.part.0.564.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\031\001\345\r"
+	.string	"v\231]F"
+	.string	"\257(\035\300\266A\035\310\n\024A\020\003#W\264\226\006\376\037\314#\331z\303 \367%\\m\024\371#[\0204P\271\\R}\234 Xt\020N\001\322LD\177\205\2706\027\203\217\302\377z\026J,\331D\356\224\002E"
+	.string	"D"
+	.string	"K"
+	.string	"\236\354R{\200\354\322\276\nwx\230V\266\335\341qr\370\271\242\362\324\264:\270f\354\316\356RQ<\274F,\364c\n\005u\275\353X\353f\346\304L\013\224\020\217\235c\234\217\335\265&\342\226\267\235\3006\310~\030\022\006\313cn?\306\344\273\274\331>\314_B\257N>\214\267K\377%\344PsU\031K\313l)pi\003\2325~\232\356R\"`.\210\2255\332_\361\326\351.%\007\260\313z\275\330\235\007.M@\273\364|4$T)\257U\023\336\242Ma\344\202fD\f\023EY\213g\361\027\206ne\367\344)P;A\360\271\274\332$\032\342S\276\353\377 c\223\302F\006\007EEU\261b\307VY\266\243\343\347\377L\326\310l\244\354\252j\320\330\022\001\376x\021@B\037.\304["
+	.string	"\201\013\201\034\200@\036'\201\201\002\316\013\201x\r\036\f"
+	.string	"A\321\367\221\200\034\321H$d\302\350\343\370\343\030\251\360u\026FDF\335W\002;\016\217I\027D\245.\003\211T\352\266c\253\254N\364\303,\252\007\365\307\0065QU\271\t\033"
+	.ascii	"\357b\364\204\233\244h$\2064|\200[\220\3231\001h\251\273\001"
+	.ascii	"y`\204+\006\356&\036=\352\302D\022u\234\224\331\226=\366\310"
+	.ascii	"\237\207\025$\230\316\331\207v.\250\211\214:-Qj`\233\247^[\306"
+	.text
+	.section	.gnu.lto_cliSave.part.0.565.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\361"
+	.string	"\275\013"
+	.string	"&\224KC \251*\035\300"
+	.string	"/8\234\251Y\036\204\022\037\354\201\372\322_\022\t\030\257#\b\204/\204\225\326\0211\202\261*\256+\030Iy \250%\t!\004`\314B\234\222\237\361\021\024m\220\324\234lDh\223\275S\n5"
+	.string	"7"
+	.string	":"
+	.string	"6\355\345j\001x\264i\021'Kf&\314P^\024v\327{\245\005>\236\316m\364\377:\303\tE\2366\240\002|>|\263p\354\2569\001w\275\355\214m\r\373\241\376\202\277\334\271Z\"\332\022\315.\270\263H/G\023\344"
+	.string	"\213W\317i?\301\025\214/Gw\330M\301\034\354\226\030\257\246\340^]\376Ry\345\016Qy\355^\177\3006)\273\246\237B\316\224Q\361j\213!\264\026\223\231P\322\225i\207H\346O~\203\032\004Y\211\222\223\252L\267oKSv\235\0256b\273)\027,,\201\372\300\300Y\277\353\366\021\220\002\346x\300\021\r\310\262\361\200\235M\250\351\360\b?\213?\f\330\371<\017\250\t\275\357\003\3620\027\213 \233\217'\"\212\037o~[\232rW\223 +\241%JU6'B7\317\340\260\017\211U  \320\002\"#\035{x_1x\033\271O\002\243\300\267\244\\f\022\355\334\260X\fy\036a\210\021\206\304`\005\035D\031\352\354j\270\302\007\341\211\303n\227{\337\276J!\356C\227\001"
+	.ascii	"\357\005\333i\212~\327\031\003"
+	.text
+	.section	.gnu.lto_cliDefaults.part.0.566.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375``\001\215\016"
+	.string	"fZ_E"
+	.string	"\2178\035\f\373\300\353\215\253\277w\r\230\277\371mpBE\261\313\217\377s\341\203\266_\261Y\314\\`&d'8\340\320$PA\001&"
+	.string	"U\355\256\360\216k,O\033\322\337M\231\306\303{ \022\242M\266L)J"
+	.string	"L"
+	.string	"I"
+	.string	"#l\223l\231\213)k\342\317\226\331\250\260\240\307E\211\005Ukw\265O\t\342\337/\251\363\3637!\370KO\241\206\313\253\300L\212\026\031\241\351\352\240B\234\276\272^\bK\252\002>5\037\273\353l\303\215\3356\003\333\n\354\277\004*\221\001(\230\025+\255\004\331\347S\346|\332\303\363\335\304\b\007(.\nS\201i\255\264vE\003\237>\220Y\365\"\351,$\033\342b0\261\252}\022/\361\235\205\344\001vOP\260vE\004\237&\220}Z|\007\373\314\256\201}\332\017\027\221ba\322\321\032\275\264G\022\364'\225_]#5\2061&\t\252D\261\234\277V\236\330R\255\027\377g\023F\t"
+	.string	"\017\273\250\030/\366\303T\241r\227\277\345j\337\376\t\222\357\362\2259\266\207\207\364\026\225\b\007\330\201u\005\240\020\027\002\322m\232\321\003\316A\310["
+	.ascii	"\232\360\031q@\335\247\001H\267i\274up!\233\026\342>\235\266"
+	.ascii	"\211FZG\307\036\004\220H\213\340y\"\215\363\017\n\262tqr\344"
+	.ascii	"\260Q\273\363\364'\377e\314\020S\222\240\345\2372\316\260\244"
+	.ascii	"D\261=\202\251\f\" `\202A5\334\001\2571Z\t\206\341Ea\221\201"
+	.ascii	"\326\242\253\211\360\335Z\033\260\362\330?<\023\3050\177\270"
+	.ascii	"Z\032\3733\360\023\267\354\206]u2\260p\321\261\224\266I\013M"
+	.ascii	"\310\274 +\303\006r{\331\226\354\335\335\265\202\204\024\357"
+	.ascii	"\243\345\344w\005<"
+	.text
+	.section	.gnu.lto_cliProcess.part.0.569.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`l\001\205\016"
+	.string	"6\\aD"
+	.string	"\221(\035\363%O\333\332\317\367!\350D\216\330\025\317"
+	.string	"\276\367\3058Ep'\276\217!\0013\"\252x]\257%\360K\3775)\341\321\347^\265\376\2365g\212\212\302\253\354\275\303\345\032}\373v\357-eJ\001O"
+	.string	"M"
+	.string	"K"
+	.string	"\357T\313b\222\355:pZ\016\033\020\256\225\230\032\273\233\035\352\213_\222\016\237f$\371[\351\360mN\250\024\035\333\351\221\300^3\347\236\0366S\276\324V\244\256\347\316\241\261*\021\323\266\324\263\300\343\246dw\315\021qon\033d;\201}\031\001\357\245\365\254;5\375"
+	.string	" -\020\022\273\250\030\2165\001gT\234\365\333\367]\274\205\017\343\016\313\"#\243w(\376(u\213b\261\310\b\351\035\312\200\255Y\001)\231\020\035^\273\235\202C#\340\034\332\347\356s#\273\3239<\013\333#\333\025\366\311\204\274\226\372\241\242%\3731\207\261\301G\341\017(\257\035\372\240xx=\314\033\234h\275X\215H\311\230\365*Cs\332T]l\003H;\204!\257\371\334=>\274\334\2501i)\325\305\032O\242\202\275\254-vLGMC\230\016\236\333\023\362\241\340\311,|L*d\036Q\206,\304\303\241\013'\242LC($\312:\266\363\332b\227\244\250\t:\210Q\027\314PI\230\r$T\373\001\204\274\026[P\317\235\201)F\314\306\333\335}\004\362\251\035\301D\365\351SU%\254T4+9:\362\032\036"
+	.ascii	"\357\302\335<]c)\374yPt\320\262V\003|\331\300\021d\221\243\031"
+	.ascii	"\016+8%t\314Am\253`@>\3202\264\326\264\302*\237\270\20032\263"
+	.ascii	"\305\242\304\005\241;\003\004\267\301\355oQd$5p\315\373\257-"
+	.ascii	"c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\270D\325\354"
+	.ascii	"\n\243\361U[`HaN:c\307\333\235\333\260<\025\033\372\326GZ?$\371"
+	.ascii	"\2635\323\335O=\220\245\334b\335\rBi\f\261.\347?\207\207\230"
+	.ascii	"F7w\226\215/\354\037P\322^\300\2433\023\237\316L|:k\r\354\177"
+	.ascii	"\277Fe"
+	.string	"\224\031\235\257WF\372\376<\032>\225}d\301\300,[\245L2?\005M\005F\005\346\373\215\212\350\347?\002\320>\343\027\260\177\374I\004\035\0019\030\260_2P\241=xUh\016N\030h\b\3708\351\233g\235\224\204\330\273(\264\207\256\005Z\2526\034\215\332qQ\265\345f\324\236\203\252\034\344\251r\231Se3\031\225\2054U>\213Q9e\252\234\006\243\262\332\213\312C\226*\263\271\250\274\246T\271\255EedRe7\026\225\211 U.rTKf\254\250\335fT\273\b\2616\221\242\332ngm$Q\355\264\241\332^B\265\277\202jo\251\250\315#Em-\240\332X(jg\375\324\306\341S\333\330S\333\352D\355\"Om\033;\265\253L\324F\207\265o\350\324\226\311\251\334\243Dm\0218\265{\334\324\256A\242\366\224M\355\250\232\3324F\324\206\242\251\2554S\333\205\210\332K!j\2770k\303"
+	.ascii	"Q;\247\254=\224\251m\242DX{'\257\366\t\274\332=Ij\373$k\377 "
+	.ascii	"\251\215\342\2566\220]\355\024u\265U\320\325\016\232\253-$W{"
+	.ascii	"\350\204\332Dq\265O\270\3326G*\327\275UNb\244\362]\221\312H\210"
+	.ascii	"T\376\341V9\fYY\254\255\362\030[e k\265\231\206\324>\242V\373"
+	.ascii	"-\255\366\217c\355!h\265\327\322\332\346Ym'!\265W\230U\266+\253"
+	.ascii	"}\024\244v\013\262\312I \265\215\214\325\236\021\253\035#\254"
+	.ascii	"v\323\217\3322\300j\323|U\316\362\252\254\345\2432]Wm\235\036"
+	.ascii	"\265\217\\\265\271x\324f\261U\273H\25361\253v\211\035\265k\260"
+	.ascii	"j\217\320Q\273\314Q;\304Ue<\034\225yXU\3462V\336\272Qy\307s\032"
+	.ascii	"\255\214\365*\226+\362\t68\256G\305p\275\032|\304\255\366\t?"
+	.ascii	"\362TS\225u\364\310\361c\327R\225s0\r~\213\342\343\214\367\200"
+	.ascii	"b\264\247s9\361\\O\306}t\023\223\305\250,\305\364\256\036\214"
+	.ascii	"\3124^T\236\261TYF\006\027\265\344\251\225*7\265\250\034#\251"
+	.ascii	"r\311\242\2264!UNqTygE\345\033lT\031\345&6\332\217N\307\372\f"
+	.ascii	"H\013)k5\26263\3532!\035\344\254\311\2366\020\264\036\353\025"
+	.ascii	"\265\330\261\303zg\345*\242\312&\206\032\254\267j6B\330\265P"
+	.ascii	"e\240\016\252|BEe\236\036DM\235\242r\020P\345\037\024\235\243"
+	.ascii	"\347\243u\364~*\227\350\352\253"
+	.string	"\336\2132a\373T\326\271\361\201\243{*#\235\250|\304\323T=&2\264\331\321;\225Y\370LTV\3120\254%F\257Iq<[\247rT[\347T~*Q9\t\247\262\213\233Zrr\223\250\334\202\277Z\252\3276\225\213\3345\347!\3263z\f(\302T\354\021\225\205\234\342\324\2505M\345\0323m\324\333]\026r\tw1\344\335\2526\317'\230\333\262\321\"*\317t\210\276i\263I\364l4N\257(\024\n\033D\345\033\356!w&\324e\375\334\272\261\200\332i\231\312>-\254<\225W\177\306x-\354%\341\274^\262\376\004$\365qw\225\235*He-\261]e+\256\253\227c\272\006q\243\256\265;\236\253W\223\253l\203\317\304`'\360W\034{\301\261\217\336\021\356\352\275U\246Ba\244^H\221\3120\210\324\022\021\354VK\234\220\225\211m\265$\212\311\230\255\362\325Ze\243!\337\321S\273\026"
+	.string	"\336t\334\340\264\3128\337\372\326\n\235O\031\037\353\363\320*\217\340\2642\r;\360\242\252\214\317*\313\034\254w,\261\220\312*\330\354Xe\225Q\004yV\017"
+	.ascii	"\3065\032&\253\234\303@*\333\260\222[\035\217U\256)\352\244\336"
+	.ascii	"\257\314\326tX\254\262\031\326H\275\037\225A\034\021\001\203"
+	.ascii	"\301*\223\370\252_\363\252\037\363Q/\306]\024z\273"
+	.string	"{\263\212{\260\261\367\241\333\340z\321\307;\354N\230`\036\225q 5[\324V-)yw%p\243~\352\355n\006\255Z\"\314\252<\374\331Q\037\344\007\253\336LG}X\216\372:\276\252\\\344\303Q\371\364YU&\342\335\3452\207\206\261\376\307\316\215Z\"\003\255%12DU\325\222\242\f\305ZB\224\301F-\001\221\201\252v\222k\324\273M\325F\"UOG\243\036\316\027U\177$\303\214\332w>\250z$\031\242\236j\327\3758\325\243\311\250\267k\252\277\213\212Qy\211\177\230\352\2170^\243\367\242>].\032Ul\274T\377\225\301Em:V\252<\324\342R\275\244\312+\230E}\033#uWow%\300G\355c\305\253z\373\225\364\325\202\215\352\221L\254g3V\016\301E\225E\234\277\321#\252\177\033:\332\023\2527\362$\037&h8\250>I\003R I\254\242>\211RU\266\306)*\367"
+	.string	"\375\n\305q\364:///\217\177*3\371\324\223\365\324\203\361\211z/\236O\365v\352\313\230k\306G\324\0031Q\031\212\207\267\352\365\356\315\"\353\334\330\313\251\374\342\215KT\026\302\251\307\303"
+	.string	"\351.\3117\365Cxw}\302\262\314\211\332\255\273[9/\021\n\205B&Q\237\306\273\033\001\031\001[\367\255\253`\353\332\004f\351\332\344\214[\272\376\241\337\261\026pD\213\\\272\366\245K\327?+X\272\245k`zN\021c\311e\347\032X\276\202T\026\f\336\27169av\256M\312;\033 \230\026\271s\355C\337^SUy/;\327?~\217(\214\212'\333\271\255\362\250\354d;\327-o8cS\027\357\334\306\255\334\3125\005\322\t6\256)p\236"
+	.string	">K?0\033\327\024(\337@\221\324--\001\275\t\035\323\023\t\351\177@Y\303\227\215k\020\320\337'\006\013\364\303y \224O\321n\\\177(\177\0252O\036\224\377Aa\351P\371y\331\270NA\203%\3604A\177\345\027\210\216\214\241En\234\333\302\365Q\267\376\271\310uk\017\307EVX\344\"\331\266\255\237\376\233\325\226.\333\016\267\243\024.\313\326\276\362l\343\263\266\263Y\313\326\276\223\251d\331\332\207\272,[\335\2565\007k\035\263\326O\277VP(\\0"
+	.ascii	"\355\260C\372\347\233F\2164\257\325\332!\355\341\351\016\341"
+	.ascii	"\035\322-\f\254Z{\230[\265>\272i\253\326>\272U\353\017\345K\354"
+	.ascii	"tD\354\325\246\265\007\350?V\205\363\262i\335A\271\301\246uL"
+	.ascii	"z\316\021\266\343e\323:\346\374\242\361(\262\307M\353\013\347"
+	.ascii	"\327\315N\n\212\302\2465K\271\301\246\365JIa\323\332B\372\375"
+	.ascii	"!\342\311\370\262im\341\274\311\231\211\037/\233fw\376\260=\335"
+	.ascii	"4\r\366\3307\312\355q\217\253\265\307fA\377\"$V\335V\355Y\007"
+	.ascii	"\323/\\\030\016\315\026\367\254\177\3063\020\253\036\242\247"
+	.ascii	"_\300\b\255h\265\366\254!\360\223\265\246\251\273\355Y\253\234"
+	.ascii	")\345\2718\334ZBI\253\326\254O\320\2378\347\023\267\3055\353"
+	.ascii	"_i|\247\321\f!\272\333\232u\313n\255Y\277|\261V[\026d\313\312"
+	.ascii	"\232%H\243\004\351_\371c\220 \215\241<\177\265\260B\261UK\326"
+	.ascii	"*f\212\361=\204\213\212(\210\376OUE\352\266x\374\021\037\267"
+	.ascii	"d\355K\177<\233e$|~\302\222u"
+	.ascii	"\313n-Y\243T\355X\003\323_p:!\266\305\035k`9\266\264[;\326+\347"
+	.ascii	"J\231\202~w\364 \2519)\2536\254M\322\342\206\365\357\374O\274"
+	.ascii	"\230\333i9\006Hwo\273\265amr\276\215H\365\330m\325\202\265/\335"
+	.ascii	"\342\202\365\211g\232\271 \256\273-X\267\354\326\202\365\323"
+	.ascii	"\033\373\3257\036\331\257\276y\270\375\352\230\365\332\257n\341"
+	.ascii	"\375j\224\362\235\344\303\304\210\255Z\25769\213\353\325\277"
+	.ascii	"r\267\326\353\230\203\325t\267\365\352\226\335Z\257\376Pn\025"
+	.ascii	"\361\373C\246\205\324\315\266\2531\224\347\300\346\004\265a\273"
+	.ascii	"\032h\026\331\256>1\276k\264\342\352N\312\367O\226\032Sp\273"
+	.ascii	"\372G\374\342\240\242[\272\221\355j_\032<\276\031\305\266\253"
+	.ascii	"o\376 \332\204\274\275m\273:\346{Cn\206h\271\266\253[\266\253"
+	.ascii	"-\244g\030skW[\265\\\215r\026\227\253\177\250\217\370\027\205"
+	.ascii	"@\303q\267\345j\017'\262\\\\\255\222\276\257p\354zl\325\362h"
+	.ascii	" Z\\\036\375+wky\304)\311\345\335myt\313n-\217\376\371\363`\365"
+	.ascii	"\240\253\265[\233\265ZZ0\233\265Y\035tzPiG\323^\225\254\240\357"
+	.ascii	"p5\343\007\205\275\352\224\364+)\022g\203\275\352\024\363\rH"
+	.string	"\201(\275m\257:\210\236\202\231\026M\260W}\222\236\265\346\334\256Z\366\252}\346^\365S\230\275:\352;)S\326\252O\316\223#J\n#\270V\035$\236P9\276m\255\332B\371=\202B&\305\206\265\352\225s\345\310\202\006\315\177\350\b\f\244\213\255U_8\036\271V\375\001\375\323\2208&\266j\255\372\203\322\352\345\215\377[\016S\217\357<\377\bQ\202)\2707\332w<\003\t\235\271\270\330\336\350\037\372\317\225\355|m\330\033}r~w\310H\315Q\2607\032\005}\003FTi[\2657\032%\245`o\364\323\255Z\264\237\302\030\217g\205\255jZ\023\322y\332V\265\257\2049\036\321\n\304\247m\261_~\215T\225\251Q\330b\267\274\300\274l\320-\035\036\320A\203\366\031\211\036\244C\373\312\177\251&H\310\002:\254u\350\233l\035\232\003\006:t\313K\207\346@\303K\267\034 \203\346\240$\003\f\034\320"
+	.string	"\006\fY@\277L\200\002\272\005C\002,\270\240}O\317B\241P\246\002\013\324,h\037\372\253T\320O\177\241P(D@\005\035#"
+	.string	"\004t\314\377\223\245\006\203\003\005\315\301Y\255\351\247\207\013\005\034\372\350W,h\016\206\206\t&\230@\202\r.\007\350\026\227\003\364K\r.\021\270\244\271\364\257\364\031\217\021\264\217\030A?\375\251!\202\216\201@C\337|\027\004\355+O \350_y\266\342\t\013\322-\375\343\373H\006I\367\263\226\206@\332\322\032\336h-\r\001!\0310t\314\373\352G\b\235\025\226>\321l\245}\307 \003h\237\371#\335\275q\275l"
+	.ascii	"}S\003\231\003@T\332\303w\b\027\325\320\307\004\320\036\376\""
+	.ascii	"uy5.\226\322-\347/%7\273`JkxX\260}\001-X\\\360aw`\236\003\\\215"
+	.ascii	"\251\303}\330+\350\027i\243\343\202\017\333B\271\037\266\312"
+	.ascii	"\361\275\021&\317\305>,\222dw\301\207\235b<o)\255\335\310\207"
+	.ascii	"\215r>(w\026\346b\344\241\017\033X\366\207}\202>\203$0\254\337"
+	.ascii	"\207}b~{\304\261\305`\242\017\373\007\363a\377\316\225\373\260"
+	.ascii	"}\310\017\373i\326\207\255\341h\037\266\212\313u:\345T@Jw\235"
+	.ascii	"\006\242E6\357:\r,o\256\323\306\242\313\3509\327i\223\023\346"
+	.ascii	":mR\312]\247\177\351u\314#\344\024\314u\332g\034\236\354:\355"
+	.ascii	"39(e\271N\337\004r\235\326\360\261\3538\3409*\236\223\223#\200"
+	.ascii	"\347\344t\314\177G\224\227\3438/\001s\234\337\034\347\307q\354"
+	.ascii	"\216\323\277\362+[*\342\032\360\233\366\035\337:T\020\3038\305"
+	.ascii	"o\320\220(\326\305~\323G"
+	.string	"\223\277\351\227*\277\341\3374\313\311R\246\177A\302!\265RZ8U\320/\034\\\221\017\230\333\264\312\371\016=HpR\320\024\005\375\376\bQ\002\306f\245\310\3334\26049\223\267\351_\371\007\310r\310\371\320g\020\245\303\366bd\024\267\351\237\233u\233\227\3330\320m\032C\371\005\216\350\210\242 \275p\336'c\325\265\311\323\264\205\362.H\2306\234\246\203\307\227\244\240\261\343b\247\251\3711%8M\243\244\247 \\B\n\236\246Q\3167\327\013-\tN\323'\3063\300\025D\356a\247i\023\364\301\020<\216\202\247i\237\361+t>B.v\236\3464}\363\026L\331\271\340\237\323t\013\237\246-\244\377\235;D\227\317\264\n\0324\376<r\214fx\3473\215r\002\215o\265\246\237\256'\371L\003\317M\032y>\323'\304\017 K\r\006\237\370L\233\034\257Rz\231\231\234\317P\344\316\213?\323&\345\357x"
+	.string	"\370\324\230q\317g\372G\374\225Y\237i_\372\006\250\350\3006\371\231\366\021/A\022#J\354\363\231~z\337\210\0233\024|\246O\374\001\212ZR\027\373L\307\374\202\231\020M\301\317\264\206\247\237\351\3230\031\204\321|\"\376\304\03298\004QD\2239s<\347@\242\30341\210/\031\242\242\206G\2740k\2166KF\022K\346y\352\b\027\337$\225W\2419J\333\344\221\3118+\316\377\210%\334f\021\271\304\315\376Y\376XH\330\322E\022\037\342fW\240|\013\005\241\240@\231\276}\234@,\362f\233p\276\002\253\235\022\210\367\ty\361\30397{\004\363\025\202\220[\254s\263A(/\201\214\255\031\037\240g)\273 \037\210\347\360\226\203\207\2077\333\203\364=\004\226b0\276\321dF|\261\240+\306\266\031u\233\274\331*\346QJ,\325\\\314\370\013Ad<)fz\263\203h7\033%u"
+	.string	"h\376\201\241\315\361b7\373\204\370\f-\224\254\330\304\31569^\203\0323X\234\354f\377\216\177"
+	.string	"on\211\313\233\035s ]X\316\206\233\335\362\t\346\266l\360\315~\034\372\037\201\035%\210+\277\350\330V]\330\037\222\376K\310.\032\307S\330al\242Q~\213|AmH\241\312o\026\023\327\213\364.JH8,\035\277qe;.\326\342<\343e!IJ_\262B\007q\223\304\367\226j\204~T\236mj<m\270\260\277\"\375K\020\231\027\225\347&\363X\201\362"
+	.ascii	"8b\305\341\3026\241<\005;L\034.\354\022\312c\300#\005\207\013"
+	.ascii	"{\002D\343oc\004\005\t\346\271\247L\206\b\351\027\370\001\302"
+	.ascii	"(\375k\2128\205`\336\204l\207\n\204\364L\3341\333pa\1778\177"
+	.ascii	"\001\0134\016\027v\007\350\037\200Lr\270\260c\2141&\006\342\357"
+	.ascii	"\2036t\341xf\302Q\265\202\036\303\016\026\207\013\333\202\361"
+	.ascii	"\377\271s\272\330\205m\301<7\235\320\226\202\006\323\003\261"
+	.ascii	"\224\250P\210o`\006\022\022\340y\202~\277\322*\270M\036/\301"
+	.ascii	"[\217\271\303]\330\277\363\r\224X\252Y\036\027\366\315wQ(\224"
+	.ascii	"\321\300\345\205\315\202Z@UP\230\315\353 z\246J\316\261-r\363"
+	.ascii	":X~\331\210\254\344^6\257\201\3451@\272+\362\262y}r\376R\337"
+	.ascii	"\371`\212g\264\311\315k\226\362\031\244\030q\265\311t\305\370"
+	.ascii	"\r7TB+\346Y\232\274v\236w\256\326\342\265\205R\345x\226q\026"
+	.ascii	"\244b\376w\324#\211\205\247\313\342uJ\031\200\343y\314\306\210"
+	.ascii	"\343\021\335\026\257\203\346\027\370I\322s\274\305k\024\343\035"
+	.ascii	" \"\344\304\363"
+	.ascii	"\026\257O\322\263\034\021\261\271,^\377\314\033Y\274\366\031"
+	.ascii	"Q\260\314\342\365\3217`\223\025\304e\361Z\303\321\026\257=8\336"
+	.ascii	"n\223\264\007h\007g\214\371 \326\335\324\3576I\257\034\217\004"
+	.ascii	"]97\271I\332$\375\321\220h\216En\222\376\035\277G\344\316\210"
+	.ascii	"On\222\366%\331$\3754\346\017\354\324\230\261Y\233\244_&\223"
+	.ascii	"\311d\243\244[\267v\215\202\376C6\214\230\f\254]\237\030\335"
+	.ascii	"\326\256M\210\377\016\212#NW[;\273F)aR`\371\026\n\2052'0[\327"
+	.ascii	"'g\034\314RM\320\"\267\256}\350V\373CK\316\r\216\325?\363X\355"
+	.ascii	"K\217\325>\343\261\030\353X\355\341X\035\263j\327\321&\234%\240"
+	.ascii	"$\034\241^l\022\2143^l\022N\022\312t\004b\324\213-\302\221\306"
+	.ascii	"\213-\202Q\352\305\026!\004\343\213\035\002\021\004\363\003\243"
+	.ascii	"\007T/v\007\306\016\314\032/vL\212\306\020\331\306\213\215\341"
+	.ascii	"X|\2611\240\030\314\252\027\373Bz\341\374\017n\355\207\245\374"
+	.ascii	"\342`2\335V\322[H\221\344\354\345\305\016\032\321\027;x\002\323"
+	.ascii	"\337\252\304\022\r\360\374V\211P\352\201\276\274\330&\347&_\354"
+	.ascii	"\237y\303\370b\373|\246\325\213\375#\216\027\373/\366O\344\213"
+	.ascii	"\247z\261=\\\275\310C\257\321\276\364\037\212\270\231\271\324"
+	.ascii	"\247\332gr\320\247\372\351\247\372\347\004\237\372T\267LI\265"
+	.ascii	"\007~\272T\277\324\340Rk\247\021u\032\035\223\301\243\200\217"
+	.ascii	":\324g\220}\306g\034\365\231>\243\211\t0=T\243\224(\306\224\363"
+	.ascii	"P\235r\274\330\241Z\205\370C=\241\200b\031\346WG\210\036\265"
+	.ascii	"\267\021\331\351P}\341\350\2011\356P\375a\223\207\352\017\207"
+	.ascii	"\352\227\347\247\216\021b\360\247\326\360\247\257\"k\351\211"
+	.ascii	"w\312\2202\275X\255;\241\255 \n\342\030w\352\037z\ttz\202\\\356"
+	.ascii	"\324?\363\017\320u\ta\241;\265\317x\f\264\204[?\362\322\235\230"
+	.ascii	"\356\344$\343Foj\023P\005\234&\224\277`\307\021d\t\350\004N\022"
+	.ascii	"\312\021\316\263\274A\215\211P\276\244"
+	.string	"!\24077\352\020\316\017\316\263\017\252\265\271\2278\237s\243\376P>\bFD\330A\371\263\030\"\343\366\235\024\375z\325\230\201\264v7j\f\245Y\352\205\0069\311n\324\027J\256t\f\005;\317n\324,%\217\033\365J\230\214Eo\324\026\312\305\273Q\253\244o\371)\212{\320\215Z\245\034JO\274Q\247\24007\352\2242\230\376\204XL\n\226Y7j\224\364\016\020b\244i\265N\267\0335J\251u\243\006\022\337A7j`\311r\2436IMJ\337y\r\250\246\3223\020s\251\345F\375\363(W%\210\226\033uL\313\215ZnDd:\261Y\3167\220b\310\334&\1776Ky|\201\276\374\354\025\342M\266\232\2200\214\237m!}\217\311)\311f\375l\0253G\n\352\362\263\2010?\033x>\002\234\031\026&\351+\304\211\270y\371\371u\006\365\364g\377R\230\237\375;\277cG>8\026\371\263\177\276"
+	.string	"lD\364\345gk8\332\317>9\337\\.\336@|\350D}R^%L\211l\265N\324&\304\257\361l\346\006\2738Q\377\320W\320U\"\351r\242\376\231\317"
+	.ascii	"D\310\f\013\235\250}\306\243\235h\351D\355\341D'\352'?\344A\206"
+	.ascii	"\225>\324+\311\013uJ\372\n'\214(6\\\350\356\004+N\272P\007\317"
+	.ascii	"?\240\003\214M\202\0135\n\361\006PA\327\002\370\260\013\365\t"
+	.ascii	"\361.?\210D\371\210g\022H:\220\270\305\205Z\303\321.\224|P?F"
+	.ascii	"z`\362\rk\303\201\3721\316\367\206<7\034\016\324&\034\257\200"
+	.ascii	"\247\254\021\0230\376BC\023I#\020/\200\034fe!\030\277ah\263\002"
+	.ascii	"\204\343M\210/\336@(9\034\250"
+	.string	"?8\236g\200\330|0_R\342\251\307\003\342\027\brsq\270\003)\325\235\340p\240f1W\214*\346\027k\351\016=\334\201j\220\035/v\240N1_\202$*G\220x\nsq9\300\364\353\205wC\005,?\001\232\221\260M\036\277@V\021\217\211\361%*\346t\274\355@m?f\207;P\377\316\016\244\241<P_(\217\302\"\306\321\206\3774\013z\340P\225\b\016'K\271\311\377\364\212\361O\323\030\314\342?\0354\337F\222dX@\3423\314\360\370\270\330\177\372\004\275\317\311H\017\023\363\f \315\212\016\367\237\376\235\017j\371\360X\260\377\260(\201B\003\227\377i\013\345+\234\031i\261\341>`I$\025\363\005\210\272\352\341\232\373t\n\361\004H\261\214\360Q\272\311\373t\320\370F\223\314\370\310\310H\367i\224\362\277\237\243\031\n\356\323\277\343{,\211#\3433\212\335\207\250\bi\365\236\373\364\315G"
+	.ascii	"\002\256\344\362>\035\363\224\021g\306\r\367\351\026\276O\377"
+	.ascii	"P\227\367\264\357\370\222\254\"#\327\274\307\t\t\216h\223\357"
+	.ascii	"\301Q\323\226b\223\357i\017\277\027\214$.\256y\217\330{\032\305"
+	.ascii	"<\217\\\204\002\211\347\"\017\027EL<O\237\234\017\300\t\305\247"
+	.ascii	"M\236\247M\216&\306\213\235\247MN\227\363\364\317\364\021W\234"
+	.ascii	"\247O\374\237t\204Hc\243\363t\013\237\307\304wL\344\334\204\t"
+	.ascii	"\023}\032\347\035\3201\\\273\016\215r\363>dI\002\213s9\345><"
+	.ascii	"\251\t\002\261\310\364\275$wR.\037B\360f\262\314\207\375\246"
+	.ascii	"\362\020\274\231\026\3040~\335\200\020\261\220\361m\037\366_"
+	.ascii	"\234\277\330\023j\301\221\205>\354'\035\241g#jc\301\361E\350"
+	.ascii	"\177?`$\351\017\273\022q\036\366aW\200\002&\2240\001"
+	.string	"\022\320\021\214\"\244\307\020\3123\300F\004\204\005\0376\b\345\267\250CD\242\323\003\327\002\204p\250\223ar\211\370\036\251A\346\0202\310\220\311\320\250\003\343\026@P\321LQ\3230\244\326\003\023\300E\017+2y\"d\020\212\b\fR\204\020\245|p\334\3476\240\237~|\f.X\355\353\231K\303\001\033\277\336\205l\361\352\232FZ\203\032\232EK\267C\031\373\243m\232\265Dl,\353\231\"\310\302\007\320\370Z\313\372@\271\"\215\021\361\037va\025\267?\341\244\346S\003\204\231\017\232D\252\370\205\004\252\222\311\351\261\360\252\252\213\265j\203MGT\216\004\333\226\332\276\n\321\312S\t\231\177\210\277\225\006\327\035/{\231\301p\031$0\274,\345T\032\315\226\220\311\315X0Y\n\245$\271\274\035\213\177_\225_\213\2507\033\216\233\331#u\026\354xr\347\357\270;\231\331x\310xB\034\r\270f\204\217t\210\317"
+	.string	"\341,\212t\207\323\036\202\353\274\366\370\241\251\333m!&\362Wj9w\364\243\034\301_\207\201\352bNO\026\366t\275K\252\201u\250\3214\036<Q\252\030\201kM\322\334\224\235\323Z\367\367\267\214E\222VN\335\227\006\204\320D\256\3747\t\370\0013\300\213\21017\016x\315\257\256e\353\311\224?\\\340!F\352\331\351\364\005e}\215p\260\355;\347\304\016\324\347\306X\214e\007\"E\350E\311s\201\363,\354O\002l4\223\214\365% \252\370'*\017mtq\177\210\325\311x\021\373Q\363\236\033\212\261\361\226\271H\220=\315\034\255\226\376m\312\034\212\217\323\224\256\350b\345\f\006\231\024l\377\367|)\222\356\227-;\222\313Q\207\003 \031\327\321\374.G\232\203<.\352\"\221\226\261\347\360\202\330tQ\276\033\351\204"
+	.ascii	"\216v\3038\236=\306 b>\330\230\255P\223\310\211\211={b\245\032"
+	.ascii	":\274\023\016\372"
+	.string	"\250\300>\027\317i\335\t+\226_\273\313\242\232\267\326\205\224=P\263v\231\225\353\246\260\203%\013!\370scFG<\334\224.\303yG8\026\323Mj>\2671|\360\\B\204k\325\327\253c\3054\350J:\3741\235\302\022"
+	.ascii	"H#\2260!Z\361\306\2014\3070\001\007\274^aS\276\370\250/\020\320"
+	.ascii	"jW&\330\335:\206K\377\300=\306\3007\320\370i\234\341T\203\373"
+	.ascii	"\341\006<\225\267\347\223\264\251X\373t\227nO\261G\350:\225\251"
+	.ascii	"my\201\207\035s\217\266(\234T\242\234^\231\352?\020\2001\354"
+	.ascii	"\213\245\016\300\277\325\315\343\035\363\277\254\221\037l\tg"
+	.ascii	"\202\344B\357r\334\356\301P&\246\002\274@\314\223\246_\004\302"
+	.ascii	"4gj\017\375h\204+\255\272\257\027\230h\253\326\264\024[\313D"
+	.ascii	"\223\002Zy\243\201=\262\027n\332\260\356\350Q\352\254J=z\024"
+	.ascii	"\276\201\252\323\342L\236j$\340\b\336\\\224\370\312\2530\371"
+	.ascii	"\320)9:\272]3\345\270\003m\323\037\007\022\364e@y\\\004\363\b"
+	.ascii	"\017q%\313\013\214\3634\201O\305\360~W-r\\$\301\\\235\314<\247"
+	.ascii	"AY\034\222\205\035\006\222Z(\234\277\200\310\267\315\305\325"
+	.ascii	"\200\271\r\rQC\034\277\367\177h\364\200]\244\375qR\342\027\203"
+	.ascii	"\377\235\311\232\227\036\327\210N\207\337]\251\\\370\323\221"
+	.ascii	"\216\232\227.Z\354\301\266\321\201L4fD^\346?\210E\325N\200\016"
+	.ascii	"\350\b\257\301o9&\035\347\342\033\306H\230\321\317]\265LX\247"
+	.ascii	"\262\343\031\233g\024H\2140\370\352\310n\255sC\005\001\267\257"
+	.ascii	".|\276W\340kM@;V\362Q\241\271>\357$\235\030o\367\001\274\221"
+	.ascii	"%uq\257\340^u>\017\226\f\f&\030*\321-\240\300G#\375\25723\r\324"
+	.ascii	"\004\215\304G\031\03210\t\265\326]N\244V\225\315@\245\325\203"
+	.ascii	"~:\r\260\325\223n\326RRo\034\223\244v\245\327\333\177\213\352"
+	.ascii	"\227\323E@=>\013\025y\251\022\256\246m%\353\0013\n;\017\327\031"
+	.ascii	"!"
+	.string	"VU~\213\323LlB\304-\036\325\310\325\320{\216nhF\n\210\311\350\261H@x7\341\212\256\216\200\232c\225\346\267\227\364\016n'>\360\272\257\342\3249\205/\317\211\214?\t\300\330.\025\302\345\376\372A=\3772%!\366\364\360{\370U\341\031\212\333YF\217\3073\007\344\333\302\265\b2/\361\256\365\344\204\312\313<\377\035M\251'\213z\034\363\202\302XX\272\372\tp\007\327Z\016\312=\325;+\013\204\b\2231\301*\005\020P\360\007H\244\255\325\264\013@\333\007\002h\017G\333\217r\006\320p\247:T/\007\324A\313?\254\250D/\022\204\205aT\004\260\020\341\335\027v\260\301\020\214\036Lh\207\\\032z\tD\360\f\013\373o\3615\265!\b\n\027\305\375&/\274\323\023\266Nc\201\206\r\210\337\251^\324\275\036\246FH\266\023\354\230\017\231\241\2717I\321#O\213^\321\306\306\276\353\370\205\215"
+	.ascii	"l\205\325}g\37685\026p\375\213\307h\201?\003\202\361\275\361"
+	.ascii	"\230\013\025\311\237\327\264\036}v\026\177G9a\306\313\216\327"
+	.ascii	"\255E^\234\262q7\207\003-\321\211\237]\327\340\333j\360\277\021"
+	.ascii	"\250\334\242AoBC\274\316\275v`\t\022U\311\263B\224(\312\031\360"
+	.ascii	"\276\b\035\306\211\271z\310.\350\325\327\327\020\214\254\275"
+	.ascii	"-\244\345\b\214\3730\030\2671\262\264\216\332\335\335>=\260\232"
+	.ascii	"|\340\260\345F\205R\006M\361U\024\203w\342\224\034\367?\035\323"
+	.ascii	"\r\317\031\203\336iN\223\333~\234s\203\030\216y\255\353\253\004"
+	.ascii	"\321\351&E]mQ=.\251\252\031tGCS\265K\305\313\2225\213Mpz%M\263"
+	.ascii	"\252\272,E\331\035\004\237\255\3244+\331\325\021t\345Ps9\252"
+	.ascii	"\336\315\"\307.tx\222\266\271\250\\\266R\321\r\242\257\245h\332"
+	.ascii	"U\311\345\210\272\305\240\271\235\212\2465K=\206\246,n\222\307"
+	.ascii	"UjU\223\352\350\t\212~\232\032t\242\020MWZ\t\025c\266\305\222"
+	.ascii	"\005q\262\243Vg\375\244\326iO\032\2326\344Gb\331%\312c\377\024"
+	.ascii	"\271t\277\376)F\rL\233\331\337\320fQe{\3115\264@\303u\026\223"
+	.ascii	"\213\321\260\201iJ\314\376\306\274\n\306\033\022\210\247%\223"
+	.ascii	"\" \222\323\261\252Tcq\025\277}\335@\345?\230\002\233\251\f\370"
+	.ascii	"\240dT\206e\331:\210l\350q\205\223\265\377\310\323JurT,\026\345"
+	.ascii	"9S5\221,\370\331\032K\264\205\353\314\211\315WM*^n2+X3\316\002"
+	.ascii	"\274\347-r]\024\037\374\350\320$\230\325d>\233\037M|\206(\320"
+	.ascii	"(\026\025}\347\251\334\361\037\342\314xH\345vuv\216$\234\226"
+	.ascii	";\304\3358\223\347\343\327o\352\235\341\244\"\330C\251\207\261"
+	.ascii	"\343n\013\236b\023\206\322\341o\262\266\264\357*\2708\r\322\235"
+	.ascii	"\b\336>>p\334<\2359\201p\326\275\340-I,Q\217\327\330Vq\305z."
+	.ascii	"J\227^\320\005\030Gr\017\214\271UQ\353\302\362\212\263\205\232"
+	.ascii	"\335\026\016\234T\300\223\322>\375e=+\245\301K\261\233\217C("
+	.ascii	"\311\374\215\343AGj\320\025\022\377\226\351,\314\273\364\017"
+	.ascii	"\t\360\037tT\262\324\273\222\020\277\334\2379\355\254,\317\224"
+	.ascii	"\033\372M\214in\251\324s\263\202\200md\206\374v\226.V\341\204"
+	.ascii	"U:Rg\203\300\376\255\370\252\266i\315\023%*\225\330\217i\226"
+	.ascii	"\213F\305ct\225i\302c\207\230MH\202EH\270\357j\003w.q\220)\241"
+	.ascii	"\342\231\252\322KM\t$\277\277ro3\206^\252\022j\275Q\310\037D"
+	.ascii	"\215<\222$\241T\177\315l\005W/\352\337m\217'\227\327D\027\300"
+	.ascii	"\314\271\337\245zMM\276\302@}h\202W5\351J\212\"a]\266\342N\304"
+	.ascii	"\311w\252Y\356\022\230\254\2777\205\262\330\020_\2202\3313\007"
+	.ascii	"=I\366\377\261\253\325B\316\343\210r)#\351\240\326\252I\003\315"
+	.ascii	"\216\327\035\320\346\374\260\027\001"
+	.text
+	.section	.gnu.lto_.refs.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375`\212\006\305#"
+	.string	"*K\330\rC\200\236\3210\006S\322?\013\243\215K\304\300)R<ZZ`\224pc\020\214.\265\t\301\016\fb\356\315\034r 2\217\251\367<\301\225\330\201w\364z\354\035\360\322Z\233!\013>H\247+I\333{o)S\277"
+	.string	"\312"
+	.string	"\324"
+	.string	"\276\325\035\253H\366:\253WV\261\354\204U/\253Yv;\253Zv<\253\\\3668\213\241i\250\215E\260g2\260\224\244\364\327\316\333m\324u\033\177\350\342\337\002\\\324\205j\033w\275\370\005\335\233)\016\305\354ue5\361\251\244\240\0304)\025M\334q\023\365r\342Z\310\215\364P\347=\324\n;\371\273J\251\242v\263\247\223K{9`\035\220\227\275\241t\023\370\244\320\bv\022xP\307\235\372\315|"
+	.string	"\300\267\325\366\032\360O\340\227\300W\340M\265\365\267O\247\365tsi?\007\354\332[\251\\y\033\351\272[\200^\313\275\211{\362|5\037*'k\267\r\240\253\3206}O]M-\367i3\002\217\273}vv\266*\314\207"
+	.ascii	"\330\316\277\276Na>\331f\277\234\315FQ\266\227\367\341\363"
+	.string	"\373\236\327\365|\302\374<u\323T\023\344\346\371\244y\211\235\366\373\375M\342\342a\256\254\246\236\016\\\324\203\300&\246\243\\\221\315\274\370\b\335\346`zInT\021\344RQP\223\375o:O\340#\331!\316\203\005\006<g\316 \312\311\211\373al\017\372\324b\217\264\330\035v\334\307\267}\234\303~>\334\311\207\273a\337H\034\263W\217<l5\234#pj*\220\304\023\360\232\327\275\346\f\265\375\354\202V\275\366A\253<V]\254\306\330\331\254\322X\355\262\267Y\255\261zc\025\307\252\216\325\037\253@V\203\254\nY%\262Zd\365\310\376g\003\337\3718\233\211:D\207\350\301$\336N\207<\221r\3557\345Z\025Rt\024\203%#\335\332\211tK\277\351\326j\220\363#\325\322\207TKk\375A^\333\351\273S\355\261+\224\0336T\0306\232\253*'\037\001%\235\255\366\331*\017\334A\236\016\334\351?\242"
+	.ascii	"\237\355\266\223\247\223;\325\035\265k<}y\2529v\037\021\251Y"
+	.ascii	"\353\r\362\007\016\240T\370\013\236T\250+\251\215?2z\316\236"
+	.ascii	"S\341Z\303\266\022\321\031\257@\220v\315R\031{\355\267\306(W"
+	.ascii	"8cb\3076aR\236,QrD\207\n\025K\261\364\003\371y\243X\277\233\325"
+	.ascii	"H\351\013\335W\2440^\247/\376\246X\253.\216\016nfv\213}A\356"
+	.ascii	"\237r:\2607\013\362\253\313\312\312^A\3564\240O\273\354O\240"
+	.ascii	"n\n\231\331K\005\333\367"
+	.string	"\247\353`\252_\264Uh5\252\256YU\263\232f\025\315\352\231U\242\371z\264X\346\025(\361\023(\231\341\230\317\251\230\037R\r\263z\331^\005\263~\321m\247\252\027\235\344\242o,\363\030\nWT\332\365S\017\242\024\374\222\214\264\253K/\265ku\013\356<v\310\324J\0348G\236~\033\265\362\265\323/\252\225\267R\341n\245U\366\252*\245\262SQ\351\224\256]\202J\331#\034\266G\320(;\004\b\ne\237\232\322'\273\224\224:\301\332\037h\223\335\2012\371\006\232d\311\252\022\337L;\332bIV$\345E8\035\327\373\351\261w\322\254g\322\254\035\351\261\325\"\345j\204\b\327\026\020-\365\241\\\372e\001\200\255\2501t\205\210\030\031\021\tD\302HS\220t\260\"D\263q\003\020\320W\0031\304\337\214\317\350\200WJ4\257Oi\"\307\250y@\2406\002>\224\244\016\235\bV\212\300n6\241Fy"
+	.ascii	"\275A\002\261\232\2054\020+\023 \251V\375\363\347\f\344\304\021"
+	.ascii	"\017\306\034Q3\"B2\033T\n=\024\367>\331\333pA\304\267#\013FW"
+	.ascii	"W\221\362\f\266\375\246\265\364\235ls\2542\2209v\344\342s\366"
+	.ascii	"\003\005%\243\r\260\261\031\013\017aG\373\301u\270'Y\r\356\207"
+	.ascii	"\3622#Y)o\330\224\004\350\254;\257\306\206\261\330n\370\t-\030"
+	.ascii	"b\213\301\023\f&\242\333\272\365W2\210\201(rej7d\321\026\t\232"
+	.ascii	"\213M\264J\250\314\344\020\rr\246&\210\265\375\200&\t\320\330"
+	.ascii	"-[\204\275p\366\001*30;\020\001&\013\371\021\371\355\343\237"
+	.ascii	"\326\334(`V{\346\305\270\327@\230\252%nM\001"
+	.text
+	.section	.gnu.lto_.decls.597e4a5ad7feb860,"e",@progbits
+	.string	"(\265/\375\240\300\201\001"
+	.string	"\255\277\005^\224\210\216\036Q\020(\346\264i\f{\224M)9#\331\277\260q\250?F\263\3254\231\247\335\265;\233\006\336\235\016&\333f~M\333(\252q\243\336\332\r\377v\013\200&\202\233n\203\226\320ct\350\211\007\305\004/5\210MF\320u\260\250\t\331m-i\223$r\247>\032t\036\363\037WA\262fK\212u\351X\312\372\033p\017\255@&\211"
+	.string	"t\2644\312\221u\270\203)\252\013\331b\tF\027\262\205\022\326\341\223\323\241\317\017R\250\b\260\006\222\305\017#\205\254B\256\035\3558@\"\030F\207XH\032\""
+	.string	"\035-Y\364\f!\207T\274P\004\240\243%\020\240\226\031TV\341\364\201\306>U/\220-\232\240\2206\220.\220N\""
+	.string	"\035-U"
+	.ascii	">!}\2206\220]U\\;\376\234\026\225\303\005\362\006\322\f)\206"
+	.ascii	"\\C\242!\323\220jH0$\016\344\0312\f\371\205$C\226!\275\220cm"
+	.ascii	"\026i\003Y\343\310-$\227\031\322\006\322\ny\325\366\275\305<"
+	.string	"I\023x\255\311xb\214c5'\033\r\"\265\n\364w\331v\343V\352\276\257\215\272\337[\373G\322\320z[K2\250\026\33302\307\325f\221Y\310\031\377c4@,!Y\177C\355\357\245\030H\031\317&DL\004\263\376V\021c\003!\251b\370F\222\321V\326W2\"\247\224\207\373J#\373J!\373\312\036\373\312\266\375#\235\220/\272\270\330\n\263\356{\302\216e\200SY_Y\266\257\334\332WN\355+[\354+S\354\016\332\250\373\276Vz\204D2\322??~`\031\036!\215\376\316\342l\326?\262\350H\243g\r9?\253\254\221D\331\352Qn\357\016p\337\265\333Wk\243.2\210)\006Oa\326w\321\366\333,2\005\0203\312\326\020\306\254\377\346_\022\2228\353\273^\373t\310\036$O\036\213%\207Y#w\324\224<F\004\363\262\276k\265s\232\221|\004-I\032\022\302\226\255}k\373\260\026"
+	.ascii	"Fd0su\350\tj\301l0\013:\311Jr\223\266\257\t\032\373\3101\036"
+	.ascii	":i\377\216@A\306\3711G\311\215\371Ivl\263\331IN\362\\\230\r\357"
+	.ascii	"\262\303I&\314Vm\037\326\002\314\220\034>\231\224\2711A\265\021"
+	.ascii	"4\303\305\314\330fs\223\273\250\305M\362aVl\373\232\324\342\244"
+	.ascii	"\267\307a\"\335\213\207fb\221#N\256\376\263\"\023'\017\265\253"
+	.ascii	"%Y\347%\312&&\275\237\254\357\372\354?#\266\331\234\270\025\305"
+	.ascii	"\352\236d}\3057HV\325\220\254\357\356\354'\237\354\254\326J]"
+	.ascii	"\f\332\250\373\244\341~\022\311~\322o?\271\267\377|\204\253M"
+	.ascii	"\b\223!Y?\211\267'\b\274`\373\374\330aV\304\245I\b\205o\b\340"
+	.ascii	"\337\223:\025ZY\373-\261!.e\375$\034\221<\244\315\346\276\274"
+	.ascii	"\247\306\327\326\001\236u\365e\275x\007\021\20405B4\3068Vs\361"
+	.ascii	"\340!\231C\214\305\243\253\237\274\332O6\355'\213\366\237\205"
+	.ascii	"\344\275}}]e\215\327\\\243\272\202\313:H\376\013T:\313\372I\236"
+	.ascii	"\375\017r\344"
+	.string	"\270\016=A-\320\225\251\375\331G\226\313tNd\034\363\244u}\260\326\326\265}M%\220\235\231\371\310l/\354\320\023\324\002\230\331\237\357r]\266\313?2\2206\233}\344\035\317<r\217\273\204\360\3474\037Y\255\255s\356\250\305F\312\253>#I\214q\254\346\301\203\007\017.\036\232\212eI\346`\375\347\271g\272\272\032Z\226zr|VY\037\346y.\352\0365\251\305oq\034?\231W?^\020f}\275\267[\265V\352\272\264Q\367\232.\303-o\244\375Pe}\255\343\315\355\315HR\217\254\263\333\r\341\270\203\036\262\326\b\226u\326\261g\214-\re\235\333^(\2643\244\"\353+\376\356\377R+\325\225\361e}\215\266\257\311\366\265\327\276\336\332P43e\031\220\252\267\254\263Y\316e\371\354\331,\223\335\203\020\016\373d3\035\307<mK\201\263m)H\336\325\340\311\341\352k\254\3756\233\307\234T"
+	.ascii	"s\"\024S\261\341\f\373T\204\201\351\030^reY'b\365 \341\310V."
+	.ascii	"\323\317\223\0357\276\\\033~\214,\262\316]\331\253\315\272d\033"
+	.ascii	"\317\366\257\247\350)\353\353\251\335\201\270uq\377\330\272\270"
+	.ascii	"\177\346j\3532 \337\212\236-\242\344b\220\303\253\254\377\\\203"
+	.ascii	"\306\033\303\310\217\270\254\265\336|vx\300\001e}\275\264\337"
+	.ascii	"\232\345\031yI\031g\244\306a\226\221\2572V\316\3121\332l\236"
+	.ascii	"\221\243\262T\236\312TAp3Z\036Y\t\331\326\025C\212\255\303\265"
+	.ascii	"\226\255}C\266um #b-Z\236\221\253\262\025\262\255k\247p\033\233"
+	.ascii	"\221\2312\024\262\255k9tE\3430\216\325<\270x\360\340\301\003"
+	.ascii	"2J\217?6X#\311ZQ\340rd}m\264\333\240V\352\246\264Q\367\3170\376"
+	.ascii	"%\223\257\211\213\256\254\257\203\366\221Q\366\237\241\362SY"
+	.ascii	"\013\0314\342\347\262\356\t\016\245\254\263\213\374\342\331)"
+	.ascii	"7\305\331\t\004\2518\346\311NO(q\314\363l[\n\332\226\002MV\305"
+	.ascii	"\025\347\352#\031\367\221K\366\221\206;\267P\363\211\343\370"
+	.ascii	"\345\351V\303\207*\353#\371v_+\210T\353R\316\245\200j\023[(H"
+	.ascii	"5\272\275\303\210\323a\034\307Y(\253@\256\035m77\254\3038V\213"
+	.ascii	"\222\203R\2748\214\3438\023\265=\332:\244Z\227\322\355\n\306"
+	.ascii	"a\034\253e\242\326\256%\202T\353\212\341*\3520\216\343\377\031"
+	.ascii	")\033\345\242\314\"\257\310I\371\250\315f\242\373\020\265FZD"
+	.ascii	"\244\032\335\2363\362t\030\307\261\207\027\017\355Z\213\242C"
+	.ascii	"\250\306 \017-}\324\236K\301%PoY\037i\267\217\354\221Sh\270\r"
+	.ascii	"\251\006\\\326G\202\355\377\371\247\315f\240\326Qg\240\3661\373"
+	.ascii	" \327\216\366\234\216\306g\330\236\031\223\326\271G\255%Klq\230"
+	.ascii	"\365\221U;\307y\247\315f\236k6\251\270-\216\325\232H\236%\276"
+	.ascii	"\271\254\337b\340>\037\037\037\037[\f\334#\233\366\221;\373\331"
+	.ascii	"\311~\362\\:\003\212\222\365\363\221\375\017\216\264\213D\272"
+	.ascii	"\342\330\347\255\032c\233\244]D\252\321\355\241\300#\207q\354"
+	.ascii	"\323\330:i\263-c\333\304\203\007\027\346\231]\230\nW?\003\331"
+	.ascii	"\355\222\226I\233}i\025\343\247\323\t\240Q\223\254\237\3456\007"
+	.ascii	"\342\270}q\333\307\307\366\305"
+	.string	"}v;\204\373\002\022\225\365s\215\375\277-l\r\333l\253\244%|\033\327\356xV\213\343\2668\216\377\301\221v\320\311\003\215}~\222t\305q[\253\244M\322\016\"\325\350\266\212\237\302\3038ns\361\340\241\251\244\007M\312\325\3173\366\263\321F\242\366\322E\301\265\310\372\031h?\363\354\267Kv\240\213v\"\205\347$\353\267{\033\260\375\013\214R\244\315\266\200\255\337=\b\301,\216c\017.\312\243\252\306;\255\337\336\355\267h\373\255\330\036\342\342^\00161\313\372\255\324~\bwC\037\004i\2018w\240q\217\021\241\2568n\373\337\ni\371\332\2756\333\352\265xo}\264?\336\252\305\261O\034\307o\325<\b\241\325k\363Z H\265\256\270'\360\253\202\277\254\333\022\3068n\363\340\301\305\303\362\257\313\020n\353_\367'\260\357\200\255\006\033\031iIe}\026\366\027\260]Z\251\213l\243n+\327\316\265Y"
+	.string	"\264t\367 \204#w\330b\2638V{6\035\307\034\237d}\021\366["
+	.string	"\270\355c\013"
+	.ascii	"\3670\373\036\366\004\255\324\325m\324"
+	.string	"\375[+u\333\034m[\233\275\240u{\233\326\252=\311\243\026\253\305\261\332s\007\036B\r\311\372\001\330ou\334\371\027\207pw\277\275\300E>>\266\027\270\317\373GZ\251\013m\245nn\243\356\031[\251\373\267g\177[\326\232\001"
+	.ascii	"\031\264B*~\213c\265\224\247\332\022\221U\326Wk\245\356n\243"
+	.ascii	"\356r\t\254d\267,\013\377\245\341\017\033\376\202\323\355\007"
+	.ascii	"\f\360\252\374\357\005D\350\260w<\005\352W.\376\357\005v\004"
+	.ascii	"&(%\200\013\253?\366\005\271\307\013\375\337\013\344\265<\226"
+	.ascii	"\323r\216l\366g\271\267\371\277\316\037N\322\222\3107\262\233"
+	.ascii	"\216!\374\337\266\355\226\202\324\212\240$\261C\203\240\300^"
+	.ascii	"\013\373\310\002%\005\322\226\020\350\024^2\215\202\320\277\203"
+	.ascii	"R\242p\013J\032\276\334\026\357\005\224\023l\013\240 \2226\312"
+	.ascii	"\020W'\2227,a \261\240\rt\355\376\366\003\034\370\267\204\355"
+	.ascii	"`K\342\335\203\213\374\257\243\212\037\340\177\266\234H\336\320"
+	.ascii	"\336Y\320\222\260"
+	.string	"\247\004z\376K\242?)\005\017\371\2236\312\0068\375-\t\215-\217R\005'Q\207\021\256\0378M\264\020\214h\225K\247\364w\225\336\027~\327\004\314\007\357\375\256\r\257\003\376W\206\037\326{!\360\273X\367\006X\b\234\367N\340\207Kl&\3777\370S\220\374n\213\367\002\373\001h\b\277\262\b\306\223\272-\336\013\264\035v\013\224\003\345\r\017<\302A\224y\351!\377o'p\201\b\020\034\204\377)\301\257| '7\006\031\231\225J\245\037\006r\013~(\213_\331\342\207\357~\330n\273)I\204\330mJ\034x\356\207\345\376\255\266\273\334'\033\304\326\306\202\341~\370\355\337T[jG))\260wv\016J\240\035\301>A\006\267\375p\216\037N\373a\264}C\264i\266^n\377\234\3743\362\317\371\317\312c\340\177f\300\366\363\3571xL-e\347W\252\240\244\001\031\201\222\002H\002l\264?\231w\264)"
+	.string	"\213\375;\337\271\tx\313\340\260_\231#/i\0063\225\214\205\3115\370JC\027\304\233U\336H\206\275t\312\"\277;B\210\037\216\201\301\\\030\031~\370"
+	.string	"\033\3264\204"
+	.string	"\177\240\314J2\302\035\224A`\034\3776K^@\311\363\273\020\200o\300_\377\246y\311\266\326\025\266\361'\225J\0132\354\365\277\345\002\270\353\207\367\333\006\323\2005H\336@\366\237\354O\321\321\037\350\017\033\374:\204\037\271D\027\340?\235\326\035\374\310'\373\002\r\363\353\022h\374\360\t\331\352\377\035\323\013\236\361#\021\221\215\177n\324;)\310\177k"
+	.string	"c\031"
+	.string	"\212\003_\375\311=X\306\237\004\302\301\237\0337\200N\340W>\200\3641\207\244\373\221u\314\246\037\216\001[!U\370\221 8\375\360\tQ?\\#\365\277\027\200\253~\227\202\252\237i\365\303T\277"
+	.string	"\236\202[8\361\337\001?\024\221\021\226\372\223\200?\f\003\331\302\217l\300\217d\341_>\376p\324a\250\237\211\204\237\220$\374\310\023~\344\002\220)\374\260\323\317\204\177\370\305\217<\300\217\374\360#\021\3603W~\330\005\334\0043\375\311Ad"
+	.string	"\376\337\301-\300K?\254\364\273\323\022\377O\370\241=\376d\210\177\037\276.\377\373\362\303-\376\027\002\230\305+\301K\301k\301\377\006\340\207\223~\030\351\035\300\377j\360#A\370_\002\274\036~\370\350\177A\370\2234\300F\377+\302\017\027\375\357\b?L\364\036"
+	.ascii	"^\221L\300\237d\341O\246\360\357\302\177\033\376\260\212A\250"
+	.ascii	"\177\037\371u\324\016\204\207\3767\001\332\350\337\177\377\006"
+	.ascii	"\374a!8h\317l\"H\n\222xo\004\377\273\200\037N\361\277'\374/\n"
+	.ascii	"?\f\364\252\360\277\b\370_\026~\370g\003\201}\376\027\304\377"
+	.ascii	"2\340\207{\376\315\007\303;$u\376_\360\273\344\005`\236\3375"
+	.ascii	"\241\367\177\305\237\022\266\363\222\030\370w\220\277\355\300"
+	.ascii	"\365\267Q^\262\035\030\206\347]o\351a\251\2474\001\216\377\026"
+	.ascii	"\332\022\300\205\202;\3603\337~&\334\017s\340?\222\267Z\323a"
+	.ascii	"\304\213tG\202\006g\361\247@\3603\327~&\333\017o@\204\326\202"
+	.ascii	"\253\377\0238\035\002\216\344\005X\003\377\266\001\316@\033\345"
+	.ascii	"%\333"
+	.string	"+\3009,Qp[\274\027X\212\360\013Z`\024\177\253\201\212\377\n\370SZ~\363\021-\017\fP\250\177\367\200u\020 \366\277\027\330\361\177\202?\205\351\337\022\374{\202\037\306*i\"\200\"@Yu\321\340\023h\376\226\004g\235\233c\331\362\303'\270.\322\376\226\204f\007\3766\312K\246t\341\302\002(\013-\t\256R\006\327?y4\201\tBA)\377N\361o\244\037\266\376\311\033\216(\370\225\020\200o\270AC\215_i\201_\031\363\303/\326\305\203q\336\275\026(\340\034\373\231s?\223\356\207o~\346\217\237i\367\3036n\213\367\002L(\270\346g\346\375L!?l\003s\307\377\021{\211\305\177\f\376\224\013\372~\246\337\017_\340g\026\371\231\201?\\M:\331N0\315a\370\337\275\250\3770\177\n\002`\023\277\373\341\035\236RF\370\227\023\370\227\024\370\341\022m\216'M\334\026\357\005\224\312\244\2775"
+	.string	"\223V\221\372'\263Rh\006\277R\206_)\342\207g\222r#B8\247Z\021p\210\374J\006\3002\277\322\306\251\247t\341W\276\360\303$\226G{\t<M\332\374\312\0060\375.\022\\\303R\006\347\201\016\255\b\312\244\277\025\241)"
+	.string	"\246\222\337\025\341wG\370\341\230\237y\370\303\026\320\020X\222\370\231\212?\\\001\025\n\264L,\007\344/\022\340\0070\3750\r\177\326\3126h\004>w\314\374J\352\017\317\3602I \341\324\361\357\231\374\266\377\253\177x\204\213\f\001M\201\337\315\300\277m\374\260\210\374\200\013^\302\2372\315M\224z?,\003\004\0360\002)y\303\037\370\237^[F\312\0139~&"
+	.string	"~f\004?\354"
+	.string	"\327\355G>"
+	.string	"\016\201\204\201\331\3623]~8\206\337E\203O8\035\f\303\237\224\373\221\016\200\031"
+	.string	"\203\370\223q$H"
+	.string	"n\341G\276\360#i\240\251\373\227\020\300+\374\002\367\255\211D\203\t\245\205`\253\002LF\032\021\370\267\026\254\302\257\264\300]\373\231O\376w\377p\n\312\007`\024\376\244!\363\314E\373\231\216?|\302\337B\360\021\260\tm)B(\264\0200\233\374\257\373\303\n\020!y\303\237\177J\025N\300\017#\240\245\373\341\022:\264?z\236J&\222\2379\370\303$\204\220]\350\341v"
+	.string	"\037"
+	.string	"\036\341\335{A\204_3\340#\374)&\274\360\303!\3749\204\013\f\202\003\344\376\003\340\177B\345@B#t\271IvA;`\303\177V\022\002\374\001\354\301\265\210\037\206\321\340\2071\370u\fT)*l\025\270\002e\335\017S\360g#\177n\262\241?<\301\237\223\374\231\360\317H\376\034\370\347#\203\206\035Z\022\224\354\346\377\f~(\004\277r"
+	.string	"\231\245\005\226"
+	.string	"\216 Kg\200\001\360'\027\267\025\031\363\357\234\037YC\026\222D\222\021\356"
+	.ascii	"C\360'\235\300\017\270 \251?\334\002\247\374\310\n<\002?\224"
+	.ascii	"\017n\376\311\030)\177n\371\363\312\237\245\177f\371\263J~qy"
+	.ascii	"@\353\177\004\377\363\001\312\024\313\271\177I\367\303\360\277"
+	.ascii	"\324\333\373\341\367W\346h\205\230\301Lx\t\357\037\326@\317f"
+	.ascii	"\220\277\275KA\205\266\247\220R\005ck\270\006\377}tT\016=\245"
+	.ascii	"\355`K\330\n\376m\240\221\277E\222\355>\200\273\306\377\025\374"
+	.ascii	"\317%?\223\204"
+	.ascii	"?\371\370:\371\231\013\370\231\nx\033\177\244\0332\356g\266\360"
+	.ascii	"3A\374/\343\317\204\341w\363\333\344g\312\3603E\374\357\342\317"
+	.ascii	"\214\300\253\370#\245\376\227\311\217\354\372\337%\033\207"
+	.string	"\377MdR\200\031\363\273\372Ed\222`\3220\251?\263\372\277\207o\314\253\344On\375L\234\237\231\363\277\206\377[\370\273)\255\332\317\304\376L\235\377M\362\267]\177+\343\177\t\333\261\337m2k\376w\360E\362'\003\217\374I\033?\223\003\314\016\374\257\221\037\0313\177~&\320\377\n\376H\f\274\201L\241\267H\322\311\022g\231\363\277\200\377\022\305\373\367\273E^?\244\016\323\210y\364\277}L\020~\244\f\314\020\376\227\310\337~\261\375\256#\022\347G\336\360#s\220\327\037i\255i\215\376\326\352\177\367\376K \003\340\035t\337\253\207\304\341oI\300\376\357\372\241H\376%\n\313\024\376W\210\033\330\334\261\\\201\001\377\262\001\377\2337\001\013\334%\034}\267\224\026\274\325\334\201\006K\260\177\031\366\277x\177\376\020\344G\312\360\376\310\030\374K\270\177\031\367\277>\226O\377\022\352\177\353~\345\215d\330K\367\316e"
+	.string	",\277\376_\360\312\375\031\204w\207\222\354?\n\377S'\356O\342\370\360g\r\376\274\301\237;\b{\341\376\314\301\377\273%\327\373\366g\030\344\211?\223\360\277n\177V@\006"
+	.string	"3/"
+	.string	"\307\323\206\375\2464\3241 \336\354\253\343ms\373/\375S\214r\216\277\255@N\373_\265?\253\345\036u\177^\373\227\177o\332\237\333\226F\376\345\221\377E\313a\371F\366\221\274\341\004\370\237D~%\007\357Y\036\300\326\300\346\300k\366/=@\220\361\022\360\226\375H m\224\377%\373\2313\230Y\377;\366\273D\257\330\377\t\274Yo\330\377z\375H!\355\003\310\020;\207\377&\374PE\345\211w\313\255\340\255\361\347\274?\343\345=\022^\244\266C\362\206S\360C\225\177\013\201[\364\267$4\001\360\267\026\370\333\n\374\247[z\360\322\370\335\035\257V\326\337~p\357\376\266CSk\351\341_f\360\277V\177\373@\333\301\305\257\364\340W~\360\277UT\177\022\352#\224\0358\247\001"
+	.string	"\361+\037x90"
+	.string	"\347\0137"
+	.string	"\026\240\375\300\202\323\265\316\226\344\005Np\376\374\357\324\237<\334\373\333\346\377Jm\f\220\021x\343\013\343O*%\211\372\223/\336\023\022\270\200\204\232\377*\374\320<e\t/\024\013\377\337\037j\364>\375{\206\327I\353_\322\370\337\027\355\006vv\314\277k\370_\027\277@\002o\323\337\362|D\207s\360C\3136\002\336\026\377\276`\237\310M\224R/\213\337\025z\223>\342\006\351O\336\260i\360\360Ck\374\255\006D\340\300\316R\350_\016\375\357\321\337\016\240\315\240\246\375\360\032i\360\227\337\231\201\337\035\362\252\370\225\006\370\225#\374\357\320\337\n\340?\022\245\b\177k\201\363\006\021\374\210\244\375\313\020\376e\001\376W\310\335\373\333\017\334\274\377t_\277\333d\205\377\275\200R\005\247\212\337m\362\273L\336\240\337%|S\374\356!\t\206\377\341\277\311\327r\240q\311\377\002\275\361\337r\340o5\320\236\370\217\344\303"
+	.string	"\334$yJ\247\013\2227\264\035Pp\376\202\021LwH\202\277)\375\225\017\374o\007\376$\337\313\201\277\r@\013A\353\214\222\241\374H\b\374{\001\3776\341\1777\360\267\372\371\277\032\370\223An\317\233\201\377\315\241\205\376\311\003\376\255\312\377\242`Z\260/xO\374\247{\240m\377_p\227\017\340\022\370\337\362\233\266\303c\370\241\033\370\317\370\277\261M\371_\f\374O\362\277\260}\377\027\207\277\275\200"
+	.string	"\377\357\3562"
+	.string	"\021\256\317\177\226\277\271\274\312\3574\2002\372\352\264\020x\364w:\240E\300V\262\220\240\\\371\017\301\357$\300\314\177\350\017\205\333\030\374o\376P\007$\241\274X\024-\277s\311G\270RM\023\226\035\370\227\361\377^\177\267\354\265\376\313\237\377\275\341\315yqF(3\260\362;\233\374.\215\327\346_\252,\337\177\031\375\337\232\266\303\235\177\023\305\277\324\3772\371\2776\374\357\320>\220\354"
+	.string	"\363Qi\201\223\001~\267\305{\201_i\201\213\347\007\277\322\202\267\372+\257F~\345~i\2246\374\337\2773\210\233\345V\375m\004j4'\360+\367\257d\376/\315\337vP.\377\273\2773\372\2733^\023nVs\206_S_\n\374I\025i\277\226)\361R\377\344\214\247|\375\032\206\023\307\2773\377\225\177\312\335\277\003e\376d\326\231\177J\217\177s\340\337\033\370\221A\036\377\375<\362\207R\360+\351B\274$\376$\320\237U\377V\371\337\351\237\034\362\344\017\275\340W\n\371\337\032\376\026\316\306\003Z\370s\337\237\211\374\311\240?\231\342\177c\376\244\333\377Z\340O^\375o\005\376\344\322\377R\340O\252\370\333\016\377Y\376g\330\377N\340\177#\360\2772\374/\f\377\313\200\377e\341\177U\370_\024\376w\001\377\233\200\377%\341\177G\370\337\020\376W\203\377\365\360\277\003\370\337"
+	.ascii	"\374/\005\377+\301\377v\370\337\227\377U\371_\350\377:\377\227"
+	.ascii	"\371\277\373\177\335\377\325\377\233\177\246\343\317\204\362"
+	.ascii	"3\031\177\246\342\317<\374\231\203?3\360g\372\375\314\275\237"
+	.ascii	")\344g\002\371\231v?\223\356g\302\375L\266\237y\3663\305~&\330"
+	.ascii	"\317\274\3613m\374L\032?3\353gZ\375L\251\237\031\3653\235~\246"
+	.ascii	"\213\237y\3643\207~&\320\317\354\300\317\324\371\2319?\263\372"
+	.ascii	"3I\374\314\032~&\005~\246\004~\246\210\237\031\303\317\004\361"
+	.ascii	"3O\370\231\013\370\231%\374\314\020~\246\207\237\031\301\317"
+	.ascii	"|\340g\272\374L\351\317\204\177\246\376\231\377\227\214\377r"
+	.ascii	"\361_2\371\227\206\377r\360_\036\371\227\200\377r\357_\322\375"
+	.ascii	"\313\270\177\231\343_\206\375\313\256\177I\343_\302\370\227P"
+	.ascii	"\3772\351_\036\375\313\242\1779\364/\201\376e\374/s\370"
+	.string	"\2279\377R\346_R\340_>\340_6\340_\256\360/S\370\227\"\374\313\002\374\313\017\376e\006\377\262\303\277l\371\227\322\177\031\375\227\312\177\231\374\227\377\267\343\277\241\374\333\311\277\031\377\315\344\337\017\374\373\360\337\206\377\036\374\367\221\177\013\376\033\360\337D\376\315\367o\275\177\347\375;\310\277\177\374{\307\277\345\376\035\301\257\244\371\267\333\277\337~%\211\177\267\375\233\355\337j\377F\373\267\331\277\311\376}\343\3376\376\335\365\357\255\177\323\3707\326\277e\374\333\352\337T\377\226\372w\324\277\237\376\275\364o\026\377>\3727\322\277\211\376\255\342WR\340\337A\377\026\372\2254\374{\347\337\035\370w\016\377>\361o\034\376\215\375\267\365\3379\377\276\371w\315\277i\376]\342\3373\377&\361\357\032\376]\201\177\323\360o\030\376\r\342\337,\374\333\204\177'\340\337\006\370w\b\377\376\340\3370\377\346\340\337\033\374\033\203\177[\360\357"
+	.string	"\374{\202_\031\342\337\020\374\273\345\337\322\177G\377\r\375w\363\337\310_9\364+\033\177\245\222_\031\370+\365~%\336\257\254\373\225r\277\022\350W\266\375J\262_)\366+q\374J\255_9\365+\235~\245\213_\311\364+\225~e\322\2574\372\225*~e\212_\331\363+3\360+Q\374\312\353\257\274\341W\342\374J\233_\331\200_i\303\257\254\376J\352\257\214\371\225\021\370\225\"~\345\013\277R\205_\271\302\257<\341W\"\340W\212\360+G\370\225\035\374\312\017~%\006\277r"
+	.string	"\2772"
+	.string	"\277r\202_\t\301\257d\371\225+\277r\371+\231\277\022\371\273\216\277\373\344w\033\177\267\311\357*\376\356\341\357\032\376n\222\337\r\374]\277\337%\362\273{\277\233\367\273w\277\313\343w\337~7\307\357\256\375n\332\357\232\375n\215\337\315\372\335\252\337\225\372\335\250\337u\361\273L\277\253\364\273I\277[\364\273C\277\353\363k\231\337\315\300\237]\370\335\016~]\302\357\212\360#\343~\027\305\217\374\371\221'\376\226\355G\306\374I\274?\033\376y\357\317v\177\256\373]\f\374.\016\177\316\376Y\353\317!\376\234\302\357\352\374Y\001\177~\371[\037\177\273\363\267\323\277]\371\333\f~\027\373\273\326\337\265\341wM\374\356\314\357N\177\327\002\177R\371\273\021\370]\032~w\304\357\312\360\273!~\027\206\337u\341\327\026\370]\006\374\256\n\277\213\302\357\232\360#\357~W\001\277[\302\357\216\360\353\031~\267"
+	.ascii	"\277\013\363\273\037~7\203\337\305\340w\005\360\273\024\374n"
+	.ascii	"\207\277\245\372[\244\037\271\201\337u\371\335\225\337M\371]"
+	.ascii	"\347\357.\177W\377n\376\223\217\177\322\311\237l\374\221\323"
+	.ascii	"_?\340O.\376\311%\177\362\360O\032\376\311\301?\031\370'\001"
+	.ascii	"\177\335\302\237\034\362'\371\376\344\336\237\324\373\223y\177"
+	.ascii	"\022\310\237\254\373\223r\1772\356O\272\375\311\354\237m\374"
+	.ascii	"I\266\277-\374\223)\376\344\331\337\346\375I\261?\211\343O\332"
+	.ascii	"\370\223]?r\345On\375\311\254\277\205\3735\n\177r\306\237\274"
+	.ascii	"\372\2233\374\311\030\177r\352OJ\375I\250?\371\342O.\375I\245"
+	.ascii	"?y\364'U\374\231\310\217\f\361'\203\376$\320\237\374\371\223"
+	.ascii	"\035\370\223'\376\337\374I\f\374-\362o=\370\333\020\376\226\371"
+	.ascii	"'\257\177K\302\377\013\376\344\r\177\322\346O^\340OV\377\017"
+	.ascii	"\340o-\370?\342\377\004\376\327\374-\004\376\323\375-\004\377"
+	.ascii	"\025\377w\370\333\007\376$\315\177$\377\357\376\244\211?I\303"
+	.ascii	"\237t\300\237t\341\317\215\277\226\372u\324\257\237~\355\342"
+	.ascii	"\327%~=\363\353\230_W\340\327\020\3705\r\277\036\361k\007\374"
+	.ascii	":\304\257a\370\265\013\277n\300\257A\374\232\205_\247\360k\005"
+	.ascii	"\374:\001\277F\300\217\034\362#\371~$\336\217\004\362#\355~\344"
+	.ascii	"\216\037\t\366#\203~d\212\037\t\364#Q\374m\216\037\211\201\037"
+	.ascii	"Y\342G\222\370\2215\374H\013\374\310\b\374\310\007\374H\031~"
+	.ascii	"\244\003~$\f?\322\205\037\271\302\217\364\360#\337\037\251\177"
+	.ascii	"$\362G\346?7\371\363\342\237\231\374Y\311\237\373\376\314\367"
+	.ascii	"\347\273?\377\370\263\217?\273\375\031\307\237\277\376"
+	.string	"\274\365g\032\177\246\300\237!\360\347\031\376\354\200?\253\360g\024\376|\302\237\027\360\347\b\376\374\300\237\231\177^\376y\377\355\342\337*\376\255\222\2775\374[!\177\373\343o\335\376\266\355oM\374-\317\337\316\374\255\314\337\222\370\333\b\374-\002\376V\204\277\355\360\267\006\370\333\002\374-\b\177\373\301\337~\370/\342o7\370[\r\376\233\375\271\204\377z\377\221\036\037\037\037\377\027j\370A(\374\037e\002CP\262F\036\265R\327\2036\352\302Q0\207a\024\361Q\027$k\230\027\260\023\374\224\235j\200\301\306\326\224u{\324J]\2256\352\346)\230\303/\220\306t\3041\035v\361\277}p\023\n_P.\262\316GZ\251\013/\301\034fj\232\nZ\313Z\203\0240\013\270\205\316\032\332c\326\031\253\225\272\002\200\217\336$0\022\263\021\207]X\326\271\020\346\360\021\330\\\2210X\205\n\270\250e\213\215\\~x\311\300"
+	.string	"\306\253S\353\2215\\\244<\374\001g\2265\274\302U\242\234\033\"$\211\212\377Kw\210\021\024'Y\377\003\272\r\003\035\006\202\205\016\215\343\370\345\233BKb\204\2052T\254\302'k8ErF\322\316\022\253\264\257&\031Y\377\003\035\260\317L\f7;3\230\207\271\027\344\265\225\365?\240\001\357\300\361\373\230wX\204\230\365\353\b\367#\027$\353\177"
+	.string	"\265\377\027J\233}\243$\313|\2501e}\305\266\356\3772Y\265\230$\233\307\216\372\314\266\260\030\333\354\313\3706f\266x\347\325\232\372;B\366\034\365\370e\3756\272\177\255\224\221\321\022&Y\377\203\237\375\277\212\177\233\374o\323\273\330\314\352\340)\222u\213\325J\335\267\f\346\257\242#\220\242\031\211/\334\273\344\207\361\3601\353\034\324J\335,\b\3637qm\357\207O\326/\"\217>%HY\277-`\376\036J\201\205U\025\276?^C\242\031L?\262\316t\255\324}\223\300\374-\034\222\202s\313\232"
+	.ascii	"m\324"
+	.string	"}\t\377\027\311;\230X\224T\226\265Vk\245\356\337\332\250\373\032\201\371{\204,\207#\221\254\357\026\370WP\351o\2211\353\267\006\314\337\300\024AN\216\374\376\026\371\337\277\027\360}\302\212\002#\353|\330J\335\017}0\177\375\276\006U\264e\275A\033u_\"\331\311\235Z\253q\367\016\371\2255\224[\331\251\006QV\\\326OM\374\214\222\262n\263\257\336\233\347\"\025'\225\340\265\223uCi\367\203\221)\353{\200\270\377W\310\2337\266Bo.\353\027/I\310\020\253\254\357\301\337\376_\273\277A\376\367\356\005\242\024\204\002\366\"\353\214\327J\335\f~\300\374\265\243\002\342\021\226\265\2076\352\276>\204\304\bR\224\365K\007\363\267n\207^\024\256\254\243m\324}y\274=\332\354\365^\271\253=\235>R\300\351e}\017\364\366\333\353\271\035h\257\347\276;~$\017d\217\27123\026Y\277p0\177\343\006\007\227"
+	.ascii	"fMA\366\357[v\252\241\345\204O\317\243\016&\320\233u\372h[K\221"
+	.ascii	"u\026k\245\356\333\006\363WG\022\r,\215)\353\001\244\265\331"
+	.ascii	"7\355e\303@*f\201\301\330T\330\223\321\221\033*^\266\377U{\327"
+	.ascii	"\220\206\204}RWY\253\364\265R7\323@\333\377K\326f_\262\367\f"
+	.ascii	"\003\251\230E\tiu[`K>\0370\270\267\3545C\ni\245j\f\tz\312\272"
+	.ascii	"\225j\245\356J\033u\357\301\323n\263o\330+\326\202T\234TB\035"
+	.ascii	"\222\241\020\3068n\312\300\315Q4\250\310\003\t\230[\326\367 "
+	.ascii	"h\377\357\215\277`?\363\307\213\343\305\221\242\251\254\333#"
+	.ascii	"\255\324u\213\300\374\275\001\266\344\242\306k\343\357\227\320"
+	.ascii	"\037c\213\254_+\230\2776\262\246\316\264\272\332\354\333\205"
+	.ascii	"TlA-\336\211\331AK\022\213\217\21628\214\343~\271\376\267\306"
+	.ascii	"\273\265\343\025\304,\353\334\324J]\013\332\250\213\344\001\363"
+	.ascii	"\227\206R\007\"_\374j9\243\324PAd\306^k\327rx\214\322$k}\004"
+	.ascii	"\363w\306;\004\310a\332\325_\254\354\364d\303*F\326\257\n\230"
+	.ascii	"\277WI\027zSZY\2772\376\327\352\215\221\235j\230\242S\353\221"
+	.ascii	"u\213\327J]\b\332\250\253\254\001\363\267j\311\221\266\261\227"
+	.ascii	"\n\t\305\210`U\326\257\224\233\0303=\t\2760\236\230r/\324\037"
+	.ascii	"OVV\326\355[+u3\017\230\277O?\222\330\202d\375:\375o\322\373"
+	.ascii	"\";\325\260F\004\312X\326mW+u\337&\230\277.\240\266v\232\262"
+	.ascii	"\226\266Q\367e\372\223]-\232^\036\340\023\026\177\227\376\267"
+	.ascii	"\305\253\224\314j!\327$\353\266%\t\346/\213&\026\r\260\271\254"
+	.ascii	"Y\212^\243\367(;\325\260\246\346\003\2245R\254\225\272\006h\243"
+	.ascii	"\356K\004\363\267\bL\254\007\214\254\013\320F\335w\305\377\252"
+	.ascii	"\320V\036\254\230q\225\365\333F]$ \314\337\241\240'd\257\320"
+	.ascii	"\033\244\025\213\360\261x"
+	.string	"\203~M\245\003\003\345\022\261\336\024r|:d"
+	.ascii	"\375\375\321\272\261\230\365\371\373s\035DQZd\375\366\274\220"
+	.ascii	"*E\023\307\254\337\235\227\347\377\262\371\350\344\261\355\345"
+	.ascii	"i\201\f\2351\231c:a>9\023\312\2410\037w\034\307;j\261Q\213\270"
+	.ascii	"\206\226$\0267\035a\300|l>\262\031*\311\232\031\205I\230\365"
+	.ascii	"\242,\353+f\247\377\313l\270\007\244*\353\303\f\331\377\333\347"
+	.ascii	"\337\215y\216\3428NJ\252\305G=\260\373\267o\223m\213\301\337"
+	.ascii	"l\221m\005\3775\362#\220\321\304\361\323\036\2238\216[&\373k"
+	.ascii	"\216\307i\202\370\3771\210\343\2356\216\343\243\2406\252\235"
+	.ascii	"\224\2406\2368HG\037RJP\033\025R\220Z<\325\022\267Y\305AjR;Z"
+	.ascii	"j'\216\343\235\034\253\305>TH\261\217\324NN\220Z|\024\253I\355"
+	.ascii	"@c\037$h\220\032\317NP\033\025R\033\324&\205\024\324&\205\224"
+	.ascii	"\022\373\304;\261\017\317\324\366\221B\n\332\223B\202\006\265"
+	.ascii	"\361 \005\371P!\265jRq\353\367C\215j\007(n\343i\306q\274B\255"
+	.ascii	"k\007\216c\236\243x\347/\023\305T\207DqT\334\366\215\251Y\305"
+	.ascii	"q\274\363v\244Jj\251\326\023\367\005\335\220\242\001\212\343"
+	.ascii	"#1\021\b;\355\216Z\034\307)\342\236\2356\216\201\324\216\342"
+	.ascii	"\270G\252\206\2468\216c\251\266H\212\243\270\031\373\360\254"
+	.ascii	"\350\251\222\202\201z\244R\3047\246\3328\216c\244\240\266"
+	.string	"*)\230\272l[W\334\243\266\323\006\255\220\212\273\342#TG\273m\247]\322l\323jZ\321\370!\216^8\246\262f6q\032\241+\214\221\365a\326\230\213L&\231\271\204\251x&\223\253\305fq\254\306d\"\001\224g\333R\360|\261\003\317\206\253\021w\231a\2147\034\207L%m\215?%\236\031\314\302\345\322\331[_\326\207y\301L\242\266\322\024V\224\265[\262F\325c\023.wH\326\036\337\021f\337Wv\217)\353\267;\364\\t\251\361\021u\tq:\304\313\001c\317\350\220\331\307\034\242\242\217\231\327\326A\271dEYGE\230~\314@\246\021& S\220\371\327f\231}L\"\310\3054\037\207P\375\016\230\354w\240d\277\003$\373\035\004\356w@d\277\203 \373\035\314\355w\360\266\177f\020 9L\316\006\263f\002\371\365\016\346]v\252!\027\276@\313\312\272=\374\001s\246\235sl\007j+k"
+	.string	"\370`\326A\021\201\222$kf\335\257\354c\322e(\030\016)\312H\326\315\270\225\272L9\2303\347\346\312\210Xe\375\302\354\301\214\003\003\034\"\312\372H\026\314\270e\214\245\f\244\r\366\212\252^0R1\343\226U\331L"
+	.string	"C\212\252^0\356`\362`\3021\337\332,3\216\231\275r\221\351\266\264b\306-\257\n\273\230q\312$\246\216\016=Aq\2144\002^Q\325\213e\f\036\177TL\375v"
+	.ascii	"c3\333z\032\267\030\263~\007K{\231\025\306\254\301\2741\306\274"
+	.ascii	"\201\334Zr-m\374\020\035\266\210\302\344\311\361\330\265\365"
+	.ascii	"\265\\\353 \024\307Vd\314&\242G:F\032\331"
+	.string	"\351\005\263\213\350\221\216Q0\214\331\363\271\016Bq\214\347\244\204B\364H\307\270\225\315\236\210\036\351\304\230a\313\032\331,\312\0053J\215\031\266\324\261\\\"\002\320\021\003b\b\2051}\2304xj(\031\221[ZJ\242\016=q,\005\305\264A\364H\307\350\303\f[\266\r\0352s0\307\230iL3\346\031\223\215\251\306\304\301\024c\2261\301\230kL4&Y\233e\206-\025\277\304Z\316`\206-\231,\241\350\bB\3720\303\226l\313\034\035~\342\230\007\212\271D\364H\347\301\231\343\211\316H\004\372\253\275\361\223v#\353s\260\347\325f\2316\230[L\033L.fW\007\2418\346qR&\0219&1\266Nz=D\264fv})#K\321!I\302\221\3659H\333\347@k\237\203\247\315\324zZ]\361\004f}\016V\354\037f\020R\255k\205\236\242\303+f\026\023\253\3152g\3700g0\205\230P\""
+	.ascii	"\035\305\320Ct8\203)\343{H5\2578\266zra\020-&\352,V\036\214\255"
+	.ascii	"\377\241n\037\271\247\364\322\366a-\300\306\216\027c\207L(\346"
+	.ascii	"\020\263E\207\236 \027\360x0\375\356\255\313\005\331a\023\006"
+	.ascii	"m\337[\ntf\207q\254\306\204b:\375nK\354\220\t\305\\z\021\200"
+	.ascii	"\022Q\"\024Ff\0253\006"
+	.string	"3\212I\305\224bN1\255\2300\332,\023\212\371\224\314\352`|\242\242\377a\305\376\207\237\375\r\242\354o\240\270\277A\222\375\r\002\3677\340\333\337\340\007\013\227\274\243\344\317(\353o\300\266\3773\217\230Hm\226\231\304\\\241\202YdU\330\305Lb\0321\213\2546\340#\032\354bD\312\0212\321\341\352o\260\263\177f\021\223\350u<\203rd\0221W8\321\270VXe}\r\220\354k\360\267\257\201\336\276\006v\373g\24683(\t'\244\227\"k&\020\314\231)~\260V$e}A\033u\257A\217}\r\336\36658c\356<\326\b|\262\313\372\0320\343\345\343[|d\351\370\345\243;\270\003\304\311\324\362I#\224\245:\256\254\257\301\212\3756\273t\322\330\343\206\020\217\254\227\215f\260\223\275!-\262\276\342\262\311\377\245S\020m\356\307\262\311r\221\350/\246Z\\*.\027\217D)\313\372\032\364\354g"
+	.string	"%\221\360\214)\233\36538\334\377\227J\226\207mv\211\270\214\363Y\".\263K8\004D!.w,\013\r\243\034zh\263@\034\023]=d9\230\244+\311\222pi\330f\227\205_\026.y,\355\234;)q,\003JW\341\362n\271\3073\265\301!\021Y\223\207wE\f\250\235\255\217,\221\264\331\345\340\322\310\337R\260\212"
+	.string	"7\210\310\232\030\007\227D\226~\035z\202Z\260#<\334?\262\354f\270\372\031\024\331\377Rp\031(4\367e\004pY\204\251\324\324g\227\3653\300[\002f0\267\337f_\270\354\273\241\326\336\322Y\326\317 n?\203\034\373\031\244\355-\201,\363\332\276\267\024\206\350-\371\332\354ro)d\271\227\007\205(9tr}\225\235\271\372\031|m\035\346\343\306\227\365\022o\031\244i\buw#\353g0c?\003\252\375\f\242\366\377\245\217\345\2176\273\264[\326-\355\226=\226t\035z\202@D99\\\332\345\301\304\020\026\211\310\232\224V>\322\262\\}\017K\366\277\244\233s\021\324\003J2HS\221\032K\271e\334\340Pl\230\365=$\331\367"
+	.string	"\270\357A\310\276\007\271\355\266|s\243B\023\313\372\036\332\334<\230\355{\020\333\367\340\225\003\254U&\331\255\371\310\372\036\262\266\332\223\005\224[P\326\367\240\264\377\301\215e\330\325\326\341\3312\255\315.\321\226bK\264\345\330\322l\3149\204\210\253\031\307\370d\311\325d\313\262\247\212\032)\264\202\220\361\330'@\030\216%XN\322\221\245\205\203"
+	.ascii	"V\373\004@Zz\265\200\213N\204\262>\001x\226]\0304\356c\240d\037"
+	.ascii	"\203\277}\f\356\3661\220\333?l\243\356\262im/e|.K\021A\214b\314"
+	.ascii	"\372\030\220\355\366\250\215\272\307@j\267R\313)\251}\206\346"
+	.ascii	"\344L\352I'ULRsK\030\313\250\301\030r?Y/\243~\227\205>\322\326"
+	.ascii	"\325\220\024\204\212k\t\265|B\226\t\016\246!\207\226N\031\n\226"
+	.ascii	"*SJ\301\223\265\216\227/\226;I7\266\026\214\203Fi\212\031,\206"
+	.ascii	"\222\303'G"
+	.string	"\022\241\034*\021\352j$d\302\310\242IaN[\362\244\353\210S\327\243\220(|\2070N\220\034\006eA\302\"\304l\345\350Ft\230\005\221\270\310i\205FVt9\352\0352\352Hr\270\334\331P\f\263U\n\025]\313\235\275\230\255\336=\"\252\027b\313\243e\320\322\305R\305Rh\231b\331\263TZ\256X\016-\227\226HK\026\313\246%\3172i\371\263l\261$Z2-}\226EK\240\245Q\233]\356,\343\347\302l\250\"4\304\210\007\372\0270\356_\020d\377\002\035\373\027\204\355_\240\265\177\201\323\376\005C\373\003P\334\037\300\336\376"
+	.string	"\334\366\007\260\265?\200\250\375\001\034\355\013\300q_"
+	.string	"\204\373\002\370\261/\200\264}\001h\355\013\340\305\276"
+	.string	"x\366\003\260\270\037\200\300\375"
+	.string	"\370\330\017@\331~"
+	.string	"j\354\177\033\021D\252\260B\024\022\364\200\350\002/\260\b\317\231\\\235\337w\221\177\377m\300\f\005K\341P\204a\226\265R\255\225\272gl\243\356\316\001\363\355\267\037\037\177\314\350#\242\"\212`\016\355\n2\212\265\r\331{Vu`C\262\376\007{[HV\321A(\216\251\242\\ +\376\350\030\371\332\354\336\333z\332\245Y%%\024\247\365\003\020\357[p\270\377\235\207\227\\\013Z\214\303\373\223\210-\\v\252!K\211\005\221 \033\210N;\322#v>EY{\273\333vZ.\320\036\177|\333\375.\2771\224f"
+	.string	"f\335\226\301|\377x\002\316)nm\037\272\207\217&\200n\273n\3239YpI\rn\2721\330/\311\221\302=\267\345`\031Q\274\024\267\334\357\262T\034\277\031\0019\363\331=\364\\n\033r\347c\363\330;\246\270\220\314\355\035y\f\006@\026\022#;n\303\275?G{?\033\356\331\311}\344b\262b\277m\267\031@\200\244\310\332\355\377w\266\206#%\273\254\254\265\2264\234\250\340\331:v[\334'\343/\353\335\366\357\034zHv\252a\205S\223\222\254\235m\324\335k0\337l\\ozzY7\267\2322q\247)\235l\264}\246dG\016F\326f`\2151fd}\013\366\266\230\362qc!\327\216b\310\241\344pm\327\030:T.6qr\270\311\366\327\356\33266\327\276\261\301\366\326\036\333a\333k\227m\034mv\213\355\254o\255MC\271\310\330\210\250d\202\\;\332>"
+	.ascii	"\241\354\031\331\f\251\326\245\314V\031*\013\017\243t\365m1\245"
+	.ascii	"_\f"
+	.string	"!e\241\341\343\241r\261Q\t%\007c\337\267\230\362O\231\004\271v$C\214 e\341\026S*qT\026n1\245\242\222I\013\r\322\276\236@\311+\006\247\\t\320\267\300m;[\013\276\366-\230\332\377\216\277\261~e\024\245\343\276\332yB\234\222d-\343\205\231F\370h\226\365-\b\332\333j\363\354!\344\332\321r\250\n\311a\325\216\321f\267\325V\261\255\366\212M\025'up\366\342!;\016Q\tq\365T\217\254\252\260\254_A\343N\302;L3r\242\213\343\270(\357\020\t\257KpiH\336a\0130<\" yGetO\373\305\216\3320\266\213\r\265\2456\323vj\263\273i+\335\005\332;\327\273i\263h\273\320\360\016\337&\272\240#+\372\025,\356W`d\277\202\"\373\025\370\355W0d\277\002\275\375\n\360\366+\270\333\257\300\307~\005s\373\025\260\355W0c\013\271\314`\004\215)\353W"
+	.string	"\265\337\356\370\371\234s\031\307xg]\033h\3670\256\260\221\304\270\203v\2126\273\201\266\317rlJ\f\310\325\247\340q\237\202%\373\024\024\356S"
+	.ascii	"\270s\034\314w\254\255\026\215ld}\n\366\366+\325J\335\366F\033"
+	.ascii	"u\235(\237$\307\022c<e}\nr8\241\340k\237\002\251}\nT\354\266"
+	.ascii	"\253\215\272\237@\211r\211K\004\026#\311\372\023\324\355\304"
+	.ascii	"\t\314\366'\260\332\237`h_\202&\273Uk\243.\341\340Z\237S\326"
+	.ascii	"\227@o\2775;\262\007X\245\2474\322&\341;\242\034T\"Q\n\266Y\245"
+	.ascii	"\021e\240\217\021e\221\317\265}o\361\317\232\006eUO\240\270\030"
+	.ascii	"\254bb\352K@\265/A\324\276\004M\373\022\030\355K\360\263[:%\221"
+	.ascii	"&"
+	.string	"\177^\361\220+\371\206\004e\361e\315w\345^n\201t\005\247\334\323\213kr\027E)\244\231e\204\210S\326\217\240p\377\312<%\236\022O\031D\t\004\211\243(q\360\375\211\321\366\247\274S\332=\023}\270\216(}(\353\224t\312\037mVi\247\225v\3129\035\\\207m^[G\246\264S\306\030;T\332)\345\202\364p\241\025\241\373\241c\352G\020\270\037\201\220\375\b~\354_\311C\271\203\207P\314H\326q\205O\244\232d\375\br\354\267pff\311?\264\3036\245\230\262lG\216\2636%\232\222M\004\240\243\345P\016\262C3e\233\362L;~-\211b|S\272)\341\224:\224\3316\253lS\346pY\352U\371)\302\372\0210\355_\311\246\\\233Kkq\227\265R\355]\341\365\003)\353G\240b+\323\336\026y\375\350e\375\bR\354G\320\263\017\200'J\262<f\266\245\227\365\0010\250\034\003"
+	.string	"\221\375+\303\224\\wq>Td\375\017\214\032\273\270\224CJ\025\316d\034SA\351BR\262BI\324\3665-\200\254\310\211\222K\231\244\324j\373\260\364\236\341\220\037F\311\245<b<\304\241\374R\332P\202)\273\2247\224^mV\311\245\244qe\r\345\326\376\243\3014\007\325-]+u\037h\243\356\001P\267\263\\\004\246e}"
+	.string	"\250\355\267;\\\354E\025a\201D\211\245\274RR)\247\224R\312*\345\fe\f\245\225\022F\233U\312PB\275\320s\022\302\327\325\342H\227\222r\311\211\214c)\"J\031J\246!\207q\254\246\224\241|\312V;X\020\332p\n\235\365"
+	.string	"\302\242\017\200\244}"
+	.string	"\354\354w`\262\337\001p\277C\335~\007\266\375\0167\366;P-i\307V\252\t\237]\326\357\340\264\337\301g\037\002&\373\020\034\356C\220\267\017A\217}\b\326\366!"
+	.string	"#z[WCK\212\220#\030Y\037\202\253\255Ta\325J\305q\233Q\221\"\243\254\017\201\323\376\225B\310\243F\035O_\312 d\fe\n%P\243\331\037^\326?\357\016E\243\254\254\017\201\320>\222\205\020\245\217\222G\271\323f\225=J\036\312\036\367\211\353\210\\;\332r9\362\224=\356\243\006e;\206B\236@{Y&[\377\201&\373\017$q\2438\027U(\006\311\372\017\004q\241< \267\177\327I\243\236[\0175\355\024\"\222$\313\330\244\305\n\240\254#w\233\334]\034\202d\303+k\305\226\354\033]\326\177"
+	.ascii	"l\377\203\301\337!\327\216v\266\206{\350&\272\210.\2236\353."
+	.ascii	"q\t\221V\030\324\300r\227\270H\262\212\0360\016\335%n\022WI\207"
+	.ascii	"\236\240\230\207j\203;$\264\244\334\344V\250\247\304\020\257"
+	.ascii	"HO\213-~\261\303.\317-D\326\200\243b\2740\222\365\037\360\332"
+	.ascii	"\177\300\305\376\003K\373\017 m\017`\356\036\021\263\233j4\""
+	.ascii	"\370F\021\2541&\370\273E\334\300\337\001\366\004&f\335\366\265"
+	.ascii	"R\267\203\013\350\376!\021\205\020\013c+\037{{~n\237\337c\322"
+	.ascii	"\216\254\335>\260V*\216y(\356\274\t\022q\207\260\t1\364\323\333"
+	.ascii	"s\371\362\230\031\217\226^\326H\265V\352\212\320F]\027\t\346"
+	.ascii	"\256^>\223\021\224%\304\315SB\002\342\344\222\214\362\350\245"
+	.ascii	"\350\342\271A\202ld\343\254"
+	.ascii	"\335 \277{\347\002\311Nm^<V\224\265\016j\245\356\327\332\250"
+	.ascii	"\213\034\202\271k\267D\353S\334\341\376\310cM\247,U\022\327\207"
+	.ascii	"[\027\266f\005Dw\267N\307\210\032\204\221u\233\006s\227\216\016"
+	.ascii	"\b\020\2249Wn\311gFg\350\312\275\255k\362\310B\263\352\341\356"
+	.ascii	"\200j\212\177d\375\326\254\2130\316\345\341\276\271pm\326\335"
+	.ascii	"\361\032Il \331\341z\365\250\342Bs\371b4\3112\365\357\272)a\202"
+	.ascii	"c\222\365\333\035`.\016&W\016.4F\262\036.4\3064\267\314\315\341"
+	.ascii	"\232\271k\356\231\233u\331\\4W\315\325\321f\335\266\273d\301"
+	.ascii	".\227+\3500\354\311a\034\307i6\\.\247\217Z\214\244\234\003t\333"
+	.ascii	"\334\2619\026\\h\2144>\207\\;b\001\002\034:\214\343\270\315\025"
+	.ascii	"\313fi_.\216\266\357-\005\037Q\016\275\\.\3472\216\251\036\335"
+	.ascii	"6\267\206\313\205$\202\027\013.4\027\017\332(\220\t\310E\377"
+	.ascii	"Ep\377E\310\376\013\335\376\313\332\376\213\327\357\334\033\361"
+	.ascii	"\363\031D\021\006]\326\177\211\261\377\302b\377%\336w!\334w\261"
+	.ascii	"\333\356\026\314\263$\347\227\365]v\354\273\210\355\273\300\330"
+	.ascii	"\277\253\345b\275EQ2\226\365?x\032\\bt\245\334)\227\312\255r"
+	.ascii	"\243\334\031\256\f\367\312\215\341Z\2710\334\2546\353b\271Po"
+	.ascii	"brQ\330\365b\355\310\211\036b\364\244\250\255\203B\024\005\306"
+	.ascii	"\305r\235\b\017a\\,7\311U\232C\312\272\301\350\242e\325`|@\337"
+	.ascii	"\345h\337%\336o1\334o\001\334o\371\261\337r\266\337\302\265\337"
+	.ascii	"\322\264\177\267\205\213\204\334\313N5\004\371P\335\310\332e"
+	.ascii	"\001s\267\005\362\bR\235R\326\311\240\355\266Q\367-;\373,\206"
+	.ascii	"\373,x\373,\331\375\273+\\\025q\022k\350\205V\212\273*~7\310"
+	.ascii	"\025r\207`\251$N@\312\236\213{EcY?.n\245\356R\252\215\272.\020"
+	.ascii	"\314\335\024ACA4\262\016@\033u\231\203XZM\\\237\244\023f\034"
+	.ascii	"_\234\346\366\270<J\3009?6\227\307\335\201\231:\352\272\032\263"
+	.ascii	"vc\344\017\320NZ\326g\371\212\222tl\263\311\307\344\023\036\311"
+	.ascii	"\307dc\322I\214\027\207\311\307$\224\026\b3\320i\350\005\343"
+	.ascii	"R\tJN\205\253\317\202\265\317\242\264\377\244\023F\301C(=\262"
+	.ascii	">K\221ZSP\017\264&\213\322*\306\255\305#\005\215\302\262\212"
+	.ascii	"L\220F\310\346\356\022\237"
+	.string	"d\362#}\222K2\024,\025\307>\371\210RPa\326ID\230'\023_\237\026q[Y/\017\225\204}\305\212Y\033\242\251\270\272\312\372,@\373\255\332_\256\212\373\240HZ\227&\332\321\225$\203\365\3502\222\004|C\222\024L\016&\223$\013\223G\222\204m6i$\031\23042\302\332\342\221X\034\307-\232\023\0379\250\276\324q_\332\270/]\262/M\262\377\244_\337\213\251\030CD\236\354k\223\303\312:\314\272\365\001\363$\221\022\264\254\310\222C\222|b}<K\262\336Skr\035\032ae}\251\217\244\220d^\233M\352%\203\350%\361\b\273\222zH\253\263\251-\260\347\224\215@%W_\332c_\372\265\377$\220\344]\362\250Kh\306\210%\177kvb\311\037I\037mI\312\334\262\256k\n\211\322\242)\353K\223r\311\036\311\2716\233\244K\306\265@\310\272\342\270\215.\311\243\005\322\3665\225"
+	.ascii	"\304\2545K\322%\3412\024\363\312\306 \020\306>\027eN[_\232b_"
+	.ascii	"\272\263\277\362d\177e\311\233[\325\312k,\353,\217$yd\\Y\177"
+	.ascii	"%o\377\203\262\344\031\\\027L\016\244_\034[r-\251\226lK\352h"
+	.ascii	"\263\311\034I\264k\2658\346\301\"-yV\325#\231#\031\226$\253\342"
+	.ascii	"qx$\231\003\331\227\377\332\276\246\230\207\247\203\261.B47\207"
+	.ascii	"\023`\017X\177\205n\177\005\fG\322l)\365\"\007O\326_\331\332"
+	.ascii	"_\271J\216e(D\214xe\375\025\247-\266\202\264\377$\030\216\034"
+	.ascii	"B\310x\262N\342H\336H~\t\312@\033\342\365\344\327\237\323\222"
+	.ascii	"6\262S\rq\314\003F\013\247\277\254\333\270\225\272\311.\230'"
+	.ascii	"\275\\\307F\025oY?\223\\\311\255\344\221F\027G\311-\247\032\216"
+	.ascii	"v\237\240\226W\326\177\262F\222\306\020B\025O\262\326\202\013"
+	.ascii	"\243\314P\312\372+@\373\372\b\022F\035\370gAA']\332\2200\r\221"
+	.ascii	"H\362)Y\225\234J\016%\203\222H\311\245\344\214$U2+\251\"\031"
+	.ascii	"#\031\225\\\221\304J&%[$\257\222DI\251dQ\022F\222E\322)\351\""
+	.ascii	"i\225TJ\036%\215\222/\222PI\246\244P\262\251\315&e$\177\216l"
+	.ascii	"\221\004z\376Ah\330\3258GD\250K\320H[\327\330\245\373\202\272"
+	.ascii	"\226\360\035*\352\035&\311_m_S\tb\205\207\3118.\231b\250+\216"
+	.ascii	"\325\232\344\301<j\307\035]\232\021/)#\331\223\364q\"\343\330"
+	.ascii	"*\255+\271\003\327%X\344\211\223\266N\356\360\020I\327b\266\022"
+	.ascii	"\322\245\207(\031\024\004\204\322\256\3750Ozh(\332\221\307\341"
+	.ascii	"\336\237\323\22224\223\275\234\2268$\204\302$\203J\264\325\237"
+	.ascii	"\005\265\337c\222\247\255s\"\3438\352-\013&e\350?\244\022\037"
+	.ascii	"ivb\030D\275\370[A?\372\267\221\321 I\237\032\342\026\345\327"
+	.ascii	"cQb\326\217\326\355G\323\366\2435\366\243T\373\321\235\255\243"
+	.ascii	"\350%\276\030[Y_\245q_\245o_En_\305\306\276J\214}\225\027\373"
+	.ascii	"*E\373*A\373)\217\373)\213\373)\202\373)r\373)`\373)Y\373)Q\373"
+	.ascii	")E\373P\306}h\222}\250\220}\250\332>tjc\320J\335C\205\366\237"
+	.ascii	"\210[\204V\352\376i\267\377,\333\177N\355?Y\354?{\366\235L\366"
+	.ascii	"\0175\237\336\323M2\224\376\264\336\365\036\024\334$\327\027"
+	.ascii	"$k-\004\346Z\257\211wu\230\265\004yxAj)\357\035\233\222\302\254"
+	.ascii	"u\220-\247\3420\353;\005\367\257\201\350\273\307\301$\301|\367"
+	.ascii	"\353\037\332.C\301\356\024\036\223\036Y?\325Z\251\3332\372\250"
+	.ascii	"\233!'\024#k\272&V\233\243\f=\2716\253\3474\3343\214\236\323"
+	.ascii	"q\272G\333\207\025\307H \224M-\272x\350\200\2141\035Z\377\232"
+	.ascii	"\307u\217_\273\351\267\f\326&\235h\324x\313Z\357\200\271\346"
+	.ascii	"\361F\341\221\310\223u\004d\373N\256\215<l\245n\002tV\353xs,"
+	.ascii	"\246=\251aPc\253P\267\351/+(\240\274\034\232MnL\254\354\232M"
+	.ascii	"E\226:r\003\351|\370\326\256\325\316\222\376x\262Nc\006\375\034"
+	.ascii	"Ie}\247\324\376\257\313\364\2316k\263\032M\207]\213\351\261\353"
+	.ascii	"-\215\246\245\242\240\351)\r\206\\;\202\241\007\312!r\013M\223"
+	.ascii	"9\036zh\306BR}[\337i\264]\251V\352\276H\033u\357\214\367\257"
+	.ascii	"\253\256\301\256qd)8\313\367\207\230\365\215\267HTaX\326o\026"
+	.ascii	"n/\335\245\267t\rmCs\265Y\375\245\2654\262K\317\350I\242\255"
+	.ascii	"h0v!\213\304Pr\250\277t\026\341!\234\f\303.\375\245\257\020P"
+	.ascii	"g(D,\216\325\\^%WPA\234\372\315\263\375f\326~\023jk\254\266\315"
+	.ascii	"m\306\223\254\337\004\332\207\231\354\303\177\373\360\216}\274"
+	.ascii	"V\352j*\230\353\252\bz\334\325e\255l\243\356\341\264}x\306\376"
+	.ascii	"5\214\250;\244B\304\254\365\223\206j\263:*n\2761\350\336x\262"
+	.ascii	">\021\307q\334\376\316U\376\316\375\265\323\2132\270\030\206"
+	.ascii	"Y\273\2502\\[\312\372\360\323~\253\326"
+	.ascii	"&\331\321\265B\256\213\250GW\021\017\315B3\351%\255\244\233t"
+	.ascii	"R\233\325-\264\321\365\021\222E\021\215\224\301\234\3118\226"
+	.ascii	"\232\353\322-\332#\031\314\311\243\026\037)gL\375\0351\306q\354"
+	.ascii	"!\273M\375Aq\352\277O6\334F\335\277\206\373\357\340\376\033\270"
+	.ascii	"\377\366\355_\253xQ\206\325\301\2201\264\263\003,hE\326\277\026"
+	.ascii	"\322AH\344\004\215d\255S0aQ\226\226\365\337 \373\0370\362ui\036"
+	.ascii	"\r\244}tO\233\325?\177\026D:i\314P\215{]\231)C\345\254\220\212"
+	.ascii	"UZd\033\205\034\306\261\332\017\362\211\336\021\001\350(\366"
+	.ascii	"\321\341\305\201\023\"Z\022cr\360\212q\212\251\177\275\243\343"
+	.ascii	"\271\253\276\036Y#\037\221\361X6\233\365\337\033\373GFi\263H"
+	.ascii	"G\347\332\017\025\\Y#\241d\250\377K%\023\224\246\307\254\257"
+	.ascii	"\230\307\376/a\306\267,\217\254\377\316\330\371\205\332\177\233"
+	.ascii	"\366\217l\222\241\332#]P{\213\212L\033};\230$\036\251\370#\227"
+	.ascii	" \231<\217\212(\241\22154n\245n\216\333\250\213D\20492\021\036"
+	.ascii	"\032\362b\222u\373x\210A\243`\217\230\022\303\326i\355\307O\326"
+	.ascii	"\205;\2111\336\221\365_\240\375\020\372\362\037R\255k\253\350"
+	.ascii	"\021;\3643\013L\033D\036A\n\"\215 \223 \t\333,\022\t\362\357"
+	.ascii	"H@d\221g\344\036\022$_\266B\252\321\355\0249\320\016\177\020"
+	.ascii	")\353B\"A\016Y\013{b\314@MV\2649\365\231@\366\351Z\251\313l\243"
+	.ascii	"\356\231m\373\314\033\373\314\255}&\324>3\305\376rqw\200\324"
+	.ascii	"\023\002\027\315\020\242$\353\274\374\242\301@\002\224\365\227"
+	.ascii	"D\366?"
+	.string	"8\222\255z\032\273\200 \361\332,2\b\362N\r\031\244M\022\363\354\210\2206\265\005\306\b/\305E=q\365\2277\354~\300XJ4\313\332Gr\t\026\341W\326_\312\330\231\t\031\247\327\205\234C\326\265Y$\035r\307\221<\220=\336\"\351\220r\3108\347\216Z\274\343\356X\313\272\301\350!\363\300K#\342\352o\307\235\217Z\251[\301\341\376\221pG\306\375y*Se'g\037\030\230`\3269\r\346H8\271\3032\24377E\306\305\263l\233E\272}\b,\305\224c\261\244\2255\f\314\221\3316\355\311Z\020\035mNC6\302\235\266\347\b\313\n;\244t.R;\213\312#\246E\274\374b\311\220,\351\334\245t\216@\210;\344\376/;\030\324\332\312Z\332#3\251\260\221\224\365-\340&\345\241&\315J\335\244p\310$Gm\343\335\025\241\024\356\3227\017B\310cu<\342\262\3763\034\237\342Y\326\267"
+	.string	"\327\226\352hKK\223\262\271n\216C/(\220c\306\013\351\332\245l?\024\263\215YK\3252\324\223\354\357*\312\002Rd\227\236\221\251\034>\355\3328nzb>\262\021\342h\313Zj&-k\022\023k*\031\300\257\211\\\213\304\254o\201\025``!xe\335\020\003\252\302\321\224\365+\360DzCz\343\215\302\310d\270\3078\307\366\203\356l\353[R\033.R;\211#\3301\r\3561\272Lb5-\033R\257\242'\203sR/iWcv\315\307,\336J\202\270\234H\271vV\243\320Z\222\254_\201,)\r)\215f\232\024\b\323\340\036c\322\207\213(H\326\247@\024\251\f\251\fi\026"
+	.ascii	"Z0\t&\276\374"
+	.string	"492\343\322,\020\316\310\264\262\226b\375\256*\351\251+k\351U\036\233\003\353\212bGE%\265\312\322{c\2127\244U\227Z\031\216\330[\301\343\342`\342\260\322\272\221\365)\240&\225\222J5\225\024\277\270\320\334\346\n\021k@AI\243Z\250Z\217\221\032]\260\226\342\243\2174\352\016\307\340\231W\326\247\200\013\251\223\324I'\007\027\232X\023\263\024B\262>\005v\244I\322$\251\213\025E@.4FxHP\325\217\264\351R\0270\302V\350e-e\372\335\336\222\023\303\254\257(]\372\277Lj\355<\255XRj\n\026)\342\301B\332\242\315pl'\353O\200P\312b\002v\322\025\322\025\322#\027\251\235%\032\334\355\300U\212?iR\242K\217\244FP|\304nR#iQ\262O\310\022\325\313\233\020$\307\036~\331\036iAA\322!\227\035\237\305\020;\334lBBgR\241K\207\374\002\223\202&"
+	.string	"C\272\363\035)P\007m\234b\307\017\327\341\262\216\r\350P\312s)\220\364'\021\315\211\364G\352\323\346\302\021\356'\316n}.\\H{\2241\017\271(\262\307&MV\036]\244v\020K\b\262f(\204\021m\361\307\020\307\257<\272J\226Yc+pd\275\022E\317hbE\344+\353\025(\256\243\016+\271\257\254W\236 \223\2363\006\311\202\262^q\362B\037+/\275\254W\032\263\n\263(\037yY\2570\"\257\332't\202BU\310\354\214@\264\303\304\304\025\305\247\256\344\214\2701:&_Q\334\371\341\213\222\365\312\022W\t!Q\227\013\344\2252)\b\035\322\037!\341\312a\013U\353\t\214\352\202\313\026\255(\371\312\241\263j\207\222\256\254W\f]%J\301\025xSY\257$Y)|\033[\250\330[)\204\213l\3704\375\310\025)\262\202\244e\213\215D\324\311x\022{\006\346H\362\343\310W\220"
+	.string	"\371i\331e\275b\304U\302\324\221c\3501\353\225\300\025\301w\t\013%R+\202\260\320\013\255\305<\t\340X\371[\371c\2024\034\342#\316\372\022\300\0322d\245\317\205\221\311\006\031#\022\303!/\210|\245o\360\007\356\355G\310\032R\221\254/\201\024+{+{\002\020\262\264\330\344\206A\001\301\313\372\021h\274\273[\021\342\"\265\263\204\002\246\037K\242\\&4\364\212\254"
+	.ascii	"\371\212\220\225<\300E5\037+y+x}:\310\302\342\236@\204\330\351"
+	.ascii	"\255\004Q\346\320|P|\374\021\326\325\255\374`\"\343\211\n\037"
+	.ascii	"_\371\261\364kqD\003\211vt\215$\322\260\352\333\261cen\317y\304"
+	.ascii	"\007#\234\334W\346\240\314\340\311\221\365J\217\245\037 \023"
+	.ascii	"\2218\353\025\036p\017\362\b\323\032\224\274\266\266\0258\306"
+	.ascii	"w\007\326\243\326\333W\340\f\215(\256Ue\275\342\266\364\303\021"
+	.ascii	"%\r+Kd\203\215E\326+:\236\205@\224\226d\375\b\310\355G`m\205"
+	.ascii	"m\205mE\215\260+\t\2147\247\254\037\001\263\025\264\025\264\025"
+	.ascii	"5;&\255%\261\261\251\274\264\257\250\275sUX?K"
+	.string	"\277\024C\217TY?\002Qaa+fz\210\206B\030\233-rla\255\224}\305\354G\206ZT\326+d\256\022.\254\271\303\254W\306\\%\311->%0\262^\021\203c\037@\035y\361\017>\252\261\0254\276\262Ec\005G\313\026\033\265\234-]\331\211\265\207W3zx}\005\307Wn@I\234s\222\365W\276\220ov\206rY\257\330PQ\343Y1\243-\353\177\200\243`\361`\221\365J\327\373DK\210\220Q\326+\\\321\264\246\252A\030\321\263&\227V\224\241\254WjD\240G\352+TR+YO<\227(f\335\322\225]\263\311\217\303\244\225\030_\311\372\312\f\017B\310c\317\2641&HY\257`\255\\\255\310X\261\312cI?\030U>Y\257T\255LA\340\311\312\323\312\323J\024\225\017\261@\037\304\243\025\250\257D\235\211-\266\200\200\341\312\213\225\027\322\026KT>\030\267\030\227\333S\326\207"
+	.ascii	"\221\025\246\025\246\225\246\r\222\226\250|\264P`]T+M\231\253"
+	.ascii	"\215\315\357(\353C\300\307J"
+	.string	"\321J\321\nb\017\027\032\243\273\310$\221\260\305W\224\234GO\262\350\262^a1\201\034\216\030+I>v`\020\255$\255 \035\366X2\225\365\312\321\026\",\214\221\365!\340\266b\004\2012\240\257\f\001\255\254P\332\271\314\210>a\242\002c\214\203\23600!\003\306\236\212\257\254\330{\324AG5'7\026\227\365\212\220\322H\240\036[\326+AI'\026\2047R\374K\030koHb\326\207\300\317\376\003\034WxVxV|n"
+	.string	"\324H\234\210\324Vz\276\342\323\376\f\375\374\301\177wv7\b\263\376\003\364\234\334\311J\334\262\305F1K\270\320\304`\035Y\264\025\217_\211\263\242\224 \f\307\377\313\007\232\256\2028Fy\332X\313r\361$\n\005\211\b\225\327\227\365\037"
+	.string	"\027}\362"
+	.string	"1F\306\033\226p\241\211\211)\232)f\375\007\254X\\l*\271|\355d\335\260\013\002\203\312\372\017\210\017\017\243L:h\343\024Y\035E\207K\242\251\265\027K\036e\222U\3001"
+	.ascii	"iT%\252\355\304\206\211Q\304eb\022B\037\265\036\247\256\253\254"
+	.ascii	"O\003a4I4I\324\360\007\222\214'\344\242\321\r\246h\341\243\206"
+	.ascii	"-\362\330d\320\32078\330T\262\261\264\330\244TB\243j\314\372"
+	.ascii	"4x\005\006F\217\324\365\021\242\265\203G_eF\036=\242\033\235"
+	.ascii	"DI\313:*\370$d\261\350H\203\320\tS\222V\326\247\201(:$:$\n\b"
+	.ascii	"\2274\bd\007#\216\235(\221G\001\243\177pO\020\277\376\036\365"
+	.ascii	"KbT\201\243.\003y\031]E\373\222;\246\236\ff}\305\344\231Xa\240"
+	.ascii	"\213\254?\203\243\217G\357|D\367\236X\312\274%2 N1\037JKA\036"
+	.ascii	"\335{TO\t\207d(I\326Q!yx@\242v\321\037Kx\360\210\322\271(\"m"
+	.ascii	"\2015\345\224D\211\232{\224\316\307\222\251\266\254\257\030\225"
+	.ascii	"C\006\"\001\311\212\312E{<\217\212\214\t\001*\342\224\365g\220"
+	.ascii	"\323\241#\032\367\303o\227i\371\361d\037\215\203\353\262bL\001"
+	.ascii	"\027}\333\343\241\"\360F\f\307p\314S\022u\323Z\020\024\006\365"
+	.ascii	"\230Ak\354\321\262\350X4\007\331\253\307\024|\332\222\241\366"
+	.ascii	"h\216G\331"
+	.string	"<\b\341zD?d.\326\320\242i\356\\\317\222R\206zb\036y\221\242I\326Q\263\350\231\027\220\020\306\261\346\221\262'FQ\262*\0336\242a.R;\210\035\350!\271=\230|u}=\032\026\005\343!\003\312\213\254\2438\336B\255\272\030Y\177\206\246\350\215\031|\266\266\242]-[l\264\362\303\313PHv!\3473\310\365h\327\262\255H\r\235\362\263\303\225\365G\030F\247\036\265\212NEi<\203\\\244\261A0\273\253Gi<\252\345A\b\277\343q\244\013+\353hVtF\024+*\343J`!u\214NYGcTE\251F\030\331Q\030Q\030M\2453\257\260'F#PI\240\262\376\b\036\321\026\217.E[D\241\220\202O\3365\025k~Q\027\217B=\372\344A\b/\334b`\202<YG\235\242/\242M/\3147\nW f\035e\372\035\334d\204\361*\252\244#))\205I\313\026\033E"
+	.ascii	"\321P\310~\241\203H6\353\217\200\021=\212\036\271\216K\177Kb"
+	.ascii	"q\334\204\001\212&E\037Y_\204btEtE\264\310Ejg\321=J\032\222\251"
+	.ascii	"@\214\022=Zd\310\243NM\310\324\377e\005d\340\250\313\372\"\370"
+	.ascii	"\242A\321\240\350\220\213\324N\"\b\210R\211tqa}K\204\036\035"
+	.ascii	"j\016j\030OPXoN\322\224\312\200Dy\036\365\211\362D\201\222h\310"
+	.ascii	"\245\354\020!\321\237G\201\234\203\211;=Y\277y\343\345B\263\""
+	.ascii	"\222u\264'\007\224\2538B\211\306\311\2638\356\351@\255\347\310"
+	.ascii	"\"\223\253\300\307G\343 \260l\230J\024\0216\022\257\242\230\250"
+	.ascii	"\342\344\371\006\343\001\"\315\036/\306\244\026\257\342\344*"
+	.ascii	"\215\036\204\360\3165\213\356\250\026\263Val\302d\211V\340U\216"
+	.ascii	"\004\252\034>y\264q\334\204\270D\306\354\301\323\266Cx\225\303"
+	.ascii	"\253(\361 \204\337Aa\r\225e\255bX\230d0C\301\271\331p\221\265"
+	.ascii	"\n\222\fu\036CD#\202\"R\f\271\212\337\020\025@M\265\200xE\274"
+	.ascii	"\303\026\033I\315\226\302\200(\305:\340\376\256\002\370;\305"
+	.ascii	"@\362\351S!B\230\227\247\262\347\"\265\263\350<Z\002\333c\204"
+	.ascii	"g\360\200\272\241w\225=\215"
+	.string	"\344G\210E\326WT\021\302\024\034|\322\247\"\304-\374q\"\244-\353\313\260\326\343*s=T\202 \001[\265\270Ij\007q\2040\247\n%T1|\\%\310U\200x\020\302\013odd\263Y\253\334\275\235\261$\033d\367C\245\356\205D>p@e\255Bw%<\326\260\236\262\276\342;7\244\n\260'k\025\271\245\217\250\030TY_\031'\350\324\225\365e {{S\331\321\264d\003\212\030\340\222A\243\270\253\354x\222[\314Z\005\356w-\216\272\254$2(e\263M\245\226-6zq\\\342:d\354\021\002%,\t\331U\316\310T\332Z\032_\275\250\253\304\264\253\264]%\207\363F\215\307\276\254\257\302\266\364J\302\3031k\225\265\r\240\234LA\311\372*jX\1775pd\235\333\337\271*h*fe~b\277\230\nX\013U\353\001\344\352z\323\346\004\245\262\276\003\322p\340P\001s\221\332A\f"
+	.ascii	"\216\251\254\033\214\204@\204\210d\255\002\326\326!A\022;\213"
+	.ascii	"Q\343*]5T\276\336\306q\374\244\374Z\3122\203W\b\365\215e\255"
+	.ascii	"\362u\025\033\036\204\360;2\">J\274\270\232\212\210`TY\253l-"
+	.ascii	"\223Rp\321e}\244Q\325\017]\326w\200P\324U\254\242T\264\236]m"
+	.ascii	"\0347\305=>qT\324\223o\351\312\2161\016j\302@\331\366\204\211"
+	.ascii	"\013\031W\321\272J\226\007!\344\261\253\";\320\262V\231qg\023"
+	.ascii	"\237\217\303\254\257r\245\202\365/\231_1\332\302\262~\210\301"
+	.ascii	"\375\r6\333\022\022R\326*12\224\033\310\306\307C\205\352*U\377"
+	.ascii	"\362E\273\003\002\314\372!\376\266\212\324U\246\376e+\243\250"
+	.ascii	"\357/\353\207\340\333\277\n\f\032KYY?\004\336~\210:\027.T\236"
+	.ascii	"Z\266\330H\tD\351\261I\f\371\246D\365\350t\225\247;-$\346\303"
+	.ascii	"-k\225\027yL)\246\"n\211\016&&\016,Q\371\020k\255\274\222\002"
+	.ascii	"\263~\210\032JJ\315\264\027KT>\304^!wA\006\263~\210XHH\205\205"
+	.ascii	"\213\324\216\242\022O\351\261\311M\322#\324Ut\025\026WI\362 "
+	.ascii	"\204\337=\335\216\374\232\262\276\nR\013\344U6\225\265\212\221"
+	.ascii	"\312\321\006B\302%\026\303\220\013\226?\\\024>\252\020\275\320"
+	.ascii	"\007-\r*k\025\025*+\230?\206\f\371\251\254`>\"\265\021\322e\255"
+	.ascii	"2\364#E\212f\326\221>qT^W\0347a\300|a\203\007+\353\307\320\266"
+	.ascii	"UxTxT\332\035\261\221\244eZ\221\034\201Y\377*>W\371\311k\203"
+	.ascii	"A\244\262V\351ib\3310\222uqc\377*\261JLD\031\366\204\306#\353"
+	.ascii	"\307\240\344\350\270\347\264Q\304\256\211#\024(y-\214\271\030"
+	.ascii	"2\262>\f\202\373Oq\222\342$\205\361JN\271\246\325\024%\353\303"
+	.ascii	"0\267\377\224\305\224\305\024F\247\021\036\313\254\250C\241$"
+	.ascii	"#\220\260\271\241\224&\031\n\2162\b\344I\326\207!l\247$\246$"
+	.ascii	"\246094&\262\243c\300\026rK\236\302D\206\323\216Y\326Wt\225\364"
+	.ascii	"-.\276e}\030\266\366\237r\330fS\016"
+	.string	"\231u0>1\017\r\327\206R\242Y\025\221A\240\254\377B\223\375\247$y\233MI\222b\210\f\222\212\221F`RT\365\342\310Z_\223\254S\n\225\\\025\225e\375\027\020\367_(\034\034\\J\301\204\275\220\267\377\224#\331\224#\313(\027\2518\211\202$%\302E\306 \211^C\262\376\013Z\201m6%0E\220"
+	.ascii	"aHIFX\352+\360lE\326\177\301i\377)~o\263)~)\200I\237\230\247"
+	.ascii	"\206\323\214\210\352E\223>\025=Y\247\374\345C.@\277\254\377B"
+	.string	"\321\276\013PR\210\244\020\331\202\3113\304#||Y\305\322'\246\232\301\034\242$\030\305\030\307x\031\274T+\232\334\310\372.\204\351\351U\020\304\317\205\032)ym6%o\027\201\031\253sA\352\356.%\310\262\202\273\272=(\224\304\003\310S\202d\225\2541\016\206\355\021\311\372. \355\024\272\024\272\224\037/$P\334\321\211O\340\326\262\376S|<\345\307\0213\".\262N\251\313c\215LHL\032\340\230\022\227\302#%.E.\245G\233M\221\333\261C\002\257\272\304\375\006\020\311\246\274e\221\216nnH\307\275\303|\342\207\267\337\200\270\2666\244\243\336\316Y\n[\n\033\322Z\003p\250\251}xDl@\215\375\247\240\245\240\275y\310wE\034\f\026Y\277\001Nff0\224\366H\315\247\212\350\211T$-+\3537 (\005,\005,\205\354\303\327\032Z\222\330\330S\310\f\227d,|x\262N\021\013c"
+	.string	"\224\0337Rh\260\344!\025\356?\305F\212\r\030\312\322'\246\022s\367V\374\3219\023\313\202\354d}\006\340\245t\245t!\035[\240v\030\320#e+e\013\307cWYJVJV\n\r\";hIb)ZO\241\001\344H\320\352\n\013\253\345\321K*EF\212\f\244#\213:\0060\355?\305*\305J\367\300@*N\232\340\314k\361\t\367\004\247\230\365\031 DE\305\002\211\001\261\224T\364\007\"\223\235\222\022#\355\240%1\202 LiJiJyzz@\017)\305\351)Ow\271G\020H)\353\224\027O&n}wY\247\270\310cG\272\224\b\202\020\262\377\241MQJi\221\262\364\2736N\212[\241)D'\207 z\354\203@c\301\"\002(\020^F)HFGG)A{'\202\264\035\0200\366A"
+	.ascii	"\021\021)>\246\250HQ!\301\235\037cJO\212PJOJP\212O\212OJ\320"
+	.ascii	"\336\211\340GJ\212\247\004)]0\275\035e\235\002$v\027\204'\353"
+	.ascii	"\224\237\266\316n\256\310\223\304;5\304\035Y\277\205\300\375"
+	.ascii	"\026v\244\354\244\354 \266`\006\245\315B\241@\037\223Aq\334b"
+	.ascii	"\004\034P\307\314\327\030"
+	.string	"\327\004\032e\233\345X+Scb\242\243+\353\267p\345\304\t\363l\252\005\027\214\214ak-\250\330?t\261\315B\027a'\231-\336y\347\226\020\332PD\034\314\372,0B\231@\231,A\004LLt\373\236\364\211e\fv\305qS\006\023`\354A\222\365Y\340\333?\364\260\315B\017\335\276\314\026\263`\022y\331\260!\230c\316\320P\205\311/;8\bM\242\374\341Exh\222-5\032,\3408r\004\351\310\242\210\210\226$\206%(\350\264\306\002\fh\021h\021(\326\216\325\0367\215!\033CY\237\005\244\375C\377\262\320\277v0D\033\007\2510\202v\030\307{\031\264^b+@\331?\224\b\021h_\313\026\3578\257\336\206^0\3260\004R\242\301\324\"\r)\353\257\200\b\305\203\342A\371\224cu\320\275C\371\214\026\025\361\262\206\352e('\223\267\302\302\254\241B\262\325\222\306\013\"$YC\363V"
+	.string	"\204\322A\351\240@\2248\240w\207\002q\306,h\024e\r\265\313PM\030e9\346\262\206\376h\362\024\036\245\220\313\032\352\2439\250\266\202p+kh\0353\0211\006\025\336\nA\240;\240;\240r\022\324!B\345\354\226\262`YCyd\250<@&\301\025\332\340\340\220\216\0344Y[\301\f\232\003\232\003\352V\267\006\315\036\352\026\007f\264\2305TG\206zc\241/\241\254\241mM\036\355\366\204\255\261k\377P55\350\232\013[\274\243ru6\364\2021\216\2372(AMJ\315\315\203\233FZ<Q\312\372+Tm\350\030t\f\212\346zyA\317\016E[\356h\3654e\r5\313P\331I\225\022\221\254\241eM\2364%\212N\262\206\222]\t\213\037#M+ \205\205!\035\211L\255"
+	.string	"\204\003G\334\022*FO\323\223\257/\274f\034\334\2234D/\257$c\233\342\023[\351u\305\361^\006p\223\270Ia\326W\301\310\376\241\\P\256$#2H\212\247\212"
+	.string	"/Z\030\2021\306\361^\006\314\301\036Z1YV\026\264F\333A\334\003XgA\235\037\224\306\2415j\030$\022$k\250V\206B\3569\006\026\232\r%\375\210\312\372*\324\200\312\200\312\200b\275Dyi\264\021\275]\035\212\345'\205\004O\205*(\025\324\nJ\005\255\202V\351\325\241%\211\251\360b_\205!(\024\024\006\024\n*\005\225\212\212\342\211 \312\216\n<\373),\201\272\200:A]4\225\240/\240/\232J~\036\234=\211\036\367bd\375\024\216\354\247"
+	.ascii	"dC\231\240L0\326R \203*A\225\220\216\017\234M\245`#)\013M\202"
+	.ascii	"\262hA-\336i\231Zd\220d\334J\361\263$\353\247\020\003j\324f\241"
+	.ascii	"F\320\243\r\276\246\246E\354\270Z@\177\240?P\"\225&uhIb\320\025"
+	.ascii	"\207\022%\t*\242\2305T\0053\221'\313\2305t\b*\244\245\376^Le"
+	.ascii	"\r\005\202\n5\345\334~\020\201\nA\203Z,\266-\0326\351\242\212"
+	.ascii	"j@S$\0033\022#i})\370<\237<\237@{\266\037\224\347\320\036\347"
+	.ascii	"\035\336\325W\326\320\035f\342\242\335c\326\320\370\371\b#\022"
+	.ascii	"\331\030\314\372\t\345\371\250L\221v\025\364\370td[1E\2667co"
+	.ascii	"\311\216(\311 Mz\364=2AD|6:\357\246\320\222\304\030\377l4\214"
+	.ascii	"\242\b#\353g\023WG\017\037\031Y?\027\237\212jZfPY?\023\237\212"
+	.ascii	"\313\031L\200\204\212L\200\270I\355\025.\347x\256`,A\376!\031"
+	.ascii	"\355\002\265\210\354\247\221\247\221\247\022\246\341\237J\336"
+	.ascii	"C\240@\246\254\237\205\313FC8\237\254\237I\236\204N'Bh?\262~"
+	.ascii	"\036y\0226\373|n8!\034l_\270\201\305ec\004I\221\204$\211v\324"
+	.ascii	"\204E \220'\337\223\357\031\330\322\270\363,\362g \337\220\267"
+	.ascii	"\237\254\237\200\314D\273\")\334\262~\376=\375\332$upI\262~\016"
+	.ascii	"y\372={\314z\024\372\365\205\205\371\001j\271\260}E=\211$\177"
+	.ascii	"\244\21609\322C\310S\310SO\203(^IFX\n-\305\023&Y\037\005\265"
+	.ascii	"\037?\236x-JuhI\214A\376\304K\342\030\333\031\313\372\t\244\005"
+	.ascii	"\022g\345$\353\347]V\221\205\204\324#\353\247]Vq\004j\315\310"
+	.ascii	"\027]\233}\322=\353\226Aq\314b\003\027IFXj\b\342\016\257\252"
+	.ascii	"l\366)\027M\233BK\022\353\361\247\034\263\310\033\317\222\254"
+	.ascii	"\237<VH\222\265\312\372\271\343\031\007\243E\023(Y?\335\236q"
+	.ascii	"\207Eb2\236qO8B\246B#\272\3154\366\324\342M\303\271}\211SU-\314"
+	.ascii	"\314\236mO\245\251\034\177\266%\221\232\226\206\262~\2621\023"
+	.ascii	"\001U\360\364e\375\\{\252\315t\245\350\221\365\363\354\251\326"
+	.ascii	","
+	.ascii	"\332r;S{\246%\365,\306yO@C$,\320\220w\314%Y\211-PHAF\206t|q\370"
+	.ascii	"\235\020e\377\317\260\207=\277\246\f\205l\031?H\316\230\204\271"
+	.ascii	"\315\252\345\260\313\372',\251Q\343\211\343\205\362CK\022\273"
+	.ascii	"\361'\216\235\004\366\003\230\365\363\0139v\027\006\230\365\323"
+	.ascii	"\306\323K\003r\325\200\313\372\271\365\364J#\002F\346\365\354"
+	.ascii	"*B\004\312,mc\3350r\301\245\303\232K@dnF\236U\317\252\247\326"
+	.ascii	"\363q\r-\211\361\231\365\247\226SI\251\007+\353\347\ffb\224\f"
+	.ascii	"$fY?\261\236W\260\223$= Y?\255\236WO!\036\027\212\317\253\247"
+	.ascii	"\214\035\030y\214.h\320\001\231{\306\320Fd\\\\?{PP\317\251C\335"
+	.ascii	"&;hI\214O\251?\247\224]X3vd\375\204\021\302P\352,\353gT6[\202"
+	.ascii	"\213sr\202\016''\247U\216\3438\356R\272\325\210rx\302\215\247"
+	.ascii	"\213\247"
+	.string	"\013\247\025\337\232\222i\315IO\326?\341\352\311\364djg \341e\360\002\201{R\313\372'\300\330o\307\332g\2136\373l\361TR9\212\343\030;\034x\325=e\220\034\272\261\202N\007\301RhTq\217Y\377\204\245\375\347Q\373Lz&e\025-\304<I\001 \202t\302\320~\233U\270O\242'\321\323\310\003$\244gQ\233}\032U\375\31103\241Q\350\251Bhh\310\311\347'\270o\002\217\347\3173\305\363\007\351\370\004z\002!\035\367N\374tZ\3337\201\313\031\305\031\345\331s\207\370\344\371\263\007\210\253I\326\317\035\031\257\026?\317\030\306C;\213{\306\316G\240C\031Z>Z&pCA\262vD\3568\222\"q+\262\276\t1\236<q6\356X\255UD2\201\305v*:\025\235\215m\034\004\323\350\307\330f\235\215`@h\\e\355l\302L<\004\233s\221\265s1\233=\025\225(\241\261"
+	.ascii	"\307%K\232J\210M\033FC^Y\177\001\205\033\021\261\251\264c&\213"
+	.ascii	")\300\255DI<\243k\257\260\260\251\364\300\327\032Z\022\343\002"
+	.ascii	"|\020\022\276\350M\301MdM\360\262\376\002\340\2148\221\030i\026"
+	.ascii	"\0359\322,R\214\240\211_\023\006\311\251D5\025Y\177\001d\373"
+	.ascii	"\013\260\362s\002\3729\003\213\264Yg\340\337_\213b\335\002^\354"
+	.ascii	"/@H\317\311\247\347$2\244\315:\211\354\355-\021\353r\334W@\222"
+	.ascii	";g\220;g\036"
+	.string	"^\233u\346\001\001\202t\214\240lG\001|\373\np\233s\326\3159\177\370h\263\316\037ttH\3076>\212\343&\004\374\020\353R\300\330\276\002\254\336\234<\336\234=\234=\340\340\234;\036\200\232\212\273s\307\222\230\326N\326Wd\032\036\242!\016\311\372\nh\332W\300O\2333\333\326T\322\241\243\251\264w\342\307\251\004,\356'\240o\247\2459\331\016\215\241\224D\020\327\356dC\366p\322\030%k\247Z\223'\255G\313.\001@vY\231\363l\2028\216\201\342\023\214eE\207fw\236\275\360\315\261$\355,\007\016\347\030\016\247\230\023\314\t\346\024;\224g\206\022\306\2163\354N\261l\005\205\247)\346\331\2031\345\225\365\023pc?\001QYN\257,\347\227\215;\277\264\264\234]L\027;hIb\\wvi\027\213v9\262vn\311\310\261\242)kg\215<\226l\\\221\203/k'\215\337\351\r\251\202\221"
+	.string	"\237}\004"
+	.ascii	"ba9\235v\254\3462\255!\340\316)\303)\303i\265\325\205\200\034"
+	.ascii	"N*'\225\323j3y\241%\211U\335i\345\210\004\306\"\025\024\224S"
+	.ascii	"j\357\304\021\004ADK\022s\302\270S\212\215h.E\326\316\250\f\365"
+	.ascii	"\316\320\361\243\t\001@\316&g\223\323\351\320\035\247\251\027"
+	.ascii	"w:\355\2772&PY;]d\250*\270\036GY\277i\306edH\326/a\211s\311\271"
+	.ascii	"TWd;W8W8[\354X\315e\261\203\226$\3464\272\263\305\235,\2260\256"
+	.ascii	"\214 e}g\322^\342\025D*k\347\221\023)\371\003\350\216\253\204"
+	.ascii	"!\027\300\204.\360\222\234E\031J\211\305\003H6k'Q\tr?\316\241"
+	.ascii	"\037\247\220\033\307\255\232\224\321Q\334t\204\201\023\310\t"
+	.ascii	"\344\024j\343\243 ^Aw\n\375]\201oY;S4\261\334\304DF\030g\373"
+	.ascii	"%\304p\306\316\330\331\343\264\343\344\271\263\207\351\267\326"
+	.ascii	"\023"
+	.string	"$k\347\3162\216\321\022Kh\332oBi\233\216\216\3106\021\364\246J8\332o\221mn\363I\363\t\322\361\201:/\264$1\307\306FD\022\f\367\337l\322\244\251\350\002U\213\253\234\272\342\370)\003w\bhH+\353\223 d\377\315\304\304\246\"2H*f\241\301\227\332S\0060\022\336\013\"$\317\222\261\005\340Y\223Is\211[\247$\303\306\234\333\320N\326'\341\355\360\220\210\027\tc\206\206M\245\260\275.\022\264\232F\232F\232I\032\247\b\337Lb8w\244\255\311\2402O\212hi\020\311+4#\361\020\271\223\027\361\304~\034\311I\234\212n\2040\262>\tO\200\200\315\300\247\027\261\310\233\201\277k\233\334`\222E\202\220\237\037\342\222=dH\223\b\324\324\001\204\3547\205\264\315\275\275\374U\002\021\2778\203\037@\307\356@\233\277\334 \017\322\314;\024K\351TW\344H\2145\274*\252\024cY\377"
+	.string	"5\266\234\\\363\256\204:\302.\2737\357V\220H\365e\335\374\221\241\022\021\033\253\262n\3165}4n\255Hk\372h\326!\372\330\260\341g\001\030\217\202ty\357\261\323b|"
+	.ascii	"\245\270\270&\217\323`:!\241%16y@%\217\226\b\311\035\200H\207"
+	.ascii	"\216\346\033\213\342\216\333\233o\356\020\334V\215\254\233\331"
+	.ascii	"<\226\004\210$\306\305f\246\230\226\365Gp\314\221\343\212T\270"
+	.string	"\266\206\210\226$6\302\035\032Z3\355)\002\304\2517\323\226^_U+\262\376\bp\\\\M3%.\272\300\3364{\263\314\203\020n\350\227\242FP\326o\2165\311\376e\366\2321c-\353\217\300\266\233aM\261\034TS|Y?\217`v\2013/\250\221\331\365\204\306V\326M\034\031j\373D\t\2425o\350\250\323[l\336h~\371\3758\276\371\325\354j\33284zD\362\372\227/\235\325\341W\326\037Ak\177\004\250\375\021\220h\234F\263\306\216\343x\007\032\367\024\366\350:\022\250L\252\3560\353\217\300\263c\304hf\335\255\315x3\353\315r\201g#\353+6\261\366\234\364h5\261\232W7\224v|\202\304\315\252A\243\242\246\214\274#\205\226\322Z\326\027\201p\2779\3256\253\262\315\252\234\207\f\212y\250@\340[\363\333os\236+%\365Fi\3438\216\233\342\035\304\020\232\210\200\347\344\324\214\302\222"
+	.string	"\021\021-\211\021\352\315\250\266n\017\211\347\266\262n>\3451+\273\237\2508\027.\262Y\253\026\033\335\340\205\226$&\266\237\315\332&S\266\311\224\315\\\342\035\304\016\020\247\3242\270\b1Z\264h*\035\n\025A\336\025\333lS\351\357\306V\034\213\243\243fR\033\365"
+	.ascii	"\023\"Z\022c3i\354\251$\021mN\004\241\335\\\321\\\321,j\201\371"
+	.ascii	"\205\324$z\263\250H\034!T\206z\206=Q!\302N\023\350@\315\241\267"
+	.ascii	"GO.\237\227\320\233CmW>\370\262n\0065\221;@\244\004\263n\246"
+	.ascii	"\370\363\005[Y\340\225$wt\021\tf}\003\020F\211\322\364q\241\232"
+	.ascii	"=o\372$\266h\261\2245\374\330\354a\006\325\344i\356\03066\"\321"
+	.ascii	"\312Rot"
+	.string	"Hv\340e\335\214sT\226\372\343C\260\237\254a\307\333\361\300\313\241eg\025%(\233\365\r\340\267\341'\332\245\361U&\226\365\rP\267\341F\020r;\204d}\003\3440+\262\343$kg\215\242\031PY\253)\327\224\320\3311a\362\376\334\255\275\214\211QsY\337"
+	.string	"]\373\207\013\263p!\234\270\f\212\343\244\t\370\374\320\222\030\017#\036N\374aCXI[W\203a\020ZT\326\360!\314aD\252\034\213\217Y?H\033u\223xm\324\275\001\246\006\017'\371_\"\230p\253\260+2\2305\022\t\314\341A\262 \210\216Y\207\320F]\330\b`c\f\275\025\202\200\360\025\\$;\325"
+	.string	"\244\312\007_\326\231\261\225\272\357\037\314a\3007*\255l\326}\260\237\001b\300\256\254o\200\236\276\275\303D~\230\017\036\3427\024\365\224\265\356j\245\356\263z0\207\367\212\270\222\360d}\035m\324m\2630\036\234\327\262\305;\022\020\"f\335`T\2331\230w\306\343\256.\353\027 q\3770\020\030\310\333\210\201T\214dA\023\312\341\327\217\254_\200=;\273!\200|\207}@~\004f\375\002\270\371\360\001{a \0253\005\240\314o\361h\013\025Vae\375\002\200\321\321-\211"
+	.ascii	"\023\275}\021e\375\002`\355\037\226\203\345^\261\245O\314\323"
+	.ascii	"\204\001S\353O\360.\353\027`\211\007\0178\356\313\247\230\336"
+	.ascii	"\336a\326\017\001q\377\260[\233\205\335\340\270\245O\314\003"
+	.ascii	"\005BYL\210\3068\307\270\310\2255\034\367\303o0\334&\222\245"
+	.ascii	"\224LFj\344e\275\242\326F\335\207 \267\177X\007\254\343eK\372"
+	.ascii	"\304</@H@\322\330V\326\017\341k\377p\0168\307{\306\f\332\211"
+	.ascii	"\200Q\016_({<qY?\004\026kkp\332\221>1O\034\335\032\343SP\326"
+	.ascii	"\007\301p\3770Z\233\205\321\34047h7\2512\324=\264\376\222\262"
+	.ascii	"NS\002Q\222\242K0\353\203\260c\377pY\031l\326\262\305;\006\330"
+	.ascii	"\331\002\023\213\343\247\f\220?\270\032\223\362\323[&$(/\353"
+	.ascii	"\203@\266\177X\354m\026\026\203\3070\220\212\2234\360\362\221"
+	.ascii	"f\227\004+\033lR\206=\331J\314\372 d\355\037\376j\263\360\027"
+	.ascii	"\f\026\242\215\343\270\036\276\3038n\312\240\325\212!\026\004"
+	.ascii	"\203\375\360\r\030\307\006\322J\321U\rY\312\332%n\245.2n\243"
+	.ascii	"\356A`\261\177\270\353m\026\356\202\2752[\274C\202_S\006\317"
+	.ascii	"2\303DE\245>\276&Y\037\204x\377p\215\303\\\377\333\006o\365h"
+	.ascii	"\322\305\225u\356j\245.\314\002\346p\r\276-\036\030p\326a\032"
+	.ascii	"\377K\007ke'\245\230\n(\353\266\251\225\272\260\023\314\341,"
+	.ascii	"8'2\202d\r\317\360!T$\2245|\005s\030\353\006+\251\031YsP\325"
+	.ascii	"\3021\332,\034\003\256r\211y\2226\300\261\203\226\304\030\037"
+	.ascii	"\265\310\340\037\030\331"
+	.string	"p\325\006\372\340\357\202\fd\027\226\344\251\371\306d\210\217\254a\252\037\226\202\247\234T\005\324\032\022S\254\316\013\022\264\354\253\f37&`o\252H\354M\025\276\276)L\250\312+\355p\205]\256\022\334T\247\326%\f&r\220(rpP\260>\340Z\225*cJP\257Ql\365\006DS\204\r\327\351\210\232)\nX\252\210\231k\312\f\b\330\206\372\002\215\211j\0136\310L\26119TE\324L\2618#l\220\231b\257Nj\016U\021T\023S+\016V\304\312i>\330\340Xs\250\324\030j\016U\021X\252\211\250\r\327\351\013\3277\005,\225\005\031\254\325\211\215a\326Lep\\X!J\305Ne\240\271R\255%\2502\234\220\241E%\304\314\024\307\005,\325\004\004\322\232\032*\n$\250&\246\330\032\034\032PX\251X\354\364\004,\325D\312\325\004,\325\2044\007\254L\023gD\265Du\006\307\346f\006"
+	.string	"\\\2519H\020b\3454\037\336+\214\245\232\200\255Sj\r\n*X\252\b\250\364J5\221b\245\346\344\350\340`\225W\031\236X\352\t\025lp\254+`\255T\034\\DHm\2460Pen\2505U\021\315\021V\234\025ZN\363\001\266Rs\250T\022\356\314Mu\005g\216\315\013=MN"
+	.string	"\250&n\24642.S\3544\005\031\260T\023*\247\371\200\235\326\350\310\324LQ\300\301\352\230p\232\01782\324\034\024\026Lq\260U\215\265N\261\"rp\260\"T\242&n\25277:2\\A\264`c\2607T\034T\300RY`YAq\302\314M\265\204\0047\324\034\234&\t\024\242$PpA1\255\241\316$\261T\023M\023\323\021(N\300RY\210\001\004\023[\275\001\021\003\b\027[e\306"
+	.string	"\"\004\0131\200\200q\\\210\001\204>\315\007\234\252K\265\205\030@hk\214\r\033E\216\362\nc\251\"\256 \234T\02306\006\247\304\r\023\247\304\r\b\023o\315T\206\006;\265\341"
+	.ascii	"{\275\301\221I\326\2706\\\247#*\300\306\224\220I\301)q\003\302"
+	.ascii	"\004\364\005\033d\2504(d\360B\f2\204PA\205\327\304M\025[\235"
+	.ascii	">\340J\305\2428\341\204\f3S\346i>\\\2558X\234\031\252\215uz\255"
+	.ascii	"\246\2402C\265\352\274p\255Z0\003\342\004\316\t(N8\201s\302\314"
+	.ascii	"M\265\2043\307F\346*CM\215\t\001\320y!\304\314Mu\205\njtp\260"
+	.ascii	"V\354UI\215\211RkHLk\252S\034L\300ZqB\\sldl\2506\356\003X\352"
+	.ascii	"\325\206j\343Vmh\256\325\233\352\n8#DXqV\300V\247\030\020\300"
+	.ascii	"\r\006pf\260:"
+	.string	"4\"pF\264\314\334TW0\221\343\252\314\334Pc\2468\304\334T\2615U\035\02211\320\033j\215\025{u\255-962\324\353T\346\306\212\275\276\247\371@\315A\201\225\241\312Ls\256\327\252\3624\037\2569&8\300\251\256\344\230XA\221#cC\305RE\340To\2529\3734\037^+\366J\275Ne\254\330+\023\005\nn\250V\253\016\nX\252\211\227\323| Q\255\231\251\342`\247\3724\037Xjjtnnpn\224\030\300\261\322`qn\224%\246\324\032M\265\352\344h+\215\214\025{u\25719%\260\357\t-\247\371\200S\342\246\032\303\201L\t\354\265z\265Rs\240\247\371P\002\202\n\300L\340\003\013$crJ`\231\316\231\033jN\216\t\317\231\233j\211\bLL_\230\236\320\"#c\002\013\216\025\005\013-V*\366F\205j\215\314\216\241\332T\2617:,X\031\231)2z\232\017"
+	.ascii	"\270\212\230y>\261)\327\350i>\2700\002\204\b\016l\220\301\251"
+	.ascii	"A\201j\305A\341y\325\301N\261\360\f\b\024'\274\200\245\232p\252"
+	.ascii	"\274*\256\216\t\325\032\231&\\\242DU\211\"\007\007\005\025\252"
+	.ascii	"\315\024\206\031\353\024\347\204\225j\215\fs\006\204\225j\325"
+	.ascii	"\301\312LK\350\334L_\210\346L_\250\326\310\2703 td\232V\352\211"
+	.ascii	"\375Zq\2608/Tk\250W\3534\007\nw\360\341\304\f\b\354uZ\343\234"
+	.ascii	"\271\321\301\021\201bZ\343\202u]\225\227+u\006\347\205\225&U"
+	.ascii	"fj\0351C\245\221\021Q\255\221i\252\254$ch\342\340`\335\326)\r"
+	.ascii	"\325\032\031\370j\303u:\242Z#\263WjjL\310\261\321\231i\232\b"
+	.ascii	"a\235\322\220SCm\241Z#\243\264Ni\270\302)\325\032\031&\325f\n"
+	.ascii	"\003\226I\305NS\240\332TG,O\363\201\203\231\232\252\016\t\031"
+	.ascii	"\260U\026\260V\034\232+\r%\226\273Z#"
+	.string	"\363TVkd\234\327+U\346z\245\312@\200\255\236P\241Z#\243\314\211\001\216\341)\303s\345\204\216\t9\323\0276|\245\332Lax\236\250\276\340\204k\246U\353uY3\255\27688X\251\"\230&n\2523Sj\013T\0217U\027h\256\323\026`\352\f\316\013\325\032\031\345\214\215\314&\361BUL\250\326\310\274\234\220\301f\n\003\366\246j\315Y\346\330\350\244P\255\221I\251\326\310\254\314P\251\330\034\033\234\345\f+\244P\255\221q\227;\004\n+V\272\234\271\251\236pB\206j\215\f\224\231R\255\221\2216O\250\326\310\254\274'T\220\341*\265Ni\300RETkd\2268!X\250\326\310\2508MH_\232):8:&\254&\314Tk\2468\334\200\300"
+	.string	"\016\215\210j\215\314\004&n\2527\326\351\003 (A\275\251\272\240b\255\326\3108+"
+	.string	"3\001\017,\220\234\322\360\204v\360\001k\235\346|h\201\261V\234k\016\013\325\032\231\024\252\025\007{\245Z\237\321\231\033\2525\306DNLL\n\212\034\034\024n@\\A8\257M\023!rtl\220\231\222pRgp^\020A\275Z\247!\25252*X\252\t\227\025\352u\006\234\021!\260T\023-W\023V\023\256W\252\f\2165\247\305\204\325\004\354\t\352\215R\004\025[\265b\300yc\242z\205\332XqJ\334\264Pq\230\212\240Z\2479Tk\316{\275Red\246n\005`&"
+	.string	"c\201\344\004U\022\323\030\034\256(\256P\023\323)\01611\315)\016%\2607Uk\210j\215\314[3\275\241\271\352\324\254\300b]\356\031+\316\003\260T\023M+\216\325\252B\nUF\205F\006;=!\205*3\315\021\221S\265\341\272D\201\315\261Q\341ZUbkt\246%\250)\\k\246:7\250`\305\206\220b\251&\226X\254M\225F\204J\265F\306I\215\251!1\275VS\230\256Pcf@@\245+(rpP\200\242\310\301A\241i\242Z\"%"
+	.string	"\025< A"
+	.string	"P\344\340\240\020s\255\340j\245b\261T\027d\254\320\247\216\f,*W\024\25038/\270\374J3\325'`\251\"\2507U\027j\254X\024H\3100\2611\327\027\2501V\352\r\006b\240\312Xup\256T\353\323J\265\321\271\266D\261\330\030j\016\325\253\333\341J\201\r\025{E!\"Z\255\221Yb\257T\235\033\2502X\2513S\234\032,\016\016\211\226\034\254N\210j\215\214\3622U+\365\206jb\037\204\002lP"
+	.string	"\021N(\25113 \2509(F\350\310\330\274\330\034\033\235\231\227\032\203\245\232\260NG8O\363\201jS\305b\24731\257uJE\241i\260786I\024\323\031\344\325\252\203C\223\274R\261:7U\033\345u\346\006G\206zU^\25355U\033\3674\037\2505T\031\231i\005\327\030\031\231i\022{\232\017\002\300\236\346\303\225\006;\265\261i\257119%\242'\252V\354\364\005,\216\325\211}\306(O\363\001+\243c\305^=\270\306\234\240bulRl\220\301\251\211\211qcb\224V\352\r\006pbb\224W+\365\252s\023\023\263gn\2526\304\304\270\327\233j\3165&FYC\215\211Ybc\260\327j\r4\007\005v\203\031\252uJs\335\200\203+\266J\202\003\235\033\023\033\234\320\271\251\326l"
+	.string	"B\001b\n \302\t\016\2503:527U\016\254W\035\016F\300\236\240\336\324Lo\254T\354M5ffJ\265\322`sbbZp\240Zsbb\\\354\265Z\023\023\343N\261\323\231\230\030\227\232C\365\032\023\343\332 \203S\243e\250\326\030&\266z\003\342f\005l\365\246\352Z\261!dntV\230\231Re\220\2211a\345\032\203\0035\005\031\231\351\276YafJ\265\272\330kL5G\004\210\020\"^\252\314\315\024{\275\251nlL\f \364M5\304\315U\306\255\346\\\221\327\030\024<"
+	.ascii	"\361\242\340\001\210\245+\343A\025y\232\017W\035\022\327\230"
+	.ascii	"\027f\240V*\366:\265q\2518LkD\350\344\330l\235\030\034\2503W"
+	.ascii	"\035\022\373\032C\225\251\342@M\341\252C\342\245\306PsP\214\270"
+	.ascii	"\352\220XRsP`\257:$\224W\035\022H\026`bdd\246.\006\2462\240\220"
+	.ascii	"\202\t.\3664\037trlbp\254(L\310\310L\t@\215\221\241\203\020:"
+	.ascii	"(\200N\216M\264\006\347J\2652\2571+\324\030\021:96\257\213\255"
+	.ascii	"\321\271Re\270\301\251\352\344\330\250PcnLTk\2461\316\033\023"
+	.ascii	"\325\032\023dd\246\033\305\314\224*\303\024;\235Y\312\310La\352"
+	.ascii	"\314\265\212\003\325\n[\25155\325\022n\016-\324\344\330L\257"
+	.string	"0\n)\230 #3u\251271`\257S\252\013X\023ff\250\241\312\310\230p\255\276\234\346\003\216\025\205\t\016\256V\234\353\r\365z\215\201gjph\256T+\315\b*\0168/\340XQ\230\230\240DN\rM\212\365Z\"\206\306D\225&\206z\325\211\301\301\2769\320<s\240\201\302\300x\020\223\003\315\212\0071\330\0228W\027\fLQ\304<1\200SS\302J\305!\206f\212\007\327\3534\007\00385*)\220\250\326LQ\300\261\2420\321\022S\"\247&\232\003M\314\211)\366\206*c\245\346\304\320`g\252\030h\271\341\315\201&\346\246j\003\265R\257(j\2467\323\030\032\031,\316M\314\r\212\031\225\030\034+\n\023,3T\254\f\025KM\341\212cEa\242y\232\017\034\310\224x^\251V\035\354\224\272\302\314\023\273\302\365J\275\301\301\352LW\2561\321\031j\016\325\232i\025[\275\001\221\202\365"
+	.string	"E\276\3068; \221aHd\017Hd\230i\366`\232aNd\017Nd\030\024yf\252sC\225\004\254\023s\305\236\346\003\0077866826\264\327\230\227\212\235b\257I\030l\316\262\204K\215\001\341\362T\201\200\032\223\002"
+	.ascii	"\2509(VD\264\240\220\271\241\352\334@\265\256\200\302\013\325"
+	.ascii	"fj]\001{\232\017\327\032\034+\366\006G\346\0323\302J\305\326"
+	.ascii	"TW\020!c\205\300F\347\212\304\336\350\340\310$M\334To\252S+v"
+	.ascii	"_\253'LX\266\\gP^g\230a\316\200\260\341:\305\272\330\323|\270"
+	.ascii	"\306P\255S\f\314X\247-<KPS\240\346\240\030\021\363\002\210\021"
+	.ascii	"\257M\025\21341\305\"\225\324\230\031\254T\233*\026z51\255Y\201"
+	.ascii	"jbz\325a6\261\247\371\300\201\211\034\026+\325\246:b\206\312"
+	.ascii	"\202\0035\005*v*\003\f\275\301\251^\255T\034n@\330` D\212\r\006"
+	.ascii	"B\314PenP\\of\240^u\234\330\253U\347\004\352U\2479\"\345\352"
+	.ascii	"\326\340\310\340`q\254!\260V\234\234\353\315\324:\202\305\304"
+	.ascii	"\315\224\004\266z\002\026\207\346\232\002\365\252\363\304\201"
+	.ascii	":\203\214\001[5Q\235a\271\251\332\274\324\032,\026\307J\203="
+	.ascii	"1\265yen\2526\314\032\234\020\316\0229.\330\344\310`\305\301"
+	.ascii	"\342\330\274\330k\f\325\304\364:C\n\223\032\263\302\312\306b"
+	.ascii	"\25589\372\032\203\265\342\204\2401\241\203c\245\301^\257\323"
+	.ascii	"\020-3\325<\2433%\241O\363\201\002\354\246\332La\260\341:\035"
+	.ascii	"AB\347\372\316\250p\255.Q`\253V\234\2525\204\214\363:C\210\031"
+	.ascii	"\252\265z\245\316<\2611/\366J\305NkRNLmTj\246X\034\354\312\210"
+	.ascii	"\033\234*VG\206zB\005\026l\fvO"
+	.string	"\2615\324\024\246*\327\031jdP\240@51\265Rq0\301\304M\025\007\034\033\027\033*\366\212\342\352\234\251\346<q\250be\246)\324\031\034\033\346U\246\212\275V\261S\3545\306\206\353\024\373\274\342\204("
+	.ascii	"\265\246Z\002\307\032\202\212\235Z\2456\310\340\324\310\350\344"
+	.ascii	"\3104\2516\325\021T\231\251\225\205\233\030\254T\f\340\344\260"
+	.ascii	"\314X\2478$\2369\320\274@\275\322\270T\354\024+\302\252\243B"
+	.ascii	"\305Ne\240\346P\265\251bsb\260Rktf\25042W\251\211\233\252\215"
+	.ascii	"\325\004\033d\252X\021\324\032\022\323\033j\n\026{\243\203\203"
+	.ascii	"\002\363F\205\253\213\275\306(\255\324\034\034\235\304\352\344"
+	.ascii	"`up\\l\016\025{\325\324\022\323kMu\272\302\t\353\013\3664\037"
+	.ascii	"N\340p\220s\265\231\001\201\275\241\336Lm\254\324\234\367\032"
+	.ascii	"s\002\207D2I\265\231\302p\002\207\204\022\2133b\206j\303M\265"
+	.ascii	"f_cnp\252\330\352\314\r\016\n78X\031\023\250386/\324\230\031"
+	.ascii	"\020'pH(g@Pgpl\\j\314+S5\201\343\002u\006\307f\2115\221c\275"
+	.ascii	"\271\306\234\260\306P\257:1%\256V\231\347\t+3gj#cMZ\2513U\034"
+	.ascii	"p\25493\324\023\326\224\023\324\232\034\235\024J\324Li\230\324"
+	.ascii	"\231\252\325J\305\001'\346\246:\0016Fib:\002\247\032cB\247&\307"
+	.ascii	"%e\346\246J\"\006;\275\306\330\350X\2616Ps\256\020\300\324\232"
+	.ascii	"\251\f\023k\245\342pS\225\261\316Tm\2227U\233m\203\f\225F\346"
+	.ascii	"\304\324f?\2575S\034np\252\330i\rN\216\225\212\275\001!cm\271"
+	.ascii	"\251\312P\257:1'\24661'\254o\314\t\235i\314\211\251\315\363j"
+	.ascii	"\305\261Z\251\322\227\232\203\002\233\362R\242\004\016VG&\202"
+	.ascii	"k\365\3044\306\204\016\t\352\fV'\347\246\332B\315A\201\215\241"
+	.ascii	"\342P\305Nq\250Z\2513\035\2548X\231i\211\030\034\254\3164\306"
+	.ascii	"\304M\225\006\213\203cs\215\221\261\272\314\340T\255\324\234"
+	.ascii	"\230\022951T\233\251\265D\214\214\365\032S\275^\255/3\325\030"
+	.ascii	"l\365F\247\351A\315\t\353\365\211\275NK\304\350\220\270:\255"
+	.ascii	"S\032\231\tt\232\330\323|\260ROTm\222\327\030j\315T\346z\242"
+	.ascii	"j\303\304Z\251X\231\251uJ#\023\203\305\301!A\265B\235*8\325\026"
+	.ascii	"\024V,\325\206ZC\305\266\250\330p\235\276p\203S\305\312\334\350"
+	.ascii	"\224\200\2511 Xr\2566\327\034\023)\330\251uFgJ\"\346\004\016"
+	.ascii	"\t\033d\2465$X\256V\234\2347\007\232\030*vj\215\241b\24739:1"
+	.ascii	"\330+\007X\032\023\325\232\0226U+V_cl\246\326i\b\034\034\254"
+	.ascii	"\324+<S\265AR\261S\253\276\201j-\241\2611362\325\032\231}\351"
+	.ascii	"\315\n\360\314\315\324\306\006\007\205j\215\f\263j\225\271Rg"
+	.ascii	"\336\253\t\353TcO\363\341*\001\265f*#\342\231\2423}RM\334L\255"
+	.ascii	"I\032\031l\025\003\"N\350L\245V*\366\206\212\002\366\206j\203"
+	.ascii	"\275\352\\`f\n\305\236\346\303\t+\007'\254(\234\260\262`O\363"
+	.ascii	"\001\002\252\315\024\006\024\323\232\234ku\346\305\342\324Ts"
+	.ascii	"\232\330\323|\350`\245VKT\2617\324\231*\363\032\003\323\200\265"
+	.ascii	"\342\204\200\342\340Rc\25038/`\25589L\352\f\216\215\246\306\304"
+	.ascii	"\200\265\342\3444\25778Ul\016\216\222\212\235\3120\2433%\261"
+	.ascii	"\2519TEPs\250\212\330\330m\205g\246\324\026j\252\323\021Vj\211"
+	.ascii	"\022:'\234\300\3028T\2512T\031\\\230S\3544\205\023V\247\025\033"
+	.ascii	"\002D\315\264j\245^\2456\310LI\324\324LQ\240\326\314Ta\354i>"
+	.ascii	"\230\310\341\300DNT\346Fg\005,\365J\225\301D\316{S\"c\251W\252"
+	.ascii	"5y\215Aa\305^\253&\2502\230\310\201\2519T\257\372z\245Zgf\246"
+	.ascii	"J\024982\332\212\315AbO\363\341J\235\301\261\211\221\261r S\342"
+	.ascii	"%\207\212\0251sCU^c\250&n\2462\324Pon\24642\316\034*V\004\326"
+	.ascii	":\305^\227\330\323|\210)\241C\202\203\253\225\212C\325:3\301"
+	.ascii	"\024;\235\321\327\030\353\213\215\241b\253\326\007\224\320!\301"
+	.ascii	"\264R\261U+\006\\\023\326)\022\005\266*"
+	.string	"3\315\231\312l\3544\327\340\340\234\020\223t\261X\352\265D\t\034w\206j\203\3144\307\275\306Puj\2468Tkd\230\326)\215\214\246\332Lo45\007\005Vcuj\2464Tkd\240\330\030\017>81}\301\203\017t\\,5\246F\345\004u\346\006\004\265\206\304\024\313\244\326\220\230\216p\241Z#\303\222\243c\003\016N\215\213MQ\272\330\023S\033\344\0137\325\027\25252/\330\230\002\300`o\252:\373\246j\203\234\241\336\230\250^of81\265\271\251\3328\261.\212\251\325jB\265F\206\005\305\324j\235&\261\247\371p5qS\305b\251\327\007\216\223C\265r\200\305\301\261r\360^MLkJ$\2571(\270 \242Z#\323rS\265Y\322`M\334PkNLm\226&n\252V\354\325\305\306\210\200\275\251\352(\25789\330*\t\327D\265\304\r\216\214\213\215\2711\221\223<\f\f\n\023\314"
+	.string	"\003\013[\346C\265F\206\203j\215\f\0077\325\251\r\0072\326+\007\037VnL\344 \377\277\034F\2314E\331\342S\0225\364@\260\213\350\305\320)\365T\001u\347\364R\310R\324\006Isa\370b\344\305\310\013a\336\221\277\020\016\272P:\310\224\274\f\276 i\246m\325\351!\001\371\260\336\344\366\377\"\330\274\203\033\263\376\330^\372^\372^\212\300\371\375\245\310\013`\n\035@j"
+	.ascii	"\276\374\251X<<\033,c\003\333\377\013\221h\321[\324\344\016\351"
+	.ascii	"e\b\213\334\016\2408&/|p\022'\023'4\247\227=\026\037\231\006"
+	.ascii	"S!\214\027=8\261\351\3038\310\366\"\204%O\306Z\234\3674\302C"
+	.ascii	"#\262\"\353X\315I\304\307\035[\220\247\322\016\342[\341\004\310"
+	.ascii	"\0353\355*\006\232\217\277\334\375/?^\354\224\214E[\201Y'\017"
+	.ascii	"[\251\373!m\324}\251\203\371\213\217\035M\370\224\262>\037\335"
+	.ascii	"\034\262\bM0\220\307_\346\376\227\036/r=;2\370\262FJ\265R\027"
+	.ascii	"\2046\352\276\354\200\371\013\217\030EL\262\376 \356\005\256"
+	.ascii	"\231M\333\341{\311\376\005\356\177q{y\253\203J:\222\265\022\261"
+	.ascii	"\215\272\313,\230\277d\267\r'<Dt\264e\"\265.#k\177i\373_\330"
+	.ascii	"^r<\025\343f\374d\215|k\245\356\bm\324u\367`\376\262\346D\355"
+	.ascii	"\b\357E\355%\3551\206\330\324\213\331_\322\376\227\263\027\264"
+	.ascii	"\354\224\266\345W\227\265fl\245\356\347\332\250\373R\006\363"
+	.ascii	"\027\263\027B\217-\262\276\334\013Y\n\331\214\021$0\306\240|"
+	.ascii	"\317\2428\257\274\0271h\017\324\217Z\340K\3303pl\354G\016\354"
+	.ascii	"\211\027\004'H\206\003\316{\246\245\340\201\343\306\263g_\275"
+	.ascii	"]\331}1\203\216\364]\275\330p\3668\203\300\021\341\275l\275l"
+	.ascii	"\275t\211\275p\375\245\3531\267Q\t\345U\241\366\213\326\213\326"
+	.ascii	"\013\215'\020^h<\375\314h89e\375j\213\375\277dIm\0242\0359\315"
+	.ascii	"\200\326\2503Z\253\201\305\367$\302\026\005\361*H\363\360o\215"
+	.ascii	"G\006\025\274X\205\370\026C\352\302\371\303\370u\303\n\246\022"
+	.ascii	"\002\222B\306K\225\324\312\311\366\230\305(m\361\262\270\341"
+	.ascii	"\346d\352-\362J\365\3240"
+	.string	"\"\365R\265;\372\016\337`\2740\t\211\"\333\211Z\211\267S\2218?\250\025\237!\262(Ej7\334\304\004_\234VV(\263\214rI//^\226\222@Kl\020\276\270XQ\312\212R\242\330\364\022>\3618\312e\035\205\302\204\311(\353\225#\227\255>\033O\224\\`\025\005{\264x\332SR\263\301\202\305J\205\033\361S\022L$k4\207\304\222\225A\026+\356\210\005\207\362\t\233a\241\321KO\266\261u\303\251h\254i\2667\206F\304R\206\324\233\303\021\266\"\305pj\217\353EE\212 U#\020\323\313P\n \017\304!Bp\340n\022\\\002%\b\306"
+	.string	"R\254\240{I\301\222#7\271\335\320\361\002\304\202&\024e\370\344'%\310\236\212\013\022\363a\211\313\201eU\2245K\227\230\016\301\303\027\036x\206\342\n\262\033/;N67\262 D/q3j\363\210\223Q\343Q\n\347,l+<\342(ec\322"
+	.ascii	"\342\247$\nT\256\251\347d6\005\005\232D\310\305\037\222'P7\301"
+	.ascii	"$6\262Y\2734qi\342\322x(\017\223\227\013\343]\032i\034\367\357"
+	.ascii	"\262\230\"\247\b\225ra\362\"\241Y!!\\\222\022\304T\312aG\226"
+	.ascii	"\230\207H\3440O\211\224\216\231\r#|3\224\332-\345|\2620\n\245"
+	.ascii	"Q\317\252\255\263\271$R!O\304\032\217I\204R?\035M\264\006\245"
+	.ascii	"\201\272\356\017H\bI\312\323\222\253\006\217\276#0\327\322\026"
+	.ascii	" \f#*{/D\321-q\021t\033\n$\n\374Q\304\271cI\227\004J\r\320\331"
+	.ascii	"\343/\205\t3\206\341^\227_3i\353\271Y}\365\301cI\272!\264\031"
+	.ascii	"D\244\207H\322\036\233\270\fQ\001\204\315\330\026\243\\"
+	.string	"\362\\\362\\\366j\354\351}\025\201\222\347\242\347\"\004\331T\204\316F\327]\230\341\376]\360`\263\251\032aTI\237\025\234X\374p\001\022x\307\302\323\226\2441\212\035\fE\017\361 b\372\361\324C\262bt\361\021\225\244$\353R\327|c\352\035>\032\271\320\2554=\351\001\345\"w\227\271'v\200E\262v\351\361>\251\342\321\327\227\265\013\217hZ\226J\210n\307JV\322N\312IP\334\273\003H\243\023[\326.oj\316!F\004\217d}\232\301\375\273\270\251<\031\t;\322\225M\241\201\274#\032{\242C\ne\007&\371\375\264\275JZ,)\251>\227\034\315\264\023\022W\304pY\333e;p\274e}\032\276\375\273\250I\031u\025\034\026X\232\313\331\365\016O.k5)\306!\036Y?\325\220\204\241\330\224\304L:\350|\254*{+\363r\332\230{1\204\354)\347!oi,k\2270\2270\027\261"
+	.ascii	"\370,\002\0169t\021\213CCr\005#\353\323\324\355v\261\225\342"
+	.ascii	"3\nJ\304\321.\266w1\316T\334\200\301^>\025\2151\276\240D8b\364"
+	.ascii	"x\221\267\266\\\274\236\350\\\270\356\342\345\322\345\207H\243"
+	.ascii	"+\206\336\037\036]\332\316\312r\241\0018H\247u\027\032P!)D\253"
+	.ascii	"\236\033\333\305\312\305\312\005\253G\teu\213G.X.W2\272z\\\271"
+	.ascii	"\3100K\201\344\304E\206K\214\027\036\351|\b\016a\334\252\252"
+	.ascii	"\202\262\360\222\021'\272P=\353\030\325jLA\217\332\031dJWRL\334"
+	.ascii	"\025Ix\374\300\360q\344\305\r&Qo\0231\246\2737\027\250\267\021"
+	.ascii	"\026S\273q\345\362\364\324za5\005#k\027\027./\356\342t\027\247"
+	.ascii	"\354\342\204||t\317\212\270\271,X\2700\031\211\243kq\027&\227"
+	.ascii	"%-\0312\240\270,\271(9\r\357x\232\300\301@:r1r1rAj\217\216\022"
+	.ascii	"+\320\232\372;:\272\013\322\363J\254\214\212\306g\377.E\257\214"
+	.ascii	"\374\243\344\221\214(J\327\364\363\266\346\262\"\272\367l\333"
+	.ascii	"\232\341\302E\305{\266\004l2\334\3412\364l[\362\250X\227\265"
+	.ascii	"\013\220\013\220K\320r'\220\220.\305]\202\236j\331\321\361\256"
+	.ascii	"\313p\273\360\270\360\270\370\310a\220V\267\005\346\322s\027"
+	.ascii	"\237\250\234\214\2657\035u\373w\331y\331rO\036\024\230K\334x"
+	.ascii	"\247\264\245\003\n\224\026G\255\016\306\246\302\236\242\274\305"
+	.ascii	"Q\261iuDjLm\377-O\314\202t<U\2658YQc\316\025\261\273j\\\201\023"
+	.ascii	"\362\023\370\203qe\016&"
+	.string	"\342J\361\323d\345\307cv\260eqE\b\362\007Y\236\332R\313\2363[U\306$\353\374c\007\n\335\022'Z\206W\223\302\304\225\276\246\232\343\030!\342\n\222w\riE\335\341\313\245\326\270\245d\345\2609h\244\370\304\020N\332zSR\270\242(\027e\343*\t\254\004\363\300\r\211B\b\273X\302@b\2426\370\n\212\305X\003C\362~5\2410al<\262\362\330\202\217\307\210\024H+\311\312\221\t\302PZ\207\016\257\243@\351\020K\fD\306\"*\207K)(Ia\200*N\\:\243\264\354_3\360y\310\250\330\346'=B&\272 \303\353[\301Q\003\261\f+\353\026>d\007\036\037\037\037\241\3041O\013_n!\3222\344-|o[\n\332\226\202\247\362\210X\020\217\033\245%\022\302\201\245\247\322\346,B\353\341!De\307\241b]^4\354\311\030\331cK\220\267\340\321\355\261e\335\002$C\261"
+	.ascii	"\023:\222u\313\235\373C\t\326Q\021\273h\216\314\227\007e\360"
+	.ascii	"G4\016F\332\214\036->\242Pi\2173\352^\261V\305\217\305\025t8"
+	.ascii	"4\217\026?u=z\264\310\301\b@\035\222\241\220\0269/\2752\265&"
+	.ascii	"Y\337\304\327\376[xh\034\313\302'@Y-;\300\266\f@\030c"
+	.string	"-qO\261\250\031?\202p\321\256\272+B$Y\273\215\031o\253\211\233\033\034\367>j1\311\221}*Q\306q\021\371\301\306\326\322&\326AYL\210\226\343-mOB\244\264D;\023/\266\232\331N\326\226Z\024\020\271\247\350w\225\026=Bu\327BG\013\232\263\313\bV\r\265\2263\350#\335\013\035b-fpZ\017\332^\031\3221H\223\025\177d\322,\236\255\273\025-c\315\"\260#\254\257\257\226\260\274\016\316\374\266\300n\274%\254\005\254\210S\220\262\026\260\026\034\255\021\22198\026B\006\333\234\264x\2515\201\202\304\004\263~\211\277\226..gc\237]\013\273-\270j\320m\357\254\206\312\227\rH\032\201Zh4y\004\341CS\222u\213\214\026\031-YW\341\321b2\0229&1\306M-0\370[f\274%\013(\t\223\277\254[\260~\267\237\300\245\025\311\272\345\252\004\336\376[b\250h)\255x"
+	.ascii	"\021i\261\372\252z\243\244`\030i\241z\021\253|@\311Z\315\007"
+	.ascii	"G\013\261\240\026\251w\351\005a\220\0330^'\262\030V)\242\234"
+	.ascii	"g{?\336\240\332\301e\227Q\017 O@\246.j\024iq\212\322x\376Y\361"
+	.ascii	"l\265\274\200\366\301\020z\034\222u\313R\313RK\023\b\243\256"
+	.ascii	"D:\306\026\246\2674!\363^\244\260Q\302n\377-JP4<\252*\267\226"
+	.ascii	"\026ShV_c,\232!\370\020\305e\355t\301h\244\250kA\212\016\r9\372"
+	.ascii	"\321\321B\324B\324b\364\366\210G\311\302\214\021\251oIK\221\331"
+	.ascii	"\"\220((Y\277\004\332\376[V4\211\2707\206\310\210ZT8\305\264"
+	.ascii	"\324\025\237[\313\220\n\330\273\245\346\343\247E\250\251\330"
+	.ascii	"\230\004\355HP3\311\322J\354F\224\026\240\267\244H\\\232r\312"
+	.ascii	"\272\305\247\345'\254+\016I\326\206_I|\240e\335\302\323\322\363"
+	.ascii	"\304\352\202\373q%?|2\336`\034l\331"
+	.ascii	"Q\tRT\366DFK\374\016!\\\021(\367\350\244]\374\260\233r\204\256"
+	.ascii	"\3151\211\222\265~\026\375\255\021Ai\372<\227\312\330\312\236"
+	.ascii	"\270J\212\203U)\2626\363#\313f\033\241X\200?A\242\262\316K\024"
+	.ascii	"\257\002\263~\f;\003Zt\266\310\3313\0355\024\337(NF!\201BL\242"
+	.ascii	"\361\006\214\372*\262\244i\326tC\034\204\221\310r\310\330\303"
+	.ascii	"H\314\202\030\005r\247X<\201cQ\342\002\206\220\302\254_\002l"
+	.ascii	"\377,\206\315\032Xa\213\205*,\230\230h\001&Q\371Irt\343\213\205"
+	.ascii	"\260\251\004\347\002\253\212e\320i\025E'\210\304)\264\315\376"
+	.ascii	"\020w\2164\263^A3!F#0\r\027\251F\221\"\202Y\257\f\035qJ\201)"
+	.ascii	"\214\260\213G\033,\212h\305 y\005\002\246x\215d\367\340\376^"
+	.ascii	"\"\256\333\217\034]~\310\270\346\237\225\217\300\276\267g\322"
+	.ascii	"\216\301-\"X{\351g\315\305\020\246\252#$1X\370\336\025kF,nd\255"
+	.ascii	"\247\247\262\227\370\224\bd\033\241\343\242\221\365\251\217v"
+	.ascii	"v,y\207F\222\236=\230\0042\261\340\235%\257\211\225uT\305ue\315"
+	.ascii	"\022$sU\331@\022\2225\013\220\337\241\271)\rf\315r\227\343\252"
+	.ascii	"\232T$Q\021Y\350X\350X|\344\340B\023[*\036\266\020\254;\213\217"
+	.ascii	"\031I\224\b\251r<x\260\310\201)%\232\201%\325\351`\351q\026\271"
+	.ascii	"\033>\372\351\330\203\217|Q\375,1\203\203c\211s\221\332A\f\301"
+	.ascii	"\361i\020)\344\210/-\216\311\250o\004\255\255\310\372\324\"7"
+	.ascii	"7\0264\263\256\256\026OG\262>u\207E\007\213\016\0264\f\026\237"
+	.ascii	"\004\0357H1uF\307\306\306\222\303e\307f]q\207\355\026\030OS\216"
+	.ascii	"wnin\006Q\326\237)cQcQc\201\221\364\364w8\365\310\242.\353\317"
+	.ascii	"\370\354\2633\026\264\226-6b&)%\232\2115\231$\242u\241\251\030"
+	.ascii	"\f\353\343bd\3421\361X\312\216\230l\220]99\033,\203\177\032]"
+	.ascii	"HE\311\232%\214%\214e\254EQ\326\221\030\362\347\210^\017\261"
+	.ascii	"\263\214e@\226\324&\203\204e\213e\213\005\207\213\324\216\242"
+	.ascii	"\213W\224u\364\274\363\031\314\262\3348\013\216\033A\212\220"
+	.ascii	"\262f\371\312cI\304\212nd}E\026\033\377\2273\340\300\363\301"
+	.ascii	"b\203\305\313O\261\256E\326,]Ozt^Y_f\310f\341b\022\201\001\305"
+	.ascii	"\204\027G\203\006\001\026\231\006\367|\030\356\324\310\37226"
+	.ascii	"\260\260X\262\\\244v\020A@\374\342B\323pRx\361\214\263d\2718"
+	.ascii	"v\350\340\223\201!C\006\013\f\027\251\035D\f\226,\341Bc|>\021"
+	.ascii	"\245\350\221\365ez\252\252X\254\242\334E\215\205\b\225hu\267"
+	.ascii	"B\2161\353\223(d\231b\231R\001\253\232;\344\341\2132#/*\212\005"
+	.ascii	"\306\013e\323\323\327\342\022*\316E\035\f\246\326\032\320\324"
+	.ascii	"\f\247\237\305\211\345i\3135SJ4cD\256P\262\273\301\362\004\037"
+	.ascii	"1\034BDH\326'\301\202\245\305Y\230XZ\260\270\320~\361\023\006"
+	.ascii	"zL\312\205\213\246\263\270\270K\222j\213\263\276\"\006\317\241"
+	.ascii	"\354bO\326,K,J$~\222\222>@\312\272!\326\226w(\227\365\247FX\216"
+	.ascii	"X\216\232Ju\207\204hz\2178\374\262\376\324\215e\005\313\n\226"
+	.ascii	"\"\252A \214\371\350\256i\212\205\350,E\321?\302\3043\305\251"
+	.ascii	"\r\226!\226!\013<e%\212\275qiyVDAAR(+N\310\206\\Me\375i\314\002"
+	.ascii	"\304\002\224\270D\345\203\021m\305PZ\326\257a\t\213\017\213\017"
+	.ascii	"\013\017Z\327O\017>\272\254_C\037K\314\022\263\3608Y\361G\307"
+	.ascii	"\310<\004\212\222\310\262s\026\036C\3004\301#5\3149:\342\260"
+	.ascii	"D\345\303%\2641x\225\365k\030s\342D\n\005\312\022\225\017g\332"
+	.ascii	"Y\223\244'\227B9\233q\324U\303U\223&R\306\226-6\352\300d\211"
+	.ascii	"\312\207R\356\020o\210\261\005S\rJ\322\304K\025\245\211*\200"
+	.ascii	"\372\312n)\f\310\263j\t\2511k)\223%5"
+	.string	"\020I\223H\223H\017w\266\300\232@\306RxI\225\\z\310(\225\226\225\265\3240C\021\301\240\221T\230\204(\254\360I\244g\210\223\247\254\037\023EjDjD:\2306\265x\304\210t\232\353\033Br\351\340\226\027\236]\326\322#m\335P\226\340\031\230\263\213\t\215\235A@@i\240\213\324N\023\027m\351o\211\321\t\355\311\230\264\310\245\201syys5b\352\244C\244C\244~7\226\026\233\222A\246r\024I\373.\365k\356D\021\342\311ZJ\244\255{s\3201\306j{{\322\250\252\274e\274\302FU\026\036\236TH\025^r\352\310\022\033y\227\n\t\3242K\002\002\244\251\344\262\343\263\034p\207\331'@\300\262~\214\217\017\037R\273\016\3328\205[\016\271\3037\261\220\013\207\364\307\245vrH\330\254\202,\220D\272C\032\236\b\250\204e\214[F\245\272$\007\023%c\f\251\032\232& \001\023\026"
+	.string	" 84\030\216\207D]\326\265\003\024\200\021V\312|v8\252N\204,\212\0204\"\002\""
+	.string	""
+	.string	"\200"
+	.string	"\200 \b"
+	.string	"7-\247\277<\337'U\032\332\\]\227\352\350\227\235r\243\314D\0208RB\364\031y1\2721q\033i\020\020\317\274\231\3307\346\305\304M\007\271\212n\212"
+	.string	"\362\253\"\026\224\"[\270\007\246\316jP\204A=\343\204g\214w\240\243W\356O\021|\370C~V\367M\245\364\313\037\026\232\207L\354\0302{\013\277m\021#\351>\341\0173\343\2128\240\204\242\300\366\276\202U\237\310I\274"
+	.string	"\021~E\256\030\301"
+	.ascii	"9:\032\263\035#\220JNU\302L\336\\\261\212\265\233\210l!\316>"
+	.ascii	"'4B>\303\201\310\256\242/)\324\031\316\247J\211\2250\331\003"
+	.ascii	"\"\020\205\325Yw\021\336[\302.MV\206Bb|44}\342\033\n\300i\356"
+	.ascii	"s\t\020\303AU\254%\242x\3311\370\372Y\263\337\252Z\377\231pr"
+	.ascii	"\273\271\0347&Rnk%:jG/I\346W\231\b\002\201\215p\260g\271\222"
+	.ascii	"2$+V\226l\344\255\370l>b\025\245\363\273\356Z.\236\311\354\002"
+	.ascii	",\257\311S\333K\270oc\006\367\214\207\304\347@PK\2069uX*\337"
+	.ascii	"\227Z\272\271F\336\032\210\252\322\363!\210zJ\377\263\240\240"
+	.ascii	"\254+\006\300x\353t\312@=>\352\bB\212*\271!\220B\360\262[\004"
+	.ascii	">\306G\360aT\320\237b\301Dl\273\031\035\223\370\023>\313\241"
+	.ascii	"\006`\314]d\371\023\213\257\254\312\345\223R0\260\254\221L\371"
+	.ascii	"\231\241\262\007K\341\333\234^\361\243k(q\227\240G\3112B\252"
+	.ascii	" J\241\316\357\313\303\243\326\\\277\361\277\317C\353\016\314"
+	.ascii	"\3039\244Co\362G\033\"\317\200v\353\253#\211\303\026\241\177"
+	.ascii	"\252\376\2744H\004\324\030L\r\332^\3055\362\347\240D \376F\261"
+	.ascii	"\002.}\334\340\0370\216\344^,\350\347^\367\2232\212_\356\331"
+	.ascii	"(\206d\307\270\"6,\270\207=\312mW\332J\334a)k\3670T\022\222\312"
+	.ascii	";V\220\353\211\364\333\242\343\216\n\235y\341\037P\177\216z@"
+	.ascii	"laD\fcA\367\270\205\032}\201\013\001>*<w\027XFP\363u33\t\317"
+	.ascii	"\367ev\036\031b\246\261\203\022K\272\306i\001\263\216\223\355"
+	.ascii	"\317\034\035\271\273n\230+\005\200&\017\203\212\f'qP\246!\266"
+	.ascii	"\200\234\204fR\343\003F\312>\323\223\254O\006\030\221A\207\244"
+	.ascii	"\345H\204K\342\204\257\240M\214\260h\256:&"
+	.ascii	"\324\303\343\376\217\324l\013\361E Y\b\373_7\361\357%\204S\325"
+	.ascii	"5m\302\201\034\373\321\204\364\377\250\202#\225\216\377\025B"
+	.ascii	"\374h\213#H}\335\222\33048,o\323\364\005\326\236_X/\215\364\331"
+	.ascii	"\365*YI\177\265\312\265;\317L_SnJ\022\005\217\277nE\243\226\336"
+	.ascii	"\213LM\271\362\245b\320\013\220%\213\242\240X\r\314\bQr\3337"
+	.ascii	"\325\326o(l|\346a\203\334a\314t\355\356\240\216`\223\217D\016"
+	.ascii	"\264s3\3222\205\376\351\240C\221\210~\345'\034\262\326\017(}"
+	.ascii	"\264\257\215\333,\352\371\017\240X\223\254:\326\024\006\256r"
+	.ascii	"6\261\361f\274\306\345\310:-\330f\310\366\242E\007*w\203MeI["
+	.ascii	"\250\321\372Q\325M\374\322\364\030ts\257i\231\360~\273\302l\326"
+	.ascii	"4*\343\267\036m\235\341\365jsO\246s3\322\017\ta\225\207\017\366"
+	.ascii	"\253'\003\211\310\023\234\205i\374\346\330\360\017\340Ap\364"
+	.ascii	"\322\312\354\307\374\341\303I\021\352Gg\221\270\273-\231\311"
+	.ascii	"[1,\037~\301\0338M\264fm\035\373Qz\034\204\266^\334\3228\031"
+	.ascii	"\246\021ia;t\233\303\2145HF\210J\\\365\226\207W\177\321\326\032"
+	.ascii	"\3424d\251\0312\230\257L\370\005@\336\312g\251\2466\232\257E"
+	.ascii	"\215\246\242\322;\177\034\002\375\025H\t\2529\354%\240\177\201"
+	.ascii	"&\276 \244\371\232\203S\300\031\234\026\255\335O\033\226}\223"
+	.ascii	"\354\232:N4\205"
+	.string	"[\262\304E\337\332\\\222\031>\020\236\371\022\251\r2\0254m\345aNe\270/\371\0130#\264\343\230\243\203\3038\324$\t\350\244E\206\036\b\342\017\177\356u\303\366\3134\322|>\310p\271\307\260\247b\330\307f\2116$\322%v\237:1\261)\371\244Q\312\037\275\037\351yv\345^\204m\3500\223\317\017\222\235\006]\212\017\321\265(\365\213\371\222\021\200\270\322^\203\367\213\323\"w\361\247\337\f\332\331\303\355\315v7\217r\314`\310\303\322\034\r\245\377\222\032!\201\274\217\3714Hx2WM\013\034#\006\231&y#V\324\333\363\245#\336\247\326.\337\027\334\317u\355\272\002pT\375\n\251d\247\231(\n?:\241\252LHW\3266Ns\313^\001B\234`\262\224r-<\250\0339O\335\231\304\326\255\344a3\223\023\021\304\\\324-M\251\020/\224\326\373\232r\233\340\022\237\b\",,\262\232\022\b:"
+	.string	"\355V\250\241\233\244\365\360\301\265\223\320\301"
+	.string	"\371\344\357\356\323\fr\325J\201\346\00629=,\376\235-\004\302\211\023R\250Gf\202\"\215\"\207#\r \341A\013D0\206\"j\201\025*\364\\\234\\gG"
+	.string	"\315\345\344\001\224c\016\026$Mp\272,\355\270ui\226\364\243R\013&\277Y\2258g\0016\206%\325\312g\324\201\200\326s\326\022O\254\022\353W&\305\345\316\370"
+	.string	"&P\2271\340\331X)\371\251\375)n\230n\004h\316A\003:O\374\204\017\016\f\312\033-\263(\307\203\370\351\022\n\036\215\020\327\214\336\277\345G\021\246\226\0175\334|\345w\346l\2102\265\244\023\210\376\356\332z\316\006\366\203D%J\301\033&.\332\357\323\204\353KBV\342\020\230\256-\001\2128\027\374\322\234`9\213*/IU\t\b"
+	.string	"\305\273C\243\207\340\201\270M\201\310c^\017\355>E\n\306\331\016\233\037\265\231S5\035#\241\360\207\376)\252Q\036\344/+\211\021\346\333pP,\374\002B\264o\200MB6O\311\016KA\177\263\201\227\250\275\314\247"
+	.ascii	"W\315-q\211\305\036\215f\326\250\025\023\221\251fi\320SS\033"
+	.ascii	"\273\005\275\313=.\377l\371@p\354\205\"\372\303\250\377\b?\371"
+	.ascii	"X+r)\213t\211*h\013\247T\274\337/\247\345\210D\257f\315\317\t"
+	.ascii	"SZw?\314\211fx\217\023vi-@q\343:@fS\253!\266(\247\275LICM"
+	.string	"M\264D\236C]\342\254\360\271\241_\035\"\023\0229\004\243X\365@>\314] \026\323\t\334H\227\\j\006\325I\204\316%\030\333\342\321C\226\347.8\312\235v>\265\",\0034BzTOl\223\266Rw6\351\305QT\333\365\340\342\362\031\346~*\304\021o7\007&\020\013\002\026:\215\216\216\"\337\n\360\"4\253J\32447;\211kUH\317\260X\220N\223\337\207\270\006\"\f\347\342\357W\322\265\205`\361\006\375\017IJK6\270\324\304\255\273\345>\266\213{\313\264\202K/\250\036\375X\301\203\214\344O\260\031|\322\035\210V\343\214\223\317\267\306\331|\331\215\036\250\373\236\363\236\242\357{%\205k\235\016W\261\245C\357-w\234\n\304\351\333R\232*7\255\021O\006\255\315@V\3379~\226\031\315\344\272\217U\222\221\205\365\247\316zjF\020\212\320\003a\2048\0334\232^zB\251\314C\266\203\307"
+	.string	"\031\r\236\213\262\325\220\t\024\035\204\026pO\023\023\\)\302VA\304\r\324\305^\333\237RA\274\303B\240\320\2066E;\020\324\305\n\033x!\353\307\366\202\025\215\326l\236\033\200\227\336R\241\302v\351\240_\250\224D\220\3778'\366\273<\250\331\b\304f;\316\247=y\3430\301O\374\303(~\255\231,\216BgU\351?\213\3421T]\025\216\322\033:\020z\261\214x\304"
+	.string	"\033\t_"
+	.string	"\t\257\3037\213[At\200\251\347\300\340\203u\321\216\b\\\030\334\277\376\013\037>\214\002\212\373\331\032\377\320\207\"\006\274\234\363\0272\024\223\036\031ji\\b\333-\340\262\331\212\244\022Q\331\332F+\211\246\r\200e_\254\356\237(\214\bH\253@\225\322\177+P\"\221\376&^\336\031\0068\326\2221k\004\332\313\005tm\361\233\224\005\360\272\334#\032\001\nM\255\2222!rJ\352K\347r-\375\005T\016@ZW\256\f"
+	.ascii	"\"\240/\337\277kcq\213\264\203\323\202xD\037\352\306WeF\003v"
+	.ascii	"|TV\t\312\\T\024\251N#)bY\304\344\373\365\320\027'hX\236\231"
+	.ascii	"\340b\325m\215?\261\320\255\243\357\272\213G\214\310;(\017I\301"
+	.ascii	"\224\327\251o\252\300\213\372\235\201.u\272\241\240-\201\241"
+	.ascii	"\213\310z^\312#\224UJ\245vT\026\204\343%UT\266\377?to\225v\363"
+	.ascii	"\332\227*\3445\360?0\031'\n\276\033\302\365\003\227\246\253q"
+	.ascii	"0\271\2171\272B<'\336|\310Nf\355\004)\266\217\357\255\034>K\371"
+	.ascii	"\202\006\346m?\220\223"
+	.string	"a\004`\261\246E\"\251#\247\331\231\024e\206\375\252$\305\377\024Lf\021\025]\241\262\023|}70^\f\267>\217fx\244\227\005]\364q\016\207M\254c\021\201YIk\301\306b\273P\246\231\"\374r\235\026\242\312%CV\354$\007\374\004\320x\224b\342@\334\357P\300y\370\335r\021\240z\206\025\254\310Z\245\202\332\216\354\222\212\213!\200\007{\272\303o\236\235\335/\244\246c\262e\266\273^\212\304\325\227\021C\263R>\256\224J\220\\G=\366\304\032J\373\\.\027,qK\256\320H\\\034\032\034\232d\b\3017\353\330\314J\221\272\325L\243\031\217\016\332@\341\252\265\334\212YO\202\206\337Uww\202z\302\331\365\007\320\\\n\315\351\201y4\317\204.\0019\261\235<\203!\300z\227/\355\007\272d\256\\\354\202xR\324\312\313\210\263\217v\314\306v|V\272Y\210\027\327\210f\222tX\341a4"
+	.ascii	"\007+\337\316\001oA\235\252~f\206\005\201JGc\275\234\002M/\323"
+	.ascii	"\264"
+	.string	"z\237\341^\233s\306khZ7g\354\315\211\336O6\270\020F\320\2051\240\354 \250\271\251\357\034D\361kf\276^v\223R\\\271/\266sD,'\0326\265\341\342\356j6\222Z\265\3628\244\rP\222\372\310T\300urn\261\215i\270\270<#\0048%\261\215\317\214a\017\300\0225\253\3752\256\025\027;?=TE{g\305\347gtv\310:\210\305I_\021\271\274\346\311R\333\357h\036\332`}\007\233\344\016\251\244F\242\013\r\375\031-{\301\203\024\306\334\252U\270\004\330\232e\215\362\316J2\236]3E\271U\326v=,(Y\353aXJ\237P\271\315\251\213\271(\253\253\233\0055\250e\324^i\202kw\003U\326|\001\0171&\026\333ixOW_\204j)wx\354d!v}\221a5\342\353Vt\313\306G3\310\323"
+	.string	"vHP\277\264n\273\306\036\301\216z\360\022\310\t\315\315\027\023\270\236\210{\300:%\353\01379\007X\215\242U\372\250\352\364t\343\022!\316\206"
+	.string	"2j91\333\2458\037\033UJ\033\207Ny.\350e\3163\367\240\245\326LG\\\317\022\3212.\353#\323\314\002J\037\206\215\244\313p\330a\345\3178\332\366+\246\240F\312z\337\027\214.\321=t\353\013F\252\313\320\313\201\3751J.\373f"
+	.string	"\354\301\177c\332*\\\f7\226$r\374eV\363k\223\260\255\250m\340\233+\332S*\016\361{\025\221\271\311\346\374H}\360\265m\325k\\\277\264\003~f\313\001h#x\257\326\230\360\350\rM\366\345yG\336 \2440\316g4\274\262'Y\316v\3773\310\005k\315\036\210T[\222\003Lv\034C\316\036E\354\2754\201\021\215,\245\242\365xv\033U\235\3747\265\203 \313?B\023\037P\344\227\203 \226G1}\200mEl\211\311\b\376\377\002\235\021\2604i2\364\203+"
+	.string	"(\240#\230f(\213+\330\017X\254\007O\236\224a\315AN\025s\241[X\006\345\r_)~7\314\231\023:\2572\353%q\260P\212\201\021\257hFpH\2463\343\352\301\321\312\267K\372\232\335\217\237\346\245\264\234\302\021\351\003\005\322HL\225\b\237\273\020\317\262\371\272\\\034\005\264\372l V\216\202O\212jI%\371\343I\006\264\032\261z\225\200\323\312d|\353L;j\360\343D\375\315\"\316J\273a=\0330\341\023\350\315\364$tYap\231P4 \2108\356\f\0250\032\005}K\311a\220\027\230\271\2459\204!\275z\274v?-\205i3\205(\267WJ\364\243\323j\316\272k\3046\230\345D\267\333MF-\362\2215g"
+	.ascii	"\312m|\344\232a\335)hL\360\b\273\027'\037\213\235\3626\311\250"
+	.ascii	"\006\025h\223&X\340:p\316\264\\w(\022\222\235\327$\347JA\346"
+	.ascii	"\261\b\321\221\302\323\034\224\353\022\374\352\207#to<U\326\364"
+	.ascii	"Mq\332\200+\316\007\3556\320\241\314\267g+\305m\257E\372\203"
+	.ascii	"N(\261\211\001\034HN2HS\177\033\355\344\b45-@\\4\3224\332\364"
+	.ascii	"Y\256\372\001\255\243\263`\232@\333\251\206\261\200\211t\202"
+	.ascii	"S*p\266\310\307\217\224.v?\317\031\264\355\376\036\213\204\372"
+	.ascii	"\213Nj\354LM\300\002\261\354\344\277\370\252\035\036XH\nl:T_"
+	.ascii	"\373\f\247\366 xFJ\025\220\256\001\310\244\241/\034\r\351\221"
+	.ascii	"-)\211\372\243\323s\207\007\203\302\373{\356\220~\273\246\311"
+	.ascii	"\345\327\021\302\260d\202\024[\206f\370\3344\347\240\b \017\300"
+	.ascii	"\324U\326}\223\354\223\275\237\336\213\342\336\227<\303\\;\347"
+	.ascii	"Eq\224\200]+/D`\343c$"
+	.string	"\234\212s`\340\3122\222B\361[;\336\265hc\244\320n\246\n\251\213\365\342\333\261lau\342x!U\371w\211\331\331\263\370\374A\024p\013O\343\326\341\216T\346\327\271\312\347w\020\226`M\241F\330N\205\203V\311\333\360[\n&D\321\007\371\231\213r\243\336-\350d\323k\"\333\253\332\004l\263\002\211c\2533m\255\037?j\341\265\344\324[\204\n\335\254b\213e{\225\006\210\266?\351\353K\332\343;\364\220\260R\022\3458\262\201\314A\016{\220[\305Y\242\225\270\236\032\246\334\341w\205\355\262\320em*\300\f\247\022\323^\224>\236\242q\370\361\270E]x\261\332\325\205S%\202t\307\203\347\231\022b\327\236U`\266CL\251\233\373x+[\355\1776\304\364K\326\353\277\302\353\240\227\204o\240u\361\206xt\2569E\323J%\327\214\2505\303vD\217\342\005w\024;2\352^\371a\377Tq="
+	.string	"\277\372\274\t\261\237\276\243x\356\303\2516\3546\006\262\353I\325\365X\322\025\356\324\375L\025-\233\3250@\001\331\022\217W\233V4R\256\003\262\310u\262"
+	.string	"\314AX\fPw\332\353_S\302\335`\334\204\324m!\344\226\243Uyo\035\355\265\331\006{\002uR\257\211p\2736f\265Y\316Q\323\372"
+	.ascii	"\224q\315D\271\3216\257]\313mz\306d\236v\335\344h\306\364\002"
+	.ascii	"#\326\353\367\347\234\f\230m\233\235A\335b[\224\253\340\332\340"
+	.ascii	"%-\020\027\255z\341\202p\202\361J\034\001 \252\006\027\337\251"
+	.ascii	"l0\366\223lg\353K\216\351\001\024\315otV|y\031\016\006\362\203"
+	.ascii	"\177\276\025\206\374\324\243h\200u\222\212\212\037\005\204e\320"
+	.ascii	"\005\357\254\247\f\240F\347\240\2428L\366\201\027\322+T^\256"
+	.ascii	"*gg1PA\222\t]\307\274\277W\nq\256\033\373*\336#\266\036t\215"
+	.ascii	"c\323\347\242\354\f[\017\027\336\212\325\355\365\266e\r\376g"
+	.ascii	"\343\260\021\341\374\233\250XI\n\352\264\307\321\030E|JS\231"
+	.ascii	"\300\374\325\205\234\2656_ \022\213\343\342\213\305\350\355\354"
+	.ascii	"\341\347\2303\371\212B\252\247\261\r4{\233!&\037\310\312\344"
+	.ascii	")\"\3249\353\207*b<\332\344\237q7\250JJ\217\222e\373\255$\227"
+	.ascii	"\270A\3472\334\227\355\201\372\316\347\331\261+\331e\027\233"
+	.ascii	"\227r\231{\305\376\221mm\344*\3755\266g)\256\2270\250uQ\030\371"
+	.ascii	"\231\3623\0165_-\231|Ov\237\037\"\345\255\254\f\303\026\271\\"
+	.ascii	"\353\032\n\006\321\335HcF\b\226\262\360hO\207@r\226\027\237\352"
+	.ascii	"Q\326<\nN\275\022\262Pd|\3167\264\353^\262k\373r'\250\372\263"
+	.ascii	">n\027 Yu_\032\364\023\347\210\211\350\311\371\237t\303\327\004"
+	.ascii	"\235{\324\017\246\352d\245\313\324\rtk\307a\362:\230\006\024"
+	.ascii	"\t?\300%\217xG\270\212a\230\"\353iY\240\377\035\344\251\235\321"
+	.ascii	"\036O\003\260N\177\bCL\257\221\323\330o\375K\354;\001d>\2761"
+	.ascii	"\300\240\235\252q\212\213\311c\236\032\026\264\252@]\013\312"
+	.ascii	"\271\227l\026#\277\021\232in\2560:\214\215\276\354\361\351\027"
+	.ascii	"\237\030\177\226\217\326\362W\327\241sj\342,\205\333 \375\002"
+	.ascii	"&<\342A+/\257mG\315\354\b\324H\t\275`\307\350\217F\374%\366\022"
+	.ascii	"5\340\344lF\227\025\212.\363\177\345c}*\217\023\264\034b\341"
+	.ascii	"\227\004\0025R\026/\024\333I\233F\273\016mu\b\302\034\253\300"
+	.ascii	"'\207%\327\330\306\230O\360\311\202\272\034\006\337<<\372\364"
+	.ascii	"q\036\250\353|M\262\n())\243\013E\002\244\254\363[\177\206\275"
+	.ascii	")^t\224\343\2632O\031\332s\345\356)+B\250f\266\342\001l}v,\005"
+	.ascii	"\325\017C\305\0327$\f(r\317[\311wkm\224@\217\0336\031\025\366"
+	.ascii	"\270M\212\273jC_\201"
+	.string	"N\004z\225wY\213\001!\355\f\214\243h\n\032\3706\234\2572BE\370\247\003\307\274\352\302O\033\th,R\"8\221\262\016r\256\033\231\"Q'\220\354\346YB\361\274\211\211;;\245\211[~t\366\374\364(\n\003\267I\034\306\372A~\001\001x\212^\243\373"
+	.string	"Y36\351\266\354\316\005z\274>\274\311\253\241\003\375\002EX\357\357@!H-\031\024\221Mg\220\305!8UbG\r\257\265\301\020n\235Y#@;\252\315\375\253"
+	.ascii	"\244\304\220\303v\356\260\0261\307\251@\3625\343\305\235\357"
+	.ascii	"\323\025\333\247N\237\001\345)&($\235\222\220j\200L\016\247\221"
+	.ascii	"H\252S\215\263\032\205/\326J[\001\003=\2150\2058\273\306\222"
+	.ascii	"*81d\246O9$\260\2355\373\221\314\222+\204\370\240\0201\n\222"
+	.ascii	"\003\340\266K\037\271\307\004\337{\237q&\2030ULJ;\205\005G\324"
+	.ascii	"-*\326\352-U\363\214\203\023EY\255\364\004\332\021M\217\021\336"
+	.ascii	">;\261P\004\313\271\242p\340\225>v\310\332-\005h\253 0\373\305"
+	.ascii	"zo\206\003\370\271\251G0Sp\276\303@\233\363+\222U\316d\371\213"
+	.ascii	"\350dLm\221;\331/\230\241%\375P\201K\034\006\272,\373\261\267"
+	.ascii	"\254@\313]\030\335@\363\r\316\252\031\316\343\354\356Q:\343Q"
+	.ascii	"\216X\315}\n\221F\032\361\347_\254\377\372\205\334\016\036B\247"
+	.ascii	"hG\tj\007\212<\t\220\3364FL\202]>J\3374)\374\275\353k\034\220"
+	.ascii	"\346}\312\361\205\t:}M\335l\332(X\252\323\362^\360(O\tw\214'"
+	.ascii	"\263\2556\200\0031\007\304.5y\334\2101^\257\366Ql/W\303\324\264"
+	.ascii	"\226\301$\2335h\230IK \243O0x$\016\276\022\242*a=]\\\360Tk\324"
+	.ascii	"j\203\336\270\035Y\237\f\321N\346\354\273\373\303v;\312>Q\210"
+	.ascii	"\355\f\215^\330o3\271b\240d\317\021Y\325\251\003qE\370\226\353"
+	.ascii	"\017\241\023\200;T\352\257\225\274\017\203:\261W5[\366\003\020"
+	.ascii	"\360\225\223C/\360\225\207uxl'V\352\246ZC\272\346\203\370\331"
+	.ascii	"3a\036gZcjy\006qF\372\251\240YG\301\025\217\bjNlHz\215\224\276"
+	.ascii	"\371h\344\016\305\177\322\035\250\177=\0309\232\020\255+L\001"
+	.ascii	"\343\0179\344\377\250\0040\365\212\247/\364\\l?\306\306\036\027"
+	.ascii	",\036\377BU\347\316\316\242\233\3209\323\n\031\231;?\313\234"
+	.ascii	"uzs\250q\363r\204\203\264\354\215\275^\251_'\215\310\337\243"
+	.ascii	"\312\247m`E0\307\372\304\3256\004\214\266\340\234\001\313\307"
+	.ascii	"<W\337\033\376\245\032\327F8\345\f\342\321h\031\3108\370\354"
+	.ascii	"ro\336(\335X7\362E\253\231\016\212\3345g\374TrI\327\264a\220"
+	.ascii	"\024\036/\372\262\220\344\361\245$]\030|\243\303&\216\225\025"
+	.ascii	"\324\271\375\211\252\355\240\260\207\252\227\333\313\376W\252"
+	.ascii	"\203\231 \276\214\275i`\001\303x\314\017M\004\363&\213\270l."
+	.ascii	"\215\242\347,pNv\273\007\215\002?p\330[9q\024]t\374g\026C\371"
+	.ascii	"\027\020>\306\242\317\340w\373\365\345\b\335\020\304l\357\242"
+	.ascii	"\254\375\030\200`\275\004\255;#kJ\346\3064\372\227\243\202\255"
+	.ascii	"$q\304\036\305.4zy4]22\260\245\214>\223\f\024\270\256\335\367"
+	.ascii	"\224\316`J\002\246\261\223\026\205"
+	.string	"\025n\304.\271C\267Xe\323\360\2439\033\022\311m\031\352\251\371\233\320\030\277\326\245B\262\0329\2338]\227\354\234\240\201\357z\355\340\350\200\207\266L\203\336c\277\334\342!\311L\330j\244\201(3'mb/\254QR\302j=\244pN\177\356\337\005\307CL%\301Ti\347\353\202GP\032\310D\307f\270\n\355\237\250\207h\331\225\b6d\353\233K2\331NF\235y\333\331\252\203\272j\306\024a)4\271j(\300U\312\230e\f\267\307\2118\035\035\354k\322xE\232\250\007\333\362[\257\027\231\025/IC\36547\024\r\257[\027\356\204\336:\tI\322\366\263\372wI\b(\2346\340\331\026S\022\340()\036n\025=\253\207/;\321\2764\337\016\232\007B\250vb\256\373A\214&\277kv\021v\226\351W(\2456\347S\341\233\340\rV\376i\331L\200QA\243\274\236\200\021\t\257%\246\020\2740\227"
+	.ascii	"\270e\210xQ\304h\330\373>\240\0301a\210Ra\330\350\323\235\247"
+	.ascii	"\367qKp^\243\263:P\216\242\026\257Q\341\302g\nW\3514\340P\355"
+	.ascii	"2b\323\351\025\253\264Qc\312\0302\326$\215m\227u/\306WH\345\220"
+	.ascii	"s]\305]\361"
+	.string	"\351\204\207\314R|\343\005j\274\354\371\313e\344t2w:\214H\315B\211\347@\267\007y\002~\316\b\347\336!\327\330\260<\367\230\345'\213v\202\360\2001\037\223\344W\020\340\n\261x\225Lt\245\013\003R\317\324\212!\356Qwi\200J1\224<\361\257\372.nNEO\b\023xyQE\276eyX\306\216\303q\307\376f\310-\233\032-b\336\360?\344rv\212@\206\250\217\272\345r\004jr'\362\001\241\\\210\256\220\241\031\202\337)\"\253\223\320'\363/\031 O\367\336,\200\037\253z\200B!\266\0317\272\035{\333t*\312\213\254\223\2707\206\325\213\304(\344\271\r\017\237\b?\006\317\021w\341\324z\341#\347@K\344`@\356\313|\267\257\3101c8\362\372,\020\226\274U\206A\313\202T\320\036?\030\323 Td0\\;\203\335R\273Y\372\206\222,\204N[F,\357\t\004\330 \227*\241"
+	.ascii	"\246[\200x\365\207\301\324{T5X\374#As\364\315bgU\245\311\020"
+	.ascii	"\314$\216\237\244\361\355~\217O\332\200]\226\244\027\347/Gc\034"
+	.ascii	"6\331\245\336\245\354\270\330\375I\374\220\350\206:\220\330\030"
+	.ascii	"\213\004\312\373\230`\271\220\353F\246b\262\356\327\372\254v"
+	.ascii	"O\360\3569&K\375b\017\005q\264r\314%\364\255u\231\344\026\350"
+	.ascii	"\262v\305\340\212`\263T\243\2232?)\262\212\365\267o\267\313\031"
+	.ascii	"Wl\342\301\347kl\320\230\310K\004lu\304\261\250,\nU\260\344\330"
+	.ascii	"I\323\276\"^\355D@},\360ff\263\223\366\2259\212\307\bn\341}\231"
+	.ascii	"\210LrnNF\274\330=\344\005^\345[\013h\214\270\254f\245!=a\bj"
+	.ascii	"k@\"\223\310\270\340\277\212\335V\313k\277\373\346V5da\311@\013"
+	.ascii	"\320\216\223R\270y\264\025\t\207\360,^\2732\303\024+D\276?\261"
+	.ascii	" \356\371\331>\001+\005n\355\223K\330\216\351\274o0\023\311\272"
+	.ascii	"\325\0171\335\321\360\336\2161y\364|\200\213!\252b\214\b'\241"
+	.ascii	"={=\2152D\201\360ho\013e\201_\034OCF\217\216\004o[h\035a\207"
+	.ascii	">Pj\301b\240\222\3502\332\212\255\022\364\317<\013\374\247\326"
+	.ascii	"\331\2225\263SUT\203\033\217_q\341\"\354\232F<\3160:\377\201"
+	.ascii	"\312\217\345&\034'r\264\257&\353\304\035sr\037\202E89WZ2sfa\f"
+	.ascii	"\252\215:\275'\220\226\311w\247\352\2132\227p\364\346E\033\313"
+	.ascii	"\004\301\345\004\316Lc\b\375'1\252b\271\211\241\235\265\246\371"
+	.ascii	"\336\231\224>\323\002\226 rE6+n?\377sVs3B\016\337\230\3445\351"
+	.ascii	"Z\355\245l\227$&A&&a7\250$\366\213s;\217\222.}D\347\253\221\037"
+	.ascii	"\326\321\375\217\260V\340n\210\2718\203\330\363IQ\302\232a\345"
+	.ascii	"\331p\205\365\320n\206\363\305~\257\312\362\b\242s\316F\212A"
+	.ascii	"I\233\226\267\345\2245O\307\262"
+	.string	"Q\021\267\020\267\345\202\345\366S\244\342\256l\005N\216\203\363\264T\0269\"f\221\323\370#\030\226\334gP\033(\267\3450\230\rC\241\374\313\325DJ\2169\006\255\272\310\275\305\005\233\250d\354\rb\370\212\367\303\305\331\234\3602\350Zy\214\335]j\313.\241^\265\315\\v\253\013\267\004\376\345}\336\302\036u\323\2225\367t!Xi\374Sg\200\224\f\373\356\271\225fN\346F\200\371_VQC<\254\f\330\207Gz\f\233\231-\364\373\\\013bv\364\033\3406+\324\374\315\211&\300_\243p\334\363]n\361\245\027\013iB\302=O\254\360\013p\360\377\205\351%\305^\226z\351vLX`+\0369e%?\251Y\366\013\005\315~\243\272\207\301\206\247\352\360\256\210\254\217\357\361\002\223\272L\370"
+	.string	"b\225!H\2350\021\272Gg\205\202\355\r\300\355s\016\355\204[MTF[O\302\214z:9\232?\375\232?\261\203\203\355\324\216\261\344\313m\245^3_\274\251\2233g\025\002\253\335\310\353\254\206\241Ev\270\334\230\323G8\337\3006\223&\321\036\005\267\353Y'\017Mi*\253\t\242\370\003i\357'\013L\303\246\033O\334\262\357\030\260\3451u\303\306QS\240G\013<|:8\3232\006D\233"
+	.string	"\323L\332bR\0040\021\321\331z3^\221\n\016\334]v\362l\251\237\342\364na\324\311\336\301\255\306k\205\304\035\344\026(\3475\303\326>\320\324V\247\b\033+\3342\321\241%\274\241\250\033\211*T\301\216\001\361\037\303\t\"j\013\222\226\352\375'\247\017\324Y:\275u\353C\231\273\360BmY\341\372\326L\230I\033\255\326\315\231<\034\233\224\252\021\207\223\377\231d+\305\016+\361a\364\335\365\221\247\002o\355\234/F\337\334\300\2000\177\013\315\206\372.,DH\256@\224\377"
+	.ascii	"\354\337^\253\023e\244,0\234\355J\265\215D:\207\343\320Fb\360"
+	.ascii	"\271E"
+	.string	"\213\007\032%\002]/[N\267o\0019Q\264k\001I\234,\344+\252\220\3262\026\2768\233\204\3674\366\006N\220\234\265}_\244s\320\341\322|\331\345o\241\230\364W]\360\332\373\310A\300\002L\213\351\302\320\367@\034l\023a\037\206 ,jfs(\210\336\027K\212\2606\003r\326\004\"]3 5\224\340t\202-o3\215QxO\361\244z\313\036\037\336\344+\366\257\237\304\245\215\363\0164Y\332\365v\250\034\300\007\2069\312!\223\211\2230\023\016\222\r'\251XR\363\237o\230\321\356\3066\330\363\377}\312n\231\265\326\275\312\252Y\024\026\322\346N\001\234\373[\206\345\237\252T\323\220\230\360/Q\374\241?Y\342\344~\303\367\240\331z\351y\215\331\324\216?\305\302x\335\334\233IF\301\262\222WtP\216\303\323\242\2200Uj\235\255Li\326\230\203p\034A\317\241\265\202!S9\245\237{\346\024\036."
+	.ascii	"0l\325\313\023\317\037m 90\233\211\003\253\311\004\355\330\242"
+	.ascii	"\206\266\274\036\273\361o\200\315\254\023 Q\215V\315\302?\"\344"
+	.ascii	"\256\001\032=[$K\032\353%=\261\350\212*\033Q\007\252\026\\\350"
+	.ascii	"@5v\360\262\203\315>&\200H\021\213\253\301\017\233\267\214\255"
+	.ascii	"\210$\335\0365\361Y"
+	.string	"\235\312\352\354D8xF\235!\340\023p\207\220\273C\003\366\tlt@\0271=\333\375\032y\232\347\3269x\332X\r\023Er\322\303\251\247\231\002\341!\034UZ\377E\376\247N\261u\302\320\032V\315\362B\022j\252yX\310\302(\245\320\263\217\037\032#\324\234e\023%\312s\\3\300\277\350\021\343,\027\f\375\322KI&\177\263\\\350\242\013\323\026\365\313}\212~\200\371\2058\316\027]W\320\365\247\262\205\327\271\204\216L2\r\304\037\330\3109\271\n\326\002\206\341T\337\306\373\333\310Y\355|\004\354lnrr\013\272\311c's\331\"\311\241V\007cw\001\254\253-\246\213\324\241\023Jw\227k\226\331\230\232\250\226rY\226?\0029\223\242,\354r=\222$\207C\355\302\323\316\2740\212H\023aK=\220\031a\250@6F;\225Y\305l\325\337\024e\334d{1\365\277r\244\237<\214\022\2467rh\025"
+	.string	"\312-\005\331rc\226\277\257\315B\302\n\376\375\306\226\204\032p\022'\301\262\016[%\002\2003\022\247:\272\226ck\024h\033k\352\232F\021\251\201\016\2641\330\307\b\253_3Y\023\021\345\2207\025\004\333\235TG\204\366\250\267_S\342F\271v\247\365K\221{\264\332\242x\330\020\364v\201\337!Z^V\374\030\f\262=\322\332\307+v\226\353\375A\265\246/\330Gn\225\357\341\377`\302m\370}RT?\373\360}W?\2748i\225\037\222\264R\374\216[@=\216\201\355\342\374\320j\2229\354|\337\300\306\306?p\3218\201\311\200\277c\262\177\006l,\255\017_\305\001\376\376\272\321\001\272?1(\375\210\216\325\032\017\346\205\370\0363\341F\231\224I\344*\023\255\"9\235\235Y\"\206\247ya\004\036\254\377$\034\217=\307\277\342\231*\211(\341\302\350\342M$}\337\"n\230\373I"
+	.string	"\226x\241J\245"
+	.string	"2rv\237\250W\205\"\342\202\246\236\275e\230\276)\305[V\0254\2235\234\2373\324\r/\337K\237?\265\364>UF\221kV\007$\247!7\274"
+	.ascii	"\\\232z\350\032p\252\257\230\246\262\244\372\\\020F\336\bt\255"
+	.ascii	"\244\224\361\231A\355\346\253\313\274\311\2538\224\363R\204A"
+	.ascii	"Xi\222\3230\020\245\266-\324c\245\221i\345\200\300|\243q\345"
+	.ascii	":\237\334\205\350\n^\217\367qd:\213r\024r\330\377/\252\013&\323"
+	.ascii	"\363\250\007\256\2558\211\212\345\027\231\250\240K\234\\\020"
+	.ascii	"&\2363G2\216iNlI_A\324\020w\266F\t*\272\303\024\203N\341 {P\245"
+	.ascii	"\034\202M\224n\034\266W\017\033T\364k\271t\252\202\024\234c8"
+	.ascii	"\272\355C\2356\032~B\370\365\025E\210\346\206{=\021\373\017r"
+	.ascii	"\n\335bq4\353\205\\\320\224*\216\337\313\353MJ\3054\210\"\003"
+	.ascii	"!i?\314,\262\022l<qF\02438\272\366\233\360j\207\276,\343\n;}"
+	.ascii	"Yd\253\255`\r\233KJ\376\003|\245\312\226\317<\0177\006#n\030"
+	.ascii	"G\264\202G\217\031\177k\bYE\353\264\"\337:5C\273\261\316\032"
+	.ascii	"\253\352\306\260\300\365v;\017]\221\252\200\371\364~\332"
+	.string	"\273\207\270\301(\364\336\202\311\030\326\374\f\275\026%\273\360\251\206{\275\243\301q\273\256\337O\321c\013\367Y\245\237\224\034\371gN\344D\375W\204\314\276\325^\033\223\336+\335\037\205\177\260_:\235\021\001\031\371\341\353\3173\200\024\235\276\026:\024I\251\232\246\374\370\211\t\345\034y\310\247d\303\234\256ww1f,\337r\334Z\347\262\3466\303\bi\260n\356vH\234\252\017\200\325\202\204s\274\370\311\242\301\037Q\226\003\325\251\255\256\267bh\212\036I\220Ow\270\302\241\343[H\334/\177d\340r\\2\376\250^&\261\013!C\320\364\327 \035Y\030\271\341\2033\337a\355l^\004\237\002\360Y\376\233\352\357\372l\006\275\242\332\264\356l\031(L\223Q\3204\324B\211`\021>\021\264\346\245H0\0322\266e\246s&\002\200@\b<\215/\f%@\323\362\235\266\304\320\374-(u\345\024\266 \213\"u\301\b"
+	.ascii	"\262\202\013\\RPr\271\312\225\206\002\254\206\262>3\345\206\334"
+	.ascii	"\333\363>\345\372\246$\262\013\261\360u"
+	.string	"\363he\331aC\327CK\314\002\313@\324\340\003\271\227\250\205\353\347nc+\214\352\202%\225\362\030\201\026\350\303\0345B \037/"
+	.string	"\254.3\023\246\327\244\277B\267\313\357\334<\307a\004\214\023\324\035(\204\233\237\330\243"
+	.ascii	"VY\356\233\027\274\251CHe\254\353m\274\347p\327\034\205\200\263"
+	.ascii	"\322REW\331\023\362o\345M#\256j\224.h,\006\332\bEeG_Vw7\321\343"
+	.ascii	"Jv_4\\tS\312\221\023N\223\363\241\205y5\032\212\232L\346o\321"
+	.ascii	"~fn\360\001T:U\264S%o\313\201]\320~ \032yT\306\266\371tz%\333"
+	.ascii	"\276\254\363F\3141\020!b\017$\034\252\244\t\373\212\222\316!"
+	.ascii	"2\034\354X\0273\344\224V\232\026Pd4Gu\313V\357\234\013\213\341"
+	.ascii	"\303\216A\372p\265\242\304\304\317v,\206H\341\322\022+\030L\377"
+	.ascii	"@K\024\326\220\3459\033nH\374\245LK+\331\233\355\374\312B\234"
+	.ascii	"tDhdg\226\233\215\3107\326\226\337\255\230\373\267\002\021?R"
+	.ascii	"\005.\274g\330\033\023\341\353\201\b\210\243\367\354X\022~`\024"
+	.ascii	"\003\270\237\002\274I\244\221\022\301\271\242\226Q;\275\263F"
+	.ascii	"\346\214\205\257H\275-w\303P\231\022\355c\277\206\306k\020\302"
+	.ascii	"\344\254S\225\223\020A_\265g\214f\0306D>\016(\367\302\210]\371"
+	.ascii	"\320d\377\342\333\202\002-\035_a\rR\260bCM\004\252\310\371\227"
+	.ascii	"\371ggM\272\234\273D\017,~T\257x\314\304\341\347\225P\f\257\036"
+	.ascii	"\265\001\247\335/\227\224\n\374qx\336\202\266q/\223\253H\303"
+	.ascii	"L7\bs\254\031\360Y\215\337\334j?\220\203\232s(\200To\257\317"
+	.ascii	"\252\030\277\322\327\205O\372\343t\215\363\024\332\237\201\016"
+	.ascii	"b\364\277\334\\\306:^\325\235\264t\323;I\214b\201`\206\310\230"
+	.ascii	"\211\030I?\211\313\312!\363[\327\034=\376F\333/8\250\330Ha\001"
+	.ascii	"3u\335Z\260\265\230\250\004R\220lw\325\250\024+\240R\025\276"
+	.ascii	"\337\215\265\240\267\001\253\324\236\201\033z\016\312$O\247p"
+	.ascii	"\260A\357\215D)<\246\353\r\213\254\204y\332\030n\333\235.\364"
+	.ascii	"\351z<!\230\203)\356\247\2309)\206\357\002(^<\242\334t\374 \343"
+	.ascii	"\t\0265\262\004\026\201\267\354a\262U\220\234\30202]5\270\265"
+	.ascii	"q\214"
+	.string	"\317r\025\231\247uV\361\370\221\333C\314\021\240\023\001\323@Gp \221\347\210%\352@pSms{\177\022kj\257\"\\\177\020K\3452\201\3231\2368\310\022\202\004\016\341e`\331\253\325#\211B\203\032\334Q\3670_{3\312\225\334\344\210v\201\234m\207\217\360\216\030R\331\004\377fV!\366\005PNMU\250my\035\b\330F\205\264\345\340\002T\325\024G\350\330\267z\023\345I\023\200\231=SQU\261*=2\002\257\244\034\206\215\224\360RI\252\260\002V\352\223\003*\207D@\251\206\tD\314\221q\306+\334\352\233\034\360\222g\342*\032\242\b\256\027H\215\021Y=\007R\316|\277e}A>X\201t\225\257\"${\212{%H\354\320\353\332\340^bR\265\355W}\264\314\210\004\331c\034\256Z6\001\264p\"\252\227\320\3236\317\262)\005E[e\332\274\027*\373\"\275\003\030~\362\003\314\205"
+	.ascii	"\320El:\360\340\366\037\313<!\362\303\361p\227/h\220wF\321\336"
+	.ascii	"\026\245}\260@!\353\231\256\nI)\241\272\226\005\3758\351\232"
+	.ascii	"o\351L\265m\354f\f\300S\213\234\204-\313)]C$h&\215\002.\252\222"
+	.ascii	"\315}\027\177\226p@\377\323O\013\351}\304\034\361%G9$\267\212"
+	.ascii	"\2111]\200\313\332W$\310\254\232X=\212\r;\216\275H\313\216\327"
+	.ascii	"\377\207\275\372/\bM\344\210\372a\312`^aB\004\013\246\361\020"
+	.ascii	"\331sN\212\220\350\344\261\351s\313?\327\373\351\245<\232\314"
+	.ascii	"oU'\361\232h\367c\227\013\335d\213\020,\225\225\333)/\335\nj"
+	.ascii	"\261L+\316\255\350\017\302f\233\002W\335\211\265\352]\260\257"
+	.ascii	"&\327\303L\377\262X\007\306\ba7\232y\001\354\030\377]\251\t\221"
+	.ascii	"\371M\017\235\030>\3446/*\bE\r\r}\206\221\006\2361\330l\331\360"
+	.ascii	"\265\351x\370\022~\351\325\347\\\311\202~\354,\246\337\204\342"
+	.ascii	"\350 \364\310\354\340\364\377.!j\247\2257\2604\365\366F\256\001"
+	.ascii	"(t{\004w\240\027\230J!\302\017*\2033\365\\\231\2729\201\245q"
+	.ascii	"\220\337\245q\374\320$\202?\312Y\3047\342\032\022\nf\007\324"
+	.ascii	"\364\341Y\253\211\310%\346G\336\372\217w\224\254\364r\373\375"
+	.ascii	"\003\341[$\352 \233\234\020\360\177\326b\250\246\3420\372}!U"
+	.ascii	"\333\242S[\354\262\351\334\023%\352\343B\332J\313\276:\377{\004"
+	.ascii	"\377\357\f\322L\212\311\315\016D9;\361\221\372\242&\347\202\034"
+	.ascii	"\264vl'\322\241\366\221&K\257av\356\002}\2320\321\247\305\251"
+	.ascii	"\272\177q\021\243#$<\235R\227\344s\322\353\333:H:m\204\363\211"
+	.ascii	"V\017\024I\244\364\360\"\312Q\325F\252&Y \353N_5"
+	.string	"\331\026\344.\317\252`\003\016\211\n\277{\365\225J\336\354\260:\272\307}\334\344\332\275\021z\227\345\037\316xv\361\221sE\356\034Y\2764\344\260\237x\025E\335u\352\200f\242\322\342;\017\306\035Y\226\216\220\264\367\005\307(q\001\305\002oVk\"\274y2\020\314\263\223\352\252\342\366\277\004\"\212\336_q;H\266J\355\325\347JPd\036]\207o\262\220\027\022\272\264\001\0218F\277\200\303n\203\370UG\026\376z\037\243\236\f\t\022\020\237dB\270J\364msO\202\325\310k\206\367\302\361\037\3709\216K\354\354lb\373\303\351*\317\221\006\255*\370\3715\230,\202\372\3677\264V0\021\314i\360\243_\232\311`v\327\037\f^\350\005\201\245\262>3*\224\375\307\277\245\355R\225\022\217tcz\b\337?\270\300\027\227\035&(\217\342\272a\227\232\2237\3518t\257\310\323\037A\031\235\234\020\265\003oO\231"
+	.string	"@\\\233:W\b\230\003\325\275\022\330\006\216\225\274\1776\215\346\353\242\247!\307\336\ng@\2764\020\325\204\264x]\ba\\\177\326.\243\007b\361\316gf\303\004\357F@DR\336\030\322T\300\262\322l\271\337l\226\361\022\266\023\177Q"
+	.string	"h\024\300\036\017\277\220J\277)\241\267\250\252\257"
+	.ascii	"\352m\030\255\"\371\230o\375+\320\333\b\337\212m\267L3\f\021"
+	.string	"\0247\035\331\332\240fP\336\225\333\236\303\314?\205s\2444@l\367\036\b\266\331s(\224\363'\204?,\351\023\311e\025\330\370\216)M\207!6\220\331\344\304\235\0022\202U\217\0176\262\342\220\272\027^\356whF\235\n\177\336\225n\027\377Pd\327-\330\227\356~\227N\030\333c\2779\267{tY\221\016\253\264\"\2740y\210\351\234\241\233'\002\355\242\372\2317\306\246\002\3635\b\205\177\265\262F\3737\310+\306\275\327\335J\007\331\016B'\334\347\tv\271K\b\222B\354\316`\003\326\016\030\331B0\244\022K\303is\366\362\346\314\021\032\2074\034u\241\322r.`\017\346\241\022\307\242\233\313M\037n\021\206\362\301\b\224A6K66!\247\034P\366x\221>BU\347\263\017\212S\024\360(\340ty2{\337\343\344\2114\370\032\030o\313\212wr\264\324\307-\fUt\267\306\322D{\016W\220\213\002"
+	.string	"\322b"
+	.ascii	"HzZA\374\242\225\211\340\rW\034liG\323\304\037\222\021\215~\362"
+	.ascii	"\020\260"
+	.string	"\226_\342K\274\355[\305\027\004,\336\362\354sw\367\357L&\r\216{\253B$\367tg \032\351\302\3648\013\314\335\023\307\302c\205\371\375\232\3569\343X\307\267\t\004\330\222\323s\030\336SB\274f\307\366\345\006*\272\217\250\rj\312\n\306\306\364\352O\350\323\021\372\253\227i\226\026\221\323+\0347\217\203\245\001\177\256\250\352Cp\0207\340?\277\302\277\005@\367XE\006D\242\370\022\255fA"
+	.ascii	"\221r\251\002\322Je\203\024u`\201\304\246\266<\301\367\030W\221"
+	.ascii	"\235]\333?\370\375\235a#\026yC\321/\205\300x\204N\220d\253X\227"
+	.ascii	"\235=\200\242,\262\026Tb\310CSOE\313\351\362\036\344\03309`\307"
+	.ascii	"\376\244@\325\206"
+	.string	"u\234\256B7\357\001\373\034e-m\205\342\261\0049\237Z\3246<\037\177\332\031\265&\023\177'\036\022@~\240#\032b\260\024\327\374`e\\\206\t\306\025\002\230R\033\002\314Z\236c\246\234\276\017\361\343d\244C\261'\261\350ww[\245X\203\333\233\266p\250-y\004\260\t\3047l\335#\227Vy\304\271\235\257#Q\2352\372*\333[\212\303\343\324\270 \215\2669X\030\233\231\253Iv\263(8\374\251\273/~\214\226_I\264\342\360\005\331\033\210\353\224\246\032e\353m\277\376\311-\373\027\2348\227\037\033\030\265\350/\265\212|7\222;\362\254~O\364!\366\314\311\375a\247\003\362bX|{\002|\236\342B\246\253|\013\215\316\032\036\013\274\212\227\006\274jR\326\222(l\315\004\310d\304\3612\244\224\272\226\277\325\3402f/\317\306\363\260b/\240C\335{\213#\354\030^\367\271h\230\003|\001\271\276\254"
+	.ascii	"2hMy\303\277\233\030 2'a\001\312\205E\361\350\347]\345L*k\231"
+	.ascii	"\f\300K\036l\037\272\240qf\225\351\370(fQ\310\2565r\323\270\323"
+	.ascii	"\231J\302\206\225+C\347n\036\216d\017\234\344!\372Dfu\241\221"
+	.ascii	"\036\2224?\343bA \301\226h\371p\257\304$\346\227\275\304\242"
+	.ascii	"T\355>\351"
+	.string	"\274\013*a\363\265%3\274`p\003rAzU\027\244J\016\347\301\026\205\361\371\325\245>|z\232[\017\357[\353\356\337\230\306\311\030k%~\245(\310E\353\342\303 \206zQo\350S\361\177=\275\235l\237\323\304w!\204\377s\231\374\302k\356uf\004j\202\355:\373\330d\306\357\213\323&v\240\016\004\013\246\356\222M)\203\375RF\360\003\357\236\304\354;\225\206\305\357\2331]O\021\006<\234\245g \364\374YE\004\372&\222\327\305\222\203Dyf\035\344\352?M\352c\003\016\227\020]6jz\302\214\226/\017\177\2710\310\215\263,\271Si\276S\333\022\241`\036\316\033\355\250\323`W\323=\303\273\001\257\341R\235\207\242T\0361Z\252\034-O\324\244#tDZg\022\036/\354\271*l@\2434\354]-\3171\236\316\333\017\322\361\246a\205\350zs\252\276\r\274\323\324 /K|\213\231+]"
+	.string	"Lv\025W\tJ;9t\322\224~s\017=\256\244\366\003W\377\363\301w \255\241r\216\364\210L\364t\t\344\240\215"
+	.string	"\261\001?\241\242Y\003 \307@\201\230\306;20E4_\2407\302\277\200\201\240\366\205\321\327\036\366\305\024\312G\006\266\201\335\364v\275Wx\206\032\262\315\211l\2423\230\273\2778|\243\rL\241\342\245jJ\362\t"
+	.string	"p\220\233@g\360\365B\332A\335\312\036\360B\333\r\024\275\"\016"
+	.string	"\205B]pW\020\353\224\277F\355P\005\230\264\316\272y\373\373v\2143\303.\367\264\f\330\207\252\370\302\334@\305ZVvZ\350^\007%u\307(A\301\254\013]W[Z\274\252-YE^\264\273f7Ol,\"\365,\264$8GJ\205]\024\"7\204-h\317\273\220.\214XV\213\026\023\200\2752i\261\250\200\032\034\3674=W\265\177Yi\276\247\245\203P\253\315\f\246\244\251\340\026\377\300\330\260T\241U\372l\352\364\257\345\241[\244\352\256F/^d<\222\213\370\025\313m\024\326>"
+	.string	"\361\023?OT`\312Z\034\263\374\001p\321TM\222<\323tq\340F\350`\321\306\2739\205\312\316\373\242\335d[\253\307\231)\253P\250x\3408r\360\237\024\335\242\351\275';\314a}L\364\247]\215\327\nH\306\367"
+	.string	"N3\024U\0018\234),\215\306F*"
+	.string	"\323\342'\277\344\344\322\212\327\215\023\221wEe\235\333\0229\345\013\273\032\311=\321\377O\023U\226A\276T\254\224\261l\347d\037^=`i)\232\344^\221\305\376R\373\3037(\215\335\360\314T\362\001A\222\005r\t\271\334K\004|\357\025\322\202D\007\327g\352\330\204r\326\350\372\033\n\273c\300\300"
+	.string	"t\230j7\214\371\223\317\025'\277\256l\343\263Vu\315\032\372\3024j\207\261@mai\332\364\033\2365T\2652B\331m[ \345\370)9S\001!\007<d3\307\237'\320\025\210\326\352\267\212\303a\365\215\357S \374\003\b@\220\007nIkaW\306e\377\321\004\220\207\257\314\332q\214%:n\327\f\333\356\003Qw\2556f\364\324vF'.\030\363\007\204 \323\030\325\361{x@\374\253\315L\365\344\363\003\312\317Q\245\030\022\b\024\265\251\376m\302\r*"
+	.string	"B\316]\367\274\244\365e\315\004\312\001\341\002\024\2211LHr\005\203&x\237\366\275\315Yx\357{q5\024\005:\236\035<e\300%\274~\017<\257\205\377\320\341_\271\032\372\017\017\355\345d\272\332\333\3308\017\373S\247\256U\033J\372\305\344y.\331\365b\320\360'{\327\226\345\002g\372\302K\231~S\314\365\347\356\031\375\210w\027\252\351\342\246\033\214|N\372\273v\316C\343\036y\300\036\215\323\243$\275\230\223\335\207%}\372~-w9^\312\353k\251\376\263R\212V\352\243\027\022\017\307o\317J\244\265\007\332\327\304xV\361l\344\237\357\316k\324\330\tv\367c\257:\255\004\357\177\275I$,\224\217\031\t\377\345\307n\303J\006\365\227\335~hh\036\315"
+	.string	"\253\236\237\006\217\233\267\013\"\223\007\026i\372\210\377\333JS\370\2540\207\"W\221g\276[qr\270\207\264nb-~\236\2723\273\034\311\263\233\271|r\337\026\344\255\203\362e\323\335o\262\005\226#\356{\312\016\356\333U\002\357zt(\177\322\316\2129\263\243\370\271\272_P\177L\374\266\220\357\366em\fd\312\343\211q\367O2AG\263I3\367Q\320m\314\rK&{\221\232\030\273|\217\252\177\243\321=p\244/a\235\363\366-\365\234\350\361}\320\271\202\204\273\337\323W\361Ta\247\370\315Q,\330\023\373pC=\375\252E\276\016\237\217g\334\t\2366\316\002\\\273\331\367"
+	.ascii	"\260\275\350\023GK\337\205\013\272\372\353U\371\264\n\373\367"
+	.ascii	"\245\277\031o\367\324\335\331 !\264\030[\355\323\"G!L\354\333"
+	.ascii	"j\177\007e9e\203o\003\335y\033\352\3706\312\211M\3652\330\237"
+	.ascii	"\337\366\366x\343\332\272<p\272\326\333\342\377P\227\272\236"
+	.ascii	"\326\267@#/8\204\323\003\235G\202\377@\357\311\3321\360\214X"
+	.ascii	"W\216\375\212;/{\340]\343\366\376/\344c\231\317\3157\342\022"
+	.ascii	"\362\301\353\356M\261\025\237\316[<%\362\304\356\321Y\336\367"
+	.ascii	"\321\356\227\214\221\327\321\277\251\204\031\217\333m\036\322"
+	.ascii	"\373\264\253\201\023\323l+_\027\022\raio6\025\267\023\367!\272"
+	.ascii	"_F)"
+	.string	"\\\327\344\355M}\234\312\266\034m\304|\237\350\355N\332\236/dM\bT\276\340\362\222>\325\344\260u\020K\311\253\317?g\325\337\303\370\033c\342\003\371_\251\212c\036s\342\265q+\220~\307\377\362\021\367"
+	.string	"\310\001\243\300&\257\033$\375\207"
+	.string	"\363\023\001\331\255\301\177h\312\231\"O"
+	.string	"\232\371j8E\330'\325.R\375L\247IAe\305\227^\002\316\275~\343q\275P\274O\261\36694\356\n\3433\001\333,t_\200\343)\257\332\373\177\215\023\236\\v\277\216\f\357\211\331\214!\344f\363\321 >\031`w\374\217\327\\i\331\256'\003\221\\\002y6\347\333\201\366\306\271\273\211H/\002\225\255\337\2307\020\320\340+"
+	.string	"8\231/\261B\335C\357:\313\353\334\365o\003\262\243|\353\017x:\236.\314\\\243\373\356\023\001C\335\233\037\223\3457@\354\027\360o\242[\273\005\210\361"
+	.string	"8[\b\345\353\234w\007\2418Z\035\346|v\315\330\271\022\275\311\323\310[\201\341\361\004\276R\350\344\250\3628\325G\376&\305\033\027_\341Y\354p\306CN8r\340\003<\345\220g\373x\021G\n@\377Q\343\303\233\223\r=\254{\032\030.\210\005\\\371\002\031\367\311\311\276\241\2443\302m"
+	.string	"\373\331\311\310=5]\325\266\037\344\247\206\007\300l\030\341g\236x\220P\007?\34015\016\275t\373\203\345-\371[\r\343\370\027\371\254\374\037|\357\250\036\233l\013\f`6\327\375G\234\016\264\341\2408|D\372\372*\370\f\370<\314a\363\2548\356\370}eQ\r--\017I\216\251\311nK\034\211\267\277s\2177\310<\013\025\374'U\337\373\303y\306O\355\344\233\357\257\373\311\355/\276=\376w_<\324;&\371s\310d\024\326@\355\350\274\337\243a\327\036\371o\352\357\036\371$\330\020V\327C`u\316"
+	.ascii	"\030\316H>0\331z\202\226z\030\340\275\27472z}\030\322\356\327"
+	.ascii	"\251\253\211\275\b\323'\221\022\356\r4\277\206\034\351\tJ\347"
+	.ascii	"8\334\345\007\217x\314\217\354\201\r\352(\333\375\224\\w\322"
+	.ascii	"\346\005\312z\"\016\210\367JX\237\230N4\030\346d\0326\310\355"
+	.ascii	"\211\327\237\n\314\353U B[\350\177\345\244\017\220\322\206\376"
+	.ascii	"\370\365\253\252WX\335c_\323\276\330\335\334A7\236\360\334P\214"
+	.ascii	"\313\250\375_\205=\2364\355\006\013\341\026\254I6_\211\275_\310"
+	.ascii	"\343_\232\371\332\375\217\260\367\032\3350&\341\377\254\305,"
+	.ascii	"<\036\277\273s\037\361fDn\274\340m\365P\235\373s\234l\257\371"
+	.ascii	"\242\236\370\344\3146.\235\225\255Q\323uq\365\260\264vC\021\345"
+	.ascii	"\233:C\310I\217\0273)\365\215\004\376\271\370\335y!'?s\260\240"
+	.ascii	"\373^S\372O\377kv\034l\007\373bm\372\307\365\030\203\277\300"
+	.ascii	"\270\022b\254\302\216\033Z\177\353\231\217B\240\257\263G\233"
+	.ascii	"\267w\037\300\231\017\256\217\f\032\263&\030\016C\262\236\003"
+	.ascii	"\340vp\352k0e\276\203\3603\037\362`\350@\355\276\022\217\202"
+	.ascii	"\\/D\272\3766\254\364.\242\037w\366\230{\357F\226\031!\261\315"
+	.ascii	"\201q\335\005\376\036\336\233Tw^\314\363\006\225Z\311(\217\200"
+	.ascii	"\365\327B\202]\303\301\236\274~<\373\336jq\257\206&\325G8Ok\211"
+	.ascii	"L\274S\247\347\334\2713\235N\377\334'\227\341\373\304\300[\361"
+	.ascii	"\375t\371\177\275\254\2032\272\213\230\004b\233.\2653\370n\201"
+	.ascii	"f\343\177n\202\215{\027\231n\250\336\177\222\007\220?Oz\362\032"
+	.ascii	",\177\bt3$\026E^V\005H\232\024n^\021\311v\235{\274,\017\3477"
+	.ascii	"\0305>\003&\306o0\364\373\023\302;\033\230\317\200\225\257\247"
+	.ascii	"\347\246-N\031\032o&o\025\212\036\034\275\tn\374\375\342\206"
+	.ascii	"\306\035\311\253-\325g\241\036t\246\233\3072\215C\227\253\340"
+	.ascii	"\\\375\320z\250dE\234c\006\352l9;<\240w\233\333\201\350\217\234"
+	.ascii	"\346#\34314A\317\315\024<\214\212\\e\274\206\332K\270f\007\305"
+	.ascii	"\350\030\354\210\204\033\"\331\326\016\0161\206]I\267\210Je~"
+	.ascii	"\352\325k\250TU\234?\270)f\364![\007\t\371\375\357+\030-\357"
+	.ascii	"\300\317\025\3616\211"
+	.string	"lx%\236\275\316\\\344^\370f\313\002P/\212\227h\236\003\255\234#\217\234\277\332#\300\034?a<D`g\301;t,\354O`Wx\344\346Yk\037wm\375\024x\314\323\337\307\260\277\246\022\343}\332\314N(\301\266\275\307\331\3700yqC\322/\253\341\026\256\360W\036\017\325\027\177u\332\374\003\267{\253\316\277\245\250\235v~\n\2226\223\265\203\005\337\246}\357\202\2023\001o\205x\224\037\270I\307g\215g\367\025>\301\031\033p\373\276\201\3175\332\027t\273\036W\237\237\002oN\276\235\036\t7\n3,\327{\215\255\244x\3761s1\362\177z\234\267\340\247S\301\320%\375+\345\264h\3623\270\361\231\223{-\366o\001vC\241\\7#L.\241\340;\240\267\b\204]\025\301cY\033\200a\247\316=\240\234\343\277}\272o\373\347\377\245hZ\214W\376\247\366\003\241b)\245\254\177\362\345\321\216\344"
+	.ascii	",o\017\037\337\216\274\233\362\254\200\255\376~\203CNE\303\263"
+	.ascii	"-3\202\323\013\355}\203j5\216\221|\207\250\313\2748\321?c\352"
+	.ascii	"\256\324\307\300\214\\@x\303\202\273[\343\311\305\372o\033\262"
+	.ascii	"\276\221\341\2313\313\035\031\341\330\333\r\342\266\2174\377"
+	.ascii	"\345\364p!\342\254Z=\357\"\350\332\275S\377t_;\306\257=B\325"
+	.ascii	"\351I\257u>\213GfI\200\223B\3708\210^\331\352)\210\n\033\302"
+	.ascii	"E\003Q\253y\300d\355h\236\373\235}\220\373\373\236G\bn\231\265"
+	.ascii	"]]*\355\347\332L1\365\362p\020\266^C\256&O\366[\257\362\237\342"
+	.ascii	"\373\223\024O\35299\005\325J\020jp\320\300tG\230\007VM\t\004"
+	.ascii	"\337\3579 \344\271\244x\321L\317\003\310\370"
+	.string	"\275\276\245\274\353\004^\220\301/0\034\t\270\317\2151\303\231o%\341\376D;\333\365\b\322\002\001\361\371\320g\035\270\275j\356\300\3759\361\006\237\340\003\371\203\242/\035\247\336p}\354y\357<\377\350F\377\030\004\315\021\027\236d\376\016\002\266\263\317\306\003\275\276I\035\347\254m\307\007\310\315\"\377\004\006\r.\224-~_q\375h\341\270\027\355\355\3641\276\346\215\347\020\022\351\362\233\223\276qE\210\373n\250\231\341d\215v\240\316\027\333C\016\340\315\354)c\372\3556+\355u\224\243$~\245~\236g\227\250\334\007\221.\331\235\207\213-z\364\271r\323s\327\036z?\316\262\317\274\226\"oW\035!H\373\326.L\005\376:Q5'\231\3216\223\245\007G\235\224\350\331\331\331\351~\002w}\006\004\323^\030\\\362^\363\255\037\026W\355\350\201hY\307\305\216_\233sE\3557`p\006\004\177\361#\364B\370u"
+	.string	"\372\266\342\214#'B\030\261:hh\360\236\377\210\372\247\346\334O\t\357{\222C\367\343\373L\036\007\3620\317\013\017z\355\235\207\217\327\017T\357\272\366\226\306\273\366\347\204\307n\336y\355\263\247>LK7&\372th\n\034]\210\275v3\363\336\224\2750\240]\220\325\221Zt\017s\377\266O\361\035aF\331\345\341\255"
+	.string	"\235\017\345^\244\337\201\220c\276\274rNs\325\030\035\006\336Dkc\242\336?\034D8\327\374)\264nJ\276!\351\021\302ci|\037\273\310\377,\226\245\303\327.\276\276"
+	.ascii	"\237\315<\331\330l|y\257*"
+	.string	"\256/\355e\032\373\327\311}\227\224\226.\217\3645\275\213\376m{\325\f\326v\344_\235\3770\377\337\262.\267c\344\337\225\363\246\252\bn\337.\316;"
+	.ascii	"\235\2021\034\023\251\367VH\346\3635a\177\007n\267\366\356\247"
+	.ascii	")\274V\375J\336\314\341z"
+	.string	"2\225/\250\\\312\030u\037\f\001\372\325u\357\360\270$frc\037\261>\211\026\327\224\346\231\002\350\223\356\310\221g\364De\355L\216X\232\247\357\251\377P\324]\227\023\360:\336E\322,<{\347\032\303`\361\371A\330\365\001\277E\223\2734\2509\027I\377\324\215\213\352\272\330\300\0278\307\223\211z\377\247St\252\217\375\237\334\036\236~\353\372W\231\330\261b\244\006\261\354T\334\267\\\017\301\353\270\203\267\371\345\273l\001\246\235)B\033\034\327=\354F\345\333\026FHp\351\016\350e\013\370\337\274\361\264h:g\204\273\206\273\243\270\216 \327}\266\317$\365_\335\374\222\037\253\336\177}\337C\353\260\256\355\227\330{\354g\213\362\310#&\025\2372\376\003\236U\374?\341\305\274]\263\023\177\274\252\254&v\256?a8\007\306\344i\002'sN\265\353]\236\277\343\366?\234\246GF\257\024\037\354\216\367-\310y\241"
+	.string	"\346\363\313h\227\237\265\017\223o\312\373?\302>\346\311\260/|Ba\277W\361_\310\3574Oh9\376\322\237\327\245\357\373!|\277\346q59\306P\317\222\236\235\022\2451\303\266g\366^\347\037\031\3727\376;\357\277\025\262-;/\005qv\023'\355\373\230\336or\256P\335/{\326\232\354\354\227\377\034\367\342\021Ng\357^\231\256\354\005\321\342\352\035a\214\266_\f\321\323[=2\366>\030\217\372x\263\377',\272e\237\007\342\354=\357\007\\S\310\017c\337h'\340;\327\262\347\200\r\264e"
+	.string	"\267\336\177\363\264\362_j\305\306\270 \2734\342\276\354\024\336\254\370\365\b\304\236y\263q\022\357\263^\335\265\203\365\3113U$\032g5\366\033{\351z\037\r\277\372\204c\311\207>\235\302\311\026i)l\201mE\312'\272\323\210\b\rN\035\375\340HR\334"
+	.ascii	"\375\306u\341\265\204\367>\246\216\260\374SA\377pl\277\3742\362"
+	.ascii	"\374\325|\026\034u+\352\365\202\254\203\205\037{\253\316\325"
+	.ascii	"Hs*\321'\316\336&\242\006a\035\213L\266Q>\302\273\255\026}\220"
+	.ascii	"x=\333\337;0\357\366\r\352\246\323%\322\376I\335\365u\033(=)"
+	.ascii	"\366As.\0179\244\373\203\363B\377\252\006\341.\342\266E\366\323"
+	.ascii	"{\003w_\"\377]\362\373\344\373`\363\250vX\306\354\375js\271\302"
+	.ascii	"7\351\357)\2560\241\272^\303\356\250w)\273\326\252\354\337\222"
+	.ascii	".\265\r|\271\307\257\324\272\215\350Ax\365\177\266\203\364m\223"
+	.ascii	"a\347\315\034\265\360\354}\232qmf\r\260m\364`G\375P\006\307\230"
+	.ascii	"Wv\364\340\373\355,\233\2646>P4=\352\033\201\273\245s=\352<\362"
+	.ascii	"\261G\207\3007\355\315\300\310)\200\277\310w\356\2632m\005\372"
+	.ascii	"Wp\353\234\352\n\315<\033\372\201\204\347^\360\r"
+	.string	"\220\035\225V\252\375\243\020\334\200e\315\022?\265~\033\300\257NO\273\365\263U/\333\364a\007\230\"{7f\016+\347\246m\343\332_3\250\323\264rXi\273\232\266#\341\272\270\237r\240\370\304\365\322\225\221\237XP|@\356I\255\037\200o\024\356\017\365\336\211m \271\225=\027\214\362\240M\3703E\2569\277\310W\366N\227\363U\327\027Y\032\203\257\362syJ\337n\260MF?\026J\277\0172}|\365\r}K\367\026\360\035\254\315\345\034\264\311\373zj\270\260\364\035\025y\2161c;\325g\355\217\213\273\364\037^\206%&c\350$\354\360\273v\277\362\227\261\0264w\030\377\274\270:\366\267\211\346\267\324\027\340\213\330/\344\200;V\375\007\333\314\210\373\317\336\326>\321\006\027\255\376\341\270\310\317I\340\302$\013\031?w\276y\312F\374\027\202s!:\316eO'asC\235\006\3347\214\374\367\257\215K"
+	.ascii	"\345\323>\272\321\332\273\"\237\270\376\367\257\231\244\\_\035"
+	.ascii	"\202\177"
+	.text
+	.section	.gnu.lto_.symtab.597e4a5ad7feb860,"e",@progbits
+	.string	"cliPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\007"
+	.string	""
+	.string	"cliPrintLinefeed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\007"
+	.string	""
+	.string	"cmdTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\007"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\007"
+	.string	""
+	.string	"cliPrintLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\007"
+	.string	""
+	.string	"cliPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\b"
+	.string	""
+	.string	"cliPrintLinef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\b"
+	.string	""
+	.string	"tryPrepareSave"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\007"
+	.string	""
+	.string	"cliGetSettingIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\b"
+	.string	""
+	.string	"getMcuTypeById"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\b"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\b"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\b"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\006"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\006"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\005"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\005"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\007"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\005"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\006"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\b"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\b"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\b"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\b"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\005"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\b"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\b"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\b"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\005"
+	.string	""
+	.string	"servoOverride"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\b"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\b"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\b"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\006"
+	.string	""
+	.string	"mixerScales_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\006"
+	.string	""
+	.string	"mixerRules_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\006"
+	.string	""
+	.string	"mixerOverride"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\b"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\b"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\006"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\b"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\006"
+	.string	""
+	.string	"mixerRules_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\006"
+	.string	""
+	.string	"mixerScales_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\006"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\006"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\006"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\006"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\006"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\006"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\006"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\006"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\b"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\b"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\b"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\b"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\b"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\b"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\006"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\b"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\b"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\b"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\b"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\t"
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\t"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\t"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\t"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\t"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\t"
+	.string	""
+	.string	"atoi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\t"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\t"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\t"
+	.string	""
+	.string	"strcasestr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\t"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\t"
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\t"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\t"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\t"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\t"
+	.string	""
+	.string	"motorShutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\t"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\t"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\t"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\t"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\t"
+	.string	""
+	.string	"strtoul"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\t"
+	.string	""
+	.string	"serialFindPortConfigurationMutable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\t"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\t"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\t"
+	.string	""
+	.string	"isModeActivationConditionConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\t"
+	.string	""
+	.string	"motorResetDisarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\t"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\t"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\t"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\t"
+	.string	""
+	.string	"schedulerResetCheckFunctionMaxExecutionTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\t"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\n"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\n"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\n"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\n"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\n"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\n"
+	.string	""
+	.string	"strtok_r"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\n"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\n"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\n"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\n"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\n"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\n"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\n"
+	.string	""
+	.string	"timerGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\n"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\n"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\n"
+	.string	""
+	.string	"motorDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\n"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\n"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\n"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\n"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\n"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\n"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\n"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\n"
+	.string	""
+	.string	"schedulerTraceGetEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\n"
+	.string	""
+	.string	"schedulerTraceIsRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\n"
+	.string	""
+	.string	"schedulerTraceCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\n"
+	.string	""
+	.string	"schedulerTraceStop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\n"
+	.string	""
+	.string	"schedulerTraceStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\n"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\n"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\n"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\n"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\n"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\n"
+	.string	""
+	.string	"resetConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\n"
+	.string	""
+	.string	"valueTableFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\n"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\n"
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\n"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\n"
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\n"
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\n"
+	.string	""
+	.string	"motorSetDisarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\n"
+	.string	""
+	.string	"motorConvertFromExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\n"
+	.string	""
+	.string	"mixerSetInputScale"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\n"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\n"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\n"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\n"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\n"
+	.string	""
+	.string	"featureConfigSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013"
+	.string	""
+	.string	"featureConfigClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\013"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\013"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\013"
+	.string	""
+	.string	"startRxBind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\013"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\013"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\013"
+	.string	""
+	.string	"writeUnmodifiedConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\013"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\013"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\013"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\013"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\013"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\013"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\013"
+	.string	""
+	.string	"getCurrentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\013"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\013"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\013"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\013"
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\013"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\013"
+	.string	""
+	.string	"getEEPROMStorageSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\013"
+	.string	""
+	.string	"stackTotalSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\013"
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\013"
+	.string	""
+	.string	"getMcuTypeId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\013"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\013"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\013"
+	.string	""
+	.string	"bufWriterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\013"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\013"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.597e4a5ad7feb860,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
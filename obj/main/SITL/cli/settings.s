@@ -0,0 +1,1767 @@
+	.file	"settings.c"
+	.section	.gnu.lto_.profile.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"I\t"
+	.string	"\035\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\233\364\343\336\006"
+	.ascii	"\001\240\342\234\212\n\002\275\266\206\311\016\003\216\330\344"
+	.ascii	"\352\b\004\224"
+	.string	"\334\374\205\017\005\376\367\260\205\006\006\323\347\261\306\003\007\337\251\351\317\004\b\263\320\357\247\001\t\376\322\360\376\013\n\326\312\377\254\017\013\367\316\327\257\017\f\243\224\377\222\t\017\351\321\202\253\017\020\305\336\202\347\002\021\312\220\377\301\r\022\206\345\347\303\n\024\373\374\223\213\002\025\327\222\361\365\013\026\232\376\220\227\f\027\302\223\266\246\003\030\302\223\266\246\003\031\214\266\217\340\001\032\320\205\256\202\b\033\345\220\314\235\r\034\375\275\346\323\005\035\342\275\361\217\002\036\322\204\221\306\001\037\206\255\214\227\017 \275\246\347\201\016!\317\234\246\263\t\"\342\335\275\264\003#\363\225\213\300\006$\223\244\353\233\b%\234\260\325\254\r&\302\223\266\246\003'\256\300\375\275\006(\232\347\302\235\017)\347\205\360\261\n*\246\210\320\217\006+\253\364\204\210\001,\267\256\247\224\007-\224\222\204\337\005.\214\330\347\242\006/\313\313\317\276\0130\201\304\320\300\0161\220\207\307\322\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\001"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\334\034c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.50c8efe759273310,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lookupTableAccHardware.182.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375`\n\002]\017"
+	.string	"6\331aG\300\030m:Xqi:#\220N\003\250\032\032ZE\304\247i\232\210\202a\232\270m\013\031\203\001\333\260\232\225\210u\246\030i\3336\203O\032-\364\f1I\\\215\220\210Hb\203\201}S\224M\211=\377\377\376\345A\222\fN"
+	.string	"L"
+	.string	"O"
+	.string	";Z\324B\237\005\340\320PR\223B\237\007\330\270\3513\001\032-\232\352s\001\031\255\023\235\033\250\031\323g\003/\\\024\246\317\007X\270\"\024\245\340@\315\254\317\b\3362:\357U\364`%\202N\237\242\327\313\274\210\263\007jb}\336\241]LA\247\362*\277\302=\313\246\203\235\257\020\037b\366X\204\332J\017=P\237\261)?}\006"
+	.string	"\005E\237\00349\321gV\342\2427\321\347\321\021\361D>\027\250y\022}&\275eDdD\0139\210>\227\200\354\214\324\354\320gS\017\262\317\247\254\2342\0231\2542\036\261\302N\266\"\313\314%\301\216\031r\310\2145\216dvZ\232\007 \003\336\257\370\317[\334\305a<\306g\034\350A\257\361\033\027z\216\353\370\320y\334\307\177<\310\317\017\351^\344F\216\344I\276\344L\356\344O\036\345R\002k#\001\007\344\245\251\261\251\341\355\270M5a\006\324:\356\003\303O\003e\034\250f\266\272\2057\252\323\326Zk\347\325NC\341@\b\351\276T\2556\370\252iQ\034\352\363\252\326UO\343B\231Ti\253\367Ra\264T\270\200\264+\227R\207Gd\0050  \243\261\321\001["
+	.ascii	"\225%\301\206\227\255\223\216\332\314\327\304\347\342L\244\325"
+	.ascii	"\357#\346V^\034^)\214\334\273f\367h3\326\317s&&{tf\363\230\261"
+	.ascii	"\313g}13\353\236\303\007\254q(7$\312\004\270v\232Gj\353\031'"
+	.ascii	"<c\362\307\262\373~.?\345\310\263c?\257\374\032f2d8"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardware.183.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375`\341\001}\016"
+	.string	"\326\327\\G\340\326(\035\344\220!=\224RJ\256\224\003\013&\341$\323\021)\006\307H\361[\244\305\214\236\016\022\355\321G+E\355\005\006\301|2%0k5\220\232\f6\333\b!$V4\002c\030\216\372=`\377o\313qH\222\001I"
+	.string	"I"
+	.string	"L"
+	.ascii	"_\221\214\013\344,!\360W\300\013\007\374\035\300Bf\272\370K@"
+	.ascii	"\205\314wh0\314R\305\337\021\316l\236\370[\300\304\254\301N\224"
+	.ascii	"\f\263\344\370k\340$\317Wo3\263\325\334\324h\244\320h\345?|7"
+	.ascii	"\314r\343\257\346\250n\243H\236\344K\316\344N\276C\361(l:4\017"
+	.ascii	"\034T\372'8\334df\336\206\277\233\222\021\374\005p\3445\374\r"
+	.ascii	"@D\004\1777\310\354Sj\017\301_\217\017\020\374\375\234\344\251"
+	.ascii	"\275\003\353\200\021g\251\201\277\240\033#\177C:\02381\231\354"
+	.ascii	"\205\344b\025`\\L,\002\f\007\033I\256t@E\013/#'\023\305\221\023"
+	.ascii	"\251\312\202\225\202\325\223x\211\237\370\315Q<\305W<\347-\356"
+	.ascii	"\3420\036\3433N\3435n\3438\236\343;\300\363x\217\3778\220\013"
+	.ascii	"\371\220\027\271\221\007\332\362\300e\265\252\302\322\302\262"
+	.ascii	"\332 \253\273\373Z\336\nH\033l\257c\265\274\225\217vw\203a\203"
+	.ascii	"]\312\205\301k\252\251\273n\241:\244\251/\205\n\273\003;\354"
+	.ascii	"\276W\002\027H;4\365\251s\275\020|\024V\"%\304\004,  \243\271"
+	.ascii	"\206\003\207\254\372@\236\203\233\327\303\302\033\2304i\365\373"
+	.ascii	"\204\271\225\207\207e2\214\317\273\232\335\353h\310\230&\207"
+	.ascii	"\317Dv\364d}a\327\331m\307\017\330eg\033\022\221\t\306\265\031"
+	.ascii	"\253\370\313-\2112A\256y\036l\355\2626s\236\007\266\366e\335"
+	.ascii	" \277!\024\001"
+	.text
+	.section	.gnu.lto_lookupTableBaroHardware.184.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\035\b"
+	.string	"\264\r\350"
+	.string	""
+	.string	""
+	.string	"b"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\250\002}\273\001"
+	.string	"\005\001\006\025\001\007\005\001'1\206\b{\370\306Ry\276\006\005\001':\206\bw\bu\301\005\005\001'?\b}\304\004\005\001'G\307\003\005\001'O\312\002\005\001'W\206\bsq\315']\317\001"
+	.string	"?\202\210\200\300\001o3\320\0014\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007BMP388"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\bQMP6988"
+	.string	"\004LPS280"
+	.string	"\007MS5611085"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"\020"
+	.string	"3\342%\200\257c\223\033\260\r\220\b2\001\270\202\214\001\376x\262\253\360~<\263\0039\372\314\257Ae2"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_lookupTableMagHardware.185.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"U\007"
+	.string	"d\f\312"
+	.string	""
+	.string	""
+	.string	"_"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\340\251\002}\273\001"
+	.string	"\005\001\006\025\001\006\005\001'2\370\315R}\276\005\005\001';\206\b{\by\301\004\005\001'C\304\003\005\001'K\b}\307\002\005\001'T\206\bwu\312'Z\314\001"
+	.string	"?\202\210\2008s3\315\0014\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bLIS3MDL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\bQMC5883"
+	.string	"\007AK89675"
+	.string	"\bH\005NONE"
+	.string	"\005AUTO"
+	.string	"\016"
+	.string	"<\263\216+\331\261\311\r\330\006H\254\232\035\024\366\003\231"
+	.string	"\\\363\314\003d\3563k\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableRangefinderHardware.186.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \303U\005"
+	.string	"t\ts"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\252\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'/\206\b{\270\324Ry\276\002\005\001'7\by\301'?\b}\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005TF02"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007TFMINI"
+	.string	"\007HCSR04"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"OX\314\323\016\260\265\317\254\033T~\003(\002"
+	.text
+	.section	.gnu.lto_lookupTableOffOn.187.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 u}\003"
+	.string	"D\0068"
+	.string	""
+	.string	""
+	.string	"1"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\246\205\327\022}\273\001-\206\b{\370\326Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\003ON"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004OFF"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableUnit.188.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \177\315\003"
+	.string	"\344\0069"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\253\002}\273\0011\206\b{\370\334Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007METRIC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\tIMPERIAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAlignment.189.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"u\n"
+	.string	"D\021+\001"
+	.string	""
+	.string	"{"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\254\n}\273\001"
+	.string	"\005\001\006\025\001\t\005\001'1\206\b{\330\346\002y\276'<\230\346\002y\300\006\025\001\007\005\001'G\206\bw\345\002u\303\006\025\001\006\005\001'Q\206\bs\230\345\002q\306\005\005\001'Z\206\bo\330\344\002m\311\004\005\001'a\230\344\002m\314\003\005\001'h\206\bk\330\337\002i\317\002\005\001'n\206\bg\230\337\002e\322's\330\336\002q\324\001"
+	.string	"?\202\210\200\320\001c3\325\0014\323\001\321\001\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\0015\277\001\275\001\274\001"
+	.string	"\007CUSTOM"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nCW270FLIP18\tCW9\bCW\006180"
+	.string	"\005"
+	.string	"\004CW0"
+	.string	"\bDEFAULT"
+	.string	"\031"
+	.ascii	"D\205\252D0u/\313\0308\007\001\203\255+\034\202\331\006\354\003"
+	.ascii	"9\202\374@\216 ?\260\037\310\017\344\b\362\363\231\023\330<\025"
+	.ascii	"y\0204\316\305>\255nP\371\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableGyro.190.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bV"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\255\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\355Ry\276'7\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005BOTH"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SECOND"
+	.string	"\006FIRST"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGPSProvider.191.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \233\215\004"
+	.string	"4\bU"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\365\022}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\370\364Ry\276'5\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006UBLOX"
+	.string	"\005NMEA"
+	.string	"\004"
+	.ascii	"8S\373\264\232@\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGPSSBASMode.192.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\215\006"
+	.string	"T\013\255"
+	.string	""
+	.string	""
+	.string	"N"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\256\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'/\206\b{\370\366Ry\276\004\005\001'6\b}\301\003\005\001'<\304\002\005\001'B\by\307'I\311\001"
+	.string	"?\202\210\2000w3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005NONE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006GAGAN"
+	.string	"\005MSAS"
+	.string	"\005WAAS"
+	.string	"\006EGNOS"
+	.string	"\005AUTO"
+	.string	"\n"
+	.string	"H`\\\325\016(l\005\031\003\374\361\314\216\253\375|\346\327\2402\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_lookupTableGPSUBLOXMode.193.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \251\375\004"
+	.string	"\024\tV"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\320\257\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'2\206\b{\370\374Ry\276'>\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\bDYNAMIC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\013PEDESTRIAN"
+	.string	"\tAIRBORNE"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableBlackboxDevice.194.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \307\205\005"
+	.string	"\344\ts"
+	.string	""
+	.string	""
+	.string	"H"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\300\270\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\370\377R}\276\002\005\001'9\206\b{\by\301\001C\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007SERIAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SDCARD"
+	.string	"\tSPIFLASH"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"\220\344\t\226\200\314}f\255\240\366\033@\021"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxMode.195.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \246\315\004"
+	.string	"\264\bV"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\340\270\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\370\305Sy\276'=\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007ALWAYS"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\013MOTOR_TEST"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.string	"V-\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardwareLpf.196.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \203\355\003"
+	.string	"$\0079"
+	.string	""
+	.string	""
+	.string	">"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\250\370\360\276\002}\273\0017\206\b{\270\365Sy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\rEXPERIMENTAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007NORMAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTablePwmProtocol.197.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"\035\n"
+	.string	"\244\020\036\001"
+	.string	""
+	.string	"\215"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\340\277\002}\273\001"
+	.string	"\005\001\006\025\001\t\005\001'3\206\b{\270\375Sy\276'@\b}\300\006\025\001\007\005\001'J\303\006\005\001'T\306\005\005\001'^\206\bw\330\374\003u\311\004\005\001'g\206\bsq\314\003\005\001'r\317\002\005\001'}\206\bom\322'\211\001\206\bk\bi\324\001"
+	.string	"?\202\210\200\320\001g3\325\0014\323\001\321\001\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\0015\277\001\275\001\274\001"
+	.string	"\tDISABLED"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\fPROSHOT1000"
+	.string	"\tD63150"
+	.string	"\bBRUSHED"
+	.string	"\nMULTI"
+	.string	"\nONE42"
+	.string	"\013125"
+	.string	"\004PWM"
+	.string	"\030"
+	.ascii	".IXLw\312\006P\244\245Nv\205C4\t\201m\200D\220\t\236\\\203\214"
+	.ascii	"\201p(d\r2\203\214\001\376@&x2\267i\207U\213}Z\335\240\362\033"
+	.ascii	"@\021"
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolation.198.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \302e\005"
+	.string	"\224\ts"
+	.string	""
+	.string	""
+	.string	"C"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\300\310\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\206\b{\370\377Sy\276\002\005\001'7\b}\301'?\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007MANUAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005AUTO"
+	.string	"\007PRESET"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"Q\245\346i\007W[\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolationChannels.199.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375`\252\003\205\024"
+	.string	"v\245\207H\240\232M:r)\002"
+	.string	" \267A\3420\271R=\222sV\226q\031BX\341\3130N\373\235Z\247\303\t\335%1\3237\311\376]\374\0264\003S\220\004\200\203\336*x\300\300])\306u\030B&I\346\270s\223\222\354\264\003u"
+	.string	"q"
+	.string	"u"
+	.string	"\n\262\310\275\372\351\263lJ\271Y\"\372\274\300\252\334\254\020}f E\267Z \372\334`\212\\\2553\0273?\364\331\001T\271[\274\016}\336qR\356\026\207>?x\322-\027oC\237!,)\227\353L\02133\3649\002\022\335z\3610\364Y\202\021\335z\235*b&\205>O\270\fv\246_Z\221\323\233\302\322\361\265\333\231?:\013\305\314\332g\272D\351\327\025O?\372\314\265\210\334\236\217>\303\252\013r{=\372\f\240\016\225\013\305\243\356l\013\365\035}\016\360\206\334(\236R\237s\332\220\033\225\324g\0355\345J!\365Y\300\031r\245\316\033\365y"
+	.string	"\231r\251N\324g\002a\312\245\022\352s\001/\272\255\322\365\331\300\026\333V\235\267\230\211\242\317\007\260\220k\305\303\365\031\301\025r\255\200\372\234\200\253\334\253Z\237\003\207\362(\247z\325\257~\036\353T\256\365\255W\271\225w\335\353Y\256\345\\\336\345_\016\346b>\346en\346h\236\346k\316\346n\376u8\217SY\\\250-*Q5\353\213jT\217j\214\212TgT\0325\251\332\2508,\324\034\025J,\323\256hH\003\255J\3456\235Cn\330\326\211'\244\317\3652X\r\333:\005\351\363We\220\373\004\244\317{\031\f\206m\003\264\247\307\303\322\260R\260R0\374\350X\351\030~t\004+\025\303\217\212`\370Qq\f\227\212c\245\264\360\2434\360\243\264q\034\301\217\322\304p)M\004C\336\220\231\372\360\344H"
+	.string	"\325\202\202~r\263\232\t\237\031Pm\204m\346\203\313\315xv\350\355\304\017n\026t\273\341f:\224&\216`\b\243'\362\"?r\246'\271\2227\335\351L\336\344O\336{\324\245\002M\250\021@\f\001\250&\265\177\314\001@\003\221\341\034\003\0200dX\232;\027\262\376\225\320<\230\366\027W@\202\005\270\235\030\375h@\226\375cwP\3258\n\342<\353V\272\363\215&o\001\312\266\305Q\310\341\001]\202\020\370\356\0332Dt\246\324\201\336B]f\240\\\321K\233\2666i\320\273Ph\273"
+	.ascii	"eD\245z\022\276\371X\032\236zG\n"
+	.text
+	.section	.gnu.lto_lookupTableLowpassType.200.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\370\314\n}\273\0011\206\b{\230\347\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableDtermLowpassType.201.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\340\315\n}\273\0011\206\b{\330\355\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableFailsafe.202.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \247\355\004"
+	.string	"\364\bV"
+	.string	""
+	.string	""
+	.string	"E"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\310\316\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'5\206\b{\270\364Ty\276';\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\013GPS-RESCUE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005DROP"
+	.string	"\nAUTO-LAND"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableFailsafeSwitchMode.203.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \240\205\004"
+	.string	"\344\007V"
+	.string	""
+	.string	""
+	.string	">"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\350\316\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\270\366Ty\276'7\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007STAGE2"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005KILL1"
+	.string	"\005"
+	.ascii	"\nV9Z\265\330\247\325\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableBusType.204.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \274\025\005"
+	.string	"\004\tq"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\300\317\n}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'0\206\b{\by\276\002\005\001'5\301':\206\bwu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006SLAVE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004SPI"
+	.string	"\004I2C"
+	.string	"\005NONE"
+	.string	"\006"
+	.string	"O\221\202\200\001\376xf\327\2402\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_lookupTableGyroOverflowCheck.205.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \230E\004"
+	.string	"\244\007U"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\316\025}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\270\316U}\276'3\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\004ALL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004YAW"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8\027\373\264:@\3557\200\""
+	.text
+	.section	.gnu.lto_lookupTableRatesType.206.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \361m\006"
+	.string	"t\013\220"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\320\332\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'0\206\b{\370\324Uy\276\003\005\001'8\206\bw\bu\301\002\005\001'>\206\bsq\304'J\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006QUICK"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007ACTUAL"
+	.string	"\005KISS"
+	.string	"\013RACEFLIGHT"
+	.string	"\013BETAFLIGHT"
+	.string	"\b"
+	.string	"6\031\003\213\001\341<\363"
+	.ascii	"\231\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableThrottleLimitType.207.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \234\225\004"
+	.string	"D\bV"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\335\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\270\354Uy\276'6\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005CLIP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006SCALE"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableVideoSystem.208.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \233u\004"
+	.string	"\004\bV"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\300\337\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\367Uy\276'4\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\005NTSC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PAL"
+	.string	"\005AUTO"
+	.string	"\004"
+	.string	"V-\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableItermRelax.209.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \343\365\005"
+	.string	"D\n\220"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\360\337\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\370\376Uy\276\003\005\001':\206\bw\bu\301\002\005\001'?\206\bsq\304'C\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bRPY_INC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007RP\004RPY"
+	.string	"\003RP"
+	.string	"\004OFF"
+	.string	"\t"
+	.ascii	"\217TB|\2121\260\030\020\3163\017\220\271\317\254\033T~\003("
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_lookupTableItermRelaxType.210.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 }\315\003"
+	.string	"\004\0079"
+	.string	""
+	.string	""
+	.string	"8"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\310\350\002}\273\001"
+	.string	"\005\001'3\206\b{\270\304Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\tSETPOINT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005GYRO"
+	.string	"\002"
+	.string	"\357\314n"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableAcroTrainerDebug.211.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 z\265\003"
+	.string	"\324\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\370\350\002}\273\001"
+	.string	"\005\001'0\206\b{\270\307Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\006PITCH"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005ROLL"
+	.string	"\002"
+	.string	"\357\314n"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingType.212.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \204\365\003"
+	.string	"4\0079"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\350\351\002}\273\0011\206\b{\270\316Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007FILTER"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\016INTERPOLATION"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDebug.213.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \303\205\005"
+	.string	"\324\ts"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\300\352\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'3\206\b{\370\317Vy\276\002\005\001'8\206\bw\bu\301'?\206\bs\bq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tTHROTTLE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004YAW"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\310\334g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingInputType.214.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\330\352\002}\273\0011\206\b{\270\325Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDerivativeType.215.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \2775\005"
+	.string	"D\ts"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\352\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'/\206\b{\370\326Vy\276\002\005\001'7\206\bw\bu\301'<\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005AUTO"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007BIQUAD"
+	.string	"\004PT1"
+	.string	"\004OFF"
+	.string	"\006"
+	.string	"6\031\363\264\003d\3563\353\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableLedstripColors.216.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375`[\001\375\r"
+	.string	"V\330^G\360\2226\035\264\0210\355\317a\021\221\305U\231\210\210\210\210\310\217\303\215\030##\217\357\220q\222\231-}\330\217n\257o\365?\f\235\226\330\351\315\372\371ur\373\b\203/d\372\004\236\211P_\024\t\320l+\362\350'\031M"
+	.string	"K"
+	.string	"N"
+	.string	"\n&\013\230\276I0\317"
+	.ascii	"R\234\372fL\311J\232\347\021\0230\215\343Z\311z`\236\261\021"
+	.ascii	"1\2153:\220\265\300<\223\200x\260\222\303\001\202"
+	.string	"\254'\363\034\340%}\336w\210\320y\315\f\221\311i\265\352/\234%\310\332\231\347\325\260\373\r\001?N\036d@x!\255\n\024\f\354\201\210M\343\222\231>\304\246\031\237a\236;;\\\372\345*\311z\f\363,2\232\3725Z\230g\217\rS\327\270^d\375\204y\346\031\247\256\211\231\347~I\307\020\333f\201\254\250y\376\2708\265M%\223\325\013Jd\261L\253LdP\312P\242\313)+\251V\231\211\200M50\2512V*\245\312\260\ry\034)$Q\n\032\331{\370\207\207\270\210\223x\211\2378\212\253\370\212\267 \360\027\207\361\231\3138\215\327\370\215\343x\216\3538\217\367x\033J\321:\224^\nr*,\275 \372y\226n\236\366\215>\3132\352:\332\362\241\"\256\303z=J\277-\004=N\204\255\247\265\244p\b\252l\\\207-E\320\241\360\202\264\033q+a\350\323@$\253\201\036\3354\221\334\035"
+	.string	"6\263\2562!\363rQNk\020\236\303l\b\362\003Y\202\374~\232\007\371YM\226 \347\254\214\203@"
+	.ascii	"\341 \223\251\f\203@\2622\032d\r2\007Y\203\314A\326 s\237Y7\250"
+	.ascii	"\374\006P\004"
+	.text
+	.section	.gnu.lto_lookupTableGyroFilterDebug.217.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \233\215\004"
+	.string	"4\bU"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\377\026}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\370\376Vy\276'5\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\004YAW"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\004"
+	.ascii	"8S\373\264\232@\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTablePositionAltSource.218.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \250\335\004"
+	.string	"\244\bV"
+	.string	""
+	.string	""
+	.string	"F"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\320\370\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'3\206\b{\370\304Wy\276'>\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\tGPS_ONLY"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nBARO\bDEFAULT"
+	.string	"\005"
+	.string	"LU#\342L\355\323\352\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableOffOnAuto.219.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \231}\004"
+	.string	"\024\bV"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\370\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\306Wy\276'3\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005AUTO"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableInterpolatedSetpoint.220.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \361\345\005"
+	.string	"\004\n\220"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\320\371\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'5\370\314W}\276\003\005\001'A\b}\301\002\005\001'M\206\b{y\304'Q\206\bw\bu\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\013AVERAGED_4"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c32"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\n"
+	.ascii	"/F \253\306\240!\037\260\r\220\3103;\260\237\317\374\024\324"
+	.ascii	"&\003\200\003"
+	.text
+	.section	.gnu.lto_lookupTableDshotBitbangedTimer.221.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \234U\004"
+	.string	"\224\007V"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\371\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\370\316W}\276'5\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\005TIM8"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c1"
+	.string	"\005AUTO"
+	.string	"\005"
+	.string	"\002T\"\342\\\354\323j\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableOsdDisplayPortDevice.222.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \350%\006"
+	.string	"\344\n\220"
+	.string	""
+	.string	""
+	.string	"L"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\320\372\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'3\206\b{\370\324Wy\276\003\005\001'8\206\bw\bu\301\002\005\001'A\206\bsq\304'G\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tFRSKYOSD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004MSP"
+	.string	"\bMAX7456"
+	.string	"\005AUTO"
+	.string	"\005NONE"
+	.string	"\b"
+	.string	"6\031\003\213\001\341<\363"
+	.ascii	"\231\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGovernorMode.223.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \3115\005"
+	.string	"\364\bs"
+	.string	""
+	.string	""
+	.string	"J"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\374\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\370\344W}\276\002\005\001'9\b}\301\001A\206\b{\by\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007MODEL3"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c21"
+	.string	"\tSTANDARD"
+	.string	"\b"
+	.string	"+Y\020\251\262\201\314O\260\004l\3553k\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTables.224.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375`\311\005M\030"
+	.string	"\026%\221G`\232N:\037L)\177"
+	.string	"\217\304E\201_h)\177\360\277\226\022\356w\204\371\234\025\002|\346\201[6\035\277@\262i\351\bY:\027\221\301\227\030\177\211\361\227X\376\2134M\300\r\207\305\260\376x:2W,-#I6\203"
+	.string	"\203"
+	.string	"}"
+	.string	"]J\254X\3526\3403\261b@\007ZN\2548\360\347\n\212\214\003\037LiO%\305\212\247\r!\312P\306\323\bP\332\343\035\211\336\214ja\351HhR\304\026\233\023\236H\266\350\244\260D\005[t\276\025\232F\313\342\323\005\222k?\227d\213\317\327\306\202[\3737\345\262h\347\016/\234\207\370\341\325\332\257\265p\221\303lR\022\372P\370\"\343X\351-\355\0052\231Lw\372\020\300}\210\037\n\201\204B\"U_\270\351\356\020\320j{\013,\207ag\200\002;\332\276\022\313c\370\371\2528\255\243\355*\262\\\206\355\204s\006p\264=u\226\321\360\335\200\234\216J\313\370\356@?\265]#\253e6\214\347\376\3504e\267\025\343\355\264\214\r+\316C\320J\034X\234\367\362\fv`\261^\202@\017\371tfZX\n\322|`1\037\006\004\261\304}E3!X\354\3273F\004\213\377\026\370\215`1\324e"
+	.ascii	"\206\304\022G_\237-\3259\232\252\335\266j\254\316j\036\315\325"
+	.ascii	">\332\253\277\032H\007\351\260\026\323\320cM\244\213tY\237\265"
+	.ascii	"\221Nk$\275\326l\355\326o\035\227\241\3470\344\247\341\313lR"
+	.ascii	"\022\222\203Z\325?\270\250U\205\266Ie4\025\372\332\250M\261j"
+	.ascii	"\364Ek\373\bU\256R\245\356\320\314\212U\245D\262\253\254N]uH"
+	.ascii	"\026\253N[\310\326R\025|\005\200q\261\352\340\217\256\025\327"
+	.ascii	"\335\364h\273\313+\007\302c\220\262\350\b\231\224D\2444\"W\034"
+	.ascii	"\215G\310!#\343\021Ii\f\352"
+	.string	"\021&Y\020!\031\223\222I$\343\215\360lo;\334\343N\367\272'\271\2223\271\363v\277\273\223?y\336\365\376^\312\253\334\312\261<\313\367\276\345}\347r/\377\3620\027\363\277CO\346e\036\275\364g\216\346j\276\346\323\0136\263a\364R\307h\246\236\3214\332\251\241\332F\337\b\200\212\250A\220#p;\373w C!b\035\020\020\204\024\273;\037\211\360\262yCYjy\214\224{7\rV$O\026\026NVD\333\0162 Z\276nn4\216u\335\003\273A\356\230Q3@\"U\301\331Q\362R\2316\352\263\2333\204\264\025G\347ET\261\023H?C\235\243KK\343\341Hgj+\3258\3611\305,\242\300\3369dFR\210!b\212\236\304\224\212p\276\227G@azZB\\\007\207\321\017JAM\351%'\246\201d>8\026\034\202\b\f\254\"\3732\226\226\217\270\032\231]\354GW\221Z\364"
+	.ascii	"cU\352\273E\2003\027\247\223Xz\313\252nl\221\363\240\325\006"
+	.ascii	"wj\\\271\242\002"
+	.text
+	.section	.gnu.lto_valueTable.225.50c8efe759273310,"e",@progbits
+	.ascii	"(\265/\375`\360}}\207\001\232\"f}Z0\312\250\344\034k\230w\300"
+	.ascii	"\264\032g\306\302\270L\032\231w\210\"s\017\007l<-\250,\034\034"
+	.ascii	"q8 \337\223\250k\"\261|_\355~\373.Mn^\3369\034\216\307\343q8"
+	.ascii	"\036\217\307\247{|\317\363<\317\343\n\307\365\212\b\212\210\210"
+	.ascii	"\221M\306\2379-\327\266\313o\322\233\022\t\353\007\351\007\357"
+	.ascii	"\007\235\250\003!/\003\205\213\027%O\3728\261\2301\370;\357\t"
+	.ascii	"\317\tS\n\311\022&<-\344\332\307-c\222(\341%q\002\201)^\221#"
+	.ascii	"WV\310\257\217c\223\242&cv\0301B\305\013\302\233\242w-\206\274"
+	.ascii	"!<\252\274\352\343\2301,\340\357<)\236\220\t\"0\204\327\203\367"
+	.ascii	"\304\003\302\373\221C}\334[L\017\374\235\347\203HU\037\322\301"
+	.ascii	"c\007\022\034\023\221$\034JJl\360w\336\215\"/sT\203\006\323\231"
+	.ascii	"\221\021*\030E1\220T^\256\311\212\232|\257\020\035a\341\242\305"
+	.ascii	"\223\327\n+\036\020\n\241\240\250\255\023\275+\260\021\264\016"
+	.ascii	"k\310#\3613\205\005\177\347\211\300z\031^\017\255\0232\344\205"
+	.ascii	"\340\201@\206\275\234\030\0265\371\016\201\277\363>d\355\242"
+	.ascii	"\232rq\027x92\2500H\226\276\274\271]\340\345\224MmI\220\330\272"
+	.ascii	"p\271\300\313-q\254)y\231-\264N\310p\267\334\241]\340\345\330"
+	.ascii	"^\032\360\367\235\226%/Cf\266+C\242\275\334\333kbLkW\345\212"
+	.ascii	"\330.,\007z\271\246\313\264\202\201\t\327\227\024\260\r?g\344"
+	.ascii	"\212yu!\311\260\305\244\311\023'\310\261\237SB\226\251I7\312"
+	.ascii	"\026\210\334\t\005\013@\223^\004\211\222]\022\016?\327\344\016"
+	.ascii	"\311\332a=\030'UE\216\354\214 \327~\356\311E\202\277\357\210"
+	.ascii	"\f\340\311\016j'dj'\225K\375\234\230\233\"\310.*w\372\256\tV"
+	.ascii	"P\232z<\371\310\241~\216l\316\t\005\273\212\202cI"
+	.string	"\307\216)\257\3729ek\226\003\213\213\006\322\215\235\215\r?\267lw5R\236\254.\030E\364S\rw3v2\362\245\237k\266Gb\020my\245`A\357Z\fw/\\(5\301\3377\330\255\330\251\200\037(\345kWb\007\264\263bj\215\340\357;\0238\250\200\355@\354\222\273\021;\0219\024j\325\002\301\337w>\273\020\337b\212\2240r;\236\271\\\n\265zb\303\3045\227T\231\342\345\313\233\033\362\f\265\232BjQ\223,\2276&\bM\250,\325\330\372Z\016\204Z)Y)iebU\310\316\264t%r\016\265b\203\230\225\271N\262X!\n\303\"\266\001\265bcm\\q\272\342%\205J\237r\203Z1\331\025`_\025\242\314\302\232<\241u\312a\217\322\241\344?\250\325\333\357\315\211\223R\f\211\022\255%\033\320+\243\037\031\374\275'\331\202\205\310\221\253n\225K\241W?(F\212\344N\337%"
+	.ascii	"\264,QRT}*\207B\257\232~UBz\220\231\345X\223\017Z'd\330\177<"
+	.ascii	"!\321\320\253\25145\371\303\321\303\211\247T#SZ\322\301$\366"
+	.ascii	"3\221\003\307\317\261\225\035\325\260\321\221\220n\350\025\331"
+	.ascii	"\272F\203\213Y\1771\367!a\217A\353\260\206]F/\332\200^\255T`"
+	.ascii	"\020\221\265]\316^F\005\213\276\"\037B\257\232+\223\024\312e"
+	.ascii	"\007Bq\302\210\n\376\336M\274\226\036b\326\201\020v\021\364S"
+	.ascii	"\r\373O\037\221'\241X\312U\007\374\275'\273\317[\314o\241\232"
+	.ascii	"\353\037:O\356\203b-\327#948]\030\035\030\016(\026\333j\002\376"
+	.ascii	"\256{[zic\262\261Q\245\251\261\255\345?h\026\323\307U\245\246"
+	.ascii	"\005m\313\233\224\022]\033+#\313\253\320\254\246\217\006\374"
+	.ascii	"\035\005b\273\"\026f\344\033\301\306E\n\225)Hj`\275K\224..%."
+	.ascii	"(;/L\232l1\365\204h\361\230YItH\362*T\253\251w\004\177\327a\251"
+	.ascii	"/A\221#F\236z>Dz_\244\250\246\242\224B|n?\240\200 \327P\255)"
+	.ascii	".jR\335zZ\337x85\211\251N;~p8\226r \275\240ZdmjR\rRb\301\324"
+	.ascii	"\260\201\204tC\265\224H85\311\363B\243\rS4C\3062J\f\267\351b"
+	.ascii	"\350\005\033\317\007\374\375\207\344 \342R\254\320\251\310\177"
+	.ascii	"P-&\317\205P\214\234\211\023@\3100\250\326\0332NM\356\274\300"
+	.ascii	"\337u%\"\314\275\314\254\003!\324\371\320\272\344P7B'\0029\207"
+	.ascii	"j5?\250\311]\024\370\373I\026\"\007!A\303\006<q\364\213\r\323"
+	.ascii	"\271T\356\0065{\333\031i~@\341\334\340\336r\037\364\314H\204"
+	.ascii	"\232\334\001\201\277\247_>\320\026\313j\373\300\036\266.\\\220"
+	.ascii	"\220\326@l\241\237j\230.\321\236v)\340\357\251\226T9A\210\261"
+	.ascii	"\262\224,\257B\317\242:\\\226\024\213\006\017\364\241\022\246"
+	.ascii	"U\256\244V8\240gS\235\f\376\236RIz\201\245_\271\024z\266\354"
+	.ascii	"P\272>\300\025\313*\206\007\212h\362\304\t\233\325\026\223\n"
+	.ascii	"X\340\005\301\317\214H\255\204)\022%I\362!\364\214\331\201d]"
+	.ascii	"\205\220b\335\274=?UE\210\220u\242!T\036~\206D\224\220 \371\017"
+	.ascii	"\272T\226P\223:9\250\037!\244@F\36033M\364W\r\323\036\251S\016"
+	.ascii	"\204.\227(\324\244\316\f\376\236\362Hu\204\220\356\3105\374\214"
+	.ascii	"\211\364\206R\016\034\271\020\272dS\241&uM\222v@\251\fajD\247"
+	.ascii	"G\303\264\006\215\234\005\272d\272P\223:\035\360w\nf\360\234"
+	.ascii	"H[\314\251\013a:\224\302H\211\362%Tm\251\223\001\177O_\240e)"
+	.ascii	"\\\212\"E!L\205T\244\310\207\320\265&\030jR\027\004\177O\203"
+	.ascii	"\204\202R\021\302\364\207NI\fS\023i\211\274\b]\213\232\241&u"
+	.ascii	">\360\367\223H:\"?\322a\313k\3446R\b\245<iO\032\"\005\221'\241"
+	.ascii	"\314\251\264\r\376\236~x\030.L\\3_B\231b\251\031\030\025m\314"
+	.ascii	"/m\371\022\312$K\277\274\254X\252\261\255m@\231\312#\360w4\255"
+	.ascii	"\263(;\323\242\344\2002\227\351\016\370;j\306k!\226\005K\016"
+	.ascii	"\2052\331R\030a.\300\246T\241\262\001e2S\021R|/x\242tq\345R("
+	.ascii	"\363\rm\203\277\243P\206\2240i\262\225'\241mF8\324$Z\006\177"
+	.ascii	"G\265\226Pp\211\256\262\260\220\274\254P\030TUE\210\344Kh\233"
+	.ascii	"\222\0165\211f\301\337\321!\337\026!\306\023\024\215F\rQ!A6\240"
+	.ascii	"mL\250\017\370\273\005 9\017\235\037\271\323w\345>\362\037\257"
+	.ascii	"\233\204\242\245\0354\312c\210:\241M\034\320\266&T\006\374]\001"
+	.ascii	":\230P\031\031H7\224\222r(\264\355)\210\232DK\330\2400\243h\306"
+	.ascii	"\021j\264\001m\213r\203\277\2432,\030\241)fT\205\020uA\243/\206"
+	.ascii	"(\321P.\205\266M\345Tj\362\313\340\357\030Z\254\b\001e\001d\313"
+	.ascii	"\020\36431.\034\241#\204\250\t\032\005\032\242(N\344U\250\033"
+	.ascii	"\233\004\324\344k\301\337S\264\004\005~B@IT\300\002\357\016s"
+	.ascii	"g\342gv\337u'h\240<(\b\372\305\206\250\017\032\342\002h\363\r"
+	.ascii	"\003j\362\257\340\357h\017\372\341\374\325\b\023\327\344\200"
+	.ascii	"6\233\337\204\"\265}ys\333\200\306!\305\200u6\226\363\247\t\177"
+	.ascii	"\215~\266\341w\341\262\001\215S\312\200\232\374\021\360w\235"
+	.ascii	"\232\006\334\271\271\271\271\337`\367]WC\275Q&\3743-\312\r\240"
+	.ascii	"qM\034P\223\337c\346AR\025\341\207\321/6\374,X8\240q\312\252"
+	.ascii	"\030\035P"
+	.string	"\223E\370{\005W>`%\226\325\f\036\270\373\256"
+	.ascii	"\245\256/)`7h\334\233\007\274N\034[N\240<\271A\343\232\027h\362"
+	.ascii	"\346\310J\262D\311\r*gT\025\203\001\360\367GB\001\272\3642\273"
+	.ascii	"\357/5\377\224\360\213\320od\370V\305z\203\363\217\334\364\336"
+	.ascii	"D\"\267\324\344\341I>\211\357\267\232D\341\357\317\363DptT\252"
+	.ascii	"\235\037\"\202\257\032An\201gDO\004\276\377{\276\004\273\357"
+	.ascii	":\034\004xx\367\375\224\231r\236\264/m\314\345\005!\272\020I"
+	.ascii	"[SC\216\275\0256\013\334\226g\221\"!{\246E\311\341\2550\263\230"
+	.ascii	"a\031\313\222K}\030\223\005N\340\357\254\030\0336wd\n\215\362"
+	.ascii	"\030\262UX*7\037\326dA\225\024\260X~ \272\024\262Q\272\2708|"
+	.ascii	"\330\223\0059\240\\1i\262\225/}X\224\0050\264\226\360\260\226"
+	.ascii	"B\026\213E\302f!\321>\314\002\237\253,\"F\2120\335\252\220l\t"
+	.ascii	"a\247X\251|\350\303\336*\320\022$\311\023\220\037\310\261\017"
+	.ascii	"kV\201\277\263>\224\354hby\344RO\306\254@\211\016\245\03486<"
+	.ascii	"\331[\005@\340\357l\022{\303\325:\242u\312![\203F\236\364d\315"
+	.ascii	"\nn\300\337Y\243]\327\311\004\006\235\036\r\331\"6\006\207/\253"
+	.ascii	"@\b\376\316\022\261\240S\022C\326\005\333\0029\366eH\025\204"
+	.ascii	"\200\277\263+\232\2447\204\354\t\232E1d\205\330\240|\351\313"
+	.ascii	"\224(h3\302\002\351\224NF\220`\177\362\244/{\242\240L\304\023"
+	.ascii	"\036!\313\206`Al\370\262(\n\236\300\337\331\017P\232rq9\324\227"
+	.ascii	"MQ0\004\376\376\013\363\203\313\235~`\324b\224<\034\205\371\345"
+	.ascii	"\327\206D\37321\n\224\274t\221\341J[\373\251!\335\276\214\202"
+	.ascii	"\022\360\367\337\362\354:\323\362Sn\3702\245\0067\263\262\t^"
+	.ascii	"bY~X\362\252/[j\270\002\177\377\205}\361\b\177S\252PA\256}\231"
+	.ascii	"\006+\370\373O\nX\027\227WYSC\217(R\332\266\234\374\232\344P"
+	.ascii	"of\244a\006\223s\n\234\360\207\204F\201\206?%In\336\fIC\326\357"
+	.ascii	"*\204\037\226\026\252\244B\304\310\257H>\364fM\032x\340\357\277"
+	.ascii	"\252\337\220\030F\017W\t\"%\344IK\224\225\024>~?~O9\320\233E"
+	.ascii	"M\360\244\307\0258\035?\036\277\035\271\320\233MM \204),\t\307"
+	.ascii	"O\t\371\365fb\023\314\200\277\377nt\242#\372\251\206\277\032"
+	.ascii	"4n\336\214l\202\023\360\367\237\021\026\030E1\224sDC\261\f\224"
+	.ascii	"YA\243<\206\277\026?\026\371\322\233-%`\203\277\377T| E,?p\354"
+	.ascii	"\007D\353\224\303\037\212\337\t\344\332\233\261I\340\005\177"
+	.ascii	"\377\231(\023\3613\342\346\315\230W\360\367_\262l\235\373}\240"
+	.ascii	"\323\243\341\017\304\257\347\346\315\336$x\202\277\377x*\200"
+	.ascii	"i\256a6\274YS\002#\2703\346\227\265\215\303\237\031IP\002\376"
+	.ascii	"\276z!Rc[\327\220k\177\206\224\201K\032Z\244e5SnY\265\344U\177"
+	.ascii	"\246\224\001\354L\202-\251\022\313X\226\233?c\312\220%\206\246"
+	.ascii	"\003A\305\312Z\005\371\365gM\031\230\246,}I\341\332\365\265z"
+	.ascii	"\345?\177\366\224!\b\376\276r\255Qf\322\266\2344\311}\376L,C"
+	.ascii	"\b\370\373\312D\r\211\222$d_\262\326\210\bW#\364S\rW\253\365"
+	.ascii	"\310\315\237)1\224\301\337\327\"=lR4\372b\270RM!\307\376\214"
+	.ascii	"\t&\304I\270\376\200\002\222\017\375\331\233\222\247\036!\254"
+	.ascii	">\220I\236\237\331\315\360ta\242Q\240\341\272c\325\201\034\373"
+	.ascii	"%\022\006*\370\373\272\264\342\ba\315\001\202\347gv3^\326#\341"
+	.ascii	"\212tc\265\221\017\375R\t\003\017\370\373Zc\245\301\203~`\306"
+	.ascii	"\240\323\243\341*c-B\236}\232\022\006\033\360\367\025\306J\324"
+	.ascii	"A\033\013\027k\213\034\352\323\2300\244\200\277\257+V\025A_N"
+	.ascii	"\254A+\212<\351\323\2320\364\300\337W\240\325D\356\324\235\266"
+	.ascii	"4\271\211\370\031\361\364\005\376\276&}b\302\365\003\255S\016"
+	.ascii	"W\020kO\356\363iQ\027\266\300\337W\036\2700q\276\346\206O\233"
+	.ascii	"\272\340\005\346\004\323\346\366%\007\3724\261\013C\230a\266"
+	.ascii	"\326\270\370\330\220s\237FvA\006\374\335\247v6\265\240\371\266"
+	.ascii	"\344R\237\246\274`\002\376\356S\306\371\304\204\276\2612\037"
+	.ascii	"\031\362\353\323f\270\300\337}Y|Xr\247\3271\311\305\020\372\250"
+	.ascii	"\320:\345\320g\305W%Oz5\244\031,\360w\337\024\237\224\334\251"
+	.ascii	"3\273\314\371\242\320>\256\241\317\313\327\225K\275Z\324L\223"
+	.ascii	" \037\024\036&M\266\304\216\300\337}Z\276%\026>\360`!\361e\345"
+	.ascii	"C\257F6\363\343\252\207\210\0215\345\314\215*\020B\246\244\220"
+	.ascii	"c\257\266\234\031\n\222\362\204x\002\362#/z5\266\231\023>|\226"
+	.ascii	";\232x0gzt$\225r\370p \317^\355\315\302[\022\221\b\032H\276\032"
+	.ascii	"\271\317\2535-,\217F\304\220\341+B\216\375\232\2050\030?-^\370"
+	.ascii	"\\\344E\277\206d\201\013\376\356c\361$P\320\276\240\241/\205"
+	.ascii	"O\210\303\257)Y\250\202\277\023\300w\342\003@\261\254^x`\t_r"
+	.ascii	"\004\375C\206>\022\276\237\034\350\327\230,$\301\337}\"\210\326"
+	.ascii	"7\301#\364}\240u%\206>\020\276\236\233_k\262\320\002\376\356"
+	.ascii	"\343\001\n\023\327|\262\020\002\314\t\036a\257\215\326\225\030"
+	.ascii	"\366\334\276\344I\277\026U\201\311\364\222;\355\272\334-\024"
+	.ascii	"djlk\271\324\257\221U\310\002\177\357\245\365\226\271\323K\311"
+	.ascii	"\005\365\312\204\2753-\312\\\350\327\224K\340\357=\263N\304\n"
+	.ascii	"\211e\301\302\254\n\373\024H\302\336\024Z\247\034\366\252\364"
+	.ascii	"\250\344>\277\366V\301\007\374\275'\245\007\306\243\"J\027\027"
+	.ascii	"R\005#\370{\017\n\257\313\212-a\217I\223-\245\n?Z,\262\222\364"
+	.ascii	"\220\344C\317\234\242\020\006\353*mA\304H\021\261e\325\020\235"
+	.ascii	"\213 R=!\033\236IF\001,\352\205\217\037\275\247\233g*)d\365\030"
+	.ascii	"\322\301\243\267#_z&\205(\246$\034=\245\\\350\231\024\216n\300"
+	.ascii	"\210:\252\321\243\221'=\223IA\b\376\3363\372\300\214X~\340\356"
+	.ascii	"\373\307 \212\001\343Mn\250hE\257E\217E\016\365\314\246\f\032"
+	.ascii	"\374\275\247\242\007\311\235R\036\031'\202z(\362\252o3\222\201"
+	.ascii	"\0024\243\007\231S\245\2607\202N\217\206=\022\275\237\\\352"
+	.string	"\333\220d\210\300\337{\"\214\202\b{=\364S\r{!z \220g\357\306$\003\004\376\336\373p\224\3624\345\342\232d\224\302\320\b\"T\277\320/6T\337\334\236dR\264\261\321O5T\273p\311\241\336Ml\302\334\332o\345N)\017\222\252\024\252[h\235r\250.\321\220h\357F\246\005\376\256j\351A\336l$Q\263\320\352\330P-S\311\362\241wcN\2402B\305\242\303\2721\245\312\025+FWTN%\017'\251Q\272\276T/$\3327\221&\360\200\277\253\\\247\226\222\252\245n\251N\324&\310\265o*M`\001\177W\231\240`\271\323wY\301q\225\225\004\311\206o6M\370\200\225\003\205#bD-\222K}\363I\302Z\325\022\224\220)U\212\3037\243$L\t\022%\341D\302\3642j\017Z\3674T\325\346\224\204,\370\273\352D\201\246\020\322\037\025\260\300\214\2166uI\325\2412\345I\337\224"
+	.ascii	"\225\343w\330HRol\370&\231\204\032Hj\r\rF<\324\030\252\f\325"
+	.ascii	"H\235\221\003}S)\241\004\374]-\372.\0034\275\214\213!\365"
+	.string	"E\276\364\315e\204f\013\247\316\024\242uB\206\252\n5E^\364M\266\b\\\340\357jP\217\237\022@\252\211<\351\233o\021\260\300\337U\022\f\360\241~PC\320\273\026C5\251\372\030q\301\337U\020jO\206\007<\3015\345\342\220\"\030\t\003F\202\006\374\340u\3411y_xm\033>N)\302\016\370;\317K\312\343"
+	.ascii	" hikjMF\360w\3362U\302P<23%\357\f9\366qO\021T\224!\340\341\250"
+	.ascii	"0,<\261|\350\343\242\"\370\\\t\302\373\222B\2057%\227\372\270"
+	.ascii	"\251\030/\360w\036X\251V\n%\215\222JI\247\244a\251Xj\226\236"
+	.ascii	"\245i\251Z\352%e\246`\3220:\036\335\007\335\217\216\204\016\205"
+	.ascii	".H\307B\327BG\244\203\2413\322\035\351n\350\222tL:\035\272\036"
+	.ascii	":\037\272(]\020\335\020]\225\316Jw\245S\242[\242s\242{\242\363"
+	.ascii	"\322}\351\252\350\254\350\260\350\262\350\314tg\272\245.M\307"
+	.ascii	"E\327E\367E\347\246k\352\342zO\007\321I\364\022=\250\013\365"
+	.ascii	"\026\335E\237\321\215\372\215\236\324wt\036\035H\207\352CzU\307"
+	.ascii	"\352Y\235I\337\352\\\275\253W\351Vz\226>\326\267t\264\316\245"
+	.ascii	"w\351p\035\314\356\303\256g\367\263#\261\013\332\t\355\206vD"
+	.ascii	";\243\335\321.i\247\264\333\261\343\261\373\261\003\262\243\332"
+	.ascii	"\r\331Y\355\256vKvZ;(\273(\273);*;,\273,\273\263\235r\227\266"
+	.ascii	"S\333y\3311wp;0\2739\036\017\317\207\227\344\225\340\231\340"
+	.ascii	"\245\340\251\340\275\340\r\361d\360f\360\220x6x9xK\274&\236\023"
+	.ascii	"\017\212\027\305\253\342\021\341a\361\262x[\274&\274.\236\027"
+	.ascii	"\257\n\317\n/\013o\214\247\205\267\205\307\306\343\302s\343\275"
+	.ascii	"\361\346T\036U\204:B=\241\242PW\250,T\"\025\206z\244\322P\225"
+	.ascii	"T\034\352\016\225\207\372C\005\242R\251C\324#\252\225\252D]\242"
+	.ascii	">Q\241\250`\252\0245L\025S\315\32435MUS\275\250L\025N\005\243"
+	.ascii	"\316\365xz>\275d\257D\317DO\250\227\242\347\242\367\242W\324"
+	.ascii	"\223\321C\352\331\350\345\350-\365\232zN= =\250\336T\217\252"
+	.ascii	"w\244g\325S\322[\322s\322{\322\363\352}\365\254\364\256\364\306"
+	.ascii	"zd\275-=\264\036\227^\227\336[\017\256'\327\233\363\205\360\371"
+	.ascii	"\370J\370L\370T\370V\370\206|D\276\031>#\237\r\337\r\337\222"
+	.ascii	"\217\311\347\344\353\341\203\362E\371\250|C|G|V\276$>%>'\276"
+	.ascii	"'\276/\037\230\357\212/\314g\346;\363-}i\276.>/\2767\037\234"
+	.ascii	"O\3167\267\206X}V\022k\211UhM\261\276X\207\326\031\253\321\232"
+	.ascii	"\264*\255<\326\2465j\r\262\016Y\253\326\253\025k]\262j\255OV"
+	.ascii	"(+\330*e\275\262\206\255dk\331\212\266.W.k\227\325m}[\343V\271"
+	.ascii	"_\210\237\317\217\304\257\304/\350'\364s\361{\361\223\361\233"
+	.ascii	"\361C\372\331\370\345\370-\375\232~N? ?\250\337\324\217\352w"
+	.ascii	"\344g\365[\362\323\372=\371A\371}\375\300~V~W~c?\262\337\226"
+	.ascii	"\037\332\217\355\307\345\347\366{\373\315\261<\254\017\233dK"
+	.ascii	"\260&\330\024\254\n\366\005;\304\312`g\260H\254\rv\211eb\235"
+	.ascii	"\330\036,\024\033\305R\261C"
+	.string	"\330#\254\025\233\204U\302:a\237\260^\354\027k\205\275\302\222\261e\354\026\026\215ec\271\260_X7\266\311\306\265!Z\237\226D[\242\025jS\264/\332\241vFk\324\336h\223Z\035\355\216\366\251\375\321N\265T\255\221\366H\233\244U\322:i\237\264^\355W[\245\265\322\226\265f-Z\273l\273\264^Z\270\026L;\347\362\270>n\322\005rO\270*\334\025\356\220K\344\316p\215\334\033n\222\313\344\352p{\270>\334(7\210;\304\255r\257\\,\227\211\273\345r\271]\356\024\227\212+\346bq\315\3343w\351\246\271]\\/\356\233\013\347\312\271so\210\327\347%\361\226xS\274*\336\027\357\320;\3435zo\274I\257\216w\307\353\343}z\203\274B^\"o\2217\353E\3626y\235\274]\257\327K\345\255\362b9\300k\366\236\275\3137\355\355\362zy\337^\270w.\206'\306'&\031S\302"
+	.string	"1B\005@>\301\200\030\317\210\236\b\244<'\202P\344P\317\344\r\t\374=\006(\306\204\017}\032\021C\"\346'\207\372-&"
+	.string	"\374\200\277\307\210@\333bzh\235r\030\023\"\006\304\315o5\001"
+	.string	"\t\376\036\363!m\312\305m\370\255("
+	.string	"\004\205\001\023A\327\346\366~\311\245~k\252\0039f_\343\302F\246\246\266\323\202\266e\303o)\247(ycedy\322o-;P\222e\350\212\330\033\266\341\267\330:"
+	.ascii	"\002\177\177\255 \201M\221\302\341\267\336:8\202\277\277_\314"
+	.ascii	"\334G\376\003\n\375T\303\227+J\016\364[\315\016~\340\357\357"
+	.ascii	"\023\255-&7\337\304\210\203\267%IBx\225tx\301S\376\254^\254\367"
+	.ascii	"\n\211\366M\2248\310r\304H\005\226\352\255z\207 \307\276I\024"
+	.ascii	"\007]SR3m\021\220((\016\317\245D\344GS\217\327\211\303s1q\260"
+	.ascii	"\004\177\177y\274`\3027\007\323\273\224\003=\327\023\007*\340"
+	.ascii	"\357/\216W\t\203\230\032\257\215\027)\037z.2\016|\340\357/\215"
+	.ascii	"\367h\215\020\203\326)\207\257\214\267(\367y.\346\006p\360\367"
+	.ascii	"\027\306K\224\006\261p\361\266\310\223\236\353M\313\n\224\007"
+	.ascii	"\005\215\002\r_\2417(_z\256\346\024\370\373{\3425\021\302\013"
+	.ascii	"4\002.&\231\026\210\360\025A\273F\206\357\317;\342\346\273\224"
+	.ascii	"\222\300\337\337$\n7\353z\204\357\007\032\3451|A\274=y\321wM"
+	.ascii	"m0\004\376\376\362T\b\023\327\024\333`\007\374\335\005\323\346"
+	.ascii	"\366\345\346\273\3106(b\316\254\321\350\213\241\313\205-_\372"
+	.ascii	"\256\rN\300\337]\265\013Z\320\266 \307\276k\271\301\007%\206"
+	.ascii	"\345X\031\031"
+	.string	"\033\227,\031\254\204]\271\371.\246\030\374\335\255\362%\005,O\372\2567\330\t\374\335\365\232\340I\024(\371\320w5\2158i\302jP\342j\271Kn\336\313\bv\202\277\273I\334\254\020\\$^\232~\306\t\005\272\036\241[\204v\215\f]\253#7\357\205d\004\177?\217\270DP\240\n\272\244h\224\307\320\245r\247\362\241\367\212\202S\300\337]!\026\360\374\200\002r\363^S\360\207\247\013x8\271M7\357%\246\001\033\374\335\335\201.q\320h\324\320]rs\344R\357E\246\301\025\370\273\253\344\332@R6\201\277\2734\334\243\237\0061\\\031nQ\276\364^K\r\210\300\337]\030/\225;}W\013\367\205\353\"Oz/6\r\232Xl\240^\t\335\240\024\256\020r\354\275\230\032\324\200\277\273(\234H\230pK \303\376\013I\003\030\360w\367\307\025\221;\271#\232X\244\016\334\0367\204\013B)\b\376\356~"
+	.string	""
+	.string	"R\223\326)\207\255\\\034\223\006>\360\3676L"
+	.string	"P%_\336\334\232\334\332Z\246"
+	.string	"\332\2645.l\271\320\177=e \006\177o\325*\030\200\262\335\322j\311}\376+*\003.\017\332+Y\350\257\032\266d\355\030r\354\277\2462\310\202\277\267X\332\260\020Z\261\030d\026\264R\350\027\033\266T\332)\310\261\377\022\313@\b\374\275\005\373 JW\313\205\374\372/\262\ff\300\337[(8\2304i\267\362\242\377Rf\260Bk\311["
+	.ascii	",$mV>\364_\313\f\222WV1\006\250*B$_"
+	.string	"\372/6\f\334\340\357\355\220\003\264@\202H\265Br\250\377jb@\026\005\245\341\002\004\360p\362\321\366\310\205\276\212\021\006L\2320H\200R\216\226\251]\312\177\276\n\022\006N8pd\240\200\0326\220\2240xA\343\210\202\005\304\220\321\026\345U_\205\351\2029\370{\013\243%\252\200\001,\350\364h\330\272h\321\204\005\376\336\256hUX\320\2328\321\006\265(\220Q\276\312S\227\232\274\340\b\374\275\005\342\300\001\237%\342\247\035\221K}\025\261\013\234\340\357m\262W\226;}\327\003X\271\031-\022\266\037\350\247\032\266 \332\236|\351\255(]@\003\376\336\362\260s"
+	.string	"\200"
+	.string	"\\\03007o\205\351\002\241\267\bx\tg\315\221\030\2771\037|\340\301\006\204\t:\362N\374\2368p\306k\3549\247\2269\347\033'\256\361\337\204\t\025\200@\231==\330\3045\307\325-\3226\016\004\312\357)\224\213\276V(\027\177\256P.\272\254\221&\002\347 \rM\224\201\261P.\276,}\274\337\230s\266e\235\240-\333\320\310x{\336tmtO\342\234\023\327"
+	.ascii	"\343\332\226i~'\320\216\203t\221\347;\207\300\331\306w\262\347"
+	.ascii	"Ma\305\177sQ\266kb\240}\307\364}\333\027N\337i\003d\2176\320"
+	.ascii	"n#\234\036l(\234\036l0\3408G#ma\316\241q9\207\266\347\340=\033"
+	.ascii	"\205F\032hKp\336\304\331h\224m\200q\007\0349\356 \027c\316 \035"
+	.ascii	"\343\264\021\247=\361[\256\211A v\260\357\327H\003\347\033\247"
+	.ascii	"\203\375\353`O8\306\234\357\t\004\312q\320\256\201\263=\241\275"
+	.ascii	"g\373X\254\201q\207\232f\b\224\21142F\272\310\236\035\344\"{"
+	.ascii	"\006\215r\261X\377\316\242\3161\016\316@\343\316m\304\211\347"
+	.ascii	"\033'\346$\326\300\032\257\355\243\004\267\2503\341\274gb}\374"
+	.ascii	"\2355Gb\\<\332\255[SSG\220\321\2513\234\263\215\023\224\260c"
+	.ascii	"\31795p\266-\234Abms\317\266\r^#\337DZ\256\231\2119#\330rM\363"
+	.ascii	"\236;8\r\224\21720\306e\032\266\203\\\244@$\342\324T0\322E\n"
+	.ascii	"7}\317\366\214\337;6\355i\317\370\\l\2013>\007gr\356x\276q^\334"
+	.ascii	"\236\211r\214\3134@\t\023N\334\210S\003w\354\031\307e\232x\006"
+	.ascii	"\332u\315\214\2053X\323\366|\304e\032\372=\205F\332h\313:\027"
+	.ascii	"N\242\f\244q\332\006\306v]\023\033q\202\030V:\310\236\366L\023"
+	.ascii	"\2174N\304)\306\270L\223\363\3122Q\006\336?\\\246\241\331s\016"
+	.ascii	"\326\275\240<\347\324\302\bgM\343\262\035\333\362,t\217+\035"
+	.ascii	"\347\324\302UBN-\324p\304!\326\365\361\216sja\f~\323\367-\307"
+	.ascii	"v\215\327E\"-\343qN-\274P\3249\306u\216=\337\356=\343\262\275"
+	.ascii	"\262\355\t\264c\035y\347\347[u\344\235\336\372\273c\035y\307"
+	.ascii	"7\341\304\2153\320\236\2171\021\307k\333\006\257@$\326\366\033"
+	.ascii	"c\3178P\266e\033`\214\3275\315l\307\314\270\034<\342\304\024"
+	.ascii	"\316#=\214\213\300`\214S\244\327sG&\316\301\270h\3137\035\214"
+	.ascii	"p\026m9\306o\233\256\211\215uL\224\201\024N{\016\3229\265}dw"
+	.ascii	"p\332\026\3362\215\204\367\f\342\3104q\215\343\310\361}\024\266"
+	.ascii	"g=\023i\242,\214\347\033\207\202{\3429\3078G6z\260\251\2114u"
+	.ascii	"\214\033\351\372\030\317\305\332&\306\347;\276\217B\013\005\270"
+	.ascii	"\217\302\230\336\0314\3124Ay\016\306:\362\016{\006\347\333\236"
+	.ascii	"sf[\346,\326\3069\030\337\367\f\254\355c\034\244\217\021\316"
+	.ascii	"\031h\234\355\271f\266e\342\231H\327\324\366\2215\322\036l\342"
+	.ascii	"\016rQ\346\254\217\035\346x\316\261q\200q\315\221\030\033w\202"
+	.ascii	"3\022\2021\023N\01761\b\021N\0176A\327\006\210\327\306\240\204"
+	.ascii	"\240-\353\330uMp\236k*\264'\020(\373d\274v\317_L\007\2318\333"
+	.ascii	"\022\316#N\320H\353\260\247=\343\364\357d\2138w\220>\306\234"
+	.ascii	"\036l\342\373\226\217:51\326\221wf\316\273\030\007\345\331F\036"
+	.ascii	"\3265\361\302y\323\035d\013\366l\244e\033\217k\033(G8\322\252"
+	.ascii	"Z\243\036\351 \257\206w\244\203\273\232\335L\024\032e\231\323"
+	.ascii	"\006\027\032g\033\277+\234F\331\2260\347\314\304\337\211\003"
+	.ascii	"\347\232\232\t\270=\037;\3141N\244\361\330X{\240\355\332f&\306"
+	.ascii	"\302YSS\3438\300\230X\333\270\261\006\3067\215,\341\264\345\331"
+	.ascii	"H\023\343\366<\336\361\214\313\304\372h\317\270\221\216kj\"\f"
+	.ascii	"\351\343\035\327\324\270'N\027ib\334A.\30655\021N\273\306\201"
+	.ascii	"rMl\203\327u\361\216kjbN\374\256k\232\270\246\246WACMM\f\244"
+	.ascii	"\211\300\035`\254#\357H8\361\033\307\266\301\343\371\226ib\035"
+	.ascii	"y\347=of\273&\236o\"\316\261H\307551\206\363\336\221u\210\262"
+	.ascii	"\204\035\0318\007c\273\266\3559\346\234sh\0348\023\21150\236"
+	.ascii	"q\200\367lG8\215\264,\2249\347\"\215\317\036\350;\326\251\203"
+	.ascii	"FZ'\303\351\301&\266g\234H\327\304v\215\31393q\226p\006g\274"
+	.ascii	"H\304\331\263\303L<\342\004k\210\262M\\$\342\356\211\033\351"
+	.ascii	"\270h\313D9\306\361\332\306=\213D<6\322q\220>\256D\342\f\234"
+	.ascii	"\355\t\030\2103NM\207\035\0171\020(\007\345\331&\210\203\323"
+	.ascii	"8Q\256i[\316\2319\205\306\232\030\343218\317\307;\016\032qj["
+	.ascii	"H\3019\003\2152~\323\301\f'n"
+	.string	"\234m\033\0078\013e\234X\347\304\300{.\036m\f\300{\276\340\234m\034\\\266\347cq\306\343\340L\244\221o:\030\357\330\370\\\234\2113\256\341\274\2014~\323\270\214\337\361\360\226\361\367\234\203u1\026\342\320\314\301U\347\216\357\372\210\200x\306e;\346\234\201\262-\214\213\266\034\033\353\330\3269\306\2343.\333\361\354\201.\322\370\261\216\355\231\210\023\234m\200\267\205Sh\244\213\266\034\017\2014~\3073\221F6\316\023\316\342\214\337;w\\\317A:'\306&'\016\002sXb\r\304o\234\020\004\345X\247\2661\234D\231\266\347\273\302y\3338.S8\207F\232H\023\317@:g\016\306\363\215\023\037\357b\214\333\365qG&\036o:X\301i\254\351\333\236s\214t\034\234\211\355)\244k\2145\220=;\3244qM\033\351\243\357\203\017>\370\340\203\017>\370`>\356\3407\016\215{\33684\364\361\306\231"
+	.string	"\020\004\272=\357{\266\203A9\006\202@\333\365m\234\357\t'\221X\333\021N\033 N\037%\234:\362Nl\024\322D9\006!\256\355\035a\314y\3178\216\221.\306\370|\327\324\324\361l\254=\314E\032\267p\356\316\033\267\021\322\304\232\t\347\035\317E\032/\306\370M\007c\242\214\327x|\3432~K\350\347\f\264q\352;\306\211rl\254i\234\276\353\343\204\017@\210\355\371\306\211;\3244\3579\027ec\\\200\330\236o\234\270CM\363\236\300\001\334B#\215\343\363\355\001M\004z`\244\345\242\007@\373\366`"
+	.ascii	"\027\316\3728\333\036\340um{\260\236sQ6\306\006\210\355\371\306"
+	.ascii	"\211;\3244\357\371W\217\365Z\317\344\243<\327Oy*?\366d\277\345"
+	.ascii	"\321\336\3133\037\356\301\274\334\317\241IT\004\032\204\n\241"
+	.ascii	"0\320\030(\r\264\006\212\003\315\201\366@}\240R\350\024j\004"
+	.ascii	"=\202\"A\223\240N\320'\250\027\372\205ZA\257\240c(\031\272\005"
+	.ascii	"EC\271\240]P7\364"
+	.string	"\r\225C\347R\2374\231\002\245'\322\025)\2134FZ\224\"\2456\322\245\224)\365\221>\245R\351Tj$=\222.\t\212\310\250\304$\036O\"\001\351\274\314840"
+	.string	""
+	.string	""
+	.string	" \001s\0304(\212\213\343D\320\245\007\024\200\033~vB 2\261\323G\224L\033\230!"
+	.string	"\200\fGQL\026[B@\325\337S\201\371d\265qN\252A\356n\227u|\235\271<\322\226\223\0348\270\030\020\272\323\230\320z\205:n\020wk[fr\302hd\214\031Wi@\265\201u\364I\345\b"
+	.string	"\312O\370\031\251\246\311\207}\270\340\326\375\206\210\031c \300zPf\230B%Q\031\032\256 _\026d/\235I\221\022\331R\350\001\2542\245v\250\342\316\344\253\022\024\021\200\007\3358\262M\275\003\371E\333\2502M\350\031>1\324A\255\323\220Y~\312\031&\311/X\311\250\036\016,\202\200\333\201w\271\2607\270\326\314\027\2434\253m\001\307\027\361\3214]"
+	.string	"\234\177J\001\240'\254y\314\013L\200\351#hQ\200\231/\316\261A\023\251zu6\252\361=\371)\3265/\206\361\r\220a\361\023\301L7\225\205,\265\345\341_J\375\254em \021\232e#\362\002m\373@\240\255\333\325\f\217\351GK\232\025\376\030'b\"\212\374>97e\343\255\330\207\352\005W\265\022Pt\246I\213\365\261Q|&\r \227\226\036\177%-\006\210\364"
+	.string	"\202\035u\333\216k\f\336\006\r\215;\2652v\356x@"
+	.ascii	"+2C1\216(rh\030V\345\254\233\266p\031\001B\365\246\346%\367F"
+	.ascii	"\305{\345\365u\213&\354@s\364\324\261\265\2616M\313\266\213\315"
+	.ascii	"\222@\322Z\233\241\302\177\341\222\n34 td\027\367\305)4\231"
+	.string	"\2475'\262Mv\275\303w\031\376\031V\f?\236\230\r\272\373\177O\357\207\244\323\315\016\032\375\250c\240EH\2538\314\b/\344\327\231\301\354\357RI\3025\034\334]>\030<B\253\376\232\fx\007\377\257\320\324$\305\027E\257\036 \3661\261{|]\343\020>{\307^\305W\245\211\0173\210\202u\275b%\206O\306\344X\341g\257g\254\202\231\227\026\250p\026\242T\3556\243\025ZJ\250\361\371,\030\353\346\2349\222\024\321\372<_\307JE\200\270\310\357\274\363/\264Ot{\234\332q\007!\006tBl{\322T\001\322$\206)=\253D3#[\310\253\327Qg\337\274\223j\016\025\321r*\2500C\323[\345\235\017\375$\204<fb~\031,x\253\275\211S\2469-\342\"(\027\236\371\216E6-\336\r\034\337|\227\341\356\322\374\214\354\220\211\237\334J\353_0\300\324!\270\255V\342\257xm\3637"
+	.string	",\310\016M\234\340T\365\302\332a\220\243\222q\340\232M\252}Os\017o-o\255_t\2601\220\222}\316\274\345\220\317\276\223oe\323\305ZI\250\031\255\030\251\316l\222\035]\003|P\312\206ot\205\206Yb\310:\033,\226\2351#[\262>\302\345\342n\207_\252\340\375\243\370_N\371\305\350\030yw\262q\204\375\266S\320']\257\366\024\004\036\253\372w\f\274\003y_\331i\363\203\354\207:z\337\272\266l\274\n\344/\340u*\351\\9\207\341\037r\t\335\274\177\363~\332\005s\232\335\273\372s9;\333*\205\2478\344/47\333>\037A\254\334"
+	.ascii	"n\356"
+	.string	"\367\203up\177\035\273\3016}\262f\203>\222\372\232\013\300\204O\254Nu\355X\013H\277\177\356v\273\036\312\262,v\327\373\221\315j\300M\251\375\313\335\354\223\013Lkra\211\377\237\336!i3<;E\373Z{\366LO\206n\364:\376|]/\004C\324\033\316\255@\006\320!\3554\204\322\216/|\250b\220/\242\304t\201\346\242\026\247\022\256\324z\013\336k\345\304\377y\027\221\347{\341o\250\357 \230/\251L\260i4\030\262\033`\315\203\221\202\321\330\250\201\234L\243\032\001[\247\305p@\204\026\345\373\031|\347\352\017\246\213\230\375'8\312C~\241\303dK;^\271\350\377\322z\225\261q\254Ig\261\320Z\032\265\2113\001\375f\032o\342\314[\371\271n\362\357\255\312\213\261c\365\024\272j=\374,\273l\263\230\n\270Ia\250\271\353V\311\362\302\242\2008\364&\003\016\026\256\376g\017\006\300\375W"
+	.string	")z_\327\356\255\005\241\264\372\355\221\033\374;\340\201\003(\344n_[\315\276E\370:W\371Z\335\n\022\263V\226\245\n\320\250\004\350\223_(\3125\371\343\224"
+	.ascii	"q\265"
+	.string	"\314\270\261\256m\b\315&\340QgB1L\033\304\304\257\022\r\267\337A\323T\210(\327\233\230oM\261\270\216\226\303\272\333.\311S\267\226\330:v\225\344\003\325\"\262T57\351\3365\271\0340}P@\337\2045\233<l\216R\004]H\225r!P\275\221\211\006\373\\\336\303\271S\221u\005\255g\007Ay9/H\212\332A)d2*\nD\261\224\356*J\037\275\253z_\270\363O\262\253U\307\236%\037\003\n\351\302\346\317MJ\322\t~\224Z\230C\324\246evbK\317\204\224\305\234Nfak\205\362z\227bpY\354&\207\005\36111\204\216\t\327\255\2278kk\210pg<\201T\350O\t\036\372\315L\202\332\002=\201\276\272\247\225G\370%\267*H\0243D&2\263\324\212\275\320\\2?V\200\034\244\005\265\217/\321\267\327m\266LK-\\\253\327\275\364b}\345\226^\037\270\332\214\205\234"
+	.string	"\205\300%\031\177\274\256"
+	.string	"\270\342\241<\325\256\217\013\f\364\025\\j\302N\317\b\323\221?%c\2310\315\326\351\003\364\222%EE\225\351\315&'\274_[\272\2426d\367;Y\f]\300/u)"
+	.string	"\337\200\3052\205\323\210\355&I"
+	.string	"i!L^wH0\217\002gMU\035H\030\362KD\256P\356:$\023\246\340Qn\314\020.o\317\253\226j\"\2201\361-\256\261\",c\251\316\020\354g\030u^\246\210\243*B\035\257uE\225"
+	.string	"\2220go\343\007\371\336?\002;\013\211(i[j]m!\272\267q\255\272\213\203\245\030XsU\3742\326\333U\224%\254+0\226\323-\210_\304\350A\b\030x\263\234\207\020\317\3518FI\221v;o\247FS\245\373S\262\026\300\352i@\265p\251E\3230\272\021y\275\225\337"
+	.ascii	"\247[U.\037\373\027*\351\346)v'Qg\261+\200\265B\020\315.\n\266"
+	.ascii	"c\246\342`&\311%\004\353\244f\314\266W/\360\350\345;\360oE\027"
+	.ascii	"\3547%:\273\361\312\325Xk\273\354\233E\002(\3507\"\375x\254^"
+	.ascii	"\241\300\021\302\203T\256\317Ng\202\233\306J\307\\4\246\035\331"
+	.ascii	"y]\235&K\234c!j\b\346\350\324\261\374\260')-\361\363\006\226"
+	.ascii	"\352-p\331\247\335Q\274\342\236;s\037\220bUbZ\264\030l\023A\032"
+	.ascii	"r\022\204H\374.\023\263\353_N\026\236R\205O\322\267\256\357r"
+	.ascii	"\267yq\030\017<k\324\244\230\340x\244\210Z\026\240\200\354\271"
+	.ascii	"\b\227\3232\002\3021\212o\332 \031V\221\022\3240\340\232\222"
+	.ascii	"jEN\214\277\233\362\231k[]\327#t\223j\2270\232}\200\223\037\007"
+	.ascii	"v\321\236\034\244\262?\374\253R\330<=\332\f\220U[\326\243aN\215"
+	.ascii	"\256I\207B]}\307\353\b\206'\022\244a\002\177\3611\347\324\265"
+	.ascii	"\260Z\350S\375\004\316il\371\306\330\226P8=\204\006\305\027\200"
+	.ascii	"\177\323@\223"
+	.string	"\342\201\364`\205BFM\270\225\265s1\275\263.O\001\235\226\003\003\261%\325J2\252\240':Y\254\271\205\364\230\322\004\335m\371<KE\030\026-\220\242)\260\332I\225\262\263\216\233\n\272\3506\031\267\353\3349\314_\016X\325\256R\221V\343,\242\356\344"
+	.string	"\311t\032_\233\325~}.\322\311\245\tJ\306^\324[\n0\364;\302Y\246c\200\245\250\374:\274\372\273\342\001d\025{\252B\0223\001\245\b\322]$\315\226\372g)\235'\037XF"
+	.ascii	"\357\336\351\361'\261\371\320'\261\304Q\223$(\222N\366Z\217\231"
+	.ascii	"\366e\206^\226\215Qo\333\3261\304o,N\004K\316\261\327\336\332"
+	.ascii	"\243TN%\306e\017\270o\230\200,\347\314\373T\230\324\273\227\261"
+	.ascii	"\023lL\036u)\034\305\304prSi+,\265=\215\306\353w\223\004\006"
+	.ascii	"\273\3147"
+	.string	"\216Q\342'bJ}\271\270\240\231\352\332H)\225\027\372\363\037\225z\246+\252\034\2343pHy\346\f\022q\365\332\027yJ\205\231z\217?\357{\252#5\005\374\205\262D\365\341\322\020\213*\022\216\236z\266\366\022\331\215\254\223\031\306\037\013\336z#]\273yx\205Y\321J\262\006\335gYy\230\240\371\233\007\311\303\327F\234\231\fG\304\251\343xKj\007\361\200\004z\301\267T3\0068Vb\247\326\203\345\271\225\001\0246\356\033\315\235\352\373\333)\367\334Ds\371 ,\354~9N\356\335\351&\004\215\255\r\270\206\352\330b\351\251f\340fhV\341\257\350J\031S\003bsU\216;\247\206\311PR&;\374y\2712\025\242F\231\241u\b\\\314\254\216F\262\376\220Mc\227#\033\221|\243:\371\031\032\356\325\334\003\277\177A;t\313}\323\360\373rl\333\334\341\206\241\311@\230DO9\0161\031\032\037\315"
+	.string	"\027r\233H(\311\"\022D\202\025\233\013\271\306\021\321\355\257\311\203\365\301\255\030\203\200{e\310\315\207}\245\n\220\373\310\271v0\036s\217H\f\342\255\357\317\271\2025\367\300+\3023}\374\345\234\320\303\362y\\\334\203\342\243\031;h}\221\020\201\024\302\243q\247\230\217\260\327o\213\035\244\355\320\023\034)\304L~\377\026Q\355D,%\371\362Fr\362\357\217\205\206&+5\313C\340D*I\300\002\254\264\"h\376\255\026%F.\023\tQ\341\206O\025Lj\312j"
+	.ascii	"\272\360b3\332Y\327\331\031\226\254\373\340\310\255\344\317\300"
+	.ascii	"\240\302n6\300\252~qZ\210\033\276\306\nkP\201\2131\024\210\215"
+	.ascii	"q\254\227\355\226\007\1772\264jN\027\226Ie\005\243b1D\004\331"
+	.ascii	"*\002\311\035\372n\205\331\375\020.\301F\017\005\262\b\213\221"
+	.ascii	"\243\224\224\307\247`\211AE\237\025\300\322\231A\325g\214\007"
+	.ascii	"\202\t\351\345>\025\333J\341\366.V\351\234E\016~$\266Y*\357\335"
+	.ascii	"\352\364~\364!\247\300h\312t\317\035@\374;@Z\330?\220\203\213"
+	.ascii	"\260C\013\234\246\323 \314\355\032\300\374\331s\276bG\\\226r"
+	.ascii	"\232z>?6!%{i\223K\340@+\3243\305f<\305E\031X\260\006\236\263"
+	.ascii	"\2315\300(\224\226\342\205\257\306\312R&Z\022\324\373D\236\243"
+	.ascii	"n\271\272\220W$s\226\345\227F\b\373\222$\203_\326\nw\234F\357"
+	.ascii	"e\t\244,\024\363\233d\033\356\270\355Y\225\231\3248\260\231\211"
+	.ascii	"\313Y\307u\260\356\352\033\212e>\213H\314\213\324\036,L\013\317"
+	.ascii	"\345\007\331;\264\257=N\337\215\001'\023;\323@\0271\302\341\224"
+	.ascii	"\323\375)Q+\364\n\250(\342\377\221bz\201\225\fN.?\366q\200\216"
+	.ascii	"\217LGB\233\2173\202\027\233\276\376&\222#Y\351x\246\240T\022"
+	.ascii	"\371^p\275\307o\242}K\003\232\327\330\247\260C\216n\262\252\307"
+	.ascii	"\335\233\263\177u\244\326\325a\270a\036\344P\202#\305[\036\266"
+	.ascii	"4\365\036\360]\321dKF\234\211\325Y\\v\3105\325a\311K\300\260"
+	.ascii	"\217[\364\260\276\341\370H;\262\273\273\213\325a\300\215m-\026"
+	.ascii	"\340\020!\3349\036\221\341wl\273Pa\223\346WCe\003qn\270~\206"
+	.ascii	"\275Fn`\203\365\201pi\233\"\323^\034A\013\365\245^\367*\232R"
+	.ascii	",t\203\377=\271\246\356\302\303\352on\312\2159\377A\243\267\204"
+	.ascii	"28\013\315tKc\262\013\315\361@\215\321@LV_\362]\341\326`0\257"
+	.ascii	"\275\337\261F'\312\341+[\233r1o$~\034\036"
+	.string	"Y\345;wq\256n\314Y\034\rd\324\034\237\030L\247\354Y%\366\001-lO\013\246AT\035\335\t\311\177\301\310\030If|9X;\236\0057y\325\177\330(\300|\343C\2758\267&\242\216\331`~\312)3\277k\370\363H\347\243\314lB_5\203k\353\3075\361\230O\360G\003;x\326\370dM\0019\027\213\345\026\325rJ\267\257\210'\321\352\325\364\376|\035!\207\256\231J\251\261\254l\275\204ax\201\214\013\244\3151\361\202\332\212y\342\230\003\002\201\3052\262\327\027\203\345\243\222\006\301~\004\250P\016\261\024\f\r|k\334\032\263\346Y\316\357J\264\024\332\265\264\225\331\nPX\232\270\334M\256w/\361\177M\365P\024\035%\r\302\005!U\372\3702\261\003\363\224'D\\\301\260w\3703\263\251\032&\346\236V1\376\026\037\027w\240\253\377e\261b\201~\272J\204\035KW L\307\271Kj^$"
+	.string	"\024g\346O+\363\353<\361*\026B\242\3652A0/NQ\340V\306\265M\n#\255\260>\225\250\266\221XY\223i\n\311\320%f\266\331T\013\327\0262T\226&\323b\335x\247\274a\360\277h\233\203%bH\261\202\261\227\"\246\236\031mQ\311/\246\313<\003\267r{5\f#7\b\26699V\310\376.\373\304L\326Q\356p\362G\333d\320\353o&&\202g\341\220\252\021LZa&\364\265k\262\325\340\0053\0132;n\0073\345\321v\373\022\033R-\020\373;\023\001\316\205\220h\265\206\325y"
+	.string	"\f\204\230J\217N\353{\323PT\277+\355O\205\301\301\021\225\"\201\234\342\216m\330\027\335\005I*\311\013TH\020\300\227\277\327c\210\326P\020*\024\221\007\347BlI\rk\251\327\353#M\265\246J\267A\202f\352^\252L$w\tT\376\016\255j\343\302 )m\205*\375\363\343b\245\267\337\336\350\353z\020\302\2143&\351\301\312\003\312o\005\230\306\215Y\220\306e\002\"\375?*c\275\036?{\262\032:L\337xD\340\354{\002\350\022\r\"W"
+	.ascii	"\312C?\nt}\360\230A\305\005E\251\227\203: $9\220\320\222u\025"
+	.ascii	"\274+\035\302\"\f\250\263\233\310\031`z\306\207P\265\205]v\265"
+	.ascii	"w\231[\241M\323\310\350\323=\037\013\376\235d\336\266k\251\263"
+	.ascii	"\362z\320I+CP\"h\256N3\273\001'&@KT\035\230\310h\031\210`\330"
+	.ascii	"x\326\0220\020\021\377l\201\356j\351\313\374\361\231@\220[\352"
+	.ascii	"\217R\360\221\030\310\363F-\267<8\232|\216\361\n\326\250\371"
+	.ascii	"8LVz\302\244\222\360\360\224\303M\240\001\355\003\351\233\016"
+	.ascii	"MOe&\271y\364\267IC[\372\275^\017\016\371\212\256\316\206\253"
+	.ascii	"\311\311\361\030\0138\315MA\264R\241\b\025\314:\253\234g\226"
+	.ascii	"\254f\013\315^8Ewy\333\2062@\023\325(\"\333L\3622o\324\273sI"
+	.ascii	"f\215\375\273\363\313\244}\027Q\004`\213\305\3204L\030\325o\216"
+	.ascii	"/\263!\327\373\020\214f8\333\332\263\302\335\013|j\n\201\371"
+	.ascii	",\235"
+	.ascii	"\301\022B\003L\2552\263\277UI\0239W,\020W\365mI#\341\312\314"
+	.ascii	"\206\361^\232{\270bGg\217s\227*\305V)\202\005\216V\323\367\204"
+	.ascii	"=\313k\r\253.0\242\304\314\365\001\3538\255\330M(\353\357g\207"
+	.ascii	"\023\363Y\306\222\316\0345\013E\211\037\3629\205\335J\306\324"
+	.ascii	"u\036\037\023K\277\354\230\316\314\316h\r\211\250\253OO\250\227"
+	.ascii	"\206\264Z\023\306\276\225\364\256\340\245H\030\032\216F\311\225"
+	.ascii	"\252\206\333\313\241\215\030P`4\013\322/'\330\334\330;\322d9"
+	.ascii	"\230\210J\344Tj\364E\210\bk\325\003\376\337j\301.\343t\353\017"
+	.ascii	"\375\227\345A\201J:\201R\273D'\360+\327\266\003\345\335<]t\277"
+	.ascii	"S\231x\027\235o0\360.\303\275l\247\322\263\030\t\354\243\324"
+	.ascii	"\233|\270\216\3231\334i^\322\201l\302\254\230\261T\323\227\253"
+	.ascii	"\245\021\016x`2\277\374>\334^\370\230N\034s\276\316\245\262\312"
+	.ascii	"|\226\254\371c\262\314\251>;A,i\321\237\373\033\023\251M\355"
+	.ascii	"\244\"\3140\372\007\275\326\200\007\350\020)P\203\360\252\204"
+	.ascii	"0\244\370%&^\332\003F\226\370+\251\234s\325\r$\313^\223\037\003"
+	.ascii	"\2353\347\240\346\244\2542\300\234TiB6|\330;[r\245\326\241E\005"
+	.ascii	"!\300\342\276\233\344\205\027\006(\020a<\222(Czm\325\373<b?\325"
+	.ascii	"\321\236\3152\b\311G~k\270/\314B\304\001/~Bn\367\257\256\317"
+	.ascii	"\343\025^\252\025\2161\323\320\346L@\203z\331\310\256w@\276\231"
+	.ascii	"\t\210\241\251T2\323\225s\260\342\334m\202\205V\023*\247,\331"
+	.ascii	"\214j\212|\242O\003\201\343\037q@OzP\357\213`O\t\362Z\002N5`"
+	.ascii	"f\305\030\232\252$\377\333\026\302v\250C\234\225a9aK\350e\"\355"
+	.ascii	"o\375\317(\243\\J`k\035\354@gEr5\032\336m\311\274\261'\324\307"
+	.ascii	"\320\025\211\241\025\345\251\252I7\257U\315%\271#5\r\373n\376"
+	.ascii	"\277M\036\255,H\256$\177\215JS\016\245"
+	.text
+	.section	.gnu.lto_settingsBuildCheck.228.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 \3005\005"
+	.string	"RI#,pU\323\001"
+	.string	"-\372<\325\021\022\344\361\213\325b\374k\034#&P\363)J@2\337k\n"
+	.string	" \350\t\366a"
+	.string	"\0015,\226\354\235R\246\246laMM\2532\235\fJ\255\251h(\205e:\025|9*L\265\353\302T\002\367\3623<$\304\006\271()\366\243\225\237\035\243\220\363OgW\022"
+	.string	"\260\236\200\346b\373\2227\033t\320\262\204p\023\311\204vWe\345\333\343\346\037\363A\347q\217\202\304\356:v\336\344\226\267}\260\215\260=\003\b"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375`\003\001\005\t"
+	.string	"\322\21643"
+	.string	"Y\222\016\374\377\377Z\341Ba\205\013\205\265\036e\211\362\377\377\377?Tzh\024\"\375\377\377_UUUUUU\n'L)\2340\245p\325\333\222\226dm{,W\236aS\345&t/e*l\242<\205\356\235,\205M\223\243J\206\"\371\t\335\033\331\t\233\"\277\204\314\004\362\322\307J\036'\241{\035#q|\204\315\215\2154.\312\230\b\343\232\213\207,\026\2528\210b\240\211\177$\366A\367\"\356A\367 \346A\367\036\336qX\247a.l2\034\203\315\205a\260\251\260K\3029\bo\261\034\254e0N\3017\004\347\300O`\233\200i"
+	.ascii	"\236A\367p\231\327Un+\355+\214\345ca[\255E6ka\355\220\354\327"
+	.ascii	"\266m[agim\357\n0 \300\323B\007Q\242D\031%\220<R\267bI\036y\314"
+	.ascii	"#\265%\251[\222G\036y\314#\217<\362\270<\232\232\025+\226\270"
+	.ascii	"\034s\353-[\340\"\243\270\261&c\020H\036\362\310#\217<\346\221"
+	.ascii	"\332\222<0\217\266$4\326~\002"
+	.text
+	.section	.gnu.lto_.refs.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375 ]]\002"
+	.string	"\322\305\021\027\360\032\265\006\314\3003\360\f\274\024\357\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\2515#\267\t\313'\032\n\372\331zvrnjfb^ZVRNJFB>:62.*&\"\036\032\026\022\016\n\006\002f\261Wk\225:\225\332\335\215\002"
+	.text
+	.section	.gnu.lto_.decls.50c8efe759273310,"e",@progbits
+	.string	"(\265/\375`\3472\225\314"
+	.string	"Z>\021EV \212I9\351\256\276\213\240\262\334fDFN\324L\317\375m\225\306\\\372\243}\225\345U\345\033\221Y\337\177]o\233\373\217\344\204\376\322\355B\245\247\"\257\273\b\216\367\226\006\370\231\344\362:\346\274h)]B\277\264\3300\363\3744+\265P\304C\231\227H\276$R\246\244\0033\004}\004X\326JO]'\244\334\224f\265\352\002\002(\216\222\031B\270\277S)\207\355ZA\227>n;\324\262\234(\327\311\272\261WM\353\344\2664\253\325\026\b\037+R\276\332p\177\335\366\311\266-\262v\330\244\033 Z\334\273\266RV\311\301\262}\247,\225\353<-\353\262\326\245\020\017\321Ss\302\275a\211P\336\232~9@\317\275\275\345"
+	.ascii	"](\276\257\332\277Q6m\b\265\332\022\352\371\2323\343\f\367\323"
+	.ascii	"\035By\310\016\241\033,\227\b\355-;\204\236)\375\226\255\331"
+	.ascii	"\227\211r\231,\332zP\241\354\210\214\200\366\006\305\b^\335\312"
+	.ascii	"Q\324\323\326\004\fN\247\fY\245\371\201\bG\363S\253Y\255\265"
+	.ascii	"\002 1Xf*\267\013OU\204\023 \375P"
+	.string	"\372\243\265b\351,\253\025\324\017\272:\273E?\320\236\253\301\377\256!\324zl\223\032i{\302\201A\375\377\242Z\235\254\216L/'\016G\346S=>\001s\305\341\270\254]\035*\323G=.\221N\215t\342\272\254Q^W5\n\351\304t\\V\253\272D:m\250QW\033\216\313'\247#\323\353j\217L\344\025\207\032U\235j\324SW\032\205\274:vA^m82\237\256\216Q^W\273D\326\rse\351\345d\254\314'\240Z+\3252\351\364S\353\223Uu\022\3032\252WSF\335Q\027\214\222\245\217\352\241\326\352\224V\327\003\311\263\204\252`\216G\220+\214\265\326U\031!8\255\323\262\326*U\241\234\266V\343\322\252V(d\212-\344\222\221\262\252@5\352\211\n\252\007\362\307\b\205\224\252G\272\266\326Z\257\216\314\036H_\025(\314d\205Z:\355\221\nY\223\265\316\313*e:-kZ\255u\331"
+	.string	"1\207lQqo\b~\006\301\317\035\370\331\005\267\370\231\305\317\304\2379\360\363\322\317J?\277\360\363\006~V\3613\360\347\024?\243\3707\203\f\374\334\302\317,\374<\201\237W\370Y\002?G`7\370\217\367\037\316\317\020\370\371\001\027\374/\341\347\021?;\340g\006\374\274\200\177\007\360\257\317\277?\377\006%\340g\001\214\360s\207\177)\370W\202\177\021\360/\t\377&\340_\005\374;\302\277\r\370\331\203\237C\374\213\301\277\034\374G\363_\315\377\346\1776\377-\3603\324\277-\260\001\030\004\033q\001\270\2109`\002\270\361\006<"
+	.string	"\026"
+	.ascii	"k\360\257\n\377\232\370\227\005\316\340\277\002~\026\213\323"
+	.ascii	"r\245MJ\224\323\311\277m\316\341?\317\024\021\373b\f~\016\300"
+	.ascii	"\217.\0357\264\256\376}1\365\363?_8}\300\005\213\223\003\377"
+	.ascii	"\316\360s\005?\003`I\003\024\374\374\341\002<\301\317DD{q\270"
+	.ascii	"\211\3150\227\177_\220\361/\022G\3603\007)e\377b@\350\347\240"
+	.ascii	"\377I\376\365\200\316\177\246\371\267\353;\377\371\200\177o0"
+	.ascii	"\320\317?\347\371O\021\376\375\342\363\237\312\177\257~\366\371"
+	.ascii	"\271\347g\364g\235\237\373\347\363\347\377\273\367\257\336\277"
+	.ascii	"r\376\205\363o\336\177\240\377\334\340\3377\377\272\371\367\356"
+	.ascii	"\3373\377\232\371\227\356\337\271\177\307\374\033\346_\271\177"
+	.ascii	"\267\374\373\366/\226\177\255\374\353\366/\225\177\331\376]\373"
+	.ascii	"7\355_(\3772\377m\362\357\362\337\263\177\315\376]\362/\331\277"
+	.ascii	"H\376\035\3737\354_\260\177\275\376\345\372\027\353_\030\377"
+	.ascii	"\036\3775\376\033\202\177?\360o\213\177\213\377*\375\013\374"
+	.ascii	"W\003\377f\340\337\n\374+\342?\226\377n\377\321\376\177\360?"
+	.ascii	"\356\177\007{{{{?O\211\177G\307\257\001\232vjh\027\252\2548\356"
+	.ascii	"3\233\237\323p\223\223@RS\236\242\270Y\215\357\274\246\356\252"
+	.ascii	"\212\026\267\316\016\241\247\007A\350V\311tlWT\247\266\0236\247"
+	.ascii	"\312\006\367\271\216\315p\322H\315\215-\334;\305w\246\341t{3"
+	.ascii	"\312\341^\017\250\225\334*Y\216\347Hl\250\365\207YR\355G\006"
+	.ascii	"\013\021\3563\231\237\301p\030Nr\235\326\361\216\233\305\370"
+	.ascii	"\316c|\242\262\326\306\270yv\b\325\251nq\274x\341\270\242\r5"
+	.ascii	"j\216,\251sf\313*y\013\307\025-+\215\240\271\260,\020j\350Z\232"
+	.ascii	"\024\024\3563\3349\311\326H\265,=\356\017|g.(\031\226\256<8v"
+	.ascii	"\262Jv\302o$\226\325)\250\255\013\taz[Y\204f\230\273\363\302"
+	.ascii	"me\351AGo\257\210\033\3563\226\237\231\374\204\257\374 \237\354"
+	.ascii	"\345\361\340\266\342\341|atRFI\333\330m\225\\\205\245\234\331"
+	.ascii	"x\312=,ke\253\265V\3414^#\301h\3053\343\007W\032Wa*s8\260\262"
+	.ascii	"\360x\264tP\211\201\366u\314\322\335\360\265\246\026T\246)g\n"
+	.ascii	"\367\322g\3538\345\314+e(\276s\224\3662\262%\3416\332!\024D]"
+	.ascii	"\"T'\251\243\225~\225\354\276\255r\337\030\215\347X+V\221\021"
+	.ascii	"3#\034^\265\312\001\"\310\206\224\030r)%K\025\0317\223\264('"
+	.ascii	"65#k\331-|\226B\247\331\304K\0317\023\017<apb<q_\007F\372M+\343"
+	.ascii	"\257=\263F'F\306Jx\t\233q\222Ur\031\027a#|\204g8F\355\227\262"
+	.ascii	"\r\303BNf\322\204\324X\023n\343\326\213\221\216l\271\2241\222"
+	.ascii	"m;\231\311T*\212\2222\006\343\344\311L\362\300\b\022f\344\301"
+	.ascii	"\310\310\310\350\324\233\"\246\311O_\007*\335\343\022\241\034"
+	.ascii	"vH\206\237\247\307\313\233\033I9\351[M\372s\222\211\234G*\344"
+	.ascii	"\222\203PY\026\2200\236*qf\320\342\3460\026;\217\361\220\312"
+	.ascii	"c! k}\3421!9\265>\t\355f\260\233A/\351Ad\r\355\267]\372\246K"
+	.ascii	"\337bR\016\262\374 \024E,\312\253J\352f\343\264I\351h\362\013"
+	.ascii	"\256\222B\207#\007\357\210\022E\b\222\255\030\207\024\027#W\314"
+	.ascii	"\2269\227\311\235(Ax4k]2r\315l\233s\2314\021d\207\017\366\342"
+	.ascii	".\006\302<\370\007\367X%#\037\205\\9\034\325F\227\243Yk5\372"
+	.ascii	"`\264hY3\232\033\212X\007O\324\2622y\312\260\321\221\226\226"
+	.ascii	"\276\321\270~\230Wbj`[\253\344\033|\325|\203\261\330\306\211"
+	.ascii	"f\225\266=\311\023J\322\305\314F7\327X\356\2225YM\356\267\215"
+	.ascii	"\224ip\326*Y\353\335\004\271\004:\237jxi+B\205\266\b}S\245?\335"
+	.ascii	"\244?\321\2443\204j01\352uI\017\202\036O\311%k\215\212\261{<"
+	.ascii	"\005c\256\256Yk\024\025\313X%\307`\030FF\036z\230`I\022c-e#K"
+	.ascii	"\255\362\003\037\227\313 8c\252\3364IAP\353~@woo?\240?\313\030"
+	.ascii	"J\315\310\333\016\356\237]\351\177\256\354\264J~\3329_\271\005"
+	.ascii	"s^\326\312\004Ao\255\004=m\250Q/\354\370i\367\326\312\271tKc"
+	.ascii	"\274\270k\326\312\364`d\004\224\006\352\f\211\366O\035\351O\250"
+	.ascii	"\364\274\227\236\233)\234\177 \202Y\303An\201\303%\305\3337s"
+	.ascii	"zy\253\\\274\255a\227F\036v\254z\344e\351>[I\317e\351y\206\224"
+	.ascii	"\215\0074\310\2307f\334g\035\351E\240\001\006\bv\033*\024\335"
+	.ascii	"T\262Vf\232]\263jV\271\315\275\373\322m\335w\351\333\346\242"
+	.ascii	"\3313A"
+	.ascii	"N\313Z\325C\027\003+\013\257V\246\221\221\007#\0361I4ji\177\345"
+	.ascii	"\244_2\351\027.]\376TU\rA\272\245_\265\324\303\022\241\347\016"
+	.ascii	"\241;f\311\254\322\202\235;\235\232T3\2409J\346\304AK\277\026"
+	.ascii	"\240\273\267\026\240\337%\351"
+	.string	"\327H\212A\332\022\241]\322\271\246\216/b\351\367+}\335\022\241\307;\003\263D(\007v;\322\257\225],_\345\006}\244g\340\261\024p?\264\314\340^\344\022\241\022\354\020\3322\370\336F|\244\304\351\021\341\036*\222,\003\344\354\013\367;\311\306#\013\207\030\356\036\363\275\211\314\311\213\221\306-$\306m\202\314L\375P\023\206u\326 \006H\333\020\256\035\257<\243\r\260\323+(\217L\n\356\013\214\347\206\223\256/!s\373\265D+H\020$g\214+\037x@\342z\266D\275\301\371!\367\263\314Rc\315\007\333\261y\361\002\327\3434\372P\221u\001\343\305zE\200\3245]\310\n\006\210\230F\376\275\243y\360X\n*\034[i\270\337\\\"4h\207t\344@\243\\q\222\354\034\313.4\261,8\270\322\032/\320np\277\271\376\316\352\033<\226\"\207\f>~p\277\247|\357-!\235\033q]Cl\324"
+	.ascii	"\362dM\213\373]\343?\327,\\\007\366\364\336pw\226\357\255\365"
+	.ascii	"\345\255\251\344\376\331!\032X@nh\350!\325X\377\311\243\257\216"
+	.ascii	"Q^G\270=X\"\253*N\202\346\303\330Uc)~\354\240\201\307\214\226"
+	.ascii	"\301\325\365\003F\313`R\021\002\326\244\212\361\203VE\343\b\367"
+	.ascii	";\306\337S\r\343\003\252\257 \334\337\262D\250\317\223\357}<"
+	.ascii	"\306Y\"eDqUd\256\215izb1\344\372EG\275\260\352\362\242\243\376"
+	.ascii	"~j(\036K\201\356\021i\343\266Dh\317\333\251\253\016\332\261\206"
+	.ascii	"5\356w\375Y\314~\341\261\024?`Z4\344\2707\212\357\347\336\230"
+	.ascii	"67cs\364\332\r\031/4\364\376\323\306)g\216\312\032!\334$\374"
+	.ascii	"\214s\302\361\241\203\322EM\315\231\307c)\250xy\002\204\273h"
+	.ascii	"\211\3207oX\217\347X7\340a\204#\023\312R$,l/\315*\3174\247\033"
+	.ascii	"\031qXw_\336R\262.\257(\356\237m\376\263y\252\371\211\302J\303"
+	.ascii	"\343>\327\370~\262!\222\026\027\307\r\264C\350\316\233Asww\254"
+	.ascii	"G\"M\232\021\016o\312\2313UB\232N\276\336\004\211\2311\303v="
+	.ascii	"V*\264\345h\006"
+	.string	"\315\240\243\213@\232\255\246O\032$r\016\367\201\320\314\315Qq9\307\234c\210\034\201\314\302\204a\273\242;\240.\270U\236p\247\234\034#\034\336\206\301\233\263\246f\346\330f\f\367\317/g\227vS$\216\r7\037\361\375\364\022t\245\344\311\0327\317Z\001Mm\331\022F\346\355\355+\371\303\304\202\205\365\304v\374\b\261b\345\016\307\217\f77\216\353\261\342\241r'\243\351\243\206\n\2253{\311 \032XQ\302hac;\215\021XI \206\234\246P\2151gZ\270\357\203\266\266\206\306\bG\346\003\226\226\326f\204#\363\221\001\005\312\006pF82=&\3634\016\021R\327\244\t\333\351\034+\b\034=R\226K\326#\221\206\354\354\354L\017\227\231\031\333\025\311\365\030\227,\201\243\341$;\311\314L\271\222\\\345\231<\221|\301H\252\235I\3059g8e\320\331\242\002F\013\367i\304\367\363\b\320\226 M\356"
+	.string	"\354\020\272\201+O\362\034;\307X\217\304\234$\217\326\031v\206\361\034\317\261r\200\227\316\361\261\312\323\307\tv\036\221\225\206\001\252\250\t\262\205\347\001.nZ6\230L\271q\377\374:\201\b\331h\"\367\206\373\f\342\373)D\310\315\r\323\311\016\241\032Td\226\034\253<s\234^\\=_\354\316\246x\202\204uaC\236:\316\035\254\004\314\030\206\373\344\341\373\211d&@\216`\334(\tgY\253<\263N.\252$\n\345\211\ted\216\311y\343\254\021T\246%\365\304}\332\360\375\334\272`J\226*\334;;\204\366\022\b\325*O\252\023\313\007\352.=\323\342UEm\031\347n\311\375\363\352\234\201&I2\205\344>\253|?\255x\324\340"
+	.string	"\321\302\035\301\016\241<\313\255\264\352\204q\302\3408\235cm:3F8\262\2356\351\177\036\317#\3335\347t\351\311\253B\002\307\375\235\263t\225\247\323i<\217\310\002$\343X\221\325\232\003D3\335\004\231\372I3\006F\356\214:\237N(N\266\231\222\201\307\275r\276\237Q\355\243\206*\031\270\271h\347\270\267\027\004F\023o\225\214\307zsz\306\244^\260\341>\3471\234\263LU\022(\334K\347;\307Y\300\020\037K\270\031\203\267\032j`\273\"<\364\f\315*\031\r\267!\021@\342\017\006$\342\217\004\021\210$\f\252\240@\023q\2504,\201\t\tX\2028\024\022\201-\206'\024\211\303\025\\\374\224\230\232\202& 5\231 \002\227\202, \001\223\204?\027\212\301\021\305\341\212&\023.(\n\203C\246\"\360\004\022pXd!\242\250$\"\3304\\\241\202\242R\020\002\035\200-\202\305_\213 q"
+	.string	",\230\204(\004 I\030\\Q\034\016\227N\230@\004\n\203?\"\013C\342\221\210\030~J@\n\240@\264\004,6\27181\004\"\005+0A1\270\024,\001T*\026\207\304\025,\b\001\213?\n\3000TRA\004\2660Q\001\213\021+\216\212A\030NX"
+	.string	"T\361kR\n\376 0\264D\004\026M"
+	.string	""
+	.string	"\220\311\005\013MM?&\030\206%\232\224\200B\341oE\t\032\b\207\301\342Oi\310D\004\026\205(\034Q@ix4,\016\211+,\301\260\302Wt\020\302\205\017I,\\"
+	.string	"\"\005%\375R\370\2158:\022\241\202\251\004\220\370\203\001\211\370#1$\2728\201\202\257\350"
+	.string	"\230\364+*\r[\204h\"\016\233\204\300&\013\232\200K?\025\200GD\026\303\023D`\021\230BQ\b$\022Y\034u8\n\266"
+	.string	"\232\020\303\320\205\027\216~J#>X\300D\211\021-t"
+	.string	"\"\rS8!b\304\t\"\020)\330bH\\\341\304\n'LP\024\002\227\204IA%\021\022\024\203\302\026\204\204&T\2500\261\241\330\204\242\tm\372)\026\201M*T\fQ$\340\013G?&\264\tEP\351\250\207\370[q\324\300\245\237\260\201L.\212]\254@P\351hC\021\305\007 \374R\370"
+	.string	"\004\026h\021\210B)\202bO\t&\026/\f\207Jh\221\303\016Z\214\341\267t\246 \f\246\020T:\372 \f.\235H@aR\260I\330B\f\277%ap)\250\210\212\b*\035M\340\342G$\376t\212_\321\224\364SR\241\323\204\242\204\022'\202JG\035\204\301%\236\025\305$!P)\206\337\022O\2220H,6\241E\024$\3544\r\231\212A\027\320\244\240\n\341\360\b-\242\020&1\351\b\223\230\316\236\242\220\305\260\004\027\304\242\360\001\022\024Q\214\340+\n\203,\322\030\200HB\024\200J.\374X"
+	.ascii	"\262P\372\265\020:\005\0372\001\211!\212\303!1\204\317}\276\022"
+	.ascii	"0hA\205\023\322\243\016B\004\225\216B\b\203\277\245\020G\304"
+	.ascii	"\246\020\035|x\341\b\270\242\004$\245 \213\021MI\302`\261\bl"
+	.ascii	"\212\340GA\"P\bLJ\037\302\b\007\030\201\204\030v\352\036\220"
+	.ascii	"1<\224p\277\367\376\326\3539<\226\202\253nF\027\367Z`\306\367"
+	.ascii	"\226\243\203\244\306\r\2618p\316P\315Q\341~\303\371[K\347\261"
+	.ascii	"\230\f\2605\356"
+	.string	"uk\372\336x<mer>\336\324@f#K\032\367\273\206\277\247\264\033 (O\236\310p\257\220#\276w\233t\316\333\214/6k\220H\036t\334\3575\1777[\215\230'00\356\375\260C(\327\371\336i\256`5\321\202\246\357\244\200i\246\365\335X\n9tez\330\235\221\323\006/\217\373}\346o3M\203\317\224\030\274,\356\255\200\213\357]\007\326\305d\b]\231\255e^\227\371\233L\317\265S\021-f\334,"
+	.string	"1\276\367\230\235'j\274Tn\r\302\200\341\242z\313\302\375\006\363\237FZ\016\275\243\203\253\342^</\276\367\027\037=\2665O\334\027t\211{\221fo\t\367;\356o.\r\307c)\272\334\226S\270\027"
+	.ascii	"Z|\357-?l\352\230J\270)x\313rr\235\321\322Y\376.k,:`YT\336p/"
+	.ascii	"Y\233\357}EH\030\2226+U\226\374\360!\305\375\256\362w[\273\371"
+	.ascii	"\240\311\311Q\302\275\311%B'\230\342{S\021\3221\346\264\305M"
+	.ascii	"\304&\205\312\216\355\005\367[\312\337j\275\366\002\257\271\307"
+	.string	"\315\031\344\371\336ih]\256DEi(=\254\3144\224\277\307\226K\034\2271q\270{\207\357\375$\335\333\273\362\325\314v\362\344I\021\253v\362\237U\335\204G\223&[\334k\265DhK1>\254\314q\277\227?\037a0H\220\224\341f6\337[I\245YVu\326L\320\364\260\"\207\373\315\204\307R\260\201Is\305\335e\276\267Y\212D\222\244\007w\207%\255\344J\214\f\231V\362\267\fM\266Z\325\313\310\275[K\224\244\221\324q\035i$\177\204+\250sC\324I\034\tY\030S\2141\221\231\321$i\f\243\024@ H\2144\037\315\272z\003\023@\221\007t\321,\317\224D)e\245 )(\324j\016\354@\321\302\267\332\301H\360\b\204\300\027o\025\244\334\220\360\303\357[\022\t\300\t]\343\005\2155b\177p20\013\355\213\373\230\354S\223>\345gr\260\027Y\354\270\271\021^\343l\217\236\265\351\257"
+	.ascii	"\316Y9\204\030\265\206\275\323\220\031&\244\brU\315\0318\217"
+	.ascii	")\212\254\325N\207\fA:ss\375q\376\255T'\363\317\341\016\306\022"
+	.ascii	"\250#w\312\2264\r\206\253QtE\220\340\361\020m\320\244K:\324#"
+	.ascii	"\214\266\267\326\326\txxt\263W3+)\305\270S\263P\214\002[TGm\370"
+	.ascii	"\331\326\241\315\226z\232\340\331\233\323\234\316\217}\024\""
+	.ascii	"\262\270#\304\b\022\365V\314\210\252\005\260\3520\334\"\033k"
+	.ascii	"\206\325s\024-\227>\030s\225[a\3035Q&N\306+S\353\037\256YVB\360"
+	.ascii	"\354%\321.\316p\"(D*\007@\372\312\200\215\377*\363\236\241O\307"
+	.ascii	"\343ra\r\207\177\233Oxr\236ZtDZ\024\t$f\276\241\221\017t*8o\250"
+	.ascii	"j\b1\024\306`h\343\213h\222~l\020\327\202W\336\250R\034\310$"
+	.ascii	"\007\206\201|\270\n\346\372\033\312m\024\300f\215=\217>\313\247"
+	.ascii	"\200\363\354\200F\207\317h\271\212]y\005l\231\353H\313\335E\345"
+	.ascii	"-z\215\277\334\003^\376I}\302\200O4\267]\f\224\016\200\327\351"
+	.ascii	"\322\016\016\t\216\255ZhZ\331\322A,\313NR*\351\036\t\352\325"
+	.ascii	"\022\263\250\322\216\020\006\342;\333H\323NR\231\327\261\214"
+	.ascii	"\225x:\241\376(\326'\"\277&\254b]\177\324\f`\244\024\330\013"
+	.ascii	"\206\2234\264D\025\346o\232\264\3163\270^\321\262_\267\216d~"
+	.ascii	"\305\245\207\212\260\236K'\260\f\270\031\026\354\304\325\375"
+	.ascii	"$e\333h\332\003\f\215\365(|\216f&\237\304\202\267\n \227\025"
+	.ascii	"\205<\334\373\201\213#\302\353\311\350\024\267\231\026 \034;"
+	.ascii	"\335\250\241}%]F\241n\032\311\212\232\243\221\376\001\300\372"
+	.ascii	"\214{K5v\037g*O\276US\262[\215b\037W\266mz\262j\374XYG\2570\305"
+	.ascii	"\357f\347\024\377\305l\333\364d\325\370b\277\234\216\007\211"
+	.ascii	"%\216\236\207\3729\230^\244I\306\257\252\374\331Yb\320\273\251"
+	.ascii	"\007\342\337f\237\213.%]zx)a\304\204q\242#`H\036\2168\335\372"
+	.ascii	"\276H[\246M|\235Ft\253\217\201\347\246\210\352\272\004\023[^"
+	.ascii	"\002?u\301\"U\227\307\261\005-\304;\210\360\201\352\ru.I\302"
+	.ascii	"\252\255j\022m\221\363\\\235\371\266\bR\220\331\256\214\260\303"
+	.ascii	"-:L%\270L*t\206\235S\375\207vd\036 \373\267H\276U\361\375\222"
+	.ascii	"\023G\216\331\320\027\241\f\312\206\234\023\006`\006x,\233\340"
+	.ascii	">\310\020\322\027if\334\023x\257\3445a\220B\376\017\300G\257"
+	.ascii	"\230\240\271\340\262:>"
+	.string	"\270\004\271\365\313vs\223(\210\n9\t!\341\316\210\340\220R\214\276\236s6y\235WPmESCZ1bf\030\225\272\277Z'\204\314j\305\375\017\2242\021\211)\201\007\220\360z.y\206\316 \205\036\370\021aw\327Pe\036Y=\335\205\004\361p\274r\tU\255\336\031\211xf\204\342g\210\324\331\350\357@\355Bb$\034^\033n\300\255I\255\2662\035\020\350\025\r\2136^\272C5\256^HVj\213\351\250\243d\313d\301\202\346U\324\366m\350\032\0217n\tA#\027\256\375\263O\343Wl%\243\271\371wn\004\316wQ\253\237CfY\005v\277\202$)\261#\247\017\227S\243\356\300\241dc^\325\304\244S\004?\374\025\344B\021\273\322e\004V\271\322n\341\001q\301\263\270\236\244\274j\216\316\272\305i\013W37b\021\307\246\r\017\322\362\330jGf\341\344\276\261^\026\234\225G\221\024r"
+	.ascii	"E\321\215\240\316\235\302M>\265i+%\204Z\370\177\303\240<\201"
+	.ascii	"f_\375\3432Ual.\332\201\203\003\202dC\341\221\005"
+	.string	"\342R\306\271\376\306\\deca7\362%\350w_\236x\211\267\254\203:,\204\354\342\b]O\347\024\303\325\2028\310z\254\222\337\210\273\233J'F\234U\361d\003Z\032k\317\310|\266;@;sLL\315*Df?HlF*I\332\352&]I\322\247.\243b\224.\2206\201nt4\234s\215Hd\027\222$\334{\227V\310\250CS\201!D\r.8B\254\231$\220C\255\265\343A\251\360\225a\013g.\034Wp\006KL\004\244\022~J\300\024\203\363\031\2235\025A\301\215\325$J\035zA\324\223\202\202\034\235@p>\314\267+\261\244.00\022\363\376\310\276\352\245\220\223\233\350\"xdw\330\276\362\330\307\t\020z\243\"bU-.\215\242\302\036wtR\341{\372\335\205\341n1`k6\fp{\374\275\300{\357\037'X9\243\020\227!^\242\227 \302\246\244\017\304\2503\373w\370\360"
+	.string	"\315d&7`\024\f*1A\334?(!\212\021\333\007o\314\214\317\322\004\341\007\"\233]\353\210\222\177\f\361\234\371\254\205\020\325\204\207\274\254\353\345\245\345 \026\220\27535"
+	.string	"^\217E\274\221\n\257DZ'\252\001\035\214N\223\036K\227\221\260\234\3551\360\304\221\fsBL (1i#\270l)\363\224;\036\340\203g,#ND\271bN\300b5T\365\f\257\3679f\030\251\0048\\\226_\372\373M,0\303\017r<s\237#r\205i\037}\217_\250\342\032\334\3010R\203_\237\b\322\007\232\347\344\017Z2h\210\037\231\277\">\332>\025+k\353\026\252\244]\224R\016\001"
+	.ascii	"^\001vt H\363\257\021@I*\223\343\372\276\304\fu\336\335\212k"
+	.ascii	"~\270A\246\365\331V,\331\256"
+	.string	"\021\021\214ak/I\316}&\220|\024Va/\341w\032\205\240\n}\365\337m\243\351D\311\367\305\300\360Y\343VQV\002\222\270\361\225\222\200\331j<\376\236\264\004t\035"
+	.ascii	"\207aUnX.\271\2326\255w\246\244\371\t\2330Xue\267\023\371\327"
+	.ascii	"Y\3579\351\337\021\036\347t\\\213\263\323\227\216\242\345\017"
+	.ascii	"(\342\214#\002\256(\371Up\350G\027NC\007\367}Qx\213~\322t\026"
+	.ascii	"\257Q}}\374\234\177;\327\247\276\340\311\215\350=o\261?\206\363"
+	.ascii	"\265\276\332\235\317<5?\271q\361\020\034\274U\236\330b\315\370"
+	.ascii	"akC\255s\231csR5;ou\354\321\331\233[1y\374\303\213\177\303\337"
+	.ascii	"\275\177\333\340\354\300\257{^\r\345\322\223\374l\311\3141\234"
+	.ascii	"\334\335\030\270\211\007\007\333\376\033\354\336\326\273\320"
+	.ascii	"\347\316\2775\2716\346\263\205c\001\277nn\265\374\325\270O;/"
+	.ascii	"\005\361\321aP\243\366\fx\263\373L\240/\327WZ\377d\374r\310\266"
+	.ascii	"]\021`'\366\002\347\3534<xy\257W\345A\205\2339\n\276d\376\263"
+	.ascii	"\t\347B\026\225\\\232\013\330p\351=#\366\335\276\254'\307hu]"
+	.ascii	"<\342\007\356\306\350\276\365S\221\357-8Lo\320\232\316_?v\f\216"
+	.ascii	"{5\277\220\307E\301\376s\271\fPno\372h\240\376\337\f\232\232"
+	.ascii	"\245TK\277o.\313\352\325p\212\367\250\377\030&\363\242\323\223"
+	.ascii	"\303\304aL8.\224wEu\342\325\357\030~\"\363\336\241?1\215\274"
+	.ascii	"(\266\277\275B\037\004\277\013n3\332\203\231\343\272\227\344"
+	.ascii	"\313\367\354U\363\243\271)$o\326\266\373\317\311]\2261#\033\327"
+	.ascii	"\023>\251|_>#r\327\206M\363;\254\377\"\377\302\363Gd\245$y\307"
+	.ascii	"\326\2065\313\373Q\021\255\270\234\224{\020\007\3663;\314\255"
+	.ascii	"\210\177\222\357\310y\031D\254\306\212\203ys\36667\024\3065n"
+	.ascii	"\357\335\253\222_\251q\315`&\362\007\332\001\027z\232\177\222"
+	.ascii	"\271\260\213\232\037\216\237[w\314;\207\333m\027~\034\245^\364"
+	.ascii	"m\227t\265~\177\t\277k\270+"
+	.text
+	.section	.gnu.lto_.symtab.50c8efe759273310,"e",@progbits
+	.string	"settingsBuildCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301"
+	.string	""
+	.string	""
+	.string	"valueTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320"
+	.string	""
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"lookupTableItermRelax"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"lookupTableItermRelaxType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"lookupTableInterpolatedSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"lookupTableOsdDisplayPortDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"lookupTableLedstripColors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"debugModeNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.50c8efe759273310,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
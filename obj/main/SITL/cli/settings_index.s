@@ -0,0 +1,378 @@
+	.file	"settings_index.c"
+	.section	.gnu.lto_.profile.a2f82d802440df2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a2f82d802440df2,"e",@progbits
+	.string	"(\265/\375 j\225\002"
+	.string	"\004\004^"
+	.string	"\005"
+	.string	"\375\312\310\250\006\002\002"
+	.string	"\002"
+	.string	"\001\341\254\317\253\r\024\002\001\002\002\002\001\003\004\002\005\006\002\006\004\221\261\246X\006\240\342\234\212\n\007\212\363\253\262\r\b\002\006\002\006\001\002\002\002\004\002\005"
+	.string	"\006"
+	.ascii	"m%\f`\273\322\346En\271;6\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.a2f82d802440df2,"e",@progbits
+	.string	"(\265/\375 M\335\001"
+	.string	"\264\002A"
+	.string	"\003"
+	.string	"\003"
+	.string	"\b"
+	.string	"\007"
+	.string	"\003\003\001\200\f"
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\b\001"
+	.string	"\001"
+	.string	""
+	.string	"\007\002\001\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	"\005"
+	.ascii	">G\204\n\267Q\271\201\3147\200\005"
+	.text
+	.section	.gnu.lto_.inline.a2f82d802440df2,"e",@progbits
+	.string	"(\265/\375 \311}\004"
+	.string	"\"\b\034'\200K\322\001s\316\022Z\234\200a;\371\004\021\315\270\304/*L\301\247\251\232\013\236\301zX\202\356X\027[I\334r\247\377Ow\003\341WQ\215\307R)\334\267\350G\262y\020\226\016dWX\037\007\200\337\021\211\236\201\024N\0069\364\257\201\231\316$d\370\356\n\303\237j\202\021W\357\265\232\231\031\275\205\023\366\372K\275\353\227(&\363\242\036\277\004\013"
+	.string	"0\325\306\005\3568f?\310\020\b\204u'\2132\327\305"
+	.ascii	"Ok\207\262b\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a2f82d802440df2,"e",@progbits
+	.string	"(\265/\375 \254\225\002"
+	.string	"bD\f\024\300%\035\377\300w\375\337\177_U\035\252\032\236!k\023\231R\252\264k\201\037\031\375r\207\261\257\035\215\322\246\370\224]\232\341\210\214\334\301/\024\n\001\f"
+	.string	"`\017\314\002\200\317\f\033\3220(\314\213\256\002"
+	.ascii	"\252\nJ@\230\304\345\314\3636\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.a2f82d802440df2,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\205\004\001\270\004\007\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a2f82d802440df2,"e",@progbits
+	.string	"(\265/\375 \2065\003"
+	.string	"\022\005\023\037\240'\351`\0372\377\327\346\342\013@x(\242F\\\013\324\330\262\036@1\350\333\376\215\020\271S#\205\222J\312P\270\t\271\034\214\006&\177\363\262\007P\274\235\332\247}\023\324\016\324\314<\022\304\"q%j?\202\006\017\313\345\301\177\b\t"
+	.ascii	"WD E\f\207\030\002\007\320B3f4\317\300\352\306\037@\021"
+	.text
+	.section	.gnu.lto_.lto.a2f82d802440df2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_indexSortGaps.8.a2f82d802440df2,"e",@progbits
+	.string	"(\265/\375 \211\025\003"
+	.string	"T\004|"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\001\005\001\006\025\001\007\004\006\n\005\027\0049\003\204\002\255\275\005?\202\210\200\300\001\1773\310\0014\307\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\r"
+	.ascii	"*#p\017\b\303\300\th\007\204\201\023\320\016\b\003'\240\335\027"
+	.ascii	"\221\006P\004"
+	.text
+	.section	.gnu.lto_valueTableIndexInit.9.a2f82d802440df2,"e",@progbits
+	.string	"(\265/\375`m\006\035'"
+	.string	"\232Gx\017H\200\332Q:y\270\016\275\251\247:\013\035\204\356Vi\332_a/\0322\233|Y\301\222;Dm\327J\231I$\314\257#\363N\t\035\"\206yO\240B\307\201\303$Z\322q\3128\372b\260}g\326\376\267F\310\336r'\031\343"
+	.string	"\325"
+	.string	"\351"
+	.ascii	"=\2674\225*c\322\300\366\313\374*|#\347n\345WI\307\362\261\351"
+	.ascii	"V\206/1\31445*\370e\237\355\267\347:\347\257"
+	.string	"=\200\363\267\346\222\230\321x\230t`B\244\2334M}m\204\231o\335lv\263\251\263\335\032\317<\2667\351=\336N\227\303\335l\350ym\327$>\225W\242\326\221LI\254\361\236Eq\f\315|l(\304\376\244\251\361\361cS\345E}\367\261a\220-a\325\001y\316j\310\243\342lg%\277|l\370\303R\260\022\345\310\275~\300j\350\243\336\212@\365\270\315\353\366\313M\232\024T\217\243[\267VgiRP@~\036\220\202\212\372\265(S\216*\036\221\311\376\2541\2277\276>\021\203\3256\321\361\276\361:UA2%Q\307+z!MS\256ND\250s\316\231?\202\23110_\255\314\254\342_\206\006P\245i\372\303\367\362/\027|%\277\\\004\243\336\351\227\017\343\374\275\223\232Rm\362\256\337U\252\216d\3118J\265\331'\232\250\260\356\"\263\261F\355)4E\250\270\247\230\r\0208\327Y\300\227\347"
+	.string	"<G\236w\256L\236{\317:\363\216u\336]y\326\335\312\271\2632\256V\276\235\225m\2662z+\237g\345k+\333[\271m\345j+\277\247o\b\223:bi\232\243\t'\035s\227K\256\374\271\376\345\237\374\221\177\326\217u\224\371\314\307\302\317\362\256{q\216\313\273$}\211dS\252\013n\320X\260\375\346\\\347"
+	.ascii	"N-\337\222t\256\031\027\20264\250\245aN0\332\224b\320$\330\222"
+	.ascii	"\374\255\2603-\376\025$\r\246\031\323\301\221s\277Y>\001\266"
+	.ascii	"4h\377\212\331R\2516\317v L61\t\326\346\311\234ea\301u\221qj"
+	.ascii	"\252lg\347\266\240\241\275\316\351\247\235\316\351>#s\024[\252"
+	.ascii	"k6M\323\364\20663\233\370\331\020\002\2523\267d\227\223Zc\t2"
+	.ascii	"\365e\353\"\203xY"
+	.string	"\210\007ei\272\024\201\231\217N&b\001U\231\233!Q\342\304\211\363W@\0170\273\n\320\267w;\324\2408\231!\bec\001\372^\257U\240H\2110\026\006\t\332\305\336\351F\nS|\f\222-M\227~\370a\027\003\262A\277\337\371k\373W^\3038y\263\034\303\022\236]dTi\273s\277]\344\035X\033\350;\245\362\323\256\2731\204-\3255\256\335}a\034>\330\303 \331+a!\340\t<\177k\0278\302C\2516\217\202A6\331.\336\347\334\265\201\336y!k\212\n\326&\277\003HFGD\277\373s\001DdY\374\005\220P\013\035x\016b \343\247\202\bx\"\206\020\021\360\350\350\027\303\007l\021\344#\002\002\271\360\005\031\305\3601\350\341\242\027?#\337QQ\221\221/gL\337Sl\233\f\3370\225:\310\377\206\223\377\346k\033\370J\230C\207\016T\236\200\210V\2245J\265y\244\327E\206"
+	.ascii	"\266\343\351;\345^\314y\375\344s\362\372j"
+	.string	"\3073(W\031&\274.2\257y\372\307\333'_\311jc\327E\356M\311\021\350\273v\356t\257\237z\235\303!9\276\002\322\207\225\256\213\314\270\234f{\313i\035\230\367\232@\177\353>(bMQ\301\025o3T\200\212\215\206+)5I\256\213\254\340\270~\233c\030O\025\320\267f\366\360\241\336\t\327'\016a\352\032j!\336E\3644\021\021\312\230\267~\227\331\025\332\266\276\321\321\206\002y\250a(\344\024B\b!)!\021m\322\254\001p\002\021\252\263y\020X7T\223Jc\"5t$\017\310\205\341\245\334\310\022E\262~\243\314\035\237\363\024\336\200\362\216G\017\210>oE\377c\261\243a\027~A\001\351\242B\316\317l\216\013\023\326\231\037\225\226t\005\r\256\223{\375i\322\273\2214\257\216\257\325\202h\327\367\220\302{\205\366B\"b\303\036$\250!`\354\330\245\006\304;h1\344oT\006\377\007L\356"
+	.ascii	"W\001\243X\026\226\237]\257\371.bm\2558\261\037&\356\321Y\206"
+	.ascii	"\007\274\272)\373\303\336pF\037\326\f\215\234gl\213\252\342["
+	.ascii	"\203\013\3609\"f\324\331\343\363\2148\262H\211B#/\230\352\016"
+	.ascii	"\004\343\f\255\200\003S\323\276\211\327\n\335.\365\f\353\207"
+	.ascii	"1\330\024\353\243\305%\033\017\b-\204\332#\371\233o\366]lu*\306"
+	.ascii	"\323\372\222\273\3748N\302\275\300{\224\235\300\356L\013\253"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_compareSettingName.10.a2f82d802440df2,"e",@progbits
+	.string	"(\265/\375`\206\001\345\017"
+	.string	"V\036kF\360\224\223\016X\312S~\265sP\230j\025\256\032"
+	.string	"_\332\321\237\215\332\340\307\033\332p\001wt\346\307\0325D\272s\232\006h\215\277A\223\236X\367\017n0\336t\347\n*\315\227\t~\320\213\226\2114B\266\224)\005V"
+	.string	"X"
+	.string	"T"
+	.string	"\317\034n\266}\026o\361\331:1,\001~\\0-0\206\354n'z\001\355Y<\001\355\231\222\370\367,j~~\353\031\004\031\032. \210\307\310\300\004\217\036\021db@\340+5"
+	.string	"\270!\212v\367\261\347\013\350\312\374\220\354\256\323\005\374pk\267-\301\266\003\373:\001\267\3713MG-\255Og\226>"
+	.string	"m\205\216\020\220\335\016=Fv'\263\201\3429\277\375\3711\203\374\034\225\255\345a\213\361p\b\262\273\006\236\271\301\206\303\n\t\330\327\215\210\005\2326\002\005\337m4Xwg\210$x\332w\361\027\337C\326\007\354\302p\324\330\r\017\270\333\002\n;\321T\257\342\346\207/#\303\311v\302g\351_B\244\306\034,)\\\331\363\334\335\226\252h\234\206`xn|\274\262\210\271\274n\372Q\033e!\357\302\251\210E[\316\364\372\330c\220\030!-GV\262\307\016[\2514\366\343*\314~\316\315\035\347\337\036\376\237+\323\005\225\227z"
+	.string	"\252\26029y&\315C)9E\223F\030<\n\247\322\004\225\311\251\264Zy\252\256d\"u\247R\tJGJ\251\272\221\310\250\024/\325\255P\250T\007\262\355p\037Wa\316\3444\245f\206>\306\037;7\242f&\216\036\365\305vT\223\254\250+S\032\337\330\261\023\003\036"
+	.string	"6\203\fA\323\324\013K:\2669\211V\224p\276\304\226\331]\202\266KXX0\325\"\330Rb\201\353X\002\272\206\373\321\006\204\330`\030\254\370\f\001le\030\f\3433"
+	.ascii	"0B\240\302\301]I\332\340\020t\270\252?\315\3057\241\224\001"
+	.text
+	.section	.gnu.lto_valueTableFind.11.a2f82d802440df2,"e",@progbits
+	.string	"(\265/\375`\255\004E "
+	.string	"v\273\321G\200ZR\0079\354\263\033\262?\005I\304\307\367\300\376!h|'\026O\324\325/\333\257w\366\217z\244\253\346\317|\022\251#x$\331\243\204\230\026}\271\310?n/\251\342\337\343\211m(\357\230Imv\357-\245L2\245\274"
+	.string	"\266"
+	.string	"\276"
+	.ascii	"\267%\240~}\254\255\335\r\036$9\022\027\3759S}qPk\267w\371\221"
+	.ascii	"$_\276p^\316Ve\315\234\227\013\272\207\372\355%\352D\274HR+\325"
+	.ascii	"%\026\024\366\362\321\364\345\226\363\262\267s\034\354\267\372"
+	.ascii	"\r\366\373;\032\327\351+y\016\227\242\272\023_\373U\251}\311"
+	.ascii	"sSL\030\025W\245\224\362T\2072\312Q\243R\312uY\240jx\020(\033"
+	.ascii	"\365\314\021\307\332\252\224S\216\355\004'3\236\002$\233l\365"
+	.ascii	"\321\245\315\233^\221Ic\275\316\364\njE\332\252\224Qne\370[\004"
+	.ascii	"lL\310\344\222E\213\363\244ut\246W\247$\261\326\023(\347\334"
+	.ascii	"\365\230Tz\003\360\356\346\322\335\036\272-\212\355g\336$\330"
+	.ascii	"\236\325C\277\352G\277\355?\354\327\337\231n \371\304L\r\246"
+	.ascii	"\372\326\275\\\252\177\325\355\007\264p\035\373\255\272{xvt\234"
+	.ascii	"\314;\007\307\227\356\002\034\211\373\215\227y\333\270\231"
+	.string	"7oW\323\265S\007\363F]\314\373\264\265q\255}mm\213\253\375i\355\212\326\366\001\247\220\264\036.9?\275\241\311h\367\354\207\223\271\227\271\233\271\203\271\213y\267\217\265+\361%\3364Sad\203\227\t\321\334D\235\210]l\030\310\220\306\324\216\260\345\234)\240~\275;\251=\314\231\235\023\373\361)\356r1\007\027\020\240$\376\225\344`?\350\022\024\032\3465\204-\347e\002\017h[a\256\315\367<\262m\214^\230\260#\341\234'\340\264\303\253K\201z\037\277\200\357\266p\241\3721\347}\214\277\3247\217\377\265`\360\264\fn\206\225s\021Bw\257p4\r\036\266\226s1\302\025\307\262\301v\370\200?`\277\367\335\214G\227\315\333o1\3656\302\253(\365\326r\316\021\332\2478\025\020\355Y~;\204\210*\002\373\265y\307\022u\246\300\377y\377_\3064\350\237\377\357M\2773\246\304\030\251\210\365\355\301\340"
+	.string	"\342v\353\327\2747\245q(\036Eh=\253I\004\341 \354\267\376\247Y\341\2625\265[\310W\375\330:0+h\304_\322)\235\336\376\257:\210\375Mxy)\3263\035'~F\357\342h\b\364\335a\021\222\320w\204Y\004\213\236h\350Gd\211\206C@_\021\366\031\225"
+	.ascii	"\332\026b\320\302w\002\370\013\022\016\001\177\303\241O\330\373"
+	.ascii	"\025\t\365\200\277\022F=\241#a\217\201O\007S\370\216z\303`\360"
+	.ascii	"\250\227[f\177\253f#\242\205\253vk\013\356\3714\375\006bzbN\307"
+	.ascii	"\373Nw\036}d\353\316o\233\356\376\304\2121\306\335\346\2343\316"
+	.ascii	"\242<Z\266\346w\036i\305\025\006\325A\335\266\250l\373\017\336"
+	.ascii	"=\262!\320\220\322#mz\212\266u\345\344=\316#\333\236\350\363"
+	.ascii	"\270\377`\234\327y\0166\312\360\202\334\270\201\3723\327t<\321"
+	.ascii	"\275\225\232\347|\002\247\037^U\212\365\f\025)02\347_\265\007"
+	.ascii	"W\250a,\243\2103\312\020eH\202\031Z\330\024\033`\002\031:d\035"
+	.ascii	"\020H\311f\233\341\334\024\020/+\215\r{\251\250@sr\325\3166\307"
+	.ascii	"60\021\031\314\0372\004+\236\032\336\376PM\267\034k0$\201\264"
+	.ascii	"\306{%\367'^<\2469\001\317\302\007\r\264\207h\300m\030\271\025"
+	.ascii	"\253\007\361\013N\b1\203\361\373\367\360\036\030\211\235\227"
+	.ascii	"\022\037c\212\200\2356\3427\272`\240\205\361\232\365\037&3\204"
+	.ascii	"\202Q\023 '\220!s\253\026\03064\271r\234r\013\300j \031\275\256"
+	.ascii	"\007\347\2458\026\"\250\361C\035\330[Q@\225\241\213\300H\346"
+	.ascii	"\240\235j\366\221\362`\222\267\261\031\374\317$\233|S\376R\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a2f82d802440df2,"e",@progbits
+	.string	"(\265/\375 \324\325\004"
+	.string	"\224\007\320"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\n\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\006\t\177\f\250\246\354"
+	.string	"\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\005\f\r`\r\016\b\017\300\204\001"
+	.string	""
+	.string	"\003\005\016\020\007\021\002\013\177\022\212\271\345$\001\020\177\023\377\037\001\220\316\200\220\200\001\017\177\024\003"
+	.string	"\bD\003\001\t\311\302\353\343\003\001\244\013\003\007\001\377\216\222\f\001b\003\007"
+	.string	"\370\260\241\355\003\001\202\007"
+	.string	"\f"
+	.ascii	"'3\f\237\"\034\3620\274EpW\007\241\363\231\203u\236\007\215U"
+	.ascii	"\226\347\371\206^\247\023"
+	.text
+	.section	.gnu.lto_.refs.a2f82d802440df2,"e",@progbits
+	.string	"(\265/\375 A\205\001"
+	.string	"\022\004\013\021`\211\323\0300\f\\\325P\214\372\342\177/ir\247\237\232\330\205L\346P\022\f\035\214\n\352\300\006\214\036\265\261\213r\2217\242\363B"
+	.text
+	.section	.gnu.lto_.decls.a2f82d802440df2,"e",@progbits
+	.string	"(\265/\375`H\0235`"
+	.string	"z\243\344#T@\022\"\245\003\372\0207:\265\340\243\250\035*P\240\304\203\250\372\024\017YP&\237_\237\362\026\344\361n \301AP\031\005\355\177`\300\026\254BYgf\335\337Z\306\256w\213\2202\263\271\266\366\2449u\245\272\266\031\030\337\273\242H\3410\214v\221F\210\224)\351\001)\002,\002\374f\317Y\354\331\212\005\002H\275\n\263\206\263\354[\2541\261hc6\236\242\317=\262\341X\336\313$\303o\\\206\233\354\306>\234\303\260\230\363z\317`\277\212\177E\013v\343\037\230\r]\227\3678F\t\002j^\230\314\342\356e\n\t\001\t\355\324\226oN\233\236\235\354\211\366)\330U\347\351\251\210\262\323\237`_\202\005\342\037\025\365\302_\270Y"
+	.ascii	"\203\331y\223\365\206M\247\377\300\236\013P\371\311\005\250\327"
+	.ascii	"\300\376\2055\301?j\372\305?\252\026;\006\216*\255\323G`\377"
+	.ascii	"\200}[\034\377`\341\342\266%\025Z\331\025\034'U[\247\347+?Wa"
+	.ascii	"+\367\212\361$\351Bu\326)_\376Q}x\204\312<\2508\223\215P\241"
+	.ascii	"\246\326\373e\300\230\231\225Nqx\304\230X\002S\214T\235\212\205"
+	.ascii	"\261\022\352\"\357\275$:j\213SI\247\314d*\334D\301_g'\203]g\\"
+	.ascii	"\357z\357\332\323E\3348\273:\365\341\037\265\031\260\377\275"
+	.ascii	">B\355\2668\216=\243P\321\347\223Qt\241\260\310\262\260'\235"
+	.ascii	"\376\314\365\363\026?\341)h\322Iy\277\356]E\364lI\341`d\355\331"
+	.ascii	"Ya\303dG\247\034\205\245\234W\206\362\025-\216\026\271\356\223"
+	.ascii	"{/\257\r(\3575\362\332\323\346^c\017\363\t\346\023\251\226\225"
+	.ascii	"\016`j\372\266_\371G\265<B\375\231\202$W\260d\300\337I\376\257"
+	.ascii	"?\033)\375\227\362\337\204\237o<\304\337K6\212?+\360\363\375"
+	.ascii	"\271\203\237=\210\001\206\027B\370\217\342\177\002\377\345\330"
+	.ascii	"\205\023\360w\216\2377\370\317\177\377\370\271\205\237\203?\223"
+	.ascii	"\360s\214\237?\370\031\306\317\032\374\214\301\317\026\374\374"
+	.ascii	"\342\347\007\376\203\375\017\373\017\346g\b~v\361\277\354\377"
+	.ascii	"\225\377b\377\271\376O\371\377\363\237\313\177\335\363\371|\376"
+	.ascii	"<\365\2430\376\236\030\001\307\265\310\313\333V\005e\231\305"
+	.ascii	"\3652\232\035f\221)\247~\322Z[gV_\235\266VwVo\275\265\332\211"
+	.ascii	"\016\262\265R>\301\303|Bgv\304\330\245\246O\215\330\277\233\364"
+	.ascii	"\016<D\316\316\226:\335\341LN\200\272H\035\260\035Xr\350t\t\320"
+	.ascii	"\316\310\\\223Q\210=?\301j\034\230\r\214\355\210\016\275\354"
+	.ascii	"$\255\244\221p\263\261zH\347\320E\332Hr\013\026w\351\033P\346"
+	.ascii	"\262\203%$pg\234\205{Pbs\302fX}\204\303P\346\322.5\263\032\253"
+	.ascii	"\257\230\013e.wLWF\204\200P7cj\\:\351S\032,'\371G\025\321D\376"
+	.ascii	"]N\2275>\226\235>\235\301>M\332\247G{\364\215m\033\326\022=\315"
+	.ascii	"#\310\2522\326\f\257![\242\202kc;\205\261\375\360\321?\232\315"
+	.ascii	"!T\235\243\247\226hh*Nc5t]\3424\257\202\300\335\2736\025\217"
+	.ascii	"a8t]vp\005DH\007i m\3255tU+\271\331TGRq\\\027\311\330j\200\273"
+	.ascii	"\367\n\225\020\342)R2\300\371\0045\r;\344z\231\27354T_b\354\321"
+	.ascii	".=t\230QG\234^v\0077\233G\313\2206\217~j)t\n\224%\243\"\327\323"
+	.ascii	"\004\355I\2174\355\031V\326:#\005\327\351Q%\266\241:\212\233"
+	.ascii	"\255\343)\227r\335A\215<\272\220\005\251=\317\347\363\311A\352"
+	.ascii	"\321!\366h\224=\312d\233zx@Qr\023g\317B\256\225\274,\357Ev\222"
+	.ascii	"\333\264\022\323\2306\270{\221\377\033G3q\263\223\275$$\004\224"
+	.ascii	"\003\005K\223\2465\333\307Fr\263D\337\340\231\013\363\264&\315"
+	.ascii	"\302p/\227P\371\371\344\022\352;K_\247\2223 P\254\033~\303M~"
+	.ascii	"2\2333\027F{\257\3672Y\310\361\034\217\321\347\"o\270\361\223"
+	.ascii	"\333\360\034\272V\261M7\312\300\335\313\004\022\022\332\001\342"
+	.ascii	"\030E\231e\337A\354\272\206\250\002\304)\325\351\373\207};\331"
+	.ascii	" \276\242\305\223tN\251eN\215M\303h\306\270Q\303MN\303g\276\242"
+	.ascii	"\205\020\020\016\224\225\234Y\232>X>:\3551\350\223\361\315L\213"
+	.ascii	"A\323\254\302\034;m0\255\306\315s\3510\347\271\262\344\344\322"
+	.ascii	"d\037\003\237\213\332io/Q\314\224\324\243m\264w\227\177\3078"
+	.ascii	"\310\360E\355\215\375\233\313\277\3231c\204G\016r\366\2722ff"
+	.ascii	"\255\205\203\230,u\\N\314\316t\226\267\026\016\34325^r\235\366"
+	.ascii	"\031s\365h\251]\001\321Y\005\341F\226V\306\315.k-^\357\023\016"
+	.ascii	"\216*Pk\212\353\234ddm\205\271n\221\347\352\253\206\024\352\221"
+	.ascii	"7\245\035UB\364\220\222\022\325\351\222/dQ\314\251\024\305\236"
+	.ascii	"\263\270\305\232-\326c\272\344M\311\33454'\027J*\305\234\216"
+	.ascii	"\207/[>\226`\315\006\3439\017\370&\233\330\242\300\335\213\226"
+	.ascii	"\202\2238Q\222\343\307\327\027\2135\327-\346\\9\231\332\304\335"
+	.ascii	";\225\002'\nK\326\231N\257k\242B\245\275\354z\2378L9\025\324"
+	.ascii	"i\316d\0305o\2577\235\332\022$`k\354\033JGyKi\266\224\356\332"
+	.ascii	"M\335\242\031\006\222\254khqw\n*\350o\256w\327\315t\bP\247dq"
+	.ascii	"\353\352\264\2470\227\332\243K\217g\247\275\262Z\210-)g\223N"
+	.ascii	"\257\206w=M\3304\255u\331\277\177"
+	.string	"\365^\035\272\365B\035uT\3261\007\375;\2142\002\377S\364?\320\013\367\026\233C\322X%d\306\037&n\320\275E\250$\263\252(\"\3114\336$\225/Q\"\222\353\025B\3422m\270\311UYL\225\305\276\353EVE]\244\262x\224\\/\324]\225E\237\213\214\362I\256\306b\222Y\025\305I\2462J\304E\336\342E\032\205X\2442*\211\246\214\362I2\215QIdU\024\337Uy\031L\331ZUT\272L\343\316\275\327i]\026u\3565B\335\242Z\347\270Up9.\220\313_\262V\033\356\275\367\026\277\332\254\224\273\365x\277$\227(i(\335\333vs4P\344\342z\357]\272\307\"\337\253\264B\335{T\2360\245d1KPw\347\"\215NG+\245\216\322Q\271t\227\b\341\250$\323J\251\302\212\027sy\003\304\340\017%\006\177&\222t\206D\244\234!\237\214$`/\370\033\032\"%\r\221"
+	.string	"\002\223\202Aa\020\207H\344k\341\207\244\262 \034\322 \n\20383x>`\352\033&\035\245GF=\037\022\257\027\034\022\221B\310\b\376,\340\261!\203\347\003!\007\351\210w\001q(\214\261C\f&\t_\330\030\022\203\025\004\320C\374\0053\ba\304M\370\214x\034\304\360\ryGF\302\036"
+	.string	"\357\375\206\276\240\257\310\276\001\027\n\270p\240\006\016P(\244\200HG$\372\220f\314\020\2522|*\364xG*\022\321\n?`/\307g\304\013\246\276#\033\304\224\230\004\344\215\360\003\366|\210D+X\324\340\301X\301\"I%\372\210\200"
+	.ascii	"d@\314\361\001Q\340\205\260\301Q\222\nB!P%\212\300Q\2115xF(\214"
+	.ascii	"\340\017\306\017\330+\021\374\031\2412|\301\242\037RP\204\032"
+	.ascii	"<\243\340\317\210\207\250N\360\003\366\004\260\301\033\016y:"
+	.ascii	"\342i,0\300\205G\276\341\020Q(\034\016\205@*\342\001g\350\220"
+	.ascii	"\210^l\020\343\007\354\221\b\376\214v4\210E"
+	.ascii	"A\037\260\006\317hW\024\374\r\211H*\221\310\001\034$\341\021"
+	.ascii	"\361\207\202Z\364\233\021\024\366T\"Q\260\350H\027,:B\211D.T"
+	.ascii	"\020\203\277${\025*^\230\020\201\203\013lo\201\032>\031\301\037"
+	.ascii	"\021RQ\360G$\372\220\206~\300\336P\360\3073\032\352\r\221\206"
+	.ascii	"\0268`\310\243\321Kqt\245fx`q\203&\275R\247\217!V\350R\277)\333"
+	.ascii	"\350h\322)zD\221\334\274\031z#\215m\255\r\314\326\300y>\237\317"
+	.ascii	"\0375\316\3650\221\020\361\261\206\230J\216EA\257\025\236 8\236"
+	.ascii	"i\317\036S\217XW\210\274\341\271\335\362"
+	.string	"i\354\254\333\254\314\2550&_P\340\336h\340z\016\375A\202\353t\213>\3531\214\333\222\307\311\225\035<\324\274\347\336r8N\037\230\334:\355\2705\035D\032\346\"B\245l\252\317\264\031\025\313ny\177\331\322o(\032;\245,\232a@J\362L\232\270\233\234\n\312\03132\213l\357\267w\031K5\204i\253\323v{\223!\202\306+\371C\223\371w\273$nbot\330\366A\201\246\232\023\322\246m\210\332\021&\2356\337L\3555\346\272\263\031\201s\250\241,\210\0244#\"\"\"2\222$I\007\361\004\204((\261\264\016\021`%c\312\224\214H\222\222$\215\001.\304;\266\370\370\001\037\r\365#\016\214E\026\277\227\201\036JN\235\320{\221\\Ox\345K\261\323]\246;7P\023\206\234\347\371\254\203n\327#\276\210,\0200\221Ab\021\323\353\315\373\031\226\005\264P#\366\034\f\204\316\026\fT\301x"
+	.string	"\322\245\0039\002\027K\360\226%"
+	.string	"\211\242k\310\016\0205\200\341"
+	.string	"C\333\004\021\\\255\0055\357\215\317\376\375\377\202(\335\237\274\263i\211\277\324\363\023\nXEB\003\315V\240\263\306\r\\\325\252HU\336(\200o\200\253\003 z8\367\02358\307\020\367Q\n\220j\034\227\322\321\\\tUE\227\255n\311/\013\r\216\362\203\234o$G\271\025Qh\374J\224'\245\341\315"
+	.ascii	"\223\202Z\377\b\325\3766\374\363\240\370\334\306\177w1\314'\325"
+	.ascii	"\235uUS*/\273\240\223\240k0\235\2043g\205\373\257u\342\236Z\244"
+	.ascii	"\334\373\345\020\245\331\3340\232C]\324\273M\271\347\022E\273"
+	.ascii	"5\3269\306:\261\2707 ]p\337\275\302Z&"
+	.string	"A\307P\356\f6\206\201\232\311\324L\241zu\t\356.\333p\034\252b\266\361\370Y\376\365\005Y\261\226\265+q<\211\303\274\356\201b)fm\267\212<\3042\3701\343\247~5z\225\270\270T\177\262\216\207\243\247\303\206(>\217\210>\307\025\254\210\322\345\224X\244\225F]\304\246:\214\202O\211\022PO\373$2\340\341\333\264\354!4\216?z\377\250\021\216\235\177\235J0\tK\333\342I34\357af5\n\317Y\341h\266E\b\001\304=\013nx\343\025\f\276\277cQ\016\037\004\303\362\225\327g\247S\354\244\333w~\215\337\332\034w\203\030\f\227\036\007?=lqK\200\237)\311J\236c!\002\0227\023\377\231\227\342\255\310\b\003\005<\257\2046\tv\305\307A\363\r\212\237\243b(c5F\356'\037\372\224\226|6U\nT\b\217\265=\267\362\214_\\\006\352<yp\250fc<\362\217\030\321\250"
+	.string	"\363K8Nk\270\377\234\374\221\350\260\033\237\023\352\003/Z\261\236\0210Z\326\274b\255\326\300\353\0030\236\322\325\260q\252\025a\222T\006j\004\200\016\374\224\t\314\311;\030\202$e\355\312Ws\n\314\022br\037)mt7\232\024\363\276"
+	.string	"\223\337j\334\220\236\277<\016\226\301<\007\267N\306v\004\212\205-d\2029\037"
+	.ascii	"\227\321\3504 \233(I\221X\336]\0232\264\f\312\265\224E\025\375"
+	.ascii	"8\272\342'\024\324\026\336\336u\365\0235\022\200\320V\242C|\267"
+	.ascii	"\341W\307\f\013|\304\357\371\225\254!r\264?\256\335\255\334\367"
+	.ascii	"\3512\230\307\375\366\367\366=\357\267\032n\264W\371qw\273\355"
+	.ascii	"\267\344\257j\321z\312\034%~\365/-\370e;\353\017\301V\270*"
+	.text
+	.section	.gnu.lto_.symtab.a2f82d802440df2,"e",@progbits
+	.string	"valueTableIndexInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"valueTableFind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"valueTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a2f82d802440df2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,350 @@
+	.file	"bitarray.c"
+	.section	.gnu.lto_.profile.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375 lM\002"
+	.string	"4\003`"
+	.string	"\006"
+	.string	"\227\346\274\270\b\004\002"
+	.string	"\001\346\223\345\213\006\002\277\330\227\230\003\003\330\313\241\243\016\004"
+	.string	"\002"
+	.string	"\004\343\304\327\323\002\006\002\001\005\320\272\226\256\013\006"
+	.string	"\b"
+	.ascii	"\200@P\301\3446\201fz\252\226\331L\016\243\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375 g\225\001"
+	.string	"\370["
+	.string	"\006"
+	.string	"\002"
+	.string	"\001\001\003\002\001\003\004\004\001\005\003"
+	.string	"\001\002\001\200\004"
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.string	"\300\020 "
+	.string	"\020\f6\006\005\273\024\f2\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"]\005"
+	.string	"R\310\032$\200\265I\007s\342$\2512`b\304\t\356\210L`\363h\215\220\t\221\021]c\213\212\337\261\271Y\262\345N\001\317H3\022\017q\"\342\205\035\206\362\020\022\336\266\340\243\215\016#\337\274\f\242\243\242&\003\177\204f\266A\004\250\250i\360\272\243\262\004/7\344\353\207\215\266\2019\035\276sm\233\254\377h\244\0317\005\003\332.\237lT\030"
+	.string	"o\033\"m\305"
+	.ascii	"Qn\002| :\b\274\313\371\213\\;\260N++\324\0047\305\036X\252\006"
+	.ascii	"\025@t\340c0\355+\201\001(I\220\200\247\340\252\216\f\312\026"
+	.ascii	"\226^y\256\245\201!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375 \201u\002"
+	.string	"b\304\f\025\260%\351\f\303\200\226$!\264%\211\3430\340\0245\"\267L2\222\230\231Y+\245\216Cs\254Ur\353"
+	.string	"\277\004\t\317?)\333\312\267\312*~\n\024\b\n"
+	.string	"\315\244\361r\233\322\230T\022 ,0\2223"
+	.ascii	"04\227\3617\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\001\205\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375 \312M\002"
+	.string	"\264\002\276"
+	.string	"\006"
+	.string	"\002\020\001\002\006"
+	.string	"\001\002\300\005\300\007"
+	.string	""
+	.string	"\002\003\004\004\270\006\274\006\024\024"
+	.string	""
+	.string	""
+	.string	"\001\002\002"
+	.string	"\003"
+	.string	"\005\003"
+	.string	"\274\006"
+	.string	"\013"
+	.ascii	"G\\%\f\003/\217\350\204\034\252\271[5#'b/\035\354f\300\fd\003"
+	.ascii	"X"
+	.text
+	.section	.gnu.lto_.lto.aadafe16190a0463,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_bitArrayGet.3.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"]\f"
+	.string	"6YV@ \217\223\0168B"
+	.string	"\030D\2610\2448\020\004\243rY\340\212=\275\021p\271\345\\\315\3721\204\372\342\371F~\221u)\031\037\020\020\210\300\366\324|*\303\240\233\220\003\262\271mD\332\336;\311\224\002F"
+	.string	">"
+	.string	"B"
+	.string	"^\251\013\003\310LQ1\221\231-(\007e\327\314\003\236\035\345"
+	.string	"\317\256m=>D\035\021(9\213\020&\022023\353\032<2\216j\217p\363\340R\302\344d\304\230a\220\231E\223\223\n\356\335VA\333\217\326%\001\336\230\305\326\034[\035K=l\346\330w\254s\330\326\260oX<\326\031U\006\001-\231\024N0\251\302\235\340\320\326mE\355\246\3553\213\020\231e\243U\346\205\024\036\224\235FCl\r\302*\242\007V\230P\334\022A\204\332PCxv\356\236`\341\337\274\335\245\017\315E\361\360\377c\224:\220\360T\037oS\f\t\236\352\334\227\247\271\337^\224bHxj\263\021<\206\326-3\263Oi\213\345x\305\001\241\017\310]=\035\022:\030\326\t}@\254\220\013\004\272<V\310\247\003\262<\330\003\253\003A/\007\r0+t]\230\265\311\322\345\\\203\344\244\326\"\257:\3476\271Pw\257^\240\205\t%s\352\235\303\231\033x)\301$\360\306\323\374=\022"
+	.string	"c\221\"34\030\361g.(e\035\354 \003!\255\221\2568\315\262,1e\007hZ"
+	.ascii	"]\346d*\374\246F\301e\210S\023M\327|\002"
+	.text
+	.section	.gnu.lto_bitArraySet.4.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"E\f"
+	.string	"\006XS?\020Q\234\016Q\323\261[M*Pt\245\235\342\200B\373\247 \222\3660\223V\360+J\001\261\036!\355\311a\232}C\344\207\031"
+	.string	""
+	.string	"@\021d)F\243\275\352\276\036\323\240h$Bv7)S\n@"
+	.string	"<"
+	.string	"@"
+	.ascii	"O\261\275\344\032\017\260K"
+	.string	":\361b\327c\340Juh\357\004\342au\001\361\320\233mcb\301\303E\307b\307\356b\032\342\333s\363\277\342\226h\364yR\017v\327)\032i\270\365\266\027\330v`\377B~\351\2772-\371\307oe\272\3124\005\3231\3230\323\323\224VM\247\246\017\300\3121\340\306n\206OdA \f\022\266\177\331N\357*\266\177Pl\355~\220\321\240:T0=\355\243\b\n\325@H\307\341-&t\252\335\375\b_\202\036C\207\324KU\317\231\230\356\031\361\232z\256D(?K\364\372n\004\224\237\341\035#Z*Q\252\202\016n$\224\237\355}RA\330\237vw\255$\007\036\rF\2413\026\n\027M\273x4\030\214\223m6Y\006\343h.\033,\243u0\013\002g\021 h\230'\3134\354\362\366\323*\311\320\003\bHC\256\364\200\210\213pP:i\245\223\220nCTJ+\217Z\200\006'\222\340\224h\005\026"
+	.ascii	"c\221\"\023\357\304\321\360\350M\034f\242\007\025\026\301\032"
+	.ascii	"c\320\243\325\222+\3723\315\222\245\366\300\314\005\221\013\237"
+	.ascii	"1\314\313T\370M\215\202\313\344\324\350p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_bitArrayClr.5.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\235\f"
+	.string	"\306\230U@\020\2176\035h$\263\022\200\240\302\221\253@.[u\315:Kf\227~\021\241\210Y\301\036G?B\332(\332dN\270\365\301\036"
+	.string	""
+	.string	""
+	.string	"D\200r)A\253X\327\007\022\353`\215\236\232\320&I\246\024B"
+	.string	">"
+	.string	"B"
+	.string	"\365\007\203\330|\322\025\007\310\024u(\221\331%hG\345\327\316\031\223_e\001\223_\267\266\205\006\tF\005\227\002#3\261_\360f\334j\213\260\005*\0211R\f2\263\b*\241\340\336m\021\264]\320:\024\242\326'6\006\261\227Q\354\013b-\304V\017K=\354\204\330\207XI\302\376X<\326"
+	.string	"\256\021\031(2'\214XR\345\231\320\320\326W[\354\034b3\nG\255\314\n)\024T~\007$c\003\006\3141]\376> \006\0272\t\b!Uf:C\375\340\226`\202\307\374\367\207\203\344\256\230|\274?\033<8\352u\337\\\313\b\216\372\334\023\323\345\327)\022\026\237\026\017\216\332N\004o\241\265\224\231\331\007\235\315\307_5\036\0212\232\226\351l>0\220\214\303\3114\030\310&\303\3014Z\b\346Q\240\231\203\006\032\326\3112\r\273\272\264\224\027\365yP\031\271\247\326\t`0\310Eu\351\3265^p!\352\325t\352\033)\234\311;<}c\345\303\022\027"
+	.ascii	"c\221\"\023o\306\321\360\350Y\034\306B\017\236\213`\2157\036"
+	.ascii	"\037\203\034\255\221\\q\037j\214,e\007fZ\250\\\343\214a^\246"
+	.ascii	"\302oj\024\\&\247F\207;\274h'\031"
+	.text
+	.section	.gnu.lto_bitArrayXor.6.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375`\335\001e\020"
+	.string	"&\336jF"
+	.string	"\257(\035\300\\w\262V\24610q\027C\0375\357\035\350q%\006\256t\357\\ \335\003N'XU\036\35157\265\376\272\223\320\356\321\243\252\252^\222\212L\320\016p\235\001\230\341\305\026\372w\0035B\366\2262\245U"
+	.string	"U"
+	.string	"W"
+	.string	"\007<\227\006\317\261]z>`\273t\313\206\321\361\002\255H\231\311\230sv\233\241\245\021\274\243\266.\343j\313\237]YX\300>\223\313\310\275T8"
+	.ascii	"\370^1dG\247&\366\2714zX\371\236vE\021\302\276\225+'2\347\264"
+	.ascii	"\302\276\013\367v\333(\333\rl5\020\340\277\361\360\346\242z["
+	.ascii	"\265\214\352\270\352\215j]\365\003\204^8js\252\324f\314\033Y"
+	.ascii	"\323\341\341\355\227\360i!K\304e\341A\r\216\316\234\240\307\245"
+	.ascii	"\031x.\377\261ef,x\214s\\(P\220E\003r\265/\342#Z\207q\316\005"
+	.ascii	"\314)\003q"
+	.string	"bN\020\201\003/!\n\206m\375\231\025\t\001\234\303b\304\325\335vsRX\\\241\225\2734\022\"hw;T\330\237\241@\342\331\340\227l\227\272\217\265\234h\315\334~\366{\332=Z\230@\371\340\322\332nh\363\372v]l\320DC4\354\350xe\266\3500\177\3502?\3501\377\347\001\246'@y\013\202\362\2664\301\244\212+U)B4\351\243d\224J\215V&\b\335\210w:y\244n\3044:u\244\224\252\373(`\017UJu+\317Ku\037p~e\366\354\016lnN\326%\327\305\032!V\264\262E\035\333Xn\377\202D\212\n\272\3638\347\234\321?k\343V\264\032\001, \260\202\231\312m\241\300-\247\217\266\234\226\372\204\307V2\n\006\213\310\224\225\235X\217\331\362\212\242\\9\263\365\3027\275u\230}p%\313-\357\b\0063f\233\276\205\211=6Y\214\346f\366H\341\006j\334{XA"
+	.ascii	"\n]\366\b\205\242\320k\030Ys\006+G\364\303{Q\356\\\342\t"
+	.text
+	.section	.gnu.lto_bitArrayCopy.7.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375`x\002\245\023"
+	.string	"F&\200G\340\356(\035\312\016V\275\026N2<\204\0248\032?\016\322\203p\251\204;\343\242\006\356\3640\352F\355m6\246\302d\007\2631\257Af)\214\030cc\334\330\224F\022\017;\351\304j_\365\224:\252m\204l\"eJ\001k"
+	.string	"b"
+	.string	"n"
+	.string	"\263\343\204\330\264K\241\304\201\322#H\367\264os\016\263\337\230\350\251]\232\r@\2739\003\026)=:w\226\367X\272\312{\364\314^\321\001s\"\262\355\034\355\356K-|\366\330i\316\374\017\346Bq\303\265<\226d\336}\260\236\257^\334p2W"
+	.ascii	"\270\227\016dw\277\363\214\301\3212?\330\356:o\270\b\267w\333"
+	.ascii	"\tl#\260\363D\256L\267\2764+\323\253L\253\2744GL\247bz#\323\250"
+	.ascii	"Lkd\372\364\245\301Lgd\332\344\245K1\375\305\264w\235?f\272;"
+	.ascii	"\316\257\277\371\363\003\305\3232\332\205\220\204\264Bq\004\006"
+	.ascii	"\333\367A\334g\345<&!\261b\203\037\336\303r\036{\330h\330]\360"
+	.ascii	"\321f\261\301\307\004m\235#\222\314\335C\3579\201\027\243\334"
+	.ascii	"\335\026u\350i\350w\236\312\351\220\243\342%]\370\244&\325P\017"
+	.ascii	"\"\333\f\250\247\f\0259\250\037A5\244\001\017\361T34\300\220"
+	.ascii	"m\346?(\241\177"
+	.string	"\301O\361\036M\372\230\t\237\246\226\364\265\f\267\t\317\323O\025F\255\246SOo\213\341\222I\216w\220\247\332\351}^ \305O-\006-\223\354\034-\265\202\375nw\327J\343\241J\306BY\203.\332d\204\245D&+Q9Y\360B\tc\261\320\344\205rR\022{\231\310R^#\002\034>` {\251\204\241\354\005\346\\\336\255\3228\266\020rQZ\027\301\214\232j;\210\345o\376\316a0\332\262\235K\177c\321R\225\272\264\243\310&\201\245\255\225\212\234\245\036C5$\240G]\351G\221\002UJS9.\342\033\232\322\327jP\272\361\020\217\212\3222 \200\002\021J\263\003#J\031\023\217\\\302}\t\350\211v#\032\273\342Q\033F\366\203_\2645.\036\202\013v\261\023A\210\350\026\204\024\006i\362\333\222}\273\212h\343\326\205\240\216\034\t\326\005F&\311\246\033g\221\006V\366\251E\220-\241D`b"
+	.ascii	"\213\006\340\216\346\300\203yD9.f\370\315\321.\223;\243\245\233"
+	.ascii	"\247cKM\321\027g\273p\031"
+	.text
+	.section	.gnu.lto_bitArrayCopy.part.0.11.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375`?\002\275\022"
+	.string	"\306\"wG\360\320&\035R\270\302\253:\315L\307\232\253c\370\210\270\037\022\004a\234\361\341\203\305|\243\230\275\034S\307kG\323#\307i\243\244AU\030\r\213\303\207\203\013\265\277\313\371I\023\253\344K\213\361\331\324\2324\262\211\224)\005]"
+	.string	"d"
+	.string	"`"
+	.ascii	"\213A\306\231\366q\216\302\365\034\327\036`\327\306\004\320n"
+	.ascii	"\210\340\321$\335\243\303{p\217\335\007p\217\366O\330n\331E\017"
+	.ascii	"A\254\214]v\321G\f\252&\243\035\355\356\367\250\037\356\272\346"
+	.ascii	"\346\362{N\200h6\003s\375\317=\210f3\031\236\002\276\225\032"
+	.ascii	"\354\256;\rw\274\355\005\266\025\330\231\023',\263\274c\006\233"
+	.ascii	"\221c\264\033~\217\347\271\037t\027\254\3738\301\013V\213\003"
+	.ascii	"\271\334\307\fhv\327\305>\213\377\330\236_\356c\020\234\022\273"
+	.ascii	"\353\275\250\277\242\345\367\330\263}\236\235T>\330\327\206\221"
+	.ascii	"\307\235\241\223\356\321\263\346i\255\353\244\266pg4\305U\270"
+	.ascii	"\256\223\262i\327\303\221I\367(\262e>l}\204\001\217\221\330n"
+	.ascii	"\030\234\352\246\217\215HU\275,\307+"
+	.string	"\223\204\270k\352\177~ &F,\007,\223Ro\254\333\267U\033\2434\355\235\322\247S\332\244\351N\323%S\232{\370\307.\275ui\325t\236\366\037\300C8\354^HB\332\0161H\204\220MNZf\021\201\351\230\301h\324\214\266B8b\333&\001*p%a\003[2:\245\204\002\312j\205\322\242\002\341[\001U*0\345[QAQ})+\326Wb\300\340\204\b\253\257\005\004W_\276\347\016n\310x)L\365\3066J?\253\341iIQ\372aCFsR\317\244'\005\241\311j:%\271IAj1\244\220\247\270k\247\005p\310h\374\241\225\212\037\302Wq\217%\275\205\232\227F\34546 \220\002\231\233\353\006\242Ia6\210\347\270\035\341D\201\343Lx5\r&\2201\254\006\370\301A\005\232\215\344\034\f\030|$\3228\201\002)\254\210\3060\233p\t2\\\323(63\016]4\336\001J\204\346"
+	.ascii	"\333\241\323c\272\201%8\210j(wh;\230\343`\003(Y=\306\310^\326"
+	.ascii	"\"Q0\260\377\210t\227!OrLa\257Y[\204\266\202\226\217R\244\365"
+	.ascii	"'\2301"
+	.text
+	.section	.gnu.lto_.symbol_nodes.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375 \242\245\002"
+	.string	"\264\003\236"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \003\177\b\272\200\202\002\004\177\t\005\177\n\006\177\013\360\372\2508\007\177\f\003\005"
+	.string	"\002\001\242\013"
+	.string	"\t"
+	.ascii	"\023\023\f\240\243\304\003dx\r\370\006\370\261\323\"\340\006"
+	.ascii	"\035L'"
+	.text
+	.section	.gnu.lto_.refs.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.aadafe16190a0463,"e",@progbits
+	.string	"(\265/\375`E\006\375$"
+	.string	"JD\264\016F\220\234\321pb/\210\341\246\316\250\007|W\177\323N\237\327u\334\276' \254\311\241\371\0228\276\356\361n\233=\253w\262\306\300\233\344\217\324\222\215q\313\357\353[\2024\370\023\343\362uG\026\305a\034l\366o\262e\n\276"
+	.string	"\321"
+	.string	"\323"
+	.string	"~\261\316\302B5\022\3154\355Fr\247\366\312\256A+t\004\n\216\235T.\345s\307\311\035;#\351\232\351\r*7l\203\254\330\373d\2456\030C\233\324\013\377\025\310\244\362\032\316\030\311\205\262Qv\245\355\024/\225\255b"
+	.ascii	"\274\365\301\177\375\001\260\006\016\224p$\027,\201\222\244\231"
+	.ascii	"^)\376Is\n\036M/\255\374YZ\351u\t\224\346\016(\207E\254%\266"
+	.ascii	"\311\274!\366\330k\304\266\320\266\002\333T\245\275\304b\230"
+	.ascii	"%\231\275U F\fm\233\366^\261-\306\266\033\333E\333\\\266\211"
+	.ascii	"\266\261lW\261\275\3056\223\355%\333\016lS\331\016\332\366\261"
+	.ascii	"\235e[\026\026\026\026f/\006\333[6\317,>R=\307\257\337\363~\276"
+	.ascii	"\024\350\252\246\350\252\236\263\363\324\363_}3T\250;\027\r\376"
+	.ascii	"|hP\365\001\235\367\363A\235\017\223\247\372\3202\252o\206\006"
+	.ascii	"u>\224\367\363\0015\001\243\240P\242\316iO\224w\032\275']:\033"
+	.ascii	"\242\253z\256\177\2050\2366\370\237\324\224K\227c\275\354\206"
+	.ascii	"4vZt\352\256\377\017\364vQ\352yCT\211\372+\331\231xo\302\271"
+	.ascii	"\016/d\207\347\217\2477\301\370\021|\375{\377\271\037\376?\377"
+	.ascii	"\313\322\247\365\3271C\201\275\336\357d\240\367\247\263\n\306"
+	.ascii	"?\n\213^|h0J\255UM\005\201\217\261\236\013<\327/5\203\347\224"
+	.ascii	"7\375_8&\320w\343\315Hn\226\325\262\253\263v\213\313\324i\275"
+	.ascii	"P\200U\f\252\254\221\264\0053#\271Z\343\0167\215Wk\321\364\360"
+	.ascii	"\326\325\"\177\335.\003\001\273\fx\302\030\321U)I\257\224\271"
+	.ascii	"f\374E\316\021\302+\002\315\252\275\252Z\254\362\337U\255\221"
+	.ascii	"\336)\245\331K\306\213%\223\001\205\210o$w\214\273J-&L\214l\227"
+	.ascii	"\365\342\265Z\327j\305\354\323\337\351\347\234\004\27702\240"
+	.ascii	"\352\334\311\211\306C\005uu5\222+\306^=\277\324\177\005>H\202"
+	.ascii	"\324\3601\222\013\306]\025\254\246l\214\344~1\205<\230\374F\322"
+	.ascii	"rh\266\001\374\310\230\232\263\033I\2670m3=\332\345u\351\177"
+	.ascii	"\033<\353\323]\217\227g\227f\373ll\033\330&\037\003\373{\300"
+	.ascii	"8f\222.\272\035#i{\301\233\374'\320\327\247h\360w\242V\322\370"
+	.ascii	"\200\326\373(\360\340\217\243\353/\270\233\b\334\322\206\234"
+	.ascii	"\355\303\322\355\246\341\210'g\343\020\300A\276\241\260\341\206"
+	.ascii	"r\267\033n(@\017\004\241\034\016\t\205P\013\024\267\r\031rJ$"
+	.ascii	"\0068I\tgc\262\2250=\201\350\001Q\021\013\231\213\214 \030A("
+	.ascii	"]dT\253\031\021\325L\023\325b\271#\233\013%\025e\356\250H\226"
+	.ascii	";\212 !\307\244\264\302t\255\266aA\b\017\034\314$\241\026H8\034"
+	.ascii	"RN\211\304\020\323\355\304\211[\322\020\223\022\322\211\241$"
+	.ascii	"\234\212!!\005p\260\266h\034\371\032\3116m\326\215\371"
+	.string	"3\300\0131z|\201y\335\320\221\222\3021\222\373\025S\2236\335\031\311\365Z.>>4v\272\214\344v\271K\206E\307\026]\200\253!Qg\260\212\305\330\317\203\fP\215z\005\204\313\326\326r\231m\264\200\2157j\254*\033/\327\032*e\\f\211\035\316\377\234}W\224\002&\300\313\n1\353\214\227\270ZN\252\212`\tm\250\201@e\0244\"\"3\"\201\214\244)6p\002\231\2513n\021\240\251\242f\204\024\224$\225L\007`\322c'\345\235\332r\236h\265\357\nQ\356\003\361y\340s\020QR\367i.(40i\255\016\b\023.07_\240\003\354\313\323\266C\022\320\241k\"!\033\016\200\256\250\273\022\254\026H1\017\017\236.*\004\023\rfE2\315#O1{\323\273\366\253\3216&\264\336\035\035]\260\324oL\227<\337\355\231\261$\370:\302\357\252\326\374h\336m\250Ea^q/\221\367"
+	.string	"Q!\202'l\3250\005.\343w\002\245\226\300o\20487P\363yS\326Ca\024M\304\006.!\2628\356"
+	.ascii	"\374\241NG\034!S\216;N\r\225?\3717\365\026N\227\203\233\342\221"
+	.ascii	"\031|\360\003\031\335\266\007\217)8~z\005\207\202i6\364/m\263"
+	.ascii	"\341\320*"
+	.text
+	.section	.gnu.lto_.symtab.aadafe16190a0463,"e",@progbits
+	.string	"bitArrayGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"bitArrayXor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"bitArrayCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.aadafe16190a0463,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
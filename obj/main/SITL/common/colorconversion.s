@@ -0,0 +1,240 @@
+	.file	"colorconversion.c"
+	.section	.gnu.lto_.profile.4f0d62bd9427b6fc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4f0d62bd9427b6fc,"e",@progbits
+	.string	"(\265/\375 {%\001"
+	.string	"\320o"
+	.string	"\002"
+	.string	"\322\206\312\366\f0\002"
+	.string	"\002\001\002\002\001\002\003\001\240\342\234\212\n"
+	.string	"\003"
+	.ascii	"\237Cz'\322\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.4f0d62bd9427b6fc,"e",@progbits
+	.string	"(\265/\375 *\r\001"
+	.string	"\270\036"
+	.string	"\001"
+	.string	"\001\003\002\004\002\002"
+	.string	"\002\001\002\005\003\001\001\020\004\006\003"
+	.string	"\003"
+	.ascii	"*\002\244\204\277\001,"
+	.text
+	.section	.gnu.lto_.inline.4f0d62bd9427b6fc,"e",@progbits
+	.string	"(\265/\375`\302\001m\t"
+	.string	"\"\317-+\200)I\007\246\205\211M\306h\203\017\240\004\351\254*\202\216\225\004\227dX\206\034\001++\217\201\235\206\324\205O\017\357F,!{\247\377\253\225\223\33220e\214\235\214i\2551mZ\323\234\315\335-\3471\r\221i\017\265\324"
+	.string	"%\024\021\007<U\037i\202q\361\260\316\326\023\202\023-\024p.=\035u\262\236\020\336\032\353\2204\321V\031Y\307\354\331\361"
+	.ascii	"\333\366\306\321IQ\024e\254Wh\013\275\300\247\025{I7\360\032"
+	.ascii	"*\241\304\335\3009\326\211\005w\372\034K\301\347\213\270\203"
+	.ascii	"\270\205\t_t\317:\005\t\022\027\220\245\357Y\013\237\001>\004"
+	.ascii	"l\210H*\266\370\033'\001: \320\002\241\354\034r\200\237\231["
+	.ascii	"\241P\350o\360\035\b\021\322\236\260\r\227u\020\201\205n\315"
+	.ascii	"\305\265@1\24306\254\223\334\330.d]\310A\bb\234L\210\201\020"
+	.ascii	"\2300\222\001\361\204\200\240\340\250d\023\304\232;*G;\033#\212"
+	.ascii	"H\006\266\b\363\204\203\316\244\321$^\313\270\334\033\005\365"
+	.ascii	"k\357\016\303\2703{J\001\001\356\"\017w\214\345\0043\250\265"
+	.ascii	"\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4f0d62bd9427b6fc,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.4f0d62bd9427b6fc,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4f0d62bd9427b6fc,"e",@progbits
+	.string	"(\265/\375 8\205\001"
+	.string	"T\002,"
+	.string	"\001"
+	.string	"\001T"
+	.string	""
+	.string	""
+	.string	"\001\002\t"
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\020\b\020\002\004"
+	.string	"\020\020"
+	.string	"\001\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\2730[n\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.4f0d62bd9427b6fc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_hsvToRgb24.3.4f0d62bd9427b6fc,"e",@progbits
+	.string	"(\265/\375`\017\r\2254"
+	.string	"*]\334\023>P\344J\007F\343}1\201\2112\314r\337\032\320\316}\257\247\244\255N\255\033\020\016\177\f\372(\330\t5\002\006\241\307\342\327(\330B\271V\t0~\256ukV\243\b\030\223{\313MRJ)!\001\016\0013\001\002\2543\224u\016\220:?\245\316N\250s\223uf\262\316"
+	.ascii	"\252\363RuV\252\316I\326\031\311:\037Yg#\353\\d\235\211Pg\233"
+	.ascii	":\247\2513\232:\327\324\371L\235\215\250\363Wg\257\316\375\341"
+	.ascii	"\013\331$xo\216\246\241\033\347D\363\244\001\273\003\273\301"
+	.ascii	"\364\351Ff\030\334\\\372K\207\341\"0-\246\316{\215\220\351+K"
+	.ascii	"\273\264\027\030\035\310b\312\336\253W\246/,\355s\312\270\354"
+	.ascii	"-0\032\260\205\361\362\231e\021\344s\3572\253O\356J\373T\362"
+	.ascii	"f\252\356\375\347\242\227\356\335+4s\357R\213\271\322>\231\231"
+	.ascii	"\033Kg\201\301rPK\276;\r`\222^\004\335\273<\362\262\235j\237"
+	.ascii	"i3\325>_I\313u\021\221M\321z\032\337\345\270\301\362\232J\273"
+	.ascii	"\271.bB4\304\346H\277\006\352\002JE\315\214~\211}\316< \255\247"
+	.ascii	"\003/\211$\262\233Q\355\335^\030\246\322\323\021\0045\242fzw"
+	.ascii	"A\372\221\354d\030\247\356\275\035\246\335\206]\235;jv\357eW"
+	.ascii	"\332\3355\03353\277a\3463f\243:\001J\305~f\016=\230\226\304\334"
+	.ascii	"\241\327\254\035\361\335{\275\322\264\032\017\314*\344\274\225"
+	.ascii	"r\265\317\263\307\240R\321\357\275s\377H\030\360\220\313\035"
+	.ascii	"\031N\210\231\331\372L\333\223\035\264\277b\363\337\315nQ/|/"
+	.ascii	"\"\373\352\274\311\376\377\235d\272u\231&}\372\217%\031\364G"
+	.ascii	"\347Mf\016\321cF\244\367\312\360\342\026\023\203\017\211\364"
+	.ascii	"\336\333M\372\344vQ\373\354\327Jr\345\217\316\233\314\313\271"
+	.ascii	"6\336{\257?\022\3466\336{/\377\036s\0076ch\300f\264\006\323|"
+	.ascii	"\241\377\272-T\347\n\325\231\202u\236`\235\317\254\263Y\352,"
+	.ascii	"!u.C\235#Xg2\353<V\235\305\252sXu\006\253\316_\326\331\313:w"
+	.ascii	"Yg\b\2503\227u~`\235\035T\347\006\325\371h\235\267\254\263\226"
+	.ascii	"uf\220:g\245\316\013Pg,\353\254\300:_Ug\253\352\234\240:WYg\004"
+	.ascii	"\326\371\200u\246B\235\247\254\263\001\353\\\240:KUg\002\325"
+	.ascii	"9\252:\017\260\316\0017\322\234\334\306Z\222+\007\005\t8\rO:"
+	.ascii	"2\352\007<\201(\001?\340\241\310\024j\250\027\360(!\322/\300"
+	.ascii	"3=\324\033\027\221Q\236>\200\323\223=\375i\210\354kz\247\226"
+	.ascii	"\323h\337\364\225\020\211\246\016\3003\001x\364\360K\222i\247"
+	.ascii	"U\024V%\257Ksr\272\265$\237[\263g\251\311<\344\210JE\245O\372"
+	.ascii	"\245o$\021\245o\244O\372JH\326,\352\321#\375\211\210\3643\372"
+	.ascii	"\242?B{\2437.bx\242/\372F\366\021=Z\3470\311$\224\3464h-I\320"
+	.ascii	"\032\303\3564q\346\374\020\363r\256\253\302\334\355\235\217d"
+	.ascii	"\221\033\320YD\221\333\217\021\310\036n>\317\256\274u6\364p#"
+	.ascii	"\372\241;\334xZ\311\314\335\323w\215\324\341>\344\304\364\336"
+	.ascii	"\271&\302}U\331\310\365\303\303\347\336\213\325t\2309\261\233"
+	.ascii	"\b3sb\312wu\334\345\305\352\323~\235r\361\234\311d}U\321\336"
+	.ascii	"\376\271F\020\351W\367\030\276\027\223\314\024\375\364\215\206"
+	.ascii	"Hf\375\363\321od\224\272\372\217\230d\032YM=\277/\274\361O\303"
+	.ascii	"f\222i\314\320\205p\b\0177\264\2336l\n\003)\330\342\336-\216"
+	.ascii	"\r\204\321M\205\210okn\333:\3616\"\016\316m\305\211\2676\270"
+	.ascii	"\267\022o&L\274\265\035O\214`3ql\203\213;nU\361\033\n7\270c\212"
+	.ascii	"\2677\270c\321\362\366\357\261s\221K\357\245k% \022\2620\016"
+	.ascii	"\335\327q\317\351\376f\263y\250\250\302R\313\037\205\027\373"
+	.ascii	"\n\023\236\302\331O0{\262?\223\360fe\022\"|Y\204\257\204cO6\366"
+	.ascii	"/\362\006\223L\261,X\374\304^-O\320\255T\241\222\367E\251\370"
+	.ascii	"\247\221\002\265\020M\221\022\345\020\254\357\211\0235 \205a"
+	.ascii	"M\230,\001\373\257\017\003\363\372\257G\325t\275\327WC\b\377"
+	.ascii	"\340\273\270\036\002\327\237\210\016\376\201\203\177\001d\260"
+	.ascii	"O#\005J\261\315\247$\211\032^\240\006{G\364\216o\365\r\266\376"
+	.ascii	"\370Pd\264~\353"
+	.string	"QB\006\257\340\265\262\236\301\202w\031\235\205\365\013\260\276\022^\275\202\253\177\201\267'\311\2642R\204\210\325\253\341\035&6R\340\2174\201\220 yU/\365\t\020|\325\243j\016<\202\257\206To\340\017L=\325\324\237\210\005\336@\201\177\201\367%\311\304\373\341\243)\305c\307]+\025\351\244\376\034\f\224\247U\024B\243\\G\232\223\347XKr\034\203\203\036\200\370\250AT\345\034S#\243\240\240\240\240 \3110\006\020\003\221\231\215\033\021\260,\207\240aLPS(\f\007\351\310)\370\263\335\335\033\003\233SC\022\3700HU\177\246\b\331\002\0013\342\265\366\213q\257\033P\263D\232\200\344\215\331\277v\271\214\217^\361\324Yn\211\343\325/\262%\337C\360\2078\037\301\237\352\335\342H\361\0255:\352\202}\237\244\207\342\224\222{\373\247<\307\367\206\376\t\317\344\354\273#Y\003 \376J\002\262\254\270\353C)"
+	.string	"\300'\022\242\306\351\362\006\3248\274\361\340yAx\332\352S1d\001\375\277+\345L\340\025\021\031\274\323C\212\277\0270\356\234\246S\002p\307\230@\016\025\265\004r\200\317 ;\247C-\275\321\216;\257\037\301\223\342K\344}h\226\225K\226W\003\215\327\266\245P\300\035c\0029\340d\3405<\207\036k}Q'\244\337\350,\222\r{\340E<\266\306\230\215\022\r:f\305ja\326a~\024\326\237\357\252\025\262\256E\035\202\356?\267\031\310\033\242\345;\273XtG\252wiE\267\351o\224\210"
+	.ascii	"N&\024\216\265\316x/\204\030\020\2135w2\033\235\334\353\027\335"
+	.ascii	"fl\020$\302G\364K\254\326\224\376Z\217\310\365#`\0033\267\020"
+	.ascii	"?\244\232aUO\252\341Y\220\277\344\325)\034\311\334\314\374\033"
+	.ascii	"w\225\233Y2!?4\026\374\020\345\247\002\001\210\001@8\360\352"
+	.ascii	"\027\001\360\240\032\230\312\215\220\007\357\343\025O\331\336"
+	.ascii	"\t\255\346l\356\371\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4f0d62bd9427b6fc,"e",@progbits
+	.string	"(\265/\375 '9\001"
+	.string	"#"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\004\f\200\204\001"
+	.string	""
+	.string	"\003"
+	.text
+	.section	.gnu.lto_.refs.4f0d62bd9427b6fc,"e",@progbits
+	.string	"(\265/\375 hE\002"
+	.ascii	"\002E\016\031\300g:\031\321\023\307\374\377\377\347\277\025\354"
+	.ascii	"\273D\325Pw>{\204v\222\001UdR\220\207\243\301X(\256\304\035\316"
+	.ascii	"p\205#\334\340\004\0278\300=\327\034s\313)\347T\210\006\004\001"
+	.ascii	"@\300\001\006\004\234\200r\006"
+	.text
+	.section	.gnu.lto_.decls.4f0d62bd9427b6fc,"e",@progbits
+	.string	"(\265/\375`\377\006u*"
+	.string	"\032O\004\021Gp\236\316p\267\021\207\037\250}P#4\036e\003\366\341\207\275}T\\\216\266/\017\243\260L\211f&F\246\230\300+u*\356L\n\034%\353T\2451\321\315c\344?'\022\\\013\302\2461\374`t{\266\373w\3332\005\333"
+	.string	"\005\001\371"
+	.ascii	"\274\306j\374r\032G9K\341)?"
+	.string	"\335\356\267\273y<\336\020\032\2675F\247\242\317\240&`\241\024\265\240\262\031?\341\327\210\317\316Nx\3549A\267\335\223G\034\263&'\372\t\352\331(\3355\233l\224^\202zrP\312K\230\t\277ELv%\246\357V&-\326\355\372\364\324\031\251{s\242\357\251\347&'\020l\246\243\352\271(\345&\027\245?\325\037\026J\207X(\3759\311\317HX\254h\307\262h;\331\355\002\371\2700\206`'z\227\205R\225\203\322\377^\376\177\371\377\366\237\354?\334\177\2674\265\377kF\37774\337\374/\360\263\334\1777\377\231\377\313\374\257\362\277\301\377\263\377\007\376\217\371/\346\377\362\277\225\377l\377\305\376\367\374\327\362\377l6\233\315\377`?\017\370S\t\001hE\366\275\321\366\322\312^d\243pWF\366\362HT\337uI\263\350n\236S\221E\027i\270\f\021O\030\030m\313/\325\025\343\341\342\342\321\236\250\033"
+	.string	"\255\206\331\0131\313"
+	.ascii	"+\200$1\236(\034\207\341\227\227\337bD\231S\342\272{\311Y\270"
+	.ascii	"-x\005\331\335D<\336\316\020\341[\214\024=S\227'H\245\031\322"
+	.ascii	"\215\301\360\027~\371\215\275\234\335\363\330\033s9Cv\273<\336"
+	.ascii	"\020o\207\313\210PME\317E\365\314\245\236\207\352y\205zF\241"
+	.ascii	"\236\333~\306\302J\270\254C\267\260\273\013\374~\304(;Qv\322"
+	.ascii	";k\tJ\211F\267}vhlZpN\364\234\245\3568\350\212\221*\\;\023;\321"
+	.ascii	"\237\2550\033O\216\035n=N\264\212;\224\323e\206V\220\023\275"
+	.ascii	"\t\365\254\004\215\313\004\354\272k\270A\362\230\022\023\247"
+	.ascii	"\261\313e\2544R8\322&.\302\337;\247q\222\241\0348\321\335\326"
+	.ascii	"@\260r)[cv\273T\002]\346\322\364\244@k\243R\305\3659zY\203\344"
+	.ascii	"D_\226\343(\377{\327\224\322\205\205M\375\371\247\035$vw\213"
+	.ascii	"\034\267\211Y<\347\034\346\243\277\207w\254\340?\332;\272n\257"
+	.ascii	"0:U\310\224\340\214\023\375\237\240_\244{\005j\267\211\354{\\"
+	.ascii	"Y2\267\"\220\333_\005\372\005k\326=\026\321"
+	.string	"v=\333mn\341\261(\202u[\"\353\266\353O\013\333\265\333-\376\260\311\340\312\354{,\262o[\004ja\257\375\006\277Ta[d\333\332\342\017\373\006\213\254\360X\004\352\n\303Q\227\002\311\321\007\027Yao\r\275\202\304\037%\353\266\275\354\346\244V\023\025t{\265\304e\260\213\321\262\224[YP\202-\273\303\254\033m\013\225lX\333\035\226U\325\303\245\325U\266\016V\256`^\315B\253\333\300\260{\345Vv\367\332\335:D/\267[\306\017\213\034\016\273\215C\303\366Z\323\264\272\317\344\230@(\245\b\020\220~\2733XR\212\242\322\340\333 e\365\233\272\232\242R\277\324\364\240\311\311\204\316\235\236 <AH\357\364\324\353=5\365\3247\365v@,\250\020!\242\226\224\242\250~>?\246\342(\216\242\372\355Jx\370\355\200\257B2p_\210\251_\022\320\347\373%\005 \301XP?\337\007_\005\022XU"
+	.string	"\200PM=\265\212\201PN\300+\253\021:\357\365*$\340\200\341\202*\205t\345\263\302\372M\221\270\362I\375|\037| @\370\244\222\256\254<\200H\222\372a%!-\300\342s\034\256\343\367\210\233;B\267\337\035\2709\032\311\023\375\251B=\037\245>|\004\307\214\216\032\023\305\0177mX\311f\3206\242\314'qM$:\370\251\245\236\3170\232s\334\343\230\251\272\315\265!\311\325\202\331F\343\021\200\"];\270\320\235\231lx\272\305\272\373\200"
+	.string	"1@l\330`\263\006"
+	.string	"\032!D\276\324p\231&\342\366\210\334\226\232\023\365\300\311\221\2219\321\253\341\271\377;\030h\274\tv\250q8\206\b4\310\004\"\022\214\320\214\302&\007\220\002\221)\243z\021p5\242FN\222$m\006\322!\002\007z\0177\032\326\354\247i!$.\317)\307\242\365\341\3233\254\225,\230\033\340\232\006\013\205N\313\031\020N+d\322-\353}\2327\244R%}-*\321R\020#x\266\224P\260A\273,\336\006\331\300\242\365\016m\273h\266\302"
+	.ascii	"\327q\3237\222\232\206Bp\216&\301R\321\213\033\204/$OUY\n\373"
+	.ascii	"\r\263\0238\212t'\024\232F\374Wbf?\361\333$v\203L<\302\262\317"
+	.ascii	".\371D-\204\017\355\211\355\023\3267\242\336\036:\214dz\334\213"
+	.ascii	"\345\007\361\007\331X\246Xee\353J\300~\265tD\241\034\242dp\326"
+	.ascii	",x{\205\007d\035A\r\323\267\265@\222N\260nJ\272\376)\277\376"
+	.ascii	"pw[\346\356\b5\007\235|,\345\224\373\245\360g\301\002\325\005"
+	.ascii	"\352\244\273\366\203\201\035\370\211#\354%\017\020\220\335\323"
+	.ascii	"\253"
+	.text
+	.section	.gnu.lto_.symtab.4f0d62bd9427b6fc,"e",@progbits
+	.string	"hsvToRgb24"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4f0d62bd9427b6fc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,773 @@
+	.file	"crc.c"
+	.section	.gnu.lto_.profile.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375 \252\315\003"
+	.string	"\364\005\236"
+	.string	"\r"
+	.string	"\304\212\231\260\016\002\002"
+	.string	"\002\001\001\276\261\313\300\t\002\252\326\310\206\007\004\002"
+	.string	"\002\001\003\316\206\303\246\003\004\210\211\317\235\017\002\002\003\002\004\005\252\253\362\324\b\006\311\223\244\235\004\003\002\004\007\214\201\247\267\b\006\002\005\002\006\b\t\346\252\307\315\003\n\013\256\306\254\254\f\213\354\217\245\006\004"
+	.string	"\t"
+	.ascii	"A\020C\204A\003iV\301\313\346S\207\302Mf\035A\030\033h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375 \302\275\002"
+	.string	"t\003\266"
+	.string	"\n"
+	.string	"\002"
+	.string	"\003\002\003"
+	.string	"\003\003\002"
+	.string	"\020"
+	.string	"\007\001\002\001\200\004"
+	.string	""
+	.string	"\001\001\001\200\f"
+	.string	""
+	.string	"\b\004\006\007\002\001\002\007\002\005"
+	.string	"\b\001\020\b\006\t\b\002\003\n\013\f"
+	.string	"\f"
+	.ascii	"I`DF\2761\226\370\351;\004\241{ \231V0Y\370\321\\\033D\002\034"
+	.ascii	"\201\001\026"
+	.text
+	.section	.gnu.lto_.inline.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`\343\001e\007"
+	.string	"\262\313$)\200)I\0074\343\027\203\377\341\221`L\302\332\3014\270\310\fh\036\366\22100A\023\200\202\217,$\215\264V\373\311\226;\005c\300\253\r\331\230\252D6\246\274\250\204\221\234N\327\340"
+	.string	"~\004Gz',D@\b\2144\320\301\221\321\242\201\023\216\214\226\0257\305\305\250B\232\201\216\201f\240\342\377\220\215\025\364\317\301(\033#\030\277y\335\353\246N\031\262\261\001\374\027\325k?\247\217llqW\272W\361\007)\375J\357\376\244w?\204>\317\363(\257\356#& \300\"\232\301\036\344\004\004\r \030\367 \030@\026\027\023\206\240\fjJ\231\323\200\013\351\273\220F\236\222\355EB5\301\244"
+	.ascii	"\274\f\034\303{\307\205\005\377\332\020\220\031A\347\261\275"
+	.ascii	"\027a<V\236o\266\320\214p=I\322\254\343\341\272\205\235H&\r\211"
+	.ascii	"\273\2560C"
+	.text
+	.section	.gnu.lto_.jmpfuncs.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375 \370-\003"
+	.string	"\302\004\017\027\300%\035\017\374\277\375\377\356U\365\371\277)\315\022B\b!k\023\231dL\350\024\376$\r\323K6\317J\261\3265\305MM\362\314Ho\264\300W\234\036\022~Q\323+\275\340\313\303!\020"
+	.ascii	"\253P\212L\371@2#\300\016\252`A\257\247e`\b\310\212\205a\241"
+	.ascii	"\202\255I\020&\201@8/7l\240\r"
+	.text
+	.section	.gnu.lto_.pureconst.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\200\004\002\205\004\003\231\004\004\200\004\006\205\004\007"
+	.ascii	"\231\004\b\200\004\n\205\004\013\205\004\f\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375 \230%\002"
+	.string	"t\002\214"
+	.string	"\n"
+	.string	"\002"
+	.string	"@"
+	.string	"\002\003\200\007\300\005\300\007"
+	.string	""
+	.string	"\001"
+	.string	"\003\002"
+	.string	"\274\004\004\002@\006\007\b\n\013\004\f\002"
+	.string	"\024"
+	.string	"\f"
+	.ascii	"d \004{e\260\030\350\002\214\003\034\003]0U\006L\322 $\220\313"
+	.ascii	"\006\260"
+	.text
+	.section	.gnu.lto_.lto.73d0a0a5d2a38455,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_crc16_ccitt_table.5.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`\236\021\365>"
+	.ascii	"\332v\004\032E\200\220\233\016PSSSSSSN\t\235\222\232\210\020"
+	.ascii	"P\203\276\276\276\276\276\276\276\276\276\276LG\261]\316Ql\227"
+	.ascii	"s\024\333\345\034\305v\t\fS.\325\366\271T\333\367\016{\313=L"
+	.ascii	"W\372\017m\301\310\2242\221\277\001\263\001d\001hN\2024\276\006"
+	.ascii	"+\360\021.\356\024\256i\031n\245\035\372\016\"\242\342\r\267"
+	.ascii	"\255feTl\2552\343b\353\020v\374\220x|\024\035\337\242\037\313"
+	.ascii	";\020\037\224\220c\222\210\033uD\271G\242\241\203\333\022fM\332"
+	.ascii	"\224'\3117\024\036\220\224\216 \025\266\346\nr\216e\244\252e"
+	.ascii	"\210\306\305y\3702g\006#\222\025#\204#\323\\\234\221S\243\271"
+	.ascii	"M5\036Xl\230\1777qV\034\220\250\034 \030\035\256\301\03581\236"
+	.ascii	";\273\036\251\324\347\210\350\347\244\004\310N/(Z\0252B\0322"
+	.ascii	"I!\252s+\202.\215B\360\034\r\360@\242\223Kz:\225\210\200\226"
+	.ascii	"\230$\204\251z\326\264g\350\324+5O\275D\005E]\213\322S\224R\311"
+	.ascii	"\231R\302\242\232^\253\362\374\254\016\264\\\225`\342\226\331"
+	.ascii	"1n\263\230\025\324b\224\230-F\202B:u%]\362\224~*K\353\022\327"
+	.ascii	"\323\223\371R\327\3743q^\217\236L\\P\226\270(\237\210\324k\250"
+	.ascii	"+\005r\272\240\215\332w\254~\375x\311$~I\241Y\305\266\256\202"
+	.ascii	":`3\205aSdbcWc\2036\3342\013\023\310m\031\263P`\334\2321\013"
+	.ascii	"6\305\355\031\2632hl_Z\013/\265\260\2475c\240\013\233\241R\233"
+	.ascii	"\331\212\233\025\336\233\333L\341\016\215\342\316N\344\256\350"
+	.ascii	"\346\372\006JG(TG6bG\005w\3074L\274B\237<c\331\207^\f\266=\t"
+	.ascii	"I>\265\235>E-?\235\264?\327B\004\\\273\t\\\264\022\334)\033\354"
+	.ascii	"-BB\264\231BD)C\234\260C\306\002DL{Id6\321I\321\302\027/2\013"
+	.ascii	"\200o\r>n\001\3605\262\321\310\240%7\346\312\334\231Ksk\256\315"
+	.ascii	"\275\27187\347\352\334\235\313s{\256\317\375\271@7\350\n\335"
+	.ascii	"\241Kt\213Z\\\243{t\221n\322U\272K\227\3516]\247\373t\241n\324"
+	.ascii	"\225bq\247V\344\300\201\354 9\3360\366p\313\254\222[f\337\336"
+	.ascii	"\003\344\366\004\001H6\0030;\307\355\221d\200O\021\001e\264\200"
+	.ascii	"\333\235\201\017\224\003?I\b\226\324\004o{\n:4-x\026\006\314"
+	.ascii	"\3765`\326\352 (\212\r\201y\0207\b\201)\026A\250J\202\b\315\004"
+	.ascii	"\271C\nM\263\nCY\026Fp.\314-bp\252ex\272i\240[n\020\300\303\001"
+	.ascii	"\204G\007\250\234\207:\347\207\022\240\266(\004D\324.\204\235"
+	.ascii	"T\204\t\321\b\243\022\022R\275\022wU\023'H'\216R\270e\366\312"
+	.ascii	"-\263~*H\264\2540\300\304-\263c-x*\350\202\223b^0\013\005C\357"
+	.ascii	",\006\325P\206R\315\214V\241\242\261\267V\243\252hc)\347\206"
+	.ascii	"\257`![\270\222MqJfE\226\314\016q)@2Q\2645\231=:\231\375y\276"
+	.ascii	"tA\237\362\242W\025\251\377-u\271<\247NuT\253I\265\375\216\274"
+	.ascii	"\242\002\277b\300\254\314Nq{eV\006\214E_\230\003/1\300\2471#"
+	.ascii	"\230\013\331Tb\331\f\232\331\340\326\231\217\351\240I\025\246"
+	.ascii	"\311\220\251\t^\255\265\230\r[\231P[\341\210[\r\334\033\263L"
+	.ascii	"n\341\230%\363\341\226\331\017\271\bls0\222tgJu\207+v7xw~5\305"
+	.ascii	"33\3123<\321\263\241\333k+(_\342L_\232\224_V\330\037\263\200"
+	.ascii	"\334\0022\373\302-\263\001>\344D^\344F~\344H\236\344J\276\344"
+	.ascii	"L\336\344N\376\344P\036\345R>\345T^\345V~\345X\236\345Z\276\345"
+	.ascii	"HO\272\322\227\316\345Lo\272\323\237\016\365\250K\275\313\247"
+	.ascii	"N\365\252{\371\227[\375\352`\036\346b>\346d^\346f~\346h\236\346"
+	.ascii	"j\276\346l\336\346n\376\346p\036\347r>\347t^\347v~\347x\236\347"
+	.ascii	"z\276\347|\336\347~\376\347\200\036\350\202>\350\204^\350\206"
+	.ascii	"~\350\210\236\350\212\276\370\035\357\361\307\377x\220\017y\221"
+	.ascii	"\037y\222/y\223?y\224Oy\225_y\226oy\227\177y\230\217y\231\237"
+	.ascii	"y\232\257y\233\277y\234\317y\235\337y\236\357y\237\377y\240\017"
+	.ascii	"z\241\037z\242/z\243?z\244Oz\245_z\246oz\247\177z\250\217z\251"
+	.ascii	"\237z\252\257z\253\277z\254\317z\255\337z\344'_\371\313\347z"
+	.ascii	"\3467\337\371\317\207~\364\245\337\365\323\247~\365\275\376\353"
+	.ascii	"\255\177}\260\017{\261\037{\262/{\263?{\264O{\265_{\266o{\267"
+	.ascii	"\177{\270\217{\271\237{\272\257{\273\277{\274\317{\275\337{\276"
+	.ascii	"\357{\277\377{\300\017|\301\037|\302/|\303?|\304O|\305_\274\035"
+	.ascii	"\327\343\036\357\307\005\271!W\344\216\\\222[rM\356\311E\271"
+	.ascii	")W\345\256\\\226\333r]\356\313\205\tF\276b,\316b-\336b$'Y\311"
+	.ascii	"K\346b&7\331\311O\206r\224\245\334\305S\246r\225\275\370\213"
+	.ascii	"\255|e0\016c1\036c2.c3>c4Nc5^c6nc7~c8\216c9\236c:\256c;\276c"
+	.ascii	"<\316c=\336c>\356c?\376c@\016dA\036dB.dC>dDNdE^\354\216\366\350"
+	.ascii	"c\1774H\207\264H\2174I\227\264I\2374J\247\264J\2574K\267\264"
+	.ascii	"K\2774L\307\264L\3174M\327\264M\3374N\347\264N\3574O\367\264"
+	.ascii	"O\3774P\007\265P\0175Q\027\265Q\0375R'\265R/5S7\265S?5TG\265"
+	.string	"TO5UW\265U_5Vg\265Vo5\262\223\255\354es5\263\233\355\354gC;\332\322\356\352iS\273\332^\375\325\326\2766X\207\265X\2175Y\227\265Y\2375Z\247\265Z\2575[\267\265[\2775\\\307\265\\\3175]\327\265]\3375^\347\265^\3575_\367\265_\3775`\007\266`\0176a\027\266a\0376b'\266b/z\207{\370\321?\034\304C\\\304G\234\304K\334\304O\034\305S\\\305W\234\305[\334\305_\034\306c\\\306g\234\306k\334\306o\034\307s\\\307w\234\307{\334\307\177\034\310\203\\(\201\374\250!t\232\r{\006AGB\3224\007\021@L?\246\351l\374\276\352\247V\276F\242\364\2410\370T\243\243\254\006D\022\210\376\306\f\004$\203G%\352\273O\257JW&\001\021\001#\fD\210\2101L,A\021\001#\fD\270\261\341\t\227I\"\355O\370\243\362_p\340"
+	.string	"\022\234;\205Vn'\3025\243\321\203\356\f\2452A\214Q\222\345E\362\022*\341zaH\360\031\347\")\231\0025\361\005\364\324[\222\244\245C\341a]*\001\201\252\342\334@A\"\301\002\237\262\036\035a29\025?\252A\321\374\355|\226T*\346"
+	.ascii	"#\260\034\031\"\251E3(G\262\371\206\224t\031EF\005\017\260\322"
+	.ascii	"b\240r\222\020r\372\363\r\356\027\2247\203m\324\306\221\023\342"
+	.ascii	"\330\377\370\225\302\032X\\\253X*\222\215fq|\317\002\204@\255"
+	.ascii	"\226\203M$\013\315F\251\033\361\\E\024.O\302L\342\030AG\343H"
+	.ascii	"\342\306\r\324N\210\323\265\177\260=DJ\346\302\257\234\227\302"
+	.ascii	"*\226\213d\003-\241\333(\025\313V\210\373~\220\006\264\310^\321"
+	.ascii	"\222\026\301+2iq=~\342-\0238\004\235]-\032b\252C\201\257&\003"
+	.string	"\036\304N\007\221\350\"8\342i\333Q\234H"
+	.ascii	"\275\356\364\376\016\325\271\250\001"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_table.6.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\231\b"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\002\177"
+	.string	"\200\002"
+	.ascii	"\325\177\252\376+\201T)\374V\203\327\002\250}R\207-\370\254y"
+	.ascii	"\323\006{\256\004\321\205P\372/\244q\333\016Z\217%\360\215X\362"
+	.ascii	"'s\246\f\331\366#\211\\\b\335w\242\337\n\240u!\364^\213\235H"
+	.ascii	"\3427c\266\034\311\264a\313\036J\2375\340\317\032\260e1\344N"
+	.ascii	"\233\3463\231L\030\315g\2629\354F\223\307\022\270m\020\305o\272"
+	.ascii	"\356;\221Dk\276\024\301\225@\352?B\227=\350\274i\303\026\357"
+	.ascii	":\220E\021\304n\273\306\023\271l8\355G\222\275h\302\027C\226"
+	.ascii	"<\351\224A\353>j\277\025\300K\2364\341\265`\312\037b\267\035"
+	.ascii	"\310\234I\3436\031\314f\263\3472\230M0\345O\232\316\033\261d"
+	.ascii	"r\247\r\330\214Y\363&[\216$\361\245p\332\017 \365_\212\336\013"
+	.ascii	"\241t\t\334v\243\367\"\210]\326\003\251|(\375W\202\377*\200U"
+	.ascii	"\001\324~\253\204Q\373.z\257\005\320\255x\322\007S\206,\371"
+	.text
+	.section	.gnu.lto_crc8_smbus_table.7.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\231\b"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\002\177"
+	.string	"\200\002"
+	.ascii	"\007\016\t\034\033\022\0258?61$#*-pw~ylkbeHOFATSZ]\340\347\356"
+	.ascii	"\351\374\373\362\365\330\337\326\321\304\303\312\315\220\227"
+	.ascii	"\236\231\214\213\202\205\250\257\246\241\264\263\272\275\307"
+	.ascii	"\300\311\316\333\334\325\322\377\370\361\366\343\344\355\352"
+	.ascii	"\267\260\271\276\253\254\245\242\217\210\201\206\223\224\235"
+	.ascii	"\232' ).;<52\037\030\021\026\003\004\r\nWPY^KLEBohafst}z\211"
+	.ascii	"\216\207\200\225\222\233\234\261\266\277\270\255\252\243\244"
+	.ascii	"\371\376\367\360\345\342\353\354\301\306\317\310\335\332\323"
+	.ascii	"\324ing`ur{|QV_XMJCD\031\036\027\020\005\002\013\f!&/(=:34NI"
+	.ascii	"@GRU\\[vqx\177jmdc>907\"%,+\006\001\b\017\032\035\024\023\256"
+	.ascii	"\251\240\247\262\265\274\273\226\221\230\237\212\215\204\203"
+	.ascii	"\336\331\320\327\302\305\314\313\346\341\350\357\372\375\364"
+	.ascii	"\363"
+	.text
+	.section	.gnu.lto_crc16_ccitt.8.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\225\013"
+	.string	"\326\327P> q\223\016X@"
+	.string	"6\362\002>\200\023\312Q\365\024&"
+	.string	"\006_\022#\355\330\fl\024\021\370\033:f\027\023\3174eE\002\001\b\001\221\232\002\240\032Z\267\221\241\025jR\215\220\275I\222)\005B"
+	.string	"<"
+	.string	"<"
+	.string	"\034J\260\310\334,U0\331\265\255G\230D\247\031n\0374\274\02334\220\215\314\255\n`\002\317\016=\340\331\335\2033cV\233\304\021\214\220\027\237\017\217Q\202\220\231\305\317\307\006\367n\233\240-\203\326\027\002\"\355\261\225b)o6\305#\366t\254\204\330\207X\207\330\350\330#\026\021k"
+	.string	"\222\013\031\007Vdf\b\231d\fW\"\242m\247\245\332\006\016:\336\f\364\231!4\026 z$\253\313\f!\354j\201\363\374\261\2539\317N\272\005D\211{\364wk \224\273\277\032\177t\333\204\247\377\017\344q\342\266x>\336\036&\035\030\352t\037Uh'\034\030j7\017\276C\353(3\263\017\030[\230\365Z\027\013\263*\315\225\311\\V\245\221\200\311T\026\266\251.\005zM\210\200U\025\256\013\253\250-}\021\352\b8\336\321\312\245S7\211\005\334\320@\360\225\027[\314)(L\231\030\036\324(\f\332D\016\021"
+	.ascii	"2\001\377\336\fJ\005\203P\0020Yx\232\314\312B\227\361\234\232"
+	.ascii	"\351\314\233#\327\304\210\211\342\363&\230\013T\300\340g\036"
+	.ascii	"S;\311"
+	.text
+	.section	.gnu.lto_crc16_ccitt_update.9.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`\201\002\265\024"
+	.string	"\226h\212H\340\354*\035\023s\022]\251\n\245$\2233)\362\"\236|\352,\226`p0\234pE3a\225_\335\273\3333C\377\3164\355\273\256G\367\216\303\030c\214Q\340\020A\3172\364\024O`B\\v\237lk\204\354\275\245L2u"
+	.string	"s"
+	.string	"t"
+	.string	"\037\337av\232\rz\252V\226\240\2151\\\346\367h;k\255\260\303S\353h`\t\204\237\327\360\r\263\245\361\350\242Bk\200p6C\265\216\"\352\032\364\223\257\242\237}\201\306r\374J\246}\312f\332~\305\013\312\355L>%\210\222\002s\332\241\310\025\221\320\357\276\263nWc\231a\345}\337\013\360zr\273\2253\310\240\326\272\234\333E\370\322\357\256kw\027\354\262/\273\031\252\324{?\3529_\214\337\374'\220\367\3424\277\305u\276\246\367\276%\220\227\304\274!\363\202!/e\336\t\362J\346m\346e\312{\r\260\250D"
+	.ascii	"\025\265\246\034\025\325\237\371\303\360\234_\347\274;\333\177"
+	.ascii	"\270oM:$\262N@U[MP\214\202\034\222\327\233\nIW\033\022\252u\334"
+	.ascii	"\370\334\004\322\303mf\277y Q\325f\001\302\201\360s\200l\336"
+	.ascii	"\r}\321\313\273\257\377Za\255\266\325\236\347\">\344_>7D\204"
+	.ascii	">\367\271\027\241\237\244\3468\361\003{v\330`\b\234\004\332\340"
+	.ascii	"~\007\304\025\276\354I\350'm\320GGA\366\354\037\304K-\233\372"
+	.ascii	"\334\214\302\357\b\312\335\375[Q\251\271\005\220\340\306\351"
+	.ascii	"A\331u\267\264Ec4\233\270\311\324\370hO\375.\341\341\340\214"
+	.ascii	"N\370hw4\341n\331\375\312\205Hh\233%\261{\274Z1\t2\362\361j5"
+	.ascii	"\240\035#\035\036\222%c\365\2628X2\226\370\202\271\\0\226\370"
+	.ascii	"\n\351p\211,\231\003\221\003\300\302b-\2318\002\203\311D\323"
+	.ascii	"X\337,\273R\226:\225\352\023n\305\317I\327f\267\354\177f`:\243"
+	.ascii	"\037\303\301\210-\332\324\272\373\036\246\230\351\265\252W2\252"
+	.ascii	"K\255\303hS\227\324\240\2601\321e\255\265J\0047uF\307x=7\231"
+	.ascii	"\213&\265\252\357{\n\250\003. p\002\241\312\323\006\026\201\311"
+	.ascii	"\207\376\264s\037\351c0\177\255X\331\236\\~1.Q\310r\267>hG\252"
+	.ascii	"T\330H|#h\254\343\347H\354\250\35760\036\332\232\323\272*\255"
+	.ascii	"\340=\260\360\236+\255H\234:!`\3609\tv#0\374\253Q.\353<l#\355"
+	.ascii	"8\217\025o\356\347v\314/B\317\016n)#\334\227H\347\352O"
+	.text
+	.section	.gnu.lto_crc16_ccitt_sbuf_append.10.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`\322\003U\033"
+	.string	"\326\264\263J\260\226Q:eB\271O\016\247E$)\253\252,\343i\221\036\221\257\214\302zOM\272\212\236\003u\277\237\374\340\313\323\200\270\377\341;\f\307\007,`\375\244\360\311\353\271o\310\356\247\257\227+\304\266hwc\377'\204\020\"wJ\001\237"
+	.string	"\232"
+	.string	"\240"
+	.string	"K@cM\021\253CC(1\026\234'\177\256\004\364\333QQp\236\244\037\332e;\211\303+o\004+D\022_U\255\302\232\223N`S\241\207&5\247\366k\334\206\356H\037.\253\325\350\207S\255B\004.p\236\264\360/\345\311\363\263\362\244u\366\223\013\203\365J zJTj\255\264m\241\243\243\360\036\251\356\344\270T\347\017? \b\305\007\f:9\232D\"^\300\200D\343\215U\325\323\211\247?\340\216\2162L|O\374\201\242(\037\320\304\251\331\240\326j\352\003\222\270\313\333\276\331~`\217.\001F6\315\214L\213:\246E\rcR\277\230\324..\352\331\235\356\026\223Z\326\242\216\231\324,&5\354L\367\353M\367\n\213\272uR\263N\352\363P\267y\341_>\351&\217\364\257I}"
+	.string	"-\025G\f4\325*\242X\245R\221O0\356\3647\375L?\324\237t\033\b\224\245b\025I\375\210(G\277\252Zk\203\035o\362\235N\264KG\016\335\317q\370?L\026\2563\351\356#7\326\240\003%\020&\217\367\370\271\217\234\204\263\304\320I\325I38O\306\350g\345\217\237\343:\354\n7\276\324\2470\214wq\322\031p\312\373N\3728\345I\230\265Y\362\344\262\262}Y\223\251\207b\266.\376\220\0139\276\013\037\250<9[s\352\247\"\266\262\375\205\374\265\261-\247xWw\220\022\266,{^\225\327\3026"
+	.ascii	"\221]\212\"\002\256[[\356\312\322$\274\031\347\266\366\304\217"
+	.ascii	"VEK\275+!Z4K\261X,\262\366\\\323^\212\035-J\225\346\262\266f"
+	.ascii	"\2127\245\\r\315=\220C \0214\302\243\261\243E\303\350\256\275"
+	.ascii	"\243\201\336G.\001\036'\250\2066\310\026\356\350\036\331\277"
+	.ascii	"\tZUy\00398\264\206\253\355\355:=;\267Q\247gg}p9>9\322'\247\263"
+	.ascii	"\256\331\324p5Z\217\215\207\307V\243\365l\310\341\241\325p9\232"
+	.ascii	"\215\214m\267\035\034\315\307f\303\321\\B\241\257\221=\216\257"
+	.ascii	"\245\211\260\202Jhw\206\241_\n\025\350}\026@\264A\246\331\357"
+	.ascii	"\207?\020TB\356\221Ou\343\305\316\354c\330\270\242\345\266\354"
+	.ascii	"\357\304\237Rn \255\314z\244~\256|\355\317\266[ve;\f\231\fQ\253"
+	.ascii	"\261\326Z\307\004o\331\231\275\025E\305,\314\312\354\211\227"
+	.ascii	"9\351\241\330m\314\2326\331\023^\304\302Y\353PD\250q(\243\024"
+	.ascii	"B\004\021\346\004\"2BJ\253\003p\002\221Q\347\001\020pI\242B\007"
+	.ascii	":-\244\023\361\347\214\363\313\003\007)\024+\324=,L\317\247\\"
+	.ascii	"\0205C\2651\353\361\213k\342q\206\217\230\375\227\017\244t\220"
+	.ascii	"\316Z\212gC\361\326\033\222\3311k\203\325\025\210\f\2153\317"
+	.ascii	"&\007\2626\330SH\323\216\276\205\213Xx\022F\002\006\022\355y"
+	.ascii	"[kD/\250\272D\334\236\013\222\223\242\213\373\326\326\313\213"
+	.ascii	"\372P\026\0061\260K\n(iq\241\332\2320\250\255\376\230\3540\354"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2.11.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\r\t"
+	.string	"V\321>90\345(\035\036C3H\022\261('\222f\004e\"\f\252P\345c\020\326\321\373\361\255a}n\321\214`v\206\035)(\210\020J\212fz\222\007\203C\215k\215\220-eJ\001."
+	.string	"/"
+	.string	"-"
+	.string	"\266\315\320 2\367\216\003\225\255P&\223\227\335\016\352\306\271'\347_\344\017\246\003\345\224\032=3\017\273\353<\2450n\275m\003\333\n\266c\002\316\336\372\337Y\277f:5\375L"
+	.string	"\b\013\302\311.\352\005`W0\327\207m\221\275\261[\003-\t\231gq\326]\215\220\224\335n\301\007\232c\001#'\001\275{\034sE(\373\351\230\037\312\216eJ\340\342\272\246\336\024\200\224/?U\275>\025SF)_v7J]\331\177\253*\333\031\235\307-\252#'n\021~4\217G\213\360\023\321\361\300\270\201 G\300\232\004\304\006)4m\203\233n\377VU\231\026\220\264d\361\222\t\315\356\205\203\037\016"
+	.ascii	"2\241\377/p+\312\233&\036 8\327\360\236,J\300\004\b\252\201+"
+	.ascii	"`\256\317\300\323\363\240\251\235O"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_update.12.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`\t\002\235\022"
+	.string	"\346c}H\340\320(\035\232\302p\032\236\362\246|\201\255\373\037\017~31\001\f\312\017\324K\221DM.\353\236\372\007\376ecm\351\245\252\236\231a\217BbX\203\fs\212\037\273W\215\275/\301a>\234q\275\266O\310\336[\312$\003h"
+	.string	"i"
+	.string	"h"
+	.string	"!\341\007\314\313\356\002\346\245\356\376\246\245\334Mc\361\242;T\240\007\272\313\006\016X\332z(\3432cB\264\350\354\350\016=&\321\332\030^\343\266.#oK\177\252\325\210\315T.#\007s\2411\315`\361TD\364s\333W6sm<\361r\276\355\tj>\261\331\313\227\223\320\335\272\261Y\207\353\274\252\242T5\202\352N\b7?\351;\327\321s\376\356\341\317\275\347\346*w5r\253\314\255\356\\="
+	.ascii	"\222\214\031\brt\273\334x\264\220\3741\361\235\277\347\253\312"
+	.ascii	"\322\363\334\246\245\036\224\330\037@\372\245C\253\201\260\203"
+	.ascii	"\362f\3410\222\301D\020u\207!\227\372 \2528\016\3539\032\"H\277"
+	.ascii	"FlX\320]\026\210\274\252G\361\024\254\207\232\343\001\272a\206"
+	.ascii	"\002\254\252\371\260\330\250f\270\017h@\246\373u\322\267\270"
+	.ascii	"\013\223\370\231K\265\200\232\217]\352Q\363\362\203M6~\230#_"
+	.ascii	"\3622s\034j\361\340\372\212\025\330\315\350Q\346\345\362i\265"
+	.ascii	" \031\210\225\275-\363\004\301f\254g\216G\2744Xl\\{\323\216\317"
+	.ascii	")%n-=V\366\246\032\252,\307\250\376$SD\244\f\243j\372(=\252\223"
+	.ascii	"\244JT\261\302\t\205T\311\2059r2B\022\277\325\307\372\211|\253"
+	.ascii	"\317K\201(\024\370y)\223\021\224\367\2550x\"\004\024T\225\254"
+	.ascii	"\274\023\020\\y\245\260\3170\2521J.\225\330\024\213!\264\302"
+	.ascii	".\3111z! \032\233\37050p,\307\223e\267\275\323\001D\303\037\254"
+	.ascii	"qI,Y6\342\311)87^[\364\330\335\035\031|\262)& P\002A\210\331"
+	.ascii	"\016\226\300\244C\237\333\271\233\276W\363n\305@\363Z^\212\013"
+	.ascii	"\017\323L\305\342\325\036\266\025p\306\310\373U3\023\260;\270"
+	.ascii	"\265\326\305\312\321l\274\231f!\016\360\021\t\264#\260\303\257"
+	.ascii	">\372e\335\2075\302\202\250\333g\373\263\007\2235\023(\241\345"
+	.ascii	"\367\313\035\341=\001"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_sbuf_append.13.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`o\003M\031"
+	.string	"V0\246I\240\230Q:\020wL\215\221'\0361\231\026\305\227\313\341\004\035\200\317\355\210\301\370\301EF\301\323\234\254\355\345\343\356A\301\302\372\207\212\317\226s\361:\274\016kp\355#\2217Y\215\003\257\360\342(^\f\374h\204\020B\344N)\215"
+	.string	"\220"
+	.string	"\225"
+	.ascii	"<\273\233\n\232\362\342<\222W\266\217<|q?\252\021JnH\355\366"
+	.ascii	"f.\232\201={ \234\314|\332\317q\035\265\033\205x\314\356\n\246"
+	.ascii	" \273\275\004>P^t\357\001\306\213\345[\343E\327l(\357\t\355}"
+	.ascii	"E9\037\225\335ui\213\332\f{w8k\027C\2355\037\351\004\210\226"
+	.ascii	"\350x\".\206\344\215\004\f\026\357\026\326LI\001\377\373\334"
+	.ascii	"\361l3\224a\342\372\337\021\f\375t<\023\237\244\204\335\365\324"
+	.ascii	"\361J\334\343m\313lO\260UF,\323/W\272Y,\323.g\272[\276t\257T"
+	.ascii	"\323\252r\272,\247\3117\365~\361Gwx\243_\311\351\003`\241\202"
+	.ascii	"d&i\227D\320\312F\211\300\2423\375K\277\322\337\364\037\335\006"
+	.ascii	"6\031\nf\223\354\177\242\334pH\355\256\004\037_\362\231\376\363"
+	.ascii	"\252\007\217\332\316w\370@\310\022Fl\354\356\352Jn@S\373\017"
+	.ascii	"Z\270@\021|E\344\264\033\320\354\374\007m\001)\344\226\"\301"
+	.ascii	"EC\330\361y\274\207WI<\341\002\301\254\217/(\306\203\362\342"
+	.ascii	"\316}\001\005\204v}j\374\"\207\312\020\332\274\306\353^\343\305"
+	.ascii	"\030e1\001*\214\236\245.\372\242\341\223\334\t\"\032`\376\013"
+	.ascii	"\237g\274\350\242\017\032z\332\241\320\244\247\033O\255RQW:\225"
+	.ascii	"\340h\220\252\322\377\036N\271\b\346\256\274\004\203\301`\251"
+	.ascii	"\244z\346\200n\250q\324Rg\234pSl3hQC\035\365\300S\370!z\302\325"
+	.ascii	"\260y\303\235@\224\273\353\300\037\322\201\203\001\241\335\375"
+	.ascii	"\213\020#9\003\252\212Q\317\f\332=\333T\026\366k\204\246\244"
+	.ascii	"\254+\354\226L\f9\r\0236\031\346k\366R\331or`\262\360&\007\246"
+	.ascii	":3\033\035\232\250C\273Q\277\024\274f/WN\f\007'\366r\345p\260"
+	.ascii	"\301q\275f4\227\002\001\216\311`3\227N,6s\255z=\017C\226\266"
+	.ascii	"*T\211\352Q\233[\363\252j[\2700\257\363\200\233\212pK\257G:\002"
+	.ascii	"\242#\271+\242\262\360\243\234\202TF\037C\b\224)j\213\356\376"
+	.ascii	"{)\305\t\206\306\250\303\351\323F\226\356l\273EW\372\001\251"
+	.ascii	"\211\317\234\nwwC\006oQ\031\225\r\375p4\276dc\270\021X> \200"
+	.ascii	"\002\021\272\263\rj\240\036\013\225}\026g W%\3577H@f\307mr\257"
+	.ascii	"x\223$-g\306\b\310\301(P\231<<}|\263B\223\301qpO\323\032\322"
+	.ascii	"\032\036\222%\256kq\305\275W\360\266\300\216voZW\363*$\350\326"
+	.ascii	"\231\270&:\004\332k\b\307\031\262Y\210\231\343\262\304\306j\222"
+	.ascii	"\002\363\255\321\251\026o\357\212<\223\234\263E\274\243\205t"
+	.ascii	"N0\007S\020\007g5\257ln\200Q\226{\004\262\006\031\240~\220?\345"
+	.ascii	"\316\325\237"
+	.text
+	.section	.gnu.lto_crc8_smbus.14.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\335\b"
+	.string	"VQ=6P\215\322\001\263mf\bE\320"
+	.string	"\301F\203\246Z\342\303\320\217\202\265_\177\251\265\206\\|\240\303\224m\260\353\316\314\264H\304a\246#\b\345\210\336j\226\220-eJ\001-"
+	.string	"-"
+	.string	"-"
+	.string	"\266\215\220\340\361v\356\202\204\241V\"\217\326.\007\325\342\333s\363\257\361\327J}\214J\237'eaw\235\243\222\351\326\333&\260m`\273$\306\276\372\337U\277f:5}\212\305Dr\351vI\235\311\216\\\254\f\333\036\333b\257\002D.\231Wm\326\335\nU\310.w\340\202\312\257\033\347\340\274\247~9\242\203}\364\313\357`\2770\025\300`]S/:\001e\347\247\252\327\007\"\242\begs\237T\224\375\267z\262\235\001\231G-\252#&j\021n2\215&\213p\323\220\321\300\250q \006\300\231\003\203\006!\262L\203\026n\377VO\230\016\2004$\361\216\207\312\356\204\202\037\016"
+	.ascii	"2\241\377/p+\312\233&\036 8\327\360\236,J\300\004\b\252\201+"
+	.ascii	"`\256\317\300\323\363\240\251\235O"
+	.text
+	.section	.gnu.lto_crc8_smbus_update.15.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`\t\002\225\022"
+	.string	"\346#}H\360\320&\035\372\305Z\272\035\323\363\334\200\352\256Dv\007\204\202#\256\335\276+\347\242\257a\2434\031S\033\354v\214&\005\256g\306\310l\304P\374\260$Y\034\206:\241qA\346\031\021NdO\260\332\021j\204\220\275\245L2h"
+	.string	"h"
+	.string	"h"
+	.string	"!\343\007l\237\335\005l\237\272\373\033\226r7L\017\213\356Q\201\036\350>\0338X)\353\343\214\313&\323\323\242\263\243{\374x\004k\345x\225\313\372\224\274,\275I\006\003\026S\371\224\334\313\205D)\366\222\246\"\242\240\323\276b\254\265\322\304\313\371\264#\220\315`\261\227/'\241\273ua\261\016\327\355\252zR\325\b\252;!7\377\307w\256\243\347\374\335\307\237;\317\315u\356\252\344V\231[\335m\365"
+	.ascii	"<\0241\022\314\350v\251\361\350\241\031T\342;?\317Wu\245\237"
+	.ascii	"\235\246\036\017\212\354\017 \355\322\361\251\201\260\203\362"
+	.ascii	"f\3410\022_?D\335c\310\247>\220+\216\263z\216\006\t\322.\021"
+	.ascii	"\342\202\356\323\200\344U}\212\253X}T\034\017\320\035s#\234\222"
+	.ascii	"\315XlT3\034(,@\243\333e\322\373\374\307D\236\346S-\234\266\303"
+	.ascii	">\365\247\355\223\304\245\032A\314\222?y\231Y\312h\361\320z\217"
+	.ascii	"*\354h\364(\333\347\362C\310\200D\020+[[\236\265x\305X\317\034"
+	.ascii	"\217xe\260\330\264\266\246\035\237Sht\264\364X\331\232\352\250"
+	.ascii	"\262,\243z\323L\021\221r\214j\211\344=\251\223\240JR\262\302"
+	.ascii	"\t\005T\311\205m\344d\204D\202*\220\025\024\001U\340\207\nO\247"
+	.ascii	"\020\374P&#\247\017Ta\370D\bh\230*Q}'a\250\372\274\261\3171\252"
+	.ascii	"RN\366<.\211'\206V\2705YF?$\264\201K\374\032\027/\226\343\215"
+	.ascii	"\305\323\336\345\020\202a\022\253\334\017\236,\216x\343\024\034"
+	.ascii	"\033\256-\272\354\356\226\f\276q)& P\002A\210\331\016\226\300"
+	.ascii	"\244C\237\333\271\233\276W\363n\305@\363Z^\212\013\017\323L\305"
+	.ascii	"\342\325\036\266\025p\306\310\373U3\023\260;\270\265\326\305"
+	.ascii	"\312\321l\274\231f!\016\360\021\t\264#\260\303\257>\372e\335"
+	.ascii	"\2075\302\202\250\333g\373\263\007\2235\023(\241\345\367\313"
+	.ascii	"\035\341=\001"
+	.text
+	.section	.gnu.lto_crc8_xor_update.16.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`\306\001\365\020"
+	.string	"\306\240rF\360\320&\035\372\305Z\206\035\372c\264A\314\214\244\376\210p\374kr\316N\372\t\252\203\246h2\273\241:E\243I\201\353\231Y\333K\247\343\207\305\307\3420\324\005\241\205x\276K\222\017\226/\007\271F\b\331[\312\224\002^"
+	.string	"`"
+	.string	"["
+	.string	"\316\274M\312\272\373\341\265b\367\013\261\201\355Q\301\002\224S\377h`\262\231\037\027\235\033\273_\247!R\t\277\033f\352\021j\246\374\021\227\215\227\226\312#\324V0.\217\326\n\216\f\t\371\374\365d\265T\tI\304\\\377\372\001\027\320K+\346\251=\330]\347Kk\303\235\335\366\310\266\003;?\002\206\267\271UKg\226>"
+	.string	"\356\247EHl\027&\206c\203\242\317\210\357\374=O\033\345\363\374e\256\007\005n\207\217e\321\201Q\323`\007\345\333\242A\304Z\305\020\332\375@\036\315"
+	.string	"\2368\016\3529\027\340\307\262\200\300\200`{,"
+	.ascii	"5\355\337\334\004\352\237i<\300\256\214\f\220\357\003\262\307"
+	.ascii	"\355\002\262\307,9t\270\273\013\023\034j\207\232\\@\252\251\234"
+	.ascii	"~\206\013\007\325QX(m\"|\224\3541\025\202\353\005\313\303J\306"
+	.ascii	"RyX\254Z\352kTM\323EK\tU\306\234\3515\305\245\302%\307J\306\354"
+	.ascii	"O%u\306\376\b\315\220\220U\306\356\340D\267\371\267\357\334\332"
+	.ascii	"s\376\354\337\037\337\363\246\227\220LLP\302I\004\222\t\205\214"
+	.ascii	"\344\204\244\004z'O\355\211x'\257#\225F\243\222\327\221&\220"
+	.ascii	"\214:\357T\241\023!\340\222\311\344\324\235\224J\247\216\373"
+	.ascii	"\366*cC\250*\022\251\007\013\026\264\242\252\2503~\020\354F;"
+	.ascii	"\3645\260\f\031\025*\353\257o5`)\224S\303\334T\225e\333\232B"
+	.ascii	"M\301\221\021\" `\002!\265\316\001\226\300\304C\237\265c\263"
+	.ascii	")\324\312\362v\024\320'fZ\264\026Z\2033\267\274\273\232Z\301"
+	.ascii	"= \324\236#\255X\2348!\300\340\003\tt#\260\303\2572\372\262N"
+	.ascii	"\303:\302Z\324\355\263\335\330c\310\232\t\224m\371\371rG\240"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_crc8_xor_sbuf_append.17.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`+\003\315\027"
+	.string	"\026\255\233H\300VQ:\273(\254B\330D&\375>\345u4Q\243\255Fz\353\304\367\335\355w\233^\203\037\325\356\355\362H\266\246Q\240G-j\022\236\374\177E\333\377>\2612\371yE\rh\020%\337\327\177\365\244\226\020B\210\334)\005\203"
+	.string	"\210"
+	.string	"\212"
+	.ascii	"\266w<|i&H$\216L\031\332-\023\034t\003{\226 \224$\370\264O\343"
+	.ascii	"5b\327\t\361\324\356\212\236\036\273\245\002#\030\017\272\374"
+	.ascii	"\200\360\340x\001\341A\307\354&/q\3669\242ZN\312\356\252\224"
+	.ascii	"El~\345\375\315\330\301Og\314\347\271\201\234(57\021\007?qV\002"
+	.ascii	"g\272\315>\b\274\241\335u\237\266\233l~/P\\\257\373\n\216H\315"
+	.ascii	"\r\305\247Haw=kn'\356\360\266]\266+\330\372\022\244qz\034\247"
+	.ascii	"\305\003\225?\370\235\373\273\316\257\342\364\003\220EET@vK\364"
+	.ascii	"\212V\b\334\345\374\347\367\371{~\240\177\347\366\016\310BPk"
+	.ascii	"do\302\311M\321\320\356R\320q\037\377\347:\2239n\304dn\303\347"
+	.ascii	"!\2368\232\261\273\344{\354\200%\366\035\260om&\344\210\304i"
+	.ascii	";`\221\371\016\030\003qw3D\301AK\220\361o<\207I\0343\337\332"
+	.ascii	"\240vD.\211\213\b\343A\231\347fl3%,\343\301y\036\223\001.\034"
+	.ascii	"\021Z\f\223\252\350I\317\244\226\"\210\006\027\277\205?\023\036"
+	.ascii	"TQ\f8$6\025\212\003\310\354\246&)\250\244\316#\264\030\242\222"
+	.ascii	"\364\272\177<\234\256vt\352\365z\275QE\365\254\331\334B\302P"
+	.ascii	"G]1\242A\221\315\236A\3754\324\357n\201\227\203\204&C\346\r\377"
+	.ascii	"\001b\334\335\007\276\217\016\034\016\340\264\b\021\2120\214"
+	.ascii	"\210thf\317.eSo\354C\300\341\rYW\330)\324\351=\267\t\300\264"
+	.ascii	"\312\177\356\322}n\2224\035\253\f\223\365b\251\353-0.\256\257"
+	.ascii	"\005\306Ec^\253\030\030\030\003kQ\263\026\260^,\025L\353\345"
+	.ascii	"\245\305R\301pX\275\250X/\230j\001\001\267\\./UL\253\365R\221"
+	.ascii	"%\315\277\317\244\251\013FB4*3j^U\355\025k\276\306\005f*\302"
+	.ascii	")\275\236\347+9NjG\240\336\370BA:\212\322\273\b\"1A-\251\355"
+	.ascii	"\272\217O\202~\364\244\376\246\017\013Mj\263\355\222\222\372"
+	.ascii	"\201g\311\210\311\373vw\277\006/)J\003; p\002\031\272\353\006"
+	.ascii	"j\340\034+\233}\026y \227\001\3575\210Lf\034\372\317#PNp\362"
+	.ascii	"\230\365\361\315\nM\006\307\301\275Ml\241\304.\260\r\357\310"
+	.ascii	"\222\353Z\\1\333+\304>\330\321\302M;5\257W\002\267N\3055\331"
+	.ascii	"!\330\336\206p\230!k\013\3219_\226d\254\026R`\2775\nU\306\333"
+	.ascii	"\271\"\317$\347\274\"\334\321&\235+\230\003\024D\202\253\332"
+	.ascii	"\25607\340(\357=\224\254)\003\324\r\362M\271s\231'"
+	.text
+	.section	.gnu.lto_.symbol_nodes.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"\355\004"
+	.string	"2\007\033%\240)\035\330\373\252\341\3125\362\312\215\376\231TU\325\373wPo\355\177k\204\020B\310\336\204\264\266K\276\3342\005m\027\224\316\244\345s\271\314\306\313\\\330R\230\302\266\354\177\313\310$\\!\302\323\301\222\301Q\241\021\374,\273\312\020\025\230\374Hv\230\203\202\271D\036\260l1\362\3274m\031\344\225\326\255E\202\200\377w\026\260\266\370\b\023"
+	.ascii	"\255A\222\326\020\326\221\200i\007\250\007\037\360\013T0<{8\223"
+	.ascii	"8@;@\035p\033\370\034\240\035\240\016\334&\205\317\351\244\263"
+	.ascii	"G\247\312"
+	.text
+	.section	.gnu.lto_.refs.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\007"
+	.string	"\001\002"
+	.string	"\001\n"
+	.string	"\001\003"
+	.string	"\001\016"
+	.string	"\001\004"
+	.string	"\005\003"
+	.string	"\001\006"
+	.string	"\005\006"
+	.string	"\001\007"
+	.string	"\005\n"
+	.string	"\001\b"
+	.string	"\t\003"
+	.string	"\001\n"
+	.string	"\t\006"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.73d0a0a5d2a38455,"e",@progbits
+	.string	"(\265/\375`\355\r\335A"
+	.ascii	"\312m"
+	.string	"\f\030F`\330N:'\366\035\302\330h\312\301\034\2024\342\314C\026\205\320\353\276_\262Z45k\231\307p\3242F\033\276\250%\f\324?\253\247\216/\350p\223\216\037\331\340x\325\213\373Zl\340V\037\245\3608\242\ri[\2461\001q\001t\001\255&\324Q>\301\302\211-\332[\226\343t\002\211\342\365\017\330\267P\261\253-\364\326n\305\253\030wN\274\276\335\376~\333I\267u4\347f\316\031\210\207\357\n\215\213\327F\353\264V#\352\265\367\223f{\r\325\233\337\234_\036\f\344\260-\r\257\306\376)\342\004\354\377\351w\320\262\205c\366MT$V\253MT\034\312\375S\\s\373\024\373\f\371n\342S|r\275\231'\347\352\252\210 ^\273\332>f\1773\3512\"\242\213\025\315l9\277G\2669\367V\206\327\277\375Sd\333\247(\340\307\037_\020p\363c\n?@F?>D\177\027\031i\371\2177\367"
+	.ascii	"?N\220\363\343\003\021\260\316\337\007 t\202\007%\332\001\320"
+	.ascii	"\217\211Qz\bw\376\036\323\r\376/\370/\202\375{\213\203\277Y\354"
+	.ascii	"\363\237\314\337_\376f\360\267\202\277\207\376&\360\267\200\277"
+	.ascii	"\201\376\376\371\333\347\357\343\337<\177\337\374]\374\273\377"
+	.ascii	"\023\376\017\374\377\367\177\356\377\323\377\275\377\005\376"
+	.ascii	"\263\375\257\362?\357\177\335\177*\377\345\376\307\375w\373_"
+	.ascii	"\366_\350?\226\377;\325j\265\372\023\377\267\223\037@\201,\334"
+	.ascii	"7\372t\337hk\314\315h\233\363\0135\272lTm\273S0\250;\215B\217"
+	.ascii	"\271\231\333<\245\332\3016\243P7K\024jt\247TP\267\t\006=\322"
+	.ascii	"\370\301\243\313\n\fMG\343\271\315\254\225\345E\3654R\3357\232"
+	.ascii	"\367rn\266\252\374D\220\263W\364\271G\265\325rL\252\026\023\216"
+	.ascii	"*\332o\316Y@\0263,\232\233T\367H4\347#L\0259\253B\373R\363XS"
+	.ascii	"[1\257\214U\225\363\200\254\234\333\316\324\234s\233s\266yz\275"
+	.ascii	"9\3430\272\322\254\254\234\271\202\262\262W+\245*g\314\326'\007"
+	.ascii	"u\247aQ\244\224\265\2514\303x\333\226\346=\260';m\235d\254\234"
+	.ascii	"s\007\262R\350\f2xm\275\356\322jE\355\345\375\245\367~\323|\363"
+	.ascii	"\364\306K\340\027\033^\207\246\330wQ\221\247\213\270\344\351"
+	.ascii	"\b1\202\306\304+^Pk\345\315\035\342\365O\354\373\256\325\232"
+	.ascii	"\332vo,\235\345Ao\316p9\347w\231\226\256\333i\2179\213\231Is"
+	.ascii	"~O\341GR\373J\327\021\337\"9\213\345\340i\343\326\266\006s~\203"
+	.ascii	"\0324X\231i|Y\212\3537\260mDb_\301J]\315\324N\360\256\216\016"
+	.ascii	"s\321\202\305\254BeUB\205[\243\362\367\224\236k:\023k\030$C\254"
+	.ascii	"\262N\032\2624\205x5\346,E\210\347\265\221%&\027G\2742\023\214"
+	.ascii	"\303k\3035\2248\006v\362\360b\307\324\334\314\264\216\235:H\236"
+	.ascii	"zfx\305Y\r\244\3229\274b,\034\206]5\354b\253\236\347\2074\034"
+	.ascii	"q7[~\\S\240\230\211\231\270\n\347\314\303\t\310\366H[{\362\342"
+	.ascii	"\270\252\351\330,]R\372\360\212\233Mw\244\227U\005\277(|!n\233"
+	.ascii	"K\203\232[\203%\317\365\303\371\270\275\030buF\340!^\333\260"
+	.ascii	"\253|Q\262\266j\032\034)\216\300C<\033\033L4ux=l\273/\031"
+	.string	"A\232\324\021\321\312\3124\tS\246L\023\366\344h\316R\233\265\2640\200\231\213\253\250\005\267\234\b\031|\023\336\024)\374\262\302k\237\351\266\232\251\016;4xm3\377[6\227\2205_\361\316i\210\306\216}\223u\217Q\3531\035x\343\256wq\200\371I\303\001\231U\306\215\274)\357\213#\227\243\215\006\033\373\356k0o?\265\366\353?\366\315\316b\332^\214\263\301\314\345U\324\355\227\325\236\230\367\337?\301B\267\345\344\\\226s.\320\316\2533b\360\332a\272m\347\253\310\034\037^_FH\007L\024\275-x}\207\261\307\1771S=s\3162j\336\374d\346\024\273\246\273\350\327ib#\370\277f\342\177\366r\256\361C\2205\022G\325\205\327\377CyI\316\3551\277\371\351N\301ZW-\017z|\363\016\240<\025\313\356\013\006]\243\031\3477wn\202A\003H8\312e\b\233#\344\b\246e\223\222DN"
+	.string	"%\224\013\236\243Qjj\311I\n\300q\202T\322R\213\023IHIe2*J\t\210i\251t\"j\252\207i\305\222\3222\351\370\240\345\262)\231L:B&\225I\234'\233\224LOL)\330W8\202p\204\344\302\346H\031$d\220P<R\006$2\303\021\222\375\021\222\270L\232@ay\025\021PL-9)1)\227R\006\016\025\305\2444ZBA)\215pN<1\021\245\222PL-I\025\225\313(\3422\t\311f\231t\204\\>5M\261G\"9\f\215"
+	.ascii	"\321\201MFH*\223FOPNNPI\243\247&%'\243\244R\312(\002\220\024"
+	.ascii	"\217\231\371\"B\304JI\225\272\302!Q\242\226\222?\030X\b\026["
+	.ascii	"\205\264Q\005\343\336\033\274 ;\266` \201;\203a\206O\360\332"
+	.ascii	"\243\007\036k\343\313\364s\003l2`dV?\216\307\200\334\361\220"
+	.ascii	"\201W\354\243\253/\214\030F\351\302\314\370\305%\001\003\303"
+	.ascii	"bAl.;\322\007x\243E\017\316,\354X\254\353l\320\004\367Z\021]"
+	.ascii	"\372\266\fa\361\327"
+	.string	"\027\2166\232\201\267\252\263%9s\025\341\210\275M\315\3508\216\326\f!\204B\305+\316\321\325\233$|k8\332\326&F\270z\354\350\352\"\004\344\351\352B7\210\327\023\261n\334\300N\017m\316\25513\273\334I1\020y\341f\270\265\205\235=o;`\376\372\f\373j\3240\303Wf\3148[\317\366\306\250D\301P\f%\242c\306$GN\202c\004\201!\250\2610G\2304#2\"\"\222\202$I\007a\005\304 F\255\353\006\022`U5\022\032\310HF\222\244Pg\231\003\210\025\360\353\025\262\022\271l\303\030'!\277\202G\t\271\254\347\013\210\231\271:\002#F\bve\026\331\210\340\231M(\027F\242\002\214U\326F\354\025\\\313\312\231Ck\177l\304\262\310\214\200\340\013C\f\336T\332\002\003\314\256\375\021IF\017h\360\3158\344`/\206T\357\354\237\0357\b\245\224\315\251\373\003\301\005\253V\203\351"
+	.string	"\264\333\223\371(\306`\0369\023\r\004;^\302\004o\202@\263\255)\026\367J\334e\364\373kX0`\207\270\003V{\325[\227\337(0\f\330\266\n\320T\271\360\203\343+;t\346\323\333\367\356\224\366\240.qj\277N3\371\357\352\330\231\227\252\325C!\217\253\317\351;tH\216\034\301o\262|\020\223\313\\$\344\013=\222iC\327\013\355\177U\004h\355h\f5R6\353\202\201\267"
+	.ascii	"J\222\177dM\302\361\314\253\345m\2439k\213[}<\361a\307\273\340"
+	.ascii	"\033\006\312\377n\226\320\346Yc\370\275\r\3069\241\331D\bk.$"
+	.ascii	"\034u\341\276q\264\217Y\331\315\361e\023$\262\277\253\326(\206"
+	.ascii	"\334|\351\2164'\032\212c\"\227D\2570\341\360P\002]]\352\276\225"
+	.ascii	"\2623_\312J\376\0372\217\"\023\267\302\215\350\312\3134\256b"
+	.ascii	"\270f\316b@E\372\233\221\242\356\364\341~\334J%vi \f?\r\323\001"
+	.ascii	"m2n~\240\233w\262\216>\220:a\357\250J\342t\301\307K\3221{\023"
+	.ascii	"W\362'\252{\253f\236i\360\370M.-\330m\032\234\356\215\023"
+	.ascii	"%\022\266\375lA\367\326\316\323\360\244\234\351\363b\224\261"
+	.ascii	"!\361\025\t\356\256\234\202\324'>\220\345\021\272@\331q;\376"
+	.ascii	"$\373\263]*\360\263b\211\236\0208\2139\350\177\207\035\315\304"
+	.ascii	"6\215_\020\374\304\341\351\274\217\364\233\371\224.>\220\037"
+	.ascii	"l <\021\3705\2733/qo\300\217\233\367\333u\315\026V%r\027sA\374"
+	.ascii	"5\343\037\314\033\003\325\260\330\273C\221\244\236*"
+	.text
+	.section	.gnu.lto_.symtab.73d0a0a5d2a38455,"e",@progbits
+	.string	"crc16_ccitt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"crc8_smbus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"crc8_smbus_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"crc8_xor_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"crc8_xor_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.73d0a0a5d2a38455,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
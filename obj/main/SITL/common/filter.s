@@ -0,0 +1,1121 @@
+	.file	"filter.c"
+	.section	.gnu.lto_.profile.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\261\001e\t"
+	.string	"D\r\245\002"
+	.string	"\030"
+	.string	"\203\255\266\373\b"
+	.string	"\001\356\361\330\337\f"
+	.string	"\002\321\307\201\370\r\004\002"
+	.string	"\002\001\003\353\220\276\200\006\002\004\263\311\277\326\001\006\005\211\337\230\303\002\006\217\364\362\333\n\020\007\352\200\350\342\007\003\b\232\210\216\246\013\n\t\211\306\217\210\017\n\225\326\304\223\t"
+	.string	"\013\206\223\232\231\013\022\002"
+	.string	"\002\005\f\311\276\204\302\004"
+	.string	"\r\245\233\254\343\013\020\016\344\247\274\230\005\017\302\265\230\372\n\032\020\243\352\335\360\007\021\364\320\263\316\r"
+	.string	"\022\235\227\344\354\r\036\002\006\002\007\b"
+	.string	"\002\t\002"
+	.string	"\t\002\t\023\247\374\307\340\017"
+	.string	"\024\205\216\367?\022\b\025\260\276\235\311\b\024\026\267\320\322\347\001\n\002\n\002\013\f\002\013\002"
+	.string	"\002\013\002\r\002\013\027\332\256\355\220\007\034"
+	.string	"\013\r\002\n\002\013"
+	.ascii	"* \320\002\033\353\006\336\310\003x\253\233\021\002\026\320\356"
+	.ascii	"L-t\003\244-<\231\033\254\251\351bp\204] \262\213\241d\331D\213"
+	.ascii	"c\006\301\362\311\003\312\364*\276\025\306\242\306\025p\230X"
+	.ascii	"\314\240\316\201\220\330B\027\022\324i`s\233t\315U(X\030\037"
+	.ascii	"\306\013\243(n"
+	.text
+	.section	.gnu.lto_.ipa_sra.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\005\006"
+	.string	"\222G\026\036\240'\351\377\377\377\377\217c\003"
+	.string	""
+	.string	""
+	.string	"\360{\373\377\377O\276\375\326\032i\255\221-\245L\001#\030\353z0t\026\224\022:@\335\004\235)\2606\373\332w\033"
+	.string	"=\243\330\331\220\323e\026\334\376,\245\322\377#I\253Z=\033\222h\225 \345\261\236\326\272Y\256\347\347\211\327\b1 \320\002\032\252y\354-gK\240%A\020@\020l\366\220\215\224\243:\330\025\021\340\307F!\301\341\310\226\224\361j7&\"P\031\230;$\205\364C\351\255\340\034Q\025\301P\200\243P\210\346R&\230\266\345\300a\001\f\204\006\001x|\021.B"
+	.ascii	"H\340.\361?\026\360\006\032/\034\254C\313\223\223\302.\302\020"
+	.text
+	.section	.gnu.lto_.inline.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\270\n\375\035"
+	.string	"F\343l?0\215\223\306\020\352F\211\236\274f\367\025k\036`\241\022\214\2216\212&\002~\022\366^8\214\203\364\201\214lS\177\346\2521\024B\325A\016q\343\240Z\004\360\033\355iaf\326\266\021\273\245\224)P"
+	.string	"V"
+	.string	"^"
+	.string	"g'u vW\363#%\331`\252\251\203\335\323\305\325v\246\272]B\223\022\364{\247\333\235\357R]\265\314\3540?J\324U}\237\345\226.'g-Uv\327\355\326r\333\335t\236\304s5%\t\374\254\276\301\356\236>_I\271\273\253\237\361\246B.\313\367\033Y[\031\356%\353\216\353,K\236\377H\b\273\213\361~+\221\"\023\023TV.p\325\372\241&\273\313\361\3469\275h\376\211\211\f\246\326t\303m\223r\306\260\323@(\243\363:\226W\253\307\305\317)\256%]L\2013\320#\267uZ\247\202\2343I\337/\212\007\252O\206\254,+\037.\204\004|\026\241\364\3578\324T\205\242\032q#\"g\311"
+	.ascii	"\001\206\r\300\324\030w\273\324d\261\025 \265\326\356\356\211"
+	.ascii	"IU\273{\346\236\230\332pq\317Q\"\007\347,7\316\355X\243\261g"
+	.ascii	"\342\272\254W\312\325\234\253\262!\211I)\356\340\277\bu\251P"
+	.ascii	"\034\021\n5\377g\254x\220 \302\363\246dA1i\331\310\200\276<2"
+	.ascii	"\002\212IKh\f\024\2416\203\320\224\031v\267\363\305\017\177 "
+	.ascii	"\"\004\034H\216\330\025\001\260\305\265\033\351\204S\210\022"
+	.ascii	"YJ\r\033,p\350`\n~2D\323\016%'\251\317 \013CRq\331iy\362\200"
+	.ascii	"\002\006\f\227\351\356\355H\231Rr\322R\375&\345\366\020\223x"
+	.ascii	"E\200\365\250AI\006\321\214$\005\225\264\006p\002\031\2311\253"
+	.ascii	"\007\022\2403%\207\344\244BDDD"
+	.string	"\204B\031)(\243\260Pi\016\\\221\221\350\353\374\224\200\236\217J\\#sJ\212|\232H\251}\231a\204\336R\340\332\035\271\377V@\272\243\371%\t\252\264\235$\267\351\371\224\255&\363)\353\375\3226\355[\017'\215Wb\276F\225,\016_a\213\250\037\tp\266\004\002\302\320\322\222\356[\344\304\017\256G\0020\233\203\311\333\272\272\001\243\n\212\225l\002\212F9\222nH\"\021\"\016\235\005\310mk\277Z<\377ES\335\312<\270\351&%\033@\206\333\277\204\037\321\223Y\001\026\232\311\b\244\344e\2225\243\342F{\277\312\242\034\367\n&\333:\254\223\204\020\215\257\305\214|\034\313a&\305\304\206\216\r\246s0\364\034\311\242\321\210}\016\312\026\261\271\272\2305P\030i\237k\3521y\033\200\304\277\031y\177\245\344\207bA3T\202\352\"-\032.\314 \236|\375Z\007V\270;\236_\331P\322\354Z\320\362"
+	.ascii	"iYH)\216j)\265F\361fK\255\317\304\006\003\261i\207ks]\211\024"
+	.ascii	"\3738\203\303\367\231\374\013b\306\277\206\305s\224%A4n\242\027"
+	.ascii	"\205\310\357\251\036\b\212+j~\334U\247\221\374\025\020\312H "
+	.ascii	"\246\275\311\002h\367pMBS\372.\202\250\322\226\310\216\330\f"
+	.ascii	"\215l\005\251\377wA\031\317W\300\020\276\206\203\225mi\026\036"
+	.ascii	"$Ui\3314\303\357!)\344 \007\373\317\325yzX\310\324`7\252\026"
+	.ascii	".j\030\230\343U\374\225\002m\206\3348|D\277l\205M\250t\246(b"
+	.ascii	"VN\216\344\203j\242\310\301B\216\306!\211a\221\321\200!\242\361"
+	.ascii	"ub\274\b2\363\233\006\365\301\276w\362n\215{\300\t\030\"\317"
+	.ascii	"CO\003PD\006\024\201a\333\267\364x\357\307\262\335>[\236\311"
+	.ascii	"\222V\033\024.\354\301\347\255=N\270\3334'\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`T\002\245\t"
+	.string	"\342\r)(\2009\351 \023\3504|.~xp\f\314\325\350t\202\331\310\212\016F\007\013\366#\266\377\023J \243E\264\367\226$\245\024<\2379\270UaoU\232\3503|\306\207\0304\316W\214:\n\336Hj#\311%\203\251\bH\n\245\224H~\324I\271n\235\346\310>\364\217\001\273\335\232\243\006\001\262\013\311\021u\220@L<\244=\217$\301\274\265\326*}\353\215\274m\302\332\244,o\n\247\310u,\3348\310W\253\210Q\234of\300\371]mk"
+	.ascii	"\213J\366!m\027d\313\371\265\177\255{~\303\\\264&\002\027\205"
+	.ascii	"> p\002\241*\252\033i\f\3018\356\n\257\306/\242C\002\200\005"
+	.ascii	"2b_\\cg\255C9\260\027\331\261\217\254\\!\333\372\243\375\355"
+	.ascii	"\313<\342\341\213\265\026\3274\312\2171\212\212\330m\376\321"
+	.ascii	"\330,\002\021p\201\021\210\301->\f[\256;\302\330\"m\031N\204"
+	.ascii	"=K\206!c8,i\320\nd\227\216\310\367`\260\205z\025\214\234}\315"
+	.ascii	"0o\254&\260=:\rv\306\204\f\204.\374\301\232)A\013\030w:\316}"
+	.ascii	"y\253\303\260\032lq\335"
+	.text
+	.section	.gnu.lto_.pureconst.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375 M\r\002"
+	.string	"\322D\017\030\200e\032\003'\306\356\210\214\b\030\031\221Epzzzzz\322@\276\fny\345\224O6\311#\033\344\217;\3368c[\\\221%\006\020?\334\360\302\t\327\007\027d\201\354\256\273\003\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\345\002%\013"
+	.string	"\242\315+.\200)I\007=B:\352\b;\031 \032..\226j\270\246\330\305\364!\314\0071\351\326!\263\350\377\326\320\377\210\324\036a\333\254%\204\310\235\002;<@4\254g\254\214\355\244'\255\323D\030\260\202\225\031\006\233B\177M\346T=ynZ\003\247\027\021\251\340\227H|\222vI;\303\234@Y\004\252\342\322&(\266\340"
+	.string	":\214X\035\324$\310\330\260\241\303\226\350 \266\004\0262^s\226\024\360u\320\002\370A\212#8\232z}\314\024s\340\370T\2276>:\212\"\305\323:sJ\325\231\231\231\351\337\357\345\343xS\374)Z\264\267?7>a\004T\250\240\016\321l\2226\003\200\"\031\204\335\022\200S9\206\202\220sN`\214\202\231\205\345\332\0168\004\f\302A\360\337PO\345\377\034\364\034\363\300\351\372\340b(2\267\240Y#\350\345:\325\332\355\021&\236"
+	.ascii	"\021I5\2173\337\034\317>\020\237[\340\324%Z\016\215\343\220\314"
+	.ascii	"@(\200\370\002\202\222\364tTM\213\223\037\222\2310\306x\205_"
+	.ascii	".\\Zn\236\245\035\r\354\271\215\\h\035~\n)\236N\004\243\351\260"
+	.ascii	"\\~(\347\326\343P\177\337mZj\240\230\317\256\264n\307\024\270"
+	.ascii	"\1774\303\227\231\216rO\272T\0240|\235\271\037\203\177\221\331"
+	.ascii	"\333Op\357\017"
+	.text
+	.section	.gnu.lto_.lto.f95f9f9efd63bd06,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_nullFilterApply.5.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\265\007"
+	.string	"2O56Pm\222\016$\243\210\"YZ\257\315\203/%\247\264\024\231b\262\026T\230\231\335\220\311ja}\326\227\03573S$=Bb\025X\343\026\306\251mck\215\020\231\002 \211\217\207c]k2\332\006\004\301y\200\236\254\323\3114\320\303q\350@\215\026\0013\006g\237\215\006AY\246A\354?f\253|\244\337\205\342U|\f\271\227\361\255\362\221\276\245\266\017\323 He^\244V\022\3052\361\370\267\307~\347Z\372t@\346I\n*31/\324}C*\2625NT \223D\202\312\214\230\023,\265\216\226\377~\024d\373S\0259:\024J,L*\231\t/-\270jU\035\270j\275\215nu\333\355H\017L'\321(T\007\320\220\231;\321\b\243\277\376\b?\303_\n\013"
+	.string	"\322\032h41\264\n\3075|\232\305"
+	.ascii	"Y\220\225\220@\240,\203&\214\224\224\3165\311"
+	.text
+	.section	.gnu.lto_pt1FilterGain.6.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"=\n"
+	.string	"F\223E< \345*\035H9\002H\005\355\030V\002A\201\230\177\002\274\266&u#"
+	.string	"Q\220\357\331\\Q\343 Fq\245-\366\b*@\233(\\\306(\t\310Z\346\023\205\213\250\346\210\332&r\247\0244"
+	.string	"3"
+	.string	"1"
+	.string	"\255\247\200\2668\341\261\001\201\371P\021\260\273\034\347\006\231\317\355\005\231O59x\t\372\207\275\023 \226R\225.5\021\273k\231R\211\334z\333\t\266\037\354{\002\254\203\225\335\220\261\266\264\351r\362\327o\203>\314\033\333/\213\333\262\034\205\025\003`w\027>\355\020\312\032.\357\262\350\201]Y\253ew\031\254 \360i\333\017\252z\235/1\324\210T\213'\251\321hk\210q\254u\354\232:\252\312\022Q\263\223\034\355\260$\265\304\376\266\272\262/=\037\376\333_\256_^\372\032\202\022\024\262\002C\2228:\013\320t\347\371>\244\214\020\210\033y\"\221\327q\243\320\205\210\353\276\r\316\203`O\343\363q$\317\373\270M\270\337\256\253\251\034\223\236|\335t\352\007\240f[\022"
+	.ascii	"2\203l\215\321cb\311\f\177T \232\272\3035\361\327\242F\265\310"
+	.ascii	"6\0132\021dA\270\013\030\001\371\300\260\240B\013\200\312\330"
+	.ascii	"i\347\023"
+	.text
+	.section	.gnu.lto_pt1FilterInit.7.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\245\t"
+	.string	"V\022C;0\345\2521\200C\336\346\307\257?\004\346\201\216\210\323\326k\372\324HX\210\026\b#\025\220vyC}\023X\037\306\210\030\030\0300l\311\274W\022f\330QS@{[\357\275\245L)0"
+	.string	"1"
+	.string	"2"
+	.string	"\\G't\346<#t\346*\266\002\030>\b\002\200\274h\377\277ib\321R\254\335\342LJu\262\034\250\370_\231R\211\270\323m7m'Z/\004\n\004\376\220Z\201\317\270\027\224\266\326\264\225\243YD\273\032k\346\207\211\221\375\347T\3023\367\260Y\266fyEt\313\344\203\177\005\223\375#\247\020\236\003\016,\025\222X[\271i7\354\322\230\367\237\242~up\024"
+	.string	"81u\346\"Rh4\224\254\265\343I\316\222\326\333\377w\256Z\273\354\315-[v\006#\001\027\016?%Q\b\324\325\323\t?%Q\b\364\221\300\321\b\364|\244\220\305\350\363\204\031_\247\241 \306'\374J \030~\232\361\336>W\345\006\314P\323\243\333l5\f\013\016"
+	.ascii	"2\241'\034\030.\250L}Nj\217\245\255\240\207U\353\302z\f\363\002"
+	.ascii	"\201\301\025ijJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_pt1FilterUpdateCutoff.8.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\375\b"
+	.string	"fQ?9@\345\2501\240\256\327_\317\341\036\341\341\303qo6~\300\341\005P\0312,N \366\242\200 \343X#Ns\363*\212\216\203\300*{f{\227\341Q\261\264\377J\"eJ\001-"
+	.string	"-"
+	.string	"/"
+	.string	"\b\232\345\346\003\315\262^+S\340\030\b\320\341\212\371?\243\210=C\2576\2125)\325\311P`\342\177aJ\365\341F\267uh\033\321V\0261\251B\322\326\233\266\360\363\211\347V_\325\374+0\260\377\234Bl\226\r\031\303\326%6\361\3142\331\340_\261\300\376\217\323\207\315\262\237\003\030N\351k\373/Q\27342\b^FL\232%\003\013"
+	.string	"\b\n\316\332\357\004cH\353\314\3777\256Z\267\354h\226\reAK\202\313\3571\023\360\025\356>%Q\b\244\325\323\351>%Q\b4I\334h\304y&)D1\232\236\356bv\026\312Y|\272Y\342\270nn\276;\363\270\252\034\020C\305\215\306\330\006\f"
+	.ascii	"2C+\025\003\b_Z\\z\b\265\256\241\3070/\020\030\\\221\246\246"
+	.ascii	"\204;\274h'\031"
+	.text
+	.section	.gnu.lto_pt1FilterApply.9.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"}\013"
+	.string	"\266\326N= O\234\016$\232\002\027\\\364\346`\306\313V\b\032\372\204"
+	.string	"\037 \003,hm\373"
+	.string	"\324E\374\246\037\257\001\361\254\224\255\rT\003"
+	.string	"C"
+	.string	"\260k=\023*0\356W*\342\240F\366\2262\245<"
+	.string	";"
+	.string	";"
+	.string	"\325\243\271\312\266\017\342!2\333\203\234\206\321\244M\220\320\305\330]\313\300!\323#\374\200\351Q3<{f\376G\034\246\b\255\370\200:OJ\301\356:?\240\n\267\336\366\001\333\023\373\021\002T\246c\246a\2465\323\231\351\003\230B,\bx\273\024>\031\333\021Ql\260\235\331\017\333\231/\331\263\306\256\212\027\033\273\033q\202\247}\322Ed\3478\027\260+:\261\261\313E\214 q\306\346A\313\317\327JU\251n\343\240m^\"5\342\302\017N\302\336\304\3572\020\252\335\375\350\321\347L\217W\252C\367\201\344\311\317\346:\251\030\354\303\335]\253\310~\351\257\316\375\001\232M\006c\211\223)\022\254\242i`a`a\256\313\345\242X\030\313\202\213E\301\034X\222\002\2762\025\314\322\\\027f=\270\275\035\025\262Y\350\360\250\346\250&\002\264\340\370\300\360\344g\250\327\250\220c\273\240\232\n5\023"
+	.ascii	"i\231\"34\030AhB!\270qp\334\t\264\212\031\003\\\256(\232\233"
+	.ascii	"\302\242\026\373\201k\214\310\202\254\204\004\002e\0314\361\244"
+	.ascii	"\244\230\256I\006"
+	.text
+	.section	.gnu.lto_slewFilterInit.10.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"U\013"
+	.string	"\346TMC \2138\035H\261\3302\bq*\242Z\220\341\276l\305\204\333vX\"I\257l\020\264[p\030\032\350\365\245\265\231\306\b\202\221\020\312\026@\202\303&\247n\251\361\236\303\322\300dj\3135>)\322&{\247\0246"
+	.string	"<"
+	.string	":"
+	.string	"KZ\234\221\275\232|\005\366\232\235\002{\365hs8\211`?\201"
+	.string	"\200\023kw7z\340\343\347\350\377t-$\362|Bt\354\256gH4\340\246\267]\261\355a\237\013\244\177f\230\203\f\026\345\256\200\326\207]\325\013\nl\237b\233\\^\022\033"
+	.string	"\024\342\230\344%\214/\271\264\266\213a\203jw-\326\310^1\256O\373\020\036a<\251\363\211\335\021J\265\001)\013\r.j\227\034U;\244<\024(m\317\212\315y\005\227\331\356n\370\024NL\"4$\350`\257uA\212\001\3533[6\351\231\324\200\375kw\327td\337\364c/\375\327\003\"\232/\023r`F\324\304\316\353@8\234&\3240c. 'j\272\221m\363y\336\207\3316]\210\267a\300p\273\\\370#\341\300M\374>p\243\220\373k\351\310\037\017V\037\n2F\355\360\001\024"
+	.ascii	"i\231\"\023/\307\321\342\202\njCJ\330M\275nj\217\271\255\360"
+	.ascii	"1k\215\013\303\200\031\003\230\013:\247\204`\201\300\340\212"
+	.ascii	"45\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_slewFilterApply.11.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\274\002U\021"
+	.string	"\026\036jF\360\260(\035x\337?\350\316u\263\030jn\261NF1V\004\271\376\b+C}\314e\037\234\022\325\365\031C\032\337\206\343\353K0\312\255\023Wl\"\233\310\336\213\217U\322\370%\353\240V\271\351\346\260d\357\275\245\224)X"
+	.string	"N"
+	.string	"X"
+	.string	"\360\003\301\"Q\033R^pt7\367Q\017\251\021\352"
+	.string	"\251\221?\250I;\332\224\021\362\232\256\023\004g\030f\250\250N\332\231 m\246\254\264\220\332h\240\303jEa\214\n+\233\ne\031\200J\002\374t\267\302t'\250P\273\023\324\335_\025\325J\337\241\377=\374\017\371w&\372\251v\354~\356^\356>\356\036\356\236w\277\273\327"
+	.string	"\022\007\006\201\024\335\024rr\364\213\030#\342\277\351\337\376\357\252\313c\357t\267\250!\353\356\217'\320\375\365\245'L\372\231\250\200n\026\214\254\373\3738\002M\343?\355\377\265\204\2320\375\261\221[,<hL\02227\031\024n\f\331\203\3210+C\2062R#P$\272\202yk\221qmw\237\230[_V^"
+	.string	"\253AY\234\377%\252b\371@\210?P\024\217i\335\035r}i"
+	.string	"Ac1\221\032\225\331fv\363:\331\234\377;-\267~\205\315,\217\272\250n\001\245\222\021\222(\312\207@<\221\222\003\021\003\216\324\215F]\210#\211\024\214\270\220G\302\201\024x7\"\342q\245\256\363\270\355k\205\312,\017\177N\0305\363p\344\340\302\325\211\361D\033\032\227&\233\371\327\335s\262\007\253\221\254<5\300H\336Zf\\/\031Y9\302rd]]\260\221\272\021: \300\002\0311\363\351\232\"\"?\006\235\242\216s\335\034\321\325\\\0361\303\305\t\032'O\314\254\002,\252f\252e\020\3425m\316}\326!\006T\340&{ \353\312\340\3701\253\304r\007\2414\321\346\313\264c"
+	.ascii	"-\353P\236Z\253\224\222\r\270\373\332%!\033\274\023I\022M\227"
+	.ascii	"\271\375\021++'\020d\331&0Y@\236\343\355\210\302p\032,\0339\023"
+	.ascii	"\021\231\201\375(.3\272\247\267v\225\001"
+	.text
+	.section	.gnu.lto_alphaBetaFilterInit.12.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"\035\f"
+	.string	"\346\326RA0o\2331\260\252C%O\202F@\304\200\200\031\032(D\222}0\260\276\276\230\373\301S\310\021\231&\230\220\361\307\233=So\256M\327v)\210\t\304\201+\227{\326\315\266#\205\235\264d\345\2262\245;"
+	.string	"?"
+	.string	"A"
+	.ascii	"\016\360\233T"
+	.string	"P~\020\323\003\230gA\017\260<1\013\260<\333\265.\fr\270K\244\3700A\375\327\344\006w\216]m\023g\037\210\207\343\245\371\337\370\201\\p\245\333^\332jZ\177\0015\211}\271\304\256<b\313\030\353\354\022aQ\340\305o!5\343\247\231\342\241\255-mI\303\n\300+\224B\024D\320$:\2234l\366\257\220\201\362\037S\004\230\247\201\312\261\265\b\217\350<\322\021\2555\341\367.\227\264t\n\206\023\n\"\245\260m\274\264\033F13\254\240P^L\265\222-\207M4\304\376'\250O\"H\320h\321\241\303\362\234\037VB\204x1\325\202\036Qjh]\375\177\245\251\001\236\r\320\006\302t@\352|8:\242\r\203\314*'\303yH\240O\003M\264\205B\033G\023}6!\215\303\215\264\f\201n\017<\234F\3326N\263\200wui\352\002\020'O\226j\331\216\254\"\252|0<\237\370\210qz\025"
+	.string	"i\231\"\023O\363\242\305\203\352\204\177E\365\203\357\305\302:E\372\371n&\214\214]\347\0320`\306"
+	.ascii	"\346\202\316)!X 0\270\"MM\001wy\321N2"
+	.text
+	.section	.gnu.lto_alphaBetaFilterUpdate.13.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\026\003\375\024"
+	.string	"\206\346\205G\300\324\321p\250\377d\3042B\t\\x"
+	.string	"[\364I\221\260\216\345\330~4O\b\350[\020\372\205a\214\007\251\254\300)\322_(\305\030b>\r\205D\003\230\242\204H\316 \224"
+	.string	"\"{t\272\233\333N\324m\367\336R\246\024m"
+	.string	"i"
+	.string	"r"
+	.ascii	"@v\327\300C7\360P\n\005B\376\201&\353\341FD\202\364\035h\367"
+	.ascii	" \377\274\332\275q$iwW|`|\230\002>\355\267\270\213\335\177h~"
+	.ascii	"\262\313\023\225\264\353[q\201\361\241}\207\211\017\307\243\210"
+	.ascii	"\017\275\263\177\334gb\237\203\251\303\013\"\273+\323\022\337"
+	.ascii	"=w\376\177_\345\354\324<U\fv\327\231\263\023\342\326\333V\261"
+	.ascii	"=\301\326\017\001\261\027\335\260\033\335\257\017\375(G\272]"
+	.ascii	"\017\372O.\364\233\374\347\007\220\351V"
+	.string	"\246K2\315\3124I\246W\231\0363\255\312\264\230\3510\323`\2465\323\231\351\013P9\341  \265\013b\312\310B\205J*N\364\027\375F?\322A\373\207\361\030?\372\317,$\247\bF; \024\315\244\340\360\350y`\023\315\2145:\261\234\021=\002\252\322\0308j\330\004S\230\252\224C\357\211\347#\352KaK\277;qvmT^*\352uz6P4\324\227\346Q\206\327\bU\265BH\021PO\324\245y\304\353Q\275\202*\352\340\365nr\312&\232\252\032\240\211\347s\023\363\031\251\013NX\346J\376\215\273\213\300\227Aa\303\210\202F|xe\001I\261\370\261\311)\333W\223J\302>\270\312c\237\350\016\266\231\214K-\206\226\0331|v\001\3066\013g:Z\005\3206\323\220\243\351^j\243\004\227\244\331`n\263\030Qt\013K\216\246\263\325,\310^p\267\033\256E\366R\233\335d-\271\030\031\313"
+	.ascii	"\343`h9\231\016\207\313\311X\276=\270\312c\007OP6z\343\2262\225"
+	.ascii	"hjK\223\006KK\024\364\301[\212\251KY\252\353\r\341\371\220\350"
+	.ascii	"R+\3529AV\n*\211f\023\257\347\322\225>\251'5\006> \300\002\221"
+	.ascii	"\261\242\007)M\231\305\013m\341,%dV\003\021\221q\347\023\227"
+	.ascii	"\205\247\003\037\260\026\341\215\207t\300\333\036\032\274\243"
+	.ascii	"\3007F\003(\257wA\004\306\023j\260\351\257\351fU\211\312\210"
+	.ascii	"&\\4\n\363\221^\210\361\313\225i\336\214K?\273@\267\r\346D@\266"
+	.ascii	"\002\235x\273afA\234\222q\342;8\230\310\310\200c\262\333&\f\331"
+	.ascii	"\240 \315\231\231AX^8\236\322X\033\246\211\264\214\005\272\345"
+	.ascii	"\205\260\310"
+	.text
+	.section	.gnu.lto_alphaBetaFilterPredict.14.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"e\n"
+	.string	"\246\223F=@\307h8\340\3722V\007er\315\245\256bB7.\212\263\303\205\023_Z\254\300|\227n\033\261:\341\265+\261l\353\251\032\211E\371\304\364\021\273S\340,\276W\276({\357\275\245L)4"
+	.string	"5"
+	.string	"4"
+	.string	"_\tmW6\232\2506QAG\013\266\273^\346\230\355Zv\204\355\232\226<|\206\376[\236%\0301pB\221\236\234\304\356:O\250\220[o\233\301\366\203\375\210\b\024\n\354\202\304\026\354\001m"
+	.string	"\212\355\320\276\330\316<\313\256\314`=\304\217\327\356j\354\360\264\277:K\370q\364\203\335\024\354\265;j\334\320]\363\330\331\366U\002\002L)b\350\001R\027\234q"
+	.string	"\032\335.\007\204\337\022mt\252\321v\355\2129Y\2252f\217\244T\022\373\331j\212;\353\337>\376Z\2465\323\231\351w\034,\023\025\271\231\263\001;\242\013\217\205\007\372>\237\217\343\201<\024\037\217\003\206\274M\202?\214\016\350\211\276\017\364.\343\336\3464SR\321\252WN\225\200ID\314\2307MU\325\002\022"
+	.ascii	"i\231\"34\030\241\204\211\007\256AT\032\224\346\212\315.\200"
+	.ascii	"\261\3135\234i\002k\353\025\221YY\t\t\004\3122h\342II1]\223\f"
+	.text
+	.section	.gnu.lto_filterGetNotchQ.15.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\315\t"
+	.string	"\006\223C;@\305(\035\340\245\237Wy\375\272X'\343\222\245\303,\310\322\202G\221\235\235\362\0273\213>W\023\002\276\262\354\320\004\370\030\266\354\244\345"
+	.string	",\261oK\374\356\332?\b\331[\312\224\0021"
+	.string	"1"
+	.string	"/"
+	.string	"6\n~&\217\2470.L\f\354.\206\271\201\365\b_`=j\307\275\247\347\277\344q\303\204\032\221@\317\013bw\235#\222\306\255\267\275`\373\301\376A\361i\370\264>\235O\277\2420z\001\001\273\031\253\003K \242|\330\366\354\213\375\rpx\376d\224+\273"
+	.string	"HNv\267\301\f\004\217\266}\221\217x\001P\257\227\302\224(\200j*\324K%\002\261T\025!\0255j\252\225bi\324k\252D!\241\\\331\037(\225\303>\\-\331O_\377~\353\247?\037\215\323l6[W\221Y>\032\247\341\264\316\243e\026g\031N\353$8\033\314\263u:[\206y8\021\035,\343(\260L\202\267\t\215\303\272m\343\260\313\267\207\253\245K1\026\032r\020"
+	.string	"2\2417(p\362\213\005\002\3729\n\030|\314\261\\\303\213h\001-&\0240\0072\003#\202\n8"
+	.ascii	"\225\307\324N2"
+	.text
+	.section	.gnu.lto_biquadFilterInitLPF.16.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"=\n"
+	.string	"\246\323F<@\305\2521X\267\347]"
+	.string	">\327\025k\341\274\245\335\372\315\357\267\016\256\347e\200xsT\373G\205\030a\232k\022\335]~8\367\214-=\344-\t\226\034\232\020\273ib\367\336R\246\0242"
+	.string	"6"
+	.string	"3"
+	.string	"\027s\035\215\320\231\273\370\2403W\261=\340\021\345\206\205\200\300h\377\275yb\321R\254\r3\006\2252YZ\"\376W\242R#\356t\333M\333\211\326\t\001\027IP\373\214\033\220\322\326\232\266\363\305\261\025\374CU\002!G\013\020\355j\254\230\237"
+	.string	"M\366\237\323\207\213\271\205\315\2625\313\001D\267:l\360\257\n\310\376\221S\207\244\2561\0038\261f\357\366\2376\333\234S\316VcC\032\325\006U\355$\323\324\216&9MZo\377\337\271j\375\2627\273\354\351\226-\273\214\212\001\006\004\017_\311SaA\372B\320\027j2\276P\"\323\365\323\t\277\322E\b\344\215@\221\b\374x\243\220G\344}B\222\327Q(\210\361\205^\t\004CO3\336\333\347\252\024+\263\323\364\250E\326\001\020"
+	.string	"*C\244e\212L\274\016\032\r.\304T\335<\256\261\001f<\240J\204\021%\304\r\304"
+	.ascii	"W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_biquadFilterInit.17.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\305\be'"
+	.string	"*E\344\016E\200\234Q:\333\"g\263\240$\235\321\242Xo|_\325\217\243\224j/\b\340\276\2031\250\254\326|\312D/\215\241fHz\223\341\t\320/G\223\\v\316\326\372p\337P\2474r/\300\327\n\327n\374\204\310\235R\336"
+	.string	"\306"
+	.string	"\336"
+	.ascii	"\366\257\345\\^|\227{9\230\037/\346c'c\333\030!Q\310\340\220"
+	.ascii	"\027\206F\222o\250\002\255\206\f\237\304h\374\214h\325a\361%"
+	.ascii	"\210\212\260%:#\224\023`Zr[\\L\0323\226\260\277\\\244M\3710\200"
+	.ascii	"\265FI\235Z\353\322M\223\260\313,5\312>x\271X\016U`\225\024\017"
+	.ascii	"k\345F9T}E\2604P\342\251H\275\212\213\016\2525\214\034\243-\320"
+	.ascii	"n&\225\247\366\243\\\212\324\273p|@\255YEc\255D&K\240\3354\361"
+	.ascii	"D\263\233\264\027\230\335\264\224=\347D\255\372+X9\256\350\251"
+	.ascii	"\265\336\026\311\245>3\313\245R>mb\346w5\365\031\2239"
+	.string	"\341Ny2/\271\226\344\371]\001\371Z\371\252fC\265\326\332\325YR \016\265V\323\337\325\217\033\350\266e\330\266a\323\214\001k\204\254\242\311\222hwm(\301\362T\264\265.\032%\260\266\214(\372\037\321\026\375\244\220\371v\312.>\f\216\016\262\352\r\311d\031_\255TJt\t,\3452`\277t\177rU\321\244\207\366;\303JB\347\254CE\2236q\352e]#\366\313\272Y\366\273~\b\017\034(5`\220\264@A\002\244\243g\371\021\\\3546\272\327\177\340a\356\242#o\242\217\271\t\274\312?\340V\376\241\177\335\002\276\345\016p\260[\350\306\033\300\303n\333\277\3345J\035D\251i\224\032\210R\317(\265I\251KJ\275\224\232R\352W\260\3419\023\301L\255=\222}*\231\031\326\344_\377\226\037\3547\376a\377\227_\354\017\363#\3771\257\005\302<\264\265\235h\r\260\264m\022\322\001Z{\367?"
+	.ascii	"\026h\233\204mfk\263x\037\333\316\266Ih\346D\232k\2738\037\027"
+	.ascii	"i\265V\f\376\036)\256\027Bn\266p\314n\322+?\241\255\255\271M"
+	.ascii	"\302\343\211D\363\2273\005\313Tv\016\023,S\232\223\013i\231\306"
+	.ascii	"\316\240\321\036m\006&\307\323\016\025\234S-CL\006;\241\354\034"
+	.ascii	"&\355\204\2613\270`3l\025O\2566\247_\311\322h\037\354R\3319\314"
+	.ascii	"*Z\007\273\224\306h\225vi\354\f6\330\2579\271\212\226\372\312"
+	.ascii	"\025\261\004\3139\274\232\327\220dS\324\317\256\021\277\314\217"
+	.ascii	"C\213n\3747\2372\254D\326\370l<\207V\353\324\203~\215\331M\323"
+	.ascii	"_\265b2\254\265Fx\032?H\323\252>*\261F\270\211`\351\227\0302"
+	.ascii	"+\372\307\007v\003:\026\273'(3F\024\215r\242\272\026<\030:\263"
+	.ascii	"B\nj!\005\275\220\202V\320Q\013:zAGw\274\033#B|7C'\242E\324\256"
+	.ascii	"\267b\327\263\311\330\365:\324fv\242\320\333\315\200\341b\305"
+	.ascii	"-\006\324\323\023\224\323-\206\013\335\323\315\251\027u\243p"
+	.ascii	"d(\336\256w\233\001\005\325\273"
+	.string	"\331\210\365e\335,\347\304L\005\213\023+\031,\357Xf\037\354n\tX`\316\313L\2608/\260u\2604\300\002sNL\244\3059)\223\226w\354Z\245\245B\013\314\0351\217\026wD\030\007\300\002s@L\034\220r\301\362\216\301-\367[\266\005\346N\323hqg\311;\362\330\006\013\003\214\220\326\026\b\"\017\031\325V\231\376n\343\350\216\034\325\341\347\t\265\272m\202\346p\3216U\262QP\037\222\026PX\037=z\202\326\326Q*\001\033\264M\001\200\233\250QPf\020R\314\314\210(H\222$\255\001\300\002\221)\2536\022\340\024-\023\032\206\b\241b\346\222\024\030\025n\006X\024\321\302R\242\352v\371gn\n\327\334Y\026\023`2\027+g=A\307ct\346\234\260E}\322<\020\235X\267\264\365.\242vy\336\302\fv\376\031qHt@C\0074t\210s\375\266\335Af\237\201\246\230\300|\2544\307"
+	.ascii	"~DP\340n\260!*\240\242\216(s\303\215\370\242\r~\305s'^6z\366"
+	.ascii	"Jx\270\016\206\032J2\026\204\200\210\357_\260\241\\\222\363\330"
+	.ascii	"\261\353\335\335[\201\212\214%\002\246j\227Z\325)\026\253\275"
+	.ascii	"\017Z\316\330N~\337\013\221bozK\017\006f\r\325\303!!:\001\030"
+	.ascii	"jJR\326\007\326\377(\b\333\313\027\0252\263\227\323Od\254\256"
+	.ascii	"7Y\347\003*\020N2K\371\364\243\202\370/\360\020!1\2425F\245\357"
+	.ascii	"\246\252U\276\256\006\251\361\340\202\307N:\354n\250\250K\246"
+	.ascii	"K\006\241\227\247\203\020p?\024v\033\024\033\204\025\322NT\320"
+	.ascii	"\375\274RT}J\232\f\013\030\016Y\207\245\177"
+	.text
+	.section	.gnu.lto_biquadFilterUpdate.18.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\264\002\315\021"
+	.string	"\366\236oI\320\322(\035`_Z\223\037\0200!\005\206\205\312t\370\023\016@\230ec\031PT\032\272\330]<g\220\321\361V\275k\377e\210HQ\036Y?d\213m\004\354t$']\203$\251\335\354\240\332;\357\326J>!D\356\224\002T"
+	.string	"a"
+	.string	"T"
+	.ascii	".M\332\375)\262\355\256\210Q\337\273\020\356\323>\315c\274^\263"
+	.ascii	"\362\001\2731@\266]R\304\f\276w&_\300{\367\235\200\367\316/\233"
+	.ascii	"\350\244\314^\007\020\027\234\242\335\005\225\305_\237/\377>"
+	.ascii	"'\311^`\237#\b\273\353){Aq\353m'\260\315\301V\005\0017w[\315"
+	.ascii	"?O\002`\b\201>vM\004\371\261A\035\r\027\337\371k\177\317o;g\377"
+	.ascii	"3\316\363\362>6\331Hl\350)\241\241\3462\244\345\2643\027\331"
+	.ascii	"\213\f\366\216\313\017v\302\300\210\035\263\036\273\333\340\235"
+	.ascii	"1\330\234N\b\242\t9.\271\323\316b:\022\364\306\305\235\266EE"
+	.ascii	"\212\007\223\274\214\327m\002Sm\225\207y\231\027\f\321,\214\302"
+	.ascii	"l\257\016\344\335\304\377t\25238\264\224\337\340nf\335\206\313"
+	.ascii	"ow\035\3705D\2008 \323b\305{\247\25237\264\032\226\031\304&a"
+	.ascii	"SW\330\347vw\2551\366u\376\322s~\322o\376\3576\377\350;\267\367"
+	.ascii	"\332\335\275'(\225I\2422Q\256I\342\232!\212\353B\205\207\255"
+	.ascii	"\022\013\035X\341h\022\216\246\224p\214P\362\234\032\031\303"
+	.ascii	"\326\007\225\tx\"\256Vb\n<Q\225\254\300\324\310\002G\020XD\t"
+	.ascii	"G\260%\212#h\"\367\334j\214)\320\202X4fO\207n\235\n\361\3208"
+	.ascii	"\315qS\305\021\200G\254F\203\0010KJ\322OG\0329 \360\002\031\261"
+	.ascii	"\321\003\370r\020\f\221\346)\363xG2\034\214\204\214\035H\340"
+	.ascii	"\"\025\214\r\330jC\224\026;\220\300E*\030\033\260\341\355\f\312"
+	.ascii	"q\f\376\037\226\311\334\017\2259\364E{9\237P\316\020\"%\204r"
+	.ascii	"\316f)\203\034\271\215a\210$\216d\237x/\245\223\316x\265a\274"
+	.ascii	"\355.W[Mb7y^\274,\003\226\b#\212\270\211\301+\322\330\024\020"
+	.ascii	"\227\027\355!\003"
+	.text
+	.section	.gnu.lto_biquadFilterUpdateLPF.19.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\007\003\375\022"
+	.string	"\266\341vI\320\3606\035\360\266\245\275\261/D\336(3x\303P\270\277\247\233\234\226\322\005t$\030V="
+	.string	";\222\306\317\214?\213\004\224*){{\002z\017\365\3602\247\236p \206\315\232\251\234C\233\021\001\263Y\023\027\364i\223\275S\n\\"
+	.string	"e"
+	.string	"\\"
+	.ascii	"5!z\030\314\361*\304\007\231\364\307.\f\036\345\356\2228\305"
+	.ascii	"\275\216h\237\366\177\236B<\220\314\003\354\362(\225\273#\211"
+	.ascii	"\021p\257\036?`{\345.`{\265h\347"
+	.string	"\370\330\263g\002a\003\333\261\273\036\035q\361S\364\017\373GKg\346\363\324`w=[:\037nz\333(\333'6\335\020\261\031\013\232v;4\365\330\245\032+q\331\037\373\221\376\362\232}\237|\351#=v\331\223\334\035\031\335\024\021\341\f\211\027\022_\276\302'I(v\267{\361\205>\364\242\037\2713\272\221@\204\023\241\205\311\221\032\221\315\261i\231\200`\277\234\205In\306\003\001\016L9:v7\301\253\037p\257\357l\323W\214&\262\001~\251ba\276\345\0035~v\207\316\254\256\304\315\300\3138Q\352\003s\261<\306F\251\317k\366\322-\177a\262@\317\356*\360]h\310\340\223x\365e\266\327J\237t\224\317\313\005\304\232M\366H3\251\b\373\332R\036\373\345\315\035\351>=vo\227\335\365\257_{\320O\017\364\317\220\220)\230i\0023S1\323$f~.(\023*\264|a\312\027v,_\350"
+	.string	"\300fUI\370\271\\PI\361V\300\325\nTy+*(+O\025\266x%\006\fb\370B\317\005\004C\257\033Y\207\235;\222-\261(\2159\212cv\2427\214\\\033\2651\253\224\206I\020\034\225\246\310\265\0032}\n\233\311\237`\375,\255\265]\026J\243\224N\032> \360\002\021\261\235\003\312C\244y\212\b\355\216\354\311"
+	.string	"\b\212\354}\035\317L[\353\021\204(6\013\366^l/\314\r\367,h\r\242q\314\024J\342\004\323\217e\020\256\207\021\316\330\341\037k\332\031\343\365\241\005\313d\201\\\303f\0219\320\230\227p\314\320\303@H\303\n\f\2049\355\001}$r\tV\212w_F9\311\271P\262pm\034"
+	.ascii	"\267\007\352\270#\312\270\215\321+\322\330\024\020\227\027-$"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_biquadFilterApplyDF1.20.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\374\002\005\023"
+	.string	"v#zF\360\320h8\370\317\273+z,CMH!M\003R\324^c\341\367~6)\274\n\243\371T\374\367\316h6\300:~\023q&\005\250\223\223\261\231Mdr=\fr;\312/\251\325\357\221)\351\033\341n{o)S\n`"
+	.string	"Y"
+	.string	"k"
+	.string	"\233\340\236\027\200\231\327q\316\245]\240\034<\273;b\005O\373\267\217\230}l\371jW&\210gw\0341\002\360\236G\320\266\217\363\234\231\235\353F\0205\337K\315\013\016\307\356\206\005\316\372\356u\007\371\356\351\314g\317\231\177\334;\02199[\214\313\223\344`w\235\266\230\f\267\336\266\001\333\rl\275\020\366\350\222\372\301~\267*c\177\347f]\347\017\371\370\203dz\225\351\217L\2532\235\3124*\323\036\231>e\332\224\351R\246\301L\2232\375e\332\313t\227i\315tf\372\"\252\r/\030\320\330\2059\322\261C^\217\315w~{\346\343|\262\275c\001t\301"
+	.string	"\3006cSc7zR\224\022\260\341\272\217\207\376\006\205\367\234\3643J\372\251I\003\354"
+	.string	"\225\244%\025\201Q\273\021_\347\001\365B47\032\354)H\372\234\247\251\237zD5\017b\036\271SUOI*j7\242\312Otz\034\315\215\266r\023\252%2B\364\232\332\021\325nD\263\274\204s\340\356\226\370$ T"
+	.string	"kZ\276{\327\222\370ct\243\345Q\262\023\226\225V\354\223\261\244\240\270\274\317&$\261\226\354\304%!D\201\275^0\223\020\305\025\341\025\232\304VB\022\001\206\245\264b\241\f\006\213\205\247q\337\255\312\2604\005\243a\210\246\242Y:\344\302\210\003M\350\206\255\310Vy\013O\f2\352@c\201\212\361"
+	.ascii	"\347\307V\264\322\224\2624?T\245+=\200k\035\350C\323g\302W\250"
+	.ascii	"4q(5iJ\007\240\250\205\360\b4 \320\"\021+z)\235\"+\236\224\024"
+	.ascii	"\r^\202N0\020\315*\211C\200\201\3406\254\203\032L#\177q\251\301"
+	.ascii	"\240\353\335\205\343\202S\267f\346\021\003%\277\003%\020ayb\244"
+	.ascii	"\244w\240d\230\227\215\357\032&j*\fa\224D\306\341\326\031t[\030"
+	.ascii	"SJv\304o\210\025j\\\340\037\2029\261UiD\342\303Y@\241\351m\225"
+	.ascii	"&\020\264\274&\236\216\024\323\265\310"
+	.text
+	.section	.gnu.lto_biquadFilterApply.21.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`b\002\255\020"
+	.string	"v\237kC"
+	.string	"\221j8\230\257\364\3608\374\235x\035\223[\273qk\335B\374\270 f_JU\004u\204[\261}tOAp\236#\263\033\027C\270\252\252\252o\341I'\213\250\003IdNI\357\373\366\367\336{K\231RV"
+	.string	"P"
+	.string	"Z"
+	.string	"\353\002C\333]\017\033x\332W\371\207\325G\221o\354\276R\320vG\017\023\370\316y\374l\373\034\336ae\317\266\261BJG\302B\"\203\331]P\300\001t\347\266\203\272s\212\362\325s\345_\366M\203\007\024.\023\326\323S\260\273N\227\311\204[o{\200\355\004v\312\b\347\370\370od\372\223iO\246;\231\346dz\223iM\2463\231\3762\355e\272\3134\227\351-\323\232\351\314\364;>\031V \230\261[\022Sc_\270\026\013\217\375\366\312\227yc;\026\341cI\350p\241\314`\354n\201s>\360e~\3053g6\272\325\304\013\255\2141H;\365\2643!\302\302\223\3504\264)\247Z\023a\017>bS\257\365b\203j*H\223E<A]\204\352\207\013\016\275\246n5\021\326\262\352!<\373v\367\303\007\261"
+	.ascii	"\302\227\"\322\235\273fZ,h\250\214d\214=\262R)\330\337V_\366"
+	.ascii	"c7\350+\017)\020\025jt\352R\252\020\023\211\353,\n\235F)\020"
+	.ascii	"R\003\320\024\226J\241\b4\221\030\224@\321\t\005\206\0028\f\031"
+	.ascii	"\235\300T\030\236\300\315\270\337V_ \365\224`x\031\321\226?\352"
+	.ascii	"\342Q\216~:\352!\375Dg\243\034\007/\261\241\241\321\226N\213"
+	.ascii	"\224\271bd\364S\215z*\304\223\322i\031\275\314SN\277, \300\""
+	.ascii	"\231\253ziO\021\212\007L\242YI\320c\003\271\264@\320\232\301"
+	.ascii	"\030\351\005\207\361\200\016\t\3060J\2436\020\004\343XN\262E"
+	.ascii	"\035\206<J\b\342\361\340@]\371\3051W\245\220\350\034\306\234"
+	.ascii	"\222]\361\233bu\024\027\326\206\340\236X\2120\"\221p\226Pht["
+	.ascii	"E\t\004-\277\211'\221b\272\026\031"
+	.text
+	.section	.gnu.lto_biquadCascadeInit.22.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"u\007"
+	.string	"\322N56PO\323\001\240\230\023\301\020\002\215@\242\323mC\251h\231\220\241\214R\222`\2158\177M\353\257\013\334\023\233\253F4"
+	.string	"8\3400\023\312\311q6\034f\335\310\226)\005\226C\025?U\3148r0\013\004\321y\200\036y]2BO\247\272`\304>\220S`\031aa\020$%\0067s\37787\230t\025\317\302\222\272\345N\241\020\256\317\226\230\320oV\222Qw\3614{j\3726\354K\273\273~\234}\321\257R@\311\312\202\313nF\f\314v\323\211\307\306\366\325>\310C\262\213(.\260\313\241\224\354\316\004\037h>y\236\200\372\244\371"
+	.string	"\365\311\231\315\362\331\261\037Q\301\020y\331]\3708\236]3\377\243\003l!\355\232a\330]\353\026\322\270\337m\033\330V\260\375\021\b"
+	.ascii	"2\001\013x\306q\341\025\314\273\004\320\254\246\200\273\274h"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_biquadCascadeAdd.24.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\231\004\205\033"
+	.string	"\006\263\260H\240\230Q:\212\306\347\023./\306\204\227\370\354\233\321Ebhl0\260oH!x\220\2041F\257\245\363Uf\370O\341ru\0357\300\327?F{\2412\nm\364!~@\237\364Z\340\215\200\002l\351\342\017\262\211\334)\005\233"
+	.string	"\221"
+	.string	"\243"
+	.string	"uG\203S\233x\235N\"\nh\024\r3>P.E\001\365\210\007\354 J\261!\n\250FF\200TX\362Pt\177r\351\234Z\267\240\241\252\265\366\030\302\353\024\2018\247\375\246?\321\035\210\343\003j\375\225T\265\222=f\360:5y\331x\372:\201\361\324\266!H\320yw\222\t\351K]9\246\fk%g\273\364\335\305\235;\237\350\342\203O\300\244\264\272\252\222\324\343+F\310\022\342\024 \211'\306\220\302@9\226\317\243$\2439q.\324Z={I<nz\333>\266[\330bU@>\222S\037\307x*[\246!J|O\200E\263\313&ys\225\354\213u\177\366\2057\017l\272@\316\364N\316\264\354Q\277\316\241~"
+	.ascii	"\227\362\307\376\364\303\016\374s<=\3564\335iq\247w\247\347N"
+	.ascii	"\377\300\002\"\276 Gt\354\025Y\221\272\270j\025\025&\271\360"
+	.ascii	"\227\272\177"
+	.string	"\345B\037\213cT\272\333\247\354\363\373\371\232j\255\261\233O\345\330\355\245\220X\177\220\225G\r'\222\\\361\272\316\017:\346W\271\025\335\245r\b\214\310J\204\"*\253iX\003\345k\251\226\324\026p\352,\200\215-l?\365`\211\227}\"\305|\317\017\036&\364!\371\352\217%\362\305\374B\2538\226\3135r5\306M/Mi{&\270\320+n\345\222Zq\r\303\200\251\305\226p5\251\022\032Oq\226p\r\207E\263\353\213\320\002\254\336\205v\210{a!\201\251\326J\341\364B\323\336\245\326\203u\312\263\353\245\347C\266\005\226gM\2167;\313\345\247\002\323{i\276\263\017\254\270xWP>\336.\021\225\331\332U\362\376g\224m\213(_\214f\033_h\333\265\374\274j\255\023\374,1\002\266\037\332P\216\216\266\0317H\210\270m\2106\002F\316\206{a\303\305\204l\270\r0\233\013Z-G\253\341\270\346"
+	.string	"g\033\212\001\364b&\343\026\024t\253\315d"
+	.string	"\321\202f5\\n\346\300\200o3l\270\331\320\355\206\233\305\310\242\213u\177\036\311\f\241R\356\277\033\037<\0072GT\312\351\357\306q\217l\217\353\013E\313sN\254\265\210\205K\375YO\342*\255\275s\372\026\006\272%\256\235\341l4\210K\265\246\234\354\332\034\256\246\303n\315\265}\236\345a.\325\n:\001\256\r\342g\\V}`\241c\021\017:O\250AT\243\fQ\016\315\0042A\302\244I\332\320\"\221*\353\021\200\2713s\022Fm\325{G\260\212\227O\324\376+\313JO{\177\230\240\346\272\032\341m\177\325\200o\346\323\367\343\r\377\025\270L\246"
+	.string	"=\254@\257\002\355\207\311k'\365\255\234\206\311\200\300\343\230b\352-\227,=&\230(\233l}q\t\022$k\t\001'7"
+	.ascii	"$55\352`\375\016PiJ\337>H\"$\215I\3679\220u\205Q\243\023\276"
+	.ascii	"/,z\340\021@\354>\034\f\023\214\177o\373\330\347\264\255\257"
+	.ascii	"\326\337\031\001\025\250|d\272\263\264L\335\340{\201\231\n"
+	.text
+	.section	.gnu.lto_biquadCascadeAddLPF.25.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\225\n"
+	.string	"\226\324J@ \305j: \027\003\300\032"
+	.string	"\307\202\004p[\030\001\nM2&\f\334I\215\211\302h\342M\250x\277\203PX\302\375Fz\bA"
+	.string	"\002I\201\231@\306J*C\3136\025l\350\275m\244\355\275S\n7"
+	.string	":"
+	.string	"5"
+	.string	".\277\260]\343\256\260]\263\355N\004i\322K\024\324STB^\006v\313\216\236\234\364I\362\377zm\001P\340\224*}b&v\327\363\224\022\271\351m?\330\256\260\317\020\250\004\bv\246\005X\261M\332\031\333\325\325Q\017\026\244\204D\202\226\177!\3372\314\005\273\002\016\304vw\343\016wMS\347\264\277\272\013y\226\307\021vU\262\330n\2711\004w-\242\315\260\263\230V\263u\33559TJ\351\244\366\3101\177\332h\335\021Z\262\313\322\244&\366\353\356\256\251\312\366\364v\327_\337\372\351Y\377\304$\310\bX\f\330\r\340\310\273\310\030A\321\003\212\031\021(R\030\200\030\3367z\037\306\037G\004G\032\037O\027\nA\240\360\353B\037\017\324}\342\330q\032\034n\200b7\nC\261\313\224{oTc\242\037\346\246\037\016"
+	.ascii	"Qs\240\314\2000\314\024N8U\313\346\302\31536\002U\"\214(!n \006"
+	.ascii	"\270\22245\306tM2"
+	.text
+	.section	.gnu.lto_biquadCascadeAddPT1.26.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`Q\003E\026"
+	.string	"\326\347\214J\260PR:\342]\206g\365\375\317\316\b\265\250oSm\"Vq\017:tb\361\335\215<_t\333S \346\242F\177`\355mG;\277\350_\216e)\362\237\242t=\236\3102D\231\0344\230\026\206\333\036\355\221\265\204\220\275S\nt"
+	.string	"p"
+	.string	"\201"
+	.string	"B.\032\300n\223V\322\356~8\344\365\262"
+	.string	"I\251\375\236\373\360\376\323\362"
+	.string	"\2736NI\273\347\207\021\274^\372\274"
+	.string	"\363\345\353\035\346K\333\016\031\341\271\367s(\363\034\036\030\"\343\3569\2538\357\235\254\264\347\273\234\374\320=H\274\230\252:\021\354\360J\212\300"
+	.string	"\001\264\021\374\2210\031\251\240\037\235\306\004_(u\221\354\256)08s\227\267]b\273\201]\203\002\273\234/\342\245\337b\276\214\325a\215\216\320\347\307G\267\354\363G\353\215}r\253\215}\342\315\341\242\3360\251e&u\354B\277\371\237\233V\352w\034\340\021\322\344\224\250U\347\312l\0357\252T\032q\342o\3377:\321?z\021o\345&\\rc%\354\331\335\025\277\310\260\225\023\261\220\373\341\334\231\r@gO\202\227\026y\235g\303l\327\363A\274\00757G\241\017\215\323O4\355P.\326\020O-h"
+	.ascii	"\263\212\266\251\307\211\256\235\205\213\345\324\321\330\304"
+	.ascii	"t\203\355\034y\226X\314\227\256\235\243\321\350\243[+X\fX\001"
+	.ascii	"O\264M\256\30262\334]\006/O\364\311\225n\037V/9j}\002z\210\325"
+	.ascii	"\215:@\006L\rYM\3029\030\036\230uYU0u\374U\025\t\177\025\307"
+	.ascii	"\005K\253\036g\306\252\311\020\324\013\235\341\023\215r$\334"
+	.ascii	"kw\027\370(\002\266\023\332N\245D\271\355\002\255\246B\253\271"
+	.ascii	"\\\003\321\331v\031n\030f)9\034.W\233\245\334h\270YM\2472\003"
+	.ascii	"!\340\234\006\233n\266\313\345t3\237\276\223[ml^\2450*\326\277"
+	.ascii	"g~\350\017\256z\214\212\324\357\231\264\306T\223\370\352\217"
+	.ascii	"\214p,*\343\253-\341W7}\331\365y\230\365\025\002\022\023\007"
+	.ascii	"\235\337\204S\031\2156\205K\325\030.x\314jWx\224\213K\026l\262"
+	.ascii	"\241\323= p\002\231\300N;\363\212R\237\341\244(\224\227\334\243"
+	.ascii	"\220\r\337\006\025+\030\307\031\320_\036*a\202\256un\264\001"
+	.ascii	"\356$\326\350'\304h\307\013\247\"\013<\226\243\371J\271\243\314"
+	.ascii	"\315\322\002\371\006\216I\230\007\333\300\022%<x\202(M\3441b"
+	.ascii	"\203l\bb\233\334\205\317\342\2405\3116G\220\001e\367P \262\032"
+	.ascii	"0 \001Zy\327\366;\303\033+\034|\216bz\315\255\330\366\251\265"
+	.ascii	"\032 \200,\243\374\303\f\t\036ctei\035\346\276\\\257\313\354"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_biquadCascadeApply.27.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`F\004=\033"
+	.string	"F\262\255I\260\226Q:&\220x\255\002\307{$\023.2\375\360\226h\030\t\241\275u\252{\346\220\367\246Mp\223<y\305)\363V}<p\005\355\255M\357\025.ls\350o\235\214\372\215{BT3\254\027\237\031l\224|B\210\224)\005\226"
+	.string	"\207"
+	.string	"\244"
+	.string	"\266\233@|\362\212\\&\246$\271\2323\210\340\243}J\3253Y\312\2569\215p\3611\347\344q\202\253}\340s\354\036\fq\330\234HJ|\314\031\344\361\201\362\243\203\345\215\343\330\331RbP\351\005Y\342\b\t\241\2269\347l\300\001\220\037\305\307\310\217\333\302\377r1x\213\272\373(\256\356|\341\305\032=\242\364~B\037\305\026\321\t\0303?\"\321\007\353\n\310\235\256\276\337\220\2123\214\276w\372\201(\253\336\317\350\332j0\347\264\366~(n\362\2669\330v`\213C\001_\354\240\220n\222}\037%\254+/\222\275\243\363\247[\226s\246?"
+	.ascii	"\316\315\203?\200\017\357\330\233n\2333\3350U\327\250\232F\325"
+	.ascii	"3\252\226Qu\214\252_\252\206Q\265K\325\245\252[\252&U=\252ZT"
+	.ascii	"\365\252ZG\365\007\304\2200yPd\316\023_\272\314\252\021H\214"
+	.ascii	"?\375\303\277\351k\337>\017\037\312\257\247\017\245P\321\215"
+	.ascii	"\317\005U\203\357\360\235\374\032zH)TT\016yL]\3159\031\224\037"
+	.ascii	"o\357|\241_\001o2\023\2632\023^\025\263"
+	.string	"-$,6^KE\243S\275+0\353\332\327\266\236\360\216(\\\t\314^X.\271\256\025\263x2d\333\332r\311)\336R\205#i\355\314\305\270\344n\026o\211v#\343\266\220\254\266\210\273+[\255\302;\252\235\310\202)@\330\352\356\216B\336\322\220\355B,\025D\002\206\022\004\371Q\367P7@\303\312\306\356\260\b\321o7iq\366YHx\361\317\177d(\277wz\001#+[\200\227\002\" \245g\337\336\203C9\347T\020\005!\307\243\364\"\004\371\361f=D-\351\251\020\241\001:\r\035r6\034\031t\033\006\232.7\352:l\b\372\031m\026h\265\034\255\326r\255\007g\323i\370\2710\013\272\001\001\335j\263\240\037\032\320\254\206\313\315zd\276m\260\341f\272\333\r7{\005\347E\021\266997\221\342H\225\210\035\0327\311/\254\325\331\245\2428\033[\337\235\376b\262\202jw\366\302\273\252\254"
+	.ascii	"\352\315\332\254\357P/\263X\034\255l-j\200\205\255\317\266\021"
+	.ascii	"<\266\nE\007\225\021\212uq\3169E\001\217\2216\273\263-!\217F"
+	.ascii	"\317c\2533\002\243\254xG5\353\204fe\266ffi\"\004Q\250q,\003\025"
+	.ascii	"cf\244dD\264)i5\220\002\221\301\343\006\021\200AT4\332\362\270"
+	.ascii	"\031\355\fN^\303j\"\0358e\230\227\313\362\251\231]\202x\365\037"
+	.ascii	"\307f\270\234y\243\203\206\337\254 k\244g\245\265\004d@\375\031"
+	.ascii	"\277\317\3779\3123\361\217\314w\224R)\374\240\352A\312\346\351"
+	.ascii	"\254\363\253\223\262\355\303\202\253R\230\370\037\002bW\216|"
+	.ascii	"5i\321\317~z\021\351\264\270[\264go\307k\207\366\037\300\233"
+	.ascii	"\t]\262Ks\345$\337\013\235q\035\201\013\"\327\320z\304\371\206"
+	.ascii	"\206\025\351\005\026jz\273\267\216`\025rg,\t\372\316w\272N\005"
+	.text
+	.section	.gnu.lto_laggedMovingAverageInit.28.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\\\001\305\r"
+	.string	"f\331[E\020\257&\035h\302\345\321q(\214 4\250\001\216\362\352\021\207\375\023\316\025\374RM\300\360\333\344\324\334\272a\334+\\\204\n\304\204\001`\313\022\001\026"
+	.string	" \017*\034"
+	.string	"6@\026\356:\334\255mA\354\336d\313\224\002C"
+	.string	"E"
+	.string	"L"
+	.string	"\366[>\342\273\313\310\001\354\242b\250\330\005\021\330"
+	.string	"vi\360\002\346%\366"
+	.string	"\363\322\237=s\360\303\376\004\215\t\fkw\263\250\362\357\372\371\207\271\306\351\204t\3450\330]\353\351d\303\035o{\303v\207\375\2316H\322\350\301\376\265\273\353\210\262\237\372\261\277\374\363.\377%\325*\325\377<E\305\222\321 fWCk\306\272\220+B\330\276\307\366\225\262\314"
+	.string	"\320\232J\260,\210\340I|\177\031)hM\245\f\t\260K\220^\003%\221\344\353n1\0375\276DD\351\261\023\322\230\334\204\266u\303\226\360\320\341\352f\205\205E\233{\n\313H\01665(3\332\335QpL6,(\037M\273\302M\214\260\335U\340\307\\"
+	.string	"\371\300"
+	.string	"12/;T^thY\221h+\037\026\036\304\020\206\315\201H\007A\264\211t\2465\016/\0242a\373\310D\035\307uZ&\332<\270L\363@2\016\002\356(\204\274,\244\353\274\314\003\356\257\215(\313\024U\215\212$\226\354k\323\3668\013-\325ZY}T\343\201G\330\364'\027\b\034"
+	.ascii	"i\231\"\023\017\377\242\301\005\027(\177\301\205,\326\370B6;"
+	.ascii	"\\\037\020A\212=GSS!0IQ\035\252p\337\342N\231\260\3325 \300\206"
+	.ascii	"VB9\230KB\260 |\246F\301eij4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_laggedMovingAverageUpdate.29.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\207\003\365\026"
+	.string	"f\351\215I\320\356*\035\212\032\016\236\370(\313j]\204\312\300\200\017\210\332\343~\310d\016\317\353V,\363`Z\260\032\374\316\2146I\025\247n\3375\250\361\006\003\340\005n\020\005\017A\001K\202\003\201\307\002\210?\336\3677B\366\336R\312\024x"
+	.string	"m"
+	.string	"\200"
+	.string	"+:\265\326\216\017X\376\027\270\035n\0334Y"
+	.ascii	"\265\266\030\351\324\032\3548\307\270\363\301\361\377W\303n\270"
+	.ascii	"\375B\031|\371Q\036\003\025\233\242Z\253kcYt\247\\\f\272\263"
+	.ascii	"%\354m\351\224\315\267\257\b\"\217z\204v\275\223\245\016v\246"
+	.ascii	"z)r\243\326\252c\311\262-9|$XR=\024\311\002\212\220bk\226y\275"
+	.ascii	"\034\263\bRk=\357z\r\366\342\376\237\375\377\370\233'0G\2607"
+	.ascii	"\027\216\265\326\217\257M\210l\374\231\320\235\333\255\337\317"
+	.ascii	"\307\001\210\343\341\037<\341v\371W\326n\321\030\371\255\245"
+	.ascii	"\331emp\027c\344\257\230\257\022\371)\312GI\376I\362M\314/1\237"
+	.ascii	"\304\374\221\371b\363\351\344\317\311\227\222\337\315g\346o\200"
+	.ascii	"\225\371)Z\021\302"
+	.string	"S\353\312\360\250\376\314\035\n\377o\277\351?\363\322\\(W\225\227\013\252\240\031\034\fD;a\347\373\351v\371\251Mm\240\346\004\n\267\370\377\332\036\330\251]0@S\363\3002lva\264\333\324\004D\fu\276R\bR\227|\271\235\013I\33537F@Vg\274\230ln2@\030[\210\n\332\035\013\261\267\307f\027\272\n\271\005Q\273\360\373\034\272S\354\345=\230\315M{u\027\344\336\207\312\236-U\350br<|\267\354Uy1\262\037`\335\036\261\365\360\034n\001\001%\nHf\261I\377\362\250\215\224$\210\035p\315h2\031\355\345\232\305Dd\256W\315\346\362h\235F2Rs\225\320h5\227)XW\326n9\317V\257\005\231\034y\352U\363\376k\364\006\256sWu\2515zu#r<|\252U\275\272\241U\247zA\217\220\312\013\034\017%5\2618/\255&1\327ZO\246\215\242zcjP"
+	.ascii	"\331P]\3407$\333em\364\027\331\02261\005\247\210\b\007\243>\260"
+	.ascii	"F\250Q(K\"f\204,\020\231DJRh\003`\"\021e\327\001\021\240\245"
+	.ascii	"TT#E\005\333\f\351\022\307\314\315\027\315A~\217\243\351pC\313"
+	.ascii	"\205Z\034\222\264\0169\fD\262\216\352A\337 \222\211TP\222\004"
+	.ascii	"\234N\362C\203\016<\376\257\230\332\025\005Q(\206\b\203;\036"
+	.ascii	"%\354\256\250\214\030\2154\025\201\241\301?\2635\332j+\033@\006"
+	.ascii	"\326\262\356\255\013u\315\226\326!\315`\306\003\311\336\330\306"
+	.ascii	"\024\177\213\337.`\244\330\336\367x\306\tqd\355\245\006|\345"
+	.ascii	"PA\315\301\225\226\"\031%@7\263\360S\314\240\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`\366\001U\007"
+	.string	"\364\t\362\002"
+	.string	""
+	.string	""
+	.string	"\002\005\177\037\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\006\177 \007\177!\b\177\"\t\177#\n\177$\013\177%\f\177&\r\177'\016\177(\017\177)\021\177*\020\177+\022\177,\023\177-\024\177.\025\177/\026\1770\030\1771\031\1772\032\1773\033\1774\360\372\2508\034\1775\035\1776\001\037\1777\377\037"
+	.string	""
+	.string	"\200\200\200\001\036\1778 \1779\003\013\031\204\001\003\013\030\244\001\003\f\013\"\003\r\242\001\003\016\021\032$\003\022\013\371\353\201\247\003\001\242\006\003\023\022\"\003\026\344\001"
+	.ascii	"% P\203\320\264p\302\3620\034U\2439vn\0368\264ghI\207\001\365"
+	.ascii	"p\004R$\227>D0d\217v\367s\372\221\375\033\337\360\r\337\370\306"
+	.ascii	"o\370\3067~\3037\276\361\033\276\361\215\337\360\215o\374\206"
+	.ascii	"o\330\217\266Ec"
+	.text
+	.section	.gnu.lto_.refs.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f95f9f9efd63bd06,"e",@progbits
+	.string	"(\265/\375`d#5\221"
+	.ascii	"\372\340\2601S@PBJ\007\017\207>\225N\004\267\206n\037\203\020"
+	.ascii	"\213\203\344\301\307\356\346\324\270\nGD\240z\253\035\245D\350"
+	.ascii	"\234\002\262\322}\311\306r\211\334\312\201\217\261\335\241\214"
+	.ascii	"\345\001\233\220Gu\241\226w\260]XU\231\0072\240R>\017\226*\224"
+	.ascii	"\316\030\265\236l)S\212\002\f\003\"\003QL\376\264\260U\263\350"
+	.ascii	"\230\316\260\346\264\332\210vlP,\325*mU.K\330\252drkmU\316Rw"
+	.ascii	"u\006\206\365\270\217\375\370\013\363q\030\306\343=\226r\036"
+	.ascii	"w9\337\261\227<\336\302P-\266j\333\266#@\214\330\340<c\326yX"
+	.ascii	"\317}l?\371\203p\001\266c\317s\354\031\013{\246\262g8\366L\205"
+	.ascii	"=Oa\317j\354\031\215\305\211\273\262aIF\0314\272\201\255y\304"
+	.ascii	"\326T+C>'VR\257U\330%qX\244l\261g\254\266\300\2545@*<\345\017"
+	.ascii	"\216\337\330\215\245L\205\331\204d@rT\261b\317S\354\371\211="
+	.ascii	"7IQc\347]\024\215^\243\200\270\320\277\3010\275\236m\210\211"
+	.ascii	"m\2051\226\031\227\215A\333\266=\3434Fc)\233\361\330\031\n\223"
+	.ascii	"-G\200\030\n\312\375Y\261\353Y\006{*\177\020\322\304`\357\303"
+	.ascii	"\376\034v\006\273\314\243g4g\303\0215g^\257O@\254@\247\245\324"
+	.ascii	"\353U\260\347\254\256\233\331\310\264-[\026T\202\237\370\263"
+	.ascii	"\026g\361\224\267n\306T\260V\206\324\201\276#\253\275\276\266"
+	.ascii	"m\317^,\345)s\235\257\030\353k\264m\301\332\266\0351\002\204"
+	.ascii	"\214\325S\023\"\341\372\023\354\035`\317\321s\210k)8\313\276"
+	.ascii	"\331\225;\b\021\340\017\302G\371\203\220\345\016BA\006\332L\\"
+	.ascii	"\360\263\005?\243\270\0138\377\r\022x\200\007cJ_\037\376\213"
+	.ascii	"\364\263\023@\251\314\177\207~\346\360\377\003\007\3008\334!"
+	.ascii	"\347g\017\004\374<\300\317\005\250\360\367\020\377\255\352\335"
+	.ascii	"\026\247\371o\013BV\270\315\177I\340{\315\177\277\374\337\373"
+	.ascii	"\337\367\237\357\177\336\1770\377\375\376W\377\353\275}\271\207"
+	.ascii	"\377V\3603\217\274\017\2327\204\001g\377{\363\377\215\312e\030"
+	.ascii	"^\376\233\375G\373\177\366\341\337r\307(\217\371;\354\277\327"
+	.ascii	"\377\351\205\177{\275\377\256\372\375{\310\317x?[\371\031\356"
+	.ascii	"\347\266\237\325~\036\373\371\353g\351\317W?'\371\231\310\317"
+	.ascii	"B~\226\3729\352\347\247\237\231~n\376\\"
+	.string	"\343\347\242\237\333\237a\374\f\364\363\361\347\235\237U\374\354\302\317+\374<\301\317\031\374,\300\317\007\374\377\373O\375_\345\177\224\377O~v\340\347\365\177\001?\217\360\263\b\377O\370\331\203\2379\370y\203\2375\370Y\201\237\023\3709\304\317\b\374\017\374\017\370\377\312\177+\377\325\376\203\3757\341?\212\377n\377\005\030\034\034\034\374c\300\376\265\351\027\240\032\b\264?\265m\227PI\016\240\222\226PJ\314)T\233\\\032I\3464[\250$s\332\2669\355r\231\004\341\331\3460\247mR+#.\211\333(T\262]>\333\234v\331*\021`.\241\222\230SeR\016s\n\225\324N\241Z\234v\251l\316X\266\315\234v\n\205\327N\237I8\314\3513\2119\205rr\023&\226\033I^\324(\032,e.\333\032HM\312&\016\225\031}\266um\313`Dm3\201\266mz6\353\224J|6D\2551\004E\371\024"
+	.string	"i(\352\331.\251L%\317\266U2\344\242E\232 \031\245\266A\230\232\374\321\324\036\021\265\355"
+	.ascii	"Hm\233\344\226\332\266m\262m\333a\263)\332\266<p\230P$\244\266"
+	.ascii	"u\202@j\233\222hDm\333`Z\316\222\230\323\250'\021\355k\nm\213"
+	.ascii	"\242I\206\266uPMv\232\224\266Gm\333\362\027\026\232\204#\317"
+	.ascii	"\254L\006\314\324\351\244W\262\rL\260\322r\030\261o(=\326\266"
+	.ascii	"mQ\220\265U)\242\303d\226\321\033\231\271/=\300\374\372\t\336"
+	.ascii	"\226\245\2509\266\247\355\305\322\376z;m\333h\315U\356\2003\023"
+	.ascii	"!\274a\021B\263\346\372\312\365\224\342\320h\321#\003\243\262"
+	.ascii	"\177K\253\206WkQ`\321\227\tmd\365\315mi9\021\224\262\325k\226"
+	.ascii	"\320\212\312\007\237\230UK\275\354\004QS\246h\350H\002"
+	.string	"#]\304F\211\323.\207f@{\252\255:H\027\271\3213\266\250\213\006\223\306\352&\355\244\257X\332V}\344\rm\252\203\260\352\032nf\263\214\266D\204X\214\210\232\372\254\032IW\331$\243\255\ra\024\022QS_\333FG\214\240\341\203\203&\321\254]\325\255\244\227\274\253:\t\315\262\253\326\266U2\207\260a\016\021#\245\210\262K\270\376N\331\337,\226A\334)\366W\007\333Bz\bK\033h\"o =\365\030e\264\215\366\220\300\260\256^\177\217\330s\003\302;8\310\r\b\177\223ls\007!N\363\261\357/\354\337?\032`\227Q\306\260\2428of\355\007\215*\024\017\241\020\267\226\250\237\372\3318~\330\325\365\352\203&\214\313\222\b\013\333\324=X\332NM\364.jf\t\n\332\251\223-\203\251N\f\234t\251\266m\224\350\3243\232\211\251`\253\336]u\304\210\233\"{9\220\204\353{\260\333\346\321\317"
+	.ascii	"\204\332\254<\365\2724#\245\326W\306\236\261\264\f\321\3217\032"
+	.ascii	"G\357hg'u\016\226\266R#\275k\264\r\273*XM-;.\022p\035\230\272"
+	.ascii	">\262\253\266R\035\210\021B\243*\025\0378\353{\214\345\002\226"
+	.ascii	"\260\357$l\323 \276\215:\b\233\316\350\r\006C~8\351\365\026a"
+	.ascii	"\207O\275\356\301\266\262\207Xj@/_\202\202\337$W\213\325\266"
+	.ascii	"\321\233\032A+\301\277^\337:\330\263\001B\036d\003\204o\032\354"
+	.ascii	"\260\255r\007\241\0017\321\035H?\002\001W\277\300)Kz\375#\023"
+	.ascii	"\022w\354f1\001r\244\327\033\266\326\325u\277\224\332\231-\032"
+	.ascii	"P\236\274~\277\376\256\350M/\225r\352\215++\353JY\307s\016I\023"
+	.ascii	"\266\207U\021R\364Wj\363\325%\347\326\353\335\272T\367H\024'"
+	.ascii	"\276^\257\326\320\310\255\272U\367\312\303`u\016I\337\320K\312"
+	.ascii	"\b\324\311\357UW\r\227r4n\364z\255.\225\337\f3\257^o\023&K\206"
+	.ascii	"=\256\221k\344&y\002W\343c\213Q\323E\362\233\004i\313[{\251R"
+	.ascii	"\260)\231\242\202\326<\373\2408|\334\350\315\0319\335#Mt\243"
+	.ascii	":\206\243\327\017\215\210\020\271B\310\2403tT`j\360\233\232\272"
+	.ascii	"B\272\210HKY-\351\350\365\n\241a*\367\262z\275@\356RT\230\335"
+	.ascii	"\216,RRtNY\264@)\213\212\272L\3346\345\002\2235(u]\335\036\267"
+	.ascii	"\307}\222C\202\336D\373\262\004\271\317\337'\256#*~\275^\037"
+	.ascii	"w\351f\312\214\255\300^\257\323\312\306EV\025\023V\261\001\030"
+	.ascii	"f\352\306\215\313\344\305\203\016\320.\356\362\370e\272\353\341"
+	.ascii	"4\345\322\353\335q\227.X\272\311-]'\332\017 \312?@\246<\272\253"
+	.ascii	"\304]\256\022('\324^\257\216\032jt\007R\2577G\213\331\020\221"
+	.ascii	"\322\332\321\353\305\361\241\0171\300\275\006\353i\334\025uG"
+	.ascii	"\263\331T\344\230LuD\212\253\327\013\211\356\214;\343\326\340"
+	.ascii	"\340\267\312\240\022\247\244\327[\303\214\200/;g\257\227\306"
+	.ascii	"=\2421\313\022V\344\036]#a\034\223YC\364H\314\210\227\253\274"
+	.ascii	"\312[\204\345mH\226#\355\355\022\375\026\335u\020\257jW\257W"
+	.ascii	"F\013\262]LI\324z\275\313\233\305H\245\320\342z\275Cm~~\267\205"
+	.ascii	"\022#\245\326\304\307\340o+\323\234\342\005"
+	.string	"\332k\377\265\240\314\326Z]\023\301\016d2\2456X\205\231\324#\003d\266\225J\n\221\226^;\214\227\236^\363\371\270O\222\264\230`\336|\327Him\251\327\336\353*\r\232\364h\252j\313\226\316cg\006]N\241[\027U\022\274w\336\206\032s|m\257\335\245\253n|M\316\252\227\233\266\260\036GQ\206X:\002\255\356x\214\005\265\272\272zm.15\314\315\265]C\207_C\314\252\315_\224j\256\356m7\343\005(\305\245\327\246\213Q\312\222\245\343n\333:\375Ae\2264}\030\351\3651\311\267\267\216\343\322\245\332:\235\"j"
+	.string	"\211\336\256\274\343\356n\232\b\216\351\350\265\341\232J\203\343\251\317\214j\345R\025\251\241\364d\357\352n\250\327*\314\325]jx\001\3742eJS\301i\207\356\254TY)\023+<\332\336T\326\247\272\245\251^\233\355e\322\272!r\354\373\254\321\336iOk)l\333\2663\250sH\372Zg\223\b\231\276#[\324\336RnF\323\266\005\324`U\301\301\354\265\243\364\215rK\240\216^\277w3\256*\263\022\263:\013[e\263m\333\0331\321\2669Ds\216a\026\361\327\360\375\332\266\007\201l\333\344\027U\217Mb\246d\352\306\026Ed\n\310\030\306\023"
+	.string	"\270\013\bZ\370\034\201\220A$\214;B<+|\216$\200\202\204H"
+	.string	"\340\363\3433D\352\030g8\006\ta\374"
+	.string	"\271@\376\370\fY\024\215<+\322\030\324c\354\021\372\034\203f\356\002\202 \027\310bO\214\037\240\027/\212:A?+f\004\b\200\003Q\205\024!\244(ag\247\203\016;;\035\340\344\344\020C"
+	.string	"\301C\b)J\370\020B\212\022:\340\240\340b\005\362\347\004\244Q\204\033\344\212\343\216\021(\005"
+	.ascii	"\037:\334\330\330\260`\361\203\024\372\300\210,\356\274X\341"
+	.ascii	"\003\362\3503\202\317\261(B\315W\310\300\363\342E\007<"
+	.string	"<B>7_q\0042\372\030[\260\237\300\304\003&N\304\030\376\004\212\bPD \374\t\024D\"\n\023D\366&\210\027\031\244\303\"uJH\240c|!\203\n\034\220\305\037\036\0261H\236\237\037\017tbv\214=G\240\027B c\f\035\230\260cl\321\242\310\363!\206q\307g\004\026r\220:&\210\254q\206c\n0~v|\2160fz\204Rh\341s\214\341\247G\206\205\220\212\213,\021\324A:)x \006\265\261E\220\216q\247\270\"\250\370\301\rR\347\004\322\347(4D\372\b\375|`lQD\006\315 K\310\320;E!\030\216*l\"P\321D\025]BE\023\213]\242\330\304\030]\"F\023ehd\261\205\261\347'\246\2104zPt\361\202\247\230c\024\342)\306\020cD\026\201V\344\016\317\217\213 #\220\013\244\f\r\362\330s,\001\206\221'H\006\351\202\200\377\2740\002\221@\376\374"
+	.ascii	"\221\330\360\002\007\351\204@D\276\330p\"\361\003\004V8A\004"
+	.ascii	"v\005\004@F$\317\221\005\t\237\237\236\236\237\025$|\216\305"
+	.string	"\036\022+\200\202H@0\200\021YD\006\305<\032\335p\346\024\226C\260\231h\216H1{\273\201\367\n\f\311j\250W0`\356\037\267\315/'\002\237M\021\377\345\373\375\273a~\314\240\013\343\247\343\t\013\323\222\215\330\231\022\256\333\327HI\252\344\2442D{x6\324\255\301 W\357\302\205\r\342q\371\302d\023\005E\235\353\365\312\257\334\225\213w\347h\332$Wkch\3266\245\325\3272\235\"6H\215\244W\270\374\342\375VKP\360.l\223%s\312^\257\227\337;'\\Z\265\313\275\373ef\222HM\231\320\261\177\200\345\332\221\224\324\353\335\362.J\272\034\341\365z\265\\\212\223\256o\312\256J\024\226\241^\357\334\245c\351\335n\335m\322\212\302\334\250\354i\340\273\t/\226\337,iNRPlqbsL\320(\354Y(V\254\\8\306\211\016\311\031A[\3402\222'e\357\346v\341\230\253\265Q"
+	.ascii	"\2324\312)\202MJs(y\373\205\343'Z\2560\255\255\3356\252\247'"
+	.ascii	"\2169\266\33768'N{\275\336)7M\006n+H\0246y\311.\331U\013\363"
+	.ascii	"r\205\330\370\262q\243\374\252\325\020!9\231\335\264\2300Ax\220"
+	.ascii	"\335\264\2136\304I\243\231\225\245H\r g}$\006\265*\327\353-\353"
+	.ascii	"\"\314\374\202\303\355e,\325\332\214%v``w\254M\342\205`j\316"
+	.ascii	"!\351\033\376"
+	.string	"\255\271-\211=\203\b\250\262\3710\310\322\312\020\242\032\221 I\222\244\003\002\013\020\004\243i\032\347\264\003\022\300\0245R*\207\320\320\210\310HR\220B\332;\034\321n\032\201\223\3504B0\001\345\016\233;\303(\242~\024c\2130\356\266\2316\203\006!\363\016\257P\261`\f\032\307\221\271\260q*R\020\254\023\223rQ\324:\303 \034\310nN\037\022\364\013\035\314J`P\004\276$.f\rf\200[\212\223Kq\2113\231Z\003\025\256EI\202\bo\335G\330\204\336m\234\304\\\263\356I\031\275\3163\300\210\365\246N\344\2106=\271I\371e\227\006\356\025\247\212i\005\201\021a\331\346\356\244\250\316\002\221\210\305z\276\305kP~\003r\220O\211v\001\260NR\007I:\f\350cR\260\244\260\372\212\315k\250y\034\223\247\023\205\351\nk\006X\324H\341u\004\342T\371\343\tRQ\261m\317\"#5\311\234P"
+	.string	"<\222*\355\267\333\233\n\352\b\255\340*&\233\235\270\303t\321\273\245\331\322v\300\342\305\334\203~]\264v\343\337"
+	.ascii	"5\006d{P\275\241g[\337\271\311\226\003\212\232X\332\027\346\363"
+	.ascii	"\373\355\260\016\261=\363\212zx\245%\303&\3214\211\354M\365\005"
+	.ascii	"\265\357\302\370Q\372\303\244\211\216\217t\3108W\264\330\265"
+	.ascii	"\030\240q+)\031)\220(\021\002\027g\234\n9\300\2249\374\240\340"
+	.ascii	"\203\224\253\343w \271\034V\340|\337\223'\375'\372\354\240X\307"
+	.ascii	"\242\322{\221\350\271\236\250w.\006\375!:p7\327TD}$U#Oez\356"
+	.ascii	"\035\303\321\366oJ.\244\266\356!\2279\006\266\235\021\024\246"
+	.ascii	"\325gu8b\304\312\230\007\302\301\245g\355\310\362\357\234\377"
+	.ascii	"\224*\211\033\347'\325\005\rf\217n\364\227\026R\025\313`e{\237"
+	.ascii	"PHtO'\212\263\322\345x\2434~\335\210\013\264\301iY\017\363fk"
+	.ascii	"?x\0034\202\f@\301\354\356\255\342s\320\227U\2419\005Z\334GN"
+	.ascii	"n\256A\271\246u\337Dh\317G'\360\372\277A\374\277\033z&\007\351"
+	.ascii	"\272\271Da\344S\027C=\244\333 &\227`A\212v\345_\267\215g\377"
+	.ascii	"\215\377^\005\202|\223m\232\347\305}\3741dR\016h\204\322H\021"
+	.ascii	"#\345\352x\2554\375\353P\335\273\373\374\336\316\334\027\035"
+	.ascii	"\235\330F\035\207e\2025_v@\374\324lh\f\335\202\337\346\0258\203"
+	.ascii	"\332\263*W\250\224\177\232N\256?\352\030\257\001\232b\241@\353"
+	.ascii	"\205\200\350\235:\254mG\236\200`\255\264\351\351U?(i\034V\232"
+	.ascii	"\205\240\353\035\253\363\3321f?\260Jx$F\206\344\322\2201\220"
+	.ascii	"\351H\270\331\203\235\t\322\003>e\251'\321\202U\320\362>~\247"
+	.ascii	"\323\337\206F\247k\030\230 H\022<\253\017\352\335s\264\226\244"
+	.ascii	"\t\255Y6\035\353\021\357T\327sh\227\314}fa\332\362\233\202\034"
+	.ascii	"0hgP6|\361s\t\326\317\215\341\377\027Y\035\235\302`\013\231R"
+	.ascii	"M\203\311\274\3678\365\277*\370\347wDr\311\207a\t\\\215\035"
+	.string	"\002\375MCl&\331F\003\346\215B,$\346\361\035<\265\371\335\007"
+	.ascii	"\273o2R\372\t\377<GC\220\b3\"\322\266\267RG\236\331\312b\267"
+	.ascii	"8\3444=\324\256\276)G+v.\033\356X(\347X\334\316\241\334\377D"
+	.ascii	"\240\026*T\300\351\321\006\340\275B\3154ki\220w\244\214\242\006"
+	.ascii	"\236,\202\244\016\033\352\234\001\232\353\004\374\032p^\030j"
+	.ascii	"\314w \324,(b\337\367\306e\376}\311\321\300N\207\336\311l\310"
+	.ascii	"k\004\306\371s&\3718\241\216\230\261,\002\375\256\f\3210\345"
+	.ascii	"[\304\200\n\327<\274\005\246\214EP\271xS\360\271`~\360Nvz\021"
+	.ascii	"\320?\016\0320\300\314A\020\311?V\227\211\n\b\rz\314\346\005"
+	.ascii	"\007\343\3678Is\237;\214T;\256\254\"5\026\222z_.M\202\037,\343"
+	.ascii	"\324\300y\037\227l\351e\216\\\371!~\2009\203\311A\375\016\326"
+	.ascii	"\025\301\022t\205\020\212\314Z\312\253p\336&\305v\020[\234\311"
+	.ascii	"\314Z\022\252\352\377\211=\241\246\351\253\211\274[\347\343\311"
+	.ascii	"8i\300\265\375\200\205\240FY\362ymP\344\377\355\343\032d=\235"
+	.ascii	"\366~\365\237\030\026\247\211\251\375\362\277\216\n[0It>\270"
+	.ascii	"\242E$\263J<\0210P\330\212'\224<\217\366\342\302q:\033'\306\362"
+	.ascii	"\346K\257\033\341\205\345\021$\007{Vm\261\310\337\2428\235\334"
+	.ascii	"\327d\016f\3266H\216\362\247\016\276\263\371!\311/\341\332\350"
+	.ascii	"\357\367\"mR]\227\203\344\t\345\223\277?\210e\277\0346\311\235"
+	.ascii	" \371\207ZT\0379\023\303\313\360\006\003{\321\006\361\207\277"
+	.ascii	"\210]]>\320?\340\023\370\025z7\f|rn\332}'\214<\377|3\330\327"
+	.ascii	"\204\2135N\237\217\323?\275\273\204/\325\343\267\320VS\367/\201"
+	.ascii	"_\243.\313\275\273\317\036\362\007.\226\003eW\016t<\016\267\033"
+	.ascii	"\024qW\322\003\272\344\335\300\216\235\203\342!`\300\361\017"
+	.ascii	"\350\371\327\356@\351\312\232\177\341\271\271\330Cv\027\232\033"
+	.ascii	"x\267j\177\343#\006\335\270-H\256\314\3613\202s\025\343\323<"
+	.ascii	"\326\007\236\256\336\330\025M\200=\3456`\274\330\025\026\217"
+	.ascii	"\t?\350\333\023\273\223\301'\177=\327\272\375\320\331\301\343"
+	.ascii	"\253V\336\254\351\220\2615Dr\235;\303-\377\263\201#\330\226\277"
+	.ascii	"k4\0060{\007\033i\362\265\337 ?~\317\367?\372\307\034\r\305\313"
+	.ascii	"\263\034v\277\027=<A\033\206?\034~\234\021,\237\271\027\255v"
+	.ascii	"\247\tm"
+	.text
+	.section	.gnu.lto_.symtab.f95f9f9efd63bd06,"e",@progbits
+	.string	"nullFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"slewFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"slewFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"alphaBetaFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"alphaBetaFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"alphaBetaFilterPredict"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"biquadFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"biquadCascadeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"biquadCascadeAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"biquadCascadeAddLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"biquadCascadeAddPT1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"biquadCascadeApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"laggedMovingAverageInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"laggedMovingAverageUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f95f9f9efd63bd06,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
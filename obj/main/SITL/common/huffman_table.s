@@ -0,0 +1,194 @@
+	.file	"huffman_table.c"
+	.section	.gnu.lto_.profile.192567fce23a613,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.192567fce23a613,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\374\360\213\226\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.192567fce23a613,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.192567fce23a613,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.192567fce23a613,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.192567fce23a613,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.192567fce23a613,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.192567fce23a613,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_huffmanTable.3.192567fce23a613,"e",@progbits
+	.string	"(\265/\375`\221\037\335J"
+	.ascii	"\372\2048\035I\200\n=\351@\021`A\026`\220\005\005\024\b,\204"
+	.ascii	"\b\"\210\200\202,(\020\224B\021c\016\204\351>\207a\272\317a\230"
+	.ascii	"\356s\030"
+	.string	"f\325}\036\207\021\0043\3660\202`Rl\335[\2675mm\f\306,\016\321\226\221I\246D\352\330\001\352\001\240\001\"^\003\001\322e \030\361\227\007H\234\345\201\022Oq\300\304M\0348\361\221\006P<\244\201\024\367`@\3057\030Xq\214\005X\034\027hYT\300\005Q\201\227\302\004`\006\023\210a\232\220\36131\263W\202\006\257DM\335Erya\323p$n\272\215\004N\253\215\310\351\263\021:M&b\247\303D\360\264W\210\236\336\n\341\323X ~\332\n\004PS}\b\352\250\017B\355\344a\250\227<\0205R\207\242.\352`\324B\034\216\372\207\003R\363X$u\216\205R\333\234\264\271!/5\315\006\314\3241\032rS\273h\300N\275\222!?5J\006\f\325%\030rT#1`\251\0069i\363B\236\352\216\013T\255a\241\302[\300U\215\331J\021\001|u\230\225\204\0250\226`\316\002<"
+	.string	"k\365\345-=\0030\327]\356\242+"
+	.string	"{\311\345\2577\0020\030[\016K\243\200\305\314\362\330\330"
+	.string	"\230\f,\227u\t\200\315\264\362\231\362\244\315"
+	.string	"0Z\325I\225\237L\233\312jP\023\360ZSfS\222\200\333\216\262\033Q\004\374\026t\322&\204\f\347sR\345\343\270\272s\322\246\034N\246\027_\341\313\346f"
+	.string	"\300t0'm\336\\\327rR\245]\332\251\234\264y\361\335I\306#I\346\211X\254\367\261\334\343\310|5#\331\367\350\330\217\261\227\177\211\235\001\r;\311\034<i3\302\347@\300\2232\001P\024\354;i&\303\203z\215\233wuIHWs\241\\M\032\276\035\262-\021\323r\242\331I\243((\216%\027\301(f\354Z\322F\255\223*+\262\343\325I\225\022<\320G\252\223f\bc\270bZ\341\251\245P'\215\362\340\003\n\370#c\003j'P\013z\361\324V\320\212\n\017\033\001\026I\357\213\226B\347MY\303\364\002\350\274)c\020n\317y\221\312\bW\347\274\310,\341\336\234\027\0315\341\326\234\027\331\024\300\2259/2I\200\373r^d\321"
+	.string	",A\024.\312yS\250\005\001\267\344\274\310\236\002\256\310y\221\324\302\200\217\233\0038\222\025n\006\r\002\2172\026\030a.$\272`0d\311\320T\321\020\210\262\341\317\304\202\217\204C\036\262\203]\210\207\271\217\017q\035 \3346B\254e\210x\264\2232G\224%\222\020C\274\370:,\301eh\"\2530\201+B\005rs\001\251A\006\236\004\033`\nt \351\244\231\371\200\321I\231\216\020\f\001F"
+	.string	"\364w\242\307\017\205N_\212\033>\tj\366&\220\321\243\340%\257\002\026<\013R\356.0\261\303`\244.\203\020:\r<\3466\3308i^\346\3078)\223\261\312Q\316j1\356\n\021NY\370\2065\350\226\305l\323\362c\333\332[\343\302;iV\303]u\331ky\322\246\330\027\334Is\032\006k\313aj'm\206\211\235\2354\243aza\307NKF-\310\300N\232\317pYW6\323\002\303g\312\214V\365\205\323\246\262\032\224\027^k\312lJ]\270\355(\273\021q\341\267\240\f\347\263\205\343v\262\034\216\026^&\363\334L\026\246\203\311u-X\330N%\337\235(1\036I\316\023\271\302z\037y\217\303\n\363\331\214\334\367X\205\375\030s\305\237'\236\264\211\001\r3\263\271\001\016\f\314\202\177\032\340A\276\334\314\313"
+	.string	"\023\332\345\3029\f\260a\\>t\273"
+	.string	"#\256\345D4\013\260bY^\024\253"
+	.ascii	"3~\345F.\n\260cV\256x\274:is\002j\206\341R\022d\370\223\004\032"
+	.ascii	"\316\224b\303\223Rp\270\021\212\016\037B\341\341@'>\274\347\004"
+	.ascii	"\210\353D\020\3427\021\004\036\346cN\346f~\346i\256\346l\336"
+	.ascii	"\346o\016\347r\276t:\257\363;\307s=\337\363>\367s@g\272\240\017"
+	.ascii	":\241\027\372\241#\272\242/z\243;Zl1\254\206\335\260\035\326"
+	.ascii	"\303\202\330\020\213\264#\266\304\232X\024\233bW,\213u\261/6"
+	.ascii	"\306\312X\032[cm\354\215\315\261:\226\307\366\330\037\013d\205"
+	.ascii	"\354\220-\262F\026\311&\331%\313d\235\354\223\215\262R\226\312"
+	.ascii	"fke\257,\226\315\262[\226\313z\331/\033f\305l\2315\263h6\315"
+	.ascii	"\256Y6\353f\337l\234\225\263s\226\316\332\331;\233g\365,\237"
+	.ascii	"\355\263\177\026\320\006ZA\333\264\204\326\320\036\332D\253h"
+	.ascii	"\031m\243}|\374\031\257\361\034\337\361\037\017\362\"\217|\222"
+	.ascii	"/\371\223Gy\225_\371\226wy\230\217\371\231\247\371\344\333<\316"
+	.ascii	"\347\374\316\363\274\317\377|\320\013=\321\027\375\321#\275\322"
+	.ascii	"/}\323;=\324G\375\324S}\325[\275\362\261^\353\267\276\353\275"
+	.ascii	"\036\354\303~\354\311\336\354\317>\355\325\236\355\333\376\355"
+	.ascii	"\341^\356\227O\367u\177\367x\257\367{\337\367~\017\370\314\027"
+	.ascii	"\374\301'\374\302?|\304W\374\305o|\307\213/\306\325\270\033\267"
+	.ascii	"\343z\\\220\033rG.\3115\271'W\345\256\334\226\353ran\314\235"
+	.ascii	"\27147ym.\316\315\271;\227\347\372\334\237\033\224\342\016]\242"
+	.ascii	"kt\217n\322U\272L\267\351>]\250;u\251\256\025\212\213u\242\003"
+	.ascii	"\016\266\356\325y\225\324\342\274U\324\3421\275\270Q\347\225"
+	.ascii	"\242\026\355d\202\351\305]:-Y\025T\212N\321*jE\261h\026\335\242"
+	.ascii	"\\\324\213~\3210*F\311h\031=\243hT\215\256\3216\352F\341h\034"
+	.ascii	"]\3229ZG\355(\036\315\243{\224\217\372\321?\032H\005)!-\244\207"
+	.ascii	"\024\221*\322E\332H\035+\256\030U\243n\324\216\352QAjHE\326\221"
+	.ascii	"ZRM*JM\251+\225\245\272\324\227\032Se*M\255\2516\365\246\346"
+	.ascii	"T\235\312S{\352O\005\252Bu\250\026U\243\212T\223\352Re\252N\365"
+	.ascii	"\251FU\251JUs\265\252W\025\253f\325\255\312U\275\352W\r\253b"
+	.ascii	"\225\254\226\325\263\212V\325\352Zm\253n\025\256\306\325e\235"
+	.ascii	"\253u\325\256\342\325\274\272W\371\252_\375\253\314\032X\007"
+	.ascii	"k\263\026V\303\212X\023\353be\254\216\365\2611:\2437\232\243"
+	.ascii	"=\372\243CZ\244G"
+	.string	"\232\244M\372\244SZ\245Y\272\245_\032\246ez\246k:\3317\215\323:\275\323=\355\323@\035\324CM\324F}\324I\255\324L\335\324O\r\325R=\325\271\253\372\252\225\235\325Z\315\325]\375\325`-\326c]\326f\215\326i\275\326l\355\326o\035\327r=\327tm\327w\235\327z\315\327}\375\327\200\035\330\202\335l\3026\354\303Nl\305f\354\306~t\354\031\256\341\034\336\341\037\016\342\"\216t\022/\361\023Gq\025_\361\026wq\030\217\361\031\247\361\244\3338\216\347\370\216\363\270\217\377x\220\0139\221\027\371\221#\271\222/y\223;9\224G\371\224Sy\225[\271\322\261\\\313\267\274\313\275\034,\203\016\250B\370ZY\355\237\001B\217d$I\322\001\022`\360\3301\001b\004\344\007:\246\301cerS\255\f\236O&{l\363\r\240\032\362F\327\003\274[\b\020 M\363l\345a]\377\177s\350\357"
+	.ascii	"\024\f5\326\001\277\365)\262\025D\021\364!\235\232Z\032\025\252"
+	.ascii	"2\215Z\212\n\252nQ1\nL\232{tiI\224Hd\311\023\340\3267\003\\K"
+	.ascii	"\302\001L"
+	.string	"\366\026\226\303Bh\352C\205ZD\241\013Y1\365\357\357\r\370\230\263|A\\\314(\022Dc\027\330\320\226\251\032\035\231\217\f\020\212^`\245\016X\024\365\017\340r\372\341\243\003m\001\025\t\020\200\004\021H\266\333O\324F1\253 \242\204?}\001VT\275\271\tnz\340DQ\006\022\205,z\340\237\032\235T\340\254G'%8)\321I\tGJ8R\302\231\022N\224p\242$vW\321\346\200\013@~;\375\200\236R\230b8\365\020B1\336\250\224\027\270@i's\213\370\t\336\347a\032"
+	.string	"\036G\003\241,KT\246\027\236\221g\246\271x\006\016\233f\3454h6\316\223f\345\\pF\236\031\347\342\031rl\232\225\346\240\331\252w\367\001\206H \200"
+	.ascii	"\006\030 @\226\207\343\350p\230\036vG\347aX\360\026\256Ec\341"
+	.ascii	"y\264\026\256#\307az\260\035\235G\303\301[\270\034\215\rm\244"
+	.ascii	"B;\\&\032\262\204\323\230r\353\302\371\361\\8\232\357`\307vd"
+	.ascii	"X\006\230m\223\235\344\204[P\252\243$/\270Ai\216R\275\340\002"
+	.ascii	"\245\035\272\3134\365\231\0014\353.\n\203\213\252\375\366v\031"
+	.ascii	"\306\221\275\304\366\\8\254rt\221\215c\333\017ct\242\372\326"
+	.ascii	"+\365\234\351 \007\200m\372\243\231n;\t\210DJi\241\226\200\331"
+	.ascii	"}\324\266\033\253\261Y\217#O\304;\336\210vA\204,\"\262R9\355"
+	.ascii	"y\313\250\303\363f\2104\316\237\247\020\375\360\fj\204\233\201"
+	.ascii	"\b\243\026\341\006X\033"
+	.text
+	.section	.gnu.lto_.symbol_nodes.192567fce23a613,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.192567fce23a613,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.192567fce23a613,"e",@progbits
+	.string	"(\265/\375`\303\001\255\017"
+	.string	"v^mH\340\262(\035\311W\026\343\244\035j\375me("
+	.string	"\300 `\005\302^\257\233\"\2070\241*\"\034\255\025\035\355,\021<\200\234\305\204\217z\352\351\022\031\351s\225\221<\247\257\310\350ur\\iN\374\223\377E\025\342.\211;\245I"
+	.string	"["
+	.string	"Y"
+	.ascii	"\257\242\217c\337\3467 \215\211\250\253\263\273#\021\221\365"
+	.ascii	"\221M\317\365 \235{\220\332\256\231@\212Ey\364\271\312N\242\037"
+	.ascii	"\354 \365\374l\377\330\306\331\356\261\255\263\355\331ga\033"
+	.ascii	"\310\366m\347\260=\313\262,m\037\260mc\237'9'\204v\353\211\212"
+	.ascii	"\212\327C&\210\007\365N\3435n3\335\206\357\3427\003\360P\267"
+	.ascii	"N\025"
+	.string	"Evp\246\347\f\237o\242#ey\023\365\205/\345$\352\035\244\226\360=\347:\267\225\276\343\025\224Gbn\226\266[G%\273\331nhzv\360\371%\372\362%j\006\337<H\005\234D\003?t8X-A14bfz\276\316>\355-\216\343\262]\330\356\016 \251\311\320\004\231\236\317\t\305\315hVL\317\217}7\216\273\355\271\303\360c\\\206g\335\275\355\256\177\263E?\367\031\357\271\216\231\0064\032\220\335\352\004\266h\257\240\236\373\213\363\240|\3305Q\302d\207\2206@\272\345\204\342\261\003\353\025\222\343\370\nI\310\224\002\361\363^R&dj\001\351r\201\021\271X\023X\033\306\225\310\242\370 \305\002\005\b\337\352D\246B\327\330j\215\253\320\345\242j\205\253\327Kx*\300\342\240AU\301\245j\261\260\300\264\004\260?\373kl\2579P\204\2721\030j vB\033#\201\340>\206\004\205\370\231\001\027"
+	.string	"\023C\200\247\013NB\036\317\260\3733\256\320`\260\004vCY|\241\371eC\326"
+	.string	"]P("
+	.ascii	"V\204D1V\200\001'\224J\362o\314\231$\210\261\267\212xT\370\257"
+	.ascii	"\202\226\013\230\001"
+	.text
+	.section	.gnu.lto_.symtab.192567fce23a613,"e",@progbits
+	.string	"huffmanTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.192567fce23a613,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,452 @@
+	.file	"sdft.c"
+	.section	.gnu.lto_.profile.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375 \337\235\003"
+	.string	"\264\004\323"
+	.string	"\b"
+	.string	"\222\306\215\251\t\f\002"
+	.string	"\002\001\002\001\001\240\342\234\212\n\002\003\345\222\213\246\r\020\002"
+	.string	"\003\002\001\004\005\245\377\242\242\005\016\002\003\006\253\333\342\347\005\022\003\003\002\001\007\233\353\345\222\n\022\002\003\002\004\002"
+	.string	""
+	.string	"\002\003\002\004"
+	.string	"\020"
+	.string	"\366]\213\271"
+	.ascii	"\310\327\250\303\230:\320\032\300\026\352\240\272\356\216\217"
+	.ascii	"S\003\344\352\244\234\001{ \263]\246\033h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375 j\315\001"
+	.string	"t\002^"
+	.string	"\005"
+	.string	"\004"
+	.string	"\001\003"
+	.string	"\001\005\002\001"
+	.string	"\001\006\003\001"
+	.string	"\001\007\002\001\002\005\002\003\001\001\001"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\007"
+	.string	"\200"
+	.ascii	"\b\032\020\006\001\266\351a\320\311\006\260"
+	.text
+	.section	.gnu.lto_.inline.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375`\311\001=\013"
+	.string	"\246\321:3@\217\322\030\333\326&\203`\233+\034\227g\344/\255\336\370\322\034\235\252@\024\222\371\314\345\317`\325\343\262"
+	.string	"\341X&\270\214"
+	.string	"\001\217Xw\377M\266\2242\005,"
+	.string	"*"
+	.string	","
+	.string	".\037\264\255\016Y\302\022\221\301Y\037\224\273\273g\360<Ei\2612\205"
+	.ascii	"\374(Q)\216\212\203\374]\242\346:\312\225]\022\301[gG\372%q]"
+	.ascii	"E\252\332\335\201-O\206\217\031}|O\246\177@k\267\315\365'S-'"
+	.ascii	"\024\271\346\215\265\220\236J\031\211s\301G\300\371\230\252\234"
+	.ascii	"P$\230\353\215\346\271\225!1DP4\nv{\262\366\013X\327\365\006"
+	.ascii	"\251\236\257\235\355\374`\352\361\241,\355.\346\375\256\017\377"
+	.ascii	"\277C xC\221^\230>T\231\215\225)\245\340\276t\313Jm\310M1\231"
+	.ascii	"0\370\202%\\\\\210NgaL\335\t\203\022\261<\241F$\0025 \200\002"
+	.ascii	"13\244\036wB\"\351\033\250E\266<H\024\341\276|\315\205\226\317"
+	.ascii	"\347\330\247\025\005La\324\025\274\260\033Gn\326R\204}\251,Q"
+	.ascii	"f\372\306\\\212\0350|\240j\027D\233\252I\210\343\235.\233DIM"
+	.ascii	"%\b+\276o\272\344h)w\337\001T\363\007\264\354AW\312]\023\263"
+	.ascii	"\3542\333v\212\334\263\370\242\306t\307\234\361\207\266\314\227"
+	.ascii	"M\345\002*>\260\232Y\001\206"
+	.text
+	.section	.gnu.lto_.jmpfuncs.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\035\004"
+	.string	"\322\306\023\033\260%\351\034r\210\243\020\3460L\035\003'IN\235U<\220\034[\333d\023\231d\033K\\\261\341\3029g\302_\212G0/\311\211w\250\301\274\006\340i6\216\020B\036\242\270\035\230[I\307\246\343m\245\252Rl\261\006;{\362O3\333\004\024"
+	.string	"\027\0136\342\302\013\013o\330"
+	.ascii	"\342\244X\001f\224\347\264\005g;\203I\340\003(\201.\031\206F"
+	.ascii	"I\242\323p\315\206\310|\f\260\353&o\005\030\002"
+	.text
+	.section	.gnu.lto_.pureconst.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\232\004\003\232\004\005\232\004\006\232\004\007\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"\365\004"
+	.string	"B\206\025 \240'\351\377\377\347\231\230_U\375\271\241 \360"
+	.string	"x-\221\247\020\213\270\333\377\277\033!\204H\231\002#\024\213\003\"ol\r\252\356\004%\241\311\033L\372\272\024v\341\256*:\216\210\302h\314\3566\317\373q\314\363\031hc\0132\347W\016h\227\264\254\316\350\364L\004\035"
+	.string	"@\013\003m\310\200\2411F#j.\005\"\216\002\255\317\204Q\311'\025E\317"
+	.string	"@\207\307\rH\020r\0072?s.\216 k|\024\216\263\262\266\025\t-D \356g\260\252\202\307\2633\231\026f\3328"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_.lto.529bd7546130afff,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sdftInit.8.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375`\274\006\025'"
+	.string	"\232I\220\017E\200\232J:_o\244\322\022\371\310\365\263En\177\336j\003\345\220\024\344\243~\303u\344MrV\255/\252\370c\342\376\tk\021\362\236p=\247\341N\260T\367\336\312L\275\316wJ\221\271\375\2555B\b!r\247\024\346"
+	.string	"\317"
+	.string	"\351"
+	.ascii	"ejIcvN\236f\373\214\342M\2544&\244\326\352Ca\373N\216G\263\317"
+	.ascii	"\366Y\212\261\236M0\"7WkE:i\n6k\323@\211\026\005\224\370#UGb"
+	.ascii	"7\363j\265\201\266Vk\375\371w\236\024\032O\355\227\275H\325\215"
+	.ascii	"\2508O\2558z\254\325J\374\271\350<i\342\201\312\223\347}\312"
+	.ascii	"\223\256\262\321\b`\201\223\226\265\304\256\326\n\334\034&\372"
+	.ascii	"H\274IZ\365\036\3574Kr\\Z\345\233\020fh\031n\255x\317\353\274"
+	.ascii	"syAc\315\213\236&\004\0330\272n\216G_p1t\266\262F\240-7\314\\"
+	.ascii	"\355\007~\274\350\242\345\370723\235-\341\350@\207\331\220\267"
+	.ascii	"aQ\322\007\327\307\345z\033nq}\333N[l\tG\241Z\353\321N\265\266"
+	.ascii	"\256(5!\324ZM\207[0n\337mG\261m\302.\203\001`\277\213!Wk\365"
+	.ascii	"X\253\325\020\234Q\016;\273\034\"ib\013\3056\035\372\202H2\006"
+	.ascii	"\213\262\261O\345U\f\305\017s\224\325\350\207'}\253\225'\277"
+	.ascii	"F9\310\272\254h\321&^\321\005\263O\240\256+\316\213\303\246\324"
+	.ascii	"?J}t\263\337\350gw\021\245Fp%?\321\221\374C7\362\037\020\272"
+	.ascii	"\333m\200R\0278\333\035dR\007\240\324@\224\372\207R\373P\352"
+	.ascii	"\036\223\232\207R\003\240\324;\224Z\207R\347Pj\034\223\332G\251"
+	.ascii	"{\224\232gR\237\224\332,\251\313\222\232,\251\307\222zKjZR_i"
+	.ascii	"g\354G\256V\027E75\216d\353q\267\237\355?\373\332\267/\305\237"
+	.ascii	"b\237\333\211\261\236]\214\356J\206\363M\37466\273I\261\202\341"
+	.ascii	"\\[\020m\272d)\260\275"
+	.string	"=\332\211\314\344\n\254\351\271v\206\317i8k\255\n|\271\252\262\r8bj\255\017S1\244\333\331s\303\306\256\3020\271K\272\316\356\254\251p\315\320\320\352\354\323>\016\t#\006\2513K\343C\307\265\373J\211\364\003kw\360@?\364\321\256\241-N\270+\312\005\263\317k\024Zr\307\"=h\265\210n\2672h\217&\t\031,\312\346c\255\265\222I\017Z\241}\333\221\270\336\204_\345\0301\037F\320\017\311-\227\310\245dD\306\265}\341^\f%HG\255u\201\317\345]\230\374\260\223n\0321\242<\271nC:+Z,\272\201#\356\216;~\361Q\003k\223\200*?\334\245ddqX\273\342\007\234X\334\203b\221\r\026]\003\273O\204?\256h\321AK\367S\016T\243E8gE\213\273tJ\200D\0317vR\232r\242Z\202\"\360\344Tb\237N\025<\021%!\370\004\342\234jrb\242Z\212"
+	.string	"u\"\330\013>E\b\021l*\203O\021\250\244\226\250\246\316\321LJT\"BL\001\203QPPQL\300\340\323\022\024\220Ij\n\2504\300Q%\232\244\200TQQR@\037\321\352\213\303\034d\360x\373\265\2712rg\322\217V\213\254\213\263\332+\007X\273\302\353\2006\300\3223Yw=\373\263@k>\021\016Q\272\317\376l\371\245h{\326g\307'\302/s{\214\352\336^<ZsM\263\272x\326\266\3604G\313\303\243\254W\264F\313[S\336\202\231\203\f\023\207W\343\355\256\354-\202\325B\272\321~\r\313\357"
+	.string	"\266h\377F\370\325\333\234\005\260\343\033\241\330os\022\200)\376|kc8\035\202\365\355\030Kr\376\314\211\026g\031\2041\021\246\341\351\002\203\316\\0\253\235vq\331y\005y\250a0\345\024BH\221\022\tDD\n\233f\f\240\002\221)\263:\021\260!DG2\n\223B\3669c\006\352\36342\314\331 =\346\245{\030\017\177Pw\367\375`\233\377\372s\204h]|\221\245\352\352\021\t\252\366\320\2641\257\223\211\251\037u\231+\314\223r1\222\212?\206}6\027~-/\003w\361\267\002\212\235\201\255\253\037\342\302\370\227A\324\220\264A\260\352\023\217\b\222\325\355\203E1w6E.\336\356cdo\300\262\361\"\334E\354"
+	.string	"\325\233n\025]}\264a\341\371"
+	.ascii	"\013m\204\321\013\252\004s\202\212\003\026\303tt\306\277,8J`"
+	.ascii	"\244\004*\325\250\214\340U\276t\033\341\251mc\373\307X\0354\262"
+	.ascii	"7\022\306Y\200\230\235\211\f\314\212\3013P\277\\\244\025#\020"
+	.ascii	"!U\200\213@\2214\243p\237'\016 G\221\315\267\013d\0252@S\236"
+	.ascii	"A\033\246\312\324\374\305P\001"
+	.text
+	.section	.gnu.lto_sdftUpdateBins.9.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375`r\003]\027"
+	.string	"\006k\225I\260VU:49\377_1\217\331n\311\\\230\032\030\331A\311\204t/\276\3717\202\315#\277\204\234"
+	.string	"\005\342\231|\321\274x9\247\3311r\356\007\375\007m\237i<Mk\267\306"
+	.string	"*\273\n\313\026\213\373\345ob\311&R&\031~"
+	.string	"z"
+	.string	"\202"
+	.string	"2n\237\241A=u\373P\312\321\3350\nS~\266\214_\325\2778\214\333c\344\234\325=\004\314\321\355\203\321\003\345\247\372\336\"?\313\007 ?\365\246\272\344\276^7\230\302\241\306\223\356v\261\tu\371\350\273\216{\373\034yo\372\242\033"
+	.ascii	"r\242\343\351|\216\246\036\237\024*^\317(C\\\022\356x\270\035"
+	.ascii	"Y\374\234\177\364\355Q\324\361~\276&\007\335\255\253\343\201"
+	.ascii	"\270\222WU\231\252NP\345\024\001\007p\242_\365\337\257r\243+"
+	.ascii	"jWO\273Z\356\252iW\311]\235\273:\356*\357\352\356\352Y\024\030"
+	.ascii	"\031\340\244\333\247(\245\223\246P\305\201?\322otV\275\352o\350"
+	.ascii	"q<\250)$\234\026\236U\357p\035VH(\2018\245\316\007\226\235\220"
+	.ascii	"\207\b\345m\350\2174\365\251\252F:\034\333\006\204\027\305\245"
+	.ascii	"\356~\371\324\007\345\347S\252D:\034W\315#\024b\206\177:$\021"
+	.ascii	"e\301\372\036L&3\223<q\344V\254\360\310\223g\023!A`3HX\274\314"
+	.ascii	"\314\303\\\013 \032,\357\343?j\252\027b{]\214\374\\>\351\250"
+	.ascii	"\001E\270\303c\366\341\n\377\367CW|f\361*\311\005\341\266h\341"
+	.ascii	";4\350\322\353n\031U\r\027\326\312\356f\240\203\302\206\002="
+	.ascii	"\0249\344\347\371\301#\030\361s!\334\331\"sQ\217\036\036s\tU"
+	.ascii	"\237\316\312\364\210K\312C\252\255\003\257+G\272\262>\343_=\306"
+	.ascii	"\003/\332\306`\013\273\fFs#{\2212\030\215\215Vc\253\22556\f\257"
+	.ascii	"\2339\252M\214\255\302M\315%\233\305b3\033\227\fV\023s\331\320"
+	.ascii	"j\256\030\002:\313\360\242\271l\263\031\315\225\362\365yH_\364"
+	.ascii	"\222HD\322\016\343&\227\320\324\tn1'Y\025F\361N\305(>\221\206"
+	.ascii	"\020\236%~\354\356\0365\301Q\334\342\037\375\305D1\027t*B\244"
+	.ascii	"d\023\237\202\226\313\221Ml\003:\222kAr\222\006\005(\rQ)u\367"
+	.ascii	"*\321\005F\250A<\246\024C\002)\025T 2\022\025\032\003\320\002"
+	.ascii	"\021*\233\007\021\300\261CFj\254\317\236\001\337\274d\353\352"
+	.ascii	"\353\216l\027w\241y\346\36696\375Z\210rc\231\030\276\246p&\030"
+	.ascii	"\003\021;_\373I\346\321\t\236 `h\337*\265=\277\306\323^(\224"
+	.ascii	"\341\032\020\252ob\212\243\207\021\366\200\310s\013Q4p\356\322"
+	.ascii	"i^\003\213\210\206\357LuGx\272\241\303|Z\343\362\231h\321@('"
+	.ascii	"\002\205,\315T\246\002\375\305\352\2544\235\251/\222\216\r\377"
+	.text
+	.section	.gnu.lto_sdftPush.10.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375`D\002}\022"
+	.string	"\266\243yG\340\320(\035\252\007\032cf\363]\022\364S\242\217\246l\204g\022\031D\027\271z\020f"
+	.string	"\356\225\2303\027\255\236^i~\026\302\006\345\372s1\306\030\343\020ZC\360\203\231]"
+	.string	"A\211\364D?\242\375O\032\331D\312\224\002`"
+	.string	"\\"
+	.string	"k"
+	.string	"\031`\354.\201G\227\330i{\211\327m\2143i\027\b\005\317\356\246\234\372\036G\272\247\375\021'\361z\355\345\250\335\231\020<\273\266\224\007|\217\266\035\304{\374\016\300{\364\313~q\033\315\276\305\205\031\216\214\335\005\225\303_\317\227\177\234\223h1\260\347(\301\356:i1\024n\275\355"
+	.string	"\266\021\330\311\"/\336\343\265C\350VT\213e\316\266\301R7\330\357vw\2553\366o\356\217\333\374\250\327~\217\230\346\210\351\215.}\212iSL\227\2724\251K\1771=\212i/\3231\323]\2465\246\263K?\304\373\021\022q\261+!7c\203b\217\207\337\374\366\217c\223\355\033\b\037lB\bMC\2471\253a\235\333\307\363t\244\335\216\254\247\300S=}`!G&\203\322\024\306\201\320\360\234\206FB\270\"\fQQ\372\241\271#\373"
+	.ascii	"\2239w\252\032\3652\0200\337\371\3158\277\306(\276\345i\276i"
+	.ascii	"\252C\205X\346\"\374\204q&C\273{\300vp\023\255\307\022\032U\023"
+	.ascii	"\242\236k\352g5\034^\207\345\333]\003~\316\002\327W\023*\227"
+	.ascii	"\024\326Id\245\254\264T.\257\363\212\304\205\301\211\013T\t["
+	.ascii	"\255p\005\252\240\250Z\340\252\305\005\222\2108\\a\265\200.a"
+	.ascii	"\330\002\232l\373nu\306\nV\004\305\024\306\036iR\016\375P\017"
+	.ascii	"\265U\253<\315#3\205\231\344\033\312q\322\r\326\201N*\200\250"
+	.ascii	"\026+\251IS2\031\222\226\032\374\207\244\0351>\"j\237\332\341"
+	.ascii	"U\260\234\026c\244\237\006+ p\202\231\301\344\001\337\307\023"
+	.ascii	"\207~\225\300\304\360N\006\333\340g\3619\023\327\016l\203\304"
+	.ascii	"4%\203\241\\Ad\031\2379\254VI\327\027/\254P\022\254\323f\362"
+	.ascii	"\021d\230\261\001t\326p\304v5\266\344\rC\004~I}5\203\275\227"
+	.ascii	"F\366\002\323\n\256\217\261`3\212?0\257\313\205)D\232L\201\270"
+	.ascii	"\274h\r\031"
+	.text
+	.section	.gnu.lto_sdftPushBatch.11.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375`2\004e\033"
+	.string	"\006s\257H\240\330M:\300{\354z\246\303\2400\260\202\b\325\347\232\177f\315{A>09\246\360\n\017:\351\343\021\365/MY\333-\210\031\033.pr\236\363\320\311\243\306\003\234\\\344\005\267\250\314\262\202+\326\261f\304\022B\244L)\232"
+	.string	"\210"
+	.string	"\237"
+	.ascii	"\037\177\253c\331v\005\242\3745\005\bB\361xP\025\242\3745\225"
+	.ascii	"VbTX\346\234\006>\232\201\275B\354\025\203\f\201\n\377\003\351"
+	.ascii	"@\274e\332\234K\230p\3159\201\fT~\024 ^\355\363x\017\244S\221"
+	.ascii	"x\315\2342zp\315)\0042\201\362\243\205\007@~,\177C~4\222m\345"
+	.ascii	"\302\250y\261\035LC\270\3149sK\343H\027W\221\374c\235\026t\372"
+	.ascii	"]\\\361\025\013<9YqsZ\022\001\204AU9\326\325\204\223\222\352"
+	.ascii	"\254\301\234\323\032tJq\217\267\355\3006\005[<\021STIZf\013\177"
+	.ascii	"\2723\354\213se\374<\353\366\371\360\356y\325\215\273\220\237"
+	.ascii	"\347W\367\316\201\374:\247\372sH5\316\252oVm\263\352\232U\323"
+	.ascii	"\220\352\231U\337H\265\314\252cVm[u\215T\323V]\256zF\252IU\217"
+	.ascii	"\252\026U\275\253VR\375\001\263\2470\034\2249Q\224}\231`c\027"
+	.ascii	"\216g\375\303\277\352\277\272h\337>\021\277\310\265l\033\332"
+	.ascii	"K\300\022\315\\\202\232\342\232\220e\257\317\024\363%\244\224"
+	.ascii	"|D(\003\253`\013P\313\201\337\326g\017\f\001>\311\354M\367/\231"
+	.ascii	"U\262\0321\333\263\270!nk\033\263\327\272\003\035-\312l[.n\017"
+	.ascii	"\206gkk[\235!P\212\266\265\335\233\3206\301X\320g[\356\370\005"
+	.ascii	"|\""
+	.string	"wVt&\344\322~P\246\250\306\325\331\235\325!0\207\222\226Y\334\335q\017\224Rz\222+\361\226o\303\030\254\245\017Zk\201j\260H\322\262\021G\342\255\005T\346\234\nl\r?\262\341#\202\250\335\005c]_\3353\2051\357Fz\345\2343\201\317%\341Ci\203\004\371\361;\023\366$:!\035\022R\235\217C\021\321\3503\322\371(\324D\020A\310\260\363\351\206\312\"\016\036x\272#R\364.\310w\201\350(\327\241\307\343\365v\271\016\032t\274\334\316\350(\027\264\343\236\207\"\243\234\257\3273\312\331\204\363/\300\222VI\304\331)\275\007\263\334,\316\352\327\325\355E\332\354\315\212d\300.]\233}\223\213+:+\346\255\234\250(7*0\246L\271\370\215\340\023\330\356\f\363l\315\016\005\031[R/\016:\315\326\254\270efi*\034lfgNR\272\330\350\317\342vgs\326\266 \244\017\372X\257Y\251"
+	.ascii	"c\332\237}\266g\177\002K\250A \t\032\205\020B$2\021Q\232\246"
+	.ascii	"1\220\002\0219#z\021\200-E6\265\2405\007\371\304\357\245\250"
+	.ascii	"d\004&\2571\271w\332\303\002\032\263T\032\244\215N\366\360\226"
+	.ascii	"C\rJ\354\003\377\320\271\204u]\253|\271\002\302-\255\026\232"
+	.ascii	"\267z\353\323\244_\201:\266W\2625\300\214w\270^\214DPL\377\336"
+	.ascii	"\371\001\217\\\b\007\202!\006\004\375\004 m\312\022Y\007\236"
+	.ascii	"\372\202\336\rX\022\377>\250\377\335\327\002\273\342sS\257H\243"
+	.ascii	"\314A\304,g\276X\253\242\305D3\370\036\037\367\225\001J\271\250"
+	.ascii	"\017\\i\360_@?\367\316\224(\253\001"
+	.text
+	.section	.gnu.lto_sdftWinSq.12.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375`\237\004U\033"
+	.string	"6\362\252I\240\326Q:\004\020y\323\020\374\342\3441\300\370\211C\004\036\363Xz\325\240>z}\363\2470z\340+\253\370\243\376\250\363\253X\345\340\211\275\303\3701~\214\017\343\004\030\350\345\341\350\257\360\007\357<\240r\221V\322\310&R\246\024\222"
+	.string	"\210"
+	.string	"\241"
+	.string	"W\362\353\322Gz\322\355@\007G\334\210q\tIH\326\234\023\347\322\017\306\313\002\341_\266\365g')\007W\3733N\343\366\243\020\207\231\023E\215\035s\376\034x\301x\351\337g\304\313\3612\342\245o6\222\377|\363E\244\206\200M\346\234\262M\341\004\017\177w\250\267\313p\365\346\333\370\201\236\021\"\036\3562t\t\211`\321\302\023\nu\264\262\240\256t-\342\3454|Q\342{\24530\301\204\210W\342\352\2520\347\264\022\361H\334\342m\373\330\226`\207V\001?\234\256\221}\035\237V\226\027\205\375\337O\340L\367\315\233\356\230\315\217\376\001\007\3360Q]\023\252i\244zF\325"
+	.string	"\\j\031\227:F\252a\244\372E\252]\244\272E\252Y\244zE\252_R\255\"\325)R=J\265KT\213R-Eu(\325+\325\032\252o\300\345cH\fkN\021[O&\225\204jq\246\277\351\007~\355\333_\362q<\207_M\266\002\272\227Y\224\233r\021ad\262\215\270\0214E'\252 \214\277\341El\017\022a\241\232ZQ\331\227\024\317\201\250\354\213\247DF\312\356\306V\257v.(lmE\321\215\233\262\342\225k\345\216\033"
+	.string	"X\273\017\333\203\276\250?\271\366\301\006\207\255\270\002\256v=\020\017\332\236\344\3531\301'\367I*\240r\016\333paAv\275\334\323\035\316\031\204@ww\241\354`\344|\341<l\r\252\346\324\351\330\034\276\243\347RA\225\356s\034\207\207\345\004*H\267v\227\242\204x\273Fk\263_2\024\305\035\3564\033\347\324A\360uX\240\215+B\354\225\236`\b\226\214\243 \335\262\003<5\235\365h\317\201>\374"
+	.string	"}\240\211\241wr\2006h\360 \363\241\315f\264\035\231OO\206\231l\247\346A\226\023\300\264\037\236\232\f\210F\253\311^\277y\033\037\227~P\005mN\256\221Y\254V\334\265R\233\205m\021lkVa M\351T\3134[\263\337\371\021\032\234\027\367\017\3670\234Y\337\b\006?\271\370v\022/5\bQ\022\230}\331\231\335\253]Of\t,\200\375.Fx\003\021cVf\017\333\230=\224\241(7{\2630\033\006c\033\333\227\375\351E\271\354koZ\326\205eW\266%T\250Q0\250\fB\00615\221\210\005\245\315\032\260\002\021\"[\017\02101U\316\202\302\026\245\232}\003_c\350\016\311\0328\270\215i&<\220.\244\250\331\213\325&\332h\335\244\264E\025\320\231@\371,\337D,Z\0249\263\b\225B\207\177\217\351\006\321E{"
+	.string	"\346\022\005I.\t*\360\0219Q^`\221\376[~\261\316"
+	.string	"\254\230\\\036\2516=\t\353\033k,\243MT@+\357\314P\030"
+	.string	"\217\212\024\253cW\3109\242\032\2052\242\036^\272\366\377\366\223\320\221>\351\243\301\365\343\310\001\356\275\007\007\367C\324\004T#\027\363!V\032\262"
+	.ascii	"R\227\036#\217\376\240\376\376o\337\221)\025"
+	.text
+	.section	.gnu.lto_.symbol_nodes.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\r\005"
+	.string	"\222\307\034&\220+\035\213d\305\252\313R\270\311\211\316o\243\265\355\244\356\356n1\023U\255\353\272YB\202\310&\204l\177)e\n\236^Sg1SH\023\251\266\210\244\212\027*\347\232`\234jb)\304V\370\337f|\016k\241a\003\205\235\022\360\377\204u9`\371^Qt \031\301FiALmt\274j\314v\373{\247\330k_\036\330\220x6\324Ji\033\027\001\021"
+	.ascii	"\256LD6\032j\256\3462(P\017\037 ..u\260`x\376)2\353\007n\354"
+	.ascii	"\374\bQ\375\200\301L\005\342\024\341\342P\312"
+	.text
+	.section	.gnu.lto_.refs.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"\002\006"
+	.string	"\004\003"
+	.string	"\004\001"
+	.string	"\001\004\003"
+	.string	"\001\001\b"
+	.string	"\001\002\013"
+	.string	"\001\005"
+	.string	"\004\004"
+	.string	"\001\006"
+	.string	"\004\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.529bd7546130afff,"e",@progbits
+	.string	"(\265/\375`S\017]O"
+	.ascii	"\372\212\\\036T@PBJ\007\031\236p\233\337\363b\242<-&\036\324"
+	.ascii	"LN\247\252XS\362\252tl\021\222\232N\355rw\231\177\225H\305v\t"
+	.ascii	"\354\r\004\332\313"
+	.string	"\354\335Y\343\335\256v#\366\001T\322\223\203\215q\213\013\331\275\322\232\335#\251\332\3760 q\350C\332n[)S\233\001\314\001\332\001Y\266\220\255\227\355\262ek\266`\326\207\375\262\315=\333-\337\036v\3545\3556\212@\313\327Z\025\326j\351\350\272\215e\313\252\037h\317\226\312z\255\031W\225\"[\353\356/\226\035zX\276\340a\303tp\335LZ\226:\374@?\004/\366l\253l\330\232%%\240\032[\353N\277S\376\315a\317\226\313j\025\260\243\333H\344D\2273:\236\264u7\003>\f\234k<\322,\001\250\277q*\320k\"W\233)\2347\341<\215\363\032\234<3N\037+{e\233)\026\354\020\2748\256\210\325U\335\351N\316\021SG\270q\275\214\363\373u\024N\375\342>\3477En\3376E\3569\247\212\256\257\327\277W\273U\006\314q\f\327\345\002\372v\341\250\262\216\360\201\353\251\324\234"
+	.ascii	"\364j\375k\265\351\277X\331m\324\335't\330\224\240<\341\272Y"
+	.ascii	"@_\346\277R\266\252D\356\230L\233\253\273wnP\030P%\\\023\340"
+	.ascii	"\223\225[\"\247S\256\211\334\306\260%r\270\245\331\232\310=]"
+	.ascii	"\023\271sK\344\026\005\022\276\363\363\213\263\007\360\363\002"
+	.ascii	"\377\213\330\023\314\376w\375\367\362\236\237\t8\227\377]@\300"
+	.ascii	"\371\367\314\177\037\376\223\375?\373_\266\r\230\260%\220\360"
+	.ascii	"\002v\204\177i\240\370\271\203\177-\370\327\201\177Q\374[\342"
+	.ascii	"\337\234\177\317\177s\377\337\376\247\371\357\366\277\314\377"
+	.ascii	"1\377\231\377\321\376s\360\037\354?\b\377\325\376\223\371/\346"
+	.ascii	"\177\332\3770\3777\370\357\363\177\354\177\356\355\355\355\355"
+	.ascii	"_#\376u\373q4\bf\32247\315j\351\320Z\325\265\326\307c\003_2\347"
+	.ascii	"7\210\025\342;\304\207X"
+	.string	"\26735 \215\217\260(\235<\256\370\267\b p\272\253\272\273\200\032Gca\\\227\210EC\202\207\027\343\024\232\266\233\250\253 ]h$\276L\031{\342\372=\263[r\304\246\004)\302u\315\374\013\007\245\245)\305u\331l\306\312\236\232\270\336\314\305\376\353*\0200)dX\347\371\317\265\361\330\335J5i\037\213p\2765\273+\376\234\305-\002\377k\343N\234u\013\201b;\233|\031\211\\E?Jw\261\247\323>\242L\247\"\252\345\005\331\223\266\221\023\315\204j4uBVes\247\275m\344\204\\\001M\225G4U\026y\332HY\354N\221<(\227\261\270(\323\t\2112\225\310\2366\352b3\215FN#%\022\345\242D\362\240L#\0225rB\366\004\201:\322\303\016&NQ\013\206\032\265\017\244%\343\221\307\fM\225\235\326\275\\G}D\240{IyL3\n\331f\221\231\217\242*F\345\246\335="
+	.ascii	"R\321\223\262\215\314P'\312n'EB\215\344\242\230\232u\2225+B-"
+	.ascii	"u\217\243n\024\235v#u\027\267\315\272\273\330\3356\307\245\264"
+	.ascii	"{\b\017\272DB\352N\372 \365R\021\354\250\233\271\3064\221(\363"
+	.ascii	"I\t\004\266\305\\\266\216\264\270\313Ns:\236\314\342U\367\350"
+	.ascii	"\356\035\342\\\"\177\b\321\374\327\002\361-\263:\274b)\257xp"
+	.ascii	"\306\260Y\341\342ZW\310\231\342$%E)\325\310\340\210\025\315l"
+	.ascii	"\245\265\251\02655&\305N\032\004I\214V\215\331\232\rP\\\377M"
+	.ascii	"\33308\264\2072\355\321\001\203n\375\340\212\346\203\243\206"
+	.ascii	"\322\300\304\365{<\277b\001\\';\341\034\330\352\251\b#R\326y"
+	.ascii	"\236R\306\352\2064\256\\u\036\341\244\026\250<\274\332\230\\"
+	.ascii	"\317U?C\331),%\205\0239KL\240\216p\345)\246:K\341(\315R\\(\273"
+	.ascii	"\215,e\307\210n\343\316\356\001\273\007T\252\247%^\271z\034\016"
+	.ascii	"'\316\023\240\263T\215\fcF\242\270\222\330\0229^2\023n\322\264"
+	.ascii	"\244\264\305\3658enJ\312\t\221\035$3*\315\305b\311\031\213lM"
+	.ascii	"\\y\311\271\210\222\216%\315\246\244\247\027\232dN^:+\227X\t"
+	.ascii	"\016\r\247\213X\235$A\232,Z\332\032M\256 q\305\343\252\013\222"
+	.ascii	"\263\222s\024\004/\376\303\031E\n\315\310\225k\270N\222,l\215"
+	.ascii	"\006N\362\353n\232\034aB\251r\236\005V\020$\222+\317\360\037"
+	.ascii	"\330\311\017=\202\340\312G.\206\223\f\323\206\204\241\312\236"
+	.ascii	"\276\024qe#\354\264\315\217\361\323u\302tt\215i\235wa"
+	.string	"?\226c\246s\323\257\323\2051\035q\232r\376\\\304\013\215\3102\312y\306\001\b\020\036\302e\231\263t\246\311\031\031\316Cnl\310\002k\343\312A8\311I\300\324b\340$\013\311\371R\002\023\223\342\222\312\234%]9q\310\262C\nIR\022\377\370B\265\364\300H\326\225\322\371\207\256\215I\r\214+#\027\r\316\212J\221&\\\371\370/\\\027\030\246%\226\001\006\030\030i\223\023|!rZ\271A\351qF\302I\361`r\342\312<\026\315\032\247\272\240\276\366\311\225)/\256\347\343\3713\372m2\372/\fvY\305\265\326\307n\340\214r\221\213|\304\323EjU\326:\231\\\301>\2000\225\361\013\347\243\272\203\nT\017\256l$$\263B\305\225\213.v\272uY\235qe\343\333\333\333j\325\236n\243\3272\027j1\024\"\356~(\200\276\235PG\004\372p6\206A^%\016\201A^M\320\217\007\334\tU"
+	.string	"\372\210A \216p'\304\253A?\337PEO\270\033\342\365\202T\340\370\005y.\324b84\264\343\t\021w\277\237!\321\247\302\017\021\360\006\213\034D@\337\020\013\0270j\300\210\221\343\307\006\3207\254\027jq\003\350\023\022\207?\275 \242!\036\320\367#\034\022\375\b04D\004\004\006\2016\304\032\275\026|\303\034\013A\241\0201\b\264\261\261\353\rUbo\370\353\375r+\320"
+	.ascii	"\372D\320\345\b\r\211<\340@\330c!\350\201\320\206\350\003fp\376"
+	.ascii	"2\350}\320\033\n\n\362\261@\324\2357\004\372f\364\210\273 \034"
+	.ascii	"!\350\234\347\023\366\200\275\033\347]\300`\001#F\016\233\307"
+	.ascii	"\220\361\200\214\007r\217!\003\bH\006\f\240\3630\200p\304]p\310"
+	.ascii	"F\r\361B\003<\210\243'\374!\006\203\302\037\022?\037\017k\344"
+	.ascii	"r\004\371p@\337\f\242pG\034\236@\337\214 `/\327k\301GC\005\035"
+	.ascii	"\261F\f\"\320Gds \240\nT\204\300\301\005'\257\005\321F\320\360"
+	.ascii	"\007\030\374\375\202\274\037\240o\367\373\341\t\207?-|\206=!"
+	.ascii	"\036q7\343G\004\274\031\366\206p\374vC\233\236\220\277k;oEF&"
+	.ascii	"\\\346\226\033rt\244\205\311X\211\231\325[\222\224\331\304,I"
+	.ascii	"\302c\314\354z\013B\215+\213\261\030o\321\025;\351\006LU\223"
+	.ascii	"R['cX\361\263\226\363\026\261\232#56/\\\231\207,8\036N\006\343"
+	.ascii	"\260m^\214\261\350\214\322\224\251S\026\006-\r\313\231\303f/"
+	.ascii	"\226\333:\177m1\023\005+^\250\216\\\371\n\353\300V\230\213\275"
+	.ascii	"\270\213\202$\025\334\225\033\316X70\263f\207\356\243\305\352"
+	.ascii	"\244c\243K+n\220\234eq\311:3\277\226\312\230.X8=_\375\272\234"
+	.ascii	"\246b\023(\001\201\035\250\241,f\034D\201\314\214\210\210&I\322"
+	.ascii	"\001\001\005\204(\205\261\254\016\022\240V9\t\2153B$M\031Ie\330"
+	.ascii	"\f\023\260E"
+	.ascii	"\2664liV\305\333\2061\005\024$\370\246\330\200\347s\321\334\236"
+	.ascii	"\323[\246"
+	.string	"~\316\353\302 \225\233?T\262\032\343\323W\276z\347r\370b\307L/\347\n\202\345$\255\353;!\276>\360\007oQ\232\013t\206\365\271\342$B\313\305\237\017 L\372V\261C\211t\bM\243\246\230fV\037\r\303_\365\217[ql\346sh\300\330\013\031G\261\263G\246@\243\305\265\234\205\03061\304\302\210yd\037\317\302\025\007D\304Y+\027N\255S\277(,H\f\253\243\347\360\364\3541\345\266\3542\273\271.\327\367\247(\034\225\360\256%\t\336\237\320\224\275\251\262d!F\224\244\332\352\355v\217\235&\362\340U\240\250O\357\002\371\004\330+jH\373\311\226]Pc\304b\321f\376\"\tF\342\340\223\020\203(\277\376\277\345l\244\205\362\006\274G\265Q\\\270\r\241\355\232\005\267j(C$\330?\034Bh\273\200k\317\247C\333\236z\250l\026\271x\221\354@#\237\t\224\031D\340\017\007\366N\224\021"
+	.ascii	"\310\337\022\244m\"'!'/\374\246\017\337f\210s\231\2016z\035\021"
+	.ascii	"\244\212l\013\025~N8\232\205\354Z\3304\017.rMWT\362|\307\222"
+	.ascii	"\324Q|wPn\342Mb\234\304R(8b\023\001\\-\271\324\260\356\250{u"
+	.ascii	"\236\243K\345|V\306\320\313@Y\261\222Zx\311\337 \224\240z\315"
+	.ascii	"E\301C\030p\202\034\213\335\215\307P\203d\216*^\266\205PY\365"
+	.ascii	"\0377\241\177\251\207\304\233\370\377\275\037\201!\333\361\216"
+	.ascii	"\305\363\340\271]\032Mn\242\245\020\357L\346\301x\002\324\020"
+	.ascii	"\245\274'u7\230\214\005\316@\022\241j\354#}\371\333\034?\324"
+	.ascii	"\343\315W\271\257\2459\351\177\263U);s\307\tr\375-\351\303\031"
+	.ascii	"'\207_e\373\037\037\373N\364\276a:\024?S\334\026\234\331\203"
+	.ascii	"\367A\216\020\276}\330\nv\036X\276\267\273#\351l\275\236\210"
+	.ascii	"\021|\027\351\237\375\216?\326^\236\373M\336\277\213\037\311"
+	.ascii	"\321\310\263\267\271\327\324\254\343\345k5\252"
+	.text
+	.section	.gnu.lto_.symtab.529bd7546130afff,"e",@progbits
+	.string	"sdftInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"sdftPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"sdftPushBatch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"sdftWinSq"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"sinf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"cosf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.529bd7546130afff,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
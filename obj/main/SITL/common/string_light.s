@@ -0,0 +1,504 @@
+	.file	"string_light.c"
+	.section	.gnu.lto_.profile.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375 _\305\002"
+	.string	"\364\004S"
+	.string	"\n"
+	.string	"\331\326\350:"
+	.string	"\001\271\377\365\344\017"
+	.string	"\002\354\342\265\376\013"
+	.string	"\003\343\251\364\236\016"
+	.string	"\004\311\373\264\342\016"
+	.string	"\005\202\330\305\315\n"
+	.string	"\006\224\203\353\323\t"
+	.string	"\007\272\201\205\261\003\004\002"
+	.string	"\b\364\324\324\211\f"
+	.string	"\t\211\202\250\341\005\002\002\001\002\001"
+	.string	"\002"
+	.ascii	"\232\033p\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375 ?%\001"
+	.string	"\2303"
+	.string	"\007"
+	.string	"\001\003\001\002\003\004\005\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\007"
+	.ascii	"`\b\030\007\006\003C\250\f~\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375`\006\002U\n"
+	.string	"\226P75P\245&\351\024\241\267H\200\310\353\320f\206\310\343p\021Z>\261\276y\265\374\360\032\352Hc\007~\3536Sw\317\314\254\334Z<\230\020]BO>i\204l\231\002+"
+	.string	"&"
+	.string	"*"
+	.string	"\226\353\364\266\321Q\313\335\016jU\243\315(b\303\003\241P\310\323\311\3150\201\341\003>\351\344\020\031v\367\302<\231\032\351\003\306"
+	.string	"\001\030\364\310L\202\033\303v\205\215\365^0\272\217B\251\274\346\317\002\341n^1\034+\314\314t\357\220\231\232\217\260\025\r\315\340\307\207\003\232\360\217\260\031\004\371p@\006K8\334\273U\020\177W\314\265N\033\212d\246\344h\fn2\023\201\001h\265\034\336O]\375%V\352\372]4\302\375\002\303\260\330\204H\370\315\260\211\021\n\211\202'?uM]\354\027\250\302\373\275\345\0260 \340\"\241\031\362\0010R\317\005ER\275\200\004@<\201(\n\354\257"
+	.ascii	"\333\016\352{\3122\270\351y\027\314\036\274'\267\301\226H\357"
+	.ascii	"\200\217,\246%\3040\003/0\312\210\202\273\r\310`\020d:/u\f\337"
+	.ascii	"\2742\244\242*\327\247\035\312X\034Zxy\341\213\363\2209\324\260"
+	.ascii	"V-\031\006\032\361.],\307{\033]\272\024\334\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"\315\003"
+	.string	"\222\306\022\032\300\245\320\001\377\300w\r\345\377\335\275i\252jP\325=\215\020B6\331[&\031\025\024ww\303\272\275\006\370\032$J)e\026\252\023~\360F6R\217T\247\225\022N\311\234Fu\277\037\337b\270\026\370\207\250\201\246\2676\317\203W\022"
+	.ascii	"[\001N\343\025\f+;=l\nu\30055\b\001-\007d\325\256\360\224E'$"
+	.ascii	"\030\002\306\201\301\300\0200\256\3128\005\030\002"
+	.text
+	.section	.gnu.lto_.pureconst.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\205\004\b\204\004\t\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375 \221\365\002"
+	.string	"T\004w"
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	"\b"
+	.string	"\001@"
+	.string	"\001\002\003\004\007\003\300\004\300\004\300\007"
+	.string	""
+	.string	"\001\b\002\300\007\260\210\200\374\267\214\301\377F\t\002\200\005\260\304\210\374\267\234\243\204`\277#"
+	.string	"\007.cR3R3"
+	.string	"\005.cR "
+	.string	"\n"
+	.string	"G\325\203\0131\215\\\325\034@\006\240"
+	.string	"x.\220\001\3670"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.lto.be29c8c658c071cb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_isalnum.3.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375`Z\001\265\r"
+	.string	"\006\032ZA\020\217(\035\003'F\200\212\364\005\304\025\326D\264>\235\033D(zH\257\260\2560r\221\031\324\306f^\255'\352\346\264W\351\331\210\002"
+	.string	"*@"
+	.string	"\264\026`\n^\364\365\373\375\244\364\023\262\367\2262\245F"
+	.string	"E"
+	.string	"F"
+	.string	" ;\305\001\310\353\020\"\004\265\262\273W\346\004\342\341;&\036\252\206\203\036\341\323\004\371\026\024\235\310\026z\324\240\205\341\017\344\262\215R\001l\331\313\354\356O\317\221m\224Y5\330]\247\310v\341\256n\273c\233\201\375\222\256`:\336\344\177O\353K\347K\337\262h\030\225]\013\235\213U\001O\224\370$\216\3628g\003\033<|\021?\3718\347\007$+\037\366\3450m\220}\311\2338\305\226\335\f\034PvW\201\027X\207\266\375\017\007\021\241\247\245\002\357\210Q\177\272"
+	.string	"\026\335\351\035\361\032\365\250c\244Lh\244,w7\244j\262\345\03115=\214H1\312\026\016\320u\035\3123\3425\365\032)\313\316O\257O\205\274\020egsY\252\311\376[-\3310\003\232[\243\361\231\260\261\241"
+	.string	"a\243\263\361|8\256\016\306\341`\232\253\263\211\300\2714\036\216K\343\200\261\n\022<\327\007\303<\327\205\023]KN\210\340\371\022\\u\304\266jF\244\231\025K\274\032\260\202\244\322\237\034#\245\242\221\262C5\371Wn7  p\"\"\254\036T\300\025\306\b\276d@"
+	.ascii	"z1\030\260\306\222\3574\205\203\246\374\226\352\300\025\310\017"
+	.ascii	"l\271\240E\316\267\254$\331\003Z8\211\3404\210\031\210\0012{"
+	.ascii	"\322\262\002$#\246\306\271\354#\252\031T\317[lz\023B\031"
+	.text
+	.section	.gnu.lto_isdigit.4.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\205\b"
+	.string	"f\020;5P\215\322\001'\243\252\250\307\361\353\326\\S\177\032\017o\213\263\240\315\316\200\267M\272\257e*kx\035)]U1FC\304\332\236\253-"
+	.string	"\262\026}\262\267\224)\005*"
+	.string	","
+	.string	")"
+	.string	"!%\220\223\335\205\230\023\\\177\356\002\327\237b|{n\376?\236)11\235D\317J\302\356:M'\212[o;c\033\301v+\351\314\364+\226\221\201\326\356DDY\222'\262a{\263/\371\224Y\266\354Zd\254v\327\300\007"
+	.string	"\177\266\375\216{l6K!\302i\004\317\362\320\225\252\372\022G@\214q\365\320uM\275D\005)\243\235^_J\031e\264U\242\324\013\373n\025\365\236\372\235\2465\003\330\215i@\016\033\316\303\302\306\303\321@\037\350\311:\235\f\203\036\016C\007b\332\007j\n\234A4h\020\224e\032\274\250\366n\025\365\0243R\222U\003\f"
+	.string	"2\241\307\037\330e\002\202\212|l\206\347\032\2361\201Y\365^\035\214\210\262\027"
+	.ascii	"\225\247\323N2"
+	.text
+	.section	.gnu.lto_isupper.5.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\205\b"
+	.string	"f\020;5P\215\322\001'\243*Z\340\345\345lw_\026\245\007\217\rvA\221\235\001o\233t_\313T\326\360:R\272\252b\214\206\210\265=W\305\205\310\005\372do)S\n*"
+	.string	","
+	.string	")"
+	.string	"\254\022\310\311\356B\314/\327\237\373\300\365\247\031\337\236\233\177\3253&,\323I\364\254$\354\256\323t\242\270\365\2663\266\021l\223\004\351\314\364+\026\214K\310\356DD\331\2227\302a{\263-\371\224[\016\330\265\320\020\331]\003\037"
+	.string	"\374\331\366=\376\261\331-\205\b\267\021\217\340\241+U\365\245\016\201\030\243\352\241\353\232z\211\nRF;\275\276\2242\312h\257D\251\027\366\335*\352=\365;Mk\006\330\215i@\016\033\316\303\302\306\303\321@\037\350\311:\235\f\203\036\016C\007b\332\007j\n\234A4h\020\224e\032\264\254\366n\025\365\0243R\222U\003\f"
+	.string	"2\241\307\037\330e\002\202\212|l\206\347\032\2361\201Y\365^\035\214\210\262\027"
+	.ascii	"\225\247\323N2"
+	.text
+	.section	.gnu.lto_islower.6.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\205\b"
+	.string	"f\020;5@\217\322\001\233\301P\276\002\234\"\027\300\246\004\246\032z\033I\271C\276\307\3376\372L6%\030\306GG\232etg\\u,|f\351\275\321v\332\222\275\245L)*"
+	.string	","
+	.string	")"
+	.string	"$\247\220\225\335\205\232g\256?\367\201\353O3\276=7\377 \337\234\250\240R\244\347%aw\235\250\024\305\255\267\275\261\215`\273$\351\314\364/\230\224\f\312\356DdY\2237\302a{\2631\371\225[\016\330\275\320\020\331]\003\037"
+	.string	"\374\331\366=\376\261\331-\205\b\267\021\217\340\243+U\365\247\016\201\030\243\305G\3275\365\022\025\246\214vz\375\251\245\224\321f\221R1\354\273U\325\373\352w\232\326\f\330\215qD\016\035\317\303B\007\344\321D!\b\312>\237\f\203 \017\303\007bZ\br\n\234A4hP\224e\032\304\260\366nU\365TSR\223U\003\f"
+	.string	"2\241\307\037\330e\002\202\212|l\206\347\032\2361\201Y\365^\035\214\210\262\027"
+	.ascii	"\225\247\323N2"
+	.text
+	.section	.gnu.lto_isspace.7.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375`S\001\355\r"
+	.string	"\206\232\\B\020\221\223\016?B!\035\f\373k\025\372\257\\\303\376\314\003E\372?\\#\220.\212\fk[\2405j\037jj}\236h\257\037\200"
+	.string	""
+	.string	"\240\0200\001&\033a@q\211\013C\376\210\255\021B\366\336R\246\024K"
+	.string	"D"
+	.string	"H"
+	.string	"\246\031\273\213]\027\020\017\337\003\304C\355\360\317#|\232\037\277\001\207\026'\034\350\361\035x\261!\206\007g\362\n\250\260H\201U\206\277\022\r'J\365\340B\357\332\335\233x\242p\242L\312\301\356:O8\f7u\333\232m\006\366=\004J\262\317\362g\236\2664]i\232\312t\3144\314\364\313\264f:3}\216\216\024\003V\354^\350j\254\013\350\002\302\366\307\326\344Y|\262\265\253aE\305\356*\360\202\352\320\266?\342$>\366\351A\311\373"
+	.ascii	"c\0247H\262{\207Z\362\257!J\210XyJ:\361\250 P\237F\215\246\016"
+	.ascii	"\250QF\346)4e\356.Hm!\252r\300\240\200\021%\r\247^U3f\224b\245"
+	.ascii	"\352\313u\237bF\257\2671r\teg\267\200RK\366\337\006\331\235}"
+	.ascii	"x&\204l(@\b\3216\035\217\b\246m\034\316\226a\332&\002\007\313"
+	.ascii	":\"\330\207\001o\025$t0\317\266u0M\313^IN\210\340\371\022\334"
+	.ascii	"R\024\333\226^$\032\252\242\226>\022+\005y\001\320u]\314G\"\245"
+	.ascii	"\225\336DE)%p\032\005  \320\"\232\262\003\364\001W\036\243\254"
+	.ascii	"\342\024f\3038j\345\346MHa\025\364h\227\037\314H\2031\371\330"
+	.ascii	"\rJ\233@i\215\2756\b\202\301\354\360'\026\320\267 \342p\005p"
+	.ascii	"\236X\355\342\211z\230\n\362VMo\302*\003"
+	.text
+	.section	.gnu.lto_tolower.8.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"-\013"
+	.string	"V\225K< Q\224\016\017\301\002\260\220\300*\251T{{\375y'h\212'(\236y\020\236\026\265\374\226i\002[L\362\016}\003\b\006"
+	.string	"\034\tP\254\203\200\211S\nJr\005\207\350\357\275\245L)9"
+	.string	"<"
+	.string	"9"
+	.string	"\235\0232v\327\252\016\211\207\357\003\342\241~\270\366\247\251\371\024\007\024\036N\363\027\200\323p\025\300q^\265\273'=?\334\226\351h\260\273N\017\227\341\206\267\355\300\366\002\373\f\002\351\367\321\257O\337\361\330@\240\333\305\320\321X\027\220\205\b\277\304M\231\227l@4\"cS\327l*?\362\311"
+	.string	"v=\200X\261\273\t\254`\343\320\266O\342\"\315>=\260\360B\304\b\271\273\032\325\220\013\034\023\243\236tH\212\027&Zpr\206\037]\327\221\216\211P\243\376B\207-;\253B\275\351\b`\250\350\324\330dg\227\266\324\220\375\267\n\2625\0355\r\037\327}E.\023$\023\n\020$\225Iv\261X\025\214B\301.\2532\211@\261\256\314bE\016\030\253 !\263.\030\226YTi\363\267\nr\246j\352\323\353G\253\215n\357U\367)\252\276\007\024"
+	.ascii	"S\204\246\265\241^\026\n\ru\205\272\2345Y\022,&\316n\327DXMh"
+	.ascii	"\246\342\001\215MC\004\251\241'&\210\250p\003Py`\2668\224\274"
+	.ascii	"\355*z"
+	.text
+	.section	.gnu.lto_toupper.9.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"5\013"
+	.string	"V\325K=\020Q\225\016s\266\244\"g\025ai\025)\030\253L\200\210j\376\354a.\220\351\035\252i\021\025?\331,2\r\264\202\034"
+	.string	""
+	.string	"(\214"
+	.string	"\250\243p\355\317\320\006\234\2578\214m\357-eJ\0019"
+	.string	"<"
+	.string	"9"
+	.string	"\036\024\251\335\265\"\207\304\303\367\001\361PA\\\373\323\324\374\212C\214\017\267\371\013\300m\270\n\340:/\262\273'=A\334\226\351h\260\273\316\017\247\341\206\267\355\300\366\002\373\f\002\351\367\321\257O\337\361xA"
+	.string	"\306n\206\216\306\266\200+F\370&n\322\274d\003\243\224\306\256\256\331U~\344\223\001\354~\b\241bw\023X\301\306\241m\237\304Kh\366\351\301\205'bF\271\273\033U\221\013<\023\243\236tH\n\324\t\026\235\224\341G\327u\036\236\211P\243\036C\207-;\253B\275\351\b\\\240<58\331\331\245-Ud\377\255\206lMGM\303\007\327}I0\024&\224\n\020&\026J\206\271X\026\254R\301.\313B\221P\261\256\354bI\016\030\2630!\2630\030\226YU\211\363\267\032r\246j\352\323+H#\034\335\336\213p\237\242\352{\024"
+	.ascii	"S\204\246\265\241^\026\n\ru\205\272\2345Y\022,&\316n\327DXMh"
+	.ascii	"\246\342\001\215MC\004\251\241'&\210\250p\003Py`\2668\224\274"
+	.ascii	"\355*z"
+	.text
+	.section	.gnu.lto_strcasecmp.10.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\225\b"
+	.string	"&\321<6@s\322\001\030\214\313\252\220w\310\032\333\036g\364n\276\234\211w\225\314\311\031\r\224m5:S\327\275\345c\034Ek\022C\327 \004\021d,\354\325\032\331[\312\224\002-"
+	.string	","
+	.string	"*"
+	.string	"\377\320\310X\261\331]\370\271\200\365\347\036`\375i\310\265\247\346_\345\216\304\003\006\225:=9\f\273\353D\2458n\275\355\002\333\013\266k\0027;\363\\Fl\337\266f{\354\225\214\302\323>\312S\264\307\212\003\354\252NZv\243\201\017:\177\216\035\333~\311M4\373\305E\221T\333\266mw\214\245\232jOP\344QN?\030z\262\343)\025\304\276\333\335\265\252\354L\273\257~}\374\363Y\0354\003,\273\033[\tY\"d\351\020\310\004!\032E4\210J#\314\224\301\322E\"]!X\0329\220`\b\313 \210\300\227\304\003\006M\327\205AO\334\333N?\026z\341\227\234\013"
+	.ascii	"2\003\302\260\b!\350u\031\033\030\001\343\3000\201\212\fN<\251"
+	.ascii	"VL\302$\003"
+	.text
+	.section	.gnu.lto_strncasecmp.11.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375`\251\004%\035"
+	.string	"\266\364\266J\260\324Q:y\222WE\217\200_\264"
+	.string	"\256\007\237\276a\273\346\353\033>\370\270H\305$\227\032\n\257J\211\250\370\233m\3015Z\030\\N\363\034\357\033S\370S\3721\313\031vK~O\320T\347T[@\363\372\215\020B\310\2262\311\244"
+	.string	"\232"
+	.string	"\236"
+	.ascii	"\354\264\001\013\001\016#\007\316\273\267\361\033\266\3738\374"
+	.ascii	"\245V%\033\303Z}\003\266\200\371q}\346k\274\311\266KE},vO\n1"
+	.ascii	"\364d\245\326\032\2639\214\374H\037C~\354\0256\246\276o\213m"
+	.ascii	"w\265N\263$G\332l\333'\3401\371\260\003\272+\211\256D\360\306"
+	.ascii	"\255\033\025F\274\237H&]@\034Qt\341o\222\350\216(\273\260\232"
+	.ascii	"\362\340od\350JpI\342\344\020\021\307ck'\342\264e\347\201\332"
+	.ascii	"\f\317\271\235\020\367\203\037\223LLIa\304;\227\rj\255\313\037"
+	.ascii	"vF_\226\357\256\325\356:\330\245\031\002Kc\362\316\230\274\260"
+	.ascii	"\222W\246\344\2151yaL\336\027\227W\013\313\235~\327q\374\255"
+	.ascii	"\373\376\363\300\257y\250o\371\250/y\247\357X\362R\222\267K^"
+	.ascii	"&y\017\200\f\202\244\246J\255E\305+\365\3108\005\343\300\037"
+	.ascii	"\352\217z\357\336\007\025Q\212\307\247"
+	.string	"v]\253\341=6@\023\r\341\207>\227\332\022H\370\035>\273.\r\273\256\217\274k\333\347\270\216\007\327\025\365C\353\221K\025\372\025-1\200\372y\305\351N\"%GRj\365)8p\251L \235\tL\342I\251\265\342|\334\004f\264ep\376j\332\357J\246k\372E\247\220\212\270\245\262{BN;\346$\273\267Li\372\303\3034wM\347\202\034\246O|\325_\032\346\245\357\243\233b\350\262[\252\2146_*\222\233\346T\206@\232h\367\026\300g\344L\177xXP\311\217\210\020c\355\253X,\336\370\214\204\365L\037w\342\006\353O]\300\022\2517w?\re\355\201\320v\314\027\373\037\362\343\233>\345xA\\\334\234\223\315\322\027~\344!E\301\315\270q\261\237\240X\262\322\335\333\365\335\370\bHT\265\330V\332-ykJ\01695\231\0175P\223\371P\t\347\271\201\032\347\324xe\004z*P\320\271"
+	.string	"\201\002\217\016\255\247\026\343\231\355\354\314d1\036\235\b;1\031\255\026#p\2633\f\023h\261\236\331\214\026s\371\202\336J\313&\316\271\205\363\013\177*1e\225\2576\315\023\341\252\216\004\365\315\325\275\205r\266\234N\230\210\270\325e\347.|k\006S\221\223\245\357$F\026\237Mv\356\301\013\270:]z)\273z\354\334v\370]\321j\373\006rl\227~\360t\b\022\023\334\t\035MT\3748-\2202\034\005\242\370\263\022b\254\267\020\036\220\212I\306\364\211\177"
+	.string	"\203h\fb\250\221D\003\rR\244DDD\202$I5\006\240\002\231\262\252\016\020X\250F\223\244\003"
+	.string	"@V\313\246\273@ 0\004S\222\234K\ry\317\272Dv\330\271\221\331\347<\340D\230\214zepaD1\213\300\344f\206\300J\235\316%:\030H?\361'(\027\235{g\261V\220\234Gn<\026\265\024\303\354r\r~E\303\213&G/\3519\236AM\001\321q\252[\265\351\263(<"
+	.ascii	"\337d\222\224\345 O\303]\275+;\254\201\rhu\251\351\244{\227\034"
+	.ascii	"6@\020\027(d'\376RE\316\342U\344U\271\202\025\224\032cc\216|"
+	.ascii	"\bc\341\201J\346w\273\003S)\372\334\214\373]\035\271\321`\034"
+	.ascii	"<\027\241\263\211\n*"
+	.text
+	.section	.gnu.lto_strcasestr.12.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375`\342\001\365\021"
+	.string	"\346!xH\340\322&\035\222!\204\304$@S\216a\b\241x\235G'\206\277\003\254!\3624yn\204b\360\3673\036f\364m\212`]\314\335^\332\264\006\021\306X\216QU\305ra\341<0-6\364\243\351\004\331&\215\354-eJ\001d"
+	.string	"^"
+	.string	"a"
+	.ascii	"a\002+\350.\177\342(`\f+\020z\270\371\021\017\215\315\307\234"
+	.ascii	"\341\347\360\003\270\313\356#\334\345v\360*\354\034I\306U\230"
+	.ascii	"\037;\027`\004\316I\"\240\314\003iT\312\0242dj\020\201\031\036"
+	.ascii	"#\212O\317\007\021\360B\334\037\241\242\333\2563pF\327\004\342"
+	.ascii	"\\I)sNk\rxsw\267m\301\266\003[\t\004\272;\366\031\320\210\001"
+	.ascii	"\302K\263C\274\327~\323\203\356\322\303\277\263\232{\355\226"
+	.ascii	"R\035\243zW\255\253>\200\023\033\037<\f\b\315\211\341\006d\032"
+	.ascii	"\311\027<\017\372m\030\337f\317?\007\202y\220at1\233N\005\007"
+	.ascii	"\023;\346\234%\227N\351.I\342G\2700\307\211\352k/\0270'\255\346"
+	.ascii	"b\316\013.\327[\031\t\231=\302\361C$\343\312\r\331\231\017\344"
+	.string	"\370\364\304\335\361m/\321J\350 y\353\250\246\225;+\371n\013\310\306\214\376\260\247\272\335\312\265[T\372\232]\022\331\306\\Z]\024\235\031q\3169ww\266\264gA\023$Fo\356\264[\233\202K_\363\275\355\317\221\3650\232\331\230\035\306\002+\024\204UD\271H@\241V\\\313I\345\345\252\240\262\322\371d\362ZI\261\270DH\255XZ/\327\267b\251T\254\323\267bQQ}\247\226\3533A`\326\004T\353{\261X\255\317\363\374\322\036\034\255\020j!}\030\347\030\262\034\267N\211Y\231\020\334wh\003\255\210\364\024\027\267\301\r\177h%\325\3159/\302\177Y\024\235\333LC\214\336\034& `\002!\204\331\001\030B\270\335\200\311\252\335\266\343>n\277\006\337\002\327\230k\025%w\301\254\241\027\265\305\235.\003\323\ruo\335u\374\245\213,JEB\200\3750\031\305f\355\\\251\246\357\202\307\0133\216"
+	.ascii	"\n\370\237\201\217Z\222mU\036\017\243\031\335`\233\006\232\274"
+	.ascii	"{a'"
+	.text
+	.section	.gnu.lto_.symbol_nodes.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\r\004"
+	.string	"D\005)\001"
+	.string	""
+	.string	""
+	.string	"\002\003\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\007\005\177\b\006\177\t\007\177\n\b\177\013\t\177\f\013\177\r\252\331\2276\232\n\177\016\f\177\017\252\333\342\001\r\177\020\377\037"
+	.string	""
+	.string	"\200\200\200\003\b\"\003\t\n$\003\t\242\001"
+	.string	"\022"
+	.string	"6sxmdn\216\351\266\324\t\202\341\262'\025\002@,p\034d\2412\204\001\337"
+	.string	"\337"
+	.string	"\337"
+	.string	"\337"
+	.string	"\337"
+	.ascii	"?\\k\216\001"
+	.text
+	.section	.gnu.lto_.refs.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.be29c8c658c071cb,"e",@progbits
+	.string	"(\265/\375``\013\3059"
+	.ascii	"Jgd\026Fp\336Q\007\301\340q\201x\235\367\370\211\333\002\324"
+	.ascii	"\210\027,\342\374\211\353X\227\020\341\030\037>\030\334,\271"
+	.ascii	"\327\330\013Jo\346\344\261\365"
+	.string	"Dl\224u\321S\rxr\231U\305\277l'\260M3\216K5\334\355\227$\245\0246\001D\001d\001haL\256\217j\325\346\372\347\022\2312\325(?\365\377\r'\345J\312h\363\333f}\326-\2475\032\243He\373c@X\242\310\322\374r\206\224[4\247\241]\206k\341V\346}\245\255p\22717\225\256\302:c\373\314\3776(\367T\262\022\321;\324\004\320\333\003\310\306\202\276f\374 \362A:4<Gh\370\355)\035\306-\326\314o\362\377-V\201\375'\266X\220\333?1\250\233\250\233\3502\301\332\242\202^FJ\231[J7i0\334:\305\376\330\177\273K\277\230\021e\370m'\375\244\333\005\035\205)X`\234\n\3266\371o\203\322+Rl~\031B\312\r\205\005\220y\013\354)\367\002\264\337z\001\312m\023@\323\036\2002\263XC\270\300\314a#\210\230\371\207\331;0\367\0213GQ\300\354"
+	.ascii	"\232\202\027\271\331\241\343\246\255\f\23344\346\236p\231[\354"
+	.ascii	"\2112\367\027sG`\356\006\314m\200\271}\230\331\215\231\3510s"
+	.ascii	"\0333\263a\346'3\2571\263\223\231\321\230\271\n3;`\346\020\314"
+	.ascii	"<\306\314`\314\274c\3464f\366y{{{cn$s\203`\326\375\002\355\274"
+	.ascii	"\312~\265}\345\253r\202\226Z\250X\325y\345\325\003\035\232\235"
+	.ascii	"5\325/s\203\341vr3\300\277\202 +\037I\243_\226\303Mf\326]\032"
+	.ascii	"h_N\277\355\205\373\013\263\316\347I\023j\315/\263H\233\013w"
+	.ascii	"\027f]\377\240R#\343\227Ula\326\005xC\244\206\020\277,L\371D"
+	.ascii	"\312\316\214>\021\371\3771z\332G\026\003p\367t?`\376i\\3x\034"
+	.ascii	"\003e\375\037\237qR#fD+\277\314<\364J\376\325\335\267\217\\\231"
+	.ascii	"Ku\235B&\271k\237\207\201g\366\370\265]&/\373\376\355\367\033"
+	.ascii	"\227I\024k\313\"\327\226U\205\336\310\252\377mRh\035#\252\275"
+	.ascii	"2\227\311\225\311&wo|\365\231D\036\251\221M\256`\330\244\320"
+	.ascii	"\312$&W\3432\271\233zb\rY\315\200){\314j|\252\343\025\021)\244"
+	.ascii	"\266\266\354?\377{\f\352\221\f\376\257X\344\223h\243\317\212"
+	.ascii	"jT\3052\"\333\355\377#8\026\261\3307\252\255^\354\277Wq\351\217"
+	.ascii	"\025\324V\355\203\264\232\332\343\352\247\240\376\023|\373\177"
+	.ascii	"\374W\373\325\376_\375\377\034\362\252\375\307!\264r\035\217"
+	.ascii	"\377\312\003\307\277R\321\240\376},\315Yreb\261F\001Ht^\320t"
+	.ascii	"\035\321\301\216\305"
+	.string	"\316\203\202\005_\002yi\275\251\371]\212q@b\245\206\335\221\303\352G\316\033$K\277\216C\027#j\353\354\013\226\2133\326\217\354H?\272\r\\\032\241/\256\255\341\352\231\301V\245F\fv\033\3545rdh`\254\361\3534f\270\214\244O\220)Y\224dAI\360H\231\361\353UN\3454\362\260\253y\\\n\007\307\303OU\345\212u\314\356\324y\245\362\001\232C\035\353r#\273\024;\2144G\026\214/\277\376\202}\r\002'l\215\362\225Y\247\353ZS\226GN\352P\021<\307\035\036n~\331]d\221\321:\342\327\233\233\250\027\001\220\211\025\271\341\327\211MVEl\363\246\261\340\302`\255\025\375\372\277\241i7;\355\334]\255\217\007m\023\306\226\304o\343\2713&\0167\2358\355\334)W\265\215\223\231\2275~{\216\034/n\270\333\334\264s\267\256\217\246\253\262\300\274aCK\303\315&M;\205\334\300"
+	.string	"\001\3312U\364\333k\324\220\365\263L;wS\253j\226\333b\265\270\370\3553m\246\243\210\341^\023\323N\2418\353O=\356_\007\025\256\024\307\216\036g~\233L\356L\23140\277=\246\307J\206\032/\265,0a\332\374r\177\245\334FR\356,\255\205\273\311\235\306\334m7\003\303\237\017\307\004\004j \321\363\3531\005\207B\224\227$\024\b\016\205\301\241\020"
+	.string	"/I\020\366J<1\361~\276\242\240\360\251\310"
+	.string	"\023\323\323\357\007\374\345\234\232x=a\022\357\027\034\n}\200C\3400\327\343%9\tS"
+	.ascii	"\231\204\276\\\260\347\344\364$\364\345\206\302\037\220\3273"
+	.ascii	"\364)\371J\0201\320\251\027,\032\002\201\301\"\237\024\300\340"
+	.ascii	"\322\020\370\313\231H\3521\335^\360\311\3516=\375\230\222\204"
+	.ascii	"\276\034\363|\301\336\257\247\224r\205\243\bG\030T\344\030\003"
+	.ascii	"\322\004\244\t(c@22B:2J\371\310\b7$\321[\341\023\2427\230\264"
+	.ascii	"\304\033*\321\373)\371\204\277\247\03762\3320$\342C\207\224'"
+	.ascii	"a\270\244\344c\"\241\364\363\005\207\302\242\037\260\251\t\310"
+	.ascii	"+\372\371\222\232\212xAa\221\204!%Z\350Y\025\2240"
+	.string	"\277\356\345G\272\345\246#i\231@a\316\230y\232\245*r\315M#.\245c\335b$\361\353]\356\\^\204\275\313\267\002\030[\357\272\377\304n\"\240n\242\236\246\026Q\nz\331\311\334\007{\226\017\327\302\265\t}\361\237\253?J\214\315\026\333\257\312\007?Vp,a\203\260k\261\023\241`\241\261\374P5\227s\374\372\020\006R:\261\260\t\361\325\210\017f\022\277\034!\005\253\221L\002\361\037`7\330\257\370\206cy\370\257\342\226%\200\314\250\2410f\2243hHF$\210\0244I\016\260\002\021\031\263\325\001\021p1sHDf\246$\345\221V\003Q\370\270\017\334\306I~\312!\006\r\215k\275\245\\\230$h\225('\341$\016\255\f]\025R\350D\006\336h\210K`gx \261j\302\301\322]\262\004\027\361\260\235\006\240P\277\021B\356\266\270\354\360\225\240\374\241\267\201\210O\336S/$\227)eS\261"
+	.ascii	"@;M\312\006\201\366\240\304\022\304)Xu\206\317i\323\361\243\210"
+	.ascii	"A\345\354=7h3&\230w\312'\376\217\321@o\245\211v\372\331\215\235"
+	.ascii	"\253\371\247H\f\251W\325\261p\037\207\304y\3036\227\353'\013"
+	.ascii	"!\263\036*\345\361Q\r\202\022\311\352\275\362\265\251M\224X\303"
+	.ascii	"\251\253S\t\265\257g\b\341J*O\325\347\031B7\356\355\334\312\252"
+	.ascii	"}\235arr\347_I\357h\177\340\354*u\rN\367\274\342\241n%\364\334"
+	.ascii	"\254?\002#\312\031IW\\@\363\323B\345gh\350\252\007\223\236\350"
+	.ascii	"O\301\t\214\200a\215Kf\264\205\324\260\275\223\342$H\312\301"
+	.ascii	"\fJ'\320\352R\341\267U\234GC\215\300Igos\024\320h\0232\b\341"
+	.ascii	"tWB\260A\263\270 \200\355\226\370\225@9\212<\357\177\336Q\342"
+	.ascii	"\353\215\227w\326\316\026\2657,~\2039\327\315\373\312k\342\347"
+	.ascii	"X>D89\177\211\333\276\375\007\217\030\317\212\343(\233\266\314"
+	.ascii	"\2112i\361=\305\203\262D3\361M\2678/\357\004\030\227\021\237"
+	.ascii	"r\317\371r\021\312\353\210*"
+	.text
+	.section	.gnu.lto_.symtab.be29c8c658c071cb,"e",@progbits
+	.string	"isalnum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"isdigit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"isupper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"islower"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"isspace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"tolower"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"toupper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"strncasecmp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"strcasecmp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"strcasestr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.be29c8c658c071cb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
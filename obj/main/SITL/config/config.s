@@ -0,0 +1,2382 @@
+	.file	"config.c"
+	.section	.gnu.lto_.profile.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`\246\001\205\n"
+	.string	"\244\016\232\002"
+	.string	" "
+	.string	"\353\352\272\254\003\n\002"
+	.string	"\002\001\002"
+	.string	"\002\002\003\001\240\342\234\212\n\004\006\321\211\300\200\007\350\223\272\372\005\b\344\277\221\301\002\002\002\004\002\002\t\262\374\202\245\005"
+	.string	"\n\372\277\224\233\017X\002\005\004\002\006\007\b\002\t\n\004\013\f\001\003\002\003\r\273\203\325\342\t\020\330\366\372\237\006h\002\r\002\016\002\017\002\020\021"
+	.string	"\002\022\002"
+	.string	"\002\023\024\002\025"
+	.string	"\002\026\027\030\n\002\n\030\323\307\351\365\016"
+	.string	"\031\235\357\220\225\013\032\033\202\312\321\202\003"
+	.string	"\034\267\333\375\360\007\035\227\316\342\246\007"
+	.string	"\036\312\302\204\263\006"
+	.string	"\037\377\354\255\233\013 \236\376\250\313\b!\350\300\306\254\005\"\216\345\326\013\004#\334\237\214_$\261\340\353\213\002%\352\263\360\321\b&'\277\265\220\001(\244\237\270*)*\240\301\276\347\017+\271\230\252\375\006,-\240\342\234\212\n"
+	.string	"+ P\202cT2\017\265|\304\257\277^\363Vb\025\332F\250XW\376Z\301 \3144\357\257\2451&\b@C\002\300\202&\2769HDb\360vxc^\003\205"
+	.ascii	"L\034\304\372\224\301\201Y\030\314\362\373M\023\007\367\346\034"
+	.ascii	"\211\317\351\022\242\362\216mL\t\327$\307\244\030\215\r\n\342"
+	.ascii	"\213m;2S\003\032p\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375 \376\265\003"
+	.string	"\324\003\362"
+	.string	"\024"
+	.string	""
+	.string	"\001\006"
+	.string	"\003\007"
+	.string	"\003\b"
+	.string	"\003\t\n"
+	.string	""
+	.string	""
+	.string	"\001\020"
+	.string	"\001\001\030"
+	.string	"\003\002"
+	.string	"\001\031\001\033\034\035\036"
+	.string	""
+	.string	"\037 "
+	.string	"\001!"
+	.string	"\003\"\001\001#"
+	.string	"\003$"
+	.string	"\001"
+	.string	"\001&"
+	.string	"\003"
+	.string	"\030"
+	.string	"0\203\330$@T0J\321\314\214kz\361\204>\224\305Xp\203)Y\3015A]"
+	.string	"\346"
+	.ascii	"\t`\356\205\002\0048u]\256\013O\221\2420\013j\3559E6\200\005"
+	.text
+	.section	.gnu.lto_.inline.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`~\004e\f"
+	.string	"\302\214/4Po\322\001 \371\234\0056,*\312M\360\347z\200\235\005hL"
+	.string	"\t\212\030\202\263&\200\352\337\212\231\256\312\314L\301\007\035\251\345\001.\n\031\322\b\3312\311\024\215\030\201\330\370\017\256\316M\030\245E\005\364\322\265\305\214\022\025fO]\344d\350S\332\030\250C\003\203\266\320g\021\016\222\311\252B\002(\303q\312\177\252\b\035o\377\255b\235t\371\177\365\2405ZX\004\362q\312\217\307\035\245M\344\020$@\201\314\254m'\0328r\233\231G&+\244\232\360\302\370\237\321V"
+	.ascii	"X\030\n\373\245kU\215\246\321\260m\200/t\375\374\377U\273\311"
+	.ascii	"S\211\307f\340\026\263dy!\te\332\202R\027\001S\250\0216\2344"
+	.ascii	"\323B\235a\rP\"BUU\036\022\340!i\022\210 \f2F@\215\021 \221\t"
+	.ascii	"'\260p\202\013K\213\325\f\320\022\3218\325\210q=\376\362\345"
+	.ascii	"$X\241\244\206\326$\224$\244(\262\026\200A\376\3114\227\263s"
+	.ascii	"\332\235;Kw\223\001\251\n\r\025\314\217'C\374\023UqA\r\203\240"
+	.ascii	"K\270\343X\036\026\215ij9l\353\377\342F\303Z\277\215\255\374"
+	.ascii	"k~\215c~)T<\222u$\246\260\222\305Jl\t\377\352\374\020\366\213"
+	.ascii	"k\262\013\255\377\342\002[\t\316\324@y&\377\022\320)[\022\321"
+	.ascii	"\241\272N\2167Gl\030\"\362*\212\0277H;.\305\212<8\306I\007.i"
+	.ascii	"\204Xa\006s\317\207\321\303\212k\356F\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`z\004\365\017"
+	.string	"\006\323@? \311&\351"
+	.string	"\314\310O*\277\364\252%\360K\360\023\371\252\236\315\321\0026\354\322\262_"
+	.string	"`\221\337e\251\373"
+	.string	"$\001\244\001\220\026X$i\244\232G\216\370!\016\366\207\2476\260\2034\322v\222\001*"
+	.string	"0"
+	.string	"3"
+	.string	"\255eh\273\320jZ\205\326\365\023\333\034\344\036\344\360\206\260a\275a\267\237\236\021\351\245\216\220\340'_\355\256\334\227\205\205\350U\022\327yr\350\220eY6\307\004\027\224\327hZ\333\274M\261b\337Z\361=|\357D9\304\005<`\223g"
+	.string	"w;\370\035\300\243\356\030\373"
+	.string	"\t\261\002\f\206\340\340\007=\333\343\272\307\341g\207Z^\220\246z\364\004+\310\227^\372j\302dL\303)\343R*\002#\370\002\243\021FRa\242\227\022=\322\006\306+m7^\212\323h3z\306\301\264\036\243\275h;\355g\213\212\2663E\333\t\tN\204\t~\320\302S%\017\214\330\bKHS\256$\313\303]5\370z\250aM\247lK\312H\2469\240\"\261\252\321\003\022 \3438\016\304\020e\254f\266\245\235\355e(\005$$F4CF\357Y\242\002!L\034\327\013\204f\251y\034\354\311u1\353dE\305Y\207\260\t\304\310\350\253W\003\337*b\204\003\3121\223\006\3654\336\345\253wH\210\016M\304qZ2\315\307\r\304\242w*\303r\374\342\257T\335\344S'(5o\2056\030\204\213\007:m\016\024\247\351\251\t}r6K:V\333\373\273\310\233\252^\302v\214\241x\270A]\230\322"
+	.string	"\354\362\262\201\227\202\3253\017\233\334v\353\354\276\200\324\231\021\215\260=6\037<KA\033\323\212\317\034\254Kv\247]\273\277\335\300\327"
+	.string	"\235\233Z\355\332 .AB\234K"
+	.ascii	"\267\220$n\356\327\315\326R]\037\245\373\241\303i&}n7@\006\333"
+	.ascii	"\264-\003\206\3359d\2479\202`\021\346\202\370\270z"
+	.text
+	.section	.gnu.lto_.pureconst.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375 A\275\001"
+	.string	"\022\304\f\024\240\2531\276\362\377\377G\035i\222$I:\236p\177\233^\031\236\344\221\007\371\3439\3368\343\213+\2368\342\207\033.\3025\270\340\005\036\340)\267\302\314\246"
+	.text
+	.section	.gnu.lto_.ipa_modref.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`\n\001=\007"
+	.string	"B\311\034'\2407\313\001\377\377\377\377\377\377\377?"
+	.string	"\273\377\377\177\377\377\377\377\3576n\240&\264\324(\225+\376\225\232\220\253\020\231R*\346b\231V\224\022M$\356\210\004A\242\355C\007\324\350\327\366\232[[k\3160_\330*\314\023\346\b\363j[\371\301\326`^\260%\330\202A\371\300\\ `"
+	.ascii	"sjK\315Q$2\333\t\341\334\370\263}\346\323\\\332\301\2067\004"
+	.ascii	"8 \260\002\222J:c'\373\301\205[\265\242\302U\264\241b\243\304"
+	.ascii	"\316`\320pPK\304t\0067\004\351\214\340\342\345,\366J\330K\211"
+	.ascii	"B\002\\\214/\016!\204\210\0220/\307\306\220\001\364\274\310\276"
+	.ascii	"\207\005T\220\314\033$\227\313\340\250\254\320(\301gb1\003\030"
+	.ascii	"3>c<\013\246\263-\033\215\327ABw\020Q\2143\270E\330&\302\034"
+	.ascii	"K\300\305\034\002"
+	.text
+	.section	.gnu.lto_.lto.a8614bc3cb44a1f0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pilotConfig_Registry.135.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375 \237\225\004"
+	.string	"\024\bj"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\206\200\200\374\342\303\355\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\354\006us\250\305\006uq"
+	.string	"\005\001\006'\001\"\005\001\006\035\001'\001\257 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/config.c"
+	.string	"\005"
+	.ascii	"\256\222\360Sv\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pilotConfig.137.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375 (%\001"
+	.string	"\340\030"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\005\001'\002\002\177?\202\210\200\020}{\274\001y\273\001"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.ascii	")\243\f\240\b"
+	.text
+	.section	.gnu.lto_systemConfig_Registry.141.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375 \240\225\004"
+	.string	"\024\bk"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\206\200\200\374\342\203\365\221\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\365\006us\315\006uq"
+	.string	"\005\001\006'\001\021\005\001\006\035\001'\001\222\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/config.c"
+	.string	"\005"
+	.ascii	"\257\222\320Sv\301,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_systemConfig.143.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375 ]\245\002"
+	.string	"t\004J"
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	"\005\001\006\035\001\002\005\001'\002\206\b\177\005\001?\202\210\200\340\001}{\273\001y\273\001w\273\001u\277\001s\273\001q\273\001o\276\001m\275\001k\273\001i\273\001g\274\001e\273\001"
+	.string	"\005SITL"
+	.string	"\004"
+	.ascii	"@\204\315\313S\206\036@\021"
+	.text
+	.section	.gnu.lto_getCurrentPidProfileIndex.144.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375 \363\265\006"
+	.string	"b\214.5Pm\222\016$O\n\242\204\252\233\265M?K\333\314\362\302Z\376-yCnh\267\243\r\275s*\2764\nQU\025Q\274\230]@\2101\350a\264\326>\3312\005W\232\207\215\003\307\252\036g\303"
+	.string	"\361\252\253\3634\003[\021\r\327\223\260\254\353e\266\254n\264#\310\034\350\357Td\002 \363B\341\206\324Dq=J]\341\301j\245\256\347R\n]\200)\303\323o t\244\257%\335\350\307\321\tp\230\030\234d\206N+YB\221|\374\237\317\214\220\360\031\353V\n]H\031\030#*\231\333s\035\305\212\330-H-)%\024MdQ\304,d\346\250\2114\272\353_\360\037\374\033\001\t"
+	.ascii	"\252\322\t\314b#\206\024\024\002t\r\377\213\030K\210\034\356"
+	.ascii	"\234\251\235O"
+	.text
+	.section	.gnu.lto_getCurrentControlRateProfileIndex.146.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375 \363\245\006"
+	.string	"b\f.4Pm\222\016\244\034\240*\2472\222\275M?K/\314s\223Z\376\253]\220\033\332\355hC\357\234\212/\215BTUE\024/f\327\222B&r\200\303\332'[\246S\032\207M\003\247\242\036g\263\360\360(\253\3634\004W\020\f\326\213\250*\353a4\254n\264+\300\034\350\357TD\" \323\"\341\206\2644q=:M\341\301f\235\256\347\322\t\235@\t\303\3555\020:\322\327\222n\364\343\350\006HN2)\231\241m%M\246\222\217\377\363\230\017\020>_\3258B\027\222\306\305\210J\246\366\334F\257\342u\013R\013J\307\226\211*\212"
+	.string	"\n\2319f\"\214\356\372\033\374\231?#\t"
+	.ascii	"\252\322\t\314b#\206\024\024\002t\r\377\213\030K\210\034\356"
+	.ascii	"\234\251\235O"
+	.text
+	.section	.gnu.lto_getCurrentMinthrottle.147.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\025\007"
+	.string	"\"\31506@o\222\016\230\022\254nFdF\210@\241b\222\352\243\222\035\207\215\337^\34466{\326\321rZ\340E\r>\206\341Q\341\322\034\tNNIw\036\254\221F\210L\001W\233\b\016D\307\252b\207\343 \021\253\313\0237\007[\023\017W\244\260\254+j\266\254S\276\321\017!{\241\337\323\224\212\200\314\f\206\213\322\315\342\212\024~\361q\325\n\357\347\t\234dn\346\267\220{\036\337)\337\350w\2737\260\342\262\300\222\2711#\223-Pe\344\007\275\346\222\264\0044\346\266\020\016\252D\322(\305dn\221\240\006T\241k\001U\370@\212\325a\267&\235`H/\232\b\243\016\240!3w\232\250\243\277\376\t\277\302\377\021\n"
+	.ascii	"\252\322\t\314\264\312l\034\n{d\260\3105\3746bd!\362pWL\355$"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_resetConfig.148.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375 \324\235\005"
+	.string	"\"\312%.`e\323\001\360\331@\272\324"
+	.string	"\214\032\016\020\013]\tE\301\223\227\364\t\276\210\330\202S\301\231n\020D@\2450q\217\244\003x#Z)e\n\257\250\207\345\270f%/\213\001\221\025&\221\224\3413\322\300\344dNLN`+{\013"
+	.string	"\361\302\333y\177\212e\225\373\202H\342\306\332\017j\313\233_\003\315\336\317\205Q\224\370tg\002\306\026\005\241\357\277N\317\376\221\202\235\326\360\303\204\245\356\226\314\321L7\273\252G\t\\\247\351\016\024\335\375\345:\215\236\365\377\341?\342\177%\t"
+	.ascii	"\252\244\233iq\323\031T\341:\327p\262\020\306\313\020\340\322"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_activateConfig.149.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`\025\003m\026"
+	.string	"\326f\213J\260\022R:\342S\031\267\021\025\374H\301\232Lr\036\025K\350\252J\177*Wr\317\3309\214\020\342\241\016\016@F\373\377\310vhXo\315\267\350\337\305AK\327q!\371\370\241\276\005\240\\\312W\341;\270P\007{K\310\226R\246q"
+	.string	"r"
+	.string	"z"
+	.string	"\025(V!\375\337\257\323B\361,\357/\240\237R\255u\237v\367\357l\323'\004w~\236\237\\q\311\233\277\217\345\351\352+\007\303'jH\255\265l\2435w\024i\263\371]\246\005p\342h;\216\004\255xRk%q=L=\220\270\0337U@\342F\b\0018\0335\311\"\352\261L\313?\270\036\346W\203Z\353\371\304\001\355_\373\177\303\377\007\177_\b=\036\031V\206\214\207\272\303\254\024\214\273t\304X_\314L,6\256\310\315\303\023\027\n\211\254(\2570\025\220,\023\275\262q\233\244Ho\307\215\211l\224l\244\326\333\202oo_\314\276G+\276\003\016\357\2113\256\270M\002\005\227\236j<\374y6\356\334\277\264\326Z\337E\177\363KD\376\213\362G\221O)\277\233\317\315_\0232HV\312\214Z?\f\273\002+,#\016\360\017\201\205\367\3742m"
+	.ascii	")!\240\255i\037\373{\265X:\337\243\267\270\270\3546\201\360g"
+	.ascii	"\333\362\t\241\326\206\016\375\351N\233\255\021\201\006u\265"
+	.ascii	"V\006VKC\002\205\027\336\363e\\q\354\205Z\021\304\220\326\217"
+	.ascii	"\221/\250\244_\335?\237\"\273{\205\245\232*\351\335m9\364[\032"
+	.ascii	"\300\264\177\013\030x\317\223%nM\033\031;\367\335\335\352%\371"
+	.ascii	"\304.\272l\344&\240\025\247Q\321\020\263)shfb\034"
+	.string	"d\n\034\2462\023\223\251\231\301\312\232\030\214\254\204\335\340\224*\006>\263\211\271)sf\263\233\222\344\325\226\326.:S\224\345FY\222.,\025b\312\322\376i\021\002\254\265\215\210\345\007\320\226\2732\252B\341\257\226\211bsl\320La\"\231+\350\236k4Y\230-\246\2007\027M\346\222\022\002\356\376M's\307{\376\344\326\264\343\350f.!\0215\036:H\nL\250q8d\024r\b]0\222D\244 -\034\200\002!\242\244\007\020`\311(i\r?A\024JE(\233\304\256y\215\347\b\263~\370\"\373\034Ij\375\212c\355We\362\252Z3\204\032\322\235N\245\0133\347\216klD<\355f\330\003\327f\372\212\323\220s\3526\333\034e\241\257\352\0345\024\324\375f{~-\364\032\274G\356\223\340\301/\237u\t\331\276\272\233\206>H%\324\255\350\004\b\023\225\004\036}I\205_\003nE\213\0316"
+	.ascii	"\273\313\261 \310\257\016\034+\233\337\234DU^j"
+	.text
+	.section	.gnu.lto_validateAndFixConfig.151.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`\325,5\237"
+	.string	"z\363d6H \f\343\031\003\207\312\377\243\372\374\216"
+	.ascii	"K\201\211bP14\267\216\211\205\321Bpn(\334\234\336\232\225\"\307"
+	.ascii	"n\027\336\257M\310,?\203w\370\374\314F/S\272>I\262Dm\311\356"
+	.ascii	"\262u\275\257Fh\210\020\231RJ\001]\003\030\003\\\003\220\216"
+	.ascii	"\354t\005\247\021Q\350\032\325\214\354t\245\230\310\275\250\210"
+	.ascii	"\247wF\201\250N\344%\223D\3106\223\036\364!\367X\375A^\r\331"
+	.ascii	"\317\016O\215\361}\337\245^N\262\224jx\251\244\022\222Pg\212"
+	.ascii	"K\007\3570\222\221\f\033\347\013\r\277\0308\220\201\023\344\355"
+	.ascii	"Q\013!\001\005\337\376 \373\320\264^"
+	.string	"\3571\3630\221\356\302\317+\021nZ\003!\327\274\315\270\032\222\371\240\273\360\367%\2761w\026\356;\346\351\345\226\346\342\266\235\022RU\365\355j \256\212\200N/\221X\020\312\354\336X\204\316\302\237\304\216\007\251\261t\035\363\364\\\323\271]%\201}\277\252\257W\013G\246\312\243\332C\314^\352\364\005f/Y\005\013\267\345\240HS\325wKE\344\235\034\344\373\356-\365\222K\350\364\222\231]f\305\256R\337\346\231\tW[ \337\367m\3723<0z\377\037\206\311d\366\t\t\t\261\035\213\031\374\315V\233\213v\334f1\334\307|\034\206\367X\217\363\030\f\177a<\366\302~\374\307c\230\fw\341;\266c.\274\205\265\260\225\263p\035Wk\320\230!#\006\214\027.Z<\261X\301\200\\\306IE\n\024ML'L,\225 \241\2244BD\b\020\037< u\340\260\341\310HC\206\"\"\fCB\027\202,"
+	.ascii	"\375\370\364<yv\234:M\346\222}w\271\2336\312J\020\304\352\232"
+	.string	"j\026\303:\275\302\324\035I\243j\354\223\0336\272n\323\304\271\217o\016\3259\fZ\363\336\343\230\263\336\223\346\274\3060g0\204eb\315_X\2404\026\305\242\023g<\260f/`\315~b\315\177O\232\307\2405\223y\223\302\004\222F\331\230@\3215\226\2734m\264i\006\346h)\221\226Ei\276c\337\n2\354H\032\375be\310\271*lC,g;!\302\262\255f.Z\315[\264\264\230\200\304\331z$\215j\261H\327fO\220F\263\234\263\200\330j\256c\225H\313\2164W\217\244\321#\030\244\321\022\274\006\006i\364H\245\323 T\364\031\223-C\262cH\316q\030r\372\205\034\302Hw\001\331- Y\244E\177\242\fLt\026nz\205\233f\300\246\232l.\203A\032\275\302\206I\243p\356\324\246U\264A\364\024\207\215\342\360\352M\202\315$\210\306O\004\266\211\3003\276d\246K\020r\231)\343$"
+	.ascii	"[\211\214'\351\371\210<\027A\310\005\306Ct\033\027 !\327\027"
+	.ascii	"\007\201\327\037\360<tA\272\363\342\035\350\232\003\335\234o"
+	.ascii	"\240\253\303\342Grm\204\324\306\025\347\032\b\271\344\352\256"
+	.ascii	"x\006\026\b\216E\001\346EM\033(x\2755\221\224\306 \205\315\207"
+	.ascii	"\326Zh\355N\315/D\351\240(\200in\001\255\201\320\376\250\376"
+	.ascii	"\363\244}\236\364\215y\217X?\t\271\304X\244\367}{/\314y\374\255"
+	.ascii	"w<H\275\234\264\223]\221\330\345\204'\211\"\233n\343j\342:\204"
+	.ascii	"\\N\272\256=\264q}y\223I3\331\rj\320T\371\020F\206\307\323e\304"
+	.ascii	"\227l\211\2613J|\272\256\330\2414e\211Y]V\316*\351gK0\206\211"
+	.ascii	"\303\323U\305\016m\261au]\273VW\324\275i\343}_v\254.\257\346"
+	.ascii	"\b\232\271\271\204\231\355\230E\f\t\277\363RV4H|\317\005{\352"
+	.ascii	"\230\334\027\275<\236o1h[\376E\016\017\317\313\316"
+	.string	"\277!\340\320O\343\372\216\n\306\216K\217\333\2327G\241\237\262\363u^\312*\250\305\005\373'g\254Y\234\337z\207U\027\314\307\230\231\031:,>\327\365}\327$\312\n#\347.\\\201{\013:K\342V \311T\241r\366\rh\241-\205)@iK\234\315\321oM-\355\373\357'\215\221\017\215\352\323lL\034\005F\276\251Y\263}\367\365\374t\254\245dP\276Q\013\\\030\225W\206\260\223\356=;@i\027\214YG\227\246Q\r\232&.\346\202A\211%\216=u\036s\007\036\346\212\261\031\244l\242W\271\367}]\364\222\335\211\203\271O\\2\267\314\2352{\331k\337{\r\302\253\322j\210\347\004\3077?\2048\301+J*\257\344.Z[\240\360\374\224\275\351_\355N\377\352\276k\247\332\243\226\016\267\022\323\350\263\270wLx\277\355\2421\231\335(\356\332\005p\366\"\031\235\215b\025\347V\017\371\020\304\242"
+	.string	"a1f\321\321j\346\027\211\225Y\021\227(a\376\322\352\007\327T\362\3453\273)\270nNP\252~\252\212w\271*p\265f.\234\316\373\276\313w\272\345E\262*lia\222\300\034\362\216hm\2630cKo\027\013\223}\013\254\207U.'\316\221\270Xt\336\267\352\211=\313Mp\351n\340\300\361Kk\036\334\034\225W\362\006\367\346\301d\016@"
+	.string	"o\254!\357\211\215S\330\f\336V\277\372\361F\204F\330"
+	.string	"\004\274\261\370\231\367dP\307\352\215\354\177\312P\246\177\327\251\251kT\203X\345r\030\203\267\026\247\372\341C|Z\254or\357K\325X\354\257O1\300\255\326Kv\340\2077V/\271\1770#\220\300\033\313_\310\n\203\221\214U?\305\\\215\372O\231\273HJ\335 \277\031s\307\301\275\265\225v\353\266\236\302\266\326ji\215\326\343\334g\355\325Z]m\036\322r\232\005\3508\315>\372Ms"
+	.string	"\255\330\334\243\021\233y\354\3504\315:\372Ls\016\034Ng"
+	.ascii	"\236\3167\234\3166\234\3165\236\3164\234\3163\234\3162\236\316"
+	.ascii	"1\234\3160\234\316/\236\316.\234\316-\234\316OOg\026@\316+\332"
+	.ascii	"\331\t\310Y\005\220s\212vF\321\316MOg\246\247\363\211\247\263"
+	.ascii	"\211\247\363\322\323\271\204\323\231\304\323Y\351\351\234\324"
+	.ascii	"\316#\234\316\"\3329D;\203h\347\017\355\354\241\235\221\236\316"
+	.ascii	"\035\332\231C;\037\265]\263Q;kh\347\242\037g\242\037g\f?\316"
+	.ascii	"C>\316BN\347\013>\316ANg\013>\316@N\347\237\036g\237\036\347"
+	.ascii	"\036\247\363\263\307\231\247\307y\247\307\331\331\343\254\363"
+	.ascii	"tn\35683y\234\227;\316l\263i\376vv\247\263\026\265\261\2603$"
+	.ascii	"oX}\267*%\337\301%\237\224\226\323\035\247\373M\267b7b7\233\356"
+	.ascii	"4\335g\272\355\272\345\272\253-\311NW\225s(!\331\351J\3621\255"
+	.ascii	"\365\035\246\247'\203\321\005{ZT\224,dv\245\357&\261\005\323"
+	.ascii	"'\240W\031\343m\016\373\006\343\320\005kq5t\\\303\354\242\360"
+	.ascii	"l\326\\M|\002z\213/\316t;\365\254\321]\020\272`Oi\332\256\023"
+	.ascii	"\203\355\222\002\316\022\3310\273\324\027D#\203\352\250\343\227"
+	.ascii	">\001=\301+\312\240\2620\324\026\033\230\r\347\224Z\017\2737"
+	.ascii	"0I|\303=\373\325W\324+\221|\031w\n\220\3047a'\211\231\204\233"
+	.ascii	"{\372);\021W\264\327/\345\374\360\257\316\361Y\376\3279\336\245"
+	.ascii	"(\004\243U\026?\365\353\034\337^\337ayc\214\214E\307\270`+\250"
+	.ascii	"|\377\347G%\215\230>o\366c\366\262\207J\034\310=\027\214\005"
+	.ascii	"\365\304\353\345M\031\004\363_\304\304y\363\270\255\367\342\202"
+	.ascii	"\255\270~\227\266+\351\232\344\357\332%>\316\324\306\344Z\220"
+	.ascii	"\331e{\273\347\362Du\314\361J\337\201\315^\311\023\374\025?\375"
+	.ascii	"\361f"
+	.string	"\334\020\274\331\210\"MZ0o\254\021\017%\306\025\311\030u\372iU\354\255-\331\006j\026\263\3057G\025dL\021o\301\223\247k\311t\036\313\317\265e\323\366\354\214\331K\021\3374K\214L1\365\366u\241\b\201B\210\017\242l\232\nd\002\221\006\342\203\312\234x\253G\374L|P\373\360A|K@S\325\022\236|XJxx\013\236\332\036>\350\312 \211Wk\346\026\315]\013\242\362t\342\247\204\364\030"
+	.ascii	"\275\357\213\364<c\330J\266$\016/\304\346}9\374\016\3343#\222"
+	.ascii	"\273\021G\337C\251s\364\315%\356}f\254\"4\374\023\266\206\357"
+	.ascii	"\307\016\021\355\"\r\234\253k\255\024o\254\242\357\341s\033\254"
+	.ascii	"\002\321\272\245\360e\255\333\223\264\255\322D\326\2520\002\212"
+	.ascii	"\023\025.\220\216Ch]\264| \372\021\314\244\300\375\230X\030\030"
+	.ascii	"\321\363\024r\201\233\363\360J\032\303\213`\026%\356\233|19\001"
+	.ascii	"C$RK\307\034z\013\254\210X>IK\327Dm\353\336\253\265&]\267|Wk"
+	.ascii	"\327\341\267\236\253\355\302x-\0300\314^\016=O\341\026\241\347"
+	.ascii	"Gb\002\326g\371\\x\241\277z\2537\342s\341c\224U\006=\177\264"
+	.ascii	"M\343Wn\365\236\252U\243\363\357O\265a\232\013\265\317\302\007"
+	.ascii	"\371\371\244;5\307%\3331\200\255\231@f/-|\2142J\270\271\003\034"
+	.ascii	"\350\331#\3334\217\016\331\252\tjv\303l\327\264\206H"
+	.string	"V?\305?\017\364'\016\335\321\235z\343\215m\233\326M\273\330.2{\371\363/\324L\362p\346\266\261\205\343z\202\203\321\237\352\360SE\027L\004\365}_7\355#\207\3532\261'\032\347\215\231\305\370\306\341\007}\376\331\326F\372a;\331\201\324\253k\325\177WC\237\357@\264'\223A\306\rEO\244\034\375\364\252\306\005\013A\310\243f\021\322\321\213\252g\364Sn\032v;\311\354y)k\340\034\027l'u\320|\263l\021N\003\333\356\024\363\331V\272\031wj\303\225\331\215z\031\327\212\210J\306\001\335\253#nV\026\263\227\317\357\272NrS\214\314\360SN#\352\270gv\307\350q|\326\233nN3w\365\026\375\264\225\2308\276\343>\206\325\310X\324+\235H\314\240\227>\276\237$\211\030x\002,\204)\310\006P\030DIu@A\220\"\025Hm\020%U\204\203( !X\b\023\221 \027D\r\241"
+	.string	"\210T\023\220\f,\204\351\002\250\016\232\212\b\311"
+	.string	"j\003\f\212X\b\023\221\246((\"\"P!T\300B\365\006\025@I\005Q\200H\007\0318\213D\t!\222c\203( QE\242\244\016\220\212*\022E\300\005A\244>8b L\031@a\300A\024\220&\016\240*\030\322\004D\212H\023\223\021Gu\020D\252\251HT\224T\023O\225\252\337\214u\b\231\fR}\224\241\354\373Jk\324\265\005\306,^\271@Z\002\355\366\313+=\374\253y|\226\022\223\307\367\233N\343b\244J\001\036\337nK%\223v\t\034\320h\277D|`\251\005\230\203\200"
+	.string	"\337h\217"
+	.string	"|\340\031IJ3e:<"
+	.string	"\337s\300\364\215\357`\343o\\Y2c$'\377\374l|\317\251<\240\200V\373%\242\003K\355\343\321"
+	.string	"\037\337j\337\216\225v5\236/L\241\234=\275\244\257\361\375\330w4>i\306\323@d\277\340\025Fz\3512\343\373Q\262\200\001z\312/\021\033X\352"
+	.string	"\032\t\b\340{\312\267#\345\030\031\317e\013\324o\002:\2658Z\254%^\306w#k\245c|\t\030\037#\221\255\253\322\251\301\241\233\203\361\335\bg\200\237\362O\232\217n\373%\"\003K\335\343\263\270{\354(\266"
+	.ascii	"=\276\333\276\035'\r\215\214\275\370\270\226\354\351z\005\352"
+	.ascii	"7\301"
+	.string	"\033\270\267\306zs\342_\020\255)t\361'\236\335\210c\213w\361M8W\212l\225\226\254\025\251\314\320>\226\n\324\357\301\3149\256\340\326\366\275\330l\234\235b$\237\233\275F0\037T\006\322\032P\353v\340\247R\232mL\371$w\207\330\022\346\310\003S\370\333\260b\223r\215Y6Vl>\3762\n\177!+6\035Y4fVl\272!\363\276S=\346X/\t'(VN9\206=k\311&\230+\034\223s\303\354*aQ\200\002\362\240Qa\013\036k\306N\241f\002\241\202i\230\275|\372&\264g\361\335\246E0I\264\032\332Q\266\327\tZ\314\002\320\362\316\322X\240kt\260\230%\203\032\242`\241\270V\f=\204\266\031j\204\022\311\350\321\fr\205cr\216T^9\347\357kd\305h\3545z)\331:\016\020\232\367\317\n\373j8\201\253\224iq\006\253~\212\332Dh\006Mx\323\265M\332u\315"
+	.string	"\226j\017\303NB\334\321V\236\331\033\377;>\213\375\230;\276\347\330\367}_\036?\355\035\337V\276\r\233\225,cX\266c\305+\300F\241\215\032\254\025\262T\354\324\212\357\231\236\211\264\242\310dM\207\323\373\\\212g\206\272q\372\256\322\221\216[w9~\372rZ\305\267\324z\270\370\224\320F\023k\203\223\222*~\271\345\f\\7^\237t\341\20062S\274\024t\205\217\2046*\255\311\215\311!2\267o\036\022\n\207\035Z!\321\252\311\307\371G\350#4\022:\007:\311\354e\212\357k\213\260\032\0239\367\206{sR"
+	.ascii	"~\312Nc\251\335\306R\267a\353DV\311\253\261\324\177\343\247\257"
+	.ascii	"\177\343T\033\365\371\253b\003\305KY\021\241\276\354\366\352"
+	.ascii	"H\213\342}\376\334j49\223\246Fr\002\223\301*\0322Z\353\227"
+	.string	"r \360\257\326\241c\206\216\017\203\223\250\342(%\320\242N)D#\"\"I\222d8\002\f\020\006\343`\030B\327\016\022@\3444I\263\216\031eHl&I\3535\007\315K\222\177\346J\335\247w\320(%\222\221\244&\0273\271\352\300\362U\t3t^)\306hI\220\245;nK{\026[\332\247\225W\342\f\017X\035-\316}\326\265t\235\244\"\220\344;\321\005n\324\235$wo%M\306\303\202a\250I\243T\235m\254\013\2103\215+L\2751\355\304\253\234\375\340J\222\242\276\222&\343a\3010\324\244Q\252\3166\326\005\304\223\306\t\246.e/p\220\327I\024\272H0\033\364\337\027i\030]&A\212T\026\242\371\216\030\035\356\244\253\244\307D/W\230\2753\247\220f\003\243\302#\034\007\250\020c\277]\210\324\360~\031\304\301\374\312\330\016\225\344;\325\301Sp]N\2332\221\316L\352\t\037\f~\221"
+	.string	">\231\214\265\370-\250\254\370v\350\n\325\313\273\005\322%\261\247A\021\016u\212/i\204d\273>\tOO\341:\035\256\272\366\311\206\206\205\246\227\260\335Y(:7\032\234\r\030\362\002isr\320\346+\231\331\216\337\233j\274\005\333\177t\202\316\301\207\265\354\302O\021\344\302\210\314\254\271\n\205\244\361\301\234Q\227\310\353\323@x(\n#\224^\341_\222\322\233t\345\314\326*\233\352\254\031k\002\363\357\321\312a\375\231\333\321z\025\255\236mG\227K\034\267@"
+	.string	"\354c\221\240\313Be\305\307GDf\323\223\300\363\314x\326\036b\311\303V[4Yl\266\361\301_\212V\350V\233\b=\343c\204\316\250\314\377\257F]1\257\232\303;+\030g\364\276"
+	.ascii	"b\rN'\240\007\224Mo\361\274\006rR\263\374\332?3\f\\\360\335\347"
+	.ascii	"\221\322\274\2563<\212T\250\001E(\243\200\316N\346\337\256\007"
+	.ascii	"\371\225\200\336g:\027\332\255"
+	.ascii	"h\323\235P\0019\343\0216\351\236p\315\007\272W\342VM\\\314\013"
+	.ascii	"K\3249R\3035\220C_\335\324\342L\301\022\200x\001aU E\001\264"
+	.ascii	"\332i2\242JL+\026\274\277\323\227KAw|Zt\270\262\374I*q\001\006"
+	.ascii	"\r\372\034}\237\320_s\230Wq\\\376\263\340i\251\377\002A\360U"
+	.ascii	"\353'}\243\254\376\254r\202^!X\26162X\276\375\006D\325\3268\374"
+	.ascii	"\367\003\225|M\311\246\374\212R\265\327\211U\271q;\340\245\200"
+	.ascii	"\312)>\203\033\260\023\005\210#i\006#V\020\237\241C\272\203\365"
+	.ascii	"S{q l\013Y\335i\253\272\177E\374\206\t!\211=\256* \273\306\204"
+	.ascii	"\213\242QAlM\f\245(\310\032\347\270\223\365\204\246Y\361L\263"
+	.ascii	"\003\212\f\342\234\361`\320\335\021\004\225\331h\240\316\275"
+	.ascii	"\031\3456\001\374aN\347\036\177S5\324\277\237\237\\\367\214\027"
+	.ascii	"\\\314\364z\363\250\374r\263\322\254\271\373\030\n\353\026vO"
+	.ascii	"\323\002\307\302\316\253\370J6J\360>\322\356VU\200\204;\325B"
+	.ascii	"\006\271\227?\217)\177.\340;|\023\316a\251\237\017\363\022^a"
+	.ascii	"\301*on\215\264\271\242\240dq=\021\223*YC\261\260\341e4v\261"
+	.ascii	"X&{\363;h\3671X \021\220\345\"\252\211\022\327\374D%\312<\367"
+	.ascii	"\265\237\237\217\341H\336U\310p\246\213\224G\301zYd\177\2337"
+	.ascii	"\372Do\242\370\2418\213l-~\331\025K\226\363\2516Y\206\250$\021"
+	.ascii	"\254%L%\333\026\222\215\361\214D\035\035\0035\034D\265!\306U"
+	.ascii	"\206\024\261\231\304|t\374\277\370\247\0019U\002=\263h6\321l"
+	.ascii	"\247\246*mc\265?<\240\021\345\240\bM\240\"\035"
+	.string	"\236\274\007a\343WF\246T9\267\277\201_\210X\223B\364\210\337\360\212\022\317\250B\255*3\300,\t\254\036\366\033U\367\363\301\263\313\016\026\234s\005+\016h5U\221\017z@\240\223\357,Yc\205\0364\224k\257\007\250\003\342\340\346\033\337\"B\261\332\213\fCd\031\024\242n\240\037\312\240\334j\211Z\256\250\316\020Z\n\246\350f\005\035\3030\3547\252\232\203\031\327_\333\\\261\276\361\020\370\033+\314\351\024_\355\361\025\205*\225\246\316\236\210%\245\271\345y;u\343\265\251^\016kN\200+;Ab\264\"\376\250\005W\251S\243\245\205\227g\037\007p\207L!$G\244\256\034\222B&\004\270\221\221\312a\251\304\266\222\241z\247\2050\203\247PSu\235\353\362\324\324v\364\217\001\337\235\363\031M\200G\202\271\366b\346S\203s\210\351\366>\323\367\037\230\302\256\306\327\305g9=\022\0362\302A\330\305\004\352"
+	.string	"\342+\262\254J{\365\250EX\206\351<\344\213\302\300\373r^O\002\214\n\031\260\276"
+	.string	"(l\215\335o\361kA\315'\305\235o\033'\305\235o\033\217$\f0\003D \2668v\236Kggx\006\302U\006\232-(in]\367\324\375\244\302)o~\237,\353\246OIAEw\271\314M\210\262\233\240\022\356{@\233\202\022 qF\272,\326pa^\027\037\363\n\206\201\025H\277\343\353\030\030|\251\373\361P\313\305\227\272\f[\356\006\244p\215\217\346\201\363\317\232\016\226v\3059({p\364t\212f\020}\212m\230\374\202z\031\302\3547\246\005\317"
+	.string	"\340\332|\311^\236"
+	.string	"\210\037\221+(0\253\207U\3442\344\365\r;\265\300\221\233\263\300\345\316\352\035\302\247[N\302YX\354\210\312\260w\006\023a\023\303\343A\263\031a>]\2367\027@\333w[\347\204JG\360\007`cn\200\243\230\237H3sF\037\021\f\243\326\240\372!8\210\260#\027\241\002<\305\377B`\030U\307\207\331\332\204\nL\235;M=^\343\036o\214f\247\364\356\013\276\355\377\266\340b\3223\224#T\031q\262V\320>\366\306j\020E#\002rH\250{\326\251\255\0055\b\232\234x\334\303@{]d\251\316\312F\272\311]\205K\035=2_\252\353\333\366\216c\351\261\3140k\364\260\027\202\032\214\314P\222\020\020\350H\002j\330\253\307\273\302) "
+	.ascii	"o\n/z\b"
+	.text
+	.section	.gnu.lto_validateAndFixGyroConfig.152.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`\002\025\005Z"
+	.ascii	"\352\220\224 L T\322\351Azz'ai\b\350$\023\336!T\230~\"0\352x"
+	.ascii	"W.>Y\273(\241\271\373\037\020\261\371Cn\003I\317\216\016\027"
+	.ascii	"M\3253\226\204$y\274[\005G\366_\234\200%*\302\214\212\210\210"
+	.ascii	"\216(l\202\222\277\367N)\245\373\001\321\001\356\001z\375\007"
+	.ascii	"B\373q\023\211\312\rz\341\356\373\222T/\324\005\031\224\311\017"
+	.ascii	"\276=e\027>\262\255\022@`.n\341\316\343\342]si\033\317\n\007"
+	.ascii	"\253\310\305\341\312#C\001\360^6\021\206\275\342x\357\260Y\270"
+	.ascii	"\265\330\205\200\324b\273^:L\256A6\017\256p\327\0050@\333XF@"
+	.ascii	"b\261].b\030W\035\332\340\275S(\0306\0327\020m\205\213t<\247"
+	.ascii	"\336(\315\244\311\032\023\031\303^{JSi\273\n\317\365\375\272"
+	.ascii	"\236wD\0238\300{o\212^\231i\330+\262y\330^\325\336a\345\346\240"
+	.ascii	"R\352\340\344\240Q\352\336~\342\240\367\336\266v+\301\215\217"
+	.ascii	"K`Nk\036Nh6> \210_\253\365\032\263\t\215\306\025\3141\001C\273"
+	.ascii	"\367\232\300|\002s\261Wb\221[\3460\315&v\177\232\250\340|2x\357"
+	.ascii	"m\372\032\272\355\025*R0\2418a\242\304\222R\022\322\021\322\250"
+	.ascii	"\210hH(\b\350\307\247\207\207\304\216N\016\316\215\315\321X$"
+	.ascii	"\326\fi\330U}o\271ib\324<\275\260z\305]\253\270\333\342)\264"
+	.ascii	"4\223\026;G\221\245Od\251s\023s]b\316\211\234/)\321\3040\362"
+	.ascii	"%\245\223T&\260-AZ\257\353\007\225\247K\030\230\376\223\342H"
+	.ascii	"p}\004\327\347\203#\343\242\270\321Z\027\255\2519\221\221\257"
+	.ascii	"\270\036Bk!4'\0364\326\205V\267\203\003\251L\200T\312\264^W\232"
+	.ascii	"\312\303\245\344\331V\316\374\307\307\315\272G\247k\211\212D"
+	.ascii	"\352u)q\036\276>\322\353\212\273\301I$\351\235$H\\\307\206\316"
+	.ascii	"\261\341\210\343\210\365\215\230\223\030\334\006\254\217`r0\270"
+	.ascii	"\221H\027\211Hy\301\211C\272f\b\\\037\215uE}xd\344\013\3324z"
+	.ascii	"]\320(Ng\205\364\332|\373\341j\220~\033/-\025y\357m\267\366-"
+	.ascii	"/\246;M\214{/\373\323\353\253\231E3\177\013f\376\2019gLSg!\017"
+	.ascii	"\315\357h\013B\313\315\254\271\rOC1?\"c\201\0313\330^i\276\005"
+	.ascii	"\024\217\004\rR:\350\235\231\340\316K\231\375\325\001\0173\302"
+	.ascii	"\276\013\b\274H\f\353\353\200n!\324\201\201\310\225\301\034\365"
+	.ascii	"\237\206\017\211\252\023\270\013B^\007\364\312\031N\220\247\""
+	.ascii	"\261{/\013}\005j\305L\360\346\373w\264\341q\r\367\352\362\207"
+	.ascii	"\361\247\306\025\370\nV\303{\265\b`O\301U\270\301\235\244\327"
+	.ascii	"\034l\257\375\355\244\227\250<\231\001,M\315\306o?\217:\334\351"
+	.ascii	"(\330\350\370\2263\376(\346\360,g\032s|K!\276\364\211\235\326"
+	.ascii	"\3408\242\317\020q|\303\r\315\320<\025\321\203\303\247\357(,"
+	.ascii	"\021\353\215\300&\303\336\370~kul\311tK}i\230\006|2ngD\374\336"
+	.ascii	"\213\365/e\243\"\375\304:\375\2166.Zn\206\271\301\364\020O\334"
+	.ascii	"I\370\202\034\336\317^\325\306\200\355\325\351\333\255\223\276"
+	.ascii	"\246m}?\f\311\362)3\033\263\325\373R\346V\357\317\300Lt\326A"
+	.ascii	"t\316At\306At~\":\337 :;\025\235m\034\235k\3448\323h\274\346"
+	.ascii	"\b\332\256\371\201\242\363\002Eg\005p\234e\304H\340\205\213\336"
+	.ascii	"kn\321t\315\005\364\227f\245$\244\243\363\321\321\031yt6::\027"
+	.ascii	"\035\235\211\212\316C"
+	.string	"Fg\241\242s\220\321\031\350\350\374ct\366):\367\034\235y\210\316$n\234wl\234u\214\3169Gg\234\033\325\331\346\350|<:\033\217\316E\2433\261\350\\\323U\232\207Dg\032\2423Kt^\211\316*\321\371\211\316Nt\356\f\200\312\264\355\2715Y\341\373\330.\327\364\210\233\267VY\322_\272\367\272\361\272\355\272\261tW\351\246k\032\346fn\277\016cA/\364\335\004|\361A_\264\027\235s\026\002\375\013.IO|\240\357\276\036\356\205E\241 _\312\315\327\235\244\331\204K\221\213g\225\b\351\223~\253\305'\375\212%e\315HEz\027\337\303\204\212i\2161\255t\t\003S\364\263\345[\264\330\375|\013\211\276\235\251\025\360>\337\342?\2569\326\363>\317zi\002\362|\317\267\n^\327\222]q,-\227W\313\002\013l\257<\337|\335\300W\364\t\241ZV#\351\001J\035\321\b\352\275F`\344"
+	.string	"\3660D\342\201xZQ\245m\241\204\337\275\227J?\003i<\t\237'\316\302\007~\347i|7\005#\370\235G\340\211\263\320\005\237\263r:1\271\266\314\343\342\"\370\316k\007"
+	.string	"\243ngj:\377\300\253O\234\205\002x\3163\267/\2640\260\375\324y\244\326c1R\316\267\226\276 \214k\332\264c\n\275\324\327\032\347\275\320\207\226\254\337\304\242\264e0\374\240\264g8\337oG\324\202^\352lm\363m\244\261\264\315;A\247gP"
+	.ascii	"\274\263t]+\303\360\311\356\326\206\001\340mm\031\267\322\266"
+	.ascii	"\006\357'\333\274\305\300F\b\370\343\261\230{\004\266\256\227"
+	.ascii	"\274\240\200\001C\023\314\362)\323\245\231\211\001\365\f\237"
+	.ascii	"U\237\233G\372-\356\226\214=~\325\021Wk\311\214\322\3322\"\264"
+	.ascii	"\243\2111P\374\300\322~8p3\236c\003\330u\360\262\026\211zC\273"
+	.ascii	"\204]\302\366z\363]\305\347\245s\315\004\362B\036\214\351\224"
+	.ascii	"o\370$d\371\324\237\027E\373\031\356\356\236&b\215\377w\3057"
+	.ascii	">\37330\313\247M\234IK\266\344\307m\016\276\244-3\022\353\225"
+	.ascii	"\375\006W\322\236\265N\332\2646\215\355\265\370-\004\352\205"
+	.ascii	"P\215\370<\327\354Z\367f%\025\360}\246i\307\364)\327<\361\325"
+	.ascii	"\273& \315\327|[i\034a[\001\334\203\005\217)\037MW=:\230\372"
+	.ascii	"\200\203\037\356\301\302\252\307\025T\262\211J\231L\006%\225"
+	.ascii	"TR\fXYIE)\253l\360\230\262A5\225\324\221JN]\371P*%\3401\345\243"
+	.ascii	"\b\265\201K]A9EY\315 \001*I\274R\366\260b\340\003e\224\362JY"
+	.ascii	"ec\002\036RU!\fI%\247,\350\200j\352\003\037I(+#\225r\352*j\252"
+	.ascii	"\352\312J\312I\352\n\212\207\217\247*\345\2252\331\303Q,:\230"
+	.ascii	"\342\200J\031\325D5\005\225l\212\252\262jb!\304J\037RUMWJeUS"
+	.ascii	"\221-\253\325\3733p;\351\341[\332\024B\300\254g\262\214\347\337"
+	.ascii	"\372\0246X\366-\377\376\326z)0\216\331\007\027\310\303\003\331"
+	.ascii	"@\215\023[\016>\nK!T/b\367^\003z\345o\276s9\304R\314r\314r\f"
+	.ascii	"\333\253\214o\036\332\t\207$ywepBj\374\002\377q\316\302^\323"
+	.ascii	"b\326\370^k7\023\304\017,m\005\231\307\372;%J\204\231\n1}\264"
+	.ascii	"$\343\205g\216^\203\250 \241\332\fg^\026\261$<\321\267\226\307"
+	.ascii	"|\254\024f\222F\204t\3210\203L+ri\204\227\021t\"\226g\226\323"
+	.ascii	"\026\013\213\355\025\371\032D\303\240x\251\020\035\230,1f\207"
+	.ascii	"h\337\340\t7\n\323\222\ra\364UQ/g&^\232d\203H*\375\215E\361\314"
+	.ascii	"\004\225<\301\362J\274\224\273\350w\264\375i\271\031\246\177"
+	.ascii	"\341s/\355\017g\013\004\b\333k\221\t\2578A\2604\265\245\227r"
+	.ascii	"\016!I\n\324\024\3012F\t\027\222\212\266A\364z\311\245.}\335"
+	.ascii	"s\346\031\030\343y"
+	.string	"\236\350;\210\2561\263\027-\242Y\306\306\307\270\301T\302i\266\302\016\275\002\317\336\0244 \356\312%\275\224M\274\221\251\035%P\303G\006u\316!_\274\322o\245\350\241\357\277vh\013\203H\332\366\376\224~\350w\332\242b\234\205YH/\355$\373\342\023\370\235\275(^\023\214\351S&@*e\216^\312B\001\201\260\250\2010\203\031BC#\"\"I\222\024:\301\005\304\030%a\3256\021\020\245C\214\251\231\031I\n\222=\326.xn\203R1\310"
+	.string	"\007\377\025\215\244v\245\257\224\216\206o;\371\226\267\253t\331\tp*`'\306\271\207P\241B\247\336\365\"\250I\362\3040bO\363\n>i\370\206\350@s>r\031\227M\242X_\332\255\001\221oD\036\313\3773B\f\365\330\273\001qP/\346\021\211\220\300\367l\221\002\030\311\335GC\304;\230\270\276\017\270\205 \245\243dFC\tNp(Nl>\203_\366\271\341\241\201\213 \240\305DG\215\247\222\006@\342\231\260K\250\341u\371\310\331\331\034J2\264\222d$\243\fcG\t\340\256k9\207\017\005T\273MA\313\217\374\363#\243*HN\200\363\024\361\331t\262\002\266E\213;t\242\276S4\277\001K\340l\316\277\3770\203\224\340\344zx[\332\334\302e\373\356\033M\255\343\205_9\260\244f\262\213\275}?#\004T\0176\261J"
+	.string	"\301Y\356\204&\333U\007E[\326\352@)o\202*,\346H\201\234l\213\370\210Up(1\203G\340\276:\r\"Rfs\3429\374`\n5\312\347\362\232J\007\311\376"
+	.string	"\f3\026\271"
+	.string	"]\216\267+p\312\334\215N:\020\260/W\371\230\336!4\361\355\301\007\300\n\202{\034\265\206\246\214\3710\020/\374\3021\210\330\007\310\372\203\371o9\252\262\327t\005\270D\203$\026\026\2539)"
+	.ascii	"\351\365L\242\220'\323\304\315\034\206\f\251\226;5\345\221s\225"
+	.ascii	"3\202\217\207\277\005$Q(&J\372\217K\226\205y\316P3\341\317I\306"
+	.ascii	"RF\377`5W\357X\002MTt\211\r\220\332c\204\253\330\357\322\273"
+	.ascii	"\267$J\370\310\002 lJ\246\256F\3574\277N\005\271\207\360\345"
+	.ascii	"P;\0279a\334A\366yLax\246\206\230\351\241Z\335\253\315\206\006"
+	.ascii	"aaa\2530\341w\235]}*b\3532&\221\364A\365\251\210\255KFT\004="
+	.ascii	"\bj\354\324\245\352o\311\3136\324\206\324\311\353\336\310\225"
+	.ascii	"h\326\030 O\030\323D\302Z\254\245)W\367\234\304\\\273\034v\223"
+	.ascii	"\221\207I\253\241(\271GA\021>1v\031\234\2428Y\002\t\325\n\002"
+	.ascii	"5bU3\350\005F\263\214\b\244\243n\202NG\374\256o\265\207M9\200"
+	.ascii	"\325\210Q\316f:\0358\"\f\360\233\037\330}\2618f\204\306\254\013"
+	.ascii	"\"\306\315\230@$\360\363\274\365\363\277\006\245\253\037\325"
+	.ascii	"\024\\\034\360\350Q\217\260nS\004>\357\3328-\341\267\357\376"
+	.ascii	"3\"!\024 \2220V=\203\323\3708\327\267W\231\376\335QR\207\203"
+	.ascii	"\200\356\352\263s6f\327igY\233\320\353\024w\023\371\027\021\032"
+	.ascii	"!*\232\001(\262\376u\311\377\320\271Q\301\033\311\315\300\003"
+	.ascii	"F,\036X(\240\365\333U\377]\225\177\243\251\347\234w\335\271\351"
+	.ascii	"\352\315&\367\327\252)hd\270k\203\243\323e\315\333\272\357\017"
+	.text
+	.section	.gnu.lto_readEEPROM.153.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"\345\b"
+	.string	"b\31797Po3\006\200\320\223\251\213\261Y$\300\207A\337\r\251v\t\375\025Pj\034\r\333\270\326N\334H\306\362\203\243\0351\263l\210\253\370n\036F\337\225\3506\244\211\2242\245\034\307\301\260\017w\031\333Hd\021\036\r\243\236\f\242C\261\215\243\233\002k\025\234\215Zh\332F5\266~VI\232\362W\305\343f\310/\353\240\340\350L\210\256\206\240\202\271W\264\271O<8\345@\neg\264/0\342A\307\024J\344\302\362I\317\266^\224!\366g\225$\373\341=3\004'$)%\246\225T\331\032\212y\251\327B\031y\370\333 \377d\315\303\316\300\2635\004"
+	.string	"\362qC\205[N\b\270e\206\006\220\273\333RH\300\264\242a\262\252\325R)\362\356\261\363\177\372\303Wj\001G\336\343\345Pku\004G\033\267\274\355\003\333\013\3663\001\025"
+	.ascii	"\252\244\2231\335@\206\311\317\020\264\003\230\201\"`\034(F\363"
+	.ascii	":@B\251#p\332\372\346\020\256\211SX\0207\004\270(\372C\005\017"
+	.ascii	"w\316\324\316'"
+	.text
+	.section	.gnu.lto_writeUnmodifiedConfigToEEPROM.154.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\235\007"
+	.string	"r\21526@\217\322\001\270^\357f\327\365\330\344\255xd\026S\210 \032\344!_\256%,\254%\220\214\025\313\217\275-\005\341\005\302\215\353\260\363\374D\322-\373l\2374)S\n\2766\013\034\005\017\274\236\207\203\200\275+\003\275\215\200!CB\366\032 \314\236\246\333_VI68\225T\251\220\212\354c\030_\344#\230\277a\370\311\307[\376\007s\353\300\342\344\261\022\312\025\310\344\020\362\320\371@i\332\020\021\371\350,1)\251R\"\335\354nK\275\260\177Y%\331\231\316\311h\202\273\006\312\356h\325\262(\313\304a\373\032k\266\312\273\214\r\350\250\220 a\331\335\247\030\327\236\232\177\220\003Dn{f\nv\327\0319\212[o{\3006\201\355\224\020"
+	.string	"\252\244\2231\355}\206\213\263\002\232"
+	.ascii	"|\24000\004\324\245y\343M\333\\\303\347B\030/C\200K\267h\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_writeEEPROM.155.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"5\007"
+	.string	"\202\21527@o\222\016X\222\350_\3504\337\203$\331r\272\001\234jH\036\270\263\300\266h7\273\371\334\216vC\013\274\250\301\3070<*\\\332\356:;\226\330\266\261o\237\020\231\002_\034\207N\203\007\273\242\247\263\360\020\257\354\0239\004c\020\fY\224\300\260,nN[!I\223jAm\220[\363>\342\363\332}\220ZAqP\364+(\363\023-\001\025\22423\341\222\324Dq;j]\021z\355j\335P\246VM\031)*\226\355\255\376\304=\250\361\305$$=F\340\343dT\016\227\314\213\325K\242,\024\220\277\233\265W\351\251\224\003\"\036\026&\252\314\214p\243Z\237v;\322\200n$\352\003P\310\314_7\302\350\260\277\301\217\360\207\004\t"
+	.ascii	"\252\244\233\2618\304\031h\361\256qMt\013\001\277\f\001.\335"
+	.ascii	"\242\235O"
+	.text
+	.section	.gnu.lto_resetEEPROM.156.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\025\t"
+	.string	"\226\020?:@\217\322\001\270\206\342\2520\200\244n\261\020\363\005Zp\016a\260r\262\346U \214\332\217\370#\023\243\250\314\306\037\b\":\343I\353\270tv(2n(a\244@\237\220\275S\n."
+	.string	"*"
+	.string	"1"
+	.string	"\n%\213\257\035*\202\220\361\302D\266[\351\344\270x)\372w]\023a\275\260\264\240\254L\227"
+	.string	"\f\273k\231Zi\334\363\266\017l/\330~\005\273\262\245|\330\276_\362J:\2119,\227\221\335\345H6\367\355v\311\346lK\371Q,xLl|\355\326\004#\004|\263mN\260\327,v\232(W\270\376"
+	.string	"\003\221i\244_C\013\371\224_\017\241\2221\213\241\246\311\256(97\354k;[\266&1\2520V\367\200\331U\315\310\004\340h\"\354x<\007\3207\002\303\006\017\f\007\334m\">\236\320\327\321\320\247\003\242\235\b\244\033\003\177\024\236\210\216\276OD]O\327v\266|Q#p\022\r"
+	.ascii	"\251\322\235\314\n\327l\264\301RN\213\301\024u\336\341\232\210"
+	.ascii	"\214\t\022TPN\205\025\236\267a\355\324\003"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.157.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\365\007"
+	.string	"RN57Po\322\0010\345\rw\321UTZ\301\003\230)\036\260\031\030\006\323\027X\373]4\265\2068\315(\"\220S\217\20023Cd\n\253[5mUsd\272\265-eJ\001\276<\r \206\020v\301\020(\341\001^\231\bz\b\214A,d0\002\3032\330\351H\377\220t{\234\264E\022y\316zVG\013E]\261\271*\220\274\224\222\345\227\366\004E\236\273>\365_\234\264p\254b6\035\331\335\226\352a\377\355\356ZQ\366\323\3378\260\2340\342CRvO\255\231UiTDl\277c\315\206y\007\262\003#.&\023\231\335\205\372q\355OS\363\003\342\350\017@\343\372\nP\033+\201\270=\203\025\225\351\251\247E,er>\273\353\344b\306\255\271m\004\333\007\266K\002\017"
+	.ascii	"\252\244\223i\021\206\363\020\266j\240+\354\005\252y\340\245"
+	.ascii	"u\357\267\260\336\\py\031B\\\272\246\232\246\201)("
+	.text
+	.section	.gnu.lto_saveConfigAndNotify.158.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"M\t"
+	.string	"\306\221A< \0057\035\340\004\211\342\344ZX\320T"
+	.string	"3\023\024\036=\rK*\017D\201\224(x\374\366u{C\f\3170\270\355\372\032\002\bR\024 \001\3607\345h\\\302\016\224\352\333u\357\224\002,"
+	.string	"1"
+	.string	"1"
+	.string	"$;;}f\317\226y\250Z\204\222\261ce\334\335:G\356]z\376[\347|\250\322\245@\304\356Z~\250\217{\336\366\202\355\006\373\016.\256\020\227\215I\276\354\360$\247\210\375\200\335]\317\224\215\031\240\254Pg\261\354z\274"
+	.string	"\254H[X\266\357\237\034$\335e\002\220"
+	.string	"&\273\233\235\332\001\022/$\343\fG\372 \207!\377\231\001\246F<\315\222\345E\330A\207\256\"RP\355.\204\037>E\303_\235zc$\377\235\372#\354\364\340\035h\002\326:\025\033\005\210\323*h\233\260\250Z\027\252\235\004s\027\236\256fp\\W\263\320\364\231\362@\314\215h\232'\037\310\207\333\232\3473\212\034\263\344\002io\237\267\036\f"
+	.ascii	"\252\244\223\261\030\362f\304\305B3\276\316`\307f8s\031=\250"
+	.ascii	"\020/W\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_setConfigDirty.159.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375 \355}\006"
+	.string	"\262\313,5`k\323\001@\2575#\252\021\204O.!%:\003\207>&6\272+C\205 \215x\206\242\035\367G`^\203$\321$\250\002\213\204"
+	.string	"7@\222\301\357m\367N)\236$\017\325\251\352D+j\363\241\223\025@%\213+"
+	.string	"\307\242\002\265Z4\002\367\362\323|,\210xl\222\300\377\005\371\026\277\270\374\007\017`\361\334\247\217A\2373b\343S\250"
+	.string	"\331bh\203Z\224\f\366%+?[V\b\235\201\367\211\214\335.\034Y\216\251\001a\373\2213\273\343\240\303V$\302\002\214\220\335\245\262\341\331c\346\237\342\024\316\323\036'\231\335u\344\274\203[\336\366\3056\306vB\t"
+	.ascii	"\252\244\233\261x\300\031\342\342\013]\303\347B\030/C\200K\267"
+	.ascii	"h\347\023"
+	.text
+	.section	.gnu.lto_isConfigDirty.160.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375 \350]\006"
+	.string	"\362K,3@o\222\016\2305X\213\265B\370\231\251\216\340$\200\345\215\273\3350\207\351\377\337\354\025ZA\013\274\250\301\307\360x\016\315\303V\262\223\210\342I\245\325\275e\nO\230\210\f\204\206\232\232&\343 \321\246\212\242a\f\246&\036\252VAQU\273dY\f\035\036x\360\363\035)\211u?\266\330\\\257Jw\023P\351p`\303s\243\317:\207\034_\200\314\3141\364\337\207\004()XE*\231\240QK\236H& ?\347/+,p\266\232y\200\nB0.JX2\263\206\035\265z\326\255H\033>\242\225\013\353\364\004\0302\363\2730\215\216\375\021\376\204?#\b"
+	.ascii	"\252\244\223\261\230\300\031Aq(q\215^B\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_changePidProfile.161.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`\320\001\235\021"
+	.string	"\266_sH\320\362&\035S\002\225\217c\247HR\273\202xw\006F\310g\370x\205!\313\225&\220\031\343\320v)\030p\323\350{\2135n4\324T\022\0333\027B\0161B\216|\351\216\20139\016+\366\203&@\037A\332\310\2262\245Y"
+	.string	"["
+	.string	"a"
+	.ascii	"5\266\352\335U\266Um\024\007\260\017\331x\347\354)\272\3159\232"
+	.ascii	"\270D\344\235av\323G\332$\t2\201\023#\310\234\323\333\237\303"
+	.ascii	".Wa\376\211\036"
+	.string	"@\234\305.w\276\262$g\003\310\310L&\t\344\260\020Ot\0251\013U\001H\230sZ\305\231\316\335\335\366\004\333\031lm\020bL\352\335o<J.P\334h\324iO\271\333\336&%wc8|\324r\310\364\311\036C\335\025\366\345\\\037;\245^\251Z\365\241_\252Z;\365GV\250\207,\350\304\342\306\231\0235d2uK-l\337/z\255\3460\034a\207G\317\320\234\363\343\215l\232\2770\n\217\022\215\0356\207\016z\321'\372G\034\375\310\t\311\3116\346\325\3725~\223\361\201\354!%\305\350\013\234l!.\311\351\265\333d\244\215&\266\234\006K\352\200\220\364\031-\226\357K\275[\355k\357H\244\330\221\363\223TB\2657:\003\035[\210C\202\222k\177\270\f\233\004\2649\347\003\377\350H/>\320;\2031\372n9Q\371`\274\231\026\226\317e\205\004DK\305E\241\345\362\255\200\257\013*\037\214"
+	.ascii	"\263NX\276\025\027\310\362\\_\312\213\307z\311x'\b\f\302\264"
+	.ascii	"^\336\f\b\276<\325xs9\327\307\"M7\230n6\364\001\325\265+XP\360"
+	.ascii	"\3255\301\201\372\032P!\204\013\321\023j\224\304\260T@m\r\033"
+	.ascii	"\\7\246pc\036\240\253\r* P\202A\314\314\016\236\fSJ'\232\366"
+	.ascii	"\275\341\320\326\303\356J\263\003\033\030\021\341!Y\006\230\331"
+	.ascii	"\0333\n\262\313\255\253\334\205\004{\226-\333i\231\032\013\237"
+	.ascii	"W\030\0271\306\233\363*N\232\036N\344\361\177E6`\3646\270\211"
+	.ascii	"\025w\354\201A\213\200\362\330h\021\270;\265\243\022q\262s\363"
+	.ascii	"v\246h\036\n"
+	.text
+	.section	.gnu.lto_isSystemConfigured.162.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"=\007"
+	.string	"\262\r25Pm\323\001$\201\210)\210i\275\333m\232\311\253\355\362\244\232&\303\372\301\222Al\303\303\240u\025\033\206\016DUELw\3534DaKF\027\255\355&eJ\001\2362\020\232\207M\234\340F\323\020\001'\252\202\231\001G\t\007\nR\304HALw]Z\005\251\026\\\2129_Y\256\252o\305#\302<\361\220\n`\027C\301\007y\250\302\367\370\263\005'\237\375\371\034\313\337\225\240#t\345\310\356\260T\r\373\322*\310vZ3})"
+	.string	"\205D;7\262\373\031\251\254\311\023m\266;6\306\b\t\035[\3578>\002\037\233G$e\267\203\272q\353i\371\347\316p\302\225d\332\305\363\262\260\273\316L\313\270\365\266\rl\037\330\336\002\n"
+	.ascii	"\252\244\2231={\303\024\306\330\241\262\30551e\004YB\344p\347"
+	.ascii	"L\355|\002"
+	.text
+	.section	.gnu.lto_setRebootRequired.163.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\025\007"
+	.string	"2\r15`m\322\001"
+	.string	"c1\227\220@\230 U\310\177\024L@\240\004(.\013j\250\032-A=;\024A\375T\305:\006"
+	.string	" d\007\"D\206\021\007~K\310&[\246\024\276*\t\026\204K\274\340\305b\240"
+	.string	"/\f\003+\002\216\013\007\030d\210\021\203\326\266\237\326u(\242\031\3328\bWz\fe78\350\245\025\244dd2\212p\232\377\f\345s\274#\343k\370A\243\227\177\276\206\372{\036\"$\013\020\311FK\366\246\251\273\260?\255\353\330S\244\340L\314\177D\273\234\322\311\206^\210\307\366-g\366\310\267\214\r\330"
+	.string	"I|\220v\027:\214g\327\314\377\347"
+	.string	"rj\327\252`w\255rV\334\356\266\007l\023\330\366\004\n"
+	.ascii	"\252\244\233i:\3070\342\333w\307,\350B>\027\354x\031\002\\\272"
+	.ascii	"E;\237"
+	.text
+	.section	.gnu.lto_getRebootRequired.164.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375 \350]\006"
+	.string	"\262\313+3Pm\222\016$\013\252(\201\352\"y9\024\272\212%\364\236S\272\361\024\326\354\337\355\360Z\301T|i\024\242\252,\210Xy\273 \304B\261C\343\026\367\226)O\227\b\fD\206\232Z\006\343 \321\246\212\242]\f\246&\036\252VAQU\263dY\004\035\036t\320\363\r\251\210uC[h\256W\245\253\t\250t8\240\321\271\321g\234\303\215/@\"\350\277\017\tRBXE&\231\237\321J\236H%\036\377\346-+,l\266\232u|\n>H.FT2\263\206\034\265z\326-H\033<\"\224\013\343\364\004\0302\363\273\260\214\216\375\021\376\204\037#\t"
+	.ascii	"\252\244\223iq\326\031AC(\256\211\205\021y\t\221\303\2353\265"
+	.ascii	"\363\t"
+	.text
+	.section	.gnu.lto_CSWTCH.63.260.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375 |\235\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\346\377\377?"
+	.string	""
+	.string	"\200\340\305\333\321\001\317"
+	.string	"\005\001\006\035\001\002\354\233\211\203\001\360\240\242\304\210"
+	.string	"?\202\210\200\030\177\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\b"
+	.string	"\200\020\330\0072\003\304\001#\b\225\037\260j"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.part.0.306.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`}"
+	.string	"\005\t"
+	.string	"\362N78@s\322\0018\346F}1\224I\2041\223 Q\363\036\343\216U\370\222\377\fL\"\354[\244{\363l\020S\211~T~.\345\270\216\201\215\\6O8Uc\354-wJ\001\3068\020\236\207O\206\315\217\247!bb\032\305\344 8\223p\320fE\226i\363\262\r\037WS\356`(IUew\023\335\027\\BZ"
+	.string	"\320\367,.\340K\276w\206\026S\315\fIGPU\326\370\270\232\262c\\}\005\250]\215\033\233\355\220+ \376\311\275\320Q\254\034\313\013\212dw\317z\007\272\211\007N4\240\320\375\022\221}]\227\037\261-2y\263\277\263>\366`%\223\221\322\332\335y\251\036\337\2560n>,q\243\353\273G\221\323\007\023\243\302m\034\032<\006tv\327\002\034\267\274m\005\333\t\366\t\002\033"
+	.string	"U\345\003Y\206qM{\3654\020\030L\241\3636@\024\fs\205\343\262\270Z\304[\204\370-\201H\035\233B\300\312\275\235\311f\266X\2248\235\001\332L\331i"
+	.ascii	"\270\366\224\302\302fSO(c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`\244\t\005\035"
+	.string	"\206\356\245Fp\250M:"
+	.string	""
+	.string	"\004e2\241\340\240%\235+h\356\320\243\243\005N\300\224A\037\022\250\203TFuO4n\210\252W\017\326\254sk\022\023\222"
+	.string	"\0034\032\332\300\003\214\311\304i\230\216\f)']e7J\206$i\007\224"
+	.string	"\214"
+	.string	"\224"
+	.ascii	"\227\022\243?\326\324\027\203\321\2172\276\350Cq\321\177\322"
+	.ascii	"\242\357\204E\277\311\212>\223\361D\321{\246\242G/#\2478\027"
+	.ascii	"\211\242\277\344D_\311h\342mJ\234\r\211\253\006\276\346\300\321"
+	.ascii	"F\\\r\211\340ip[\320\366\210\350#\031C\\\013\t\342Y\316\017\343"
+	.ascii	"\365\360*\035\216\205\344\320O\262\241oDC\277H\206>\221\021="
+	.ascii	"\311`\350\017\031uO\273\360."
+	.string	"\246\227\025\330}\312/\227\205\177\221\326\332\333\211\242\347\231\265m\355\332\220\007\235\347y.\365\217\214\326\3322J\347\322\243\337\205\330\367r\373_\272\372`\320~\230s\365\305\374\354\233u\237\314V\277\f\217\376\331\216\276\031\255>\032\035\3753Y\37519\372d8\372Vn\364\251\330\350\273\031\366\257`\365\213W\37575\372p\254\372jU\3758T}94\372k3\372s~\236\247\265\2746a\237\355S'J\375\312\270W\360?\242\016\204\2646\353j\210%\025\204:\030i\255\323\320\t8\204\302\202\272j\nZ\031\331_\"\360a\344S?\375\035%\235:\367\265\225\255\267~\300\212O\351G;z\322\326\237\032\223w\251N]\323L&BKs\344\323'L\222\311\267\364Ac\302T\253\232\374\313\306d\340\001\020\315\304l\033\223}\326\215\311Uk\311\272\365\003\302\312\276&\224L\224\336\3369cF\206T\262OB"
+	.ascii	"\036R\215,\017\245\t,\017]\005\226\313u\201"
+	.string	"\345Re`\271L\033X.\357\221e!\325\201e\241\364\201e\241\013\301\362\327\b\226\205\364\363\200\365\357\004\351\343\001\322\267\363\325\257\363\243O\307G\177\213W\007\226\216\217ok\217owN\217\277Z\266\336\311\002\371a;\352\255\361\370\207\343\361\370\367\007\022k+\352vrvEE\004t\274\224\323\361o.N\216\231\324r\334\313\361\325\"\216?\206\343\243&\216\201op\314\004\007\307>\253\206\343c\271Hjz\345\256jZ\345\256jJ\345\256\252\2244\311\344\217\245\277\230>H\264(\231\334\352-\240?aE\n&o]%\223\265*\230\254E\265\242\231,\\\205\251\360N\251S\351\032T\223L\016\336\250\365\002\226\340\261kL\216J\003\200\250\250A \006Uk\024\024\244\240\240P\350 \003\231\241M\007\021p \350\214s\242\tEd*\322\003}&r\340\355\353\341PCU0\360Z\034\222@\204\006\034\023\376"
+	.string	"\017\377\324\213e\342\202\3755\016D-0\333\003D/\315\363\363\002QD\0240\226\024\033$a\202.\021\fOA\227z\242<\214\346\352\234R\304\231`hc\204GnX\251x\262\354\270q\226\353\001\247\375l\250Y]&\327\246n\314'\233\341\201\230\267\r\226\307e\264<.\030\256\366?}@$h\004\202N h\002A\352\002\246t\006\n\263~\0301\236a<\323x\306x\206\361\314\232\037>i2m!\3078r\177\0356\231Vz \331,\311\247\225\343\273\035aNx\374\003_"
+	.string	"\230\265\313N7\230Z\217\363X@"
+	.ascii	"\177\354\320V\365|\313\300\325l\206\231\217\nZ\005\234Y\0311"
+	.ascii	"w\013\"\371\033P\310f\006P\f\006k\244\206\025//\340\253"
+	.text
+	.section	.gnu.lto_.refs.a8614bc3cb44a1f0,"e",@progbits
+	.string	"(\265/\375`3\001\335\013"
+	.string	"\326\234P= \215&\351\001Za\232<\"\360\005\t\200@DJ\b\342\020X\261\005\003P\004\020\004\020\004\020\204\354-!\253\303t,\003\326\002t\030\337-\036\321\354\357\232\376\003\351-\252\375\244m)S8"
+	.string	"A"
+	.string	"="
+	.string	"\240\343\034\367\237{\317\361\352\236\272\347\034\337\334k\216g\334c\034\237\356/\216g\3561\307\245{;\316{\032\315n\221!\206S\253k\244?\211O\326-\370R\237\374\314\027%s\214o\354'\316/\316\333F\347F7+oB\342\227\260\376\b\021/. \370\177\350\320\242\341s\320\374\0334\370\032\372\r4~A9K_\245\237\322n\240o\222\361\"}\021\306\0078\036\272\367\270\017\035~K\347\317\2608\203\365\n\326'X\317R\365\225\352\021T]\245\372\003TO\241\036\245\374\244?*/\351\223\364C\214\203\330\177\330\213\214\003\260\017\331{\030\357\260\3470\356\261\357\030\247\354\233\364\244\005:2\222\226\224%`s\344\001\234#\0249\204/\211K\326K\n\260\t\032\204\023\304\017\021'\031\342\013\304\016N\f\027,T\2400A\302\2073\002\204\317\363A;\035\254P\341\371S\2408A\342%\204\213\361=\004\031"
+	.ascii	"$\025n\312-\260\003\306\200\t\260k1&\323 \260\tL\240X\265\330"
+	.ascii	"\001c2Mx\332\001c!\024C\300\004\330\265\2145\215A`\"\322b2\245"
+	.ascii	"1\303\252\236"
+	.text
+	.section	.gnu.lto_.decls.a8614bc3cb44a1f0,"e",@progbits
+	.ascii	"(\265/\375`\356\251\205\265\002~J\304A\017V Ja:\215\001\304\327"
+	.ascii	"\344\3058\215\037\313\251c\363R\257\037$N\371\361>q3_~\342O\270"
+	.ascii	"\345\364\355\03737,\033\266k\246\310\234\302\332\326\242\262"
+	.ascii	"m\333\266\323<\357r\237.\016\373\377\357\373^S\310\321\004A\020"
+	.ascii	"\224\2545\362c%mw\223{o\271\245L\001\273\r\202\017\233\017l\266"
+	.ascii	"F\342!\364gX\b=\2077\272s\311f\346\374Xf}\016]\3669d\331\250"
+	.ascii	"\332\235\317\231g\310.PY\3331c\360\3421&\353s@\356:\232\016\n"
+	.ascii	"&\347D\225\3659@\331\347`d\237\203\217-\367\353.\332\213\226"
+	.ascii	"\243\345\220\2655e\035\207\207\005\316\323\213\254\317A\312\215"
+	.ascii	"~\203\223\032\216\026\243Kh8:L\234\"8z\214n\203\341\316\264\035"
+	.ascii	"\242\020!\200\224\314\331\220B\365\257\311\\\267\3713\023\rF"
+	.ascii	"\307)\2211\023$k6\352\0200\313\272\254?\264\334\307a6\220\240"
+	.ascii	"\321p:\006\235F\257\321f\364\031\234\324jt\333\265\233.S#N\371"
+	.ascii	"\326F\211\303\352N\034[\033\245\2328\350\f%\033\220 \375\241"
+	.ascii	"\271\215\341\360\020\372\001n\177\250\314\326kE\327d\f\200D\b"
+	.ascii	"X\326\346\230\375!\263\375\241\260\235\276x\b\375\020\223=\004"
+	.ascii	"\207\207\320\354\206\205\320\024\271c\253CQ[\345\302B\3507\334"
+	.ascii	"\331Y\260d+\035W\266\262>\363\200\316\300\302\203M\326\337pf"
+	.ascii	"\377\327V\364\025\234\324f:i\246\301t\025\fw\226\202\0277m\246"
+	.ascii	"\3134\221\237'\344\313\264\316\360R\304k\371\276\257\207\020"
+	.ascii	"!~\266\262\350\\\241\372\033\324\3667\204m*D\021`3\226#\353o"
+	.ascii	"\340\332\307lbb\\czJ\230\022\251\311pR\217\351\260\263\235\224"
+	.ascii	" _/P\375\rK\3667d\355o\350\261\277Aj_\210\317^\205\3426\217\n"
+	.ascii	"\013\241\332\253\313Lj\r\237\254/4f\037'\265\223\256\365I\235"
+	.ascii	":jM\256\273\316\205\367~\350\205\275\325\200\312Z#\321\\\377"
+	.ascii	"w@Mo\366\334\310\372\327\\\232\311\356N\331\025X\326K\326(a^"
+	.ascii	"ld}\241\264\375\037'\265\022\235\004\371\022\361`\030\021\003"
+	.ascii	"%\353\013Y\331\237;\227\377;\374$MJ\226\254/\264d_\b\310\346"
+	.ascii	"aa!T\027\371\365\f\035\245\211\344\225\210\033\335U\326C6\332"
+	.ascii	"\021\255(Y_\210j\333XS\276\357[\305C\355}_<F5FFYc\215\353}\337"
+	.ascii	"\035oE8\240\254)i\234\013\206;\303\\b\254\316\345g\367\276kS"
+	.ascii	"\324\336\367\375\257\261\364\017\235\245\265\264\017\035D\013"
+	.ascii	"\321<4\020\234\324=t\216\353+\255\343\032\371\276O\272\207\276"
+	.ascii	"q.?O\3107I\372\246)\312\332\362}\337\365J\r*n\203\276\2069;c"
+	.ascii	"\341!\024\2033\373\032\314\354kp\333\327@f_\203\230}\r_\3665"
+	.ascii	"\250\355k@\333\327\220e\343<E\327Sjb^\350\311\372\032\3006\n"
+	.ascii	"\007\013\241=*,\204^\303\221}\rX\373\032\254\3663,\267~\312\332"
+	.ascii	"I\273\270~\322M'\021\302yO\372I\277o\023\306\025\374`\\\301\031"
+	.ascii	"FIS\022\325\317@g?C\031\263O\232gF\232\030\262~\006+\333\324"
+	.ascii	"c\356\301I\223\317u\025\254\267\354}\221=\263\tG\031.Y\037\203"
+	.ascii	"@\201\372\364\351\323\007\203@\237!\312~\206#\373\031\260\366"
+	.ascii	"\317\213\205\320g\300\261\237\301\305\376\2412\355\264\235fU"
+	.ascii	"l,\263>f\033\243\201\305D\033\"\247\374\022\207\307\256\350\301"
+	.ascii	"cI\0301\272\274Q\276/\362l\311\304%\016\0363\253\343J\013\343"
+	.ascii	"\3015\206\215+L\031e\221\2276e0\240\314\220MYq\301\307\f\322"
+	.ascii	"LJiFL\007\036\243\302&JL\233\262H\r\216\262\315\004\363\206\307"
+	.ascii	"\252\300\230\301e\266\231i\0318S\304\353\313\215y\306\254c\252"
+	.ascii	"1\321\2301\230eL9s\215\231\306T\232o\3148&\035\323\315\204c\232"
+	.ascii	"1\345\230l\3149\346\233\031g\302\231mp\322l3\327n\2221\3314\304"
+	.ascii	"xcCBg$\036BA`!\364Ae\366\203\302\366\203\216\354\007\365\330"
+	.ascii	"\017\242\332\017z\367\201\344\366\201\330\366\201\250\354\003"
+	.ascii	"%\331\007\252\261\315,\246\026\234\364`ny\2010\235-\247\252\254"
+	.ascii	"\0174c\203\340}\261\007\024\367\351\203=\240\377\251\333\377"
+	.ascii	"\211\263\377\323\266\377s\266\377\303\265\377\323c\377\007j\277"
+	.ascii	"\207g\277gf\277\367e\277We\277\307d\277w\265\337\223\261\177"
+	.ascii	"s\n\035\232\303E\235\026\260\r\236\276h\t\223\362\265\353\314"
+	.ascii	"\330a\313\3727\277\314(\330\r\332\0266Y\233P\262\020#ui\262>"
+	.ascii	"o\3176\323BC\371e\214\236-j\334\270\326\264q\255q\231\361\005"
+	.ascii	"L\037e\021\035\332\227\2678f\320\274)\315\304\320F\331\025E\212"
+	.ascii	"\022\316\215\2313f\270\302\360\351\362\n\343\332\202&\225\277"
+	.ascii	"\210\321\332\303&\205\211\2314e\314\272\304P\262\251\311\340"
+	.ascii	"2K\213\342b\322d,3\341\"S\026\231Q\271M\306c\"\325\026\340D&"
+	.ascii	"\313\237\303\306\214\270X\253\313aU|L\261\242\204\211l\313l\313"
+	.ascii	"T\227\0231\256\367Ef\263,.\256\336\312\310Q\276\240\362\203\213"
+	.ascii	"I\237\263.(C\300\276\264-\271\302\376\374\205-\217\262\353\311"
+	.ascii	"\024.79\245ie\3760\201\2308\314\"\346\224Ye\"1_S\210\t\303\324"
+	.ascii	"a\2760{\230W&\224Y\303\334a\3120\233L'\363\206\371\304\314a\022"
+	.ascii	"1\261\314&f\0203\313\214ar\231[\346\020\323\313\344a2\2314L*"
+	.ascii	"S\312\264a.1\217\230IL#\246\022S\313tbv\231>\314\031\246\013"
+	.ascii	"\223\211\371\204\223fT\326\363\274'\363I[r\311afT.\313WL$\027"
+	.ascii	"\nVx(\337\367}\t/P\\\331\0052w\201YY\022&6\344H\036L\367\323"
+	.ascii	"\024\364>9\245"
+	.string	"q\325mQ\236a\321\221\315\316\324\354\310_\314\250L\206N\231\273\314\250\374e\345K\371\276\310\020\351\326\026\032=C}\236\233\235b\341!\364v\260\020z^\231}^\332>Ol\237\267d\237\307c\377\331\3153\236?\263\311q\371\016\306\332\331 \343%-\3539\223\217\2144\261\254\317\263\261\377g:yN\256\223\2258\231\355d9!\300\301VL$Wj\246\345\303N\226\303t&Rm\303H\002Q\276\301V~\230\202^'4?\270\354\3448/\323\034\020\234P!\273\263|_$Q\210\020!B\234F\256\350\240Q\365\327<\373+\235\375U\271\277\312\331_\341l\\\247\350\331\215\026r\207FW\326_\3436V\342!t\002,\204~\025\263\277\216\355\257]\373\253\326\376Zc_\355\263\257\256\331\024`!\364*\230}\325\312\276\312d_\025\262\257Z\355\253N\373;:\373;3\373\273/\373;\260\375]\326\376"
+	.ascii	"\013\241\337Q\355\357;\373[\315\376\376\262\277\247\354\357\255"
+	.ascii	"\375}c\177\277\373\351\233\375t\314~\232\266\217\264\362|\345"
+	.ascii	"\317\311\f\305;r\243\206\231\254\361\224\242g+@h\270\314-\311"
+	.ascii	"\372i\225\275\303B\350S\256\375\364\307~Jc\037\345\263\217\276"
+	.ascii	"\331G\303\354\253a!\364\350\226}tl\037}\262\217\026\331G\243"
+	.ascii	"\366\317<\373g\334\376)f\377\244\262\017\207\205\320\237C\366"
+	.ascii	"\317\030\373\312\274$\023\351\205\311\342eF\326/\321\007\323"
+	.ascii	"\375\234\357\213\225\007\217e\"\330\016\256\3739\3377K\017\327"
+	.ascii	"\373\276\317L\177Qn\222S\262\351\301{0\334U\t`uo?\036\303|\350"
+	.ascii	"2\221\374\224\2630\334\226v\223\243<#"
+	.ascii	"\222_L\207\341\266J\b[*\223\344#\331HV\222\213d$y\013'3\221\254"
+	.ascii	"\365,$\017yF\276\357\023\321>\223$\007\227 \215\325\360\020\032"
+	.ascii	"\001\026B\257\353v\020\"\335\245C\rY\326\327n\3661\033\225\233"
+	.ascii	"\213\033\371\005\2146\031H\376\221u\344\253\234#\357\310X\271"
+	.ascii	"G\346\221q\340d\366\221m<;e\246g\267\2526+6\032e2T\2148.\031"
+	.ascii	"Y\352\307|_,3\\i\331G\236zS\026\371\31050\335O\023\362\245J\265"
+	.ascii	"P\255\021\263|_d\210\237\030bhb8\350\353\260}\215d_\377\330\327"
+	.ascii	"R\373f\335\276\tg\337|"
+	.string	"\3337\267d\251\034\205\261\360\224\001\223u\236\241q\224\031\262$\353\233e\373\246\330\276Id\377\f\307\276\032\036B\277\206\207\320\233V\233W\267\017\207\207\320g\271\375\214f?\257\3559\266\262\201\367E\276\357\333!\003\033\025\220\254\237\261\354\037\317\035\327\375\270\016f\303t\030\353}\313\336\367\355\220\322H3E#k|\007\343\301\311\r\360\3628\017~\373\331\204|\221\357\213\004\312H\366`If\235\261\020\372\214\334\307\033\240f\237>x\003\224D\321\361\034\372\005&H\236\254\237\275\266\246\203\345\324\263=rR\262~\211\030\334\244\215Y\376\230\r\216\303m\260\033\254\006+q\034,\007\303\301o\360\032<\007'\261\034>s\214\006\2479F\036\263\265\311Y##\347V&\316\233\0318Y\264\320\235a\251\303W\376\"3=%~<F\206\255\374\230\357\373c\017\327\373\"\037\302_\364\223\b\001\313a8l\005\303]\031"
+	.ascii	"\354\215\362}\221Er\230\013\026\363\301\351}\233vL"
+	.string	" \304\315J\312\362}\337\020!\210B\240cG\224,#\320\030\n\017\241\031\260\020z\274g\037\307\331\307m\373Xm\007!7\321\221MA\217\r\002\017\241\307.\366\217\273\034\213\3711\032N\303a6\360\276O\357\373v@\241\236\262\274\262\306_0\230\3430\330\313\213\303\200\200\365\276M8\f\220\236\367m\002\302\270\002\214+\320`ZL\262\240\372\370\335X\255\350\270\213\020Ju\205|\317\336\367\0052\343\252\272\334\310\372\304B\350\215\373\003<\204\242X\b\035\001\017\241\027\356\307\341!\364\022\330W\342!\364%\354/\361\020\212\221\230\nNJ\200\313N\"\204\233LU\336\260\367E\002\365\370H\341S\227\365G\330\307U\336\341\314\033\3027\354c\tP\334\007K\200>\357 ,\204\376X\354\307Sp\230\004&T\024\326{\366\276\310\f@H\034RB\262>\022\017\241\033\013\241F\264\026p\374\257SX\374\350\215\377\204"
+	.string	"\033)Q\212(\217\363\311\013(\025j\365\243=\312\016\200\177=\312\246\357T\262^\340?\273\326\374\347\016T\355D2\001\255\035jY\n\370O\037\247\221\375\257)\376\363\b\355Q\366\335\2776"
+	.string	"H\323y\324\343\352\277\026\340DB\237\376s\207\032\024\217\363\376u"
+	.string	"W^\215I\367\237\030@\325\230r\377i\0014\r\212\346\f\016\300\237\227\3148\263\355?)\200\306\360c9?V\363\3437?n\373q\234\037\277\241p\346\330\006\377/p\007\\\003\324\314\217\226\371O\027P/\017\250x\376\323\303\177\n\375\347\0049\3201(\nTL\230S\375\317\364G\301\374g\325\177Z\241_P\bx\371\321\b\374g\356\362k/?\356\300\217\225~\334\343\307+\376s\207\332\257\273\374\272\r\020\345r\201\264_\247\370\361\226_K@C\340\327-\374\232\205\037E\373\365\004~t\313\257\211\234\037\350\030\277\216B\217~T\313\257Qd\371\365\013\3779\200\323\003\270\202\037\017\375\030\004\216\340Gy`\033?\366\3022~\374\364\343\251\037/\371\237\007]\341?G`\371\321\027\316~-\202\276"
+	.ascii	"5\373\321\343\177\036\340\312\217.Y\371\321\020\374\347\nhY\362"
+	.ascii	"?\377\237\350\317p\3775\320\032\374\346\236*?:\345G\275P&?\232"
+	.ascii	"$\233\317\361\257@\021T\360\243F\266~\024\203\016\212\374\350"
+	.ascii	"\210\363\250\007\376\032\242DB\030\362c\016?\336\340?E\234\315"
+	.ascii	"]\370\207\037\025\362\243Y\037\361\253]\376\363\250\307\177."
+	.ascii	"\251u~\254\301\363\310\375W\343\266Ay\374g\nt\307\177\036\237"
+	.ascii	"\376\252\232\377k\376\263\371\037\367\277\315\3774\377\345\376"
+	.ascii	"\303\371\037\347\377\233\377n\376\253\371\257\374\317,\377\303"
+	.ascii	"\374\377\371\327\034'\007\320\035\250\216\225\315\217\352\037"
+	.ascii	"E\177t\377(\376\257\177\236\320\177\302\371O"
+	.string	"\345\177\312\375g\234\377l\363\237o\376S\316\177\322\341\360\243W\377\271\366\237q\377\311\346Gw?\232\343\177\320\317\273\340Gq\374\250\325\217R\375\350\324\217F\375\250\214\037\205\372\321\027?\372\364\243M?\372\376(\f?\332\376\350\360G\221~t\003?\252\201\037\305\300\217R\340G%\360\243-\374\250\003~\224\001?j\302\217\216\360\243\"\374h\211\037-\372\321\021?\352\301\217j\360\243\030\374\250\005?\372\341G#\370Q\242\037\345\360\243\033~4\303\217\356\376s\356?\353\374\247\226\377\234\362\237R\3763\312\177>\371O'\377\311\344?\225\374'\222\377\314\372O#\3779\344?\265\376\023\310\177\372\370O\036\377y\365\2375\376s\306\177\306\370O\030\377\351\342?\235\376\223\351?C\360\237\037\370O\017\374\347\322\177\262\370O\367?\217\377Y\374\317\244\377\344\300\177\"\375\247\005\377\311\373O\340\177\376\3763\203_G\375\347"
+	.ascii	"~\f\345?7\360k\002\374\247\357?5\360\237\030\370O\013\374'\005"
+	.ascii	"\376S\002\377\363\374\247\013\377\031\342?S\374'\004\376\323"
+	.ascii	"\001\377y\200\377$\341?G\370\265\214_\243\370\317\017\3763\204"
+	.ascii	"\377,\361\237E\377\231\377s\304\237\315\377\024\361\237\036\374"
+	.ascii	"'\007\277\276\300\177\202\370O\r\376\227\375\347\005\377\331"
+	.ascii	"\373\265\362\327[\277\236\372\265\324\257\217?\216\362k\022~"
+	.ascii	"\275\301\2573\370M>\277\251\3477\225\277\331\3467\343\376"
+	.string	"\257\360\233l~\\\347\307`?\226\362\343\257\037{\360\177\316\377\260\3774\376\267\375\217\240O\237>}~\365\351\327@\354_\362\021pvhO\344$\271 \211\301\225\326\225\004\212K\f[)\303F\326\246|\203\022G\371\342,\313\331\021\031x\214\n\031\263\034Ue\215\013\316N\313n\313\217\371\276B\310\270\260`\341:+\303V\322\224`m\270\336\220gR\3340)\262\202\306u%G\355\340\354\306\334\224x,\354-\212\227\234\013%}\262\354\340\354\226\204@7\265\206\016\210\037;\316\240\240\017B\332n\313\231\223>St\262>\bg\373 @\331\007A\310>\b:\366K,\367K\230\331/\201\266_\242\311~\t!\373%t\354\227\220\332/\001c\237\004\237}\022s\373$\324\354\223@\333'\361d\237\204\221}\022>\366IH\355\027\341\331/z\263_Df\277\210l\277\bk\277\bj\377\003\345\376\007_\366?"
+	.string	"\333\377"
+	.ascii	"k\377\003\253\375\017\232\366G\324\331\037\201f\377;#u\316\322"
+	.ascii	"L\021\331Q\355|\230H\265\235\246\325C\271#\262\373\261\335>\270"
+	.ascii	"\200\"u\307\313rkWd'd\247\265\033\202\223;\"\273\254\343\261"
+	.ascii	"\223\317\226\035\221]\020\224\313\r\b\352%u\307\313rGd\207\245"
+	.ascii	"C\371\276\310\336\026\0314/<\375\021h\373#\252\354\217x\262?"
+	.ascii	"bk\177\004V\217\262\2665Y\336\254?\"j\357\330\351\300\311\035"
+	.ascii	"\217\235U\332\356\312D\252m.Z3\224\357\373\356xl\261]\225\226"
+	.ascii	"\f.\225\316\221\035\250\316A\324"
+	.ascii	"+\202\365\004H\326\027ag\037\277\361\331\341\330\331\300\311"
+	.ascii	"\335\215]\215\335\r:\251;^\314<ee\224\250\276\b\261}\021FvU&"
+	.ascii	"\332Z\003\256\215\216\254/\002\307\376w42\216\251'4Y\377\273"
+	.ascii	"\251\235\224\f<k\322\262\336E\341 P\304\\\311\372\"\234\366\316"
+	.ascii	"\305\216\211\213\23546<\330\212\026\267e\216\312\262\363`9\373"
+	.ascii	"\234q\355f\354d\354\232vO\273\030;\250\035\214\335\213\235\023"
+	.ascii	"N\356\\\354>\337\275\370l\355\316\026%\335\346\203\341\256\f"
+	.ascii	"\360E\226\266s\261\347r\324\016)9\257\257\367Eb,04[\033\364="
+	.ascii	"`\333?X\b\275\007f{\327m=8I\264\367\234q\232\352\221\365=@\356"
+	.ascii	"\020\274\230\b}\037L\204\336\003\260}\017\234\354{\220d\337\203"
+	.ascii	"!\373\036\354\330\367\300j\337\003\250:qxO\302\270\320\262>N"
+	.ascii	"\203[\242)\021g\253q\303u\246L\216r\263\343\266\234\375f\267"
+	.ascii	"\331t6\233-\267\347l8[\211\223;\316^\363\226\346-G\305\331a;"
+	.string	"\013\206\333\322o{\266\230\311\243\214\263\265l7\f\267\225\302\035=kqv\f\370M\212\215\327\027\236\3616\346\214H\277\003\266\375\016\262\354w\020\266\337\001\223\375\016\264\366;\260\261\337\301\323>\007s\373\034\264\331\347\300\255\315\003/\313\013,\260+k\233\fNn\266\215&\266\267`\270\255\024\300\3326\333N\333c0\334V\n|\334\364\2239\2629T\213\311<\031K\261\254\317A\0220\333\313\376\262\273\340\344\016\263\271\234\245\251q\t\203\306\025&-\fS\bWR`a@1\262~\314Q\365C\344\331\017Qf?\204\230\375\020\310\275\267`\254\267\303O\r+_;\276\260x0\305\312\224i\222\365C\0201\333Wpr\237\355\261\357\262#r\224\373l\213\265Q\242N\352p\251B\365\361\033r'\267\225]\005'w\331\311L\2648\\\273lS1\321\2322\020#\325EE\024\"\304qlH\335\326\027@\335\276"
+	.string	"\346\366\0050g_"
+	.string	"f\366\005\320\266/"
+	.ascii	"\263\375\357)\337`mfh\310\254\245 \237b\230\201s%\353\013\300"
+	.ascii	"k\377\337P\366\223\355dw\355(\333\013'\367\327\346bK\262\227"
+	.ascii	"\230T\2506\027'8\312&K\256\027FJ\354\257\315\344\215\362\210"
+	.ascii	"\034\256\375\265\221\244lRG\226_\357\213$Z\345\212\370\030\363"
+	.ascii	"\243/\200\247}\020s\366A\244\331[\t.33R\227\365A\240\355\203"
+	.ascii	"\250\262\017\202k\037\304\217}\0200\366\277\267v\2210Uq\346\354"
+	.ascii	"\"_\207\250\2355e\375o\"\373\207\033\030i\350\262~fz\267(q\354"
+	.ascii	"+0\345\323\031\327\030\227\013&-.6\224\026\231R\306\226\022\333"
+	.ascii	"Cv\220\315c\373\330Z\033kgm {\307\356\261\205\340\344\376\261"
+	.ascii	"u8aa\263\3327\234\246\354\037\273I+\313\376\261\247v\225\022"
+	.ascii	"t\031\325\007\314\362}\221\246\022.f{\210\3647X\263w\016-/,\037"
+	.ascii	"Y\177\203\265\375\r\270\324\3306\266\022+nW\312jL\241\261\251"
+	.ascii	"\216\274\260TAB\003k\306\216:\323\2201\013\223\3657\260\232\261"
+	.ascii	"A\214}\r\352l\030c\216\314\311\221\3655`\263\367\013\r\326\366"
+	.ascii	"5@\356k\300d_\003\254}\r\246\3663\320\263\377\264O\312'\311\006"
+	.ascii	"\326\224u\232\356I\227fj\360y\222\365\361ZJ\247\356\r\245Z\272"
+	.ascii	"\331\311\303\225.\323:tz\322<)]Z\227\342\301\311t\231\336Y\246"
+	.ascii	"s\004x\213\222\263\\\276/2\273\311\301D\006O?\003-\373\031$\367"
+	.ascii	"3\370\332\317\300\311~\006E\366\237\316I\345\210\320\260C%\353"
+	.ascii	"\227H\345R8\\\344\244J\234L\345\3228\031\371\276eEr\351\2336"
+	.ascii	"&\262;\313\324\006\0322U\250~\006<\3663\210\261\217\201\235\375"
+	.ascii	"\247n\236\246\210\321:k\243\351\306\244t@e\375\247qGhL\211\313"
+	.ascii	"\372%\316e\327\026\264,\312\367}\323\270`Qn\031\321E>\230\222"
+	.ascii	"U\304k\031&\226\222\351P\026\235tYE\274\226x\226g\016\223\n\025"
+	.ascii	"\003\222J\224_\276\266\256N\036I\266\216L\261Zc\362R\224R\241"
+	.ascii	"\301\245\226\216I\271\244[R1i\231\324J\272\226\242\245ZR"
+	.string	"2i\232\364-MK\275\244]\3225\251\232\324,\305\222\202IcH\315\244g)\\\032&\375\222^I\263\244l\3223)\232\224-u\303\311\264-\255\3624\231\226!S2'MZ\206\224.bR\241j\200S\233\233\206!\3265\207\247Ni.\315:\375\202 v\246\210\3272mK\245P\351\300\t\235\"^K\2659\372\016\005Q\232\212x-\301\316\244mZ\212\316bR\241r\200V\232\376\322\242\237d\215 \305K\021\257\345\334\0353\017Y\226\206\322\246\243\350'#\274\240\332\315H\256)\337\240\016\220U\304\353\313\\\232tdVE\274\314e\233\216\201\351F\020\263*\342\265lK\3034]U\007N\252h5\345\024e\332\226FI\241\214\360\202\212\001\311#J\255\226\266\351/Z\316\n\204(g\322)^\212x-\315e\332\246_\350'\f\304\252\350\220\243\025\206\202\376\034$\036B\177\256\260\020z\f\342\354c"
+	.string	"\267\217A\227=\266[S\307\307Y\326\307\340l\037\003)\373\030p\355c d\037\203\035\373\030H\355_0\267\177A\233\375d\217\333\2300Y\377\002\267\235v\235e\351\222\021^P-"
+	.ascii	"M\fe\332ub\235TL*T\r@#C\2316I\235\244^8\231v\245L~\3528w\364"
+	.ascii	"H\273R\256\364\251j\204&]\3107;\354\250\331\372\027p\331\277"
+	.ascii	"\240\312\266\243f\206eL\326i\322\252\323\316\311\364\323\024"
+	.ascii	"\364\276Z\\\270\3164g\035\023\315G\312\005e\206\321OW\264\312"
+	.ascii	"\254\251E\201yY\322\235\313\032\217\024\307y\306v\205\354\234"
+	.ascii	"\273s\342\361\221\366H\253P=)\225I\205\212\001NrJ\375\302MZu"
+	.ascii	"f9\2734II\327rW\236-\312"
+	.string	"\367}\315\226\240aB\230\244V.\310\214!\305\300\235h\274\242\300\274,O+i\225\216\201\351>\270x_\254\037\251[\233~\322\221~E\201yY\246U\347\036TI\223\221\324\306\0136l%,\n\314\313\022\r\3652\005\245\213\002\363\262<\305T\235cr\324\007\247\367\375\341#\365\202\374\262\005\3252\302\013\252\335\024\2321\345\373\"\323*\364\013Z7\302\013\252\006hM9\305\270\235f\320\264)\3174\247\232\223\316\207\030\357+\004,\355\212\002\363\262<\261T\235^\3160\037b\274oV\222TL\024\230\227%\223\264\352\\j:\223\n\025\nh\320\224fi\025*\206Z\031\341\005\325\216\006\232\263tH\372#\335J\265R\033\251\220TGz$\305Jy\244HR\037)\216\024Hz#M\222*I\211\2445\322\254\324H\332#\r\222Z\245E\322\253tG\232\003'\323*M\347g\2253\271JiR\322 A\323"
+	.string	"\322\221\365\303-\353_\020e\377Og\2442\322\250T\n'\323\251\024\352\347\225\323\354z*}\221\302\370y\nz_-$\351T\332\224>\231T\250\266Y2\2112,\235Jc,\341\312f\322)\224O\312\364\301\305\3736\371@\331\242\300\274,\337\367\255\243\244l\215\252\177\301\214\375\013^\030\1776\223\272H\237t\314\251\223\314\372\026\344\331\371\305C(\210\324\t\t\304k\302\221\026C\326\267@\271o\001\233\375\247\357St\317\311\204\261xK6/(Y\243}\212\236\276\023\240\205\351\222u\212\205\320["
+	.ascii	"\267M\013\332"
+	.string	"6J\007$\244H\223\232\254o\201\226\r\006\035c\"\271Pp\232\272\203\346A\361\340$\272|B\227\350\032\ng\204\027T\017p\222R.\321\271\273\231\310&\357+\244\007\n$\252K\251\257l\221\001\262\365-\240\332\307ii<`\270\255\022\272\264\264\221\242|_$\034\224\f\212\346\203\023\224\nk[\326<\314\031W\034\030\033\020\030\356\354\204Z\230\362}\221pP7\017\363\363\024\364>-\371R\262\241pP5\0360\334\326\333\304\224\301\215\250%tK:\250\0354\016:\007\225C\225h\035T\016N\242p\3207O\347\025+\313:\r\372\025h\331\257\240l\277\202\260\375\n\274\366+@\262_\201\220\375\nz\354W`uf\013\223\334\031\032Y\277\002&3(\034N\2421\240mlh\031!q\270b@\337\3202\037\234\240\336&!\036\224\211\"b\246\275\261c\005\325\247"
+	.string	"\271\177\264\214\333\312G\314\007\0377\264\355g\214I\224\220\254O\301\326>\005A\366)\330\261OA\215\215\2169\016\263\001,1\332`d\215\206):*\306\305V\224U\326\033`!\364\024D\355S"
+	.string	"\003\355r|\"'\310\0345.G\224m\270\262F\2710\275\321\302\306\315~"
+	.string	"\320`A\263\234\355\236\334\300\002\007\r\313\321\2635aiw\262F\317\314\271\037D\224 \311\256np\251\202\226a\257\272"
+	.ascii	"l\355\343$\232D\253\244Oy\252\274Q9Z\345\tO\221\203\006O\326"
+	.ascii	"(\031\212\334\\4\230\\ \353\254\265\361\3311\266\233\243\306"
+	.ascii	"\314\326\230\2116\244I\332\224\254\037\200\035\273\213\3104{"
+	.ascii	"\222\222\365\177\024\f'\321)(\223\263)(\027*\005\313\027<|xo"
+	.ascii	"\214<]\264\376Q)\350\327\324\224\022*k4\312\316\315\306\r2Y\177"
+	.ascii	"\2027\373G\237\340$\nE\016\210 N\254\262\376\034\352\365\177"
+	.ascii	"\227\213\250\221\243\313\032uB\365\232\351\310\272+\225Su\246"
+	.ascii	"J\326\237\200\314n\2022\311A\232\322Te\375\t\304\354OP\266?\001"
+	.ascii	"Y\2227b9\256"
+	.string	"d\375\t\234\030A\217\340$\212\004u\372Yw\3529\021\022\311\331\007m\372yB\276Ui\233:H\320'\264\b\206\273\nz\237\344\354\301W\304\360\241\203\352+T\b\034.\"\350\020t\013'\321\"G\213\240.\320\251\037\246\f\357KD\017W\021\224\006\212\303\n\225s\222\363\303C\210\020k\324\020\037L[g\241Z8\211\nA\203\364@\2610\334\025\362\265\372\321\242%\347\307R\b\252\003\345\361\301\t*\0050o\224\373\313\0210FP\375\t\212\354\037\305:\n\244\027\203\213\0236>\320\037\352\215+80Y\177\002\036\333\307\361T\023\027mY\177\002\253}\234|\034t\307\345h$n8\304\262\376\004R\373\023\274\330\237\240i\277\004\212\003\245Bk`\270\263\023or\224\350\r4\007N\2428P\033(\016\364\005\233\234\362\207\211\223)b\250\276\004w\266\216\362dV&\243Vh\325\333\353\311\361\021\306+\353K"
+	.string	"g_\0025\373\022\304\200F\241R8\211N\2413\216\307N>'B\276\357\026t\n\205\201\312\370\340\004\205\342\007]\030:\205\276\300V~\230\220/\215\225\211\0239?R!^\310\216\240\372\022@\331?*\003\215\241\003\nM\017\362\034s\225F\t\n\205:\271\221\361\312\311\372\0220\331\227\240\310\276\004?\366%\270\261/A\f\224\311,k\354+\353\177\350\203\276\037\360l\374\241\316\306H<\204\022\305\331\377\220f\377\203\333\3063%c\251\351y\201#\353\177\300\262\361\207\261\375\017]{\016P\r\037fPY\377\203\217\375\022\232\317\031gR\241\332Y\212,Q\236rN%N\236rg\033\271\323\315\031\007\303\235\275M50\230\253C&\206(D/\313\262\016\007\252\337\234p\200f(\201\201\304\314\0330\373"
+	.string	" \333kN6\331\312\312\021'k\2606\246\302Bh\f\347\031\214\346\016]\214\254\017\200\252\030"
+	.string	""
+	.string	"c\2279\337Ld\032\2313y\312\304\331\217"
+	.string	"\315~\004b\366#H\356G\340d?\202!\033ca!\364\004\003\004\267DLZ\326\217"
+	.ascii	"\307\371%\202\030j^.\310\274\262\276\207\271\375\377L\303\311"
+	.ascii	"\223\313\251\345\344rn9\3210\334\331\373Vu \245\006\221\265"
+	.string	"%\346\321\346dFk\264k:\2656VO\262\276\207:\373\036\314\354{P\333\230\213l\237H!\024{\210\262\205\220x\b\315_X\bE\256ll\242|d}\017C\302\316(\347\224\237\335\373f\355\341\n;\265N/0=a\347\223wDW\021\257/\262s\354\024\303\3113\354\204\362\363\307\t\204\310\0025.\344\326\347\327)\005'\037\346\004\333=!\3372#c\230\214d}\017>v\213\367}_\3740h\3720\350=H\355\023\325\355\023\341\361\372\317 g\326\351\344l#\273R\313\272K\217S\235&Y\237Hn\277D\021\"\347bR\241\342 \003\315\f$\017cR\241\332W\264\242\224CN&g\222s\311\311u6\301\311S\311\271\365\323\310y\344Tr\ny]\224u\320\304\t\221\265e\210\364\307\23155\236>\221\332\306Xx\b\335p\266ODe\237\bl\237\310\311>Q\222}\242\255m\302\341!\324"
+	.string	"=\266\336\202\205\320\314\205\205P\223\210j\023!\361\020jBa!\324Db!\024\307\005d=\234\262>\221\323\256\213\343\312aU:O\225\346sNa\2703\2554\243\354\252:\251\334X\2356\316\033g\r\234<\253N\032\032I\031\344\225\252\337A\317~\007\271s\352\327z\364\236S*\343)\357\224\257\254\243\260\026,J\251\254\337\301m\237P\347{2a\270-\r\326\244\351\232N\250\323I\323a\2703\r\205\213\362|q\3028g\2342\316\0308yB\235Og\232\355\204:]t\325\331Y\276/r\013y\341D\bO\277\303\221\375\0169\366;L\355w\200q2\335D\303\251\025\030*^\262>\207\272}\016r\3669\0049\rH\026T\217\b\017J\222\034q\200d\335\023\322\023\322\244r\251\320\373\361\243\227u\rMa \310\\\331"
+	.string	"\361\367\200\274\227\325\013\342\305H\2376\275 =,\265F\033+aN#u5\266d\375\271\235\276\321eJ\231\254\257\302\220\375\367|\250qXtlie\215\f{_$\020\217\006\r$X<T0\252\224\2506.;V-z\210t\255\365t\360l\220\301\330\362\344\212\027\003\b\016:aY\333\260\321\303\001\345\306\231\035_'\024\253.Vz7\336\303\321'\006+n^\234d\271\250\223\365\033P\307\312\n\307\215\261\267\257,;\270\206d\375\006\\\351Q\365\250\322\267\033S\240\250\021C6\226\365\033\260c\367\246zS\253\023\",\246;)\216\033`6\226@A\336/y\262>\003\334\364\242zQ+\217\rt7\272z,\201\352\344\264\320d}\006|\351\311\350\311"
+	.ascii	"\301\215\256\036_eWC\314d}\006\220\365\240zPj\334\217\230\033"
+	.ascii	"K\356l1\035L\230\262>\003\214\364^\364^l\320s\243\253\007\036"
+	.ascii	"\243\343\214.\353\243\250\353=\365\236T\245\r:\266/\215%\314"
+	.ascii	"lI\326G!\327k\3525\251qDXLw~\326n,\271\263t\201\343\206\222\254"
+	.ascii	"\217\342\212\036=\275\227\b\213iN\375\222:\262\\\362hx\231\301"
+	.ascii	"\322\347\275\367\324B\346K\032\237\374F.G\032>{\322\230\361\021"
+	.ascii	"\266\267\274h\350\310\372(\272\346\346xtDXLwT7\251#\313\345\217"
+	.ascii	"\036\260*r"
+	.string	"\362\234G\207D\206X\024o\311\203\352M\232%\236a\231r\rmC\r\261suG5\353\341x\001f\226\365Q\360\220s9\274:7\237\336\037ST5\251#\313\245\326\234\0132\271\363\352\360\350xy\315\350\314\201c\303\221%\305\303\031[\225rs\001 \016\324\030\017-\206+hY\037\305\0137nxp\272\244\216,{\\\326r\264\2759\017\016\230V\027\035Y\177n/\371\277\313\340\202\211I\326Oa\216w\206w\206\027\207vIuQ\245Q4\262\306\2609/nW\344\212\255.k\036\032\336\232'h0\266\326\360\324\270"
+	.string	"\213b\203e\363"
+	.ascii	"\313\261&\315\036C\353\304)i\313\372s'\232\377\273\004d\251\211"
+	.ascii	"\221\365S\350\002\007wg\t\216/U\262~\n`oo+\017\354\305\306\233"
+	.ascii	"\035z\310\227\f\263\254\237\302\02066\236\233\035\033tl_(\026"
+	.ascii	"=L\262\264\235\347\326\233\263\0027\226B\325\332\032O\f\216\251"
+	.ascii	"7^HppA\243\004\003\206'\206h\277bC\242\224@b\334\034\211\013"
+	.ascii	"s\236\030 \247'I\320\324\324"
+	.string	"\324x^vL\275\361\372B\325 \363\250\351r\236\227\353\221Bv%\353\317\251N\377w\275\2578jtd\375\005t\361\266\360\266\360\322\210\260\230\356\240K\033tl\313\364\314\221&?\320\316KCC\266&\216\354\377\016}\243\241\207.\353\243\260\247\254\214\227\205\b\213i\016u\263\201\307*gYU5\361\260\234\227E\216\032\026\221\254yVxg\377w?K\250|Y\236\361\314\300x\371r\n\362\343c\216\023\262+\331\306\216\006\027\217e\326\237K\335\374\337\235J\2202\356d}\024\314\300\316C\202\361\252\244`\210^\247\247\367\207\021\241:\033t\336\226/T\017\020GD\200\270Q9\257\212\033\332\307\212ZV\326\274\261\363\310\376]\312FM[\225\254\217\002\215\315\013;O\354\337\235<j\274\361\312\372(\310\330?o\312\277\343m\271\275\321\311\372(<\355+`\317\376\372\372\351ac\311\230\336\323\245\243O\326W"
+	.ascii	"\235\215\315\260\031\017\n\256\362\322\370\001\263!G\355\013"
+	.ascii	"K\214\2273\274'\347A\271\034m\004\316\2157N\234\340;Sttzy\314"
+	.ascii	"\212pe}\005Hi\322\004\217\331x\263c\307\360\322\246K\326W\200"
+	.ascii	"\r&L\304\330`\263\246\262\361\001\307G\326?Af\353[<%\270\312"
+	.ascii	"K\243\003A\310\356|\321a\033\"$\311yJvJ\346\226GxH\336vX\305"
+	.ascii	"!\341\035\211\2731\265\304\204\202\"\216\330\030\236\221\254"
+	.ascii	"\207M\311Z\235\254\177\242\013\021\"*\037\033h\326\316,Pp1d\375"
+	.ascii	"\023C\204\bI\255l\234\371q\356\240*\323&\317\217\377\340e\341"
+	.ascii	" \244\023\0320\256\033F\276\222\0049/\353Z\217\221\036hY\177"
+	.ascii	"\216\207\365\177\227J\221Ce$\353\237\207\305\003\322S\312\211"
+	.ascii	"!y@6\232\207\324\nn\f\2144=z\334\221\272\343E\225\252\002\233"
+	.ascii	"\021f\307\016\264\207\215)\313\257\367\275\002\301+\353\321e"
+	.ascii	"#\353\237\300\204w\305\273R\343p\225\227\206\007(6\300\330\226"
+	.ascii	"\357{\005\302\314\001\006\331'\353\237\360\204\003\007\231\235"
+	.ascii	"R\215HU\3267\241\316\376y5~^\r\236"
+	.string	"\215\024\202\336W\213\206\332Ku\305\301\312\265\245FClK\230.Y\337\0048\336\214\363\252x3\326:*^\354\310\222m\312487%Y\363h\360\250xS<)^\224\tZ\360|\335\263\362Y\373\340\344\212\207\027\343tz\233\224\244`\347\r\263\032\311\254\241\316:[o\234d}\023\304\366\313kj\343zy.x0p\222\367\202\347\364\225\317\332\207\367\202\367\304k\372aB\276L \270Y)\363\226523\250\276\tM\366M\320\332?\217\351\274\246\377\300A\201\262&k<Vt\036\223\232\246\234B#\353\233\360cg*<\204Z\200\205\320\265n\325\263\322\255y\326\245\tM\373_\347\3269\025\f\210\240\367\325zS\373\241\224\303\224\365M(\321\276\212Y\321\326:(\025\327[D*\005cRiRU%k:i\023\2335d\262\276\t4\3738l\314J\006\216\222m]\013{S\242\314j\006\303m\225"
+	.ascii	"\305\214\022}\261\256}p\202J!\314\215\362\315\032\303\032\227"
+	.ascii	"\266T\256oV\267\2708\353\234U\271\312Y\335\254pV9\234\\\337\254"
+	.ascii	"p\353\233\265\255\215\022\310\316\024\263\034Az\035\3638\037"
+	.ascii	"\234\240R\030\223\243\\\331\254mpr\215\373\032\207r\255k\360"
+	.ascii	"\233\215%c\036B\364\350\244\211\343\201\352\177]\243\346g\013"
+	.ascii	"\262H\235\254\3274\351U\2166\027Y\337Dr\377\353\031\234\\\321"
+	.ascii	"\354\271\257.uY\177\356q\376\357\3261G\264\304\366Mp\355\365"
+	.ascii	"m\253Q\372x\313\372&\216\354\233 \262o\002\310\276\211\035\373"
+	.ascii	"&n\354\177%\263\256\225\261\331y[CS&\312)\353\233\250\332\353"
+	.ascii	"\2275\f\020\230\032\021-Y\177\005\363\177\347\200#f\264d\255"
+	.ascii	"\275\3446&\\RY\177\355\362\023\267\004\013\225\254\277\252i\351"
+	.ascii	"cGG\326+\227\375\302\204\323\006\252\2174 <\322\276r\371\327"
+	.ascii	"1\234\005\206>{\360d\235\235\212\276\246\275\211Q\222e\375\022"
+	.ascii	"\342\210}\315\262\212\255ZN\247\267iI\272\326\203\203UJ\212\232"
+	.ascii	"\027%P;\336\262^\257\254g+\226\177\267\373\022\205\246G\326/"
+	.ascii	"A\315\376j\366\177\247n\235Q\362$\353\214\037\006]\313\276Z\371"
+	.ascii	"wi\030\325\023\226\254_\002\334\376ZeM\376;s\217\333\227\030"
+	.ascii	"Y\277\204\265\375\225\312\377]\b\336\004\221\222\365\212\334"
+	.ascii	"/J\300\262\301\316M\2258H\310\276\"\217\303l \212\307\225\\\326"
+	.ascii	"\353X\321W\262\314\344\254\255-\353\036\026B"
+	.string	"_B\222)SF\330\340\202g\316\236\254_\302\216}\375\204W)R\226%\314\210\022E\215\013S\336\200Z\342\"\317\223'\"\320\247\2654\260\254\237\2005k\223\265\311\352$\257E\321\241L\241\230f0\351\302\311\325\311\024/\310\034Y\177\016[\371\277;\265\356\300\341\022\206\t\223\225\3071U\027\021W\253\2233w\312d\375\004\230\255JV%\006x\322\347G\f\356\312,\353'\340k#A\362*;\340\243'H\326O\200\220\"EV#\017j\n\261\304R\367\242\315\272\365\325H\336\362\005H\224\254?\247\237\376\357x2\254\276\374\310\372\t\270Z\207\254C\250B\260\315XB\201\313\372\t\210\n\262j\005Q\343\320\367\305H,\032T\357\025\025\210\254\254&\016\324\324\027Z\312\310\262>\002\344\366\021\240e\377+\220\344\nD?\231\357\373\243\007j\007\311\301\021 \346\303\207\032\367\240\030Bt\231S\340\\\340\310\372\b"
+	.string	"\262c\307\312\243\313\006o4\300\250\226=8o\336-+\217&N\264\242\262>\002l\354\177\275\201\223\353\215\365\n\004\326[\243\350m\212\216\216\322\n\225\251._\257\376\025\307\232C\325\362\022\005y\225\265\212\304C(\336\262\263\377U\n'W\251\265\306\356\351m\312\222rM\275\361\002\372jsS\256U_k\374\353\324Jc\265\312i\0166J\310ht\315\362\253,\353\225\252\350k\325\252\245m\017\223\254\205\260\020\272\341\305Ch>"
+	.string	"\227\375\2573\216\223\353\f5\315\371\3646!AwL\255\241\003e\212\233\253\254\177"
+	.ascii	"\262\375\2571\216\223k\f\325\314\356\351mJ\222\376\210\352\003"
+	.ascii	"\306\007\233,K\262\376\001\226\2540V\030?W\007\320\261\377\325"
+	.ascii	"Eru\241\226\001\201\365\326\310@O\224\234\345\0255I\330\262\376"
+	.ascii	"\001\234\366\277"
+	.string	":%W'\265\r\004V\223\325\007mM\346\244\211\201)\353\033\200\316>\226\202W\246\343\344\312\244\351P*\031\257V\325\0058^pp\003\3649N\252}T2(\025~_35Q\312\367\275\342\340gO\026 i\262\276\001\320\354_\335\223T\367\250c\352\234)\342\265\304\0037\303\251K]\235\032\207\337\367}\257^\2469\026\354\240\001F\365\265\311\246\240\231\373\312\223G\215\303/\325\373^\035\300\n\023\345{u\005\002(\t\034\254\257$w\356\250x4\274\357\373r\245W\254\034Q\356\220X\226\310\341\241S\221Py\021$\353\033"
+	.string	"\207\035;*\235\024\336\367e\nz\235\324\370\340z\257\256@\364n\264\031\202\304\316\2349*\235c*\035*\216+\020\372\351\r\034\"sW\351`+k\233\252/\261\254_"
+	.string	"\266\375\253rIU\316\374*z_!@P=k\034"
+	.ascii	"\031\241\021\005O\326/\300\331\376U88\251\302Q\343\200\300z\255"
+	.ascii	"@ C\205\354\316)'\307\217\272\254\343\230Q\360\276\263\2242\225"
+	.ascii	"\365\013\300\265\177\325\315qRu\243\202Q\251\336WkG\n\206\352"
+	.ascii	"\212\003\240)c>\314\262~\001z\354\253j\3245W\331\\e\243\306="
+	.ascii	"\350}\337\225\212\006\030\325\362\275\242\002\361\177\016'\325"
+	.ascii	"\270\363\214\327\222,Y\237\2049\373\307\317?\3726Q\275\357ku"
+	.ascii	"\"_*'\036\372\343\343\023c\020\177\017\233\330\202\377\332\374"
+	.ascii	"\017P\246\204\367\375!\007\353}_lg;\341\322\304\203\202\367\377"
+	.ascii	"\337\341}\337*\250\247\227\tC\225eUA\225eQe\200r\313\252z\237"
+	.ascii	"\252\276\236\262\2600\324S\026\025\325\323\313\224\341-\313\242"
+	.ascii	"\202z\263\252\202\336\2627\007TY\023\023\206zz\253\3367\353\r"
+	.ascii	"z\241\232\252\3362$U\006\250\262,*\250\262\254\252\fPeMUP/\326"
+	.ascii	"\033\004\205\024B\365\"\263\2302\314(k\252z"
+	.string	"\313\260\2522\274eYUPuO\230&\210\223F+\016\230'12\230\n\324\323;%\325\243\211*\b\016\n\211\365\306\275/>{\361R\275p\357k\301\373\366\300\242\212k\312\201\325\234\340\246\234\2664aa\344\373\276\036\244\234\264\260\336'8&\374\302Aya\275\257\227\023\322+\365\276\357\013\002\023\022\3565\202\341\230\204\364x\243^\274o\004/\362}\245\336\227\t\277p\357\3732\275\357\233R\365@\276\357\216 (.)\251\367\275\"\222z{0uy\361\276\371\314\215Z\025T\231\026VQ\227+e\\/\f$\023\206\212\302z\271\336\270,\252]\306D\345\215z\337\027\327\331\\U5\350d\255\242I\243\324-\241\223\365I\240\202\334N8\316t\311\032\231R\221S\003\22352\007\330\234'Y\253o[n\240%\263>\tO\266\352\366C$\307\217\251\254O\202\220\255\262i5k^;Y\237\204\253\255\256\305"
+	.string	"F,*\353\223P\265U1Y\311\004M\fY\237\204\247\215\\\325~`\261\221\265\372\305\212\355MH\326'\300\234\232\332e\243\3113\244-\353\023"
+	.string	"N\215\3548\251\222\251i\230\n\277\257\02651\224\311)7sY\243mi\003\305,\353\023\240\313\376\257bQ\265\250YpR\335\242\232]E\252T\324-j\225=\312-j\231z\305\244B\345"
+	.string	"'u\213z\246G\352\310\262\367\306\300\202\333\372\004@\356\023\240\211z\345\317]jR\265\222\257\22493'\315\2178Q\262>\001\206l\224"
+	.string	"46\212\205\207\320\247\301B\350G\250S\305~\356\314\230\033\223\365GX\263\3250\260\343\244\n\246~\235Oo\323\027J%\305\006\205BelG\326\037\241\313\376U)\352\027Z\021\255\254\254\325(8\260\352\226d\375\021\250\354_}\202\223\352\023\325\t\b\254\267\206\007^Rr^;6|\304\244d\375\021\204\354_\365R\235\210YC\373\222\265\352\344j\023\354\346\006-K\355R\233"
+	.string	"\245q\315\311\225\341\262\2215r\303U\224\251\254\363\027&=jY\377\252\222\343\244\252DE\222\253\274L+\027\345\0321\352\334\0347Y\177\204\252\375\253IT$D\232\340\211\223\265z\004E\232\026\266\254?\202\323\376\325\255\343\244\272\245\0229\237^\"c\350\330\025\007k[\035\226\266\254?\200\270\375\253ET\"Y\244|\211\223\265:$\343;x\306zd\375\001x\331\277*D\325b\242f\315,\353\254\335T\2303Q\262\376"
+	.string	"\306\366\363\013\253\033fr\270Pu\250U\330\212\033UG.\313W0\334\225\366\202\243Tu\2504T*\f\267\245\303\336(q\2506~\314\367mz\343Ru\2505T\033?L\310\227\t\253M\321\321\371R}\250=\324\037j\020u\207\212\245\362P\201\340\244\252C\275\3125\252\364\020\323\240?"
+	.ascii	"\027\373\"\320\355\213@g_\20476~\275\206\335\260\225#\023\035"
+	.ascii	"W\262\276\bj\366E\350\262/\002\230JE\207\201\354(\241K\222\365"
+	.ascii	"E`\262\177uJ\225\022\ni\"%\353(\344\0268d\300\230d}\021n\354"
+	.ascii	"\227xU\247\237\247\240\367I\013\013\227\032c\327'\213\n\245\302"
+	.ascii	"P_\2502\324\0318\251\306P\237\266\250.T'-4\245\032cGg7gR\241"
+	.ascii	"\332Y\264\266(\325\030\273;;>&\222k\317p\322\242D\223<\320\240"
+	.ascii	"\361\364E\210\332\017\201\216\332\264\303\332\221l\312\372!\270"
+	.ascii	"Q\231B@\263\037\302\227=8\252\314\301\221\365C(\333\377wu;:\234"
+	.ascii	"\334\351\331a\344\373\"\363\210\355\364\354\360\240\313\2517"
+	.ascii	"^_g\362\253F\037T?\204\254\375\020j\354\207\020c?\004\247\235"
+	.ascii	"\235\254\307\f\233&Y\037\004<\273: \304\331\377n\216\211\347"
+	.ascii	"L\223\327I\223\022_o\270^L1sf\327f\307f\247\266K\333\215\331"
+	.ascii	"\271\355\344vq;\345\256\313\356\315.\315\316\313N\316nm\307\266"
+	.ascii	"\213\263\373\262[\263\003\263S\263#\263\213agf\347f\327\266\023"
+	.ascii	"\263\013\263\203\333\241\331\225\331q\331\275\341\344.\356\257"
+	.ascii	"84:\211\302\337q\027\001\221+L\022\252\220\201\027\374\025\207"
+	.ascii	"?\354P\305\317UZA\303\221D\370\330$\241KT\n\232p\333c\321-\266"
+	.ascii	"A\242\002\200\255\002\\!\021\305\221m!l\215,kB\322\321\310\262"
+	.ascii	"*:\264B\016A\"kl\225\332\241#\211H*\036\215,\353+\016UWH\\[\034"
+	.ascii	"\207?\342\2210E\222\221\205$\026,\264h\201MRj\331\343\206\024"
+	.ascii	"\255P\310G\344\220\"H\024\032mp\217E\026Z\b:\376\202\304\237"
+	.ascii	"\233\"\251xD!8\024*\251\270\200C\213\"\005\360\270!\330\242\020"
+	.ascii	"r\211l\313\036Y\240@\205V\030\200\025\330\025\305$\366(\301\221"
+	.ascii	"D\214`\335\2370\310&%\241`\215:\034\213nq\005\017\303\037\020"
+	.ascii	"\311\375%\215`Q<\"\271Ebj\364c\207\332m\211E\340i\344\022\205"
+	.ascii	"\307!:\034\232P\217$\"\370+\0169\034I\304\021Q\310\002\260\005"
+	.ascii	"WH\024\376\002\340\022\331$\267U\342@\320\004\033\201+$\242\b"
+	.ascii	"\n\215\037\\!\021E\013<\376\034I\004k\364k\207\302\237Q\317\204"
+	.ascii	"\313\266\033Z \360\367s$\021JI\302\021\354QI)I\310;\222\210\026"
+	.ascii	"\305\021\3066)\210\242E\321\004\326\025\022\205AK\306\342\tA"
+	.ascii	"\0326\270\016X\372\r\215\2550\270\266\276\036\233\364#\352\342"
+	.ascii	"Ph\004\300\222\261xB\006\367H\"\216\214@\242\022\n\353\331\372"
+	.ascii	"\216\214<\327G<2\236\304#\243\211\344\036\021\331!\312\302 l"
+	.ascii	"\365\222\261\b\324G\327h\276\267tt"
+	.ascii	"[\341\021\333\302P\220M\203l\253\244\333\364?\367\027\364\035"
+	.ascii	"\031E\374\030\223X\027\\\266e[82~8\312p\374\t\262G\241R\007\330"
+	.ascii	"\026Zp\217J)Z\241\206 "
+	.string	"a\357g\311H\350\026\035\020$\232X\361k\205\326\017\037\210p\217?\243\210\240p\370\223@\213\202=*\245`\217J-\221\275`\311=\nO\264(zE\027X\241\2210XL\"F\200u\205G\026\022\254\360\200\026XP\200\002\002\200\001P\320\206\241\240\022\"\210H\341\004\027&\220\342\204]\361\270t\2443,\240\205\020\205 \321\004\353\376\202\302\341o\005\321\272\302\320\t\025\234\340\262G\036Xp\211\354\361\250\004\314\320v\020\372\317\201\302#Kd\217\366A\020\301\003\021Fh\221~\004\022> \341\003\364#\220PTD\202\bE\373\"\024\231\256\353\272\256\353\262\276\366\3507D\201\035\252\370\265\302\023\277\r\356\221u\201\277\343\017\t\350s\213E\025\3541\250\375i\215+\353\376\202F%\337\220\020\353Ca\303\006w\351w<\232\370\240\301Mb\335v)E\004\256{$\021#\200F\030\260\356\257\005\241\226u\177-"
+	.ascii	"\217i\321\330B\001\300#\332\262\356\357x\262\306%W\210\203\352"
+	.ascii	"\026]\b\262/\020\205\303\335\372\202\304\342\t\304\242\0134\301"
+	.ascii	"\006\213I\036X_\020E\213\242\2124\210\202\r\026\223\320\026J"
+	.ascii	"? \027x\034\00142\262n\212 \221M[\037{D\374\265\360cd\335\024"
+	.ascii	"\356\361\347\266;\366\210\370;\236\254o\005\n\217\212*\260\301"
+	.ascii	"b\322\356H\"Z\034G\034\031\205\216\252\361\227\004<\236A\266"
+	.ascii	"\3051C\013vhT:a4\374!\251lPx$\n)\360\035)\r\215D\031\\\266e\217"
+	.ascii	"A\242P\205\317\375\265\276$\245\243\373\002kl\001\300c\207?\240"
+	.ascii	"\352\036\331\025D!\360\030\024&\235Da\322n\361K\332@\355\t\303"
+	.ascii	"\337\nbQ\210\002x\354@\024\002\331V\251\305q\035\262D\342\017"
+	.ascii	"\t\350k\241\364\363\265\370%\001\265C+k\\r3x\230\300U2\022\205"
+	.ascii	"\035\330\025B\367\267Bxd\203\037\212\256\322\317wD\024\002\217"
+	.ascii	"D\301\242\360\310\032}I\277\243\221\017xl}\302\266=z\b\n}\256"
+	.ascii	"\220\250\324#1lql\201\334\366g\344k\225T\264?Gb\353kq4j\217C"
+	.ascii	"0 \001\201?\025\b\374\361\212G\326\002@\340/u\215\330\240\317"
+	.ascii	"\355p$\021\026\264J>$\240+d!H41\034\026\217BG\326e\223\212Gv"
+	.ascii	"\310\002\201?\r\356\n6xd\004:\201\236\255\222\tBc\213\036\375"
+	.ascii	"\\ \266@\264U2\001HBh\002HB\250\262\351\356H\"$h\177\306\244"
+	.ascii	"\"\020\210(\034\002\331\240Kd\223\216~I=\337\321/\211\267\376"
+	.ascii	"\370\200$\204\276\243_\022\320\017\261\005\372\204\306\326w\364"
+	.ascii	"KZ\217~.\270F\245#\317u}Fl\320\303\221DH"
+	.string	"\020d]vhL*\236\260\241\005@\313*\r\177+P%_\233$<\272pb\250xd-p\364KJ\335#\211p\211l\322pX<j$\240+4\236,~K\246\222/\003\213\337\321t\211lRR\321m\225\200\276\243_\222\220{$\021#\212\302\016n\007\r/\264\277\025\210JF<\326\347\036\213,\f\177\302#\333r\020\252\3066\311\375\035\203J?\025>\016G\022\321\032\217F\024\205\033Z\343\321\312\372Xh\215G\275\342\321\270Y\237\312\006\213+\264?\025\355f}@EW\351\247\262>\023\255\361\250\027T\372\231Pt\225~\273\310\016\205\303\337\221\217m\225\206X\037\033,\256\260\262\301b\322\017\013$\026}.QX4\372\330\244\"\222\317e[_k<\352\020dYc\353\013\226\360\261m\320\222+<\036\265?\025\355\217\273\302\350[\361#\302\200T\034\252P\362\265\306\243\fG\022\021\200\026E\025/"
+	.ascii	"\177C\025A>c\n\004\376|\301c\021\310\036U6XL\322\304\242\260"
+	.ascii	"m\331\2431\251\b\\\203B\343\232T$\262A_\333\262\300\342\321\350"
+	.ascii	"\013\n\215\031X \221=\262F\354qC\213\272\354\321\361\347\376"
+	.ascii	"\270>\022%\330$\241k,\026U\3701:\341\204\2115I)\305n\002A\005"
+	.ascii	"\020Y\024\203\035\212\\\340\035ID\006g\353+\032\tQ@]_\033\001"
+	.ascii	"6I\350\3566\002n\313\262`\211\273E\213FB#\355\002\371\322#\211"
+	.ascii	"p\201JG\267%\321\372Z\260\256RR\206\027\200\305\241\317\207\272"
+	.ascii	"D\245\"\320\347K\217,\221E\321\347K\333#\333*\021}\276\035$\n"
+	.ascii	"_\360\371\320\226(4\266>_J,\n[\341\220\365\371v\256\317m\205"
+	.ascii	"\303\240#\211hY\343\222\353A\220=\376\220Z\017F\264\256P\305"
+	.ascii	"\b%\342\221\007-\224\210\302\241\007 \210\340\023a\204\026#\330"
+	.ascii	"\240\322\020H\024\2168\266J#\b\340\266`\211\303\0371\370c\217"
+	.ascii	"H\256\321\347\353\260\202=\032}>\324m\205C\237\017\375\271\277"
+	.ascii	"\240\317\207\372\320\027\200\305\241v\205D\024\256\220"
+	.string	"(D\211h;DD\241h$D!\370c\217\352\321e\001HTB\341\347\376N\004\177l\013\305\343\322\002<\020Q\350\035I\204\320m\301\036\331a\220\370KA\350\266`\205\\\242Qn}@\266\205\027\200?\025\303\341\357\004\241\333\202\315 t[\260\332m}Bc\n#\366\004k\\r\301\207\202\205\024+\013$\376\334\226(\334\256\357\001(4Q\310\002\261\005\242Bck\266\276\023H\240XO \201b\207\002I\b\315#\211h\225Txh}+\004\203\216\254\333\376\222\320\266e\217\301\340/eW\374\206)\224\214I[\311\267\202\r\266J*v\353c\201\302\025\354\211VI\305\312\372X\343\222\013\255\222\212\035k\\r[%\025i\253\244\302d\207?`{\026\217\254\005\366\t'L\260\240\201\305\257\205\023N\250\354Q\311\375\035Yc\022\353\256\356\221D(\031\223|\305\343\322\021\020\370\033\321\036\331\025\302cP"
+	.ascii	"\254\257\205\017B\370@\004%c\222\020\261(t\225\206\305\226=\252"
+	.ascii	"\255o\003\353S2&\255\356P\251e[ \026\205J\306$\r\254\217x$\034"
+	.ascii	"\376|?\304#\341\320\204\257\007C\n\r`\335"
+	.string	"_\013K\301\037\333\302\317\375\005wF\306!\317\3108\364\301\200\364\002\211\022\032Zc\361x\342\310\006\205+\204'\224\214I@G?\027\204n\013\005\270D\024J\306\244\036\353\373I!\t\267>\243\221P\013\341\321\375\255\360\223\272\256\217D\t\227(L\217\210B\242\360\227\304\266\320\262C\340\022\020\250\365eHRjM\367H\"Z$\367\227D\364%\231\255o\005\033t\333t\205\025R\004\207E_\022\232\202\005K\364%\241\307\337\n\023\270\222p\221\216\204,\013\264\365\361\334#\211\360U\020\034\026S0\n\207@\240\326\207\302f\217\210?$ \312\342\327B\253T\024\256`\217\306\265}\001\250\344\266<\224\370cW02\022\0067\013$\376\204\307\237\004\214\214\204A\036\261(l\225\214P\267\365\255`O\254`O\244`\361;\362\210\302\037\322\t\253K\242\315\255\217=\372\271)6\024\265\371l}l\360\007l\177'"
+	.ascii	"\035\375\334V\005\3626\f{Cn\006%\237\n\305\343\322\221\220\373"
+	.ascii	"\002n}+\353\376\334\366d\335\237\233\242\3105\376\374\f\035]"
+	.ascii	"\026\202\334\326\267I\020QX\032\032\215&8\374\270G\0221\202X"
+	.ascii	"LJ\"\261\224[_\360\247\324\001\241\212\237\017T\344\"\025\231"
+	.ascii	"\204\212\\\364\313$~\271\250E&"
+	.string	"\321\"\027-e\022\304\245\023@0\24404&\375R"
+	.ascii	"\201? \266\215@\321\205\342q\351h\307\006\213+\020\213B\027\310"
+	.ascii	"\272\305#\013\355/\205\342q\351\310\303\260X4\301w\036\021\205"
+	.ascii	"G\013\030\376\224N\260\255\322\006\327\327\202\r\022\205\276"
+	.ascii	"\026(L\372\021\227\202\276\016\255\260\205\211#%\025\354\t\024"
+	.ascii	"xDa\213\337\nFF\025\210K\301\335\013\355o\205V\330\302D1\350"
+	.ascii	"H\"\212\307\245\243\021\355\261\330\022\331\226\027\034\026\221"
+	.ascii	"Z\366\210\344\202Kd\223\330\025\305\025\212\307\245#\n\214\214"
+	.ascii	"C\037{\374\261\b\036\177H\031\216\255\221\017\351H\210\344c["
+	.ascii	"%_\321]a@\002\202\001)\250\250\210\204\017\006\244\r$|\256Q\261"
+	.ascii	"%JY\374\226|E \026\305\241\321\221]\361\200\027\200,\022\260"
+	.ascii	"\227\2015.\271\032N\250\020\016\177'\024\217KG\035\204\214>$"
+	.ascii	"7(d\321\241\003k\320\221m\227\206?\342\257x\\:\342\020d] \353"
+	.ascii	"\262'\332\342q\351\250"
+	.string	"\347jh}<\030\220|,~K?0 \371\202`@\n\376 \001\335\"\321=\222\210\240\3208\302E:\022\016\215\210P\300\255\317((4\242,`\024\370\004\016\n\215f\006\227\310\002\217,\013.QXd\301\250\024$\n'\320ae\361\253\200R\212\240\320\370\303\016\217\210&\206\354\nv\b\344\002Y##!\367\310\032[\260>w(t}\304\"\f\302c\021\211\250\005\026\277\245\fC\026\b4\301\272\277\343\017\261(t\205\301\343\217\305\261\210B\220e\215\206\\a\222P\005\025\006$\037\211\266\375\031Y\024\207\031\334\342\017k\\r\2034\264\370\r\331\243p\035\036\021\177D\255\260\305\257\003Q\370;\312\320&\371\202?\026\351\367B\2618\364\035Y\242\360wt}\305#\360\347\201(\374\035\005u02*\272J@\337\260xt\211E\240\257U\361\323\300\032\227\\\037\t\r0 \371\210B\030\220\222\216\254\033\334"
+	.ascii	"\203\360\370c\211B\025\\!\267-\026U\370\214\2146\233\364s\200"
+	.ascii	"q5\266>\326\375\r\213\306#\353\022\205-~I>#\243\f\2560I8\364"
+	.ascii	"\261/\b\215\255\317\310\350\347Xt\201?#\037\222[,&\265>#\243"
+	.ascii	"\240\242\261\005\353cW\034\225\200>#\343\320G\\\njh\211\2541"
+	.ascii	"\251\b\364\035\375Z\237\373S\261b\310\250\001\303\242Q\003\330"
+	.ascii	"v\250\304\302\260x\002\213\337R\317\250\001\300\245\023X\374"
+	.ascii	"\226\266\333*\035\221\\`\333\237\t,~K\275\016\260G#\037\333\016"
+	.ascii	"\225\214IB\237\221"
+	.string	"\221/\202v\351\307b\370\323\300\272\277\243o\351\007d\203\276c\361xd\203\330\341\260\b\364\261J\300\226=f \n\177G\033\330$\241\313\302 l},\212A\242\220\205\357\310\272C\241\221\357Xt\177+\330!\013\200\236{$\021#\216\214\034\216l\222\320\205 \313a\005{\202u\177-\360\202\210Ea{dW\020Q$\261`!C\022\013\026\202,\220\270\324\022#\300\266J?n{T2\201m\225zKG\227Mb\207\254\013\031\\_\332\036\375\\(\n\321a\021Xt\213G\026\334c\321\330\022\177G\0278\034\021\177*\\\241\tn\021\251=\301\266J@+\330\240\311*\r\177\022p\331\326\310\350\001\3540\210b\370s\205G\302 \007\2420ie\207\256[<\"\271-~Ik\220\370KJ*\002\211\302$\325%*\025O`\207E\026~\\\237\bE.Q\250\264\215\214*$\031[8\026\335b\322z$"
+	.string	"\274hd\217#\334b\3618bm}'$\261n\273\324\376\264`\203D\024A\241\021h\205\320\005\3762\260\301b\222\357HI\005\033T[\240\320m\205\356\317m}/\264?\027\b\t\350\nY\244h\213,\210\300\016\205F\305#\013\254\373;\016\275"
+	.string	",\016\201GvE\321\247d\004\366\330$\241\013,\360w\\"
+	.string	"\361\001G\226E\321\310\341\370C\002\352#+4\022\272D6\210\"x\374\025U"
+	.ascii	"\301\200\264\002\333\"\241\254\373sS\020\213B\367wT\322\300\272"
+	.ascii	"\277\026X\030\204IB\327\370\200#;T\n\262H\300v\310\365\215\340"
+	.ascii	"\022\205J\351\213\212N\240 \002\016X\300\006\2128\022\032\021"
+	.ascii	"\213\300\021D\341/i\004\360\330\216\020\021\301\021Q\230t4\361"
+	.ascii	"\002P\350\246`\207*~D6\303\377^\\\017\307\217\226\027Y\354\260"
+	.ascii	"Y\235\374,\331\324\304XS&#YR\027\246Fm\343\243\343\352\007\322"
+	.ascii	"\313\354k\r\232*\351\225e\232\325\031\225L\357\355\210\230\271"
+	.ascii	"\030\306\314\3302\347-y.=3T\270\336\367\r\342\271\261\203v\226"
+	.ascii	"\365W\370\352\221\351\221\351\225\301Tt:\030\223$\262\346\366"
+	.ascii	"^\231\2079_\300\261s&\353^\333\303\324a!K\223u\217\355a\332\336"
+	.ascii	"\264\200,\331\177om\275\332\261\325\231\023\033\2432\231\263"
+	.ascii	"\247\016\215\030^\227\324S\235\254\177\224L\031\361\001f\255"
+	.ascii	"\261\366Ab'\371\305\313\020\265<fz^\304\314\001\273\223$\353"
+	.ascii	"\343d\257\313\312\303\004:QC\324\3244\247\232\2141#\\\334\342"
+	.ascii	"\260\206De\375\002\375\320\241\241\201'G\241R\303\306\226\235"
+	.ascii	"\005K\034\032h=-qm\344\244\365\262\360\322t\031\234<{zXxp\340"
+	.ascii	"\254\300Ir\246\232\241"
+	.string	"\221\203\007\0333^\035\223\216\016\260\265+<:3\006=[g\254\250ix\306\227;Qe\275\267\006\2347b\262\026\023\353U\321B\200\267)::c\357U\241\362s$J\2163*\310\036J`\274\310zW\027Ou\326\220\251W\352\030\022&MV\250\001\005JoJT\224\367\246\364\300\252\310\350\200\001{O\312\0163(Y\242\360\22010\254z_\352\023\246\302SC\r\335n\322\244\347\265\322\275\347\344=/\023\371\256a\313\272\327eN\271r#\006\030\246#srE$\353\253\020\267\227,\3511\3311\275o\0365&<>mS\220x\262\276\nmH\220\364\222`\n\260\336\227\353ub\303C\265\222:\262\354%\341-]\310\202\322%\353\253`\266\377\336\221\355\246\352\240\312Q\304H\026P\0264jc[<%?\354\320-\213\250q\002\214\037\250t%Q\022\247\343\251$\005\363,\007r\016:\206\254h\033"
+	.string	"\323\024"
+	.string	"0hL \223\n\226Es\017\024"
+	.string	"\t[\260\236pP\245N\004%d\n!\021\201\031\004"
+	.string	"H"
+	.ascii	"\002\005\004\255\177\255\371(\272K\233\353t\225d\231O\2773d\300"
+	.ascii	"\376\234\375\220\314n\306\303\267j\030\t\312q\232\021n\240\341"
+	.ascii	"\365#H\036;1\224\3525i\231\343\323Jx1x\371T\024f\206Y\212\315"
+	.ascii	"\322\341\303?y \263.O\027\351\201J\227\341\203m\004$9\265M\334"
+	.ascii	"Eq\213\200z\232\207\315\025\312\345m\216\247\260(+\371\372z\033"
+	.ascii	"\3331\225\243\302\023\340b\352\217g\357\321\274\320]\256?b\231"
+	.ascii	"\312\254sW\263}*\327d\264-\0034J\202\343\357\201\306\177\232"
+	.ascii	"\035\017\r\301\fz\035\2310TbW*\034-\302\252\345#5yz^\305K\376"
+	.ascii	"\004\211\3111\237|\374\204I@\004<\317\273\365\236\247\210\260"
+	.ascii	"\214\0138\2330x4~fG\f\bP\262\020\301\222\253\341\211_XH\322\237"
+	.ascii	"\343\353\204\312\353<\252\016\2153YHn,\350\037\3619\032\f\272"
+	.ascii	"\005\001\334\016\226\2371\224_\004\204-\360\310\353A\244\253"
+	.ascii	"Zx\243\007\261\273R\343h\271\275JChk\017i\210\"\243\016e\031"
+	.ascii	"\266t\366O\326}\231\260YS4\034\004\353\233\362\234\247\371\202"
+	.ascii	"\231\350"
+	.ascii	"\332\246\017\340\334\267\031j%\003\217\322F\335T$rt\261& G\304"
+	.ascii	"\244I\027P\177\222\033G O\374z\020.\212p\307\313\r\304?\277l"
+	.ascii	"\224\252\f\b\374\343\033\344\241\024\314\202l\247\272\226\277"
+	.ascii	"eG\253\273q\201\215\344\001\253:&\215_\362\224"
+	.string	"9W\366e|\354\035\3364\023\330\235\026\345\223\223\367\033ItzL\314\360\030V\351Z\264m\fu\334\260\327S\213s4\310\241e\364\305\3439z\333\020\221w\237\242\3726\264\007\001\262\342\243V\027\026\t\025TZ\376\326L\362@m\330/\367g2\030\366\016\223\312\246\346\322\036\200\332;\325\206T\2517\271\277\227c\315\b\326\206\367egb\220\262i\306\232b\362\251r\002\312|\200\313\265\253\267T5\325L\275\001my\202\265\225PM\300\335\3054\277\237]\031\002\353\006N\032\375\315\tb\\\306\343j\b\306u\352o\220P\315\261\263\212\277\213\254\237\033\352\345\324G\343IU1\256\217\\\3756\023;\3519\360>.L\031\020\342\032\342\330|\251b[\247\364\316.\r\200g\317\331\215\205\302\343\232\373\202\200D\323\226%\312\f\307\340\232\355\360R\240\372;\364\207\346rsX\004?)1Bx\337A \371kU"
+	.string	"\003V\320`M\207\245s\227'\3178\b\2210u\255\226\370\\\030\351|2\274\223\224\306&\246\017\t@\0205L\362\350c\030u\241\004fh\020\200\234\357\345\230\334\353\227\276\275\376\225:\375@\253-]\334 \214!#\323e\246ET\023;B\275\347x\240\020\311J\255-\322(\030\245\250\236\266\232\301\234\302V\177\303\306\016\237\034*\373\344\347\367\220\207\301H\370\367\274:\335\371@\300\025mW\214^\261\3717\251\026']\230\231\352\276\371\037\272\207S*\376_\342\225\230\220\021\034C\263\247\340'\002\230\021\242-^\341\267\021?\301\"\020\301\022\350f1\256=\322\257\003\023\"a\002\213\226\327\334\312\325\225\352c2\370Q\207\223\202\026\341\264\276\202C^.s\227\213\025\241K\322e\312FM\234\322\341\361\031\3208+\214\254\320\340\354\314k\365X\371 "
+	.string	"=\"\355\314j\345\0045A2\343\250\261r\254\fu\364\007:\305\362\220\327Q\233\023\200\2121\257\023N\236\233:k\217\215\\\354\246\332\253NIq\262;\363\244\3679;\311S\374H\375\270\024\367\020\030\345\332\323\202I\325&:Yxt\023\264\205\b-~=\257\266\r\362k_D\241\206\220\202c\003ak\272t\315\033\3566H7D\357\344'(\356\341\345\250\364\341\204\026\231+x\025t\254\350\246V\222Y6"
+	.ascii	"\273@\320\246N1\300\241?r_!T/A\227\tD\006\032\244>\367^\206`"
+	.ascii	"vaM\027$\200\213k\372\220\352hl\244B\244\3140HCEs\255\375\343"
+	.ascii	"u\272\344\006\021\331\233Q\315Z\240C\321G\332\235IV\222\264\350"
+	.ascii	"\232% tOS\032;T\371m\020G\177\272\256\327\267\341|\302\b\245"
+	.ascii	"h\361X\315\330\t\273,m\266\213\357\367\\\254\006\215j\247\"\260"
+	.ascii	"RiS\020\271H\\\300\035\316V\202\346\230\304PM\230\373\351\312"
+	.ascii	"'"
+	.string	"\2309\355i\244\365 d\266\2615\235\302\001Tj\334\250i{\016x\026\006_\027\312\256\035@7\353\346o\330S\220\335\3023S\233%\tN\005\375\370\0325H\n\327\3372\234\2440\\/<R&3\340\253.~[U9I\037v\325r\376\300\316\323mU.\017\261C{\f5\256\r\330\372\210UNu\037\320\247\351\204)\033\242\325\266\213\217\217E/\204+M\t\206\2266\030#\322\335\2115F\340%\021\366^\252\023\375\356F\347n\255\f_\360\034\306\bH\202V\224\304\255B\257\343\311;\310\270\261\320\263\302\036=n\026\202\323\330\325wl\001KY8\016;d0\220\315.\312\\}e\377yU\240\260W\245\377\343\257Xd\364\342\237\370C\265>4\351\333\237.\0321\252\037\265\275p\234\335\271s\355\376-\035\217F\365\023\271C\035,\204:\016\235$\032\344DP\332`\305\244\211\nn=j\216\377\243\345"
+	.string	"\324\0331\007\371*\317\245\363=\227\337e\001\213\267\351\247>\301\304\025\217\215\325\257h\007\324\304\";2&\362\r.C\222S\361\313:\305\320-\200\205\226\242\3442E\316"
+	.string	"\366\251h$\241\306*\351v4\1779n\244\211\340\272(\342\007\354BX\272\013Y]M\264\2708\377Q\302h5h\214\001\026_\020\241\276\371\035\341 FX\342\317\305@V\367\2404\236^\341\306\247\024w\313\355\004\344\244\023\270]Q\312\360\311\241\251w\307 \\\322\370\277\373p\234\0326\207;s\2420:\031K\202\304\222\2200\226\002\r\201<\264N\004%\202\377\305\362W\t\254>\353\240\224\203\031C\277h-\2663A{A\220\271\221\306\331-\232\327\r\034v\034\237(\222\032\376#5\310\304\275\211\017\r\271m9\037\326\315\020\356\r\317\362\035^\214~\354\212\031\315\236\306A\362\301\237E\320\240\2076\302\260c\373(\\8\366\242V\375l4Pke\032\233\177P\031\016\252\260\230\217\315\241\322\271W@\275\255\020\360\332\r\227"
+	.string	"\351\002\373;\027\251\374\024\246\227\007B\355\001\025\243\253\231\007\002\366\250\003\370\252,\353\304<\034\002\277\274\n5\220\n\262\242\304\036N\320\325?\326$\321_\t\003\016\346l\317\307\034\243\036x\200\242\001P\302\322\253H/\377+\006\260)2\207)\252\367\222[\206G5a\013\327G%\323\204\222\352\216\256\314_s\265P\005\334z\254\361y\236\2327\204v\213,\320\317<\025\216\234w\231\235N\nD#\263\306\302e\002\344_&@\271\004z\231y\266\331\007\036\350M\003L]\221\350\347\037\200\333\375\341\036\004\341$$\212_\200\371-\027\017\004\245\342n\257\251\302\206\020\252S\346rDe:\271\264\370@%\311\317\026 \342\274\212\237\3661\262I4f\205\034'?\""
+	.ascii	"\216\215|&\364\347\024/\317\314\020\240\016\222\276>\257\375"
+	.ascii	"\351*\225`\tRe\331j\336,5\004^W5\360\001DN\307Fx\246\323\002"
+	.ascii	"\272\244W\300x\361\304y\344Tf\2768\356\314?+f\371\027\253&\211"
+	.ascii	"\305\026u\357\243u\207\315\271<+f\030\321\0222\277P\330&\342"
+	.ascii	"G\n\242\311\273\fP\377\026\321\356\2520l\254 \227S\377\213\274"
+	.ascii	"\354/Pw\220\001\031C8\b\224\200V\342\030:\202\317=\267.\332\343"
+	.ascii	"\233\323\347\367\370cU\211\025r\260\275\236\342\260\351{\024"
+	.ascii	"\222\277\2508\313\264\023\204.\376\246\032\"\342\231\261\230"
+	.ascii	"\267 _\321C\t\212\021\334\361\f\314\246p\342n1\334\363\b\341"
+	.ascii	"\371\266g9\274\325K\276=Z\"m\013N?w\354\243FL\250FU\201\376\367"
+	.ascii	"\246j^d\036\353N\216\341\205U\034\007\016\002\374S\244\251 \321"
+	.ascii	"\313%\244\007]\344\214\006\212,!\\\353\346 N\246/A?\021w\201"
+	.ascii	"\253\027\304f\216> \037D\214N\017\265\256\017\260\307\002y\031"
+	.ascii	"X\352\270b\034\213//X\247\257\0323%\214D\250\215cH\326u9-\246"
+	.ascii	"\275z\032\346\233\2529\276\277\367\022\020\303=;7n\273\017\021"
+	.ascii	"\022_\324\366\242>\323\373\223\315\366\001\225\274\3152\314\\"
+	.ascii	"\036:\314/\273\025\036x\004\213\305D\254nw\207\356\023\245am"
+	.ascii	"\206i:I\276\363x\0231\276\212\0244\217\205\357\247ydl{\210\240"
+	.ascii	"\236\200\251\357x\006\035M5\300#i;)\001\007\345\304H\256C"
+	.string	"\217hdV\364\220\267\204G\274p\300\177E\342=^\220\214\227i\322\007\253\321\270fH\fay\251\016\222\032\344\217\373J \276\312\357\354\221\370\346D\005\224 \203h\362\2404EH\310dB\253\030\332\357\"\355\2354M\212X\026f&_\216\233\322\260m\346=S\35470?\262Y\026\326\262\236\264\373\214a\200\rW\031\340\341\376k\350\352\027\236\30087L@\374\361\225\250\233n\211\243)x\316\260qGU`g\304\360\2256\016\204%-\312\264\032I\327;\252\267\356_\352\301\322\313\232X0\253T\r\205Q6\244\363\275\2321A=\371\360`a\202\024\2528\333\366\253Q\037\300\317\301T3\246X1\256@'\003!\036\314S\244\364{]\260AE\001\256\001\260J\337Z\004\36093\342%n \003\300"
+	.string	"\211\221?F\260\237\2448\022D(5\234\261\251\311\277\266\333\b4[\242\200\276\036\013\363!:\345\355\326\334V\"W\022\271\366\247\204\017v'\n\0058\216K\361\3317\346\305\324S\017qC\023\316\374\230\252!\333\267U\fXWTuP\366;\223<\3112\262Y\013\224\375\317\231\353\342\213\307\035\032\261s\024\345\246$\247B\267b\257O\356\212\234z\354+\311\207\033\031R\021\032\321K*Dl\261\277\327LS\227r\274\265]GY\326A\013y\326\025)\236\335\035\021\202\272"
+	.string	"(?'\377:\373\273\027\250-\017\313)\210R"
+	.ascii	"g\241\355\005\366&\325\357Q\344uS\302\r$\216L\016$k\251\340~"
+	.ascii	"\346\252\274\023\360VlL?\177\022\262\002N\355\310\223,\330>>"
+	.ascii	"\222\326\233\003\227\017\013\213j7\333\245\321\336\022\353\245"
+	.ascii	"Gp\226\020R1\036\332\327\262\220\337P\022A\272\215\\\262t\341"
+	.ascii	"\026t^\374p)\366\301q\306\0055B\266\371\354\362\220\301\035#"
+	.ascii	"|&\261Ip\274\325~\356\314\221\f\242\030\034\033q\255X!|~M\\\211"
+	.ascii	"&\234\027M\035\302]L\313=\340\214\363:\0061\375\241G\221\037"
+	.ascii	"\225\260V&\223\225\221`E\362\244\323\367\311,n\005t\017\320R"
+	.ascii	">\205\267\303U\362\203\312\334\266\256\325\234\310\243\024\200"
+	.ascii	"\023k\322u\334\332\363\271\"F\347B\200f@\034K\360\225\377X,a"
+	.ascii	"\326\301\263\013\230\303.\272\n\257[7\344\n\230\344y\214\nW\223"
+	.ascii	"\204'\t\277 \032A]\220*\261\374\305\202\233D\247+`\231\377\310"
+	.ascii	"\227\205\237wN\222+9\227\361\020\035:\350#\273B@R\215\362\006"
+	.ascii	"\270"
+	.string	"8\311=\3575\357D\3212\225\340`\367\255&\257*I\212\273\330\031\333\274\002\n:\303\230\344Jt\304\31123\257\314\355\373s\204\221\024#g\262\213\032\032\221\357(\230k\224\237\253\325\026\345\304\030G`m\2651\262s-~\244(Y\252UO\250\340#\354\265\334y\310\204)\251\312\317c*\211,D\371\202\035)\332\270A(\373C7[F/k\3544\306\310\252hrt\356\022?\261\206\320\377\3509\324P\271\312]lY!\214\032\327\362r\240\2361z\373\221U\322$\267\3645\035\352>\020<$\216[@\214s\221UQ\374\204\033h\025\027\346\033KS\235v\367\336\270\257^:f=@\200\221\377\215\373\263\272'\r4S\200\304\217\372D\310\334v\n\330\214\257h\330\253JJ=r`\271\320Pt\313\226 \331\300\325\252PSz\035\265Vt\022\204\365\323\353=<\315\213\207\235F\252\313\232!\213\2704"
+	.ascii	"q\371\235\213\343\002\312\336\024\234\274\362\222hA\241b\234"
+	.ascii	"ln\353h\313cq\243K\n{7\357\244Y\356K\360{\276\266\304\311\320"
+	.ascii	"\257\211)\300\"\237\0301\317ua1\267\347\3333\363\017;\tv\354"
+	.ascii	"\030YcEX\335\357\315\314\367QO+\bR\023\327\320\030c\275\221\276"
+	.ascii	"\030H\024\352\343\210,\237d\336,A\334\026?\244U%\2446\252T\005"
+	.ascii	"\017K\254@\006=\243\016\343Y\024h\006\344\035\221\360&\366\241"
+	.ascii	"IS\032\347\226(\237\343>K\034\024\271\323\245\r/<z\341\r\206"
+	.ascii	"\217:\323\016H\262\034\\\"\257c\326\225\253\302\215\221a :\246"
+	.ascii	";\374\347\013\346\336\235!\315<\371\360\262\354\376\311\365\005"
+	.ascii	"g"
+	.string	"\350AZ\205o\002\242:A\341\"\241^\205\377\340p\371\247\"\361H\304\204\034\203\321sS\216\210\225\225Zh\325d4P\227\324l$\001kdVo\375ec\220\303\362\251K\316\226*_\313\033\004M\355\263T\364\b\243\277\315,\365j\325\314\022g:L\007\033\"\362@\317M\f\322I\032+\266\016ar\310\344\345\316\246-\341\253;\231\007\256P#\365f\313\332*$l0\240\3532\032\006\240J\214\374q#\354f{B\306\264\024\f[U%m`\310\234}\254P\007\251\260+\256\312\272\320\233{w\036\342\032\316\226^ }\224\373\013\327\311\241\007\261\\(\214X\\{\252Wq_\370\t\272\240y\244\266\277W\2075@\365D\347T\264\312b\351\254\342\033\224\320\330\230\274\266\355\303\300\245\252\307\246\321}B\234\327\235\245\020q\274\346\300\3200S\233\t\345\362R\216\312d\353e}\303u\242\233\320\006\325\377\227"
+	.string	"\320\255\210\037\031 5:\232\264\226LO`fh\276\225\304\242G\346\033\247\316E\303\267\374\257T\346\0358\304\257nBNp\206"
+	.ascii	"Qe\030\275\342d\272W\301\205\375\244\226J5\016\374\003\022\364"
+	.ascii	"\3609\352857\025\260\362W\306\270\333\202E>\350\234\325\007\357"
+	.ascii	"x\250\307\306\334\275\006\272q\\Ql\261\005\270\252 L\245\"1="
+	.ascii	"\356$5_\225-\337\344Y\375\214\330Q\374\222\025\204e\241\022a"
+	.ascii	"\333\260\221+\323\205\366\360}3\352\306[\342t\216.\371\270\034"
+	.ascii	"{A\210\357\333/\004S.\b\t\252/\276'\022\342\233{\212c4\317\241"
+	.ascii	"\"{}l\241\265V\224\267\356u7\211\310\0207\377\025\316\341\013"
+	.ascii	"b\316\rY\340\326\270\036\020#%$\210\034\031J\351~\343R\374\034"
+	.ascii	"\005\223\310lHe\307\227\333\2056RmT\316\226\177l\313\314\021"
+	.ascii	"\"\253F\262-\365\2700\003\327\310q\210\211\370^\036\201%\321"
+	.ascii	"\365\253\3004\361]\242\252x\2342\323Ef\024\232\244e\f\\\246\263"
+	.ascii	"{v\362\266a\304\023<_\274\267\302\310h\223T\340\305X\027^n\r"
+	.ascii	"\203\376\016I\244\"\327\313\313\351vH\315`\177\035>\303\001w"
+	.ascii	"\023\331\334)\373\023\353\2457z1\230\226\230\353\366\360\270"
+	.ascii	"\214\004P\221!\233R\271\230\311\234!\266\213\261\354c\227\013"
+	.ascii	"\r\234\315\036\353\021\200\r\026\314\320\004o\307\223\320\231"
+	.ascii	"j\324\312\223\217b(\267;\247\022\361/\036\374\220N\255tG&Bnn"
+	.ascii	">\023\274\230i2\002\217\222\\kK\027\247\021\360P\2048\372\233"
+	.ascii	"R\033\036\206$\346\325X~Y\017\250!\251\332\241\200Y\270\275F"
+	.ascii	"<\206\016q\316=Z\036\240G\246'\235Rw\350\376\263T@\003\317\007"
+	.ascii	"\232\202\"YU\363\366\350\312\300s\205\335\bF\272G\222\002\037"
+	.ascii	"\013\035\342\036(\274Mj<6\373l\363\350*\207e\321W\324\363\302"
+	.ascii	"\322\b\377gl\177\004\300\225\347\340\226zx\201\360\237\253\n"
+	.ascii	"\263&L\272\004\344M\302I\020\301(\023\2129\f\364\233\264V\242"
+	.ascii	"N\260O7t\376\276\260o0\334\252\035\342\356\007\315\221O\264i"
+	.ascii	"\373\335C,D?B\213\024s\250\b\242\214*\303,F\240)\254 \345~D\302"
+	.ascii	"\226}\277\370\217\321\272j\222\2525\022(\026\301\202\222&\314"
+	.ascii	"\346\253T'\255XJ\265\362'$\351I+L\275\rp"
+	.string	"\377\322Oy\330\244\260\346\237\013"
+	.string	"\tr\035\323%X\201\311\377<\270Sp\223\241\307\277\fg\026;\347\342\b\361\237\352 [\314C\243\332\331\t\303,\b\177\206r\206\221\207I\030\267az;_\327\257W\t.\215\025 4OX\324\365\3140!\202/\005\001@'\374r\344\300\374\256\323\016\201x\241L\005y\346\2165\354\316\f\bO\365\214\375\n\224\313B\267\r\0235\215dc*\241\210\022\364\276\206JUED\212\311n\227\021\207\241\302\262\227\025\f\nKn\002\336o\307\244\246,d\253\217\262\031\327\2058G\2027vW\007I\255\343\007\3631iGXz"
+	.string	" \261\265\307\207\356\327\337\211c\270\016\215\254\350;Slg\22094`\241*\214\234\207!5\326\316p\273\324\350\b:\377\277\344D*\352X\001\234qco]\267W\250p{>\023j\230\025e\334\361\340c\3149\017z0\326\224A\272\340\007\343\314\321i\030\215\344\035\35398zT\037\027\255\372\223\210VB\362\265\265\352q\206\002*\367\250\274\374\032jrM\013\254\273\267d\327\017\307l\363\311\fO\313X*\005\321\330V\214\303\007vF\212}\025\216d\211\214\217\352\252\007\f\201\003\203>\247\363\206\374+s"
+	.string	"\024\334\255\201\375\216\016\316\271\372\310\303\244,N4&\251\337B\031F\234\275\335>=\300\026z<g\n@l\246\370\373\002\271\b$\262y\343\331\270\341-\313\313\027\347J\214\313 \t\3272FK\311EM`\214\306\t-\372\271\r\353Vj\376\200\202pT8@\225\030G`\336s\376n\201\007>&^='\223\247\243\257\261?\374\002\025H\331\032"
+	.string	"\270\262\\\344&\002F\020\n\302\002\256\313k\266\021\312\334\211\270`\226Z\3469)\037\220\275\352\272\207Kj[\334\366m2RX\364W\343S\226\221\033cn\027Cjz\336\301@\277\277\0210\370\206X2\370\3017[\026\266W&\361,\225\275z#\003\023\371Ic\351j\227\r\003\210\362\204\250\322g1\022gj\327\3762\333\334\240\313v\350\341\355>\270\207\206\313\372\231\214`\001\212la\365\364\222\330BU\030\321C~e\213\fe\003jx\013A\033%<f\n\354\344\013|\027\271\220\346Y\222\374n.\252E\341\322\337t|\243\013\205\321\2708\300\026$v{\331d\364:\257=\377tU<[m\314\243n{\233\007\205\347,\001\352\341\364\332\364Cs\276\346\262\341\212\204\211~\243a\205\346\261U\247G\302\307\312\257\271\003\205|\357\317\001@"
+	.string	"\342\260\205\370\326\247\035\217\352\314n\023\333\317e(\033\265\035\260\222&\177A\333s\020 \n63\2342\270\t\323\340\252\245\004\243\347\206\300\223\242\025u\223\334\252\3652\004\357eLk\264\250\204\327F \213\t\201\352\300\304\354\311\363\264\311l\272\t\030sT<(\2401\212\357\002\2769\322\304\344\336\b\305\2743\360\\\214\250&\210\3657\351`)\004\374\303\262\005\036x \227"
+	.string	"\037\323\200\264\207O)\200\207\332"
+	.string	"\335\337\376\347\205\320\034\2560{Y\227[\275\376\325od\264\253V\252[=\032hGh\237\311\005Z\207\206\024\236\334\367\357\033\215\005\031D\256\222<n\243\240P%\371\f\376G\2652[f\304m\001;bn\036\342\b\367\362*\3461L\301\231\260"
+	.string	"\227\235l\321\222~ Z\335z0,\025\220\"t\242g8\206\023\301;\242K\212\352iV:\307\264/\r\203kP\206#\304s\323\225\365XQ\021\266\341 x"
+	.string	"U\230\001h\220h\213|\230\301\2424\020\003\357\002p\032 \007\177&\272W\223\345\375\027\220\306\371\372\275\t\263\253\252\375"
+	.string	"\253k\265.%\357\007\204\033\030\346(\013\223\351\342\220\377<}\276}\026\243\217\007\032\306\203w*\332\222\224\230\364s#G\306\257\300\22420\323_\246\333\016I\324\215o\213?\3512~\227\315Z\302_\317\035\315\271\025\361\234"
+	.ascii	"3]`\255M\221\226\213\034uj\356\346\206\332\220K\376\037\233\210"
+	.ascii	"\303\211[\367Qq\203\361R\360\307?N\356v?\362qd\371\237\303\027"
+	.ascii	"T\f9+tw\235Ue\334\246\213\375\274\004\216\313\266\265\223\237"
+	.ascii	"\256F\272\250'\341=\364\023\374\3009H\304"
+	.string	"&ng\r\262\2313j\364\217\324\373\210\244\004\326\002\347J\231\362\361\206\020\233\226\266v\256\026\032\310;Vy\343\026\365\233\360\273\354\203*\027\220\b*\273\344\016k\323\034\031}kX\006\311Bg\247|\260\233\033\307\215\025+\346\314\312\314\263\333\373\227s\356I\331\246\215\203\356\035+\030<\315N\362(\001\013\264t\032\356\207 \306\211\375\013\262\212\372\314k\216\205\210z\203\2150\330\275\312o\257IH\237\303\307\177\374\243\332\212\365Z\322\202\261\315\313\353!<n\317\204\311\317\365\313\2352\3008\003`\372\377\022X\"\340\316\254\323\255\230\212\227\005\267\272\257\032\221\273\226\275\025z[]7x\363\375\013\2639\341\rH;\353\330`\263\356\362H\245\262\342\314\263\327\213\020Uz\026y\234\314\346\227\3427\374\351\202b\017G\213\330\363\317\335~\036E3\220.\353\264\345\247\332)_\034\314\344\255>\311\262\317\362\350\n\020#"
+	.ascii	"X\241\255\037\342\177\217\301\323t\256\242\200Q\345/q,\255\224"
+	.ascii	"e\277\262\360\220\264\007R\234U"
+	.string	"\323\030\210\006\224\373\372\374\217\350\026\237wdh\226\336\356\213^\355\b\266r\314\013\347\343\254\211\002\2012\316N\244#\227S\225\206\250,\005\2475\230\032\303zq\375\365\301W\251\177m\301\024\213H#\364\257\341\330\271\355\370kt\367\t_\351rj\002\035h\260\342B\333\026\276H\211\204\342\007O\222\206\331\347!H\035\3642\224\\{\357\026\177u\207v\217\003\0139\031]\020\302\002\250\205\016W'H\237\367\373\316\325\260\217b\310\3642\013\244\225\324w\302\256\272f\227N\225\036\343K\377~\360\367vU\344\f/\003\036\260\262\036D\230\005t+ii\"\022\005\2112\177\244O\303^\352\364#@mK\316\266\352\277\271\301]\254\252\022\334\033\357\n\033\302\376\316bW\272\213\346\206\244\031\375\032)\007$\367\310>\023\254=!9\335\336\233E\005}\356()8\250+\270\\H\203\3436 \212.J\362\034\273\260@D"
+	.string	"x\n\240\311)*\310\206\216\316\360{\r\341\264\031\342\267\266\3509\214t$\321\350i\363\223\351\356\001d\325~7\320\3114\316:\272r\306jn\256\177n\025\006\353\337\3638\031h\211\\gu\354\255,x\217}\272s`8Y\214?\272\235\375\026\202E\244\004\260z)\021\272,\\\004s\271Dh=4\317f\275"
+	.string	"\263\035.\\\323\205(\2508\311y\321\357\025\023\343 (\273)\200\255\b\230\317\3013\355\345V\r\024\263D\276\005\216\035\351\017\264\350\335\203\353\245\236\225o}V\353'O/n\363,\326\343F5\337\375\372TG\212f\013\027\304\2727sv\036w\364\347W\2370\377\215\3440\272\233\325\354~\230\327\345\230\3369\372~\232\376\336\371\306-x\177\335\261\032\246\007\027x\320\333\037\354_\t\234pY\334J\345\254\334\242\241\037)\277\336\372\313\231\307\333^\250yq\277\261\363\3764\303*\377Q\374|\275w\357\213\027:\036l\302\2123"
+	.string	"\"\276\270\235?\204/C\306r\002\353\003\201\037\375iz\"\177~Y\021\340\270` \337\314\227\274Za"
+	.ascii	"&9\342\2515\t\371/t\2772[\347LE\036C"
+	.string	"\003\323\341]\363\313\312\\u\353\323o\374\326\222\234\262\205A\265\303\334\203W\350\337\224\374\303\332\267H\320\232\243\r-!\360\334\3278\f\320q\202\330x\331\343;\344~\314p\223FC\375{\211\346\336\212\320\352\254\363x{\377=\363\363\323\357\r:\211\311\250eE\247\213H\262\323\341\303P\214\220\376A\201\277vm\333\220.\363p\0019\373\312Y\343I\372Rsu\374\007,\334\314\375:\301\253\371\234\267|\322\364\037O\347\f\366\305=e\310\203\376+\347\357\363\375m\365\023+4\272\3113\361\375\375\365\252\021-\253\361\320\347\262m\013\335\266\254\377\255\221G\237\323\324\335\245\212\261l"
+	.ascii	"w\354\354\004\246\262\r\344]G\326\215<?I\230\375\003"
+	.text
+	.section	.gnu.lto_.symtab.a8614bc3cb44a1f0,"e",@progbits
+	.string	"systemConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\005"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\005"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\005"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\005"
+	.string	""
+	.string	"getCurrentMinthrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\005"
+	.string	""
+	.string	"resetConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\005"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\005"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\005"
+	.string	""
+	.string	"writeUnmodifiedConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\005"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\005"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\005"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\005"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\005"
+	.string	""
+	.string	"setConfigDirty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\005"
+	.string	""
+	.string	"isConfigDirty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\005"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\005"
+	.string	""
+	.string	"isSystemConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\005"
+	.string	""
+	.string	"setRebootRequired"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\005"
+	.string	""
+	.string	"getRebootRequired"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\005"
+	.string	""
+	.string	"pgResetTemplate_systemConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\005"
+	.string	""
+	.string	"systemConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\005"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\005"
+	.string	""
+	.string	"pgResetTemplate_pilotConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\006"
+	.string	""
+	.string	"pilotConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\006"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\006"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\005"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\005"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\005"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\005"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\005"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\005"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\005"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\005"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\005"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\005"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\005"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\005"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\005"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\005"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\006"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\006"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\006"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\006"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\006"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\006"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\006"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\006"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\006"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\006"
+	.string	""
+	.string	"schedulerOptimizeRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\006"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\006"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\006"
+	.string	""
+	.string	"checkMotorProtocolEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\006"
+	.string	""
+	.string	"featureDisableImmediate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\006"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\006"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\006"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\006"
+	.string	""
+	.string	"featureIsConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\006"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\006"
+	.string	""
+	.string	"featureEnableImmediate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\006"
+	.string	""
+	.string	"buildAlignmentFromStandardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\006"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\006"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\006"
+	.string	""
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\006"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\006"
+	.string	""
+	.string	"resumeRxPwmPpmSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\006"
+	.string	""
+	.string	"featureInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\006"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\006"
+	.string	""
+	.string	"suspendRxPwmPpmSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\006"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\006"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\006"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\006"
+	.string	""
+	.string	"mixerInitProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\006"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\006"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\006"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a8614bc3cb44a1f0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
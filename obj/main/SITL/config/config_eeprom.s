@@ -0,0 +1,1101 @@
+	.file	"config_eeprom.c"
+	.section	.gnu.lto_.profile.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`4\001-\013"
+	.string	"RN670\221\322\0308\250\256\235\243\237\036qtyV\262\177\250\327\234\356\374\341\260\02133{\345\206\202\202\202\202\202\202B8\340\320\252\372\203\375\244\265{w\333d\357M\322\226\001\373\350Li\204*p/b\254 R\b\366\221<\254jDS\217\323G\310@h\337:a@X*\001\320\031\03241\001"
+	.string	"\353nF\021.\320g{[[{\337?\233\366#@W\303\213\365\361\354\251T\304\264\240\332jg\336\311\352u\003\317i\205\242D\243S:]j\t/\027\251\372\236S\304\261\201\242S.9g\313e\250Z\224\034H\034\031\337,;vFd:Z\262\325LN&H\021N\006\211V\305\203\303\370\016\207\277\367\372X\\\024R\0306\366\016\305\346e\332\275{\217\256\225R1\255h?\b? P\002b\252\256\003G\"\234WR\321\232Y\312\246\246\026\026]\200-\005\326\316\021\253\345\301\253a\021.z\261\237\277V\323\306\216\300\"\220\223\240\001\b \240\344\275N\250\002x\247\263\005\030\t8<"
+	.string	"\3018\210\305i\273\031\343\325w\276\342\371\315+\220\013\030\361\356J6k\351~W`\212\016\001\216\005X\026"
+	.ascii	"\265+\334\215\376\007\212\005\307\007`\211\345\001Cf\236\233"
+	.ascii	"&\0136\310\2357T\333\317\033J\002}\253%\255\f\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"\215\005"
+	.string	"\022\307\023\032\220)\351\377\177k\312\335\335\335\335_3T[\371V\005\374\277\033i[J\231\002\013EOt\304}\351\3129\354\031v\341\226K\256I\370n\300\030\375\252\002\\8\322T\330\t8"
+	.string	"oB\r>9\326\"?\031\376V\303\032\237\207c\331\371y\217+ `\202a\256n\003Y\340I\300\032\256\t\341F\251\".0\240G\201\262"
+	.ascii	"t]\372B\2014\376v1s\346\306!\273\001\020\0010\232\261!uQ\264"
+	.ascii	"1P\344\020\232\026\265\337\003\360;;f\353\2100\177\344i\367\375"
+	.ascii	"\205\002D'X\236\301\030\016|\201\031\241~\217\305\331\3576~&"
+	.ascii	"E\031\002"
+	.text
+	.section	.gnu.lto_.inline.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`\026\007\035\037"
+	.string	"V+\223I\300\322Q:\024\240\334}\242\334To\017\245\177OU\230~s\307"
+	.string	"6\302\016\324j\t\211.\351R \016@\226.\376\373\315\274C\224j{\205\325T\020P\006M\200E\t"
+	.string	"I\240\223\033u\376\200\266\032\365\241KF\254\334I\246t"
+	.string	"z"
+	.string	"\207"
+	.ascii	"\266g\345\254\234^\333d\345\262m#\220$\251c\257\\\347Um\207W"
+	.ascii	"\205\020\352st\255\270O\220\341\343\304\313\241g\245gek\327\265"
+	.ascii	"9\375\365i47\211tDB,kO\247\\=_\350\210\204\006x\3325\257\366"
+	.ascii	"\2046n\362\340a\032br\333\001\256\252\326\334uJ\354~$\376}\333"
+	.ascii	"I\222$C\373\346?=J\300\002\267\365\346B=J@\024;\305\"I2\332\223"
+	.ascii	"|7\200\"\376\212\262\230\311#U\306P\2578zE\332zE%\275\342\314"
+	.ascii	"70\265h\272\327\025s\017\034\200@\365\216^\332n\275\336\332S"
+	.ascii	"\2300j\n\375=\351\357\314|\362\251*R\257\376\274\265\031$GpG"
+	.ascii	"\350\321\266\377H"
+	.string	"\222\\\371\243O\243:\256\351\227l:v\365\325\257kKG(\3548\242\032\ba\317\261=ETA\b\273\003\213\326\232)AJ\306\216\314\"\001\327'\335\343\350\203p\237\243!\023U\317\b\201\311\311m\362z,\241\030\261s?\002\n\222\210M\321\230\262\3602K\255w\3711\207\362\201pR\213\246\371\207\240\017\033+_\364e\346\214\020\274\037\372 \252\336\021\355T\275]Po\177\022\361\343{\211\036\247Ud\323j\363\0368p8\021pIk=+\325V\326\f\372\260\304#J\300\340=\r;\030`<\342Y\271>\t]\274.2S\207\212! \367\222\013d\243\314\275bV\233\351bI\211\327\222\233\027\202X\fiY\001z\022\226\234\302\213\200\202\300\027\222T\325\210\230c\266\303n[\261\215{\205!(\025/7\324\n\244\016/V\261\315\333\177\257\024\022\022eVZuS@-\306\006\257\n\2128\262\r\030"
+	.string	"j-\371\265f\352xMA\026\334\344\361e\020r\200\305\345Y)\252E\333\254\271\253\344\370#I\237\225\277\343\355I\273\250\032-\257\314k\273/\212\312I\244\275\267\213\202q\221\2452\r\200\301\250\261-C\"B\"\"IARH\007P\242Q\252\250<\022\300EAf\2613D\323B}\246\355\231\335)\331Q\223\371\307\236'i\025\333\013\031\325H\0170\344\335\203q\315;\036\350\321\317\204\004\003xj\rcums\352K\255"
+	.ascii	"\020\316\006Ex\342Yj\025\351{\242\022O\354D\322:\023\020\311"
+	.ascii	"\354\323\302Q\361\022\3753ck\373\031\026\f\\\256\311d\021BJ\306"
+	.ascii	"Un\002\fg\227\007\251\325\001\304Yk}\2544\200II\212\247\346\b"
+	.ascii	"\374(uv%\006\327\023\376\371\rh\030\0170\007*\024q\254>)G\340"
+	.ascii	"\250\360\364\001}\007\333\007\344\351\241\201\202\217\250\235"
+	.ascii	",\3038\b\215\375c\017\362)\311\006\007[!\262\t\033\371\004\227"
+	.ascii	")\376z\r\002\252@K\032\314\202\362\311s\265\313B\367?`\030V\264"
+	.ascii	"\322\256mj+\352\r\031\343|\246\217\273\223ki\207\321\261\275"
+	.ascii	"\272r.n\326\355\277e2MQ\210\233\251\357\001\f?\336\345'\344\251"
+	.ascii	"\357\231l\236\341t\307!]\363U\255\367\204R\346\270\036Hs\260"
+	.ascii	"\243\006\020 \344\330\253\202\332T\021\336\331\017\007<\227\016"
+	.ascii	"\222TYjT\327\025b\230FHm\377\373\311\310cc\212\243\3600\246\345"
+	.ascii	">:\322\234\365.E\025\023\027`\242\267\n\334\251\006\274\210\214"
+	.ascii	"\201q>\262\207\203\f\345u\232\033\343\211a\036\341v\027\262\037"
+	.ascii	"\\\020\225:/O\204(\343\244j\006\027\344\033*_B\304\223e\316&"
+	.ascii	"\234\035\373\303X5wN"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`\031\t\315\025"
+	.string	"v\232K8@M\223t\017\211\214\233\307\017\274.\214\n}<\"\351\243\252(\212\232s\006\007\366\n\b\356\230\231\360\270\f\277T"
+	.string	""
+	.string	"\\\216\201\207\236kf\233l"
+	.string	"Mj\177Bd\222\0018"
+	.string	";"
+	.string	"="
+	.string	"fc\254\243\265\276\030\277X\277\366\022\221Mz\f\372=\353]\342?\031!k\255/9k\213q\213ug\2356<m&\223E/\225(A\017\325\242G\351A\276\224\220b@\020\215V\b \357p\223\2638Gh\370\315\235\327\324\321W\220C\260\222_\334\2448\\\365\340\016\t\200\226\211-6\307\375\222B=\364"
+	.ascii	"\230\322\030\f{\f\353\263\242\320Z\024a5\006\367\231?\027\255"
+	.ascii	"5\3331V\3012B\\`\243g\031\023\254d\344\013\317\321\300\2768\235"
+	.ascii	"\222:\353\b\266\004\024\241\364*\345a\315\316\030~\303j\022\223"
+	.ascii	">\317pM)\273\324\324s\320\007\201o$\311\215\307\343\353\260\226"
+	.ascii	"\244\274.\356\237\240\360\2554\026\220\n\310I\245\350\216\255"
+	.ascii	"\317! \017\220\224\2204\320L\246\231L\357>\032\345t\013tz\373"
+	.ascii	"T\234F(\245\330b\351\322\006\323\200\370?\004\200\265\250qI2"
+	.ascii	"\"IA\222\324h\f`\002\2211:\233\003\022\240\342$\001E\003\035"
+	.ascii	"'\2252\206dN\024$\005%E\205,\007\b\026\013\314\233\203m@\001"
+	.ascii	"\356\022\2104\361P8ly\357\345\253\376\016i\253\013\324[%\304"
+	.ascii	"1\251\317\303v\352\267\372\327\214\350\016\371\204\266a}\003"
+	.ascii	"x\326\205\r\227\330y\2359\"\250\026p\213\364\253\222\240(C\375"
+	.ascii	"\206!"
+	.string	"\007\303,J\353\342\234\nn\202X\351ZI_\003\207}\034-P\237p\323\374\027\346-\215\373J\373\276\200$\210\002\364\320\332\302\273\331\334V\372\265\334*j\201\200\303W\246\2262e\211@\013\2333G(\335\017\032#\250\257Z\345\004\\\305,\245-a\033\232\333\224P|\326\351\246\234M\325\371\203bz\276\026wbm\023\352\376y\276\307\353\207\330\234*\263\265\201\323\246\316\314\303)\257dK$\212\2560\306\235\255\301\027\261W=\367\314\336\307\310\b\331\225Y a\021\326\227\002\367Y\315\356u{\222g\351\220\224\231\363\217U\353\372]\022\333\242\031sgfG9/M\177\214\013!\031\310\202\360\273\232hJ\305\347\300.X\260\352\375\240\206\256\231\243BZ\254\027\255\001Q\b\314#4\241\342vK'\251\013\221]6\302w\016>k2\302\222\241\357E\210\314\033}\007\343:\352$\226\236\215\220q\027\333\315\016\032"
+	.ascii	"\n{\275\354\211A\\\242\202\t<\022\275\251\351P7y\213\311\005"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_.pureconst.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\265\004\002\205\004\003\265\004\006\230\004\007\231\004\t\271"
+	.ascii	"\004\013\225\004\f\232\004\017\231\004\020\230\004\021\231\004"
+	.ascii	"\022\230\004\023\230\004\024\205\004\025\271\004\027\204\004"
+	.ascii	"\030\200\004\031\231\004\032\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`D\001m\b"
+	.ascii	"\342\013 "
+	.string	"\"\2009\031\01630\00330\227\200\260\f\351\252\022\215\306~\367<i\206\354Z\374\375@\345G\264\223L\001B\"\220\310\003C\242\b\272\250\252X\247xF\321\205\227D&T\331\241\235\007\352*h39\270\201R\251a\005\017u)\237\243\214\214_#X\347x:\214\313Sa3p\216\210\271x.VJ-\253\36466*\340\322\263\2613O\3639\023=\031\003\230\200\365/\341\251\311J\326&D\350\217< 0\002\204T\241y\340 \270B\f=g3\355\27030\246\201\300\270H\f\002\211q\0013\004\233\211\214\272\005$\027pj\257X\223\360\265\256\314\345\030\312\232\343\0241k\215\235c\306\264\221\004\201\274Kz\002\363\001s@\267\200\333\021\321t\341G\270yV\265\213\320\202G\210\325\350\201\270\b\202n \246W\301\371\034\306\233Aq\375\002\031\033\274\027\247\273#\223\f\272\rD\260\204\024\372A\346I\340"
+	.ascii	"\226\200\362hfA\r\240\b"
+	.text
+	.section	.gnu.lto_.lto.cc643b01ef3e5807,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_loadEEPROMFromFile.20.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375 \333\325\005"
+	.string	"\222\212'/pU\323\001"
+	.string	"\225\254f$~\341\327\305/fj6\3765\216\021\207\020\3410\350o\356\rXD\214\325\002.\200\370\253\310"
+	.string	"\250\341[$\267L\001\257(\214V\315\262\030\217\313\221\321jfW\003\233U\205L\312p\252YuF(\255s\n{\031\\\214\306\nwg\371K(r\275KQ4v\314\375!'9\363\257\240\031\374\031\321Y\222@\367e \240\307\201\350\371\277\323\267\277\264\341\2467\304\261\200"
+	.string	"\272{\262f\267\225\333w?[\360>n%A\321\335\227\336\207\331\363\376?\374O\374\237\004\t"
+	.ascii	"\252\244\233iq\323\031T\341:\327p\262\020\306\313\020\340\322"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_initEEPROM.21.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"\025\007"
+	.string	"\002\21506Pm\222\016\244\204\237-\021\321\024f64\362\024a\220\017B\337\231%-T\361\266\265\273\001\255\033[wm\244\365\217\031\203\202\250\201\255\274D\025\256c\267O\210L\001W\225\313\205e,+\201\301\262\200\271\252\210\261(\\b\2055\304\212\300W\306\302\242\303ua\221\3528\035\365\300\342SR\342@m\312\273\334\003\304\353v\271\"P|JJ\032\334|\247=\210\361\245$\274xH"
+	.string	"\362T\204DP\244K\211\023\223\f\231@D\177oG9MIO\031\034\036RfR\235^\363T\247Rg?\322\016\224\375\330\210\360 \311\314\b5\232\365e\267\243\006l\235M\037\200Af\376\266\316D\207\375\007\376\202?\024\013"
+	.ascii	"\252\244\223i\021\206\205\b\333*\204\347\032\016>\304C\250\030"
+	.ascii	"/W\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_findSavedRecord.22.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`Z\003-\030"
+	.string	"\006m\234G\300XM:D\204\2727\313\177|\016<\004\001\206\374\035+i\266\351\002\243\020\rT\234u\"\207\224\301\373\377\337\370\177\301[\273\240M\261\246\232\212Y0E|\0220cB"
+	.string	"\307\363\2638p\352\2405B\b\331[\312\224\002\212"
+	.string	"}"
+	.string	"\214"
+	.string	"\366\221\376\243v\\\n\3139g\\92'\356\201#\200\227\002\364>~T\263\315"
+	.string	"\256\b("
+	.string	"S\226\035!_\346\304\261\214{\001\357\022<\001\357r\211\034\325\366T\b~\236\214\2536\337\346\251\016L\230\034A\325"
+	.string	"\212\3610\312\034\206\202\261\201\220\223\240\325\017N,`\344\363B\277\035OGF\031!'A_\272\266\370Q\021/\305\306\225\353\236\300\310'\206\306\bA\337\324O\320\365\2630\347\264\362\374"
+	.string	"\335\252\333n\262\215\301^\231\177\234s\316\2707\353\267\373\245\203Xr\024\001w\277\355\261\377u\002b\343e\367f\343l\364\001R\024\013\357\220\375\244\177u\334\017"
+	.ascii	"T\253\254N\205\241\032\374@\265\347\251\345\225\356(\325\373"
+	.ascii	"\251\325S?\300u\314/[4\350\346t\261\0233\243H'\034W\272\375%"
+	.ascii	"\327|\235U\276\222\211O\035\237\260g\005\224\2269q\016.}\001"
+	.ascii	"\274\f\362\\\355I(\242\200\231cC\206\004\360\022A\\\ra\276\275"
+	.ascii	"Y\036 \332\345\236\344(\230)2x\214</\001\261\240\310\351JB0("
+	.ascii	"\232sR@\362$z\236\327\234\367\323\236\310A\321\rwW\225\350\354"
+	.ascii	"\300\321\235\277\312`h\207CE\027u\243\273\335\322E\n\r\2717_"
+	.ascii	"\367\001\372\245\037y\325\214\341\341\027\271\221\226]\257\n"
+	.ascii	"DS\204\216\346\2749\217\261\304\3756\334\036\303\274/-W%G\301"
+	.ascii	"\330\236y\023\f\2343g\202?\204\304\bp\316\371\033\227\276\315"
+	.ascii	"\273\374\312\035QPH7\272s\263\307d\260\232\226\013&\002FC\323"
+	.ascii	"\"\341Z\305ffk\027\204\0222\332\354\365\n1\003\023\021\223\271"
+	.ascii	"X1X\253\004\313E\243aAP`\331\354Ec\325\310d4\226\312\363;d\365"
+	.ascii	"\316t\225g\372u\317`\305\205\316H<\323\035\306M\245V\027'\265"
+	.ascii	"7;\202\341\306\355q\324\321\244\023\256\026\334\023\271*\252"
+	.ascii	"\005\t\214\331\331\037\360\274U\255u\347\205\275\341O\034\274"
+	.ascii	"\225]\204\364\370\214\026*\236\300\275\031\300J\017o\362A\356"
+	.ascii	"wK\202BZ\302\205H@\250A4\302\2304J\005\023\020\245I\0335\006"
+	.ascii	"\220\002\031\"\263\003\020p:\005\312\260\031K,~\273j\002l\357"
+	.ascii	"\243\301\331\207URFBb\006\322\352\201eL\340\264t\344,\026\326"
+	.ascii	"\270K\253\221\351\037cyX\330\317\242\324m\024\355a\351#\027\254"
+	.ascii	"\003\345\375\210\f\341\nz\367U\016uI\315\004\007\234\202\342"
+	.ascii	"v\rh\340\201\"\001\346\232\342\375~p\030|{_\254\270[R\200\017"
+	.ascii	"\252\037\220K\22631\031\311\332\016|\367\223f\337\233\034\376"
+	.ascii	"w\207I\003"
+	.text
+	.section	.gnu.lto_journalEntryCrc.24.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`\340\001U\021"
+	.string	"\246 tG\340\264&\035Y)\325\001l\002\021\355`0P\\]\367\247\340\223P\330l\332\037\034\302\260z\226\2310tl\255,f\211\227\306\325\232\351N\b\216\300\002X#8\353"
+	.string	"\233\305\200\211\274>\302FT\260\201\240\275\267\224)\005_"
+	.string	"_"
+	.string	"`"
+	.string	"3?\315\231C+\232\363S1\202\355\321\337f\333W\361\036\227_\372\351p \355\220\210\265\0302\347\207:\271"
+	.string	"\371\250\017 \037w\304_\207\253/\377C\207)l\304\220\315h\016=|!\001\0357xL3\030L\371\020\202\350C\327\233\231\215*I\2039\247U6\353p\307\333\206`;\202\255,\001@\277\311\203~S\311}\376\022\351\337Or\241;F5$QoT\253T\037\300\200 8Zh\314\271\241fd\036E\031'.\364\333.\177\310%\333B\257m\026m1\242\235\037s~\007\036\375`\213\372\240\227\236L\230\315\021\007\020\310>x0X\037\031\224\223\t\373\351Y\240j\177\305Y\270\376\005\262\264\272%[\200\264\272,FBb4\235\345\320PcediQL\240\370\351\001S\"6)<'\277[\253\3353\244\255Z\351e\244U"
+	.string	"\"\303\322\330\177\021c\200\307\234\260\313l\013w\301\332\346\204% ju*:%\036\375\031\371\370=\216\321\016\031N\215\326\354\217FW\204}87\307>=)/\265\034\206\225\004UK\252Z\372\342u)\316\223\036\367\342\302U\220N\255\260:\257\305q\023T+\n0]\n\005\263ra\241R^\fj%\305]\213\363P\027\272\316C\225\276y87\307.\036\332\236\226\305\003CI\033\367\306v\\\023\016\220\243\232\265\201&\3355Yx*Y\270\337\335\226\"1\232I\345\271& \260\"\232#;\312t\235\233\226\\\353Z\356%k\326\273\262\260\276i<oQ\263\034N\366\224*\217\200"
+	.string	"0\317\204\3541&\026\333\023\331$2\037\036Q\242\0240\244p\226P8\3646\202,\0311\\o\315\367\016;\210\2051L@\344N"
+	.ascii	"B\203v\221\246\024\025\n"
+	.text
+	.section	.gnu.lto_isErased.25.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`\242\001E\020"
+	.string	"\006\340nE"
+	.string	"\261&\035;;\216=\324\036\243\257\027+\250\0262L\273lRu\323Y}\330c\242\005\267*I\221u'\326\312\370\024\342\326S\033\346M\226\240\252\326\217\347\315\375\036\0208\303\244\312\320\241\006-!do)S\n\\"
+	.string	"X"
+	.string	"Y"
+	.ascii	"\336\007d\217\333\005d\217\b\024\230|\272\327\301ES\311\260\270"
+	.ascii	"zv=N9X\373\276\357;\364\356\230\247g\021j\236\374\224g\036]J"
+	.ascii	"\325\2412\216\2009\204\016fJx\360\350V\240\266`-@]*\365\257\247"
+	.ascii	"\016\f\024\r\233\016\346\251\211\354\256\263\245\273pk\267\315"
+	.ascii	"b\273\201}\026\0011\255\231N\230>\200\233\360znD\250\261\353"
+	.ascii	"\362\351\330\030q"
+	.string	"\205\210\273n\037\205\377rYgKy\331`7,\033\273\373\361h\006\333\343m\223\r\262\255\336O\230\336\262\216?\273\033b9\273\013\342\004\333#\001\230i_\3463\246\263P\036`w\245\"g\327\003\361\201\355\321\001\321\300\241~\364/1\034)\r\250\3742E\206\225\013\2501\376\367R\246J\242\331Y\311\034\366kNJ[\b\037%{T\275\n\303U\323\324\247H\240\3623\324\353_\2072\261\217e\207J~:\203\247e\243\032c{)\271@F\354\203ue\177\316\372\265\267\376\314\351x\327\r\003\242\207ND%hr\217\204\220\214H&\241\220\204\n\"\n%\243\021\256D4\201\204\033!\225\270\220\002\036\231\204H\234\205\321\210\304\201\274\275\256|\232?\340\271\201\341\304\377\224\375u\b<50\034\365OY\214j\021\025E\201\3104\306\237\026\370Q\335\311\217CU\331v\246P\317\242y\261\2229\016ww\003\036"
+	.string	"\252\322M\301\360W5wT\030\275\f=\020\205\320[Z4w\263e\237kSA-\007S\022\334m\351S6\027\352\226-%@"
+	.ascii	"\275@\fpE\232\232\262g\270\270,\260J\253B\215\246nz6xjiS\275"
+	.ascii	"\366\022\346\023"
+	.text
+	.section	.gnu.lto_isJournalEntryValid.26.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`S\004\005\036"
+	.string	"6x\303E\200\336I:;J\275p\221@\347\206\r\366\315\027\367a.\211U\202<\252!\2425\303C\352\360N\323\370\300\022\004\004\256*jd\242\212\351\244\344\215\305-\326\036A2.\267\320\362\307y\330\326\b!\233\020)e\n\263"
+	.string	"\233"
+	.string	"\276"
+	.string	"{\356\260(\326*\244\310\247\252!\323\276\226\270\373C}\305\276\373O\344\261\265\352\352\f\362f\306N\255\304\007K\276\202\311\374\257\225\005\203\332\260\036\033\240V.60\265\022!|\202\271\344\211+\200.i.\021]\362\377)X\200z\324\022\275\204\224V_\202d{j%\362\272\311F\355Nw\232%%\307\346\250\257\324\356\\\260m\261\022\267$\013\311\352\316RiI\326\2215\333\256\264\312 m\2732\262\303\252b\022"
+	.string	"\226\217\361@\255u\244\352\321\3010\315\020"
+	.string	"X\300Q\300\032&rVl\021H\271B\302\\*\325Z\317B\254\254\375\317\376'\373\237\341\037?\004[\326\354\305c\364x\205=\272$\327\272GC\227\354f\032[\343\016\352\356\205\253\232\002\344\342\267\271U\250\275\t\316q\030\2705[\335]/\267\211n\313\030S\243b\271\377K\233\245\311\254\225\352\302w\f\206\223\te\311/\r\272\344\366\212-\017\243\310\031\202\205Mq\361'Jqw\375\333\305b\261\370\346\372O~\022\322\310?:\337\310\344\027\235|\242%\356\207F\276\320\206\355\006\231|\240\363\177F\376n\344\353F\376Y\362\315\222_\216|J\371$\345\217\314o\222\317#\177\007\354\225\255j*F\254\027\257\027\365\n\213\350\232\250\013"
+	.ascii	"\335\312\346\272(\267\037(m]\357\034\240\233\226!\220\213g\316"
+	.ascii	">\221\270\340T\235\335u\020[F\250\033|\265\031\202-\200\373\241"
+	.ascii	"ev\331:\306\342\354\3406\233t\253\032\322.{\203s!vL\223\030\030"
+	.ascii	"#x\320%i\223nz\250\204I0K\003R\002\021\370\372\032S\333*\033"
+	.ascii	"\324CMb\215\214\231\2271g\324\\\006t{\261\310)\311\303\346u\304"
+	.ascii	"\326\334\220\335u\262\307f\032\213\263h\013\246\304\027\312M"
+	.ascii	"\234\340\025\236\240K\222m\300\211\221\243\330\263\024c\223D"
+	.ascii	"\350\304\205-\033\020\354l\354\262\302\200W\255S+\374\277e\313"
+	.ascii	"\245\205\002\257Z+\2063~\276\336\322\217>\355{\021j\370~OKK/"
+	.ascii	"\232\234\230l\370z<\033N1j\360z\277\033\274\b\t\356{Z\372\361"
+	.ascii	"p\370|?\336\216Xw\254\315u\246\343\266-\363"
+	.string	"\266m\331\333\266\273\267\270 \232\316\310\303\333Z\031Z\371\215\242?\377\351+M5\360c\255\265\356\272\353]\342\202h\346\003\242N\022\361f&\210fn\232\375x\0165R[\255\330.8b\n\365\307\363\354\243\266b\363\373:\264|r\0265P[\375G\275k\243\346>\3014\004\234\324@\215\324A\375G]\331\300+\334u\216\255`K\231\032\264\360$\321u\327\262qX2\257Z\251:\354\232\207P\250q \2013\024)\343\314H \321\314\264\332p\242\251\262\353\021\340\265c\266\331:*\322\325\2752%\304;\013'&\302#\300\335\020Z\341\023\312\201O\3424\322\274E\020\t\301\242Ju\006\224\337\320\214OQUW\025*\254\307}\363F\034\3557\001\234\337~\352\314\311\356\301:\027\355\0271\224 \0300a\264\212\246\363\240s\321}\033\252O\b\241\365-\304\212y9[t9\324\005\002\300\272iHX\216\371"
+	.ascii	"\2375\2616AE\3429\317\212\2467\325\306L)\275kU\362\363\320\364"
+	.ascii	"h\205\212\265\227C\034\027\027\025M)-I\225\353\326 \322\352T"
+	.text
+	.section	.gnu.lto_scanJournal.27.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`E\007\355,"
+	.string	"\332O\250\021E`^N:7,\325\364u0=t\263\347\345E\204\377}p\314\033\346\242\263\244q\362\334;\317\372\261\n\305\002\267\027\276~\270n\201O\241l\314\330Y\300\003\263\224\333\334\262\361\226\262\322>\331F\b!d\357$\003\b\001\363"
+	.string	"\013\001i5\316\314lf\254\031uud\1778\240\33583S\230\253\332\236TQZ\233\357\322\336\214\212X\325\314W)\352\324\221\375\311\271\211t\2641\254G\211\347o\367\311^\326~\313\215\017sf\0227&\347f\204\236\260\036\355\346\005\244G\327\007H\217v\333\215\347\315\256\254zY%\275\374\3119'a'\275\336\366C\341P\020(\304\376|\253\232\242'\276m\377w\205\343\303\004\302\256\241\033\273\036\374\334\362\bpni\344$\346\234\377\265\334\272B'\004:\260\254\317-\273\316"
+	.string	"D\330\350\376\265\324\272,{\225\343\376\276\346\226Y\327w\336(vw\237[\02695\230\021\342\343jO\360\265$rW,\346\325!O\317\007[j\200\004\257\222\247\2007K\354\274\ry\321;P\356\224`1\177\246^YwJ\260\236\034\237\025\304t\264\005\257\252Nv\315\017\330\325~\255\256\216\367\252J9\347\276\312+\2547\200w_\251\273\227\272\323)\001\230\253\230\366\345\236\246h\342\304\211\364\250*\306\366\007/\016\305\355\243\334S\204\373o?s\243/\245U\254\270W\036\355\257H\217\372\304\330\264h\031\357\036\033\350\315\034\356\032\351"
+	.ascii	"L l\354\314\256\352\002\352\341\355\267H\221\336\315\324t\257"
+	.ascii	"\034\200\257\366\337\0232c\362\364\344\3008\272\233\307\213\271"
+	.ascii	"\314~\214)\0333\351\376\335V\360\333G7{\033\021\201\267\021\234"
+	.ascii	"\355}@\350v\201o\371\213\236\366\036@\304\336\036\n\327\333C"
+	.ascii	"\353\355 {\033\370\273-\364\333lz"
+	.string	"\373\227\336\366\371n\257\353m\365h\357t\275\215\376\366\251\336\306\351\355;\270 eK\313k\007\236\323\314>\366\004e7h\031*g\373\315~\264?\355g\367\277v\267n\266i\\Lc:8\366_\372m\315\202y\230\366l2\210\306f^F\321\371\260\036\025\336\007Hit\263G\357\317\356\345j\315\006\370\351\214N\203\273\276\337R!\356n\255\264`\367J\024\007\345\340\334\344\3008\356$\251\222\347\303\\}\265\373\254\274m\235E\270O5\305B\274\366J\205\272\234\215W\3529\237\026\013P\354-K\3169\303\335\367\264Z\272\035k\313\356\225mY\316\3574\270\350\n\330\331\232\217]\210\317\223\214\016\0342\354\3703\347\234W\314\3257%\342\027oz(\021\247\330\252\373*\021\217\212T\223\307|\0213<\206\244\230\253\327\313\270\002\007c!&\342\257A\206!\300\370\210\016\356l\216\232\236qO\320[.i\001\214"
+	.string	"\3435I\346\361\3565\276\213\364"
+	.string	".\200\357\366\005r\334\216s\322\266\216\033n'\243\216E\207\243\325yH\217\036\300o;\003\344\231<\274V\327$\016\245C\221nyZq\320&nZ\264\216\373o>\367\001\304\322\322\240n\021oC\265\346\\u\241\317\206\304\2105\347|)G\323\227H\217\036c\035ax[e[.\fA\323u\006N6\240b\234\305'\030Pg\324\247\236\234B8\271`\212Z\247\244\230\246b\240\335$\341EQ*\312\311\251\205\013\250'\030\305\246$\030PL/\222\232\244b$I0\352b\224\223T\322T\261(\225\3046\215W2\342#\217\341\020\322/\213t'4=\202\020>\034\302}\271{dQgO\271g\210\2070\005;jh\024a\020\317"
+	.string	"b\242 &*\300@"
+	.string	"^\222zF!\254"
+	.string	"\037\211g\204\205\360\307|\311\214\035\270\244\036:\205L\220\241\003\327\276\264\202y7\302\006\304\234\254K/0 \346\352=\275\026\213\205\272AG\227\210\330\22236U\027\320\205H\344\350\204~B\334>!\356s\025b\"lu\177'\276\276\023\327x\233\262\236\370\b[\021a\026\027\211-9\263\013\304b5\255M\036\363\207\327|\252\324\b_9\310*\352\336\251R\037\376\341'\231+\366\341'\365\210\360\212\037W'OR\017\n\253\"\335(\255\327\275R\305\301,4n\252\322d\245\371\371a.5G\003\200\216\250q0\245\214C\f\311\210\214H\2204M\007p\002\221\261\262s\020`UC\232\024\032\003*pyD\277\316\267\314Z\034\231dk%\211\024\322\220\201\200\321V\344s.\346\361\2649\325{\255x\316?\243\374\177[>\302\216\250\364#\343\203\b(n\322Q\345+\017\315r\276j\315\212\347\315"
+	.string	"\030\335iS\375,d\035\330\353\315A"
+	.ascii	"D\262\022\022\374\030\265\230^n#\343L\237\204\227\304\b2\342"
+	.ascii	"@\007\201\217\0327y&p\210\317QF\350o\031\364l\034$\226\004`\007"
+	.ascii	"\311B\305\371i\032ir\027{o\232G~\3349j#Qf&\334\205o\fn,\030\301"
+	.ascii	"\361*PEf\273#I~\036\374\202\337@\376\216\223\2340m\246\305\001"
+	.ascii	"3\347\201\331\237O\221\t\034\203/\314k\361\256\fTw\036Gv\322"
+	.ascii	"1n0\256\013\023*r\3018\242\370\324\326\206\013\021\013w\306\366"
+	.ascii	"8b\260\250\247Ja\034\333m\206\345Q\177\320\022\364\275/\r\355"
+	.ascii	"\214D)/#6A\322L\377\311\265\244\312\303%b\236\212#x\301}\376"
+	.ascii	"\351\314\256]mt\300y\236\276\324"
+	.text
+	.section	.gnu.lto_isEEPROMVersionValid.28.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\355\t"
+	.string	"\206\322C:0\257\322\001\304@\"\265\320\r\2435c\367!\216\254!\305\013\273\332\222\024\036\222\002\246\336\337\260\306\3100-\030\312\362\237\364a\200\261\rj\226\255\006ta\341\257\226\020\"wJ\0011"
+	.string	"2"
+	.string	"3"
+	.string	"\024\"\345.\371\251\306\305s:E\277tNm,\031*#\243\3055`Dq\002\273{\330\247j<\315\211\331\354\256gj\254\270\273\333N\260M`\273\f\207\375/\032\306E\3144o6Y\232\332\262\317\255\262lO\3179}\356'[\266<\334vW\267\227M\351J:l\223\354\214\013\fH\026On\254\356\"\t\352\215IO\234\266\346\356\226\324u\221we\bYAM\027\333\340AD"
+	.string	"\273\250\003\377\343\261\221\332j%\307;GH`^4\217]\323S\357\374\t\357\3355\346h>`\030\352t\024\034<\r \220\363\201<\013\237\217\023\216>\315\200\301P'\374 @0\3742\344\236[e\331\253\241\310f\363\027\275\303\216P3\221\315\324\027\275\251\252\020"
+	.ascii	"\252\322Ea:8\314A\314\0267v\204\321\305\306\002\031l_hf\025\027"
+	.ascii	"\306\034\314H\033,\217k\216*\035H5\264\t\245\f"
+	.text
+	.section	.gnu.lto_isEEPROMStructureValid.29.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`\f\006\265%"
+	.string	"JE\364\016F\200\234Q:\315$\252\244\250\213\220Ic\333jny\332\373U\225\330\22511%M\027b@\240s\003\376\330amq\213\036\243\230\261w\311\377\244Q\204\333\004Bf\030\333\204S\304\376-An\332/\371{\023\271\223\f\327"
+	.string	"\323"
+	.string	"\335"
+	.string	"|\346s}\313\273\230q\\\343\\\354\301\230uU\274\367\342^\231k0\343^)3\024\037\313\221\214\343\037\237\005\352Zl\230\327\352xu\230\2503\006\341|\345\343\371\342\257@\335\370\204\340w\274U\024\312\302\212\n^\331\301\371\032t\235}\245\037\262\257\374"
+	.ascii	"\002\024\373~TB\365&s\204[\370\334{\\\352$\\\251\357\270\233"
+	.ascii	"\355\254\331j6\365\361\243\216cJK+\236\031\321\001\344\267\263"
+	.ascii	"\251\372a;\362\t\304\270\200b]\242\354\370\311\246\312\252\226"
+	.ascii	"#\nqD \265f\0052<\250\236<\315A\f\232\224I\234;G\276HJ\225\017"
+	.ascii	"Zo\304\0357\377\003\3626uTN\2069\242\224\251d'\214\331\221\247"
+	.ascii	"SD \245\265\013\367^\246C\242\2163\320\231\231\f331W\263bx\023"
+	.ascii	"\266\264\256\212|0\017S\202)\317\276\366ry.c\231O\240\240\037"
+	.ascii	"\026h\030``\316\354\004;\212\251\007\232%fc\361\257\242\324`"
+	.ascii	"\351\3062^\205}\263@\312\221\242h\314\234\342^T\234\367J1\361"
+	.ascii	"\271\274\313\2126K\243r\357}\326+7\361jS\314\370\334\373\373"
+	.ascii	"\360\225\357\302\276\276\207l\205]]1\376\350\222\371\b\244\215"
+	.ascii	"\305\374\037\361a\004\007\367\021fKY\tG9\t\351\310\250\210\350"
+	.ascii	"@\001\246<`\247\263\224\005\334(\0175e\241\246\034\240F9\310"
+	.ascii	"R\316\335(\003\260Q\006\262Q\306\325(\337,e\233\215\362yR\256"
+	.ascii	"\335x\266M\271\326(\233\327rn"
+	.string	"K\231V\312W`!\354*H\023:-v\274T\313\264\033V\305<\271\361\327r\312\001\215\324\271>J\243\006:*j\240f\352\223\274\225w\033u\016M,\250\005\374\230w\343\212l\343\320\274\204Bk\2247l\267\3265Q\377\313\32677\266\256I\345\231\361G\227\274\243\265\326\365\331\007\032\301\256\317\276\360\317\257\326\275\347\013\2271$g\316\306\342j\240\330\006\371%E\321\332\353G\227Y-\214\303\321\330\327\301: \215\335{#\274\256\241\367\236\275\354k\355\036\022\314l]\327\276\237\240\026\220.\231\266\331uO\022)\226\374\323dE\240\234\331\306\342'\317\241L\210Py\036`\340G\2304\013\364\256\247\236\374\206\262!B\345I\324G^\310<\327\275x\265->h\236\206\311\354\253\256\247@X\332=d\234\0177\003\242\314\210\020\347E\364\223\247L\212Y\346\275\367\326\035\245'a\371\0012\336\324kjnj"
+	.string	"\303\251'\203\307S\341\342E\213\030NMK1^\254\200\261\324\324\233\261\324\300\210\235d\360zK4\234\234zK\270\343\357}\204m\2312\251\274\375>{\3449\220\235%\225\315\367\331\001\003\232/\374\032\210\023\2206\324\002\320x\013\316\206\372\301)@\263\357\261\341\253\342\263B?\364Y\261\257Bm\333\202S\305\252\210\006hf\037\026\f\364C\306\021\221\352(\016j~\036\336N\t\236"
+	.ascii	"\315 \250\245\324AII\336,\323\376d\223Z\251\373Kh\325\177as\235"
+	.ascii	"\324\357:\322\033%P\254\353\nh{l\371r\253\273\266=\305f\325u"
+	.ascii	"\367\224\004\252?\331\243&p\245\017RN\256\371tN\366\304\317\342"
+	.ascii	"\f\032\250\206!\236\037]2\200\3165\325#\374s9<\2428H\r\240i\364"
+	.ascii	"\001\013N\001\322%\233\037\262\035q\250q4\002\021B\210\t$\230"
+	.ascii	"\031\221\2216\351p\002\221!3\363\020`X\322$\351*\246\251\304"
+	.ascii	"\206\352I\344\037\272\210\267\323_\214#3\177E\322\202\245\t\f"
+	.ascii	"\271\315\273|\226`\221\311H\027B\363s\177<\226\210/A\330\372"
+	.ascii	"\362\363\344u\251\340\002\362\003\346\032\005C\031\022B*zU0U"
+	.ascii	"\227\2535\201\327\2620\025\372\376\243\371\005\034\365\365\377"
+	.ascii	"=V\301\035<\026'\326\325\366\006\360G\241\234\242\370R\204A\313"
+	.ascii	"\356\003\206a\035@\"\315\360\203\251\366C\204\0355\314\252\351"
+	.ascii	"\324\036$j\242\221\343\207)\302x1\346\360X5]c\326\2600\206m\271"
+	.ascii	"\306 \334\211\247\315\255\323\354z\374\213\fe\203@\343\302\347"
+	.ascii	"h\336\275O\020<\246\001hpr\254\266\374\355!\213\013\211\221\214"
+	.ascii	"<\223\314\325!\343\326~\024\232\371\317\236\327\322Q)E\316C\n"
+	.ascii	"\211'\306;K)2\250\032"
+	.text
+	.section	.gnu.lto_getEEPROMConfigSize.30.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"\342L/3Po\322\001 :\r;~\023\036\365\237\247Z\0277\277\205\365L\035\212[CH\367\350\032[n\375\004\00213\256*\214V\b\004\022b\036\336\366&R\246\024\2362\233\007;\024\245\320\240a\340\274\311q4\013\0337A\007\2271\360\353P\320=\274\007\035&\356U\224Z"
+	.string	"\322\b\373\"\217\226\277a\bO\376:\363=\355,\025\300\002\224#;~R1\354K\253\"\333\351T\002\217\224\352dwb\304\262(\254\204\303vec\374\217\203T\2662jP4\022\023\211\221\225\335\350\002>\320\316\362\002\355L3n=-\377!\227:ZT\256\320\347yI\330]\347\025\252\270\365\266\017l#\330\276\b\t"
+	.ascii	"\252\244\223iq\326\0311C(\256\211\267\0218\013\221\207\273bj"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_getEEPROMStorageSize.31.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375 \337%\006"
+	.string	"\"\013*1`M\323\001\300\006\\`\222{\031\261R\223\240\251\336e\001\025\0202\232h\227A\267\364\036\3405~\303\300\220\201\025\333\177XJ\226?p\023\273wJ\001n\030HN\311q\026\034\236\206H61z\030\240\330\314\207\310\030XJ\316\214\020R\316\270\324\375\313\334\356),\220x\023v\245\334\253\260?\331\227\331\356[\206F\022\341\261km%;\242\204`\330\236\354\305\327\370\306dJP/0h\211Pth\2735\272~"
+	.string	"^\t\270"
+	.string	"\274\362,N\357\250\177\216+\200l\037\325E\335\001$\354\256]ua\367\273\355\003\333\b\266\247\t"
+	.ascii	"\252\244\223i\261\317\f\t\016\3125<6bh!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_findEEPROM.32.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`\202\0045\037"
+	.string	"v\270\307I\220XN:\304\314\216\017\030\203j|\3468\251\330r\275\217\3578"
+	.string	"k\362\207\312\006\b\007z\005\375\275\272\"\342\376\013\376\017j\007\304m\271\340\216\310-zy\0033\002\254b\021G\200\366\027}<j\177\273\265M\b!r'\031\264"
+	.string	"\247"
+	.string	"\266"
+	.string	"\314^?\233\213v\217v\301j\241v\257P\301I\226\320\302\037Y:\227\212\321\3466\351"
+	.string	"\322\300\236\364\031\271\326o\255\370\315\275Uf\312\356\025.`\006\366\344\211\274\310\022\377z\204VS5I\212\300\2571\367\nu,\274Ny\322>W\236l\036l\353\3576k\226\344\330\365\3077!|\275\302\031\005\026\205\262\270m4\235`"
+	.string	"9Z\214\033\343\20355%'\236\325\026\3301\225\336\304\241\300Z\216\t\250\244\314\320\261\242\243\313S%\255\215\2174h\323\350c\366*\205:\325>\361\035\260\\|\3111\225\276\232\020\356\275\\\243\320\251\363\355\314,\204\231\211\230G\020\001\366\336&\007\374%C<\376\325\212\362\244N?\354\007\240\214t\3710\262\305T\213\314\302\263v\220\371\017\254\326\324\270\253\270\007@e\236\035[Y\307V9\307V\316\275\354\214scSs\256\237\346[\177\200\213\235o\266{\235mY\331\304U.o\225I[\345\321Vn[\271\232\225/"
+	.string	"@\217+\364P`\367\302(\226\271g\244\222 /\373\305~\2577\363\231\315\030W\366+\203\365\"\203Er2\245\217\361\275\254>\344\023\305\222\260`\271\270`\225\370`\017c\306q\212\017\271\201\226{/.\0053\356d3/\361\277\030\307\001&M\2239M\346\314"
+	.ascii	"\317\364\007\224c\3474W`z\362\204\243U\030[D:\246\305cD\210Y"
+	.ascii	"e\0079\327\335(\272\266X\370\331\256\n\t\f\277\376\214\224H\346"
+	.ascii	"W\270p\205\221\035\344\277\177\370\240\362c\354\252\003\225\265"
+	.ascii	"}]T\232\352\0323k\270\024\240($6\330+\016\345\311\332\035R\242"
+	.ascii	"\326\026\323\220\337\032\247ov\240+Pb\236\262\316\006k\342\204"
+	.ascii	"v\007\235\374I\022\377\212=|\250\217\372P\236\274\351\023?\202"
+	.ascii	"I\207Zi\256\3224\210\020\365Q6\355\343\324,8\327\357\177\235"
+	.ascii	"\254\221zu\245\201\235!P|P\251\323\271\356\t\003L\317Z\344\207"
+	.ascii	"\261\320\231\354\002<\342\247\bIW\204\224\033\362\365v<_\211"
+	.ascii	"\364\241#\245\036\021y\3243:!\2643\"2JJ\022*\261\243)\342\371"
+	.ascii	"\232w?&z>$\036/\250\310\210\350\250\267\323\035\031\t\231\320"
+	.ascii	"\355|I\272\037\003\334C\342\371t'z=\237\016'd\372hm]Sss\206f"
+	.ascii	"v\306\324\247\255\203\\\003\305\3349\216!JVo\372\326R<\232\366"
+	.ascii	"\301!JUm\332\326R\2676;BZ\004\223\034\362\361\336{\255\331Oc"
+	.ascii	"(c\253\304i\036G[\333\226b.\373\326;mzy\312\352\351\222B\214"
+	.ascii	"tx\246\201\025\313<\250\344\351\236\356)\300\364,*k\363\364\311"
+	.ascii	"\216 K\2223mHu\326b\r[\250A,\005\225R\006\021\021!\0211I\232"
+	.ascii	"1`\002\031*\244\036\020\200U\224d\330\fEfU\225\354\326\031\201"
+	.ascii	"j\032\330&\361\216\223\242A\355\0012QZ\267~\214 \236\"\331j="
+	.ascii	"\261E\211\016Z\311\326n+B\bC4\274\364\013\213i\310`\315\213\257"
+	.ascii	"\265\007\022Nv\3621\321\007\347\233ev!m`\005\276\355Vx.\335\252"
+	.ascii	"\" \220D@\fG\323.Z\232`\025\231\267\323\027\300\377\211e\252"
+	.ascii	"\332[&\321\331\214\310\3343\007D\255\206?\245\333 \241;snH\333"
+	.ascii	"\2601\255{2\031\n&\263\203\023\204\261$\371\305V\222\033w\376"
+	.ascii	"\027\371\226\",:Nw\355n,\005nb\254K\267\271\3248\205\311\343"
+	.ascii	"?"
+	.text
+	.section	.gnu.lto_loadEEPROM.33.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`l\003m\032"
+	.string	"\246q\257I\260XQ:\320J\260k\341\302\326\001\246\213\227OH\352\253(j\205z\342\356\220\0302w\227\325\327\231\367\344\241\227\375\325f\2606\3266\242\007\205\243~A\032\300\027\370:D\245\020?\332\037F\312b\200g\263\204\354\275\345N2\233"
+	.string	"\220"
+	.string	"\240"
+	.string	"\374#&\337\223\021\230\225\027\310\362\300\225\275\004\257\334`|e\007\017zX\366\222\b\310\206Wd\003\206\271\267l\365\017\266F;\246(\243\035\223\324iy\036\247\354\252Q\264\225\366\224\361\217N\213\350\270\320\244\224\344fWQ\321\007\250\350Vf\354\250\004a\360\351I\2649\372\b\322]\\\345j\334\2167^\311\234\215\022\270\367\312\344|&\2455;\246(\231\334\017U\020e\204\343\300O\\\2566\373I\257<pN\275\251\035A\272O\021\347\336\313\363\226\013:\257\316\314?f\306an\020\001\223\257cY\315lbg\376F\323\007\376>\226n\f\231\n\372\364\254\2218\361\311u\0171\227\263)\201H\330\205\273\007\263\315\177g\232\231\373\316,\362\275\363\212'\217\343d\261N\266\342\344*N\246vr\327\311\223N\376\215"
+	.string	".JP?\236\220\226*/\320P\314\245R\237\204\374\367\373\376\336\233\371\314W\342\003\231\374\261\300\241\275\300\30032\204\302x$~\022\223\257\374#/{\356kA\257\256\274A"
+	.string	"\240pN\023\312\337\330\327\3615\366\365\314=\001^tRhRKDhs8i\210\003\246\206\r\3637\226Y\332\351\230\n\326z\366\027Pd"
+	.string	"\261=\364I\244K2\245\312\354\330\337\021`\316\266-6\207\016\363\267\2619\350\260\365\214\371N\260\337\230=\274\351\303\253\330t\311\315Fm\333\223\211m\f\200\341p(|\nK\273\266]\362#D\233C\356\246}[\2103\211\350^"
+	.string	"\004\351=\373\206\206\005\311\030\036q%\256\361\336\032\004~\022\020\2571\310\353\373\001\017\030F\350\b\311\305\034N$1`\264\320\036b\026\226\246\333\007\374\242\264\2456\205\314\n\256W\254K\274b\315\303\363r\271V\360\210\354b\260\003\213\241x\275D\224\320!q\002\346j\235\320\031\261\323r\305xZ\f\n0\f\305+\326R\001\203\305Zdy\203\247#\33133\227\361\223\343N\005]4-\250\352!\216\200C< \234\\!GU\005\230E\250\307j\034Sq\325?\372x\205W\304\3264\177\231%\237\344\214\367\376\374\306or'\027(g\310\261\277\275\362s\354+\313"
+	.ascii	"\214\030E\276/PQjSxz\357\275#\245\244\352\n\357\210\255\251\376"
+	.ascii	"\351\253\3061#x\215e\265M?\351\026\002< P\002A\b\3176\252tk\f"
+	.ascii	";\303H2\245\324\314\213\325/\344q\n\222\252\257;\031P\252\325"
+	.ascii	"kZ\205Q\f\3723g:\261$k\324\220\327.\261JG\307\301\332\347\352"
+	.ascii	"\222f\370\363c1\032\034\300\205\241\272\362\202;$\f\263\034\311"
+	.ascii	"5h\007\332^n\265\352\260\220d\333h\360Q4Q\311\021\214\322DA0"
+	.ascii	"\230\006#\323e\263\326u\262\341\022u\003S\244?\036\034\270\r"
+	.ascii	"g7\360\270\332\306\025\206\322\350\337\253\021\016\331\346\036"
+	.ascii	"\2545e"
+	.text
+	.section	.gnu.lto_writeJournalEntry.34.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`\237\005\355#"
+	.string	"\212Cx\016E\200\252Mc\310\3511\200\025\224\320m\311\253\001\320\005\302\201k\006r@\262\036\272\222\2244-\034\367\0075\342eL\314\241\033\001\261\301\214\312[F-\317\372mI\341\033\037^\230V-\336\3421\365\266{o)S\n\315"
+	.string	"\307"
+	.string	"\330"
+	.ascii	"\272\001\301\036_>D\230''\224\027*\233\354\023\314\211~\030\237"
+	.ascii	"_P\247\017M\256!F\241\302r\357=\235\374/>Ory\027\247{"
+	.string	"y\232\355\200\327\007\0063\\X\304\356\005~0O\006\325\013\331\250/\364i{\213\215\337\250{\337\234*5_\367\372\200p\322\032\314\252\345\006\202\240\013\025,r\341\325>\326\263\240\007\3428\201{\223\304\031s/P\202)\230'\r4m\373W\216\005\265\267B\344\330\371&T\241\351\t\305\356\275\264\331\017\224'\307\013\225'\355\222\243'G[Q\377\302\203\340M\211I}\272\223B>\006\360\t\271\035\205\246\210^@>\2501\202\227\325\220\013_w\370x\265\372p\270\367\272\246\276\037wy\333H\266m6y&V\307\305*(\007\252\352\361\211\013\221\\{\nv6o\203\204BE}\252\242<y\013\340g\276Ai\257\270\360\3115\323\016\213\272\301G\3634,|'\276\260\205\237&\225'}\252\206cTW_\273Zf\003y\325*\261?^\233\304>\3616:\253\213\316j\006g5\321Y=\364S=;\253\r"
+	.ascii	"U\0278\360\017\272\226\037H@\265\031\240\332\347\254.\005T\223"
+	.ascii	"?\325\343Ym\317\352\032\240\372\016`H\221\352\341;\217\260{\245"
+	.ascii	"\312\306n\027\231\005\345\304?\353\337rk\3377\3633K\3272\323"
+	.ascii	"oLl\251\314\271p\327r\212\337X\225{\357\211\023\363-\373t\323"
+	.ascii	"\265\374 ?<b\037\372\305\2179\031\364Y4f:\340\r\244\275\326\213"
+	.ascii	"\350\224\247\327\272\260Ej;\241T\352\323\322\2620\322\263:\333"
+	.ascii	"\250\225\343A\257\230\367^\322f\210\203\265\253e.\262\243=\203"
+	.ascii	"Ra=2k\007\300\271\367\326\016d\355\211D\252N\024\025OAi\243W"
+	.ascii	"/v(`m4\313\213\035\f\330\002\366=\262\237{\253\034\262\006\354"
+	.ascii	"\317|\254Z\3225\2457$#\262\266\207\027?\270\366\342\307\261_"
+	.ascii	"\030\357\315\027"
+	.string	"\260]\234\017Y\"\213\340\016\227A\234\216\210!{\256\023\351\270\252\326\036\361\342\223k\003\202=\302R\260\362\r\312\"[\355\213'\253\374\302\202o\206T\013\312\376T2\260E6\301V\357\307\253e\376\226I\034N\t\363^\250\232\377\306\205\t\337\311I\006\366['\332\201\025dr\205U\275\254\246\310X\253\3047J \033\216q\244\304DSb\022z\221\303\331n\271\322\226\263\331\334\355E\322-F\251t\313\331\334m)\351\226\253\321d\332v\264\204\3131\335n-\224d\300\230\201\263\321f\310HZ\242\331rM\264\243!\343\230n9Z\r\034.G;\201\273\217\327&\231\331\331\316\362lcK\205\032dm\224\bZ\244>\235\331wyYuAY\035\371\240~\317?\374\031Vu\345\3712\022~\344\232\032\322\352H\254:P$Ep\210>q!\252D\002\223\223\266\254\314'\242K\320&\365\251\221}\230\233t\246"
+	.string	"\363|EY\335\247\210^QF\032\343\275G6<\353\377\322\342cMk\301HT\335\231\366\250\211\217-\221\374\312\364\310\036\324\362H%\024\220\007\325<RYc\022\364\004\205R\237\372]\274|]QV\347\262\252\272I\301\214\352h\003e\250Q$\204\224R\310)\201P0\001\321$\2056\200\"\0313\363\021\320\271S4JeX\003*NR*\244\274\274\245\2712\304\223\205\216Y\335|\232EmlZ\017>Q\2435\034i\006(\330\266vI\254\330EfV\313gZE~\006\213\001\240\265\374\025\217<;\245\233\027-V\372M8S\263\210\221\221\334\275\233\234t\031\245\245u\232\217c\\\272|}W\361\034S\327\364\366\024Q\377\002\322\326[\032m2 j.=84EL\016\375\224\361\r\262)5\037m\344\366,\030V"
+	.ascii	"\323r\233\344r\264i2\255\322G\373\022\242&u\357\365\335\364Y"
+	.ascii	"9x\321\274\037Q\366a\276\227l\274\033/d\315\326:;Z\\h91\313\230"
+	.ascii	"9Z\r\202\032b\222\330\007\336\177\355\256\301,5"
+	.text
+	.section	.gnu.lto_isPGChanged.35.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`%\003\r\030"
+	.string	"6\356\237F\260\032Q:X\206\303\030\305\346\220\261\\\t\341+\013\252t\b\036\017\037\017\370\355\270\020\032C\034\367\366\350\177\254\320;5\276\206\226\377\214G\312\273A\334\343\037\306\321^\215\275\342\f_d\373\217\312\037\t\331\233H)S\216"
+	.string	"|"
+	.string	"\227"
+	.string	"[\352\216a\204\202\310\324Z\356\354\274\203\220\371\337\241%\352\331\"\031\313\252Uw%J\255\245\2023\bw\276\334"
+	.string	"tg\2709t\347\3777p\320s\037\001@?e\026\b\365\300%ISk\331\352 \353\263 \235_\263\317\227\002\341\221%7\376,\230\032q\237N\255\225\336f\250c\277/\200\026 aR#\320\207 \350\n\016q\264q\177\tzB<Rc\355\313!\233\364\326h\231\306hc\006#\324Z\317\271\361\306>\334\377\264\377\032\376\266\020\374u\321\233\376_0\336\234\330\337R\217h\t\250\177\376\262\306\275\373\367\253\255\373A>\353\374\025\310W\201\374\024\310\307\241|\324\226{\021\344\237\266h\367F\344\203\"\237\236\370\363\206\377\205\374\006\371L\371\013"
+	.ascii	"\005\246\306\270\344\230Zm4\261\251Ks\312\220-w\377\375*\331"
+	.ascii	"\244\027\213\3443H\2454/\276G\213\364\213\207\261H\276C$\317"
+	.ascii	"\b\214_\334\311\177\317\327\350\342\3772\306\252\006s\210\344"
+	.ascii	"\325\272$\021h\332\f\364\324\254\036\300\303\355@\272\206U\342"
+	.ascii	"p\352EZ\336a\345\314\206\235\302\201\273\003\311;r&1K\260\314"
+	.ascii	"\336}\267\301\350\210\240\371Z\207\352m\262\306\227\037f\270"
+	.ascii	"|\301iT/\256\rj\317\243\251\306i\001\274[\233\0327}\223\356a"
+	.ascii	"\241|x\242\002\304W\210\f\2723\325\233\264L\256!\303\206\350"
+	.ascii	"!\266\211\210\260V\333\203/\223\023#"
+	.string	"\302Z\353\n\331\271\335\201Tb*\242q\023\367\204H)\335\273o\f*v\217N\206\034y\261\261\232\253\002?\301\003\223\265`\262\234\022\263\230\3535\243\260\327\254\357\342Y\021\233\311^\257\0210\024&X\304\\-\026(H\254h\271f-Z<\005\036\223\275f-\027\261\330\254%\226\264\375j\353\316tg\371K\260`\323\370\277j\035Z\327\016\366\252\0277\301\235\245mB\207\273\277\236\375K\230\300\233\243\r\301\307m\255\244\330\334Oa\253T\3309\273\235\344r\\X*\030\276^\034$\217\351@\221\034:h\357T\315a\357\210\256\001\312jU\237oA\254\356^\243\r4 P\002A\002Dx\003\242LSJ\007\304\264\323\231+k/\237\302\016\344g\321\271\306\fw#\316\354\232\253f\013_\321\001\323\2037\320\201\230\017eV\335\020\265\361\272\223\343\245@>W\271\240\237\026\004_v\250 \211\227\215d\346\021f"
+	.ascii	"\266\303\235\260\302l\215q\2107\027\0137\3550\222YZ\024\260<"
+	.ascii	"1\243g\245\331\"b\355\003\272\316\323\305\025\332Y\302\325\201"
+	.ascii	"\2212\334\200wF\305\314\031"
+	.text
+	.section	.gnu.lto_writeSettingsToEEPROM.36.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`x\n\0358"
+	.ascii	"J`$\025DP\036R:O\007\306Q\2321\241\307}\3438\370Q\345\003\330"
+	.ascii	"2d0$^\024\317PC\3770\3721\210T\362"
+	.string	":L\003\237:n\253\341P\001O\200b\362ax.\005]\315-\025\371\357pi\315\023B\366N27\001*\001H\001v\215\2029\3453v_\315\337t\003;\306\355\372gL\351Z\316\031\330\246\017m\240\233\251hs\320\326\357i\372uk\316f\353tT7\023\324\fT\303\371\373\220\215\321\r\374\212\273\267\372[\336\345n\177~\314\311\334\314\347\032x\346h\266.W\205\224\343\344!\266f\226\253\337\327\233\257\304\016\3312\307.*\3156\252_\034\326\3632?\3635\343\364rv\032\177a.f\353pY\027\023\324t\263\342\367\225I\375\220\375r0[\177\223\361\034\226\207\3524\337\350\345\\v\342\367\265\001\373!\353\205\206\232\201`\270\222F%\3472\021o;\227\255;k0y9s\0310\351\204\356\f\205\337W\244+\261_\357\207\354\327\263\331`\352rf2!\274'u\330\234\276\266\203\337\327~\360\264\325m"
+	.ascii	"\260\256=\r\232S\224`\370rv\0221\223f\233\3148:Mf\\\336U\347"
+	.ascii	"[\275\355W\025\337\266?wu\r\355\256\353\253*\004F&\305\310\f"
+	.ascii	"L\235\320\247'\367\272\3371\263\344U\253\234\035\277\356\013"
+	.ascii	"\230\203\334\362\340\314\316~\2050\344\234\373.\315v\274\331"
+	.ascii	"ww\262\273\177t\023\221\bm\223\366I\373\004\247`\342\001\004"
+	.ascii	"D\301\275\237\023\325\360t\372V3\245\255r\277,\200O\227\227\206"
+	.ascii	"\340\336\267W\330\247\271\231\026K\204:m\226VKS\336\217h\030"
+	.ascii	"\356\352\267m\371=\312\227\330\356\226\313\315dh(\024\314\273"
+	.ascii	"\265>\004\356\315\371\255\206=\356\020\005,\022\366;RPj9{}\331"
+	.ascii	"\257s;\036\372P\2766\b\251\373\245\024\373\365\030\247\341)\245"
+	.ascii	"^w\332\001\356\323|n\304o\331]\342\304\375\262\357\033\226\""
+	.ascii	"\200\364\276pW\2673y\261\222\356OP\353\323k\234\244[x[Jx;\204"
+	.ascii	"\3606\b\341\355\017\036\2428\bo[H\272]\341l\357'\242SS\001\341"
+	.ascii	"\355\245\323\275\225\222\202\267\207\302\333B\341\355\240\360"
+	.ascii	"6R\360\366Q\360\266Q\3606\200\340\355\242\341m\340\3606\021\322"
+	.ascii	"\355\241\340\355\237\360\266P\3606\033\274\275>\356\255\"\335"
+	.ascii	"\306H\267\357\321\355\213\210QF\246\303\354i\317\234\311\246"
+	.ascii	"\202rt\225\233r7?\335\317\366;\177/\377\333\017\367\307\375e"
+	.ascii	"~\271\023u\277\217w9\305\333\365\025\332\227\265b"
+	.string	"\364p\214\017\254\022\366\200_\367_\036$D\356\302\254L\2519\037\271\240\347e\b\003qQ\024f\342\200\213\360\0075\001\342[A\213\313\3226\204\211\360\355 t;v\225\2649~9g\"\314\300N\233\024\036\302,\022\265\251R\372\364\343\220\204\177X\bO\315\356\320\226\f\312\356a\356\244A3T\300\320\f\026p\005|\245\264\350\003\266\200/\347j\025&Q4\3177)\b\fm\2214\324\241W\365\230R\267<\270\275\353\343\0370\b\034\300\017\234n\315.Z\313\343\003>\234\037\270\261E\bC\261\032\312(ID\317r\217}\002V\n\013\341C\277\2561\247\311\274\267\002\323c\261!\260\024\026\240F\t$\371\246\333\036\267G\215_\316_P}\317L\264?\372P\250\330\257!\360\337\374\300X\033\030\034[\332\274\356\024?\331\200\231\341\262\263NM\230\305,\036\221\247:\246e\336E\025\334\273<Qm\305M\230\251"
+	.ascii	"^1\2137\344\217R\212\340\262\3176\355\313\315\005{w+d\211\310"
+	.ascii	"\237\031\332\310\237-\022\242'P\362'VCi1\365"
+	.string	"\254\365\351\226\311\307\264W\032\352\bO\310\335r\017c\351\227{\027c\374\260!\311;\355~\337\003\265W\372P:\375\202\301\324\025q\352j\210d\247\214H\2144V\2610\"\265\262~Hc\013\026\306\027l\021Y\304j\013\344\261h$qtaEE\2044j\035\217.\330\"r\203\025\013\252\026V\035\246\2504\2640j!\2153\254\250\222\262\262\214\305\242\214,\241.2\250:\"\257\214F\025ST.\254\216E\242\025\025\213*b\021\231Ed`\240\217WF$Q\353xD\022\201N\257\253j\022V\237\360\243w\246Q/\234\354\032N\032^d\274e\301\035\313T\3119}\210\237\344\222w\252\207+\320\375r\210\007\274\2619\003H/\352^\036\347\303\345\007F\237(\330\345\002\304\025\310.\372\205\273\272p\r\372\252\213\n\361\235\377r/\210\205\370\316Q\242-a$\034\034R\236\035\341%\334W)];\021#\341"
+	.string	"d\302\244?#|\204\037&\210\210\2150\001<'wD"
+	.string	"D\314\244b"
+	.string	"\230\305s\362TJ\021\270qM\363\035.\311\256\273a5\024\035\032\031\276\025+i\th\t\372n\267\311V\354A\230\203\370\224\360\330\241?\331\333\234\016\034\205?\367\347x\343\242\343:\341$<v\251\264b\277\234\303\244\334)-\230\332*[1V\214\375\252\204\213\226\270A\277n\337\325\234sV\233>\f\200\326\250Q(\310\024S\246dDDF\223&\303\030p\002\2211\243\252\003\021`-tJF\002IRP\250\264\031\371\021\236>U\207UU\362G\036G\242\245\340\t\204\301\264\002X\002\257"
+	.string	"\260f\200\240\024<E\357\217\271\211Qm@6\222\300\b\357H\356\222\266 \303)\252\217\030\361!\215\364t\375\034s\300\350\317\t?\273Q\036OP\273=\376\302\216{\200:\240\"Q\005\306\243\275\354\310?\353D\220\355\275.Q\002;pv\034\215\354\224\017:\322\366\212\374\203\2166[Dx\207!g\226\254\241!pTQ\315\302\257\005/\275\234\210`x\215\307Z\354\275L\333e\034\214Z\330\352\263*\343_\026\256\353\n96\331\240\360\243s\203H.\0179\0032\316\221\224`k;\241\207#\2406\275qn\231R7\210v\272\320\020\216~\257e]\237jfD\207R\232\275\210\236\242:s\304-\327\300\226X{q\254\331\376\210\r]\323?\002H\230\267\266\004\207\221ar\350U\376\331d>\017\001\350\013\2710K^\266\3366w\006\256\b\210\276\003\346"
+	.ascii	"?\257\256\017/\211\035\342\220\232\303\221\001\242D\035\237="
+	.ascii	"\\\253\250\267*eh\202\037\2254\226\231\214%\233nx\311\240\375"
+	.ascii	"7\2770B\213\257#\210\327t\320\371\t\335\203\222/\300\267\264"
+	.ascii	"\253\035\276\366\370\335W\327 \215\334\nm\036\033\211 \230\344"
+	.ascii	"`\246\243#\222\214/\b\212\257\303\223.(6\003\340\001\211v\033"
+	.ascii	"\373U\0376\375\247\205k\024M\304\343f\002@\t\316\027\3108\213"
+	.ascii	"w\364\271\242\241c\004Wb\263]\216\007\233~\321\357\017"
+	.text
+	.section	.gnu.lto_findChangedPGs.37.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375``\003M\032"
+	.string	"\246\261\254I\300VQ:2+\237\021$P\270H\260r\0068\276\233\222\3033\030*\236\272\253SR\201\275\b\270\362\323?\265\332\027G\310\233\267C\214a;\342#:DQ\373\213\245T?\016\330\346\006\3206\361\b.\026\001!\233\020\271S\n\226"
+	.string	"\220"
+	.string	"\235"
+	.ascii	"G\232j\255\f.\232\002yq\332\037\272\020\332y)\256\252\265\206"
+	.ascii	"\221$\265\362\034\030\002y\321<\362?\016\204f\037a\330\251\225"
+	.ascii	"\017\204\2008\"`j\255,\003\027@/\206_\321\213k\303t\307\f`\226"
+	.ascii	"\0353\200I\017y7\235\264\217T\fw\322\374\336/\330p8\311\225*"
+	.ascii	">\206\343\216\013\034\251\022\027NpjR\362\337\247\256\264M\032"
+	.ascii	"\243#\306E\030\017S\345Nh\240\326\212*os\377\273\350\023D%W\306"
+	.ascii	"\370\034+\324Z=s\345\213\233\274\355\036\333\033\354m\005\013"
+	.ascii	"\250\177\304\203\316T\002\362S\320\2131>AHr^j3h\363ls\177\354"
+	.ascii	"O\270\341\324\344\255a\223\3234\344\364\212\234\236Q\311\244"
+	.ascii	"\316\373\001\214\323\250\373\356\221\236\350\026\351tH\247\227"
+	.ascii	"NOq\372\002\002\370\330R\036\250K\255.\202O\025IT\222\343\276"
+	.ascii	"\237\310/r`\211\027\231\300\215\022>\221\033\331(\243x\221G\032"
+	.ascii	";\246\017\361\177F\331gB\246V\251/\237\204\2404\325\312\263\200"
+	.ascii	"\302F]\2346\315\357\031\345\023\371\350\365E\375\212+B\001+:"
+	.ascii	"\256ja>ATxx\330fp\212\rNWfczA_\302M)=\347e\347\206\273Fxzfvw"
+	.ascii	"\261\340\302\2203\364\261c\352%\025\331m\360\3516\024\2653\273"
+	.ascii	"Rp2T\017Ai\026\265\007>\001\026$\266$_O\201\340m\350jiv\300\021"
+	.ascii	"N\206m\006}#\337\234\211\213\254\365\026\301_"
+	.string	"\"{\371@&\350\305\325\336\350\btC\275\026A\206j3x+KDE!\t\372\235\365\264\334\246\223\001\314q\355\034\020\363\271\357\177W)-\365@\272\255\212\3759\331)\327\344\003\376P\203#c\341\310V8\257\331\216\200\221\210\271\304\327\211\234\f\035`/\231\354&\306\256\032\235\330L\366z\331\340\344x\200\305\\,X\316\215\016\3135\023\301\2529\340\230\3545c\215\210\305f,\024\257\366\220\322M9\245BZ:B\252\255m\334\037K\330\211*\005N\323\032Z\247\261\343\002f\\\235CQ\334\367~\026\276'L\223\301\351\352\246\264\310Zy\236\363\243\\\312\206\220C\213>\327\242\027\307\205P6\351\322\213r\233N\017k\255\225\356\217\377\373a\360@a\ne\326\341\322\025Wg/x> @\002\202\224D\345\001\3302OM\272r\206\256\031\202\354\013\265ms\305\354jtg\323a\023\215\212U\201~\004\266"
+	.ascii	"zdmT$\330\220\t1\254\341\247\214\354\235n\343\207\205\363\355"
+	.ascii	"\236\027&\372\210\321\205\222\211P*H\t\013\313\201\266\327\314"
+	.ascii	"\\D&06(U\211{uxm\202\331e\267Z\320t\350~\300\005\207\2571\026"
+	.ascii	"`}X{Vf\257\255\250\022\302\325]E\324\bBdN\222\r\310\304z\352"
+	.ascii	"\336!gDb\310\342>I\345N\367M\255y\002"
+	.text
+	.section	.gnu.lto_writeSettingsToJournal.38.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`\025\005\345!"
+	.string	"V~\334J\220\330Q:\020\307\004\371qb\203\r<\265\276\362\267/\006s,\234\316\206s`\313\336\203%\003\345\317b\254\375\24367kA)A\025\303\036\222\0261\210\001\206\371\364\207\210c\3665\361\323\213r\3131\035\317f\244\021B\344N2\313"
+	.string	"\272"
+	.string	"\313"
+	.string	"\306\333K\261\370Hv\221\271\227i\347&G@o\332{\233\363f\316\005\2347Y\302\004$V\007"
+	.string	"{` l\231\t\205\220\271\327\250\353\032\247\326\023\231\026\255'\262-/\215\347\233U\217Ko6\264v\232e[\225\337;n\275\210\365\0072\352iY\003.a\375\n\223\214\222\007-\251\344c\267JD\241\275\321h\202\272Mg\252\351\351h\331 \231d\314\2570=\2256KX\303\353`r\262\265\217\335\244\342\202\322u6\325\004\3653G\f\246D\2375\313\006RR`\344\210\300\322\306\n\225\227\257\327\321\301\024e\313'E\275\313\002U3\316R\342\257\314\211\202\024~\275uA\364Y[\303p\357e;$6\235i\316|ff\016\314e\220\275c\021Ij)\273\370\203\361\222\262\321]d\365|\377\254]~\026\215\371EnD\345_q\220\220\375\360&_\250\277\376"
+	.ascii	"\361I\231\224\227S\222Mc6\366l\027\231o\263\274\310b\206\273"
+	.ascii	"\212\031\207-\337\260\345\232\037\3179\3232\r[\306\335,\247\246"
+	.ascii	"\345\233\315\262\355\264\214\236\226k\250\345\263f\331<-\227"
+	.ascii	"\246\345f\313'\200\343d\305\"\266\365\245"
+	.string	"\267\030\357R\232\231\2134\225d\375\370\177\375aof1\376\030\247B>\004\351G\025M5X\270\240\0305\2407\331\210\236\031\211\017\366\225S\343\203 =lE\316\317x\211\2655\313\210\244\002z3\247\344w\335\013\351_-\312\353\024\271>\021\225K\005\36223 H\340cd\215\201\201v\221\354\270\346\255]tl\256\231U\260\f\366C\\\177\354\001\312\314\270\220}|\002$\326\b\330[\247\255aCN\260{\214vj\353[;\020\236A\233_\005\204\005*=\027\246\330\372A\036\276(h\337\232d\220\2359\341\200u\360\360\301~\310v\b\230$\217\025Z\362|\002\"A\331\275I\037.\271\223\036\005e\367^\036&o\022\202\177u\223E\214\030q\336s\224\363f\255\177V*g\227]\353\007w\370l\032\233}\366\205g\036v\263mG\362$G$J\224h3\210\024+\016\023U\3653\273\310;\357\376Y\271"
+	.string	"\260\027\373\352\203\016\231\201v\366\303n\334\220*\310\263\344\257\003A;^\357X\b\365\234 \332\031\031\371\334x\273!\237\035/\305\021\312@\017\206\212xF\273\235\211 !\024DE@:\"!\237!\035\020\357H\367\300"
+	.string	"\027\031\355x\272\024EE<]j\274\357*\266dz\\\t\217\2447=!\355x,\277\0365\263U\346x\244O\366\232Vb\346\232f\fI\355\343\026_+\312{\247.<\354O\206\341\272H\3237m\212\021*\361\3314\336\261\027\273\241\342\260\037\322t.(\306\210\300\362U\234\027[\177+\263&H`\332E\246"
+	.string	"e\303\351\032\332\311j\226\272\265\300*\327J\\\324-\364\336\340\226\227\2519JUk\250n\2357s\215\243\261J\371Y\264\227\367\336{cp\001g\256q\232\210\212\253\212\265!\260\001Z\2501\034\245\210\222\312\221\221\nD\206$J:\200\002\221!\313\016\021\220\265U3\"\265\033\n\362\374\362\226\3717\355\256Y\036\322e\372\021\325\3565\242\235|\030S\211\235\333\250\257K\221|\261\222\034\241\0058"
+	.string	"I\330\033\252\316s\005\345\271\300\212\314`\371)V\306\213H\311<\356\211\316\306U3\226Ndo\303\232\364q0H\t\307\330\036\r\027\311\251\2735\365\330-\037\345\376\314\231&\340\316\032\315\236\243\031\242\261\3109\320\311\242\0059\325\265\243\360\371L\222\225\221\261\351\301u\270\344\244\356,\366E\340\325\t\216\234y\314\306\320R"
+	.ascii	"J~@'.\001\"V\200\237\200\260\373\304\016:\222\365\326\377\234"
+	.ascii	"\002\272%\370E\234\245\006"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.39.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`\216\004M\035"
+	.string	"Fv\272K\260XQ:\300?\353\024\033\333U\r+\267\310Xp\270\206\242\032\372|\205{\227\035p4\327;\352b2\035\330\217\270\036\006*uM\374T?\275\037\264/\344i4\361\261\003\335\267\363\005\004\301Qo\246\326\032\211%\204\220-w\222\001\251"
+	.string	"\231"
+	.string	"\240"
+	.string	"\343E\373"
+	.ascii	"\343En\340`\366\036\210\0314\275?#Q/\330\213\2727m]d\006\345"
+	.ascii	"E\2361?=\215qa\216\220l?\242\356\275\256\206\301}\233\236Suv"
+	.ascii	"\027\326Ju\232\251\222\034E\333u\3067u\350]X\244\315\020\220"
+	.ascii	"\213\257TF9\026\365l\222kq\337\212j\332\227&9\025v\301\275\367"
+	.ascii	"\300\323\030\345\202j\212\246\b(\305K[#\224\304\004\023\242("
+	.ascii	"7\312\tU\322VG\021U\274O\212\333S\027\242\266\255\021\026\251"
+	.ascii	"\302\322\325\254\200\037\032\267\373^q:Z\255\244\315\275\227"
+	.ascii	"\353M\007t~9\363\0170\363\004f\373\022\234\242\257\301!\004\252"
+	.ascii	"\233\307 \306\267\205\037\224Z\275\302ce\346\320\241\376\366"
+	.ascii	"\276\357\037\261\004\025\264\"\2445\312\234\242\265y\314\377"
+	.ascii	"U\222\321\202\373\005\263L\f\f\353\277\363\352\275\263\352\225"
+	.ascii	"\317W6_9\365\312\345+\223\257<ve\361\225\355+\367+\327W>\315"
+	.ascii	"\200-4'\340\221\216v\222\336\237a\226\033\024\215\324\370\357"
+	.ascii	"\357\375\351\233\371\314W\342\003\177\334d/\220k\211z\302\036"
+	.ascii	"\322\275WBy\361O\272\217\317\367\270\217\331\323\0173\265\364"
+	.ascii	"\352\310\037\217#D\036\224\027g. \252.[l\262\251\360\251C\256"
+	.ascii	"\347\246q\325d[%\266\035\264:\374oS\t\276j\231.\340\324\203\022"
+	.ascii	"!D\253C\330\330\007\376%\226\254\b\255\b\373\336\213\226\315"
+	.ascii	"k]\354\232\343\367DU\257t\037Ny\357\375\215YCN\375M\354\337\330"
+	.ascii	"\325\032\375\177\270\035i\033\203\355\007\237\206A\313t\202\307"
+	.ascii	"\330\335Sb\355\243\256\206HHb\363\270\216\255W\262\365Z[\257"
+	.ascii	"b\353\007\276\214:\032bc\352\326c\032WG\262\212_\372"
+	.string	"\205\243 6\246\376\322Y\215\343\337{\257\375\322k\327\241\r\265\217bGk\364\001=\262\034XO\317\r\t\363\200C\341\202\016L&\2731yx`\257\027\007\036\222_\nrb;2\030\254B\006\034\f:\261\227K\007\347&\307\365\332\341q)0\3001\031l\307\325\023\213\355\270\316\364\276_\260\215O\323\356\322\272%;\241$S\247\005\310\372`\357\035\202\360\364\027*\325!\003\250\342+\214\3147\257\372\033#\220\002\025\2545\312Ul\314@\262:\273>\235\375\244\035\201\242\024\206\312\354\027\231\026\t71!\212r\332\224\252a`j\020\t,>*Nf\363\370\300\273v\2242\3156\246W\215\343rl\266\226\325\252\306\245:\002\224\262\311N\265\325b\013\nX\250\2014\243\020UfDD\"\251\260\240M\007`\002)tU\036\021\3005SB\226&\347*\347P\262\232\220)\232V\264%\005\256a0\250I\223\222"
+	.string	"\351\036\261\221\346h\2564\355t!z\205\271|\013\362y\020\310\263L\177\327\2104\337\306I"
+	.ascii	"4z\006e\021W\303\334\220\t-[H.\007\242\256iB$\316\217m\313:8"
+	.ascii	"\200\203\327\273`\203,\020\035Egu6\363\3274\216r!\217\316\020"
+	.ascii	"\237\241K\001\364~\005(v\364\0375)w\036\3601\362\354J\326v<T"
+	.ascii	"\001\230\327\242\rc\311\272v\244\016\360?\232\375n'9\fC5\316"
+	.ascii	"x\244\254r[\374\251\253\266\320\354\252\311\250\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`\322\004\335\026"
+	.string	"\326c\210K\260\022n:\342\320\236-q\037\265\226S\376\276\361\274vY\377\214F\350\261W\036c]]km?\202\352\275\215\365|J\177J\177\222M\341O\351[D\004\002$\312\240\026\207Z\274`\335\347\216S\256\221Z7\2419m\3774ND\356y"
+	.string	"t"
+	.string	"o"
+	.string	"\t\310\220wF\272\r\b\332\344@\227\030h\024\304\345\\\024\350\021P\247o h5d\265E\240\005\344\264\r\304q\toblZ\245\246Shd\341\345\r1e\230iU\246\f\377\373\375~1\235\202!\353\272\2560\035"
+	.ascii	"|9\303\337\313\254\223\213\251c\002\bVK\237\2009\276*$\226\236"
+	.ascii	"Y8a\t\357\275\342\212\303\345Z\334\333\367B\345\030\246)H\320"
+	.ascii	"J\223\200\367\336\020*\243\310a,\263\260 **\031o\373x\031\217"
+	.ascii	"\303"
+	.string	"$)\017\340\353\243\217_\365!\206\226\353\365Q\307\3471B\351\007\370\272\355\276\036\323\361\216\221\217\020\242\353\"\313;\006\205|AT\252\370\036U<\343\356_\241e(\364\313\204\206\221\320+\021z\006B\323<\350\032\007}\323\3238\r\332\206\327\334zo\215\247[\230W\036\022\b\006=\240\307\202FQ\320\265\235\246\0057\333\371Z\317|Mg\276\306\232\230\247\245m\272#\331\311zg\253\232?w4\363\343\256\205\365`,\267\252y\356\321\314\377\230\277\241\230\037\333Z\371\221\307c&J\221\325\201,\017\303\225w\265'\345\305\036Jy\037\346\244'\254+\221\362'kB\236li\344\311\035\263\321\214+%\225|\254\215\261-\215\004\257T\030I\211\344y\3702\2460\b\0057\326\362\315RBA\245\222\226\0349\225@\323[\003\007\211\035:\376\272\256\027\314\364\242\217\371\205\006\021\"\351E\035\207D\0211\241\351\331\307"
+	.string	"~KKez\037nYAC\013Mo\033I\357b\231\201lp8\2212\273\330c\260i+K\307mv\333g?y,\026\301\200z\241\217\261\347\215( \025\275\253\307\177\312q4\245\242\377\341\234\"*$\025\225=V\250Q\f\311\223\222HM\220IS\234\026\003\300\002\241\241\352\006\021\240 \253\030#\022L0AID\332\003M\022\216\bG\371\376*\\\231LF\227\313\016\320%\314\360h.\347\203#\373te\212PB\262F8n\360\214\007\272&+\037\f\024\311\332\261\207\003\254\026\276\277\223\260V\0359'fH\200{%\n(\345\305P\330\302\335\304\371vf\340@\344c\231|.\311\017\026G\346\2647\201\235\243\315\347LM \273\244\346\260\221l\305}}\t=~^H\233\026"
+	.ascii	"\311\343\351\202t-Bki\r\343\022U\371H\304\370\251\002\340\337"
+	.ascii	"\r\025\337\025q\035sm\227\236\306\352\325"
+	.text
+	.section	.gnu.lto_.refs.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375 \325m\004"
+	.string	"\022L\037!\200\265I\00730\00330\00330\003\275\017\370\372ME~\374\244\274\r\255m\223F\346&D\312\024\017:\333\002\236h\034\301~\270\177\330\013\215\023\330\031{bG\254\303&o\370B\351"
+	.string	"Ig\213\2575s7Jw\222\216\260\037\367\006\373\335\223\275\250\321:\300\027\2453I\221\256`\374a7\3347\354\313q\343\370J\\-~\214\247\304\321\3218V\353\217U\275\335_\032u\305\336? \004"
+	.ascii	"\354\003\025R\201\351>D<p\\"
+	.text
+	.section	.gnu.lto_.decls.cc643b01ef3e5807,"e",@progbits
+	.string	"(\265/\375`,/]\306"
+	.ascii	"\n%\321@X \214I9\351+\334\374nxf\336i}\312U\034\245\301\r\261"
+	.ascii	"\377\200wE\204\334\317^^n+\252\307\354o(\255\355\277\365=\257"
+	.ascii	"\230\376\234\273U%\356G\305\377\206\263\333E,\346\027\006\273"
+	.ascii	"=1\273\210\315.^\356lN\370\"rz\020\376nn\274\205&Z\334[\312\024"
+	.ascii	"n\003\351\003\036\004!\340\340q\215\275\310\261r\247\333\200"
+	.ascii	"H\231\302W\035w\341'\347]'\275$\362\370\216\267\360\3332\275"
+	.ascii	"M \270\222\244\027\202\006!\330`\2112\027\365\333\242\345\306"
+	.ascii	",\245\312\322\226\361b\226/\330j@\303\302O\316\362\272\232{7"
+	.ascii	"@\265l\241i9\035\315\022\253\246\333\021\364L\206\366\016s\241"
+	.ascii	"\347\036\3509\007z\246B\347`\236M\360\334\332\212u\\\333\021"
+	.ascii	"Q\023\315\341\017?\017\242\304\325\026^xgm\323\256\032%\245+"
+	.ascii	"&\034\0078\351\023R\215\206\302o4tV1\274\264\345'd:1C\224\340"
+	.ascii	"\250j{vB\317BR\026\253\2513f\254\231TB\007N\253O'j4\204\205\335"
+	.ascii	"\230\b"
+	.string	"$\360\032\223\261\330\r2\347\022\305\271p\362\327\032+a&5u\242\320\\\332\335{\317e?\211\363\032\027\341\263\372t\336$\321\216\017\300\360\306\242\362\356M\331\330\215\235p\023n\343'\257\235\223\260\032\177\235\323\253\fA\347\2275\367\365Uc\317L\304b\2707y\357\315@\206\355H[\215\266'q^\362\341\267\264L/\316\f\025\022\250*m/\003\372\343\017H~\231\2316.0\234m\377\001\264\276\372R6\244\355]@\317\002\312fl\204\237 \360\221s\016\\v\230\241\364\246\250\024\273\030nm\217\002z\006\341W\373\372\030\204\337M\240\315\037~9\016@=`\020?\006\3430~r\300D.\002\t\257\310\260\333uo\212c\303\027\204o\257\355K\240\030\204]\022\216\242g\016~\334\307\034\374\336\350\016\203\370%\200A\374~\366\372\231\213\273@\250\312#\346%\2737\365\200&\221\024\351j\373\224A\374P\376"
+	.string	"s\002\253O\250JU\242\272\002!x\321&<8\210\2772\300\252)\320\023\370[\002?[\240#`\326\0200a\327\017\300k\023@h\0070\007\376n"
+	.string	"\003\024\240\302_\201?\273\375\\\002\332\001\226!\376J\342g\270&a\256G\370\227w\351\022\177#\340"
+	.string	"\275\323\005x\211\277n\200\331z=\200\277\271\0050C\177\320\035l\020\200\277\272\340+@\007\240\203\277\265\200\375\357\277\032\361W\n\230\032"
+	.string	"\255\301\233\211\r\202\f\340\257\306\237+\200\001\006\"\363W\342\317.Z\347g\022t\006h\033"
+	.string	"5\006\r\342\003m\301\017\360W\002\374l\3247\177\333\374o\3627\r\333p\216\007\336\216>\370\253\006/<\346o)?\233\365\314\3178-\203\363W\017\377\333\376\303\375_\273\334\177\236F\377;9\b\3777\370o\001\006\177\263\035\346\257#\370\231G\307\334\376\365\347\357\337\337\375\363\336\317\\~\326\362\363\335\317U~\246\362s\334\317F~\036\373y\310\317_?s\375\034\344g ?\373\370Y\353g\347\317Y?_\375\334\374y\352g\251\237\227?;\375\334\364s\322\317G?+\177V\301\317(\370\231\206\237\213?\257\370\371\002?g\360s"
+	.ascii	"~\266\340\347\376\377\344\347\236\237c\370O\344\347\016\374\\"
+	.ascii	"\363\177\3703\f\377\217\374\214\342\177\001\376\243\375\177\341"
+	.ascii	"g\027~\316\300\317-\374\214\201\237W\370\031\205\237O\374\034"
+	.ascii	"\201\237?\3709\304\317\036\374\237\373\271\203\2375\370\371\202"
+	.ascii	"\237?\374l\177\256\377\343\376C\371\377\366\277\353?\013\377"
+	.ascii	"\331\376_\320\327\327\327\367\313\370\37400\376\020\035\004\317"
+	.ascii	"\336\341\234\344\207a\022\333\241\244m\317\361\031\214\023\237"
+	.ascii	"\020&\275\304FF\217-\311\272\363\357\336&\230\364.\021\325\234"
+	.ascii	"a\230w~\033\256\374\201\006)\322\2134\202\207\207j\235\rE\335"
+	.ascii	"\203\273s/rI\371\244\201\364\240|\016]%\2217&\017\312\364Ne"
+	.string	"p\2375\2562e\"-\023\3317\275I\032L7\311D\006)\323\273tS&2\347&\231r\224\351\020R\371\244\301\304\312'\223\311\303M^\344M\016M\241I&\223\322\t\223)G\371\034bR&i0\361M\231\227\241 Ii \213\356s\310\346\336{\224:\2215\367\016-]$\\#]\032vHW\306\345\267 i\215{\357\275H\262\271&S&%\272o\312\036L\025E\367\316]\244\021\220\2144\272DH\276\267(]\272\227\210\031\303\222\311Q\214\226\256\315M\016\035\0215\2315EDL\243\333c\212\231\224\317&\223\004\232\330\323y\211R$;\357\034\215%\364\211L9\213\315\363jy\324\026\256\343fr\220s\372:\203{6[\277\3510oS\b-g\\W\336\275K\003\324\024a\273\353\267\277\235t[\362\206G\227.g\333v#\361~\"Su\306\002\256-\367\365\335\313 ~}\257m6Y{"
+	.ascii	"\016\031\267-\023\035\231,aDG\332\3362\265\222\032'UbL\371\202"
+	.ascii	"\266Z\0303\265\251COmg\235>/X\002IJ\335\254\234\264\241\321\350"
+	.ascii	" \243\314\251m\232\302`5\373\270\350p\206S\303\306\026\035}$"
+	.ascii	"\275qQc\213\213:#f\026\210\027][\021~\266\331;\2076\353\262\030"
+	.ascii	"v6RHTWl\034\231\324\314S\326\227\217\036k1(7\224\214\265}6\021"
+	.ascii	"~\266\330{H\032\306b7\365^\031zN\022~\022b\r\306b\r\330\323\t"
+	.ascii	"!\204\230\260\243<\252\237\255g\350k\3125%J\f\255msq\225\376"
+	.ascii	"\261\200\242%\031\243\270\255\033_\3161\033W\273I\nqv\261\016"
+	.ascii	"W\3437\262k\233A\240\240\266\356\2758\264W\177u\220\356j!\374"
+	.ascii	"l\256\006r\226\322[\315\3255z\251\364k\222AA\3455\025WW\265\223"
+	.ascii	"\337\310N\210\363\262\013\001\235JuP\335\330\276\265\007\332"
+	.ascii	"Z\335\203\237gk\037\267.\270\370p\322\366\325\n\375\n\370l?\034"
+	.ascii	"}U\301\226\320%\315.g\347h\0357\310\3642\3154\271\240\240\362"
+	.ascii	"\356\275<z\007?\333\371\333\364\336\247\0067D\214|\235\375\354"
+	.ascii	"[\307\377\264\251K\222b\265m,\022\357,\023\256j\340\320\266V"
+	.ascii	"\"\324\212F\215E\035\333\023\364\335\206\276\225\240\177k$\350"
+	.ascii	"\373\f}\2135y\3152\355\210\341FC\351g\325DF6\325HhY\335\233\013"
+	.ascii	"f\317\240\333\273\243\322\266et\324\223\246\207\222\215'<\320"
+	.ascii	"\227\220b\022\203\237-\365\216z\352\330\360Y\351\"\305Z\250%"
+	.ascii	"\227\222&Y\333^v\277h\030\357e?\325${i\357\035b\016q\303\034"
+	.ascii	"\002F\rkh\310\317\276s\240\177\337\260c\323e\n\321\226\223\r"
+	.ascii	"5eHS\352\332v\023Y\307\r!iyB_\202H\210\263\225\232E#\3350\345"
+	.ascii	"\334d\263\314yo\272\324I\315\304\317Vz+\311\312Z\251\2158\355"
+	.ascii	"\206)\275K1C\310\214\322j\246t\215aAm\267h\027\374\334\351\243"
+	.ascii	"w\021\217]&\231\336\247\314\224,1\310\332\276\221\320\363\316"
+	.ascii	"\017\207w~\357!\224\371P[C\224\037\037\f\260!\235l\242\2305\033"
+	.ascii	"\262\330\265\355\241tHn\312\332\035z\356\222c*_V\246\354P\345"
+	.ascii	"\307\023\356\372IT\341\271\256\035X\312\036\333q\036\277-sn\362"
+	.ascii	"H\336\036[a1~[\232\200\303\334\227F\366e>\326c/\334\307O\336"
+	.ascii	"c\272s\035_I\216\355\361[\225\004\272\250\330\005U\216)\007\027"
+	.ascii	"\220/_\354\020\325Q"
+	.ascii	"\222^\236\004\214\300\366,\362v\250\227\314+N\266\266\366v\036"
+	.ascii	"\026\236\323\253m\355\373\025\216kR\203\357j1ln\315\0313\316"
+	.ascii	".]\352\236\016\263\312\301H\322\333\302\241J#\302\323{\335;\233"
+	.ascii	"{r\231\251\342\302\245j\255`\212\207\214-+,\036_\364\262d\251"
+	.ascii	"Z\2128clxZ\332\303{\325R7\323\205I\013\245\024:\272z\247\203"
+	.ascii	"^\257!F\354X\312\256\031\303\356\365\256\316\026E\311\342k[\257"
+	.ascii	"T\034cI\236>\332\326\272\376\201FA\031)\235U\251R\343\326\234"
+	.ascii	"8rH(x[R\244T*\234\223\022\305\035q\376\360n\216\260\271W*s9\330"
+	.ascii	"\315h[\345*\016\234$*Wum\353\024\2162\205\213\331\01624\240@"
+	.ascii	"\251q\334<\203\202\222I\3622z\002\367\032'\206\265$\211\003I"
+	.ascii	"\233\013\231\243\263W\265\263\372\244\302\241K&\013\252&yW\271"
+	.ascii	"\334\241\t\262\303\217$L^\237\274\272\231\3159\253\332\326\266"
+	.ascii	"W'8\262\210)\331\252\223_Ff\207\0253>:\2646A@\307\320\233\362"
+	.ascii	"\262\366*8,\037m\233\257\366\253K~\345M\320\362\242\332V%\277"
+	.ascii	"b\006V%U\303\334\232qDm+\222\327$_jEqR\320\212\366\232v#\351"
+	.ascii	"\r\356M\207_\246\346.\307\223\025\033z4\tZVV\215p\330U\372\215"
+	.ascii	"M5\267\354\300\344\365\305\335\250f\257F\366b\260h[\213p\332"
+	.ascii	"sF\023\275\2665\207_9&\267\202 \375\334\224\274\350U\215\215"
+	.ascii	"U-\035 [\350\023\330\235\223\023\021\"5\353\202\035YFiy\325K"
+	.ascii	"\223\2216\026iZ\207\2643FL\351\211\335]J\355\314\304@J\242\245"
+	.ascii	"\355\220\032\366t\206\003\251m\005\273I3*ck{t\b}\f\235\227W\375"
+	.ascii	"\372\23551J\313\233\323[\333j\3735s\005V4\265\306\365\254\\\234"
+	.ascii	"\326\351]r\241-\206,H\220\232U\351\252\030\245m\311\244\325\340"
+	.ascii	"E\265\003\b\220\232\225\302\305:b\224\226\207\023\365B\016\210"
+	.ascii	"\224\017\037U\013\275\367R\311r\316\330@\245\252H\333\3070\361"
+	.ascii	"\340Q\265P$\227\341X\356\300,\231\330\320\327\226\237U\013\006"
+	.ascii	"\256G\326\217\317\351,\241\3437\207\205U\263P\022\352\256\345"
+	.ascii	"5k\207V\363\b\315\306m\324+^^\344]\002v\264\031\245\345Y\275"
+	.ascii	"^\261\227/>\260\266\365F\305q\243\305\366$\2538j\325\033\023"
+	.ascii	"2\213\311\265\t\333k\336J\325@\320$:\262l\020\322l\326)\235\234"
+	.ascii	"\3646\243\234\277\026E-\256\256d\310\250S:a\027y\023'%e\200\032"
+	.ascii	"&&PHM$\223\347\024\347\325\226\371\0315\314\245\233\374\241\335"
+	.ascii	"p\203G\237\215\265@\302\200\202\252R(\tfQ\257RWC\251\230\374"
+	.ascii	"@\232\202!\312\225^\333\377Z\324\247\372T\227%\244\214\322\266"
+	.ascii	"^\274.e\306\354\270r\350\274\2305&\322\023\237\323\263:\365\222"
+	.ascii	"\211\334\254,-\325&,\027L\257M\025k\254\306\327\033\372\327\244"
+	.ascii	"g"
+	.string	"Mj$\313v\244\266\250-\352\021z\244\036\335\340\265\203\023\216B\323l\213\322\206C\275\277U\211\"g\256pT%\247\341\360`kJ\266\255D\265\250\266\031%\363jQ\255A\n\f%\213nj\245\r\225'\021!5\371V\326\241\266rw \241\332V\344\257\260\022\334\024\033\234f\205h-oX\361\361q\024\235\234\233\034\322\346\234\341\345\331^8\212Nz\233h\342\234,\245\0068L\023\336\361Z\217\311p\316\372\272\274\365\254\300\310\3359=\265m-\235\027\343b\315\353F\3475\027\0268\260\330\365\320\377\364na\262\205d\013\323\375j\031\2532\003\306\350\312\225\306\222B\214\213\256\2737\226\245\r\026\255\267\250\266m\307Ql\372\364\372\236W\2637\240q\265\361\241o)=\345-w\271\246c\234\262+\313\245\235\277\251\274\351\254\324T-\367\360\254T\221J*\263\342'\327\255JlK\333G\236b\360H$\236"
+	.string	"\252\350\261A2A\277\013\374\004\325\234\253\020\261\"x4\316`\034!,\372l@\343\003$\256\360\023\364\213\271\n\021+\274\240\002\n\r\360\244\200b\002+\234\250\271@8\024\246\300@\205Q\b(\005\210\241\260x4\216\b\372\b\001\365\f\205#\212F\241\021\030"
+	.string	"\001\t\r\207\304a\214\t\210E\025G\3420&\0050\bd\203E\241 \033\264\242gEp\305\357*D\364\024{F\350\004\217@\237 !\236\343Q\330\323\303S\002\211\236b\317\207\231#O\220\006\241\361\027\374\001\026\211G\024\027\004\177>\004i\020\242\310\t\026\205\216=B\305#\n\f\214\302\013\216\302\241p&\b$<\261\202X<\001$\002Y"
+	.string	"\202\370\202\361g(<\036\203(0\b\036\205E\023x0~\360\031\006\213<?A<<\036\214(\264p\343\023\374\031\002U\230@\241\005\243\220&\b$\003\320g\030\f\n\232\300\020\330c\244AA\004\036|\204@@\030,`\024~\350)\232\230\241x\304\361\031\2360s,\002\217(DP\303\002\006\\h\341\204\023f|\202F`\361\004\243\020\365\t\226"
+	.string	"\210\302g(L\201\363\036!\372\021J@@\t\0138AL\220'\350Cd!X\024\002\022\002S\330\\\205\210\243\221\030\3043$\256XA\354\031q\f\376\024\201G\017\200G`\005f\216A\236\023\037\212\304#p(\\Q\f\036g`0\361!(\003O\217\360\007\270\0025z8\362\024\217A2W!b"
+	.string	"2\360\221'\0304\203\020\b\310\303S\f\256"
+	.string	"\006\213G#\217"
+	.string	"L\300\305`\212\024B2\374\216\300.\026\203\225\b4\024B\217<\304\024C\025>"
+	.ascii	"\021\211\024\340\2019\362\024\203>\300`\n@\300aQ\210h\001\020"
+	.ascii	"G\036\021J\f\211\302#\260\030\034\006\177fz\212=\365x\025\"~"
+	.ascii	"\202F\374\004}\350\031\n\2358\006\2154\303\024}\f\032\203E\030"
+	.ascii	"#\317\f\305\243Q\370\023t\341'\250F\305\361g\030\004\372\031"
+	.ascii	"\215\301\242\217\0170f\206 b\217-\036\203\352\221\307\247H\354"
+	.ascii	"\t\272p\363\017N\f\n\026G\034\211\304\342\b\232\237\240\366\t"
+	.ascii	"\216\240\007\030\364;\362\224@\002\r\322 4\332#\317\360'\bf\370"
+	.ascii	"\023T\207D\241\261\030,A\314\221g\001\307\241P(\346$H\230\360"
+	.ascii	"@\003\027@\001\355\021\261\202X\f\n\006y~\204)\206\304\236\021"
+	.ascii	"C!p\305\210\236\242q\204\210\020\306\037 P\n\2301[\004S\005\216"
+	.ascii	"k\207X\026\005\260\034\331 \"\025\203\347E\006\217\347\262~\331"
+	.ascii	"\033B6\244^q\235\3353-\254\323d\234JF\224\200\341\200\2465q\252"
+	.ascii	"\221v\375\336\220P9\022b\271l\226\374(\202\362u'\363e/\314\313"
+	.ascii	"zU-24\254|\305\320\231\031\243J\315P\030Wk1l\020\235\232.)9\032"
+	.ascii	"\027h\332uoz\363\373\221\303\b\rH}\202\003Wc(\353G\\\322\013"
+	.ascii	"\215\032|T*7\240\\Y\265\275\355\361[\255\030\356M\247\300\260"
+	.ascii	"\324\332\332\035\226\307\255\226u^\2535\002S\013\307\342\320"
+	.ascii	"\324\221\303\317\236\246\b\025\201\304\255\216\337V\222\251."
+	.ascii	"YTK^B\216\264\225\225\315!\263\264t\357\322\0047/vw\271tu\233"
+	.ascii	"\203\305lv\fU]\361\202VU}q\316hA\205l\034\241r\243N\321t\261"
+	.ascii	"\3625gcO\246\306V\217/5\354\320\f\333\232\035\222f\353\355\260"
+	.ascii	"U4\243\255e\326\025\364\365Yf[\032v\352\226y\234\230\271-\345"
+	.ascii	"\220\224\224\225\241B\320^\222^\214[\031kPF<\356\242"
+	.string	"j\223M\227\221\034\320\2408\355\367\242\206\275\"0\216\346\264\332Z\330%\026\271\245.:\373\242\351\246\314\230\350\265\265N\366\206\333\247\333\247\266O\265\257\317\313\275C8\314!\230C\374\274\242\214\375\254]\262K\266I\312i\347\267L\267MMjG`\314X\245\252\224\321\361\214\n\222d\221\220\240\251\321\350\270\332D\007\026::\215I[r\227d]T#I\236g\251m\221\204\207[\2214\313\342-\211$\371BY\265\312`T5\333\332\244M\332\2423\260\037O"
+	.ascii	"8r\222\331\032n\213h\226\020Q\n\353(\001\204W\250\303\223#B\250"
+	.ascii	"M1\245$3#C\322&i\r\243\024@0@@\"\241\223\207\265\007\023\300"
+	.ascii	"\226'\324\221\022\207\225!\243\221$),\233\001\240\0237mV\022"
+	.ascii	")\2475\344\"qF+\377L\311:\332\264P\021\235\007\343V\234zS\317"
+	.ascii	"\352\016.\244v|\300\216>\347B\366\206\224(?\003{=\213&\320\255"
+	.ascii	"\016\341\353-\t\232\341\365"
+	.string	"\306\035\237\2053z\037\003\204\243Cq9\377\257\255\355@f3\fs\257\237\256u\200T\277\361\036\231\3326\237\204\032\227\027\336\2215\260\344\232\314xx\364\032J\021\324Z\331X\347\363\346Y\223E\007\3010\233<\304\302\243\017\216\235\323\254r\026\374\227\303\002\376\024\\\214\215\fU\220\272\254\243_\276\351\026+\001\211\031n=\277]\020\260t\254Vhl\032>\r\341\347pq\335\372\242\205\224\303'\262\225\371\255\357\261r9\211`\364\257\331\272(B\270:\024\016rE\200\225rG\321<\224@\024|\345\234\300t\335\264\217\316o#\255\354\317R\307p\213\323\240\243\363\353\202\316\n\273\251\333I\247\347\325\023\375Y(\301\242\226\251\212Z\232\323Y\b)\310\301\023\234#\375$\337\320\304V\332\220\307\327!\372\020\365\200\300\037\020\347\030n\214\321$\346\244\243\364\200\230,\277\343XP\001cQ@f>\306\020\017\261\314\027"
+	.ascii	"\3215\250f\306\334\037U\226\205\244\334\264$\220\374N\217\033"
+	.ascii	"X\324\233\366\376}.u*\260\207x\001\200R\013\344\013\342\302\303"
+	.ascii	"\250\360\331`\013{\0035X\223\030&\262\210\222vo^\347\032dH\233"
+	.ascii	"\353\\B\220\376\262P\375\302\202\256%Z\371\255\264\314\317\013"
+	.ascii	"V{\310\005I\211=e\245\230\2438\253\036\235\225\031p\211moQ\212"
+	.ascii	"\354+\341\301)\352\220J\2215\210\372\242^\310\"o@\3065\357~2"
+	.ascii	"\203\376\372m}\211\264\363\333\f \265\351\002aq\235\252[\261"
+	.ascii	"\002\0138\360x\006\254\024\344\272\257\356\373\002l\202\027d"
+	.ascii	",:U\032\325si\322\030\243\016\007\374Ib<HkZ\311\253\255\214\266"
+	.ascii	"@_\004>i\350\377\254\311`\303\255\177\341\312q\243\276\\\030"
+	.ascii	"\250DN,\032}8\3045\377Rb\303K^k\201\327\327\340Z\311AD\204[<"
+	.ascii	"\231\3675P\374}\253\246y\2636q\364U\006\316v\007\251+0n\fZ\036"
+	.ascii	"$\3405\276|\217\316\370\266\337u\260\006uH\347\344\337\213\030"
+	.ascii	"\177\347\217\322\260\\\t>\334\210PD\373\327dM0\005M\371_\231"
+	.ascii	"\252\370\240\025Oc\016\200\"\n\332\240)~UQLPJN\3330a\314Q\303"
+	.ascii	"\274\331\025\345\304\353~c\245v\022[\216\307P\331\021\3337\374"
+	.ascii	"~.\205\224\032\246\005\352\237\226V\270\200\342\325\361cwmLs"
+	.ascii	"'\013\306\020[\365 \263!v\036\206k\263}W\204^Y\273\220A\036o"
+	.ascii	";\310\370\007\332\244q\276<M\227}V\264\226\247\204\013\371"
+	.string	"\215\3212\033\310\031EW\251\020A\031\265\217\300\033\001\374\252o&\317\261\272C\321\234\3625;\0066?\0327HYn\271l\022\b\327\225\023\301vD)\005L3#\370\3115\373=\210)\243\377\220\307\356=\037 \314\276\026\360|\333\376\323\302A\230\224\250\255\024xC\020+\260 \327\273\207q\356R\227uL\0058\rm\206I\324A\355/\366UY\331\360S\260^\267R\022\316P\225\246aXt\177+L\241\364\037\003n\221\245\360F\032F\302\312\370\254\351\021\234r\376)\277\244\371\325\3610\2074\377\3542}3\\\223\344\261Q!\304o\322\247\277c\372\037\345\215xP\200C\277\026E\220\230|\234\"\020\263BE\034\340\245\356\272\326\270\260Xs\003\2203k\246\246\363_\347\364\247\fR\345\257\322u\226\361\013\325\224\303\023c\3706k\343%\242\374\310r\217\326\3151\375\310\225\261\221B\367\035\227\022R\202\b"
+	.string	"\226\017j\233j\363\341\314\235\302E_\263\264\247\253Dx\351\026\267\212\fK\324\212\"\271\223\035\206\350\274\315\237\353[O_\207\301\276/\212e\250>\234\021(\035\202\301\n\370\277|\344\360JWI\227\353\254\013\023\314\355\323\242$\315\214\312Q\\\2237\362\ta\210\314\231\037\020\n<\221\357{\235\222\"{\343\2123w\312\211788\302\017\312\216\364x+/\026\247\033\022\234\303\3368\232j\212\b\037\333\2620f\216\r\030\254\273\346\230\330+\260/\377\215\027K\321XjGt(R\374\241R\300\350\325\0051\266\020\306H\357\246\215}\177\210\247\346\247\340\0275(S\322\226\205\235"
+	.string	"\200\211\020p\210\372A\203\311\002wXDE&\035\200\215\024\212\325\337/y\210\261\335a"
+	.string	"\003\001/\315\352%\313\227\275\303h\266\bak\024D\200\256\334\305\235\362\277\223f\261\203x\371\350\262\340[\341\026\003\315ELd\220"
+	.string	"\036\345a\202\026A\353v\267NK\325\003\376\004\337\0049\302\350\035\375\025\327\350%g!\307\200\276\327\202\236mAq6fQ\366\210\255B\362\266\037\026\306\327\304_\013_\007*\005\360\315\242\242xvU\314-b\321?\216\034+\1779\210\364n\320\352_\017\332e\360\272\375\237\255I\231\363\001T\350\t\320y\276"
+	.string	"\013\313gc*\0333f\0319\013`\3624.\215s["
+	.string	"-\007 \255\312pE\325P\020j\301\325\037z\345:H\316\257\357\322\027r\232NoI\250\250H\371\222\025\312>C=e\273:\270O1\333cJ}\220\200*m\275q?M'\372\001\2521!j\317?7\315~'\207)\270\253\312\006\037n8\\\353\243\2315o%d\370h\332D\244\033W\274@\335\262\351N\366C1J;;E\364av\300[\251\311\267G\340\013\027N\210L\3619\335\256+\344)ifL\226wc\273l\231\033A\r\221"
+	.string	"\302\227T\n\f\263\317\n\bjv\026\316\360g\2737Z*\335}\025\006\346\n\f\016ta\003D\344\327w\372>\004S\013\352\317\t\252Tr\212_\377\017m5\260\271h\031\212e^B\331\260\004\370R\245J\0162\036s\240D\226\301A"
+	.string	"\035\377F{BJ\007%w\300f\337;z\306\374\017<\314\331\321\252\276\362\372\003B\243y\263\362\215\372\361>\200\367ej;\301\244\227\255\377\255\234\265r\221\225\227\344r\340Z\256\261\325e\367ZU\232l\345x\327\373\346\337\316\036\347[wp\340\302\354d\204t"
+	.ascii	"\227\267vf\312\330\331_h#\365\003\320\225\306\307.>\220b\346"
+	.ascii	"\252\333\356\330c\362\2542\3443\260\026\f}\336\007\264\211\312"
+	.ascii	"\036\371%\334\321\201\247\353k\365\n\034\227\220\243)\234\263"
+	.ascii	"\236.!gO\371,\261\025\373\241\302]\275w\315/\210`\217\345\t\255"
+	.ascii	"\325\313w\336CoN\013wf\332B\031 \355\276\032\374\b7J\377\272"
+	.ascii	"\276\201Sh\336(:\357sc\227)\375\225<\276w\007\372I}."
+	.ascii	"s\363U\322'\315N\b\032\202\275z\327\nH\006\"\276U\365\302\346"
+	.ascii	"\247\324\323v3\370\307\362Z;1\276avG\362\351wd\274\364\246\367"
+	.ascii	"\340\021\371\326\306\277\306\253}~r\372N\034|}^\334\031\324v"
+	.ascii	"6y`\364\317,\23388\311\346#\206M\f\262B\f\033\220\235\244\354"
+	.ascii	"\362}S\361q\355'\243\023\315\034h\307\264\361O\335k\207\376\376"
+	.ascii	"\310G\312\264r>\226?\310|Fv\361\266\252\363\272|\266\343\267"
+	.ascii	"\360\235\371\005\345\261\362\326\333\303\0327\307\333\\y\206"
+	.ascii	"\367\362\315\377d\356\354\321\037\365\377h!\215\023\225g4g\242"
+	.ascii	"\\\343\261;\324\377\333Sz\356K\242\223\317\370\\\337\276\037"
+	.ascii	"\374\035\316\332[\362\304[z\177N\346\237\355\221\243\373r\263"
+	.ascii	"\264\320\256~\303\350\315\325\342\026\343\213\374\023\364R=\220"
+	.ascii	"\364\213\372O|\363}\006\366\237aq\317\231\216\267y\364\231_\345"
+	.ascii	"-\021\356;\231\260?\331\214u\013\362\376\003G\227\240\377\332"
+	.ascii	"@}\"^?\307\004\235\020a\304s\177\307\026L\336\323\316\030C6a"
+	.ascii	"'\346\275\203mLw\345\371\253f\335\037\223\331X\311\233\317\372"
+	.ascii	"\317\361\266\347\260\360H#\274\243\371f\314n\\q=\245lB\273B\330"
+	.ascii	"3\027\357\223tBxE\374F\375\237\270^CG\213\276\333^\262\222q\030"
+	.ascii	"\313\351\n"
+	.text
+	.section	.gnu.lto_.symtab.cc643b01ef3e5807,"e",@progbits
+	.string	"loadEEPROMFromFile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"getEEPROMStorageSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cc643b01ef3e5807,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,505 @@
+	.file	"config_streamer.c"
+	.section	.gnu.lto_.profile.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375 \264\275\003"
+	.string	"D\005\250"
+	.string	"\t"
+	.string	"\330\355\273\207\006\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\241\210\323\235\t\004\002\003\002\367\346\266\265\005"
+	.string	"\003\336\367\336\247\t\n\004\003\002\002\004\372\203\243\344\n\016\005\002\005\002\006\005\265\234\352\241\r\006\235\220\277\362\b\b\007\243\254\366\313\016\006\b\240\342\234\212\n"
+	.string	"\016"
+	.ascii	"[`{\261@Pl\204j\005\034xq\n$\270\004\334\345\365\264\240fS2\361"
+	.ascii	"\261#k\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375 \256\355\002"
+	.string	"\342D\r\023\260%\351\f\316\3610\f\303@F\205\311\336\244I)e\nK\264\240\350HxV\213\034\017\001Q\362\276\202Q\236\373*\200\033\323\254\3156Q:\352O\246=\017\002\017"
+	.string	".9:\0064\264\332\303\204\246y\204\013\300E\210\027\312\220:\300T\323\005%\003%\b\232\223^\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375`y\0025\016"
+	.string	"\206\327J;@m\222tW\222\301Y}9Wg\003\334\347\230qqN}\327`\021x\177j5\t\214\005\360\3561\367\242c\243\001\346\001\303\344t\2601\240\374`\034#Zk\033i\255m\"e\n9"
+	.string	":"
+	.string	"9"
+	.string	"\275<3k"
+	.string	"\245^~H:HJ&\346S\365T\365\007p\214\335\373\356E[k\215\367R%!\002\322aO\255N\210\r\207A\254<*\331\231\321\016\034\rB\002<{\035\b\274\262\356\330\307.\356\263\370\250B\330\300\301 \272gq\317@7\">8\340\025S\325\264\326\236[\001=\202\326Z\202\217\226\312i\201\254\300I1G%\334\200\236\224\342kn@\223\030\332\246\203b\375-\237\262Rv\225\320"
+	.string	"\362A\361=\341W \303\031[\322c\254\005Q4kj@\224^\356\264\224\3431\"By=\177\252V\353\323\262<\264\326\242\373T\005\223\027H)f\202\307\b\005\351\210Su\0022\2351\r[j\230\327\264\254\021 $|L\f\335\335\244\326\375<U\023\340\320'F?^\331\322\007\234\220\f\2757\243\n\",\350T^\243\001@\250\361L\307\224L \"\nR\320\342\034`\242RB\327\003\022`5\035\313\322^X\225\026\326?\213\001\034\3500\214\251\312\354\2535\252[$\331\200\275\311\225\206\211\275#\235|\2416z\226U\373\250\241$\332\200A\002\323\352C%\276\001\324\027X\360 \221**\250E\304i\346z\373\203\242\024g\375\200\331\272[}\241\t/\326\253\252"
+	.ascii	"e\206b\220\3036\340'\371\200\332\032;\r\254\204h\206\n[\362\207"
+	.ascii	"\245\2153\323v\377\233\212\252\221Fi\274~\242\205\rX\315\t4\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375`j"
+	.string	"\305\004"
+	.string	"b\311\030\037\240%I\007\217\256x\025\030\371\017"
+	.string	"@\024\325\377\253\032\201\217\027\016\313\254\260\315\222\266IJ2\333WQ\202\006\222KLq\365\214\005J\340WQ\363+J\224\356\300\354\006\212\303E\320\nWq}\005\250\245\034\207K\314\233"
+	.string	"\256\310\274\353\026\025\321\3665\350\3168\347\034kB&!n\264\367e\350+\246@\024"
+	.ascii	"/BpF\002\316\013\222\2173\272\362\212\022l\340\006\302Lr&\\ "
+	.ascii	"\227\346=\231\304\335){L\231\315<\177*\330Bm\206\231\200\241"
+	.ascii	"\354(\200\033"
+	.text
+	.section	.gnu.lto_.pureconst.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\001\231\004\002\230\004\003\232\004\004\232\004\005"
+	.ascii	"\205\004\006\232\004\007\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\305\005"
+	.string	"\202\210\032$\2205I\007\240n\317]\267Y\225\202\306\376\253Q\027\362\242\347\013v`s\372\216\264\277\251FHk\204H\231\002\027\f\007\302\361+}\250\002\315B$I\307\343m\355\f\372\031\033\025\300,(\275\263\263b\366\315{R\264\026O)O\r\204\022\343i\022\013"
+	.string	"\3667\243\"i\371\367=\347\253\\P\263'\271j\177f\351k\344\211\b  p\002\021S\352\0010\002vO\303\034\b10\304\\eB\213\f\241\027\350\367D0\260\315\240v\371\212\244\267\026\021\203I\353\\\026\244\013\0247\204\360af\316-[\214>\361\356\211\202=\342;\353\2007"
+	.ascii	"\024\235q\331\307n\021"
+	.text
+	.section	.gnu.lto_.lto.ff2c1e00bc9590a7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_config_streamer_init.10.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"=\007"
+	.string	"R\01633`m3\006@c\003]\020\241L\320M\227\271\312\323\354,\264\302\007\235H\370x\336*\220\216uR\252"
+	.string	""
+	.string	"\024\346]\024\207\327T\361\372\373\321\203$\2212\245\225[a\246\265\311X\323\323y\210\320@p\256Jr4\231\215\254fGb\022zIXSz\256k\312\013wK\207[\343Ig\001/*\275\003\027eR\360\203\355\004\305\263V\252\244\313\200Y\313e\017z\264\226\376\277pk\035\262\2374\320A\215\376\215\321\312\273h\002\272\264\365k\r\342\020\314\241\n\023\374\233\210\344\347\026\312`q,gjr\264\270`r,\326\246\030`\b\2104FT\376K\370a\314\017\253-\342"
+	.string	"\355\223\371\0018\374\357\323>\034.t[\204\266\rmA\001\t"
+	.ascii	"\252\244\2231={\206\213\263\217`\336%\200f5%\334\341E;\311"
+	.text
+	.section	.gnu.lto_config_streamer_start.11.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375`x\001e\016"
+	.string	"&\032_E"
+	.string	"\221(\035\0201\222\252\367\007\377\331q\325\201\177\324\325\003c\21574\323\253nO\244>\314\320\023\016_\364QL\361\217\b\214d\256\351\264m\003\374\177\r\241\t\243k\356\001\267\274\371e\327t<b\311\336r\247\024I"
+	.string	"H"
+	.string	"L"
+	.string	"v\240}:|G\366\251\235@\366i\320\256a\300C\207\306I\013\307\356nJ\342\340\245F\320\177\353"
+	.ascii	"L\247\321e\210\253d \003c\203s*\311\216\024\023\246\267\036Q"
+	.ascii	"N\244\0307\023v\327\321t\002q\317\333\256`[\202\375\230kE\331"
+	.ascii	"w\3717\017\377\371\325/e\364;\252\342\344\245@\314nJ\254fa\363"
+	.ascii	"\305\t\333\347\330\326\025g\201w\361K\n\330\322\b\024\327\356"
+	.ascii	"z8\202\366\251@\306\220\244\346\301\243}\325[\300\257J>`\027"
+	.ascii	"\025\303\265\033z\004\241x\223\271\030\214\244\243\257\320\310"
+	.ascii	"\270TS\276(\273\202\260f\224\"\215\355\356.D\332\365\200*\305"
+	.ascii	"j\243\266\206\267\360+\001\212\034S\355\357,H\264\335\205\340"
+	.ascii	"\277p\330\240+%J\262\317\310bQi\021a\022cv8\212\232\262/w7\\"
+	.ascii	"\007\320'\271\317\003\"?\367\347\303\343B\036\316\033\371,\204"
+	.ascii	"\200.\210t\237M\004\344\tm\037\357\333>\026\270\313\300y\333"
+	.ascii	"H\327y\033'\334\313U\024\205\0330\023%\271\301\355\220\303\360"
+	.ascii	"K\021|\220\241\242\232\221\232\272(s\211\002L\230\026\313\f'"
+	.ascii	"\332\030\002! \200\202\021I\367\352\245\033M\3473\354`[\340\315"
+	.ascii	"~\013\226\033LbP\007l\263<\364P\007\220\344\305\324\354\002\024"
+	.ascii	"\t/\207\365\230rp=\276c7\251\331\205~@\200\243c\f\256(\214{\341"
+	.ascii	"\2271\"\300\243\f\207gMN\321\374\036"
+	.text
+	.section	.gnu.lto_write_word.12.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375`\347\001\315\021"
+	.string	"f\243zG\340\360&\035\330(t\313\260\r\205\332G\321;=Z\325\304\344!\004\b\370\214.\274Qx\027\206\221\2735\217\257\373~\004\354\252e\f\024\273/a\214q\025\343I\\\r\f\366<\007\234\313By\321\331\216X\262\267\224)\005f"
+	.string	"b"
+	.string	"f"
+	.ascii	"\266O\342>1\333(~;\336\351\202\214\031\2556\347\\}\334c\273\214"
+	.ascii	"\037\260]\256\316c\337d\\\215\371(\257\345\033\267\341268\242"
+	.ascii	"\371\351\360`\342ob\200)/F\343\207\256\030<\230\3701\347Ly2\335"
+	.ascii	"\210\300\346\210\246\303{\211\036I7L\007\2573^\214\352Id\316"
+	.ascii	"i\225\3614\334\247\333>\261\355\300VUB?\307i7\352\337\317E\265"
+	.ascii	"\214\352(\325+\325\032\325\357\ba\262\251\341\231\2610\276\231"
+	.ascii	"!\2741\221\344\212\236\323n\277\204?\344\224O[\371\220}\323\253"
+	.ascii	"\340\242\346S\233"
+	.string	"\363\003\271t\bwy;f\247l\253\220\005\002\001\246\f\004\261\340j\037\350A\261\177,\0270'N\213\2429\277\004V\300]\372\343\034K\034\252k\233\234\350eP\373\241\377\003\213 $\331\266|\247\211FQ|\267\355\222\200J\247\360\335\246\273\253/f\034^\214r\024\235n\001\0215UQ#\311\303n\216A\376%\001\227d\332d\233\302O\330\210\201o\"\345\305\3159\037\342\322g\331.\277\035t\220l~\200\\4\264\277\026\335\034\373\033\206a\350\305\261\037/\025\330\b\354\265\271Z%%*$\033\353f\251\\-\224\221\226\013\366\212 \301\244$\245c\255RLFPV,\327k\245:\340nB\313\265\202u\235k\225\372\346\343\2142B\230Q\232\021E\325\017\376\001\217\215\031\221~\345\316\330\226k\021\227}\211s\316\271\001P\216\345\326f\265\3642q\017^\004FS\320jF\310\370\225\r\265\006zn\300\037"
+	.ascii	"\252\322\275a:\261\026\202\326\006\364`\017\264\")\301@.\\\245"
+	.ascii	"G+\033\320`\205]\2601\025\253\344X5\021^;\301x\\\004\255\020"
+	.ascii	"\275V\370\304e\216\036\372\350P\036(\f\206\tTdpb\2226X\205\320"
+	.ascii	"\2260\035\374*f"
+	.text
+	.section	.gnu.lto_config_streamer_write.13.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375`2\003]\027"
+	.string	"\326\252\225H\300\026U:\304\0137\003\320"
+	.string	"X\020\251\322g\300:f\205s\016j\3237;\302\221"
+	.string	"=\233\245\221\222\024\357\373\365\310\324|\242\212\016\312\275\244fhAQ\024\245n5X;\240K\265yL\372\200\251\342C\t!dK\231d\200"
+	.string	"|"
+	.string	"\203"
+	.string	"&\212\017\250\365FeI\255\346\203\2250\036\\s<\220\007\201\355\362\250\211+/\024\303\226\013SkE\331\374\024\036\244'\020\036\354\0320\246\3467d\330\305\020\244\315\260}\356\364\307\357$\313\236\213T\244\375\340(\2256z\363\363\025}w\366)e\034\006\310\001t\320\305)\225@\013\003\243T\322\250\200\237\r\013\251\234q\177w\006G'Y\002\235E\f\265\326e\262d\361\035\277\273?\273{a\2677\004Z\234\370\030\212\361\331\272\036\255\354\016\3325{\370\006\367\363m\337vO\224\327t\363/\275\310/s\"?\351\272\3578\362\212\"oHy\301\220\227\202\274My\231\362\236\346\200\357J\t0\265\376\234b\252\025\260H\350\272\357\336\310~\247\343y\255\255"
+	.ascii	"\240Bh\206\257V\263\301\301\2650\036\374.l\227\264\273\315/R"
+	.ascii	"\202\316\324\031\r\030\025\230\bO\201\231:#J1\341\274\373\241"
+	.ascii	"\017\201=&\316B\032\235\230v\251w5p\340\223`\333\320\272g\367"
+	.ascii	"P^58r\267\303{\037PO\026\320\366\360\253B\002\255\224\030:n\264"
+	.ascii	"\203\226~y!\267\001!6\210\266\314\370\267\335\273{\342M@\320"
+	.ascii	"\340j\2557\273\251\027\251N\270\325\231\2148(\323_H\243\330\225"
+	.ascii	"\344\260\306=O\323\234\317\013\356$5\270\223F\016\376\346n^M"
+	.ascii	"\206\214\317\335%q$\313\033k\255\024\366GB\340\2147P\204\007"
+	.ascii	"\337\337]A;)\235^\231`\275\250\316U_\025\004\327\n'\265r\355"
+	.ascii	"\274@\214`\211\310i\251P9\254\024\016J\345z\241 $\330\226\316"
+	.ascii	"\312\205\332i\265\\(\222Y\3377S\333\304Z\266UL\375\334\021\364"
+	.ascii	"zGC1>\305\016\332\b$xj\361\005\223zl\237\261\305\346\037D\\\302"
+	.ascii	"&\265\330\257\355\220\351\260\303.\26611>Ok\2555\214\360\261"
+	.ascii	"O\035\2568:k;d|r\013\260\301\247\200<\236\364\360\002\366n\206"
+	.ascii	"GY\336\030@\250a<\207\f#\b\225\004#\021IA\272\032p\002\021B\253"
+	.ascii	"\003\021\320A\"d\220l\035*0\316\001wG\036\274,\214W\355\366\214"
+	.ascii	"\201\305\203\312\206(?\020\251 \266p%J\255F\254O(\352\231\362"
+	.ascii	"d>\245\337\367/*}\237's\335\3147%\001\006\252\345\363\313\225"
+	.ascii	"\260z4h\032N\233\t2,'\2168\360A]g|\310A\232z\203D\366-\375\026"
+	.ascii	"b\235\344n\016\261)\024\372\255 \023\237\0366\330D\365`\202\213"
+	.ascii	"\244\314R\225\361\250S??"
+	.text
+	.section	.gnu.lto_config_streamer_status.14.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\r\b"
+	.string	"\322\217770\217\222\016\220[P@\006\313\342O\205\334\323\227z\032w\265\265D\333\300>\263v\177\270\371\353y=P\321:\r\003\203\\H;\212\362\313IXFP*\373\255\021\"S[\3374\035\307\263\341t!P\303C\307\341\303m\332\247\263\361h[\007\3224\006s\020\234N\013q\\\247a\276\354\307\230!\305\212?\242\"\257\262\314\\\270!\023\022\031G\261+\212\001*\022l\3757\2021\343{e<=\204\307~-\274\nVP(X\231\027\255\226<\301LP\277\367\230\277\360\253\352\207\327OT\201\314\023\213$\363C8!+\366\227\375\267\243\036\336\257\256o\303TT\312bD%3\265L\t.\305\256\016\\\212E\215z\205\336-H\257\024KJ\3114*\004`\310\314a\311\204\321c\377\203_\341/\t\f"
+	.ascii	"\252\244\223i\021\206\315D`\231\005\324\230\320]\303\321\261"
+	.ascii	"x%\230xp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_config_streamer_flush.15.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375`\345\001\215\020"
+	.string	"\246\236kG\340\262(\035bv\002\210\303)Q\006\020xS\262A\r\213\n\217\252\ni\002pP8\243bX"
+	.string	"\252\277d\272?%\361\255/K\331\360O{rX"
+	.string	"\345\0307\254\357\005]\001\005\232\020C\243\f\005\rido)S\nV"
+	.string	"R"
+	.string	"Z"
+	.string	"3\034\261\002\356\322!g\333G\361\024){\026CX\35313.\261\036s\316nt\321v\031O`\273\\\230\247\036WS\376i\036O\324x\300\226\352\321\3037&\330\301\341\021\240\325\022E/\"\300\323\\9\264V\252\237\006sN+\330\352p\313\333v`{\201\255%\001s2\360k*`\340B\\\372+\333\345wal\370\220a\321\036;T\351\276\354\307\271.[\325\240\207?\210\252?\233z\223j\031\325q\325\273jU\365\005\030"
+	.string	"QC\203\315\234/=\265IC\276\210\261\235\262C\324\276\314gR\017W>`N\227\214\233\031&#\260\026\b`\333>\250\315"
+	.ascii	"\351\256\310\345\332\036I\017z\304Z\325\312\275\214Ebu\026\031"
+	.ascii	"B0\320F\371\212R\001\035\013\2671]\206t\342j\f\374\240\033\357"
+	.ascii	"\030\333\356e\254\021+\355\361W\367\264Z\216\313\217\303h;7\273"
+	.ascii	"/\213\374;\241&G\213\322l\177W\341\0317\003\336\355\221\234H"
+	.ascii	"\246\023\322I\005e\202R\242\220\362y]J\351\304\324y'TGr\300\337"
+	.ascii	"\005\322\251S\371\276S\027\022\316\307\271.\320\216Xv\345\031"
+	.ascii	"h7\007\207\211\270/\373;\214\345\271Qb\307gm\b\307\361\214\003"
+	.ascii	"\2401PGH\267\005Y;B\211\036\374\354h\303\252\354\273@\211$\\"
+	.ascii	"\026' P\002!c\324\016j\322\211L3`8m\263\016\326u\013]\350\220"
+	.ascii	"\003f\202F|}nh\202A\355N\236dy\215?hXtp)k\244\303\236\0067%4"
+	.ascii	"\"\342@\001$\bB:,\332p\230\227Q\326H\316G\341\346S\273\204\207"
+	.ascii	"\221\273\261\215\212\345\340\315k7R\005Z\3364\245xP"
+	.text
+	.section	.gnu.lto_config_streamer_finish.16.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375`\356"
+	.string	"\325\013"
+	.string	"&\226O= /\324t\013\302FI\026"
+	.string	"\243\203p,\260\244\3054K\200|\204\263\235\352\262$\036\032@\f\235\314\311Hc\266\200\336\020\251\003P\204\002Z\244\243!\243Q\002\t3{\023\262\367\336)\005="
+	.string	";"
+	.string	"?"
+	.string	"\273\332\343\216\353\225~\300\365:;\374;\235\362\363O:\0051\216`\2309\335\360I\017\250N\300\b\020r\250\243\363\001<\3512C\270\221\022c\260\273\226`\250\341\256\267\335\300\266\002\373\020\002?\225\322\317\256pW.0\251\335\316\330\332\025\025E\310\366g7l_\332\027}\364]\304\\\300\256G\305iWD\340\004\331\253\305\314\266\037\342\">\033EEP\370P\n\f\246\325\006\362\2409\031\247\030\252\315\314\034\304R\235\246/\327\347\203\022\013\216d\331\256p\022\227lw\027\370%\013\0272\017\257>\346z\375$ j\301a\204H#G[\314\310\371\261Owz\354)\215]\f\333\275A<n\022\341<K\305\201\004I\004J\267i\024Id\242m^E\203\030p7\201\3634K\327yZC\334\333\330|h\346\306\366\344&\214\302f\201Q\213\316\217\351%"
+	.string	"\200jj\306\352E&m\n\225\026"
+	.string	"\252\244\223i\021\206\311Z"
+	.ascii	"\030\346=\211\241kB4\b\302\n\203\253H\315\013\026\240\341\022"
+	.ascii	"+\240c\035>\263\206\013\243\217f\244(c\0044\021I\t\264\352\246"
+	.ascii	")\205\202\002"
+	.text
+	.section	.gnu.lto_write_word.part.0.22.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375`v\002m\023"
+	.string	"fd~H\3200'\035\360'\311\301K\321\303\036v\034\226\270.\207\362\332MT\217\202\r\222\333\n\332=\236\331\260\3407Uk\372O\225\266E\235?\250\317<\203\\\215\033L\245\017s\312\302A\205#l\320\313n-J\310\336[\312\224\002g"
+	.string	"l"
+	.string	"d"
+	.string	"S\347\211i\316\334\202G3\370\036\235\373\354\003\301\330l\373#\376#\263\235`\216\347\346a\220\242\321\331\230s\256\036?\216@>\302\037\220\217\013\342\262G\270*e\276\326\334b\036\267H\t\306\231\032\263\250\335\355\346\013!@i"
+	.string	"\352\270\321\340s`\f}w\255\335f\252\006.=\2219\247\277\r\267w\333#\266#\330z\024\033\325z\335\177\001\253\016\003ps\332L\345\230\036b\223\317\217~\245\373JG\362M$\025\371IV}1\266o\251\246\"\306\375\"\030\177g\225\355\037\335\250\305\266\033\265|\320r\363\266\222b\305\217\2159s \217~\360\311l\225W\257#rY\"\027\017\002\2236\024\242\201\352\205`\036\364\342\221\233\031lV\265_\3429\331\203^^`\0068\240\214\346~\360>"
+	.ascii	"\016\212\303\356\216\341[d\\\017\037\021C/hz\303\035\252\013"
+	.ascii	"\327n\231\350k\342~\314l\214\355\223\237@\371\346\234\016\374"
+	.ascii	"&\n)~\317\243\377\"\001\220\360\231*\270\374\036\337E>\352~w"
+	.ascii	"\00574fQH82:\245\273\343\225\207sulO\375I\265'\325\362Gw\224"
+	.ascii	"jx\241?0\226\030I\f&_\255\222\022\226\t\222u\263B^\255\024\222"
+	.ascii	"\326+\006\03319)Qq\261V*'$)+\326\013\266\nI`\327J\353\265\212"
+	.ascii	"\271\\\257\225\352\253c\317\006\207f\t\202\374\273K\250I\321"
+	.ascii	",\255\205\333I~[\263\375\255Edv\346=\234\336>\241,\317kd\300"
+	.ascii	"\243H\271\336\252\356\002n\246S(\344\312\237\0268\240\375\316"
+	.ascii	"`\221\343\002\252P1 \200\002\031\263\253\003\352\351\234Z@y\246"
+	.ascii	"~\025\026\324a\314,\362*\003\205\325\013b\035M\313\343Pth\302"
+	.ascii	"npm+\260\362\3571\nc\033\234*\203r-s`\007h\351\021\346\\eH\347"
+	.ascii	"\212\215*d\222{\0314[=\2536\004\361\t\332\214ov\211$\221\033"
+	.ascii	"$\275\223\255=\355\006\b\355\036\232\254\272v/\f\364u\342\b\240"
+	.ascii	"\274\367Z<\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"}\006"
+	.string	"B\t#)\200\253\016<ZT0\230\022\303\325\254"
+	.string	"\206\311\t\246\372\222=\314\003E\261\031X"
+	.string	"\374\377?\331\356\222\350.'$\222$S\n\313M\201\226\020\226\315\233H\256\346\021\351\330i\356\244\356E\024[N\216\037\3061Yn\2760{!\230\201\270\271g\033\341\332\301/\203[\005\307\370\351\357&\b\236q\3032x"
+	.string	"\233W\232S\231\013\030^\bb>]\036\305I+\226C\262k\255\265rI\361sR\312\256\357~\224\235\377\177\312\267\270\273,\t\033"
+	.string	"`h\227\241\263\032\f\002\002\2038t\f\225\031\034\250\035"
+	.string	"\035"
+	.ascii	"\235\017d\317/\205\2030\036\266fA\236&\320;\364P\3607\300\037"
+	.ascii	"\251\004\230\2010;\177Te\221\253n@p\301q:\230N"
+	.text
+	.section	.gnu.lto_.refs.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ff2c1e00bc9590a7,"e",@progbits
+	.string	"(\265/\375`\013\020\305O"
+	.string	"\312\207\234\035TPPJ\032\016\253\212\373\337\272\235\323\373\233\353s"
+	.ascii	"\270\246\302\266I\333\276\342s\312o\203P[\245\262\r\273n\243"
+	.ascii	"\356\201[\021$7\364\027n\357\2263E\305\231>\216\035d\003\\\356"
+	.ascii	"h\273\370\211\034\233/A\0131\267\305\033xh\342\206\3069\334\337"
+	.ascii	"\333M\312\024\200\001\301\001\324\0017]\210\t\"\205\315\257\025"
+	.ascii	"z\027\366`\347\327\210~\247\320\0366Y\333\022\242@\030\263\316"
+	.ascii	"\272\327?\360\017)w\311~\325\326c\003s\f\203\250\230\341\302"
+	.ascii	"B\353n \366\311\256\253\274\271\002\001\t\220cd\t\021\257\323"
+	.ascii	"\374~}\235\240\320\035\300\315\354k\335\301\346\372\260?\354"
+	.ascii	"J\3006\371\t\024\257\371\220\235uK\023\222V\206\315\347\320/"
+	.ascii	"\227\200s\231\f}\275F\234B\342\332:\023X\341\340\201\315Z\021"
+	.ascii	"z\034\372\023\320\213m\317y\023\320\253@w\216\034\314\364\241"
+	.ascii	"\004R\261\371\257\221\177\2616k\223\265`T\261\273\272W\036\234"
+	.ascii	".3\314\370\330\334!Kd\327\237\335\372\"\267\310m\300\265\223"
+	.ascii	"\335\253\316\215\022\312\f\214M\237\3559M!\364\277\326G \033"
+	.ascii	"\305\031\375\376\234:\373s~\335\236\023\335\021\347\277@!(\240"
+	.ascii	"\363\363jp\233\237\207\224\376\005\301\354%~n\200\304\002\177"
+	.ascii	"\322\344\277\362\277\223\377C\234\375\317\262)\376\0030\300\003"
+	.ascii	"\370\331\200\377i\373\301\277A\036l\007\313\377X\376\275\200"
+	.ascii	"\203\377d\377\313\376k1\373\355\347\236\177+\330\200\346g\333"
+	.ascii	"\277\032\374\213\301\277\026\374+\364/\003\377\"\360\257\211"
+	.ascii	"\177K\374K\342\337\235\177m\3765\377/\377\375\377\257\377[\376"
+	.ascii	"\203\371o\345\377\t\377I\370/\345\177\221\377^\376w\371\317\345"
+	.ascii	"\277\212\377f\377\215\374O\376'\340?\330\177\333r\271\\\376\254"
+	.ascii	"\376\354\342\2771\023G(N\244\330<\313@\317?\364\347\377\354\216"
+	.ascii	"A\263\266\260\t\347\\\232\335\237\377\266\265=\340\277Y+`\254"
+	.ascii	"\373\006\0160\350\017\257_\r\366\351\237n\2370\230\254\362\361"
+	.ascii	"\004\223\277\016\032\021\033\362\004\327\246\n\240\2238:\270"
+	.ascii	"\026}f\321\307\2756\260j\330\300\242oEpma\257E\337N\003\207;"
+	.ascii	"\301\365\347\013&\253\206\033L\026\207<\rl_\003\177T(\2608\f"
+	.ascii	"J)\016w\202\311\3370\b\254\032n\257\305^*N\326*\237S'\177\267"
+	.ascii	"\356\216Z\217>\234\356\237\260}U\370EW\235\275\350\251^1!+\216"
+	.ascii	"\356\356\366u\225\031\213\266\265\251\305\202@\212IN\335e\375"
+	.ascii	"\002\002\337\372\326\356~\352&\337v;\255\302\356\246\"\n\304"
+	.ascii	"\342\216=\t\373\326\300_T\223\261\210\343\324T|j T;\f&\215\305"
+	.ascii	"\241\037\216$\217\335\264\372\366\330eUB4\351\333/\267\244\025"
+	.ascii	"1\n\214\215\354\313\f]e\350\277_\2247C\222Z\224x\351Rk1\004\214"
+	.ascii	"\327\232\205#%eU<\033\253\301zb\354b.kF\201\rS\315\346\026\023"
+	.ascii	"\266/\310&&O\3126\312\206I\340$\264=Y\271BB\344X\244\353\312"
+	.ascii	"\034\340N\003\215ZG(o\323(\344\311\313\325\225\315\262Z\226l"
+	.ascii	"\261,\021\273n\331N\371\n\261b7\261v\0037\353_\256\377\004\212"
+	.ascii	"-[*;\226\343[[\3524v=yA\333$e\253d\225+\326\265\201\225!g@@&"
+	.ascii	"\200\200P\252\265G\r9\346\216\361Z\331!\276c[\005\007\270cf\367"
+	.ascii	"o\327\200\234]\003h\224;~EN\363\353\003\372\345B\271\267\347"
+	.ascii	"\364\331 \350\006\261"
+	.string	"`\273\036l\245\004OH\300V\224\177\234\201\3746[\223\251\034UW>~[M\022\262\032\307\037\350M\034v\354\340\036\273\2636]1s\004a\306\025/<\316=\210eh9\302NDW\214(l\336\264\201r\216\034l\265\310\226\252\341:s#\fZ7\361\347\\\203D\234j8[\361\r1$\331\"\262\3116\234D\032:\304\230\241\254\343&\262x\253\375f\204y\261\3114l\030\363\370Q\003\254&\005\375\231\306yje\032l\034!\270\256\276\023J\204D\006p\202\200\302\201\t\233g\343\3177\270\b\314\3611&\353\310&S\r\235\253l:\274\240\252\260\271\313\345\2168w\232\273w\304y\266\3013\3746\232)(\031^_\350\271\206\025\026\225\0226\321\336+\317\327\220\020\211Ql\320\212\204\261\341c\306\f\226\201j\035w\t\214.b#F\f\226\341\301N7q\341\341hs\202\302\372\301p\226\241D\217\354"
+	.string	"\002X{\001\345(\216b!\332\333c\206\030ihdZ\252\f!u\026*oeI\316n\260\3110t``\2612c\223_\254\027\03421=d\331\"\316)Rf\310pqr\342\026hw\327\272\247\264\034kU\276\220\221\001una:\215\361Hc\223\2035\256\257d\0206\371i\303j\320x\222\272\322\214\341\007\254\260((\377\316?\006.\261kDL!\376\334@a\205)\271\351\f4\263\031\003\245E\360\f;\ts\361\"\211\242q\243\355\362\354\336\265(%\3340+\346;\346cv\211\372\272k\240\314b\244\2415Q\370\363o\232\022\247{"
+	.ascii	"\026\256\300~l.\231=\203ba)\223u\306\214\215\330\320\307c\313"
+	.ascii	"\rY\306\330ln\231\235\2626\372\325\203\007\fl\276\2105r\013)"
+	.ascii	".\251\310\247\267c\272\251P\304KaS\302\223\202\220v\272T\355"
+	.ascii	"\t\345\214\230\224\212v:\241\264\307$TBI\211i\267\343\355jT\242"
+	.ascii	"\223\005/MRy\273\232#\\N\311Ts\275\245\334\322\231C\302\211\220"
+	.ascii	"\353\341\322\rt\236\024\224\202\204\017T\b\2519\244\024\247\372"
+	.ascii	"\250\3001Jy&,\341R$^*\002\221\007*.H\301\001\217Q\256\006\247"
+	.ascii	"\3424X\342\245+r9\233\244\236n\247;J\3521)\035\365\230T\234\332"
+	.ascii	"+\221\342\324^\217\252\333\351H\274\310\306"
+	.string	"\201 5\305\255\b2Jy,\210r\252.e\301\363\"]\232\333\345\220\320C\020A\003\021H\260B\215Jt\342\001TU\342\3610 \2421\312\251P\304S\3321\241=\036\225(UW\330z\275\\jd\204\253\311\265\240\353\231OJ\340\274\025\271TH\345\361R\241\033\225H\002u\247c\252IaY\354\251\3428Ms5\225(\267\202\005\225h\207\244S\302\021\245\271\243#\246\024\210\020\370\320P\006>%\204\320\001Z\024\224\346\226p\271T\355\021!\351\216v\274\"\241\235\016\267$T\224\366\204\202\020\360b\253\333\013/h8a\362\265bW7\216\274\204{@\203\360\372\301\300JP&.\316\322\222\354\222\n\006r\fI\017\0352>Z\034W\034(F\242\200\\\214D\"\203\016#\037a\255\0341\255\245\rl&\223\214,s\274\025\317\230d\371\262\265\305\310\345\"s#\f\232\355\206\035>\316\024\261+#i\252"
+	.string	"\341\221\204,\207s\220\034X\253F\266k\023\2135.P\310\210\\u\220\370s\263\345b\213\n\017g\2553\221\023(\276\345J\007\262\037\233<\3449\304\260&gX\234\365\333l~\344H\356\300\205\276\001\344\214\341\220M\026\362-\fdKT\0276\371\352J\342\025\264\032x\207)F+Ml\262\0169M\002\201H\250\241$g\230DFdHD$I\222\f\007A\005\204 G%\265\r\022"
+	.ascii	"FE\017\315!\021\321\266\220\375:\256*\232\002*\370f\237\224\245"
+	.ascii	"H\306Y~6\373n\020A\3365\250\310\332\016\275\220\242\315\205{"
+	.ascii	"\303\316s\214\255@\314J\245\274\005T\177\200\324\201|\227\304"
+	.ascii	"\342\0220"
+	.ascii	"\245t\344S\337\264w\217\022\227O\300\374Z\200y\333\344$\265g"
+	.ascii	"B\371[\250\351\335\304\247Xg\223\317\f\024k\277\222d\001\377"
+	.ascii	"\233\r\252\032<\223-\327\366&\027_\214\254\370\232\331\230Hd"
+	.ascii	"\263\023\242>\322\306\333M\230rH\237\223\337\336\034\023\244"
+	.ascii	"~PZP\276A\\)\201\374\272\022N[\037\313\257k\003\220@\250\240"
+	.ascii	"I^\327\036\n\257\234TO|K\t\371\245U\367\205yC\007&\376\272\205"
+	.ascii	"#\332\347\314\347~C<0\336|\021\210\033"
+	.string	"ZBr\272\267\204dE_\313X\035h@^\330\355\277D\227\177\316\206~\225\312]\271]\353\026\226\203\013\3477o3QH\264R\263\271\216\245\203\246\362\031 \225\266\234\373L\213\272\312B\b\001\206\220\360Id\267\023\270\223\326M\262\016\201\353(\007\234av\005z\332\230[<452\217\265Tp\245\355\270x1P\312\223g\201\215\275}\f\373-\365x\227\236\234.y\244\265-\033&D\245\201\027\227\240G\034\314Y\276\375\0258$y\246\272\3251\245\024,j\304\232\257\351t\r\355\317\265\234\304\257\023\241\304\301%\025\270_$\b\007\2522\374\227\202\177\227\247\336\370$K\310\005\217\013AY3\020\242\252\b\2602\327\326\235\020\230\241k\305h+\001\004\002\001K\207\350\253BSTA\t#\300\262D\346\322og\203\034d\374 \201\240EC\307H\322##\230\016\020\034\370<F\276\311\327\335\356\034\272{\352"
+	.string	"\023\366\355m\315a\202\245\321\027\373\212 \2072\374\036~3\2701\331W}\310\001A\374\342e?\244\025\021I\2564\020@\nF\025B\372\304\307!\f\r 6\226\335\334\317\332"
+	.string	"\204\360\327\371\305\235 \266\035|\313\363\003\352\253\251\356\264\f\374\265\341\343\377T{7\344b\355;\236\001)\rv\264\324\325\210\373\003\351;\250\017N\375f\314\bmG\225\\4|au\323Z\220{\342D\375\300\203\375\323\272>\246Ez5\256\373@\231\241\357\3538u\346\370:\354\344\005\263c?&\01687\3014"
+	.ascii	"v\001\253\354\307W\005"
+	.text
+	.section	.gnu.lto_.symtab.ff2c1e00bc9590a7,"e",@progbits
+	.string	"config_streamer_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"config_streamer_status"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ff2c1e00bc9590a7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,490 @@
+	.file	"feature.c"
+	.section	.gnu.lto_.profile.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375 \250\265\003"
+	.string	"\264\005\234"
+	.string	"\r"
+	.string	"\227\247\344\313\017\004\002"
+	.string	"\002\001\002"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\203\313\255\261\f\002\004\312\251\326\231\r\001\005\335\374\335\212\013\b\002"
+	.string	"\006\364\327\362\364\r\007\347\364\313\323\006\004\b\306\272\236\261\001\t\222\200\241\200\n\212\205\272\326\001\013\255\363\313\362\b\f\240\342\234\212\n"
+	.string	"\n"
+	.ascii	"Z\030Zf)\2000:g\345\360\305\321q\211\2423\314\224\3336\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375 BE\001"
+	.string	"\2706"
+	.string	"\b"
+	.string	""
+	.string	"\001\003\001\003\004\005\001\006\007\b\t\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\007"
+	.ascii	"`\b\030\027\f\202\313T\246\311\fp\003m"
+	.text
+	.section	.gnu.lto_.inline.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\305\003"
+	.string	"\002\005\017\027\260%\351\fE\223\202QJ#j \222$l\264\021B6![\356\024\377\374B\366A\227\254l\312\377\230\240\261.@\333\340KBq&\303.`\377\234\367h\360+\261m\311\233k\b\030"
+	.string	"Q9\260\203\212\305\272\020X\006Bp\301\260\325` \031\341&\b\354\224\254\300\260>j5\200\007\307\2260\261\205v"
+	.ascii	"\362\3000\300\344(\2743\033gA\302\245U\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375 BM\001"
+	.string	"\3206"
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	"\003\001\001\003\177\002\003\004\005\006\007\b\t\001\001\003\177\002\003"
+	.string	"\006"
+	.ascii	"`\b\030\007\006\003C\250\214\264\001,"
+	.text
+	.section	.gnu.lto_.pureconst.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\230\004\003\204\004\004\204\004\005\232\004\006\232\004\007"
+	.ascii	"\232\004\b\232\004\t\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375 \312]\002"
+	.string	"\224\002\276"
+	.string	"\b"
+	.string	"\001\002\004"
+	.string	"\001\002\003\001"
+	.string	""
+	.string	"\001\002\005\001"
+	.string	""
+	.string	""
+	.string	"\003\001\300\007"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\006\007\b\t\004"
+	.string	""
+	.string	"\016"
+	.ascii	"\2202\005\003`\035X\030X\244\347:`\204\244\216NE\302Mb\324\274"
+	.ascii	"c\027\037\004\274\001,"
+	.text
+	.section	.gnu.lto_.lto.2284eef960519b24,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_featureConfig_Registry.18.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375 \236\255\004"
+	.string	"t\bh"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\244\354\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\376\006us\250\326\006uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\023?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/config/feature.c"
+	.string	"\004"
+	.string	"\237\n\013&q\020u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_featureConfig.20.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\021"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006(\001\200\211\001?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_featureInit.22.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"E\007"
+	.string	"\022\01635`m\322\001@\337\r\024\260u\234\367\262\200)\306\220<@\r\325\212\224P\227\f\3271\320\266\327b\241\205\201\240\362\b\002Aq\321\227\360\354\360\244\377H6\221;\245\306\256Lr6\224\254\002\031,\025L\304 \306B\271@Lj\340e\340\330\220I\270\211QB\213\264\235Z\005\275\r\323\246\036_\375\217\203\\\374\220c&S\375ii\226Xs\017N\300nD\202\337\361\221\203\037\372\363C\307}\376\371\235\352\357\272\200!\032m\356d\223<N-\354S\273\273V\220}\347S\226\006A\310.\305\351dMO$\303\366-k6I\201\304\300\310D\311dw\241^\\\273\323\374s\\`~ \356"
+	.string	"\024v\327n~*n\275\355\003\333\b\266E\001\t"
+	.ascii	"3\241{\037x\305\\\366Tr\210\252\301\273\340\177\0317\\\216E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_featureIsEnabled.25.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\235\b"
+	.string	"FQ>90\345(\035\3003\004\027\f\232\0275i\250.vx\244FB\037\360h\003\177\344m\375,\017\255\001\004\333\234#A\204\202\202\002\210\"x\270\212t\033\004iKH\223M\244L)-"
+	.string	"/"
+	.string	"*"
+	.string	"\207\266\335\340\360yt@\241-"
+	.string	"N#/\273\254\250\032\037=G\376?\256\340\302\202J\221\236\001\017\273\353D\245,n\275\355\004\333\321vJNM\037\033@1P\331\255h\005\330\025h\302a\373\2633\2663\355w\334\343\373j\302\230\335\013\222\222]\021\006/\b\034j^\200\035^'\300\002\331\362\245\327\324\237T\246\203<\304\3637\034\022\345Q\207\276\b;\274bT\245l\331,Rj\206\375kw\327\212a\370\325\177i\006\021^\346\271\254m\266.\004\3126N\204\350p>\234\026?\235\314\023\265\316\213\033\004s\022[\027A\034\327\305\fko\250\232\222\232\354{X*\324\237NL\001\b"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313\250@\215o\342\020\246"
+	.ascii	"sM2"
+	.text
+	.section	.gnu.lto_featureIsConfigured.26.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\r\t"
+	.string	"v\322A:0\345(\035\200\213\0073\177\025(\027jhe\re\203E\232X\t\236\255o@\206\001?\364o\006m\007\005\333\234kz\035\f\f\bai/JY\235\207\256\334-#\233H\231R0"
+	.string	"1"
+	.string	"/"
+	.string	"\004\332\241m34\244\254\372\327\321z\206\307B\021\260\373E\345\270\352\251\362?r\b\362\202\361\\\024O\201\207\335uz.\213[o;\301v\264\r \260?\323tj\372\232v\361b\320\262\333\212\rX\027\250\362a;eklg\332\017\271H\3520\224\007v1XRvO\026\254\2209\334\274@;\314\036zM\205\001X\257\316\0237Aev+\034|\222\227\220|\217C\233Ny\357\320?i\207W\204\030\330*c\366\327\245n\330\317vw\255\032\206\017\021\244\216(\263\207\363\341L\245\316\007\024!B\240\321\346\211\243PG\024=\034)r\016\274I|\270X\3326.j\276\325\ru\263\322\316\376\246\245B=k\245\313\230\263\b"
+	.ascii	"2\003\3020\275\341\310\241\262\272\313(E\215\177\350\020\306"
+	.ascii	"tM2"
+	.text
+	.section	.gnu.lto_featureEnableImmediate.27.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"5\013"
+	.string	"\366\023IA \251*\035X0\260\\\340"
+	.string	"\006\346\240\207a9\374\205\265\023\300\300H\201\373\234\200\200(\r\220@\013\375\f/\005\024\225l\204l\271+\004(\022\t\" \366\250;\220\201"
+	.string	"\200@\2031\262\211\334)\0053"
+	.string	"7"
+	.string	"5"
+	.string	"\216X\270|\370e\273\324\316\260]\372\263\033<4\331\273BN\002 \354\356\324\222\177\217\237\177\326- j\343Qabw\035A\224\307\255\267\ra{\332\027\005\326\276\372U\243\243eSY\320\200`\267c&a\025\310\003\252\327\r\200<\300[\244\207\256\210q\2276\311\346.#g\373\321\376\312\001|_i\330\262+\222@\266\373\222\b\251M\013\034| Uu\323O8}\230>\340\0042\374\023\203D\361\340h\273\224\372\326/*\027\003X\252\024gvh\212Jb_\333\335\265\216\330\032\275i\264\324\030\027\240\214G\263\006\263\361D\241\314\2063-:\234O\247\231\237N\30635\036hb\034\334al\274\031\352:ora\351\254S\244\310\"8(\251\311\232\306T\243j\260n\024\365\257\037\205#\033"
+	.ascii	"2\003\302\360\317\302\"\233x\0208\251\314\002\327$T\200\270\340"
+	.ascii	"\360P}z.\202\225%\305\356*\233\223\232\002\007\333\3125 \204"
+	.ascii	"\b\020. #g\022\240V\256`\211X\265\002N\362\342\232d"
+	.text
+	.section	.gnu.lto_featureDisableImmediate.28.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"}\013"
+	.string	"\266\024K?0O\224\016\254x\201#C\343\253\252\006\037x\230\033y\223\221\344\025\2765\260\t\306\003\035\017\264\212\265\031\264\035Vls\256\351u\310E\262j\300\016\375A! \206E4\023YD\310&R\246\0246"
+	.string	"8"
+	.string	"7"
+	.string	"{\n`"
+	.string	"\031\207\036\217\\\207\3267\256Cs\366\212\177\023\366\035(\200<\270\330\335\250\022\316=9\377\245C\274\220\202'&`w\235^\310\301\255\267\375a;\332_\020\232\206\232\266N\372U\323\251q\231H\301Qb\267\301\n\306\242\200#.\234NBt\0167y\376\231\200*;\264=vv\230\231\355\247}\r\337\300\235\224\300\220\335\007'R\033^\213K\241b\372\030 Q\227+\253^\232*\320?\034\004\002\277\2025\234\274\327\271\016\241\336\364H\206N\005j\364\311\225\375u\251\021\354[\273\273V\b\266\2461M_\001\0064\023\214e\212\244\262q6\223\212%\026\270X2\032%f.\023L\244l\232(\351\260v\240\262\305\215\246m1\373>/}"
+	.string	"\206\324\013\026\037\355l\251\210T\013\245uR\177\372-0\030a\032\342\001\033"
+	.string	"2\003\302\360\322\302\242\233x\0208\251\314\202\234$("
+	.string	"\273\240\341\241\344\364\f\004\001\253\312\356\020\354\235t\024:\204\226\256\001!D\200p\001\0319\223"
+	.ascii	"\265r\005K\304\252\025p\222\027\327$\003"
+	.text
+	.section	.gnu.lto_featureConfigSet.29.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\245\t"
+	.string	"\206RC<0\345(\035\200\277\236\277fl2\035.\235R\271\377\006\336\206,\005\006\216\025_,]\345\360\2060V@\333A\3016\347\232^\207\226d\243\241\302p\207\032\346\txb6\310&r\247\024."
+	.string	"3"
+	.string	"/"
+	.string	"\327l\227\332\r\266K\1776\314\303\217\375k$\025\013\260\273S=\376=~\376[\317\200*\213\307\201\206\335u\004U\030\267\336\266\202\355i\277 \003\\\016Xv/f\004\266E\252\254|\223\273L\017\375\260\"\262\273\334\245m\262\271\313s\266\037\355\223\274\344;\253\302\231\335\215\024\331.\214\301\013\004\227\t\001\251\f\324a\217M\370 \036\225\342\301K\237b\273\214z\3275\253\327\013\212\306)\316\354\020\025\265\303\276\266\273k\345\2605Z;\353W\215\216\333\026\021#NHsg\343\361J$\216\3473!@\037Q\327\231\"\020'4;\336hn\020\334Ix\274I\352:or\341\351\255;\204\310\004\304\234\024eMO\016\002P\215\252\351\013\004\016"
+	.ascii	"2\003\302p\036aYL<\bXR\354\256\262\211\244\254\256\313h\246\342"
+	.ascii	"\001*\004\261:\r\256\345\2050\311"
+	.text
+	.section	.gnu.lto_featureConfigClear.30.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\375\t"
+	.string	"f\323E=@\305(\035\340\265^\254\253\273T\007\230\200\373$\246\375\007kL`%\344\246\334e3\324O\305\327\240W]{\230\262\341\304_\371a\r\005\2149\017\261la\314\365!\026\255m\"wJ\0012"
+	.string	"4"
+	.string	"1"
+	.string	"\004\227\006\337`.\265\027`.\355\331\001\036r\354KNT1\002\273;u\343\336\243\347\337u\r\270\242x\314,\354\256#\270\262\270\365\266\021lO\373\007\001W\215\216\231\f\313\205\303\262[13\260-2\305\303'\371\013\365\320\r/ \273\273]\332({\273\374f\373\321\276\310G\274\267&\254\331\305X\221\355\302\024\234\020_\234YU\323\250\242:\354\261\b\277\303\245S<x\351K`.\243\376\365\315\307\007"
+	.string	"\205\225\2123;\374\242j\330\327vw\255\031\266FK\215\326\336z\017%\317H\363\247\003\352N&\017(4\035D!\022\367\231$\221g4?]iv8\346 @\3354q\\7\2670u\327\031Bd\005\004\244\364\263T\223\203\0034\215*\365\007T\027\001\016"
+	.ascii	"2\003\302p\301\3022\231x\020\260\252\354\016\301^$5t\270\314"
+	.ascii	"f*\036\240B\020\253\323\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_featureConfigReplace.31.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"=\b"
+	.string	"\006\220;9@o\323\001x\255\301\216\223\371bl \306zc )\020\177\214u\004\206\266%\267\201x\226\275\255\224\332\264\fB\216c@\364\213\035\f:\030\337\006\006df\277\355\275wJ\001("
+	.string	"-"
+	.string	")"
+	.string	"\324\236\355\362\020c\237J\211\030y\331\335*/\356=z\376?\276\001M\020\217\031\204\335u\004M\023\267\274m\002\333\3256IG\375qf6V8(\273\022\253\230U\321\023\215\313\366\243\375\216{xG=x\263[\241R\262+b\340\002\315\351\300\003\254\323y"
+	.string	"\353\001\356\236\032qXv\367\300\007yH\203\237qj\007R<x\352\223\254\323\313\244\005\206\342\213+;,Eia\177\356\356Z\236\354\013\035\006\232\316:\0327\022a\232\247*|<\241-\253\241\017\006\252\031\327\325\216\2007\006\215\253\242m\343\352\025~\237+ON\340P}\262\344(\035\b"
+	.ascii	"2\241\231/\360\342\002,\230w\t\200XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"%\004"
+	.string	"\224\006\b\001"
+	.string	""
+	.string	""
+	.string	"\002\026\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\005\017\007\301\204\005\025\b\300\003\002\031\177\t\002\032\177\n\033\177\013\034\177\f\035\177\r\036\177\016\037\177\017\005\024\020\305\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\022\021gistry"
+	.string	""
+	.string	"\005\020\022\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\345\334\006\240\035\370\034\370\034\370\034\370\334\316/7E\232"
+	.ascii	"\205\211\310\252\236"
+	.text
+	.section	.gnu.lto_.refs.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375 a\345\001"
+	.string	"R\304\n\020\260'\215\001\f\3030\221\231YK\366\2262\245\024\t&\354\003I\r\b8\031n\330\3045c\032\333\\\242b\306<\2617\255\253B\005"
+	.ascii	"?\t\001#\2519*%\260\tf\023"
+	.text
+	.section	.gnu.lto_.decls.2284eef960519b24,"e",@progbits
+	.string	"(\265/\375`c\016mI"
+	.string	"\212\200\374\033VP\022\036\245\003\376\372\220$\262\207\027\313\t\025\215\212\333\037\251\262\022\364\274}\230\177cF\376\356\213&?\273\246~\222\t\354b\266!\033!\035\302\332>\255lG!L\3515\nU\002H"
+	.string	"U\365\250JTw\242\300\352X\001\375p\304\027\356\235\207\364\004\344w\2232\005v\001\251\001\261\001\215Ja\244f\032C\352\036\275H\"\251\217\356\356F\217\311\246b-\37552\030U\244a\324\235l\244\030\350\242iw\327\350\037\272\335F\251\260\373W,\201X\\\260\032\302\246i\240\357\350\327T\2341\372\025kt\324\322\016\203\306\246\"\017\027\226\021\252\177)\272P\235d\022\232F4\355\315Bct\"\036qU\302\242\314\201\207\"Ei"
+	.ascii	"D\037nla\231YV\2206\270\376\253\265G\037\\C\274\270~\201\237"
+	.ascii	"\347{\334t\261fU\302\0066%\241\223\204\227\021\227\227\356\364"
+	.ascii	"k\334\343&\251i\267\016\013\232\246b\013Z\265\276\002s\253\326"
+	.ascii	"j\2159{\3655\262G^\003\246m\354NmjaYx\034\271"
+	.string	"\276\001\363\213\344+\254\232\201\003`~sJ\233\315)\317\246\213UQ\326\275)\267\310R\345\314\202G\305>v\247)h\234\b\373Iq}\272*Jso\312\253\255\"4\020\033\002\003\363_.\r\302\224,\006Y\310\332\277U81\377\376p\034\024\377\326\360\377\370\357\376\347\237i\3772\360\357\003\377:\360\257\214\177\025\3707\306\277\r\374\013A\005\377\016\360/\317\277\t,\005\377m?\027\375;\301\277\021\374\313\377\251\374\027\373\237\374\037\366\037\354?\362\277\327\377'\377\205\370\337\344\377\325\177%\377\267\376k\375\317\372O\365\377\346\177\224\3772eeee\377\202\371\031\307\217\342\030\\b\024\273}\313\305\006L\267\317f\367\305\356\213:\325\364\244U\326\317\224\314\217\255\212\262fo\312\275\302\363\035\273)\205D\033~:F\211\302\225\206\303P\241R\304\002\351r<bBLL\253\006-V\261\361$\231\234*q \257"
+	.string	"\271\n\013[0\263\273Q[\377\276p\200\252\025\221\304\204\004\221\"e\301$@\262c\314T\222\343K\215\375\372\202\325\257#aI\2569\220\310/\027l(I\325\004\031\202E\t\256g\037\024(\353U\023{\242\326\364\345\204\013\327\365\332.\232-WH#\\\267\2137\312\036\361\355Z#f\200\351v\325n\337\356\213\232\335\027\264!\202\370\220\224\365\013\306\374\226\305*\275p\200yb\312\223'\213\265\301\005M\226\214\265\220\311\001_(B\030W\210]\262B\023k\3528\326B\342\0013_\225'dH\314o\020\313\344\313e\\\256m\262\304\236Q\201bC\311K\023\21196VIY\310-\337&\277\002\f\334\312L7Uw\027@\223\022%D\213\353w\006\363\377\267\354~\201\226\266\3607S\376\373\245\355\346\3744;[\003\376\327\356\3773\025>\272c"
+	.string	"\323b\362\020\204/\211\353\177\027\235\323\215\n\203F&4E\320\350\353\340\025r\230\"\230\366\322\2126\372\350`ZDk\021\345N\033\3104l`\021\325\005\323\026vZDm\r\034\332\202\251\017\r\032\231\206\0334\026\207)\032\330h\003}K&\2608\fv\025\207\266\240\3217\f\002\231\206\333i\2617\t')\023j\324F\037Mw\037\245P\350L\267O\030SL\204}`\036\270\007\226Z#G\361\217\263\220\207\300=\302QL\0037-\362G\005TL\350\260\320\261\321R$\211\016[\215\341U\n\370\00570be\254;\205\342\035\326\310:\234E\332:0\020~Z$1\355\027d\224\214\205\021u\006\320\241\301\002\226L*\237\204\324"
+	.string	"\221\336\220\205+\007\211!\352\210\302\202\224\323\0329\007s\213\024\327\027\256\337\362*2D"
+	.ascii	"i\352\301|}2_\231l0\225\030\343\341\245d\276\022\315\327\241"
+	.ascii	"\311E^Z#\0163\235yp\217\323|i\247\354D\226\205\204\353k\320\374"
+	.ascii	"\342\224\263\262\262\305)_\177\246\355\213\371\031\027\363\347"
+	.ascii	"\031v\320\214Fh\361\342\035L\344\257#\216~\\Y\006\316\261\306"
+	.ascii	"\026\254\203&\f\2210_\254\230\337\026\345\226m\213\36231\323"
+	.ascii	"\2667\245\213\234\275)\371\210o\330L1\261a\013\311\003 Hlq\255"
+	.ascii	"l\203\243<A!\271P\223\024\222U\325\002m\253L\313\016\256\034"
+	.ascii	"4\215f]8(x,\241!\211\3539\370\357\025\256\241B\031Y\027\256O"
+	.ascii	"\256\212\222Y\3409\033\311x=\031;\302ufve~\211\354Z9"
+	.string	"\243V\330W\253\322!\tZB\245\003b\246\214\260\260\244\265\034?\310\234\270.\331\226q\377\265\232\223\243/\245\037\314o\030\024?\244\004\351\201+\357\207(\367K-\206J\b\314\2222\277N\354\023\177mF\326\345\244\005\256\237A\231_/\377k+LY\"\302u\273\230F\263%\234\232\230U\025'\256\337.\3776\261X\226K\t\275\202\217\222\210W\270\256\226\335\362\345\262Yf\250US\005\273\333\0314\323;A@Q\244\033\232\321s\0320\200t;@\272\033\237\034Q\006\275\223'\223;\201i\274\236\231^O\016HG\313\001\351f4z@\2713\250\354\365\310\3409U\300\361*\217w\356~~n1E\272!\237\332\353q f\327\323\315NS\264\353\361p@\347\007=9 \\\320-\346\347\344\021\325\334\020\256\347s\362b~\353\335~v=@:\0305\273\033\r\237\332s\366nA:\2413\204\336\311;?"
+	.string	"\322\2658}nA\272\363\203\335\355\f\232\001@\357\004\301\306\303]\260\342\354\335p?\247\220\020\007\002\374\234;\242\233\240\241!\013zh\030\360l(\360n\035\234B\270^\216h\007\200\320\331\343\025\201\020\300}z\270\034\0072\367\301\355\316\334\td>\206\f\004d8\220BL\3574\n\370\220\356\334\355\364\206\206v;2\274\236\0316\275\036\005\026\350\345pD\346yxf\270\020\301\003\rL\037\030'\354"
+	.ascii	"\341N\310\r\371\354\344p7\241\035\237\035o"
+	.string	"\007\006\001\274sG\324\273\235\031\374\234A&\334r\247\315\223$\341+\023\355\236u\367\020\203\242\375\330\212\255\370j[\330M\214`\352\210\261&\ns~6\236\257^\013\263\225\322\300\225\221,\326\006o(\242\2735\002\230\323\023^\252vIu\001\b$\035\234\372fA\2209\241\305F\330\310.\251\266\0066Mab\243\003\210\341\r%\030x\306\261F\0062\025\213\252\024\255\221:\362\215d\0170\\\213\244\300\030\337\022aE@1\277T1\360\fF\250\300\2204\245\006\276a\b\022K\365\363(\361\016*\261\005~~!\212q`\035\026I\2645p\211\2271\356\361\363p\024\373`\342\"\211\021L%\207p\201\026\250\241@f\0204#2\"\"\222$I:1\005\204(\t)4\017\021\220!\243hH\222\024\024T\262\034\201/0\226\310\004dIO\250\374\311\200\306\363\003\nN\353\224z#]\320\001g\275\r\203\207"
+	.string	"Y\375\254;\b\275\247\2122\270\r\202h\242^\256R\036\230'G\351\361\001\320\227\352\032B\355a6\206\007\375\206\255wh\232\177\362\032\351\366t?\023Z\007\224v\305yP\242\025\355A\377M\266R6\r\324s\245p\305N\240\257cn\317\315f\035r\311U\270\213\317\216f\202\025e\347"
+	.ascii	"\352\334\213i?\231\340\317\305\351\013\353\355\213\027M\210!"
+	.ascii	"L\244\245\354[\231L\n\243@,,\306\032E\023\367{"
+	.string	"6z\006,\306\334>Y\374A\030!J\247\"@\324: \260:\305b1$\326I\003\346\023bvP\211\036\222\362\260\247\311l\346`K\240\205\244\240q\243\003\251<\332`\277Hpr\003D\361V\021G2\212\326\210\203\274qd\002\343\313[\372o)\373\004\361\241'\211P|5\003\310\206d:\247\347~S\212OMl\272\233\364\233\033\013\217\336\b\020\347N\256\374\037\303\204\032\016\314a\235\310\201hq\003?\207\217E{B\317\001\\\024\351\264\2235b?\032\364-1\357\357M\253\205\337\362q\320\256\322S)\002.\306\252/P\254d\356\364\334\025K\033]\275\233\013\251\363L\345r.\322I\3335^\2571Kp\030\335\227"
+	.ascii	"\362]\237\373NF\315\241\310\3121\005K\302\274$M\030\020\203j"
+	.ascii	"\022\261\203\277\243\023#\303\254\375<\021.\216\272\256x\375"
+	.ascii	"\245\337\261Q\225\360\277\322\377\375\247\220<u\254\036\235f"
+	.ascii	"\032t\340\240\260\241P\304\b\314\001\333\322\016z\263\336\234"
+	.ascii	"\362\024\223N)7\364\003\031Xi\243\227\037\210%\346\225\304\246"
+	.ascii	"\311\376q\377\376\202\334\353\232\"\217\236\366\254\301u%~\346"
+	.ascii	"3\301=\026\003\260O\231\240\233\305\377\226r&\226\037i\377,\364"
+	.ascii	"\003\277\260!\346\351\337\272\327\344b\273gE\352Rt\241\353<F"
+	.ascii	"\362\206\\\025"
+	.text
+	.section	.gnu.lto_.symtab.2284eef960519b24,"e",@progbits
+	.string	"featureInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322"
+	.string	""
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336"
+	.string	""
+	.string	""
+	.string	"featureIsConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340"
+	.string	""
+	.string	""
+	.string	"featureEnableImmediate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"featureDisableImmediate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"featureConfigSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"featureConfigClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"featureConfigReplace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_featureConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"featureConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2284eef960519b24,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
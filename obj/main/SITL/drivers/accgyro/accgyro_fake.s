@@ -0,0 +1,808 @@
+	.file	"accgyro_fake.c"
+	.section	.gnu.lto_.profile.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"\035\b"
+	.string	"B\f.3PO\323\030\003,\217&\026\033\001\025\2107?\362 o\003\225j\357\353x\003\204zb\314\314\314\314\314\314\314\"\252\0366\314\272\321R\023\262\262\355\275%\265\035n\307\274_\336\261\243\265B\241)\b\354\"dT\266"
+	.ascii	"\375Z\267\326\347;G:\332\006\200^\375\332\207!\002\243Cj\312"
+	.ascii	"O\313\326p\321aT\031h\007\025\3305=Y\216J!\3118\263\222\226^"
+	.ascii	"EP8\026(\027= 0L&I\256\312\345\357M0C\262\213,\212\273\273[\362"
+	.ascii	"\221\241\001\245\004\215\307\341\305\243\243\016\277\252\315"
+	.ascii	"\306\302Q\267D\007\210\205\376\326\177\247fS0\001A\273\337\223"
+	.ascii	"N\306\343\006\034\364\020! \200\202cT;\237\241J\030\323!X4,\221"
+	.ascii	"\352&\227\325F\0207o\223\017\265p\221|\027Y\313;\355\355xj\255"
+	.ascii	"\354\030\0230@\020\376\351\177\013\331\216\002\315\354,\0378"
+	.ascii	"w\341V\032\\\277\336c\201\267\030\205r\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\r\004"
+	.string	"\262D\017\032\260%\351\f\3030\220%I\222\344\034d-\261\326Z-`LHk{\313\224\002\222\352\206*\220\347\021\276\006%"
+	.string	"$C\216uK\361DT4nj!~i2f\336\tw\366\006\374\020\036"
+	.string	"T\035"
+	.string	"\004\324$\222U\300>i@8\220\005`"
+	.string	"\026\362\341D\216\200\242\b\334y\001\356d\032\0033\320\314\262\006s\231\313rW\t\007\006\341I"
+	.ascii	"\330Ka\246\262\006\204nwK\0051h\300\r"
+	.text
+	.section	.gnu.lto_.inline.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\365\002e\r"
+	.string	"\326\023B;0\247*\215\001\035\325\3659\345\320\271\236]\366c\005\003\240\3321O\260E\005O\347 =\nE!9\n\2605R\360\303\2050J'%5\206\013\264\225\034\301V\266m\220F\244\224)/"
+	.string	"2"
+	.string	"9"
+	.string	"\032\246\326\b\303x\275/n\224\277\267\225\234\357\224\300\363\334rw\027{\213\335\035\275\004\223\370\226N\307\b,\223\025\347\370\311nw4\371\204\225\025 e\260\240\200\207\266\376\371\270\351y\207\204\177E\337\363\303\337\237\314h\235Rz}qjj\235R\357C\331A"
+	.ascii	"c@\003\266\266\372\346\262\3225\211!\r\244\244l\232\002\016\210"
+	.ascii	"\224\262+\217\037\345\310\356\220,\027(W\250\016\200\366\242"
+	.ascii	"\004A]\204<\250H?X\033*\207'O\222\345\257\b\032$\b\220=\227\n"
+	.ascii	"J*\003\227L\034\307\037\274G5\327\274\314O9\0379]\314\177\351"
+	.ascii	"\317ID\b\214\223\024\230#\227\235\306\351jw7\023\332\013\371"
+	.ascii	"\333D\263\025\336\005\001\277\023@\250\301H\005M\211\311\004"
+	.ascii	"\205\005M\261\030`\002)$g=\022\340\223*\002I\031\343\224\023"
+	.ascii	"\314\0043q3\331e.\006\3152\\\361\266\310H\245F\t<\341\223\314"
+	.ascii	"+A\323\024,\226p\022\345\276\252ta\260\353\2272\250\004\3006"
+	.ascii	"\204S\267\212\302\252{ba\263N>\301\260\202\035\240Q\020gW\277"
+	.ascii	"2\276>X\264\374+\353Psv?\351\364\304ug \021P\350]\fc\324%_\314"
+	.ascii	"\b6t\316X\n\242\003\361\366xd\256\".J\037\236\346\245\350\346"
+	.ascii	"\212\367<\266\274\377\f&2R#f\037.\f"
+	.text
+	.section	.gnu.lto_.jmpfuncs.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\267\001\365\007"
+	.string	"\002M+0`k\222\0160\f\303I\220\020'3\f\3030EP\2101\210\252\254\3304@\200\372\323.\007\002\241#+K\354\367i\032\252\371\212|\322\310\336I\006Q\204A(C\233Z\223\240\212h\262\200\246\206A\001I\027\030\251U&e\022v\220\006\223\347\261\200`\341\367\257\006\332L\307\354\231\3437\366\270\224Ra\032\205\2006\323%\226jF\334\226\365\226\205\327\341\303\032\227R&\230\346\206\035\200\337\375X\016\343\277\237\367\336\333\251\225\020\346\334\226a\242\313\317\b6\261}\304\326\241\332t\265\271\327)L@'A\227\350\"\376|l~\005\n\321bF! \300\002\t\210\356\006\2533\340\323\001\333C\303\226j\033\321\032[\302S\376\024\257u`\317\335\225\353\251\334\260dU\327\356\271\231P\220+s\310\"\024\260\366q\002\326\313\344S\b\013j"
+	.ascii	"y\314C`\320\221\236p\346\230F\3337\0358\230\""
+	.text
+	.section	.gnu.lto_.pureconst.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\205\004\001\232\004\002\200\004\003\232\004\005\232\004\007"
+	.ascii	"\232\004\013\230\005\f\230\004\016\230\005\017\230\004\021\232"
+	.ascii	"\004\022\232\004\023\232\004\024\232\004\025\232\004\026\232"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`'\001-\b"
+	.string	"R\n\")\200)I\007;\002@`\244\017LX\206\310\256f`\006f\223 \002\370O\024\353\305\332\376\372\337Z\373\217@>i\215H\231\002\257Tz\240\307\203C\321k\3612\370.1\262\242\273\324\032\020\206\262.\024\001\250\340\363\267\033j\ne\232H\022un\201*g^~\242r\202\201\204b%\307J\036\242\th0\330(O\250R\002\215Q\324\366\033q\n\225r\330w\214c\321\216P\216\3304J\233\363\247\374\312\037i|\271\007\001= \340\002\241\242u8R\032m\320\025\273\307\006l\202\270\227\313\260\246\r\0068\034\272\220p\301\264[2jU\ba\226\0306\335X\205"
+	.ascii	"\007{\271M\303\262\016\007\026\345\353<TVe\"v\356@\222\034\206"
+	.ascii	"\375C$\305\360\305\316H?\006=d\007{-4\006oP\273\034La>\006\344"
+	.ascii	">\302\036T\273\233\347#\354\354d`\357x\271\322\365\037)\232\376"
+	.ascii	"\022.\035f\264\243\340n"
+	.text
+	.section	.gnu.lto_.lto.35137491cbffd6d0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroSamplePeriodUs.12.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"m\013"
+	.string	"\246\026O?@O\223\016S\022\351\031\210p\2016\2319d\377\350\336\035\374\350\226D\256\300GMy\020\331F\220\366\255j\0131t\353f\353bU\004@x\244w\274~\nx'\320\356\333\"m\357-eJ\001="
+	.string	";"
+	.string	">"
+	.string	"ZE\205\206\r\022.vw\262|"
+	.string	"\374s\017"
+	.string	"\377t\303\257;\315\313\207\031>6\016\r\273\233h\030\256\025-s\226\335\275\210g\207&\312\224,\330]'\207v\341~\267\315\300v\002\373\230#\303\307\3779\255.\235\232\276d2\222\302@\213]\013\033\214E\361Jx\260\r\262)\2663\355\207<\004\350Q\343"
+	.string	"vG\333\310n<`\004\322\237\243d\333\377p\020 _.r\b6\001\241\022`Q\001D\224\233\257\251\360\304F\214Pn\317\335\305\324\026\274f\200\210\254\310\362\205m\t\037aI\273\031\306\027\361L\220:\374\371\032\360\357*\340#$\224\233\035\261T\017\373n5T\365\3418;\270P\325\207\243\321d&\253\332P\350T\r&\b\235\314\203ISY\323\245\200\251\b\233j\362PT5Q\342\336\255\216\234\351_0\025\252j\207mUKHE\316\021s\352\241\n\262\370\022"
+	.ascii	"_\321##t\177\b\016f(0\341 *\211\270\341\021.\330\004\346\032"
+	.ascii	"~4\201]5^E&\036\334\005\244\032\214)g\250\323[[\312"
+	.text
+	.section	.gnu.lto_gyroFifoStamp.13.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\233\004\205\037"
+	.string	"\326:\315I\240VRc\204\347\230\200\275P\373\324\212;Ml\026\252>A\266=\324\303\346b\201\365`\251\375\3323\362\216\333Hx\022\361e\333\247\\\372\025\266Ii\351\265t\324\f\351-\\\360\231\247\331\363%n\203ed\357\275\267\224)\005\266"
+	.string	"\244"
+	.string	"\302"
+	.string	"\030\260~\264\212\244,X\001\241B*\320\253\252)\262{\2175/M\301\266=\354E\276\\\242\027G\\\367\336\006\236P\217\337\021t\036@\246\335\353\302J\004\364\245\001\362\325~\324\245\202>\225\342\267{\225\276\270\356=6\260\003\364\245\217\307\231/\321\0030_:\310\206\362#\323M\213r\020\253\250\334{u\026\206\321\223\307\333\254A?\315\222\2645\310?q\016\310\bR4\n\375$\317\242\243\0316#\221\2741#\023\362\256\242j\326X\361\362\304\351\372\202\246(E\343\212\223I\2676#\021i\340\336{\255W#\243\260\326\023\347\336\353Z4\"\335\350m#\331\026\262I\024\001Q\206O\302z\346Z\r`m\236\210\372\"\214eP\254\022Fd\205\354\243\260\332%\3737Lfd\266J6\315Y=#s\254;\346<\376\334{\374\002\236u\303\330j\334\247\376"
+	.ascii	"\347\272o\267\272_\316j\227\263\332f\253[lu\315V\247\264j\026"
+	.ascii	"Z5\215V\215\236\325\247\2556mu\211V\223g\265=\253\253\255~\201"
+	.ascii	"\364)I\r\330\275GgVnX)\204\306\271~\253\037\353\317:i\337\376"
+	.ascii	"\017\277\313)\227\275\266>\240[\007b\247\016\376\207O)`i\320"
+	.ascii	"N_\326_\335\307\265\234f\221\020\213\"\273\367\006\303\247\233"
+	.ascii	"Mm\315\346\266\206N6/mj\337\365\322\254i\212\265WE\212\214\245"
+	.ascii	"]\362\231\216\314\2601\326D\021(U\306\276X#\223vi@\222\024\224"
+	.ascii	"}\317d\261\036\250\234\020U3\323,jYl\375\"&\tq\226f\255\0301"
+	.ascii	"Jx\022&\316\242\366ZG e\t\025\223+\250\031\213\263\2712\342\025"
+	.ascii	"\031\033cg\354\201\234\274!F\246\203huZke\354\313\206-L{\302"
+	.ascii	"\330\322\2326W5|\"m\251\341G8H0\362\200\264\022\232\330\035N"
+	.ascii	"\004(\301\230\255s\257\035\364\336\013a\310\205\035\315XS\n\363"
+	.ascii	"\245\265\264'0\034S\325\346l\214\255bC\247\333jO\2742T\317,\300"
+	.ascii	"\302\330\333\347\210\021\016a\263\353\361|t\276_\257\367\333"
+	.ascii	"\211\341=\230\303\363\343\001w\026v#zz:A[0\207Gg\0074\2039>\301"
+	.ascii	"\335\317\316\207"
+	.string	"\202\360\361x|\273\2363\230\363\363\363\225\244C\330\374\200'@\354\354\350\350\202\300]\t\036\220G\347\343\351\364t;\300\240\316&\201\177=;\240\316\347\367\003\352\322\343\320\255\222+\330\b\033\262B\277X%@.c\367^\bIj\327\272\002\244'8X\f\325\263\323.9\315*i\254uB\326\374f\215nSTH\210\252\331\311{\3575\315\3407Kc\017\325\024e\330\302\305\332\336p0 \002L\367\336\033\033\303\221d\300\215}\331lYQ\212\315\276X\027[n\r\235Z\254\255f[l\256,W\250Q,\344\2202F\231\232`DH\233\202f\f\200\002\031\262\262\016\020\200E\342d8\320]U#\337%\251\352\261\316\371\036 \276\247\334\207\361\313\323\360@\360\270T_q\320R\255#!\355\325\302\216\026\262\254\305f\210h\314\272by\246\273\371U{K+\253(\310'\234!w\226\030\021K?\261\322\001c"
+	.ascii	"\031L\220\003\256f\311M1\033\\c\ns39H\326\263q\306\tjq\335\320"
+	.ascii	"\r\245)D\233\207\343S\361\b\r\033P@\002\337\232%\230\351T\340"
+	.ascii	"\334\265\1778@\331\033\216\t\340$\204\\\354\335\037i\222.P\204"
+	.ascii	"D\334\345\214\027P\361\273\316&\213\370l\371Q\001"
+	.text
+	.section	.gnu.lto_fakeGyroInit.23.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"M\f"
+	.string	"v\327TB \221\222\016\234v8\251-Q"
+	.string	"^9\023\370\317N\223\031\200\267\253iFP=\223\261\227\t\240O\220[\340\177\214\250\260A\372\217\210,\b\001\265\220\2411\002\347\346\002\335*\337\024[\216T\262\267\224)\005A"
+	.string	">"
+	.string	"D"
+	.string	"\004\244?c\266\215o.\313\240\306\312L\216\335\205J\342\330\235&\346_\346\234\250ew\323\207\253\003\031\301\300\021@Sq\037,%\342e\236\035\264\224L"
+	.string	"\016v\327\0315\017\367\273\355\007\266\033\330\207\020\"P\362\306\336\262\324\026\373nw\327*\262\037\363;Mg\246\317\331\260BS\340\306.\313\315\216\225\361b\230\350\330~\332Gq\030\3541\241\017\330\025\275\250\331\335\022x\301\364\347\355\037\322\337\364*a\005\r\225\264\261G\372\037\351j\217\220\344c\252\001\016\232\331o\241\301#\332\326g.L\273\253\200E\t\350\300\214\227\220\364w\325\0204\021\204S?\305U\204\374\027g0\311\307?\337D\372K\027'F\300\004\326u\"\342L\205T#\036\n\021\254\353D\204\242<\020tU%\237k\002\254\360\361\220@\352\002\301\020\020[\026\252\013b\260\254\013v\266\275[\025\031n:F(\232\342\004\244MU\371h\325\354.6\243\032\325\026#x\006\024"
+	.string	"_\2417\023z\3051\260\n\203"
+	.ascii	"73\027\320\373\017\323\374\270\365xJ\212\t}\276`G\305\264Q\201"
+	.ascii	"\024\214\272\204\325\254F\207\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeGyroSet.24.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\t\002\335\020"
+	.string	"\206\335jI\340\262(\035b\007\001\023\350\214Wu\244\264* \233\265\232\016%\337j\365\036DpJ#Z\336\314\005;\324j\021\266\372\030C\0244\3570U\022\233\202\023\3470\016\206\221\206\030P+\016\234,[^y\225\177\263\334c\357\224\002P"
+	.string	"S"
+	.string	"U"
+	.string	"u\227\204\217mwM~0z\r\231\237\366Y<6\376\206\345\002vgb\266]\322d\007\243W\223/\300\275\216>\200{\365h\007\031\350P\372\341A\247\307\356z\364\304\307\317\321?\355"
+	.string	"^0-\237\242\221\335\365|\301\210\270\351m'\260\255\262\347Ik:cs\323\244\317~\321e\177}\316O\177\363\317"
+	.string	"$%v\344\270Q\035\344\202\270\371\330\237\032\003\205\355\373.^C\371\216K?21(v\327\342e\312w,A\006\333\335\356\325N\261\273\327\331\3313\326\fY\027\327\007\b\262\240\021J\036g|\016\313\001\224\332^\360\031,\0024\273\333\300\227\361\236\324\007\316\277@\356\365\264\317\232\027\032\231XLi\222\250_\252J\346_F\340B[\374\362<\253\t\364zi\223\333\302\003@\273\313"
+	.ascii	"\306\312\211_\303\302\275\222\350\313\213\300H\033Z9\2425o6\351"
+	.ascii	"\232\324\204}\220\335\r\276pR\260r\225s8\210\277\023X\222\"A"
+	.ascii	"\205\242\212\205\357Ky+\021\334\240\022+x\030T)\023\357\023W"
+	.ascii	"\336I\304a\006P\3644\204\241\350ud\353\264GP\021bH\250E]\265"
+	.ascii	"\t\257\235\364\"\305\213\215\320Q\234M\3418P\243R\345\241\301"
+	.ascii	"x\210\250\317o\330p\0177[QM\257A\243\342\350\f\0050 \220\002"
+	.ascii	"\2319\263\003Y\334 \205\363==!\340\f3%,u@$\276\272\235'\004\263"
+	.ascii	"\004l\177\347\254\005\002\246C5\\\222\235\214\253\300a5\033\031"
+	.ascii	"\326\214\345\210\205[\2229\202Y\031\215`\250\240\305\030'\241"
+	.ascii	"\372(\377\t=\3301\002!\006)7\034\0030\032\307;6\354\300\224\022"
+	.ascii	">\200a\t!`\306\340\025igJ\340\341E\333\311"
+	.text
+	.section	.gnu.lto_fakeGyroRead.25.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\032\003\225\024"
+	.string	"f\343~I\260\324Q:`\357\350#\232\252\343\023\245BP-\317\327\017\2166\244\236\362M\265\252\212\217\tw\246\026\0301\330\336\360e?\344\364\335A\210\376B\2639b\353g\n\267\364G.\210q\326\370\233n\365\333\253\344\247d\023)S\ng"
+	.string	"d"
+	.string	"n"
+	.string	"V\265O\364\242\235\033\351<e\316\240_\2169\307\0267X]z\274Jx\271\272\200\360\322\266\021$\330\261\354\243\320O"
+	.ascii	"Z\211\0163\244\346\034\305Uq\331%\270*\363y.a4\371\300"
+	.string	"\205R\002zJ\272\215\370\202,\270&\021\254[\rT\351\001\031\371\321\365\303\215\246\n\340e\316i\265\335@\334\341mK\260\355\262\027BI0\002\2779\247\202\0326\032\374\025:\341%\312^w\335\221\373yJ\"1\323*{\244\351\246\260\017\316\r\262C5\312\215\376\225\325R\252A\251^\251~\312\202\023RP+Os\376TQM'\311sa\373>\215\353pz\242p\354\334J\017\325c\034)\347\243\245\217\023\216h\316\311\312\261Y\227k\357\330,;7lHfZu\340L0\f|\245/\305\3302-\275\255\025^\352>\360y\201+\342}w\336\311\217\205\217\020\216(j\246U\252CI\017\005\230s=\367\bIBL\035\251-\317[\330pNkY\370\245 \243HM\227\330~\035\207l\265\232s~\177t5\321#\205+2:Q\224\365u34z\233\013\324\226\307\327\335\306\215\336v\235k\036\306\340b"
+	.string	"\264\313\345E\323\262 \003\213\345\\p\271Z\342M\354\305a&VA\264\231i\325\210\256\330\215\350\302bX\206WL\334"
+	.ascii	"\203\305D\3268;87\310\241oH\267\003\177t\007>!\335n\277\273\\"
+	.ascii	"\017\266\345\372e\2664\211\204\004.\221!\357\335'D\357\245\320"
+	.ascii	"\244\307ch7\b\220\2267\375\3305\3511M\361t}\300\f\370y\302{\304"
+	.ascii	"\2546A\250Q<\347\234afFd\024\024\024D\031\016\200\002\231\271"
+	.ascii	"\253\007\021\320\251R3V\211\375\357\006S\n4\r}\377\243\366\275"
+	.ascii	"\317\033h\331\323(r\236Y\036&\312\371\316\241\017O3\231+\225"
+	.ascii	"\366\211\315\025%\250\315\334oT\227'\tR\352\017j\200-M\200j\345"
+	.ascii	"9\260\366\270=\357\260$^\256\330-\370\232!9\3217\320\002\030"
+	.ascii	"g{q\267\201R,\200\270\037VzMN/\362\327\266\354S\205\310\313f"
+	.ascii	"c>\350Y/\002N\316;;TsO\232K\321w\324"
+	.text
+	.section	.gnu.lto_fakeGyroFifoPush.26.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`O\003\245\027"
+	.string	"Vj\224I\240TRc\024\372\236HX\243i\347\374\035\217G\303\244\256\254\335\312\212#\216,\025n\022\276\205>\265\2772\"\025IQ\252"
+	.string	"2R\036\351&a\345\270\036\254'\275\264`\307\t\310h=\311L;\203\376\250\032![n)S\ny"
+	.string	"y"
+	.string	"\202"
+	.ascii	"6{K\210\246\334 0\251\201\326\221\030\332\255\353\371\024\277"
+	.ascii	"c\t\331\336\313\024v\274\367\276\230\001\3556\205\236\332\257"
+	.ascii	"\272\325\357WC\017poS\361x\357\371b\005\264[\237\027P\336\322"
+	.ascii	"~+o\375\263\203\374$q\237Uu\244b\354\336\213\253#\376;Y\351\317"
+	.ascii	"\237\305\324L!\321I\021\257'\302 \311r\357=\327\251\007!\220"
+	.ascii	"\322Y\314\275\327\324\024\206\270\355m;\260"
+	.string	"\315cW\244\306\273H\235Q(\212JE\264\314>\201\264:\331'om\262i\324\267o\375(\327\372M\216\365\333\376u\227\374\352\257\315\250\313\031\265\255\324\344\214\272\316\250\351\214\372\003\026@\215\r! \344\336\017eH\356\r\013V\342_\267\337\345\037\277|\277F jf\226\227\330\275\347\201[\313\320V\334\350\363.\233\214\021\207>\266\315\353E\240w\331&\205\021\253\356\275\266[\033\310\266\335\326*\266\177~C\202\201\0045nc\002\005\032\232\362\266\244R\030\246\222\255d\355(\311\312U\312Zm5=Z\242\365\265\326\033\021\201\264lF\005Z\177<\0315D\007\331\022\275\367\022\325\352\344\225\327\224\257\026\262h\004\251\021\3731.\243\306\177\262M\216\336\314\225\267\257TILD\253\245\023z\253\276qwCo\232%X\211|\343_\360h\230y\243q\356\"\247@\330\275\027\001\230\316\216\3774T\336\336\352\003\316"
+	.ascii	"\323\262\323\341\331\311\371\312\016\017:\207\223\326\301\354"
+	.ascii	"rr\030lx\275\240\033\235.\207\363\365v?8\275\013\270\r8\271\035"
+	.ascii	"\234\256\347\303\301\270\230\307\263\353\341zx\274\036\316v\026"
+	.ascii	"\235\274\265\351\\\227\241\202\"\023+\252\300\342\203\027_\302"
+	.ascii	"\342\004\022\020\261\317\2246\204\377\230\241\0018\327[Z\374"
+	.ascii	"\220*B\226\325\307M\"/k\317P\210\021\021\245\372=H\036S&\325"
+	.ascii	"\337A\311\206\266\352\347\320 \204\362\344\373\312[kb\307\324"
+	.ascii	"\3608\"\004G\250A,\346\020b\206\241\031\n\022%j\213\001\200\002"
+	.ascii	"\031*:\017\021\300\275D\305 i\377\317\300s$v\037\246q\244\264"
+	.ascii	"\315\327\302,\322\232pR\233NP5w\273E\002r\345\343\230s1\305\320"
+	.ascii	"\031A0\270\206\\\244{\2038\r\262vO73\035\025\213\361\242\321"
+	.ascii	"#~\354\006?\252=e\001\007\2641Z\021\364\241\262\234;\273\341"
+	.ascii	"C\203\274A\216\216K.\202\221\b\3617\r+Y\215\254\226,\317\273"
+	.ascii	"\262\320\335!<\270\021\337\034\335'\257\274\312M0\n\033pH\332"
+	.ascii	"Z\201\236\035+r\337\300\247\006"
+	.text
+	.section	.gnu.lto_fakeGyroReadFifo.27.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`+\b\305("
+	.string	"jE4\017B`\252M\007|\330\366\300@\243\030\251\340\274\351\0014\233\216\302\227\312\201\203\2317n\235\322R\243}-\321\263\213M\254\270\216\030>d\250YWP\245\307\n\336\177n\301\363`(\250\t\331[\356\235RJ\001\337"
+	.string	"\322"
+	.string	"\343"
+	.string	"\276"
+	.ascii	"x\216Q\254\330y?\353\325Z6\272x\3164/m\326\314\275r\237\231\361"
+	.ascii	"0/\327z\225\3448\276!\037\364\311\033\3224\255\364\321+\233("
+	.ascii	"\364\346\203\271\214\200\226W\237i2 \275\362\311\004\354\210"
+	.ascii	"\274\367\356\2000\357\3724\231\2050\357\230\331\235\271\221-"
+	.ascii	"&\244\307\202\264\322\275^r\332\334\273Bq\206\264O^\233\311\366"
+	.ascii	"\231\366\222\355SB\005!\254\366\212E\013\035\262\021\223o\367"
+	.ascii	"\256\277\277\302\326"
+	.string	"\325\316\245\250=\315w\225\333h\3259\007\215\220a\351\3168\304Q\363\311\224k\255'\t\227\251A\f,\013\321\355\227\255>\377\213\333\320\317\231q\253\315\rG8\310EU\2248\3517'\fy\213\3223^\231<8\"\2376\323\236e\034\272\243\034\356\275\354E\243\222f]33\027f\246\301\234\346\002\275\006Db>\321qP\244\274.Zb\216\310DB_Z\320CG\213Y\246\242\313Z\307\006\214\2211\206\256\336\352\b\021\326\221o\240\355w\201\006\320\225\3031\267\233N\003rs\341\025,\274\213,l\237\375m\246\275\214\326\224\243\030W\222?=\267Rj\312\273\310\b\256\336\212[\331ljx\027[\311T\275&\306\201?\367^\013jB\314\340\346\022\304\366\371\364\255\354'\260\365\313\332\331\226\320\227\314\353\320\377\253L-\017\031~/f\235\363S\2335\037\350\261\356\002\354< u\026\220:7\245\316L\250s"
+	.string	"\324y\311:\003\3109+\241\316I\326\031\311:\367\254\363\221u\346\241\316;\324Yg\235s\251s\232:\243\251\263E\235O\353l\242\316o\235\335:w.d\200\364P\200\306\204\276\354=\202\310\314\320\3367\034\232@W\016\347\267\227\340\214[\230y\357\275\366\350\343z\331@\333\373\243wB\204u\344=\243\335\363\376\325\210qN\315jV\367\273\267lD.\b\375\257\373Fv\025\312\375\033\320\255\213m\335@\213\364\271\017v\335\301:\016}\311\351\033\352D\210\332\016y\263\232%d\246k(T\017\022\024\b\220\037G\277\ru\241e=\261\317\314\020\272\217*\346c\346\035\315'\312"
+	.ascii	"\026\325L\357\351\300\244\247g\223\305"
+	.string	"6<\036>\244\334<l\237\366\321d\326\023\244?\277\237t)\211qm\007\204\002f\376\321lQ>\ft\272\216\b\346\021$\274\213$l\237\007\376\223\305-\377\377&\306\t}9\247\204\177\237\365\0037n\213\270\204\276|3)^q\316\377z\323\314&\002,\303\267\200\312F\216\033R:\254\311S>\252\032R0ZT\005\201\304\230\232\222\372\351\bR\365\230\021|\361\3031C\352\306o*\250\343\347{\342\252\034T\301\337\216\252\252\340o\267\n\373\275\330\366\321R\242\245\335\252\335\023H\211\366\334\252\035\360Y\314<\340\231\203\360\207`\271\377bG\243\206\204\210h\226\333\2005?\213\214L\300S\231\342G)Q\240\b\370\bU\322\2045\275\023.(\337j\302d\t\n\247\246\217P%\271(\215\351\215\252X\323\037\325\213'\211\342\375\232b\233#Q\305:\231\302\217D\371\334H\007\006YNL\337\311,i\276^\372"
+	.string	"\217*\002\360K\337E\200\027\210P"
+	.ascii	"\360Gm\311\260\261\006\236\364J_\340\231\3250\352\030\254\267"
+	.ascii	"b\005\316\254\206\251e\274\213J\217`\370Vl~\322\353\260(\211"
+	.ascii	"q[\322\377b\224\215M\370\020\b\025\200\243\250\2018\246\224R"
+	.ascii	"ffDF\222$\3110\006\240\002\221\251\252y\021`-3\316\310\2141\217"
+	.ascii	"z\024:Z\"H\241\177\366S\033W\325\351\211\353\323\314\243X\304"
+	.ascii	"\\\200\341f\201\355#zK\230L\323C\3241\321,UDU\006O\254d>\237"
+	.ascii	"\242\223\366\351\231\273c\235\326n\317\346t\257\376%\304B\004"
+	.ascii	"\n\020\376\276\025k\230\306\204\264\363c\361\355}\2364N\f\007"
+	.ascii	"\303?\317/E\\\205\301\202^\366\323Q?\223\336\233O\211\035\333"
+	.ascii	"\201b{Ek\232\231v\016\253\242]h\243],(e\221AB\377\t\360\202\372"
+	.ascii	"\202\207P\207\017\271\210F\006i1\032>X\331\222\370\210\322\363"
+	.ascii	"\016tz\272y\212\305\"tv\350\226t?\347\2358.$U\337\320\212{@\265"
+	.ascii	"\245\226s\327B*\360\331\362\375\3208\314R3\001\230\033\204^V"
+	.ascii	"\353\273\255\343\207V`\214s)\\\366L\233z(5N\240#@\223\341\225"
+	.ascii	"\377[\b\211.$\215\202RA\3531\236\362\036\210M\203\226\232b\016"
+	.ascii	"\033\267\243\033\225q\365x\200\013\005d*\270\244Y\232-\217\243"
+	.ascii	"s\271\255D\216\322\207\032\344u\302\332\265\216\323\353\216h"
+	.ascii	"8:f\340\252\220\245\242\016\252\001"
+	.text
+	.section	.gnu.lto_fakeGyroUseFifo.28.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"\245\013"
+	.string	"\026\026P=\0203T:\230\225\277/\363LH@\377\260\240!\303\023\240\201\305?33)\254\326\325\2425\214\305\264U\352a\217\f\002\311\"P\2005\027\242y\340w\f\"\204%\206|\267\277\311\3362\245:"
+	.string	">"
+	.string	"@"
+	.string	"/ \177\271\263w\374S\261O\235\030\221b\355\356\204\246w\217P;?R\001\020\362:\217\243\303\001\336'&\330\335\303\270\212<\220j\244\262\273\326\220W\342\276n{\202m\t\366g\217\377~\215\352\313\n+V\017\0058vI\264\206\354\352\252\341\302\366'\266\241\332\r\034t\3776\b\016DuRE\270\332?\375Ew\024\347\004vI2f\354~\f\fA\362\313\337\r\310_\222\321\306*\b\017\017\374\370\320\306<\245\221\354\356\003?F&D\200\034-8\362\327\201\025&<\332\212\021\226Tw\267\003\275\221\n%\rS\n\0377t\200T\210\375u\024\226\354\307\335]C\222}\324\003\032\207\013\330E\223\321\031E\333\200e\260\260q\"4d\03161\234\226\261p\030\346\305\202u\230\031\207\231\224\005\336<h\334\004\261m\334\234|{H\262B_#\005\260Po\037(\214~\2408\355z\036:\024\005\023"
+	.ascii	"8\303\371\n=\246\001\347\305\270\242\b\267\330\270\036\023\274"
+	.ascii	"TE\212\212\202\032\227\023B\030\327\330\2460\027\234\bPV\200"
+	.ascii	"k\004`XT\271\355*z"
+	.text
+	.section	.gnu.lto_fakeGyroReadTemperature.29.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\005\b"
+	.string	"2\21777Po\322\001#n\203h\211\202\375Q\371I\003\241\264\021k\2122l\017~X\004\321G%v\231\362\334\310&\006\224g\324\241"
+	.string	".\216\315(\334\202\202\022\333\b!{\247\024R\223\016\223^h\222N\320gj\001\225\261\316\254\220\023\021\031\025Q`\230\214!:1<T\"Zx\344'b4\024;\034g\240I\243\226e4\272\356\253\205\235\317]\005\032p\303\256\243\007C\354W\273\273\206\235\375 P)\030\216\312.i&f]\254\225\021\333\233\r`\033V\221\f\303{\366I^\262\335$\343\002\273]\013j\267\"xas\313\365\004\327\255\315\007\256[\266\235\240\260\231{5\2214\034\246\016\224\324n\215P\344\334\037\347\377\344\006'\026\220\227\224\322\350O\323\260\273~\036\245\217\033\336\366\201\355\007\333\247\f"
+	.string	"8\303\361\212\036\025Ql&FV\301\3235ob\002\007\205\34020\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_fakeGyroDetect.30.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"-\013"
+	.string	"\266\024NA O\225\016\240\252\300 \313\016\267\252U\034\276)\314N\340?j\riQ\007\027\310\275\307\327\021\204qu\177\306\364,\266l'HZ \002!\032\"L\214X\243:Fb3\212#\266\325\0327\";\2458"
+	.string	"8"
+	.string	"A"
+	.string	"\343;\266S\3119\266S\333&P\340\343\360\343ItS*\003\213\334\0359\315\303\303\317\320\377\352\024\0200\030\261\326\b\364\031Q\260\273\236\241\021\351\326n\033\200m\004\366/\001\263\264G\320\324L\366!\273\273\326J\366U\377\2140\340@\312\020`bWT\316\330\027U\221\262\375\261'\266\347\264\037\342\">Wy\276\261[Z\245\330\035\007\370\200\344\324\001$\206]\221b[\216\302.JrA\222\235\367!\373~\002SQ/2\232\315Y\340\002\324\212P\004\216\307iW|\310\236p\022\025$\273k\300\037a\241\243!\373p\352{\266S\332\241E\211XK\203\030`\355` \366*\237\246k`\001k\007\343y\035\307\251\037\205L\275p\0172\335\206\363*\207\253\0040\b\341\253\234\004\020\254\334d\334\333\177\2709`\261a\026C\324.\330\256\317^\260]'(\313\021"
+	.ascii	"_\241'3 \f\033\267\020\243\346\002 \037\270\031d\004\244\001"
+	.ascii	"2\006\005y*\221\257\31682A\3045\032\262C\304\3275\237"
+	.text
+	.section	.gnu.lto_fakeAccInit.33.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"m\f"
+	.string	"\246\327UB\020\221\232\0168\221Pnz\236\346\fxW\2440\243D\r@2\324\350\\~\177\254nWpG\342\177#\355\233\320`^}D\372=!\002"
+	.string	"\020T\261H:\204\273/\205"
+	.string	"\002d\2100\320'{K\231RB"
+	.string	"?"
+	.string	"F"
+	.string	"\003\244Ck\266\215w\241\365"
+	.string	"\301\350@c\263\273\224\216\270\366\247\251\371\237\371G\344\266\277\t\304\365\215\210\\\344"
+	.string	"\300\261<\221\226\022\3613O\017\334J\246\007\203\335uF\356\303\ro\273\201\355\005\366\035\004!Trdw[*\310\376\333\335\265~\354\313\374O\323\231\351\177<\200\261\271A2c\267e\264ce\300\027&@l?\355\237x\214v\031\317\005\354~Z\324\354v$V0\035\272\273\210t8=\032AE\r\226\274qH\372\034\351j\233\234\344c*\001\016\272\331g\261!\204F\264\261\323\\\230v7\301\n\224N\201\320\213G:\274\" 1\212.O}\024O\341\361_\234!%\037\017\375\024\351\320\200\013\016\0211\001\226U\251\255\222\313\244\232"
+	.string	"\001\3134P\260\254\212\352d\027\n'\223@U\340T'\224\225u\250\222\021c\026\256\214\302\200a\031\005\322\355\337\352\307/\006\214\016\221\212\256\274"
+	.string	"i[W>Zu{\350FT\243\n\362\201g\024"
+	.ascii	"_\2417\023\232\3051\262\n\206\02073\027\320\373\017\323\034\270"
+	.ascii	"-<\227\306\354\213\276\025G\255\267Q\353\031`\271X\333\254\246"
+	.ascii	"\210\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeAccSet.34.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\f\002\275\020"
+	.string	"\006\035iH\320TQ:\323\306\007r\2416aPD\020\371W\001\271\317e\321q\026\303\335\273\211;z\207\351\303\026\335=6J\323\330c>\026:\233AH\002\233`V\243\324G\020\210\024\203\314e\002"
+	.string	"d?\230\021\303\324,[\354\235RN"
+	.string	"Q"
+	.string	"V"
+	.ascii	"\264\335-Y\302\350u\300\374\264\017\3436\343o\\N`w\346\005m\227"
+	.ascii	",9\302\350\325\344\017l"
+	.string	"\257\243\027\330^=\332>'_\373\234\"$r~v\267\243*>~\216\376e\017\300\212y\371\024Q\330]OV\314\211\233\3366\003\333'\366T\005\273k:co\323\244\353\374\242\343\374\365\261\237\376\346\237\002\022\310\270Z4>T\b\271&\206\202\026H\275\261\302\366}\032\237\251\276c\004A\256\226\312\346d\274T\371\216/ \341^m\025\233{\235\234\255#T\001\207\310\004J>\306\370X\213\353\256LO5\226\304\005\245\266\035<G\213\001\b>\216\363x\0378\317\002\267\327\313>a)\202\270lZ%\223D\375\022\2052\317\362\202\021\364\305/o#5\207\260^:\345\264P\301kw\037\324`\371\340\303\\\266W\022}y\223\232\032\213\026%\212\325\034\262I\230Ii\354\003\330>15`\371\312E\374\373<\352\317\004\242x\033N\241\270\302\341\373\274.%\202!P\242\206\256\003\312K\351>1\325\231L\034z"
+	.string	"\305\016D\030\212\035G\256.\273\005#\013T[Q\230\031\206\317N\232\341\243DM\355\247\315\316\360\037\247Q\311\013&\364sDDw\274\007\017\363l@\265t\035=\0012 \220\002\0319\273\003\261\270\360\031\"Rh<\302\224"
+	.ascii	"\324\001\221\370Z;\317\013f\t\260\365!\020c\231\013\325\232I"
+	.ascii	"\326eH\005\006\254\331\324.a\004\207!\334\222d\n\252\030\214"
+	.ascii	"\365h\204B\005U\214u\031\252F\t\210\320\204\037#\022b\230r#1"
+	.ascii	"\200QvE\342|\007s\f\306 \310#f\340\221\304qa\307\350\212\264"
+	.ascii	"5\005\360\345E\333\311"
+	.text
+	.section	.gnu.lto_fakeAccRead.35.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\031\003u\024"
+	.string	"\006d\200I\260\324Q:\340\217\240\204\005\321X\207O\212\201;\021\231Eq1\207\305\017E\277;\351\243\177\332\t\243#Whj\370\262\037\366\332\217%N\377R\270p\240\360\255\354f\266q,\333\2743\377\205\351\r\177\313\0022\310&R\246\024h"
+	.string	"e"
+	.string	"n"
+	.ascii	"\266U\355\007]H\347C9?\231\363\2077c\316\235\212\027\210\227"
+	.ascii	"\336\035%\274\024\037 \274\264m\004\tt,\373Ng#\351\251\365\274"
+	.ascii	"\240\232s\307\332\022\227]\202\2532\177\3472\005\222\017\270"
+	.ascii	"R\243\023\024\357\026\342\013\246\344\224@\254n4\020\245\311"
+	.ascii	"'\352DW\0167\036U\222\2269\247\265v\363p\207\267\r\301v\214\275"
+	.ascii	"\016\002"
+	.string	"\037Ms\036\214\200n\316\251 F\315\005\037('\2744\331\217W_\020\233\r\236\210\231\376\354\035\217.\t\373\340\334\037;T\233|\350\027\255\226R\rJ\365J\365O2t\240\032\302\2624\247\355W5\231\244\357\204\355\3730>\336\240\270\261\215\006\340V\274\305\213p\276\263\304U\345\202\346\234+\034{u\271\266\216\275\n5\"3\375\035x\r\027q\316\311\342#=\351\305\206i\351k\255\360R\267\001.*'\344{\357\276\022\035\020\256G.\250\310L\177Jc\252i\004h\344\272\321\037\350\220\232\022B\333\235\233\250\345\230\326\262\360\033\343\002\bM\217\330~\375H&\212@\227\337\023]q8\0259\241\241\0225Y\177\224\231\321\327\\\200\266;\376x\0316\372c\316\371Z\256\260b\300\345j\255]+\257\231\326\004\030X\f\207\202\313\325b\331\304^\032db\022X52-\032\226+f\303ZI1\314\302+\306\302"
+	.string	"\203\305X\253\335\354\340\334\037\207P\272\261\007\236\350\f\240lco\337\273\334\r\266\345\272e\266<\262\250\b\\\037Oo\272\023\017\275\223\302K\320\310\356\322\016\225+\345\330\005\360\341\210\205O\027\207\213"
+	.string	"\235#\374\306\213\250O\001> \220\002\031\301\243\007R\334\377L/JB\3573\020\3202\f\032m\311\\2\313s7\332\2203\356\260A\302\327Lx\214}K\233_\311\270\214\001\276\037b*\fO\013\221\272\365\240\001`\023c\"\257\354[\264mj\354l]\370\210/\036b\327Yj\031"
+	.ascii	"\023\2134_)\213\305\345,bQX\303\261\023V\007\215\351\332`\216"
+	.ascii	"Y\341O\264e\007.\"\037\362\275\273=\347;\311\330\026!\214\347"
+	.ascii	"\374\341\f\025\347\306IO(j\005\024"
+	.text
+	.section	.gnu.lto_fakeAccDetect.36.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\375\t"
+	.string	"f\023G; \261\322\001\244F\301\261FN\221\351`\204\177\234d(W]B\343\013\360\215\321]\376#\214\273V\275x\030ti&\t"
+	.string	"\022 "
+	.string	"f\207|\nBT\004t\233(\333\341Fd\247\0244"
+	.string	"2"
+	.string	":"
+	.string	"\025t\202\357\325\266\025\026V6\177\316^\227\231x\330t\273'\350\311n\236\232\376Y^\220RC\202\273\301X\247"
+	.string	"\020\273k\352\202\205\334\336m\037\330~\260o\020\273k/f\277\366\323\017\005\242\313q\300\355\276v=kSePl\337\366\312\016\260M\251\375\225\323V\257\251>\260\033\243\305\354\236\tn"
+	.string	"\275\372|\350{\036\0173\252:4\272\035R\311t\033\031\241\222sa\234B7\273\255\273l\215\273\240@\273\313\340\267p\244\004f'\257\276\352{\255\"3/\270\333H\213\356\354\223E\275\022\373\237\r\242\030z\026Ec)\244\220 \313\324H\024C\360T\216\033\244r\002\264 \205&P,O\240\b\301\344\305X\202\031$Y\202>\367\237\365b\276\371U\344>xpZ^\207\375\321\347\f"
+	.ascii	"^\321\033[\024\204\305\2004A\003\251\301\305\240 O%\362\325\031"
+	.ascii	"G&\210\336e\342\353\232O"
+	.text
+	.section	.gnu.lto_fakeGyroInit.part.0.51.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\255\n"
+	.string	"&\023F< \005)\035\300O\372Rm,"
+	.string	"K(:6b\001\240\277\274X\0368\344\300\364\216\032\266u\007\3767\006~]#H*$!\004\263(R0\347\3501\217\205kA\2219\354&{\247\0242"
+	.string	"2"
+	.string	"7"
+	.string	"\266S)\026\355\235\2170+\241s\022\353\331\335\356t\276\\\374\224\232\350\037v\201\025K\3659\300R\271\f]\013\240\330]o+7\275\355\007\333\026\366C\001\177\335\376L\312\207\031d\373\257\324G\024\247ba8\265\224\366i^#~D\275`\267u\203\263;:\234:b;\365\370\203\317\351v\203\317)\350\3642\001\024\200ld\222\314\351\262\275I\337\346\303nx\254d\210S\220\315dB\341\324\0269\311\257\f\362\310J\246JN\227\247vmg\313\236rF\320\262\213\022`\266.4'&N\250a\255 G\372\302\r\216\003M\036X+\0204\177\"\220\344e\\\204\365\244\361}^W\252`\310\250bt\035#\217\243\373j\251\023-8\364"
+	.string	"kg\n\303\332\311k;[\016\030"
+	.ascii	"/\301q\206\343\025\275\212\005\321X\201q\301hEi\236\301\001\242"
+	.ascii	"`\230+\234\253\tQ\027\325\347A`\342=\255\024\325N\347\2026]t"
+	.ascii	".0N\\\314;-M?\241\214\001"
+	.text
+	.section	.gnu.lto_fakeAccInit.part.0.52.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\365\n"
+	.string	"\246\223IB \347(\035\220\b\"2\310\350\027\001\270\001\361f\266\246{\002\210\021\350\312,"
+	.string	"\240OoPc4l\353\302\372MCcO\004\271a\202$\004\344Q\207q\341\034\300AB\203\005\2054\224\315n\262wJ\0014"
+	.string	"4"
+	.string	":"
+	.string	"\003l\237h\f\332\016\036\006X\017\213\201\314\353\301\356r\237\022\300\301\313\230\201\376]OH\251P\227\n\252\232G\207g\036\217\335\265fs\317\333\326\260\035b\037\"S\201\200\267n\237\300\311w\371c\373\255\323C\323\206\272\271\370t\214\366\013\334"
+	.string	"\370\320\364\206\335\025\f\301n\230\361i\016\355\323\341#:\237\332\037:\237\237\317\007+W\006Y\020s\221/R\262lk\321?\240bc\3745\362\306\347\212\026\323Q\361i\267\224\342S^\200%\210\301HT\224,\313\354\331\312\225-)\0320\340\354\316D\200\2609\001\236\250_\255\336&\242\237\311Fi\267y\244\316\253\037\022\224v\322\024\344\211:\022\221\257\226J(\355\270Q\365XBu\204C\tu'\034\255#\016d\341/\305\253\034\351\373*\027\237\005\026"
+	.ascii	"^\321\263X\020\216\025\030\027\314V\224\3003<@\024\fs\205\203"
+	.ascii	"5!\352\242\372<\bL\274\247\225\242\332\351\\\320\246\313\316"
+	.ascii	"\005\200\223\027\363NK\323O(c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`W\002}\013"
+	.string	"\204\017S\003"
+	.string	""
+	.string	""
+	.string	"\002\f\177*\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\006\r\177+\360\372\2508\035\177,\270\320\031\177-\005\022.\300\204\001"
+	.string	""
+	.string	"\003\002#\177/\0370\033\1771\267\341\325\304"
+	.string	"\0262\005\0253\005\0244\0023\1775 \027\1776\005\0237\301"
+	.string	"\0024\1778!\1779 :\030\177;\272\220\202\002\032\177<\034\177=\036\177>\"\177?$\177@\001&\177A\377\037"
+	.string	""
+	.string	"\200\220\200\001%\177B'\177C)\177D(\177E\003\001"
+	.string	"\"\003\003\030D\003\003\027\340\236\212\256\001\001\244\001\003\003\027\241\341\365\321\002\001\244\007\003\005\005\005\007\030D\003\007\027\215\206\363\r\007\031\253\333\3426\001\344\017\003\007\001\202\022\003\007\027\304\026\003\013\032$\003\f\033d\003\f\013\320\360\372\250\001\001\242\001\003\016\017\017\016\021\030D\003\021\027\344\001\003\022\022\204\n\003\025\025\344\001"
+	.string	"8 \360\002\231\242\316\001\262XH\371\242B\016\302\300\n\266\260\"\212j\006\251\037\035\247\213N\202]<B\2146\243-\032S\206\212L\016\362\032\352\001\034\004\207;\020\313^\n,\005C\366\320\356\347~\216\3377ay\003; \317\230a\325\001\n\003\243\323\322\007\222\255"
+	.ascii	"\355M\304-y\205\r\017!\306\220\214\321\200{\336\f3\251\177W\203"
+	.ascii	"\tlw\f\276\033\332:N"
+	.text
+	.section	.gnu.lto_.refs.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375 \223\035\003"
+	.string	"2\210\025\030\240'\351\377\377\377\377? +m\366\377\277\277\355f\t!\204l)e\n\317\302\2070\341\305\3542\273f\210^r\226\357\340\241\363\320\260\005\250\024\352R\273j\267F\350\033\f\331\013\354\330\n\364\t\264\223\264\023\200\237\364E\206\371d\376\230K7\352S\375\251\333\177\021\003"
+	.ascii	"`\210\271j\340\016\212\023"
+	.text
+	.section	.gnu.lto_.decls.35137491cbffd6d0,"e",@progbits
+	.string	"(\265/\375`\3738\005\356"
+	.string	"\212j\225PX0\nQ:\035\225\322\360\222\363\320\377\016\335g\004\"F\251\324\372r\264\242\216\316\315Cd\236\3078\b\370\036\252n$\030\246\025`]|`\323X\2656\310\354x\236\273\273\211\030aYV\254\215\215\002@QU%h\304s\255Z6\300\204\255iI+\256\237d{K\231d\nr\004\375\004\b\005A\364'\231qQF%\005\311\213\301\024\035\301\245\351\320H\374\006M\261p\273\241\253\374\021\307\313>\232\030m}v\365H\273:\244]\005\372\372\255o/\\\230\t'x\320\275\267\327\203\335\347\177}\327\327\205;r"
+	.ascii	"\223<h0\212\312\271\245fW\225:\017\3419\362\366D\236k\317\314"
+	.ascii	"\340\335P\253\312\242=\205jO\357\264\177\326}\276\363\257\374"
+	.ascii	"{\274\017\327\320\356\235\304\371U?\204\003\323'\204\244\276"
+	.ascii	"\2535b\203w>\325\265\013*\333-\024\023%\205\227\246\301\203\207"
+	.ascii	"\027'%Dz\250\331\323.\355\376C\374\2550\222\317\030\2276e;\202"
+	.ascii	"\002\365\331_\310K\271\357\275c\246\374l\274,\355i\020\355)\017"
+	.ascii	"\355\251\222\366T\306\003\2419\302\304u\365\003\225.3\250\026"
+	.ascii	"\374\364\325\020\325\236\363\264\303e)\332\241\267F}\245\307"
+	.ascii	"\3612f\\Z\030}~\033\177\343>]\355\223\200<\355\006\343\301\246"
+	.ascii	"\344\361D\257xq5\325s\022}\367\255Q\037\311\375g\374\320\033"
+	.ascii	"\335\027\242\264.%]Z\2755\352\307x\031\367\271\341\213\256\225"
+	.ascii	"\035\314!,\035\202\275\357\006\365\376\375\335\r\252g(\035\342"
+	.ascii	"fP\2054\320\304\270q\304\347\263\347#\355\0320\277\005\356jj"
+	.ascii	"$O@\240{\267\376A\367\371@\337\023v\307\334E<\320\373\374\213"
+	.ascii	" O\273\207\202OQ8\264\242{\267\0364x\230A\022\335b\244f\027\377"
+	.ascii	"C\363\002\252\307\007\023\027e\332q\326\263x\242\"=\200<\017"
+	.ascii	"~\322\216e\350\333\2745~\367\357\316\361\365\271\370\354\230"
+	.ascii	"\205\337\226\273\245%[\"W\245\357\343\264?\233\276|\177\367n"
+	.ascii	"\026\277|\027\213\f\317\345\313{/\357\255 xo\005\251\032\324"
+	.ascii	"\362K\315\376g\332\377K{\230\225\366o\322\336\3661\364]6z\313"
+	.ascii	"\001\344\263\377\013\355\267\213\366\272(W"
+	.string	"\312}Np\353|\304\006\216\225^[k\306\017\313o\313\236\366;\201z\377\356\004\252_7}\225\2407\203z\343h\340\200\254\221%\321\327\311}r\237M\356\230g/\245\r\266w;\203\227Foe\035T\232\333A\365KD\347[\2432\321p\253X\020\251\362\241\333\356\363.\271J<\267\256\201\273\210%\027\355\262\341\256\346\336MS#\230\322~\220\242{o\r\036n\r7\346\223\314\346~\313\256\331]\003\232\331\021\t\371\354~\323\256\332\345\362\262W\332\233g\357-\301?\321K\212~\226\371\022\3417\255Fm\036\265\233\006\233\255\265\340\362\331\357R{Q\373\252_\351fP-\220\2725*\005\027\320\327\310=r\237\027\\$~\277.\230\247\313v\267{\2674\357\243\313\363\353\263G@\373\rs\002,\367\006\216A\373\275@\305\177\177\367\002\325_[\270\031\3247\273\031\324\264m\2735\3525\203\273\031T\347\325\272"
+	.ascii	"\373\300P\332a{\267\0274\017\232\230\326goo\006U\337\032\265"
+	.ascii	"\304\236\373\377X\222\347\334?\002\367\013\324\346\3761l\356"
+	.ascii	"\017\200\240{\n\2236\3441l`\315\375\323TP\3624z\356W\356\314"
+	.ascii	"\375\212\235\241"
+	.string	"\271\247\033D\310\356\031G\231\373\205s\240{\232\341C s\177\035c_\356\227\303/]\260&\300=\023\201\022\223\210qp\001\270\2471\3567\212k\210\300=?\335\265WB\362O\367?\3425\356\351\213\373\353\024q\177,0\367k\346~\203\374\227[p\317O\334\257\021\367\333\272_0w/\342~\235\270\337\347w\340\305\301\335/p\377.\367\327r\177\247gp\317E\3567\356\001\356\256\335s\226\373C\271\377\223\373;\271\377\222\373\027\271\177\f\367\207\341\376?\356\317\302\375\231\356\017\002\367_\341\376+\270?\322\375\215\356\357\001\367\357\200\373\017\335_\350\376\253\373o\300\3755\340\376&\270\377\t\367\027\301\375'\340\376\020p\377\353\376\252\273_\300\375&\335/\323\375~\300\375\003\340~5\270_*\3567\203\373\227p\177\022\356\217\201\373'\300\375=\270{\t\356\276\347\356u\356w\313\335\021\340\376\007p\177\013\334\337"
+	.string	"\356n\001\367/\200\373W\340\376\024\270_\024\334\237"
+	.string	"\356?"
+	.string	"\367\237\300\375\005\340~\241\3567\317\375\342\271\337*\356\367\316\375Nq\277v\356\256\345\356\037\270\273\233\273_\370\373\373\373sO\333\334\2011\356\030\350\216\377d\372\2328\221\201\273\004\243p\225\241u\341\022\004\222\333L\\\360\026 _]\027\231$\35523\264\3134\265\313\364h\217\351\323\036SE;\336\273v\034\330\273\275\300\244\211\343\363\b\021\216\261\250WiKZ\242h\217:\326\363G\272\321\026\205nx\031r\206CG\336\345s\2565\205\341M@\323\032\0019U\271\273;\242\244j\230\035y\262Q\3510\243%\n\363j\212\333\301\330(k\353\372\214\353Z\030#\036+X\232h\327"
+	.ascii	"\213\375\321#\005\227eR?\364DoD\302i\345\312\3453\322\364\006"
+	.ascii	"\345\302\273vJ\247U\264\351sx\031\213.\005`Mi%9\313B\204F\215"
+	.ascii	"W\032\"\201\025\207\305\260\025F\202\273\232\023`\346A\347\350"
+	.ascii	"\256\035n\245^\2164M\201b\261{v\335v\f\013\266\272\234V\321o"
+	.ascii	"rrk\362S\226L\016\300\032\312\203\352A\351\362\333\331\022\021"
+	.ascii	"\273E\256\330RYb+N+z\371,pva\261\347\361L6\221\005XKN\253\250"
+	.ascii	"\227\336\265s\3069\255\242~\177\230\247I\001C\246\210]*\267\312"
+	.ascii	"\205;\332J=\022[CN+\276.\317%h\216K\f\367`\252\022-\232\024h"
+	.ascii	"r^(Z.\22797\250r\371\315\246\016\316!\247U\364\222\211\335\267"
+	.ascii	"+w\341\302\366\222(\304\326\224\323*\272\204\305\236\351\256"
+	.ascii	"\341\256\346\007scP7\261\247\362{%Z4\201BsaOp\033\226\303o\230"
+	.ascii	"\f;\301h\030\nf\202\3250\035f\303fx\t.\303Q\260\024\f\207\307"
+	.ascii	"p\023<\207\327\260\033N\202\343\260\022\234\206\317\356\023\213"
+	.ascii	"=\236\343*,$\006k\t\025j@~\322 1%59\323E0\0306\202\217\334'\016"
+	.ascii	"\303^~\333\333\025\206[\334\265\233|H\371\3410\254\205\271\216"
+	.ascii	"|\375\200\352\300a\370\313\302f\316\001\221\032\303a\370\n;/"
+	.ascii	"\334\216\275\207H\b9sZE\323+P`Q`\262\307\344\320\036C\303\017"
+	.ascii	"\023\301\\\177\221\364\256|\305\320\277;\340-\231\245\021Y\334"
+	.ascii	"g\217\371\321\036\243\324\216\235\356\317\207\207<\322\2152\251"
+	.ascii	"\262\372\214\261D8\316\032\300\230\332\331\347\027\230>\215\035"
+	.ascii	"fO\327\264W\267F\305A6\3208=-\351>;\f\235\366\301B\270\225\372"
+	.ascii	"\200\031\004\005\202\247p\324}b)\347\221\302M\354T\242ES\004"
+	.ascii	"&\020T\nCy\023\016L\237\275\\\n1\245\205*\033\331\261\004\207"
+	.ascii	"\316\016\323C\373\017\331\330p\341v< \210\330\330\022\026\024"
+	.ascii	";\341!\\\203\003\323\247\002mI\240I\256\026\004\356\315\024&"
+	.ascii	"\245\245\224\305\205\243\203\231\026v\302L\256\026\344\261\260"
+	.ascii	"y\200\\A\035;\341\033\033\202\313v7U\036<\242\234\364\300?p\016"
+	.ascii	"\314\003?\341\035\330\007\326q\237\330\t7y\320\220\032)\022\335"
+	.ascii	"\202!;\220N;\320"
+	.ascii	"\211v\340\232v \231v`\021\355@.\355@+\355\300\0374\222(\363\344"
+	.ascii	"\204>;\260\006\236\201\217\356\023#\341\030D\270\310\251\212"
+	.ascii	"\024F\302F\270\bC\025\273'\"\017\230\214\n\226\"L\212\260\214"
+	.ascii	"\030\277\255\033~X\006\216\021\344\212\202\341\344\245];\265"
+	.ascii	"\353*\355\032J;\026r\307,p\013\034\304\201\364\351\302\255\347"
+	.ascii	"3\206\201\201\034\007\341\027\033\007\221P\332{\211\203h\270"
+	.ascii	"\354\275\244\271\267\202{+\310YMQH\324\354z\207\306.D8\376a\261"
+	.ascii	"\003\006\321\347\013\364\222vmC\177{3\250\035n\215\212\231G!"
+	.ascii	"xK\237]\267\300K\254\304=\240vRx;V*\251\210I\371\323\024\274"
+	.ascii	"Du\337o\321\002\024R\364\274\223\353\323\002\214\242E\306\027"
+	.ascii	"\365\327\202\367\222t@A/\221\243\24226\035\342\326\250\217\305"
+	.ascii	"J\325\226+f[\332\357\363\257Xy\341\321\342\345D\317\337\312\345"
+	.ascii	"\273N\274\271,\237\277\312C\265\224\220\222\0054\217\246\315"
+	.ascii	"\315\217\306\347\274\307S\263\362\230M*\355{\177\007\324\243"
+	.ascii	"{\262\343\316(\307\024\231\363\263\277\344\320p\032\360\021\036"
+	.ascii	"\254\317u\367\371v\377\026f\367N^\312\323\254\257Jf\273\320r"
+	.ascii	"\226\245D\271AAP\237\317O\007l\"\243h\t\337\334}>\024\307\223"
+	.ascii	"\331\233C\207%*\242\317\276\367r\377D\227\327\367r\376q\315}"
+	.ascii	"\004\3513\334\013\336\220\234\027\024\375\344\337\226\226P\206"
+	.ascii	"\342\264\253e\332U$\332\333[\243.y*[3\214pi\177\266\373\374\266"
+	.ascii	"\227\362\177\372\035\256\241\355\177|\324\213\035\264\355\247"
+	.ascii	">\355\302\035Y\330<x]\240\036<\\#k~V\324\\\344\317\356\244\320"
+	.ascii	"^\311\253\335\347\247\371\247}\220w\006\225\027\366\326\301E"
+	.ascii	"*\355\265\376\213H\315\333xi\0366x\360\020\003#\307\r\245\316"
+	.ascii	"eov\237\177\366d\317\037\273pG\355&\n\212)\341\245E\317\336\310"
+	.ascii	"\207q`\372\200\220F\005\252\321z\244\361\bzE\250\034\t5\2610"
+	.ascii	"\203\322n\341\250\250(\273\355\321\020-\333,\374\244AiP\032C"
+	.ascii	"\303\333\231\316\301\245\206\013\"Oc\250/nX1\373\234\016\345"
+	.ascii	"%3yBEo\237\323f*\364\227\302Had\264\b\324\364\242\336\360\260"
+	.ascii	"\240==\351\317\211)<\256\253\030\034]\230Y\\x\372#\024-\222\362"
+	.ascii	"9\365\311aj\023\217\222\257\313'\363C\204\226\004\227\262HY,"
+	.ascii	"\240\013\217\353*(\245nF\\\231\237\373\245L\275\367\276eqG\035"
+	.ascii	"\236\314o\b\215t\351)\023'Y2\031\3629U\3460!\272(Q\237\323\375"
+	.ascii	"F\030\254\350\355\306\347\374\367F]O\220\234o$\205\345\207\362"
+	.ascii	"\213\013\227lCm\002[\320-I\327\232\332b\\\355e-{\271\257\217"
+	.ascii	"\217/G\335\246\360\270\242Y<G\263\022\b\332\332\017\3554HW\236"
+	.ascii	"\371\n\256\202}@\270r\203\356f\033\006/qA\2628\001\272\313\320"
+	.ascii	"\273\254\247\356}[%\241f\326K\345\252\200 \371\\\245J\316\273"
+	.ascii	"\273\271\367\221\003\262\356\240x\236\363`\216\200\214l\321l"
+	.ascii	"\355\301;\272\373\314tyJ\276\260\367\262Nj7\233\030x\236\342"
+	.ascii	"\236\243d)3`?\313\350\347\\'\302\263]\333\023\3643\001n\215*"
+	.ascii	"\263\333\340\223\271\271k\347x\357$;)\262\270\373\314q\327\356"
+	.ascii	"\266[\b\006h\251\305\300\203ZO\236d4\347Y\320\307\333\333#u\330"
+	.ascii	"\233\210\0027%\0166\266\354\246\267\204\307\305\304\263\333\277"
+	.ascii	"\210\261\261\344%^@~X\362\222\334v\353\240Zvd\0320wnt\301\030"
+	.ascii	"j\367\231\325\036\351\333\255\204y\261\324\334\030x\260\347\354"
+	.ascii	",\243]\241\200j\252\251\3043\032\001\222\0309\311a:FKCF_\222"
+	.ascii	"$\271\354n\275\020jJ<\256\350>\222A\346\271\214\254\b\224\236"
+	.ascii	"\317y,\207i\251R\345\366y\b\030XFr\255\204`[zzFrEk\215\352s6"
+	.ascii	"\222\303T\247\037uNaGpX{\346\203\343\252j\260}\316E0\227\313"
+	.ascii	"XZb\371\354{\256\226\213\316\234o<\264\347\254\354\364\254\345"
+	.ascii	"\356Z\331\013x\264\225W\024\200vv\324\354\220\275r\027\r\233"
+	.ascii	"X\334\217\334\322\260\355\3410\273\241}/s\321\254M=\371\340\312"
+	.ascii	"[1O\330\270\\\344\341\272\030\245!!R>\373\314\217v\177wuo\242"
+	.ascii	"\264\335M\246\214\352~\375\246\367vp\237\271\370\026`owo\200"
+	.ascii	"\211v3\313"
+	.string	"\240`\321Te\313\032O\301\356\260\267\262\351\003\306\244\274\340\003\266\334>E\340\206.\370\264{I\202\r\346\264}Z%eVR\376n7\017\323\320\346QR\352\370\264\273\271[%\245\205\3153d\301\247]*}\300\230\206\256\017\230\322\320\205\315\263\225\233g\271\244y\224\206|\232(\rY\360\001[\016\371\3600\r\335\335*\355\033\207\3262)[l\260\345\314\336\033F+\245\224\331{\331\334J\271\007\332LP\240\235\264/\034V\353\2645\354\275\225auMJ\300\226\271\341|\252\224nZ\354]\267\201H(\257\262g3\225w\357\026mso\246\022\007\216\224.\224\236\346\236\331<K\030\314&%\231\026L\245\236]\265t\207|\300\232\224D\234\031\001\223\332\314Vy\245v\035SS\203)\333\035ve\006\314\307\021\214\317\236\261\334\363\216|\225{\240\030{\372|\276W7\203\232\255Dx\0362\263\343\207U\331g"
+	.ascii	"\b\251R\307\326\234r|\316T-\330\305\273\261E\215NC\211\005\311"
+	.ascii	"R\367\231\247<Oa\237\034\025T\266{Hu\301C\006IRO\217\232=G\201"
+	.ascii	"\001\311v\364\200~\316P\"<\003q\200\017\247\254\317\330\363\217"
+	.ascii	"\036N\031:~|\366\354\243G\356\322EL\255\325\002\236m\021R\364"
+	.ascii	"9\357\020\341\231\207V\262\032\322\364Y\202[\243\306\230%=e|"
+	.ascii	"\326\021\024\001\253\032Tr\3547\243\"\347\345\224Y\274D\245\255"
+	.ascii	"\2515\375\225\240\334]\026\032\023^\2466\204\342\200\362R\037"
+	.ascii	"\227\260\271/%\033TQL\350\036W\t\302u\005\224t\343\252\345\330"
+	.ascii	"z\361\271m\203}sBYlx\256\001\026\304\305\223\317\231\006S\013"
+	.ascii	"\220h\023\355w,\003\241-5\341\350o1\026@\320\277\334"
+	.string	"\363\365'\325t\3265\307\207\203:\240)\3752P\366!\022\307\205\2018\247\325U\006\302Y\316\364\3342P\211\026\315\t\344p\221\201H\020\351\302V\256\340\275\013w\2046\224\201p\337\025\303\255\231\356)\362\203\224\205rQ&\3121\362Q6\312/rP\036\3120\362\214,#7\3573\003\341-\236]\344\237\f\364]\362\262\210\217W\006\302Z\036I\211\201)\247\325\325\336\333\203\207\340\227\r3)\003\310\300\366H\346,\267\320Pt6\322\2642\213\314\363sa\273.3=\363\250S\224k}Y\371\307\305\350,\352)o\374\367cU.\222`\277E\023T\260&P\030\032+\240\2025Q\202N\316\020\230B\310\342\344\265HL\342\020wP\254k\020\231\334\321\311~\363\001i<\016\2119*\006\277\371 \001\016\316N\261h,\276\244`<\336$\215\305\227\342\316\032\301L\222=\021d\221&\320\334 wF`Ot"
+	.ascii	"\023\203A\005k\"\304\207\344Q\250\363\241\306F\310\202\340\301"
+	.ascii	"\005c\n\242\005\017Lt\020#\343\036J\220@'G\230<1\223\\\205I\034"
+	.ascii	"\326D\f\322\004\033#\361\310\216\200\301\207\304#[dO\320N\202"
+	.ascii	"\203\f8(\261\342%\271\036\223IaMr\310\036W\230\341\260\203\b"
+	.ascii	"$ BU\207C\241\036\016\2052\254\215\321\003\231"
+	.string	"#\213\203CL\241&\223~\363\341"
+	.string	")rU\223+\322\0046\207\230\324H\023\222H6\005\266\250\221\2521\0051EN\322\254/~\363!9\3349&\221#\220\353\n6\271\223s\241\270c\034\256\353\313\221-\246`\\\327\027\344\221E\356\024\327U\333\024\211(\254\253\212,\022u\220\353\372R4\022\221D\034v]\201\311\325B\0066\354Qx\203\314"
+	.ascii	"\0042ID\001b\247xB\006+v\212D\234\fHp\260rPb\005\b\326f\007g"
+	.ascii	"X$\2028\"w@0 \271\202-\342\b\213G6Y$\2567I\235u\225@\005{\324"
+	.ascii	"YW5\211$\342\254\253\272\256\352Qx3\314\354\nD\344\272\252(\f"
+	.ascii	"\21589\204$\261HT\213j\206\342\007\306\024\304\017l\204\354\021"
+	.ascii	"\346\230\034aX\334\371@\230\024\232\260\021\262\022\330"
+	.string	"\200\\U\260&\212\037\314\370\315\207#\213cS\024\202P\223,\246x\344:dI@a(D\201\203#\364\340\0021\271\202\315I\344J\3249\221\2025\261\2060\302\211\030vX\024&\221E\242N\256\"\204\220\213\304\021\212\310\241J\324Ab\344\352\301\210\020b<\030\021\002P\035\216 \342\035\024\033\220\253\005l,\034\331$R\230\243\"\221\354\321\306F\370\302\252\020\342\350\235U\005k\203\334A\241\221+;$\252`M wP\304\260+\253\243B\t\310\035\024@VG\205$r\007\305\013r\007\005fq\204Cdj<\262\031\320/\311u\204\006\310\035#Q\005{\034\001C\nB\022<0\321\001\314\013{\334I\n\217\254N\016\233\214I\372\315\207\035\235\034v%!\304\006!8\330\321\311\251\331\3011\"\331#\fr\215\200=\261\243\223\023\243&qv\220,\t,\006v\025\256G#\262\310\"\203\305\023\2108\035"
+	.string	"\331uf\005\020(\020\243\202\215\220%A\230\024\332"
+	.ascii	"q\214F\b\254\351\021\231b\2759\201x\263\316\244\320\301\221I"
+	.ascii	"\241\203\263\256p\203\302\b\r\326\033\fH\035\343\321\304\221"
+	.ascii	"\265!\252 \232\330\321\311\241I\256'\bK0\022_N\020\226@L\256"
+	.ascii	"\210@\262\030\302\216N\316Lr-\3612d\223\306\343\b)\030qR\034"
+	.ascii	"Y\025\" 7\260k\220=\nS\2609\nA\220I\372\315\007\344MR\230\003"
+	.ascii	"\242h\314\3111\016\003\340F\035\366\b\"i4\036A\304\344\\\344"
+	.ascii	"\272\352\244\250YA<&\205\026(\032\211Ia\322x\fZH\256\034\210"
+	.ascii	"H\026\211;\332E\210\360\200\002\023. \001=\374\300\242 L\261"
+	.ascii	"\032\217*\2340\034\nA \217\254\n\342\321\006D\221(\314\0011<"
+	.ascii	"\"A|H\300\n \260I!\t,\216N\216\360\304p(\244a\222B\315\2646\326"
+	.ascii	"\224,\311n\032K\224\337R[\216\312\340\311\350\372[[\313Q"
+	.string	"\272\273?\235\226\226\243tnRX\320\372\224\224\245q=\334\330\316r^\312\343hj\233e4\031]Vzi\031\022\036Xu=)Y\372\344\204\365\"\035\313S\342z\376\224i\222k7\367\006\203\231\212\245K0~\236\317\234\007T\356\255\264\260\231R\202\244\242\244G\322#9\3576\233O\316.0\321\356\251\221\254\227\237H;\232\212\244Y3EwiNR0L\245c\313\026\363+{\215m\341\253\372\314\305\225v\001\225A*r@\232i\353i\027\315\224'5&\237S\"\230\013\313\371Ae\301\\\253Z\217\250\225n_\230\254\230\210>\267BZjA\237\243<\r\022\225f\305`B\303DG\222\277!\236fy\212u\331\224AH\256R\253\324\006\215\215%\\j\bq&IUI\205\244U\313\270-,\252L\325\276\020\271\361bS\245R\236N\021\365DM\351\013I<\334{\244P\371\305\336\314\020-\263\016"
+	.string	"J\242^><\205\362\364\307\003\374\274\262\376\371\266\267\365c\310\226\027Q>\373\005!\355\027~t\270\353H\237\324#rO\\\321\275\217:\350\031TX.>\247O\356#6\300\\\371n\355\217K]\223\247NM\351\322\365\332B/3z4\365]\321@\271\331\335P\323\351\fO\221f\244K\216yv\222\215\227\251\254\246\276\350\3669\352\360{\316\037#7<]\362Ti\304\006\256\266\244\353E\215\244\024\207;\020\206*\007\330\020!\3323\320^FCC\251\215\246\226\241;\033i\r\232\244\034A8H\372\305\2477\367\231\206o\230\211\022\204\326\250S\023\013I(]\202L)f\320P\2214I:\023\025@0Hd2\026\255\263\236\017\023"
+	.string	"\224\250\243\241\232f\231SJfD$I\n\nR\222\322r\213 \004*\233\246L\016\246\037\363\355f\3129\203\261\023\337\362\312L\201\205ZL\302Q\nt\035-\350,z\005\007H\257\374\264\016u[\232\200-i\346\\\025-R6\311\274\375r\360\322\220\b-g2c\317\007\351\326g{\332\237H\034w\"\200<e\n\006\334\251*h\367\022\253y\3478\007\345B\275\f\324<\237W\3635mX\376S\002\0263J"
+	.ascii	"\213\343\235d4d\302}I\026Je\266\332\327pF\360\343\037\0308%@"
+	.ascii	"\246\307\204#\025\361\350\210\0176\257\371m\234\326*X\335\271"
+	.ascii	"\344\216\300\277\\f\207h\313<`\026\313\326\355\315\331BA\"}h"
+	.ascii	"\327\330\206\353\201v\016\177\274D<`O3j<\373\3723G\273O\325|"
+	.ascii	" \223d\303sL\002\306\304\313\316\342\304d7@\330\226C\210\323"
+	.ascii	"\202\2173kQ\333\220L\bn;\217\\\304\003A4,K\030\272v\310g\217"
+	.ascii	"\241\342\336\233\315~Q\027u\025\256\032\360#\004\317Z\310O\037"
+	.ascii	"\311@\b!\t\231\211%1\021=\322s\230\020\361m\227\250\371m\363"
+	.ascii	"7\270\344\247\331\372\246`\357\251\020zn\177Cr\013\"\350"
+	.string	"\204 \t\372\316\260\254~iDpK\001\211F\f\274\253\253\216\f\tW\244\232\225\20666f\312\033\342N\202\334\035\340h\034\340\200\2332\240\354y\025?\324\306L\270/n\236\003\366\267B\220\256_\2762\005mC\257X)\355\311+[Ts\267w\300J:\001\346\n\377\341w\220r\004W\265\252\234\331\226\336\t\245\366\2539\335$1\316{F#0\337\346r\331\235\036\324\f\203\241\013\t\023\377&c0\242TU\340\374\t\033\035^u\032\375\207\357R\261\b!;0\224>\007\344q\221\003$$U\032H\f\270\306\304h\244\023\367\253\345\nC\277\305\356u\336\245.~\345\234Vb\330e`\026\374\371\023c\360\342m\224.\205\374@\305J\310d\236pi\253\013\212:\220\306k4\341\275\344\232\222\205\005\f\023\n\004\254\214`\322\235\003KEp\372\346\262\355\333Ws\257\256\255[7(\325\362\020\347\351\377s\375"
+	.string	"\006\033\333\217\r'\254\rqq\205/\320F\360\273\266\372\215@H\376:\326G\260u\300\321s7\316D>\261\346\235\226-\027\353\330\211\032\0260\365\363T\024\334\210\320J\344Si\377\345\212\236\336\307\3240\371'u\322\244&F\007\216\"\222'"
+	.ascii	"\255ni\023\271\354w\260\303\344\340\371\271\b&$\244\227\226\231"
+	.ascii	"99\212\303\232ca \037\363\264\203\200\276\324\361\034@\026\331"
+	.ascii	"\t\037\027\nA\342\330\332\2777\261i\2452\247P\243\031\312\257"
+	.ascii	"\335#\306\333\202\364\336\276\335\"\263\226\330\"\313A~<\351"
+	.ascii	"\375\277\304\227\021\300OX}\304\004?\365$\001%J\003\240v\210"
+	.ascii	"\300ul\342\353\307\017\007\215q\3645\2076\\\032\316p\341_\246"
+	.ascii	"A\205i\207b\255\245\b\002l\222\354"
+	.string	"Q\211\376\003C\351\025\316\210\233q`\241Oc^\034\013\371\304J\333SLg\212\234M)\232\366\021\307Y!o^N\277\341%w\n\020f\245\350^X\355\230\307\264W\370\027s\310\325\244i\347\033T\027\376\227\310\3740\212h\274\013\261cs\031\340\353\220t>\007e\177\277\027\231\300Y\356\337\222\235\270\2345\342\224r\255\232M\300Q\377\204\302\013\215\316i\025F\245\t\025\260\277\b\004\250\243|\257"
+	.ascii	"\271\233\200\005C\321\224D\007\341\242 \207E\177E\241\327\031"
+	.ascii	"\312(\t\003>\344t\272S\201>f\363\225\"\221\227\2512\274\240\020"
+	.ascii	"\224S\266\256\226\312\212\0213)7\27038+\271\300\213\220\226\237"
+	.ascii	"\027\213yC\253\206\031\320}"
+	.string	"\020o{\224T6\315\346\377\2410\324j\226\265\207\r\330\352\007\f8#N$\237\\\225\220\343\246\321o\3524L'\250\327\033\323v\342{\354\337\r\364\202G\254\204\344\214\357\355\\\001\314\n\210\\\300\346L\316\3666b\t`\223\346b\327{\222\376\337\274\305W\032\323\271\206U!L\335|^\262^h\366\027\2346\362b\320\013\247\030\313\366\\@\365\220\260P-\017\312\261f.\350|\253p\252\224\216|\331\341\335U#rq,\213\253\221\374a>\020\242Q\234UY!S\346\373lR_\334*\013o\3651a\3214\017\373\321R*9\b\321R\334\256\3269`\344\331\fn\326\221B\352\346\364e!D\350+\352Az\376\004\225o\232e\"\351'\312\362v\344\254\332\266\001l\fd\2011\370v\273\310\310_\025\227\027\332\275U\230`#\264+\305w\350\235\374\356t\270\345<\201&\321\350\260\342\306\223\004\350\360A"
+	.ascii	"\310F\304\273\236cfY\273\201F\234\r\314\023 j\b\fNa\226\270\355"
+	.ascii	"z\375.\361N^\217^\242\233H\363(\206\025\275[x\273b\303\233}D"
+	.ascii	"\211Q\n\272\363s9\n\023\314\204..\277\333\030\360\226\3446\\"
+	.ascii	"\340\201\033?\263g(`\026\214\227sBW\237\030\003Ue\313f\315\325"
+	.ascii	"\017T\324r\361\326\034\263\335\313)\207x\263\336P\2267\237\304"
+	.ascii	"O0\333z\372\214\235\323C\313pK\201b\327)<\265:\327\276"
+	.string	"\2366\2514\330rb\255 \224\020\226X\305\374m\206\321VY&\234\302l8\003%kgCo\360\266@\250\023@\341\027\32362\375]R\021\214 \265\275\002\354X\224P\374\002\343r\304\024\264\337H%,a\034\220%k\260NQ\200\204s\353\336\310\202\341\006\355\304\376\371\273\020Q\372\320\214!\204L\364\373su\220\345\320(\320\3550\337\341\323\241\034\271\034\371q\223(\206\2301\004c\201i\206;X\236\336\035\245\203h\235\217\252\307=\210x\2579&\247\223\006\025\204)i\377b0p\3755\261:\214\253\334\022\r\240>y\374(\rN}B\220\316\315\006F\207X\300\346V\217V\373&\253X7\276\2436\324a\242>_i\211\243r\t\217\257~\201\247?\313D\376l\211\001\217\205D\3179\3748\370\246\333B\373b]\001\340\332t\n 2\031\374\257\330eK\311D\031\260\321\306\001\255@\336\240\362\2512"
+	.string	":\n\360\213p\035i\244\2134\376\247@R\334\274\r\206W\213\260\377\257\013\304i<\253\002\343Q\025\274u\213'6I\254\375=w\003\235OD\263\306\204n\027;2\350sW\304\344\035wzT\264A\204\313v\362\202\267\301\005\263\353\323K\336\252\024\261\345\025=&\337\371=\206)\236?\272\220"
+	.string	"\355\357\377\266:\bp\344\323\204v\307\272\327\303\223{\250\251\305p\226\016@\355w\367V\340#\257~\363\235I\264\265\372\301\344\375\355Ie8\020\2205\264\201\300\362\302W\274\323KF\200j\310\305\332a9\307 \021/\034\333Omp%\344JY>\r\251f/\240Z\0355*\2009\200<s\024Mx\353\216\bmT\352\266\036\3711$\364\263\216x\250\204\025\364j6\343MIv\3121\021!\226\337\206\336\3661\017\324\371&s\237\373X\304\265\271<\215\243)\205U\245\203\241\241\226\327\350\005\216\204\\\265\022\331g\315\326\363\255Bq\003\267\r\225O\242\201\263x\023I\201~(\no\36629\027A\373`\021\377.b\266\247>i\007\351!`\226\353\210\315\215\357n/z9}\270\2015\237\235\375\257\227\306OK\264@\213\211\241q"
+	.string	"1\243h\373\3757\3730\362H\342\243\333\001\340#X\241#\321\250\236Q"
+	.ascii	"\277\245\"\001{\250\346\264\314W\233\2432\352\361\357G\274\366"
+	.ascii	"uw\021\254I\235\342\212\356\230\r\013>Kg\002\007\364s?\r\242"
+	.ascii	"S\317\311\315 \333\002\302\037sv\333\206q\311\317>\017\177^\350"
+	.ascii	"U\200\035p&U\206Xo\263u\243\367\306\277O\177\30099\243\240A\312"
+	.ascii	"6\003c\225o]3%\213|T\344\251#7\354\032\001\235\275\346R/\201"
+	.ascii	"\232\027\004/]\002\312F\214\252}Bn\"\373\231\003\225\313b\221"
+	.ascii	"\260\235%\202\362\340\242\267\351\225\237)\032\263\374\030\321"
+	.ascii	"JK\177\330\016:\275R\337\276\254\217Yz\245\274\013\220\357\330"
+	.ascii	"\277bY\2667\217!\026\331\342=F\277\330\373\013\2748\361\330\203"
+	.ascii	"\027\276O\021>\353\006\367\005\f\325>W\340'\317,\276S\231K\376"
+	.ascii	"2\345\251\335\223\351G7\275\357\224r=\350n\366x\n\364\205\231"
+	.ascii	"\263\371OU_<zy\367\234l\362\275\224\017\375L\341\366\256\177"
+	.ascii	"\220\305\2740\364;?`\030\202\031\372\264\211\213\233\343\323"
+	.ascii	"\235\330\306\306\313\035\303x$\366}c\036%mn\375=\365\217\337"
+	.ascii	"\333\210\030'\t\371\327m\346\231\307\214\376\303\267\3709?\205"
+	.ascii	",\253\331\200_h\234\3722\001\260\217\367 M}\301\375\252\352U"
+	.ascii	"\323K\r~ \207\341\372]\224'k3\232<u\215u\306\361\2749\212{\273"
+	.ascii	"u\340\305\004t<s\262\331\315\236\350\262\245\003K/`|\375\341"
+	.ascii	"\356m\320\375\276\037Md\237\202\367\371\213\017 \366\207N\261"
+	.ascii	"\343\303\346\221\366\251Co\372I\272\346n\277O\315[\377\304.\177"
+	.ascii	"\303OY\247\013\307r\272v\017x\335"
+	.text
+	.section	.gnu.lto_.symtab.35137491cbffd6d0,"e",@progbits
+	.string	"fakeGyroDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"fakeGyroFifoPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"fakeGyroUseFifo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.35137491cbffd6d0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,295 @@
+	.file	"gyro_sync.c"
+	.section	.gnu.lto_.profile.cdd500bf3176390,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cdd500bf3176390,"e",@progbits
+	.string	"(\265/\375 H\245\001"
+	.string	"t\002<"
+	.string	"\002"
+	.string	"\275\377\247\231\007\004\002"
+	.string	"\002\001\001\222\313\366\205\b\022\002\002\002\001\002\003\002\001\002\004\004\002\001\002\005\002\001"
+	.string	"\004"
+	.string	"\200\203+\271v6m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.cdd500bf3176390,"e",@progbits
+	.string	"(\265/\375 \034\265"
+	.string	""
+	.string	"p\020"
+	.string	"\002"
+	.string	"\001\003\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\002"
+	.string	"/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.cdd500bf3176390,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\275\007"
+	.string	"RM'(\200K2\0343\016\234"
+	.string	"L\034\032\230\031\250\231\342\256\200\007\264\031\034\266-\315\025\231\220\tyN\211x\221\266\267?!R\246\377\317A\213\036}\221- \306\203D\264\227\032\320bC\003\332\r\244i:\233\307\352\022Bm\007\346\252\262\036\201\315\016n\206\233\330\342\363L\205\262-\244EGb\212\f\021ST\030\304\024\037\201\200\035\221\302\314I\212\316\314K\340E[\202\267\314e.\007\223\275\2160j\0130\327\204l\316\b\3336\275C\333\311\247\304=\023)\257!%>\363I\230\321V=\037E( p\242\243j\035E\200\331\2008\312'\320\256,\347d\266\333\302"
+	.ascii	"d8r\371\233l\nA(@\3341p\f@]@\f\204\206\302-\366\222\030\333f"
+	.ascii	":\234\\\232\221W\202kA\006\227\374X\fm\2156\\\275\035\221qu\374"
+	.ascii	"\272\032@!\022\263\\\023Q\221\213\353\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cdd500bf3176390,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\001\001\003\177\002\001\001\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.cdd500bf3176390,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cdd500bf3176390,"e",@progbits
+	.string	"(\265/\375 \200\205\002"
+	.string	"t\003t"
+	.string	"\002"
+	.string	"\001\370\005"
+	.string	""
+	.string	""
+	.string	"\001\002\013"
+	.string	"\001\002\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\300\n\b\b"
+	.string	"\001\001P\002\002\n\t  "
+	.string	"\320\003\002\f\240\n\340\n\b\b\002\r\r\020\020"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"I\215\342\2230\270\003\350Zu\t\030\203\251\214@\323\217\r\264"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.lto.cdd500bf3176390,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroSyncCheckUpdate.19.cdd500bf3176390,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"U\f"
+	.string	"\226\227TB q\223\016L\006\3341\"\242\007\"-c\355O\241\266e|"
+	.string	"\277B\376\251\364"
+	.string	"PI\027\205\037\021\264#\350\264\235\032\250\030\321\246\210\021\022"
+	.string	"\261;\331X:\357"
+	.string	"M\036Ix\374!\226\354-wJ\001@"
+	.string	"A"
+	.string	"A"
+	.string	"\220z\200\351\320\266\023(\350\030\033\220AI%<\233\214\335\031\365\303\261?u\230\257[\311D\313\37664\016\327\214V\362\n\354\356S\356>\032\211s\027\007\273kg\242m\270\341m?\260\335\300>\204?\374\274\235\235\177!\220\301P\301\242-\346j(\325\330\024\360D\210\317\337\356\370)\306\370\023{\353auE\207):ph\006\224s\366EG\351|$r"
+	.string	"\273 \022&v'\002wP\207\236\0270=$OC\333W2.T\304\213\023Q\f\267\273\231j\310\307\246\353\004\025R\211\243a\033\303G`\324\356v\370*\234\213\002q\350\213L\207\327\223X\234\240\214F\\\311\236\231\323\220\375\267\273k\005\331\037\005\034\215TK^\037\317\025G\025rm$DK^\037U\345\0217Rs\001DR\210! \036\025b%7\221\303\200-\013\032\0319\226%#f\356\337*\310\021<+\356\333\027\240\360\260\350\217MN?z\371\264\314h\031\321\024"
+	.string	"@E\261#\236\207\205\270[\220"
+	.ascii	"\263n+k`\005\021\006\017\221\313\022\210\213\237Cn\3540\327\354"
+	.ascii	"\231\205\355D\246%X%O5\003\225\304\241\356mm\321\003"
+	.text
+	.section	.gnu.lto_gyroSetSampleRate.20.cdd500bf3176390,"e",@progbits
+	.string	"(\265/\375` \004E\031"
+	.string	"\366\252\232I\260XQ:\300\213u,\2240D\033\2146R\021\357\251\375!\026=T\320i\037\030}1u\005:\345\036v\264&\207\003z\371\227\t\177C|f\3660Px\366C\237X~2\341\020y\360`so\020\372?!\233\354\275\223\f\203"
+	.string	"\177"
+	.string	"\211"
+	.string	"\335C@\244\356S\207\035\214\017\371\034\231\231\377\343E?l\3223\247\202\001\026\024\277`\367I\256~s\037\322\013\270\017\353\215\233O\241F\361\206\266R\223\017!\006\260f\233=Uq\240f\354FQd\255\200\361k\023\310XbAcCao\244\324\310\362\337\251\220-\210\206\247\301\270\025Y\277\027P\262R\263\261x=\221\262\001\271\270\253\356>\r\025/,\025Y\335\315\264f[qV\235\231w0s\006f{\0036\035T#\347\324\267F\240\272\235\240e\230\271\347D`\006\232\230?|\210l\354n\007G>!l\232p<\344\227\270\017_-\364"
+	.ascii	"\303\243\321'\346sF+\216\371\266\353\020\363\317\177|\357l\357"
+	.ascii	";WK\231V\312_=\260\201\023\245;\305\323\230f\n\227\350x\357\367"
+	.ascii	"\2352\377\360\205\374\307*\237I \354\276e\321Ux\317\264\235c"
+	.ascii	"\025iq\352>s\036r\204\221"
+	.string	"R\346\363\036\344\347g\211\007\b6e\247$\005\213|\306H\t*\224b#vIBt\3443F=F\245G9\"b\261.\341\240v\276\234\336\221\223\373\327\245\3654\204\\1A\3030\263\353O^#\255:A\300\360\226\334%&\254\270?\t\bQ\316V\3349\\f\2367\3410\241(\370\205F\237\370\300\337\211iF\311\274+\216\231\360\223h\310\350\372\206\304W\002`\205\324A]7\022~\222\324a\367!\323Z\003\305\320\335\b3o\031\273g\227\301\314\274\205\006+\022\024\\ Z\027\\\035<\364\2640\224e\253\306r\271S\372\214\220i a\261\021\257\262l\221\262\230K\004Ol\003\351\303\323\352!\313\230\214\3349\3000\017\256\030\t\002\006\213\221\252\263_\207\270\001\017\224\330Te\034\251\334\274\013Z\334sy\215\016\236\275\267\233\327V\241\0066P\022\316\233\367\301\035PF6\312\335\2744\267\313q\025\324"
+	.ascii	"s\330\001}\363\326*Ti\202\2740\321*\020\333\312\334:\026s\311"
+	.ascii	"\207\213\277.sy+\257\231\235RZ\250qD\247\024\"3%\"\"\232\202"
+	.ascii	"$9\220\"\"\253\362\0210I\345\030\315\024\230\226\003\264Al\002"
+	.ascii	"\223\004\320\253\216R\366<\231W|\246F\263N\302\322\3247\201\b"
+	.ascii	"\216\367\335)\251V\017\013\333\341T$t\337\253 \200 T\033\225"
+	.ascii	"\225j\034NC\266\204\375\b\344p\201\361\305\031\213O\207H!@\331"
+	.ascii	"\303u\232B\345u\345\266\033\237d\367\"\257\352T\253\376~\344"
+	.ascii	"Z-\223I:|\250\355\336\255\007e@\373\347\347F\030\346m;8#Nr\332"
+	.ascii	"\271\361\2415\212\341\341T\221\2606\022\365a\206\327\021\025"
+	.ascii	"\210\301q\310Y\212u\354/\203\257\212\330\312\013\217\217\034"
+	.ascii	"sF4\212Y\032*"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cdd500bf3176390,"e",@progbits
+	.string	"(\265/\375 65\001"
+	.string	"\3602"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\023\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\024\177\017"
+	.string	"\002"
+	.ascii	"\200\206\313\3161"
+	.text
+	.section	.gnu.lto_.refs.cdd500bf3176390,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.cdd500bf3176390,"e",@progbits
+	.string	"(\265/\375`\356\035\305\213"
+	.ascii	"\272\344\3602Q@\016;\352\303\025\234\316\031x8\233P\274\330a"
+	.ascii	"s\346\344\207\007\315\364pv\231\220\302\272\362E\201\266F\227"
+	.ascii	"d\263\022;?\202\354h\304\243\204p\241M{\300\272\003\354\332\n"
+	.ascii	"\333\253\203\300\236T\236\360\332'\212\202\365hX\301\363\243"
+	.ascii	"\212(\273\355\226)\245\335\002!\003&\003\236"
+	.string	"5\002\202W\376\023o\373\031.s\216\236\253\244\333\026QQ\221\316\n\006.%)\332\271-\334\375S^\312\355ad\336Y\346\270H\231a\362(\363\243|\262\2279\347\2365+d\267)\270sW\270sFp\347\202\340\316!1\223o\"F\265E\345\321\316\331`\202\306qH\203\354`'z\303\215\266\301\335D\315\340v\372P\372S?\3445\234\335\251\021\365\350\003\371 \316l\265\027\262+.3X\022.\303$`\260\f]\253\245\215^\301\236}(\375\036\335\317\343\221\037\345:\250\264.\030\266p\352C\351\353\370\026\234\331\341w8\034$MH)8\205\234\275C\352qq\336!mT\t\026\341\034\322\034D@:\202\210\031\037mt\007\356\007\232\276\306\355:b,G\2328s~\034\377\344\314wz\033c\216\326}\364No|\026~\212\313\214\3749r5D\3123\347e\021Q\221\017\226\247\235\250\024\275\361+"
+	.string	"\261\300\304\306\022.7\262\340\276S\236\306CYQ\262\344\213\327\n\367Eb?\372\020\234\307y\031\031\352\334x\264/\021\356\351v\226e^\330\326\324y1\270?\r\367\207\341\036\303\302\375Fpw\371(\354D\243\302\024i\362h\377\023\356\317\270\323\254q6\316\034\300\333\334\241W\316\362\201\303\202\263\363\304\355\003\244\036\347\003\244\355b\260O9\235C\352g\200\232M\266\224\231ag\3632\316t3\335\336t\264F\275\2462X\316K\237K\214\nc\006\"\005r\020i\273\027F}(\025C\344PhpAi\202\3018\323\303\370\226F\227\375@\367Q\030\347\342k\267\353\230s\225\223\021TjX\206<s\316DE\376c\255i\f\272\326\355Z<\315\277\354\316\324@Ey\264\375K\267{q\2576\373\251\234\2139\347"
+	.string	"~\314\033!\317G5\210\035\265w\031J\217R\313\ft\317\266\324\270\363h;\r\334&\340v\201\177\3129\244\t$}(5"
+	.ascii	"\004\354X\234\314\231\037\274\254]\314\307:G\\\346e\316K\240"
+	.ascii	"_2\303\225\257G[\005n\317\322\005\260e\b\232\b\267\177Ho\\\234"
+	.ascii	"\177H\033\343 \347\220\376\231sHs\313.>\224\372Y\3239tu\273\322"
+	.ascii	"\263\234\353\032qL\345\261\234\227B:\345\226\252\261G\235\353"
+	.ascii	"}\313\227\355\\\256\325# h\r\305\234\225\363\322\271\320\234"
+	.ascii	"\211\356\007\374\270\037\220ScB\374J\321~\334K\347\220b\037J"
+	.ascii	"\273\235K\267\227\351\366\264\3566\363\361\262n\007\272q\272"
+	.ascii	"}K\347\272/\235n\177\353\356\262\356\266\323\355i\272=\327\335"
+	.ascii	"m\272\333C\267\337\356\336\352\366\266no\323\355l\272}M\267\253"
+	.ascii	"\351\356ew\007u\367Zw\337\270\270\270\270\356Nv\247\"t\007\340"
+	.ascii	"%\316\274\311.&\357\361Z\231\250q\364\240\311\311\231\274L\032"
+	.ascii	"\214\207&c&\022\021\341\204\316\0234\f\211\227!\030m\236#\270"
+	.ascii	"\037\t\244\2037\221P\360\002\031\032\021\254ku\221\367\207\207"
+	.ascii	"&\343\006]\2628\205\264\332\317.g\252\261d\326T\025\247\327\020"
+	.ascii	"\020gY\327\352R\265\332O1(\027\233Pq\366\265\272A:\374\020\227"
+	.ascii	"\371\230&Ir\325E\311u\341\026\271I\356\221\213\344.\271F\234"
+	.ascii	"y\255nU\021Q.\314\312\323\316\006\264wl\270wk\270wZp\357\310"
+	.ascii	"p\357\274p\357\224\270wOp\357\222\370\3102t\303\226\343\321\336"
+	.ascii	"Ia\036W\312\231\267\307\325\001uwX\265%o\217\033uwlhSc\344\316"
+	.ascii	"-c#\307\n\227\035\267\205\0368\255 p\267\205\253\343g\353\n\207"
+	.ascii	"\025\027nL\0057v\202\033+\301}st_\032\267"
+	.string	"\306}\"!w\345\306\232\215G/\216\353\324\367\351\262\220\357\023\211\251\234\211\367\t\350N\316D \367\003\334\017@\253T]aI\321\306E\360\275q\324w\005\032Hp@=\372\001\013\301\215{\340_:\207\024\204\017\245\267)\030\305\215\310\243\215\233.\361\016\257\022\247\232\344\315}\207C6dh\356`\003to\270\316\333\241\263\213\262\343J\2331u\350\354b\310*\223\341\331O\347\276\t1\302\304\351\\R;\314\322\260\b\037J_\016\034(v\342\234U\301q\036N\221\216\227\2307\375p\234\313\225ne\346<\372m\357\304\311\034C\032N7@]\326\340|<\352\346\335\322*n\232\216I\334o\337f\367\346\314\030$m\242\2128)S>\332:*\334$\272bE\254G\3238\363\325|\23015/\346\321\\9\253#\344\251!\337\240\203\206\242\211\301\237\236\234\306G\377\314\016L\013;\274\3041\323n\032r\366"
+	.ascii	"\202\310\023\250G\373\255w\177\344\214\233:\317\326O\346\230"
+	.ascii	"\305z<\332\324\271!\331\274\310\3401\037\206\b\321\fR\f\3564"
+	.ascii	"\013\356T\f\367\322\207R/\317F\213G\230\022oy.\316\374.\237\354"
+	.ascii	"?\362H\232\250\313\273\360W:5\316.\357\344\323\274)\025\224\213"
+	.ascii	"n38\213\212<l\013\034\234\024\265\362hm\2229g-\017\303\2539\363"
+	.ascii	"\323\372\323\376\205W\376\f\205r6r'\231\366Y\377\005\225\272"
+	.ascii	"\311n[E\035\212\212zp\024\t2\304\250\331\2379\363\321\276\354"
+	.ascii	"\3123\275)\265\314P?dSn[O\264\017\3731\017MF\025il\234X\213\222"
+	.ascii	"\264$)\332\351\025\263?\213\317\r\263'h\260<\031\317\016\251"
+	.ascii	"fZ\025\306\322\376\344\204\306\232\017\334\316\354\266\027k7"
+	.ascii	"t\t\230(\255G;\335\201;}\302\235\256\360\365Z\277\364\346\030"
+	.ascii	"\n1n\316\234\263\327\2039\363\277\276\353\313\233R\023|q\343"
+	.ascii	"\374\271z\242\324\202\303\350\224\242X\230\347\372\255\354\343"
+	.ascii	"\343\026D\r\212\034\334\2716\33495\030\353\2538\363\225O\245"
+	.ascii	"_\311/i\242e\316Y\224\017\345\247xh2\256\020R'\335i&\036s\316"
+	.ascii	"P\271e>6iH\273\275=\347\016\242\333\307\257#\320\335h\316\335"
+	.ascii	"F*,31.K\016~"
+	.string	"bF\374\361\006\344\3165s.R\r)\240B\026\251x\030\301\250\362\260\330d(t\314TC#X\316B\271X\034\242\230\312BF\260\214\3144\330\220\236\227T\303\\\234\312B\271\230\211\006\030\213TH#\030\021)d\004\243Bf0\252\034\224\213\304\343\215b>\ne0\2527\031l\n\031d\004\233B\032\301\250\256\334\354\006\327\031\024\\V\221;\356\304X\314ON@\210\307\240\246q9\225\323\344\354c5\362\021\201\234\201L\035\323\020y\370YS\363\251)\013q\312\227NMUS\271\3304B\231\312\031JSRv\"1\\6s\022o\016\255\200d\0345r\026\300)\347\241\347f\316y\230s\326\035\201,s\366\021dL:9\345,E\344\224\201\f\321j\344\374ck\316\220F\260\252\251#\2640\260d\266\261\034\272\021\307TN\3464TG\f6\354\3128\342\340$R\007\034\267\017\270\250\205,\253\255\007"
+	.ascii	"ZF9Y\265\361:l\276\230\373\372R\205\270\246\257\032$W\311\037"
+	.ascii	"\217\3364gbW\270x\301\375\300%{\251\357\361C4K>\362\241>\212"
+	.ascii	"\204R\2069\316\025V\025\306\351\005\307\333\206\312\344\263\352"
+	.ascii	"\213\264\031\215\256\006"
+	.string	"\260\234d\235\241\315\341\362\361\343\247\220$\260\310\\\262+\345b\271]\307\f\232\3348\321\250\361\266\273L\352\304\252\3268/\231\253\371\230\254#\001\255.e\362\371UVk`~\r\221j\002,d\0349o\322\314\360Y\271\374\"\363+nF\034\232\320\"\223\365t\256\004\224]\227\354\223\374\227\f\225"
+	.ascii	"\026\021e\362\031\366\346mJ2\312\344\023.\356\026\253\032\230"
+	.ascii	"\342F\346n\374\2157\245\362\360\r\t-\2442)\303\f\177\347\251"
+	.ascii	"\314\026\331\265q\237\230\250q\324\240JI\307\357\224Ys\016\211"
+	.ascii	"\177\254\002\241D*\223O\207\201\314\311x\f\336\034\313D(\021"
+	.ascii	"ZN\224\311'\221K\366T\376\345v\035S\224a:\327\310\236\315\277"
+	.ascii	"\231\250q\334\345(36\346v\271l7\314-\273b\256\226k\346~\271j"
+	.ascii	"\367\314\345r\317\256\227kvc\270hn\3632/\230[\346n\271k7\313"
+	.ascii	"%sa\270i\027\315\231\227\354\335\372B\271Qz\260\210\316\034\022"
+	.ascii	"\240W\200zP\t\001S\206\255\\\260\033v\305\234y\307\256W;\230"
+	.ascii	"[it\354.oW\256Z\222\204\273c"
+	.string	"7\353n\211}\271\3404r\307\356WPn*\323$\211v\307.\225\253\364&\222\234\221$\242\240)\223\317\\\034&`1\360\240\335C\205\273\207GW\367\303]\256\273\365\336\343M\234\257#\376\f\342ji F\225\221y\264{l\340\346\201\303}\225\335/\303\235\362=\374\371\005\212\224G/\326Q\337*\0040\325\320\036\325\361\314\301\267y\340\340\241%\025\037J\357\013\035\200\254\216\020\317<\332<l\330xs\334e2E\323\223\263\311ur\257\002\355\332B\250?\254-\017\211I\204\022zk\322\211\336oF\213\241\356\371\202\353o\205\201\233D\t\007J\230\220\241k\023\022\210\220@D\332&$8:\222\240\304\021\356\022G\267my:)\204\0029VM[\225\025a]\362\265\230\025\241e\327\023\326\037fS\340\013\337\013\264\005Ru\235\024\242\355\t\203-;\202Ue\254\255pI\350'\004\366TU\027\\\177'"
+	.ascii	"UU\307\006WV\370SU\214\364\363\225\240\252)\373\3631\261\252"
+	.ascii	"\252\373\001}\254OiU\325]\253\0069\200\264\006yI\254\003Fl\353"
+	.ascii	"sa$\374\301p@\206\360\347Sr\200D\t\265\204\t\031F+\222P\251\367"
+	.ascii	"\363\031\005Y\241Q\004\255\214\365\247\304\373\005\327\366\347"
+	.ascii	"S\223Z&U\r \306\032dR\325\264e}J\252\232\252j\032\344%\365\320"
+	.ascii	"\025\005\037\253\252i\t="
+	.string	"\240\022\272\242\365\375|\351/\345\360K\001|\341K\201\304[\203<\301\366\203\336O\230\202\327\362P \361V\f:\260j\214\025\305/\205O'\205\b\256JH?\236\212\241\366\367\342Y\265\267\262(\241\307s\241\244\304;!\344ke\254h\313\252>\246\026/V\024\352\212\017Z\364\254\275\037\257e\177>\334\252\036\254@\177\276\017~l/\3651\261\227UO\214X\321sb\304\212]\332\033\341\273B\027\035X\225\003\244\240\340\332\262\274\245\224e\327 \022\022O\267\306\340)a\241\032cEb\205.0\253\256=_\214\025\005+t\321\263\252+\323\214\020X\241\213\335\3124\243e\205.t\254\320\305]\225x=6\007\f\256#`]\253\216x\200\025\002}1\326\340\007\033N\340\2618\201\242\002\036\335\032\024\266\274\340\312\264\264\266=m'\205\0202-\251\f\254*\013\021\020\210(!dZ\032\022*\001\3315\310\303\252"
+	.string	"\254-\204LK=i\253$dW\026\353\206U\345\251A \373[\331\237\037\f\237R\005\273U\365AA\205\006=3\220x+\013^\313C\332\005\331\027j\022\f_\222\352\363\202II\303\013&%\025\205\244\022F<\240&m`\231\200A\024\301\025\311\027\303\207B\310\264\004\324\2520x!"
+	.ascii	"}:\030\274\020|\255\214\013\332\337\n!\323\222O\253\232\320\365"
+	.ascii	"\326\026\030\374\340\004\240\322\213\340\032\303\003\266\303"
+	.ascii	"\252\376\254A\336\tHA\236\n\rm'\205`\223Z\336\222\321\017\270"
+	.ascii	"\264\004\354\t\320@\2465h\324\002\201A\243\236%gU\225\351\305"
+	.ascii	"\220\f_\260\345q\360\003\372Z^\013\f\376"
+	.string	"\004\265j\211\243\366\347\023\342>::a\200\b\035`\200{!z\277\031\254j\004\f\316\200\321\353\361\214\330\340\032\303\027D2\372\371xKF\275 k\024b\001\024T\254-\217\305\252\304\264\304k\321\353\361\200\224\200@\013\324\\\317\231s\351\244L\"~V\347\314\307\263/\035\263\037)C\3022\030\356\353\346:\373\276\351\373\346\276\341\234\263'!\303\366|f))\020?lX@\343\272r\372\276\025\220%\352\355\306\321\261\364\321\302\243\027\316\035[\242\031o\232K\006\312\017.\217\266\006#\356\376\202B\250R\3110\f\342\234B\b!\221\031\232I\222\016B\n\020\206Cr\026\347\264\007\022 E5JB\307P\315H\222\224\244\260\307v\371\361\201T\036\030\034v\367\344?\317`\021ASa\371qg\262Y&a\030(\337\230\"\3272p~\204\267\336#\240\203&\0131H\366V\033\355}u\240\223\241^\003{\244"
+	.ascii	"cr\222\365q\230e\323\205\220\315!D\2168\277\371*\333\250l#\003"
+	.ascii	"9h\303\204\205\\4\233%\020+;t\266\347\240r\371$\377^\235\305"
+	.ascii	"J\212\314 \364"
+	.string	"L\340\245\226\35349\007\202\206\372\330\304*\r}\370f\316C\202\343n(\332\374.\363\226\206\244\032\360\364\274\201\007I\205\333z\227\264\265\276\334z\004j\311b\246>\275z\001R\304\246\322\372\214\003\253no\340\374TMj]\255Y\322p\275\033\347\263S\207DL\\\322 \206.\214\003\204\240~\342\334\302\241fb\f\t\216\001\325>\330\bNl\353\334\2755\256\260%\031Y\246Y1\n\326\373\262\244\245Wd\224\005\372\313\nq\227\330\003m\376\245o\001\246\374\327\3113!\327\221\223-\260\315\211\222\267\321\203\200i/\374\"\311\016k\375\200\3439uKj\265]?mX\316\312!\007\371\212v\007C\332\372\267\211\361\354\253.\250\037\231L\016\3206\232\301\272b\n\352\024$\256\210\026z\315\372'h\007%\260\374?1\370\227Q\333\322\261\021\370\360\215\212\355\006\036!\372\237\023g\373\024U 6\207r\376P\317"
+	.string	"9%X\374B\307\001\360\242\021\020\257\237W\221\345\215N\362E\315\256<\025\316\260\272Q!\274\317\2002\205$\234\216:\271\216\233\016\225\021Y\374\344\350h^@\230\356E3\037f\220n\265P}\006O\rNA\021\373lJ\f\216\002\b-`(\362\261\340\306\324_\030\025%\020\314\266]a\357B\2022\220\036\313\234%\017\r\264\324\362\340\206\326\204\332A\326\2551\022\361\n\304jiz\303\r\303\342\206\023o\317gR\020-\244\205S!\324\351o\rq\271l(*u\334X\373\35574#\\\242"
+	.string	"\345\361\020\237\236\240\262\320\350\023\035\f\240\257\322\330Am\300\276\036\251@\270\302bLN\252N%5[\034\022Yt&\326%\265\324q\"\020\353\223\251Dix\212'\202.\341i\243\036\273l\233\265\211\256\341\246E\261\226\365\216\n\346\013\303\202x\005\036G\235\243\216\302\314*\247\247\265A%/.2\344\263`\323@\300="
+	.string	"\235pj\220\022T\204Z\f\300\371\323\t\263\312\004\353\277Y/\023\fr\306\203\r"
+	.ascii	"\006\246@$\207\n\0247\020\277\362\352\"\033x\351BK\325\"\277"
+	.ascii	"\336\200\243\270\341\t\030("
+	.ascii	"\364\006\251?\242}\007I4\241J\033\b\\\025>y[\0033{\326\206\313"
+	.ascii	"\371u\020\216\026\3546hf\351\222\374&\2670?J\340v\"\025I\236"
+	.ascii	"\332r\373\n\026\020u\333\341V.\227\334\032\267\261M)\034\023"
+	.ascii	"\233\301=^\025^\317\004\r|\231h\242\021\350\023\204\035\234\226"
+	.ascii	"\322/\200\200\342\303\013\337y\340\215!\n\270\244\24369w\267"
+	.ascii	"A\210\371\203\200\356\234$&\003\342\0358\261\226\334\305\024"
+	.ascii	"B\315\016\033\300"
+	.string	".F\013=\022f\245\310\253&\022\373;\334}\263Cp f;\277\312\327\270\"\324\261\322\260\270\002\3359\031|=\3004J\016\227\305\322\337\312\217\326[\333~\300\300\317E\350\353\t\251X\202\021\034\235h\205\233\371GZU\310p\226\020\200\336C\030b\212\306=&\263v\213\032\303\006%IV\306mp 980o\265\206\236\312\332\242\274\264\274r\303=\326\317\007(&\235\033B\006\035i%GpzE_\223{\021\270=\026S\340\242\374\203\333E\206\366\201\260.\203\013L\272\321\352\376\362J\3739\375\277\357\r\270\255\n\201FV2\236 \036p\347\364\316\247\373p&\275\303\240\345\003\025\f8!3[7$\230\250$U\034\220\232\2746+y\364\363xCv\177\203\213\021Nv\233\3515'C\371G\334a\221\t\374\316\311\217\324\233z^\347M\206K\003\331\033\032ABx\f\250\235\301\035\036_\331\271@"
+	.ascii	"\351\347l\331\250\275\r\376\252\366\236\337\013\17729\210:\322"
+	.ascii	"\206\006\036H\314gf\213\364R)\241\346?\3404\332:\275\"\214f\341"
+	.ascii	"\215#`\032\332\310E#\035\253sEN\323\307\342d{\256\020\021\\;"
+	.ascii	"\301Kv\320r\255\217\357\350s\251_\362\261\247\227O\314r?m_\031"
+	.ascii	"\363H\331\005'Z\001"
+	.text
+	.section	.gnu.lto_.symtab.cdd500bf3176390,"e",@progbits
+	.string	"gyroSyncCheckUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cdd500bf3176390,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1018 @@
+	.file	"display.c"
+	.section	.gnu.lto_.profile.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375 3\231\001"
+	.string	"/"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	"\002"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	""
+	.string	"\006"
+	.string	"\007"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.string	"\017"
+	.string	"\020"
+	.string	"\022"
+	.string	"\023"
+	.string	"\024"
+	.string	"\025"
+	.string	"\026"
+	.string	"\027"
+	.string	"\030"
+	.string	"\031"
+	.text
+	.section	.gnu.lto_.icf.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\275\n"
+	.string	"\324\020\317\001"
+	.string	"\032"
+	.string	"\300\320\222\371\005\004\002"
+	.string	"\002\001\002\002\002\003\001\320\233\373\266\b\f\002\004\002\005\002\006\002\007\002\006\002\005\327\304\205\304\006\b\b\002\003\002\t\002\001\002\n\002\001\003\312\337\356\336\007\004\004\252\343\367\225\007\002\013\002\003\005\235\366\313\304\r\f\n\006\302\264\200\023\n\007\224\312\272\240\r\006\b\213\314\213\214\f\002\002\n\002\007\t\340\337\203\343\005\004\002\006\002\001\n\257\346\362\241\006\b\f\002\003\013\305\351\254\360\003\r\002\003\f\301\343\227\272\003\007\002\016\002\003\r\336\365\267\361\r\016\002\003\016\366\332\246\320\b\004\017\212\251\337\324\017\017\002\003\020\322\317\311\210\n\007\002\020\002\003\021\305\350\206\363\f"
+	.string	"\022\211\271\240\321\r\023\301\211\376\332\t\021\002\003\024\232\204\335\302\b\001\002\022\002\003\025\330\322\233\207\001\002\023\002\003\026\257\257\332\372\t\001\002\024\002\003\027\302\316\266\331\006\017\002\003\030\377\271\306\315\005\007\002\025\002\003\031\343\342\314\335\013\n\002\001\002\n\002\001"
+	.string	"\037"
+	.string	"{\300\340\006\340\264\326\003{\300x\b/0\207\200=WG\201\264*\200 e\016\bH\207\3611\023\034\035y%\026@&\031\273h\235\001"
+	.ascii	"b0\256\025[\2010x\245\330\240(\311\274\232N\nQ]p/\207\024\300"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`o\001\265\006"
+	.string	"\302\210\027\032p+L:\300"
+	.string	"p\001"
+	.string	""
+	.string	""
+	.string	"\300\205_G\372M\341\373\355\211\021K\266L)\256\372\n:\030MX\371\004\341\341`Ue\260\255\300\030\222\b\006\004\216\017\230\232e\255\t\244\307\362U\230\\\302\270"
+	.string	"\n\025g\211\255\354\315_\273\352\253\263\364\310\247\263d{\232\206W\007\245\221\256\366.8\2064 \240\002!\261\341\r`R\360m\201\026\256L2]K"
+	.string	"!\357eK\202f\332\016\0201\204\235ff\336\312\031\030\331"
+	.string	"\020\035F\306C~\005@\016z\247\267\360!N\305\016\035\027"
+	.string	"uE\241\322\f\247\305\215\350\303i\366\002I\304"
+	.ascii	"#J`\210-\220uWm\203\325\205\272B\314\300\2457\025G\"\314\022"
+	.ascii	"g\245vWLU\361\205{\274\330\214l\003\301\n<\004"
+	.text
+	.section	.gnu.lto_.inline.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\f\b\265\025"
+	.string	"6\234Z>0\215\223\306"
+	.string	"p\331\366\035_\"\375J\255\252U\3053\037\1770\374\220\202\231'\247\277LSh\376$\304n\305zX 3\330P\350B\307\212Bl\177\361\233\311\261\251[#do)\245L\001>"
+	.string	"K"
+	.string	"K"
+	.string	"iYg5(KS\224R\217e5\276lt\240_$\342\370tN\342;rh\351\275g\031\377+\313?\343\366=\017$\236\247'\337\243\357\275\347\366uM\034G\220\236\210D\020q\371\214)\007\235=\253\340\275\267\340[F\342$\242c\001\207\221\b0\340\224!\f\271)E\267\361\243\fH#\016\324\324\364\230\352\244Z\342\275W\355\376$\210v\344\206\367^\346\206i\033\017\357\275\312\213%e\375\312\254\375=\271\034\t\"\007t:\007\025_Yf)\353\305\222\304$\004\205\335\322H\f!\001\247\221\"\324\021\224\357B\210\211\312\030\013"
+	.ascii	"\305%7\025\226M\033f\313W\326~\r\245R\2450@\242vX\\\371\225\312"
+	.ascii	"\307O\233\262\361b\036\355\334\215s\rd\tiD\202\007[J+ \021/c"
+	.ascii	"\\\331\376e\177=\372\340\343\303\204\312\3339\267\343Zb\006l"
+	.ascii	"\031:\201k)z+\200X0\321\314q\022F#$,o\2762\247\037\244Q\207\352"
+	.ascii	"\213\021' \234Tk\322az\2344(\241\330\242b\342\214mK\3250R\022"
+	.string	"b\035\200\227\250!U\305\206\244$\0055\262\214\001p\002\231\021\2629\017\022\200\204)F\322\212(\203$F\002\211$\220\t(#\242\264\240\003\361\272\025\251\2352LJ\321\220\272\262u(\362\341Q\314\220l-\244\364I\225[q\337\224(]\030\235\3273\226NQX\211\343i\352\350<\203h\013N\241\272q\025\263\231z\272\006\020Bo\370M\017\307x\335v\251S\255<S#\337\305\273T\243\276\324\b\207'b\317\232K\246*\027\250\034oF\364l\254j\350*\247\245y\225\326\277\373\372\322h\364\313\340\310p\236\343\361L\307\341\034_\261\270!\302\337pm\217\033\220M\300'\303\277\356\372\234\323A0\240\320\341\373\3465\210fH\216jT\331P.U\004\374Ma[\260\370\254J/:\272H\023D\274\245\374\200\232\320\021d\t\235r\275\237\352\210c~m?2S\270\027\326\"\221(\254\236\271\r\013\341\240\334"
+	.ascii	"FD\330\222\201\225\217]j\033\313'@6\303\347\256R\255\300O?\243"
+	.ascii	":d\320i\370\343[\233\0024'8\267\244\260V\271C\362\257\266\\\224"
+	.ascii	"\355\367l\240\237N\220\001Y\3610\024\354\344\320H\375Rh\342\030"
+	.ascii	"\334\357\234]y\356\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\005\003\375\b"
+	.string	"\202\313\"'\200)I\007\234\004MPG\310\204L\2419\0033D\321U3\031\261\b\267\377\r\370\007\376\257}d\rY\322\332&2\3555E\304|`_\270n\210t(\\\002\302\365\343\300\035\020\007\254%\r\333lp\255%\245t\255!\343Y\320\334x\022\240\201\345\206@\300\0251\256\247\025\253\261\201dX$\215(\f\313\260\263\022\377\001@\213QR\b\262+\317\225\263\347\211X\b\273<\277V=\221\260\252\264Gm\217\353\252\331\374|1\324\251\b@\250\361t\2636\005\205Z\303\030\260\002\t\210\254x\022 \323\034E\221\034\303Q\312Xg\244\211\331\260<[3\304\244\332\304p\020B\004\013\340\020\263\027!\256\2603\207\376P+^\327\266\030\3062Fa\252\004+\307\203\245\214\002\213C=K$O"
+	.ascii	"\022g\311Hb\375\232\032\254\251\333\377\005i\3172s\322?\026K"
+	.ascii	"K\307\341Y{o)M8\224sn\357\305/\255\205\023\323\027j\307\3310"
+	.ascii	"L\244\020EG5\025\035\271@\032\3571\314\235n\004v\257\236"
+	.text
+	.section	.gnu.lto_.pureconst.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375 S\r\002"
+	.string	"2E\017\025\200/t>_\231\22090\022\343\362\200\003\t$\220@\0226\356\367\232\326\254&5\247)\315hBo\317tf3\231\271L\345&\027\271\307\232q\213K\334a>\205\033\\`\036vwY"
+	.text
+	.section	.gnu.lto_.ipa_modref.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`L\003=\n"
+	.string	"\262J%-\200\267\35130\003\233\f\206\303#\215\034\230\200\271 &l\003\302\300\240\240\300\300F$$\235\377w\233\375\377\337\377\357\267/\377\255\355\224R\215\r\017\227\323\306x\230\336\252'\371\242\340\310\202\022,\b\225\003\3125\241$\021}\304"
+	.string	"Z\220\266\017G\301S\0027\036l\200\221\301t\306\275\205;\247\025w\246\271;\002\320\337\264}\205\320Z\246\267Lk\325\337\351\322\013Q\027\246\261\332\016x\204\306\242\273"
+	.string	"\016\fwM\335\315\274]\273\326u\337\335\351/\246\211\266Y\b]\2501}4\246\246\275\003\320\002\0211\252\016\021"
+	.string	"\2357L0b\"\222\241\234Y\326\343\263"
+	.string	"\330\264\335W\362$\377O\013Bv\373\024t\207\236\307\206\r%\303I\202+\252z\350*\202\353\030^\021\024C\210C)\327E\230V\202AfD\t\370F\332\322\205\026\305\035\272\344\246\214\374\002_\nnI\003\3626f=\325\351[p@\"sp\017\022O\274"
+	.ascii	"\003\373K\200\246x\341\021\252\263,c\244\310\262\034\025[\245"
+	.ascii	"\023\314\262#\341\342}\270\316\016\0045\"\202\005\247\320\322"
+	.ascii	"\206\370M\250\235\225\216\033\031\261\202\341b\0254\224\363c"
+	.ascii	"g\254\3336\240\002"
+	.text
+	.section	.gnu.lto_.lto.154d1cf003b5b972,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayClearScreen.3.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\315\n"
+	.string	"V\024KB \251*\035\b\030\t\001>\234\007\r\273"
+	.string	"\336,\035\347a\031"
+	.string	"K\354{\351#!\236\3357\004[\303C\321\004k\344"
+	.string	";\b!\021\026 \220\001\f"
+	.string	"\020\302\003\325\3002\202\"|k`\022\311&{\247\0245"
+	.string	"8"
+	.string	":"
+	.string	"\273\343\205-\270S\217\217\330N\271?l\247\026\355\t\023$\f0\223K\266\273u\016\270x)\372Gp\312\t5\272\\\310\330]\313\023\312\344\236\267]a\033\303\276F\363\022\f\244X-\222\234\331\343H\316"
+	.string	"\366\265\335]O\225\375\326\257Mi)\245\317m\230^\020\017vKf\0256F\033\024\250\330\276\264\277:K|Kt\207]\225\003\006\001\251\325\317\331l\357/N\003\204*@F\201\"\265i9]\001P\232#\333\337]\036\334n\351\342/\020\tC\333\251\234\022\021\374q\005!nw/~\002\020\bG\340\324\027m\247\017]\246\203\371\204\035\217s\306\022\202\341\360\204\236\246\206`\007\362@M\355x\230\216\232\001\303j\241\360\347\351\300\372\371>\260V\306\275\266Sez\022#\315\021\213\337lvw\330f\302\016\004\020"
+	.ascii	"2\241O/0\\\020\224\312\207\364\366,l\0345\211b\260N\251\3155"
+	.ascii	"\235E\312\204Q0\352\022V\263\032\035\356\360\242\235d"
+	.text
+	.section	.gnu.lto_displayDrawScreen.4.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"U\t"
+	.string	"6RB;@\305(\035\240\336\372?\217\257\375\253\203\363b4cj}\217\221$\343`\356\275<\332GY=)\372P\033\005m\365[;\206\231!\307\340\212\254\343\201\352\025\3441Ad\223-S\n/"
+	.string	"."
+	.string	"3"
+	.string	"\016\217\311.\265\027d\227\006\355\226\203\212\201\025\213\026\200\335\235q\343\340\025\364/\362KJe\272\n0\354\2565\245\302\270\343m#\330^\260- \366\261\335]\307\225}\326\217E\265\252\372\331f\202Q\331\275x\rX\227L\361\330l_\355\203<\004<\253t\202\335\325\t\312n\250\340\004\3552\321[\006*\232lwo=h\273\250\215_2\361\221\262K\215\006,\2068\tI\333\335\215?2\212\3208.\375Rv\371\230\351\b\300:\351\313\016M\0325\002\237\016\210#\372@\234\346\216F\202\323\020\3728\317\374\274\317\210\363<\023\304q\034f\307\373\246&\343.\364\361\246\250\353\274\271\205{l\343\312\362\303u\212\024\276(\026\255\001\013"
+	.ascii	"2\2417\034\330\270\360\224\332\334\322YL&4\202)\227`\233\325"
+	.ascii	"\224p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_displayScreenSize.5.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\215\t"
+	.string	"\246\022C:0\345(\035\200\213'\005\034\264AU\270i\237\354\024\3424\302\273\240h\003\353X\265\206\373\\\213\rFc6\212\232\376\031\021$\b$!SN\340\266K;\021\n\023\2737\3312\2452"
+	.string	"/"
+	.string	"2"
+	.string	"&\240\355\002\221\221\211\300h\254"
+	.string	"\330\335\215\363\315\274\314N0/#\310\301+\350\037\345\b/\330\212\205\272f\036v\327\272bq\334\361\266\023l3\330\017\b\341\237E\265\252\372\031\201\216Mlw#\026`cd\013\211m\320\326\330\276\332w\375\004|x\372\300n\353\205e7\\\260\202v\351P\263\355\227<\036\252\210\262\035q\230\350u\321Y\314K\215\007\236\270\312\247\355\252\032\374\024\023\2056r\351\237\346\345cA\210+\2451;Di\374\260\237ml\331\231z>\241\317\310S\372F\234\346O\247\302#A\3728\320\366y!\023\347\201\266\021\347\021m\037\357\333:\006\356H!o+u\235\267i\302\275=#'\0251\254\321,Z\343\214\016\001\r"
+	.ascii	"2\003\3020\005&d\220\035\330\233\322\\q\3062\327\360\207,^\003"
+	.ascii	"&\036\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_displayGrab.6.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`/\001\225\f"
+	.string	"v\327SA\020q\233\016"
+	.string	"K\264{8\002D`\b>\312\177\221\255GM\331\034\234\025\200&\003?\303#\342\353\021\361W\030\025\266\030\266\240\021\273\252\252*\337!}\336p\215\032t\335w\364]\266v\333\335\244L)@"
+	.string	":"
+	.string	"E"
+	.string	"\"\270\213D>`7\244\262b\267\3338A\374s\367\002\360/\236"
+	.string	"\3743g\3070`!"
+	.string	"\214O\n\215\335\255\224\303\271'\347\177\304\001\200N<\317i\301\356:A'\030n\275m\004\266\025\330O\021\177W\315\007\026\321H\216\354\316\223\272\301\276\264\273k\r\331\027\375\027)\035_zzi(\245\237\246\245L\253\2463\323\027\2001\311\264\330\2750\252\261+\217\205\007\312\366\323~\210\007$9\362S\250\233O\213u\024\327\323\003(,\022\203\253L\310\244\023\252\032\024\020T^\324\251\2464\224\250\307\266\203\247x\304\335\022\016\337D\205,\004\376\245f^\030\302K\204\304\335\345\360I4\330b\207?_\004\006\227\325\341\200l\035,\332\332\240\300y\360\261a\035\325\246]\0220\255\243\352`\034\217\312\322\266jC\343\354\343\322*\220,\323*\252\333K\253!?\031+#J\342\250*.\214\213\203fL\032\365\237\226?\002\204:\351M2\004\032"
+	.string	"2\241+h`<\020\022\001gl\343;\344p\231\0011\266\201\201"
+	.ascii	"\257`3\330\216\n\245\021E\b\360\323\202\tSI\013\206\353\224\332"
+	.ascii	"\334\322Y|&4\001\306\\\202mVS\302\035^\264\223\f"
+	.text
+	.section	.gnu.lto_displayRelease.7.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\327"
+	.string	"u\013"
+	.string	"&VN> Q\233\016\f\215B\344\320H\002$\234\230\250\350 \002 !8\026\004\201\201-\016\217\020\2316\026S\3634\033e\227\332f\037\004\020\004\002r\033\323]B\261\262m\f3Q7\332\335\244L)<"
+	.string	"8"
+	.string	">"
+	.string	"\027\260\033B\221b\227\243XA\3743w\002\360/~"
+	.string	"\374\263f\2778P!\300\214OH\214\335\235\224\303\265\247\346_\304\001\200@<\317\r\006\273\353\004\201`\270\365\266\023\330^`\237\023\327\311\366a\353\310\316\346<\251\033\354G\273\273\326\220\375\355\217Q\032\276\364{\351(J\253\2463\323\227$,\f\254\330\275\320\321X\221\247\302\203d\373i\037\304Ch\3378\002\372\364\0262xdg\325H)\237\021\352&\032\250\"\330dH\031\325\251\2264|\250\307\266\203\207h\342\356\207\305/A\341\352\300\277\324\002.\f\341$:qw-\376\b+\213\035\376|\016\370\027\024\306\272p2\253\212\306T&\\\036l\262*3e\030%\241\3022\223U]4\023\006\313\246\312\304\327\206\302&\316ua\223\304\355\243\325\220_\r\221\016\3650\324\023\222\026\007\301x\n\365\237\221w\217"
+	.string	"\243\024"
+	.ascii	"2\241\213/0.\020\302M\302`$\344p\231\t\004\333`\220\0266\230"
+	.ascii	"JZ0\\\247\324\346\226\316b3\2411\030p\t\241YM\twx\321N2"
+	.text
+	.section	.gnu.lto_displayReleaseAll.8.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"%\n"
+	.string	"\226\023G=0\345(\035\200\223\251\207e\376\346\302\032#Q\020=\261\225\036\026\210w$\321\030\335\266\365\033n\243c\265\301h\024ZQ\323?#\202\020a'\340Ey\210 \330MZ\2364\262\311\336)\0052"
+	.string	"4"
+	.string	"8"
+	.string	"\334\251\305\027l\247\334\t\266S\207v\200\213!{\225\f\214Q\266\273u\202<\274\f\375\237\\\303j\245.3\016\273k\311jm\334\363\266\023l7\330W\b3[L\311\371a_\333\335\365t\331\177\375\332\224\226R\372\231\215\003\346"
+	.string	"\266\2531\033\2601\3722\262\261}i\277\344&\341_\250\017\354\272`-\273\"\203\027\002\0021\231\326(\023\240\221\332\264\234\336x\254f\312\266\367Q\202\333]u\374\025\013\360\264\235\312i"
+	.string	"\300\023O9q\273\333\361QL\024\234\310\251\217\332N?\247\313H\362R\311\241\317\310S\002G\035\347\017\247\302\003A\002;P\005\277\220\251\373@u\324y\"\352\347\003+\007\301\036)\364\325\222\347}u#\356\265\235.?t\304T\363\302\276h\263\273\263\210\002\016"
+	.ascii	"2\241\003/0<\004-\354&5\237a\260Y\251\0351\035pe\202(\030u\t"
+	.ascii	"\253Y\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_displayIsGrabbed.9.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\345\013"
+	.string	"\326VSB\020q\224\016\033\002H{2f\023F\036\230\240\024\034\"/\274\022Q\260x*\277>\240\261\307P\260h\365\373W;\026\322\336\001\"\333U\001"
+	.string	""
+	.string	"\232A\352E0\016\332G\332\2360/\226\240\275\267\224)\005C"
+	.string	"?"
+	.string	"@"
+	.ascii	"\313]\032\342\244"
+	.string	"\303\247I\362\177\362\247\202b\001\262\225\016=\374=\002 T:$X\031\241a\3314\244\276\013j\305\n\300vz\230\225\311\207\237<C6\217\314\016\b\273\353\004\3318\334\361\266%\330n`\377@\251\351\307Hbe@\267+\322\341\330\030\320\305\b\333#\333b;\323\276\211\237\030]%z\200\335\324\213\224]n\2011\326\241\271\013\210\207\326/\361\320\266\0318\030\231tN\204\310G6|\240\330\330]\204J\362JPRj\274k\361\372\022*`\270\302Sh\326\356\351\201\217\002\203\005\253\344\360\212@\206\312\224\335se\202j\241\026E\325\b3Ny\303\346J\251$\366\337\356\2565ex\325\257/\035\235\215G\023\322<\230\345M&\203f\002H\3038\227\226u.`\031\347\362`\032\n\327&\323\256L\001\177@\235\354\n}>\331e\341\366o5\345|\n\236\212yj\210m\250\006L\352\341T\250\377\310a\312\021"
+	.string	"M\204\336\031\341\265Qd\210\3235X"
+	.ascii	";\202\350e4\233\300\026\320\275\226\260>\027T\212j?\261\314\f"
+	.ascii	"\022\032\275Jc\2265\367"
+	.text
+	.section	.gnu.lto_displaySetXY.10.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\305\t"
+	.string	"VRB9@\217\322\001x\255\022QHr\204\262\336\254Y\213\220\246\324\177P\\F\227\333T\255!\263\\\240~\266\025\320F}\216\243\270\020d\232\3533H6%9\271\216\222\306m\367N)/"
+	.string	"3"
+	.string	"0"
+	.string	"'\330>\271\017l\237\016\355\227\327\217}\254\225!\213\331]*=\036>\206\376c\007X\261R\217\233\207\335u\\\2616ny\333\007\266\035\354#\004q\263\315X\n`v5j3K\233+!\266\317\261a\265\006\031\355\005O\370z\262\334\345p\361<\332\0379I\370\027\352\002\273.\224\331nUp\002\367\351\032\322\006\177\"#\245=q\223\023\267\273\f\276\354\242\"\240\005\004\265}\316\222\024\221\226*\326\354\232\212\262\303\276fw\327\322e\037\366\317\327_\376\365\007\246[<\364\021u%P\344q\376tL]\004\t\364@\024\374B\024\336\007\242\"\257\223\240\237\017\244\035\003\217H\241\217\226F\243\217r\352^\263\322e\b\025\232Jbx\006\022"
+	.ascii	"2\241\033\034\030.\250\243|\201&4\025\016[\\\r\023\326\270\006"
+	.ascii	"|\303\030P\016\f\006F\360\031\026\314\rPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_displayWrite.11.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\273\001\345\017"
+	.string	"\306^kF\340\262(\035\341W9\316\343\030\007\210\314L\026\034\205,\302S\n\301\230\335yI\221B\351\020\036\257\266\330\260\265\021\370\227\330\265\224\374\257\221\0341\306\r\353\017%uC*\264\201i\004D\266W\303\017b\311&R\246\024S"
+	.string	"T"
+	.string	"["
+	.string	"\326]\030\036%O\3733O\001>l9\200\335\030\035\027\273\341\001\033\350\036\035v\266}\231\243"
+	.string	"\355\031[\030\202v\017#d7?v\327\033y"
+	.string	"\356q{\211{T\020\007\237\240\177\235o&8\370\230\321^\317O\203\335u\316h\031n\275\355\002\266\031\330\351 \032ck\232t\234\177t\233_\364\360\017y\315\037z\316\017\322t\247\351\217\246\271.\035?\351\215K+\227\316\230~\211\273\221c"
+	.string	"\216]\f=Av'\302(a\033\264C\266\267\034\013\002F\033S!\263"
+	.ascii	"\307\365\321\302tlP`SK\240i#(\001_\343\n&~\214\225\b\235\n\367"
+	.ascii	"\030\225\200\210\031\333\364\027*\335\246\221\246\306\211\031"
+	.ascii	"\221\332\247\267\21044\200tP\265Qg\341\352v\327\304_!a\202h\007"
+	.ascii	"\211\026\3561yf=\364/0\260\354\3615Uod5\227\354q(AjS@\311\317"
+	.ascii	"\256\"/6vb\372\262\303W\352\007\373\333\006\254\177\255\226i"
+	.ascii	"c\371\205\243N*S\213\245Ju>\221\260\230*\244\260R'\036\353C\255"
+	.ascii	"\244\276\023O\2252\241x\247\217\345\221\210x\225\202\372\274"
+	.ascii	"\326j\365y\241po\223t\304Ea.%H9\375h\247!\352\250$\335V\203\276"
+	.ascii	"\034\322N/\253}\364#\345\364<\262\332\203\313\200\320\355\306"
+	.ascii	"\002! \260\242);\035\"\340\207}D\201\2203\334\035\261\362\250"
+	.ascii	"4%\025\005\310`\2134\r-s@Z1fA\356\005\341b\226\004\202\204bO"
+	.ascii	"\244~HDy\201\307\027~`y|\220\374\030\314#\370a\231+(\\w\237\336"
+	.ascii	"\212I\020d"
+	.text
+	.section	.gnu.lto_displayWriteChar.12.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\243\001\005\017"
+	.string	"&\034cD"
+	.string	"\261&\035#\0234\335\2238\027\203\366\273z\372\317\177\232\342\3468u\270\306\364\264\256\374\245\007\336\266!\274\376N\233\344\355\324\230\2121J\377\377\377\307\020)*\030\222^g\225\231|o\027\272\267%{K\231RL"
+	.string	"L"
+	.string	"V"
+	.string	">\354'\270w+\007\355\276\334\260\330\355\022\030A<t\027m\37317\301\3311^\027\342u\0170,(r\354\256&\362\001\331\341\273\200\354PA\234{r\376S\374\225h\321q\275VO\217\203\335u\272^\032n\275\355\003\266\033\330I\022\257\371Cn\363\177N\363\203\274\373=>\363GM{4\235i\032j\372ei\205\351|\351\007\310vj\020\220\261\233!\266\2634\240\013\022\2669\373\303\266\211aP\323a\001\215\352"
+	.string	"\266e\303\245@\323&)\341>\243\262\356\272\350\224<\0359,;F\207\361 \356^0\361_X \305\0245 \002\306r\204\267H\211\251P\006G\007\fDm\224\257\200280\034\3246\375F\025w\327\304W\001a\302\347\306\210\225\3540s\\8X\031\363\257\312\242^O-30\270\2642fw\253\324\017\366\337\352\213A\001\242o\251T\350\251\274\302G\242R(\205*\221\242E#*!\t'\024\351DCm#\n\244\355D+\221B(\232hCi#\005l:\2156-e2m\332G\267\267A*\302\322\226?\371\024j\246\036\365P\253\202\364\355\006]9\252'\013Q\250\377\350\323\007$ \300\"\032\243\036\"\340\207-b\020\006{7\230\211\274o\304\352\243\322)\201\253\320\004\013\312\274Y*w\2269\246:\203\204/\205@\337\302\363\206\347$&Y5\f\274"
+	.ascii	"\025q\234\201\311\3058\007\206G\037\301\205\375\\\301\360\337"
+	.ascii	"}\342VL\202 \003"
+	.text
+	.section	.gnu.lto_displayIsTransferInProgress.13.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"U\t"
+	.string	"\206\222B9@\217\322\001\230NL\267\025\200\030\2248D<M\200c?\002m\232ui|\264W\177\027m4\030\215\331\260Q/\351\030&\3261L\240z\301E\250\223\277%vo\262eJ\0010"
+	.string	"0"
+	.string	"1"
+	.string	"\001\363\322\266\027\032PN=\374p\235C\345B&\263\033r\321\343\251k\312\277\311\265\021\r\227\326Ku\325@\354\256\265\365\302\270\343m#\330f\260\357\277\246\2515\252\257\321d\300\020\254\354\272f3\373\"[Dl\243\354\215mU\373$/A=v:\300.,\206e7Tp\302v\351\360\002\363r{Qe;\342\262PJ\205g\232\227\032\r<q\024p\333e9\370'%\212-\344\322?\315\313\307\001\220\330Jgv\250\322\330a_\333\335u\204y>\026 \217\250C\002E\335f\017\307\324\221\030\201\335\207\003?P\251\373>\234\250\353\2048\317\007r\234\002{#\320\307\221<\357\3436\341\3363\036\254\242\2057\252Ek\234\361a\203\025\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_displayIsSynced.14.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"m\t"
+	.string	"\206RC<@\305(\035\340\345\376\031\300}\361\222$\021\364\2301\271\237b\032R \246\231\001q\026\255^}\247\352\017\265\261F\266\372\255\035\303\314&\003\236W\214\310\337\350#\024\224\330\275\311\226)\0050"
+	.string	"1"
+	.string	"1"
+	.string	"\004\362\321\266\035 L>\375\013a\335\243E\003F`\367\233\020\344\247\353\311\177\3123\023\216\330\252\205\272b&v\327\272jm\334\360\266\027l?\330w\177\226\251\025\252\217\301\224\b8\030\260\313\212\025\330"
+	.string	"\361\205\304\266\311\316\330V\265\177r\024\323_\245\017\354\272"
+	.string	"\270\354~\rf\320\036\375\275@>j\017\020e\233\342\260\017\013\006G\222\217\n\023l\361\025O\333UE\370*\243\013m\344\321/\311\307C\003\221WJc\366\207R\370a?\333\3355tY\376\025\036\016h#\362@\233f\216\206\264\251\by[gz\235g\264u\235\t\3326\237\311\351\274\251A0\027\362tS\304q\335\314|{K\250\220\202\031\316h\006\255PB\211\016U\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_displayHeartbeat.15.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"\206\322B:@\305(\035\340\245\273^\357U\t\022\215u\200f\f\334\372\245\334:\331m\312\033\237\355\243\254\236\024}\250\215\202\266\372\255\035#v\242\006\300\025Y\307Lx\321^\311'\233l\231R/"
+	.string	"0"
+	.string	"3"
+	.string	"\037\320.\267\013h\227\006m\330\303\214=\211\312\204\013\300\356\316\210q\360\n\372\0179F\265:]/\t\273kU\255*\356x\333\005\266\021l\307\002\317vw\035Y\366[\177\026\325\252\352k\227\016\026\315\312.E,\300\276d\312F\306\366\325\376\307A\300\267L\017\330e\231\234\354\206\0076\330.\035\006\031\213T<\331\356\356j\330vS\034\277$\342+i\227\032\tZ\354\360\221\322\266\273\034_\204\364\260i\\\372&\355\3621\242\3008Z(\215\331\341I\343\205\035 O\2503\372B\334f\317\006\242\263 \372\270\317\374<\020\211\363>3\304u\030\246\307\373\346F\343N\004\362\346\250\353\274\231\t\367\331F\226\025<^\250(a\214f\321\032\035\013"
+	.ascii	"2\2417\034\330\270\360\224\332\034\323YW&\264\202)\227`\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_displayResync.16.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"\206\322B:0\345(\035"
+	.string	"\276-\243\270\300\017,\331-\204*\254\207\023\224\026\266\006P\372\276_\255\3416:V\033\214F\251\242\246\177F\244\330\024C\265\035\220[&\bx\303\223F6\3312\245/"
+	.string	"0"
+	.string	"3"
+	.string	"\037\320.\267\013h\227\006\355\227\207\033\373\021\226\212W\314\356\316\250q\360\n\372\007\271f\305B]3\013\273k]\261.\356x\333\007\266\025l\307\002\317vw\035[\366]\177\026\325\252\352k\031\225\026\203\222]\213X\200\205\311\224\216\215\355\253}\217\177\200w\235\036\260\33329\331\r\023\214\260]:\f\033\fUD\331\356\376z\330vU\035\237d\3423i\227\032\t\\\fq\021\323\266\273\035?\244\024\261q\\\372'\355\3621\242\300"
+	.string	"p\2454f\207(\215\031v\241\217\310C\372D\334\346\017G\302\3230\3728\320\374\274P\211\363@S\304y\034\346\307\373&\247\300\335(\344MR\327ys\023\356\263\215-3\254\300R\221\302\032\315\2425:\013"
+	.ascii	"2\2417\034\330\270\360\224\332\034\323YW&\264\202)\227`\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_displayTxBytesFree.17.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\375\t"
+	.string	"\366\222D;0\345(\035\236\013\371\017&\023[8\030\362\330\274\322\031X\364\310\177HQO\332\334\326L\377\365\361\032\214\306l\0245\3753\"\"\031\300\340qS\264\362\005\nye\b\341\266r\247\0243"
+	.string	"1"
+	.string	"3"
+	.string	"(\247\342\354\270\320d0\255\223"
+	.string	"\273\263\033\270\201v\031_\240]*\307S\217)\377%\317\204d"
+	.string	"p\275T\217\333\303\356:\272^\030\267\336v\202m\006\373\233\321\232\211\216\032}ncq\341\304\354Z\314\004l\213\\\001\261\215\2625\266c\264\037;\t\352\363t\202]\330\213\312\356\\\260\002w\351\311\331\366E>\022\252\352\240\301R\225m\357)\020(\024\"\223r\374\335D\202\333e5\370\262R\310}\\\372'\355\362z\340\021[\305\231=UQ7\354gVa\336>\177)\003\241\317\310S\nG\036\347O\307\344\211 \205\036\250\013\301\320\204\007\202\272\221\347\021u\0370\354:\033\177\244\020\330\225\276\017\3544s\357M\021VZa\325M\337\032 \020\245:\006\020"
+	.ascii	"2\003\302\260\r\273\032\f\366\202\354\224\2568\032\213)\315\325"
+	.ascii	"g,s\rG\231\300\256\032\257\003\023\017\356\032\251VL\302$\003"
+	.text
+	.section	.gnu.lto_displayLayerSupported.18.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\361"
+	.string	"m\f"
+	.string	"f\027UA q\223\016\037^\033\226\2538\314\027\331\032H\016\366o>\200\206O\264*\365\347\320\365Q\215\357\253E[\3247()\326\301B\323\026\t\016\001\322\024\350P8n\201\360\200@\274h~\242\367\336R\246\024D"
+	.string	"B"
+	.string	">"
+	.string	"\fB<\326\036E\204.\272\201\301\304i7V\032\342\332\237\323\324\374"
+	.string	"\333\347\217\342p\207\202\331@\251.A\007\027\033\004l'\356\303$\232q\322SeC\311\004 \262\273\316\224M\303\ro\033\202\355\006\366#\004>\365\300\303\211\206\001\026\273\241\227\034\373\342\251\030a\333cclk<\213\347-\0357`A\242P\b\365w\300e\332'\361\022\236\257X\270\307\356\250\005\212\335\270\300\n\250?\307\177\300?\352\004\340\237m\007j\221\013z\362`B\265'T\310\247\\\235~n\027\027\321\n\367\323\013K\246\260a\372\240\356@\247'\335#\3560\325\200!\003\2248\354\370I\005a\337\355\356ZG\366W~\370\226\3379\255\316\331\325\261H\336\225\321X&\034\rF9\003\322\261HJ8\330H\305\311.\nX6Ri0KB\225\3118\025H\001oJ\256\2542\331l\262\n\023\367:\362Iw\020#C\351\204\372\032\264sG\240\243T\312_\203\252*\001\026"
+	.ascii	"k\b8\327avD\342Y(5\366.B/\260\n\270[\024\036\300\ni\334U\b\314"
+	.ascii	"\\\003\231&8\020>S\243\3402\246\251\211_]]\325 \220\267\252\235"
+	.ascii	"P"
+	.text
+	.section	.gnu.lto_displayLayerSelect.19.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\f\001e\r"
+	.string	"6\332]D\020\221\223\016\033\025\2144\245P"
+	.string	"v<^XD t."
+	.string	"x\361\252\216\303\270\024\252\032X\245\215\255m\3657\334D\310\321\226\342\3112V5\002P@)b\244\214;\315\343\033z\333k\315\232\264\275\267\224)\005J"
+	.string	"H"
+	.string	"J"
+	.string	"\007\342\341\365\002\361\320\266\037x\230|:'\202\345.+(04\273\034\246!~\372\323<\371\250?\230ju0Zl\033\256\217\003\345\006\211"
+	.string	"\233\352)\240A\311\274{\252l'\231\033\220\335u\246l-7\274\355\b\266!\330\307\020v\232\363\227\177s\326\037\235V\230\316\227>"
+	.string	"\t\037hh0\230\261\313Rccg\240L\t\333&\273c[\271\2470\375\245\364\004\254\n\304\212\307u\230\340e\332?q\024\246\263L>`w\025\343b\227s\340\006\327\241\271\007)\036f2(*9p\0326\265(\246N\350d\250\262\206m\ng!\272vU\037\376\212\013\244\222x\230\212 \206+\\E\311\207\017\223i\327\356~\304\241o\022\017\257\357\276\240\245e\202\225\312\032\233C\245\272\330\177\273\273\326\225\003\031\250\344\021\201\240\317\310C\242\215B\227?\035%\217\310\210\026\n\301\264\fd!\224\205`\243\220G\204}2\r\353\3400i\004\224a$$R\206u\270\375[]9\276\350\320\212I\377\024\337\235\200rTUE\r\222\322\223\327\311\215Fu*G\r\004\023"
+	.ascii	"`\204\036\262hp\013e1{\025\325\002\b\244#\304)\023\206R;>5\257"
+	.ascii	"-\201\270k6\320D\f\302gj\024\\\26645\"U5\024]\n\n"
+	.text
+	.section	.gnu.lto_displayLayerCopy.20.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`u\001e\017"
+	.string	"\346\235iF\360\260(\0358\t\342;\305\242'\213\276\262Rpw\212\241\177_\314\366\351(\371\220\336\301:\377Nu\337\024\247:"
+	.string	"\033\344\336\254O\361\246\021\334\232S\342C ]\326\210/^\241\263\201\312\024cI>\331D\312\224\002U"
+	.string	"R"
+	.string	"W"
+	.ascii	"\217\016o@{\334\316\241=\3326\003\220\224U\017C\244\234\245\203"
+	.ascii	"\206\230\316n\330)\210\253\0363M\225\277z\214\254\033\030\030"
+	.ascii	"4\257\r\317:v\227{\265R3\016XMN\200\027\206\314#\247\205\303"
+	.ascii	"cO\224\327I\246Gdw\235\256\227\312\255\3356\004\333\016\354\307"
+	.ascii	"\004,\366\263\335]"
+	.string	"\353\212\355\364\347/\377\366\230\337s\227_sZc:\263\364\271\007\036tj(\240\261\233\262scq\242\013\022\266S6g\307\3144\320\360*R\177Ae\002\266\365\301\005\262=vd\231\366O\034E\352.&\037\260\273b\303b7\\`\217-\351\321M5u\352G\013\270R\340d\320\325[`512e\331\324\243Y\342\231\323\002k\241&i\251\021`f\264\322\206m\t_A\332v[!>\315\005S\211\366\230z@\206)|\246$\304\227\371\300mw?\342\3217\321\036\257\217=\201\312\215\t\027V\356\330\341*5\237\207\002\215x\241\257\202\t\344>\017\005\0329\201\236\b\200\027*\201N`i\2649\364\201\002M \001G\242\016\374<\013\243O\324\225F R\027\372\300\356\003\201M$\336\327\235L\246\257\343\302}\266\272\342\324\333\\{!B\346&}\225\366\330\td\037UE\261\255j\021\226\236D.\033"
+	.ascii	"g\204v\321\302\327l/\"\032\213\030\341\340*\250\276\260E\307"
+	.ascii	"\336]f\r\245`|\n_[,\031\\\023\341&\0240\007\324`0\222\204\270"
+	.ascii	"@\370L\215\202\313\230\246#\032\241\206V\207+\r\262\326\t\005"
+	.text
+	.section	.gnu.lto_displayWriteFontCharacter.21.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`A\001E\016"
+	.string	"&\\cD"
+	.string	"\221(\035`\336\275~-0\250?]h\036\\\\\247\354\320\367X\276\033\270\032\237\266\354L\336\366\255\236\252\344a\304\232E8\022o\235\337\225@\3201\330\357\002\006\230\355\260\272\243\274\372M\200|\262\267\224)\005O"
+	.string	"P"
+	.string	"O"
+	.ascii	"n\240=\372\273\201\354Q{\201\354\321\266\037\200\224l\372W\002"
+	.ascii	"\345*++Xl\367\333\224\304M\207\232&\377t\030Q3\257\0311\254\020"
+	.ascii	"W\350\261\2429!\200\245\202\nb'\231\303\236'\254T\346Fdw\235"
+	.string	"\037X)w\274m\t\266#\330O\021\346\374\345\357\270\313\257\335\365o\234\2060\255\233tf\351\003\2400\"v\203\201\215]\224\232\034\033#\312\240\260]\2629\266\343\213\206\003\235U\275Z \300\357+Jw)\311\316\252R\036@\264\307Nf\332W\361\226\322]&\037\260\333\202\361b\367s\020\232\240\203\236\254\251\352\004\0235+\232\024\361\201`\251\271,\265\302\253\206*q\330\266\360\026\234\266\253\n\361c8`\360\024\001\r\217\234\205\027\342\303\220F\332\356~\345\3217\311\036\257\207}A\312\f\213\013\2255\366wJU\261\017ww\255-\333\031\335\205\217v \220\007\206>\"\017\211'\3424\177>J<\031H\036\007\332\274.\264\201\353@\233\210\363\214l\237\316\333><<\"\205\272\215d4\3526\316\267\207\253-g2X`\\\244o\312\016;\001\345(\324\023\333P-\202\322\024\f\220\035\252\272Q\247r\002\026"
+	.ascii	"l\204N\313\302\213\314\336\243j\003\036\322\261b\231YC)\b\251"
+	.ascii	"a\343)\324m\261\177\270\306tM\210\240D\030IB\\ |\246F\301eKS"
+	.ascii	"#RUC\321\245\240"
+	.text
+	.section	.gnu.lto_displayIsReady.22.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"-\f"
+	.string	"&XVB\020\221\223\016\033+\030\025\245\306\0030x\331\2361\f\310\332\005\360+\337\007P\001EU\351\375\375\315\242\353\303\363\021\262\240\275\b7\355\020\001\005\b\006\021+i\b\003XF\263\307\241\255\336c\357-eJ\001E"
+	.string	"?"
+	.string	"E"
+	.string	"\177\266\375 \302\307\331\267\017(WY)i1\355n\224zxv\247\231\371\240\273\027\202aq\221B\343pu\033%5B\f\320DN\201\t\364\362\322\363D#\311\004\340\261\273N\023-\345~\267-\3016\004\373\023\002*\366\335\356\256u\344x\322\017\235V\227NM?"
+	.string	"\005\027\223\f\0061vQN46\346\275\210\260\375\2613\2663\355\257\234\304\347\244\221\023\330\035\251p\331\335\034\270A\374\363v\004\360/\336"
+	.string	"\f\251Q\017\230\234bD\n\312\016\333\006Mm\301\324\n,0D9\3036\310[\254\270+\352\360Oh\270\340\201\177\251\t^\030\273\tO\207_\342\302\020w\367 \376\374\021\370w}\351\013R`F\220By\2627Pj\234MG#\202u\252\350\r\207Gc!\004\253>(\354\342d\250\256\017\252Si@\250\315\205Q\034\033\266B8\027%bY\027\225\331\366nud\330b\005\n\026\371g\360\245\027\320\250\252'\266U\355\021R\022' \241:\017"
+	.ascii	"^\204\316\307\302S\314^C\265\005Rt\304\235d\302Pj\307\247\346"
+	.ascii	"\265%\220.\243n5^\272\230`\250*\247\350R{"
+	.text
+	.section	.gnu.lto_displayBeginTransaction.23.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\352"
+	.string	"m\f"
+	.string	"f\027UA q\223\016L\206\2046\331W\021\340\323\251Gk(\221CNKH'\326\032\312\035\331;\352\364\310\242\031x\325\004bMY\020\333\364\n\001,\r\007\242\007"
+	.string	"\275\013\253\303\303=\234\336\367'{K\231RA"
+	.string	"A"
+	.string	"A"
+	.ascii	" \323\2415;\307;\020\373\021\f\f#"
+	.string	"\035\273K\351\207k\177\232\232\177\321\001\250p\237\277\r\327\007\302\362\2424\200\333^H\251\205\303E\317\f\\J\346\007\203\335u\252p+7\274\355\006\266\027\330\177\020\017\375\360\245S\323\217\230\0225DV\354jx\351\261$8c\204\355clg\367\024\332]*<\002\273u\b\241 \036&xO\373'\216B{\350\344\005vA4b\354v\"\016\211\207\356n`:\214\0172\324\326\224\nAtcK\036\266M\336\302\212\273\033\211\317\302\202\004\317t\230z\300\206\261\253\360\304\335%\361G\331\204(\342d:\274\302\025\034;B(\371bw\237T\017\366\337\356\256\025d\337\345\237\002X\326\261\336F\303\311d\030\247\212\326\214x2\021:XUBa\327\206Bu\225P\234*cBi.\214\032A`\253\263\271\250\314\262.\n\323\355\337*\310\016L\220P4\345\005\310I\241:\325\002\\\220 ]\320O\226ZX\002\025"
+	.ascii	"3\241\031/\306\326P\022\2637Qm\201T\034q\357\2300\224\332\021"
+	.ascii	"\323\001[\013\241`B0\327\330b\230\027\204\317\324(\270,M\215"
+	.ascii	"\026wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_displayCommitTransaction.24.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"E\013"
+	.string	"\246\225N?\020O5\035\200\025\022\245\206\215\020\342\002\216N\322\316\2408\344\020\271\302\346@\314t\024\253\242\316 \323\245\017\364h#\331\336\020\234\252\252\256\020*"
+	.string	"DI\343\256\334QY\002\350\264\245M\244L)<"
+	.string	"8"
+	.string	"="
+	.string	"n\361\020\303\036\325!\001\365bw3\275p\357\226\246\347\237\343\020\022\030\272U\341jI2F\250\002\200\2375QmX8\307s\0028\312|\034\330]'\t,\335\361\266\021\3306`\277\022\326\356\256\325d\377\364GMg\246\377\210\240PAY\355RX\305\330T4\241!b\373i\237\303;x?\201.`\327\324Ab7\244x\202=:\374\200\353\021\273\344z\264\347%T5lw\256T\005 X|\t\303\366vT\007\333\375,~\210\b\335\347zL%\260\302\r\376\341\203\355\256\305\367\340y\200ex\364A\327\3435\226\\l8\211re\207\241T\r\373\001\032\314\346\342\3516\032fL\005\302e\001\247\3232Y\307i\034h\\&\333h\027\006\031\206\353\262J\001o\034\r\227y\266\215\313\"\341\336Z59A\212\224HG\026$\243:\325"
+	.string	"D\234H}\032J\325FF\020"
+	.ascii	"3\241\025/F\326P\020\263\227\320V\343\2209\306\004\254\324\216"
+	.ascii	"\230\016\3302A\024\214\272\204\325\254F\213\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_displayGetCanvas.25.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\221\001\245\017"
+	.string	"\026^jF\360\260(\035\372\2317\022/\3234\254cn6\371\303\b`f\037\026\354\241\016\245Z\270\255j7&\252\326!S\234j\317\225\035\374\030\237\327+4\003\317\220;\037\362\234\343\024x\341\233\\\353\207u\013\261{\023)S\nY"
+	.string	"O"
+	.string	"Y"
+	.string	"\361\220\373G<\264\355\004\013Zv\375\373\020\273\f\r\n6=\273_\247\036\356:(\302M\323\345\207d\257\203\342v`\003\013\f .:\314\230\220\220\313\360M$kI\335>`P\360\b\220\3016\021\036\032\r\257=_d,\231\240\221\335u\272\310.\334\334m\257l7\260\277\"\351c\177\257T\031\373\333\356\256uf\377\373C\247\375\234\323\321i\350\264\302tn\351\007@\211\351\2611\312\261\033\373\321\261-\240\n\021\266[\266\310\266~\254\002\004\026VcAA\246\375\021'\321:M\345\036\2733\234\024\273\037\002\213p\207\376\016\022\232;j"
+	.string	"dH9u*\324\353\304\264\350+\357S#\307\007\252\314\025\304\316\316\215\255$\246\236C\215O7Qr#\301$B<L5`;u\033\024n\027\306\300/\361\300\343v\367!\016}V<\274\206\304\240\255\344\317\223\207\006&G\255\0229}\355\0365\332\013\307\013\031\260\246\022\212\224\342\241N\234GZ\241H\245\350\322\210E\202p\342\235H:OeZ\235T$\035\352D2\351J*\257\033\2058ubRu)\251\224\252\023}\373mu\346\327\356"
+	.string	"F\205\033\234\355'\356\250\032\365\305vT\217\254(\013h\200K\246\274\213*\324\227\25533\023\213\256\b\003\035"
+	.ascii	"`\204\306\327\302\327m\017j\032\253\n)U\013\203\250\215f\027"
+	.ascii	"D\306\342\214\3350\026c\343\241A\036`\r\224\352\002\026\"]1\f"
+	.ascii	"\213\005\027\032\261\261\021\224\bF\034\240a\276p\337P\005A\310"
+	.ascii	"`\214\252\006RuL("
+	.text
+	.section	.gnu.lto_displayInit.26.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`&\001]\f"
+	.string	"\326\026SA\020Q\234\016H{\355\032\252E\025@\271\255l\207o\354\266\241Mb,5\327\230\002\035W\2076;2\375\277\022\377\265\276\270\247\270!$\240"
+	.string	"\001P\005\036\017n4\240T\315\240\245\272\"$B\366N)="
+	.string	">"
+	.string	"D"
+	.string	"'\260;R\275\330\255\013\254 \373\345z\003\330\257\354\005\260_\026\355\030\257%\366\251\016\034V\254v\227N\022\027/E\377)\016"
+	.string	"\024\352\\F \354\256%(\004\342\236\267\235\300\366\003\373\245\277$#Id\032=2\304\256\0359G\330\267vw=G\366\353o\375\364\317)}-\254\253\031\rd\354~\b\251\261\036\027\307\t\333\327l\313\252\341\300\200\375\240<0\270\264_\272I\374\211\023\016\306\217w\337\240#\fQ\t\344\036fW\270\312\213tl\220@\002\3109\375iM\304gvl[\236\372\262\335\317\304g\261\261\220i\260_\237WG\212\306\311\232vx\025\232lw'>\n\303\005\001\037&8X]\205\302&a\203u\334e\313\204\027/3'\311\260U0\241G\241!\330m<\220B/\336f\241\034\030R\t\002\177\230\016\244\231\357\003\251V\367\326\316\221#\240\360\360\314\r\026'\234\203\013\321b\305a\366v\027\\\030"
+	.ascii	"2\241\365/0.N\322\213\334AG\024\\\016\322\200\274\240\035JiY"
+	.ascii	"\230p\274\220z\255\202{\252<\247\301I\213\273\016a\215k@+\f\r"
+	.ascii	"\n\203a\001*4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_displayLayerSupported.part.0.28.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`o\001}\017"
+	.string	"v\336iF\360\260(\035:\022\260\205\333K\320,\220fE\375}\026~\034)\205\031\032\226\200K\330\372\351\222\242j\377+\336\376\013\304S\2633n\322\357\201M\202\2130sxz\303\211b\276\362M\337\373\230\362%q\357-wJ\001V"
+	.string	"W"
+	.string	"P"
+	.ascii	"O0/\267{\314K\373(\034\342A\265\330v\210'e\325=\021\260\303\330"
+	.ascii	"x\321rv=\356RC\\\365\250P\252|\270\022[=\312\3257\233Q\023"
+	.string	"\353p\215\037\257\034$\006\304\\\221A\316\352\346\265C\226X\013\302\003\227\035#\273\353\315\345\236\267M\301v\004\3738\001?\200\006+\004>\354\302>\034\013B\336\2248\315\355\253@\3715wl\237\006u\232\tNX\226\213\203K\307\331W\244N3\305\002\353\202\201y\266\313\005\361\0363ew\254\360\036\3523'\005\336rh\261B\373).\223\372\314\351\006ve80v=\b\227~\260]\332\013z\350\301\333\020S\215\261]2U\365eV\303\005o\330\026\375E\311\266\353\022\361]\\8Q\231\227\252\247\321\260I\257Q\331vW\304o\201\241\202?\342\322?\315K\250\257\2353\361\235\220a\301\017j\214U>\256\312lCKC\307\t\255\022\032\336{]\350\3641\221!\320\350\223R\032\2116\203@N\037\023\224\222\210\204+u!\013\242\216\204\033\211>'\034\250+q \037&\241\204:.\205D\352\270\316U\346"
+	.string	"\255\357e\243Q\202\f\r5\033\350\253\246T\026\333R=\302\322\2265F\026\253/\026"
+	.string	"\177\323\274Z5*\202\327\027#\203\256\034\033"
+	.ascii	"g\023@\324\361\225,\f\226\031\201\245W\300\031\233\221J\t\246"
+	.ascii	"\232\006\357\001\024.\033cXV\352\254\362\264L\361\276\260\376"
+	.ascii	"\023OCA\310*\b\022B\347\274C;-\324\034V\235\201p5\020H\035ym"
+	.ascii	"\301\003"
+	.text
+	.section	.gnu.lto_displayGetCanvas.part.0.29.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\023\002\335\020"
+	.string	"\026aqF\360\260(\035\356\271Y9\3121\202?B\022{\007\035d\002E\2743\366x\t\261\215mi\207_?{|\243\177\377\243\332\350O\354\257\017P7\221M\244\375\315\3265'\205\230\240\324\312\312l\377\263YB\366&R\246\024]"
+	.string	"V"
+	.string	"c"
+	.string	"\341\304\300\342U\3731\247\301.\343z\2009_nT\314\031\036x\264\201\356\321\341\005\310\307\356\036\362\321\276\t\207\210\274Xl;D\004\346\330\303\017+\207\251!\253\335\2303\374\036\327\303c_\335b\276\316Z&|_;\201\034\035\0303lZ2\\;\276q$sNw\032\356x'\260\265%\013\343\335\276\315}\261\255\036qj\221T\207\244\032\304\251=\251\376D\265\207SwR\315I\265\344\324\3614\377&\325\033\325\372\360\277G\201\331\310e\316\225\035\034\223Cd!\302\366\355\327^\266g\303l\317\233\236f\246\265\315\264>"
+	.string	"L\025\032\013\bV\037\276.\343\372\b\240\006_\341\355\002\317~\034\374\346\324y\326\033\241C\202\326\255\r>\005iD\343\263\034n\273\335pd9\344\356r+q(\224H\321\035\307\225\245\243x\320\315\2512\342\333\260L-\371\030W\001\b\232\356\356e9l\b\2579us\316\021\377\204\204\224\037\342\321w\311G\335\327\256.6\304p\211\241\241\350\216\006%\022\n<Y\241L\335\nd\241@\2224\t\304\005F0Y\231J\276\225\252\3042\251J>\224\t<}$\325\352\003\031\340\224II\365\235\244R\252\317\263\255\337\346\276\370\265w\350\037\223\243\255`{\264&A\331\024\357.\214m\317\306\312\205\232\271\035,Z\233\301[\204V\264\333\013\320~6\264R\206\267\001$ \260\002\2512n\003\227\3120h9\210"
+	.ascii	"\202\243\303\305\346 \220\303\341,\335\236Y\266(\026\315\220"
+	.ascii	"\3611\017\274\226C%\347\307\256\221k\025\337\003\n\213\315\b"
+	.ascii	"\"f|\354\223\333[,\fb9\2213whm\241<\214\352@R\006\256\334\267"
+	.ascii	"\336\352\230\201\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\216\002\365\t"
+	.string	"\244\r\212\003"
+	.string	""
+	.string	""
+	.string	"\002\034\1773\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \035\1774\003\1775\272\200\202\002\004\1776\005\1777\006\1778\007\1779\b\177:\t\177;\n\177<\013\177=\f\177>\r\177?\016\177@\017\177A\020\177B\021\177C\022\177D\023\177E\024\177F\025\177G\026\177H\027\177I\030\177J\031\177K\032\177L\001\033\177M\377\037"
+	.string	""
+	.string	"\200\200\200\004"
+	.string	"\221\215\300\227\002\001\225\001\004\002u\004\003\004\005\325\001\004\006\007\003\n\032$\004\n\365\006\004\013\325\006\004\f\r\004\016\017\020\003\021"
+	.string	"\323\243\362\362"
+	.string	"\001b\004\022\023\350\314\231\263\001\001\265\001\004\024\265\001\004\025\026\321\231\263\346\027\003\030\001\217\246\246\325"
+	.string	"\001\342\001\004\030\372\321\360\372\031\200\200\200\200\004\001u"
+	.ascii	"3 P\203\210(c\001\"\266\203\256r\257\016-\344\364\360\242%\347"
+	.ascii	"+a\2254g1\021r\220\214a\3078_\204\240\375\002a\034\3424\345P"
+	.ascii	"#\031oO\272\002\231\246\307o\374\3067~\3037\276\361\033\276\361"
+	.ascii	"\215\337\360\215o\374\206o|\3437|\343\033\277\341\033\371\263"
+	.ascii	"\t\340\033U@\036#5h6:\001"
+	.text
+	.section	.gnu.lto_.refs.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.154d1cf003b5b972,"e",@progbits
+	.string	"(\265/\375`\022*-\252"
+	.string	"\212\004q9Y NI9\351\215S\0227\236\017\356~x\3315\270b\\\024\207\352*b\306U\301\242w\3321\244\337\221[r|y#U\331\3066\252N\316\307.\302\354K\3449\310_\005\266\356\323\266\326\274\031sw1\215\356(\353\212\312\350p \254%\220\313%L-i(\331\376&R\246"
+	.ascii	"\003z\003\242\003\226\271p\027\315\213!M\272bH\237\306\034zs"
+	.ascii	"/R\330\212vr\3479\031\230d\241\322\226e\340\2564j\013-K[\216"
+	.ascii	"\343-31\270\351P\261eJ\r bO\206\243\201\233AEI\327SH\026,0T^"
+	.ascii	"bqog,41\214\020\247\264e\2676)IUmY\n\267\365\2340\301\345h\313"
+	.ascii	"S\230\n\257\037\270\312\331\n_\371Kq"
+	.string	"\245i)\2740\256\2665\334\241\327V\351\371C\017\315\313\343\017\275\3131\033L\224\035^blkeL\272\266\254J\206\304x\250qZ/\311\313\210\320SzF\246\1772\207\336\023\r18A\272\265\345'l\306R^sVm\331\254\331\t\237\235\3158\006\r\306\225\315\354\275E\346\r~\314\033\274\224M\025\271z\366\334\"\345b\372s\031\223)ex=\3322\223\231\273$E\251\266L\306]FD\340\244\224\300 \004\352\254-\217)@\313\031\243\355M\244l\204\217\360\312I~F\302/\334n1\257\363\336u\006-&\321\222\264\325\200;\364,\203\350\3210\210\336?\220\362\005\373\212\311!w\003\317\313\203\017\236E\303\275Y\367\336\f\232\214mHV\333\313\035\206ex5\335h\373s\027g\261\023=\0161/\330\275\353\006\232(\033kIm\271~K\250\264@j\373\022R\336\2726\276\025HX\256\332>\204t"
+	.string	"N\367\203_\220\276SF\256\334\241\2272\207\336\317E?\007\177F\376L\244\002\243'`\t\207\037\265\201\001\261\030,$a\005\037\337\360\333\r~V\322 ~\236\300\317%P"
+	.string	"\251\346G\241<\360\005c9\374\277"
+	.string	"\023\232\377\032\370\023\231\337\312\374\177\373\371\003X\254\357\277\334\317%\346\272d\340.\254?\030\375\374\362\363\006>\374\334\373\314\217j\371\357\365s\n\377\212\253\202\002\034\233\bZ`~&\3011\367\360\263\t\\"
+	.ascii	"\267\005\374<Bo\300\200g\360?\004\277\340GS\360s\212\373~4\311"
+	.ascii	"\323\037\345\252@\024\"\025@\003:\241\021@\363\243\035\374\334"
+	.ascii	"\201\247\360\363\3155\374\350\225\005\036\363\243;~v\341g\234"
+	.ascii	"\237Q\374\247\371\231\204a\315\177?*\365\367\001\376\256\371"
+	.ascii	"\231\354o\230\277}\177\277\374\215\376\334\345g\273\237\277~"
+	.ascii	"\246\3739\356g-?c\371\331\355\347*?\253\375\034\345g\264\237"
+	.ascii	"\317~\206\341\347\262\237\227\374,\366\363\326\317E~^\177&\362"
+	.ascii	"\263\326\317C~\316\372Y\310\317A~\006\3623\326\177'?'\177\206"
+	.ascii	"\361\363\217\237U\370y\005?\373\370?\366\363\325\317\t\370\031"
+	.ascii	"\307\177\270\2371\370\371\306\177\f\376_\371\331\306\317Q?C\375"
+	.ascii	"\\\343\347\247\237\235~\246\3613\363\347\246\237\227?3\375\274"
+	.ascii	"\364\263\322\3173~\226\361\263\362\347\244\237c\374\214\364\363"
+	.ascii	"\375y\205\237[\3603\013~\006\301\177\r\374?\373O\200\274\274"
+	.ascii	"\274\274\337\267\200\377E\375\013p\202?{K\227\262\rzDW\214y\351"
+	.ascii	"\200\341\023\372!\344\b\025BU\374\354pX\245\251\245\267g\351"
+	.ascii	"-\223\364\226\213\370!5.1\222\205^\306\353\"\236\224&\235\327"
+	.ascii	"3(\321\231\345h\313e#C\206\264\366\301\225V\006\301\362t;\226"
+	.ascii	"\f\202\216%\370p\243R\245\225Z\232W\254d\331\322sM\327u-Cwi."
+	.ascii	"\215\327q}\327r\274\266\035\027y3\373\331lR\330\214\323\224\020"
+	.ascii	"\260\352\362l\265\265N\373\241\367.\357\232}\366\244\323F\340"
+	.ascii	"]\273~k-\274l[&\353^\230\302f\036pike\bo\313d\235]\303\261\331"
+	.ascii	"\217\270^\243\336\3231\235j2;\263\261\267<\322\276\334AKg\021"
+	.ascii	"\252\341T\374%)2r\301\322X33\360X[j{;\225\336F\245\2674\322\333"
+	.ascii	"\245\3646)\275}\221\332Xcz\364.\005\301\035zG\267\244\035\240"
+	.ascii	"5\024^m:\n\r\257\005\025-\271\245-\270yl\323;\252\226\216\340"
+	.ascii	"\016fN\250\216\232x\355\244c z\202A\325v5\256 \211\215%Y\034"
+	.ascii	"\205\263H\261\026\203Q\r5\021\2031-\223u\f\205\2650]\216e\022"
+	.ascii	"\253\207\272\250\217\226\226I,f\357h+\3452Y\367wX7i#\235\244"
+	.ascii	"ah&\375B\037\351\261\346\352\262^\322\316\026\353\256&k\260\376"
+	.ascii	"j\257F\302k+i\2547\220\016r\233\365^\343\275\367\234\325\267"
+	.ascii	"W\304\0045-\223ua\334\204\321t,\223Xul\307x8n~\364\321P\335\f"
+	.ascii	"\214\327c\273\261L\326\205\261\030\227q\232r\275/|AS\313d\035"
+	.ascii	"R7\315X&\261\204\364\326\216+\036F\315\276\352Qt\343\243\217"
+	.ascii	"8MYs\215\\DM&\215\246\222\321/`\264\213\f\202\216\327r)-\223"
+	.ascii	"X\367\256o\300\317yJ\372\330.F\b!\257\221\253\352\303W\327Y\224"
+	.ascii	"\272{W\016l8\370\021\321\302S\342`\253\213\304\234m\365\270\353"
+	.ascii	"\365]\304,j\355E\333\316j\"+\220*+\022\321\352r\033R\326Z=\204"
+	.ascii	"\346\330D\316h#E\231\322\230\313\035z\314DY\244G\215\351\373"
+	.ascii	".}?\323\367\224\264\306\252\312\236\325\r\241k\276\253~D@\314"
+	.ascii	"X\230QM\241_M\350\254t\274\247|Wq^Jm[\212\273$\220C\b\225\266"
+	.ascii	"\235\243\225\030p\342\246\242m\343\370}\231a\321h\3337d\204 "
+	.ascii	"\205\375\260\361\243\213\013*6:J\bR\224\216\225\006FI\227\036"
+	.ascii	"O]\343\r\325N\267\241\034\300\274\267\330P4w\367\026i\2307`\336"
+	.ascii	"\300\006y\332!\326\263\357\262\364\035\226j\320\264\214\331\301"
+	.ascii	"\"\254\210\351\275|YJ\245!\333\366\022w5\025\024f\214\266\255"
+	.ascii	"\324J#!+P\332\366\214V\372^T\315\230\321\266e\2642\306M\313\031"
+	.ascii	"Y+_\236\346\336\222\264\355\030\235\344\325C'\241\304\255\233"
+	.ascii	"53\003\220\031\272\024I\317\036z\234\307\036z\357\037\351\333"
+	.ascii	")\355\340\b\331\003\023\273\2723z#_&\001&\322\221\266\255L\337"
+	.ascii	"G\351\327v\321-\3229\273U\256Y\274[\250q\351\022j\333\307\364"
+	.ascii	"\357\025-T\364\366\266\354\240\267P\253\350)ybc\250-\2106\302"
+	.ascii	"\030\327\353\204\241\022\307\004\226\227^\256\213?\265!+\245"
+	.ascii	".6\321\247\026d\252K\017\034K\272\270\364cR\360\356zMrkCm\371"
+	.ascii	"\016G\223\241\265\003NZx\320`cC\253D\200k\3519\305d\004\245r"
+	.ascii	"\264J\2266,F=\332\242S\270\213\246\351\210PX[T\nR\252\246\326"
+	.ascii	"-J\270Uis\317\272\336\223\311\024\221\266O\203\242D\341/\266"
+	.ascii	"c\3236\201Ay\203CC\343\322\374q%\257d\255\235\235\361\327\233"
+	.ascii	"\033\r\321\026\271 M\2348\351\252\264\346\006\265Ay\3060y[Zr"
+	.ascii	"\302\300_\254\274\250\033r\356\211EC\\\323\220X\245ee\374\225"
+	.ascii	"^\016c\316=\353bZdi&5\035A\227\034A\311\220 A\311D06\367\304"
+	.ascii	"j\265\274:&\252\344(Y\314\330\032\022$m\321\027\3201\241\030"
+	.ascii	"\267h\fM\242\265E\344\324Ba\260\221%\020\245\266\276\242\364"
+	.ascii	"\275\271\324\013\005\363B\305z\367\362\3124B^%\022\304\217\206"
+	.ascii	"\035\025C\235h\327\321\257\177\361]J\274\367\002"
+	.string	"\"\310\271g\335U*A\370\236\274\212\275\255\364=\250\364\357\277w\213\310{\357\213\227\365\"\2034\234_\230A\3743\214\362\001\376\333{Gp/qJS\206\364*IQ\351\032\334\277\244\335kt\"N\300\351\310\350\224tt:]\242\221\212\270\001y\235\210G\347\275\033\256\321H\034\201y7\034\235\367\350\252X;\342\273:\021\257\221y7\\\343-jp4:\035\035\235\305\243\rG\247\323\321u:\335\232k,\"Y\030/r\303u:\301]'\363\250\346\350d\036\035\235NK<t\334\022\344HJ\363\t\214\211G\343-\"Z*\"k\322\216+\363Z\271\227\301\204.\362"
+	.string	"\367.1\221V\212I<\026\224V\024t\244\310\344\365\336+"
+	.ascii	"\242\240'\3465\246\035y0\357\345\021\304s\211\034@\\\323.\016"
+	.ascii	"N#\326X\272CB\367\016\200\350^\"\337\264{/\361\336\353C.\255"
+	.ascii	"\367\316\25096\211\210\356U\332\020\335%\242\022\241{\033\254"
+	.ascii	"m\354\350\350|b\336(\361r6\357\212\225\310\315k\305\t\231:\211"
+	.ascii	"E\356\320\275\227\343\322\346\021\214-=S\305\003\253\252\214"
+	.ascii	"I\232d\3458\324\266Ly\266\326\266\245\240<\277\332\242]>\256"
+	.ascii	"\226+\204b\212~Ti\265\375]\305\210Z\342\242\205\206<*\261!M\313"
+	.ascii	"\237s\211\024\035\325T\0259\254\243\266U4mlJW\332\2562S\214\250"
+	.ascii	"Z\240?P\037V\f\355\205+\264\007\r\027\262$Eo<\320+&#S\214\266"
+	.ascii	"\250\325\372\222tsJAC\233\274\242U"
+	.string	"\234vF\253P\035\350\016\242oG3K\262\216\003\037\220 iE\326\036\335\201J\265\222\004\030\300\300!\307\252\332\242S7G\2518\364\220\312\365\202}!)\325\332J\340E+\265\227; \355\221N-\250\255\r2\203\261\264.Q9\"W\rFFR\314\250\336\362\265\t\251\300\001U\326\006\203\016)5\320z\214\253M\310S\026\267\036BNL's\004\"\264\322\350\0251xFqF\230\f\326\233\241\264s\321\344\202\306\214\b\020\252e\023\f\0234;(&*n\213\242\233[j+\313\364B\205\013%\233\031\267;4(\350\f6\023\322\344\tLF\037\275\024\211\233\001K\231\324\343\tW\215\266\\/K\274\356\266\222\036\326$Q\215\266H\314t\212\361h\213\302\230\311*S{\241J\317Yv\317 n\373\275\334\313\354\202\016\241Fn\343\264\033\023\310\342\362l6\027xMt\b-\2662\310\035:\324o\3501"
+	.string	";n\233U\035Z\204\036\241H\364\005J\304+:\324C\216\262@[\300\300 \202E%\347\ta\002\330\023\034\nE\250;@>:\300\036\021A!\220\210"
+	.string	"\fq\324\024\364\b{>>@@\340\017\320\207\342'\3103\374\001\372J\220\243\372X5\bt\302\002U\237\340P\330\033\366"
+	.string	"M a#\202\n\0028\341\204\024P(\301\004\002\250\240\002\bV\030\252\032vT\026\204&\370\370P"
+	.string	"\205\037\0139A\231\022#l Qc\001\f\356\241\203\020\303`\316\211\020'dp\235\236\240\nTM\244w"
+	.string	"\b\f"
+	.string	"a\004\n|\037\021B\007!t\320\373\210\020nnB"
+	.ascii	"\341&=\b7\350px\236\020;\302\037\001\344\fsv\354\360<"
+	.string	"!tp\020P\302\206\016(^\206<&zT\236\036\317p\247G\205!PmA\365\251\300NO\320D\215\t\200=>\"\214\240\n\201~.\364T\235\036\027\324\235\236\020\305O\320\n}~t\354\n \020\376\234\260>>@$\250B\240\231\035\325\207\342\007\205\340\2170\b\244\003\323\033\002\201~H\300\234\307\303\177N\250A\021\303\237\237\240\b\031!\016\2150\307\005`\016\211\241j\002F\210\243\372\260\220\223\302\0078\260\220\0234aUa\216\352\243\006}\301\034\325GG\246\004\212\234\340N\214\232\202\236\022@U\r\352\bc\2029<:\326\004\260'8,!3\304\031\341\203\021\n\325\240\211\237 \007\200&\004\325\022\b{.\030\346\250,\f\2039*\017\214\0160\205P\r\366vT\035`\212\022\302\236t\210\343A\003T5H\202P\035\246\020\001\005C\231\035u\030\3749q\002\3507\324Q}\324\0222*\316\t"
+	.string	"Hq\342\207DPM\221\343\0033\304\001\341f\b\354\001J\2058;\302\237_P\035\352\344\004sxH\f\201?$\250\303\236 \n"
+	.string	"\370\374\374\210\200\363\222b'GEA\330\343SqNl`"
+	.ascii	"\300\036\023*\0135C!\3160\370\303\201\231\337\334\220\320\300"
+	.ascii	"\003\032\260@\252\023\"E\216\317\ta\317\216\baPu\241'\270#\002"
+	.ascii	"\330\223\323\202\b\235\240PD\210\f\200?=C\235\034!0'\230\302"
+	.ascii	"\260\247\205\026~t6\340 \363"
+	.string	"\335\255\330\202\274\201\212Y\033\326i\314\210\210W[\013\325\266\206\215\272\205\372j\241\fpG3\303H\fV=\373\027\267\312\027\326\t\335\222*\231D\270\b\224\331\371\320\252\273G%\210\031$3\2000e\334:\3352y\360\201\245QT\3464\327\326.m\023\257?\263\314\377\310V\204\235\201\245o\001\377\254g\227n\225\224hd\317\031V\351\207\211\271\202r\376X\3233 \335J\036\035\331\344m\222V\231\020\033Vj\221ncD\025\245\255]\245\277\205\361\303h\200\323\221\314A\225>\306\206\013\027\026y\2024\006^]\025kt\213\314\342B\244\321\326\026q\227oE\312\370a\211\226M\034=\210\354\320\317lj\231\204\366H\303\256\2601)Y\026\226\305\024(\315\037\330[Y\261\355c\212v\205]\301Ll\234<\237kMO\332\254\n\253\202\237\250\240V\341r\343\f\017\317\006y &\212\311J\223-\336\006\231i"
+	.ascii	"{\"\373\321\326\022\271\313j=\361X\266\265\227\333~5\214\202"
+	.ascii	"pA\363\350\260\204x\344\2413\310T\221!I\027\253\241V31\204\340"
+	.ascii	"H\026\351\322\205\347J\254sO,\231.\273&\310\246\235\035\337\245"
+	.ascii	"J\326\271g]\331\223\254 Lrr(]7}^\\oO! `>\346\216\322q[M\024\f"
+	.ascii	"6\230\026qq\374\025\245\271\363\004\357\351\016\016\216\277\314"
+	.ascii	"\236>**+\216n\251\026-\335\"\275\017\320\020\305E\365\302\031"
+	.ascii	"\026,\335\342\001w\356\211\365\200"
+	.string	"\264\2463\"nn\275\004\322D\257\344\020#\242\272r\245\247\236r<\271-\203\234\250\222\3718\307\002\r\211\320\210\210H\222$\351\362\n\020\206bQ\034\347\322\016\022\240\363<\220c\020\032\032\022\021\tRP\220\024\244\264qHQ@!+\345\236|{\207\335\030\234\016\024\361\016$\376\377\243AF=\217\335\354\017}\241\333\254n\350\033\002w\345\022\200\352Z?,\n?\251\351\257\0270\333-l\226\311\220\356\324Z\376\002\2349I\200\025\301!\344\3036\266\241\223\305\025\373\212\212/j\216\204\3350a\241\227\317\243\343\001l\264\216\246&&\271\201\023\223\221\260\204&\376\270vf\304\271\036$\374n^\024\024<8\236$\243Q\326\335\254K\345^\2741\360\233x\017\034\313\002\002h\313\365\270v\026\371 \237_\3313\302:\035d\204GE\351\335\031\304\316e!I\231\251`*5\231\234+\f\372R\337\201@7F\324"
+	.ascii	"\374\243\017F\274\363\267 X\"Y\331\330\2603\246\331\021\0010"
+	.ascii	"\332\340\257&w\261\200|&\275D+\243\020\375\271XO[L7\200\276\306"
+	.ascii	"O\027\313K\336Ga\216O_\030\353\\\177\331\226a\347\375U`(\344"
+	.ascii	"\027D\"_\267\264,f\261F"
+	.string	"'%9\330xg\252\207\027\237\024_\037\341q"
+	.string	"\003ge\277\265eh\354\221\007r\016z\376\036\242\203\"\361P<\244G#}/\026\032\265[@\237\333=\fO\r\376IB\211\356\220?\315\210\003\221\370\003\367k\311L\027M$S\251\bg\343\204tn\347\025\226\257\261\361\301-\321\355\217\017Pb(P60\217\303\306\036\230\332!f\277\006+\2752<\303\242\rK\354k\233\213\202#\214#i\246V\024418\004)\373k\340Cv"
+	.ascii	"\007\266\303\267ZxL\222t\367\261C\366\216N\213P\305mj\222Ls\b"
+	.ascii	"\022\202\264\2666\n\221\246k\343&[\363>\236l\260\216Dn9M\t\262"
+	.ascii	"\374\233{\272b\t\306\222\366\325$!J#\312\227T\367\276\375Mh~"
+	.ascii	"7"
+	.string	",\244\204\305\312'\342\0045\020\343\023\306\030\322\222\272\374\374\016]z\310\240\357\373\240\031qk;\303R\f\213J\317\302\002\003~W\232\021\003S\210\310\247\303\371h\306\305\363A\330\2429\233\344\375\235$\020\220\317\301{d\251%\2270(\222\200*\342\024x\rx(\257vD\200QR\316\212\236\330\3569\267vIpMQ\325v\360\316Ri>\020\2446\300Lqx\274\270\203p6U\212\350\304\006\033\203\312\357:`\030b\312b\307\367\236'd\023S\026\313\377\320\234,\037c\005\244\311\030hHqu\003\363\032\220\274@\027\252\250Z\006u]\212jq\324\223\247\357\344\251#\2305T\322,RN\375\362N#\222\2006\322\216?\026\260\214\212e\270>\0372oG&\314ca\013\303\347*\265\236\b\271\322e7R~ \036\306\023+e\032\3435fh\344\346\003\326\264\277:\275tTq\007\214\373\024w)\370"
+	.string	"\2326\307\fy\275\354\363\377\332\226\236\241\r\276\320\224;568\016\003=\374\177i\361ER6\352!\005H\222\204S\374p\\]\232\017z\211\374)R\205\226\030\324V\016G\327L\272\032\022\327\214\b\254\326"
+	.ascii	"9\376e\023\2240\275E\206&\313c\031\366@\347\3647\260\237\235"
+	.ascii	"aJ\005_ d\210d\223\373S"
+	.string	"-\352B\2402\037}\034\352\355\225\356\253S\030\210\f\b\224\277\005?\260gm]\371\375C`Hw.pL\n\273\321\231\207\260'\337>\252\322\017r\267H\3330,t\365\347\t\252B+\374oB\017,.\002\245\272\351\326[u\2411\320\270`\2609H\325\204&[\265>\030\342\202#Pz\273\222\203\360\211\336\342'yC\357}\324\200\267B0Q\262D\223\202I\344\340\001\271\327\247\025\006\204\340\n;\360\036\t\272~*k\352K\370@G\r\274\220$(;@e\235\240|\241\235\327\203G\177\227LLG\213\220R$.\225\304\013\363\215=\361\216\253\020*\257\210\024\343`{sqW\006R\236=\321\r\314\f2\346hD\\\321\335\254.D\351\223\003$\220\203*z\022\025)\342~\210}:}\242\323D\367+q\204\374\030\306\374A\375N\375\342\206B\242\020\037~\222\3758\212o\327\216\004\021\375\377*@"
+	.string	"}\360\3541\272k#\005\007M\300F\205\031\260X\3211\226\2141?\304\371\212\271n\325pJ\230"
+	.string	"\236J\201V\376C\354\377a\276\277\217)\301]\336\036\030\277\206\316X\224\302EZCdf\003\264-\202\3435\261\344\236\237\031\036\365\374\376\277z\260E\024\255D\241\0233\262\257\252R\300\001\243\027\345d\345\245\234K\303L\344[\302\312\326\022\030]"
+	.ascii	"A\245\334\300\272\213D\210\032D\370|A\300\205\032\202\243b\223"
+	.ascii	"\2767\277\271\345\363\236VJ\"!\212\025\275\212,\b\211\317\007"
+	.ascii	"(\024\311f-\351.3\207f\250\351\202\231+\240\256lkx\210\033\306"
+	.ascii	"\034\345\355\230\341\347\364\r\341\337\350\"\220\024a\354s\257"
+	.ascii	"\034\344.\354K\372\204\367\376Dh\021\360,;P&\357\317Vi\202\177"
+	.ascii	"s\340\333n\2670\375\266\"\301\037\002\354\333\222@\364\276\346"
+	.ascii	"\357\001+\022\377\347\227\036lo\374-\320oFQS\024\035K\234t\274"
+	.ascii	"N\002J:\227\036\\\314\271\257\321\205\276\"\214\275{H\025?\264"
+	.ascii	"\251P9]:\327\333\277X\272\236\002u\025\354=j\216\257B8\273\206"
+	.ascii	"]\307\224\361\346\322^kS\335\252@\214Oy@x@\242\037g7zX\276(\027"
+	.ascii	"Q\237b\3768/\352C\033\257\260\371\350\365z\313\344\254\306\360"
+	.ascii	"G\270/\006|#o\363\211\254\342r\312Y\327\025L\343\260\375\223"
+	.ascii	"\272dm\261\222\331\274\371\007\034\027x\202\3253\360\347y~\304"
+	.ascii	"\024\331s\031\343O,L\337\271\035C~\006\354\013\032_ z9\027\357"
+	.ascii	"\305\217\021\013\304\325\275\357A\235\376e\212(6\016\207/\235"
+	.ascii	"\352\217\375\354u\221\307\257\276\201\360Z\376\370\370!N=cM\177"
+	.ascii	"Df9\233Z]\315lo\2137\303$\2110\205s\030\373\003\350\324\035\373"
+	.ascii	"\355\232\321\301b\372\033\361\370\375KO\337\262O\255NS\362\016"
+	.ascii	"\252\251\317?\325`\fq\315\337$\227\306\322\3650\362\034\373I"
+	.ascii	"~W\244\213\370\364\270\360\257b\203\360X<\206k\260]\377n\032"
+	.ascii	"\345\257\\\276\333\273+\367;\277t\357\206\033?\031\3709<\260"
+	.ascii	"\377\001\r\313\326\216\037U\001\276g\366\210^\206\273\241\201"
+	.ascii	"\233-_\322\312\032\177^\342\024\350\315a;\371\355\231/M\263\370"
+	.ascii	"\315\315\\YAi\210\025Wp\037\214u\324\247\375r\373g\370\3203\315"
+	.ascii	"7\017}\344\022W\352\203;\327\n"
+	.text
+	.section	.gnu.lto_.symtab.154d1cf003b5b972,"e",@progbits
+	.string	"displayClearScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"displayDrawScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"displayScreenSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"displayGrab"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"displayRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"displayReleaseAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"displayIsGrabbed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"displaySetXY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"displayWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"displayWriteChar"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"displayIsTransferInProgress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"displayIsSynced"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"displayHeartbeat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"displayResync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"displayTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"displayLayerSupported"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"displayLayerSelect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"displayLayerCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"displayWriteFontCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"displayIsReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"displayBeginTransaction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"displayCommitTransaction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"displayGetCanvas"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.154d1cf003b5b972,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,983 @@
+	.file	"motor.c"
+	.section	.gnu.lto_.profile.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\013"
+	.string	""
+	.string	"\020"
+	.string	"\027"
+	.string	"\030"
+	.string	"\031"
+	.string	"\035"
+	.string	"\036"
+	.string	" "
+	.text
+	.section	.gnu.lto_.icf.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\355\n"
+	.string	"T\020\343\001"
+	.string	"!"
+	.string	"\274\205\242\255\006"
+	.string	"\001\222\252\354\340\007"
+	.string	"\002\003\317\253\250\341\002"
+	.string	"\004\307\276\344\257\003"
+	.string	"\005\232\372\246\216\007"
+	.string	"\006\007\b\t\354\301\314\336\005"
+	.string	"\n\013\272\215\354\310\n\n\002"
+	.string	"\002\001\002\003\002\003\002\004\002\001\002\005\002\001\f\240\342\234\212\n\r\314\215\357\272\001\030\002\005\002\006\002\007\002\006\002\b\002\006\002\t\002\006\n"
+	.string	"\002\006\002\013\003\002\003\016\372\364\363\351\002\017\335\316\371\202\b\002\f\002\001\002\r\002\001\020\364\330\366\355\b\f\002\005\002\001\021\250\257\256\333\005\004\022\255\313\264\227\017\004\002\001\023\270\236\211\311\017\004\002\004\002\016\002\f\002\f\024\353\371\233\272\f\006\025\352\263\360\321\b\026\027\212\333\334\276\b\007\002\001\030\317\262\324\372\013\b\002\001\031\247\250C\004\032\350\300\306\254\005\002\033\034\341\345\232\361\016\022\035\333\354\351\313\n\n\036\211\244\373\255\f\t\002\001\037\305\217\201\375\006\004\f\002\001 \346\341\231\311\n\002\001"
+	.ascii	"% P\002a\322u\003,&\207\206\020\202%\344\340\002L&\233\006\260"
+	.ascii	"R\006\224\020\004\035\004[ \237\230\277\267hk\024$\034\343<\230"
+	.ascii	"\222\316L\026\004\031\342\200*\255)\b\016&\316V\223]\253\265"
+	.ascii	"\016\356]'0G\n\f\224rD5\304d\\r4\361\261\n0\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"\245\004"
+	.string	"BG\025\036\240'\351\377\377\377\377\377\330\377\377\377\277c\377\373\355\377;\263\377\333\364\377o\324,\221;\245F&D\037\315\242gt\346\230\215\311\330](\352%\0361\345\364u\212\251\3530\r\353\221\374\310\344\205M\314\022\366\301\026,\260\313\"\345\002\314\263\325\2675_\033'\001\032"
+	.ascii	"U\340B\261\273\323\210fC\326\005\324\200\210j\261\0079\020\254"
+	.ascii	"U\327\207\311Xe\330\n\r\327\304P\361\330\345v\274\254\242\n\001"
+	.ascii	")\273*\215\301\032;\205qY\334Y\320b\333\006\260"
+	.text
+	.section	.gnu.lto_.inline.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`Z\004\345\r"
+	.string	"\006\322=6@\305(\035\340\211B\273\002\372?\301\362\035\007\233\220\353n\360q[\276!\032\334'\270o\211\321(\267,\3030\314^\331\277\t\272\361\333\240\376\204p[B\266L2\005."
+	.string	"/"
+	.string	"*"
+	.string	"\016\300\324\031\347\214\243L\r\347\300"
+	.string	"\260a\271\255\016\032\022\241\b!\360eUPBMO\237\366);bw%\354\333\251}wWm\215\247,/5T\374\203\237s\323\021\022\350\242\362\200\366\266O\2568\343\266\303\227v\2672\305\271M\030\316\355\256\200\343uM=\320XG/\035\355v\027\013N\253\347\241\335\265\\"
+	.string	"_\324\354\310w\026\350C\037*\234\004\372\210\322\033Gk\357\036\375\205\224\330\236<\215=mjr\210t\324\256\344&!\276\221\005\350\363\201\031\241\273G\273{Y\363(+\2379\372:\007)\211\002d^\345yo\324c\242\"\003\343\314\001\347\232b\3764\f.\223)\317_\250\261tiD\210\246\214Ba8\260\"\231\252\352\006\022\200%E\244$\022\020\"\244\204\002\211\021\211\357\0031^n\210\204\020\311\021c\351\263&&Le\rS7\244-\023I\357\253\307c\266M\374d\313\270\263\031\022\027B4\311\025\322\225\027Pf\2154\353\237#n\362m&\240\353\n\013\017\337\375\200\211\002\343e\345\016\23440wR\217\362A\225 >\202\271\351\307!\30171\020a^B\037\021ZS\355F\266\261\352\t\323\265\237\352\b\242^\213\207BJ[\252\300\267\032b\203\351\246\017]"
+	.ascii	"G\267\034I\034\365\007\265\230d%\306>\364\301\372\221\366\252"
+	.ascii	"U\205P(\026\025\004\234T\353\030\\\243\036O\017"
+	.text
+	.section	.gnu.lto_.jmpfuncs.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"\025\006"
+	.string	"B\313 &\200)I\007&1E\320K`\006f@Gd\016\031S\230\020z\021\372\017\274\365\tIl\377\027}\003\371\204H\231\002\333]e\377\340`G\232\305X\365\022!H\232\206g\370\005\005\273\225`\267Y\232\020\220n\310\003\202\036\322\023\262\353\325_\371\235\266,\231\354\376X\034\013F\240\366\r\376\344\013\354\266\233\240\202\246\202J.<\212y\024\374\323\236!\2175\220\004\336\370\200\204V/\300\037E\363}\376\312\224\b\031"
+	.string	"\300\270`\033!\003gf\265\203\031\263\030\336\3067\254\033X,\021\377\01378\003\260\213\204V b\361\020\203\023\b`\025\315\324\023\253\241e\025i3o\004%\273LY\t\251"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.pureconst.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375 \\\205\002"
+	.string	"\302\005\023\034pk\322\001V\007F\375\377\177WUUE\217\316\343\211J\244w<Z[\263\264fw7\362\202\334\307\227>\307\252\261b\334\305U\334\304E|\207\227\341\026>\3027x\"\270\201\t\230\321\204\3463\235\331\314'3\227\251LKf&\t"
+	.text
+	.section	.gnu.lto_.ipa_modref.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`u\001\025\007"
+	.string	"b\t\034$\220\245I\007\340\273\273\333\367\377\377\377\347\375\377\377\237k\315\310\332\232\021#\333\376\373\377\375\377\333\276\375D\312\024\377OgjR\243v7)\350q\226\206a8\013,\250\374]+\277C\346\224>"
+	.string	"\214\200&\211o\b\276Z$\352l\355\253\344\201P\347\323\351t6\235L'\353\\z\274\332\r\223\345\354\363\244sU\375\n\013\204\201\2405\250\330U\0045 \300\002\022\252\352\274x8i\235i3^-Z'\302x\361"
+	.string	"4i"
+	.ascii	")\005\b\222\331\265\007\213\213\263\004\036\222\214\340b{\007"
+	.ascii	"\246\027\f\327\340\314\314\326k\341\230\346G\226U^\216n\bo\274"
+	.ascii	"\330`K\204\315\017a@O\220u\3618\rm&\020\350\202\203U\037\346"
+	.ascii	"\274d.\\\334\366~\2306\344e\253\265\305\334\367\f\273\212\013"
+	.ascii	"\212+\202\033"
+	.text
+	.section	.gnu.lto_.lto.96534724c0a4e414,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_motorShutdown.19.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\025\013"
+	.string	"\226\223I@\020\005+\035"
+	.string	"\360x-\020\001\207\337\016\024*\017\016\325\fl\305az\253\276\006B\"\353\260\352-b\244\273\270\263\020\311XU\273\023\002"
+	.string	""
+	.string	"(\004\025\016\250V\251{d\245\232\244E\022\264eJ\0016"
+	.string	"4"
+	.string	":"
+	.string	"2\035\202\256V\220^\201\272\373pPl?\364\313\016\220\360Q\260#\233\031Pk\025i\311_\337\227\377\226\203\314Y\371\035\210\250\265z\315Y\310Mo\233\301\266\203\375\215\017g\307\305\201\355\346\002\377-\r\231\344\216{\316\345\337\234\321\332\233\377\374\026\370\357tcj4\234\bl{\366Y.%\261\357\251\264f\177Mw\275_\237@\025\245\257\273M\272\r\nBe\305\004\332\245\327\230<"
+	.string	"n4\027\036\n\264O\247A}~j,\330x2\2246\244\260\200\326K\035\216\304hi{<\fG\310f[\374e\365\251\265\006&\211\310\2215\246\304\025Y\3028\221\024\242\3524J\211$r%\212\024<V\224H\2215\216\244\030\236\365\236Jk\237\316\016Fc6\3300\347\022\240=1\332\233\376\311\r\001\001\0364\026"
+	.string	"3\241\307\037\030V\353*H%\007\262\2504A\202\215\\\342:,l\007\204"
+	.ascii	"\203544sY\037\263\352y\313\206Z\262F\t\342\232H1\004\3622D\270"
+	.ascii	"\034\213v\222\001"
+	.text
+	.section	.gnu.lto_motorWriteAll.20.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\255\f"
+	.string	"F\330VC\020\221\232\0168\221\330\021U"
+	.string	"P\265w\273\374\177\006`{a\240\340\230\307\343gTf\032\021)\355\0035K\004>\360)\237\354\315\315\206\003"
+	.string	""
+	.string	"\"+h\305p\234?\002\310\317\021<\337X[\333\233H\231RA"
+	.string	"B"
+	.string	"D"
+	.ascii	"\320\336\013P\207\361\004\250Ckv\214\003\026\002\314\\8"
+	.string	"1\263\273\226\202\320R\373\244\251\371\033\217\212\353\266O\221\303U@\2472uv\367/\317\225.%s\343\261\273N\256\333p\303\333~`\233\201\375\220\206\232\316L\277\352\230a`\305n\206\232\032K\202.B\374\273}\317\207)q\023\332?\277\210\233\206(\363a(\355\356\306\241;\342ag:\307\366\323>\211\273h\037Y\305\007\354\206F\260\330\365\0268A|w\300BSR\025\331\204J\205\360\301PI\032\333\024.c\322\300OQ!\213\273\373\226\023\3520\265\032=\346(N\374\026\217\224\344\271C\277D\025\270\320\350\200\2225\266\267\245\212J-d\220\254!\373\243?\376{\237g\236\021\t\037$\224A8\260K\344\002Y\031\346!\371`\021\254\t\237\017\220\005\202e\026\007\002_!\036\314\022\271.\314\342x{\r\275<\306| \241h\312\244\"\037\346\025\213\b\017\271q\250+6\200\214j\203\256<\347I\267\026"
+	.ascii	"2\003\376\031c\301q6\371}gX\276df\265D\022*x\242\027\b\306R\227"
+	.ascii	"q\255*\264.\026D\240\252ppwUc\326J\264\270\233\301\200CM\336"
+	.ascii	"\256R\006"
+	.text
+	.section	.gnu.lto_motorDeviceCount.21.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\355\007"
+	.string	"\202\21765@\217\322\001\233\016\303\377@Gd\316\232\220\222\f\300\t8\337\264\230/S\263\026Uk\216\317\"\373\352_\264(\212\206\217W\363\326\005\210\013\255\377\021\331[\312\224\002\346l\"\004\301\317\273b\347\301\023\025\336\202'\341\3638\361z\033\002C\206N| \b\343\313d\373\266\232j\252!i\204S\233\276\324b\370\220\206\313\356\036\370 \020\327E%\262\356R1\036\377x&\362Uv\b\345Mw~\310\272\273b(H\271\262\263Q\252\205\375\266\232\2625\3352\235O\337Y\032*\003&\273\022+\226Mq#\031\2661;\343o\234\003\263KZ\206qz\005\252$\262\262\273Os\001\353\256=\300\272\323\213cO\314\177\307\333\t\n\305t\032=\001\020v\327i:M\334z\333\005\266\rl\223\004\f"
+	.ascii	"2CC\r\354cBIz\2532v\201\361\b\325\236\013\371\354\260\247\005"
+	.ascii	"#\304\265b\022&\031"
+	.text
+	.section	.gnu.lto_checkMotorProtocolEnabled.22.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\207\001]\020"
+	.string	"\366\336pH\340\262(\035\220\030e\270f\344E\314\241\226\352\213=\032[t\226\024\352\211\263uZ\327M\200!\212D\276\254\355c\036\201z\013v\332@\313\3659\303\f\234\343\220\002\210N\002\342\335e\317\2673\245d\262\202\330M\310\336)\005Z"
+	.string	"W"
+	.string	"["
+	.string	"\336A\350;\333\036\201\220\262\370Z{]\026s\311\360\354\326o\266\270x\332qS\212~\214\235[\316\314\250:E\361\216\003\201\321\300\t\215 8\0078.,\240\361\203\344~{\202\321\206\22533\236\370\004\215,.dwCcK\312O\205\335\265\f1\232\270?\267]\262]b\337\026\273\273\2363\373\365\247\267\375\335cn\311I\337\013\361\304T\310V\314\234\272\257\036\037{\323\335p\361\230\337N\3717\203\374\0301DU\3675\302R_\032\274\363\005oV\025\003U\001L\347\245F\202\224\366_\016\223\272m\345\003vg:j\354\326\007f\340\275s=\001\372.4\322\027)"
+	.string	"\331\013\027\315\374E*\247\b_\205\322\371\312\203\305\016\0349Z\262\0077i\336\361j[bw\027\320\232\033\225\374!wW5'\315\334\021\320\317\0027\233\226\354a\273\303e\234\274\335V\004_\006\345\301ky\347\257\320w\237\024F\264\304`l+\331cW\225\2344\373\\'#\024\f&\246\321\007\005n8\221\240\200\"\020\005\206%'\222"
+	.string	"\r\244\f&\320B\312\210$d\221H\b\242\300\322w\nG)\244\360\3443\221LJ\237(<}\"\007\fr\030\205\037\n\004\303\017T\367\334\316\231\234!\027\214\233\325d\321I\233q\177&\024\003\350L \241\023\203I\261\222=8.0\033\335\244\231\312j\256\033"
+	.ascii	"a\221\"\023\357\371\321\274\b\222\214uE\230\024Y\223 \003\222"
+	.ascii	"Cm\235\303v|\254\223\335ZB\363\361u\250\2545\330\205{ov\257\221"
+	.ascii	"I\r+&\264\013\364@_\003\324:S\265\\\204\272\217\272\377\265\345"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_checkMotorProtocol.23.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\204\001\245\017"
+	.string	"6\236jF\360\220*\035\030{\306q\265\211\304L\264\026\273<6\327\246\213\003\031\314\023\333\214,\323\312)\241dE\360\373\253\210\177\351\007@2\002\363\277\3259,Z\356dl(\243\353F\250\017\036|\266N\034\317\210%{\357\235RS"
+	.string	"R"
+	.string	"V"
+	.string	"\273\256\027\030\273\343\002'\360^=~@\367\352]@\367j\222\r\363\361\265\247\271\244l2\273\373M\023'\235NI\362S.\305\030ZnE,\235\336\366\003b\313)\267\"\216\370\334\210'\352\261\273\035\"JJM\310\356Z\252D\021w\275m\n\266C\354\327\b\366kw\245\322\364\263_j\036\303\322z\231\271qW38\026We\234x\355\267\357\323^\363m*\346\200\220D\037\375`\365b\305vW\344\253x\363j\016\210\350*F\036\245qW\234\022cLfwT\360\352\006\336\3537\266/\355\307.#}v\362"
+	.string	"\001\207\371\003\312\253\300\356\325\001\b\027\226\214\004ma\030\357\265!v\027\301k\307\202+\311\034rwKs\242\230\336@G'\001Z\013J\336\360k\336p\026!o\027\305\300_\321\201\203\017{\365O\272W:o\273L\361\001\306\222\315Lr\306\036Or\242\330\247\273\273\236\256$\235\f\025D@\035\315\005\217\005\020\b\301\244\023\241\303#\037!X\002~\276P\3301\361\204$\037\310#\362\371F\302\320\367Q\300\240\206N\370\225\200`\370mF\323\351N\227\001\264P\244n\363\037u\267]B\353\225\272\311\337^\247\207\t4p\246yr\23510<\345\2225Ce\343\243\316w\361\027#\007\034"
+	.string	"a\221\3024\036\361\033\331\013!A\b\270\227\350p/\273@0\253\025v\fD\230\321\202\233V\260\232\026x"
+	.ascii	"Z\213\320\304I\006\032\273\33756\030\206\207\025\245-\022\303"
+	.ascii	"EnV\247\305\265\\\023\351\243\332\377\204\362\004"
+	.text
+	.section	.gnu.lto_motorConvertFromExternal.24.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\255\n"
+	.string	"\226\324JB \253(\035OH\304\021\034f\031\bX\217\221\246Y\231\23408\204\351\261\001\305(\276\357\270\210\326\360\241^\026-9F\363\220\022[\200\221\004!\2219\261\35128\343\305\262$;v\376\204l\"eJ\0017"
+	.string	"5"
+	.string	"9"
+	.string	"\366\t\274"
+	.string	"h;\300\302"
+	.string	"\253S\260\200R\220aw7\316%\262G\354\021\331\243\0028\370\004\375\03786\200\345\225R\231\236\332\306\356:S*\225[o\333\302\266\206\375\212\352b\307\264\366\360\217\231V,\235\232>F\2730\201\002\303n\312K\303J\210\020\004\330\006\355\214\355L\373\254\033"
+	.string	"\037\2328\356\266Dx\260\033b\370\002\363\b\221vQU_\001\265\301\2407\030\331\264l\2173\020av7cAI\247i\255J\331c\352\306\305:\202'(\371+\203|\371\324\243\377e\217W\215k\345\224/;4\245\276\330\3076\\H\310\303\021\362\214<\216D\302=\370\323\361:R'\332>\217\023\001y\035\333\b\344\021m\037\357\333:\023\356>8o#u\235\267e\302\275\255)\347\244'vHU\247j\312AQ\223\003\017"
+	.ascii	"2\003\302\260+&rV\267]\314G5\365\032c\300\244\206j\304\205\221"
+	.ascii	"(3\315\2011\002\232xRRL\327$\003"
+	.text
+	.section	.gnu.lto_motorConvertToExternal.25.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\025\n"
+	.string	"&\223E<\020\005+\035"
+	.string	"X\004"
+	.string	"\346i\215\002\346\003\237\207F\344\007\2209\327\371\244\364\231$\233Y\350m\350\214\304\303\220\234\356T\371\256\252|\307\221\213\336\202\362\377).\371\207\320\336d\313\224\0024"
+	.string	"1"
+	.string	"4"
+	.string	"),\2674,\351\2304\334F\013\200\335\320\033x\301\274\324\023\314\313H\362\326\265\345\177\345\335\t\310\r,\346\272r\034v\327\n\213y\334\361\266\021l/\3307\b\017\377\256SkT\237\303\301\331\200hv9r\001\266F\312\230\330f\331\036\333\252\366gWa=t\315\001\2733\265\230\335UpB\3472\324\331\366Q\036\207\271"
+	.string	"\331\354\323_\276\316\3562\270`T|l\262\325\274\324\b\272\315N;\313\312\227\031\245\322\303.}\325\274|\374\334>^\232\263C\227\306\021\373\335F\021\317%\225\304\350A\300$\021\370\245\276\223\207\002K\026&\020\302\2330\215N\036\tDy\242\003\177\024%\320K}\037\350y\302\275g\f\275b\206=\332Ek\234\261!D#\272lG\004\020"
+	.ascii	"a\221\"34\030\261\302\234s1\037\325Tk\214\001\223\032\252\021"
+	.ascii	"\027F\222\261\246\250F:0F@\023FJ\212\351\232d"
+	.text
+	.section	.gnu.lto_motorPostInit.26.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\355\007"
+	.string	"\002\01766Po\322\001\240X\354\320,\3149.P\332}-\\'91"
+	.string	"v^\263\322\bA\367\335\2215\026Yn\202N1\323\306M\367\320U\253\344BH\242\265\331\266[\246\024\356p\246\fIP\264\246\007\3423\027\"\303G\001\024;\323\212\234\001\313\006\317\214!)g\254\270\375e\237)\001#\225=\2225j}\2564H\017\263-/\"\261\331l\207\207X"
+	.string	"\273{\300M<\bl\247\021\346P\337\246\003u\220\243F\376\311\021\"\275v\350\2130\207\1770#a\311\310\264\2639L\337\206\375\313>\223\255j\275\3720\340\"\245\300d\267\242k\331\024<\361\260\375\312\227\255rn\333\217t\024%+\273\033\037\307\257\353\345\377\343\032\255\204]3\b\273k\325J\026\367\273m\002\333\006\266Q\002\r"
+	.ascii	"3\241\003\f\374\353\335p\261\031c\217\363L\fe\207E\265\347B\216"
+	.ascii	"0\330\177\031\027\\\272E;\237"
+	.text
+	.section	.gnu.lto_motorPostInitNull.27.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375 \300E\005"
+	.string	"R\311#.pU\323\001"
+	.string	"\345\3013"
+	.string	"\030n=W/V\213\261\375\206o\021\023\250yV\355\300w"
+	.string	"J\247T\325\003\0168{\264\005\370\246o\321\336)\005\236\244)1i\3515\251I5\037\032\251\034\226N\363R\ta)\241\246bRN\215\274}\354\022\224X\261=\r\306\215\375\301\306\316\206\007\r\300B`\027S@\260!\002\310c\373\2213;\340^g\377],\337\300\356j\344<;\314\374\177n\3308\355\260\320\330]\303\215\313\334\361\266\025\266\031\266!\001\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_motorEnableNull.28.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375 \307\305\005"
+	.string	"\024\nk"
+	.string	""
+	.string	""
+	.string	")"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\243\315\262#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\230\205\007\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\317)\361\370\260S\002"
+	.string	""
+	.string	"\244\003"
+	.string	"\200\200\200\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	"\033./src/main/drivers/motor.c"
+	.string	"\b"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\230\020$\334\271W;\237"
+	.text
+	.section	.gnu.lto_motorDisableNull.29.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375 \300%\005"
+	.string	"R\311\"*\200k:@G\006\016\360<\207 B\333V.]\242\255\307H\316\340\266\371\355\354\353d\024)\246\316_\265\020"
+	.string	"B\022Y\271e\n\257\250)5\211q6\255\3065\023\274\270\020\030W3c\212p\311\260&kRN\226\302\326\375\n\216}\374!\027\027\374\025\320\373\375q\200\341L\236\356H\b\324\233\200\306\362_\245o\177G\303JG\340\004\222\371t7/E7\215\333U/*\350<Nct\350\356\307\316\223\350W\377\033\376O\377\025\001\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_motorIsEnabledNull.30.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375 \350u\006"
+	.string	"\342\313,3`m\322\030\300\215f\017\313\250oH\003%\363m?\235\005\211a(\236~k}\247b/\304B\271E{\t[0\220qi\350\212\n\031\340\r\001\031{\313\024\017VfsIc.\317u\234F9\317r\270^F7\027\203F1\217\243\227\201]\203\365\264\343\334S*n\302"
+	.string	"\202\210&\361\361\303\232\306'\300\266\214g\013\242\321J\205\262\013jaY\221d\342\361{\236\372\033K\020\210\333.\006I\311n<\270\022H\351\037!\3013\314\310\001\232&:*DF\273Q\333F\302d\360\314\220,\3708IQ\031\t}\222M\n\273;\263\b]\344-\177\203_\177\212\t"
+	.ascii	"2\003\202\341\243\302b\025\220k8x\3048C\310\351y\373\325N2"
+	.text
+	.section	.gnu.lto_motorUpdateStartNull.31.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375 \307\275\005"
+	.string	"R\n(2pU\323\001"
+	.string	"\355u\357\312\033"
+	.string	"\340\312\347\367\023|\26309\365K\250\031\370\211\335\354\333\350wE\020\342\270"
+	.string	"\020>O\256\260\376\020z\204m\355\3362\005\257\250J5\212\315\254Z\230\253R\246\345\232`\263\252\331\244\022\247\027\253N\215\322:\247\333,\277\263=(2R\363_.J\360\347Bw\367\345\367G\211(<p\btw\t\b]`\030\b\375\337\376\351\017\310v\313\027\3241H\332"
+	.string	"\204\335w\312\017[\216\366\314%^\214\b<\006\001\036\307\021\021\351\356G\216\327\341K\376\317\370\337\370_\t\007"
+	.ascii	"U\b\230\347\220\254\202\247k\036\023\202\204;\367j\347\023"
+	.text
+	.section	.gnu.lto_motorWriteNull.32.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"M\007"
+	.string	"\262\31633`\215\032\003\300\216\005r>\242\033F\353i\006\210\364M=\324\335y\376'\262Tj\323\205\370\272\332\374\243($d&\004:9D4\313\016\373Dn)S\n\030\203\302f\364\032\260\016\310\363\312\311\310(\212\037\030\222\330\310#;\020\344\331| G\206`f\240q\001\223P\024\243\204Wv[w\250^\036\034D\233\221\232\243hm\335\241\332v\235D\fH~\211\023\223\207<\017\214\266\276\332\272\326Z\303\033\323Y;j\371?@V\3771=\250\370],@\361\263\034@\361kk-\202f:\303\241\356\237H\255\376\f\323\202\212_g;\342\314\342V\245\"T%\377\241\253\360t\233\2659l)\231Hn"
+	.string	"\t\377\333J\246\223\353\334\226\240\255\246\355E\b"
+	.ascii	"2\241c/0.\034\327p<\026\006B\205\211\340\316-\332\371\004"
+	.text
+	.section	.gnu.lto_motorWriteIntNull.33.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"E\007"
+	.string	"\362\21523`\215\032\003@\203'Dj\006+\224\273\302\200\367\255>\024`:T\004\"\262\326\370M\027\342\353j\363\217\242\220\220\231\220Qr\205\344]\243 \251\264R\246\024\327CC\247\344 \256\217\b\344\352\331DH\202\2417\212W\t\024?O\004\352\204\236'\216\336\206\240\320\341\212\217\004a|\326\274/o\252\026L4\212v\232X[\265\276\274\251Zf\245N\020P~\213\026\226\233\270\022\216\266\266Z{\370CzF\324\375\030*\n\032\273"
+	.string	"\017`\354\230\0050ve\254]\340HwH\264\375\251\021\222\177&\364@cW\331\246xj<\263\022\251\bY\371\377Z\206\245\231\254\rb\200\023\312d\226a\370_vB]\270\315m\r\332r\332n\004\n"
+	.ascii	"2\241a/0.\034\327p:\026\306\024\306e\352\252)5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_motorUpdateCompleteNull.34.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375 \3005\005"
+	.string	"RI#-pU\323\001"
+	.string	"\345\276sL\320\005\350\370\225t<\307\377S\201l\330\346Y\265\003\337\001(\235RU\0178\240\354\177\b=Bd\321\336)\005\236\244)1i\3515\251H5\033\372\250\030\226N\363R\311`\t\241\246bRN\215\274}\354\016\2228\261=\r\306\213}\301\306\316\206\321&\244\360\354V\006\004\0264\350hl?rf\003\334\313\354\277\017\345\013\330]\215\230g\207\231\177\316\013\033\247\035\022\026\273k\270q\226;\3366\302v\302\266#\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_motorShutdownNull.35.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375 \300=\005"
+	.string	"R\211#-pU\323\001"
+	.string	"e@\375\262\336\377\323\240,\340-\177\203c\304\004j\236U;\360\035\200\322)U\365\200\003\312\376\207\320\263WE$\267L\001\237\244)1i\3615\251G5\027\334\250\024\026O\363b\211p\351\240&cRN\216_\353v\005\310F\376O\203\353\375\032\350\355~\0303\036\004\250{\022"
+	.string	"\320\035\301\346\362_\343\263\377\243\237\245#\217#\321\204\272\233\267\242\231\302\354\252\030\035l\234\2460Jt\367\341\306Q\364\253\377\r\377\017\377\031\001\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_motorConvertFromExternalNull.36.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"\035\007"
+	.string	"\222M14`m\322\030@Cf\025a\273\t\252\007\304w\207\177\355\374\345\016=#\304\240f\007\353i\027\262\240\007\322n\213\"b\340\265\327\201\230v`\316\231\265{\357-SV\203\202\006\364\336T2~b\007z\244\005\342\310\004\270\300\321t\340Fz`5pd\260$\374\304(!u\255\272m\244O\004\231\207\006\361W\210\265\322\253\333FzF\215\224T\"\273\022+*K\362B2\376\371\324\317\330k\207zL\275\034~\273\024( \273\327\301\006\030}"
+	.string	"\354_7\224c\376\311]\026\027\027\323I\204)ewaF\005,\372\234\006X\364\265\n\235\312\346\252\037\35240LD\243\220\262\013\302\356\316D\243\t\275\351_\360\303\277\024\n"
+	.ascii	"2\241S/0\0368\b\341\270\206\237X4\016L<\270\373\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_motorConvertToExternalNull.37.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\005\007"
+	.string	"B\31505@o\222\016\230\260H\251\377b\007\360\366\222H\004\244\3010\244w\031\\o\261\277\331\361\347\303\245\307ql3\237axT]@C\314\314\007T\016U\324Z#D\246\027D\203\006D\275\311D\354\203u\240'^ Nd\200\016\034M\007n\242\007f\016\306\036\256\b?\030\026\241\265e\265\n\023\361$~\013\271G\372N\3710\336Y,)P$\223\342\305%Q\250\222\322\237\275\365;\367\365\350G\326\355\221\0052OTH2S\341\204\200R\230\351\277\034\355\310\326\334\246Q1@Z\231\bi\311\334 A\r\252R\256\005U\251\227Q\255N\273\005\351\264Q2\021\215Bu"
+	.string	"\013\231\271\023\215,\372\353\217\360\303\377\"\n"
+	.ascii	"2\003\202\341\243\302^\025\220k\370\211E\353\300\304\203\273"
+	.ascii	"F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_motorNullDevice.39.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"?\202\210\200\020}{\273\001y\273\001"
+	.text
+	.section	.gnu.lto_isMotorProtocolEnabled.40.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375 \346]\006"
+	.string	"B\f-3Pm\222\016$\243\252\022!\206\230}\001\020"
+	.string	""
+	.string	"\312K\232\253\354-\331U\373w;\300\263\231\"\266\233\275\256\252\252\256\210\303\3338\304hp\324\030\255\221-S[*\317m\\\246i\336\005\002\363\032\232\003\206!\323,O\323*\004\273\207\313k\033\347^\243\\Y&BV\360a\022\337\216zT\027\343\b\016\326*u9"
+	.string	"\245\220\tX|\260\364\227\007\331\305w\312\314\234\211~\034\331\200H\211\002H&\250t\222$TH\306\337y\312\b\t\235\253^$PG\244\211\017\223\314\253\261Q\253bu\313\321Icc\304\ny\212\001\013\2319Z\241\212\316\372\033\374\007?E\007"
+	.ascii	"2\001\0238#&\016\345\256!K\210\034\356\234\251\235O"
+	.text
+	.section	.gnu.lto_isMotorProtocolDshot.41.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375 \346e\006"
+	.string	"\002\214,3Pm\222\016\244\204\270\2327\210f]"
+	.string	"\004"
+	.string	"\200\267\221\346*{Kv\325\376\335\016\360l\246\210\355f\257\253\252\252+\342\3606\0161\032\034uX\373d\313\024c.\317u\334\246q^\346A\363\030Z\203fa\3230\217\323.\003;\207\314k\035\347^\263XYFBF\020b\021_\217~P\027c\b\017\266\352t=\225N\310\002*Bx\275\005Bf\361\245$#\37582\001\222\221\204\222L\321u\222\"S\210\306\377y\313\007\b\237\251Z\027\242\2262$@L2\255\306J\245\212\324mG)\033\034W5\002\025\001\0242s\254F\024\235\365/\370\r\376\211\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_motorDevInit.42.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\227\003\345\031"
+	.string	"\006/\247H\240ZQ:\304\013\373})[\337gO\020\032s\336C\345\254\371r\260\215\231\247X_T<)8\367\335\253\375\237\007ZT\273\355\372:Y\361\rU\f$\300\203\341\331\201\356\272\307\023\243\333@\322\314\221\317\022\2627\221;\311\217"
+	.string	"\212"
+	.string	"\222"
+	.string	"0(\353\006\335lP\020_Y\364\224\371\275\373hW\212q\001\367\026a\211r\357\371\200\031\210\257|\276\200}\025O\300\2762\2159\314\317\243\373\337\021\034\0234\367\336V\0139\355bh+\330\224\306\017uV9]\355\342m\273\207\241\316\017\034\273[\220\300P\323\024\251\303\201\016\246\214\354\230A\253\216\203 \003*)gF\235\f\260\200\320\220\034\251\013\242M\352d\2009\367\336\377Nk\350n\224\206:\367^\2469\035\216\363\352\314L\203\231G0w\220\357\020<\250x>%\033m\303|\336h\0331\037\274]\304\374$?\353K\376"
+	.string	"\2252Y)\343\234\351|s\245\177\\Q\016W\224mS\256M\031l\312-R\376\201\005\\xDB\220\264\227\363\n\265Ys\243\352\024\"g\372\231\317o\272\223\213\034PI.\230G'\177\302<\362\354M\270\245\240\306\031\363\370J\377\343\221\231\231\314\234\332y\205\" \211\352\241\271\367l\360\312\0328\202\004\332\227"
+	.string	"\235uoRDv\372\374\022\355I\002'\224d\t\033A\017\037<\337\256\332\346_9\226\027\b\021\"\354k;\345\310\f\240\335`\327\036\233\231D\t\372\234\355\034\\\327\230\3255@\203}\034\233\233\356\376\351\375pl\370\311\227t\004\266Q\225\343\254\304h\031c\305\004N\377I\217\347\333\321{o\255oZ\262\377\273\200%1Ke\244\300\004Q5\314\247\362'\223\217\304<%}\256\264\257d\337\351\224\210\307\021\317\267\263]\201}\337\364\235pO7N\361(.\361\336\240\t|(*V\210H1\354k/ \016=%\017\354\305\f\366\241\234\231\244\017\314\214\355"
+	.ascii	"(g,L\016%\213\036\327*\205\013\005,\266\363SV \231\007\202,\346"
+	.ascii	"\023{\265f\262\362\307%\353i\301\\&^-\036\331\254\005!\001\307"
+	.ascii	"Z\224\262\226O,&k\215\247\355\340\355\"\260\315\2154T\266\276"
+	.ascii	"\211\n(\263\205\013\3649\356\256}\250i\252H\330F\314\030\376"
+	.ascii	"\305\224:\223T\265\3012gx\227\r!z \361z\277i\231;|\213\271\002"
+	.ascii	"b&\251\212\331\303\243\200\304{\357\004>T\213\017\006\216B%U"
+	.ascii	"i\210\246\214\fI\261/\033vD\2501,\203\230S\n\022\tf$\030ZP\230"
+	.ascii	"c\200\002\031\271:\017\021\240\2616E\013R\267\001\330B\341\233"
+	.ascii	"cJ\030\361\257&`\f\300\201r\002%\222\3506U\341Q\036I\370t\024"
+	.ascii	"\252\245\235\232\200wo\357\247\027'\022\225\016\007&\323FB#\232"
+	.ascii	"M\362\030\202Z \233\212\261\"\023\235\256%\344\207\345\371\023"
+	.ascii	"\003\224\302ip\232\021\255\2219en\206\373\335\327Y\2738\253p"
+	.ascii	"#\022\363\035)\302g\006\005\013\204\260\333\302\t\354\006s\312"
+	.ascii	"K\243\374$\275\254\361,e\305\f\337\264o5\246\002"
+	.text
+	.section	.gnu.lto_motorDisable.43.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\335\t"
+	.string	"\326\021A7@\257\206\003@#\353\037b\331\230\343B\365~\2041wa\201\223\3704\006\031\200\211Y\3374\033a\221\375\377\277\323x,\272\375\207\027}#\016\333\342-\223\261\375\245L)."
+	.string	"."
+	.string	"4"
+	.string	"3n\005\304\3667F\331-\037\305}\312\013\306Imw=\3658\352\211\362/r\r+L=\001\022v\327\311\n5n\275m\002\333\006\366\025\002\262\223\0173\205)\317:\347\233\272s\327\002\027\255\025\333P\345\315\036S\251\035\3661\253/\373i\315t>\375\314\303\255\271 \260\354f\334l\0334Qg\207\216\"\312|\254\030\020i&\252\334\352\026\242I\247z\303\261\322\224\355\357%\026\034\321\2168\t)\263\273\007\343\205D\200\b;u\347R9\037\262\307\036\366t\300\257\364\215<\022\370\231\b\201\016\336C\250a\344y@\222\327\021\360\007\361\001\275\322\367\201\336f\334cV_\f\341L\245+\373\240\316\376\\\005\264\340\262\265F\002\024"
+	.ascii	"3\241Q\037x\307\272\226\322T\n6\207\211;\262\260\007\210\033"
+	.ascii	"\006\027hh\346\262>fu\364\226\r\265d\215\022\3045\321g\b\344"
+	.ascii	"e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_motorEnable.44.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"\365\013"
+	.string	"\306\225M< 1T:L.\360\002\365F\300\020\020\300\035<k\340?\216Q\n\202\303\376D\013\253\376?\341N\265\266g\300\b\333\363\241\321\005\004.\006\313\321\357"
+	.string	")\224\234\311"
+	.string	"5\262\267\224)\005<"
+	.string	"9"
+	.string	"="
+	.string	"\251\325\356b\032\342\237G\250\371\361\037\225\b\327m\217\220\r\207\220\200\312\205\r"
+	.string	"#\022\334\325\211R%\335\005(`w\217\342\231\241\013e>*\273\353\344:\r\267u\333\tl\017\260\257 \217>\307z\274\026(\231\360p\342"
+	.string	"\312\016\373\333RA\330\207\253%;\323Q\3230\323\371\364#'\355\252\006\202\030\273\243\216\034+#\276(a\373\227?6\215\177\336\276\005\207!Q\337\341CH7\333\017\236\252@\361\2349\213\354\321\200G\021\361\334\335M\335\261R\031\254\230!J\034\266%<E\007\262\273\007\374\317\202\006b\362X\217\251\021\324OGy|\223'p\362\\\266L\264l\223e0\215v\241\200\321\032`\0200\0132\230E\323`\223"
+	.string	"\316\"\\4l\223e\032v}{-9\222\366\206\n\244\241(I\373\342 \317Yu\263a\234Nx\360*\0365G\\i\250\001\034"
+	.ascii	"3\003\3569$k\340\261-\313\207V`\025p\306\027\330\240h\272\b\301"
+	.ascii	"C\034\n\321!k\213GX\006\013\325X\201\305\326\267f\257P\213\327"
+	.ascii	"(\361\\\303\345\206P^\206\b.?0JUsj\306\331\256R\006"
+	.text
+	.section	.gnu.lto_motorIsEnabled.45.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"]\007"
+	.string	"\362\31525`m\322\001@\203@\024\026b\354\301{\213A\210\244\224\320\005jX\250\020\315\"{\257\253\266\273Y\325`\267"
+	.string	"\240X\230\355:\002\373\t\345\232j\007![\312\224\002\326d\340\363\274\216\273\340\006\202\003\031\\\003g\241\3434\360r\031\001?\207\rt\236\367\240\303\304}[5\251\016\214t\302\366\365\020\314\262\273\b~\224x\260\234@\326+\325\013\352 G\201\374\223#>\371\354\225\377\261^]/\026\243L\331Q\224\212a\277\255\232l\2475\323o\001\036(\n&\273\244\324\312\236T$\034\266C6\306\006\007!c\217\032\244o\\P\210\250\354F\247\031\307\236\230\377\217\267\222\221\224\254$z\002$\354\2563+U\334z\333\004\266\013lw\004\013"
+	.ascii	"2C\027\r\f\304b\\L\b\020<B\335\347\032\376\030\341\226\020$\334"
+	.ascii	"9S;\237"
+	.text
+	.section	.gnu.lto_motorIsMotorEnabled.46.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\265\t"
+	.string	"6\223D;0\345(\035\236\213'\225\257\177\n\207\366\343\2111\0169%\230\271\264\361q\233A\276\021\255\376r\024\364\207\030lC\200\215+(``\214N\275\256\310\311\2164iuI\354&r\247\0243"
+	.string	"0"
+	.string	"5"
+	.string	"\341\201\r\270K\333FH0\371\364\320\203\365\217\r\025J\200\335pj\307O\217'\377\"\327BVXV-\324\343\266\260\273\216\253\026\306\255\267]`{\332\347\002Q9\354k\253.\333\321\333a\277\324h\225\321Q\213>7\360\022\303\220\262\313\232\tX\030\351\002b\373\266M\266\306\266\306\303(\254\273\032*-\273\001\252\007\240\032\340\356'\021\234\230\355p\023\021\267\273\n\227~I\205\267\211\275J\231\313\250\034\331\310I\036\226\374\227!\300\370\325\245\017f.\257\033YF*\316\354\020\025\023!\320\250\223\376x>\217\344\211&\370\205$\272\0174G]\203h~>pz\b\354=\204\276I\362\274oj\302\275\266\352\332\264\223R\013\013DUG\335\264s\241(K\r\f"
+	.ascii	"2\241\035\f\034\371\205\313\352\f\227q\320\330\005v4T{.\344\271"
+	.ascii	"0\006\247g\203&a>\001"
+	.text
+	.section	.gnu.lto_motorWriteAll.part.0.50.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\227\002\r\025"
+	.string	"V\250\207H\320\360(\035\202\360\265<sp\002\332\024S\006p\207\226\253\311-\242\007\340q$\343\036l\212\375v\245\225\371\313\376v\251\3041\337*\354\247.\2317\310\325\fbn\032\357|\234,>\376A\004\335\371\350\377\222O6\2212\245p"
+	.string	"k"
+	.string	"t"
+	.ascii	">\265\253\360\320=\346\304\351)\232s\\pi\005\342\245\307\007"
+	.ascii	"\b/\305\177\204\227\366{l\323l\245\2179S\347\232\255\004\202"
+	.ascii	"c1\311\370\230\346\234\256\313\025\341?\035\034\357\325\332%"
+	.ascii	"\270\032\326\374\367\236\312\355l\227\232\333y8\b\242p4$Z;\030"
+	.ascii	"\320\244i\311\350\277\353\314\356EW\305\323\341\372\361\020\365"
+	.ascii	"`\316i\361\303\215\272m\231\355\006\266\332\b"
+	.string	"K^\034;\245n\255\272\003\245f\211\352\225\n\245N\205jQ\325\250\217\177(\325R\252\301\013\335\013\252u\325\377\3600\3404'\315\223\323\274\221F%.\364\333\367\205\376\343\377\274\n\2429\004f\234;]\317\017bq_\355@>\022m:\261\305\317\206\2459\247\310\245\031\210\227!\340\375\036\315^\255\254\372\221\0062N\016:\253\332O\361\317\275vdD\r8\347\234\273<\333#\337U\355e\324\020\305\330\264T\\\337\340\326\346\335\324Zs8^\244b\"\177\307\367\320\376\306\f\b\271\341\242\3661'n\372d\360\246\021\202+\3671&n\013n\350\223\311a\303\016#\303\001\233\302_\304\b\344\3149K\\h\250\340\357\\\372.\341\245\356\177O`\363\241\360y\321'\3577\b\t\267\323\345y\303\233\3444\005\261\257\3000Xx\265\204>!\231\311Xd)\256\225\031\254%6Cq]\210\275R\\'\263\025\027\311"
+	.ascii	"\313T`3\027\213L6s\255\2768v\357\"P\210\244\227\275\311\345\371"
+	.ascii	"\277\253\222xl\366\333\001\300\016nnk\263\r\3413R\n \305\004"
+	.ascii	"\240\264\366\275#X\001\004.\317R'\024y\207\216\252vw\206\265"
+	.ascii	"\273W\372\251\001\243M^-k\037\341G\022\3049g\311jS>F\217\341"
+	.ascii	"2\341\245\0016 `\002!cX\036z\n0\303\323\bb\017\262j7\341\020"
+	.ascii	"\253Xfd\373b\033N\341\ri\230\353,\355\372\201\034g6i\310\307"
+	.ascii	"\320Z\202E*\344:\247%\036\203\336a-\262o\240S\243V\313\336q`"
+	.ascii	"\367\3362\207$8\nNX\3310\202\026,\306\334\"\271\246\262\200\344"
+	.ascii	"B\300\002\340\206q\356j7V\021\2464^\235P3\335l\006\250\005\274"
+	.ascii	"1\343\356\204a\246I.an\332{\202\302\003"
+	.text
+	.section	.gnu.lto_motorDevInit.part.0.54.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\f\005\255\031"
+	.string	"\026\351\232K\220\224N:\034\252p\372\213\005\234\317B#v\366\177K\024KG\374\024\320\264\260\017D\003%\024\201Oaulq\272q\377cq\251\330\212\265\270\251\004"
+	.string	"\253X\231\246\036\314uC\325\344w\032\251\244\007o\255p\201\031\333\226\354$\003z"
+	.string	"\204"
+	.string	"\215"
+	.ascii	")\227\f\3711\242\025T)'O8\321\333\375\346c\260\037#Ri\346\247"
+	.ascii	"\277`:\033\034\267\203\346\t\370\216\177\037\340;~X\003\217\033"
+	.ascii	"&\206=X\321\212Q33\3010\337\276\23697]\216{\301\357\370\314\356"
+	.ascii	"F65\333=\367&V\276\231WR\3313\347\234\036\243Wg\217\336\036\333"
+	.ascii	"\377\332M\226NFGO\234\240~\005\274\007\340A\316\271\177Qo\374"
+	.ascii	"\356\216\351\356\r\335x\r(\n\356\002L\345\314\224\207\227\251"
+	.ascii	"0\333\326\325\216\003\t%\302t~=\327\346\215.\352e\023\247\002"
+	.ascii	"3\363\242\313GM\227\356\237.RAB\345\274\342\322\343\223\375g"
+	.ascii	"\177\332}\335\357\263\275m\205r\353Z\3736\356\354\006\366\317"
+	.ascii	"k4\n\347\006\374\351\333\027C\366e\234\306\325\276\326\300\260"
+	.ascii	"\264\206\211A\036\355xU\262\021\022\264\343S\262\022n\353\302"
+	.ascii	"\357\f\311\222\223 p\331g\2607\033\272)\371H\271\344\234\360"
+	.ascii	";\016Wy\2230X0\004\255\026\313|\036\013\266D\t+\026d\320bAx\222"
+	.ascii	"\340\335\223\246&m\253$\374H\215\221:\n*KKU\341tj\2219\013\301"
+	.ascii	"\004Rx6\037\022\224\023\202!g\246\375\3029\220\234\037>2\350"
+	.ascii	"\314\264]\032\336C\347\315\315Di\247\f\202\326\034\324\026\251"
+	.ascii	"\347\324W\316\311/\273w\316Cm\231n\341w\364\034\300\3129\313"
+	.ascii	"\344\270\216a_\353\270=\020\357\227D\337\361\233\302\354\226"
+	.ascii	"%\2227\357\242V\215\366\336\313hUw@\305\240\225\346Dx\364\t\272"
+	.ascii	"\021\372\360\fMz\206\035\212+\215\2200\002\nq\350\206G\250\026"
+	.ascii	"\211\216E\034\3411\b\245\325\027\343\n\264\022\323\243Q(44\362"
+	.ascii	"\244\305\341\0161U\215\307\364\305@\257\037\204\306\024h]\215"
+	.ascii	")\360\275\214V\265M\335[\022U6\212\242V\227\004\261@\\\324u\272"
+	.ascii	"O\304\276V\263Wl\326\375\222\315\362\035\3436;2\024jK\373\226"
+	.ascii	"\342\216PE,m\251i\333b\305\r\241*%\261`\271ZZ\025.\356\021\313"
+	.ascii	"\025h\250QX\204\230T\"\023D\222\026$\303\030\340\002\021\"\342"
+	.ascii	"6\0210\251D\210Q &\005\345\353\370\246\270p\035&\275+\024\314"
+	.ascii	"o\243\213D\357\372\333\002\215\300VO\230B\230q\033+\200\344\026"
+	.ascii	"(2\226\rfP\217v\370\367 \252\332\374\256\200G\321\337\004(\223"
+	.ascii	"|\021y\236'@\231\344\213\310\363<\001\312$_D\370!\242O\222\245"
+	.ascii	"\032\210J\221J\007ZT\370\220vaz\227\300'3\334\033v\252\320\321"
+	.ascii	"1\345\341{\301\2359\bU\344n\351\3659\313?[\266\315\302\\\321"
+	.ascii	"\336 \007\260\2717R\t8h\302\222\2102\223\230\215\022\037[\203"
+	.ascii	"\344]\031\271\265s\036\023Z\224\327?\r\310=\005`R\221\355\n\214"
+	.ascii	"\317\020\177"
+	.text
+	.section	.gnu.lto_motorEnable.part.0.55.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\255\t"
+	.string	"\326\221?70\257\322\001\204\330cc\222\030\262p\341Z\\\307\206gYu\372\260\325^\310ak\336\374\311\377\374\222r\274\3433,(d"
+	.string	"i\276i\262QlS\342\322\266M\244L)."
+	.string	"/"
+	.string	"1"
+	.string	"&;\345\262\327\336\344\273\230\265\354n<\324\216\233\256\271\231\374\307\036\360\251NW\001\225\306\223\340[\206aw\r\260q\303\333V\260\255\261\217\020\376\bsxMh\201\260b+T\326R]\326\355\333j\313\326tf\372\031\315j\200\265\213Q{Y\016x\342a?V\2629\356\360!\266K\031\016\263o\205K;\342\223\377R\023EEsQI\351\311?\bcw'\001\025\274vw\301\037\261\b\3710\022\346\360\340\305\342\213\\F\362a\246\030\345\277\303\346l\274N\324}b\310\353Tx\274\207(\341q\370D\216\027\212\033\003w\023\035/\212\272\316\213\334\267\325\226\033>h(MYU]\266S\355\316K `\025"
+	.ascii	"Fc\254\254\300x8JfPZ!\351WQ\202\212-\243\302\003D\3010W\270'"
+	.ascii	"&0\316\210E\235\323i\241\315\224\235\006\200k/\246\234\226\323"
+	.ascii	"\257-c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\333\002\265\013"
+	.string	"\202\217<;0\315\244\003\020\0251fW\005\351\274\034\355\230\275\312\026\217\216\223\361'\243\311p\030A\203\007\005\2050u\305N!\340\333-"
+	.string	""
+	.string	"\3000\032\b\b\330N\371\322\321au\b\331{K\031KV\376`\214\261\262Jf\364\324\213\b3G\311\212\007\200H\301\021^\224\020\334M$v*\215S\331\266\251\334\241\241\264\260\202\265\220^d(\367\230\222\354260\365b\303T\213\273*\336\342\356\336\375\264P\374\305\023gI|\025q\025\304S\017G9\374\324p\023\303\r\346\354\035\33193\246\371\026\002>\205o\022^"
+	.string	";\301\362Nz)\257\017t\316u\201\331\272\214UZ=6\351.\327Z\025~\273KvY\326@f7\026^\3520\324I\247\217L\027\225\036B8\210tr\364\217\350c\350\036\260\313R\207\003]\234\245.\267\373]\023\r\256\335\335\344\017\346\356\322]; \340\002\231\252m\003\023\222&\016\372\003\027!-\005\031\315 \346A\252\216\321\034\244\245\344\241\247\244Z\241\305\255\207;\220z\2624|\013\306\354A;\237\363\271\237\343s?\347\317\315_Vz\024\370\te\214\340a\234\036\333o\314\374\331\b"
+	.string	"\302\221=`\300A\252\321\214F\267`gO\303\030\261v\003u\346\261\201\307h\235\352\013\342L\340\006~f#"
+	.ascii	"\234I\021\3401\252Gkt\266\374\206\033\3001"
+	.text
+	.section	.gnu.lto_.refs.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375 \337\215\004"
+	.string	"\362\212\035!\240%I\007\377\377\377\377\377\377\377?\347\377\377\377\377m\263\315fk\255\335v\023\322Z#\204\020)SO\333\200\005\004\003\277\214\243\344\215\262\300\231\311\001\234\312"
+	.string	"\213\205\n\236\024\216\022&\212\340\201\037\333\320i\027\270]7\343\353\350\353\2702\272:\216\244\216\034?P?\216\033\247\033\307\223\351\3518jG\307\017\3739nT7\307\213\364\036\347\235G\302\262\262\027\377\203\n"
+	.ascii	" \004\356MQ\314.\004\006'R\032\317\334\224\262\270e\213\316Z"
+	.ascii	"\314"
+	.text
+	.section	.gnu.lto_.decls.96534724c0a4e414,"e",@progbits
+	.string	"(\265/\375`\316\037\r\206"
+	.ascii	"\212\312h,R0\022JJ\007\352_\373\362\346&\200\244+\203\021;u^"
+	.ascii	"\354\340\025\306\336\007*RT{(\352W\330\264\356\276f\253\265\353"
+	.ascii	"\314\207\231\201\312:\220\305\030t1\016\210!\206\367\261Rk\306"
+	.ascii	"\257\020a\f\235cwM\236\031}\202\026\313ED\316\332O\210\224)6"
+	.ascii	"\002\301\002\302\002QP<*\275\236\216\335V-ZTKz\3452\334\003\177"
+	.ascii	"\245`3g6n{\217\251\275m?\2213\006\326+\b\036\341k%\366\234\302"
+	.ascii	"\247\346\345q\n\337\221\330\237\327\324\3261#M\252ze\265\236"
+	.ascii	"\033\025)7\330\2675\330^KF\006{\n\330w\341\021>\2066\227\261"
+	.ascii	"\331\031\312d=H\206\256\36721\033\360\303l@\017-\n\023\230o}"
+	.ascii	"\013\366*\330Cy\204\017\005\217\360\255P6\036\341\373\231\213"
+	.ascii	"\030\333\306\371\254\"\366s\026\356\34205\371\324\274]\356m\203"
+	.ascii	"z+\257}\352\365\347\3479\354nz\3565\301t=\272\312ze/\006k#\255"
+	.ascii	"\223\264W\316\201\265\360\327\t\336\362\007$\270z\334r\273\356"
+	.ascii	"m\201|\346\\\231\203\327\353\027`\377\267\007r^\t\336\354\371"
+	.ascii	"\204\217\363\370\204\357t/\343-\262+^z}\313#|,\207\360YaI!C\347"
+	.ascii	"\031=\217\035\370\333\007\235\347\317\275\022F\374=\346\277\233"
+	.ascii	"\237}r\316\f\232\277_\275\340pB\321\003\375-\347s\376\363\253"
+	.ascii	"\025\374\334\302\025!\246\302\265\301\t\370[\2169\301\021U\002"
+	.ascii	"8_\256\376\315\005L\313\tYL\260\242\265\376=\345I\377\315\344"
+	.ascii	"\374w\225\372\235_%\372O\367\363Z\327\363\253\r\374\267\373\271"
+	.ascii	"k\334\347WS,\240\302X\200\375\325\0216\256\363\253:?\007\255"
+	.ascii	"\224\235\347o\264\237\233T\371Y\350\347\022L\"\355\347\337\317"
+	.ascii	"\001\374\314\243\366\020\277\252\376\274\365\263\223\237\257"
+	.ascii	"~v\376\334\374Y\206\237\225\374\314\343g\346\317G~\246\372y\352"
+	.ascii	"g!?/\177\216\372\031\352g\247\237\221?\257\360\363\361\347\031"
+	.ascii	"~\206\341g\027~V\372\231\205\237\201?\037\375l\364s\321\317'"
+	.ascii	"\374l\302\317$\374<\302\3177~\016\341\347\017~\236\361"
+	.string	"s\210\377e\377\323\374\017\373/\367?\372\277\356\377\335\177\265\237\007\370\231\306\377\032\377\267\374o\373o\342\347\016~\346\340\347\024?/\360\263\002?'\3603\002?\037\360\263\001?\243\370\271\200\237\t\370\371\304\177\032?\233\370/\366\037\203\377k\377\013\310\313\313\313\373}C\376^\321/\342KoZ\207\036&\"dmbl\333\023\025\365\244\371\245\275\314\311\301;\323\353X\373sv\214\003\355\365\353\026{\376R\205\207v\342\025e07\300qi\261\376\352\266\265\364\226\356\322\317\006\353\034\370\253\303:\313\273\213\273\274\255p\255q\333\025\265\246\262U\006\353\t\203)yk(Q:\353G\275\267i\006\253q\370\211\302Z\213\301\230\215\212\002,=H\303\032\013\2731[\223\273\002Q\272\305\341b\340\307\311K\0071$\326\257>\330\036\265\216\275\n\307^%\303^\025c\205\254\260W\235\260Cj\021\226Eg\275\261P\2707"
+	.ascii	"n\302)\023\246\247\254D\312\\I\211b\037 zK\t\341SR\265\027\310"
+	.ascii	"\307\025\306\006\273^\257&Y\027=\307\276\333\330\223\351&C>v"
+	.ascii	"j\232\270\230@\177Y\304TuY\242\246\307K\235\022\354J\352\213"
+	.ascii	"\362\252#\263\212\373\371\341K\214\217*8>.6\3409q2\336\017\f"
+	.ascii	"\326\227\021\033z\n\b\b]\234\037\335\\\343\265-SMj8\001\324\022"
+	.ascii	"\201\262R\322IX\332,\262\354$\315\364\331A\n\222\264^\221\254"
+	.ascii	"\3121\346\326\031{\356\322S\255\354!?\310\366.\177"
+	.string	"`OR\312\351\016g?\244\224\323\236\3421\375t\3349\223\224RN\031\214\016\f\3759\2667j\007\f\210\224r:\326S\034\206\301\324\026\353\307\245\312Iz\244\213\264\221&\322T\374\325S\r\365\016\322QB=\270h[]\317\332\313\226\342\257\241\026r\366\302_\256\203l\357\023\351\212K\030/\354y\310\007\304C\2767\027\353\273l}\003\333@\204\200\342<EQ\323\353\233\311\236\273\322x\355\347\030t\257\325\024\353\3366\331?\372v\217fj\037\234\327\307\246\241\233\032\311_\355\304r\316h,\346B\355\275\310{\357\330\034^\263\223RN\331\264a)\033)\345t\315\033\213\271p#\245\234\276\371\201\341@\341\244Dqx\315DSR\006\227\031)\321\224\361^\274\255\201\343\2706\334\365\363\033\0378\356J\265\210J)\247dx`5\314F\325& '\245\344\272\267=\004?\263i'\236\3435\265\315\272\327\212)"
+	.ascii	"\232gT\332\364\336\226\001!\006zY\216|]\t\255\3478\366\\\206"
+	.ascii	"=\207\301\2733s\353\341dw\276{\031OZZY\024/8u\005 \321:\243;"
+	.ascii	"\327\261\333\031\033\0333\275\362\022\366\\\003\013\202\213H"
+	.ascii	"\345x\312\250\221za7g9\0374#U\220\364\252\352\330\224\365zN\262"
+	.ascii	"(\342\2420\336<]E\031\252\223\245U\025\003\373\035,\013\016\241"
+	.ascii	"&M\3139u\005a4\3474;Q&\313\273^\371\f\203\251\001j\024C\271\275"
+	.ascii	"Q? Ph\003g\257\260*\020\025\210\n\305^\257\353\323\204\222\305"
+	.ascii	"F}\272\n\365\263$IX\020\272\225\t\315\222\037K\324\036j\017\325"
+	.ascii	"\211=B\300\026er\371\236S\250\250\311\253Nn\240\315%\275\252"
+	.ascii	">\232N\312\327\331\264\231Di\177\324\365z\366\211U\233\324&\025"
+	.ascii	")\343\212\320Rziy\242\"\321\326\255\250W\026\236zT\217W\215\223"
+	.ascii	"F\231\\:B\244\370\330\322FN\347\311a\2659sX\255\304\262\311>"
+	.ascii	"\2351\311\265\261\377\221\261\347+\334x\347\257\306k\246N\362"
+	.ascii	"^)\027>`)\033\370/\007\271\236\312\265]\333I\245\rG\bN\263\007"
+	.ascii	"6\325\252{\303\001\303\366\314\353\265\3374\335N\331\2216\213"
+	.ascii	"\256\177\b\263\003W\323\330\223\314ii\351\325\207\316\242\023"
+	.ascii	"\205\205d\332k\317\261\333O\2221\256\251_\026\373_\022\366\357"
+	.ascii	"6_\335\246\223\b\265W\212'\256\251l\033\370o\271\246\343\326"
+	.ascii	"t\324w/\267\315(\345\245R\016\275\275u\224=r\031\325\020\317"
+	.ascii	"\223\017\2623\r\367\216\262\231$\331\330\311\330,1N\277&\366"
+	.ascii	">7i\322p\235\227+\271\2633g\370.\f\256J[\033\253\225\221\372"
+	.ascii	"\254\314\230a\265\n\302\322\244\353\026\230\272\251^\357{*S\206"
+	.ascii	"\3234\326\217\313\325\027\351\335\332\032\207\t\215\201r\022"
+	.ascii	"6NYqii\034\0251\346\376\216<\231Oz}O\314\2301,\307\002M\t\206"
+	.ascii	"\206\306j\021\234Aq8;\343(S\335\343\034\213\263;d\350='\373."
+	.ascii	"k\350\333\354\253\315X\215\275\367\n\231\265Q\346\364R1\207~"
+	.ascii	"\322\234yx?\260\3572)\357\275R\275\366*\233z|\334c\036\372}X"
+	.ascii	"\375zo\t\245\366\036\311\240\374\300j\2251!Aq\337c\273\027\351"
+	.ascii	"<Z\340\\\"\235E\222O\347=\"\245\034\203\224\327yL>\357\r\272"
+	.ascii	"H\344\021\203\346\rJ>\357\362\322\340\266\344\333:\217\027\331"
+	.ascii	"\274A\027y\231P$\221\316e\362\311\264\fJ>\235\313\373t^\020\027"
+	.ascii	"\311\244tB^e\320}:\347\356\263\271\004\221|6\227\311\247\323"
+	.ascii	"\b?I\252\231.u\200Re\204\347\222\310\033\004\212\311\244\004"
+	.ascii	"\301\226l\233\367\355^\356\322\343*\017\270\227\331T\2761\025"
+	.ascii	"ah\023[\220&0LM.\001\325T\325\274H\266$\225\346\275T\232r\\\250"
+	.string	"\b\216-\333u\302lG+\346}\352q\257"
+	.string	"P\367\036\371\262\335{\217\367\336\237\222\331\336{\004D\022\013\n\352^*!\250\313<\232\365\270\267\273D\241\313\344\263\252Id&\366\304\272>\332#c\3357\247\222}\036\277\356\323\275\227}`\261\226B\002\317\241\302\270\244\303\2704,R\342\241\003\005P\021I8<\002\026\207\304\243 \r\027\214\222\200HA\317\241\242\030LJ\n*\371f\364\210 \341CBH\004"
+	.string	"H,\034\001s\034\225\210\001<\n\362"
+	.string	"\320\023\002x\024\344a\241\302H4\322\241\")\351\002\001\224\206D\rb\230\b\341F"
+	.string	"\302\031A#\374\334\020\201T\234\001"
+	.ascii	"\320\217\222\222\226j\374(H\004\n\2018\330G\320\302\201\026."
+	.ascii	"Z\370\335\305\013\026/X\370\356\342\005\021\321\213\026D\354"
+	.ascii	"[\020\251\306\242\342\r\343s\340\320A\202\210\004$Q,\302\021"
+	.ascii	"TA8\214\001\002h4\002\241\007\204p\030,\316P\342\341\201\022"
+	.ascii	"\017\017\220\200GB\027\212\302\033\300\342\322\217\261H\\\202"
+	.ascii	"\001,.\371\270@4\002\225\200I@\033A\306\242_\021\207\221\215"
+	.ascii	"a\320\2274<\032\032\207D\017\214\304\241\216\242\320\210h\203"
+	.ascii	"\004\016\241Q\n\306 \f\3430G\021\003`q\t\310hd\2134\200JA\033"
+	.ascii	"JA\305\"\340Qp\007\020\203\347\030\340C\035@\342\n\343pH\\\301"
+	.ascii	"#\3441D2.\345(\262\305\"\021|\214A\341\fcq\250\203\035\332H2"
+	.ascii	"\022\022\201\306\0262\030\3320\022\201;\204\303#\022\276b\020"
+	.ascii	"\351\227\001\215b\360\307H42\206\300\3233\026\265 b\215\302\031"
+	.ascii	"@c\220\310\203\005\032\201I:\224\2061\200F#$\035K?6v\370\214"
+	.ascii	"\302\245\341Q\017\t\370B0\311(h\f\n\203<I\303!\214\242\036\022"
+	.ascii	"0)\005#!\360g,ra\024\006\227~'\"\212\201\342F\215\r\330#\025"
+	.ascii	"\304\241q\250\264\242H\004\356\b\022\221V\b\203FJ+\216\210\305"
+	.ascii	"\025*\004\310\242^\251ke[V\260\264\235zE\335\332\001kv\035U\256"
+	.ascii	"\216\002\021\341\001\315\231jEu2\347M\230Y\257O\236\250[;QfZ"
+	.ascii	"s\246\2750\2528=d]\335R\251\3343\263\"*\025UKu\303\322\322\205"
+	.ascii	"\344\002iMA\303Tqh(\2405:-XzU\245\250X:l\\p\\T,u\nc\031B6\227"
+	.ascii	"\345\367\266\306*N\257j\024"
+	.string	"vk3bohzU\2410\330\234 F\220\f\355\371!u\246d\n\023&\252\023\006\3216\261\311\"m\257\254c\234&W\235t\241I\355\310\212\320n\330I\302ZY\251W\274\345F\371\306\2168\f\231\336K5\2642\271\363\212^\365\020;#M9xN'\313\261\020\236\263\253e\315\232f\223\2432\356\b!;M\254\246ldT%\252\022V\313\303\2122\247;XQd\274|a2\227\240Q&\227\317\rysjUX\365\210z\204\2432D\320\255G\244\217\034jP\213\250ET*\260<)\022\013\233W\257\247r\223\202\273\275^g\251N\251Sb`wR\036 `z\310\271\023\"\204\357Lx\375\340\301\275\305i[.\031*t\325\2706\312\344b\301\260j\324W\202\373\250\322\t=\tjeDHDD$I\2224\006\262\n\020\004Cq\032(\323\003\022\300\004=\324:\250Fd\024$)(d8"
+	.string	"!\341\025#)\341\274\327\207\201j\367\031\263\232:cx\207o\347\260\314$P\370\372\213EY\315hP\370 fQ\371\005\346\270\013\307#d\367\225\201\335\304\264\260v\270\272gk\275\213\344p\260Q\220\340\311&\023bzj%~<_'\t\231\2407\371\272\246\017}^#j\024\240\331\013\217\345+Nd\246\031\220\006\2576D\302\372\263\013*,\344\031\210e\274\202\230\322\356\355W#C\302\235B"
+	.ascii	"\217\356\351\370\234\230c\216\035`\350\025\3646b!`\360.l8H\217"
+	.ascii	"&f\241\302\200\304f\374+\235\020]C\326C.a1R>\321\234\342\323"
+	.ascii	"C\352B\232\303\352P"
+	.string	"\351>\"]\016(\"9\261h\212\330\341\234\310l\354**\306\210B'E\250}E\200\362\013i\227\250&V\031p\241\232\276)D\223o\224\310g\2063\250\rWs\245\230\273g\224\370z\020\232\006\273\254\267\252\211u\257\235\005\376G\276\304;&\255\257\036U\366\027]`\251D\274V\001x!\006\272)\354\325\251\341\205\3601\355\327\253e\201D%4\310\3009\246P\nJ\0166\275m\301\031*7&\3260\325\"\025\331\245\254N\nU\302-\257Tt\350\220t\263\341u\033p\331\276\230\0165\264X\327@y\332w}\214\346\203vo\215\332%\362\251\356g\275\nf\21113v\234\205\353X\257+\024\265.\3609\271\241\356\272\376\251\307\022D\001t\232\206Q5\303?\3365;*0h\206\367{\0305\226\0069\024\204\323\013\031\226\367\341\342|\355\177\375t\n[\2370\f\344\376d\2561\251\374\324\350q\335."
+	.string	"\376\307\332\262\037Oc\271\272\244\304\222\013\017#F\177E\317u\002\034tU\037\252J\306&n\317\210K\030\267\3530\003R\324\353\266\214\037\336\275\304\344\013"
+	.string	"\304\376^\247\331lP\203r\201W\202\001\326\2176\317\361\032Bd\300($\331aW\227\004\261:g\274\247A[\336\361D\f\272\322=`\336\024\332'\367I\035\365\340\374\370g\364W\315\343\300PZ)Z*-\352\025h\334t\250\274\333i\200W\203V\377\200\260!r\215\005\fy\236\344\357e\350\225\264j\364a/\325\363\003\0358\377\376L\"\315\261"
+	.ascii	"\222kHh\257\b\006\353\266\3531\324\316\232\356s\fj9\360h\213"
+	.ascii	"\245\257\001\254\3454+\025\242\023\214\035\320\031*K\324\263"
+	.ascii	"\nB\334='kKBxJ\211-\3673I\274\363\016\354`2\214d\357\231\037"
+	.ascii	"\364\260 Sf%A\224\237\267\360\240\242Z\3042\223K\025\3135\371"
+	.ascii	"\021X{\371!\003\b\3311$\313a\224\035\365w\006\375\323h$\314&"
+	.ascii	"\2357\3702\343G\2421\276jS\306Z\376&\311W\346\b\224\346\001\b"
+	.ascii	"\214\240\364\362}|_\224S\316@\233\266\330\034\326F)\316RDs:2"
+	.ascii	"r;y\251\214\322\026\177\0317p\364-(j\r\204T\200\361,#\230;LC"
+	.ascii	"\221\301l\316\351\026\004\3376|\216\2254\352\002_\341H\235\276"
+	.ascii	"\355\213\230\342F[\306_$\221\273H\020\205m\332\033I\234{\004"
+	.ascii	"&\316\357\347\371\244\2503\230[\215\330\033z\2644\210'!\343\327"
+	.ascii	"3) \220\253\356\217\246.T\227\231\177,\220\230\242%\323\020E"
+	.ascii	"\3047\245\221\214\025B2\036#h!\213\001\347\352.\230\3044\323"
+	.ascii	"\347v\024\bN\321\337~\337m\300\243^~\227\013h\024r\241\367 \315"
+	.ascii	"\340\016q\005A\306w\221\235\277\032w.\013\321\321\323\321\301"
+	.ascii	"\331\316\016k]D>\334F\346g\250\3145\037\021\bi2\356\266\264H"
+	.ascii	"R\016*\375E\206\034S~T\314{\306\025\333\221dd\236\343-\202\""
+	.ascii	"\025T\bt \262\363\021\243\324\n\334\007\373\263iK\rz\326\021"
+	.ascii	"\030\020\267F\301,l\251\013t\025\016\001x\210\360\257\261\005"
+	.ascii	">\346\376&\273\240I\362\027\342\301\025\372g\373\377\306\273"
+	.ascii	"`\237WY\221\362F\217\214m\266\341\277\234\021\177\003e\327\375"
+	.ascii	"\276\374tY\351m\313\301\300\354\362\224\374a\342E\310\330\347"
+	.ascii	"N\330\030\274\370\177\f\354<\246,s\326_\343s5\177\006\213\201"
+	.ascii	"\321\355\205\344\213\036"
+	.string	"3MF\031\007\205}<\343\313)\243\226s\026\0177z\002\341p?\030Y\345\006\336Mx&\277r\374\240\347\337\024L_=\t=x\256\364\265!\316\242\373\346\363\344\240\374\232~\216\311\321\347\"\364\37409\367\201\301\253-\333\340\207\253\372\342\364\244\025\177\306\344\317\354e\305\241w+~\354\347\344\300\351\272w\2257\217\320\252\322\303\323\205\3749\376\3571[\277\371\373\"\363"
+	.ascii	"\237\303\272\363\035\036\367\361\271\351\275p\365\266\332\026"
+	.ascii	"\366WM\0272a\346\bv\2469\331\3016\342\265B\247\343\341\373\301"
+	.ascii	"\377\260\340.\211}4\253\324\271\2720\305jk?\007\035\206e7HK7"
+	.ascii	"3\335\016\361\336\230\373\177c\326<y\013\302\207Bx\362\346\316"
+	.ascii	"!d\332\365};\375o\361E\206\031a\360\007\325NL\337\360\004\377"
+	.ascii	"\340^G\334\223OGum\001>\237y8@\016\361I\346Eq\363\272j9K\324"
+	.ascii	"\237\207\203s=&\177u\247\335\227\273\226<\013\317\326\366,9\300"
+	.ascii	"2l\306\2659\260\242\037\214\372\344\343\264\234<\207\267\240"
+	.ascii	";wn(n2[[\323\n"
+	.text
+	.section	.gnu.lto_.symtab.96534724c0a4e414,"e",@progbits
+	.string	"motorPostInitNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"motorUpdateStartNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"motorWriteNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"motorUpdateCompleteNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"motorShutdown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"motorWriteAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"motorDeviceCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"checkMotorProtocolEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"checkMotorProtocol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"motorConvertFromExternal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"motorConvertToExternal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"motorPostInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"isMotorProtocolEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"motorDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"motorEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"motorIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"motorIsMotorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"motorPwmDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.96534724c0a4e414,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,350 @@
+	.file	"pinio.c"
+	.section	.gnu.lto_.profile.282224ded816a452,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.282224ded816a452,"e",@progbits
+	.string	"(\265/\375 Q\255\001"
+	.string	"\204\002E"
+	.string	"\003"
+	.string	"\340\376\352\253\007\020\002"
+	.string	"\002\001\002\002\003\004\002\003\001\240\342\234\212\n\002\241\251\226R\b\004\002\003\002\002\002\003"
+	.string	"\004"
+	.ascii	"?\213\n\216\333\025\272\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.282224ded816a452,"e",@progbits
+	.string	"(\265/\375 .\345"
+	.string	""
+	.string	"\220\""
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"\002\002\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"B\221\221\333g\003X"
+	.text
+	.section	.gnu.lto_.inline.282224ded816a452,"e",@progbits
+	.string	"(\265/\375 \260\375\003"
+	.string	"\262\307\031$\200K\322\001\fP\035\220\f\342\312\205\230\205-d!\0047\007[\n\314\320\231"
+	.string	"\310\024\003\372\375\373\261\021)S\277\356u\317\316P57I\202{\2412\306X\340\243n&\221\214A\375\200rNE\0337I\207\373:\256\236\005\207\277\256\317G\255\343\223\320o\244 \216\312e\360\2136\013F\222\350\223\241\332Di\210\357\217\b"
+	.string	"z\ba @Q\304@\2007\313d\331\376P\326m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.jmpfuncs.282224ded816a452,"e",@progbits
+	.string	"(\265/\375 \301\315\002"
+	.string	"BD\r\027\260%\351\f\303\200\234K\222S\f\206\241,\342QOQ\262\333n2\245\3724f\204\231\3417\017L\223zR{l)\027U\023\217\324\214\216\323Y\367\f\336\t\b\r"
+	.string	"0\005\225\027"
+	.ascii	"\236\262\b\274\023\250\272\251\202\321\274\022\310\254)$d\022"
+	.ascii	"\003\216+\246l0\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.282224ded816a452,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\231\004\002\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.282224ded816a452,"e",@progbits
+	.string	"(\265/\375 S\375\001"
+	.string	"\364\002G"
+	.string	"\002"
+	.string	"\001\024"
+	.string	""
+	.string	""
+	.string	"\001\002\b"
+	.string	"\001"
+	.string	""
+	.string	"\001\b\177"
+	.string	"\001\002\t"
+	.string	"\002\002\007\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	"\002\002\274\006\001\002\007\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"1\003\320)@U\334\240\254\n\2036"
+	.text
+	.section	.gnu.lto_.lto.282224ded816a452,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioInit.10.282224ded816a452,"e",@progbits
+	.string	"(\265/\375`\266\005\255\""
+	.string	"\026\374\326G\200\332U\007\277A\376\032`\005\334\364IFV\301O2~X\032+\022\317\305ym3\237\003\023~.\252h\365%x\n\305O\\\354\2068\372\306D\323\332h\361\323\363Wiy\300\200f\026I\264\363s\223\275eJ)\005\305"
+	.string	"\265"
+	.string	"\302"
+	.string	"k\247\234\354\037\265\323\265\005\250\235\262\217\031M\201&\334\026a\027\234{\257\356\211\260m\233l\336q_\363\354\350\340n\266\332JSS\373\356\343\336j'~)\305L!\376\232\307\342\236WS\355\034\002\261\022\270\230|gH\321\330:\270\333\261\350\243m\226\301\230\020\262v\016{X\003F&T+\031NyM\216\325\261(\325++8\026\243\232fubM:\3329\214\262=Ufi\204\256\332\2371!d7\242\223}`dB\261\002\347P\312\323\n_\322\034\213?\332\332\241\347\325\324\016\261\311\n\220\252\362\354e\373\rb\320\277\271\332\263h\301*;\026\215\3554\013\367^\366'b\261\271\247\231;\307\314\025\230\323\020\001\356Ex\006\364h\213\246\362bB\325\275\301\"f^O\211\261\336\033$\222bBih\214\221N\271k|/{"
+	.ascii	"\024"
+	.string	"\2501+\f\350\321\227\252\362\264\372G2'\177\376T\317+)+\374T\314A\355\325\354\323Z\335\001\336\271\247\225\315\266\324\271\366\316k\352L{g\325:\247\357l\337\371\255\263\277s\347\276\207p\371#v\257\216\250\234\333L\303\220\264W\267\222\271\273\270\227^K\271\0373\311\275\311\242\265\223\334\\|\353\224\371IC\361\265\222\263\330\033\005\003V\027\350\275W\250S&Z;\315\331\2761s;scu\226\257\265j4\200{\251\276\300\356MB\340\007\001g@/$\0260\201\326\337\260U\026\326\035\344*!\203\336\344u\320>\247f\300\205\332\003\210\031o\232M\377[\t\270\210\021\215\\\323\f\376\257\300\2315\\h3T\332\367Q\311T\237\366)\217\245\360l\255\272\303{\257\203\346\322\374\371\034\036\323r:S\037\331\b\324\236\365\311\321F\240\252\337\363\354\302(&,$\032\224\350\260\023\t\252\324\357\300\244I\030"
+	.ascii	"O\237B\243P}\2369\305\221\367\023\347\234\376\307\366\323\357"
+	.ascii	"\257n$\365\337~;\031\231<\312\266\377\257y\211\t\317\334\310"
+	.ascii	"\204\332J\037i\274\177l6\203^Qc\037\311K\252\317\2673\216\222"
+	.ascii	"L\320\315\030\347\376\314;\027\336O>\237\013\376\217\373\375"
+	.ascii	"\003\274\235\357\232\305nE\022\317\350\306G\021x\273\244\035"
+	.ascii	"\f\235R\017\211\306\256\247B\227\264K\361Bw\324S\322E8\300<\030"
+	.ascii	"H=\235\f\036\257\247\273"
+	.string	"%/Xo5\206\253$eP\3403\201\361<\222i\\t\202\376\313\270P\333\376\0067gQm\337Z\3122A7k{\357\275;Cm\373\240\317:\242\024\343\345:M\332\315\022P\033\243\001lpa\214?\242\200\036\305\235Q\223\006\272\3649i2\231\2312\037p,1bu\221\0358r\334\036\t&\253\307\210y\326\254\272dX\005)\203\366\005\225\331\267\325\316\013\t\252\356\275DcF@c\356\275E_\272\231\2015p\360~\342\240vZ\033\343\202\303\006\350\3216K\033V6\261\256}o\375\332\367\031as\250a<\246\fD\206FDd$I\223\306\200\002\221\251\262z\020X\2504M\322\030!Ry\236\375\206\274R\265P\326 t\267\303q\033\221|\212\005\271\301\336\204\314,\2414\376j\362\221P\373\213\221W\202\273U\020\341z6x\377\374\020\235\370-'2\220\202&\272\321\233A\354.\352B{f"
+	.ascii	"f{\261\212\n\222f\n\207`D\360UI\240b\277\375\323\210\364\026"
+	.ascii	"C\265pL(\203\217\263\367W\246\252\260\035\214\3711\246\255ij"
+	.ascii	"@q\013<\300a\301\354\207\027\341\036\323D\331u{\244\223\343M"
+	.ascii	"\356\270bF\247\310W\232H\313^\346;\217D^}\f\020\337\322u\363"
+	.ascii	"\236M0Y\303I\372\272c\257\312p\302l\030\335E\017\327\341\f\341"
+	.ascii	"\264\005\267\032n\026UI\t>\006\236fuW\306;'\306S\037\3018xQ\343"
+	.ascii	"9\321Rq\001\3651\210\326j\322H\251\2270\177"
+	.text
+	.section	.gnu.lto_pinioSet.11.282224ded816a452,"e",@progbits
+	.string	"(\265/\375`\303\0015\020"
+	.string	"\326\336mG\340\222*\035\222S\344\301\325\031`\252\3468\271f\"\t\375\021\250\225CZ\242\2167.\020\300\025gu`t\324^\001\\\333Vn\b\3474\032\302\0303\024\200\230\007:yi\t\n\252t\231\206\020m\305\306F\210\334)\005X"
+	.string	"T"
+	.string	"["
+	.string	"/T\247\031gp\367\204\212\231\3355q\202\316\277\317\005p\376y\017\300\371g\225\375\343\245lo#\321\212\321\355n\250)\256\272\247S\345\337v\320\365Z\335\363p\365><r-\222W\213g"
+	.string	"V\302\346\266O\016/\326\234\"\021v\327\323\365\352p\177\267=\3016\004{\236\004\336\356\256\025f\277v\203/\377\316i\277\210N{\237\3269=\347\364G"
+	.string	"\264x\031\201\342E{\224\353\262\023\262\271\017\007\213\327~\373\267\331c\273\226\372\254\312u\t\205\320\315t\273\245\202\177n\340\320\211\352e\212\300\203"
+	.string	"\231\351\330-M\314\240\363\317\237\366g\017\240\252\206D\334ZC~cb'\243\0323\250S+\330|\264\314\033\333+\257\221Z@\203t`\306T\317\212\006\246\243WPo\243\365\201e\3622)\220lw\035\330\036]\006\tA\315\356>\210y\f\223\277\342\2371\240\346]\377|\024\347\337\325\003\343fCc\231;\273\\M\215\331\017\342\t\345D\001%\212:\"rj\020UD\343\347\024\0209\212\306Qh*\211\031\306\222J(\032QV\302\224\222)\004\02509\022K\341\211$K\241\247\334{\2530\t;r,\312\3624\206K\225\310hH\003r\200.p0 H\246\252\247\266ha\336\345\317\006]\331\036?sa\244\346F*\271\341)\030\036"
+	.string	"3C\357\220\3009\273ehwF\326\200e\026\001z\300\270M\210\236\tl"
+	.string	"\355\300\020b\310Q\2068%\243cnB"
+	.ascii	"\333\201!\224\220\005\n\361\b!Fm\006\222\270&\326\341\032E\r"
+	.ascii	"\377\214\373=\017\212kn*q\246\024\n\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.282224ded816a452,"e",@progbits
+	.string	"(\265/\375`,"
+	.string	"U\005"
+	.string	"b\t$.p\307\351\305\0274\na\213\022L\n$\017J\357#\\S-\335\304\234\360\365\017\377?\377\377\377\337\276\266>\303&\"\"\322\f\233\020\271S\n\376\367+`B\201CL\013\340\317X$\223tN\337\235\020\020\351\036\247\304\335\006\034\310\002\344\224\264/\016\020\b\036g\304=^\n*\235\310\351xn\003`gp*4K(\225i\205\351u\251\365\335\265\031\241\245\330\237\335\335J\247\230\366\265\245\020\220\355\370\330\215\255\266G\271A\315\346M*E\333o\004\t"
+	.string	"\240\036"
+	.string	"\034"
+	.string	"\034"
+	.ascii	"\034>\201|\265\364\247`\270\354\235tJ\017"
+	.text
+	.section	.gnu.lto_.refs.282224ded816a452,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\001\001\026"
+	.string	"\001\001\030"
+	.string	"\001\001\031"
+	.string	"\001\001\033"
+	.string	"\001\001\034"
+	.string	"\004\002"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\001\006"
+	.string	"\001\001\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.282224ded816a452,"e",@progbits
+	.string	"(\265/\375`h\013\035="
+	.string	"Jkt\027DPdR\007\245\275\026S\356\337^\030\334\266\007h\353\267/v\312W;\261\343\267\344c\3725\376\265\326q\013`\033\321\033R\220\\8\214\210\013wp\260\273Q"
+	.ascii	"\001\330\326XY\221!R\023\331\377N \255L)@\001\\\001i\001\\b\246"
+	.ascii	"\340\314\366Z\205\242\315<dp\356d\253\346_\274\352k\336\245\375"
+	.ascii	"\375\267jx\375l\310\367?%\023\373\377v,\335\3035G\3634\004\314"
+	.ascii	"\377\351\226\220+\256\332f\347\377\217\222\222~ws\3200\1779\315"
+	.ascii	"K\020\017\314\273\344\032\334CeO\036\234\233\330\366\207\266"
+	.ascii	"\227\332\366\263n\317\342X\334\272\342\237\372\377\004\202\344"
+	.ascii	"\352\316\332pv-N\365j\002\347\322\0316\264Oi\366d\377\2570g\231"
+	.ascii	"\371b\202sWh\333\2674\2004\277\241\333\266\263\236\340\347e\303"
+	.ascii	"v3\243\037T\372\276\320C\022\257*8\373p\233\335\350\267\300\005"
+	.ascii	"\\\351v+N\226\300\347\354\341\276\365\377-\022\276YO/\234\373"
+	.ascii	"u\001\277\326\215~\335\216`B\303\020vc_w\317\265\232\356fS\347"
+	.ascii	"A\244n\317\022\272\035Bw\247u{\204n7z\320\335\327n'\340\240\333"
+	.ascii	"\031t\267Z\2677p\005\b\036t{^\267'\350\366\243n\017\320\355C"
+	.ascii	"\335\376\323\355>\335\356\335\275\327\335x\272\373Lw\333u7[w"
+	.ascii	"\273uw\234\356F\321\335w\335\335\246\273\305tw[w\223uw\200\356"
+	.ascii	"&\323\335\276l6\233\355v\246n_v\003\021\tu\246W<\352l~\325Sk"
+	.ascii	"\t%\302:_\367\351\376\335\232\343\241\r\376\265\\(\335\022\210"
+	.ascii	"\177ab\253\230\327\245\373\005\236\314.\367\233Xg\024\367?\n"
+	.ascii	"\363\305?\227\224/\366\303\034\253\364\322\372\0369\376\r"
+	.string	"\374\373\377\374W\372c\377_\371\377?P\255\367_\b\221S\354\371\374\227\036=_K\271\226\343\037[\355\276D\235\324.w\270V\245\212=\325\253t\261\247\233B[\252\262\354{\374\277\317i\305\242Wrp\3668Ae\234N\230\300\265\216\347o\274\352p:\233\271o\320\267\3142\243\206\364\023f\263\331\254#\271i7\312\262)p8w\373]{\033\314ef\312\013\3471N\306\355\200\356\177S\210\355-\253\n\316u?wZw\326.m;\231\0314\r\335\3039\217s\254c\245\357[-uY\343t\316\306\253>\347h\332\323\270\\\037\275\377\3272\0316\370\234\253\361\267!\345\373>2\\y\220\331\371\177\223\222\216\222\200F\252X\257mn\007k\375]\300\217\310\203\264\355\325v\343g\032/')\223u\005\347v\254\266=\332\266;\333\266\272\200_\376\327\215\340\336~\254\270uYq\3667\354n.\246\375\315\303"
+	.string	"\233\376\226\377\227\356\f\206\334\031\370\204Y\262\324\362\313\355K0\355m\023\002r|t@\312\366\274\370t\351\335\251\325\351\320\201\253\366\204\320\300\262I\236\215\253~l\362\312\272p\306=\034+$EO\0260\314#?\237\230]\341\035B7n?\346\304\265\215\327\250\250\360\224\023\275L9;1\037\025.\270k\213\231\215\231x\352\310\365\311\265\271r\033\373\227\"\345\273\"\326!\270\331xJ\255\013l\n\013D\265#;e\262g\017V\266\377\357Z\266\202i\357\032\027\374\215\225\001\264\322\364p\366l\207q)kH\356\336\200;\254\332\210|\355U}\317\333"
+	.ascii	"9s\234\032\234\207B)4\226\266\355s\234N\236\343q\351\373\356"
+	.ascii	"\340\244R\244\337\364\212\006w\247\035O\343\001\377\311\376\037"
+	.ascii	"\201\320\234t\354\007\316\235\347v\272\033\b\243arff\307\353"
+	.ascii	"\264zd\364\342\260\275\271\316\030\2258\234\253\256\347]\202"
+	.ascii	"y_ZU\234\033W\265\215\273\177\277\204\376\277\225\317\373P&\260"
+	.ascii	"\335\307\203\356\363\006\335\235\377\243\374\027\241C\247\205"
+	.ascii	"\242\266\034\202sw/\370\036\373W\026\375\373P'u\252tnI\023-z"
+	.ascii	"\237\213\300S\275\336\371N\243\331}\374\357\3737\247\321\031"
+	.ascii	"\316\327\205:_WI\364MW\371\377F\211\234\326\245\322\235\324i"
+	.ascii	"\324Iu\243E\337|\345S\227\\m\323\215:\313\270Q\"'u\031u6\247"
+	.ascii	"\321\"\"t\216\340\351\b\305\244\021\251\242\211\370\003\305\002"
+	.ascii	"\005\216\017\311b\210&bP\023\361\227\fj\"\226\b\321D\004\032"
+	.ascii	"E4\021s\277\270p4\036\035G4\021s\262x\242\005&\215QD\240~2\""
+	.ascii	"\213QE\250\266\2278X\340\300t\343\247\231:`\350\200\341\327L"
+	.ascii	"\035\206\303\016\034\206ms\030\372\212N\310b\224\215\246\342"
+	.ascii	"\023\222\306Q\252\210\024&\373@1\311\")\345#\345T\214aLF\321"
+	.ascii	"01\224tj\"\346\243\021\267(&\221\305\032Q\306\026\306\361\370"
+	.ascii	"\301\311'\331/\240d\f\350\243\214\"R)y<\"\225\204\222NL\311("
+	.ascii	"#\215\237\247\237\224\023\224\321E\324\021D0\351\364\323\303"
+	.ascii	"!\210\005)H\204h\237.\034\215QF\031JR\310b\r#\262\205R\224\221"
+	.ascii	"E\f\245'\244\224\322\005\003P,P\034\215>H\266\206\250;\320\312"
+	.ascii	"\302\252\204c\246"
+	.string	"\326\264U1\330T\220\232\0320G\322\214\004\255\340\204}\271\002}\370H\342~a\001\237M\250\246\260\027\226\006\247\331\252\035\316x\332:\311Q\367\372S\207\0240\234\261\273\344\376/q\021\314\325\330\355\027\273\302=\241;\003\f\345z\265\347\227\205\b\301[uWnc\230K\330\327\035\254\325xK\030%[F\301\031\017q\2540\017\\\023%y\262\262\260\024\217\221<<\2004\226:v\b\013\252\244\316\372c#G\211\027\034(\024c\341\r\321\261\3319\273j\214\005\264\027\266\324\2023\266rl\220\034\2203\2173\216z\200\345\250q(\207\2245#C#\"\222$I:\220\002\021)+\326\001\021\260-\223HJ\222,\007\333\001T\214\355\016\210\021\301J0Ad/\207\027\024%\225T~\026\205I\241H|@<\241\334bp\210\257g\267[\323\033\354U\005\214e\033\347\231WPH\227\262f\332\3049\301K\2676"
+	.string	"\250a\337\016|?\247\232\021N\220_\r\236-\214"
+	.ascii	"i0lC\321*\270\321f~\231\222\033X\325\013\306#\233J\364\355\335"
+	.ascii	"\325\240G\334G\200\254\332\346P\311S5\202\205=\347\354{bg\333"
+	.ascii	"P\361\214\336\325\361\370\260\223j\200\2706\223\364\203\001\236"
+	.ascii	"\027\252\031\360\256\210i\242\251"
+	.string	" \313\337\035;x\275\330g\016\256\210l\222\240a\177}\035\001\020\321b\037\351\261\250F)$.\365\b\347T\032\211\300\021m\233\244N\356\276\367\021\263\3478E\020t\200\004\210\353\3035\177bV6\334.\017\230^\234\355t\226\004\r\245\027\234\330$\275\204y)\033\303GL\376\222\303J\266\fc\"p*\322\367d\225\333<\216\342\275*\230\260\243\t\f\214}\214\\\365hp\242\266&S@\003\023\362UP\t\005\326.Ifq\252Q\210\027\020\207C\b\334CB@\372\203tY\205\230\215\203t\320\017\376\t\316-\374\260\331\027?\317>\256i@c\315M-@Sj\342\220Z_I\266L\235V2\nJn\006\354\353\336Y\r\n\004\242<\265G\2232\004\345\"\300\005\306\345\266\315s\344F\013\267\230x\307\266{\021\376\334\227xL\203\037MV\204v\024+\342\r\201\035\261\177-o\253\201\270\246:\377|&"
+	.string	"\027\324&\336"
+	.ascii	" ~\017\255\002"
+	.text
+	.section	.gnu.lto_.symtab.282224ded816a452,"e",@progbits
+	.string	"pinioInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.282224ded816a452,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
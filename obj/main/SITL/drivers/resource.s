@@ -0,0 +1,179 @@
+	.file	"resource.c"
+	.section	.gnu.lto_.profile.7e92bba2cddbb5d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7e92bba2cddbb5d,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\350\347\332\240\f"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.7e92bba2cddbb5d,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.7e92bba2cddbb5d,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7e92bba2cddbb5d,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.7e92bba2cddbb5d,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.7e92bba2cddbb5d,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.7e92bba2cddbb5d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ownerNames.3.7e92bba2cddbb5d,"e",@progbits
+	.string	"(\265/\375`\240\f\2758"
+	.ascii	"jb\354\02590\252M\0070\263\nOu\205!\223[\373gff\276d.\023\235"
+	.ascii	"nm\205\002\001\260\211\243\273\347a\226\354\266^Jc\355mZ\032"
+	.ascii	"\340\306\311\277\310\231\353\337\274\261%\221)\311N\001^\001"
+	.ascii	"I\001i\324\374\315\315{\333\365\2077\203\364\2677\337m\327[?"
+	.ascii	"\206\351pn\246\333\256\271\300\2309\334Kh\273\356\372.e\036\347"
+	.ascii	"f\257\327\222z\234\330\331\314n\266\353\257w"
+	.string	"\315\\.\203UQ]\356mq63\225\355\032\204\224\242\317\271\271\311v\035\366d\351so^\333\256C<\2233\247s\337\324v-\"I\321\351\326\263\371\237\266\353\021\315\245\327\221x\"j^\367>\336v]\342\327\226\276\310M\264]\233XU\346\213\336w\333\256O\240B\272]{6\037E\251\245\333}\nQc\376\350\305\331|-\333\265\212O0\374\321\033\343l\276\221?\234d8$Wy6\235\023\240LL\207\364z^ KK\277s\355\004UZ\372\335[\210m\322\322\361\\>mxK\307{\343\366\250\314\363\\\037\363\306h\351y\357\225A\213\226^\311\225\020R\264\364J/\220B\207\226\256\347\3168\2338\f\305\225\271\336[\343l\322\200+d\346{\256\215\263\t#\356\355\314\367^\264\263\211\224cc\272&7\307\331\024\233\003\264\3035\275=\316\346\210C}\324|\223\353\343l\202!r\004?\327\330\365"
+	.string	"\001ry_W\325\332Z\323\225\270\016r6\177\273\306\371\007\306\300\005\001L\262\223\374$G\311R2\225\\%_\t\313Xr\226\274%s\311^\362\227\034&\213\311dr\231|&\243\311j@d6`h\203CkH\206\250\300y\r\020\b\356\257\324N\243\006\341\005\265]\277\031\265\b\356\246\355:\217)F\320\333\256}`\212\022t\0275\to\243\355\372\247E\355\202\373\273r\004?\227y\3415\264\25501`\345)H\f\357\017\230\24103\374\332l\327YM\3142\274b\266k\255\254\304l\377\334\355\032\300\221\342~\243l\327\001\212\024=\270?\001Y\310\016\017:\325v=\200U\331\007\335i\273&\220\352\354C\001S\310-W\033\030\305\334z\365\001PL.\027A'$\227\006\264]'\320\204\004\241\357l\327\n.\235\201\320\013\364\220af\266k\006\224\230a\257n\020\t\031\302u"
+	.string	"\t\031\342]\262]?h\204\024\341\352!\3335\004;\244\210S\333u\004:\263\023\022\020\3558\341\233 \307D\341\326m\327\024\f!Q\274p\333u\205A\310\024\256O\320vm\241\355,\205\236\355\372B 3\025\030\374\234\251\360\235\331\2563\3541s6\327\307e\273\336x\230\316\366\372\246l\327\032\352\244\336\346\3726\310Q\363\266\327\307\341M\231\273\211\332\256;\2609s\2677k\332\256=\004`\253\252\205[\364\253\205P\251\036[d\026f\211(\231re\203B >\216\021\211c\307+l|\261\016\211\304\261#\026\0263\006\205IU\250L\256,\332a"
+	.ascii	"<|\321\372\360\214\255\262\031i;\320r\224\245q\345H+\343a\226"
+	.ascii	"F\203\353\206\331\362\214kFZ\016\256\255\b\030\rGY\032\227\016"
+	.ascii	"4\2644\256,\214L\331\025\032\373\036\347\343~\374\217\007rA\336"
+	.ascii	"\346n>\310\t\271!\207s9\237sD\236\310\351\274\316\355\374\365"
+	.ascii	"F\356\310!\371\235GrIN\311\363\\\317\367\374\222crM\276\311;"
+	.ascii	"\271'\007\345\241|\224\223rS~\312S\271*g\345\255^\310\017\371"
+	.ascii	"\"o\344\217<\222W\362K\276\311"
+	.string	";y(\037\345\247<\225\267\362W\036\313g\371-\317\345\275\374\227\017\363b\236\314\227\3713\217\346\325\374\232o\363n\036\316\307\3719O\347\355\374\235\317\363z\236\317\367\371?\017\350\005=\333\273\375\333\023\372B\017\367q?\367\207>\321+\372\272_\364\3573zG\377\350\357\036\357%\375\244\317\373J\277\367\226\036\323g\372M\317\351=\375\247\017\365\242\236\324\227\372S\217\352U\375\252o\225\327\362\220L$\033\311\315\214$'\311Kr8M\331\025\032\027_\034}\270x<\3720\273&\327\342\017\257.\330\264\375\3710:\f\372p2\031\024\262\354\030\232$KO\254\266-\253D\207A,L\226$c\225@,6&L\207bb*\233\f\200W\026h\252d\203\306\265\315\302\3054\331\302hO\274\266\252\332\256E,LD\203\303V\211~\251'\276\302-\320a\021\305\302]^_`C\345\252\016[\340\220\r\242\3036"
+	.string	"\2136H\\\201\205[\364\304-z\016\333\365\n\267@\334^\255,\f1 F\327\024\013"
+	.string	"\026\266c>\234D\323d:\314\302lzLS\341\025\036\266\253\017\237\230M\223l\352\302\250b\341\243\312&[\3450%\002q\213*\3336x,\256h\026\026\033#\036\225d,"
+	.string	"L\f\252l\332\242m\n\304\304\225M\032WT\031d\323b\020\025\200\217cE5\371\303l:4\252+R1c\220\325\302WxU\215\352\361\207\215\352Q\211\266E\245\260\035\323\302+Z\364\341\241Q\025\016Sb\026N\252F5e\217'V\223d\251\026Y\362"
+	.string	"6\246\312\240\221\210"
+	.string	"\023\323V\2314\006\225]]a_(\252$c\023\340\026D\024\313\313\313\313\313\253\313\353+\201\001\250A0\342\254\206\"\023\024$I\251\320\032\021\206H9TW\007\021\340\020c\221\234:\006\020\b\252\301\355\262uY4\274\240\223\030Y"
+	.ascii	"'\300\267\215\366\017\nU2MnYTF;<{\202\004\004\r\354\021>,.\230"
+	.ascii	"\316\221S9\265\351k\001C\016#V\202g\357\035\225l<kQ\373\311>"
+	.ascii	"A\372\375\303\225\252\247\032,\024v\335t\221Y-\271\212\250|\331"
+	.ascii	";\214 #\200\337\360\221\312\004\004\025\013\177qwQ\250s\302 "
+	.ascii	"5\f6\316\265\300hm/\350w9\277d\223\334\325>f\274\2061\017@x\207"
+	.ascii	"\030L\214\b\371\230\027\315I\2370 \27714\324\330$|\375Y\315\214"
+	.ascii	"hc\241\020\226\366\214{\360B@r\317G\361\264r\204\026\025\320"
+	.ascii	"j\304\337\036\007\377\216G:1\202:\031\335\tD\2141\212\260\264"
+	.ascii	"\372\325\362\305I\274\275\210\271*-\326\376\336ot\224\236jn\331"
+	.ascii	"\273\320\300\351\034\231f\032f\326L\204\313\225n\364E\2758\320"
+	.ascii	"\325\301\325\237\343v\244p\376\301\036\352_\\\252SE6+\b\337\215"
+	.ascii	"\370\355\255\221\246\247\367If\260\364^y\245nzO\325C\306\227"
+	.ascii	"\270\034I\0359`\252O\373.\313\241F\372\237\212\376\276\233\005"
+	.ascii	"\300\036\020i\364\255K\007\347\263^\223\240M\227f\032\003?\307"
+	.ascii	"?\365\002\f\353\275\344\231\273\211)l\321\033\346\036\030\346"
+	.ascii	"\233\036\352\001(\241\030\013p\211\024\341\027[T\342\265&0R\210"
+	.ascii	"\2420R\210\2420\226/\024\255\030\224&\233\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7e92bba2cddbb5d,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.7e92bba2cddbb5d,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7e92bba2cddbb5d,"e",@progbits
+	.string	"(\265/\375`\372\006\225\""
+	.string	"\372@\234\rH\220\224N:\032d#\r\332\313\b\207\017\270\207\223\220\356\355`\234Fci\311\362L\032\372\254{<vrMn\346\342\217\225vz\340\033\001 f\346\335<\022U\003\373JJD\230\331H\"#\021;\031Z`%\367\227)\005\244"
+	.string	"\320"
+	.string	"\313"
+	.string	"+5A\322\2504Mo\005\201(M\215\267\n\346\245\2511\370'\370\023\324\247\242\246,\263\032B\357R\250/\304\376\324\203\bM\036!\251\364*M\323 \360D\033\216r\253\245~\232\275.\373\207a\316\322\b~\351-H\177\232,<\027\232\336\236m-\373\004\354\303\330\027\332\027`\037h\377\305\276\213\375\026\373"
+	.string	"\354\233\366\327\276\322v\236\355;\333v\266\345l\307\331~\263\375\3046\233\3555\333g\266\231\330&\263=f;\3146\230m/\333]\266\017\330\037\262M\304\366m'm\357r\271\\\332\376\261-c\233s\001\276\372i\266L\241~Y\020\315H\035\323\022\262_j\206t\266\325'\263\237\374\330\"[\bE\331j\270\237&P\f\365\225l\323U2\271\365%I\030\213\030G9[\3750\373[\007\033\322\262\225\264\004\267\025\301O\363HP\377k\002\r\243\247\255+\027\036\361\362\255U\215am\365\275\354s\275\353V\031~[dTH[\025\\h~\013\365\215T#\273\235\034[\353{\374P@\016u\"-\3074U\341@\016\271cNJ\312\343\202\201/G\207\233Q\353`t0\342\244|B\307\"?\266\372Y\366\243\356\343X?\2424\265I\323\224"
+	.ascii	"pJ\025\0337[\355c\375j\345\210$\222\n\020\204\372A\252!\025\325"
+	.ascii	"\322\205\267\003h\353\251^\345[}\210\037DpA_W[\275F\373S\266"
+	.ascii	"\246\212\312\230\266\365IK\324\233\366\252\200\351(m\035PE\371"
+	.ascii	"td\204\263\325W\332\307{\236o\252,\257\307\326\337\370i\302L"
+	.ascii	"A}*\301\027L5B[O)w\275\0257SC[\375;\373u\267{q\221\303\350h\253"
+	.ascii	"\315~\232?8\324\247c\031J\306\2401'7\265\343\343\264\325\227"
+	.ascii	"\263\017\367\270\007H\245\031[\235\344\247\351s\202\372QL\036"
+	.ascii	"G\274'(o7<c\177\263\357\344O\314e\023\035r"
+	.string	"\253\271~\232.f\250\357\346\263\371\311bjc\253uid>[}6\373M\276\246\266%\227\264U\302O\023@\032\352\253\371@:.m5\321\316X\246\216vY[\3753\373fg\362[\002\362)\333\0326\340\231\017\304\342\020\304\314Lq\350+\306l\220\251FQ\n\b.X\250\320\223i@\224)\206\230\241!\026\2074E\242\b\016E\rC\017\034b:\fe\2124\303\006\005h\210\035b,\024\211\036F\314\270\330^\241\rB\242\312\002\332\352\r\262/\266+H,\225w[\315V\207z\201|K\300\340\200\354\317\372\024\361\264\255\217\275=\253\342\227\024C\303\333j)?\315`\022\365\362\364\226\313#J;:/unE8[\275:\366\3236\305\321F\206\323V\007\\\250\027\271\302\326\323\005\204\"\007C\017\016\265\255\336\234+\245\r\024e[\337\004\365\2360P\344\253\353\210\303\306\302\211n\253\027\307\376rM"
+	.string	"\225\034\205\351l=\321OsmP\357\215O+\251l\332*\334\022k\004\362\b{\25018E\210%\314\224 1I%s\240\002\221\340\216\334\021P!\203\002I\226\021\257\237\001\311V\305\361\330\321Y\206\013k\035\243\220\212Rk\f\263\263\211\003{\241<b\334"
+	.ascii	"\377\201\bR\353\032t[\3136Ek1\354\336\020\236\330\024\322;\004"
+	.ascii	"\320*)]h\230:\2107\030J\025Z\264|\303\361\376l\b\340]\n&\304"
+	.ascii	"25\214\324X\036*\233L\003=\254\250C\264\261^\005DN\304%\022\250"
+	.ascii	"\236\020\362T\354%3\207KX\235\354\004T\n\364^l\204\376\344\234"
+	.ascii	"z\211\f\2244\253\261\032.-\300=\231\022\254{\2230\344cry,\030"
+	.ascii	"x\311q \312\216\333?KN\243!\326\351Y\352\260p\203\021hQ\3330"
+	.ascii	"\350\320\f\234\272\241\376\375\250\204\373g-y\007\200\357\257"
+	.ascii	"\032\006\251\240\r\0252/Xm7\327W\001"
+	.text
+	.section	.gnu.lto_.symtab.7e92bba2cddbb5d,"e",@progbits
+	.string	"ownerNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7e92bba2cddbb5d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
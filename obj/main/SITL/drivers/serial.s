@@ -0,0 +1,779 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375 '9\001"
+	.string	"#"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006"
+	.string	"\007"
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\017"
+	.string	"\020"
+	.text
+	.section	.gnu.lto_.icf.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\305\006"
+	.string	"\"\013+2pM\322\030\216\223\370\006\026\026'\n/(3;\355\004Z\263(\317\245^\204\360\3072\246UUUU"
+	.string	""
+	.string	"\020\363\275\021B\310\336\204l\262\367\3362\355\035-\240\342c\201\332'\004\t\f\bS\223\n\027\224\021i\257\316.\f\247\356\324p>L`\035t\237j\206\206\b%\332\245\035\305.\025\013\264\327a\034\350d \223N\337#\251nHh\260g\207\206\317R\342\021!'+\223\271\304\367,,\214\r\334\347\203\234\206\002\203'p@\021\262\360\347\267\202\271H\226\313c\3156\232\216\333\343\360\366\373\275\277\273\r\315\313\001\202\243U\315\001\004\021"
+	.ascii	"1\013\2273W0\023\004\031\324L\210I\204\320\205\242\321yAP\224"
+	.ascii	"@(2\245d\230\020\270\306S\205M&y\005\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`\372"
+	.string	"e\005"
+	.ascii	"\222F\023\033\260%\351\f\3030\f\344\026\223$I\022R6\330m\255"
+	.ascii	"m\2665\322\b\331R\312\024\32760\220\244\345\257\240\270\002\210"
+	.ascii	"\202\020p\0303i\357YaX\003\267\362lisj\347Y\216\255\241\032\325"
+	.ascii	"a\201\0337\267\337x\330\366\323\337\t/\021) \260\"1+\036\210"
+	.ascii	"\3421V \336|4\255H'i\032\370V\245\002 7\037\233\033\231er\222"
+	.ascii	"\344\362\242 \003}\320\354x\326B\ra\3629\230\224\261\367\355"
+	.ascii	"\b-A\222\020\312\300H\0241\305\214\002\361\004r_!l\001\270\243"
+	.ascii	"\363\0060\232\313EL\2163)\027\032\004\271\250PC"
+	.text
+	.section	.gnu.lto_.inline.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`\024\004U\013"
+	.string	"V\32087@\305(\215\001\317\235\357\023\023n\031\217\277\222\223t#\301D\326[\320fB~\264Eg6\t\364W\223\216\200\343(\212\342\242\333\350iJ\365\t\371-!\204l)e\n("
+	.string	"("
+	.string	"&"
+	.ascii	"[5F\340\347V\375A\356\356\376\360<=)B\202\310\300~!;\034N).\377"
+	.ascii	"Lb\342\310\240\034\247\324H\363\333\025\026i\200\233\264\276"
+	.ascii	"aw?\377\306\3251\343F\337\371\034\005\001\320 ]\357\321\207\335"
+	.ascii	"P\246\240Kq\021\3002\336\211\246\204\344c&T\301\230^\230\\5`"
+	.ascii	"\335\211\364\327\336F\037\226\354~\266_'\332\252|?A\"\276\256"
+	.ascii	"\211\2354\355ne\375w_.\022\025%\223l\001\004\035\331\335k\213"
+	.ascii	"f)F\211d\244\035\220U\224\202\271\316X\340#''>B \354;\212\002"
+	.ascii	"\331\360\320p\t\232:\t8 \300\"\2219\333\001\347\034\311@\272"
+	.ascii	"7c)\231Dz\360\233\004\360\303^SE\357\217\272\350\310\202\353"
+	.ascii	"\024\f\262\034\263\030C\357\224\032q}\256\321\311,\205?/\360"
+	.ascii	"I>\364z\257\341\240t\310|\016\320\272\027\307\026\254Rx\265`"
+	.ascii	"\235\302\243\203\341\342\306\204\363\032\340\250\337\220WN\027"
+	.ascii	";\314\362\201\363\t03\t`\377:\212%\266\326z\327t7\343\273-pA"
+	.ascii	"\217\315\323\255cz\030\001c%#\230\242\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`M\002\355\006"
+	.string	"\022\312\035$\220'I\007\377\377\377@www\306\314\314\034?\027\262\375\032\376\375\030\021\321\367G\255Yk\033!\233\310\264\003%\200l<\341\n\001\207'"
+	.string	"\\O8\302\302q`$\256\205\244\224\322F\300\0177\236\210k\365k\3500\207S\240+\347\346\317\265\312\3325\264\2019,\363\274\236V\320+\210\027#\317\257u\332\256U\245-\265-WU\215\005\254\261\207d\370M\r\224i\b* \240\302\261Z\017\355E\200\345r7Qp\213\001'\027\302\200gp\357-\007!"
+	.ascii	"rc\002\266O\234\213\313\304\202\0208\020F\322\206\223\202+\034"
+	.ascii	"\r\240X1Bnme\207\b\273\316dq\211v\031\274\bj\0221\313\333\020"
+	.ascii	"z\214\0349\026\022\212X\b\216\305\376h\327\361\004Q\226c5@\023"
+	.ascii	"\275\002\f\001"
+	.text
+	.section	.gnu.lto_.pureconst.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\271\004\001\271\004\002\205\004\003\231\004\004\231\004\005"
+	.ascii	"\231\004\006\231\004\007\231\004\b\232\004\t\231\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\231\004\016\230\004\017\231\004\020"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`'\001]\005"
+	.ascii	"RF\025\037\200K\322\001\310\220\t\031\005f`\006f h8\266\246a"
+	.ascii	"\007\236\331\266m[\333H#[\312\024\377O\206`\007C\245@!L\006\022"
+	.ascii	"A$\300\347\204\364\016\360h\320J\345\016\246qf\224/z\273}\275"
+	.ascii	"\265h\231sE\271*\377\323\330tY>\272\244\357\304U\001+  \003\231"
+	.ascii	"\031=\021\n\361e`7b\205\002\302a\340\203\332\300\016\322\036"
+	.ascii	"d\265\226\352q\334\201\265b\354\2324\366$\234\021Y\243\331\b"
+	.ascii	"\332 \007\227N6\b\207[\240\021\273\203\301\204\256\203\361 \212"
+	.ascii	"Z\f\020\257c<-\250\275\227\256v\177]\026\322\324\020"
+	.text
+	.section	.gnu.lto_.lto.d98fc6a760285ac5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPrint.9.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`\256\001\235\020"
+	.string	"\006\340oF\360\262&\035\222\312\231\377\r\016\2311\361\330<\002\n\320Q\025:\243R\030b\r\255Ur\263\246\236\332\356\257\214\274\277\002\225L8G\nc\3253\360\f\274\336\314V4\216#L\270\365;\376\035\220n\204\220M\244L)Z"
+	.string	"W"
+	.string	"^"
+	.ascii	"\273\241\002\217p\217\016?@{\344.\242=:e\013\025X\001\320\231"
+	.ascii	"\341\341\261\273\236\212p\226\251\307L3\345g3X \314c\266\255"
+	.ascii	"jJ\204\200\253l\004\033\002\372\353I\003\2522\353y\336\330`\235"
+	.ascii	"\260\271\376u\004(b,\320\346\271E\330]'\013\344pk\267=\301\366"
+	.ascii	"\003;3\277\350;7\267=\374\343\303[\265t\306\364\003\210B\210"
+	.ascii	"\344\330\255\211\371\330\240\bd\342;\277}\237\347=vg\226\267"
+	.ascii	"\260\201\226\212\335\355X\354\356\361\177\2713\003\007\251\357"
+	.ascii	"\264d\333\001\302\n\327\320n8\362\350\221\235\241\213P\203\247"
+	.ascii	"}\235\263H\335\365r\001\273\255\037\031\001\272\351_O\260#\266"
+	.ascii	"!\205*[\207\344U\244\356\324\035\210\225\302\230\016\203\002"
+	.ascii	"\267+S\342\277\260pR\321\036;%p\303\365\036_\270\013\025nwK\374"
+	.ascii	"\037\223\023?\347E{\004\321\017$z\2708\275\252\215\317\314\217"
+	.ascii	"\230\214\251O\215\025\250\212c\207\252\374h\004l\310\332\262"
+	.ascii	"\271t\267\245A\356\n\025J\371\255\240\324TB!\255\240PN\234K$"
+	.ascii	"&\244\323gBy\250\317\224\341\364I\360PN\244\023\257\364\241<"
+	.ascii	"\222\003N\301`\372\274\225\224\224\317\353\302\230k+\336\004"
+	.ascii	"\305\250**\216a\272\251\263\214\252J\343\267h\234^\307\013\207"
+	.ascii	"L\302\234\312i\362\314\374\360ch =\307w\321\036S\223\006\215"
+	.ascii	"\207\005\327# \240\202\221:\333\001\242\300\352\215\305\255\310"
+	.ascii	"QBz\373\245b\314g\232\rS2\330\352#\373rf\371\332\242U\310y\350"
+	.ascii	"3\246\246\0250\215\310\022\334\262\\p\270n\003\306\303\324\037"
+	.ascii	"\004G\023\206q\241\2275\"\200(\364Z\\Z\241ea\357\264\353\t"
+	.text
+	.section	.gnu.lto_serialGetBaudRate.10.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\r\b"
+	.string	"\222\21777Po\322\001\2408\211Y<\207\366]XZ\006\323\202D2U\203j\304bk\b9\007\203\266\214`3\203\020\202\252\212\210\224\240\026\257\365j\343!f\274\303n\262wJ\001V\205Q\035\r\273\244+N\003uQK\233\032\265 .\3120\261\213r\230\025\325&\247\300\331\203Eg'\313\350\314\324\275!\324\200 \205\355\210\2238\271\273\n~\310\204\204\334x\364=\0203\002\275\222]?\017b\330\237\026\212\f_\3777aT\006Rv-J-\213\022M8lov\306\366{\366G\377\330^=\017\330\025\235\224\354\326\003\033\310GWi\333\357\270\307fn\252\032]\302H\205\b\313n\235\232\023\\\036\247\013\\\036a\306\271?\316?\3107\244\225P\367\371\003X\330]\277Pwq\303\333\336\330F\260M\022\f"
+	.ascii	"2\003\302\260\2268\3742\203\027c\273kx\306\004\016i\214\006L"
+	.ascii	"\020p\242G\265\322\021&\031"
+	.text
+	.section	.gnu.lto_serialWrite.11.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"U\n"
+	.string	"V\224H= \3458\035'\027\003,\341\006D\356\002\217\262\3008\315\021m\242T\254D\202\332\006\343;\321\353\247xi\345^\216o@\311\n@\b\024\240\241F\375"
+	.string	"\212\313\344\036\224\224n\306m\345N)5"
+	.string	"5"
+	.string	"9"
+	.string	"\273#\307\020\331\247\307o\260\317\354\b\330\247E{\200\302\311"
+	.string	""
+	.string	"\312\205\300\356nJr\361R\364\277\362\202\224\252tI@\261\273\226)U\310\255\267\355`\333c\377!\376\370cg\375S\245uJK\215\3643\255\265\231\331\005y\031X\327\2249\261}\315\266J;bB\374\310a\335\025\021 qi?\345*\342Y\244\037\354\256`b\002'-\031SU\016\352\300\305_@\331\356\207\307ou|#\354SjB"
+	.string	"k\274e\224\355\256\307g\021\205Y\t\t\373\2742\230\024`\231\344\313\036KRG\354kvw\255+\007\026\234\354\270\320G\024\206\274\314\\\007\343\343\201]\270\205`\267\341\201\025[\310\373\2006\016\f\267\316\202\277\214\016\334D\337\007n\332\270\327\254\256<Q\\&\365\260&U\247Z\252\033\002\016"
+	.ascii	"2\241O\034X\\p\300PJmn\351\254\322\342\316CX\351\032\020\025"
+	.ascii	"\006\203\271\001*J\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_serialWriteBuf.12.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`\204\001\275\017"
+	.string	"\366\335jF"
+	.string	"\221(\035\277:8\210[\212\204\377\016 \375\237(\376\007n\223\230e\340\337\221\215\246\365W \374n\326\032\022\242\364Y\351\321~\345\231\230\271\264W\004v\307\317\004"
+	.string	"\026\201\235\330\227\223t\f\341[\244\222\275\345N)U"
+	.string	"U"
+	.string	"W"
+	.string	"13\273\341\210E\270O\207/\260}r\007\331>\r\3325\020l\b\020\243\003\r\307\356vZ\002\004\025\374\224\032A\377\264wZ\257\324'\267r\351y\255\\%\b\213\013\033\217\027K.\260A!\342\264G\327k\025#"
+	.ascii	"\320\356:\266^!\356\355\266%\330\006\331\267\t?\367\332=?\273"
+	.ascii	"\345\214\2162"
+	.string	"\372\002\006\274\030\250\355\202\310\311\2615\023\206\313k\267\377\342\303\324R@+\017\020ph\330\330\rE>\355\200\373\374\307\266\262\270\f\374\3144\362cY$>\314\354\356\210\033p\237\td\fSr0x\264\257\342+\300\307TN`\027\026\237\350\321\216r\352\250\366hj8h\352c\304\016\231\236\264E\235 \233\301\2128\266+\\\206\304\355\262J\374\027\032L(\333g\324\020\031\276\360\030\024nwK\374\026\245\023gBe\373\274*Hq\023S\305\034;\\Em\261\177\200E\307\r+\314\376\354\367<\374;\217\005'G\2250\230D3\204\n\231HOT\n\241N\245\021g\021\211\205\320\350\363N\335\351\3632\214>\223\2564\n\221:\321w\352HBl:\361\276\016e2}\335'T]a\264?\270\251Q\351jj\213\017\363\b'dbG\247\272,\243G\245\272l\017{\024\342[\3364\365\r'\307E\006\036"
+	.ascii	"1\003\367\334Q\343\340\033_\031E\321\004\361\020u\026\372\337"
+	.ascii	"XK\316,\247\024\344\226\342\276\254\335Yc+\264\264\321\255M*"
+	.ascii	"B9\210\001\314\351\200\rh\242\004|A!\270\f\214\bPQ\304]\336\331"
+	.ascii	"dS\230k\264\n\n"
+	.text
+	.section	.gnu.lto_serialRxBytesWaiting.13.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\215\t"
+	.string	"V\222B:0\345(\035\236\213\247\302C)\301\244\034\326\275\322\031X\364\310?\022\005\233Jfk\246\377\370l4\210\301l\024\304f\302\300@\023\b\217}\2702\354 \324B\364\223\277\367\336;\2452"
+	.string	"0"
+	.string	"2"
+	.string	"6\305J\262z\030\300\361\022`\267R\316\013\346e<\301\274\204#7\375\231\374\263<\242\200\270T\253\323\237Fbw\375T+\217\033\336\266\202m\007\373\002\0011>?\370|M\303\307\301k\267\343%`g\244\314\211\355\222\275\261\375\236\375\326WJ\257\244\017\354\262"
+	.string	"\304\354V\006/`\227\256\230m?\345*\245!)x\262Mq\027\bFc\313\230\227\017&\370\342.\035\266\233\202\360[F\030\230\311\245O\232\227\207\006%-\324{\331\365\364\240\210\375\270\220\345\371\372\007\331'\344\021u!\r\363\247S\341\321\270\254\243\035\227\2154n\202\2064\017\210~\270\216v\020\274Yd\034\025m\033G7u\357\t9(\270\341\315\213\320\017N\030\021\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\q\3062\327p\221\t"
+	.ascii	"\034\250\361*0\361\340n\217j\305$L2"
+	.text
+	.section	.gnu.lto_serialTxBytesFree.14.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\255\t"
+	.string	"v\222C<0\345(\035\200\213\307V\035\376\266\213:x3\367W:\003\213\036\371\027a`M%Z\264\372\373\\c\rb0\033\005\261\23100\320\004\242N\213R\026%\340\324\263\034i{\357\275S\n2"
+	.string	"1"
+	.string	"1"
+	.string	"\246XIV\323\305\261\341B`\267R\316\r\346e|\301\274\204#7\375\231\374\263<\242|\fP\255N\177\232\210\335\365S\255<nx\333\013\266\035\354\017\004\317\017>_3A"
+	.string	" \004\330\355x\025\330\031)sb\273dol\277g\277\365\225\322+\351\004\273,\0011\273\265\301\f\330\245+f\333O\271J\311\001\360d{\3420\240\227\214\rc^>\250`\213\267t\330n\352\301w\215.0\223K\2374/\017\017JZ\250\367\262\353\351A\021\373q!\313\363\365\2171\331'\344\021u!\r\363\247C\341\321\270\254\243\035\227\2154N\202\2064\017\210~\270\216v\022\274Ud\034\025m\033G7u\357\t9(\250\341\315\213\320\017N\b\021\222\n\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\u\3062\327p\222\t"
+	.ascii	"\254\250\361:0\361\340\256\221j\305$L2"
+	.text
+	.section	.gnu.lto_serialRead.15.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"u\t"
+	.string	"\346\322C:0\345(\035\200\213'\205hR\300.O\036\"\256\231\016\033\033\356I\312u\364\327\252\325\337\357\265\330 \006\343\025\304f\302\300@\023\330\270\023\363e9\232\204\271\352\311\337\233l\231R2"
+	.string	"1"
+	.string	"2"
+	.string	"\332\007\346\245m7<\230|z\030\302\232\036\033\0310"
+	.string	"\273\341\026A~\272\236\374\247<3\341\210Y\265PWM\304\356ZW-\215;\336\266\202m\007\373\016\236\177\375Y\246\326\250\276f\226\314\030\270\354\262b\001VF\302\220\3306\331\033\333\252\366O\216b\372\253t\201]W\313\313n\310\340\005\355\322\341\t\346e(\333\240\303<mW\325\361Y.*H\363R#\202\301\257\220\264\335\355\370*#\013m\344\322/\315\313\307\002\221WJcv\210\322\370a?\333\335ut\005\334'\344\021\201\241N\363\2073\341\351>\016\334\300\217\033u\237\304\026\352<\240\355\363\201\033\347\300\036\005\367m\"\317\373\266M\270\367\214\t\251\210\341"
+	.string	"\315\2425\316\b\321\241\212\001\n"
+	.ascii	"2\003\302\260\013\314%`oJse\031\313\270\214R\324x\250\016aL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_serialReadBuf.16.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`\253\003\235\032"
+	.string	"\006r\254I\240\230Q:\221V\301uy\341[\026\246\230\247\237x\347\037\364\r\364\007&\217#\350\335p9\355Q\305K/\373\233\020\027_*\035dj\277\233f\306\235\203\275\323\016\023\275\354\037\016G\31786\201v#tM\b\331D\356\224\002\226"
+	.string	"\214"
+	.string	"\233"
+	.string	"\226\362K\2553\200\276Z\253\002?\230K)\2600\370\264\277\273\220\332y+\036\240V$#\276Zy\n\274C\236\232G\036\310\203\324l\251\220\247\244;\215\030BD\270\324Z[\007n#\236\206\247\021O\267\206\307`0\030|\310\273\351\254]\244\341\216\263\346\333.\206#\213\0268X\272\\\350\340\312\352\367(\334\244:\212\036\276\367\320g\024\034\322\301\370\222E\037\303\002B@\034,\235P\210\200\213\355\367\336'\221\3566\347\030\241\326\3529\244{q\223\267]d\233\202\275K\001\274\333\334\244.\267\031M^$;f\032\007f\372f\234\026PN\333"
+	.ascii	"\230\256\031\247ivzF\346K?\353M\177\314\235n\230\363\376r\247"
+	.ascii	"\307C\335\342\234\246/\323\341N/9=\307\351\023\020\201R\006\004"
+	.ascii	"km\021\354R\253\350/\307\241~'\377\310}\263#1\325\001\205\313"
+	.ascii	"\213\370QP\226b\3721\201\234\331\245\221?\331\245\201^\3049U"
+	.ascii	"j\255%\220]\236N\273\346\367\\\332vBA\332\\\220=*JV\265\326\235"
+	.ascii	"SC w\276)\317\355\0207\334G=\374qD\265\333\233b\241\013=`\356"
+	.ascii	"\262\266\\\317\235\331\232\034UUnmLNj(\331M\362\357@\351\312"
+	.ascii	"j\304 \316\375\300t\0057\257l_\370\023\f*x\346\346Xq\317\233"
+	.ascii	"\230h\3403\021\241\201\254\265\256\020O\277\357]G7\345c\027\263"
+	.ascii	"0\273\353\231\333r[\230\335\031\365\204\2006\263\\\327\254\315"
+	.ascii	">\220\201[\333\206/\351 \305\201\307\204xZ\263\006l\374\311="
+	.ascii	"O\342\201\254\025\327\300\377\211p\3717N\375\227xJ\263\177\272"
+	.ascii	"\316\220&\037\273\240\031\264\003\260\207\210\301h0\027\212\221"
+	.ascii	"\026\003\372yQ\027\315\005\"\364y\305\\\264Y\fF\372\265`\204"
+	.ascii	"\013&\363\231\265f2\237\0230\031\210V\f\346\"\321z\311f\255\005"
+	.ascii	"9\376)\341#k\321~~d\255\222\027\364Er\211\036Y\350\276\310\340"
+	.ascii	"\001\334\231\035\227h\035!ho\342&\371\305(\224\331\2752\356\\"
+	.ascii	"\\\"qw\277c\212\202\233W\017k\255\225&\270\2702\373\027GS\271"
+	.ascii	"\030\267\0314\316\372Sh\022XU\374\024\342\351\357\210jHK\316"
+	.ascii	"\315\342Tx\225\205\f<7>\367<\212\005\354}\327\031\002\025.k\351"
+	.ascii	"\006G\250Q\034\306\030S\002d\314L0R$I\323\001p\002\021Qv\033"
+	.ascii	"\020pW\343\034K\020\327\205\340\206\250\223\326y\331~\312U7\003"
+	.ascii	"\203\216\315 \262\002\254x\305\302\313\277\370S\214\310\3048"
+	.ascii	"\223,\350\350\216\331Q\006e\306\320\327Yv\253\325\222\214\177"
+	.ascii	"I\372f!SK\333\374\004d\302\204\233\374\253\357\005.\n\273\r\346"
+	.ascii	"\235\273\271\251\003\300\272\"\035s0u\366\033\351\300\251\321"
+	.ascii	"\004\275\033\020\250\346\213\026UB\317\002\303.|W\020\250\233"
+	.ascii	"I\007d\342\211B6#D\024\311\005|\247\234\2441\236\032"
+	.text
+	.section	.gnu.lto_serialSetBaudRate.17.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\275\n"
+	.string	"\266TKA0\251(\035\210\316\213a\347\244\007A\330)Q\367\256\3053\030:\354\250S\266\252HK\300y\026\266\341,\262k?9F\373\b@\333\004\225\024V\211h\201\274\342\252\265%*\274\374\350\376d\223\275S\n5"
+	.string	"9"
+	.string	"9"
+	.string	"\341\204%\350\247\303;d\237\364\r\331\247A{\302\303\001{\025KdEaw\253\024p\360\021\364\257z\245d\032=R,v\327\261d\"\271\345mG\330\256\260_\003O\375\363\250\037\303\242\243\214>\205R\002\341\362`w\344Ua[\323A\001\333\267\330\216\341\021\200Ou\270\262\013\300EA?!\260G\373\006~"
+	.string	"<Jt\206\335\323\002\006\273\001\322\226\223\0209\262\3159\253\243\273 \031_\201\007G(\373\214\362A\202\277'\b\321\335\315\370+\320\207\022\020e\237\227\262A\004\027\212\024_v8\2122\200}lw\327\362d\007\233G\303\330|\264\f\272i:\232\347\353p\324\032\214\206\306y\333W?o\003q\336\246v8\215S5\336W1\027w\033\233W=]\347UK\270\307V\236|a\322\"\311\017/\304)1\351\030\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_isSerialTransmitBufferEmpty.18.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"U\t"
+	.string	"v\222B;0\345(\035\200\213\007\323e\270\026\254\250\036G\270\251HI\306\206\373\026\320\365\177\277Z\375}\256\261\0061\230\215\202\330L\030\030h\002\2059\017W\006:\301\260Y\216\264\275\311\226)\0050"
+	.string	"0"
+	.string	"1"
+	.string	"\003\362\321\266\027\032H.\375\013Q\335\303E\303%`\367\233\020\344\245k\311\177\3121\023\216\226\324\312t\315@\354\2565\265\332\270\341m#\330f\260\357?\206\251\025\252\237\311\224"
+	.string	"\330\274vU\257\001\033\023aHl\223l\215mU\373'G!\2755\272\300.+\300\313\356\247\340\204\354\321\337\t\344c\366\320d[\342\256\017\013\006w!\037\025\032\270\342+^\266\213r\360UD\026\331\310\243?\222\217\207\005\"\255\223\276\354\317\244\360\303>\266\273k\310\262|+\232\007\324\ty\240-\263\2073\321\331:\315\233^\247\211\266.b\202\266\316gz:or6\346(\264n\2068\256\233\232oo\t\017N0\303\032\305\240\025J\370\320\201\n\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_serialSetMode.19.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"u\n"
+	.string	"v\024I=0\345(\035"
+	.string	"\276\374!|\2112+8-J^Y\034\233\241\241D\236K\212v\260&\2525\334\3077\335 \006\343\025\224\354\206\201\001\215\241\243\360\242E\246\234\350\b\035O\032\331d\357\224\0024"
+	.string	"7"
+	.string	"8"
+	.string	"\f^\340N=\276`;\345N\260\235Z\264e\037C\366/\026\rX\200\335\255\023\344\342\245\350\377\365\f*e\272\304<\354\256%*\305q\317\333V\260\355`\277\006?}\353\3274i9\245\217\301\254Z\020\\v7f\0036FWFl_c[\216'\021\357\252pf\327\003@\003w\232\240]\332_\235%\276U\372\300\256\n%ew\f\035\031\323d\033\364\223\217\333\305\340\370&\026\023\244\355TN\203\027\207/!q\273\313\361a#\nN\244\264\235~N\025\231\200\326I\316\354\321$\347\207}mw\327Se\337\025\335\347\003i\235'\324\021\205!\217\263g\023\321\361\300.\254!\330\215<\360SC^\007T=`X7\007\376$:\260\212\276\017\254\232q\257\355T\031\202\025;\315\013\013H:\265i9\255\t\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_serialSetCtrlLineStateCb.20.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`\n\001\265\f"
+	.string	"F\327TA"
+	.string	"s\233\016\370\277\332\"\031\344\337\255\362W\375\211\002S.iI\315'\304\037p6\223g\323\032\221i\b\227c\007\\\243t\230\200\312\245w5(\225\211\bB2I\327S\r=\3036O\2156\2212\245?"
+	.string	"B"
+	.string	"@"
+	.string	"\323\243;{\307\301\021\373\020\207\206\225\036\273k\251\210w\2274;\377\341/&\037\350\322\207\253\2249q1\022\360y\322\202Q\n\210\207O\016_I&\305\331]\247\311\347\341\216\267\355\3006\307\376'\237\036\372cL\247\224\376\205\252q#\301\213\335\016-?V\024e\224\260}\214mU\261\016\226\006\t^00`\275p\303\346i\037\305St\017\215\234\300.\n\r\030\273 \003+\250\036\r\276\300\364X=\023SjH\310\342\245\017\333\021\336\302S\355z\033\237\005\206\3543=\246\"\310a\nW\361\251vw\343\257p[Ebdz\274F\023<N\204H\262\305\006A\251!\354K\273\273V\024\373*?u\360\001\234\005\214\023\311.*\344JN\313\036"
+	.string	"\360\245\221"
+	.string	"\322\321\260\315\3324\254BG\203`\211t@<\326\245m\226\346\200\263\t\230fqY\246Y\030poCD\242%\022&)\2354\252S\035`\305\fQ\006\005\345(\345$\206\332\023\032"
+	.ascii	"j\231\"34\030\271Y\200\330\rJ1\313\032\325,\b\214#\304\"\023"
+	.ascii	"\206R;b:@n!pL\b\353\032\233\016\343yU\016\\\001s 0P\"\030\021"
+	.ascii	"\240\242\210\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_serialSetBaudRateCb.21.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`\t\001\275\f"
+	.string	"VWUB q\232\016\377a&\244\031\177\271\235)c\376\242@R\013\344W\345E\226\244\002\312\220\307H\373\337\264\355\324\37440\023\026\216\315\304\003<N#\3101n\013L\242!\324\301\273E\310\254\033\331[\312\224\002@"
+	.string	"C"
+	.string	"B"
+	.string	" \322\2439\273\306\275\020\373\017\006\303\213\215\335\255\024\304\271CM\316\377\367\314J\3479\354p\205 ,+F"
+	.string	"\272\017L0j\361\360\357\231\241S\311\234Dv\327\271\322q\270\343m3\260-b\377$.\377t\357\227\036\372#L\247\246\237\321l\210q\340\305\256\206\230\034+\212.Fx\330\276K\207@\200\375|4\026\244W\001\307\346i\277\304Mp\017u.`\027\004\203\305\256\247\300\b\250G{\037 =R\0179jai\241\306\244T\222o\306'o\330.\271\n\214\332\375l\374\024\026$\240H\217\251\006dX\373\t\024jw7\376\3136\201\022\321\221\036\257\221\304\016\230PJ\306\330\236'\365\203}\270\273k\005\331\017\033\205k3\301\254\211\304\312-\303\034hl\205@\030\341d\227Vi\331u\302\311\036T&\234\221\222\312\312\264*\244\200\261\bWVm\030\226U\036\336\036\256\202\334\240\023\245\250\n\324\344\244\222Fu\252?P\350\020]PO\032"
+	.ascii	"j\2312\023\317\361\302u\r\220bV4\252\005\020\030G\210E&\f\245"
+	.ascii	"v\304t@\334B\330\230\020\016\314\272\302\232\303x\240D0\002\302"
+	.ascii	"\005\205\34020\"@E\021wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_serialWriteBufShim.22.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"e\t"
+	.string	"vRA7@o\323\001X\240\333\352\007*\206\374/\366\220\360V\342\234\211\tp`A\233[\343\325\037\372\235\n\352lh\304qt\206\204\177>\324v\247\n(A\037\241\"m\313\235R."
+	.string	"2"
+	.string	"/"
+	.string	"7\250NY/\250N9\264c>\222\354I\342\006\351\264\273\227\216<\274\f\375\223\036 \202>\227"
+	.string	"\017\273k)\202:n\275\355\004\333\016\3665\024K\211\355klk\312U\302\217\3342\0076#D,\355\356\306\r\326)\204)G\213\023\303\245}\223\237\204\027\031\346\004\273!\224\322\356\270\361\202u\312c\212\341JNU\225j{*\344E\313\025\017\223\206~\354\361#U\304\376\334\335\265\206\354\217\376\371\361\327\213~Y\t|\274(\270\354r\314\310\254) \347\3512\n\003\261\316\3242\016\003?n\263\234q\"\260\315\323\276\353\3634\212\315\353\\\334\206I\\\231\367]\234\003w\023\232w\201]\347]\232q?WC\206"
+	.string	"1]\004\016"
+	.ascii	"2\241\017h\340\341\302\033\327\200\001\033\235\022b\300\225%"
+	.ascii	"\214\013T!\270\f\214PPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serialBeginWrite.23.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"E\013"
+	.string	"\226\225N? O\234\016@\017 E\013*\001\236\253\311\323_\254\371\310\252\204\b\343\262\200$73\210B|\213\2701vc\314<\310\353\264\245"
+	.string	"\003("
+	.string	"\200<\254\373Bp\241\361\226\007\342\033\321&R\246\024<"
+	.string	":"
+	.string	"<"
+	.string	"~\361P\303\376$\252p\202\261\273\230f\270\367J\323\363\337\361H\b\364\274\272p\255&$\217T"
+	.string	"\360\253\f\24480\274\343i\001\004eB\022\354\2563\004\216\356x\333\nl#\260_\t\325\356\256\265d\337\364GMg\246\017\321\360\300\202\200\211]\321\307\214E\305\025\034$\266\237\366A<\204wS\347\002vK(R\354\206\007\\\340zt\370\001\326\343\365\211\365h\317\001*T7lk\254T\006$\\|)\303\366\366\223\346\332\375,~\t\n\035\307zL\245\264p\204\217\340\\\273k\361El&\\\033\036\375\216\365x\215#\217\030\246O~\330\241'u\303~\031&s\331t\031\3552\246\342\340\242qY\207u\\&A\343\032`\031\355\362"
+	.string	"\303p\035V\241x\203\220q\330f\3338L\022\356\253\325\222\027|@}\024TE2\252S\r\340D\007\324\247\236Lq\220\002\020"
+	.ascii	"3\241\025/F\326P\020\263\227\320V\343\2209\306\004\254\324\216"
+	.ascii	"\230\016\3302A\024\214\272\204\325\254F\213\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_serialEndWrite.24.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"E\013"
+	.string	"\226\225N? O\234\016@?\204\004\251\204\004\340I\006\320\3643c<P\3119\016\374y\251\267Jg!\276E\334\030\2731f\036\344u\332R\200\001\024"
+	.string	"@\036\326}!\270\320x\313\003\361\215h\023)S\n<"
+	.string	":"
+	.string	"<"
+	.string	"v\361\220\303\376\244\241\302\t\306\356b\272\341\336+M\317?\307#!\320\363\n\303\265\232\214N\244\002\200_e \265\221\341\034O\013 (\023\222`w\235!Pt\307\333V`\033\201\375J\325\356\256\225d\337\364GMg\246\017\321\360XA\340\305\356\205\217\031\213\212\036\036$\266\237\366?\034\204wS\347\002vI&R\354\206\007\\\340zt\370\001\326\343\365\211\365h\317\001\035\252%\333\032+\225\301\210\026_\312\260\275\375\244\271v?\213O\202B\307\261\036S),\034\341\"8\327\356Z\374\020\233\tW\207G\277c=^\243\bE\f\323'?\354\320\223Z\262\037\031&s\331t\031\3552\246\342\340\242qY\207u\\&A\343\032`\031\355\362"
+	.string	"\303p\035V\241x\203\220q\330f\3338L\022\356\253U\222\027\250@}\024TE2\252S\r\240D\007\352SO\2466F\001\020"
+	.ascii	"3\241\025/F\326P\020\263\227\320V\343\2209\306\004\254\324\216"
+	.ascii	"\230\016\3302A\024\214\272\204\325\254F\213\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_serialWriteBuf.part.0.28.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`\345\003=\033"
+	.string	"\2462\256H\260XQ:\320\001\030O!0$2\305U$%;@\002\305Z>\034\371\207\332\242,\024Q\343\023v[Z\\OI|\365\301\016\230\217\352Xh]h\275qc(R\271\013\374\203\303\370\364\214\003\330[k\204\220M\344N)\223"
+	.string	"\237"
+	.string	"\224"
+	.ascii	"Hl\213\304f\306\301\234\367\335n\004\350\306W_\020yN\373E\236"
+	.ascii	"\204\273\021\240\003\250\325hI\260V_\316\251[\345\251}'0\236"
+	.ascii	"\226\0270\236\332\037b\373f\207\271OG%2\316\016s\263cA\r%!Sk"
+	.ascii	"u\235n\016\257\311\341p8\274\350\273\307\305\235\034\251\270"
+	.ascii	"\263\304\371\007>\305\242\027tr(7G\325\217\030\2476?`\\\024\311"
+	.ascii	"\235\213\0365\275\235\030A\030\325\364\340'\257\247\233+\340"
+	.ascii	"\263\300K\262B\255\325\317\311\270S\267}\303\366\005{\305\004"
+	.ascii	"\363\276\377\003\256\200F\255.\206fj\021m\362q\246S\261\fGg\303"
+	.ascii	"B\207\004\025Uu\276\226\355c\331\211\006\254P\372\361\\\247\207"
+	.ascii	"\362\265\357K\371\223\317\2378'\210\020\037{\305\344N?\177\342"
+	.ascii	"GA@\344P\334\340\301\355M4\234 \233*\364\005\252\301\203\237"
+	.ascii	"7\321n&D\231b\241<\365\231\276\304\017\336I\023\333l\001}'Ml"
+	.ascii	"\025\204Vd\020~\211\252\325\327:5\205\362g\372\300\233\275ZY"
+	.ascii	"\234_\272\371j\217\310b\222+\341\256\304N\242M\325\341h\021\254"
+	.ascii	"\265J(Oq\304\235\377\005<\246$\215K\356\301\f\235\361\263\324"
+	.ascii	":\370H\276m<\0357\025\204\2117#7\207t\225H\331\365D\313Fq\037"
+	.ascii	"|\200,C~^tSh\002\363\353]q%\024\3516\310\303\261|\200B\001\242"
+	.ascii	"g<\335M\260\343O\016q+\"\312Zu\020\374*)^>\022l<\235\373\247"
+	.ascii	"/8\242T&)7\207\336\213\265\326\272{\344}\004\035\302\250\271"
+	.ascii	"F\336r\024\016}x\215\354\377\376\232/\3754\254\325\227n\025\315"
+	.ascii	"t*5]\212\323$kz\244\253iQ5\275\251\351$`\323\304k\261\037\031"
+	.ascii	"\214\276"
+	.string	"j\257\021\342\016,\366\252\321b<\245a:%^<\263\035\232\2136\3339\3013\033\341\212\361\274z\\\260\031\315\245s\3002\023;3WM&\233\271V\266\347\327\bx\fe\260\344V\210\334#\223T\312\032\027\220\262\226.\317bI\2634B\272Z\325\362ZW\355\034\363\273\262\247\200Chc\334#\333\fN\227\265\244\026\025@t\256\332U\316\030.*j\b\315\241\rLr\277N\255WE\273\r\322\360.\033b R[\300\213\223C|KOYk\205\340kI\301\001h\357\364\007Q\250Q4\246\034\"\304\231\t$\222\231\031\247\003p\002\231\272\272\r\020hH6\035k\372\201P\002\207]\364A\311\\M\212TV\234\300\217\n(0\nF\267\210\265_\222\007\303\002\22784\320\240 \276\231c\220\240mZ<\201F\335cA\3420H\2773.\323\202\t#\326\003k\031\326\030\220P\037E\211\242l\201\220N"
+	.string	"\225\237"
+	.string	"\224.E\203KA\264D\b4\322\342\322,\357\327\214\304W\204\210/%\316d\360\025{Q\210\374t\221\224\330\234"
+	.string	"\317;\345qx\277p\003\302+\032\215\016\266y\326ku\206v"
+	.ascii	"\323<5b+P\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`[\001\365\007"
+	.string	"\244\nW\002"
+	.string	""
+	.string	""
+	.string	"\002\034\177)\257\377\372\006\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \t\177*\360\372\2508\272\200\202\n\177+\200\200\200\200\004\013\177,\f\177-\362\375\231\027\r\177.\016\177/\017\1770\020\1771\304\242\203\374"
+	.string	"\021\1772\022\1773\023\1774\024\1775\025\1776\026\1777\027\1778\030\1779\004"
+	.string	"\265\006\004"
+	.string	"u\004\001\221\205\327\307\003\001\225\001\004\003\225\001\003\004"
+	.string	"\342\001\004\004\303\376\236\020\005u\004\006\007\bu\004\b\324\247\332\303"
+	.string	"\b\325\007\004\tu\004\n\013\f\321\231\263\346\002\001\225\001\004\r\003\016\004\"\004\017\020"
+	.string	"% \300\"\252\253\016\210\260\214\340ct\304Y\302$\304a$\206aaCl\331!\234\\.\031\347\202\n\376\233\253\331\307\2270\344\357\013\243\307\277\261|#|c\342\033\177\3437\374\2151\204\343\033\242o\340\033\022\304\340\317J"
+	.ascii	"\r\361\371\216\223\231\2033\006"
+	.text
+	.section	.gnu.lto_.refs.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d98fc6a760285ac5,"e",@progbits
+	.string	"(\265/\375`\375\035\305|"
+	.ascii	"z\305D+P \220JJ\007^\202\002\320\003\214h6\210X\013\2330\307"
+	.ascii	"x<\270C\211\3655\346V\277\256\253Mu/>\032\251j\377W\245\272~"
+	.ascii	"\026\247D\347c/\236\200\002\240\324T\377\311*\255\210M\024\314"
+	.ascii	"p\355\226\026\361\330*\377\223y\315 \226\021\"e\n<\002\241\002"
+	.ascii	"\262\002gd\275\002q\t_s\222=\247\360\251\323)\247\360\375\356"
+	.ascii	"v^\220d\205\351"
+	.string	"\365;\330\026\3471\321\236\271\246;8b\316Q\237,,h\236\275r\2308&\266 ze.\354\226\007\265\004\306\r\214\312\0049\225d\304\031\214\216\224\313\031X\257\374\205\313t\320\302|\251k\363\205i\322{\323+w\3415\026S\301E\234\2750\333w\220\355\205\336\333\376\354\304\255\2712\353\365\004\227\360\255E\354Y\205\357g:\235NY\205O\006\2654\235\272-%2\264s\332\317\234\235\323\253W\336\302e9aX\306^Y\313\321\220\270\213\323t\363\2655JM\212[\257w\201}[\002\373\363\231\031\017\2213`\236V\316f?\005\027\374\314\357^\260{\257\t\236-!E\260^\177\367\235\235(\036\236Y\257?\227\375,\205\301\270\212\232dj^\263{\333 \225\r\210\021\\\275B\327*,]\332z\375\006\254\030\223\361\330\025\372a\021\251*\323\353[\260\347\366\001\274\335\013N\202}\263O\213\266\\\302\307r"
+	.string	"\276\242\025Z\007\374\352\004\021@A\372o\345g\0257;\317\257\036E]\347Wo\370/\346\347\007\242`\272j\374\227\376\314@\232\030\376\273\371\331\201\274;.\030~V\177N\261\362\f^\200\005\024?Cp\023O\361\263\002aO\340WU\370\271\347\347\t|H\374\252\t+\264H\3709\350\347\006"
+	.ascii	"8\033\b?CE\371\217\366\263\004O\313\361\237_\215\340\277_\365"
+	.ascii	"\340g\340s~\225\203\237w\374L\300\317-f`!\342\201~\025\203\237"
+	.ascii	"\241\374\354\344\347&?w\375\254\344g\256\237\217\374l\344\347"
+	.ascii	"\"?\023\371Y\353g\347\317Q?7\177\036\362\263\220\237\245~f\372"
+	.ascii	"y\351\347\037?\373\3709\371s\217\237\225~N\372\031\371\263\360"
+	.ascii	"\347\343\317\306\237\207~6\372\017\346\177\321\177\273\377w?"
+	.ascii	"\377\376\323\370\271\370\237\355\347\3733\020?\377\360\263\017"
+	.ascii	"?\367\3603\017?'\360\363\016?\353\3603\217\237s\370\031\207\237"
+	.ascii	"u\374|\364s\216\237)\370\371\206\237m\370\271\202\3770\376\033"
+	.ascii	"\361\037\200\351t:\375W\275_\355\341\037`G]\345\013\2033\362"
+	.ascii	"%\n\373\265I\247\375\276\234\232\226\024i\264u\b\373U\212\375"
+	.ascii	"\352\203\275\252\307^]sv\263\234g\327\230]\364\347\027G\n\\\020"
+	.ascii	"s\354U7\366j\032{\225\214\275:\004\373(\227\360Q\3516lM\342\302"
+	.ascii	"\305\310\025\225\016\363\275M\271e=\345\035\246d\313\030\255"
+	.ascii	"^\033\214\347\246[\300\254\365\252:\261W\217\375d\210 D\214v"
+	.ascii	"v\354Y\254\235\f\261\267$\314\020oNfn\364\253\275\322\232V^\355"
+	.ascii	"\325L\340\334\321\251\351\265E\202\275\221q\351u\250\243\232"
+	.ascii	"\312M\3727W'\351#\255\244\2214\221.\322FZ\253\227tWo\265\020"
+	.ascii	",\326\317\256z\013i\253\013\265\367\"\357\275\257\240\227\375"
+	.ascii	"\364\343('\355\036\235\354&\270\271,\254\266\367\fc*|\326#)9"
+	.ascii	"\245\257:\213\314\017)\026\"x\fG\247\200.\222\f\3163\354\n\237"
+	.ascii	"\3658N\245p\364:\351\205\322rG\t\016\215\364\215\327\360\033"
+	.ascii	"\235c\336\020T?qt\252\275N<G1RRn\030\354\3477\206c5&\216\311"
+	.ascii	"\273\222\275\221\222zro\373\n~\206\363l%v{\241\264\274H2\261"
+	.ascii	"\f\210T\341\"\306\315\275-\004B\020\370HM\371\362e\"\253\235"
+	.ascii	"O\242Q-\035\304\333\271\246\363%\207\367\246\327n\252_f|(\365"
+	.ascii	"\332X=\244G)\204\321\312\020e\303\2711\035\273\213\365]\256\261"
+	.ascii	"\250z\312\347\016\313\311V\007yO\261d\334\350\371\350\265\245"
+	.ascii	"\270\254\271\272\004\361je\026^];\261\347\275\247v\232\332[\342"
+	.ascii	"\306|;q\333\217\b\\\222\254^\351\232\032\b\005qOe\373x\003i%"
+	.ascii	"T\333\330V\257\375\243\227X\f\201fR\213c\027\254'\016\2248p\340"
+	.ascii	"\3303\002>\2362\002\314\306\002\225\261\177'5\222\315[\203\312"
+	.ascii	"\233\276\221m\354I\223B\262\245\3276v\027\373\3706\366\375!\333"
+	.ascii	"6\256\367\032\231Q\3700\243\310YSb$\363\255\347\226\375\035\307"
+	.ascii	"\371\265\305{&\316\336\216\232::d\353s\024\362,\242\305\236x"
+	.ascii	"\223\327\263\005\213I\0217\347\274\265\230\344\266\327+\267\371"
+	.ascii	"\241S>\251\360\234\274\2441{\345\273\2376J6qT,\263\371:\326\354"
+	.ascii	"Q\215Rnh\275\236\231j\322\220\020c2\251I\317iV\2451\\]ze4<U\310"
+	.ascii	"~L{\345#\370\314\232'4\3153v\277*.\274\266\272\263]_\335%d\257"
+	.ascii	"Lw\273\234#N\3055s+\025\257\251\255^\231\f\307\261X\n.s\226c"
+	.ascii	"3\3171\266\267m\256\275Sh\016\023\373\025\217\375\373\367]\343"
+	.ascii	"\362\336\353\224\323\336\345\361w\316\341\036VY\201\377\353U"
+	.ascii	"\377\027`\324\336\342\226/6\254\027\232Q\310\211\373G\357E:\213"
+	.ascii	"\0358\231Hg\220$\324y\213\310%\305\240\345u\026\223\320{\203"
+	.ascii	".\022Y\374\240y\203\222\320\313\274IoL\276\255\263x\221\315\033"
+	.ascii	"t\221\327x\"\211t2\223P#3(\tu2/\324y\201.\322\270\364\201\274"
+	.ascii	"\313\240\013u\246\271\320&\023(\tm2\223P'\025+I\306\3511\265"
+	.ascii	"|eU13\211\274@\224V\306%P4\3316\257\334\275l\246t\227\n\334k"
+	.ascii	"\325\\\312\031\203p\3321\n\344\230\305\330\344\002\224\307\254"
+	.ascii	"\346EF\223_\315{\277\2165\\\245\005\3056z\217p\264\250eu\231"
+	.ascii	"\224\3565@yo\221o\364\336[\274\367\352,\255\332{\253\200\222"
+	.ascii	"O\245\362\336)!\345\265*\252)\335\333fsi\314$4\2539\244V\006"
+	.ascii	"}\336\036m\221\237W\316\271d\241E\261\313t\357\3455\354\223\371"
+	.ascii	"\244\346\314L]V\tk\307D\331!\\oMz"
+	.string	"msG\244\256\327\340\263\270\244W(\325\226\021\037R\311\023\221n\301\200\234\231\365\332\356,\243qa\236\234\332\325\231\305\314\224\325\322Z\235\2736\210$\325T\273#5k\302\326\376\234\330\2511S\213|\246\302\355jM\275cZ\213\356\016o\252\206\347\210e3)\016\277\371\331\222\336\235\355u\022\253DZq\351\261\233\017\025\2272m\262\202d\261\t\362\246\233\246[Ky\254\346k\222\305\313\215\212\236\274\270\343\2236x?R\240\266\222\334\237\03558M\242z\3555\315\346}\327jn\337Y\320\274\327\330w?z\367\032\177\230Q0\243X\243du]\361\255_\263\244\241\232\322\224\022Dz4N\220\024\361\322+T(\347\311\263\212T\237i\273\037S\330\240\265\277\246&\256f\335\223\257\216\t\033\024\335\334U{\206\326+\224\304\r3s\353\025\213\224\026k\"C\"e\253\202\365\204\016y\222\031\271\"D\332\244\241"
+	.ascii	"\201S\322c\377\320\226V\273\002\247\224ji\032\342\322E<\035\177"
+	.ascii	"`\211r;.,\334\346\203\004\272\310\254\252g\331\325\227\266\322"
+	.ascii	"gKpV\322/\315\326J\265}\352X\311\352b\266,\334\246\212-Y+dT`"
+	.ascii	"\372\210\216\266\231\216\3532-\327a\332\255\311\264\2306\242"
+	.ascii	"\337\032\256\333z\f\213\365\027\036;Oi/\375\245\211`<\037"
+	.string	"d{\231<G&))!\b|\306\222([\005\326\257b\254\357\276\213X3\023\253\233[\231\224A\353\352.\001D#\241\nB\214\034\302\032f"
+	.string	"`CF"
+	.ascii	"B3zh\004!\005\211:\304\340\321\202\bF\302\341\n\277\341\323b"
+	.string	"\005q\b\324\261\002\307\216\030%~C8\f\032\005i`o\201\213\t\\\274\340\241\363\0270Z\300h\341\373\013\030CC0\\\f\261w1\244\016\2015\334X\207A!\016!\321(H$\344\301\301\027$:\312\261\006k\250\320\203dt$$\3528\322\261\301\006w\020\316`\211\354\360G\004\f\216P$\004\322\340A\374\341 \f\336\020\342\001\022\201\037\360\030\372\f\211+\220P\342\206\033@\033EE@\031\301\"\"\341\3575\230\370\221\216\340\220\005\361\350h\310\202\004\216\0351\210\200\301\241N\260\310\006\220\306\013@$h0\022\022\205@\030x\264 @08\f\201\007\215\" \361\210\006\261\306\013\035\"`\260\005\236\031AEGG1j\344\350@\324\221\003\204a\020\007\216\0351\210\302\034HF\300!\215\031H\302\003\2025\206G:x\202DG(\020\203H:\304\032.\206\2103\202F\302\023\212\206D\031\304 \022"
+	.string	"\304\032\024T@4\022\356`m\310\b\022\201-\020\355"
+	.string	"\306 \006\221zp\354\210\221\003k$\244!h\203\207\210T\2038<Z\341\367\241!\031'\\HA\004\366\306\212\"\240p\030Db\2014\f\342 \034\022\2610\022\002s\260\2701Db\261\342\200 Q8\204\201\310(\310^\005S\247\260\330\327\324\260\026\352\023\246L\234\\\036\313C\347k\276_\225\242F\231e\211j\323+\024(WLec[sN\234\260\031\231\246\247S\232#mB\b\2416!\363\343\371\223\276\305\241}]m\242SE\271\007\325\253\352u\273\237\263G\2338\275\252L\312\272\2728\232\267\332U\251\3211a\225(\3414\354\225{\252txp\242\250X..\316#3\"\307i\213\251\255\327\373\226X\326c\275F\262W"
+	.ascii	"(\3219<7<N\254DI\322J\255\304`\310\316V8\2475+E\212\264\2237"
+	.ascii	"\310\302\222\362\334\265\362\261\227L6\220\276\315{\237:eYSS"
+	.ascii	"H\366\262zU\265T\255v\202[z\372\314\260Q\321B\307:\235\355\304"
+	.ascii	"w\031\007\006\331\031U\021lGuTO\001\335c]\033\233\005\265\344"
+	.ascii	"\245\327\253+u\310\316\224\006_Y\244<ce\364\222T\254\253Cv\212"
+	.ascii	"\304)\231\240S\237R\205\260\367^\365^,\260g\016U\226\216\250"
+	.ascii	"UW\205,\245\332+\275\252T\\\366\303be\372\326m~\234\300Y\212"
+	.ascii	"{\302.U\251\245\032\345\273\227\333f\323\362N-U\\\005\2426]e"
+	.ascii	"\212\251L5\212-\336[lo\023c\221\316\341\271\271SS*p`\021C\246"
+	.ascii	"B]\215:\323\263\225"
+	.string	"G\304U\257\352\023O\323]\234W\257\252S\237\231\276\t\202\216\250\202\341<\007\363\234!D$\"\"I\222\2441B\013\020\004cq\332j\331\001\022 \024A\220:\350\314\320\210HIAAR)\rcqY\303\3461\226\301\307\362\366\250\037\227\200\013i\253\035\242\370\240QA\013,\033\024\030\343\001[c\252P\347\020\001f\305\315T\352G\275\225N\345B\250\235\331N\005\350\234\035#\017\303\225\203\255M\3414\314i\226;E\323,> \300\203\206f\023@\322\266\340=\031\323\366nR\217\357wt'\273c\262~WV#o\032D]\357\2516\217\013\235\231a\331\373\346\310\373\215G\234\220NS\322C\365\\\013\035\177\247\206\232`}\205\375\357O\310\251\217'/\245\230\210\347\260y\312\247@<2\303A\202\213_7\006\377\367\324\273w(=\347\303\027\002\351\367\3603PEy\331\251\315\177\023\203\253Z\202\214\005"
+	.string	"\267d\300\374;\245\371PU\367\303\273w\324\345\327R\"$\236\r\020\304\002*\353q\024\333\262\221Y\245,\227U\006\346N\217@\345U\364\230Ljr|F\177\237\345\226 1l)Y9\253=JLA2\352\241#\312\272\202\232\221r\002\312\030\022\364w/\351\377_"
+	.ascii	"\220\310\343!\246<\233\003'fV\277\316\264\253\\\3323#\371\253"
+	.ascii	"8\031wX\350\372o\265\004\311\232K"
+	.string	"\352\263\034\240\331='hK\020!Z\203\262\001\204\344\"\336\311\352\220\3031\020\261x@\370e\017t\243V\357\331A[\372$\215\371\242Iy\367Cq\013*\033\b0:\323\351bv09\333+\327\205\313\"\377\317\016\257\261jV\266\365+\305\231W\341\3412\030+\255\n\344\315\353\005\271\251?\345@\236/x@7\342\263\227g\304\260\320\234;g\007\236\233\226\372\251\215\0368\26326\202l\304:\241\020g\024\251\240[\236\017U\376q#\252\211e\256\006\255\262\335\b\0258e\311\003\017\021\354\307(\2000N\306\0046S\350O\300H2\257\343L7\314\234s\200\031;\246\b\266\tl\340\330@;7\330Z\315\"\333\221(\020\304\n\262\303c4\200n3\264M\031\217\f\034+{\031\002\037\232\023\306J\216\333\217\367\205#\243\3657\266L\341\250\f\223\357\337\261\024\222\211Q\344\022\r\347\257\007A\366\006\201\207\340"
+	.string	"\211\024\267\2217\242\002\311\350\nA\230\301a\2430*\203\373\327M\030\312\b;G\226ONW\273\346\265+:T\021\345\034c\033\353\314\363\315&\271\201p\324\031\374\237$\203\204Gy\n\n\002\301\264l\341\r\257\233\030\235\270\244\201\223"
+	.ascii	"\271\031\277v\033_\207\261\343\177\236!\201Ymd\234`'\242\206"
+	.ascii	"W\360\t\316\272\3400\251$\221\205\004\177\207\240\035e\356\007"
+	.ascii	"\366vuS\225\320\265\277\277B\306\f\007\\\336\277\202d\260\232"
+	.ascii	"\215\\\213@\306\372W\373M6\206\\cl\034$\226\344RG\205d\325D\310"
+	.ascii	"#\263Y\310\350\230N(i\340/Uu\324\333\343\243/.x\271-@n\024t\344"
+	.ascii	"\331\206\036\375R\304\2665\2139:F62\224\305\177\302\356\311V"
+	.ascii	"-A\030}\245\304\201\307\275\201\323\005\bB\302\206\370\2036t"
+	.ascii	"\303\"!\367\2231\177\335NjH3,G\3619FzU\2072On\213h-\032G}\377"
+	.ascii	"\024C.\200\\\023\231\r\216\371z!\343\301\272(\317)\315\265\251"
+	.ascii	"\260\276\2075g\304L\240\367_\356Z\017\017E\004\202?\24208\257"
+	.ascii	"v|r\364Do\b\020V\222SCR\242\245]\002o\366\362\364\251\225\237"
+	.ascii	"\210\314\2265\003Fi\223D\213\330\224\357\002x!\302Ofi\037\"%"
+	.ascii	"\357C\026\037$\240\027\013\371\264\233w\2261\346\333 b\316\306"
+	.ascii	"2\37030K\"\300\325C\376z|\371\021\244XM\030N\365\373`\313\004"
+	.ascii	"T\257f\334\252\035\225\262\177\225\347\207\356\023\212}\250\247"
+	.ascii	"\360\350\003X\037o\313\243\204\347\025\267\357LF\203\371\223"
+	.ascii	"m\246\302t\021A\374\"\217l\t\177\222\372\347\364\210h\330\316"
+	.ascii	"\274\373w\325\266oG\366r\377\022A)\311\030\310#wO:]\264j\204"
+	.ascii	"\205\237\246s\340\227\303\200\340\305\220[\375c\272\377\252\226"
+	.ascii	"\260\027\273\356g\350F\306\217l_\324_\201SFGyQp\032xD\375\t\344"
+	.ascii	"\314\372fC\2765r\355\2335w\362\207\017\257_\346 7\367\341;(W"
+	.ascii	"j\233\267\326\364\273\230\353(\037\212\377\315\366\241\275\343"
+	.ascii	"q\232\373\246\347\326tn\222[\241\237f\364o\377x!\315\224\007"
+	.ascii	"j\342Z{S|%t\365;\300<\273\233v\247\235_\340\270\364),\325"
+	.ascii	"o+"
+	.text
+	.section	.gnu.lto_.symtab.d98fc6a760285ac5,"e",@progbits
+	.string	"serialPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"serialReadBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d98fc6a760285ac5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
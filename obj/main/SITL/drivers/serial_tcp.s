@@ -0,0 +1,1030 @@
+	.file	"serial_tcp.c"
+	.section	.gnu.lto_.profile.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`(\001-\t"
+	.string	"b\f/3`O\322\030\020\230\212\331\\\357H\265\355\202B\331{\025\230\313ho\273\312\363\3437\035j\030\206a\030\206\341j\2720&\215\020B\310\336d\357\275\267L{\007m\257[[U\035\301^.k\222\031\203\305\225\231r\350t\\T\321J\202G\207\232\366L\365\336\336\251iM$ Y\210\221\236\034\227\212\207\350\001\300\b\017EC\225\226\216\216\352@"
+	.string	"H\n}\024\023\3008\2409\021&2\230\271\327#\375\224\210`H7\335\r\305g\262\361\361\211\356m`\213\202'\203S\204%C\345Q\003\b\024\211\225\3138!44\207o\334u\240\221\311\345{|\207\357o\177w\333:\204Sp\322\254\266&. `\0022\252n\003a\241aZ\026P"
+	.string	"t\002\006`\257o\024A\036y\305-\250\200\200\312\372\264d\331\331\200\205\211\235\363\nFl\303\002'!\215#\022\233"
+	.ascii	"\001b\234\202\366\335\301\342\352\236\304\304\030\300\332\247"
+	.ascii	"\324\002\013y\023\240\240\352\006X\002\311\001\312sb\341\252"
+	.ascii	"]!\260}N\277\036\026\234\267\352\004(\256\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\355\004"
+	.string	"b\006\023\033\240'\351\377\377\377\017vUUU\334\327\bm\366\377\357\355\377\326\333\222F\266L)\356.\035\326\220\250q\374\3620[\366\005Gg@\n\016(I\221"
+	.ascii	"\032a$S\354Z(K\214>;\263Qd\177\r\271\355\247\352*\207\330K\360"
+	.ascii	"F$ \240\202\261\231\353\230B|\303R\026n\324@\252\004N\006\226"
+	.ascii	"A3\307u\b\366\026\355\263,\303\265\226\231L\r\004\370\261e\245"
+	.ascii	"i\237\221\013\030]X1\370\275\202\214\342\013\0063\212\242p\244"
+	.ascii	"\261\331\210\2531\314\352Z\330\214\345\201\314\2129\004"
+	.text
+	.section	.gnu.lto_.inline.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`6\004%\022"
+	.string	"\006\230SB"
+	.string	"\221&\3518\025~\334\370\360\367\3219\256\3561.\246=\203)\202\331\031\033\231G\205C\212\343\200\341\r@):\365\377o\001\352\205@\277\253V"
+	.string	"C\363g\036\230\376q6\032Y\277!4\335\032!r\247:"
+	.string	"@"
+	.string	"F"
+	.ascii	"$\314EG\214\026\007\334\357\212\235\"v4)\207\0228R\254\342\202"
+	.ascii	"J?\250T\375!\326\373]\006x\257\326\314L\353E\265\221\231\237"
+	.ascii	"w\0027\200\3428\216\234\213\314\364\374\346\312@\231\031\262"
+	.ascii	"G\226\335\353\232\220\231\025\376\272\233{\304\245\333\215\243"
+	.ascii	"\256d&\310\326\241^@\245N\330\213\234\351\224r\202\300\b\225"
+	.ascii	"\027(\b\256\260\330\313\264\277\306\341\3737\225\326\324\n\020"
+	.ascii	"26\316D"
+	.string	"\215\227c\013v\032\341\222R\300=P\201\325)\204\034\032\\H%c\177\203\366Qskv\230NT8\246\023\017\002\334\215S\n\252\300\231\314\366\021\031\344z\355\261|\300\034r(\034\324Bfr\276>>T\226\314\304H`\002\177\341\2503^Z:h\336\304\255\220\210\241\021\240}\320\02000\260 \231\243\371P\366\211\311\314\221E\236\326-3+\364\240\210\315\215\013,O%\334Q\3446\220P\266\353lP\351\375DE\2452|\030p\266\366\002p\250q\305!\222\251 \205Ia\2265`\002!#f\346\001\022 \225=B)\222fdF\224\226[\030\346,\f.J\005<\204\3672\220d\220fS\210\336\220\302\215\231x\253\007j}Kk\362\"\251\245\b\033\007s6$\237!\342\244b<\272\372\214^P\266[[(\271\307\376\002\003<vy1\321h]a\rr\273\016l\rPz\037OY[\261\354\""
+	.string	"\353'\346\376A\366#"
+	.string	"\242Q\235\373\270\247\265\024\025"
+	.string	"\252>(k"
+	.string	"\362`\262\024N\327\335\001\306Z\316+\237\313\364%\223Q\222\263\244\320\274x\330\360\307I\200\216<\301C\367:M\006\217\b\250@"
+	.ascii	"\356\035h\0178\377+\217y\342u\022\373!\023a\373ti\t\336\023\025"
+	.ascii	"\347\316\310\273\007\315Z67\b\337\222\322\016\f\354T\247?\246"
+	.ascii	"\200b&\013\230\367\254\237S\347T&}\204\234\353\002]<"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`t\006\335\023"
+	.string	"fYZB0\217\222\016\300"
+	.string	"C!#\271\030Q\322\256u8\345\"\"\222\252l#b\363=LM\357\207\354\b\260\304\316%\212gT\027\341\341I\347\227P:B\f\325w;X0\r>\371\303|\243Mv#[\246\024@"
+	.string	"G"
+	.string	"G"
+	.string	"\277H\210\373\005,\221l\027\035\201J\0229\b\033]\327u\177\212\037\346%\2213\0205\272Ow\343W\365\353\272\373u\337\233\300\337\004\352)D\356\325\263W\245\221/\215n\313\253\337o\r\303\260\341K\020\306TOI\330.\036c\2635Fl\233\b\005\0225M\313\342_\361\005\231L\314,\212\310\375\245z-~\337\304\246-\f\324\023\243(\331\353U\021\271\224\352A\233s\225V\332\177c@h\210>U)'\321\266\225\320o\t,-\212cQ3B\210RA\231`!CJ\205\221\225\016kt9$\374\177\034\372@\327\203\200W\322\247\177\377"
+	.string	"\357E\016t\033\350V\272\005t\031\350jtC\272C\001v"
+	.string	"\357\377"
+	.ascii	"x\310\214x=\240\373\376\311\373\226\02659\23163\r\003\261\\Y"
+	.ascii	"\246\261\314\016\327\t\310\005\222\223\225\016\313\215u}\300"
+	.ascii	"<\035\314\203\325\271>\236\316\344\200\201\250|L\221\t\3022l"
+	.ascii	"\212.Ph\303\304\200\362a\211\300r\263\261.\017\326i\231\363\243"
+	.ascii	"\265\314\0205A\037\315eZ\031\246!w\250AI\244\324\214\210$)H\262"
+	.ascii	"\214\001\200\002\221\252\232\362\022\340\321A\212\303(\222\001"
+	.ascii	"\231a\246Fd\244\260\254\222\224\036Z\223\024k\365\205\357|J\337"
+	.ascii	"\025\356fdeK\215\036\n\"XaC\220\371\"\357\013\021B\301z4\244"
+	.ascii	"m\256\0206_\020-\270G7k)B&\255\326\3544~R\252\200*\252\205\302"
+	.ascii	"\223\220\263\216\216\254\nM\004\251{\035\202\202@\311F\327~t"
+	.ascii	"\243_\277\\\212\202\377\r\0359\347P\266\002\337\322O\231\355"
+	.ascii	"\314\002\312\256\005C\206\235\350\n\271\307\007\273\375uE\367"
+	.ascii	")N\331C\304\357y1p/\357\377\246\331\241\312!XHY\351O\231$\373"
+	.ascii	"\002\020\371\026 \feu\340}\324\373d\013\t\270W\b@\324\270'\313"
+	.ascii	"W\230\201\200Y\005\222a\037\301\362\355\201\001(G\035\230\362"
+	.ascii	"q=!\303\241\345\245?\022\263\022\032y\302\264\006\035+\206\367"
+	.ascii	"\304\215\266r\031{Mw;\251m\353\3355m\250\303\003\324\344+'Q\r"
+	.ascii	"\025\007{"
+	.text
+	.section	.gnu.lto_.pureconst.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\232\005\002\232\005\005\232\005\006\231\004\007\231\004\b\231"
+	.ascii	"\004\t\231\004\n\232\004\013\232\004\f\204\004\r\232\004\020"
+	.ascii	"\231\004\021\232\004\022\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`\214\001\005\t"
+	.ascii	"\202\215%'\220'I\007\377\217\220\363\337\005\275M\220\231\231"
+	.ascii	"\231\235 \324\2545\370/\326\f\264\326\206\266\302FD\250Yb\333"
+	.ascii	"\2262\005\247gr`6\203\364\274\343\265\340_KB'B\247\242\363\240"
+	.ascii	"S\351\\t.4\2612\360\203R\023H\337Y\024\360\023`\255\344\216\321"
+	.ascii	":\353\2132\361w1\2753\250\261\031e\372\371p\025\0019\321\313"
+	.ascii	"\302\007\203\243I\302\007\262zj\263\001r\312UgS\336\224+\024"
+	.ascii	"\371\371t:\235\216\332\252|6\312\033\235\252k\316\025\345\214"
+	.ascii	"\332\317p\202\013\005= \200\002\231*\273\0039\305\237\034xFa"
+	.ascii	"\223H\366\274d\307\332y\266\376l<-:\326\272\322$\230\2429<\310"
+	.ascii	"\200\235\3426\227\034\003#\300\204\201N\354\032\355\033\002\360"
+	.ascii	"\002\256%\212\2133\2638;rdo\344Vb\350\030\352 \021\200 B\016"
+	.ascii	"#lE\341\"5\"1\214\020C\350\212\f,.\257\206\262\336&J\r(\247}"
+	.ascii	"\314\330\340!p\022\353\032\374\206\330\227$Um\220\330\264\375"
+	.ascii	"\301\2704\016/O]V\224!"
+	.text
+	.section	.gnu.lto_.lto.2a3eceff3bdf6009,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tcpVTable.17.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375 \333\205\005"
+	.string	"D\t\241"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\006\177\001}{ywu\212\001\202\200\200\374\342\303\315\204\013sqo\274\236\344\244/mk\270\314\344\007ig\370\307\224\tie\270\307\204\007ca"
+	.string	"?\202\210\200\350\001_]\306\001[\305\001Y\304\001W\303\001U\302\001S\301\001Q\300\001O\277\001M\276\001K\275\001I\274\001G\274\001E\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/serial_tcp.c"
+	.string	"\f"
+	.ascii	"\200\224\230\244\310$\006\352\312\031\017\202\201\023\320\016"
+	.ascii	"\b\003'R\254\036@\021"
+	.text
+	.section	.gnu.lto_tcpIsStart.21.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375 \350m\006"
+	.string	"\"\314,2`m\322\030@\214\304(NR\310\214aM\300J\262\233\207\235\376\001\230\326\254u\252\263{\r\276\227$\325\020\004D\222\341U=\"$\245V+\261R\312\024ORf\322$,`*G]\355r\224C\345\024ZC\205ah\223\273\232t\331\312P\256i,\3135K\266\250\240\324\213G!\0369\260\343\215\031?l\0221\214\306\r"
+	.string	"F\251\002\026\236\f}\326I\275x\254\254\202\376<5K\220\344d\227\"\224\262#Q\210\306\317y\313\006\007\234\337@\204\232\210Hx\240\354fM1\360a\276\0217\220\340\003\004\373t0\003\020v\367\304>\025\270\342_\360K\377D\b"
+	.ascii	"2\003\316:#f\b\3055q.\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_onData.22.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\355\n"
+	.string	"\026\325KA0\307(\035\020\335\036\225\374\334y\275\301\246\250uSk\025\277\327Z\344\024\252\350\272P\301\032lt\267}\354\304\024}\250M\030\273\246-3\303C\227\346\020\221\226_^{\222\205\034P\331\354&{\247\0247"
+	.string	"9"
+	.string	";"
+	.string	"\260\335Ja\272}\272\236!\363\271}!\363\351\320n\360\272Z\f\005%\002\036\354.\225+\017\037C\377\256'\240R\245G\rgw\035Q)\224[\336\366\203m\013\373\032\001\365\236o\375\232\026\035e\36453v\340,\003\273'\263\b+\233\004Z^\177;\364]\346l\327\021\316\311$\003\266\300\301n\235\370t\305\366h\037\3461\341[\244+\354\252^\001$\262d\333\373Kd\213\262!\001\310\007\270@D\020q9Y/\006\037\300\f\266\335\275\360\001\214B V,\237>)\3639\245\204\013\204\226)\316\354Z\212R\305\276\266\273k\251\262\037\340\273\333\263\tyD\033\036\235\317\327\201\024\374\272\321\347\343\240\037\237\016\210z>\220n\034\354\205\272\217\212<\357\243\\\335k+U\2361\231I\236\314\305\313(\247\264;@\361(s)\001\020"
+	.ascii	"3\241\t\037c`\013\257\204}\217\312\004\251l\240\334\243\210\326"
+	.ascii	"t\202\251\t\"]\263'&HD\221\315S\247\3075\274\020&\031"
+	.text
+	.section	.gnu.lto_onClose.23.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`n\002\375\022"
+	.string	"6\243{H\340\320(\035\333)9\222M\256\f\306\017\253\203nM\377\275p\354\327\001Y#.\207\346\230\230\226R\032\347\306\327\036\250\026\265\356?`~\327\023n\3267\342\021\342\r\343y\360|\260\210\2342\263\200\230\267f\244\355\275\245L2d"
+	.string	"\\"
+	.string	"j"
+	.ascii	"\372\241\252a\214I\214\303\203\237\034B\335\341\201KM\340}U_"
+	.ascii	"\273\355\365\233\314\001t\343\250\370\351\016\021\350\347]jx"
+	.ascii	"\001\363\322{\310\274\324\227j\320C\235.\t\262I1\324\335\037"
+	.ascii	"\207\370\353\221\367\245\037\231\220d3\330#\210\263iF\023E\272"
+	.ascii	"\373<\337\016\263\330"
+	.string	"\356\310\244\273ue\263\017Wyu\240\272@\001\362<k&\324\345(\024\207\327\335\013\364\270\324\352\244\263s\251\227\231\227&^\\\215f\273\315\354N5\204-\347\250>vw+\343\250>\274\232~\373Ax\2654Z%\305U/\256\216\346\352\214\253R\256\306\270\312\274\272\274\372\220/G\244{\317\216n\017\273\036\235\223/F<\374U\177\236]s\331\211W\243\300\200*\n\205\275Lc\3370L\3650\016\244A\277\243\025R\366\262\224yIb\322\315\310G\354\365L\036\361mT\356be\362\352\"K^\\\r\237\242\031\226\267pE\346\034M\304\215Y\332b6|\212\256\232\252\250\263P\025\250\r\351\226W\360e:x\267;8\317\313K\243\206\026\263p\037\260\247\345\202\0273\037ZJ\235FR'\221\022\327i\202\004\006(*'\020\032\244\004h]uE\221\274\240`V0\260\200,U\353k\261T\033@V\352\313"
+	.string	"\262\270|(V\353#\021\321\325\213\212\365\301\254V\254\357#\354\307f\034\375rDB3\034\213\234\343\2323\\ $\267\022\272\355n\030+8K\334\202\273A\263<d\200%&`#\272\rXf\311\036\377\304cD8\t\332N\007. `\002\021aU\036\223\320\345\214\361,\230u;2\032\353\277\320\220\275\364e|\335\222\2754\262PQ\005\274\213\227\237l\244n\271\017\213"
+	.ascii	"\366\274L \321\n.\331\223y\"\266\244\2617\366\303\t]\307HR\022"
+	.ascii	"h`UFx\243!\035uq3\233I\253\034o\023\320h\001o\326D\215k\020\024"
+	.ascii	"\362\350\351Y\3131,\270\334S7?L8"
+	.text
+	.section	.gnu.lto_onAccept.24.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`\251\004-\034"
+	.string	"v\361\257H\240\230Q:\300;\312\020\227\230\317\370\300]\346C\242 \345<\210\301\376\004\345\365jm\005|\004\311!\360\377\316\203yf\277/\006\373e\023\361\220tz\300\203.\255\322Wu,\370M\236\257\261\"\177\260\377\023B6\2212\311\224"
+	.string	"\213"
+	.string	"\245"
+	.string	"#/7\357\r\214B\264\324l\335J\261\326\030E6\325\212N\371q\342\277\373\037Y\330\356\022Y\274*\311p\001\221^h\325JLp\272\f\314\363\356\213<\352\374\260\305wjub\"\245V\242\202\255\231\247K|\017yj\036"
+	.ascii	"y\272\347.\231\023\237\352\203\342\222\2224\265\326Z\357\370"
+	.ascii	"y:6\237\373W\320wZ\343c\007\251\220\3000\t\326x\217@\302,4b\301"
+	.ascii	"\244\261\207K\2161?r\206\021Db.%\324Z\227\201\301\031_\362\273"
+	.ascii	"\313awI\354\216W\001|\340\020yJ\266\313\006\355c\323)!\022\027"
+	.ascii	"\267{\354/\021}\211\255\273\213\b{\f\337\334,\345\205\252\315"
+	.ascii	"\355TFSA8\223\005y\372n \223\323\226x\222\3152k\255\016\366R"
+	.ascii	"\035N\314\236j\255\207:\335\267 O}\372\211\351\2060j\370\343"
+	.ascii	"\342.\321\307\255c\367cm\247\335\023\277>\037\376=%/\217\311"
+	.ascii	"\273S\362\352\230\2749%o\254\344\305!yoF^\330\310\373\242\274"
+	.ascii	"\256\222\327l\336\222\344%G^:\362\216\224\267\003Q\247\021\236"
+	.ascii	"\032b\345\242}\213\323\273\023\376e\367,\240\231\037\027\257"
+	.ascii	"v8M}O\210\fi\247\035\326\205B\005S)\350\347\364f\2546\266\334"
+	.ascii	"\274\032\346\352\227\026\233\253\205\230\256~H,F\037\232\250"
+	.ascii	"\200f\270\352\f\027\034#\0016{\327\302\205\244\305p+\273\033"
+	.ascii	",\037,\263;8\245\346>\200B\253\276\021Y\366\b)1I\274\206\212"
+	.ascii	"Q\331\003\230\200\b\243\276\201\334\325\360\252\rMq(I\263\345"
+	.ascii	"\303\334\264\217\344Q<\034\210\020\252V\245\003"
+	.string	"A\230J\r~vC\210\340\003W\266\324\276\3357\271\223\336\036j\205\206\002\373*\232\321\212f\262\007B *d\020\021`_E3\031-\305\254C\320\004\017\262\234N\226\323\341\216l\267\\Ng\223\255\270e(\320\373\355k[\200\302v4d\202\b\307\273\365j=\336M\005\216WT\313\341\210N\324l\274^m\201lu(n\274\332\221N\307\253\301\210\365\022~\215D\201x\207\007\345A\303\263\025a\247\037\245\t\210s\372H\316\036\347\017\263\326\337\201\345\267\n\251\023\344\024\262Tf\307\002t\332\225\265Y\020\260r\372P\256\314x\253\256\265\261\244Z\177\bbCN\".\332\027f\307X\002b}(M\303\003L\373\031X\250A$'\231S\252FD\224\024$M:\220\002\221\261\252\036\021 \261R\016\252\2312\233\003V\231\025\343\221\361\227\310\224\237\366]\177t\353s\\A\r5Ha\301A\360C|\215\017"
+	.string	"\253^\326\346\204V\"\230\303\276 p/\234\313\033\320,6\013\213\006\272\370\305\317&\360\027y\216\201o\210\207\330f\334\243\245:\352\023+\240\300\257\352\351nt\027(q\203\315\"&\002\233\206\037r\212\256\333\b*'\302\211\263\230\225M\005<\363\260%~\215\206\033;y)1\233\244\220\263/\300)\236b\257\237\322"
+	.ascii	"s]\376\037\220\300\245\231\251\250 \"\347[\302-\2558rdD\237G"
+	.ascii	"\367\005\365lG\321C\321\261\324"
+	.text
+	.section	.gnu.lto_tcpReconfigure.25.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`\254\007\375)"
+	.string	"ZJh\020C`\346M:\201h\016;\373c{\335\022\207.]q\221\237m\212\3257(\033\215\204\205(Fc\234\271B\004)\211\314\206\220\201\2579\236.~\317\002\372s\275o\036~>\004\202\202\334\335\2324B\310\2262\005\346"
+	.string	"\340"
+	.ascii	"\003\001\375\337\331O\315\276\257\373(\332?\273o\236}k\366\333"
+	.ascii	"\366Y\202\206+\206\364\234\342\356\005\262\247\350\322\235rV"
+	.ascii	"\376\353\370\203\377\273\177f\3431:\230\314\347\376\273\267I"
+	.ascii	"\0375\367\336\251?H\371TMNB\233\327VF\272\367\311\0345\367\262"
+	.ascii	"M}\230\362\371\377\234\306j:\2762\261\235\005\001\332\235y\225"
+	.ascii	"1t/\333\360l\254\204\362\231r\022\312\247\205\302+\033\t\203"
+	.ascii	"\300_\352CO\323\366z\346b\2431\026\002\305\3068X\027\226\304"
+	.ascii	"T\263\204!i \327\261\263\373\035\211\312\022f\244S\237\325\233"
+	.ascii	"\343\344\016N\254\b\243\246\204\27421\\\027Ff\006\201\324\215"
+	.ascii	"I\366\311]el\236\\m\220wpbclM\005K9cGb<L%;N\372p\033\367\227"
+	.ascii	"\030\262\333\267\341\336\373V\212\005\341\037\361\377"
+	.string	"8\377\337~t/\226\353\302\0346/\2505\373\0026\235\372\034\002\265\366\0271\242YiZ9-!\236\362/\301kNPP\263\252\2410pv\357e\264\325B8\262\247$\322k\b\331arZ3\266cu\334\332\314\244n\313n\234F\005\323-\321\356M\262rE\232\224 \305\202\252Yy\225\207\345\372\031\216\321\3308\243\275\212HD\371lk\305\346\016\221q\025\345\222\316~\013e\333\242m\317\216F\264\256\361\333Vz\357\265p.\303f^\234\321\370|1F\263\222\317s\f\224O\266i?\316\226a\344\272z\357g\343jk\366\263y\357\275\267O~^c\216b2\314\352\373Pf\377\351\327w\372\365\233~}&\263\277\364\353\017\370\365\225~}\001\335OJ\373\001\272\217\224\366\001\244\375#_\337\310\354\013\273\037D\373\300\016\026\311B(\003\224\\\"{\357\025:\312\262\333*d\035\222\336\333\305\312\346\317\241"
+	.ascii	"\212\254F\274,\327\027\031\033o\t\017\200e?p\326 4\003.[\225"
+	.ascii	"\364\033\027\272#&\234\310\350\247A\377\253\331\n\245Yyds\244"
+	.ascii	"\205\035\312C\032\243p!\243]\323\307\213\221\375\327)Lh\245\302"
+	.ascii	"\312@\2525\262\024\222\354y-Z\261\240\377j\205\003\255X\030\200"
+	.ascii	"y9\303\377\252\205\363\266\254\002\260-|\370\317\326\022\236"
+	.ascii	"\237\f`hK\265A\314[\350Y\017\357\331Z\271\254]\326.(\237\005"
+	.ascii	"\300\316\226j\203\362\314\231\325\001\203wF)>\205w\2040\202\300"
+	.ascii	"7\016\310$J\376~\314\206\323_\235\365\013\323I\255\025\243\203"
+	.ascii	"\274\203+B\266DOz>K\322\326|\007\032\225\263\206Y\305\244\311"
+	.ascii	"\022R?\207\016I8>\373#c7Y\237K\317g\203\362\211Za\033\0364G\b"
+	.ascii	"\364\357\341\003\312\312\323\332;]z\034\312C\006\007FE\0358P"
+	.ascii	"\013\201\t\022\034N\250G\243\013U\013\201j5\243\330\242\211\304"
+	.ascii	"\323\201V\b\324)\325\212xU\244r\241\336 fi\311"
+	.string	"PS\230x:0\312\212\210\243xEU\314*\316(\252[VT\304\343\025\225\212UT\263\216F\032\005\254\212\215\305\257j@\243*\213\305\025U\361H\304\032b\035\2115\212G\253\341\214\"\225\214a\325\021k\330@\275\221\006\3618\3142\032\217\303 \333e\363\332'\367\331\201y\213\363q\034s\033\203@\242y\305\231Q\026\312~\375\207\262\337\320e\221FM\326I\310\312\205L\223l&\305\347S\330\223\017f\262N\335\203\231l\023\223\235\2407H\250\344\326`+\017\2574\311_R|.y\365\327\222\375\221\r\260\234\\\"\023\240\002\254\222\231%R\200\215`\007\020\362\356m\321\005I\221\323\013&\331\026mz04\020\311\236\327/4\300\217\025H\2632\311\366\016\243\020\017*\200\375Mq\251\001\200\211\250!<\003%ddF&\210\202$),t\240\"!\262\232\007\0210-c\020Y\230 \005I2\254\001X"
+	.string	"M\311\307\244\361]I[C\322$.\351IZm\201/\300\274\243'k\205\215\340x\310\245\244\021\030\033\3670\207X\314\306\032>\024O\350\211\n\261\020\002\331aj\3079"
+	.string	"\203]\205J=\032\327\241\235\202|\261?\210\213\277\254L\372\300\317\213\007\330\013\372?"
+	.string	"\247\316\272\rs\216m:\363\304[M\242\254\212\274\003P3\311X\2600\340A\177:L\2764\310\005"
+	.string	"j9\326\023%\265\305\001i\265\250f\321\354\210Y\265.R9\022\f\224\375^\211\363\243\344(\301*\365=\260w\373\360H\237\336\200\033\316/\355\276\332a\021\177\243\217\373\325i"
+	.ascii	"\352)\347BYR\360\235\242\352\277\322\034Zh\342\236^\203\237n"
+	.ascii	"'\037\025\2215v\332\345N\t\213\352\362\013\255\355\272|)\374"
+	.ascii	"'\257\361S[\345\321`A\202\325\274CI\226Y\324A\200|\301\237g9"
+	.ascii	"dW\200\021\240\354L\236\002\243\bY\177"
+	.text
+	.section	.gnu.lto_serTcpOpen.26.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`\226\005%\035"
+	.string	"\226r\266G\220\234Qc$\342\r\225\274\347~\352\255;\006<\356?\346\310\177\316X\241\224\353\313x\262\253\006p\035\202\264\027\227O\226V\326UuL\254x\323\263\325\253r\277o!\031'\177\363\334\377\r\3328oA\310\336[\312\224\002\235"
+	.string	"\226"
+	.string	"\251"
+	.string	"W\270\243\352\203\371\344\256\231\200+t\302a\301\326\037_|\300\275K_V\367\032!XB\354\247k\265\257\344K\210n4\226q\356URbu\357\205`Z\354'\217i\333?r$D\376\315\214\305$\230V\327Q\023\345\275F\232\2157\200\376\214\235"
+	.ascii	"\372\323\362\370\357\350i\332\372\363\213\216\036\261\202\247"
+	.ascii	"-\263\324\342\222\032\022o\232\025\254\034\263t\206F\346\311"
+	.ascii	"\224$G\316PX\255I\240\206\230-\235\241\320|\020fh\343T\257H\303"
+	.ascii	"`\255\260\013\367^\327t\230t\303n;\310\266\315>\221\004V\207"
+	.ascii	"r\363}\374t\n\\}\372\323\307\241?\253\225\240cKJ\254[]d@\261"
+	.ascii	"\037Bo\177\234\262\b+\033\303\354\355\251\316`\350&\310\025\365"
+	.ascii	"\006X\227\266\261\250Z&\373\346\265K\366\245\376\235C\375\t\356"
+	.ascii	"\344\237\375\351?\360\343_\340S\267\354\306\037\346\352SVm\312"
+	.ascii	"\252m\254\272\342T\177A\017\020e\031\005j\356\235\261ls\271\234"
+	.ascii	"W?>\365\333D>\225slO\345~a\320\300I\203c\310\334kt\360\323?1"
+	.ascii	"\230\024\013&\035&P'\274\236\023\312g\n\bO\363[\202\246\2429"
+	.ascii	"\023\264S\304p3\031v\222V\327"
+	.string	"#*%v\335\336p2cdJ\016\017\003\006\246\024e\244\303\277$=|\313\213\322\353\\n\203\270\226/\313b\245f|\250\035\342[|\f\222Z\024$\003$A\031\361:\026\037\004\305{a<\365\255\374\212\b\223\204\017\372\324\247\347U|t\212v\211S9\021\273\367N\230\242\302f\213\367\336\363\370\344\304%E\004\326e}\202$\304x\236\210\327\024\023\3639Tfg3\276\234\276\f\2500[\255\215\242V\237\312,\217\221-\262\037%\007\340\251m\335\257l\r\222\367^\n\001\274\363V\344p=]\016v\003\312\r\231\267^m\004\220\257\366\023\253\365j\032t\202l\265\037!\241Z\006\027;\031\020\256\332\026Ag\353\241\020\252\341v7\036\215\267\273\265\300\355\200h+p\265!\232m\307\243E\340qNw\333\321z\271\334\216\226c\2747\257]2\272\343\353\by\3128h-\243\220\246\377CO\213d\373\264\276"
+	.string	"\264At\347GEb\221^IiJ\020\244\306\360\035e!\327\314\204T#\236\360TB6\035\030R\201\356\252E\307\25257\n\024\371\362\305\033`U\323\r\263\351m\276\326\374\216\\iZ]\017dJ\264\326\376%\tg\250QL\307 \"\231!E)H\222\341\340\"\021+n\003\021P\255BH\031\211\202\262dh7\354\255fK\316w\177\026!\305\n\262\221U\271\341X\324\241,A\332Zp\355\336=x\217]\267\315Ma\177\205#\220\007uT\317\234B\333\234B\233\316\320\025"
+	.string	"\2145\317\202FB\247\0261\366w\007\025\347\315\375H0&9bt\215\r\223\210\351\317\232\236\247\302x/\020\r{\372\032\360\n$Z9\005<6\366\244W\346\034l\362\353\213\203R-\273|s\234\206\270\327\b\311\234\267\346f\371{)\245dR\375\310L\375:(Q\225?\357\320 _\215z;"
+	.ascii	"\t\006>1\350C$\211d6\251\255\325y\016\305\004F\317\271\n"
+	.text
+	.section	.gnu.lto_tcpTotalRxBytesWaiting.27.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`\361\001\305\020"
+	.string	"6\037nE\360\262&\035P'\335\021\260\177xGY\270s\306\345?\rN\233\316i"
+	.string	"l\307\305\314g\330\232Q\263\266\r\241\315\203]9j\001WvR\265\260uX\234<\306\344;Y\361\376\034\327\260st\254\222F\366\2262\245V"
+	.string	"T"
+	.string	"^"
+	.string	"7tv?\004\346\264G\177\232m\037\305S\250\330\203\037\314+\213\225\330\020\333\261\373q\241\213d\217\360\001\262G\035q\357\021jz\376\247\004\322\310\344\270^\252\307\226C\320\253\345\032\362j\301\320\356\336\346\311\362be~Jv\327\351zy\270\263\333v`{\201\235\r\002\361\n\212\311q\205Xe\217\375\251R_\354\303U\027{\003\375\373?\257\2713\230\2160\raZa:5}\220\rD\r\003:v9\364\370X\236\b\303\304k~[\305\267\361\346\327x\232\252\203v\023\243\301\261\373\035x\264\002-\323>\354*T\376e8\200]\227\003tD\240~V4x\300VP_6e\020\263\2632\303\312\335U\251\276X55\202\315N+{\330\026\335\2057\322\242\200\352\b\t\230\273\263\360\004\300\330\243\343L"
+	.string	"I\215\253\031'`[^m\n'y\227C-U\331\277\301\2206\\\266\351+,h\273\233 \206\202\""
+	.ascii	"#\363\350\247d\017\251R\212\251\213\243\256$J\241J$\315\035\t"
+	.ascii	"J\2272\251 \"\235F(\016u\032] \235$p%\222\350\204\353N(\216$"
+	.ascii	"d\023\312\350\304\245L\246\023\267}{u\361\203\030\020\244\032"
+	.ascii	"d\300t\323LYlg\032\302\362\201g\245,\b\211\323\303\323RU\214"
+	.ascii	"\n\322\377X\231\201\232\032\025\346X\021\3012\371\013/' p\002"
+	.ascii	"!\302\343\001I\002\366?\374\362B\244\031\321\340\005\341<z\371"
+	.ascii	"\017BW0\216x!x\210\217\341\231'I\362h\303\013\341\3349\351>g"
+	.ascii	"\240\255\222\337\342d.\210\306\035)\034\372\276\241\031\207?"
+	.ascii	"$\b\030\267\232\200\324\202\341\274\230\317s\333\035\224\200"
+	.ascii	"\322\343<k\214\237\336\332W\006"
+	.text
+	.section	.gnu.lto_tcpTotalTxBytesFree.28.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`\206\002m\023"
+	.string	"\006d\177H\340\320(\035\330\003\327\35580_\244W\211\004\213\267\250\261IR;h\235\363\310e\310QK,E\356\366\377\255!UP\262\342*\177\342aL\337\003\b\002!Z\343t\304g>\030\031^\345\245`\274v\343\210%{K)Sf"
+	.string	"e"
+	.string	"n"
+	.string	"\n\274\335_mZ\342EG\013\032\240{F\006O\367\210\340\237\247\363\243\367\377:BI\274\\\224#\315\254\303\351\\\300\331\350\036?\223\022\350tJ\025\320\351\344\016*\352\224\274\342UT\"C|`!\233\265t\306\250\364\230\305(\227f0i\352n\305\351\302\314^\273\242\222\356\376\312f\032\364\235\3767\371\337\340\337\026\001\006hjt^)t:\225=lvd\033\\\233\373\307\3262\355W\331<\363\353M_\"}\350\250\332\2418zO\356Er\337\311\375\224{)\367,\367\313{\005\031\375\300\030\031\352\306\220\313\321A\263\007\204\336Tqt\377\227\353\215\342>\302\021M0\220\206\321vj\013\364&z\255\f^\016\016\210F\367x@\347\003\035\034\206n\330\346\344\017\336\027\261\232\344\345\311\323'&\363:\321\025bHO\001\311\242\333\214\0336\227d\032\211\035\330"
+	.ascii	"\305j\257\355\356\0263\355\314\313(7@\260\305\361\377\244<\342"
+	.ascii	"\310\216\b\363\210\007\333Q\232B\034@\363\203\252\023\201\264"
+	.ascii	"<]B\"l\243U\376%\254\254\312n\202q\353\327\023.\033C\366\253"
+	.ascii	"\324\304\004\257\273\023\344\250\254\002)\340\312\004\f\031\254"
+	.ascii	"@\226\013J\007\210b9\261V,)\357(\222\026\024\353D\345\224\n\301"
+	.ascii	"\325\267\n\301\n\2510\345cI\235V>T\270\372HLW\265\200\341\307"
+	.ascii	"R\251\302o4\266\312\346\231?\370\221\037\2545.lLb\217a\376\227"
+	.ascii	"\270\004\343\023\344\342\027\204E\241\"\b\306\255\003\310\345"
+	.ascii	"r9\025;\021\227Xk\304d<\356X\304\235P\254\366#\212\370\204t\034"
+	.ascii	"0 \240\002\2419\333\001_'\364\240i=\261\216\274\220\321\303\352"
+	.ascii	"\274Y;\035\006\216X\"\016\003?c\254\315O\355\245\t\347\276\""
+	.ascii	"x\200\217\341\231'm\362lC\205p\356\004\351\036g\240V\221\337"
+	.ascii	"\"d.\030\215%R(\364\026\206f\016\017\22288\016(\305\261\033\242"
+	.ascii	"\246K\036\265\226C1_\347kw\320\002\312\216\363\2561\352\364\326"
+	.ascii	"\2322"
+	.text
+	.section	.gnu.lto_isTcpTransmitBufferEmpty.29.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`\022\001\005\r"
+	.string	"V\230XC o\224\016@\270Lg\306XZ\003"
+	.string	"~\303\\9\320V\263!(\252\227\316\005\271a!\305\275\375c\375\272\"\374\207e\355NT\2204\021\244$\030\020\200\221\364:\337l\004\032[\025k\203H,!R\246\024C"
+	.string	"@"
+	.string	"J"
+	.string	"\001vGZ\244\330\215\b\f\265c\216\037p9\246]\300\345\230mopF&=\252PO\271"
+	.string	"9\231\261\033\241~8\351I\362o\362K\304J\305)\244\364\314\032\354\256\363\024\242\341\326\3336`\233\201}\017\001\366\257\335]\353\210\375xgg\375\327\225\326+\235\232\276F\001\030\"\035R/t%.\252\205e[\230\312\352\361\267G\276\2111~$iJqQ\033+\024\222\003\307\254@\313\264O\362\222\321Y\027\036\033'e\243\312\001\301r\347%\266\214\312\346\216\"\201@\352\002\016+DJX\230\274\332\023<\371\2235\030\264d\377\304#Y\234l\320IT\320v7\301\210\216/\243\nq\314\267p9v}\300bZ1\261\341#[\354XJM\005\036\242\220\307\301\327e\334\366\351\210\276O\247y\333\2046\021\007\205N\347q\037\374<\256\243\363\"\300O\327\361\300\315\373\340FcP\210\363\240\b\004\362 &\356\355L\001d\220\321\372P\023\204L\211\321RM\315\364(@TL\034?\021\030"
+	.ascii	"2\003\3020\273\t\023R \254I\301,\017\204\202\202\201#\246\222"
+	.ascii	"\376\343L\024\254\002~\215 \236\t\321xF\212\t\r\367\205\361\256"
+	.ascii	"\331\027\013\333\211LM\260J\236j\306$L2"
+	.text
+	.section	.gnu.lto_tcpRead.30.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`M\002\025\022"
+	.string	"vavG\320\322(\035\223h\302\036(h\351\227D&\304\263.!O\225\353\322E\262\321K\032\301B\220\032\243n\370\317\352APp\355\300~Be\2038\214\355`\006\271\032/b:"
+	.string	"\370\206\275\221\220C\352\024\262\331O6\2212\245^"
+	.string	"Y"
+	.string	"e"
+	.string	"_q\0263\307m\270\200]\235\0265v\303\004\376L\217\016O\300{4}\200\367h\333\n\026\314\030\366\260\007\307\333I\262\021\032\262\033~\312s\330c\247\t\363K+\235\355\346\203V\213=\346\274\033\251\345\\Oj\263.ew\017\364\274\251\3112K+\273\353\244\325>\334\336m\263\330v`\347\211.\254\002=?\217\376\005\357\361:b\303A\013A\2239;\214\245\356\330\357vw\255:\366\303\273\344\270\037@L\227b\332\353\322\321Kw1\255]:5\375"
+	.ascii	"'*x|\271]\234\\\221=\212E%\036\376\366\214\017d\022?\204\231"
+	.ascii	"\326Di\210\247\003\220\335\020\301\243\033\2302\355%=\371\374"
+	.ascii	"(O\325S\016\266\0375#d'zA \361\037_\306{,\321\013\335\210p\221"
+	.ascii	"9w\232\032U\215jP\3102g\325No\223\024\3414P*=3@\003\252*>8\267"
+	.ascii	"\\\206\f\n\222\235z\f\320\004)5\202\200q\303\231\344\325\246"
+	.ascii	"\260\312\323\2342\323\230}\241\f\211D\263-\374\305\213iw\031"
+	.ascii	"\004\005\025\300T\2010\251\227\013fe2x\212\001_-.\251UK\345\372"
+	.ascii	"\\-\025\206Uk\302\007\263J\275|`\313\365\235R\314\212Q\265\276"
+	.ascii	"\027\213\325\372H\302}\267\252S\242'\036nG4*cI\242\024G3\215"
+	.ascii	"EOu\344\320p\033\242\005\351\216\362\214P(7Lz\f\331\204\344\356"
+	.ascii	"\306Tw\\RO%\004\355\230%\021\333\017^\204:\3318\020, \220\002"
+	.ascii	"\231\251\354\001B\241u\013,\023\256y\037\245\331p\360\022\b\026"
+	.ascii	"X\206@Q\01636\256Hp\025\302\271\317\n\371\221\304C\b\027\362"
+	.ascii	"\271y\210X\371\024\206\021\f\265e\003N\210&\0275\244{\316@XE"
+	.ascii	"\216\013\322\\\320\032\223\245\250\351\351\267\315\370c\210\205"
+	.ascii	"\215a\262\363\326\214\034\226o\345\306\336\333Z\243\007"
+	.text
+	.section	.gnu.lto_tcpWrite.31.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`\210\002\255\022"
+	.string	"\366axH\320TQ:X)\206\020t\031\260\026z\360eT\232\324\036\030#\r\030`k:.,\\qO\234>\374\327uI\207\372\223W\341\030(O\341@-\201\303\027O\240<\271B\202N\220\306\336\257\331n\2561B\366&R\312\024_"
+	.string	"\\"
+	.string	"h"
+	.string	"\3354B\ft\177\205\241:0\255\205\320"
+	.string	"\3355:?\335#\202\177\236\312\217*`\252\364\364d\252<\354\037\242\343Mk\317\t\031\236\242\356\3768\205\302Tr\274\260k\267\002@\244\305T\316(7\242\315(\227h3\316\324\335\032CW\004M\266\333\255t\367W\244\221\320O\375\017\341\277\312\277D\002W\036\017k\023\377\225\316\330\340u\367\202\035\r-\006nrZS\245\362\310E\220X\002fo\377\030[\266\371\225\353\356>\327\374:\252\222\264\246:\232{o\356\273\271\237r/\273=7\367,\367\313\355\365\244\204\344\207JO\367\210\233\222\036\2229T\374W\223\377\274\177\002\0050\035A\234\003\227\240;\300\223\216\003\036\237pT\3019\271c&\212\241\221\341"
+	.ascii	"Q~H\223\245\f\350\b\211\257>\257\t\003l\335(4\347\3722U\236p"
+	.ascii	"L\310\330\3339^\226\274BbV\310\366"
+	.string	"vf\216Uf\t\005\275\001\246\330l\020\2601\247\004\251\275\202\326x)\335\374,J\003\305\313\274\003\324\242VZ\345_\205aU\274i\306\261\007\031R\253J\261P/\027k\345=urI\275X8\240V\241\312\365\271BU\207Ux\341c\255P-_*t}'\323[.\252\360{\265Z\341g2\266r\315\033$\031\202a\331\013\354\210\177\007\017JE\021\326\207hh\3061\331\261\217\036\037^\364\210E8\26698y\200(A\244\016H\020\013#\333\3351f\233{\334\261\205\035\241\331\"\371\0033 \300\002\021\242\344\001c\300\002\206(ZTS\364\r\306\311~\323v~\220\021\245\035\204qU\264QG\360\023\370a\230\305}\330\243\344\275%\212)X\205\360\271Y\210(\270?-\317\342>,\004!\323\335\006\224\0208x\222\272W\033\350Z\363[D\346\362\321X\221b\241\022\033\314\203\004\353\230\021Q\017\326\334"
+	.ascii	"\037%t\211\006|^n\234{[K\365"
+	.text
+	.section	.gnu.lto_tcpDataOut.32.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"}\n"
+	.string	"\246\323HA0\247*\035P\254\303aq\225?v[U\324}-\335\355\305\343\346\340-\356\240+\263\302\242\2353B[\303X\202g\037\001\024\003\b\021\241\006\003\003\344A\\\361JG0\220\016:Q\004\021\262\367N)6"
+	.string	"5"
+	.string	"6"
+	.string	"\373\227\213c"
+	.string	"lw\353,yx:e\350'\210\242\323-\344\223:\210\020@\240 \222\350e\001\n\311]\227\035bI\312Jfw-M\"\310\235\335\366\204\355\b\373[o\375TJ_\013}\300\036H\274v=b\0216Av\340\304b\373\322\376\352\254\360\255\320\027vQ+\003\273\343\203\353\366\314\343\031\264g\333/\3323\207\266\203\217\252R\201\200\002\f\346L\331\006i\237\025\001\032\224$\004\333\032\007"
+	.string	"\202\360S>\033\333\356\336\344\231\037\322\236}\216\234T'Vk$c\366(\2223e\237\356\356z\242\354\035\267\321x\300\215\267\231\303t8\017\305\205\306\373:\260\202_\367\361>\213\272\3614\030\225\373\300\212i0\247\323}\325\303\341|\3252\3563\243I\242\025I\247\rf\310\233L\247(\020"
+	.ascii	"2\003\3020\304\204\275\032\310\r{\tm\365\t\231\347\020@+\304"
+	.ascii	"\237\t_`\312%\330f5E\334\345\246\332\243\201\251="
+	.text
+	.section	.gnu.lto_tcpDataIn.33.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`\271\003\r\031"
+	.string	"\006.\240H\260XQ:\360\n\t\206\024\034\033\333\005(g)1l\267-\357\204\316\261\020\007\277\213:jx\\\203\305:\360\022\337\214\212\206\323o:\311\317\302\343O\341-\310\266\341\362\276|P\013\223\272\2323\344m#\204\354-eJ\001\207"
+	.string	"\201"
+	.string	"\224"
+	.string	"Jl\256\366{\334G\355\273\023\0270\347\020\217\2459y4v\205\227\346\275\365]\206\207\371.]\263\247\234G4\237$\005\005R\2269\247kk\030\354\365z\275G\336\235\322\332\303\024(\343j\315W\245%\267\334\316\303\b\372\250\300\361&+\\D\233(*LG\272\342r6M}@/\016\006]\252rA\217\254\234O\234\231s\256r=\272Gz\204'Y\252\314"
+	.string	"zq\005!\3149\255\267\034\320\255\272m!\333\017\354]\n=\273c\037\b\t\205\272\331\262+y\b\347\234\f\2222\2008@t\343\304w\371U\355\260\334Z\360h\317\346\355\350\352\354\333\020EQ\361\016\3312?\272[?\372c\316\373a\276\373\003\260^\316\273W?\272U\237:\365\251\303O\r\206\352O\252%\250\216\237z\245Z\243\372\005\006\264`\342\340\311\234*z[\346\223d\312a\373+\333[t\243\332\217\334\344\324\2343\246,\3159i\334 \274\234\211\3123\021I"
+	.string	"\320\350\262\343\n\317\235H)R\212\253sj\303\235\031-\351\321(\333\024~\344\265\300\bMj\027\330\370_\037\270\341\306\246\037!\233\323\213@\021"
+	.string	"\340J#.Zv\337\372Dt*\030\200\232S\206\b\244\233\225\2423m\260\020\372&\276\313o\277&\034\214\270\272rW\310n\334\243\350r\341K/\004PC\016@\355\"\200\2623\206\013\021\021Cdkx\220\233\027\335\030\033;\005\177Y\231=\222\037N?:l\233\344\344\223\333\325\331f\351\327\216q\320\337<\023\261\0222Z\354"
+	.ascii	"\323\030\f\347F\207\206#\013\r\253\t\001\323\321\360\341F6\213"
+	.ascii	"\321\\\264Yl\204l\266\301\205#\273\001\341\202\315h\256\232\031"
+	.ascii	"\347\204\210\315\\:993\327\2127\277C\023\202\236x\326&\341HW"
+	.ascii	"1\261x\352\331\235Pc\326\240jY\213\263\302\254#\270\332\227\305"
+	.ascii	"%8kgFQj\316\332\326\376G\310\026\347\2343\265:\253l\355c\364"
+	.ascii	"R\304\326\252\026\247RfwG\017G\224\331\325\342\354\203\3416a"
+	.ascii	"r\240\037XnV\344\352\374\372\224\274\b\004I\250\021\360\224B"
+	.ascii	"P)\"\023\020\005\022\314h\332b\220\002\031\252\353\006\021`A"
+	.ascii	"c\205Ar\3372*\036\326\201\216\0201y'\205\205U-/\266d\354\033"
+	.ascii	"\267\006Q\264\327\235\344p\255\301\265\225\324G\\<\351\251V\242"
+	.ascii	"\366!\222\243\222)\203\324\005\277\205\030\231\276\3240\353!"
+	.ascii	"\033S\\\344\321t>\214\376=\320,\340;\265j\210[\207\357\024_\325"
+	.ascii	"`\2216\211\351\307\222\225/`\214\257\233A,\244\035\360-\240?"
+	.ascii	"=ZI8\365\351\034\360j\360A7x\321\317\365d%\207\374\233\316\024"
+	.ascii	"SH\323"
+	.text
+	.section	.gnu.lto_tcpDataOut.part.0.48.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`*\0055\035"
+	.string	"\226\262\260I\260\226Q:4L8N\372\3129O\211t\333\300$\271\302\313\2308!\275\2371\016\264;\236\324\021#\206c_Z\226S\233\rX\336B\2756\254\315\364\377`\013\327)\376!\302\016\375*\253!\0077\033:>!d\023\271S\n\223"
+	.string	"\216"
+	.string	"\241"
+	.ascii	"\357\341,\036\244_eB\240\303\210\317\347\324\013\310S\236\360"
+	.ascii	"\3459\3773z\224n\366\253)\226<\247}\035\207\332=J\367\233Z\233"
+	.ascii	"|W\265\376\016\234\232F\236\372w\035\361\224\274L<\265\237\303"
+	.ascii	"\266\321\222w\366\225"
+	.string	"\377\236\352}D)\365\b\326Zi\247\033\343\273\217\"\rw\222;\277\304\307\021\250\326:\303\304\342\342\212\323$\0233\234=&\025\337\260@\026\254/1&\244P\007\305\214\336\253>O0\361\346\30499\002\325Z\375\243\026\267\353\266G\330v`S[\247s_\365\002>&\275\025G\263\314\\'/\371\260n\223\035N\347\214\3232:\215#N\337\320i\233O\3355\341t,\234\206\205\3234\343\364\213N\317\210\323.:M\336\352\036\303i1\234\246\341t\030N\357N\317\377\376\357\310\030\370jEQfL}A\211\320\370\217\177\352\267\372\332\367\203\034\210/\304/+\006\276\240/\370\035\367w\030\371>^\345\327\017*\335\364\241\322\205\265\305\257\246\200\340\243\362\005k\3755 O\247\214\274\344K\235\307.3\373Z;\202\204$O\270\023\020\344ki\264\\K\356\314R%I7x\256\235EQ\"sD\341L\212\022"
+	.string	"\227\224?@ra6\266p@\211;\356\255(\221\t\227\256\2704+\251\006\257\302\223\324v\236\220\224"
+	.string	"\236\350^\310{\244\246\204\331\377IL\226\253]'\207\273\213A*\t\322\024c\333\302\217\324z\200F\312\001\300p{\264\354\013/R\313\261\203\236U\302v)OJ\030(\330\234kk\270\315\367\314\203\264%\354\023\0211\201\265\326\367l\016\307\362 \340\251\326\252\340\212\304\220/\343\324\327\211\001\271s\020*\332PR[)\024D\224\023\272\221.\177>\224D\265\016A7\234-G\313\341l!n\270\f4\241[\220\007Z\211\313\321~x<\364\301\206\243\021\r\r\341h\257\207u\233\ft\264\274\361\301m\016\301j\222\263\301Z\fL\271Y\275-^j\004\200]\312\035`\316\272l`\301!\316f\315\342\254L\213\354fm\026\347\006\357fgJ\260\024%\270R\376\330,\f\306\025\352\363\232\235\271\340\"E%\2665{+\330\322llC/[5Z\225\322"
+	.string	"liZ\265"
+	.string	"\300R\207\246\207g%\fT\270N\256\211Q\240\224\260\361\311V\260\313l\216\033h\250q4D\241B%\024FJR\222\244\003\200\002\231\231\243\333\022`\325\031J;\247D\242\253\373\177\006\364\244\207\n\362\300\264>-\231\303ij\274\013%\033\271\350|2\235<\260\264\231\241\312B\2000\324\316\235/\0258}\n4{\"\305V?+\332\305\254g7\347\245\203\260\351=<\bwA\n\205\033n\3463\266\036\033.5\220\340\343\307\274\037\220\325m\207j=\277\375\357\025"
+	.ascii	"\030c\205\350i\0263\347\363\205\203;\374\261\224\237d\224\341"
+	.ascii	"\347\206\235\003\322K2u\324*\200\216E\372\357\366)\356\214h\236"
+	.ascii	"\303\b\033\377\2407\366\215\317\b\200\2672J\001\310=\002\222"
+	.ascii	"\t\262;\034~n\274\215,\254\255\304<`s!\025EG\0047MDk+\263\267"
+	.ascii	"\006\213\004R\275\273\351\006\205.M\243S\006\304i"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`\236\003\305\017"
+	.string	"\266W\\E\020s\223\016\200\307\326\007s\204\200N\210\313\322\321\301\201\340`\246\214\354\235\f>\257\3043\033\001\255\252\252J\273\252\262\231\231\216\356\356\302\212\032\217\231\031\376\272\177#\303Gkk\213\210\032\013\227\032\241M\033%)eJ"
+	.string	"N"
+	.string	"G"
+	.string	"\360B\006-4\312\251B\177Vd\327\265\210yi\027\n\275\231\2324\241U\270S\335\220\320)-\r\342R\2138\302\t\274\352N\031\b\332)\346A\217P8\020"
+	.string	"U\365\222]\247\202QmU\035\247\035\221RJ\226\016\261\252\216\300\b\374\365\226g\206\254f\214\370;wm\260\210\341\003\205\037Q\232\376D70\321\013J4\003\022\235`D+\020\321\003B4\013\210n\371\320\005<\264\001\256\017th\004+OR\265T\204C\023XS\252\305\332\320\001T\032\272\304\031z\2051x\0023\005\036\003\301o>\r>\242T\340\257\t\037\232\332\267*\244\306\216 \032?C\235\360;\336\207\337\231 >\307\333\255\341A\203&\304\337x\032?~\353\202\203\210\n\021\273x!\003\310\210\177}\032\377\232\373\322C\006F\024\212ykJ\265X\244\354\334\226=\322\230x<\3476\317S,\257\274\034?0\023\256Y\255\230a"
+	.string	"\347\266\271\233j\261T%\354\234\217\204=\2426\233oI\311\243GB\362\353#\305s[\374v\331\365\216\367}\3409\001J\250Q \303RJ\024\244Me7"
+	.ascii	"\003)\242\352\021`\024\322)\205\242\242\330\221y\032{\232\004"
+	.ascii	"\005]\277a\225\221\004\202\237\252\212\033\373k\364HZD\327\233"
+	.ascii	"\315\367\r\376J\352\365\343\231\317\024\205\204\370\363\373F"
+	.ascii	"q\260\267u\245\035T\212\3408KS\236\3038i\365\201?T\322%QYo<\275"
+	.ascii	"\356 -\310Y\232GuU\277C\036,%\300\213\030\361\013t\331\316@\302"
+	.ascii	"\036\247!\3038f\203\nF,\244\006"
+	.text
+	.section	.gnu.lto_.refs.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375 _5\002"
+	.string	"\262\205\017\024p\265\352\374\377\177\350\245u\374E4;\216=\367\267[\312\024\243\246\n=e]e\263\372\021\035:\311\212\267;\300\364\202\177x!\013\370\001~+\3758n\020\316\370\211\177w\321\212\317\177\020\001"
+	.ascii	"\r\212\022"
+	.text
+	.section	.gnu.lto_.decls.2a3eceff3bdf6009,"e",@progbits
+	.string	"(\265/\375`\235@E\025\001\212\333\tgW \016\245\234t\357\272\352r\376s\347E\334E\234\007^\030\336#\302\300\217\273f\374\210\273"
+	.string	"\007\205Dx\212V~\377\326\313\275]\214\223\253\310i\304\f\323m\033\347"
+	.ascii	" T\343\366\254\224\243\340Qy{\324\226M'>\333\214\247l@\342{^"
+	.ascii	"\337\255\303\266%d\023\271S\236\005d\006\204\006X\346\336D.\006"
+	.ascii	"'w\220\323\346\024C\356\373\333\205o\266\205\321\253\205\317"
+	.ascii	"\326Y8:Gk]\266\033P\220}{G\363\260J\017\272\307\272\223cW\304"
+	.ascii	"\216\256\357/\016|\353\001j\357\254\007h\353\370yg\355<\361J"
+	.ascii	"\336\350k\203f\n\177\312j}P\2339\333\203\336\310\300\277.\260"
+	.ascii	"\006f\266\007\375]\302\032\260\331\036\264ip\260S\003\307\261"
+	.ascii	"K\337\233u\370\214Mc\256I\f\024\261XF\365T\317\260\312\226zK"
+	.ascii	"Y5\335\364\341\b\031\242hi)\325P\267\302+b\302\022d.\347\274"
+	.ascii	"\201\203\r\033\256\222\034Th\340{\023\f\277\221\2228\260l9,\360"
+	.ascii	"\203\214E\221n\262k\372\250\203\242\244\025\324\312\226*\270"
+	.ascii	"\226\214\364\n%\r\226M,\0053\256nj\246\255\265\233:\005\007:"
+	.ascii	"\3075#=0Y\363\232\3139\377\357\030-\243\235\032F\273\350\027"
+	.ascii	"\375\324-\254\262\233\032\271a\303\206\f\247\222$st\031\334w"
+	.ascii	"\035~\237\301o1\370\355\206\337W\360\331\254\017\372\226\202"
+	.ascii	"\337N\360[\211I\260>h\2430\216ic\352\373\006\202\377\367\261"
+	.ascii	"\213\254\262\215\254\335m\023KWf\353:\353\0301\310\271\006\\"
+	.ascii	"\362\247\215\332\330\331\262=\255\331\311\302\020\363\204\314"
+	.ascii	"\\\316k\206\r\033L'oe\222\240\367\226\f\376;\337\335\330uI\331"
+	.ascii	"\335Y;/-\245\032}o\327\360-\024|[\206m\266>\350m\022\374\333"
+	.ascii	"\271\3334\277\225\263e\254\030\n68\307RTA\352k\321\374\334\316"
+	.ascii	"\365\240\310\2475\213\345\234wL\0249\224\234\372\206`{\320[/"
+	.ascii	"|K\004\367j}P\r\266\007\335 \333\036\324"
+	.string	".\333\216\261q\267K+\346\036J8\216Q\346\312y\265\313\233\363\321Z\020t\254\005\341L\343q\fC\357\255\017|\213\003\333\030,\030\253\f\301\276\335z\261n?\217k^s^w:\253n,\254\357\355\024\276\r\0015\357\356l\b\350\255\023n\333\203\362X\037t\203$\227\020\260\021\0242\256\276\277\335\322f\301\270\252\344\350k\265d\3405\311k\272\372\336\"\341\237(\207\033[\346\274~1\261e^e\277\255b\327l\026K\305^\261l\326\212UZ,\277\225b\247<\303\232\263Q\023(\026\315\214\t\003\376\237\264\247\351\364r\266\022K2\340\267^\277EbW\213\305\252=M\307\210'\033\365p\262\3149\177\201\331\261\016\212\2224\360\243\3112\347\365\226\353\267M\260X'\026\315\\}\344\\#G\006Z\306,\2111\227\363\272aC\206\r\0336l\330`\261\260\330\202\302s\177\002l\256\326\007\375`{\320\227"
+	.string	"\237\005\374\025\360o\321\316N\027OT\264\350\320@\306\260\246\357\177\253\264f\366\311\2323\364\252\264$\253\357-\200\377"
+	.string	"\314SF\266s\304\305\215\035+W\316y\247wF'\344E\337\227\200o\225v\314\212\2510$\352\255\257Ub\227\334\212\331$\367P\302M#X\346\3129[\261\006P\345|\264b;kr>\356X\013\202\265 \\#WZL\320{\022\360m\330{\332r\t\347\3417\376\300\366\240\037X\037\364\332\036\224\004\333\203\376\266\353\267G,\327\341\314$%\252,\226\363\212A\033\277\210P\351\373\325\372\240\330\366\240\001\360"
+	.string	"\314\300\211\237\331\025\354\021\312\001@.\300\360\016\354\361\031\376\263\304\3372\314\037\343\361\370?K\370[\206\371\223\226"
+	.string	"\236\270\210\376\300\003\360\237?\016\374V\350\302Ch\021/\256\301\177\212P\"\003\037\023BZ\342D\223\001\354\317\002\231\030\220\360[\030\354\261E4\3233\370O\002\3746\370[\022\277\365\3756\350\267\303\337\002\177\273\202\337\272@\364\333\016\277M\177\373\373m\211\337\n\375\026\350\267\302\2775`[x\301oS\360w\222\331\241\263L\016\2779\202=\332\023p\\\001\377\031\3427\027`\212`\366\237\314\334\320\202\211\277\265\230\n\370\355\013,\2600h\370\273\204\031\202\231\200\277\323\374m\302D\300oO\374\226"
+	.ascii	"\2465\017`\341z\305C\370\177\306B\230Na\201\377\354\241B\302"
+	.ascii	"4\300o\242\005\370\033\213\t\302o_0m>\370\257\3661\004\370{\005"
+	.ascii	"?[\300\177\237\374=\366\233\003\370-\231\351\301\337F\025\260"
+	.ascii	"\340\267/X\027\030\337\301\3771\t8\007\377\245\373[\210\331\301"
+	.ascii	"\177*\377\327\376g\371\257ED\333q\376{\367\367RO\335\377\234"
+	.ascii	"\300\337\027\370\373\204\277+\3607\n\177[\340\357\b\374=\201"
+	.ascii	"\277)\3607\004\376N\341o\025\376\226\300\337\031\370[\003$\374"
+	.ascii	"\315\264!\001\177c\020\376\026\300\337\032\374\215\363w\377\226"
+	.ascii	"\356\357\007\374\037\300\177\232\3407\005\360\233>\277\231\301"
+	.ascii	"o\336\374&\3577\373o5\177\277\375\335\366w\226\277\327\376>\373"
+	.ascii	"\233\311\337C\376N\376\r\365w\217\277w\374\215\343\357\251\277"
+	.ascii	"\243\376~\361w\213\277\233\376f\372{\351\357\025\177\247\370"
+	.ascii	"\333\3707\210\337.\377\217\371\377\366\3330\2775\376\327\362"
+	.ascii	"[\016\277e\341\267$\370m\006~{\302\337/\370\273\005\177\257\340"
+	.ascii	"o\023\177\227\370\233\304\337-\374'\373\373\004\177\227\340o"
+	.ascii	"\021\277%\373\033\004\177\177\340\357\020\377\317\376\213\370"
+	.ascii	"/\366_\350\357\022\376\356\300\337+\374\315\201\2777\360\333"
+	.ascii	"\025~[\346\267r\277%\363\237\205\337\306\375\026\356\267(~k\364"
+	.ascii	"\333\242\337\036\377o\371\337\366\237\353\177\210\377U\376\363"
+	.ascii	"\334\335\335\335\375\274\344\217\265\376\037\016\001Y:l\236\352"
+	.ascii	"z\\\301\372\325\321b86\266\354\270\272\211\303\377\305qoxpK."
+	.ascii	"]\033\2777Z\313\005\025\260\033n\3707Q\360\177\255n\025N\223"
+	.ascii	"\346\"\315\245\372\255\262\313\0343\030:\234\\\0328\2531\213"
+	.ascii	"\2714\356T\217L\2307#\235\242\250$\216\255\031Q9N\246~\340\200"
+	.ascii	"\372\2152\242\270R\327\367\3120\323\354\274-%e\264\032\317i\212"
+	.ascii	"YS2\006\214\233\257&\245\263\027\2770\356\221\226\254(}\257\013"
+	.ascii	"\233$a*\356\372^\246\333B\256\305\030\252"
+	.string	"\026N8PYg\2504\375:\265T^a\324\367\"\017\207\345d\224\353{3\027\t\220\247\0337R\370\277KJ9`\230\314\320\255\370U\322\271\"\033\223\354{U\270)\251U\365\275(n\2124.VXI\221d\3760zB\201\364\233\304[B\031\343\352{\217xO\260\254\205\351{3-\366\277\207baZ\243\346\206\t\377\267\350\036yan\034\205]\343\357q\007\f\234\025\220\2767\237^S\307\276\346\335\307\230\261\243\232\353{3O\373\337\273/\316\216\\\351\373\233#|\033:\374\233kL:\033\033b\254$M57\351lnD\031\271\372\336\214\231\346\177\257\307v\346\214X\23295\026U\262\342.\024Y\024*h\032\013\316\224\r(/}oC\006\377\246\231n\202v\245\261;SFC\032\267\242-9;\226\023\245\304*\f\2318\035\260#RL\2267\343P\220\263\230\371c\354\250\256\2579\346\347\346r"
+	.ascii	"M\322\316\372\362\304\230p9E\306#\024\\\230\234\030lk\200\364"
+	.ascii	"}\263ij[J\351{\0338\354\024\303\204\272\342BR\3614\261\244\222"
+	.ascii	"\267\244\220\247#*"
+	.ascii	"\222>L P\313\225.j\206I\343\bX\232\244\311f\006y\232e\023Sa\213"
+	.ascii	"\214\245\331\304\214\301\214bZ1\251\230`\314-\246\024S\31543"
+	.ascii	"\247\230X\314.\246\026\323\213Y\305\204b\272\231g\346\025\323"
+	.ascii	"\211\271fr1\263\230m&\232\371\304L3\277X\245\311f\272\270\271"
+	.ascii	"\304\024\373\372R\263\264a\262\231Z!\230\253\031V\021&\325e\307"
+	.ascii	"\222\314\025M\207\363j\037CX,\221\254qja\302(\352\262q\303\304"
+	.ascii	"\262lO<\331(\f+i\335zd\3302\265\3149\233QTf\215\017G\310\036"
+	.ascii	"\322U\221\237$b\314\025J&2\f\t\021\323H\230R\230\035\233Kr\331"
+	.ascii	"\261\243\253\024\246\216\337\264\361{(\301d3\263L\036\346\232"
+	.ascii	"\344))\242\241\264cc\216\230l\246\227\035\2533\221L6s\314,\263"
+	.ascii	"lO97}P\004\013\310\332\\\316\371\344\262C\r\024\t\334\337$\273"
+	.ascii	"Y\366\233If\n+\246\263fc\n\213\276&\223\237\233d\357\271!\253"
+	.ascii	"R\247\325\267g\007\316Y\255\017j\325l\017z\033\033\3706O\370"
+	.ascii	"6+\360{u\370=1\370=6\374\036\032~/\t~\257\b~/\013\277"
+	.string	"\027\205\337ca\244\b>6\211\222\245\210\271u\203\244\350\251\251\357{E\370X\r>\226\303\307o\370x\013\376\361+7\336P\364=\256\202\217\237\340/m\017z\034\206\217\203\340\337\334q\223\207\025C\301\006'\214\212\356\372\376\374\334\334\361\036\213\204\356kJ\337c\0358\203\365\301\312a\321\200\250a)/\306\304\361\3778\002\310Q\302\200\021\326\367\230\006>\226\201m\266=\250YeZY\345\255\230WG\313\310\214\030\365=f\302/\310\267\202\036#\341\337\2441\265s&K\227u\312\224\342qY6Q\321\367<:|\036\031l\221P\246\fS\305\022\f/\246\f\363\351\311T\232\224\276\347q\301\347Q\301\277\t\303|Q6\345\246\302|a\272\330\331\301\266\266\325\367<3|\036\030\266TB\260\271d\262\260\312W1\231\276\356\350\240!\215U\351{^\017|\373*\350\013\354\253\240\347\341\3006\311\253\302\226\312\372\240"
+	.ascii	"\260=\250]\315#\017vV\030K5P,\217H\271\0223\262h\274\027J3]\372"
+	.ascii	"\376f\221y\324\341\262\314\372\322\3274\232h\2004q\351{^\f|\006"
+	.ascii	"\264]\007i2F\233%K4V\346\334~\333\305\316~\261a,[\016\013p\251"
+	.ascii	"\321\365]\327\265\232N\323s\215\246\327\364\0313[e\333\375-\327"
+	.ascii	"\026\316.Q\254%\032+s7\260:i\331\236\262\002\220h\254lu\261k"
+	.ascii	"3\255\245c\\3\023/\013\211\306\312\034\031k\246\251\216N\272"
+	.ascii	"\312\256\255\232\252\203\242\244\273\326dY\303\242\225%s^\373"
+	.ascii	"\252\355\332F\0242\037v\375\243\223:\3065\033yX\031\215\225\271"
+	.ascii	"\f=2q<xhp\217\312a{d\265>\350\006[\266\007\215;\267\222I`\364"
+	.ascii	"=\352\206\217tu\330\207#d\217)L\307re2\225\364\032\243\221\264"
+	.ascii	"^\312\034?\242Z\310\2206\362\341\b\331c\261\205\3072\347\365"
+	.ascii	"\347\254\243\230_H\314d\313\322\262\211\031\023\225\276\362\341"
+	.ascii	"\b\331kQ\244\242\217p\035\356\303\021\262w\264%\213\313I\213"
+	.ascii	"]A%s^\311\244\276\2644V7\371p\204\354\255\3302\303C\t\255\245"
+	.ascii	"\263\264\226\271&yK\256\264\2269\257OZ\314\374B\342%a2zK\277"
+	.ascii	"\265\227^6\\\213\3511\335\245\271t\230v\353\266\216\241\3014"
+	.ascii	"[\177\261\312\326\322X\336>\032\210\226Nk5\313&\226\217N\037"
+	.ascii	"\370X\317\374\230\313y\335\240\003\266ci-\300=\352\205\217\372"
+	.ascii	"\300\177_\261\"\366\025\006\314z\177xy\242\325Uz\r\365\332\222"
+	.ascii	"c\255\357Q*|T\206\224\236\262\203f\251\214[\337\243,\244\240"
+	.ascii	")\032\nN\020'\246\036}\177\3225\332/\030U\216y\204q\345I\337"
+	.ascii	"\237r\370'\030\374\363\n\376i\206\377n\322eI-08\266\035\034\273"
+	.ascii	"#[\252\372\376\f\303?\207\340\237X\270\223\264\022\253\324\320"
+	.ascii	"K\3363Z\2632\347u\247\347&'%\326\367'\025\276\325\200\356\334"
+	.ascii	"\335\335\335Y\r\350\317\026\370\253\301\326\213\002\n\224\034"
+	.ascii	"j\276\276\242m]YI\337\277\221\274\327\035\036N\264\324\350\333"
+	.ascii	"^6\314\235\023+i}o\346p\377{7St\\a\351\373;\006\377\262\341\257"
+	.ascii	"\266\007\355\"1l\034\341\372\3762\301\267\312\336\"bS\327#jV"
+	.ascii	"\254\234Y,\317Z\264\305+\231\323dDn\n\313\317,]lI\210\364=\257"
+	.ascii	"X\264\233\265)1\230\210A\201r\256e\300\271+,k\231\363\223\006"
+	.ascii	"\233%\310\037T~\2569!\243\233\352{\252Y\264\272\270;$}\317)O"
+	.ascii	"\373\261\305\344\243\357\031\345\224b\205i\t\254\357\231\346"
+	.ascii	"\245\207\232\027U}\277c\004c\225\225\235g\026,3\331\253\034H"
+	.ascii	"^;wS\344\200\234f?\317\322\252\270\034Y\353{>\261hYT\352\322"
+	.ascii	"\364=\235\3302\234\034)\200p\351{6y\032\257\n\226+\032;Q\370"
+	.ascii	"\377\317\255o\235L\3145v\315OT\306\270\037\"1<i\320Qsq$\346\365"
+	.ascii	"\223\311\317\261\253\265kM\3373\311\271\344\024\373{\347\216"
+	.ascii	"\031kP\364\375N\013|*\031AJM\325\232\276?\327\034m<\204\234\312"
+	.ascii	"\277\227#\306\344dE\337\357(\341\363\353\004\203\241\344b\327"
+	.ascii	"\367;(\360\211\344\\\217JX\312\276m\237\206\236C]\216\262\026"
+	.ascii	"}O#g\027[\325\034\212\2333\255'o\\\347\221\363\254\306\n.oSV"
+	.ascii	"\251\272\276?\213T\355\320r\352\213\374\002\205\204\246\356\307"
+	.ascii	"\217sH\013|\270\315\330\"\203T\202t\n\3719DLOL\016\215T\3373"
+	.ascii	"\310\211\264\363E\345\002J\337\023\210\\2y\2238\203\234\315U"
+	.ascii	"\230YR\337\353\200\301\267E\354\331\343Vy\366\270c\275\244\234"
+	.ascii	"]<\240\351\314\205\b\327a\303\377\211e\225'\326\271C\003k6\332"
+	.ascii	"\220}\235;\376S\307\231e\036q\250T\250}\211\352{c%[\037\324\036"
+	.ascii	"Ym\017z\2353*\252\023\207\004\272n\312\310%\273\316\033?q\230"
+	.ascii	"i\252p\tC\366=m<MM\031\227U\337\263F\207\355`\2011\222\324\367"
+	.ascii	"\274:\234Q\r\037U\372\236V-\3065\205F\245\357Y\325j\226\316\314"
+	.ascii	"-E\024%X]\274\224HI\235S\032\260Yq:VCn$\335\314\317\251\236\017"
+	.ascii	" WJGb\234Q1N(4g\273R1!\363\023R\303\323\323\te32\347\247\t,A"
+	.ascii	"\262\314OO\032p\314\300\260\221$\343'\024Q,\254\305\211\004\326"
+	.ascii	"\324\304\253\357u\222\370:S/^\334\033\007\310\242\005\353x\272"
+	.ascii	"\261\324\367:0\316\026g\213[\005\200+g\220\2701p}\237S\207\317"
+	.ascii	"\246\263\351\352\340\311E]\312\222\371\351ICOk\210S\224\276\317"
+	.ascii	"\211\201\211\351\352\210\323\220v\366\244\201\005id\356\372>"
+	.ascii	"\007\r\337.\355\271\244<\227\3542C6\337\264\270\315\330\312\310"
+	.ascii	"U\204\347\214\255Xa\306eX\263\023o\305\231\333\214\271\214D\212"
+	.ascii	"\360\234!g\321\213\316\024O\331Hf\001B\214g\322\317\024'\022"
+	.ascii	"j\324\302MH\337\323\350D\372\337\323\311R\306\366\245\357\177"
+	.ascii	"\"\235G-\352X\270\231F\323\230\"K\322\211\"\007\007\376O\243"
+	.ascii	"\3624\232pf\022\325\261\352C\232\f0hs9\253\211`CEF\013\273\276"
+	.ascii	"\317Q\201\357\356\314\234\247\300$s\212p]\035\017-8t\370\277"
+	.ascii	"i~\327\374W\315\245k8(/\035}\355\322\372\240\003\260"
+	.string	"=\350\235\373\371M\243S\304(\325\243\257\007h\356\231&Rj\330\350{\315\254\312\2343\007V\214\024]Z\337\343x\301\rEv\313\\2Vy\345\326\234\225W\316\236\271q:\30657\221\300\004\207\311\024\022\022z\377\273\374\215S:\311\241c\331\367\216\371\371]J \253\206\221\276\346\333\257\230\377\206\271p\275*\263\265I_\253f}P\001\200\371\371}\223\373\242,\3227"
+	.ascii	"7\006/O\252\324\276\372\376\262]-\277mo\273^p\316Y+\316m\306"
+	.ascii	"\\~Bj\370\257\333\257\027S\207\223\230W\027\033dWC\272pY\262"
+	.ascii	"\245\216\206\325\"F)K\315\335r\313\302\007\212*}\217\323\205"
+	.ascii	"\355o\337?\232\217\310\234\263\323\271fd\021\016\372\333\333"
+	.ascii	"\323Z\r\177\2165m\001\376\337\1770\221s\221\222e\316\331\226"
+	.ascii	"\301@\236\034\243>\310\377\257!g\243\3159#\223\224VF\f\222\224"
+	.ascii	"\307\234\224\204\255\t\203$\245US\322\232\2536"
+	.string	"\310\312\0329i\2452^*c\316\331\330y\315FVM\331\210\3128\224\264fd^\251\214<\331\250\211'i=\032\223\224VM6II\325\224\244\244j\302 \033ec6:Va#\252\246$+TM<I\312cS\222\221U\223]\251\262\325\002e\2652\036e\3451'\347\254\264&\21589\037\221\331\330\326K\331j\271\224\247\262e+\262\326\3109\033\305\276\\Q\365\326\242\314\226\024\204\212\304Q\316_\362R\003\214\326\270\346\234\221r\221\321\346|\264\"s.\242B\301S\3169SY.H\310\234\223\215\216JEWT8GETH9H\225\3159\347\246$\345\025\325\317\231\022e2\027\255F\233\244D\225\223\371\213\025\022+\215V.G\231\365\244d\3457\313\177\257\\,8mG\035:\372Z1\353\203rP\345\347\327\n\016\024'\260)}3L\371]\373\257\332\245\202>9\302\325\242o#\255\017Z"
+	.ascii	"\333\203^)?\277SN0`\344\266\364\005!\215\352\006]WQ\337\213f"
+	.ascii	"\276\340\356\356\356nM\316\307\213\3267\312\205\362\213\366\035"
+	.ascii	"\336\227\255\244#z\326d.\021\0358\246\230=\221Z\307\236\364\275"
+	.ascii	"\311^bW\234\2405\221r\206\255\0319\226\365W\232$3\200\22011\243"
+	.ascii	"\232\001\204\311\030\235\23172}W#\256\2660(}/\217\353\343\312"
+	.ascii	"\005\273aw\275\312\373u\271\256\327Er\217\334$W\311\355\272b"
+	.ascii	"Vy\227\364\332\357\217\233\343f\251(\372R\343\342\220@\027\325"
+	.ascii	"\231\037s\246\335-\252K\232g\3145H(\222|\004\271F\272\250X\032"
+	.ascii	"\335%:\263\316\\\363\341"
+	.string	"\b\331C*\272[~I]\2531K\257\247;\003\t\362\314\217\271\0357\313\352\203#\3133?\346X\334\030\025\240:\363c\353.\271W7E\007EI\371XEB\227\231\016\214\256\265 \035\334\377\032)r\263\305\306\326d\353\267H\032/\310\2273j\372^\"f\220\030R\034\365\275B\356\220\377\275\234%\037\307%CZk\313\025\245\"\234\032\030]\255\017\372/\327GR\307\314\024\221\033Z\277I\334enM\212\276\267GgE\211\001\244\265\316\2533a\236\364=\316\023>NQ\251\032$\276\340\002p(\344\002p($$\002@Z\034\n\001mT\242aZ\"(\302'\f\252BA\242\021>\337NQ%\032\n:O\202\303\006jP\030\364ep\022\034\324\242p\b<\203~\251\320}aH$\241\016\205<\3410\250\376\200C!\337PH$\246>\037\317\013\251P\007\206\237P\232\302\320\003jZ\334\311!\246+"
+	.string	"\001\375xN\250 L\325bP(GH\210H(\034\ny\352\257\004q\030\204\006\251\302 q(\210'\004\321\033\002\252x\b\250\366\212,\f\001U\035a:\024b\b(\202\230\026m\212 \206\200\252\215\r\t\034T\342o\210\203J\024\342\247\376R\030\002\252\030"
+	.string	"\375xC@\021\305`\2064%b@DO1Ua8a\b\250j\240\022\177*\013C@\025\003\245*\b\n\375\202jP\b\"\203\224H\324B0H8\004\246!\030\002\252:'\301a\030\004R\213>Db\n\244\026\321\237\372KA8D\323\342P\b\005\341\220\247\372\210\252\372\3539P\035J\201\300\013\b\207\370\300 1\025\246-\3407\300\204\021L\370p\202\027Dt\002\320/%\362nZ\020\006\325\340\217\004'B"
+	.string	"\2004%b\340\204\b\241\237:\024\001\364\263a\001\003\030\324\241\022*\250\301\022E\341\217(\202\205bP"
+	.string	"i\2217\002\205T\375\251,\244\302\340\nBD\025\0055-f0\002\205\023\324\264\230\023Dt\002\026\006[HG\330\244j\220H\002 a\212UX\001\004\006\356IpPa\005\020\030p\200\007\240\264H$$\362a\224\250\016\245\305\337\b\035\242:\224\243\006\211/\340"
+	.string	"\tS_\020\321\210\264\370\033\221\223\026\177#|CD."
+	.string	"\177#|!@\370v\200\204\251/5\361+\372B\200\360\341\024\211\251\013\304_\t\037\026\006\177$\200>t(L\205\202A>\236\207b\013?\241 \037O\365\361\200\204\206\276\033a\t\"\241!\320G$\002\372nR\241\021?\325\204O'\210h\204J\034\222(\372z\252/\004\b\237\315\251\372\032`BP\320\320\347\353\251i1(h\350\343\205"
+	.string	"\341\273QM"
+	.string	"S\240!\320\207C\200\360\345\244@\301\027|6*\254"
+	.string	"\002\003\276\020 |X-\006\205r\202\210F\370\212)1M\211A>\034\325\227\252 XDK"
+	.string	"\372\r\371|h\n4,\341;U\237J\034~`\b\250\366N\342\003\240`\253'\301\241\003b\032\f\n\252\302\024(hS\364\341\214@%\016?\300\223\n\215\370\2110\201\246\276\024h\330\001\2258\034\262I\201\206%n\352\013\241\022\207C9E\3410\250\016\ry\251\372\013\001\020\321o\004NU\020dA\025\n\376D\340"
+	.string	"\375R\r\250>\017\f\020\n\376D\340\230\b\246\3004\004\031l~\352/\205\023D\035\242\372\001\020>."
+	.ascii	"\177#\204\204~(\244B@A\034\2258\034\272D\254\372>\250\302 \021"
+	.ascii	"\217\230\006\005\021\235pB\305&\210i\361\n\205C\340UQuG\330B"
+	.ascii	"P\350\347\363\361N\202\203\n$\"\252E\017E\337\211T%"
+	.string	"*\201\201\013\300\241\220\317\207\252B\242!\320\347\343\021S\341\013C\237\217W$\246E\"\241\317\207\201\204A\027|>\264(\f\016\025}>\236p\030,\006\205R\237\257\247\372\324bP\210\347$8\024\323!\030\324\021\200R\342\217Dq\204\016E58\242\003\221\260\205\021N\020\t\203B#4\300\004\237\t\037NtH\201\210\204\200\302`\007b\221\250\303\003\324\023\251P\350'$\246\2520\350\003\372\245D\022\352\220\317\267\201\211\2248\344\363\241j1(\344\363\241?\365\007\344\363\241\251\n\202E\237\017u\0018\\\341\004\021\025\032\016O\360\235@\251\nL\205\302!\260\247\372L\370Q\205A\"\254\n\211\206(\250\3024(\004\274Q\205\251\t\025lN\202\003\320\017\006\240\016@?\030F\004\205:p\330\340\303\241\224\330A\035\016\211\035nR\025\004\2137\035\202A\275?\365\007Dt\026\321\022\277\224\250\262\340\003\372\301"
+	.string	"t\223\252\303\022)\021m\241X\302$\376H"
+	.string	"\357\177~P\370@\004\036\310"
+	.ascii	"\006r\030\002\252>\241_\220\230\026;\024\211\251\211 \021\250"
+	.ascii	"\2030\370+\321\001H,v\340@\200\237\372\003\272\377Q Q:`\326\222"
+	.ascii	"s"
+	.string	"?\240v\340\312\030\t\361\201:\361\224T(\211$\317\0249S\340\214ph\235;\260\326\025&/ztR\307L+\316\005\217\273v\245\244\211\002\333q\263\\**\032^\262\3163,0\032v:\332\3164\\\204"
+	.ascii	"\301\272bP\214\2713\262>y\261\213\303\361\206"
+	.string	"\301\310\221\025\335\370\251\346E\230(XP\033\350\321\246I\013)Hh\215s\215\210\n1>\320+\024)\007\321\361\304\352\314\202\032\255\320\242T\241+\216\202\210yAu\327\f\225\351\002C\303,\373\002\025\244\f:\305$H\031\335\226\3249\244\303W\325\220\2761b\240QF\260\032/\244\035\nu4\252G\227\304(\245/*\303\242m0\3276\327\027}\302\300\006\352\342\350\013\324\005\352\024C\307\225\332\026\217*1Ha\340\204.\035e\201.\241N>\214\264\231#*\224\240LG\235\2166\355P\371Z\021\325\367(\362\f2MS\230:4\005\232\002]Q$i\353\2544!U\034]A\267,\023\207fc\364f\206\325\367<dP#\324\bE\n\353\302I2\3021\004=:\212\344\344\254\211\254/\212\302\242\365\314\3242\2163\"JU\232\364=O\333\232\277\016=\336c\316E$\254E_r~\322`aL\255"
+	.ascii	"\323\367G\363\321\343Q\243\207\022\2366\227\342jF\337\277\307"
+	.ascii	"\256\230\351\352{\336\241A\316\320\346\354\376\367\200\216Pl"
+	.ascii	"\034\356b\250\030\213\204\364=\017\032>O\031\334\3171p\247\232"
+	.ascii	"\233Fyj\006\257\305\332\225\332\\Nz\322\260\263v\243\354\016"
+	.ascii	"\315O5?\323x(\341iv\212\221\005\223\276?\347l\200\330P\022\351"
+	.ascii	"\373\021\376\3670\030\214\246\246\276\247\334yfg\006\2255Qg\314"
+	.ascii	"\354L\331`Q\246i\3443\354L\334\2262d\216L%\341\310\234qG-]E\256"
+	.ascii	"\031\016xH\244V\344\3459\310q\213K\362\326\367\024\303S\305\345"
+	.ascii	"'\030.\347\233\005\313L<\2545\253!s9i\206\006\0347#c>\336\242"
+	.ascii	"\334Hzr\245\357\371\345g\f\177\257\317\346\240\224\364=\017\n"
+	.ascii	"|\272\375\364\362\367zNHZf}\317\223\361\177v\371{&\323\025\n"
+	.ascii	"\263\276\337\231\303\337\361\242E\313\331F\202\315HK\302\246"
+	.ascii	"\314'6\324Z\264Y40K\250\264\005\204s\250\263\021TrT4\244(\bc"
+	.ascii	"\n!\203L\315\020m:\003\026@0@H,\226)\273\252\017\023\300\304"
+	.ascii	"L\213D\271.F\214\031"
+	.string	"\231\021\021\221\024\224\244\250Ph\fV\207Fc\210\276_\225\351\364}\346\321\2209eK\322\033\207,(`\337.<_a\363/\224\332IT_\204}\217\213\275\330\034\246YF\212Rwx\360\343\305\007\353M\017]\021\031\331\255\310R\223\006NU\233x2\026D\022j\365E,\267!sF\323Z\t1\240\006_\235\\\006\006\276\025\343\270\357\026\264\344k\370\212^C\252j\255\312-\301<\354A\277\306?[K\214\333D\305\304\207\030,<\202\337Ib\t\034v\203k\025cg\021\001UN\306#\037\304\221\202\026\363c\2403\365\031\235\334\177\345\212$\342\215\245\016\331>|G\310\334\370\322o('W\036\023\252p<\375\200\242\272\264R*\230\322d\376s\343\243e7>\300\315\024w\237\321\025x\207O,\332\371\234\003$p\310\314[\314<\343u\213\252\237\305\216\001\357\232\332\306\313\300\367\021Q\347\344\312h\244"
+	.string	"\315p\345|r\bz.\240"
+	.string	"/\205\246\264b\024\215\364\017(\037R\022Al\343\371p\026i\353\224\261\310\245\334B`\35606\356\273`#\321\210ee\341I\216\245\354\223\344\376\276e"
+	.string	"$0\255v6c\245k\253\202J\020\344V\340C\302\360k-\233\2642\231\b\"\363\376X\206\205@\246P3\201=\210\251L\257\301\334y\357\376L\177\370Gn;\351u\2657\212\340Wp\212\270@\013P\240\331O\304G\021\314\3666\313tl\fCP\365P*\202 \252\256\226O\340\212O\0069\004\253\034Q#`\177\002\276d\r\026\261\367^\353\2611\f)\357\334\225\256\327\242&r\221\257\006\260\242\343\317O\373\217\217\016\365g\332NE\206\004{~AvInc\362NE\273\350D\201\236\271h\215\350\016Q\307\203\006\241\256J\217^\224\030`O\304$t\374\235\354W\\\375r%\336\273S$#\001\314\361\303\200o"
+	.ascii	"\254\0174\356/Q\200\343_\216\273AG\374td(\333@\361\327\"\005"
+	.ascii	"P\017wF\252\323\030\275\325\006\264a.G\002\276y\\\002\013\252"
+	.ascii	"^e\b\350\316y\303\234e|\302\343\022\355\364\2416\013s\300\315"
+	.ascii	"+\222\021o&TbI\026100,bH\266\005w:\333\377\2712\006\240\r%\335"
+	.ascii	"\fU\260^\355.0\267H\201\320(\226\005 *i\233D\201\321\212Z\265"
+	.ascii	"\267\"\250\215fO\273_\301e\351a\244\205X\007\364\271\230\263"
+	.ascii	"\376\025\030s9M\260s\303\030_\207\224R\377\211\376)]2y5iK\326"
+	.ascii	"\203\316\335\360.\214\252lY\263y\035\226\022\241_y\2100\265\372"
+	.ascii	"\235Z\225fFl\016\225}\231\267\235\316\266\317w\214+\236\205\024"
+	.ascii	"\247(rY]\365\360n\202\030\017\004\362S\301\342Xuf\021\2670\017"
+	.ascii	"\005\352\210\003\351\004\275\303\332\374\177:\326\b\003K\363"
+	.ascii	"!\025}\312\230\251}\333\022'0\336\3431\317\225`\001YL-\254\354"
+	.ascii	"\304uD6\302_\021b\300\303\334\027C\230\314=_d\r\273\325H\374"
+	.ascii	"\001\374\240\253\tE\020\265x\221\025\r\374\265-S\222\371\253"
+	.ascii	"\232\035\275\031n\361E\374r\216)\005:\355\237\333sZ\236i\326"
+	.ascii	"\377\016\t\365\265\005^\031\210\035\251\tj\245\226\035\306Md"
+	.ascii	"\222\323\211\246\205I\247\016\211\362\026\374\fzcot.tR\277\320"
+	.ascii	"^KY\352X>-o\002\347\\\nBY\362\320\344 \226\027\363\022\313\357"
+	.ascii	"\376\025.\371\221\036\255\320\375\276k1\277\\\213\351ZRW\"C-"
+	.ascii	"#\017\212IN\214\241g\t\267\236\366#~\377\343\002D\305\003\237"
+	.ascii	"\f\346\024\244\366`\335C\017\0265\215\266v?\366\266\351v\272"
+	.ascii	"\247e\002\020R<\357\255\227*B\230\307l\265\307\364X\026\303\340"
+	.ascii	"\217>\020\027\3540E8D\030-\267^\013\0363\226M?T\330(U\232\310"
+	.ascii	"\320I\036I\037\243\223\353v\004Q\345\352\366\037P3\f\212\367"
+	.ascii	"\0336\220\377\342\034\353NQ\003\034\236(\034\367 w\271\234\310"
+	.ascii	"$5V\327\303\330\013:JQ\313C\355c\025\251\002\b\331\351a\221\202"
+	.ascii	"A\371d\226\223\371qY\263HI\363\032\345\215\200\017\375\3024\312"
+	.ascii	"4=\3403\342,\027\254\240\004{\023\306b\326\220\252&\n46x\242"
+	.ascii	"lT\233\210FE#\036i\230R\332\203#\260\327y%\226\264Q\2469\037"
+	.ascii	"\335\313<@\013k\330\313\313g\t\373\t\245\233=\2401cey\342\321"
+	.ascii	"\b5\275\365\210\313\037(`\024\210\375\245Cw\f\265\232\207c\n"
+	.ascii	".\273\023\232\2511\255\306\025\036\2641\001\322\247+\274\trr"
+	.ascii	"C\370\007|,d\363\322\032\331\364;LRA\353\315\214\314\371\321"
+	.ascii	"d\214\234\021\353\244\267\002\017\371\313\037\tA\317\353\246"
+	.ascii	"}'\370\343\304\377\243\007\016\235\021\226r\305W\001\225\353"
+	.ascii	"\255\263A\300'\200T\2237\035\211<\017\027\231D\316\013;\333E"
+	.ascii	"\374z\333\316x\312\204\206\"\2030\247\367\323\364\330\034S\001"
+	.ascii	"\213 \376 ]J\221w;\214\242\337\013^\274|\037dpX\003Z\344\332"
+	.ascii	"\355\336eD@\226\353~Q\264\030\233s\260n"
+	.string	"\005Sd\357e\221\177%\013^}\323Q\273\224\234A2\230X>\366\306\342\307\313\334\254\317\r\036\313_c,\234}\301\031\205\327\265\331v\217p\273\026&NO"
+	.ascii	" r6HX\313\217?M \277B\276.(\f\006\344 \030\203\256(\251d\271"
+	.ascii	")\332V\314+\340d\\\345\263^\032@<\350|\324\\M\273\225ldp\341"
+	.ascii	"\022\350\326\035\305\251\317\214-\304\026\024\032F\027\243}\022"
+	.ascii	"\023\007Q\233~\251&P\275P\351k,rc\372\032\225\203.L\031u\024"
+	.ascii	"\033\005P)\247\235\374v\033\275{\227y\223Z\305v\215\254TC\376"
+	.ascii	"\321\262\fs"
+	.string	"\376\307\2260\240\267\330>D\220(\205\006\006\203)\004\341|;b\207F\276X\027\361l\353@\241\343~\305\373\215)\223SK\266\373\210\243\001\200@\002\222\006\223\357\273\204\251\236-\371\005\003\275pqP\245\313\216#a\225y\300@\022\350+cy\021w\033o\221R\226\2505+ur \020\377(1\223\330)]RO9\n\177UO\373A\233$\301\r?\300Dy{\357\016Z\314\230I\243\253\323I+\374J\240\255`x\307\"n3|8\333-Y?\b\353\341\355r]\366N\362u\202\270\0037\237ZC\013r\321\203\233=0\316\364\311x\221\002Yy\320\b\260\006Tu\346\270\221\203\340Mw\263\340\270\343\356k\252\200\360\240o\030\311\361.\003\276\262#\217\001q\222\257\371\267\312\\\t\217>\351\0025T\323h\006Es\225 e\202-[)'\211q&C\217\367\026~\364\217\231\212\004\244\335,h\257%"
+	.string	"4?\0206\261b\310\023\346n&\261{5\201\225?\306Z\303\236\253[\301\324\022]\275\324a\310\220\330\267\340\"aj%\347#1\253\315r\350\335I\177/\355\330\332\312\004\357\233]\210kc\267\260\366\300\242K<R\364D\373\231]]\225\036:5\027W\352\301\352\"\247G\334\253\273\001\326\025\025\ba\244\224\240\344?\260\352\220c\246U\315\273K\373Bb3\244Q\261\025\207\377\310'\270[uY\301\201e\036\25683\211\346h_\217\335c\210\2012\235va\005\246\334\277>"
+	.ascii	">@ U\264\031\365\t\331\264'@R\214x\316\0329\365a\301\005\333"
+	.ascii	"\300Tm\326=\364\0274\247mN\3261\037^i\351\001\376\375&8\326|"
+	.ascii	"\n\277-c\2112\300m\232|\330\375\035\356\233\332Ksf\032\361w\247"
+	.ascii	"\266%\275q\301F\300h;\223z$\377\347\374i\315\351\027\256\030"
+	.ascii	"\230q\330\032vo\321\033~7\355\303\016\342\246'\211\341B1\013"
+	.ascii	"T{\"M\241\357\177\202\232\226\016\340qA\375K\317\370\257\375"
+	.ascii	"=0\212\274\311W\364\024S\224Gn\035\035\207\317\233\336\326?\207"
+	.ascii	"\302\277\331\003\034\357\335\331\316\376.\004b\374\377pn\334"
+	.ascii	"\006\237\330\251\221\357\320b\277\310k\\z\262\376%\343\377C\327"
+	.ascii	"?\365\360\210\264{\336lc\344E\370\n\204\306*g\032*Y\3019\016"
+	.ascii	"\357\017\377\\A\177\2521)\310\007\345\257\333s\336\257\005\234"
+	.ascii	"\206\245O>`\3543Eg\236\\\271\251UTz\235\360\003\201\034\373\030"
+	.ascii	"r\321W\003\363N\213\230>\\\371\257\303\364\323;\200\207\217l"
+	.ascii	" \346\247\200mr[2\260\353z\366\002\302\001\240\315\344\026UO"
+	.ascii	"\336`D\263+"
+	.text
+	.section	.gnu.lto_.symtab.2a3eceff3bdf6009,"e",@progbits
+	.string	"tcpTotalRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"tcpTotalTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"isTcpTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"tcpRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"tcpIsStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"tcpDataOut"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"tcpWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"tcpDataIn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"dyad_listenEx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"dyad_addListener"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"dyad_setNoDelay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"dyad_newStream"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"dyad_setTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"dyad_close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"dyad_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2a3eceff3bdf6009,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,252 @@
+	.file	"timer_common.c"
+	.section	.gnu.lto_.profile.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\003"
+	.string	"\317\253\250\341\002"
+	.string	"\001\265\230\240\355\006"
+	.string	"\002\267\335\335\337\n"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"(\265/\375 /\345"
+	.string	""
+	.string	"\200#"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\001\003\003\002\002"
+	.string	"\004"
+	.string	".ev\004T\002\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"(\265/\375 /=\001"
+	.string	"\370#"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\003\001"
+	.string	"\002\001"
+	.string	"\002\002\002\002\001\001"
+	.string	""
+	.string	"\002\003"
+	.string	"\002\002"
+	.string	"\002"
+	.string	",\303o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"(\265/\375 2\315"
+	.string	""
+	.string	"h&"
+	.string	"\003"
+	.string	"\001\002"
+	.string	"\001\003\002\002\002"
+	.string	"\004"
+	.ascii	"/F\300,\004d\275\001,"
+	.text
+	.section	.gnu.lto_.lto.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_timerGetByTag.7.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"(\265/\375 \376\035\007"
+	.string	"\222\21525Po\322\030 n\203\2400\025fK\362\026\035\024(\201\223"
+	.string	"\321\213\243\342h\b~\200\265\205{\316\030A}\2667\313\240"
+	.string	"\006\353\004\035\314\002T\2671H\334[\246\025\036\211\210Q[\235O\314\262hM\310+\303B\020$\257\013LR\300\017\346\311\240%A\260sp\264\270$\f\305(!g\256n\225A\306\323\370)r/\344\025`\037\310\273\b\323iF\001f\267\243\206fM\224\013\311\257=\347\177\356\033\0344E\301\370\355~\274\264\354\316\205\0316J\375\253\211\236ho\005s\244$\2601\342P9\355N\370T\202J\251\215\016TJ=\021\335\324m\253\246(B\tK\214\314\nI\244."
+	.string	"bww#RI\177\372'\374\017\277G\b"
+	.ascii	"2\003\202\341\243\302b\025\220k8\007\213\001\331!\342\353\232"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_timerAllocate.8.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"]\t"
+	.string	"V\321A=0\345(\035\200\213\307\326\231\207\2175\204e\344\225\315\206bYp\275<\320c\2724\372\017$#^\333\356\242\r\200(\222}\3514\200\342=P\324\313\224u$\200\266\332i\261m\262IJ\001/"
+	.string	"2"
+	.string	"/"
+	.string	"\006\037-\220\327\200\335p:<\002\347\262\363\003\316e<9x\f\364\377z\266\202\"@\265\352860\261\273\306T+\326\035o{\301v\205\355\232\251"
+	.string	")\022\031f?\274\313\367\227S\366Y\017\222\220\210\316%(s\304\354\007\210\357.\016\307\335\021\033\231\335\260\301\016\235K\333>\313[>\203\ta\213\025%J\353\364\204\250\203\034\020*\246\3540\205E\023\373\331\356\256c\211}\327\377H@\003\200!fW\244"
+	.string	"\201\275\2213*\266?\333c\303\230\376\331\033\333\310\243\330\264j\242\244\255\026\324\315;Q\211!\262\240\234\264\026\362h\327Q\355\242n\035W\232\244\272ipu4=N\324M\255\222fH\3014c\2533\r"
+	.ascii	"2\003\202\341\243\302r\025\020\\Sr&@P\"\214p\204\020\224\232"
+	.ascii	"\007'\n\021\2321\t\223\f"
+	.text
+	.section	.gnu.lto_timerioTagGetByUsage.9.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\365\007"
+	.string	"R\21788@o\323\001X\340\311\006 \037R\327\357\315\377{\363\r\241\214wf\320\226V_#\201\205\177\215\315\336v\235\360o\030\036\340\034\031\335\240\330\320$@`\364G\275\244\355\224\002\023\231\207\323\344\347z`\310>\227\027\2211\306\341\272m\3530\007\232m\032hz4\223\320\250gr\332\265M\214z\223C\340\016\"\243\023\324utj\352\036\2646\026\224\310\256\241H\225\354W\273\273\2466\354\330\220qj1H\331\035\275\270\354\212D1\331\376l\215\355*\276R<`E,\341\002\346\3221\332\017\271\310\367\221\ngv5TNv\353\201\0210\227\233\017X\227\325\005\254K\333NP\370\f\276v\214\254\022\310E\311i\267N\212\343\340#\350\237\344\325\207\207IH\n=\002tv\3271$a\334\324m\027\330\356\3306\005\t"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\036\026\307\b\367\032\240"
+	.ascii	"\306\230\256I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\007\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\b\177\005\t\177\006"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"(\265/\375`\213\006]("
+	.string	"jIL\020H\200\334\321pM\005\354\372oA,\034F?!\004\"\215\227\3548\201\263\017%\361\225C\311\031\236\351\t[#\223\313\226\360\306x\270\377\302Ka\230\326\214\321\037\255\356\1778\204Z\264M\3130\206\343\301\374\241\270\331\261\311\226)\332"
+	.string	"\351"
+	.string	"\367"
+	.string	"ON\335\005\372\355.v\263\334\315\356f\273\333fD\276\3354p\255\262X\354\236\361Sl$\013\305\251\373dv\341:\266\313\244\233\203\202\265T\266\212\227\345\366\311me\227I\031\325%k\325O\335\315g\252\362\370\302\354D\233p\326I\204\352\307\327\211~C\023\246N\033\"m\326\234\350+0V"
+	.ascii	"\260v\212He+\276\342*V\362s\022^\036\275r{\331\375\352\324\204"
+	.ascii	"1\302\266N\024\210}R\224{\322\263Pzc\241\224\2150\025W!`$w@\364"
+	.ascii	"\032{\325T\335\357\r\215\021\226\343\307\211~\201\332#l\242\237"
+	.ascii	"\352\031A\312i\214 \275\371yI\372\363\221\377Hi~\236\372?\366"
+	.ascii	"\377\312\377*\377\263\3763\377c\375G\362\337\366\377\353?\232"
+	.ascii	"\226\226\226\366\037\305\317\032\376\033 \001M%E\204\234\250"
+	.ascii	"\224\3676\305J\224\257(\265\212\243\260\327\333\375\203\206\261"
+	.ascii	"\351\022;\252\177\331'U\321\370\375\017 %3\363\201\343D\317C"
+	.ascii	"\365\347\237\266\320\330\335.n\3366\016s\3167\314B\277\016\327"
+	.ascii	"8\250k\277\225u\267\320QF\005\262%\254q\242\377\201zH7\313\323"
+	.ascii	"o\033\333\245\024\333*\021;\362\274\0355\240\2278\272}\245\216"
+	.ascii	"\250\313\236\37567Q\3528\242}]c\373\272,\256\211.\333\375\036"
+	.ascii	"q-S\310r\273\224:\266K\367\310\323\304f{)\214R\211\356\261\005"
+	.ascii	"s\217\270v)<\266D\251#\017\224\216\344WkvU\203\263\264\304\206"
+	.ascii	"*\"\205F\\\263}\335.\353f\246S\033\203\272\221\256\261L(\203"
+	.ascii	"\271\206M\250\241"
+	.string	"\226\320\345\267\273\t\024\207I\267\211\3156\210\333\035d\030\242\213\020\330\267\331;\270\311\342@v\374\356\260o\267\260%\215\274\350B\323\375\236a3\214\206\3130\032W\361\031{\235\3070\231\377\274\335\304\356V\360\003\340+\231\005-\007\375\311C\345\037\356\021\023\206\267\220\300\220r\242\f\006\347i\312\353hC\375r\206\232Jq\322P\177\306P\177B\251g\262O\372s\250\276\311>)\216{\322f\223\307N\245\r+\007\221171]ZH\261\363\330\213\003\204\206X\324\211r\026\326\272\3010\256A\206\261b\205\257\360\214\256i\321\301B\315\220\035\025N`X\302\316Wj]\2227\250N\224\301\370\315\351\301\305f\313\211\362\027/\251\225\311\260bs\242Gc&7I3_\266\232\352\331\t?9o}\213\2530P\267\262\207d\302\240\2536Y^hz\006Rh\227\305\303\005\327\271\312\357\200\210\251\344tSu\367\201"
+	.string	"cf\336\256\223\312\317P\270\213\247\324\332'\267\231\335/\317N\017\301\300@\260ID\260\351\227\202X)\254\"N \3516d@\302Y\352\005kI\273`Mi\365\371v!x6\246\246"
+	.string	"\002\326\340\216\367SR\212\020\364\237\210\0258\024\374\375\200C8A&\335\n\334\225\370"
+	.string	"\334a\270%\355\220NH\b\256\027t\316\353\001W\337\232\244\036B\321\202\"#\023\266\033\03558j\220\336\350(\227;*\312\251/\312\325V]\322N\311\302\232\264c\362\200\013\352\214\202\276^\223m\325\001W_\211\016+\017\330\364cZ\201\267\240.i\207\364\353\331\236\313M"
+	.ascii	"\362\300\341\202\312c\340\373--\375x:\340\272\324\013\0161\001"
+	.ascii	"W\022=\340\207!_o\2674\304\0032\r1H\240&M*\3642\204\354D\245"
+	.ascii	"\274\304\0330k\3343e\\\230\311\016\213\353\341\030\225\222\265"
+	.ascii	"\2301\223\332\253\264-IVm\371s|\306d\254U\2632\252YI\216<\370"
+	.ascii	"sg\354\205\305\0309\031\001\254HRd\fw\375\2713\356\022q\250\221"
+	.ascii	" f\0304\206\320\220\314\004Q\320&9\200\002\021\252\253y\021\200"
+	.ascii	"\265\241L&MKRj\337\275\247IC\355\n\2307\222\030\324@7\327\367"
+	.ascii	"5\216\367\370\306\310\3633{\353\032?\374\"\344\217\351r\037J"
+	.ascii	"\254p\200\240\214\353\246\3665a.\302\\&\331o\370\t\214 \373v"
+	.ascii	"\367\304\373\236h\016H\332 \322\247?{\222E\270\214\331`\005["
+	.ascii	"P\203\302\213\347RQ\352a\212V\272\266\362\b\204\240: \\!~H\317"
+	.ascii	"\367\320\374\305XD\024\221\362\374\007\342O\227\353\322h\235"
+	.ascii	"\"\262\210\202\204\323\231\275\360]\254E\3705\327<\274\325\332"
+	.ascii	"X<#@\b\330R\205@\354\na\233\234U@J\231\fC\022\200\272tg\223."
+	.ascii	"\245*\365w\317\b\271\374\247yy\373\032\306(\354\331\232\324\210"
+	.ascii	"\210m\345k\210|\321\bl\016\200\017\322\342\n\241\302\316\346"
+	.ascii	"\257\313\370\035\342\017"
+	.text
+	.section	.gnu.lto_.symtab.f1b4fd3b6fbdb53f,"e",@progbits
+	.string	"timerGetByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.string	"timerAllocate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336"
+	.string	""
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f1b4fd3b6fbdb53f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
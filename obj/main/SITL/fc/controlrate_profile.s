@@ -0,0 +1,526 @@
+	.file	"controlrate_profile.c"
+	.section	.gnu.lto_.profile.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375 b\255\002"
+	.string	"t\004V"
+	.string	"\n"
+	.string	"\307\320\355\211\006"
+	.string	"\001\370\347\370\324\006\002\357\305\235\365\b"
+	.string	"\003\240\342\234\212\n\004\235\205\271\212\n\004\002"
+	.string	"\002\001\002\002\002\002\006\007\200\242\234\020\006\b\273\305\341\276\004"
+	.string	"\t\367\365\365\272\002\n\240\342\234\212\n"
+	.string	"\004"
+	.ascii	";\023\334le8E\331@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375 ]\325\001"
+	.string	"D\002Q"
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\003\001"
+	.string	""
+	.string	"\001\002\002\001\001\004"
+	.string	"\001\007\001"
+	.string	"\001\b\002\001\002\001\001"
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"6\303\250\212\364\313% #\317\r)V\333,h\003X"
+	.text
+	.section	.gnu.lto_.inline.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\205\005"
+	.string	"\362\311\035$\2207\351\177\365;~\306n=p\273\273\022\035\224\025y\257\270\215\335\317\306\363\356\356\024l,Rkd\023\271S\377P?TWs417|Pv\367QA*\347\366\317\334\243`\352\r\331\035\024\254\341~R\023\231\tx\201\260\177\021\033\037\221\231\323\367\177\365\256\037aE2s\271\177\377P\353\317\301\377^\250\231\231\312Kk\"a(\230\376\025\326\242r4\232g_ \027"
+	.string	"\251\020S\210\001\002i\325d\314u\2002\200\005\346\272\231\250O\205k\ty\223\b\254\004D\260K\r\002W\205\327u\005\214\246\","
+	.ascii	"\354\n\301\263\2412N\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375 \260\335\002"
+	.string	"\262\204\016\027\300\245\320\001?X\275\351\037\374\\\376\377\277-1\323\310&{\313\224\002Z?"
+	.string	"\207\320\231\360d%\253\300o\026\305\026h\265Ao\320V@\023\255\315\341s\2544\254\344\035\034\004\f"
+	.string	"BH"
+	.ascii	"\366\240\260!\326\345\241e\254b\2029@\201%\205b\227O\021\222"
+	.ascii	"Y\360\006\332"
+	.text
+	.section	.gnu.lto_.pureconst.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\230\004\004\230\004\007\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375 sM\002"
+	.string	"\324\002_"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\005"
+	.string	"\001\274\006"
+	.string	"\260\204\200\370\267\004\002\002\004\001\002\b\001\005"
+	.string	"\001\002\005\001"
+	.string	""
+	.string	""
+	.string	"\007\002\b\0071cO313"
+	.string	"\013"
+	.ascii	"\270\001\020\256\347\306O{s.J1\222i\257f\0164\013\007\243\f\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.lto.bba02f88cab73407,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_controlRateProfiles_Registry.25.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375 \252\335\004"
+	.string	"\244\bl"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\203\254\250\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\314\030us\326\007uq"
+	.string	"\005\001\006'\001\250\035\001\006\214\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/fc/controlrate_profile.c"
+	.string	"\005"
+	.ascii	"0e(\025<\314\242S\024y\003(\002"
+	.text
+	.section	.gnu.lto_pgResetFn_controlRateProfiles.26.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375`\204\001\355\017"
+	.string	"f_mF\360\260(\035z\337\343\03284U\236%'\365J\020\321^\225\265*\276\034;\005\267\351\034\232\264\215\332\261V\213\r`\322\367\245\037v\326\265\237\214\303\344a\334\311\201*&\230upu\334674\363\266O\366\226;\245X"
+	.string	"V"
+	.string	"["
+	.string	"^\360\371tx\021\367\371\371"
+	.ascii	"\356\323\240=\243\243$@\215\311\255\306\356v\352\301\334ex\313"
+	.ascii	"\b~J\215\240O{|\331V\237\022\224\222\342E\300\253D2\220\021\243"
+	.ascii	"\335\366\210\362bE)S\271\336vQ\214e3\363Ry\3644\330]G\327+\345"
+	.ascii	"\346n{\3046\004\373.\001\n\223\341\240\341\304\n\263A\237\375"
+	.ascii	"\236\327n\371h\325"
+	.string	"\350\250\321\007\240'&1\242\027\273\033vl,\214\251\"D\214\257\331\277=\364m\016}\332//\001\276f\032\271&@Z\\\340\354\256\307\247\037|>\r\310\207l?\332o\271\013\370\031\206s\354\302rP\354\206\n\002\267\035\001\215Mk\345\023\017\363\303\374D\252c\305\207\335\326]\276\314g*\310\203\370\364\205\024w\327\247\237\342>U\355\021\013\361.\027`\321\241\245+G\365\250*\030\2435\202\300\335\202\273F}K\004+\356X\352\365\267K\331J\254f\023s\203$\356\250\222\270\241\241\243\312b\207\253\030\247O8\231P\236\203\222j\024\201\303\244\217R\310\311\344}\"\022J\252\321\027\342}*\224G\352H\246\016u\032Q\350H_\252\3738`O\244\364u*\317\373\272P\270W\230O;\210lspH\2245\225\305\236\032\005\251\336D\217KE\261M\303I\375\254v\223!\352\\\356\356J'\270T\220\006\033"
+	.string	"\2423\341L\213\201\032\3224xK[f\277,\201\025\021\263j4\301\342f\332\203i\223k\206\020\342\260\025\005\212\313Ah?Uk"
+	.string	"\021\253\3566\253V"
+	.ascii	"aqCD\331\353\252\321Y\025\006P\224M\327|\002"
+	.text
+	.section	.gnu.lto_loadControlRateProfile.27.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"\025\013"
+	.string	"6\024KA \247j:\227\b\360'\303\210\340\\\b\212c\275|\343\335%q\001N\026\f4\376\261 \b"
+	.string	"\202\264\302\247\264.6\232\205&<\267tF \001!DB\323-\2301\024\006 \t.\243\2657\331;\2453"
+	.string	"6"
+	.string	">"
+	.string	"%\312\356r\2576\311\346^\317\271d/8\271\332\013\020Q\257\007\273\333Q\223\227>K\376]\267\210)\216\317\004\212\335\365\024S\0377\275m\006\333\026\366'\002\242y\361\325\027m\257\247\020$e\312h\2323\233<MZb_[\252\262\265i\215N\3179\375m\013I\260\200`\327c\006ae\365\300\211\355\373+\037IW\261%\025\256;4(O\n`\016\306\023\030U\003+q\343\345W\031\254vWb\300_\030\232\315f{\325\350\307?\214\264b-\030\310\351\244Z\f\025\301\235\007"
+	.string	"\025v;\"|\362"
+	.string	"4|\326\253A\001\316\360.\037G\223\001\303\317\305\027\302\204\0340\fy@\257\3632\235G\203\351t^\b\352.\r\006?_\330\205@0\3548\322tm\251\312\025\"2\023=Y\243~\201\303F>\313\030\317\013\024"
+	.string	"\020)\2022\253\t\274\030n5\370E\330:J\210\005l\\\232\to3\020\030\330\020rye<\244j\320\205<\004ceP&^\232"
+	.ascii	"\347\334B\230O"
+	.text
+	.section	.gnu.lto_changeControlRateProfile.28.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375`\264\001\375\017"
+	.string	"\226]iF\360\220*\035:F\330\373d^\337\315|\214\277a$\275\036+\215\352\310\360\225~.\337\324\005\016l<\212V\245i\356\3268\300\206\003\3271\350\324\340f\270\030\367l\312s\016\031l.\36618\274N\350\223M\266L)P"
+	.string	"S"
+	.string	"Z"
+	.ascii	"\356|\276c[\325^\320\340t\027\223\345\256\210\233\314nL\201\031"
+	.ascii	"p>}\262_<\266\262\237\241\234\240\220\261\273\237\034\361\323"
+	.ascii	";\251'\177\343\2611\262P\357>\\\006`\255\272\003\273\373\327"
+	.ascii	"\225\003K\245\272\361\330]\353\310\362p\317\333\216`;\264_\023"
+	.ascii	"\336'\200\024[K\210\224\346twQR\266\346M\236J\002\035hf,V:\303"
+	.ascii	"\216\251T\266\354w+UlO\315Q\365f\252\273\273\374\312\341\301"
+	.ascii	"Z\024\200\331E\311\321X\334\234!a\373\376\313g&?\341\r\026\315"
+	.ascii	"\304\356>v\231]r\230)\304\224\330&\016\336\347eO\020\203\246"
+	.ascii	"\242\251\325\314.C\232\267\217\243\337>\023\306\003\333c@ \b"
+	.ascii	"\210\367\311\221\237}\272\\\310p\225\250\201\350\344Fv\266\223"
+	.ascii	"\032\2279\344*B\234\335U\255\223\227\275s\245\320Z`)\315u\262"
+	.ascii	"%\355\220\2470\031X\331]\007>\3550#>\313\247C\022\375H\022\326"
+	.ascii	"\260\001\314 \2220\001,}*\f0\250\003\024\t}\204\342\310\003\226"
+	.ascii	">\242H(\226D!\350\003}|\242\320g\344\003\211\244\257\003\201"
+	.ascii	"\303\021(~\2450\024\277N,\365n\245\212!\274\340RRe\001j[\270"
+	.ascii	"\240\037\375\3279h/\234J\242\314\221\376\314W\220|\026c\360\350"
+	.ascii	"GO$ P\202a\314\314\003\200\211\316`-\312\2042\323\331\0306\263"
+	.ascii	"\262\322\324u\227\311\2131\262e`\257u\221c\234\320\\\317x\254"
+	.ascii	"\271[VX*Q0\324\212\335\241+\215\205\303\355\006k\242\321\204"
+	.ascii	"\016\036\263\n\030\006D\212\365\023\263\035\225\213\003\274\357"
+	.ascii	"\243\024\326\330\256P\006"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.29.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375`0\001E\r"
+	.string	"\306\330XB"
+	.string	"\2216\035\300\030\221\254\3679n/#\357{\247\207d\tK\364\267\202\246\035\261\201^\200\034\330\326\274\203#E\023\202\307\202\306\226\224\3355k\235b\224~\031L9\256;\203\304\034Ak\2667\331R\246\024E"
+	.string	"A"
+	.string	"D"
+	.string	" ;\306K#\366+$\274\0242v\367R\021\007\235\202\232 \277\322dF_\350\024\306\303!\354h1y\004H!fX\337H\352\306G\002;v\367*\317\f_\227Yiv\3279\372:\334\361\266!\330\236`\237\023pw\327J\2623\235y\312_\035\345\217\231\206\232VM\247\246oA\023/\003Xv7\234j\254\211Zqb\373\226\235\3629\200\355\\\224h\220i\037H"
+	.string	":\312\307\272\013\242E\305.\n\003F\2009\345!W\n\265\212\232Q\247\367\"\312\223]8\234^\300J\243\n\320p\222\273\033R5\261\215!\252JX\2011\2224\234zU\245X\274\017/\275\322\324"
+	.string	".\324?1\352\365%%,\274\023]\236\354R\227jb?\330\346\341\270\220q:\f\034d\334\346\201\002\316\303\3410\346\221\205\200|h\233H\204\214\333l!\332\306u4\354\302>\256\016\310\206\302\205m\236\313\243\2005\221l\2738M\333.\253$:\\%yA\013\223H;*&t\005\013\371\221\257r\r\211\006\033"
+	.ascii	">\353\341\211\265\365\0348\023\272\223bT\030*\365{\271\320CP"
+	.ascii	"\213\275\210\007\267\200\264\240\r@!>\302\004\223\031\316\232"
+	.ascii	"\203\005\3270E\030\016\224\bF\3503Fp\227\200\001\253\032Y3\344"
+	.ascii	"v\025="
+	.text
+	.section	.gnu.lto__reset_template_45.0.31.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375 \177\255\003"
+	.string	"\262\206\031%\200K\322\0013\303\342\366}|00C`m\n[1\273\315\306QeBaI\303Y"
+	.string	"\245d\n\361\236d'\031\357\275\325v9\347V\213\275\242\370\262\030\303\270j\234q\254y\274\201\\E$W\321$=\020\006"
+	.string	"\355\2040\333\331\300\316\251-S\210\251\303\244\020M\322s\342\004v\n87vR\020\333\331A\333D\004"
+	.ascii	")bU\005\240\312-\003\200\003"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.part.0.36.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375`f\002\025\022"
+	.string	"\326\340tH\340\322&\035\323X\034aC\371q\201G\353\332i\202\300\307\206\350ur\035:e\341\262\304\222-\227j2f\fc9/\336\220\246\235\314\027\025\264\006\b\313w\250\224q\032\033Nr\236\35089}\337P/\332 \233\310\235RZ"
+	.string	"d"
+	.string	"a"
+	.ascii	"{\303C\005\004\225\017r\212\352u\240\232\217\233\243c\225v\212"
+	.ascii	"\nv\240\032\353n\t\246\244\335\241\005\237VA}\332\377\261\375"
+	.ascii	"\3221\314\006\362q\266\247\241\300!\272\355\256\367\251'\016"
+	.ascii	"\273J\016\346\237v\022\331N\354\n`\347\303e\311\271\221\225\335"
+	.ascii	"5\n\304=o[e\273\203-G\004\235\264\252\264\274\320\177\222\001"
+	.ascii	"'N\2739E\234\326\304TZ\201\324\232q\253\304\211\306\313\256\225"
+	.ascii	"\033\016\032\270#\036#\030\267\3150\236\330\366g\374\210\306"
+	.ascii	"\256\003\343\314C\212\204\r\247\305mw\364>=\336@\367\211:\201"
+	.ascii	"\316\367\215^\233\371\220\013\314f|\242\027\321|\310*\261%\032"
+	.ascii	"\351\323^v*%4\2165\027\0209Z\023iV\263\305\343`M\333l\251\323"
+	.ascii	"\327>]\370\340t\352iW\020[\242\375\210\361T\364\033-Ej\222a\270"
+	.ascii	"\r\226\332\232v\227A\215+Y\360S|\032\006\224\227\201\335\247"
+	.ascii	"\352\213\316\t\031r\373\021!#\304Uj\307\202\307\206\363d#\213"
+	.ascii	"H\365\261r\347vw\255=\366\210t\247\322\363A?\027\256\260\n]&"
+	.ascii	"\027\276\226\230\007\021>\221EB\003\321\325b\342\025\312\367"
+	.ascii	"\302r\001C\231\t\237\310\022\276\200\241\030\003\256\274\225"
+	.ascii	"\213\027\303b\201\361V\241\313CI`P\346\013=\021\004C/e[\236["
+	.ascii	"\355\261\003\035;l\364\306\252\352c;\200Dp3u\252\235\332\037"
+	.ascii	"\005y\231O;\252\307\213$\"A6h\314\257=1 \260\002\231$\326\001"
+	.ascii	"<H\340\327\303c\335\275\201\236\035\030\207cx\243\034=\033\273"
+	.ascii	" \343\356U-\250\255@\332;\343z\006\267fp\301`\375O\021\3318\333"
+	.ascii	"[\231\335u4`n\343\261{\f\r\007\254\001\256\362\335\210\026\021"
+	.ascii	"\366\"`\277;o\234\250pz\330\301^\342\304%\246\026\240I F\312"
+	.ascii	"B\003\300\366\342\344\224N\277\266\217\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\005\006"
+	.string	"D\t\036\001"
+	.string	""
+	.string	""
+	.string	"\002\032\177\t\210\214\225\311"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\037\006\200\204\001"
+	.string	""
+	.string	"\003\002$\177\n\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\026\013\201"
+	.string	"\002\033\177\f\272\200 \r\025\016\034\177\017\002\035\177\020\031\021\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\027\022\001\036\177\023\377\037"
+	.string	""
+	.string	"\200\200\200\001!\177\024\003"
+	.string	"\013\372\363\352\266\003\001\204\001\003\002\013\244\001\003\007\344\001\003\b\002\344\377\220\375"
+	.string	"\001\202\006"
+	.string	"\020"
+	.ascii	"D\313D\036\006\345S\004\370LAF0<\277Q\f\031\202\260f8\b\240\003"
+	.ascii	"8\274T\340#\f\030\234fT\370'\204*\003"
+	.text
+	.section	.gnu.lto_.refs.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\004"
+	.string	"\002\002\002\003\002"
+	.string	"\002\003\004"
+	.string	"\003\004"
+	.string	"\005\001"
+	.string	"\002\003\003"
+	.string	"\001\006\004"
+	.string	"\004\007\001\005\002"
+	.string	""
+	.string	"\005\003"
+	.string	"\002\003\005"
+	.string	"\001\006\006"
+	.string	"\003\t\002\003\002\n\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.bba02f88cab73407,"e",@progbits
+	.string	"(\265/\375`M\027mq"
+	.string	"\352\275\310)T@PBJ\007\212\207\013l\361H!B\231\320\035}\361\251\360\332\256N#b\246\325\304D\247\1779\241D\351(\304G]\376o`\337(\200\2341s\005\361\023\273\370\200\376\020J>'\320\007\312\222\317D\325,\345\324>\237G\030\233\227\017\205te\355'D\312\0249\002\210\002\240\002S\344TTM=Y\227\251\347\302p\344x\311\263f\210\033\031:\345\035\330\r\177\231\3407\3476\234v\235\261y\233-\004\216\330W\247\3570\365lb\207\316\315\261\211\035\267\031:\307\221ia\222\353\264\235\250\177\2061\320.G\r\273y\b\203\343\306\244\323;\200\303\032\226-q9\260\032\233\3415&\303o\334\306h\230\215\317p\031N\303_\354\306a\316bx\314\271y\366\202\206\206K\027\267\033\276\264\245\201a\253b\305M\230\330\033\236\362\017Q\221{\002\205\301v\320{w\300\341b\321"
+	.string	"\013v\343'\203\361S)A\2233o\3676\317W\376!7\036c-#\226\3565\352( k\214\031Z\334\275\027\005\212 \024\273'[C\342\006H\031\311@;\237fR\317:\250\3471\352\271\213\332#\246\006\035QK\260\017\365\004G\251g-?\327\300X\370\f\205{\217\367\336"
+	.string	"v\310#\023I\247l\003g9\237\261\331\345\263\007\226\367\032\371\214G\356^#\017\363\001\314\007\244M\260\212T\331\245g'\225\311\206\316e?\273\244\262yyP\265\251\262\033\235\352\224\324\025\f\264\333\361\317\316\005\253^\255\247\376\215\201v\357@}\034\003\355\270\311Q\370\213\004;\337"
+	.string	"\213\243E)\327\353\336&\017\2108L\342\274\351\364\026\250g)/\300xY\034"
+	.string	"\365Lb\307sLb\367V{\234\374\334\305^$P\344\214\345\r\273\267\351\303\323\304\001\225\325\351\233\f\264S\371g\027\304@x\376.\372\331\347\347\236\237C\374\f\364\363\316\317"
+	.string	"\374\314\363\363\017\372_\356g\235\377:\177\203\360\363P\217\237y\234\367\367\372\363\013\253\021\335\304\001\374\f\301\311T\221\360\177\304\317:p\374\274@\362\377\t\317\371\273\203\237\203?\263?\257\360\263\360g\025~F\372y\370s+\365\263\t?\033\375\f\214\372\337\363\367\231\237\241~~\372\271\205\237\223~n\340g\030?S\360\363\004?G\360\263\213\237\035\370Y\201\237Q\374|\342g\023?\007\375w\376<\300\317\002\374O\363\337\353?\320\177\264\377\352\334\334\334\334\337A\177\312\374}\226\002\177\323\320JZi\246\244\251\354\324CSK'&C\037\221\241\215\354\356\345\346R*y\225\311\023C\206\264\021\265\030\224$\211e\206\022\260\031\336F\3221ob\030\353\264\2134\227\2073nhfD\260t`\033\353\324\210z\235\r\265\267R\032^\322t2\324\277\203"
+	.ascii	"\321\311b\033\253\241\3233\023n\253\267\217\376\321@*\220\201"
+	.ascii	"\324!\371\362v\2236RP5\217(\2216;\\\251"
+	.string	"Q\337W\275\343\315\343<:Km^)\266\262,\323$\356*\225'>8\345H\203\203\365\316:\032\235;B\327\344u\345H\247g\323L]\032\255\247$\263\007[\rib\242\372 \343\bW\246\323\257^6\322\303\023!Ef\350\364i\021\365\357\177w\215\311{/\r]\363&\227t\316:\006\301(#\360?\275\350\037Tto\021,n\215zd\314X\365\022\367\272\347\275Gf\261\002\346\324\221I\205t2o\361H\244\350\223\274\314\"\322y\257\317=\036\213\030,\257\017\322y\247\256\2140S|\233\314\342=.\257\317=^c\t\344\2219\205t\032\247|\220N\346\324u2o\317=\032\223N\307\233\364\271Nf\232\353\\N\365 \235\313)\244\223\251\344\035\3100iS\3168,'\356\201<\336((+c\262\347\211l.\257\332\275\034\306t\223\b\334k\265L\252\031\251\230l\351\031\265t\305\270\344\346\275W"
+	.ascii	"\250%\254\345=>\221H\226\367\"Y2\272P\017\024\233\317\033\204"
+	.ascii	"\237\305,\253;\203\351\336\001\240\356-\362}\336{\213\367^^\322"
+	.ascii	"\252y\257\216\036$\027\024\324\275\312 \250kU,c\272\267\303\326"
+	.ascii	"\310\246\220N\254\345P\331\024'\327mj\026\231\353\2521\223\252"
+	.ascii	"\263\030\345\316\200S\271\246j\250a\2436\275t\244\244\204,u\344"
+	.ascii	"\200\341B\311\352\034\255\334\025!\303\205J\247TA9Qga\224\340"
+	.ascii	"\240\276o\321\214\027\031`\270\034\350\246/q:\212\347\326\336"
+	.ascii	":\252\237\032\212\237\312\024\t\333\033\233\216b\035\030\016"
+	.ascii	"?\265R\2573o,\230\372hL\343\272\367vT/\365q\247\330l\265\252"
+	.ascii	"\270%\177\323\350\251\256\3218Z\252ot\262m\360WG5\362\355\324"
+	.ascii	"1\274\203t5\244X9\t\221\276\341x\r\237\351l\335\250\001\246S"
+	.ascii	"\356\032z\317\340\0213\306\206H\247G\271T~2\320n\004j\245\036"
+	.ascii	"\235R\217:\251G\215j\037\3776\362\r\f\306\026\311\021U\314|\275"
+	.ascii	"\r\315\0216\263'\235\2424\320\032\327\342\022\263\341"
+	.string	"n\177K\362\304!\211[\233B\237xQ]o~$\227\344x\201c\343D*+\245\241\215\025\\\247(\024\n\325],%\315\2175'T'33eb\352wx\303\331\001}B\305\350\334\242\224+\305\263\302\004+K\334E*O\354<\2711}\240\307\243OGch\200\305\333\202?\246L\351\024u:\007\201\233\202lB\2213\260]\211\263\245\242L\f\\\271\351!'C+\314\220$\2356\272\364\266\2062Kr\325)j\274\033\210+Q\264\254\320\"\232\206%f\251\323\216\323s\374u4\364~\307\254I\f\rK=\f|\264]\277y\313\37599f;|0\253\334\3749\274*e\252\270:\275\212C\275*\325\246M/\341\240\347^\037<\310\320,\271\037[\322\250`o\033:K\237\361W\2035\033\024\251\2745(x\272V)r\244Tm5u\272\246\3113\346P\246\213\327\226\356\302\366\346\345LZ?i"
+	.string	"\303^\377\020Zs\361Zk-m\035\246\327\370\251\354\271G,qim\375E\315\255\341ZM\2775[\243\3514\374\325m\215\303;K\237=\250\333\372\006\226\343\247V\005^fx\326tQ\241\352I\267\274m\304\022\222\203'h\314\364\031\376\352\265\0075\357\r[k1\255\306Oe\roq\310\342\356m\242\020"
+	.ascii	"\005\b5c\324\252vj9\354\\i\002\201\353\264\313\360\224Th2\234"
+	.ascii	"dT6K\312\336\366a\313\026V\024\365\274.\365<\"j\203Q\311\274"
+	.ascii	"]\245i\251\347e\251\347]\251\347)\325\363\222\352yO]\232\213"
+	.ascii	"\316\351eM\032\027\006k1_f,uz^\223Z\342\304X\227\265\331\237"
+	.ascii	"\303\323\204\354\207\2259\365M\366\301\026\030+\235\246\374\263"
+	.ascii	"]\327\360\306\362\3474Z\021.(7\352\333J_\371sv\324\210\210E\251"
+	.ascii	"benM\216N[Le\332\2151\341\341\n\013\217\252N\337b\177\207q\225"
+	.ascii	"\027\346\340\264\351\024\004\377\354z\312\320\233\312\2074-o"
+	.ascii	"P:\325\331Q\211\022\245\277\324\373\006\242G\024\031Z\312\373"
+	.ascii	"\253\313\254I\305`D\240|5\224\316\021\324\2744>\210=\271\244"
+	.ascii	"P\233\306\252\\\261\341\344\374\325NZ\bK\271\305\017b\2205h\304"
+	.ascii	"\335\253L\301\313bC\034U\247\337\335&M\272K-\006\315\320O6N\256"
+	.ascii	"\316\346\335\025\006\t\221*f\222\360W'\351%9\310{\247R\234\271"
+	.ascii	"Ie\n\235\255\033\202@\351\264\227\004\304\365\b\030C\310"
+	.ascii	"\206p$"
+	.string	"\024^\320\323\265I\036\fp#\025?V\350\027\243(\b$\022\327\237\220\r\341'B\013\f\002{\202@\266%\n\255DIG\277 P\210%&\t\2118:J\n\006\205A^\333\333\265 \f\362b\370\326\243Ti\370CZ\221vJC!\214\241P\321\360\347\027L\372\020\214\321:bO\247\355\005\213\206\272`\321\0205j\213\202\353\321n}\001HL\211\304\225%\"\362\361\224\206\302_\312\266C\224h\r\026\001\217|<\242\225\230\224\376V\"\357l\257h\250\002\204\022\333\022\201E\253\b#\326\242\240\317\350\027\324\006W\226M\372\t\360C\344\023\036\211P\362\261\254\005#\364\f\020\261BE\313\372\206*`(\r\205?\022m\210\377\210\275\240\006\"\024\rI\374\007d\327\340Z\244\376\201\026\f\264p\341\002\357.^\254x\261bw\027/\206\206^\264\030R\337b\b]\241\202\305\003GC\244\265\355\265+qe{"
+	.string	"\2647R`E\362}\360C$\376X\236p\350B\006?vG\324\255C\245\366\247\r\256?v\035\366\216\332V\310\032\265\"\332^\213!\265\005\"\001\217z\036n\244\202\200\013\207++\324\n\205\254\320\007b\017\006\322\332\022\225\210;.\254D\301\016\210\200C\036\026\200\355\317\347\263\022\t\221zEI)\254D\036\210?`K\004\266\276\226\330S\201\350ky\214~-\260\205\021\210\302\020Z\204"
+	.ascii	"\244\302Ox\364cW\026\204\275\244\341\017\304\212\004$a\375\371"
+	.ascii	"\330\r\202 \260k\013\302\241\b\326g\364K\331\025\030\003\330"
+	.ascii	"\006W\242\016\210X\2370\005\236\027\214<X\211F\273\265\365\265"
+	.ascii	"#\004\205\300\326\307&\025\001c\004\205\277\020k\353\023a}\001"
+	.ascii	"\210\004l\207 \260\353Q\022\321j\364#\002\265=\027m\020\230\304"
+	.ascii	"\373\320\020\214\022%|\260\201\372S\261\036\001c\b\331aom}\354"
+	.ascii	"\221\220m\203\302\237\320/\206P\020\350C\022\372\261D!\025\t"
+	.ascii	"\024\005\201H\254\005*\374\200\355\b\353Q\n\276\340\352s,,\024"
+	.ascii	"HN\361\336b\317]\"\203\205,\353(\020\364\007\007I\313R\202\376"
+	.ascii	"@}\354\260\262\212\\8\252\311\023\034r\244\230F\340\242\236\240"
+	.ascii	"u\212.\033\345\201\3668\272Dw\350\034\233\3502\345\003v\230\017"
+	.ascii	"\320\235\r1~\355\322\3478]u\245b9\264\260\254Z\b\223\031hc\235"
+	.ascii	"\242JT\211\352\310)\206\220s\253\212\213\273J\033'~4\307Q\035"
+	.ascii	"\315\334\331RB\025v\226\336(\353\372\202F\375Q\034G\251x\324"
+	.ascii	"\340\350Q\325)j\003\275\241\204+\201\311\250\2410\207\2243#2"
+	.ascii	"\"\"2\222$I\007!\005\204 \346\250t\365\022\340\0059\322!\210"
+	.ascii	"DdDF\n\222Ja\230\003\261B\017\202\270\007P\205l\004>4\271c\020"
+	.ascii	"\\_\244t\177+\013V%\346:U\215\337p\364\230\373#\357\211i\254"
+	.ascii	"\004\357!\03620\317\001\214\022\376\353D\371L3\346W_0\375\033"
+	.ascii	"\366\235De\b\335e\261\234\t\n2\200\337DYu*\322\266\234\324/\245"
+	.ascii	"\255RCTy\365\256=\313\n\357\360\354\\\372>jF\341U\033\215^\202"
+	.ascii	"\302\213\362\310M\250\240\274aC\322@!Y\210=\202\331[{\325\n\266"
+	.ascii	"\311\006F\3044\322\251\262\310}\361\004b\026 \224\201\276Q\243"
+	.ascii	"\275\314\222O\216\002\234H\3712\373\345=\256\331G\217\257\361"
+	.ascii	"sH\016\252\364Xe\177%\304d8.2\202\"\371m\275\326^jAa\027\274"
+	.ascii	"\036.\226\263(D@J\312`%\tA\364\264L\335\207\252\223\2058\270"
+	.ascii	"\036\22319\233\024(\2062\235"
+	.string	"\001\351gi\322viv\214}\227\261\357\306\236\247\254\327t\034\347O\356\362\351\203t\210[\224$X\342>\251\267\341Wz=\3620\3139\356\327\312X\302\371\276\023\277\003\262\345}\212-\360\360\300X\004\366\":\001\363\310\332G\316.\331!nAe\363\2427\\\2315\025\317\314aF\372\017\310,M\362+\312<\r\213\352\26526\301\030=q?\3064\312\007\001'N\261\330\"\334L\222\n\257\f]\215\231I%Y\304<h\336X\031\324\3762b\207\t\373\254\026x\007P+\347\006\240\2659\013E'\2106b\207.\256/A\237CY\264\376\254\262<\264\362\367,\374]\270\221-\304\277W\242W?\312\0012\231\365\317\307J\036h\0044\325\030\362\242f\360\334\233lI#y\224\264CXo|3v\261\314\247\033\331T\246\334{p\205\243\373\262N\026\223n1\341\260\265\017CF\346\377n\017Y\005\327\270\313"
+	.ascii	"yp\037\244\353+{\301\306$\353j7P\351\030\"b\016\032\324pf\\\220"
+	.ascii	"\300\215\"X\016\273\374\023\237TTS\366:\2166\001Hy\360\200 \277"
+	.ascii	"\241\326\267(I\271\352\347\334_\343\335\304@'=L\372\3163\264"
+	.ascii	"\263\024\003z\257T\230\330yr\354\004{<\033\205\323\220\334q\006"
+	.ascii	"t\271FK\264\n\tV\304i\202^\363\030\266\241\316\203h\003I`\234"
+	.ascii	"\223\366\333\256\020\365\361h4\311=V\026\304\364\034\251.)\337"
+	.ascii	"\246\316\233\313\247.\371?\206\226a\002\031\362\304GY\235\324"
+	.ascii	"\207\360\367w2i5N\307\205\b?\b\202T\021\340mX\354\246)\004\337"
+	.ascii	"<\327\204\366\360\220\272?2\034\"\006\357daE\255\303\241\314"
+	.ascii	"`<\217\246\374\243\235\016<\373\326X\230'7\026-\270\276\n\034"
+	.ascii	"\b!\231\207\034\233{p\360p\"QC=\244\243[\340\203\205\323\257"
+	.ascii	"_D\355T\327&c\221ij,M0\272\357b\031C\355\324e\206\313\325\262"
+	.ascii	"\340{\357\352N\204-\022!\301\201\245\221\346\245\273\354_\366"
+	.ascii	"P\370\"\371$\377\225\277J\177U\257\203,\274\036f\366K\307\247"
+	.ascii	"\262BP\266\201\312\\xN\316?9\2370\341\351\0033\263\036\367\241"
+	.ascii	"\274.\301OR \r\366\222\020\316\321\365O?\265Z\275\374\032\256"
+	.ascii	"q\004_\013l\277,}^z\354\362\203\334\226\335\320\272\250m\246"
+	.ascii	"\344\005\370\244\373\004\263eL\320#\363\341\377]\263qy\335\305"
+	.ascii	"\300\353a\300bx^;o\177\361\034\216\"\276C.\314(\3567\356\313"
+	.ascii	"\b\363`\363\200\256\327\335\363\357B\324"
+	.text
+	.section	.gnu.lto_.symtab.bba02f88cab73407,"e",@progbits
+	.string	"pgResetFn_controlRateProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"controlRateProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"controlRateProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bba02f88cab73407,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
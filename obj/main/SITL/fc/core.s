@@ -0,0 +1,2871 @@
+	.file	"core.c"
+	.section	.gnu.lto_.profile.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`*\002\r\016"
+	.string	"\024\022\036\003"
+	.string	"-"
+	.string	"\230\270\347\374\001\034\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\005\002\004\002\004"
+	.string	"\001\352\263\360\321\b\005\006\007\b\t\253\306\274\244\016"
+	.string	"\n\241\200\317\222\017"
+	.string	"\013\204\322\270\207\006\004\f\342\265\374\323\016\b\006\002\006\002\002\007\020\335\277\353\342\016\020\b\002\b\002\002\007\021\240\342\234\212\n\023\231\272\344\363\004\n\001\002\t\026\356\222\260\204\003\n\001\002\013\030\032\357\355\233\200\001\002\002\f\002\f\033\250\200\234\374\004"
+	.string	"\034\267\226\235\323\002\007\035\237\267\201\266\003\024\r\002\r\001\002\013\016\036\037 #\233\304\365\321\002\002$\214\233\312\236\002\002%\234\274\257\275\t\f\b\002\t&'\222\306\204\351\0016\017\002\017\001\r\002\r)+,\311\202\342\200\017\013-\376\336\373\325\016.\376\224\203\267\013/\212\323\354\257\n0\274\305\371\207\005\n1\212\312\215\322\016\b\002\b23\307\315\333\241\t\n46\276\276\271\247\f7\277\270\330\226\r8\314\345\244\232\005"
+	.string	"9\320\274\373\324\r:\354\206\342\366\006\002;\342\201\222\246\004<"
+	.ascii	"N\250\201%r(\300[PR)\f\007P\002Rl\352<\020HJ\204J\323\032\274"
+	.ascii	"\024\261\202\352\372\235\2649\035Q;\216\277B\334\272\003\252"
+	.ascii	"\003\3519\255\303\240\311\021\243\254\245qr\006h\272\022+\315"
+	.ascii	"-r\325\270\034\006\370\255\320\232\221\002k\300\305\332\325\335"
+	.ascii	"\237y\367\253\233\237\374\267\254\325\211v\007x$rh\247[P\004"
+	.ascii	"\001~x9\2632|\224\025\340n\327{A\003\205\251d\fY\361\334\347"
+	.ascii	"\\h\243r\001z\237\322j(\334w\033Qg\223\274\023\016f\352d~!\230"
+	.ascii	"mq\301\261\375\316\016"
+	.text
+	.section	.gnu.lto_.ipa_sra.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\f\001\275\005"
+	.string	"\342\305\017\023\360\222\r\007\252\350\335\341?\t\036\021\346\223Z%\310\235R\356c:fC\031/\246b&\020\373\007\3274\314\302$\354`W\260.\360\200j\251\245\b\372\331u\364FF\027}%\231\310:\271\f9 p\2029g\3341\017u!@\007p \375\006\201a\030E\004ah\263;\243\303\250\035l\304v\025\232\326\033\006\033H\340@\340\234@\337\004\264HB\361\240D<\2510\004A\232p\r\232pk\001\304\375`\304\320"
+	.string	"\233u\222\033[>p#\021\231\341\367f\205y"
+	.string	"#\336\256\371\261\025G\002\3404s\001j"
+	.ascii	"\360\304\311\246m\235\001\342$\326B\343\007R\334!"
+	.text
+	.section	.gnu.lto_.inline.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`T\b%\031"
+	.string	"T\032H\t"
+	.string	"\036"
+	.string	""
+	.string	"+\232\263\346\315\003g\001"
+	.string	""
+	.string	"\002D\244\341\365\273\003f"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	"\002\003\f"
+	.string	""
+	.string	""
+	.string	"\001\001\t"
+	.string	"'\355\243\375\310\003h \271\275\364\201\002\201\002\013\n"
+	.string	"%\226\321\254\211\034\260\305\200\243\003d\013"
+	.string	"\r\315\231\263\312\fe\001\n\f"
+	.string	"\023\330\256\334\235\022\310\217\364\331\003\002\220N"
+	.string	"\220N\020"
+	.string	"\035\350\356\224\375\002\"\237\233\253\255\200\023"
+	.string	"\027\206\276\341\262\002\034\344\207\372\334\002\001\026"
+	.string	"\252\001\213\325\373\267\002k\202\001\301\367\250\242\002h"
+	.string	""
+	.string	"\006\202\001"
+	.string	"\001\032\004\013\334\236\212\332\200\001"
+	.string	""
+	.string	"\033"
+	.string	"\005\200\200\200\240\003f"
+	.string	""
+	.string	"~\034\300\002c"
+	.string	"\035"
+	.string	".\351\325\215\216\003i\003"
+	.string	""
+	.string	"\0024\241\327\266\330\002g#"
+	.string	"\004\003d$"
+	.string	"\b\263\346\314\251\002\b\200\201%\004\031\373\371\246\315\036\337\365\321\310\201"
+	.string	"'\004\322\001\274\320\250\235\002k\340\001\342\203\270\245\003\203\220N"
+	.string	""
+	.string	"\217,"
+	.string	"$\243\360\233\316(\356\301\314\241\003\201\001\001\001"
+	.string	""
+	.string	"-"
+	.string	"\020\201\200\200\270\024."
+	.string	"\r\200\200\200\320\260\002g/"
+	.string	"\016\200\200\200\340\026\200\200\200\3000\004%\355\314\354\274\002"
+	.string	"n\002\020\006_\001\300\226\261\020"
+	.string	""
+	.string	""
+	.string	"\004\034\272\275\224\254\004\217\377\303\364\003b"
+	.string	"\b"
+	.string	"\004\205\360\254\312\002a\004"
+	.string	"\004\220N\004\004"
+	.string	"\0011"
+	.string	"\t\267\275\224\264\n\212\256\217\225\2003\330\003\022\200\200\200\2306"
+	.string	"\n7"
+	.string	"\t\200\200\200\220\f8\220N"
+	.string	"9"
+	.string	"\035\355\372\235\322\002\030\330\256\334\315"
+	.string	":;\200\002e\002<"
+	.string	"\200\270\250!\256\222`\246\244\311\316\034`\24215V\365\022"
+	.string	"b\221\204\b!F\t#\fB\205\251Q\217e7\026\335\240\211\346\302^\332[Y\233\"t)\346\356.\3452\261b\322\260WF\212W\361xj\237\240E\252f\314\260c\360\002\244\022 \303\334u\360\311\3021\\\344\243\013L\357:\177\344\n\024V\210\230\036<\033\330'\320\007\tS*\205I_\rF\366N\036w\317\241GW\213\203@}\357\302\r\343\210E\342k]\323\313\365\251\237e2[\002\213\230\335\002\037\326\343\356\033\330\303y\373\240\3779\035\340\200\257\246\317\253\234oT\265\360\223|\317g\334\232$:\001p\307M\323\211%\023%EQ\253\352]\033M\241"
+	.ascii	"\330\375\267\360\363\341\007\035\311\016\350\214\327\005\326"
+	.ascii	"|y*\372@\270Y\200\225\302\002\031\314\303\3530b\346\206\372\304"
+	.ascii	"Hm\221xZ\343\222\227m\202b\373\353\275z\n\236%\332\320\362C\333"
+	.ascii	"\263Y\210\276\217\355\031\303\251!\376\231#\322Rf\242\213\226"
+	.ascii	"O\025\027\254v\217 \013\357=it\f\nS\217\035$\332g\323N\f>5\235"
+	.ascii	"\245\317\200\027x9\177\270\304\311\037\234\230\340\311\276\221"
+	.ascii	"n\035\235Nt\226@\342>aZ\007\264\0220T\370\254\263\216D6\016\244"
+	.ascii	"#c\375\263}\2039\260[6\2274\345\346\034f\372\r79\233\021\225"
+	.ascii	"\256\213\020\216\271\217~\232\031\366\253\242\240\f"
+	.text
+	.section	.gnu.lto_.jmpfuncs.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\341\006\315\023"
+	.string	"F\026I=0\251(\035\300\300\026\254\322~4Mj\276Hw\344Qq\032\302\301\300@+\243\300\026\005\005\005\320Z\262\210=:\240!\b\022\bAEE\314\016\037\200\267\366\365=n&!Qr\333\224R2"
+	.string	"="
+	.string	"6"
+	.string	"\377\346\230\266\260\275t]\327\271\333k\267\277\302\373\266\245-t\345\001\264\374\253\312'\3761\314\332e\377\357\225,\264~\234\345\307\271\226\265\374\333>T\001\025U\247\223\351,G\236\266\016\225\n\226\345\337\320\02620\2041\306r\234e\371\344\030\243I\032\215\265\300\262\024`0\3262\301\347\203"
+	.ascii	"\302\003\277\001\307\b\013\030B\223\336#\340\002\210\321\244"
+	.ascii	"\f\247\223\213J\221\3743\004\207\322\251\013H\371\017\345?\300"
+	.ascii	"\377G\2511\301\007\031\t\234\350fQ\332\242\274k\362\355e\270"
+	.ascii	"\335\313\305#\371\327n\276Ql\211\266\021-D\253mA\332\217\326"
+	.ascii	"\243\231\314;8\332\215V\2430\243\030v`7p/Z\213\266\242\026\013"
+	.ascii	"\005h\373\330\223\265'\357\020P9\034gy\214\363\177M\360uI\bQ"
+	.ascii	"(\246\222\251\344\b\376\013\200\303\250!i65\222\024\024"
+	.string	"\n\303\030\320\002\021*\0327\022\200\021\252\034\347\210\"\016\t\t\211R'{\034O\032\"\225aRt(h\323bvc\354\213\271\223\001\031k\310\333\032\346O95\t\321\251\226\n\201<\n\210\224\235cn\203\332)\223\345v\207\020J|Sy\242h\233\360\272S\237PPq\020/\254\261\037\376U\240\316\035N\301\257\333\r\257xQ\370\367\204?Dv'vm\270\263L\203EG\024K\314d\246\266+\374\023\205~\262\232\020\311\273 \344\371.\305\347\013\034OA\261rk\022\260d24\221y/\360\316\347V\302$\207\333\336\177\333l\343\243*\025\325}H\266I\025%\370i\b\341\035\3610\346\203<\300\005O\306H0\270\370\315'\331\210*/\274\211H\b\244\\\r\366s\356\202\351`\247\260\321(%\250\373t\313\371\r\204\376\242\204\021\330\033~\342u\024\344\325,\362\230|\n\202j\177\037\032`\321\213\t\034"
+	.string	"\326\226r\006\003\325\245\305=4\020\2406\204\034tL(um\026\300\002\233L\300T\316h/\350\347~\257\375\201C\253\277\304|<\3731g\255\212\352*\2105?\200\035\261]\233\214@\353a\025\353\351fPI`\025"
+	.ascii	"e"
+	.text
+	.section	.gnu.lto_.pureconst.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375 _e\002"
+	.string	"\362\005\022\033\200\3310\0063J3\260\f\221k\340\037\021\374\300\347u\3534\215\261\236M\310J\006\316\360\026\236\302\023\216\360\016\236\301\013N\360\201'\360\002\016\360\313-\257\234\362\311#\207\374q\307\033g|q\305\023G\374p\223\314\254\021"
+	.text
+	.section	.gnu.lto_.ipa_modref.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\245\005"
+	.ascii	"\022\007\025\037\200K\322\03030\00330\00330\375\370\02696\f\260"
+	.ascii	"\251cm9\214\033\367\0165\266L\0015g\216\271\264|\225sj\224\211"
+	.ascii	"d$\344\321\301\250e4\240\247\037^ <\265O4\347\2506xQ\253\250"
+	.ascii	"K\324\"\326\004\003\007@\265P]\252MU\317p\233* \200\002)3\363"
+	.ascii	"v\316CLG\222/\201\211\243\355\351\211`\330\307\354\314\275Z\311"
+	.ascii	"\253\300\030\342z\013\373\026x\017M\005\304\312\356\251\203\026"
+	.ascii	"\302[\0049nA+\004\257>\013\004\302 \0354\240@\2058\310\260\331"
+	.ascii	"\273\213|/\364\032\017<\230fx|\370\240)!\315U\026\201\006Q\250"
+	.ascii	"!"
+	.text
+	.section	.gnu.lto_.lto.465044fd387aff2c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_isCalibrating.119.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`g\002\215\020"
+	.string	"6\335fD\020q\233\016\033\302q\305G~q\361\003\005O\233'\2213\217o\017\206\t\373\032\021\2535_\343\242\327.\354\377\373\277~\375<Y\n\025\276\001\024\001"
+	.string	"@D\226\202T\035@B\267\242R\265\355FK\332\226R\246W"
+	.string	"M"
+	.string	"R"
+	.ascii	"\227\264\252\310\333\271J\221x\0221\243\373<\232\231\245,\032"
+	.ascii	"\260\001\223Ccx\245\3701r\351\364\344qX\354\344\221\256\030\036"
+	.ascii	"I\300\311\333\260R?\035\324\022U\242\223\215\363\013aX\326\276"
+	.ascii	"P\004\351n=\241\213\362\201v\245Hw\177\273/\203\036\200\376\227"
+	.ascii	"\361"
+	.string	"\177\300\277\013\002\235\262\206\"\245B\354\371A\317\262\351W\016\3030<\257\374\337kv?\277\317\276\307\276\277\276\227\337W\337\307\275\006\310^b\n\300\350\036\205<:U\271\030\361\337\344\237O\240\300\344\035\005C\214\344I'R\241\243\033\334\030\204v433,\027k\212\327\335\227\214\2225\024\211U\351n\311&]\02608b\254\212\227\305A\305ZR\001\261G\025\354\356*2\311F\326P)\335\335\221M/\272\274-\330\376\234\204\325n\231@GJ\201\224\337\261\2245\032n\244\240\021\332\035\267V\265\202\365[\270\260\032\337\204\214p\270\315\266!\331 \2240x\260m8\023\266\220\217s\021F8\033\005\216\343l\023l\215\315+\337y@\327B\240\223Q\376k\030\344\303\240O\326\260\266\020\365\370lh\305\214\226p\351<\314\214\227\245A\306Z\372\212\0175Pd\330\205\261\2062\241/\3020\304.\336\226\2228 "
+	.ascii	"\003!)\323\001\20624\307\214WqI20\354\f\333iY\233\227\272\357"
+	.ascii	"f\355w*\320N\226\261\371\326\233\335\242\255i\027\027\004c\323"
+	.ascii	"\366\236\354\324\226{\017r\335z\36565\243\260\307\316\2431\035"
+	.ascii	"\023\347a\037\330\017T\276\206 \215\204\334JnX~\267\230\334\212"
+	.ascii	"\025f\035sS\356h\f\221\242\031\332\314\316(\322\225o\237c\320"
+	.ascii	"F\357\306&\3002"
+	.text
+	.section	.gnu.lto_resetArmingDisabled.120.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375 \341\025\006"
+	.string	"\362\312)3`k\323\001Pe7\204\241!Q\273\201$\275\201\330\271\365\031u\232\305Z\220\306\203\343\272\006No\267"
+	.string	"\220q"
+	.string	"\035\230\003\300\302\211Bj\337F\376\336)\005\236PT\351\2243#\005"
+	.string	"0\001rV\002\tIL\007\242*\013(\255\362\311\366\021\273XtT<p\345~\304%\314\371\0166\360\006_\275\361\275=\3368\030\234\247A\301\317\316&\030\025\354;6bv\214T\\P(v\255oc\273f\342\301\366\037Kv\3063\206\275\326\200\240y\273+\343\302\245C\311?\304!\3255\035:\226\3355\254\256\204;~b\333\n\t"
+	.ascii	"3\001\0038\343(\276\3055\221,\004\3742\004\270tc\266\266\353"
+	.ascii	"\264"
+	.text
+	.section	.gnu.lto_accNeedsCalibration.121.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`0\002%\021"
+	.string	"\346\335nI\360\222(\035\260\262X\353\351C\334\031\230d\262\375\2601,RU\300`+\025KAg\360j\247\254\332\022\r\030\361\217\372\2037|\021\350\245l\323\343h]d$S\004\226\036\243XS%\272\222.1\004\233%d\357-\245L\001^"
+	.string	"S"
+	.string	"["
+	.ascii	"t\312f\321w\264_\003\02394\270\0211\254\375\310\021\0219\034"
+	.ascii	"j\220\340\341\361\340\255\215T\207\316D3\354\270\005T\244>\360"
+	.ascii	"\\\027\326J9\240%\203\003U/\222@\315f\372T%n9r\223\341\003T\225"
+	.ascii	"\244\b\352\304i\307e\030\025\211\271+\251\265\236O\252\230}\310"
+	.ascii	"\376\237\3757\360s\202,\027xO\333;\256\207cF\nw+\365\350\207"
+	.ascii	"\215\270]\377v.\227\313\275[\377\371\336\371\335\371\364\374"
+	.ascii	"y\276<\277\371\033 \245\356\364@\020\253\025\225\013Rm\223\366"
+	.ascii	"\372\337\362\177W\260\240\345\242\205\315\240\272\227\227\t\306"
+	.ascii	"N\255\260\260K\254h\277\217\307\353\002ma5\316\331\240L\306\006"
+	.ascii	"@GgG'\233e\305\202e\203\262\020\266R\217\366\300\213\265\201"
+	.ascii	"v\b\357\236\320?\002\n\357\251{\205\306\3544\031\210\321l\327"
+	.ascii	"6\n\033\r-d\273j\226[\364\370OQ\341=q\20378\033ig\200\334f}\021"
+	.ascii	"\335~`\243\243\304@>\231\227\002\375\003\007\221\230\210!P\b"
+	.ascii	"\202\020J8q\200\022\202D\225\220D\344\241\t&b\270\022\n\211\341"
+	.ascii	"\007\253\333\255\317Z,\366\331\025\321\035\227A\016\0271\034"
+	.ascii	"\2715\3535\314\177\257_\342\322$Yk\255\037\016\315\217\030\237"
+	.ascii	"\256+\254n\b\350\032\224\255\220\265\021\345\241\215a\365\302"
+	.ascii	"\243\r\312Rxh7$o\0060 \340\002\2219\363h\005\354\351\274p\265"
+	.ascii	"\221,`8\364\255\021v?\345\261_\"l\275h\266F\030\346\206,\310"
+	.ascii	"\323\3557\"\354\213.\253\337LQbul\034X\271\361\320\003\230\260"
+	.ascii	"\313\204\360h\013,Fo'\352\333\262Y{\265\325!\305V\t\304\365\225"
+	.ascii	"\0139\365\262\345\226!s'\006\b\231\275\222\021\232<,\346\243"
+	.text
+	.section	.gnu.lto_updateArmingStatus.122.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"-\t"
+	.string	"v\221?9@\305(\035\240n\277\270\"\216\005\347{\210\003\300\2439c\213\225}\273\256m2\337\364\224\362\233\352\270\241S\004\200a!\207a\346\361\231\223\316\320'\311\331\221\355\223M\244L)."
+	.string	"."
+	.string	"/"
+	.string	"\367\034\323\364\370O=\340\003?\307,\023W\fC\312\370\004@\017#h\201\244<\365\034\201\241\314\212\301\356:?P\342\216\267}`{\300vI+/\325\302\276\206a\030ZM\366\323\361\351gG\261\\(\005$\273\2440\300\212\304\020\r\333\277\330c\237|u\332\177\214D\036\256\335\325\364\"?\275Z,u&\213\372\324-#\035&\241|\371\317d\327\250NQ\311\273\352\034\020>\206#:\371\357\321\357d\217W\r\305F\205\252\004\312\320\016\3364\233\216\333\264-AcP@X\320\266\216\243i0\346\0326\235\346\300q\235vY\201\216\255\232\034Q,"
+	.string	"-\220z\330\356.VI\233\363\220\377\254\372\t\016"
+	.ascii	"3\241\335/FV\301\301\025@\265\017RX\304\205\017\341jTxv\031\345"
+	.ascii	"e\bq\351\242j\207\006\246\240"
+	.text
+	.section	.gnu.lto_disarm.123.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`o\002U\024"
+	.string	"\366\246\207J\300\322Q:\322.\f\f\313\024P\211D\240\0327\037(H\206~\"\027\234\036X\0020\306\204\227\216h\272\243\256\366\017S\367A\212\272\222\3507H+\005\322J\305!\310.\020\355Z\236\344l\234\004\017sk\374 do\"wJ\001s"
+	.string	"i"
+	.string	"t"
+	.ascii	"\262\347>X\244\326\023EH\265\356\022\330\200\370\271z\212~\202"
+	.ascii	"/\241\237"
+	.string	"\226\331=\276\303\325\023\375\330\206\200\324ZY\213\342\262\207t\202+e~\250\242\273\310x\233=49\315\371\004WL=[\001\036\023\276\221\233\215\004Q7\020\340\252\326z^\215\\\020\301S\214\037\250\233\rL\335\250\030\257\273\fq\253I\031\252\324Z-\307\233\210[\274\355\016\266\025\330rE*\372%YK\233N\355/>\024\343\373X\206F~\374\364i\350\347w:5\371th\362g\357jr{\354\357\357\367\373yy\354\225&y\356G\255\264\270\322\341JSPz\2564\270\322/1\241\201\243\005F\2557?!\2657\223~\036t\373;\237\027\344A\234\341\210I)tO\265\342\234|\372D\374\374\210\355K\373.\016\024\024XX\350g\270\241\222\223/7@^\350<\013/\302\215\002\336B\355\013\030\344G\007X\032\321\263\331\231Qk\267\316s\245p\265\326\224\251c\247\304\\\337\350G/\r..\364s\225"
+	.string	"H\373\005&?\316%\220\343\353\325vfp\211>\372\220WQ\272\340\236w\260\211\351\206\215DM\376\374!\217\241_z\\\220'\244\265\212\222\354u\027s\b\361\250\221A\374\007\255\231\226\203\031\230\027\207\227\b\fL\246\365\212Q\273P^1\230\213\345\312\300\202qi\275\260\\1\031\026J\312\260\r\257\030k\006\006\213\261Fv\264\203uy\\\241F\217\2665\260\326Z\303\225\264\0314\270\356*\265\235\035Q\225\264\037@@-\355\034\3501\252s{,\277B\305\225-\"\234\311\206\270\013v\344h\226\001\304\002\007\256\320pc\266\204/\255\210\265\326\244\370J\2371\301\367\371t- \200\202\231\271\353\001\303\320s\307\330\216\322\025\273\220\\f,\305#]p\277#\320\002\n?\360\311p\273\b\262\330\225~\265.`c\200\344\344i\375\316\331#1\016\213O\344\0222\374\340\316\363\250\307z\365"
+	.ascii	"d]\264K2s,n\237\360\217\261X\365\rX\250\021\337\225Q\223\377"
+	.ascii	"\212U\205k\246bQ\310\375\365I\213B\001"
+	.text
+	.section	.gnu.lto_tryArm.124.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\367\003\265\032"
+	.string	"\266o\247I\300VQ:d\036\002\315\256"
+	.string	"\207*\345\343T\260\345\021K\235P\302(i\366\f9\220\364\021\275!\327We\261\377zn\367E\272\327\260\3600\021"
+	.string	"\t\007S\254\362\277\374\317M\325P4\235c{T\017\215\326$\356M\244L2\225"
+	.string	"\206"
+	.string	"\225"
+	.string	"/\272\321\212\377V"
+	.ascii	"\220*\275_\255u"
+	.string	"\374\334]\261;~\206\343\316v\237\016\334Q\217\344\351\206\304\245\326\352j\035\237=fT\245D\030:\303\346\331^\245\353y\214\r\016\030\274\217N9\336P\256\006\253\224l\234r48u\032\357bX\340\307F\360N\271]\330\202B\336>\3446C9\036\303\f\345f\274\320\335\230\312\370\234\321\261\370Q\013\016c\274\303\004QK\266\314\350l!\313\007\bw\242\263\013]\215\031\346\246\326\272\214\323\301\370\312|w\311\335}\260\333M\002HH\210\265\332\032\354\215\374\210\316\276\307\347\306N\360q'\350'\367\211\316AAd\257\310\210\306\345.\260\306\355\333}\227eYn\377\354R^\232\346e=\351\273j^\031\312\253\242\274\251\311+\206\274\264yg\310\333\315\313\315\373\001\020\204z<\036PM\005X}J/\225\234L\202\236\364+\355\270/r\244\331\223\226\251e\003V]\006(\362\247\340s\r\210\237\255\263\350gx"
+	.string	"\364\277\003\177\244\342\277\235AQ*v\003P\226\351\302.\355\022\375\274\321\017\350\236\264\364~Zh\\\246\026C\207\023\375\246\246\303\311\024%\261}L~\021\313\222\317~\323\354\0179\002_\031\334\321\270\344&\026>B0)h\323\360\256\206\r|\\\213V\204\220\301\250Z\367\320"
+	.string	"\274?\342\320\241g\r\225\021\235\376\032\312j\231^\276\355jOr%\036\366=\366\303\353E?Y\375\2433\020\357G\257h\027\316\360\202\357\302F\360q\033\323\224\205\264u\317wt\211R\322\355[\022\224\033\004\221+6\356\262\2739\017;1\236\027,C\bX\t\020/\236\234\t#vrtd\257"
+	.string	"\213\303"
+	.string	"&\213\341\270pD\270vr^:.\034\031\217\213\001kc&`2\027\212XL\346\032\201\264\337\320\272\026\326Zk\214\001\246\351\335Y\220\031\021\037\2671\242\350\310U\323\3642\016\313\252\235\306\034e\020\0027\200?c\373V\255\352\343 gE\273\244\3521\307\227\340\256\305\251\336\215 \201\036\267\352\226\330\251\236H\267/5\274K\241\002\037'\366\225~\240\032A\322\001\t\345C\325>\246\323\226Y\240A)B\n\276\177\362U\250Q,E\231R\214\214H0\022TA\222\341\220\002\021\2713\017\020P\347f[h\fbH\r\235-m\265\274\231e`\317\375\366\373.\r7W*H\247\275\241\331\275F\223\201\231\207\341\211\307\307\037\021\034\347\006\303\371\231\246\356\033\366!\272!\332\324\b\207\211"
+	.ascii	"O\217\341FOh$\204z\201\016\214\276\2301u\320\235V\250k\354\227"
+	.ascii	"\264\377,\267\207\373\233\237a\307q|QCe\365\345k\356\317m\363"
+	.ascii	"/\277K\220\275\246`\363\247\005\207\245Ox@\274\242\021\024\371"
+	.ascii	"\263\313\340\277o\275y1>i C\221\006\207\001\300\204\354\035\034"
+	.ascii	"\363\nn\023N;*o\212\205j"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.130.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`E\001\245\f"
+	.string	"FUM?0M\234\016 \b_\t*\017C0f\343\331h\t=\214<`\226\035\025Rr\013\177\350\017c%\376\327\307\207\241\f\306\311\224\007\205\347\245\241\220\236\004\245\f\335\303\217\374\201\271u#[\312\224\0028"
+	.string	"8"
+	.string	"@"
+	.string	"\273\231bx\347\227UE\315\216\177Q"
+	.string	"x_\367\313\362C\364J\002\366E\310\030\340\023]#\037(\022\330\335sxN\370>\231\027ew\235\336W\341~\3346\306v\001\373\246\225\277\261^]%\030\034$p\344\311\016\373\324\245\226\354\307U\013\373\351\370t>}\354\341EJC\023\356R\350\340XTEB\203\355c\356\330)~2\355G\\\b\201Hm:"
+	.string	"\334\020UDD\341\251H\215\372\220\205\020\017R%\340\005\t\034E-\235ce@0"
+	.ascii	"\232H\030\033\367\360\017XX\"\265\221\273\333\2519\3265A\306"
+	.ascii	"\tP\256\260\017\276\003\307\317`\315&\357=\326&\025n\3232MA\206"
+	.ascii	"\261 \270d\032\227\311&\002\2741\250p\231\203m\3432\354\264\217"
+	.ascii	"W\013\037\bQ\036\375\304\013\222\220[,{\301%bB\003\005Z\353\221"
+	.ascii	"v\203L\336\263j\367JK1+ \240\202\241\301\036c\020\200 \\Q\336"
+	.ascii	"e\f\335\235\2604\250\2105\225\367X\031\346\274YAZ\375j\260\200"
+	.ascii	"\235s6f\032dGcs,:\235\213\fgH\367\006\246\204\306\030\334\035"
+	.ascii	"\327R\021\306\r\366\003\364\303mG\370\357\270\303\374\222F\245"
+	.ascii	"\352\372\325\227dg{\343\362\266\213\352\001"
+	.text
+	.section	.gnu.lto_updateInflightCalibrationState.131.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`]\004-\031"
+	.string	"\026j\225K\260\022R:\002\245q\363+@`\242\034VX\206\227\212\326\335\356\256\361\374\340\234l\355\b\007\272\341y\217\244V[\333_J\3278\307Y\361\261\242\f\004$;\320\335\320m,\335#\221\031\374\322\270\246\360\004\373%\237\020B\b\2212\311\205"
+	.string	"p"
+	.string	"\201"
+	.ascii	"2WV5\007i\304\263\273O7f\327\351\303\023\325\344\t\356^H\325"
+	.ascii	"Za"
+	.string	"\235\363\230\207\274\\\255\224\205\236fI\216\3151{\224\327\273=\344\365c\227M\tn\231*&746OMnhj\316\032\301\250\317L\215\b>w\314\2200\361\231\361\261\031\342\345\316\003\223\343\311S\021\220\021\031\024\274\264\327\201\307\264\247\343~\365v\343\200Z\353\201\316\037z9fS\245\326\272\314\353\321|\001|\367#\273K`w$\t}\240\263R\374%%\267H/\357|\271\263x\013\0130\263Yy\222;\205\351\\k\275\365\332\312\267\013\261I\307T\273\017^h\333\357l\206\032\237wr_+O\276I\202V\277\240\017\307W\273\303\0347p\367cm\234]\346\025a^\327y[\347M\317\313:/z\336s\3445I\336\222y\311\221wl\336f^>\357\005\274\252G\352\307\206\250Z\003\272\276\231\r\254\201\036\025\245\f|\245\334\323x\321\312\002\026\226\362\244\271T\374\201*\033\270\027\372\331/'bS"
+	.ascii	"\3363(w\0338\340\363\3166\205L\350\372\326'?$\020d\003\327\354"
+	.ascii	"\261[7\304$\035Sm\331\346\203\023A8k\325\245\354e|\206\204\t"
+	.ascii	"--\345\311\262_\324\021v\217\375]\020\334.\312c\304\316Z\353"
+	.ascii	"\201=\214\017\311\366;'\267\302\313Ky\262\373DLF"
+	.string	"8\276\342\217%\245H\033C\221\321f1X\214\002\354\302K\013\f,F\253\301PFv\206AF\203i\230\315h\260t\210{\343\220U=SO\270\316\2054\020\307\227l\bj\021\204\305_\020\024\216\257z\244Q>~^\rtq2]Ad\"\336\325$\017W\177\210\311\325j\016:Z]@\030\364\013\372Z\267\225I\350\322\322\017T\332@\243#\2419JRP;\254\265\262\322f\247\033\t\322\206\351\240\254\246\331P\300\352>RR\261'\332.'\332\262\251\236\251\247f\250q@e\225RA\321\222\244(\225\016\220\002\031\2613\017\020Xd4b\230\326\323\271\013t\336\213\226\240iv\320`sk\035?\340\313\320\315&at+\360i\312\240\254lJ\313\t\321\002\350\343r\033'\344\r\340\001\001\bC\324\210\235\233\3519L\233w\340\256\326\242Z:\203\304<\230`\362\3261\355sr\022\034F\270\210\b+*"
+	.string	"*\314\315\034e'\223*\216\212{\335\303\346F\253C#5\311\0224\255\306\347\333\273\354\251\241q\217\034\224EK,"
+	.ascii	"\255\024>:\2221{\007\0337Cp!0\230\332L\t\364\356OY\240\376\322"
+	.ascii	"\342\225i\377\232k\f\360\307\240\246\177t\035\360e{\311\340\247"
+	.ascii	"\271\035?\262\342By\\\275\370f\336\037"
+	.text
+	.section	.gnu.lto_calculateThrottlePercent.132.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`=\001=\016"
+	.string	"&\334aD\020\217(\035w\005\220"
+	.string	"\325\352L(+u_\257\330A\277\017 \001\306k\262q\t\035\275"
+	.string	";\252\316\026Z\353\021\374q\222\303\250\266t"
+	.string	""
+	.string	" \002\020\203s\021\354\353P\322\227\005\265\366\177#\204\354-eJ\001N"
+	.string	"D"
+	.string	"R"
+	.string	"\023^+\366Dta\260}\277\303U \347\340\214T\353dw7\2176\210\275y\274\035bo|"
+	.string	"A\210G\001$\210\244\300\310\220\032\t\241bw7%\371\3509\362\237r\006\237\351\345\204\022yf\013v\327yBQ\270\365\266\013\330V`\177%\236_\362h\b\242\374\351\321\027a\217\327WH\255\240\270H\371\262W_\352\005\373pw\327j\301v\332\003\323\035\230\346\300\264\006\24630\255\301t\006\323\030LG\230\2061\2550\235\232\376\005\207\244\004u\023\211\335&_KTL3\227\222\006\250\034\215\n]J&\252P\317]\004H\333\215\220\300W9\313\001GG\007\366\250\372\224G\226T\013E\225\241\350(G\261\230/_\276`\271K`\251\035u\226`\276|\371\232\232,FZ\220\362\365\371\207N\333\335\f\177u\017\001\336\370\2106>4\272\315\303\353:\217\033`\356\003\ny\334\3065\330<84\272\215\013\211\266\017"
+	.string	"{\017@\241\355\303\363B\333fE\272=\212A\322\317\232z\340I\252\365\275\260\f<S-f\3045\232\351U'\340j1\261T`2\212\251F\357R\332p\020\317\250"
+	.string	"\023\245\030"
+	.ascii	"\313iOf@\030V\2637Gf\333\r\255\260\230\232\021\0203t\242\203"
+	.ascii	"\017\213\033\206\3401\201\"\f\032\211I\205\321\226!kT\326>c$"
+	.ascii	"~\317\356\317ebA\205\013w\316\324\316'"
+	.text
+	.section	.gnu.lto_calculateThrottlePercentAbs.133.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\210\001\r\020"
+	.string	"V\036kF\360\2606\035z\016\250\300\203\247\346\255\321uA\210\363\367\314\344\036\246\316\213\203\203\301\030/\005K\b\025\200kq\3138\033\036D\301\001\370\235\035\213lNvU\372:\274\277\214q^}\251\316\354\277\337Z/iR\246\024V"
+	.string	"P"
+	.string	"["
+	.string	" l\3377\361\227\222\243\260\007\213fe\316y\227\217$?a9\202\305\202g\316\371\022$v\211\275\035\273mboF\220\300\304\251\216\n'3\n\204\320\200\002\3033\347\310m\207\247\256)\377-o"
+	.string	"C\254\021W'\327\214\301\234\323*\2560\334{\333\006l/\260\265#)\016\003\342\1778f\t\236^\364\344\261\335\217\3072\260fXnT\332c\217\240.\007\373\327\334\024[S\223\244z$\325\"\251\016I\365&\325 \251\376H\265\226\2513\251\226R\215I\365\205\251\367R\037@\310\203\314\352bk\316\013=7\346\013\354&1:\333\2026\264\317\tI\274\365m\005\270\bU@\234\317\2026\313\tEh+\367\263WN\250\002\256\266wp\231\007\332\234\024\024\370*\276\302\324\235N\362Xf\303\242aq\311d`+W\356\220l\356\026\362Zl\255\241\016\250=\336\275Vq\240\344\370h\227\036\023A\233sz\370\001\376(\211|\214\230<.\344\363\274\257\033\340\256tB}\035\327A\340B@L\036\327\241D\270R"
+	.string	"\177\023N(n\344\373P\3346\252~\315M\361\276\345\027\215\r\252\005M\332\357]\256\331"
+	.ascii	"\305\232\260\306hI\327\n\213\006\214\321\312q\340\242\035\255"
+	.ascii	"5\334\001g\036Z\321\376\345\004np,\264\002! @\002\202 \302n\313"
+	.ascii	"\260' Cs\310\030q\022\3036\334\001#\212\210\t,@`\350D\203E\342"
+	.ascii	"\212\005\007\025^8\020\345K\365h\3473\275_t\333\270\320\332b"
+	.ascii	"q6\263\374\022\026\306\353\233E\246\314WK\370ID\027\221\354f"
+	.ascii	"\253\221d\323\265\310"
+	.text
+	.section	.gnu.lto_processRx.134.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\034\004e\034"
+	.string	"\006\266\273H\240\330M:\220#}\212O\340>A5\177\204\313X\f\272\226\"=\037\322\253\200c\031e\022W;\033"
+	.string	"\361d\373\263\341\320\362q\303\356\261\007/\201\034\321\t1\244\245/\222\352U\276\354\335\240\205~\t\323\264F\310\2262\311\253"
+	.string	"\232"
+	.string	"\246"
+	.ascii	";\222\312\2512\265\326\005\007\367\301\214y\367S7B\364#.\266"
+	.ascii	"\246\326\247![\265\226\r6\301\354\340\316m\341A\372\001\341\301"
+	.ascii	"\335\335\007\020\210\266\350e\017%\234\337\020\244\2532\265\226"
+	.ascii	"\267\346\361\242\323\304\232\231,\004is\321^\364\355N\343\246"
+	.ascii	"\213\b\236d\324x\215\324W\217\211gT"
+	.string	"\201\330\2231\377\352\325\2406\245\037\344\245zK,\243\007\240r\230\241\371\220\350\216\025/\244\233G\360\325k\342\220\306\301\243\027Lg\274\251\002\034Wf\b\360\031Q[\226\035^n\236a\370FfY\205Z\3532\351\223\361\005\360\335\245\332]\016\273\024\fV7\177f\265\326\223\273@+\370\244M\337\374\241\216\230\252\0311\243\336\355\226#w\324\356\373<\317s\033j\367G\376\234\220\327\366\254/N\310{\363\253o\355\345\327fy\305\345\225-o\270\274 \310KC\336\006y\231\362\336\200\316\325\bf\365#\322Z\312\252t\236\251^ \027\220g\375W\177\371W\235\356^\213V\255\312\363E0\223\250\354\255\366XK\273\332.\033\236S\255\305\020\373%\021\3230;\310\273D{$7\227V5D\253\326\205\037U\220Z{\024\312\241\035\243\262\372\304c:\316,YGmQ\bv\t\263\013\016\347\364n\b\021|\022\354"
+	.ascii	"GL[!m\360)RlM\267\216\323\266;y7N\027\350:*2V\275\373Z\257\241"
+	.ascii	"\341\262\304\003\337\344\357\002IRY\302\200\321\216\352\335e"
+	.ascii	"\360(# l\251\265J\330s\035\n\211\275\217\203\333\203\303\221"
+	.ascii	"`n\232\247\314\260\2544?\317Z\3374\2011\fK\314\370\355\nm\272"
+	.ascii	"\326\307:\337\b;*2\362\371\377 qxuG\355\204"
+	.string	"\347\302w\013\223\213\021\217\355~\311\231\344\366>\366\204\017\237<\270\367\t\017\276U,\205\021Y\342\361\271\"?=$8\210'w\302\202\030\304\323#\204\"w!\367\323\2433\001 \210'\367\343\003B(EN\247c\201\013\2608\0079\035\020\356\2063qK\341\323\363s\303\351\202n\016l\013\244\"\247\273\t\001\001\351n\264\222wZ\251(\353\233\237\235\3715\311r\022\276\312\305\206\261\273bo\005^\217;Dk}\242\360\252_\254\212OZk\2554\013\262\246\242\001\336\305\220\341Z`F\274\306\336\255\216S\tUS\345a\363\027\263\213\016\357n\350\300'\303>\225\323\330\273/\227\022\033\273\031\377h\224w\021\346t\357\260\310\230X\214x\314\003N\210W\316\007\036>\271\214\325\324\013D\250q4\"\tS\204\f\tI 2RP\230\016\260\"\231\252\365\020hF\244i\226\003\016\240\307\247B\251[Y\231\024A\n"
+	.ascii	"\205\027\312\200*v-SL\365-\n\313\270*\200\352yYs\266\274\241"
+	.ascii	"\304y$\221\342\253\367\231\215\361\2540~\314\215\034\327~\026"
+	.ascii	")\325t\313`\340m9\257\231]\276\360\300\375lm\316\230\360\217"
+	.ascii	"G\326\313\352\007\346\372\351\206%E\246`\373Y\213%\311-6\247"
+	.ascii	"\t\221Clx\215\274\005)(rbU\243B)#\375\250\372G\304\217\341\350"
+	.ascii	"\230\202 \025"
+	.text
+	.section	.gnu.lto_subTaskPidController.135.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\002\002U\021"
+	.string	"V\"vF\340\322&\035R\r\362\3177\302\310\001\2430(\245T\234J\323\366\020\222\f)Q\332\233\305\364Wcl\337\272\025'\347\254\025\275\206`M\216\324q\n\034\230a\316\343\242\"n\023\3174\377\252\223\t\253Y\2627\2212\245a"
+	.string	"Z"
+	.string	"e"
+	.string	"i\037\305S\264\336s\301\245]\0202h\273\337\211\007\220\016MN\022\017\267\217\304C\267\354Z\tl])<\031j\200\212v\267S\021o=\302M\263\345\337\347%\331\314\365\330\3410\006\313\215\303u3"
+	.string	"+\372`\232\321l\001\214jh\334\347i3{er\nv\327)\233\335\334\334m\273\330N`\347\202y\331\241\257\212\207\327\0068+xx\230\311#\373s\245\352\330\337vw\255!\354\367\374\"\246\177w\211K\223b\232\213\351\030\323\020\2467M\353\226NM\177$\004\307\316\354&r\354n8\352\261CPh\304\277\337\376}\fb\373\223\371\336\3541\024\361h\320\261\373\0218t\001\322\003y\264)G\253\225\030\202\252\343\0031\242\037jR\221\030Q-}\231XR\033\003]\265B\220*\f\216\213\023\002RDS\355\007\020\3622\233\300\324e\237\305[Xh\361\274x\230\n"
+	.ascii	"'h\013I{\002*/3\351c\344\274\324u\177\256\273\006\255'GU\307"
+	.ascii	"\360.\361\032\341\347\006M\032\331\377\271\n\027\177\307)U\247"
+	.ascii	"\024J\205\265ja\305\224bVN)\224\n\353\345\264ZQ\360B\354\241"
+	.ascii	"\234V*\257\363$t/\250\226T\347\255b:\024\022\253`N\253\216\245"
+	.ascii	"R\255:\220o_\20314\243\257HR\333'\027b\220bcw\021\370\264\277"
+	.ascii	"X\361w\016\355\200\205%\036F\037\262\035\234\222\242B\345\364"
+	.ascii	"1\022\257<rI\243~S\250%3j~\314\004  \240\002\251)\262\003\" "
+	.ascii	"\207\0277\254\026j{3Ps%rnZ\303\346\205\027\317S\266M\2517\240"
+	.ascii	"\n\257ML\314\245L=Z\r\256$\331b\202v\002\352\202=d\217\031\344"
+	.ascii	"\324\314\343\307\340\274\024\360#\225M\256\235Y\304\214)\305"
+	.ascii	"\201\002"
+	.text
+	.section	.gnu.lto_subTaskPidSubprocesses.136.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\274\002\235\025"
+	.string	"V)\221G\300\030Q:\360\233w\022\007\034\351\306\233G:H$\357%\2305iL\tGw\342\004\024\221\275\005\372\277\217}#\023*\347'\277\270B\b\b\361\235\024+\356\271\301q\340\240P\346j\352G1\321\255\021B\366&r\247\024\201"
+	.string	"p"
+	.string	"\200"
+	.string	"Jj\325!p\201\360\363\346'\372\371]"
+	.string	"\3754\3146\262\021\252\261\235\0354jC\220j\255\250\215q\330\305\020\244\363[\t\363A\036\3216\306.\342\270 R\361\360TL\250\300\321a\"\205\004Q\234~\006\272,\37123\326\276S\211\0336\3238$\247i\254}7\265V\022\243\220\374N|\277\004BH,fF\332\007"
+	.string	"L\255\312\203\\\216\030gR\202<\265VK\333Ht\227n\373\205m\006\266d\022\032\374\032f\265\344m\237~\213~~#\334\240\364H!\223=[7\223\213\263\377\325Z\253\027\206\375\334_Cs\335]\002\245E*\035Ri\220J\323)=W\372[\351\375\244\345J\377$\343e\313x\037Wj-\321\013Sy\223\t\216\353~\373\017b\223m\035\210W\242z\021H;lt\251Uw\340\323:\341\245\375\037\007\002{.\204\305Z]\354\002kC\370\221\267\371E\214\222x4'@x\310\240\237@w?\303\022\236dBX+M\201\177\344H(\3705>]\301\202\005\372\271\373\025\267]RN&{\262\326\032\233\213\363"
+	.ascii	"\"Gc\226f\003\f\035I\221>\bZ\332\021\366\007*\367B\221\226\""
+	.ascii	"7\362\001(\225\242\237run\273\244OF\332\031V\3626\232\225X\214"
+	.ascii	"\246\360f\033\363\025%\271\026\2738\317k\240\337\013EYh\022\214"
+	.ascii	"\375\242\013\t*\326\312\347\345\002z\005\211A?*\326\312\347\265"
+	.ascii	"A\345ruH\3118\225\243r\265R\250\024\006\324\206\025\020\013\225"
+	.ascii	"r\005\241rNnqP\271P\257V\313\2052\351d_\030\016\271\240\340\311"
+	.ascii	"v&\212k;\347Q\032\354`\251\265.\360\237\034\212\203\007==\364"
+	.ascii	"\223\212\261y\tW\004\227n\270\037\3121\223=\227\026\334\317\245"
+	.ascii	"k\263\253\215\221\311\336\334\037\265\230m\354\341\342\206\374"
+	.ascii	"[\017M\276\345p\263\322\003$ k\002- p\002)Rw\007\323\200\253"
+	.ascii	"\r\331<X{\363\334\030\033\030\003%\271\215\035\266$\034c\216"
+	.ascii	"l\313\222\025\027>\3366a\"\256\222\220\327Y\204\323#\t\373` "
+	.ascii	"\317\243.Y\315\327\371\204\265\207\004\213\315\320\264\274M$"
+	.ascii	"\f\237\024\222\355\356\317\035`D\016\327<$\006G\257\024\0339"
+	.ascii	"\206\f\324\27093)o\212\r\307k\365\224B@\001"
+	.text
+	.section	.gnu.lto_subTaskTelemetryPollSensors.137.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\017\001e\r"
+	.string	"f\031\\D \217\223\0163\353\242d\254\004\3730a\353\215\262\327\212E\013u\021\336\030\036\177@\350\271I\241}\330\016\331\202\305\273\300\266\374\"\214[%\b\302Q\211\024\007"
+	.string	"`mi\030"
+	.string	"-J\t\332\272\364\333\336r\247\024G"
+	.string	"C"
+	.string	"M"
+	.ascii	"\004\356\331\\\306\013\330\\\232d\267\370\207\262\034+'F^`\354"
+	.ascii	"\356\324\223\223\036\025\222"
+	.string	"\374\243\316\351\274\220G\f\327x`&\206&\200'\022=$)\335Q\207\025<\016B\215\004\273k\330y\027ny\333\nl/\260\357\021V\023[B[\021Z\276\345\217\021\372\234\215\225\005\357,$vIjdlJ\242PQx\373~\210\273|\374s\307I\246si\177\330\235\313wl\037\332\007q\026\322[@\314\331\325\220\002f\367C`\003\326e\037R\234\206\034e5\003\243+&\324=6\226\226\230hV\270`\241B\004\256,\325R\216\027#3\256Q\245\336\345\005RTL'#:p\027\361\027\020\237\203)\210\340\273K_\264\271\274v\234db\224\224`\215\375qP7\330\217\273\273\001\206\360\3012\320h\206\264,\323\256\001\242\006X\006b0\na\333&\341\332\360\365\3016\355\232\327\203\031\0029\310\346\265\211\346\307c-\002\266\315\221\246m\263\363\225\036WMl\251bR%\345bT\023\023N*\017\031"
+	.string	"@;\323\340;\277\204*\026"
+	.ascii	"q\224\301\231\320w\024#\303`\254\337\033\204FXY\036\374,\301"
+	.ascii	",4\270\261\013i\033\307\254\265\263Z\300\242\026q\027\334Am_"
+	.ascii	"\301\022\261jE\234\344\251\256\234R\250="
+	.text
+	.section	.gnu.lto_subTaskMixerUpdate.138.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\342\003u\031"
+	.string	"\226-\237G\300XM:Q.\034\252\360vd\231B@wh\270itg2%X\252\257\253\336t\371\033\203\232\027a\373\367l\233\t\201\276\235\226}o\371LH\344\024\f\3430\030/\261\217{\024\242E\020\212\267\226\020B6\221;\245\207"
+	.string	"}"
+	.string	"\220"
+	.string	"*\333\266\236\327\241z\026NDM`j\265)85\203\360\323~\221\033\361y\221\n\213\265\342\240\202T\253m\201\021\204\247\005>\340;\365.\340;\265\217\375\205"
+	.string	"P\2259 \362B&q\252\265\262\226\307}\036\202\037\365v\372\370\277]\244\225\262\207\006p\f\325\016>\013\214\0329?\031\247A\252\022hz\251R\306\327k"
+	.ascii	"\344T\243\246\\\341\315\214!\267\374\366\351\242\234\315\tJ\250"
+	.ascii	"\265z\322\312\241[\274m\232m\n\266\347\207}\337\017\270.+\346"
+	.ascii	"\030\373J~\004\363}XDl\236v\352\307\276\323/\r\242\224\263a\244"
+	.ascii	"\3663\243l\233l\356\016\373^]\035\366q7\316\352\346\266\333\006"
+	.ascii	"\234\256\t\247i\302\351\231pZ\365M\247\350\264\bN\207\3414\030"
+	.ascii	"N\177\3374\r\247=pz\277\351I\247_`\264\"\364\242|\321R\255BQ"
+	.ascii	"ej\216B\371q\334\275y\333\327\276}$\276\021.E\213\034\021\031"
+	.ascii	"\b\341\351\177sN\240\233\361\335\354d\322\225P\242\344\216(\375"
+	.ascii	"\355\007\302(Em\355\307\r\213\267\332)\037\242\021E\244\026\256"
+	.ascii	"\355\234KI\232I4\035\270\341\267\336\202{\272\337\236\334\375"
+	.ascii	"D\321@W\254y+ \307\221&r\267\333\344O6\330\364\250\265>\360\235"
+	.ascii	"\034\211\203\357\343\324\035<x\270\223h:\234\335M\341\216,\221"
+	.ascii	"\273\271\253\305\331M\022\004d\366%g\322\203\242\325\372N\347"
+	.ascii	"\276\n\r\250\247\232i\277B\314\323V{\243\007`j\022\223\233\255"
+	.ascii	"\314KHE76\257\030\fC\213g\304k\002\200\261\305\263#\356dx\305"
+	.ascii	"`\030xH\274\306\321\204\213\306\256\234\327\250\343b\271@\260"
+	.ascii	"H\300Z1\226k\334a\345\f\260N\211\327\310\342\321\321\031Y*[\375"
+	.ascii	"\352p\250\273\222\373\331Y\270e\203\003&-\037\024\315\326\314"
+	.ascii	"\254jilv&\265\252%p\205\334\375\314\250\324F c =\201\231\255"
+	.ascii	"\354\340\356\360\352\250|Ao.\024\004\265\363\374\236\357F\027"
+	.ascii	"\207\020=\221Nv\2656\353\302T.\356\t%qA\031\227!\025\204X\030"
+	.ascii	"k\340L\373B\206yZS\250q(\307\030c\210fF\312H\013\322\006\240"
+	.ascii	"\002\231)\333\r\020P\250f\233t\273\213\272\2513\312\262\337)"
+	.ascii	"H\355\t\003\326\341\213$;\\-\273i\367j\215r\310N\202|\273co\332"
+	.ascii	"\263\206\347\214\355\372\352\316@h\217k\224/W\345\216\342(\273"
+	.ascii	"\266[\251l:q\370`Du_\306\335\236\204\200\013\376\271\334\315"
+	.ascii	"RP\300@\344\027\243\367\252\"\2154X\340T\323\021\203Tp\023\323"
+	.ascii	"\320\343_q,\033\211pA\326\242\337\211 +\313sQ\370\201\204\270"
+	.ascii	"\004\244\273\270\\g|\240\036\016J\211\233\244W\244\250P&S\007"
+	.ascii	"q\376\237\202\032\013\376\001"
+	.text
+	.section	.gnu.lto_subTaskRcCommand.139.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`6\001\315\r"
+	.string	"\266Y\\D\020\221\223\016\033\002\372c9\270\\\020\300\275\334\347\366/\\\343b\307\246W\224\004\211\220\363\211 \276\255\031\3733\207\242\222$\2135\211+w\347#"
+	.string	"\240P,\017\340\007Q\024\352dL\020\226 \210\354-eJ\001J"
+	.string	"C"
+	.string	"H"
+	.string	""
+	.string	"\252G{l\032\002R\366s"
+	.string	"\205\213J\t\307\356b\032\342\236G\250\351\361=H>\274\357\363\310\341\020\026\250\001\343\206f\245\204w}\242\324\220/\005\212\354\356U<3|\241L\017\222\335uz\337\206\273\272m\006\266\r\330\377\020\251SH?\366(\224\332b\037\356\356ZYl\230\2161\raZ5\235\231\376\025rB\303w\0271\273+)\035{\2122&.\333O\373)\376\3429\f\006\177\354\202\210y\261;\032\361"
+	.string	"\353Q\344\232\352\021>o\361\300\332\025!\360Y\334d\222iZ\365\322\fL\252\352Uv\2002\265yI\202\265\273\t|\322Wp|\022\217\236\260E\177\253\036SGfd@\231z\356\356G}\241\272B \315\020e\016[iW\350\344\275\353M6\002\235\022m\343(@9\321\272\316B\006\342l\243u\\\206e\021\260\023\216\311\206e]\007\333h\314Q\320:\f\205\343:\354\032\201\016WYl\241<\234@\032*!\200\352\020\003\244\275\240A\336\363M\250\3171^\\D@m\211\252\232#H2\240F\007\001\034"
+	.ascii	"3\241\265)\306\203\303\300]\242\355\230M^4\023\212h\212\303\361"
+	.ascii	"\211\261\003W\273\202\321\272f[X\226]\f\365\312\232\255l\001"
+	.ascii	"\253\252vU\006\373\f\f\270\204@\254\246\004w\t\030\360\252\212"
+	.ascii	"5CnW\321\003"
+	.text
+	.section	.gnu.lto_taskGyroSample.140.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\031\001\215\f"
+	.string	"\226WSA o\233\016@\237`K\260!(\220\241\n\023\2134E\b\225~"
+	.string	"\024\237L\306\024\244\022X\205\212d\t\207\001n\345\336\231\315\r\006F"
+	.string	"\200pT\"F\216\006\212\033vq\200\355\337~\333[\312\224\002>"
+	.string	"="
+	.string	"C"
+	.string	"\327H\217\360"
+	.string	"\244Gg\366\311=\017\033\240\203\204\202H\312\356N\332\341\331\241f\346W:\027\256\323\0161\\3]\006\334\354\356A\236\025\272-\263\322\331]'\327]\270\343m\037\260m\300~\206\243M5\333\323R9\354\303\335]\353\206\235\351\230i\230i\315tf\372\230\214\210\221\356#\337\256\205\257\305\216b\t\b\214\355\247\375\021\367\310\3761\301\227]\016 'v\275\002\036`y\334\004P9,\251\004Hd\222\242\"\224_\356\256\246\026 \2512\bA\221\221,\234zU\275F\311&\362I\275\370$\036b\371\037\374"
+	.string	"\313s\217>&=^\377!2\351\320\020\312\3171\355\b\022\362\234\t\240\204\bX\202\352\343A"
+	.string	"\302\250\256\013\002ua\212S]\0265Q\r&\f\317\202\317D]\330\304\321\330rP]\023\310\262\256\t\343\355\341\352\206-(\036\243\220n\216Jr.\305oIP\243^c\303\226\237M@U :Y\021\033"
+	.ascii	"3\241{)F\343\005\202\340*\305\203SV\201%\244r]\314\202\224\331"
+	.ascii	"!U#\254,\f\034\241!\037+\262\314b\340\016\b\306s\034\032u\267"
+	.ascii	"\201Y\227\260\210\325h\340.\001\003\026Un\273\212\036"
+	.text
+	.section	.gnu.lto_gyroFilterReady.141.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"\r\n"
+	.string	"\006\323E@@\247(\035\260\245|W\306@IZ\357\306\216\002\246\\I\254\362\334\252\320\206-\013\001y\346\331,\2545\202\370\313:\262\214\230@\013\231g@\322\013K\367\\a\260\271\274\235\335\032\232\220-eJ\0013"
+	.string	"1"
+	.string	"4"
+	.string	"\246\005$\005 \354\206\232\256\334{\324\364\374\357\321\"\345\201\002\226\001\360\344z\001?\361aw\177z\212@PfBfw\235!\320\344\306n\373\3026\204\375K\236|\331\341\227Z\262\037ww\255$\333\351\230i\315tf\372\331\006\301\250\004\374\001\325\356\350\345\332\004\330J\200\355\216m\261\304D\307^\203\310\327\252\b\372\211Z\312\335\375TI\266\0352\325\f\002\f@\031\301\251W\325\217\254>\341&u\341\250\017"
+	.string	"\361\0038\204\223\017\035\3639\331\261\353O\217h\261"
+	.string	"\250\240P\002\3360\232\216\333\264MC\353\330\300\340\320\266n\243a\030\314yh:\355\203\343:\315\022\356\343*\311\024\016R)\365\275\354\247+\270L\rR\252\374\275,\252\310vTg<\001\017"
+	.ascii	"Q\204\376\315\206\267\307\0167\332\337\230\305\300\035\020\214"
+	.ascii	"\347pQjhs\315nC\344q\327QU\003\251C[[\312"
+	.text
+	.section	.gnu.lto_pidLoopReady.142.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\235\n"
+	.string	"\366\023JA \251*\035\004\373\240D\307r\246A#@\215\266}\203\b\265\320\004/\322\236\276C\030\037gA;\214\262\241l#\315\221j\334H@\347\002\b\262\200'\212\366\024\033`\220\226\254\236%\325>\331R\246\0249"
+	.string	"6"
+	.string	"7"
+	.string	"\022H\016D\230S\334\266\345\337\345\352\347\207.-TF\226\230+D\371\312\215+D\320\020\216$\003\001\007\003\276\272\232BP\025\303\231sZK\341\311\255\335\366\205\355\b\373\020\001+\254\024\221\316l1\244\233\262/\347\242l\2535UKU\257\252U\325\307x\306SI\370W\2029O3\331T\240\301\004\330\006\331\031o(@\376\036FB\017*T\001)3\b"
+	.string	"\301d\027e\271\273\031\006\026\214t\202%\256+\367\244\021\324\231u\277\273'\301@\321\243\273p\326\013\204\370"
+	.string	",\362\321\227\256\371\237\313\265\357W\237\bc\r\002\3464\035\257\3436Nc\363\330\300\350\3308\317\263i\034\334}t\274\r\244\353\274-#\316/\312\034\252\261\365R\377\273|u\005\231J\326z\355\377]\2645\331\326\326\034\321\202r\003\017"
+	.ascii	"R\b8VG1\330\272<t\034n\021\340\004\210\313s\214(5\212k\242)\026"
+	.ascii	"\272\r\221\307]GU\rE\227\202\002"
+	.text
+	.section	.gnu.lto_taskFiltering.143.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"]\007"
+	.string	"\222\21644`o\032\003\224\215F\270\f\317\202\035l\246\341\270\231'tG\234\313W\203\306\036J\017\211\356\354\201{\317\360\240\023\301D\320Sw\345"
+	.string	"\211}\220%[J\231R\242\206\n\364a\030\205\2529#\250\200R\236jZ\224\244\036d\350\343"
+	.string	"\222\324\024IO\247\026D5\345\310\262\246\344pw<$U\343\322\321U@\213\306\367`+1\361\234\025\301\205\243\273\200X\313a\017~\264\216\377_Hj\275\331/\n\260\210h^Q\3715b`\336M)%N[\277\326$.\271\274Qt\363{l(?\227\320\003\215\247\002w2\236\242\0072\236z\265-\346BN0\222\201q\362\362_B\020_~Wm\023o2\r\363\003X\370\337\227i\033.t[\203\266\nmK\001\b"
+	.ascii	"2\241g/0p\341\035\314\273\004@\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.144.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`g\002]\022"
+	.string	"\366!wG\340\322&\035\223\022.\246\032\302\250\376\016Z\246\026qV\2276"
+	.string	"d\210\363\271\023I\345\036\033\r`{\260=\372b\315\327;`U0L\007\223\262\3162\274A\004Q\017\f\334PCA\"\311a9!l\215\354\275\245L)c"
+	.string	"W"
+	.string	"d"
+	.ascii	"!\214\232\023E\320\320\234\264\0046pz,p\024\371\bo\"\037\355"
+	.ascii	"\262\205\234\266b\016\200\221#\263\2214\347\364V\305]\347d\204"
+	.ascii	"\253.\377@G}\263\327\271\223\211KY7\273\321(\263QX\342\013\027"
+	.ascii	"\330$\235\b0\213A\222%Y\217\003]E\314`\252\334\2039\247\365\233"
+	.ascii	"\221\270O\267\r\302\266\002[Y\0041]\262?\3434V\276\217Y1\372"
+	.ascii	"\357\321\217\221\217_\030\035\242\02795z\263i/\335\036\373p\316"
+	.ascii	"9\275<\366\177\376\022UwQ=\"\325(UsQ-\241:B5\204\352]\265\252"
+	.ascii	"\372)4M8#f/\022\232\023\347\3064mQG\213\316\366\325~\214\313"
+	.ascii	"p\375'9\270\275\240SS\252p\2642\004\003\215\221\211\226\254\235"
+	.ascii	"A\203\376\363\001\244\232-\266/(\3276\202\007\2610\3701\347t"
+	.ascii	"\340\3378\216\026\337\347\321)\225J>\312\"\337Q\\\tw7\356o\\"
+	.ascii	"\300\364\346\222\205{\335\335\224\232\254\211Dm\227\016\372O"
+	.ascii	"\367Dv`\373\272}\f\375\354\354\3668~%\27745\200\0042+\252\225"
+	.ascii	"\213\205\231\027U\253\345!\005\300)\025U\213\225\362R\034\274"
+	.ascii	"\027\227\226\225\227j\311x*(f\301\250Z\336\f\213\325\362:\332"
+	.ascii	"\374\362\234\220n\266\232\205q\004\324\206\020a\367\365\023\246"
+	.ascii	"Z\221\024z\267OA\324\355\007\035#\245\234\021\036,\rv\374;B\355"
+	.ascii	"\310rAdM\002\364\344\022\244=\201\202\376Cm\n\rI\311\026\213"
+	.ascii	"\377Jr\273!1 \320\002\241!\262\003\363\200\215d\006v\215\367"
+	.ascii	"\266\244\313\224K \\\332+\301WA6\226\275\307\250\270f\312\370"
+	.ascii	"\230\257\\9\277\263\365v\025\302\005\261\205\371\016\226\021"
+	.ascii	"\343\306\230\301\265\207\266!\326r\202\242\301\233\013\324\271"
+	.ascii	"s\r\013/\\\030Uav\030\026\007\354\2062\341\205@\354\247\004:"
+	.ascii	"R\256\311+\234Hvk\257\023\212c\212\346\241"
+	.text
+	.section	.gnu.lto_getLastDisarmTimeUs.145.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375 \360\245\006"
+	.string	"\242\214.4Pm\222\016$\013\252\312c\026\024\016\233Nkj\200\013\333\013:j\305\336\332\337\355\360Z\301\215 l!\252*\t\242\006n\001WVs\264\301G\023K\266L\001O\031MEMoZx\016\f\n\ro\252 ^\3462\365\240\251^\004EU\317\222e\033\b\033\346j\236/H3\353r,\261\301~\352\356F\252\303\026\200q\341\350\263\0166\215o%\033\350\307\261\t\234T`\025\221dZ\214R\322\304\215t\374\234\267\334P=8[\t\023\027f\020\022\241\bA\311\314\036\246\027\251\256\322\001\251\256m\324*Z\267\037E\360\210J>X\247\bp\220\231\343\007\273\350\255\177\301O\360g\004\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_isTryingToArm.146.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375 \366\235\006"
+	.string	"\262\f.4Pm\222\016$\351\252\231\r\256\300\372j\201(\r\017\300#\252\007M\265\236}\373w\203\326\3057\202\260\205\250\212*\"V^j#\300\222\300Q\207mm\023\231\002O\230LEMorx\021\017\r\020o\252&\036\206`J\"S=\n\212\252\336%\313\216X\300\301\316\b-\"\326\243u\372Q\220K.\350\2125\327\253\322]\263T*\006\\p\334\366\331\306\341\3067J\324\370\335\350\334\215\004R@XM\266\314\317\266\222(\022\211\307\257\371\313\t\n\232\255f\035\237\201\320\210'D%3{\310Q\253\316\272\r\225!\343D\344\3026u"
+	.string	"\013\231\271\2730\213\216\375\017~\203\037#\t"
+	.ascii	"2\003\3020T8\313\242,qML\031A\226\0209\3349S;\237"
+	.text
+	.section	.gnu.lto_resetTryingToArm.147.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375 \344-\006"
+	.string	"\"K*2pK\323\001\220\021\276\332e\037\252\003\021\246S*\237\rsW\t\255\210\021\244\361v\264\374\215-\311\204t\365W\341\312t\013\307\327\265k\255\331f\367N)\236\316S\351\224\263@\"\030\020\034\310Y\025\244c1Mx\252\\\240\264\312&\333Gk\322a\233\024\033\034p\037\273\2055|\n3X\203\237\316\370\326\"g\006 8\317C\202\237\235E0F\330\207l\264\354X\3510\250st\354>|\037\2731\031\025\266\337\030\262\271g\023{\2716\034.\274\335\225Q\342\320!\344\377:e\242\242C\211\300\356\032NTu\307\003\330\256\002\t"
+	.ascii	"3\001\0078\003V|\241k\270[\b\343e\bp\351\306lm\327i\001"
+	.text
+	.section	.gnu.lto_updateArmingStatus.part.0.239.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\324\017\215B"
+	.string	":e\364\026A@\"V\007+:\005X\375\35448RqX\336\220\323\020\367=A\216\350U\032\031\022\0172\177%\226|f\206\277X\303D\314\005\001:\201\2408\374\262\331\217\334\274\205\225\245lm]7\273\367\2262\245f\001B\001X\001\260\007\020\376V\307\2779V\030]q\373oy\270\027\213\017\177\233\273\363\300\272\354\336\347\341\320\346\017\023\244K\356o\236\347\350\303\333\311\313\317`\001\226\202\253\004\b\254\016\030\210V\025\240\232\222\"\0205@"
+	.string	"T"
+	.string	""
+	.string	"ON\320&\246\245\247R\022\322\221\221\263\311\\*\213\222\310#\221\261H\034\n\2031\374n\335@\366\017Fx\312\363s\375\322z\006\200\277"
+	.string	"\353\357\025\370\351\243\257\022\360\331\243\021\204\370sc\313\202\361y+=y\364\001=|\332\200\036<:\252\367Uq\364t\2018p4\325\233\237z\343FK\221\341\223\247\t\264\371\2506xz\200\200\272\2072SF\007\240{"
+	.string	"td\364\223\323P\210\225,\330\334C\307\210\321Mc\270h\246\2717\275\364\334\276\222[\233NB\332\362Glk\332\310I\345\233S\366\260R4s\231\366\312(PtQ\362\311#\367\260h/t\373Nj\330$\372\030\214\220\0053{\"'\243\332\036\026\211.\226\221i\"\2076\256\033`\026\254\354\207cZ\270\207=\242\206\025\323A5\354\221\027:\317\363\203\351\322\361\253a\315\206|\371\320\260\276~\021\371\267\370e\325\373\225\352;#\350\370\305\3656\275\246\\\177\373:\310WUk\3457\bF\230\347\331\177+\360\335\301\273\277\257\273\357p7Z\b\356\001\204\376+\210\370\341w\377\035\276\267-\335\365\245v\027AB\377u\357\270\355\354\321\002\373\352\366\326\272{T\25475.\217U\007\372;\177T\374[\357\327\257K\254\252\273\236\324\356'\244\372\257\277q"
+	.ascii	"\302\002\366U\267\226\336Z\337\r~w\273]C\276\231\270\277\332"
+	.ascii	"\237^\355N\257vhQ{\323\253\235i\250}I\250\375I\324\256\364jO"
+	.ascii	"z\265#\275\332\217^\355F\257v'Q{\223\250\235\371j_\276\332\225"
+	.ascii	"\257\366\"\"\355\311W;\322\250\375\370j'z\265\033_\355\305W;"
+	.ascii	"\361\345\336\207\257v\341P{\260\250=.j\207\211\332\337\241\366"
+	.ascii	"=\324\256\205\332\177\305\224\024\244\331<{u\013\315g0\032*/"
+	.ascii	"\367\357\345\177\356\321\314\320\3413\226\374\350\002\263\343"
+	.ascii	"\341Y\021\252?\270^\2725<\267\277\331\n7\345f\276\256\206g\355"
+	.ascii	"\037\\[J\036h\323|\210E\037v\270o\306\017\013\177\031?\3545\236"
+	.ascii	"\316\233\320\374\305\220\361\342\334\230\033cnp\300c\360p\377"
+	.ascii	"\346\037\367`\274(\367\345\013\323\226>\2675+\341\303^\334\352"
+	.ascii	"\212\307w\311\341X\253+\371\273\344\200j\301\315^%\332\340\334"
+	.ascii	"\376\346\031n\352\003G\264\2204-\367g5\327/7\023\315\030\223"
+	.ascii	"rI\246\334\312\"\\\353\222\336Rb\237PCJEeE\033\031\230t(\020"
+	.ascii	"R\362\317\021\235\227\223\304\311M\215\213\023]\"k\365_\223\033"
+	.ascii	"\031\307\b\020\217k}\247\236\3274\221N\220\033\351\225\206\351"
+	.ascii	"\347\306\265\376rfSn\255\277\374$>JI\221\251\350\277\03672\013"
+	.ascii	"\267Z\324\367\310*\311\344\261\256\354\221D\233\372\022\355\337"
+	.ascii	"\376\017\251#\343Z\273\307\341\336\003_\251\303F\364x\336\035"
+	.ascii	"C\267HMP\036\243\361\355\274q\277\2213k\2027\331lqk\375\351\374"
+	.ascii	"pG\313\006%\221\243\025D\024\376\005+L3\200\303\261\271\274a"
+	.ascii	"q\377\2418\001\332_\306\022\273\313Zd6\375\327\342\206\032\342"
+	.ascii	"\247\324\247%O\230#\036\356\t\373]\315v\315I\360\365\236\270"
+	.ascii	"u\240\377\336\317\271\341\237\346r\233\274\225\267\361\303\304"
+	.ascii	"\255\241\214k\266\025\333\322]\231\313p?\230'\236\371q\001\373"
+	.ascii	"\342\033\261\260I\273O\240\240\377*\334\310!m\270\360S\277\363"
+	.ascii	"_\210\3351d\320\177\365\243\2313\\+\026\327\317\225wk\203{o\243"
+	.ascii	"\2358\275x\007\203x\336\327\304\360\216w\224\234\017\265w\303"
+	.ascii	"\373\273\016\271"
+	.string	"k\370\274\r\302y\266*\360\307\3736\035\374\323\036\016\276\242J\005\213\0241\246R%_Q\225\365bJ\245\021c*5!\245>\247\324\034\025PP\2471T\260 \342\340\200\302\306\211\025\261\013\351\t\t88\320\230V\240\221U\243\005\221K\253PP\247\322\2504E4\006\213\0230\242RjV\264\252\351S\031(\250Q\032\323)5\252\377\2357\223\017n\270[\273\312\300\220\314e\274c\263\240GW\346\262\303\202P\225\271\356\266\334\252\236\347YK\301\323\246>\335\265\315Wh\177w\005\001\036\2306\201\323\3767\247\375\274\263\202\304\316\217\013\202\244\323\314\370\204\020\230\025t\177\023\350v\026);\260\265>\365M\233\n\213\201\255u]5\365\257\265bV\200\352\233v\020\246\375\331.\246\355\024\343V\355\242B\256k\202\252\326\374\322\376&q|H?]\275\356G\305\317\275\264\341\347&qV-\260!V\332\004\322\234"
+	.string	"\321Jt\022}&\007\221\205\310^^\361\303J{D\332\231\331\226\312\341\230i"
+	.string	"\247\222\366g\223\366\223\371'\0226H\n\ti#\303\374\b\350E\035}\035md\030\034nu"
+	.ascii	"\221_\252\0210\2479\003e\024f\264\227o\001\322h\001\340l:w\r"
+	.ascii	"\2623"
+	.string	"\300\276'!\2574\253\226)b\347\204\206\fJJ\336\f]\212\233\304\3008\276_\212\231\273\271]w\211U\365\017\rD&bD\036\033\213\037fn\b|\177\002\201\\\250q<f\02133\"\"\222$\005)\f\007Q\005\304 \350$<\017\021\300\240\202X\031\225$\251\f\007:\222@f/doE\270\2524d%\267,\215\211\330\334\375-n\203\2114\t\022MP\215g\241\213n@c\003%\r<\035V\210\350j\341?$hU\3611X'\367\370\265\354Sr\b,\235Q\3718^\307N\226V\006@e:-\334\017\304\304\212\215\374d\340\207.\267x\017\025b\270\354\231\346\206\230\311\344o\370\271\205\n\251\347/\204g\206\201\322\313\315\344\236\004\232\262\035\3250\373\240I\006p1\016c\3178\221\324\020:\347\3178H\234q\221\tEO\263X\355\317[z\223\270\321\310\343\360\005\312 \324,\341\234x\340#"
+	.ascii	";\031|\005\321\272\n\266Q\360\t\t\316\216H\251\253\234}<4\367"
+	.ascii	"\352\230\356\t3\023\320\353d\236\"\360q^4\340\300\247\330-<\357"
+	.ascii	"\206\246\241\227%:\002\301\305\201\n\331\205J\213\177\215G\330"
+	.ascii	"\020\364v\223\t\365.\241[\2223\220\346\301\261\205\244/\336O"
+	.ascii	"\177\027\274>\031q)\303\244\213;\204\373\225K\230G\233\236\n"
+	.ascii	"\031eS\312e\252\372\370\253A`\345f\006\310X\344\336\240\376\254"
+	.ascii	"\346\355\2370y\206^\231\265\317Z\007\305\330D\336M\303\232G&"
+	.ascii	"\212u\013\242\236-\310\203\253Q/\324\355\210\027\252\2049\230"
+	.ascii	"\002\003\260\2664\001P\302\217L\247\316\033\372\322)N\305\356"
+	.ascii	"\005\272<\336B\"6\020;\310\005b!\024,\276j\355 %\372\202\325"
+	.ascii	"\251\207a\001\244\334\271\207h)\002\370Q\004\217\036\023\276"
+	.ascii	"\312tY\026\r'[U\f\255\342{\004^\223e\200\"\013\264\325\032\253"
+	.ascii	"\021\221\261/\272>$\262ED\250\213\323j\271\203\031\216wS\354"
+	.ascii	"\274Y!\267L\021\004\354\023\034Vr@\033\261\331\026\231\205AP"
+	.ascii	"q<mr\007\272\243\240Wm\233\300\\\205\001\312\030Ms\026\3779"
+	.string	"\r^\353ke\254\347\274\202y\021\252\236\330\004\325}\"\336w\357M\246\230\302\266\206\030\333\251\303Pn\226\256mx@\373T$\343r<dX\206\275\352\314f\035"
+	.ascii	"\344\240h2\225\245\261\304\334)\006\351\325\357\b\203\265\257"
+	.ascii	"\240\327FS\\v\006\257{\304\362\347\013\310f\325\303\212\205\301"
+	.ascii	"\254Q\036\356\227?E\001\361(F\261\374''G\307\335{\222\207\251"
+	.ascii	"\024N~}\240\235\257\304k\"\245V`\2617.\306}\312\221\027B\312"
+	.ascii	"\340\203\n"
+	.text
+	.section	.gnu.lto_disarm.part.0.241.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\370\001\225\021"
+	.string	"\206\340rG\360\320&\035\030o0dn\026\013I4\223n\254\374Q\330\021\r\276\t=nJ\303\006!\220\265\212\026\006\0332\206\241Q\203r\205sY4\3114\004\333,),B\036\006\202.\035Ym\352.\317o\324\244\221\275\267L)Y"
+	.string	"_"
+	.string	"_"
+	.string	"\263\343\247\355S\236\300\366i\372\374\t\333*\330\356v^\3310\036\326\354\177l\\xj\273\333}F\021_}\312\250\333\312\277\354\245W\214\365\271\021\203\271\324W\314\303\243D@\033\222\301\021s\311\323\013\211\327}\256\033b-\325\001\337H\"\273k.\346&\335\366\003\333\016l\r\tN)\020\326thP\"FQm7\354>\035r\317\271\264\317\341B\345*l\202ia\362{\256\343\373\360\354\254\270\303\025n\f\366\033\237gg\205c\3018\242\0218\264]\330\007\367\251\376\215\312\227\331\224\243z\310\242\f\266%\346\343\323\252\366S\034g\365\220\305\245]\231 \241\3350\301\247\017p\017\036\233\306\224\316\013\227\316\260\303{l\217\032e\r\227\017-=2"
+	.string	"\265%\220\350_\217\001fC\033j\227\200\372\227\357\363s\230\2310jE\226F\032\307\355rw\327q\306&\251uS\277tR"
+	.string	"b\367\345\210\306\206\230D6\357\271\302\202TN\021ii\310 \201\212j(j\353\n?\374s \225\236"
+	.ascii	"\202\001\034\241\360y\025F\fx(\336\002\024\023\324\005T\311\004"
+	.ascii	"<\361P\251\315\037\b*\005~\335\027\2413!\361J\272/u\322\201\234"
+	.ascii	"\fZ@\245:\024\020Lu&\333z\271qFvn\306\302\250%\266\346\212\334"
+	.ascii	"\225\ty\317O\223\351\221\243\024\240\362\0206\333\3738f+\214"
+	.ascii	"\\\221\345\370\327\314\240\t\305Hc;, P\002Q\224\225c\254\360"
+	.ascii	"U\332`\222\004\334e\234t\375\357J\230k|huc\362le\242]\277W\024"
+	.ascii	"t\3535w\262`?\354\017\206u6\211&\320\304\220b\3740\244\215v{"
+	.ascii	"_\360\272S\374\022\027XK\365\270\340\360\177\214\253Q\353\362"
+	.ascii	"r\334F)\236S,\264\227O\320HPdw\037\215\223\337\245\360"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.part.0.242.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\345\006"
+	.string	"BL,2PO\222\016\240\\\354\224\013\240\b\004\205%5\365\332p\025DHs\355=2\273\365\320\305\360s\304\354223\215$\257,\210pu\301\0234\b\331D\246G\230\314$E/bx\017\r\013\016/\232\"\036\306`\t\"3=\tI\232\236\373WYbg\005\226\220\005^ z\376\266\\'"
+	.string	"\236\242b\265z@%%\204\201\233\205\236\221\225%v\036\337\207\340#S\343\305%A\032\312\310\027\244y\347\332\372\3715\033S\277\322\022\221\354\211G\206IKf\2766\f)U\\\214\272\025gS,\250\253\342pt\025\224\005$d\346\002\035\275\365G\370\017~\222\020"
+	.string	":\023\030\027\314F\221\001\310\003#\\12L\004\234\021\213:\247\323B\233);\r"
+	.ascii	"\327\236\013\352\230\355<\241\214\001"
+	.text
+	.section	.gnu.lto_processRx.part.0.247.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\323\026eb"
+	.ascii	"z\227\020\"L R\332\032\003J\226\314 +_\300\024\315\342],x\375"
+	.ascii	"\272\221\344\243\355\303\304\275\310j\022'B\303=\336-\177\211"
+	.ascii	";K\330p\264\220\022\357\2011s\001\2069\f\346"
+	.string	"\016\263\267\250\272^Ep5E\333\202\274)\277\312\213\227FRJ)\031\002\314\001\033\002\327\267\276\276.'\314\267\234\256p\311dx\353s]\267]\031:n>N2a\276\242k\347~\221YIo\350\2714<h\0358\351U\367\206\366V\344\246\353\342\306\241\227t^\353\365\036'\223t\315u\341\335m\335m\265\233\303m\022\260k\206X-%9\310\340\3454\007\031Ii\t\210\025\264]\327E\271\353\242K/\253+\326\372@\263&@\203{\256\223p\022\311\007E\327\216\305\232\234\f\256;vu\344\203\345\324\352\222!}\334\260\276!\272\256\353\324F\236\222\341\367\266v\265\334\214\242\325%\033\343w\346\206\3538\032-7\203\217\256\313B\233\236\353Z\241\332\310H2m\\\366N\333\306b\347\264mdn\033x\212\252k\214\231y\212\212\006G\333\372CLg\255-,\t\242\353Z\245\332\370/t\264U\004\220\002"
+	.string	"\024'LXUQ\225 15B\204T\024\324\223SS\b\246%\245$\244#\243\242%\321\220P\020\020\210\037\237\036\236\035\235\034\234\033\233\032\232\031e\022y\224\211i\215\305\367\253(7\222\314\253U|\351"
+	.ascii	"\302t\212/`\034\200/^\034Eb\237\310&\272\211,\242[U\361H\325"
+	.ascii	"\256\207Mu\210\305K\034^q\022V\246\254\030\372\210\302*.\242"
+	.ascii	"\220\320\245\004\017\001"
+	.string	"=\n*J?Ay\342N\177\335\364\307\203\207\370\363s\246\245\276V\312\303\363\244\230\025Hw}t\247\304\215\226\344\340EKp\360\245]\023\271]\017\305\265P\034\234\007\2759\220\034\210\032l\360\037\267\366i\363\036\267\030\234gH\357\fQs\035!\235#D\312X\020\307\271\261\001\362\303kbV\320\360@\363\031%\220\"\2661\035\236,B\006\226\331\275eY\310\001\244\217glcf.#e\354\214m\254\314cV\b\363v\007\230\033\223d5\274\270t]7I6\365/6a\367\272\264\2241\030\212;bC\250\275\327n\203L\352\216\323W1+\\\327\345\376z\233W4s\021\004fvc\306I!`\334\312\276\232\231\300\265\275P\214\266\307\307`\3516-@\313L@\001\336\324\343\3675P\313u\332?\022\261x\377Uf\026je\276\367ZF\312\234\341\324\023\271[\250\215y\231g\017+\223v\226\326b"
+	.ascii	"\267\020F@\001\005\3326\306|\005e_\334\312\214\337\276\013\202"
+	.ascii	"E\331\353-9\230i\352\272_G\3057~\203\261I\375\345\377\342\377"
+	.ascii	"\360\201a\375\377;,\f\363\002}\310\200\214\353N\253\270\2574"
+	.ascii	"\026\007\270\205\264\221\037\300\362\246b\265m\364\357'e?d\343"
+	.ascii	"\276\374e\035g\226\200\002oj\277\2210\220\357z\343\314-\230\336"
+	.ascii	"T\356\275F\322\355p\263X\351{\361\373W\371\373\337\367\365r\365"
+	.ascii	"-0\367\277\357\353\205\277\005fv\256bg\252\243s\211\2433\t\244"
+	.ascii	"\363\024;\217`g\021\354,\305\316Q\354\f\305\316OGg\247\243s\023"
+	.ascii	";\207`g&v^::+\035\235\223\216\316H\354|\244t6R:\027)\235\227"
+	.ascii	"Jg\242\266k\036bg!\245s\220\322\031\210\235A\260\363\017;\373"
+	.ascii	"\3208\367\2603\017;\357\260\263\016;\347\3148\343\260\363\r;"
+	.ascii	"\333\3148\327\264\265\233f\306y\206\235\225J\347\244\322\031"
+	.ascii	"\311\316\307\243\263\314\3219\246\2254\267Igc\322\271\210t\376"
+	.ascii	"\243\2637^s\367W\321\b\265\006\315"
+	.string	"u\305\336/n\232Q\207\030Z\257;\257\033\257[I\267]\267_w_7`w\224\356)]\330\305\316\242[f\375\221\243}\330\230Z\235x\260\t=`\347\217P\343\253\207\212\252\020j\"[e\222\314\315-E\220\223S\002\003\2431>\204H9\t\005\260\257O\364\242<\251\232\273\321\367\206\330\244u\340\366k\0368\311\307\304j\264#>\234y\3510\372*\0037\336\036Z\002\235\324\020S+\372*_@\2040,\217\310qt[!b%,o\250\021{\350m\b\271\320g\220\270t\032\232\031:\b=\344r\235\272\334\373\202!\032R\300\273\241U\256@\017\t\007\001\257\323\253!\324\035B_\005\323AY\346\n\227Z\240\017r\"@\037\343C^[\313\275o\230 \020\377\211\006\2707TK\313\f\345\002\375\301\233\n\342[\024\322\246\016\364\363\036\007\315\376|\317\220\366\276/\030\020>\355\3633`piY\354\317"
+	.ascii	"\336\363\314P0\320w\311\016\304\203dyE\245\322\266\215=Y\253"
+	.ascii	"\353!\021\037\236o \236\326<oA\332\264g\347\205\032;?e\206\305"
+	.ascii	"\255,\214\31148\303U\312sC\002\223\307\216\316\273(\352|\006"
+	.ascii	":tP\340\210\212\331\r\252p\225\346\344\274\013+\337\351\250\t"
+	.ascii	"(DU\360\246\346|\353Q\001s\235\342\340\2409\316\367\tfP\246\210"
+	.ascii	"\331\365\270\371\252\016'P\236\0327\305\346\346;\316\354\346"
+	.ascii	"c\274\356\212\240\301\035\203\320`\255q\034\255\002\324\254I"
+	.ascii	"\233S\333\216\212\223\353\264\270DP\215\246\337\356g\272ax\203"
+	.ascii	"\226\300\231\023\360\020\267\334\2301\335\256Rw\201\255\211\322"
+	.ascii	"\346\233m\316\220\314\346'0\273\313\226\325\274\330\363Q\263"
+	.ascii	"\320|\3735\337E\314\226\314\r\322\241I\375Mv\264\275A7\3456\035"
+	.ascii	"\335\301#\332\203\207n\315\232\305N\2154`A\202\374*{\230\217"
+	.ascii	"\020\365\021\255V\3336v\nfH\020\267<\271w\024\206\2269\032$\252"
+	.ascii	"\346\204T\310\222\360`;~\225\346g\336\273\314=a\377r\351\214"
+	.ascii	"\030\242kkm\033g\376\252\260\310\367\227&#\243m\337xC\235\227"
+	.ascii	"9\303\366\013\216.1[m\277\321\253\356\207\271\302\357\031\304"
+	.ascii	"\025\256\264_"
+	.string	"El\345?\347\f\225\2349:C\324\2107U\371M\030\230\275J\201\260F\374\214Km\222\312\\\241\215\333K-\362\223\211\355%\352\026\265!\n\027\205k\333\210|\021\312\002\254A\324\026\f\347\223K\313\231\325\"\353\0314\343\311\325\214\321\204\321\204\200\353\351l\340\202\346\223\251\301\003M\030.\230Z\315\037\027-\234\331\302\267dp1\271\036h\302\340\342r>5\340\242\331\302\232\301\204\321d\021\343\311\334z\301\302\311%\203y\323\274\300\271\200\2263\204\027O\347\001\315-,-f\326\315\026V3\003\001\220[XL.\030M\026\315\030\314'\006\312-\254f\214\027\020pi5\237O\031Y3\234\025\325|:\263\244\2620\220\322z\301\214!\225\365\334\222\212\332ag\007\315\247\024\227\323\371\224Jv\321\375\026\330\212\021\022\352\362R8\216\256z\033\314\\\365\274\342\353\245\374A\321uY\270\302\036\361W\305W\275\307K"
+	.ascii	")\250\336]\270\243\372\"a\225\354U\n\300W\331O8\365\025\030`"
+	.ascii	"\t&\236z\352m\224 \361%\016I|\005ga\334\"\360\251=\350\016\311"
+	.ascii	"4\024A\216\324\365\235\030\261\326#\2765!\315\204\210\377D \021"
+	.ascii	"\215\006\006\350f\261V_-\344\302\247\347\004;\224\330%\256J\260"
+	.ascii	"e8\303\322\266\005\352\204Y\004\352\307\244\241\373\033\313b"
+	.ascii	"\245>\202\210\\\250\244\236\200\036\244>\351C\223-hpP\b\261\020"
+	.ascii	"\226\210z\217\003\214B\377\242\325\250\357\"gV\224\344\360\""
+	.ascii	"$\001\365<T\240>\351\226F\375\"2\365\36455\370"
+	.ascii	"\365\323\307pI\233\276\027V\r\3735\302\t\207\341\226nz\247\277"
+	.ascii	"\246\357+0\354\020\021\342kj@B\241\204\370\026\354V\243\363\303"
+	.ascii	"f\261zRL\357B\306ez\016t\274QL88\001\312\255B\366>-\375\322\267"
+	.ascii	"\235\341\373:)\275^S\263\264\2276\240Ez\245O\316\005\031|\337"
+	.ascii	"\367m\372*\227NB\306\025[\250E\372$_\202\364V\205!\276\312G9"
+	.ascii	"G\337z\206?01\336\230'\351\r\260K\rx\215^3_\3336\264\207@\250"
+	.ascii	"\340\337\265F\030%\243\245\266\350\215\216\024}r\215\357\307"
+	.ascii	"'\311\031\256P\202`\230+\222\033\242\220\244\306\203{\264\364"
+	.ascii	"^j\211~\351oD\017=C\222}\257\323\367\n\201\363\250\2210e\025"
+	.ascii	"C#\"\"\242 I\222BcA\005\204 \347,4n\022\3403-L\205\226\025M\222"
+	.ascii	"\224\332\277"
+	.string	"\003\231\204\253:\324\227\353}\\\352IoT\246\260?\261\t\232\027\225\237\230\214\025\326\022\3137\341\032\f\031\005\274\330Zf\224^\374v\351\204)\260\3510_/\263t\221\177\261\317\336\360\271\362C\211\317\354>\333\"()\336d\352\361$\305\212\350\250\f\206\346gB,\026\272?\257\035\343 FY\350~\202s\376YUO\302sX\2016\246J\310lr\264{%]|.\025}<\251\341[\345\251\002\357\304\203\351\360\214\2644\246\376\220\204\006\256C\\\342.\032\327\001 \006\355R,X\325\311.\246\263\316\335\363\371ey\016\226Cy\035\020\017T\304\177\3636\034t\341P\307\207\307\316\263&\337g\025le^\376\366\226\306r\005\233\327\302p0%\232r\334\004\337\226\211\223\026\336\b\323\016<\177\n\256B6mR\373\213\003\377\216\343\203X\0363\3065\034\3121\026|\316\253\\\264cF\037\027\002`\357a\323"
+	.ascii	"x\214q\3602\244\347Q\3616\233N\300U\323\317\261!\026'\364\255"
+	.ascii	"\204F?\234\036$\223\3774D\357\345U\214J\375\243\177\201&\210"
+	.ascii	"(\363\027a\032\234\365^\270\031K%\227r\221\326X%\n\316,\315\255"
+	.ascii	"\323\300r\320\223<\237\227a\005\020A\025\211f\334&\305\233C\036"
+	.ascii	"\025\305\244Ug\306.\314\246\022\032\263\315\247\245\\\375\202"
+	.ascii	".J>a\002'8\006\253\177\n\020\027\310D\004\223d\026oV\326\226"
+	.ascii	"y8$\"\026zF\366\027\001}\303\207g\037*L\237\300\273\351\272u"
+	.ascii	"k\205\261"
+	.string	"\276'\226\203\337\360\003\fo(\311\315a\205t\301% \315\263\346\235,\335\257\007\305_\021_$\225Cf\033\206\210\324J\353\331\352\r\034\250g\314\2276\005K\267\274\325\nEC\026F\301aW\b\306\231\204\250Xvn\3169\303-,2H\354iE\2005\263\t\316\033\376_\2753\b=\3607}_\373\254L\210\350<\367\345\0059e\001\2223\177\004\276\274\372\313\242\240l\346\256M\016\321\2676\250\023T\205\b\321z\250VQ\020\261\033\214#\252\333\273\r\027\345\211\377nT\243:H\332\022U\003\nc\027*\204\323\022\365\306\307\373\242\362j\"\241\223\306\314\244\003S\343\225?C\344\3223Jo\2563\251)\"\035(\364\344\233d)P\303~C\025`\310p\311\324Csh\204w\267\340\226\024\310\314\024\0221\240\253\371'j\207\367@b\177>. \262B\312I\016\002 \317\376\310l@\362\256\021t\372'"
+	.ascii	"\372\243(\265\032 \351\001\022c\310~;\363\322\365\205\211\365"
+	.ascii	"/|!5,\240\340s)\001\243\225\342S\036\270\273TO:\206\357\362X"
+	.ascii	"\234\334\307\347B\345\234\370\351\312\362F\373\001$\2663k\021"
+	.ascii	"\364R\270\347\033x\365\377\034\026M^\320l\343%\207}\372\3652"
+	.ascii	"R\246\321L\036R\336Pi\317\343}_\316\313\b+q\007\307\027\272>"
+	.ascii	"\301\320\357\226\256P\t-w\271\242\324\305\361\342\267#\3436\272"
+	.ascii	"\f\357\245\343\225;\243\221y\260\256\241\272\364\213\217$ir\357"
+	.ascii	"\262>\203\030\030\370\314&(\334\031c\346U\371<\253`\033\310\353"
+	.ascii	"Q:\350D\336\001\372@7Z\347\377\213G5\253\321Nv7\232Co)\223B\007"
+	.ascii	"\264\356\265P\220E\002\355\335\332\362C\274\034Vw\216\315\001"
+	.ascii	"FkYKqi\0212\331\263\207!\216\252\376\3102\230o\360\\\273\227"
+	.ascii	"G\023cM\245\355`\360\334\343\247IsG\366\202\311\241X\226K\003"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.part.0.248.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\375\n"
+	.string	"\246TJ@ \251*\035\307\340\254"
+	.string	"\003\303\002\210N\232\376P\013\2665\0308\301\203}\307\240\214*\030\325\3427\214a"
+	.string	"\245\032!W!\371"
+	.string	"\314\325\002L]&\030 $p\031bjED\325\337\310\336r\247\0245"
+	.string	"9"
+	.string	"8"
+	.string	"\227\317\257l\213D\f\332\016\036\016X\210\225\211\351\005aw\267O\025p\360\032%\350\337u\313\t5\272*\240F\036\033.)\031\273\353\n\311=o\273\3026\205}\214\273!3\t\013`.(\360\326\355\033\020\371._Z\242\207\241\250\261\244\022\330n8\361\351\030\355\0378\013|\030\262e7\200\002\330n\230\371\264D\3453\342\030\355S\336A\373\f\027\376\353\b>|\002\237\346x\323\367\264OJ\203\323\203k\324\233&\220\342\314\224h{@\361\247\353C(\213\020+\351(\252\312*/WS\266\214\216\032}M\256X\f'\001\036\216\216\263\331\370t\272\357\003q\013\3464\335\347q\033\347\261u6\035\234\215\373<\233\006c\017\244\373\266\217\347}\333\345r5\345\212l\026#iIUe;\252\355\314\023l,\030\354n\025"
+	.ascii	"Gc\034\255\300x\340\373\002\275\243\302\013\202\003D\3010W\270"
+	.ascii	"\275&\262\036\035\205`\313\363vQ\355t.h\323e\347\002\300\311"
+	.ascii	"\213y\247\245\351'\2241"
+	.text
+	.section	.gnu.lto_tryArm.part.0.253.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\366\005\035$"
+	.string	"6\377\334D\200\252Mc\261$L\305\230\013\f\352\364{O=\006xB\256\276K\3071s\016"
+	.string	"=\207f\n\372\221\033S\tC\265)\233\362\246=\351[\374lo\266\203V\213`g\242\227\032\317\021YZ\322\366\336{K\231R\302"
+	.string	"\301"
+	.string	"\312"
+	.ascii	"Z~\027\227\322\271\304\360\223\226oI\317%\006\002\237\360\006"
+	.ascii	"_\204\231\301\"\273W\b\341\244\027\234'\021<\250<9~"
+	.string	"@\371,[\306\265\\\340\n\314\267\362\255\031\3272yE\234\341W\271\220\306\265,\024%l\n\353\336K\243\364\263\224l\024=y*\266\225\236\234\332b\027\036\271\357\022s\302Bv\357\275\235\264F\236\036\245\315N\263$G[k\251\277t4\353\t\206@\3718\315,\232%8iV_v\206@\365\270\211\006\235j)\205\006\177\225\034\203r,\001\276\315\023\217\361\001\321KOS\035+0\030uk\013\372F\004\367\336w\275\332\b\366j\025\360\232Yt\357\365\231~\334?\267}\3056\316&\267\002\376\327\321\030\371J|\342\250\036xT\236\254\226\350\t\325T\226\024S-\332V\355\334\212z\340\355\273Nc\343\305d\017\261g\227\252\255\262\255\335\026\213\305\242-\225mV\0070\253\001\230\325@g\265\r\255\376\231U\327f\325\350\254\232F\253\236\231\325\347\254\3324\253K\263\232<\253G\263\332\232\325\365\\\367\025\334n"
+	.ascii	"M\335\233\243\310\347\006!\303\\\235\353\017\363*$<\002\365T"
+	.ascii	"F\311\274\242^\215\246\261\213\032\"\026\331\365\t!\fOF\206y"
+	.ascii	"\266F\023\223\220\nUJ~S\267\223\026\236\037`\337\017#\306\250"
+	.ascii	"\227\322\275\214\202\361\360\\z:\271\254\370\020\357\275\022"
+	.ascii	"N/]lw\f\273\270\003\024\252,\017@\233\265}9I\245\324\276\200"
+	.ascii	"\200\345\361\220\212\307\314\212\270!\033\373\261\376\235\343"
+	.ascii	"I\263\322*\026,\2245\373c\353\360\247\006\265\246\255\331q\370"
+	.ascii	"\233\352y}\f\312\016|\3672)\240Y\324\376\327dfiV(\317\217x\332"
+	.ascii	"\231\275S\037&_x\235\f\347\275>\n"
+	.string	">\235\213i\360\225\234\364\006\016\034\354\004$Z\326\264\217\232\363\345G\264c)g\374PI\3322\214\264f\2214R\244~k\253l]9\332\335V\034_-s\201:\340\036J\373C\210z\340hmg\360\200\371\354\222\203\252M\242D=\320\357\372\351f\b\006\341>\233\267\361\320\204\307xLy\362^\316 (66\2055f\355\232\003\357\374Ce\265\326\336)\252W\213\016fA\304k\241\333\301H\322\341N\340v\007\222t\274\243\034\210\024\271\026(\216xH\030V$!\271\330\035\021\340\215\310\271@\022\001#)\267\333\305\300\375\030G\224\333\351p7\234\212[\022\322\221\213\033n\307\273\021\005Y\367\"\267\273\301\320\351v7\324v\375x-\225\213\230l\017\265U6\2205`\275\221F\332\276\274~\244\214\bf&d`J\265!\025\026uF\250\345S!\245\235\022I\253\b|E\261w\327\034#?\314\361Fe"
+	.string	"[\343l\251\361\3252#\365\032\235\367^\n~\237\027S$i\222\324*\265*O\006\260\023\340h\271\221\203CG9T\002\230\r\251\037*\201,"
+	.ascii	"\353\352$Uft\005dM2tj\231\246\034LH[\365\346\266\006\365\367"
+	.ascii	"\251\223\322N\237\244Q\352\003\200\202\250q0%\221C\206FDD4\005"
+	.ascii	"I\322\001\200\002\2212\253:\021\200\301\2045\205\264\031\r\027"
+	.ascii	"\366\273\234\250\344\307\272\336\2545]\313\226\252(Iu\fA\210"
+	.ascii	"\324F<E\320\377\314\241\223\0223J'\027\255\265\356\276\300\366"
+	.ascii	"ms\332\310\361\302\336HH\262T#@\r\\\204X[4g\364\232\025\351\332"
+	.ascii	"\232\030\023\234\025P&\344\276\353u\303\234\307\316\013\021^"
+	.ascii	"\r$_D\377@\022\332q\364\213\025t\215+\021\300J\205[\264\314\343"
+	.ascii	"-\300J\230\2332\036\334\323\307\250\bh\232\264$\256\213\300R"
+	.ascii	"pX\317\351\027H\\\346\213\322`K;zU\225\234Q\342z^Oo6O\365\202"
+	.ascii	"\347N\246\341\335W\255\220\n\377\301\234\251\235\2764\200~\304"
+	.ascii	"\t\274\244\243\034\034h\017\013\007\031\340\313\221\3245\255"
+	.ascii	"\311aqX.\226!\275v\306Y\322\265\204Ul\237\005\251\377\032\035"
+	.ascii	"\215\274\262\203h\255\340\002&\365\217i\260Z\026\355EQ\262q{"
+	.ascii	"\223X\210\323"
+	.text
+	.section	.gnu.lto_.symbol_nodes.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\023\022\0258"
+	.ascii	"\032XD\0239 \250N\007\303$A\240\354%\020\262\350\345\302{G\220"
+	.ascii	"y\240\314\230!#I[Z\354\314\201,\216g\006\230CZr:uq\030\306\024"
+	.ascii	"IEau\020\006m\002\202\260\264\223\f(\001!\001$\001N)\310\366"
+	.ascii	"J@\266\317c\333\345\210m\017\363c;$\037\333\001\303\266\307\001"
+	.ascii	"\333\316\326c{\233\257\355n\274\266\277\351\332\316\206\307v"
+	.ascii	"8\376\276\257\326Z;\266\223q\035\333\273\344\330\236\206c;\227"
+	.ascii	"\033\333\321ll\337Rc\273\226\225\306\366,\353\fwT\224\241;\025"
+	.ascii	"cl\307\262\302\360F\305\027\333\255\270\330>\245\305v),\266\303"
+	.ascii	"+\266KUl-jM\341\213P8\242\342\t\247+\232\360B\207%\266\203ZI"
+	.ascii	"\350\301\342\210\255\017Elm\270J\337>!\266.\\A8\237\017\276\307"
+	.ascii	"\203\376\324A{\342\240\t\213\033\266#rm/\324\260\275\323\032"
+	.ascii	"\335\316)\203\273a\3601\027|M\361\225JaD\350\366M\253\005\267"
+	.ascii	"S\254\340v\024\266WY'\270\244\342\277\022<0\302\366\263\025\202"
+	.ascii	"\313=\360HO\027Tt\260\235\312\332`\373\025\006[\207Z?111\321"
+	.ascii	"\2715\250u\201NT\240G%\360\027\201\227\271\036\350\200\303\025"
+	.ascii	"h\272\232\303e[\032\261\250\2656\276R\351\313G\353\255\265\035"
+	.ascii	"\232K\275\357\373\032\330n\266j\255\225T\001r\241\251\377r=\351"
+	.ascii	"\016\216M\317MI\275\203\222o\204]+\002\264\247\215&\224\374-"
+	.ascii	"\227z\251I\251F~\266\350)\213\304\2433\323SV\351\347wIOY\004"
+	.ascii	"s\310d\321SV\343\325\255\225\351)\333\306P\360N\313,\253\251"
+	.ascii	"i.\311i@\3761v\337s\2648\344\033c_\331|v\217\023\204|\217\375"
+	.ascii	"\221\377\345\256\345\220\277\345\317\205\374\343\254\3378\273"
+	.ascii	"\0023U\265\250~4\333\377\330\266?:\263\335\317\314\366j\231\355"
+	.ascii	"qk\333\247d\266\313c\266\017\022\263\235P\230\355T0\333\357|"
+	.ascii	"\331\356\307\313\366?j\333\001u\331\336\227\266\235\217\313v"
+	.ascii	"Fh\333\367\266l\327\323\262]Q\226\355yX\266\343]\331\236\350"
+	.ascii	"l\373\235\225\355\207\252l7De{\335\224\355sR\266\317\201\267"
+	.ascii	"\3231\333\336G\272]\217\227m\317\343\357v<{\373[\224\355u\240"
+	.ascii	"lW\363d{\354d{\232&\333\333\230lG\263d\373\031%\333\315$\331"
+	.ascii	"^\006\311\366\265#\333\305\030\331\016\246\310\366/D\266{\031"
+	.ascii	"\262\335\222\220\355\223\310v\337\004v\277\211\314\345\276\223"
+	.ascii	"x\223\373Q\004\335\2172W\335g\245X\315\004j\354^\r\251\371F\031"
+	.ascii	"\260\371>\327|\227\266[z\216\371~\314\367\231\371\216\230\237"
+	.ascii	"\224\0371\237*v]\207\211\315\232\354\353\2250\224\324\250f\346"
+	.ascii	"[\301\177\314E\004\252\313FX\377\301\016\353=\256b\375\226\303"
+	.ascii	"\210\3327\312\306\031\361\030'j\237\215})\250\247/\332\"\305"
+	.ascii	"\320\365%c\227Pmk\213\266\001\336\b-\001\210\001PQ\345\265Oe"
+	.ascii	"e\245\250}+\2452\366_\324\276\262m\221\355\267WW\361\264\375"
+	.ascii	"\253y\t/cw\263C_\356\226r\264\375,8\253\315\237m?k\326\202\335"
+	.ascii	"\265b\275\366\265\346.\330\237\332~\227\214(\332\276\027\354"
+	.ascii	"5{\205\277Mv\264]\373`s\230\354M\267\276\027\366)7\207i\032\257"
+	.ascii	"}\261\330}\355n0P\264}\261\331#0JS\243\357\332\037\333k\177L"
+	.ascii	"f\324\376\330\354e\232\257}2\270\257\375#l\214\017)\377K\371"
+	.ascii	"\3119\t\323U=;\327U=k\250\352Y\3305^\336\037\365\253\352\215"
+	.ascii	"\261\007:)u\001\242\374\370\b@\3778\217\202\376Q\252\204\276"
+	.ascii	"\021\260\n\372F\271)\350\033\333\222\320\377\202\"Z\370-Q\021"
+	.ascii	"\336\017\037|R\316}~2\036|>;\023>\237\215A=\335\020M\"U\027>"
+	.ascii	"\377\030\352i\370d\360\3066\367%\203%[\\\25499\237\235;9\237"
+	.ascii	"\215\235\177\364\344\374c\233;\033\275HT\246\363\215{\316w@\347"
+	.ascii	"'\347oEr\377C\236\373\306\231\205\3714\325\375\244\234\373\240"
+	.ascii	"3oM\367\001\300^\314\243I\326Uw\315\233\236U\354R\206\002\335"
+	.ascii	"t\325=\203\233\365\354~\033\267s\240\373W\360\225\234v\377j\326"
+	.ascii	"\222\334\307\222\355\242\356/\343I\356/\263(\271\237%\373\312"
+	.ascii	"\345r\3119"
+	.string	"+\243+\271k\240\304D\304.9\352\276W\354\232\323\230\2625\260\030L\366\327\0228\352/L\016\233G\351K\356\213\301Q\367\307f\262\330\275\222\373d\262\273%\367\311f\367\205\304Ed\327\202n\202R=u\337\b\354\3153\251\235\250\373IdL\356'\231}@`\341`\234\311}%\262g\031\022\302iMn\201:\250a\024G\251\226\220$IA\262\214\001\261\005\204)\006Y\331\001\021\340\034\204\n\221\021\221H\"\031\221;\244\232\200\312A\374\301\340\261\247[b\252\311Vc\211<\301\021\023\252\326\013\"\307\335\3462p\0255\373\314\200\212S6)\215\240\\7\2203\352[\024\212\243\210\016tP\376{:\276!=\363\223s\312RGS\032\343\226\260}R\226&\2227\001\214\2641\0328^r\027jx\250\017\340\0024LB\341\266\316s\2306\342\371\nN\013t\201\n\036?_\313%5\354\302\364\370\346g#"
+	.ascii	"\302\327\322\376\345q\306\342Q=}\267L\200\257\315'\322\204\032"
+	.ascii	"\366\245\241\246\231\020\373'=\232v{\230\254\303\023\333\351"
+	.ascii	"\366W\351\205\322\375mcTh\316\277\036S\351\253g\022\321\313V"
+	.ascii	"\201\234t\300(\273\235\030Qg\"\n\375N\350~\235\223 \217\207\313"
+	.ascii	"{"
+	.string	"\354\256B\216\211{\234y@C\036Bxtn\322(:N\f\313\207\\\257\275z\r\340V\202k\202\023\256\206\344\005\230\024\361P\274\342nG\325\332#\247\256E\217\334\301ZZ\305\320\243\020\323-\237\\\366 \233\177nb\224Q\250\256\006\n\211\374,\344A\030N\016J\001\255\343\305D\r\265(y\245\304\355\023F\303l\017\231s>\352~\232\220\027\367vc9\n\227x]\370\300U\373>\365w\260\304\3674\250\216\345]\305\273s\032\377\342\351\334\215\257xwN\343_<\235\273\361\025\357\316\271*\260zI\t\253\034\340z\326\340\354\231\2057s6f\315\033\234=\263\360f\316\306\254y\203\263\351_\200K!\361\300)\205o\031\001.\355om\273\313\261\317\265X\366F\363\343\254\032\371)\2376\3351\354a\331\3726\345\224I\250\350\236AC\206\257\246\271\374 jl!\245\311\306\256\002#'\207\023\205\nJ&"
+	.ascii	"|BJ=V\314w\323\237\007|\361\302\355\250`\337\016\204G\f^\f\006"
+	.ascii	"\201A%\220\310\262\025v\037\305\360\025\206\034\314=a\356\210"
+	.ascii	"r4m\007\bZ\206\002\240\202d4\357\005\276*"
+	.text
+	.section	.gnu.lto_.refs.465044fd387aff2c,"e",@progbits
+	.string	"(\265/\375`\036\0015\013"
+	.string	"\246\035O7@k\232t\033#\345\013\310\022y\346\216\242(\212\242(\212\242(\212\242\250\031\304\362\240\031\001\222\211\334\306\263\"\330\332\3200\232\375\267\366\261EL\352\377o\304\210%[\246<"
+	.string	"@"
+	.string	"C"
+	.string	"O\261C\360\033\247\303\330\033\016\377bW\234"
+	.string	"\314M\354\017\276k\276p"
+	.string	"\312N\371\326~\344\021L\237^\227\362%\357#K\207\\\207\274w\226o\332\241\353\214\362K\373\226\337~\363\371\020\017C\350\037\3203\223\276d\t\270\233\017\350\265:\321!$>\022\360\217\325!U\207\322?\2627\362\035\325\225\354\231G8n\261S?\202\364\026\371Q\324\233\350\235\344\210\333\211\335\001\377A\357\036\210\013V\177\254o\250\356\310W\244\017,\277AC\006\212>\206\013\024\277\205\n\331\247\220\377\204\353\227p}\306\365\231\201\257x\376\252\372\004\353\023\330K`\275\302\372\204=D\325%\254K\260\376T\017\257g\362\233t\201_\252\031\275\324\020z'?\350\016p\b\237\211u\340\032\344\211\361\315f\2207\262\376\262_\262\3360>\263\027\270\227\213\336\213-r\030{\302+\232\202l;A\376\332]_az{\275o\004\356H\016"
+	.ascii	"x+\206o\005\354\026\025\265\025b\213Z\311\366\264\333\262\345"
+	.ascii	"i\f\030D1H\266X\220)v*\252e\256\204\031\005"
+	.text
+	.section	.gnu.lto_.decls.465044fd387aff2c,"e",@progbits
+	.ascii	"(\265/\375`\370f\225\243\001\272\257n\227T \ni+\215\001;\204"
+	.ascii	"l@\222\f Y\251\305d\214\0304\t\304\022Q\202\240\260\325rB]\240"
+	.ascii	"-0\312w\247\205\177o\256!\210\033\3156\302}\276\034\267h\004"
+	.ascii	"\313-\352CC\335R\264\255j\315!0\344,\323\224r\346.N\354\356~"
+	.ascii	"\333{o)\245L\0016\b\207\t\f\nX\013\026%\\\322\202\030\221q\371"
+	.ascii	"\204\244\2106\325\224\227\036\331j\005<1:p\234\\\232\035x\253"
+	.ascii	"\007n\203\007\017\233\365\300X\260\214\341\355m\354\200d\022"
+	.ascii	"!\202\246o\250M\257{T\236\3165*"
+	.string	"\037\264v>\310\312\371\240\260\363A*\234\017\242q\376\030\317s\325\217\353`;\031F\317\r\2716/X\347\027H\331O\206\227*X?\b\306\371?Oe\251L\225\243\256Zv\201\375\216\377\356\232\021\372\256\\6\206\231Z\300||\310.\362\276|\331\270v\302\270\362\203\257+\273\300y\256\234P\224q\327\b\301\312\032\262\261\275\215H\035:t\350@\026\341\312C\343\243\017\004\347,\323\234\007Bs\036\310\314y\2402'\276\363\341\030\217\006R\247\206\030\326z\356\274x\367\250\254\340\032\225\007\342r\036\210\311y\240 \347\201p\234\007zq\376'\357\374\217\334\371\037-\347\177\306\316\377|\235\377\311q\376\307\305y\237:\347}\322\234\367i;\357\223\345\274O\222\363>[\347}\246\316\367\2649\337\023w\276'\313\371\036%\347{x\234\357\251:\177\352\235?\351\316\237i\347O+\347\215m\307a~\274v\317`\270\r"
+	.ascii	"\031\331\262Q\006k\354\206\337\216\3410\030\f'\202\327\336R\030"
+	.ascii	"n\250oo\251\241{/\270\367\002=\005lIZ\251\177\222\235\227\312"
+	.ascii	"\207\343\266!4_\366\224`\3753\354\354\271F\345\317\256\363\247"
+	.ascii	"\325y3\317y\023\316yS\356\274y\345\374\3325*oN9o\"9o\202\235"
+	.ascii	"7\267\316\227x\316\227k\316\227p\347K\264\363\345\222\363u\327"
+	.string	"\250|i\343<i\347<iw\036\017O\311v\3160\331X\377\266qsLs\325\\9<nw\357M\235<e~|\004\213\3410\254\003\347\300^8\b\036\303L\260\024\274\003;\301I0\017\034\005\253\200\3010\024\334\003/\301>\260\022\374\205\215`\"\270\t\006\202\177\340.\\\004#\301B0\027\036r\325\360\023|\343x\013\34386\376\306\371\257\333\275\273\303.\376\017\370\305\0271s1\302\334.\233;c\310T\325\271\177W\216\314\233\2509</r\256\336\255\343B\300X\034\274\272\25340oWN(\212hO\241\221Q\007O\311}\260\3023\324n\035L\025\027\302\377\001?\301X\330\206P\336\033\210Y\330\336\373\003\246\301\345\332\361\201\201q\345\274\340\215\271}m\302\274H]>!ro/1a`\256\0357n\027M_\230\230\377\003\256\3522&\006\236q\353\270\0200e\2055\370\t\336\227\357\326\021Y"
+	.ascii	"\331\030\2743\377\255\343G7\002\0358o\340\310\241\373\257\333"
+	.ascii	"-\363G\366\177\3005\256\234P\336\273kK\330\336\306\337:\020F"
+	.ascii	"\300O\256\231+G\302\213\275\311\246\344\311S\214w:\216{\033;"
+	.ascii	"t\350\320\001\251\003\207\256\035gD\350\274\357Q\371\201\224"
+	.ascii	"\363\307Z\3076\3446\2601\230M\376h\344a\215\263>\034kU\320\345"
+	.ascii	"\215\rk\363\032\225'\233\234'U8O\3268OR\235\327hN,C\343 \023"
+	.ascii	"D\t\326\327s\347\365\331y\035v^\3378\257a\234?\336\243\362\271"
+	.ascii	"\357|\306;\237\335\234\317f\316\347\270\363y\313\371\034v>s\235"
+	.ascii	"\317V\347=\336;Wm\203\213\3078\204\217\344\341r\005\353\347\251"
+	.ascii	"\363w\2032\377\375\335\r\312c;'\3215*\217\327\234\307l\347\305"
+	.ascii	"\273s\256\032\322\315;3E\243\007\326\307ig\b\366E*\377w\221\312"
+	.ascii	"\343\262\363\030\311\211\204\265\316\rz'\207\271\363\203+'\t"
+	.ascii	"\367\250\374\025r\376^\235\337r\217\312\263\347\327\356Q\371"
+	.ascii	"\364|\334=*\217\302\371\272{T^\304y6\367\250\274p7\314U\243\340"
+	.ascii	"\306\035\204\021\236\243\316\206\202\374\244\370\361a\375\004"
+	.ascii	"\234\277\024\224\367\357RP>\351\334p\215\312\343\335\243"
+	.string	"\362\277m\033\234T`\324\310\330\326\256\321KJ\036\254\357\332\177\263\\-\367\313\365\332\233j\357\215\341\272\270\273\302\203\365\335r\271\\\265\fw\205\337.\327\313I)\3436\356\275\207n\036\221\251,\254\211\356Q\211\257Qy\r\316\241\257=\302\317\023\004{\337\f\345\375\373\273\031J\354u\217\312\f\256Qy\321>\374b1*\261\270\214{\313\336{H(K\n\2264\254\213\356\225\ff\024\266\037B\316(\0302\342\270\002\202\365\177\255\374\227\312%\273f\271\312\312ko\331\333XdR\201\003\333\202\3655\303\267\354\032\177\315n\225\2030\302\201\2506\331\336\306k\246\367\226\272\367\002\241{/ \337\222H])\365\361y\343=*\317kT\376\031\003\030\374\370\212\016\372\261\021\237\230\202\242l/\353\215\201\360\223\035\270\006N\200~R\225\241\005\307\355\037c@\003\265\310)\374\372\207\325> 2\021\037\377<\374uO\346"
+	.string	"\030LD\237\331\270\226-\360c\022\332\274|\177FcZ\300\377\r^B\203.\177Mz\271\300O\372\300K\312\237\004\342 \231\326\277\306E*\200\203d\267\017\247\200\241\362\002\372\f\360\347\003\360\375y"
+	.ascii	"\330"
+	.string	"+\213\220?\374x\004\236\377\356\365\310w\376\354\3011\223\360\037\305\006\331\316\237\367\376\254\227\343\374\031\316\217u0\340'C\270\243w\024/\213\243w\375\223k~\334$\253\3713\224\037c M\325\007\262\230\243\020#\323&!N\376\244\231;2?v\303\006\216\371\223r?v\303&H\026\342>?\331\005\007\3110\013)!\036\301\257\363`\220\301\225\035\022\211K\360\223E9\0337\310h\376\363\223V\360\007\304\334\370\262\032\244\005\231\002\272\233\205\314\305\362_\303&\357\217\275d\025XH\301\037\020\363\343\025\344.\227\233&\205\344\307\024\210\303(t\331\360\223<0\300\375x\216\356\026~\262Jv{\336\377\241\237\214r<\331\013\316s=\310]\276\206\22548\322\313*\3705\227?\227\370\361\t+\340%X\351F\254\204\314\300\237\261\324r\032\227?s\330\362g\037,\244d\031Z\376\333\007\226\263\230\360\277\f\337y"
+	.ascii	"~\262\370c#\031K\326\300u\373/\334\237\321~|#_\371s\372\347\263"
+	.ascii	"\037\237\260\362\3432D6\3768\317l\203\\\366\343\022\277\340'"
+	.ascii	"O\3748\230\311\376\307e*\3775\374\374\311\017?\356\373\261\210"
+	.ascii	")A8\205\275\037\227\035\377\344U&1\013)\177\306?\316y\fC\005"
+	.ascii	"\375z\316\237\243\374\271\311\237\231\374y\311\237\223\374\271"
+	.ascii	"\310\237\207\3749\310\237\301\376\254\302\237\177\374\331\307"
+	.ascii	"\237y\3749\353\317W\177\236\361g\030\177v\361\347\251?G\375\331"
+	.ascii	"\003\177N\341\317+\376\334\376\231\370\347\341\2379\360g\246"
+	.ascii	"?+\375Y\003\177\306\300\237/\360g\024\376|\342\317\023\3703\211"
+	.ascii	"?C\340\317#\376l\302\237\033\360\347\020\177\006\361\347\004"
+	.ascii	"\374\031\001\177\036\300\237E\3703\b\177N\3723\007\177\326\340"
+	.ascii	"\317\031\374\031\203?o\370s\005\177>\372\263\321\237\213\376"
+	.ascii	"<\364\347\240?\377\374\271\347\317\346\237\311?\347\037\377\375"
+	.ascii	"8\317\217\357\374\270\316\217\365~,\366c\274\037\337\375\030"
+	.ascii	"\316\217\335\374\230\315\217\325\374\330\356\307u?\356\362c\272"
+	.ascii	"\037\317\375X\311\217\243\3748\356\307"
+	.ascii	"o?\006\363\343\265\037{\371\361\226\037\027\3711\327\217\263"
+	.ascii	"\374\030\355\307\306\037\227\375\230\354\307S~<\366c'?^\362\343"
+	.ascii	"#?\006\362c\257\037\373\370\261\216\037o\3758\353\3075~|\365"
+	.ascii	"\343\031?\256\372\361\213\037S\375X\352\307\373\307 \370q\n?"
+	.ascii	"\206\372\361\323\217\331\037w\340\307\305\037\017\177\314\201"
+	.ascii	"\0373\375X\351\307\302\377(\376\313\345\307\300\037k\340\277"
+	.ascii	"\227\377_\376\227\375\307\363c\f\374\330\002?\246\300\217O\374"
+	.ascii	"\270\304\217I\374\370\204\037\217\370q\376\261\210\037\207\370"
+	.ascii	"1\210\037o\360\377\304\217\315\377\372\375\327\316\177\343\376"
+	.ascii	"\253\366\337\264\377f\371o\001\376\263\375_\373\177\366\337\312"
+	.ascii	"\177\343\377\257\377s\377"
+	.string	"-\370\373\373\373\373\203\234~$\017\374 \372\002~x[\316\237$#\323h\027\353L\003\353\303\323`v\276\203KN\231\3627\007l\251\254\017\330\244v\007\327\320\004\n9\006%J\224\fU\316\334\265\035\207\320\326\222\350a}\rH\316k\350bB6aB:qB\212\221b\332\357n,;f\023\251\241\025V\270\202\206\3655\3208?\201\235$\344\222$\244\022R\211\266;\243\364\2708\\\275\"\177_\260\376\004k\347'\370\022B\032\021B\036!\217\f\031B\026\311\360$\317\364\022\203I\032\326?I\344d\221\314\206\325F\r\333\377\236\237\266\032dN\260\376\004<\316Opu\376\344\027\371E\002A\362\222\222B\300\333\331\220\035>f[\272\376H0\244!-H\250\244\301\372\022\370\235\227\300\r\371\343\007a\004R\007\351u\315\364\346\332Qz\033\366\332\356\332\216\022\330\235\227`\314y\325H\036\244\017$\257\255\205"
+	.ascii	"&R_n\246\033\230c\016\254\311\036ZK\f\035\020\254/A\227\363\022"
+	.ascii	"H\311A\352\310\241\355\312\275\257\321\253\006\326\346\302\342"
+	.ascii	"\300\305\245\355\316(\2449bwm\307\315\305\305A\b\214\022!ZX_"
+	.ascii	"\002!\347%\260:\177\322\206\032i\203\334\302g;Jh\211\231\274"
+	.ascii	"\274,i\220\210\301\232\274!$$G\027\r\254\237\201\357|\2064YY"
+	.ascii	"\327\354\236\355\032&\f\033J\312\262\244]\261\201\3653h\251Q"
+	.ascii	"c/C\330\325U#\2574\225\003\274\244\2642(\303\266\206L\250\007"
+	.ascii	"\214+>\254\237\241\353\374I\031?\276s\337\2201\310\031\232\352"
+	.ascii	"n\255}c\330E\301\203\267\261\214\035<\303\213\363Hp\310*\262"
+	.ascii	"\252\314#\206$\367\342EN\303"
+	.string	"g[\313\007\006\030\260\256#\223)X\246\260>\022\230\363'\251\324H\252\234%WyI\201\211\300D\354\313\255\207\214\231\2752\254\217d\345\374I)R\n\306\025\260.\235G\216\232\"X\037\311\007\271\311\255\375\3129gHU}}\332\357D{\357\251\275\273|\2309\244t\236k?!\2627\274;X\177O\243\375\357\001\276\0319b}\fv\360\340\321G\024\3620\240\261cG\037\357\336{s\355\2509\037\260}\335\265\035\257\217\327\254\207I\0230\253\267\275=\255r\310T\230\024\254\217ALO\357\352I\335\265\215\005\321\263\242\303\372\030\254\346\314\321\373\3521\202\343M\030\326\217@\316y\035\347j9WM\313\271|\034\266T\024\007zb$\327\026\021)X?\0021\347\357\345+\177\r\347WM\303\321e8xm-\0010Y\273[;\356\315\325\001\t\205\212\033.\254\037A\332\371k7j\332\315]\303g;\212"
+	.ascii	"_zc\306\366\346\352 \bJ\233\216/\254\037\301\222\363\327l\330"
+	.ascii	"\\\271{\266k\370\304\220\312+;\356\035\327\301P\035(>\216`\375"
+	.ascii	"\b\246\316_\263\253\325\374 \214p\325\264\232kv\215\273\306\321"
+	.ascii	"\234\274\273\266\343\306\212\353\340\307\316\0162d\260\376\321"
+	.ascii	"\232\363\332\214>s\215FM\243\321v\347\336;\312\270k\\;mwmc\233"
+	.ascii	"\013\213\303\377\275\253\246\355~\020F\370\035\320\336d{o\r\344"
+	.ascii	"\031'J\322\260\376\221\330\371\337\343\277\334RX{o-\322\270\261"
+	.ascii	"\246\200\312\377\376\222\367r\370\203n\276\030\374\327\371\277"
+	.ascii	"\300\320\270]\300\001\331{_:g\223/R<6l\262no\252\257\250\005"
+	.ascii	"|eQ}\345\250B\373\312*\252B\373\332QTJ\242\212\260\366WT\025"
+	.ascii	"\332\336ETTQ%xeU\241I\355\242*\264\235\265]\234\311\272\333\370"
+	.ascii	"\025\265\251\274v\321\246\332R\033\315+kC\025\325WV\025\232T"
+	.ascii	"VQ\025\332W\326F\373\332D\233J\n+\006\325\306*\332h_s6\232W\026"
+	.ascii	"Q\025\232WV\025\332\227\230[D\206\033:[o@\216\024\271lUT\233"
+	.ascii	"\306U\017),\242\272*\243\327f\263\367\335\362bc\355\272\2751"
+	.ascii	"\330\273\207\027\026\033\251\034wm\252\216\306\324\nR^\327\270"
+	.ascii	"\367\316p5\005\346\265\251\352\242\356\256\253r\342\265\267\223"
+	.ascii	")\246}\265\367\336\"D\031\353v\221[\027\005\244\307\266z\261"
+	.ascii	"\267\004\333\270\367\325\336Qw\327\355\275\243\366\336&V\017"
+	.ascii	"\343\336;\210\252\302\256\256\366\346B\272\332=\242\330^\354"
+	.ascii	"\215\267\270Y\313\252B\003\363\372\300\226\005-l\3030F\335*+"
+	.ascii	"\257\035\266\331|a\235hQV\266\325\336\373\352\235aY6\362\260"
+	.ascii	"6\376\254uq\271\201\265\2463\243\360)\311\303\372GR\347\234\036"
+	.ascii	"C\200\215&\354\316\\\234\226\003\272\222\323\222fM\\\030\r\027"
+	.ascii	"\245\006\355\b\326oCa\366~\254a\375\013s\347O\036#W\027\030\335"
+	.ascii	"\346\203cjjc\375\013+\234_\364\332\325\333SVN\276L\031/pE\241"
+	.ascii	"\241\246W\3009f\210i\rQ\333\242\271\234h\356\004\231\323\332"
+	.ascii	"\242\263\364x\355\270\"\205\365/\310\320X\256\317\274\202\262"
+	.ascii	"\024\0162_\260\276\002$\205\303\213\031\254\177!\352\374\365"
+	.ascii	"\231\225\020l3m\305X.I\023\247\005k\263\036\032og\242`}\2438"
+	.ascii	"\347o]\2226ae\302\304\310h(\032\211\033\r\005\263\3410\267\216"
+	.ascii	"K;\201\2037FC\321E\364\221[GD\223\275\301c\242\227\b\345\275"
+	.ascii	"\245\350\302\366\336\032\212V\242\227\230I\244\312\302\216{\357"
+	.ascii	"\377z\212\226\242\251\3502\035EW\321c\232\354\252i(\272\311\265"
+	.ascii	"\023\375\204\264q\326\243\212\005}\353\356Q\251\341\032\2257"
+	.ascii	"rr\336\250\310y#\025\316\033\355X\362\347-7\316\225[\227\350"
+	.ascii	"\310\202\365\215n\2347\332\347-\2649\177m\344\372\310\345\273"
+	.ascii	"^Ct\222\340A\202\365\355\362\341\332\310\032\334\213>\254o\201"
+	.ascii	"\216\b\020\023\317\030\335\022\rD\327\320>\262\025\254\007\240"
+	.ascii	"\271\303\233qg\314\225\006\323_Z\210VA\007\321C\256\232\006\242"
+	.ascii	"\273\256\177h/\252[G\003\3211\370\360n\035\031\032\210\266:\342"
+	.ascii	"\355m\354\320!\b,O]\231\220\276\306{T\"]\243\362\026V\350q\213"
+	.ascii	"\250\245\275a}\013e\347\177\255Cs\351\035WM\363\3208\256i\334"
+	.ascii	"1\327[l\310r\350\033BTD\233\n\314M\030\017\215\245o\210PE\253"
+	.ascii	"\211\330q\357\215\324\241C\007 0dy>N}\013`\347-l\235\267\220"
+	.ascii	"u\352,\255u\325\376\246m\024\t\023U\004\353[\210qB\355\275\367"
+	.ascii	"\375[i\376\255\274\005\027\347-D\235@\327\250|\321\235\363Eq"
+	.ascii	"\316\027\325\235/\232;_\344v\376\272J\277\020bb\246\n\017k\375"
+	.ascii	"BoMu\353\266l\251,\022\252\264\035qr\3240\256\232~\241]h\343"
+	.ascii	"\336h{\357\016HX\214\232\233;\255_\244u\352(-u\3258\350\251\343"
+	.ascii	";\367\315{\250\214\033mo\343P\217\032=\037[\260~Q\214\363\227"
+	.ascii	"C9\364\367\367\367w9\224/\222:"
+	.string	"\377\374\227\375\324\276T\341\302\372\177\356\313y\256Z\366\313|\327\270\267\021\317\b~\371\016\nZCv"
+	.ascii	"Q\251\362&\243\324'\202;Od<O\244\344\374\363q\317gK\0369R\260"
+	.ascii	"~\bl\334\2549\023'\337e9\031/\277\311u\262^\246\223\363\362\234"
+	.ascii	"\f'\333\271jy/\267\371E\313n~\337\330\335\265A#'N\2328^\324\300"
+	.ascii	"\021Cf\314\334\225\353\023\223g/\257y\203\367!\357e\272lF(\312"
+	.ascii	"\270\243\312/Z_n\307\275w\207\016He\231\221$G\t\364\255\272G"
+	.ascii	"\345\211\246\316\017\351\235\0372s~\b\356\374P\226\363Ca\347"
+	.ascii	"\207\276\316\017\3158\377\\\367l\346\030n\003{S\225UT_N\260\316"
+	.ascii	"e><\327e6Yl[X\223\327\250\274\020\337y!:\347\205\314\234\027"
+	.ascii	"R;/$\345\374\263\\v\323el\370=\351\302\347e\355\030\347\313\235"
+	.ascii	"7\331-{\301\023\227\3372\\\016\223\301\\\265\354\226\333\262"
+	.ascii	"[f\333\372jN^\336\030v\223c\211\f }\241\252\363B\373|\320\235"
+	.ascii	"\363Aw\347\203\332\234\017\"s\376y\005\016Aw\324L\215\251\245"
+	.ascii	"\255\340\342*\303:\247}\271^B6\260\214\355\300:o\371\360\314"
+	.ascii	"\005\001G\200L\301:k\311r\355\220\351\321$g\311=\256,!\003\207"
+	.ascii	"u\334\230\032x[k\372\302\322\320\031\263fo.\254M\335\214-\273"
+	.ascii	"?\274\017yF\227\260\255\2738ytx\327\r\257\r\236\031\232\024\274"
+	.ascii	"\353&\307\315u\233\203\246\f\2304~fV\310\302\322\320]\341-5`"
+	.ascii	"y\336dY\242G&\356L\f\274832\302\342\312X\205P\226\246\fS\251"
+	.ascii	"b\206\327\003\037sU6\256\2310%\207\267\367\306\\\324\212\320"
+	.ascii	"\261\341\013\303\\\276\370\330\202%\311\230\025\210\304\221\241"
+	.ascii	"af\254\202\343\346\\py\211s\207W\347\245+\214\n\331\026\263+"
+	.ascii	"A\246l\3417G\274\205\335\334\3013;\243\362\006\216\034\274\374"
+	.ascii	"\225\225\344%YH\216\222\273\262\n\231J\306\312Nr\216\\$\343\310"
+	.ascii	"H2\221\314\225\301\262\221\274#ke\0339H\306\222\207d(9,[\311"
+	.ascii	"L\262X\326\221\215y,?\311h\371H\316\312?\262W\366\221\201\344"
+	.ascii	"\262<%\223e)\271Jn\222\257\344\263\234$\363\310[\331,\337\270"
+	.ascii	"j\271G\276z\246\221k\254\211\361\005\017s\311=0\033\016\223\215"
+	.ascii	"a\"\260\360\b\001MU\030]\027l\026T\340\004\301\372\037\334\235"
+	.ascii	"\277\231\307\212\0060\254\326\372\310\200\266\2342-\276RLH\355"
+	.ascii	"E\032\035<\244\017\037)Vs_\356\224J\362\334\227'Q\216\246\235"
+	.ascii	">!bq\306$U;\350\352\354\3410#'\217q\216\337\2266\254M9\246\034"
+	.ascii	"S\257'\n\205\263!;\306\364\362\260\nz~]\362\346\364\344}\325"
+	.ascii	"\361\341\221`A.\322\236\004\301\313|\246\230^\\\036\326\377\300"
+	.ascii	"\314)TBA\002\203\r\263ac\302\371\221\001\023\251/7\023\216\371"
+	.ascii	"fG\036+moL7@\214\244YB\366\360\031\203[\213b\266\311mz\226\320"
+	.ascii	"\211\275\301\372\037\254q\242\306\214\322A\026\"ii4\025\227\273"
+	.ascii	"\272\031\270\256\316Ds\261\260\266\007d4\300\350\234\271\211"
+	.ascii	"f\310\315\22071X\233f\362\031\277$v>\b;\177\263LW\2208l5\260"
+	.ascii	"6\307\230dn\322\335\244\303&]\376\373+\253\330i)\365o\316i?\277"
+	.ascii	"<,lb\272\234*\b\301C%\227\344\215\317N\016k3\f6\341\314\270\233"
+	.ascii	"an4\303X\3207t\357\005C;\324\342\304Jm\256\255\231n\267 u\304"
+	.ascii	"\347H\343K\314qs\335\340\360\233`n\272\275\221/\340\3209\203"
+	.ascii	"\265\331\3667>.fvX\233l\177\233\243\003\373\361\017f\234\277"
+	.ascii	"\371\345\362\2259\\\360\251y\321e\3105\031eE\272\224lY\242\274"
+	.ascii	"\331b\256`f\035\305\244\211a${cG*\315\344\001DvV\247\213KY\304"
+	.ascii	"\034\263e\024\333b\316\300Hr\304\371\241\205\004RJA\023\313\222"
+	.ascii	"\205<b$\253Q\343\210\027\032\271\205\217(\341#\273b\232\351%"
+	.ascii	"k\226$9+\325\\'3jT\261\242\321~\306\234\365\301\231FR\217\r\020"
+	.ascii	")3\2606\313\302\314\226\274\301\372\036\364\316\337\254\242\355"
+	.ascii	"4\027\035D\300\310\256\034FC\306j\212\n\231g\316\224:H\260\376"
+	.ascii	"U3\247\350#\003\362\254\202\230R\246\330x\005\261\302\332|b>"
+	.ascii	"1\243\370\020\302ae\007Ns\361\212\333PnF!\261\324\260\220\301"
+	.ascii	"\372{=onN\336\3245i\242\375.\221qjM\221\260\240&S\366\270\260"
+	.ascii	"\276\2076\223\211\311D\333M\375\265i\272:;G\254\357A\313\222"
+	.ascii	"%\332\016\315_\333Q\273\315E\321\302\372\036\232\230G\314#f\022"
+	.ascii	"$\257\2509\"\330\221\322\033\343s\205\b\036\225\211\344f\022"
+	.ascii	"\r\367S\007\215\r-\314\031\034\020+\254\357\001\314,b\026!\273"
+	.ascii	"\234\351\215)\312\273\362\206\365\223\374\314!\346\020\355G\307"
+	.ascii	"\212\312\232\224'seX?\311\215\031\304\f\242\375\312\344\351\215"
+	.ascii	"9v\225\001\343\004\353'\2251\301L\260\256+\261\276#\220\230\033"
+	.ascii	"\030\036X?)\315T\301T\001\207\020\2353"
+	.string	"&L\260~\222\230\371\303\374a\316\330k\362\327\206\233\260\231\023\006\353'\3710}\230>\366\256\374\265\261\201Q\241\013\353{p\307\306M\0356L\036Fp\220\366\024\325\356\352a2\271\222\243u\334U=8\220q7\322t\231;n\362\370\033\217 YTX\177\357o\377{\364\026\033\0252X\2339nr\375=\346\2324sgX\337\003\271\323\334\272\211\343\357!y\330x\343\004\353{\340v\376\346\215\277\007\210\310\030\272<\254\357\201\227\363\036\244\2315\314\032f\226\311u%$/\215K\2263\254\253ff\221T\332\2149\344\376\367\220`u\340|\301\372\036D1\257\314+}<\212\033\242\323\345/\f\326\367`\313\214a\3060g\260\255!\033\313c\254\360P#\343\346\f]\004\316\326\233k&C\013\214\037\f\030>bWg\342\314\370\320ta}\001\2541]\230.\264\235\331\343J\315\216\261\\\205*\314\nX_"
+	.ascii	"L\314)sJ\333\371@\271:\0237\326S\026c\253\f\326\357@\216\237"
+	.ascii	"\237\031\205\344\025UGH\313\312\016\334\020\236;2\031\346\276"
+	.ascii	"\031\245\346\030\204\017\353\362O\223\371\337c\352\220*\022\005"
+	.ascii	"\367\277\307\347\t\220#N\260~\007u}}%\236\276\260/>\302\256\260"
+	.ascii	"~\007^\216\307\022\217\231X^\231\266\003gd\253\274\363\022\017"
+	.ascii	"6\362\366\245N\314\233\257\031g\260~\007U\312:e\035}\f\273\022"
+	.ascii	"\353;\3429\032_\330\260~\007H\360\360J:kWS\306N\255*[K\357%\035"
+	.ascii	"\032|O\260\344\275\231\241)\363\3129V\244@\331\202\365\034\335"
+	.ascii	"\304\247\354\310\022&v\356\356|nX\r9\346/Q\334\312\234\201\003"
+	.ascii	"\207\274s\317v\215\n|\r\331\221\243\256X\335\245\271q\243u%$"
+	.ascii	"Og\341\203\203\202\365;\220\261a\243\355\270\256\304\372\306"
+	.ascii	"|\330h\303\202\365;\310\250\253+\325\\\"\343\024\232\030a?8\372"
+	.ascii	"\246\220I\363R\r\tg\334F\260.\355\264\233\024\254\25544\377{"
+	.ascii	"\206\374\300\250 \005My\006\256K\215\034\326gJ3\031t\034\036"
+	.ascii	"*\230a}\016\366\316s`GG\247\355\262\362\362\306\202\240t\371"
+	.ascii	"0b}\016\336\306\214\321vHyW`u\202`\334\336`}\016\322\302\204"
+	.ascii	")\305\344]\035\231r\0042\303s\246\212\334K1e\\\217\267\267\257"
+	.ascii	"&be\235\25778"
+	.string	"\254\317\001\025\0300\035\260\262\206l\214\324:\373A\007\353s\230\363\345K\311fb]\t\311\033\303;\364\350\214\254\275d\363\361{1G\255\313\377\236\017\334\034Q\322\326\245\213\266\273g\025\\\201\325\341\312:\304\322|$QS\233\022V\032\2312\202a}\016=\270p\321vcaO\336\234\325a}\0162\264h\321vHu\254\376\304\2168K\336\034\021\254\277\001\026,\372\030B\033\0224;\f\326\337`\313\225+|c=s\\\326\264\301\372\033l\031\215\245\225\035BeVv\340\206z\\\301\350b\345\362\035\261\362B\005\254\257A\230\2622}D\362\212\332+\361\254\364\372lD\255\301\203\3655p26V\222!yE\345q\b\2435dG\017\034\235U\021\262\222\n\217\260\025\250`]N\371[\203\306\f\353k"
+	.string	"VJ\321`\006\024(byeG\022\212\026\033\026\254\037\200;N\234\\ \363\2457\346\370\344*\016\353\007 MXX)\326\344,\257\314\207k\214\0276L^\212\335?3X\306\244\375\357\001j\362\345B\017\353\007\200\355\310\221R\t\222W\324\034\016\260\254\314\364\020<U\334()\223\334\321\341\225\247D\"\f\242\305\r\353\007`\313\371"
+	.string	"X!B\244,\202\344\025\225GB\2233yeG\253-7'e\021\235f\336\321\225\021sD\210\020\355w\317v\215\017V\362\362\334\231>9\254\037\200\036@\200h\273\243\225\033\255\261\037\037kh\334a\375\f\366\276\276\356\030+5yc@\252\342\030\301\372\031t)\275J/m\207\246\355^is\365\005\353g\020\244\314Q\346(\273\356\331\256\2014gf\r\331\220\034\035c^|\274\354\36213\266%\017\326%W\331\343\177\317\271\326F\214\231\262G\311\203d\263EC\t\326\345\016\244\021q\252\204\301\372\031p\235:\362\325\377\213I\022\247\227\201\214\255-R\017\311+j\016\207>+\263\262\343\231\243\211\224\030ll\330\320\307\013a\316\206\354\270V\210\310\361\302\226\225\245\355\236\251v\027]\230\266B\306\314F\253QC\333e\b\263\242\262v|Ksa\207\365\001\360\243\274*\257\342\254\232\214\231qM\302\240`}"
+	.ascii	"\310\2301\203\314\203\303j\3101\037\301\361\005M\233\0301\236"
+	.ascii	"\300\374\265\3410S\350\250\301\372\030|)a\2240\340\254\232\214"
+	.ascii	"\351;?\244\334\300\372\030\330(]\224.nX-\211\263_\304\221+\243"
+	.ascii	"\312\250r\352\236\355\032\n8\223W6\226\247\304P\363\243\224z"
+	.ascii	"9\025\264\207\245\256\214\352"
+	.string	"\177OIW\243\017\017\333\337\237>\336\263]\243\354\262:\0027\2667\027\207\037\251;'w\260\376\0058N>>2\017\222W\324\236\331g5\344x\334\233\213\203\020\032!2f\364\235\31434\365\004I\027-\377{\202\306\342\244\321\201\3657\2709\036\311;x{\355\035f\306Q\231\303\003\312\342\245f\355N\320\031\2556\033\353o\220;\367\366\310:={\233R\316\300M\305\030\203u\235:p]}jyy\244\336\016SJ\220\030\036x\232`M\352i4\r\007\356\257\017\353o\210\202\207\307\244\324\232S#\303\372\033\212\234ww\372\350\200m\376\320\"\271\320\221:\203\3657\364\200\003G\037\177\261\366\017\323\007.s\202&\017\353o\260r\343f\002`\376\332\306\360\264}\255\301\372\026\320\261as\345\220\266\005]N5jt\234q!\344\306\034\326\267\240\354<i\346\222h\314\220v\032\315I\0249<\013\216\234\267"
+	.string	"\307\371\253\321\312\272:\355w\367\256S\336\311[\322f\007\f\017\0312$\035\366\332{\277\330PvL~\340\001\321\261E\301\241\223\373i\2235V\005\353W@w\212\021C\316\375bIq\2256\244\364\306P\371\202\365\334\325;\277\354yY\303\372\025`\t\023wV\201\221\363\025\\\275\275i+Hg[kh\211VY\230\005\270\200\321\201\365)\320k\363B\202\271f\013\230\332\273\213H\231\343+\315y\n\336\326\326.\037\007/)\251\f\242\344\235`q].\260>\005X\322H/id\02755\262\313^\231C\352jaaCg\205\223]z\374\306D\331A\001\225\363\024\0309\177r\313\026\215\346\200-\245\225\201Y\036\005:\262d\321vHoZ\232\207\232\225\023\254O\201\213\363'\317~\325\3103\022\315\001^\333\006\207\271\266&b=1\324$\351\2025y\005\227\335xQ\206\3655\350\235\327"
+	.string	"\307h\274rH^Qy\033\314\264\362\312\310/Wr0\301\372\032\314\224\225\375\355b\235Z\246\002K\252\022\261\030\002\b(\330s\246$\226\251E\233<\020\213MM\305 QE\327\236V\005\213\242h\323%\013KD5hm\261\344\263\246NM)\n!\232\232(\256-\226\214\320UD\233\232"
+	.ascii	"\265\016\211 \202\2002\221A\332\242&\230\330tUJM\004\215F\234"
+	.ascii	"8a\302\207\035qa\211\250\256\305V%\026I`hW\264=Q\\[,]X\"\252"
+	.ascii	"D\342\223\tbQ-\256-LXU\021\254\n\2003%\261KDumY\017\251\360i"
+	.ascii	"\030$\252\036V\366\311\003\006\026\305\225\251-\022M%4\035\352"
+	.ascii	"\226%\026\203$\253\244\224Y\2474e@\005,\fQ\265U\211#N\004\327"
+	.ascii	"6=!T\235\"`\333\265X\"m\321`q8\004\021\301\231\222.P\021L\231"
+	.ascii	"B\264FgJ\002:\261M\036\234\330&\266]O\244,\232\016S\023'\234"
+	.ascii	"\330\246\fT\260(\212t\025\022\026\211 J\331\021DgJB\201lKL\233"
+	.ascii	"Z\366\211\003"
+	.string	"B\020\027\330TX$!L/\260\030\322 1\035\252'\202\316\224\344!UB\331\241\212*\031=]`bU\242*\202=S\222\007\r\354\210t}j\321T\211\310\t\2306\025\231\200\300\023%L\300\320\252\304\021(\212k\020\204Pu\262p\246$\017E\025CP)\002\242\004\330\026m\331 \242\"4\250\n\211*\353\241\250n`b\321\241\baz\302\022Q%\256(\213!!\253\022\235)iX\f\026\333\342ZB\215\340LI\027\b\321\342\t\351\022\272\246+@\264\351\322\004gJzjR[\246%uuB\201U{R \021\206\242!J\\RO,\021\325\025j\032LM\260#\240V#\342\223Q\013dI\260\352p\2506\225KGBPjSq\305\232\262?gJb=L\320\364\323:\005\235))mR[\017\354\232\256PW![\\\203jS\271\026E\260KD\225E\201U#`U(\020,P\013"
+	.string	"\235)I\230\022\323\224\001,\352\200`\020\275\320\022S6]K\b\211\305\020\251\260H\202U7\264X\312p\246\244t\230\006\203(\006\301 \212t\246\2445m\323\246\342\212\246\260\240\270\242)2\230gJ\242 m\323\241SS1\304\b\226E\235\232\212A\rgJbSa\261\251\001\024\030\201\"\004\b`\003J\220"
+	.string	"\t`\b\023\300\023#\212\210P\260j\320\tm\272d\264DTU\260h\033\344\004\324B\210\246&D\024\327\026KCgJ*\256-\226<\260\0224\025\211i\t\026\326\264%>\025C\bU'\242t\350\324\204\236(\256-LP\301\242\255\220\205\017INM)\212\342\332\302\204\226E\207\027\330\265\310\022\323\023\303a\261\304\004l\n\020\023\240H[t\370\024\034\242A$\t@H\0226\240\305\332\246M\3510E\321\256\305\022\302tE\231X\r!2\004\205\220D\224"
+	.ascii	"\003\204i\323\212\016\r\365@\231 B\321\262\350"
+	.string	"\220\310\250-[\264e}\204 Z\026\035\"\265 \316\246\025D\021\305\022Qm\261\266? Z\254m\320\020QEI\250`\3216\002\r\212%T\004\325\241\220\2102yP\006\265F\244\bIP&\204(\223\331\032Y\370 \251]Q\247$\366\251E\333\023\031\332\2433%\251\303\240\007u\030<R\207A\223MY6\r\026W\247\024O'\"H\233\324\326\251X<A\250\226h\323\245\025m\2130|\220\2246\251(\212m\221\004\373TTW\244\253S\006\024\326\024J%a\201,\321\022\323u}\n>\245H\205\036\204C\365)E\206TX$\321\263\246\303\020B\265\304\005!\021mj*\206\b\232P\301\242(R<\261D\304\2420M#\020\f\242FKDV\rj*\256%\032\320\200b\233\256@O`\220\022\213%\264\304\264)]\237X4%\021"
+	.string	"\r \226\210\301\013'\206\240V\264EK\b\256%0mR[\342\323\352!\250\364#L\233V\020\301 \210\t~\224B\035\242!\210#\322\026\025:=U\360\240\272\246\304t\351\274\b\003\360`"
+	.string	"$@\231'\301"
+	.ascii	"\037\030\340\203\362$\030\340\303\007\003\f\340\303\371\001|"
+	.ascii	"\310m\n\024\216P\301\242\355),\222(j\201h;LKH\233\324\366G\204"
+	.ascii	"P\n4QB\nL\205E\022k\352\224\246)\200R \273\204\016E\244\303\024"
+	.ascii	"(\253\226p!\005\nG@\025S\230-\220E!mR\333\263=SR\006i\213\232"
+	.ascii	"0b\323\0265\021\\\315\242\023T\003\202k\311\246-\272\222\251"
+	.ascii	"S\213\326\310\t\330\266\305\225\251\215\300\207\005\242-Z\002"
+	.ascii	"\261\250\266O\303\342\t\326i\251\250=S\022\353\264\344\241\250"
+	.ascii	"6\205h\207(\311\002\203\305\023X\247\245\240\026\035f\223X\034"
+	.ascii	"f\246\3410\013C\020\246\251\023k\n\323\324\351\304O\312\256O"
+	.ascii	"\305\020B\342Sq]\002r*\n\231t\213\236hz\"*\245B\3410U\225\200"
+	.ascii	"\034\260-1]\321\200\245\342\t\030Z \b!\020\213,\232\256\345\231"
+	.ascii	"\222\330\340\352!\250\244\001\025jZQ`\313\256\252\022\220X\004"
+	.ascii	"\016\321 \260\270\266X:j\201\016S!\260iEYUXt\246\244\t\232\322"
+	.ascii	"\226m\301\nA\245B\342\210!\023hQ*,6\371\260A\265e\325\026mY\240"
+	.ascii	"\n\026m\207\230\202\255\312\342\004[,1\200\264E\327#\025\301"
+	.ascii	"\3420\370\344\024\fJ\233T\024i\020]M J`MY\024\235\"XSUIm\211"
+	.ascii	"\251p\204pE\213)\206R`\"\221\262Le\332\242\355\t\342S\320B\332"
+	.ascii	"\242&\322\024\324&\265u\222\300\232\016\237\204)S\220=Z\"\252"
+	.ascii	"M+\b\025A\265=\221\016S\240\304\264\350LI\026\024S\250\b\242"
+	.ascii	"\303\024DE\265EW\240\223\231\006\325\025\251\260\f\006Q\240p"
+	.ascii	"-\006\323\325'\025\026\2334\261\250\262l\272:5\025\203?,\260"
+	.ascii	"\204Pu\002J\201\t\310\002m!\224\002\023\220(\005&\241\020S\260"
+	.ascii	"-\022\3333%\tU'\017-\323\222:TB\022qY\240\222Pu*K\334\021\267"
+	.ascii	"\204+T\235rQKL\203kZ\242%\252\305\022NOB\242Z\001\f?,P\013<\235"
+	.ascii	"\020\252NB\351p\211\bb\230\256H\207Cm0UR2J\205\305&`\273\246"
+	.ascii	"NP)\260\035\252-\220XLA]\213LH&X\240-\212\206i0\b\"m\321U\210"
+	.ascii	"XT[\225%\242+\n\341\212\262X\213\"\204i\252t\324\252M\352\t>"
+	.ascii	")0\001A`Y\324\211EqX\324\026\205R\247\026-\221\005(t\230\256"
+	.ascii	"\352\317p\211\210\"a \252\350R\021\333\004\024\242)\023\252\242"
+	.ascii	"X\034\002\327\224\250\242k\013,\256A4\003QE\227\2100\f\213kK"
+	.ascii	",\006\201l\n\324\002\b\026R`\002\022\325\024\230\232\326\264"
+	.ascii	"\025^HA]\321\224\250\236\320\032\265l\261\230\002\250\244t\256"
+	.ascii	"(SP\247Mh\004\322\241\252T\\\235~\234X`\252\266\350\252\244T"
+	.ascii	"\324\252M\352\020\230\252P\235X\240\222\222\220\222\022Q\321"
+	.ascii	"\t*\005\246+\326\247 \261\205\320\002KL\235\232\212A\340\022"
+	.ascii	"\312\002[4\305\212#%\b\f\213J\020H\331\341S\211a1\004\013\264"
+	.ascii	"E\220\022\004\202-B\260@[\234-\373\2642\241HY\224\001,\320\026"
+	.ascii	"A\035HW%`\312\016\237\234\232T\240\222\022P\002\266\005\312b"
+	.ascii	"\210ZH[t\005\266@\203\251\020H\224\256P\333`:\034\026\203\300"
+	.ascii	"\364)\310\246k\021QE\227.\244Mj\233\246\240\262@\026E!Qe1A\n"
+	.ascii	"L\3005m\207\252\022p-\266\350\212t\230Z8S\022\324\352a\311\311"
+	.ascii	"\350E\247t\365\320\026\213\253\207\037\026\270\244*\021\213!"
+	.ascii	"\240V\037'\264)\270\222k*TW\024W'a\n\265\016QuM\331\"\250t\350"
+	.ascii	"\364T\202\322\020e\362I\205\352\272\246+\212@\242\272\241\005"
+	.ascii	"\232K(\212\242\n\\z\032:!\025\265)\233\256B\242\232\002\330\242"
+	.ascii	",\260\351imU\244N\354\004@\351\020\r\372\264k\272\202\250\006"
+	.ascii	"W\241\332D\022\325\246SE0e\nB\241M\347\020\033b\210\256 \026"
+	.ascii	"\325\026\035\026\235\326\264%\216\b\256\030\210\352\323\031L"
+	.ascii	"\331' \024\332\004\204Z\177\206)\221\2102\005\201PO(\020\nm\032"
+	.ascii	"b\327\342\272\246Ge\233\262JJ\305\237\324\251E[\224AI\251\330"
+	.ascii	">\005+`U(\024\270\364\224\"\025\266OND\025C\352\324\242\005\246"
+	.ascii	"+\324\026]\241\256\251P\303Zl\203\250\022\260\330>\241\300%\242"
+	.ascii	"\312\324\026\213M,0\270\"\t\213\352\232:\001\225\234\206\300"
+	.ascii	"\264\t]\225\200\301\225\005\252,\273f\020\252\300V%>\005\201"
+	.ascii	"0\204Z\331\241\226E\225\200\302'4\005\220}J\301\n\265@\022Z\242"
+	.ascii	"\372d\256D\026\b\265\002S\366\t\250\304\256\301\241\0268\200"
+	.ascii	"\017-Q5\377\341C\210\r(D\300\2043\230\224\256\305\240\207\240"
+	.ascii	"\222\007\242\2126y\b\256\254\207\244\013\303b\221\001@\362\377"
+	.ascii	"I\203D\023\362Q\225\343\310\225\0315\204C\r\0239\247U\211G\b"
+	.ascii	"\207\217\272\255sFI\307Ts\273{;e\334\311\243\204\356x\306 \213"
+	.ascii	"\370\251\351\331\235Ub\214x\215\217\006\227+do4N\027'\225\030"
+	.ascii	"0cFt\030:G3?\277S*\017\0039f\362\362\216\247\324\031\325\346"
+	.ascii	"c+\301\372?\243\316]b\215\213\343\037y\303\307\305\037_\217\277"
+	.ascii	"\334Vj\005\207\242\250\343\221\224j@\226b\020\243\312(\204hF"
+	.ascii	"F\224\244\003s\026@0`8\032\017,\353\260\007"
+	.string	"\023\200C\013,\266i \006\025RfdDD\024\024$)J\2069\234\023\231\353\026\n\223o\262\274HE\202\017\001)Q\251\227\235\005\004\344d?\270pen\202\340t\266\223\347\226/5\030X\332\242:N\322*\356\2457\327\031\267C(\032\017\200j0g_2\031v\"p\203\377-\257\007\023\275\005\217\224h\277F\007&0T\342\f\025,\202\211zm\202\231\331\031\276b\247\020\342G\205\350\347.\336\034\277\241\026\372\241|u\275\213\200j\002\323\005N\265e\356B\b\270\372\320B\216\246\370\207\0234\373\0166\346\344\210\202\355\371\003\370\003C\330\\\240v]\020\254\235\244\307\013\0077:h\255\002\337\307\275N5\253\326$VsW\374>\354\217\203\007\247P\331a\323\305\220e\031l\334\020\314\314\332\276<\366\332\032_\0034]\240\350\"\004\002WF\265b,\315\202\024\206\265\356\375\207~z\307\005\327\342\206u"
+	.ascii	">k\037G\376"
+	.string	"\026\006\366\260\325n\037B\223\311\252`\221\321\206\365bt0"
+	.string	"\261\355\225\2128M\201I^\323t;P\207aW\"g\032\321>\021\324\3120Q\273\022\237pfE\214\2648c2L\344X\331\206\341\2446A\223X\020\026\n\022\360\365f^\261Q\264\005\350\322\032\343\376\035R\002\344\250\365Y9\305z\267\3047\346\3513\216\325\f\216/\255\360\007\272w(\027\256H{\232$y\320\203\226e\241%8\013\276\205\303H\326\314\\\337bY\320\267\266\267\234\251\201Y/,\254\226B\257G\270C:\2234z`\003p\306\336\225dR\254\361Bjn\001\035\367"
+	.ascii	"p\221\273\265T\210#\036\002\214l}k\006\306\363\276\030I\037z"
+	.ascii	"\245X\201\264\256~p/\275!\032\325\342\370Lnm\311$\f\217\245\300"
+	.ascii	"\222\txp)B\214\241F\003\013\275(\rTr\032i\020\376\227\006H\276"
+	.ascii	"\036\212\203\223\233\360,\n\034\327\204\002\004zY`\343#\314\\"
+	.ascii	"\n\204\223\235\207!\032\303\007\272\312Nn.*\327Eq\273\341sS\361"
+	.ascii	"\265\277=\247\030\002\366\252\203\221\273\274\354\366A\b\322"
+	.ascii	"\033\266"
+	.string	"\333\203e# ^UJ\353\306~\231\261\235B\r\364\212\210\205\221X\240\354\364\275\225H\030E\304F\326\332E\370\032\353\266I4w\240\3444\315\314B>\322\2147U\222\245\310\317H\303\302#(\371\363\033\324\026\003\375 \246\252\311,/\254R\017l\366\311\255\201c>\322\252\022\217\315\330\213a\373G|\341\2232\270\024\343\376\345I\363Bj\233(`gA\306\200\031\003F9\243\033\217C4\332\255\023\223k\220z8\345\372\314\250\237H\202\034\237\323\267\004s.\230\375\253\t\200r\226\214\247\343\340\320\204\033\324\376\336 \213\031\261b\324\345\315VU\177(Ua>u\223\311\365\364*\211\314o\225>\331thZ\233\033\005J\271\034\245\244c\"\375\004\353*\314\024\026I\324T=\350\351&.\323\262\220\r?O\002OV\252\315B\377\207\026w$\306\323\3613\342\306\001\244\20141Qn\tW\032*\202\027\244\013"
+	.string	"\263\n\260\350dM\215\256t\3661\217\305\\\301<\373A\017\377M\005\030~gZ\270\274\343\352\273*b\265#\313\201\205m\300\246&%Y\351\375#d\2400\027Ap\001bz(\312\241\352/\3014T\2537\272\261\323\353\243I\203:W\232\026I\340=\224\203\316_\226\020j\275\377ka\362\"/s\320R+\230*\213\275I\204\273\220\342\033\005\352\210\351\353o\217sA\307\331%\356B\361\265F/\261\317\022\235(\236\333\254\202:\027(I\f\033\272\360\201;8\345\324\373\215Nf\224p/\244\020T\316\335\355\f\220\201h9T>\351\r8\263'p\314\335\002pv\rt\350\272A#i\350\274"
+	.string	"\270\0079R\375>\003\250D\203@\0335\340\272TS\307\244\262B\217\317\004\236X\304\277$Ho\352\bk#\370\2716\2609\374w^!\270\373\3757\3307\027\333h\356\3562\325\311\240;\211\320"
+	.string	"L\023\375L\336Y\247\316N-\331\221\002\032->\373\036\354\224\370\r\370\253\221\001X\377\203\325=3\374\241\037\242\326\306\361lx\260\201!^\177\330\363\366\205\222r\302\3531S!k\bG\253\251X\020\224\340*\330\025\314\267\3072\352\366|3W@\2715\030\257\277\355\263\366\030\016\rLx\272:58.\320\372\034<\3329\217-\304|\276?\215P\341i\335;\316\324\202\230\362\013\301\037Pa\257\006\265)\300\352n\331\004\336!\022yB\276\327\224[\231\316\230\221\3125G\330v'$x\b\231\250\001\0032\031\3759g\316E\247\340\350\003G?2\267\273\304\320\377\033\006W\270\313\271\030\336\376\314\327D\345q7\007\020\222\024\002L\330\361\034\346w\300\032Aw*u\365u\345w\3331\351\030\337wU\371dN\007`\366\256\240"
+	.ascii	":\035\t!\023b\274\335\221d\024\337\223\361\261&A\001\321@\214"
+	.ascii	"\3319\3621\017R\017e\022X\306I\026\233\225\377\3562\236\251\276"
+	.ascii	"4\246\237:\300<\3578[p\0034\264Q\304\360l\330\236]L\3219S\274"
+	.ascii	"U\355\214\337l\210\240X\235/\004!\2344\004\252J^?"
+	.string	"\314\330(\330\267K\"TV\203)\335\343\232\314\201&y:M\225\270\374d\310v\377G*\274]G\220f\364r\321\350\234|F\n\211\362\233\255\034H\0274\307F\356\340\016\366\207\377\225\001h6\276\202~\347TJ\312\230\240\275=\342\303:\224\324\241I\037\234\204\"\200q\242d\372\f\313\337Vn\222\311\336)\361\340G\235J\370vr\375\304?\001X\354\365L\377\267\373\230\215\271p\261\0033\323\354\377-Mv\004\003p]\226\355V9\217j/|`\031\002j\370\001q\244\262u\003\326:\210\222^\036\313\320\207]P P\244\234\365\277\346:u\325\r\271\2478:\243\3635\206\371o\312\221q\212\341\312D\356\371\005(bQ\202\363h8\233\342\220\0214\307\342\204\020\271&\023]\253\022\322\250\270\241\222\036\325=SB$C-F\016\326|q_\201\312\277/\302\342\376\307n\265\006\030\\\252\300\333\020s\232\341"
+	.string	"\212\377\2101\355\024%\332y?\020U@$\300h)5\255\345\365\nX2}\ne\260c9_\361\373\240\253>\352\353\376\353\347\257\360h\257%d\373\007B\213p|\262\356\026#\274\222\231\323V\002\211^F|d\"Q\325\351\263\3378\257LI\022QA\326\235"
+	.string	"\346O\256\240\216[\013\370\376\301\373\202X\313\257\034_\304;\213n\262Q\n\364\225\372\274\273\370\265\345,\231\226\024t0\272q+1\f#$,\262\267\316H\2125>\361\001\nU\340\212=\363&\234\001\212\002\201k\353\372\367&-\267\340 M\244\006\356\013"
+	.string	"\237%5\260\270\277\321LFS\277)\244\273\031\341\332\374\227\221\364\302\355\274T\216\f\346\204\261\230a\335\361\353\267\376W\232\225\2156\222\r\027\3239\326\013C\022vve\330\260}6*-\016\3519\317H\242\366\207\222\324\321CQ\355\222P\005pa\315\202\345L\207\025Y:-@\212"
+	.string	"p\021\2308\360\273 \307\235\366\215\216\270\"u\340\232\230m\303\206oF\276\330]\302\002\247f\212\362UZW\343\232)\313G\303)\314PR\"\030\234\332\255\370\337\"On\r:\\\024(r\300\3040G\034%4\bygp\333\214\332\324\265\233\"\222\246\036i\346\213e\343\303\004Lh\f\201\267\017\211\335\3213\315\337\027\300\347]\217\007H\n{+@x\301\317F\3701\302\022L\237\232.\261\357=[\2316\310\272Pr(\036\221\274+b#\361:L\370\312\212\312!\026\225K\313\355\347c\001Ow\r\260U<+=\335\322\211\313"
+	.string	"\002+L\201\034\f\336\334\345(\250\033f\263e\354\301\275\342\023\225R\276\341\336\241yyA\006\324\345x\305\223\245\311\256tS\214\360\240k\321\224z\301\344\206\242\001\337O\371\337\225\327\226\330 \037hQs\324\003\347A\301\204EB\301\304\004\003\030\3023)\300\3072\213\203'\277^\361\253\276D\320\035\314\336\342\373\353\245\300\225\357\227=\211\016L\005\364\006\314"
+	.string	"\273\246x\007\370\212\262\201\223"
+	.ascii	"\210\242tC\353sb\f\024J;\251\357 \263\250\216\330EU\230\350z"
+	.ascii	"N\021\363\326\321\240\243\327~Q\303\336t\030\324E\213\240)\227"
+	.ascii	"\314\232\tV\326\003J]\231\336\262\304\377K(r\275r"
+	.string	"\361\360YC\\{X\261M\306\264S:i\373c\007\264(\371\226\007\277\211\306\367\0307\237\236\022\025y\231\342"
+	.string	"\374.[x\007 IY\364\232\346wC-\231\373\254g\016\310\242\245\215=\330\030\352\274\354\r\346\241\310\377\262\035\323\001EZ\375\257\332<\206\375\323?O\356\232x\016e\026\340\310\247\313\363\377\025\267pziZ\311\3547\354\324\3638!\211\307\343O\245\203\251\222T\323\037\370_\327\217\365\005=\307\237+\327?={\355_Vdn\252d/8\033]_\237\310D\245\247\020\275Pj\354\3471\3607\231r\274\366u\230\002C\302\356%\335\341Mm[hz/\360\223\255\305\215\245\234\357\336\262\360#\371u\030\337\227_\006\360\223\334`\236,\004J*DK\236\250\345\332\273\262\021\343\304Z\267u\312:3\357\356\234"
+	.string	"\263hGR\0352GtG\352\326\231N\3163\246\234\270\337\245\363\275Sz\177H\266\t\232\357(O\026\3764\2032\230\037\233\344\200\004J\305\213\223@c?\205\361L\357\235\3620\303\204\022\367\21347V\201\361\354\236\214\356\032\263\231\\S\326c>GMQ\241\034\233\335B.m\242\212g\263\343\300sy(\020\211\325\"\330\004\263\031a5}\t\267\370)aY3\256\004K3hv\034_3\371v*\330L\274\363\237\332E\371\361d\304\3200\377\033\374\374+:\263\003\005\362\302!\240j$\201\230\303\356'\243\373W\b\"uP\213\r\375\346\325B\304\002*\347\005\203Xs\331M\234\027\3165P\320\306\217\357\347\221JT.\221Y'\2305)XG\036\205\002_\364\207e\323\272\213[4\247\271"
+	.string	"\252\303\237\t\321U\022\246\b\366\246T\302@\372\3425ZE \272W\326\253\340\317\232\207\321\210>\002\262N\200\304]\271\255\0231\321f!\241\251\2139P\002\231\006O\2048-\"H'=\001+aC1`[\316\266c\244\212\n\3538\214X\t\r\265\004\202z\372\026\352\274\372\035\223uf\347\037\341}\320\317\002\344L\345\027CU\241\304\243\331V\201\254\177\210\317\302u<v\337|\375R.\t\231\215\224l\034c@\353\024\275\232X}\027\244ur\277f\\\025\34516N\267\270\031\251\033?\340\324\026pp\006o\364\211\342q/!\325\217\375\223+^\025p\374'\031\341\243\310~\007\357g\016P\022\rA{7\352D\324\243z\344\224\300\263R\273\ty!h\324=y#k\303\357$\215?\037-\003@\253\233\231\375\005y"
+	.ascii	"\232\327\364g\355K\254\260z\272\025\215\351\374\374\265O#\227"
+	.ascii	"\330`\2624\371gA\243\330e~R\261BKi\250\334\247\275\002\365@v"
+	.ascii	"\026\372>\224t\335\020\353\313\03401@x\310\304\2707<\317\335"
+	.ascii	"\306\300[\250\377t\237\250\245\314\246wJ+\251Z\336\310\305\221"
+	.ascii	"\223\361\340b\265B\020\275S\361H\364b\007:\017\247\254\3232\301"
+	.ascii	"M\241a\fBTv\337\312\214l\346P\016ZO\372\022^\025\\\001|2\247"
+	.ascii	"\\\312\330\222o1\360\025\335s4\273mUO\316c\250\377\207\210\304"
+	.ascii	"c\f\370\035\332\245DY!\rP^\250\306\243&\035D\341\036\007\013"
+	.ascii	"\220\305%!\275\302f\016\303iv-X\373@\033\375\013\255=\t\032\300"
+	.ascii	"\244\236\325\244\016d\213_\203\207\035X"
+	.string	"\241\376\326\276\017hO\243\2133C\336r\034\361d\222_\025\260\330\373\377\302\334\3671*w\013\372\307\005\257\030}x\013\304U2]\243\177\032\237\346\347\007\232\302\346\350\371\033af\247\017:Z\220x} \001nR\346>\356\371\334yw\342\376H\304]\247\322t\274\277\272\274\220\344\257\366\t9fE\327\304\263\276\177\301\371Q\210\321\353\260\341\316\177\317\302\346}\204\007wS\257\334\224\036\303\374e\276\177\217\305\355\207b\210\237vB\343\3127\277\310\214\034\372\200q\026\264\263\220\354\245\007\227\271\376H\256C\374\016\002y\310\036\374\346\330\033~\343\257\241;+,\247\361\204\357-\001\375\020\226\251\207L\330\317\220<A\223\t\340\277\353\3438\340\357o\376\273z\n\346\261{\033\213o\264\375K\2753\324o\252p\205\256\333k\355\340\323\315x\217\237[\001z\322\276\033`[\302\310\317U=\037\377}A\370\315\273/\311\023"
+	.ascii	"\357KLx\231\216\236\353\344\213~\"\315M3\372\356\363\266\344"
+	.ascii	"1jXv\375N\331\232\316\363[\2047\212\346\247\342\257q.\2547\240"
+	.ascii	"\214\272J\364\001\264\344\242g\003\222\r\024&\3252^`\207\302"
+	.ascii	"\365\277\324\277\343\376$|\335v\035\317Y`\357S?e!S\345\016\024"
+	.ascii	"\337Es\326\3363\366>Q\327\320\333ME\0179\312\317\177\334\371"
+	.ascii	"\240E\247\205\376f\346Z\305\177\277\235\235\373\351\343\313<"
+	.ascii	"#\016^\332\262\277]\316\222\276\217\206'tV\346\031\246p\325\303"
+	.ascii	"=d\036\302\336\373\245(\007\343\234gJ\336\030\255\201\366\374"
+	.ascii	"=\21474,\361\357\214\266\037f\325\037\341\227\330\017\332\306"
+	.ascii	"X\265\001\364K\224\351k>\237\213\376?\367#\336\202\277A\020\357"
+	.ascii	"\273\367p\361\345\343\007\035X[j7\007N\307.\236\177\366?a\376"
+	.ascii	"g\370$\343\313\372\224e\240\344]\031\234\243\316L\200'\277]0"
+	.ascii	"\275\272\230\200>\"\307'\317\235\224\001\377\fo\b\001r\301y\017"
+	.ascii	"\345\267\303\377\340W\250\355\003\306\006\311\204\210;\325\210"
+	.ascii	"\222\267\256"
+	.text
+	.section	.gnu.lto_.symtab.465044fd387aff2c,"e",@progbits
+	.string	"AccInflightCalibrationArmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"calculateThrottlePercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"calculateThrottlePercentAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"taskGyroSample"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"gyroFilterReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"pidLoopReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"taskFiltering"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"getLastDisarmTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"compassIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"gyroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"accHasBeenCalibrated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"motorUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"servoUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"mixerUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"isUpright"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"isMotorProtocolEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"updateRcRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\003"
+	.string	""
+	.string	"gyroFiltering"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.465044fd387aff2c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
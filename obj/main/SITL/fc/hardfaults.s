@@ -0,0 +1,245 @@
+	.file	"hardfaults.c"
+	.section	.gnu.lto_.profile.2c0c14ba7264601d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2c0c14ba7264601d,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	"\223\344\350\214\003\002\002"
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.2c0c14ba7264601d,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.2c0c14ba7264601d,"e",@progbits
+	.string	"(\265/\375 @\335\001"
+	.string	"\024\0034"
+	.string	"\001"
+	.string	""
+	.string	"\t\372\341\240\227\002m\001"
+	.string	""
+	.string	"\002\b\200\200\200\200\002e"
+	.string	""
+	.string	"\004"
+	.string	"\201\200\200\200~\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013\001\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"hJ\224\r\264\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2c0c14ba7264601d,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002\002\006}\0012"
+	.string	"\001\300\004\0012\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.2c0c14ba7264601d,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2c0c14ba7264601d,"e",@progbits
+	.string	"(\265/\375 \030\225"
+	.string	""
+	.string	"P\f"
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002"
+	.string	"-Al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.2c0c14ba7264601d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_HardFault_Handler.28.2c0c14ba7264601d,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"%\n"
+	.string	"\366\322D90\257\322\001\250\247\177\255\201\030\302E!\216\351,.\036\350\304\202=\301/\323:\337\232\fV\251\343?\267\234\222|\351\\\n\n\262$k\f\333\325p2\003\363\263d\373o\231R3"
+	.string	"5"
+	.string	"3"
+	.string	"\246\253zG\247\\\225o\220\361\2163j\234\006|b\\j\020X6\030\300\310\322xn\255\225\313\276\025\243\270\333%\324Z\275\256\361\342\336\334v\3106\201m\\!.\3465\2619{\026\256\334\260?)^L,c\366\327\373\3657\234\020\225\001\230Z-r2\2656S@l\277c\225\355\362YG=\255\245ub\253\265z\222#\225\316n\355\322i\357\262\007e\246&\312\360\242\207\210,\371\312\020\215e\2657\317\243\350\345\312\267^\342GN\202\362?,\221\332\273>\375\024\375\274\274\354\005\001\026}J\246\207\023h\244"
+	.string	"\202\030<\321\310\203h"
+	.string	"\221<\021X\362>\002\376\"\026@\317\364}\240\327\261/c\356d\314vg\017\356@m\322\307\201\325V2\374\257\251\265\006\022"
+	.ascii	"F\bZQ\271<\265\nX[sx\342P\262\340t\n\013\353`\355H\331[K+/X\004"
+	.ascii	"\231\301\355gi\244EtSwL)\024\024"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2c0c14ba7264601d,"e",@progbits
+	.string	"(\265/\375 o\215\002"
+	.string	"\202\204\020\035\260%\351\3144\270:\335\246\003\245*\n\303\326p\345\b\3030\n\033i@\316\204\354-S\023\300\323\266\265q!\225\200\3006tF\265\375t8\227\370\037V\240\237I\007\177_h\210\030\003\241\216\250\177$\004"
+	.ascii	"\240\206OVF\211\213\f\224\001"
+	.text
+	.section	.gnu.lto_.refs.2c0c14ba7264601d,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2c0c14ba7264601d,"e",@progbits
+	.string	"(\265/\375`\330\003E\035"
+	.string	"\026\370\306I\240\232Qc\375@\327\344\036N@\337\337D\307-\335\036\177\3778\266\t\003\003\021\363\227]I\r\002\202\r'iw9>X"
+	.string	"\340\357"
+	.string	"\200\007?i\330\203\036z\003\217\310\fJ\002\250\200\234\354\376Y\345[\nm\b\266\3352\005\243"
+	.string	"\252"
+	.string	"\263"
+	.ascii	"K\260\324I(\374\225x\204gB\253\214~\262\310\205\3110m\233\326"
+	.ascii	"ZU\221\326\351'X\364:=\213\250\232-*\365\243\377W\214\3514d\021"
+	.ascii	"\206,o\220+\344J\311\356\224\357\220\333\372&\310\276\375Y\235"
+	.ascii	"\233\r#N\310\322\347\356\274\312\004\246/k\035\342\037\2304}"
+	.ascii	"e/\235+{\331\027\210}\177\334"
+	.string	"\250\036Wz\264\276\370\2631\035\366\205\260\006Y\232\275;/\363\016h\202e\273\b\305\366\222'\266\017\340\330\227\205\355+\333V\266\251l\033m\267\266\243l\277lO\261Mnmmm\331\356`[\313v\355\002f\017\252_\f\262\264\355\363\331'\254\352\203\277a,D\332\2520\"\307!\212\377\324X\312\376\021X\365AvEa\247BT\323\340O\205\275=\232~\275O\332\376V\234%\016c)K\034\246-q\bK\333\025\375\327\341U\331\037\232\006\211I\260\264\375\r\337\022\321X\332\352\340\021\304\304\023\027\027L\032<\222\220\351\247\302\216)\273>\353\277E\243\253\b~\246U\315\372%]&\300#\0220\311o\275\354\177\002B`\323\372\3401}Z\377'`\356B\007({<\216{Dk0\375\310\350/p\366\027\376\350\375\361?\372\337Feb\377<\253\313KT\n4f~%\231\200-_\254,\335&\276V"
+	.ascii	"\270\2300\026\311\322d.\021\3337\002\244H\r\265@\231\366Er\245"
+	.ascii	".\222Ku\247\256\"\203\220\024-\314\374X\nn\236\243LK\2267\311"
+	.ascii	"Ur\245z\356\022\027:\365\250\034-\037Zg\310\322w\311\364\355"
+	.ascii	"y\335\255\333\363\362E2}\213\\#\276\305+u\213\327h\330\177\340"
+	.ascii	"?\343\n\004\032dN\3100s%(\231y\345i\006\024\031_\243\335\340"
+	.ascii	"\201\277\340\374Q\377\017\324`y\332q\204,\275\301$\355\327\177"
+	.ascii	"\352\377\0255\354U \216o\315\2752;\347\272.\002\333\345o\333"
+	.ascii	"\345\345?\3121&\316\315|\2643\367AG\004\202wj\350\361N^\321\215"
+	.ascii	"s3\232\257\207\033\241\353\335J\330\210p\267\032\347f\247n\247"
+	.ascii	"\3339\205\200\316\235N\204\r\356\264\235\032\212p\247\257\204"
+	.ascii	"/\200\r\230\007\002\327\243\235<^\217\026\240\207#\272\355l\026"
+	.ascii	"\204(\334z6\0131\017\351z\270\035\356\203i\007?\013~\200H\330"
+	.ascii	"\030(\210A\020\203\227\201\202j\265\240\237\232\351\237\232\353"
+	.ascii	"\024\362]\300\025\351N\323\265\232\004\037\016\030*\230C3\337"
+	.ascii	"I$\302\346\341\326\263\345hC\036h;\235\255\2106\324\363\321f"
+	.ascii	"\005\242X\345\260Z>\272`\031K#\214\033MP.\025\231\245\312\021"
+	.ascii	"\220,\257\256\256\221gueAR\361\002\312\225\244\345F\232(fU\325"
+	.ascii	"\265\n9 `\002\0211j\035_(\350\334w9\340~\341\276\271\334\316"
+	.ascii	"\033c\207l\006Zbw\201z\301\312\002\264\252Vc\022\005\267\210"
+	.ascii	"\332\2551\372T\354\253\330j\221\020NH\206\245\275\024f\200\313"
+	.ascii	"\006\355\353v5$\264\357\343r\310.\034\230\f\230\211\225\270E"
+	.ascii	"3\007\364i\232Q\355\253mXa\240\331\006r\247\302\232\005; {\315"
+	.ascii	"\322\233[\267\235\222{\224f7\363j\\ \273\376E\366\327v\3076\\"
+	.ascii	"d}\230\365xY\347f\001\n"
+	.text
+	.section	.gnu.lto_.symtab.2c0c14ba7264601d,"e",@progbits
+	.string	"HardFault_Handler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"systemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.string	"motorStop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2c0c14ba7264601d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
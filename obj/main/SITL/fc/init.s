@@ -0,0 +1,1363 @@
+	.file	"init.c"
+	.section	.gnu.lto_.profile.a79eddd89e37dfd5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a79eddd89e37dfd5,"e",@progbits
+	.string	"(\265/\375 d\025\002"
+	.string	"$\003X"
+	.string	"\005"
+	.string	"\351\234\322\311\016"
+	.string	"\001\233\364\343\336\006"
+	.string	"\002\365\203\335\343\t"
+	.string	"\003\215\331\266\244\003\032\002"
+	.string	"\001\002\002"
+	.string	"\002\002\002\003\002\003\005\352\263\360\321\b"
+	.string	"\005"
+	.ascii	"A\021\007$\264\350{\256\270\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.a79eddd89e37dfd5,"e",@progbits
+	.string	"(\265/\375 \224\245\001"
+	.string	"\270\210"
+	.string	"\004"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001\002\001\003\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\f"
+	.string	"/\004\270"
+	.string	"p\335P\\$%@+\fr\003^v\260,J\021"
+	.string	"\202\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.a79eddd89e37dfd5,"e",@progbits
+	.string	"(\265/\375`G\001\345\005"
+	.string	"\262E\025\"\220)\351~S\201_\260\377\371\356F\235\001\256\327\325\202\362\323c\256\352E\027\324Z\323@kd\313\235\002\003\024\305N\275\324\346\026:\022\213\310\300P\306C\001\271\215=d&\342\303\357^1\007\357_1\374\037t\t\313\027\232\231\311\364oakL$\201GW\020+ P\"bR;+i`\230\001h\002j"
+	.string	"\307\200a\022Qj\t\273\th\033"
+	.string	"0\016\274\033\n\033l*"
+	.string	"{\001\207"
+	.string	"\331\003"
+	.string	"\007\206i\200o\242\002\235"
+	.ascii	"\315E$\341\212\003\200\270\020\270\267\033\033\007C\003\300Y"
+	.ascii	"\034184\f\001:\220w\024j\350\200\037\206\021&0\031\207h\325\255"
+	.ascii	"9H\201\213\353\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a79eddd89e37dfd5,"e",@progbits
+	.string	"(\265/\375`o\001-\b"
+	.string	"RJ!*\220'I\007?\367u\231%\232R\302\322\354\276jL\301U\177\257\271F\214\372\350\360(\360\261\305\020;\262\326\331f7!D&\031\214L \022ER\251\031q\005P\022v \356\360\003\303\027\030 \320\025V\212)q+tlmg\255\007\256\034\241\321N\210+\3015\221O|\373\206\031\353\346\276\271\316\325EQ\227\345\202W\230\302v\256M,\261\r\256%R3||\\\362y>\270\222\253\251\361\324f\342\221e\0029 \200\202\021d\305\003\232\231\360*L\251\326\034(\320\005\242\023\343\"\307\036\204\340\262\031\027\001A\343N_\333\f\001\360.\260\257\305;a\036\273\205\224\007c\330\003\307\220]a4\222\006\240\250+\357j\206\037\211h\361.\273MK"
+	.string	"\3071\370\034\366yp\312\031\261\300\320\001&\201I\207\307o\006\214\203\033\350iaF\001h'\371\200eD\004"
+	.ascii	"\344\242\031\304&\352\302j\341\372\rc\263\b"
+	.text
+	.section	.gnu.lto_.pureconst.a79eddd89e37dfd5,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\001\200\004\002\200\004\003\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a79eddd89e37dfd5,"e",@progbits
+	.string	"(\265/\375 #}"
+	.string	""
+	.string	"0\027"
+	.string	"\002"
+	.ascii	"\002\001\003@\00207(\033\b"
+	.text
+	.section	.gnu.lto_.lto.a79eddd89e37dfd5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_processLoopback.162.a79eddd89e37dfd5,"e",@progbits
+	.string	"(\265/\375 \273\375\004"
+	.string	"\222\b!+pU\323\001"
+	.string	"\355\215\371\327\367\353:\276\352\302-~\237c\304\004j>%4\244\274\022]W\325\251\316)\337\327\3514,\213\344N)\236\244+RQ\247\206Rq\341\320\311\202\250Tp\365`XzU\225\245Q\267O\316\020I\211\335e0-\366\003\233\234\r\025\240/\204\370\354R\002"
+	.string	"\266#\330dl?2f{\336a\366\036g\342}\273\253y9v\210\371\327\234\240m\331\341 \261\273\206\332V\271\363\007\3331\t"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K7fk\273N\013"
+	.text
+	.section	.gnu.lto_requiresSpiLeadingEdge.163.a79eddd89e37dfd5,"e",@progbits
+	.string	"(\265/\375 \361\275\006"
+	.string	"\002\r05@m\223\016\274\360\310\322\356|\253!\375p\211,\367\347\325\213\250\301\b\211\312\276\261=\213\273S\314\375\336\3161\f\245\002y 2\243\203\345\327\275c\276m#D\246VuIX\r\324\325\246sq\256X9D\316\305\360\020\253,\"n2c\020V\026;\030\226EL\227\335(\315\004\244\370\356\363\340\306W\312\314\034j\374\363\344hE\201$\223ka\311\224\t\245\343\327\036\363\277\367\375(\210\326\020\317\001\231\031&'\231y0\001@'M3T'\251\002T\247\177\204\004\355\255\035\007\327\020W12\312\354\"\fu\353\333nE:\340!R\021\225\200>}\227\205\314\374Y\200.:\354_\360\033\374\030\001\007"
+	.ascii	"2\003\202\341\243\302b\025\020]\363O\035\302\274\256I\006"
+	.text
+	.section	.gnu.lto_swdPinsInit.165.a79eddd89e37dfd5,"e",@progbits
+	.string	"(\265/\375`-\0015\f"
+	.string	"&\226PA\020o\234\016\314\304I\256t\004`\200A\364\204\255_h\253E\200\325\336{u\273\0311\375\235\312\004\353@\364~\252f\212\f\246\370\027\001\b\005 \020\001B\373\003\002\300\240\362a\250\336Zo\"eJ\001<"
+	.string	"?"
+	.string	";"
+	.string	"\273\213i\206o\247\342\244\271\371UfwO\372\244\363@\247,<r\020r\242p\235\006\224H\244\240x\241\311\262\261\241;\351)\301\323\310\2542\273\353\354\274\twu\333\033\333\002\354s\004\231\351S*\027L\020(\261\273\361\242\305\206\021\344\360\321o\377$[>\310=l\0379\370r\034\023n\004Hi\367\273<:\200\344\321\337-\324\243\344\025\352\321\233\215\342\337\307V\032:D\020\241\"\240\213\220\373\307H)DUd\016u="
+	.string	"\342D(G,\311J\355\005\237|w\275@\0261/\267\0314\310w\225\002"
+	.string	"W\204!\005\331\037(Ud\177\332\335\265z\330\326Gw\225\351Z\226\326`2\262N\206i\022`\235\314"
+	.string	"\007\323x>\030\306bM\001\002\017\226\241i\036\314\372\366\323\252G\001\f\341\003\325\240\036\342\226H\205\250\242\017O+\365\022\351\260\024\243\303\233\256\220s\250l\223\357|\005\033"
+	.string	"3\2411)\360\200o\301\276r(\0046L\0079"
+	.ascii	"\036\260/ 4 Z\007\311\232\212\210B\220\252\301/\221\317\t3\003"
+	.ascii	"\234\027s\031P\224 _]\026\260\305\270\254Aq \013`\306\224BA\001"
+	.text
+	.section	.gnu.lto_init.166.a79eddd89e37dfd5,"e",@progbits
+	.string	"(\265/\375`\267\n-6"
+	.ascii	"jY\364\023EP^R\007/^C\376\367\f\204\037'\026\226o`\f\225%\201"
+	.ascii	"3\240\346\301l\367u\353\244t\016W\223\375C\f=x-n\016\0346\b\327"
+	.ascii	"\021B ki\261F.\037\312\003Q!\254\232\241f\311\336M\244L)\"\001"
+	.ascii	"\033\0012\001\276Y\355\372\265\377\211\007\224\313\306\224\310"
+	.ascii	"\355\274)"
+	.string	"\2545\b\b\313\253\230'\377\366\017}\355\376\356p\337\366n\357\2779\335\021s\n?[6(\314`\370\353\321\023\261\277\n_\210\375\325\177\313\263\271\033\235\352\371E\317\251\334\215\277\272\215\227\372\327\235\225\215\341x\251\027\305\322P=\307K}\363\341A\313\240\353G\335\350L\016\336\207\3568ZNa-&\275\031J\205\341i\322\257\2164\374\325_\367:?M\002\177\034\030\2546*\f\303\310\215\304\213/\234\276\027\365\373?G\237\036c\2218l\331U\270\365\353\337R0`\346%\316\353\362\\\376\217\331\037\315\312\264\017\331\367\254q\222\215i\243p\2053\346\355\3278\305\204\021\274\230\250=\334\027\210\342\004\323\305#[aOl)\300\375Z\004:C\253D\266\302~X\200\310\326\327\267B\005s\030\277\217\342\374\022\022i9ibi\266\353\327++-d\036\237Vz\033\237\261\360\b\206\341\217\276\006\362\264\322\272\245"
+	.string	"\303\260\353\346s\353\035\350\335\277\201\273\377p'\322\tk\236\315k\005\004\373\353\272'X\321+\213J\205[\376f\337\277\021\273\267p?V\220X\017\272\377\231\307{\325\374\231\370\273\366F\3657\337(\373\353\336\t\254\234\225E\277\252\364 {\244\223\336\275\302\205\236\2735\231\211\340\f\034\337\272\321<\351\365\336G\214\364\372~\307\276\364\315d\030\302\360\32575\f\257\230\016\224\331@\346\351:\3703\371\325=\200X\333w:\254\b\022\372\233z\277\335\331\325^\2721\f\022 \302\2156\367\277\037K\211\337Tg\361^~"
+	.string	"\"`\306\366F\363\035,\322\026P\305\016\233\034\246\316sB\337I\t\322\356)T\350o\"\355\217\332\311\325\271\211\300\227\354\364vg\324\371I\372B\350\212l\324\3561\222\372\233N$\346\254\316\361^\272Oc\275\321\334\177\251m\354\212o#\356&\036\372\216\364o\357E\255v\242V\373\320k\027z\355AC\355"
+	.string	"X\355@\255\366\037V\373\261\325\356\323j\357i\265\033_{\261\325Nl\265\017Y\355\355kg[\355k\253]\330\352n\234 \212/\256\334\037\224\352\\B\177\026\375\345\326\255fF\342\250\356\322^\356\030\227\316\255s\353\\;\367\016\r^\231\017\032\200\032\227\215k\247~*]7n^\036\373+\200M"
+	.string	"\f\330W\234)@?\033\310G\326\317[U\352\316IF}\311\361^\272\006}\334\356\356\236\313\347\263\217\256\035\215\245\255\364\225\213\307\375s\253n\225\375\325g\377\230\030\227\252\264G\307\372\215X\343\356\321\260q\207\b\033T\033Z\320\377n \353\356\016\276K\r7\347Of\356\245K\320\372\235\216\375\177\255\260\336\036G\2674\316\352l\365\323\204\217G[\334,\202\262\212\333\347\n\357\f\202~-O}\271\224\272$\241Ba\270\312\357\377^\255\367\371rq\275B^\257\350c\300\203\251\317\366\202%\331~D \\\235\211}\3027b\207\233\2707\334!\276\004\325\304\374\344\230,\3514\313\f\364\373\357\020\266\335\356o\221\027\355\310j/\235\335\355^\200%\250\244}\372\257\022\326\375]\3626\321\337d\367\320\025\331\\uf\276O\334\300\340\352\274\276I\013\224\362m^*C\030f>\360\017\016c\351\206\222\305"
+	.ascii	"\207\261\244\204\212\202\232\201|1\243\310a,\321\210zJF\275\200"
+	.ascii	"\222\321\324B\252I\311\0029%\245\234\212z\232Br\016#4\210X\241"
+	.ascii	"~j\352\311\311\211JD\213\246')\243;-\321\200\212\202B:\271@F"
+	.ascii	"A5%\221NRS\310%\"W\316x\222B\322P*\245\220\306i\325o#C\3014\271"
+	.ascii	"j\307N\244\247\360\033\261C\233HG\207v\b\263\267jV\330\217.9"
+	.ascii	"\326r\267\236I@\231\313\225\313\221G\266\240\205p\233\346\214"
+	.ascii	":3\205\bz%\001e\260\344\0359\026\2432Sg\262d\02596\233\243*\335"
+	.ascii	"\".Z\215.$m\032L\235c%\256\334T\330\222\244~\363\232\253\316"
+	.ascii	"\361O\223\276\265\243\320Ph\267\\S\352\314\364\331h\356O\222"
+	.ascii	"{\203r\334\023\244\244\037\016\332\017\267\027(3\323\374\244"
+	.ascii	"$\225}rL%Yt\013\234\215\033\315[9D\023{\313\031&}\321\316*\332"
+	.ascii	"/}!\f\303pQ\351\213\266\211\255C,/\316s+k\241\231\336U[s\243"
+	.ascii	"\377>\334\002\235\325\231\271\227{\207\301\302&\216\270B\377"
+	.ascii	"T\227\271mk\234\031\233\336\230&s\265\260\271mmo\001\200\351"
+	.ascii	"\250Q,G\031RhDDDd$I\322\001\240\002\221\241\242\352\021\0205"
+	.ascii	"e\216hA\222\024\226\003J\177\027\251\373\3276\025>|\233\326Z"
+	.ascii	"T/k\266:\245B\3736\217\340?\322\212\366\260G\005\264uJ9\003\327"
+	.ascii	"\035j\301\021\356\006AWLd\301H\020\340\217RUe\236\256\344l\212"
+	.ascii	"(l\376dz\203\\c>\r\267&'\343%.\336\223\235\3214\215j<\274\350"
+	.ascii	">?CE\bk\267\002\302q\253\244g\275\020\336G}u\370\275/Jce\325"
+	.ascii	"\345^\005\024\004[\021K\323b\366P0\251)6\302\263\222\361\316"
+	.ascii	"\203\321,\031\001\027\260\230O\361/v\255u\n\030\033'Q\374\240"
+	.ascii	"\325\243#\302\002{\217\ra\307\261'\314\335j\267Z\2756\352\335"
+	.ascii	"\370\335\234\224\221\325_\004\246\355\254\r\377<a\273\215ig\033"
+	.ascii	"\330\036u\007B\365\016b8\344UQ\271\336J\3643^!;\032\273\002\035"
+	.ascii	"I0\374n\0041\344\320\237\252,\210\\\340;i\345\204A\033_\214@"
+	.ascii	"\352\322\264r\007k\250\3147\276hb\3402\234\233\nH\267\302\342"
+	.ascii	"\247*\355Jc\236\037\270\273\223\315\375_\203\274q\\\336\272\247"
+	.ascii	"P\231J0%#YRP\201\013 [m\262K\336T\213%,C\024\361HrH\321\205\261"
+	.ascii	"\n&m\303\273\275\302\305\225Q\304,\245\212s\226n\361\237\210"
+	.ascii	"=7y\"*\245\236\243[\312;\241\025_\370\327HT\307r\272\363\177"
+	.ascii	"m\273W<p\025\301\001\272\310]\2573\017P\244\024l\375\212\004"
+	.ascii	"\301\322\267\340\351\025\374\224\315\267%\336f\331\031\224\234"
+	.ascii	"\017\250\215^('\376&\366\002\241\311AM\353\032\266\350\246\306"
+	.ascii	"p\343\314\037"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a79eddd89e37dfd5,"e",@progbits
+	.string	"(\265/\375`\221\007\355\023"
+	.string	"\226d|G\300\224Nch\b:\313\342\274\303D\"\200\337$\217\277\213D\177\026\001L\364\271\225\263\3106f\220.3\370\261\377\246(\356\030\t\034EQ\364\037\335$|\016\2658\324\342P#\006\2150\373\266F.\003\017\356\306)&\031p"
+	.string	"j"
+	.string	"h"
+	.string	";/\230\316\253#\347\r\303y\305t\357\216\233\227\207\315\273U\363\366\240y}\344\336\037\270\027\310\314kD\346=\322\360\027\316\231k\022\363\"\351\200\026\231u\354\326\0270%\222\322!/-Q\221\013\254\006\2249g\205\225\006A\t\352\242\312\262\275\035\\\336\r'S\277\255\226\267J\026NM\375\264\346\374\234`\277\002\b\3030\254\275\034N\346\234\0020\004\257\325\204\367J\302\353!\302\373\001\302\013\342\301\033\302\301\213\325\340\025\301\340\035!\365\222X\360\232P\360\242H\360\246@\360\2528\360\n\211zW@\275YO\257\226\323\333\242\351e\301\364\272Xza(\2751\222^.\244W\306\321;\303\350%\213\336.\242\227\306\320[C\350\365\nzO"
+	.ascii	"\275_?\257\r\237\367F\317\213\203\347\315\021\265\322\307f\031"
+	.ascii	"k6\213X\032\326\222\013@6\215\f\262i\243\220M\023\207l\025\221"
+	.ascii	"\310\236\225E\366\2144\262gb\316&P\036\331\001\306\356\214y-"
+	.ascii	"A\262eegbV\031\222l\331X\260\n\214J\311n\271d"
+	.string	"\227d\262;6\331\025\235l\013O\266\024\224\255\213\262e%;Vl\257\230(\t+0-\2252\255S\231\246\020\323G\263}+\266\257j\332>\003v\217\305\356\325\354^\213\335s\261y6\233\007\332\274\027\233'\302\330\273\362f\357\310\030{7\312\330;q\306\316\2258;7\346D\032\033G\342\306\032\033gc\307\334\330\267\262\026\333J\362\245\263o$\216}\033s\354\233\250c\203\345\216\r\222<6\330c\333l\342\217\035w\250!\bD\241>\005E\225l\034p\203\266i\r\021@TH\214!\"\021\217\004\362\001Xy\366\375\277\177k`\324\235\032\3645\367I#K\200\241g6\350\216\371\200\201\326Q\323\323\336\033\236\201\025;`\233\253\"n\274\017\302\211\274\230,&\024b\220\265\004\331\"<\217]\\\004\r\323\020&i\022\3220\ra\222&!\r\323\b\277EI$S\334\334\n\035\257\343\374[\270zv5"
+	.ascii	"\2126\005<Az1\240\261\230[V\r"
+	.text
+	.section	.gnu.lto_.refs.a79eddd89e37dfd5,"e",@progbits
+	.string	"(\265/\375 M-\002"
+	.string	"\322D\020\034\220)i\f\357\356\356\356\356\356.W\355\275\326\2335\214\212\301\243\376/\372\222\264\275S\237\214\226l\bS\037\203\352\020\334Xf,/F\025;\021\250\210\321\3036"
+	.string	"hs.\214\0226sJi\036\t"
+	.text
+	.section	.gnu.lto_.decls.a79eddd89e37dfd5,"e",@progbits
+	.string	"(\265/\375`-9-\363"
+	.string	"js\231SW \fI;\035N5\275\242\337\375\311\202\253.\232H\267i\202\331\242]\305\311\252 o\272\231\277\n~\371\242CY"
+	.string	",\262 {;{\n\002W\354\245\271\354\f\336\341+g&\361\360)\2250\006\360\333\005w\022\224m\ne:\256\217\022}w\323BD\2745)\245L\001\231\004/\005\221\0059\206v6E \203\001\345\300J\250\231\205\222\250f\310\025\221e\035!Qa\251Q\350?>i\037\326\206@\315f4e'\031M^4\263\212\377|U\227q\004B\363O]&\"\353\321\241\246C\213\225\325\035\226\344ny\362sY\343\357\"\306\337%\007\177\227(\376.E\3743\221\f\226\207\340'\242\213$F\322\362\026R\243\263\250H\373\312\373]\204\262Y.\313g9\b~f\264<\366\031\204\230\224\223\222\214\226\311pT;\213\360\240\347\f(\020\031\031-?1\231\f\017\205\356s\027\243Fx\305\304w\347\262\337\005\210?q\220?Q\220?\361\n\177\242\025\216\257|\370\354\334S\200EZy?\361\217c"
+	.ascii	"\020\357\370\023\205\360'\206\361'6\371\023\237\370\023\207\370"
+	.ascii	"\363>~\001\257\343\317\215\360\347?\370\363\034\374\371\f\376"
+	.ascii	"\334\210\177\313 \377\026)\374[\350\370\267\224\361o\301\301"
+	.ascii	"5hq\342\337\342\303\177\310\307\177H\307\177h\306\177\270\203"
+	.ascii	"\3770\212\377\220\210\2770\312_\310\204\277\020\216\2773\307"
+	.ascii	"\310K0XI-\346\362\306^\037>\303\230\271S\373\313\312\373\205"
+	.ascii	"j\234(\374\342o&\254\301_\030\203\277p\005\377\035\345\277\355"
+	.ascii	"\370\027\331I\370o!\374\267\030\377\275\305\1777\361\337@\374"
+	.ascii	"\213\374\361\177\273\343O\247\323\370\323i-\376Z\211\277\366"
+	.ascii	"\341\017\035\024|\251*\362\003\"\210\255`2\355l\266\224Q\251"
+	.ascii	"A\261\340,\370\211\005q\340\343+X\311gg\357crX\020\373\341\250"
+	.ascii	"L\217\263\033\265\220\275-mE{wv\250\351\320\342\342.\311\321"
+	.ascii	"p\357,\307?\017\341\370\017\003\342g\006\270\312\343>,\367\302"
+	.ascii	"\036g"
+	.string	"w\346\032\202g\317\274??\371\343\f\206zp\020g0\374\234\3053\037\246\342b&H\245+\357\347\240\016J\232[\024\017\347\341'\030\nn\202\241x\n\326\303Rp\024\354\004\357\341'\246\202\355\036\337a&\217\235\217\225\300\351\275%\241\262$n\212\334\234\0244!\201fgWp\220\377\017eX8\370\307`a\230LF\367.C\260\tb\003\020\230\n\246\303d\230\216\t\002>\242@{w~\240\202\3250\022\013|z\357y\001\200\2516$\247h\357\275C\207\232\016C0\254\033Q\n6\026\302\030\2064\270\n\177\214\307\037\267\361\307h\234\202\017^3\305/\300J\234C\t8&\202\323p[\bz\377\351\275k\030\n\375Dm\345\215\217`\266\307m\330H\307m\035<\365\336\203\333f\260\364\3363\2031\006\030c\260}H\341@\033\356?\301q\221\017\217\327,\f\215\230\234}F\347\035\255%\345-\024\001\327"
+	.string	"c\030\016\261\205!\003\214\374\363n\370C1\206\341;\200\177\024c\030b'\006\202\237\033\360\330o"
+	.ascii	"\3425\217X\377\321\273s&&KW\226+y\377\006\374\377\305>CT\007"
+	.ascii	"\361\027\370\343\rC<\2107\f?s\n\370\353\037{\341\037\033\264"
+	.ascii	"\320\320"
+	.string	"S7\353\335I3\343T\"\232\312\373\235\030\303\220c\013C\n\306\376\363\006\016\236\377\331\001\377\270*\213\001\371\317C\347\177\006\341\037\363\310a`$|\211\370\317\202\3778J\366\372\317.>\376s\007\272\216\377\330,\367\340ZY\036\3779\203\035\377\271}(\377y\353\037\247\375\377Xfj\375\347\241\377\234\243\371\237\213>\200\343?'5a$Y\377X\305\377[\360\3777\376s\215\377l\365\237\251\236\004\377\272\354\037\377\345'+y\306?\026\3142\3761\213\177\334\3671\377\032\207\334\377\353\177\375|\374\257u\374g\247\377\f\343?7\375\347\245\377\234\364\237[\374\347\243\377\\\364\237\211\3763\211\377\334\376\347\345\177>\341?\257\377\031\347?\253\377\031\004\377\331\003\377Y\003\377\331\204\377|\363\237-\360\237E\370\317!\374\347\b\374\347\007\374\347\016\376\263\006\377\331\303\177F\300\177\356\360\2379\374\347\001\374g\f\376s"
+	.ascii	"\376\363\206\377\\\301\177\326\360\2371\374g\013\377\231\346"
+	.ascii	"?\317\374\347\230\377\374\362\237[\376\363\376\317\371?\377?"
+	.ascii	"\316\362\217\003\3771\340?\326\373\307R\376q\336?"
+	.string	"v\362\217\357\376q\335?N\362\217\335\376\261\221\177|\365\217\327\376\261\332?\036\362\217\317\376\261\217\177\314\365\217\261\3761\215\177\034\343\037\277\370\307L\3778\351\037\033\375\343\025\377\237\345\377\367\376\377\307\377[\340\377\341\376_8888\370\257]\374\3130\371\317\200*O\2562+\257\003\365\221\001\204<\201\021\203T\fF\345\375\024\220\370C\241\032\260\346\253n\220\217\203L\236\221\350\331\337k@\"\226\253\236g\336\232O\373\271\334-\315\365\274\037?\177\212\356{\275]c\211\322\227\037\327{\372H\347-\001\301\222\367\377a2\241\024\240\024\265)zzzE\215XG\232\221Z\201\304F\214\253\373\003\203\203\002EK\311b\375\350\005\005\334\322Vt\217I\035O\336:J\336M\234t?5\3763`yy\230\f\213\365\"\227  W\230\242\275\277\035`\013Rqr\365\202\277f\202\265\023\374\324N0YM\347\331#"
+	.string	"\034\224\321\333\001`\234 \331\001\306\202?\306d\303\273;\3556AS\035\023\007b\020\275#vy\377L\n88]wao/\367-\361\301X\362\272N\317\341\256'Z\214\274\365\\\326r\232\356\365\234\216\203\371\321s\033c \2031\006\302\266\033=\317\341\376\031\037\376\177Z\351\377\211-Q\240\034NR\222$\321n\334\331\213j\340\200\304\340\200\373\242\216\210-\341\257\331t\333k$\377\324H\264\033f\352<{ \226\240"
+	.string	"cD;\223\021\207\377\377\303O\355\366z0\335\002\241\335V\026\232\217\307\303\336\221\204\316n\344\003\363X\2101\207\377\030\254\261"
+	.string	"\376\177\367\376\020x\235\335\307\t\023?\256C\255\007\306_\3209\364\316c$4\026\305C#4\326\323\205\310\350\216h\204\234\035JC\037\233\352B\316'\236\375\304\223\273\263\377D\035\365\237'\236\245\220\263\033u\347\023\017\205\376sDA\310\331\303#4\026u\204\205\306\236\216h\372O\347\351?=P\374\347\351Hh\311\323\021\005\241\261\236#\241\237\250#\334\235O\035\327\035qF\361"
+	.ascii	"\365\261\236\230\336\373\220\263\311\003\323{\217Q\347\261\313"
+	.ascii	"D=\nJ\324etL\327\345\234\352\275\367\316c\226'\365Dt\372t:\241"
+	.ascii	"\255\247\034\240\336\363:Q\007<\230\307\331{\017\352><\270w "
+	.ascii	"\247Q\357>O!`z\302L\202\214zL\377\351\031\362\221z\202\001\362"
+	.ascii	"y\n\352[P\370HhL\352\351\303Z\220\261f\367q\362\340f\317\213"
+	.ascii	"2\342c<\316n\326\0273V\203i(o}\344\037\027\301oiqdUk\217\237"
+	.ascii	"zM\253a\261\316\363r'\204\304\026ma;\022]J*\242\346\3225\004"
+	.ascii	"\247\226\267N\333HJ\344d\200\364\020<Vvu\205\n\027\362/TE\314"
+	.ascii	"z~<~\352\037\372l\002\274\377\360\241\371$\021C\313\333l\246"
+	.ascii	"OHH\236\034\231\036\323A\360S\227i\261\327_\031\3507\007@\276"
+	.ascii	"~<\265S\206\330{TX\231\006\323N\231\237\272(|\035"
+	.ascii	"x\227_\034\020\276?&\213\177\214\023\377\230#\376m:\f_\271\361"
+	.ascii	"\304\244\340\017\203\205\303\3008\341]\332\007\032\236\013\260"
+	.ascii	"\267.\033OmCs\325\360n\266\304LxDd\350'o\036tBK:\232\016\275"
+	.ascii	"\205\237z\207\316avC7et\357Q?\232;\264\326\332\035\222\016C)"
+	.ascii	"}u>\303\37506\370\303\310\340M\215\303\345\356\311\331\221\274"
+	.ascii	"u\326V\212\243\202Q\342\017c\304\377E\220\377\353\032Xsb\202"
+	.ascii	"{y\353\253\\\245\256\b\311\371\203\270veGR\226\361\32424\215"
+	.ascii	"\032\336\307\370\302\240\2753\035`[\311Z\273\312\273\252\206"
+	.ascii	"\210g&\306B\212\236\302OM\245gh*\375\244\245dx\234\375\250\205"
+	.ascii	"\006\0200\266h\207\030+F}m\357\327R\217\311B\320\373X\214\036"
+	.ascii	"\233\363F\336\032\352\303\353(\b\324\230\362\221\267~\t\302\377"
+	.ascii	"e\007\377\227\0311\372\221\252\214M\211\203~A\374q:\307.0q\261"
+	.ascii	"\310\373_\210\370\222f\342wV\250\340\242K2oXN\253\2745\222n\201"
+	.ascii	"\237:I\273\3501C$d?N\364x\211\226o\033j#\227%B9\262\344\270&"
+	.ascii	"\322,\360S\027\375\026{\352c\275;ct\217R\234Z\336\2179\fg0\207"
+	.ascii	"\341\277\036\322+\252\304\305\320\241W\344:\374\304\021\207D"
+	.ascii	"\005T\021\364\352\006\226!^K\232?\340\232oT+\256\260\006\241"
+	.ascii	"\037\212\020\271\332\232\262\243K\016\272\203\353\t\364g\250"
+	.ascii	"\013\312\003\312\216\036s\315\032Y~\202~4\207H\0215\321lH\t*"
+	.ascii	"a\201c\207\2178'\032)\240J\252T4\235\246\206\232\335\007\254"
+	.ascii	"'\f\372\241.\207e\"\332Yd\004\237$P\264\026WY(\353Js\211\311"
+	.ascii	"\311\210\354\006\220\013+\247(\026?(\2762\320\023\n&9\035zP\025"
+	.ascii	"J2\232\235\307\354g\005\225\217\253\034Q\374\243i\005\372\223"
+	.ascii	"\302\253\251%E%\343\345\276\354\227\243d,\371.;\321=\267e+yI"
+	.ascii	"\326\313py/O\311q9/S\311s\331-\277e(ZE\226\222\257\344?\r\224"
+	.ascii	"\001s\225,\247Qd\301\034\250SdhF"
+	.string	"\222\231\344&\331.?\321>yP\363\344,\272'G\265\220\016\312|\231.+\321?9\t~\346\272l\344\363\221\314\3669-M\r\232\353\362\213'\030\327W\204\232\034\221*U\0322\030\331\306\322\224\031c[1\316,]Q\2364\206\202Kb\240\020\363\352\233\322\"\003\262\203\\\004\263\344\242N\315%tk\272A\0266\326\242\265\247\344\003\226\226e\370\005F\2776\233LTI\223\024?\264\024\235\245\211I\206\327\n\031!@h~>6\334\313Rt\355I\227>\033\342\370J\262\353\321\204\ni\255\t\327\206\342\026UKF<\254\362\236\250\206\362\206)*\252\361\264\205\311\362]\334\220\217\216\r8\323\207\234~\264\364\021\274 K\316r\b\211\210OX\220\270\232[\356\003\276!\252\274q\270\2355YI\345-\274!\274a\324\301\225\riXX\302\032\372\tT\024\276\0365\356`j4\371\315\205\321\240!\264\342\023"
+	.string	"\336\036\030\233\325\356\222b\347f\325\024F\t\243\204T\330\310\350\001)x\356\220D;\223\013\016B*\341\324L\320\025\331\236pJ(\305\001\341"
+	.ascii	"\367xT\351\321%\227\367o\230\342\377B(@\030\"\034A(\204O:p\220"
+	.ascii	"\211\bpF\226\230\250\301 P\362vr\362\201\202D\f\312\373\201\004"
+	.ascii	"\025\302\020\302\320nQUP\241\226[\017\220&\302&a\323\321 \037"
+	.ascii	"\021\217\353F\326\233pI\270D\204\304\326Cc\235\005z\021IJ\322"
+	.ascii	"n5\274\177=_@\367V\013"
+	.string	"\"K\315\026-\266\234T\021\022\233\214\227\231WP\336o\001\325\321\221v#\353\263\323\342{KTP\361\023\026\t\213\236`F\242_\315*F~D\177g\331Q!\221\356\343LO<{\032\204\255\360b\212v!&\016.Dz\306x\200^H\364\302\241\r@|\033w\262R\341\225\267p\305\013U\\\365\005\021J!T\221C\312\220,1\270P(\001\331)\020\nK\220\225\335\215\035yg!\n\341\317Y\231VS\336B\037\341\217.\352\321\333\023\376\350\253\031/\027U6\204=rRw>y\357Aa\307\317\207\023\362\274\214\221\2403\270$\376%\300\0177\334X~\013\202\265\001\335\021\361\035\370\373\312?\021W\261\240\263\023\342\377\333\312\236\r%\254\274\277\002\037\376\024T\361\363\333\200R,\220\330d\222R\244\261\355\277\337\200y\310\221\031\\\024D\341\343C\342\212\266\250\371U\275\325M\231\262\241\"|xh\315"
+	.ascii	"\204\242\362\033\352\242\326\003\314-\357\255\247\347\204hCf"
+	.ascii	"\214i\"4(xp\200E\211\022\201;\035/(n\340\245hz\362\304\b\236"
+	.ascii	"\222p\b\220=\301\"<\274\276\254\346\234\237\f\032y?\005\235\216"
+	.ascii	"n79\333\213\302\027E2\322\301\344w\223\031%\274\244\035w\334"
+	.ascii	"\212'i\355\316\256e\bR\217,\263\0300!mey\327i\261\026Yo\\S\342"
+	.ascii	"\342\266\034\r\237\254f\024\352O\215(\357\337rz.\207\016\251"
+	.ascii	"!\036oo\033\256\346IS\321\252\202\302\240\2402\210D\311o\270"
+	.ascii	"}\004\t\021\027y\357$\332\013\360\017z\365m;i\315+\256\n\t\222"
+	.ascii	";'$\266\036B\\|\331\310\373' 2bd\263IU\311\305P\273\302;\202"
+	.ascii	"\237\233\315\313\210s\251J\221\"\332\355H\225\034n\273\322#G"
+	.ascii	"\231\231\331NS\261\264\245\371\224PM\021\371\235F\274\361\027"
+	.ascii	"\305\032\362\"\367\002)o\210\020a^\022\213\254\263\215\026b\312"
+	.ascii	"\227\233\017~\226\215h%7\336\372\264\202\004\231r$j\311\016\023"
+	.ascii	"Dk\346\3755Ca\037\266\307j\236\364\023\255\301\"!\030\025\335"
+	.ascii	"=\177\217\3114\251R\367&6\314S\022\345'\006\244\316\206\320\223"
+	.ascii	"\037\005v)q\352\0341\177T1\2028\371\372\332A|W\262\f\001\211"
+	.ascii	"\276\270\342\301c{\005\202\021W\320\3215\361\361\333k\006\252"
+	.ascii	"\f\312\310\356\022,R6\324\365\273\207\215\260\262\251\252\007"
+	.ascii	"\033\202\303)o.=\303\331k\204=dM\032z\264\264\366\226X\025\031"
+	.ascii	"2O\364\344^\350\370\275\345\002\005\305\231\231\223\214\022 "
+	.ascii	"GL\352\232M\355\006\330\034\272\220\201E\2053+\253\247\317E\217"
+	.ascii	"\026(h=Ry\177\206$\0336\264\333\007z\370\220z\304\334\371@I\n"
+	.ascii	"\334X\033K\273\315iQy\021\215>ib\305QQm\253\013\\HzF\321\260"
+	.ascii	"@\273\257M\343\267\325\\\314\037\031\035\330\256\222+\302\022"
+	.ascii	"\2307\321I\237\223Y\336\217\001\207\224T\003\264\240\370\320"
+	.ascii	"/\374R4\007\241\240\360\224`\266\244\370L\265\315\230\261\203"
+	.ascii	"80r'\007\2444\347$\357\277\200\345\344d\267\245\347\342\017\205"
+	.ascii	"`S\323\206\301\324\ns\221u\344\355\271\275\370\rc_II\2122\247"
+	.ascii	"\002\351\210\f\"KK\037\264\274|\354\350\240\222\005\246\244$"
+	.ascii	"\334\"\212+:L\302\345\367\264\327\242\005\b1\036Hd\300\322\364"
+	.ascii	"\242\224\035\0355\341\323\341B\003,I\257**\372\200\244Ud&/i\b"
+	.ascii	"/\357\257 DD\244\335.`\207\203\307\260\207\310\016\241\270\024"
+	.ascii	")\366\n\255\032\201<\220\326\310\266\212\337+\006\353\310\226"
+	.ascii	"4\301\350\210B\321W\003\bh\007q \206\205\244\364CF\220\274\203"
+	.ascii	"b\354\220\236\3208\375\374,@\013\013I\306\311\312\223\263\277"
+	.ascii	"\335\263{\264\033\b\273*(\r\301$mg\374w\327n5O\032\017I\212\255"
+	.ascii	"\207pJ\225\243@+,Xt"
+	.string	"\2260\250\227\252++\004_g\361\223qad\343\t\216!\036\237\215)\247hT\007j\200{\020\232T\024\232\211\004!nD\034S\346\005\216J\017B\334\210P3\310\310\274\330(Y\035\035\326("
+	.string	"\344\253\\\333%\005\227d:\202M\216"
+	.ascii	"\343bd\266\257\b\265e\272"
+	.string	"J\325\202c\252\266.H\345Z4\"uZ\026\251\fq\201m\227\252Z\024\200\006\224\354\352\266\252\006\334\365\002\216rm_\327F=2\223F\345j\323\272L\033\r\311$S\251d\225-oq\270\303\2669/\253lA\246jr\253-s\271\227:F\325M\215\312\366u_H(\001\0037\022\220\300\253\272j\373B\264aW\r\256Zb\325!\022\333\033\231\017\326d\272\276F\365U\217\354\313\364\200F\004\365M\215\353Q\271\316\264&F(\261\212pTz\240\276\351qM\246$j^\025\247MMxU\021\030>\307C\321\025a\346=\256\313\026\022\255\352\022+(.\231\305d\222\271,*\327e\001\224;\354q\311L&\2317\354:\201\2114\251\036\205\237\343\201\251\263\3260uV\025\231\272\255M\211\326B;\\\342\330\260\353\005w\211cstC\250-\363MU$\006\257\252\243&\3257F\204\316\262mY%N"
+	.string	"J\260#N0\246\311\0210\237\343\201\002\0238\257\252\303\266#\326d\n\002\333\246#\3366}E\264.\237\343a\203\211V}\337t\004\361s<,]\235\226\317\361P\\\272:\"\226\256NLQ\311lm\214\310"
+	.ascii	"\034=xU\227\346u\331\233\n$\320\262/\253\363\3629\036,P]\246"
+	.ascii	"\222)\3639\0362\020qR\023L|\360\252#\224\020\302\305\306mU\022"
+	.ascii	"k{|\213%\204\330%\204\030\336\274J\265m\231F\232\327\346\230"
+	.ascii	"\\\231#\210/;\311\262\037\024\205*\316Q\0028\312\365\230\252"
+	.ascii	"\025X\227\"\\\265]\231#P\333\f'\030\323\021K\226\255\300\314"
+	.ascii	"cxWe\bW\271\336\034w\334\2277\256\255\252Tq\370w\240\200\004"
+	.ascii	"(\200\001%Z,\274j\361m\331\233d\272\266\252\233\341Mm\334\226"
+	.ascii	"u\225\252K\200\235\324\204\213K!\231d\333\227\026WU[\0345\204"
+	.ascii	"%\314\253Tu\2248k\322\003\fjQ=\262$\250-3\271\246\310\230\367"
+	.ascii	"s<d\030\2721o\261\005'5\201]\205\025\336\317\361P\202\035a\203"
+	.ascii	"\263\234\340\030\342U\252\312T\247U\227/.\005\021%\330\017\330"
+	.ascii	"U\271.1\274E\227\004\376\0267\340\240\350\342\244I\021\3345\204"
+	.ascii	"\364\202j\\I\250!\204\270\021ATwJP\215-\223u\325v\306-\302\234"
+	.ascii	"\310)\356\244&dN\344\024)\234\3109\312\344\030_V\371\212\200"
+	.ascii	"\335\"\362\270.\20778\004\016\001\037\327\245\246y\225\252\261"
+	.ascii	"Uo^\345\312\336,\231G\345\272\001\r/;)\007\230\"\216\353R\306"
+	.ascii	"\203\244JBM\316\274F\025\211\264\360\266\352\233\\\337\242\222"
+	.ascii	"=\261\266lN\r\006vR\0234I\325h\364@fu\225ik\302\261MwZV\204\243"
+	.ascii	"\252\"1T\300\345DNq\003\327M\227;l\222F\311\2622\024*\224H\223"
+	.ascii	"j\273\276$q\224i\215\273\226H5\320\270:\305c\252\346\244'\260"
+	.ascii	"l\262\330\252\3125m\337\"\333\032\323\t(h@\"\331\227i,&\331\366"
+	.ascii	"U\262\306\242;\"\255\240.M\274\305\r*\234\310)*\327\0239:\255"
+	.ascii	"\372\036/\234X\333TU\256\025x-\274.\313\216(\"\221\\\325I-\260"
+	.ascii	"|Y\272Iv\331\252\257r-\221\352\024\221H\232w\325Y\223E\365\204"
+	.ascii	"u)\323\262\2571E\026s^\226\325q\213H$\005vYB-\252$Z\246\261\210"
+	.ascii	"\\&\213J\023\307\n\256R]\352\260\306\"N\352\026\337t\004\t\f"
+	.ascii	"H\n$Y$\005n\222,\bH\n\030M\200\260\223\232\340\257\313lsLP\335"
+	.ascii	"\364\203\235\324D\314\b\324\026YT\335$s\251\263\026\221\310\""
+	.ascii	"\005\256\211t'\231V(\232H\215\352\261\330\262m\253R(\252L\243"
+	.ascii	"\253\2664\3125\305\271\240\352\254\257zbu\213;\354Q\271\356T"
+	.ascii	"p\"\247\330\252orE\026[\366MI\250I\265\302\347x8\256K\2337\007"
+	.ascii	"gM\"k\334\"\b\307u\371\242\303*\325c\321uU#\333.\213\307uI\363"
+	.ascii	"\026"
+	.string	"\025\360\201\253F\245\332\252H\265-\252\311$k\274\3609\036*xv\251\2666/\313\2666/n\021\004\035\365uM\2702%\324\2432\304q]\316\220X_cJ\243\036Y\235\"\016s\204ztq\215\353\353\256o\372\272\305\023\334\364\235\3111\276\353\216\b\227\275Q\200\232\\\221l{\243\276i\213\341\004#\2334\266*\t\266\310\\\032cT\235\325\004\325\230\266#(Kh\325\035v\231\241Ms\214\273UW\344\372*\325c\210c\233\262#fN\344\220\240\2729C\365M_\021Jv}\323\226\211\263\"\225\254\261\202\372\246\030PO\254:\353\273,\241U\223\314\243\232ct1\274E\006\274\312\225\331\362\037>\200pA\006,0\0027zxW\345jcD\332(\327T\307\306\330\2726\036.\340(W\235\326\203\205(\250s\"\305\211P[2\204\024B$2#I\223t#\026@@`T\036\030n\243\354\001\023"
+	.string	"\321\312D\232\224\266L\321\214$)He\332\r\201v\204|3\346bK\314&\273\300\217\237U\210\251\317\2752\253A\305\321\337\272\233\375{\017\347\357O@2\036"
+	.string	"\271\271\375W\200\3564\024\343 \302\024\323W\310\227`\330\2620{\210%[PP\243\271f#\031}\353s\263h\270\340\212\213\316\017\302\370\f\235\3167\f[\275\277\251\\O\346A\247l\360e\033([\230h\005h[vu*\367\252/(\341\254KKg9b\001\2252\242e$\r"
+	.ascii	";\351\300\232\f[\325\013\224\251\261\204L\330*h\237]\315\232"
+	.ascii	"\360\316R\1776\372kN\027\373;\202\356\344\301\236\013\303j`\341"
+	.ascii	"\262\301l\232\227Rr\033\204\343\300Q\334\215g\306\273\325\355"
+	.ascii	">\221\304\311)\"0t\273\035\207\371\271\210>\270\241\201\211\261"
+	.ascii	"\233k\261\336\225\317\351\354\213\2154\255D\301\001v\252\b\222"
+	.ascii	"A\317\303n\306\030\3761{\320wjl\217}\340S#\361\267\017c\267\263"
+	.ascii	"bPh$\004\316L\312\304\200?\034\231zE\331\247+[8\216\356\337a"
+	.ascii	"\355t\203\235\203J*\323\244Tm\210"
+	.string	"\036>\036\372\275\230\244\b\355vB\013\201AZ\325\365\006\347\001\267\324\360\035\262\025l\026\226\260\302=\006\226\306\303v\372\305\313>\347NC}<\310\311\216\2567i\261r]\200\257\005\306\262\207a\300\016\027%\231I\205\3526i\261\267Cq\367\023\307L\013\231\226\371\221\244\213b&\b\245 \246\223p*\360cv\203\342\256\\\255c(\n\237\270\316\335x\001d\265;?\350\0055\243/\322\2703\354\"\241\223\020\233i4\021! \327M\272O\302%\300\371/VO\364z\221\337k\271\026F\271\034\372o\016{K\224$H\242n\231X\346\222\210=r\300p\250\377\346\322#\257Q\254Y\242\313\nO\242\035\364\210j\202\020\3008\345\226s\376N\2476|!I\"\257h\274\251\356\231P\340\307\264f\fZZ=\361\212N\277\204\236\006\235J\353\246\202B\376B\367\255\351\007\202U\034\201\251\024z\026 8T\b\020"
+	.ascii	"C[\007\251\320[\277\326\233\316\364qw\343s\230duk\271\036i\233"
+	.ascii	"\227u\343Mv4jU#\025\353\033g\032\365\265\227F\352g&"
+	.string	"Ja\f\237\331\300S>\340\264X"
+	.string	"\250X6\330*\005\245i\350y\351s\331\341\3675\271x\370\353\317E\256\020\271\017LE\361\013\037\345\242}\320+\261\346\276\t\317\263\240p\343@L\247$T\2654`\001\205\365 \233\321\273\327\231h/\n\374-\024\216u\201\203\253rhU\t\251\250\330f\034\204\275\354\216\300\36341\207\223cyf\375KK\360\341\021\334\314\316\020\206\225K\np\320\275\201\235u\256y\337\333J\347kmz\337h\254\214g\327Vtp\361\016\230\036:M\034n\035^\032\233\006f\346\017\2606\217\301\264\254\267\276!A\244\212\206\3417m\327\3410b\214L\236\351\035\345\002\253l\355\035\0278\r+kY\027\003q\233\233\375\354\267:\345\235p' X\030B?\262\346h\203\004\027s\254"
+	.string	"){\3353Q\322\333\327\333\227\267\347R=\252\233\204\375\262\210\354\022A\347\366\362N\037\355\271\345\244V\274Z\366cq\276\355\217A_\276\221\362\212\033\030OS\216\013\030\343v\206\225\346FRL6\377d\246t\351\302}\233W\261\370\350\344\b'?$\024\337\207\212\204D\324\336^\222\232\013\332\003\335\ttE\220\2158\316i\022Xg3\250\023\210\354<\240\027\360\237@\317\234\276\372,x3s1\222\373"
+	.string	"\325l\354\346\034\231=\225#\206)\354\247\327\273f\031\335mU]\320Ur\326\202\313qO\347\\\377\317\277\247|#:Ts\261C\002L\372\374\\5loG:\3106-d=R\363\263eq\034\251\231\034\302M[a\345S\241\216B\006\375*\366I\005er\217\376P\310j\021\325\254a%\321t\007!\213\tP)D(\nI\037\3301\252\225\366\243\212\rVN\330\260m\314\\\\\252\236\330\345^Q\243\002\377\031\243S?a\221\021\265\251\263:T\271K\270\ta6Mc"
+	.ascii	"\304\201\336\361\213qX\323\312\315\241,\016XJ\277\376\251\266"
+	.ascii	"\\q\314Zl\227c;\325\250\033l7_\224\2422HLL\375\277\026\22405"
+	.ascii	"y\326\243\0362\020\t\364\031\263h\252\256\322\375\336\031\266"
+	.ascii	"a)\377\231o\206\256XhT\206\307|\252\261\234\241\303\002\316v"
+	.ascii	"\236\305\356\021\245c\360\035\214\032\224\225\362 \n\034\305"
+	.ascii	"\024C\262\020\220\360\275][\227\204[Wh\305=\220S5E\254\276\375"
+	.ascii	")\237\210\226\024g\242\246\317\030L\323H^\032E|\237\245\255\204"
+	.ascii	"\352\232\305#\207\333\272A\367V\322\367\004\301|\235\275E\236"
+	.ascii	"\250\271\nY"
+	.string	"S!\242]G[?\253\005\342m\265\326Ms\333a6\306\003\243^\254\353\221\302\033{\255\017\255\334=\211^;gV5\212D\267b\316I\231\270\022(4\330\267\214\313\320\235\322\254eU\373\346\355\341\244\026GQZZ$\030\301}A\022\233\002D\320\003\267\203\2057?9\251\0017\021n\215~\341\201\363r\232\246x\023u\210\361\266\300\006\236\356\347\341\2378\306\265M\265\003n\337FRR\244\035\305m/\302k@\304f\352'\n\216\336R\353\311.#\323\236\232;3\202\330\203HD\333\276s\206\036\346dFS\3349\f\202\344\217\323\226\237>\"\361^\215\341O\204\260\220\210#s\214\206\316\024\013s\230\360\271o\365\340a\324\271\316|\321\324\213\323y\315\001\341+\315\275\351\357P\304\030\007\260\257Rs\3275\016\017\213\2259\372\017\363\350\216\213.U\001%\023\262R\211\256\355\021\341qx\336\243\367R\3225"
+	.string	"\330\246T\002|{\002\253\323]\326\"\246\366\rZ:\t\276\241\246\255\251\001\300\267"
+	.string	"\242\270\210\344\213\002\023.\321\263\213a\316\223\305\345\224\300\013\214\210\376\251\353~[\240\212a\020\213}\240\250\302T\200)8\221\253\206\341{\237\030\rZ?Aq\253\313\324d\321\325R\236\352\206\277\272\340(\231T\001\022\005\304\023\205OY\326a\366\373k\357\352\375\212Q2fl\277@R\361\203\036\375\2758\t\232\201\226X&\343L8\240\324\016\263Z\323\357:\256\013d\265c\3602\205\236b~2\220\247 \026\216\325\004y{\360\270\205\326/>\f\273H0\307\226\207\034F<\245\\K"
+	.string	"\343\320q)\027\314\211\031\377\270\204\255\211Vg\036\347.\215\303k\016\233\rT(g\3622\271\350\274\333M\232\332]\312\275\215\210\177\020\0024\017\f\334f\032C\306G\3347E#\234M\n1\255\0073;M4\371\"\370U"
+	.ascii	"\247`N\251 C,N\367\215\237\267\314\025\314*\273N\357G\275S\226"
+	.ascii	"\323a"
+	.string	"\306\330\003;)\337\271\032\332\202*\334\\\341l\373Q\276L\f#\300\3462\n\230\277\347\251\251\251+\202_\213\236\225\325\207\200\024\324\n\312\033\204_\312\335\324\373\357\361\261=h\310\030\314\272\257/\303\3011NI\024k\025a5\363\263\3247\007\303O\314\266,\261{\260\214|A\372\237\023\305\t\243\205A~*\3059N*r\326\034\305XK4L\272\302\315\303\241\211\211\273.\316\223\244\247_\235H\004j?v]\274\376\027\304\215C\243X\365\226pe\351\202\030\311C\217S\032nW\234\273p\357B\365O\202\270M~i\311\336\202\200\0239\036\343\263K\253\327\305T\333\242\\Wm\035\333\241\203\3740\302\354w\256^\343\022\"\353R\303-i\247\377\322s3\372\313\265\235\270\321\346\205\177>\177\343\006\365\363\232\246\357\227v\224!\005D\343\006\276>%\223j\302h\233\374_\335Ta\025VI\262\230,\277j\341"
+	.ascii	"\002P@\025\201\327\263\340\275N3\322\265\206E%!\311\007\3436"
+	.ascii	"\307\270P\224\030\022\235\223\217.\375s<\034\341\331\327a\210"
+	.ascii	"\006N\201\267]Ih\347\371\337\3465\003\032\245t\240\024\220`L"
+	.ascii	"\002~\255\345\017\"Y\375vM\342\025\351-\3207?E\232\212V\342:"
+	.ascii	"\320o1\214\271!fu\372G\215 \373\306\026Z'P\257\376\266\250\223"
+	.ascii	"k6<\324\341\033;\312\346\356\233\353\313:\"L\227\302\270A\211"
+	.ascii	"2\265\230\306(\326\306\356\221gL@\003\f\246B\033\260\213\311"
+	.ascii	"\3076S\260\310\3122\236\262J\340\303\200;\024}\310\361 \373\207"
+	.ascii	"\370}\326y\263\347\242\277\331]\333{\026x\314\374\257\231\263"
+	.ascii	"\022>Y^\232>\312\036d\266goN\306\032\243\0137`K\210y6\372\261"
+	.ascii	"\377\0279\216\231\231\260| \263O\266\206\367\260\204\363\n\333"
+	.ascii	"\353\026\002\273\222\272\304\362\242\035\027R\307\330\370\004"
+	.ascii	"7\tq\304eo\344\r\361\253v\004'O\271/\"?\222\207\333\303e\314"
+	.ascii	":\214/\200\016c~\027\361\357\226q\303\023\237a\367\205\222OO"
+	.ascii	"N\220\320\263\341\265\205\243\231#s\356\240\376\320L\177\234"
+	.ascii	"]\004\r\265\302\037\005\2525W[\353\n"
+	.text
+	.section	.gnu.lto_.symtab.a79eddd89e37dfd5,"e",@progbits
+	.string	"processLoopback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"requiresSpiLeadingEdge"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"pinioConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"IOGetOwner"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"tasksInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"unusedPinsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"motorEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"motorPostInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"statsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"baroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"governorInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"rpmSourceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"telemetryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"pinioBoxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"pinPullupPulldownInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"pinioInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"servoInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"gyroSetTargetLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"sensorsPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"motorInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"initBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"printfSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a79eddd89e37dfd5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
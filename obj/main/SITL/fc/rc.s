@@ -0,0 +1,2048 @@
+	.file	"rc.c"
+	.section	.gnu.lto_.profile.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\005"
+	.string	"&"
+	.string	"'"
+	.string	""
+	.string	"5"
+	.text
+	.section	.gnu.lto_.icf.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\237\004\035\025"
+	.string	"\344\027\223\005"
+	.string	"8"
+	.string	"\327\247\225\242\004\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\275\317\333\256\006\003\320\245\225\343\004\004\336\367\226\344\b\005\240\244\342\246\007\030\002\003\002\004\002\003\005\002\003\002\005\002\006\002\006\007\002\002\001\002\001\002\b\002\t\007\370\326\276\261\016\b\t\240\342\234\212\n\n\013\f\017\301\337\326\367\006\n\001\002\002\020\336\201\301!\034\002\003\002\n\013\007\f\002\r\021\022\322\265\274\367\f6\002\001\002\016\002\007\002\007\f\002\f\002\017\002\017\002\b\002\b\004\b\002\t\b\002\t\024\025\352\263\360\321\b\027\030\031\032\033\245\331\372\241\016"
+	.string	"\034\220\206\233\311\013\r\035\354\206\342\366\006\002\036\037\377\341\234\356\013 !\"#$%&\266\333\201\353\013\002'\354\305\344\303\001\004(\330\277\200\376\006\013\002\013\013\002\013)*\347\273\234\355\f\002+\215\317\243\217\013"
+	.string	",\363\277\247\333\001B\001\020\002\f\001\f\021\002\r\002\022\002\022\002\001\002\023\002\001\002\r\021\001\007\002\n.\244\276\364\350\002\b\007/\312\255\240\326\b\r0\344\246\352\271\007\242\001\016\020\001\003\r\002\007\013\002\r\001\002\00112345\354\301\313\231\b \f67\323\216\321\200\r\036\b\002\024\002\007\025\001\002\025\002\f\003\002\004:\232\214\265\246\f\005;\350\300\306\254\005\002<=\313\305\255\235\002\032\001\002\001>\277\303\377\370\006\004\016?\313\322\375\213\007"
+	.string	"@\251\211\234\335\001\f\002\r"
+	.ascii	"\200\236\250\001:!\221)I\n\351P\202Q\250\214\350\001\020@i\306"
+	.ascii	"$)\244\003i\370\205\354\r\201\306/\364\205\204\247\177TH\324"
+	.ascii	"\317k\254\030j\246o\271vF\037\305p8\2125\243o!\326sk\242\210"
+	.ascii	"\223\272\3271\021\034\022@{\342\201B\200\037\210zQ\n\256\201"
+	.ascii	"%\211 \024\374\355\270\355@\337%\271\001\357\027\343\033\034"
+	.ascii	"d\203\236\321\226e\230t\027\331\234_\353\2219KV \312\337\007"
+	.ascii	"\311x\001\326&\355\260\204I\263\027\255\207+\r\037E\210|\205"
+	.ascii	"\337\376p\231\t\027\336\372\352z{\200C0\200\277\377\246\310\336"
+	.ascii	"\232\364\344<v\030\372>\372\260\343\242\3406\226\322\236\177"
+	.ascii	"\254}\020.a\374\232\362\\\255\036p>\326^\240L\336\321\312\251"
+	.ascii	"E\341\021\177#O\264\220\032\372Vt\370\327\2573\236rJh\316\001"
+	.ascii	"\350\353\343\326\021%W<\277\320\245\272s\256\306R\333Bve\316"
+	.ascii	"S=\234ErK\244\003\242\211kG\321\363\345M\331\274\332\243\325"
+	.ascii	"c\030\330HJ\372\303\036\213\356S\032\245N\261)RJ\273\211\n]="
+	.text
+	.section	.gnu.lto_.ipa_sra.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\375\004"
+	.ascii	"\322\306\023\032`O\322\001D0\f\3030\034\345\256\345\213\013\317"
+	.ascii	"Ep\237\036\256|\032\221;\245\316\314\304\314\313Zfe);Q%G\312"
+	.ascii	"\t\331\207\372\277\243\264\326\230\214\205\242\266\023\210C2"
+	.ascii	"\2540\tsP\2124\365^\020\370\025\240|\364\035\264\2323\371&% "
+	.ascii	"\340\002\241\252nu\262\274-t{\243R\274\005J\276\241\004(\271"
+	.ascii	"\030\374\017j\202\200g\245\211`\025\331r\005|\033\336\005\337"
+	.ascii	"\031Y\320\\\0073C>\2562\330z\267yl\226\255\034\221\206!\202d"
+	.ascii	"B\262\230\314*\013)\361H4<\004"
+	.text
+	.section	.gnu.lto_.inline.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\370\b\035 "
+	.string	"\226\355\227H\260XQ\032\003\374q\235\023,f\2458\335!{X\371\3652\225q7\3159\fw<Z\330\264b\355\325\351\257\376\351\300\251\2661H\333\260\377\240y\312s\f\252\202\007\0354]0&\212\207H,T\377\224<i[\312\235\002\201"
+	.string	"\205"
+	.string	"\204"
+	.ascii	"3e\322\002%\307\027n\227\035\023\026o\327\341\322\200B\364\024"
+	.ascii	"@g\255\354\230\266\320x?L#R\204)\212_\343M<\230\372\274HNf\020"
+	.ascii	"q0j\213(\351j\033\344vQ\322\325j\226<z\303V\024\204A\233\330"
+	.ascii	"\212\202\026"
+	.string	"\274\337\340\324\333\234\223F\352\273\003[\177\246\177\323~\344rpu\005u\3169\275\337Y$%]\355\003\352\177i\214\277\001\215\372\027\320\370\276<\032\203\310)\311\346\025\254z\n\313\343:\266R\026Wx,y\022q\3501\200l\334\326=`\234\033kS\f\256\021ni\247\233\030q\216:\2311$\247\207\270\271Y\033L\333\242 \034M\3362\231kPk\324l=R\253keM\233S\227\313u\2461\324\037F8$0\037\356\026#\034\222\030\001\267rJv\231\326\320\266\346\216\362b\204c\252\331\365\343\334Z\362W2\347\264\331\bd\316\231`\230qn\373\307\244\3442\324\232\255\350\346\375\271\376\002NS^\337\243A_\206\264\360\270b\032\207\255r;\202\026\225\231\325n\227\331($\306\324\347YM\373\252i\217 \274\003\352\263\352-\2410\256\3548:\313\020\344\007P\271\017\"LO,\217:\013\304\243K\026"
+	.ascii	"?\260\211\377\310\354l\214l\020~\\\346\234\257\031\304wGwsN\326"
+	.ascii	"5\013h\024\310`\241\242N@S\005\367\300\257\037C\315\315\310\327"
+	.ascii	"R\366r\255\243M\237\212O\375\261\031\215*\302\213)\212(\017\377"
+	.ascii	"\0209\031Q}\363\253\007e\r\315\371\243\272\303\017\264\302\202"
+	.ascii	"\336cN\026\b\346\240\001\3642,\t\035\005\351Q&BGA(|!&u\\\251"
+	.ascii	"\302P\322\325H\bEqJ:w\205x\317Vq\321\342\205.\351>jIl\361\310"
+	.ascii	"\023^\031\270%)\004t4IW\263\301,!\004\360\240\312M\035\341S\326"
+	.ascii	"\306\226\234\317\236P\3537W\022C\342R\316%MJ9\333]\245\316U\346"
+	.ascii	"\304\271\312\234\233A\315\311d\373\244#\200\300\250\001=\346"
+	.ascii	"\020I\311H\222\202d\230\003`\002\031\032\"\253\007\022 \025%"
+	.ascii	"\310\262\b9ehD\302(I\37145\007\020\216\004\313r\205\227\316\267"
+	.ascii	"\013\327C`\f\263\n\201\335\275f|d\364c\305\\~\320\204\024Qm\205"
+	.ascii	"\200\037g,.\016+\257K\240`\241B\304MO\300Fe3\375[`I\262'\333"
+	.ascii	"\0253%\362\320\0062*\236\t\0132\354u\031\340q\364\330\352\fi"
+	.ascii	"\232\237\005\276\214\340\325b\232\345\201\031t\2558\270>k\013"
+	.ascii	"\017\026\273\013\224Q1\253.\024\025\371\213\341\207\004#8z\364"
+	.ascii	"\333\007qB\244[I\350oD%\375fqCA\004\316\342\252l\262\257\323"
+	.ascii	"\217\200!\302\252\2252\002\004\033\")7jV\353\354\250r\"\372\322"
+	.ascii	"\362\334B\264u\273\ndq>\300qY\256r\307*\017du\244\371Y\f\330"
+	.ascii	"\256a\265}\356\230T\201\316\004=V\202;ns\254\203\313`\\\305^"
+	.ascii	">\b \235\205\255\270F0\275\304\365=\226\343\325o\003\003\037"
+	.ascii	"\177K\017=X\344$'\302\201\026\031\347B\316\253\337n\264\210X"
+	.ascii	"\346\261\fi\321\353\330\330\333\313\343\335U\021\216\311\377"
+	.ascii	"\222V\355\315\200H\1777\026\376\366\227\276I\257z4\205\347\325"
+	.ascii	"a\224\221\030\017%\363\"h\344\367g\303O}\300L\314\001\312\216"
+	.ascii	"%}\330\341{d(\361\301\203T\244X\202\006\350p\326\337oF?ey:\323"
+	.ascii	"\250\260\222\2144\033X\rF\270dp\030\020\260\245\217\2155jJ^\232"
+	.ascii	"\314\r\031\334\337jB\034\323\254\253\005\330\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\340\002\005\013"
+	.string	"\322\r-0`M\222\016\260\201\004\201\362\005\b\265  \202\240=be\245"
+	.ascii	"t%\bp\242\027\017\006\035%\302\025\212\266\003bU\275\341XS\231"
+	.ascii	"4B\244L\001?\306O\177\361\026_\361\024?\341@\t\r\313\265Q\251"
+	.ascii	"\252\034\021?\304\003[\013j\255\205\220 ,\277\262\221\255Z#\245"
+	.ascii	"A\363\f\307\r#7\254\234\243\305,H\367\b?LD:\234\237Z;\361\340"
+	.ascii	"p:\0162\252 \235\306\252\020\200l\002\202AF\302|\301_.=K/\262"
+	.ascii	"\374\002\215z\224\036D6\340\347\341%\254\274\265 \351>\256\316"
+	.ascii	"\\\035\376\267X\324S\344\263T\tz\225\336@o\"\251\316\254H\002"
+	.ascii	"K\250\201EC%\304\244\264Z\r`\002\0312\245\007\022\340\343,\206"
+	.ascii	"\321\020\203\314\"\233\230\t\264\334j\003^\"\207\370\336}\300"
+	.ascii	"z8\031_\016mT\344\022\327$\314v\271\307\305\211\0345\275+n\030"
+	.ascii	"F\234,\231\237p\302\203\274\254(\022Z?\363_\360\371)\224\234"
+	.ascii	"\030'\250b\271IQ\331\232\312&\220\r\b\354?\270\"\336\020\314"
+	.ascii	"\3136\\x\273\313\315 \214n\277\311v\230Z0N7\371\301\320>\316"
+	.ascii	"\226_\3121\376m*\371\315\327j\030H\005\377;8h\002?\226\217\004"
+	.ascii	"2\253\353d\240\355Lv^\250,\206_\224\002\362'"
+	.text
+	.section	.gnu.lto_.pureconst.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375 h\325\002"
+	.string	"\202\206\025\036pM\322\001\017\274\327\210\376\273\252\252I\354\022]mD\311\234\360\332\314\212\371BK\033\330\001\027\263\272\\\313Y\271\224q2J\306\310\t\371\036/\307\253\261b\334\305\250\030\023#\342\036\256\341\246[\270\204;\270\202U`\004\274\242\023:\237\357\317\371\232\317\222\231e\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\230\002%\013"
+	.string	"\002\217,-\200\251\031\016\323\204\337\022.\023\021\325\240K\r&h.\324\320_\204\312\b\366\r\362\255Y\373\223u>Z\213!\250\343\324%\202\354\336R\246\377\317WJ<\325\026A\b\350\341~\351T(\247\022\332\034\2765L\345\323|\345\257\216gx\204NH9\244l\201\rp\301\313;\367\310\230;\027\240!Q?IJ\247\334\261T,%%\202&\017-:\225\322`Je\301\023\263GiT\366\003\177}5\325\343\232\227\361\365q\215%\261 \350\3634\325\234G\332\226:E\035\306\314\006\023\210\312\017:#\345\020\177Gc\235\223\316\226\267\375\231\212\251\030\213\355\314*\002U\250\001Y\006\r\215$)TZ\003p\202\031\263\242\007\021\260\0313\324\310\210\024\244\300P\267n_\024\375\036\222\243\004w"
+	.string	"\327#\203\244\t\025\037\177\232\232\024\335\254"
+	.ascii	"\266u\216\250\006\306;w\370\336r\2029IB\001J\023\326\t\2170\274"
+	.ascii	"\032\241\206\305\365\\\244\255\037\334\034Q\303\216\246\b\n\322"
+	.ascii	"$\205P\266_t\264\365XJD.!\210\240 \310\226Z\254\"\271\312\"\f"
+	.ascii	"\311T\363\274\263\020\032\267\243B/\251Ca\032\207A\026\264:\250"
+	.ascii	"\320\254yS\025\364\n\254\342\344\316\302\271\327\020v\364\377"
+	.ascii	"\375w3\354\234\223\3368\370\372\177\207\263\024\342d"
+	.text
+	.section	.gnu.lto_.lto.625e87025f715dff,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getRcFrameNumber.82.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375 \354u\006"
+	.string	"b\f-2Pm\222\016$\243\252\022\252\256\213J3\212"
+	.string	"\271\306g\325\2756o~\307\332\335\016\257\025\334\b\212\205\250\252\212\250\2013<\217S\347\377\375o\244\221-SK\031\211z\322\301S@(Hx\022\305\3602\227\247\005\003\3525L\023\365,X\266}\260a:\355\341\373Q\254\272\030;h\260V\335\325Du\330*\022\035\314\036\343`\253\370B\331>?\216\215\342)\t\3102#\262\223$q#\031\377\346-w\243\034\233+\b\273\270\"\020\017\210\020\223L\354a\n\020\325A\275Du\315\242U\261\272\355(\244A!b]\234\"\205 3G\353\362\364\326\177\340\027\370'\002\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getSetpointRate.83.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655P\215\322\001$c\036\")\rJ\241\233\035\251\2037\343"
+	.string	",\254\231\031E\241\264\177\032'\306\260\004\177CH\252\252\312\250k\306\215\241[8_\370\266\277\367\226)\005\240\317\203\347\365\352\\Y\274\020\242\302\307\223\020\257\f\024;\233b\013\007Yd\300\260,jT\367\27339\307\031\271\b\b{t\205\371_Ps\270\243\241>\031\326!\224\336\f\353\220\313\260F\331jU\242t\026\255\337\235\251\315\254s\312\316w)\225\004\234\374\023\255\225\223@VF[\255\325\264u:\325\221f\376\n\224\310\177\202\n`\f\333\326(kh\355\352\2510N6\001\221\370P\371\0379\006\260\030>o,\206\356\302\232S\253\275\341\227RB\331H\"\347\305\340\177s#Q\270\316\003mC\002\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRcDeflection.84.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\235\007"
+	.string	"2O55P\215\322\001$\243n\222B\202J\341M\210\263MJ\306\001XD\250\331E\241\264\177\032'\306\260\004\177CH\252\252\312\250k\306\215a\217p\336\372\266\277\367\226)\005!\320\303\347\325\362XX\264\020\242\002\350\223\020-,\024=\234^\013\007Xd\270.,n\266\373\335\231\234\353\220\\\004\204A\252\312\374/\250=\374\321P\237\f\353 Jk\206\265\310iV\244li\267Q\272\213\326\357\377\353Lmf\235Sv>\314\006J\200\352\237ha\371\t\\i\264\315\332M[\247S%\251\346\267@\215\374'\250@\306\260m\2152G\326\252\336\226qr\212\211D\310\312\377\3301\300\305\360\231s1t\030\316\234Y\355\016?\225\212\022\2554rb\f\3767\265\022\205\353<\320V$\n"
+	.string	"2\241\241/p+\n\036\026\317a\002\n\230\342\022\350"
+	.ascii	"TFi\266\261\353\336"
+	.text
+	.section	.gnu.lto_getRcDeflectionAbs.85.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\245\007"
+	.string	"\362\31645P\215\322\001\244\204\251R\272\bJ\317\222\020\267\310`\260L\033a\344\026R(\355\237\306\2111,\301\337\020\222\252\2522\352\232qc\330#\234\267\276\355\357\275eJ\001\240\317\203\347\325\352XX\264\020\242\302\307\223\020-\f\024;\233^\013\007Xd\270.,jN\367\273+9\307\031\271\b\b\203\024\205\371_P{\370\243\2416\031\326!\224\326\f\353\220\313\250F\271jO\242t\027\255\337]\251\315\254\363f\347\273\244L\002R\376\211\325\312K\240J\243m\326j\332:\275u\244\231\337bK\375'\250"
+	.string	"\306\260m\275a\216\254E\275S\206\311'$\022!*\377#\307"
+	.string	"\026\303\347\215\305\320a8sf\265;\374P*V\032I\344\274\030\374oj$\n\327y\240\255H\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRawSetpoint.86.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655@\217\322\001\230.\220\210\033Y\247\003\274\205z%0]\361g\244\003\030\332\257\372m\f\325\250\241\241\247u*\3030\020\030]\r\220b\260U\222\372\255\265\275\267L)\242\320\003\350\365\372\\Y\274\020\242B\b\224\020\257L\024?\235b\013\007Yd\300\260,rT\367\273;9\347)\271\b\b\207t\245\371_P\177\030\244\241F\031\326a\224\336\f\353\221\333\260J\331jU\244t\027\255\337\335\251\315\254s\312\316\2271I\tX\371'Z/G\201,\215\266Z\313i\353t\252%\335\374\026\033$\377\t*\2401l[s\270CkWO\225\201\262\n\213\204\210\313\377\3501"
+	.string	"\306\360\271\2031t\030\326\234Zm\017\277\223\212\226\315Drf\f\37677\023\205\353<\320v$\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRawDeflection.87.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\235\007"
+	.string	"2O55P\215\322\001d\026gJ\321\222N\372\211\320\263\331)i$\226\001jvQ(\355\237\306\2111,\301\337\020\222\252\2522\352\232qc\2502\235\267\276\355\357\275eJ\001\240\317\203\347\325\352XX\264\020\242\302\307\223\020-\f\024;\233^\013\007Xd\270.,j\266\373\335\225\234\343\214\\\004\204?\232\302\374/\250;\354\321P\233\f\353\020Jk\206u\310eT\243\\i7Q\272\213\326\357\377\353Jmf\235Qv\276K\212I@\352\237XQy\tTi\264\315ZM[\247Q\035i\346\2678\211\374'\250"
+	.string	"\306\260m\275\341S\326\246\336\226a\362\311J\002d\365?r\f`1|\336X\f\035\2063gV\233\303\017\245\202D#\211\234\027\203\377M\215D\341:\017\264\r\t\n"
+	.string	"2\241\241/p+\n\036\026\317a\002\n\230\342\022\350"
+	.ascii	"TFi\266\261\353\336"
+	.text
+	.section	.gnu.lto_applyBetaflightRates.88.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\335\006u&"
+	.string	"zD\364\016J\220\330Q:\245\340$\3531\301p\033\315pS\335.h\354`#\261't\342\252\f\034\312:\007\231\330\022o\266o\037\030\245j$pV?\202Ap\005"
+	.string	"$\0016\t\266\364\036\236\303\301\367&\233\217\267E\374O\b!\204\310\235d\334"
+	.string	"\305"
+	.string	"\333"
+	.ascii	"Q\036R\025\314\263/\341_\361\214\t\213\242&\032\032\322\233\366"
+	.ascii	"Jn\305\263*.\342\206\264[\004\003GT\206$\\L_\030\345\254_:\220"
+	.ascii	"\367\336\0067\231BO\261(i\267H\250\364\300\022\271\030e\213\361"
+	.ascii	"\336\353\303\nn\217\304\005\253\3672e\031\357\035\3720Oz\223"
+	.ascii	"\231\371End\210\271X\022\235\240\376%\203H\211\230{\257\016\367"
+	.ascii	"\332y\263<\316y\263}|\3503\231\232\242\247Y\266\035\342\243\024"
+	.ascii	"rS\\TZ\256\216^|\266\303\204\204\3432\031\f/\"\2451LHJWo\244"
+	.ascii	"%\203\245\256\032\277b\224T\326\254\360"
+	.string	"\350r\343w\244\214\224,z\305\b\007\221=m\334\\a\330\262\306\273\346hX\342\356\275\267\272-:\022Z\213R\270\367\262\215q\204t\23693\037\231y\210\371\274\001C+\206\341Pz>N\367^\t\314#\316U\"\275\367B\330ja\242\307\t*\305y\323\266\317\323\361\307k\245\340C\261\357g\037\343w\336|\253LVD\222\2026\311L\024\332nb~y\273\007s\317\261\316\b\254\345\034\317\016\356\300\247~\003gr\276\235\370\0278\222\237\300\223\234u^u\266\235x\026`-\347X\3135k9\200\265\214\203Z\006pZ\276\261\226i\326\262\215\265\\c-\323\240\226gN\3133kYf-\253\326rj-\243\326\362i-\233\326r\211Z\356\323\2625-?\201\254\313\312\002/\367\322H\222\271U\314c\220c\375L\376$\177\325K\346\363\233\334\310<c\025/\362\017\330\2757\013\213\305SEQ~\363\325s"
+	.string	"\266{\226\233\236!=!Bk\036[\013hZ\177\351)\271J\tO\\\333\364N[%\353\222\320&\301\234\204\251\222\326\264M\367\326-q]c&=yY\243\204f7\361\257\256Fi\315\350\003\315\245-\320\002\272\210\231\227\320l5\276PQ\031Z1\232\306\365\275V\251\231\246i4lE\316z\246O4\026\264I\257^\004\336\273~\300f}\253\373\\\301\032s,e\235\366\201\266_\353\222\332\262\276m\255R\\\274U\373Vf\215\2725\332i\017\b+\320g\243]b\235m\3632\320\006\332\354s=Y\255R\302\342yp\231\"^\236\220L\202\031\336\033\314\225}k\033\266J\tm\222\273\313\266\205\255H\333\335\277\272I\306)I4f\357\275/\272w\332\006A\265%L\342'\210\204\320\316\247\003\372\371|?\336"
+	.ascii	"\340O\210\267\023\001\354\241H\301\341\207bE\317\344\001\317"
+	.ascii	"\236\320nC\357\304\b\240\235\032\004\242\002\215\210\020@;\237"
+	.ascii	"\357g\201\007\224\005\225X\261+\231\367\303\003\352x\"t@%v>\035"
+	.ascii	"\017\030\244\373\301\341\037\212\036P'\364\373\001u3b\360\335"
+	.ascii	"\203\237u\025j\013\210\254\247Oh\215\235<\255\243\223\"\267\214"
+	.ascii	"c\220\301\026\316\272\211?p\2519\375AHz\343\325\035S\214\276"
+	.ascii	"\004As\b\232\247{\272\303\017(9\004=\307'TZ\252\244\310\272\211"
+	.ascii	"\237\034\031\342\244v\017f\266\271Z\337lp\241"
+	.string	"\352\032Z\261;\211!\215i7U\325\334x\233d\243J\016.Xj9m\206\005\350Z\037\247\003\364\0014N\353\204Y\221A\233\344\233\006\320\317\372\205\343\217\"\321X\020\335\241E\305\334\351\023ZHJ\\\333:\177\250a,\005\021B\206\231\022\031\221\2440\205t\240\002\03112\036\021@)e\210\210\266\244(\351\032\333H*dK\n\313[\037\274\256\340\263\336%!\247\337\346.\225\026\346\016\333Y\256,\\\353\004\217\033\207\306$\256pJ\230\032\321\337f\241\036\225{f|,\302\006Y\212C\371\202\240+\241\356~\222.Y\270\213la\262\031\256\301\210\264\275H\342B\341\347\252\360\264\006\375\211\320B\321\266\027\322k\276\360\346\207]q<\2746-\023\313\002A\334`qP\374S<\362\326\0075\016\341\340\315'\036@\b\260\004-\206y\273\021\3630\n3-x&N/XK,C[PP\307\0047|^"
+	.ascii	"\257\234\3366\203\205f\276\371\013\027\202\313x\265Pk]\232\\"
+	.ascii	"\220dT\256\331O\277\361Cm T<*f;@\"\373\365\340i\007\315\236\317"
+	.ascii	"\007\037\276\303\001\334\242yJSx)\315%\243\203\233\n/\224p\b"
+	.ascii	"\373\002\224\214-PN\334\026\033*"
+	.text
+	.section	.gnu.lto_applyRaceFlightRates.89.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\357\002\225\024"
+	.string	"\246\346\205F\340\322h8\242C\201c\357\251\275\033\241\260\303\357\355'\001\255f\261U\243f\367\r\215\342\224\236j\"\026\216\266\257\235\222\207\306bs\206\241\021\244\303\354\254\336\207^\267\322\003\227\257[\345\323\322\205\031I\333{K\231Ro"
+	.string	"b"
+	.string	"z"
+	.ascii	"\367ye\233\310?\224\315\207\030\217\351E\323\356\252\\t\213\016"
+	.ascii	"m\b_\273s\023\"A\366\374\273\321\003iwW|\340y\241\016N\355\222"
+	.ascii	"\240\201\264\213\263b\002\250\213\266\375\026wQc\377\302\236"
+	.string	"\317\317\231\202r|Avw6\340\260\361bx\223\361\242\242x\315\263\306\277\357a\320\217\221\016\217\315\363\324\262\273N\035\236\236[o\333\200m\t\266\316\004\343\305\253kHI\b\210]\006\355\236M\352\t\373\341\356\256\325\204-\373\320\217r\242\373\344\275;\366\336\017\273\320\017 \323%\231&\311\364+\323.1\335\3124+\323#cz%\246U\231Ne\032\225\351S\246\307L\213\231\016\307\264\212\351\f\323\017\260\352\331\241\362\333\365\020\034\262K\"P\305\211~\273\306\001\300\333\211x\330^\243\201J\021\364\344\020\002\334\2454\246\351CiJ\365\210'\242\204\217\241\336\203`\360\307IQz\036\320\250\241\236\200n~w\342\354\356\n\210:j\n\020\336\n\230\302TT\001G<\240\233\fZ5T\231\022\257)U\3659Ev\031\244\360\031\267\027\371\354.\003\373\3452.\240vWA\f\0168\007>?4\343\305\324\027\245"
+	.ascii	"\336\3500h\374\037\347b\362:1\001\266\031\332\004\033\206\033"
+	.ascii	"\f-%S\001\002\313\305\002\f\r\207\313E\250\351T2/\032h\241k,"
+	.ascii	"5\335\254\3462\203y\241\341f5\235\314\214\305\304\271\f6\335"
+	.ascii	"l&\227\323\315V\275\275-\323\326\016\317\322No|\242%*\323\023"
+	.ascii	"!\321\022\r}/%\321\024\024u\351KG_K]:&\361\232l\334\216\243\366"
+	.ascii	"\244'\265tA\217\016\026\300\335\b\024KO\364J1\035Q\226~\245#"
+	.ascii	"*\363\251t\0255 \240\002\231\262\352\006a/\024\026\3710>\nn\330"
+	.ascii	"pC\367\005]$\303\321\222\223\r~\007\357\t3\330W$\334\312Jl\034"
+	.ascii	"\245a8\232av\256\326\304\003\276\312\224\345rd\356\b\264\230"
+	.ascii	"\210\320\235\201\021\024\310/X\265\253\330\025\366v~n\013Y=\324"
+	.ascii	"2\302\325\225\023%BB\340\036\200\267\021\253\017\347 \022:\207"
+	.ascii	"Xa\317\260\202\b\326x\034\300\200\302/\217\251]d"
+	.text
+	.section	.gnu.lto_applyKissRates.90.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\337\005\265!"
+	.string	"\226;\322K\220TR:\f\007\2063\322\251\300\007u\362\351\033# \020\361E\334\031\331\345\363\303\223|\023\361\021\233o\266%\343\036e\375uh\213J\327\027\023\023\210\231\321,B\220d\"\230\241\340\212*ef\026\211H\277\276o\204\020B\266\224)\300"
+	.string	"\240"
+	.string	"\306"
+	.ascii	"\270-\241#\250/f\005\255'q\212*\027\251(I\025\001\353\3115D\322"
+	.ascii	"\316x6\306\274\367\026`\364;\326J\350T\271H\304\021\b\032\371"
+	.ascii	"\344\030Y\330\275\367\300\007p3\r\020\277\335\253b+\354\336\342"
+	.ascii	"\201\007X\031\375\177\226\3013\206\376\344\211\214\222\3423\033"
+	.ascii	"FYJ\356\275<\034~I\031=\271%e\324\262\340!^\325\024=m\017\235"
+	.ascii	"\325\035.\316\261*r\265\354:\206\340uE\205\022\023\253F\234\032"
+	.ascii	"\301\030@U\022S\243\022\246\320d\030u\035M\360\251;\026O\234"
+	.ascii	"{/\356X\324\366$\340DVBw$\236/f+\324\330\213\033\351X\324\255"
+	.ascii	"\356\334{\337GG%\376\215\3773\375'\372\321\030\001D\224\034\306"
+	.ascii	"7\202\316R\007\006\233\217\202)\243ls\312!lLD\335\374\221\304"
+	.ascii	"\266P?\237\327>\375\335\277a,\276\r#\231kX\213O\323\375\031\266"
+	.ascii	"b\226\341-~\f\323`\206\351\376\256\373/\335w\351~\213\332gI\373"
+	.ascii	"+\335W\351~J\367u\335\317u\037\245\373\270\356\237t\377\326\375"
+	.ascii	"\265\373\252\332O\323>\332\375S\355\333\264"
+	.string	"\337h\237qp0\314\f,\357%\321\\r\313Pe\013\306b\326b\336b\3733\030zD\215m\260\327\217{\007\356\372M\271T\322\341\3071\332\377\3209\213k0\327\003bD\224)6gU\254\314\227\321IgS\354\314Z\214\316\322\3700R\305X\024\233\2630k(6eRck,\316\262\213\251\03234\226\2718\247jy\265\324\342AD-\024G\2651\303\316\344\377\316\271\331\232\245\264+\262b\267\365\2155\263\024\326Bi\351\230\226\312\232\256\204\374(v\333o\366I\356\023{\0261R\021W{\263,cU\273ZN\255ja\326P\233\356\370\261\232\217\307\370,\n\265\013\224\226l\312$\257H\263B\3367h6\221\024\357%\3129m\214\355/c\025\261\233\267\366\2640gFf[k\331\250\311\017\201u\374\030\240\335{\025\374\0308\207\317z\357M\200\343\203\206\004hRA)\243m\031\004\317\2403\314"
+	.string	"\324\003\362~\202@`\320'\323\363\343 \fz\340\023\256\303\037Po\302oHAhC\312\204\341\320G\203nh\301A\256\347\302O\017\b\f>\360\tO\206>\036z\347}:>!\317\327\303\373\361\351\001y>\341\220\247\323\362\340\206\237\220\007\024\f\ny8$\021\237\327>\235GL\335Y\236\027\351\016,)\t\t\364If+{\272\271Y\231=\250\330\230D\226\270\252\366\351g\323R\332\325\217\324B\235G\354<\261</\330\213o(z8\365\214E\372\337\004\322T&\200\301\332v/vg\233\211\261\312\306\322\330\027\313M\246\222\306*\"Q\304\2112#.\326\306\262\217\026\253b]Xl\213\265\311Z\261,A~-\326c\263\006[\261\035o\250q4\303\024bH\321\214\210\302&\205J\007\220\002\221\271\252\016\021@\251uhJ\242\242ja\r\272\271\305x\225\0012|\177;\250\320\262\005;"
+	.ascii	"x\037\300\337\330;(\307\335\347vyWj\251tw\375\366\\\025\243\222"
+	.ascii	"\200\202\336\t\bz\260(7\033\226\275\217\241E#G\360-\033(\314"
+	.ascii	"H\330\352\315\313\316\303'\343H\032\202\251j\036\330}~a\016_"
+	.ascii	"\300\217A\024\254}\204\342K\213\215\254\222/\202\313\2315`\206"
+	.ascii	"?\324\355\227\t\340\234\b\3548\357\220\037\302_\365_\301\004"
+	.ascii	"\020\371\0210\307\333\301C\364\245\321\023\351,w-\2470,Q\035"
+	.ascii	"\244^\324\361E\240?\374\223\245j<\b\242^n\264R\261\"\202G\201"
+	.ascii	"\251Hr\247\310\256=\360;n[xh \203\034\t\330\215\2257\025\201"
+	.ascii	"\270\312\330\275\237\372\205|\350\345\262\227\274?"
+	.text
+	.section	.gnu.lto_applyActualRates.91.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\311\003\005\032"
+	.string	"\3260\251I\260\226Q:\264\303\250\362Sv\027F\324\270\251\260L~\t\226\3478\003x\244\013\305;\345?y\273\032\311\f7&\315\277t}\322\017\263\035\306)\360\364\347\344\365\257BI\317\004)g\374\250m\270\233\r\374\321\366\t!R\246\024\226"
+	.string	"~"
+	.string	"\233"
+	.string	"9\244\034\3744\232j\004I\270\204\247\365\361v\220\337\364\247G\371\005\345`)DbE\301\t("
+	.ascii	"Ql\026\211P\222\004\201\t\250%dB\346\347\202\211\325\234\323"
+	.ascii	"\300G7\330% 16\213|$\016(\320A Dx\3149s\\\340\372\033!\354\232"
+	.ascii	"s\005\016\036s\022\345X@\353\243m\277\306m\004\331A\021\b"
+	.string	"\343\350B\"#\232\242\3149i\001\036C~\024/#?\356\213\007]\203\374G]\234\2014\374\235\020\272\262\032\3149\255\277\023F\367\3366\001\333\027l\021A\017z\360\217\274\343\240\377q ?~_KOh\240\030\322\241\r\024\322ua_\234\333\302>\323\215\243\352\233K\3356w\272kh\276\364\317\016\374g\016u\313\374\306\037\243j\231\252aT\375\242\352\030\251\206\215j\027U\267\220j\226Q\375\022\325+\252v\251\272\245j\226\252IU\217\252\026I\365\216j\025\325\007\360\2622\2223\234\263\304p\312\254\032\247d\\\352g\372\235~\250\213\366\355\343\360\003*Z-[\263\252\203e[vv\365Z\226!>\177Bb\341B0\344\030\274\366OI\202\254,\354\310\225\024\024\263u-Mk\311u-KX\246\230Y\326\266v\246\243Tr\360\312\332\331U\231$\263\343\222K\na:\336?\310\231\265m7\375o\\"
+	.string	"E>\252D\254\220\035<\013%K\300i\006\303\341\023\2429\207\006\210+\263\247*\225|:\364\256\270,\252\322Jw\367#\252\f\351p\302}\370\354$\260q\237\312\320\232s\356\364"
+	.string	"\221\323\2011\347\374\221\007\362\243\356N\214\251\357\b<\026\264g\267\341\303m\004\352\341:\340z\270\037\335M\002\357\326\323\335l/\267^-\302M\203\217\256\346\372\341q\320\322sAW\313\345v\017l\274\225\037\334\207\232h\233\216\215G\263\365\320t\270Z\216f\343\375\320td\336m\270\361h\275\335\216G{\001\347\305\271-p\326\245\250H\325\320\372,[\230\305Iq\2634+\333\231\260T\232Y\230}\324\307$\244&\245\222\317\266\016\260\331\233]@UB\251\331\227\265Y\003Te\222/\266/{\330\306VA\223\313\302\252|\226\251\302\213(\025\227}\216\213N\214\240\320\bC\250Q(\004\215S\004\231###-(h\241\003\240\002\221*\253\007\021\220!fE\232j\337a{\021h\212\324\f\366\324\373\3509Y\374\3447E J\266\0343v\007h\347\374\265\263\r\373g\255-\334\340\325\262\237{"
+	.string	"\264\373o_D\bp\220\300T\004zB\3608\227o\311n\246jpL"
+	.ascii	"G\351i\334~D\361\227\020\224G\216\213\303q\222\272=3[&\204\320"
+	.ascii	"\352LB\343\030\021\214\017\017r\255\3637`\201\300\241\033\220"
+	.ascii	"\335{^\f}\266AL\023\276V&\245\247\001"
+	.text
+	.section	.gnu.lto_applyQuickRates.92.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`4\006\235%"
+	.string	"\252E\034\017H\200\234Q:\357n\264:e\366\267\002\213j\274\242\220T\274!\201\221\345\227mW\206\376Y\227\255qfku\2541\0360\001\206\364\347[\206\221\250\356\035\030\221fj\237\005\246\003`mb\b\234\374\325n|k\204\020\271\223\f\342"
+	.string	"\304"
+	.string	"\336"
+	.ascii	"\354\304\307:\225[\371\225+\337\305\267e\n_Qw\217Ou\252\356M"
+	.ascii	"2a\371\226\323\271R\324\356\262\026\365dFvoR\251v"
+	.string	"Tg\277K\265\232\236\316DTi\202\232j\222q\310b\245\357\250\273Q.`Ti\230\302\312Z\013\032\274\325\f\024\331\275\267\301Q\246\320Q\232N\335\2152\306x`\223\254\354\002\266\274\367:\340\005\267\177\302\202m\367\n\261\262\274\367\350\200\207jG\231\231\337\344N\234\230\225g\222\312\310\307\312\\`\311\271\367\376|\007J\217\236\337\245G\233\310\235\216\236m\235\370\357:\221\224,)f\264\220-\216n8r\006J\034-$\216\2379\344\361\364\335{o\310'\333'\003\037`n\344\220\306\023Hl\210\232k\271\215B>YK\243p\357e\013\205\254qN\317\314*3\357`N\213\002I%\354\241J\244G\337\2701gKt\024m\2239i\264=\305\374\363\266\024\363\223\277\202O9'\260\226\021<\353L\364(\377\320\253\234\017\\\353\354;\327\331\200\315r\201{\235\205\276<\007\375\311O\300Z\026`-\367\254\345"
+	.ascii	"\3262\317Z\006\262\226\001X\313;k\371\307Z\366\261\226u\326r"
+	.ascii	"\217\265\234\263\226q\3262\217\265|\263Y\336\241Y\266Y\3135\233"
+	.ascii	"e\232\315rJ\263\214Z\313g\315r\323,\333\324\362\027\344z\210"
+	.ascii	"\375\304\334;\243Y\347\206\241L$\367\372\247\374Y\177\225_\353"
+	.ascii	"\347\372\227\2471\237\371L>\027\276y\361\226\337\032\367/\332"
+	.ascii	"\214\231\255\310r-\3147f:\223m6\260\256\230\230oG-\007@\275k"
+	.ascii	"\242>\330\352\003@\003u\320\326j\005\240\203\336\254U\276\376"
+	.ascii	"\351]\367\326\374t\n6\324C\355\323\317q\245\3245\256\017\360"
+	.ascii	"tO\353\272\267e\3752\332\\\3674m\315Z\205k\236\316\365\327/Z"
+	.ascii	"\343:\0353\320<\375\036H\232+\231\362C\322DI^6j6\335\034\357"
+	.ascii	"-\022\335\332\327vk\2652\366\255{kV2[\357\364\313\250FT\037>"
+	.ascii	"f\353\2361\315%\314\002m\240\337\365\2371\241\246u\201\376\n"
+	.ascii	"'\250i=\001l\347\274%M[\250\203\314\320N\373cT\313\005\342b\226"
+	.ascii	"\n\332\347\3623\013\363l\016\263\370\024iwP\177\2652\332&\333"
+	.ascii	"\356\266c.\316\212\266\231\341aT\2433\367^\t\314\300\203\035"
+	.ascii	"\325\356\275\020\300\254\030\021\201\352\336{#\3046B\303\274"
+	.ascii	"\227\177\021\371F8L\242\210HbI\r\376\224\204\301\240\0208@\005"
+	.ascii	"a\217\226T\016\300a\332a\303\005\025j0mZJ\032\252GJI&l#\222\220"
+	.ascii	"\224\204\0260\370\034\241\0302\001\321\241p\t\250\"\r\217N0\021"
+	.ascii	"o\304\020\025pH\"\224\324`Ph\0018\334!&\251PO\006\026\001\207"
+	.ascii	"? \322O)I\r\376\200C"
+	.string	"\342\257h\307\302\023G\303\337\222P8\374\335\222\305\237\267\245\330\203\327\031\240=(\271\226\333\200|\241\321dc\021t\0243\327.C\006\217\260b\033\245\316\256u\ngN\030O@\237\315vu\223\240{-\240\255\231\202\306u\257\317\344J\314j\205 A'\3012\232\311\3722\242=u\2522\262\345\331R\314l\211x-\224#\215\0240G[f\273\336\210\005\351\2362\273*r\362ZG\216\260\037t\310\2049\3322\346\005\350sk\255\"\352\003\315\353\273\271\342\022h\250a(\206\024B\310\031\233\021)LR(t\200\002\021\252\243n\021`\251UEB\322\202R\213\001\242\027\213A\275\303\017\343\007x2v\255\252P-\020\244\211\031 tAU\200\2704\207*\302\262\271q\351\230\003\271lea\203\331_BCQ\244\355\221V\3106S\321\313P\231xj\005*\226\232\203C\206\245\240\221\r\036c\351\230\323n\003"
+	.string	"\362)"
+	.string	"\215\213\2418D\200\245\021\3365\355Q=\033`\376\233Y8\031\343\013+f\360\215]\315\013\026\226.\313d\274\005\356\312\213\022K\357\222\211\373\330\"\333\220\262\017\220\3466j\250\325\266U\022$\003\345"
+	.ascii	"\324$\265\200\214\272\351\030:\033\210\336#@\0264\301\030\240"
+	.ascii	"k\204\304nA\366Av0#\211u\270\355\340\276\351!\235\013q\200\201"
+	.ascii	"\f.\376S\253e\235S\366\016\374\007"
+	.text
+	.section	.gnu.lto_applyCurve.93.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"U\t"
+	.string	"\026\222@:@\305(\035\340\311\252[\002\374\334\235\3008\340\222\215$\344\215&\254\214\202`\202;\211\355s\201\2276T)pZK\342\030\206\007\366!\003F\327\341q&\030\332'do)S\n/"
+	.string	"1"
+	.string	","
+	.string	"\360\323X]@\212\242\304\265\273\232\346\004\330#|\006{\324\214{O\317\277\310\241\307\207\312\tEzf\013\273\353<\241,n\275m\003\333\t\366cNM\3372\320\021@\241\265[\361\032\260"
+	.string	"\"\n\207m\317\306\330\316\317\255\025\223\203\347YN\361e\367b\343dw\021\\`y\264\355\203<\304\263[\001\276f\2521)\311PSor}\344$\022\376\312\020\243\374i\204=^/\251R\276\354\217\224\212a\037\356\356ZU\331Y\177\374\367\303\314 \356#\332:\r\236\016\203@\350\023\301\201\3366[\247m\036\r\364\3418h[\027\3226\031s\017\235N\023q\\\247a\276=\\Ue\252)\351\204\261L\205\0325\016"
+	.ascii	"2\241\023(0\244/\036\241\247\354\301\326.\243|\365\236\305X\016"
+	.ascii	"j\200\200`XP\241\r@e4\265\363\t"
+	.text
+	.section	.gnu.lto_getRcCurveSlope.94.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`I\001\265\r"
+	.string	"\346YZB \217\232\016 \034\201\005L\016J\"v\223\363\022\374G\234\214\224W)\247\236!*\234\017\304\231\360f\221[* \304T\220\233\211\351\027\002\340\2064*\351"
+	.string	"\263\246X\2170y\265i\335D\2046\2212\245F"
+	.string	"B"
+	.string	"H"
+	.string	"*\226\261\265\253!\005fw\013X@\365h\333Oy\210\316\006\245\357\004\345.0P\0201\263\273\031\347"
+	.string	"\246G\351\033\323\243vx\367\354\374\257|A\314(\024\225\220<)\005\273\353\024\225X\270\365\266\007\3306`\277E\326d\032\223\322W\246\255LWR\232\312\364t\225?\376\3735\323\231\351kl`X \220\261[!\234\261+\"\n\017\266\377r\340\244\345.#g\261\246"
+	.string	"\261\021\033{L\273\2631\333\371\031T\001\022x>\1779\003*1\275F\365\245\032\345xJ\342+\246\367fN\342%\"\370(\376\210\344E\"\323\343\245w9G\313\211\321\005\020\370\r/X\276u\2020\2141a\027\304\241z=\f/C(C\373\013\245r\260/\255\232\330\231\001 \233'D\3538\370\3504\270>\036\t\036\222\265\016\215\313\264\217\f\304\343\361 \323\270O\326\261\341\rB\207\313B\266\215\313\260\017ti\325dR\016HC#vw\223:i"
+	.ascii	"\031\017\204\245\032M\375\312c\314(\364>\204*UJ-\325\312\004"
+	.ascii	"\245\001  \300\"!,\036\242\320\352\022xv\024\f\024\223w\232\243"
+	.ascii	"Yk\031\303p\030\270\313\317\245\2026\"\020EETC\354\\\275\303"
+	.ascii	"=\321@\030\201\201\241\250ua\223b\204\204\261\217\033:,5\b\350"
+	.ascii	"\260@h\003\310\214\246V<\001"
+	.text
+	.section	.gnu.lto_calculateSetpointRate.95.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\325\004%\037"
+	.string	"68\305H\220\330Q:@\262\216\335\230z\342\340q\036\322KI\312\350j_G5?X>\274v)\257\3111\213\217\225U\n\032z\224|R \366\027\374\334\341~\200\304\242\331W\001\020\340H\030\025H\362@m\362\177\022K\b\221;\245\252"
+	.string	"\242"
+	.string	"\270"
+	.ascii	"\237\262m\216q&\206\240C))I\232\246\266\030\266\355e}\224m\266"
+	.ascii	"\215>\236DF\001\204aMdi\232*xi\004\347K\333\257\366\223\\\311"
+	.ascii	"\357P\3562\232\246=\216Q\3224]\340\003\347\313\002\277\231/\311"
+	.ascii	"\357\230/\375\263\303\334\370#\2451\005\03169\223\246)n\231\376"
+	.ascii	";z\322\314\222\334\372\363\037u\224xDt\324@\017\032H?\277\305"
+	.ascii	"\b)\352\006\214\030\025+\r\307M\341\324\260\2266N\326\216l|\311"
+	.ascii	"\004IVj\340\034\311 oZ||\271\325k\321Q\260V\332\2044M]\211G4"
+	.ascii	"\356\332m#\3316a\223O\002"
+	.string	"X\346\313\272\013\200\024\257\216\345\343\231\246\351\003\377\311\241\240\360\233^:HE=Q\205\371\362\213:\201\241\321\002\326\263\017!&}\355.\271\336]f\316\346Hr\222\032\223Q\323\330\306`\335%\373d\272J6Y\335s\343\315s\252\373\266\243s\250?\347U7\016Z}sV\333\220\3256\262\272FV\243\257>i\3254\263\332,\253K\262\232$\253\227\254\256d\365\007\020(\222\224\203I\310\206\031\323\031gj\322\257R\213\310\251\376\252\337\370\265o\237\211\357\344VU\303\260+\t\347K*\030EL^\f.\025{\253k\030B\031\036wgq\266\210g\352\265x\343\013i\213\013\026tm{a\331\271\350n\227\220\214\266\347~\270&\354B\345\0223\206\203ep\320\245\267\241R\2115\371\266r\215i\001\267\234\213\217\203\007\017\346Ks\037u2k\253\f\232z[\234\315Y\227\313\263\005\204Kd?\313\277Z|"
+	.ascii	"\001\302|Yn\271%\346\251x\273\342\343\200\037VB\320\310\204y"
+	.ascii	"*\3366\202\227\360\f\316V\3611\200\330\224S\021A\"\2273_\322"
+	.ascii	"\244\300<\025\201\365\254$wWG\212\316X\344\210sm\355\242Na5\313"
+	.ascii	"L\013\017r\227\366\273\263\333DX%\370(\317\362\321o2\220\261"
+	.ascii	"\034N\341\343K1\224\333\341\204x\273\035O'\240\346+\361s\302"
+	.ascii	"\204Pn\267\343Q\320\365n\200\206r\035\200V\240\020\312\241\276"
+	.ascii	"\240\0279\322:\037]\017\247;\201\023\n\312\355p\272\236\017\347"
+	.ascii	"\263c\036\013\240\036n\210\307\353\341lF\340\311t\225\274\201"
+	.ascii	"\312\027p\203\350\315"
+	.string	"\226\375\236\032\210\221}\314\017\311O\311oI=\361\267\304|yb\031\260\236\231go\366Q\307I\231I\205Qa\001\326\263\237\273\344\020G\314\032\272\303\313\b\354X\332\266\347\374\217i\263.\244\306\374/\007\363C\241B\005\363\245\315\322\202fhz\274\370\b@l\314B\356Q\257PW\3042\032\272<[[Wa\231\240\271K\206a\206\324\ta\250!<\306\020TJ\r\211\244$I2\034\200\002\0311+\017\020`f4I:_\220\300\303\244\221\031^&\b\204\362v\r\264\2318\3419\301\361\246\001A\213$\207\242\b\002\n!\333{J0\037\236\rPe\335\231\204&Z|\337\356-\210\331\346!\317\177\"\007\324\271U\352k\226\235B\252\201=\022\024H\0205\336\246\177\203\267\204\355%\236X\363vv\227\016\256\222\261\204\016\271\206\261)z\177\355\302TN06\261\356\004\021\277'\250]\276!2\263P\335k"
+	.ascii	"\377\371\224\242ud\3651c\277\361\fr{\026\240.Z\200P\306\327\032"
+	.ascii	"9\203>\361u\003S\207sk#\230\216j\344\007\233\222\t\001\275|\374"
+	.ascii	"\023\352l.\375\364Qce5"
+	.text
+	.section	.gnu.lto_processRcInterpolation.96.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`5\f\265="
+	.string	"\372h\374\026CP\236N\007S\341\271\341\204\264\301\035\300\240\336y\245\353\216>\231~Z\036\210\231\320B\345\211\304\3756 \244\n\246\204g\215"
+	.ascii	"4\f!\302\227\213<\304\215\004\231\254\252\252\252*Z/5\262\367"
+	.ascii	"\336;\311\224\002^\001E\001_\001m\356gs;\006\"/i\266\242q\254"
+	.ascii	"c\352'\026\\\377\344\234\317\275\316=\317\327\254\346\317l\267"
+	.ascii	"w{\225\366\2766\266[\361=\032\316\327Rw\314\314\335\222\005\256"
+	.ascii	"0\216\343-\327\327(\325\273i\264\333\271^\033\333\357\034\217"
+	.ascii	"\206\347\315pc/.\363\312\241\001\327\327 7b}\315N\304\372\352"
+	.ascii	"u\260\033\317\265W\330\246\205q\234g\345k\003p}\355>\220\200"
+	.ascii	"F\303\236\327\246\243\310\344\303\344\343\023\307y\311gC\352"
+	.ascii	"\325\325<\357\343\303\336\304\264\244\224\204tdT\344D4$\024\004"
+	.ascii	"\204<\276\306\"\321m\331U\375\f\267K\361\333\323<\033\363\246"
+	.ascii	":g\252\243\222\227\362\024W\202z\322\024\275\270\214$\347GK\334"
+	.ascii	"h\211\222\\\344J9wR\227\240"
+	.string	"\352\224]&\032\202s!8\267\034\324\346@j\00153;|\320\254M5J\203d\216\353\021\311H\265(\365\213\372\240\231\232\232\340\215\216\211\367\001\311\307\226+\t\332\020\177\245\216\240\tq\243\220 \271\330r\365y\025\034\223#hC\234Hg\366#\273oRtf\316\334\262\027\266\254-\227:\005\313\236\346\231\017Wk\024\317\312X\2437)\334\362\177\320L\212\032\025\307\261\353y\276qF\226s\313\025\307q\347\346\031\232\367\223w\347\006\335M\241\273\350\026\255\376\372\177\206y\250\354\016^\206\214\372\256\347Vk\270@\357\276xs\255\355\033\237\301\376?\370?\263T#s\251\207\231\321\036\327\036>|`}\375?\256\365\031:\225y\332\336\305\207\234\202c\371\217\226\220!f\324\177\376\265\203iB\365\312\230\317\3158\216\266{iB7\273\023\353+\216\2718\216\253\334\257\273\t\325.\3168\036s\265&\354\334\214m"
+	.ascii	"\231\213\213\304U\357\237\017\301\262|\350f\200d\322\376\237"
+	.ascii	"\035\202\365'a%NY\356\323\335 \\K\b7\216\313\024\264c\361,\""
+	.ascii	"\332\343|\355\021]\331\233\276\266w\375\352d\317\360N\231\247"
+	.ascii	"\335yd\371\237\335\236\215\270\321\261\365\257u[\220\260\365"
+	.ascii	"\300\201\363yk%\275\316;\313\363\274\261\212\271\257\330\334"
+	.ascii	"Vo\356\002o\356\25277\001cn*c\356\001\306\334S\306\334\002\330"
+	.ascii	"\334\001\212\271\001\024sK!sG!sC\025s?\025s;\035s7\275\271\231"
+	.ascii	"\214\271\227\332\334Jm\356\244bn\244c\356\2437"
+	.string	"\267\021\233\273\350\315M\364\346\036zs\013\275\271\203\336\334@\306\334Hc\356\2431\367\313\3466\026s\027\211\271\211\304\334.1w\353\346f\333\334+\233[\r\177\230\207U\331\350\273a9\230\t\353\315\243\217*\373\261\356ch\364\356\347\3573\217\024\310a\266\bNY\356\243\247\tlWD\205\307\214\241\023\371\317>\366y%\374\032\207h\345Z\177c\365\226\262Z\237\t\307\030\336\3319^\271\326Kx\017\324\202&\277D\177\247\243Po\354\300X\375\232v\206^\350\211\236\351\314\262L\361\207\236\211\316\2620\350\201^\350\333?\3139\262\302:2`h\320;\240\333\2372Oa5\247\323Q7\216\343\005\355r|\016\374\004\216\002C\241\254\257@\177\004\fc\370\327e\350v$1\376\323\312\221\357tW~|\344;\323\251\365\357\037\337\227\207dy\332\306\177\337\231\207\3127\016\007\206\251\300v\260\035\353\253\361\275\317\247"
+	.string	"\3038Y\323\346W,~;\033o\003\343\271\200"
+	.ascii	"\241i\207\370\305W\3630\017\335o\237\370\276\2342\350j\"L\250"
+	.ascii	"P\201\365\325}\242\023\353\333w3Z\242\314C\001<z<\2113X\254g"
+	.ascii	"\360D\342\215\345-n\213\373\317\366<i\201\354\326{\332ru\360"
+	.ascii	"N\347,P}\360X\177#\214e_\314\317x`\330\205\f\031X_\331\177@@"
+	.ascii	"h\217V)wk\330\220\275\271\365O\177T\004\311~\254\235\213\277"
+	.ascii	"\177O\004\331\177\212\361\365\035\274/\351\310\3624)\276\300"
+	.ascii	"\300\272Nx\265_-\2728\234`\361%f\342\213C\f\261c\212/0\260\256"
+	.ascii	"\023\021J|\265\350*\261\302\005\262\275\262\274\304\222^&\222"
+	.ascii	"`(\272T$\275\304X$\263\210:l\305\227X\262EX\230X\322\230\247"
+	.ascii	"\364_K>2\315NP\371dMW9In\203\361\036\264\261\265t\355\352\r\224"
+	.ascii	"\021\372\240\234\222'\323?{\252G)\253y\253Hy\210'\377\206\325"
+	.ascii	"\277\310G\254\276-#\204:\337\226|\213\037>&J9\207\027!\256\315"
+	.ascii	"\341\203G\231\247I\377l\004\315#\013O\004\342\324\017E\215\343"
+	.ascii	"8F\372\247\303l\326[xv\216K\364(HG\241\3322\020\277\343\342\246"
+	.ascii	"\300;;:\240-\373\250z\002_\340Y:K52\036\035u\363\216\252w>\267"
+	.ascii	"?\245\223\214\226\317\b<q\217\215K\335\262\354"
+	.string	"\031Q\rx\252\251\027\360\003\262~*\300\013\310:\002\374\n\310\006\352\37470i6\212\274\245qs\3708\375Z\303x,\200\027\263\022\210\003\300\023\327\254!\222\372f\324K\375t\352^,\324G\275/\325\236\036\212Mf>=\0210\020\352\234\203W\245p\310\t+\327\310eM\357\304\364M\357\313\300\245gz%\351\262P\351\227\336\251\330\244W\312cI\357n\334\234B\276\307\213\376\352)'\b\351\2470\236\357\275\371\343\2070\233\033\f\007w\364H\237\024\200\371\250\201$\006\225C\250fD$I\222Bk\240\002\221)\242\252\003\0210\255c\216\021M\222v\003Bhw\004\377\005Y\003r\320\243bnnCi\355\320\307|\r\254B#\311<\005Z\352\362\tA\001d\262\t\202q\365\364\037\002Hl\344\311\317\325\027h\310i\006bK^\236\271\340\034\247L\204\221\237=\005J\314\366\233\nF\301\003N\210\364\224"
+	.string	"\022&\340W\356\350\265w\202\021\225p\037\024\365\3440Mn\222\240\350\367\204\256\233i\221K4\241\337 \253B\202\333\305\345\243\013QIT\303\r\226\370\374\221\217\337\t>\362c\326\210\2603\231\350@"
+	.string	"f\n[\002\037{\343\2719m0{+\016\004DC\027\320\035\370\220\353(\302\330fR\266'\212Y\213\330p\364|O\036\224\264\200\373\244}\247M\006\233\177t\244a[0\223'\025I\316<\216d\273B\260} \241\351u\305%\266\225\035Z\263\306PB"
+	.string	"\325QZ\227j\322T\233{\036"
+	.ascii	"\357@\320c6\304(\rE\226\242\226\243\235\004h\305\032(\320\016"
+	.ascii	"l\324\001hyq\320z\023\030\006\225\233\263\205\273~\274\360\217"
+	.ascii	"z2_\364\316o\205~\313\201\341\321\360\022\274F\327\016\327\004"
+	.ascii	";\231u\013\0312\326\t\326\235\326\344\225\273\243|\023\261\346"
+	.ascii	"\351N-+\217$\001\210\200\253(3\340\rh\021\223\274\251\241\017"
+	.ascii	"\017\210\271\025 \206 \305\265r\243\363\034\0075 \206y5\313\342"
+	.ascii	"d\217 {\\Wa\332\321\0332\254\202s.B\203<s\365\232\022EH*\225"
+	.ascii	"\300K{\036m\003\207f\362\274G\007=\341\330tI\254x#\211\275#\332"
+	.ascii	"\266|\235\371\3161\b\213S\021\003\253_\267\243\200\323\344!\221"
+	.ascii	"c\252d\351\255\241\260\216R\255#X\246\333k\3501\256\212\356\363"
+	.ascii	"\341\366\246\002T8\271a\036ghD\345\3613j"
+	.text
+	.section	.gnu.lto_updateRcRefreshRate.97.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\350\002]\026"
+	.string	"f\252\223G\300\030Q:%;LP\004\276-s_\023j\215\002\3652Hx\276\345-"
+	.string	"\363\267\230\302\345g\013\331~\025U\022\310\252eB\326\016b\332\327!~\034E\201\037E1\0348\016\r\030\003J\fo\345\307F\310&r\247\024}"
+	.string	"u"
+	.string	"\202"
+	.ascii	"\337\361\234C\034\r\f-\300\322\\@\341\331\035\341\340F3\272\031"
+	.ascii	"1\372\341\"\n\321\356.\370t\203\321\245\375\034\357\261\271\216"
+	.ascii	"\032\267\354\262\b\002\262{c\340\003\243O\230\013\370>"
+	.string	"\275\237\276O\333\330P~k\261\007r\002\202\207\225\335M\351\316m>=\2256>\b\241\245f\273\3714q\317Ch\243I\005`\233y0\273\373\334e\b\033MJ\020\302\356Z\326l$\356\357\266-\330\256\261u\006X\\\222\367y\2565\252\331\031\\\3625\222&\030\"4D\323\033\3736\223\252c\337\333\335\265\346\330\240\364\313'\355\002J\233>\351\322u\374!\t\224\006A\351\357\267{\216\244\275OZAi\371I\377t\302rD\202\320\256\210]\321\016M!1~\373q\237R\355\007\315(\262\261\273>\016\304\241D\221\025\016\366y\374\307\016\335\341>\006}t6>\355\016v\370\251\001j\371\241\312\314\t\317M\344\233\n\352\177\356\341\200q\273Q\343gJ\250D^\354<\301\351I!\223\273Y\322\027\325PKz\240!\252`\211\242+VOulR\251G\222\023:\356R\237;\202\332\316\020N\017\n\0275\351"
+	.string	"* t2\271\3635T\027}\320=\032J\210d\234\370\341\231\311\235} \017R\343\303\360\006Q\276\366\351\213\337\347\325@\023\0242\271\273\334\335\0335\315G\322\001;IrMh2f\241`\254\230\312U\300,\224\350j\305R3/\227\353\265\""
+	.ascii	"\213\0211D\020]\252Q\206\004\213\021c\252\t,\2308\312\210\243"
+	.ascii	"\t\026#\272Z\025b3\3428nX\231\274B\255\306\324J&5\323R\271R\253"
+	.ascii	"\021\226B\235\374\322 \216\251\330\3535\246\302\233\354\232\343"
+	.ascii	"+Y\201\343\275\250\324Q\241S\222N\rA!\313\220Lg\246\361vY<8\356"
+	.ascii	"'\302\311\235=\365\213\334\310\005\325jU\223\362\251\247 G7["
+	.ascii	"\322C\0072\001\365\0136 \240\002\231*\353\006-_\021\177\213\344"
+	.ascii	"\001\327q\230u\302\t\210\311:f\255b\216y\333\020\r\333\3544\326"
+	.ascii	"X0\303,\2264[P\261\347\357\336g\033h\374\231\3010l\002\2734\215"
+	.ascii	"\314\033w\207\325\340Y\274U\200v\373\210\261\252kY\335y\n\005"
+	.ascii	",0\245\240\3472\001;\304iP\305z\022\2367\024\333+\360\300\260"
+	.ascii	"K)\300\325\323\341F\212\341}q%)jMo\202)\003"
+	.text
+	.section	.gnu.lto_getCurrentRxRefreshRate.98.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375 \354}\006"
+	.string	"bL-3PO\222\016 ;\323Bj\200\017k\311\340[\220"
+	.string	"\nB\224\033j\273\242\265[kh\334|\216\200V\032\231i\304\036Z\241\317\212\360\325\236\254\021K\266L\001K\033\211r\022\203{hPpp\022\025\3416\232'\210\005\312IL\023\3452/\313B\310\n>\214\342[\322W\335\217'8X\253\355r\2426d\001\032\037\274\376y\220q|1\311B?\216\214 \243%\341$\323\342zI\226\246\002\362w>sE:\322\271\302\347q\021\241\\\025&.\231\317\tt j\303j\2426\326\321\252X\335\222\024\023\262\222b\201<E"
+	.string	"\204\314\034-\020Fg\375\017~\203\177#\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.99.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\345\f"
+	.string	"\266\330YC\020\221\232\016\033\002"
+	.string	"Q\310\tYN\337\264\250\004\335mL\007\317\005\347\224\205'"
+	.string	"\356\256\236\033\330o>K\233Hx\321p\001l\004\304\"/$\224\256\225\347x\327\223\342\020\250CUJ\034\243&dK\231RF"
+	.string	"F"
+	.string	"B"
+	.ascii	"3\236m\003\343\211\3571\\X\\\350\330\335\353\300\007P\237\340"
+	.ascii	"C\250Oj\342\336\241\246\347\003"
+	.string	"\370B\207\326\313\025\026\200\251\361\022\340[\201\tpJ\344x\351\331\362\2112+\317\356:G\037\210{\272\355\007\266!\330\267\020?|ZO\372\363\351w\b\320\300\251\360b\327%\207\307\336L2V\330\366\354\017\233\246\303AVt#E\215\203\005\r\274G\017\217\006D\304\231\031\273q\304\f\236'\331\306\235]\0220jvw\304\b\254O\266\375\026\017\366\250\250\bRY\251j\252\235\262\201\372\310\322\227\356\371\240!C\255\264\232T\325\311\322C%sR\305\b\346FU\306\"O\r\201\002G\311\306J\356\260c(U\306>\\\215\261\237\266\236\256\036\377\3514\001\334\326eX\t\b\244\235d\350\266\355#a\353R0\001\n:\024\005Q\320>&\023\264\017\306\225p\210\200A\003\006\342\214$\343\256\354\302ub\202}\256\214\003]$!\336P4\356\352\266\215\273>\342^c\374\322;#X\220R\344VK\257-\032\023"
+	.ascii	"y\b8\323a6\0135\306^\203\320\334\213\370\242\216\343\246\027"
+	.ascii	"\226M\256\341\206\265\200I\023\n\250\003\367\366I!\250\320\n"
+	.ascii	"\24026\3254\rLA\001"
+	.text
+	.section	.gnu.lto_rcSmoothingSetFilterCutoffs.101.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\306\016\245D"
+	.string	"zt\244\031@0\242N\007\213"
+	.string	"\320j\352\031\225K\b>yJ\352L\244\305\0306\266\261\305\025\374\327g\347\334,;\366#\244"
+	.string	"\230"
+	.string	",\036\330\t\365w\016\216\234\027\211\210\210(\202\231\320\222\266\367\336[\312\224\002\210\001i\001\222\001\207-\031(O\370\317\345\377\357\267\373\273\377\027\177+\241_\341\264)\034\030f\r\030,\030\363Q|0\037\350\036\373\214\377\342\314\277A+\363<\3073\334\343o\367wy@\217\275\274\237\374\1774\340\264i\2224/\360\316<\317\013\340o\247\330\276\337\"?\0274x\026\003G\303\204\2713\317}\316o\235"
+	.ascii	"\374-\221~\355\376Y\236O\376j\215o\316\263\222?b\346\271o\313"
+	.ascii	"\253\340o\275\357\221\334o\3417r\277u\331\275\316\367\331\315"
+	.ascii	"?\347K\324\357\317<\317\317\315\304\333g\373\336\213\264\374"
+	.ascii	"PONMLKJIHGFEM\242!!\3462V&\341\327m\331\255e\377\327AR\372\226"
+	.ascii	"\366PO\354\324\232\303\350#N\371X)%t\217\2577\315\242\235\370"
+	.ascii	"\276\211\315\272"
+	.string	"3\246\317\353M\261\260H<\236H\037\360\212f\242\376\222\225Wb\233\020\247V\330\253@(:\351\211Fr\242\217\250M\264\021\253\274\016Z\037q\232\307v\341\351I\021\242\213\226\364\300\373&\321\220\035\235\026z\0350_\007Hz\334\375\262\b\342\224\210\216\345\330)*\304\351\234V\"N\357\364\246Ct\322\372Tz\323\274\035oQ\r\277\032\336\277,\022\3424\216\315\232c\363#\252]\345\033\220o\341\236e\233\346\330\374\020zkc\257\336$\241\363\202lz\013\275A\331\251y\236\037\360\265\333\333\232\326\257\203y\236]K\337z\274G\275\273\316rw\006\356\314\f\001\177\265K\356d\365\335\360\376(\244\230\353\356\227\314\032\2067\024s\367\373\271\253\262\273\335\355\240(\244\206_\303\356\020p\212\324\352\201\275\271\037{\327\371\230\273\367\210.\214l\032\220\273sx4c\360\336m\242\034\357\360f\320\340y\236\275\374\2576"
+	.string	"}\020\260\330\244\206\373m\330\336\211\211\217U\353C\345\354\030\231\335\033DF\252a\233g5+\275\037l=\b\325[\323\221\376[\357\207\336\3711O&\204\177\023\027A\246_J\346~\373;nK\244\306\251\351H\367\2765\275\353\3444f\261\363\255\304\035\326\276\001\326\256\001\326\236\001\326.\306\324~\301B\205\347\362\036\366\325\177\b\377\367\376\340\013\326\256 \326\236"
+	.string	"\326\356\025k\357\202\265#x\265\037\200\265\033`j/\240\324N \326\376\204\265s\301\332\267\224\332\265\230\332\235\260\366\254W;\326\253}\300\253]\200\220\366"
+	.string	"L\355WK\355"
+	.string	"\\\355V\261\366\252V;\325R\373\224\253]*\326\036\325j\207Rj\177Zjwr\2657\271\332\231b\355KK\355J\256\366$W;R\254\375H\251\335(\251\275\b\326\336\204\265\023\301\332\207^\355BO\370\316Tj_\306\332\343X\273\022\326\236\204\265\303J\355oR\273\013ko_\355\354\253}\273\332u\253\37594\025\276\001a\235g\036\221\202\346"
+	.string	"\366\222c\325\266z\253\332_\207\007\325n!\205\304\021ii\250-\265\247\356\344<h\016\263\367[\324n\213ZZ\2708\265\227\f\243\266\224\276\201\026\265\337\221\261\252\241P\373\275\016\242\306\r=i\266\247\035\357\tz4\342F\250i;9\321\263\331\373E\312{\317\006\262\320i/15-m\246@K\273A\033\037\346"
+	.ascii	"\235\264\225\244\310S\364K\035\315\210\377\03730;i\216\367#\357"
+	.ascii	"}\241\335<\317\n\344*\337G\246~+\250\264\337\253\024H\225~\260"
+	.ascii	"\221\266\273\314'k\321/M\332Sm;\315\2176\322\336\216\320;z\320"
+	.ascii	"\2166X\333\236\345\256[|\243\375xR\030\355xo\017\265\n\333\315"
+	.ascii	"\323y\236\261\222\316h9L\323\203\274\2610\016b\274\353\374W\270"
+	.ascii	"E\373\2278\212\025\355db\235\307\352_\357\300xQ6\367#\321z\242"
+	.ascii	"\335\334\037\215\373\332C\233h?\024Rh\017\355\217B6\376\234\261"
+	.ascii	"\007a\372\245a\356\267B\373\255\177\005W\207\032\267\361\312"
+	.ascii	"\370\300\221L\341.\367\316#\341\025S,\233\204\214_\025h\356\020"
+	.ascii	"\206\235\357\254\353|\346v\363\367\276\264\367k\023:\177\336"
+	.ascii	"\260\035\357\021]\032\023\321\342\r\345\311\342\034_\325eY1\n"
+	.ascii	"nyQ\353v~\206\355\346\256\334p\320`\245\227\346\311\260\225\373"
+	.ascii	"\001\337yU\\S\004\204l\237t\273\341\235\334\376\202\023*\270"
+	.ascii	"/\025\333\356N\213\302\353\303\207u~r\277\3407\271\3109\242\007"
+	.ascii	"N\233\013\177\350\327\347b(~\003\tm\302\304Y\f\031a$T\234%\311"
+	.ascii	"b\220E0c\201\342D\214\263\263\0250\230^\306U\366\342Yf\342\311"
+	.ascii	"\002\005\331\212g\331\013\030O.#?kQ\342\3053\306\331\331"
+	.string	"\213g\334\247\366[\211\207\353\241\332^\203\002\323\n\2422\016\266\235\346\t\266\202m\240\0210\ni\2460\372\264\353\334\302N\260mdI\260_3\326G\367\222\307\321\213\323\002m`#\330^:d\036S\320\235\346]\333\213\212\326\265\273\016l\004\373\007\3457]\345\300\3766\214\325\013\333\300`\344\227p\013\354\013\333u4\216\212LW`\203\365\261R\251\374\020\306i\"\260G\350\245 @e\317\035\223\222\206\375\201I\316\337\260\335\334\237;\312\206\375\334Z2\270\224\265\2676\327\366\017\324\360\006\032\032*q\355\017\324N\374\352e\367g\270v\262\252\265\267\336\271\265\266\233\210'\3239\367\017b\304\332Y\333M\324vcX\333\005tp\351\310\304/i\200\017\275d\254n\300~\377\004\251Lj\254R\244]\227\346\005l\0232\234N2\246\221\310zr\020\270\314\375V\300NV5\2356R&\013\221\345\374e9\367\333"
+	.string	"\373\225\003\370\030w\264\353\\\246s\257\366\b\271\210&\"\323i\271\017\356\362\221\032W\373\005\002('\321B\244,\354\007|\253>\177\217wF\273\316\337\372XC\232\025\266\263/s\177m\267\366\375\352~\355\257\363\377l\321\177\355\n\373{\030\272\201\316\255\351H\335\244\332V\033@\035\234\331\377\375\220\367\336\320\3075\201\022\250Q$E\225tJFD$I\222\fsq\005\304\030\346 \264\033\021"
+	.string	"%TN\325\220$)p=\003\343\301:\222\234Y\360?f\256\316F\235\203\232fH\003~\267\304\032h\035\035\346\215\346\205e\334z0\210\227\223(\263\013\357M\360\373\304\330\346\027veS\016\323\301i\370j^\320\204\302\243K\210\342w\302\01662\264\341\360\305\242b\334d\344\351;{\346E\325\t5\033\340y\022\365L*\217\360\255\372\344\274(`z3\357H7\fZ~\361F\001\341\270[\266h\301\314-\016\343B\005\243_-\005\241\036z\246\f\n|b0\312\300su\247\224ad\242{^!ry\306N\264\241&\315\236\255\266\b8\264\224\334\212Pk0\255\370&1\374\"\200\210\246\2033|\240\247\023*\023y\311\213\020?\265B\220\017\205\004\244\030\323\225\n\341\260\373*=U\034O-\"Q\362"
+	.string	""
+	.ascii	"\260\202#\303h\034\215\305\017\n\013(\244\231\034\340\377\314"
+	.ascii	"\002\206\376\027\237u\333XK\345b\324<\256\030\213\266N\322qE"
+	.ascii	"\025\250\017\312=)B\306\347\272\223\252\0026\201\306\303\376"
+	.ascii	"\200\307\224\335\310\335\351\237\333>\370j\013\235Tv#\306\t9"
+	.ascii	"\301Q\007A\371,I\265\021A\327\275\2636\335\235"
+	.string	"\317\332\226\260Jn\341\221\235B\221It!\242&\304\025\323\001\275\377\310d\0040\n\245\r\237\325?p"
+	.ascii	"$q\353\353\211\376\3328Ofj\306\220\366\177\334\020\001\016F\273"
+	.ascii	"\226\324\370\213\242\227\226\240\222?ay\322u\034\001Qm\310\275"
+	.ascii	"\313\247\257\311\222\370u\217\350/O\342i4\267\243\036\363\333"
+	.ascii	"s\235C\rh\024T\34562\033\004\026\031\033\323\321\005\252\025"
+	.ascii	"\341\360\n\355\340\300\355\310\275\362F\315\321\310w\207Re4\r"
+	.ascii	"-\240\350\375g@s\246B5D]N9R\005\003\236\301\363\300 \323Bi\224"
+	.ascii	"\207U-\204\350D\376\017@P\206\030\274\356\2161J\325\243:\230"
+	.ascii	"P\255\177\202(0ZsomO\370\301\334\345\212\305g\327,'\216\255\350"
+	.ascii	"\324"
+	.text
+	.section	.gnu.lto_rcSmoothingResetAccumulation.102.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\235\n"
+	.string	"\366RG@ \345*\035 \027\211$\236p\006,\241\021r\267\027\311\342:\034\323\314\322\226\253%\005\206\302\356R\376\206Y\202\305VZ\311:QF\204\001!\220E(\342\030:\3206"
+	.string	"\206P\321\337H\020\331)\0050"
+	.string	"3"
+	.string	"8"
+	.string	".\017\002\377q\376\001\377\231\264\005\274\224\355\003\3146R\314\335\255^\310\311S\322\177\311;\256\027\353t\263\260\273\246\256W\307\355\335v\310v\265o\021\247]\262\250\007b_\263\273k/f\377\366\323\315s\037&\001\211\001\273\034\347\201\325}1\"\036\333\247\366m'!\177[\275`7f"
+	.string	"f\267L\360\001\347_(\320\026\337\202b\361\230\251\355\020n\247\276b\031\225\316H\316\334\341l\323\220Mq\024\343\fdv\305O.8\273\253`\202\221\001\222\315\376\371+\360\337\210V\203\331\314\026\r$\025\211\001\342T\212P\211\242)E\340P\024\2165|\250\247\022\311T\3031UE\037\213\023\016cU\211\342X=\345^\263^\314\r\005t-O\3036\375\305eD\003"
+	.string	"\263y\347\371\025"
+	.string	"2\241\267/0.\016\270\003\214\253\225\352\254n\202\355Z-R\007v"
+	.ascii	"\276[U\023\302U\027\2331\366\220\236\025\007C.\3016\253)\340"
+	.ascii	"./\332I\006"
+	.text
+	.section	.gnu.lto_rcSmoothingAccumulateSample.103.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\365\005}!"
+	.string	"&>\323I\240\326Q:\305\370\004\247e\026\206Az\306\247\354\226\307\2576\345\247\254\341\224\226\232n\230\036\246\214e\265\253\217?V4:\202\007\353\370[8\036l\001\177\362\026\204\264!\335>\322\2612<\032]\326p\037\3265K\b\221;\245\271"
+	.string	"\261"
+	.string	"\310"
+	.ascii	"8\374\036\226\371;\316\243\351WK\257\300\372zE\305\225V\255\303"
+	.ascii	"\240\233^\020\2739\243\317\361\"\207\343\360R%c\324Ze\034l\331"
+	.ascii	"\315\265\233l\231\355\035\336F\323o\030Y\316\252\257\304\214"
+	.ascii	"\037\265\326\0026\020\273i+)\265ou\032M\0272\355\314\252\217"
+	.ascii	"(\365\243\326a\001\373\304nz\370\332y3v\234\363\246m\037@\320"
+	.ascii	"d\336\207UR2\243\020*GW\255\303\333\2428\357\247Y.\345\371N?"
+	.ascii	"WK\262I\224\253)\252\233\345\200`\222\0204S"
+	.string	"\277\262\266\244D\025\017\264\f\361\245\231z*m\265\326\023O\243\246|\224\302\206j\255\246\300)\0207\354\2663\330\036\262O\005\001H\"\345\236N\214\bw\207\b9p\213\356w\367\277\340\023\375r\200\245[\032\177Z.:\020\037y\252l\243\3778\212\325Z\023\034!\350jU)\230\316\233_\253\027$\2024\204=\372e\017\237\350\236\260_\3265\001\264\324?\367q\373,\265m\251{~u\363\374\306\037\340\302\037\200\251u\226:g\251k1j\332I\215sR\337,\265\315I=;\251k\226\232\346\244\2369\251e\226Zf\352\030\0305\314R\307`\324\260\245>\227\332\\\352\362\244\336\223\232\236\324\017:\222\254.,G_\265J}y\251Yf\020\026\367\361_\335h\353\315\252\357C\217\026\017;\243\331\232\025`\374i\365,\315\b$p\353\311\333\266Gfwg\366\277\026\262\225\331\035\254\237\026\320\312\032t%u"
+	.ascii	"\267\276\276~\026hM\241D|\0050\230e\356\t\323= #\303\210\025"
+	.ascii	"J\273\221g\316F\345\254\271;/j\020\225\370h\227\262\334\023\224"
+	.ascii	"\326Z\235vM\230w\306\254\314\f\"\025\037\355b\273\302\247\360"
+	.ascii	"b?^\212\316\266\300D\017\274\031\2632\"Qd\300,\224'?\013\023"
+	.ascii	"\333\237\375\217\313gc\2707a\342\2637r\021\3026kI\211ma{\342"
+	.ascii	"iF(\257\336\271\266\375O\013\317\236{\373\002\345\225;\326\322"
+	.ascii	"\277$9\027\317\276\307K\030D\236\310\020\232{\304H#\004^\256"
+	.ascii	"\271%\362\027|\"z\021\0078\0134I\002\221"
+	.string	"\316(\002\221\016\267k\320a7\203S\3021(\322`\204A\t\tI\2274\343\234Pnw\313]\270i0\302\351n\271]\322M\b\307H\033\210v7%$\244\335M6\354\275\254k\302g\022K\307\261<\225\237x\007I$:\216\346\317;u6\312\266\316z\250\267O\247\235\273\327\227\007.\234\004\255\270\226\316\027\215{\227%.TIbp\005\375E\023}\213\221Z`^\024\351\342\352\035m\323\237\027]\364,/\332\350[G\265*\027Oy\270\210\021\264\352\252\255-\341ZF\352\320\266\266&\026\224\027\215\342\254=\201\302y mm\276u\362\315\316\026g\377;b\2637k&\205^\256\315\302\202$\217\277`\315\316\004g\250A(\007\221a\204)\031\032\005I\222d8\240\"\221\263\321\003\021\260-\023\020\021\215\244(\205\354\006\303\360\331\216\214\241\320HT\024\347\362|\311\355\271\311\252%qp\315\350\266z\240"
+	.ascii	"o\307\0065'\263#\373\244\207H\335\006\330\354\340:`\205\317\337"
+	.ascii	"\"\216\301v\204[3\n\314\023\321\354\366\313\305\350\330\233\376"
+	.ascii	" 0\246\317[\201\307\231$3q\346\234:\301\006O\0207\t\262\3218"
+	.ascii	"P\273\211\020\215\234n\236\211l\016\310J\\\034E\005\r ~i\017"
+	.ascii	"\031\273:\314\241\264\n\320\016:\332\325?\311\312\274$\352p\377"
+	.ascii	"\3542\271\346b\3004?%\f/p\246\230Z -|\274\377l\225\021T\266p"
+	.ascii	"2x\222\323X42\262*\n\254>\003B\321\221\222\021l\323n\321P\256"
+	.ascii	"\260\205Y\350\335f\277?"
+	.text
+	.section	.gnu.lto_rcSmoothingAutoCalculate.104.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`W\001\335\r"
+	.string	"\226\331[D\020\261$\035|\270\314\3357A\302Zd\262\340\262Z\303\344Q{MUZ\364\376\275\025\033d \370\234\031\331\206u!\031\342\311\030\326\035\317\004\001"
+	.string	"P\020\305g\027\201\t\330\004\326Tuald\357-eJ\001J"
+	.string	"C"
+	.string	"O"
+	.string	")\326\316\225^B\024r&\200\340\331\345,\335p\355\021>M\315\007\260\215\036?\027\016%\344\013m-\217\300\356\2026\226\324g"
+	.string	"&\205\205\320\266\362\006\340hx\361\232\247\313\326\222Yu\354\256\223\264U\270\253\333\026\331.`\277\013?\335\346\201o:\264\311I\236t\350\237\304\303+\315L\007\230\223\215J\246ln\224*c\377\255\306\330NWN\303L\277\227VMg\246\377\371\316\362\354\224\250\330}I\321\330\025\360\004\007\333)6\310\007\020\004Fq\242)A\225\341\3764\304\343#DD\270nB\211\207O7\036\342(\024\337d\020\221(\036\252V,j\314\300\360RO\214\022o$\246~t9\"\357F>\244*\230i\221&d\340dPc\361\372\321\271`\311\036\333$\367\200}v7\201\003\2768\256\314\272B\254\022\021\017\022\353\312L,\016\001\306\034\200d\026\004\f\313,\020\267\177\2531\256t`\240n\362\327b\276\223\370k\276@'\205\272Q_\213\206\225Bu\261\r\325\035*\272\022\003\244\315\240A\236T\251\352(\035"
+	.string	"l\204\006\202\005"
+	.ascii	"\331e\235\326\024\032\004\007C\003\0311\243q2\201\205\006\363"
+	.ascii	"\263\3411&{@\n(\006\f\202\342.Aj\210\252\202o$l!\245Y\337\205"
+	.ascii	"<\3440\3100F\202\267\027\205\320G\030H\315\036\275\266@\001"
+	.text
+	.section	.gnu.lto_processRcSmoothingFilter.105.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`:\037\215\202"
+	.string	"j\313t-K N\323\032\003\333\274\217\270~\231\241>\271#\361\223t\231m\215\032 \205X\243M\364\\\365\2016w\233\336\377/\342\004\205\026\336E\350\251\225cQ"
+	.string	""
+	.ascii	"\240\fu\016\225\373\370\260\332\210\275[;;\203\324\021%\013\262"
+	.ascii	"BHJ)\005\264\002\245\002\313\002"
+	.string	"\374\341\350\354\201\310\271\303\321\231I\351\314!\351\274\224tVJ:'!\235\221\216\316\033\216\316GB\316\031\204\2341\f9\033)\235\213\224\316DI\347\241\244\263\022\351\234\fr\026\002r\016\022r\006B:\377 \235\221A\316G g\037\244\263\021\351\\\374qn\221\316D\244\363\020\351\374\355\326\354G\347\356']W\006u\262\006\366r\340\336\260B=\257\033\342\231\265\316\353.\323]\327-\246\033L\367\\\373\270\321\213\336z\2735\222\271\231\033\217{\r#\363\370\232\344*{\225J\322\330\336\260\214i\360\330GlN\255\3210#\315\244\320wA\332\f#\337\200\031\f\302\214\2643\303D\273\352\ttmed\235\020@\266\347\003\306&\226\341k\277co\0339c#\003\3241F\f_\231\274\340^\261c\\\0218\267A\034\306\246r\313u\225\221s\037\204\255\245\201\321(t\\\b\r\206\255\306-'\006\260;j"
+	.string	"\337\3675al\"S\033\265M\0346Q\333D\356\267\206cF\362\220\246\262\006\352\031\324m\b3\262\211E\346\020\270\247\214l7\327\370^)V\327D"
+	.ascii	"|_8\250&\262\007c\023\231OP\205\300n\303\245\205\035\303\232"
+	.ascii	"L\271\301\367\205\233z4*&\366\020\256\331\350\335VA\225\002\305"
+	.ascii	"\t\023%\246\244HDA=\215\020\341\024\002D\323\007\017\035\230"
+	.ascii	"8,)%!m\320p\224\001\203Q\021\321\320\neR(\b\350\007y\3641\026"
+	.ascii	"[\342\360\335\345.v5)l\212m\265\n;\3236N\365\327)P\2400\201\355"
+	.ascii	"\304\r3\022\302\324i\023~C\246=\347\034/A\247\317\247\352\350"
+	.ascii	"\271\224\3775\t"
+	.string	"lGa\2618\3318\024v\215?\345\365\210<5.\302\251Xe\327\036\350\230\341\322!@X\257t\336d\355\017e\310\270\0074e\306x\207k\0321\316T\254\2122\026\2469\274\365\022\365\315\225\302L=\311\315\221\352\274\370\006k\027\327\220\246\217\270H=\303\232c\030\036\257t\326\336s\2320\244\242\202\205\215\212\033\025\253\244\214Y\351\"\265&R\033S\305\207\232\313J\257\0302Y\363\356\270rJ'\207O\200vx\214\302Lh\3569\323\\(\250X\205\300\230\036@\267l\2241(\r\364\244\177z\317\371\244\253N\034\331\304\217P\022\334g\317\t\245\003\026'\231\033\213\035\332bU\224\261g\023\203\304\276\220bD|8|\202\262I\022$\306\034\032\2751\253\203\024\363\362\307\342\2342dz\337\267\247\355#\210u\271\027\253\336\367eo\212\2155\263h\346a\0243\373`FR\022\377\177_X\206\236\350\221\350\276"
+	.ascii	"\225\317p\232\257\355\320\267t_W\272\224\337\325\236\221dO\225"
+	.ascii	"IH\244\022\247\017\371\363?.\364\361\243\356\354\344\2347\t\222"
+	.ascii	"S\241\367i\223#}\032Ui\002\365\tz\255\2709]\\4\2434\350\213\325"
+	.ascii	"8Y*\020\323\333\334#\276\005\350{\332Sy\370\342\344T\t\215x\026"
+	.ascii	",l4\264\300\201\272\t\026\026\266{\244\005s\023\334#V\324\226"
+	.ascii	"\260\341\"\030\346T\370:%\315g\013\336\240\240\365\203\230G\331"
+	.ascii	"\272\004\307.\022?s\225\0305\321\f\256]\214\026.P\267\301\037"
+	.ascii	"&^\202[F\327\f$s\350\223\237\027\302\203#\245\032}\276\211\213"
+	.ascii	"\266\344$\364\335\013w\232\201IJ\310\326\024\233\311\022l\353"
+	.ascii	"\355\242\265\314n\023G\342\2425\371\030\220\0346\305\262:6\242"
+	.ascii	"\333\"\277\243<\3610\327\350#`\340B1\252Y\265MD\276\017\325\301"
+	.ascii	"\\\004+\267\004\327\3145k\233x|\0374\274\3543\350\213\223\275"
+	.ascii	"\341\267;m\215\2374m\213\363\363\211z\021\027\315\231\355\237"
+	.ascii	"\361}\2468\021\3672\276\t&h\244\305*\316\345[D>+]HX|!\346\265"
+	.ascii	"]k=.\333\013t\315@\342\267\337L\302,\235\035$>\020\336]v\250"
+	.ascii	"\245\361\2640\304\2665\013\201\303G\346\271\223\3763"
+	.string	"\273\322\006t\357\020[h\006\262\353\245\377\334\251\361}\275Tp\323\351:\356\033\0011b\264M\374\027B\263f\251P\315,\243\375\370\332\347\200\333\240^3\033\320q\260\222\322\336\367U\301\r\247\371hp\2535\221k\330\260\3216\261\0017A\250\233`7V\373\206\210W\307E\360\t\315\026\267\377(c\265\375\023\304\315\361r\027\230\033\333m\260\270\325x\003\034\336M\034m\023\3735\270\325\201N\237\\^\310\f\327\345\037\275\252\325\031\344?cn';w\263\305473\351\fB\3475\017\311\340\374A\3275\013\311\340\254\225\325`\232\177\364\\\263\017\f\316;\272L\263\002]\246YG\213i\316\321`\232q\264[\363\r\245\263\r\245s\002F\3165\224\316\b(\235i\0309\037\240t6\340\307y\306\321YF\322\271\200\244s\214\2443\214\2443\001H\347\252\"\347\027I\347\001\212\234]\f9\267P:\013\220t\016"
+	.string	"\351\f"
+	.ascii	"\322\231\305\321yE\221\263\212\"g\252\244s\212\"g\024I\347\023"
+	.ascii	"E\316&\204\234K \235\247\216\316RJg\022J\347(\2453T\322\371\351"
+	.ascii	"\350<\202\310Y\004\221\263\323\3219\004\2213\210\244s\223\220"
+	.ascii	"\007\377\225\346\247\213\223\017\037-\023'K\231\036\022\357\263"
+	.ascii	"5g\026\307\346\241\236\304\273\270~\345uE\275\013>\020\036\352"
+	.ascii	"\033M\373\364\372\0058\344A\370\026r_\203O\337\364C\376\351\372"
+	.ascii	"u\245K\306w\361\365\271\236\276\327t"
+	.string	"\r=O\275,\365H\220\213\207\217\216\370\016\374\267p\304\367\265\241\276\310\rB\247\035>\312!\346\224\324%Eu\321\034\022(\007\250\326\361`B^\004\233=\"\276\241O6R\246\245b_\357h\005h*\t\231\351\035\355\016\247\317\n\371\035\357\364E\276!\207\217\372\020\231\266\245?\013\361A{qs\362`\031\361\204\370\326\355y\225RA,\271\243\264\243\005\361\275\027\347\027\350,\354\310Z\322\321\265M\004\361\315\345y\227}r\361\030+\330$\302\276\326\321j\371\032\021\320\276\260\240\002V\250\260p\360\331:\332\017^\353\373\013\332\365\301\367]CE\261\037\276\351\317\355\270G\254K;\273\266\211\037~\252\223\254\361\202\344\341\033K\n\036\336\373\366\246>e\013\236\r\313k\333\341}\317\373\334oy\305[\252Q\3236\261\303\277\230\322D\244\264i\370h\003\301Aq\036}\224\235\212\264\220V\310\023\267\300\344\211k\243"
+	.ascii	"v\251\347\335\024\362mm#7{ln\2722|\224\t\016\323\260\313\263"
+	.ascii	"\232\305\360Q\366!\241\250\231O\244\262\002\252s<X\216o;qs\374"
+	.ascii	"}\337-\243\250\316\361\315\374!\263\"\325/h\227\027z\021\207"
+	.ascii	"\177\303V\245>7\034,\371~\017/\333x\033\266\262`g\343\330\345"
+	.ascii	"\233\245\nK>\276\266\211\034\276Ox\312I\317\314\271\203\263G"
+	.ascii	"\364Q\250^\372\216\022\325J\277\364\315|\346\370\244W\372\376"
+	.ascii	"\"D\372$5\236\347\312Y\372y7\227~m\023\221\276\307\364\360\314"
+	.ascii	"\023L\366\311u\235\"\006\314\320G\271W\374\331\006\274%\035\034"
+	.ascii	"\033^\303\233\240\362\243{~\305Z\272C\346\3213(H\303\233\352"
+	.ascii	"gl\030\337\227\253\233v\274\274\263\\\301\273\311Az+"
+	.string	"\0045\313\374%\217>\351\355-n\316\321sc\275\016\313\007\216\277\316p\346e\013\313<\336\315\243_\202\242\306M\327o\te 3\246\210m\006f\230\301\205\260\312$L\276'\264\005}\224]\372B\335O\326\367\364\005(\362\307\343x0f\fY\017\343\036iJ\2536\003\215\036\303\027\261LB\030\216\343\231\227{\226\205m7\215~"
+	.ascii	"\275\251\033\257\337\002z\341E].\221\266\233Y\337O\312\274~\253"
+	.ascii	"\354\307\027}\353\331#\247\373\220\224\371\371({\222\016\372"
+	.ascii	"(*\2350\357\373\006\371\370\037\017\301\036\353\027\226\2566"
+	.ascii	"\243\203\002\334\313\374\242\260P\320\353}\271>\020\275\217\036"
+	.ascii	"D\340\034\330\270\362\321c\001 ?\256\264\264\202X\001]\001\341"
+	.ascii	"\001d\307U\006\032\370\340\301\001\262Gke\001\261\3421\303\352"
+	.ascii	"\247\202\n\262\200\004\211q\325A\017 <:\350\241uEA2\203\253\037"
+	.ascii	"?x\\\020\203\202+ <(\320 H\020[IYiMYU0\365\243\007\017\037SV"
+	.ascii	"Z\034LI\021q\226\006WZS@\262\262\264\246\220p\\\375g\334|&\256"
+	.ascii	"\357\032\216\360,\310\364\262O\025\037e\266f\212v>\017I\370\337"
+	.ascii	"p<\335C\252\366\306\267\363'\350\"\323k\246\2601l\262Uih\204"
+	.ascii	"\210m\006\016\231l5\016\277l|\267!\303J\317\240H`\3505\354\302"
+	.ascii	"\300\021"
+	.string	"\370\032V\226k\336\315\004\206/\003\335&\255p\331\326-\364\021.\275\264\235\264=5\036\211\357\005\027\020@\223-\303;A\343\363\260\025D\332\343\3016\003-p\003\376\200,K-\336M\032\337k\312\210<\013\f\364\265\257\031\270l\353\2774\351\257\260\364\322|}\200\007\374\006ls\t\227\027.]x;\177\006|\347\221\335I\317py!\3331\246\275\316\367}Gx_\23477[\276\307\204\005\355\214o)k\357\347\262\365\315\370\276Bf\225RK\310\370\216\022\007\213O\306\267\223\254.K\235*\340\265b|\0010\236\200\217q\343aT=\001\257B\325\007@V'}>\225\024\220\030\221z\212rg'\315e\241B\271\263\375\301\270I\274x\343f\200\177\361Grm\370\212\035\340\333;\262j\326\305\232\345\324EZ^\213w\361Gr\002\264x\246\346\343\261\325\370h\004\370\226\363;\003\300\007\360\255\345\357\334\024"
+	.string	"\370\342\223\254*\245F}\224\235\332mY\274\3331\303\342[\3705\324\212\237\240\016\313\370t+"
+	.string	"\311\344\262\324'\025ROf\214\002\257\342-0\013\313\303$\244\372-\037\246\232\342\251\344\370j\004\223\342[\302'a\026\005\211G\341\313\211G\361\032\376\230\204o|\355:TWI\353\365MO|\361\312\223PJ5\361\357e9\355j\337K\277\313\362\355\3132.\256-\361&\276\255\3040\213]\265\016t:\204\263\302\222\021\037e)sL\240N\316C&\035\337gldL\353\021T+\360`#\332m\247\276\243\250\371,\256\334\322o\312\211\255\332\007\235\212\370\250\223\035\233\335\2255;+vjU\354\246\330\245\241\331E\355\316\314\354\364\214<C\b6{\340\227"
+	.string	"\364en\020\nV\212\207.y\332A\363N\276\3110\214\nRc\222* >*\365\036%n\216\003\336\364\215\346\237\317D\314\222\214wS\252\317\346\232\224e\001\211\374\026\233\024\232>z\202\221O\202\344\307|\r\354\235\356\221\260\037!\354E\340+\3307]J\213}\2214\354\"yf\202\216\250\362\b-R\262R9#2\"\222$I\2061\022\013\020\004Bi\232\345V\017\022`$1F\244N!\204$)(I\322\001\202\206\336\032\277\336\027\345=j\340a )\250\t^\311+Q\n\343.\265;g\272\213\226=h0\024\220\266\273\213\314\320\270"
+	.string	"\251$\345V\252T\221\3348\266\311>B\302\331\376\024\343\007\225\022A\371\346S\351/+S\263\233\367\332\335\367jC\212\"8M\301\262\bl\315NMTt\267<\261jK\221\207O\375\020\242b\025Q\025_E\252\344,\324Xo\001\022\200\222\003\305\253\212J\251\024\205\323\220\211\262.s5\274.\324HS\032\002G\242u ~\260\212\366V\347i8\337\034u\005\336\260\036\267pZ\223\363\277Z\0240\227%\251\177'\033\3341\354\374\267Y\202\306\262%\030\324n@'a\344\271\022+\375a\307t\035T#\313\261\311\317\r\347=7\311\274\302\306:\235\027\002%N\\\323\030\244=\203\003\341\035\272\236\363\001\256u.\212\206\b\336\373\\~"
+	.string	"\236"
+	.string	"\336F\211\365\305\337\277/\274@\005P\241r\247\317b\n\352\201I\245x\374\224P\246*\267\030LY\344\215T\2638\354P\340\305\221\327\233\034e-\306\377\351\265\264\226'\240\210\263"
+	.ascii	"\342\267$\347_\247]Gt\036`\023u\022\211o\205\255?zRJE\205\034"
+	.ascii	"o\331k\265\211\177\355\34392\350;9\007\037\375\361?\276\375<"
+	.ascii	"\277\223C\027_\337\275\251*\327\f\007\373\323\316@\314\263\311"
+	.ascii	"\204\276DJb\376\262\213\036\234e\330lyh\365l3\203\363\372\332"
+	.ascii	"g\367\373\357v\355%\345\344\273\301\245\277\210Q\n#3@\262\230"
+	.ascii	"\004\232%\224^1+%\024rA\274\226\2269\205\204\326\b\001\235Fq"
+	.ascii	"U\313O\206pC\253W5\376$\260\237\027\337\t\002\t\016\0230 \246"
+	.ascii	"\227\250\314E\332Avmht\210\253=\253*iA\036\372\350\241$\330\247"
+	.ascii	" \003\376\030\025\\\206\237\374Y\013\356\331\212\212R\271\223"
+	.ascii	"\026\034\224+\326e\327^0[\254<\353\245\217l\375\0240\237\334"
+	.ascii	"wF\255\023\005,\202\027\275,\212\207xR+\002\260\34549\316\357"
+	.ascii	"\177\216\342|8\364\242\347YzW\313\3553A\306j\242C\004\005S\247"
+	.ascii	"6\214E^\355A\370.\273\341-\016Kv[\315a\203\n\"\b\036\304\344"
+	.ascii	"\231\025\271(\250`\317\372\206\257\246#\214G\245b\227\300\205"
+	.ascii	"xN\031n\243\345\231\305s\314>\344\020\240\254\274v$\300\341\031"
+	.ascii	"/_`/\303\371\321b\242P\274\351\325\237O*\370\037\277\247Nu\340"
+	.ascii	"\206\215u\353}@l\236\303\f\356\205\372\3140\026,2\327\342\366"
+	.ascii	"\254\205.\253wv\220\303\244\201\263'i\312\250\321N\226+J\210"
+	.ascii	"_1w\022\325\202\236\250X\377"
+	.string	"\213Pz^\276\302>\230\267\300^\300E\365#\201\263\2636\256\235$k\004\342\366!\002\241\233\261H\224\ty{\344%=yc\370\301\003\210\202,\f\351]\022\210\270d\037\203C\215\346\236S\306E}\201ka\321\257\336\331\037\230\274\345\fF\371S\314\270\361\214>\026\032\350>\2260\2476P\030\002\030\205\031\255\221\201\352p\b\223\356\306\225\f\352\202=\327\307\375\307\346j\260sn\211 W\243$\271\341\334(\213q\362\211y:O\217\246\034M`wi\271\213\035\334\351\361\361b\273=\230x\307\275<\311\300|Y)\0324\326\201$\001[\003\f#R@\326\232d\305\r\"e\212\373ie>\202?\003\343\327\254\321@\034,\346>\304K]\363\3576m[\3560\234?\264\373\fp\335gJ\003\001`4\366kLL\033\271\031\2621\222\003\354\023\340\343m\233c\221Pv\001\277\300\221\232\030\376\320\016\245\253\327"
+	.ascii	"\017\237e\213\222#\324L\3253s\\\252\346\007h\230ec\213\241\314"
+	.ascii	"\314J\236\347#\356v\261b\220\344\257&\352<\316aU\316\247\302"
+	.ascii	"%\345\334\346A9\220\325\353\0273TXJ\212|\264:\203\272\261o!\252"
+	.ascii	"\020t+Z\226E"
+	.ascii	" r\246\374\276\021\201#\rL\226k\201\270\370\200\2016\365j\314"
+	.ascii	"?\017\251\270\211\016\211F\311\306BM$C\336\203\222?\267\233\253"
+	.ascii	"w\020w\207\343l3\364E\002J\260\313(j@\030\365\371\017\211>\211"
+	.ascii	"rm\262\231\263\322c\344B\fTK=\021(\tn\r^u!\221\3103\233\362\006"
+	.ascii	"QD'\353\256\374\013\275]\335\314&\266\270H\366\b\003g\354\024"
+	.ascii	"\037&\331\263\335\004\242d\252\001\211;\326\274\026\005\334\255"
+	.ascii	"\016\212\272k\232\231\222:<1\247\001+\f\036\201\022Ex\306:\252"
+	.ascii	"t\300\3625\256\301\240\027\240\204\326\263\267\352\255\f\002"
+	.ascii	"1\r\256d\354\231\244\323\334L\0269i7&\306\207"
+	.text
+	.section	.gnu.lto_processRcCommand.106.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\341\bM2"
+	.string	"ZU\340\022EP^R\007\227\243\007\343\263\360\347*\003A\333\023\037\317\026\223\363\367\234\020!\302`\240\025\226s\324\232\200\221\200<o\246Y\304\003\"\304\301"
+	.string	"\026\365P8\020"
+	.string	"\2068C\227'\220fdE\220t\333\275w\222)\005\036\001\005\001$\001\020\274J;Z\017\275u+~\306\364+}\365\214\225}\007\327\230\231\274\234\263\203\327[\245\377\270\336\262\236t\275}7\353a?\210\300\364\262)\317\320\\Co\214K^\316gG\336v\201\327\333fv\303\3613\256,`\254\255*K\235\234\363\362\225$\373\235=\363\016>\323\201~|\222\310\243\261H\354\341\031\n\203/\320m\203\330\307\314\366\002Zqiu[\244M\007\n\363\037\247\213\206\261-\301>`l\0037/\234L\202\365\345H7g\241P\233\034\301\372\362c\227\033\273\270p\221-\214\310*\251\254\322I\264\b\356\211\320\243\t\017\360\202\206-\256\2632\276#XD|\310\376\240\331r\343N\242BX#j\034\220\036\242\213\016\301B\326\330"
+	.ascii	"-\007\016&\301\232\372;\004\004^8\202\225\345.\353\300j\244\217"
+	.ascii	"(\255b\211L\344\236\276\006\305\255;\247\036\204\346CtQ\255!"
+	.ascii	"'Q1\314\002\361'J\251Xe\316\331\315\034_I\237\030\003/\344\234"
+	.ascii	"\033[I\261\274\001x\267\203\351n\020\335\300&\001&\274L[\337"
+	.ascii	"\234\363\204\3661N\246D;\230\267}\002\005\212\3675o\231L\361"
+	.ascii	"\310\340p\316\271\331~\265=\350\221tq\377o\276\315a\277\372a"
+	.ascii	"\334J\216\373\222\213\377\337\241\324\247\303\371\227%\246\246"
+	.ascii	"&\327[\374&\246n\310\372\352u\375\372\257\266\r\327?E\332\035"
+	.ascii	"\025\266\323\355on\265\321\016\326,\234\260[y\333\356\344z\353"
+	.ascii	"\377\322\2672\252Y\226\023\377u\237=\361W\273\335\275\256^a\372"
+	.ascii	"\221t#\tq\033\275\270\213\210\022"
+	.string	"\034p,\336J!\002B\334>\336\346\235t5o\244_\361>z\231\2671\210\273\330\342&\002q\367\274\270y^\334\303\307-\004\342\016\266\270_\0277\260\305\355\266\270\333\0267\313\342~\0267~\334\276t!\347\207\017\251\017\251\313\371\307\337\235<\327\302\211y\233;\026w5\367+\356e\356\326\3036(\324\016\257\226\356a\017\323\332\263\370Z\017\325\332\n6&\207\341\305r\003\243Q3\366&V\374\206\t\336\370W\302:\302\177\240\345F\226\325#\205\350\277\313\335\324H.\"\272\013\322y^\350\314\361\030\300\335L*L3\354V\t\376\273\324\375\315=\277\371r\345h\316\271\210\305\235\271&\356\253\360|Bg8\300\r>\220\025\217\363\342\315\231JB;\236\347aH\312\220\301\3656\370n\346\354\231\251\037Y\025'\376\023~\265\207e\336\003\337z\005\035\371\361\257\220\374X$}\333\363\253\327\025,\370\325v\315\242"
+	.string	"\t8\025jFu\205\036\371W\335\013\374\370\007\336\321\234\304\026\021<(\365\371\246\255\003\334l\3001\335\343\313z\357\332*\200\313\216\203\322\257\261\222\023"
+	.ascii	"+\037\371\307o\340\277\257\204~\263\333\331x\235\224\207\017"
+	.ascii	"\037\\o\201\217c\272G\226\205|\345\023\267\250x\320:N\374\207"
+	.ascii	"_\367\331'\240&\204K\207O\315\354\251\007l\237}\241\3775\320"
+	.ascii	"2h\234\256\255\"\372\255\337\\o\333\367(S=\276,\nhwx\270_m\354"
+	.ascii	"}u\217\3376\255[iv\354\237i\253\2006qnf\004\t%\2457\001RN5\226"
+	.ascii	"X\241T\n\f+T<-\305\210\001\225\304\024\325\343\3440\232\236\236"
+	.ascii	"\226Z$\251h\232\261\244B\006\rb31`\212Z2\255X>9-\305X2EI-\031"
+	.ascii	"$\033JFS\324r\006\024T\324rx\346\364G\322\032\304D\371\362\234"
+	.ascii	"\377l\177\303:\340\264\342\246\350\001\025\031`(s\313\002\027"
+	.ascii	"\246\3029\230U%\314\256.\227\370\305\007\260\006zf\001v\306\341"
+	.ascii	"\346\b\346\227\022\361\375j\007w\204\2666\346\347\253\r\364)"
+	.ascii	"\267\347=I\232]\237\373M1\2270\305\230b\256\267=l\035\2550|Y"
+	.ascii	">_\355"
+	.string	"\342\035\022\351[\257\343\221'\377*\371<\237$\347\363<\317\366\261\311\257v\362\221^(\255k\017JU\200\223\337\315\034cB\301n\325\356\346\3076w\3279\252o\376#\277\332\270\210\375\205\213\215F\357\363W\315\036\213\336\350\235\315\221}U~r>\374\242w\250\236\361\207\357Z\034\207\231\251\362s\342??\3139\033\277\332\316\346\b\342\200\251\363\234s.N\271\306o\275\200IC\364\242\306C\364\003\240\001\200\276\250a,&\025S\204dDDd$I\322\001`\002\22113z\021\240-ee\223\266\003@D5U\236\250\215i\367\0261l&7\003\013\323\361\3215G0\200\377\317\227\374\304\346\023\t\370\220\221\026L/\336\350\033\363\f\240\363Di\254\026\211F\326\342\b\334f\250xS\206\374Q\346+\330+\031(-\315.K\253\252(d\0136D]\236b\212<\251\374RG\315\210\256\211S\3425z\327\222"
+	.string	"fl\031\374\003e\376E\245\260\033\360\204\024\006\020\0368\tjN\030\216\337\036\021w,\254\376\260\264\004f\236\233{I/C\274\034t\366?\200\r\330\226\031.\244c\307km\362\336\357\214s\360>\304i\356\025\256\275\241\336\034\001\211\311I\270\344$\210K\377\234!^J'\024\267N\030Ha;\3157\212v\220\031E\267\274\003\323\2718_\324\024"
+	.string	"\240\320\214\224\257\b\n\202Qo\247\037\274\303\362C\r\246\346\222\342\234\275=\035\314f\020\312\"\365H#\252b9\2451\344\237\256t\202\"\354\250%ixS\204<Rqp\206\351\342\322\235\360\305\214+\266L\216\026\3362\"\327\265\322=\366\233\257\004\326\267\331\017 #\203\357\026\363\314&\fJ:|\273\357;\310\3755\246\351m\365\352\204\357A\356B\005`\335\306\330E\232\337\013\242C\310"
+	.ascii	"^h\316\b\003\020\315\")\004De\002\305\025\016|h9<\005u\005\330"
+	.ascii	"\270k\270\205\036\331\026\365\007"
+	.text
+	.section	.gnu.lto_updateRcCommands.107.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\305\007}*"
+	.string	"*K0\020F\200ZN:5\032\263\300\004\013X\3160\370(w\265vl$\337\206\003\217\016\230\265o\356^\024\373?\272n8^\377\325\373rc\254\3408\314\375\340\335gN\247\374\006s\274\217\035U3]Uf\215XB\266\224I\006\360"
+	.string	"\330"
+	.string	"\372"
+	.ascii	"\373\243\262jET\302J5d.\013\322\331\356O\312\336\254\354E\215"
+	.ascii	"\256\260*F\347\305\366\311\223\035\212\324\243\254\332+V=\215"
+	.ascii	"\271\260'p\265V\244\227\213\340|Yt \363%\375\217\371r\357\344"
+	.ascii	"c1.\266<-kf\264\304^\356\306\330\375\275\344\337J\355\2629\231"
+	.ascii	"W%\nkRU6Wk\035\366\220\355S\262o\220\245.\f\002yv~\276"
+	.string	"\336\3113K\332,\265\347Ahr\312\205d\315\352(\343B*\364\242LE\016\n\301\002r\240\326y\264h\221\331\017\200\341\370\301;\277\003[X=\356\313\352\301=\036?\311\340\340A\213\300p\354`\336\026\226\217\233\276\243\216\227\300\243\221\026\325Z\177\307\031L)0\211\230\"\360XE\031\240\005\261\273\331\371\352H\305\375\344=\204=q\263\205\005\344\314\203Pk]\266:b}{\276\373\243\335\255\260\313\253\020[\256&b\004\t\022\346\313n\272\246f\354\315\375\252:S|w\341iMg\255\325\301>\313\2658\355\277^n\211\023'\314\227\357Wyy\204\302\305K\313IZ\327Zet#\227h\356\255\374\nq\377\265)T\360\255T\230/\313\243Z\234\226X\334\024\337\355\222\025\271\221\273\177\355\256]&%\312\233\264\200\362\036Q^\005\247\3625\242\274\006(o\001\312K\200\350e\337\001\217\362\035:y\005P\336"
+	.ascii	"\224W\250\344\r\242\274@\315\013\340\344\375\241\274>\315\333"
+	.ascii	"s\362\nO\336\340\311\013\244\274<=\336\035\312\373\243\274>\036"
+	.ascii	"o\357\344=)/\217\307k\232\274%\345\245%oS^n\3363\030\262+\226"
+	.ascii	"\221\022&\326md\365\306]]\035S\246!9\225\277\354\217\362\336"
+	.ascii	"\235\262\257\022\255\346k\334\370\253\306\323\300\3567#\034\201"
+	.ascii	"&j\236\366)s\344\314\bV\344;\372k$\373\272kM64<6,\347\202&\352"
+	.ascii	"\253=\321\334iV\222t\333\215p4\022\316\354\364\343\262\342\226"
+	.ascii	"\364|}\324\013\372\307e\244\r\t\353G\215\323\327k\337\204\227"
+	.ascii	"!\323{\243[.]L\260x\215\\\263\213\034Ez\220Y\2270\245R\017\350"
+	.ascii	"\253\335\263\307,\232\220W\230\213\241`\001\003"
+	.string	"\006\2537\003\372\354 \227\0214#\234\311\353\243V\352\037\327W\033c\222b\21672r\312F\356Q\363\372[\311/f\3632\374\313\006/g\343\320\341\303\007\363\245\331\007\313B\263d\214\211\260\225\265\241\215\\~\224Y6T\322\215\212\347\354P\227}\263kH~\211\251\2523\025\367U3\025\364Q\377\354\374\005\2141\316\250\025t\2067\343\034mn\243~PfLR\344\273\355\246 \316%\304Y+U\203}\213b)\nE\213&\342p\305\023\221\370\3444\344\202\004\263 \266\350\250\024.\232\350:-9A\r\235L\fW\244h\"\016\235\240\242\206K?\373\304\242\004\324\260\305\323\023\324\360G6\365\327\356\332sM\2341S]\\\001\315T\\,\320\002Z.\253.\331f\006\007\303\206\201. W\\{\2006\320\037{\20243WmfB\r\324\001\272\337\202Z\210\353]P\377\214\b\200\006:\235\333\325\321\227"
+	.string	"\372L\262\352\350\322~\232n\321\202sI\375\363s\305\b\307K\363\353\2446\345\212Y|\372\327\313=\355\323\rf\351qpz\372M^*\311\222C\227&l\344\366\334\200L\335n\214\364\241\276R\372P_\3564\230\364\241f\352'\337!Y\344\316\250U\344;\006\n\335\300\365[\260\205\335v\3067l\026\355|\013\306\241K\233\"\253\265\3624\262\241\254\025\331i\344\262o\351=/\275\244\023"
+	.ascii	"\006\200\231\250A0\007\235Bf\206DD4I\222\326\220\002\031\261"
+	.ascii	"2n\021p%D\214\331\244\332\r\035\002\235.rG)j@\006\202P\233\377"
+	.ascii	"?s\230\324\312\220k\333,\301\351\356$\234\0260qE\\\351\354\""
+	.ascii	"l\002\347'\344\332\020\243\315W\306\034cLo\327\252\214\232\251"
+	.ascii	"\253\006Q#\210\270F\005j\004\303\345\277\003\020\273\316\317"
+	.ascii	"\234\325o]\300\2269(\363_\030X\210\313n\374\035\313i\300\003"
+	.ascii	"\005\330m9\320\020Vn\002\006\r:\333g _\335)\363\325z\0053\214"
+	.ascii	"\210\303\376\371C\304\271\351\t\345\251\3162s\004\021\233\234"
+	.ascii	"\272\2250\377\213\024\252y\340\207L\231\242\003\020w\325R\026"
+	.ascii	"g\001j\230\253\022\263+\320\267+\222b\032\214$wJ!\016\320\242"
+	.ascii	"#1\334L\216\201t\212zw9\027{N\316\240\272,6P\332\226\357\225"
+	.ascii	"\2169y\247whA\3762\207\2307\246BC\222>\360J\201\360\215G\253"
+	.ascii	"\317\221\236\b\256%\025\203Y\276\223c}\263j@\b\204\260\353\327"
+	.ascii	"p\203r\305\203\242>\021h#\036\356\f\263\310=T\020\337l\370\006"
+	.ascii	"\271\202\312\214\240\035\277\265\277\300\333\232Y\266\227\337"
+	.ascii	"\224\364?"
+	.text
+	.section	.gnu.lto_resetYawAxis.108.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\235\007"
+	.string	"\002\01634Po3\006\220\230\230\313x\233\272\b\326\rP\212\360\215\323\252\261W\\\214`\264\235rX\177\260!\315\261"
+	.string	"\317\314^D\3054w\024{crb\254\334R\246\024\2650\0266\255\207)\001\321\0201-,31\005\275&\034\260Iq]\330\254\270{z\374\004\220\266Q'b\210\332\031\260\230\370$S\241\321P\226\f\236\317\353\332\302\313\210\271v\004\240\377\t5\211K,\352\017\313^l\2405\313zCYB7\205\262\\\360|!^\007~-\307\201\261\243\365\364\370i\247\001\025\215\315\241\226\177\343+}$QBm]5kI\346@?"
+	.string	")e\210\274\3773z83\314j\213X@\3338\206"
+	.string	"\n\377\013\265\215\303\215n{i\213\320v%\016"
+	.ascii	"3\241\321\037\270g.\003\244\006\230\200\201\267f.\304\2243C\200"
+	.ascii	"\256\341n!\214\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_isMotorsReversed.109.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375 \3405\006"
+	.string	"\242\013+2`M\222\016@\203\200\354@\021\273\312<\025\303\211\251\002\004\272\331\332\253\261\326n\254\217c\353\245k\214\001\200`\216\353\252@xaj\355\330\270\351\275e\n\267K\233X\203`\023\021\016\022\254M\025\354R\260D\36101\013I\232\230\345\312\242\347\360`\203\234\257HG\250\373\371\002s\255\032]L@\243\303\201\215\315\205\376\322\034r|\001\022=\377}H\200\362\261\n2\311\354\204V\362$*\371\3703oYa!3\325\313\243c"
+	.string	"Ra\220\250d^\f;J\365\250\333\2206p@)\225\245\351\t0d\346WY\032\035\373'\374\b\177F\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_initRcProcessing.110.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`.\004U\026"
+	.string	"\026\346\206J\260\324Q:z\220\3610\225\303;>\005N\303\246\3711\366\\\300\n8&\030\326q\367\316\215\327\3261\355l8\327\232\236\177\303D\337\335\330C+h\337\3202'\371\226\243\256\337!~\316\275\354\375\b\255]C%\237l\"wJ\001q"
+	.string	"f"
+	.string	"u"
+	.string	"\2539-~\232\356t\270\323;\247\347\247O \300\224\356\366\335\214ZoJ#\365G\223Z\330~\3133;x\"\236j\340\347\306\246hH\255\365\265(>\373\270\022i\270s\346\227\274x\"o4\037\215VB\342\216.X\341\"|\320\307\037?)\242L\340\340\27666\0205\""
+	.ascii	"\240\317\b\222[\215\316\025\203Z\253'y\303\271Y\267\215\263\235"
+	.ascii	"\300\016]\002g\312!\355x\341\3720\036\303>_\347\r\356\271'\236"
+	.ascii	"N*Rj\327\276\027\261\200\232Zi%\341\336\326S\233\245\347\356"
+	.ascii	"n\225\r"
+	.string	"\352;\3676G\374\362\241\330Xk\315\211/t\236\007_w\352\030\231y\362\324\227\021O\277_\312\035\021\341\321fi\023\325\346\236\260\277eYFyw\354O\267>M\022N\263vz\334\351%\031\242\306a\200~4\263\312@\037\021H\313\3447\205\274\035>\217\005Z\362sL\0267|\034\016\216?\002\361TEO\325\261o\303v\360\200\017W+\315s\256S\177J\364\324Z\025\264tl\363\210m\f\367\255\214\265\326\023\277\307\201e\324\315\210\247$\313\342\235\306\217f`--\342)kO\"\327\333\341F#\r\356-\322j\024w\265\241\022]\321\3452\212\350\006\206\231\300d/X\206\027\214\013\313\313\013&\213y\231\fp\254C\213\354\365!\026\223\275ZD\264\207uw<>\345~\264\255\271\265\376\324\205\254\314\206PP\304\323m\"\245\032<\352\351P\016\036\244\244\354sr\300]8B\bR\366\270+X\265\212"
+	.string	"$\310I\307]A*Q\002\260T\272+\330D'\370"
+	.string	"rJ\272+\250\024R\250P\200\247V\332I\337\351?\013\027T\346I\025\361\264U\333\005^\2501t\304\220\"!Q\220\202\226\2440\034\020\003\021\251\211\007\021\020\251\225HJ(\324\232\r\343\370T\270\322\fG#\302Y\242]-\002\267\334v\330\032X\334\261qy\311C\001\311C\2314\200\204\311\031\031\356\013\004\013 \202\365="
+	.string	"\n\031\344\b} 8F\035$,E\327/e\006/5\206\007J?\031\240\255C\243\264\230\254\3319\215\020T\024E\344i\244J\345t\201\343\200\357~\253RM98\326Y;\274\350\350'3sW\361"
+	.string	""
+	.ascii	"\320(\345\007$sD\225|\376G\233\320\337XS\302]\003\036\313\n_"
+	.ascii	"z\036\037\351\356\363\007"
+	.text
+	.section	.gnu.lto_rcSmoothingIsEnabled.111.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"}\n"
+	.string	"\206SF>@\247(\035\314\307e\356S\2746G\022\327K\265\276\031\t\007\316\377?x\330.\007\322\232t!Bb\252{\353(\377\210S\f\312\356\3518\215:\022\347\335\332]\312"
+	.string	"\023\276\326\222M\244L)4"
+	.string	"4"
+	.string	"6"
+	.string	"a\246!\007=^\232 \237\222\241\360R\254\021\030z\254\200\374\362\260\200_\252\002\350]\227\335\275\311\223\004~\231\224\314\356:G\340\307\215\335v\205\355\006\373\021\001]\266\354\320KE\331\277VO\266\323Q\323\232\351\314\364\261\004\006\004\300\247\006\354\226Z\020\366@,@b\373c[\f!\3611\350\241H\211\241\204%\022\320`7z\n\237\233\257\002\244jL\013rwCj\016vU"
+	.string	"\006\020\254\022|\371\300\366\366\023Ne\367\233\360SWu\374\221Gwx\362\243G\337\203=^5&\005\016T\001\3260\032\227i\030\231F\206\305&\323\270N\206Y\360\266q\301e\034\333\306e\226\260\273\236\234\352\360\274\036\256J\262\035\365\322\251g\325\250\027E\350\262\205EE\371\327+\024"
+	.ascii	"K\b\230P\307;Y\031&\204\001\206\001\316\300v\233 5@M\301\007"
+	.ascii	"\374a\035\027\306\300a\032`,\013\327\036V\370T5\250f\336\226"
+	.ascii	"\2467\241\224\001"
+	.text
+	.section	.gnu.lto_getRcSmoothingData.112.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375 \356\205\006"
+	.string	"BL-3PO\222\016\200\276\032%\210\246\252=d\323@+,YlA\177\344\324\3076\233\364\3601\374\034\001\255\314\314Q\242\251\320\n}\026qX\347\246#\237\020\231\002K\033\211z\022\303{hPpx\022\025\3616\232'\210\005\352IL\023\36521{\002\243\314\252\3265i\234\270 uS@V\253\356B\250\216\240j\236\217\035\326<\276"
+	.string	"\331:\236\t\274`\\\375\250df\304\300$\213K\t\3719\237\271#%\341\f\333EE\305q \322b\201\342\222\031\337\261\003P]T\rT\327>\n\313\340mI\023<\237\025\353\352\224\005 d\346\314\2724z\353o\360\027\374\033\001\t"
+	.ascii	"2\003\302\260\021a\203\205P\\\023k#\360\026\"\027w\305\324N2"
+	.text
+	.section	.gnu.lto_rcSmoothingInitializationComplete.113.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"-\013"
+	.string	"\206\025M? Q\233\016\037\b\351\035\216\216\347\b\360\004pd\"\324\226T>e76)\251\024e\340t\033\2020jO\374\236\247\313\375\037B\001`"
+	.string	"D\310G\005\346\001t\200\177V6\323\203\354-eJ\001<"
+	.string	":"
+	.string	";"
+	.string	"\217P\023\363\337\361\351\2056\372\270\016\303\343\304\341P\322e\200\223\335\215t[*$\300\242\203\fI\247\301\003\037\025\033\336\361\354t[&\200\006\273\353\344:\r\267t\333\016l\033\260\277 \005`\214\262\374lOK\r\331\207\253 \333\351\250iu:3}\tr\200\334\305\214]\317gc?b\n\021\2667v\304\n\030l\214\335\023y\006p\320\340\234"
+	.string	"\331\365(\365p,RJ\270\tl\332\335\212_\342\036\226\t\227\213\364\230\372\025\037\362!\270\317\207\036#]\003\264\360\210\261e\210m\353$0\323\356V\361G|\224\361A<\372\202&\317=\372\032\351\361\032\256(\325EU\021(\n\226\007\027\252\2722\024E\200\255\n\020.\312\202e]T\304\313\256 \247\"x\302\004W\355\330\216:\311T\263j\324snd\371IQC\376U\024R\003\005T\220\261\022"
+	.ascii	"K\b\230P\307s\262R\2370\\`*\214\006\205\224\300\004X=a\240\367"
+	.ascii	"`\241k8\340\210\0220\221\201\337s\204\366\253B\322k\013\024"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.part.0.159.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\031\003\355\026"
+	.string	"Vj\223I\300\322Q:+g\201\301\265\314\266\276\212\206\277\341*Z\307\271:h`n\002\217f\244\177V\351\212\211{\204.\303\036\226\326\016`\356H\373KXQ\220\267\250\224\233S("
+	.string	"\021\320\301\301\025\207\324\210\247\365\342\177#\204\310\235Rx"
+	.string	"|"
+	.string	"\200"
+	.string	"K8/\007h(\223d\354\226\t\346|y\245\365\365<\347\225\034e\326\356\320\023pw\017\\4\201\325E\373)rz\266}\024O\322\331Qa\031\302w\026@=MAv7vQ\345)\343\305\360'\343E\005q\335\305P\347\250\363u.\252^B\340\214\237\217/\303\303\351\343\303p}\371v\241\312\356\036\370\371\343\343\231\323\344\243\352ew\275\n\272U\267\r\301v\004[c\002\323/\022\3278\335:\323?\302:\324\275\032\247U/\377\361\277[\034\247\3039\255sz\336\351\277I\312J\322.P\220\310\n\211/H\374\367C}\332\367W\\\205\337\342@\267~.r.r?\"6\310\254.B\345XeW\256Q\217\205\177+\235\036\200\036\036\034|\354\356\312E3x\272\377\224c\267l\235\335rj\272i\2729lyl\214"
+	.ascii	"*`r\213K\316\002\365v\313\026\027\335\003:\326\207!T\016$\241"
+	.ascii	"\226\272t\342`)K[jA*\370\271\273:\252E\266q\306\021\025`4"
+	.string	"\204i\307n\n\361JEei\214\224\016\336\221J\375;\220\013\273\006V\372\"\274\031\243\252\364?\244h\370\367\017<\226\312\365\202`\020\310nw\247@\250\242\316\036\274#\325P\003\264\340\371\230\352\033w\324\250z^\t\236\031\364u\352\201\027\217\244b\364L\355\314\340\324\"\353\370p\225\310\2609]\242\n6\0227\223\301\270ffH\\n6\332H\334L\006s\273\321j&\340H\262&C\342r2\024\0048\033\275=\240\325h\034\320j2\033L\205\006\022(\310`\236\261\314l\261\331L\254\206FV\213\315l\267\030\313\211I\033\232-\206#I[l>\\%\362\201gy8\321!,Q\230a\352\227\035\345\021\265\3107\2014\245.=\222\323d)\211\376\330\341\323\352\220_Z\242\357\231\032\231$j\327\310\361>/E\t\202Qc\247\001@\250Q<\305\024R\244\230\004\022L\230\245\306\302\001p\2421\213\334\021"
+	.string	"\256\204Uk\330\r\221B\225K\312l#i\334\214H\310\b;\274"
+	.string	"\273A!\234\322\252\007\350\262f\037\333S.i\264Q\272X\211\006\342\224\300\317\217\263\002\by\224d\0207\f\224 i\365\373\373\351\232"
+	.ascii	"\201\016\233!\274\344\221\365q\270\263\251\003yz\204\320 l\253"
+	.ascii	"\320S\021\270g\341S\2637u\234IX]l\321\306\202\253\371\024\230"
+	.ascii	"C\240-\270k~w\360\003"
+	.text
+	.section	.gnu.lto_rcSmoothingAutoCalculate.part.0.163.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\255\n"
+	.string	"\206\023IB \307*\035\007\367\\\200\303\271\351$G&1\270\023E`\0251&'\310B;"
+	.string	"\257\02030\202\031\n\207\033\313\270\326i\320D\236e\304*\301\b\300\310p>\350z(\214.\220\226\026jd\023\271S\n7"
+	.string	"5"
+	.string	"5"
+	.string	"sG\016~[9A_\256B\215o\313 B\001\0031\241\353\2739\210\002\\\234P\265-\020\020I\360\361\222\025\246\244L\370\314\204j\255\326|\334\334mG\330n\260\317\020\363[\335\227mi\271\322\337(GG\254\265U\203PA&\200\023\373\243\311\336\330'{\363\371\024\177@&\017\333\376\200N\006\037#iq:\020l\2744\2505F\037\033\342\375MV\342\200]\230=\342\276\"\227\003*\351\300\266\367\226\221\246\326\372\340\263<F\362K>\235Q\222_}\372%\356\363\253\202\262@\034WP\262&\027\346\r\356<\335G;\021\265\240\220\250\240\335G\242\036\005{\027\023\037\305\360\274\217n\276/gh\nd\263\375A\356\343!h5\331L\372 '\227\265\016\2416\345\335:\001\036\264D\230\032\022"
+	.string	"K\005\340\324q\025\013\f0\303\350\234\b\312\367\006\232%\301{"
+	.string	"\205\313\306r\260\001\030\300ia\315\021\325\031\036WS"
+	.ascii	"\325\275\327\2261"
+	.text
+	.section	.gnu.lto_.symbol_nodes.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\307\006\375\031"
+	.string	"\206\253\236BPdN:CyD\033\371\231\272\370O~\036\272\324gj\262C\0204\213\265\236b\247\002\n"
+	.string	")\356B\002\251\326\216\332\324\217'\264\231\320f\242\374\t\360 \216?]\276\314\213\336\254{\201\215I\333D\246\207"
+	.string	"\214"
+	.string	"\217"
+	.ascii	"\237c\315J\344\313!\221\273\f\312\266\255[6\"\267\030\024\263"
+	.ascii	"\"\272+DkI\237\005\342r\351\207\316\222z\370`\207'9\034nCk\241"
+	.ascii	"c\302\304\320h\310\317C\235N\227!\277\017\206\374;\350\205n-"
+	.ascii	"tV\205\257E\375\215\302\333&\234M\302\343R\374\267\313F\2702"
+	.ascii	"56\233\3767b\333\226-\203\220\237\347A\376\035\352 \337\016\332"
+	.ascii	" \277\216\323zA\351\177\264\215c\366\347_\331\325B\226eY\250"
+	.ascii	"|:\350\377aZX\214\344\0136\313\262\277\201g\221\374A]\225\037"
+	.ascii	"H$\037pH~ \374|>\003\251\362\001\t\271[\220\374? \371~\350Ts"
+	.ascii	"I\245zK\332?\362\377\370\270Z\037\227Gf\217\374>\224Gs\355\350"
+	.ascii	"-\035=%\315\321\356\227j\374\n\341"
+	.string	"\310\367s#\237\317F\376^\215+\372^\337\031\030\215|>3\362\367\310\310\327\213qg\n#_\317\213|<\250\213|\274\026G\246,\362\347\254xZ\252\"\237\231\"\177\211\"\337\016=\221_g\"xxE\025\027\233l*fB\266\251x\t\351\246\342%W\351\013N\305\304f\033\217bm\376\246\342\341\333MGAgQ\305\3356Zd\200\017 \025\340v\366\227\004B+\004\302\241\373\026\261R\263\005\230q.\377\022\361\320\355\325\013\314\335\323\210\230\370\325\275\206+L\336\337$\334\310\026\262hHx8\226\n\243\344\226\002%7\225'\271\2538\311m\245I\356+L\362\r-\311/\204\225\177\350*\037\221U~\"%\371\213\222\344?\221\344\023:\222;\0170\326\250Q\250\3646fY6+5b\244\266\017H\347\314#\032\361\321\333QZn\234\253\021\267\330Wr\305\315\306\215[q\237q\373\b\315K\017\253m"
+	.string	"^\322\250+\276z\233\300]]\322\212\247\334F\303\310\004\257\\\261\224{\271\0257\265}\304\225\374SW\\$\323\013\230dgP+fr;=\356\361\375]\361"
+	.string	"d7_\227\344\347Vl\324\366\355\340\274\001+"
+	.string	"\205\253\232\375\304\264\333\272\232\212\251\232\3754\250l~M\305Ro\017\337\002l\250Q\b\003\223\255I\223\202\324Jc\340\002\241\231\342\034\021\220\220\304\025!Q\tD\302\272\260\007\255\360\017\344\207\345\264\002\2406\207\216\262\317J\236\027Fa\301X)\2516Q\216@Q,\212w\035\3457\252\276iK/\324\2526eY\365\247\310#\342\314?\214\002u<\262\233Q\306kj\341$<\001\221Q\257MM\326\212c\250\312\302\334j/\272p!S!#`\037\350\031\232\214\314\304&\375\224o\265Q\256\361\204\253\023~X\233\335 \007\271\310\310\275D\253_\033\223\215\262@\335i\377\304\214\003d\\\353\356\300\376"
+	.ascii	"\216\031\271o\332\013\313\223\370H4X\362\206\002i<\344\306~\353"
+	.ascii	"U\320c\344b\177"
+	.text
+	.section	.gnu.lto_.refs.625e87025f715dff,"e",@progbits
+	.string	"(\265/\375`\304\002\205\023"
+	.string	"\2660\203E\340\222(\351P\233\331\335\376\003\372\274\207\207\272}X\016a\2141\324\177"
+	.string	"\026\301s\r\200\036\306\030c\2141\306\030c\214.\243e`Fn\026O\026[U\354\320&\304\017\366\033\3327\354G\373\355?\002\277mD\246k"
+	.string	"i"
+	.string	"\200"
+	.ascii	"\254Cz\363U\237\304\210\357\017!\372A|}\017\261\337!\325\267"
+	.ascii	"Q}M\352c\250\207\371\376\345\353\260\357Y\270\216bz\027\327M"
+	.ascii	"\342\223\210\276\245\352\253\324\203\304?\241\336\373z\351\364"
+	.ascii	"\234\367\237\356;\246ow\t\344RN\352[\037\301U\\\377D\177\332"
+	.ascii	":\327\337\264\327B\035\004\352\361\363\235\370\231\347a\274\243"
+	.ascii	"q2\330\333\357g6\001\257\262\203dWeOu\217\312\376e?e\357^\237"
+	.ascii	"\331G\335s\331E\335o\331C\335\203\262\236\3541;'{\306\322\313"
+	.ascii	"\362\312'\356\274>\313U\262\277\311\247y\375L~\313\351\t\234"
+	.ascii	"\376C}O\247x\256\351\223N2\365\315\325?\256\317\\\017\340\334"
+	.ascii	"\321\036j\013\200W\333\244\267d\222\336\221\003\364\206\026\351"
+	.ascii	"\005\335\352\335\006\320\033\333\347C\236\377\274tO\374\016\253"
+	.ascii	"g\254\257w\001\322\345\260AC\006\f\027,\304\336\n\t/\205\t\022"
+	.ascii	"\"\240\276\020\0368\340z\033\264|\031,\020}\025\3447\301\017"
+	.ascii	"\037=x\354\320\221\003\307\r\0335h\314\220\021#\341\303x\341"
+	.ascii	"\242E\366Y\254P\221\302\245\217\"\177\023.\177\t\323/\342\364"
+	.ascii	"\177\200\375\035Z\3727\361gP/\343},{L\302_`\335%;,\373\310\353"
+	.ascii	"E\362[\331Y\331C\262\001\237%\002x\023\326\364\254\243\201\247"
+	.ascii	"P\035\325\375\307\201\177Z\367FpO\353]\006\357\264\236\020\236"
+	.ascii	"Z\037\r\037i]k\217\261\357|zc\037\310;\263\201\016\267\336X\031"
+	.ascii	"8,\366\224\356Ob\336\025;I\314\267bg\305_\305\376\305\276\024"
+	.ascii	"\373\214]\213=\247{\030S\230\321+^W\341\372k{\024\321\263\274"
+	.ascii	"\377\272\357Jzi\244\223\264\017- \220\242sS\363#\304\227\324"
+	.ascii	"<\260\026\265\203\024a\2411\306\232`\2071\232\22037\033\303&"
+	.ascii	"\304V\335\256\304|7\227\214m2\273\332\330\004\223\307\331\235"
+	.ascii	"o\354\021\223\3540\206M\332v\032c\254\t\254\260\2431l\3602\271"
+	.ascii	"]\211\310$\202\264\016\200;l\0327pI\367\300\320n\227(7\027N\002"
+	.text
+	.section	.gnu.lto_.decls.625e87025f715dff,"e",@progbits
+	.ascii	"(\265/\375`\337VUd\001:G^\177U \fY:\215\001\254\371\265l\370"
+	.ascii	"\214Z\372\016\037A\300\226\027\030\2616]\303\023\245\353k\370"
+	.ascii	"\344\271\335W\256J\2432_\017y\263\334Q\020x\375\336\260n\301"
+	.ascii	"\317\256l\272\214\306\256\227\360\344\"7N\365\372p\034\247\345"
+	.ascii	"\224j\234\350\351\376\377?F\222\275\345\2262\005\345\006\364"
+	.ascii	"\007?\bXt\207+\204\376D\323?\223ZI\224\2011d2p\376\251C\377\302"
+	.ascii	")\271Z\017\316\336oK\222K\360\330\030\345]\0223\301d7\r/\301"
+	.ascii	"I\242\020\341 \301!&\205\346\237R\372\271O?\353\351\347;\215"
+	.ascii	"\271\356\020\312\301\025B\237\301h\035\256;\204^\"W\b\r\202\205"
+	.ascii	"\234H"
+	.string	"\362\274\266p~N\013\222\307\364\363\227~v\241o\362\n\241_\336!\364\246\032\314\003mad\333\341|\363M\343\035\370\353\246a\260\3472\256}\266\267\222\307D\306\210S\303\371\267\b\365\371\373\373\373\273E\350M3}\263\207\276\211\245\217\337\350\253\274B\350\r\364\256\211\034\r\234\217\347\364\257\022\030\\\2261\356f6\271\322Or\300]\371\215\216i`\255;\305T\256\351\024fq?\336\3026p\r<\343\246a\0328++\367\216\272k.\034\246\201e\\\255'J\271}\240`\266\304\230\301\267\367\376\340\203\017\210>\300\321\272\313!#'\0377\321\307^\372\030\207>\246\241\217e\350\343*}\034\245\357\332\025B_w\207\320\037_Y\225\310\312\"[qlU\025\245\347\205\023\261\0318c\026\230\352\246i\300-\266\317\315\003\203\302\302\371\267\215F\301\336W\003z\377\376\256\006\364f1:^\241\200\036:\306Th"
+	.string	"\036\261rc\307\224\007:\252M\212\222\024R\027\t\027\233-,\205Q`.X\360\266\340\214\243L*\312!Yp\376\305\323?F\3364\fu\265\235\315\301G\305\237\033-8\343\247\273\335\270*]\330p\306\333\247J\223\272\0368\177\357j\377qn\221*H\322\376\336"
+	.string	"\311ZhM\341\374\346\277nn\023\354\005\215\r>\234w\332\370\341\260Y\0359\302\367\353\367_6\267\357j\230\347m\207X\022\234/\327\035B1\\!\364\2561\372\345\313:\324X\t\3019_!\364\277j.\360Q\306h\261\247\227\202\315D\007\316\377\325\273i\314)*\256\035eo%\020\n$\314\033\024\234\363\210p\252\334\346\216\340\374\013\247\177\257\270\331%\341\270x\021\241\313m\3531\367\266\021\227\334[i\364\203\bq\355\256\332m\273rY\n\030\273[\356\255\374]\362_2\273;w\353\256\\V&Rf\331\3447\262\273g\227\312\225\003\313J\310,\367\336\017\021w\267\364\230{#\273$\367\336\277X~#\273\253\345n\341"
+	.string	"\2657\262\206\005\3105,\212\360\355\275\377_3\267\314=s\321\334\273\273\274d.\336M\273v\327\313\257\334\375r\254\374\200\350|Q\266\265$(\377\027\314o\335\177\231\\\345\035\263\023\006\343\205\027\234o\230+\346w\314\245\333wL\001\270\366F\3361>m\366F\372\334\253\301\275\032\344\261\034@\322\320\374\353\245o\022\243_0>`\324\366~\340\374\253\245\257\334\035B9\\!\364\027\205\376\t}V\277\005\335a\313\177\263\334\267\333&\002\026\210\326\023\234\257j\242;\204\232W\b%\341\016\241\307\200\376\332\035B\357\332\265r\323.\270l\007\021\342\346S\331V\262\267\322\207\347\r\2227~8\037\005\375{\001z\377\356\005\350A\350\277\335!\364R\371o\3315\273S.\327\336Q{\357\f>z/\364\371\300\371B\271Qn\232\007W\312\257\223\273\344'R\271\225{+}p\0177hf8_"
+	.string	":\b\271C\234G\377z\200\232\177\177\327\003\364:1\372}\362\337$W\211\020z\225\245\334Q\366\336>\346\032\026\25168\343+\204\036\353\020\356\020\212^!\364rw\b}\224;\204\342\b\241?w\b\275\362\016\241\372\n\241gK\303\371O\030\377\200\223\353\374'\213\016<?Z\0026^\247\005\374\367\314|\272B\324"
+	.string	"An\230A\376{\376\314\1776\\\205\261R\270\006?*\302=q\205(\b\246\020\352\301\217\217~3\371c\022\"p\002\362\337#?6\2017\2009p\205\034\336\201\371\3437\251\336\341G7`\255)\223\207\331\343\277hpn\376F\355D\367\274\302\263\375\303\217\n\375\246\b\302~S\345qyv\230`\277\371\245d\216`G\032\323\013\355\216\300du\374\267\275U\376K\202u\354\002\241\362\244\210\321\304a\302H\201\203y\354\206\3537\267~<\354k\341?\367~\034\305\244\321\344\204&\364\237/\376\273d\274\033\376\201\247\300\367U\301\177^\340\277\033\376{\001\207\377j\370o\013\377\315\300\3519\377\211\3467\0230\3437K\320\372/\361\277\305\037\033"
+	.string	"\253!\301\177\005pG0\201,\026d\3747\004\377-\361\337\340ov \206\361.\375wx\231\376\313\266\377m\272\036\374&\214\377\035\334\020<\030^\2473\340?\355~lf\272p\246\342R\276\3747_\374\246\001~3\204\213\377\035x`b\375&\325o\026\340\307\304\003\375\247\233)\205\342\3074L\023\230QXH\022\343A\375W\212\211\374\357\331o>\375\270\204\271\1773\005\377?\340A\007\270\b\016#\300\177f"
+	.ascii	"\3278\233i\202\037k\221\371?\005\303\300,\210:\270\247y\342\034"
+	.ascii	"\374\247\020\246\273\376O*\377\315?\226q\317\003\377\023\355"
+	.ascii	"?\336]\007&P\350\230\034\224\340A\377\331\200\377wP'\360>\377"
+	.ascii	"i\376\267\373\177w\274\377Z\376\347]\217\203y\342\307\303\021"
+	.ascii	"\374\347\317~^\342\222\300i\031\002#\013\220\027n=\376\273\371"
+	.ascii	"\233\263p\364?\277\314\366\307T~\314\376\317\377I\3437\217\277"
+	.ascii	"\331\302o*\375&\322o\246\277\t\202\337\364\300of\3407-\360\233"
+	.ascii	"\024\370\315\007\374\246\002~\223\204\3374\372\315\017\277\031"
+	.ascii	"\200\337\354\360\233\030\374\346\206\337\324\360\233\031~s\350"
+	.ascii	"7\205~\023\3507}~\223\3477u~\023\3477\321\3374\177\363?v\363"
+	.ascii	"\343\276\037\243\375\230\357\307j~\254\367\343\263\037/\177l"
+	.ascii	"\346\307w?\026\363c\272\037{\371q\334\217\341~\254\345\307Y~"
+	.ascii	"\354\366\343\266\037\253\375\230\312\217\323~\354\344\307K~<"
+	.ascii	"\366\343#?.\362c!?N\376\370\307\217}\3748\354\307_?\276\361\343"
+	.ascii	"\032?\246\361c\255\037\313\3701\214\037\277\3701\326\217\253"
+	.ascii	"~\314\342\307*~\214\342\307P?~\372q\n~|\202"
+	.string	"\037;\375\330\304\217K\374x\003?n\177,\200\377\236?f\377\367\375\267\351\277<\377\355\371\357\346\177\336\217\215?&\376\027\304\177\016\377\331\376+\374/\345?\013\377S\370\361\360\307#\3701\322\2179\360\343\025~\314\302\177\331\376k\345\277k\377U\373o\t\376{\342\377\n\377u\372\257\317\177\365\177\201\377E\377\277\371\357\367\337\002\377\323\374\337\373\257\367?\005\377\341\376\003\340\357\357\357\357\337)\363\007%\340'\001,\373)\352\307\023\320\325\356z\232:\333\033(*\352\311\004.\254\2513\344\006\232:\333X\033\305\034\326\335\312\256\247\035\305\265\201v\324F\3563.\254\016SQ]XSgH,\240\251\263.\254}\326\265\177v\024\362JE\324\276\002\332g]h\366\031\027\326\317\324\031\027\326\324Y\027\334\265\261\342L\027\030\\\370z \2718\246\242vU\213-\344\325\217\334\224\222k\327\355}\243H\355\253-\2677"
+	.ascii	"\366\336\342"
+	.string	"\272\252C\312\270kPrUPS\220\\W\271\367\326\320\002*\007\327\216\222{\272[n\212\b\327\336D\240\224v\213\275\367.\300\223Rn\363\270rO:\2666\225\324\336\026l\345\336-\366~\272[n\357\375\264\367\006^m)\367\236\3613\225l\321b\357,\242\026{\353\311\212\324\3368\312\335\032\326\324Y\016.#+O\316\222;\205\362\351NQq\355\344\256\353\272\322gOM6\325\336\373\246\321I\254\027ylx\370p\3308\242\225:k6\320\\\3009\253\001\036\361\373\221\347C\357\310\013\312\025\234?\224#\017GL\232\032Qp\376\320\f\375\347\345oZ^b68S{\277\b\341\210\220\273-\276}u\005\3021\250\321E\371\214\317\0162F\225/8\037\203\031\375\337\264\253\3452M\222{\357\237\235;=*Qp>\2061:\327e\273\233v\267|\207\023\245T\236u\031#\246\016\347c"
+	.string	"\243\233\366\336\373\336\r\005\336\r\375\363\0301:N\222\364\b\203\363\377\034&\323\345\271\f&\177\271iYL\366\362,gJ\375\302m\301t\250\327\214\0303\370\336\340\264\342\254\222\\\262\214\262\230\334\305\253\212(\315\310\030\034;\371\274B\3501\254\351c\200\242\217aL\037\003\230>\206\027\372Bo\364\237\265\274)\271\220\270\311\362\374VuQ\234i\321\207s\306b\364\234\245\007\013\211\2234\234\201\262\333\225\273&nkH\276\222\303\314\200\304a\301\331\316\214\325\262\207\311\327\006\013\n.I)\270\244)\205\206E\017s\357oi\224\265\250${\230\177f2T\227%>\313Ov\313\2678$\313}\227<\313H/I5o\336\266(Ib\301k\261\306\215\027 \311\263\034\025g\227F\305\322.oE\322nI%B\2260d\346\025,L\226aYE\216a*\327\""
+	.ascii	"\245\305\234\243\343Q\205\215_\322\234\253\253\361\305\311\013"
+	.ascii	"M\302\200\331\235\251z\323\262\304\264+\203\"k\311\2333\313+"
+	.ascii	"cl$\257\270Ey\343\3425\326\303l\303g\3660\375\330,\337\340\222"
+	.ascii	"\300\271\301[\346dV\222\227d\"\331I\366\221\201d\264l#\227e\257"
+	.ascii	"|$\353\310c\331H\336\221\203d\261\f\226\2712\216<$\267\345\""
+	.ascii	"\371,\223e\265\314$+\363W\256\222\237d\263\314\226\221\344\033"
+	.ascii	"\371\205\374#\367\310B\362\224\034%\247e(YJn\222\255\344\265"
+	.ascii	"\234$\363\31092\225\334u\323rX\246\361\274\225k\230\311P3\347"
+	.ascii	"r\330\235\273u\2462y\202\023\032K\275)1\346\233)\347\344\307"
+	.ascii	"\034\230\260\254;\245\007\371\263\243\240\252\210\020\226gLY"
+	.ascii	"\222\3212\355\356\302\3140{\204\231}}K\363-\207\231]\234\210"
+	.ascii	"-\367V~@\004\004\003\003\323f\230\201\\w\b\275\336\025B/\204"
+	.ascii	"F_hN_\310\212\276P\231\276\020\220\034\343\317)\362T\206qq\\"
+	.ascii	"\320\302V\005g\027\3147+\252,\301\371B`\372\177\306\312W\331"
+	.ascii	"E\266\272i\371En\021\202E\r\243\374\"W\335Xa#\231_d*\021\312"
+	.ascii	"\306\310\304\366V\022}\360\301\007\037\234<\262\362\300\344\344"
+	.ascii	"\013\265\320\027\222\322\027\212\322\027B\352\013m\375\2406\372"
+	.ascii	".\357\020\212\301\025B\037t\247\037\304\246\037\364D?\350\210"
+	.ascii	"~\320\227~\320\013}\240>}\240:} -\372@f\372@b\372@;\364\201d"
+	.ascii	"\350\003I\351\377\244\321\377\031\243\377SE\377\307\210\376\217"
+	.ascii	"\016\375\237\025\372>l\364}\306\350\373\250\351\373(\321\367"
+	.ascii	"\341\241\357\343\202~\317\237~\017\031\375\2369\375\2365\375"
+	.ascii	"\0362\375\036 \372=6\364{X\350\363\354\351\363\224\321\347\351"
+	.ascii	"\242\317\343\246\317\003E\237\307\207>\217\226>\317\224\376\216"
+	.ascii	"\032\375\235/\372;N\364wx\350\357\304\320_\232m`&[\220\323l\313"
+	.ascii	"\030\322J\021\017\0331Pb8\377\346\332\232\271 \033\347\233R)"
+	.ascii	"\370\360YT_\362\354\212\314%{\341%i61\243\230OL \346\013\246"
+	.ascii	"\0213\211Y\305\204b\252\231I3\31543\203\230T\314#&\022s\212)"
+	.ascii	"\304tb\0161\317L1Si\222\231h\346\230Y\304$b21\313L%\346\017s"
+	.ascii	"\311M3\245\230a7{\230>\216\337T\234I\356\2554\332R{\243\"\211"
+	.ascii	"\317P\33466\311\277\251\344\336J\030\267-\016N\006\334r\311\n"
+	.ascii	"\263\352\312e)@\314L\2164\354fE\b--]&\016)\311\275\2253\336\222"
+	.ascii	"{+M)\346\016\223G\217\271\267\016&\311\275\267\221\016\264\244"
+	.ascii	"\022(\277\032\267\255\312\262\211\013\273\344\222\254;\245\347"
+	.ascii	"\334\233kK\022\373\300\272C\266I\356\2554\262A\245\311\r\023"
+	.ascii	"\307\224\245\331\177\311L)f\214;\345\312\2019@\t\227\245\362"
+	.ascii	"\277d.t\taU&\211\317\246\360\252\354\277\244\221W\224+ B\230"
+	.ascii	"R\314\247\333\326\363\244\334V@ V\346\\\340\333[Ydc\306\334\t"
+	.ascii	"\331\334w\b\ra\2156y\374\266\211 \003p\310_U\036\316\346\227"
+	.ascii	"\321M0\f\250\270Y\301\031x\205\320\353\240\321\327\361\242\257"
+	.ascii	"CE_\247L_\007\2076\271r\2148\257\0378_GK_g\353\347\234\321\317"
+	.ascii	"a\323\317q\242\317w\207\320\347\214\351\347\374\320\317\001\323"
+	.ascii	"\317\271\241\237\023C?GJ\037\347\214>\016\026}\2344}\0342}\234"
+	.ascii	"\037\3728Y\332daR\3354\"\263\305\034T\325\026\316\307\301\322"
+	.ascii	")\330\227\b\375\337%B\217\203B_\247\321\327Z\364\365\230.\272"
+	.ascii	"C\350u\227\276^\241\0174\243\017\274\242\017\034\323\007\372"
+	.ascii	"\320\007n\351\003[\350\243n\364\217\333\350\235P\244\202\024"
+	.ascii	"\361\243K\202%G\224>6&\336S\225\0338\363\235F\330x\361\300\371"
+	.ascii	"\250\2356\322\303F\260\234\331\344\352\002fx\030\313n\305ro\345"
+	.ascii	"\013?\372\324`<\\\006\237\301d\360\022\347\341;\274\207\323`"
+	.ascii	"3x\rFs\323\260\036\026s<\006\327\341\027\200\3346(9\330\300y"
+	.ascii	"\341060m\214\276`:S\231\004>\311qf\271\267\022\207\216\333\326"
+	.ascii	"\363\364\263\241\300\270I\202\b\201\365\360\213\333f*\223@(^"
+	.ascii	"*\226{+1\216\256\277%~!\211\207\230M\256\264\232\031\237\213"
+	.ascii	"c=\354\002\3462\233\\\215\360\232\3028\364p\2167\313\275\225"
+	.ascii	"\030\207\036\356\201"
+	.string	"\303\260\202\300\370)?\300Tw8\2648\344\243Wt\317\276C\350\225\273B\350Q\245\306t\030\203\301a\216\351\360\334A\204\370N\024\246\313{#\357\325\240\347^\rN\267\027\220fh>:\246\217\202i,\367c\"\270\b\366\242\265l\241Q\006\347.\032r\230\220\371S\202\363Q+\315\005#\301M\314&W8+r\330-\341p\334M\303\\p\031\346\202\315\360\226'\035\250;\r\037\3407+\272\266\240Y\213\246\022\226\343\b\316G\2676J{[\302\375\227\f\n\2155%\377%{\242\005\355\r\237U\351\242e9\305\310\333%s\202E\313\362\222EI\262v\005\263a,8\013\266\202\335\360\033V\303m7\r\257a*\307G\260\330\032\226r\265+\027\345&\311\336\226\037\350d\255M\325a\310?\335\350\237g\364O2\372g\235\376\031F\377\234\323?\275\350\237\\\364O-\372g\371G\335\200\211\243\202j\203z\t"
+	.ascii	"l/\006\316j\324\240}\017B\356\r\265\267\215\027t\266\250v\020"
+	.ascii	"\341;\312\346h\2376bf\306\n\316(\337\325\232xY\231\303\031]C"
+	.ascii	"\247\177t/\247A;#\307\002g3G\227h\3204x\2717T\bJ\250\272=\265"
+	.ascii	"U\204\343\344\214\031\212\274\243i"
+	.string	".\224\273/mW4\212\207\236\251rw\207\222!\342zB#\200+\252$X\276\372\226\334\241d\362\036\033-.78\177\003\037uu'\332-\333V\030\342rd6EZ\274\341\374\r\262\300\200A\305(\357\222b=o\354\340v\230\243br\234\264\361*\2033J\267\201\212.]\320/\267l[q8\242\274K\362\031i\033cE\356\350\027\265\235)\344\336\022\234Q/9\320\354b\350q\341\202\272\021\351\275\304l\213\316\327\226\230*1Y\262\240[\210\364^\002F\313\222\247m\311\034\033-G\267\250e\034uZ_8\243oojj\250\333-\333V\tH\336%\305\330\352\260\344\256\034u\023{#\005\006\316\350\032\332\266\363\002\007\237Z\033\233\031\344\205*\031\312\275$g\240\254\340$\330L\025^\2332*TP)\367G\t\005\006Hr\357\254\"\r%m\213\006\316\007\300\217\263\237\241Rn\331\2662"
+	.ascii	"\327]Rl\357\254\"\245\030yTiG\245\234)\243\332\302\006g\364\t"
+	.ascii	"\212\226E\005\0237(\032\032\305\212\0160\244\226\23564\362\306"
+	.ascii	"\240P0\025\223H\327\230\034\316\250\223\253\345\2672*\313\234"
+	.ascii	"\006\355b\325\246\017\347\003 \213\214\f-\273?J\2501U\311>$Z"
+	.ascii	"\027\264\311\321\2623:o\362d qF\225w\212\036\343\003#\2023\312"
+	.ascii	"\344\266\345\220\301\203c\363\033\033C\225\334\262mE\204&o\214"
+	.ascii	"\214\017\030CG\224*I\216*1\343\302\206\234\335)L\206d\355\340"
+	.ascii	"2\344\037\202\212\205pw\n(_b\313\275\263\212r\314\300\226QG\216"
+	.ascii	"\212\241E\324\234Y9\303\371{\250\221\3778<eXtP\031A\213<\211"
+	.ascii	"9\353\2013J$\313\336\2155\234\257\301\232\276\006\312 A\316%"
+	.ascii	"\021\327\023\232\242=0}k&\033*DT\340|\r\200|\035}\341\013\005"
+	.ascii	"\002\274B\264\241\242\266\r\036B~T_o\370\366\324VQ\322\216\033"
+	.ascii	"\\\320\037G\201\234\313\237\223\265.\264\307Q\037?\016pL\030"
+	.ascii	"\2702\234\337a\215Fy\034\r\373qN\032/\310\020\301\371\035\362"
+	.ascii	"\364\217\202\3758;`\\\272\344\341\374\016e\364;\204A\273\272"
+	.ascii	"P/\"\256\2475\300\031T"
+	.string	";\210\360\355\235U\304cfc)\006\325q\324K-\312\216>+8\2439L\26406\266\314\270\270\334\314q\001#\323\302\371\035p\324\250\201\332\350\260\367\226\332NbG\354\2007\242\306\346P\033\247\027Z\345w\247\206\363;T\321\240\301&/\217\225-c\260\321\322B\223\227d\202d\r\316\317\240\016\225\201\312\b\302\226\301\026\0300N4\234=\024\r:\206\205\215?\264\027/\324\240^\312\244\226>\226\340\374\f\224\350\037\305\372MC\261r\337-\333O=aj\304\230\221\227mc\033\347g\240C\377\250\325o\032j\225\337\212\270\266\213\016Gr\364\255\361\031a\323\352\302\371\031\250h\321\"\213\017\226\"J\332\340|\f\370\364\217\262@Yt\221A\247\320)T\305\032\224\347K\206\033\r\234Q\025\347\034\221\037i8\037\203-\372GQ\370\241Ry/\357(\033\351\"\004\232<\f\240\350c D\377(\322\017\205\022"
+	.string	"\0326\f\276\3641\230\361\207nL\327\341I\271\255n\032\344\335\226\030\006*\364/P\323\346\007\021\342\364;\335`\272\274\263\366\223\036\001\320\314]p\247\177\001\227\276>\r\320t]`\306\307w\352\351\247\013\334\312L\036aUI\234\177\301\0165j\362\025s\212\013\231\243"
+	.ascii	"A\206\334\021\301\211\373\262G\206\3639\360\345\345\235z\027"
+	.ascii	" A\3360ex\234I\363S\357\374\341B\031<\234\277\267\001\337\230"
+	.ascii	"\0358\237\003\027<\274s\031\364\004\355oi\322}A\263Z\336)=\232"
+	.ascii	"H\341\300\371\034\316\364\177\2269\311\234f2\236~\272\322Rx\224"
+	.ascii	"Yr8\242\317\001\254\256\356\274\323PCG\215\016!Yp>\357\316\364"
+	.ascii	"(q[\262\301\371{\031\357?N\320-\214\017\347spA\214\230\223N\217"
+	.ascii	"\251\2214c\266\307\002\347s\210\372\362\345\244\323Oir\274@="
+	.ascii	"\225\201\371I\247\346\365\264\245\207\3639w\267\236;&F\232l`"
+	.ascii	"\343\305\213\0132qqg\033\023\234\275%\310\r\234\277a\013\034"
+	.ascii	"\334}C"
+	.string	"\244\334O@\265\274\rU\264h!\003\214S\263b\216I\226,q\311\252\0371\2208\177\203\0177\267\263\r\314\233\216\013-\350\262p\376\206-+V\3166$Bt\231/qE\330~\266\355\244-\371{\333@\245\246\226\323H`#]p0\204\315\2027z\312\224\223\n\316\336h\212\216\314meQ2\2053\225\234&\247l\r\332\024\316\267\300\f\2243\r\312\211\326\301UQ\224('\032\316\276J\243A\\W\017\013\2676*\234\321\206\344\240\302\371\026\\\321\267\200\b\223\323\t\223\363\f\335\373*\271\254\256v\226\013EJ\345yv\367\325\336Y\013\220b\265\334Y[E\347\230\033}v8\377\247\331\317373\305F\"\006\347\263\254'\211\226\265\304\371l\202\351\256\030\031\023\205\363\367n\333\177\2343\207\2322j8\337\002\033\372\026<)Yr\375\362\006\373\331\373\313/\251F_\203\235\376O$g\217s\354\3729"
+	.string	"\305\324\336.\212\376\2724h\321\327"
+	.ascii	"E\377\347\221#\267\215h?\241)\032R\366\006B\002\360\210\310\341"
+	.ascii	"|\rA\210\234=\316\"\270*o\260\215D\206\360Wv\267\305\247!K\237"
+	.ascii	"\310\215\376O!Br\032\tp!]p\340\205m\214\254g+E\013?\234ODF\037"
+	.ascii	"\323\3353\231\304tD\373\tM\bC\220^\364\177\376\270i\347\217;"
+	.ascii	"\245h#\221\034\004\311#J\323\377\351\3437\355\364\221\327\024"
+	.ascii	"qm\027\003\bbe\316\205\323H\222\273\2541\036<\316\260\016\177"
+	.ascii	"\310\357\375\f\273m:vXbKp>Q\016\034\307q~\335\275\367\316\332"
+	.ascii	"Oy\007\3102w\267\305\267\343\347\027\035N\0205r.p>\273N\257\377"
+	.ascii	"8;5\210\240\241\341u\352`\363\244I\024\237\306\233\002\322\207"
+	.ascii	"s\016,F\271\211z\330\250hR\206(\305\215\033\030J\303\315)\277"
+	.ascii	"\264\250\300\371\031\324\324\250\201\255~Fm\035K\222{g\201\300"
+	.ascii	"\023d\314\t\024\316\317\260\324\377I#\355\244q\333n\331\266\312"
+	.ascii	"IQ\366&\273\301\023\303\003\347g\230\242\245\205E\002\023\375"
+	.ascii	"\2372N\031X\312\234\332\310.\022\202\314)Ax\006\"0`\3347\027"
+	.ascii	"hod\335\232\016\375\237/n\332\371\342\2761\025\020"
+	.string	"\244,\203\f\375\323\352\236XXW\313?\233\005\224V2\203\324Iu\317\252\233vV]-+\267\017\021\272\356\266\304\366\325\006\341\025\344\351\253\335\276\240\250\275\221\033\230a\302\\y\302\371?Y\334\264\223\305\365\313e\373\th\246\226\005\202\016\0251!+\352R\2448U\340\275\367N\002\241|\205-w\326U\321\177N\375Tq\006\373\251I+\202\363\3672\f+I\342\330P\240\350\023\341\007\034\2202(()\311\235\225U\204\263\027\327U7\344|:\2370\224\004\366\336O\312m\305!\013\362n\213oge\025\001\275\274X\033\202\363+\260\241\377\374\227\226\377\256\036Q\331vq\202\r\013.|{\277\201\320\001\2646-\234_A\224~\366\313m\236\335\244e7\030\ng\357\275\263\026\020\206j\271\263\262\212n\027\f7;\234?\204\247\377{\374\243\033y\265\367vq*\367\025\324\016\372\337\337\363\336\242\237\347\232\027"
+	.ascii	"\377\363\336\377@\322\336(\342\370\366\336WO\017QC\322\350\260"
+	.ascii	"O\271\275"
+	.ascii	"\243\272\236\034\320\205\025\325%c\352\254\013\013h\352\254+"
+	.ascii	"m\020\204\b-q\005\036\255\303T\003j\233\216h\032Q\201qI\210\203"
+	.ascii	"\203D\\S6'H\\\333\341\312D\"\030\364A"
+	.string	"jY\022\034\317+yP\227\326\366\303\221UK\254\354\321q\035\016\327%t\230\022\223\326\025\222\210k\211U\025\252#\216(4\261B=F'\230\34044\032K\300\320\256D\024\210k\032\001\236\241\023T\250@\273\022Q\020:A\205\n\f\255D\024\216V#\007$c\0052p\264\0321h\203k\253\223\266C\325\004\237V\215@\023\3733L\205\307v%\361\201\211\230D\200&&\342:$@\001F\b\216@B\323\007\365\210i($\256\037\330#\323\207\017&\212\254R[$\002\221Ru\230\333#\261(<\221Z\342\312\016\321+y8*\265\351\222\005H\254j\242hD\325V\035\032\227\212\"4H\333\324\204#uH\"%B\340\210\002\206$\342\252\202pD\273\022\327\037\236\021G\266\330\026-p\\\177\216kS\t&\322\016\354dhb\205,z\3749\032\026w~\202D\360p\264@\323\210\243u\230\226\300\220S"
+	.ascii	"\017i\233\232\360\023\302C\220\316\b\036V\036\"bqm\325\243:\202"
+	.ascii	"\303\225<$\255HD\025\200\216\352\n\"Z5)\303\216\001<4\215h\217"
+	.ascii	"\351\260G8Bm\323##"
+	.string	"\223\220j,\016W(\3012\211`yL\244\254\216\211tD\253&\365\034I\224\020\344\323\252I>,\017\253\222XbJA8\242U\223~D\024[\246\f\206B\360\320\262\251\321\303\b\3410\025r\310\t\301\203zb]\301\250\266+\b\331\035\037#\017@CD <\264D\246\242\b\243\332\256`\201\272\264\266\306b\261\002G\253\n\255\232\304\246-\220\t5\205\264MMh\032q\\u\3246\035\241tTY$uD\323\b\fKj{tZ\301g\304\361\250\n\213\254\261\002uh\\J\227\230\204\302\022\216)S+,\341\347\274\222\207$&\022\352\321\207\243\341\312DB\203zT\264\300q'\347H\242\004\037b\021I5A\310\356\374\254&\230H; tDL\227\226\212\"\204,\016q-\032[u\005\265M\207L\302a*\034jA\2702a\300\347x\\)\320s\202*LG\210h\211*\3132\t5\244\255\372"
+	.string	"\f\027\256\254JT\223\364\0130\002\001F \241\tx\022\020\020\002\002B@O\002\002\214\214\0200\202\221\376\bFf\333\266\301\243\005\202 DH\333\324\004\2376\330\3526-\016\221\316\226\270\232G\021B6H\233H\235v\216\210)\211\243T=\002R\223\210\251\22208,*\005\333a\212\341H=\262j\t\2255\221:a8\006U8Z\215;'\224\202&R\247\236\023J\301\237\023JG=J\302\266Hl\257\344\341h5~h\225\222\326!\022\321\t\367\030D:Z\215\250\n\027\205k\302=Z\215&\220\n-q-\252`d:\"\256\033\310\240c\"\355"
+	.ascii	"\323\nG\253\261G\035&\021K\030\252%\324\241O+T\221\220\204\324"
+	.ascii	"\243\342R\260eUc\223\032l\207k\033$\026O\254lQ\211h\204\211\324"
+	.ascii	"\th\250\n\205%\250m\312\366\020\213k\273\036\211)\313\302\021"
+	.ascii	"\233\232`\213'\034\251*\322P\273.\255\025\3109\241\024\004q<"
+	.ascii	"\246F\023\305!P[\354Q\215N\355OPS:T\331U'\211\230\022e \256i"
+	.ascii	"\022\320q)x\224\252Ji\013\305\3420\310\252\301\"+L5\020\3274"
+	.ascii	"\351'\303\221D\032\004\"\350\204R\220\270\236PZb\325\366\b\303"
+	.ascii	"\211\225MU\342Z\201\366\310t,\026I\004\221\220\264\361\030T\327"
+	.ascii	" \022\022\020\022\022P\013\253\361\030DB\352AB\372)\032\233\324"
+	.ascii	"\240Z\202e\022\022\235\216\202\216D\325\270T\024\006\223\322"
+	.ascii	"c\260MI\224\030B\242\300\260\210D\001\3658dRaX\024a\"u\342A\242"
+	.ascii	"\200\320I\204\211\324I\267G&V\211\005\365\230>\300D\352\304C"
+	.ascii	"\002\225E\n\252\307!\223qi\r\"!\005-8:\245&\206i\220\332\246"
+	.ascii	"l\320)\025\252G\301\037\265\304\332\n\325\341\260(\f\252L\302"
+	.ascii	"\243\312\002\021\3274\t\203\272\264\266\352\211\365\0304Q<\""
+	.ascii	"\256&6\234P\n\006\331b\233\226P\207j\320\225<4\261\037\222\214"
+	.ascii	"BMl\2161]\022\262'\253\036\255%\212\254\361Hmb\207\351\312\252"
+	.ascii	"G\240&uh"
+	.string	"d2\001i\230*\345\250G+\313\252%\212A\342\332\241\r\002\223R\026\212k0\211ih$\002j\325\243\312\036\021W\022\3016=\006\227\230\330\266\005\325x\334\260\243\016SaN\313\252%\210\253\220=Z\227N\342\272\244[\020\252J\302\246tI\373\034E\f\323\022\304\342\332\246\303\242\221U[\"\nB6\003q\025\252G\246`S\272\024lbu\206*\221\230*\t\203MLi\260)]\3629\262E\226U\207\320V=\"!\025uT\243S\013\244A\210\301qmJ\203\0318 \005\213-S\032<\006\205,\321QqeUc\020\3118\f\252K)\213\024\024\262\307\340z<\262\032\216\326`\273\022\231x@\f\233\330\243O{L\221\202GL)\211\340\221\211\304\261\207%\036\203MlP=2\005\221\216\254\320\247e\213\2550=\341xT\211\305\226)\305p\f\n\r\213\305\007\004\317#\365\304:L\327v%\242"
+	.ascii	"\324\202p\302\307`O\b$\260\021\t\f\202\0046J1\210\024\0335a\020"
+	.ascii	"M\330\310\t\037\245L$XI\3540\005\217\355\225<| \026\227\226\212"
+	.ascii	"\302\r-\334cPGm\323\366x\032\265F\034$T\r\242@\344\023\3242\031"
+	.ascii	"\211\353\0065h\302\005\252\321\tC\022qm[u\205\fNB\242\312D\002"
+	.ascii	"\225=\001\t\251\3302\211PK\254mZbe\325#\r\307\f\250K+\013"
+	.string	"\352R\312\236\240&\245\254Z\"\rj\257\344\341\030\024\262\034\232\322%\363\030d\201U\333\341zB\022qUj\213\305\245\025\204\354\206%\246\243\331\022\231\212\302\223\270.\231I\304\225\270\246l\253\217kS\tIL$\324#\034 \361\004\247\241\321\230\356\264W\362\300\301\213F\225\375\320\026\213\354\007\0356U\022fu)MA\035\256HE\326\250s\f&\255H\304\242\b\265MG\f\213lK,\n\205\216G\265MG\bY`\321\330\004\001!\213\036\3256eO\325\350\324\n\265A\022Z\342\312\004l\211\252\220U\215\301a\333\026Y\245\266\20268\202QK\\\231\364\215\214Dt\310@\n\021\320B\017B\366\203\020\351\003qM\227>\b\331\343\007\017A\355\272\264\016\203j\233\2629\377\201B0T\224\230\035Ap\356A\215\370Ha\005\230\314}x\316\006\0329\340\217\313#\313\023\017\234\317\001\021\375\003_8U\360"
+	.ascii	"\201r\303\213\2173L\347\207\222\rE\017\364\313\227\220.6\302"
+	.ascii	"\304\370L\301a\025\206\307\371uc\bq\303\005\226\367L _\372\236"
+	.ascii	"\276\310\230pjE\216\3548\365|\212\370\330\341\305\013M\223\203"
+	.ascii	"\366\207\246\f\316\300.3\005\177\177\177\177m\366F\002\2730P"
+	.ascii	"\0070\307\201]\367\001\326\211M!\321\f\264\001\264\001\344\272"
+	.ascii	"\373\352\210\213\273\255\033\007r\255\371a%\216\203\032J\235"
+	.ascii	"&\344\254\013\347\3374\340\326\211\366\200<*/\032\250\222\323"
+	.ascii	"M\312\023\330\f\264\314\\\033\363\024\246\205J\311O\346\244\220"
+	.ascii	"d\271\315\245\361\013#c\313\020\244\330_\f\354\205\310\030\257"
+	.ascii	"1\030\347Y\225\231\"t."
+	.ascii	"d<\035.em\260\274@\305\334\374\350\264\340\f\254\002V\001\261"
+	.ascii	"\356\025\001\224P\315\305\340\273:\020\313\347\356\313m\013\316"
+	.ascii	"@\253\2147\367\346\2055\033\260\001N\001\247\200T\230\213k\357"
+	.ascii	"$0-\214\222%\220\305\201Tn\247T\031\2759\234\201+\356\346\207"
+	.ascii	"\306\204\016g\240\212\273\001\341\272\344\270\261\001\236V\022"
+	.ascii	"\201\"&F\n\005\002|\302W\305\005\212\354\025\244J\022`\324\271"
+	.ascii	"\354 \005\325\032\020j\212\f\024~RpV*\261\262\352\301\005|\312"
+	.ascii	"k\326V\220\361\300\031}\203\376\035\270\017\334\030\270\315\277"
+	.ascii	"?t\t\035\0244\206I\250\023\342\244R )1\210I\205\024\032\232\221"
+	.ascii	"\331$\351c\025@0xD\"\224\252\363\354\035\023\200\203\312\312"
+	.ascii	"$\212 G\231bfFDDD\222\024\224\324Hc\377\356\244\r~\177\013\030"
+	.ascii	"\005\210~%\343\372\236\255\215q\214\236\315\363\002Z\r\002$\303"
+	.ascii	";<N\377*\214+s-\324Z/\331!\356\334p8\002\rcw(\r\007\366b^;\373"
+	.ascii	"!h\301G3d\355\233\376\017\352\fU\221DY\334\rk\303\347\230\363"
+	.ascii	",\212,K\2426\353\313\304\322*\300:\227\230\027\323\t}\345\222"
+	.ascii	"\2574\245\356\364\301c(2\360\326\206\306\236\373"
+	.string	"\331\325\202\020\213bkl[0Z\270\355_\005\331\314\b\260\f\216\004\275\323 A\2340v\335\\\211\034(\214\252\332\251V\321\\>\311\326\002\302D\262H\214;c\260\273\020\300\260d%\001|\003\371\357SR\3600;\256\313\262\342F\322WL\201P\t.\332\027\332\274\017\006r\377\350\222\346\337\200U\305M\340\327\323\006F\"\251\243\f\t=\022`t\305\004l\342\227\266\016\360\224\340\201]V\263c\242\312\022\0171,H\341]9s\352\275\\\222\360\221\013M'\277\2138\005\2526\201\267\205\"z2+b\312 c[\237\301\025Y\033\036J\367\221U\024\301\305\211\031k\270\026\267(\232\206^\246\025\024\0341o\223\220\226\374\367\031}\323\240\033\303\350\325\017h\302\253\321\304\345Y\263Q:i\302\2475<\004\177 \2469\346\200B\306\350'\306c=\007\004 \334*D\031T\221\223\301+\226\352\021j\273,1P"
+	.string	"~\016\023\334\270\202e\201\3345z"
+	.string	"1&E\222\363N\276\311\320\f\244)\t2\205\314\303\227\".\342\243\t?\300\\\025\007\322\353\314\006\335.\341\253\306K\236\202\376\\G/\270\316\212\265_+\212\3409\327{N/\016\013\363\"v\214\362\327Q\332\354\320\371z\022\036Eb\213i~\226\253\275A\277\343\327\370\311p\243\025\034t;"
+	.ascii	"\343/\252\337\3100I\372\020\242h\346J\251#i\302C\343\241\344"
+	.ascii	"\200\323\266\346\007\356\231\007\246\357F\337\206\317\326\343"
+	.ascii	"\027\376g\302,\266+\021.w\204m;.l\313\007\006\206P\\2\024\013"
+	.ascii	"JI\340Y\322\031,\236%\250\\\223v\f\t@\343v]\"a]R\342\204\316"
+	.ascii	"\262{\366\001ib\002IWo!\304\3544wI\247\337\b\363J\t\234#\336"
+	.string	"\305\001H\370\212\036Z\254g\325\374IO\244,6\3732\205XT)\2027\025\313?\205F\031R\377\003\341/\346TP6\344\252Sa\204\353OnG\361mBx\210\375\352\\AKU\204\340\2774\2228,\213P#e\362u\240\n\367&\215\374\r\376\016\250\275R\214\223\300ji\021\261*\326\006\362\205\263h\365\025\346\002\302\"\faU\032\023\277\235*\256\030\235\367\2758'\033@\363h\356\370\215T`\241x\336Bd)I\001\246s\227p\364\264\bK\020\006I\324Q\037o\021M\030\033\370&\222\256\202i\347\221\\\215\316%\026+\207\334rWO\3551\035\256\036Bj\236r\n\235\217\313\261\022\232\346mL\340\206\254@\353y5\\\017\251\244\330\004\206\022\300\fo\256\033\rN\307\311\367\337\273\2574I\251\021\357\331\370\201\034\372\301\031Sy?\204\224v\250\244\210\320\243\264\3468=\224C\265\205\3768@\323"
+	.string	"\025\240\016\274#\372\314@\021@S\314\023\337hL\006F\242\r\335\021\273\tQ\246>\0249\264/\021\363\336\240\233\252\237y\315Q\222\335o_t\341/\357\334\375\367ZI0\320\241\t\227{\341\212\3731\022K\037\316\027\352\"p\232\226\217p\034\340\373\343\226\365hIg\335\241l=\2206\263\254\217Z\214pkfp\3128H\325\330'\253f5\373Ys4\317Tt\252BvF\251m8\205W}jf\370c\204]\001"
+	.ascii	"\222\023\240\020<\303\216T\332\274\177\273\377\307t"
+	.string	";\362\206-S\202-\3233\261\032x9d\200\334\207\230\263\200h\303\216+*`\306\271\211\352\205,\331\264.I\r\033k\f\204\2329\246:;[7\216\253\363\355\333\221/B\244\020@\350\242\307\343\235\"\230C\217[\266haXS\3403\225\020\001\214',E\303+\225mW\266i\374\024\335\036\245\365\273\220\200\322q)\201s\215\325\335\370\357\005\305\202\316\"Q<\334\020\r\236ci\275\307\321\253\202\202\"8\221\277\251\370K\272!\334\3340)\352<\r\006\247\177\0323I\204:\321\225S\340j\233\336d\325\235W\004\351\341u\036\254\322/\312ZL\2677X\201\tV8\024&\310\241\374\347\245\3013H\375\006!\340\232H\355q|\342T B1\365\374\"\017@p\013\312\311\013K,\251\241X\346\022\205\306\330\350*7\251\257\222\005\314\034\326]\353j\201?\330P\331B\371\255\254\032U\331\244Nd\205d\357"
+	.string	"\0236>x2\213\213jX\016{W\362'\3012\375\324~\207\213\371k\362\310\r\247\275^h\335\276\374y\217~.\245"
+	.ascii	"\250=\025\323\357NC\270\265a\036\203B\373_\254\013\311\n\210"
+	.ascii	"}\034?1P4\030|\335\224\021\217E\311\030\3262\237\007\250\340"
+	.ascii	"\250-\026\322\245\0305/\256\205\332\310^\t\023\255\301N\335\265"
+	.ascii	"\301\331\0301\324~i\3415e\266\262\271\274\327t\3224uDS\371^B"
+	.ascii	"t\362G\023\323\035\211,\002\036u\b\310\2518N\313\366i\325\001"
+	.ascii	"\334\377\2653\223eMx\331 \237\263\342)\330c\312\322\r\b\274R"
+	.ascii	"\270\200\317\343\275yl\257w"
+	.string	"#\030\024\247\036\3244\253\363\031\217\374D\242\316\323<\242\031{b\377\320\277\301\276'q\270.8\302\253\2748\343\254\205\317\366N\225\"\210TW\244N\032\021eV\311\b\355\302\240\216`\0050g\220o\261\t\255\033\257G3\020\320a\234\362\200\t\b<\316(\3338\212 \240>\202\302\307\322QX\242f\315\213\205\346\023\311\342\213H \312(\316\020\356\2161\363\334\"x\313p$r\033w\"&\204>\377\004M'p\027\2718] \337H\265\2439\327\032\375\021\264o\222\220H\025\004\3775<\016l\363\033\251\273\006\240I\365x\244\024e\317\257\321LhA%\331\240=\325\242\245y\267>\037\215\026\274\n\310I{\273K\241,\345\202\320u8$\324\326\365D\215+`\214\264\244.\306\350e\023\227\300/\243\236ZS\271\322\323I\330\025\315\003\305g/\274$\035%\355Ul\376\222E\342\023+Z\2259\255\207\341"
+	.ascii	"\344\324\277\036s6\205Xi\006\234\f\227\335N\003\306v\030\246"
+	.ascii	"\200\354\330F\t\324\202E).\007T\021\n\271\353/\311\277Ba\306"
+	.ascii	"c\271dU\276odi+\274\032\321@L,g\337\333\316\242e,I\027Bz\335"
+	.ascii	"\002X\317\034\337\r~\356\322\323\017\016\344Y\304x\246n|y\240"
+	.ascii	"u\200\251"
+	.ascii	"\r\256\314\237~\017`\315\0363;%"
+	.string	"#\371\203\216[\220\005\004\355-\001\017[\251\365\001^\223!g\3319\326\005T\274\177\032\362V\251/\b\320\212,y\272P\203B\2327\\\310\f\204\364\312\240\264\376\337y\3741ik\310\240i$\344\353\tTH#2\353\362C}\306A.>\234O3\202S\324\202\304\241\207\372\0346\026\303:\257\375!\271*W]\233\333\330g4N\201\301\205XM\247lK`\223\275\362\260\023a\003(\223X\341\334\002^\304\202\206r\373\220\273{\3667\304\377,&\231wW\222\332\234/\300\330\030O\356\243\247\246h\202V\275s\333\207\353\016i\214\034\372;\307\003\366\323\260(:\226,\013sI@\236\320\351\261\345\204\263&\315\232\303\203\303=\377\375\313\206\265\227j\r\374\217\320N\022\365k(\022\247k\311\332\247\237b\t\357\024i\"Wwa\340\336\246 \343\177\352D\373\202\021\350\300\224dzHG\230\377\365-S\257\261"
+	.string	"\005\321G\205\326\376\302\031-.oZ\\^P\212\303\353\f\004\n\330\276\351\274\353\177O\005\325\215L-E\243\375\361_\025\337\233\206c\361e}\204\025\353y\346Z\205\210v\355\034D1\036\345:D\222\227\370\t\016\346j!!B\260\345F\005\2238\001\003>\365}~\234*\344sN\377|xI\230\b\262e\217\237\242\226\177\240\217\027\264\351\300\372K\271c\365\255;\2029\013\006d\251p\243\363\311Y\361\301\364j6\307\224\177\31378\245?\343\353"
+	.string	"\177\2237\274\340\304Q"
+	.string	"W\242"
+	.string	"\"+\035]\021w\245\204\256\340\363\025(\261\036\2259\246\027\244\321G\004\257\004\270d?\335\336\366\231m\314&eQl(\207\264\356\335^pC\267\222\303\307V\200\240\350+\276\002Kf\237\361\021\216q\313\352\240\363\017"
+	.string	"\0051P6\260\227\246\314\357~\303\032\326\241\205\341\205\263\365Wt\007*\220\203q\342\345\275\363v\331\340\227>\333[\266]NY\256\031'\264^kRa\004\275\335\326\331\033\200\376o]\323\260\247\245`T\217\331\352\333GC@\367:\037~\354\342\340R\200\250\211>\202\343\320\374\275\032\364c_\376.\232R\0279\263\261\214y2`502R\316\021\0212\031\013\310\325h\230"
+	.string	"\205\261\022\017*J\037;\336a\371\216\262'F\030\360\320\3309uX\215\213\035\341R\300.\233\301\212Hw\370\230\347\355\013\0027B\022\023\276\214\225\2531\344\nt\200\341\335\225<\300q\221\233\310A\376k\204'\025`\3779\247B3I\327\321\372\233,\215\331k\251\323w{\035\334\200\311?nY\232\017Z\302P\231Y\200m\257h\032\355P\267\326\207\r\\\325e\344\224\301\202\253*\273j\217\351\227\203\263Y a\324\207\002\201\265\257R\2178!J\251\301D\325\273\346\276W\204\2460`\025U33\332.\032\360\020j\336\375\22570'\304"
+	.ascii	"b\252\362a\013r\245\004\203\024ULT\260)\361\027@\026\336\362"
+	.ascii	"\233\253p\361\375\016xgQ\375M\330\327e\205{SH\227\307\024\244"
+	.ascii	"t\312N\221h\367\314\302G\266xA\215&?\0179+>\r\272\326S<\036$"
+	.ascii	"\205\347O\362B<\n=\013\021P 4\304\357\244\t\035\377\202\246J"
+	.ascii	"$\271i\007\037\240\1772\035\024>\375m`\277\006u\336\n|\001\310"
+	.ascii	"\332r\250\021#\304t\367\277\240\343\275t\t\350\207\222\322\225"
+	.ascii	"v\213\322s\300\th[\322x\205\324\223(\236;\277X\272\023\023\371"
+	.ascii	"\213\204\201\271^l\213\351\01749\b\036\334\226s\337{\316\337"
+	.ascii	"qN\034\016\254\243\006\352$\345tb\330\303+\377\225\336\r\210"
+	.ascii	"\317%\354&\202_=\237\212\342C\3513`\336\320\356\303\332i$#\232"
+	.ascii	"2\232\371\203_\007\003\242\035Z\232\325\272\210n\026+\262Y\023"
+	.ascii	"\263\270\322a\031\201Q4\177I`\263\216/\243\314\025\344g`e\377"
+	.ascii	"\370\372(\032'\006\373\305\016\243P\037\376L.\346\275\206\307"
+	.ascii	"\037v:\344M\317[\3509\270B>\331\342o\234\376\214\f\1775\3167"
+	.ascii	"z`}\331vT:\321\373I\273\241\350\236\255y\277\202\247\375\310"
+	.ascii	"\246\357\337\232\312\375\253y\217\213\313\274\335\363\230k-b"
+	.ascii	"Z\266k\203}\245\371\340\317\366~\230\261\2337\372k\244c]5~b\304"
+	.ascii	"\272\001\200}\374\231\032\t\f\n\205\374\376\374\025Z\276\330"
+	.ascii	"|\366\235\353}\362W\363\277\245qh\326\333F]\332\260S\373KJ#%"
+	.ascii	"\377D\331\377tk\207\245\365c\360\343\r;>\373\004\017\217\274"
+	.ascii	"^\370\350h\304'\002\017\212w\324\250y\260O\2029\035?s\200\357"
+	.ascii	"\037\037\206\351\rT\360\311\346\0314_f\310\"\252\356\221\230"
+	.ascii	"\303\332\357\333\345\277\360!\303\203\202\315\003\266W\376)\356"
+	.ascii	"g\037\3121@\235\002\264\265\316gw\031\320\013\033\0170u\013\r"
+	.ascii	"'\256\333\003h\033d\035@\226A\b\260/\253\213\214\317\251\272"
+	.ascii	"=\341\005\222\227\304V\310\350\330\225\027\300\335\3415\032\\"
+	.ascii	"(\237\2104\260\267\302\365\013,2\216\271\366\034_\"\267\002\213"
+	.ascii	"\357D\360\213\374\001\322\336\303g\233\242\007 /=\254I\035D\263"
+	.ascii	"P\200!w\017r2\242}\247\352e)\316<{\200\215\240\034X@\215Z?\370"
+	.ascii	"H\331h2T\344\361Wk\314\233\212q\215`W"
+	.text
+	.section	.gnu.lto_.symtab.625e87025f715dff,"e",@progbits
+	.string	"applyBetaflightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"applyRaceFlightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"applyKissRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"applyQuickRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"applyActualRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"interpolationChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"getRcFrameNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"getRawSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"getRawDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"applyCurve"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"getRcCurveSlope"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"updateRcRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"getCurrentRxRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"calcRcSmoothingCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"rcSmoothingSetFilterCutoffs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"rcSmoothingResetAccumulation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.625e87025f715dff,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1219 @@
+	.file	"rc_adjustments.c"
+	.section	.gnu.lto_.profile.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`\230\002-\t"
+	.string	"\004\n\214\003"
+	.string	"\022"
+	.string	"\331\226\256\205\n\036\002"
+	.string	"\001\003\004\005\002\005\001\353\252\315\223\t\002\240\342\234\212\n\003\004\310\247\232\237\b\005\006\007\243\274\344\244\007\b\002\006\002\007\002"
+	.string	"\002\007\002\b\002\007\b\267\332\202{\230\001\002\006\002\t\n\013\002\013\002\006\002\f\r\002\f\013\301\262\277\364\004(\016\002\017\002\r\002\020\002"
+	.string	"\002"
+	.string	"\016\307\333\224Vn\r\r\017\206\340\336#\020\272\305\3543*\006\002\021\002\022\001\022"
+	.string	"\002"
+	.string	"\022\341\276\210\271\001\002\023\206\271\335\257\r\024\313\331\240\372\b\025\321\316\352\310\n\026\240\342\234\212\n"
+	.string	"= p\202c3\252\016H1\005\336\n0+Av"
+	.string	"\3631\263\314?d\356\024\021\344\200n"
+	.string	"\006\223\001\266l\225(@)\f\232\2624\317\246\221{\004\230H\340\001\002\376\232@\306\006\213\003\336\t\300\270\276\302\300!\013K\260"
+	.string	"\b\302?\211\rP\365\3026"
+	.ascii	"\006\2623\200\271f\025\303\214a\017\034\231\007\002\330\006\007"
+	.ascii	"\177\234\300\272f\017\272\353~_!\2128\317\310m\203\273^\364\361"
+	.ascii	"\356\217-\300\335tH\273C"
+	.text
+	.section	.gnu.lto_.ipa_sra.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"=\003"
+	.string	"4\003!\001"
+	.string	"\t"
+	.string	""
+	.string	"\001\007\002\001"
+	.string	"\001\b\003"
+	.string	"\003"
+	.string	"\001\013\002"
+	.string	"\020"
+	.string	"\007\001\001\001"
+	.string	"\001\003\001\200\004\001"
+	.string	""
+	.string	"\b\016\017"
+	.string	"\020\001"
+	.string	"\022\001\002\b\023"
+	.string	"\001"
+	.string	"\025"
+	.string	"X\004\340\262\302\223\271\341\252\214\255\035}\030\260\007\200?\326\204\fB\022\264[8\304\206\276QX\003\206\201`\22598\200\025\b"
+	.string	"b\304\f\243"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.inline.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`p\nM\""
+	.string	"\006+\216H\3200'\035\3304\337\215=\017\356\360\234\312Me\376\r\301\202\316H\r\304+\355x\222o\365\233G\345\274\245\325\311Y\013\324\265.\207\225,\017\344\227\270\304\013u\b\237\350`R\002\320\212\307\225\205\336\206j\221\223\261w\222)y"
+	.string	"x"
+	.string	"|"
+	.string	"<T@K.\234\316\206\360\334\356R8\261\365HIn\243\366\211I\001\002\003\004\224\300HF^."
+	.ascii	"\240H+\344[\201x\037\235\307\224We\320\221\274F\355\003:r\t7"
+	.ascii	"\261\312\234\204\016\324\214\023\331S\333\237\264grw\267\273"
+	.ascii	"\355\3275\346\343\356\202|\037ji;d\332j\263\214\322\326\226\307"
+	.ascii	"\375\331w\367Cg\323\310\r@D>*\2675\202\344\231\322AB\2602\210"
+	.ascii	"Y\263,\263\214\254\343\304\323f\r\245f[\261y`\250,\243\375\222"
+	.ascii	"\335\233\347{\273\267X,\266;\372\341\356\2509\234\3133\b\341"
+	.ascii	"\370i\371\232\303=x\320\005*\035\267\210\263\210\363E\234hQ\364"
+	.ascii	"E\027m\355\242\3714\224\332\032\245\346Y\363\212\315\236\315"
+	.ascii	"[{\340\032\f\327\241\312^D\303I\247\345\353uw[N\005TTuK\371\202"
+	.ascii	"i\312\310e\255imw]n`\236\2362\031\216\2152\031\"\207\r(\226\037"
+	.ascii	"\216\243\303Qv\247\233$\025\"~\350\207\241C\203l\316\2729Oq\327"
+	.ascii	"\201Z\334\225\261\254CC\273\233\222\262\273\273\023j\350\353"
+	.ascii	"6Q\372j\320\275^\243&\326\230K\341\2700\361\034\267|\207L\257"
+	.ascii	"\324\263\262\356\331\223\371\316\n\241\034\025\203\206\221H7"
+	.ascii	"\240~&\206\316\236y\323\216 %\005\3236\354\332Ba\267\321\005"
+	.ascii	"\035\3545*\2554\207Q\242\312\310I\016~\371gr\372e\033fu\357\354"
+	.ascii	"4\335\200v}\322\236\221\"R\364\240P\017\367\221\205[\224c\030"
+	.ascii	"\364\234\337\347\317E\3364@\201\230\236\241g\354,\226v\234\270"
+	.ascii	"\247\347\313{d\370\344V\263K=1=\301\354\205\366dW\362Q\032q\203"
+	.ascii	"\236}\266\316\256\260\2734\233\344\252\001l\263<;\344r8\030\260"
+	.ascii	"\210-\214\215):\364\177\273\266y\273\355N\200\333]\020\004wo"
+	.ascii	"\261\261E\035\033\003\201:\250\0016\032\022\221\244\250 Ic\261"
+	.ascii	"\005FITS\343\003\022@\305H\207R\245\252I\n{\354\277\001\310\263"
+	.ascii	"\365@\276\247$\362\025\332I\305\021\322\327+(\214\372\027X\252"
+	.ascii	"\312D\225\326\f\365\216\365\317\236!vL\354\257\330[\354\227\273"
+	.ascii	"X*hn\330\212\230\224D\340\315\2459e\217\227\351*\350\037\371"
+	.ascii	"eU\210>\037\366q\b\322=7=\251M\347 \016\f,\257c}\024qON\320."
+	.ascii	"9\226\362\202xx\005.\001\200\230\214\002\350\0351\241\202\227"
+	.ascii	"Es\336R\346;\365\\\213\2039\213R\234\004\035s\354\221 tF\r)C"
+	.ascii	"\322\n\257\370R\352\366\3726\205\300a\342\376\211\365O\262\037"
+	.ascii	"\251P\033A\305e"
+	.string	"\320\316\345\323\365\177\027\277\224z\343\356r&\327q\036\346t\366-\017*\204T\246c\357\034\373\337`[\201F\210\275b\r\013\332\205\t:F\251<\347\307\214\307e:\030?\327\373\321JfO\323\235\332Guq\f\360y\205E\240\022\243\357\235\030\203\320f\204\372\240\210y\022\355E\006\036\b9\240h\201\242\007\f\016\021\270\210\340\"\003\017\204\034P\264@\321\003\006\007\244\nL<\0245\340\366;\240\265LJO\264n\341\023\252H$'e\354K\347\320\250\253\377\206X$\334\246\357\274\b\217\334\231\344\371\0330\022}1XL\264\217;3f\217\245\022T?\357\261\362\253S\035V\021\273:\370\314\213\230\323+\306\322\334B\317\r\277\177PAUY.\020\332\270m^/\271u\203m$D\221\313w\006\210\226\344\204\343\343x,\016\354\016?!\032\374\005&\020\005j#\305\265\021.X\021\225\204P\r\t\314\345L"
+	.ascii	"\234\030\006~\3670\301\357\024ZA\330`\341\351nb\243\341AmK:#"
+	.ascii	".M\305h\334\212F\326\205N\266\250\213\356\223\356\026\255\372"
+	.ascii	"I\272\265Vy\322\335\242U?I\267\326P1\325\005\006\217\254\031"
+	.ascii	"\333\017\263\377*\025\206\332\324\312"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`\212\007-\020"
+	.string	"\206\023D<@\2476\215\001N\327\214\372\312\222bf\343r\234$\362h\036Es?\346\031\206\001Q\205\001\263\036\206a&\217\0033h\226\273\371o\246\335\350\351\355\273\311\322R\233u\211\035\333\312$\003,"
+	.string	"2"
+	.string	"3"
+	.string	"su\333W\253j\205\270p\333\231\355\224\277\006K\274\252s\246\250\325@\334#\036\342\271'\276'\356\372Y\350\351\320[5\252\352\244\322'\030v]Y&IO\323\032S\324\337\232\326uW\254\321H\021\347]n6z`\035\305\316\267\305\362B\\\250\355\254\354\234v\036\374\021\211aO\210#p{\033g\254at\027\032\2137\024?qf\351\334\217\303>\377\236p\256e\353W\262w\361\273\270G\336m\353`0\034\347i&3\231T\025\bB\313\242P\244\f\252\232\251\352\303\235v\367\261O_\360\220\240A\001\202\220\374\276o\332\213#\221\\.\005*r#"
+	.string	"\0323\240\303\215<\315\b\230\004\250"
+	.string	"\200`\210%\242\200\310\017\314\343\352\3108\244\320\024\200\245\250\241\2707R\220\242R\032\003@C)I\036\021p@J\224Ad\002\021\013E$(Yp\016"
+	.string	"\"\325}\273H\245\001\b?0\237D\204\016*\236P\355\334\3256\305^'\2658:\250'\277\255rEK|}'\246\356\242\301\355/\200\3056a\354\360\353x\030\034\254\303\003l\004x\026\022\330\021\360\0028\rL`g\315\020ulc\236\177\027S\222\227\215"
+	.ascii	"\350\2451C\233\264\233r\355\301\214\203b\006\314J\342\314\025"
+	.ascii	"\205\271\001\207\215\264\226\027?\354\271W\tE\211h\325\310&U"
+	.ascii	"\274\327%\271\321I\205\203E\237\327\202~\373\225kA$\247\224\026"
+	.ascii	"\220\332xH\206\024_\234|q\362\305\235\252\250\346\016\301\214"
+	.ascii	"\314\231\t\216E\236\353\320\026)\023\303QT\355\274\333\374\255"
+	.ascii	"\201\266~\210!\211\205\216_\202\252\301\375\330K\321~\266M\210"
+	.ascii	"\214Cz\3165\\R"
+	.text
+	.section	.gnu.lto_.pureconst.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\007\230\004\b\232\004\013\232\004\016\232\004\017\232"
+	.ascii	"\004\020\232\004\022\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"\365\006"
+	.string	"\322\212#,pK3\034\220u\256\372\2538.\326y\222\324\177\342\001\365\372\2035 \346\247\356\b\036\317\365\337\211y\215\324\2641\332K\232\265[\312\024W\017X\003\344\352\252.\214ayf4^\204EG\366*~\213"
+	.string	"\245\340\240\312\251N\205\205\223\331$\335h\316\223\361$\336\233\t\345\b\235\007\345\006\312\257`X\215|AgS\336t\0224\3009\314\027\234\233\367\371@\037C4\367\"\220]<\247\362\251S*\227\332\236P9\324\031\225G\355\314\316s\"  `\2021s\325\003\200"
+	.ascii	"\213\263'\373A]\006\032\207]\250\271\340G\017\304\205\257&\f"
+	.ascii	"\364.\207d\362\016\2636\344\213\265\370\227\261\201\234\211<"
+	.ascii	"\272\"\314:\261(\315SD\202\354\345|\020\250\004\024\306\017\026"
+	.ascii	"\201\276\266}\370jX\201\003"
+	.text
+	.section	.gnu.lto_.lto.2664a946bfbeeeed,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adjustmentRanges_Registry.69.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375 \227u\004"
+	.string	"\004\b^"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\305\321\035\006yw\250\306\006yu"
+	.string	"\005\001\006'\001\254\002\005\001\006\035\001\036\245\300"
+	.string	"8sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/fc/rc_adjustments.c"
+	.string	"\004"
+	.string	"D\210\021\346\r\240I\310"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_defaultAdjustmentConfigs.76.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375` \004]\r"
+	.string	"\364\022\023\005"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\005\001?\202\210\200\b\177}\273\001\005\001\006{\001y\001!\030wu\276\001s\275\001q\274\025\001\034y\001 \302\301\033\001o\305"
+	.string	"\037\310\001s\307\001q\306\032y\001\036\314\313\031\035\320\317\030\007}\323y\030wu\325\324\027\377}\330y\332\331\026\026\336\335\025\025\342\341\024\024\346\345\023\023\352\351\022\022\356\355\021\021\362\361\020\020\366\365\017\017\372\371\016\016\376\375\r\r\202\002\201\002\f\f\206\002\205\002\013\013\212\002\211\002\n\n\216\002\215\002\t\t\222\002\221\002\b\225\224\007\007\231\230\006\006\235\234\005\005\241\240\004\004\245\244\003\003\251\250\002\002\255\254\001\260\257\002\350\003m3\261\0024\256\002\253\002\252\002\247\002\246\002\243\002\242\002\237\002\236\002\233\002\232\002\227\002\226\0025\223\002\220\002\217\002\214\002\213\002\210\002\207\002\204\002\203\002\200\002\377\001\374\001\373\001\370\001\367\001\364\001\363\001\360\001\357\001\354\001\353\001\350\001\347\001\344\001\343\001\340\001\337\001\334\001\333\001\327\001\326\001\322\001\321\001\316\001\315\001\312\001\311\001\304\001\303\001\300\001\277\001"
+	.string	"}\250A\3107\205,\373\006\200\2234\315\001\020 \350d2\353\0015\350\263\242i5"
+	.string	"s\356\220XIS\256U\002x\256\306\004\200)v>I\303\004\300'v\027\351N\303"
+	.ascii	"\020\272;$\310\366\b\344\231b\200\375\311\031\004y#`{\353Ki\\"
+	.ascii	"\021\033\026\202\33261\327\257K\332\370\366\362\301Y\204Y\226"
+	.ascii	"\365\353}\264_x\361\272\177\312\246\227\241\217\0074q\224\242"
+	.ascii	"\371\362\225\bT"
+	.text
+	.section	.gnu.lto_applyStepAdjustment.77.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`\313/\355\211"
+	.ascii	"*\334l0I \320\322\031\016\246\006!.\032\353\002\030\220\243\204"
+	.ascii	"\3622KR`\353\257\272\222wd}\275\217\255A\244\372\020\354}@8 "
+	.ascii	"\"\237\343\236\177\261JE\367_\336\321\222\325|h\235\030\221\264"
+	.ascii	"N\246u\250;;^B\233\354$\245\f\376\002\255\002\002\003O\307^\025"
+	.ascii	"jo\212\367\242x\357\211\367\232P{\235\216\275%\324^\022\357\035"
+	.ascii	"\361^\021jo\223\332\033\342\275 \336\373A\355eR{\227\336\353"
+	.ascii	"\341\275Jjo\222\332\213\364\336\243\367\032\251\275Ej/\321{;"
+	.ascii	"\274wH\355\025R{9\274\027\371\336\243\332\253\252\275\306\367"
+	.ascii	"\246\357\275\332\333\274G\304\223\301\002\004\327u\311\242\240"
+	.ascii	"u\216\361\215\027v2\357\362\3323q\312^b\224@(\200i\205sM\352"
+	.ascii	"\314\241\035.\321\243\344Ob"
+	.string	"\331\236\3041\3059$\202\346\304\234,\366\362nP\2039\027\233\212y7\264\211\362%\332\360L\004$\350'\260\017\rs{\n\347\016\241\211y\016\023\r\001\315\331\3713WhC\"!b\342`\332\2409A\3059\300\2738\315\305?5}\316\347^\"\234\274D\275\276<\276\271u]\3310^\t\274f\377\004\260\204\335!\0308\206\335\2415\201\327\254\321)g\310\204\335!6\276\330\375ZV\263C\273\353\334'\022\354\f\351\314\262\306g]W(6n\022\371\346\273}\246G\253\221*~n\326u\225Z\007\336\2731h|q\032%\037\255KB8,\356]6\303g\276\270\016\005FZW+\207n\326\265Nj\247\220l\334:\344\356.\227\341\027\276v\237i\035\034\332qL\n\222f\342\272\256T&xIec\312J*\033\217\205\277x\357\326n\323,\232\255\273\262\332\241#\007\216\0336jT\321\230!#\006\f"
+	.string	"\250\246\244\242\240^\270h\301b\305\223\212\024(N\230p*Ab\204\210\246\020 >0-yPJB:2*\"\3520$\304\001yT\215\351\373kyNO\037\031\032\030\357\235]\031o\2322<\262^4[\227:q\253\222\204\257F\270-\223\350-\266\325\016E\326\241\370\024\3249n\300\021\210o\004\372\213\266\215\032{\270j\017 \264i\314\320\3032\364\f\346\351\0300\f\031"
+	.string	"C.\274\323TS\201,\025\310\206\200\035\005\025\207_\304\341\303\031\332\305_\013?f\341\307}\362z\305\023\036\253\300c@l:\205\f(b\340\0231p\024\2066\341t\206K\234aE3M\202n\304\013,\342\005\2602\335\024\202\311 \230bs\375\201\251\013/u\031k\241=pQ\332\302I[\224hi\244#86\202Ck\353\"6\2425\356\260\226\266B\017\2450c\241\023nL\2440\007\246s&%\n\237"
+	.string	"s\026\245\221\351\01369N\230\316\231Z\272\224>q[\232\365\021\n\253\351\013>z\210EhH\322\245%]\310z\355H\033\007\335\300\2466\226x\370'\003\035\027<\202r\332\254q\301K\026v;\233\"\204&\246\366\237.N\017nK3\246\324\t?mb\223\343\244\bm\231>\rV\321\303j\270\313\320\214t\037\261\326u\335&Cc\302;"
+	.string	"\357\0327\330\335\"\273/\006\003d5\204\365\242\361\254\206\241\366\236K;j\242\230\013\317m\337>\202\310\213\351\271\360=\205S\027\270\3241\2618\377,{qO\370\237\276\013\217\260-\377\037\020\222Aa\275\030\3255(\255\356\254\353jcw\253\373p!\327u\255b\3436\037\024\360xP\005\307\005\005\225\215}\243\275\275\350\233\260^\334\246\302If\346\200\265\342~p\373\323\305\370\267\355G17qv\363>U\021^\326z\266\017\235\224l1\334\306\263P5\257\204\235\205\252N5\022u\266\013\027\232\352Q\023Ag\241\251\240_\023+U\301\3559\013M\345\370\205"
+	.ascii	"\\h\272\247\006\202\225\352\f\333q\230\224\314\365m\373-))\333"
+	.ascii	"\333~z\030\024\267\262\240\267\375f\241\306C5\2456\333y\0135"
+	.ascii	"\002\372%\311\260\315f\241\3066jH0,\324X\307\357\210\225\252"
+	.ascii	"\232\205\032\237F\254T\233\01356\213X\251\246\331\266[hj\203"
+	.ascii	"\037Q\335B\323=j\035X\251\322m\233\021\212\272\260]\206\203"
+	.string	"\0362\333sHA1\333c\216k\276l\203Q\263t\331\366b,\033\333\262\315%\025\004\267\235\345\200o\333W\332L\334\312\202\333v\225\205\"\231\225*\033\267\311\326\261\266\270faw\241j\240\337\272\2021\333B\233lu\301\306\2577\0266\253\231\036\264C-\302wA\030\322L\266&\214\034,M\377\326\254\007h\220\311oe\241\370\204\033\255\370\261\0134\322\201v\353\226\375\267]\376\342\342\242\340\336\312n!\341\240 `\234\277\276'\034\275<<6d\344\306\210\t\003\346K\234\227.[\340\336\252Pi[[A\212\032\224\264&hg*\230\225q\0353\223%Q{\031\211\330R\355\345\260\367\362\312i\230\277\336[\344\275J\276c>\341\275\"\260\2237\004\265\327\353\275]\357\035\362^!j/\b\307\336\017\220\275A\336\013\344\275\036\274\267\003d/\327\261\227\003d\357\326{7x\257\326{5@\366fp\354\305"
+	.string	"\331{\301{-xo\005\357\245"
+	.ascii	"\331\233<\366N\240\366"
+	.string	"J\360\336\b\336\013\201\332\373\200\332\353\300{\177\274\267\201\3672\240\366.p\354U@\355M\340\275\b\274\367\200\367\032\240\366\026p\354%@\355\365\361\336\036\357\035\340\275\002\250\275<\216\275\001\250\275Y\357\305z\357\325{\255\324\336\035\307^\035jo\216\367\342x\357\215\367\332P{k\034{\253\324^\032\357\235\361^\031\357\215\241\366\3028\366\002\240\366R\275w\352\275R\357\215R{\241\216\275/\324^\027\357m\361^\026\357]\241\366\006)\223#;\3223\035'j\036F\335\270X\343\207J\213\345\217\372\260\350\322g\223\251YZ\326\345\334'\307\307\322$)\022&\313\347(\264[\3368\347\235\367\330\370\215\032\267Q&\025K\215\244K&5R\260\252\0235\013\231a\230\353\212'\261'\001R\261\005\320&\257(h\313\031\020\215\007RFE\023\331h4\003\355\304d\234\365\316~b\\\006\214\307@\004\364\207\rF\r"
+	.string	"\234\250\031\310\304K\341\314\203\006E\222\033q\364\004\\t\223\207\036\302\235\243T\317\243\224\302c\250%\311\251\236|I\244\316p\3166D]\n\352Qt\267CC\241\026(\302\027'j>\243jqc\316L8\231\035\211\025K\274\261\342&/\030\370vVtq9\312\2508YN3\230\335E3\317\f\006fq~\236oXq\026O_\341\247\344\346\235\276,\035|_rO\347\246\341\236\212\0235\333D\325b qG8\350\207\320p\204\n/\002\023Q\005l\223w\223W\345\r\226\342xJ)6YN2\244x:\227*\360\232\023\347\276\363\242\211\237p\272\211\2573_\243d'\234\232,\035<\356\034\340\315"
+	.ascii	"|\210\240\262\321\351\354\314b&\354in'\3022\227-\340\200\003"
+	.ascii	"T6\2268Q\263\031Uk\341\313YS\b\264\247b \250\210m\362f\350\250"
+	.ascii	"\274\305H\274\214\013h'aeq\371wF\033q\376{/E|D\323E\364\236\317"
+	.ascii	"\221i\272\221\230AZ\332\352>059\321\330\322\nc\233|\0300+\274"
+	.ascii	"\307B<\316K\b1\202\354\342\234\233\2008\307y#\371p\020L\377\320"
+	.ascii	"\202r\007\027\246\033\211\021\304D\343\341\214\013h\224\322\336"
+	.ascii	"AI\022\024"
+	.ascii	"%\233<\034\026%K\177S\252\260\262t\367\007\360\234\346\341\f"
+	.ascii	"\370.S\272\207\244+\271)w\334I\340T\222n$fO\024\313\0247HGj\027"
+	.ascii	"\201ft\206\266\311\257\255\200\206t)Q\324\216\264w\270\024<\253"
+	.ascii	"\335\214\217\316\202\357%F?*\272\021\024\245\325\223\242\033"
+	.ascii	"\335\351\211\022\026\r\202\031$\222\362\246\264\016ei\233<\023"
+	.ascii	"\264\262w\032\321\227(\237T \272\253c\007\305<x\226\262u:\234"
+	.ascii	"\007\337M\206\336A\350CQ/SZ\301-p2\241\033\335\325a\276\t\263"
+	.ascii	"\302\254\206!\2002'\312\007\254\025\207\376&\264\366\020Q:\b"
+	.ascii	"\352\331\302\341o}\0033\222(\233\374"
+	.string	"\221\213E\341\360\345\303\326\316\241\016\240\035\341y\255\3750\362L\370\206r<R\375Q\352\253\322j\261J\275\321\036 \363MX s+\256p3\b\017\371\267\225\303_Ht\266\200\371!44\322\201\216\037\232\333\016\202\035P\267\327 \220\300x\260c\237\330\022\265\002\225\303\276\201\035\036#\035h{m\223\035\250\002\344\272\032\251\332N\354\350\005\273\031h5\223i\251l\344\2603\225\bb\2433c<\242\362\t\020\t\016\013d\212\004 D\264\206Puy\r\031\342\265\325\304U\202\020\255\bL\340\352Bj\021\021\302\305\201\261\313+\b\221\255\256\022z$y\020\244\203./\036\\D\264~\b\361\032\201H\227\327\026\322nM\221@\244\213k\b\021\022J\370\200\003\255\f\266F\240\332\352\200\252+\210\326\020\252\255\021H\240\232rZ\257\020\270F\240\"\342\3455\002\325P]\030\247\353\255,g\351\203\246S\314}Ox"
+	.string	"9?\235X\026\234\341 \356\370q\326\343\303\321\343|\006\261\006\326\371\314\225\0313\316t|0Z\234\351\216L\0259\227\221\203\342\365\314\274\322\202\227g2\316'\026;\217\221C\301I\316a\370\234\330\354\374En\004\253pn\343\013\301h\347\266#L\334\344<\005Q\211\323\316S\236\034\261\3329\312\021\"\226r\206rE\210\327\316_\322\330\216\334\366\020^\266\273! \373\374\261\020\345\023\366\345v\033/V*"
+	.ascii	"\017 g\302\013\200\f\336&\215fed\316x^\037\003r/\251+\200l\016"
+	.ascii	"d\310\231\3159\006!\037\002\302\205\2141\"Q\"\265\370@\202p\016"
+	.ascii	"F\261\017>\204(\347\257o\315\302\262\340NzWrz\2334\202\031W\271"
+	.ascii	"\263^"
+	.string	"\220\017\372bF\301)\n\222\263\340A\344\370\354\272n\201\007\357:\347up\017\270\336A\240/\246\325\235h\242\034\327\255\0209\370\020\"\037S-\3173\316j\307\217\227x\352\030\363\334dZC\2371\347\347\326\367|1\243\356@\017\323\374\370\226so\203\377H\345\260\32678\303\321\340Z\031\\\203<_\314+8<\206i2\370U\226\324\016\006\037B\314\213\336\311A\003\341\025*8z\234\304\337\r1\177\233L\t\351\2109\377]\3609_L)8\301\3006=~\001\237\232%\002\357a\344\246\202#p\356\243\340\025$O\301\231L\032\347\213yug\206\254*\270\2776>\250\356$\177e\3307\301\207\020\235Q5>\2758\0335\260\356\001\260*\f\340&S8o\302\234\001%\270\033\345S\036\326%p\336-q\034+\202\3438\307\201\340\021<p\bR\274\224\315\0037z.F\337\300\231Cc\306\214\013\r\312"
+	.string	"3\270\311t\215\0320\347A\007\336\274\263\2433\343\016(N}F\003\237:\0132\360\006\0268\003h\352\316\320Y\200N\201\0235\025\231/\2349\213\001\243\3059\024\002\360\245p\223)s\356\313\2710\201\313\215\021\003m\361\004lX\242x\213\003\216\342Lh\300\017(\340\006\320\245`\276\244q)@\01387\323.\004\234\250\211\310\244\253\243\232*r\244\241T\234\341&S-Y\342\316\206>\216E\031u%\313\351\255\310}\214\371c\247|\221\001\256<\333\021\340\003\360\270"
+	.string	"i\025%7\341R7*)\004\342qn\266\005p\242\346\037\2712|\242\240\326+\035\276\360r\270\311t\212\024/\347\303\254\253)\243\240<9\262>\253\t]\256Wg\274s\036\253_\355\270\225\223\264I\203\300\250r\230=V2E\"\"\"\222\244 \225t\302\r\b1\3100\252\252\003\022@\0221\b\307\221\322*f\"\222\024j4\006\\9\307\223v\332\217@I\247\316\365\264\033\336\372nM\034\271\306\027y\024\244@z\306A1_\330FO\351\260$@\312-\352*\262\003X\274\327\352?t\224A*I|=\nG\224?:\203\313\023F\r"
+	.ascii	"^\271\231?\327\026\023\375b\367\355,\236\200I`?\270E+F\372A\354"
+	.ascii	"\204/\2146\225\037\2667\243\353\260 F\201\004Iw\314(\246W\342"
+	.ascii	"\210\200x\247\301\b\277@n\001c\264\177\034K\003$\351\350q\026"
+	.ascii	"\355t&V\027\202\275\250v\021\242\345}%A\001?9T\322\265\261/w"
+	.ascii	"z\273\f\320t_\373[F\330,\203\245\325\033\250\267\375\2003\201"
+	.ascii	")\323\023\020G\024'a\325BA\n\244ul\224\366\222\002\202\364\376"
+	.ascii	"\004!\255y\245\035\022\002\347%;\362[\360\211\3216\315\337\247"
+	.ascii	" \260\016W\340Q\241\003\351\032\003\3368\261/'\373\3471w\367"
+	.ascii	"\233\350\217\342\007O-VR\216\221\225\322\302\312\242\300B\204"
+	.ascii	"0\005\354ir_/\366^\016\206\r\344\005\267\200J\271\030E\b\340"
+	.ascii	"\371\\l\025ZW\177\002\244\335\n\261\004\002\311\351 \220\202"
+	.ascii	"\311\025\035\001(\277 \3403G \\\r\321\fPD4\024\275\"E5\332\366"
+	.ascii	"O&\243\206@\211\216o\022\313\202\216\245R%\325\267\210\276\350"
+	.ascii	"\026\313:\213\004;+`JW\222\"]\225\321c\363\257@X\013~\b\022+"
+	.ascii	"XhE\315\017\322YJ}\231\021\265?\237\230\224y\200\234\370\017"
+	.ascii	"\007o\332&+\245gW\033\211DW\307$Y\311\373Z\260\230\336\331le"
+	.ascii	"\330\024E\204,\332-\001S\272\222\024\322e>\234A\263\271\324\276"
+	.ascii	"\304\203\306\r\371\223\0251\022\271\321\301\221-\262/\254\305"
+	.ascii	"\262\316C\222\035\312 \275\260\036\r\3058\351\031\204\341\031"
+	.ascii	"w\3242HL\273~\377\320\177\206\324H\307\236\214$]K\245\r$\227"
+	.ascii	"\327\017=\305\261\303\301\274\007BnO\2317\216q\302}\370\245\231"
+	.ascii	"<T7Sp*\2015K\260\222\366\200\377\224\242\253c\312,d|1\222\026"
+	.ascii	"\b26\033\277<\347\272\031\251-h]\275\272S% DO\013\305\016\354"
+	.ascii	"\301\250\270\037:G\340)\347NP9\260\373X\201\335\f\222gW\313m"
+	.ascii	"\3167\240\212\246\206\273\322K\352\210\260\002\352\202DMZ\252"
+	.ascii	"VR\304\217\006rG\313\226\247\247%( W\003,\025\207\rb\243\b&\367"
+	.ascii	"\3614X\016Sw\331\177\202\272\212\351\346\360,\222\3445\236V\330"
+	.ascii	"@\272P\351(\235\324\230?\334\237Qg\243\3753i\224q>`:\327I\n\206"
+	.ascii	"K\345\3167\267\345$\324\202\025\t)\230\023e\261F\035>\265\033"
+	.ascii	"\216`\321\310\235\273\335P6\250\315\220n\036\327Z\n\274\026j"
+	.ascii	"\005\211Dj\224)\303\255xT#\275\240=\244\357\246Q\365L\275\237"
+	.ascii	"\313\020MR\354\223\305\220\321p\321\275&\253\357\020\254\020"
+	.ascii	"\225\376\314\317RF\377r\277\306\035T:w\262\300\323\227[\276\255"
+	.ascii	"bj\357\211o\221]d\344O\311w\217\316\003\226#A\225\036\340\333"
+	.ascii	"\266\225$\0032\336\036s\232:\016M\326c\262'\205\241y\025\331"
+	.ascii	"'PQ\374\341\022\334m?\262\244\317\333;$\207\223\f\243"
+	.string	"\311\234ty\004) \007\007\243T\371\022\024Hh\330\224)\024Kr\246\022\300\032\240\030\214A\312!\n\030\235\263\331\030\231\217\370"
+	.string	"\273B6%\334_k\305\305\t\035H\264\032\216:0G\023\361\005m\316\030\007\002\241\007fd\201\324{\200\263\234\024yP4Q\332\363\360\315~\234Nm$Mcm\235\333cg\367t)\236\r\305\263E{l$qy5O\316\346\261\347\250\327\210@\340\245f\351\001\236Z\034o\370U\256"
+	.string	"4!\341\032\314\0038T\273;Sa\216\263\222\t\026d\001\245\200\242\261\355\317c(H\330(\207\260\240P\244\302i\024\031\260\236s\034\210\036H`\3349\211\224\312\240nf_\375\336\364\366Y\234B\314\222\221\032rQ\027N}N\355\210\274\031)\351\b\224\b3nyV\322\221\341\224\356\222n\030\335\306-\203\305\237\217\362E\204\276\005\"\032\270\313\036\305&\245\362\260+oK\343\220"
+	.ascii	"\b\034\344\333\230/4\037hf\356P#\370.\215V8\f\357\023\\\313\020"
+	.ascii	";M\237nk\323{\215\323\350|'\\\217\345e'\023\316\216\346\305\211"
+	.ascii	"\277,J\277\257\345P\303K\375o\017\221rw$}^|?\020\212<od\t\334"
+	.ascii	"=\346\270\354\0221\267\\\256\363:\032_\3506\311U[V\346- A\037"
+	.ascii	"l\"0u\372j\027\374;\210\224\265\023\250b\312R\200t]r\017\225"
+	.ascii	"\243;\365\275\346\220\\\260[\337\350\300\016\206>$\001\021l\342"
+	.ascii	"t`\223\0227\177G\317\031qMt\f\213\274\037\251\001\215\312{J\025"
+	.ascii	"D\013"
+	.text
+	.section	.gnu.lto_applyAbsoluteAdjustment.78.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`\\&\215l"
+	.ascii	"J\262 'I \016SI\007\317\2516\242j\372\226\254\024I\210iz\201"
+	.ascii	"7\302\250f\234).\377\3068\3467n\353z+Rr\003\200\326A=\036\352"
+	.ascii	"\273\220\354\302\366\223\031\202\256\302\026z/a`FGH\344\365\242"
+	.ascii	"\366\016[\333\215H)S\206\002\f\002f\002\273\245KQ0\310a\232."
+	.ascii	"iT"
+	.string	"L\353\034_\340\262\316\335\177\247\0246\243<\233q\207O\006\3019aD\024\301\271\210\370\246\267\304\331\306\246\211d\257\271\326\207h\204\0171\r\220\317\346\260\331\235\306\300E\302B~\022\0055\017\013\233\206\212\201\016\001\365\223F\304\302\243\036#\"\341\232f\037\275\346\0366\210y\366\020\007\371\232v`h\n\306A\f\354C\004\244#\007\360o0\316\035\276g\023\016a\363\215\2406\205kv\217\310\242y\025\363\220\310?\224f\325\374C\377`\321|\002\346\240f\232\246C\037\374C{L\361\227}\365>\364\337y\276\244\231[\322YB\233?i\232\252\330\343w$\273\205\363\245S\277\301\274e\310P\017)\332\bi\266\226\377\035\263xe\233\027\302\032\245)]\242\2334\315\233:Ur\217\317K\376\377\202\3310e?\037\232W\367\206l\3333r\0061MS\345\323&\325=\242{T\367\330Y\266l_\346d\236\367\342"
+	.string	"-\003\\d\265`\201uU\200\025\001U+\006PRMI\251H\201B\200"
+	.string	"N\230"
+	.string	" \252\004\324\223\023\211\246\021\"\230B,)\201HB:\372`\344\241\210\250\003\207\241\r\032\222\310zD\233\313\276\253\2672\316\226\024\262\275\231\355\313\234\f\332dn\204\265}\336\210\271\263\265\275#\374\342"
+	.string	"\306\325b|\263\310\006\270(\264Y\205\370\bq\213D\026\210\213\205\370W\310W\005\020\256\025!\240\037&\240\212\317\256\340\263\202{x"
+	.string	"e\340R\005\356 \035\236\222\232\263*\346\354\0369\234\002\305\337\n\360\267\204~\034@\233\023l\326\004\233\005\264\307"
+	.string	"D\271\260%\\XC5\f\225\346\t\315:\241\331D<&\321$fG\210\331\3050,\002\f\323\227\r\361\305\314\013/)qY\020\\\322\266p\022\322\335\036\335\255\221\300\037\354\214\264\254\007-mu\\D$\267\035\344\336\2460\207\225\301M\312P\224\335\020\005n\241Pp\203\302\032\242\3306\t5\307\204\271\310\225\301\215\031g\204+\232BnN\023\242754Ip\004?\253\267\250\223\27136>\302-\212\246\370\363f\020\321[\032\232\264d\013\033OYF\362\206\306\255\230(E\255\361\331\247M\0320vz"
+	.ascii	"cX3\246Y\002\225\235s\213\333\360vVY\320\026'\322\334\031\033"
+	.ascii	"\bFn\245izf{c\262O`\377#\326\177\020~\250)\001j\203\266q\317"
+	.ascii	"W\251z\357\232\243,\372\345.\317K\026\247\2403n<W\331o\231\361"
+	.ascii	"\242\322\234\240-\335W\316}\316~\376\\*d:\3519\357\371s\311\017"
+	.ascii	"\t<~MKV\355\234\357\374\211<\343'B\360\317\272\310dZ\262J\347"
+	.ascii	"\034\370g\035\304\f1\307oi\311\352\3379\206?\227\f\375@\364\235"
+	.ascii	"\343\374\271\024\310L\202s\206\341\317\2459~Hn\316o\376\\r\372"
+	.ascii	"\035\355\235\331\374\211<d~Psv\341Od\036?#4\177\"\031\231\036"
+	.ascii	"\226\254:\213\226\254\266@\264d\225\314\271\314\237H>f\007<?"
+	.ascii	"\016KV\303\234\305\374\271\324\307\334\340\345\374\345\317\245"
+	.ascii	"6~\032\272\234Y\370si\217\231L\341\254\302\237\310E?\244\t\347"
+	.ascii	"\023\376D>k\t\347-\177\"\3510\217vg\022\376D\306\361C\263\234"
+	.ascii	"\353\376D\256a6\335\371\312\237U\321\217\255\234\347\376\254"
+	.ascii	"\204\273du\217L\345\377sI\221\231\246f+\367'\263\245(\366(\325"
+	.ascii	"*\272\204I\3070\343\237w\306}\345\337nll\f|\323\375wvuX\350\346"
+	.ascii	"\252\310I\201\302t\322\204\211\233\222"
+	.string	"$l\315\337#\315_\265\346/Z\345\213U~X\345\007\251|\r*\037H\345\203U\376\217\312\377\252|\037\225\357\325\374\256\346sU\376\005\315\357\321|\036\225_A\363w4_G\345\347h>\216\312\277\321|\033\225\017A\363k4\237F\3457\320\374\031\315\227Q\371\0134?F\363a4\177\253\362_4_k\363v]4?\253\362[4\037\253\362\257\232o\325\374\252\312_\321|\345\266\260K\265ev\245\326\271\217\252\374\022H>T\222\377\204\344;%\371$\220\374\246$\177\004\222/\242\362\231*?\004\222\277T\371JH>\210\312OB\362\221*\377\b\311\377P\371FH\276\207\312/B\362\211*\277\003\222\317\241\362\207\220\374\r\225\257\001\311OV>\262\362k\345\037+\037\255\374\256|\256\374\rz\373\005d\302\013\320\227\035\247\317\253\027\220Q\377\b4\fp^\350!\243\215\334x\300Ct\3222\234\364\026\242"
+	.string	"@\324\214\346\275\375\032\226\270\300\360\313\336[sA\257a\221\2324h0\230\321EN\"\274:\314\236\301\354\r\264\006\352\f!+O4\232\317\3547\321\251\202M\374\262\315\224\251\2407\261C\377\tt\036\336\030\0374\272C\037\t\303pP\204\3224\240\364\036r!\321T\243Y\315~\027G\344\330\305/\333K3G\357\342P\227/)=+\250"
+	.string	"\304\201\032=\324\307A\0246\214\271#\245k4\235\224\336BiD\230\231\201\f\223\215f3{6\013q\303\354\313\346\322[n4\233i\350_\201\276\373\232\252#A\206\323\214\266k\240\265\2109\300\201\215\326\320GB#\214E\032Kg\341\340{\367\007l\330\340/b\024\345\3040\345\332\306\242i\274[R\302\321l\267\3474\020\020\244}\331sV hNC\366\224\246\"\3078\032\231eN\225\306Q\245\371LK\022\222\216f2{^;j`\355\313\206\022\327@\363Z}\342DGW\026\372\316\346Z\007\341\\\263\221\274\017c\362X1\332\321<f\317m\036\026h\373\262E`\262@s\333\321\355\013"
+	.ascii	"=7z\311\216>\352\355\321\365\016\272f$X\212\210x4\333\331\363"
+	.ascii	"[\207\027o_v\022$/\232\337\320\251^;\302\243\3218N3*v\2614\217"
+	.ascii	"F,\315Kd\340P\007\217\314P\217\346:{\206\333\320\002\356\313"
+	.ascii	"Nk\264\026\315p-\325E\276L\324I\320f=\272\235\214gu\335\343w"
+	.ascii	"\352\232E\030AC_Ir5\323\331s\034\207@?$ \373\n\017\332\253\270"
+	.ascii	"/yQ\361\2529\216\247\230P\"W3\236\3033\273\346\"\\\252^\273\346"
+	.ascii	"'\200\273'\3340\356U9+ed\207\005\301@v\366\2401\241#\022w5\313"
+	.ascii	"\331\363\224\035\025\360\262\375\330f\3108iKP\013\352\212\306"
+	.ascii	"\300\f\0374&t\236\362%\033Z\220LS\264\253s \026\304\365./^6\257"
+	.ascii	"\272\307\025\355\245MQN\314\230\"\375_\212\001}\231\320\223\246"
+	.ascii	")\213\037\214\377h\220L\323\364\252\260\354HXS\335]\bu\217\313"
+	.ascii	"6CWo\257\336\252\350{\232\311\243\307X\204\033/\265{\327]}\016"
+	.ascii	"\377A\325\301\217!\\aJ\261\261\260\260\261.\246\034\037x\211"
+	.ascii	"%\275\210\004\341\362\340(6\0066\244K\214\310\002\037\276\300"
+	.ascii	"|\210\215%\3405\204+\202 cB\206\210\215u\031\275\213\252\203"
+	.ascii	"!b^aC: \002$\003.\013\272\204(\273|(\305\300\270\302\224]B:P"
+	.ascii	"R9}l\003/!\312!ccB\224CyE\026M\233\356IjT\344\230j\353\024'\002"
+	.ascii	"\312\256Q\006\035"
+	.string	"P\3255\n\026\027V]\343\324X`u}\202\245\200\254\256p}UZ]\341\324\224[]E\350\"\005\243\353\033\036\0241z\033\373N\310\350]\034\0245\243\267\020\236'\032\275\205\324\232j\364\036\342a\262\321{\250\246\204\243\327\260\013\222\216\336@X\214v\364\002r\022\361\350\r\3542\324\243\027\260/\311\325{\202\0346\307\256\216j$\377\243V\211\032\0257\211\177\212\364\331Y\016\205\201\200\262\371o\277{[b{_\242%\334\211\365\356\225"
+	.ascii	"\203\332}%[K"
+	.string	"Y\030e\227\350\312W\007\245\202\234\030&Z+\033\321z\325\370\2758\240\252\271\317~\337h\205\275\371\022\275B\027\326\373\346i\256\f\017\265Re\253\252\237\372\b(\347\244WE\255\253\324z\333\3601\300\205U\263\236\375\362e\005\341\373\022\215\002%H/\037\tf\031\036\372\004u\022\303\252I\240M\232\234~\216\264\025z\344H/\234<-\006S0c\201\325<\270\337?,\r\366\357K\364\ru\323\240\367oD\377ebP%exh\033\232\204\001\254\036\321GB\224M\204\223\216\255\261\212\334\260\365\306\341\273* \253\031\316~\001\255\200,\340\227\250\032\232\006\244\027\220\t=\3732\001\206\026\311j\246c\223\t\230\244\263\222\364\312y\201\200*\255\3460\373\025\\\001&\370e72\202\365\n\206P,D\250\206V\207@\\j*i-%\275\201`\006Pn5{\331\357 \325\217\301/\333P\320\217\336A\245\031"
+	.ascii	"\375\211`\253\225\372\b\370\004q\206\316\255\267\334z\3554\247"
+	.ascii	"\244`4w\331\357\036\025_{\276\354>|\276z\367$\351\371\222\252"
+	.ascii	"\313\203'\007\214N\352#\340\035\244?L\032\006\223\336<+\244@"
+	.ascii	"\021\243\331\315~\t\005\360A\370e\013\326\361\321KxD\007p\016"
+	.ascii	"\0051\372\250\217\2031|\b\300J\013a\232t\214&\275}\332\004\240"
+	.ascii	"\267RR\222\314\231\235\220\321\034\202\354\250b\330-\017+D\212"
+	.ascii	"D\002\221 )H\222t2\016\b!\310\020\226m\022 \342@\216F\321\322"
+	.ascii	"!\251\3020)\250Y8\327\"\202\314\b\237\374\321\364\034"
+	.string	"\377 o\326\256\205\301\2017\254\205G\246\214\264H\020\374r\345@\276\307\303\035\204g\331\200\206:\246\275%\303\274\226Md\030\364\270zJ\003\016-\341.\233\360\206\025n\3433\202\025\221\241\356\313:\003\031\236]\231x9\032\001\347\nNl\3509=@\300\213\234\263JE\ty4\006Wm\266Ks\342\2646M\354\345\270\374\004\243\245\313J\231\357\341\023\262hm\017W\223\374\373^\207\323<gvQIRC\2537}\342\2643\265\016\026\003Z\326r%\230P*^m\366\026\215\204o\202\363\266\242\300\200,\331B]l\r\2420\342es\236}\006,@\223\374\205o\265\352\013^\201\t^Q\031\2001\031\212\323O\227-:;\306\305\020;\205\247-\232\"\b0\341\225\352Y\213\"~\030%\210\221\033\360\227\016\265k\336\201\314M\323o\245u]\247U\0300\321+\025\304\002\353\246/\331\004\237\236\255\034\256\271"
+	.ascii	"R \361\361\372\301\022\314\221\353\002\202\0356\217\257p\310"
+	.ascii	"\307U\262 Em \372\f\004X7\375\fs\003\344\027\304y\247\215\212"
+	.ascii	"b(\352\024X\035\020\033\320M>\t\262X\234!7\207\3772\022b\342"
+	.ascii	"0r9\250,M\004\370\006\233j\241@\300\231\b\b|\245\274oo\363_\377"
+	.ascii	"X8\030\373"
+	.string	"\237\367\274\233y\271\307\361nG%/\022T\241M<\324\301\264\rO\307\357\\\241\276\242\006EX!\275\214\020\251\221\340\017\b|\271\346\300\235`{D \317y\005Q\332\330\364\355\336\326\n3\360\320\204W\250\316\304+C0\020\365\375\357\356\242\372\261\245\216\201\207&\274B1`iT\331\034\276I\3407\336\302\261\354r~ \303\3635xL\020q\372!\267\f\220(\326\347\345\244\363\031\006F\333\376\345e\262/\367\356m\263X\334\373\001 6\204\345\250\031\"loH\214\340m\215\272\271\340:\370v\235\005\363\302\366\255\210k\001e\013\212\275\265l\321\347\021$:\217;[N\330\230h\\\223m;j3\313>\261\240\214\373\003\213\270\005h\261\016\300\333!\024|\030\213\212\215\235\232\301\235\261C\350\241\265>\225\006 3q%\tO\201\300\340\346\354\371V\305)l3\266I1q\300\341n\355\304\363iQ\317\025"
+	.ascii	"\301\347\025\373cQ[\270\026\325\337\300GRS\325:\314$\347\"g#"
+	.ascii	"\032}\324M\2358\271\255\035\361<b\177bs\032\372\304\363\210\375"
+	.ascii	"\211\315\t\361\270\362\274&\233\234\277\274of\355\224\316aW\214"
+	.ascii	"\376\346\254\273u\267^\272{\367^\255\356\207\255\255\276\246"
+	.ascii	"\031\352*a\255\336G\254\264\217U\312\242\017H\263v\377n\307S"
+	.ascii	"(\224aU\345\0279\342\027*\252\177\024\250Ta\3468\324t\b1\353"
+	.ascii	"_6\033\177]j\331\314_\333\215H\270\217\211R\315\t\002!N\204\220"
+	.ascii	")_\305\257\020\303\336\375s@\311\200\244\310\352\t\034p\247\234"
+	.ascii	"$\017\267+r~5\2151\265|{\372\214=\241\223\276\262\211-\320\374"
+	.ascii	"\256\003\371\237\271\326v\231\375\213\274\007\372~\037\207\024"
+	.ascii	"/\277\254N\227WPE\266YZS\232\364\006\225h7\247\025$2:\361\006"
+	.ascii	"\252\3106\247jJ\023\337\004\317\242\356\263\276X'\273\243\307"
+	.ascii	"\276\234aw\252\326K\276\356\177]]r\252c\365\225\344Q\034\220"
+	.ascii	"T\225U\267\300orI\350\326\316pD\335\360\364=t:]\3775:U'\230\t"
+	.ascii	"\002{f\302\001"
+	.text
+	.section	.gnu.lto_applySelectAdjustment.79.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`\314\005\035$"
+	.string	"\232A@\016Cp\250M:C5\b\201D\262\022\314(}\200\315T"
+	.string	"\371RB\034F\231g!n\354\271S\026m\272\224\355\356\021\266\255\244\214\341\202\\(\002\241\344\266\211\367K/}=X\365\204\231\273[\223F\244\311\235R\326"
+	.string	"\300"
+	.string	"\320"
+	.string	"\257W\225\006\2400\342Z\255F\007/\235\341\\z#\360\003\252\020\rJ\205\363\245)\265\257\345[n\\\314\206q\265z\031*S\253\361\201\235\316\227MO2_\332~d\276\264m\b\021n\030X"
+	.ascii	"G\360OSX\216\241\227A\265\032y\253\344\300\003\330\351r\270\363"
+	.ascii	"f\226\266\245@\377\370\013B#_\210Y\301\003\340\372\216\353X\204"
+	.ascii	"\352(\221\347\020x\375\330:\356u\260\266\312\264\350iK\242\203"
+	.ascii	"\204O\203.8@Nv\004S\260\212\364v\257\037Dn\nyik\260fFP\200\254"
+	.ascii	"+[\222\217'\304\217\341\2406[\323\033\344\360u\260\270l\007\222"
+	.ascii	"\030!\364\343\251\216,+\272\303\\\226\320Ljr\346\344^X\\Ko\024"
+	.ascii	"j\255\246\304\254\037w\200\333\026d{\204]N\005>\231\253\330B"
+	.ascii	"\006)\24279k\242f\367\313?\343\243!\360#5\214+J=b\346\227\261"
+	.ascii	"\332\251\273\r\363\345ql1M\213\2251\266\325nv\244\253H\255\301"
+	.ascii	"wY\215\022+\203\227\002\226\216I1\022Z\263\242\211l\243\220\356"
+	.ascii	"\227\375M&\223\204\274I\354\222\232ii\251\225\220\016\346>*\251"
+	.ascii	"\215n\374\213.\366\0138\227{\267\324\272\222:\267\324\270\245"
+	.ascii	">\227\372VR\233&u\271\324\273\324\264\244\376\201\025\177|\364"
+	.ascii	"\310z\321\254V\037\311C\025Y\236\201r0?\227\227\205\361\007\255"
+	.ascii	"\263A\357\342\223\201\251A%\314H\207{\371\230\255\363\214w\361"
+	.ascii	"\222\230b\255U7\303\326\275\244\366\r\377h\235m.\300w\200\021"
+	.ascii	"\226\330v\272\035\r\n\322j\255\0236\034\215\303Yk\225P\207\312"
+	.ascii	"C\202%`?\363\245\271\021\230\210U\321\244\3759G\376|0\203\b\021"
+	.ascii	"\302|Y\356\201h\245\271RT\332#\243>g\346\256\322\232^\001\022"
+	.ascii	"\322\244\213v\367d\377 \324J\016\023\335\314\027\340\311r\333"
+	.ascii	"\257\003\315\242]\332\037oS\2435F\230g\254Kh\"Q\2727\273?F\242"
+	.ascii	"D\271A\246\243\0345\345O\230F\213\342c6\3616'\316Z\255$\370k"
+	.ascii	"\316\346\311\007{\351\236\217\236\3503_\032\355\025\036\207\272"
+	.ascii	"\266\210\355(]\033\252\005=\321MV\033t\321\322\275!)&\207\211"
+	.ascii	"\252h\322h\252$\325lE\373\235:\356\261\242\205\214\243\266T\f"
+	.ascii	"z\342\367ix\270\220\302\r\006>\031.\236D\314\360E\235?\030>\037"
+	.ascii	"\212\022\352'\005\343\214\222\202\242\352E\311\260`\344\236\323"
+	.ascii	"\217*\312\367"
+	.string	"\202\352'\203E\212\247\023\275)^O\005/\n\352\351\005\2577\365\3439\035\260\024\f\337\024\217JJj\212\2473V\335V7I\0212\217\037d\325\n}1\267\001\330Q\335\332\027v\253\233\242%\350\230\347\213\261\r\2321\273\375\362\311\376!cU\272rH{\260\260\255\241\231\271\264\273\325a\003\315\335w\030\n\372A3\205.\303@dt\271\335\237\271_\226 \b\240A\270\375rs\2462\233x\037>L\373\262\243\335\243'\355n\264\316\256\024\341<\267HK\021]u\3416\267\006\274\234\347\342v)\316\025\226\333*\355\271\266;WQ\314\275m\017m\313\314kf\002!\317\375:Zs\357ecxn\250q(\304\020\223\246Fd$H \205I\213\001p\002\221\2613\036\021\220\265DC\025\246\205a\016\f\210\225S\302P\376\276\231\303r\312\024\327\034\316w\362\355\266\027\221\240\035.\243n|@\357\274wO\245"
+	.ascii	"\261r\315\375\235&c\334A.\033\341#\344L\255\036\240P\023\363"
+	.ascii	"\217B\365w\nXAa\361\215\201\352\026\320\037\303l\210\035\272"
+	.ascii	"\323\027sm\017D\304\241\033\276y\325&xd\231\021\354\364r\352"
+	.ascii	"|w\341\016[/\243\025\336r\331\365\362\312\003\260\031\f5\325"
+	.ascii	"\243\330\n\235eE\227\237s\372\242M\210\372\356\365\312\005c\322"
+	.ascii	"\304/*\371\214\003\242\243\320s\020\031\024m\257\255\235\013"
+	.ascii	"a\026\003\004x\275f\263D\023<\362-!\025%\244\030\306\203\201"
+	.ascii	"[\351i\310\270\236\363Q\214\271* \006\016.:\316aGD\201\313\225"
+	.ascii	"*b\205\003C\202\032"
+	.text
+	.section	.gnu.lto_calcActiveAdjustmentRanges.80.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`v\006e%"
+	.string	"\nC\240\016E\200\236M:\223?\361rn\034X\\\bo\273d\374\272\377\2357D\007\246\270\007\0170\272>D\364\227\244h\200\211\320\031\016\030\332Z3\304\2460:\035\020!\314F\346x\016\r\236ta`twk\204\020\271S\n\323"
+	.string	"\304"
+	.string	"\334"
+	.ascii	"\\\276\237\224H\264s\317\362\207`\256u~\313bG\245\320G\031\261"
+	.ascii	"\3740CQT\203\355e\003R\207\235{\271\307r\316\277\272\227\363"
+	.ascii	"\302\245\243=\364veu4CQ\037\321K\027\331^\272\314\207\314\227"
+	.ascii	"\270\0230_\372\264\361\034\340\2012I\260\022\00454\242(\252["
+	.ascii	"'^p2"
+	.string	"\353\276\325\363\270\233\255f\226\344\326\323\307\372\203\024\r\217\216\327\217\3518\262F\2011\235\314\227\222\025\320\256\034?\344\325[\355B\023)#\2679\250\325.\234a\231\322S%5u\223\034\202\263\344\016\004*6Br\277\247Z\006\370A\345~<*\031\346\016\310|Sd\003\342\253\217\237S\335\017_.y2v\225V%e\344\265v\001EQ\327\336O\352\316\335\266\230\355\025\266\251\013\366\t\024{\342\017\204\0306\366\256\253\201\261\303w\331*\236fi\337\324AQ\224\202\330\321\244\360\245\274\264\321ng\276\034\332w\035\204\220#e\254\240y\021i\252\307\315\323\245H\332\2369\332\221\016\215D\367\313<\314b\276\024\263p\261\276\347\242\3712G:\f\2365\325\243s\025w\2571\211\376\254c\301\b\360\244g\313@\252\357\271\022\303\3204\263\247e\262\263xu\201\366\005l\325y\3622\261\025\324\252\207\276u\013\221\325"
+	.string	"\266:\267\3258\262\372\266\325\266\255\256\231\325fY]n5\271\325KV\327\255\376\202\027j\202"
+	.ascii	"\371=\t\032\212\0069\006B\307J3T\276\365\013_\355{\371\\\366"
+	.ascii	"\277\274\313\316Y\307\003\366\211\345|N-\367\245`A\024E'\330"
+	.ascii	"\246\361=\347\026S\230~\031\315\256\347\354rz9\261*\006Sho\233"
+	.ascii	" \016\2244P\203l\213\347\275=\021^[\333\376Nm\357u\016T\351W"
+	.ascii	"\332T\330\330\020$\346\257\3014w\311\264\3122\334\216\0063K\372"
+	.ascii	"\025\264\215\343u8\230hR.#\212:\3159\235\016\244\207\017f\b\363"
+	.ascii	"\245\271\007\263s\003\302#gP\271@\2230\313}\225\226\035[\304"
+	.ascii	"\343\220\2701\025\307\310\340\224{_\372\265EX\364]r\027\364y"
+	.ascii	"\242\342\325\243\353\356\036j\220K\374\215\211#\260R\274\242"
+	.ascii	"\272BQ\247\tn\226\326\200\0369\274 Wl\336\246\206\371\262\356"
+	.ascii	"\303\234\003\221\224+Mx\2646b\002\221\0134\321\277IZeN\365\217"
+	.ascii	"\t\324\217\371\271\216\005\3036\264\001n\341\342G,f\030\215\300"
+	.ascii	"\240\024\343\206\321\212#\025\005\274+\262\2414\343H\206\222"
+	.ascii	"\215\033/T\030\245\330%\351v+t3\\\030\311\320\355\222l\350\212"
+	.ascii	"\030\030\211\306Q\222N\t\t)I\227\313j\3722\361\006\261\2544\263"
+	.ascii	"\246\345y\211D\321*\013\027\376X\037`\006\246\036\243p\013t\255"
+	.ascii	"\314\246`\267\254\022]h}X\314\024\332\013O\242(\212\336\"\\h"
+	.ascii	"\025\354\207'\003\245D\036\035b\375c[\240\235\004I\355\235I\356"
+	.ascii	"K\213\301\036Q\\\322b\020\200\222\372D\306\370\242\3628\227\230"
+	.ascii	"jR2\301\312\253N'\320\311\t\245\276wF\001p\314U\246#\334\346"
+	.ascii	"\216\270\275\230\223]\302\212F*/S@AY\306j\013<\251Ly\240\223"
+	.ascii	"\312}\351\230 \240?U\3221\301\263\246\323\312\264O+"
+	.string	"G;\255\214~\372<\230\202\031\317n\033{\250Q(\245\020S\310($\"2\243M\222\016\240\002\031\242\252y\021\220\251eD\n\013\013\232\375\r\374\265T\016\025\372\271w\350K\226\317\230\344\363^:\330\223\221r.\027e\247?\013HR\311\370\361'Y@\035)\013\n\021\022$\0310c\270 \261\303\037Q\323\"\245\256\266\246\3702\207\262H\255\224\370\361\017c)\314\177\251\261\245\230\314\007f\215\036\b\340\200\023\017\027\266\354\357X\270z\226\240\345\265\351\230\003\376$\304\237\330M\323\212k7\rC\266\"\315H\333\303X\t`\364P#tY\326\222\027\rIA\004qG\222A\324\020k\303\364\260\201\0061Y%m\232X\343\366\346\247\366:\306!\205\267\213\340t\250&\202\006j\267_\354\242j#1\355r(\276\330\337\1774\260\016\255\203\260\211\004\026~\017m\277\272<\316\300Ba\230g\247)\370V)\262\021"
+	.ascii	"%\226\331\271&\272g\261\030XM\377"
+	.text
+	.section	.gnu.lto_processStepwiseAdjustments.81.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`\317\f\225C"
+	.ascii	"\372s\340\031B@dR\007\307`X\240f\023\2128\207\013\204\017r\013"
+	.ascii	"\256\220\252A\254\371\350\266\244\241s\366\333\315\256\035\237"
+	.ascii	"c\266\254\355\007\375\242\177M\337,\261/\\\260\344\200+Vy\261"
+	.ascii	"\274\025\261\244m\273"
+	.string	"I\222)\005\213\001o\001\221\001n\375\276\3517\242)Z6\326qt6\355wP\275\263\3662\336\326\375v\016g\323\031\242/\232v5\316\266\006\007T\323\032?\211\314,m/\202i\220PKk\314\365\312\241\331\241f\343\330\252\302\327\332\317\230\3517 Y\263:\2738\216M\004st\277\336\276\253\365\333N\306\257\260\247\351\360\330+\366 Z\314\374\330\305\261\325\201\267M\"\350-\324\357s\367\204\n\260[{\270\365)\332F\205\023\307iQ\255\301s\267S=\f\354\325\037\236\024\307P\366\332\342\330\032\325\020\202\336\266\325\231\\o\203Nt\275m\270\273.@V\274\244`\306gK-\033\307\261\324\217\365\223\377\254\336K\031v\246%\242R\022\322\221Q\321\360%\022\006\201n\373\373\f\267\2539\202h\335u\016\315s\351L?`\026\027\026\217\353\272\362\233\312\263s\343g<\013y2\363\022PC\024/+NT\272"
+	.string	"\206,\211\312\224\214D4\005c\245\342\035\031\305u5\221\346\"\240\2060/)>d\342\346\007\312\272\300\362\033\327U\345\007U\326\025\315D\217f\206\212&\364\262.\350\201\270\256%9x \314\353\313\201\277\001\3229G<\256\353\353\247\340\316\324\317\373\334\312n\322\013\220@a^U\2745zj\275\317\254\374\3735\260kS\350}6\177L\\X\234\316\346\271\3103+\277\237\361v\212\305\216\212\027\346e\3053PC\034\307\235\235O/o"
+	.ascii	"\336\355]\335\355\245\373\365\021/\231\237>\300\217\332S\365"
+	.ascii	"=4\216\244\304q\323\235\335\360\025\247\203\2638\361\016\326"
+	.ascii	"\256\235\323\343>\360\232e\316\231\204\314\361\340p\313\240{"
+	.ascii	"gq\334L\272\034\274\305\255B\365\262q\334\234\272\343q\260\331"
+	.ascii	"\017\366\002\243\2710\030\327\333\005\357_\320=4\b\376\373\366"
+	.ascii	"\237\336\264\244\314\334\327\377\277w8\214\327AzS ,\036)5\216"
+	.ascii	"\233\026\334M7"
+	.string	"\017\247\003\213\371\246@y\230{\3249\016\267\201\203\207\354N\020\256\267\377.\037T\017\257\352\237\037\370\266\305\327!\\\216\b\327Bww\3608$\\)\324\320\024\326\341\224h\267\202\"\2733\205\353\255\277\263\371\207;\250\036Z\025+\367}\031l\326\363{)w\257`\221\335\231\340\013h\301Y\361\354\230\277\354\2662\363\213u\373\224\224\274\272~(\335S^u\237 !\3020w\224\247\361~\340Vw\007\237\233\201\257\361^\220\224[\201\247y'\3607\336On\306\273\300\347vB\312M\340s\017xs\013\030\346\016\360\271\233\204\271\001|n&a\356\245\317M\374\334JG\271\223>7\222Q\356\243\317mT\224\273H\230{8\314\375\016s\023\275\271\205\237;(\314\r$\312\355~\356\366s\377\204\271\377sgan\307@\240\356*\227f\326\347\347\2541W\237^l\247u\223\305\337\270\247q_\343n\306=\255;"
+	.ascii	"\362\310\260FL\325\353\034\345\031\323\273\230~\301jI\231E/\341"
+	.ascii	"\363\236r/3AJ\321)\3732\030\274|\237pP\242\031\272\364^\215\272"
+	.ascii	"\341!x\362F\316\360\305\232\030v\245\323\314yo\256\322\023\037"
+	.ascii	"\370\226\364J\357\314\254\004\316\nf$9\t\274\025\004\026\"\304"
+	.ascii	"\3656\351+L\251\036=\322{\273\310F`\"\301\316\317\354\005s\365"
+	.ascii	"\0236\222\215\270\336\036\275\320\315\2037zws\021r_\312l\361"
+	.ascii	"u\332u\214\313\013+q\213\376\nI.\002+\001\266\231\223\225R3\021"
+	.ascii	"x\213\023\363\220\242\347\021e\203Vm\035\351\016\377\301\347"
+	.ascii	"=-)sI\016\202<z\316\311@\362\326\360]P\224\r-\210\026\033\035"
+	.ascii	"\321\317\257\326\262\251\260\207\353\340\235\210\350Y\016\222"
+	.ascii	"\013\276\230\027\243\231Y\334\021]\313f\254\274\374\212\256e"
+	.ascii	"\357\336\357\203\247;\242kg|{\255\232S\320\3379\314\304M\360"
+	.ascii	"\3577]\317\346\264\244\235\305\352\315\001\341&.\203\fF$\356"
+	.ascii	"\316 \271:\317\340\201\204\266\370\210>\301G\275\267\371\207"
+	.ascii	"20:,vM\013\036<\315\020U\313f\r\021}\206\250\032\236\253)\263"
+	.ascii	"t\272ND\304\200I\343\017\353vx\352v\303O\374\016\236\356\200"
+	.ascii	"\366\r\022\344Z\240}gwX\271\357\375PWs\253\305\341.\370\242\352"
+	.ascii	"uO3\347\345L6Vd\357\367b]t\205\177u\345\323\314y\035\225\335"
+	.ascii	"\017~7<\006O\311\356\024>T\326/\033\370\301wBU\374\0172-\003"
+	.ascii	"\002\262F1\231C\312x\264a\343X5\240eP%kX\275h\215\307b\262\312"
+	.ascii	"\230\343\203R\210\032VF#\225\214\252\341\016\253\027\306b\253"
+	.ascii	"\343h|\252$U\207\035'\254\220)\214TU"
+	.string	"\303\030E\030\306#\007\253$\325\211\032\307\253\244\361X\225\324U\020\220I\243\225\215$2\307\214\027T-\252\256\244\252`H\031\213T6\244\252\256\220R\020\f\364\361\206\325\225T\362x\274\222z\255Xv\256\346\301\265CmxvX\317\264cz\261>\312#N\375\363\311\016\274\300\013)\360N\317\201N\246\3460\375\226\247\335\332\315\365\326\351\r\354\371\302\312}\2778\216\343\245\007^\340\247\336\317x\313\0075\304\234[\2232s_6B|\261/E\340\030:Z\320\316\364\234\335\215\310\004\366(\37343\227l\326\242\335J+\377(\001ew*\001\271\336\022x\002y\226|\201\310\335\312AJBN\007\350i\247C~\372\001?\341\273\225x\312C\331\235\r\245\365\313V\360\003J0\301\030\332\342\353S\360\235\267\276\224\254uw\\R'6\2548I/\326.\241.F\021\336\251^\246l\261\031J\370\247\027\342\200\\"
+	.string	"\237,E,W\004\274\360\tG'\rS\305"
+	.string	"\226E\206\224\263un\\\322"
+	.string	"\271\n<\025.\341\250T\362\224<NA\207<\301\007xw\213b\257sk\271\351cE\341\022\356LJ\215B\302\223\002a\251Rj\026\213b\375\035\013c\0365}\004A"
+	.string	"\276\351}\212\244 %\f^\276O\340\254<q\002\340\275-\372\026\200\362\250q$\246\220\203\210FDDD\222&\031\016p\002\221\241\243\342\006\021@=3\306f\244I\322~\006\303\363\220Q\203H\204\007_\343\315\235J\202uT\206\f$k\237\013\233\264r9\306\234\221\354\214::\034B@\b\227PO/s\f\236\331\347,\241%C\223\310\325\202t\302D\360\016\351\277\222~1\227$}nt\223\362\037\007\177\004)z\255\363\314\241\337(\320U\263f\356,\277\221C\2435\3207N\257\b\311\233\230\361g\022\f-n3\227\345\260\312'\226d\270\221\325\tA%,\004P\211"
+	.ascii	"\345\260\016\273\245\334,Q\377\251\205\236Ql\362\331]\232\275"
+	.ascii	"\336\233jB\247,\361\034\214\222A\003\242\022\312\016j\035\313"
+	.ascii	"\272X\217\335\306\276\233\255\022\242\023\214|-\320ooT\006\247"
+	.ascii	"@\252\206$G\"\202\303\366\3636\247\233\352\320q\206?\f\370U\242"
+	.ascii	"\252!R\003\314\276S\t\036F\206v\223`\276\236\001\341\224\231"
+	.ascii	"^\332Q\301K\222BN\200\027u\307\337\234o6\352\374\352H\027\276"
+	.ascii	"\006\003\212\023r\312L\321[\206c>\217\006\326r\277\233\230>x"
+	.ascii	"\206\377xb\002h$\340\240X>\3000\351$\330\207\302l\301\267\270"
+	.ascii	"B\377q"
+	.ascii	"\032\001\250\2302\210\321\224*\361b\243\210U\nS\253\366*rP\271"
+	.ascii	"\003y\362\202u%\352\355S\210\004N\"g*\243\b\307~\233\031\005"
+	.ascii	"\021\343\306\3643\324\374\177\247\n\325\241!c\366\233\230\323"
+	.ascii	"\206\034z\210\024\246\n2_\346\347%(\306\200\0071E\376\251\343"
+	.ascii	"[\002\007\342\032\341X&\355(\221\2243\214K\036\220\345&\350!"
+	.ascii	" \3616\251\332\n\200\006\350\177\252\242z\2034UFy\fi\307\006"
+	.ascii	"\236\220\366#(\006\t\342G\227g\342\tCJ\354\223\310\016\255\276"
+	.ascii	"]\2743\323\023T\210\351\030\223\341\305D\321\272|\256\264\226"
+	.ascii	"\327\353\303\270\367\007"
+	.text
+	.section	.gnu.lto_processContinuosAdjustments.83.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`\003\016\305D"
+	.ascii	"\212v\004\032<@\346\316\030\347\230\307\034\327mO\330\307\226"
+	.ascii	"\304\240\347\315\366\313\220\325\345\233\207\314\222&\n_\345"
+	.ascii	"8\2103{\273\033\350\366\363\274\322:\246#\213\020\273FMDT\364"
+	.ascii	"(\332R\344N)\245\215\001x\001\224\001l\353\274\262\316E\326\371"
+	.ascii	"[gg\235\033\303\222\030\"i}\246\372\276G\022\037\275|\253\034"
+	.ascii	".=\247\033N\367\232n\273n\352\236\036\203E\365\310\321\231C8"
+	.ascii	"\227\005\254\335t\236\216\216\303-\242xo\270\361\340\b\0014w"
+	.ascii	"$\006\033\346\243\016\346\321l\270\027A\017\013\231[\rw\265\357"
+	.ascii	" Lp\333n\331\257\363]\226\211{\244\302\270\346\307\263K\034b"
+	.ascii	"\340\373\322m06\035w\035\037{eF\323i\334\246\262^\277jo\007)"
+	.ascii	"\2143\f|\337\227A\257\234\301\330kU\361\217\314\334\316\334e"
+	.ascii	"\332\214\333S \355\364\276m\210q\336\227\256\001c\031{e\272N"
+	.ascii	"\262\275\032\033\212\355\225]\346CTf/SB\034\24235\205\357\373"
+	.ascii	"f\275\025.\320E\272f)w{J*\031\005\365\344\324\304\264\244\204"
+	.ascii	"<&!\031[v-\276\273\334g\272H\345M\365\231\306\354\251bkvdK\367"
+	.ascii	"\241q)j5\n\224\323uM\227\252\242\266\245\223QZ\032\252\315\360"
+	.ascii	"\204\245\235\2604]\331ss\246784(\276\364\346\206\315\225\016"
+	.ascii	"LQ{k\344\333\261h\025\230\267\250\373\320\240\305\344\221-\317"
+	.ascii	"\316\213z\222\023Gj2'm\\\303\353\003phM\274\355>\264'n\316\234"
+	.ascii	"-&\375P1\324}hZ\212Vlz\222\034\323\234\276\036\323\314\274\330"
+	.ascii	"\207\226\245Xu\327>$\255\314\277\353:E\234\241\340\024\265-\355"
+	.ascii	"m\206\367}\331\237ij\315T\315\334w\314\314\204\031\311$`TBe\336"
+	.ascii	"\210\023x\373H_\3340\336\317\244\2572{&\033\037\351\033\320\215"
+	.ascii	"\353D\313\243\224AA\3437p\2336\"\345\322\240\367-\353'\263;\327"
+	.ascii	"\207\\2\r\225\007(\312\nh\250\375\226\212]\365\271\204"
+	.string	"\3145\323\204~\260p\320D9f\006\353?\367\f;\205\"\026\276o\231\240\036\244\241\310\241\003\373\201\355\325\352{\r\23287\305\352\365\331/\240W\374\365;D\373-{J\260\017!\240?\305g\021\241\210\206k/\331\377\005\357\207N\266\246\210\346[2\245\365\td+\363\276e\024\272\r\263\217\3563\342\247\004\375\232\205e\3664\037\022&Px?U|\017B\021\347\246\375\376\355\2363D^\321yX\260\213\240\207\024\246\215\307\005+\007=\224{\337W\313N\337y\301\235\245W\206\261\345\375\354\225\233\213\355\265\277\357\332\303\"\350\241\341\224\314\023\277Z\307,\355_\312L\327\364\326\272\322(\220\277\215\231u\266\300:kU`\235#@h\235\035\364\264\033\253\34747h\235\257zM\263U\3335/`\235\025\264\316\tZg\004\r\247\371@S\233\253Zg\003I\316\005\224\234\t\264\316\003Zg\001\255s\200\326\031"
+	.string	"\322\231\252u\236j\235\245\220\316\311\3269\252u\206j\235\237Zg'\326\271\211uf::/%9+%9#[\347#\222sR\353\214\304:\033\215\316m\353\034\315#\323\357\212K\275-\331%\2527\367"
+	.ascii	"o\320\024%\f\316\235\347\236\271B\224{|\315gB\361\341\203\202"
+	.ascii	"|);\350%\253\340g\f\361(\313\206\203\302\366D\201C\t\3578\241"
+	.ascii	"\275a9\276\224\257\252H\330\220\330\306\353\216V\323\020\215"
+	.ascii	"\020\376\300\017q#\035\341cP\tu\036\273E\334\311\262\004\224"
+	.ascii	"\260\320\233\270d\332I\n\240G\276\346K\234\211\222\3555\302w"
+	.ascii	"^\027\343@\t\r\247Z~\365Vi.\022\357'7^G\321\r\222\3413{&wb\324"
+	.ascii	"_=\373\331\032\202\207\372\250(\240s\214\323#x\366\347`\217G"
+	.ascii	"\016\036\312\241\212\234lmY\202w\360\354\242\246/O\237\340\331"
+	.ascii	"\235\204\310\177\372\251?w\202\316\020\017<R\227f=\326\351\r"
+	.ascii	"P\357\3728\3074\223z\3116=r\252\304\213,\215>\304\211\270L\232"
+	.ascii	"\270P(\333k\323\267\0367\243\035j!\244\227rw\022\0328h\374\266"
+	.ascii	"c\313\004\364\207\372\307\364\020\376\337<\361 \313\256\033\344"
+	.ascii	"B\3613WJ/\212V\013\235fL\337x\355A-Z5\004`\2476\250}i\273Rv\351"
+	.ascii	"\033\216\372G\305\311\\i;\211V\235\351\357\322\267\233^\235D"
+	.ascii	"\253s\3236L\034=\331\227\262\322#\277\247XiD\327\255\003\243"
+	.ascii	"j\016\037)\375\205\032"
+	.string	"\335\310u3r\027\266\241\373\346jq\271\270\313\205\355\025\371Hr\026\374\361\217\177\354\372\234!\262\240\"?m\353K\271\177\260V\2574\246\373O\2414v\305\2272\0166\351\003\\\243K\307\215\255\035k\230W\230\262D\r.1/\036aL=\272d|\205\270\321\365\365\265U\203\013\371\245\364\022\343\372\322\341\341\311\253ix\315\370Rr\350\022\333:qC\t&\366\245\344rb.\2540\261\257.\034ba:l\310\330\202\301\005\226\3055#\353\313k\013G\026\027XX\026\226\001V\346\350\002\313\022S*\301\262\216td\375mg\272\203$\362\302G\366\315\251\227\262\022\233d\205\177B\316\240\253~H\325\033x\016|\334\215\277a=@\246\343\375d:l\257\006~\352o\215\314\023\273\370\276\357+u\325U_\341\273\256]4\317\3409\222\344K\335\330;\327\255G4P\241]\265\357z\205\213\006*$t=?T"
+	.string	"\243^\372\256\306uk\264\250\237\234\3279u\005|\016:\032\247+\200'\3527'\007\n\204\023\020\034KTU\366Lf/\343f\272\270\263\360\230\2421F\336\3171Fl\257\004\212\203\321=skO{\254[\025A\247\227\262\224\266\2607\267l8\27181\026\376\352o\235\256\351iz)k\355\201\371\342\307\217\017\316\213\326\367\036\007o\360V\217\365\314c\216\306\016\275\237\\\344\033\334\303\347|&\017x\001\337\340\037\320\311\226\374\001\237\265\347\t\003\274\200W\360\3069\006\300O}\200\027"
+	.string	"\350\204\243z"
+	.string	"\337c\211\256\305m\266"
+	.string	"?~]\262\274Q}#r\023k\223\372\251o\001\235lR\337tz\005\225\215 \343\232\323\215\351\245\374\207\250\177T\202\b\323\226^\312\3556\331\344w\037\323\253\270\001\201\013\250a(\246\024SH\251\021\021\221$I2\034a\005\2040&\241\343\r\021P1$\246FDH\322\f\373\006\355b\360\023\250\300"
+	.string	"\032\301~z\fK\005\365O\225\261\001\300<\206\3260(\177\266_K\027\351\2070-8\002\360\022qH\214c\353,;G\354\252\216R\316\245r\250\240\221@\003\r\251\224B9?4\234(\251\344\362"
+	.string	"\305\217k"
+	.ascii	"m\260\307\201\234/z\303\203/\017f\341\"TG\302z\322e M4/8\255"
+	.ascii	"u\336'\t[*u\035$RP\301\025C\016Z`\340\302$P\301\327X\324\t\211"
+	.ascii	"\336\264\0020\204\022\323 \307|\2465\020\307\303\035$\362M\340"
+	.ascii	"^Ws\032\347\270\236\227\242Q\2415%\033\3370e\203'A#\262\262\022"
+	.ascii	"$\2250\t\bd\362%\212O0n\270\315:\244\033\016\2163\213\"\200\350"
+	.ascii	"{\214\262\230\214S\246fZ \326\333$\204L\031\371\247\032\177\005"
+	.ascii	"P*\374T\226m7\020\330n\374\213L\"\267z\205XD\n\331\365\017\353"
+	.ascii	"5\210\260g\372\325EE)h\273o\363\255w\220\202\216\354\3406\230"
+	.ascii	"\n-\275\331\264\2717\210\374\210H\207X\373M=.(#8\331"
+	.string	"o\304\341\n\307\002x\265\204\332i\277\2340\207\030@^\364?b\370K\225x\354z\227\222\244\013&R+\375\"\267\377\272\365\022\246\222\360R\3562\323:v\307x\234\361\250.\371\217\232\334\2652\035\031\225y\032\335\362\f\267\214\222\224\253i\256\034\323V\026\036\325\"\005\333\326K\245\366\340\367\204\257 \2059LD\037\247W\217$w\307\223\250q4J\022\236\220Dx\367I\224\312\177\206\375<-.\345(\2045\032\351\260\345\335\213\231ai\242\031\377\207\003\034\302\006\201:8\034#\005v\013hI0\343\330\2154\377\222\246A8\225\377\372\035A[\270\030Qh_\231\236\201[T\031\030\326\214G9\257\bH\247:|\b\210!"
+	.ascii	"\216\306\272\207bE\0037\035\b\025"
+	.text
+	.section	.gnu.lto_processRcAdjustments.84.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`r\001\315\017"
+	.string	"\006\036mH\340\220j:\3629B\236\244\356\271\020S\200\274\307d\"-4\tj\032\257\207_z\206\252sp\b\001\231\332f{\323\r`\004@\315\361\232P\312\020\247\340p\f\235\304\240\376\304\221\021\347\245\r\312S\360\t\221\210\020\271S\nX"
+	.string	"T"
+	.string	"U"
+	.string	"\336\273\315\007x\357\\\262k\374d\251\004\\-T0\267Z+\270#^\272\327qKK\376a\347\230\254\362\336\207w\334\201Z\314\215\017\026\007.dU\302LQ\316\303\227[\220\272\251|\260P\\\207F\025\343\260\323\016\254\023\245\337H\255\325\324d\245\334\337mW\260\375\300~K>Wk\255\336\226\375\327\317\371y\177KM\227\372\235\002;b3/.\027K;\353\252FG\235u+Z~\376\366\017\263\207\0250(\375D\021)\317\272\372fR\314\\n\265\236\b\336ydsj\337\345'J\177m8H\255-\031\262Z\317\004\366l\336\371|H\234\265M@\"\251-\367\"T\300P\3550\321\032\016"
+	.string	"\265C#\275\351\243\260\305\230&{\205\330]\261\347_\t\261\031(Jc\377\3450f\341\2230\006\313\320\233\357|\313x\357\276OQ\261\201\003\204\211\326\330\243\366I\006z\363\333\255\331\\\263\323\226\366Y\322]q!\031:\320@\362!A\020\205b\307\004T\"\032\033|\310\220\304\3028\"E\243\bb\321C\"E\237\020I:\2410!\214 \216@\261\004\024\201\302\020(\216H\240\307\200\307\013\237\021H\216\343\b\3648\353\271\272-ol9f\246=y\002h(\276\230\241\266<\013MM\326\241x\337nI3\021\243\021\200\322\r\032"
+	.string	"3\241oi\214\257\301\322\260\367\250\306[\027>\203\323 U\304\001\2175$\006CO\215\254\314\342\036\366*\332T\026z\310\306X\323\256\331\\\270<\316F\236j\032\270\220*\\\t\024"
+	.ascii	"\206\233R\250="
+	.text
+	.section	.gnu.lto_activeAdjustmentRangeReset.85.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375 \356\225\006"
+	.string	"2\f.5@m\223\016\274\340\323E\005X\003\3458JVC\026y\t\313c<Y\311B\212\377\315\340qoMSo\307\035\3152\214\230b\016\360\221Tz^\237\242\035\204\310\024S\323\205a,\027\354\212x`\250,PV\244\032\"\306\241r\211\224u\305\351\340\n\302bE\254\252\254(qY\310\031@\361|4\220\342\251\327\243\037{.\307\023w\257Z\243{\027\320H\342\242\003\235h^\350\271\314\203\031_\200\204\234\207\005%\"[IB2-B)\371\211F:\376JgoRn#\r:\030\025 \240\314\214P\243Y_v\333)\201\266e\372\004\0242\363\247m\233\016\373#\374\t\377&\b"
+	.ascii	"3\001\0078\003V|\241k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_blackboxLogInflightAdjustmentEvent.part.0.103.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`\022\002\035\022"
+	.string	"\366\240uI\320Tm:\250\365B*)\271\330/{\361\035\3330\211\016\007\003\f\263\204\003\344\024\210\002!\005\225\024-\252\364\373VB@7\037\3301\013\334\"Y\224B\361\210j\006\022K\273{\270\241\026%Sq.\351\217~km\357\224\002Z"
+	.string	"c"
+	.string	"b"
+	.string	"\257\252\272/\227\347\264O\3435V\267\341A\033\26024#\200v\253\202o>q\337Nn2\372\246\275\300\350\233}\031\266U.\257l!\257\260%\321\330\210\210\315v\267\373Fa|u:\265\225\377\330IZ/\326i\351U\342\263\344\032\351\301\356\2323qo\267\275\300\366hO\013\001(*l\246A\212\235\031\263\225\251(\3769\320\213G\003\0256S:q$\004\217\331n\355\276\271r\323\276\277\363\034_f\223\217\352=\245Od\352\262\\>\317q\254\336Sr,W\005\232\035\242]\027\3127O\020\002\020{y\216\351\253\207i\3721\225m2\231\316\343\334\300\230\336\300\360"
+	.string	"\355.\004\356\233\347\f\001\356\215\354\017\234oy\305\246\026!\002AY\366Q#\033\303e\250\240\241\031\021Jm\226\313`H7\206lTLj\273\\&\232\300v\227\301[CN'\275\354\t|\374\300\001\242s$f\026MZc\252iK_\330\307\371)iz\276\376/!\370\021\260b\227D\221\221m\261\351\210q\237\007\251<j\033\316p\352 \252\260|^\213\212Gz\021\310\020\344"
+	.string	"\222\200e\213G\341\005\f\271PD\221_XJ(\361w\032\311\020t!\307R\303\212\227\362\245\272\357B\027\242<\227\356K\215\335\351\200\305\r`\252#E1\325\231l\317\373\234\016\013\241\030\372\301\224\322\032\333\245\266\353\302\301}~\242\233Yd\002\3639.K\371\216 \2550 \260\002\231\244\325\001\244\202\237\314G\210{\177D\331\342\n*\240av\034T\024\236$[\256\214\216\304Z\204\225(\016s\277\306_1\0026\261\325\001\334\302\025\001\317S\220\335\232\367\301"
+	.ascii	"f\303\305\004\355F|\f\004w\316v\035\353\333\277\364\016\223\260"
+	.ascii	"\002\276\260Ng\355\354\233,\231e\201\341\274lY\240\274\270;\245"
+	.ascii	"\246\237\320\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`a\004=\024"
+	.string	"\306\336uI\300\026U:\330\376\004\202\020\210@\021Qx\270\213\013\230\271\237\374]\336\020\323\215S;`\263dk(@\261\325G\352\243\202\260\336\202\246YI\266MQ,F\210qN\030\315A-Q\003\242\254\217\023=b\222y2\241\222\310\024]"
+	.string	"a"
+	.string	"e"
+	.ascii	"7\337Rt\301\3366\306\202\275\024\260\202=\215\302w\023~\345f"
+	.ascii	"\347\347\223`?\005\214\360,!\204\253\275\256\353\356\201}P\r"
+	.ascii	"\200{\357\265\261\357\201\016\016\245\301\201\302\276\f\036%"
+	.ascii	"<\216\005O\025\374I\330?\273n\202\377\204\377G\367</\222\337"
+	.ascii	"\3764\035\\\316\210r\020\330\327\300\377!\2129DR\343\234H\315"
+	.ascii	"0\032\261\031\306\355E\346c\314\200\367\212\300\373\204\375\315"
+	.ascii	"\204=\257\204=\027\022\366\271\021\366VD\330c\ta\257\003a?\364"
+	.ascii	"\301^\213\007{\034\337{\177"
+	.string	"\325\332\301\276\ns\270O\370\327h\311\210\321\202\265\242\225\202\005\303\346\354zmx\023\rw\022f\260\027\002\317\233\004\203=\0250(\221\330\311:\252\265\201\316P[\351\213\223\245\002U\235\3469\243\232\324R\032 -\365\b-u\312e\216m\316Pc\233(\243hg\2164\366\210\307\375\203{\355(0\366*56\257\352\017\214/\355\245\252\254G-\242r,e\235\033(\r\264\345\342d\201\252\320S*\223\226T\026\260\3532D$\265\250\262\210{\005\037\235\314;\277\242ZijNGS\363\311\357\325\224\004\271\251W\006L\235\342\231e\247`<\342\021\362\005U\222~\344\360\224\312\236q\261\214n\b\b\252\244\001\342AD\226-\272\312&y|&9[\320\211<\320#\214\030\2214}t7\221l\236\361mGV\237\212l\034\346\230P\354VC6/Ae=F\002]\250A$\224aFi\nJR(4\006"
+	.ascii	"\003\031\"\326\001\021\260\034D \242h2\n\222t\310\354qr\363\314"
+	.ascii	"\004\245~\303>G6g\232?\036\362\363i3\007\301O@\326\240\022\241"
+	.ascii	"\020\037\260m\371\332\225\024\372Q\004?\020\360U\314z\376g\314"
+	.ascii	"\350\367\324Q\023[\252\271Y`\023\324\234\365\266\205-\217D\202"
+	.ascii	"\322A\200v\334\253%\004i\020\243\004\177\265\200\325\277\367"
+	.ascii	"\357\375{\377\372w\257\210\333\274\035\222\340\033c_b\016)&\270"
+	.ascii	"\345X\003\033\321ow4\f\"\302\262\325\364\016D3\200\332\036pR"
+	.ascii	"\364\337A\023\304\273\335-\340mw\252"
+	.text
+	.section	.gnu.lto_.refs.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375``\001-\f"
+	.string	"\006\030KA \311(\215\001\241\\\235k*Q]($\326V\327R\223R8.\246\262\337\233\210o)ZM\361 "
+	.string	"\022"
+	.string	"R\t \b@\240\217\025p\240I\371\327\247\271\033+g\266|[2(\266\221\275\345\226)2"
+	.string	">"
+	.string	"B"
+	.string	"\t\366'\260\337\261\217\3327\355\223\3669\373\2464D\226\223\262\374\341\345\335{\207\230\207b\016\2129\227y'\177\203\257\351k\364\241\276\365\345/s\317?\220o\202?\301y\211\355#\340\223\364E1\357\342wb\276\372\033}k\340\277xCwf\260@\001\366\340\265"
+	.ascii	"\201\201\375l\001\220ya\265\254\240\234\354'\211\366)\022\273"
+	.ascii	" !\202\003\006.\355\017\331\234\310\243y\364\f0\023\003\303r"
+	.ascii	"aQI1)\031\t\211a\2500\001\006\241\301\313\245\340@\201\001\002"
+	.ascii	"\264W\355k\354\237\366)\366G\373\334\276f\357\224^\345s\304<"
+	.ascii	"\245=*>F\314/bn\001\003\213\236\276\356\235\231\241A\371\255"
+	.ascii	"\367\037Y\356\221\345\253\355U\332\247\3647\3643\364O\372\025"
+	.ascii	"\372&\375\321\347;\370!\370\237\354\271m\365\275\201\037\365"
+	.ascii	"U?\0037 \220\223\244\260\r\003\223\fq\275aq\030\325j\331\312"
+	.ascii	"\336e\265\202`o\031[\221{\313p\345\275g\331\212\275e+\275gr\331"
+	.ascii	"\312\275e+\366l\331\345\337\030v\221\027\355-\263\262\267\354"
+	.ascii	"\312\331\253m\355-\263\262g\331\312\275\353\313\256\354]\266"
+	.ascii	"\262\366\312\256\350\f"
+	.text
+	.section	.gnu.lto_.decls.2664a946bfbeeeed,"e",@progbits
+	.string	"(\265/\375`\266L]F\001\372/*yV \fa:\215\001\300\037\304\345\234\216\034\241\207p\031\237=\013\363"
+	.string	"\037\311\003/\313K;?M\016\215\030\336\032\312|fn{;\035\031\201{\340j]\327"
+	.ascii	"\200\337nu'\261a\363XX\374\302oW\202\225\305\230c0\035wN\334"
+	.ascii	"\364/o\241\221do)\245L\001\301\006\205\007\310\007j\327\312\325"
+	.ascii	"b\333\270r\2228\343\336[\351\252\335\261\353\304\266\201e27\306"
+	.ascii	"\263+e\b\357\reF\254\354W\272j\227x\245\f=\021\367\323\216"
+	.string	"\310\236\373r\334{\377\277^n\227\373\345\232p\267\\0\227\313]\263\305\253v\247\374R\271U:$\2210\314n@\241\220\377{\345W\313\177\227\334\0367-(\210\f\030gn\276Y.\332o\332\305\262o\032\002\272\366\206\272iDy\366\206\"\262\366\002k/\310N\276\212`)\363\3137\332>Q\372\275B\344\246V'\354\346\227h\264m\263He\006{T\276L\323/\315\364K'\372%\022-\345\277Ql\232E\003AZ\204\006\225\233_\022\321\330\036\225\t\260H\345K\032\372%\224~\230&\277N\376\313\304F\261Tl\227\005\":D\350\206\334l\241(\37569*\261\270\210Dx\013\030\252<7\237\234\323\245=*}\354QYt\223\\\355\236\200\371\262\202\344\036A\201\343N\335\315\377\257\330-r\215\3340[\274G.\221*?\256f\333\254\354))\006\340\"\006\307\311\261\307\365q\257l\033\327~\2223"
+	.ascii	".[\34089\222\335#\026\316\232\026bG.\330\0352$E\334Y\031\350"
+	.ascii	"\202\343dl\357\235\324\241C\207\016\030N\0229V?\371$\020}\201"
+	.ascii	"\334 \266\370\265+\004\210\tO@n>\271C\237\330{o\373\265r\367"
+	.ascii	"\265\362$\227>\311B\237\334\372Vxh \"\316p\301\343\313\266a,"
+	.ascii	"Q\264\250\271\371\277^; `\3665\344\346. 80\026<\326\344\2708"
+	.ascii	"l\361\352\270[\305\262\253\343r\335\033d\304t\260\005\301Q}Y"
+	.ascii	"\225\371\322\2705l\361\302\265\261\211\354\034\260\250\254\233"
+	.ascii	"\237\313h\023\354m/\224\266\256\316^(\237\273\350g&\372\2773"
+	.ascii	"d\374\3141\"Qqs\214$\034C\213\227\343\315\317]\372\377\325\272"
+	.ascii	"X7\313\026/\214\313\342\231\270\267\225\275\367\357\224\325\275"
+	.ascii	"\032z\"\356\027\345\227\232\226\326qo\342\205qU\334\025X\n\226"
+	.ascii	"\256r\226f\2740.\225\026c\007\240\2647*0:\337\253{]\334\027\277"
+	.ascii	"W\267\305A\204x\220\324\275\312{CY{\301\220\265\027\220kD\240"
+	.ascii	"\316"
+	.string	"\312\374\\C?\307\320\307z8\334*\037)\"\221\017\0339\034Vn>\246\243\217\341\364\361\232\346`\221\312\377J\335\250\240\2705 :n\276P$\226\031f6n>6\323\267U\336\354\233!\251\242-\365\245Cl\217\255c\365`\242\330.\313\031\230\335c\341X9X\n\226\326r\226\303x\367}\262u\266h\367\3309\267r\226\316s\207\016\035\222p\216<SP:\347\271\240\273DY\301\335|lD\333\241q\307\342\261EKg\347\016\"\004\031\235=\3260\356M\354p\241\203\225Sr\234S\346\343\035\372\370J\037\257\320\307R\372m\026\251\f\262G\345\257\2348\326\230\207\2409s\207L\234+6\216\270\207\n\307\315\277c\332\236`\341l\321\272\371m\033[\345\331\254k\027\367&\na\250\031e\324n\276\345P\022\325\325\325\325Y\016\345/\022\235-\233\337>\261dv\r\256j\321\265\255\354M4\"\261\304V"
+	.ascii	"\271Y\rQj\357\235D\202\\\032)7\377\356\320\017\241fM\300D1m\025"
+	.ascii	"5f\334{\177\2030\273*_E\214dd,\225!\250\242-\025\025\345\267"
+	.ascii	"h\354\031[\306\232\261n6\215-\3326+\346v\214e\373%\356-\265\367"
+	.ascii	"\276\215\362"
+	.string	"+\335\266Y\242\245\202\211[\264\212\2632c\232\226'\266J\233\265b\321l\033\327\306ndZZc{\023;t\350\220\324\241C\207K5\327\2428\224o\345\350o\261H\345\217=*o\317\350[50IA3\314\344\314\270\371\226\250\377\333/\326\213-\3325\313\305\022\367&\356\275\037\242\213E\033z*\332QnP\304\366&~\203_\351\007\021\302\256\331-\026\r\023\305v\224\033\227\017PmX\3249\356ML\352\320\201<\033\203QW\346[-}\033\245\217B_\325'\241\223,Ri\257X,\266\250\301f9\210\020\307Of\233lo\"\221\320\236&{\360\334\374\017\350[\r\245\255\263\032\312\177\240-\260H\245\225b\315l\021\003;\345\026\212-;\tE\334\304\275\211DW\210\236+g7\237\001\032\203\331\016\361#}\213A\211\353\352,\006\345\257\326\300\"\225E\026\251\274\366\250<\321\"\225\332\036\225?."
+	.string	"p\305o?\034\340\267\036\376g\251\372o\b~L\365\333\fN\341'\035\360_\022\374\376\244\214\377\236\341\375_1|\202\377\242\300C\013\230\340F?\231\365_\0238\301%\370\337v/\377\273\3747\n&\301\177\315\377\016\361\b\376\037\255\206\223y\026\002$\221\200Sp\300z\340\024\370\311\025!J\240\030\376\367\007^\261\372_\017\330\3269\031\354\301o3\300\016\020\301\1774\377\323\374X\370\177\317\225\372\032\374A\360\177\022\006\277\025z\006\ft\372q\323\177\022\254\007.\302O\366~\253!\303\335\302LF\266\350\267\372\267D\377\263\\-\274\364[$|^\027\330g\346e0\005\275\377N\211\200/\3701\t\023\356\0310\b\376+u\020\177\256c\301$\200C\360"
+	.string	"Q\303O>=\213\365\300\005\360\223&~{\366[ \377\247\374\026\354\267A~\373\343\267D~\353\345\267aC0\360[\r\374\027\307\177#\356\300o{?\346\300\177\205x\003\277\035\341\267\017\300\007\320\300\177\002<\303\177s\374\230\204\377$X\017\234"
+	.string	"?\231\201\377\272\370O\367\277\356\267\377\277\347\267\367?\234\377p\377\217\377\363\374\377\371I\r\377=\3767\317\177\361\374\367\316\177\353\374w\356\277t\377\335\363_*,\302\177\323\374\227\316\177\345\376\017\375d\335\217/\360c\n\374X\002?\216\300\217\037\360\343\004\374\230\203\037{\370q\207\037\007\340\307\026~l\377[\367_\265\377b\371\257\225\377R\371o\361\277\304\377>\371\257\222\377\"\371\257\221\377\016\371o\220\377\202\375W\307\177\271\376\013\343\277W\377\245\372\257\t\376K\202\377\246\370\357\322\177\207\377U\377\233\376\266\202\337\322\371\255\331\177\205\277\355\300o-\370m\205\377j~+\364_\340o3\370o\t\377m\372\237\345?\t\377\215\377e\372\357\371_\020~[\347\267q~\013\347\267q\277}\363\333\363\267\036\370\355\006\277\005\361[\001\3746"
+	.ascii	"\277\275\340\267H\277\305\377\327\374\037\361?\204\377l\377\203"
+	.ascii	"\352\352\352\352\376]\003\376\"\023\376\0200\002\307\215\265"
+	.ascii	"3x\322\022\375<\227\217\317w\212\371N\246\323{\357(^\274\310"
+	.ascii	"\214m.,\016\377\353<\323\035N\320\316@\246I\022\206\345\346["
+	.ascii	"\300\243\377\333\337\277\334PX{o-\222\270\261\242\202\312\337"
+	.ascii	"\336\222\326r\370\205,\266\001\370\237\361\317\033\356=\265\347"
+	.ascii	"m\357m\351h$jP6,\330\377\177\262mo)\257\247\007xeU\025\275\262"
+	.ascii	"\214\252\244\274\266\252\212^YFUE\257\375$\025\366d\204\265\275"
+	.ascii	"\236\252\212{\033\355\275\367\226\222z\372\240+\253\252\b\265"
+	.ascii	"\215\252\212;kO\245\311\262\233\350\365\264\245\272\266\321"
+	.ascii	"\226\332P\273\330\225eA\225\224WVU\021*\313\250\252\350\225\265"
+	.ascii	"\213^\273hKAa\255\220\332XF\273\350%g\027\273\262\212\252\212"
+	.ascii	"]YUE\2573\326\t\213\272\0312\364\274\t\241\263h\252\244\366\225"
+	.ascii	"\213\033PXEmU\304\256\375\266\267\265B\265\261v\333\336\001\330"
+	.ascii	"\373F\027\326\033\324\226\335\022\325v\025\205\006\325e\211{"
+	.ascii	"\357\013.\242\276\272\266T\333\223\335mUI\272\366N\022\325\264"
+	.ascii	"]\354\2757\002\236\210m\033\210m{\342qc\267\240\332\033\303&"
+	.ascii	"\356\355b\357'\273\333\366\336O{\357\035\326\r\342\3365\212\252"
+	.ascii	"\304\\\270\330\233+\311\305\276\361\304\205j\357k\005nKVU\361"
+	.ascii	"\253K\211\013\225\242\330VA|\262U-\272\266\330~\363\302\322\305"
+	.ascii	"')\273\305\336\333\312i\261,\030sn\256\223\265\306\230\341q\363"
+	.ascii	"-T\321D\240-9\256\304\270y\316\216\t\236\26097\337\002\231\316"
+	.ascii	"\306!\037[9\256n\276\005!\032H\017\221+\307\315\031N~\3633#*"
+	.ascii	"j\337|\0137\364\237\343\262\233c\232\213\267\fGb\321#$\316\315"
+	.ascii	"\247\340\250\211d{\023\207\312%CTpyk\263\273\234\274\335L\274"
+	.ascii	"dOA\302n\3763\233\354fEO\234&7\177\0030p[\216l\231L.\223\315"
+	.ascii	"d1YMF\223\323\344\266|&\217\311kl1\273e\023\216\345\3440\267"
+	.ascii	"]\270\304\361\362F\354K\3341\013\235\033,{\256X\321\343\226\327"
+	.ascii	"\334\030\263[F\313j\245\232\226\235\3431\251,\013B\344\210!\333"
+	.ascii	"*\213T\236\2024}\n\240\350S D\237\202.}\n\260\364\221\350\364"
+	.ascii	"\221\342\364\221\326\364\237\265<\253\245\201\240\254\222\362"
+	.ascii	"JrsNSz\326\362\226\305E\306\315\244=*\2174E\037\251L\037I\210"
+	.ascii	">\222\f}\244(\375\347*x.\215\221\275\361\036\272\255\025n\224"
+	.ascii	"\2648#\226\307r\224\f%\373\310<2\221|$O\311e\231J\376\221\245"
+	.ascii	"d'\031,\027sX\026\313g\031H&\313A\362\223\\$3\311J21\033\311"
+	.ascii	"C\262\220\274$7\311Hr\217\234\304\026\263Y\366:\266\312_i?\336"
+	.ascii	"\202\262hp\224r\f\265\343\212::w\252\304\224\\Y\2642U\260\330"
+	.ascii	"\214x+*\253\260m\\\r\030{c\334{+e\033X\346\334X(\321\022\243"
+	.ascii	"T#\323\310\242\004F\030\245l\226s\344\035Cxo\036Q\304\362\215"
+	.ascii	"+bzdX4-F:V'\210\225eY*C\344\336]cX\300\341-\234'\217\230R\236"
+	.ascii	"\221Fg+\323@S\222\315\362\013K\305\266\201=\200\214\214Q\211"
+	.ascii	"\0133Uqb\371)\316\026\246\253\023\3138\254d3\214gW\244K\2332"
+	.ascii	"\0169j\244\001!\343m\221\312WP\243\377\334\365\274\003\r\004"
+	.ascii	"\333\302\016I\335\325\234\233\263\016\245\347\256\rik\\n\336"
+	.ascii	"\331\243\362\025\314\350W@\323\257\340D\277B\021\375\nW:s\345"
+	.ascii	"\031ez\204\335\374\nT\372Go\364\217\330\364\217\242\350\037\035"
+	.ascii	"\321?\372\241\177dC\377H\206\376Q\013\375\243(}\nr\372\024\330"
+	.ascii	"\364)\234\351S`\242OA\210>\005\033\372\024\246t\226\312S\266"
+	.ascii	"\230\224\251\322D]\335\270\371F{\364\t\266M*_g\223\312\033\315"
+	.ascii	"\3217j\3237\242\242o\364C\337\350\205~\321\234~\321\030\375\""
+	.ascii	")\372E?\364\213h\350\027\255\320'\242\323'\202\323?\266S\207"
+	.ascii	"\330\325D\317\234\343:?\226\303t\356\r;\005\307\005\335\315\267"
+	.ascii	"\313\"\225\003\260G%\226\243t<g(\253\311\024,7\033\031/\354\230"
+	.ascii	"p\321\341#\016\006Z\312K\02628o\346\312\334@r\363\217\337\340"
+	.ascii	"3{V\244\f\230\233\353p\324\013\243\325\213<be8\310D\311\301&"
+	.ascii	"6\245\302\n[\265\2503*\035I\303V3\336l\3310c\334\242q\2021\356"
+	.ascii	"\312ib\334\342\202\303[\270\206\333\0317.\366\304]8dbx\312\305"
+	.ascii	"=^\351\211\273rSE\266n\224\251\303+V\030o\035\256b\021\205\252"
+	.ascii	"\r\\Y\210\377\2669!\212Q\351\f\357\300E0q\213\004\242\304\030"
+	.ascii	"\217w\200\210a+\214\345\206\347\366\370\257\235\253\007\307\255"
+	.ascii	"3\205\b\035:\260[\207\245\256\342\356\233[\0075\305U&\003\216"
+	.ascii	"\361\346\311!\326\346\276Y\271q\327\330\303\t\266\202q\024\303"
+	.ascii	"VZw\214q7\316\223*1\342\340+x\r\203\301i\330\f\236\202\255\340"
+	.ascii	"4\230\tf\303ex\013\206\202\275`5\034\005c\301\\\260\024\334\004"
+	.ascii	";\301h8\016k\301e\260\t\370\r\207\301b0\021\267\301g0\031\354"
+	.ascii	"\006w\301c\230\n\256\202\2138\013^\203\321`7\334\206\325\340"
+	.ascii	"1\030\016\237\200\277`3L\206\331\340'\266\210\317p\222c%x\211"
+	.ascii	"\230\232\361\332\301g\327\312\325\202\211b L\261adQ%\366\004"
+	.ascii	"\217\216\270KgJ\230\235\263;\327#\210\021-g\030\t\232\321\315"
+	.ascii	"\023\215\272]\203\355\307Vg8\213\316\2707\361\306\341\263;g\312"
+	.ascii	"\230qob\207\035\030\230[\236_\336uY\244\362t\354Qy\2422\372D"
+	.ascii	"Z\364\211\240\350\023\205\351\023\331\320?\366:.\362c\035\270"
+	.ascii	"\013\207\371\304\020\323E\313\315D\360\036\026Z\240\334|\242"
+	.ascii	"\030\372?\016\202\201`!\030\314\026\361\020\354#\004\017\034"
+	.ascii	"F<\004\377\320a\374\312\201\207\340\036\026m\003)sv\306\366&"
+	.ascii	"\222@\270\346\270\375\344\017\335\321\037\232\243?d\324\037\202"
+	.ascii	"\243?\024\247m\033\245c\257\314\303\316\213#7\177\350M[\243E"
+	.ascii	"*7\330\243\362C`\364\207\312\364\207\216\350\017}\351\017\301"
+	.ascii	"\320\027\252\323\027b\243-\260G\345\205\276\350\013M\321\027"
+	.ascii	"*\242/\304C_HK_(J?h\216~\320\031\375 /\372AN\364\203\274\264"
+	.ascii	"\006\366\250|\020\226>\220\035}\2405\372@^\364\201\236\350\003"
+	.ascii	"\201\351\003\311\320\007\332\372?n\364\177L\320\377\321\242O"
+	.ascii	"\264G\345\217\026\251\374\017\231\376O\020\375\037\033\372?,"
+	.ascii	"\364}\346\364\337,Ry\0374\372[\354Qy\2370\372>X\364}\244\350"
+	.ascii	"\373 \321\367\341\322\367\231\322\327t\364u\032}\235\246\337"
+	.ascii	"f\217\312\033-RymD_\313\320\327P\372F6h\362\031\030{\224\334"
+	.ascii	"\374;\305\206\247\254\314Q,\r\315%s\007\215}\243[s\323\\\267"
+	.ascii	"\253\346\266\331\342Es\317\374n\200\346\232\261T\206\240\210"
+	.ascii	"\033"
+	.string	"k\227f\254\213q\334\233\330\341\302m\025a\021\224\277\343\242\277\273\242\2773\323\3371\321\337\t\321\377\035#\246,\262&L\225\233\303$\371\\\255\245ar\363w[\372\226\r\312\tbfg\212\026m\b\357\235\243\314}r\325.Y\003\234\300\225\375WIe\233\305\302\232\363!\n\213\226\026\231\227m\345\031\036o]M\316\224f\300T\351\"\243F\r\352\207\216\233\313X1\307/k\204\320\351\277\034Sb\001\n#v\231\022C\346h\253\022\323v31\350\305\013!]&d9B\302\360\220\201\t;\216Y\263\342\346rK\271\245\374r\nPB~\216-|\3549n\256\030\034\376\322\313\313/$U\034\23547\227]\276\246\361\\\211\242\346\346\222\313\327vlf\276tX\260\246\377R\215\244\212\022\203c\311\315hhe\2325\333/*\224\371b\322%\337Q\342\"L\232\021$_-\244\\\271RbI\352z\2223"
+	.ascii	"%s\354\034\201\242\250\261\351\302\002tB\326\030\224\233o\201"
+	.ascii	"\216*U\3120\253F\234\373\242\325\314\274l\271\371\026P\231\231"
+	.ascii	"\225S\312+QuK~\320A\201\273\271\234R\026\357\320\350\322ssy"
+	.string	"\346\353Q\345\313\315\007@\032}"
+	.string	"\2609qR\022m\217\025V7\362\034\2131c\224\227\304{5\004'\306\034\327\315e\231E+\311\302\3240\201B\364b\317QSB)\311\204(\021\353\002\343\263GO\216\0257?\261\\\310/\033vv\332\330X\246\263f\373\305\006s\354\034\307\366\346\342@\316\355Q\253\272\371"
+	.string	"(\023\273X\271\304\232\355\027\"\310\232\2633\226\247\350\t\003\245\344\345\0228D\352\034\203$\0012SC\353-\t\022\362M\306U\230\221\362\b1\2047PL\270\371"
+	.string	"0\242K#8\t\036C$\214\334\315\007\300\327\220!e\2305\333/\024\200\204n\311\030\321\216\355\345\016\221\227aO\272\020\267\344x\234G\031\304\232\355\027IF\2608"
+	.ascii	"\315\310\343\244\f\220\227A\300\020w\220\233K\260\034\324\004"
+	.ascii	"K\006\226\037D{\274\354hR\376(}\f\201\311\301FL\351\243\354q"
+	.ascii	"!\277\261\261#\312\315\337`F\177C\032\215\2276h\224^\230\215"
+	.ascii	"%n.\275\311\310\364\030\245XIA\223\343\245\327\313\035 B\374"
+	.ascii	"\315\330\0226P7\227]\037\342*\323\305x\363K\035?Hz\024\231\334"
+	.ascii	"|m6#+\353\346\022\307\337\334$oZ\310\271\271\274\361\265 \256"
+	.ascii	"6\307\0375|\272\344\350\341u\363wX\330\330\020\273\371\033\250"
+	.ascii	"\224Q/W\374\266XF\225[8\215\336O\304\315\325\365$G\003#Vre\307"
+	.ascii	"]\305\305\001\250\t\334\222/7\377%\326\313\255\2273@\204\370"
+	.ascii	"\232E{\023\003\273\271\224q\013D\216J\325\315/a\2241~\037\037"
+	.ascii	"#qh{n\376\206\037\272\324:\300\177\237\213\203nG\236\233_f\201"
+	.ascii	"\245!\242\344\346k\277V\226/\036g\f\227\243\215\233\313\253\307"
+	.ascii	"A\223\002v\343\346\327)]\374\367\301f\276\334\242n.Y\224V\266"
+	.ascii	"x\266\262\305\211DC]T\\a\273\371\033\272\364\355\331\312\023"
+	.ascii	"\330\263\225\245\212\227U\277\017P\331\032\225\333\315\337\300"
+	.ascii	"\245\313\251\227T\277\217\365q\325\226"
+	.string	"\346\346o\200\241\377R\352\367\t\2223dF\220\233\277\341J\177\203\n\375\227O\345\023I5\201\242\275\277^l\331X\\\031\fy\2412\345v\3635\304q9i\206<C\266\331\"\311\205\254S\212\332PD\032`\344\353F\006\326\n]\036\266\233\367\354\240\332\260\021s\3635\234\321hH\2678\243\0327\3067\022\316\266\201=`\311\031\343\0322M\206\250\252\t\220\301\031\347\3108\222\216m\343*\332RZ\216Fr\216l\363v\207\324C\346!\351H;\344\221\304c\213\344\034\351\346\344\031\262\355I\344\034\311\346\004\343\336D\":O\252l\025e4\177\223!\252j\002ep\214\244\034Y\307\026I:O\"n\222\016\371\206\234c\333\270\210[\013(M\016\316\222\243\320\0345o6\312\374\223s\344\f\241\021\177\310\335L\032\271\266\330\246n\276\206(\372'\341\330\"\031G\327\031\343\202\347\215\tA\276\310\3645,\321\327"
+	.string	"D\223'\3505F\034fn\276\206/}\r:\3645p\351k\200\241\257\301J_\003\225\376I72Mq\f\0353i\256[\231\026Q7_\003\224\276D\213Tr\260G%9\206$C\226\371}\210\234l\361\221\345\346g\240\323'\331\376\373\210\020\344L\226\233\263\375ZI\2069)\346\367\271lE\304\\\334\374\fu\364I0\244\t\277\317\320[\330\025)7?\303\033}r-K\035\035\0327\223_4U\2063\030\374\340\320\242\303F\227\223_~\322\313=\336\264\024uz\346n\026\262G\245\225S:\331\005\310\f\030c\224\233\237a\212>\231fI\265\"\251F\246%\355\2355"
+	.string	"#\\\031\344#I\334\312\334\374\fB4\231v3|a\020\264f\207\306\031\332\311\264?\353\270e\026\r\004<\330\254\271\335|\231(\235D\273P|T\005\271\231\304Bb\331!\221\343\342"
+	.ascii	"\304$K\227\247\233\237\241\312\212\025\262hgg\203\213\203\326"
+	.ascii	"\322\252\241\343\346W \247\177\222\312m\221\244\222\355$um\255"
+	.ascii	"\006\030\201\262s\334}\361r\334\272\371\025\23413#\213z\344\274"
+	.ascii	"\310\034\311\263\223E\025dhHH\037r\300\254\260n~\005g\032\n\024"
+	.ascii	"\222h\301\336\233j\243\350BR\025\345$\321\242\021\221\271\361"
+	.ascii	"\362\345f\262l'\344\312\021-7\277\016\371e'N\355\346W@\204\t"
+	.ascii	"\023\362\211\030/NN>\361\341\202\221\344\307\315d\023\353F\306"
+	.ascii	"\016\217\233\3111+'\273\335\331\201V\201\f\375\223Jn\213\244"
+	.ascii	"\222,\307\241kk\031\300H\2276eK\236\300q\335\374\n\246\364O\""
+	.ascii	"\261E\022\t\256\303\241kkY\300\344\213I\027\241%]hx\301\205\205"
+	.ascii	"\221F^\264\367\216\332;\007\216\262\314\227\027\231\243\330I"
+	.ascii	"#Z\r\232\236\0357\223EH\037Av\316\302D]\375\367\tb\241\345%\307"
+	.ascii	"\315\307\240\246\177rH\221\034\202\337\340\252"
+	.string	".\250/\004\0309b\347x\334;L\006>e\320\324)\273\371\030\240\350\237\fr[$\203d9\327l?\r\025i\343\312\200\244\262f\310\230\037;\276\203\004\263{\357\315\265\237\344(\301\370\362\"s\374q\022lM\2108\345\204\270\233\311/\322\307\177\037 c\0160)\322\007\331\343\006\021\025Ta\200\246\244\344\330\334\314\343N!\356\244\2372!E\214\334LzY\264\377>?j:\266\222\233_\347k\377}\262\f.O\312\334|\f0t\rRG\r2G\271\267%v\275\300\332\\X\034H\033\244\r2\307\335]{\213\355\252|51\2228N\346\330\2011>\251r3y\303\312\371\357#Dg\312\213\0317\277\316\035\362\337\247<!\311\016\0257\377\202Q\377\002\025\375\2232l\221\224ArQ\300\022\341V\304\310\365\2233\310\255\273\303\376l\241\311\031\273yG\264H\345\217F\364Ob\331\"\211E\302\200\321"
+	.ascii	"%gX\031\300\370\311,R\353\312\250J\302F\305\315D\333\"\225\326"
+	.ascii	"\210C\3376\261d\225-\222U\344\225O\325\3361\006\360\344+F\006"
+	.ascii	"7j\bkn\206\224\325I\027?\271\202dA\266\270z\336\340y\202\215"
+	.ascii	"S\272D\335\214\267\224NZi)d\274H\335\234\324f\221J\334\302\036"
+	.ascii	"\225\277 \245\177r\333\"\271I*\nX\024pca\334X\\\031\004\225\321"
+	.ascii	"\023\207\016)u\222\352'\237H(r\n\273i\353\372\241\265\216;\313"
+	.ascii	"\315d\224\322I\251&O8\302n\326`\217J\nm\026\251\274C\354Q\371"
+	.ascii	"\2446\372\317{\366|-\027m\251\25701-\372\036l\316S\314y\2766"
+	.ascii	"\201\r\225\245\201\022$^d\002L\350\0220\350\301\320\n<\201\246"
+	.ascii	"Sz\216\260\006EX\n!\303\017]\207 6\020:\365H\265\311\203\332"
+	.ascii	"\264\232N\037\200A'\247`O\005\006{>?\023\310\204\216`\002\242"
+	.ascii	"%\320\263w\212PC8\221\036y\260\236L\027xp2\001\315\246^\322\233"
+	.ascii	"<\234N\350\372AM\317\022h\352\303\260\362\324\013\234N\350\252"
+	.ascii	"U\364\367C\235J\025\025B\261\246\350\007\247:\264\242\300\020"
+	.ascii	"|\250P\350M\036>\004Q\013\252\360<!\340\224\246\247\360<IX\030"
+	.ascii	"V8U\247\323\251|\223\007& \232\256\352\207\3237\374\365\200\350"
+	.ascii	"\207T\035~\240\340\367\033\002\201A\340n\345\235)P\2654\021L"
+	.ascii	"\233\326 p\267d\236\277|\246Ca\026:\365\234N\247\022\2050\350"
+	.ascii	"\001\206\365M\036\230\204\037\230\204=\340\020\004&!\020p\351"
+	.ascii	"\256\247\312$\fZy@&!\td\022\342\246\225\tx\376\3123\005"
+	.string	"\252fU=S\237\317\334\241\020\006{9]\205\330w\002\231\320\237\271\363\235\3520\237\352\356)\217I\350A\bE\272\252(\323)\342\202\320\274\300\351\013^ HB\020\365\r;\360\241\302\013\377\217\257\335\255\247z\21201\250=\021\025\216<\250\240w\376\316\021H\353\360\027TIt`\201\350D\232\226#T\365\354\005S!\206\021V\340\231\246\303\236\021\222\360\\G\240\370\t\205\346Q"
+	.string	"4\360\260\246\246\320C\bLA\013\024@\255\240\036\251L\350\022p\375\r\315\245\323\227\204\302L\323\016F\360\324\fI+p\030\364@EM\b\317U\265\360\223\th\212\350\240\3673{\030\336C\323\023x2\351#\200\203\003p\220\200\023\273'`\001\032,@\203\362\tX\200\222\322\0028P\322\347@\t\257\353\n\302\320\372&\017\0258\235\253\212B\035\"\022a\032\235\276\240\323\217\332CW\025]\315U\345\225\240\232+\221\032\034\201\203s5S\244\022z\301_o(\354\t\235N(\tg\317L%"
+	.string	"\304@z\232\b\n)HOt\t]\201\247/\004_j\006I\020\245h\272\300\2516\225\300a\217\302\271\232\"\316\024\250\023\272\n1\220\236\277\241\357l\352\251HL@\324)\355\240\204\036\272\2168\177$L\340i\364&\017'\322\017L\302\243\364Gh:\365R2=}h\211`*\364\235'\322\237\211\246\247jt\342\374\t\207\037,\375\314\246\237\323\207\246\351Y\"\310\003\242\026\254\274\035\223IB\020\3451\r\177\302$\243\365T\317\324\007DI\360VS\3459\r\323\265\204S\250V\020t\376\314\336\317\232\236%\200h/\365\241N$\020u\322%\364\316\246\336\t\323I\023\251?\263\0040\210\206\320K-"
+	.ascii	"\321\336\251\016O\244@\274\023C\223w\302t\"R\221\312\365T\227"
+	.ascii	"\226\202@\247\020\305jta\303:\024\002Q\013g\tt5K\240\351\351"
+	.ascii	"\313\020\\\207&\217\t\210\366\322$_\020MO\341\351d\246K\274^"
+	.ascii	"\252\362PUM/\370P\336\212\002\207B ~'R\225hU\315%\236oh\222\340"
+	.ascii	"\251C\022\352P\nTy'R\336\251\016yKj\332#Ry#\370PaP\212&\236\t"
+	.ascii	"\023\305P\212&^Q\212&\337PSo\r\002\3277y\360\241\302\017I X\225"
+	.ascii	"\267\344C\205\345\b6\004\373\201\365\241Bl4\302\nD\203#\b\207"
+	.ascii	"> \312\001\013@&L\017\fG\370P\341\320\371c\002v\360;K\234?\242"
+	.ascii	"\265w.-\035\255\351)<q\362\326\037\272\362\200\301\024h\032l"
+	.ascii	"J\022a\302Da\364;{\275\016\316\325L\207\200fJ\202/5M\244A\020"
+	.ascii	"|\347\271\204\264\242N\250\005~R4\361@\250\252)4\021\374\031"
+	.ascii	"\255\301\241S\210b-\242p\302\374\235)\n\304\0044\223T\364\204"
+	.ascii	"\311c\032\2228}\026\200\250\311d\244:\361|\346\331d\226\020\f"
+	.ascii	"\376x\351\tD\315t\345\005\323\236y\001\210\232LE\026\226\226"
+	.ascii	"\202\353\260\307\343\251$L\n (\244h\342\001\321\024MN\351\271"
+	.ascii	"\372*\244@S\363\004\242\026X\325\241\032\f\222\340--i\341/(L"
+	.ascii	"\317\025\210\362\226\226\214x'L'\336\322\222Q\t\250P\345--\r"
+	.ascii	"\245\301\265g.\361\232\326`\320I\345--\025\005\205'N\336Y\"\035"
+	.ascii	"\366xK\302\037\017\210\302G\001\030DWS\005\236B\247`\217\307"
+	.ascii	"d\252\274\325$Q\002i\251\002\277"
+	.string	"\340R\005N\3657\034\341\027\364\300\204\211Bh\251\002=\024\036\2300Q\350U\035\246M$\234\252\t\001\023&\n!\021\234\351\022\357T\177C\241\023\312[Z\342aPQ\230&~&\205s5S\036\n\263w\372xi0M\317\242\263\004\272\366\316\337/\330\343\235\303\236z\246F@\324d\252p:\241\353\231\002Uy&\202> j\242\202\024M\274\364\\\177\350\022/\r\256f\211\363wRx\223\207\242 \272\232)O\270;{h\211\323W\366z&\317\227\006{g\372\003\f\242\252z\246B\247`\017h}\223\207\017\275\245\001\244fS/\237N\246\b\347\017]\n\246B\240s5E\374\202\351\n\f\366\216T\365\\M\021\275t\027\024\236\210@/-\325s5S\362\024\242X\217V\340\331KO!\357\267\256\301\264i\245`E\235\320\037\357\\\315\364\347M\036\324\245\323\347\373\235\350\022\357D\220D\t=\363G\242"
+	.string	"*\017\210\362V\340Y\"\002LA\013\254ML\350oI"
+	.string	";\023'P\237\303\237\271\201\325\f\376@0q\002\205\230\314\037\b\253\031\374-\371\254;s5?\350\211XU\363\367\243\006\207@t\005\006{\030\326_0\b\001\036\211\302g\236)\251\362\316\325\\Gt\340;\235\320\225\202\225\007b\203\265\203u\030<\235\320\325g]y\346j~\240\002\203\350\212\252\301\021T\242\241\360\\\325l\256\246/\253\274\n\300 \272\366\200C\020(\234\274\323\027\274\300\351\013:\345\365M\036T"
+	.string	"\234?\2637\202\310\350\304\320$Z\337\344A=}A\247\013\017\n\317\364\303\032\f\246\037\200\204\347:\302\007<w*\357d\002\232\"zC\302s\035\261\246\346\252\372\234L@3%\231\320%`p\345%`\005\242\303\335\211\323\007\f\341w\002\201f\223\007M\275\02551\342\304\320DZy\034(\255@t\250\257\244\344\201\005\032\020A\002\272\347A\345\365\322\017\275\245\017@\324t\372\320K\325\017\0366\244\347\n<=X\201\247\323\252\016C\3403\213\376\357X\224A\222X\275\200\262bW5\306\313X\220\233\263\tt\216QvP;\250\035U"
+	.ascii	"\342\264\325\305\330Q\355\246\272\340\330a\273\251\235\324\b"
+	.ascii	"m\246\216\331\3703U\207\347\306.\352\236)\265\236\304\365\270"
+	.ascii	"\371\027\\\321\377\356\251\230\227\314\335\220\333m\322H\231"
+	.ascii	"\004\006\215-e]\2316\247E\217=\344\223\267;S:\364\220D\031-\242"
+	.ascii	"\244)\363\330i\322\202M\355\346\362X\036K\272\027A\341\221+\357"
+	.ascii	"\274\244\373\035\034S&\\0D\377\345\\\271$\007\035\272\243\035"
+	.ascii	"\272|\205\006\330W\035\022\314L\031\227\037\227H\306\305\304"
+	.ascii	"\252\210\\\226\333\302\242\fH9\247$\2260\274\3244\3412$\306b"
+	.ascii	"l\2534"
+	.string	"\226S\330\324\2240\271\331g\354\354\016\0368\270\362M\221]\215\026A\272\304\275|s\207\\\251+\\Wn.\335\334\025>n5\340\332\2540\363\"\017\335\315\277\300J\023\213X\216\024\275\336H.\252\263!q\332\2200\266l\005\271\231\270\253\242F\314\262\206\274\312\240\243M\r5[ix@\205\271\221S\326\206\024/Si\274\332\242\324\001\271\271d+\331\002\205\020\250\023r\264Z\034H1\b#\231R\b!\232\031\3326\0073\025@0hD\034\031Ng\315=\023\300B\213\n\305y\252\007\035S\246fDD$%)(H\235\016\177n\3043\210\214^\205\341R\242\356\301\376\335\323Xaz}\217\266\005p@G}\332 \023\217\3516\033v\037\031\276\302\024\353\327\237Bx\325I&4\264\362\036\017T\377\222\266\226\224\036\227TV\032E\351@\206j\212\212\3753g\262\256\372N\277\2262S:l\0209\372x"
+	.ascii	"F\n/?xdw \003\034\035\376'\253\341(\033@\211C\342\036\2710\326"
+	.ascii	"[3\317\220\025\324\337|\230\271\026P\220\376\305\264\261x<\265"
+	.ascii	"\002\210 \b\337\036u\342S\262mj\226\323\210\222\347\020\027\217"
+	.ascii	"\325\300,PU\345\024\241\337i\326T\251\0273h<{\252\021\027v\006"
+	.string	"\264\266n\220\b\244(\002^y\272\017\270E\327w\277\365O\304}\322\250P\342\377\031\232\032\270\031\263\274:6\254\0266\330\217\366\320\260\212\025h\310u6\225@G\036^\221\252\356v#\310i\001\001\251\225\325\273`\002\025\346\001\"\347Oa\324\256V\372\311\007b\206%/G\207\223\252\264%\326\313\210\271\327B\266\211\322\305V\020\3247\001\"\rp6\342\256\254Qh@e\274\260\2521\205M\247\320H\273\004\251\030b>\207\321\200\020\232\366\302\361nYl\201@H\264\216\031\223PY\352\304j|\"\250\247\217+\022\244/{\274\272Ky\346v\363G\224`\354\226\305\317\200\3568S\205&\202\270>\002\261\357h\237\350\372`\023\221\354\236\341\032#\277\327\302s\024\0171\372\234\244\022"
+	.string	"\262J]\251G\026\241N\n\357\244\2611.\232e\332F\244\"\265\356\213\027\336H.e\254\276\242\236;c\345\205@/\250\223;,\306\024\352\340a\374\361{\nA\320\200gs\355\261\274\r\016\261Ki\235\223\006\307 \205\210*\340\353\177\271\001\201Q\250\227-r\211\b\222\024\363_G\215 .\366$`\326=A\031\371\340\226#j\312yx\326H\020r\223\005i\354\031Q\003\355F\024_\r\017#\0070\276\b\tWV@D\374F\222\200\002\301\353d\262!\177L^z\352\303v\235G}W 'PM\002\253\226D`\273\253\211\fd\233\301\"\234\004\270\357\271\240\376\027A\200\237\205X>\017\030(a\351\344\346\\\320\031\343\243(\0302_\001M\301\234\305\344\001\027\022\254\212\362\350]\244^"
+	.string	"\373Q\240\241\375w\226\272\330B.m\003\210\233Y\302\031"
+	.string	"\027\330\274\370\005m\231#\306\252\340\n-J\230\236\275B;m\322\362\314\362\033v\2535\317\b2\313\325\204\365\244O\271\346\211\232\226Z;\017\231\227\245`\231\220.\225\365A\036\323i\355\013)\002i\327gy\331\200\355i\222\354\201\223\227-\272\352#}\340\322Cl\373\310\262\244\350\357\302\342\020ES\234\002?^\247\251M\353G\242.\200\231C\367\266\322\303\261\324\213\242e\024/\250\250\274\344\263'\371m\254\215W\250_i\264}\343PQ~\340\255n=m\234\003=\005\200\370\372\021m\205\225ds"
+	.string	"\320_\007\025;\372\334\241\375\203\023\242\002\345\"\313\035'2~\005\021\2635\324\210\322\ba\275Ps\027\310\n\026\004\030J\3611\037\f\361\342r\206\220\222B\360\227\212\301\031\301\334\021\3556\336\251=Y\367\343\251\002z\300\261\227/\314d\326y\371\325\206m*\346\334\006|\264K\355?i\340\023\030\345\267"
+	.string	"\356\352\356\250\371\246|p\022\023S\311/\372\301\021X\025\371\372\330P\355B\342\3227\320C\304\200R'\370m\360\ne\322sw\244\305N,\2409R\216UTAn\276\266x\022\357g\256K\340\272\204\017\261\302\306\277\n Kt\300\251}+\274\275[\032k\356\0063\203\243\021\026%\0314.Yc\215@=\031\244f73\263t>\003\337\210\227\302\033\032\223h5/oT\204W\320\234"
+	.ascii	"4\376\017\206\254\254>\005o\004\271\200k\364fr\261\350BnR\357"
+	.ascii	"\235#.\003>\253\334\240\030\374\230"
+	.string	"\365-o\254.\357\203\325&\202L\3621\220\007\\\242\241\207J\317KD\241fr\221i\273\300\360m]\301v\317\324QR@4\356\262\b\033\274:\236\215\217A\006\255\007\330\233y\003\256P\237\004jbl\\\201\314\b\267iT(\213\022\217f\271\254\263\354|\365\202N\205\372<(L\b9\006\214 `\234\002\272\204j\250\035\363\257\304\335\211\225\213e~9g\243;\320\036\235b\235.\367\221`Y\342k\2208/\022\223j\313\037|\263\311\2348\354a\340\0246\233(W\2427o\354[\263H^1\013\343X\211r\026\177L\n\236\237\205\005p\252O\022\276\247<\346\314\220\027\336\276\351\211\272\t\nW/!D\347\251\340t[\261H\360}\220QT\231\376\027B\221\t\232\235\265\232\260\312\267\375\215Z\3400\f\267q\252B\234\343%~S\230\317\247\241x\026\361\221\b\217@p\261\331\035\317\001\2250f\214\214\n"
+	.string	"Y\303\351m\366\222\210-k#\213%68ec7\3112\350h\346\263\356\3324\203\345!*\342\363\037LN\216\343\250E\370\355\303\275:|\250\231IJ\207_O\016|\261\273\272\305\300:*\353O\360\213+B3\367L\224/V -\037\217U\247\270\274\304;\222\006\264F\303l\341"
+	.ascii	"\333\203\032\366\bV\034\365\201\231\337H0\027\315\216\026\317"
+	.ascii	"O\035\036\334\366\230\0224\263O\024\242|B\fw|\261H\336\3065\331"
+	.ascii	"?\3149\252\325\3175<,~b\322\303J(\335\245D\242\356#}"
+	.string	"L\026A\247N\365\213\026\374\217\016\2368\273+\305;\265Tw\321G?\266\326\002\025\300\372\355\3412\340\033\361\024Uv\342\312\f\2551\325\242D\207\006w\200\343\246\314-\323\201\bAi\002$2A\311\210\237\250\002\236L1%\032O\325\306B\022\355\203j\2425\007V\216\362n\316\337>?\302\2422\351Foa\2358k<\233\240\230\257\025g\225\236\023\220;,\b\002#\353\363\224\205\202\337\246g\217)\371/\344\220\264v{\235D]\005\242\215\n\312\264|\031m(\202\276+cd.\225\205\021\275\342A\367\262\212Q\232\325=83\245\t\027\001\b)\2020'\320\206,\031F\204\221\310\351q,z\3451\030\275\214\323/\321ihkK\322\340.\224,.\223\336\330v\272\254\353\0138\323w\355\007\263\262Dn\265\032\004\233\307x\355\251HN+io\3227;\371)!\304\002b\275+Ho\267\301\036<S"
+	.string	"\n\236~\360\221^u\346\310\273\031\235)\032\243\030|a+\205\343\245\350\234a\256\351\201\332)&\006\253\334\331\216i\006\340\262\206 \350\001\370\354\021\336\227Q\315/P\002\033\250!\266=\367>\345A"
+	.ascii	"\007\366\310N\260\374pr\212}\202\031\376g'\211\233\216]\220\202"
+	.ascii	"s\3526\210\355\fePSs\320\005\304\2766\361U\337i\031\244\032%"
+	.ascii	"k\267\256P\004\353\243z\031\204\235r\023t\277\267<$\362\001\275"
+	.ascii	"_\"h*\362\205&n\245\r\340>\232\037\263,\236\203\373"
+	.string	"\373\217\362\240\025\321\253\342\033\257*0\301\030\326\016\036s\370\310\212W\353\265\232\030\t\215\225\\\203R\305[\354\267G\264\361C\232\354<\203Pr3!\256\240\f)\257Yg\362\302\355\252\320\365\206\320=\225e\f\021\230\003\350(w\257D-\271\276\307t\336\347d\t\350}\032\365\024Ja`G9(\367\351\217\326\251\024\306\211\311\264-g\004\346\227:\"\245S\371\316\303q\335\227\333\032\266\203\326\037\274\352Yy\331\325\363\237\252\277\351\273\347/\343\260\265I\030p\3224\207R\244\321Tu*t\340\036\370\n\234d\345=\327\364\n\350% \316_\316F\275kpd\315QbiG/I\302b\276\b/;\321+\203#\351\007e\215\330t\004\300\242R\355j\243=\034t(\372i\225\273\210C\334I\302CS|\220ed+\321\337\377jb`\017>,\016\324q\305~\347\347\327f\006\032X\00103\307f\256:"
+	.string	"\360@\254li\241 \3726\311\3271I\367\342\363\347R0\317\"I\270\213`\230\210\223\232\310\262\r-\345\360Ls$\315U\316\232Q\026Wp"
+	.ascii	"\262\264hT\252\350P4gq`\237"
+	.string	"\272\025\022\340\b1_y\207hK\247D"
+	.string	"\231\224\226!$<\367!\274\203\f\257P\201\034$\240\255<\213\250\217\224\300C\332\312\r\200\210\330x\201K \017\020\235g?\242\r\177\206m\277z\356\317r\321j\370\331\267\252\371P{kK\001:\260\321\310\250\347\305\020\336\371\031\364\337\350\331\231p\344/"
+	.string	"\376\034\200"
+	.string	"\"\265\200w\203\266\322\340\020\033\272,/\005\247\226\b` \f\230d\353\t\303\2632 E@\346b\227\271Q\326K\372\026g\340\222\203\004J\226\354'\361\0015A\364/f\356a\020X\372i\344\273\tc"
+	.string	"\366\204n\260\222\343\221\350#\035\274.\332\177\250h\"Tt\004\221\222\254(?\341i\273\350\311D\361\3500?\353\223\021ebe\217M\306\360O46\321\355|=\373\366\313(\300g\253[\031\203i?'Z\265Ws2g\316\267\302\357Y\303\377F\233\307\272\344\245b\fh=\t\224\027Z\301\255\364B'\034\247\351\261\321\357\355\276\267;\325IO3t^\0229\210\310\265\376\020Z6\224\271\302\252\307\250s\271\361A\244w\340\376\036'/\354\3752\357\373\263\371\202\371\373\227\335\377\034\200\317\203\315_}\344j\372\027\316\367D}\203\371_\301\232\032\233\264\347\013\270\252\372p\312d\204\245\325\347\247\3620\342\265\220\032\031/\035b\275p\342\264\236\213\371\273\303~ZZ\242\242\337\242w"
+	.ascii	"\317\266/\207\343B\f\315\302\375\t\030#\361\357\013Ym\247t]\314"
+	.ascii	"\031f\217\366\376gNR\272\334l\341\022\345\037q\330\357t\255\365"
+	.ascii	"<F\375m\377\266\323\306G\227\253p\207\344\271Xf\212&ic\306\205"
+	.ascii	"\325\"\026\325\025"
+	.text
+	.section	.gnu.lto_.symtab.2664a946bfbeeeed,"e",@progbits
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"pidAudioPositionToModeMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"adjustmentRanges_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"setConfigDirty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2664a946bfbeeeed,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
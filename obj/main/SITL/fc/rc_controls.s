@@ -0,0 +1,1258 @@
+	.file	"rc_controls.c"
+	.section	.gnu.lto_.profile.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"u\006"
+	.string	"\204\bX\001"
+	.string	"\024"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\302\374\277\243\n\004\002\001\002\002\003\240\342\234\212\n\004\245\231\261\214\f\004\002\003\002\004\002\005\002\006\007\366\311\273\326\016\\\007\002\007\002\003"
+	.string	"\002"
+	.string	"\007\002\b\005\002\005\002\t\003\t\002\t\b\t\n\013\r\017\220\237\222\215\004\002\020\367\372\342\307\013\004\002\007\002\n\022\253\262\211\366\t\023\333\314\243\214\005\024\025\353\227\221\315\013\026\366\336\365\327\f\027\030\240\342\234\212\n"
+	.string	"\036"
+	.ascii	" _\020\356\1775\0176f\240\035\020\006NR\355^\215\320W\001@vs"
+	.ascii	"IW#\242\260\301P\034,U\314O\204\231\001\272\"\360\223`g\300S"
+	.ascii	"\001\3448\254\020\330y\215\\+h\001\231\357\332-\247\201!"
+	.text
+	.section	.gnu.lto_.ipa_sra.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375 ~\245\001"
+	.string	"\350r"
+	.string	"\006"
+	.string	""
+	.string	"\003\002\001\003\004"
+	.string	"\003\007"
+	.string	"\001"
+	.string	""
+	.string	"\017\002"
+	.string	"\003\020"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\t"
+	.string	" \007\327`&\fS\335\305\fb\327\335\334\031\231\254\300"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375`5\001e\006"
+	.string	"\302H\031 \240'\351\203\377\355\217\347\322e\021\021}\234\032\335\366\223UU\t\325\270\237\233h\242\265L\266\224)\377/\204T\301\032w\307\334Xy\347\262\350"
+	.ascii	"\347\312\376g\022\177!\371T\20108\032\365\371\330\201\261\200"
+	.ascii	"\370H\311_\245\317e\311\351?-k\354\007\224s#4qw\352^\007\371"
+	.ascii	"A\333\247cww\351\221+\b, \200\"3uv\373\004t\300\267\214o\275"
+	.ascii	"\317\034\0207z\230b\350\261\017\226\026\316\027\237\277\273\344"
+	.ascii	"Ff\016v\016\bI\260\027\370@\300\345\347`\242\277\240\324\001"
+	.ascii	"\367\212\310\"\340\313\213\007Y<\256!\317Ao0\213\267\004\013"
+	.ascii	"\035\226i^\266tdDE\030l\020\026\013~\003\2077\230\363\006\321"
+	.ascii	"\232_U\233n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"\355\005"
+	.string	"\342\310\031 \220)\351\273#\027\320\370gfF\364\346\017\266~|\374w\367\303\224\027\354\n\346b\363Md\222\001\344\220\003K\025\240*}Sd\206\271\360\206k\315\320\207kS\032\301\265N\\\373<7\212k\233\353\215[\2639\271\376x\307\247v\356\235\353\\\324\026YR\360\340vJn[h[\223pK*\244-U\350K\3628#% \220\002\n\220\252\007\302l\310BN\007\270<\220dl\216$D\201\224b\210\346\270\\\037VF+\337\205\320\006\304\036\326=\026n\341Hu\261\207Q\237\2111y"
+	.string	"\240)\337(\260n"
+	.ascii	"\241x\313\245J.\220\314w6\346\023\202@\223\025\375\224V\326\270"
+	.ascii	"\033"
+	.text
+	.section	.gnu.lto_.pureconst.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\204\004\002\204\004\004\204\004\007\230\004\017\204\004\020"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375 zm\002"
+	.string	"\264\002n"
+	.string	"\005"
+	.string	"\001\002\025\001\002\001\300\007\026"
+	.string	"\001\002\027\004\002\002\030"
+	.string	"\001\002\031\001"
+	.string	"\002\032"
+	.string	"\001\002\033\017\002\300\007\200\020\001\002\034\001\016"
+	.ascii	"_X\260\323\b\330\001\033Ae0\325\320\242\232\232\022\004\030}"
+	.ascii	"\363\bf\337\335\016\2600\f\260"
+	.text
+	.section	.gnu.lto_.lto.8bb5a7c54012b2da,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcControlsConfig_Registry.75.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\314\321\025\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\335\007us\357\006uq"
+	.string	"\005\001\006'\001\005\005\001\006\035\001'\001\031?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rcControlsConfig.77.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375 :\255\001"
+	.string	"\244\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\001("
+	.string	"?\202\210\200(}{\276\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\003"
+	.ascii	"@D\312M\003(\002"
+	.text
+	.section	.gnu.lto_armingConfig_Registry.81.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375 \240\265\004"
+	.string	"\204\bj"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\325\221\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\365\006us\315\006uq"
+	.string	"\005\001\006'\001\002\005\001\006\035\001'\001\220 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_armingConfig.83.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_isUsingSticksForArming.84.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375 \347e\006"
+	.string	"RL-3Pm\222\016d\254\252\206\222\001*kI\273\b\202i{P\032\354-\331U\373w;\354\354\316\301\234\300 vf\026QD\337\001\036l\024\036\233\265\366\311\226)\273\314\306\341Q\034\315s\t\216j\216\241i\032\024\036\232\2436-#\360\203X\240\032\347=\252a\256,\033!\033"
+	.string	"1\211oHE\252\313qD\007ku\272\035K'd"
+	.string	"\026 ,\375\365A\226\361\255$\033\37582\013\t%\240$3TJ\311\223\211\244\343\357\357y\314\006\007\236\253^\033\241b|L\214\2202\257\3064Z\025\253[\220V<.L,\321\247xA\310\314\321\022Ut\326\237\340/\370)\002\007"
+	.ascii	"2\003\316:#f\b\3055q_\b\022\356\262\251\235d"
+	.text
+	.section	.gnu.lto_areSticksInApModePosition.85.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375`5\001\025\r"
+	.string	"\006\232X@ \217\223\016\310E8\200\270\315\202\030\260\371\351?\246\326\001\202\001\243enR\301\264\355\224\177\030\315X\017\003c\364A\262\345\b\005\250B"
+	.string	"\202\246+8\361\203\207@\007W\001\323\fYB\366N2\245G"
+	.string	"A"
+	.string	"F"
+	.ascii	"\036@\371\241\005P~E\320\251\307[\006\026_(\205L0\231\233u\f"
+	.ascii	"\366\370\271\243\247"
+	.string	"\256>\036\207\n#D\332\307o\202\335F\223\200\007\240\2458\215\314\364\007\343\212\206\202X}dfQ\244\265\270\224\333.h{\2405\205\265\313\314\354Gm\261\032\227\354\214c+\207\245\034\3669\254;\366\016\213\016\353M\325\262\202\300)\223\345\024#U\274\227\rm;\355\246\355\261u\007{\350\270\024\241/\323\202\211\022\231[G72~\001\002\247L\035\026azW`\314\314\317O:\276p9\221\2020\372\273[\305E\306\177\207\"\024\343\343\315B\005\246\345\260KId23A\r\302! \324\032\374\3129A\213\374\352\023\312\3177\320\342\005\204\247v\373\340I\r\"\f\260\021\220\222\220\252\227\007\347\001\226\231\220`\027\310\225YW\003\213\304A\310\210ue\034\313\243@\261\022\221\3142\301\260\314\332li\227\037\025\335\206\361\034\256\276\322Vs\r\320QZ]s\207b@x\242\336I\356\356#\352.\305;\025\031"
+	.ascii	"L\204^\350\206\0275E .\210\001n\300n\025l\001e\300\270l\220\003"
+	.ascii	"r\345\020\214G 1\261^\202{\025<\244\272\200\270\346\300\312b"
+	.ascii	"\203\017\201h5\344U\205\253yo\273\212\036"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.86.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"]\013"
+	.string	"\306\225N? O\225\016C?\202\2132\311\265\032a\210?\230\326\035\204\004\363\312V\026\360&\2023\3357\031\331\327G\347\001\203\236\217@\005"
+	.string	"\003\n<`\310\210\206\r\313\002~\360v(\261\226\354-eJ\001<"
+	.string	";"
+	.string	"="
+	.string	")\346\f\263\215G\260\313x\r\354r+\274{\\\355\374\007\217\006$\240\370\300\3217NH\254Q\006\b\212\021\027\205\022G]E\340G\325Q\231sZ?0\302-o\273\200\355\211}\002\001G\035\300\211\021*V\236\276\354\360\243k\262\037\347\226l\253\345\252cT\357\252U\325w86\270$$\346\204\360b1[r\245\301\266\307\206\370\247w\360\270\213\241\005\020#%\"\244\n\255\335\222\343\352&H\261@\272\302\273\321r\325\202\307\234 \001~\352!.\f0\230\rp\301\303W\367\241\026\236\276(\007\261=\346\234\003\374\017\017\035\370\030.\275\351\350\277K\277\203]~\003\326(\233\006\033\307\311l\332\001\215\3134\005Y\346\202"
+	.string	"\223i\334&\243H\274i,\\\306\3316.\203\204\336\267d\315\211\244\177\207\035\365\213\t\034L\254\337arE\266\345\272\342\355'\256\351\031>R\021"
+	.string	"O\b\270R\307\023\331\216\212\365A\205\245l\005+\300\215k\212\2341\34224"
+	.ascii	"c\241k\370:\026%\017\221\213\273E\252rh.\265\007"
+	.text
+	.section	.gnu.lto_processRcStickPositions.87.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375``\033\275t"
+	.string	"\272\264\254(K P\352\031\003\237 \331\336\276\253\250N\370\003i\035\376H\203\177-\273\250{(PI&\342y\224\001\016\241\023\253\243\212\210O\027"
+	.ascii	"\262\004\002 \020\246\372\034\226\352\355\362\006\001\253\300"
+	.ascii	"f\312q4]\034\240\325\356\356-\245\224)\245\024\204\0028\002\212"
+	.ascii	"\002A\272|\026\271\267Gd\016o!\333w\244\235t7\351~\353\326Y_"
+	.ascii	"\375\335e\356:'$\bm\311\275`#<\321\"\215\3528\3569fr3i9h7\341"
+	.ascii	"\277\244\2264yW\207c\361}_\021\311f\205\032\247mvm\233\266Yo"
+	.ascii	"8f2\224\024\264\337\262\204\264\344\336\036&~8\2769\276\257\034"
+	.ascii	"S\263\314\224l\226\241\314\212-7\344m\272D\257:\307\367}\235"
+	.ascii	"\257\002\257\275\3125'\035\332\254\307y\214\307OX\006\276c;\256"
+	.ascii	"c'L\307s\334\204\345RX\2418Qe\242\004\025\211)\251\021QP\"B8"
+	.ascii	"\237\234\232\230\226\224\222\220\216\214\212\210@\f\t\005\001"
+	.ascii	"\375\370\364\360|\330\321\311\301\271\261\361\320\241\206fF\246"
+	.ascii	"\311\\*\223n\313\256\357Pn\255f\275\027\362~t\341\241Myb\300"
+	.ascii	"\n[\274\370\304d\360\201B\231\331\031\313wvuNn\350\\\025<\232"
+	.ascii	"\347\270\211\216\035\321\0335\256\257\226W15\256\034,\313\371"
+	.ascii	"\250q\365\310Q\343\302\341)\300\016\255\"!\035\005t\312\211\307"
+	.ascii	"\034\274jL\233\030C\225\212\361\022YB\250H8$\261\216\231rTlk"
+	.ascii	"\2447\2645\322\352*%\202\220\021+\325\336\313\347R#\2214U\232"
+	.ascii	"\350Q]\2708\324\233\327\235\b\304\016\201\250\305\235\204\375"
+	.ascii	"Dh\305\235\266P\245\203\336\344\301!\223\340\322\032\264\366"
+	.ascii	"\243\332\206\322*\253P`\241\227\022\225$\032\002\035\351\b\t"
+	.ascii	"\207\327\235\221\253\242h\257\211\fA\254Ki\202b85\004Il\252\024"
+	.ascii	"\317\207\236\344\271\220\236\f\036\264\307\304\201\366\342\374"
+	.ascii	"gU\312{\254kC)\2245\307\205\255%M\225\302\271\217\253\002\256"
+	.ascii	"\013\230\"z\361\211\251\0059\353\036\236%\375!\0067\337Yb(ms"
+	.ascii	"\235%G<g\205\302\003\203\322\206\322\267UF\211\"\265\005\307"
+	.ascii	"\271)\3426|D\334\003\013\336\201o\005\257\341k\032C\351\220U"
+	.ascii	"\210*\375\3413T\251\021Ci\232\3134\207\324\302\320\232\271.-"
+	.ascii	"J\t\323\206R\264\025\247G\013\321\246JQ\360\345\032u\303\361"
+	.ascii	"\254\r\245gkS\214\227\r\r\327CT\251\017W\256\315\303$>\332Pj"
+	.ascii	"\266F\231\351\035ry\322U!$\254\254]\262n\275V!\377\002\353rv"
+	.ascii	"\254\327\031\260\033\253\320\373\276L0\033\376=\327KC\344\336"
+	.ascii	"\252jae\355\256\212\367}\331\243`a\315-\232\231\355c\346\025"
+	.ascii	"\3149T\001\220\256\026\231o\340\335\272\036l\231o-~l\325\305"
+	.ascii	"\226K\fH\230?\345\346+\337\325b\2742\330\221\221\314o\376:\330"
+	.ascii	"\225\026B\331\362\231\277\203\245+\006 \277i\002Zf\003\020\360"
+	.ascii	"\216._YXe\263\361Z\234|eW\351@\027\"\260`\3216\2334b\334s+\333"
+	.ascii	"\272\021d\354\262\\\223(\276\347\277z\336}\030t\210\334\200M"
+	.ascii	"C\026w\021\006\241E\213\266Y\227\210Q\257Z\266\345\221\312\237"
+	.ascii	"\262[\305\355\035IG)<\234\251\255\376\213W\367\3047\\'\033\231"
+	.ascii	"@:wV\213\342\277\254\336)\026\204n\213\r\027\323\353\373\276"
+	.ascii	"or\256\225E\244(\266\255\343ye\253\376\304\17717\265\325\367"
+	.ascii	"\216\037a\310]W\032\227G\272+\327?m\325\267\216O\372\322\376"
+	.ascii	"\224\273\210\224\270\265\277\276\004)iU\377\325\n\262\337.\320"
+	.ascii	"}R\330WR\355\252q[\354O\337\376i\277>\202!\204^b\255w\230\244"
+	.ascii	"l\375)\257\357\217Eg\305\206\213\341\377\265\201\206\342@\362"
+	.ascii	"}mLq\353\365\036\004\022P@A\333\354\277\021b\\\277\177{Any\344"
+	.ascii	"V\343\271H\276\357K\305-C?\261\200\273H\263|\301\013\357h\263"
+	.ascii	"\334/\332f\373Yj\235[\337\226G\2627\377\265(\276\243\337sM\304"
+	.ascii	"\350\204.\213\035$\227G\276\231\336!\222\377)\263\034\227\377"
+	.ascii	"\332a\022\263(\374k\314\275C\307WG\227\316\025$\235\033X:\263"
+	.ascii	"X:\257\350&\315V(N\364[s\225\353l\202\351\\\202\351L\345:\223"
+	.ascii	"P:O-\235\245\226\316#\226\316QMg\250\246\263\210\246s\210\245"
+	.ascii	"\263s\306\371I\306\331\311unj:3-\235\227\226\316JK\347$\031g"
+	.ascii	"\244\246\363\321\322\331\250\351\\\344:\023\271\316 \230\316"
+	.ascii	"CLg!\3279h\351\f\324t\376q\235}\372\255\271g\351\314\243t\376"
+	.ascii	"\260t\336i:\3534\235s\226\3168M\347\233\246\263\215\353\354\201"
+	.ascii	"\351\334\201\351\\\343:\3230\235g\222\3162I\347f\322\231\231"
+	.ascii	"t^&\235\225\256sr\351\354&\235[\2453\233t^\225\316\237tv\327"
+	.ascii	"\271\273\007\222c\332Y\213r\254\tzm\215J*\200\211MU,\234\200"
+	.ascii	"\204)\251}\372f\013I\255\323?}\317\243\323\267?~\206\n\021/K"
+	.ascii	"P\355\242m\372W\243\033\214\241\351\255\020\035\b\307\027\"J"
+	.ascii	"L/@\033\223\323\335\237]RR\322p\351\223\374\205\245g\257\330"
+	.ascii	"U\353\270\024\321\220\232P\306\210\322\342t\034\031\021F\251"
+	.ascii	".\026Q\225a\217-\350\204\bQ?\277\264J\337\204\344\247\027?\362"
+	.ascii	"\374\342F\274\205'\230'\016\317\352\263\3326\253\364%\266r\250"
+	.ascii	"\306\201\3101\006\204\320\213\364-\310\256\320!\006\340\314\317"
+	.ascii	"\307g\244w\024\351u\362\276\024\262\rhB\206\216\276\251)\270"
+	.ascii	"\2407\274\243G\237\223\347\205P\320Oh\005\242\321\257P\301\350"
+	.ascii	"S\220\271"
+	.string	"\220\006W\306\243\247aVB7!AEA\212\276\b\261\225q\214z@\236\243\211R z\226\021\214\207G,e?7\220\021\231:\013\262\346\323\363Sf>\341,\327\320\034_\320\035\275\026Xx&\245\245\021\204\373\030z\020\017\331\3252Z\241\037\nz!\262\240w\373\024\251\234\246\241`&@\307\230m<\177\223\247\244\311\302\024~\370\351\230f!\246\201\236\205\203\001\275k\230X\255\021\370V\027;\203v\207\033\226\245\255\321\217ti\262\363\363-\306\277~\276\b\261\335\262+<t\276\264\213\326\307q\370<\313xX\235Abw\226C\330Ym\317\007\235\220\304\311\036\"\023\234\021\2766\324\f\005(ZN\036\330\221\"\217\233\357\254\226\347\233\306\"\351\254\360\370VwV\273\363<\221;\357\032\022\2721\230\032r\330\350|\223\205\037:\337\242ys\231\013\363\220\363~\350\f\002\235zGs\276\335\200p\275V\263O"
+	.string	"\253\035~\312?m\005J5\272-\375\323\342|\005\317\356UV\205\252\200\363\256\241\225j\031\322\nP%\216KF\240G\226\2155H\316\fM\002U\342\035\345\031</\205\\\257\305\375\327\215Y\037\264p\251\200m\215[\036Y\303HC\016\232\233\307*rn\250[\313\f]\002\205\363\216\336\374\f^`\241\215\327\032\302\302\0066\363SNl\233\207A\267e1\003(\023"
+	.string	"l\376\303\246\270\225\365\274\"\320\330Z\032\234\314O9\203\226{Ks\311\200\006"
+	.string	""
+	.string	"\264\315\262}|\216\215.\332,,\225\257\255\221\245L\021r\245\351\341\261t\224\261\303{\250\371\231\357\360\335\225F\3635Wh^Y\326\300\317\274?z\005/jhp5"
+	.ascii	"\215\rd`=\200uU\343j\203\031XW\032\\\305\210\361BGFw\260\301"
+	.ascii	"\0035h\260\034\343\211\206\0063\260"
+	.string	"jp0#\306\0051\260\23410pr \343\305\006\316\030X4\234O><\243\203+,g\215\0313\260\234\314\255V\261\365\\\374b\335\376\230\200\023\030\037\335\364\373\302\202\360\254\233~\203+\232\250\234\320M?@\004\210<\375\374\n\277\254m\242\024\356\234A\036\200\306\016\251\210\002\373\230*\333\013\304\214\335Q\013\333\223\261\203\311\301\205\355\307Z\207\037\223\302.\207\254J\033\r\370\021\222\230\006\367aN\023/-\361&\274\254\251\276\004\211\247z\036$\336\025K\334\363\373!\303\235\216<\221|`\026\3059\230\244\200\0339\304\b\253}EF\300O\267\222\274\227\330`\016}E\006d\200\247\r\300/}5VX\025\340\247\355B\311k\271p\322\302\374\204\241\353\236nGC\336\367\235jVf\355\317\261q+L\367\030\020\307\305"
+	.ascii	"HX\337W-E]wX\234\363\322\254B\313\037\2318\030\001\340\221\035"
+	.ascii	"2.\017\310\030\270<\034\330\035\227Dykkd\007\3230$\031x\361\026"
+	.ascii	"\337\332\030\257\306\244\325\305.\207"
+	.string	"d\030\2766\007\266L\335v]\367\204\273\031\022e~2y6\251\353\326\321\007W\330\365Z\\5\003\241\212\2372R\373\341\033\251\235\372\017\276\305\271<\351\236u\317\273\273\266\331\251w\327\366\252.`\231!\305\223>3\235(\211V*\354\254\021\321{A\016E^\225G\020\355\004Yg\265R\017\303\006\251g\203<V\355\r>\331`\304\304\224\316jG\374\316\017\030\350\020\335\257\273D\333\371\005\266\3631\241jZ\362\327\316\007\003\211\t\244<\375\2228\rM\223V\250\345\217\334Y\302\006\247\004\331\007\255\020\262\275@\250\260W\031\344c{\337)\354\200\254\230|_\255N\343@\226=\372z\005\262\275@\230}\006fV\354N\363\350\253$t\303!\373F\274\003Y\334\3343<0R\177P%|&\024rQ\t~\215\370)W\351\2546\352\237\n%\352\333\311o\361\223\213\202z\030+\3247\241D\272\177B\"\241D"
+	.string	"z\t!\302\001_\373\0318\370$\364\216\212\370\031+\316g\rP%3P\376\370/\314\334S\b\005\274\337~bi\231\237Y\236\210\336\321\020_\003\214\264\272\270\302\231\232\371\331\345y\003\234\333`Kt\002\354\254\326\351s\316_:\013\202e\250\022\371,\021\343L\251\231\021\221\024$I\2411B\013\020\210ba\332[\353\001\022@T=J\204\316\\\215\202$\225\264\006\340\322g-\013\025\345*\216\371\340\323\322"
+	.ascii	"@`\221_s\260\016L\177.\026\263\005G\033[\317\304\303W\337\230"
+	.ascii	"6r=5=z\354B\200\325\244&\320\245\033F\311\037ER\274\274\323T"
+	.ascii	"N2\2335 l\254\353\227\305\360\232\224c#nAH\350[EVE\233\002\266"
+	.ascii	"\34282#\032K\230\004F\261\0309~\275\330\025\b\306\203/\210t\277"
+	.ascii	"\366Sz\360\373\177\316\213\035WB\316\320\b\356z=\325\214\300"
+	.ascii	"\267#\3102\243>\311\261\036]\013\213z8\264\305\r8\351\273Y\034"
+	.ascii	"\300\234\357\265s\277\360\323 \336W\035Hi\243k\265\030C$;"
+	.string	"\riJ\352k<\360\341\350\373kp\247\250h\264\204\315\333\375\240\024\2577@\304M\224\025\366\376\367\021\341-\372\013\234\264\375\272\374\nt\252\242/\326\316\025\274\316##\257?6\261\257\035\023\274\"\223\022\036Q\033\023\215$\323\n~\203\216\300\226\310\204Nvp\274~\027J\230\333\214\312\376\022^\202\265\363Ma\334\364\333\240\301<%J\020V\317k\330mE\351\021\300\030\207\366H\274t\200\200\254\037\204\217\265\214a\220\002\266\305m\215\323Nc\223\330\271\330}S\356\326\271.9\037\315yN\002 \232\020\034\250\212T\347\343$\225A\202\033\343\326\351\307PC\214\003C\355\374\355\001\004b\315(\2541$\210\027\177\303dp \025\334\20042\210\306y:\2347q\356\307 /\020\212a\206F\026\346\2756\252\221ZDy\267\371\006\252IX\256\317\360\344\306\250u\272\230\271\277\336\205\004aP\004\317\231\rey"
+	.string	"&:\r$\033gG\"4C\354\2669\337R\020\256\f\307\362\262]\027\222\245\224G\354o\335\355\336\2177\353k\2710\\\215\321\322\342/RX?\211#X\276\t!\341\001`\267V\323\001\333\372\211\356\274q]g\275C\002l7\b\230\202\232Le\261A\234\246\244J7\216)$\352\036\332\334\2418\372\301\3520\335\310\244\016\302A\030Fv\002[%\263\320\305\3554\307L\200Y\f\255\200+-\025T`X\343\362C\037\242\223E\207*\2114inK\261\021\344\302\344\204\270\222\005\266\001\302\t~\256\211\366@|t|\265c\333R"
+	.string	"\354\215\n?\261cw\322\332\302\306LR\025<\2230\227\262\332\323\b\026\306\254\007\f+K>\325&\357\350\2729\006\031#&\255\262\316R\351\262T\344\215\326p\256J\241v\321s;\317\fX\310\221\"\240\360\270|\302\r\342\3622\034~Y\243\372\226\351H$+2B\003\365i\035\023HM\351\026m\243&0\272xuT\016\221w \037\202\334(N\236u\0261{\023Y\320\234\256\302\314u\266\341\374a\373G\277V\034\035N\360\350\270S\223p\302\222"
+	.string	"\302\255\020\337\2121\265dL\304\376\345\235\245\310Z\346\306\342\032G&\f\337\251)\323\303FWU\217\360Ar\017V3\322\252`p\211\224\264\355\210'\003\261?\373\311\374G[\302\316\344\331$\222J\360\312\365\2028\3416\222\207z\213j\t%\236\\j\241Z,\217\255p\213\2765odw\032\022\211\221p\265\320]\bO\025\3455\243\343\2441Xt\370:\220*\277\304\213\206\304(ph\220,U^\235\027@\277\3313\230\312\235\342\023{1\316\366\372{\263Xc\341\204L\003MV>\275^<\304\214o\320\036\345z\221\333\006\b\030\217.\020\305\301e\004:\232\323\232\025[\373\023@F<\245\035\303\342\356\257i\262N\243\250%@(\353=3;\007\214\212\220\261S\317\205\352*\351|\206\341k\333X\235\247\366,\363\315\032\235_\372\365\211\312\b\271Z\332b7\n\374T\220F\034A\016\370"
+	.ascii	"\354\372\270\f\2335X\026v\332\352\022\233s\006\314\322\362\032"
+	.ascii	"\337\b!\224:\034U\307V\031s\253G\220\236;\307\375%s/\312^]\003"
+	.ascii	"Iy{\363\"\234\"\rH:'BHj\220u\202\217\n\316\3348Q \235#>s\352"
+	.ascii	"]\330\241qQ\252\375\222\002o\216\331.4A\316\313\203\242\005"
+	.text
+	.section	.gnu.lto_getRcStickDeflection.88.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001%\r"
+	.string	"f\033^C\020\257&\035\320\211E\0345z\214Z\375\250V\203\267:\322\031\023\240G\316I\017\"\314\227\316\336\371\311>\353\027\022mxP\332N\305P\250\b"
+	.string	""
+	.string	"\330\374- cET\210\034\377\331FB\310\336[\312\224\002J"
+	.string	"I"
+	.string	"H"
+	.string	"0#\317\211\371\225\220\261\335\n\"`vw\303\032\327\241m\237\303;\200\034z\035\006ST\221@:\315\354n&\340"
+	.string	"\342\341;'\036\352\205\207\236!\377-\177.J\214(\231H\236V\202\335u\226L'\267\336\366"
+	.string	"\333\035\366)\004P\323\252\351|\351c`\2400A\243 \265;aE\263'`\214\206\243n\377\344\247\274\361QV}O\366&*TLZ\354\256\306\241\013\\w\2617\207\267A\366\306\266\246\375\356\036@g\211`\270\213\302\002f\267\3330\201\353\001\226\032x\031m(\311\225\243\252\036HA\252\271\246\236Tc\177\036b\273v\267\303\377p\020\020\374\f\207\366\210\344K\207\276H<\274>u\016\211\0251\242\\\331\035I\252\005\373ow\327\232\202i\372:\352\266\316\362\307\257\374\001#\036\251q\013: \320\323\031\371x\3268<\0166\356\023\262i\036\032\227i\r\262\220\316\007H\246q\236\214#\200\267\007\f\270\354\263m\\\266\351\366o5\305\2661}\313\337\013\024\221\226XenU\274\024\323\273<_N#\031K/E\240\032\315\210r\245\001\017"
+	.ascii	"2\241\251I\343\365\204\337\370\b@\210MU]\3105\212\372pP\267h"
+	.ascii	"\037\252\331k\224\"\\\002eY\3603\243\251\235O"
+	.text
+	.section	.gnu.lto_rcControlsInit.89.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"\265\013"
+	.string	"\326\226O>0O\224\016\bx8M\006&\244\017l,\022U\367\003\354F{\231\3516\027[\306\005kB\b\331\022\320Q\370b\374\247\237m\206\265\030\021\302\020e\207\274T~\225j3\364\377\275\267\224)\005>"
+	.string	";"
+	.string	">"
+	.string	"\006\331,>\352\260?Q\201\003\344\305\356N\312\341\240\303\247\t\362#\227\311\306]\207\222\f\177"
+	.string	"8mB*\205\323\036\201\335}\210\247\005.\313\214\\v\327\271q\030\356x\333\030\333\005\354'\b\351w\242]A\310o\327\001\244\r\235\246\227c\332\021$\3447'IC\227\351e\217\262\324\016\373o5dk\372=\255\231\316\247?\t\360!\005\246\305\356\205R\214\355 \n\017\266O\t\361PA6\027OU\317\021\202e)B\355\360\257OCTL[\363\017J\262\253!\360G\234\304\306\3678t\003\016\3649\3610\365$\025\"\260,\345\356^\352\215x\255\200\370X\241%\fg\004\246,\037\007\225\245\341\251\250\feM\024\203\311\303\321t&\312\372L\026\001\256\036l\254I\243\252\254\2112\302\376VC\316g\340\025\221(D\017\374)\005\333V \3520\315\254\352\227\270\211\r\337\303\0132\231\025"
+	.string	"AC\253qC!#\243\031v\216Lm\020\006\344\021\0245\004!"
+	.ascii	"\034\\\302\004\326\301B\327p\260!\224\227!\202\313\017\214R\325"
+	.ascii	"\220\225;Zrlm)\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375`\017\005\235\024"
+	.string	"\206d\205F\240\224J:\024\016\357\245\3723`\236\032\267\262\317X\003[\256\312o\360$i\217\214\360\002\276^\211q,dH\324;\241\210\247\251z\013x\235\340\225\302y\306p<#\223\250\254\200\021\3009\377\274\204\346H\211\226D\246o"
+	.string	"q"
+	.string	"t"
+	.ascii	"R\"\234\210^D\374\227\246\226BL5I5E}p\"\001\274\316\024C\037"
+	.ascii	"\003^\213(\324G\013\203\372g!\320\253\210\267\372y\230\350s\266"
+	.ascii	"\236+\371]M\364=M\344y\360m\\1\304v\372f\241\316\221\210\377"
+	.ascii	"qr~\244\3277\022\336\n\347@n\372e\341\376:G\233\377\020\377\207"
+	.ascii	"(\306\256\277\3770\027\3522\216\343X\323'\013\377\277\300\004"
+	.ascii	"\n H"
+	.string	"\027W\304\353\241\217\245C?\013\207~\222\r\3755\r\375\266\f}7\f\375&\027\372N,\364\237T\350/\241\320\177\233\320/\225\372L$\364\341\"\364\343 \364\241<\350Gq\320\237k\320\227c\320\247[\320\227\222\324\247\242\240_\227\240o\005\251o\207\240?E\307q\374o\356\016\364\257\250\201\203\025x\220\243\0131\372\220\242\023\021\377\022QS\001h7\346|\274P\245\352\314\350\301\342\307\013\325\303;\202\324\227XY>\336\247\322\207\367\351KC\255\340\330\017\257\323\004\342e\"\203x\231\246*\214\2725!^\020SC\2558\037?^\033R}r-\204xy\245\352\233\327\025\220\227G\252\bff7\304KC\366\360\322\314\037\357L\2512tg*~xg\246\366\330\266^\020\361\306\224\372\362\326\245\243\210\027\246\fWR\227q\034G#\231\3359\222Y\345A\226\\\344\216R\003\310\330\"\200\3141u(\215k"
+	.ascii	"\257\332\230\232D\246F\200W\263\246\322\210\301\325\360j\215"
+	.ascii	"/\345\005\261lJ\005\2268x\274Jc~\365Tu\273J\273\341=1\025)\270"
+	.ascii	"\002\207\327\304T.\313\272\353\361V\2259\274U\244\016o\325\324"
+	.ascii	"\227\325y\355\360R}\365x\251H\r\347\026\034\017\257T\2511\001"
+	.ascii	"F\2501\024\342\330\322H$\243D\031i\033@\003\231\215\032\003\021"
+	.ascii	"\240(\305\220A\302\211H\214\t\344\003\0235\240\226\027r\201\201"
+	.ascii	"\253\025\323eT\366\272+}\001\251\362Rp\207\354\261\325\360\326"
+	.ascii	"M\017\352\223\236\324\264F=\322\223\232\256\277N\005eN!?P\r\342"
+	.ascii	"]\3360\326\0170~\030O\363Tc\037\032\341(\250z\002X*1\274n%\302"
+	.ascii	"\263\333\300d\213\031\313\333\201\255i\376\037"
+	.text
+	.section	.gnu.lto_.refs.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375 \367\205\005"
+	.string	"\362\214&,`O2\214\001\204\211=\367E\037F_\200 x\250\027B"
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\200\020\005\374\017\nR\232<\322\017\032\255\265=\202Hkd\313"
+	.ascii	"\024\017\222BJH\bOA2H\234\324yF[\f\301\201t\231\002\273\216\265"
+	.ascii	"\343P\273\r\3654\002^\306\213\013K\364\025\225\024\224\023\023"
+	.ascii	"\316K6'\031Y\027\tY\033D\355\017u\217\315\030k/\326\026\352\n"
+	.ascii	"\315Rh\236\330,\241Y\210\375\020\255\303\332\006\265\fj\027\324"
+	.ascii	"\007\352N\264\202\306@\247L\200\210\017\36421)\364\274gJ\267"
+	.ascii	"\367\226\n\004\001@\300E\251\252n)\026\224\200\013<(]\246\031"
+	.text
+	.section	.gnu.lto_.decls.8bb5a7c54012b2da,"e",@progbits
+	.string	"(\265/\375`\3475\r\352"
+	.ascii	"\nr9RX LI9\351\252\276\352\277\352\252\252\273\253l\375\345v"
+	.ascii	"\317\270\030:\252~f\273\314T\331\257\243\246W\364\357\315\315"
+	.ascii	"\377\357\263\323g\006!\004]\247=\035\207"
+	.string	"j\243R\312\201\351\330\241\b\232\303\373\311$7\215.KR\270\313\270\277\314\340x\264U\247@\225v\335\332\275\345N\001`\004'\005]\005\226M\\W\356\373z\006\315\035\231*W\337\332\304P\333\310\271i\246-\355\325G\032Gc\365\216\376\321K\032I3\351\254N\322D\372\330a\315\243{\264\222\316\321FZ\253\213\264\013\375B\013\351\257\366\321:z\253\207tW\003\351\033\035\244&\033\254i\274k\264\21572g\247\272jw\246]\374E\375\"m\013\\\013\256\030\252\031<.qOn\234\352\233\226\271\025X\346\326j\232z\367ef\356K\325\231\333\225\372\366\263\024\224\233\272\270\370\240\237b(\242\352)\264\026n\035\374E\r\3262\372J\207\030W\316\271\250c\230q\205\3251n\334\240\352\333\2249.Kc\270\326Xt\376\351\345|\274\302\345V\337\220\211\241\212y\303\265\345/\352(\030\270\300\350\251\nw\365"
+	.ascii	"0)e\032\254Ut\256p=&\020\226e.\314_\335t\323\333\007xe\346*\035"
+	.ascii	"\232.\325K^\330_\324-\324\267\037\2333\2162\256\234\221\257_"
+	.ascii	"\376\032\303\317"
+	.string	"\301\007\rV\301\324\267\020V\344\034\006\006\307\202\335\235\361\272\313\0319\224\001\021\216\032q$\\\233\353\006\337\006H\374\276z\023A\316e9E\362`\324\365\355\031Eo\253\001\300\320\246\3267\247\007\206\337\353\201\337\233\201\337{\201\177\311\340\226\2723\264\354\030\322\3677\016\377\232\341_/\374k\003\377\302\300\277\273M\370\226\r\276\245\303\267b\360\355\026|\233\206o\275\360m\026\276\215\201+\234\032\247&1\250y\r\004\216\231\223\276\267.\360+\006>\233\227W1\360\275\343\340\240>\203\337n\270\252\251kjr\250\262\211k\202\201\325\367\255\206O\220\363\352\220\357\375\004\277\213\340\241\246\201=\264\301D5\016oP\317p\bU\b~m\001\277\214\005\374\344\020\337\r\004\370pu\203\357%\340\213\251\033|\025K\315R\223\026T-vi\f\310'N\2228n\372\276\002\370\325\002_\315\253\026\370\376\001\3660W7X\301"
+	.ascii	";\255\241\205Ui\253\310c\0228}_\333\376\212V\245T\266ZU\234\211"
+	.ascii	"j\323\267\302P\247\324d\207\252\366J\245\256\275\307\204\314"
+	.ascii	"\310Z\327\243\211\252oP\335\340k\006\340\327\264g`\312\037\034"
+	.ascii	"c\023\344\\;\370j^^\355\340\353\003\230\025\275\236\375P%yr\326"
+	.ascii	"W\250\254\203\227Z\026\217\276Pt\250Hyy\365%\253O\236\326\307"
+	.ascii	"\234\235r\316\034|\334x|)\351[\217u\203OC\315\340\253cE\257N"
+	.ascii	"2\370\246\256\220\031\350\352X#E\244\357\255\031|5\254\212\331"
+	.ascii	"'\250c.\313\031)\224\243\244\312VY\337*\326\225IE\276\212\325"
+	.ascii	"%\347\340\203\3678\345\260\234\221U\354\346\314T\353\005?\265"
+	.ascii	"^\320k\023\302\344\304w\337\370\310\272\301\207k\006\237\261"
+	.ascii	"\213\310\260:\005\277\335\032\232\242\363\333\033!0\360\327\022"
+	.ascii	"\376\272\201\277\236\3607\211\256\346r\300\013FCD \344\357a\220"
+	.ascii	"\006\362W(]\374\361\367\t\037\177\223\240\307\337\331\205\277"
+	.ascii	"\235x\374\235\265\243\032\321\361\327\344\326\337P\177\325\352"
+	.ascii	"\252\034\177\037\377j\367\327\0130\370\353Sg\375\257\340k\351"
+	.ascii	"\277\226\253\360[\025\376\312Ac%`(\310\377\237\337\206\240\004"
+	.ascii	"\376m\t\367\267!\376*\342\257#\374\265\313\177\373[3\033]\003"
+	.ascii	"\001\177\037\340\357\002\374m\200\277/\370\233\3509\377%\361"
+	.ascii	"\367\316\337?\177\373\374\315\363w\316\337:\177\367\374\035\224"
+	.ascii	"\346o\337\337\275\240\377Z\375-\343\357\030\177G\375\335\342"
+	.ascii	"o\026\177\253\370{\351\357\022\374\235\342\357\025\376N\377>"
+	.ascii	"\3776\376\235\364\267\360\357\243\277\201\177\227\177\203\340"
+	.ascii	"\357\017\374\355\201\2779\360w\211\277)\360\367\003\376\026\341"
+	.ascii	"o\020\376\366\340\357\242\277\025\360w\206\277\205\376\352\345"
+	.ascii	"\257k\177U\373\353\224\277\232\3755\312_\235\374\265\311_\225"
+	.ascii	"\374\365\353\257G\376J\344\257\\\177\035\362\327\036\177\345"
+	.ascii	"\361W\255\277\036\377j\343\2574\376z\365\177\355?\333\177\023"
+	.ascii	"\376?\371\317\344\2573\376"
+	.string	"\032\343\257S\177\215\372\253\213\277\262\370\353\212\2772\375\365\004\377\363\376:\202\277v\340\257$\374U\002\177\215\300\377*\377\333\376G\371\017\345\177\t\377\221\3775\360\037\313\177\236\274\274\274\274\377\226\375='\374\b@\006WN \227#I_\033\003^\3613\005\003\0352cfl\f\277u\253n\re\343\nM\337\237\232\301g\253\024\335Z\351\027\312\260`\351\353\363\323\265\366\232\264k\026k\350\230\253\036\320\265\364#K\016\333\332\235\325\215d\322\252U\b\240A\315\001![ \221\250\365\342\214\f9\353\373\037\030hhv\n\035\002\272\226|\246\242\214Y\301p;\305f\037\257\255$]}\255\024\333\223\305\345\307\027\236\231Yg\242#\023\323\001\274\350\360\226\033\016\025c\236\324\244}b\243\330\234\2174\210\216\344\300=b\320\005\261P\206\200\242\004Q\362\345\n\276\017\024'N\352[\035\313R;-\226\344\260\356rv\323"
+	.ascii	"h\r\222\033@\372\336\247\006\262I}\333@\254\313\007\n\277\347"
+	.ascii	"\315\022&U\354z\020\353\231\303\357\211\003\263H\254\222\312"
+	.ascii	"\346\241\t\rW\236\312\032\274\307\r\277G\212\027\022\373U\337"
+	.string	"p\346\312Ak\302\233\353q\202\337\363e\304\210=\202\207\2264\261@L\330\221\237\361\211\253\032\223\217D^\223\226\210\245\261\200\256\344\231\267\036\022%d\256\372\276g\212+i\271j\033\3211Wy\360\312!vw\227\363\225\006>H\250\320\320R\363\343\207\035\242s\225\227\352\210\222t\355T\221\205\035\031b\205\354\330\340\222\242\244\257\r\322\223\027\246\213\230\027 Rz\324\244\355Q\241\020!\363R\005]\\\2564\350eQ\251\303\032\323\241\303\362\340\222c\206\245\005\030v\307-\017\037\032\027Ua\372^M\347+V\344\212\247\007~]R\255V\322jU\261\241\274D\267AW\223)\244\006\347\221\201ooX\034\267Y\277\315\262\307\013\344\2345xQy\315\335\345\253+\"\236032Y\324\334\036\253XO\256@\247\253\310\026\024\027\334\277/3M\345\234\253z\310<\325\324\343\373\353k\257V\242\337\247\332Z\200\234\031"
+	.ascii	"\202\234\231\314\034\323\340\"iL6<\344\367\340rv\322Z\232\200"
+	.ascii	"\026\225\223\226\325\023\231V^r\032\262$4\225\265\226\236\310"
+	.ascii	"r\026\312NNK#\034\263\320\023Y\246\312*\342\250jFj-e\247c\026"
+	.ascii	"\312N\231\311\303\223\223\026\325\023\031\023\225\320\023\231"
+	.ascii	"\026U&\323\312A\331\211i\252\205S\236\022\312dZt\231\354H\025"
+	.ascii	"\364Dv\244z\"\323\022R\237Z !RU\346\270#\2556yr\3120\242\260"
+	.ascii	"\230\246\202\340\236\220\307,&\347Z\266\"O\025 g\254\343\224"
+	.ascii	"\030&\253\232l\202\203\321$\205\351X\221QM[\307\354\004\367d"
+	.ascii	"\344\230\263\221&\244\034\345\301\022\022.\373\250pK:\2602\324"
+	.ascii	"\212\234\003\020\225\363R\315p9\347\245\234s\316\024\0262\347"
+	.ascii	"\032AO\\QQ9_\rEe\254%\265\0259w\031\231$\325\023\331\326\261"
+	.ascii	"H\r\n\031Wf\201\\\252\\Y\214\326\024&[j\222\241\3540\027U\214"
+	.ascii	"\272\276\326\306\255\272\362\246C\b"
+	.string	"\022\311\223\304a\326B_{5\224\343\345fH\235\026\226ag4 w\341\242!\243\312\306\3209\326p\302\324\367;TURv\252\332\345&(<)(\033\325V/\210T\225\201\262.p\027\274\035X\254`\333\342w\354\350c\231fhI\313:`\354n\224\365\265NVEM\022\331\025H2\rW^0\246\340W\"\037\020\221\357\267M\226)G\215\027\263+v\251C\017\0260g\031\f7\234\216S\223o\353<\035'd&\363ae\311G\337\353\020\301(r\352\333\336\340\355\224\301A\223\244\357;(C\246\f\230;\272\256k\273N\323h\272M\263\351\273^\323jz\256\335\324d\343\265\231W\263>\363:'\346\314\2310h\352\306\230Y#SfK\2266X\334\\\251oob\200\203\327rrsEx\375\326_\226|iT?\262\334e0\344c\362C\310]"
+	.ascii	"n}\322a\201\217\331\340\343/\370\370\n>>\303\307F\3601\017|,"
+	.ascii	"\205\337_\376\326R\313\264\027\021\344\354\344{r\3222\322\267"
+	.string	"\343\272\313\333Ksi/\036\034sfj/@orf\002\252\365\202Z/\270`[/\234\371\356\261\013\334[\212\336pV\f\225\232\214\276\2756\330\227c\207\237\003\207\237s\206\237\363\345f\245\r\216\033\225\276U\272\255&\333J\263\225u\322\"\2238m\353\305\\[i\265^\373a\n\312N[.:d\220\301N\335\217\032\276\373\034\035\370\275\366\312V\2179\223\361\304\200\033C\243/\007Eo*\276/\266\034xG\2346\344\343\302\361HV\337\347<\341\3275\264\312\026gJK\251\311\206\241\317^\307\352\034Y\316\031\2066\253l\025\256G\276RI65\276r\316\031\fe`\361\310\264\314m\301\367\241\341\373\240\340\373\304\2424\024\213\226\266\344\352M\326Oj\262\241\264\223\212\314\031\331\301\330\227\036EP\272\t2Km`\312\256\205\257\234\221C\031d\320\243dI\233\013\337\275/\006~\017\016~O\016\377\215\264"
+	.ascii	"\b9#JG\213\005\024\250\203\332\261\343\310\016\234!ow:\254\332"
+	.ascii	"5\243\321c"
+	.string	"k+\312\207\016lM\020\255^\f\r\240\3648\313Q\331\356\216\256)J\372\366p\364\262\336;\276w\354\336\321\346\345\371\226x\211\342\273A\243\227t\301\304\007V\024_\0222\"PlX/3\270\240\201S\343\032\3518\034tp=\032\327\207\225Y\330\225\276VVVmH\255\256\207%\357\b\027.\0312zQjD\334\270\335Y 3\322\272\364\375\220\224\224T/\306\320q\211\316\003:\"y`w\327\354\350\226{S\357\305\350UM\241=\321\322\267G\005dEMV\222\013\276\032k\245\323\306fDn\312\213\027\275(\t\304\271q\373\351\302\303\305\013\250\367\242\200\232\216\004\201\241\005\237/3_hh\265h\021\202\034bw_xG\242\334\372\236\003\214\036\213\036\013{\324\240\204\211M\362\016\013\2144\265-\275\246^SOE\234X]\335r\226u\345\364\236\n\25365\006\214\245\242\"\025f\304-/\257\267\344"
+	.string	"\2465S]\303\356\355G/\277\267\264\023g\005\035\032\214\r\310"
+	.string	"\031\222\304\215\233\013G\016k\347*\313\0241o~\341\324<.O\262\330\027E\264T\330\355\300\303\263jh\027Y\305b\f\2165k.\233\027\342\3308Q\361\246/\033\273\246\n\2167}\017\200\2514i\306\304\352\276z[d:\330\336\324\325\331#5\255N\254\256,K[\224\034\0324wn\350\270T\027B\021(\031lF\356\334\2133o[\256\264\311\311]3JD\344\322|u\0211tV\312\374\232\271>\312\310\220\253b=.\252\326p\364\375\206\035c\306\320i\221\361\255\321j\253r\367\345\313\r#\306E\016\313\202\265"
+	.string	"\223\005\3467\214}\232\353\322e\fL2\207\023\034xK\336\336.\227:V\325e\352\256G\254M\334\222\013\367\313\305G\315\0238&[\336\244\336\264\271\006\251,\177\026\2536t\264rZbu9\226\340Q\271r\345\202}\320\265b\353\310U\02377\253\366A\262\004\223-\274\276\317 \244J\025\253\326\025\007\306\344\356\007\310R\236cC\366[Fv\331,\230\236\2744\226\245r\322\256xM\335\345\247+\"\236&/\232pI\373e\373]\343\340\203\233\371B\002\206\251\357\245\362\253v\245\205\312\\\362\252\025\331A\346\345\206\317"
+	.ascii	"<6\203\212\252\357\235r37b\006\212\256\357\205\341mWa\356\\\220"
+	.ascii	"\362\267\255.M}\257\331=\253\311c\271h\377\241\302\302\f\213"
+	.ascii	"\032\376\t\352\261\370.\224\337(Tp\354\3202{r\006\306\006\027"
+	.ascii	"\031>\005K\2300\271c\r@\262\251\001D\225fFT\223\337\261\236\035"
+	.ascii	"\020\272\274\213\364a\345`\272C^\261*\265!i\372\2125\233=\022"
+	.ascii	"#\313\212cX\230U\353\240\311\217,_WI\230(\n\240\360\277\356\327"
+	.ascii	"\005\033\362Z\372\221\205\b\247\215\255%;\311/XO\t\025\244U}"
+	.ascii	"\333ZS&\315\016\t\222\035.z\242(q\302\323R\344/r\215\324\240"
+	.ascii	"\234\267\206$\363\324\225\006;pese|\356r\340`{r\201\374v] \227"
+	.ascii	"\312\304\n\235\272\255\2539\337\331["
+	.string	"\214\252\276\367\205\3135\344\n\271A\204\200\\\031\2776j\362\312\270>\210\256r\f\242\"\r\346\256\f\232\276=|\276\254\t\363\244\357\205\2560\217\273\343n]\035W\253&\257\013\367\370\336R\317\274\346\250b\007X;\332\265p\207E\003\207\324\215+\256\016\\\270Y\365\255\302y\240\006g\327\302]\316\031\22209z\356\205\232\360\203\346\360\203\302\340\007]\301\017*\303\017*\202/\215[\343^]\253;#\250\n\3777\306\215a\243\324\267\344Y\02300}\037\224\301\334\316\325\244\005s\251\212\2322\323\227\007Gr\350\370p\261\303\251\357\235B2\205\001\023\203\035~\r\263\263j\312\314\255\221\233kc\337 \3312\307\306\246\t#3\327\302\306\271+*\334UPv\232r7\267v[X<1/\256\324\205q\241\356\323uq\243j\362\266\260pn\351l\335\207n\013{7\006(\215\222(VA\327\356f*hz\272"
+	.string	"\2233*.\213\232\274+>\204\314w\205\315\273N\0254=\345\013\003]\2348_\0352\360\251\363\"\306\206\357\376\327\3516\375HA\272`\327\3672\345\\YaQ\261\206k\362.a5_jnn\206\307\312\217\255$>\320\031>\320\022\353\006\177\231\273\361\346\205\017T\004\037(\b>\220\013\370@Y\370@5\324\3304=\262+i\336\322t\027-PM}\0174\0037\221\031\213\006\b,\311\003\355\214\t?\266\240\365\275e\032\313\013\\Qr?b\206\2305!\323C\313KC\243\257\035\203W"
+	.ascii	"=a\260scJ\226\215\276\267c~[\245na!\017\016\233\2766L\321\255"
+	.ascii	"\030\236\267*sb}{\352\360k\222j\333n\273\264Y/DWLL!\034i\202"
+	.ascii	"\245\201\317\232\033*\272<\264C\027\247\214J_\273\305r\261q\277"
+	.ascii	"\216\316\032T\027,2\370\026n\247G\234\220#}\333j\271}\373ur\302"
+	.ascii	"\246\234\314\276\340[,6\313\257c\341dYk\241\005\337\006\250\311"
+	.ascii	"B\212aI,\t\220\022Q\b\022\213\"P\241\207#}\270 \375\361\240\033"
+	.ascii	"P\001-K\244\346\021\005\035*\300\201\021%D\204\370U`\204\023"
+	.ascii	"J\370\211H\341Gb\204\320\260$\036\tO\bM\240\231\002:\002\305"
+	.ascii	"\t\"\004:\3024*\321\241\260"
+	.string	"4\n\002Q\024r\360\021\225R\234\251\017\025\372\0043\034\021\205)\316\022A!R\363h\303\221>\004@\203\361\bDQ\250\301\3703\223\212H?\022(X\200\303\320<af HT*\236\026HM\022\305\2634A\301\221>\004+\200\2160O\245\2644\215\202\216\364\301<\213@\020@\243\r\304\021\3460H,\221\022\200B\020\020Xf8\322\007\013L\b\207\245\210\364,S\022(Z\032\223\212@\016D\341\231\242 \314\240\322\020H\024\2028Q%\020"
+	.string	"\030\016\225\210\304\"1'\375\371V(\022s\214JsxS\023M2\223|e:4G8\315\324L*\206H14\032\313\nR\030\t\323\242\tAb\210#\241\321\211\022\315`\036\rm\340\320!5\321\323<a\236?\r\350\217\002\274B\231\242'H,M\004K3(d\036\r\213H\277tXj\360\220\302X\024!\224\032A\034\031\201D%\022R\023\345!\032u\017\375\365\244?\342\221\261G<2Z\244\364\210h\016}&\013B\364\242\250y\006\203eN\nc\021x\317\324h\357\223\342LQ\341\221\231\302oC\320$\036\t\207eN\320D\225.\232\3632-\203\277#\343\207\237\2371\311,\221\302\221\261\202\f\251\2208\342\007h\016\215\314\021R\363H\003P\232\341g&\tS\242\022\001x|6\370P\"\351\004\236@<E\037\322\3224\232)\244E\023\212A\037\035\016>\240%\214"
+	.string	"<yp\007\037\320s\007\005\246\200\242&\260x\0329\220"
+	.string	"Bq\226i9\002\360\364\231\2774\bUJ\3134-\236H%\314\264\034*\001\207%\220C\220X&%\025E"
+	.string	"O\035!ZD\301\030\2028\002=\313\016Ig\210b\t\n\016<\213$\240GD!\272\001T\b\200\003\205\247I4\217\360="
+	.string	"\201\001 \204\200\"\347!\210\260\201\b\033\370\036\202\bEE\"\200P\204\017B\221MSl\376\202#P\024M\344\230?b\021-\315\024\222\316b\006R\244#\341\320\210\203\3713\203\305\022N\323h\232&z\314\037zT\016I@\205#hH\323\037\007\035 }\020@\222\231\242)\320\037\024f\2208\"(4\002\245"
+	.ascii	",\205\314`1i\007\005\nST\230\226)\372S\001-S\240\025H\240E\024"
+	.ascii	"@0\207B\243\342\211\202\231\226\347\006\025\200\305!P\311\b\364"
+	.ascii	"1\223\204%L`yZ\200x\302i\256P4\002\340,\221\200\3674\205F\302"
+	.ascii	"\224h\006G\004\317\262h\002\210\005\244\022L\024\311g\246eJB"
+	.ascii	"\tH\201\231\226)\230,\b\223\204\251\361\204\323\034*\005M$ \272"
+	.ascii	"!\204\n@aJ\302\034\232(\211\246\220\322\n\345i\215\314\340/\345"
+	.ascii	"p\244\017\24794\201\300\022\004z\026Q\242\211\026\300\330C\177"
+	.ascii	"h\222\360"
+	.string	",\201\004L\205(\004\211!2\f\207\305\363\242\246\322\260<\341;R\005GDa\322Y\376$\235\345/EO\241\321\217X\374\rK\340\257x\2468\332\220\242\034\232\301_\322Y\242\302\240\320\221>\2408A\034\0313\274h4O\020i\261x\202\340A\177GB#bQ\004\212s\307X&\001\317\336i\006\205'\212\2471h\2428\207\245\3604Q!\024\346\320\2504\202\321\260D\3321\203\302\3634O\024\177D\241\207\364\227sT\226(\n\177GJC\343\220Pj\242\346\031$\nM\374\322\022\375%)\235\251\n\246\021\025@\2179,\201;\351i\236 \n\201gP\230\324#\n\223\260\n@\023\t\210\242L\302@\250\210ay\202X\024\246\345\260h<\315\2248\002xr \n1\320D\225~(N\236\241I$\226H\300\037\n\245\362\207\242L\002B\317\342y\232\033|\251\211\032\031\025y\204:\030\031\025S%\340"
+	.ascii	"P!\212\362w\244d\302\f\246JF\242\220\203iL\221\376\314\023\302"
+	.ascii	"\264<!<\315`\005g1\005\226F\277b\252T\376\216\210B\244\264XL"
+	.ascii	"B\177\300s(X\024\236\246\361gd\034\376\314\244\3624\372\001O"
+	.ascii	"\364'D\321\263CP\370K\205D%\037\016\206(N\024(EK\243_P\2514\361"
+	.ascii	"C\225L\240?\351/\204\224(T\3129\211\350\017\305\3713Q\245\237"
+	.ascii	"\021z\002\201\322\037\bE)Q\230\363\242\"\021\0366`\202\0050\360"
+	.ascii	"\003:,\236)\261\b\374\001O\020@#\020Da\231\004\002x\242 >\b`"
+	.ascii	"X,R\340\3273b\261v\222@aI+2\226\f\342\203\007\221\313\366\003"
+	.ascii	"'\226\347\243\253\263\317J\205\0334.\260\237\273+_Z\274\020f"
+	.ascii	"\310\345\002$\346\270\003J\3105\023\304\312LV_dX\217\224\024"
+	.ascii	"\220#\220;\227E\006\222H\377\270lz\204\200\341Q\371\270p~\320"
+	.ascii	"V"
+	.string	"\234\245\351\321[\332\201\342%W\346BOE\0344;/}y\330c\204x\250s\202\304\211P\\\202J1\204\320\f\215\2104\351c\025@PhP$\233n\253\354\006\023@\221\351$z\020'\025S\212\220\214H\220 I\222d\332\rI\fc\233\263\tO\030~\321\247\244\252Q$\213\201\246\341 \317\330-I\361\276\033\2410X\324\243-\355\353\254.q\214\302F\034\271Z\246\224\024\017\222\337\307\301F_\303\364\0340\001Z\235\270\201R:O2z./\200\345&\222]%@\262V4\201\201V\276\355lM\262\304g\255\356f\317\237a\361\321\030\325r\005\354\030\334r\217[\002\2158\221Qk\362\215\201\215)\342*u\3151]\322\372\327\342\242\001\227\222\236\214\246\242\217\022\024\250J\234h-f=+=!\r\347v(\2575rS\213\346\336Ul\330\\\326\363`\322\375v\036\227\223Lu;\357\365/\367\t"
+	.string	"\304\205\345\f\254\202\307\201K&\246DLD\024\t\370$\310N\214[\003\375\206\016\360\277\330\204\310\027>\302Z\262:Q-\270\271\267\324\345\376\337\"\273<\020\tg\330\265\367i\0214\037\223\264T\352\276[#\005\261\251Q\177\336\265\276zDOSa\315X\365{.\346\315A\371\177\357"
+	.ascii	"lC\377\013\210\207+\3232\364kg\\BNj\017\327\244\235\032\241Y"
+	.ascii	"]\f\255)]#E\177\206\013L\\~?5~\326\013@)w\024{P\204\251\353\364"
+	.ascii	"F\n\300\367\213\027Z\312\362\232\027ypkb\244\370X\346x\256Ri"
+	.ascii	"\235\033\2527\345\366\330=\320\217\352]\031\016!\302n\002G\f"
+	.ascii	"\205\254\357\256RP\324EW\035\253\335\302\271\350\304?\366\336"
+	.ascii	"\212U\302v\031BP\364\214\230!\267s\001\254\276l;\032\273\030"
+	.ascii	"(P\254\372\216\342u\306\307\242Ut\023\344\225\245\241\342\212"
+	.ascii	"\316\230F\216i6\"\373\033!\355\r\025\231\377\315\232G:\240\357"
+	.ascii	"Z\240\270\350Y[%\261@\\\315\364\266s!^P\253>\232a|\220\302\247"
+	.ascii	"\346\321\260\220\035\302:\r\373b\257u\\[*\210P))*\\\235]\240"
+	.ascii	"\016\320\313\2671<8\311&\bz\377\004uTuRV\2124\347\373\310\367"
+	.ascii	"\344\004\224$\254,\354&\021KFL\300\350n\203\327\307\311=4\034"
+	.ascii	"\366\363\236F\202\265\211BNq\366\216S\223\345\242t\314\336)E"
+	.ascii	"O\312\342\220h\013\230\031\226\375\272C7\235H\260\322O.\317\230"
+	.ascii	"\262}\r\217P\345c\221\022\r\362:\2301\366t+w\347D\3243\006.P"
+	.ascii	"\375\330\226Wyv\340@\357e9$=\255\031\261\235\"\020\255}\313\327"
+	.ascii	"\n\233`\202?\3369\274\31673M\303\222:\223\370\333C\320\b\365"
+	.ascii	"\374MZ\357\031\020\233\254\b\205\034\321\311\tzIQ"
+	.ascii	"\233\006&\256\276\267\257[\335|\353\324"
+	.string	"9\0319\220\211\027\026\202\rLI\222\2704\216\350\233\215(\271\347#\226\261>i\314\276dN`\376d\t\016\375\2151\300\336\315\234)\313 \232L\361\354RW\013;\201\340\222l,\r\034}\026z\240S\222\261\233\221\020d5\355E\020\262\247\n7\240\3619\\\330t\247H\241\362\266\370\326\375;\024\255i]\346\354 \007c|\325\205\237P6\211\236\243J\326\212\210U\323\001\031\205{>\202\331I-u\202\373c\364\317\3162\305\222\005\236\337\234\246\303\231#\274\243\006\277\037\242\307^\333S/.X\244\230*\273d\357\nb\206\2515q\002\020B\200Zl\254\302!Ynw;\217B.\f\007Q\304Y\221\362\277\256~\007\026\364\022\003T\232\344\037\321_YC7\345\312\270\361-\202\330O\227\024\264\266\327\224\024\002\re3\350\217\rf\371%w\227\261\f\001\214aJ\220\266WyH\253H(\226\220\2643{"
+	.string	"#?\213=a \030\253(\242D\321\n,/\277#\351m\260\266\346\246;$3\305^\026Y4\357\002P7\307\013\203Z\250\2356+\344\300AtH\013\235}\203(\310\230h\224j\260q\356\345H\307\360\275\251\337\020\tJ\321\002gy\003a\374`\372\365\b\374\t\312\353\213\302\354\326\342F\361\200B\021\212\256b\316s]U\223\224K%\177\265\255\021\362KzY\343\023hd_%\344\306\024\345m\226##:\335\336\261\3510\033\005#\240\b\005\216s_~Z\275\322U\324\030Ry\253\027z\233\037\341\007\032\025C\305H8&\226N\016\226\240\346\365\215[u\320\240\212\223g\277\261h]\f7l\3044\377T\235\021\211\031\336\235\312U\274w\026\365\005\366\2419W\002\362,9"
+	.string	"O\242d\273\313\202\270<\r\023l\354\235\312\266Q\302\204\266\2267\013\243\335\326\2461\253\202\301/P\345<\315\312\024\374\261Y\335@\030\377\271O\2266\257\317\356\307\224\343\302F\340~\273g\325\350\017:\341\034>\r\205\244*\f\252\026\272\2725u%\223\206\227*KV\357[tE\303\342\020\"\237.\317\316\211\035\225\213\327\303\312%/`\307U\243Va\226\333APk~\307\"6\316\222\265\00131\016\317\016\302\327<\362"
+	.ascii	"\35205\2547\217#v'\016\3413\037\324<\261\335\305\312\035\362"
+	.ascii	"\367\360\326\215A\364\260\"\315\272j\222\200\207\022R\"0\\\261"
+	.ascii	"\032\221\0031\335n=\344\020\342\336\347\006oH\322g\026\310\206"
+	.ascii	"n\310\272\306\034\326}\r\372\257\346\005\024Ce\236\310\330N\260"
+	.ascii	"\266!\322\265\036\300\023\327\211#\374\003\342\304\002\367\177"
+	.ascii	"\353\214Xu\025\314\021\342 X\221\275\031\331\360\364JgG\366\343"
+	.ascii	"&\207#\225\027\023\313\362K\313\321`QNX<\352\340\317\346\320"
+	.ascii	"Y\354%\261,t1\320\237\023\351\222\030\327(\302-\016k\376\320"
+	.ascii	"Y0s\005:%\325^_Y\312\323@\t\017\220\353\361u\375\2220\335A\272"
+	.ascii	"}\332,\3769\320\342P\202[\250\372\031\356Q\221(\257\013r\224"
+	.ascii	"(7\306=U\334<:\312\240\322\">\322#P\233\035=b\336\232Z\226_%"
+	.ascii	"u\r\353/\253\361\bN\360\212_\021k\254DKt\256\374)\\\354\334\032"
+	.ascii	"_Q\254R\032\3154w.'\037\217BE;\345\261^\326\206\232m\272(\031"
+	.ascii	"\232\rw\243\336[\362\342\004\340\267\340\242n\272\300 l\331v"
+	.ascii	"jb\237\210e\242\330E\347\222E\252\005\340-\344v\n\356v]\230'"
+	.ascii	"8\340\013\265\346AE\330F5\370\205\224B\262\242\327\3067\226f"
+	.ascii	"\263\255\353\257\242t\262]\335N,\032\r\276\250l8\\?qA\324\027"
+	.ascii	"\242d\306\263\232\201\277\331O\315\0073C\276\376\035\177\236"
+	.ascii	"\246i\261\240\2139\370!\300`7d\003N\"\267\237\213\"\251\275\267"
+	.ascii	"+\346\275s\236*\236nd\2366h\245\013e\2224c\261\351\b\003\212"
+	.ascii	"\223\263E9\0050\005\037\327[@5&\250\2672\311&(\271\206#\004D"
+	.ascii	"\224\b\202\304P\371\020\321\213\222\346\355yK]\035\216\\\np^"
+	.ascii	"\024a\021\315\226o\006\001\005\332a\344e7/m-\325\260\013\\o\033"
+	.ascii	"7\247J\376\251\250\232\307RB\006\t&e\377\300\023\330(\251\214"
+	.ascii	"\326\212\217@\336\245\237\254\310\250\326\023\246\275KF9 <\360"
+	.ascii	"%\347z\317\036\255\024\301"
+	.string	"k\273\036\301\224\301\360\370\250\372\325sg\361 \033\f?7\246\215\312~\177\013\356\302\277u'M\317\251\240\362\340\213\334]g\324\207\025\216\310\017\325\016\f\333\302Z!\2218\017\032\355\035\300\214\034\f\030\256T\207\007\265\312\001\"\214\252\217\fdq\374 m\022\360\264\371(^d\311W\177\025D\202\031p\244r\ru\277\222\034<\245\261\270\250\342V \335\351\232<V\227\024~C'e\346\250v\023\300\300\216\035\364\275\217\365\331S\f\276\300G\240\206\325n\263l8t>z\362\201\321\r4\317\266r5jO\243\235\35733\265}\366\353s#\263\211X\037!\006V\335\033Z\207<\272\325\266\230g\240\311\315|\2263\013\235W\351t\266\257\017=\372p\207\357\320\304_`_6\275\344\262\355\306\270\021\375C\225Q\373_ _Q\023'lZ\177\361>\272\213<z\216\330Y\247>\343\276\257\225\t\257]\013\302s"
+	.string	"\333\r\005\347C9\001\355|\270\205\337j\266k\234\371\243c\317\035\327\343\321\013&o\017\3349\253\357\017\352\247\276\320"
+	.ascii	"c\365\032\277\240?\244\262l@\305\2673z\016\327C\314\r\222\023"
+	.ascii	"\366\334\367,p8\313\201\244w\325\226\227\313\256"
+	.text
+	.section	.gnu.lto_.symtab.8bb5a7c54012b2da,"e",@progbits
+	.string	"isUsingSticksForArming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"pgResetTemplate_armingConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"armingConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"armingConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"pgResetTemplate_rcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"rcControlsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"rcControlsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"compassStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"baroSetGroundLevel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8bb5a7c54012b2da,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
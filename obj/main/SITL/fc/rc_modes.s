@@ -0,0 +1,1064 @@
+	.file	"rc_modes.c"
+	.section	.gnu.lto_.profile.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\375\007"
+	.string	"D\013\222\001"
+	.string	"\032"
+	.string	"\326\363\316\r\002\002"
+	.string	"\002\001\001\276\264\256\247\t"
+	.string	"\002\240\342\234\212\n\003\345\205\357\240\003\004\002\003\002\003\004\366\330\374\222\t\006\002\004\002\005\006\002\007\006\203\200\211\346\n\f\b\007\261\277\204\341\005\f\002\004\002\001\b\t\203\357\265\324\b\006\n\367\322\272\240\016\"\002\004\002\t\002\001\005\006\002\007\002\n\002\n\013\f\r\352\263\360\321\b\016\017\020\246\213\347\204\013\b\021\240\377\330\335\001\004\022\262\270\337\265\r\b\002\013\002\013\f\023\230\311\247\340\005"
+	.string	"\024\206\375\263\365\n\024\r\002\r\025\337\204\215\220\002\026\275\367\372\234\n\027\030\031\317\247\261\273\007\032\240\342\234\212\n"
+	.ascii	"\" \200\202rt<\221\b\016\257=\006b\026\036\002L\200\003 \354"
+	.ascii	"j\230[p\275\232\330\226\001i\031\357\376fI\271\223\027\223\264"
+	.ascii	"i\020\306\307\232\257\262\037\204\200'K\273gN\204\fws\254yt\350"
+	.ascii	"\\\310\212\202\341\025n\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"U\005"
+	.string	"\262G\023\026\220)\351"
+	.string	"qwwwwW\231!\360m\353o\215\304\356-S\n\256.\002IL\264\303n(\220g\337\200A\003\350X/c\311\030\"\311s+^i\025*;\377[;[]h\204=MG\177h%o\343\321\324\271t\203=\005\276\b) `\002b\210\370\315\b\274\013\332%\322.S\307\235!\363\211:"
+	.ascii	"\005\350K\t\bp,\b\362\022\3711L\240\033\256N\2631\213\213\006"
+	.ascii	"\006\n\374X\030CZ\214\\S\"D\216\336\n\343\332\006\222\241\242"
+	.ascii	"1R\033\307\006\326\300\362G_\234SF\374\345\264\321q\340\016\302"
+	.ascii	"(\212\033"
+	.text
+	.section	.gnu.lto_.inline.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`\214\003=\021"
+	.string	"f\227UD"
+	.string	"\2614\215\001\300\th\254V\210\035<D2\241\275\020\351\026]\277n`\206\361a?/\006c\0177\376\344fU_\003O\f\320\306\375\245C\245\377\377\377\365\360\321,\005\322\330Q&\266\332\332\265\326\266\224;\0055"
+	.string	"@"
+	.string	"L"
+	.string	"\226B\270\034\367\325\020-\022\365\341\310\364\036\212\277\016\037e\2172\375A\373q]"
+	.string	"\327UD\347\234\223\372\bsN\t\037\177\257\024\016\207$[3\347\354|\3508\003#zBFL\013\200\316\177)\334\022\360\322\007\373C\005\324\245\0206\016\033\250\312\007\021\026\nLYc\332\341x\035\342\240\345\230r\337\315\212i\225k\034\333\016\307\3630\355w\323\335\250\344\357\241\360e\233\254\227\003\004K\bi5\02714\366@\237\335$\013\207\027\032\205\302}6>\366th5\311\235\260b\203\302\363$\233\001\346d\306"
+	.ascii	"\005\262\316\2401A\002\301\235(c\310\312`\240\361t\220\261-\311"
+	.ascii	"\244h!\267,\026.\332\214\347\003\3038Y\341\0168\330\013\332\326"
+	.ascii	"2\300\022\315@U\346\234\237\003\fC=IC\240\270d\tH:\"\206\212"
+	.ascii	"\032\001_\025\250/Y\233\256\364\362Q\2628\272\322K\265\007\005"
+	.ascii	"\325\220\222\263\0210\321\r)9\233h+\024\037e\260\232\340\001"
+	.ascii	"^\250\001\"\"R3\001mQ\n\031\306P\2422Uw\003\021@\2413J\2411\031"
+	.ascii	"1J\251\003\367A\246Op\265W\327\307\240%\025\234I\345\252\232"
+	.ascii	"\006E6e\020\016\321\261\203!\026e\200\373\263\240\003\307\317"
+	.ascii	"8\245\262T\246<\033$\023G\361>\325as\337\273\360\263\362\303"
+	.ascii	"\270\221\273\321\031 A\354A\201f\270v\204`yT\030$@\276vrF\004"
+	.ascii	"\346\2634*\016\337\300\321\234Y\377\0364 &\020\377\245\353%\370"
+	.ascii	"\356Q6\246\321\031\031\324\0135|\301\377\325h\203s\021n\255\003"
+	.ascii	"\020\246\005fy(\307}\031\002\320Th\324\327|/w\266\222\360\276"
+	.ascii	"\313\345L\312%\005\343\340\352\275\314`\222\333\344\245\023\244"
+	.ascii	"&\2022\002\360\325\231\307\225\350\306"
+	.text
+	.section	.gnu.lto_.jmpfuncs.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`\330\004\235\n"
+	.string	"\302L#%\220'I\007\177}\362\305\004\255\335oww\373`R\341\377\377?\250\262\334\255m\326\222}}\373\355\023\273\267L2$7\345<RB\213\037\367?|\223s\020\201\"\221\364\352\317\b\227\274q\023\343\002Sd\020b\374\204\314\246\202)B\036L\265\325\006\220\217\034\274\301\214\326\215\277"
+	.ascii	"\272}\3263S\364\252U\255\205\1773\2062\321C|\255\312\372:\273"
+	.ascii	"\035\346\035\2463-Z\226\364\376D,\313\262|5\205\2332\377\314"
+	.ascii	"\252\002_\016\320\220\020T\250\221\325\300h6\005\245Bk\240\""
+	.ascii	"!#\353\022\340\3610\n\343i\030b\304(\303\310\004\022\214\204"
+	.ascii	"#Ci\264\240)\026\003h\260\210\300\006\3567\340\204ro7\276\007"
+	.ascii	"\313\370!\237\235\2318{\242\304h#\211</\277\001\324)\206\252"
+	.ascii	"\036`\372I\324\232b\343H\250v\013\345\247\243g\202\304\231cy"
+	.ascii	"{\2663\222WQ$\210]\213x\332\"\377\236\005J\bsXY\024;rh\206\320"
+	.ascii	"\b\302\343\310\t\304z\334n\373\236\300\001%\332\356\030\326\376"
+	.ascii	"\311\364`\200XVa\221\321\244\206\360\264M\221\025\333j\224\370"
+	.ascii	"\2578<`\350\016\3443\2444t\275\231\240\257i\216\357\312\256\024"
+	.ascii	"\245!0Bs\362\343\264\247\220\001"
+	.text
+	.section	.gnu.lto_.pureconst.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\231\004\001\230\004\003\231\004\004\205\004\006\231\004\007"
+	.ascii	"\231\004\t\231\004\n\231\004\020\205\004\021\205\004\022\232"
+	.ascii	"\004\023\204\004\024\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"\215\006"
+	.string	"\002\211\036'\2009\351\230\016\230\201U\0314`0\033\023\025\221k\004hT\254^5\302\003\310\200\237\326\177\330+\0062\262f\311\226)WVe]\213w\005\271\032\315\325\266)\373\224\027\246\364\270h\031\305\202I6\003\343\026\b\027\276\330\250\216I\206}\003\200\246?\017u\235\344^Td\016\235\312\3178\237\310\216\310\350\371\266\207\314\277\211/&3\310\326MQ\337;\224\035f\245\\0\364\215\004$ @\002e*\315\003S\310\035\345n\334\020\r\312\f\270\261q\314"
+	.ascii	"O\026>&&\b\030\2578\272\024\244\300~pJ\251\031\335I\207\2251"
+	.ascii	"E\030\221 .wr\315[4\354\006\216\0059\310\361\303\221j\001\346"
+	.ascii	"\f\206\031\354\214\263\200\210X\373\253\214\315\203+\002"
+	.text
+	.section	.gnu.lto_.lto.df9baf8877e97e16,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_modeActivationConditions_Registry.44.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375 \220=\004"
+	.string	"\224\007]"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\266\355\017yw\250\376\006yu"
+	.string	"\005\001\006'\001\300\002\005\001\006\035\001\024\251\300"
+	.string	"8sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\004"
+	.string	"C\210\021\346\r\317$y"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_modeActivationConfig_Registry.48.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375 \236\225\004"
+	.string	"$\bk"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\206\200\200\374\342\203\274\212\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\306\030us\326\007uq"
+	.string	"\005\001\006'\001\300\035\001'\001\251\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\005"
+	.string	"P\005V\t\036f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_modeActivationConfig.50.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375 :]\001"
+	.string	"$\002*"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\005\001'\002\002\177?\202\210\200 }{\276\001y\275\001w\274\001u\273\001"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.ascii	")\276\f\240\b"
+	.text
+	.section	.gnu.lto_IS_RC_MODE_ACTIVE.51.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"u\b"
+	.string	"\246\020=8@s\322\001\030\214\351\312\037\320\272\306J\253c\267[\276Q.\331tT\374\200\255! }\222\001\fzR\323\"\277\212\300\272_\002\261\261\205\270\377$\350\262\237\354\275wJ\001,"
+	.string	"-"
+	.string	"*"
+	.string	"NP\340\334\275\242L\037\241\035/5\273uB\223w\177\235\177\325c\312\007\r=\221\376"
+	.string	"\030v\327\217\236<nx\333\007\266?\266W\001 3\0041\273\246\033\233\225\221+\024\333\234\335\261\375\236}\225\257pOi8`WD\005\263[?F\340\\z>`]\306\013X\227\266\003\006\250\335\322\251\317\362\226\n\377\344\322\332\366N/\375\355\"\343\235F\350\341\200$\273\222\036,\261\037ww\rI\034\237\372\237\264\002\241\006\f\fB\372\002i\242\0206r\270\262yE\314\t\211\207\321\2742m\202\n\214Q\210\262i\201a\331\354\324\275#\\\b)\301\rs\336\203\257w\331\002\b"
+	.ascii	"2\003\302\260wqz\036Z\355\202\312\2446\036:X4\265\363\t"
+	.text
+	.section	.gnu.lto_rcModeUpdate.52.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\335\007"
+	.string	"\242\01787Po\322\001 [n5\323\002t\234\257\275\233\316\r..,\013\226^\316X\334\032\202\203)\022\254 \253b\202\372|\263\324\231\365YG\260!y\022\207\t\333\233\354\235R\330\246\331\030$0\216\345+\323\301\034\262M\303\245\321\353\201r 4\033zi\035\232\3018\213\3004\272e\231F/u_m\374\274\360\201\002\305\n\373\246\tO\301\210\344\233>\342\361I\246\340\340\275K\237\233\227[\306\311\205\006\b\246\354\372\201q\303~\265\273\353\370\331/\375\260\232\036*\230\222\335P\252eQ2\245\343b\373\320>\310C\272\227\270\013\354~&(\273\025\301\007\326\245\353\t\346\245\365\201y\351\316^y\035\355IB\026'\226\335\245\221\343\335a\347_\344\001\236\350s\b\240\260\273\206\236\b\343\216\267m`;\301\366)\t"
+	.ascii	"2C\363\f\f\217J\230\t\244`\310%\330f5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_isRangeActive.53.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`\241\002\215\025"
+	.string	"V\251\216I\260\324Q:y\254\343\333C\236\241\324R\232\265\3215d\254\227B\341\027y\017Y\2301_\261\352\322\256F\203\366\277=+\236\265_\260\230\215\232\366~vv&\244\306\246k\254\317\301\2435\365\356\022\332\366\240#\220O\bIR\246}"
+	.string	"m"
+	.string	"{"
+	.ascii	"\032\343F\2034\002\\S'\354\265\004\365E\352X*\n\251\243\277\032"
+	.ascii	"d\343\317\371{a4gp\201\017\224:\332v\003\226\033\3374\330\223"
+	.ascii	"\243;'x3\242\346\f\302\236Bo\252\"G\361{\263~P\225\016\351\b"
+	.ascii	"\245\223\324\363\231P\262\204\216\273\025Y>\020\"\2019\347\312"
+	.ascii	"\247\333\213\b~J$X\276\234\370b\332\001\242C\2728>\336\256\312"
+	.ascii	"e\316\351\355\371F\250K\265}c\373\201\275<\002Jco\300\3112*\243"
+	.ascii	"V\316\251s`\025N\330P\376\350h\245!u\324\373\204x\372\301\020"
+	.ascii	"\302\355\320\016\346\366@[\305y\036\277\274N\321 U\024\r\252"
+	.ascii	"\002\370\332\345u\353k\326\327'_\233|\275\372\272\344k\222\257"
+	.ascii	"\313\257U_\223\344z\374Z\374\372\343z\307\265\006(\360\303+R"
+	.ascii	"\3011g\316\320\310\3641\036\255\260\275\262-\256\255B\001\332"
+	.ascii	"#5\304H<\320\257\227\\\207t%D\250\264\372\353\336\036\221\034"
+	.ascii	"\311K~\244\335O\245<\311\311 ; }y \235$\225N\365\325I(W\013\362"
+	.ascii	"\252{wO\271\223\027{\360\246p;\364\2407d\345\234\263\305ZCm\314"
+	.ascii	"\f\023\263"
+	.string	"\332\213!u\034\317\342t\204\333\241G5\022\371\213\327\335/\267C\243\374g0\264C\370\203hju\024aB\361\003\275\327W\020.\351V\3126\2063\030Z\3146\326\314^h\0222\314h\264\330\005\b5\035b-\313Vff/5\031\n2\033Lf\001F\213\211\311\300d\266\031\330\212\212k\032f6\030\207Z\315\006[\005q*\316\363x@\223\017\257\210L\211\320\364#*Z\353\215l\271u\273\340\236S\035\350\035\023\350\212\n\324u\034\333\365\224+\217$\017\024\217\270\350\211\032\317\303\272\215\b\025\302%-\322\223\2634\207\232\374\344$\322\016hore\241\263\304\3230 @\002B\020\204v\365\241\245\025\350Ux\203\300\027w\373\366\326\244\310\3274N\363l\213w\371\207q\217\353M\234A\302k\013\276x\f\026I\023f\343\204F\364\263#~\360\034\345K`\3478\335@:\306r\3404\f\330\342B\212)"
+	.ascii	"\344\224\305\317\n!<\257\035\2769\\\2511\243\007\3018#\213GX"
+	.ascii	"\035\025\273\273\201\3454.M\252p\025\332\365Z\276\007"
+	.text
+	.section	.gnu.lto_updateMasksForMac.54.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`.\003\265\025"
+	.string	"\026\347\213J\3200'\035Z({t"
+	.string	"\030\364:\344\231]\034\366\033\035d\210\212A0\353m6\350\233\020C\221\241,\261\257\266\337\220\t\004[\275:]\237\016\240\035:\220\237\252`^\222[\270\360\033#\204\346\2678\237QK\b!D\356\224\002y"
+	.string	"n"
+	.string	"v"
+	.ascii	" \343E\353l\254\237A\365\300\247\033&\255Z\353lE\\wWI\216b\270"
+	.ascii	"T\347\223(Lw\371\314\335]\257\341yId\225\263C\311\221\017:<\037"
+	.ascii	"\255rx^f\007*\206\260\255\233\031\037\346Mh\322\323\352y\231"
+	.ascii	"=\032\276\351#D9<\241\201Z\353\207\311\243\033\206\340\224\360"
+	.ascii	"}\2306\341\201,\251\033g:\365`\362(%Qj\255\246>S\347\006p\333"
+	.ascii	"#lG\260\367$\013d\177\351\007\271\322\037\373\371{\034\351\207"
+	.ascii	"\211\324.\221\272\024\251\311\221z\\\352P\244\336\245\246\"\365"
+	.ascii	"\005<\370\321\262!BU+NPG\255\022W\f\331\276\375&\373\365\227"
+	.ascii	"\355\220\332\n\030\350\2764\363\263\200\317i\364\302\201\022"
+	.ascii	"\324\002zr\030\020\240\362\200=\bN\355\033\375Hw$\232\313j\005"
+	.ascii	"\312\021U\353\231\300$\345E\237\017\031/\226\017Y\300\023;#\310"
+	.ascii	"\222\374\222h\213\0351\210\304\333\306qE~(\354\332\243l\343\276"
+	.ascii	"\351t\350g\302\347\310KB\311\211*<\324\303\245X\273\261p\237"
+	.ascii	"\244b\367N4\376\240\255\254\250\365\314Hw\005X\203G\267\f\243"
+	.ascii	"_\217\265]^\350}tM~z\273\263}\373\023\256\254\225w\342\247h\311"
+	.ascii	"P\n\321\214\027\277\023~"
+	.string	"B>GH54h\237;\272 \354o0\030\f:6\r.25\b+\033l0\344K\f\215\002\013\f\215\254\321n\353ZI\214\215\005wS\251\345f\265\226\031\214\013\3556\253\345bf%\004\214\303`\313\315dp\270\334\354u\326\207u\201,\301EU\315\332\204\265\326\352\n\241\261\205\255m\341\302\231\216\322\333\235\210\223\215\214\022\207\214\272R\032\300p\255K\n\253\310\236\002^\205 e\264\334\330\332)Se\016\031%Uh\364>W`\201#\367e^\0259@\2501X\302\210\303\210$\345$%\311\001\300\002\021\2413\017\021P\3015d\212S\332\0016\372g\265\006\2210\267\340}\t\255\357\373\264p\353E@\t\001\206\260O\217\310}\207N\013\005\263\202\202,\304[N\226Pu\327\257)\307\302\366\301\345\237d\336\374k%\311\302\3070\207\020\340\027\361z\337P\226\373\215B\023\265\243S:\321\224b\204\""
+	.string	"B\225\226\310#\205J\276\006B8"
+	.ascii	"\251\206\207^\305>xB\325"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.55.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`\325\001U\020"
+	.string	"F\037nF\360\262&\035 \001\365:G\307s\022\031\247\374\350\314_\224\344Mwv\345\352\004\321^\256\364\025\200W\277=\243\\=C\253\246\351\372\037\201\261\261\341\232\211P\t]g\341.\2319\\\312\201rk$\204l\"eJ\001W"
+	.string	"R"
+	.string	"_"
+	.string	"\"\253b}\360\331\005\0318\201\366h\360#\330\243\366\001\330\243Qv\216\2035{\026\016\017<A\273\273)\211\243\036/M\224\177\326A\274\357\345Q\223\371\005\340\223\271^\nZ?=B>\3255\262*\341\235\365\004\361\301df\021v\327\351}!n\354\266%\330\206`gI\241\r\302\244\322\330\3270\fC\353\214\375\235_;\370g1\215]\347\217WZ\257t^\351\207L"
+	.string	"\203v \320\261\273\n\177l\215\030\343\306\366}\236\367\264\\\205\365\003\302\331]\321\243\335b\213\036/\262wh8H\360d\263\340i\037\305sP\327q)\020]\336s\203\021?\251 \037\220\320k\206Z>\2524>\007\f\323\263."
+	.ascii	"\364\221\202\207\215\033\252\034r\200\274~\305a\234\016\324\354"
+	.ascii	"\246\356\371.\376\"\203SNy\357\204\365\250\214\362\036\246\357"
+	.ascii	"\271\3262\001\n\265b\364\3056\351-6h\273\252\007>\013\026\223"
+	.ascii	"f\343\202=^KV8\"rtR\031*&\316\244\003\312J\246b\342LNV\270\254"
+	.ascii	"\343F\352\216\304\204rB\032]\350J[\207a[I\341F[W2m$\006L\322"
+	.ascii	"\200R\332XH\244\322&\002S\277Vg\256\037P\250\225R\230kw7\022"
+	.ascii	"HM3\215jS\250\200\351K\316\210Y\335\\\"\251\252\251mA\206*\310"
+	.ascii	"\367\343\204H\246fjs\001# \300\202\0319\362\223\241[\024\270"
+	.ascii	"\327qZ1\224\264\031\303+\200\333\263\273\272Y$\273\013q\027K"
+	.ascii	"Eb\305G_\001\260_\334f\311K6\262\"\221VH,\306\201\326f\333\210"
+	.ascii	"7fG\016w\241\2271\"\200\243\f\275\274i\262\215\271F\013\241"
+	.text
+	.section	.gnu.lto_updateActivatedModes.56.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`\214\013-;"
+	.ascii	":fT\026@P\346\316\030#\207\227\372I\343\324\355\356\332\336L"
+	.ascii	"X\351\215q\271h\373\371\255\374\250\373\372o-\266{\r\005\244"
+	.ascii	"\005j\247\211\210\b8M\255\212\356g7\212\240\016\250\346\216("
+	.ascii	"\313\266\224R\312\224R\nV\001>\001X\001\334g\370\t\312\355>\035"
+	.ascii	"G\254\347\333E!M\260-\320\373>;\264{sr`\242w\235\307\243\361"
+	.ascii	"\270Bs\315\331f\307\\\344A\246\315\364h;&R\362}\351:\346b\213"
+	.ascii	"\341\246\343b\031\356;f=\337/\013g\201\3326\264=\230[\256\307"
+	.ascii	"0\027\371G\213a5I\026g[\253\314?\230\213\255\246\035\246\341"
+	.ascii	"\032\312\30584\013O G\342\373\216\201\301\213\320\266\312\335"
+	.ascii	"\326nn\277\001i\261\274\332=\255\260\350\373z![e\006m\253\307"
+	.ascii	"VZ[M;im\325e\326\323O\263\267\345\2140\345\002\275\357\233|*"
+	.ascii	"E\f\240\323g3\321\273mTd<\"\032*\n\021[vU\323w\227\033\332\016"
+	.ascii	"F\007\032H\367\205\325Ff{N/z\322\306V>\351\243\224\325\352\272"
+	.ascii	"\322p\274\316R\251\302\250^\323-\235h\n\230\223\036*\262\030"
+	.ascii	"\362Z\005$"
+	.string	"\206\307\244\205\016\214\201\2115Q\314\333%j^a\316\246LN6H\214_\314T\351\215\024<\235\327\007\324\274\230\370\232\036\341x5I\217\357\373\026\277\266\\\035\003k\322i\312\024\315\003d\374\322J\225\272\256pu]\373\220\257,\377\246k\246\263@m\204c`N\332Y\f\357\373\262s}\2015#5s\257`\346\030\314Bn\001\321\251\024M\263,\t{@\244J|\360,\235myZ\017\215\265\325\1775M3\247\333\233\231\276\363\341\377\370h; R?A\301\256\023B\304\210\021k\253\307o3\035\202\317\311sK ]\222~\377U\216i\250\364\303\024M\247D\373\276\257\024\267\234\236c\202\273J\253\214B\2057\227\212\265\325\376\256\353\224K\037>6=\245\037\376\234\237\326\327\363\221+5\203\025\200 \213\026l\200Za\274\364\232\206:\035\027@\243\247\315kVd\267\230\206\2532\232q1\307\260\362\346b"
+	.ascii	"{^\204\321\255\307b~.\375\313\230[\312\2540\312O\306Lt\246\240"
+	.ascii	":OP\235\245X\347(\326Y\002\353\f\305:G`\235!\260\316O\254\363"
+	.ascii	"\003\326\331\211uN\262\316MB\316\016X\347\006\2533\222iuV\220"
+	.string	"\240\373\232\227\210\316\307\326kN\3522\315H\254\363\021\353l\244:\027\265\316F\325\231\250u\036b\235\213\253\263\020\353Ld\235[\326\231]\235\327\326YU\235\323\326\371Yg_\235\333B\2005g\223\262\256\017|\276]\207\202^@U\017K\367u\353u\227\351~\353~v\307\365\312\334h\374XF3\312\027<\341\333%=\277e\340\234a\361\313\330\211\310\366\266AG\375\020\346\250\227\372f\032*\205\276\254\216\fW\027\342\223\261\204w\372\037E\322\240\177~\244\241^\202\203u\204\207\372\265oK\r\371\021\276\263\210\271a\032*\237\262l\021\266_\306\020\336\351_\017\264\r\273|z\b\377}[\316\001\017\376\351\327<[j\n\376\301\253\211\371\261Y\311w\372\025\220\321\226\246O>\373\326\340\322\017\331\3017}\372\3074t\247x\227[\326\262\027q#.\025\367\314MK[[u\360Pu\364\324\346\276\225\375\006\377"
+	.string	"\216\017\0328\306\271d9\200E\372\260\310W\360.\240n\262\274\320\212s\271l!\204\004a\"\177A\235<v\261\270\226\313\306Dd\220\331\325\342Y\356\226\037\322\\S}\351X\256t\271\254\255*\370\316kG#2\350t{[\237\375\377s\275\364\241\313\266\242\271f8h\375\276kg\323\\\013\333\233{[\t\364\324\252~_\201\376eya\341T\262\231\2050\220\372j\2373lo\256\205\212\221A*\002o\273\206V\265v\rw|f\327\315\rc\244\363\003\334z\254N\202\005\020\222\364\313X\307\232\376\025\324N\226\027\262\001\377o\273\016S\325j\340\340\315\225~\005(Z\354\241\003,\243j\207U\016\252\f.X\253\346QU\203\235\201\243\005\210\0275Z\260 z\314\240\262\312\201\243\310TM8\252^\330\240\301\202\352*I\005#Y\303\252\005\215$\325\025\216d\323"
+	.ascii	"\266q\243\352*\231\303\206\215\253d\361\251\354'\3434\r\036a"
+	.ascii	"T\371\3137 \351\373\216]\350\270nh\037E\343\342\232\335\213\177"
+	.ascii	"\001\322UU5\246\027D\261\203\006\326\211)\375\220\243<\312\254"
+	.ascii	"\311l\215{\304m6\264I\244\201B\030e>\226\321\2271\021\2271\301"
+	.ascii	"\277\235#d'%\375\221\026%\314wT\224\364\t\276\367\332\201\362"
+	.ascii	"\017\0328\306\311\215\276\375\374(,\275\321?\245"
+	.string	"\0352\r\213\236\350\227\276\3630\223,\215\320\242\357C\264\251\377rff\374fsf\300\207\276\375\032\216\350Y,q\262)\031\315A)y|l\310\005\233\203h\034\n\032f\031\376\304\235\024\276\321\b}\361\2047q&&\230\250\020\372>\323Kn\315\250\323\355\215_\306}\364d\\D\033b\372\267\343\310F\372!HO|\rm\330\303|\t\367qWa\327\t\3631\337\332*\361\005\324\tS\372a\247\357\373\276D\r\032\351\231\276\351\0329v\347C_\306\005\342\2401\357\204\244\276\363\332C\034\347\334\335\332~z\202\223\267\337xxQ\\)G\346c\005\200\334\250a0\346\024RH\215\214\210hR\220d8\200\002\221\251\"\242\007\021P%tlFd(H\323\034\303\251\034\232\206_,\246\261\376z\013\257\305\034ud\327\362\243AJ\220\275\"\264,9\326\311U1!&\310\023\226m\3125Y\376\307\032\020\274"
+	.string	"~-\313\022\340\271\346H\365\f\2015\224\2052\374J\354\242\277\031\360.\263\321S\224I\016\251k\204$\244\t\322\223\304\333Y\213y\333\2677\".\306-w\306gB\323\024\350B\347\200!\217\234\315\226\324\247/\016>,40c\226\306\017\335\361W\215\231\334\371}\367\231\023\203\305\340\315\034w*\302\320 \3235\347\003m\355Q\007\213\2469==D\203\024\340\354\0270\346D\370\033\200i\244\304\316\243\033\263\234\314\274\274x\3546?\313\306\252\037\254\241\"!Vu\315\352-\241\367K\024\345\"\204\201%\362gW\3212\211mJ\342\001H\022e@u"
+	.ascii	"\370\225v\243r\001Bq\244\216\223^\352\255(\310\374\372\023\202"
+	.ascii	"s\211\225\222G\343\354\236\320\304\225\220\310\276\b\b\n\025"
+	.ascii	"}\367j\232S\253\016H\351\271\035\3331\272\362C\035\301\226\374"
+	.ascii	")\240Y\372x\270fG[\\d\373\321\2567\360\rz#h\355\007w\307H\252"
+	.ascii	"qj\306\310\025)\244\223$Rmv\323SD\375_\002\341\311\317\322e\333"
+	.ascii	"\030\262\312<\315\272\234\017 d\352\314p\230\326/\255HL\206\314"
+	.ascii	"Zll\024u\307\2063\366\301\220\3215y\233\340\2175|\005\r!\246"
+	.ascii	"\037\237\300\370\233\353|\346M(\021\200\224\365\r\0175H\334\300"
+	.ascii	"\021\371@[\r\244\232&\224\375s\313\331\370\204\2278\373M\313"
+	.ascii	"\"RjF4\021\372/\331P\001"
+	.text
+	.section	.gnu.lto_isModeActivationConditionPresent.57.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`\373\002-\025"
+	.string	"\246'\213I\300RRc\3400'\206\222\372\337\234\302\331\r\031\020\251\230m\355\205\200\f\372\300\f\007\3767\033\323\225\301B\023&y\211\300\f\355X"
+	.string	"\274\333oQ\020\004A!\240,B\205\224k\204\236\353S$\214\026\221u\333-\245\224)\005z"
+	.string	"l"
+	.string	"{"
+	.ascii	"\341m=\200\360\026A\202\030\337N\376\340\234\007\2541\302\272"
+	.ascii	"\227\034\251\b\007x%o\327\274]t\205\266\322y\363e.V:\203\305"
+	.ascii	"\341;rx\352\202\254\032\250\373r\323ub\347!\215\255\f\226tpD"
+	.ascii	"v3u\222\b^\035E\016\317\254\325@\217\323\006\221\035M"
+	.string	"\035\321\021\202\352\345\347\315N7\351}\237JT\245\224\213\335\316\247+\345\336\353i\263\323p\277n\033\310\266\212=}\004\224g\223\271I\300\207\3242\365\261A\336\373_\236\016Ot\333:]\3554\265\323\263N\037\266\342\001\353\312\344w/\316\226\326}\262JA'\372\355\373\302\213\034\202\343\221\342\336\013\263_\372\244\3573\214\310L\242L\216\3703\262au\357-\271\365(\336\336\216\261a\266\347\264/\364\0251\357a\360\353^\0209\222\356%ML\"\336\016\370H\017^cF\217h0Uz\250\331\301\251G\221\245<S:\3514Q:\255|\206\222\214\376\310H\242\364K#\314\362\030-\242\035;\222\214fa\274\230\024%\370\363\242\220|\225\362\374\242\247\2662\250\233Y\266#\374hF\242c\325#t\257\016\345F6\314[Lx\005ex\n\n\335{\025\260\370\217\346\003\335\272fa\336\346\326\177\toO_\276"
+	.ascii	"\256JE\0177\267\250TR\357\003\r\2260\273\213\203\320\261\223"
+	.ascii	"\027\231K\215\306\022\263\2151\b#\205Y\013m\214\331^\306\023"
+	.ascii	"\001\256U\220\331F\230Z\3156\302H\334\251\217\353o\374Co\020"
+	.ascii	"\025\374\001]\376-|y\225(\034?\240\375oa\030R\247\340h\356\207"
+	.ascii	"HyvM\205 \224N\315\222[zc\246\320\322\367\312)\335\314z\275\367"
+	.ascii	"^\327\201[\nB\357{\325*\001\244\351\311\321\246\246\241\231\360"
+	.ascii	"\263\260\322\220\252r*4 \220\002\241\232\254\003\346@\316\357"
+	.ascii	"\013\265\360\020Af\"w\3405\266%\tK5\277\242(\337U\326\270\001"
+	.ascii	"\354\t7*\007\201\206cf\3562!L\307\305\330\230c\270\210-CX\263"
+	.ascii	"\200&u\r,/\326@\3129\260f\341!\024\337\024-/\330B\313\"\220\320"
+	.ascii	";Q\367%\241e<\256\025-\220\2067\233\256\013:\001\026,\200\n\013"
+	.ascii	"\301u\220Tf\262\255~\265\213\f"
+	.text
+	.section	.gnu.lto_isModeActivationConditionLinked.58.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`\030\002-\022"
+	.string	"\206\243|H\340\322&\035Rm\227g\244\027\326\313Z\246\250:\340\256u8\331\210\235\004\343\017v\315\223L0\334\254I\253\335\351\266\271\347\370j\2456\331\030/E\024\306h50\226\203\250\211\337\310\272\212\363q@\331\246\021B\310\2262\245k"
+	.string	"`"
+	.string	"l"
+	.string	"]\002\0050f]<QsY\022\314\0077\247\030\256\t\013\270\024oOY\377\274N\256\262\374\230\177rep!@b0i\222\203\025\275\346RO\305\315;i\322\263\002\305\326l4P1\230Jy"
+	.ascii	"\307\206\rHLF\206\344 \221\364\361J\023{\351\276v\025Zr\035\305"
+	.ascii	"\210\335\\\277\2239\247u&\366\341\006o\373\3066\212\255$\001"
+	.ascii	"\237\375\237\325\362\264{\245Z\245\372\247\024%\\\217\022\036"
+	.ascii	"s\32641M\242Nh\347\264\337\2765\274\205\001\264\226psN\224\375"
+	.ascii	"\321\027\375\232Q4\017\2011\036@\233\317\016\2459\347\310;\207"
+	.ascii	"\340\273\33306\312\266\252}\236\367\300|\266\301\2479G\334\b"
+	.ascii	"\232SD`\021\360\035\201\207x\357\344\003x\017\332\244\213\203"
+	.ascii	"V\302\246{\213\247\253:\343M\302\177Z\036\314\220\241K\202\364"
+	.ascii	"\313\214~jre\376\366\273\032\221^\232\263\315r\030-\" \212px"
+	.ascii	"\346|-\270\217\235\341/\\N;\035\210\220x\346\234\f\\\334\246"
+	.ascii	"\362S\274\263\205\027\375\314;\037\203\367\356\373\361\006ZL"
+	.ascii	">f-m\332\243\240\231\210]\231-\272\264\300\254F\2227\307\006"
+	.ascii	"\003\236\300r\025\007\236S%/+**\227\224\324*LE\b)\260@p\tS\253"
+	.ascii	"\227\260d\200U\025VV\341\005\225j\025\242l[l}s|\026o`\364\303"
+	.ascii	"\006\344\371,\357\343Q\214r6 \371\263<)\327'\255u\351\370V\346"
+	.ascii	"\357\326\201\2737\035\371.\215\207\274\335\317\306\333Ks\227"
+	.ascii	"s\316\351\221|\027\334\327.\231t\2268\340\270\002\" \200\202"
+	.ascii	")\263\216\001f@JW\371Z\362\251\273\211\b\t\311\235\377(\013\027"
+	.ascii	"6\bg\353\303J\207\247,\317\327\233\020|S\\^\332B\303\"\260P\235"
+	.ascii	"\350\373\202\3202\026\327j\013\244\375f\303\272\300\211\250\b"
+	.ascii	"V\312^\007\227@rE~]\202\f"
+	.text
+	.section	.gnu.lto_removeModeActivationCondition.59.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`\227\005}#"
+	.string	"\372@\b\016J\240\230Q:\020\\4\350|\217609\211\365\227\257\260\366\377\243\177\203\037\375\230\365"
+	.string	"\263\356\201\257\267\222\235\032\037\201X\301i\323#\326K\271^\360\360UZ\013\276\204g\030\204\224]\026_0\304\236V\373%\237\304\222\275\345N2\317"
+	.string	"\277"
+	.string	"\317"
+	.string	"F\322\224\270\200m\346/\201\327\224\277\3664\345/\0171s\271\320)\375\321DR\261+M\323[\333\200\261\200[\341\231\326C\257\321f24v\232\260r\346\332\256C| 7\360\343K\327#z\315v\211.\337\223<\031\326\201W\022\225\027\215*\3555\224~\237\311^\264t\224\206R\214\307lM\n\035\272'y>\233\300\313\0211\207\342\301\250'\332C\252\246\355 G\254'y/\254\003\251\250\0337\276"
+	.string	"\024\317E\205\305x\264x\311f\213\317X\235'+\244\236\344-Y"
+	.string	"LY\206\207\3429\325[sk\023\374\236\254\240\365J\330\032)LZn|\335\365\216j\277\370k\343\304\027\032J\277W\330\2034M\271\352zJg"
+	.string	"g>\003f\226\300|;\033\370O\277\354\323\241^\367\313\357P\376\336\364\255~\217\364\264\244H\252b1\353\367\215\277=\242\272$\225)\252_\257\332BD\252\033\310,4\252\261^\226\t\356&\346\234\2632\216Y\371\306\346S\277"
+	.ascii	"Xe\232\262r\355\304\363L\206\306.<\237\266\262\371[\271\264\225"
+	.ascii	"oY\331\226\225\373V\256\266\362\007\320\262\2444\300J\323\024"
+	.ascii	"_cR\255\213d\307\211\277\220?\344V!~d\224\311\030\342\344BF\361"
+	.ascii	"\207\247bFY\304\217\fKredF\037\204_$Vm\235\330\021\301\214\376"
+	.ascii	"\366\2010\312\314B\233I\3043\217\307\235\2274\025*\370\345\233"
+	.ascii	"\371\313\314\257\314\017^j\350S$\370LS\032X\002\266mKL9\316\262"
+	.ascii	"+T\026\211\216\341\363r\264\363*f\241C\301\235;\234\374\t\210"
+	.ascii	"\362\267\354\023\271\322}\373?\037[\237\222%\210\020\263\201"
+	.ascii	"A\256\254\322\246\331\316\234\035\243\271\255\354\256PC(\263"
+	.ascii	"\216uw\005\037[6M\323\024\206\365X\333\364\005\037]\220~F\365"
+	.ascii	"\213[\310R\323\222\262\201\374\357$\235\340\230\351&\276\361"
+	.ascii	"\347\023\027\n[k\266-\353\263w\314\266\362\274o\313\020\313Q"
+	.ascii	"\365\272\r\274\255\224u\255\271\"\2111\252_g\342\030\033+l\003"
+	.ascii	"\2736\320\360\312Q\365b\346\f_\302c\363\005\177\3014Mw\224\340"
+	.ascii	"fH\024Z]\301$\277\312\225\277\265\235|\301\237\324\324\255~$"
+	.ascii	"W\022\255\350n\305<\342Fp\345\226S\232\246\r\220/\022\314\301"
+	.ascii	"\347B\270\240\236\236\\\251\001B\311<:A8\r\271\037\f<@7\236\236"
+	.ascii	"\233\007\237\f?7\036\240\240\233\016\016\347>\340\200nB\271\034"
+	.ascii	"\320\r\025\026\275\233\220Q\264\212\332hWk \237?f9O_\220\263"
+	.ascii	"\336\261\235\241} 7\273\276L\3253\271\254w\267\225\263\023\314"
+	.ascii	"\257\276rP\321PX\263\275gr\264w\263\316\351\027\177YD\325\251"
+	.ascii	"Y\003\353\314\331I\251\3407\315L\301B\275\216iK\264\220\232("
+	.ascii	"\200\tbQ\326@\024\247\371T\"\234.\370T&\374\360\237\370\030\312"
+	.ascii	"_\034\004*\256\206[C`P=\231\3530N\036.\005g\261\254h\321\364"
+	.ascii	"\251n\311\314\260mZ\257\037E\0164aQ%f\306\232-,\326\260\336U"
+	.ascii	"\263\373Q\\HX\267}\223\007m\250q \303\224RL!\221\211fD*\315\030"
+	.ascii	"p\002\2312\252\036\021\240\321\013hJ\n\303\236\001M\2763Squ\323"
+	.ascii	"H\230L\371rS:\331\230\223?\302\343\225\017\221L\023\224\323&"
+	.ascii	"a\255\264\203l\b\013z\220:x%@\276\376q:\030h\314*6EB\"~\303\370"
+	.ascii	"\367\027\300*4\271\344\n\226\322\2026\255wCe(\034\003\177A\201"
+	.ascii	"2\030:6\374\002\231\304\016@\235-\004&\026v\346s\360!\321\320"
+	.ascii	"\022\357:\036\321\202.1\216\375\by\343\307\232\253\224\337/\177"
+	.ascii	"\361\302\2064\264\363\321\0318e\2450\304:\211\262\304\006\300"
+	.ascii	"S\233\2473\361\342^&\\{\016)\255\360%\266\333,\335\033\362\033"
+	.ascii	"\243yh\034\006(Zu\016\201\371\340}\t\3643\320R\005{\226\013{"
+	.ascii	"\3323,2I\364\t\343\271\336[X\270\335\224\230?"
+	.text
+	.section	.gnu.lto_isModeActivationConditionConfigured.60.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\355\n"
+	.string	"\266UM> Q\224\016L~\r\232\020\367\031H=\272\033\243\327\356\340F\212\251CEa\314\300:\334\257\004\333%\270M%a\"\331Y\002\022D\006\005\204\236\n16\b8\203\032*\fi\204l)S\n;"
+	.string	"<"
+	.string	"8"
+	.string	"V\300@\343\3561\304\347\"\022\034L\244v#\246\242w\207\232\235\357\035*\215\026 P'>\017\327\216o\003\t\354\356KO\317\307\311|Lv\327\331\371:\334\325m?\260\275\300~\201\325I?t:5}+\263\251\031\rV\354~r\340X\027\225\n\021\26656\304\2160\020d\332\037\275\204\346\244\f\002\"\3131}H\261\033\023\330\300\365\312\361\001\254W\327\001X\257l\007N\365D\203n\240\206rw=U\220\017\374*\301\024\203\2237le\344faU\n\325\276\200!\337\271\276\364\353E\215\0216dlP\317\216^j\310>\334\335\265\202\354\307?\031\005B\006c\321*WF\321\324\231\344R\231\260i\0212\016\313(`\026*P4,\343.\230d\2007K\205\3030\333\306a\220\270\207\253 ?H\247\223\372\235\365\322\035\240F'\024\371wV\252\307\016\016"
+	.ascii	"P\204\366\323\206\327\304\016 4\007\334\202\346BH3\266\20090"
+	.ascii	"\030\030Y\200\n\206\252rH]\337\332R\006"
+	.text
+	.section	.gnu.lto_analyzeModeActivationConditions.61.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`:\004\255\033"
+	.string	"\226q\255H\240\230Q:\300#3\003\026\332#Z\230\353<.gwM\261\2676}\300f\260\036\301\343a:\346\207\331\017\272q{\266 \266\352p\370\252\034\027`<\256\223&\207|\217\351\"5\341+L\035\307\333{\330\b!\233l\231R\224"
+	.string	"\215"
+	.string	"\241"
+	.string	"\247\366\013\033v\272\367\031\346/\235w{\257\247\364\031zIY1\331\252u\310\346\324\r\312\323\327\327\214\2474'0\236\372fg\375\227T\217d\211\320\223\260\326*\233@\\\340\342\357.\367\366WI\216T\234{\363}_\320\263\312\351|\376\022g\f\241\216o\031\312!Z #Tu nK2\303\017\242\242\2238>\nA\005-\005\240\303qQ\200.\206\250\300\351+C\007\264\363\300S X\276\364 *\372\222\031j\255\336\234\216\350\006p\333Glk\260E\007\0016\341\251}\316S\343)\005b\t\271~vh\330\322\334WF\233\377w\237\216\200\244\234\275C\333\347\274RF\301\240\351c\377p;\221\354\037Pb\nz\036\3315\344\232\206\256co\272I\272\036\351\232\322\265H\327s\\/]\337@\214\212\026\013Z\265\326\030\226\251A\372D\351M\177\357k\337O\362\250\026\177r"
+	.ascii	"\\\226\260\205}\246C\3310\277\370\223)\220\313H\255\325\311\206"
+	.ascii	"\375\347\003%L\270\275\311VV\"\244\022$X\266j\375E(\003>\224"
+	.ascii	"\234\266]\274\312\306\300\337r\252\017 nn\306\323\013A\212\304"
+	.ascii	"\031|\016\314\203\317)\316\007\355p;t\2269\003Piu\025=\314\225"
+	.ascii	"\321\2208\221,b\334Y\003r\001Z2\266C\374\212\210\006;\341n\251"
+	.ascii	"V \nVz^J4\202]\226\250\274\312\212\361t7i'\334\361z\217\272\024"
+	.ascii	"\235)\346Q6\214G\351\021\247\\\325Z+@\371\324\b\177\310\251q"
+	.ascii	"f\263\371\250\213fx`\315(\242\344\0069?\357t\332\204\247%t\346"
+	.ascii	"g\207\323\252I\217\307t\222C\372\360b\304\346>\223K9\212?$>\201"
+	.ascii	"\3423\234\r6\036\025;9\245g\020X\344\220\240\355\214\230\325"
+	.ascii	"d\263\022\262\024(pvd\263\032\013\031\004\004\246\251\310\251"
+	.ascii	"\311xh\264\232\f\366\373\371<\342P"
+	.string	"%\3703q\356\021k\355\201\341\275\337\367\001[M;|M$\277\204\2205\223\nY\313x\326\305Zk-\177\333H\316\232y\340\251\r\236\325\222<\367bK\200\265\341F6r1A\347xE\255\030\035\355x\356\342\252\221d\264yl\236)KK\030\252\003\373%\377\323}:\017\214v\354\226h\246\017\325\301\303>\027\233\207zY5\206H\327V\320\fV\250A4\305\214C\310\310\0043\001\315,P\322\001\200\002\031\262\262\016\021P\305tT\213\213\365\f\201\224\n[\366\017\201FD.\225\177J\237\f(7\213\323\256Bvh\310\241.\335\365S\303F3\023]k)\326\322\fT_\376\003S\335\252b\237\302\002\306\322\b\233-\361\200?Kk\245\305{1W\30612M\353J\267\321\202% \317\246.\215(^;\033\026\213m\246\230!\355 \227EP7\272\333\334\023\266\021!\243hNe8\351Z{\021\250"
+	.ascii	"W\255\n%+\201\023\206\rMnK\020\351\237\317H\360_Xb\220\270E\245"
+	.ascii	"\034Z\022&o\255\023\346\216C\252]\025}c:\f\025"
+	.text
+	.section	.gnu.lto_updateMasksForMac.part.0.70.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`\266\001\235\017"
+	.string	"\006\\dF"
+	.string	"\257(\035\320\234\001\370\377zv\206\331$\337\037\375\033M\026\020^l\276\377dP\334\241z\236\202k\265\206\264\365\325\206;\316\026o\377%[\325\217\372\354\206\323\216M(5%\n\213v\266\270l\316\211%\233\310\235RI"
+	.string	"T"
+	.string	"N"
+	.string	"\033\273+1j\273\243\307\247\023t\237\036o\200\373\354^\200\373\264\177\302v\252e\321~\361Q\304\0366\323\020\273\331]\357SC\\\274\312M\364O;"
+	.ascii	"\024\227\352\032\300\325\341\222\3007\216\310\356\272\363p\317"
+	.ascii	"\333\366\330~`K\217\261\373\261\224\237\3424k\304\030\304\223"
+	.ascii	"\372,\354\250D\226U\342U3\245\r\342\021?\013?\"\3700\276j\032"
+	.ascii	"t\227\301\234:\272aW :>aR\026t\237\032Vy\330\313I_N\034\003\366"
+	.ascii	"\004FS \345\307\324]P\034\343rhYJ\373(\336\"\336\005\365\f|\232"
+	.ascii	"\013\025\374\021\237>\212\373\224\372\332;\\0L\264\254\344\f"
+	.ascii	"\251,\326m[]\261\017\373\225\223\226\037\377s\033!.vY3d\254\312"
+	.ascii	"\244!\361\231_\366\307\\\355\373+\256\302\257\315\310\204n\331"
+	.ascii	"2aG5.+$\305\346u\343\240\013 \322\b\311\026\262 2\371FH@\244"
+	.ascii	"\017\247\304\364\201\020\206H\234\3573R\177\037\246\020\b\034"
+	.ascii	"I\370J\3367\301#\211>#\357+\231\274\217\003\006)\204J\236\t\b"
+	.ascii	"\226<y\332;Y\013\233\225bPe\261-@JU\265E%\362(\216\240\222AU"
+	.ascii	"\266Gg\001v\273'\001* \200\002\031\253\354\265\013\374\n\354"
+	.ascii	"\221^\001\374\013'4\023\023y:\302\177\270\266\263\340\260\250"
+	.ascii	"\347\324&tX\nN7\023\031\324\030\302B\351\004p;\203\356l\305\255"
+	.ascii	"\365\3608i\271\243\f\3027\037\221\207\273>V\237\361\315X\"H\344"
+	.ascii	"\203d\357\320\316\202\231\274\324,\250\275 9\305\323\257\305"
+	.ascii	"c"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.part.0.73.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`j\0065'"
+	.string	"zGx\017Dp\236Q:ww\330\333\213XQ(\377\017\006\301\245-\355\211y\2368w0\031\336\037\335\366\210o\335\223\341\3422\343*\243-\356\200\251\003\246\026\246Q\246\240F0\351hX4\246\362\025\354\377\222O\b\2212\311\343"
+	.string	"\327"
+	.string	"\345"
+	.string	"b>\206\352a\266\271\002Y\251\265R\361\036\214\325\356n'\346\305\313\032\b\315_r\251j.UO\0260_i\245\254<\216\313\274\373,\017\023^\213\215%\243z\265\304AV\253\222\301\317M\220\376\\\345\225\320\237\351\221\320\237\273\307\262\273V\307\025\356\352\271\222I\375r\315\350\245\255\326\332\373\331K.<o\247\313\2458\3644\233\207\204{0g\036b\303\363\234v\246\002\2662@\377:\n1\225\266\240h=\3161\b\353\204\230M_G \234\303]8\302C\310\3238G/\263\251\354N_\307.\306\035\355\275)gE51\\?\216\262\026\227\217\237Yl\022qa\231M\265\326\035\327\025\267\251"
+	.ascii	"\311\246\007\021W\321T\202\203d\355h"
+	.string	"\347\034\\F\346\243\017\341.\324Z\367\304!_\242\357\256\332\356\212\330E\r\004\177\032\026\272\022F\3447\356\344\366\320\315Zk\335N\262\273\343\035\300\343e\272\330\277\364\345/ \345\r\200\362*\241\274I;^$\224\367(\345\005\220\362\032\245\274E)/Q\312;\224\362\362R\336]\312\253Kys)o\252\343\305\245\274h\216\367\314\361\232)o\347x\371\312\377N\007t\024!k\335z#T\213\234fQN\246\206\252\213\354g\236f\203f\355\302\3525\344\225\362iw\203KX}\307+\255\367\323\334\375\236\314\321\246n\266?\353m\325A\202\325Z\317\230\221a\326\256\332k\3104\260\266\224\247nF\306\225u\213\206W\032X\233\206\264\314\303\354\313vw\262}\020\301\352c\301=>\210 \374X\260i\250\254[\024\210\220\201\265\325\252|\372\271\026R0\273S\373[l\310,\270N.\237Ogs\301\001t\216]"
+	.string	"}\3247\272\021\321N\026\262\302\244\355\354$k\324\272\266\261\303\311\262\315\361\274\250\215~\347D]\324\350Y\326W\261\211\372R\200\2741\272\021\317D\020\033\231\331\311\035j]\267\236\245\033\\\221\327C\335gYH\246]\363\032\315\223\365e\366\256\217\366\363\013\b\032\243\033\361*\327\272F\001\031QI;\327\313Y~p\235\266\331\306\350&u\265\020i\255u\302~\316\351\210\330\021$\370Z$\320\237\270\216`\307\354\374\236\241\335h;\330rf\251&\206,\362\333\366\271\354\017\034#\335\311\263\315N\261|s\305\202J<N#\260s\2645\361\26477N\234G\201\3764\273\211\016?\310,a\334\335\\\310\350\266\353{\233_Z\353\225\204=\233\033\300\375\023\033\350O\356\227\0055\200*\240:\274"
+	.string	"BA\371Xd\2501\345+\002\322h1\343\207!\005\025\020\n\347\"\350\373\240\002\312\207\373\371`\364\376\032\004\201*\242`\240\370I\365~+zP-|0z?\251`\257\001\323F\305"
+	.ascii	"J\365fDEI\365v7\377T\214W\032\261\213\3337y\tx@\337\354\204\252"
+	.ascii	"\b\324\031\264\302)B*\"\332\006t\321\221.W\302v\235\\VRk\255"
+	.ascii	"\272N\362\024\037Z.\254\2022\365\217,\335\030\340]\341\025!\026"
+	.ascii	"\276\026S'}yK+\3660\347\304\001z\251\005\364{W\250\005\003_k"
+	.ascii	"\233\214=\\\245\016P\240\314m\251\366\305\215Xk\035\246\235\\"
+	.ascii	"\002r\232\030\307\320#\016r\220_\306\370}\256\3249\366A4\251"
+	.ascii	"\245\226w\b0R\337\354|\252\322Z\211\327\332\263}\317\006\016"
+	.ascii	"UUh\007\017|\255\244\256P\004\253\207\273\373\341y@ \261\236"
+	.ascii	"\200\201\250Q(\246\214R\306\241\021\222\021ia\222\306\200\002"
+	.ascii	"\221\252\262:\021\260A\253\232\202\322d\332\f6\324S\n\203I\270"
+	.ascii	"\005\367\264\376\362Y\237\024\b\007\r@K\255\242\004\220\2155"
+	.ascii	"3\355\222\331\037\t\3332\026\"#\001\020z\342\177\312$\233\215"
+	.ascii	"L\374\006A\360\324\357\322B\021\213\317E\364\354\246\332\200"
+	.ascii	"j\332\323X\230/\t\344\212\2556Vz!\017i#\302\251O\026\243/\021"
+	.ascii	"\027\271\261/\337\347B:\226\002\244s\356\257\262\336\021\362"
+	.ascii	"\247\t\316c!\360xd\275\320PC\227\353(f!\225\233\035\346\2228"
+	.ascii	"\030\026\360\252\345j\277;\314rt\250Vp\016\272\312\274Q\242\342"
+	.ascii	"\332aZ\226Y\346/\227h\205\275\333P\326\320\353s\366D\372\026"
+	.ascii	"M\r5\216F)\035\302\n\337\304m[&\362\253\023v9\013r\232\216\326"
+	.ascii	"\"3\\s\020\202\357H\263Rn\247(\306\335k,$ \252\270\3716\362\250"
+	.ascii	"\252\343\201(\306\3404"
+	.text
+	.section	.gnu.lto_.symbol_nodes.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`\346\002\275\020"
+	.string	"V\031bF \315\246\003T\026Y!d\032;\242\024\2176\340\236\212\267Faa0\fjd\213\304\222\023\335\263\211O\300x\002\202\364\005"
+	.string	"\f"
+	.string	"J\276\324\r\202`4\376{\030e\221\355\332\222\345\007\346\004\235\304~R\362$\231RN"
+	.string	"V"
+	.string	"K"
+	.string	"(\321\203C\272\355\350\340\320\220\033\036\322\255\306\206\311\346\007\346\275)\343O\242[\001\236,\360\314!z,\026\213uo\3021\030}I\304x\222\006S\241\f\311\314\361\263\032D?\302\331\357\00330?s\007\231\006`\255\265\333\363\206\310\314\336\023\3542=\263N\236qL~A[k\231G%\3179MB\032\371\220\234\022)!"
+	.ascii	"\221\314\020^P0\016\\BB$\363\nj\205\005\325\002\323\362\322\300"
+	.ascii	"\345A\211\033T\035\020\221\003V9#J\257 \202|\202:\303\023\363"
+	.ascii	"\361*\335M\b\037\003\237\022\275\020\347\004\351\003\231(\313"
+	.ascii	"\034t\251S\260&u\212\333)\f\352\001n\223(\210\240\321\250W\013"
+	.ascii	"\275\275\"\360\360tz\233A\264|.h\323i\250M\237\267\031\326\302"
+	.ascii	"P#\232\336a\267\315\017\314\3036\375\324\276M\367\332O\032\273"
+	.ascii	"\312\263N\312s\013\345\003L\301\356\022$*\310t!\367\270Pg\341"
+	.ascii	" WW\304\270t\270\n\327\356\250:\001\326\254~q/,\276\356\232\017"
+	.ascii	"\257\233Y}\366tOX\231\240\311\252\317\260\375\265\243\232\331"
+	.ascii	"\2527\250Ug9y\\\365\371u\334QIX\321\314\373j\001= \220\002\231"
+	.ascii	"*\253\007f\"0\217QU\273\317\307\263\213\030y_\215\340\035\315"
+	.ascii	"c\004E\200\374\321(\315m\311-gbO\351\204\204\207?\016\302@P%"
+	.ascii	"\217\247\207qM\006\211A\372'\250K\372\t\342\022\027\020c-\335"
+	.ascii	"\2310\030\366\205\2403`u\222\204aD\366\345\266\221\254G\003\331"
+	.ascii	":v8![\207\360\343\316\031\2020Jy\334\030\3220.\020\200,a>^\333"
+	.ascii	"\264\344h\0016\207v\363m-\346\177$4\220\263\277u#\017\204\023"
+	.text
+	.section	.gnu.lto_.refs.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375 \317m\004"
+	.string	"rK\037#\240%I\007\377\377\377\377\377\377 \352\370\347\377yc\374\3266k\233\265\255\021Bdk\226\264F\b\221;\005\003\260\\\020A\005\033&\316Kr+\353f\353\023v#\355V\355T~\332\315u\f\362\241|\2614\240\205\033}\324?\375\353\n\032\201\367A{\203~A\237\240|\200\275\300z&\375\322W\372\254\337\276\352\037\345)\031i\223,\334\001\2127\212\037\351\343l\244\321\235\373\310\273?!\004"
+	.ascii	"\243\022\341g~kM\212\022\224/"
+	.text
+	.section	.gnu.lto_.decls.df9baf8877e97e16,"e",@progbits
+	.string	"(\265/\375`4'-\256"
+	.ascii	":\024\241<Z0JQ9\351\332\003\341\305\241\265\315%\261\203!\016"
+	.ascii	"\013g\223G\220c\274\350%\243\235\344)\236\216.h\355\275S\034"
+	.ascii	"\2645ox\034d\\\253\376\331\377\243\266\237\271a0\254\353\243"
+	.ascii	"A\253\332&mQ\243\200\nR\221\0069*\024\217\002\251\372{\214Ig"
+	.ascii	"\036j)\221\374\275\245L\0013\003\265\003\317\003\274\341\264"
+	.ascii	"\200\201Nn3tv\323\263\314j\"\3266\003\003\235\035vH\314r\364"
+	.ascii	"h+WoS\313\255\255\013i\332[E C\326x\360I\237\230v\264\2324\030"
+	.ascii	"\342\242\262T\211\343\320\303\005NFT\3337\r4gz-M\222\256\266"
+	.ascii	"f8\3453\f\007\306\301\031\026\303ez\220\351]Bp\264\341\342\212"
+	.ascii	"\\\210\0363P\204\220Y\373N\242\3472d\272yo\004g\034\024\327\223"
+	.ascii	" ~\313A\246\027,\347"
+	.string	"\013\032\251\260:th\350<\006\350T2\323\353\303\\m\272\322\346\302\200\371\355`!\253\255[:\206a\214\025-\"k\3509P\343,=\310\237\213\244\202r\345\345\205\257\210u\3416f\343/\374\002\247\354\205\265\234\267\360\332mz\357\0307\341\302Y\236P\221\301\335\233\016\261\027v\302Pj\227\022\025\243\032\203c1\366\302dl\245\246W(\214c\024\270{o\210\020\034B\204\bq~\335h#\333\261\3474\224/o8\177x\t\372\305Xr\2326\276\214X\350y\bz\306\341\002\207\235'/3Om\317N\350\007\030\215SNc*\347(<vN\357M\357\275\037Q\205\317z\212?\367\330\266\344\352\336\364\034\374C\377\006#8\215\245\360YM\257\356\261\315L\250\250\346I\021\271{S\016!B\340|%\221Qw\332\367\320\233\200\362\024.\343\324\003\233}\203\021\257E\257\273uo\352\303\363&\353M\233\266g"
+	.string	"z\366pr\035{8\177"
+	.string	"\364 \240?\274\341l\006:\203x\303\311a\355f\313\013,\264\275\b\364\311-@\277\306\033N\336\342\257\232\\j\336\260{\323\f8_W\264\214my\t3\341\224\277\330\353\326\253y\301\356My\252\361)\313\224\266\037x\303i\031\350<s\275\207\355\216\340\240\323\207\203\316\247\274\341D\031\350\334\362\363\332\317\002\230`\215Y\003\006\3607\024Q\005\300"
+	.string	"]\202\277\323\376\336u\005\273\277\2514\210\013\332\3035\374\r\205\307\3637\027\320\337JXLG\3606\0024\004\347\362\367\006/\f`\235\237Q\310Ac6\255\241\201^\200\277\245~.\241}\276\341o\032?k\320=U\232\347?\333\227;\371\357u\b\376\266"
+	.string	"\332\377*\034\376O\340\363\367\361\366\357\341\317Vz'\347o\245\237\223?\303\370\371\305\317M?\037\377\237\177\245"
+	.string	"\254u\032\303\377\237\277\036\177\326\372\231\311\317K~V\3623\222\237\263~\336\3729\355\234\237\233?\037\371\031\353\177\317_\245\376F\177\236\373y\314\317\\~\276\3623\332\317e?K\371\331\311\317`?w\375\354\364\263\n?\377~.\372\231\367\363\005~\266\300\317\025\370y\002?\247\360s\004~~\300\317\f\370\271\001?g\3603\211\237E\370\271"
+	.ascii	"?\217\370y\350?\n?{\370\231\177\356\377k\376\273\375<\301\317"
+	.ascii	"\022\374\307\362s\004\377\315~\326\360?\356g\240\237\001\360"
+	.ascii	"s\206\237w\376\237\3603\206\237\355\317\365?\233\377r\377\325"
+	.ascii	"\374O\363\377\314\1770\377\277\376\207\360_\355\177\206\272\272"
+	.ascii	"\272\272\377\374\340?C\370\003p\025\255\204\223\264eb\340p|\240"
+	.ascii	"\307\200;-\355h$\214\220\304\r\356*/\006\307a\236q\332g\215\226"
+	.ascii	"\223\264j\336\340\230\331T&\003\255\253\364R\357\240^\020b\245"
+	.ascii	"\255\206N-\232\262\264\313Z)(\275\305\b\200y2\"g\273\220\235"
+	.ascii	"\254\2450\363V/MOF\222Xij\301\321\266\245\340\260\031\031\"6"
+	.ascii	"\245IGi\322bN\234\264\330\327\030 ntX\332\266\330\024\0231om"
+	.ascii	";\314^MQ\212j\333O\202P\271\222e\261\320\333\031_\234\366W\037"
+	.ascii	"\203\2327\306\007$M6\245\334\275L\fx\216\234\325\230b\243DIw"
+	.ascii	"\221\020\205\203\305\215\013Q\351\273\253\207\314\2145\314\266"
+	.ascii	"\315\305g\347\326\220.H\230\3708\3353]\230,\261\302\272j\272"
+	.ascii	"\220\363\206\016\307\213-\246\202CuC\315\025\203\344H:\213\257"
+	.ascii	"\362^\246\001\276\234\340x\230t!\363\221\344\235\365u\003\252"
+	.ascii	"\255jA\213\024i,*\245\372\324&\315\231\2217V3}\216XA\3108\013"
+	.ascii	"O\2227/5\332\276\216\241:z\210\216f\341\274\227\323\246\223\362"
+	.ascii	"2\225A\177_\275Y8\227\266\260\025i\333D\332j\347\344\tH\220\036"
+	.ascii	"88\274\232Mrt\363=\365\251\026\202\026\357-\246\327\211\277\240"
+	.ascii	"0\231A'\220\240\201\t\362\026r2;w\002\fLZ8a\265\355\252\266\262"
+	.ascii	"D\230U\240\254\200\330xrD\314-\345\221\346\"\306\017\326\302"
+	.ascii	"\31252\274\264m\037g\223\035dum\233\252{\324-#4\260z4\017\213"
+	.ascii	"#\215-H\334\331\306\007\025d\333\367\016\206\373\177\225\\U\264"
+	.ascii	"\332>M3w\224bP\301\321\366U\013}\325\201\276\377\363\032\225"
+	.ascii	"\367\336\0308\351U\036w\316\237\3178\314A?\017W\256\340\326\217"
+	.ascii	"X\273\027\253\031\207\026\231b\274\361\017\367I\356-f\270\351"
+	.ascii	"U&\301\246\212\311&l\313\f\351\325\021\301\005\333q\223\351\324"
+	.ascii	"\3226o\337\364\362EN-3\220L\233\312d\332,\376\\d\263xo\272\374"
+	.ascii	"I\206\031\213\234\004\233Z&\301\232\313\f\027y\213\027\314\250"
+	.ascii	"\003E6\227I,\315\345O\022\314\270L\"\247\226\031\2144\205\324"
+	.ascii	"\2001e\334\302]I\344mb\2122*\177\326\222i\363\272\335\313a-\256"
+	.ascii	"\262\202{\243\232J7#\024\227\035\327\232\216c\306&w`:R5/r-i\244"
+	.ascii	"y\257\221#\212\313\324A1]\273?x\255\270#\352.\265\270W\002\246"
+	.ascii	"{\213|\327\356\275\305{\357N\031\225\336k\343'y\305\304t/\223"
+	.ascii	"\003\323\215*\232\265\270\267\303\302\224-\223`T\315!3'`W\327"
+	.ascii	"EZ\344\253\3536\245D\301\212]w\351\336\313h\320\253\245\2143"
+	.ascii	"my\253Kq.*\212\323\2200\302\025-pW\251\304\340\335\305F\3326"
+	.ascii	"8\215M\3572\204,OF\344\256\222\211AO\024\221\037^Xh3\273\241"
+	.ascii	"\272\306\233\331O;\310f\332{\215\314 z\230A\340\240\t"
+	.string	"1~\021I\267v\234\234\254\232m\323\036!M?\244d\260\227~\033\"d)F/\223i\006F\022\031\363j\333N\255|/\273\351\366\262\203\346\275\306^\372\270\271\327\350\303\f\202\031\204\325\242\"\"v\3327\020\246^\202A\367\345\253\255\033\207\363\213\\\0220\030JV\344\224\230i\373V\372;\331/\370\f\003T:\216xi\313\032\030\350\354\026Co\027:Q\324\350\210\264\005j\026O\220}\344\264\231E\327\366M\307o\332\310\315{\221\314\202\f\323\\[\256\353\313i\207.\342\030\323\233\236\251:.\247\320\016\334\313\035N\256\253\343\016g7\003\314\027\344|T0Z\250\332\216m+\334\253\231?'\347\f\007\217)\2632_n\\\215\241\327i\322\326V\307\350\330\311)\257\264\020\363:f\315\326\026\215\2665\314\337\336E\271\364\246m\365R\301,\267\264\231\322\266~\251/pz\265\352\366\2363\027P\324\230\240\367"
+	.ascii	"_\355\254]\376v1\033dF\235\026\264h\251\\\316'\\\264\264\310"
+	.ascii	"\241PE\262^\264\345\264r\251kc>P"
+	.ascii	"\347\246n\3311>I\341\322\366:M\350u\\`\301R\321\306d\301\355"
+	.ascii	"\310\314\351h\223\226V\257\360Oz\fC\004.mk\306\214j\345\365\n"
+	.ascii	"O\226Y\020\261\266\325\205\227\261j~ \303\224A\177V\317*\032"
+	.ascii	"{\025\217\234\005U6\310)1]\345\025m\247\264\304j\331\266R\371"
+	.ascii	"\033\027$H\204\004]\311\211\232c\223\262Z\326h\\eYC\264\252L"
+	.ascii	"\205\275J\t\253]\247\022\003W\212\22678\fW3\236\332\264\255c"
+	.ascii	"\225\254F\021\203\202\341:q\302c\210\235\001\346I\371\345\353"
+	.ascii	"\257_\025\214\204\237{\251\304\312FT\371\222l\333\264S\306\214"
+	.ascii	"\205R\254._\2438\255\313\332\305\241+-\372\314\311"
+	.string	"E\320\244$\3316\335\031_\370be\tz\336\312Qu\214\231\022\003\007\244\0069\262\205\2526\267\302d\325!\365\b\2571\177.R\212\034\334\330?T\263\352\017>\3435f\bZnJ*WeR\267j\222\252U\227pZ\263\252\220W\251\212\343\034\330\253f\325\035\265\212\327\252\016\260\005\306'N\311\023\250\037\233\343o\023\034\223$0!\003wo\212U\221pZ\217\234Czo\330\221J\244\032\3415fzc\350\220\231\261j!D\207\020<g\272\270\3358\215\024\351\031K}\240i[[`B\251\261\220\272\342\264\262\200\246Ib\326\346o:i@\250l\240\317\231\201>\307\205\025\352\005N*\247\210\036\245C\217\252A+\217\332\203\323\013\252\217\266\242\203\362\365\206\236/8k]\035_p\036uC\217\256\241G\325t\324&\330\2258-\265y\326\226e\351\230\206v\020\003\235\265F\275\321m\264\312zD\261\361"
+	.string	" [\242\264\265\225\331jD\256\230\240:\215\333\020(]OQ\352\342j\264\2554\320\026(\224\0130HI\311q\243\355+\215\277\311\324\031\033\250\243[\323\366n\274\341\2541\206^e\350h\371"
+	.ascii	"\034W\333\035\324\n=gq\277\275\3354]\277U\247\356J\213\034\230"
+	.ascii	"\213\302\200gK\\U\213\266M)\262L\t\213\"m\217\316@a\324\027u"
+	.ascii	"\251*qZ\231\252\2137]\277A\262p\353\272d\230\241\026\025\211"
+	.ascii	"l\333ru\357\255\2672\325bE\366\024\323+\343\374\002\023b\007"
+	.ascii	"\207R\330\022\203=\212D\277{C\277\313\202~G\206\276\"?\226\223"
+	.ascii	"c\306\r\266\266\3258\364z<\337\260\201\021\326\326g"
+	.string	"\267\004\375\300@\247\006\ft\332\233\312\365\\\267\371sr\250,\265Ea\241o6UlB\370hg\253y\257\371sv[J$\224+\364\035\327i\350\260Py\321\366\273*\364\215\306\003btd\265\3553h\213]\215\013r\302x\275Y\265}\237\371\033\256\315\364\262\227n0\313\264=\034o8{\030\350l2C\3572M$LM\255-\317\031'FLK\031\023\0323EJ\225/_\032\214\217\254\035\223\037ha\334\336`,\2339:\256\266\375B\217\f5o\202\264\025\2069\250\030VW\\\270t\027\364\311\013\f\3159\027Um\357.;7Y\\N\232\355\214\261eKc\345\214y2\222$gF\223\234\324\231,Y\032\213\204\313c\212O\013]\274\256\332\036\307LM-\314\226\025+\001\276#\023=b\212\022\024p\360\tS$\331$$\"\340OH\034\n\371\212R\034\021\001\177B\302a\n!\b\216\216R"
+	.string	"\201A\340N\003A!\nb\020\270;\321\363\035Y\242o\210\344C:\211\274S\030\244\200\320P\350[\341',\222\200\310\033\246\340C\372\021\321aPH\364C:\205G$\210\276\005\034\205\210\036\361gB\b\030DB\n\022y \372N \376L\350T\300\033\202X\221\024$\3013\372\235\b"
+	.string	"\361(D\030%\t\031%\021\001S(\200\350\033\352"
+	.string	"O4\316\220\267C\344\001\215\222p\200FI\025\005\321\b\350;:\211<\017\206|\033\370\r\355p\350\023\026\025\365v+\222\202DVHL\252\347Y!$\016\177F>\023<\020;\030\362 \030\332\300\207\324\003\3628\340\t}\303\024<\025A\023>E>\240\321\357\250\267+\362\rSX\"\337p\367\036\261WD\344\031%\211\3501\372\235\340\371\210\275\243$$\037\nD\337\320g\202Q\222\005\303\r\2548\352\001{\024\024\371\204)\214~'\200A\022\002\360\255\020D\362\t=P@\004\372\206>a\004\206\277\017\016\320@\004\246\b\222@\362\021\207+N\340\r-X\321\023\nE \352\225\350\365\f\213|\304\236\206\016'|8\n\021*\204B*\204@=bo\004\"\341\351\033\376xR\330I\200\004J@\201\204\b\274\004\214"
+	.string	"\201\022<\022&\360N(!C\006\rD\020\205\275$\021D\275\022\302\240\002\206*\f{%|\304^QR\n\016'\372\t}@\237\021\372\016<\310\300\203\017T\354\376\001\b\032\200\240\301\371\017@\030\032\002\301\203!\364\036\f\325\"\337\221\211\336\3607\202\320\267B\002\206+T \372\021\207\021\234H\205a\257D\t\"\241\206\243`\020\001<\034a\017\005\221%\362<\030\"\002\177;\342\220\247\302\260\207D\374!@E\320\304\016\221\267\001\007\350\220\3703a\211A\024\212|*"
+	.string	"\177G\350\220\367+\002\006I"
+	.string	"\203?bo\205\037\221H\204\016>^Q\t*\202&vE%\234*|E\300\022H\250H\321\363!\036E\207\007\223|B!b0(\024\322)\002\372vC\236\tG> \260\207\202\250\207\310\373\200\b\374\245\330%\371\210'\020\205=\3420\307g\004\354\tq|<\035\242\237Q\320\0019\037\032\"\361!\205\007,"
+	.ascii	"%\0221\364\025\005\221xDB!\242\023B\300_\017I\210H8\024\022\301"
+	.ascii	"aG\345\342\266#\013\006U\222m\207qH[\r\252\322\346\230\020*'"
+	.ascii	"(mm\263m\016\253\343\266y\f\312\2524\265\315\212\305\2472\b\037"
+	.ascii	"#\231\030-g\215\032V*\247x\257\230\2502\033\267R6J\252\211V\031"
+	.ascii	"\033eo\360p\r1S\253mY\252\302\244\230u\f\017\034T\023\t\325B"
+	.ascii	"F\274\305iQ\271RJ\002Ecn\215\253\356G[\273\264K+\203\225\312"
+	.ascii	"\"\032\001\034]`\316\b\372m\214[\031m\205a\311u\246\n\032\r3"
+	.ascii	"%Y\332~\007\211\376V)\266s\204\316\251\314\251Y8\235\324\310"
+	.ascii	"\265hBC\2754\r)\303t\345\254;K\336%\260\234\251\257\037i,\214"
+	.ascii	"\352T\245\344\003jJ\215\246Sg\025\367\325\326\315\355uc\223\225"
+	.ascii	"\355\347\036\357\275\342\353\342\3111\t\227\025\346H\025{\274"
+	.ascii	"M\336\272\330`\304\321x\314\355\252\252\255m\361\272\346\007"
+	.ascii	"\032'I\026u\r\013c\306\336\264\265\310\f\244\346t\270ik\215/"
+	.ascii	"\263s\305L\356F[[|\031\236\261\256\252\250\272W3L\320Z\264\265"
+	.ascii	"\255o\270G\323\032\033\235\231 O@\352\320\353\310\221y=C\246"
+	.ascii	"\316\325/;\267\350u\235vS\254p\305\220\273If\220N\027\214..i"
+	.ascii	"^\347^\331l0\342oI\216|1\266\255r\257k\230Y\316\340\324\3245"
+	.ascii	"Ex\200!\261\202>\003\324\353i\031\367\267\033y[2\323\266\242"
+	.ascii	"9\332N\203.\250\222\3318\307\302\214!D$\"2\222$I\0072\n\020\204"
+	.ascii	"By\"\b\256;\022\240\005=L*\246\220\314\210\210H\222$\331\030"
+	.ascii	"\003\334\235)\357\330\313\207\217y\226)\fT|\202\237\344(\353"
+	.ascii	"y@c\214_\361\255\242\022\346\300\342\035\324\255\3045\271\320"
+	.ascii	"\b8\211-v\022Pb\245f\213B82\227\260jM\nQ\217\341\223"
+	.ascii	"\217\305\210\036\267)@\3753<\201\212\220\212\246'\3559\331\237"
+	.ascii	"\373\270\203\233\352\274e\254e\312FA\273\320\350\356\0019\350"
+	.ascii	"(.TA\220p\314\300\363?!4l\003\177brf\037`D\320\275\030\004\024"
+	.ascii	"kil\2153\240cz\353\033G\374\245\344\303\037\224At\276+\227C3"
+	.ascii	"\346K\361\206\252\313*m!\303\245f?\033v\273/\032\"{`\214\023"
+	.ascii	"\300l<T\314&\242j\200)J\005\001\244\022\330100\021\307\241Y\327"
+	.ascii	"H:js\340\347\207B\305\247\362\323\222\275\227'\361Svx|\252\021"
+	.ascii	"\205\034:\321\233\036\\\305 Hfl\203\202&\244\357\201\216\273"
+	.ascii	"\263\027d\031\032W\372\227\320\f\372\220u \321\376\374\302l\323"
+	.ascii	"m\314\316\273\327J\013tH\007\333\221\022\355\306\217T\2556qH"
+	.ascii	"\001hW\250\033\340&=\257\233\301\206>\335\016\013U\016{\362\n"
+	.ascii	"\260\307](08\\$\344\347\245\242\377\025\263\026[A\241\345\204"
+	.ascii	"\234*t\254V\306\334\373T\224\223\227h\257K\273\221\023I\3562"
+	.ascii	"\rN\237<\270\2026E\324\006\263m\200\252g\355\324Q\345\232S\347"
+	.ascii	"\034\"\202\264\214}\304Qd\231\341\356\024\226W\236\263\2243\264"
+	.ascii	"\2042X\270\355a\025x\3270\364@\3769\324\370lO<\307\241\271 \235"
+	.ascii	"\303\221\377zgd\037\\\310R\304t3\316\361\025)\272-\323c\301E"
+	.ascii	" \335\240\234eS[\036\006\022r1\257\206NQ\362\362D\314\345\310"
+	.ascii	"E\367_ej\237 \r<\265\347\354th\006\2419Hc\025rLr\345\324\025"
+	.ascii	"\2001)@\333\343\f\305A\0072\303\232@w\362\355Y\341\321\350\320"
+	.ascii	"9\006\365\253\233\276.\330\\+!\252z\b\347\361\270\231\367\334"
+	.ascii	"c\365\315\026\233P\361N'c\214\273:\245r=G.w&\272\357\n\313J>"
+	.ascii	"F\246\373\337\220\265g\217\322\263\222\230%\240\f\235\311\353"
+	.ascii	"Lh~\267\273\274\217\2425A\242\rE\250\356\235\030\246FCjp\342"
+	.ascii	"\242\305\027\363\326D\007\031\374\307\2278\201\213<\301\246\003"
+	.ascii	".\327\f\311~\377\n\274\001S\350\221\036b\357\355\243W\026\036"
+	.ascii	">\351\300\006K\276\335I\261{\005%\352\260\032\340\322\325\343"
+	.ascii	"\005\020/)\302+\205\024\027\024:\316\257\300c\306E\303'\031\b"
+	.ascii	"\350\036md\013d%\275\363\005\231\035\340\263\305\326\203\364"
+	.ascii	"gP\206\307\237\222OT\262X)*AwG\354[\371\023\257\033x\0049v\272"
+	.ascii	"\333\317\023\276\3000\227\366\177\205\006o\235\311\315\321\001"
+	.ascii	"w\333\322\027\005b\262\303\243\225]#1\330r@\2662\177\341\200"
+	.ascii	"\224\264KSJ!S\365\304lr~\244\030\r\253\312\272b\242\203\304("
+	.ascii	"\241\25224\347\254\0076\232\206\365n\261d\372\026\210h\034P\013"
+	.ascii	"HQ\032\213\020z\364\355\320\006\311\267\322\267?\017#\337H\217"
+	.ascii	"\343/(D\215\377\026)\020\034\0311\322\360\370>rF\324\327\361"
+	.ascii	"\221i\335hKHW\211\225\241h\214?+d\251\340\346\274\217\274\216"
+	.ascii	"<\200\034`5\273a\232\300\366\304=\262\363X\212.M\261\220\310"
+	.ascii	"\236\265\017\273="
+	.string	"loe\315\234\244\255|\303h\307\322\256\317\227*\304U\r\233-\216\001\243\337\b-\320s\231\273]\377\013\311\357\327\025\314\030\344\251\206\263\357Fe2\274\213\001dVz\004\2227\2448S\235\264\036\222\235/]\005\272:\322\024\202\270\222-\253\032\362x\221\035\222\243\210\330\271\344\304\226\002=-\t\0233v\354m\232-\310\0376ai\311\366\231\\\355\021\322\246$Q\017\341[\2400 {\006\346\206\210\205;\335\311\001\215\266\315\003r\201\023\342\336\201o\315S\f\243a.a\252,\322\312\030\263\234\306\346\022(\007\025\335\305~\310\340\224\314L\372\246\244\360Q\032M \264\245M\020\307\262\305q\230!'\361\023\207\031s\221\242\262\323\004E\223C\200\311\240\306\267\n\320\006\0023l\240q\030\373\242\245kEs)\263\3007$\244\207\223a\034w\206\304\302\264\0131\016%\340\f\267\307\301rK\234\250\327xCI\330"
+	.string	""
+	.ascii	"\223\365C\r|dv\033\"+;D\313\223\204f\314\tc\314\t\0256\204\200"
+	.ascii	"Y1\351!\271\\\031\035%'8\336j\315\357\016\003-\243\346\343\316"
+	.ascii	"\372\202\331\304\220\325\324\rM\360\002Z\244\262Nn\213\346+\236"
+	.ascii	"E*\327\b\310\003V\342\312\330\3413\b\233\250\343\300\350\214"
+	.ascii	"\360F\316%\326\254\301\226\270\204<\b\034\003L\004d\260\f\240"
+	.ascii	"y\326\2534\317\311'a#\001\372\365\313\231\007\022\"\017\211r"
+	.ascii	"\3315s\206g\006\3124N\377\266\314\214`\361\374\304\345\350\320"
+	.ascii	"h\353VG6\311f%X\312\240\315\364\274\303\273L\315k\221\002\235"
+	.ascii	"\004\036\217Eq\261\272\032\307\264\361]l0\201\325-,\251\t\032"
+	.ascii	"\330\274d\355\032\372\034\325\377\b\370\337\367\370\t\251S\324"
+	.ascii	"]\341\320\373\372\320\333Z9V\311\017f\351\003e`\254W\210\204"
+	.ascii	"\367Jl"
+	.string	"\313\222\333.\257\324+\354\023\274}\211^\377\314)\360\367\330\025\355W\322\034\251\341\200\322\373\260\006\302\177\216E\2649\024'(>\036yU\013\204\013\210\270(M2\271\334\237C\377\206!\323\323\272Y\276\207\322\314\315\036\372\272\325\331\223_Y\233\034\027\320\025\257\221]\220\\\004W\033\373\022\242Yv\214X\237\226\204o\313\214\361\227\344\275\243\234\277x\233\256\211\371=\304\261w\354\376{x6\363V\226\275\250\221\205\276\031\371\335p\355hx\317\361\211\273Pd\363\257\273\256\352\205\346D\374\027\276d\035<?\007{\276#\324\027\206\270b\372\2234f\364\327K\317Z\377\310\363\323\306\230\374?\270@\337\247\211\036\335\367\326\315P\247\355\204(\277\227\313\331\273=\276\255\350\364\224\307\335\345\245v\367\221c\340\235&\306\361\303\323\325\357\333gGP|\216\2712\006\rk\246U\227\266\362\257\316L\221[\245\32080-\355\026"
+	.ascii	"\272l\n\r\034w\250\236\215\264\372\244\350o\005"
+	.text
+	.section	.gnu.lto_.symtab.df9baf8877e97e16,"e",@progbits
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"rcModeUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"updateMasksForMac"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"updateMasksForStickyModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"isModeActivationConditionConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"pgResetTemplate_modeActivationConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"modeActivationConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"modeActivationConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"modeActivationConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"modeActivationConditions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"bitArrayXor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.df9baf8877e97e16,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,576 @@
+	.file	"runtime_config.c"
+	.section	.gnu.lto_.profile.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375 \300\315\003"
+	.string	"\024\005\264"
+	.string	"\020"
+	.string	"\354\270\344\363\013\004\002"
+	.string	"\001\352\263\360\321\b\002\267\204\341\306\016\003\342\201\222\246\004\002\004\354\206\342\366\006\005\243\276\342\320\003\006\002\001\006\007\320\253\336\204\013\b\220\352\317\274\f\002\t\n\013\f\002\002\002\r\213\226\365\231\004\016\017\352\263\360\321\b"
+	.string	"\020"
+	.ascii	"X\005\246!\037\344\240C><\207\036\362\216j\206[7\317U\200\357"
+	.ascii	"\315\355q\3512\32428u\312\r\264\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375 L}\001"
+	.string	"\320@"
+	.string	"\n"
+	.string	"\001\001\002\003"
+	.string	"\003\004"
+	.string	"\003\005\003"
+	.string	"\001\007\b\n\001\013\f"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"*\2033/\003C\260\020\201y\215\312\340\22706\200\005"
+	.text
+	.section	.gnu.lto_.inline.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\305\004"
+	.string	"\022F\023\034\240'\351\377\211\254\3702\325\322u\357\267\370\004\376\377\377\315\254%\344,ido\271S#r\f@pG!\201\b\\\336\376\323u\250\2033\020\016\2133IU8\026\311\207\247\366\376\253m\333*\367\277W5\325e\337V\025\231i\274\331\216\036"
+	.ascii	"(\026)\3409\234%3GIA\261\344\200\320\270\302B\035\b\200\006i"
+	.ascii	"caV\271*\00566\242\277\b\026`\206\003x\340\330Q&@;`\016\030s"
+	.ascii	"\001-\260\201\225QR\326u\212&<\305\2779\203KP\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375 f\365\001"
+	.string	"\204\002Z"
+	.string	"\n"
+	.string	"\001\001\003\177\002\003\002\003"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\005\004\002\002\001,"
+	.string	"\001\300\004\001"
+	.string	""
+	.string	"\007\b\005\n\005\013\f"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"*\203\201:\004-\313\371ng\375f3*\370l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\002\230\004\003\204\004\004\204\004\005\230\004\007"
+	.ascii	"\230\004\b\204\004\n\230\004\013\230\004\f\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375 \364\255\002"
+	.string	"t\002\350"
+	.string	"\n"
+	.string	"\001\002\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\005\001\002\006\001"
+	.string	"\007\b\001\300\001\002\005\001"
+	.string	"\013\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023"
+	.string	"@\026=\027\266\354\250\331@z\003K\305\335\305"
+	.ascii	"*\030=\027la\2663\207b\345\247d\002\362\355\271`\013\263\235"
+	.ascii	"9`\333\006\332"
+	.text
+	.section	.gnu.lto_.lto.dd92acd90d1a00eb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_armingDisableFlagNames.14.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375`5\003m\026"
+	.string	"\326)\232K\240\230q\306\nk\313\203\023\311\255\354\263\013<v$\027\343\361\220W\3415`\r\337\207/\206\311B\216\317\013\310X\313\316O\326\340\350a8\220\220\352~w\254\375T\262\027\036/\020|\355pw\205w\330\035\300\307\330'35\"I\006\211"
+	.string	"\207"
+	.string	"\207"
+	.string	"1$\300\233v\302\270\236D>\006P5\304aG\344\343"
+	.string	"C\2068m\210|,"
+	.ascii	"\3100\207\005\221\217\007\370\030\346|\310\307\004v\004uX\341"
+	.ascii	"\270~C>.@5\324A\032\327?\345c\0037\232v\330\245|LC\243i\247\245"
+	.ascii	"\220\217eRL<\254\232\217\017\274`\342\331\371\030\001\013\245"
+	.ascii	"\036vi\\o\3718A\n\246\236\326\302\270:\310\307\n.s\035\337\237"
+	.ascii	"h\362]a\211\310rrZ\337\341\370\302\270\212\371\370^vo\fMg\362"
+	.ascii	"&w\362'\217r)\247\202\363*\307\372\225c\271\226oy\227{\371\227"
+	.ascii	"\203\021\235D\fb\206\033QC\003\t1TN\034\236\036\\\021*\210\201"
+	.ascii	"\350A|\nf\021*\037\213a\202r\253\216\353\263\362qL\026\260\206"
+	.ascii	"\305\222\217[\\\230j\332[\345c\234E\310\3467\256\257\312\307"
+	.ascii	"\256\313\\V\2006m>\226\271\n\316\330\251<\0058\223\312\307/("
+	.ascii	"M\264G\345c\230U\220\326\232\310\3073K\206n\330\242q}\211|\034"
+	.ascii	"\267]o\303\256\rB\271\325\364<k\345\216]\034O\327jjz\346P[\354"
+	.ascii	"\232\232TIR\253'o\346\236\351\271{\352>\323s\027\273\277Y\021"
+	.ascii	"\220\310H\370S\207\202\300$#\245#\332\217\210f\004\024\n\322"
+	.ascii	"~GH\264\331\202+\2540tDK\022\n\217h37G\246:\037\272\333\032v"
+	.ascii	"\037u\024W\361\025oq\027\207\361\030\227\361\031\257q\033\237"
+	.ascii	":\216\347\270\216\363x\217\377x\373 \027r\"/r#?\362$W\022\367"
+	.ascii	"\334@\270\223's\313\233FM\235\276\275.\212\236\346\317\226\271"
+	.ascii	"?\333\246k\256[\3364j\352\364\355\347\254\305.\220\366i\236\317"
+	.ascii	"\036o\016\325\233t\335\322L\323s\347\322\327-M\034O\273nI\352"
+	.ascii	"\215K\317\263\006\273\273\255\313\335;y\257k\323\247\211oMgj"
+	.ascii	"\322uu&\331\272\350\216l\335\024\255\265n\017\335\265n\031\001"
+	.ascii	"\310\324[\367^\027\355\341Z\327\207\252\245\017\211\226\033v"
+	.ascii	"w\231\232\2722 0C\"vs\206u\r\244\324\224\231\314\247\231P\214"
+	.ascii	"\376L\214\357\"y\004\245\244`\314\\+\023\247\341\013\306\213"
+	.ascii	"k\311#\242)\312\004\330h\231\3443\023\371\310\244\321\2310\032"
+	.ascii	"2qF;\0339\327\312\304\345sy\200\220\203L\272\266^\221\t\342\326"
+	.ascii	"\223I\333\332y\334F\313\244\231weB\220\257\355F"
+	.text
+	.section	.gnu.lto_setArmingDisabled.16.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\315\b"
+	.string	"\326\320=90\345(\035"
+	.string	"\276s#i\260\232!\303\023?\203\262\340\202\006jG\252\220\327\2029|k\330gP\303\f\306\377\372g\037\016\006$P\241<\246\270\026\313\360'\246\t\331R\246\024+"
+	.string	"."
+	.string	","
+	.string	"\037\310\216\271\263[\376m\354G\"R\255\227\335\215\252\361\356\331\371\0079\306S\231\236\001\013\273\353\364T\023\267\3366\202m\005\333,\001g\375P\323\231\351g\231\205J\301\312\256\304+\300\2720\224\216\214\355\247}\217\177tg\225\214\331\305H1\331\375\022\254\0218vp\202\354\030\fJ\242-\317\005\3525\365)\n\324C.R\3629<\"\345\275c>);v\315\234\224"
+	.string	"\2508\345\313\376L\251\031\366\341\356\256ue\007\236\215C\007Z\323x>\235\320\2465p@\037Qh\304E\255\023C\237\r(j\034D\324\030x{\340pQ\264m\\\314|{\270\2722\303\205\353\244(g\f"
+	.ascii	"2\241\335/0.\020\0047)&R\031bQ\366\025L\271\004K\254\246\200"
+	.ascii	"\273\274h'\031"
+	.text
+	.section	.gnu.lto_unsetArmingDisabled.17.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\375\b"
+	.string	"\226\321>7@\217\322\001P@\342\330l\362!u\353<\240\f\206##g\255\245\006\363\352\244\376\217\350\346,`0\354_\0379Y\006d\222g\370L\177\215\t\223\247\354\023B\244L),"
+	.string	"/"
+	.string	"."
+	.string	"\317\260\007h\317\374\331)\017-\366 *Tkew\243V\374{~\376;\216\001S\245\347%aw\235`\n\342\326\3336\260\215`\233%\366Y?\226i\325tf\372\027-\343d@d\367\341\325\262\256\214\004#c\373i\177\343\034\337Y$cv'LFv\303\003o"
+	.string	"\317\n.\240\005-P%\365\252z\224\352t\217\177\220\374\013\213Fy\360\231?\322\236\245n(*L\257gE\224\240$L\371\262\303R*\205}lw\327\272\n\035\r\003\0073\267u<\034P\307-l>\236\020H\344E\216\023A\036\315'r\236C\334\b\3345l\274\030\352:/f\302=\266\272\262\202\206\313\244'\253\206h\r"
+	.ascii	"2\241\375/0.\020\0047)&P\031:*\033cZ\020`\326%,b5\032\334\345"
+	.ascii	"E;\311"
+	.text
+	.section	.gnu.lto_isArmingDisabled.18.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375 \375\355\006"
+	.string	"r\31504`m\322\001\300\016\200\234|\031\246\203\323\3609\306\237%\375\334B!\n\335\032:v\240v5\256\n\360\355\346 \210\212uQ\0234tF/<\266\204\020)S\n~\025\006\353r\301\247`\301X\231K\023\335\273\270\313Z\300\270\027\035\\E\300\260\301\022]\006\302\350*m\257#\325\001\217~\354\027PW\325\203D>\357\270\207\306\317\360\303&\237}\3627\324\247+@\204'7[\353\244Z\330\227vw\255#\333i\315\364%\n\204$\240d7\264\235\354\310\024\242a\233cW>@\340\030\273\206\021z\305\004\350\303dWszq\354\211\371\347\270\264!\261e\242\316\223\222\260\273\316L\004q\353m\023\3306\260M\021\b"
+	.ascii	"2\001O8c\216#D\250@\346\032\275\204\310\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_getArmingDisableFlags.19.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375 \370\325\006"
+	.string	"\"\r03pM\322\001\240\253(\354E\004b\260\344!\363\275\020s\300\233\310Y\252m\ri;\303-\342\223"
+	.string	"\365o\270\377\377W\346,\263\177\213\210\300\261\335{K\231R\226.\013S\206\252\244\004\214f\332P\016\026\2242\220\232\0244P\262\032\340\245\300\025\003\306\202\233\252\262`\024\367\nJ\265|\024\302~\310\343\345o\370\201\223\307\356|\316\273K\r\240\370d\310\216\236\324\013\373m\025d;\235\372JP\bLv%B+{\342H8lw\354\310\367\370G\307W\213\031Y$\242\0211\242\262\033\241\345\003\357\256]\340\335)\306\257\347\345\037\344\255\303\"\005\313<O"
+	.string	"\204\335ub\331\304\255\267m`\373\300vE\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_enableFlightMode.20.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375`\034\001]\r"
+	.string	"\366\330ZC\020s\223\016\033"
+	.string	"\213$\\\341\322K\005\213\334\0035v\376\222\243\260\314A`\347\b\0075\365(!\335\250\241\365\343\340',\262B\271~V\001!"
+	.string	"\004 \bD\031_\204\200\376Z&\bk\023D\366\2262\245G"
+	.string	"E"
+	.string	"D"
+	.ascii	"\331\241\340`y-\233\313\217\335\016\033\360\002\326c\236\200"
+	.ascii	"\365\250'\256\035jj\376\275\303\025\"lp\250\322"
+	.string	"\341\312\025nn\2546\001\250\023\034I\215\220\271\367\304\2002e\2064\330]'\207\352p\307\333v`\233\201\375\f\001\216\232NM\037@\310\207\230\003;v7|@v\025k\250\270\352\267I\276g\021_\245]\013sm\236\213\036\273\035\202G/\2702\355\2778\f\322\273\013\326\354\226\300\001\263\333)0\347z\334@\333~\313[\220\254\005$\276\027U\0265\240\301\204\307\343\2243N}9\347#\3525\365\333\212)?[z\205\020\342\333\202\334\34524?\205QR\362\334\243\237b=F\325\230\0342 T\362\263\273R*\213}\270\232\262\346\335o]\365&\235\007\022L2\213\302\250\003\202\366p&|JB\231'\002\t\350s\022B\021a\236\022,\364\351\2000\217h\204qF\234U \021a'Y&\302D\272=\\Mit\243\242&\323\320\250\306\320\301\002^\231\340\266\205Q\236s\200\031\036V'-}&\030"
+	.ascii	"2\241')p\206\303 \270bp\2451\3626*\341\016\027\270-\2061\n,Q"
+	.ascii	"\025\017_YcQ\355\271\220\307\315\260\266\260\2024\2735\241XN"
+	.ascii	"\235\203v\001)\201V\3354\245PP"
+	.text
+	.section	.gnu.lto_disableFlightMode.21.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375`C\001\035\016"
+	.string	"\266Z_D"
+	.string	"s\224\016\363\3376-D%\300\310?p\330\030#a\017\033\255\241\313\262\006\352JBY\335\273\265f\255!\307\004\004\032:[\251\005B\335\356_\332U\257\204\022\302K(\264\325\322\b/h'\226\220-eJ\001L"
+	.string	"G"
+	.string	"H"
+	.string	"G\361\024#w\t\256d\300\302\030^\213\216]p\023\360\020\354W~"
+	.string	"\366KC\274{\324\354\374\207\217&<\270|(\322\343\206k4\300z\221#"
+	.ascii	"\352\024C"
+	.string	"RF|\017\237\027P\246\314\f\203\335u~(\r\367u\333\rl/\260_\"\326\034\3743W\335\230\246U\323\251\351\203d^b\b\300\330Mi\371X\230\353\205\304U\277=\362Ck\276\252\313v\225y\241\f\326.x\340\227\025d\231\366U\234et\320\202\001\354~\230\261\332\005\023x\223\375\022\211\266\035\232\302\320#\244qJ\036\306\364\252\251S\265\305\277\033\245l\251\352\275\224)[\276\246\336\343\220\321\353\203\0166\274\037o9\213\316\027\341\023\224\374\367\313G\301~a\25215v\244J\331\262AR*\b\373qU\305\326\264\346\f%\034\007\021J8l\202\210\363\211\356l$xH@\\\007\302\310\307c\002:\tm\035\222\r\344\341|\266NH\264m\n\230\2430\022\332L8.\264i\340>\256\252hT\244\244&\273\320\250\256\300q\"f\211\340v\005Q\3763\210\013\013\314II_\341\301Zi\207i\001\032"
+	.ascii	"2\241u)\260\206\303 \270vp\2253\3626J\002\034X\314\226\312v\276"
+	.ascii	"\267\326R\n\021,\006\004\303t0 \225I\026\325\210\013#\346\315"
+	.ascii	"6\322\354\326\204b9u\016\332\005\244\004Zu\323\224BA\001"
+	.text
+	.section	.gnu.lto_sensors.22.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\255\b"
+	.string	"v\021>6P\215\322\001$i\233\307\205\234\274\323"
+	.string	"\na@\345%\3767\233\365\036\372\232\375\372z\352\337\"\224\215\037\377413\233m\242\270^\255c2\226\325\370\311\336R\246\024/"
+	.string	"."
+	.string	"+"
+	.string	"\001\331\241\021L>\275\253h=\342d\345\241\262\333E\245\370\351y\362\277\361\227\362\200\302r\241\236\226\204\335u\262\\\016\267\336v\201\355\003\333#\001\232NM?\263\210\224\f\230\354\266b+K\002A0l\233l\214\355L\373\031\3270\035V\362e\027\342\342c\2673\260\006\3400s\201\354\360=\253\020U\306\374\364\232\372\325Ku\216w\224|\013\217Hy\326\241O\312\016\257\227W*cv\207J\235\260\377vw\255\022\206\207\375/\f\241\315\347Y\323,x:\240MS\340|<\"\320\210\213Z'\202<\233O\324\270P\324\020xk\340pQ\264m\\\304t{C\315\244Te\277\224\245B}\t"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313(E\215\007t\004\274\b1"
+	.ascii	"L\327$\003"
+	.text
+	.section	.gnu.lto_sensorsSet.23.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\305\b"
+	.string	"\306\220=9@\305(\035\340\363M"
+	.string	"\367\223\034\024{\300\r\023\006\211\275\224\333%\005\330T~R\377G\374\351Y8e#\220nd:\303\306\323<&\314\330s\261\357S_7\262\367\226)\005*"
+	.string	"-"
+	.string	"+"
+	.string	"\002\327\245;\033\345\337\305\036\204e\022a\355\356\204\026\357\256\235\177\217_\274\323\350jA\330]\253w\212\270\341m\027\330>\260}\022\177T\265\252\372\227E\305$3\262\013\321\002\260+Y\222\201\261}\265\317\361\216\356)\221/\273\024\033$\273\237\201\261\200K\202\017\\\227\361\001\367R\"<Tx\223D\351\252\177\210|\f?\204\364\336\245\037\272.\017\245*\200\306\004I[\3667RXa?\356\356\032\242\354\247\002\f\037M':\303\0264\216g\313\0246\035\r\344q\340f\306\231\036M\323\231\031\367\231X\306[\303\206\233\240m\343&\346\333\307\205('\254\254H\260d\205!\001\f"
+	.ascii	"2\241\333/0.\020\004\027)\036R\031bQ\366\025L\271\004K\254\246"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_sensorsClear.24.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\005\t"
+	.string	"v\021?8@\305(\035\340s\227\220\310KI\214\0219fL\362\035\244\333\321/\b\031\357'\365\177\304\237\236\205S6\234\370\223\t3\2606\306w\274\340\302\302\266\273\224\277f\311\2262\245,"
+	.string	"/"
+	.string	"-"
+	.string	"\031\374\200\345\231;;\345\337\306~$@\252\004\266\273Q5\336=;\377 \307x*\323\363\242\260\273NOUq\353m\037\330N\260\r\013w\3750\323\232\351\314\364/\002\024(\232\225\335\211\030\200}e'\036\031\333O\373\255\177tw\225\214\331\305h\231\354~\b\336\004<38\201\345\001*\251W\325\247V\250\207\\\244\344wX\202\224\367\236\371$\313\263\324\002\216\025\324+\303E,eq\312\230\375\231R3\354\303\335]+\313\016\017\"\016\bZ\3338|<\241Mk\350\200>\243P\004\0275O\f}8\240\250q\242\270\321x\203\350pq\264m\\\314|{\270\312\362\202\352uR\224UI\356\005\r"
+	.string	"2\241\371/0.\020\004\027)\036\300\320P\331"
+	.string	"\323\202"
+	.ascii	"\263.a\021\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_sensorsMask.25.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375 \370\315\006"
+	.string	"b\21503`m\322\001@\203@\324\204\025\304\242\230\226\375g\304\211\241'\347\254\020\315\242\336\005X\352\247\003\340[\376\242\250,X4A\303\224}\026\370\022\367\336R\246\024\226*\f\323\205\252$\005\013f\312P\017\026\224.\220\232\0260P\262\034`\245\300U\203\305\202\231\252\262`\024\367\352I\245t4\302>\310\343\345k\030B\223\307\356|\315\273K\r\250\350d\310\216\234T\f\373mw\327\352\261\235N\025\270 9\020\331\235\b\235\354\210\013\331\260\275\261#\277\343\036\033_-~\262\007\302$@&\273\021RN\360\356\332\007\336\235f\374z^\376?\3368>%X\306y\002$\354\256\023\313(n\275m\003\333\b\266-\002\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"\345\004"
+	.string	"b\307\033%\2209\035\333\374\356\267\345T\373\026\320U\274\211\220\344.633;\b|j\"\"\264\324D\244Y\203\374[\312\024\016<\304\0066\2218\245\341\003\021cd\020\247mw\355Cv\335\200\326R1J=:\275 \235\020\375r\216B\267\362y\365\022N\243\315)\346\323r)\007\217\262\331\370V"
+	.string	"\251\355T\254\303\276\035Y `wW\271K\333\210\b\021"
+	.ascii	",\033\332\262.\303\345\007Fce\3270\203\003\264\003\237\203\357"
+	.ascii	"J\22696\320\031\350h\030A\003z\200o\354\374\210\b\255\312"
+	.text
+	.section	.gnu.lto_.refs.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375 a\365\001"
+	.string	"\342\304\013\020\260%\351\f\3030\245\266\265\335\310&{\313\224\002z\t\330\251]9L\251\205y\031l\221\212!\016\322\241\235\0242\262\363n7\345}\235\032\b\004"
+	.ascii	")A\2119\233\022\327\273\346\030"
+	.text
+	.section	.gnu.lto_.decls.dd92acd90d1a00eb,"e",@progbits
+	.string	"(\265/\375`\355\016\335I"
+	.string	"\352\201\004\034TP\020\346\244\003\375\316A.\303.\357\003\264\271\256\313U\244w\007\232\216 g\302\331\257\002\250\345q\205\251\367\t\315\355:D\232[U\243"
+	.ascii	"\006\254\232\\\005\035\2120\307\261\013 \372d\241\240:\003-e"
+	.ascii	"\373\017F\212\025\216\276\204Sn\277\375\367>\231\374\266R\246"
+	.ascii	"p\001\247\001\267\001\3350\305c\332\355d\203V))u7\225P\352\243"
+	.ascii	"\260\314\250\233\227U\310\214\250R\n\331+\003SV\265\n\251p\253"
+	.ascii	"\332-\252x*\205]\235\324"
+	.string	"\335{\345\2542\342\260\302u\227\354\330\246+\226\354[\2669\374e\230v\312?\350\302\222\\m6\307\344\020\316\357\nsWW\267+L\235U\022CLkb\250\\\201a\311\365\035\234a\213\204\247\324\344\310\024\256\227\340\f\333#'\033\027\036h\\\257\300\371/\230\316\f\027*DX_+N\242Y\222-V\356\326&wh\022\262\227\335\351\315K\322I\326\220\353\026Y\256M7\371o\327z\275z![\331\235\316\354\206:\322\306\270\242\330\034\263.\216\371\337\310GDu\003\347\363\253c\326\254\216\371ts\314sqL^\272\271\227\177\265\254\006>\304E\371\327D\006\213\301\177\004b\376\345\241\255\376;\026%\314+Mk/\370\277\342\277\227\371\257\220\177y\377Z\360\357\214\177'\370W\202\177!\370\367\201\177y\376u\340\337\027\377\366\376m\361\357\002\377*\360o\002\377\"\360\357\001\377\242\370\327\200\3778?\017\360\257"
+	.string	"\377\006\360/"
+	.ascii	"\377\316\374\373\377t\377\347\376k\371\217\345\177\334\177\270"
+	.ascii	"\377o\377\333\376K\371\237v\366?\207\377J\376#\371\177\344\377"
+	.ascii	"\327\177\345\377\344\377\022\377\321\376\363\352\352\352\352"
+	.ascii	"~\376\277V~\231\267f\246\017>\354\033\203%\265\342L'Ut8R\345"
+	.ascii	"\373\266fL\305dL-\311[\024\322\232\023\025*\3336\242\n&I\222"
+	.ascii	"*\356T\"\203\020FmK\030\270\036\2408\341z&B\201\262R4H{i\245"
+	.ascii	"`@:r\031\335S\331\345\276Rv-F\310\020\251$\256\273\306\033e\331"
+	.ascii	"\276k\253\306#\246\273V\273\207\273)hvS\2740\251a\2304\353w\210"
+	.ascii	"\363\013\304\231\226\266g\333\024A\262)\216\206+\345*jr~\233"
+	.ascii	"\354\242}\323E\333\345\026\3171\251\025\342\272\230\262\370\202"
+	.ascii	"\235\337]\232_\035\226\311w\207tw\330\263\333t7Q\367S\024\025"
+	.ascii	"kmGr[\272\251IG\004\233\227\234\222\353\236\375/\0328\034\257"
+	.ascii	"{\253\273\t\330\272(_O\270^n\227\274!QEW\270~\321\363\377\232"
+	.ascii	"=,v7\323K\332E\"\236\271/\273:\377\314\356VE\357^\323\245{i\013"
+	.ascii	"\3139dl\370\002\327\377(\032\253[x\323i\027Qe\224\020\375Z3\336"
+	.ascii	"\244\rE\242\225S\215\246Q\306\212l\356\264\267\211Q\306\023\320"
+	.ascii	"\024YDS\244\320\246\211Hawj\264A\227C\341\242\312(#\252D\032"
+	.ascii	"o\232\330\302V\016\241N\"\322\210>A\032mP\345\320\210\022\243"
+	.ascii	"\2147,lI\271\241W\326\216+\004%6\013J\307a\321F\rM\221\355\326"
+	.ascii	"\275K\243.\252\350>\"\213n\303\035KF\244\306\002\221\222!r\323"
+	.ascii	"\3566\241D$\205l\242\032z\205\354\276\"\252\321J0\204\251Z\317"
+	.ascii	"\260j\302\251c'\031u\013\240\324-\334V\353na\007=t\024u\271\300"
+	.ascii	"\365\334\343\347)\3461s\264\232R\333\034\223\027\325;K\275\270"
+	.ascii	"\200\006\365\203\253\fC!e\212\212O\212\270\236\221??q\f|$\202"
+	.ascii	"Y\027\004K\022\327\223m\216)bqL>\366\3160\310\020s \001\3025"
+	.ascii	"fqLn\342&vZ\257$OY\266t7\351\324@\265\031\027v\341\354t\270\027"
+	.ascii	"\255\034\322\035\314\364\"\225\345\207\261\244\016\035\314\364"
+	.ascii	"]\367S\221\252\235\017'\264\246\033\3163\323r\216\224s0S\t\b"
+	.ascii	"\254\270\342h\316\312\310\202\240\341\3742\223\311K\\\334\364"
+	.ascii	"\004\033g\206\300a\2109\256\337M\235\337\023\346\326\355\t\363"
+	.ascii	"\213\303\362pS\036\262\222\006i\013e(ib1#l\"<\270\236\225~&b"
+	.ascii	"\"'\361\220\335\304\356&!\023f|j\343$F\252\321\312\321\203\206"
+	.ascii	"t\253l\216H\013\\\031\345\025\316G\254\302N\350\305G0\220\335"
+	.ascii	"C>\252\351\322=\254\331M\261\233\242fI\005Ab\326\357b8\271\250"
+	.ascii	"w6\3021\213Mi\327\304\214iA\231\342jbq\314\231\336\034s\311v"
+	.ascii	"h]\0357\330\327\321\214\216\265 V\334b\273*7\250\005\351BG\267"
+	.ascii	"s\247M\023\261\321U\355\016nI\245 N.\\v\356LnA:V\036\206?,\t"
+	.ascii	"\361\235\253lF\250\270I9\277r\273Z\264\254XM\333\350A\030\322"
+	.ascii	"q\0133\0213"
+	.string	"\255XY,o\346\216)=\030\355\225/\226\031\271/5.1\263\207\245.B\210\305\305\355[\357\330\232 \035\261d\214\222\226ZZ\347\367\207]\270o\272pk\306)\n#HG\254.\236\2618yd\021\031\373q~7\257\321bG\350G\002h\202\317WA\220\320/\350sch\306\220\317\004\237o\004\0222A\237 PD\260\207\007f\310\247\306O\005\372n\370p\020@\t@\237\rd\206||6f\360\202\276\017D|@\203\0068$\004\f\362\001ah\334\324\004\371l\200rl\b\tU\320\363\002\374\331\004\241\2003\342\006\\\310\004\337\320NPHhhG\206\006\005A\037\360\346?\277!_\220\017\350<\214\030\013\304\340I\001\346<2\\\310pa\236GF\257'#F\357|\214\336.\330\023\243\027\354y\301@0\350\207\302ICh\203`\r\240\237\r\022n|=@ \037\033\030\370l\214\340\003\374Y"
+	.string	"\024\364\2731\344\003\300{\275\031(@\340 \203\363\247\005\320\217\204 \241\237\036\337\215_0\b\205\241\235\037\022v\202~>7v~\206\200;-\n\b[\2613\fN\ri\311N4[\234LY\341\210\231\271\243h.\t\330.\177kdL_\312*'%\r\007\327\263\362g.NNYb\305\007W\236\3151\331\206\336\331\213\213\364@\251\272\322\036\243\020N\2274t5 A\341\312\\\275\263\221\002\304\230\224q\205)\262\325\006\366$\214\353y\353\347+\326Z\222\366\325\203\253NW\357\234U\247\262,Y\341\200%WEJ\005\256g\254\237m\340\033Pb\324\025W\027\233c\232W\2753\221\235\233\261\254\005\256/C\330\252\013\315\202\204\353\331\352\347#\013\341Q\265\200\003\n\327/\265z\347\252\032\26619 A\2008A\3618\342z\006\242\214Y\342\203*\216+\323\320;\327"
+	.string	"\301\217\251,\256\273\037T\274\256%\034W\\\317T?G\361\f/\222f\220\201\353\3176\307\344\247\336\331\207\211\205\316e\311\020\201\034\250a$\207\0245H\311\310\210\210$I\222\016Q\005\204 (\245\264\r\021"
+	.ascii	")\244J\212$H\242\024\3669)x\340D\243\325\2205Z\362\004\312\216"
+	.ascii	"U\263Em\017H\331'hc\"\243\371D\322z\034\354\350]9r\007\354\216"
+	.ascii	"\301\355\200Q\362\323\207-O\361Ij\234\244F&oR< \217\352\250\372"
+	.ascii	"\210\304\207\342\204\243\340;X\n[\250\357\265\373\b\254\374\030"
+	.ascii	"\034;\232oa~\336G\236(\276P\301x\364\037<!Db\306(\334\t\021\262"
+	.ascii	"\344\334p\221\253\261\0202\b \207\332-\277\251\262\276\360rW"
+	.ascii	"\363\233\227\361\365\002\n\205\223\251\215\276N\217\242S.s7\334"
+	.ascii	"]\321\264d|WA=\237"
+	.ascii	"}\0233\0225\346\"\002Z~\262N\220"
+	.string	"\345\313s|8\177\351\013M\330\rS\260\303\305szRQ\212\354!\207}% \007\324\364\274r\027[\220qq\206G\030\326`\201\243{N\367\223\347u\016\247\363\232\211\364\366X\204@\016\177S\205\2606=Ln\004/\250\372\312|\310@bX\204\363s\016?|r\237\b\325}\323a-\306/\202^\333w\255\345\322\013P6\210t1z\337.\354jY`\nd\234/\230\032$\234+\002\033\007T\317\346\327\357vu2_\235DT,\206E\343;x:\r\256\217\004y\241\257K\346@\355\3009\230{\323F\016c)\303\362Q\361)\202\347\022N?<\275GN\266\205Yo\241\200`\342-f\216\235\202B\276\320\202W(\220\232\302S`U\372{oZ\216I@:\201\217\312\321Q\003\267l\276\022z/\331\315\037\212\233?L&'\357)\f8\272P\002G]\032\276\031\375\2549\263\r\377<\016\275\004N"
+	.ascii	"\360Q?\276.\271O\241\016f\032\376\356\321\013=\205\003l\356K"
+	.ascii	"f\220\331\024\206O\024?\306\324\204\323\023\366\005\354\023\340"
+	.ascii	">\273$i\2121ztk\251\217\t\270m\033|\270zl\222\231\326\237\246"
+	.ascii	"\373k\\\004\276h^P}\210\355+\235 ?]\002\017n\273\t\361\221\361"
+	.ascii	"\363\306\f\355n\357o\237\255\214\356*\227\350\375\001"
+	.text
+	.section	.gnu.lto_.symtab.dd92acd90d1a00eb,"e",@progbits
+	.string	"setArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347"
+	.string	""
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"sensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dd92acd90d1a00eb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
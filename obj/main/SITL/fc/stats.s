@@ -0,0 +1,521 @@
+	.file	"stats.c"
+	.section	.gnu.lto_.profile.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375 \224U\003"
+	.string	"D\005\210"
+	.string	"\n"
+	.string	"\330\331\340\372\016\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\272\264\263\242\004\002\002\001\002\001\004\316\305\253\235\003"
+	.string	"\005\200\202\255\250\b\006\262\374\202\245\005"
+	.string	"\007\362\354\276\360\017\006\002\b\240\342\234\212\n\n\013\366\222\265\231\t\030\002\001\002\003\003\003\002"
+	.string	"\002"
+	.string	""
+	.string	"\b"
+	.string	"z\b\222#"
+	.ascii	"\364\255\330@T\372\224f\022D\b\003,"
+	.text
+	.section	.gnu.lto_.ipa_sra.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375 6m\001"
+	.string	"\004\002*"
+	.string	"\006"
+	.string	""
+	.string	"\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001\004"
+	.string	"\001"
+	.string	"\001\006\007\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"?C@\211\265\013z\003X"
+	.text
+	.section	.gnu.lto_.inline.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"e\004"
+	.string	"\302E\025\"\220)\351y`\212|4\036Cq\245\020-\363\345\353\235\204\020\314\314HL\006\322\372\310\220\315\311\226;\005\377c\033\253<N\202\020a( \203\361\005}\001;\2745\020\342\276i*t\341x\234t\277"
+	.string	"\205\375\357e\372\214ef^\277\f\225L\036\024\374\273\004\001\026"
+	.string	"\240\314\025\203\365\314\001=\006na\b8"
+	.string	"\005\236\250\013\274X\261\f\310\212\212\326\364Z\024\232T\205\001\300\265\225]`\371\322"
+	.ascii	",NY>\213h\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375 je\002"
+	.string	"\242D\016\027\260%\351\254\210%g\315aD\264j\3010\314Z\304\252\355&\233\224)\377\023\377@\216Yk\223cv\200\bX\241\255\020\267\301\326\304\240\337\205\361\327\352Z\273;\210\234.\002\006"
+	.string	"S\020"
+	.ascii	"\243\342\365\274\023\305\002\260m\003m"
+	.text
+	.section	.gnu.lto_.pureconst.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\230\004\002\230\004\004\230\004\006\230\004\007\230\004\013"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375 \227\225\002"
+	.string	"\004\003\213"
+	.string	"\006"
+	.string	"\001\002\b\001"
+	.string	""
+	.string	""
+	.string	"\002\001\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\007\001\002\t\001"
+	.string	""
+	.string	"\002\002\n"
+	.string	"\001\002\n\001"
+	.string	""
+	.string	"\013\002\013\001"
+	.string	"\002\002\013"
+	.string	""
+	.string	"\r"
+	.string	"5\013\210:\006\r\005\370\211\304\253\213kV\332\305\250\031\214\245f\260\360\331\255\0010\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.a753bd1277386c57,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statsInit.21.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375 \312\225\005"
+	.string	"\362I&1pi\323\030H\361`\020\254\260\025P\350\226N#R\213\213\034\305\"D\030\363a\"\262\216qc\335\377\177\353K\264b\336\354\306\337\264}kVn\231\002O\221uI\227\025'K\314\\$L\234*+F\320\224\246R\305\213\242\252\370x\233\3329\016\237\200j+|\200"
+	.string	"\230\333\220\206O\323\354\275\f\352\301\347b\265{}H@\021\273\005\025\024\3739\f\t\177>c\017\021\031p<\020,L\354nT\204\304\022bg*dc\343\262\204\f\312\356\0167\316 \327\374%\377\344\337\004\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_writeStats.22.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\235\n"
+	.string	"fTJ@ m\225\016\320\332]\251\004`B\263\364\002x\353O`\200\340\013\246*a\313\"\321\"/\337\337\3208b\200\372\027\372\254{"
+	.string	"\300"
+	.string	"Bi\201#\235n\277\231\034\032n\375\030\273\"\177\223-eJ\0018"
+	.string	"7"
+	.string	"7"
+	.string	"\007(X\243\013#v7\323\006\337\01657\377\251Op\335\347\020Sp\205\034\253\f\"*:\021\244\220 pO=\021t\241\314\210\307\356:\271.\301}\335\366\207\355\r\373\223\316t<\352\317L?\242\245\021\006\214\r\273\244\257\304v\2704D\220\330~\332\237\360\323v\224\201[\354\2328\250v\275\016k`\277\354\235\022\177a\237\304_\336l\020\031\001\352J\214\372\3241\017\026>\210\262\345\277\022\257Q\235\243R\350\024^\201\200\377\300\005<y\356\227\357\211\277\256I\"\304\202S\t\224\237\355}R\031\330\327\357\373>\253\311\001\232\220\214\006\215\261h\235KG\3130\232,"
+	.string	"\310\005@\206\341h\231\345\302\033\001\031N\326\331l8\231\304\333\303U\223\241\204e\255@\032\202\273\273\020K{\200\226\347\254\372\271\203\326J\025\017"
+	.ascii	"3\2413h\214\254\202\203+\200j\037\244\260\210\013\300\204\253"
+	.ascii	"Q\341\031L\271\004\333\254\246\214;\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_writeStatsEntry.23.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375 c\375\002"
+	.string	"D\0053"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006}(\212\001\202\200\200\374\342\203\316Q{y"
+	.string	"?\202\210\200 wu\276\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/fc/stats.c"
+	.string	"\003"
+	.ascii	" D\312E\003(\002"
+	.text
+	.section	.gnu.lto_statsOnArm.24.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"\325\007"
+	.string	"\202\31635`m\322\001"
+	.string	"w\005\205q\206\"\031\267\365\265\270\003S\317\252\337\256\235&W5K<\026\264\004\376\267\031\323Hi\020bp1D\345\274w\\\315i\204\020)S\n\266.X\206\311\260g%<\205\ff\363\254\013{\027\001\303\005\204\353e\020^\317\302\355\247U\320\301H\327Q\217S=4\031\370H\3627\316\241\331@\250\024\310\be\342\352g\\\203\301\2670\306\241|Nu*E\221\324\311\222\247\264\033\034\362\361\032\3600\352<\272\331\334\226Ja\177\332\335\265\202\354\247\363\351W*\021\222\201\217\335\210R\312vT\310\205\355[\254\331&\347B\373\216\020\204\350dw\237V\\{j\3761\016\020?\333\263b\260\273\316\370\221\270\365\266\tl\027\330.\t\020"
+	.ascii	"3\241\315\037xg\356\3544\f\f\177\325\243\250-`!pv\324\302D\255"
+	.ascii	"*\317\365\350\202\313\313\020\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_statsOnDisarm.25.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375`_\003\225\026"
+	.string	"F(\215J\300\224Q:t\216U\201\034\020\007l+\253J\200\331\376\023Q\030\226\210\334\n\377\f\311\261\231l\027\003\242\t\355\350\337\246\365'\254\366\363\376\f\243;\r\002\216\"\222\375\227\3322\3453\251\376\356\323\215(n\274\354\023\2627\2212\311u"
+	.string	"l"
+	.string	"}"
+	.string	"\345y\357\321^4\033s8\2142|*\236j-\r|\356\200\361\323\345+\3643<"
+	.ascii	"\372y\325\322v\203\274\334\325\373\206v^@\325Z\311\036q\332E"
+	.ascii	":\303f\332\376DO\341r9\027\307\017\247\254\362\306\323\303CV"
+	.ascii	"NC\350RkU\345t\270\303\002OGH^\236{r;\341\212\317\020\356D\347"
+	.ascii	"\r9\033\263\030Sk]\306\345:|\307\357n\335]\002\273-"
+	.string	"\024\023|N:\034\265\2736w\361\032k\3259\260oq_\206\275\320\347\306n\370\270\317\375\r\375\344\206\341\001\376\360z5\016\356\2266\356\240\335\207\265\201v_\364U\tyS\232\027\245yY\315{\322\274\253\346U5\257I\363\246\232wl^\261yi\363\316\346\r\233\267\231\227Y\022T\250!,\301Z}\202J*p\"\225x\321w\317b\0379p\230\364\1777z\251\266QC\245\307N5=\022\341J\2631i\354\377@\364\304F\232\2754\035\035G\344\237Q\332b\323%\267\237\225p\243\331Xk\235A;\225[J\262I\274\024\273\320\310\247\205\347\207\357'6\275Eg\2534+\335V\3308\270aw\317\376\315\204\3550\036\243\265\027Z\027\rM\277\370\320\255x\267\306\002\037\327\375\362\017q+\002\264u\316wQO4\272\203\366E\271\0032\n\274.\230\230\254%\213\221\256\n\344\205\232\226\r\351\202\305H\230"
+	.ascii	"\373\302@\003#e\257\027\214T\225\2657\220\202\023\300Z\333D\026"
+	.ascii	"\336]\300\200\217\333\023=\006\001P\b\n\212CS\032\346srJi\001"
+	.ascii	"=\273\037\236\256\306\301\331A\307\241{\036\357\201\323@F\206"
+	.ascii	"~\212\"t@\031Ai\246\035\2546i\024\246\317\350I\263\272\005\310"
+	.ascii	"\252U}\002t\260\352\224\256\266\364\337\354\301\314\f\375T\365"
+	.ascii	"\225H\350j\020\036E\250A@\306\024cfLHA\031)H\016\300\002\021"
+	.ascii	"1\353\006\021P=clj\nm\007\263\340\235}\313\265,\025\3364r\311"
+	.ascii	"\307\272\244\256\256cq\336\260\210\264K\004XC^s\207\307W(\251"
+	.ascii	"K\356\013m\311\210O\220\344.JO.If\022\206\355\326\2706\325s\270"
+	.ascii	"~\f\354\301\231Yx\371\372'\036\217\273f\313,\007\201@\026\310"
+	.ascii	"\351U<\263lO\217\200Y\316\223\200\017\252'\212C\376\263\374\346"
+	.ascii	"$\303Z\224U\016\013\301)\260\320d\032\324\306s\235{Jvv\006\233"
+	.ascii	"\251\032"
+	.text
+	.section	.gnu.lto_writeStats.part.0.35.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\345\f"
+	.string	"\366WVB\020s\223\016\030 \321CPQ ep\300L\335E\033\233\013\302\013p\366\351\206\217F\242\307\327t\267\206vL\006Z8\363/\302\020\332\210"
+	.string	""
+	.string	"\200\002\200\002\354\317\263\301\220H\035\333xb\367\336R\246\024D"
+	.string	"?"
+	.string	"E"
+	.ascii	"/\t8\004(u\230\001dw\251C=\361\354\360i"
+	.string	"\306\314?\351!\332\3469\004\260\211\370Km\013q}\016\272\034?4[\350\211\244\244\320Nz~\330@\231\006\0363\021v\327\223\312\235\271m\t\266\033\330\277\002g\271}\027\035\237d\215\355\263t\316\241(P\017\3731\361\340\320\231\366_\034Fv\016\345\005vE;Zv9\b\207f0\035\232\273H<\234~ \036j\016\337\302v\307~9\267\262 \234\331\001&\024\242\212KH=\016I\333\312\220\327<\200\306\346\362\025\230\256Eud\373$^\257\030=B\t\343\230\266\206\ry\355\232\301\321\225:\220zRG\326\370\267*\2625\375i\301\b\002$vSb\202l\t\250CE%\025H\260\347j\004\343l8\030U\225P\027L6\026\250\352\302\250\021\004\2660\220\\\024\307\262.*\377VE~+\266\324}\024\004u$\343\276\215\3378\361QxSA\277\212\207\220G\r\026>>\031\363\004\344\373\204h\007\032"
+	.ascii	"x\013\302\2671\374\020\370T\032\324\b\245\215P\317@\342\252C"
+	.ascii	"iZ6u\274l\b\016\020\005\303\\\341\224\232\300uQ\301\365\367\264"
+	.ascii	"RT\273:Wq.0N\\\314;-M\323\024\272\327\2261"
+	.text
+	.section	.gnu.lto_statsOnDisarm.part.0.38.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375`\230\0015\016"
+	.string	"\306\327WE"
+	.string	"\2216\035\330*\261\323?+\223\276\344\331\030\245\372\337\277\307\375\250rv4;\b\217\364c\200w\013\bE\257q"
+	.string	"\nH\264x\007\353f\332\241\377\377\377\321L\255/jC/\330\356\263;l\216\244i\223\275S\n="
+	.string	"C"
+	.string	"L"
+	.string	"\273\213U~\251\2631\354\363,lw\237=;\307\253\312>,q\001\225\332]\372)G\334\273\214\225\347\277t"
+	.string	"$pt\031"
+	.string	"\344\360H\340\225Ggw}u\270\347m7\260\375\300\216\t\002'R\273\225~\272^1\307\341!\344,\2262n`\376\351+>*\354n\022\261\306\244.\370\275\344\207\365.\274\233D\256\321w\271\204+fv\353\346\323\f\256O\315\rX\237\325\013X\237\036\371\212%hCE\237~fi\037\361$\037\365gh\001!s\"GQ\246XV\257V\212\260\345\202\230\001!v5\354\320\261(s\206\211\237\036c\033\361\346\340\024\277\227\316 \235\022\f'\325\313\207\231\026\2515\251\033\273\034F\210A\020T\225\r\037)^\004\2460!\304A\210\376p6\316\303m\364#\201Z"
+	.string	"y2\372\021m\224s\300Z(\202\210r\232&\242\230\355x\377jA!C\"K\244L\261- *0\241\3340\326Y\016\223]\273$4^\003\344\223\370t\205,\236\024- p\002)X\267\001dX=/\033\2611\356a\201\023\211\306\341q\227("
+	.string	"\310\363\b[\f\303E?\034\031S\035C\233\025VIL\266\342]x\327\305K\3509\004\234(h\220\274"
+	.string	"\356>\035pmX\354\311^X]\027U<5\202\017e~a\2276X\220\241\204\262\346\255\260"
+	.ascii	"l/ \247?\375Z3\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"\345\006"
+	.string	"R\312%,\200'\352\234s\2513\034\002\023\2301\\\030S\204D7\342\031\220\031\230\033a<\024\377\t\277\264\322Jk\334\322\032{\376\334mK\231\002_\244\0168< \034ILb\302A\232\343\251\374\276"
+	.string	"\345\217`\371SN\365 \002\242\201\371\313X\303\330\272\230a\361\242\342L\377ow\377\032\305\230N\r\211\253\215\236\r\332\340\023adj\273s8\332\027 S\303\002\313\\\360\377J\205\356\3159\347\302\322\276_\271V \370\177k)\271\204\237\177\006\003=\272\273\025\f\260\377u!\033"
+	.ascii	"@ \030\020\334B0N\242o\006\301\276A\270\f\n\324\003\200\003\200"
+	.ascii	"\003\200\203\017\370\330\023\306\303\266L\220\245\002L\325'3"
+	.ascii	"\203[\f\304\307\303\330\241\244\300\0026\3524\004\243\bE\226"
+	.ascii	"b(\314\253\240"
+	.text
+	.section	.gnu.lto_.refs.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375 [\355\001"
+	.string	"\262E\016\022\200'\35230\003s\207\320\"\372/d{'i;\245JX\007\257`\033@\n8ZL\211m\232\242\255\231\022\243\3174\t\332q\264\314\303\250*{)\262\017k\313\273Z\b"
+	.text
+	.section	.gnu.lto_.decls.a753bd1277386c57,"e",@progbits
+	.string	"(\265/\375`\307\020\rR"
+	.string	"Z\207 \036U@PBJ\007\252\212\253*\356\256\374p\217t\006\217\305<\205\333n\020j\264\214\376R\222\022\374l\360\26302\267\331j\355m\345"
+	.ascii	"\373<eu\251{s\266\370\024/F\214L\230\256\335\260T\337\345"
+	.string	"\204\341\253a<\210U\037\2146m\310\205\342\250Qv\304n\231\002}\001\321\001\330\001mw[w\237\311Z`\270\233\231n\2552\260\356\366|\344\027:\317\261\013\f\367!F\267V\026\316r\211S\031^w\013\004\304\003\004\024\343\225\265%\213f\345\346\035_\0167\373\"\373\017XF\302nL\375\341\267s\033\037\371\fS\333\323\031\273+6\326\356z\026\354\371\307\207\303?\276G\300\372\360\216oe\016>&\302E\230\332\303FzJ)\216M\030!a\274\334\365%\330\363\332=,\273\304\003`\317=>\316\343\036\337Y\366U\336I\373\261\341b\307\024\223\366\340\264UQ8\356\3723\332\317cL\306g\275&T\264\327\272[\035\2311\271\255\265\273\362\331e3n\317g\\\366\021%\376cj\262\356\226\317\326\356%3\210\033f\0201q_\3134\337\372\313\276\345\035\037\313\034|?+\240\342\347\024\214\202%\260\371\257"
+	.ascii	">C=\0038\220\363_\231\237\222\377/\374\237c\023%N\300\177=\220"
+	.ascii	"h\340\347\005F\374W\340\277\377\202\370o\345?\225\377U\376\337"
+	.ascii	"\375\327\"\304w?\337\237E\3747\002\374\377\3413\377\355\375L"
+	.ascii	"\023\364\365\277\f\374\f\364\363\317\317 ~\356\371\231\200\237"
+	.ascii	"y~\256\3719\200\237;\374\f\300\3179?\337\374\374\373Y\346g\376"
+	.ascii	"9\346\347\336\377/\377\273\374\177\373o\366\037\357\377\226\377"
+	.ascii	"W\376\313\360\277\356\277\364?\332\377\366\177\001\377\351\376"
+	.ascii	"\263yyyy\377M\340\357\371\374?dQeN3E\225\335\3553\247\271\266"
+	.ascii	"Trs\252\365lN\243O\235fjeO\2277X\246\350\263Y\027}\3464\247\313"
+	.ascii	"g\223I\353\251\263\243\352\365\304I\313\262\216\321\232L-\025"
+	.ascii	"Uc\351\314\2516\333h;\351\346\265\246v\036\320]#\352t\262\264"
+	.ascii	"b7fU\212\331\266\214\n\020\305\334\2126S\265\371#\332\375\203"
+	.ascii	"y\324Q$\224m\265U\340\252\022G\215\206j\352\036\240\333\356\250"
+	.ascii	"n%w\265\273\225\335-\343\254\321v_\3454\301\242\242\272\241<"
+	.ascii	"Q]C\371\326\324}\327\240\270=\233\323\255\250\320\033\221)X\303"
+	.ascii	"h\225\f\326N\264\234\354T\211\326P\335\315WX\260'\225\225\273"
+	.ascii	"~\211\322\003\nF\256KQ\216\"I\216p\331r\205\260\020\347\024\302"
+	.ascii	"\234\345L\345,\274\345\202\266\2254[WTux\355\204\206\210\311"
+	.ascii	"\301\005=\341\256Zxp\276\230hq\335\365\227\213\375\255\302r7"
+	.ascii	"#\225\266\301\221\335\361\f|v\243l{j\204\331\035\3331\034W\327"
+	.ascii	"* #c9&\\\303\007f\363\202.ewl\003K\341*\264m\031\036\214M\341"
+	.ascii	"]\341*l\205\2510\225\357\270\311\371\006\236r\236\266\233\251"
+	.ascii	"\273\201\200\200\200xl\344\230X\301A\263^\037\346 %\312\315\335"
+	.ascii	"\214\257\256\2732\024\256b\027\367t\347\204\251\374\344S~\335"
+	.ascii	"\037h\260\370\340\341v\327g\341\032F\240\272\241\265c\3170\260"
+	.ascii	"?\327@\0033\261sC\273+\225i\340&o\233\247\206Y\245\214Ae\317"
+	.ascii	"S\366l\3062\\\253'\0372zp\f_\245Q\233\336\262j\t\222%s5\\\336"
+	.ascii	"\302\332\273\236\247#J\360\034\2531\033W\241\020\f1\243\322@"
+	.ascii	"\222\261:\206\201\2250\035Sy\216\343\316r\374\302\327=\230\027"
+	.ascii	"\214\255\311\022(&\217\247\225zB\327\326]WX\341~\371\250}\227"
+	.ascii	"\205\267\246\320\245\f\312\227\027.'D\301Tu\350\270O\3571u\226"
+	.ascii	"\0210\034)\215\"bo[[\267\213\245\005\264M\341!@7\315\222\302"
+	.ascii	"o\227M\013b.\344\335\365\342\270\\\254\t_\206\270q\335\0347T"
+	.ascii	"\242\226MZ\240\362\2208=n\245\3616\266D\r\005\024\356\215\007"
+	.ascii	":\312\020\261{u%\006\0357\372{#LS\025\266\252\b(^;\270l\330\270"
+	.ascii	"O<a\277$\315 6\356\372\230+\366^]]\254\016@\332\206/?<;\304V"
+	.ascii	"\300\342\263\231\036a[PT\240g\352\2052\230U\332T P\235\260\340"
+	.ascii	"uCC\260u>\222\200YRU\305pk{\300\034U\235\330\221\0313\030n\225"
+	.ascii	"\366\363\203nBE,\246G7I\321\222A\2752\330\313\332\366\223\003"
+	.ascii	"\030V+\326\351\274O\334\335\244\313W\344\006/:(VJ\352>\261]\200"
+	.ascii	"\024\252:\261\037\2154,"
+	.string	"B\356\372u\031\343B\305\270ONw\272O\254\262\233\323v\260r]`\260\356\372\373\324\303\302\276'\003\373_\0300\230\215\245=\305b\r+\f^\267\222\0208Z\202\330\360\nc\257\t\324k\002\237q\333SCum\210\367\270\330\276\313\276L_7\267\321)gC\235?\377\2630\3652\037\303\344\307\016#a8\357W\371\253\344'\334\316nh\367\244p\201B\177|yF\232@\356\372\036\026\373^\f\366\367\367\365\322\331\3352b\332v2\177\347\030\266\341\036\037\320=\022\321n\036U,l\030\222%\326]\377\373\364\305\272\225:\335\266\2639\325R6\325\230<u\332\276\341\241\2478\272\331j=\327h\337n\233\233I\353)B\263\215:\233m\303b\b\302\344\322\n \3628\034\201x,\032\300\227\342\246\250h\202\232\037\005\001\223\210\036|+4\340\200E\212\0245@\002^$\217\304\n\2106H\303$\362E\013"
+	.string	"\220\210\202H%#`\022\261\003\022\n#\006F\022\222\212*\206DFa\013\026\026\354 \211\305\"\021)\210t\024\322 \035'0j@\223$\0321\230\261A:\n\221\304\n\214\032t\370Q\020Q\320\270t4"
+	.string	"i$,\25202\022\221\216\302\232\242\341\221\270$\302\220\203\341\bB\344\217FDP\362(T\n\3229\021\36184\016\215\330\2230\301\200\211\241\022d>tB\304\t\021\276\017\235\020\022:aB\210\275\t\241^2\031D\256`\237l1L\022\217$\340\374(\bH\344B"
+	.string	"\"\343\222\212\037[$&\215\035\024\r_\b\213\303\242\0372\370\342\2304\2468\"J\n\225\220\304\"\234d\tC\343:\\\332\300H\214\031\006\207EI+\216C\245\3410\204\337\217\214\224\002x\222\322\360\bL&%\035\2015\310\240\021\321\2051\t\0052ydD,\272\340\200\f\016\221\210\311\021\r\260H\301$\222X\024,\n\223I\311 "
+	.string	"\311\340P\322H\\\222\271\220\020\n\237\0162\260\200%\n\002\022\271"
+	.ascii	"\032\211B$ \321\021\t\f\332)\032\026C\020\032\207AdR\230D\332"
+	.ascii	"\024\223\222(\b\306\024\351\252Ja\243\"\242\006b\212\016\024"
+	.ascii	"\332\266\265j\027\003\365\256m{\323fr\232i\303\223[\232T\007"
+	.ascii	"\f\032YR4\326G\273d\343\351i\305\265\235\024;d\3105\233\221Q"
+	.ascii	"\002\235\361cv\313j\274\250Vte\227l\016\254K\330\227\266\205"
+	.ascii	"\225\na\356\030\307I\340f\305\274\353}K!7h\210\260\020eM\354"
+	.ascii	"bQ`\005*\307][\262\337\324\224W4\b\0305)5-@\030\216\245N\251"
+	.ascii	">\375\360\322\3431C\027e\330W\217\016\t\020\026|<Y\203\250\260"
+	.ascii	"\354\n\201c\250\2018\206\030D#\"\"\"\"I\222\244\003A\005\204"
+	.ascii	" ')\255\007\0210)\263h\212$IA*\303\034\264\nP%\300\bZ\220\367"
+	.ascii	"\261H\272\235\245\270\223\220\250\030\240\324"
+	.string	"d\"\343#\b\304\304\347\363\326\032\3112\302c\271B\244\334\204\234C\0078\362d\004\034J\227\336P$|]N\272\016XS\201\r\006f\031\215S\325\236\33303\253~-\376H\315>\222\ff\2212\360\bX\374\236R9\221\256!\200\237\346\036~}\237\222\345K\371r\316\317\b\267\372\27546\320b\315\366\360\3140\300\354\"\237I\235c]\321\220\bA\216\377yl\337\0310B\303)tNd\212VZ\316I\272\337&\034\372\037\f\346c\204\037EL]c\022A\230\001`\013\303\222\271\007\341}Jv:\275\310\344\234)\013|02\216\302\370\023\f\340C6\273\214\366\345\363\313\313\343\032\360\270y\300\267N\216\3141\220=\215n\262\322\215\023\273H\324#\001\344\373\0040G\264\200\212W\266\003\253"
+	.string	"\002\026\361\242\333\361u[\213\301Q\357\233l&\b\322\310}\2642\363@\005vR\306\235UF\306WA\257\342\345\006\031\200\343P\262\202\321\\a\215\341\264\020\313\257\204.\261\330\035\327\0061H\310\211\214q2p}Zf\247\323\233H*Q\256\030\027]\006;\032\214\340\365\022\025\220\006\202\304\201\207\256\330\216\226\247\324\017\204)\270\224\306\037L\360_\3171\026n$\363\354Y\224F\322U\267\346y\005\307\367\376\0136\203\231\221x \304\306\245\020]B\277\311:\t\340\244\200\022\264\307!J\200T\022\\j\225=\r\227\016\245Y\r\303\031\326\317\032&\0162\013\310\353h2+\247\3540J\273o\256s\254\277\021\005\021Fb$\217\347\002~\003\303\352\325\230"
+	.ascii	"\372\320\341\245;\374\247\210\035\200\032\f\276\001\030\001\005"
+	.ascii	"\257)\361\fp\r\206\n\034\220\227$\324&\\\f\0221\270)O_\021\305"
+	.ascii	"\"\3439\227\373vHH\340\274\001z\362\320|\007\204'+\177/Z\207"
+	.ascii	"\rLm.\347\013}\221\342\333\017\253\226\264\276\277\372\027\232"
+	.ascii	"\206\001|=\362\027\032\n\341\t\210\202\006<\321\007\220\207\365"
+	.ascii	"\030/I| \350\007x\037\371\236p3\274\237\213\237\361?\226_-\327"
+	.ascii	"\322/|\2545=\r\247$f\372o\373\235\r-8pL\265\f\266\214\241\340"
+	.ascii	"\314\251[\024W\265\033\345\263\356\0359$'B\336\311\246\312K\320"
+	.ascii	"\035\355\b|\206\363\303\\\340\032W\370\033\230\376\364\266\336"
+	.ascii	"\325C\366\372.h\302\030j\177\361\375%r\205\\\005"
+	.text
+	.section	.gnu.lto_.symtab.a753bd1277386c57,"e",@progbits
+	.string	"writeStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"writeStatsEntry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"statsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"statsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"isConfigDirty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"dispatchAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"dispatchEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a753bd1277386c57,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
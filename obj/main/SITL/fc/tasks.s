@@ -0,0 +1,1474 @@
+	.file	"tasks.c"
+	.section	.gnu.lto_.profile.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375 \261\325\004"
+	.string	"\204\b\245"
+	.string	"\017"
+	.string	"\354\301\314\336\005"
+	.string	"\001\314\345\244\232\005"
+	.string	"\002\223\317\352\353\001\002\002"
+	.string	"\002"
+	.string	"\004\276\376\210\236\003"
+	.string	"\006\275\236\357\212\016"
+	.string	"\007\313\233\235\316\016\002\002\001\002\001\t\366\211\310\207\013"
+	.string	"\n\376\376\316\323\004"
+	.string	"\013\376\303\253\241\n\016\305\352\265q\017\202\312\321\202\003"
+	.string	"\020\316\305\360\246\003"
+	.string	"\021\254\236\243\365\007\026\002\002\002\003\002\004\002\005\002\006\002\005\002\001\007\002\b\002\002\t\n\002\013\027\346\300\255\206\004"
+	.string	"\030\231\247\316\275\r"
+	.string	"\006"
+	.ascii	"@\fP\306v\371\214jzT%\316\006\332"
+	.text
+	.section	.gnu.lto_.ipa_sra.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375 \362\205\003"
+	.string	"\324\002\346"
+	.string	"\016"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001\002"
+	.string	"\001\004\001\006\001\007"
+	.string	""
+	.string	"\t\n"
+	.string	""
+	.string	"\013\016\017"
+	.string	"\001\020"
+	.string	"\021"
+	.string	"\001"
+	.string	"\001\027\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\035"
+	.string	"3\t"
+	.string	"\002`@Su\340\342\235\264\024\306\021\332\345<\334,T\260\bE\321\240\304\271\204\200\271M\204q\202\\.\fc\223\017\264L*n\234\265\235\023Vn\2002\320i\001\346pU\370\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`\016\003\005\n"
+	.string	"\262\n&/pK\323\030\234~\224v\306a\025\003\021T\005e\340DEj>\326\224\240\004>A\337\354Co\377\377\377\327\373\254Y7!{\2555\273\267\224)\377h\236\224\314"
+	.string	"\205\230\340\350\250\b(\306e]\231\360\244B\301b\343-Q,\202\035}\373!\027w\367\355|Fd\025\365\206K\361ur\372\340P\260"
+	.ascii	"\177\237S\273\260$\032\240f \030\034@7\315\314/E\375\237F\341"
+	.ascii	"\240\005\002\3204\262\212r\326\245\350\350\2451\354\356\343|"
+	.ascii	"e~`w\t^?'\335\335m\037\3554G\250Q\262\021\t\204\0246i7P\242B"
+	.ascii	"\205\346\001\022\340a\231\002\f\2441\243\214@\031\243\204&\250"
+	.ascii	"\251\261v5\273\023\204=\034C\r\300zt\031h\216\355Y\"JYkF\377"
+	.ascii	"\0335<\257~\031L_A27\376o\252-\333\322\242*:\245\342\3129\031"
+	.ascii	"\004\310\325\304\275\360\316\232\264\212\215\304\262\232\337"
+	.ascii	"\314\030\352-\323\250Q\3071\331$\220\306\312t\370p\032\017\353"
+	.ascii	"QB\324\023\261\365\022O9\220\234\302d[\256x\252u\005\340R)3/"
+	.ascii	"\211q\253\246}CQ,\245\bi\312\350\341\241\305l\207;W\307\262\007"
+	.text
+	.section	.gnu.lto_.jmpfuncs.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`R\004\305\r"
+	.string	"vQ84`E\223t0\305\020\320\021cl\021\021\001hl\375\246\006\t\202\250P\247\315\217\252"
+	.string	"\375\310\372 L\207\004\024mD\261\263\376\277\221\326m\366\333\337m\223\235d'"
+	.string	"&"
+	.string	","
+	.string	"e\270!\216H\350\017UX\270\035~\242[ \177\030b{m\327u]#\247#\347\266\025\236t\337/]\373\235\372\034\004\307\336\222\335\222\367\331F\020\317\344]!\227/\263\253)\2245y\330\366Q\310\202\254\021\362\034w\237\325\233\374M\336\001\017\013C\222\24039M\255MLQK|\367\305[|\330\326i\353\\"
+	.string	")\221L\360M&\022\252u\272\342)\256\034\253\306\344c\006\002\215\256b_\251&'\360\341\033\2571\004A \221\beYV\024\375\r`\002\252"
+	.string	"3\206x\367d|X\320\300i\033\\\327\363d:\034\217z\250AqD\"-H*\225e\f"
+	.ascii	"\303\231*\017\021Pdi\310\320\220\214h\201*Y\326\342\021\020\261"
+	.ascii	"\207\321\216\321$\324x\200?p\207SZB\315\276\022/\223\026\214"
+	.ascii	"Dl\210\377C\30242\b\177\177\020`3\t\274\313@B\220\216\227g\306"
+	.ascii	"\324\207\305\021\374Ax\242\030\215\231\347\036\342\252\361T\021"
+	.ascii	"\337\027\"\241;O\"\322h;\250\002`\002X\374\371-d\210\2671\271"
+	.ascii	"\360\252\005\017\362\207M\022\324H\244\027\035\217\267\005zm"
+	.ascii	"\017\002H\204\313\321m\\\231\346*\377\325\234\345D\214\2074u"
+	.ascii	"\231\031ZR\031(\013\307b\320\315\204\276\275i\n*\n\260\332\207"
+	.ascii	":\260\276@\"`2\233\234\017%\177\231]\005j*\020N\177Fm\237\310"
+	.ascii	"\300i\237\001\351i\341|\017"
+	.text
+	.section	.gnu.lto_.pureconst.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\200\004\001\230\004\002\230\004\004\230\004\006\230\004\007"
+	.ascii	"\230\004\t\230\004\n\230\004\013\230\004\016\230\004\017\230"
+	.ascii	"\004\020\230\004\021\230\004\027\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375 \325]\003"
+	.string	"\242D\017\031\260\325r\f\3030\f\3030\007Zk\315\310vs\215\355\035\213K\266&S\n\204\355`.\330\006\346\320\0260\277\346\326\274\332 5\237\266\322\212G\247a\224\004\211\366\241!\341\356v\261\020\023"
+	.string	"\277\231* 4\026\"\240\270\252.p\356!X\230\204\267\200rIM\330\305"
+	.ascii	"\001\263\020\f\bA\260\315`\001\301 \353\r`\001"
+	.text
+	.section	.gnu.lto_.lto.68045de3aee0735,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskMain.125.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375 \362\235\006"
+	.string	"\242\214.2pm\032\003\240{c\343C\200@\f\253\207E\203\202\241\237\205\033CM$\004z\323\210]\024\265eT\f\374\365\201\225\252\272e\341\261#\272[\022)S\n\222a\362t\026\252\317\024#\004\f(\334H\007\311\251\036lx\237\016\307\363`\224oCP\352a\212\257\242\250\3702\327\335D\325H\264\211\366\002\261\226\321\332\362\377m\242\226I#&\005'\177\305\212\312K\234\bG\246\255Y\353\016{L\177D\024\363_\214B\376\013\241\007"
+	.string	"v\032\017\\\354,\026\270\330u\266(\2766.a\220P\200\244\374\177M\303\323l\326\036\031\023\262@f\222\302\377\262\220e\3416\2675h\233\320\326\n\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_taskHandleSerial.126.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"\025\013"
+	.string	"\206\024L=\0201\324t\030e\301%$\362\207\2134S%\366\314\323"
+	.string	"\270\264\307\263h\334{paC8\232\266\333{\333\226\210>k\037 3W\025u\227\257)\202\202\024\374[\223E\255\365&[\246\0249"
+	.string	"<"
+	.string	"7"
+	.string	"\273\232\374\360\357\363\222\372\371\217\320\363\351\030\375\222\"\024(\030\251pty- \275\3100 \f]\021Ui\365\323\365B\bR\315&\273k\005C\321\215\3356\305v\003\373\007\002\252\352g\224\221E\003\301\214]\f\255\033;\316\026# \266\257\366I\274\304wS\005\003\330\345\240b\305\256\310\300\n\034\237\t\036\301>\257\027\300>\375\3312.\202\330\254\264\262\220\202\265\001\341\b\222\236\213"
+	.string	"I\243t\007\273\204\200\212\021R\033\366M\374D\307\017a\n\034=\370\351s\260\317\313\237N\240\345B\303G[\266\350Q\351\301\376\265\273k\331\301\276\351\017\336\003\013\346\342@\223\261t\335f\023\340M\342I\360*\032m\213\240e.\025\214\266u\236&1`n\202\245\3234\034\327i\020q?\371H\320|\250\215\341\244\262\250\241\332pej{\033=\350"
+	.string	"\251\023"
+	.ascii	"2\003\302p\311\302Z\021h`\366\202.\240\326\005\256$J\026\\\025"
+	.ascii	"aW\322`\241\300\224K\260\304j\312\270\3137\333\223\n\263\242"
+	.ascii	"VA\001"
+	.text
+	.section	.gnu.lto_taskBatteryAlerts.127.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\245\013"
+	.string	"\346\025P@ O\234\01601\244G"
+	.string	"p \004\224yT\214\256\327~'!\fe\346\306@Ha\013.<\326\210p"
+	.string	"\005\032\225\303\307\373\246\005<\377\261\232&`\023\016\003T\224\373\200Y\217\240O\366\3362\245="
+	.string	":"
+	.string	">"
+	.string	"\366\212\203\032\033\3110\221F\270\330\335+n\370v\031u\363\217\272\304\373\270\313\f\217\022\301\207G\013\001\337HVJ\035\274\243\256\027\276N5\302`w\255\336\207\341\236\267\335\300\266\002\373\013\002\366\345\356\256#\206\255j\353\247\177\252\372\222I\n\305\201\022\273\245\220\027\033N\023\036(\266\257\366?\234c\373\311\202%\273\032N\244v\301\0046`}\026x\245\372\224\037P}z\013\246\240\351=\003\350\330\b\273\310]\003\344#\025m\251\254x\324\255\024\"T\214\024\304\277\245z\264\242\225d\352\016\342!@>\007W\b\351\275O?T}>N\026$6L\"\r\261ANcF\032\204\fG\363\340\323\311d\031\b\013`\354\242m4\314\347\302\"\\\035\r\206sa\231v]\b\3303!\223]\037\217'\273(\340^n\304\260\003\217P\024;\t\332\344D\321\031\355\rG;8\302Q\344\244\245\016\023"
+	.ascii	"3\241\201(\006\210\243\\u\330\246a\254\232\023]\206\007x\023"
+	.ascii	"%\013\256\256\260\213\037\314\261(\373\n\246\\\202%VS\304]\236"
+	.ascii	"\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_taskUpdateAccelerometer.128.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"m\b"
+	.string	"FP<8@s\322\001\030La\235\344b\344\247\340\241\210~\301E\221\032?\200\372\362\250\335\032\320\037\323\b0\246\025\270\004]\272,\211a\374\322\350\326\276\315;\326\337\266\221M\266L))"
+	.string	"-"
+	.string	")"
+	.string	"\227\376l\232\207\036\313Y}d\240\324\354\356\214\035\377\256\237\177\222{\300\224\351\312a\330]+\230\332\270\343m\037\330^\260\255\022\366Y\277^"
+	.string	".1\t2\273\03276\333\222,!\037\333W\373\"\037\371\316\272\260g\227\003fe7T0B\347\322\340\004\330\345\365\001,\352\237L\274\344&\235\017r\351\022\205\036\274\f\270g\260K\215v\205\205\036\264\246\264\2640\242\311\016Q\032W\366\257\335]GU\335\2036\0229x$\215\343J\231\2003P\027\321\205\274\231AL\222(4\232\031\327MP\2017\t\215\233\336\266q\363\023\236~mT\271\341\245u\212(w\002\t"
+	.ascii	"2\241\243/0\\(\033\025J\301\220K\260\304j\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.129.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"\215\t"
+	.string	"\346\021B90\221\322\001"
+	.string	"_0\255\001{\245\220\302\240\307\314;\031]~\031\217\025D\301\341\373\332\220\331\200\032\220\277\365f%.\242C\001\"\0254\270C\265R\264:\344\377F\366\226)\005/"
+	.string	"4"
+	.string	"/"
+	.string	"\273\313\311\220\203\237RA?@L}z:.\247A\313\303f\023U\363\363\022c\035v\325\020W\252\235\320\356ZC\221\343\326n{\301\266\202\355\2310\b.\273\033\263\233\215i-#\233\355\253}\223\237\200\177]\030`\027d\205ewL\360\201\347\332\347\004\234k\363\003\234k\006m\231\217\"\333q\225\260Rj\002\0373\025i\013\316\245\003J\314Je\326tJ\233\242B\037^\036\366g\2044\261\225L\331cJ\245\313\376\334\335\265l\331\177\375S\325\357l$\001_\303\250Db@\231F\2367\321\t\270\003}\020\237\b\305u\017\234\211$*q\235\367q\240\002\237\"F\036\207:\235<n\033\367!\f\251\232\036\265%>}hyY\017"
+	.ascii	"2\003\302p\036\302V\rt\205\275@5\017\274\264\356}\027\326\013"
+	.ascii	"\300r\261\226XM\021w\271\251\366h`j\017"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.130.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\355\t"
+	.string	"6SE:0\217\323\001\004HL/0A\"\210\364\277\2266\261+D\"\277\203\231*\313\306\261\201~u\214\360\030^u\312\303\022\027\232^\006)%\270\377\313\233\224M\f\333\020\t\331{\247\0243"
+	.string	"3"
+	.string	"4"
+	.string	"\035\355\270\370J\247\350\337\365\315H\232^5\033\247\325@f\342\362\3623\203DUN\312c\274\353\023\203<\315\231A\330]\317\221\324\270\265\333N\260}`\273%10\033\323N>\354\2276w\316\366\247}\220\207\210oUx\263\313Q\362\332-;.\320\\#8g\273V/\260]\263h\263\274dmf\005\273\030y\331\335\254\231\354EM\261\2356\210\254\240\346\314\333\254/m\266\304\304\374x\n@\342\212\241\250\311.M\223\256\354\327\335]S\225\375\326_\347\3643\034JJGe7\025!\003H\024Z \215@ X\362\002\354y\302\207\360C\352<\207n\024\372\210:\017\f;\317\200?\b\020\330\221\276\017\354\270r_\227\252\254"
+	.string	"\213Y\320S\335L\373\213\230\037M\037\016"
+	.ascii	"3\241\367/\306\325PU\330\013T\363\300\013\353\336na\275\270`"
+	.ascii	"\251i\221X5-Nr\314+\361\fj\017"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.131.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"e\007"
+	.string	"r\31646@o\323\001\230NL7\214\337"
+	.string	"\275&a\274pd\332g\251\3619\357\206\207Q\342\004A\251\2406\351\210\240\253FX\310\370\313KW\266\336\304\320\374\370\326\332\226)\005\332\303\025\0029l\242+\313&\254\200Z\036-B\373l\321\202\210\"\320'\024\255L\213\236\202b\022W\0267\f\313b\347\273\251CR\033JN\027\020\243T&l)*\322^Se\344\224\001\273\366\353\022~\264\246\376\277\220\324\332d'%@\362\262\260\362o\314\310\374T\265\210t\332:[\233\370\204\263\311\242\234\337\303\205\345\377\022\212"
+	.string	"\340\312\300\004\032W\224\0074\256\312\2650\376@\276)uh\244\304\374\217\260d\316\311\325F1\307\033u\316\r\303\377\2467\342p\241\333\036\264Uh\033\022\b"
+	.ascii	"2\241a/\360\270\340\n\346]\002 VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_taskTelemetry.132.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"\255\013"
+	.string	"\226\326QA q\223\016\034\031\r7\"\021\317-|\tv\340\203\316\004\302\217\321W\006\267J\237\340\325\373\f}\202\034!\3407`n\275W7h\004\212@"
+	.string	"\244\361/VR\034\003\360\005U\323k\322\366\336R\246\024@"
+	.string	"<"
+	.string	"?"
+	.string	"&{)\341`\001E\215\335\255\264\344\331\341\323\314\374\243\034\263q\332\341\244\341/Cq\244\324W`e\005\r\212\253\3604\"!\266\243</p!\231\227\004\273\353\3348\fw\274\355\006\2669\3669\001\177\273\273\326\021\373'\177\314\264f\372S\306\005\f\004)vEZnl\t\262\020A\331~\332'\361\022\331O(\030\263\353A\205\312ng\300\004\246\303\001\327\304\303\367"
+	.string	"\361\320\231-\343]\3770\345\264\227\020m\254#\277\251:\350@R\355\356\264\337\204eEE\225\304\377\210\327\007)1H\311b\337\304O|\370 <\301#\277\035\372\036\361\360\252\031Z\330\330"
+	.string	"\222-v\247\245\222\330\001\030\003O\350\263`\304\341\271\256\016\013\200\255\r\006\302:\243\312\202Pq|:\241\312\272\260j#\300\242\b\236\253\032\211DWEu{\035\261\202\027%\020\r\201TF\265A\241\374\346\247\232\017\224f\214xO\271j\021"
+	.ascii	"3\003\3369\004k\250\212\355U\205^V-\r\234\321U\370\004\327`\001"
+	.ascii	"\226\213\265\304j\312\370\345!4Y\025&h\254\312\235{"
+	.text
+	.section	.gnu.lto_tasksInit.133.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`\211\n%1"
+	.string	"zS\f\022E`^R\007+\\\374Q\261q9|\301\034\0162\230\263Ny\303\363\030\2561\2045\323u\037\225\374ms~\210\367\251c\231J\016\273\301\013\221\nh\350E\327\341\324(\207\352y\rqVZi\215\273\311\275SJ)\013\001\370"
+	.ascii	"\020\001\327\331w\235{\327y}g\236\352|\337YM\235\323w\376wvw"
+	.ascii	"n\017Lq\315\036dN^\r\264\345\272\273\323\276\251mF\372\331\255"
+	.ascii	"\326\316\334\235\326k\374S\033z\262=\2314X[\345\005Ol?\257\212"
+	.ascii	"\216\320\226\013\3023\356I\327\266\320\245VYim\225Yf7\r-k\273"
+	.ascii	"J\023\255)tm\3336=Y\263\rd\374\361\351)\022\207\302 \360\347"
+	.ascii	"\353\255\274\253\246\357,7/BO\311<6\220\361\314\314\177x\021"
+	.ascii	"\200t\235\265O\352\224E\327\243\341\226ER\240\235\026\232F[\022"
+	.ascii	"\361\236\263!^l,!M\0242\204[\372(sa\263\203M\264%\230\003\233"
+	.ascii	"=\374\367\325\276\206[~\365Z\033\241-yx\317\bH\227W\257\215\266"
+	.ascii	"\364r\036\334r\307\217\251\345W\206\272\346\35045r\235)\205"
+	.string	"\314\254\364@\224K\235\0373\351/d\"\323\242\266m{\255}\213\231t\347Eh\333\226]\311\354j\016j\346\336\301\314\027\230{`\001?\247\347\275\3579W\341\336w\242\320n\025\272\334G\321T\242\276O\301\253\357{\226\321\312\203\325\030n\372\n\276\361h\271!-\264\026\fX:K\006\r\0336\334V\323G\321,k\246\251\005\371\177Kif\016\035\212\374\037$\241\315^\356?\002\031N\220~\307\375\376\255\225\207\371C[\001\261\266m\222\0017\225\256\022\202\273H\253,b\204\267\262U\356\021\267\325\376\030\315\260f\232\032\226\337\255/\242t\321\2413uw\324e\2262!\264{\313\372#\377\2349\305\no%\377\314\035\251\213\"\377\310\fE\372;\231;m\177\2149u~\352g\263S\2535+x\347\002\357\254\364\316I\2533\322u>\272\316F\327\271\350\235\211\256\363\320;\023\270\316\003\336Y\350:\013x\347"
+	.ascii	"\327\031\300;\007\2753\220;\033\335\371\347:\373\274s\017\317"
+	.ascii	"\271\370\316D\236\363\360\235\205<\347\340u\006\006]\307\253"
+	.ascii	"\363\260_w\032\017\013\346\203\375\361\343\266\372\363J\300w"
+	.ascii	"\262\217\373\3740\316\217\025[\301F\027E\316\201\276\351\253"
+	.ascii	"#kz\350\366\026\344=\237\026\277'\016\234\342\367\316\314\251"
+	.ascii	"#\376\017\237\350\354"
+	.string	"6l\206\377\2631\247\211\360\275\243n\360\205\337YX\262\216c\221\254m\3332\340N\323jX!,\021\326\2145\273\255\006\277'\347M]\227\331E\331|\353R\007\313\354\324\3401\265\322o\001\237\204\001\357f\221$a\227x+\201\017\334\222\366\226Tz\340/,\353\217\267\367\316\364\327\037[\352\244\377\346\275\223]]ja\\]\236\224\251\223~kK?}\2575\322\220\346\231\373\351?=\273\326\r\244\337\255\327\227\344\304\266m\266\311ef\237\260i\336J\337\363\236\204%\377\230\262[\032\2232\365\235\375^\314\210\265I\337)\246{\017\f\302\2565\231\2531\275o/r\336\266\355\361\337\311]u\327\027\256\211\262&\351v\314,\241\303\\\201Y\377D\363\311\373R&\240\254TLy\260b!EE\345\202\002\f*)++\250\tRU.\212\034\225\240*E\025\224UST\211&\026'\240V4EQU5%"
+	.ascii	"\342\251\026RTMVSSTM?(V\247\355\217\261\232$\254.\212\365\310"
+	.ascii	"\036$m]\024\310\311\032LH\254L\316\330[\n\222$\212\\\322\355"
+	.ascii	"Z\206\031,c~\202|\310\346a-\354\242\343\310KL\216\317;\327f"
+	.string	"\267.\322SE\221\233\341c\354\226\003q1\226\006\027\313d\336V\221\336A\220\261b\027f\317p\251\337\214\0165\"S\0278z\022\353\321\003\333\356\n<\261H\004J\0250D\243\1778\257\321F\337s>,\372\207\363\034]\364JmsD?\034z\242t\350\211\332\312\020x\341\200'`\300\327\001\257\324\365E\350\203\002^(\311[\300\023u\255\005\370\036\200\017\360\b\030\340`ux+\001\274\233\331hyF\346[]4Kx;\352\322\005\275\037\033\350\373J\007}g1>\320\267'\035i\374\024>\330\250\035u\201[\350\004\337\311\315~\335\237\017\200\323\250\201$\203\235d2\"\")I\222Bc\260\002\021\241\242u\003\0200\206\212J\223\f\007U\324\032\232\307\023\246\r\243\001\263\330\242\017\340\301V\020\3140Y\272\201P\231\r\005\245\345\027\3442\371\302\257\337\246t\t\261\257\342o\312\370:\316\267>\017\"\206"
+	.ascii	"\251\320\366U\rPS\345O!\211^p\367\354\351@,\372\245\327\"\307"
+	.ascii	"\266\261\3601t\370\316j\3162\021!\212D\352{<\013E<R\257\343\350"
+	.ascii	"\034\026)\221\214\002\274\224\207\2210C\3762\277F\257\265?A\351"
+	.ascii	"\021\271\335?9\003\024\r4\215\213\\-\0024\002\025\212\324\b\346"
+	.ascii	"\262\206\342\276\234H\271\364s4\221y\304\002\216H\\s\305\253"
+	.ascii	"!\350\342\240\205\006\027\r\0347\002\027\3638\3348{8q(Vt\005"
+	.ascii	"|[S\2706\271\224\277\373o\302\232\322\335\331\224\032\317\362"
+	.ascii	"T\226\201(^n\230\013\201\331J\027\223\255\032Z\256 \335i\nd\222"
+	.ascii	">\322H}\311S\223K\324\020cOzQY\363\244P\232\347\237Z\035\324"
+	.ascii	"O\216\366\b\231.\260k\235\311_h\033i\342\210R\213\326\030\004"
+	.ascii	"\033\021O\365\261\364\r\226#?\030\306)\274\f@BE\203\317\210\300"
+	.ascii	"\b\223\205\223*\226\347\033z\247\237s0\277\364\212R\237\021\005"
+	.ascii	"u\023\032\302\246\212\202%\2064\207\201\\P\002)\363\306\320\235"
+	.ascii	"j\"35r\276\3060\301M\3219F\211\177\222T\034\357%E\275\211\262"
+	.ascii	"\253\2704\222\353\377#\037c\016\375q\005\225\373\240\263\304"
+	.ascii	"L\315\3647\325\377"
+	.text
+	.section	.gnu.lto_tasks.134.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`\002\006\275\034"
+	.string	"\306\353\253JpXv\003\177\032d\273n\333}\037\251\333\357\0201\327\005\333\231"
+	.string	"\347\357\320\236s\"\265\234\222\267\262\227\222\246\250\273\225x\021Ec\371\225`\373t\335\241\264\255g\252\236(\177\372\333\200\310\230 Y\213\321:\024W\353\331\237R\n\232"
+	.string	"\234"
+	.string	"\231"
+	.string	"\355=?\370\354\334\027\276\346\244\013\340\243\356o@~\314\306\366\346\211\360]\2570\274&'\315\016\036m\307\237\366\006N\370\356}Vs\243\3568\326r0"
+	.string	"\372.Z\332\227m3{\031T\200Y\262\237\325\035\255FZ\020\262\275}\275\276r\241?\354\2526\251\266\315\274q\366\001\275"
+	.ascii	"\257\257\035,\331\251u\017\033\3523\210\272\230\262\323\300\260"
+	.ascii	"D`/1s\3062\020hFm\373\326\320\336\007zGH\034\276\213\326$)\211"
+	.ascii	"\027\333fv\246\276\352n\266\316\335\272\r\257\257\374\215s\336"
+	.ascii	"M\354\234\\\225\303\375\325\207\360M^D\327\312\372.\324\224\252"
+	.ascii	"\277\375\222\377\340\334\372\356\031\226/6L\355\355!\337\301"
+	.ascii	"'y\346\347\232\266w\227\352\275@\272\211\3730\376\206)4\212\221"
+	.ascii	"\316\335\314\272|\361\362\275~\214\366\356O2>\217\024\332\244"
+	.ascii	"\272X\222}\256\356Y\252Z:\023\330\017\023N\243l\334\0323\245"
+	.ascii	"\n\225\243/\366e\274\230\3108\251\373\223(P\336_{W\200\377\217"
+	.ascii	"\264\253K9g\224\324\035\216\311\222`\334\336>\016\276\004i\264"
+	.ascii	"I\235\211\032\0030$\331\211\324\275\310\021#Cb8\006\270\362\202"
+	.ascii	"P\221\317H\251,\362\311\360N\326\313\272\215\256\326ut\266\336"
+	.ascii	"\243\273\365 ]HG\322\223\364&=\256K\351r\335J\277\322\267t.\035"
+	.ascii	"\314\002\357\301+y\020\236\311\217\360$<\224G\341\243<\013O\345"
+	.ascii	"\235\036K\201\347J\360\247\374\017{\211\231\343\253<TK\351\243"
+	.ascii	"[YmT\337}\302\371\252\026\376J\351]<\277W\253\326\263\"\253\372"
+	.ascii	";\322\253&\325F\3127\375T\247Z}WIJU\227\302\257\360*\272\236"
+	.ascii	"\337}\312\355\274S\322\227\250\275\211\247\023S\254\037\034\370"
+	.ascii	"\022\205+\037\302\364|\234Y\016\323/\260hd9Q>\006W.\303\2640"
+	.ascii	"n\300r`\\\334\361\337\357\335\321\257\313}d\035\027\276\261\f"
+	.ascii	"\317,\337\371\321oq\216\201.\207\203/-$B\240{`Y"
+	.string	"6\376j\370L\313\260\360\005:\3120M\277:4|.\006w|\236\337\342\220\370k9Q~uV\016\003\215tL\013_\227\037e\032\036\302B\230\216\341>D\035b\334\023\027]\216\304Y\016-\203\214|H\n>\013u\020\221\017Y\264\364\005\200\212\2501T\215\034\263\222\362H\2459 #\021)n\003\020(\205\310\206\252\320\030I\307\224\274\320\335x\244DOI\213\330\214\322D=c\033\317H<\240s\240\026I\320\202\360\266\222<\025\024\b\216h\303\356\366\231\255\n\216h\303\237|\210\fd\354\351/\315:[\306\202\331\352h\321\250=\004\263=\242\204\260\026lh]GCC\257\230\2641JW\030o\321\fnS\267xE\n\363\243B\326O`\252&K0wa\\\373\005\215\256`\203Y\316\316\f\002\243\357\330\230b\017\354\222\2520\241+\212\r D\001\211&\306\241\211\300XO\346\241CS\032\230q\234"
+	.ascii	"\222]\343I\034\266\223q\264\345\306`,\375\254\317\210\020f=\354"
+	.ascii	"^\327\236\b\254\365\323\252\261\374\210\273\216Q?\372\216\251"
+	.ascii	"\230\203D\315\225=(\361'\370"
+	.text
+	.section	.gnu.lto_getTask.135.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"\245\b"
+	.string	"\346\020=7@s\322\001\030L\302\212aa\256s\215~\223\310\\\027\017\355\242`\245\231:\255!\257u?\241C{\363\021q\226\241@\3355\277\363"
+	.string	"C"
+	.string	"\273\027m\355\223M\266L),"
+	.string	"."
+	.string	"+"
+	.string	"/\031)\232\335)=\337\271\0367\037\270\036\341\307\275\253\347?\345\326\310L\313g\"]\001\032v\327\372\231N7\274m\004\333\n\266e\002\253]\215U\315\302D\225\210\355\221\315\261\255j\377\344(\243\317\004\007\354r\220\270\354\316\005\037l\036=\226m\277\344&#{\005\023u\272B\002\\\007\265\273\f*_\251\360A\036m!\322\177\217\276\350zT\370o\243\244+{\222\024z\330\267vw\r;\254\237\377-\003UL(\017\016 \016\353.g\037\016\304a\235\314\"\344\204\004\026\222\331\306\311\017\2015\n\210Mv\232\266I\316\334[\241\247\0041\354\263x\002\250\317\366\305S\001\013"
+	.ascii	"2\003\302\260a\234\"5\246f\323>.\243&\025\355Z\305\203\273O\252"
+	.ascii	"\025\2230\311"
+	.text
+	.section	.gnu.lto_taskTelemetry.part.0.178.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\215\t"
+	.string	"fQ?8@\217\322\001\230NL\215\0267\207\314\335\002\277\320"
+	.string	"i\333\233\253h\340\300\022\243!\253\342j!\242\017I\r\303\tZ\324\0314\017KY\320^\177\007\177FZ\273\267\334)\005-"
+	.string	"-"
+	.string	"/"
+	.string	"\206\371'\262\033\327\307\306I\314\356\316Ku\335\273\302\350\371\207]K\255PW\200U\307!\301\343\246aw\235y\334\362\266\031l/\330\327\0026\204\377N\177\231\342\267+\225!\264_r\023\357/\223\265\335\020\024\225\335O\341\322\b\331\345\301\0134\227\361\035\315\245}\022\333'\225=\007\024\335@\213\204W\333\342\002>\345\200\024\226\230\206\242\240\266\2541\256\262\354\177\377e'\301e\227cFfA\344\312\210\355\333\207\235l\016\347\322\001\035\004H\024z(\215@\034W\261\tx\363t\022\335\2474\267\2109\n}Ds\343\272\35110i\002\304\315\022\211\304M\316\343*\313\016/1\f\315Pm\331\316\002\024"
+	.string	"\031\213\021\261\002\343\202\271\212\f8l\323\360\233-\200\367"
+	.ascii	"\nW\343Em\2753\b\312ygvZ\260\231\274\323,p\355\305\224\323r\372"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.part.0.179.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`3\001\325\r"
+	.string	"\206Y\\D\020\217(\035#\031\331\025(\240\320(;\f\205\254\2726(p"
+	.string	"\342\031,\263\272\n\320\307\237\223\020\265\242\337\017\356\030\033\004V\351\\\223-@\023\025\201U\326\200% \017\003W\by\225X\367\t!{K\231RF"
+	.string	"I"
+	.string	"F"
+	.string	"\266G(\223\354\025\017Kf\226b\ta\265\230sn\227\253:\351qU\222\374\257\216\371\300\322\243~\340\205o4\360Za\001"
+	.string	"<E\215\021\223\357\256\253\bhR\315\270\314\032\3149\255a\270\261\333~`\233\201}\r\001\376\210\247\370\256\026Kd\315)\234 \312f\211\264\022J3\001\222\342\225@\373\311\375\223\221\277r\006e\364\320C\263\341\300\245U\355\207\270\b\322C\017c\346\354PBe\316\020\301\245\013h\227\232k`\227\361\001\260\313\314\345?\004&(B^|\350\213\367/qy\251\354\246l\213\260/\201\f\252\024\025'uq\246\266\327\241\377\276w\375*\221\225\026\323\226tS^\3718\227\304\216j}\353~\226\261"
+	.string	"\304\234#/.&\007y\302\303[?\312\325~\334\247CA\302\206s`\201\373d\274\b\234\247\003!\364\341\272\256\203\203a\316\206\307\341mB\033g\302\366\351l<\033\247\363\266\215\001\006U\340\272-\004\002u\233>\316%Y]#\301\322\362\261\246\230Q]\001\347\300l\017H\377Y\003\262%\177u\025\004\035"
+	.ascii	"Q\013B\272\00171\356\ft/\365\312\214\306\022@\036\030\341\212"
+	.ascii	"Q\217\025\n\030\002\344\003\031G\201 \253\211\3110\274E\243\024"
+	.ascii	"\326\005\242 \230{\206.\352\234N\013m\246\3544\020\\{1\305\241"
+	.ascii	"\251q\357*c"
+	.text
+	.section	.gnu.lto_taskHandleSerial.part.0.180.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`\031\001-\r"
+	.string	"\346\230XC"
+	.string	"\2216\035\333\337\341\002\020*\200\205\277\352\037\200\272\305\243U\270\210\"J\\\033.\330\026\242\2405\315\002\366 A\016\343aq\033\365\277\244\025\210U\177\2661\blxT\372w\202\346\017\330\226\354-eJ\001A"
+	.string	"J"
+	.string	"A"
+	.string	"\273\237\202G\037\250\036\255\017\240\036\341\005P\217\232\307\233\260\375Q\261g\323\370G\332\314\207\031\242R\314\356^\217\n\342\3365\241\347\203\256"
+	.string	"0dxz\034fBv\327\225\206;\336\366\002\333\r\354o\b>\345a \306n\312\311\306v\2100D\034\346wy\332\267\217\342\343\257x\311\032\030o@>\1771\261\212\275\001\361\376bb\201\276M\331\220d\234\210aP=\272|\376\235X\034\022<:\323~\212\253\360\376\235\230c\327\203\213\027\001#U[\244\223\037\331\272\240 \247*\002R\r\321\215\277"
+	.string	"uMu\212VP\362d\237\305[x\374\020\256\300\345G\217>G=^_:$1\302Tb%\224\247\324\026+<\\e\261cZa:a\006X\2079 \341\036h\035VB\001\263\240up\021\264\016\007B7\242m[I\026\300\331\007'\302a\335\225I\270F8X\347\3126\356\372 `\017\211\266]\235\307\263]\032\333yeqHHQT[lw\344M\231v\323\004N\265\033z\033"
+	.string	"8g\340W\357\201$Z\306a\025\272\262\n\020\020\005\303\\\341hc\305\346*\244\316\023\257\f"
+	.string	"-\f\365\224\302b@\036\b\341\236Q\212:\247\323B\233);\r"
+	.ascii	"\327\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.part.0.181.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"E\t"
+	.string	"6\020<90\345(\035\2003\226\201\223\251X\244T3\207\002V\024=\022AD\233\271\311\327\r\311\036P\023\200`\233<\204\350\201\341a\251A\030\036\356\321U\211\315#X\264\375\275\345N))"
+	.string	"+"
+	.string	","
+	.string	"\266\313\277\220\315\244F*P^vw^*\310\275+\214\236_\272nN\032\207\234\307\314gw\255\331\270\345m'\330V\260o\005\252\356\037\251\323qpi\b\355\233\374\304\373Gr\300\356\207\312\312\356\207pi\003\315e\347\004\230\313\370\001\314\245uy\022\333\035\206\275\366feHhKL\300[\370\253oRN-&-AMY\343\343*\312\216\234\005\216\335\213"
+	.string	""
+	.string	"\326C\262\210\\u\373%\235\277\262\025[\003&\n1p#L\323\".\001_\236\355a\003q\363r\230\243\020H4/m\233\236\002g\020\2306\271,\323\246e\033^Q\376P\250I5\025\027"
+	.ascii	"8g\340\256\266\212\024\034\243\331\032\234\342\002\362\300\b"
+	.ascii	"W\214Q\023L\017\224B\\p\n\214\271\247\351\242\332\351\\\320\246"
+	.ascii	"\313\316\005\200\023\017\344hi\372\te\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375`\336\006u\024"
+	.string	"\326\236qH\300XM:<\213H\273\016p\234m\313\272-\013\216\362g\224\221\204\332\031\003S\323\b>\223$\364\016\371\307\376\233\242\370%J\372M:#\220\236\001\360\t\213\245\317N\357s_\302)a\241\024\206U\255\266\306v\323\222\244\035["
+	.string	"\\"
+	.string	"a"
+	.ascii	"+\220F\351\271W\360\334G\036\202\373\211\267s\031\306\243\271"
+	.ascii	"\221XJ\351\321)*e\255J\300}\304\337\355\304\323\271\301\333\035"
+	.ascii	"\225c\246\025\316])\bR(7w\223\230\231\254lnJ\240\306BV\007.\253"
+	.ascii	"\f\334*X\024\004\247\244\244\274\224T\222\034C)\245\266K0\236"
+	.ascii	"\224"
+	.string	"\262\205%6\362\341\216\341\341F\352p\207\034n\030\033n'\rwS\206{\t\206{\310\205\233\210\205{G+\334O\024\356 B\367\322\204\033\210\204\373G\204\333\007\204\273\307\203[\311\301\315\243\301\275\203\301\255\303\013\356\034Vp\343p=J`\026Aw\013/\347\032@\246\201\263\214\037\337X\371\330F3?3=1\237\330\032\264g\305K\026\246\027l\211l(\244%*\036\330\272\276V\347\222\331\221Y\233\216\353s\255\235\234\243\332\022\305j-\321\255\205\303Z\241\034\326M\314Z\364\326a\215\267\256\366\356\013\227*6\336\332\274(n\027'\356\031&\356\244\022\367\013\022w\222\021\267\022\0217T\210\273\b\210\0072E5\032={\332i\371\346\032\205.\240\364\324\345\233[$\026\325\241q\250\316\325\211\272p\254\211\265J\033i\341m.\255\212@sg\341\254\016\370\346\322\214\243L\314\315\225\205\262:\342\346\006\020G"
+	.string	"scu.\354U-\257H\221\332\335\346\266X\243\307o.\021n\256-h~i\252\232\022\013w\250a\030\f\311r9\005)u"
+	.ascii	"\003\021\242\2521\021P\024H1\253D&\224\230\241\017\360\370\267"
+	.ascii	"\224\031\206\214\364\254\030\275\233\367\036\303L6I!G6\222\016"
+	.ascii	"\351\351\006\bo\0032\260\001\231\013\371(+2\b\225ri\205#\375"
+	.ascii	"\331p\211&\024\n_\207\r\021^\004\324\231t<\025\312.\262\"]\263"
+	.ascii	"\216\b\357\356\314\240\326\3513V:\243'\274Z\311\261\365\314:"
+	.ascii	"\247\236Y\347\3243\033\335\346\256s\352\231\265\351=\016\247"
+	.ascii	"/$j3D\002\037\001&\271\003wp\371\031\236\210\236\314j\366Kb\b"
+	.ascii	"\356\200\027\037\026\032z_)!y\220\233\274`\0363M\320\214h\306"
+	.ascii	"j\016\343\334\016\337\020\374\f\202\177*1\267N\025"
+	.text
+	.section	.gnu.lto_.refs.68045de3aee0735,"e",@progbits
+	.string	"(\265/\375 \212}\003"
+	.string	"\"\b\031!\200\305i\f30\003s\tM\320\004M"
+	.string	"G(\321\210F\330#\370\266\3556!!m\352\177\267$SV+\337\202\037;~\352\306\214\235\237\247\027\257\025'F\354\207\245\346I\033N\003\n\032\211\024\022i\325\224j:5\205\230>L\033\246\013\323\005I`\234s\rv53\211\267\250\234\027x\235\227\370\251"
+	.string	"\001\002"
+	.ascii	"7\003Q\301\034\003"
+	.text
+	.section	.gnu.lto_.decls.68045de3aee0735,"e",@progbits
+	.ascii	"(\265/\375`Br\035\340\001J\r\223\254V \nQ;\035i\020\243\202\002"
+	.ascii	"\314{\003\340\241Ey&hp\263\033\006\315\006\201w3\315XY\026\340"
+	.ascii	"\244M\275\312\301m|v\027_4%}K\333\272\006P\264m\325V\255d\357"
+	.ascii	"\377\360\235\341:\313\332\237\207\231l*\226g9cu\213\300\350\257"
+	.ascii	"[n\271\345\2262\005\331\t\311\n\360\n\312\f,\366Z|y:\364L\311"
+	.ascii	"\325\260\232\234d|cO\324\017\r\203\212A\3770\023\005\203ry\264"
+	.ascii	"\013\352\005\005\203n\351Ii\036\200\201\365uyr\240VE\261\203"
+	.ascii	"\243\321_\343\307\261\025\316\331\030\266\360\257\241\302\277"
+	.ascii	"\346\t\377\032;\3765q\374k\222p\264\211sv\002\316\270v\3038;"
+	.ascii	"\177a\234\215v\214\263\277&\b\327Y\342\234\215.a\234\215.1\316"
+	.ascii	"~\022\200\"4\216\266\32023+_\250\330\330\035z\2062\301\3155\355"
+	.ascii	"|\342\274C\233`\301C\365P'h\036f\242w\250\235\336\241\267\234"
+	.ascii	"\222\321_s\203\177\215\024\377G\215<\312\344\037-\202.\321\272"
+	.ascii	"\214\307\372XX\326t\270\215\315\351\224\365\327\024\3618\364"
+	.ascii	"\b\312\304\315--\326\304\331\206\222\t\327\336\215\354\276\320"
+	.ascii	"8\324\r%\303\3155-\344\315\371\206\302\241K\3209T\0163\32184"
+	.ascii	"I^\361\237\223\320\356\276\3208T\t\030\025\301g\357K\0168\016"
+	.ascii	"\245\0378h\364\323\274\361\247!\343O\363\203?\r\017\316\374G"
+	.ascii	"\323\362\023\312\206U\250%grY\243j(\022\314\324\200\256u\033"
+	.ascii	"\334e\353\350)\353\247\301\301A\320;\326\260\361\340 \326\260"
+	.ascii	"\237f\212o\214\263\237\246\005\367\300\363\250\221\035\266\344"
+	.ascii	"\206\230\254\237\006\211\353%\316\331\277\006\310\177\211\222"
+	.ascii	"\375[~\302\245\352\231\365\317\360\361\207\3038\373g\252\360"
+	.ascii	"\r\207\016yT\b\272\266\214[\312:\b\n\005\310\f&Y\377\214\036"
+	.ascii	"G\201\240?\266X\337\2212\353\237\231\343?\243\306\177F\354\353"
+	.ascii	"\037}\201*Q/\315W\004\317(\353.\0326-HJY\377\214\216\035(\017"
+	.ascii	"\314D{\240+<\n\003\215\201\366@\245\2668{\240S\250\016\334\\"
+	.ascii	"\323_\370\234\275w\035\0168\260\351\341'\345\264\365?J\365\250"
+	.ascii	"\216\177\024\n\215B\271\206\232<\271\221\365\226L\326\222'`\326"
+	.ascii	"?\263\002\177L\266d\007\212\003\275\201^\241Yh\016\324\n\305"
+	.ascii	"\302LT\013\245\361h\r\264J\313\234\025\247\215+\316:\002d90V"
+	.ascii	"\320\031W\234\250\326\026\235\335\302yg\343F\377\f\024\307M\234"
+	.ascii	"\2637\214\341/\363\307Q\031<\217R%`\007\016\261\254\321/\\\265"
+	.ascii	"\372\"\205\277L\023\256v\234\263\337\351\306s\2328g\347<\214"
+	.ascii	"\263\325\345\020.c\305\305e\2760\316~\231(\216.\241+V(\031j["
+	.ascii	"Y+i\330-\330fT\311\372\327A\376\377\350\021\212\204\231h\022"
+	.ascii	"Z\204&\345'\332qs\215\004\271<4\t5\312R\204H\313^4\323\"\316"
+	.ascii	"k\352\331{\327\300\001\007\302\255\253.S[\377*\307\1775\343\203"
+	.ascii	":)T1\213\221\365\257>\370c=\300\262\257\300,\206\314)\230\307"
+	.ascii	"`f\016\314\177k:+\221\033aJ[\377\372\305\177\305\301\177\255"
+	.ascii	"\342\277\276\340\277v>\303\261p\032%\306\331\271\213\023\211"
+	.ascii	"\023\025\301\254\2377\341\217\231\231\213s&\210\027/p}\237\235"
+	.ascii	"\377\036D\3707\232\336\311z\357\033j\310\234D-e\235\257d\276"
+	.ascii	"\377_m\214\262\214Y\201o\313\n&mJ,k-C\310\344\244\262~\016\307"
+	.ascii	"\314Y2\226e\327\241Y\301U'$\353\347H\370\373\375\333\377\257"
+	.ascii	"8\210\022\"\314\254\237\177\361\34778\215\225\222\317S\376s["
+	.ascii	"v\313Rf"
+	.string	"\264\362\376\246\262\336\343It`\r\311\3729\024\177L\266\244.n\006\034\031\234Y\023\2369\273/#;'<uB\354\264\274\375\033n\256\341\257\272&\316\336\273\334\277\t\327\336\355\306\340z\357\377\237\235\344\274\334\314P2^~\222\243\344&Y\0173\363]f\222\3572\335\277\t\221\226\235\207\232\245\017\346={\357\034\314L\301-Y\301\240_\365\302_\225\302_\205\302_u\302_\305\343\257\332\361W\351\370\253r\374\3257\376\252\033\307Ix>+A\341\352\224\002\263~\225\214\357&\316\331\257\005\343\354\032\225\007\177\365\212\277*\305up\316\376\375\307\177O\341\034p\316^\3463UL\013)P\262\376\235d\271\213\360\337>\370\357-.\354\273\212\377v\342Be\030\207\0321T\216\302\206\254\360\237\205t\311x\242C\2315O\025\226\023\246\275[\341}\361\320\320s\362Le\2526g\237\3313'5a9\334\334b"
+	.ascii	"\031\240\023\351?')\365\".!\200\365\234\024\225\344\253\317\354"
+	.ascii	"it\304\243\374\317^\031,\353\310Z9+\373\310;2V\336\312\\\371"
+	.ascii	"+\363\310?r\217\f$\343\310Ar\016\314\314]\331\352\363\215|5"
+	.string	"\003\273\341\346T\002\304\234\344\244\334\225\245r\f!\322\262?\t\223X\3359\211\311+\226\234OPx\211\233S\035\335\322\3543\013\313/\224x\271{8\373\314\2366\2542\023\013\354&D{\257\022\374\322\322\002\256\317\354\251\367\317\223\273r\r,'4Zv\245\332\266\3543{\346\244\177\017\"\344\256\354\002\273\t\213\226\375\205\352\325\373\314\236\275/9\320\341@\246\352(I\240\006:[\341\234\235\001\306\331\237>\341\237\272\361O\211\360O\257\370\247K\374\365_\3172j\2321\2560\263~=\205\277\226\3130\260\323\227,!Y\277.\343+h\035\3745\025\177\335\304A\b\303?\340\234\375\350\035\177\264\215?:\204?z\203?\332\304\337\212 \177g\025~\203q\366?q\316\376\374\306-\310E\271\247hwbFY\347\376\313\032\324\b\206\336\333\240`F\272BK\313\372\3771 \036\203\0031\023\013\342\347c1\370\217"
+	.ascii	"X\020+\301r\350\022\216\257@\033#\210\227\3400\350\231R\002G"
+	.ascii	"\201\316\264\177|D\020\253\t:k:\223U\223\353m\205s\366K\3018"
+	.ascii	"\373\363\222\377\343\272\307a\376\361\021<\207\301d\253\bh\324"
+	.ascii	"\364\242p\311\332OgFJ\325\226!Y\177\356\301\377\037w\301\\p\037"
+	.ascii	"\346\303^\260\0233\361\027\214\345q\026\254\345\365\262w$\275"
+	.ascii	"'X\312\333\221\026g\357\3751\223-O\273&*\022\254>\002\374\363"
+	.ascii	"\340/x\n\276\202\236)9\022\264,\316;<\354&,\272\351G{|_\275/"
+	.ascii	"\037\223\375\363\374{\020\001\177\301y\330\r]~\365\243\2758\004"
+	.ascii	"\340\250\223\373\361\354}\251\303\301L_\216\032L\204\3721\027"
+	.ascii	"\376M\234\263i0\316~\354\204c*\270\nfr\300VV\244eO\353}i\263"
+	.ascii	"R\361Rc-\353\307t\3741\207m\303a?^\303{8\r\t\027`\326\217\301"
+	.ascii	"8nb(\230\211\243\374c'X\357\265\021\253\236\326{\257\231\311"
+	.ascii	"\202[3\312ZE\357\275\343\247\333\352\340\340\340 ~\272\375X\213"
+	.ascii	"k\214\263-\3009\373\261\024\177l\304\177\r\347\354G\301\037\016"
+	.ascii	"\347\354\267\3039\033\323\361<\256\303\331\312\251e_\353\275"
+	.ascii	"\333T\220\204..k\025\343\354\037\362\335q\316\306o\030\01637"
+	.ascii	"\300q\217\223\340\264O\215\226}\331\373\322&\357\030\303\206"
+	.ascii	"\226\365W\200?\336`\243\203\203x\203\375\f\340\031\343l\214\004"
+	.ascii	"\257a&\005\270\355=\210\360h\221\021\233\032A\"\202\200Y\377"
+	.ascii	"\007\376\230\355#\210\322Ex\r\3741\005\033\017b\n\366s\376M\214"
+	.ascii	"\263op\316\376\307h\033p\244\2716\262\254\377\261\021\274T\307"
+	.ascii	"\352"
+	.string	"\260\326\262\306\313\214\213\340\263\307Kl\366\036Dx\032\244N\326\373\022/u\357F\030_ \304\370\202\224\256\207\021\332\326\237\371?.\373\307c\230\214\002t\251\311\252\257\365\276\264`\263\204\341\204#\353_\342\234\3151\316\376\327jiY.\203\023\376\265\006\202rIW=\366\377\033.\270\371\347!\320:\275\225\362\377G!\313I`\200\177}\224\276\025\206\016\334T\375\377\r\322\375\377\352?W\341_\273\253\007,\244\351\177\252\377uO\321\3774\377k"
+	.string	"\244?\370\257\005\003\3775`\230\177\r\306\357_\177\361\362\257\273\374k\t\372\3765_\373\2579\360\257\331\177}\342_\367\374\353\342\277N\376\353,\377\032\313\277\326\300\277\306\300\277v\361\036\376\371\225\177\224F\225\177\035G\345\037%NA5\370G;\374\243\203R\360\006\377\230\303?\356"
+	.string	"{\330\373\327=\242\374\177 \224\177\255\344\037\255k\326\241@\377\277\001\306\360\377\203\377\217\302\377k\360\217\216\371\004\374s\0239:\353\037\235{\3624\377|"
+	.string	"\312,\367\351?\217\340_O\340\344_\203\375\277\025\275\227\371\347\"\374k\001\344\375k6\274\377/\222A\t\377\272\306\335\177\226\373\365\237\007\200\243"
+	.string	"\343\333\232\374\377\206\377,\3675\377|\202\177m\201\335\277\346\300\344\317\262\334\317\374\363\005\374g\271\317\377\034\347_\327\375\353%\377Z\356_\277\375k\346\277V\373\327i\377\332\310\277^\376k\037\377\272\353_s\375k\255\177}\365\257\255\376u\325\277\206\361\257\245\3765\324\277V\376k\027\377\272\351_\263\370\327K\377Z\351_#\375\353\376\257A\360\257?\360\257=\360\257U\374\353\024\377\372\375\327\b\370\327\004\370\327<\377\272\303\277\376\340_w\360\257\007\360\2573\370\327\032\374k"
+	.string	"\374\353\013\376\265\004\377z\303\277\216\340_c\370\3279\377\332\302\277\266\371\3275\377z\346_\257\377\250\213\177\215\376\177\334\277\306\377\350\340?:\346\037\r\374G\001\377\321\277\177\364\371\217\206\371\377\"\377\250\337?\312\345\037u\376\277\225\177\264\356\037\235\373G\345\376Q\265\1774\356\037}\373\317r\377\277\301?j\343\037-\376\243?\377h\b\377\270"
+	.ascii	"\377x\204\177,\302?\376\377\027\374\177#\377\177\366\377d\377"
+	.ascii	"\237\201\377\307\373\377\233\301\301\301\301\377\264\351_\007"
+	.ascii	"\347?\205\250.\262\376\rU\370\337\006\024#\303%\307\025\217\254"
+	.ascii	"\177\303\334\237\030\341S\033\226\267\347o1|m\215\317)\314\377"
+	.ascii	"\257\250[\334\226\2600`r\24689\367\030X\030!~\373K\227\271\272"
+	.ascii	"\236\365o0\302\177\003\030\377\337]~s\231\032bv#\353\355\314"
+	.ascii	"HPQVd\375\033\252\370\377\373a\346\356K\347\264\226\272\301\300"
+	.ascii	"\254\177\203\013\376\277\267`\271\035#\t\260-\353\337`\304\177"
+	.ascii	"\202'\377\337X\366\225}e[\331S\204\354\261p\312ZwM\331CP\262"
+	.ascii	"\275e\317\354\356YcO\331B\274\230\335=\251\354*[\312\336\303"
+	.ascii	"\314=eCy\255\334Q^gO\331.\266|\365\276\334S\266\330n\026\251"
+	.ascii	"I\320\314\356\236\275\3675\313-\312\225\214\236\231\340\215?"
+	.ascii	"9\022\323\365\314\372'P\343(\324\226\233\303*\242{\240gJ\336"
+	.ascii	"\226\3444\265\225\240\r~\365\276\214[Q\226\346\3400w\244%'\267"
+	.ascii	"\337\212\354\311\351,\274\244\300\236\226\\\030>\262\345\266"
+	.ascii	"Y\234\227\262-\247\221\3500\037\224\224\020\310br\366\336\267"
+	.ascii	"\\j\225\272\205P\004-#\375\343#c\233\f"
+	.string	"7\247\272QQ\bsQZrO\261-\267\317\216\260p:\331K\366\335f\262\355\266\336\306\333p{n\327\355\270\235\267\233l:\314\334r\333\310\357\260M\344u\310\266\\\032c\263\035Yr\242b[n/Qf\334\017!\032\r\270*\025\350\237`l'i\3531\205\306\222\254\177\002\255\355\266\333\362\336Z\267\262\231\277\3336\226\242\272\277\275&\f\204\021\347\225\365O\360\264\221l\265\234\004\b\223\333>\362[\215\346/\317\211T\326\357\267\323\376\177\025R1{\233\313\372\177\247m4\241S\224~\265\321\266\221\025\214\2251cY\377\004K\374'(\342/\301\037\177\t\270\360\227@\n\177\t\230l2\267\r\364\b,\334)md\375\022\300\361\227\300\215\257\370\b\177\tv\360\377\035D\307\2131+Yk#`,\320\026Lg\357\035mB\235\330\250T\311S@\030\273\3415\365$k\222\241\323n\204\241D\320&z\246\204"
+	.string	"Z\217T\271b\313\t\005\225\302\203J\2662\366\224\321\322\342\274\246\236\333\005\226\023\032\335t\244\243\027_\273\306\306\261il\031\033k\353\330P;kS\355\251\255\265\301\366\216=c\333\330U\373\307\366\261\2456\214}cwm\036{\205\335c_m\253\035\265cl \333k\177\355\034\233\0133\367\326~\361[\271\237\234\360\225\037E\314$y\nz\246\214\300\021\236\032\22220\"c\200\316L\226\213d#!\224A\361\232J\225{k/\375\340\3425\365D]\370@\207X0\244\310\210io\3450\350\022z\246\224"
+	.ascii	"\226\022'\030\224){\371@$\316k\352I$\213\r:\313\212\334\360\232"
+	.ascii	"z\346/{+\373e/\037\224\224k\0134;g\332\232\002nxM\205\221e\263"
+	.ascii	"\"O^SO\262\275\365\3445\365\314I{k\267@\311~\234\241.P\2601\347"
+	.ascii	"\336\332J;\351\203\222\022\002h:\234\250\213\275\205>\241_P!"
+	.ascii	"\f\201\262Y\374\210\363\232z\222\355\255|\244\354l\313\340\303"
+	.ascii	"\"\033\241\237\313\022\347l\341\024\306\331/\001\016\376\022"
+	.ascii	"\304\340/\301\022\177\rb\370kp\362\327 \205\277\206;\376\032"
+	.ascii	"\222\360\327\020\204\277\006.\276\221\306\3441\241\313\3725\320"
+	.ascii	"\340\273H\267H\307|PR>`\217\211\312\357\"\364\212^"
+	.string	"B\317\224\021\330c\341\334}\033\355#\314\334E\251\340\243Q\320\275)\273(\035L\347\236>\200\201-\263P}\231\302\365kx\301_\203\021\017\002\207\204\215I\326]iS\233\241L\241\321M\357Xo_\275w\335\245\313P\266\020\306\216\356p\340%\272\374R\325\260n`\267#|$\355\337\222\316< \362\203L\277\230{*Rd\251\317\236B \262\2276\323$\351\023\364L\t\201\243>g^\221\217`\321\312\264\251\237\364TT\006ehZrO|\004\315\315\331{\177\246JFW\t \022\305\344\312\313\262\206\016\335c\fKKN7\245\315\314\326\215\212>\224\355i\311=\263\3602\20314}D\253\245M\215D\207\331p\264\324;T\006D\260\264\344\260\035\326\330\236\226\334\323h*\255\201\345\301\2209-9]#m\352*mU\026\265L\2251R\030\037\224\224\253\213=3g\357\313fj\225\272}PRF"
+	.ascii	"kL\327\320\322\\{xN\335\245\2754\031\026\207\261(-\271\247V\246"
+	.ascii	"M-C\323\200\002\241\354\207\226\334\023\205J\233\332\bJ\206\236"
+	.ascii	")G\354%A\313\232\351\212\364\305\007%\345\372bo-\375\222nI\303"
+	.ascii	"\244]\322\275\324Kj%\025\223\366\245X\322\277TK:%\345K\245\244"
+	.ascii	"\200i`\352\227FI\271\244\3174K\352L\241\244`\322*\351\225\224"
+	.ascii	"\nf\246M\364\307k&\315b\206\210\221\363\305\001\264\023\033\031"
+	.ascii	"WUyY\277N\230\273\264I\212\227\346af\252\2272y\355\244]\274\326"
+	.ascii	"K\351\322:!\322M\357X;R\2754.\235\343\341\354}\231\352\245v]"
+	.ascii	"_F\251^\372\226\302\341\346V\357O!\004\231\323\222{\366\336S"
+	.ascii	"/=\322\250\310\350"
+	.string	"\327i\343\257\263\254\373\317F\351\222tN\006\027/hY\277\016\021\236;\316\331\251\034\215\021\f%P\262~\235/\376:9R\270\377T\231*A\231\370y\007DH\326\257c\305Q\235\031<m\263\301\221\303hJ\326\257\323\202\337H\267\320\345\327\210#\027N$)3]\303\314\224\355\331R\256\264\354\203\222r\002GNN\266T\355\3636\034-u\243\033 \200\375\t:\265\332V\023\033\\\177\004p\374\363S\020\r\270\271\305"
+	.ascii	"\037mzbD\234iY\252#\005\262\341h\311\004;\267!O\267\366ED\314"
+	.ascii	"\031\306\0017\327D\300\221\245e\351\330\323\t\221n:RWXZ\226\n"
+	.ascii	"\321\260\271t\374\375=S\264\364Hj\226\032I\227\351Y\232\226\026"
+	.ascii	"\301\314\264,%K\325\216<\001/\350\217\240\005\377\b\220\370g"
+	.ascii	"\b\344\237\341\013\377\fY\370g\220\302?C\036\377\fr?\212\372"
+	.ascii	"\242\274\310\3723\234\361\377O\277R0\314L}\244<v\244]\302\"\013"
+	.ascii	"\275\343\330\362\225\372H\275\322\256\013[\260t\251z\242J\262"
+	.ascii	"|9\262\365g\350\374?\355J{\314\b\226\325\020L{\244<\204f^M8\262"
+	.ascii	"\376\034+\374s\240\360\317\271\343\2373\307\377S\254O\267\376"
+	.ascii	"\323\252\324F\232c\003lLx+\262N\263R\255Os\2448z\232#\004\253"
+	.ascii	"\336\215\322\0346\201\275\033\331`|\001\306\027h1,/\346\326\237"
+	.ascii	"\243\204\247W<\237b%m5Ae\275\001\306\331\237\203\204\177\216"
+	.ascii	"\021\236\2278gs\3008;\245A\225\f\302w#\353\317\3411\203\n\325"
+	.ascii	"\341\274\362%\343S\252\242,mUr\262\370\347Tq\251t\205\2505\310"
+	.ascii	"\nlZ\262\376\234%\251\250\225\n\231\0220P\237F\241~UZ=X\024\231"
+	.ascii	"Z\341-\353\3070\206\203\200qv\352\002\003\001\304\260\307\037"
+	.ascii	"3S\247\264\tI\214\021'->mZ\3421\276\2750Y\247L)\013\376\365\242"
+	.ascii	"(\211\005\020;<A\252ti\3452\345\311V\272\204\262e\201)\031\313"
+	.ascii	"\3721\320\361@\035\024\t\022\221\254\377?E\302\3144I\213YK\223"
+	.ascii	"\364_z\304&\267\367\205\2463\211\211\323\372?=J\215\260\013\027"
+	.ascii	"\316\245\254\323\2425Oj\205&Y?\006-\376\257\00713\355|\034n\374"
+	.ascii	"\200\312\372\375\264\340\377\2579\307\224\276\277\254\365\030"
+	.ascii	"eG\"#\353@\225\357)\212\221\254\037\203\024\007\324b\362\r#)"
+	.ascii	"OY?\206'\3768\203\374q\376\300\344,e1\324\262~\034>/\372\013"
+	.ascii	"fj?\235\344\365\021\255\206\244\3754\233vS\257t\361\323J4\027"
+	.ascii	"\334\234\272\351H|c\260Z\235`\227\255\243h>-_N\335\247\273`\246"
+	.ascii	"\346\362\232\213~\323v\302\"\013\275k\005~q\321M"
+	.string	"t\023j\367\031\211Ii\340\200\203\231\246\254\032E\\k\321[0S\363\351,T4\026\334\234Zv(a\333\225\230\024\237\336\323S6\034-\221\260$\213\223\317\351X\302\265\365\343D\341\377\032\313\025\246\267\037U\252h+2+L5\227d\3758u\274\312c\027`IxY?N\022\376\230\371[\264\224\347\323;\362`\224e\3758k\374q\316\370\343\2245\365\235\326\303\3155\021N\370\234O4\024\314\324M\355dMO75\334]\237S\350\365c\254l\353\307\001\343z\b\022\022\275\254u\236\306\253\341\253A\007$\353\307\311\301\037\307\212?\016\r]\247\231`\246\266\323t\237\223\364\332\353,{w\323v:N/\331p\264TB\325\237S\333i\270\031/\037bRO\025\207\\\021\035[\377\005.\374_/\321s2\226\222\004.S&SRzh9\235d\006\013\213\316\227\365_\300\302\377B\024\376\027\232\360\277"
+	.ascii	"\307\377B\032g\3526$WfaY\377\0051\346\005\037\034_\350\342x\211"
+	.ascii	"s\266\016\306\331\177a\213\377\005\033\374/\304\340gFp\201J0"
+	.ascii	"\262\376\013H\034[\020\303\337\302\026>f\023U\003\311R\326o\301"
+	.ascii	"\216?\001\320"
+	.string	"3\355\003=Srf\216.\247\016\323b\230\251\211\350\037\232\210\006\242\207\340\346Z7\212\312\300\257\313\0162\035\016j\230O@\030[\007\321BlZ\364X\261#\353\267@\025\304\302\013\3767\177\374K\203e\250#:\370\276\3608Vb\234\275C\363\300{`\376\230\334v\030\3419\364\026\272T\322$J\326\177\003$\307\315\026\377\233*\3767J\3767G\374m\234\374m\232\\\333\3200\364\262\272\262~\033;\3766L\216\2550\316\3263l\232]uJ\262~\2331M\325\025\003HR\021 Y\277\r\025\377\177\275\002fj\030\032J\303\320QZ\n7\327z\177\362\200\310S_\227'\236\201w\364Dk-E\006w\005*H\326o3\305\337\006\211\277\320\217\343/)<]\342l,\314\3438K\234\263s\030\306\331z\305]\225\246\032Y\277\220\251\217t\327F\302\265\367\2531_\372\b\325\202\216\021\013\324G\250`\357"
+	.string	"\3465\025\246\225t\222F\302L}\204\016>Z\005\265\242\203\001\334\327\222\353\247\323E\\L\212\270\262~\241\021\376B\037\374\205V\374\2054\370\177V\202\005\315\202\006\246xE\246\340\262\006\f<\362\002\226\365\013\245\370\023\300\311\323\367o\350Y\353\233L\322\030\031\013%\277\276\255\215\371\201\226\365\232De\322\304\310\213\031K\032\026PsUY\177\207\270\265\265\225\211o\226GX\2568yP\361*b\373\225\271\n\346\r\241B\242\246\266\304I\207s/I\002\310\227\365w"
+	.string	"\222\226\306\271\304\234"
+	.string	"\225a\374\311\335\230e\326\337\341\205\021#)\232\366\002\261\200\210\t\313\372; \001\001\262.e\276\234\302Tq\031YxFE~]\332 \035\331\tf\275\216\255fZ\316\264\"Y\257e\305\033C\244d\375;o+\331\032\266\212-1\262D)\353\225\2103.\257iI\326\277\023\306\337o\035\242\324\303\213.\353U\210\037\027\327\217\254\177\007\213?f\256A^\365\353U\200<\263\376\035\250\257\257\325\207\032\330d\006\006\025c\242b\003\354W\037;,\326\035\353\216\265\353\217\217\214E\217_\273\250<\263"
+	.string	"\263^y\250LT\031F\\E\037"
+	.string	"\256[\353\326\312E\265\251\234\370\3008AR#o\345\272\202eH\323+\353\377"
+	.ascii	"\016\307\343X\265t\254\212\374v\027\247"
+	.string	",u\317\"\177Q\312\326\254_\265j\374\2164\315>\270\272\272R\253\234\260(s`5ae\375\036\364YYA9\351p\206\345\031W\302\300\315MM\255U\"x1\273\323s\321\344\254\306\257Uj\222\026\240T\326+\215tN\210\337\037\334:\303\350\210\013\347\214\225\312\004$M\274\250\3214e\211\362\267\312P\3114\240A\242\362\224\330`\300\340\\]_8\253)HY\326\357\301\017))\316\204o\226G{e_4G\220h\221\222\365{`\003\n\212s\025\240\331gf3f\224'\225\365{\320B\251\304J\247\"b36\200\030y\312\372;\220s\341B\310i\314\251V\305\275\221e\375\035p55m\030NbB\264\\\220\242\2531,X\314<\235\206|\tY\354\245\371p\262\264\244\200\336g\026\2666\217\356\242\262~\016\322V\245UI\004\270>\263]C\211n0\353\347\300k5Z\215V$l\244\277\320"
+	.ascii	"\303\311\307\035\037T\242\344h=\372\025i\257\b\025+W\376\177"
+	.ascii	"\335N^\004\376e\375\034$\255}\355\274\t6\322_`\320\213\352\373"
+	.ascii	"\362\334S{Q\250\302\b\nn N]\201a\275Oq\230\351Y\203V\262\376"
+	.string	"\001\270q\036\310\0039\323\363K\306\350\007\2141\262\277?'i\332\022\030(]\317'g\302F\372\013l\347\244\303\031\206\006e+I\326?"
+	.ascii	"&\016\346\301p&\035\253\"0\3020'-'\252\334S\nf\375\034\376\370"
+	.ascii	"c\"\230\227a&/\343_\360S\357FS\031\004\225S\035\340\253\276\026"
+	.ascii	"6\316\236\177\371\347f\274\b\367Bc\023\003\017L\230\254yX\312"
+	.ascii	"\003\307T_\326\217\311\334\360\234l\274-+\317i\344\357\253\t"
+	.ascii	"\370\225\226\316e=\277x\037w\362*\234\217[\341R8\024\256\205"
+	.ascii	"s\341]\370\025N\205g\341Q\370\036\237\302\261`&\337\362\217\212"
+	.ascii	"\361'kz\3169\336\3065C\303I\313\351\004\312I\313\371\314F|\013"
+	.ascii	"Or\347\324rDiJ\237\263\fM\214\223o\341J\270\\\225\223\2263\254"
+	.ascii	"w$<\256\207.\301z\307\241cF\312I\313\371$SK\347\216<\251\343"
+	.ascii	"wn|\013_\302\351\222\2228\365\370\026\216$\235\333\300\324\373"
+	.ascii	"U\325\f\231\223\226\363\331\373\322\204\023\215K\006\3729\240"
+	.ascii	"\361\224\203\030\377\347z<oLJ\213\307\032\007\030d\205\254\237"
+	.ascii	"C\027\377\347w\274\t\206R\207D\211\333=o\202\001\265\037]\262"
+	.ascii	"\346L\322\271\246+\271\252\254\337\217\267\005\301\261\003H\326"
+	.ascii	"\317\001\007\377\347t\234I\260\313\221\270\254\237\303\f\376"
+	.ascii	"\034Zp\376\306\3410S\207\307-\311z\3576\372\350.\212F\326\317"
+	.ascii	"\001\211\207\240c\235\375\203Xg\377\006~\3747\230\302\177\003"
+	.string	"&\2343m\230\370\331\200\313\3727h\343\277A\020\376\033\340\340\277A\024\377\r\222\370k\240\205\277\006s\37450\343\257\301\016\316\227<\317\317V\266?-&Y_\3008\373\237t\234\263g\234\030g\277\006YA\202\3601\031\023\220\321\340\240\271\202h9\342B\236\217q\261%m[\270\262\376\347b\234\210\022\220\301$Y\3630\255\304\006\324\224\254_\203*>\304\217\003\01350GY\277\0060\370?\377\361\230\311\177p\244\250\f\360\366\372\276\004\326\020\323%\353\327`\005\377\347`\217\231\034\214\033\351\030\351E\352\033\226\331\035j\345\254\031&\353\327\340\210\377s\257\307L\356\305;\272d\325\237\022\020w\3465%\034\303\264!%\353\027\200 \377\347=\0363y\017\025\220\004\253\036e\001\330\262\317L\373u]\035e\375\002\270\302\377\371\216\307L\276C}j#\275hf\n\023\324\335\263\367\251\0166\232\013,~Y\277"
+	.string	"\350\266~\213s\341\336{\237\352E`\204]\2468p\246;!H\262\346\022@\033\026\317\302\342ZZ8p\310t\021\343/\200\253*nU\305o\334\260aC\265\023\300\023\377\f\304\310\3403dp\032\377~\317i\244Q\200t1\263\246\2422\232\021\222\001\026\376\031,\211\021\003/u\254\212\270\200\320\245i/P\250\306D\213\312\3723\020\022\305W\210\342L\273w\274\264z\241\224\222\342L\274Hh\226\301\026\377\f\242\236\236d\352\232\304\340\236\200\374\237\277`\362\027\330M\307\252\250\313\005\312&30\317\336\355:\260\001#\244\306\216\254?"
+	.ascii	"oNN2e-Zp&\336{/Z\366\027\302\257&1\270\260>\245\344\360\001\310"
+	.ascii	"\301\237'q\245\347+\236\257\340L\177\323{?\352\275\252\206*\244"
+	.ascii	"I\f\356\331\247\2448\374\363\245\347L\317'$\243s\212\231\373"
+	.ascii	"\377uH\247\343\231\365\007`\005\377\177\374\371\177w#e\357\035"
+	.ascii	"*]v\345\021\315\376\307\217S\2149\374\327`\024c\360\377\372\237"
+	.ascii	"\347\211P\357S}a\275w\374\205\377x3\232aA\217\240\367\376\264"
+	.ascii	"\204\324\213\360R\332\325\323R\332\225\322\302R\336\325SGz\n"
+	.ascii	"C\272\262\302KHWJ%R/\262\320\323\256\224K\375\352\351\246\247"
+	.ascii	"\365\030KiFEx\t\251?\365~\325o\372\222\321SO[*-,\245])\227\322"
+	.ascii	"\256\236,,\245\031=-u\253~\263\264"
+	.string	"\304\241\354\313\253\"\013-\322\214\236z\232\325\223\205\236v\365\264\264G\004\212\016_ \226S\025$\260<|c\t\251\273p\242a\244\274i.-\255\272\225\336\361\232RW\366f\357\030\364N\303Ji\305(\006\206;j\2728r3\262\302\313\336\273\006\247#,\253\216\324,\302\275\271\004\304\252w G@\335\251\367\336C(Z6;\027n\026\341\240\321\233\224z\227\240/{w\352\275\b\367f\357\275\250\367\256*i,{\247\272Y\372rr\352}J\307\251\323(\212S\352=\257a\201{ZJ\303\262\342\211SK\373\352+\226Ex\251\311\252\177u+WJ\236Vt\326\233z\357\330\013\377z\212\352\2225?Z\322\342Zf\375\030\304q^\324\227\303\305X\326\217A\033W\0073\224%eMY?\006i|I\326\373R\270\205\360X\021\2275\037\002\226\0030\353efR\345\345\310Z\375{\035\327\267$$\353\307"
+	.string	"\b_\316\300U\261I\251a\334\256\bA\222\365c\220\305\275xQ\375tx/Ck\341\354}\212C\r\323\026\026i_^\365\263\t\374\223b\244V!2\246\212R\326\217AT\027'\215/)\203\257\332\275\235\352|\024\251W\325\330RM^\177\317\336\2478`\2566\261\247\252\345U\247\332wD5$F\326*\2370IR\237\230\254\377\002.\352\026\365\212\232\205H\2146\255\254bA\231Yc\366\262\376\013\240p\325\212Z\305\013,\211\213\254\325(j\225\025n\214\023\035U\250\020\301\373B#\353)\034\300\312\242\227\365_@\307\245\250{\034JJ_\312\372/`\343\357\247BQ\353\264\324\241Aiji\261\255e\355D}\242\307]\214Qb\222\365_\020\304\211\336\tUp^\324\274W\365\256$1Ee\375~*\336\377\2572T\260"
+	.ascii	"6\361\356"
+	.string	"\222\376\356\322\262V\357\324&UYTU\262\376\013\266\370_ \305\351\324\272\002\364\275\257\254\377\202\026tK\fSC\\\314!Q\375\244\260\335\305=f\252q\352\033\t\334\231\336\320l8{\237\352`\006\017\220\r/\353\267\300\311\377U8\365\215IdnK\326J2\006\023\306\214F\326o\301\035\177\254\245M\025S\221\240K8\256\004\213\206\263M\275\241\n\301\362\340\307\017\263\273g\022\325MeS\327T&f\252m*\0217\265M\r\373q\224\325\266\331\017,\263;\036\265M\035\"\203\203\255&I\344h\264Z\032\036\025f\317\372-P\343i*\032f\252GT\262,\325\b\272\204\343oX-\234G\324+u\f\213\305\227L\027\035T[\237\351\324\344\260\nb#\353\267\240\213\027\021\374R\227\252\031f\252E\324\2624\265\210\272\245_\314\231\335\205\241b\322\364\234[\277\005T\374-PR\307\322\242\232Wdd\375"
+	.string	"\360\302\037"
+	.string	"z\374\001 \307\037"
+	.ascii	"G\202h\240a*Y\211y\371P\177`\246\nD\305q\245b\341\346\026\tb"
+	.ascii	"x*\0205K\005\303\315-\022\004\363\234:\210_\021\277\255\2772"
+	.ascii	"\r\213gY\326\017\200\025\370\377\253]*\017\265\207\272\0033U"
+	.ascii	"/\225+/{_\323\361\226\226#\311\227\026\312\246\344K\365R\267"
+	.ascii	"P6.\2640Nl\230\256\252\270\310\350\257 \n\377\n\324\370Wp\306"
+	.ascii	"\277\2021\376\025\f\341_\301\027\377\n\250\370?J\365*\026\266"
+	.ascii	"\352\021\b\243\216\204Qe\375\025\300\340_\201\013\376\257ZQ\235"
+	.ascii	"\305y5\263\346Q\251\324\026:\274\354\300\036X\317I}\261\245e"
+	.ascii	"\257\230\342\345\334|\273KV\227S\205\241\322Pg\250U\352\224\032"
+	.ascii	"C\265\241\256\240\326"
+	.string	"Pe`\246J\265\277<Z\246J\275\216J\245*\325\250#6\306\250GGx|\251H*\213\244\035N\252\235\345\267|PR\256JS\302T*\265\211.\252OG\351G;2h\335q\316V\241\204;\276\370\254\262~\n\266p\365\211\202(\\u\301W\245u\227\365S@\307\237\2024\376\024\f\341O\001\227\312\244\233MH\006\263~\n`\250K\352\n\2327<)Q\252\322\253+\344f\304xi\301#k5I\323pc\241\224\365\373a\267\377_S,0Z\336\262~\nX\250F4gM\300\301\254\177C\030\265H\3552v,\350\226\366\340\253\335M(h\205D\020\277\335\031q\t\372]i\326\005o\361XB\r2I\364"
+	.string	"\034\013\256PE\t\241\025\304\205\007\332!&;\020}\\b\211\233\242\221(3l\207\354\313\212\020rO8\"%\320\276\354\220\221M\341"
+	.string	"!7(\202\f\311\227\304q\204\220\033\204A\310\r\272QQ\270,\nmR\370@;\354\td\222=!\363@;\0356\270%\264>7\017\264s\301\215k4\"IL@$\262kK$\221\343\272AI\326\b\002\247\350\"\205\202\212\257\353"
+	.string	"\242\004\017\264\243\002y\242\003\262\210l"
+	.string	"\262x,\n\t\037h\207\002\227\025\nB\022k\036h\307\025\372\351\200,bp\205~\326\020\032*\360@;\035\210>@\304\227\025r\213=6(\210-P\b\025\311\232\007\332\031\n*v\320yA\f\005\025-\b!\221&\364\024I\330\374\034\213(\\\266M\"\211\035\210>\017\350a\221&<\320N\2625\016\365\264@D#\373\"_\fm\020+\2016\210\225"
+	.string	"\n\227E\341\304\220;Cl\201\210+\36184\302M\241\307f\013\211\336b\022YL\222\260qA\274\3036\250\370\316\274n\373\262&\270)\274 zZ#{\374)\232x]\326x\363\202\350i\223E\267\025\361\272\254\261\206H\024\242\375a\223m\n\020::\354klE\004\r\231\3709\026S \2030\020[\025\016P\301\006]H\337!\n\227}7\n\227E\341m\177T!\221\310\242\310$\321\217\306\200\363\026\217%\254\307\"{\202\212\0227Bd\222m"
+	.string	"\320N\321H\354P4\022{\220'\024\215D\265\006\204\2357\311\n\355\240\200\302e_\f P\270\354\033\301\003\355\020\207I"
+	.string	"\270?\254q\304\317\261\030\224dgP\270\354k\241\355\031z\213\257\021D\373\262\306!\242\221\r\201\302e\337\234\317p,\262'<\261\230l\217\355\017\377\020F\370`\204\017*\324\377p"
+	.string	"\020\016"
+	.string	"\302\376\017\007\340\3419\300\b<\374G\340A\337\367}\211\214Bm\t\013\017\264#\344\006u\020r\203\332\241\220\0334\363\016\223\310W\250\230$\272\255\b!7\310\346u\207o\213\202\310\222\020r\203^\027IB\310\r\302q\2074=G6(\b\031b\204\220\033\204\323\016{J@\341\262/\017j_\227\310\204\004\357\353\323\366\f\337\b\334\241!\020\361-\222\3509\2020\032\221I\234\013\311\366m\203\2209\036"
+	.string	"\032\372\b\031\337w\350\323\366hx\240\235\236\366m\215BA\310\020\030\334\t\214FdR\003\021\337\242P\252\002K\204\272\355\220\221M\261\207\206nP1\211\202\210\034\025\330$\212L\266\031 \022\331d\007\025I\234w(\323\n\021\241p\201\022&h\220I\022*\22274\355\313\226"
+	.string	"r\333\244O[BE\262&\371\2228\252\300\226H\316$_\022C/\373\232H\276$p\334a\373\262\257\2116\250\370\036\207J\250H\336\034G\270nKD&I\020\2237o\373"
+	.ascii	"b\362\302qD\020\233\034AL\332\260/+\302\330\036\217,\020q\206"
+	.ascii	"}Y\021m\020\233\364Y\037h\2475\266D\"\213\201;$\022\331\364%"
+	.ascii	"\266\311\241\f\221\b\002\003\221\310\362\007\360\f\211Dvo\"\221"
+	.ascii	"\345D\"K\323\366 C\244h\2234\311\326h,\372\354\024m\017\032B"
+	.ascii	"\004\b\"\221\335-\3618\201\327e[\023^\020=)\030[\"\021\204[\324"
+	.ascii	"\340\016\221I\242\237\375\266?I\366\025\266A\305W\b\2114A\350"
+	.ascii	"\023B\004\210\231\240!\023\253\005zZ\343\t\366\350\200\243\n"
+	.ascii	"\310\236\bxP\240y\240\035\001\244\356\020\351S\034\261\337\241"
+	.ascii	"\233B\033T|\271\233\302\353\266*\264G\356n\244O\321G\2776C\365"
+	.ascii	"\201v^\342P\362u=\270C\025\355;\024d\001\005\021i\034\016\367"
+	.ascii	"{\034B\022\207C5\331\036U@\016\207\252\233l\335\241\343p\310"
+	.ascii	"{\216E\024\303\341v\217E!w8T\217\310\242[4\266\303\341\372\016"
+	.ascii	"_\267h\274y\240\035\267\025\"z?\350i\223,\220\373A\007\367-\236"
+	.ascii	"\3500t\374\371@\305\320\261h\374 \204\021\206#|P\321\241\355"
+	.ascii	"\0312\022\217\305\016Iw\250\203\001^\025\355\321\310\036\223"
+	.ascii	"\355{,\016{\3306\t\364\n\r\207\021\244h\223B\303\341~\335\242"
+	.ascii	"q8\334\354\313\366\f\207;\311\002\021u\353\201\242;\034n\024"
+	.ascii	"D\244Q\277\305c\to\361X\334\307\355\346\034G }\212#z\3306)\223"
+	.ascii	"|I\020\217C#\330\227\025\321\303\266%\220I\242\007h8\216\250"
+	.ascii	"y\240\235\342\253\242M\266\306\236#KB\361U\321\342\274G\237\354"
+	.ascii	"\016\211m\t\024D\366\204\321\310\206(\276*Z\013\305WE\253_wX"
+	.ascii	"\0242\341\323\212h\205\210P\030\226@"
+	.string	"\302\304LK<\262\257{,\362w8\201\022\364\261H\342\350\022wQ\310E\335a\b\017%\314\204\360P\302\272\211\036\212\350\003\355\270C'4\270\303\023zn\222\355\353\262A\333u\333dO\017\253\266)X\243\211!\241 >4L\321\366\270C'\270;l\211\305\024\255\bw\350\304L;l\205\210Pp\207N\254\255\020\321\353\016\235P\335\241\023hkd\211n\212L\266\031\340!D\200 qA\005\266D\b\0212mr\350e\223\255PP\373\316\274\017\2643$\0244D&\211~\210D\266\203\233lS\024\223=\003h\207%@\020\001\204\021\206\204\202p\216\310\342;dD\272mR\306\035bh\207CBA3\257q\310mK\264\"\206\204\202.\264\303\343O\321\310\016\205\307\237\242\021\304\260\306\003$D\240}\331\022D=l[\202}\331\2365\351\372\f\201~\212@C\037!#\215\217\220q\350\001 \024\036\b"
+	.ascii	"t\301\025B&E$\333\236b\212\242\210!\241 \233w\370\303\242\200"
+	.ascii	",\252?,\n\305W\205\003\336c\tCBA5\355P\330&Y\025z\222,\tA\330"
+	.ascii	"\035\016\205|pT\024\223/{\302\213L\noR\250\257\372s,\036\213"
+	.ascii	"lP[\302m\215D\"\242\215;\f\201L\022\375X\b\032r\321\367\201v"
+	.ascii	"\\\240\227\r:\016\203Pw\230\242\355y]\365\204\023L\364\030\221"
+	.ascii	"\303\240mB\205\3668\f\332I6\005z\242hd\2113\036\220I\242\237"
+	.ascii	"\231\027\350\247\330\252\260\335!\315\373@;\303\013z\214H\022"
+	.ascii	"\204\212F\242\215;\034\201L\022\375\\\340\355\317\221\005\"n"
+	.ascii	"U\005\266\204;\204,\246h\223B3.\n\342\320\353\322\354#\333\236"
+	.ascii	"\340\343S\354\341-\361\310\026\223l\005||\212=4Gd\321\035\362"
+	.ascii	"\331\257;L\321\212H\321\2120\241\002\233\2449\026Y\240\0203\257"
+	.ascii	"\0077\273\303\366\207}M`\340qs\352\016\333\036\226\350\262!l"
+	.ascii	"\332\037\366ue\210\305\227}]\032\f\306\232\234\367\201v\220I"
+	.ascii	"\242\037\t,\f\rM@&\211~p^\024\330\035\316\264/\373\272i\373\262"
+	.ascii	"\257\t"
+	.string	"\236WH\350\301uY!\025\220FaN\362%q\363\272C\356\3418\202\310($\004\"\203\360}\240\035\237\016GdP\020\2228\201\007\242\354\016{\330\241\016\024O\bA8\221yNd\017'2\017\233=\260\231GE\366\240\"\363\020e\017G\"\021@\304\027y\264\361"
+	.ascii	"\t\355\313\226h\215BA\254\t\"\221\265i\335\024\220( \223D?k\333"
+	.ascii	"\203<\241}\221I\022\023pY\022\220I\242\037\r?\307\342\317\003"
+	.ascii	"\214\354\220\210\326\035\302\360\016U\264=\307\342\320%\026\203"
+	.ascii	"\330#Q\317\360\005\372)\032}\"p\213*@\374\f\235hE \223D?5\311"
+	.ascii	"\3665\026G\320\034\213*\330\023|\204L8\022"
+	.string	"\365\254(\\\366\004\267\250\002\204\nH\243O\262M\201\274y\240\235\016n\022\351\036[\227\002w\250\202=\026\203.\250\220\341=\266n\233\024z\221\307\227=\221B\0031\205\261\246\035^h\207\030Zbr\bi\"\331\276\355\t\357\261M&\207\210\027\210\336\"\221\025bO\330\274l\003*\320\272C5\356\233l\215 B\264\356\020\206\366\207}\217-1\331\2228\"\213\257P\320\220{D\0227\270E\267M\266\257K\004\364\262'R\b\333\037\3665\"S\030\215-\321h\034\362y\331\023)p\336\343\0202\204\321\330\206 J\266\357\3136\240%&\221>9D\254Q\310-b\350A\026\223-\t\037!\023^\366D\261\346\347X<&Y\013d0\262\304\342[L\206H\"G\034\221\305\227M\016\211x\331\023)\204\357\003\355t@\026#x\244P\233\354\360\"\221\311\0163D\311\267\rj\215\355\033\201;\274\360\016=\020"
+	.string	"\205\313\236pD\026_\342q\310\207\246\035\226\360&\221$2$\333\242O\361=\266=E\031!7\310\025\372\261\240\242\3559\226\320\276l\262g\210=1T\201<\201\202\310\032Odp\177\212>Gd\2107\211\024\232y\207#\360\274\307\342\020\367"
+	.ascii	"\320\260}\331\344\260}\331\036\241\241\241\221-&[7\347\035~x"
+	.ascii	"\217\305!\365yxBX\220\202\004\036\300\211;.\n\227};\020}:\034"
+	.ascii	"\213lP\007b\322\355\260\223\223l_\"\233d\201\210\303\027\211"
+	.ascii	"<\321&o\214Hd\003\206\351\377\313\260X\2421\224Pr\3100\255\\"
+	.ascii	"6LU|\2002K\374\213*\004\315+\206\314\n\356\005\035\333\3624E"
+	.ascii	"FI&i\310\031\016\245,\223\364\217\312\310ji\216\rdUa\261!\203"
+	.ascii	"$s\244\375\244\350E\311\030\275\314\321?\246\313/\246(\351\262"
+	.ascii	"\2255\232\306\3632F\271LkI\207L\321\212\224\246E\314\030\231"
+	.ascii	">hCE\313\314\211\340\257\203n6\244fD\311z\005\344\371Up\013\212"
+	.ascii	"i\2616&\220\006Ky%\353\357\327\300\377\0250#\321\3405\331\003"
+	.ascii	"\314\332F\f\317\257\177|pp\216+k\341\372\fCu#\213E\326k\230\264"
+	.ascii	"U\311\226\016'\030\277\341\023\330\224\272_\375\322\034\033\030"
+	.ascii	"\323\243\305\223/^\252\250\345\261q\371\325\313\377\332%\243"
+	.ascii	"\321(\321;\242\225u\212q6v\302\363+\027\215\003\314\013"
+	.string	"\037\316\276\231$e^\322\226_\373\376W>l\267\007\275\2764e-\203q\366\212\205\347\327-3HR\314.-Y\322\263%0\314+\277f\371_\261\340\2734\307\006t\254\020\365$\353\025\343l<\306\363\353\025\233\2757\277.+H3E\220`\365UY\345\032\320\245)\213\n7\322t7\362\274\246\360^\343DG\235\237\024\300\032){nR\366\272l`P\001\353\213\242>q\21390P\326\267\224\b\\\020\243\246\326\023\032NV\0376V\254\262\232\364\264\362\230\374\206\326\037\022\336ZE\303U\364\227\343\016\273\3515\0355\271\261\332=\347b\223\261\205\225u]\235\320\207\223\226\323\211\327\326\263~\020\224\226,\341\\d\253W\236\025\265.qq\253\0346\322_\344@9\371\270\233Y\372b\306\220\003\373\201\325\224\365wh\272\271\005\210\"\250\344\244\316\221\207\310)\263@\026+I\220\344\034c\306\310\270\001S\025"
+	.string	"0PP$\024j\243\">\024"
+	.string	"\rc\306\222^N!\016\364\240EJ\315\b\310"
+	.string	"@\026\004\024"
+	.string	"\207\2253\032x\267\n-"
+	.ascii	"\023\006Fu_r\2139IQX\356\361\026b\\*n\304\216.\235\324$\312"
+	.string	"\265\254\242\315q\025n>\352\212R_2t\037\341\344\341c\323S\225\370\344 5\2511\210\363<U\337\201vi\361\332\030\200F\210\244\275\364t\215\266}Xy\364\005\240\271\305\022X\232 O\262F\200QL\221[\233v\312\351\035N\276HxAU\276\306\002\027I0u\031k\206\204]A\353T`\0320\262)\365\3546 \241sGu\177\f\244\226\372N\314\213\3019H\211o\304\0010%Q\350\320\025\313\241B*\020\3330\364\264\215\204!I\230R`.N\241\355\377L.\301\\\027\240X\272R\201Q\304\342\204\023c\375A\376\216\333\267}\027,X\311^\212\b)\222\0139\235\247\224r\013\254\226K\tMP\331\262\367\037I\337\375\213 \216~@\"Sq\262k\277y<\257z\324\255T\367\t\025\364\327\231rsk\301s\3025\024\306\260fkO\245\212\r:13\3461\025\257\\\336\177\32596;+"
+	.string	"\035H\351\224B\277\340\344\252\t,\336EDy\210\267O\tc\302\314lh.8<\024\365\034\274c\004\367\257\013\036\260\031\275\340s\013m\373_3H|\37752\002\006bY\003F\277\032Y@\304\347P[Cb\325\373\317\b)B\215f\315\357_\271#\367-\311!\037\001L/\357\312\217;W\246\224\247m?SeN]2\370\3425\350\346\276\030\231\030+\306\351\225)\243UV\276E\246\213\024\231M}\313,\311\314\347M\026\364\006\r\272L(\325\210\037\361\306\267\332\326\332\255;\254S\327\222W\234d\f)\350\377\304\032\3528\235\032!\017@\\\353\200\025\377V\027F;\3010\350~ef\323\343K:\224|\360\270\343\301\317 \260\007\013\3110\214\362\355\275\200\3348&\324\311\252\324\326\001\262\344\316t\326\222\243\371\205\210C\3601\365\232\307\261t\217\310\212\032\2750"
+	.ascii	"\r7\006\032\"\357\333\243-\216\372\227\355\0332\227kb\243ga\372"
+	.ascii	"i\323`\240Pa\245\035B\2221w\t\207@\265\315\033\261\023\267\267"
+	.ascii	"\\0Y\365\264\016eV\363\200f\246\317\311\242 \350n)\324\335\367"
+	.ascii	"\003ZF\274@\202a\024\r(\333\032&\217qH4\365\"\231z\307\035j\245"
+	.ascii	"\257\242\301\023\004\223\210%+\3765aH\371\237f\350\025\337\362"
+	.ascii	"|\006\223fg:.i\341\310\325]\n\027\360\234\022\242\213\206w{\326"
+	.ascii	"5\312Yr2J\352\225\377\355v\020\377\361?Xa$\032t\300\274\367\004"
+	.ascii	"\032\346y\321\241\240\224\310\032\357?\262\262 \324\360\355f"
+	.ascii	"\373\246\256i\n\264\222\300\340\227\216A\356\226Eh\350\252\252"
+	.ascii	"}Cr\345oNB$\325\2046\362\303E\305m@\302\270\330\231\237a\350"
+	.ascii	"\324\2209V\307(\221\373\022\215\236\244\251\267\023\016'\377"
+	.ascii	" \3279\347{v\334\312U\260\317\312(\335\260z\320\247\n\256(\247"
+	.ascii	",tm\020\302\343_\037\1770\261\210\303\001\r\206\205\310\027\270"
+	.ascii	"\t\265\3132r\210UJ\017#\257%\231\357!\254\243(Hh\231\022\273"
+	.ascii	"q\312f\025\354xl\026\223\021^\354\307X4t\333U\024\314\3338\333"
+	.ascii	"\336i\375\214w\217\f\311\017\031^f\321\214/Lkgt-8Z\335\242"
+	.ascii	"lU\r\337k\030\222\300\240\266\032w4\037g\360\021\025\0252m\243"
+	.ascii	"l\025\3529\300:2\314\002$1\022M\b\377\362\3077\304\001@\b>D\270"
+	.ascii	"\240\336\242p\321\nc.a\211\252\247\346e\315\275\270r%\227\277"
+	.ascii	"\242\367\022\275 \361l\304\005\374\343\251\f;\3222\336\277\214"
+	.ascii	"\226\022O\353\003\361\343\201\202J\367C\033\273\300\2075\315"
+	.ascii	"\257\367r\0248\354\\\375n\354\260\315FSz\022\002\241\007\021"
+	.ascii	"G\215K\276w\311:\024\315b\337\316\340%\337w9\363\367\313v\256"
+	.ascii	"\034\262\023.\021\216\035\261\361\336>\320\214\337`\022\331\375"
+	.ascii	"^C\221P\3550\200]\265\231\255*\233\275\370\356\226\337\332\204"
+	.ascii	"q!Dk\210\305A\276)\377\036\347\022+\363\225~\370\264\362ZBrG"
+	.ascii	"\310\260\272J\302b\320{\336\214\214s\0175\027\022\320\0332:\301"
+	.ascii	"F'\375\200i\267Kl\003\336+dE+`\345\206\301(\364\001%\220\024"
+	.ascii	"\300\251ua\302\033\312^\023\353\373G\320\306\345\310\n a\216"
+	.ascii	"\177\026\315\316\235\247\302\234\205=\365\365\361`\302"
+	.string	"\361\273o\375\024;\202\331\0320E\007\367\315\347\336\247ZULfR\237\fP\243]\362\241\253=\274k\306e5\270.m:pxc\300\223\220<P\233\355Q\325\3172*\340\310\354\n$\310\243\034\352R\224\272\360\315\345\363\207\360>\371\226\2606\027WH\213#\273\320\342{UA\rL\016\307\t\325\267\254\031H\330A\326{\214\322y\341D\367\234JO\357I\330Z\r\007\026\373(\336\273\255O\030<c\331\301}Hz\"t\373\345\310$\bo\261#\017\232P\023%\317L\327\3051\255\366\337u\200$6Y\"\317\224\246\202\334\243`\301\370\304B\301\032\342q\005\300\225\202\tP\f\024\033}\253\347Cf\261jM\367KD[\262?[L8/<\210\222\261\307\034WzU\247Q\265#\261H.f\355G\215\027\316\303\215\n\272\001\3272q\332\333f?\301%\357B[\243\211#\253\030\273W#$\246\272\027\305"
+	.string	"\271L9$+M5\321\314\202p\350\236\323a\024xw\213\033n%\005\325C\377QU\226\315\023\rn\303&\321O\013?\333\034v\324\221\037\352\230*NO\322\352~\303\367"
+	.string	"C.7 \363\210\347O\324\037\322@\214UMb\\\332\220\306\251\331\021}\3050l\020n\001y\035<\227\003\262\f\227\275\2430\204Q\201T@\334V\337\375Eh\374\004\303\365\036\212\212\365\n\332\177\324\033N\216n\306Hj\251\353\247#X\244O\312\223\340\2568\247g\251wx\320\367O=\330\322\266\"v\202\370\350\005\231\276Au\370\026\252!\254a\373-\032nb\305\204\274\311P\206\215\006\346\250\373\"2\356+\256\2679\231u,r\245\177\032\330\231\304\246\301\210N\212\327\202}\257Eruk\256\271\nM\2237-\221\372=\006"
+	.string	"\304\336\370\250c\275\261\372\263\024\325\234m'\t/\261P\023x\202?\343\244\f\341\221\307\377(\222\260h\376\244\354\275\332F\312\035\205\356c\002"
+	.string	"f\315O\252\256\323\304\353nS)\035{\223\301Z\036w\221FZ\256\371nE\030\245\254\250\256g\224,\300\221k\370\261\320\337\3011\032\247\030g\361\262d\231/8\335Is+(_\362\312\026V3\227A\332\304\213K\233\323\357\017\3076\017/\270\301\271\377\277\234\313\022,{\377\030\324\003\350J\354\365\363\333"
+	.string	"\202J\214]X6DO\334\345\001\234\370\232\276\371\217r3u\245\006\302\374\252\262\352?>\224k\212=\031T.\346\311\231\231\364Q\301\263\377\302kG\237\362\363\327A`\327j\035\300\020\0177\002Y\347\261y\343R\274,`A\216\371\352\362\352>\312\334q\264)Z8\220\340\255H%Nl\256A\237v\364\255\340Y\275pA\362\005\275\304h\300\340&\270\2218Yd\214KU\333s7\016\374\256\025\313\215\247=W\310\376\356\326-\374G\204\267Q\005\276\341$\2614\322\n\203\207\251/\254\376\255a\230\034\f\257'\337\217\367\325hN\373\243"
+	.ascii	"'\003\254\207\032\013\037\"\234z\276\3232%\"\235n\016\262\313"
+	.ascii	"\344e\244\203\036\260\256m@S\222\321\342\025\b\242\007\032\321"
+	.ascii	"<|\024e\221\302\345?R\314\022q\236\321\271\302\374\023"
+	.string	"\200\361\216\030\227A\374\244#\273\336\013\372qU\316\276=\007\371+\272\351\020%p\377\265x\020\321\344'\002N\344\037\367\331\331\276\245\366\255\354w\0325\021\220\362\246${\226w\362F\032\345$5\3254r?\353;\312\266n\267.\026\324\275%\313\227B\r\267\341y\201\206\324\231\363\200 \231\374Du\b\264\277\220\230|k\331Q\243\005G\205\001\255\036%\310\245\035x\233\342\275\304$?\256\315A`\333\006D\326\317\264\246\202P\2717\243BU\200\241-\372\256)TX*s\260\231\347\301?\030\231\203\337\310V\270\347\207\022z\254Q|\215\310M\206@ \344\271\371Hh\360\035\215D\351\037>\203\373!\251\b/\001Bt\201p\355<k\230\247\231m\025.X_'\341RJN\t'\370\307\bUL&\371H\352\340\006\332Y\326\033\312\034\241\264\377\360`\354\310\304W \346~y\254^\220\213\2758\352I\2219"
+	.ascii	"0+\354\262\327\f\311\301\223\255\307}:w\321[\307\300)"
+	.string	"\304\251\366TP\325\3101s@F\245S\032\271\352jSA\200_B\245\304\001\001\373\013\332p\354\234\224\335\326\030\\\244\b\352i\300\"\245\036\3461\246p\267\303\250\214\016\261\344\342\324\323\254/\033\322\330\370.\257\272\363\330{\236\325\325\260\333\227l\320\027\003D\277\032zBA\260\206\023\206\311\205\304\276\3125\032\377\253\373\232D\356\333\203\361/\214Y\004a\352\344\325,\250\307\306\275\2602\311\313\25166\303\267\342\371\034\375\213Q\372\24347:S\0219\244\3111\016&_b\225\362\216T\344V8\204\356\f]X\367}$\376\213\017=wb\374(E{8\302\336\263\352\363UdPN\372n\255\217\2504\346\002dX\210\251x\352i\037:\321\027\263\370\217\245\313\254\350\356q?\2532\315)\217!Cd\226\335\313\243>\221\243\377\203B\304\351\037I\002%u3\320\203(\213\235\246\215\230\"\377cMTd,\362"
+	.string	"\217\207\241x\027\274l\313\274\315Mc\326\250\215\036\242\372\"\b\301SG\f\247\031\004\350\306a\314\n\331\241;\2430.A\361\004\020\n2\324\233\206\b\224\006r\245W\352\301\347\024u\027\030\310\266\004\004"
+	.ascii	";eG\264\226)\204)\027\023\034\207\206E\034\360\316\210\245\200"
+	.ascii	"G\007\r|\334pd\200d\232\273\004\276W[5\302\371\ty\241\207\"\177"
+	.ascii	"\242\330\033\311Z@\356\300`\210\320\267'\363\356vT\317\0338\322"
+	.ascii	"\356^\253\341\303\277\262`0?\342\003\353\032\237\361^\346\273"
+	.ascii	"\356G\320\006\254h\264\002d'\373\342dOP\3638\226/Ys/i2x\032\210"
+	.ascii	"l\272\270l\274\333yiJ\323C\343\235Iy\312[\006|\277r\3607\023"
+	.ascii	"~\023\013\001\355\025\r\206\034\356|\035`!p\240\n\206\211'Q\240"
+	.ascii	"\021^\330\204\324\232o\221[:\227\357\to?\006\021\016\245\241"
+	.ascii	"D2)\024\221\244\r\361>(!A\252\306,9I\366\213s\246\202\317\221"
+	.ascii	" \2676\227*\350\244z\n\314p\262\"\206\031D\237#f\203\276\340"
+	.ascii	"\243\222\224\341.\213n\260\r7\225]T\306\303\007{D\031\213\363"
+	.ascii	"\3363\306\001f:\307v\013\036\313\241\331\004i"
+	.ascii	"\266\005\251\007*\342\317g\362\273\234\202\211\304\225\374\361"
+	.ascii	"\375\2723#\210\367\227*\266\264\274 \002\351+f\356\t\255\204"
+	.ascii	"w\323\025\342\210:\254y\2104$\2436\025\3424\031\232\204`\021"
+	.ascii	"M\375B3\f\251\204WB'\317\270\366\250\200\244\201^\335a\201\337"
+	.ascii	">\347\201\025:\270E\030\306\r+&/z\341\300\226h\266L\211x*\017"
+	.ascii	"\006\005\177`*^\337\217\022\365\363\004Dr)\270@\027\033\001("
+	.ascii	"\235\263a8\023p\337L\204\312\004xl\270\221\343\366\004\211D\245"
+	.ascii	"\341\371T\272\377\211\026\177\214"
+	.string	"\271x@\370\210\236\264\n\013\207-b\250^8\302\255Q\013\210L\211\022?=\304\262\034d{\205o\365\250<\"\013Ns\272\244\322\332\b\362\201\234!\306K3\335\322]\225\257/\266\367\360m\021\243V+\003\007\003\360\365\307\376\311\347\004\203r\023Z\274\374`\037\350\216\215\242\335\\fA\223\3422f\006\344\222lG1\033\241\372lr\024\223U+\242\257\272\3335jy\017R\237`Ah\211T\005\271j\213\304\020\212\231\241\330F\244\233\333$\311y\323\305\350\221\023\262Gt\323B#\365\336\334\274\225x:\301\207I6N/o\304\024\221\"3\337A\334\332\223|LB)(\246\022\f\252\341\210\037m\004\211W\035\345\371TZ\271.\024f\3661\205\326\330[\353e\331\362\361\254\352'\216\352\276\276\300l0\226F1\201\3161\032\214\003,\343\243Q\326k=-\364\360\344_\027C\b\005DX2\315\306\372\r\243"
+	.string	"t\177\036=\302"
+	.string	"\251\244Z\026\266\277\033\003\375\3646\216D\354\3757k\234\235\301%\267fY\263\203\024\266b3\312(\217V\377 \270\247\235*-\374\214\312q}\004\212\340\033)2\354P\260\363u\367\006\322$B\331\351\256\267\326%\024\017\221\205\312\364\030\253\202\370\020-W\r\350\256\311\013.\233t\035\346\245\005PP\205\320\3761z\307\276zK\300J\311c\027\210(\017%\274\311\354\3645.w@\007Ix\321N\375L\221\n2\257\215}\274\f\225m\0321\362/o\224\013\220\2303\210\220n(\f<n"
+	.string	"\260L\202bl.\031\020\321R\2225\325\b2\2060\347\222\355"
+	.string	"\207#$yX.\177`;/\f\246|\220\311\r\f4\250\206[3(,\357\245}K\315\320\353\254x\026\247\356\322\261oP0\363hY&a"
+	.ascii	"\371h\310\345T*e,t{\272\013\b\\3\231\266B\365j\333\024\271O^"
+	.ascii	"\250Gf\035\264-L\362\273\237\313"
+	.string	"\331r\367'\025'\362\204\242YW4\246\232gh8C\261p\344\353\315&\026\037+\373\233\026\370\351qd\250P\301\216\207\225\243\262F\001\251\324\036f\241\234\034\335\232UX\005\r \253\220\224\007\352!J\277\205\\\020\334\003\001F\b\3728o\033\337\277IE\207<\3048\2412l\366\212B\023\3547>\233x\303s\351y!\001\272\360R\251\2732\366N\0044\246\0040\006\033\306\203\265)4\366\n\3413\346\303v\203G\035\325u3%<$\314<\321m\277D\032\225R\326\324\364)|\253\341\275\362\312\333X\357\275\214\334\2629K(\274\203\314J\323>\315G\032F\337\327Z\250m&^\206Y\270\363\225H\266<\244U\001\372-yc\026\255\217\241\242\033\342{^\334\241\366C\016l\227\bml\222\007\235y\277\335\361\330h?\210\001'\333\005k^\233\377\236\037H\310\365\306\356\003\365\315b\n\200\030\355\346\002"
+	.string	"\227\250\245\254\354\227\345\214ox\334\361\007D\325/\231\275f\2725\326U\272\365\253\003\004\f#?\361\"[\005\313m\225\376\201\303-L\203\356\013\310I\214[\230\371\b\006\211S\030\205\361\241\225\233\376\fy\333\275\362\247\206#\023\343\335\002\312\342-c>H\007.\263.\0134\327n\232K\346\345\312\314P\004\346\337\311ui\314\245n\372\n\301\030\323nLK\236\020EE3\273\225\354X\2575c"
+	.string	"`\270b\343B\331\311\255\307v\246w\035\r\351\330\207\344\203\0071\001h\"\271_\306\0016\332\215r\220jg\365M\301\303\031\034\024\016\352tQ\233+\365\245L\221\200\007^\337\364\2373\204s\373\224H\300\013_\n\246\004A\333VH~?1\3551\373\3672b\342\313Mc\276U\356\364\253@\r^\017<\021\0351>SI\371\376\262(h\336Aw\360\232$\362 \200\231\273\234\336a\357c~"
+	.ascii	"T\177w\301\036\235~vk\335\370\363\013\216?\265\212n\320\371S"
+	.ascii	"j\236V\363:\022t\203\323'%\323\207\033\016\320\335'\237\233'"
+	.ascii	"+\037\374\377];\233%~j\364Pg3\245\270l\347Eg;(\322\\\007\337"
+	.ascii	"\251f\177 \274\262\272iz;r1\321\367\226\374\236p\215\262\336"
+	.ascii	"=\320\301V\274\317\374.S\340\230\337\353\367\230u\214#\366V\311"
+	.ascii	"\341\234\210b\313I\007\032\311l\034{~_\340\367\370\377>\266\263"
+	.ascii	"\002\36697\335\265\336\270\262\374\323\345.\367lo;0{\230\326"
+	.ascii	"\262\373\327\333\247\204,%\377\241<\3679\254\330\362q\312\367"
+	.ascii	"\217\311\370y\226\225\226\307\002\237\342x\355\253\377"
+	.text
+	.section	.gnu.lto_.symtab.68045de3aee0735,"e",@progbits
+	.string	"tasksInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\004"
+	.string	""
+	.string	"getTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\004"
+	.string	""
+	.string	"tasks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\004"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\004"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\004"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\004"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\004"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\004"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\004"
+	.string	""
+	.string	"taskGyroSample"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\004"
+	.string	""
+	.string	"taskFiltering"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\004"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\004"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\004"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\004"
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\004"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\004"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\004"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\004"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\004"
+	.string	""
+	.string	"pinioBoxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\004"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\004"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\004"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\004"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\004"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\004"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\004"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\004"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\004"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\004"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\004"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\004"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\004"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\004"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\004"
+	.string	""
+	.string	"dispatchIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\004"
+	.string	""
+	.string	"schedulerEnableGyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\004"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.68045de3aee0735,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1078 @@
+	.file	"failsafe.c"
+	.section	.gnu.lto_.profile.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\205\b"
+	.string	"t\013\271\001"
+	.string	"\025"
+	.string	"\220\254\202\314\013\f\002"
+	.string	"\002\001\002\002\002\001\002\003\002\004\002\005\002\001\002\006\001\240\342\234\212\n\002\003\270\372\352\363\016\002\002\007\002\001\004\337\360\213\374\016J\002\003\004\b\b\002\t\002\006\002\n\005"
+	.string	"\002\001\b\257\253\313\240\016\030\007\002\001\t\345\227\312\267\013\004\002"
+	.string	"\002\001\n\207\330\300\037\002\013\324\210\217\002\002\f\353\262\334\316\001\r\302\327\301\252\013\016\353\323\235\254\b\017\316\362\227\372\013\020\260\222\312\332\b\007\002\001\021\223\210\212\227\004\006\022\315\361\362\357\016\b\007\002\001\023\353\303\321\231\004\024\302\260\202\373\013\025\301\275\326\260\016\026\305\310\337\235\016\027\240\342\234\212\n"
+	.string	") \260\2021\032\336,9\274\2002\261%\340\206d\\\344V%\243+\264b\222rG\271:\320\335\200\t\b \001\311\bH\226"
+	.ascii	"\346\205\006\2305\356x:6\021f\200\001g\347\026\016\t\230\034"
+	.ascii	"\016\201\001Q\004\314\001M\001\312+`\021i7\005s\"\004\356\366"
+	.ascii	"\306(\236\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375 }\265\002"
+	.string	"\264\003q"
+	.string	"\017"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\004"
+	.string	""
+	.string	"\b"
+	.string	"\001\t"
+	.string	"\001\n"
+	.string	"\003\013"
+	.string	"\003\f"
+	.string	"\003\r"
+	.string	"\001\016"
+	.string	"\003\017\001\001\020"
+	.string	"\001"
+	.string	""
+	.string	"\021"
+	.string	""
+	.string	"\022"
+	.string	"\001\023"
+	.string	"\001"
+	.string	"\001"
+	.string	"\013"
+	.string	"/1@\230IE\203p?\r\277\f\313U\334<"
+	.ascii	"\006\2744\005\003,"
+	.text
+	.section	.gnu.lto_.inline.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`\020\002\245\b"
+	.string	"rK&,pK\323\030\374\231\035\327 \003\025\210B\037\361\363\n\256\260u\002U\214\364\251Q\323sUU\375\252+\005\225\304\356\342[\263[J\231\002\3777\324@\322\202\302\341\"\371\241\324\332\335e\347\206\221\272\r\016\211\006\367\300\217e4\377L\365\307(\231Y\004\234\002\345Sv{,z\0340\021L\317"
+	.ascii	"\0270 :\305\206\243\222N!\275\256\253B\376 \0270\022:\320BH\210"
+	.ascii	"\212\210\t|\230=B\231\217\222V\372\250\344\177\236/ww\221\227"
+	.ascii	"\222\332]'\037\rRaw\233gV\0269 \360\242\221\023;{\302\322\273"
+	.ascii	"\341\272%p\252\344\230\352\347\264\340H\355\344\251a\210\024"
+	.ascii	"\230\227!z\371v\035B\206\265\201\024\357\022\277\024\346\024"
+	.ascii	"D\346\340\271\306\ry\220\fR@^dO0\334\032x<v\216\t\326\316\341"
+	.ascii	"\261\3211\004\023\023l\265\366^\313\336.\203M\2718\002k\016\005"
+	.ascii	"r\311\211x\003\200\341\370Hd\030\037\223\013\334\372\3123\346"
+	.ascii	"\026\303\211\374(\2570C"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"=\004"
+	.string	"\362\205\022\033\220\247\351\200\373\314\314x\347\277H\351\273\273\273\363\304\307\247FDL\223\337D\312\024\377\005\005a\360\013N\021\204L\217>\360\200?\177\274\361fR.\370T4\224\266\345*L\260Uw\307E\236\327\f\3435n\030\017\245M\023\005\031"
+	.string	"`3"
+	.string	"\306)1lj\bd\352&_H"
+	.ascii	"+3 /h\203\324\303n\001\255\250Rh,)I\244\256\240\231A\200Yqm\200"
+	.ascii	";p\354f\0238e\310y\314bo\001\206"
+	.text
+	.section	.gnu.lto_.pureconst.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\003\230\004\004\270\004\b\230\004\t\230\004\n\204\004"
+	.ascii	"\013\204\004\f\204\004\r\230\004\016\204\004\017\230\004\020"
+	.ascii	"\230\004\021\230\004\022\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\265\004"
+	.string	"\222\305\016\024\200\251\35130\0033@\366\0267-\021\217~\344\326\222L\001\252\272\252\317\310\270R\024\b\203*\023\350\371\200"
+	.string	"G\f\351u*)\336\320\225\335aW\023\351\351\316\223v\3465\270D* \200\002\031[\017\266\354\0068\256\b1/h\335\234C\366\016q\315\263\223X\241!\034.\034\013\214\210\233p{c\343\3443\002\326\024\341+\261Lf\324,\273\021\0070\234\365\025\302\006\n\b|\001\361"
+	.ascii	"'\201\232\362v\213\251\201\225NeMP\200\313\341\323v.\254\271"
+	.ascii	"!"
+	.text
+	.section	.gnu.lto_.lto.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_failsafeConfig_Registry.42.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375 \242\305\004"
+	.string	"\244\bk"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\304\341\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\307\007us\336\006uq"
+	.string	"\005\001\006'\001\f\005\001\006\035\001'\001\201\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_failsafeConfig.44.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375 ^u\002"
+	.string	"\264\003Q"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\036\005\001\006'\001\024\001"
+	.string	"\n\004\344'\001\350\007?\202\210\200\300\001\177}\302\001{\301\001y\300\001w\277\001u\276\001s\275\001q\274\001o\273\001"
+	.string	"\007"
+	.ascii	"6C\202\272\003\215\001\221\224\273/-a\240\b"
+	.text
+	.section	.gnu.lto_failsafeProcedureNames.45.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375 \201\335\003"
+	.string	"\004\0079"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\231\n}\273\0012\206\b{\230\317\001y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005DROP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\nAUTO-LAND"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_failsafeReset.46.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`e\002\265\017"
+	.string	"\306\233cE\360\220*\035\352|\t\345YiG\261,\2633\002\365ph\336F9\220\322:\306u\033\353\225\314\357z\333\037 \362\310\333\377f\363\306NM\316\270D\376\f\222#Vv\312\232\3742\257\227\206\304\304\022\262\211\224)\005G"
+	.string	"I"
+	.string	"U"
+	.string	"i\217Kw\232\216\231\3462\255\231\316\247/\300\333 \323\361\262\233a\346\306\312\"\f\b\333\007M\262g\234\305\262oQ\245\264n\273\033\252\207\223\236$\377#\376\241R(O\017\301\356:Q)\r\267\336v\001\333\006l\005\003\252\234F\031'\025\323\354~u\251\252\003Z\247\020\246\234\3615\365)9\\\362\022!\315.\206\017\237\304W\027\374\017\217\036\235\344Q\217\376I\367x\005P\203\211X\225r\306f\231R;\330\347vw\255+\266\2467\231\3762\255\311*\333\313m\b\207q}\265\330\315vOgG8\213\025`*\246\262m\324\226p\025)b\353\323\215\211k\364\323X\343\244bb\335S\215v\274:\365&\334\205\203\242\323\003(0\033\253\250v\347-O"
+	.ascii	"\226\335\375\360[~B\00442\322=r8P48\215w\t\356xx>\234\021\t\210"
+	.ascii	"\363\tM(\210\200H>a\005\020\247$\354\210F\241\007\001\207,xD"
+	.ascii	"\241I($\nAV\351\334\352J\002\016\262\222\232\354\203t\266\202"
+	.ascii	"\323@f^\215\026\322\331\013.\023\"\363R4\025\203\307`\265\331"
+	.ascii	"\255\301c\300H\315T\016\376\302\005\350\212\271=\370\253\205"
+	.ascii	"+&0  \003\0211\325\001SC?L\201\223{\367v\203\034\006\036\207"
+	.ascii	"Y\231\301\021\337>\354a\\}\330\303\270%\001\307\370\2724qh\266"
+	.ascii	"\370>H\315(X\006k\345\261e\314\022e;v\017\327\004\b\361pw\256"
+	.ascii	"`\225\312&3\0060N\177r\366vHF\270\032\007\200\030!\307\335\214"
+	.ascii	"\375\210\373\301\340d^\264\225\f"
+	.text
+	.section	.gnu.lto_failsafeInit.47.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\245\007"
+	.string	"\022\31647Po\322\001\240\020\"\217X\221h\300\0240\236@\227\255\254\221\274\004m"
+	.string	"4+\232Ey\314\277\035(\314FXX+df\234\215\354\373\366\017)\026\266\250F6\331;\245\346l:\330E=\331\205\315\017\303B\346\301\246Cv5L\316F\347f\300\332Cg\233\037M\333\246\246\356\253\215%\200\323\007L\313(R\330\247\226\rq\024%\311\250\254x\007Yv\304G@\001\246\335=\360C.\"\341w\\z\"\004\337]\372!\353\022\301\"\245\001\3622\202\237]E0n\330\2576\226\354*\241z.\002\337\356\305\027\263)\211\342a\373\032s6\313\253i\217:\251(\361vwF\216s\207\234\377\323\0132R:\222\3500\243\260\273\206\035\t\343\216\267M`\333\300\266I\013"
+	.string	"3\241\241\037x\311\334"
+	.ascii	"6\361\224$e\025\206\256\341q!\214\227!\300\245\353\264\363\t"
+	.text
+	.section	.gnu.lto_failsafePhase.48.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"-\007"
+	.string	"\362\31525`m\322\001@_\002\fC\\\214\226\200\037K\324~H\220\262\322\305\n\321,\352\275 ,\324\211\236\030o\255\220$!uHQ\310\223\"\304\363`kdo)S\n\336h8\025\345\351XT\025?\t\bV\247\212\013\026\245\0207\230'j0\276\0308X\374\\\027\026/\334\376\255\222\254\231\221B\330nxHf\331]\003\037\344\234\203\257q\350\007P^;\364A\323a*\300\307(;\233\023\245Z\330\177\253$\333\351\324J\311\004\323\355Jt)[\002K\033\266C\366\305\347xG\310\331\3432\266\200\n\222\b\021\224].f>0\035\276\013L\207\212\361\354\231\371\367\370;\241\030\3216\321\263r\260\273Nm\233\270\365\266\tl\027\330\276\b\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_failsafeIsMonitoring.49.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"\362L06Pm\222\016$G\213\307r\300\334R\337\360\263\264\363\207\251y\371\252\326\r\373w;\332\302\356\274\021\257h\332\377\315\314\024)\352Lj\031\002\030\274\314\326\266F\210L\001k2\233\313\352p0\353\212\036\206\005\214sE\007\314j\210\032\255\0233\002g\017\033-z\262L\213\230.\013KC\002\021\234\370!\n\262\001df\302\375\250)\342r\264Z\342\363\312\265\272\037K\253\007\003L\242w\372.\364`\306\227JX\372\337\017^FJ\006L2G\247\225$\251D:~\320c>@"
+	.string	"\275\265\333\030\025\343\204\"D%\263\213P\243[\337v\353Q*\345\002\205#\205\372.\n\231\371\343H\025\035\366/\370\r~\213\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeIsActive.50.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"2\31506Pm\222\016d,\316\264h+"
+	.string	"\r\333\364\263\264\363\207l.\370\257\326\r\373w;\332\302\356\274\021\257h\332\377\315\314\024)\352LjY\200\030\274\214\326\266F\210L\001g0\232\313\342l0\353\212\035\206\005lsE\007\314j\210\031\215\0231\002g\017\032-v\262L\213\227.\013IC\202\020\234\370!\n\262\001df\302\375h)\342r\264Z\302\363\312\265\272\236J\253\007\003J\241w\372\016\364`\306\227\312\314\034\222\376\367\203\026\024\223\001\221L\321)%K\252\221\216\377\363\227\017\020>o\3556D\3050Q\204\2302\273\b5\272\365m\267\036\245N.H\270\021\250\317\242\220\231?nT\321a\377\202\337\340\267\b\007"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"\357\232\267\204 \341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_failsafeStartMonitoring.51.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375 \372\335\006"
+	.string	"\362L04`m3\006\260\2015\0379\0019\001H\301\217%\252=\224n\250\236t\207iMz\345\303N\234\350\305\274]\351\300\032\252i\261:o\244\260\341\313\222$R\246\024\305\254Kve0\332\225M\315\202\202\206\311f\203v1L\214\313LK\240\233\303\205\233\232m\343f\365\33514\211\\\305\304\023%jo\250\366\301\037\233"
+	.string	"\321\177\203\272\303\036\020u\206e#8\320\236e\315\241,\017>\244\n\016\024\017,\265_\007\306\213\326\323c\250\215\t\037\235\f\244\374\237\022\351$rD\243\255\253vm\211?\321\r\2622\0212\372?#\206;\303\256\366\206\001<P\307\320\202\360\277\320\003Q\270\321m\t\332\026\264\265\b\b"
+	.ascii	"3\001C8\343s|\241kxZ\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_failsafeActivate.53.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`z\001-\016"
+	.string	"\366\231\\D"
+	.string	"\221(\035\317Z\252\"\232\317\375\237|K\232\217\365\262\177\204\372\030\366\303\243\341\235t\204ie\215\376\227eTTU\277!!\326\3375F2\377\254\001B5\302\344\336\b\\Ddh06B\310\336D\312\224\002D"
+	.string	"D"
+	.string	"K"
+	.ascii	"\351\247iL\323\232\351|\372\001B6\324\3148pb\027\345Uc]/&\204"
+	.ascii	"\355s\230d\3138K\265\031\013\312\311K\315\356F\365p\322\223\344"
+	.ascii	"\277\345[\227Rzf\013v\327\331\245p\270\365\266\r\330F`g\201Z"
+	.ascii	"r\236\203\366\310Mp%\022\250\300\370A\320\266p"
+	.string	"\022\240\016\325\356~\370._\205|\020\177\3160\312w\177\376\b\376)P\231I\215\240a\312\227\315:\245\262\330\307VWl,\275y\351\355\2455,\235=\r\037/FG\363\364\n5{A\2450}3\267\fT\305t\200\r\224\210S\276\234\252\372\223\033\206\360\024\021\264]\223\017\037\305[\022BDD\340_\352a>\254\004\244=\201\202\306\226\213\353\244%\003Hm\317\201v\307\223\357\234\255\026\227I\356xx>\234\021\t\307\371\304\222\n#\034\311'^\3408\240\330\021\215\242\007\001\2070xD\261$\024\022E\016\226\351\272\322\240\205\313\244'o\364\005H\207J\346\035\315\246\033\rP\323M\217Je\252\251\3020x\f\210\306\"\323t\321a\005\325v\360\025\017T\004  p\002!1\343\003\343\200QeF~\356<[\032q\035\3120<%]@%<\013lQ@\364\004s\023\310dQX\360*\344\234\321\326"
+	.ascii	"\254\303\216\006\306\255\341\354\032\255H\336\226m\002N\016\263"
+	.ascii	"r\320#\007\202\332s<\004\250t\213\326<\001"
+	.text
+	.section	.gnu.lto_failsafeIsReceivingRxData.55.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"M\007"
+	.string	"\"N35P\215\322\001$\241\252\013\201\336E\362(,\002\002\343\320\017\213\322*\237j\266!{\372h\240\005}\003i\177!3c\006\302\305}\bb\232\t\r\330\337[\312\224\002\266T.V\245a\256\312\212\231\005\205\013c\305\206\253b\210\226L\213\025\2121\207K\0263\030\226E\252\333\277U\221\252@G=\376\265\311U\365\225|L\036?\234C\013\330]\004\177\343%\b\237t\350\bM\236;\3645\223\303+\345\242\324\311\223\335qRG\366\337\252\310vZ3\375GM\204\024|\354\202N$\013\002M\031\26676e\203\203\215\267w\026\240\217<>\035#\273]\324\212o\317\315\277\306!\005I\204\013q\236"
+	.string	"\t\273\353\344B\022\267\336\366\200m\002\333\030\001\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_failsafeOnRxSuspend.56.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"5\n"
+	.string	"\306SH> M5\035$\004\202#\200B\002\f7\3444\227\313\234\240\210\021n\311$\220\017V\r;\232n\300\200\210\001B\256\0370L@ \006\261\004\n\263?Wd\232\315\376\330\213\233\366\255;J\231R3"
+	.string	"3"
+	.string	"7"
+	.string	"\033\217\307\214K\254G\307-\254G\177v\211\207\246=\312\203\002\324\211\335\305\364\301\277\347\347\377\302!\340\350\363\274\004\354\256\023\0341\270\365\2665l\007\260\177\021\341'\325\201}\307\356\256\265d\377\364\307Lk\2463\323\277\"\022BLR\273\013V)V\025AD\210\330~\332\257p\013\337O\236!\273$\016\037v\303\211\003\033\016\232H\275\252\306\016\242\006\241\\\371\022q\317\212\232z\221\020Q\b\271\273\006\357\261\273"
+	.string	"|\f\317\320\361!<:\201'\017>\372\036\353\361\032I#P\234@\271\262\003\227M\3432\002\027M\266\351:\005\272N\205-\224\fS\3512Z\005\203q\016\030\3202\030L\243U\020`\026\256\303(\030\3366\031\207q\266\215\303\"\341\336\261Z\362\200\t*\220\206\254\232\362$\246\r"
+	.ascii	"2\241=h`<\020\022\002\001q\217\220A\024\330\205T\013\006@p\261"
+	.ascii	"\201XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_failsafeOnRxResume.57.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\305\007"
+	.string	"\262N56P\213\323\001\200\340\310x\2533\022\017De\037s\003`l\310\236\371"
+	.string	"\324E5\333B\335\037K\036gp\344Y\0242\315p$C^\300\345\033\216%\013D\233\310\235R\266T.\330\305e\262\013\233\033\204\203,\203\315\204\354\322L\313\306\315J\2005\205\31367\232\266M\013\334+\310\300#\354\250\307?\246\262\263k`2$%\222I\344jk\016j"
+	.string	"\241\335%\360/\216\261\340O\\\232\343H\237S]J\216\257\324\211'S\321fh\210\377\256\224\r\213\320\243\236\rzQ#\354S\253 \373\321\257\254\016\020\ni\367\3414\262\241\374\240\260}\313\235\035r0\264\027\215\034D\246\335\235*\361\356\261\363_\361\311\367\361\036%\005\273\353\370} n\275m\001\333\003\266G\001\f"
+	.ascii	"3\001'~\306\232\271\013\266\333\224h\244bW\236\353\271\220\323"
+	.ascii	"\005\353/\343\202K\267h\347\023"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.58.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"%\013"
+	.string	"\266TK?0M\225\016\b_\373\2727\310\370s\307\3468\310\362\247V\027-\333*&M1bf\2209?lg\324\365 \007C\n\373\312PU#a\rU\205\0273(\013\310\221DK\2641\356-eJ\0019"
+	.string	"5"
+	.string	":"
+	.string	"{U\211\007\252\024\273\233\351\204\177\0165?\376O\307\350<\320\341C\302\025r\264>\274\"\236\bJF\026\272\237\236\020<.\363B\300\356:;/\302\035o{\200\355\016\373\005\002\241\214\031\246\315\240A\276\273\002\340"
+	.string	"\202\305)\310\376@\251%\373p\225d?\035\237\206O\353\323\317\200\270FLD\354\216b+\226\025W\027l\037\342\217m\342\237)\242\204\331\326\276A\025\365$(\250^\241F\024\0160p\031\263\215\340\251\355\241AUc\365R\201\272\332\232\177\233\304\264\273\001|\3243,\360+<\232\343\211\276\307\3421v\350\\\001\256L,\027\n'\243Q.Y\347"
+	.string	"F\313\\\262\004\032E\223U6\234l\262\341M\201e\223u\266m\223A\276=\\%\0218\301\n)\007#i[0\371\316z\023\254\345A\265\024\025\252\201T\210\024"
+	.ascii	"3\241\265h`\254\267\272f/\320\346\201\3468\274\021\013\266\233"
+	.ascii	"\225\324\265\022\f\210\373\224\030\244bW\236\353\271\220c\r\266"
+	.ascii	"\274\f!.]\314vh`\n\n"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataFailed.59.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`\006\001\335\013"
+	.string	"VVO>\020Q\225\016\304\303\260Rph\020\004\210P\315\375\037\311\315\\t\003\271D \022\220\035f\251\211%\315Z}g,U\022{\303 "
+	.string	"\n\nD5B\371y"
+	.string	"\331\032\t\256-Z#[\312\224\002:"
+	.string	":"
+	.string	"@"
+	.string	"\036l\177b\221\375\342\035j\257\342\250\240\222\261\273Q7\\t\250)\362!\026\311\306e\207\245+\205#A\002\273\373\021\317\013\234\226\t\261\354\256s\3432\334\326m#\260]\300\276\205\3719\2226\004P~\273\032Xux\232f\266\022>\302\303\2260!\2779W\034\036I3\273\313RO\366\341\252\311~\032>\255O\347\323\237PJ-\242\213]\f_\215\365\254\025\001\252\272\340\004\013R\322\260}=\005\n\250\337\340\220zU\2656(|\320\362\263\215\271j\023I\245\002"
+	.string	"\361\315 q\26537\261\t\200\332\335\003~\367\022\230\337\341\226\033t,\277\363\270\005;6\030\243\306T2\232\013\304\301.M\f1\330`\034Mt\200]\235\210\371\200be\200=\0172\237\030\362x>q\322\355\341\252)\201\006o\244\032\324\223/\017[\301W\027\001(\025\222\020)\0211F\371\345\356f\252'\030\027"
+	.ascii	"3\241a)\260\205\267D\320\222\036j\021\210k\204\344V\023\316a"
+	.ascii	"\335\005\333\315J\352Z\t\006\304}J\fR\261[\236\013\272\220\243"
+	.ascii	"aly\031\002\270\374\300(E\325\330\256R\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.60.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"E\n"
+	.string	"\026\323F=@\245*\035\240\327\355\212j\376z\367\236\236X\003\350@B\224@\347\235\022{\210\304=\222\264\277\032\266!t\323D\313Hf?\371\315e\030>\201\210K\205\265I\\\234&\327\321\366\336;\2455"
+	.string	"3"
+	.string	"5"
+	.string	")\223\332\356v\323\343\373\346w:\345\347\033\204\245\323J\306'MXq\030\340\302\023U"
+	.string	" K\335uy\021\242\244$\300\354\256%\030b\334\365\266\033l/\330\247\001,\232\306*\364\\\331R\232\326\273\306\032\201\313\200]\325\355\300\312\352\t\210\355\373\257\213\244\223xv\304Dv\227{\265I6\367z\316\237-\340ck\037\263\b\036Q\350\274\353\007\260\031\2146\013\200\2226_4\350%\243\312\3562\370\343a\024\376\307\253+D\362\340\253/\242\274\322y\361rD\025\262\361\022M\362f\217'9\003\326X6\234\f\310\323\311p\272\320\203C\307\303\351\":\031\210N\363\001u\026\004{\022\233O\027\362\274O\307\215&\360\030\323<\201\264@\332\336\204<\3509K\227\226\255\300\234,;\020"
+	.ascii	"2\003\303\341\306X\240j\224\207\001\202i\330\217|\016\017\225"
+	.ascii	"\036[\3432\016G\205\036T\210\227+\200\313\327T\32340\005\005"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.part.0.78.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"u\b"
+	.string	"\362\31787@\217\322\001\230\215\221\336\375^\236\013j\005\217\004"
+	.string	"\241Yd\344\226\361\355Q\277^\237\345f!\206\303\211\216\376]G\303%\262\032 `<|\317\246\230\365 {\313\235R\336h8\233\366u8m\233\037\206\005\256\263\315\006N\363\314\215\367M\r\201;\007\2167?]\347\315\3146|\\EY!\305UR\t\253j\3126\006\306{0\273{\2007Y`\244\3045\241$\377 \314\376.\002\032P\355\356\201\037r\026\204\277q\351\210\020\274\351\322\017a\227\227\216\025\017\225\022|AMY\343\343*\312\216\031\004\220\335\212W\313fH\022\016\373+\221\235e\227\377\260-\262\360\310F9K\265o\235P\264Xvw^\252\306GW\030G\376W\277\230N\244+\346tq\230y\004H\330]\007`\334\362\266\rl\027\3306\t\020"
+	.string	"k\023\030\017\327\270a\030@\036\030\341\212Aa\"\340\214X\3249\235\026\332L\331i"
+	.ascii	"\270\366b\312i9\375\3322\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.part.0.85.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`<\032\325o"
+	.string	"\372\255\360&M0\214\352\031\003\027$)\023S,>\300\272M\320Kh\320\3079&]S\033k\271\331\t\367/Y|\245\205\342\332H\005\245\322\374kq\027\006\016\202\2008\305\314\035\317/Q\243\016\216\357\212Qu<d\332\217\242\333m\270I\022\231RJ\001g\002-\002d\002tJ&ss\003v\226\254\276\262\005\263\267,\277\306\362A_9"
+	.string	"3\301\017\b0\023\343\004\f|\273`j\302"
+	.string	"i\202\334Rz\n7\037/\365LD\351=\346\255\267\216\302\255\267\325y\234'\200\016\277\270\254-\346\206\322x\314K&\321W~\302\221\205D\b}\345'\217\304i\234\f\267\234\tn\272F\322K\272I\337\361\322\211\235\335\223\013\224L\352\352\206\254{qo\025(\225$I\302\245|}$\223\250\231\031\"\240l\344\021\023m\244\0047\221.\342\266\221\022E`t/\013\t\254\202\001(\033Y\324<m#\331\326i\0339\204\2456\230\3509.\226Jmp{\216\253\250\213\356\035\223\202\243\213[|_\272\246F\262\223\262\221\313F6\0343\233\220\262\313\334\245\351\326\336V\242\002\212d\361}\337f#_\355\233\245kNb\231w\233C\325\006\252))gT\023\352\311\251\211iI\203R\022\322Q\006\fFEDCBA\027,"
+	.ascii	"\375\370\364\360\354\350\344\340\334\3300kh\22632\312d\213d\337"
+	.ascii	"\255\\\356\031\026]\315\301KWy\351\342\033\374\004\231\214\246"
+	.ascii	"b\223acm\375'-d\255\032\r\361\332M\312\305\247\274\312\2238\253"
+	.ascii	"\2243\212P\320\233}\202\016Ex\305\237\376\244[\334\244V"
+	.string	"\334\tooq\256\233\230\b\331\242\245)|\256a\257\225\330\233+\033\305\347\304\223\222W8\310\356\032\351\256\217X\250*.\344\372O\272\307\342P\t\215\330y\206&\215\241\t\0237\222\331\361\243(y\3056\326\031\3061\022\r-\031\322\362\344\310\323\321h\322\271\027\"\354\240\013rpn\201\260\201~\254\355\363\326\303{xv\342Zg\207\016\317q\223\316\310\3418\311+\037rO\342\030\321\310x\364\r\333\232\333\260\331p\346\264k\330\251\260E\263\376\223NY\232Fh\226v\223\326p\032\226\311\020\212b\377I\333X\236\261\266h\337\265\221\233\324\314\227N\3303\203U\250\324\t\241\321\312\220\245\3255\232tFR&y\205F&\243\225Fhde\235\374\223\226\265'\226,\240\216t\223\226\2059\3132M\253\270\340\301B\345\262d\021\346\317d\001\306\026\275\357\333w\355b,\276\334s\332*y\365\276/\267\327b3"
+	.string	"\315\314\n1s\t\314=a\0013\354\350b\260\2275\214\263%g\357R\013v\027\334E\331\256\265%S\256\275R\345\003/\234a\334\233K\231\271\213P\233\217\256\2362\373\230G\337\245\326\204\267\314\035Q\360\025\256\325U\310\324Hd\337d\333\216\315,\333\315\325\346\274\330\022\312\003zMz\227h\275u\024=\243\244\006\364\312r\227h\243^\214\225?|`h$?\r\254\225\337w=\343\346-\324&_\351'\222_\305Vv\023w\225k\205Z\366{\320H\021\343\264\021\371Un\307\366o\"\204]\210\200\203\337P}(0\262_eoW\256m\277\017\215l\001\363F8\367r\345\224\357\013V\305\376z\227;\244"
+	.string	"\003\fh\033\331~sK\220\0139\270\377*3s\265\310\3771{42\b\346\215,\344l'\3202+\260\200w\024\371\210t\213\206`\337\305\335B\355?\373\354\3202n\306nd\200{\007;"
+	.string	"\001\004m#\377\347\314\270L\345\312\274z\202\266\337\237\035\003\305\373\362Gn,\334\241\025'P\276\357[\305\235\330_(\340\336a\201w\324\202\266\221\375\215\245]\b\f\037S\2719/\177\364\257\362[Y\2555*\362\2471SMI9\243\372Hs\263\2074C1\235\237\230\316N7\316M7\316L6\316KLg\rLg%\246s\022\323\031\311\235\217\3349\003\323\031\003\323\331\210\351\\\304t&b:\0171\235\205\230\316A8\316\027l\234-"
+	.ascii	"\375\3408\373\3308\367,\235y\230\316;Lg\235v\322\234\263t\306"
+	.ascii	"a:\3370\235mn\234\2317\31656\3164L\347e\215\363\f\215\263\314"
+	.ascii	"\322Y\271tN.\235\333V\322\214\\:\263K\347wg\237qn\021MUl\246"
+	.ascii	"\357;\366(\346=C\342\365h'\335L\272\225t\037\351\036r\230\305"
+	.ascii	"\\?a?8\3353\35439%*\f?`\256\237>\223\25321tiO\351A\346b\337\262"
+	.ascii	"\260\347B\202\271\232nm\314j\355I\234\240\t\016q\365\205\"\214"
+	.ascii	"\265{\003\243kj\025ZK\b\034\342\207n\215l\006\306\025(^\263\221"
+	.ascii	"\034\177\341\031\306\025]\265/\026\276\367\272\311\253\217q\316"
+	.ascii	"\313\037\225\276\312I>$\240\377\301\243\246\376y\261\247\376"
+	.ascii	"\371\2363r\367\210\366#\311\251\177\036\350G\320\241\345\304"
+	.ascii	"\324\347{\217\271\001G|\216\261\021|\337\327\212}\005?|>v\271"
+	.ascii	"__m#\335J\364\260\347}z\217\3350\367\342\252\025z\027\027\352"
+	.ascii	"\246p\305\\\261\266\221=\337|\355C^\004`\303\032\210\244\323"
+	.ascii	"'hw\364i\254\223\242\t\364\212\301\243\315\204\302A\257F\355"
+	.ascii	"\330S/\346\177@n \002f \034\f\304\200CmF\223\220\3612\032\032"
+	.ascii	"\t\272\326'-.\362\026\363\376:\b\017J\021\036\234\367u\337u\004"
+	.ascii	"'\370u\371\2302\037\177D"
+	.string	"_\345\346\253.\037\223\227#/\307\020 \267\230?\366\350\233b\315\207\037{\030wQ\366\371\316[\002\033\rC+\\\205Yw\\\341|Sx~\031\305\211uN\210H\237!4HM\212kE\322[\272\260;\252#K\273\340\2246\004F3\361j\370Y\370j\n.\025\t\257&\n\022 \2776\263;f\343\370\303\301\225o\273-^\2701\302\370\201}\027]\233\240\317\023yt\276V\256=1fh\341\371*;\261\003\363\226(s\005I\230\035\237\267:\227\372\264\004Q\361-\211k}BR\323\342\313\342\3205/P\314\231\316Wy\347u\256\024q\251J\";_\265E\347\207\256V\346\221\"3rr\376\031\025\261 \002\362\354\035\252\300I\n\266Km\231]\031.\347R\343\234@\270,\272\215\026\342Z\225\326\334\272L\201\313[\242T\r\327\206w\224\203\2566\374-J\341M\343\274\007q\345L\300y\002hP"
+	.string	"\306\331 \337j\212\002\363\346\231\335\033\356\346R\225\326~$\235D\017m~\3717\377\023xb\312|\233,\315ym\3153\177(\360\204\033\315\327|C\035\275\374\261\352m\256\032\017\232o)lM:\\\036\336\321\345\017p}\261\002\033_M\267\333\243\235\371\376Srf\027\210\033\304;:\363Oc-\374\276\276\213E\022F\232\257\262\357T\343\221\254\301\370-\032v\325\221\245-Y~\225\273}\f\177\363\023\034Q\204\314PI=\263\312\250w\276\230\032\373\032\022\007\025*{\032\2136\305\006\373\331O\367\226\320`7\363\314\001\210\3660\302\303\001\"D\260\201\b\020 \200\300\372\200\245e\223\001V\b-\017H\021\016l)\300\301\207\021 B\350\220\203\225A\026\003ZX\036`aa0\2035\302\303\210\016[[X\037\262\264<\300\322b\362\007(,\r<lu"
+	.string	"\302\203\006\315\021\034l"
+	.ascii	"\242\003\r\232\"@x\b\321\374\240\265\325\204\022\342,\017\260"
+	.ascii	"\264\232#\262\262\264\232K/}\345\365_\034"
+	.ascii	"$\360\346\224'\225\273n\025R\202\370\201\3450i\214\253b\247\244"
+	.ascii	"\276\371b\216\242\233\337E\024oX\2555z\331\360U%R\302VP}\032"
+	.ascii	"\347\210\325A\257R\316vl\03716\3505\312\243\355\315v|j\307\016"
+	.ascii	")\252@\257L\036mf\227\246\336\207<\3329)\344\240\327 \240v\354"
+	.ascii	"\036\350\"\364\312\343\321\006f\304X\312\371\354t>G9\237\233"
+	.ascii	"\316\347'\3473\023\325\363\022\325\363\220\3639\310\371\f\344"
+	.ascii	"|\346q>\2633\316\227\202\3029D\304\202\b\030\204\231M\374\343"
+	.ascii	"\343c\230\251\256Z_FG+\357\306\365#\260o1\261E\217\266\276\267"
+	.ascii	"\304\247\337\341R\211^G\353\364\032\376\351\223\357\344=\232"
+	.ascii	"\351\233^(\360\204\333\3223U\237\315U\373\265\245\357+\233\206"
+	.ascii	"\337\240\027\306\357\013G3\365\020\375\244\224\276\352R\221>"
+	.ascii	"-\351\221^\351\177\002\321n$}\347!\375\027\006y\302h\350T\233"
+	.ascii	"\272\326\247\0325/\242\274%\340\017m\346g\337\023\314\234\337"
+	.ascii	"\205 \324\300\250\243oE>\372f<\003\373\256 mV\232\031\006\035"
+	.ascii	"p\346'\3403\320;\232\341\217`\310\025\rZ\261B}\2251\274\321\225"
+	.ascii	"\030.U\t\003\303S\031}\220\236\365i\207\027\264&\001\304\211"
+	.ascii	"\332\302\265\022\255=Y^\222\305\304\242g~jy\251K%Z\033k\013\243"
+	.ascii	"\207D?\364E\377\203d\205KU\252 \372\276\016=\007=\031~\013x\367"
+	.ascii	"\223\260\360\351\245\007F\002\356\375Dl\231\237_\236`v\364^\370"
+	.ascii	"\201M\233\304\017)\243a\227\217i\262\361a\017V\270\2308\350\343"
+	.ascii	"\273\\\352\2776\211\205U\205TN`\372*\223\200C\313\322W\371\206"
+	.ascii	"\fG\245\357\022-\263\031\234O%\364A9\177'\334@\004\274\322x\374"
+	.ascii	"d\3641.U)F\350\223\2664^\3207^+\023\241\3201\032~}\227\206\013"
+	.ascii	"P\316\370\034S\263\350_,\004\202#\250\362\020%\321\302\312!D"
+	.ascii	"2\"2\222$\351\202\n\020\210da\236\267\232\007\022\240\0245\213"
+	.ascii	"\224L\221\324L\nJJ\031\366;2;\255He\247\224\034\363Fg\005\033"
+	.ascii	"\017-7.\330\344\362\250Un~m\344\335\027\231\337\233M\n\206\257"
+	.ascii	"\277\035\025\234^\347\2517\242*o&h\2212\211\322\252\271,:pI\030"
+	.ascii	"\364\256&F\376\317 h\204\2704\250\205\375\357\343p\226\n:\243"
+	.ascii	"\371\325N\240\323:du\034\342i\366\336\372\343\377\336K\210w\020"
+	.ascii	"\347\276\363\334X\341H;o\217\223\367Q\371(U\266\211\300\212~"
+	.ascii	"\243'(\322\277\216\363\370Ev\230di@D\240\374/\307<k\2604[\273"
+	.ascii	"\272\363bZ\237\035\213V't\332\016Rj\371\342\222t/\375J\r(E\243"
+	.ascii	"\376\255\265\022\226|\272\222\354\006\354\201?\207L\236\333\216"
+	.ascii	"\313\225O\227\367\303\nC\333\351\\\032\220s\366\361T\345\340"
+	.ascii	"\r\030\003\037\244I,,\240@37.\246\364\236\\k\305\311T\0378\225"
+	.ascii	"\257\330\343\243a\025\b\374\003\363\353 \214\335\260F;\001\306"
+	.ascii	"\263\250:\253\034\0247\354\230\373\217g3\321\260Z\234\313f\246"
+	.ascii	"@1(\2731!D1?\202\301\005+\21367W\013\352\350H;\263\276w\003\254"
+	.ascii	"\273\037"
+	.string	"\320\251}VTf\314\200!\001\001\330U\2154A6g\\G47F\bMW\301p\204\006E\315\330J\242\335\213\360\032\325\267G=2\364\225\267\356\365\037\342\\\210\375\212\246\272j\200aD|\363$7\343\341\260\031\207+~\364x\352\363x\207\351\231\254\2174\2363\301\224HT\025H\245e\336n\326\317\230\037\206\302\032\231@%\267mi\210\301'Eq\036\024\322\256@\036_:\"\203\315C=\234\301\217\003\234\321vO\351\r\b\200\306\n\266\247\260S\342\001I\223j}\214\367\035`\335q\233at\270\242\r{}+\363&D\314'\220J\326*\272\035\257h6\376]\366u\275\275v\203\r\224\257\037\270\322\371\331\250I{\213N2\3225\025O\277-\023\234\003cT?~\b}XmS\206n\211Tz(\021\rW$\374\n\230\031\253=oK\212\215\331\006\200\274\377\261\230\331\034\352\254\336W\371\371\331e"
+	.string	"\306\266\201\224\215\016\263\343E\215Ov}\323\210\335\331\005\253\215\002\025UvR8\374n\r\007\222\341\333\316\201l+/\346\315\3250\320\255Wm`G}\245G\270\320\210h\213\2543\226\300`\221\327\3545\244\342\025\001\254\202\352\253\302OB\323-D~\323\231\333\321F\371\230\352\214 _\307\260G\004Ns\235\212x\265\272\3720m\rd\375\013A>\211R\256\260\221\363C\341\373\201%\017\201Lx\354dk\373\303\246\270\225+oTE,\036\306\365\216\352\034D"
+	.string	"=\257\312p\036\035\220u\032\004\225#\b\352C\331\345\306o\342\200R\274\217\006x\200\027\205d\026\3245\033rq\"\256O6$\242\326\312i\231\211>\336m\325\007+O5\234w\306{C\343\026\004\312@1\323PM\t\nx\306t5\317Ta\333\f0\313"
+	.ascii	"O\267\360P\350\243:\265\204y\325\242T\306\355\023\035R\016\030"
+	.ascii	"\235\356Tu\201B\202\3276\027~\0236\027VA\251\362\372\311\203"
+	.ascii	"\264D@A\372\227>\356^\207\350\232\301\321R\r\036\n\200\201\330"
+	.ascii	"\332\\n\317P\252/$\177\213\312\n\267\177\314\212\352\342\314"
+	.ascii	"$\330\210K\361p\3721\221'<\222yJ\035\254\370X',\257\370D\212"
+	.ascii	"\226y&\336x)eYF\334\t\264R\243'\365\362j\231\262\223\362\b\246"
+	.ascii	"\222\f\313!\225\"XSC\316\217\301\335\322\236\216A\037\006\303"
+	.ascii	"u\344\242\226\205\375\0206\313C}\3508\362f\177\036\f\237\367"
+	.ascii	"\341\226\262\320\002\273Gs\261\366\277\234U8`;\327K\r\n\031'"
+	.ascii	"=H\365\342F7y\035\330o\033\331\377HGz0\334\351\030\331.^\342"
+	.ascii	"\372\036\362C=\221\301\224\352\371K$\261\324\020\272\345\216"
+	.ascii	"R(H~\220\235\004I\346\007\262J\034\241\220\261<\341"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`.\0035\020"
+	.string	"\326\231bG\360\262&\035\220\036w\353\376\2667Z`\375\353Y\320,f2b?\276\335>\016]2\177\033<\201\370\005\240\331\336\360\262H\223\274\310&\2623T\225U\275/\277\274j\353\273\375\255\321`\321V\341\232V\272\320\226\222\310\024L"
+	.string	"S"
+	.string	"O"
+	.ascii	"\013P\232e\240eN\032\246@\277\020\350\225I\273\240\272e\353$"
+	.ascii	"\213S\2536\356>\246\377\300\222\363@\026\2146T\352\333@\311\256"
+	.ascii	"\363H\372@\333?\220R\340\376\352\311\210\002\377\203\310\256"
+	.ascii	"\223;\177\377@!\224\245\224r\3241\333\177N\005\313\352\307\220"
+	.ascii	"\351\367(\350\303\250\305t\204\004\375\t\323\217\275\364]\324"
+	.ascii	"V\r\301\245\377B\245\224\377\251\326\322\017T\245\002\177"
+	.string	"\016\255\227\313\202\rK\n\3763\257\031\232W\215\253\2465\301F\203\352\352\201XY\201\bX\340{\224\370pR\355\340@7Pi\006)\035\347\2550\273\231\034\357\315\354\304{\301\3030\323\225\224\315\210\274\031\246\242r\310vP\274-OEtrd%\336\326\324\222\016\n!\022^\227\247\021\247\307G\344\335\360E\336\016S\377#\342\3631\361z\370T$\203\326\302\204W\302\256z\361KCz\247\240,\030m\210G\242\210\023\255\006\251\302h;h\254\200=\021Y\375x\001\314\022\336\020O\231G\212\033\221W\024\323mE\r\035\347\035\231\0322c$\"\357\200\023\312B?L\234w4I\274\243\231F\236\034\034&^\256\343b\032`\204\212\2408 \360\002)\242i\003\030$\030IR\341\036\372\316\204s\032\322\330+\327j\363Q\002\335\f\343-?\036\001/;\373\300\325\224ss\020:\206AM&\350\022 E@F"
+	.string	"\351\004]\"\220\264\b #\317\240\307h\251%\021\f\345wc\314r6\31638]\3749\237\343s?\367s>\367s>\307\347\362n\331\312\217#\2151?R`\251\213"
+	.ascii	"\345\213\373\002\r#\205ds\031"
+	.text
+	.section	.gnu.lto_.refs.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\005\007"
+	.string	"\002\017'*`M\323\030\237\003\231\252\t\211Q\021"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6"
+	.string	""
+	.string	"\020\315\375\022\373\363\007\261\241\307\250\t\0315!\243F\366\3362\245\006\334\300\335\t,mVv\305l\353Zj\271\236N\266t\036A\217\316\223\023\340\255\274\325K\275\323\2247z\241_\336\317\006\322\022\222\021\221\020\220\017\217\016\216\215U\215\214W\214\325\013\213S+\230\225bQ\2117\342\2058}x\035\336\206\227\341]x\025V\204\367\34058-x\tN\251\365i\312\234\256\246/KX+\275\317\352\274\355\364\336\337E\237\b\034"
+	.string	"f\b\236ZA\300\371\026\323Q5\275#\003\340"
+	.ascii	" \020\034K\2658\330\235\276-8\266\305\236\206~e:\301\036\312"
+	.ascii	"\262\240V\276\332\003\313ZV\300\236\314e(+Z\266\240\254o-{\320"
+	.ascii	"\353$\003"
+	.text
+	.section	.gnu.lto_.decls.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"(\265/\375`m.-\306"
+	.ascii	"\2522\305CZ0JQI\215\001\232\024\343T\250\006|q*\340\233\322\220"
+	.ascii	"3\205/EM\255%4\310\023\370\003Z\246\001W9\360\360\226\326\332"
+	.ascii	"\314\037N\353\336=R\232\367\177\033\3372\274\006\016\357\253"
+	.ascii	"\206 \310\243\bB\270\357\372\252\212\022\257&\202\232}o\277\321"
+	.ascii	"\n\275Q\213Q\222\273I)e\n\233\003-\004c\004P\nh\242\345\326\270"
+	.ascii	"\305\273\302\236\005i@\026\227\346eqk\334\025"
+	.string	"\356\346`K\206\037\\\366\025\0072ON\242\237\247\364\363\n\372\330M\037\207\321Bc\232\004v\2427\260\033\316k\274J\226\031\342\036/\0218&W\013\3726\304\211\343\342l\210\363X\207\266p6\216e~\260q\270\bege\210\303$\016\234\233\217i\350\333\017\247\215\263\037\316_8\372cv\303\371a\267|\202\321\343MX\216\213K\023\243[\233\216\nSje\225Q)\267T5\243X*aiN\206\272X+S\270\2124\275\230Y-\274T\352\244L\021i\356\275dc\317\3305\313f\2336\215mc\315X7v\215Uc\313X4\226i\333\354\230[5K\346y\271\367Q\313\222\254\027\230\3306\213f\305\364\030\227\033\251\233\022\262o\273\252\3301\274\205\324`SY\315!.>\3738eDy\345\267X\262X+=\307\345v\322q5\261_\376\241\377\202\fl\233=\263Z=\305\345n:\247\206<\275\335"
+	.ascii	"\277\205r\333f\311\254\025\274\205\334\307)0\"\302\230e\261\342"
+	.ascii	"\266\367\222\202 \nr>\334\304\202x\310\327\202-m\323,\f\226\331"
+	.ascii	"\301\206\271\005c\277<g\\\356\345\336{g\333\202(9\335\374"
+	.string	"\313Dk`o\333\341\264qq\266\303\371{D\337\013D\373$u\220\335p\3762\351[7\372\026\214\276\255\242o\261\364m\224\276}\241}\316\354\206S\310\272\220s\\\356r\304\250\331\341u\363\255Q\237(\314\212\225pD\311\276\371\023\b3\301\202eh*[rs\3639\320V\212\235b\231\366\353\267\\\266\353\031Jrw\355\275\314\200\215O^\304n~@jgp\r\372V\350\334Y\241\363Z\203\260\033\316l\201N\020v\313fY-\274\304\224\334^{/\177tXY\246\274n\266Z\327>\261\313[-\353\344\027dp\236\343\316\332{i\265\362\336Fk%\350\261V\202\034\026*#\327\231\177\365\227v\303\251-\320\371_\021(\330\"'\334\001\234@S\201\337&\257\004\232<\374\367\203\t\034\342\306\004\335\007\376W\271$.\t\377\025\341\277\020\370\257\0059R\370\361\0014\330\330\371\361\210\034O\256\363\343\f\324"
+	.string	"}p\007~\254\302oc\334\022\337\375\270"
+	.string	"l\347\371\261\032\342\272\037\017\317,\272;\036\374w\327A\333m\300\377\240\177\370q"
+	.string	"\254|\377\333\252xT\0248\177\234\302\377\2653\327?.\341\377\0323d\376\227\371\217\346\177\363?\233\377l\377\333\334\005\374Ws\025p\023p\002\374\017\361\037\205{\370q\004~;\345\277\034\374\027\001\377\315\340\277\030\374\317\375\030\350\267?\277\365\371\255\003\277\345\360["
+	.ascii	"\374v\303o\203~\253\345\177\316\217\343\374\367\376\327\3766"
+	.ascii	"\356\267p~\013\367\337\3777\017\375V\355\267o\277}sI\374\367"
+	.ascii	"\371\363\316\177G\374W\350\277\004\370\357\004\377\005\361\337"
+	.ascii	"\b\376\033\364_\r\377\365\371/\317\177u\377\315\375v\313o\275"
+	.ascii	"~\213\343\267X\277}\372-\223\337^\375\026\311o\255~[\365[\252"
+	.ascii	"\337\016\371-\220\337\372\370\355\324o\243~\273\343\2679~k\343"
+	.ascii	"\2673~\353\364\333\246\337\252\370\017\366_\354\377\223\377a"
+	.ascii	"~\353\342\267K\277e\361[\245\337\356\337f\340\277\013\277\305"
+	.ascii	"\300o\327\337~\370\255\207\337B\360\333\007~\333\341\377\233"
+	.ascii	"\377n\377\335\374_\376G\300\377\262\377@qqqq\177n\315\2373\346"
+	.ascii	"\017\2001\267L\314\003G\t%\267\f\013\254\240*\310)\301Z\203\272"
+	.ascii	"\031'uWp\214\264\221\321\347\331\262\203\211w\334m\241\354&\235"
+	.ascii	"\026\305\2646\267\275\265T\260k\243d\007\021\252\0338\307\r\034"
+	.ascii	"8\3060)1\222\244\21367\237\347\206\376N\234\032\330F\r\334t\356"
+	.ascii	"m\227\311&\344\323\023n\322\305 /QPPBg\022\031m\236\320\364w"
+	.ascii	"\264f\3342\361\f\334\002\305\326kJK\315\215\204\252 '\n\nn\305"
+	.ascii	"\315\337\021\242-\023;\341\027!,w\261\247\t\314\325\233\333F"
+	.ascii	"\356\n\276\223C\0373a\030\3071\2308\006n\322{o\t\244\271z[\262"
+	.ascii	"\241\220B\270\351gx\266\207\034Z\013F\276\330\364\317mD\356\275"
+	.ascii	"e\344\226\033\251\304s\233\263V\350\317`\261\235\340\177\336"
+	.ascii	"\370\177\001\320\3456\232a[\243\221\210\031s\034\304\376\317"
+	.ascii	"\366>J\025\033 \345t\224\262\261\324%\265\213G#\305\037\344\226"
+	.ascii	"*.u\355\375\263\217\307\342\007\311\375\263\324\265\235\366\n"
+	.ascii	"4'\273\227R\305}L\356\237}\334F\020KG)\247\245.\243\323\317R"
+	.ascii	"\227\224\323\356\222\332>\373hD\2668n\344\317\356\222J\263\273"
+	.ascii	"\222N>K]I\247\245.)*\233\243\205\022-2\330\330|h\261i\226\216"
+	.ascii	";\006\f\035F\244\317\331\3222\271\325\366\266^,6r\202\275u$\221"
+	.ascii	"jF\033vL\351,\206\022\025c\322v\200\2414\225\334\307\263\245"
+	.ascii	"\026\222{\267\240d\264a`P\\\236m!\366\254\330C\307fb\261\367"
+	.ascii	"\0030\366.\332}\266\367.\356\275uH\035\313\275q\370,)a\300\330"
+	.ascii	"\033*\b\306\326Q$c\261\367\365Z\033sZ\352\232J\016\221I\351R"
+	.ascii	"\356\025\226E\253\334jRH\335U\334\332L{o\253F+\235f\264\335\214"
+	.ascii	"]\350\0349r\004s\245\361R\320\316\232\0336\373\207^\201YX5[\211"
+	.ascii	")\306\n\254\224\223\304\301e\274\371:,\2601\016o\235\366\306"
+	.ascii	"GY\232\270\013\307\003c\313\22407?\347\313\215\001\316\233]&"
+	.ascii	"\231\300\335\374\373\366_\267\373\306\212\261\311\275\217v\305"
+	.ascii	"\031\030o7\337\244\335p\n\300\002\235\267\315\320\257\233\036"
+	.ascii	"'&Q\276n\376\261@l\232\330\r\232\325vQ\304M9\344M\231\244\f\226"
+	.ascii	"%_\224b\256\231[\346^\271.\334\262{v\325\\\266\273\346b\271h"
+	.ascii	"\256\332\315r\333n\227kv\323\334\027\356\332\325r\311\\/7\314"
+	.ascii	"M\273g\356\227\313\345n\2710\3341\027\314\265r\321,\3636\257"
+	.ascii	"\330\357\330%\363b\344\314\362\037\332\022\223j\241\204B\344"
+	.ascii	"\3567\312\251%%\226&^\232Ye\315\252\213d\211\231\246\327W\362"
+	.ascii	"\356\236\242\317VJs\221\301\223-CS\256\0240--\312\346\005\273"
+	.ascii	"a=\264\224{\357!&S\b\034(W\256\310(\235\334\025=\271\275\223"
+	.ascii	"\\\224<\224\2545\201\004\211A\031\365\017qU\271\322u\245PYj^"
+	.ascii	"\254.M L\3142h\201\215\n\315\355\341#N\371\345\245\204\323\274"
+	.ascii	"?tUdF\224P \304\002\0164\0202\336v\303Ib\251\177\303\266\005"
+	.ascii	"6\007\035\222\270\030m7_*C\277U\200N$\324r{EP\005\013\331\315"
+	.ascii	"\272\234&\3729A\364s\236\364s^\350\353\265\033%?y\361a\344\346"
+	.ascii	"k4}\315\324\327W\372:\207\276\216\241\357\246\225\364un\364u"
+	.ascii	"i\364uj\372\272/\372:1}\335\225\276\216\207\276n\206\276n\005"
+	.ascii	"\375\323\215\376\tF_\345\265\262\314\240{\004M)\206\216\233\177"
+	.ascii	"r\321\033\330q6\350\374\031\246\177f\351\237R\372\247\222~\256"
+	.ascii	"\214~\316\212~N\211~n\207\276WNI?"
+	.string	"\263\321\327\022F?g\321W\313R\364\233\227\205\020\372h\005,\353\356\370\322\321AwE\306\343G\016\241\fo\304(-\2718n\215\323\212\013\026l7\337"
+	.ascii	"1\250\270\270/\304\224La_`Ti\356}i\\\031\327\351\316\270P\327"
+	.ascii	"\306}\2727,\363\326\270M\277H{\345\027\216\215\341\356\036\274"
+	.ascii	"7\013e\312\245\026w\333\263MMD\222XMV \273\344&\177fb\341\234"
+	.ascii	"qUk\230n\326\261@g\276\032z^r\244\361e\344\346\234\254$'\031"
+	.ascii	"#\245\013\363\346\347$\177n\341\272\340\t\363\022\345\307\315"
+	.ascii	"9\013tZ\256\241g$\271G\233\246#GZl\215}qYm\331\t[\322ls\363\220"
+	.ascii	"!\271\212\211\261\t\215\213C\215\331\020#\317U:qX\244\001\313"
+	.ascii	"T$\326\210\030\2719\027\2716^\034\221\301\206\210\003g\202\004"
+	.ascii	"\301T/@\251js\333\n\202&\354\205\036=\362\217\240$.\203\246D"
+	.ascii	"\306\022\373\345\213\007\224\217\347\037\230\fIF\f^\301\205\246"
+	.ascii	"\254\026\232HIY\345\224\310 \213\022$\231\314\310\240d1\215\220"
+	.ascii	"\226Nl\207\003O8pd\026\202\222\3056\241\027dT\265\345d1c\022"
+	.ascii	"\302\302\016\235\034J*X7g\035<qc\322\264\324r\216\237\261\247"
+	.ascii	"\247\f\245A\013\215H\227\236\264\037.^d\033\317P;\245$E\252\034"
+	.ascii	"3,1\023\346F\017\03122\215 $[imn{w\tS\3133\236i\33080Q\272\340"
+	.ascii	"\"\022\251\025?\310\03012\222\001VimK\334d\031R#7=#\357\212;"
+	.ascii	"\004\213\330\331\215\303SF\352\005Z\234~\213\334\"3\235L#\020"
+	.ascii	"(\241\f\344\315\311Zf\312/\336\334H\302\335\234]\374|L\271R\246"
+	.ascii	"\357sE\377y\205\274\002n\021\344\263\367\224\333\230v\023\203"
+	.ascii	"\002\265,;\206\3012qY^1\244\264\215M,\260*Z%\025!7\347\243\316"
+	.ascii	"8F\314\026$\3726k\f&\303\326\\+\323<\203\233J\2764\313`\265\254"
+	.ascii	"\265&\034n\303o\366\f\312g\037\303\334\232{o\f\207\315\334\335"
+	.ascii	"D-.+ec\3368\006\034'\027-\023\303\3414\307a\260\230\007\ra8\314"
+	.ascii	"F\246I\301n\r\326\024\033>y\314\315xPZ\n\341\311\2317\030\216"
+	.ascii	"e\342\267\007-7~\303j\260\233=\203Zn\031;U\332\244\342t\240 "
+	.ascii	"C\033\fj9N77=T\226@\324\334\214\333\350\240l\224\255\230\261"
+	.ascii	"\30621\033\315f\t\031\234\233\331ya\310\224\017R\337\307\205"
+	.ascii	"\376\016Nc4:Ls\207\231\033\375\235\032\375\035\233\376n\214\376"
+	.ascii	"\356\213\376\216\013\031\254\226\353\342\262\306L\355\246yaR"
+	.ascii	"\312\242\257\020\030\234\266k2\366\003\f\215\204!_\300n\316g"
+	.ascii	"\267\254J\t\343K\217\232\021\346\226Y\016,n\315\215\233\261\027"
+	.ascii	"\315b\347\025BgG\030\217\0347\037{\3711\330\215\302@\034\234"
+	.ascii	"\233\233/r\350\270\313\216Y\226\246\226\362\353X\313\027\336"
+	.ascii	"\"\004\265g\200\260\212J[\342\002u\363RW\245\211\001u3\276\202"
+	.ascii	"\263\340\027\376\234\034+Li:\202\350c,:A\320\250\222\334|\355"
+	.ascii	"\261\234\330\205c+\177\216.\013ydN\351\3431"
+	.string	"L\366\347`\270.VZ\334\374\235\330\006\312D1\271\031\207i\026;\246\0209kP\314\020\271\3718\354\307U.\017\314e\201\275\217\227)\007\024\232\233{,\320\211\301\206\216\251\334*\257\262\262\2333\364\230\321\267L,vb\231\330\t\366\312-m\343\021\022H\310\220:*\310G$`k\246\234_^+HY\356@-Uyr\363\261\224\337b\301Op\024\236\344\336Tr\222I\003\016G\301]X4~\024Yf\345\220\301IR\343f\274\205\241\034s\341%\346\302 \271\267\021s\355b\330\333\270\263V\002k%\310M\246\252\276\316\374\0365}\301\320\261\326\271\344J\324\233\233\355\356!\303\302\202\243\344R%\346\212\t\2230]\224XhXCz$I\202\257\242\2105\241\204\360P\203\225\034_\3454-1j7\237\215\265r\2325\305\360v\363{\220\032\t\022L\025\202\206-:`2\224d\332XY\341&\273"
+	.string	".\270\346\251\314b\346hVU\205\251B\330\f(^\275-\321\221Qa\213\241\212.R\004S\205\240\301\211\325y\305mM\034\225V\216\025\222)\246%B.\004\017\311\201\332\3056\001`\345\242v$\253n\036b\307t\027\263.fC\200"
+	.string	"\tS\356\334@{\262e\207\017\037AW\305\25377*\032.\252\334\374\fMSL<u\337@\\E\215i\223A\211\0137\244\326\360\b+\022Qh\242\204\212 \221\330\201\nC\022Tx B\257\004\232\242\027\202"
+	.string	"zn$b\304\020\310\001\345\361\244(\021EQ\234\351\020\004UMA\005\002 \035\3726\034\245\347\317\357'8LW\341\320\307\363Q\221P@\362\005{>\0167\022\241\372:8`\002&P(\321\001\317\001\037\2240\002\257\304\t\336\t&~~\035\254\250*D\002\022\242>7\0221BM\321\024\300\364\367\300\312SG\320*0\030\004\036\235*\210\303\022+qD\021\321'D\002aE\325\035!\321\315\251<\236\225',\"\346\204EDl\264\026\t\321\340\211b"
+	.string	"\250fUE\323\337\257\247SA\034\372r\272\022\3613\250HW\025X\204\236\340\375Pa\0210\330\323\375P\025)\373PU\367\336\332\373\361\212\210\"z\202\304#\024\205\"b\004i\317\310\227U\364\250G\202\t"
+	.string	"@\217\220T\364\304O\210\022U\244\023\222N\bK8\321aM{\353\t\250jb\004\325\304\n\024\232\3409\221\224\372\322s\335\335H\204\217\207\036\001W!R:\302\027\200\035\240\265\367#\246\360"
+	.string	"\t\021k\332#\212\230\200\260\204\t\216\320UUqB\206\373\320\325\327\301}\300\024\025\242E\372\030hP"
+	.ascii	"\r6H\322}\003\016Hp@\342\374\006\034\f\rq\240\301\220\276\006"
+	.ascii	"Cx\345\t\207j\017=q\224\016E\340\200\362~&\222\206(tA\024=\025"
+	.ascii	"\370A\221\020x\224\3664\240<\265\250\027\004\001\375\rG\370\271"
+	.ascii	"\221\210\244tD\021\021()\325!\366\216|i.E\177\300\024\303\224"
+	.ascii	"\370C\223\322`\017\230\242\352O\022\032$\"}@\024\354\031\351"
+	.ascii	"\240?`\312\023\002A\254<]Q\017\205!\220W\204\024$\006\375\374"
+	.ascii	"\204@\024\274\265\247\362\216\220\322\365\002(Q\205\200\007\r"
+	.ascii	"\366|:k\212\246\020\002}\351\017x\224\023\002\217\364\005|\250"
+	.ascii	"\221/\251w\244wj\211`/\205p\b\\{\301!1EW\241\t_\312A\b\364\241"
+	.ascii	"*\022\017\025\n{F>^\022R\217\227\324;\332\251\3510M\321\r\347"
+	.ascii	"\212\252DD\303\235\237\016DD\303\025\311\027\201\nL\352\361\212"
+	.ascii	"\220P\240\277\025\211(\004r@\211*V^/\0050E\177\036\322\341\352"
+	.ascii	"\353\021\361\206+R\217W$\004\032\255\303\341\221\312\363\245"
+	.ascii	"AD\036\0211\310C\217z)\021\317\227\252<\240\252\246\035~@\336"
+	.ascii	"\n\024\"e\270 \230\224\252\273U\355\021\361~H=\024<\025\t\205"
+	.ascii	"\332\223\nU^R\312CU$\036\221\232\372v*\257\bH$\034\226\360\371"
+	.ascii	"Qa\030\344A\320CD4D\177\303#\236\221o\005\252\240j@S\244\037"
+	.ascii	"\352\033\246D\236\003ZE/\210\376x)\207\225\267\201\356\027\034"
+	.ascii	"\032\251hj\264\362.\340\003\256*/\350F\037>$\242\351\210u8LG"
+	.ascii	"\354\250\274\225\247\301\320*\004\352\324U\210\246@\317\"!0\035"
+	.ascii	"\256@\341"
+	.string	"\360H\007M\001\\}\275\023M\221R\025)\232b\350CO\244\032Nl\b\002{ \374\200\301^\n \025\206\"\240\301u\035\246F\353\317\332\301\0175R\201B \b\250\007\277 \322\320\350\204\"!\360'\354\005;lXy\027\030`\025\002\221\364\212\252hj\302o\bLQ\023zk\357\203\244\023EB`\n \352CS\bP\236\t;T\355\031\021s(\357\304\206\017\r\225"
+	.ascii	"\221\002\t\017"
+	.string	"\320>\021(QO\r\002{D#V\243\"`\220h\204\020\330;\032\341K\325\021\"<\240ko=\341\002B\240\bI\351Np8\364\200\227\303R\245#\345\252\214\327\025L\345A\033\223\017+?n\034050\270\200\243rc.\236\b!\313,\360l4Od\214A\245i\322\246\310\315aa\270\t\003,Va\231J\246\202\251\354F\246!A\026u\365\346\006$$K\311R\362W\216\316\223\331\023\r\241\257\314L\303\203\006\033\246\327\212\031c\210\340\245en\306V\324\332\315Sn\323\216\307\0336\254\233\017\204#J\246\321\003\306\342kM\027n\312\314\033A\246\2702S\231X\222+(\031\371\264\343\254\306\315Y+/\237\267\236\267n\336\302qq\247\023\030\246\234y\271\334\031c\201I\303\t~\221\305\252H\361\272\231'\203\352\250\242\t=\311i\205\314\314\210\210\214$I\322\030\202\n\020\204\303a\230\366\330\035\022"
+	.ascii	"\024A\224J\246\214\b\211\210\202\202\244 \205\312\260g\324J4"
+	.ascii	"e\032\311Z\035|\310\020\017\204\036\327\025\032'\033\304@&\327"
+	.ascii	"(Bou\242{\256r\261\303\266\356]\340g`d\226l\274,\202H'\233\306"
+	.ascii	"\367\210\016\227B&\333R\007\305\031\002\314\003\273P\027\thh"
+	.ascii	"J\225\245"
+	.string	"\2366O\255\252\212\205\371\227\003Yz\naL\252\317\27417\353N==}$I\323\257\261g\220\211\007`\254\337\276\255\036T\351x\377\217X\237Z\320=\350\030{\372\355\370\2261\354\315ur\003\213\013\020|G\211\bE\255\036\364\342\251\3622f\\Q\334\314\216%#E\317\246\254c\332\225\342\307O\211]\017I\336\231E\201\331p+U\260\306\267\324\031gjU\220\222\277\206&\316\237\324\353\342P\0357\333\304[\\\343\037\336{N\207w\230\347\377Q'\251\253|\224\\}\273\260\352\017G\370\236\326\326\357\344\363\344/{Do\311\200\034\351\330\013\236\3730?\305\035\177#\022\316ZsL\275bv\256u\004\331\003\013\246\r\300Zs\377\031w\204d(\361\262J\032\tJ\343\302\352tN\234m=\024\363\352u+`\274\351||\314\350\n\306Q\270\240\310\347\316C\277\265x\367r\261\264\037z\256o\324\033o"
+	.string	"\260Q\255.[\216\357 !\312\321\350\370\211Z\246\374o\005+\030!o\rg\3738\366\242u\351\257P\376O\210\201\265\302\032Du+>\356\025\223\230\322\361y\003\342\216\211{\336_,\320\261\030<?\0238v/\323\315MZ\243\251\b\302@\\\342p\376\325\372\226W\2369\317\263k\177\326\034\260\305\215E\272\356Vu\tK\244\251#~C\352IS.A\247\343\311\376\347<\370\r\255W\267\237<H\345\216\240o^p\362\211>\351!&\214>)5\002O\274q<X\335\b\364CAb\210r\306E\322\213\3725\360\272!\200\344\b%\317\2161\254ym\217\205\302\373q8WdX}\353\027:'U\310\203\344B;\bF\020\331D\022l\275:\361"
+	.string	"\227$\261y\323\002\257\303\375F;(\244ca\031/3d\267\244\266$ P"
+	.ascii	"\002\204\016E\267n\365\366\325\207\220t\355n\225 s\330\3663\331"
+	.ascii	"<\036\273(\004V\200*R%V[E\313\3371\251\235=\034!\277\254\340"
+	.ascii	"\210\210i\206\330\271\276\370@`\252\035,\253\037d|\325d\230\374"
+	.ascii	"i\370\215\311\031Fp\f\260\016e\306\237\007a\t\320\350,R\306\242"
+	.ascii	"\261\313\261\352\325\273\312$\215,\345\264\312\0234\255;\275"
+	.ascii	"\246\201g\247{\212^"
+	.string	"\225mJ5\tY\306\247\272\031\341\372\203\273\215\217\251\314\002\242\004\275\0167\355\312\033&\001\234\346C\313P/l\022j\346\232\013\344\242Z3\013>\366\255D\362U,67?\375\230%i#\030\202\023\212\246\006\202\013yjM=wr\263*\312\377Y\215\373@\227$\247\313\336\224\032IP\316\215KW\274S`\305\217\275\022\247\2668\241\266\200z@\007\255\266\276\317u\346\336\244\354t\211J1\346K#>\002\316L\221;\273\016~\261W\263\033\211\030r*\362\006V@+1\"\005b\023wA\356\326H\t\353T\360\273:\375\255\242N\2704\303\233\364*\345E?6\213\361=\222\032\025kq\001\316@\207\bJ\237\n/\177\234\tQ0K\005\330K\006\250\211\245\237\356Z<\3345M\267Do\006_9\243\035v\367\325ph\3601\326\354Ow\301l\275~\266\200<\260/$ez\200BH\374[S\375\366"
+	.string	"\350\2734\312U\022p\032Q\214\205\271kVd\277\005\032\2357\207\022/\005\251\025i~\303\243\f\236Nt\b\257\357\322\"@\025s"
+	.string	"\210\341\250;g~\234t\341\262\312\"\274\246\023\225$&j$\312\3730\235FE\250\207\0203\\\267,\036y\262\351\320\316\022\3129%\350\227\202I\251W\223xyX\274\023!\360KO\223B\021M\354\3133\227\023\003oT\257"
+	.string	"L\373P9i\216\260\031\244\225Ucu\307\211\251lI.\260\214O0T\273\263\2307\004\0250\211\227\230\260\277\222[\007\354s\246\206\262\360@\3732\262l\264\254\t\233\240\307\260\343s\337\020\"\016\277\351\321N\344\342P\330\304\244\340\274-\037\247\247\235&\323w\264v\202v\302 \366\325\357\364\354\034 \030\031\355#\261\206${V\036\244\273\347(m\tP\250\242\301\033Ndj\230\223%\254\017W\372"
+	.string	"q\334\264\035\213\025Ij\027\330\2752\016\253\314\263\312Xy]\355D4\2702B\235\"\244x\203\n\007PK\261q\224Qb\323\200}\353R\351\242\201\244J\372\2032\"\215\027\017\253\322K\242\035\270u\334\r\326\267\267\200\013G\032\224\214\203\233b\036*%\364u\322\023cm\224\264!\217\3302<\t\276\255\242=\206\250\223\035\3279\030k\242\030c+\013"
+	.ascii	"L9,\304\002w\217Q\245d\027\034\374\022\bks=\355{\274\b-\035\366"
+	.ascii	"\246\211\021i\263\320\352=\341\203A\230`\317\2253\003\004t\304"
+	.ascii	"\n/\364\321lw\366\301\352jEjyj\221\245\366\202\350\214\277\247"
+	.ascii	"0\236\262\316\375\222\317\035\374\265BaNv\350\225\370\365\316"
+	.ascii	"\246\201C\212\002CL4TPP\303&\254\273\013vI\310\217\256\273a\f"
+	.ascii	"\354\325O\345\205\361\230G\\\301\202\020q9\017Fy\336\371e\215"
+	.ascii	"%\307r`\f\214o;W\376 \331+G\312e\377D\342\222\2419k\332\201\035"
+	.ascii	"\364p\224)l\204A\r\b\237=\270\004\022\375O\300B\275\006\303\362"
+	.ascii	"KT\375\273\324\0369\025M\333J\3453\312\211\322\365\303\033\032"
+	.ascii	"y\226Q\004\320\325a\356\232{\302O\323e~4\343\261\265\3111b\031"
+	.ascii	"\210\034\t%\237\270\326\274\302\3228\371b\257\241\2447\002M\302"
+	.ascii	"/\220,\213>\353\273&\353\213\365\037\037Q\343\002\020\276\016"
+	.ascii	"-\255\026\265\256\021\343I\240h\263R\321j\237\205\272\205~\377"
+	.ascii	"\023p\336\005\225X9\274t\332(\t\324\2565C\302\232\006Z\302\221"
+	.ascii	"\036\376\021\234R`\345\2177\373"
+	.string	"\221\361\031\003\n\310\323\037\376!>`0\253\n\177\027GY-\021 \206\322\335|\231\3177Q\343mh\300\241\356\364^A\032\203\365\017\200\363D\fg2;S\030yw\203\226\241\021\302\264\344\nm\350\212\337\201f.\376\272J4\217\346\371V\203\321\216\363\f\177\277\316@L\032\342'\201\215\270\317\372\363!\315\027\372O\221\234\227J\026\247D\013g\207\341\313\224\017\214{|\260\241\304c\310\356\231\233\206}\035HG\370=\263n\007\353\211\262\207\234x\313:\002\232*;\217&~\350\34334P\310/\327i\234\n\277\227\t\036\005\261~\350\270f\033\364\355\262x\336z\177\230\305\237\274\364&Z\246a|\240\375\006\336o\230\215\217\007i\376D\270\366\273\300\307?|\334\220\371g\303\325\324"
+	.string	"n\256\305>\220\017\t,\013]\022\263\030\016\231\257\002{\312\37767\347\333E\005\217\211\223m\016"
+	.ascii	"o\234S\313w\361\301\227\251\025\256\253J.\254\371\216\262\270"
+	.ascii	"\342N\0166\0300dj\210\230\234\370*\261\271\336\321 \372(\234"
+	.ascii	"\207\035\260\211\364=\360gi\016l\303\366\337}z)\312\035\313d"
+	.ascii	"\326\320\343\273\337\313\303\304\265CK\004\214\322[l\217\326"
+	.ascii	"\237(e\270T\006L\030{\234\326\206z\272\336\236\314Ha\3402Z\001"
+	.text
+	.section	.gnu.lto_.symtab.7a9cc86c6cfc13cb,"e",@progbits
+	.string	"failsafeConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"failsafeIsReceivingRxData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"failsafeProcedureNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"pgResetTemplate_failsafeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"failsafeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"failsafeConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7a9cc86c6cfc13cb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
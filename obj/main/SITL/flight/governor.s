@@ -0,0 +1,716 @@
+	.file	"governor.c"
+	.section	.gnu.lto_.profile.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375 \263U\004"
+	.string	"\204\006\247"
+	.string	"\022"
+	.string	"\367\322\273\212\002\b\002"
+	.string	"\002\001\002"
+	.string	"\002"
+	.string	"\002\002\002\001\002\003\002\003\001\240\342\234\212\n\002\003\004\304\366\222\372\n\006\002\003"
+	.string	"\002"
+	.string	"\005\006\347\372\224\247\006"
+	.string	"\007\b\354\206\342\366\006\002\t\350\300\306\254\005\002\n\013\f\260\251\324\320\007\004\r\016\313\351\223\364\004\017\277\351\341\253\005\020\365\372\377\367\006\021\240\342\234\212\n"
+	.string	"\r"
+	.string	"PI\241yX)+\254\332\271"
+	.ascii	"k\212\267Q\313\250 \347\331H\316\035\220{\312u\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375 =}\001"
+	.string	"\004\0021"
+	.string	"\t"
+	.string	""
+	.string	"\001"
+	.string	"\001\004"
+	.string	"\001"
+	.string	"\001\006"
+	.string	""
+	.string	"\007\b"
+	.string	"\003\t"
+	.string	"\003\n"
+	.string	"\003\f\003\016"
+	.string	"\003"
+	.string	"\005"
+	.ascii	"B\t\2442#f`\020\320\006\260"
+	.text
+	.section	.gnu.lto_.inline.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\035\005"
+	.string	"R\207\030\"\2207\351\200\337\355\rN(\344]A\327}\2321A\354\326tgf\346\323\322\220 i\352\326\310\226;\005#\363\260\231\177\205?\322\373\306\247\310\215\3352\250\203/\304$EkE\365\217\320Ef\256\023\301\341\356\037"
+	.string	"\024\035\231\331\n}HQ\243Y\261\353u\222\207\232\231\331\364\021\302\004cR\264_>C\033"
+	.string	"`\004\360\301b\004K\304\r\261\332\230>`\007 \017Xv\324+\2007\3061\217Y\303B\333L\205K\304\b4\f"
+	.string	"\b\370\302P^\345\001-\006S\232\342\223\262\230\251E`\021\243"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375 S\r\002"
+	.string	"\364\002G"
+	.string	"\t\004"
+	.string	""
+	.string	""
+	.string	"\004\002\001+"
+	.string	"\001\300\004\001"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\017"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\b\n"
+	.string	""
+	.string	"\f\001\001\003\177\002\005\016"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"Y\211\200\022\376Ka\273\320\226p7\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\230\004\004\230\004\006\230\004\007\230\004\b\204\004\t\204"
+	.ascii	"\004\n\204\004\f\204\004\016\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375 h\375\001"
+	.string	"\024\002\\"
+	.string	"\006"
+	.string	"\001\002\006\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\001\002\007\006\007\b"
+	.string	""
+	.string	"\f\001\300\001\002\b"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	"[\321\020*\350Q\026(q\270\bp\317\251\342\232aw\241a\006\002\001o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.fd1c85731d9e7f22,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_governorConfig_Registry.23.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375 \241\265\004"
+	.string	"\204\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\254\210\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\314\007us\337\006uq"
+	.string	"\005\001\006'\001\024\005\001\006\035\001\001\254\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/governor.c"
+	.string	"\004"
+	.ascii	"_\304\202Y<E\3357\200\""
+	.text
+	.section	.gnu.lto_pgResetTemplate_governorConfig.25.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375 RM\002"
+	.string	"\304\003E"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\350\007\n\320\017\005\001\006\035\001"
+	.string	"?\202\210\200\320\001\177}\277\001{\276\001y\275\001w\274\001u\273\001s\273\001q\273\001o\273\001m\273\001k\273\001"
+	.string	"\004"
+	.ascii	"@\004\314\213S\206\036@\021"
+	.text
+	.section	.gnu.lto_governorInit.31.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"M\b"
+	.string	"\362\21666Po\322\001\340\220F\213\362\265\360\325\220n`\t\005\347\313\tD\226&\232\246\326\004}\2745#f\200\246\365=3\263\341\352\364\352\027-R5\300?\255I\333R\246\024\016}\256X\272D\024q\004O\016#\322C\003,\221\026 `\3502\301O\201c\204\350\202\247\030/\350\341R\327\225\025`\272\224f9\260\027\037\035.\313\355\301\223\346\275N\332\022\246\274fM\365\204ue(aQ\245\214_\332\025\026y\355\032p\342\321e\212\262\271,\025\304\376[]\331O\337\262^V\bTv5jf\266\333\240\214\330\276\307\230\335rNd_\242a\230\304\354.\324\220c\177\232\230\317\001\001h\033\352\257\303q\025\330T\317`wO\362\314\330\262L\016hw\235\332\266qon;\3016\202\355\224\022"
+	.string	"3\001\013~\b\024\241 \031Sp\007\214\001\325&p\001{T\227E\n\213\2700\362\005\233_\206"
+	.ascii	".?0\312PC\266\253\224\001"
+	.text
+	.section	.gnu.lto_governorUpdate.32.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"\205\b"
+	.string	"\242\21797@\217\322\001\320\343jL\334\245\027\206k\305\336\n'\350\244\002#0H\001\024\374\206\b\345\327j\241\203:\354\372\252E\321\255\360qot%\tS\307?\374\267\266\245L)\016\201\264\254\244\211,\262Q<A\214H\021\017\261Dj\220\210!\315\024A\006\316&DZ<e\231\026?\337\036\256\256\314\300\362\312PT\016\254\306\207\tl\277=x\322@O\332\024\246|g=+\006;QWp\256\016\256\227T\306\f\323\276\300\310w\327\200\022\232\027J9\373\343RA\354\303\325\225\375\3649\235\225\226\002\227]U\315\314\2766)#\266\377\361f\303\374c\355]\255\r\022\231\335\215\032\362\355Ps\363\337:@\347q\207\036\217+D\200\241\304\bx)H\240\022\351\336zrx\250\314\216\302\356:;\257\343\336\334\366\202\355\004\333*\001\017"
+	.ascii	"3\241\267\037\003\212P\220\314h\024\366\002\325<\360\242\272"
+	.ascii	"7RX\317\205\234/X\177\031W\\\272\230\355\320\300\024\024"
+	.text
+	.section	.gnu.lto_getHeadSpeed.33.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375 \372\315\006"
+	.string	"B\r04Pm\222\016\244\204\350')\203\202vT\206\257)\3466z@\260\034\365b\331\332\033\"\254\202\251!\237\367\307\315\314\024\261\202\311\275\027My\031\253m\255\221-Sk2\227\345\2716\017\026\347}\0248\235\205\204\347\351 0<\315\345\3602\003[\r\233\353},\353z\027-\373\3500!\027\361\r\251v\351\216\206\230\204\315J\335IU)t"
+	.string	"\025!\334^\003\241\313\370N\3510\2768:\013J\tAJ\346\304\266\222$\324\b\307\217\375\345z\364\003\373\322\244m\214jr\"!\242\222\231\017S\201\252\324\324\200\252\224\323(V\304nA:u\\l\231\bT\264\034d\346\230\211(\272\353_\360\033\374\026\001\b"
+	.ascii	"2\003\3020\037!h\327\304\335\b\254\205\310\304]1\265\223\f"
+	.text
+	.section	.gnu.lto_getGovernorMode.34.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375 \350\215\006"
+	.string	"\"\314-4@\215\222\016T`\2343\211\325X\360m\302 \367%Lt,\321*\033>>Z\037\307}\024\005\200\310\303\3652\f\017\251x\256\312i\375(\177\030}Cd\313\024k2\317y\336\006\302q\332g\201\323aPh\236NBC\323\274\207\226\t\3309l^\3738\367\032\346\312\262\023\262\201\021\223\370\2024\304\272\034G\200\260\244V\027di\205\f\300b\204\251\277D\3102\276\225d\247\037GvA\231\b\220d\226R)YR\215t\374\241\307lp\020\332\352\265Q\262`\240&DP2\257\3064j\025\255\333\217V<.NH&Q\361\202\220\231#\311T\321Y\177\202\277\340\247\b\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getGovernorState.35.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375 \350\215\006"
+	.string	"\"\314-4Pm\222\016$\243\252\022\252\232n]\200\001"
+	.string	" o(M\225\177Kv\325\376\335\016\360V\301`\036\313\373\343ff\212D\334K\245L\020\203\236\315Z\373d\313\024k2\325\363T\233\210\307q\037\006N\247a\301y:\n\016NSA\270\214\300\357aS\271\317{\225\303`\331f\30260j\023_\220\206X\227c\t\020\366*uA\226R\330"
+	.string	"0F\230=&\302\246\361\255d3\3758\266\200\213\223\202\221LR\226\222&TI\307\037z\314\007\b\241\255b'\222%#\243\020A\311\304\\\333\250U\264n?Z\3618\221\\%Q\361\222\220\231\343U\262\350\255?\301o\360W\004\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getGovernorOutput.36.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375`;"
+	.string	"\245\b"
+	.string	"\006Q=7@\217\322\001\2335\220\375\333\343\263\374\325#d0\223\361E\362I\202\r\313\324\254\205\017\315}s\330\327\214ze\212\242\270^\206\301\0138\2760\224\270\267\261\266\367\226)\005-"
+	.string	"."
+	.string	")"
+	.string	",\031\251\222\227\335\215\234\023d\016\337\0072\207\256\343\332U\363\037\362\227\342rQ\255NW"
+	.string	"\207\335\265\252V\033\267\273m\003\333\n\266Q\002\002\254\225\203\226]\215\031\314\252@\231\207m\315\336\330V\265\027\030\264\303.\354vY&'\273[\202\0214\207\266\375\217\203hv\354m\256\327\003\273\r\276\310GH\376\353\320\024&\275\352\3207\271"
+	.string	"\231\272\273\247bP:\263\267\223:\016\373o]\313v\352w\330\257\252>\fS\226\244\b\332\323\231r4?\025\022\024K\021\240\220\004D\034\205\036D\3213I\261S`9\361\231\261$\345\214\233m\377\326\265\236\343\240\034\206\305I\034\323l\n"
+	.string	"2\241\271/p+\n6\026\217bb"
+	.ascii	"A\271\206Gb\342'\246\302\230\256I\006"
+	.text
+	.section	.gnu.lto_isHeliSpooledUp.37.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\305\013"
+	.string	"\206\225NC\020mj:\243\033\f\252\304\203\310\272y\316,U\0173\240\303\301jW6\377;\270\326\003\273/7\317\032\353\230\323\374\216\021\236\300\244\033\002`\003\200\230"
+	.string	"D\004\241[\213-"
+	.string	"Y\024"
+	.string	"\003\0076![\246\024;"
+	.string	":"
+	.string	"<"
+	.string	"\266x\203A2\370\321\205z\313\200\200\n\261\335\261\233\b\016^\233\n\372\341\265\213\267h\360\001\204\210\013)\325\247I\303\354n%UR\235pv\327zJ\021\270\267\333\316\260}a\237#z\302\376\353\017H\374\005\0060\322\237\276\371#\356\333\347\305W\250F\254^\005\002\350\314\036C\235-\373\332N\226m\265\252\372\332\006\211X\211L\207]\324\314\304\3026\r\fl\223\034\234Pe\332lExe\003,T\231\356n8m\341\244K\345\340aB\361\013'\341\023N\301%e7\374jn\277p\337(\256\335(\310\340 \266\007\354\217\266\313\177e\273\324\323f0\246\356h>/\364yJ\274O'\372\370\200@<\272\020\250#\244\353|#\235\346bO\304\363u\"\317\373:\313\270\237,o\"I\316\037\344.^#D\002\022\203\372 \247s\200m\235:K>\204;\027"
+	.ascii	"c\b\330[GI\332\272\267\261\b\raf\211\240\204\301\261\237-\273"
+	.ascii	"JT\312-F-\"\324\252;\fq\025\327A\205\342\232\210\202\005aC\344"
+	.ascii	"q\327MU\303Q\367wYy\002"
+	.text
+	.section	.gnu.lto_governorInit.part.0.44.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375`9\0025\022"
+	.string	"\206 tG\360\360$\035^\253\207\242j\272\003#D\256\323A\322\267\233\b\272\021Z3\234\271\322c\232\335\223\276'\340_\304\367C\317\312\260P\266GZ\236\b>\003\343gf\327e(:\334Y\321\342\215\370\227a\2545\262\267\224)\005["
+	.string	"^"
+	.string	"a"
+	.string	"WA!\375\370\345C\226>G\234\372B/\233\343.\257\302\366\313\3060\366\323C\236y\"\220\246\2106\347\354.\267\304a\036W%\214\2579K`,\346\361B\217\262\0207\300\330\207od\325\230"
+	.string	"\271\330\027\021\314\232t|\304`\252\004.U%sN\257@\334\333m;\260\335\300\326\233z\360\322\367\266\313/"
+	.ascii	"\237\243\035C2Z\323\335\361\312\307\271:\366\246\336Tj\251R\307"
+	.ascii	"M\275R\255Q}\001\003H\202\346\254\251\361\230#\244\354\204\332"
+	.ascii	"\020\275\354R\362m\320\020\221p\230\202h\023\026&`\361\026/v"
+	.ascii	"\t\ty<\004\270\301y\361C\2333\354.\035\236\265]\256^`\273T;4"
+	.ascii	"`*\345m\375\246\313\274\024\301JV\312\001F\311\335\334\364\217"
+	.ascii	"C\216\214VcE8\355\005\265\332\023lN\231\003q\345\206\024\315"
+	.ascii	"\240\370\264\346\335\270\247\351\241\273\273E33\tW\232\220\244"
+	.ascii	"\313A!\001\r}}\030\217a\342\367\370\244\325J\002\243l\224\273"
+	.ascii	"PY\315\tS\340\033\375\250\202\337s\351\025/N9!qy,\256V\006\017"
+	.ascii	"\245kIAQ\261@\241cQ1Y\351N\\\030:\022\021{\027Z\256\256\305\363"
+	.ascii	"\\\035g[\037\347\352\230\001\016'\231\375f\204\n2gH\210\230\315"
+	.ascii	"\360:\025Yj?\200\240\007\rb\004\344\364m\214\f\333\257\221\325"
+	.ascii	"\310\345\207Q\n\247\030\235\362\376<R3\246\335\035\333\"\333"
+	.ascii	"\327@\007\033D\0011 `\002\021tF\017\020\304AV\341A\371\226\327"
+	.ascii	"\203cPX6\260.j$F\274\005lZ\332\340\343\nd3\346w\260*\206\240"
+	.ascii	"Xp\223f\223\334\034\337:\305\222\306\206\370\221\025\254\221"
+	.ascii	"ld\246\257\374r\333a\351U\374\036@a\331\320\313\254\242\235H"
+	.ascii	"\342\034\021_\334\354\255gjO!\300\340\001qJnh\266\314\274]\026"
+	.ascii	"\302\355\001\204k\316\271\327\2521"
+	.text
+	.section	.gnu.lto_governorUpdate.part.0.45.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375`T\001\375\r"
+	.string	"\366\230YC"
+	.string	"\221(\035\020\310\361X\270\254G:Q=#\004\335\317[\244;:\254w\n\344\344\327\223+\270\022\020\344\263\225\373\025\241\310\213\366\217lk\377\377E\226\265\376\370.6j\367\026\257\003\237C\277%{K\231RH"
+	.string	"@"
+	.string	"G"
+	.string	"\247\nF\3313\2562\2317q\022\202\342\306\2343\273\334\017G=\256J\224\257\034b|`\367x\224\307\025\r\341\007^\370F\001\"!>\f\364b\201\226\013\033\032\360Cus\211A0\347t\006\303}\335\366\002\333\037\373*\001\372\375\334.m\372O\227"
+	.string	"\205\355\214Q\273C\202\376\373\016\b\261\300\362\266\323-\361\312\307\271$vT\313U\307U\357\252U\325\007\020\340\200\313\234\"\241\313\354 WD\330G9\331\030v\371\023\333\001\254N_\274\277IK\253\305n\211\355\316%7\001\313\207\266\330O\361UH\244i\327\245\334\005e\214\030\211{b\2445>\032)\r7\356A`x\032\332'\361\022V\361A\230\344\024\351;\345\272\3345\3002\222\322\320\034\001\026\201\270\315\304i\023\266Q\346\361`D\202\340 3\221B\245L\304ud\240\216\267\b\032\227yl\033\227a\266\365q.\211\025\274`\245\326c\241R\316\004\361\260\2425U\327\227\270Q\233A\003\375g\316j\203\n\333'O\306s\251Ye\b$ p\002\0313\263\003\345\211A!j\301\3011\250,\033Z'0\022\242\334\217a\001\330\264h\003\343|d3X2\330\232"
+	.ascii	"\220B\213\222\023lmV\030w%\r\207\3328\251\335\222\307#\214\030"
+	.ascii	"\2765\036\032\274\370\206\336\226\231\267\335BP{\240p\215\237"
+	.ascii	"{-\036\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375`%\001%\b"
+	.string	"\224\013!\002"
+	.string	""
+	.string	""
+	.string	"\002,\177\t\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\024\n\201\204\001\032\013\035\f\002-\177\r\034\016\002\037\177\017\272\200\202 \177\020!\177\021\"\177\022#\177\023\005\033\024\002$\177\025\005\036\026%\177\027\031\030\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\027\031gistry"
+	.string	""
+	.string	"\005\025\032\001'\177\033\377\037"
+	.string	""
+	.string	"\200\200\200\001(\177\034)\177\035*\177\036&\177\037\003"
+	.string	"\022\320\360\372\250\001\001\344\006\003\004\025\244\006\003\004\024D\003\004$\003\006\026"
+	.string	"\002\001b\003\007\026\004\001$\003\007\004\320\360\372\250\001\001b"
+	.string	"\037"
+	.string	" \n\204\333*\344f\363X\233\241\271\f\n\324\003\200\003\200\303\007\b\375\2276-\301\360\374\2360&97\f\276#\2329\202\321\2343\330"
+	.string	"\364"
+	.string	"\337"
+	.string	"\177v\022"
+	.string	"n\314\341\032F\035\002\006\214U%"
+	.ascii	"c\220\270\264\312\023"
+	.text
+	.section	.gnu.lto_.refs.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375 K\275\001"
+	.string	"r\204\013\021\220U\303\001\377\377\017\206\266m\333\370\337[\312\224\002\"\002h%;V\206\305N8\354R\330\215g\003\2511\273Y\346\331n\225\366\265\250\201\001"
+	.ascii	"\376\240@\001"
+	.text
+	.section	.gnu.lto_.decls.fd1c85731d9e7f22,"e",@progbits
+	.string	"(\265/\375` \025Eh"
+	.string	"\232\257H&P0\224\322\031\016\323\307\003\335\250S\353z\325n"
+	.string	"\364,\232\357\352\325t\253K\311\366Wf\nV\b'\313/\r\300\276\245\216\305\365\2676\002\006$\310\213\231$\005\306\251q\272\303;\361Z\001\330t!5\321v\306\025xy\272\362\361l\336\264\211\224)\372\001T\002`\002B\337\262\025\3471\271\266\317\031E\214\021'\334\274@\225\302p\261b\363_\262E\203\023\033\203\263\205\353\027\352b\003\023&\216\325\226\023W\336\264ly\202K\2279U\304l\226\236\\\267\022\316\324z\371\205\276l\226\rK\302\201U\333\232Ub\305V\315\206-\233\035\3336\233f\3016k\321\254\231\357\327\2369\257\335J\335-\364KP\301\242\3311\353\265aI\f\244\234\241u\257\237\340_+_4\253\265YZ\354\350V\372\200\300\021/Nnl\335k\003@\r4\2203C\353\202\204"
+	.ascii	"\346*\227\305\031\300\236\241Kf\223\330,\027[\346\022Tp\034\021"
+	.ascii	"K[\245x\253z\233\303\346\227\r\372uq\356r]\234\3373\350w\013"
+	.ascii	"\372\255B\023P\202F\360\003\372\r\202\236k\211\350\303b@\217"
+	.ascii	"&\002\272X\366j\263^,\022\337u\253<W\\{\355^}x\211\233\226+6"
+	.ascii	"\357\001\372\305\372\001Q]\301[\240\337\027'n\271\334\027\347"
+	.ascii	"\031\345\025\347\317\2628\377\245\362\357\224\265r\20132)[\253"
+	.ascii	"{U\341\263\ni:\302\346\327eq\242\273\342\004\256Q\377\333\313"
+	.ascii	"\341\305\212\177\227\377\302\200\303\336`\303M``k\020\340_7,"
+	.ascii	"\376\237?\013\241p\235\237\021\320\255X\r\314\237}p?\353\226"
+	.ascii	"on\377\323\026iO\365\177\213\213\375?\363_\315\3774\377\321\374"
+	.ascii	"_\363\277\315\1776\377\303\376+\361\357\003\377w~n\341\337\033"
+	.ascii	"\377\262\360\357\n\377\246\360o\215\177Q\370W\205\177[\030\376"
+	.ascii	"\273\301\277'\374k\202\360\377\317\317U\377\312\360/\360\337"
+	.ascii	"\243\177\213\376\345\375\373\302\277.\374\013\301\277@\377\252"
+	.ascii	"\370\327\347\337\235\177u\377"
+	.string	"\352\374k\376\177\373\257\366\357\376_\376\237\363\237\355\277\234\377k\377\313\376\223\360\377\354\177\231\377f\377G\370O\366\177\354\277\325\377\004\376\177\375\347Y.\227\313\237\241~\334\233\337\307\030Y\214\\3\234\221\306\324\362\254B\244\b\247\253\246&vb\303\244[\267\024\341\205\177\234\235f,U)\262y&\326+'%\347\315\326\023\037\354c\275\2000\240jC[0H\212 I\322\243\007\363\240\361\323Ib\313)\235\033\023\231\255\247\245%\346\001\300\224\016\022Rm\234\244\r\022\b\217\365\332q\203\214B\205\315\233<PN\342$V\322u\213\235\241\365T\375\320\003\222\225\266t\311%\3076\364g\"\023\237@\353\311\332!\315\313\231\333.\335\336\376\266j\333\307\356d\006WS\320N\265\2450d\300\320\343\264\332\376\235\263`6k\333\276Ec\247\246\334\320\370\211\020P>\3304qS\330\262\226m\275vm'\n\234(\343"
+	.ascii	"\212 ceF(r\276Y+g\341\004\255M<\271\274\216I\007rS\250hma\363"
+	.ascii	"\270\"\350\022\273\266\304\252\235\335\273*\235\216\235<\006"
+	.ascii	"}\343,\3327-k\323V\r%v\023\327v\332+\035\236\336\330:\231\fB"
+	.ascii	"q\325e\b3f\342\253v8<\335V\335\335\"\247\206\252\311\2264\364"
+	.ascii	"\f\206\236\377\263\213\307\356\006\222[\373\230\304\363\315\355"
+	.ascii	"\006\375)\026\267\013tC@\325=\304\332\032\ne\253H\204\315~\224"
+	.ascii	"n\242\212^\373h\304\212\"\032\263\324 U\254md\200\306:\322\306"
+	.ascii	"5\ni*\233{\355m\245(\244\f\306Uy4\256J\342O+)\211\335+\362\307"
+	.ascii	"\250U$\256\021+\ni\304R\"U\264R\023\033\253h\004UR\"\215g\224"
+	.ascii	"\310\037#V\021iT\212B\252@\262\266\344\207\016V\242\266\026i"
+	.ascii	"T\352\037MP\305\343O\230qU6Y\367j-\365q\201n(\345\221\254\370"
+	.ascii	"\264\\Ia?\222\272\024\225\273v7\001MIR\312V\n3R)\273\251\222"
+	.ascii	"\212\272\211\002\342\032\326Bl\030\361\bT3-u\027\320\324M\334"
+	.ascii	"\016\353nbw\353\034\241\326\356\036~\214SMM\335I\240\246\206"
+	.ascii	"\"v-u\263V\031\027\322\210%\245\024\352B\002k\252y\254\30452"
+	.ascii	"){\252\311\242\216(\026\361J3u\367\252\241S\310\035\322\330<"
+	.ascii	"\003\3421\333Zj\261yN\202\376\373\306l\305\3041\363\306\346\327"
+	.ascii	"\354[\254\354\001tYmc\240\330\224 \350\023\224\252\036dc\346"
+	.ascii	"\0332\313'\330\3445\314f\263\202\270\315uJkc\361\024\205|Ic\206"
+	.ascii	"~\203N\237\r:\177\256A\303\3028\315bI\002\204\212\255;\031\224"
+	.ascii	"\263Z\337\260\330|\232\247P\003\304Mo\2011\330\302\t\372\351"
+	.ascii	"\226b\343R\223\226\325c\212\223\263\024\236\302N\370\f\320\225"
+	.ascii	"\225\330C\306\313G\331$\b-6\277t\212cm\274\232\240_\253*\274"
+	.ascii	"\276\271b\226\305F\240A\303\302V\254\312\230\212\030\326\302"
+	.ascii	"]\033\226\374i\245/lhUX\fc\221\221a3\354\305Ip\030\036\303e6"
+	.ascii	"\213\305\260\326y\n[\035h\301\260\030\276r\343\2636%\313\323"
+	.ascii	"\217Y\345g-\222\2144\252\300a.\356:\320\332\255\325\305[xk\303"
+	.ascii	"\222k\003\331\361\202\226\266F@\003)\322\326\220\0219\267\276"
+	.ascii	"\364tY\221\250\261\311^t\222O_;~p\331,\356\2022\021\245k\316"
+	.ascii	"\317v\222P\"u\372@\177\356@\237cc\224\rZ\021\2604\36498\350s"
+	.ascii	"c\350sj\320\347\314\240\317\215Y\331J\016\313\314\032\230\025"
+	.ascii	"/\026S\202)\251\013M \350\b\256\362\221\302\025\004\227($(A\303"
+	.ascii	"\205M\323\b\376r2\325TD\017Y\023-W\250\270,\327\206\260\311P"
+	.ascii	"\320\245\334\325\013\024E\276\374@\204\3153\224\237\2110\021"
+	.ascii	"4,\335\232`\363d\313\342\344)\241\363\223\03502hV\330\344\311"
+	.ascii	"-A\277U\313=\234\207\340\036\230\t_"
+	.string	"Y\211\301/(\007N$\\U\3115W\266\206\b469\t+\341%\277N\027\206I\fJ\n=\013\201\"\211\032&E\260\311\3731'\007qF\362\353t\254\216JZ|@\317G\030\210_\207s;\023\246\007\233\317\tA\317R9\230\031\251b\223\243\320\245\034\217\027\2722,gK\330<G\375\\d\265\260\021\030\272\225\230\211H2\016\233\374\003+\317F\330\207f#\024(\273\213l\304\347\211\356\242\317\256\002\273\n\230R\244\234l9\315\347\212h\317\2568\231\210\320\031\212\235h}}\261\231\302\024Cy\007\336\201\2234\032\210!Ool\272/Rj]I\026\362\004\212\024\023\233,\204\231\007~:\013\341 <J+\0131\273\213\273\n\364\354*\220\033\303\244xu\2327\225@ozA\006=\037\216\037p\206\372C\002\316\020\340E0\206\006\250\035\214`B\215\021\324\264\227\342E0b\f\205i\016\237\220\250"
+	.string	"u7\274\201\016\201\302!\337\321I$\344\021\375x\252\215"
+	.string	"t\004\2013v\352\213`\364\2021z\301\025C?\244\017\324t\270\363\303\301\271\341\216G\335\375z\301\334\257\027\304\025\251\275_jt\2464\370\206\346p\230\n\211\210x::\202\300!S\250\006qO\241C\250\016}\275\264\306n"
+	.ascii	"\242\364\327\363\031\361t\210\322!\222\371\003\016u\316SyD\302"
+	.ascii	"]/\b\243G\310+\0322w\251\3123\n\036\245(\250\3510\255\321\013"
+	.ascii	"\036`\004\004z\260\313\005o\020\2456|F)\215"
+	.string	"\241\317'\007\260\247S\221\202*R\t*R\225\247\332\370\001AM{>j\332\343\261A\304Ki\364\244*\217(x\243\206\220\227\202\220\022\001G\310\001\354\351\034\245\352P\207\r\026\037\342\211"
+	.string	"\206*\344\005a\250\276_\b+>\344\023\246\277\264\207\236\002\031\020\310\260`\006\235[pA\004\027Dp\336\202\013\204\204.\220!\204^\206\020N}\221\213\003\203\2510\206\n\004\nc\354\fw=\037\216\037p\306\217\272\263@'%\002\242Di\032\034\022\361\322\242\335\f\274#\025\351\221O\335\005\221\214\200\300\340\360\007\350Sy\302\235\220\227\366z\202>\024C>\243!\035"
+	.string	"\b\220\016\215\220\202G\276\035\016\034\2734\207O\035J\215\214\200C\007\250;\031B\352\317\207\204^HhF\0027H"
+	.ascii	"\001\035\202!\004\376\204i\016`/\206Z\324\363\031\341\210\361"
+	.ascii	"\363\361\216b\f\t\2071`\264\370\371x\275\235:\364\r\207\274\235"
+	.ascii	"\020\250\002\217\214|<u\227\003\330#\200x\206K\223|\362\205k"
+	.ascii	"&#;R\345c\231\006\205[\023066\327u\207\313\007-A\330\\\255\234"
+	.ascii	"\234\226(\331\344&\270\t\236\263\307&\246- \326#\031$h\016\267"
+	.ascii	"\361\240"
+	.string	"q92\204\333\330\2115aOLg\253N\207#=\234\330d[3@\246\016cVv\200\311Q3\265\fI\"\305\004\217\235&+\230\035kp\242\324\340\200a5&\\T\210T\261\271\304\022\314\343d\302\325\326v\036Q\204L\031\2568q8\315\225\020@\250x\250\244(\257\252\312\312\370l\343p\265\265\241p\372\021\204\323\233\363\031nL\215\313\013\233l\266^\037r\224C\306c\2731J\330\330\274\216\223\230\030\223\235Y\302\232(\023\201\271\250\2410\207\22043\"\"\"2\222$\031\016A\005\204 '\235\264\036\022\340\005A\223*E$IR\222\032\355\033\003\264Fp\274Sz\243o9E\335B\030E\306\020/\356\220\377g'\202Tu\372\375\366\376-u\004//fp\342\t\220\024\265\267\330\206\020\314\310\303\273~3\212M\236#(O0\022q\301.\3543\367\221e\326\226\001y\237\210\327\034>\261\357\203"
+	.string	"U\210\302\232\"\033R\345U\230{K\220\206I\021\255\020W\r\273\362\376L\022\372\240\345\3619\022v5\r\177u#j\346&\031\303\326<\272UVJ\351\203\n\\q\027#@\025&,\220U\356x"
+	.string	"\376\247\371\223\241&\217\335\351\230\177\255:\221\203t\217\013\375\204;{\226Q\224\n\323\220:\256\207_\366\263.6\273\030T\314-"
+	.ascii	"\360c\344\007\246\270*\323\237a%2\236"
+	.string	"N\265AW&[`\270O\211\004b\21788a;.\314\210\275a\bg\225r\305\310\371*\314\240\254!'8\331@\3116\367j\357\376Y]\236\236on\347;(\032\277-\222\310\265\311\216\311\320\363|v}\0202\373\f@\366|HI\377\2671\334\025GgA\351P\256f\240b\307\240Ly:5f\270\322\252z\313,\360\037\301\322\234\037pdE\350\030\246Q\204\031\341&\025'i\276\307\277d\022\213:U\235\002I8\230\260G'W\367\232\377\247\217\202\343F\335\360\330\207\264\231c\224v\214\316\236\314\001\325\361\231r\321b\235\334\024:\031B;\226t\311\274\344c2e\373H\363\2062ldo\277z=n\241\236\272)\313\212\260*v\215\200\216\206\003\306\030^\200\024\0212Zs\025xf\3006I\246\200\030\337\340\221\324T\240\037\223q#\272\320\301%\033 \234L\n\035{\364f\221\016$\255Y\356"
+	.ascii	"-\306\235\217\t\177\237\240\334\031Y\346FZ\324\336\377\\\371"
+	.ascii	"\344\r\210\354\332\2721O\"\001'\321\352^\217\360\247\364\261"
+	.ascii	"\"\220\240\314\212\305\357$\007\370\321\215\b\234\334\306A%S"
+	.ascii	"\370N\333^\353/.\264\366\256\025\021\002\300\2165{]\210\225\327"
+	.ascii	"\026\247\240P\271r\243B\016\265\346*\177\031\033\344\266$`4\346"
+	.ascii	"\325\222\r\267\232\334\354X;\314\276[\020\031\222O\350\315\205"
+	.ascii	"\007\203\314\177\032\361A_\233\021\031\342\246\007jj1)?W\221"
+	.ascii	"\214\334\332\317\025X\363\236`\214V\031}4\352\022/\005n,m\n\327"
+	.ascii	"=\336\241\337d\360\004\362dK\312bFw\"\300\325%\2206P\276l'\345"
+	.ascii	"\017\271\254-Z#q\036\270\r\215\343\354\002\214\r1\307\274\230"
+	.ascii	"\001\344\300\321_7\320\026\212U\273\216\206\003=\027\321c\205"
+	.ascii	"S\345\234\251\307p\240\347\"\374e\355\265H\341\bt\304\372\207"
+	.ascii	"\222\202\237i\224(Jx\376\032\032t)\215EA\236\344\204Q\205\026"
+	.ascii	"\246\305\307\304\356w=\344\302\351\030\234\250|\310\255\373\316"
+	.ascii	"\357\355\230\365\n\373\267\366@\257\345\221\377]K\303\345\314"
+	.ascii	"\221\315!\354>\367,\372Z\244\211]O\257\221/\373\216\207.\362"
+	.ascii	"0m\223\307}\275Um\326\276\332G\273&\213\036\215xB;\212F\310\026"
+	.ascii	"\236bz\372\272\275 \216\"7\212*\331\367\020\370\317\177P\361"
+	.ascii	"\322`9r\2536\332\017\375\301k\303f\351\005\276*"
+	.text
+	.section	.gnu.lto_.symtab.fd1c85731d9e7f22,"e",@progbits
+	.string	"governorConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"govMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"govGearRatio"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"govHeadSpeed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"governorInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"governorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"getHeadSpeed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"getGovernorMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"getGovernorState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"govState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"getGovernorOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"govOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"isHeliSpooledUp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"pgResetTemplate_governorConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"governorConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"governorConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"governorInitStandard"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"getMotorRPMAt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"governorUpdateStandard"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fd1c85731d9e7f22,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,979 @@
+	.file	"governor_std.c"
+	.section	.gnu.lto_.profile.6053e0b5c221cd13,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6053e0b5c221cd13,"e",@progbits
+	.string	"(\265/\375`\004\003E\007"
+	.string	"\244\005\370\003"
+	.string	"\025"
+	.string	"\344\274\355\353\004\002\002"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\311\331\237\377\007\036\002\001\002\002\002\003\002\003\004\002\004\004\005\006\007\b\t\n\f\331\255\213\344\b\232"
+	.string	"\002"
+	.string	"\005\002\005\006\002\003\002\006\003\002\007\b\002\t\007\001\002\n\016\017\021\022\024\025\026\027\032\033\240\342\234\212\n"
+	.ascii	"Q\250\321\262`2\354\277\001\300\002*2\352\022\200\002\032\206"
+	.ascii	"\206\030\002U\200\004ZhaF\306\365l\334\350\234\213\346\024\216"
+	.ascii	"\215-\204q\263\035\035\356E\247k)p,Z_\323\357\365\377\331?e8"
+	.ascii	"t\255\177\217'\201\212m\231\331\265S\313\213\\v\335\027Ume\313"
+	.ascii	"\037\374E>\256S\244-\325\253\352\t\245\203\361bq+D\177V\217\213"
+	.ascii	"\327S\2656\217l\301\274\335]\267\017\216BC,\272\266Z\327\247"
+	.ascii	"\024f\271$S\202\212K\313|\247"
+	.text
+	.section	.gnu.lto_.ipa_sra.6053e0b5c221cd13,"e",@progbits
+	.string	"(\265/\375 \207\265"
+	.string	""
+	.string	"`{"
+	.string	"\003"
+	.string	""
+	.string	"\003\002"
+	.string	"\001"
+	.string	""
+	.string	"\f\003"
+	.ascii	"\n$@Y\b\006X"
+	.text
+	.section	.gnu.lto_.inline.6053e0b5c221cd13,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\005\004"
+	.string	"\202\205\024!\220)\351\371]\001\254\250\307\261\361;I \033\352\304wE\013\321W\255\372\253\276\331\002\330J\266\334)\377\237\236\300\\H\334\217\020\201\024F\245\021X\034\312&\n\210\211\214\216\352\243-\213\320G\205\254-kp\377{S3a\366\317PGf\002\036?I\021"
+	.ascii	"\300\210M\202\017\031\210\244\206%\364\215\210\024\0051\335\311"
+	.ascii	"\304\001\253\214\001\263\247l;e\330\224u=j\272\2338\270XU\200"
+	.ascii	"!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6053e0b5c221cd13,"e",@progbits
+	.string	"(\265/\375 \274}\002"
+	.string	"\324\002\260"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	"\002\002\001,"
+	.string	"\001\300\004\001\002\002\006\325"
+	.string	"\001\006\006\004\002\001+"
+	.string	""
+	.string	"\377\377\377\377\017+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"Q5\200;h&\207\365^T@\2732\205\340.\021Z\013\n(\245`g\275\312"
+	.ascii	"8\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.6053e0b5c221cd13,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\204\004\002\230\004\f\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6053e0b5c221cd13,"e",@progbits
+	.string	"(\265/\375 2-\001"
+	.string	"\270&"
+	.string	"\002"
+	.string	"\001\002\013\001"
+	.string	"\001\002\f"
+	.string	"\001\002\r\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"6\005\340\002\357b\200\2007\200\005"
+	.text
+	.section	.gnu.lto_.lto.6053e0b5c221cd13,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_governorInitStandard.80.6053e0b5c221cd13,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\005E\033"
+	.string	"\326r\260I\240\024R:\224\327\354\341\376\352\220\267_\002\3661tw\334\217\215d\005\232\024H\332\007f\237\251\323.R\321\376`\214;{\274\261\324\037\341\355<\013\277\254\360\352\300\253\301\234\355B\217\240\026\007\375!J\253\177\315\222\235\244L\001\223"
+	.string	"\207"
+	.string	"\253"
+	.ascii	"_\333\346\032f\256k_\277\354\232\366\365\354kr\327\363\353\177"
+	.ascii	"\275\273V\0034\031E\237,e9u\334Rn\221Eb\330V\353\016\025~P\035"
+	.ascii	"\256\215q\335P\322\376`\333\224T\233\237\3540\255rQ\252\325\016"
+	.ascii	")\242\226\262,so\241OJ\316\357\223Us\350\006\253\370\276\204"
+	.ascii	"\004A(I\366\302\256\244\204\004I\350\274\005\177\023@Y\226\266"
+	.ascii	" \324~\026@\321d\304-\350\233\270\342\212**\324\r\021\204\332"
+	.ascii	"\245%(\313\322\013\f\212P\317\324\366\221\355\0056\251 \032\004"
+	.ascii	"\210\022_\be\326NZZ\005\376\270\037\301-\337Axo\355\241DgYa8"
+	.ascii	"\203\261\2145Sr\215@+\372\375r\211\022\263Ny\354^\312\362w\300"
+	.ascii	"Z\245C\016V\030J\272\251\303*PIk\207\231\222z[\021\n\231\260"
+	.ascii	"\267G\273\312\267ga\353,Oe\177=\364\265\320\\\007\3155\320\327"
+	.ascii	"?\273\366\371\272g\256y\346z\347k\235]\347|\215\233k\234\271"
+	.ascii	"\276\371\332f\3275_\323\314\365\314\\\337\276\226\331uL?\222"
+	.ascii	"@M\311\270rs\234\323\272l~Ss\233/Q\2026aR\363\332X\027\031\215"
+	.ascii	"\222\t3\247\271}F\346\267\230\313\030)\222#1\257\r\273p\330\214"
+	.ascii	"P0\226:\001Z\201\271\315Z:\304\253\206\211!^5R\2246\202\343\261"
+	.ascii	"\354W\226=\001\265\303|v\025"
+	.string	"E\303\267G\277\274v\225\352B\373\313\325XA\211d\321^\033r\221\tgWG\306\332+\240\225\241\377\263k\016%\240\305\345\373\362\261\304G\236\205\272(\023#2O\025\004T\002\314\352\311o\313V\013KQ\305=`6\257B\255\031\332\210\262\222B\345\267e\236'?\221\002V\"jRr:\322\345\230v:\335\016\251\307HD\026\234\232*\360vL\274\013\036vI9'\245\244%\r\030rLKG\272\034\022\257)G\024\300\273\r\027x9\247\335\216\227\263U\365t\226\247\262\021\222I\336\310\306\235\245b0*\324\005PJNL\255\263\264\264w\350!\212fl\365\356\263\265hf5jX\221\002\006\ffJ\276\370\245\345\212\020X\203u\022t!\240\007\235\307\370s \237\377|\215\016t\312\227\317mC/\262\236\256\007<\357\3319\317w\210:\337\311\271\016\004\215R\314ym\314\013\007\016J\004,8\307\255"
+	.string	"\343\021]\250!L\002\022AR\"\222\202\224\024$\215\001@\003\021\225\246\003\021\300P\212\220\330\024h\377\016/\b\377c\025\241z$\f\240\n\365AI\3543%&)\022b\324\226\357\220mT\265\033\214\226T\003\225~\023bn\313\f\270\320R\365M\327\211"
+	.ascii	"J\300\016\244\364\255n\347\306\213\251\001t\020\3245\341\332"
+	.ascii	"\242\370\037g\3645\301\216\bx\214&\341\033\342\336!\354\375|"
+	.ascii	"\353\006\n\340l[\243\025l\037\023v\355 \267\206\323\027\212\177"
+	.ascii	"\341\277\f\371\257f1;6\253\302\277L\255\237\3555\225\264f\257"
+	.ascii	"\021\276735"
+	.text
+	.section	.gnu.lto_governorUpdateStandard.83.6053e0b5c221cd13,"e",@progbits
+	.string	"(\265/\375`DS\215\032\001\312\305\321aM\020\020H\355tk\024\237\004\330\005\214_\220\027 0\003\007\365\364\002\021\240\263\340\225\t/\372\343\342\244A\267\330\277\311\345\273\023}\327\r\351T\235\023"
+	.ascii	"\302t\312\f\213\316\201&'+\244\331\n\001\200\347;\377\273\033"
+	.ascii	"\203 D\222\354\224R\n\f\006_\005K\006\3279\007\322\231\001\244"
+	.ascii	"3\216\353|\343:\333@:\327@:\323@:\317\270\316\013\\g\031H\347"
+	.ascii	"\030\327\031\006\322\371E\322\331E\3229\201\353\214\300un\361"
+	.ascii	"\301\031\347:\037p\235Y\\\347\025\327Y\305u6 \351\234\"\351\214"
+	.ascii	"\342:\237\270\316\005\\g\023\327\271\304\007g\022\327y\304u\026"
+	.ascii	"\201t\016q\343\234\274\316\310\033\347\233\243\363\361:\337\353"
+	.ascii	"l\274\316\354u\376\353\354\327\271_\332pa\317\251+\304\347#k"
+	.ascii	"\225\256\211m\236\361\013\017.m\247\322N\325^\325\376\244\375"
+	.ascii	"\252=\332\036\245=\253{\332M\326\255\245\373\254C0\367\224E\234"
+	.ascii	"\263m\333dX\026^A\252\016\013'\245\\u\021D\326r\035\311P\311"
+	.ascii	"\205Y\2537W\2540\362J\\\025NRQS\025xv\363u\346\3642R\345\244"
+	.ascii	" \367\252V\347"
+	.string	"\362-NF\341\254\215\306\376t+\207:\024\337\301\261\\\213\223YE\200S\242$Yy\324h\332KW\\\274\332\266\305\301\237\030\315\355x\225Q]\013N\325\364\363;\341\306\3117\261E\335\3115)\003\365e\317\352t\004\032\004cj\"\004S\362E'\022\030607\222\363\242\257\363\241\307\223s!\243\223/\257\b\301\374\207P\356z\346T|b\263\"\206\2713\3742|`\205,\237\034!\016wN6\017Wf\215q\207?\253\232\013\350\374\303a\320\351w\333\310\365]E>#\223Ek\333\266{K\322\344\310\254\215\271s\342\225\261;\002\312\265mK\367q\205`r=\307\234\344$\215\306\375t\266\201%a~k8\346$/i4V\021\306\271\004\314\233\325K\273\331\320h\234\203\263\316j\003s\033\217\323\316\272\266\347TS\301'\327i\275\2059\31184\032\217\340l\003\326\266m\262\215\31480'\333\330"
+	.string	"\263\222{\254\313\332\254\251\234<\323\341\346g\351\246\313R1\260m\3118\320\322\004B\306U\027A$Z#!#/\0367m\354\260\026S\366\224\2537?K)\230{G\201m\333\336h#7p\323F\027\215\342\266\221\355\002n\033\231\225\314\200M\206\325\266\331\341\020\325\332\266m\316Gie\367S;uS3\365R+uR#\365Q\033u\263\213\232\250\207\232\331B\035\324\313\006\352\237n\371\312\213\254\310\211\214\310\207l\310V.\3446L\310\203\314\206\005y\r\007\262\032\006\344?N\303~\214\206\373\370\f\363\261\031\336\3432L\206\365x\f\3471\036\337\261\035\3271\035\213\3419\226\3438\206\3437\016\303`\370\013\273\261\027\256r\033\263\361\032wa5\346\302[8\215\321\230\312gl\306Z\270\214\311~XP\201\217\036\024L\300C\202\035\021@\240\343\001\007\032\310\311\301"
+	.ascii	"\216\0336j\320\230\261\200\214\0300\024x\341\"\001\004Z\340\034"
+	.ascii	"\300b\205\n\003R\2408Q\200\211\022$F\210\b\001\"\371\001ys\274"
+	.ascii	"F\366]\311\375\201\351\247\373\251\235\232\264\302\242\274\231"
+	.ascii	"dlu/a\371t\313[IH\250\312;\311\f\222\333\016GX\332D\214)\207"
+	.ascii	"\317n\243)'\317KB\210\212\355\346Vw\021\226f\247\240BQ\254\f"
+	.ascii	")o\"g\367\020\016T\310\251\344\315L\352\026JB\362\016:\352^\036"
+	.ascii	"\031y\0035\273\177X\033BM\026\205P\221w\313\327>B\353\341\311"
+	.ascii	"\213]\315\212\2118\320\245\"k#\320\255M\2423\342\241\341\241"
+	.ascii	"\241\263\2650\005t\251\306\271\r!\340\237\363  \\\032g6\202h"
+	.ascii	"\232\327\2606\372X\024sh\234\003\375\3168\253\261\3429\003\""
+	.ascii	"\3369\377\245\361\253K\001]\3229\243\351\0233\347|\206\317L\265"
+	.ascii	"\315y\217\313\2545\223\351re\315Yo\214Z\025.\316yl[\234\361\216"
+	.ascii	"<H\rU\237\356\306\246\316vc{b\316ut|"
+	.string	"\315^\341\rU\237\240WY\232\305\340@\227Y\250X\234\347\3448\016\214\007g8~\223\302\272\230\202.\273\234\303t\255\341r\006\203\003]J\267\234\277\260\333\265\331KV\n\350\022\313\271z\004\302r\033\033U\363\032\016tI\225\002\272\234r\356\202\003]>\2358\253\301x6s\211j\336\202\003]F\261,\320\204\264R@\227N\3474\226\205\024+CK\311\031\355\252\250\231z\205\324|\306\3328\342Br63r\326r\225\324\\V\304\272h:\223\271\240s\363\253>A\257\210\372\3075\005tI\344\026,Ji\226\ttI\344\025\364\327\222\242\373\300\201.\223\\+\321{Pp\330\023\030z\365\213\257\245C\347\201hu\t\216@\240M\210\275\003\260#`m\374\261(\306\\\245\361\257~\361\265\004\350\020\250I\343:\374\372\001?\255~\361\265\204\306\035\300\201.\253\372\274\201$N\244\344\234\301\363\034x\206w\316"
+	.ascii	"\216\0336\350\304x\r\032sr>c\204i\340\002\3256\227Q\245\366\013"
+	.ascii	"\275%6\217\301\346\313~\361\265\264\3460\352\272\270\002/\204"
+	.ascii	"\270\264\013.[<\001\366\t\032%j\004ZL\305\034g,\314\017x\301"
+	.ascii	"b\005\026\251\253\230j\003R\240hhSW\237\220\302\345\005\234\200"
+	.ascii	"F\211\332\204\336\322\326\327\222\226\227`I`\035\256i\275%\036"
+	.ascii	"\330\2348!\245,'\0015b\252\312EL==\004\211(Q\203h\322\315\004"
+	.ascii	"m\232\352$k#\320\255\r\n%)\315\376Zr\342\037\250\276\226\244"
+	.ascii	"\034\311\262x\326=\265\336\022\025+c\314U\232\246\366\213\257"
+	.ascii	"\245(\277\361\250V\200\312\032f\bm\232\352#+Cz\b\307\002MH+\311"
+	.ascii	"4\344Wo\311\311\272h\333\226\351F;\271\260\023\320\245\226\235"
+	.ascii	"\332T\026\260\206.a}`\022\272F\255\267-f\237\240\313E\020\354"
+	.ascii	"\215>\207\252O\320(W?\253C\310:%\202)\210\005q8T\246\251\355"
+	.ascii	"FLK\367#\220\266m\331\233LM\315\r\325\314\3110\346N2oPC\357N"
+	.ascii	"\035\344k\352\214b\0234\257%\247x\027\313\377a1\024\177\004\032"
+	.ascii	"\274\2212\330W\300\211g\327\362Y\232\202o\342O|3\237K\277J\241"
+	.ascii	"\nxd\223\032\251\223\304\342\225\230\211\217N\337\3047\324\254"
+	.ascii	".\310\017\371\212\211?B\001\245\274\242\313\271C\t\034&~f\256"
+	.ascii	"\246\233\332%\314\005\032\006\222h.T\240\232\213{A\261wzTF\224"
+	.ascii	"\350*!B\212\034\236\210\257'*\270\254\034\206\2606\003\371qE"
+	.ascii	"\356\356gb\221\030\020]ZM\272\376wh\342^\220\264\222\312\250"
+	.ascii	"K\342\337\214Y\037+\233\374\2252\352\246m\203v\360?y\250\322"
+	.ascii	"\t\225\262\252\352\266\221\304w[\326\364p\354\355\303\210\367"
+	.ascii	"\035\314\372\236#~G\326\210\301\253\026\262\247\337\32461\307"
+	.ascii	"C\031\0332wA~\310\"\361,z\343R\336I\224\224\373M\242\216CV\316"
+	.ascii	"\216\"\276\017\315\356\202\374\220\237\236\210h&[v\211\037E*"
+	.ascii	"\327\255\327\314L\211Z33\305\252e\376q\275&\006\265-\020\214"
+	.ascii	"\020\317c\2067\375\020\237\302\026\336\320\342/\035\233\342\254"
+	.ascii	"\177\375A.\357\307\025\025X\036\2361>\022\177\022\210\346\033"
+	.ascii	"1\340q\321\231\354\026\227\210\277\350\203\322\013\3613\031\360"
+	.ascii	"\210\346D>\020\377\362\006\251z\345o\031\220\335\223;&\262+\336"
+	.ascii	":C\366"
+	.ascii	"C\006\3744N\2437\333\266m\333\260\027\262Xl\330\007\177\250\031"
+	.ascii	"\310\276\306\273\305mc\325\253\265\002d\207co\266B\\^m\333\326"
+	.ascii	"h#\263\247af\300\233\266\375\351g[\265= z\265Vm\2156&\237m\237"
+	.ascii	"\276\310h\222?\302\233\324\371N\036\312\270\260\037ef\300\371"
+	.ascii	"\314X\231q8\031\256\242\300j\333\226\007\373\030\327S^qs\265"
+	.ascii	"\221\225Qe\224(\267\215\307/m`V \2772W\231\331a\260k\361;\256"
+	.ascii	"fQ\333\245Oi\236aV\256g\247\363:\345V\227\222\007\036n\033}o"
+	.ascii	"\206\263;QNQV\361n:\327\0330$\226\327J\351\215\273\242\024s\322"
+	.ascii	"\376L\032|\212M\001\371\225\371\274L\245\376\243\334\342\366"
+	.ascii	"\3307\265o\364\314\372\202\374\220\273[\334\233\357\261g\037"
+	.ascii	"r~q0J)7\027+\263(\305\224b\267\2157o\024\\3\274\315o\227Y9F\202"
+	.ascii	"w\263\247o@\023\352\370\354l\336v\0017\027c\240\201\006\267\215"
+	.ascii	"\376\326\024\304\341\300\003\357\346\361S4\231\256\332\007ng"
+	.ascii	"|\366\357\026\343\343\310R\3417\232Y\004\022\274\233\354\247"
+	.ascii	"H\273\346\005\375\017\377SMh\305\246 \220_\331\277\377\277\231"
+	.ascii	"b\226~ev-n\306Un.>\201\333\274\233m\344\346\266\333F\177\b\372"
+	.ascii	"\234@~\345\002\274\255\374\215fFA\005\357f\377\2114\305<\241"
+	.ascii	"\377a\022\316,d\210w\263\255|S\373\203\327\230\027\303\300\345"
+	.ascii	"\3770\223-\375\243\314\375\327\353\225\f?\024\346\353\354tIg"
+	.ascii	"\237K:\273\\\322\331\343\222\316\016wt\366\267\244\263\207I:"
+	.ascii	";\230\020\316\376\345:\273\333uv/Ig\257&\235\275-\351\354lIg"
+	.ascii	"_\273\316\336%\351\354j!\234\235\313u\366-IgO;:;Z\322\331\251"
+	.ascii	"Ig?K:\273Y\322\331\265\204p\366\262\353\354dIg\037K:\373\364"
+	.ascii	":\273\330u\366\260\353\354Y\256\263cI:\2734\204\263\203%\235"
+	.ascii	"]J\322\331\273\222\316\316\265\225\325\323f\307ri\263G\271\316"
+	.ascii	"n\225tv\251\244\263;%\235\235)\351\354\314&k\366\240\353\354"
+	.ascii	"?\327\271\027\023\223\316m\350T\315\335\306\253\232\233\320\237"
+	.ascii	"4\367\240_5\267\240G\233;0\351\334\177G\347N\223tn\277\020\316"
+	.ascii	"\335w\235\233\317\263\232{\357.\351\334ub\222\316\035\347T\232"
+	.ascii	"\033.\351\334`\216\316\335\306\326d\315\255\226tn.I\347N\273"
+	.ascii	"\316M\275\316mVv\343\334c\255\245\271\247}\326\334V\256sk]\347"
+	.ascii	"\316\272\316\r\305\2434\367UO\233\033\332\323\346~\322d\315m"
+	.ascii	"\325d\315]u\235\373y\235\233\352\350\334S\037\234\333\t\322\271"
+	.ascii	"\245\220\316\035u\343\334M\256s3\271\316\ru\343\334O \234\333"
+	.ascii	"\351\350\334M \234\233\351:\367\322un%\020\316\235t\235\033\t"
+	.ascii	"\204s\037]\3476\272q\356\346u\356\242\353\334D\327\271\207\256"
+	.ascii	"s3\257s\013%\235;(\351\334\313\353\334@\327\271\177\256s\267"
+	.ascii	"\327Yy\235}\256\263\016H\347\034\2563\016\327\371\206\353l\003"
+	.ascii	"\3229\001\327y\311uVr\235\223\\\347\236\353\214\004\351\314\223"
+	.ascii	"t\256!\351L\303u\336\271\316G\220\316F\2563\002\256\263\f\327"
+	.ascii	"\271\310u\216\341:\023\271\3160\\g\235\353\374\302u\036r\235"
+	.ascii	"]\270\316B\256s\013\327\231\205\353\274\302u"
+	.string	"V\341:\247p\235Q\270\316\007\270\316\006\270\316\005\270\316'\\g\002\\g\023\256s\t\327\231\204\353<\302u\026\341:\207p\235\007p\235A\270\316\037\\g\001\\g\017\256s\007\327\231\203\353\034\200\353\274\301u\016r\2355\270\316\031\\g\f>8\003\340:_p\343\f\344:\377\270\316\026\\\347\n\256\263\217\353\334\343:Sp\235'\270\316<\256\263\004H\347\035\327\031\202\353\254\343:?p\235\035@:7p\235s\002V\306\254)+\201\314\250\346d\337kH\260B\346\177\332\351\252\362F\370(\232\025\254\26136c7dlD\370(\363\225\237\026\262A1\261*\203\3170\353\324\230\205p\372\301x\2050\004\337\252\3427\200\217r\357\275\265}P\305\255\255\203N\374\336\003\323\306A\325\0331w\225\361\013.N\n\302\007\b\360\352\305\227\341\021 E\206\"\037\303\367b\021\"\037\303\026\221GZy3`\313L"
+	.string	"U\2420\235\331\236\007\211\237C\005\261\361\252\216:\340"
+	.string	"\006c\224\245\377\274\316\303\360\315\364\212\352|\213\254\027~\310\373\317\033\t_\370vs\341\207@]x\244\0256\251S\310*."
+	.string	"m\036\007\025>\263\r>\312\335\325\003`\017cU\273t\312\342\005\036\366\335\325\003\240\217\2537b\346N|\032T\306\314\256^\310w\342\373_\013\277\302\013\371#\225\360Y\370\026\250Xxd\0334\351\nN|\346\024\233\202*\374\n\337Q*\374qoQ\352,\373&&\336\232\202@P\350\276\313\376\266Y\372\265m\3336\205w:\024\376"
+	.string	"\237\3027\363\351\204\302\247\3102\300\027\340\017\360W\221\371\2654\3007\033\253\345\377\234\360\005X\242;\341\223\324DC\002|\222]\2337\341\t\360\315\374:\362\3013\341\217\321Bi\tO\302w\233w;\246\030c\263\204\377\3217\302\213\360$\030\211Fx\244\023\210)\302\207\210\022\032:\007?\204o\302w\273\026\374\016\374\020\276\345\354\370\006\360 |\017\006\215\031\3003"
+	.string	"\302\236\017\237w\023\204\317\321d\312\007/\200oA\343O\337\007\357\303O"
+	.string	"_A\023'\017\276\203\357\300w\273\305?n\363\340s\262|\324t\360\256\325\311'W\362\202d\320D\357\\\030\004y\027\023C\274!\004\247\301G9\370&J\340j(\003\016>\310;W"
+	.string	">\310s\360\3067\346sI\326{\037\200\277ab\324\344\364\360\304\340\243\274\301\377\227S\324Z\236\363\370\r\336\265\232\235\262\027\306\214\017\355k\351\327\346;=1"
+	.string	"\\\360QF\001\356\207\006\217\202\025\013\270\332Qkf\310\332\266m]J\005,\233\366\2607\342 \337_fum\202\214uAy\2129\201|\324\0024\245\037\017\205\231\031\215\027\213\026L\374X\361\210\312\002\r\336\245\324U;\212\236\237^\006\257\301\263\204\030\374\005\237\301\267\370\003\300c\360\227\215\031\310>k\3305l "
+	.ascii	"^\207P\325p\332bg\207\025\\\360\256ev\347\303\206\375\343\352"
+	.ascii	"\2163m\333\356`f\266\217M\343C\230\343L\333\266<\332\310,\032"
+	.ascii	"\326\317\247\320\307\320\007\321\007\361\266\321\233\337n\033"
+	.ascii	"/\370\035}S \277v\231\325\023\037\255\224^ \337\320/\254\031"
+	.ascii	"\245TQ)\006\344]\253]\214+\360)\326c\2026{\367\342\301\343=K"
+	.ascii	"\2262T3\nz\374\217o3\236\363\273\233\340\307\363x\367\372\201"
+	.ascii	"\307\364j\"%?\036\026|Oy|\217\267\340]\253oP\317\314\370\320"
+	.ascii	"\274\226\022|\224Q\260\022AS\337\277\032iE\307\344W\205\240\307"
+	.ascii	";\2267bv,zZ]\203z\266\344S\023\004\332\301\343+\370\246>;sp\351"
+	.ascii	"\327\236\022\027\026A\005\337\343\375\253\335\311$\017\313\336"
+	.ascii	"\367\370\n\276\247\344\322\230\317%\004\037\345\336{\037=\236"
+	.ascii	"\307\373\370fz-\375\312y=\376X\346\252\303\352\316Y\305k\n.U"
+	.ascii	"\305=\360Qf\n\276\241t\024<\362LQ:\301K\360\275\367n\307\316"
+	.ascii	"M\360!\240\024J\235<\342$x\036o\022\274ku\2153B)k5\326\345\300"
+	.ascii	"\216\035\237\002[\341\r\331\242\230\006\276\004}\327\016e\236"
+	.ascii	"bN\251\227B)\262\225\322\273V\250%"
+	.ascii	"1)\347\243,\263\035\254\204\336\2246t\260\034\037e\203\332\255"
+	.ascii	"\270\270\325\267\241/6\003a\340\243\314hYbQ\253\024{\326\210"
+	.ascii	".U\206\230\244\312b\207\003\002vL\307\347<\004bP:\036\371\024"
+	.ascii	"'=\316\375Yo<\220E\372\300#\317\302\030:p\245\212\003\217|\252"
+	.ascii	"J\277\002\335\211\365jEw\212\352.\305\337\343be\203MT^\313\314"
+	.ascii	"6\360m%\347\033\320\312yd\231\265\344\330\025g\215\034,\226\317"
+	.ascii	"u\217\201\317\361\215\343\031\270\3618\276\207\026\243B7>\004"
+	.ascii	"\2244\251\r\366\352\347\211\215G>Q\r\235@~}.\245@\201\302\304"
+	.ascii	"N\365\225\351\310:\373j\fs\307\244Q\343g|C\335\332\212u\030\350"
+	.ascii	"F8\306\252ef\333\026\b\006\215\257A\343\215lC\213|?\343\225\214"
+	.ascii	"\025.\360PB\317\326\024\234\276\214_\340\233u\222\361H3E\251"
+	.ascii	"\023\310\257%\236\240\2363\330%.U^\316d\223~\234\311\032\375"
+	.ascii	"\030\277d\375-\020\343]\n\214\217\361\315\022e\301x\tJ\034\251"
+	.ascii	"\301\222\241s\273\357\260\214\r\0314A~\310>\234}\251,R\032y7"
+	.ascii	"\273\357\377\177\222S\252\320bl\371\320|\357\002\273\344{_\266"
+	.ascii	"o)y=\3058\205\2311#\030/^|\nb\205C\213\210\355U\251\002\327'"
+	.ascii	"\3273\314\372\302OQ\310\357P\b\020\215\320\305Gg\020\265\022"
+	.ascii	"\351v\23225c\330\220\371\373N\223\300\273\370\376{\037r\321&"
+	.ascii	"\2017:\341\031:\023@`\220ek\n\266U\333\266\314\267\305#\360\315"
+	.ascii	"\374Z\323\342\361\250\316<\305\234\206j\212\fA\264Rz\375\212"
+	.ascii	"\020\350\243\002\273\3433\272+c\004\002n\315\251\005\224\306"
+	.ascii	"\371\206\352\215\301y\244\023\234t\212C\265E\330\336\346v\200"
+	.ascii	"\335T\232::\244:\266\225\322\033\207\304\342\rL\232\341\212\251"
+	.ascii	"+\202\355mPy*>\352&\326d\360\031f\005SU\002#\327kJpzZ\fP+\234"
+	.ascii	"s\002\371\325\310V\026\226\242u\264Ce(>\272\205K\023\256\247"
+	.ascii	"\2303\016\215\251\343\242\264\031\323\230)]'\016x\003\276\247"
+	.ascii	"fw,\376\200g\361\306\374Z\372\225W\274\212g\361\315\024S\266"
+	.ascii	"\342\033"
+	.string	"\255\217\2073+\231\224N\336M\025\337\205V\313\377\341n{\003\276\251\235\0034\270\344C\013\004\362+w\332w\333\037\t\207\026\201\374\312(>\305wZ\034C\016$3\024\351I\3021\344@\022C\217\020#9Gv\214\030\331\031\302\302H\022\022^(B\303\355\321!\302#\244\004\032\214\350\364|\320\351\0212\002\rF\204\214\320s\244\310N\b=:HH\364 )\202\004\311\005<;=;FL\004\t2\"H\020\035$3$\tAGI\221\236!:3\314\260\203\201\222\035\"'\202\004\031Rd\206!6`\240d\207H\362\005\036!Kxv\202\274\240\243\023D\311\016\021\021<;<<\032(\331!r\203\304\004\035#EJ\3509\242\303\303\223dH\b\235\031zzvxb\350\2719RD\310\007Jv\210\034g(\"\244\004%;D\216<$\307\013=HX\340\3319\302\243\243d\207HNO\fD\212\314"
+	.ascii	"C\316\221\"B\214\344\f\341A\222\223\343\005\357\320\240\303\223"
+	.ascii	"\323\263\263\303\223\223df&\003\002\002\364\313\266m\333~\372"
+	.ascii	"({X\263tp\275\204|\2376K\307\244\225\372\371\036\326H+:7\277"
+	.ascii	"j75\224\277{GC\325.\202B\237\312\325\021g<R|R\247\225\026\256"
+	.ascii	"\2168\226\315`\202[l\247\343\264\033J\2171\203Y\272\311\267\336"
+	.ascii	"\303\232\025\203\246'\330L\037E\302\265T\220zi\353\373\371>\275"
+	.ascii	"s\243\243\346\265m\333\232\241\372~\366\3247\325\273\"3\320\311"
+	.ascii	"\367T\225c\330\021\3131\213\317\025\251O\226,\267\215\355\344"
+	.ascii	";P*N\n\024e\n_+}\224\257\033\\#9\326_7&}\344Q\376\2161i#\317"
+	.ascii	"z\0344\261\266n>y\243/{\273\"\304\373\3113\373\214\371\224y7"
+	.ascii	"}\353\035K\233\220C3\206\225$\365\216\365\317v\030\365-\365\035"
+	.ascii	"\365&\314\260\324\034\277Z\006&HG\256\3563|\205GQ\276\255\336"
+	.ascii	"\263^\304UU\365\250\325D\352\362$pB\205k\243\256Oz#\006\\q\225"
+	.ascii	"\233\302_T\305\350\330\265\342\352\\\261\250\310\200+\n\345\016"
+	.ascii	"\031"
+	.string	"p\305\242\363\330\305>\210x\334\232\002x\314bf@\n\244\322\254l+\345\213Q\232\374\003Qj\f\235\315\344=\312\267\"S\020\310\257\313\"'y\201P\337L\336\250x\204\302\325\031\307+\037\302\004\216\320\206z\307\322\306g\324\237\341\264\016\220\311\\7\301\240O1]\304\327\375\364.\254\340\314>T\2374\357f?}o\341\243\312[\376\217b\0239=3\3478V=\233\276\235\376HE\301q4\263O\027\0376\357f7}\027Z\005\375O\027=\2444=\324v\305d\372\243\023\251\245o\246?R\231w@\207'\224\276\227\216M\224\276\321\372\204\256AI\017\365\204\364\235\364\315\274;6!\275\217\254\345G\371X\324\335\374wcC\004:\372\343\222O5\202c\322Q\311\307\r\214\317\333\3335\372>\372f\336\001\371\365xd\224s\275\202r\330?\037efA\350\252o&4\0326\276\355v8a\347\227XA"
+	.ascii	"\201\277TLr\350\242\357=\250\305\033\020|\f4(\300$\315\366]\306"
+	.ascii	"\256\rEO\237\315s\205\026\363^\245\221{\205I/x\227\35783J\343"
+	.ascii	"\264\233\332\310*N\2369\036\364^\245\215\204hB\032\356{\317i"
+	.ascii	"\321\206\003\337U\020\027\213\334\3601\320\232\264-i\265\357"
+	.ascii	"2t\213&N<\002hNw<\356\345?D\301\206\252 \254`\264Rz\273\371J"
+	.ascii	"\276\034\211|\342\232\337\324\236\361\3036\370\024c \336f\013"
+	.ascii	"-\261\333\030\211XU\312\21723p\f:.\243\316p\034\333{\275\301"
+	.ascii	"y\265Z\201\374\232\310\343\274\202\035\226\340\\\264\016\272"
+	.ascii	"_\323 S\350cM\243\342s\267Mo\36196[X6)V:\024\3355YC\337B\337"
+	.ascii	"E\317\262Y1\277\207\276\001\241\230\337^\234\203H.\265\262\034"
+	.ascii	"Z(\215\320\3678\325\2040\264\346\341\320\227'\307\247&WF\215"
+	.ascii	"M\372\233\272a\f\032W\034\336Z\034X\335\232\261\215\323\031\033"
+	.ascii	"\214k\250\327\004\314\251}S\273\006\0235\360)\346\204\273qmp"
+	.ascii	"7L[\367 \344\265\344\355\217\244<\t\363\376\326\313\357\240\367"
+	.ascii	"0\337nA\327\255\227\237\203\263\316\220uN\321(\251\262}79\343"
+	.ascii	"\244@\227\355v\001\372\006s\302\031\336-3\306P\275\300\\40`\256"
+	.ascii	"\031\030F\363#\227\344\013\330\221\326\017\334\227\036\267K\346"
+	.ascii	"\366\r\207\244\206\316\372\236\243\341\206\265{y#f\367\362S\243"
+	.ascii	"\224\263m\311\247&\310\243\303\367\317w\326c1\361j\370\371\236"
+	.ascii	"\353\366}\276\177\236Ud>\227\312\357\026\213\362\257\027g\233"
+	.ascii	"\021\210L\013\r>\257\303\367\027\230\317#\235@\327\212\016\337"
+	.ascii	"RN6C\347\007\241\237\240\235\034\276\2419\274\b\263\242\352\320"
+	.ascii	"\342\211&\020\321\021\034\236\347~\341\36078\323\244\316\243"
+	.ascii	"\246\241\007e\204\207\261\260j\027]U\213\356\214\223\266\031"
+	.ascii	"\242\304\021\202Y\021pc\354\312\354.\310\017e\270\341B\371?\033"
+	.ascii	"\376\206\373\304\006\272\251\265\355V\331\265\335)\273\"\tH\300"
+	.ascii	"\247\240\2107\2648\324\216\027\303G\235S,6&xleNx\306>/g\210\334"
+	.ascii	"%1\261\301\265\2334f\355\032\215\271\361R|\203\201\016\260Lg"
+	.ascii	"Hk\275_"
+	.string	"q\3412\333\273tyv-\227\250J\327h\022g\306\247&\370\302\222o-V\256ij\310\222\367+J\276\347\227<k\307|.\223\274\222\033\224\344u\244\305\271\360Q d\2237\303#R\224\247\020\270\357\371\206\336\266\347\221M\302\030:\221|\303\275\3331\007\027\221\274Wiv\312P\325P\204T\233X\013<<\237\202a!N\225\251C\026\020\305t\205\225Q3$\243\326\206\214\261\315N\315\n\\\310\220\031\263\307E\205-F6[\276\367>\250\031H\n\201W\022\237aV\024\322\214\200|iF?\276\003X\333\321\314\246N}G\243\341kx\247~\367\325`<C\303\033\231(\032`\217\313\025\260g\230\365\214\214\337\231\021,\317\257"
+	.ascii	";\306;\253#\277\363m\244;\362xW\240<\305\234f\306\271?\263Oc"
+	.ascii	"\204\373{(0B'\0301\362F\020\207\026\357\326\016E\004\370(\263"
+	.ascii	"\361K\026\027+\203Z\214^\324hak\366/F65\005\374\bN\231Pf\302"
+	.ascii	",\206\037\250\303\261\345\221XV\203\212\241\031\021\021\221$"
+	.ascii	"I\322\001#\030@00$\034J\232\342\323\003\023@\005\r\246\362z\234"
+	.ascii	"F1F\245\031!"
+	.string	"\021Ij\351\316\266\3702\231\317\005\227T\260\346+V?\211\026\376,EWmQ\032\313\304\024\317\305k \330n\302\324\254\222\312K\312\030\241g:'~\222\230g7\245q\260\344#\326\261u<Kl\205\324\306\036\245\237\207\263H\t\264\212\022\244@u\305\320aV\214\232%\244~F\024\003U\0366C\027B\005\005\205(\036\027\346\n\3372\225F\037,IL\310z\311_\206\001e\210\346j\211B\301n\261\332\035\211W\350\007\243\003M\230?,W\227\365 \372\245f\321e\025\242\350;\005NTw[,\200H\246t\251\250\362\241\236+\31029\020#\306\315\314\364\253\330 +\003%5w\373\331\327P\020\177\240)=\310\204\355\031\322}\277@\335i\231\200\360uo/\365\234M\247\354\272\373\206\332\373gx\232\363<\212\343\t\300>\0013\304\b6\203\004U\213\307C\260JsS\346\337v\253U[\211m!"
+	.string	"\247\370\017\243\017\026\340\3207\371\340i\210<P\266G\243c\247\\\330\331\240$t\351.G\374R)z\r\326\331\200\232V"
+	.ascii	"\261\233\351\b*e9W/y\2069\264\305~\020\363\363\313\213\025\025"
+	.ascii	"\215\001s\311\200\227\020\377;\352-j\032\1779\f\002\na'-\370"
+	.ascii	"\316\232\345lE\314\336\273\236\333\217X\201\211\264\2001^@^\n"
+	.ascii	"\022\354\360\016K\357{\001\201\r\325q\206{_\352pFzq\226\013\325"
+	.ascii	"\020h\201\3645=\005t\030\202\254\bI7?\232\361\031A\276\3113G"
+	.ascii	"\001\257\032)T\264\236P\202\316\022/YB\023\335\020\240$(\207"
+	.ascii	"YNe\253*kU\276\257\270s5p\214&[9)\334o\337a\251)#\023\374\230"
+	.ascii	"\375V\225?\334(\006\\\3270u\037^\341\345=\351\345\346?\364\004"
+	.ascii	"\251\365\343\320lv\234\213A\206q\373\3428E.4x2>\037\353\216\203"
+	.ascii	"\345\256;\244?\027\305o\225\223\254\325\006"
+	.string	"\345\0351\354[\341\006~\314\217\233\211G\013\246 \322?\253\"\343$D\200G\201s\030;\321\022\2472\n\030\240\322X\323\216%\355\236\221\201\246\354J\001\0078\361\343F(\275\260\3009\337\340\303J\022 \337\261MZX\005\252O\340\212&\004\212c\361K\222\320\206W\377\361\237\023\025\016\257\200\255W+'D\033H7\212\021;\334\270\340\206\022B\216\262;TWk\242\002\177\260\\\"[{^\375\360\312j6s\330\235\220\377N\300_A\360\022\311\346\332\262.\246^\256\313.\345\355Y\267\0065\270^mVDR\351!\203\327\370J\\pc7|\234\225\027\374\232m%\302\013\256\347\025\206$C\334\255\364\3612\343[\201X\007>\213~>\030\t\376\0201\3143\321p\273\322\361o/\303N\204\204\321Eg\205\322,\246\323\266\022\272PG\250?9\307\367\027\252\233\276\t\211\353\314w\323M\250\242\306\342\376o"
+	.string	"y\026\t4\031:n\262\335\377\300{\242\020VVe`\333\351\003\272\205\003Qu)Woo\355\032\323e8\351\303$BF\207\356AL\035y\017\340$}\272\214\261e\232"
+	.string	")w\207q\\w\205\246($\035\034\266\217\203q\352\240V!\327\023\360\032\340ZGj^\330\251*\365\313\325Z\356\332\266\247&\265\235m\320z\347\216\247C\020_\2310\267\365\333d\224\364\t\035\0171\241C5]m\201[]\"\275T\307\202\352\323v>\226\351'\215\"\321)\005\f\342A\360\337\2075\"j\3248\271\373q\260~/\217\216\274\n\254j\263\205\360\223\214\305\025Ws\261*\20748\365Z\266\361\002s\316r#a\314\0378\027a\344\211\267\306\365\303\301\336\237\250'(/6\345\313&k\335';\246\222"
+	.string	"L\236\013\016\002G\2729\211\020\223\034\323\252\3211\035\323\272#\030\270\004\324\227J\003qY\276f{\273\327\354\317.\225U\326,1\270\253z&\253\224C\337*\f\005\036Z\002\267\302\334l\277"
+	.ascii	"\017\366\217\325\360\370\260\031\315C\207\316($\334\343\2574"
+	.ascii	".\177K\266$\027\005 \3547\244\207d;\361C?A\351E\213\235V\251"
+	.ascii	"z\363:\013\013\274\221s\203\343\2508y\304!\350+\036G~\2115\214"
+	.ascii	"2\364W\330\024\332\231\236\277\2669\250\225\302l\351\001\003"
+	.ascii	"H\324=!T\272\262\255\245\200 \260?C;\177\325\024\027\001\303"
+	.ascii	"p\272\004p\342\346\344\002\366(\031L\"\275|\225\345\354w=#q%"
+	.ascii	"\255J\006L\212g\347\b\275\312\222\021\242<\233=8\033N\306&$\270"
+	.ascii	"7\234\3353@\306(\275O\220\2126F\301\245-`<\037\226\372_\001c"
+	.ascii	"\006U\324\354\201\314\322|\204FS\272\246\025\f\313\362\311\351"
+	.ascii	"0\307\3232\f\206\":UH<\203s\337\260\253\314\340\240\241\316\205"
+	.ascii	"\034\244V\315"
+	.string	"\f\025\321}\224%>s\317\017-VMH\f\304\307\263\365D\354I\226d\222\340\006Aqet\354\220\033\216{\341\207N\303\2712c\016\350\335\260\307M\255\265\003\315$\nN\324R\224\271\260O\037A<(\330V\363\264\335\263\304O\363\224\274\307\236\347A%\340\247\364\312\346\251\230T3\242\205\341\261\022HC8&\025\"\3356\277\236\304Ww\360\336\241\354\326B9\025\277\361\001\333\024k\371b\025\f\240\225t\213\265\217\320\367\301\330\337\240\314\272t{f\0021Q2\005U\243\226\344\250t\277\201\215\215\251\013\016\\\370\025\350\220\346\022\302P\262b\223\303\222:\247\340`,\030\026\306\263\237FF\334\f\024\035\007?\317\234o\200a\3748\345}\367\356\376\246x\006\356\265\254\274:k\037@5\264(\376\244n\240\034z\341\320\324\031s.\345/\020N\177\275E\366:9\251P\274\214\001y\255\342a\023\374%\220\211"
+	.string	"\343\250Jg\303\334\033\033\023\257y\237\334g\343\316\2132\307'a\217\246\025\002Q\037:\207\216h4\007\030q\270\274R\227\"\f\335=h\003jhs\375\3425\241\025\026\371\256B\314g\246\277G\033b<\367]}\366\200\244u\276Y\207\243\177\275\026,\232\f5\342\307>G\347|\376\314zk\361\340.\237*\275d\333\324\223\266\312%\341\311\240\344V<\220h\345\240)\215\307\377V\315*H\215Zd\n\024k\3320\267\ni\206\324Q\210G\303"
+	.ascii	"O6\021\024\352y"
+	.string	"\006[(\217\200\257\205\364\205\314\376b\225\271\036\245\335\354\235\357\333[\fa\273\n\341\212\fw|'*\034N!\177o\356\312\3659\256RE<Oo\304\344\343\217\276K\237\363\024\213\215\311\221M(SUFG\231\302\333\200\231\351r\026\200G\031\b\017\241\313@\212\322h\306KUl\f\354"
+	.string	"\036\333T\025\303]u7\337m\215fv\031\320b\350X\250z$\020\t=&\223\306\301\256\211\201Z\373\257!\362\225\330PuG\321\020\222\301\370\027=\254\034'\376\231RS\216\343\007\202!\301w\320\370H\337*\267o\374\207u\265o\305\212\327M\355\342>{\352\341*\222\236\260/%\347\226`'\211\267\022\030\224"
+	.ascii	"rS\222G=\022(\022\325\224\300\223\252\261\246\226\245i\216\321"
+	.ascii	"\365v\370\237\270\3232\245K\007\270\"np\244W\332Q!\245\037\\"
+	.ascii	"#\262\265q\272\300\375\255\"\352\203H\376\341\346D\363\265\212"
+	.ascii	";\277{\202J_k\035\037\034\327\023\366\367\335\201Z\360\377\215"
+	.ascii	"6\231\324;\273\206\315"
+	.string	"\017\001\306Tl\325\032\344\234\271\266\367BN\271s.\311\237\255FG\025i\356\034B\n\212\262C\332&=p\367\003ez\b\364'\3779\022\222v\231\221\3258\006\b\256Y\310\260\353\331f\223\365\324j\211\330\317%q\213\036`\n\025\002\316sZ\256\313u\016N\246\021\r\r\243%\352\300\340\036:\177\371\034\231)\331\325\b\235\323/\366\243%\215\036*I@\374\034\203\350\301E\375\336\0357\305\360sP\311Y\022\302\3361\333\352/\005[I\377b\215\273b\031\206\223\256\262\351\350A\375\007n\003\360%\275r\334H.\bO\275\233\345\332\254D\0322k\023\317\256\211d|\367\004\224\362\0011\315]&+\315[n\246\220\27161Q\311\234\332l\312\022\025\204A\f\212\025TY\260{\003r\036\250D\320oV/\261b\364L\267m\b\222'\321\031\336\203\252\016KB*N\b\263\322/8\365\351 Q\230\3174\030"
+	.ascii	"\005R\260V\277\023\242\330 \226\334O\217\271Y\272\204\274\272"
+	.ascii	"\246\246\243\251=\027\236\260\t%gj]\367]V4"
+	.string	"%D\2562\270\224\215\317\3128k\304#\004BD\022w!h\204v\252N\303\334Y7\212\355F\273\251\253\022\023Dg\224(+\326R\277\f1\005\353\023Y\347\r\304\327&\307\314{\347E\232YATQ\t.\330i\3367M\302\216\203\2532\247\033\312\033\233\210\332\243\003\311\254\375\304\335'\372\210\313\232\360\205\371\271t\017\"\340yF\025\326\\H\203\020\241\247]\341s\301c\301\332\217\327\345\251\035\355\n\275\224S\207\336j\007\357\034\242\fP:~\232\361t\261\250%5\364c\202M\034q\225\233\322.\375\004e\013\344\016p\272\371\036\346\243\272\n\2621\333\t\005\317\336\013\n\212y\002\t\032\254j\242\"00$|\220e\254\007\017\006\223\033uQ\342'\263J\207\375\025\356|\212\216b\322y\357\352p\277\3451\321\222\353\034\016c\0076+\247\005;\2340+\354\005z\343x\326\204\324qu8\2000)\251\201"
+	.ascii	"'q\3565\t\177\305'\310c?\007\226\214\221\351r-\351\225\236\377"
+	.ascii	"V\030\023\004\212\244\316i\302X\333\263\021l\346\007\377\363"
+	.ascii	"\231\255\211v\323\372\216*\230\226W\354\336]\360\337\222\343"
+	.ascii	"V\267M\240\020\2778\257F\332{u\377\006H\007\322\274\343\254\027"
+	.ascii	"\307\356pxB%|\"\213O\365\311\322]\361\276I2\377\320G\027\364"
+	.ascii	"\222t\333=\241i\354=\245\001Cy\005\330`\003\222+\177\004<\021"
+	.ascii	"N\373\361\355\022\337:\033\230\252\003Vc\374W\254>\350\304\273"
+	.ascii	"'U\262aG:HG G\022l\360\211\265Su\305\220\207\023\305\034S\303"
+	.ascii	"B\311\234\233;\331\324\245\221u\303\271d\267\260=\243[\363!N"
+	.ascii	"Wd(\034t\2567g\257\254h\037L,\271-L\377|\334\230~\233%s9\345"
+	.ascii	"\251E\007"
+	.text
+	.section	.gnu.lto_headSpeedValid.part.0.107.6053e0b5c221cd13,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\345\n"
+	.string	"\366\223KD\020\253*\035p\007\204\273\353\253\006<1\005%r\337*\251\346wGw\314\023\226G\022\025\226I\036\260\r\320X\206\206\212}\024#\312\300\262\232\b"
+	.string	"!\bI\001\251\325>\004\204"
+	.string	"\240\260\254+\373d\023\271S\n8"
+	.string	"6"
+	.string	"9"
+	.string	"\364s\003\374\273\266r~\276L\205#\327V\303\206X\005\006\341\352\253Y\210\020V\021!J\233\230"
+	.string	"\340\302\307KUx\222R\342\323\302\251\265\372\341\344\336n\033\3036\265\017\021\333\362\316kuY\266\245\345J_\253\220a\304Z\301Y\207\2522\033\024\260?\222\354\213]\262/\237?`\315\206db\333\232M\311\337]\002@\313\311\002\211\002Y\255\256\246=i\230\327\003P\\Pw\305\373\023H\211\022v[\336JR\356m\337SH\020\001%9\330Gp\227\347\017p\310H>\365\351\217\266\317\357\307K\007\240\001qD1\311\231\f\356d6D^F\307\205:\217\b\367\241\242\216\017\310\203\203\206@\032\037\264\323y4Ca\016\304\323Q\021\307u\364\362e\331\022\303\360\202\355\377m\037\177\021\313\360\202I\377\333\344\252\326\234\021"
+	.ascii	"K\005\340\324q\013\013\005\006\272t\036;\234\205\200(\030\346"
+	.ascii	"\n\267\034\002\003\001p\006XsDu\206\307\325\024@u\357\265e\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6053e0b5c221cd13,"e",@progbits
+	.string	"(\265/\375`\032\004\025\026"
+	.string	"V\245\211I\240\224J:\026+\017\250T\025\243\225\371"
+	.string	"\300\251i\\q\233\354=\261\020g\327k3\b\355\350\202?\024\375tNh\232\215\2643\305\315\363w\274\034/\307\313q\225X\033\032w8\263\332\331\352=\207\356\204r\274!M\022\231\002t"
+	.string	"r"
+	.string	"v"
+	.ascii	"\317\2755\250\267Z\006G\3139\031\316\307n\236\303\346\277\232"
+	.ascii	"\203\321\034\310\314\243d\276\203\036G\314u\300\334\353\345\300"
+	.ascii	"\334y\210.\357Z\360)\005\227J\360-~{{\023CP_\025\266\374\352"
+	.ascii	"\300M\226C\255\334g\340O\005~Ce\203H@C\312\261B\335hc@}0\344"
+	.ascii	"\177\311\021\345T\342\377\227Q\247\033k\374\365\007\246X\334"
+	.ascii	"8\216\243\200\372\264\360\277\270\022>\332\334\301\334\020\f"
+	.ascii	"\211\2106\347r\315.\344\232\024\0219\243\315,\346\342\274\302"
+	.ascii	"\222h\263\312\271a\220g\2106\243\234[rB\311\244\315\001\312}"
+	.ascii	"Y\260\251\005m.!k\232\001\2306\315k\3364s\300i\226\311i^2\027"
+	.ascii	"r\206\372,\f\365Z\027\352}X\250\377Q\241\236\213B}\330\204z1"
+	.ascii	"\t\365g\204\372/\b\365e\017\352\315\034\324\237\3558\216\017"
+	.ascii	"\341\323\016\006m\016y\346\262\364\240\222\224\273;\273\254!"
+	.ascii	"g\256y\327H\231\346M+g\232\027\315\\\334\316\211\210\246yi\220"
+	.ascii	"\333\342C\322c\304\333\024\035\267\2447o\357\334\223\027L]\264"
+	.ascii	"y\205\310\345\261\250\035m\256\346\212V^&hs\211s\305\0362\324"
+	.ascii	"h3\t\336\236 \001\375\336<\242\334p\355W\2046\213 C\2000\267"
+	.ascii	"\261\246|h\363\007\323\303\271&Xa\001g\247s\227km\305\326\313"
+	.ascii	"\271a[\357\347\006\323\314K\344^*\214'HL3\017\235\213\243*\332"
+	.ascii	"\005\225\213\353Q\373\211Q\256\330\346\303<rw\306\316Q\222sq"
+	.ascii	",\232\320\216\220{4\035-#<\266rE3\027\300\264\262\314\\\361,"
+	.ascii	"hFf\256\311\221\333\325\271\"\260\213\215I\027.\231\241R\211"
+	.ascii	"T\032\235\313*\252v\212\312U\321\021\362\323\363\2759\024:w\277"
+	.ascii	"\200P\004\235\033V\250A\f\306\304J\235\202\244\250 \205B\007"
+	.ascii	"\360\002\251)\316\001\0210\265\323j\242\362\352\001>\2565\244"
+	.ascii	"Cu\306 \333\343:\333\026\r\017/i\215\275a\230\262\264l\243\362"
+	.ascii	"\256\031\264\320\263W\0062\013L\364\335W\307(\344|\246J\262\352"
+	.ascii	"\002\003\207\246\371\330H\3551Xc\\/\252\221\202K\025+^\376\367"
+	.ascii	"\351\177\235\374o\235\236\2150\222\330J\316\350v=\005J\307\353"
+	.ascii	"\313\252\271\242\255h\372b`\215xq\276\341\216\265\302|(\2356"
+	.ascii	"\241\250\f\273)\234\304\b\376\216$\375\007"
+	.text
+	.section	.gnu.lto_.refs.6053e0b5c221cd13,"e",@progbits
+	.string	"(\265/\375`1\003\305\022"
+	.string	"6\347zF\300P%\303\001v\216(\266\273\374\035\372\275b\245\376\210\315\366\211\331g'\372\001b\262\033\252%\371tf;\252\177EQ\024EQ\024EQ\024EQt\031\n\347\312n\037\214\b\305\326Zk0\366\031\251\214\220\275e\nZ"
+	.string	"d"
+	.string	"k"
+	.string	"\277\314\216\300\373\002`'0\003x\017"
+	.string	"\354.\263\263x\237\022v\335\374\334\255\343n\375\026\366\020\354'\263\227\234\374l\0271\351 %\377\331\272,\231\244V\037\230\335\300H\037 _\200Hw\221\337\022\322Q\344\357@z(\037\374\350$\362\347\327?\371\322\353\225G\223\333\357{/\001@ao\204\357\353\323c\373\362@\330\311\365\352\200\2758\263\327\246f\327\373"
+	.string	"\367\225\321\365\306\204_\230\\\177M-\r\327?\363~3\0358\312\302\237\206\355\2171\026\006\006\376_^\337\337\305\305bkE\226\374\261\256\254\252\246P\234\230}\023%\302>\t\260\0375\273\203\357\033\200\317 \354\013\276W\020~\002\260\001\037\2232`82\372>Z\250@4\024\364c\373\330\303\263\243\223\003\366x3{\264\t{\244\311\3658\223\373\b\243\326\003\355\206\356kc\245\227L\345[#\327;#\367\025\003\371\206\251\364\302\370\370\272\370j\301\025\362\325\032\371f\211|\261\244\240\344\367)\345\353\204\362\035\321\304\244ai\367UJ\302\365\"y\337\013FEDBA\022\002/\251n]\246\210ry\3314_zHy\271a)i\345%\322\221\355\245QK\227E\273\227\024X^\016\t\335\272\f\232"
+	.ascii	"\364\343\323\263\363\275\314\301\271\261\251\t\273\244\001\273"
+	.ascii	"\234\231]\312\204/c\326x\354H\333\365\210vf\226\243\214L\306"
+	.ascii	"\230\330\013\357#\330\227W\027\327\226\226\n\254+\253*\252)\251"
+	.ascii	"\250\357#\324\223\223\356\243\210\360c\b\020\037:p`R\002\003"
+	.ascii	"o\250\021\360\306d\2062\013\n\225\306\020\243)\253\003\020\360"
+	.ascii	"c>Dv\337\013\216\207\006\n6uX\254\030e(\272JD\313\303\300\347"
+	.ascii	"Y\241y\035,\244\217\350%m\2758\0235*\311%\030\030`\244\214\t"
+	.ascii	"\272#\333\212\331\025 n\257\270Gc*\316\214%3\254_\bO\336\022"
+	.ascii	"P\036\361\314\2744\005\005\276\331\tW\252\303J\255\n"
+	.text
+	.section	.gnu.lto_.decls.6053e0b5c221cd13,"e",@progbits
+	.string	"(\265/\375`\006 -\220"
+	.string	"\032\350\2343S0\022JJ\007\272\276C2\253\243d\352\r\225U\355[?*\016\250\311\331Q\305\321\352/u%(\271IT73tQ\261\036\200\240\035\3066\324\276\003\022K>R\034\307\377\007\377\350\222\245UU\020\214\231stL\001"
+	.ascii	"\021\022V\251\334\335%\265\232\220-S\256\002!\003c\003m\026\246"
+	.ascii	".h\f\235\030/O2]:\315LO\276A#\243\3513X\331{8w\232\216\266^\377"
+	.ascii	"\360\316\3532_\301tZ\3535\336\245;Kh\336\362m\361A\352+/\347"
+	.ascii	"\\\203'\006\r\335\316z\314\003\333$\260\027{|\204=6\302\036\023"
+	.ascii	"a\217\237\354\361\026\273v\b\337\n%\353\020\276\206\006\275\355"
+	.ascii	"\324\263)Jz>\324\265\332\027\2674x}\327]\212\235Y\200\233\250"
+	.ascii	"\231\265\035x\215 "
+	.string	"\350\355%\204\217\331\204f\036\237\227ZU\031\272\023:e\344\222\274\272\230\340\201J5]\341\265\261\250Y\270\330=9\373\203\320\362\322\244|\001\223\226a\222\246\354\211\236\031\2243J\324zl\247&g\247\3353ghP\224\036\353i\220\r\300\314\264\225\316\322q=\355-\315\245\345\032\256\257t\264\261\264\333\273J\277\035Cs^\346\234\203\376\b(h,\275\326m=m^\360\345\303]\316\320K\360\367\2227\226&\353\261\002h\344\354\354q\300\2254\352\206\274\234\241\016\220p\300\201\032/wPx\030\261\266\263E\370\002h0lOi\266\216\232h*\217\200\202\253\312&\031L'\r\2224g\360\372\356\302\276M\370z\257M\370\336S\366\035\205}\207\261\bp\261(~\260\357&\373\263\246\301~Jd\177W\002\333M\332IG\033h\036\336\320V\362\032$h\206\346\f\345\301Zh\312\234\340\365\037\260\007Xe\n^"
+	.ascii	"\373n\300\247\356\355u\003\276c\026\207\360\365\264\b_\2035\240"
+	.ascii	".193Y\316P\037v)\305\f\f\257\207\266\b\037\333!|6?\326\372{\203"
+	.ascii	"\277st\371\273\307\334\337U\\\376\006\"\3677\316\3379Z[\236\345"
+	.ascii	"\277\336\337\370o\025\206\226\277\335\274\310\220\345\357 qG"
+	.ascii	"p\177\177M\213`ar\345o1+\177\233\360\237\304\377\006\n\370\037"
+	.ascii	"#\306\337o\177K\371[\372\242\037[\371O%\312\337\036w\270c\271"
+	.ascii	"\226o\371{\252\207O\241\374\027\372O\302\177\006\3766\273\211"
+	.ascii	"\037\357\360w\364\357&\177\207\375\235\344o#\177?\377\346\372"
+	.ascii	"{\353\357\254\277\261\376\266\372\333\307\337T\1777\377\306\361"
+	.ascii	"w\324\337\314\277\235\376f\372\333\306\337K\177+\375\275\374"
+	.ascii	"\033\351\357\3747\r\177\317\360\367\321\337\357\337\307\277\215"
+	.ascii	"\177\023\377\026\376\375\302\337F\177\027\375\r\374\333\205\277"
+	.ascii	"[\370\233\205\277W\370[\205\277S\370\373\204\277C\370\273\305"
+	.ascii	"\337,\376V\361\267\316\3375\177\257\377\353\376w\371?\367\337"
+	.ascii	"\305\177.\377\301\376\303\370o\301\377*\377\327\275\275\275\275"
+	.ascii	"_\235\340\367\025\371\005\340\tHQ(\27223?p\037\033\033\005\257"
+	.ascii	"E\301j\f\344\334P\347\023\023C\301=\034K\177,\305j7\231\231s"
+	.ascii	"3+\301\240\bc\206q\313\313M\346\211\377c\216\325\322rr.\340f"
+	.ascii	"H\221\037L"
+	.string	"x\305i\030\243a)\307i\370,g\211\323\326\234\221\272\023\330\351N\240fM\007$'\276\365>!\354}N\366>\033\354\217\177_Fb\346\234\243j\240\231\231\224\343\373\373]\323}\342\327i\265\025\310\352\nhVb\321\"\206-\"E\242\302\b\344\327Ls^Z)7\260\202ZZ\345X\022\263\312\312%\227\322\207\231\255\224Kb9\373\344\345R\271\302\231}\226\3042T\246\021\007\325\031j\245\314Kg\366\311\313\214\204\300\322\322\njI\f\t\312gI\314\n*\213Y\345\236\274Db\326Xf\246O\026\263\002\223\305\234P=KbN\250%1+\252n[\372\242\006uE\313\017\260F[Zf\247\246\035H\314\236\351\022\324\231\347rn2\245\314T \347\035N\346\034R\216>K\232:%AAr64\347\\\242)\351\2073/\247KF\2349\033I2\312M\023(\241\323\234\325S\345\325\216\314\244\224\363"
+	.string	"M9+;Os\316\312\234\263\rs\0074\347\251\236\245gSS\316M\022My\207\022M)gLFw\006\265$\366\303\031\204\306\203\3303\327"
+	.string	"U\3663\317Y1Y1%\223\314\024\206}B\331\200\207W(\024\347\254G\031\016\274\342\262\034/\322=25\026G1\017\035\375\032\036\373\315\022\232\305x\330\306\3708#ce\330\364\327\304\300\326\236\244\335\300\353%\300q\206\301\360\023fZ\351=\315\244\276\334A\341\250\23667\370:c\203\004\030\f7\261WO\203\254ovwe\030\f\337\220w\327\004C\361\022\354\004\207a&XIG1\030Fr\374\205\223\260q[9\244=k\237\265\b\337"
+	.ascii	"5_l\327JD\307\226%x}M\026\373N\003\362\206uh\321Muy\342\035\260"
+	.ascii	"\021,\004sa\035\360\023\037\301D\360\020\274\325Q\\\004\347p"
+	.ascii	"\234\243\3150\026\016U\202\270\375\270\262B\265\243\333z\314"
+	.ascii	"a\036=p\325\216\232\263\023\313\031.\202\255\256\004\025\301"
+	.ascii	"Y=\266\203\004\315L\0333&\235\332N\215\260\036\246\214X\277\236"
+	.ascii	"a\277\322\261_\255\260_\241\260_\277X\022Z\354W\036\354\211\365"
+	.ascii	"F\025v\266\363\007+jx\305>V)+@\270\360\3725\211\275\252\307\246"
+	.ascii	"\330\302\236l\215=\025\025\215\315Q\277\330\253\\\354U+\366j"
+	.ascii	"\216\250\266\026r\206\372\2701}\340\365\352\022\213\231cb6OZ"
+	.ascii	"\234\236\364\330\037;5\0355\233J\360z\334\204\231z\307\206\250"
+	.ascii	"\327\024^q\rl\243\243%\360\215\306\013\222\004%\206\245!\347"
+	.ascii	".\341\353\275\275.\341\3035\004\035/]\240u\365\205W\365X\251"
+	.ascii	"\204M\027\232\017,L\003/w\242\320T\241\301\353\361\227\276\303"
+	.ascii	"IK\226K\352\205\205W\214DBM\303\206$\205\327c9\366\001\027 A"
+	.ascii	"\243\303k\273\372\246V\301\313\262f\031^U\267\316bSfA\261*\025"
+	.ascii	"\225\355&\313\024\035\0276\337\225'=3Sn\344\302\360 \303\353"
+	.ascii	"u\226\330\353 \261*\232\212\246J\351\t\2228\325\264\253R\222"
+	.ascii	"\244As\200"
+	.string	"a\241O`kN\322n\303Y\2540%EQ\251V\033R\262\037zx\202\255\302\330\245\341U\035S\307T\263f\342M\320\006'\367\226\227\2338N\374\352\223\253fR\366\210\023\037\320\360\252\226]\312\004\bZ\034^U\262Ky\2420\231\323\3121\023\023S\243\2761\270.3l\216\"HjtT\215\252^k\335\224==\261%K\324&W\227\271\007\232'\210''\254'\225\311\325&*\2270g=\340U\205\036\t\013S\215\330\245\271KNq\232\303:rDMb#\004\214\026^\036\016TX\230\017\365\353j\022L\226\005\3251\005\257*\222n\333\321\301$3\247z\r\255\345\220\207W\265+\007I*\n\034\017\3669ND\210\250F4\200K\342\345\245\003\204\213\254K-r\325\210\n%%H9\371\371T\251\272\007\232\304\205\354Ys\003\335\333\325\026..\225\252L\352\313\213G\271\325\005dLKK\335*"
+	.ascii	"\255*\211\027\324\016Mo\253\251\305\304\353q\232A\202\250Y\276"
+	.ascii	"2e\227\231\025\0073atxU\263\364\312\350p\242!su\245b\t\251\322"
+	.ascii	"\302\313\363\005Q\342\324\005\310U\2545_\227\252\251\272n\253"
+	.ascii	"\371A\246NJWU\245Z\371t@\323\302\353\3421"
+	.ascii	"\205\212j\325m8]\240\274\302\336x\360P}\220p\252\\tH}y\331\214"
+	.ascii	"\211\242\344T{\\\365\321ctpR\360\3721\277\351\035\242 y\002e"
+	.ascii	"\247\324)\225\252\271|I}\235\360Ea\341@\003\257\247\222\332\004"
+	.ascii	"!rU\326%\365\216\252Rj\023K\357\350\324@\214\001C\207W5G\213"
+	.ascii	"(fnY\354AH\341\300\201\233^\263\314WaO\235!_\321$\274\036\004"
+	.ascii	"3*\252\006&B\336V4_\344\262\352\230\314 \3178'\325\251\310\335"
+	.ascii	"\215\025\246\216\252Lx\2716\311J\234\350\031\251\257\274vc\272"
+	.ascii	"\001\267fC\265qc\210\026\236\215\016v6H\361\372\033\256\245%"
+	.ascii	"-*%\245\255\033Ku\331\343y\243\204\244\"9\315\260\277\232;\252"
+	.ascii	"\346\256\003\301\271:\231\212\002\363\312\340\211\023\222\273"
+	.ascii	"4i.m\346\210\032\234|\335M\363\362\260\336\002]O\350\003\270"
+	.ascii	"\f6\323\321\023\370\f\020\310\230\032\033\373>\341\3439\341;"
+	.ascii	"KF\206L\r\345\217'\017\231#<\264\360zv\207\0301B\236Nxx\227\256"
+	.ascii	"\320\274E\3014\214\233\027\273"
+	.string	"\274\273\273tm\222\267l\2344u\352\230\246\302\374`g\207\335Xh~\"\261\304\031\306-\357\346\006\2663\273i]\024\327u[7\311O \222\232\250<\200S\265\245\315\206\215\216nG\331\334\034\025TNn\252K\213\026\035C\342\342\232Z\323\351\245kO\276\221\344\364\364q\345\312\245 d\032LR\f9\263yz{G\361\033~\202\233d\345\316\217\032Q`y97\037\300E\310\260n(\323\3666\354\326M\f\234\204\335\345f\363\304\n\205\306\364\204W\267\333\325\304\031\341z\202\327\373\264\260E1\033&\003!\0077\372A\n\3357\031\201\004l\004\022\030\207D5\305\030,\332 \361gD\324c\364\376\206@\304b\021\321\375\035_$\261H\004\002Y<\022\271C\337\313\201\013\241\027'\0049\330y\223Fb\213\267e\2413\300\007B  ]\340\300D+\303%\026\213\332\025*\3366\030\342F?@\356\0218"
+	.string	"\322\025\n\335\241\317\205\320\013\034\027o\033\324!\306\340\036\177-\321\035\341E&\217F1f\b\215F\002b\254x[\026@\327\310\276"
+	.string	"\324\334\350\007\b(t\223.\224h\201E\027\301\244\013-\360f\230\204\001t\205\204\200\256\321\346F?H\002^b\022\004\260}\335\241;\002"
+	.string	"1Z\344\257\203\026G\305\340\372\022\335\242\361ma\274I\343\233,\341\250\030\274A&\213\356Q{\024\"\272\357\020\322\005;\343\370\022=@\356\334\350\207h\210\230<\002\021\035\200\f\376\204\037\004\211\356\360\370\303\321\271yq\374\265,\216\212\301\234\366\375\001\215'\214h\337\337\013CH\247H\004a\261H\004\242\031*\\\243\bG\305`\215q\370{qT\f\342\200 \343\347\342\250\030\344\031\266/r\006\f\021\300\343\017H\374\2750^\227\330\"\2006\310A\316\023\020\026\213\035\f\325\354\240\370y\217?\343\017\320\025\376P\200!\342D\356\261%\266A\366\023T"
+	.string	"A\005)d\330<\205\005(,@\341{\n\013\202\202,\250 \210}\005A\352\373{\205\355\n\034\235\367F?@A\343\210c;tc"
+	.string	"\333\021G\355\212\366\375\275\310\351!\026]\344\261=\"\266\030\302 \3443\204A\b\330\022\021g \211'\264\310\344\316\213<&;h\221I\235\031\307\267\035\266\3026\206\317;d\203\f\376b\024]\237\260HT|\213G\241\367X4\"\211\277c\214\021A\342\317\205\327\355\340-\032!W\264\310$\317Q\013T\333\244\360\207\302\333\"\213\212Jh\205\300\026\302\337\353\006]\340\b\242;\304i\205\357[<\032\2752~C\034 \3617\034\026\211\210\356\020\304KL\026U\264\302\242\320N\221q\204\241\361\005\216\315{\243\037\240k$1tG\030&a\370\220C\277\367\267\002\351\312\340"
+	.string	"\350\032u\204\272E\257\350\017z\230\204\241\336\350\307\304\213\306\366\b\364\026\213G \034\344P\320-\"\026U\364\274C)lZ`\221\005\266\255\021\t\374\265FC2~C\237v\350\276C\306\244\260X4\"{\212\356\373;\016\035\177mp\307\350\202 r\205D3"
+	.ascii	"\030\321\"\205I\343\320\035**\032"
+	.string	"j\217\334\227\250\025\n\213D\006\274C\025\004\275D7\311>(H\005\002'\220\300\202%\372\001\276\310\241c\221xl\217\212A\240\327(\350\n\213\200\210\356o\bDtD\002\375 @t\177\301\241\027\351\"\221\277\241c\361-\016\205\356\357\035:*\006K\3205W\254!?\370\320\305\007\210\262=0usV8\\\3204\032\\T,\337T\356\210\231\234\272\245\243\204\254\371\266\005\253u\200\307\004D\013\326S\205\300\231Qf\311\252\"\335\241+\016\223\265RNL\013.IN\030/vP\246\252\021\2338\252\261/,MT\270\346\220*W\324h\317]!\271\261\266\246\276\005\202\302\250\3628=\007\002\0252\206FFd$I\223\306\"\013\020\210ba\034\327\366\022\240\024AUJhHD\222\024\024\024\322\001F\0313\001\244\375\025m\340\243z\371\231Y\231\006\344\255N\273\213;\254\366\332\001\222)tNPE\260\202"
+	.string	"\027\033{\275(rqH\321\355\272\245\214MT\334\274\242\206\347a\245\r0\n\253B\007hEO\313\276\013H\376r\030\351\004\367\313\265\312T\342*\233@Z]\242e\301\271\177\340\032(\332%%G\336\253@HHN\005nAy[\241n\007\374\344\221\2614\244\326\322%\006v\006tQ\353\037\266\247Jg8\340k\252\377h\375m\324E\310\320\266pbu\242\322\237\260\265\342\b\037O`\307\31154\307\221\2161u\025\233(\254\337\360z\314C\002\342\t\225R\313&BJ\214\022&\022\372\324\3503\013\370\316&L\200T\"\263\177\205C0o\022$\365\262>#Y\321\004\027Mvw\256uia\240"
+	.ascii	"\342\222s\005D\207\327qb\364kR$\325s$\034\332\377\347\235\307"
+	.ascii	"\334\206\244NW\0256\255\tA\272\372\204\016DZ,\213]\360\276mp"
+	.ascii	"z*\037]'\372\2771{\245\303\247\022\3722\353O\3365\026H\337 \025"
+	.ascii	"\353\2501Mj\237+\301\206$\201\314\340\235G]2[\316\347\3049\352"
+	.ascii	"\202\260\232>Z\231j&\256\347\350\355.1\037\t\315\0217\362\230"
+	.ascii	"\004\0019#w\017<\201\341U\322\006}\004\004\353\3277ur&\376|\233"
+	.ascii	"\256\321\243\310w\261\313\203Q\344\313B,)V\270\342\r\201er\264"
+	.ascii	"\260^x\342\246\353\006\260\205\002v\006Y\376\233Y\033\004U\025"
+	.ascii	"f\210\202\253\347\013\003\025s'x\0168\264\201-&\0352\226\263"
+	.ascii	"\253\205\304\267\374\217\300YK\234+r\321\312\326\275\200S2}`"
+	.ascii	"\362\266\376DNp\340m\227g\216\330;y\370\214g7\3373\266,\036\304"
+	.ascii	"\356\005CE\311\257\340\224\252\231\274\2460\212\366R\032:\003"
+	.ascii	"\275\352\231p!\345YD\324\210z|C\200X\220\3340\017\244@8\214\217"
+	.ascii	"6?\252\013\271#,rm\272ix\305^\007\024l\332(\355\207\331/z\212"
+	.ascii	"\016\205\217\342\267\314i^*\241\013\347\255g\241\344\231!\344"
+	.ascii	"W\n\237(\325Ag\200\260\253\247\246\362\0235\303\372$\206\244"
+	.ascii	"\375;\r\t\300\273\300\377^}m\316\004\240\304\341KqL:\20181,\027"
+	.ascii	"\212\204\022\255\270\313\242h]0:\304\206K\204u\265\256\253l\320"
+	.ascii	"u\242\3727\245\003\267W\253<I\356\225\224\314\261Z"
+	.string	"e\3521\230)YO\257\020\302\325f\202\350\024\rdq5drdD\025\036pPA\007\b\r\270\270\232@\257\262e\346\201\371;Q\250d/\334j_]\350)\034\211|L\244zHL-+&V&\320\b\344\306\211X\332z\262\315\205V6:sB\312\215\245\235\200R\310\273\23717F\013\207\232\356\024H\313\236s\214\216=m\263\244\2075\025\036\375\234\240]\272w\363\3365H\346p\325\021\224F,TH\031dVb\002v\203\245t\3429Ji\206'S\360\325\371\222\302Q\333\007*\344\315\373\210\016\214\006w\316\203\370\252\263M\032)\263y\250\002\036o\274\300\350\334A\\`\001T\355\035v\374G\237\344\252\352/\277\210\243\324\f\356t\332\tI\003*>@\255/|\260{\n\b0@\247\330\373=\030j\201X#\367\201\234s\206\271\306\343\036q\310\rsp)'u-U\331\304\257\345\237\360"
+	.string	">t\207C&;%\204\345\355\266\02270\265&\244%\332\217\354$\334\213\235\376p\341%\21703e\276\2010I,O\356\021\317_\261\004\321\350zp\0202\033\266\b\353\324x\236\032\027\026\222\340\311A\326GQs\343@"
+	.string	"\3462OKF\316\300\352.<B\317h\255\t\266\317\204\356\032;\356\020.\370\211LcU\327\364\025\017\035\322\3516\223\013\304?P\352\341\360\217a?\001\n\221G#`\025\265\222\305Q\346jd\0056\242&\233S\367(\207\336\0354\f<\027\370`\363T\273\320\221^\352\201\345L\033\3418\324\215\201\205\345P5\t\331\001\215+X\351t\200S\241z\213\312\273\367\031\374\021\027\027kd\353\270\001\273P;`l\027\245T\310\230\374=B\320\bai\f\210E\273\215Wh\021f(\007\242\311\030\357y}p\246\357\247oR\3137\225K\252\371\026aI\336\r\223N(\351\005\2676,>\341p\241\3378\341\332\275`J\320v\373q\371\354\021\017\360\253\367}\336\322\344\267\023\214 W\306\213\353w\2452\241\3453\362"
+	.ascii	"\364fV\227\350P\315\246Hi3ec\3467\361\252\365\300\320W\362M\214"
+	.ascii	")n\257\327y4\370(\231@Y\370\330\243\204\016\352\367\247\336-"
+	.ascii	"\315\005\275\001_\273?\327|\274\374\3456]\3657\t<~\034\205\031"
+	.ascii	"\320\325\n"
+	.text
+	.section	.gnu.lto_.symtab.6053e0b5c221cd13,"e",@progbits
+	.string	"governorInitStandard"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"governorUpdateStandard"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"governorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"govState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"govGearRatio"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"govOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"motorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"pidGetDT"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"pidApplyThrustLinearization"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"getMotorRPM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"getCyclicDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"getCollectiveDeflectionAbsHPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"getCollectiveDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"mixerGetInput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"getMotorRPMAge"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"getMotorRPMRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"getMotorRPMAt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6053e0b5c221cd13,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
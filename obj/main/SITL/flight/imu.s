@@ -0,0 +1,1280 @@
+	.file	"imu.c"
+	.section	.gnu.lto_.profile.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\177\001\345\n"
+	.string	"\004\020s\002"
+	.string	"$"
+	.string	"\255\234\214\225\013.\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\001\335\276\216\252\016\002\343\267\245\270\f\003\240\342\234\212\n\004\335\264\214\277\017\024\002"
+	.string	"\002\004\005\002\005\005\352\263\360\321\b\006\354\316\223\322\017\022\002\006\002\006\002\007\b\002\t\005\n\007\n\013\247\320\217\212\001\f\371\372\315\332\017\022\n\002\n\r\233\326\340\375\t"
+	.string	"\016\214\353\300\262\002"
+	.string	"\017\020\257\216\243\336\004\n\002\t\002\013\002"
+	.string	"\002\f"
+	.string	"\002"
+	.string	"\021\022\023\024\311\313\233\264\003\002\025\242\302\263\302\013\026\203\366\244\240\016\n\002\r\002\016\r\027\030\352\263\360\321\b\031\032\375\374\375\264\f\b\002\005\002\017\002"
+	.string	"\034\327\235\250\225\n\004\035\313\304\355\226\017\003\036\311\204\277\354\005\020\020\020\037\221\326\260\227\004\006 \301\246\230\212\004\001\005\002\005!\240\202\262\202\016\030\"\361\251\244\237\f\002#\255\376\215\267\r$\353\254\332\242\b%\240\342\234\212\n&\240\342\234\212\n"
+	.string	"* \260\202\263@\354\005\201\001\004\2043\\\356\022\024\252$P&\330,p\276\310\25473Zf"
+	.string	"[\230\355\266\373S\315\352\344\232\005\3666@\021\213c\201&\310\202XU\345\340\354mimP4@E"
+	.ascii	"\\\254\327q,\245\t\370:\263\223NZ\021\307<\\X_#,\255\f\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\245\003"
+	.string	"\242D\f\016\300\232-\006"
+	.string	"#dA\366\034\003\372$\003\252\331\210\224\372\022p\237\236u\316\230\227M\331\304D\314Cc\211a\325B\220\320G\265\337\275[\227\027\001\034"
+	.ascii	"\027\023\210\241p\001|`\230*F\212k\271\214\266\032\317:\341\t"
+	.ascii	"X\034\324\013,B1\003\360\f\344t`\nw?\215\365\264\202\033\300"
+	.ascii	"\"\027\204\t\250\002\\\302\201\302\200\021)\304\001\335\024`"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.inline.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\316\004\335\022"
+	.string	"\326\227P>0q\222\341B\237\002fI\r\307\215\322\372\337\030\032\335\243\242\355I!\256:\353w\030\345\n\252\363\214\264F\315\276\n\313(\244\002\325\241\005\311xF\314\3065\211\267O\232X\322\b![\356\0248"
+	.string	"B"
+	.string	"G"
+	.ascii	"\332Ci\013\3407\206h\373\200z\3745t\356\275+\3414$\341gJ\034"
+	.ascii	"\204IC\0227\375$\320\244\355(\21689l\333\351\267\027j;\201\377"
+	.string	"\266\227\242-\203\367XZ\t\357(|G\272\243#\3620\303\211\312\205\004\021H#\245\205e\301\326c\370\033\320\031\3513}\207\025XZL\200\360\335\306\016#H|P\360\264\001\271\337z\225\273\\\277\\\251l*\213\260#\221\017\307\216\002\230D\017\272\337ocI\333\353\003Z\205\331\300\b\311y\005@\254\234XAQ\205\213\224\030\227\th\257\036l\314\270\310\342D\305\344z\200\306J\243\026\300y\236W\343\205\b\016\326\001\252\351\260E[\353k\003\332\320\226\343Ls>\225\347\203\031\301\345\306\036lI\003\310\002\214\211\342@\306\204\341\022\232\332Nv\272\220\253\353\314\262\331\340\021\016\202a\363\272\246E\315\350h\212\270\217C\262\220\307~\330\243>\252\314\001\200\206\2501E\t\325\004MRc\032\003P\002a\246\312\272\001\022\200#A\206\344\336X\230a!{\355\031\375T8|Y\244\230\305u\030{f^\"8\352"
+	.ascii	"\226\"do\237T\004n\0355\220\244\352,K\020\307\022#$\355)\356"
+	.ascii	"\243\342\242\324\002\207\b'\231\366l\353\361\261\352\204\333"
+	.ascii	"\252f\363~\375\226\247u\360\320B\257iM\305\217\376\246f\240\005"
+	.ascii	"\254U\2457\367\335k\311cX\341\215\371\245V\206\263\256\332?a"
+	.ascii	"a\247f\262\266m\235[~l\337.N\336$\n\205\271\361\320\200l\203"
+	.ascii	"G\300{\006\2413\340\2447t\230\275\323B\037\016\022iG\207'\312"
+	.ascii	"\036\236\320]\257wB\312,:\265\351e$\332\254\361lp\027\220_\002"
+	.ascii	"]\360\357\3051\025\00367\266_\204i\271*KR9M\322\336\262\317="
+	.ascii	"\225\376=^\t\266\211\343\007\276\325>\211K\374\247{\340\222\034"
+	.ascii	"\370\031\361\023\252f!\333z\320\303\331\024Ci\332\363\036\227"
+	.ascii	"\357\253\235\243\252\r\025\205*l\251\253\220\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`q\001m\b"
+	.ascii	"r\214)-\200K\322\00130\003"
+	.string	"K\207.eDf\321E\240mZ1E\373\267,!^\245\026\217.\345>\207\237\201oH\020\207\277ll$wJ)}\236\344=\32782$\024\216\022iL \217\216\215\346(\221{\021N=b\006v\310^\366>]\332r\ba;-0\005\347Gh\r\332N\356\t\365\246e%\2101\306\374\301\323\231\373\366\200Cl\020\337\205\257\203E*\372`\261>\334`\200\364V 3`\255\266\346\013\365\027\032R6\244\356b<+uV\334\346i1\207\311Vo\301a\036:\332vf\333\245\t\355%\002+ `\0022c\264\007\263\331h%\220\300up\202\354TMi\006\236\205\2505TP\201CLS\273R\t\353\204>\376\257\201\236\202\277\334a\326(D\201\317\002\342\250K,\034\303\023;.\220)iw\337 \263-~8\255\300\fH\241\335\tV\035!\210\013\366\252\177\201\237\201\244\275\217/\020\n\230\032a"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_.pureconst.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\230\004\004\232\004\006\230\004\f\230\004\r\230\005\016\230"
+	.ascii	"\004\020\230\004\024\230\004\026\230\004\032\230\004\034\230"
+	.ascii	"\004\035\204\004\036\232\004\037\230\004 \230\004!\232\004\""
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"\215\006"
+	.string	"b\310\027\037\220\265\031\016\377\353;\355\377\340\377\377\377\377\204\247\267\326KM\304\020\337\254\331\213^\033I2\005\352\363\253\224\341\274\032\027-r\321r\214\272(*\236!y&;\350\t\355\022O\304\206&S\245\037\347\271^A\202\203\346-\002\207<\021\346\311\374b-\347\f"
+	.ascii	"\034\207.+\257K\317\3033\271\2002 \200\002)!\355\0017\f\f'ag"
+	.ascii	"Q\271A\017 A`nN\354\r\200\311a0\234\305\242HFC\202$r\241\317"
+	.ascii	"\020\263\013\032\322t\027\304\3542\342\360@p^\026=\00659\354"
+	.ascii	"\326\312\006+\245\336K\032\236\360\341\002d\323\275\2730}\250"
+	.ascii	"\355\371\256\265\267&w\345\300\254\331\035\240\303X`\362UBn\311"
+	.ascii	"=\270\343\266\317?\340\342\016\001"
+	.text
+	.section	.gnu.lto_.lto.2b73cec9add7440e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_q.76.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_qP.77.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375 \231]\002"
+	.string	"\364\003\214"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200\320\001\177}\304\001{\303\001y\302\001w\301\001u\300\001s\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\003"
+	.ascii	"8\202'\013\342\030(\002"
+	.text
+	.section	.gnu.lto_attitude.78.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375 4\205\001"
+	.string	"T\002'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\002\005\001?\202\210\200\030\1773\273\0014\273\001\274\001\273\b}{\275\001"
+	.string	"\003"
+	.string	"f\nK\tz"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_imuConfig_Registry.82.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375 \234\235\004"
+	.string	"T\bj"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\203\357\201\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\326\006us\250\364\005uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\226 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/imu.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_imuConfig.84.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\320\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\304\023?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")C\017\240\b"
+	.text
+	.section	.gnu.lto_imuComputeRotationMatrix.86.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\271\007M\035"
+	.string	"V\361\247H\240\230Q:\214\320\350\200V\254\247rF5\2667\320\330k'\326\001\204\256QBk\360\316'\331b(7|4\304\326\\[rL\246\3531\323\033\274\312+\207\223n\256\017\376\313\177\271\311\223?\001~\260{k%_&\231\002~"
+	.string	"\211"
+	.string	"\243"
+	.ascii	"\256\375\366\371\335\363\233\347\367\316o\235\3379\277q~\323"
+	.ascii	"~\337\374\266\371=\373]\363[\366;\366\033\366\373\365\233\374"
+	.ascii	"\355\372\275\277\377[\007\310vP\231\262\253\232S\305QkZ\221N"
+	.ascii	"z\330V\253\0205\212\320 V`\344\307\234s\246\244-\302\236)\251"
+	.ascii	"3+\331_\024\252i\302n\230 \021uf\316\371[\034\252\244W\262\352"
+	.ascii	"\223\312\206,\226\3640\002sN\177\310\242\205z\325\366\315v\316"
+	.ascii	"\216M\b\013DA\247\226\340\262n\026TI\022\333\326\366f\244H\216"
+	.ascii	"\330VVC\013\210\361g\325h\fj\304S4.E4\352\b\211\003\207\227\222"
+	.ascii	"\247\032\216\251mm\177v\265\224>\204?Z\215\356\240D<\025\233"
+	.ascii	"s\n\260"
+	.string	"B\351\220\017V\036J\032D\210\353PIk\210\227\222\265U\243\352\226\260\262\214\301\037m(\341\367\206\255\256\2716\354\337D\277\207~\373~\367~\363~\013\375\016\372\275\373\255\373\235\373\r\364\033\367\373\366\333\366\373\347\017@\373Z]\221C\252$\222>5S\206\214k\311\375V\320\272VW4\035K\247]1\236\2425\331\356i\030\0036\\\346\234C_\024\314\001\004\t\022D}\277\253\245\223pJ\355\0321g\360\246\373\325\322\007ou\365II\246&\254\222\350[\240^\272\344\326\267\300&\251\036\003\275\332\202\333\336\002\213G^\003\315\202\005\267\274\005\026\261\204\034\350\025+\333\n-\260\b&\350\201Z\251b\333\240\005\026\257v\020t\212\024\333\356\026X\254\322E\320(Pr[[\235\004\245z\222[Y\215- @E\352\244\tnk\001.\n\360\341\310\350\347\341\202\005\243\f\025~\032\214$\034\375\212\222:\374\002"
+	.string	"0\322\006\nI?\017HHI\277\031TP]\2726\nT\261\n\256\320DL4f\\\345,\321P\3572b\300\320'u1\321Q5\224\355\320\372\245\317\276p\321\242\307\207g{Vy\273[\236U&\035R%q'\005\212\237\320\331\235\375\326mu\2168\233#\2648X\245\023\355%H\2247K\353\355\315U\351ds\241\357\301/\315ljv\266\333\232U\246\034U%Q\030[\331~K\2671(%\021\266Y\252\225\006\215\232\352\365Z\330~+\200\221\250aT\246\311PM\220$e\024\262\034"
+	.string	"\003\021\221\032\347\021\320\0345\206\030#\025I\024Ic\030\306s\220\006\351\321\203\234\207\373\215E\357\037\247\243Y\366\376\303\023h\330\035hg\267\224\303\f\226z'\017@B]\311\267\332\310\205,\301\372wZ\2054\017\023\031\313\231U\243\033\362\255\270z\360h\f\301\216`\262G\337n\215)\274\307\005\241\006\350\tb\337b"
+	.string	"\202\024T\330i\320\353B\243\331\253e\225:\236\304\240^bt#o\253\226\274\025n\226\327[\216\314L\227\004\321\003\200\226"
+	.string	"\362\024\007\022\356\t$z\247\252!\301?.\f\201\2430\367\237|"
+	.ascii	"\347\306\267\2332\346\026\023d\363Zr\237\271\335\202l\376Z\f"
+	.ascii	"\221\356:\341\266E\241\233L\256\025\030q\273N\307,g-\214\257"
+	.ascii	"\221\211\233y[\270\322\177\303\251Y\343\346\001Z\306N\035\252"
+	.ascii	"\016\210~\307\027\205\2062\300\313\030\032\025\340\273C\202@"
+	.ascii	"\016\265\330\316\037"
+	.text
+	.section	.gnu.lto_imuConfigure.88.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`=\001-\f"
+	.string	"\246VP@ O\234\016\243\232%x1\262\226\311\207p\241\311\016\364_\226\276p\271\260\013\214\342Y\023\372{Z\"D\271\006\274\201\252g\241?x\024`\b \r\f\365\371"
+	.string	"\240\300\222b\004\202\032m\"eJ\001<"
+	.string	"7"
+	.string	"B"
+	.string	"\351|\372"
+	.string	"\260\t+\b\200\273\021B\031{\212(0\330>\346\216\355\342\337\205}\211D\250\024\262\273\231Zx\347\331\361\317\341\032\236\b\302\323:\260\273NO$\341\326\333\216\330\036`\377#3\314\335\303\203k\3673\361;\234\224\361G\217\336p\362\336\243\317\251\036\257\330\206\307\006R\227\241\375yR+\330\247vw\255\034\266\246/M[\231\256\236\216\232\2464\255\031W\245V\324\312\362\021\"\242b\033\0361H\224\332\227\2070\030\340cw'\376\207\203\320\026l[\365\250-<\020\360'R\224Nk\003a\310\342\263\333ET)=H\203'C\247\252V*@0\256\251\017\005\256H6\233\226i\024\\4\006\t\262\006\032e\313*\230L&\021`\316\201\005\223i8\016\223a_wj\225\003\001\205S\247\236.C\307\027\342w\334d\320\037\231b\223M\325c\201\321\013\017\344R\273r\023%,\r\033"
+	.string	"3\241\331)p0\275\002,\301^yk*h\034\201\325\200\273\207\341\002\030\003\274\001\364"
+	.ascii	"{`\273\025\0233\f\214\001\306hH\316\265\231\346 \256\2530!\325"
+	.ascii	"\005\302e\234\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_imuInit.89.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\215\n"
+	.string	"\306\023I?0\305*\035\300\370\337w.\322\367]\tP\316\357~\036a\034OV\323\362\254\231\023K\314\350\362\350\355'\025\003\324m\310\261\231c\335\305\207\002\202)\250"
+	.string	"9\017:Z#\037<\204\b\331{\247\0246"
+	.string	"6"
+	.string	"5"
+	.string	"\0323\333\356~\024\344\246W:M\376_/\030I\361\325\322qZ\031\312\024\004\0302U\021T!\343_\237\033$j\316\312\303\356z\216$\307\335\3356\204\355\005\373\n\001\245\371\361\235_\362\336e<\b|\300\016\234f\316\216\211\223\262\354\327\335]\323\225\375\351[\"J\233\001\207\223]U.\301\326:"
+	.string	"\"\266\177\261\311.\360Xk?\023\020\347x\207}\346\261\354\236>\372\262\227t|\327;\203\036\217\367\316\376\204\324\300$@-\203\212\256L;4\232\037}@\333[\211\242\242\177\222\347\217\234\204\344\273\214\021\336dF\037\360\023Qt\300\212\211\317\002\324|\276\r(\364e\022\034^p@\237(\fA\337%\266\257KW\225V\336\312\023EU\r\245\342[\270\022\205RV\303O%d\003R\023g\314t\020"
+	.ascii	"3\241Gh`\255.\303\362\313\230Ach\210\223\330E\375\254i!x$\246"
+	.ascii	"Z1.\270\274\f!.]\314vh`\n\n"
+	.text
+	.section	.gnu.lto_imuResetAccelerationSum.90.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"5\t"
+	.string	"\026\320;80q\323\001\253\b\354D\310\353\234~\342Y\006A\225\303\241"
+	.string	"\213\265\004%\364\2420\315t{\b\366U\265}\031u\322\022\001G\034P|\316\205\31710\315\373\247m\367N)("
+	.string	","
+	.string	"-"
+	.string	"\377x\263c\016z\354C\232\214P\334\335:;\276]n\376C\356\351<\323e'aw-;\357t\317\333\036\260M`_!\037\261\360\277S_\224\344\273S\277d\235N\031\033q\206\223\243\r\232\344\344\260\317\331\211\262;\001\033/\325eWc\254\331\025m\371\260\035\377L\241i\334(>\345*V\371\237IN9e\235\322\323\370\223\243\204\362VY\342\301MJn@\nn\333\340$\025"
+	.string	"0\273\213\340\213\004\016\201H\242\253\216 \036\256\b\207*q1\210j(\323*H\300\330DCVG\030\226\325\017\270\347\354D-x+nb\330\307,\177\345,\230\003\025"
+	.string	"3\241\215(\360\rz\373\250\274H\355`0\362'\226y\030\f\001\343V%\025\b\006\266\003\2068\305"
+	.ascii	"\030&\252\032t!'\013v\274\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_imuUpdateEulerAngles.93.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\327\003\325\026"
+	.string	"\006(\213I\260\022R:s1Nn\375~\346\344\350\332\034=\373'<\"\240\3663\341u\354\377G\236\177\340Q\365\035\242Q\373\255\377\201\036%\322\026\241O\216\217y\271\261\367\005\276\205\330M\357\253\025\222\217\251\237\203\276\215\306O\b\2212\245l"
+	.string	"k"
+	.string	"}"
+	.string	"#\252\026\271\272uu\310\325\254\253A\256^\255\272T5y\365x\365^\255W_"
+	.string	"\fi\b\2418'P\361\307\024\222?\023\266\337\262\217=u\336n\256Jx\300\365x\3149eK\342>\037W}\374\037\235\225\323\375|\f\372\216-C\021Q.\235m\f \004\f\372\321\265\203\256\246\272B0\347\264\346t n\362\266\023\330v\261\307\t\001s\322\006\354\216\2735nE5-\272\245_]\373\002\216>\267\313\302a\177\n\274\2674\203Q\322e\251\260\257\205\230\342\274\331\227vs\316\003HO\322\340\023\235\364N\217>w\322\357)O\352\375T\236\374\262P0\031\375hZ\264y?\272#\354\217s\207\354U\253\214j\330\250NY\365K\325(W\237\\mru\311\325$W\273V\035_\222\341ZV\257\311hd\355\005\207\212\001CdGv\203-\221WkW\352V\304Z\373\276\002\267C\250!\033\323q;\021S\220\265\0314\320\347X\253\005Y"
+	.ascii	"\275\033\201;\331\367\031;\027\263\003\211\276\325\032\3501\365"
+	.ascii	"\370\225k;xS\flgG8\223\214\2138\347\204a\361\026\022(\314\350"
+	.ascii	"s39*\232\026Mn\271\373\204\253r\351\270v\215M\371\034\271,6\337"
+	.ascii	"\201\204^\314\351\227-\246y\351\301\271\221\361X\260\271\301"
+	.ascii	"PA\226\341f\006GF\243\263#{\211y\226S\243#\343\231\315td-\336"
+	.ascii	"\3748w\310\017\222\204\264\255\215*S1+R2\257(\330\252\354qU4"
+	.ascii	"-z\345\3037\224)\013\023\252\245l\016\024\016\\\325\235t\fC\254"
+	.ascii	"c\312\327\306\210r(\001m\352\303\257\265\025\234x\303\006\312"
+	.ascii	"\276v\233NPL\366d7X\262&;\006oT4\327\222\224\f\2053\030\032$"
+	.ascii	"\313\372\005\355s\331\001g\001O\250\201L\342\frjFd\202\024\244"
+	.ascii	"$\351\240\002\021\251\311:\021@\251CN\215mmm\006\323\221\214"
+	.ascii	">\202Y6\013\212\301\004]y\313\247H:\bHN\254\2461\211\252m\251"
+	.ascii	"\204n[\215\241\243\320\036\247\342\205\270Y`\365D\354[\343s8"
+	.ascii	"\304`!7\216r\237\326\270 \343\221\360\223hs\372\351\034\003y"
+	.ascii	"\2213\024\346\006\245\3115p6\336I\317\036\340Y\003\247\305\253"
+	.ascii	"\233\225\374\364xKx\235k7Xuz\301\342\225\271\207\213\031$\352"
+	.ascii	"H\306|\306\016=\225I\001\304\237\247u\376VIg\021t\263\206<i\216"
+	.ascii	"\367)\344R\003"
+	.text
+	.section	.gnu.lto_imuComputeQuaternionFromRPY.96.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\335\b\255)"
+	.string	"\232N\240\020B`\246J:c\2241\023\223^]|\246\203\242\211r0\364\227\206\354N\310\277l\374C\201\254\355k\231\222\027\355\003\025\350\212\267\233OG\237\316\256*\354\376\246NO\\\257\312R\361\321hm\223\226v\222\001\374"
+	.string	"\337"
+	.string	"\375"
+	.ascii	"`y\265\376H\006\252n\312;'\026c\313\331t\266\235}g\233\261\361"
+	.ascii	"l4\266\032[\317C\273\366\030\317\271\316d\\\306g\234\3474^c6"
+	.ascii	"K\244\267\307CM\035W4v\314\360\356\204\231\341\203q\327\307\302"
+	.ascii	"\016\251\202\316\317\t93\2505\244\352\326\343\317\223\022B\203"
+	.ascii	"q\2303\2131\023\242\001ajk\002\310\257\326Z\345rG\b]B\001\327"
+	.ascii	"\313\237\r\\\344\264\036\347,g\326\202c\"\32555#v\265V\b+A\350"
+	.ascii	"\022iz\356\272\212\255\234\371\212\016'\325"
+	.string	"\212D\220]\255q\020vJ\350r\343\274D]\n\255D]\356\331n\237\343\226\324`\2230l]\220\265\326\341\225\370\314\302 -\201\237g\353\240\006\241\26674\013\243\216\004!\342 \034 D\330&\035\342\322\270c\002\205\370Fok@\250Z\253\331x\272\275\251\315\031\324Pk\335\331\366\026\304+\344\335\005\262\273?v\205p\001w\222\202e\013p\276\301\3758~\256A\375y\033\213\250\315\344N\335?\201\207\016\333\240\264\231\234\265V\264?\211\021\017\343\240S\367\026\2707\177q\332\254\315?\273qh\363Iv\r\254G\262\353+6\006\213\361nY\316\253e:o\226\355\274X\276\363^\260\031\257\005\343y)\030\215\367\312j\274V\326\363\016\037\330\213]\345\300\\l\252\006\326bO\331\213\227\201\271x\027X\213W\001\235+E\347&\240s\243\350\\(:\027\001\235{\200\3165@\347\026\240s\237\350\\\002t\356"
+	.string	":\327\211\316m\242s\231\350\334%:W"
+	.string	"\235\253D\347\006\240s\223\350\\$:\367\210\3165\242s\001|n\321\347\022\321\271Ct\256\020\235+\244s\203\345\\Z\316-\313\271\300r\356\313\271\263\234k\016\376\213C\346\t\2730|g\353\204\265\326\nk;giD\243:Lt\234i\323\223\365\254?}\354x$\360\001\337J:\201\243\017\330sz\323\265\224\356t'AKo\272\341\216yL\027\360\254'Kg\032~I\351\002\254\256\364\034\307:#\\\200#\035\353s\316X\344\302\223\036\340N\202(\334\352I\017\316\261\360\243#\275\234\273\372\360G\317q\374b\204S3\272\360'=#\013"
+	.string	"nTt"
+	.ascii	"\377\031\243\037\321\213n\243\036\006'\272\213\364\035)\374\t"
+	.ascii	"o\350J\350C\013.\364\033}y2\254\376d\347Fh\n\277[\024\233n\033"
+	.ascii	"\036j\355h\273u\226\363\006N\255\233!\231\304\263Vk\232T\360"
+	.ascii	"\302\333\b\247\340\301\333\340K\032\375\322fRH\377\240<\255z"
+	.ascii	"y\023|t\202T\326\370(\035|\201@\252/\250\272\223\224#\005\336"
+	.ascii	"\201\367\374\003\251\376\247\340\373R>\311FIC\367\006_\340\234"
+	.ascii	"\272\202\273\2651U``\305\020d\305\257`\030\221,HV\374\022\206"
+	.ascii	"\021\311\204f^\\d\305/j\346\305\025F$\243\022\304\246\225\330"
+	.ascii	"\234 6\257\304\246\231\027\327P\214\2572\"\210\"0\260b\b0/b\031"
+	.ascii	"1\214H\324\2428\006\242\314\253\206\230p\277\"\324\230A\034\226"
+	.ascii	"\305\200A\004{1\f#z\315\030~\215\221\r#8m\221\206\213\261aY\261"
+	.ascii	"86$\212\253\006\326#\351\320C\217\255.\370\340\013\244Ugp\267"
+	.ascii	"\362/\316\217_\332\325\326\356@\327\203\234\354\260f\262\036"
+	.ascii	">L\267}\240.\203S\346\220{\232\346\256\b\022\323m;\333@q\243"
+	.ascii	"v\264\225\372n\t\003\302\272\324\273\220\311\004\337\345\262"
+	.ascii	"\037\254'x\027\262O\324wQ\270\017\326\243\336\205<B}W\205\371"
+	.ascii	"h\035\352]\310=\004\337]\341\277\254#x\0272\357\300w\275\234"
+	.ascii	"'\353\007\336\205\2543\360\335/\037\267\276u\003\037;&\013|\327"
+	.ascii	"\205\371\264\256\365\002\037;\3661\302==\200\224\250AP\002\r"
+	.ascii	"BP\215\210\202\202\202$Ic \003\021)j\016\021\340$\206\320H)\224"
+	.ascii	"2\352\2231\017\202\242\253$\352\022T\336{\243\214\356bA\"\223"
+	.ascii	"#\335\343R\236\302\371\236k\370\372\252\246\205\222\266\324A"
+	.ascii	"\276\200\360\263\252\"T\352*\255\361\357\272\276L\255Nx\313\347"
+	.ascii	"a\323\334\222\350\2209e\362\216w\363\334\337\335\002\347\241"
+	.ascii	"*\255\375\303\204{@\253p\231\277\202fc\350\206\250!\315\277C"
+	.ascii	"-M(\277\330\206\275c\"J\254\200\266A\360\340=\202\245,\273\332"
+	.ascii	"\305*\370\303\266\376 q\274\246\033\207\037\326)s``\252\351\203"
+	.ascii	"Y\353z\274\224\254\223\302\203dS`\201O\303Z\246$C\373\313\365"
+	.ascii	"*\252\020a\256\207\325\253U\374\327c!R\321\326\\\362\227\022"
+	.ascii	"\320\306x\t\001\335\030\257\020P\215\361\356\024\r\026\031_'"
+	.ascii	"\214\326\013\241\350\b\240\222\353\302\304\217K\213\377\311H"
+	.ascii	"\277\252M\310\267\271~\213\230\242\333m\234\377\003"
+	.text
+	.section	.gnu.lto_imuCalculateEstimatedAttitude.97.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`4\004E\033"
+	.string	"&r\254F\260ZM:\270f\2264\033*\236\342\307\024,\372\200\352\351P\303\230f\033dCgj\343\027\377\261\353Tk\243\002\271QL\264\256\013\212\237\307tq#\030\037\377\023x<\357%\375\304\236\n\264M\255\021\262\311\2262\311\226"
+	.string	"\215"
+	.string	"\231"
+	.string	"K1\316SX\222\027\035\223\356\026\377\251\306P\025\377]T\325\257\352\231|7>I\206\262\272}\214\231\322\315[\240\t\302\177:\0370\377\311\013\230\377tT\255:\257\250A#\0366\246\253\356\206\361\220\217\277q\211-V\b\312\035\365\340\004\326\r\027\364\233\003>j\350\356\222\nt[l\310\001]~\214\371\322\017D\r\021\255\270c[:\226\225c\303\250!]nA#C\272\22578\233\324\351\356+}g\340\204v\301\t\335\255{\303\325\270\342\\U\233T\325\201\252\\\020h"
+	.string	"\254j\t\236\375m\371\270\0365\016\372\245\002\315\263\t'TB\273F_\033\036\305T\215\251`\327S\032(!\016\322"
+	.string	"\254\177r&\031z\"\nC\266\277\375\323\313\346\277\b;(\335\216\210\266=U^m9\210\352\271\327\353\365\224\201\250\312\325\234'\375\001\276U\234p\365\005\256\272\302U\021\\m\205\253,p5\234\253\340\\\235\337\352\367\255J\271\312ru\345\352\013\234\251HGdT\304R\274\246\321c\323P\037\025#\336\253^\337\344\001WgB\033;%\256\034\375\323\271"
+	.ascii	"a\310\220a\376\313\341/\035\001\016\312\225n\227S\r\337\242\005"
+	.ascii	"dV\223\024\222\022\350n\221\203(\2339\2079\371E\265\341Y8`\231"
+	.ascii	"\374/\262Aw\267\344w\346\307.#N\236T;\334\312N\330\335\017\364"
+	.ascii	"T^\305\203\236\310?\005\021\"\304\374\367\361\235\246\222h\333"
+	.ascii	"c\205\352n\226\201\211\303Wz+jo`J\306a][\256v)w\332\031A\202"
+	.ascii	"\004C\230\312\321\266\267\347uw\310|!:\314?R\303Sc%\304\335\335"
+	.ascii	"\340\243|\371\001.@\364\310b\037~X\364\314f/x^\312\303\340\205"
+	.ascii	",\006\373I\201\""
+	.string	"\266\342\004\214E\254\204\f\3063s\001c@@}Z\364\314`?>>3\230\310\243]6\003\321\0137z\250\261\242qM\266\202e\261\310/>\357V\343Q\330M\373M_\3652c\221\321h<\332\337\306\2439\036\031\221\354o\252c\343 u\361+\311\305\214K$P\215J\020\246\\,\241\305\"\322\245\306%\277\022F\307\335\301\214Jw*\362\362/\024*X\2600\377\265\370W\246\222Bf\361\311\330@\016%\022\216\252\232TS\233\037hv\021\221+\023P\250A,$\235r\246f$\220\t\223\302B\213\001\220\002\221\241+;\020XUD\232\024\253\001ch\223|\250\324I>\235%\\[\263\036\264\260\030J\200\025:\231\252d\277\326\262\034\230\004[W\375A\025\b\"\327\004\376\\\272g\301\277f\336F\367\206\377\212d\251/\302\252~\367\222\255\177ZQ)\346\016\373\302\326S\374\230b@\354\004\361\230\006\263"
+	.ascii	"\264\273\251\367\326r^\343\r%bC<\213+\270\262\370\276\020\255"
+	.ascii	"\3014\025S\331\344\321$,\346\346\211g=\357\035*\354W\021\344"
+	.ascii	"D,\366\033\306\337\376\204\221\277,\tR<\003j\3457\035cf\2446"
+	.ascii	"\372\324"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.98.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\272\001\r\017"
+	.string	"\306[cF\360\262&\035\260\350R\222\333\275\342\263m\301\001\333\277]b\2550\242r\364\3235\177G\276$Z\030\217\326\215\004\025\360n\342g\270\316q\223)<\306\303\342\202\302\222\241\304\242Ml:/\027\374\215\332\354\336{\313\224\002O"
+	.string	"J"
+	.string	"O"
+	.string	"\0170/\215\262{\274\265\332\222\0214\030p`\273\233\301\017G}\312\b\025\345\177RB\274\257\373\024\371d.A2\217\321\300\217\027=\242\230\020^\350S)$\371.D\223\335\275\211k\206\017F\365\223\262\273V\357\323p\177n[\263\215\300V\001\001\372\323\264)T\320{\207_Q\203\306K\005;\273\325)\364`?\356\356\032\316\330g\375R\325\252\352\207"
+	.string	"\220\340\361\335\363\261\033\023\013\262/\tCD\310\366\325~\211\333\240\316\262\340\220\335\0169:\273\255\023\027"
+	.ascii	"]\232\\4/c\032\311\3522\247\301\206\0330XJc\206 nT\314\220#*"
+	.ascii	"\241\275\262\351=G\330\331;65\253\370\233+|\217\035\341)^@\273"
+	.ascii	"\233\300Gq\034\222Os\351R\213\364[\346\245B\002:X)\215]w\267"
+	.ascii	"\203~\231\207\016N\354P)\020O\r.\fF\244m\201\211e\304q'm\304"
+	.ascii	"\032\312\211\264e&\b+\233\204\007\031\313\246B\3124\316%C)qi"
+	.ascii	"\302\210\313L\245\022\227\205Z\373\270p\306 \033\034^)\b3\037"
+	.ascii	"\3432xv\364\346\231\260\223\353\270\\\340\250q\331\326\001\266"
+	.ascii	"\017\274\205]\242\034\273\253\300V9\213$ \320\202\0311\333\006"
+	.ascii	"\002Co\311\300l\340;Y\016Zk\023\r\202;;\030\202|\005Q7\270\373"
+	.ascii	"`\240\206\240\311\251\321\n\304\251\234X\321.K(\313&'3\374\001"
+	.ascii	"\0260\037\302\342\341\335\246l\260\3045EpI\003\177\357\253gd"
+	.ascii	"A\310\355\312z"
+	.text
+	.section	.gnu.lto_shouldInitializeGPSHeading.99.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\325\t"
+	.string	"\006\322C:0\257\322\001\200\364\242 \271\201Q\254\006\221\332\313\2304/\236j\320\221\377\031\005\007]\215\321\3262\365\361_\324\373\2544\276\315\b\013\340\002Q\243\244[\260t\240:\022B\244L)1"
+	.string	"3"
+	.string	"2"
+	.string	"\333\361\361\337\352\350\233\376)\270t./)d\353\373\035\274VZ\0322\365\r\264p\344>\273\256H\224*"
+	.string	"g\316iU\221\0337x\333\013\266\r\354?4\327I{vi\322\215\331\377\346\302l\365\303\316\215\265\"\257\3012'\253\307\2338P%D\365v\311\326\030!\241\344\361\245\007K@v\3038\331\315Y\212\001k\316iQ\337\306>\206$\f.\231\235\356 \252\027n7\346\217\341\327\301$&\2453\366i\027\031\375\017_\220\364\252\203>)<\370\375\354\005$\312\356\025\356l,@\036q$\021\341\371@\210\023\236\006\220\330\021U\210\033\002\207(\036D\342(\024\022\211\232r~a\376\310r5\233~\344\237=\200'\203\251\331\366%\327\315\260\255\001\017"
+	.ascii	"p\b\370T\307\253\303\216\251l\200u\267r\215\004\035\343\303\205"
+	.ascii	"\256\341\n\023\344\374F\033,\217k\216*\035\212Z\005\005"
+	.text
+	.section	.gnu.lto_getCosTiltAngle.100.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\225\007"
+	.string	"\262\31525Po\322\001 \233V\217\340\326\227\346\005:D@\330\255#\256i',\232\025\315J>{63tB\310Y3s\204Q\346\241\225\256Qk\272\364\005\221\275\245L)\346l>\235*z\036\034*\210\206\030Q-t\"\347\232\210\233\002[\022\fW\364X\326\0251\334\376\255\216R5\"\2650\211\273\fK\310G>\004\244\335E\340.B\341\227\016]\001\312g\207>\350N\241\016S\003L\242<\331\\(5\303\376[\035\331O\247\n\200\240l\327Nv\265\323\313\252@\323\206m\314\306\370\035\367\300\354\356q\244\222\001G\313\205\211\313\356F\3153\324\341\373"
+	.string	"u\250\032\307\236\230\377\217+\254h]\266\205\236"
+	.string	"\t\273\353\3146\214[\177`\273$\016"
+	.ascii	"2\241\221\037\030b\202\2219\032\023A\305\201\330\fV%,\327p\341"
+	.ascii	"\020#fl\342\256H\263\341]\367\006"
+	.text
+	.section	.gnu.lto_getQuaternion.101.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`D\001%\013"
+	.string	"\306\223G=0\305*\035"
+	.string	"\321_\341\362\366\346q\245\006\304uI\357Yg\301!\031\261\255$\214mNW\031\263\bk\031\266\306\212AB/WFD\204VY\034(\321\215\242\025\036\020\223J\b\3312\2453"
+	.string	"2"
+	.string	"6"
+	.string	"\337;\227?\360\336}7\360\336y\264\005\274d\255\006\304v\361*\260\273\340\354\370x\035\375\217\234\200T\235\256\003\r\273k%U\030\367\274m\004\333\n\366\003\004\347vw=W\366]\277\247jN\325S\325\252\352c2.1\325S\003vS7\333\322\272\331\007\306\366\325~\310E\306\273L/\330]\301Vv\313\005'\004-\235)\242\303P\264\366\371\022K\031\326\356\376\205$`\322M,\373v\227\301'yI\311\367x\347\n\223\236|\347\233\274w\237\034\215[\313\205\322\233]\236tr\330\001\243\016)\304\331\263!\201>\340(\002\342#\361"
+	.string	"N|: \320#\212\300\215\306!\205\203\b\216\302P\0041\345\236\333\271\362\007 \203\206\232\026\346fK\370\031\013W\233S\026\272JlN\316\306I\035"
+	.ascii	"2\241+h`\\xQ\001\003\315\001C\200\0340\026\005iE\005\002\264"
+	.ascii	"\001\306\005Y\242 XT\300@s`H\024\344\200\261+H\003A\024\265F"
+	.ascii	"(#2U\203\007\020\\lhVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_imuSetAttitudeRPY.102.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\366\001\245\016"
+	.string	"\366\232_E\360\2226\035P\367y>\326\326V-\206o%KtfR=\035\256\377\035\344\ftMcQ2\033\260\306\177S\007|3\376\240\3034\211\230*:\016\213\303b\033\006#\224\2375\363I\302B\204>z\320&R\246\024G"
+	.string	"G"
+	.string	"O"
+	.string	"\330\243\237\366M|ft\224S\316vsP/v\227\201\023`\217\bn\340z\264^\340z\364\310\346\361PfGHd\300\220\002\310\356n\n\342\243\347\310\377\211g\240\211\364\004"
+	.string	"aw\235\240\t\346\326\333&\261\355\300N\230\242<(Za\311\203V\260\303A\345\242$;$\245~\260o\355\356Zc\354\323\374!\017\177\355\250?\313\364\365t\314\264\365\264f:\237>\201"
+	.ascii	":jL\337\360cW\303*\310\252\342\215\b\333\327l\232\036\rB\032"
+	.ascii	"\013\002zCSU\021\235\023N\252\355\271\013\356\200\214mr\233\023"
+	.ascii	"\001;v\367A\213\327t\025<\357z<\350\343\232\2522^p\224re\247"
+	.ascii	"\336\301\230\313n\211$\323\253\210\207S\352eDK\256\214\345Q\234"
+	.ascii	"\205\b\333-\035\364U|\305\005?\304\243U\002+\036\026E\341B]J"
+	.ascii	"\374|>\220e\256D\344u[\b\345\244\373P\330,t\036o\343@*[\311\210"
+	.ascii	"\277\024\023\320\026\372>\320\246\205{k5\306\330\316\214\252"
+	.ascii	"\244-6jD(q\251-\341983\242^\2526!\032u\200\316)\207\245\366\204"
+	.ascii	"\307\270\201\241ji' \360\002\242Qm\0032B[J`\nl\2602\244\f\003"
+	.ascii	"\366 \331\232\266\304\314!~\205\345\2611\216\007\237s\273(\265"
+	.ascii	"\274\005\242\273%c\311\006\366,\215\337\026\030\230\321\032h"
+	.ascii	"\275X,\005h\334\021kc27\263\203\220\367\034sP\324 -/\204A\006"
+	.text
+	.section	.gnu.lto_imuSetAttitudeQuat.103.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\306\001m\016"
+	.string	"\226\031]F\360\2624\035\262\004g%\272\372\267O\207Ff\332\310F\356i\305g\253\310`\324\003/\335\001\301H\221\217\226@D\265\nR\210\344\242\331\353\266\246\361\313\305a\341\3429\272U\004~\034\b\211N\377M\204l+wJ\001D"
+	.string	"G"
+	.string	"K"
+	.string	"\322\276\211\237\350>c\224\261]\035\024\251\335\025\261\201\353\223\300\007T\237\237\013\250>\335\331:\036\2366d\304)\203\r\317\356f\032\342\335e\347\337\346\330\007z\227\026\203\335\265\374@\016\267\336v\001\333 [j\001\323)\234\374\307\251\254\310\177\2267$>\214;-\352\331\241'\025\204\375\317\356\256\025\306~\315\217\235\346\267\036\376\3633\277\002\030mp\321"
+	.ascii	"\276\003j\327\245\307\307\212\023\206\b\333\007\261kz\210\320"
+	.ascii	"\344H\020\352 \270>\375<<\002H\033B\350\300\215\035\"\213z\306"
+	.ascii	"\324\026=\007g\264\324.\271\214\03092S\355\321_\244FU[\273\013"
+	.ascii	"\243\364\264\273\013|\026o!\201\264m\325\247\202\027\034\031"
+	.ascii	"\017&\331cK\376\346+\270k\327\364\317Oq\025'~\314\003\030\256"
+	.ascii	"\362\013\347n\021(\205\244e(\021F\332\004\223\214\202\026\"e"
+	.ascii	"\242\322I\006\n\361V\241\244\224\241l[)\003\t\367\237U\030_8"
+	.ascii	"@\321\244,6D7X1\371!\266\250\347 T\"5\356\374#\225?\3434F\374"
+	.ascii	"\030? !\251>-\274\324\b( \360\202\221\261`\033rB\267\311\300"
+	.ascii	"\bl\2605\204\213\364 [\331\321\360\310\220\310\261\353\210<\026"
+	.ascii	"\254Xo\325\234\234\227`\271\0131\227\305\235\313\301v\323\202"
+	.ascii	"}\340If\021b\242\371\267\260\006\336\023\3031\"\037\003+\245"
+	.ascii	";\030+\205\356:0\026\220\226\027\302!\003"
+	.text
+	.section	.gnu.lto_imuQuaternionMultiplication.104.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\324\006u\036"
+	.string	"Vy\275D\240\330Jc\200\305\007\333\311\003\325\265ouj\326\373\221x\013!,@\347\315"
+	.string	"|\n\332\343\3169\243\242\361\013\2240f\201\025^\207\327\341\261\223\005\236\252Z\0211333\323\021QU-\032\204\221M\222L)\261"
+	.string	"\214"
+	.string	"\257"
+	.string	"sY\246\0201N\205\331\3546\333\315\256a\337\260\341\3548[\207y\255-\3033L\3036\374f\034\316a\271\366t$9\020\247\244"
+	.string	"\334\022\0027\230\b\250\321$\200\233\023"
+	.ascii	"m\032t\263\315\302\264'\302,\236a8\006\320l\032<AL9\004-\rJ\224"
+	.ascii	"9\347\223\305^\361,\022\351^\210\371j&\207\265`\324p\213\223"
+	.ascii	"e\353\026v\001\264\232\230m\346D\003\0027\3470\252K<\213\035"
+	.ascii	"Zgg\221g\234\235\305\002\333'\036\236\230\2764 \035bX\231s\376"
+	.ascii	"n\302@K`m9\277\224\231m\260t)0\347\254,3\003\341\336m\217\332"
+	.ascii	"\"h]\036\004n\226\335\\,\327p\257|\303\2652\234[\3458\227\312"
+	.ascii	":\334)\017\355\237\325l\251\313B]\366\351\262N\227m\272,\323"
+	.ascii	"e\227.\253t\331\244\313\"]\366\350\262F\227-\272,\321e\207.+"
+	.ascii	"t\331\240\313\002]\366\347\262>\227\355\271\254\357\262<\227"
+	.ascii	"\335\271\254\316es.\213s\331\233\313\332\\\266\346\2624\227\235"
+	.ascii	"\271\254\314ec.\333\273,\314e_.\313\273\254\313ew\227\025/\253"
+	.ascii	"\273\354/+/\353\0011s)\314,bn\316\017\001R|\347\271\226\217g"
+	.ascii	"n\347:\317\322}\307\327\2512\006s\216s\254\034\034(\243\360\346"
+	.ascii	"6\277\202\271\370\233\333 \031\2035\247\271U\rM\22018s\231W\315"
+	.ascii	"\004\311dNC\026\3341\nc\376r\252\336a\036#$;\322+\002\303\273"
+	.ascii	"\313_\204\\&\302\353\262\020\227+\273\377S\2276\306\025dr\256"
+	.ascii	"\342u\337]\244\002d\204x,\037#t\217\222\367\377\033\031\203d"
+	.ascii	"_\356!\217\204\242a\346\3217\336\2343\253\336\001$\221\201\227"
+	.ascii	"\302b-\266\263\350c\b1\205\205\332\230\234k\207\033\254\233s"
+	.ascii	"N\371\022\255us\316\331\243\265~a\0030\233\253\345\266\006|\300"
+	.ascii	"\b\234\300\n\274\300\f\334\300`\025\302\276\"x\355\252\272$U"
+	.ascii	"\227,\004\2510\013[?0\n\023\266*H\370]\330r`\341\007\301\353"
+	.ascii	"\353'\345+\027\206\b^?0..\257_o8\255\233G\343!\301\"d\354d\205"
+	.ascii	"\272\024\253?\035\312\351OMw\n6\235f\355\f\t\323\241T}\351LA"
+	.ascii	"\245/%]I\210\364$\244 \243\360\350M\214>\365#a\321\215\210^4"
+	.ascii	"t\242\253\017}f\355l\207\320\225x\310 \223\304Z\312\244P=\350"
+	.ascii	"B\227?\306\340\233\253\233s\354\b\350A\327i\031Wh\375\347@\327"
+	.ascii	"\311\215\301\254\373\374\347\2472\006\261\336s\237_n\024^\275"
+	.ascii	"\347\275\265\263\2671\177\250Q\\f\315I0\241\224\224\024\024\322"
+	.ascii	"\034 \003\t\204\210\332\021 \235\203\314\310\005TY\206\032c\343"
+	.ascii	"\375\211\364\224j\332F +}\241\346\316q\033\350t&l$B\263\006\212"
+	.ascii	">P\026k\344\f\276\022H*\f\0210\265Q*\315\233p\224\330\\fib\347"
+	.ascii	"\024\344\326)\334\303y/\310\036fy\f\344\337\341\032\372~\351"
+	.ascii	"\360@CO@\361\2536\004\235\306\"\223\3676]&h\260\005\016]\032"
+	.ascii	"\"\3411\370\026\226\244\233#\354\252\272e\336\030\275\246\004"
+	.ascii	"\245\005\277\335\247\r\363\016\326g%\243)\354\035\2274|l\323"
+	.ascii	"\006$0\334\310\325\276\320\275\275\225H\226-d\300&b\206\fl\002"
+	.ascii	"f\310\201-\221AH)K\274\024QR\261\336\376\021\355\026\300\254"
+	.ascii	"\302\tjq\370?"
+	.text
+	.section	.gnu.lto_isUpright.105.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"-\n"
+	.string	"\306RC:0\345(\035\336\363x\302\340Iq\227f@\274\025\034\032s\357\\f*u;{\312f\tv\001\274\370\207\365\036\226z\031!r\260$2\310\001\305&0\202\351l\330M\210\224)\0052"
+	.string	"2"
+	.string	"1"
+	.string	"%\347\236a\232\234\257\361@\260^1\252\257{&\020r\314\340\353\360R7\037\n\343\354\356S\236\037\237\227\251\361\354\256S\365\201\334\361\266#l'\330'\b\332\331`\227\352\262\217\255\266l\247c\2465}M\001\353\345\373\313ew\025\nX\231\f\346\304\266\311\336\230\241\301d\356\340ku\200\022\246Z"
+	.string	"\354\202\232\006\231\272\374+\246-\225\247>\370\340W8\337\304\233(\363E\361Y\352\200\310)\303\314\335\355\324\\\274&\t\313\214\227\001^\212\366\006G^uu\030\361\002\376tJ!\220F\262\250"
+	.string	"]Ph\030 \211\220\366\031ih\035\004o\031\023#\215\264m#m\003\356\265\345T\205'\266pU\017\333Q9'EY5\352S\003N\031\306\025"
+	.string	"J\b\230P\307\353C\031\257\302\370::\b\227|e\025\030\274jb\f\346Se\231k8\034\"\221\337"
+	.ascii	"\030\313\302\265\207\025>U\rY\271\243%\307\326\2262"
+	.text
+	.section	.gnu.lto_imuInit.part.0.123.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"}\b"
+	.string	"R\21788Po\322\001 [\374\214'\b\246p\340w\366\006#\233g\035d\342\tX\267\316\243\336\210]&#\n\361\004\221 JPQ\255\025\333\331\342\024\352%>\030\255\330D\356\224\002>\230\336\234[\207B\363\034\266/\203\b=\214:\256\263}\3316A\006\326>\243\216\223\337\204\004W\021!-\270\254\223\332\024\311O\201\275\3206\345\347ySb\266\341\257\325\224\033^`4tCUe{\003\375\024\221\235p\326\310\013\217\027\234\016\217\347\321\306\310\200?Y`\305\005\206CMPU\326\353\327j\312V\004\231\201\221\335\217\032\232%\211,'\366W$\033\303\036\217b\233\004\342\222\035s\226\311\276\325\342\321\232\331]\371\250%/]\341U\362\277:\300\te\272\006\240B\016\t~m\030v\327\034\221;\336\266\202m\220m\225\021"
+	.string	"O\023\030\027\314V\224\3003<@\024\fs\205\2730aqF,\352\234N\013m\246\3544"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.part.0.125.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"m\013"
+	.string	"6\324JB \3078\035g\020\272"
+	.string	"\021O\026\002'\231\247;|\302$|\002d\347X\215\017\202\203J8\021\254c\310\364\207\013\324\336\030\032\252\376\021\340\200\030\003\3054\001\310\r_$\301\364\0316"
+	.string	"1\332n{\247\0247"
+	.string	"3"
+	.string	"9"
+	.string	"$\224G\373\301K\230\325"
+	.string	"`\231\274 \354n\367J_>\236Nm\364!N32U:\275\353\027.'\030\231B\371d\270\226`\261\273\336R\356z\333\025\266)\354k\004\266o\337E\2629\356\325\366\234/Io\215\264rS(\317i_\300\007\214o\215\254\260\333r@\301n)\361\352\210\355\365\341\016\231W\355\r\231W\373\001l\007\037 G\204m\236\300a\342\266kz\275\200\210\317z5H\234'_}qD4O\372\006\0320\210\225\320\322\244+SM[\252\262_\376\317L\225\t\331\356\311L\266,uAL\240\f\016\370a\204<\2340\024\275\005{\033\021\374\272\220G\347\003\351\350<\337\006\330y!\250\333h\374\t\341\204]\350\363\t;\356T\345\315\301J\314DI(]\331\t\020\270#\362P\334<\265\003\032"
+	.string	"m\023\200\316\031x\340\tC\024\f\006\206(B\017`\330fs\254\026\326J\274\241\301\210\314U\200(\030\346\272F\254\0319C\3539\345\314\316"
+	.ascii	"6\223w\232\005\256=\230\302i^zm\031\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`<\004]\021"
+	.string	"\226\232bG\300XM\032\003\210t\216\204\353\032p\037\037\353\034\244[\223\016\024\226E"
+	.string	"\304\204i\022\206Ap\233H\\\267\017T\364Z\362\223nQ`:#H\234\304Cp!\266\211\312\353\316\244\276w\t\016\024m\025ho\"\367N\001I"
+	.string	"R"
+	.string	"O"
+	.string	"\037E\003\373\0268\273.V`\327\002\t\354@\340B9#\341\\\305\265\224U\353(7/i\255V\253\331\354B`\3157h\366 \220\265\215\3249\242\376\213\315\231q\304_\316\256\233.~\037\211\305\333\346\234s\300\316\003\376Q'=/\230O\220\017\220\211\237\024\255_l\305\205\225\242\205=I\205\035\t\205\375\b\317nd\302^\004\356\3544(a'\022\341&\020\366!p\241\007\307p\260\214\330`\030\f\366\037p\3013\024\354>\240\3164b\202kD\004\353\210?\354\346\213\003{\017\030 \357\321H\345y\312\222z\242{S\030\031L\354t2\32165\315f6-\261+!\261?\031\261;\021\261/\t\261c\001\261[\371\260_\361\260C\351\2603\341\260Oys\316Wm\330\251<\r\317b\206\223\342\253"
+	.string	"\202\005\241\370\301\360\216\370=\260\263\004\250\224\255Tv\250\225\276\243W+\2254\225K\265\222Q\021\021\027\303\212\3217\364\036Q\226\245\244\227\224\276rR\247T\306\305\351\216\344p8\225i\275\350\3114s\221\263\033\224>Y\rJ_o\263A)7\364"
+	.string	"\2640*\332\244\276\331S\226\324\027\013S\2501\024\007\272\030-I*\231\326\320\002\241\252\316\001\021\240\f\350\020R\242\221P\202\261\331\003\bw\"\345\320\307\337\032\003\343\re\245Yw>\266\016x'+\322\205\235U-\240\233\217\350/\355\275\312\024:N\026\021\230\244\037\310\247>\357\t\371\254\371o\345?\266?\tU^m\222fP.I\326l\255\240M\327\2045\223X\030\037\326\247tM\372\335\264\234\351\333\353\234\360\030\327\362z\323\021d\271"
+	.string	"\215\321\034\005\312!\033\013dL\314\273-.\345\342\363\217\3517\364\216\304\303"
+	.ascii	"\303UV\025"
+	.text
+	.section	.gnu.lto_.refs.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"]\007"
+	.string	"\246\0244'`I\233\3060\f\3030\f\303\240 \b\202P\330\025\25534J\177\306h\314\372\355\247\211\210\241\277\333Mh\023)S\n%"
+	.string	")"
+	.string	"*"
+	.string	"\233\340\026\301m\302m\343\226q\253\260M\330\036l\037\333\306\326`[\260U\353b\233\254\210\355\261\236\355+\244;\b\253\234&k\355\364\263\260\2700\023Z\212X\372\250m\2242\213\",\272\026U\024=\031Q\372 }l\203[\006\267\013n\025\\{\221\001\016\323b\017\305\036\264\006\355\320\t\304\007s\001X\365,\342hzv\307&y\2149c\006\223\261\026Z\353\2346\247\314\n\026\260\003\346\230\201\363\222\t\2730f\2226\275\367\332\004\022\027c\252\365\261n\244\264\276\003\016\001{jW2L%\332$Z$\n\b"
+	.ascii	"F+x\316\241\316\367\270c\241\305\n\323\330\210S0awG\246\320"
+	.text
+	.section	.gnu.lto_.decls.2b73cec9add7440e,"e",@progbits
+	.string	"(\265/\375`~@\365#\001*\004JoV JY9\351\"G\324\237\020\371\2510c\274a1r\3140\260\377\344\334\256\037\016\017\362\351A3\266\034\346\303\3379\016\034a\032\271\257\3557D\276\204V\273\031\256\353\272\324\363\314\242I3-\302\2136\3154|\177\362\315\327\235~\235\3374H\0171\266%do\271S\016\006\355\006\020\007v\006\256H9\270^\225MQ\312`\332\321S\242:H\215\356\205\016\262\026#\262|\322\245\3577\200\362\264\031M2\304\304:\312\323\354\030\022"
+	.string	"/\320\314H\366XU\266X\207\375&s\210\020G\330\216\23180\316\373n\303\177\203y\351!sFN\337\327=P\272\211n\353\253\273\252\262\275ZJ\231WG\351\246\352\246\005\302W\236\243\020v\253\213\316\354\274o-\370\215\005\277\313\360\337O\232"
+	.string	"]\331\212C\353;\244\227\f1\025\345\254\344\315\322I3\251\312n\322\244\271\032\206\352\246u\273\332:\204\270W\346\262\302\234\rC\037\251\273).cZ\372\276\223\370u\017\2226[\255\244\267:IU\366\222\277\263Z\310\233H\037\0312s\276r\263\265\244_\350#\325M+\337'\035V\332\346r\316!\216B\204 \206\r\311\203\357\333\013\277\235\340.\322ZU\331\241\215\314\321j\222\352\373N\202A\220s\355p\326\272\272\332\341|\033\301o,\254A\345p\236\215u\001v\332\202\345\253\203t\025\236(mK\372vUC\265\016;\206\214"
+	.ascii	"\0328\313v\272S\301`\304\371\373G\373h \335\243\255\372\252*"
+	.ascii	"\273\252w\274\251\232\207\211\023]U\357T=6\271\265\253\222\225"
+	.ascii	"g\231s\222J\255\353\246!\246\242\354\324\204g+\347\344\373\351"
+	.ascii	"/\361\256\352\027\335d\223j\030\306\224\271e\316I\241,=naC\267"
+	.ascii	"&+\207\363\250\032\235od\216j\004\313\025\266\276o&\374\277\247"
+	.ascii	"Z\252oTe\343h\0335\336\276\220\0355\344T\224\235\262\332l\211"
+	.ascii	"5\216\216\321QR\273,66\272\202\266|\315\251\302\367u\r~\005\203"
+	.ascii	"_\331p\313\350\031Uy\266\246q\037\247d.\3139\023U#^\216F\372"
+	.ascii	"\276f\301-r\316\271\236\355\334\325\325\325\325\325\263\235\257"
+	.ascii	"V\360\253\022\277\202\341W.\374e\345p\276\n\301\235\373X\225"
+	.ascii	"\0274\323\353\232\272\347&S2'sN\0225\022=V\246\364}\365\201_"
+	.ascii	"/8m]]\275\340|\325\201\213*\207\263\342\251y\252r\202Jw\023'"
+	.ascii	"n\217dDB{\244\354\311\323\367"
+	.string	"\265\006~\235\340\254uu\202\363\025\006\376\353\334\004DI\035QB\354\200\270\243\246)J\035:;\257.Yf}+\235\256qU\356\225N\235s\023'\036\344\224\277rNV:7g\246Z)\030\252\225\002\223-\t\323\224\363\276\036\361_\345,\221|\t\002\325\267\3069j\034P\324\326\364}\020\377\025\016\234\220V]\222\f\356\257lj\233\372\306G\215\315\224\223\276\177}{}\363W7\025\354i}\225\263S\3169\202.#\307j\256oP5:\373\252r8-\250Fg]S\342\365\315\350DR%\263Y\316\231\310\252uyA\327\267\325\264\005]\021\341\222\321\267RY3\373\262\245K\215\n\227%\025-\r\315\213\025\333\013\1775S\311\3244uLES\317\3242ULu\2531Tem\373+\230\032\306\251\242\251a\251T\264\200}\265\325.O\253nfuK\013\230e\3169\304Q\210\020!\252\020:6I"
+	.string	"p;Y9\234 \252\321y\026\360\225\360Q\374\025\360y\370\033\300\307"
+	.string	"~\005\360U\340\243\200?T\243\363\257Y\376\352U\277\352\231\205\242q\225\315rNfh5qE\204\364\375_\315*\226j\245^\251\312z\366W*\265\312o2\347\263\2571 \033L\361!F\366\264!\237\234\277T\251\345\234_\301\376\022\177\r\253b\365\254&\2376\344\224\314/\374\030\231\002\006e.\347|\024\"D\210\020\246\224\026\255\027~n\315\225\303YT\215\316\327\262k \313'\376\203\217\361O\374\213\337\370C\345p\336jt\336\255r8\237\254\034N\\\215>\260\025T@\350\277I\376~\363\367\233\265\340\357\024\307\377\035\222\302\3438T\221"
+	.string	"\312\314p\302\t\217\3407\315\277\361T\f\352X\002\234p\243\377\332i\243\233\237\360\363\277d\376\313\221p\377+\365W=\375\201\255\340\257t\177W`)x\\\253\200\344o\016\354\007\022\035\201*\200\277v\370k\377U\202\277Q\330\001\374\247+\3627\004\254"
+	.string	"\376^\373\033\333\t~\353\341\350\036\030`/\342\277,\376\307]n\214\233\2313\264\237`%8@\237`\341\257\031\374\225\304\337Xl\207\277bP9\370\353\210\277%\260G\277\215\300\002\340\3573\226\203\335\360\377\350\277\006N\250\372\033\333\f\177\257\250(\356\363_\2455+\231\323\026\375m"
+	.ascii	"K\364?\356rM\201"
+	.string	"\254\nB\003\376\376`\207\376\232\200\f\374\204\033\340\357\013\\\256\377n\376\2779\\\225+f_V+t\t\376;\201\277*\340\257\t\370\273\207\211\200\277\301\376\036\373;\371w\330\337]\177\177\375-\366\367\224\2773`\361\337Z\177K\371;\212\335\375/\372\315\030\1775QK\374\267\377\345\361\337\355\377\230\3771\234\371o\346\177\333\3770\377\313\374Gs\240\377\002\375\257\362\377\312\177\263\377Vn\376W\305o\317\277\361\374m\347o\270\277\323\374\215\346\357\266\277\271\374\255\345o\264\277\317\3766\373\233\312\337e\177\373\370[\306\337P\1773\375\375\201\277\215\177\007\377&\341o\026\376V\341\357\337\337+\376F\372{\205\277;\3607\005\376\346\300\337\033\370;\003\177_\340\357\n\374\235\342\357\023\376\226\300\337\021\370[\204\277A\370\233\001\177+\340o\004\374}\342o\021\177\037\340\357\013\376\256\340\177\n\177\r\372\253\003\376\376\360\267"
+	.string	"\376\236\340o\t\376\307\375\177\363?\316\337\377\273\303\337E\177\013\375=\3647\376\373\374\333\374\333\376\365"
+	.ascii	"\377O\370\273\376u\317_Q\374W\361\327\020\376\272\200\277\236"
+	.ascii	"\370+\005\177\375\360\337\316\377:\377\345\376/\377\303\375O"
+	.ascii	"\363\377\354\277\t\377-\360_\314\377\b\352\352\352\352\376\335"
+	.ascii	"\206\377\347\314O\242E\3107\246\035U\255\311\255F\323\031\323"
+	.ascii	"UM\346\234;D5e]e'\267c\315nPM\256rn\322\244\224\243r\316\231"
+	.ascii	"\203c\322-\033\251nG!?2\215\0279\007 's\216\312\371X\263[\316"
+	.ascii	"\371\230s\336!\177$s\356Q\004\265\025\025\2253\325QT\376q\\{"
+	.ascii	"\221s\233\265Q\223\202*\313\272*\261F\245l+\303H\036+\024\215"
+	.ascii	"\253\274\225\337\260\220\270\3548\226i\344\234k\034\336\222\272"
+	.ascii	"1\247\357\305\n\212S\244\206W\337\007u\341{e\331\344\001\222"
+	.ascii	"\243\357\203\212$\201\324\254\254\340\350{\253\2160\032\323\224"
+	.ascii	",}\037\344\003_\037?iX\250\244\372>\350\251\307\345qf\351\"d"
+	.ascii	"H\337K\225,\3139w\250p\252\362\260\365=\220\034\374\005\313\335"
+	.ascii	"qsT\345\325\221\274:,\224\213c\350\230\314Rg\f#AW\254`\3008\357"
+	.ascii	"\177o\374\342h/\035\310\271\fM\353\310\262\357\235*\361{c\001"
+	.ascii	"H\204t\365\265\325\350\374/\022i\333HH\346\343\220\215 h\360"
+	.ascii	"\177g\374\332\370/\215\033uk\020\261\t\223\346\3307\371\225s"
+	.ascii	"&\362Y\313\343$G\337\352V9\234\036\252\321ye\224\370\235\261"
+	.ascii	";\022\004\fI_\t\252\321\t\345\243&\256\312\254\357\201\302\340"
+	.ascii	"\377\302\260my"
+	.ascii	"\300\232\372\276J\251\367\251*\357S]\372@\345|\003\003/\251\260"
+	.ascii	"\251\271\214D\2128P\030\210\333\224$\nb\322\201f\246\357\201"
+	.ascii	"\234\340\3772\335c\320\2334.O7_\373\345\244\310Z\337\003\035"
+	.ascii	"\301\277\255\263tBO\320\310\210\352*\226\256\315\352\233!\247"
+	.ascii	"d>\236pf\272\254\346\224tM\345L\"\247\313jN\217\335c\363X<Ui"
+	.ascii	"\351\254\235\3339{\247\212\245k+p[9'-]\237\331:\307]\226\261"
+	.ascii	".\253\271\234\263\317\220\2633X?\027(W\016g\335\252F\347\201"
+	.ascii	"\216X\256\351\216\222\271\276\377\231\303\235\345\315\226\261"
+	.ascii	"inX\260%H\247\265\230v\263cH\214\345)j\271\3046\231R\267\225"
+	.ascii	"\326f:N\026\210\265\247-\355\005\304\226\343\023.sh\366\315:"
+	.ascii	"\311Oc\030\210\231y\302e.L\245C\0013O\270D\371\362w\332[\203"
+	.ascii	"\251t\252\033U>\312\261`M\316\023.\033\374M\347\366\255\345\254"
+	.ascii	"\020\017^ #0$\3062\347\374f\237\3306\017MP9Oq 6\226\246\326Z"
+	.ascii	"\252\033Uf:r\260E\352\t\227\271\226c\337:N)\303\322\261m\354"
+	.ascii	"\322\302Y86\316\312\261j,\033\373\306\256\261sl\034\353\246*"
+	.ascii	"\355\233-\362\276\322X\354\2207K\304*\361\340\005\322\247\206"
+	.ascii	"\022j\271\374[\216}\35399Kq\260\306\365\204\313\334\320\224\037"
+	.ascii	"jk\004pc\250M\236\304\232\364\375O\330\231\252\264h\254\333\257"
+	.ascii	"Ec\315T\270\352f\226\263\024\006R\244\230\350\250>\3044\225\271"
+	.ascii	"\367?A\360\177\242\360}\366`K\246\003\221\220\"Li\372\336\007"
+	.ascii	"\016\206b\273lrk\204\246\032`\354\030\033\246*\255\030'+\306"
+	.ascii	"z\3314\017^ '\320\024\265\024c\277|\214\207&\250\314\024D\003"
+	.ascii	"\256;H\352\\*Z`\200\340{\037&\370-\244J\207\352\246\005\002\f"
+	.ascii	"X\304\316\244,\323\354\227\245\342\241\tJ\002_\316\226V\3166"
+	.ascii	"\344\2233\226\031\226\256\345\025\020\325\315L\004\265\257e\316"
+	.ascii	"I\233f\263\234MI\224\245M\263f\035\206\230\222\031y\0321r\004"
+	.ascii	"9\307f\275X5\313\305j\261[l\027\273V\2256\315\242\2050\251(\347"
+	.ascii	"\362h\270\307p\360\361\032|\\\006\037{\301\307h\370\270\n>\026"
+	.ascii	"\303\307N\224g\3078gl\364=\026Bf\247T\245-\263a`6)\004n\253\314"
+	.ascii	"\216\331\244\006\270\267\272&s\026\315\r\035\345y\277C\203\177"
+	.ascii	"\233\024\003\332\003V\265G\314\206\r\205-\241!\244\357wX\360"
+	.ascii	"we\370;0\374\335\023\374[)\267]\355\245\003\246\225\030b`\364"
+	.ascii	"\265QJ\334Jy\322\2421\325\367\202jt~\267\004\177w\004\177\007"
+	.ascii	"\004\006\313\204\013'I\363\203K\337\357d\300\300\205\306,\277"
+	.ascii	"m\335r\035\316\331\346\330\005\317\256\311"
+	.string	"&AB\247cmI\337\237p\360\253\322\276`\221di\022\343\354\310-\222\337\304\211J'({\b\3023\246\rG\337\313Y#\377}\206\324\204\245m\351\373[#ZCQg2\226\226-\342S\347M\217W\337\237i\360\3176\254A5:m\226\033\260\035T\372\376\324re\203T\245\305j<G\026\253\353\364\0356K\254\316c\255\252\033UQv\202\243gY\251t\3313\347\274\326\206\365\361f\253\312\376\260@\252\322Z\335Z5\235}\032:f\310\231\b\335\226\225}a\243\206\234\222y\352\214\223\343\374\230\013\001DcH\325\021\337\377\226\207\355Q\225\326\207\245:\332\340\206\335Q\335\250\222yj\b\313U\234\037s>,\322Nyh\202\"\201\213\233%\336r\204\213\221\363\376\244\202\177\273CG\2144&k\372\332\034?9\250\334\270\364\375\331\205-\216\327\032\\Ob\372\376\344\302\257\312\303Y\251\303\271H\306\350"
+	.string	"\353\373\363\005\374s\b\376\031\004\177\003\033eaX\031\325\315L\20468KK\303\326\250J\033egD\265\236\252\247\272Q- L\234\345\320\022&^`\347\375\231\003_(NU\310\364\2651,T\026\022\202S\305\326\244\357\317\031\370\247\023\376\231\361\177\333d\235\252\322>Y\246\243d\316gO\275\307\036=4A\225`\205g\371e\342\204}j=U\317\3201\231m"
+	.ascii	"-\331\212\363c.\347\344Q\210\020;!Z\304\216\234\367&\033\376"
+	.ascii	"\355\321f\313\003*\013]\322\364B\025C\022e\3275\236d>\002j##"
+	.ascii	"\303\351{\023\r\337\244\202o\202\341\233M\360M-;=GT\005+,J\337"
+	.ascii	"\233VvL\035\370\346\024~\262\032\2357g\340\233N\370j\325\350"
+	.ascii	"\274Z\345p\3029\"\272QU\005\252\357o\034\374\r\316t\032;\206"
+	.ascii	"\304W\212(Y\346\234"
+	.string	"t\323pU\331oZ\315\233^\323m\252\233Yf\272a\201\334RM\2179\241+syt\234\367\255\331\020\315H\002\003\t\327\333%\202\177\245\320t\f=\245<r\237\320\330=\370\326M\227\251h\352\340\211\321\367v\f\3561M\246*\273\355\227\354*\227\345\234\024\262L:\310\244\365}\005q\022\2018o\267\340[+\370\366\013\377\255r8\233\255\273\274\2754\227\334^8\270\312\231\251\275\020\321\345\314DT+\005\265Rp\273\262\226\\9\357-\024|{\004\267\226W=\035\310\021d\b\203\004\322\327D\211\367\332\031\205K\220;}o\263\360\335\252\321\371\271\312\341\374\022\b\366IV\016g\245\252F\347\355\024~}\277\241\013\376\206\2654ijl\001e1\223\025\326\367\033\224nn&\032\017kkLt\f-\tRc\216y\346&\232\264 o<\212\3645\315l\210\322\345\346\230.f[\225\253\311Luu\234S"
+	.string	" a\316l\315e\250\037 \222\210"
+	.string	"\031C\346f\333\230\263N\251\206e\206\271)\346\367\331\255I#\206\254\3577dl~\271\t\346\3671}\334p\223\007\377\246\227\337'HkL\333\234\2767\222\3037\202\303\205\3135+\201\025\246Ft\344+n\214\230\232\232\251\245\222e\033\033\304\314P\201\260]1\324"
+	.ascii	"1\327nj\021\222S\272\205\305\370\357s\266\331\240\303\003\005"
+	.ascii	"\r\315<\253E\311\24644\266r\246\002\201\217c8\232\364\275\321"
+	.ascii	"\013\370\312\025\363\254\222e\033\024\340b\242#J\316T 0@\246"
+	.ascii	"d\016\226\233gO\253U\332\230\331b\024\004\377\246\231iV\337\034"
+	.ascii	"%\363\321\003\024)!\031?\346z\364\275\221\016\374\233TL*\327"
+	.ascii	"\252\213\262S\226\230ZFR\211h\036Z^\354\350{#\030U7\211\230U"
+	.ascii	"fY\211\246\314\244\344\203\227\031s\214\211\022\030}\247$wLk"
+	.ascii	"\324\200\351{\rx\260Y\3044\022\366\206\212y\304M\022sIu\323\002"
+	.ascii	"\341I\231\326cjyh\202\"\341\253\3152\347\344\227\311eJA\233["
+	.ascii	"\3561\277\314\027\272\336\302L2s\314\0243\275L03Y\225\346\227"
+	.ascii	"\271e~\231H\330,sN\022\321\361\252\262\243\350\0269\234\207&"
+	.ascii	"(\022\302\340\230Q\314\256\2524\245\374h\003S\212\t\203\t\005"
+	.ascii	"(\313\034(?:\204\020\232\023\303\233\217\363\376&\224\233O\316"
+	.ascii	"\222E\342\372\232NvT;\304<\365\275\2060\3707\231T\245\331\004"
+	.ascii	"\313EY\313\323\367r>@^\216dy\301\327\260\206\257\241\314T\202"
+	.ascii	"\323,\253\332\372^C\030\276\206.|\rL\3605(\301\327`\004\377\246"
+	.ascii	"\021S\313,\013C\247M\253\352!C\243\251\3575\f\301f\2269\204\250"
+	.ascii	"K\215\b\226\2767\205\374\3679\341H\031,}/V\213Y\262\025\325\367"
+	.ascii	"f\220\2417%V\306\372\336\274\302RG\207G_\023\b"
+	.string	"~\241a\307\005?Uh@|X\335\004\362\233Q\375\305\205:=v\372V7%nZ\001\265uY\212\365\275\006'\374*\245\2324n\3660i\230>@P1Ma"
+	.string	"\366C\204\006^h\352J\226\301 \3031\244\257\251\303\2442y\374>>[h\240\371\321\367\031\350\360\315\035\377}~\264\316$q\322\267\353\331N\023\307\315\034\277\317\356\013\351d\245\3573\330\3017\247\314\033\277\217\3253fK\214\276\317\020\007\337\224\372\357\023\0027A\244\3645\221\370E\006\267\013|\332\220\301!\251q\023\371\2336\372\251\275t\200\206\017\2528}\207\252\321iF\225\270Y\243\227\230\211\021\323W\250\032\235\317@\305\224a\312\310br,\330\234\265\264\276\317\360e:\231N&\324\351e&l*JP\033\245\325\031\214\233PBq\226V\346\372\232/\202\352\226l\275\3655\237n\234\234!e\322\\\351\321c2i\375\240\031\343\3622\2177\231\254\03049\271\276f\306Q\330`\351\351{\353\366d\210\262c\347\346Y"
+	.string	"\223\250\255\2555\271\344\305\363\233\007N\327\275Y\373\352{\357\230cC\326\316\364\275sDhcoH\372^\356i\377}\252\0234)W\372\276(\317\362\313+\3279\347\274\265\373\302E\267LBc\306\034\235_\271[\347)\352\2058!\272+\035n\342\346\004yrb\346\346\034vGJ\337+\247\b\016\016\356\302\361\311\331\316Y%\307\307\353,\316\r8O\243B\202\354\373\"2\270*\257\233\233uD\226\217\273\264 ]V\366m\314\315N\337\027\201\301\277k\352e\303\346\306\250HLe\212\327rg\3266\205\206_o\214\363\"\352U\243\346l$< \353\353$2\244\016K\337\027\221\341\377\306P\2257\206\236b\241r\226\262"
+	.string	"\312\021ky\361\322\367E^\370\314\231[\004\3472R>G\272\276\310\364}Q\026~\235S\257\233[\245S\223\331\306\006(k_D\004=q\363U\247\357\213\246\332\332\236V\221"
+	.ascii	"\2001ElY4\003\377w\214\362\216\271A,Tf\312\302@\212\024\021\036"
+	.ascii	"\374\3370Uy\303\\\253\237\\\241\316d\265-3\222J\304\022\023\023"
+	.ascii	"\\\337\023\261\301_\276\334\"8c\340h\226QK\252\365=\321\030."
+	.ascii	"\267\013\227\353\305\306v\275\316\034caSQ2\025\025\b\"5KeX\337"
+	.ascii	"\023]\301'\342R\273Z\324n\2213\347\232\274\262\201\314TH\020"
+	.ascii	"k_\273E\3601\347c2\3338\022s\254>`\b\023\245\357\211\214\340"
+	.ascii	"\023\365@C\273E\270\314\020=\235\275*\357\331\375\001\"\347\251"
+	.ascii	"\005x\215Q\211\370\211;[\222\373~\210\216\312o\342\304\265r\257"
+	.ascii	"T: 4\345l\245u\372\030\033ZV\251r\315jF\312\235>\202\204M\315"
+	.ascii	"e**\020\247\225\027H\360\3645\363\341b\222E\243\357\207\330\360"
+	.ascii	"\207\252\340\377\222U\345%\273e\227,\037\207\224dlt\315\345L"
+	.ascii	"%\302'\206\232$Y\372\336)7\f\307\213\260\276\037r\202?\244\004"
+	.ascii	"\3777\231\254z\216\256\216s>\210I\315\371\232\313\371\213\b3"
+	.ascii	"m\312\016\256\276\037j\302\377\005\373\272a\327\t\037\221\030"
+	.ascii	"\313\022#K8|!6)R\256W\234\234\256_\257\241/\266\345\235\276\227"
+	.ascii	"\273N\377}xlG\346\372^\b\n~\245S/\024\345\205R\351\034\345c\334"
+	.ascii	"\007)kI\021\027\n\222$\311ur\002\214\324m\362\353\344'\206'D"
+	.ascii	"\366\364\275[\227\311\177\237~#F\315\223\276\377e\002\303\017"
+	.ascii	"\226:s[j\034\2424hp\304\364\275\\w\211-\313A\246\252\357U\342"
+	.ascii	"3V\206\207W\037\331\242\363\302\261\357\205\236\360\177\221("
+	.ascii	"/\222\n'\345\201\024\256,\342B\031\033yU^#\367\370\203\364\271"
+	.ascii	"\202\346\3132h\017\376\025r\207\374\022\371%r\213\324\234s\246"
+	.ascii	"\312G9\034\254q\205M\315e*$\210[\304<\323D\311\225\276\017J\203"
+	.ascii	"\377\327\367\177f&d\316y\312LfdS\320\371\327W\263V\020\277P\265"
+	.ascii	"\265\202\3777\347\004p \347\246,[9\347J\0073Ic\362\361!\233n"
+	.ascii	"9;a\035A\300\222r\302\332\001U\206%\225\001\252\f+\037\235\224"
+	.ascii	"\0343 3\326\021\252,\347\fNNG\021\256\244\240\312\230"
+	.string	"r\006\250\262,\225\237\316H\325\234\304:f\247\253\234!;e\246\\v%\365\001\312\tK\n\252\214I*\003T\031\226T.\303\312E\331\211\t\031\303)#3\3442,9\271\354J\252\b\252\354J\n\252\fKJ\245\021CM\327\215\263\255\"T\365\b\345\224kD\375`B\026\271A%\257\362[\316\325\354EFf\267\234+\310\371\307UiO\b\\\341!\375\005\177,\370\204\300\240q\303\225FD\240\001\b4\006\203\302\340\256\230\032\207\274\340/\005\376\214+\360xC\305\3248\274= \023\301^\332\013\272\322\210\"\020\330\363)\245\275%\022,\204D\245T\030\334\255\350\241\300\233\026\203B\237\271\"\r\376\210\300\363J#&p\241\224\002{(\t\305\022\212\305\336pI\350+\332\025\205\276\237\026B\342p\330\343\005\177\305\0374\251GD[\b\301\347\353\375\270\030\nQ\f\245W\032\2214$\22144\362\005\215#"
+	.string	"\005W\264Y\344%\r\203R^0ih\006\223\206V)M\n\242\300\023u\341W\274.\206B\337%\246C{!\027\304\264\370KBS\3604 \241;$\264h\274\305\335{i\017)E\213(\221\2274\0341\304C\323\036p\270\204\246\2204\354\220*%\375\210C\025\212?\237\037p\370K\201F\023\214\024\320\200\001\024R\244\250\n\343\322/C\212&\t\245\300_\nE!\212\024M\"\362\371zv\311\250\002]\372\245\340\363\365~\322\240Q\210\002h\311\250\302\347\353\235KF\025)ZDS\030\227~\021\024U\b\366|E>_\217\347[q\026-\241i\321\205\n^\021J4\006e8\332i0\"%\366\206#\322_\260\004\343\322oh\003\006J\n\376\220z(\t*P\200@\tH@\243P\251\030"
+	.string	"\rF \241.\374\200\275_\372\013\376\204\322\363J#|<\"\t\337"
+	.string	"\212I=\340\bh\332K\213?\034J\214@\227~)\250`B\tE\243\360\327\002J\034F\260\364K\213\017@\323\036\320\350\003\366&@B\225\212?\340\n\275\264\370\200b\t\030@!\305\222\2208\002\005$H{&\020\257\007j\n45\016\227\216\356\373\021\321 \232\204\317A\007\031t\340A\213\335=\370@\203\01748\357\301\007%J|\320A\t\374\016J\3304MyE\024\230\024\f\201\210\002\215\017@\221\214\351/M{\034R\0361M{F,\370\204\0220.\375\204R\236\211\r\356C\301\003\235\362\212*\240K\277\024\377\\i\004\021\005\242\025\024y>_\317L\2574\242"
+	.string	"\351\225F\024\225\322\336\022\211\240piI\350\013\300R-\362x\303\025F-~\304\264gB*$\016\245D\274\335\225F\244>#1-\232(\362Z\240\251q)\003\013>!\220\307;\323\240Q\350\343\361vD4\310B\310\343\355\212D\264h\f\362x\030)\370c\201\307;\213\301\337\260\310\343\355\200(\217\347\223\362\322\342\017Xt\245\021Et\350\"\315"
+	.ascii	"\t%\366\224\212\031\220(\246\277\025H\030\203I\031\2640\006\177"
+	.ascii	"\300\f8\350\200\327\201\007-H\240HF\240/\370#A,\032I$ m\201\006"
+	.ascii	"\201\275 \021M\203?\036R\017%*\245C\036/\202\026P\342\220\307"
+	.ascii	";\323\342\017\310"
+	.string	"\343\235\275\264\207\304\343\235\250\013\277\"\217w\262\340\023\002\257\017%\362~\322_\260\204\340\b\351/\370;\211)\n\276\240q\004\244\036\232\302\347\013aC\221\327\002*\202\317\327\303\301\021\220z(\361L\213\274\337P\305\nT\004t\350\"\005^\t(\250"
+	.string	"B}\301^Z\f\376p\312\233@\t7\370C!X\364\235\277a\321\026y(L\224"
+	.ascii	"\204\302D\t>\247\317\304\317"
+	.string	"^iD\321\270B\207\"\317\004\244\"\"\232\026{Kg\261\210\022\221\220z;\264\205\036P\205q\270\204\215\274\026P\244\242q\005\\\344\241\276_\013\250\bE\343\n@(\017\035\272H\241h\\\301\007\035\272H\213\306\025vE\343\n\026\002%x>_\357d\321K\201B\204\020\316\364J#\214\303%\236\220\350\"\311\347\353\221(\022\321\026~D\244\003\240\274\024\032\234\320\240\003\343p\311\250\210\022\177\212\274\r\250\n\343p\t\350L\201\306\"\232\"(\374\245>4EE0\016\2274\240\274`\322\017\330\343\021\205\305 Z\034\n&\375\200!\370|=\354\002\251\207\246\350\245=$\037bq\005O)\351\247\304\363\371zA\304\236\222\357\242HB\024A\341\257\370k\001%\006\021Q \360\267\342l\001E\262.\220\200\246\275\024(p\270\324+\006\241\020!\004\237\257w\242\276\340\004\322b\017\225@\032\002\022\232\366\220\206*"
+	.string	"Q\237/\204\342\257\003\272\364K\203\306\024\306\245\237\206\"/\351\267\"(Da\\\372\001\r\177,\360\226|H'\213\036\321\002\201B\342U\362\245\277\241\271c\321sa\213\250\021\330k\341,\362ziO\204\240\360\227\032\201B\025\305aR\206\364J#\212\303$\022\302\337\206%\024)\260g\026yA\341/\355\371\204\022(\016\223\204\322\036\320\246<\023\033\244\301\337.(\004Z% \320\"m\200\204\242\303\342\016\tE\207*\200\320\"\321(D\201\0244\n\211IA)\257\203\022i\360g\304C!\222\322My\036\244\301\237q\227\366T,\031\203'P(t"
+	.ascii	"\317,\246>#\222\220\210BP\370\013\022\321\264g\364\200\006\026"
+	.ascii	",\272\005\213v\301\242]`\321-"
+	.string	"Z\264\213\026\355B\213v\341\242]p\321.\270\320W:\272p\210\022I\244B!\221\004\320K\224@\361A\205\023 \200}#\214K?\022\251R\322\017\270\202D\360\327[\"\341#\026I\214\210\200EmQ]T\027\352\377s\210\t\227\374\321EK\0131\355\354h\310(\203\222u\275\316=s\224kXYlA\306,\tr\235\230TC\234\326\\\225UA\355@\322\367Uy\0021s\300\034\032C\254\264\020\275]\r\241Qu\235\306\220\321u\351\373W\345\323N\037c[9\347\242\2406t\262\230\365=\0072\370?{\234\375X\251\223\363\206\307\375\021b\216\bY\262I\225(jv\264\355\250\314\241M\235:L4L\230\242\324\365=o\2348~\346\370\231\243\317\034\266\256\356\004\213\241\3129uc`+p\334fH\235/\204r\274\341\322\206,r\255\360\320\312\262\021\244\272\231\351\221\244\357)\343\224qF\325\214\344"
+	.string	"l\355\244\3613*\n\2309D\372\2363n\\\020\234X\2275\227\311\020,r=\372\236C\022\377g\214k\325\244M\236/(\323\207\027'8x\372\322\335\334Cw\276\270\021\246\r2J\030\"gug\323\317\027?\237\252\227c\215+}\177:\235Lf\334\0170t>\316\243\227\325\026\\\337\377<\236\231\311\f\230\224\272K\225\334\211U\315\310u\246\036\237)\030K\324\222\334\271\211\347\216i\247\222e\033;\256\2566\310(\031\212\nD\313y\311\240\302\201*\316\315e\034\323\316\255S\266\372\261\333q\244\rr.CQ\201 J\"\206M\025\235\233vn\326!\00236\303G\337\233r?L\206\224A\351\373\f\310tHI\365\275\234\0317\204\274#\365&\316\234c5\244\206%cN\251#\007M_9\357 \244F\216\322M\337[\033YOjpk\3767\023\356\316\310\271I\203d\323[\316T "
+	.ascii	"\240e\216\254\315M\270\233oL\2348\033\b{\310\272\334\374>m\205"
+	.ascii	"\214\034X\337oH\203/g\262\201\222g\206\232fsk\020y\341 \362B"
+	.ascii	"\204\005\250\263\221Cb<*"
+	.string	"\013B$Jq\312!\306\024UQ\323\001\303\024@ HX\032\233\r\270\311\036\023\300\002\f\216\351\002AN2\246\204h$I\222\3020\007_*@C\035F4h\007\306\327\025o\344r\277[a\037H\177h\324\tz\221\312\251\004\225\3123!&4\001\355\025\n\345\373\232\027\303\217JF\371\026\344^\202\003+]\333\365\302\310\364\353E\355r<\345\002?4\274\277J2\323>\\\332w\017\350j\371\211Rd\3440\030K\370r\321\242d\206]=#[?'kJ\f\355\023\357\302<-\371\020\327\351\245\375\344/\302\021J\001\367R\013V9\366\006\035\212l\206\250M\272\003\2765q\241z\234Zk\373Z+K\001*5?\241\317`4b{\004x1\216\277Evy\334\274\3750C8\r\272\032\207)B1 kL(~\272`D{ub\023\306\017\267p|ADd\211 N\313\001\244\333\274\206J\340\247"
+	.string	"\331MTb\376C\337\272\232\3375\327x\231\355\0374\226~\324\227\227\323\264 \334](\002.\340\366y\377\363\315\255\245\205\340\021\275Hv\233\026 \217\255$\215!\020\243Z\025\270\241\302\237#\307-\331\253T\201\341LR\271\357P9\2126\035\313v&\372\234\362\3543\030\261\345@\321$\214\336e\341Q\373\005\222D\320\033\214\273\331\024\005//\250t4h\217\304s\341\261p\216\276\363\246\240=b7\340\276\274\260\215\244\232A]\271\216565s\2667]\020\004\270#\200\332\204w\364CD\001\307\307\037\236\373\036\034\326|tV\004\300}\354\204\003\003\003\311\007\344[\1774p\205\016\321e\326\036\340]\1771\006\27624:\223\027\203\272\313\207\2311/\305\307\230\210\337;m\027\365\023q\016\013,\277\236*\250\220\371To\221\024H\233\222\226i?\006\211\316\222\244\272\337t\355\006\321\200E\312\276\362\377"
+	.string	"+\347\r\261\356\022\025\260\347\301\372\215\340:\022y\377\007\373E\216\024\352\377\200\331\302=6Tg\326\231>\314\261\003?\341\007\376\320:U\001H'\235{#\326\267\001"
+	.string	"w:\367\307{\206_\246\334]s\267\272 K\316\355\235_\t\375f\025\340\300\324\r\245\335\375\337g@\tAM\353\0025\307\346S\374(\212{{5\033Hr\216M.\276\313\370\315M\325\033\004\274\262\331K\271\245%"
+	.string	"Hm\241Z\003\304I\245\335=Y.\313i\315\"\203\016b\234\200U\013\3767\341I\245H\341\2529\260\005\345"
+	.string	"9\313\313n\273\224S|\264G\263\304\306\334{UJV\004{E>pR\245\244\003\341\305\250\225\271\262f\340\213\304v-\320n\"\355mb\266?G]\316vfu\326\b\245n\003\026q\034\340\371C\261)Z.\\\373\371\342\013\360\2155\322\351\322\007\362(<\323\233\006\204\362\273\b]\301\310\023\373M\2774z8M\203\356\315\250-1\370L\220\332}O\227f&;\244\305h#\370\366\025Bj}eE\305\343~\036oh\346\227\r\376R\201Z\211\275y\024\216"
+	.ascii	"ub\265\367)S\272\214\024\t\265o\375\035\032\027p`'\304\363L~"
+	.ascii	"\376:\364\351RxX#\3000\243g"
+	.ascii	"\205\354\254\036\272\217\302\225Z\321\005,\277\353\270\023\355"
+	.ascii	"\007\362\277\007T\327o\222Y\272\364\r\n\203\332u\224\215\257"
+	.ascii	"\2407\225_\026_,\033\204\242\024I\230\260\027\2071\351\331\330"
+	.ascii	"'[\235W\340\267?\211!zX\3217&\236\225\f\203R9\033j\341\n\b1"
+	.string	"\363|\311\026/`O\376\\\030\277\247\245\277\251\344i\031\302\332Rp,\261\312\332\334\037\223u\016\353oG\265H B\340c\306\353\315\326\374)\201\021]l\222'\217\333\002\227\266\024\217\361\310\317U\036\375\034\220P\b\021\350\350a\234\260\255\273A\026\204\350\nMK\331H\330V\326\351\\$)WG\346\212X\022\336mH\220\233s\306\321\302\327\345\361\366%$qC\221\277\001\034\033?\317+\240\371\002\364pt\031\264\325\005I\322-$t\244\\\215\254\037{<h7\004\006\\\312\207\210!\032%\023\340\222\022\253x\030\0161\214\244\274'\215.o\220\266b\300\310\013B\344\277;\005\026\240\013\342\351P\t\021\361\332\030\bro\235\031\205be-(\242\256Y\323u6\264\337\271\335\360v\007x>\312\261\366\252\325\215\036\277gK\323;g\034\260q\351\210B\212\314\006\351\377a\225\207\215\331\322f?7T\360\313"
+	.ascii	"\371\001\021m1g\331\214\313#\317w\355\023C\360\237\2749\273\376"
+	.ascii	"@LSA\346\316\275A\323\262$gG\357\245!\371d\005 \221\260J\312"
+	.ascii	"\325\267\330T\222\255R\225@Nl\177M\205\373h\217\327\321\201\234"
+	.ascii	"\345\031\013\217I\302\371o\321\b\317\267\367\235\300@YY\355p"
+	.ascii	" \202\303Y\245\276\256\214\207\252\237\300\330\365\362:\261\310"
+	.ascii	"\322\2149\024)\372\206\345\005\261\202\021R4\205%W\312\375q\b"
+	.ascii	"os[\t0]\242\334\251`\324/\036\004\375L\303\252#\375\333L\271"
+	.ascii	"\351w\345\207\334;j\352\b\210\020\371\317\274\022\207#\346\235"
+	.ascii	"G}\360\rz~Y\275\b`\035\023\" \3009\202Z\332\n\254\246\2424\\"
+	.ascii	"6\255k\"\313f\235:J\206\020nC\242M\200\240\230\024\336y\013("
+	.ascii	"^]\027hi\037\"\022\bR\344\300\355\307p\226\350\206\321\205\371"
+	.ascii	"9\271\245\366\3517m]\360\323\215C\r'LV\266\fi,*\306\031u:p\330"
+	.ascii	"o\346H38\323[\275#!\312\016\267\013\026\256\232\033u\264\177"
+	.ascii	"\355\032=J\376Q\317\211\366@\034\304\210\277a\255p~@@\226\360"
+	.ascii	"Jr\246\374\205\355\366\001n\253\027?\372\201Rq \016\314*\343"
+	.ascii	"\364\236\306\320\b\210e\206\327\303\251\230-\251\244F:\232\022"
+	.ascii	"\210{H\221\262\n\255\222\225{\342\254\302\035\216\r\317\235\t"
+	.ascii	"\244N-\026,\210\223\037\343\370\257\261\256>~\225\256\332i\316"
+	.ascii	"&\021Kc&\300~\343\236\362\241\3476\b\307`\316\226\316\005?\235"
+	.ascii	"g?\227m\374\311\234]\031D^_\303\304v\335\345\356\261\032\202"
+	.ascii	"\207M\230\376\032\002\323\021\326\366\215lY\322\366B(\030\216"
+	.ascii	"/\316\347\214a\370\303\255\217Z\371\177Q;\027\013\271{F\215m"
+	.string	"8\260\246\263\200SrL\250\331\025\277\243\247\324.-\367,\004\272\271\347t\005rP\024\020\313\3066\202\272p\251\032\240.D@\241\301\341\373\362K\203\235\354\230;X\343\241u\204\216 @\257?n\271\351\373Z\311\345\036\370\205\301x\232R\214\0025!\243\243q\005$t\321\b\254rkV^\313\377\021Z|\035#]F\275\212V\003\177\343\340\361\236\207G\2252\013U\235\207\217\f\273#\030\002a(\024\205\365',\201\203%\006\350)\344s\025r\220\006\236Rh\327:!\320\202\354\\\253\001\325\211\375\223\331\254\177\226<\360\264Nt\t\336\036\320\177!\210]\017\021\341\237\333\374%\376QxMv`} \372\003\b\3445\025}\227Rpk\240\264\370\232\002\321\307\312\211\205\321\215\024\346\345\266\026l\002&\n\354p\376\302\357\202\007S\260P\342pj\2378e\204@\330D5\bi'\201\231\020\305\325.\311\221"
+	.ascii	"\364\367Y!\016x^\002\372\022\264\025!%\343N\264]\252I\302\363"
+	.ascii	"\221:ib\315&?\314\301_c\255\203\376s\322\306t\361VG.\247\367"
+	.ascii	"\2167OB\274\026\345\255y\320\240\0017L\234\003^\336\336\343\221"
+	.ascii	"\234\020\013\233!b|\0225\235\363M\331'\262\266\211\322\254B\372"
+	.ascii	"\342\333\221q\036a\222\017t\263\264\203\233\214\227\004\237y"
+	.ascii	"n\227\360\034\2445\207\321\370du\nk\023\020\253M\364*\306MP\273"
+	.ascii	")\306\017,'A\323\b&\273D\275\353.?\007\345g\225\231o~Qv\353}"
+	.ascii	"Q\016}\376\370j\360K\256 fQBo\362\276\240\034\0164oK;\337\320"
+	.ascii	"\311\337\031\303\215\371\032`\177\355o\332\261%/;\016\024\353"
+	.ascii	"\332Ev\315\024\361$\351U\316C\320\373\341?\005\345U\313Ug^Qy"
+	.ascii	"m= \375p\274\f\271o|\003\366\034\371\031)\237\234=Hu\032d\034"
+	.ascii	"\017\274VM\007\236\b\226}\335\373s\305\274D\272\336\220E~\302"
+	.ascii	"\037[v\302y!\301\017\342|\332\374&\030\"\277\375AqW"
+	.text
+	.section	.gnu.lto_.symtab.2b73cec9add7440e,"e",@progbits
+	.string	"attitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"canUseGPSHeading"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"accSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"shouldInitializeGPSHeading"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"getCosTiltAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"getQuaternion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"imuSetAttitudeRPY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"imuQuaternionMultiplication"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"isUpright"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"pgResetTemplate_imuConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"imuConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"imuConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"accAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2b73cec9add7440e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1396 @@
+	.file	"mixer.c"
+	.section	.gnu.lto_.profile.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`\214\002-\013"
+	.string	"\362\f15Po\322\030(%\314\366T!\336\350\217\210\006>\266\216#1\026a\n\340\363\22733333{U\025y\370\361i\2305\262m/\261\233\354M\344\336d'\262\003M\202\262\222(\001z\274<\204\020\016\346\204I\b\214\201\245\242Q\262Q@I\026(1\004\365\363\212\220d\220\006\004\002\366\255\330\253\013\360\233F\317\356\316\r\343\270\035\366{\363{\212\230\331\nE\207\347\353\003$e\324\341`\033M\325\334\332S\240\027,\025-\364\312LK\306j\341\223\313\270\\\036\353\357\245{\255\314\334\346skk\253\225\361\275z\207\303\027.\207\006\210\021%AYI\344\336oj7\234C\002\303e\232n\037GNB\355\323\034C[\250\261e\001I\262>m\006\240\0022\242\321\003\021\300T\245LQ\225\024$\205\255\335\177\314Z8\244\351"
+	.ascii	"S&\247\n\031\355\373\214\336\224shO!\347\237\265+?1\345\367\307"
+	.ascii	"\362\262[\316\247a;\360\337;\270\343\246\361\325\233\020[\215"
+	.ascii	"\316w\335<\315\333z\254\\\035\372T\333\343\345t\b2b=\013\374"
+	.ascii	"\324G\337\326\024\274\275Y\344Q#7\0343E\206\265\313\354k{\257"
+	.ascii	"\334\235\2315\240\236\023\031\371\002\267\"SE<\236S\033Po\224"
+	.ascii	"\233_vj\374\346\327\363\371\213Y\025S\343\215\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375 T\265\001"
+	.string	"\370H"
+	.string	"\n"
+	.string	"\001\001\001"
+	.string	"\001\004"
+	.string	"\001\017\025\002\001"
+	.string	"\001\026"
+	.string	""
+	.string	""
+	.string	"\001\037\003 !\""
+	.string	"\003"
+	.string	"\t"
+	.ascii	"`\b\225\301Q]}\324 E\021\242\004\313\305~\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`\004\001\245\007"
+	.string	"\022\213(/`M\323\030"
+	.string	"A\006\021\253\342\321v\022\252\346\252\373?\001\254\260\323P\313a\215\026(\355\2609\220\024"
+	.string	""
+	.string	"`\227,P\344\023=\225\006\221R\246\377\223RL:\262\273\316\013\021\303)$\250\0040\002\316"
+	.string	"!\240\226>d\233%A,\325\262\315\202\026\0330\ry\2208)W"
+	.string	"a\245\257{\027\234\2504\244{\227\337\0048\256\377\300E\363W\222h`\225\364\270\262\344\004\253`\305\024&\312\335\335\346\245\204\362URnw\237\361?O\207\324:>D\234\247Rb#\213\b\310G*128(\317C\243I! `\"2\b}\033\351\206\267"
+	.ascii	"f\205k\216\027k\037\302A\270`N\306`\246\305\0137\300\321tbyb"
+	.ascii	"\374,,r\265\200\276\003X\302\335DP\356 ?\246\271$s\276[HX1\n"
+	.ascii	"\362\240\002\364\344\243\274\224\016\376@\372q\026\026w\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375 \322\205\003"
+	.string	"\222\306\022\033\240'\351?\270|l"
+	.string	""
+	.string	"b\004\005"
+	.string	"\200\033\026\264?\374>\326\305\021&_\246\024\352\301P8\b\212\\\322\"\336T\247\002\007\253c\205~\001\025\275x\305'>g\033f:\362\352\304|b\266\265\222\274\244\325h\321_\001\336##\016"
+	.ascii	"`\b\325\340\2279\004\215\001\021\231\007\262\263\257*c\\\325"
+	.ascii	"UV\r\240]\232\342`')\033h\003"
+	.text
+	.section	.gnu.lto_.pureconst.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\231\004\004\232\004\017\231\004\025\230\004\026"
+	.ascii	"\231\004\037\204\004 \204\004!\204\004\"\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375 \317]\003"
+	.string	"\"E\017\030\260\031\2061@\264$\t:\f\3030\023\262K\266$\b\335\bn\"e\nw4\316\331\b$2\237\231\00160\246\221\025\256\305\264\024\323\304\252L\313\366\007a\325\303\0241\r@tp\022\022"
+	.string	"\0063\220Cp 1\260\305M25\351^u\313\312@\251HP:\372\204`\234\260"
+	.string	"\016\344\2531w\321\250\304\002\241l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.1ea400d35431ee3d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerRules_Registry.68.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375 \220=\004"
+	.string	"\224\007\\"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\266\372\013yw\350\317\005yu"
+	.string	"\005\001\006'\001\200\003\005\001\006\035\001 \253\0048sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.string	"B\b\034\346\r\317$y"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_mixerScales_Registry.88.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375 \236\235\004"
+	.string	"D\bj"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\203\346\321\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\335\006us\350\365\005uq"
+	.string	"\005\001\006'\001>\005\001\006\035\001'\001\255\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_mixerScales.89.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`.\001\035\016"
+	.string	"\366\331^E\340\264&\035\200\205\325:8\276\225\001\326`\327(?\3024^\022\337\262r\223\225\005\r\034\034\225\317\301o\3240\n\321HO\251\2301\246w\230\260\0041\314\023p\027\f\330{\204\0268\rR\030\037\261{o\271S\nH"
+	.string	"H"
+	.string	"M"
+	.string	"{.\307\b\032>\273\213i\n+8\2347|\332#\324\247\3719g\220\352\201\332L\217\360m\013\033"
+	.string	"[\bH\241\303\241s\326\237\314vz\260f\346z\326\033\244Z\250m\346\017Taw\375P\233\211[\336vf{\202}\227\b\272]\022\335\317\362\304\035+\316\335\376\364Y2>C;Gr\231J\\7~\354\020\331\235\016\036\r\341z\\"
+	.string	"\037\262\375g\037\306ch\307\201\371\200]\325\216\216\335\371\300%\327\243\347\013\310\307\353\004\344\2435[\310'MRo$\325\022q\342\364:\203z\336\"m\177\270\215\226\004=\273+\301\346\360V\207kw#\324p\361`\200F\305\243\017#\037\317zIM\020\237\"1\257S\035\362\303CGueO\323\023pB\361\302\252\262\317\341\374\360\334}\020\310\205\217/\243\013*\244\2702B9\021Y\bYd\222\215^H)\030\213\206\f$\024\f\230\n\351$\005\023e+\230\311\001\2276\2142\214\245T\312\260\320\334\253\312\316\371\325\262\341\211\321S\324\225\003\334\250\324x\363,\363Xp@@\274#\207\273\273PW'\221\327\034"
+	.ascii	"`\221\0223\232\317=\005\255\334y\365\256c\242\325,P\341c\004"
+	.ascii	"7\313D\211\211\227\201\306\205\031\024\234h\265\347b\255\323"
+	.ascii	"\255\201\005S\265\006\020\261\352n\263j%\020\0277D\224\275P\325"
+	.ascii	"x?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_mixerInit.90.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`\333\fe="
+	.string	"jj\354\026>@\344J\007\353F\363\024u\021\032\023\322z\300\210\331+\211pHT\260\264Wx\316\266\r>4\206\310\336\202;`!\300\346\b\205\321\256\250?0\242\261u\002\b\016\020#\204\220-\345N)\245X\001B\001t\001\327\331Zg\324:\377uv\353\334&\224i\346("
+	.string	"\264\256g\217\204VB+X\245\317t\003v\007v\367u\373u\353\365enA^>\335\002\333\214\024\037C\306p\227\351?^NMP\333\317k\351\353h\r3\2343\263\256yR\310>\036\354Umm q>\202D!\333\362\016E@]\270\363\232\217G\217\341\024l\257\237\314\313\376\302\275\327aZ\214\332z<\210\374BC\362\351!&\256\353\032\325\226\037 \333.u\322m\2136\322\345\301\334`\332\331\243\277p\2114\313\266\314=\230\227m\357Re\346\323yrk\353\301!{6\256\353\312\3748f%\"^j4\257Y\371j\027\021\r-\225Idz-\372\256r\337u\223\2245ei_]\204\372\217\277\257.D{C5"
+	.string	"\252{l\301f\252CK\342DJz\210\033LI/\321ntC\354B47t\003\031\035\"\275\027\346\312(jH:\311\204L\251\234\250\265uZ\210\306\206.=\311\374*\323\214\264E\241\336\336\254\025\245\371@\223\346<\331\323|\355fic\216\242\031\300t\231\353g\373\22041\364\305\360\255\351:47\377\336k\373\004Q\321\211\032\222\366\224j]W\366\2624\265f\243f\356&f\226\301<\324\frv\372N\026\213\262\305\254\377"
+	.string	"\205\310\034#\264\177\326\263\2171\206\275\177\327\0229d\216Z\332\f\211\240}\342\366w\351\341\021sA\314l\242\rO<8#|\373\262\256b\024\232\f\263Z\327\205(l\233!\214x\276\254\353j\201\260\347\250\340\246k\313+X\264\270m\373\373\331"
+	.string	"\b\2659\033O\216\2323\377p\201\315.\266\256`N\334o\032\016\007r\323\261\013\006d\3004?\215\215n`\3300\214\255\246\331\304hF\266\366\272\334iz\320\213\233\216ghy\227i\335\266V\261O##\230?2\347\205\371\3031\367\321\336\341\017~(\314\3279\353:\223\270\316X\327\371J\351<B\351,\342:[%\235CT]\347\346u\006\341\341:Su_3\207\366k\336p\23534`3\206\016l\276p\235\247\220\316\022\240\372L\363S\3535;H\235\033\\g\006\251\263\223un\262\316L\326y\351:/\270\316J\326Y\301uNp\235\021\\\347\003\251\263\201\353\\ u&p\235\007\\\347\244\324Y\300uFJ\235\003\244\316"
+	.string	"\256\363Q\352l\224:\027]g\242\324y\310:/\257\263\362:'\2553\322:\247\327\371\006~vl`\376\350\311\245\270\030\031~\t\303/\370\f\027~\3013\021w`x\250'\224\013\337f\032\325\242\306g\207T\360N\250^A!\016\237\340\251\276\307\376l\370\004/\205H\346\b\241\247\236\303?\2503\366\026\226\306\231l\370\376k\247\2715+o`\330\300\334\370)\222I\037\216U\030\261J\337|\235d\262&\361\316\031:\340A\274Y:\365\t\326\252\350\3011\360J\232\236\304\335@\274\201\357g7(\334\323\273\303w\013\274\022\003*\263\b\304>\034\027\370\001\317V\244\261\315\3200\016\201/\320\301\333\254\256\326\240\260\035!\360Os\316\001\177C.\260lQ\300\027Y#r\365\002\374 \370+\244G\020\340\221\376\237\036<\315\352j\215\211\243\371Y\200O\026\356\3319\001\274\220\246\007q\263\373"
+	.ascii	"\374\253\261\376\372\332G\217e\364G\377\177\037\034\210\025\326"
+	.ascii	"\031!\377\341dF\237T|\fT\364\314U\356\243\351b\036\326\374\242"
+	.ascii	"\033V\224\337\374\373\307\310\f\321+\207\236\250\252\037\255"
+	.ascii	"T\2345:\026\032\372e\332\243\335\362\007\t\n4\365\313\277d\362"
+	.ascii	"\247\220\237\374\2073\242\377\234Pq\306\350\207\021\371\3134"
+	.ascii	"\307@\316\364\027\025\023\263H|\372\375"
+	.string	"l\244\247R\363\340\265O\002}\373?H\346\310X\215x\"\305Y\342\036=\350/\277\034\355\234\377x\274\004\034\256\353J\201\017Q\030\005LC\n\007\215\034.\266\2306\270\266\266\270`\320p\321\302_\264p\255f\030R]1thm1s\320\230\241UC\006\323\206\226\213-&\214.\034L\251\003\314u#F\0273\007\027W\027s\231\007\326G{\207?\372\241p\3375\262o\220\020\354\303x\304s\277\361\247\377\205\001q#\344\360\370\230(\342G|\217\325Y\275\210\277\203c\211!\336\352\233\314\261\235\254.q1j\023\244\207Q\223\250O\270\351\270n\333\020\237t\272\323\361\270T85.\356\266\225\360\355\354\007b\326\330\261E9\263:E\245\342]\306}\327\312\2763\204a\377\305E\017\307-\330QR\206\252\236\321%\324?-x\352F\211\236\276\352;\313\234\234\006\357\245\231dWE\305;\360\r\276\005\223\376"
+	.string	"\203Orz\006\377O.V\025\344\326U\314\002\263z\305\267\250X\230\207\226=\213kQ\265pQ\355\354n[\247'*\004\f$h\330\315k\305\2574\t\310\261Wq+\352\235\nF\305\363.S\361n\333\324\t`\227\377>wG\004\r=\034\373C\350\026ld#\032\247\022BC\275\031\367\362\3418\315\223\364\360\237\307\243\332\301\233\261\203o\247^\0361\027\324\375\214S\306M\t\241\035\274\207\357\275F\t\275\365\031{kz\272n\257\313\364M\337sLo\027\003\200\362\250Q(H\021R\n\215\210\210H\222$i\f\220\002\221\241\262\315\003\021P\251CJ\311\024-H\241\320\032\301%\341f\373\305\356\250\267\335\024\311\025\007\240\270/Gb\211#qs\275\267M\202\315\313\345\355\177y"
+	.string	"\267\314\225\211\317W\006M\244n\201Lx\372b\201\214\022\205$\025\200\3249\260\234\216\273i\340Uv\274pg\303\027\300\361\365\227\271'\016\277\355\265\026}a\271`n\033,\332\006\273\206\223\027U\032)\305\267\021aU2\250\220\375o\324P\212\004W\"t~o \364\312\225x\204\204\t\031\322\\\263V(\236\3152\033\260\002j\206\3458\006\201\t<#\037'\222p\2065D\004\367\322\375\371\204'\037Q\266O\021\001\242a\f\024U\374Xe\n\037\302\315\342t\177\326X&\210q\365"
+	.string	"A]MH\232\tB{\021z\304\366\206\336\353\324~\303EV\232\026\254A7\022x\020\231\217\226\272\031\342\342!|E(\335\217\340\333\253\200\255\b1\232\323\253\374n\363\341G#Q\361\006\230N"
+	.ascii	"0\343IW\324\327\313\260\211\r\344(E\222\324\204R\te\223\017K"
+	.ascii	"\366U\250\373\206\2021\244\223&Ut\213\312\033\211Su\f\265\001"
+	.ascii	"\360\212,\300}V\231P~\347\224\251\227aA\300C\252\027\264\024"
+	.ascii	"\307.\036\305\245\267!\3534\337\333\345\001\326g9\275\177s\230"
+	.ascii	"\314\021&=\207X\0268\020\263\007a\212\240D@F\201\240\303\322"
+	.ascii	"E\013f\235C{h\354\245\367\375L\365Z1U\304\335\361\037\312\221"
+	.ascii	"\326g\221\n\305\232Q]\316\223\2072j\233w1\356\024\032\337\307"
+	.ascii	"\306\033\026\177\367\002\013\267\354%\006\021\323>\330\320\321"
+	.ascii	"\371\317\313\245N\366\007\036\275g&\300$\304\357G\321\023*\004"
+	.ascii	"\030\337\241\372\310\367\001\364\023\340\037\002\035\332,z\253"
+	.ascii	"\232\022C\005"
+	.text
+	.section	.gnu.lto_mixerInitProfile.91.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\325\t"
+	.string	"V\022B80\257\322\001'^8\f\265X\033\210\241*\313R\002\375<e4\256|\274J\002\\\375\325\263\364\377\260r\312\213*\353`\200\001\303\033\006\205EB\303"
+	.string	"\311\336\222-eJ\001/"
+	.string	"/"
+	.string	"5"
+	.string	"0K\333L:l\237\343\223\315r\220c\037{\261b/\273\313\351\306O\317\223\177\220o\276\026\352\tp\260\273\316\257uq\353mwl\017\330\357\004&\377\345Q)\377}\363K\231o\327\315\b\312\007F*C\033D\245j\330\217\253.;\246\267\230\216\232\326L\347\323\327\004\244\254\020\264\354Z\204\001\237\313\354\252\212\f\332\332 \fk\024\273\251N\324M\277\362Peh\325\250\231\223U-U\365\254\030\213.\322iv\267\300\007'\"4/S\346[\352\006\366\220\303\002\376x<\220DH\304\221\030\026B\016\n\334C(A\304}\274\021\347\021p\007\001\3628R\327y\034\007\334\307U\027\202\n-\245*o\352\223<\346Y\203e\371\317\262\222\022"
+	.ascii	"3\241\007\037\030\337n\r\314\312\030\206\305`\203k31L\234\025"
+	.ascii	"\302Hz{2v\2052\316\242\332s!g\033ly\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_mixerCompile.92.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`\351\026=c"
+	.string	"\332\241\200#K \020[\351;\256\355\274\250\030\345"
+	.string	"`\307\213U\354u\204\222\027\240>\020\363\t\027\224'q\211\347\301\031\220\3705\320\304t3O\262\355"
+	.string	"\004\201\260 Huc4\033x\256\376\337\303\332\231\235\240\261\n\214\304\202\r\262\267\224)\245\024\035\002\362\0013\002\374\203:\373\\\347\236\353l\274\316<\326y\307:\027\255sj\235Q\353|\255\263\265\316o\235\335:\267\n\344\002\232\022b\326\225\354y\303z\346:\333\272\257\273L\367\230\356\275\356\274\3560\335w\335t\335\315\356-\335\\\272\273t\017s3w\037\267\037\233\272A3tnd\330x\004\013Z\301\230\300\271\305\300ldn1\314F\27692'\267^\036\357\315)oP"
+	.string	"\006\033\354\270\361\330x\367\001\0305~\b\264\027\356:6~i0j\323\361^1HYqN\256\357F\261\357\321\336\206\353\270\226\35396v\371A\347\266\256+\r.u+ZK\277\240\366\026\020\216A\202\326Ui\347\266\256eT\305\276\034\206\207\033KgQ\273\371\243\270\272Y)\357\006\327u\225\352\313#\212}}\355\"\264\357\261\211\320\276*3\234\326\302\266\266\334\0271\271\303u]\251\236ISS\217\0233O\007$!>\266\325\322\274\223\252\375\301\351\330\304\344a\351\251\203R\022\322\221Q\021\007\242!(\241 \240\037\237\036#\317N1E\257}W\271\347\372C\226\277\244Y\220\376"
+	.ascii	"\306\f\026w\372\322G\2653/\335\004\327LpM\367\340\305\036\375"
+	.ascii	"\262\370\322\227~\262\0270o\256\323\224\321\331\025G\2400\233"
+	.ascii	"\214\025\357p\245\225\310t\b8)jgW:\211i\253\370\2368\322\262"
+	.ascii	"\217\332\332\250\255\250\323\224\261\320\034\254\2104eP\354\221"
+	.ascii	"\230(N\224\272\340\353\020dR\324\316\226=\324^'4\224\023\030"
+	.ascii	"\352\\h\205\263&\035\0044\245\f\005\377I\263\307)eI\334\307\372"
+	.ascii	"\223@9\235\246\214\315\262\3203B\326z\3554\245L\211\367\234\320"
+	.ascii	"\306&\315cS!dQ:M\231\t\266\212\316\240\263\353\276|'u\261\302"
+	.ascii	"\031\222.:\251\235\241u\232\246\fM\314Q#}m\021\23257$\322\314"
+	.ascii	"\0241\232\tq\373c\026f\217x\355cf`\376]\327W\331'G\355\fI{\352"
+	.ascii	"b]W\366\244\331YsT3\277e\346\005\2309\204\005_\255\306\205\374"
+	.ascii	"<S \332\373|\033\277D\367\274\355\013\273\241\203\346=\224\347"
+	.ascii	"\215\217\322P|\236\357f\224\247Xb\n\324Ht\347\271\342\372\272"
+	.ascii	"\260\221h\361w\036\265\013K\373J\300W\244\3213\253(\261\370\327"
+	.ascii	"Y\003\263\231\376\034\022\210m/I\350\225~J8\207\351D\277\b\360"
+	.ascii	"\355\020\221Q\207YP5\240\2773\205\006D\364\376R\222\260\221\250"
+	.ascii	"\375\373\377&,\355\313\237r\366S/C"
+	.string	"Dg\017X\0213\367\225\377\376>g\201&D\266\235\234\254\256\033\374o\273\300\036R\002&\004\213D\375\271\342\004\301\234\016\213\320q\310\242\377%4d:\373?x\357\023K\344\006\332\r\022\np]W\025\314\f\004N\267\311jb[\327\265*\260\005!\340\206\322\227#\220@\002\264o\177\343\365\210\2638\314\246\227?\241\256\024!\373WN\200r\253\3515\023pCa\035Z\336\311\276\334Z\3167\207\206^\376\344\036o4\035\367\326\343<\315eP\251n/-\267\365\303\226d\306@\003\357$;\235\2243a\037\204YK\020\177%s[-m\262\360/an\272f }\327\374\201\217\036=\246ykG\3675\353\3502\3158zL\363\215\336k\306\352\274f\033\035\246\371\252\351\232k\\g+\353L\303:\317\260\3162\254s\f\353\f\303:\277\260\316.\256s\213\353|\200ufa\235\r\260\316\005\\\347\025\326\231"
+	.string	"\353\\e\235\007\260\316*\254s\212\353,\200uFq\235\003\260\316'\212\316"
+	.ascii	"\024\235\251R\347\251\242\263\211\242s\211\324Y\252\350L\242"
+	.ascii	"\350<\"u\026Qt\016Qt\006q\235\243\2563T\352\374t\235?\\g\247"
+	.ascii	"\324\371h\235\233\2543\323u\366`\235\227:\257\271\303uV\262\316"
+	.ascii	"I\326\031\311:\037Yg#\353\\t\2359Xg\242\353<t\235"
+	.string	"\205\254s\020\352\f\204zv%\336\204\324\227\370\177\243\364.j\225[\210w(\307E\352o!\036\"\t&\276\005o\371\202\0265_C\222\234\2013\342I\210\370\021o\373\232x\026\265J\272\206\207\345\212\210O\327\360B<q&\343\375\333\335\341\262\n^\207%\211\223\302\272r\213\347\223\f\330\272z=\201\370\020\337Q\017\342S\271\260A\250w\372\250\377:aS\236\036J\265\342TT\026\330\247\370\233\332\246JQ\337\3247\264\357\323\233h\342\374\360\267\216X\342\361\235\324\026\334M\255\222~\335\035\266E9~\372u\207\330\304t(\310\177\273[>q\342j\032p6\253t\355n\311d\205\246O\327\356\230M\246gV\257\370\022\344\277\331\035\002\372\232\232eg\255\356P\005WS\341^\304\230\201\366\365\276$\241\027\nV)\021\273\303u\005\223\341iY;yuK?\301\225\\\241}\231>%b\207\330\\z\017@"
+	.ascii	"\227\276\305\264\324[\035\323\211F\364J8\215\004\211\225c\256"
+	.ascii	"\243\n\2734\207^\311\215\006\365K\330\350$\310\307\277 \217T"
+	.ascii	"_\375\330\325+\3554\343\374\300\234\016\237\320\217\215g \033"
+	.ascii	"\317\266G\252;\374\330\325\373\370\206\241/\225\266\277\260\264"
+	.ascii	"\244o8$\320\325'=\003K1b\211^H\202\220\376\350\177M\234\237\033"
+	.ascii	"A\266\237\033/!\253\373\274\b\322\267\237\237!\373\316\0017\313"
+	.ascii	"j.\200^v\364(\234Of\363\215\335\032\026\240o\306\005\2029\035"
+	.ascii	"\3579ab\310\362\363J\243/\372\266\022\347\347\246\347\214>E\240"
+	.ascii	"\323\201\236+\372&\242\347\360\315\0174\034\321\203\btN\265\215"
+	.ascii	"\037\372Nk\3537*\270\321\361y%\373\220C\202q\350\273\376\356"
+	.ascii	"\240\256\336\306\217I\265\215\237:R\203]\327u\355!\022l8d\221"
+	.ascii	"^[3m\317$\341\227\341\322F\320\370J\276tv\204^\251y^\311F'E "
+	.ascii	"\377\202.\3255~\254\306\013}\f\277\240\027b\037\342I$\216\034"
+	.ascii	"\336\311\034h\337\240?\nD\023a\303\263n\247D\327x \337u}\251"
+	.ascii	"\260\020\307\213\257|\261N\022\376\274\317\003}\213\025\t\027"
+	.ascii	"tW\007\024\374Vgp3\320\362@\353\206\221K\213\203\034]=8\350\352"
+	.ascii	"\301\203\207K\213\002.\036\227uLqi\371\330\322\200\252\313\202"
+	.ascii	"\035[\031T@\265\301\326\004\032P\351\340\352\200jJ\211yp\240"
+	.ascii	"\305E\325\305\203\007\027\225Q\313\332\277\204sT9\343\365_\374"
+	.ascii	"\243\271\005\004.\335\203[\374\311?\354\272\252\265\350.\335"
+	.ascii	"s-4\270\345\303q\307\277\340\223T\343\300\301\347\204\343w|\233"
+	.ascii	"\351K\005\313\337\361\225G\200yn\226\206M0~\360\321\220QF\376"
+	.ascii	"\b\bB\266\266\320\276(\rI\302\031oE\343\213\314x\032g3\336g\215"
+	.ascii	"\r\"\332\037\323+e|\253}\031r\211,\353\210\004\031\237\022a\303"
+	.ascii	"l\212\340!\3062\306\337\3025\210N\030\257\343\275\257\201\037"
+	.ascii	"CB\001\231\341\223YM?\004\306\267_\217 \262\206\331\\z\372%\274"
+	.ascii	"cEi\353_0I\252o\374\030\317\r\301\023_\342\200\351p\343\267\276"
+	.ascii	"\215\\y\206\245}1\263?\255y!\214g\304\366_\017\246\212\rQ\307"
+	.ascii	"\306\320\276_3,\017\275\374\371&\206\200\211\240\364A\324\021"
+	.ascii	"\362\374"
+	.string	"\016\r\233IG=\376\005\207\244\032\013\013\351\225\214\365=\276\371\372RY>_\3743\261\216\213\177\361h\237\r\310)\300\325\351\250%\034\261\035:b\022\264\257\213\237\nl\036\360-X\374\001sX\0201\203\210v\304*\231\033\"\357\232\230e!a\272&fih\200\231\017\036\306\201\203\365\006|\227\2258b\211\005\020q7\310\273\306\267T\223\336F-\301\347m/\320\005\325#H\324$J\320\276o\227$dc\225\026\362\255QS\300\247\205|\314f\325\257\370\026K$\340eh\303\256z\002\276\321T}\307\320VJ\336\036\"\232\023\0328U\214\006x\025\377\204q\202\177\310\376cs\277\254\336\353\033\340\373\257I\031\253\023o{d\306\250\370\226\013\364\264\206/-\024\275\222S\374\211\357)Fz.\305S\241x\001L@\361*\260>\200G\353\204\245\235x\246&\316#'u\274px%c\375\222\222'\f"
+	.string	"\n\256\247\267\314sR="
+	.string	"SO\245\202\343\351-\357\354\246\376\026\3521M\2549\335!\230/\001\201\325\250q8\005\021C\206FDD$I\222\264\006\221\005\204\030\345\240\263z\022\200D1\210d\214)\261\242 \251dc\357\231\341\244\347*\276\250#\352\226\205C\375IQ\310V\243P\340\024\312\263\266\035.\177\025\372\t$\232\n\355y\200\370\277\223\036\263v?1\262\264?\332\0055\347\005\263\237\020Z\202)a/\351\273\3232\024f\315j\313\374\301\252"
+	.string	"\002\204v@\004\235Ja\256\277p\002\311bM+\234p5\030\b3GW\t\027^\316\004\023\325\241\343\177\001\351\305G\353\240\331\273\301\233R\337m[Q\033G_\337R\341\b\224\261*W\255\037\312\353\307\364\266N\005t)\023E\246\340A\215\366\342\034I&\021f\240t\330\200\002\215\360\267\017\205{P\r\257\273\202\r\373\211T\024\017\f\020\201-b\222<4S\003\206`\247\004z\272W\227\272)<0X\025\352v"
+	.string	"<j\303\214\352\254E\024s\277*\332e\177\342"
+	.string	"\237\347U\233E\024\267\037\221\304\232\377\t\365\210\363\350\213f4rh>\204W\343\027\277\347&\032ZdG\333\374nIB\366\\tKQW\360Lr\0015\321\031y\034\320\316\316i\217Nt^\027|\245Z\316\027\025N\033\255\200\211\007g'[R^\231\b\331:\300u\033W\374F\322\375\307\355OB}1\254\336j\241U\216\342\221\201l\253}tJp\264en\372I\315\306\222[\236\230d\r\214\206\344\021\035\251\243X|\234\267*\335\243V\325\247\335\003]\310r\343\236/\3564\032\334\246*\036\037X\r\021\220\251\f\217RS=[\234Y5"
+	.string	"^\243\r\276a0\016X\034I\311\026q\274}\206\253\022\376\320?\341\233\201\177\341\n\"v\351\270\376\007\032\246\332\006\2278\024\266\b\023\006X(@-\212\006y\327,\222\212\373\350\017Vp\272\210\303R\346i\365\265\353\213\260"
+	.ascii	"0\222s\030\355\274\001"
+	.string	"\222\263p\274\354\036\333\021M\034T\240\322\002\375\023\370\343\036\033C\267\305\373\361\332\257a\210\220\030\207F\344\n\316u\"N\307\271W\261D\330\023\321'It\316\341\211[y7\234\013\364\340\362\356`\245\204\312Q\254\355\312S\252Atg\206\031\220\220\222T\tU\320\312#\207?\241\n\374@\024\3540\026\326^\025p\031\t\374\013\331\331(\f>\311\257\242`\310\234\022\341|\355Q\254w\350/\2066!\363\251L\346P\004m\345\344I\006\"tr\023\337\004b\344\341:\257r\\l@\332/\214}\177ph\262\005,\256B\337\251\005\2520>\1772\330\276\345\232\265\226}\300\301T\232\264n\263\224\265\220&\201e\002\255\263aM\241^\004\354\350\272\357\254\220\027\300\fU\204\225\314:(\324\263\320\336)z\004\201\302\020\022\356\352\264\353\350\214)A\247\311\023Xe|+L\347\017OE\261\373\261\205a\006\3303\347"
+	.string	"e\237\016\262\276{_\036\262(~\030\020\200\b\177\017g\002&\216\031\310\323sx\236\013\202\0018T"
+	.ascii	"l\211\024\232IWAt\302\207&\363\025\360\177\214-\372\032\002>"
+	.ascii	"\246\003\340\201\001\204,g@4`\274L\364\305rb\304\344}M\344U9"
+	.ascii	"\341+\301\244T\350\3518 \246b\20068\307\031\002\273\2126S\204"
+	.ascii	")\303\323\315\216\377\320\210\327p\001\253s\305\020\t\222\362"
+	.ascii	"\246\233C\370<\246lB\005"
+	.text
+	.section	.gnu.lto_mixerSetInputScale.93.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\r\n"
+	.string	"\346\223HA \251*\035\017p@\001C\033\004\210\277\016\224\017<\237\325,@\026*oj' \333L\266\300o\370 \254\330J6\302\"r\220 "
+	.string	"\300\b@:\312J\\[p\"\006f\002\225P\337\376&[\246\0244"
+	.string	"5"
+	.string	"6"
+	.string	"$\216\273(\f`\273\341\306\023\227K\177\366\204\207\255\375\002\b\252W\205\335\2351\300\277\353\347\037\3011\340\352t\265h\354\256\025\\\231\334\361\266%lW\330g\b\327\356\372U\325\267hb\0212(\354\226\314,\254L\306\b\330~\306\276\201\037\370\036\232,wS$\300vw\343y\271l\370C\345R\357P\271\264\252Ma\361\335\025\016d\251x\262\026m\217\374e\322\264v\367\302Op\005\"\177\300\245EHz\360\322'U.!\004\234h|\304(0S]@\351\314\016O\032\001\330\3276\262\354\207\017\333\247\343\021\311\322\306\021\342\244=\034o+q\2409\372\360\340>\0353\304u@\323\343\211&'\302\035\310\346\315Q\327y3\023\356\265\215,o<\220\241b\312\030\265\273\020=hm\020\n"
+	.string	"2\241\035h`\201\213\003f"
+	.ascii	"\256\211^Y S\030\367L\335\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_mixerUpdate.94.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`\364\034\305q"
+	.string	"\272\275\340(J \222Z\031\016\026\235\364(v\376\324\2706\210@U\210N\376\220\305\314\375L\326\236\0377e\323g\230\004Ym{(\030\020"
+	.ascii	"\f!\342y\231\270\273L\304\325M&\342O\372MD\204K\230&a\232\204"
+	.ascii	"a\004\371M\366&IJ\031g\002\\\002\201\002\213\342\330\013\300"
+	.ascii	"{\265\336\233\225\366b\275\367\304{\257\336k\342\275V\357\255"
+	.ascii	"z/\325{K\274w\352\275R\357\215z/\324{\237\336\353t\3666\275\227"
+	.ascii	"\351\354]:{I\030{\225\316\336\244c/\022\332{\204\366\032\241"
+	.ascii	"\275Eg/\321{\207\336+\364\336\021\357\rz/\320{\177\330\216\327"
+	.ascii	"\307\330\333\363^\344{y\336\273\363\336\364\275\307\367\242\357"
+	.ascii	"=\337k|\357\337\333\357ef\023\252S\306E\232u=\262Hg%s\372M\341"
+	.ascii	"=\346>f-\314v\314X\230\351\030\335\345@$\234\3038\177F\304/\254"
+	.ascii	"\003wI\201wX\2370\3058z\313|\334\\d\337\t\306\365\fh\r\323\003"
+	.ascii	"C\005E\272\205\271\250\274w\002\257J\261\235\026\364\302\270"
+	.ascii	"Y\327:\254\224\317\255KY\b\315[$\237Z6\320)\fh\r{\363\201\312"
+	.ascii	"U\232\302.\362\256/\313\026=\272\345+\313u\213\3449f\252L\267"
+	.ascii	"\201\251\227X\252E\017\315\315\272\256W|\256U\312\247\023\023"
+	.ascii	"\241|\032Y\b\345\023E\252\273\205\\\347\266\262\0266D\360\342"
+	.ascii	"\254\353\252\365'G$z~\250\001m\357\207\032\320\370\234\234\234"
+	.ascii	"\240vyx\204\230\230\230\200\026\210\215u\274;\251\312QPONMLK"
+	.ascii	"$\224\222\220\216\214\212\210\246JP\rI\t\215\b\002\372\021\341"
+	.ascii	"S\325\203\344\331I\217\350i|\253\313\307-\250\346\342r\314\213"
+	.ascii	"\243\270\344Ei\250-\3744\327Ny\334D\307L\314.t\275\024\327$\256"
+	.ascii	"\260\222\034'Y\371\223k$\275\346\f}\344\204,\0076:n\221M\341"
+	.ascii	"\"\243\t50f<(&\305HT\246\t\020\0348\245\211r\340\251+\\\242\363"
+	.ascii	"\230\252\331\307\207\0021\021\3233\016ma)\343q\310\021)<(\266"
+	.ascii	"g\\!\307\215\037\337Ai!\031x\204\f\034d\354\"|^\334\002\021n"
+	.ascii	"\021\206\006r\343\2375\026\261\226E\255}\370\313\215\253\262"
+	.ascii	"\360\323\240\330\333\227\356Q\302H%Opbi\315c|\231/LxP\354\005"
+	.ascii	"#\013\265'b\270N\331;\307-'dh\234>1!;\343\243\321iP\354\f9F\244"
+	.ascii	"\321\343V\035\237ohB0!C\343\023\t\033y\306\220\360E\214\205\031"
+	.ascii	"\235\326ue9n#c`\335\307\255u]\267\227cd\274V\274\373!\273\013"
+	.ascii	"\301n\022QLt3=A%\035\260\317\t\"\232\241)\225\206\333\346\017"
+	.ascii	"\r\307\035\362\026\227\206QZ\3126\177f@\363\020\227\206\347\020"
+	.ascii	"\224\2676B\037\372\321\241\223m\276\350\266\032*\330\204\376"
+	.ascii	"s\006/\2219\202\311\022\305\240\2178R\240\3326\031\017\253a\250"
+	.ascii	"\301\302MI\320Q\260\341\3051\201^@;\3749\320\221\360\"\350$\333"
+	.ascii	"\344;\267u]S4\222\032*\324\360\271]\326f6*\270q\003\345\363\347"
+	.ascii	"(\302\356\022\231F\264\217\364\230\330\311\033h\205nqi\330,\254"
+	.ascii	"\300\244C\\\032f\365r\233D*\360\025\272 \226\206>\207u\304\234"
+	.ascii	"\n\345\"g9N\007\355\326\204\265\234\355\225\251\320\236s\221"
+	.ascii	"o\0239\003\353\260\036\202c9\312\346\320\241\003\345\263\347"
+	.ascii	"\307&u\342\316\220\275\366W{!O\276B\236#\217\204\247\204\003"
+	.ascii	"\223\263\256\353\320\316y~\204\247\244\222\305t\346\354\334\347"
+	.ascii	"O1E\344\3048=g\230\343\323\037\2051d8o\214\307\373\230\241\023"
+	.ascii	"\207\026\262\233 x\320\234G\217\266aBf\263\246\317#\337 &\032"
+	.ascii	"\321p\232\037v\016\177\343\217|X<X\346\367)C\214\353\203\341"
+	.ascii	"1\333\374Q\023\206\305l\260\203\007\217\rl\2634\374j2\230\ni"
+	.ascii	"d\326u_,.\272\t[\327\257(~\037UT\302\201\355\236`\036\266\231"
+	.ascii	"\256\353\272bY\220\277\364X\216\302\347\372\340j^r\241|\362}"
+	.ascii	"\300\206H\364\373\352\305\335:\260~\333.+\261Q\224\333\263\355"
+	.ascii	"2\035/7\341%\274\246\246$\r\355,\t\357\3612\022\356\343e3\306"
+	.ascii	"\302\313ei/\217\031{\271\b\367\361vq\037/\020\356\343\r\201\265"
+	.ascii	"\360\202\300v\274\\\214\205\367\007\323\361\3728{?H{{\274\327"
+	.ascii	"\203\367\3628{;H{w\274\227\203\367n\360^\r\336\253\343\354\315"
+	.ascii	" \355\315\361^\f\336\213\343\275\027\274\367\306{-8{+H{)x\257"
+	.ascii	"\215\367N\360\336\032\357\225\340\354\215 \355\205\340\2754\336"
+	.ascii	"\373\300{\0358{\033H{g\274\227\201\367\312x\357\002\357U\340"
+	.ascii	"\354M \355\215\361^\004\336"
+	.string	"\013\343\275[\357}\221\366\272\340\351m\301\323\313\"\355=\340\3545 \355-\340\354]\221\366\2528{S\244\275\004\274w\200\367\n\260\323\033\300N\007j\326u\345\345\362`\311\303\023\367\372W\0221\231\230\234\223\234c\366\007.\223\024p\003\222\212\275\250\246\261P\003\245\353$\027U\270\321iE\325\013L\0352\004\345\263\200s\223\265\314\n\343\230CRg[\276\343++#x\311\327\030\344s\256\033\341\372\212\307\020\243\342+\344\250iD\3245\0257\"dfV<\242f\216\020\327y\311\371\206=D\245\032X3\212\254\021\267Y\344v\330C\250*\030QY`AM\034\002\236\"J\277Q\323\204hC\365\310\230ZV\206\362I\300w\316\244I|\231&l\352F\274m\273\347\212\371\216\323D\264B\240+\366\271\221\345\240\267-r\315\017\227\375\204Ru\202\1774\3758\027N\361\232s\006\350\307\271\354|\205\313\342\317"
+	.ascii	"/\334\346R\233+\n\360\001\316J8\001\316\200{M\245\233\035\360"
+	.ascii	"\352\330\211x\333\n\335q\027\032\300\231\211]\230\235A\356BQ"
+	.ascii	"<\200\263R\r\200\243\370\031FJ\253\371\241\323\250H\\P\321\320"
+	.ascii	"P>\0018ga\2523g\342\374\276\226\030QT\372\274m\271\352lK(\217"
+	.ascii	"\0212/\241X\347\2612=\250\246\301\240\256\255\241|b\375\2043"
+	.ascii	"\246\347m\037#f\352'\316L.\202W\007\343\303\322\320\304\243~"
+	.ascii	"\365\323\352&\316r\2704\225=\200!\337\266V\257z\007vbxXb\365"
+	.ascii	"\023\020L\334Y\325\267\275\264\3406\325&\333\267}(\237\315\267"
+	.ascii	"4\304j\252\357\252O\3247\224\227Uw*q\251S\335\202-i\224jS\237"
+	.ascii	"z\211\037\025\373\317o*1\352Q\227\372\361P\t\327;l3mF}\247\212"
+	.ascii	"\2278?\250\363\355\235\200:\026\331\337\323\365\266\371\223\207"
+	.ascii	"\26744\321W\274\253\316\240Ni^>\035\213\254\013\231\260{-U\357"
+	.ascii	"\2525\25064/\227\345\230\307o\216\f\330\275x\336\266\3075)7\371"
+	.ascii	"\327\234W\354\343F\230\311<\330\301i\356\274\315\307\271\311"
+	.ascii	"Q\320kv\352\264\325v\3334\312\302t'8\037\037o\372\031\250T[:"
+	.ascii	"\323\223\370\224nH<\351K?\242QRQ:\t\025\207f\252q\351\272\206"
+	.ascii	"\245\330\276\322s\252\234:\247\322\251t(\237J\347\2757&\322\223"
+	.ascii	"\222T\332\n\214\316\241\343b( C\006\312'\322\177\302\370X\f\233"
+	.ascii	"9[\2163\320\243\0131z\321\217\316U\332\206\031\016\320\240\201"
+	.ascii	"\362it&\3023\242\027\235\211\324\361\361\023\001\373#\213\204"
+	.ascii	"\037%\354\350\322\022!HWW\020\036#\004i\017D\350q\037\314\305"
+	.ascii	"\313#KH\017\023\270\272\264J\370\341\203\013\310\007Z\"p"
+	.string	"\355\350\322\342!\204\004\255\254\244\r2B\017!Z%\004\t\"D\013Y\367\305gK\377\026\311|\035l\243zx\342\265\177\215\324\025\203"
+	.string	"\302?\350\361\017\336C\322\207\036P \234\327\316y|Z\341\033\243T{\013\314\255\330X\236\326\2444\361\031\025\233\275\253\213\351\304\224u\356\262\204\343\254\244\353|v>k\nzpA/J\316\343\036\300Y9\340\037\217\035\357\240\013\333\016 \232.8\007\317b\342\3408\316]68\006\347@\203\353\370\006M6\rt8\337\236\216\034\317`\013[\216<6\ft`\303q\307v\301["
+	.string	"*.\025*qZ\t6;\020 r$\222\264\316\177H\017\234\321.\003\0039\247\235\317\372\020\225Un\034K\035\243\335\202\337\370\331F\251\006x\3466\3239\013.\365\346G\301+\220K\232\241\240\271<\271\2426\307Tr\3406\256\225d\343\017\234\377&8\215\3338\212W\343\022|\202+\035\3069\251qF\363F\3468\334 \3019\360\r\202GP\305\t\004g/\204pNh\334\005!\025'\017\234\013\337\244$\3318q\340-"
+	.ascii	"\021\221h\200A\212\021aZ\337\024\233=\204\033Y$\017A\250\007"
+	.ascii	"+X\336\230\001\303\306\243\267m\216\033\212^40\204\207\264#D"
+	.ascii	"0\316I\206X\b\r\341g}\202\312*\234\344k\016e\233R\177k\362\025"
+	.ascii	"\340\241]\232-\206eFo;\003\177\361m%\234\2162\006\b(E\f\034\306"
+	.ascii	"9\220\203\260\334\2404cf\306\033\b\363'I33>E(\343\b\234\201\237"
+	.ascii	"\212J\265\005\256\300e\\\251\215\022\016l\314\333\222l\0268\237"
+	.ascii	"!d\016\361&\333L\317D\2013 \241_\214'P\3461$\315\3048{As5\004"
+	.ascii	"\356\342-\315\225\3008\267!d&\t\377B\222\315\321\222n\3116i\224"
+	.ascii	"\023P>\267\214sw\207\255Ep\310\030\221\330\024\031s\211\267!"
+	.ascii	"\341\335\362j\305e^\341&\307\r\325\333\366I\366.l\241\221\316"
+	.ascii	"\313\366f[h\034\342K\237c\333g\266\360\200p\342\254\253W/W\253"
+	.ascii	"\037YVK\335V\261\265n\265\022 \206!]'\210\263\240\246I\255\220"
+	.ascii	"\\l2\342\342;fA$\2668\233\235\221\374\201\312*C\274>\240,\336"
+	.ascii	"\342\3060\007\234\205\020/\242\246\2458\221\344\"\001W\036p\037"
+	.ascii	"\300\302D\346\303\222o\232\002\202.\250\202(%R\302\250bJJD\244"
+	.ascii	"IRh\r\302\013\020\206\"I\226\232\352\001\022\240#=\013\203\016"
+	.ascii	"2c#\"a\202$%\255\263\006\222\212\032\323+\320\301\"\234Q\355"
+	.ascii	"/%{"
+	.string	"\271\364P\365k\227Y{h\277\320f\001e=Z\356\260\313\262\324S(\204\002\324\225\031\334\034\317b\277C2L\177\223Q\252\356{\200\020\212\313\331t\272\177\213\304\332\002]\001\bYY\203h\224\206@k`Z\205\261`c^\376\232\233%{x&\017E\314\200\372\276Xqz\356\007\036\221\303\243d=\224\316\200\260\024\331\312B\342\211\225\277\212\007,\f\"\206:\007/\025\264S\325\t\363\224bs5Fx\f\n\234\006\026\364\221\233!\030\rDB\217\\\245LIE\274\006\t)\034\377\341a\2427\006\031\311\317Z\222\307\362f8\225\242\371\255\020\032/\365\260\203\031\204\313\322L\370F0\323\006e\222\210d\273\372\305v\024@,\0041A\311\224\304\313\344\340\325\376\362ynW\362\020\342\356\202QJ\302\344\344\t\037\210t\210\215\244\300\320\017x\377\216F\316\366\215\026N&\347\341\231!\300\264\r\247\022:\252\205"
+	.string	"\257\345$>)\007$\017K\211\"\344\300\215&\303\241\325\240\213\226\332\263h\005D\256\226\345I_\317)\201a\251\324TI\207FM\342&Q\023t\300D*\005A\251\273Wjx\f2;\016,\034\335L"
+	.string	"\rV\213u\227\030\367\324Od\244\230~2\354-w^\262\246v{HT>\025\025c2IX\007\276T\365(3\234$\226\350D\374\025<\345\325RZ\224\350\231\231\0323E\343{+\302\3122\267\346\32669\355\312\304\356v\247\223y/\257\277L\020\033\334M\320\200\231`d\244#\302\326\n\224\365}\217\033\364CB\325\276 \334\210g\344o\321f!\372\327\226}ZsV\341\364_\t\374\200!A\321j\222\356\202\265E'\342\355?\001\335G\350\232YC\013\n\357P4\367\235\277B\254"
+	.ascii	"\375\215V\024#F\002\320\025\310\032\356\336a\264;\263\021TpC"
+	.ascii	"g\241\266\277\321d\306\3538qq\262b\353\242:\300\226\246\274\201"
+	.ascii	"v\357\223\007\032\345\265\276\2609\034\342\261\025"
+	.string	"\216'\200yo,\366\303}c\005o\345\254m`\013\001\033\215\261^\376\367\220\\\305\241\031;\b\036\244F|\206\302?E\224a\377\b\221\271$|g\366:N\234\200{.`\222X\342\223\203 Q\247\372\212w2\301\216\252\311\"\354n\265\237\257\316{6\245t5-e\023\332a\222\306\342\251\205\331_\270\340\233\237\263\032\330\347W\252?#\276\364\354\rn\306\3632 \271\262\020\250L.\\\263\314u\027\222\312\374\336\353\305B1!\226\305\353\351\202}&g\251\262\206\013b@\327!\223\037\306\033\324\b\003\274\\\250\244\247b\003\0259\267\321\242F\217`\364\b\004\325\360\253\336\\g\2260\270fa\266s\250K\335\t6G\317\222\261\007\354\221O\024[\242\004\372\243\334\221t-\022t\001L\021T\246\302-\210\322\371+\370mt+\245\2504\371\2704\202\264M\241\022\215i\206\222+K\330g\256\253]{0\370"
+	.ascii	"\002\272\374\330\230\305*E\206\t\264\025\374)\006\272\201\234"
+	.ascii	"]\004vW\"vz\361T\334\340\006\352\360\001\355\230\312>I5+.>\031"
+	.ascii	"$e\007\313\374\253\3339\272\332\240\3221\244\201\026\230k\277"
+	.ascii	">\006U\013\320j\001\3346#D\212\341\250\373)\226\370\026X\330"
+	.ascii	"\217\357\321\224\371\304\223ot\206D\243^\351\024[\221\250\263"
+	.ascii	"T\031\200\263\311\274hH\325*\226\242<\230\022]\365/\320*\246"
+	.ascii	"\223,\337\242i\020ZO\026\213\003B\243\005\275dB\023.\023\342"
+	.ascii	"-\t\324V\025U!\366EhPNS#e\360\0047\344[\266\354\361\020"
+	.text
+	.section	.gnu.lto_mixerGetInput.95.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"}\b"
+	.string	"\226\020<80\345(\035\2363r\362(c~\303\030\007$\342\016\027h\242\275c\242\272T\006m\r\317\362\254\341\205\363$\321GB\341`@\002\t\032\313L2\304IJz\324\366\2262\245+"
+	.string	"-"
+	.string	"("
+	.string	"\334iefwc\347\004\232\303\367\001\315\241\206|{n\376O\376Z\\1\034\252\364\fp\330]'\207\352\270\365\266\017l'\330v\0050\017.\273\034/"
+	.string	"\373\002[#\2667\233c;\323^`\330\276\322\260\356~\230\260\354v\nF\330\034\332\366I^\262\331\254\327\211\250.\023>\312SD\276\352\320\027\244<w\350\223T\240\225z\375)\200)_vWJ\005\261\377VS\266\246\337W\177f\372\260\300#\330\375\361h \f,\024G\023\022\030ED\254\300 B\361\243\211\242\307\300\231\005H\213\243,\323\"\247\333\277\325\324\323\216I72\256b\326fw\033\002\n"
+	.string	"2\241\271/p+\n6\026\217bb"
+	.ascii	"A\271\206Sb\361P\035\302\230\256I\006"
+	.text
+	.section	.gnu.lto_mixerGetServoOutput.96.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"}\b"
+	.string	"\226\020<80\345(\035\2363r\034 |\312w\354D\b\266\326\2422=R\030a=t\006m\r\317\362\254\341\205\363$\321G,%\205r@Q\217e&\031\342$%=j{K\231R+"
+	.string	"-"
+	.string	"("
+	.string	"\250S\312\314\356\306\316\t4\207\357\003\232C\375\370\366\334\374\227\374\275\270\264\270T\351\031\340\260\273N.\305q\353m\037\330N\260\335\0221\017*\273\250\027\200\205\201\256\020\333\233\315\261\235i/0lgiXw;VXv;\005#l\016m\373#'\331\354\326\353@V\227\t\276\311OD\376\352\320\027\244<w\350\223T\300\225z\375)\200)_vWJ\365\260\377VU\266\246\337Y\177f\372\260@$\330\375\361h \f,\024G\023\022\030ED\254\300 B\361\243\211\242\307\300\231\005H\213\243,\323\"\247\333\277U\325\323\216I72\216\342\326fw\033\002\n"
+	.string	"2\241\271/p+\n6\026\217bb"
+	.ascii	"A\271\206Sb\361P\035\302\230\256I\006"
+	.text
+	.section	.gnu.lto_mixerGetMotorOutput.97.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\035\t"
+	.string	"v\022B;0\345(\035\236\013\371'\360\327\300\340V\036F\337\214\222\025s\260E\376\017\024\374\342\273i\3738\251{\r\317\237\221D\037\261\224\024\312\001E=\226\231d k\254\376\007\331D\312\224\0022"
+	.string	"/"
+	.string	"."
+	.string	"\257\314\033i}\006\004\2652`w#\347\005\332av\002\355PE\336=;\377'\317^\\\004\244T\245\347"
+	.string	"\304\356:S\252\217[o;\301\366\202m"
+	.string	"\001\277f:3}\315\300\025\023\021`\327\343#\2600\020Fb\273\2637\2663\355\006\207\356.\016\353\356\212\245e\327c\260\202\346\320\266_r\223\316\016\207\316 \345S\207>I;\204z \0033\345g\315\035\323\256\251\357X\235\362\263\352Uc\250\002\246\374l\257\224\032b?[e\331\232\206w\005\333\355\351p\037\215\r\024G\025\024\233\305D\274\330$@\321\303\211b\007\301!\214\017\027G\241\020\0277\336>[eA\345\230\364\264q\025\2774\273\373\340\243<E\344\267\002\b"
+	.ascii	"2\241\345/p+j\211\231`\\\023a\261\320P\035\"\232\256\371\004"
+	.text
+	.section	.gnu.lto_getCyclicDeflection.98.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"\005\n"
+	.string	"6\023E< \005)\035 \201\023H\237\f\354\357\342\024\\\222\021\020%\341\354\262\331\021!\346\t\361(\253\355\263\030\375c\276\224?\266\037\b\f"
+	.string	"X\003\310J\222\301\241c\224(6<\331{\313\224\0022"
+	.string	"2"
+	.string	"1"
+	.string	"\237\035J\260\004\366\232\227\207\f\300\356v\n7\340>\345\013\270\317H\362\357\372\371W\271\304\251\305\254X\247k"
+	.string	"\304\356ZW\254\326\035o\233\301\266\307\376C\261[^\255W\237;\200\221\211\240\355\202\334\002\254m\272\234<v\373+>\350\316c\016\277\255U\333\314\207\211\315\356z>\335 \360y\373\263;>\312S\002z\263\306G\031\021hT\265\224lC\343\300Y\336\342\320\207\231\3033\375\352\323\367\214\373|<x\002\332+\004\2457\033<i\034\261/7\272\354\253\347\003 \tu\350\343\2114F\244\316TA1\262\230\350.F R\027\3622\272O\202K\030\"\2573\225J^\327\001\367\362\3215c\216\b*\246\354\360\326\216]\324\202\2143:\274\250nR\001\020"
+	.ascii	"2\203\370\304\300\177\340\223\025\207\037p\017\315\201;\200\231"
+	.ascii	"\317\354\242\324\320\256\211P\231\320\272 \341\324\022\342\232"
+	.ascii	"6\t\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`\346\001\305\013"
+	.string	"T\020\342\002"
+	.string	""
+	.string	""
+	.string	"\002\331"
+	.string	"\177!\270\243\203\020\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\333"
+	.string	"\177\"\200\200\200\200\004\200\005\343"
+	.string	"# "
+	.string	""
+	.string	""
+	.string	"\005\324"
+	.string	"$\201\204\001\334"
+	.string	"\177%\275\353\300\004\200\005\317"
+	.string	"&\005\310"
+	.string	"'\307"
+	.string	"(\314"
+	.string	")\312"
+	.string	"*\311"
+	.string	"+\313"
+	.string	",\316"
+	.string	"-\321"
+	.string	".\315"
+	.string	"/\002\332"
+	.string	"\1770\210\350\304\200\005\305"
+	.string	"1\306"
+	.string	"2\301"
+	.string	"3\322"
+	.string	"4\325"
+	.string	"5\002\335"
+	.string	"\1776\002\336"
+	.string	"\1777\273\375\353\033\345"
+	.string	"8\320"
+	.string	"9\005\346"
+	.string	":\347"
+	.string	";\350"
+	.string	"<\355"
+	.string	"=\323"
+	.string	">\354"
+	.string	"?\002\337"
+	.string	"\177@\340"
+	.string	"\177A\341"
+	.string	"\177B\342"
+	.string	"\177C\005\330"
+	.string	"D\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\326"
+	.string	"E\304"
+	.string	"F\302"
+	.string	"G\001\344"
+	.string	"\177H\377\037"
+	.string	""
+	.string	"\200\200\200\001\353"
+	.string	"\177I\352"
+	.string	"\177J\351"
+	.string	"\177K\003\004'$D\003\017\004\242g\003\025\004b\003\026*\344\032\003\026)\204\033\304\033\003\026(\244\037"
+	.string	"6 "
+	.ascii	"\003\031\232\321\003\204\016\302\375\351Ki\304\\\324\346\333"
+	.ascii	"\210\360](\205\241&\003\311;h5.E\220\2021C\036\334\320\344|\314"
+	.ascii	"0:\377#\354\037\301\343uQ;0sh\343e\3547j#\207\203\201\332a\002"
+	.ascii	"9\364\251\206\307<\346\021y\324\222\324\256p\310\3411\217y\314"
+	.ascii	"c\036\363\230G\344\321\313\244\034r\257\024g\210\252+\330\353"
+	.ascii	"\264\027\033\003"
+	.text
+	.section	.gnu.lto_.refs.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`h\001\345\f"
+	.string	"\306\337Y@ \217\222t\223$a\006C\227Hb\315\342\355`q\023\002\020\t\030B"
+	.string	"\220\240\001 \001\002\202"
+	.string	"\2024\255%F\224\035\316\267;\300k3\004\373h\177\0332\213Z\373\177\263\266\265\326v\263\204\310\024I"
+	.string	"H"
+	.string	"C"
+	.ascii	"}\026+2\277\212\024(\\2\375\026\226\251\177b\372K\220X\371\340"
+	.ascii	"\241\003\007\252\237\001\377\024\252\207\252G\301?\241\272\003"
+	.ascii	"|\023\252\227\3403\230:\002\374\003\370\035\351\267\250g\364"
+	.ascii	"\030\276\205?\341c\360_T\214\201\361\265\356]\204\257Rm8zH\352"
+	.ascii	"\017\244G\301z\003\354AW_p}\002\354\004\262'\301\376\311\336"
+	.ascii	"\203\375#\373\r;'\373\r\366+\373\r\354\231\354+\354Q\366\230"
+	.ascii	"\327\237\324\035\326{u\243\36334\3722bh\376\027.^\254~\013M\035"
+	.ascii	"\224]A\366\002 ?\340\343G\242\377d\367d\027\311\336\331\036$"
+	.ascii	"\373\266\275Gvm\373\216\354\234\354\233\354\230\307_\331-\355"
+	.ascii	"5\331+\355\251\354\222\366\230\035\243\375\313^\355\016\320\256"
+	.ascii	"*\247\037\342\365A\270\003\223\270\314\tp\273\021\267q\001\336"
+	.ascii	"\356};\003p?\353Ow\326\236\356r\221^\f\323\367\202\205\n\371"
+	.ascii	"\245`\365N\260\276\022\362\207\361\222.-\224{\026\023#Dh\374"
+	.ascii	"+*\034\377\206\220_C\366S\262Cx\037\352\364\223|\223\374\222"
+	.ascii	"\f\033\004\001@\224\311\214\342\333\n\224\333\252\255=\234eB"
+	.ascii	"\013\242d\"\020Vl\fO\210\"\240\3627+\250\003\f\005\312\234<\005"
+	.ascii	"\034`@\300]-G\007\007"
+	.text
+	.section	.gnu.lto_.decls.1ea400d35431ee3d,"e",@progbits
+	.string	"(\265/\375`'=\375\006\001\252\223-YY LI:\215\001\317U\3152q\021\347\332G\225(\312\242*\240\242\232\361|'\341\251\210iD\"\002\200\252\nv\024\215\312<t\342w\267\032\032\001\016\267}*"
+	.string	"\262k\020<>YE\326+\320\362s\004"
+	.ascii	"\307!\300 8\244]\323\347\353-\033\213kVKZ\223rK\231\002\307\004"
+	.ascii	"\247\005\254\005\317'yRL$6\211\030\363\t\224\037\317\272\025"
+	.ascii	"{^*\266<\335\254\023 v,\254\034\271m\227\311U\273M\356\3305\273"
+	.ascii	"P.\220\033w\207\\%\327y\331n\222\013v\317\356\332%r\203\334\257"
+	.ascii	"\233v\237\027\311\235\273n\227\312\215\341\276\335\260;\345\322"
+	.ascii	"]\271k\345\302p\275.\331-\273b\027\355J\271On\224\353\344\326"
+	.ascii	"]\270{w\253\334%\267\310m^\273+\304:\257\221\313\365\333u\177"
+	.ascii	"\330:-\264\3475b\367\254\037\332d~ \342\342\251t\304\244\263"
+	.ascii	"X\254`\220Y*D\260\354\235\021k\305\352F\017+G\263\264\331DCg"
+	.ascii	"F\356\226\331\223\311\262\305\337\177\267\320\023(\346\223\377"
+	.ascii	".\031\271)\370\352~\353f\304J!\302\365\334\273\311!\207C\260"
+	.ascii	"F\r\272.F\034\234\312\253\242\257\341\364\365\021}\375\245\257"
+	.ascii	"\257\254l\330\245\272;^R"
+	.string	"\264!9\273X\007\352g\342,\310\305\3272\364\377\213us\334\254\213\303:/\363\332\370\275a\353D\240a\331\320&3h\244\352\205\335\257\363\313\274WV\016m\246\351\027\300`<-\331\f\233=D'\305\334\273y\020>\020\3412o\r\313F#\324\334L 8\251|p\355\335\314\341\300\201\003\207l\343\t\217\016\006_\227\320@\275\324\327[?\350\247\037\354\242\257\f\235_+,C\217i\307\3058\270\247\3553\bE?x\246\037\034\242\037\344\241\037\254\322\0172\351\003\365t\006@'\372\3005}\240\020}\240\226>\220J\037\210B\037\270\324\317V\3643\235~&\323\317;\264\007yJ?\033\351\343,\372\230No(\323\307\\\232\004l\245\217\233\364Q.\372h\024}\024N\277\271g\375~\253\305f\261}\037\220\271\241\002E\334\305\226\213\355r\333g\371\266\355\013aj\357\245\355\253\351\262\367\262\306Z\002XK"
+	.string	"\374\243*\213\f\210\217\266i\013D\347vK\r\035Z\026\254\213\217\036\321/(\020}1\324\206>\n\245\217\226\320\277z\372ur\372i\227M\377\216\351\337\246\316`\207\366\340\262\320\277D\372iX\364\227\314\341"
+	.string	"\355\233\205\263N\rl\334\275\352\033\003[\242o5"
+	.string	"\242\177\177V\003\340-\230\276\334-\r}\213\244\255\022\273f\235\030X\030\376\201\bG\205\206l\257\275\23353~]~\\.\276\035\322\267\030"
+	.string	"\355\237\305"
+	.string	"\370\244\376S\315\246\321\354@\203\202\273\030-\307\252\220{\323r\361S}\304:\355\231\035\362\333<\b\277\316\231\005\263f\027\024\355\275|\021\324J\222\322\267\267\367\316\341P\202\031]D0\2765\373\355\227\025b\313\354\324\336D{\357\n\262\013\0349\304.\266E\254\021\353\264\300\212\335\216Y\262\347es7-^\215!\247\213m,\016\360\216\240I\260\367\337\237\265"
+	.string	"h\303tn\211h"
+	.string	"6=5wML\237\031\336\362b\001x\240\177"
+	.ascii	"]\263\334\"\374j\364iq\200\r\260A\254\227\005\350Q\322\324\026"
+	.ascii	"\333\273y\023\334R\2031\343\3427-\016P[\r\300\343?k0\232!zy\360"
+	.ascii	"\317\031\235\371\357\0068\210$\020\301\217\306\2400\377\025B"
+	.ascii	"_\376;\207\352\377f\370\321\340\177G\240\300%\377\ra\313~\253"
+	.ascii	"\366[$\377]\037\207f \226\003?\212Q{\026~\334v\230\037\257\331"
+	.ascii	"\034\277\305\361\333\254\337\352\370\255\026U\024\f\033\343\305"
+	.ascii	"o\245~+\343\277)pi\361\301\003\337\177\225l\321\340\356\375\266"
+	.ascii	"\351\267(\336\200\037\217\3401?\016\301o=p\025\220w\261\024\375"
+	.ascii	"v\371[#{\364_\274\337\226\370-\221}\341\277W~\213\364\333\244"
+	.ascii	"\026\bx\316\177\f\374\277\340\371_)\327\371\361\226\331\201?"
+	.ascii	"v\241\353\306\177\257.\335\177\233?#\377\313\374\257\326\177"
+	.ascii	"y\374W\307\177s\3747\353\277;\376\353\003\354B\375\027\307\177"
+	.ascii	"\257\376\323\374y\350\277M\376\033\367\337\267\377\256\375\027"
+	.ascii	"\354\277\316\377v\375w\353\277%\376k\364_\242\377.\377K\202\377"
+	.ascii	"\212\340\277$\376\033\342\277\353\177\325\377&\377{\374\257\361"
+	.ascii	"\277 \370o\372_\342\177\207\377\025\376\327\003\377\355\300\177"
+	.ascii	"7\360_\r\3747\003\377e\341\277\027\370\257\005\376+\201\377\202"
+	.ascii	"\370\357\207\377\236\360\337\006\374w\001\377-\341\277$\374W"
+	.ascii	"\204\337r\375V\310\377\262\377)\374\217\373\355\207\377h\377"
+	.ascii	"\311\376\303\360_\016"
+	.string	"\376\313\341\267m\277M\362\333\346o\275~\373\343\267]\277\355\361\333\035\277\235\361[\253\337\256\370m\212\337:\375V\351\267\353o\225\377+\360\333\344o\325\337\206\340\177\332\177\257\377\024\370\357\366\177\346\357\357\357\357\317T~\031\n\374\033\304\005r{\023Q\t=\200\312\211\210\212\305Q\030\325\026\"\302\022\272i\332TBGa{\337l\"\"\241\023\246\366\315Q\330v\332EM\234\354nR\tm\242\251}\263\211\3662\203#\"*\247\243\260\245\323\315Q\030\225\323\016\243\3326\233h\331T\202h7\335\3540\252+;l\312\311\346(l\312\351(\214J\210\275Q\302O\017E_\r\032[\354\334\021\321^R\212Z6\331\310\0355\247v\335\336V\314h7\025`\357\250\251\246\272%\013\2336$\2674d\266\234\262\315\275\267\005JCUS\233H\356Hkjo\255!\237\255\024\202PSn\333\260rB2\242v\222\321\336"
+	.ascii	"P\332[\310n\271\275\267\320\336;\330\024\325\334\033\312\346"
+	.ascii	"\210"
+	.string	"\251\244\264\367S\216\322\216\022R3\332\373\212\331\2459\035\205UM\351\250\025\tc\356\027\232B\226\271\353\250\232t\230\220s'a\321L'\024x8\007\306\201\366(\302\352\263m[\314L\340+TK\023\035\373\342\337\022N\366\232\360AU\231\362\344\031\027\205\253p\fl\002\037a'\274\002\333\300T\370\006F\302VX\n'\341\032\370\004N\201i`%<\205\2270\f\214\002\273\300-\260\f\254\0027a&\f\205_`\026\270\004~\262N<\003\033\375.\341\027~\321+(\226\355n\017\355\031\003\024\335\226\271\267#&\236e{\263\313s{BEA\247pUy\376\2211q3!\202^\233\216\037\332W\206jY\242\203g\340%.\222!D\007\357\2619.L\266X\266\263\347\234\025)L\262,V\216&\357=\305\204\311\344\316N\256\013S\207\357\310\034\312\005\355\263rO\013\370aV\207g\240X\254\234\225\253\361"
+	.ascii	"\257\030\236W\340\250P\261C\237X\241C\341\376\230X\310\262\321"
+	.ascii	"\240{K\211\341\031h\\0K\215K\336\336\336\315\234\rRPM>`t\327"
+	.ascii	"d\351\343\"\266\017\354-\026\344\361\267\204w1\036\3229&\022"
+	.ascii	"\300\2215\265\213\20356\364kX\350\327\024\351\323\360\351\323"
+	.ascii	"\264\241]\360\2127+\0325}\032.}\232\031\3724&\364g\372\364g\360"
+	.ascii	"\364g\240\350\317\310\351\317\260\351\317\234\351\317|\351\317"
+	.ascii	"\314\320\237Y\322\237Y\352\313\350\351\313@\321\227I\323h\035"
+	.ascii	"*\305:sP\273&CKQ\027_fL\227`\377\331\034\340e\202\350\313\\\351"
+	.ascii	"\3138\351\307\340\351\3070\321\217\031\242\037c\245\037\223\244"
+	.ascii	"\017\203\247\017\343D\037F\211>\f\021}\230\036L\332ls\252\013"
+	.string	"m\373Q6t\211-\263\266\350N\211\357\342k"
+	.ascii	"\253\001\210\256\351\034\205\201\306\251\213\b\331\3057J\222"
+	.ascii	"\234\350"
+	.string	"\213\321w\361\321$?\n\206\206\241H4\026\032\327\214\213\325\330\2260sWT\354h\3301gLa\226\335\032ER\306\212\356\314P24\r=C\321\320#\326\211\226\241E\216\032A\305\312P\"ojT>8d\274\274>;\032|\230)ms`N\350\303,i\334\024\033\3239:\004M\203\301\250\213\263Y\225\345\207u\321\346\217~\241BbX\300\240\212rqP\256K\020/$L[[\027\243^_2\203\013\b\220\263\033\006\267\206\344\007\332\305\367T\205\244\353G\267P\256\243\335\251\246\225!\265\213\357\006\253\301G\017+\265D\216\331\003\325Bw\274H]Az\273\030\310c\007\017>\037z\027\353\220\251[\313{\373\323\007!\353\376Ea\2419P\246u\242Y\250\215\2437\320\253[2\034h\026Z\003\030\005\205\325\n\215\377\262E\347\330\351\2778\321?J\303\232!\321Bgd\206\025\220\213\036\022\030\027\313"
+	.string	"BmMua\242\321\247\345\022\323\016mq4\032\"\233\2154\204T\205\276@\247P*T\n\205a\235h\f\024\352\250\0134\352\270\313\321Pg\023\005FtIO\020b\224@c\334>\023sW\206\265Cc\\\276\243Y9\261]\344\344@\207\332\225_\216N\020-r4\330NY\034\340\004=\364_\230\332\306j`\261\002f\213\307\316\322\234\371B\242ACE\212\2277\257\264\273\024(\212\031\263\033_2.\276\033=\341\004\002\221;\242\213\217:\375h\223}b\331j\250X\221\305]\fc5"
+	.string	"\255\026\235\243LD)\310\260\320%T)\346\ri\213\325\305G\225\356\0264\t&\255\nn\305\305H4Q}N\261\213\377RC\337\222\365\2151o\0272\020\376\204p\261ee\314'\350\322\226m\035\224\350\372\2111Q#t\b}\001-\201\232@\213\320#\353D\211\320}T\310\316y\241D\227\317\226\321,\233\273)Xef\244e\277\370\210\316l\360_dh\231\227(\375\027\026\372/N\372/&\364_\206\364\265\237\276\346\3239\333\342"
+	.string	"\321m5"
+	.ascii	"\257\236\316\257\226\231%4\236\027\017\340f\301\240\246\271B"
+	.ascii	"IF\336\206"
+	.string	"\231-P\206\270\260h\240\211\222\224y\341]\321\362\026\305\343\342k\304\202e\275\301\360\344\0221=\227\356\t\272.S10\353b\2701o\t\023HKL\177O\035\037G\230-\252@I\301=\241\242\244<\275l\224\256'\023\027vP\367\005]\034\223&?\246m\342\305\274F/(1\237NU}vS\262\240`\274\221\335\244\022O;$\023\314}\217\222\230H\332\276DX\"\344\251c\344V]\036h3\r\205\241\266\347\363\212\r:\024\\\230Y\254\336\013[\205H\2169\274\032\373\026-\271\331\030\202\314\r\025=\221=\335\005\373i\013\341q\300\006F\245do?\245\330\360\347\272g)k\331\210J^\223\213s\224\257i.cB\234\\\234\241|\355npU0\326\260\n5 o\027?\347\310\t\356q\304\3314\272xn.7\311\341\241C/\351\356\342&\237irB\312\336\022\367\307\345\345\005=\232\370\351m"
+	.ascii	"\262\300\313b\343\342W0\306\366\354\306\226\337\356\223\005>"
+	.ascii	"><\256}\024\265!_1\371R\021\303\363\033\232"
+	.string	"5b7\227\004\315\3668\353\"\27383y\026\213\362\304m\310\305\271\355\271\210\013\024S\264\226\324\210\001\256\002\024\372\025(\351\023y\036#\222\327P(2[h\310f\n\2421\321\022\303\336>z\332\020\343Dr\316\335\264\347\265g%\037\210\360*\\>\240,/\316I\236\221<\275!y\252e$\377\013\f\017\253\260\255;\375\004\350!+\234\234.\316h\257r\265\252$]\2718\237}M\346)\312\036\215|\004\205\253\242\033\2728\223\3452\353\274[6;\r\222\027\306\334\242\350\227\300\336\r\230\215<\213\375//H\244\254\250\342\212\374/A2(.\230L\364)H\002\226\301P%|\263\367\362\r\307%u\361\370\002\362\354\004\222\267\200M\037\330d;\250<_\356\264\334\235]\234\205\344f\376\312A\262\027\0057\272r\227M\003a\263w\225W\332\214\264\345\222\026\372\266\313f\244\347\247\214\224\267t\206\366\022\313"
+	.ascii	"]\316\250\rhL\330\220Rq\261\217\3462\n\224\266\213OA\222\276"
+	.ascii	"\365j\221]PyFMyNe*\037q\317\027\031\312\313\356\231\225ed\034"
+	.ascii	"V\356\311f\023\235\355=sV\206Q\247#\367\310ZyG\306\312\314\314"
+	.ascii	"\303:sV\256\"\312YYJJM\036\020#,lp\213W\271`\350\b\304\327\335"
+	.ascii	"U\316a\235\031\307s\232;\343\310V\371\206\225{j\356\0231G\360"
+	.ascii	"\254<-\3400\203\347\244\316\005\360F\266a\326\244\201\345\342"
+	.ascii	"\\\343.\370\304\302\255\210\312\f\353\3144t\026.5.\257\022\303"
+	.ascii	"v\243J\212>\016\235>\016\f:\307\320O\236/\340\322\364q\314\364"
+	.ascii	"q\210\350\3434\365q\270\364qx\350?\273\310P9\214I\036\\\206b"
+	.ascii	"\243{K\032\312\3229E^\221Y\374/5?\322f\224\321\320\317*\376\277"
+	.ascii	"\244p#\256\354k\300|\342\031\205[\026S\211J?7e\247:\2541\347"
+	.ascii	"\305\307\201\322\317Le\177y-.\316K\332\b'I\003\230\027g0\\\\"
+	.ascii	"\374\274\364g%\373\264}$\376\372\264\\<#\244\363\234\004\007"
+	.ascii	"\303S\210\226|\224\217r\t\020{\212\r4L\255\211\224K\274<]5\321"
+	.ascii	"\031\031E\345\"&b\220\201\226\2112Q^\202\230\302\304\324q\206"
+	.ascii	"\365\004\222w\336y\t\002\003\03514\013#/\275,\364\274D\363`\364"
+	.ascii	"\265\264lUzT\320r\370\371Y6;d3\301\224X\326\350\371xq\025\243"
+	.ascii	"K\027\247\240\0168\270\034*\366n\235"
+	.string	"x\017\363q\240C\215K^\366\001\304\356\351\342-\301-.X\023\230\320\327\300\247\347\304zh\333\206\251}\"\203-*!Q3>\220\264\240\212\313\263N\234\207&\0011\265O\220\020\247\203\312\207e\222\2044\307\206g\235\030\317\312m\230Z.\r\260\205\007\004NW-\221*\242\361|\242\315\227\243\275\2352\330r^\371\355\241*\360\304\222\\|\rQw\267N|\207z\201\230\332N$t\341m=m\020s\204k\207\211,T\250`\256(S\230\230\207\021\n))Q\242`;.2jLkV\260\224c;\215\245c\211\222\213q\235e\273&n@\tb\313h\230y8\204`x\362\304\246eh\022V\231\275\024\315(\003\243\243\263f\031\232>\200\ty\3020b\225\242\307\334\334\016*/h/\250hI\305\305Y\266\3230u-\261\270\370\031\222\336\336,[\316\002\264\356f\266\326\217\023|nn\230\313>1"
+	.ascii	"\354\355iu\340Hq\344\331\346\304m\250\023\260\351\003\030V\016"
+	.ascii	")gHpl\326\211\331\320\256\fM\037\206\202\310%\021zB\262\266f"
+	.ascii	"\331<\b\026\001\313z^+\266\"\251!I\254\023'A{dh\222@\325\r\254"
+	.ascii	"\203\005\025\224\226\232\023\253Y\263.YI\016\032{7\314\254\023"
+	.ascii	"\233a\264\fM(\f\3310\242\373\222\302h?>\202\317P\253;\025|\262"
+	.ascii	"KT]\274!\357\233\030dd\226\315^a7\"2\362\230\304\254\023\213"
+	.ascii	"Y\266\303\334\001\021\273r\361ov\021\353\304EP\245\227#\254\305"
+	.ascii	"\345i\333\246\214\271\3615\2338\f\304^:q\260\025\243i\311\006"
+	.ascii	"z\354"
+	.string	"\313/\311\305\330\211\207X\347\006\f\366\027\242\346\016{\201\202\345\205\330\025}\273\001Xc7"
+	.ascii	"o3\367\365\205\271\332\234\256\032\324\224(J\274\254\023{\035"
+	.ascii	"\r\304.rf\320\025\243\351i\003\215\302\004\020?\261\037N\374"
+	.ascii	"\343^A\217\246\226U!\350\330Q\305\265\267\367\222\r^\336\346"
+	.ascii	"\262|Amma.-\2647\016f~R\245\216\352Y\216\271r\023-,\233\022\372"
+	.ascii	"\030\013g\0353\317\304=\364\336;\247k\356\312oo?=mxy\253Z\343"
+	.ascii	"\241u\334\343w2\373\002\230\346\022\222\333\305\317\202y\374"
+	.ascii	"\177\311iamm<vd\375\260\342\205\246\241\334\256\220]\354\304"
+	.ascii	":\354\0209\274\030U\027\277\006\213\376\357\017\334\313\246\275"
+	.ascii	"\367\211\334\334MC2\267\331\332\r\377\214Em\001\366\376\035\360"
+	.ascii	"\263\367\220_\215<\315\003m\351\342\031\354\347\353\020i\344"
+	.ascii	"\311<0\353\261\210\036\221??H\"\315}:\350\351\200\301\021\205"
+	.ascii	"5\355\2711\016\211>\353\360\247\203r-\266\320\001\350\330\223"
+	.ascii	"\200 \240c\321\230\200\020F\020\216@B"
+	.string	"P\207UyD\0223\317\252\206@\231\217EuUvHw\200\214\304c\261\203\252\004\352@\201\321\bt<\"\217\301U\b\024\201T}V\3441\3103L\215xM\225?\351\017p\002\r#\222H\0176k\262CO\222x\004\2129\362\334\254\024\312\254\302cO2\037{\222\250\317\332sL\215@\254T\246\352\316\31608\"\211$buM\242;\351\261\247h\034\006wR%\020>\"\225\301\253\302\236d\0073#\324UY\354IW\230\340\210\344IO\360\260\246=\032P\3509\026\177\324a\214q\270\"1\260\326\004\251*p\247\230\f\n\217@\003P\366\f\215\037\322\035d\005jV\240\244\222\250v \362\\\260s\034\376\374 =\020\325\227t\035\356$3\020\2015\3150b\250\252&\374\244\253r\004\013B%\005J\025\271\"+\240D\206PS\026\210&\334\304\250\303\324\350A9\243\3247\036R#\320\ny\025~"
+	.string	"\202\013\312a\005\210+\324\244\306b\362\007\351A\206X4\022G\020c\356\323\0011"
+	.string	"*\254\307TU\201\2107k\361\030\001\033%\013\302\343\207\025z\2228'\026\325\364\230\366\350\2070B\002F !(x\022J\360\240\004\017\200'\241\004\035\235\022F\320\321\037A\007\275O\007Aj\207\236\244\006\245\260\247\310sDz\bRa\222\303\037\242\232\325t\247\030\002\251&w\322 \3258,\252\251\362&(5&\201N\3401\016}`\322\235\242\252\246!\220\302c1\203U\030\354\031b"
+	.string	"Y\024\366"
+	.string	"\031\22397k\252L\325\235c\261\005\341:T\n\177\200\324\325\2054\251\f\200\f\314\252\246!\216E\242\272S\374\311\307\342\217v\201\230\372\020\203\206?\272F\351\3018\fqD\026#@T+8\026\211\251\022(H\2151\246\307\343\320\207(\f\002\032\326(qbn,\020@\005\303\020E5\335\271"
+	.string	"\271\002\r\205=\307\"Q\315\331A\026\3254\231\376\fU\036!QU\n\213J\245j\301NQ\270\026\217@3\037\030\203Te\315\252\034\362\bw\200\206-\b\225@-(i\324\243R\030\244\nS%\220\220G\251\022kV\240R8\\\207'(\213A&\354\024\2233?@,\240\353\021\bI\314Ja\022\b\251\242@\263\252\303U\231\327\023\225\302\244\005^\360\0324\f\252i\022\211W\240\344\261\230W\240\344\n\204\004\256\251\222\207\007\t\304\307\342\017\252\024\252\260SL\312\220\360\021\212\030\216\240!\341#\264!\341\263C\343C\\\221\307\365>\035\354\024\2239\037\254R\310\263SL\002U\260\021\260'\330\235b\022\275Y\217)QMUX\217E\244\nI\240\235cQ\003\025\304\210\030n"
+	.ascii	"\210\205\235b\222\306\004c\032\"5\326\254\304\224\207GC\272\203"
+	.ascii	"\374\021\256j\272\032\213\253\360\210$QT\221>9+\210\030\216\270"
+	.ascii	"1\246D\242\t4E\345q\250b`G\035\212P\221\037v\322\224\007\207"
+	.ascii	"\0020$|\204\037(\225\303\244\b\244\361fE\322\330d\b\032\032S"
+	.ascii	"\265\030c\3549\016s\224\305\240\241\260\007\250\205t\247\202"
+	.ascii	"\033\345\217pg\230\372\f]@\"\215B5=\026\207\352*D\252\304\241"
+	.string	"\0056\025\360\360 W \242\320\210T\327#\222(T\2660\314\220&G\254\302\0172\220\360\021\036\213$|~\324t\335\231\200DQ\035\246\307\"\005V\r\253\022\211lA\310\303\243\325\241\017\021\247?\303\024Rc\221\007\251&c\222J#2\251\246\353\261\0304\374\021\362\360\334\254\305\237\242Q\230\272PL\322\250\310\2258\344\021\372\254H\344\217R\310\303c\203L\006\245\3024\204\nD\024\362$\215\302\343\210\235\fGdq\035*\217i\362\007I\024\366\f\225\302u\330B\b\034\236\t\030\221<\023P\301\210\364\3003\001\342\b\017\"\206#\364\252\004R}0\220*\207\020\0201\0341\023\202T\345\021\246J#P\362\247(\344\341\021\002@9b(\3028\314\220\256CU8bHLw\204*RUS\2334Dq%\246F#\222(L\201\210\312T\275\321\307\342\260g\202\364\247\270\246$\212J\241\b\344\316\261(\""
+	.string	"\253\220\204\365X\004\n\222\360\021\252\351j,\362\bU\344:\f\221\032\323\f\253\017"
+	.ascii	"\216L\246j\207\025\211T;\304\254\302\021t\326c1\230\225\302\324"
+	.ascii	"8$*\203\212?0\327\321\361\220A\006R@A\023;P\323\240\342O\207"
+	.ascii	"\325\247\247h\344\351p,\016\177:\020Ue\207\016,8\032P\t\017\231"
+	.ascii	"r\332\310\330\345\035\0213\242\2337OJ\226\r\244\267\261\277+"
+	.ascii	"T\200&\362\262\211\013#?J\344&}Xp{\027\307\244I\215\245x\201"
+	.ascii	"/\315\304\227\r\240\221\225cQ\304\245\354b\340\020\220\350\300"
+	.ascii	"\242\003\213.\260\b\375\373\003\006qb\004\330\327\007\024\302"
+	.ascii	"\013\241\215\216J\311\201B>\300\252\250]\234\377\216\226\235"
+	.ascii	"Vj~G\373\231\263\356\312\253\013\032*E\243\315\213\013\016\323"
+	.ascii	"cwrH\227oMN\310\237\215\213\263^\326b\235_\313{\3150\270(P\352"
+	.ascii	"\270tP\360\317Y0\027\036kQ\243\352f,\3007\246#\274f\223\217\216"
+	.ascii	"I\313\305M/\031&\246\253\251\213\247L\311\317+%\200\275\031i"
+	.ascii	"\345g\266\202N]\2211\224\255\344\273\024zazHO\223Z\312\221\253"
+	.ascii	"\240\373J\211\"D.\307\223'Y\212mj\332\001\205Y\2503\303\004R"
+	.ascii	"\236)9\205\230S\206\204f\264I\032\003\243\024@PxP$\032\222\027"
+	.ascii	"_\017\023\300\322\b4\272\230\305\214\231\021\021QP\220\244\244"
+	.ascii	"PXv\0037J\"NJ\340\261\"U\253\003\b\223\215w\260D\036<|R'\204"
+	.ascii	" \363\232\275\027ep\343`\304_\030\341\2170\026U\360C\324\017"
+	.ascii	"1.c\265j\267z\355\0220\362W\307\332@\205y\371\231`\274y\314\311"
+	.ascii	"\230#Y$D]\224\r\257\201\205\344\246\325\017#7j\367z\310\323\353"
+	.ascii	"\035\373\021d,\034\265\337\367\245\317)\240\365\365\302h\227"
+	.ascii	"\240\2233\352\277\310\317\347\265\316C\311\367\206P\225l\205"
+	.ascii	"\353\f\375\225I''\274\332\247o5O\263\236\003)49\231\260T7\311"
+	.ascii	"^\272A\022\320C~R<\013\213)\364'R\277\231\224A\330~KP\200\004"
+	.ascii	"\241\374\344\347\346\3703\227yz\032BI%:Yaf\234<\021\234#H\035"
+	.ascii	"\030\341\251\263T\244P\275^\t\001j\\\376\366SJ\327\304\251\303"
+	.ascii	"\t\003\376\344"
+	.string	"\300B_\364\307\251\365J\2314\234\245h\310\206$\301[\317kS\336\303X\206\272\027\322\372JZ\"\224\322\306BHfP\371\002\024\352M\366\247\241\237\253\231\303\364?\205\347\240\331K\321\005j+\234\r\271\250\3025'\252e\377\265\032\260\324?\302$9E\241\356M\207\257\354,6<H\360\340\266\371\255\3150\004\373,\007f\037\003\306+\024\030b\222y\342\263l\264\371\213C\203\214#\203&H\361p\230\261\f"
+	.string	"\332=M\245v\221GY8\325TK\364\320\265.\316\315\250\267\237\226\004\367_\300\360F\374\001\215j\227\230Y\207]\305\220\003y\245OP?\263b\210\020"
+	.string	"\212\027\223\321\227%\214\211;\207VF\326\001\244\253\324%\211\227\\\314J\367\252~\262\343oV\326~\355\260\355\323\235t\003b\005^\255\355\274\017z\002V\344\032\265\261\332\026,\001e\364=\350\355\032\204\2245\006\272\030\207u=\322T\313\223\356\n\317*\253\256i\"\351S\205\264\305T\207\221\2419\307<,\032\346?\035FQ\270\320\345\372\022R\331H\342O\030\254v\341\322\024\321hd\247&\222\240\377\372N\377'"
+	.string	"\001\317\207\374-\202/}j\231J0v7n\006\177\271\002\204\254\2420\007\254\037&\2378_\210\214J\273=N\317{\377g(\211\225^\237\030\322\304\002\217\177\357\f\0073}\211\203\307M)\323\313\t\300\001\371\315N\330\206\326\253t\2618b\373qy\347,M5\217\300V\236\302]q\220KG\335\213\351\323\263\273\214\036\222\373\323\245=\350\315N\327\270v}\306+@\306\263\212\307\024\240\031\204\300\303V\305s\364\246]q\260\202\364\272\177u\223K_\347\250@R2\021\034Pt\266\254nL\024\2364\244\016\337\365"
+	.string	"\255\200ac\220\3770\303&\r\227jLu%\n\316\227y\311\376\005\033\f+\256J\033h\263\264rC\352\330\240\r\335~\032m]\366\314B\312)Z\250T\350\210\374\032-"
+	.ascii	"\004\031R\334\fL\003I\317%Q\021&9\230rN\261\004pLp\224\225\315"
+	.ascii	"\262\256\263\212`u\276\342\267W\274\352\003[\345\204|\362\222"
+	.ascii	"\337Fe\225\273\254\255\310\334g\b\035Vg\035\366\021v\252\004"
+	.ascii	"q6\316\214\371F\300\225\254\212\321\374\263\3232;\317\275\037"
+	.ascii	"#\305\320z\214\330\245\303d6n\261\350\336\243\371?L\212\270\240"
+	.ascii	"D\252h$\222\004\210\3051\331\337\325y'\323Q\360\\#Ejwn\033\030"
+	.ascii	"^\004\353:a%A\344\262\225at\301\013\327\3224\251\214V\337\241"
+	.ascii	"\316\021\265\216\023\356*\270\204Q\216\031\274\fv\317\323\240"
+	.ascii	"\262)b9`\341>x\241\211X\341\022\013\320+\336\246wP\247[\346\310"
+	.ascii	"\334\340~dh\213\260p\3229\330F\002\316\020O\023\351\200\202o"
+	.ascii	"\203K&\n\033\364\315\207V%\324\324ZJ\312\312\rQ\344\364\246\332"
+	.ascii	"\314oC7)\305\205/\362\221.\354\322\307\006\r\361\024J\251\305"
+	.ascii	"D\265\024\336\240\030R\315\f>\363q\256\017\354\244\232\341\316"
+	.ascii	"'u\301\003gf\037\006\335r\026\362.?\261\236b\316\030\355\215"
+	.ascii	");HJ\326_\3552\306A\234"
+	.string	"|zAdl\327\273,\017\210}\302LB\t\001Wud$H\337\216\362#\003H\245\035\023\223>\002s\021\027<\203\3100nv\246\250<di\372D\3171\226\344\203DUc\201\212\312\256\212A\317J0\377\271\"Pk\234\343C\221\223b$\246QtS\306S\027\3213U\3466?\266\207Nz\033\314\247\023)\313\371<\364\320a\312\300|%>\277\343\214D,\211\241\206\261\022\335\310\036Wa\373\364t\235RO\306\231\241\362d\220\205H]\224+\004\026\237S^\315\002\373\220j;'\251D\300\013\t\353\273\375Y\366/\204\302\23599\\K\005\224[u\314\020Q\"w\313\377\315\370\307H\035\332\334\215\264T\247\234f\277\213zX\272fi\254\213`\213&\315NV.\260G1\253\034\272*\tv/j\263\2072\037\374\217\\k9-@\241%ZY\025\312\3508(X\363\306fk^\200tB\236\004u"
+	.string	""
+	.string	"\233NU,\251\336Bi8\372\310\222m\326G`E\317QuKei\035\255R.\240\263\033#\256E^I\330\314x_h\026O\223\021s\375\302\253Y#\331\245p\213\341\3350r\217\327\350bt,KrE=\240\336\"?\336D\214\020\025\236j\001\333)\226\354-\256m\213\267\357\326m\370\227\205X\205\335\307\203\021R\233\361M^}\213N\247\241\231\f\317\006\f\271\023\245/\237\001\325\266\205\374{Vj\241Y\345\365\311\267h)\222h\330\226\261\342\3026\210\275\226\230t\030\325\342\2020@\245\222\024\252\252D\225\nDv.0\365\333&>\210.\020\214S\377Y\346\"\365!y#\252.$\315.iI\312\006:\351\205X}\325q\\\306\256IK3?D\312\243'\340\035#,\231\265\306\f&)\211\263b\253\364\\\302S\334\205D\203"
+	.ascii	"\343\351^\214\337\350\263\"4/\330=\263\361\371\222\256\003,\310"
+	.ascii	"\003\323\254\211\032\213k\214f\334*\016\277zQ\237\224\256\333"
+	.ascii	"5Q\323o\0362j\2228jd\377:\nUeu\250!\327s\250@\252\226\307\354"
+	.ascii	"B%\200\372\354;\255\004\344I\343^\354\303\324XD\212\265Y9\317"
+	.ascii	"\001|\257\362K\361\025lj\2635\303N\334\313>\274\374b\303\346"
+	.ascii	"\316s\351a\030\007\335/+"
+	.string	"\"\231\250\024\b\023\360X\315*\241>\327X%y\335\354\341\006\315mR\025\032\250S\305\264\353\245\235\320\017\t\236?\333\331|<\341dX\257\243\304\305U\245N\271\300\345D\261\364\t\310\325%\215\203\337\357\376\256!l\216\233\353\330\254\265\334\017\r\300\301\355;\365\326\370\235\230\262N\314\243\213\332\034P\253@\312\257\307\006\324|\304~9Hy\002\177f\035\006\024\211\002f!\253\205\rD-0\305B\226\224fY\277\344\255\322\307\214\255\230\rG&\035\335\333X\310\336\b\035\374\327\200\037\255\351\242\223\320\350\306|\334\353\327\314cy\373/\371i\200ZAd\201\006\364}\305g@\364\241;\004IQ\273^F\307Z\213\016\365\321}\303g\331\277\312H\357\320\036_Z\006Z\020\277_\025\230\337)T\271i\273\035\007\237\021\217P\322Ek\331\303\275w'\267C45\215\003\273U\352\271\224\313l5\036x\3401l\355"
+	.ascii	"\024u7Q\273\344\361\210K\333\bF\307B\340\364\220,\307\326\371"
+	.ascii	"5\362\273\331\242\322\317\347\221\306\210Y\025\274\203\363\024"
+	.ascii	"\340\003\210\260\260\013\366\036\177J\354\224\237\307\314\240"
+	.ascii	"N\242\222.\236\372xxA\344\256\361'\247\003\221|\037Pg.\216\225"
+	.ascii	"\333\321\203\302\257\212nQQ(\265\250&\273'c\220\027\254\374\""
+	.ascii	"\201\220&:K\007~\371}!_|d\002\311\342/_\270\334l+\243\32505O"
+	.ascii	"f\261c\016\330\237\340ogp\335\307\362yA`E\247\017\007\266\f\006"
+	.ascii	"\b\240\245\037J\253\310\271NI\025\353\202\006P\344 I\035\242"
+	.ascii	"^\242g,f2\272\211\346\1776(k\211hx\312vD\215\306*\f\374\326\320"
+	.ascii	"\374\247\276\253\324\254\332\020\2505\363\342\356\304\255\362"
+	.ascii	"\320\030\245\375|\210\303j}\223o[]{\213-\335\247\2468G\225\363"
+	.ascii	"\257cn\200\327J\267rn`\274_\211g|?\276\377\351\235\004\300\225"
+	.ascii	"\270G;M\274=\247\342\374\324'{\373\177T\032\277>\311\241%6!\213"
+	.ascii	"-\320\024\030\273\350\202^\026F\202"
+	.string	"\335N\2171\3730\321\203\026U\b\005\301?\362\212\0378\250'\375N\034\216\256f\372\037\036\263\314d\246\0279k\032\177\002\335T\203N\240U"
+	.string	"\003v\364I\333[\376\007b4]^\341\2359\337lVp\036\271\247\272y\2051\207ke\2173\366\326\215\330*h\257\263\"\263\200<\277\0179|\350\303\017bg\003\362\bmw\315u\261\206\3208\205n\334\004\343\226\343\213ss\253\244\006\263!\272\272x\033'\320g\223\036\2637o\017H'\236\001:\021^\036VB\257\342\035.\360\031\336\267\270\326\331\313\346s\272\375\302\255\275:\367\347\355\236\346\215~m\f\206\311\361\325\273\f\365\207\307\027\004\013\222\r\366\033\260\363\236Z\367M\266\373\007\206\177F\375c\214\347\257\305\321\205\374\030~!\224c,\317\t\23247\272\016\274\026\362\337sl=?\370\206\206\315T}\300\207\323\017j\277?r\263\254\275J\336\237\256\330\f\347\006\324\205%7N\246f.b\027\177\033\023\253\377x\3736<D\377"
+	.string	"34\271!l\330\377\020G\211\221\301\270\302\177\253p\222\366\261\370\302q\252\321\237>\360\317\007\247\035\376w\177\2133\210\267.{\035\304\261\017\210\372\377\223~r\331!\301gw\t\345p\203\031"
+	.ascii	"NT\177Q\263`\376\242\300\373\343\365\241\376U\376|\254\326\037"
+	.ascii	"\270\313\002{Q#\336Kbt\376E9p\271\337}\344\367\212\177\262^\276"
+	.ascii	"w\376\217I\361\027iF\274\346\270\253\3361\373\336\375\243\244"
+	.ascii	"X\234\017\263\305S/]N\355\033\0060\216\327I\316ZW"
+	.text
+	.section	.gnu.lto_.symtab.1ea400d35431ee3d,"e",@progbits
+	.string	"pgResetFn_mixerScales"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"mixerInitProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"cyclicLimit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"mixerCompile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"mixerRcDataMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"mixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"mixerRuleCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"mixerOpGroupCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"mixerOps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"mixScales"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"mixerOpGroups"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"mixerClearCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"mixerOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"mixerClearOutputs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"mixerActiveServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"mixerActiveMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"mixerRules_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"mixerOverride"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"mixerScales_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"mixerSetInputScale"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"mixerUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"mixerInput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"cyclicTotal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"mixerGetInput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"mixerGetServoOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"mixerGetMotorOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"getCyclicDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"mixerScales_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"mixerScales_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"mixerRules_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"mixerRules_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"getGovernorOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"governorUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1ea400d35431ee3d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1496 @@
+	.file	"motors.c"
+	.section	.gnu.lto_.profile.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\007\001\365\b"
+	.string	"\364\013\373\001"
+	.string	"\034"
+	.string	"\326\315\303\310\t*\002"
+	.string	"\001\002\002\001\240\342\234\212\n\003\352\341\254\260\003\006\002\003\002\004\002\003\002\003\002\005\002\005\004\005\006\007\350\300\306\254\005\002\b\367\345\320\200\r\004\002\005\002\006\t\n\260\216\270\207\006\f\255\233\217\330\n\002\002\005\002\007\016\374\331\375\236\005\005\017\020\235\311\321\330\r\006\002\b\002\t\002\n\002\n\021\377\271\221\341\n\003\002\t\022\223\277\216\251\017\001\002\t\023\256\327\371\240\n\020\013\f\002\007\005\024\304\254\352\344\004\025\262\331\235\270\013\030\026\027\030\031\350\235\364\334\013\n\004\003\002\003\033\275\333\243\260\006\024\r\002\016\034\037\345\276\262\366\003\004 \317\310\251\201\b\002!\275\232\250\335"
+	.string	"+ p\002r\312\330\001}\253Eb\315\364d\031wG\233\317\006v4\314"
+	.string	"I\302\022p\352\275\3504\333\245\205\231x%\r\030\021j"
+	.string	"\253"
+	.ascii	"\205\200j\367\327au\036\220\331\2501\036\327\017\017\013\250"
+	.ascii	"\2309\225\023\021\254;\200\017\216\265\220\327\003-K.?&\243E"
+	.ascii	" \327W\\0\275(C"
+	.text
+	.section	.gnu.lto_.ipa_sra.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375 \277\365\002"
+	.string	"\"D\f\024\260\031:\f\3030\f\303\034*+m\3135.\0047\271S\n\256s\263\214\276\354J\242\273\310<\2126\031+F\220s\230\302\f\346~;\260d\371\004\022"
+	.string	"Y\325\270\031h\227 \246\321K_\224\205?\337\365\n1+\013-\r\0037@`B\250\032\363j5\271\006d\006\216\300"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\305\002\215\017"
+	.string	"\226\027UC"
+	.string	"\257(\215\001\220g\313i\336\203\252\207\030:\207s\013tP]>90\031\210CgXW7N\242\247\0354@\322\377\304\254\375E\374\377\177\353.\353\257\2735a\024\342\357\354\341\236O\232\215\266lK)S<"
+	.string	";"
+	.string	"N"
+	.string	"\037\034\027\371jJ\021\335\007G\266\036\342\3601S}\324\336!\356=z"
+	.string	"\274II\"\262\232ip\236\033\271\273)\315\233tk9Q\002)\350/ q\\O\331\251\272\223Y\036\264z\b\036\354\215T\365\376O\"\346HJnw7g\377\235\3344/\302F\032\022\"\203b3g\003\314H\312'\037M\t\0023\222\322\031\373W\363\032\231\371\270\241\273\273\357"
+	.ascii	"\377\204<\351\002\370)S3\255W\204S\266,\253\345\340\001.\017"
+	.ascii	"\r \253\035VXZ|p\224!\266\016\022\332\027\032y\341\003k\205J"
+	.ascii	"\023((\035\236\344D\\\266lP\376\332S\026\0250px\312\352\\ \f"
+	.ascii	"\214t\204\207\212W\306\037\t\250\\\216HU\001\347n*/\233\025<"
+	.ascii	"\f\244\2424I`\222\"ie\245,A\275b\264\021 \203T)e\\\\) XX\221"
+	.ascii	"a\345\301\007\0369x\210[IY\262\251\274d\224t\205z\305`\\`\001"
+	.ascii	"I\271\335%0\306\217\235\374F\250\321@\204\f\202\210l9\315\262"
+	.ascii	"\006\240\002\031!+\017\021 \031C\n+\242I\n\205\306\375\005B\353"
+	.ascii	"\354\230zw\224\301v\226\310\3766`\363\220v\303w\t\261\256\322"
+	.ascii	"_P\311w\"\223\336\247\325U\037\351NPn?\312\037\207J[rE3HU\277"
+	.ascii	"\273\353)\373\314\231\017\021\245~O\371\356\2178\374wF\257\021"
+	.ascii	"\202\2020p>\304)v\3533I\300\225\364E\377\034\335\023\306zt\031"
+	.ascii	"\220\301\002{\016\312\223\364\346\031p^\310\377W\323\326H\260"
+	.ascii	"U%t\351;\351g\215\263\016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`0\001%\007"
+	.string	"R\313#,\200)I\0073\260\fQ>z6\036\203\231\020"
+	.string	"\274\027\f`\300\214h\245m\223g>\252\007\373l\261\2555\333\332\327\354\266\215H\231\002\177AC0\0041\341\332\037"
+	.string	"\250jC'U}\265\326\032'\262\202/`\321\313\347\346s\245Z\265\366\320\021H\2410#^`(!\310P\367\001\277\344(\342\027\327\347\001\353\020q\032\305aV\231\"!\314\343w\374\362\215W\263\261\234 %x3JGJW\316\252LS\231\370\213S\266\312\026\331\233k\020# `B\243\326\003\237\025\"Pwel\022\304z\262\3644\277\326xCh\007O\233[\002,\360n\033\225\213\341\371qS#\001}\006\233A\243\023D;G\337T;\203\016k\2133\016{c\267\201\r\215\313r\244\224"
+	.ascii	",B \312X^:>\r\f\001"
+	.text
+	.section	.gnu.lto_.pureconst.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\003\204\004\007\204\004\b\204\004\n\204\004\f\204\004"
+	.ascii	"\016\204\004\020\231\004\021\204\004\022\204\004\023\232\004"
+	.ascii	"\025\230\004\031\230\004\033\230\004\037\230\004 \230\004!\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"e\004"
+	.string	"\"\306\023\037\260'\303\001\f\303\202!I*H\306\025Ru\001@K\244I\357\246\265\365n\203\335\230%\231\0022\032\216Eb\0022\243[\230\3472\342\227S\236\312\356\360\\_P\350$\f\222\002=\315\002\272<\217\323\214\324\271\3644\354\324S\275H\200\032\t\030"
+	.ascii	"R-\3011\340\372\262\026E\270\251\265\257\306\236`\341\317p\027"
+	.ascii	"\036\335B\326P\261b\202\0160\301\243F\\\225/\247a-\244\275L\234"
+	.ascii	"\031\342f\370.\302\230\261@\300\003(\002"
+	.text
+	.section	.gnu.lto_.lto.d1f96923951658a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getMotorCount.69.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375 \346}\006"
+	.string	"\002L-4Pm\222\016$\217\250J\250j\272u\001\006 \302i{P\032\354-\331U\373w;\314\265\235SX\034\030Cff\212D\334\333\005a8SGe\273Y\262e\ng0\234\352Yo\343\254\005\005\rC\202k\320\034l\\\246\3428\314\345\347\200P9\353\275\312Y\262l\033a\013"
+	.string	"5\210oG=\256\253\361C\007\213u\272\035\252\0236"
+	.string	"\n\020\226>\373`\273\370R\262\215~\034\033UBr\001\311\f\225Nrd\022!\375\236\267LP\340\371j\226\021\242,H\021\037&\231\231k\030\275\212\327-G)\033\025!\230\350S\254\030d\346\210\211&z\353/\360\017\374\022\001\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_isRpmSourceActive.70.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\\\001\345\016"
+	.string	"\226\334dE"
+	.string	"\223\223\016\273}\374\021\333n\311Q\274\362\366\260\f\2177gcJ\347\234\t\321R\200\033\245sn\244f\003\354\326R\371\036o\206\235\336m\026@UU\357\343=+\306"
+	.string	"U\013k\030\002*\2714\023B\366\2262\245Q"
+	.string	"N"
+	.string	"T"
+	.ascii	"\356\030A\002\222\275"
+	.string	"\203%V.\342\005\305E\316\234\340\266$\254\217\340-\325;&\343\252\347\227\216\205|(\225\357\244\322\205\34516\200Ya\"\344;\211\313\net>\224\356\301+\214\232\023\016\327\307r\315H\346\234\326\224\217\303\235\335\266g\333c\177D\256]\225\r\226T\301\r\032'\274);\263Z~u\307U\257\252U\325\327\030\250\310\341!\242c\316\225\027\220iC\322\244\370\352\366_|\320\035\037\3461\244\257\034C+m\320\302V\314\2169\247\347\322\006\264K\002\027\200]\306\007\300.o\223\034{\224 \017/\023\362[\f\3428\354Rw\300M\007\223\276\036\347\234S\036x\334l\377\301C\017T\210\223\276\364\005\210\324\214\270*\207\260o\327\2729\321\037\032\336\"\244\3159\027\370\254\267D~\313\2453\230\350S.}\223=\370\002.5>hL\372Z\233\034\254\237\273dD\324q#\016\264\215*P\370X\230\260]\370D"
+	.string	"m%\235h\033\0211\207AB\267\2158\256\333\300\371M\371,\376\300\306\025\316\310\337\303\016\036\202\215L8\263\276\207I\271&1\355\t\005\266*\003\300\211\331.\216z\036W\305\266\343\356:\250\241\273\001\034"
+	.ascii	"[K\360W\235;\332\fR{\267\3062\023\023\236\033\362\003+\204\266"
+	.ascii	"E\205\340&\033\364\305\302uL$\230\227\240\335\0269b\211\242\013"
+	.ascii	"\t 6p\005.\005T\013UP\327T\363\236b\237\n\332T\324^\327|\002"
+	.text
+	.section	.gnu.lto_areMotorsRunning.71.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"%\f"
+	.string	"\266WUB o\224\016\003\025\t\300\t\304\220N\001 r\2340\313\365\341\205A\377\036\230\373\026\024\026\272\005\332\347[$\331\231\233\366\234\322T\353\f\252L\025\233\216\rI\214LZ\001\350c\021\005k\221\277\311\2262\245B"
+	.string	"A"
+	.string	"B"
+	.string	"\361#\333\342\001\004F\346>3x<%\3024r\"\345\314\026\003\247\334\341*\347\003\360\272C\354\343\0137\250\024\037\027\217\0041+R/\256\272vx%\325\212GJi=y\025\356\353\266\017\330\346\330G\020#\336\020[\325\321jx\326\275V\253\252_\271\240\240,\244Fl\213)=RP\244\212\253\244\303Y\267\277\362\347E\356at\226KhJSz\006.\220X\235H)9\277\274\301~i\216\211\277\340\003\004\306\324\216\020\322\237tw\273{v/`\202B\303\356\347L\214{\3251\223\226\213\222\302\360\237\211\337\270V\023\b\351\037\336\222\340o\360\204\r\375\351\227\277\261\034(\254P\" \034\232b\317N\367+\211\361\005\240;\243\023\3324\221\246\221\211\0320"
+	.string	"9X\220="
+	.string	"%\320\3102\266P\326\021`\r\202\202-\023i\332\226Y\246\374\206\370\252\177X\230\bA\242?\027\275\272\320p\355\341X\022\b\270\237?\377i\2350\221(\347\273\035\016\020"
+	.ascii	"j\b\330S\323\222\006\016\007+\020\220\031Wi\204\211\205\3405"
+	.ascii	"\341\273\314 \256\002\352\202I\326,f\260\f\\{-B\323\030\024\024"
+	.text
+	.section	.gnu.lto_calcMotorRpm.72.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\016\001m\r"
+	.string	"&\033^B\020\221[8\035VF\f\205\275\250\f\303\330l\216\301\235R\221TA\303^M\017"
+	.string	"m\213\274\272Z\213\230\205\037\354X\255\316\334\261`"
+	.string	"*\024\001\306\005`\274\033\261\n\002\r\035$@MDD\210\224)\005I"
+	.string	"G"
+	.string	"L"
+	.ascii	"\266\201"
+	.string	"\003\337Y2Xw\303\025\230]1\304\003\260W\266}\023?\361\331#%\252\214\216B#\204\"\307\356n \007`\275\242\356a\275\322\020\377\236\237\377\322\251\033\341\f\321\350\344y-\330]\247h\324\341\326\333\026`[\201\3750\027\177\354\244\373:\313oe\232\322\264j:3}\355j\021\343\203\305\356\206\223\216\205Q\305\2148\351\366[l\355\366\347\227\254\331&y\304N8`.(5l\354.\201WN\220y\321\243\263\335\017.`v7\304\"\231\001\2246\bg\200H\200y\262\352\245\177\t\231\n<U\365\032A&\320\306\360\025\234\006\201\335]\205\205\017\225]\r\".O\321\361E\274r\211I^\364\3127\261^\245f1\226^_\"|\0212}\362d\213`*\b\373\324jJ&\323Y\0278\020\224#\3616\224\267y\300\2250\320<\242\351x\235\247\3436\317\004\t\034\n\021\266\n\034\007\3346\342u6M"
+	.string	"w$\033o\363t\235\267i\342\347\324j\212mg\024\344\243\2403\2454\243/\335\343\005\264\002^\232\351[\236\036v\200p\310\270G\013\323\023"
+	.ascii	"i\221\"\023oQ\032\230\252\243B\325\030v6a\267\227\375\333\334"
+	.ascii	"1\346\002.\214w\263vu\350]\267l\243\236\365\n\267[%H|Z4\265\363"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_getMotorRPM.73.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\275\013"
+	.string	"f\227Q@ q\223\016\203d\302\002`\361-\\\\\356\034nhB'@4<\2009\346 \030\024\251i}\333\206^d5ij\355\210t]\023H\002 \314:=\367\335I\205)\030B\021\324F\310\336R\246\024>"
+	.string	"="
+	.string	"A"
+	.string	"6\f\267\211\310\016bF\007I\215\335\205\227\023\230\376\334\007L\177\032\342\330\235&\346\207\3568\037&\244\214\3035@\306\341.\273{\355\351\221\2152\251\314\356:I\331\206\373\335\266\003\333\320\376\203\241\324\020\373n\025\204\372\310?e\332\271\264f:5\375\n\205\"\303"
+	.string	"\213]\r\245\224\215\361JF\330\306l\213\355L{\001\003\354# \353\256\007\022/v7\005FP\371\263\355\227\270\t,+\354\242\262\273\r|\025'\251|\221?\307NG\001\224L\232\312\3710\351\270\221\273\033R\r\361\244\327\b)N8\022\305\376\211\243"
+	.string	"\371\"\366|\362\244?\3773\375]\257\375"
+	.string	"\215\024\033\035DY\262\267V\274b\365\254\301x\254x\305\n^\025(l,L\200\0276\020*\250\261<\020S\300\221#\301\202W\214\026\264l{\005\361?h-2\301\257]\200R\352\324\303\266SgD:r\252\224>\303\211(K\030\036\021"
+	.ascii	"\021\013x\241\r\317\330^,4\002\326X\302E\332vD\261\016\021\177"
+	.ascii	"&d\026t!\367\031\303\321\332E\252\230\025\245\322aT\343\233P"
+	.ascii	"\312"
+	.text
+	.section	.gnu.lto_getMotorRPMAt.74.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\b\003\325\027"
+	.string	"&\255\236I\300\026U:d\034\305\3407}_i\374s\007\343<@\342\376\023c\340g\267(\243\201\0027\323A\225P\250M\270\030\241\325\343\235\311>\330\004C`lV\024\245n\263\316A\226\362,\304\026adtY \347Gd\023)e\n\206"
+	.string	"\200"
+	.string	"\224"
+	.string	"$\376r)\377\264\277\374\337\274\275\022'k\335y\262\200\371g\320\200\266@'\336\265\352"
+	.string	"9RkO\301\021\224\226\376\377\372\330\037\264_(\366|x+e\210\023\302\245\326j\322\354\314\270T\\\324\270\264k,m\251\330L\373\242X\372\300\2060\247k\261\242h\200G\306Q\251\263\2114M\242\340N\272\034n\021\201\216\023\026']M\234)\242ae\203,\247\320\3450\223$\324Z\3179\335\212\375\270\3773\374\217\375]\023\315M*\202\373r\362pyhK\321\214\356\236\237z\273\303\357\211\215\273\374;d\211\234\370\362\376\301\305\233s\215K\2677\310\246\262\004\035\2758y\370\367j\334=\377\212\265y\216\"\3712%~\314\366va\026h\367D\362K\222o2\361I\222_\"\371\244\022\177d>e\276H\3427\363y\344o"
+	.string	"\223\216\242\003\301ZU\f\275\324(\224\350\306\027\270A\234\365\275\204\363\375m\020\211\365\235\344\013\226\001\247po0\256\354\352#\f\207Ll\265\236)R\227zo9h\223|B\277)@,\tVl\332\347\233\321\306\330\355\225\214\250\026{\203+\366\340\365v\340\200Zj<|L\243Z\300\026\334\227\261a:\2467hS?7TL\001\342\250\035\303*\311P\263\023\344R\253-\t\007\230\023\310\203h\221h\030\227\216]\263\023<\332\036\027<Nq\304\330\275F\277*\337\260\302\021\020\250\324Z\035\3747\261F84\360\251\265>\020\332\"6_\336\322\257X\254&\201N\001o\251d\255\231\315\213\300[*\326\31353o`\257\027l5@v\201\365rY\230\335\260b1\234\025"
+	.ascii	"\372\225J\026\203\315`/s\326\372\340\n\341\301\274q\331\274\314"
+	.ascii	"ULf\252\n\034&\202\0253g0X\314,{\3476\317w7\364\303\013eE \321"
+	.ascii	"\021e\310\335\320O\227\235\342\177\331\227pv\215\n\377s\312\324"
+	.ascii	"2\2757\243\001\\j\262\377\t\024xs\246\246\311i\024\377:\001q"
+	.ascii	"\362\251\325\266\271\277\3026\271P\022\t-e\262\204\354\315\271"
+	.ascii	"\b4 P\002!\304\264\016\235\257'\265\232~Z\241m\267\003\360\027"
+	.ascii	"\336\363\374\347l\366g\363\021x\024\336\257\275\025wW\227\224"
+	.ascii	"\237\314\224C\326h\f\234^\2716\244\326^\255-C\233\306\21421B"
+	.ascii	"\020=\036\310J\265\301\201\213sR\206\021\250\322\024i\331\200"
+	.ascii	"Z\"\274\361\241\215\242o\2577Q*\341\236]\"\022,\364'(\304\004"
+	.ascii	"\357\205m\321\3060\266V?\313\2160n0\304\345\024|\321("
+	.text
+	.section	.gnu.lto_getMotorRPMRate.75.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`a\001\025\017"
+	.string	"\326\034fF\340\262(\035Rw\035\302\305@`\007\020em\013\247\245\n\332H\316\032Z\345\337\261\352aY\345}\334A\254\026\236\355Q}/\325\252#>\2173\306\030c\263\206R\240\242s\020\0130p\210\267\237F\204\354-eJ\001R"
+	.string	"L"
+	.string	"W"
+	.string	"\366G\234\204\311\226A\030\253\365\033\032frz\354.G\340$\332#|"
+	.string	"\355Q9\334\364\b5M>\314\343Ct\220\221\3620\034~\274\230\021O&\025\232\330\314\2700\342\241 \311\316\206\236\277\2364\236L\346\246\262\273\316\224g\341\326n{\201m\316\276N$\355\361\372\327Kr\310|d8\345g\303`RW\366\365\373\276\317zc\307\364v\327\257\3054\204i\315tj\372!"
+	.string	"b\354\030\340\261[\341\003\2626\"\214\017\266M\366\307v\246} \305t\327\213u\327\346\345b\027vb\223\220G;,B\003xVl\372\0011\023\361\032\250\0221\350\242\251~\007\016\016\267\\\205\213\002\236\335E`\233\302S\204RX\273\233"
+	.string	"\305s\036\370\255G\213\272NE\\\232\246n\261\231 \247\374\236/t\354\250TW\326\364\312"
+	.string	"\207FL\376\260o\342'^\374\226'\220\362\251G?\243\256\324\211\242A(\244QW\352D\\\311AK\bB\003.BhE\304\201F$\016E\200;\t,#\256\324u#\356\003\333\303\325\033_5\253\311\267x\366\314<\300MD5\253Q\313J\240\322\330\206j\225\223\242\fww\243\256\274\362\230e'\240\353\260\024`=\006\034"
+	.ascii	"L\204\376\275\261&6\f\261\215\032\264\220Y\004\230F\302.X\003"
+	.ascii	"-\001f[H\360\202,\bP\343\226\327,r\206\3066\213*\350\002\375"
+	.ascii	";\240\330D\304\236\t\231\005\331\2050\245\314\236\"\224\313\352"
+	.ascii	"$h\256J\230{"
+	.text
+	.section	.gnu.lto_getMotorRPMAge.76.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\354\001\375\021"
+	.string	"\366\241xG\320\362&\035\222\230m)\330\030\333\277\345\210\221\243\177\001\216iL\302.\314.KC\252\23091Y\314\216fa\177\020\252&\r2\316~M\177\b\2730\310\352\001\264e4\341\370\t\324\017\223\ng\325\336ZB6\2212\245d"
+	.string	"\\"
+	.string	"h"
+	.string	"3\017\222\361\316ICR\232SD\340\003\250K\333\276\212\377\314\030\266\211;aW+1c\301c\316\351\025\370\bw\271\035"
+	.string	"w\271\"\016\273\334Va>\206K\024\0221l\302\234o\252\220F$\254\321\335L2\310\250\211\204\262-$G\210\031\027\272\336\2045\252]\312\234\323j\023n\270\271\333\206`\373\201\255%\001\037w\371\365\220\363C\003\342\020\323\321\026e\2725\373\333\\\035\203\240\324\251\213?\352A\177g\265D\251\267N\275\253VN}\325\310\023\255C\255g\233\304\2113\372\2306\344\222\217?t\"\230\2570\201\034'\332\317\234S\005c\253.o\317\330*\333\233^\214qj\316\017O%\253\266\311ID7\320\343\203\323TdB\346\b\207\021#\262\243\264R\220\004\244(j\340"
+	.string	"\261\335\205\333\375\216\241\033V9\222\313\002\2479g\002\333\027\356bu\2623\347Di\361#\226\317s\351\225V\213\273\334M\005\305tt\267\272\335\213\331\217\230\216_\rLG#vk\356\366+a\210\006\215\366\260_t#\031\237\307\024>\275\315\245\037f!a}\255\227\327\002~\037\270\022\360\342\200\365\265\032\274ZX.\027\314*DzE\362\342\002_\340\347\275XVZ\025&x--\225\317[\271^<\222\001\006-\260\\\336\013\004]\236\305\330W\307\235~\351]M\212Y\322\006\262\027:\003\246\023FI\333\215\3438\036\306\311\275\261-\327)\261\225\311\324\202l"
+	.string	"\035\263\037\333\2426\265\017% P\0021J\261\016S\254\242:=\315: \363t\b\332\242\025\354\346\243\356\352\\\306z\032\307\205c\263\006\032\354\274txK\265"
+	.ascii	"u\035N\310\260\003E\231\330\250\026\013\215\214i\373\255\341"
+	.ascii	"\035$\206\035\f\230\"41>\346!\350f\371\221\305\017\206X9\254"
+	.ascii	"\213h\256J\b{"
+	.text
+	.section	.gnu.lto_motorRpmEstimatorUpdate.78.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\272\017EK"
+	.string	"\n}\360\033@0\242N\007\273\033\332\017\027z\217"
+	.string	"\340\346\273y\232\316\240\021<\334<\222\3134\325\205\315\237\265\310\031\262\252k\317\b"
+	.string	""
+	.string	"\200\002"
+	.ascii	"T\273\252jFu\374\353fTD\0247\262\333\215\354\235dJ\001\257\001"
+	.ascii	"\203\001\262\001o\224q\200\212m.H\337\244T6\257\263\217\\\037"
+	.ascii	"_G\255m\3613\355y\256\347{\255T\323|e\327+\3308\216S\244\tK\212"
+	.ascii	"E\223yxX\260q\\\035\221D\303#)\026]2\233B\305~H:\231v\274\356"
+	.ascii	"\273v\023\200\254\032\237]\b\023\207\212\300\335\316\340V/\343"
+	.ascii	"\303\311\364\325\032\241\224\032\307\261\322\335n\037\335Jw\221"
+	.ascii	"\312\356\376\334\355v.\246\351\325\260~\343\230\255\320\202\244"
+	.ascii	"\273\001\234yt\267\365\244\243\273\235sw\003"
+	.string	"\bM\247\002\351\217ci\235\2768\256*\350\252\244\273\335\354\366\343\325\267\0309e\255\314\214b\034\307W?\245[o\253\336\314\334t\247&\246%\246R\022\322\221Q\021\321\320R\t\277I\344\321m?7\333\221\0332\222F\3475\357L\314\235\346\274iN.3\315\265\001\306h\311K\355\3220\216\211\337\211fi\035\250\351\031:\236g\2633gf\"7HA\303\342JIW\254d$\001G\310\rlhU\334\250}\242\322J\301E\337r\021U\221hM\232\207Z\007\325@\203\034.\372\244]\212\201\006\221\346%\034\244\316\023p\221\r\315\211+\357D\233\264\001\340\266J\372\227\304\357D\231\264L\3016>.\307I~+\320\365]\361\244\337\211\2529RyVv'\232\226\217\177.\005\307\247\355\232w\246\304\335v\311XF\250<\013\322:\b\242\350\244\263\221\263gn\333*\354\032ADgd-\363H\026\250\357\271"
+	.ascii	"\270hZ~\307\363\2520q\250\213lhX<#7\304q\334\031z\206\346\375"
+	.ascii	"\344\335\276\330\335f\335DU\001$\256E\360\370Z7t\2527\353\336"
+	.ascii	":R1\027\367\b&\016\352I<\376\364\017|\256\363\3042\263\177\373"
+	.ascii	"_\013\027\331\241\b~)\315\223@\262\027\353n'\364\223|\213\243"
+	.ascii	"q\034\037pw\231\246I\240X.\324\022\314\bb\335\326\333\3151\352"
+	.ascii	"\375\317\235\n\234`\342`\316h`\246\210\355O\033\201\273\357e"
+	.ascii	"\315C\226\031;\201\267\357\276\227\245E\375\177\373\336\347\331"
+	.ascii	"\350\314\331\316\377\357e\375\302\005\201\270mp\"t\367\017\017"
+	.ascii	"\2041\324\326f\002\240\333\211\321~\305\335\226\221\225\035\252"
+	.ascii	"ut7\277\357\271T\033\234E\273W\3233\344\362M\340\375\207\332"
+	.ascii	"\332X\257x\215c9\333]u\346\237\032\306\251\355\365\273u\177\360"
+	.ascii	"\340i\274\261\\\215w\207\234[\303\233;C\316\215\341\315}!\347"
+	.ascii	"\266\360\346\256\220sSxsO\310\271%\274\271#\300\271!<\310\271"
+	.ascii	"\021\300\271\017(sS9\032\357)\257\272K9\325\235\200\337yG\275"
+	.ascii	"\271\241\224\271\001\274\271\237\340\334Np\356&87\023\234{\t"
+	.ascii	"\316\315\\\346V\202s'\301\271\221\336\334G\313\334Fp\356\242"
+	.ascii	"77\2212\367\020\234{\t\347V\302\271a8\367\373\346N\302\271\221"
+	.ascii	"o\356c\316\355\346\334m\316\375\311\3349\347v\020\315\252\342"
+	.ascii	"\237\nxq|$K(\016t\331hq4\356i\334\325\270\337y\333\355\355t\374"
+	.ascii	"o\207\363\365\017\376\311\355\350V\306q9_\316\327\005\336\276"
+	.ascii	"\272\003H\320\274\250W(\242\201<\365Eo\364\335M/M0\331\241\035"
+	.ascii	"\340\231\217\324 \302\003\355n\316e#M\272\327\257P\261\b\021"
+	.ascii	"\243w\250\222\261\234\255\313\320\346{\277B\305<$\013)\372\367"
+	.ascii	"+\\|8k\262_\210~\332EQ\242\336\024s\244\220\204\006qL\342 \340"
+	.ascii	"\204\247@\364X?\341\275Ms\310A\302\220\326L\226\235DT\351\233"
+	.ascii	"\264\316n,g\263 g5\311\320O\373\305\033\345\362_|\201\233\317"
+	.ascii	"\365\f\343\030]\216\277P\350D\367\034\276\360Cx\2636\364\241"
+	.ascii	"\367\262\352!\313\2149\336r\221\024f\033\207\336ER8g\207\365"
+	.ascii	"\204\302\230\006\251x+\241\034\343\242\357\371T\"\241\363\232"
+	.ascii	"\207"
+	.string	"\270\374\351\002\2707w\312w\263\276\305\361\200(%{\254\035X\210\245\b\274\224\3439MI \223A\203\200d\231Q\371K\t\257<\340\004\264^\357\260\021^\3027\005*k<>\326Gx\177\343\255\227Bl\335\224\273-N>\17769\204\022\307\255!\233\235C\026\307c\004\336\207\337\223\377\276G\351\016\237\330\261\017\016(D\322\021=qD\t\023\331\241&\216\356&_\231hg\316\256\303#\177\352s\237'\234\363\204c\233\357\365\003\224;\364\203\374\327\017p\316\016\315\317N\365\375\251\340\036B\322\370\331\376\271\370LL\376\264\261\376\370O\345\311\240\325\203\363\t\233z\353F\341{T \255\177\356\352\311s\314{O\b\245ul\306r\326\301\034\272\005B\376\264\375\317_\252\234FW\352\303c\275\231\377\271\324^\031\236{\340\273m=|\2077s\343\340\341\271\356[G\377\363m\303J\213k\013\314\251mX}\331"
+	.string	"\223\301u\225\243\213\213\253+\353\211K\207\227V\373\305B\013\207\016.\031_I.\035^\257\225\345\305\243\353\353\370\305B\213kk\005X\016-//\036YCngY}yu\201uq]\201\331\250\261\205\203\306U\216-\031\\WY^_WV"
+	.string	"\272K\207\226\327\025XW\227\327\225\262:\346\357\226\255.b\307\336\271\306\351\247l\266\240\326\360\254\351\373Bi\200\234\364\f\2734\375\264\363\3235\274\217q$\301\306(\031^\003\324K}\206\3672{a\021\324\350A=\223\0035=<L?m"
+	.string	"?#o\013j\215\020\315\031"
+	.string	"\357d\215PZg\327\267\364\323f\300\250\364\340_O6s\237\315[f\002\217\372\007\357x\336rItc\275\336I\2359\233\343\224~j&\214j\255K\031k\017\273\303$\fG\202\203\304.<\206\247\307\372\013\357}\325\260\250\265-b\354\236\376\375\004\315!9=\225.L\236\203\"6=\363\235\376\013=\231\276\351\221f\226\036\351\231\376X\347\t\347\234\346/\315g\205\307K\223\316D\227\270\245\267\312c76%si>\250\267-M:\25257-Y\230\217t\002Z\264kR#\323st%\214JJ\310J\225\272,\024q"
+	.string	"\036:P\214\232T\216\026\036J:\310j\247*C\370\244\237z%,M-eRj,\247M\272\022R\254\224\352\326\246\204\364I\026\036\211"
+	.string	"\022?\316\353\035\266\302[8z\254\257\360\316\006J\030u\r\306\215'nR\252\364\350EH\361H\353,\210\005B\213\020\377\332\257\356d\313u^s\223\314\304y\225\003\224\246\270DI\017\352!\024\261\311%'\ts\235\206r\001\2015\250\201(\345\020C\n\315\214\210H\222$i\fQ\005\304 &\241\264\016\021@-D\f\215\210\330$;s\034\277\004\206\355O\317\227f\364\034FJ\3372Zm2.\254\367\225\216\353K\242\332\b!\344\036/\324\344?\355\350\224\265S\216:\3103\211\301\312\240\332\325,\026\275\255T\031!\205\324(x\376\235(\243<J6D\223~\337\3073*M\225\344\037\031f`\307\331\307\275J\320p\257\340^d\202B^\004\227\300|d\235D\205\314\217\233|E\361\312s\272\274\221\3040\272\246\226oo\034\033L\303\256\230\027\247\223N\332\231/*\0359\202=\343\205YS\257\221Y\335"
+	.ascii	"\300+\302\320\301\004Q\035\220\3347\356\301"
+	.ascii	"\351\021\020\033Z\261D\302\343\0339\346\356\226w\235X\250\007"
+	.ascii	"\\\256\334\315\3257\257"
+	.string	"\334\317Dw\035\236\365o\026\333\230t\312\371\004\300-\210\334\200\336\300pH\376\342\245n\333\r\274\270c\310\313\202\362\340<\306^\321\020\320_\21221x\r\210\004\242\032\324B\2062\241\331;\234\007T]\t\344\243\r\315\302S\321a\263\\\360\351n\f\326yN\273\021\002\b\f\272\177\304\226\016\243\363\370>B\030\225\fP\301\260\362\201B\346dT\nz@\304?\351}Q8\305LR\215qNz\013\312\316\033\337J\210\017\034\322?^\023\220%*X\304\253\243\257G\210\331\275 N\223\344q\340\005\324'\004\0222\327\027\262\257\353\216?$\300\222\221\227\301\250\027\277\225gdE\216\306u\266xJ`\314\351\255Q\212^\233x\344YG\354}T\325$\237\304\225\204,\210\352\212\023\235\210\035\266X\250\371\300\n2\020\215\362>\211\242\007\222\372\017`^T@\350\344N\032(\022\b\233'\037\230[f\370h?\032"
+	.ascii	"g\217\341\324X\275\r\247D.\003\n4\207\327R\035$\2439\017tk\030"
+	.ascii	"@m\024\005\234\363\257\\ \020O\006\203mu\2147\266KT\244CK\350"
+	.ascii	"\215\341I\366\200\013_\017a\372\246\3404%\3777\200\377\3548\250"
+	.ascii	"?(\256\317\374\226\347\324KD\005\210O\332l\306K\225f\211\247"
+	.ascii	"cXR9\313\232\213\021\365\324\023\274\022N\321\307\272y\351)\226"
+	.ascii	"\372\236uU\311\027\274\261\333}\030iMU/fV\305\276\252\276\346"
+	.ascii	"\216\n"
+	.text
+	.section	.gnu.lto_rpmSourceInit.80.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\372\006E+"
+	.string	"\372L\020\021F`\\N:\337I>\216\335g\375l\032Q6\365M\177\350\026\216\324|\021\301\362d\355W\373Z\252\232\017d\216/\316\351\025\345\202\246\220\361%\001\r\356-\210*\347ll!\3005E\366\261\266\266M\032!D\356$\003\373"
+	.string	"\355"
+	.string	""
+	.ascii	"\001\354\003\254\017$ \377\224b[(\27761/\274\266u&\2617\343\243"
+	.ascii	"\375\312\261 \357d8v\n\213Uc\343\302k\333\026\351*\037\261W\213"
+	.ascii	".`\275\232>\300z\225y\007\263\360j\013\031\311\f\347\316\260"
+	.ascii	"\366l@\254\266\334i\333\326\330L\322\024\310\367\251\363Ll\344"
+	.ascii	"\213\304\2410\bd\177\253\232\366E\362\313n\324E\3142k\352\305"
+	.ascii	"T@\223\261(\237\303b\246Gpn\321\243%/\321\310\207_ZE.L\217\230"
+	.ascii	"e\204|\016\313+\025\200F\211\233\267\375\300\030V\221\033L\207"
+	.ascii	"uR\272>\207\325\225B\340\202\326\335My\201\007\300\264\270\316"
+	.ascii	"\006\305\242r\276\264\272\376K3\234U\021\373\034\326V\332Y\324"
+	.ascii	"\304\b\263\254\356\372\343\340\366t\f*\307uu\310\323b\026\217"
+	.ascii	"\264h\355\367*\253\352\366\321~\304\266f\206\347K\313\310\357"
+	.ascii	"\217C\333\266|\227YZg\2373\337\0013\243`^g\004ec[i/\341\034\353"
+	.ascii	"\373\351\311\246\352\346a\237\313\274\304\324\305\2673\271dO"
+	.ascii	"1\037N\207\202\260%3\267x\230\030\024\302\332\266\255\360v0M"
+	.ascii	"|'W\231\206\323\375\322i\275\032\324_\373\002:\267\244]\033\021"
+	.ascii	"\252\333\307{ztP\272\233\314\316\344\325`e"
+	.string	"k\f\367\022f#\365r\321\243g\"\365\262\001\241\253\235\203\016=\003\370\363\ft\347\371\207\275\354\303^.\256\227\211\353\345!{Y\250^\016\252\227\201\277\313\354z\371\247^^\325\313\252z9]/\267z\371\246\227\217`A\030\263\210\330V\3339[ }{\255\234\372\366\344\321\037\372?\177\265\337\351%\312po\265\332\367\310c\273\273\300\262\361\335X\be\300e\r\264\302\317\336\266\343l|\001l\217i\326\266\2550\013_\313\327\266<\ry5\035o\225X@ l]\021\330\253\354\f|s\220X6\204q\207\347y\210p\327\266U\023\360.\347\003\210\020!\332\207.\016\2367\240f\036q8RC`x\023\336\304\260\261\344\216i\326\346nt\254WU:8d[B7\302\231\314\212\364\240f&Q\342~\311_\373\177\200\241\"\247\354\251\033\354&[\210c\205Z\315\243\362\325\375z\332\266m\013\354\346\031\254"
+	.ascii	"Z\250\177]P;%3y\373n\322\207\327\027\266\233\334S\270\314\254"
+	.ascii	"\335\277_\323I\021\2459\021\250\235e^\320\263M\356\327M\244\257"
+	.ascii	"\375\257\244\253\275\366\255\266\322\276\255\366uS\362%o\037"
+	.ascii	"w\247}+>\252\333\247\342hL\260m[U\201\177\346r'R\024)\326\024"
+	.ascii	"\353\325\356\tk\336\200\372\366\335\236@H\335\323N\215\257\271"
+	.ascii	"\240uQ\326n\362\247\004\341K\177.\265\006\305\274\254\242\375"
+	.ascii	"2\007\352+\251\225\214\324\200;\376\230\307\255`\341\342~\351"
+	.ascii	"b\275\212\001\314\t\323\214\216\032,C\tJF\324\013'\243\215\243"
+	.ascii	"\223\323q\211\300\013\027w\306\243\240\230\032\212i\351\t\307"
+	.ascii	"\021\352\327t^R\202z:F\035\235\214Q2b4\325\200a\264\321\364\302"
+	.ascii	"\311\270\364\004eT*\300\307\033LO\306\250\343\361\311(tR\275"
+	.ascii	"\354\037\214 \301\203G\325\311b7\371\02774\352fs\221\376\323"
+	.ascii	"W\367\007@\036"
+	.string	"\260$s\322\274\f\312\036\037\304nr\n\"\302\240\b\036X\216<\t&\335@\322\177\332\250\217\366\005a\240O\2734\246\017\225;\305\321!&Hn\333w\325,\363\212\315\321\257q\261\252m\251\020\370\364\225qE]\f\360F\211G\324E\255\364F\251Gl\242\036\202\263\342K\372\260\211\335`\317\304M\273C\222]\017\262\354zy\206}/O\277\204\241C\366&<\373\035\216\016\201\355\331\321\3732\317@\013\253\342<\355\322\360\250n\037\017\177wg\270\025\330\301\346\253\244\223|#\253SE\b\354\267\035\b\355\211Z\2334k\330\006v\303Y\005\200\205\250Q4\345\020bF\031\221\021\031\222\202$\035`\002\031*3z\020hH\332\244\320\030,E\343\3431\344A\002\320\266~A\342Q\277\206uy\270\f\332wae\233\266bqj\330\340D\332\351Q\260\314 \311\f0R7e\277\006\263M*B\0054F\2259"
+	.string	")\304Q\002T\354D\005\361\311\305\360\205p\345\270\357\252.\251\007\261\215\232\326k\354f\350FA\352\275\3228_U@\234\315\005\361\005\226\024\006ri<\t\224\034\217K\343\377\263\254\331\033@o[\301\364|\200=\224@\252\263\337\262\274JB\201\035\t\3261'\344\325TY\222]\336\026\233nYR\0039{\307\366\250\250p\267z\240!V\266\304\023m\331\214\031\377\303F`\312\212*\231vSn(\351;\273\217\013I\264\304y?b\020\037\274$'3\266\334\007hnv\005d\205\231\321{\f7+f\201"
+	.ascii	"@]g\b\034f\343\271]\243\031v\t\325\327.'\200\304:\246\375%\214"
+	.ascii	"\033\331f0\025\261\323+\237\013\215\333\274(\246\002"
+	.text
+	.section	.gnu.lto_initEscEndpoints.81.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`M\002\035\020"
+	.string	"F[aE\360\2606\035\303\372\237\0376\216L[\244\360C\243\227rn\005\355S\261\237\230\262P\034\274\213\340\03242\0211\007\307\307t\265\267\370\021\365T\272p\347\"\353\360pY\005\360\254\365>~(\222\321\223\336D\312\224\002K"
+	.string	"D"
+	.string	"P"
+	.ascii	"'-\f\304\330\275\260R-*\312t\260}\315#\033"
+	.string	"\306M\034\366//*\264\244vw\323\r\037=Z\232#\037\373\310\300\220\364X\272\325\tKW\216\360\263\004\354\356A<-\204^&\366\261\273N0\304p_\267}\3006\001;]\002\276c\256G\354\243\221Ju\271\312\335%\251'\\\327\005,.\276\254\341+\355\b\022\362\340u\303\304\f\312S\222m\362R5\330\267VQlMw4\235i\232\243i,\323\227\246c\246-Mk\246\363\351\003\350\b\226FU\030\220\2278i\337\215\315\212*\314\301\232TUm1\241\261\347$B8\273_\001\377\345#D\374\224G\177FF\256\307\324L\306\215\312\212u\262\235. K\245bE\323\301\302a'\252\017\247\233\274\361\355v\003\374\0207\371\344\247\230\30411\366x\224\2048\021\007\332D\rD>\016\030l\017> \240\315\023*\331<\002\230\203\020\022\332D\034\027\3324Swk\025\305\bJ\250N=wt&A\316"
+	.string	"k2\345hGo\342\301cA\222i\266\202\243\032\005\0216\031\272\\E,\005\350RL\301Q\234\270T\373V*Q\206\013< \360\002\031\261\321\003sB\347K\214\302\343\204;\2302\257\026\345[\203\371\351\301\266\254\314MdS\023\262Q\"\3343\260\322\211.,\310B\356e\007A\226o\b>*8\250\022\323\337p\026k\276\270OYd\362\002sfs\216\330\034}\031\206\220\363\200\340\302\026\321\270\363L\264\236A\002\234q\fo\313.\352{c\307zNd"
+	.ascii	"\326\366\034\016\021\344\347(\3175F\235\336\332\\\006"
+	.text
+	.section	.gnu.lto_motorInit.82.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\221\002M\024"
+	.string	"\346\346\204I\260\022R:\343%\247\257\232\235a\225~z\225F\206l\271e\221}\337\020\311S\006~\030\370\251\214]\327T\325\377Y\272\357\226E\220\0254k\2475a2\205?)?\370z\n\264z{\207-\001\341c\231\372[\262\211\224)\005n"
+	.string	"k"
+	.string	"q"
+	.string	"F/\272\013\232\353\354k\325F\264\224\226\244\246\346\234'\2276i]\226|$\274\004? \274\264il\361RE\323l\036\327\371\314/\205\300A\0022\347\0347\205\365\240\356\006\225v\t\256\322\374\013\035"
+	.ascii	".W\273\004G~X\004\005\310\335\200&>\246\336\217\25699\233\202"
+	.ascii	"A:_WN\347\312j0\347\264\342r$\356\360\266]l\247\330*\025/z\234"
+	.ascii	"\254\203\036g}:\361\263\331\232\255\263\351\366\330\377\217S"
+	.ascii	"\t\020^\036;D\252_\253\026\237t\273\276\273Y\253\226\241\032"
+	.ascii	"\224\352\005\325\272\352\213\220\f\345\240 5\247\210\253\252"
+	.ascii	"\371\223M*\276\373\223\256\366\355\017\371J\026\025,\240=i\346"
+	.ascii	"\3636=\350\310115\247\016\245u\351\277\370\316?\262hD\243\371"
+	.ascii	"\220a1\304\023\371\001f\331\330\220\335(=9ksl[o_\310\332\027"
+	.ascii	"\355\242l4\b8\347\234 \312Y\033\262\037\240\256n(lz\345\327~"
+	.ascii	"g\303\334\311=\003>sN\006\276\2147"
+	.string	"M\250\240\242\022^\036\327\343\274\367\334\363\201l\301<=\316\274\360\362\265?:\202\233\252\026;5z\245>\240\035Tk\001j\257\260\220\254\370\331\266\346\227\372K-\t\016#\346\003]ZC+\0274v\263\244\304\314d2\262\227Q\306\245%\266!\303\310!\266\3622\262\314b\306\224\002\226\301`\230\21522\331l\024u5_\036K \372\325\254\315\004T\\\271>\016(\007\017Jn[3\270r\217c\265\013\356oP7va<\252\035\335\032\020`z\234\270\272\027\272\b\322g\374+\356o>\\\373=\360\003\307\352\3514f\"\300`\341\245k\257t0\b\211\211JnO1 p\002!:\273\001c\300c\017\001'\354dwQ\020\207)\3222\230\023\267 R\272\214-FH<'\212\354N\007\020xiCL\004\354\251',\230\334\373h\305z\305\233\031x8\215u/i\257\200@\247b#\307\307\214\332\311"
+	.ascii	"\370\003\224jDb.|\232\356\355\3362lB\263!\266\241x\021\002\330"
+	.ascii	"\301o,w\027a\021\330\365\271\271Ar\333\340\004"
+	.text
+	.section	.gnu.lto_motorUpdate.83.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`:\006\035&"
+	.string	"\332C\314\016G\200\332Q:;\344\203\300\375+\rP\315\353\204\200\n\265m\376&\340\330i;}"
+	.string	"\250\344o\373N\266\331P\376O!\325{-`\220\261\201\023\034\216a\264|\215c7\0372D6\3736\233G\373\337\376o\204\020\271S\n\331"
+	.string	"\304"
+	.string	"\333"
+	.ascii	"J\337\313\211\313\302\304~\250\245i:\204\373i\263\260w?\353\273"
+	.ascii	"\274\363\227\234\t\361\\-pKG\234X\024\227Z\232*\023\374\264\020"
+	.ascii	"\356'\320y\320\237\346\003\240?\211v\232+\257\322\213]A}\301"
+	.ascii	"I\3234\270=z\2567\2257\272\304\373z\274\235.\207\273\241\247"
+	.ascii	"\271\277J\364\rpQc\224Z\272\357g"
+	.string	"GdX\215\332\3431u\343<\253\357~v\264\322:\332\250\272\260\237?\300\326\344\230\272\361\034.\307\024\215\337L\036,\255!>)(S\250\214\n\331\275\212\025\035B\365S'5\343\246)\204\344\"\303'\325d\362\200\321q\346`\257QRNuqT\377\231<0\202\030\177v\2542\205\324\252\270y\327\013h\035q\324z{\220\246\251\253Qj\352\336\271}!\333\033\3543+\376-\320\272\032\327\230j\333\212\321R\303\315n\322\277\327\260\330\224\374v\207\177P\340\276\353\2703\257\264\246*\307\377\017\372\005\256+TU\361SNE\350gyxTo<B\177~O\264\262\255*\246\332f+\213u\223\366\217u%\206\013\357\016\373\254>\020tV\003\235\353&\360cV\373\374\353\356\331j\340\2458\271\177g\265o\253{h5o\253wf\265\356\254\316m5\316\254\276\231\325\250Y}\232\325\246Y\275fu\335\352#"
+	.string	"\326"
+	.string	"\323\201,Ma\264\315I\315N+B.\345\377\372\235\374\\7\355\207y\027E\f\354M\016f\357\314\342Q|sZ&I\323t\367\304\207\362e2\334\322q\200\321\f\220\006\017b.\360\260\274\031\272B\216\341\006\324+\017&\004\220L\2322\335h\346\f\032\352\215~\327\377\002\313\232\333&\275\303:\177\366\304\372%\370o\243~\233\333\b\270\315\355\241\3520u\021r8\302U%@\262\220L^\227N0\206\240\233\264\207#f\245\340\224\005\007\331\242\353\263Q\266\202\377\366g\357\365\263\210\226/OH\237\265-\342[L\306s\225\246\351\220\237\345Z<\370Y?\375!D\b\364\347\241<\bmY\034\023\3467\347m]\237\330\212Tp\350\35007\331\263\350\036\354"
+	.string	"\232\034\201b\023\306KS\225\263\034q\333\233\323r\013\335s{\266vyB\226\021y\f\335\177\2251w\367\334?iY\371\025\223\025y\314c\313\300\007\257\002\255mt\242\336\270{(\277\025\226-fM\273\0246\261 \311\204\322\ba0\305P(\034\022\365(\255\030\256\321\2232\024\t\2150(\245(BBZA\3243\321\202$\244\241\322P\030T2Q\302\b\005\211`\n\243\021\302 \021RRp\201\217\207*\212\220\202J\303!Rp\247d\372\356\360\322\206\031\323\026}\233t.\215\027\264\233\226K\360\235\235\365\365\326\307\326[`\231*3M\323\264\267I\357l\320\336\212K\224'd\261\266U\036o\215H\304\201\332\327\020\215 !n\021\267\214k\274\275\265y\362b6(06\273M:x!\272\333\363\360*\323T\345\240!*9\332\355\355\013-N\225\016\304\315\230L"
+	.string	"\2314M\207\322\210L*\032 \b\021\352\215\272\005.g\374T\002\2260!\354\177\261\214a\346\264K\336\331\003eYg\342\3506Y\355\n\026\352\215\004\366"
+	.ascii	"\025\035\263\342.\345\320\002{\250Q(&\025Cfd$\030\222\321\202"
+	.ascii	"&\035`\002\2219v\035\021@=u6\323B\226\003=e\235H\277=\313\305"
+	.ascii	"\364\214\260\260\b\202\273+9\202\370\022\237.\"\343\273<\326"
+	.ascii	"<\1775\026T\366\3012AZ\t\262\026`\b\265b&\352\302\300\310\353"
+	.ascii	"+\202\346^\326\346\376,&\340F4b\307\335`\032\263F\322\242\245"
+	.ascii	"\345\237\366p\311\007\t\275>\275~ L\331\260z0-q\303\277\225{"
+	.ascii	"\301\330f\355\233\276\265\005\314jj\377\264\266\313\232\254\\"
+	.ascii	"4\241\360\b^\350\367@&\224\303 P\211*\303\210'>\207'+\276\273"
+	.ascii	"\256\023\315\326\002\206\300\311\215\030\037\220\030\356\364"
+	.ascii	"'\327\003\240\212\227\304\221S9\004\373+Y\321\240\231b<gG\357"
+	.ascii	"\n\006\351\321:\264\367y\336{\256l\f\225\2336\372\325\353\007"
+	.ascii	"\365\315\336{\270d\006\033\302\224\347\300\306\337&o\330=J\271"
+	.ascii	"\270\030\265\030\b\314_\004\324\323\226i\361\274\200\f=QOE\032"
+	.ascii	"\241\006"
+	.text
+	.section	.gnu.lto_motorStop.84.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`T\001m\016"
+	.string	"\246\333aE\360\222(\0350\207\177,j\035\347\026\342:\f\027]\253\206\371\201\037\210\343\376\330\303\256N\\Bs\207#\306\267\232\240\256\253\005\233\252l\220\013\370\016<\003\225\207\231\202\004?\302\342p\352\372N\220h\262\211\224)\005M"
+	.string	"O"
+	.string	"J"
+	.ascii	"#\033\307A\224\275+\004\361\302cw9E\341|\006\336Y\216\0363\315"
+	.ascii	"\221\257z\002\330\216\357Dz\3146)+T\006\234<d"
+	.string	"\234\327\213\360\340\263\344d\312L\305\344z\360\034X\370\235L\236 \016v\327\371\235H\334\332m{\266;\366S\0047VL\2242\246\371J\331\350\241\212\262AR>%F\211\020\326\023{;\353\316\247\017\300\300\212\006\204\326\256\210\330\217\225\2110T\234u\373+\037\264\346,o\031\235\345\327F\032\261\265\\2r\354n\347\321\234\355\021\3017\332c\366\002\332\3435\016:\223\235\247\226\344\375\322R\337\3422C\222>\236\355\356f^\360\324MG`\341\207\023\246\214\371j{\344-\207\004Pv\267\201\377\362\026\033\374\324\2439\210D\237\216R\306\354\263\270\213C?\345\016\206\311\177\217\276a\364\340\025\240\002\236[$\004\344u\241\356\303\205*P\360\\\230\300a\360D\370p\"\036\210\0139\340.\203\004\217\013u\235\307i\300\275\236\370\001\213LIM\026\220\f\356\321l\013\237\214Qm\371\325]\21065vK\377\\\326"
+	.string	"\312\177\276\352\001bVdH\224\024\025e\220\031\272i\033"
+	.ascii	"3\001\2278\244\214cQ\025\303U\247`\335\004\353\353\314v\t\033"
+	.ascii	"\253`\320y\260z\250\024\0215Gb\354\303\264\t\346\272\034\n\305"
+	.ascii	"\234\316N\260j\345E\210 3n\334({\241\252\361~\022\351\\\363\t"
+	.text
+	.section	.gnu.lto_motorSetDisarmed.85.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\265\t"
+	.string	"\206SE<0\305*\035\236\213\237\347\361\243\352F\203U\210\2172\373\240\352Q\226=c:\240\t\b\337l\r\263h\242\225\003\034\022\035\350h\200\021\301\204e\361\300\037\316%\2770\216\373\333M\244L)2"
+	.string	"4"
+	.string	"1"
+	.string	"\272\013\002[\331\r\031\274\240y\364g\013x\350\332\253\004X\305\n\354.\247#\377\236\237\377\223o@V\352\231\201\330]'\310\372\270\365\266\025l{\354o\002[:3\375\214A\013"
+	.string	"\t\331\256G\315\300\322\"K\211\355slk\33279\354{\230\341\315n\310K\203\3461\341\005\230\307\355\004\230Gg\332\016\236\357\257\r\007>\312S.|\222G\233Py\360\321Ga\036\017\022\3304u\213u\fP\275\226\\f\253\003\252\254\331a*U\304\376\266\273km\331\017\377\355\257_\003!\324\350\203\021\243A\035\223\327\235:\022w\252\240\020\215&8\013\321\207\304\201<\023\3279pW\ny\334\251\353<\216\023\356\267\325\226#f4\225r8\325\266\306c\226!\270v\367!\013"
+	.ascii	"i\221\"\023\257\201F#\\\354\227\210`\006`\256\261Ma\210)5\032"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_motorResetDisarmed.86.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\016\001\005\r"
+	.string	"&YYC"
+	.string	"\261&\035@\034\"\343\034\250;\350+jp\312~\377\f\353-A\005[\231\373\354Z\327\t\261\310\244w\263\026\235*\260\006\005\243\322%\177\005\250\252*\201\240\342\252L\001\343&\254\017\314Bb\311\336R\246\024D"
+	.string	"F"
+	.string	"F"
+	.string	"/.\274\324\330\335K?8\377\342\375R;|\232\232\317\362\002,P\0337:|\036\225\020+\034\034\311\373\244N\240\036\237%\\)\337\212\311\365\361\237\231n\343L\236\234\004\273\353\334\270\rwu\333\231m\220\375\217WI\301\001\203\365\304\376\351t\347\323\347\004\260i\241\200\306n\206\356fi \n\020?\335\376\b?\272s\022o\321~r\312\032i\260`bb\310\330]\320\241?\326!\201{\252\303w"
+	.string	"\325\341;\326l\030\217)\373\230\007\236Z\351\310Lg\301C);_m\217\034\306\250\001)\273\213\300\177\271\t\t\276\351\320\023DD6\033Rv\366K\334\305(\337d\n\226\311o\207\276e\364\361\006HnDt e\247\2312\271\260\241\212b\307Q\006\241\333\243#$\303D\030\310%r\320 \364\200\301\005!\264"
+	.string	"\344\362\310B\256\016\001\306\"|d\227\b\303\262\253\023\367z\302rK\305\f\032\222\226\240\242\230\263B+\325\232\004=\265\304\266\363NU\251oq\251\251\2207\376vw\237\003\026"
+	.ascii	"2\003\376\031C\201\306\341\354\355\003+\316\203-C\245\210\250"
+	.ascii	"9\022c\037\246M0\327u\351\266\261\2413\031\254\232~\021\"\310"
+	.ascii	"\214\0337\312^\250j\274\237D:\327|\002"
+	.text
+	.section	.gnu.lto_areMotorsRunning.part.0.112.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\332\001m\021"
+	.string	"f qH\320\262*\035\222\330\301ro V\335;\244\b\2250B\226\266\212T\022x\350;y\005\353i A\004G!\334\332\356\334#\364<\004\261\n(\034\344j\006\361i\225M1?\343\204\030\255\270}\bm\241\355\223\275\267\334)\005^"
+	.string	"Y"
+	.string	"^"
+	.ascii	"v\350\363&<B\222b\031!Qy\365\032\b\330]l^+xj\255}\237\373\301"
+	.ascii	"\361\262v\317\270:\235r\243\267\362\303\013\247 !\006V\234QE"
+	.ascii	"F\303\345\224\331\341\242S\023n\370\312\022\032\t\030\220\320"
+	.ascii	"%\327\206\203\361\231\307\225\260\025\243\350\236gRk\365\207"
+	.ascii	"\303\375\271\355\227\355\221\035\013\004\373\342\365\256\300"
+	.ascii	"F\214\020\336\231\275\031Me\364\224\033\275\033\035\177\273\017"
+	.ascii	"2@\003\200\254VX\217\217\332a\336\214\370\355\267\357\337\216"
+	.ascii	"\302\237q\310\2262\313i\276-\305k\252\253\360\213\020W\255\206"
+	.ascii	"%1\027'xj\255\243O#\370|\206\\D?\345\003\320\317\373\264\224"
+	.ascii	"\035\262U\001\262&\370W.\250\206\216\226\016\215\254\305\"6\303"
+	.ascii	"\221\"\\\t\230,W\327\203\367\003t1\036\273/k\272\355\270b\017"
+	.ascii	"\3735o\341\235\037\343\222u\326\321\317\335\0030-\266-<\347\335"
+	.ascii	"\247\326\272\300\2479\016\364c>]\341\024\257\362\351\237\350"
+	.ascii	"g\334\\\206\0342\332\r+\366x\27798l51\244\373D\344d\002Q`\351"
+	.ascii	"CE@!I\200\360M 9(}'\246\323'B\300 \205\007\246\017\005\202\246"
+	.ascii	"/d;~g\24693p\273\351\257\350io\220\203\203\333\355\277\242\236"
+	.ascii	"\2676amK\004\335\361F\007\355H\271\337\025\333\246\373e c.\335"
+	.ascii	"\277~\334\346:\024RJ\n\375\234+\340FK+ 0\002\203\030U\036H\342"
+	.ascii	"\212_S\240\301\366\215\306#\f\205\247\345Y<\237\217j\007\325"
+	.ascii	"\215 \360*\006\243g_`\2636\3306%Bv+|\304\304\265\250\226{Ydh"
+	.ascii	"\013\253%\313%\202!N\330\f\230\246\202Z\310@\002\361\241\252"
+	.ascii	"9E\204\377\241i\336\270\205\302\313|\031\366\005\324\030\334"
+	.ascii	")@u\357\265j\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`~\003\245\020"
+	.string	"F\031aI\320TQ:\250;\030\236\0244\334\270\352\032{\337^D+\030\353\254`\331h\274\007|\205"
+	.string	"\221AK"
+	.string	"\031\211\333\302\027\017\360\305\003|\361hF\354\367ux\254xCq\334\314\332\236\331\216\221\024\356G\037\326d\330nr\313\024J"
+	.string	"O"
+	.string	"L"
+	.string	"\2171O\256C\177\223\204\346f\322\2071\273\013*\353\277\230_\255\021\325Zk\254\177\2330\332\353%\300Y\260\352\367\201*@=\266\256/\304r\035\310\2022\255\213\364\377\250~_M\361\367?r\330\007\231"
+	.string	"1\022\350\217\363\277(C/\375\034\263\326\317\231.}\034\263\345$\245\375\007\025\320\322\240\217\303\340=\326\206\323A\003K\377f\256|\205J\215.p\241\n\3726\223k\202\333\240\265\232\017;\b\3727\016\364kpY\226\245\201>\215Y\240?#\345-P\3722"
+	.string	"\\\007\365:(\276\327\211w\206I<@\\\232\214\317\206\326\031E\356ul\312\023\256\363(\334\225\333\217Pw\306\320\037r\241\357c\241\377S\241\017D\241\317cB\337\207\204\376\216\b}\236\230~\017\204\376\016L_\310\203~\320\326Z\377\225\203~\220\r_2e\305\353\255\3304s\342\330\364\355\314!A\344\3109.\211'\034\227\302e\031!b\3648.\201\373\"6#*<\2167\334%yB\f\241pL\002g*\206I\251\2703Qq'K1)\204\2418f\217d\210,\021Cq\211\270K\343!> \220\002)\311\342\006v\020\262\254\331\261\212\037\017\203\324\006\311\226\203d\314\320\366\315\220\350.R\235\003\t \001$\200\004\220"
+	.string	"\022@\002H"
+	.string	"\t"
+	.string	"\311/hsYZ\"\302`X\225\003]\223\326$h]Gz2i[\304"
+	.ascii	"\303\344O\322m\307\026\204\3121HyH\030\206\037*\"\262\232\322"
+	.ascii	"\361\n\037\341\021A\007(As\207O\b[\362\205\364.K\356\307\327"
+	.ascii	"L{\006\312D\302\022}\202\350\300\370\214\311\201\325\317\342"
+	.ascii	"PA\336\300<\001"
+	.text
+	.section	.gnu.lto_.refs.d1f96923951658a,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\255\007"
+	.string	"\206\0256)p'Jc \\\375\377\177\254\252\252\252\252Od\201@_!Z\205\354\366\177\360\255\225o\355\377\222\277lF\032\331{o\231R'"
+	.string	"("
+	.string	","
+	.string	".x\025\254\t^\004\353\201\325\300[\340\223\300:\340\025\360\006x\001|&\254\227\265\262R\336\306\351b}\326[!\235A\3761\232ER$\333'[\325\t\245zD\234\327t\366\203\206]Lo,\2343\231e\230\336\322\225)\351\203W\007\253\r6jS\273\b\343\002\262\211\207>\220\"\326:M\017\3206M\013\217eM\327Z\005mz\354p\264\274\222\246\221\227\321\2665\3134t5\007z\352r&\265eYt^\264/+\311\013S\ne'\b*y\326\241\316Ft*\230\"\2425@\312 N\034\023\355lK\035\266\005\211\252\t"
+	.ascii	"y#p\301\241\201\030E\317\"v\232 \304\344\332\232\374[\272D~\235"
+	.ascii	"R"
+	.text
+	.section	.gnu.lto_.decls.d1f96923951658a,"e",@progbits
+	.ascii	"(\265/\375`[Y\305\201\001\232\200\n\215S \fa:\215\001B\217\373"
+	.ascii	"\003L\345\034\226\361x2|\206\237\326qc]t\206\342\2039\276\ts"
+	.ascii	"\343\347\373\021TL\363\210Yb+s\210\354;$S8\340\370\032\364c\363"
+	.ascii	"\370hX~\255\262&\241W\2609\346g:\223\301\353w\204P\333\344\226"
+	.ascii	"[J)S\321\007\322\b\357\b\325(\337d5\312D\006P\205\007\225\305"
+	.ascii	"\367\035\257\013\253:\344\235\242r\263\f\2730\356W\225S\303K"
+	.ascii	"4W*\354\202\331\001\271B\356\220\033\244*o\330\375\201\215\234"
+	.ascii	"Ir\375\340\373`\350k=}\277\376\373\342^]\037\266N\331S\306,\356"
+	.ascii	"Q\331\326\2263,\276v\243u\\\032\267F\225#\202\311\306\330\270"
+	.ascii	"U?\337\336Sp\310\275\367\325qo\334\252*\247\206\241\264-/\327"
+	.ascii	"\355\272^\227\307\335Q\225W\307\305a\367_\331d\324\275\237\271"
+	.ascii	"\367\027\031\344\336\311\253\343\346\250{\277\251\344>\236lK"
+	.ascii	"\204\364\310\333;\251\201X5\001\022\204\257\243\350k \372z\207"
+	.ascii	"\276\266\241\261\356\214\273U\317-0g^,\276Y\367X\225\031\256"
+	.ascii	"\326\036\252t\210PiY|\215\245I\260w\315\220\353\336^\315\220"
+	.ascii	"\257\267\316\240\036\345\\G\203@\372\215\221\307\300\374\310"
+	.ascii	"\003G\343d=\312W\243\323O\336\252\267Y4sz\344Y\3743\214\276\233"
+	.ascii	"Q\376\331\246\263[\237\363\271j\311.W\026\353\3354Nv\210\261"
+	.ascii	"\370\247\025\275\307\352\311dr\250\216\026\377\234\242\177&\321"
+	.ascii	"?\3014\236\337\206\261b\354\235\273*e\246,\266\023\264\006\247"
+	.ascii	"\312\312\342\237[tl\235\252\264x\326\314\355\031\033\007\202"
+	.ascii	"\003\213g\313\324\264*\307\345\001Y\234\345\336I$<\213\306\316"
+	.ascii	"\251rj\030\357n\271\367\306\320\241\303\020\022;6fd\374\3334"
+	.ascii	"\267s~;\306\222\261\313\2501h~X,\347'\b\230\274=\026?\363\321"
+	.ascii	"\257e]F\336\330:\353\306\302\261w\266\215\265\253J\033\307\322"
+	.ascii	"\335\252\261k\270\352\226l\334,w\344\270S7\347f\031\247\016C"
+	.ascii	"\226\261$\343\203\b?\353\321U\256\036e\rk\364\363\234\266rH\267"
+	.ascii	"i<0\002\204\314\342kF\237_xZ\364\363\231>w=\312_:\321Gr\365("
+	.ascii	"[3\325(\237I\037\372'k\351\037d5\3127\367\3506.\276\255\256+"
+	.ascii	"D,\336\222!\313X\333\321\306\342\233m\364\177\233\305\262U\245"
+	.ascii	"\325b\325\264\330*\026K\225S#\341\305\314\322j\261k\326\b\220"
+	.ascii	"\f\267\273\261\274\275w\206\016\035~D\300\350pe|\223L\337\024"
+	.ascii	"\242\257`0\241\r\225\034\026\337\324\241_\325\224fH"
+	.string	"4\233,[Z\261iUi\321\354\231\032\006\237\224\037cV\031\337\344\3227\261\364M+}\214G\037\327i\240\257j\224\217\275\350\240c5\312VJ\024,3\330\364\261\370\370L\277*\355X\024\240'u\352\270A\271\215\362\203\340\340mA{\227\355\2755\b\225\305\325\270\262\330\"\355\223\377\276\241\2517|nX\374\333'\326\211\357N\032\027\231\305M\200\242\224y\261a\361\361\230\376_\225\226\211]\362\3775\2711\004\275(\022\006\212\305\307J\364\355\274\355\277\257>\341\"%\213\305\307\\\372\030\206\016\372\2625n\217\374\366h\265\254\021 !f\364pY,\266E,,\212\305\277z4R\027\034\216\035nl7\250\214\341\202C^\361\0217f\271\003\n\234\215\267U9\265\212\f3f\271\367\3161\305\315\006\261av\210%b\301\254\020[\304~Y Ui\177X\036\267^\266\207\232\375au\274\355W\225\334G\036"
+	.ascii	"\027C/\017\210\313\355\252\256\002\376\305\243\355W=\312\004"
+	.ascii	"\250\323\277k\364\357\234\376E\243\177\315\350\3371\3727\214"
+	.ascii	"\376\375\242\177\335t\325\203t[\343\272\205\261\322\263\3707"
+	.ascii	"\251\263\\=\312\207S\215\262\320\261\032\345_\244\376\025\242"
+	.ascii	"\177\2714\206z\224o\373\350[7\232C=\312\326\352\314#CM\032\213"
+	.ascii	"o\273h\353\342X\371%t\247p\234i\263\370\026M\337B\321\267G\364"
+	.ascii	"oW\243\374e=\312U"
+	.string	"\257\362\251\312\013j\237W=\025\317\315\251\344N\356\235\034\262F\370\254\241Y|\033\246_/\310wo\257^\220o\273\264\255F\371\366J\377\216G\371\257w8\b\345aC5f\361_\355T\274{\205\365\265\325\366N\026a5<\256\340X\\\353\f\035yB\247\264\370\025O_\003*5\355\f\353\301\301_\315~\020\034T8uM\255\373I%wV\016\363\221\254p*\\\235\273g\307\n\320q-\255\254y-\255\374Ha\352\227_\025\321\256\n\353B\356\235\274\006\177e{\253_\356\331QcA\323\261\334;\371\277\316\251t\252\234\372\246\332\3258\365\256.\253\262\302\371+]Us\234\334\273\252\354\257W\340\324,o\273gG\013Vt<\226\225\rN\345R\301\374\252\222[\352D\333Ac\231\267\367\356\200\241C\007\241\255&1bP\300\265\316\3266\325\315k]es\020\034<\250\252\326\341\275\247j\r\300\257\326"
+	.ascii	"\230oH\246\3202~\365\242_\265\350\373U\217\362\006\325(\247\301"
+	.ascii	"\240\241\314\321\275Y\374J\246_\313\314\360\251jc\336\366\363"
+	.ascii	"\355\r\247\207\334{_\203\037\351\365L%\3636\r0\366\206\333a\301"
+	.ascii	"\034\232\030oy{\357\377U\256\242\251qUY\317\3242\257b\252\225"
+	.ascii	"\343d\207\016\0350\344-Dl\304i\374\212\245\037\002\375T\237\250"
+	.ascii	"\337\244\203"
+	.string	"\252Q~P_\003\372\257m\257`\376\252\245n\251_\354\327\336U{\357\013\230\315\217=;,\256n\265KUr\250^^\261T\265\373\252\222;m\357\344P\320\024\016.i,\276\005\364+\207<\264\267\267\267W9\344\212\005\351\265\355\257Sj\231Q>r%\267\332\336{\b\003\271\223\305\304\342\207\240\353W=\312\025\252Q&\252F\371\036\350w\2407\324\243\214\253Q\336P\215\362\345\352Q\256Uj\262*+\250h\007\301\301\257\224r\227\355\235\034\022\352#\245\317\036\213\357A\277\236\335\bls\360\037\375ZA\256{\265\202|\2533\250F\371\311z\224u5\312\377\321\202\300\267\311UH<\377\247\tV\314\365\177^\340\277x\377\035\001#\200\002'\341B\3779\201\037>D\2001\370\257\t\270\303\177\355\360\001\3560\207jK\200/\300@\002\221\327\331\200\377\246\301\006\330Q-\f\\\200\377\266\3711\001\376\033\002\036"
+	.string	"\tb\247\340?5\360\360_\020\377E\300\177-p\203\034\300\323\346\024\376s"
+	.string	"\377\357n\207\364c\001\314\371/\030\034"
+	.string	",\274\341r"
+	.string	"\217\001^\002\036\276/\300\177\036\235\3711"
+	.string	"\376\333\004[p\245\340\n\354\340X:\227\004\254\341\377\335\1777\377\277\3747\305\024\374\237\203'\370\337&\303\217\211~\374s\017\177F\362\037\316\005.\376\027\375\347\320\377\270\2479\321\177\326\377*\261\376/\347\307\347\3778?\316_* \0046\177\301\3776\370\376\227\317\177/\237\340\317y\376[-\tQo\376+\343\277\037\376\233\367_\th"
+	.ascii	"\001\335\1779\200\347?\332\235\016\370\376l\206M\ro\363\377\347"
+	.ascii	"\317]\356\374w\351\370\317[\376k\347\277s\376+\347\277o\376["
+	.ascii	"\367\337\271\377\216\371\257\230\377\276\375\027\355\277e\377"
+	.ascii	"%\373\257\223\377\212\375\227\310\177\303\376\373\343\277>\376"
+	.ascii	"\353\365\337\035\377\355\372o\216\377\336\370o\215\377j\3757"
+	.ascii	"\353\2771\376\373\342\277\373\277#\370\357\212\377F\375\027\004"
+	.ascii	"\377u\372o\007\376\373\201\3776\375w\351\277I\377\r\376\027\370"
+	.ascii	"\337\r\374W\003\377\305\300_\265\376\013\201\377\326\377$\374"
+	.ascii	"\327\002\377"
+	.string	"\225\300\177I\370_\347\277#\374\227\002\377%\361\337\020\376\013\302\177E\374\367\362[1\377K\370\217\366\337\b\374\367\001\377u\300\177=\370/\003\376\033\342\277\033\374W\203\377\232\377\275\377\265\367\377\355\374\307\373_\342\177\231\377\024\366\366\366\366\376\314\343'\352\372EX\by\233{L=\263\216i\247*M<\263\314M3\346\2311&\\\223\235\265e\217\334\263c\005\250\312,e`\3254\344\335X^\335S\367n\322M\277@\333\263\264R\266\312\276\330\300L\356n\254\232\341\231^\232,\357\306\362\336\362\330>\033\242\354+_\344\356\306L<K\305\266\335\263#\ta\\\254\231\233%\013!\305\355n,\257\346\325<{vOU\371\272\033\313\263S\360l\231%\013au\364\311@\203[\342\231\341\200\257\273\2611+TU\216wcV\n\357x7\226W\331\360\314\267[\325$i\337\362\246,M<\323\315l\013au\244"
+	.ascii	"\232\330\322\276\231x\026"
+	.string	"\316\342\331\332 \212\334\335X\036\236\t\246\211\333\335X\236\225\302\2631\314\222\271\353.\254,\004\3749\311z\224\177\\\325(\377hO\377\210\216\376\021\2356\305\370\330\324\361R\263\370Gd\364\217\330\364\217\224\372GP\364\217\216\350\037\371\320?z\241_a\217\346\302\307\214\2307\213_\341N\233l\027\214\211%\204\325q\002t0\224\334d\273Ln\227\030YL-\346\226\2524\331L\265_#\367H\0226s\255~\321\n\261\004\231|\243\003o\215\306\257\220F\277\002\030\255\347\206eM\214\305{L1,\343\326\370M\021\355\035\326\206\234\361\337=8\306\335\332`\312\324rN\255\273I\344y%\354\314\262Z\201S\323\246\350p\344I\325\265\267\2718C\200\024&ew\214\0273U0\326\fLCk\003)s\246\230\311e\026\271gG\nP\311Y\3366b6FM\273I\344\211%\314ny\311\230b\267\314\235\253A"
+	.string	"3%\035\216\274+u\324\262\334{\247a/S`\036H\331\212sG'\331\006\317\3253\005\f\356\277ob\226F\335\253rD\366\224T\b\2639:\265\216"
+	.string	"S\224\246\030\256\201\3214P]\355\275E"
+	.string	")`t8.\234\234\2326e\216\016G\336\025:\\\027\206\200(^n\033\261\353\346\276\251r\\[j\316\006f[\311j6\207\323\204\260:\372h\320QY\356\235\024\303o\314\034!\254\216\025\b\233\262lS\347\336\241+\263\274{\256\036\206\021\306a\312\026\035\216<2\246\330\245\273l\26620cB\207#\317\2161\305p\326\255\272g\307\020\350\266\270\020\303_p\231\020VG_\026\235\232I\305\214b\236\231e&\022\323\314db\242\231RL'f\232\t\305Tb\216\231IL+\346\025\263\212y\304\234b*\315'&\231i\304L\232K\314&&\262*M1\253\347\327\313\375\002$ej\231\305"
+	.ascii	"L\244\013\254\207\031\213_aM\3777\201\230af\020SHU\232C\314\037"
+	.ascii	"\277a\256\230csH\rc~\3550#\310\275\367\025s\210\331\343\310r"
+	.ascii	"\357$\b\016\314!&XM\373I\021m*\272$\310z\305\034b\3520\275\252"
+	.ascii	"\034\221\275\2656x\342\205\016G\336\336\333\254\203$\215\315"
+	.ascii	"\017~\005/\375\n[_\177\275b\372\250_\272\346\324A\263\330V\200"
+	.ascii	"\241\177\223\307M\257\277\232\231]\267F\315#\343\004\212\305"
+	.ascii	"\346\016\244\233<,\330\362\326\305\342\263\032\345W\230\322\327"
+	.ascii	"\210\2176q\f\001\0312\265\306\342\033\305\321pp\235\233D\206"
+	.ascii	"@Ec\271e\3360kT\245i\243\312\264\201\361\314\253\020VG\013P\315"
+	.string	"X\2326L\255\233\321@u\265\247~d\260D\317\024<|\205\310\030\037\032\337\210\211\376\235\2613T9\"\021`\302\246\346B\312\322\274\302v\360\236\006\252\253\021\340\264L\375M\rYEF\305\241\312\251\215p+\323\300\2742\255\376\226d\314\2742\2452\344\"bQ\372\344\2314\314\243\t\303\234a\3120\261\314,3FU\232W\346\213*\363\212\225\274=\024\360)\304\321\247\300F\237B\234>\2050\372\024\266\350S\270\242O\201\212>\005'}\264H\311\231\313\262\370\024\302\366`\275\252\304|0\236;8\017\2208H>X\017\316C!\216\235\022&y\227\313\033<+\031\277hN\3778O\036P\0373\257>y\030\317\217\212\022, \026\277(\213~\021\232~Q\231~\321\023\375\343\273\343:?v\203\3550\035\017\254\301(\363\302b\274\304s\216\351`9\033\323\331\340k\357)LgHo\357\251\241Z\003Pk"
+	.ascii	"0Y\230\222,\031\277\b\251q\034\244\343;\027D\260\266,\276\240"
+	.ascii	"\032\345\027\025\321/\002\242m\262\036e\016\325(\3436k\212O\356"
+	.ascii	"~X\374\"\032l\326\\\261\245\033\244\232\3435Ro\330\332\024\275"
+	.ascii	"\320/\332h\260\\\234\357\311\21558vh\342|l\312\270\3349s\034"
+	.ascii	"w\355\364\020\202$L\025\256\033mh0\231\352d\017\221\025"
+	.string	"\375\252\304c0\334Y\225G\031'\346\030\256\256N\271\243\303c1~\303a42K\312E\030\273g\b\256L\037\035`|s\326\240!\002\346n\005Y\302e\212\305'\212\242\3250\\,UR,\376\217\335\252\022w\301V\324\272\340+\270m\315\013X^\320\206\221\247\013n\343Ri\320X^Y\214\267\370\314\330\2701\306\342\023]\351\037\263U%\326r\307\341G\223-\213o\007g\371\357\263C\326\310\321c\361\217\263\034\257\0357\226.\213\325\316;\2559\245\305\037\272\243\261`+\366\307\224\032-\213?TG\177(\215\376\220\031\245}c\226\343\212\305\037r\253\202\223U\211\317p\327\261\026\336:\2063|\003s\375\252\222[\353t3\347\f\353\300fU\216\213hW\335\361\251W\302\364\241\223q\022L\006\007Y\206\247`*U\211\315\216\315\360\016\f\344'U\264\267\020=\244\031\016\202\217le9Rx\2702t\350"
+	.string	"\204\025\304KJ\3431,\245*1\031\216\302\004C\251r\\\311\275\365c\373\201\207+\217\f+\301K4P]\221"
+	.ascii	"\363f\251\277\210\201)\222\361\207\322\364\217\241<\201\321\326"
+	.ascii	"\244M\023\354\344\347\006\227\034\030\213?4\246\233\274\322X"
+	.ascii	"\342\242\214\305\037R\242_\225\217\203\221\2773b\006\207\231"
+	.ascii	"\305\037\022\323\037\n\323\037\362q\004\013\301E\252\234\332"
+	.ascii	"\2108#\030IU\342#X\f\037\301<\310\310Y\376\2244\231b\226\361"
+	.ascii	"\207jh\034\245\n\313\031\213\211\340![H\350\316\353\315\211\305"
+	.ascii	"\037\202\241?4\245\377\353\203\301pXUb \370\307+\033\266q\f\311"
+	.ascii	"\275\265` \330\013\177i\240\272\022\241\207\236\345\336I$\f\004"
+	.ascii	"\363\250i@J\226\340\341\312\333;\211\241C\207\023\210\227*b\031"
+	.ascii	"\377\367E\377\370\013\373\350\272\332\242\2274\305p\251A\202"
+	.ascii	"{\340.\273\030\373\316\342\377\264\350\377\322\364\177S\364\177"
+	.ascii	"L\364\177B4\016\234\003\013\030\2251\213\377\343\201\343gC\327"
+	.ascii	"\337Q\327d=\312\030\252Q\376\357\205\276\320\036\246\301\026"
+	.ascii	"\344\246g\205\303\342\013\301\321U(\215\276\320\233\276\032\252"
+	.ascii	"\341\205\345\312\342\013%\3655\2700\356^\226!I\260\013\374\242"
+	.ascii	"*\261\025\336\330\nK\341\252*\247\266\247j\020\300\316\034;3"
+	.ascii	"\030:\be\311\333\203#cL5$\003\311\013#\026_h\nO\341\321\017\232"
+	.ascii	"\323|n\037\273eE,\f\0374]\217\325(\347\335<\225\356\216\036"
+	.string	"\030N\362\3044\336\265s\223\\\306\314Y\374 \036xAG\375 +}\240<}\2657\372@p\372p\365(\037HM_;\214\343L\220$\026\037(\251\017\304D\277\256\036\345\372U\215\362]3$\227$\f\027\213\017\024v\325\340H\343\304E\025'\026\037hJ\377\277h\252\362\312]3W\356\236\271qUNmo-\004H\321R\262\225Ww\224\241B\203q\334o\225\233\233\255'\026\037h\353\377\300\321\3779\243+R\213\276[=\312&\\5\312\365'M\033%\353Q\266c\325(\273\001\221i\203\345e\361\177\230h\271X.\333\317\2677\030\037\244\226\373\344\246\221\351i\271V\366\007\344\335\330\330m\273\\\356\226\252\274Z\356\225_\344]\""
+	.ascii	"7dR\343\253v\327\252\362o7K\0211RE,\376\217\230f\261\367\336"
+	.ascii	"\365o\371\374[\376\217\016\375\237+\375\237*\235\366\337&\327"
+	.ascii	"\311E3\313T\341r\263X\251GUg\211\305\367\351\351k \005i,\006"
+	.ascii	"\235\214"
+	.string	")\177\273gG}%\fkY\026\345V\271e\227\312M\336\263\252\274f\227\354\232](\333E\032\002\226,Q\262\225\327\341\3541\007\347\026\204\357;\243\357{\323\367q\321\367a\321\367%\365}R\364}O\364\225\253G\331\203\"\032k\251F\331\"\253Q\276>/\215!Y\217\362\275\na`@\261\370\033\276\354\354\3167\030\276\244\346p\320\303\002\323\241s4\221\002\343M\375\002'\314\236\236\305\007@\0375j\316:$H\f\244F\222\2606?\353~B\274\254\3208\331L\251\021\022\203\315\032 0^\306\250\206\374\274\3464\251\362\246L\231s\256*w\026\206'M\372\330\310\003bbF\007\2254?\347\260\022:da\026\237gN\271\377\276\005\024\241\323q\312\235h\310lp\231s\326\265\001\242\027\227u\370\262\220;\362,>\315\324=\257\265\261\033qc\37619\256*w\026\007u\372\330\030\213\301\366\246\264\370"
+	.string	"@\"FL\216\253q\307HI\n\261\370"
+	.ascii	"\340\262\362s\315\312\371v\331\004m)\345\316:\333\312\350\331"
+	.ascii	"\312\333W\\\034\200\316d\234\245q\373\371\366\023\f\b\016\036"
+	.ascii	"G\217Aa3e\361\371\345?\2563^\226\026\377\354rz\371}?M\202\244"
+	.ascii	"E\261\370\026\344\321O\200\022\207\226\226\305g\333\3438\211"
+	.ascii	"\2035\307\342\223\313\337\270\332\344\r\261\370v\316-\377}7."
+	.ascii	"\214\216\312\3423\313\311V\225/sjyr\350\347\345\305Z\031\213"
+	.ascii	"o\001\035\375\3722\271\004\365e\362\211\345\247\332\357\363y"
+	.ascii	"\351\021\004\314\342[`\247\377\363\312\357;\263\260\331\201\264"
+	.ascii	"\370\026\254\321\267 \216\n\225\023\255*wV\245{\023C/\357\307"
+	.ascii	"\nU\233\025\345O\2646\n\256\270\341\262\370\254r\236\005\265"
+	.ascii	"\251YCr\226\314sWWB\202^`eI\202\245\254,\333\251\312\235uT#\254"
+	.ascii	"\016\217\274\275\2718\370\222B\2242,\276\005G(PN\262J\224\244"
+	.ascii	"\242s\203\334\233\213\303Y\347M\206\234S\312O\262\273\243\030"
+	.ascii	"9H\213\317\261\223\211\257J\230\2721\213\317(z\347\221\0379\235"
+	.ascii	"`\370\272tv1\364\306\366\346\342P\323\\|\241\323\344\247\023"
+	.ascii	"[\304\312\022\315\342S\311\311\004mG\0230L\316%Q\206\200\331"
+	.ascii	"Ks%\205\267\345D\3262x\311\233\225\235\305g\222\267\235\005\351"
+	.ascii	"2g\361\211\344m\\\316\352\214X\314FL\354\214\241\245\342 \207"
+	.ascii	"\3045Ic\361+\370r\0069\203\234D\364\233:\237\232Z\f2\347\220"
+	.ascii	"\237D\356\204\244\370\300\230\262\370\024\002\204\346\226\267"
+	.ascii	"M\270\034\227\245\247\307\342W\240<\303\316\2603\006[[\032\016"
+	.ascii	"\031m\026\277\2021\375\237?\316\0379y\263j\0031C\356\315\205"
+	.ascii	"\201\320\0222+T\026\277\002&\372?}\234>^\240\331-1\0379l\212"
+	.ascii	"X\374\nhxy\021\371\201C\307\033\213_\301\224\376\317\035\347"
+	.ascii	"\216\232\206\341K\212\316\006\263\032mz\350\037h\222\230y\353"
+	.ascii	"\352b\303\362u1\263\206-G\016\254 $\026*-\262\0337\336\206\211"
+	.ascii	"\266\f\252\030U\213M\026;\213\257AL\377g\215\263\006\214!i\344"
+	.ascii	"\274Y|\r;N\255S\353\214\241\327\340\344/8;Z,\276\206\030\372"
+	.ascii	"\347\214zf\235Y\347\214\f4\033\226>\313}\264\201\301)\270\243"
+	.ascii	"\317\031\226\2029\027\b]y\331Qrbm-\213\270Y\234,\313\3122\362"
+	.ascii	"e\361\t\343\204q\306\320u-K(\310\035<5\316\030sN\222d\241;\247"
+	.ascii	"\316\251\363\005\205\275\367F\236X\202 Y\3526:\326\332\234U?"
+	.ascii	"_\234Vf\221dW\030{\272"
+	.string	"\030\022c\307\207\233\305\247@\214>\251\324\372\3649\367\032/$f\223\fR\266\367s\213\260\24225\226'O\326\323t{\347\235)\2705{\236\365\332n\233:n[,\316z(\020\303\203Gl\310+\212\025\233\305\247\340G\235:\331\016\211\275\267\034\244\013<*0x\317v\262\233\037:\340X|;f\330\0358m\026\237\202\033wwy\216\233\237,y\260\240-\237\347\274\371\222\314`s\304\342,\347\247\315\307~b\361\355\374\355\277\017\337\3502\345\214\305\247\340\n\016\234\232V\225;\353\007\006U\024d\336\336p\030\f\335\201\342e\304\342O`F\377\331N\231\355\262\213\232\334\307\214f$\310K\232T\031\213?\301\026]W\227\343H\3542\374\206\207K\233)k\276&\263!\261\367Vb\252\221#\363b\223\006\344Fk\314\314\342O\200D\377\231N\231\351j\032\006\017\234\360Y\356#\034\006\270k\315\226\236\305\237"
+	.string	"L\3779\2152\247y\033N\356#\231J\006&\273\303\366\302\342O\260e&\2431\223\343\f\260wM~e\0357\327\221\303\23139\216\204T\r\333\302\305\341g\204\356\316\236\3059nI\2230,\213?\201\224~\0067\372\317d^\225\231Ln\273W_[\313\203.I.\f~|\262\370Pc\3613\250\321\177\206Sf\270<F\"\271\245\200\320\216\370^h\331\242\307\342g\360\242\237\273d/\317_\236\277\3440z\357=\304\007\215e\336\346:r\370\363\333s\230L\225d\007\022\2133\230\232\366\337\367\353:\336\251\263\370v\352\227\377>\340\233X\236\305\317@\246\377\327\333?\357\251\343\336{\313L\356#UP\376\353\253Y+\207_\250\336*\200\377\370\377@\232\334Va\324\354\275+\236n\3226\265c\3036\345\366\256\002\223\212"
+	.ascii	"\230V\025X\216\25340\255\242\2534\260-U\225D\252\350\270\301"
+	.ascii	"\244\256\322\366.\252\252\222\032\361\245u\2256\265\213\256\322"
+	.ascii	"\266\326v1\247Uw\022LjW}\355\242]\265\247v\332\227\326\206\253"
+	.ascii	"*0\255\253\264)\255\242\25340\255\235\006\266\211v\325\324\021"
+	.ascii	"F\325>\026\3554\2609;\355K\213\350*\355K\353*\r\314\256J\221"
+	.ascii	"a\304\006\21675H\304j\227\253\252Mc\006\217\251#\221\334U\362"
+	.ascii	"k\327\355]\325\254\366q\313\355-\200\275y|\035\353\246rT7*9\032"
+	.ascii	"TZ\246\276jr\357\235a\006U\330\327\256\222\223\252[\356\312\311"
+	.ascii	"\327\336N\250\232\366\214\275\367\336@*)\267\213T9) <6\226\325"
+	.ascii	"\336\023\354\344\3363\366\226\252[n\357-\265\367>\217<\222{\353"
+	.ascii	" \272B\316\230\2617\027\206\031\233\207T\027\253\275\255\232"
+	.ascii	"\235\233\326UZ\330\027R\227+i\310\375\")U\257\260\2766r\327\201"
+	.ascii	"\035u\232\324\331\306\332{\327:\032\251U\203\216\305I \267\036"
+	.ascii	"k6,\316\\\322\2001\303\262"
+	.ascii	"\370\031hd-JA\260\200\261\370\031\\d\311\222\247j\321\336S{\310"
+	.ascii	"}\344\302\340\332\300\321Ug\3611\354\351?\253)\263Z\236\302\220"
+	.ascii	"\334[\231j\006\215e\336>ra \304\246dH\021\213\217\341\315\357"
+	.ascii	"\213\224\236\233\225We\266\222\3218\350]efo\2717\027\006?v\346"
+	.ascii	"\330\301\245\241a!K\360\304\261X)\002\02762\026\037C\026\375"
+	.ascii	"\347\263\244\n..*\311\372\253aeLG\225\fQ\272\370\020B\345\002"
+	.ascii	"]\365\205\255\314\254Ln\314\007\322\346\2624\017\b\335\201I\""
+	.ascii	"\311S2\231\351&\212\330\\\262*\017\316\236\033)cBH-6t\306\376"
+	.ascii	"\f%G\251x#\2545!\2638\327U\243\374\347'u\347\2240ajN\362\221"
+	.ascii	"\267,^dX|\r\362 \367NV\266|$\277\310W?so0\275\031r\226l0\262"
+	.ascii	"\213*\307\025\001\262=\313\2757[\214|$\323\310D\252\034\021l"
+	.ascii	"\346\016)\037\311X\021(\313[2\311\310\254$7\311H\362\222\234"
+	.ascii	"\244*\363\221\\\344Y,\033\321sGr\264\021\341\352V\217\362\004"
+	.ascii	"\325(\037C\231\036\202\231t\255\251b\3611\030\321\257j8\314\304"
+	.ascii	"\331a\207\314r\203\314A2\220\354#\367\310^\371+\013\311`\371"
+	.ascii	"G\346Q\2259,\353\2602r\224Ar\221A\3368\203\\\036k\332\357\356"
+	.ascii	"\335\243.km\345\032\277\273\367\027\232\034\226m\304-sX\356\252"
+	.ascii	"\001\006\227\267w\362\007\303lK\030\013\370\027\370\350_\200"
+	.ascii	"\243\177\001\215\376\005.\372\027\312\364/ \321\277\340C\377"
+	.ascii	"\302\f]\343\276\251_x\316\200\261\370\027\254t\210z\224oA\216"
+	.ascii	"\276\0054\372\026\312\350[H\323\2670\246o\341\210\276\205\037"
+	.ascii	"\372\026\266\364\325^\375\332\027\316,54\262,\276\005+\375g+"
+	.ascii	"\027\246\325\231\227\230\213\232\346\201}\241\210\314\321GU\005"
+	.ascii	"I\0343\200P=O\201\221C\246\217\305y\352mjV\364\274\361\260\370"
+	.ascii	"\317RZ,kJ\235\3058\013\331\305K\226\345\336\373\013\2305$I\354"
+	.ascii	"\221\f\246|\335\215\345\225\2051\341\272\226Hu\355\353n,o\357"
+	.ascii	"\356\213\206\244\232u!\262\024\273H\216 Q2\345h\257`\270\335"
+	.ascii	"\215\231d\352\336o\212hWQe!\335\230K\263\316\\c\3121\357\230"
+	.ascii	"q\346\034\223\215\251\306\244c\3621\361\230m\3147\246\235\271"
+	.ascii	"g\3661\345\31493\216\251\307\3143\323\230y\314;\023\216\211\306"
+	.ascii	"\244\013\250\023\324S\020E\t\023'@\240\260\364\223\006\211NK"
+	.ascii	"\346P\030,\246\306!1\311\007\365\224\344k\021tB\225L#'\247"
+	.string	"\017\320TX\314\300\233<\240O\302\224XL\022>\345\023\222\320\246$\n\251p(B\220\260B\t\023'\214A\022\025\336\344\201i(,\246F\013NNQ\303!qx\246@4\004Bc^A,6\245\304\341\271\024D\235p\212\032\237\320\247\234&\t\225\320\242\t\013o\3620B\t\"\240\370\260\241\204\211\023 L\240HL\203NQOB\343Q*\034\212`tdDOP@Q@\021S\024\346\233<0E\245@\225>(9\t\243R(\371\336\344\241\210\262\020\026Q\026\302\247\242T8\024\301\2072\r\203'\210\232\230\204$V\020G\370\031\323\241\220\b\2454\004!\311\bB*\034\n\211\320\244!ZD\227\320\242\t\243[-\306\251p(BQ(\005\006S't\004\372$L\201P\246\017~h\032<1\224~P\302\304\t]\302\304\t\240'\250\023IN\301\244\2407yH\002\242O\302t\030U\374\220\264\004"
+	.string	"#S\320)\004\246\241\360\251\030\004\372\241*\204i\322\007(\236\240N\030\205E%R\224I\350\007\212\230\242\030\"\312\300CZ\fBy`\032\n\207\303\250\023%\320b\360\002\261\330\202\t\027\241iP\t\312\204\013O\022\026\321!\312\244\277A\007\t\350 \004\213\363!\030\220\001\0032\310\017\301"
+	.string	"$$\006t\200\244\337\001\322MS\240\261\204\251\204>\025\203F\341\2104\n*\215\262\300\023\232\032[\240\240\220\n\245o\362\300\004e\241\210>\tKPB-\030\201L\302\245!Q\204\nt\004\232\006O\004\021\r\211Bc\021U1\024\341i\205\211\242\247\025&\224\320\244a\013\343\320\004\324\030\365K\215\305(\t\240\306(\241\026\305\024}B\235\320\022\212\214\331\211\230DL\211E\023i\221\be\034\006\213%X`\032\006S\244B\t\244\304&\343\b\324\0305\244\002U\272h\224S\020\003)j\\Z\262"
+	.string	"\352\244$\202S0\0252\t\225,\f\205O@\250S\232\022\213M)\213\340\023\220\3220\370\364DL\032\n\237~\210&~KP#"
+	.ascii	"\031\201\304b\013\246\234\242L\305`\372K\201 4@\237\204)\024"
+	.ascii	"\2218\302oI\304\210\017\200\236\242P\3702\240\204:\245\b\016"
+	.ascii	"A\030\256 *]@*!\350M\036\n`\032\201\304%a\bF\023R#\272\002\035"
+	.ascii	"\352L\\\022.\341t\bx\276\311C\232\024UL\215 \214@\026h\032\365"
+	.ascii	"TtB\022\321\t\b\314\3510\212\230\004\004\236Et\270\202\b\004"
+	.ascii	"\236\306\"j\214\032\002\201Zi(<\001\b\314\306\241\020"
+	.string	"\312\b\004\236C\242\320(tB\201@_\nL\215B'\2427y0\242P-\322\004(\241\305`\2231\001\037\214\2510\305\207\250!S\002XD\r\205N\t\330\240\003`\007!X|@\225\242\234\222\206\302\017Ec\324\207\005\244,\320\241SpXD\323\241\020\250\024D\213M)\024\020xA\005Z\204\002\002sj\024:\001\2019\230\006\225\200\300\\\f6%a4\004B#\020\230OH\":\341T8\024!\025\016\205y\230\215G\303\020\210K\302\020\224\202h\361\247\230\232H\032F\205\020L\203#\224\202\350\tb\261\305\0042\fC\020z\223\007a\312\002-\242NJ\303 \ta\312\0025J\207K\326\bLBO\234\220\024L\341\344\024\024!LY\240E\302\224\005\212S#P\b\205b\t\035\201B\265(\001(\202\t\024@h\3220\230\032\207B\235\002- \002\036\nM\f\215IY\be\274F\240\b\020\""
+	.string	"\211"
+	.string	"!\202/'\201\020\3367y0F\245\310`\004\226P\"*\242\2511\370\224\215F\264\250\244\024<Q\025A'\024QPO:\n\250\002U2F\245\320F \232$T\201\2160F\245"
+	.string	"B\201(T\213\022\214Q)|(T\213\324\030\225\3424F\245\270\304\"\272\001-b\304\007&(\254\b\236\0201\342\007-F\245\301\"\n\365\204\246@\351\233<DA=\001\211\305\026LII\301\017\306\"\252BXT:"
+	.string	"\n<\221\001\007\031t\020\005\365d4$\n\323('\242\021-\376\030\201\025P`\024\324\023P\352\024eDO\240#\242\240\236(\240\300!\223\320)\b\374\r\231\204N\037"
+	.ascii	"\205B@\242\002h\032<\321B)\210\236\b\246A%_\321\270\004lb\022"
+	.ascii	"6\001\227\240\234\202\226\240\234\200!h:\001\204\006M\024\214"
+	.ascii	"P\304\342\210\"\252$T!\034\021\005\3654\224\002\231\202%\020"
+	.ascii	"\205'S\260\004a\312\002\204t(B\024\324\223\020\n\374\241\305"
+	.ascii	"\340\n\245b\220\304S5\002\201PKF,\204\3054X\"%\026\177D*\316"
+	.ascii	"4\005\202\320 \035\nO\246\241p(\f>\241'\214\250SR\213\244!#P"
+	.ascii	"\004\261\330\202\251\350)\312x\3237y06\245\301\247!\360\351\032"
+	.ascii	"\201*P\245\324x\226(\201B\311\211\b|\312(V\240C\340S.\006U\334"
+	.ascii	"!Q\230\006"
+	.string	"\213)\204N\301$ \020\304b\013&\240\264\211I\210\256\310F`P\372&\017\300"
+	.string	"(9\021I@\t\235\222\206\214\300\020\210\305\026L\0244\3124\f6%\345sE\360\2041\212(T\201\026\241\200\214'$E\245\306\240<\f\242%\226\226\204J\032M\032\006\205\305 \006\226\226\204JAC\242\320\030\265\224S#P\005:B\005:\002\305\212`1h(\f6\211"
+	.ascii	"JA\030\255\021\2102\005S\024\025\220\214\3264\002Q\245`\2221"
+	.ascii	"(b(\035F\021E\240L\301\324\370\223$L\203\2511\250\202\223\320"
+	.ascii	"Q\372&\017\304b\013\246\017\306\"\3218D\215EQ\300\021\210\305"
+	.ascii	"\026LF\351\t\325\b\004B\323`j4\3214\230\242@J\241~ \214\306 "
+	.ascii	"\324\n\242\323\357\250\230\232 J\215@\rb\030B\013'(\250\017,"
+	.ascii	"\374R\020-\254R0\n\004\302\024\277\fRX\244\024\026D\n\213\024"
+	.ascii	"\264 \202\026\211\205\005\301\302\"\265\260 \206-F4%\245\304"
+	.ascii	"\341P\bH\240i\360\004\212\244\244\340\020j4\201X\002\261\330"
+	.ascii	"\202\311\207*\021K\f\211\3024\tM\211E\023\0260\006I\020\213-"
+	.ascii	"\23020\r\205L\023p\nF\215@\215Q\025R \013Ti(\004\032\223\204"
+	.ascii	"O\301a\013%\340\005\243\220\305\007LQ)\320\021\304b\013&\241"
+	.ascii	"\240\2410\005v\200\224\016\205Q\232E\260\304\022\324\b\303\026"
+	.ascii	"J\276\023\214\301\022F!\213\017V\020\235\226\212\250\n\"Q\n,"
+	.ascii	"\022\323\340\22305\202\360\004u\302\350ND\242\004\200\246\222"
+	.ascii	"\320)\250\302L\337\344\341\303\220\370\364DL\242\340D(\264\370"
+	.ascii	"!%\022\213\037\200\202L\350\023\3214\002C\b\246\250\004\202M"
+	.ascii	"PN\301\"4\312)\250\302D\323`\021\027\321\324I\270\224\263\321"
+	.ascii	"\004\324\t\352)h\324)\320h\002\372$L\265\321\004\335\224*\tW"
+	.ascii	"(\r\203)|\250S0\311h\246\300\020\351P\030u\036\tI\304\006\023"
+	.ascii	"H\230\200N\362`,\022S\342\323\207\264\211I\350\264\364a(\f>}"
+	.ascii	"H*\032?x\230\300\210&\025\243\210\306\363\277Fr\332\021J\366"
+	.ascii	"\221\362\346\210\336M\303\265\244\214\221\034\346g\367e\310\031"
+	.ascii	"\2617\265\016\210\024\031E\344\f\3410\243\346\013\221}\316\355"
+	.ascii	"\300B6d\356\207ew#K\310\031\003\257u\021\t\013\222\261\314\341"
+	.ascii	"\263\207\016H]\320VX\020+\026g\267\037/5]i`o?\271*{E~\314\330"
+	.ascii	"\001\367e*y\202A\001\333\362q:\241\241\345\213\256\307I\326\342"
+	.ascii	"\256O\227\366j\213\023\013cG\363\310v\344\330@a\3331\207\207"
+	.ascii	"\253L\313b\275\245\267t\227\226r\261\246\271\256\273\360\235"
+	.ascii	"3N\352,\3269,\2301U\303b\215\303\315\234\f9\213\365\215\372e"
+	.ascii	"\257\216\b\234\305\332\306\271\324\t\003E\212\305\267\243k\320"
+	.ascii	"Y\303\302S\243~1\243\324\013c\361\003\360Bk,\215\245\217\366"
+	.ascii	"\353ko\344\311\026\204\3132\353\372\b\005-N\027\2135\r=c\203"
+	.ascii	"\236\376\253\362m:\306\031r\357M\024d\207\267E\315\342o\270\243"
+	.ascii	"\177\r\343D\323N\326\342\274\312\230_7\252\334\222ieo4\264\225"
+	.ascii	"v\321\345\202\013\322b\f\004w\304\202\263xoOS\321A\200\2303%"
+	.ascii	"[z\352\232\352\315\264\202\2037g\261\226\372\333\236\265*j,\326"
+	.ascii	"\373og\231\2700\037\033"
+	.string	"\340\350\321s\362\251\307\343\336\\[\252N\002\312\260\204\200\311\333\\68\374\247\336O>CvC\336\310X|\356\251_\356\\\037$x6\250\2718\261H\300gm\211\305\257\3123/\307I\200\016V\020<5\315\322\235\301\242\262\270N\235\323N\036\026\230\216\237\233\2738\035x?\355\374\330\271XS\313[~d\316\264\324(\347\3149wU\356,\r]\250\332\364\b\222\241%O\314\342oH\022'\316)\247\311\227\241)10x\356~\312As\305e\215\313\177\237^\022\206)\250C\022$r@&\005!\216\244\030SJ\321\bm\223\016\363\024@0`D,\024\314w\305v\023\300B\013\013\365\241\036\007\235bfFDD$IAJ\3319\302\240\311\031\361Q\207n\314\364\"\344y\271\377\200u\020\026\367\354\331\3253\240\251\320\307E\334\335\263\r:u\336o\267\003\030D\2077(F\362\203-\004'Sncw"
+	.ascii	"\365\241D\021\254\221y\226\223\021\351\034\363\324\213\317\276"
+	.ascii	"e\027"
+	.string	"\\\211la3\f\220'\\\334\034n=\025\377\375\320\3373(\230\307^\353s\301\207\026qi\001\b\336HN\202\241\243\230<H\t\273\363wb\b\200\241\\J\255\227\376\023F\243\324\370\212\005e\253\177\210AM\b\361\355&\233YP\225\016\302\242\3374+\334\354P\311\213\253\177\353\221\244\336\034F\251\001}z\323\321\277\306\020\220\n\330\245\021\320J`\352I\3772d\036\347C\004\303\b\025w\007\326G\201\\\002\002~\374\266\222\253Z\004\377w\177\025\221^\037\024Y!/B\361h\001H\373\343\353\206M\334\366\275$\357\354\267\315\004\345C\347\n\316i=\252\006a\341\331\2656\270!\2128L\213\001\004C\247\032\256 \277b\005\007\t\\\227\346\267\266\206\034\003\035\232F\306\307\320\336|\276\304\251\336\207\312\214\f\201\246\351\312\241\210\020V.)\202.\346\323=K\220\202:\300g)\240\275e\222$\236\351\363,\305"
+	.string	"\203\306=\334\312\234D\215\022*\3465IB\315\350\340\360OM\032t\030}\007\371\n\224\r\346\272o4C\350\242u\n7\221\224r\216\tH\356\312\301.\332X\002}\b\337\354\003\206ve\217\261_Y\001.jh0\305\361\004\333\263\\\020-s\320\350\004\375^V\212\200\b\206\266>\271)~T\030#\234\004\006\274mu\340\302\276\244p\337c#\021DsB`\374\230\243\262\002\260@\356\004u\324X\367\022\222\327=\206\254U\220a\210\252{\205]\311Hz\250Y\237\301\271\324=A\245.\206\361f\344\303@*q\305g\263d\342L\fz\261\277\204\214\r\203\327.WH\217X\351\320\206\267g\027\332\006{:\262>1\004a\301:\224`\307"
+	.string	"\026\352\364\316m@\031\002\242\327k\303\360\n@\353\0133\027\323\305\013\017\370\307\024C\334Z\216hT\243\273\220\006!\027\322\235\227 4\177\213\326\004\255\034\352X\037M_sK]\265#\223=\031*.\336\335UC{KA\261K\025\340?\326\214O$\004\007#\377\003&\270\r\001\2737\034Q!\355T\262\372\246\355\270\316\203\355\313\256\366\235\224j\254\020\242\322s\022U\333R\035\366\302\204Y\331}n\220\303T\303\366\261`u\025\032<k{\333\246\377y^q\252\b\233\340\3530k\350\307+\251- \311\376\331\200\310Ua\370]\266b\232\353\033\371\013\260\376\266\362\237\226;g\257\3137\247\001\236$\373\371{\006\342:XH\2055\256\017X\254\246\342\001\256\234\264SIO[\260\242e\315r\300R/3FF\273.\300\0244\224\217/y5\004\034[\"D\321\266\032\r\356!MtP"
+	.ascii	"Bj(\005\003\337\223G\251\217\250\316\202^r_\037^n\371\243,`\332"
+	.ascii	"\002$vVb\003\2319\202a\322\272\\\364_\t\327\001\242\016\332\200"
+	.ascii	"e\t2\272\262e\353\"\375oV\326l<\003\222|aQ\231\327\322\312W\005"
+	.ascii	"\241\n\240\2121j\223\352-%\020\330\231@\016\227'\343\244\261"
+	.ascii	"\277\270]u\306\317\202HT\024\304\007\222\241\006\317\371XI\277"
+	.ascii	"\322\213\205\1774\224\340\262N1"
+	.string	"\033Jjo)\233\004\362q\241\236q\244SP\231\311C\274\354m?w\004\274\315\3048\333\226\nz\230\263\300\275\002\343w\375\004\270}\267\b\217\276\021\003\233\241,\201\340?\373\272\367\\\032%\021\215\021\277"
+	.string	"\t}\354h\364\331\343"
+	.ascii	"/\210\223\351X\251\227qc\350\302 ]%\333}\247\3233;\327\251\233"
+	.ascii	"\r;\026\365Jd\020\352\310$\211\202\007\ff\365\216{\242\004\203"
+	.ascii	"(Z\227\03377\355\230\367V8*\374\244l\037\027HFd%\361\007\035"
+	.ascii	"\021\277\275\305S\260U\245}\312\351x_\232hr?q\310n\r\227\201"
+	.ascii	"\347\030\275:\242\231\2031z\021\305\377+\227#<1&6 \251\221&g"
+	.ascii	"\343\310\237\305\206\200\232|\341\347\266V\332b\320#Y\365\230"
+	.ascii	"0v\302\211{\317\205\030\254.c\2174\273\300\035\310Oh\267\274"
+	.ascii	"\272z\202\235\370\366\355\340\360\302h*\026\371\344qb6<\251\375"
+	.ascii	",\243Cf\337i\030\215>\217\f\024\272"
+	.string	"p\241g\177\351\213\030\211\230\003b?\206~>\333x]\nB\r\356\342\034\241\277\301\323+\271\240IS\217\320\033f\234\275\370\fi\363\f\027w\217?h7'*Bu\315@P\026\001\333W\330.\247`T\262\204\344\222\030\2566\215B\342\362\224\030\221\004\251]\340\223=%C\354\302\326Y*\213A\240N\241\254\347\215aD*\177\005HI\367\026\304[\br8T.\266\261\030\355\376o\331\020\265jq\344\304\275\b\021\234\365\007\331\254\0077\202v]\274\307\216#;\357\f:\226\210;\323\305\370)M\276\243r\031\006z\236#gJs\217@\013\347\203!e\023^8\302\0160i\016\311\312\245\375\036-g\bq\230`t&\035\252\374\316\230k\340\312v/5\f\324-\"e\257\r\036I\353r_]\214\3447\025(L-\025\3343\302\037\257\256\242\322\303\325\365p2\212\323Ah\272\260\363\201\344\313\022\361\300"
+	.string	"5\f>\364D\265\276\203Z;\032\305g\n\336\fE\307\207C\f\225ue\273\016\377\335^\003\334B\264+\306\257\356 \224\270Ox\032PK\325\334n\222\264\2641)\003B\216a\372\224\255n\326A\b\314\376(\201\331\375\031[n%<\310\2165\027D\020\3746\234V+\207\274\372Xu\326\001\370\330\252\256\367c\210i\035,#\331)n(\030\247q\265\203\026A\241\304\236=_\034\236\214\306(\227I\212\267\0261]\314)\013\265@<SeU\033\\\232\b1\211\357\211\264\323\354\f\321\211\300\0307\306\236\017l\207"
+	.string	"sW.\017\317\220C\256P\007\206\351UVhw\027(\213H\311\364\330\320\270B\257\b\r\201\300\035\367\225\343\322\243\377\367\303\037\363-_9=\3512\276T'\254\277t\277\340\335\201<\265\001\004\213\274\233\006\211"
+	.string	"\b^\270\210\004\266\311\320\b\245\006-\342\013\251\262L\326J@}\357\352\372\223C\351:Ab0\n\324\220\273\033b\207\331\313I\354\246\037\322\\\210\""
+	.ascii	"E\332\254\246\2166B\207\031\362\304\230\332\355\211\352?\271"
+	.ascii	"\233\213\252CI7\bQ\252Lt\347H\324\006\202\"\f\003\205-@\231|"
+	.ascii	"\310\343\241C\263\031A\035!\331a\r\262\306\277\273\326\231\007"
+	.ascii	"\347\201\353\007\366\254\315|+;\344\017\354\026\340q\f\221(\247"
+	.ascii	"(Nd\355\023\t\220 DJ4-A\004*\354Z\034x\336}\274\200\246\345Q"
+	.ascii	"\366~P\336z\355\t\345\025\236\332\3628C\350\370\320\006\310\360"
+	.ascii	"\313\305C\231\247\373\227\323\027;\341\256\237\320\2075\035E"
+	.ascii	"\006\001\260\363s\377\275\020\006B^e\331\267\004\220AZS\252p"
+	.ascii	"\262M(\210\250\235\272\035fb\f\177f\027UPR\302\310u\232\237\216"
+	.ascii	"\231\217\225\026\222\307\221L\215q\212p!\356\003n\245\177\310"
+	.ascii	"\313\267\301\317\3319n\215\031\\\031\312\207\b\376\354\330S\270"
+	.ascii	"4[\342?+p\r<-\355\037\214U7\344(1O\370\211\256pB\f\032\0359\253"
+	.ascii	"|\230\201\254I6W5\370\022\\'\324\335\\\204j\t4x\320i\252\007"
+	.ascii	"(#C\335\223\354\\\027dS\rwaVgm\020\321\277>3\231\315\260N\317"
+	.ascii	"\022\307\310\244k\372w\231\313\347\223\f>\361k\3458\004<\234"
+	.ascii	"\364\257\033Pj\240\250>,\356\324\313\035\2163T\016?T>\212\274"
+	.ascii	"\207%\357_\266R \210q\306\210\260\035n&P8\323\321\241\257\345"
+	.ascii	"\013\363\236\276\001\214\256\270+C\3050\221\347w\035JK\313^!"
+	.ascii	"\360\235F\264gR\317\017D\301\321'\227\305\342P1\004]\277Q7\347"
+	.ascii	"Z\001\266n\226o\344D\322\331\373W\347\225{;\3772\372\254\\H'"
+	.ascii	"40\225\211\324R\212\220\273\264<\367\310m\274\230*\277\377\032"
+	.ascii	"\0276^\276\334\360\360\352\360\304\006\376\006\326D\364\325\302"
+	.ascii	"\317\351\203XC\327\262\004G\273e\311\230\225\244c\331v\250(7"
+	.ascii	"\033\0223\236\320\264~\251\245o%\325\031@\362\311\036\230\031"
+	.ascii	"\036\312\266\354'\263\030\361\246\345\230\337z7\322\335\004J"
+	.ascii	"\006m\177B\033\335|\220\2619\321\fEU\312\233\327\202\302\321"
+	.ascii	"A\344\262,\035z\357\025\323'%\335\nI\307\265[\202A8ekE\245(\202"
+	.ascii	"\370?r\020\031A\302\225\313\372\317 \370kI9C\252\006:P\370\217"
+	.ascii	"\310e\262R \024^h5 p\354\235\242\031\275\313\311\342\351\013"
+	.ascii	"\363\3406PI9\217a,\366\246\025\262s\306/\207\352\260\013\216"
+	.ascii	"k\351\327\244\240\301=7\253\263\223DF\t(oV\267\317?i\212\360"
+	.ascii	"m\312\371T\007\307\341O\032\303\251\303\017\373egaII}5\363\203"
+	.ascii	"\250\022\025,\367\276\222\n\251\335\265\004]\3727\020\204hu\020"
+	.ascii	"\002\236\016\27028\341h\3037\210\223\316\374\033\326\n\233\016"
+	.ascii	"\310hN*"
+	.string	"\343\tr\252|\2350\202\321\274\031fFm\006a+[\260\251\035\236\221h*C\033\203\2777\021\017$I\213~\273\030\0327!\320\327\247\353\016\006ul\2465\223\332\341{\0138A\204\\)\2154\363\361\265,\314\217\257 U\024\026Fn85\230\310\013\340\267\340L>\311\002\213d\322\b\345\031\205G\032\002q\237\006\035\306dGoT\352\001@ru\347t@\226\007\375\357\330@\247k\020\203\2610\3364\007|\350\033Rk\247rP\270r\303\315\310\212Z\222\302\203\275\021\250q\003\005\217\fq\312\302\322\270\030W\223}\335M\034T\363\270\326}9\331\377E\275\035\365\f\202\001\335D\233\262%\337vQ\271\356W\t\f\250\034,\331$a\200\231\274G\355@\322X\005\2654tu\214H\t\007,\3048A\210\222\024\314::M\225Do\036\223\216*hd\025j\234\214\322sAC/\213\330\207\342v\321\332\270"
+	.string	"\302\t\036\230\203\310\3323\3320\"Z\252\t\213\203D\204\250\343\371\227ZO\336\031\263\027\"[4\377A\022\302#\306k\0058\265[\246<}\251l\002\330X[\327\032\364\213\375\006Y\331\2249g\326jV\337xz\036"
+	.ascii	"Q\020\356\224\334\221_\223+\276W\360\353VM\003\206\336)\354\034"
+	.ascii	"\001\na\310\307\356\177\273hZ\311p\207Mw\204\214 \367\247LS\314"
+	.ascii	"-=h\371\212Y\320\033:\227\225\244Be,Ad\002sM\321\211~\230\007"
+	.ascii	"?\201\242\204\217R\036\205\2653\266\225\330\004\236\247\217\350"
+	.ascii	"\211\306\006\227qq\3129\007e+k\255\332\375\210\360\347\007\005"
+	.ascii	"qr\324\004@\312GQ\221\036\321\213\236\360i\033\241)x\321\\F\354"
+	.ascii	"\253\320-0\225\\\354\370\035O"
+	.ascii	"4\324D\362\203\0312\224\374\032\326\366F0x\371\213\031M\313C"
+	.ascii	"\344j\2011\271c\343\316Pv\273\207\370\004\261\376\347!\002\331"
+	.ascii	"\215[1 \r\035\307I\323y%\035X+)g\252T\204ZTI3\307\262\004\330"
+	.ascii	"`\032\317-W\307-\036\314.\327\177z\254\005\241\303P9|\2466Q\324"
+	.ascii	"}\334ws~\370\331\362\264\306\241602\273\256\335@\026\377Q\316"
+	.ascii	"4\314\377b\304\365%\3659x<\245\263\330\345n\326\243\247y\022"
+	.ascii	"\332\035\016\016s\306X=\301}$c\223\3137\0257\354j8\304z\340\007"
+	.ascii	"\310o\277\030Xz\001\351\353\310\323\261\2670\235#\240<\346=5"
+	.ascii	"\303U\2170\275\330j|'ng\b\333\307\335to;X\254p\264\357\223j?"
+	.ascii	"\337Q\203\372\237d\3332{+\372\315\302\332\007\n_\315\303\330"
+	.ascii	"\242Iy\366\207{X)\036h\355\272\232:sJ\273\365\307gj\007\303\241"
+	.ascii	"\261k\036\324\276\300\204\"KU-H\315\207'\\\0365\211\032 \272"
+	.ascii	"f\375\231\375\234c\001\225S\304\374z\362\204\346)\360\334\235"
+	.ascii	"a'p&>\203\363{\375\260\210\227\\\206?\374\203\375v\343\257\324"
+	.ascii	"\226\272\037\244\200\323'9wm\355\251\372I6!\177-Fe\232\372o\034"
+	.ascii	"\034\251F8\270coV\261\251\f\324\273\036\247\370\305"
+	.text
+	.section	.gnu.lto_.symtab.d1f96923951658a,"e",@progbits
+	.string	"motorRpmEstimator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"motorOutputDisarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"motorOutputStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"motorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"isRpmSourceActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"motorRpmSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"calcMotorRpm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"getMotorRPM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"motorRpm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"getMotorRPMAt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"getMotorRPMRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"getMotorRPMAge"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"rpmSourceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"motorOutputRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"motorInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"motorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"motor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"motorStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"motorSetDisarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\003"
+	.string	""
+	.string	"motorResetDisarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"mixerActiveMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"alphaBetaFilterUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\003"
+	.string	""
+	.string	"alphaBetaFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"simulatorGetMotorERPM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\003"
+	.string	""
+	.string	"alphaBetaFilterPredict"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"simulatorHasMotorRPM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\003"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\003"
+	.string	""
+	.string	"checkMotorProtocol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\003"
+	.string	""
+	.string	"motorWriteAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"mixerGetMotorOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d1f96923951658a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
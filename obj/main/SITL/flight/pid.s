@@ -0,0 +1,3355 @@
+	.file	"pid.c"
+	.section	.gnu.lto_.profile.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001i"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\272\b%\036"
+	.string	"\324\036\256\t"
+	.string	"x"
+	.string	"\360\300\300\245\006\n\002"
+	.string	"\001\350\250\366\304\001\034\002\001\002\001\003\002"
+	.string	"\002\004\005\005\002\004\240\342\234\212\n\003\005\007\b\t\203\331\213\246\005"
+	.string	"\n\240\311\220\241\016\013\263\272\250\370\006\020\002\006\r\016\017\020\021\276\356\330\363\001(\002\007\002\007\b\002\b\002\t\002\n"
+	.string	"\002\003\005\002\013\002\f\023\024\025\026\027\031\223\361\350\324\0062\005\002\007\002\r"
+	.string	""
+	.string	"\013\002\f\032\033\034\035\036\361\370\215\322\017\036\013\002\f\037 !\"\321\354\231\370\006P\016\002\016\002\002\r\002\017\002\017\017\002\017#$%')+,-./0123\242\244\203\306\007\b\016\002\01645678\231\311\230\203\016\002\0169\343\250\231\362\004:;<\254\362\301\224\t"
+	.string	"=>\251\266\340\304\002\b?@\335\210\325\316\r\006\001\002\001AB\260\330\270\314\002\020CDEF\352\263\360\321\bG\244\204\220\313\007"
+	.string	"H\354\206\342\366\006IJKL\217\202\332\365\n\b\017\002\017M\310\351\257\227\n\004\002N\327\255\213\231\013O\363\317\227\227\016\005P\316\374\246\332\002\314\001\002\020"
+	.string	"\007\004\002\r\021\002\021\007\002\022\002\023\002\023\002\007\002\024\007\002\025QRSTUVWXYZ]^_`\365\264\375\370\017\b\002\016\002\003a\344\313\223\351\t\004b\250\350\313\243\013c\300\255\310\301\f"
+	.string	"d\326\306\361\375\017@\013\002\026\002"
+	.string	"\002\027\r"
+	.string	"\002"
+	.string	"g\333\314\346\311\005"
+	.string	"h\353\377\305\205\005\001\002\001i\334\372\347\356\013\340\001\005\005\005\005\020\027\004\002\004jklmopqrstuw\332\253\224\346\005\002x\242\262\337\300\t\002y\233\360\217\257\013"
+	.string	"z\377\341\234\356\004{|}~\177\336\215\314\344\r\200\001\273\374\372\335\004\201\001\202\001\243\242\371\255\017\203\001\274\370\307\304\017\204\205\001\277\332\376\350\b"
+	.ascii	"\201\032\250\261Q\031\021!I\n\2224\006Q\005\2121\307\230\335"
+	.ascii	"\001\022\200\263\032\n\315 \252I\n\205\375\2175(\251\315I\356"
+	.ascii	"\264\275\035\271\352'\\\353\267*\006_\331'\237\326\210\037\362"
+	.string	"\303'\343\n\251\331\346\356}oBl\264\241\322B\177\031MCT\251\3155\252.J\f\374e\276\366\275\254X\234OZW\306Q\301U\037\232\375\"\374\022R\023\335\363*R\013\002?\260\320Ye?$\272\037b\221\013\234\316\360-W\036h=A\035}&\356]\374\021\230A\251Y\003#de\026\262\273\223\245!%\363@^\316\013\324vb\372\034\315\363o\3042\025\2105dA\214\bUf\323\310\237A\301\246/\0058\365\254\270u\352\247g\234\221\351\362\266\260w\266cv~\345\342\3174\335L=\246.\267\307!%\234\244.\341\220\206t7\240#\366M\274\365\276\037Bn\303\323`Qi\032\346yK\341\243\264\371GH\277BF\2053_-\322\001fP\300\301C\227\365\257\216\366>\013\3567\261\261h,h\253U\376\305|l\272\327\nrv\240k\340i\324\214\"\237!X\026\261v\362\323\021D\363\344;"
+	.string	"s"
+	.string	"\225=G\346kd\367\327i\2717\227\375*\236OI,$N]w\207\274jA,sQ~4\t\357\263\327\274\305\036\311o\274\333"
+	.ascii	"%\244k\213^\304\222\273\217A\307Nc(\212\305\243\304;\317\371"
+	.ascii	"\273\3443\033\f\251>\026\235\272\372It,\2314\bg\262\241\223\322"
+	.ascii	"\254t\021N\305\201&\326\210\244\260\375\230\305\350\022\002\026"
+	.ascii	"N+\313X\361\022\035\t\357]8\303#\374f\247\300\333\213?h\262\264"
+	.ascii	"\256Z\275\224b\314\f\223\366\260Q\261/h<\030\342\032\234J\221"
+	.ascii	"\244\325\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`i\003\r\r"
+	.string	"B\317.%\320XI:H\214I\213\007\205H\311*~A\212v\207q\271\023\200\3350\205YQ\202\243\\\2606\321\222-\223\f<\342\034o\2166\307\232#\315\265\231e\216\271\325`\310\276\334.l\275\232]\315Z\210\226YV\246J\312\r\345\304\204\265R\245@><P\247\016\023GiC\343\302\202\242\023\022\021\r\f\t\031I\204p`P\020\032\020(h"
+	.string	"\354\257\226\324\207K&\tk\216\334Z\277:\252\216\"\307\020\214\240\326w\n5OW\323-\365\313\300\370\212y=\267}:j_\270:\317\231\274\3116\331;\177\030b\253\250\357Q \331:\243?\362\b\312\362\030\360=\3111>K\0076\224\200\207\250\240R\315\024\024\024\322\001\320\002\031\242\322<\021\360\244k\2166\311\376\354\006\203\201\341!\347P\342\225"
+	.ascii	"\267!\243w \216\366em\263\244\256LD\376\030\352[\215\260\350"
+	.ascii	"\211\r\275w\356R6\177\215\331\326m\330\372\237R\371j\221\t&9"
+	.ascii	" \321\221\272\251\026&\342\232\375.K\b\020o&i^\327\234\221\236"
+	.ascii	"\274U\334\246\274T\204\344\031\212x\305\\-\204\347(%V\025\316"
+	.ascii	"Y\351\224\022\373\227\003\360)94\222\025\270\200\3629;\267\270"
+	.ascii	"\033\"\341\276\206\231\230\026\227x]\024\363\204\200\030\272"
+	.ascii	"\264\306i\217DNQ\302:Y\307?\326\216_\200$#\306\251\310\021\347"
+	.ascii	"\373\271I[\211\235\242\265\b\277G\020C\321DP/\235*%d\007A\240"
+	.ascii	"w\250\272H\036\022\013\0312\274o\t\254\360i\307\236\217\247\032"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.inline.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`/\021\355;"
+	.string	":Q\264\020Dp\236J:H\244\341\340\017hX~G\2357\344\325\255nPI\255Oa\2677\362\017\321\201\342\2701\346\242\257M\352\037>:@\250{S\t\t\213Z\200b\243\234\247\200\322\336\204\032\201\272\032\3626\266\2242\005\364"
+	.string	"\361"
+	.string	"\375"
+	.ascii	"\213\200\251\026\001W\355\277XV\003\200\267\024\307\215\211\311"
+	.ascii	"\361\267\037}h\374\320(D\177l\232L\235D\007\226\224\362L\317"
+	.ascii	"TiO\205\247K\\D\262\245\361\351i\023\257\0213\373\372]x'\036"
+	.ascii	"#w\246G\340\347\3173\023W1B\307k\365\352\364\f\371Q\001bD\310"
+	.ascii	"n\001\370o\304\275\032|F\274\302\312\032q\325\217\230\306~7\203"
+	.ascii	"\317\210\251\356\003\305\n\222\256\3179\321\320"
+	.string	"h\236\310{kH\033C/\337T\244\305\237\037\252\353\310\331-\3310\372\277\210\201\274mH@\246\342~G1\033\222k\310\341|\300~\243\232K\2318=LH5\231\023*[\022\376\373\367\037\032\373_!\032\305\306Z+\020\377+\325n\265\026\203\016`\377\375\236\377\007\265T\227\231\265\341 \301e\206'\016\002p\371\354\304\265\326\352\373\2478\253\326\312\200\377\236b\035\265V\340\277\340CH\001G\274S\356\350\314\214n\341\237\361\263\002\336\345/T\317\325Z\177^\341\251+\377Xk\r:\205\271Z\273\200E\237\340d\244:\356j\355\n\366\377\004\334F\243G8s\363\320\330A\275A\255\240\026\375\n\360Qb\233\021\302F\007tj\236*\365\336\335\233\035\036\253\265\350c\352c\255W\374\362\345S\203\325Zc\350\237\352b\030\272\342\256)\377\340\354\023=\350o\b\337\311V\3577\212\216\202W\006m\331\256\300\347\277"
+	.string	"\337\377\363\326\023|\205$\342e\277\365[\211\375\003L\036\235\201\013/db%_\252\033\237\263\360,<\321pz\274\360\266\211\203\254m\321\3619\233gS\251\217xg\336\366e=\221\301\220u\301+_\276lj=\263\2753\345i=\261\317\274\320v\224\347z\256\347\272\310<-m\277\037\212\305\330\210ei \364\037\001\357\322\177\257l\212\263/k\025\252-\024\236\247i\226%\245,\024\326\363y2\361K\263\276|b\271z'\256P\235#\254N\355\200W\020\261\275EN\b\3266\366\211\336\360\335\034\234[?x\354\023\215\211\355\032k\013\025\375\340R\237h\004\007a\260m\303\352\322\216\365\277\220L\326\311\252\365\n\351@\356"
+	.ascii	"\344\022EL\243\351]'\261\325\332&q\325\362X\177\215|I\324\255"
+	.ascii	"\367\270'\227\365\351\250Vm\223\330\352o\260\376~\360%\361\212"
+	.ascii	"\037yiC\366\265\310\217\370_k\200\250\276\210\022\213\246-\337"
+	.ascii	"\250\265\b\364!-\317\323\246N&"
+	.string	"\223Iz\023\313w\312V|\n\330\212\261\370\022\260\025\024\227\325Z\374=\304\376\370\312\247\247&\314n\250-m-\316<\b\017\035\376\263Ss\330@d\244\026\217\261bO)\242d\215\007`\327\221\244\333\204c(\357D\211\314H\274\247a\346Cb\253\363\367\251\313\013\263\334\266\3424\t\237!#\006\f\356\027g\205\007A\345i\271\300\246o\250\006s\341\326\002\351\206\330\236\234\362,v\310\007\264C\243\206\274\017\215A\255\375\336\367\257\371\023\300gyOX\223+C\177\n\276\221\207-\215\017W\212F;K\372h$\004\246>4^\251\343\320\340\344p\0272q\356\020\350\177\271\276\312\324\024\270\324\377\255\262@\246\212b\312\265\303\250\221\241\351\3239pd\364\004_\232J\375\322|i\022\371\253\210e\343\350\245P\355M\026^\020S\224\275\360f^/\361\233\236\232#L\212\234\371Q\376R\314\005\017\314\313\016\tp\363"
+	.string	"/\363\\?\330\340\016\266\210W\374\247\fy\334\2618\356\024\364'\256%\365\3313\032;9;\241\023\313\023\273_u~Cq\224\260\272-\2777=qez=~\351C\036e\205\312\n\372I\353O\372s\177r]\3421L\306<\341\237?\211|<\227\326,\315\2476\222L&\313\201\223\250!E\206\314\314\210\210H\222$\031\306\321\004\204)\304\250S\371\022@\0049\007\263L9S5\"\222\242\222\224\321\302nph\3311\035\223\022\357k\005\2044\314\013R\324mJP\323\326 /\334\231npk\236\377\f\365iK\343/\324\031\220\031\251\372\220\035J\272\325\236\247E\016\256\n\276\242\345\022\215\224\004\321\372S?\267\233\360s\304\321-\350\212\307\037\r^\320\213y\004\372W\234\354k\276W\341d\255\026;\222\201\202\205r\322F(^\371\320\376\324S2z\365_"
+	.ascii	"\321\227\004\235i\222f\265\376\334\250I\027*\3127<WtQ\342R\335"
+	.ascii	"x\326p\261\026a\351\243.\007\335\242\t@\305A\021\3534\224mX\255"
+	.ascii	"\016;:\346]\026)f3\315G)[.\200*o\362\370>@l"
+	.string	"32\247u*\277\206\233\037\321\253\271\356\254G\217\237\346\025\273\314\301\236v\323\276\013s\334\034\211\2553{\355\206\312oz\354\b\223\233o\326u(\033-\246vs\003\231\340\033\\\033\317^\227\310\237\006j\023t\025;\rJP?\253\346#u\254\253kl5\034t\202\207\230\265R4\304\240\035\001p\032\304\2405\35398\302\206\344\3534h6m\376t\211na\337q\022\332\324\225\251\333R\227R\367\244\2137\017Jd&\216\260\212`76U\024\305\304A\307HT1\324\265%\213A\370\200\210~X\373@\354\201\304\003\261\003Y\007\222\307\031\263LJ4%i\242\224\311\244\376N\200\206\252\270\315a\n\r\334\330\202\263\274\300\236\233\207\006y\331\032mO\037?p \n\343\204\"\032I5\024\023`\2369#\240K\344`}\266\203\216\222\223\262D\21168\376D\204\330\255#\373\250M]\201\310\213\257\215\270\377"
+	.ascii	"\312\203\362\317\3055{\272\257Z\372\273\177\263t/\033H\2034\257"
+	.ascii	"\024\252+\340b}\242\256\021\003\245[\211\213\323\023*\342{\307"
+	.ascii	"\026\334|\352=\355\301\235H\323\\lf\246\022\310\334\237\023\273"
+	.ascii	"1\204\216\240x7<\257H\2226lr\363\217!\250\022Zo\375\320x\013"
+	.ascii	"\257\2269\346\276\231\343;=J\321\350\316\314Y\035M\206\035\343"
+	.ascii	"\320\017\271\200\\\225a\t\374\222\2729\375\242@K5~5\274H>\021"
+	.ascii	"\r\020T\34699\210\2478\276\307\332\301\240\246\234\006w\244\036"
+	.ascii	"\3114\234\332\324x\360L\276^4\347J]\216\334\214H\231\225L\261"
+	.ascii	"d\305\374\f\001\3157\211\031?=\225N\362nG-\331\361\213]g=\002"
+	.ascii	"\034\330\225\030\234\025\355\016^\226\243\016\f\276B\026+\\\255"
+	.ascii	"\022M\353\304\221\301\267\302\032\273\261[}\331\367E\b\370\246"
+	.ascii	"\3049a\034Rx\tp\222m\242\340[\025\3639\270KQ\\dI\233c\212$>\003"
+	.ascii	"QJx9\n\036P(#\340\220o\302T%\377\254Bj\361\0268\n\035$z\365\272"
+	.ascii	"_\304\344\367l\215\253\270\201 \023\013<\004\214\202\305S\336"
+	.ascii	"\244\350\321\342\253o\361\220\333\271\304\373\t\331\307e\212"
+	.ascii	"\"x\t\037\370]V\205->\f\003\016\300\013q\007\224\274A\321nW\203"
+	.ascii	"\242 \354D\324\357\207jf<\203G\002\205Q%\306\232"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`s\007\305\024"
+	.string	"\246\227J; Q\224\016"
+	.string	"H\002@\240\321\254\327\362\342s$\250\217\020\020`0\371\327\256m\003\250\343\321K:\333\327\242 ~l\232\264\245Nh\377\227\363p"
+	.string	"\372A\0365D\320&r\247\224\0025"
+	.string	";"
+	.string	"="
+	.string	"\224I\361\031\264e \334pj\223\036d\251T\332h\366h\314\310\267\214\317\332\016\020\001\263k\213\226E\337~Es\031\362\221\330#\225<\262\364\351OZSC\352\023\226OYP\027\365\305\277(H\200\340\302\235\345\200Y\001\263k\257\242\231\223\353\272\256G*\223\265\227\233\330\217\374\357\307\227\277H\325\220\253m\002\310\312\034\340\007\3609\256N"
+	.ascii	"l\371\001v\007\322\350\214\021\371Ab4\032\201\351\2349|\370V"
+	.ascii	"\275\r|OC\006\022\203\335zX\271\254\265@V\260P\340k\313\004\273"
+	.ascii	"\222@F ;$\204\362\3272\256\333\007\266\034`\032\364w\001$E\244"
+	.ascii	"\b2D\206\240\200\260>\220\026\210\307x\250\274\362\312-\203Q"
+	.ascii	"\"\030\215q\023l\n\376\304Q\270%:I\312\033\255\023k\222\032\350"
+	.ascii	"\246.s"
+	.string	"_\324v\217T\243\231\"\311\361\253\200\245\250\241\301\252\032IA\222\3124\006P\002!\205\216\252\003\022 BI\214\344Y\224!\311\206$LR\022\203\032\205\235\003\332+\224\360\223\206G\244\360\301\312W\203\315#\261\345\030q\360\312\307\360$q\301\242\375\345|\261Q\314, q\242\257j\032\362\221\303 \210Ej/\241\312b\241\330![\367\267\356\230b\223\366*H\313\344\300\025[S\221\205&\260Qx\030v\250\006\260\262>h\250\376\355Gw\r\335#\023 \230\007\023\224P\325\375d\361\336\006v\313\373n\250'\237<yy$i\217\202F \301\250\336\t\tS\345<\370I\n\362\005)\006S\325\007KE\344\311#\3539\3719rL\322\336\250hv2\341\f\021\357\353\211\325\336\316\220\031\252\222%\034\321\n5\313q\277E\203Y\355\221\244\240\231)\263\254\017\270\262\241\323t?}>>\245\305=\312\243\346G"
+	.string	"\216\227d\264\361\273g\314\320\211\347|\020<]%\007\266\177"
+	.string	"\253\022\245\265\220\300\342\301\265|#\207\3630\2102&\250\227\310\220=\325\035\303\350\272l\222\325\243\361>F@\263\247I4\006\224\340\333\224r\221\027\0130\006\365Q\036"
+	.ascii	"\261;&\305\373\300\031\021na\n\b\217\303\001$\244\311\205T\024"
+	.ascii	"\026\234\361\0254O\202\322\247\300\2219\212\352_Uo\030\025\303"
+	.ascii	"\221\001"
+	.text
+	.section	.gnu.lto_.pureconst.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375 }\025\003"
+	.string	"\322\207\027\034PW\032\003\207Yq\002\021\243\232\021]\202\241\232Q\377\273\347(\234z\234S\026@v^\311#y#O\344\205\254(\007\371G\346\361\216\025G\266q\215\227q\214_d\026\2578\305'.\361\"\036\304{\270\303\033\316\360\205+\274\204#\374 +\330\b\266\201L\340\001\007\370d[\206\265\026\025"
+	.text
+	.section	.gnu.lto_.ipa_modref.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`,\003\005\017"
+	.string	"6\324C;PO\222\341 \331\262\026\212\304nZMe%Hsp\327\340\026g\220\207\355\234"
+	.string	"`\001\032\020\013\b\370gC\307\3416\254\215<\320)\264\316)`\361\354\217\270\335\204\264\275\245L\0010"
+	.string	"7"
+	.string	"1"
+	.string	"o\207\332!\300*\225g/\215z\357%\224\250<A\347\200rK\031\206g\303\004\f\240\251\200!\235\230~\207b\006\002\362;)\177\350\365\003\273o\223s\347\230f\036@A\235\013\227\020\013W\370\216\362\016\n\023$\034\001\202\203\202\314\006\375\270I\364\300h\224kDO\216r\016\210\006~\020\203\005\n\027)2S\305\330'\024\036\235P9\324I)\307\364\275Z\315j\231\307\246\307\244\3521\363\276\246\3249\347\222\264h#\222k^q\r\343\2305\315\237\353\013\213\232\221\371\304]\005G\226(D\304\362l\342\022$F\374SQD\210\007\361e\243|\243\317\367\203\007\020v\370(\037\252m\332\346\306\341E\272\342\2224\033^\303\227A\231aAg\201\362g\250\361@(\231\320PR\230\326p\002\2312*\017\020PUD\234\032\035Y\"Z\003\334\345\201D\220\246\006\372\332\377K%\f 6\215\221\355\2472\201"
+	.ascii	"\005\251o\225+A\036*\362\310\356\bqM2\246U\3127A\305NV\2319\254"
+	.ascii	"\226x\333hN\241\254\354\352\252\312=\217\375\013\247\366\023"
+	.ascii	"\013\034\372\371\330\330W^I\257\310q_\230\212\352^*\322\037o"
+	.ascii	"\217\005\217\213%\034\250T\340\266\324\312\277\365\234\227h\362"
+	.ascii	"\"y\227\373\036\226\001\037\037=p\242\315\367 \261\357\254\037"
+	.ascii	"$\310*j\033!y\366\032\034\244\244.\251\245\276F\376\305\253\375"
+	.ascii	"\336\367|\023\322\360\037\250\345\276\200\210\237>|\342WQ\262"
+	.ascii	"9AG>3\244\003\344\240~\226\004/\037"
+	.text
+	.section	.gnu.lto_.lto.6b8f6e46984b810b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidNames.80.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"\032ROLL;PITCH;YAW;LEVEL;MAG;"
+	.text
+	.section	.gnu.lto_pidConfig_Registry.88.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375 \235\245\004"
+	.string	"d\bk"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\203\335\221\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\327\006us\350\364\005uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\370\303"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidConfig.90.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006'\001\350\007\005\001\006\035\001\001?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_pidProfiles_Registry.94.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375 \236\205\004"
+	.string	"$\bl"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\203\364\321\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\376\006us\324\006uq"
+	.string	"\005\001\006'\001\334\002\005\001\006\035\001\003\216\340\003?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"\200\b0\313KQ\204\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_resetPidProfile.95.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\315\b"
+	.string	"\366Q@9@\217\322\001\270\226\r\013\207s(\236\f\216=\343.p\224\372\017\254\016K\265\277\032\t\344\324\246E\034\304'\"\332g\306\226\003\301$\363 \232\302'\215!\352od\223\275S\n-"
+	.string	"/"
+	.string	"/"
+	.string	"\331'\347\003\331\247?\033\346\365c\277z\321`\271v\227J\217\177\217\237\377\221\003\204'\360q\303\260\273\216\341\211\343\226\267}`{\301vK\273k\211\262\257\372#\346P]1\006+\273\03354\3132QBb\274\375\216\355G\373\"O}W]\\`\027er\262[\025\214\300\371t=A)\331\353K\274\204\031\227]\323C\237\344+\022v\220O[x\331\303O\337\313>\243\264)*\342CG\226+U_-\223\004\355\nF\331a\037\333\241\221&\332\272\006\220\306\005\370\343\001i\034-E@h#\021\235\320\036$\350\247#QO\2017.\324\321\322\266u\264S\367\330J\2241\225\372ja\310\fo\242e\356\007"
+	.ascii	"2\241\313/\020\302\205C\227\241\233\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pgResetFn_pidProfiles.96.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\215\001\315\017"
+	.string	"f\337jE"
+	.string	"\261&\035\243j\361u\320\032\f\372,\236L\223\0336(\036\244n\371\236\322\367\b\336\353\210\232\003Zo\252mKS\306\241\250FqeDj\002T\002"
+	.string	"\203j\335$\205\277$\276<\313\031\217g\204\220\275\345N)U"
+	.string	"T"
+	.string	"T"
+	.string	"\356\310>\r\376\300\365\231\335\300\365i\220\235sP\304>\314A\tW\273\273i\b\353%x\313\b\372\224\032A>\006\342r\005'\027_)\364)\007\354\256\200\022\007\351 \246\224FQ\222X\271><\203\223\352+\255<b \273\353\370\225T\356\353\266=\333\020\354\333\004\250\037{\352\226\217V\215\216\032\375"
+	.string	"Z\215\027\235\326n\207\026ko&\315\351\251\337\276\217\342\252\223\303XUX\007\375\320Z\212\277\200\236r\213,\344!S\205+\031\273\353\361\351\007\331g\002ybk\237\327l?\332?\361\026\320Q\032N`\327T\303b\027\374\b4b\354\222\376\3712W\321\311\217\370\364\205\317\365\357\323\377\\\237\252\276\nC\206\370\317W\275@\270j\001o\310 i\310Q1U\325\031\222\t\317\270m\256k\324\223J\214b\313R\257\017??\234V\240\344\020\305\226\352\356\206TYlp\024\277\273k5\331\331\003\334?#%\034I\347E\020\341<\232C:\"\234g3\2410\201+!\331,p\022*l!\336g\353 p\347\031\3616\223\256\3636\r\024\375\253&\337\345\231\214\215\033\221\216\246\262\030\253\321L\025'z\\j\312\307\245\036\365\202\263!\342\270\224np\251Y\007\rk\004\003\006\004\200\370\230?\3463\237\005\001\036"
+	.ascii	"3\241\365i\f\246\001\215\332.\222\265\324\230\235\314\214i\314"
+	.ascii	" \036\266N\025\354\210\246\021\230\226\202\021.\207\246e0\013"
+	.ascii	"3\2101\340\322\006\325\002\272Z\016\304\365*M\263j%\020\0277"
+	.ascii	"D\224\rv\332\333s\300\237\224;\327|\002"
+	.text
+	.section	.gnu.lto_rcAliasToAngleIndexMap.98.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\001"
+	.string	"?\202\210\200\020}3\274\0014\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_pidGetSpikeLimitInverse.133.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375 \365\255\006"
+	.string	"\202L.3`O\322\001\024\202\267\036\364 \3732\367\241]\370r\312\251Bg\275\276\301oM\036\262\221\032\247\n\326 @\3208\272\002+\307\302\004\343\260\247\221\275\245L)\256\250\004\013\3632\r\f\226\303\302\203\260\020\036^\205E<\212\300\027F\001{\231\353\302\236\024\367\332I\2356:a\177\344\321 \337c\t\177\362\331\235\357Ot\227\n\200\261\311\220\0355\251\033\366\333j\307~:5 \003\345 e\327\"\324\262'\316\304\3036\264%\037\344!\320\006\265\330\341\271J\005\005\t\313\356\276\351\003\321]\273@t\247\034\207O\350_\344\355\243d%\343h\236\027\203\335uf\234\213[_`[#\t"
+	.ascii	"2\003\346:\203i\b\3055\0217\004\216\031\233\270+\322lx\327\275"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_pidGetFfBoostFactor.134.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375 \365\235\006"
+	.string	"\302\214.3pM\322\001\240\353\002\370_!J\376~y,\2023P\203\3416\035\003\353oM}\240!\246 \013~l\202\352\"\201\023ZA\366\0043\270\260do)S\n\246&\205\312\362.\016\r\325\003\303\213\250\022 \036uI\274\251\300\226e\341z\027\313\272^\024\367\312I\2252Ja_\344\321\231\337\361\204=y\354\316\267\007\272K\r\330d\362cGLj\206\375\266\273k\345\330O\247\nt\240 d\273\026\237\225=q%\034\266\241\035\371\037\007\201v\326\342F\347)\233\212\021\225\335}\322\t\240\273\366\001\350N5\016\237\320\177\310\233\007\211\t\246\301<\001\016v\327\211i.n\275\201m\214\b"
+	.ascii	"2\001\0378\203)\016\205.Cb\306&\356\2124\033\336uo"
+	.text
+	.section	.gnu.lto_pidGetFfSmoothFactor.135.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375 \365\255\006"
+	.string	"\202L.3pM\322\001\240\f\340`]N\334\322\373(Cff\240\206\217\r\272\001\326\337\232\372@CLA\026\374\330\004\325E\002'\264\202\354\tfpa\311\336R\246\024\246&\205\312\362.\016\r\325\003\303\213\250\022 \036uI\274\251\300\226e\341z\027\313\272^\024\367\312I\2252Ja?\344\321\037\277\343\t{\362\330\235o\017t\227\032\200\221\311\314\216\230\324\f\373m\225c?\235*@r\202\220\262k\221\255\254\211+\341\260\r\355\310\367\370\007\264?-nt\216\262\251\020Q\331\335'\235"
+	.string	"\272k\037\200\356T\343\360\t\375\203\274u\214d\230\006\363\0048\330]'\246\271\270\365\006\2667\001\t"
+	.ascii	"2\003\346:\203i\b\3055\0217\004\216\031\233\270+\322lx\327\275"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_pidInitFilters.136.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`Z\002\305\023"
+	.string	"6\244\177I\3200'\035\330T\313\260\345\212\300n\346.\341<\232v\022\206\375\354D\034\323y*2p\020\252\303\005\376\3117K\006BH\335y&\214\371\210\333\220N?\r\027\032\340)1\315\020\001\b\200\233I\263\210\322F,\331{\357\224\002k"
+	.string	"c"
+	.string	"f"
+	.string	"\365\373"
+	.string	"\357\3251\373\306kD{\234\210\034\024U\273\013\316\241\230\347i\355\246\254\330\277\225W\351\2241\337\203&\376\273\354\347+\017\004\216\312\003\317\317=\212"
+	.string	"\b\252\007\204\226CCh|\260\361$\034Yi\200\335\005\241m\240\tth3IK\364|~\351R\0075\213ZA\353\271\\\241\354\256\345H\343\271Y\267=d{\201-g\002\271\321G&ws\356\2568\247\220]\023\345ww=\203\354\326\221~\326mw\235\322RJ\037\344N;UT\r\242v9\354v\354\214\352\202\304m\267_\363\227N\\)v\233_|\342\316w\303\031\341\330]\222W+\370^E\350?l_\3327\361\243\330\2214\\\300n\320S\323n\315\304#\337\253k\017\361\036\006\244ve\037}\246\263p\371E~\t\303\244\323\0349\031u\n\271\025b\266\346\234\222$\257S\307\266M^\247\034a\233\272\221:N\351\024\262]\362:[\363\272\334\r\007h&w\366\220\237v\314K~\264\310\315\024\355\3432"
+	.ascii	"\220\032m\327\\\305\314\210\324\3562H\361\033\215_\364\352\013"
+	.ascii	"6\362\343\253o\343\275~\346\0024!\206\025\352\202\t]^0\007-\241"
+	.ascii	"\214\207YNZB\031\260\246\302K\b\343\002Z\bWb@\026\030\rxR\300"
+	.ascii	"/\031\027\f\254y\275`\340Gm\305\243\310\346L\374\bH\326\264\037"
+	.ascii	"@\220\037M\247h\335\221\021\321\252\304)B\007\246\333\350s\200"
+	.ascii	"H\347\222\020~'\267\033}H\224n0\274\247xrR\260\325\270\221:\354"
+	.ascii	"7\275E\312\004\025\371Q\305{\225\223\306x\372Ya\t5 \200\002\231"
+	.ascii	":\363b`=\214\215\205\007\226\234_\230\370*\247\206\215]/\031"
+	.ascii	"\036\005C\347\247\334\314\253\025m\367 \200\255\f\366\232\233"
+	.ascii	"\305c\301\331^\315\326G\033\347\267\363U\036\013\220U\367\351"
+	.ascii	"\355\226\261V\202\312TF6\264d\021\260\224G\030\017\241\330\212"
+	.ascii	"\331^X\240j^;[a\315\236^\273\n\0131.|\031\256id\324$\3511\271"
+	.ascii	"~\323\351\240G^\202y\002"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.137.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`M\001\315\r"
+	.string	"\266\231\\D\020\221\223\016;\242\263\3278&>D\302#\013\006\016?/`}Z#h0B\344\251\321U\024Z\373\026\377\327\247\231\346\305Q%\213d1"
+	.string	"\024\200\302\261\221\360\213\322D\024\020*\355\374\206\214\330\275\311\226)\005E"
+	.string	"F"
+	.string	"I"
+	.ascii	"\001\344\243\036\200|tg\317\370'b\277\242%\345\304jw1\030\242"
+	.ascii	"\323\356\321\202\332\371\033\017\307C\225\036/\016\267N\nc"
+	.string	"\256\030P\026,\001\273\373\324\365\002\312\244\272\361\354\256\325Ci\270\345mg\266\031\330\337\020\376\313\177\035\346\227\377~K\325\332q\031\325\252F\204\231\335\f\023\307\276\210,J\330\276\375\030\273\363\216\rC\"A\201\003\335?\322?\326\004\3033p=Z\325~\313]\272\277\2348\356~h\241\332\375\bx\300\365\370\361\n\255)9<\347\254\261HR\302\333\370\347\2347 \\\261}\"/\b\302\002\"%\343\2445\226*B\033\026\0274\026\364Q<\005\311\037\341\221\211\336{\364M\344#\002\023+\017.\035Pt\332_I\341\212}8\347\214a\250\342\331\207\324\240#\264UP@2z\220\215p4\215\023\215\026\2002Q\311\246yX$dd\373`\"\b$[\211\206M\330\034H\300D@!,\004\304\334'\003a\"\216\003a\235o\017U\242\214\212\206\006\n4\315D\216*\2649\nz\317O\335s\202%_0\034"
+	.string	"\255s\340\314\200{f0x9\354\013\023\305\271\027\f"
+	.ascii	"[\204\252\032zW\f\363\"\306\024\264\003\202\375\234l\243\356"
+	.ascii	"\007\2561n\270\016\024\001\343\300`>\t-P\243\205\273\004\006"
+	.ascii	"\f\302\220{\326\341c\245\f"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.138.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`&\001\035\r"
+	.string	"\246YZC"
+	.string	"\2216\035s%\f#\374$\316\330\220V\032\312\301?c\rX\315\\\215\007aof\213q\037\004\030\"\323\004\016Q\253\245\241kS<\260\376\377\377\375"
+	.string	"\230\364\007\243WT\017\361\031\366\332di\023)S\nE"
+	.string	"G"
+	.string	"D"
+	.string	"\002\252\303|\200\352\320\236\335\342\037\206}\214\212\224\0202v\027S\026/\275CJ\323\3635\234K4\002\035Z\025N\205RM\317\b#\bT\307\356\376\345\2512B\311\324pv\327)\032Q\270\253\333\356\330F`\377\023\232\351\324\364\257\001\247\025#0\273\022\"\215\225\201%6\274t\373\237o\362\306\377p\020\336K6a\201&X#bf^\354\256\307\241\rX\207\035\3247\2663\355w\270\007\357.\037\303\335\013)H\354~\005L\300:\004\360\347\204\024d\250\251\316\224\032\2161\236\250\256\272\036\306a.\242\3633\270\304$/:\364M\364@\213\205\223\214\177\2141\206*\311\237\n*\007\007\226\322L(O\366\007J%\331\327\030#\013\353\212}\227\037\276t\007\235\366"
+	.string	"\204\312\262\315S\222\200\353xD\264l\303!\037\n4\022\314\303`\201&\222a#\032H\003,\204\353\260\017\016o$\035\016\363l\033\207m\276\275\256X'f\310\234(\212\013\250$\337\364\253\005\205\006\365\270\252\212}e\252\2759\310\213\374\227\026"
+	.ascii	"2\003\3769\203\013`5\030\360\230\002\201\024!J9D\006\222\261"
+	.ascii	"8\324Ja\030\240\\f\353B\212\213\fN\252j\227XI\021\356\022\030"
+	.ascii	"0\bC\356Y\207\217\2252"
+	.text
+	.section	.gnu.lto_pidResetIterm.151.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`/\001u\r"
+	.string	"\226XXC"
+	.string	"s\233\0160\315ZX\202"
+	.string	"\007\220w>\016\213E|\206\206E\020\013\234Qxz9m\214\001\026"
+	.string	"?j\204\245l\375\032,\246\304\362\335\377\377\377w\365\327\030\274\300F\267\320\243\313\006%\351\223\275\345N)C"
+	.string	"D"
+	.string	"G"
+	.ascii	")\373p\005\211\026\323\356Z\252\302z\t\3362n\237R\343\346\257"
+	.ascii	"<\201\020"
+	.string	"\227\316\343>\245\200\335\r\340\215\220\016\"\211G\212\262E\311\365\340\027\234`:\257\3441\023aw\035;\357\304M\335vf\273c\177$\313\251\242\330 \027\277zb\377\373\356g\016\374\340\361a\307n\211\230!\3732o\260\370w\373.|\320\232\2778\214\355\237qT\234\211jF\250\342cw;\237\346T\237\b\276\241>\345\007P\237\327x\263{\034\f\224\036\305\tf$\005\311\206\303\215O\34350\rZ|\247Q\237\031\023\027;\264\035\025\330\033\336\342\260\300\003\333!.\203\003\201\224\335\205\020\343,\036|\225O\203\030\305w\237\376\210\372<x\216I\016\223I$\306\250\356\006\332\325\341#\r\362H\270B\226\310B\205\353\002\005+\303\365\301`\2012\315\362\0300\026\232\220Y\"\f\313,\r\270\327\223\225W:\200\274\210(i*\212\001\224\224R-\305\316\257$\r~}\020\226\222\210x\272\334\335\225f\360k\036"
+	.ascii	"2\003\376\031c\205\306\211\375]\002\313\022X\0212V\265.8\242"
+	.ascii	"\021#DA\302\350\252a,\341\026\230\246f\323\036L\233`\256\353"
+	.ascii	"\360\323\254L\033k:;\301\252\225\027!\202\314\270q\243\354\245"
+	.ascii	"\252\301z\216\362\223H\347\232O"
+	.text
+	.section	.gnu.lto_pidInitConfig.166.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\204!}|"
+	.ascii	":\310,+G\020P\355$\035\316_\303\226\3476\370\342n,\"E_\tHn\373"
+	.ascii	"\226\340\270:r\252\255\\qMT\334]b\334\370$\231\341\013\233\356"
+	.ascii	"\242X\003\2541\n\232\017\023/\034\261\273\223\203\201\262\273"
+	.ascii	"\327\233\216\326\310&IJ\031m\002\210\002\305\002\357\225R{\243"
+	.ascii	"\324^(f\357\223\332[\302{\241\336K\302{\235\274w\004_o\223\367"
+	.ascii	"\212P{C0{A\250\275Lj\357\222\332\373A\331\353\301{\225\324\336"
+	.ascii	"\016jo\222\262\027I\331{\304\354\345\240\366nP{5\250\275Oeo\006"
+	.ascii	"e\257\021\263\027\203\332[\244\366^P\366ZP{+\250\275D\312^\n"
+	.ascii	"\312\336\t\336;\344\275Bj\257\004\357\rR{\201\324\336\b\312^"
+	.ascii	"\b\336\373@\355\375Q{\035({\033x/\003\265w\201\332\353\243\354"
+	.ascii	"U\300\354M\240\366\"P{\235\312\336\036\357\345Q{w\324^\035e\357"
+	.ascii	"\001\357\315Q{q\324\336\033e\257\001\357\265Q{\013\250\2755\312"
+	.ascii	"^\002\314^\032\265wF\355\035\240\354\225\361\336\030\265W\200"
+	.ascii	"\332\033@\331\013\343\275/j\257\213\332\333\242\354\005\340\275"
+	.ascii	",j\357\212\332\333T\366\2520{S\324^\024\265\227\251\354]z\357"
+	.ascii	"\211\332k\242\366*\225\275%\336\233T{\177\265\327W\366\232\357"
+	.ascii	"\255\265\267\254\275/{\373\275\314\206\3308\346\305\306\016\243"
+	.ascii	"':C\313$!\241r\225\007;\034\210\371\017\363\033s\033s\037\346"
+	.ascii	"=\314i\314k\374\333eA\201\3268\343\352\f\215\3017\327\346\007"
+	.ascii	"<yZ~\200\344\310\364\214ydH\267\2665\242\260\372Bw\240QD\226"
+	.ascii	"w\224b>\313;\254R\237.\206f \313\003\365\343Z\031\215\325\230"
+	.ascii	"m\225\326\354\220\244\255\261D\371\360\030\331\242\261!{\306"
+	.ascii	":\004y\317\032\0315\203\266\234\"2FG\024Eup]\005~\\g\224\334"
+	.ascii	"\273\214\207\363\004\331\314\013\247@Q8?\374A\3213\036{\343\307"
+	.ascii	"u\317\230\205\311\365\307M&\327\r\356.\34231\224\215\213\260"
+	.ascii	"\324\362P\024u\272\034\016r\223\212\024(\230\226N\230P*\221\364"
+	.ascii	"\363\231\265|\007\227\3137^\211\262\270\252\270I\205o\310\001"
+	.ascii	"o\332\320\341\024"
+	.string	"3\356l\315i\024%\f/!\320\360\020[0\2246\f\275Q$\326Lnx\311\215W\237\240ab\250\344c\fY\t\337\220\"o\206\177\360 \301\314\264\341\244.\006\333\"\232,`\200\243\2634\300\266\326\3747\304\026\033\032w\266\206\355S\303&V\3325\r\227%\270\322\360\227\270\256\312\031(\2122\033\267\026\227\260\3337\004E\321\355,.3\274+x\227I\330].\2733\300\002@\022\270\311fhD\340\006\033j\310\352!LN\221\323\021\350q\247\3278\036\357Qv\207\214\207\236\23339H:\276\343\200\353x\215\313\361\003d\250\023C\2167\0340\2541\306\0341\341\220\206\274\033\307a\300o\274\306\331\270\001a@^k\260\206\003%A\277q\240y\341L\2566n\016\207n\005|\271\361\252\253\361\002\bx\215\327=\032'\300H\257yb7\261.(N\023kb\035\215\2333\f\333f\264\032\027:\215\333"
+	.string	"\237!\343\003\304\270\214#m\206k+F"
+	.string	"\027"
+	.string	"\306\003xq\030Iz\214\030\255\027l.:\314\032e\200i,\267c\213\273"
+	.string	"\340-X\034"
+	.ascii	"'}\005\344\266:\036-l+\0267\357\f\327\220+\276[\244\321d\244"
+	.ascii	"-6r\352\232\276B\305\233^\361R\\\205\021N\342\211\333\304\364"
+	.ascii	"\240\204\324!\203\210\245\27096TC\361\335\r\370\221#\274\270"
+	.ascii	"#\236CLG\261t\246\023_:\302wG\034O \315\370\020\273\276\362\224"
+	.ascii	"n\242\304\225\222^\"\t\333)2\"\351\246\3270\255h\366\373\256"
+	.ascii	"\022&b\2152\304P\024\255\373\200E\035\212\242?\020q\"&\033B\223"
+	.ascii	"&jYwF\006\204\004#9!\311\344\321\367\3379\275c\336\367j\227\036"
+	.ascii	"\353\3153V\244u\302s@f\253\333\335\301C@\t\021C\321\253\037O"
+	.ascii	"\330P\024\256@\352\352\023x\224D\326\362\205\276\227u\367\257"
+	.ascii	"\221\371\354\322\025\212Z\325(\317\351 a'\267\377W\265\364\310"
+	.ascii	"\357\363\017\311BX\221J\343\356v\215\345A\034\304\032\227c\330"
+	.ascii	")\373\326\234\265o&W\337#Hyy\234L&#\235\201&\037\n\032\021W\255"
+	.ascii	"\267\273U\330\007\340\017E\257\032X\356\301\313\016'\374b\340"
+	.ascii	"\272\354\305\344\312\327\241G\316+\217\231U'w\317\204\375\260"
+	.ascii	"]~2\231\334\333\303\331\345@\274\034\327\306\177x\331O\037~\343"
+	.ascii	"e>k\334\306\313j\274\207\227\3238\215\327xy\017\367\341\345\262"
+	.ascii	"8`^l\306\314]g\314pm\225!3\246\354e1ZI\275\234\025\306\354e0"
+	.ascii	"X\357\345\264\366\362\227\332\313W\265\227\205\357e\253_/W\275"
+	.ascii	"\227\321\332\033\254\275g\355\365R{[\250\275]j/\013e\357\n\357"
+	.ascii	"\345\362^\025\314\336-\357M\301\354\245\252\275Zj\357T\355E\241"
+	.ascii	"\366J\325\336\250\367f\251\275X\336{\245\366\236\360^\023j/\360"
+	.ascii	"\275Vjo\225\332K\345\275S\002\fg\316\320\252\223k\177\200.u\264"
+	.ascii	"\347&\316jg7N\2123W\206-\365\202\244\345\234\206\343Z.c\216L"
+	.ascii	"r\352\214\346\342S\037`\216\314\243\364\2160\355BC\341\274\347"
+	.ascii	"\034'\365\337Q\270\017/\275#\224:\223\220\f\243\364.\312\006"
+	.ascii	";\306\313\362\250\267\032\243\323\220\345lf\350\250\210\245\354"
+	.ascii	"\210\206\273r,o\272\364x\"q2\340\025<\344\tv\360\354L\370\t\347"
+	.ascii	"\275\364x>z\035\023\360\212@:'\222\316\312\201g\2743\211\317"
+	.ascii	"\001Z\3719l\204\254\"g\215\347^\333\351Qy\225\373\350\246\234"
+	.ascii	"\312{/=\236\311\303\231r\036\033.\222\002\026,V\005\363\b\377"
+	.ascii	"\005\224rf3\\\024\345^_\360\204a\326\310-\202\362(\177\361\344"
+	.ascii	"P^\252\245G\254\257yzr\346ahW\0021\f\324K\370\343\322\243\326"
+	.ascii	"\325@\331\221\220f\f^\231\237!\341\214f\230\250\350\204\213\213"
+	.ascii	".\353\356\314\31389o\r\021\215\3601\301b\232`\236Vs\255\021\316"
+	.ascii	"e\210"
+	.string	"\250h\326\344{0\017\203\0021\270f\215\311\2659\206)\302\233\234\261\004\t\333\374\013P\204\237\303CH\263\020.t\223u\007\302Cx\253\275\360\252'\020\2367<T\3641I\206\331e\335-a\362\222.\035$,\373\222\267\020j}p.{\333y\360\017\376\202.=*\271\007\347\035X\0044-FX\221\3149\006\232J\016\005-\356\252\365\3364\022\250\344K\206\204\212f\216\302\246\206qyy\035\274\021\022nI\256\301;@\362$\367\355\0359\222\373\3348\370\0219}\004\007\347\256\241\020H\263\035\315h\215+\304\026mpEk\274\261]D\033\021\234\023\244\023\254S\307\344j\302e\335i\360\247oP\267F;\373\246\301\223\206\031\374\3510\f\261\221g\360\027{\351\035\fn\204\254\021=ap\2064\024\242hV\344P\331\033#\366\2345\272\340E,\370\005w\001\267\207,8\323\\\326\243t\254\002\2715\322"
+	.string	"\207\250\214x\326D^\001\005'r\027t\351q\202\263\035\n^\272\245cC>\201\r-\304\220\036\220B\276\rD\017\n\026\2039\004\3634g\005\363\230\\\037\247\247\205\234\275\206=\024%\200\233`/\353.\310%\370\335\322c `\0201\036\240\234\352"
+	.ascii	"\361\020\013rn4\204C\0021\022i\267\b\016\004\202GpS\355\201C"
+	.ascii	"\320\006\354\341\007\312F"
+	.string	"\357 \343\2013\016C\270\037\315\307\202}\3436De_z\016\374G\003w\340\025\217\2017\240\006\344\321\243\323\240\n@\213\301\300\271\206\241\240\342\002:\234\351\361\361\005\024\270\217W\273\004\256"
+	.ascii	"\236'f\313\001J\b\016\001T@,\300+\025\nTSe\001F!\221JAJ\026 "
+	.ascii	"\023,SS\250\200(\256\\\211\232Z\262\022\205\n(\305\224%\nH\025"
+	.ascii	"e\312\324T\024\021\025\236\254pb\312\025 \225\250)$R\200R%6J"
+	.ascii	"\017)@)'*+U\200W\2508e\001>\301\342\024eJ\213S\017\027\033%5"
+	.ascii	"e\312\211**j\312I\351\314\212K\364p\366\227\b\b9\253\013\227"
+	.ascii	"\317\224`g!5\347\034\330\371L\223\033V$\2573\330MG-n`3g/3\177"
+	.ascii	"\034\261\364bS\2669\327\2649\335\270\341:\377!\3425mum\375t\351"
+	.ascii	"q\370T\346\314\306u\214\330\250X\247w\004\244\342adJ\027\316"
+	.ascii	"\027\342\234\3114\211\211\363\355\264\321\230sJH\353,\346\307"
+	.ascii	"{S\2429\013\375\3123^\2128\303\260h=\311\254\334*\271\260\310"
+	.ascii	"9\347\3141o\272@\\T\034Z\205\371\032\031\317\020\034\324Q\334"
+	.ascii	"\2400gA\314d\256M\241\364\250\346K\231\261\024\017\333\2671\203"
+	.ascii	"9;\242S\216y\372\225Z\245\230\263\316i\347$#\003\363\005\346"
+	.ascii	"\264\fY^\206P\374\300\214u(h\204\250\364\356I\303i\003\326M\254"
+	.ascii	"\345\360\205<\n\323\022\314Y\314\241L\3233\032bs\227\236S\207"
+	.ascii	"\346\254\305\201(\t\271\253W-\177)\205k<\321\366\355\212\277"
+	.ascii	"\214\tYx\276\272\2138\341\217\227\036\325\236\264:\233\021\t"
+	.ascii	"\025\315\252\276\207\364\275\223\255\317\351\307O\225\333\365"
+	.ascii	"\030=\337@\214C\2321=,\3574\236\017\226\347}v\351\235.^\336\204"
+	.ascii	"\326\365(\035k\241\021\240\222\205\026\336\002\255\213Q:H\330"
+	.ascii	"(\212V-=\254\313_\345V\326\345\270\306@\373\306\302\273\254p"
+	.ascii	"\026\356\213K\217\\\276\302\tw;.\347.\"\034R\005#N\037\354\200"
+	.ascii	"8\021@\025\316f\210F\344\226DA\234sq\247{\332\362-D#\325\367"
+	.ascii	"C|\356,d\350\234;\347\346\210\214\262\356\312\023\017#\304r#"
+	.ascii	"\020\335\362\032\231\3308\266<c\033\245\036\264vC f>\210\324"
+	.ascii	"\224x\030\007\213\246\017\301\"]0\017\0251-\257\321\0011\225"
+	.ascii	"-\271\252\336[8\030\340\350$]\320\036\2169\206\311Uk\f\375\342"
+	.ascii	"a\217\005f\fE\321\034\377\263\273\213~(Z\305^\374\205\226\221"
+	.ascii	"\031C\277\320\034>\276\256:R\242\277\001S\370\226a\022i\366{"
+	.ascii	"2\251\016\005\255\210\253\326#\342~\236\250\276d\230,\232Y\265"
+	.ascii	"\3659\03767m\377\261\227\366\035g?g@\234\024GX\306\207>i<\216"
+	.ascii	"\266\207\210>\207\300-u\204v\001\316|\316FN\222\203V\306\230"
+	.ascii	"z\255}\3674\342zn\366<\314\306\001\202\255\250\322()\224b\324"
+	.ascii	"93\"\222\244 )\fk\002\f\020\204\342HZB\267\007\022\300c9Lc\f"
+	.ascii	"!\250DDf\322\fkb \b\203\036\346\341\367\240\031l\326\326\303"
+	.ascii	"\321U\201\237\016\336\\\373\254\271\034K\256\340v\367n\350\037"
+	.ascii	"\253\251[K\223\330_$\017\013\370\2016\357\227/DS3\254\372\271"
+	.ascii	"8R!C\331$P\013Q1oM\306\023\272\333%\325p?#:\225\362\212T\214"
+	.ascii	"\020gg\322\234\316\351\303\364\344\314=\344B\273\025\0049\353"
+	.ascii	"\3668\002a\305=\321xx\b\002u\030\203\251\226I\274\031zT}Ya\031"
+	.ascii	"t:\331\250\262\230\022\233\352\374\201\331\231\307\274Lp5\376"
+	.ascii	"\007\230\036\330'\352\030\237\214k\361\312\312\311!\316~<I4\240"
+	.ascii	".r7\242\024U@\214m\021\021&\320\232f\035\312\022\0326\2731/\245"
+	.ascii	"6\374X\235\370\355\244\304\003\353\240\265 \265B\0037K|\002\224"
+	.ascii	"\266\354z\275OT\035Mf\265W87\363]\036v\314\211;\245a\316\357"
+	.ascii	"\n\330\354\332z\273\024\250\321\350ZI\217\333\275b\322\2008\204"
+	.ascii	"\222\353[\213\353\336\221\335R\266\003\003U\006\023\340\357\326"
+	.ascii	"\016\265ju\220\216'\203\346\031e\240\001\333D\035\\\342c\261"
+	.ascii	"\331Xz\331\325(\304\332\206\203EZ\267\201\273\320\230Z\363nX"
+	.ascii	"\323\242\"z\274\212\004\240-\377E::\\2\326\230v\305\201\3547"
+	.ascii	"\265\305\237bQ]&l*\252\\Cs"
+	.string	"9\207\224\307(\200\025\327\370:\244\004\221\347\3446\371%l#\250m\003\234X\242an\371\305\260wh~\034\277\310\202\261\2670c`\332\221\005\304\316?\017}{j\0176,\332\261\324x\247\360\230\200\243\221\323\340\327\3044\002\372\303\216Y\n\210Vma\330\201\313\342;\2572c\302K\030%\237\214\375#\344\300Dc\357\365\224\036b\225vw\334\275\347\376\001\013\271C\027\237\215Q%\262\303\216k\240\263G\233\025\356\310\266\322\310b\334\332\257\013}\354\210\020\030\255!A\357F\2379\201G\221i\252H]}\233D5\305\003!\336\255e\274\247,\016,E\365<\305\260\314\363\361\315\016\3635\331:v8l\2005\020dr\302\021\t\273\215}'\315-\n\361#\307?\235\361\337E/\001\251\236J\3124\351\t\331\243\313I\235Y5#\250\302\3469@\334(\375\350\365&\306'+O\313\356l\347\377?i~\t"
+	.string	"\233L\030\0029\236mI\214\337\n,0~\257*UI0\266\353\022\263/\376\275D\036,?\253\275&\326\357\213\205E\211\314\313VG@\334Lz\314j\357\243uW\242L5\373\310x\0078Tg\261\316U-\306\215\323\274H\3230\334MP\025P\354\333\372\b\360N\332B~\316\001\255\322)b\355\311\030"
+	.ascii	"\264\t\0228d\2078\374\367!\016\234\232\013V\332y\302g\307+\327"
+	.ascii	"\234v\320\003\030\351\345t\275\263Q\355\2106y\377\330\246\312"
+	.ascii	"\223\334%\032\363@4F\316\026\317\300\335\245\357\217\023\037"
+	.ascii	"\033\004\325%\316R\220\226\364\251\375\256\277\037\320\303\305"
+	.ascii	"\363=\260L\303en\3776,\353xE\177\361\346\203\201\3308\257\230"
+	.ascii	"\353\021k\016;\353\202\325\317"
+	.string	"\320\2562\364\023\025\037\330es\376\311\362\270\225L=\342va!\260\030\222\325\031\364Q\260\312\361\273\030\311r\226r\307U\310\004E\377\004\250O\322\363\035\305\272\\h\331\031\205\302\367\245\347\002-\355]E`kK)\nq\233\322\375\030\251Qb.\256\357+A\020p\366\223\210\251H\333W\332\312\315[\025U\334W\364f\3254\303[\016\242\032\355\366~\366\370\231!\313D\315\325\026\221C|\007P\360\016?\bI\317\351\246OH\2146\300\347\021\002\214 \bcRK\211C\001t\002\377\257\244hhe\021\362s\2560A\344dd\343\252e\276\221\3336xycZVRI\211\372\2437YK~\001\220\260-`3\243\"\367x\234L\3655\241rt\355\020\\\301D#Bw:\234HO\272\371\346(|,0\324\324.\2544\224\3610\363\227h\200MQ\321\216\335\230\001\252\311\355\346\263\204\\A_\026OF"
+	.string	"H2\215GW\224\021\321\230\307\037\024\324\202\267~\026V\322\217\201\353\363\253\031\266'&\223\311\nk\272`\225\r\237\214\022\331\313\374G\361\222p0\227\362d<\224\306Qz\205\005\351G\024\212\036\356\211\316>wi\365\3044\206\031\023\374N\033(\3300<m\fv\321\273}C"
+	.ascii	"h\342n\270\364\332\023\374\t`\370\363\330X\300C"
+	.text
+	.section	.gnu.lto_pidInit.167.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`>\001U\016"
+	.string	"\326\032`F"
+	.string	"\2576\035G\200\006\020\031\244\243\357\233B\304\271\355o@p\333\317Bv\037\177~\200\020\"\266m\244\336\027\377\352\030\230\201P\272G\224`\371O\203~\335\245\315\034Ux\344b\336\205\200\355\340\267\221\bm\"wJ\001H"
+	.string	"E"
+	.string	"R"
+	.ascii	"\234\355K\373\037\356\022:*\302\003\354\232J\310\354\212\006"
+	.ascii	"L@\373\264\370"
+	.string	"\001\330\247v\001\330\247C6\315\305\r\253\321\201F\202\352\305\356v\252\341\241\313\220\377\3243\302\322\311e\246`w-\303R\312\255\267\275a\373\200}\025\001\362\341\247_\202}^7\225\226\007\224H\216\2668\222\232\301\376\265\273k5\331\227\264vIg\2274v\324\257*}\016'\006\213\322W\306\335\tckY\023E\213\017\342/&\027\275\251\264N\273\313}\332&6\367\371)\273\0054\005O+\322L\246\276\211\237\360\352\343\030\307\250B\233\325I\026Z`X'\030\307\031\224]\321\006\246\231\236\304a\204)\204\223\bR\315\325\037q\022\237\317b\017\004\344\345\262\245Bk\305\345\202E\016\363i\273\213\300\017q\325\003\237\345\323#%\001\236\020\357\343\003\027xx\240\315\035\016\017\017\324\2214\370x!\037\235\003\257C\244\353\200#\035\207\206?\220\007\354H\276\017\3548Q\364k\325dm\205\013\226HG\f>7,"
+	.string	"R\325\356\350\310\207~\352\033L\212\002\214\032\024=\261&\343\221)B\033L\275\372M\035"
+	.ascii	"2\241\305i`\\`\220\314f;y.\f\204\300\270A$\271\303\236\021\362"
+	.ascii	"B\233$\366T\261\206\301\034O\261F\026b@\314\005\230\3362\274"
+	.ascii	"\024\370\255j\235\220J\300s\031\330T\350AEkVW\300\265\274\020"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_pidAcroTrainerInit.168.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"]\007"
+	.string	"\"\r270q\222\016#x\206\211\2422T\022\363\235\264;t\3641\357p\033\235\215;L\374v\267G\276\276\346\256\035\376\206\206\202\002#\224C\354\243\320_e\352\206\266O\210L\001\207@\016\230(\216$\"\260\t\210X\2015P\304\220f\021A\2373\321\203\026GY\246EO*\013Q\0025\035+\023\314P\250KK?N*\026B\377\204\262<S@\223\231\013W\245+\027\267\244\327\030\244W\256\327%\001\364\252\307I\205rcz\255O\225\036\024\371v\022\242\276C\020\002\323\025\244\225\271\321\302\311\325%c\362\327\363\3666M\221\344\347$G\343\205\225\231\021\216t\353\333nS:\300u\245\276"
+	.string	"\206\314\374q\035G\207\375\r\376\203?&\f"
+	.string	"3\001\3638\303\364\256\001\303"
+	.ascii	"\356B%\265Y%\240k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_pidApplyThrustLinearization.169.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\r\f"
+	.string	"\306VRA\020S\224\016\030\300\001\005X\250\004\356\020\210`0D\344\265\3019\004i\320,B\206\275\304\243\215yk\215\320\3779IR\231\256\242\250$\002D\210!\005 n<my\003r\025#1\376'{K\231R@"
+	.string	"?"
+	.string	">"
+	.string	"\021^@\365\250\245o\217Ps\363+\231\006\240\025?:\217{\264\2148\204\005N\350\020\201\200\007\n\024\313\013\245\006\360D\360\262\273\217\361\034y\240\314Jfw\235\235\027\342\256n\373\201\355\005\366\031\004\247?\352Ow>\375\n@\t\305\273)\265KJ\005\331\223h\203\205\355\315\266\362'\177\016\331\305\221\243\306\356*p\002\313\243m\037\306G6\373\203(\223\210\001\027 >\314"
+	.string	"\262\273\327\345\003\252\007'!\"\265\200Q\225\344F\217\222\035\241L\311\335\345\364\263\235\007\256\021J|\2042\305>\311e\370\363E\354\301&\371\356\321\267I\365x\355`\202\306\213\022\237L\331(.U\205}\270\232\302~\232\247\243y\034d\230\206q,k0\0226\235K\263Pa\203\201\302\225a\003\201si2\r\027\206\200\261\316\204\354\3220,\273,\324\036\246\032jT\325\221m\325\013#'\037\005\305\230Q\355\r\034\362]*T.\025"
+	.ascii	"\177\b\b\303A\023\226\323\320\r\333\353\bm\001\241\034%=H%\021"
+	.ascii	"\340H&@\327p\220\2113*\\\313\004\021\025\016\001*\037\254\206"
+	.ascii	"\254jd\315\220\333U\364"
+	.text
+	.section	.gnu.lto_pidCopyProfile.170.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\030\001\005\r"
+	.string	"\006\330VB\020\2176\035l\356TGAy\315O?\002\"\265Ld\200\310\007\227\301\370#rK\315\364\236b[\323fG\214\351i\2403\270~w\244\"\032\022XQ5h1*\030&\345\370\236\004f{\223-eJ\001D"
+	.string	">"
+	.string	"C"
+	.string	"-\376yX\215\020\243N\005\306\356Z\332\341\333'\250\271\371\224\006\023\362>\237.\031\016\341F\nR7@\304\201\245\362HR\003x%pcw\237\362\244\340q\231\224fw\235!\017\303\035o{\201m\005\366?\002>\\\025\331\231\306\034\345\247~\362\307LCM\253\246S\323\257"
+	.string	"|\250\340}\244b\327BI\306\222\246\023 l\277\262QX\020d\332\006\016l?\031\261\356n ab\367+`\002\227O\336\354P\251\026P\226\034\025\243\316\256\005\344\031\027J+\240\232\230\322\250\352\241\020\221\273\373QO\210\252\rJ\254\220d\f\247^U\241J\247\341\337)M\215/\362#1\352U"
+	.string	"7b\321\215\340\262d\177\\\252\211\003\033\255\223\221\300\271B\022p@0\217L\353\270\260\016O\347\312x\303qa\"\226\347\303\001\006\342a\205`\f\036X\033\255cqh8\023\341h\226'\3134\253\372@\207\253\"_V\\\220@\312M1\241!D\310\207\374\224kJ\364cJ\003\033"
+	.ascii	"l\263\341\214\351P\262a\2415\325\357\355B\017\005]\357\r~\300"
+	.ascii	"\342\240$\300\025\024v+\2141\231\366\2549\230k8\312,\300\"\214"
+	.ascii	"\001\345\300``\204>c\004w\t\030\260\252\2215CnW\321\003"
+	.text
+	.section	.gnu.lto_calcHorizonLevelStrength.171.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\376\007E,"
+	.string	"JN\b\021FpZN:\223V\032\024\320Pw\013\3459\025\034\221n|\241\306\002\035# }d\253J\001\b\022\353\364\01724\271\3303\013\355\243\016\375Q\016s\341\201B{ao\330\177n\321\337\376]\366\266\266\215\220-w\222\001\002\001\337"
+	.string	""
+	.ascii	"\001\317\302\237c\241\226\031a\310\2405\247~rqw\320\366<\374"
+	.ascii	"\340\220\254\206\367JK\013\013\025\376\025\026V\271\025\252\273"
+	.ascii	"\311\030V\211\335a\230\031\232\025\016\277\237\303z!\224\205"
+	.ascii	"?\231\017\205\037\345RX\330\266t\323\360\373\311\306L\244\253"
+	.ascii	"\341\275\201\205\006K\206\337\317\223\231\212\377\344k,Tc&\236"
+	.ascii	"\032\264'\017~?\2376\343\267\353\3260dhV\334\334{\235~r\323\357"
+	.ascii	"'\277\311\235P13-`a\2559@sR\243"
+	.string	"\255\316\275\027\n\351D\350O{!\364g\0039\325\205A\340\317\207\236\266+\025\3377\241\302\222\311\224,\256\252\013\203\027\263\365%\367\244\263-\260\nL\372\371&\374\350\332q\237\230-/\271\032\025\355\021Cc\276\371\321\005\366\023\253Z+ \254.\307\305l\201Y\2460cj\204\\W\265\177\270R\213t\357\375\332\353\r\256e\255\276\t\367^\256Y\\]\347\2363\263\0333\303`\366\025\t\305\226s\346\336\333\300\313\351L\360\315~\262\021E}\326O>\n\364gR\377\312\353W\231\035iV\265\311G=\240\t4\004\273\224\316\2626\031X\237\216Z\bF\fX\235\316\214dQ\2375\240/\345\265\007\025\275&\336UW1\253-k\2271\337\336&c~rJ\200\340Z\316\007\232\236v6\200VfB+/\375\355\254\204V.p\267s\222\255\214d+\0238\333\371\350m\347\001\266\262\321\343\316\304\253\235\213l\345"
+	.ascii	"\2662\221\255<d+\013\331\312A\2662\220\255<\264\225\001\330\312"
+	.ascii	"?\266\262\217\255\334c+\013m\345\240\255\f\264\225\177\266\262"
+	.ascii	"\317VFm\345\363\254lm\345\356\312\265+_\201\217\236\031\327\205"
+	.ascii	"\264\271W\253y\347\342\235rE\256\345\217\373\337~\267\237\355"
+	.ascii	"o\373\323~\265\377\230\317\034ci\324z:\311V\007gCO_\356\347\326"
+	.ascii	"\027\036\324\251\203\372\251\233H\232\364\354Va;\265\235K\303"
+	.ascii	"\316\016\266\260\211kR:*?\300\016\266\017OzF\240\201\"\330\210"
+	.ascii	"pI\341X\325\346O\0075JgY\177\375\323\\S9\277F\337R:\003\215\266"
+	.ascii	"\257\317\374OolH^j\204\275\340h\363q\242]\211\244\341\200v\004"
+	.ascii	"4\277\016,-#\226\311\314U\351\354$\333]\336\3170\263\003\303"
+	.ascii	"1\034\372\363l\032_yv\352\275\267\252\273\214?\240\266G\260\351"
+	.ascii	"]\325=\346\2179\231\017|3\006\021\242>+D3\370\312[\342\305\374"
+	.ascii	"\0253G\304.Kh6\367\256\356\265R\3526\320\365-=c\352\356\257]"
+	.ascii	")\313.u\263\324\005\232\251?\345J6\346j/)um\032oQ\307\223\341"
+	.ascii	"\273\003S\364m\271S\352\303\275h\n\232\264w\201~\215<I\375\276"
+	.ascii	"P&\335c\226z\235\214\276\023\204y"
+	.string	"\352_\002H\243RJ\203\221H9%EAilq,\266\b\302\210\252RQuDT=\2414q,&\225\033R\024_\0241\034\2211\214I\344\211\241#\322\250\224:\032SL\035/(\217\305d\322\305T\020O- a\\\001\245<a\302\230\242\004\324\321(\245\002j*\331\002j\001\221\221+\212I(%\022\231\204\022\252Y\335\336&\343\332k?Yj\227\307\326\3738[\202\t^\226\332\335\235O\275\224\332\345\001\026!\001\341\261\211\303\263\352\245Q#\025\265\2210@' \352\241\016\320\304\266\364\214\330DM\304\223\322\r\365\321\230%mR8\301.\343\313\235\302\233$\277\246\363H\337\204\371\0204\261o03\261{\255\256\t\233\335U\335\003\356uh\252`m^\274\254~\007Z\250\021t\267\325\021\352+\001\213b\307\013\250{\372@\367[\032\266L\202\325\005\316\260\201\372\351\031\200\366\351a\033\315I\317z"
+	.string	"\264\2005\251\021f\036\311\275w\350\323\237;\210\261\"M_\227U\005\200\234\250\201(\303\030b\206\241!\021I\n\222B:\200\002\231)\253n\021`)dn\210$I\251\335P\007\214X*\fByO\376\267`\274\243\245P\234\227\032'\370\251\220R\245%\231\257J2\005\034\253x\337\365\030\006\365\375\270/\253\260\t\213t\244`\034i\323\260\264\224\013q\027\221\215\350P!\240\022u\301\243\036NB\372\2241\016s\231\236\214\033\203\240CL*\370\352"
+	.ascii	"\215pJo:GN|\265A\242\200C\037KIu\021\316\005\257\364\261\213"
+	.ascii	"\263\265\250\332\205\251M1W\331\344\204w\003\271\022Xg\240\016"
+	.ascii	"[ckgZ=\264U`_R\360\200\r\327jb\005\003\250`3\261;x\210\373!M"
+	.ascii	"7\376j}{\202\017\274\345x\264P\204r\341#\254\353\022\357P\032"
+	.ascii	"\013$\306\356(\f\360\201\316\233\265\376\265J\335Hc\336\265\203"
+	.ascii	"\205\2579\277\017.\363\264\252\351ZP\334\307A\215@\371<\r\237"
+	.ascii	"\354\262\322{(<j\333\265Z\004\302N}\262*:=\363\326G.K\350\370"
+	.ascii	"xf\244\020\203LxIA09\376\021|\321x#^\205\203L\302\t\336\032<"
+	.ascii	"\337\177=\365\366q\316+\231q\332\220G\005"
+	.text
+	.section	.gnu.lto_pidLevel.172.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\325\026\245b"
+	.string	"\232\252\274$E\020@oe8\023\023\343\201\251\026\227\003\2742\342Y\017\353MX\026,\211{\244lVb\271S\367Gh\330@\375\320\360)\254\024a\334\233|(+\302)_`\"\260\002"
+	.ascii	"\207Z\034\252\316\033\021B6\331R&\031\034\002\013\002W\002Z\347"
+	.ascii	"Ua\344Mq^\024F\336\023'\257\211\223\267\304y\t8/\t#\357\210\363"
+	.ascii	"\016`\344\025\340\344\025q\362\006p\336\020\347\005a\344\005"
+	.ascii	"\340\274\037\214\274Y'/\326y\257\316ke\344\255:/\225\221w\352"
+	.ascii	"\344\225:y\243\316\013u\336'#\257\323y\233\214\274L'\357\322"
+	.ascii	"y\225\316\353\301\310\233t\336\324\310\213t\362\032\317[</\321"
+	.ascii	"\310\213\236wh\344=O\336.\362\376\037(\271\231\002w5\202T\325"
+	.ascii	"Ja#5p\310W\346\201\277\236\237\317\037\303O\347\257\363\347\375"
+	.ascii	"\315\027w\377\366~6\r\234\201y\350LQ\317\001\227\374o\177\310"
+	.ascii	"\031J\367\334\217\017SoL\263\317.\331M?\374\235}\337\246\313"
+	.ascii	"w\030\226\217\241\214\351\254\213\312Te\220\331vB\361C&\376\023"
+	.ascii	"z\027\366/\334\316\365\276\267i3\r\223K^\333\331\352l3\260\021"
+	.ascii	"s\n\031\235\f\256^Q\331O\n\314\272AUUO|\270A\212\037\016w\227"
+	.ascii	"\273\351\356\236s\266y2\251ni\315\031\035\247\t\025\223\252\006"
+	.ascii	"\207L\013\346\335\337\275\205\345\337<y\223\252~\351\263\247"
+	.ascii	"\252w)\026\305]q\317o\263}kTU\022\306\354\251\252\232bI\024?"
+	.ascii	"\334\335\375\232\263\260\334m\342X[k\001D\2320lrtPUU\013\304"
+	.ascii	"\243\320\017\317?\241\037\266\t_"
+	.string	">\013\353\312\252\212jJ*\n\352\311\251\211iI\311CR\212d,\022\321\341\331\274\334\343\375FZ\263O\033\334\331\263\260\330\374\212\005\2775l\245\346UL@5L\305l>%U\346Qd\3060\324\223\230;\2059\201\233\230\352xI\211\313\034{H\272\335\233\034\247H\377\363\266\345voZ\330(B\b\273\267\020\270\030\202\b&\205cc\224(\203\204+`><M\314\371aQ\202[\317(?^lH\341\326\370\374\363\026w\202PU\365{j\334g\224\0252m\377\363\266\302ib\360\216\242\343\235\335\340\322\230\2112TU]n\203\273\362\375\360\335\353\260\273\177v\241\016\005rh\323\331\021<\323%Fa!\243\245~\224\356@\253\235R/\365\371\347\241\323Vjb_R{X\304\365\274:E\2373(\251\237\007\006\251\323\024OT\306\002\207.-DH}<[\002\021\276\250\233\263f\330t\253A\017\317"
+	.ascii	"\303\300!\244\306\214\036\346\r\236\fg\323m\363~\026JMU\321D"
+	.ascii	"\030[\t\007\260\330\306\256\312[\007\211=\354b\237\205V3i\\\270"
+	.ascii	"h\023\017qm\rRU5\027\273>n\bHQU\325\266\nu\260\nYQ'\246\t\372"
+	.ascii	"!\332[\204\370\316\036\366\331\036\241q!\212\327P\226\345bw\310"
+	.ascii	"i\350\232\032\244\252\352\326\240\023\"\262\027\363\341\0261"
+	.ascii	"b\244\277\367S\321\226\031\230|\234g\315\212\231n\272\305\322"
+	.ascii	"\307{Q\020\016\rj\314h\177\022\350\373Xz\231-.\355"
+	.string	"\200>\203\327^\314~\035\371mG\364\3037\223-y\b\343\320\270p\367.\215\233n\367]XXX\270\375e\027\313\351|\017w\362\376\315\312\353|_\205\312\363\276\237r\336\273=\206\357\333\244Da[\327\324\236\206\3669\337\237}\316\177\365\201\337\345\365|\241<\316\317A\221\367\311\311\353\344|\276M\336\346\327\340o~&\257\363-{\363\253\374\234\357\222\223\227\354\344M\236\274c'\257X\2217\354\344Ur\362bp^\344y\301\214\274I\316\213\304\310{<y\217\234\367\353\274\027\234\274^I\274\026\234\274FN\336\n\316[$\211\227\202\223\227H\312;A\312\333\225\362J\220\362\0161\362F\220\362\nIy\203\244\274@\316\373\243\310\353#\345\355q^\256$^\bN^\036)\357\216\224W\307\311\373@\312\233#\345\305a\344\275\221\362\332Hyk\244\274\016\234\227F\221\267\201\224w\306ye$\361\306@\342e"
+	.ascii	"\211w\201\224\027F\312\253\300\311\373\342\344M\340\344uq\362"
+	.ascii	"\266@\342\335:yY\234\274+\220x\0218y\0178y\r8y\0138o\314\345"
+	.ascii	"\232%\233%\033\364C\342\267\017\375\360F_\020\030\276.h\215\266"
+	.ascii	"\341@\317\350\0324\332\201\006\232\006\253\361Z\27296\320\306"
+	.ascii	"8\031=\243\277\016\306h\031\234\206W\230A\243\006\277\255\006"
+	.ascii	"\372a\214F\265\310\371\021\306\241E5\335\022=X\237^\245G\260"
+	.ascii	"\301\031r\272\225.k7\245(W\2022@T\273\022t\201f\240\277\316\245"
+	.ascii	"-\320W\200^(\204\321\207k.\304\366\b\355\316\317\324\270\335"
+	.ascii	"\305\371c\350m\220\002\r\243\261\376V\273\027\255\300\333\213"
+	.ascii	"\376\336\013xS\272\254\377\326\317sc\rit\362\254\211\322\240"
+	.ascii	"\022\350W"
+	.string	"I\240\037\306\013\035\274'\027}+}\006r\321/\003\310\205ENM\267\274\304d\2162\231\243\204x\210gk\224\020\315\360Q\032u\204\206\351i\215\356P\002\322\327F\035eQ\272Z\177Xw\320K\372Z/\315Y4\227nswY\204\262\335Z\234J\267\230\373\333\352S\331\352\343yQ\221\027\027\016\255\214X(Mi.\264\242Y\334\255W\264\0309\353 \002}\267\2675\002m\"\207\225\321\r>\241\214\343\354\346`0:\356\250\216\353\336\326\357\373\215\025\344\3440\333(\373\200\276\224e:.a\233<V\217\337\266z\350\207\007\364\355\266<\"\214C\241\311\200~Z\001m@_\253\013h\253>\025\215\242\265R\264\n\022FHq\242Qp\3419\026\341D\016\204L}\302,\231\350\253!B+\321&\372\004t\211\266\352#\321\0034\001#\232\204\226\020F\b\320\003\200\220\345\003\001\022\021*\365\361\342A\304\227\265"
+	.string	"ZD\210\016\240\255\n\201\350\017\035\242\211\205"
+	.string	"h\020\f\307u\275A\374f\247\016\200\276\036\241\254\376\300U\312Z\3241\225.\026u<%\253\357\267\305\020\023\253\204;\023\222\016\245X\375\365\252\261\254\232\252\257\252\332\212\245p\224\252\251\246\342\225\327Xm\252\0203\013\213\2279$A\333\347\307\213\r\306/C\024"
+	.ascii	"\335\300\361+J\3656\237\002\323\331\272\003E\265T\177\265\203"
+	.ascii	"\352\250\266\n\264\016>uSC51\320j\306\251\237\n\271\256\367\b"
+	.ascii	"\317\251\257\007\206\217\251\233\032\225m\355\320\265\202\021"
+	.ascii	"S\177\317\026A\027y\252\036\361\304\r\200g\366\006-g\001\013"
+	.ascii	"\246\242\f\314\314KLk,)&\226\374\262\0023K2vT\232\001\t;29\356"
+	.ascii	"\030K:A*\223`P\303\r\214\360\feR\251<\"\201}\231!\311\246h\204"
+	.ascii	"\205%\225R\312\244\331\227\227\215\261$\322\314k\f\031\3665\226"
+	.ascii	"\343\310\004i\366u\f\013K~]\231\215!\223dfG G\220=\314\306\216"
+	.ascii	"Je\006_NbHe\220cX\2221/\3431\f\211$\251\354q\004I\206T\206\334"
+	.ascii	"\300\353\334/\025G\220dZf`I\220aH\264\306\220^bZ_\3122-\025T"
+	.ascii	"\233$;*\265\314\222I\245Vz\207\366S\355/{?\277\301e\305\372\331"
+	.ascii	"\277\260\211\320\346\352h\237[\013\001\247.\245\227,i\n\304a"
+	.ascii	"Q Z\247\235YM\2476Y\377ln\331\311&k\253<(=\326\311\276\3406\271"
+	.ascii	"\2145\232E\256\0213\016\215w\227^\226t\374\266e\337\317\245\356"
+	.ascii	"p\350"
+	.string	"\023\230\326g-\002\017\235\301\202\322b}\264>\345"
+	.string	"\022;qG\220\23096WM\267D\320T\265\261\013\0378A+TG\332I\273\255\340\237\024\0211\251'\201\206\365\023\016\fk\016\344\022\021\306)i'\r\245\271\020\006\255\004\331\030\264\225\243u\020\254\2214\262\211\216V3I\032\354\217\353M\277\274$\375&!\276c#\351\340\215\367\224\301\250\323\323\265%\303Q\353L\260\321\034\033>+\257n\322\335\313\207Z"
+	.ascii	"\024\254j\272m\322G\372\200\347\270,\201L8\200\276\372\310\005"
+	.ascii	"\375\325\347\337\212\350\202\036\346\300\366\310\202\366j\316"
+	.ascii	"[\007\361X\320(\0329C\204m\214t\005\335\244\357h\265C\301\032"
+	.ascii	"\364\356\022\3142\f\277\315H\237O\027\265>\333\"]A\243\177\024"
+	.ascii	"t\221]\216a\030\226e\226\371:\270\262D\241\370\004\375\220\202"
+	.ascii	"\276\337\207"
+	.string	"W\344\0041\333\274\216\321\340\036U\323M\021\331kN\320D\272Z\202\236\240\253K\310a{4\244\205\264\004\021\364\220<;\021\004i!@\272G\007\371\321@|\364\017:>\270\272\007\004\315\205\007\001 S\212G\277a9\333\234\252\203\303q\226gTX\246I\263}\177m\210v4\017\035\235\243wt\t9\017\264\016\270~\240K\364\255\210p\264\215\316\321_\367\334h\034}\365\267\0162\033\276++r\033v\263\f\201\230\250Q4F\221R\250DDD\222\202$\205\326\221\005\004\031\345\240*\363\021\240(\207\0343CD\"\222\024\024\024\024\262\214\001z\336\344\222\n3\301\367e\203\035\200\266\252\316C\303\254\377\203\352\310'\235C\273\212\364\3526\257\205\374\311t\321\202\032t\262\261\243I@\372\241%\206\331A\321@\030\242~\314\336\020\013:\337\230]uT\316\200\240\244G\253\314\024\227\b\310\334\310\310\356\372\235\277"
+	.string	"\265-O\334\305'\244dle&\tAX*\214\2127\226\274\211\360\363\214\223\275I\322\240\314\006&l\004a[\240\362L\244\002\234\210\017j\361\243\345}*V\377a\337tm5c\244\207v`\314\t;\243p\036\361\257\236D\232h\356\203(I\366\252\224\375\374\234\336):\212I\200E\315\201\352\330\365#\327\270\252\363?d\341\263$\337\3555\367\306\244\207\235\006\363\017\362\"x\21666\220x\032\250,_\3378\361\361\\\372\006w\317\314@*#\300\315I\r\003\212\254\360p\202\236\350\302\322\337\365\020\350\253E]\224[\233\236\236e\312z\220\334\2253\216z\321\035\026R'\274\007s\370i1u\311\266;\034u\265\243a\f\372\250~\272\003]\177C\343>\212-/\034\326u\320\340,\253\013\227(\243J\026)l'"
+	.string	"\236\030\200\254\031\274\331\303'F=\303Z\035\013\271\0058\274\310Np\033V}ZIOv\021(S\f~_\324\305\217&\300\207\332s:"
+	.string	"\024\0202)\362LA\326\b\262\021PG<\346v\254\203\206\252\302\377FVV\375j\215\301^)\367A9\347\360\367=\300\354\345m\004\007\2564@\341<\030\204\251\300\001\0266\350\311\335x\356\013\035\353\017\373p\360\335\323P\363\036\004\020 HwWgp\245\224\216=6\354v\317\274\2617\n>\273\214p\212\224\214\202\345\240\336?\032\336\301\021\375\203w\266!!\336lK\2506\232\311\214\261\2572$ *e_\ry!N<M+\243~\331\t9(1E|\356<$\340=\323\f\303(\224\235\326b\346V\273\265\376\201\3621h$e\335\227=x"
+	.string	"\324>$\373\315>3\331\033\030?\244~\246\237\254q\257"
+	.string	"P0 n7\242&\231\222\353\033L(\277\3436'\360\006\331\\\352\336~\212\267\263\272\003{Sb3\346\002U\\_\277\354O\341\"(\017{/\334H>g?Z\216Y5\342\314\332h7\026\361\327\n\257x\350\022\243\332IJ\244\324:\362e?\222\r6\270"
+	.string	"\030\341\334\257\300\225\006:\017\255\372&\230V\n+\276\214}\2258\030\002"
+	.string	"\222\230\037"
+	.string	"3 \201(\272\304&\200&\211\362\2016\365\340^-"
+	.ascii	"\332\301 \034U\342\201U@\332B\017\312\275\\g\254\027\2617\033"
+	.ascii	"\256\302\243SS\335\341\301cE\025\214Lb\340\340\334\017\232\276"
+	.ascii	"\253\\8\016\t\037,,|1(\013c\025\273\353\372`\312:\250m\r\332"
+	.ascii	"\233\231\373\030(O\364\356\244\355\367\007"
+	.text
+	.section	.gnu.lto_acroTrainerSign.173.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\025\t"
+	.string	"\346P>80\221\322\001 \274A\":e*x\027Q\331}[\223\026\372\036~\250\320.[\332\372\317\2002\365\2353\312u\013\003\355\300p\240\032\n[F8\231\206n\216O\266\224)\005."
+	.string	"."
+	.string	"-"
+	.string	"\232\235\177\331#T\276\231\225\207:l]\341\301HL\013\344\245`B\255\304\346\262'\313Se\0028\354\256s\345\211\334\333mC\330^\260\375\005\366'\0373\315\002\273\037\214ew\033\254\020\360\315\266\017{Jg\277\300\331\211G"
+	.string	"\373\360X\301\331\335\030z\201\347\033\374\200\347\233\232\274;\f\257|\313M\215Di\266\023!\365AF\2259\366\f\225\372\262\017W]\366c\177f\372\020T\003\342\375\203\331\r\331\321Y\232\315\005\305v\027\034\267\210\233\030\225\342\351\302b\204Q\0215F\022\031Qd\332\210\234\201I%\nS<\221H\246\370\231\355\341\252\313\251\3343\031~ei\250CS\020j\016"
+	.ascii	"A\204\346\265Pn\b\005\252\"CE9\r\220\016a\271\206\353f\3618&"
+	.ascii	"\210\250p\005Py\254jt\212\246\366"
+	.text
+	.section	.gnu.lto_applyAcroTrainer.174.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\377\017\275M"
+	.string	":\203\260\034O@T-u\307bq4\321\207%\222\003vk\3157%8#4\020\220\203G]\035T\023x\030\205\212\t\374\217k\353\265+\307"
+	.string	"B\322\333\003[\343/074\027\343\326\034d\017\225\366\3219\365\211A~\361\006\240\201>|kF\270[J)\005\277\001\213\001\272\001\\\025\302\271\215y"
+	.string	"\fr\002\264\r\354\336KD\003\t\241\3238(C\335[\b\314\303 Z\215y\310$t\032\2637 A\"\032v\357m\037\334B\364\020]\345"
+	.string	"\006h\033\215\t\3314vk\374\260\214\260\206\335\335;\266\001\260\3313)\2469$"
+	.ascii	"6k&\002\2629v\273\206Xl>\302\356\210H`\0366\3132\267\334e<df"
+	.ascii	"2\256\366\245\272\376F7\345\262\336{y\232\345\241\347\301\325"
+	.ascii	"^\361F=y\021\340\316\334c\375C\333@\230p,\336&5\205\264{\307"
+	.ascii	"|\270g\f\310\355\275\203\3278x\357\r!\322\356\275>\274\003l\226"
+	.ascii	"\231\271\247\035\3262W\031\2301\343\207\240\351\326\263\307\335"
+	.ascii	"\2757\211l\243\257\331^\257\370\232}\032\272\355\034\234\033"
+	.ascii	"\033d\r\315\214L\f\314\313\321\245\305\310\262\242\222RD9!\232"
+	.ascii	"\f\205A\340\317\307\366\336[\356_\002=\260(\0315\316l\252\251"
+	.ascii	"s\246\215"
+	.string	"3\025\302o\314\332\306,\bG\372\350\032\037>8\315\216\236\331!\3462\355t\3261\3230\207\351\241_z\320\341G\027\260\034\336\0026\004\207\033\275\232\245\007\323\325\323i\363\362\025\341\214\266\247u\311\r*\256V\251\241\207d\343\362\224_\002jms\203\n\254\213[Z\216b\325'_RQ'~IA\335\304*\006\037\332ha\317X\004\213\216E\224\b\013\375%\005\203\007\215H\331x\301\20167\250\252\372\367\f\3226_RU\356k\241\331\036L\224\b\013'S3z:E\260\350\032\210\323{M\377j\333\030\221:\353!\357\275]\326\0365\365\344\376K\340\336\313\0165E\325\254\323\314>ef*f\342\f\0010=\234V\340\373>\370\277\036N\033\236\374\312\277\007\326E\320gZ\3676\203\230'h:\n\200\3676\tX\242mZ\320=\272\313\004_\263\277\357\263\255\037\354\373\276\237yN~m\235=w\201"
+	.string	"A\314\030\264\\\006?r\367^\002\222\3508\r\270\273\214\214|\315\262\337\325\366\231\252C\"*\366\303\311\257\276\227\n \006\246\305~\026W\231\331q\200\276\201\264\343\240a\244\210\023pn\367\336\333{\251\221.\240U\300Q\274\005t\377\216/\350\273\254\201F\250sM\307\343\357\035_\177\320\263?\253\236\372\210~;\342\356b%\fo(\030\276f\373\207?\324\345\020\025\253r\362+\363\330\223\277\224\271\377z\275^\371\263\230_\264\263\213\242\026\322L\324\316-\332y\250\315\232\205\032\210n\004zG\367\001\357l"
+	.string	"\320\271"
+	.ascii	"\240sP\363\350\006\352\263\346\344O\2435\373\3644Y3O\320\231"
+	.ascii	"\305\320y\305;\003\020t\336\031:\253\b:\353\004\235s\206\316"
+	.ascii	"8\357|#t\266"
+	.string	"ig\244\320\271\346\235i\336y\346\235e\3369\346\235a\336\371\345\235\217\357\354\362\316-\357l|g\226w^yg\225wNy\347b;\243\264\363\311;\023\337\331\244\235\207\357,l\347`;\003\203\316\277v\366\005\235\331w\376wv\240s?@S\366\004\307cZ\303\307\215\335\032W)\356\033\373#G\013\3516\353>\353F\353&k3\202\033\f\252\204\315\b\326\221K\343\036\"$ps-,?\335m+==\364Q0O\374\276A%R\3640@\240J\250qdw\306\227\262|\026g\260C\nW\333\233\255\203Wliy5T\\\336\200\242\3576\241\177\371\242\377#\316(\321\033\377\345a\340\334\252\006\374\361\211\336\333\244Z\035\214v\354\361\300D\222\253\250X\325\312KU\226\\\257o*\315\326\016mA\316\212\372\204\202\2157k\263\345]\276\327\346\3742~\313\263J\234w\236\002W\233G;\365\250V\354"
+	.string	"-\024\034\252\365A\001\"\"_\263\306\357!\375\202\nj\247\203S\262\376\375}O<\371\025\357\336\313\302\362\377\354N\273\225Wy\226o\347\327\223_}\206\013F[y\343\\\312\253\374\261\315iC\361\211\237\362\355\342\213\337D\240t\32482k\221\350N=t\247n\353\364\354Y=\351f\3621\2478\236U\023n&\237\017\2127\361\032\320/\312\007\247\220\274E\305~\240\2744\217\327TL\001\006=\262DhU{\342\304\305\267x\266\t\t\027\361\344\037\tu.\n^\003\342\235|\257\315\231\020\337\344\227\324\206\242\357\270\272"
+	.string	"\243yC1\232\257Y\342\353lU\t\275\311\377\250D\252\316\273\341K\225\360Z\216\234]\333"
+	.string	"u\273\263\023\276\224[\374\320\217\240\221\244\311\t\270\346\261{o\360\245\354\277\237\356 \035\004\233F=\253\276\236v\361Q<=\374%U\211\246\3435\301k\300\2666\023\r8"
+	.string	"\001\004\276f\207+d\250\263\002\177\237\305\316\376t\003i\225^O\267\370($Z\350;H\265\317\222\300\341\352^\036\272^\361\232\367:\341\b_\350\275\316\371\025|\341\007\034\343\207)\006\323()\251\264\224\224\264t\004#\303h\204\245\222\251\324\300\007G\312\030G\304\244\245\222\331"
+	.string	"S\311\244\\\n9P2\217\224\036,-A8Q\200\251\244\\.E82a*\227\317TBZ\222\200\251d\002&!-+P\312\200\241d\024dB*\301\250\307G?\034 \201\220d\306\200\201$\243\203\244\022\222QR\362h\311\224\3749\362\022\b\312e\222\271\264\264L\016\307\234\272w?\213\273\254U\034\350\271\027\303\3632\036\350{>*\345\r\317\306\233\323?q/\207\305\217\343\360\265\342Y"
+	.string	"\260\"\371"
+	.string	"\340\330\321p\263\363]\216\303\313\233\327T\374\016\217\212\367Y]5\277\311\306\016\013\251\343\343[Z(\257S\343Wm\363\254Z\222+M\3163s\217\317p\301\220\226g\271\264\265\001m\255\254\240\232\300\371\234?\036I\372\3153\267X\255\324\327P8\217l~\323\025P\350o\3768\205\363\353\344H\036\334\314KYE\267[>\233\357\035\254hh\275l\276\245\240W\035U<@\224\t\221yi\314\001\217\374%u\256\346\221\036\203C\333-\256\326\313\313\327l\315W"
+	.string	"\315[\002\363R\3466\207\277\300\325\231\252\366\206\226\240\026\334\205\026\207V\207\226\207\226\207j\357\250%\221\213\206\335\275\270\024\275\033\213\336:\235{V[\212\200RLs<\253E\256\342$;\372\024ss\361\247f\243\317s\213\317s\257\350\363?\037\325C:\230\303\224\356Yuy\361n\004\242\233r=\253-@\337jRy5\212\376<\037\345N\375\023\003\215<\031\2164?\363/\336\353V\240\371.\242\350e~\346\217u1O|\231\241\217y\0278\2678\247\325e\b\007\005\032xE\234\b\201O\250\221(D\031B\246\206D\244 )H!\035a\005\204 '\241;\017\0210)d\214\021I\223\354\254\001\266+/\r)\241P\251\221\214\256T\377\333\3274*\260\247j\240G\224) \030g?J\300\340\022\265r\221g<\373\310\272\306\222\244\236\257\217\203\345\245\036\376\215\271\327"
+	.ascii	"ZR\321I\261\327g\316SG\310\037\372\004t\f]\235\027\323\242\341"
+	.ascii	"\357\245\367\224\007o\331`5\351\262\3762\004\271y\r\242\007\260"
+	.ascii	"v\232\215\347\3334t\251\024\022eS<\224\035\267\035"
+	.string	"\013Gcq\360^L\254w\332\035aM\245\351G+\225Ic\330\325\006\023w\326Y-X\3541~\340\223\353\211c\340\033\204k\332\"P\364\0065\222\233O\371[\304\314F5\272\026\317B\232\313\201Q\232\003\002\024r\016\320\252\227\304\265\bd\255F\272\375\261\274\225\202\304\246\314m\325\361\273d,\371\360\331\t\022f"
+	.string	"\330\f\276\214\247G.\301\237\201\367\006\347 \300\222\304\325^\277\261\226\022,\340\277\207\374\013F\317\214\027\357\232\334\373\223\373i\227L\206\376\013\213-\017\267\001\201\034\254\366mS\306[\307\0019_<\2244\344\377\007<\230\214\232&a\240,\205\313\025\317\315\370\025\273P"
+	.ascii	"\223\355aS\345\003\203jA\203&\307\3004.`A\217>\334b\200S\250"
+	.ascii	"\254Y\262O\341\036F5lR\200\035\246A\fS\344\330mJ\204\342\002"
+	.ascii	"\347\262q\007\302[\026\0308\017p\301\244\223>\275Qb\222CS\274"
+	.ascii	"/&i\f\035+YL\200\025\001\207\300\026Z\013\r,\212\250\f\261\031"
+	.ascii	"VG]\037lD\306Hz\n?S\367\225\246\225\214\005B\373\373\262c\200"
+	.ascii	"wx7Q\003\260t\377\\\031\345Z6\340\353\022\334R\332\252\211a\224"
+	.ascii	"\r\013\241xz\242D\334\344\304\2627\206\231\252\337\3260!t\332"
+	.ascii	"\352}\242^\326\370\377\266\301\354\227\305\177j\\\225tHE\337"
+	.ascii	"\204Q'\266\006\301?\005+\023\214N\307Lr\317\243\221\277\362\021"
+	.ascii	"sk4l\334j\310\265K\303\002gW\375\346(\222\023\374\324<&)\216"
+	.ascii	"\225\275\315Eh\274\345&D\270\227\026\003e\"\033\023f1\006\314"
+	.ascii	"\214j\243\305\234\206\310\263\224C\254'\350R,3\206\027\375\344"
+	.ascii	"\343\021u\230\030\321\316\035\2708\303/a\200B$\007\275Bl\226"
+	.ascii	"%\265\337o6n\361u?\004R\260\224\036\231\340\256\366\254\304\257"
+	.ascii	"e*"
+	.text
+	.section	.gnu.lto_rotateVector.176.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`k\003]\027"
+	.string	"6m\227F\300XM:\300eD\020\271\317k\372\022t\367\342\032\013\224\025\371\277e\007\021l\355\261%\324O6\356@\261\3763\233F\322'\004\244\217 \f\210\340`\311\374c\241\253\227\237\005\001\222\261&\344\227\277\022K\310N2\245\201"
+	.string	"{"
+	.string	"}"
+	.string	"\356\312\340s'"
+	.string	"Z\325\352\270\021Q\3609\353\232q8\207\314\2662y&\306\"\244\246\030m9E`3\215\347\3563"
+	.string	"\317]\353\033m\213\273\022\370\334U\326.\271\t\021\177\026\324`\2108\232\022cl\275Eohsa\312\334\301\247\254N9\330a\270\"\tN\210\366\343\016\312\304\030W\264\020\020A\016\321\202\022\3168\341;\311\335\212\\\020!\332\tg\312A\214\261)D+\341zn\033k+\241\275\2124FrY0;\003\26320\033\003\263+ga\236}yV\005\263.\316\266<\373=\233\202Y\317\331\356Y\370\3543\233\231u\200\030\243\0274#\211\212\221D\324\225\b\3259\305\260\222\275d\343l$\303\326\255}\324?\314\344\246\252p}\202\021\tB\315\206\214\b\337\022\224\332\215\007\237Rq\tu\245Vk\360\035\325IU\271\253y\270\207\314H}r,\021=bJ\255F\223\030c\201A\027V/\2779\214\352/\254\253\356mp\371n\363\026;9\365\257\346\251\303\243\032H\254\270\357E]&\317\235w\017\245"
+	.string	"\272\315\273{F\003\272C\274\037\3363#\232\377*#9&\"\262"
+	.ascii	"\345k\322}\362X\317\253n\271#3\242\034\3734\267\222\231SPF\325"
+	.ascii	"\200Y\367\335\344\t\267\\\221\031QPF\3751\306\237\237Ek\373I"
+	.ascii	"\307\027\265Vrq|\263ol\263m\274\344\326\030\347\006\t,\270\256"
+	.ascii	"\300\202\353\025>\360\364@\227{^\256\230N\354\005\373<x\207\307"
+	.ascii	"\247\203\200\f0\235\257;\007.\270|Z1\r\031\\\0330\264z\\:\034"
+	.ascii	"Z;\260\016\255\0037}\371\360\300Z\261\327\013\326R\331\242\035"
+	.ascii	"_\264\303\036a\305\004\024\320\203\272\263hJ\310\375#\311\002"
+	.ascii	"f}('\311\003\234D\311\335\220\200\310*\2061\306\b\213\023\243"
+	.ascii	"@T\204\n\212\231\303\270\260\320\023\231\273|\346y4\223\341]"
+	.ascii	"\346\253[N\312\314(\346\336qn,3\242\325]\036s\030ef\024A\250"
+	.ascii	"\021\360\250#L\221\tl(\210\244\205\205s\240\002\221\253\342\006"
+	.ascii	"\020Xfb\232\016\":\332:N \177\273\211K^\336\357\374\3360\267"
+	.ascii	"\253KP\215.\214/\265^\003)\312{=\277\307Q\314\017U>\257*c9d\270"
+	.ascii	"\225\331\024\n\016\031\317\3437\314\314\244\236\204\022\300T"
+	.ascii	"\262\035W\030\004\024\215m\003\253\031\265k\326W\003EW\321\264"
+	.ascii	"\007\030J\300\231x\311\370h\272x\342\030\275^\376-\274r\303z"
+	.ascii	"f\330\212\b\316\233\f\375\003"
+	.text
+	.section	.gnu.lto_rotateItermAndAxisError.177.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`e\007\035)"
+	.string	"\212F\204\017Hp\234U:o\036X)\277\237\274b{\350:\002\220P\340\371\314\254\362\274\342\275u$\245\370\353\006\365\324r\327\262\205d\352r)h\307\r<tY\222\215\f\215\241\301\200Lm&a\016\036\254Fk\313\2425B\366\336I\006\350"
+	.string	"\323"
+	.string	"\347"
+	.ascii	"O;\354>\365i\356=\365\351]\233\272\337\b\210\312N\020\250\230"
+	.ascii	"\325\3202\3139\377\356\021\236\256\357q\363]\303M\357\001\360"
+	.ascii	"\341\365\354t\271\237\025w\263\325\324\024_\333\324\257\031\341"
+	.ascii	"$\0360E\243\323{U\307$\007`u\037\314C\202\033<\251,\317\310q"
+	.ascii	"\371\236\347mt\230J\342T\035\227\337a\036\0227\370\nbu5##G!\317"
+	.ascii	"\235(\344?x\310\352\312\256\005\252\216@\216\003\202}b\3116\277"
+	.ascii	"a\"\254\263/\037\223\362\201\201\266\242\254\236\365\002N\244"
+	.ascii	"~X\033\346\215I\365\300\r\270h\330Z\023\036WkF\\\307\2204\203"
+	.ascii	"\026\215<\236\342\004H2S\037\223J\202}\030\003!\311L\355\214"
+	.ascii	"P\230H,\331f5F\331\2733>\341\241\234\363\245\334\3420FY[3\312"
+	.ascii	"9\267-\032\217o\337\273\017\245\273-t\253%\002\375\354\247\372"
+	.ascii	"\324^\020\310\264\356rJ3u\257\262e\250\277&\234k\240\354Y\367"
+	.ascii	"\267\234\213\214\376U\303P\262/>\355+\251O\177\037 \363`\365"
+	.ascii	" \332hw\323\311^e\367?\365\364D\322\267H\267P\020\320\235Z\336"
+	.ascii	"\272{\275s\337z\257\3306\016\333\276\245\266m\330v\r\333V\261"
+	.ascii	"\355\024\333\306\251\355\213m\333k\373C=o\276\214\207\003\315"
+	.ascii	"yG\024-\207\245`K\256\345\367\372\263\374[?\363w^\355\376\023"
+	.ascii	"g,\027\230J\230x\365\277\2420\251\272z\315r\273b\n\251\240\325"
+	.ascii	"\347\352u\253\275\374\306\222y\303\310\366)\375\346\263z\265"
+	.ascii	"\362+Mw\316\260bO\250D\313r\316\020lO\207p\237\312\2534\235\311"
+	.ascii	"\364|\31464\246\215\262\234\245\212\2366\002[\313\234\211l\336"
+	.ascii	"\206)\004\320\276\bTE\214\260/\366\311\322\232\204E]\247'\027"
+	.ascii	"\032\032\334U\216\271\355~\214\314v\017\250\371\234:W\267\332"
+	.ascii	"\035:\313@\331\263"
+	.string	"3\302\032\016C\305\205e\273\312^\307\250B7\265J\213\276^\034\013\276^k\344\270\246\340\353\025\272\001\222fP\032H\3656\033\032Dv\335\024\345\370nz\325\253j\251\370XC\031,s\316\022\272I\\\214\211\210,\347\034\301\314\303\216\372WO\373\004\022\222\3724\275\347z\032\205J\353\016\030\321F\357\3159;\251Wy\035yr\f\311\335\023\242Q;P9\023\r\340\353\273\326\r\r'O6J\246\241I\375\304\367YO\203 \243wr\3169\275\312v\360\240z\357\2538\325\204\271\230\340\212\026-\356\001$'pE\304\nC\273\333\032\2607\205\263L\227{i\25001\036<\022\213$\027\024\204\037\204C\031I\253\022\212\243\016.\204\301\245\243%\3410\327'\030\240\b\276\370-\251H\n\262H\361s\021<j\361;1T\3721\020\320\302\027H\303\337\222P8\374\255\315|)\277\215\264:a\304\373\324\313:"
+	.string	"&\234s\325\204gy\331\025\033\365\351\001\272\351\232]\321u:\236\356\002\335^\362\f\016\356\2425t"
+	.ascii	"\031\036\rA\313\263\333(l\270\373\347\323#\025\030,\260\036\257"
+	.ascii	"7\201\004\274\336\005\034\260\354\272\017Y\032"
+	.string	"\230\336]e\337\306\344\202n\272\346\247\350\271\334}\232\325\345n\320\355%\357Do\267\253\241\276\245\255S\224C\314\3609\r%Zvw\212\313\321 $\241\354q6p\360\340A}z\273\377z:E\325\005\253\312sW\331\1777s\316?\267\b\330\177\257\025\2649\375\325g\257\365&\360\300\213\327\272\033\340\200\200\244\250a@\304\224C\246fD\202$I\n\351\240\002\021\261\262:\021\200\255U5$I\2410\035R\006\030\322n\215\211$u {\362\304\230\034\317\033\266\301^W\200\376Q\"\336\236\360G\033\355\224.\016\267\357z\371\t\021\250\211\312\372\267\026\302*\201?Kqj\"\374E\025a\277\270\253\360F\374\320FcW({\365\316\353mE\005\207\364u\177\331\237\275C\361>{x|\232\207T3\214AHN\241\374I \037\n\274I2\303ZW4\035]$\2530\247X\260B\365\236 \310x<9\301"
+	.string	"\236\354\f\007\251\315\322\274ZQ\210o=>'\240\005\346\313h\024\347\204\323\203C\305"
+	.ascii	";\"\3475H%\314\027>\246\260\"\204r'\\\fj\005\243\023|3\360%\200"
+	.ascii	"\266T\226\206\334\353V\243\347\031U\235\331X'+gvdY]H\343]\332"
+	.ascii	"\212\177\021\364y.2!\236 u<\r\255\213\002\004\272\242\300\272"
+	.ascii	"\324\337\345\212\354Y\275\275\3606\023|\312C\350\301\206\210"
+	.ascii	"\324\007\\K\363ftR\013)\310j\025\304\2509\204\256V2z\013\361"
+	.ascii	"\030\325\226\006\273\t\337>.8\347\257>\272\325\346\017"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.178.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`L\002E\023"
+	.string	"f$\177H\320\320*\035@\303b\350H\240\033\021\202\215V#\351b\213~\"W\351H}\221,\355\2662\026 KDa3\253\200\342hW|\017o\270\025\246i;J\275\350k\324\0177\003\230N\235\240\335\375A\206p\373do\271S\nj"
+	.string	"b"
+	.string	"l"
+	.string	" \202^\354\356\210EJ\237\266\375\024W1\263{r\207\2433\240\263\342\306S\264\273\251\220\177\200\237\362\004\300O%\361\331I\340\224\032g>\311\004B\355\327\203\313\321N*\321\034\364\310\335d\310\356\306\304\351\341\362\224\263E\225\bj\202:x\3444\310\017\032!\206\316{\224\311\325b$\231\354\256#.7s\227n{f\333\304\216\264\340\347\325\201\215\020\212\01701\264w\264\2507\3665\fC#\253\b\3739?\352\364\335o\372\316]\002\243I3\032\224\3213FK\215\326GG\215\376\200"
+	.ascii	":t\271\037\021\355r\bw\254o\002\231\370\316o\237\347\223\355"
+	.ascii	"\035\367\2763\033}C::8v7\301\247K\342\316\275\030E\n\036\237"
+	.ascii	"c\030\006\260\033G\023T\333#\357U(\301\331]\006~\213\273\260"
+	.ascii	"\340\353>\255Z\255p9\246\202\n\302s\373\241\242T[\245\005\036"
+	.ascii	"75\304\2464\273w\037{\330va\016\230T*\210\214\230\023\265\030"
+	.ascii	"\276\001\315\321\006)r\026P\365#|2\250\276\330\b\031\275\004"
+	.ascii	"\256f\206\352\215Q\032\025\205g\303\026u\370\032\365\267\337"
+	.ascii	"y\316\202\305\327\331\345\022\217s\t2\026LU\262\025\326\003Y"
+	.ascii	"K\313\365\222\261\"\244\264^\002b\255\027\225\364\212$\245\365"
+	.ascii	"J\3110\250\264V.\244ZZ*\226\324\n\026K\221\200\330\365b\301R"
+	.ascii	"2\227\013\226\332\355%xRT\017\321o\232\264\2442\266Kz_\370\343"
+	.ascii	"\203\321\232\334\335%\025\210&E\251-aB<\356\244Sia\030\376\300"
+	.ascii	"\030HR\024\336\215\237\003\305(\234\234\200\237$]`S\303(- \220"
+	.ascii	"\002!\301\252\007\374\bl\033v\346\201?\250\330,\361\363\337,"
+	.ascii	"\2004\363\013\211\0267C\002:\234\337u\347\005\326\360k\034\356"
+	.ascii	"[\203\r\302\262\241\277\236\307\305N\326'k\327\b.L\352P\031a"
+	.ascii	"\361)\302\267\241=\367\373\260)6vC\204\003\307\275\306\001\035"
+	.ascii	"\026\nM\001\316\321h\234kC\366\345\216qa1\252\016\n\005"
+	.text
+	.section	.gnu.lto_applyAbsoluteControl.179.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\321\016\345J"
+	.ascii	"\352\177\b\034>@\346Q\007C\276\220@\314\376\374\235\311\315."
+	.ascii	"|5\213\204\326\266\226{\236\326\220P\265\035S7r\376\271\3443"
+	.ascii	"\301/\332\3756\337\230\233\2112Y\007#\021\202h\320C-\255\304"
+	.ascii	"\312\275\223L)\270\001\201\001\262\001x\317\347\223{\221\\)\275"
+	.ascii	"\177\3329^\374\216{\036w8\356v\356Vw<w:\016\354v=w\243V\312\363"
+	.ascii	">:\234O\007\241B*\363\276o\023ut\023\355\264\343q=M\314S\245"
+	.ascii	"r\307\207q\n\225\003\027i\211\277i\217\343w.\307\347x\235&\322"
+	.ascii	"1\342C\360|\370\233\344\305\200\302\340!Y\364\303\332V\340\036"
+	.ascii	"\0219\270Hev>\330\267\215\273\341qqK\006\341\370\300j\312\275"
+	.ascii	"m\304\351s\021\334\002o;F\320\333'v7\333f\307\032)\213\272=!"
+	.ascii	"^\215\317\271N\327w\307\246\2679'E\316\373\312q\265\227\\\020"
+	.ascii	"\313\371\310\363\307 \350m;\356v8G\343z\034\220\026\276o\025"
+	.ascii	">r\336\267\311\325\007\202\336b\271T\366\226u\250\354m\273\335"
+	.ascii	"\211\216B\336\263\bxD\320\326Dz\337\027\371Y\334\365+\253\252"
+	.ascii	"#\325\224T\024\324\223S\023\223q\251H\034\n\203\300\334\262\217"
+	.ascii	"\335v7.|\252\235\371\325\031\267\362:fpU\325\217\325\267\264"
+	.ascii	"2\230\252\232\347\005Ouq\251.y\\pT\233Cm\321k\303OZ\334\211U"
+	.ascii	"\020(\215\215\225\352\243\0057I\363\250\230\311\227T7z\2404\351"
+	.ascii	"[\232\024\274\304b\345U\243\340\"0\003q\315\207O\352\254aaV\225"
+	.ascii	"$P<\bE\217g\275\245E1\260\211gv\013\220\225CF5'k\245\007\r\267"
+	.ascii	"\036(\315\t\213\365\276/QM\bfY\005R>K\274\216g\005J;\303J\001"
+	.ascii	"\262r\210\250\326\304\317nU'\3351\2521Y\253:!Z\334\215c\250Z"
+	.ascii	"\023c`\206\367"
+	.string	"}\033?\325\222x\003\360n\277vw\233\356\342_\235\177\303cD\316H\032\276\375\374@DN7f\373S\323!\327*\374\317~\267\t\024\330\237\032\036K\310\237u;\"\262-B\317\327\017\251\250@}\337wB!7\264\242\275\315\333f\321\242\305\373\223\211\003r\227m\r\266\375{\035O\2617D\021\364\211\031)\215\242\354O\333\201\273\310\370\375m\256o\317\007\271x\001\003F\366\026\177\201>o9\246\343-V;^\376\247m\355n\254\345\037c\316O\023O\352v@\036\250\255\355m\r\326w\330\237}\227\275\365o\227tmR4\321%\276v\3131\361O\273\375\257\327k\245\376+\335^\347~\"\343.\221q\223\3606\356#D\370\035\357\020\236\307\033\304\007\227s\367\340p\274;\270\2357\007\307\363\336\340t\2745x\234;\006\247s\277\220qS\230\340Vo\tn\365\3762\342\366Z\302\035!\343\206\220q?"
+	.string	"\342v`\304\335`\t72\343\3562\342\346Z\302\315 \343^"
+	.string	"\304\255 \343N\220q#\310\270\017d\334\0062\356\255\214\273@\306\255\225q\023\310\270\2632n\254\214{@\306- \343\016\220q\003\310\270\257\212\270\255\210\270\2532\356c\306M5\304=%\304-\225qGe\334P\031\367S\306\355\224q7e\334L\031\2671\343^\312\270\213B\334D!\356\241\020\2670\343\016f\334\300\214;g\334m\0207\233q?\0207\316\270}E\0026LAt\001\177\2704\022\344\007\353\005|\326\177%\247t\302\017x,\f\035\360\036\207-\272\304D\360\020\001\357\3257\007\300\007xw\372-\261\323\335\322w"
+	.ascii	">\b\025R5j\327\364\323\276\372\243\236\325_}\373\310\271\350"
+	.ascii	"\255\336\321\376\270\340\246\353%\370\276\315\257\306\314 \204"
+	.ascii	"\334/;\262\267Uo\241/\216\352\217`\360Y[\031|\341\327\025\263"
+	.ascii	"\365\347W\227\214[u\317\270g\262\267T\357n\324G\325891\215\322"
+	.ascii	"\230~\332\356M\351\321\3334\376\025\267\221\247\372"
+	.string	"`\370\251\367<O1=\302\006\355o\211\005~9\2247kR\342\007\227\276q\022\027\024\361\022\036\312\310\245\262p\267\233F\003\366\247\324{\237\2253\177\230\177\346\244\370\323\306\303\016\2774I\310\341)xx\n\377\341\337\216%\376\024\017\377\n\227_\035\2370\352\241^\304?\242I\034\372.\352#\260E\213\017\365L{E\364\234~}\307\206\322\240\340O{\350\304\231C\274\2007M\022\265 \376\353\241\335\335O\337\344\247\370O\337\366a\372\246\307v_o|\246wg\244\266z\350;\343;\023\352^5\272\004\376\264\233\317\036'\\\376+K\357U\346\370\200\370\342/\375?r\276=jk\260\275\221;\002!b\004\366\347\210\354m\361\375\215\352G\322\234e\210o\241t\234n \336\365x\211)\324\352t\363(H$\305i},\023_9Wh\370\354\032\264(\207\037~\273\207\026\347\341;\274\360\211k\240l\320\314"
+	.ascii	"_\303w\370\366\331\310\351\306\004>\007)\323\352\3156\337w\251"
+	.ascii	"\265\341\201\357p\324;s|uoL|\r]\243+G\r3\2601$\016\262\2611\262"
+	.ascii	"0+\007\017\2123\312H\314(\013\221\203\030\006F\f\003\343\001"
+	.ascii	"6F#\207\201\341H\216\321\310b7\2223\310\224'd$\313\206J2\245"
+	.ascii	"\322\303\230R\314,i4\303\221$+3\023S!#y\302\f\207\230R\251#\354"
+	.ascii	"I\314\f,\005\231\262\007\215`\216$\0170\266\303\272d$\313\220"
+	.ascii	"f5h$o\314@\342H\202\215!\303\2249\220]\307&+\023S\"\315\310\310"
+	.ascii	"\224H\242\334\322\331\327\215;\021,Q\376,\237\331\354\225\327"
+	.ascii	"\177q\327$P\335\"\274\327\003!Dx\360\020\376h\307\371\306lkk"
+	.ascii	"p\313\203w;ls\272\320\2414%V?\345s\007\357X\330\034\260\221\330"
+	.ascii	"\352\252O\252\032t\341,\356\232\323aA~\203?V\352Bv}\225\035\247"
+	.ascii	"U^S\310\361\247\275\005L\022\307\n\037\025\220\214\341\333%\233"
+	.ascii	"\353\\_\023O\232\342\232\342\256a \204\245X\212\033E\212K\305"
+	.ascii	"\245\362\364c\360\\_\265\006\355\257\013/\370nw\352f\311\376"
+	.ascii	"d\360X\315?\233\022,\361\013>\214\241^\231|uoL\2571C\210HA\005"
+	.ascii	"\337\365\324\310X\237\264\276\304C\033\270\213\254\340}\fv\242"
+	.ascii	"\340=\215z\255F\023<\202O\360\217(\210\037\004\337\"1\004}r\340"
+	.ascii	"\215\204\236~%\336\300\037x\326\316"
+	.string	")5\300\232\241\3761\371\340<\211\"\360[\037\244\203\372i\273\030\343\344$\234\222'm\n\360$\266^\353]\217\304\027\370-\254\244\300\013\243\004^K\215\255\357\b|5J\342\221\264\225\212z\304\363\334\304\364\b\244\247\337\023\200\317z\247o\354t\304\344\323\303h\316)\317\207W\360\f\241Y\231\2325J\370\t\017\315\352\3438\312$\201'\250Q,\350\020S\246fF$HR\220$\215\0011\005\304 ();\017\0210\245T\216\215\214&I\235a\f\243\216A\317v~\344|\003!\007\032\375\250\340*e\3019Af\257\315L\031@\255\247p\274\004\216\374\225 \373H_\277=8\360\264\364\233\301P\373WE\314=\227+\347QK\223\260\250\313\006p2\203L|\216{?$K\237\257\363\306v\022\r^\24116\f\022\016\r\357\321[j2\355#l@\224\330t>\215\033\3379\355\365\247\272\224\352\331JC"
+	.ascii	"\037\255\331\257\016\325\006\352j@\002\261\327@/\273L\360i\030"
+	.ascii	"\304\271\024\030\213\t\2540\321\007Y\332\367\366\340y\f\247\330"
+	.ascii	"\343"
+	.string	"\233\330\270\034$\266\3376\342N\2279G\302I&\036=\334\320^)\247\203\355\353/\366!\2333\370\360/\254\262`\231MQ\217\032{\323\f\213{\312\2306h5N]\346\030\357"
+	.ascii	"\354\207\200{h\023^\204X\323\345\350\b\335\377\223\376\320\r"
+	.ascii	"\253\223\252\275\2570\317h\327\026\335'\017:x-\206nBn\024\334"
+	.ascii	"\207\226f\306`2,^&\313D`'Qh\345Lx\362\031$\247gm\006\277\212"
+	.ascii	"\333\360\314\244v\334\256;<\314a\374\323NO\245\210 \304\260\350"
+	.ascii	"\263\027\342l\301\002\351\007\365\217&\375\006j%\2772ol\344\201"
+	.ascii	" \230\302\210E\252\331\336\215\005\222\004\370\007bA\357\333"
+	.ascii	"\325I\033\310\027\310\340\253\220\345s\"i\023$\231\263\253\222"
+	.ascii	"\206\005\374\035y\345v\333\370\026V\023d1\205\002\331?\336*!"
+	.ascii	"\320\376\013\215\024\037\n<\b\327&C\304\024*5\304\270\210\341"
+	.ascii	"\203\245K7P9\222\344\357x\t\305PnE\266\363\252S\233\375\306\320"
+	.ascii	"t\3416\347\004\342x\361@m\201\371\n\356\374v:\276\260\250\272"
+	.ascii	"\026\0271\260:i\033Lr\311H\303\350\273\255\004\262\032\257\315"
+	.ascii	"w\265y\253\333jx\332\020\304\327e\320\374\021\223\211\210\276"
+	.ascii	"(\240G\025\376a\2324\020\206Z\210D3\325\324V\344\222\316\277"
+	.ascii	"+h\212\353^H\002\353\222\007\244\236P\320\247\372\204\277\315"
+	.ascii	"\007\242&\300\261\247\306\250\336G\332^D\332\005\2513\034\232"
+	.ascii	"n>9\334\347\nN\325H\022\022\035\201m\246hpj"
+	.text
+	.section	.gnu.lto_applyItermRelax.180.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\253\t\2552"
+	.ascii	"\nW4\023D`^R\007sn{\322\260\t\323p\310\307\307\0030\2146\212"
+	.ascii	"(\336\302\305\372\b\030\357\262\243Y%:L\307\250\213}}xE\215Y"
+	.ascii	"e<\305\016F\035\363\314\262\206z\260P\235\253\352\214\265\266"
+	.ascii	"\311\226;\245\224\002&\001\001\001&\001(\326\324K\013\244\241"
+	.ascii	"\253|v\031\301\005\017\303c\351,\310\326\302pMto\232\227\270"
+	.ascii	"{\335\250\330\201\333\332C\365\212\227\360\272\233495y\024\270"
+	.ascii	"\233\227\031\274\251\265-\2673\367\224\246\202\3546\030\354\273"
+	.ascii	"w\b4\356^%\025\023X\33325Qm\233\366Pm\313H\346;Ha\367k\201\\"
+	.ascii	"\032\031Y\356\356\275\305/\322\310VJB:2\"\026\r\205DCB\301  "
+	.ascii	"\340\317\267\366T\233\276#\271{\021|\313\262\257V\212\322Il\215"
+	.ascii	"\304\006\305\217\230\264\021\223%NT\322EJ\222\370\220\r\211\013"
+	.ascii	"\233\210\206R\003y\302\354\3519\346\221\224H\266d\331kL#.\324"
+	.ascii	"C\314\234\035L\r\004I\211h\036\264\306t:\020\2205\346\017\007"
+	.ascii	"v\322G\377|\370|\360\360u\215\331\303{\251\322\034\363,\215\222"
+	.ascii	"\341j\307u\323\034\223\315\246\006\320\322\340\b\226\205\245"
+	.ascii	"D7D\352\244i\224\033\"u\202e\312T\t-\r\016`\231\230\377\0343"
+	.ascii	"J\312t\357mh\373X\031\230{/\302\275\227}Yf\326\f\240\231\233"
+	.ascii	"\216\231\223\314k\203`\377\303&Z\2311\"\357\367g&a\345\275lz"
+	.ascii	"\246\260\377bn4\\Kr\226\314\034\241\317\\=0r\357eP\246\315`q"
+	.ascii	"'i\313'\214\336K\243\332\326\277\227:\232\314\004\206\256I\270"
+	.ascii	"\031Nm\333\037\343\210\036\260"
+	.string	"8_z$=\312\354\366\345\337d\356\217F\243Q\3764\346\366\322]\354+\335\005ZK\367\200v\353\216\262\316P-\246\371\251\3014;5\\sS\267u/5\227n\001?\347#\237\263\321\352L\264\316E>\347\341\352,\264\316D>\347\241\325Y\250\347\034\264\316A\326\031\310:\003\255\363\257\347\354\263\316\253u\356Yg\265\347l\255sj\235_uv\353\334\t\332i\206\314\206Y\003\341s/Y\264\317mc\3050i1\335`\272\341\372\231\303p\313\211a\350PR\310\235\"\253#\207\327\267\343\230\201m\273\337\032\312@8\257\364ri599j]`\274\372\232\321\311s\357\225j\313\001o\353\306\024y\316\34157\254\274\021\002~\221\234^\326A\375\357\201\237\276\375\376\3274\262e\f\201\233\222,\301*\325\367\335\366\234s\007\204\357\033\355H\224\255m\310\341q\006I\365\321\007]\201\332=\3510\233\032A\264"
+	.ascii	"}\223}\225j\367I\365\203e\225\266\337T\037\375\330\\\333\267"
+	.ascii	"I\250\335\023\370M\356\346\270\272\035T~\237\266>\320\334s\315"
+	.ascii	"\372Io\306\254\003\262&K|?\2276\223\007\r\272\265\367\235\367"
+	.ascii	"L\243\364<\344Z\357S2c\235\347\307\023\034\275oF}\307\265\337"
+	.ascii	"\341\370\343\306\216n\r\364\351\351\241\236*\213\330\036\365"
+	.ascii	"\031\332\376\364Kj\304\324\240\r\006N\023!\3672\204ht\217\362"
+	.ascii	"\336\344\223\323\253\337r\355s6\203@\305\326\300<\312\335\326"
+	.ascii	"\243J\r5\375:g\2722v\374X\357;\3179J\317\353\035adj\3517\033"
+	.ascii	"\206\272\364\177\005J\367T\243\364\274\376\256R\355\227x\322"
+	.ascii	"Q"
+	.string	"z\036s\257i6U\334I8\204\b\357\245\b\265\255}\005G\370\340\235\245\357\364\376&v\327\364\377\351\367\336\304\324\002%Hx\326\226\206\254-\013\\@\254\024\306,\255#\007\023\306\255_\327\n\243\326V\027\326\007\023F\016]+\260\216G\026W\302\243\326\361X!\210\325e\345A\353\370\342\304\252\342\210\325e\264\\F\027V)_\0350a\334*v\2418aL\221U\\a\264RQ\274:r\025\017 \261\326\026\326\261\330\245\245u,\002\335n\247\367\323|\3163m\222\017\226*=y\361\007\274\200/\360K\317\214\224\202\244\342\275d\0369\234S\356\331\177\371\275\367+\311\310e8\215\031\336LF%\276Q\021\261\350\223\220\354\216\206T\016\346I\341\017\211\204\317\244\374/.A\250'\372$2Fx\035\374\236\331\030<\304\241g\346\251\376\203\254\322X\344p\367i?\022(T\250\260\254\023\372\241G\362#\343O"
+	.ascii	"wz\346\013\031\324^\n\275\352D\210\362\277\232\311iw\246(\252"
+	.ascii	"\253\324\3407\234\273\r\301\3573\347\033\333\331\226\241M\216"
+	.ascii	"\211\363\234#\374\246\231s\013\224;\bK+u\210\202\322\267e\035"
+	.ascii	"\222;=\3203w\370\340\275\f*\360M\017\364\3027F\342\210\251\201"
+	.ascii	"-\315\210\342\r\265i_\200\307\250\2014\345\bc\250DDd\024$I\322"
+	.ascii	"\030\260\002\221)\242\316\001\0208\210\246&I\322\001\357@p\200"
+	.ascii	"\024Ee\325\331\026&n\353\035\223\355hh\214\230\355$\247\210\355"
+	.ascii	"\rF\276\032`$0\362\216\037\031\370\300\340\247~\356?\026\034"
+	.ascii	"\331\212F\203\272\034@\341\240\275\354\240R\316T\220\002\205"
+	.ascii	"\232\t\363\004\302\312\036/H\346\030Dn\275\317&\344\370\rIB\314"
+	.ascii	";<\343?\364\311\360\nb|f\230z\0132\367\006\334G\252l\225\313"
+	.ascii	"h\030\332\366\265\347D\033x\345e\020\263\027\332I\341\227\333"
+	.ascii	"e\347\262\365U\035\362<\206\305#\261\223\214\260\243\205\207"
+	.ascii	",\006\320\226\310'l\253TY&#\276\215\316\376\353\b\002\365\352"
+	.ascii	"\005d\013\303E\001cq\325\"\271\314I;l\353\256\270\332V\261\212"
+	.ascii	"\251\033\006\203F\"\231\211\037\226\220\271\342\265\210\003\234"
+	.ascii	"3\203\361$\031\245\351\206)\247\353\177\233O3\366UO\311\367\312"
+	.ascii	"9\316\236\007X\336F\t\244\3258\033\332\220\363{n\253\247s\337"
+	.ascii	"\316\232F\342\236\372\001\020\216\017\241%\305\215\275,\302="
+	.ascii	"\247\346\305\213\245\343\004w\177\247\004\213K\234\344\303\341"
+	.ascii	"\362b\324\"\271\341(\200\377\206\257\253H/\272\025\373\376\255"
+	.ascii	"h\344\326\220`\253\205\327\222\264\025\346\303\231\272\356-\002"
+	.ascii	"}&\323\224\360cj\241[\313r-\376r\205j1\267?\032\022\253[\023"
+	.ascii	"n\307p\212\347\215A\374Z\355\307\325\377"
+	.text
+	.section	.gnu.lto_pidController.181.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`a9\005\370"
+	.ascii	"\252\206\035VJ\020\020\346\355\214\001\325\221\330\177q\353\016"
+	.ascii	"u\020N\337\031\372\031\316\213\tLU\215l^\377R\201\340\022*\312"
+	.ascii	"Le\267\3259\216\037\202\237\353\025\230\360\333\005?\273\310"
+	.ascii	"\315.\265P\307MG}\3001\007\331\216t\226\367\367\226)\245\024"
+	.ascii	"9\005\357\004o\005l#\311\271F\222s\001\357L@\353L\243u\236\321"
+	.ascii	":\313h\235\231Z\347\030\2553\214\326\371E\353\354\002\311\271"
+	.ascii	"\005\2223\013\"\347\001Z\347\025\255\263\212\3269\005\2223\n"
+	.ascii	"\"\347\023\255\263\211\326\271\304\2213\211\326y\204\221\263"
+	.ascii	"\210\326y\251uVj\235C\264\316 Z\347\017\255s\322;#\265\316G\255"
+	.ascii	"\263\207\326\331\250u\356P\344\\T\344LT\344\314\241u\336\340"
+	.ascii	"\301Y\203\221s\206\326\031C\007\347\241\326\271m\235\205\336"
+	.ascii	"\331X\344\034\324:\027\211\234\235\310\271\375\214\211\317[\235"
+	.ascii	"2ua\336\317\315ur\r\344\362\021\351\324zOw\236\366'\355J\332"
+	.ascii	"\233\355L\332\233\264o\265/\273\257\335\201\272\253\335}\272"
+	.ascii	"\353\232\203\267]\367]\367\264;\257{\257{Nw\235\356\276n\277"
+	.ascii	"n\272\356\267\273L7\232n5\335kz\203k\360\f\216\301M0\267C\341"
+	.ascii	"j\341\254nm\206\276\304\265\\\005w\342\\<\264\225\367UM\364\356"
+	.ascii	"0\331\303k\362\233\007\270\366\032]\211 \265\315\360\315h\345"
+	.ascii	"\314'\307b$h|\276\270\256{\345K~\333\246x\204j\306\247Cv\227"
+	.ascii	"\207\256\374b\221\261\201\205G=\263\006\342\267\217\312\327f"
+	.ascii	"x\345\017\017U\243\246`kS\214~x\250\217\006\250\034\24171\022"
+	.ascii	"\366\036n><4\250\024\322\177\334z\204\236zW\270\3634\234\031"
+	.ascii	"\233\326\375\370-r\275\316\0251^0\204p\017\362\220\220\026\214"
+	.ascii	":k\303\376\370\332\f\017\215x\202\330\354\2645]\0032\017\261"
+	.ascii	"\t\375\307BV\207c_m\256\353\276\341\206\323qZN\343\265^\3635"
+	.ascii	"\235~\241\3554\225\207\374\244\204\256\273u\247\317\316JH\247"
+	.ascii	"\216\335a\2349wJ\324\354-Ys\335\2550y_kcS~Y\027M\257\335\265"
+	.ascii	"\255A\357\356\006\273\214M\264\213\232\323\302tL"
+	.string	"_\031\233X\307\257\363\005\232\2469\301\350\206u\321\270,4\f_\333\027\023\230\207z\216\233\r\017\275\\\247\304\320\256\t\241\353\272E\214Ml\033\256\323t\\\313\361\320\232\251v\231.\222@uzNj\212\264\373\304\355%bu{\204\256\353\346\201\261\317(\033\315\021\022WnnU\261\357\013\325\215\200\017\003\215\032\312.\223\204D\225\233\353\244\b\005\303\327f\350\272n.\232\310=\214\356\326.(\233\f\n,\344\272O+\rc\023I\260\355\314\335\326b\224-E6\221\353\212\305a\343\272n0x\205\261\211\354\326\036\212M4v\207b\023Y\311,\330ncnR\035\230,8C\327u\231^\313\035\303\341o\326\255\031\003\253l\226\303w\034\207\247l\307p\270\216\337\260\033\246\3436\314\206_\236c9^\303q\254\206\3230\032>\303f\030\216\313\360\033\223a\027\330\215\307\016\035\b\034`@\016\0347l\324(\200"
+	.ascii	"\0323d0\305\200\361\302E\013\026\003\254P\221\002\305\t\023%"
+	.ascii	"H"
+	.string	"\214\020\261\244\024\002\304\207$\244#\017F\035\212\2108l\320\220\001\303P+d\f*\022\331w%wP\017\023j|\336\374\324pU5\313\221\361\305\371\316\210N\234h\363\024\n\2300\316v,\0075V\306\2303\034:ai\315uh\315o\316X\017\200h\316n\350\314\232\333\224\2219\263y\307\346\224\236\313\257\243\347\022\314Y\316\271\232\255\362\\\216Q\2558\257\211\033kVS\2459\215W3\032\245\347\322\353\350\271t:\237aq\270TA\245\347r\n\033t]\341\211\023g3L\232\341\312\260-\230\034=\227*8\27759z.\265\234\311\030=\303\2324\273\240\364\\6\255\315Jy.\2278\273\261]\3170%\315\343\317\325w\374i\035\207VG\300\032\310\017\340\020\246\244\r\360\253?l[\200<G\265q\260)\242\177\3404\235\255*\013\302\fVY[\r\375\206\322sIe\320m\324\020\354\002\002\251x\234"
+	.ascii	"\032wz\006 \365\317eP\233i\257c\350\3559\214\275<\177\201\327"
+	.ascii	".\246x\336\202\005\201\307\246\360#\307YP\357|\2008t\266\356"
+	.ascii	"|\305\333*\330\026s\254\007<\257\247@\261\346\204\\\233\220S"
+	.ascii	"\343%\342\3228\t4=\002\315\030\027\261\304\266 l\323\307\203"
+	.ascii	"\223\264f\263m\211q%:[\322\020a\032\204\264?\260\003@\355\300"
+	.ascii	"4\235-0,\222\23413\315\266\025\365$v\306{\305\332t\266\276\260"
+	.ascii	"\032\326\366\226Mms$\265/E\017euf\375\334\n\363Gi\355\301\b\255"
+	.ascii	";\260 \276\360\272\232\316\326\031\233bN\030\236f\3332\363\""
+	.ascii	"4>eN\224\306\222\240\2229\207\240\036n\232\265k\313:\323\365"
+	.ascii	"\fK\353\r`\255\201%1\345\313j:[`\354\b1\260\352\227g`9Xae\260"
+	.ascii	"\241\342\030\262<\251\322Cl\232\b\375B\330V}>\251\322mP\217\347"
+	.ascii	"\023g\013\265\325\2246\262m9\275<\210\316\2263\313\213\314\022"
+	.ascii	"l[^N,\361|2\245\331\253!.,\177\r\\K\226\204\353\272-\327\256"
+	.ascii	"\305\205\345\036\324\303u]\366&\327\223\346\020\2329\b\211\271"
+	.ascii	"\3150\317@\022z p\017\317>'\031\350{\316\227\034\314\223\334"
+	.ascii	"\343\335\344\300b\023\033\316'\013\223~\274\233GO\"\353\253\270"
+	.ascii	"\375\332\303w\227Ya\324\351D\311\340\026\020\017u\232\r\032\032"
+	.ascii	"Z\371\225\337D\241[\363\241\271\256\330`\357z\205w\335n\255\363"
+	.ascii	"\345\302a\022\330\023\255\364\374\336\376\340t\253\255\361U\271"
+	.ascii	"\325u]+$9\354d,\350B\320\351M;\3668,ht\335\252\376\352.r\305"
+	.ascii	"\265\213\263\346^qYx\035\367\227q\314\335r\335\\\026Ml;L\324"
+	.ascii	"T\331T\t\257\374\360\350\241\354F.\326M\304\304\200e\275\035"
+	.ascii	"<\354\231%\352\360\016u(\265\211[f/,\375\324\350\201~\357q\303"
+	.ascii	"\357\021\225\016\311W]\264\212\007\243\367)\357b\337\314\265"
+	.ascii	"\025i\315/#\243\367\260o\346\327\022G\233B:\035\274\352sp\361"
+	.ascii	"\271\276\351]\371\037\346s]\267\210\372F?\302\033\236W}S\277"
+	.ascii	"\030\366\347\207i\350S\276\303{\325\273\034s\255\367\274sU\237"
+	.ascii	"\362\315\247\331-U|\b\277\304\320\265\233\353\272D\017\345\367"
+	.ascii	"\204\321K\271y\034\277FO\343j\216$\001%\255Ik\261\211FO\304l"
+	.ascii	"\257J\327\341\255M==\274\301\252\224K\357f\207ojw\226\246\037"
+	.ascii	"\276*\341\325W\361\273\256[\305a\315N-\353\325\320\235\244\b"
+	.ascii	"\304\356,\353\315\340a\335_\257\305\033\212\036\356\345\232z"
+	.ascii	"\212\376\357\322\362\370v\240\031\023\250\341\241L\364\034~\004"
+	.ascii	"\027\234\214\022\353\250\314\312*6\221\350\225\376\234\007h)"
+	.ascii	"U\360nrx\021\315B6UB\034\316\254\344RB\361n\222\245\205\341["
+	.ascii	"~U\206\207\362\020\340\220?\377\001[\027\335V^\013F\332_\257"
+	.ascii	"\327;\f/\372\371Hp_\3740\2776|\247\341\027i\354\003\233zj8\206"
+	.ascii	"\327\360\234\3417\274\362J\333\006]f,\214r\205\236\243F\035\214"
+	.ascii	"\322\213\212\322\212\225b\0235|\022\\S\212U\027\367\242\004S"
+	.ascii	"bQ\206\205\025\233\230\341]\254\361r\302\360\366\207\236Y\251"
+	.ascii	"EI\346\335\304\360$\260\276\212\331\267x0\202\332dS\232\361\300"
+	.ascii	"\261\346,(\321\324\224,\260"
+	.ascii	"Pl\342\320wS\212\225_\221e<\215\337\021T\327uq0+\2678\332\221"
+	.ascii	"\226\033s]\327\206\231\237)\271p\2375\221\225^\224\321h\261\211"
+	.ascii	"\3557\233f\017\315\316T\351\254\374\372~\275^\353\f=\224[\256"
+	.ascii	";\212\232<)\313]\244\310\254\321\273H\261\355\274\026s\217y-"
+	.ascii	"H\314\312T[2\017\355\2562k\265\312\001\327+ \241\207\032;I\321"
+	.ascii	"\370\177\370\006\210\305\237I\232\224a\302|\303\2219\322\365"
+	.ascii	"z\030\344v\230\256\327@E+\035\364Ro\177`A\337R\312\254\321\275"
+	.ascii	"\353\265J|(\243Pd\247\342UPpR\212Q\212)61\205\262\353\027>#\256"
+	.ascii	"\327C\326\313>C\226\346q\275\002zg\367\t+\273\2607\300+\377\303"
+	.ascii	"\337e\337c\276\345\232\310\232\365f\351W\346\340\366\212\242"
+	.ascii	"\277\227={\226s\351Q\\\212r\f\367\031'\340\303\273\351\243\330"
+	.ascii	"D\377\fd\340\030~\211qZ\371\225\331m\351\017\275^\257}\370\305"
+	.ascii	"\230\313\310\220\234}\254\310\331\265d\351<\315\016"
+	.string	"\025\013\363\247\177M\3612:\273\323\2254{\2277\233\035\2123iv.o\322\354[\276\325\354\336\314\302\362+\267\352=\315^\345\313fw\017\373\332\334\326\266k\356?\206]m\356\302=\204\202\335\247\271\357P[Ms\333\351\353\274\346\236\303\327s\232;\257\35347^\3675\367\264\245\335\r\247M\223\351n2\275\246\271\307H\215\316M6\246%\013\324\2374\267X\007j\356\260\256k\356g\33757\226\2366\367\225\246kn\260.\323\334_\3756\267\225w\356*T\246x9W\220\262\344\334Q\272\240<\341\332r\322D\005&ZI\316\335l\235{\211\222,&V\353\334W\255s/\221\234\333\212\310\271\253Z\347v\221\234\225D\316\311\326\031\211\344\234\002\2213\n\255\363\t\255s\222\326\031I\353|\244u6\322:\027i\235\251Z\347)%g)%g\023\220\234\211\0209G)9\017Qr\026\242\344\f\025\302\271"
+	.string	"J\316\004h\235\237Z\347\022\336\231\204\020\316A@8\037\223\234\201\264\316N\255\363\b\255sS\353<\200\326Y\204\326Y"
+	.string	"H\316\001 r\016\241u\006\241u\376\240u\366"
+	.string	"\311\271\003$g"
+	.ascii	"$9sP\344\274A\353\254\001\222s\006I\316\030\264\316\027\0309"
+	.ascii	"[@\344\\A\353LA\353<A\353,A\353\034A\353\fA\353\374@\353\354"
+	.ascii	"@\353\334@\353\374\243uf\240u"
+	.string	"^\240u\366\321:+\200\344\234\300\007\347\036\2553\217\326yG\353\254\243uF\240u>\240u6\240u\316\321:\343h\235o yM\222^B\370\276\376I\255\264\374\007\017\302+\0252\331\226\177\336\203\377\340?\3641\331\226\036|\343\241Y\337\374\314\024\323\336\334\360x(\373\330w\360-\370\246\027D\005\300w\360#\352\230l\313\007\300\036V\213\003\326\013\231\301+_b\244c\237T\230u\270\3017\231w-\357\314f\271\364\345\231\332\231Y[\262\301#A\343\023u\356`\263DhC\033\254V\301\220\227\225E\307CY\203\277\340\233\355m/\203\327\340\211V\f>\203B\026+\t\305\340w\220IC\374\005?\004\315\363\3034\f\361\216\305.\223omGe\255\220~,xwYW\tVU\206Y\360~\325D0h\202Q\347\0070M\344\020\360R\254\340\275\f\t\350\255I/\025|K\321\002\2534\370X\361:"
+	.string	"\317\013J\030\003n\274\237\270\250\036\216>\374\326\362Z)\254\004\007\331\034m\375>|\035\205L>\024\374\004\337\326\207\001W\245\340\377\314\237\023i\235\340\335\355\b\304\\\271\372\252\346<\253\02278$\370\021\322B\344\225\347$\370\2666\021\017\315N\325y\343\241\177\376\311\b\252U\275\036~uP\363$\343lP\t\377\374\007h{U\351\034\301\300\236\202\226\027uZ}\004\337\206\377u\314\257e\004_\204\373;\017\270\204\340\213_hxU\272\007\236\352\307>\360\035\007\rN\224\316\306C\353\360\273D'9=\232\303\376A\253\373b\330V\276\214\005\252\341"
+	.ascii	"\326\357\361\273\244\227\327\205\357\343\035\370\020}r\3160\331"
+	.ascii	"\032\370\037\337\205S~\263x\256\201o8\177N\006~\201\377\361A"
+	.ascii	"nF\006\276\347\376\350\254\342\330\221\260\300\367\237&\352\241"
+	.ascii	"\275U:+:g\354\232\024\360P\036\241\005&H\243\005\037\205\026"
+	.ascii	"X\332\214&\374\306\362Z>^\352m\311\277\341\027\005\325M2n\211"
+	.ascii	"J\347\343\373\t\332\232\250\364\004o,*$\235\354\371\356\342\344"
+	.ascii	"\013\361\362+bl\256\250/\316\231\246\036\002\024\020\374/\\\023"
+	.ascii	"w\204+iU\340\213kg\327\250W\205\335\211\243a\304{|\002\337`Q"
+	.ascii	"\222+\020>\t\346\327'\360EX\257]\326!\037\342u\215\231\341U\354"
+	.ascii	"a"
+	.string	"\346\317$\275\250$\223=X0g\201\252\316\246\f\030/n\310\211\221\205\307\273\340\266\343u<\217,\277\203)\306\213\261\373A\337`\264\270r\026\3746\273\230\353Z\235\030\242\322\307\005\364\265t|\364\277\034\001KZu|\bg|\252t\bt\341w\211Krz\324BS\317\347x\004\376\003\231kK\003\376\200_\312\273\363\r}\003\214/\036\3122\\\335\026..^\314\207^\223\025\316)k\221\3433\364y\333[\343wI-9=J\313\361Tg\203U)\216\277\361}\347_\356\f\307\0139m\374\215O\352c\022\326x\033\337X\276\254\306\267\237&\322\235\rF\257\270n\026\213\207r'\241\305\002\336\237a\257%\t-\300\005\235\035\302/1\322\253\001\036\312 tQ!$te\n\245\354M\001\343=\313k\021\360Ro\200P\316\234$K\232y7\t\370\316\263%\352Y\356^\214_\244\260\344\324\350\331\324\246"
+	.string	"\272\346\332\324\263\342\241O\343\205\236\235\311g\351\327\266~\031\263\252@\321}\277!n\205\271\022\335'\264v\207&\3535q\345\265\360\264;\245\360\001\272\251\243\227\3673\236\306\177\036\363K\3063\375\214\275\226\361<\310\234W>\3063}3\331\226`h1\036\201?\347\213\207\361mE\355\305\0339\363\253:S<\324\305\253\370\267\363\226\327\342]\374\207B\026\337\342A\3101\365\f\360,Xx*\003|\353\221I]<\261\322D\361\320\025\257\202\337\371^\374n\3419\357&\317\025\233\270\342S\3749\245\360;\"Jr\252\324\245\342S8\353\253JOt\327\245i\222\306\304\213q\2127\361\375|\333C\361)\236X\307$<\361(\276\271\374\223\244\027\243\353^\331\340\347J\201.\031=C\026\233x\342o\374IK\274\t\3030\357\204_\025M\222\323\021*\224\370v\236\355U\245N6\205+,\221A\221D\203=\211\337"
+	.ascii	"\215\033\314:\264\022\363M~_\214\375\222d\\\212\261W\322\367"
+	.ascii	";\316\364\242R\022#\236\311\357\222\343=Vrz\364WK\337\177o\225"
+	.ascii	"|3\272\256U7\371\335\257J\216q!\371\366&\342G\034*\301\340\224"
+	.ascii	"a\">y\206\027e\206#\006\246kD\337\230\267\277\2453\036\210_$"
+	.ascii	"@\311\251\321\037\276W\372\245/\3461\331\226i\334\220_&\252\237"
+	.ascii	"d\334\013j\241\367I\312\275\3116m\212MT\372\226\236\331E\245"
+	.ascii	" \346|P_\032?\314\265e\210o\276\367\020\337_\316\344\242\034"
+	.ascii	"\370_S\377\232\217\347\214=\375\316\253K\332-I\311\322\346z}"
+	.ascii	"\025\357\365\216\2632\325\344\235\023\362[c09\215\021\350\202"
+	.ascii	"\311\274\275\344\2349y\377\301Y\231\250\264\247\017\342\033\357"
+	.ascii	"\333\n\342"
+	.string	"\273\315\354\032u\336\3417\006\340\021\025\177\323\377\300\354p\211\210\017\024x\322\263\373\331\351K\372y7?<\tfR\240\250s\016\017\363l\351\241H\357\243N\362O\031\006\351G\220\265`! \253\322C\331\247Ofo\314\033\340\033w\242d\260K\210\243o\277f\341\232\001\\B\214\243\220'\252\017\\B\214\251\022\250\232\2040\r\211\022\"$\312\t\304\217\037\034~\3748NA\025\261\340h\004\n*\312\207\007\252\251\"R%hp\234jR@\303\217\037NOPNI|`\370\361\003\252\211*J\003\250\247&\252\241\037\026H \025E\325d\344\bu\3540\202\b\376c\b\bQ*\212\312\251\351G\222&\247#\220\241$TONQPG\0166XPd<\n=0U$\352\311\310Q\212H\006\251())\006\2364\f\211z\242r:JIE\371\230*z\212\300\233\250\240\216\013P\ry\212\"Bu\314"
+	.string	"\310\023\021\016C\236\232\032"
+	.ascii	"\"\325tD**\b\220\3431\310\006\252\343T\220 \025\034\241\216B"
+	.ascii	"SOH\232\330\243\221'*\247\004\246\0368\026q\232:b0E\204\004\242"
+	.ascii	"#\220\250\t\240\216F\216PBB\244\216T\013\034\251\2320\210\222"
+	.ascii	"JBB\206\243\220&\251\037N\030\0349\016i\24768\ny\322\200j\310"
+	.ascii	"QJ\252\210S\206#\324S\220()\013\200<\021i\331)\006\220'\"LT%"
+	.ascii	"\220\360\004\025\204i\310S\223\020&'\251)\246\030I\034E\344("
+	.ascii	"\305D\025\025%\3054\344f\325\355\276\030\013\215q\303g\365K>"
+	.ascii	"\202\246?x(g(\353\240\333<\261\f\004\027\335b.}\003t\017\036"
+	.ascii	"\312b\337m\036\004\234\365\f\363ky\005,9=\"~u\251\r\206!R\231"
+	.ascii	"\342\225T\0234$J\211\322%\370\005\213\310\265\345\304\360\216"
+	.ascii	"\310D\253y\202Z\340\2273\304,~\227\272\020\231\311\351\021\021"
+	.ascii	"\313\2414\373G\r\217\341w\300 \274XW\371\021\220T\222fU\236I"
+	.ascii	"\\\225\320\005\300\006\376\365\017\270\301E7\030\230\307E\031"
+	.ascii	"\254\332S\307Y\0164(~\003f\320T\336\311^\353\353\333M\023\333"
+	.ascii	"\314\364\226~f\276\226{\356\223\007!\0312+D\227_\244krjtX\001"
+	.ascii	"\\ \273&o\360P\262\342U\003\f\334\331\302^\232\254\367\002\367"
+	.ascii	"\372&{-\246\322\200xd\337T\276\b+\220\035\223\315`\312\273\323"
+	.ascii	"\353{\n\0276\320\034\022\314\353\217\363\033\217\037\fVx\367"
+	.ascii	"z\017d\022J\371^\2015T\2161\262~\220o\220`\fHy!\251\025\037\266"
+	.ascii	"\220\001,\3100dX\024\347\005\017e\272C-]\317\352\341\027)Orj"
+	.ascii	"D\370yM=P\272\353K\220\337~!09\355<<P\276_\340\352'\037de~\261"
+	.ascii	"\200\374\366\373\227\234\366\032*\327\367K&\265r\362[O\274c\355"
+	.ascii	"\360\273\243/9\275\361\202\023\226\016\2770\346$\247*\370\232"
+	.ascii	"|\013j{Q\251\226\005\017U\341\365\370E\301\346\261x\336\365*"
+	.ascii	"<\233\307\\\223\303/\212\273\344T)\016\223\357-58U)\321\026%"
+	.ascii	"d\025H\207\300\274\375\365RQ\372\006\031\bE\346\321\372^C\346"
+	.ascii	"\034Z#'\017\005\033\272\371\375|\323;#C\2325\337\203V\341V\225"
+	.ascii	"\320\241x\327{"
+	.string	"\036W/\371\017[\255\344A\300\t\0162\277\226Y\337W\357P\230\337Y\037\004\307Dc\331`}\233!\223Z\21593\222\005\344\226\253g\333\204\251[cg\313\225?\313w\256\266\372^Zqa\327t\325w[\332`U\352\376\t\357[\312o\367\223\222\257\364\302\252I~\361M\332`T\212|\252w'\357y)<\362\203\nQ\370\024\242,\032\024\276\330B\232`\325L\030\252?\341G\200\013\334c\256%\3712D\270\246\036$_\344\223|R \363\353\310\033y$d\304\034\371~\341\257\310S\275\021\2671<W\344\203\f\323\374\252N\252\227\"]\230z\252g\003\231\206R?e\302\017y\251o\246\034\"o\302w\324\023a\333\224c\336|D}\373!s\266\351\345\022*t\206\200c\334\\f\036\327+\241\220\037\362\r\365\004x!\005x\250\377P\307$\354\302F\221{^\330/H\2703\3104i\212M\f*"
+	.string	"\335\323\023\200Y\026\330\026\3705\262\261[\220qr\310\367m\342\323;W\023\345\244\365U\351\220\274\270\320\231\240OXG\365\326\336H\220\306\242\261g\236\246\347\214 \254\214_\021T\226,9E\242\216m\245\331E\235f\260\274] x(\347(k\240\303\376(\256n\316\001o~\217\215\265a\263@\223S%V\354IZ]\365\001)\036\342K\250C\332y7\275\311ba\257$\343\032\216\005+\341\217\376\204\314\302\250\016\220\3609\236\205[\336"
+	.string	"\241\270O\233\0319E\346y7Ix\366\016\214\035\237R\226\2548\r<\224E\304\271I[\300\261\336C\\\2339\005\374\352E\304\265\021L\300\263\276\303\254\n\315~\004\211\301VA\3565\034\225\235\302RA\316\251\203\354\353+\036?\310\177\220\313:d\342\375\374C\336)v\363\370\305h\006.q\2720\360\320\005\036\3122\032\031X\004\362m\347\355\217\215\302JA\006\"\007\221y\220y\212M\004\362\355L\233\213:\257\276\237\357X\277\001\372g\307\374j\273\312\362A\307\307O\315M\264P\001\247\037\341=\353?\220\205\342\364\375\3769\r\177"
+	.string	"?\202\bXT?\t<T(\320\024P\326\313\303\255\214\201\246i\262^\003\236\257\305\307K\013\032\256\232\336\257\336\363\006\360!\276\351\223\006 "
+	.string	"(\325\217\311\266\354\361\320\266\263\305\313\215\025\341\335\352\337\312d\023\300\203\360\"\004\340\005\360\"\362\230\204!|"
+	.string	""
+	.string	"\261\001\204\304\250\003\022D\351\\*\250Q\350\024\215\210H\232$\303\030\323\024@\200XP8\235\353\222^\017\023\300U\212\362\360<\214+\345Fh\232\244\003\034\305\303\362Y\371\025V2\301\001h\375\236\346\ns\366\363\257\371\313Y\210\302\250<Q\215\266\356\2454J\236\375\025\204\"\212n\235\210\333Kbc\003\306lR\005Nw\256\243q\035s"
+	.string	"\374\350\216o9\272\202P\005V\276-\277\203M]\021>\271w\"\372\013\254+l\317\310\006>\350D[\207\022\272CNp\336\205\001\001\321g\"B\f\b^\r\323\033\022\365T\323\322}M\331\317>.\213N\037\tH\311\276''\003\255\357a\206^\347\031\020\233\3236\362Y\006\325\374+\201\342g\370\204\225y\246J\ry\211\331\321\351\266\353\t\203\250\033\325\222\260\177\t\003Wt&\327\255\306\004\250]\267A\327x\344\243\305P\255r\332\245\211\244\007s\2273\355\3737\234\226P\030\252\212\022S\322\300\202\324\247\237\304v;B\337\372E4e\203\377\226\001\356 \364\367\325*\347\244(\243<\352\006\323L\3354\301\261N\244\322T\241d\t\355\013\216\352\023\007\211A\342\\\035\272.\225\376\343i\324\332\315"
+	.ascii	"\210\227\273\214\034\016N\031+-\351\031z\016\314\213f4e\354\345"
+	.ascii	"\246R\323\307\027\350kwn\367#>\n*\252J\036\315;\325\235\374\322"
+	.ascii	"\347\223\253\273\335X\226\372\332T\206\234\3148\375W\272\250"
+	.ascii	"g\205\025\310(\222\373\035\243)&\377\330KF\373@\246\226\317\254"
+	.ascii	"\313\373\275\250\231\302\332B\200\326\211\202F\tx\205\220H,k"
+	.ascii	"\242\226d\031\226\0176\to\324\317Q\237\356\\\324w\263\265\221"
+	.ascii	"\366\316&\002\334\035D\246\003\205\256\240\007897\212\001g\340"
+	.ascii	"\023\362\017"
+	.ascii	"c\253\205\306\304+\230$\t6\f\210\204\022j9#N\242x\211\364\363"
+	.ascii	"\250\370o7 \250\3406iT\"\n\325'-\033\033\3538|\276\003^n\305"
+	.ascii	"\307\357~\003\"\272\331M\2072\314)\206\003d\347\262rHn\f\320"
+	.ascii	"\357\2046\341\345\330B\306F+1\242Kr\013\216)\237@\215i\340ot"
+	.ascii	"QR\026Xf\002\3033A\251\210\274\233\272\365\224\225ov\336LF^H"
+	.ascii	"\223\302\220\005\231QRW\240\260\374\020\262\023\356\356y\025"
+	.ascii	"\277\261\370\365M\266\0357\264\373\r\013l"
+	.string	"\31359\275\033\242\302\277)\302\301\003+\262\363e</pU\344\022\272d\364n\264\316\004'\376\226\026m\305\201o\360@\261n\f\356j\365\363*\316\334\250x\321\023z\271\233YL!+e'\305\331'\325\211J\340\245\310w0\213\237m`\224\316Y\270\264K\347\235\322Yi)\261\266\200:\005\350\251\362\302Y6\227\276\355|\2471\243Z\n\232\303@\317\020}\324e7\264b\362/\331\303\250S?>\310\002\261WK\315\265\030\236D8]e\177\333\tlo/2\205%u9\316Y3'\212m\025\036\211w\200Jh\002\345Qe@\364\203xO\260lR\222;\271\266`BM\253\246d\244<\177.w\"\007\366\260\017J!!\200-\rE\374gk\371\263\262\324H\2302q\233\005\303d~\361\221\345D\224\201\263h\366\r\256#\213\211~\254\f\353\323\033\025\303H\224\264\252~`'l\254\260&\212\032a"
+	.string	"8\266f\275t^\340p"
+	.string	"a\001\340\227\272;w\356\024}\227\340\226\210\201\023\306\220\204'\364o\300\256\364\333z\t|9\334\022i=\210{\202\272sX\335\213\004\234\220 \256,:\215\r\301\371\211\250&k\207v%h\353Y\226o>\303\025\203X\337\302\217\201)<\354c<&_&\244\204P6!\245\024I\216_>\306\247\027]\340\377\230\225\300\237_Qj1\004\215\363\220\271"
+	.string	"\200<U>+\3474iw@mz\250\201\370\267p\001\316K\204r\007\006\376\002\365B\315;\025Uv\250\016Y\020@\372kS?\213i\306\024\016E\251wNO\n\177X\343\2246X\215\366R9O\3069\323,XG\376_\223\322j\262\355\310:\252\202\336U\342"
+	.string	"V\221\016\363\364X\3410sDZc\3374O\267\325\223\356\356\022H\326\fp\366k&\fqd'\026tQ\201&\034\344\200\267Di\204}\374\013a\255\260T\201\266\316]\247\3420#\357\247\310\021\005\017\303\304-\301\325\305\213\321\211\300\205d\242\366M\264f$\2501\001J1\333\345\"\370\251\3446\347\263\376B\270\200\206\f\324\323fD\\q\356\3379\201\rs~\334\340\222\316F\034|@\343z\370\251oGJuE<\304\264\302\372\221\366\020\033\240\217\355\030MY9\256\363Pz\333p\363\253\n4\n\264\227\270o\322+"
+	.string	"\331\022f\002\362\202p\b\032\306\227}\025\b\\\217\367\021\\\321\275\343\233\006\252\251\002\223&m\023(%\360\035pO\211\257\177\373\246:\013$=\t+]\366q=\360\261Kjy\007U\366\213\224^lC\371\242\201\242K;\276<\320\021\001\256k\022sJ\325\n&\217K\2421\313\367\362h"
+	.string	"`\bs\347'*\306\232\030\374\253g\210Q3\177\230\304\202L\315\341\t\024\306!R\024\263\357\330\001\235\361+\377\007\324\307d\317>e1\005n\216\261\365\3318\354\233\350\256,.\320\205\273S\0048\345\234f\210\320\"\307\237\213C\254}\265\313\326=\004;8\332\354Y\310\342\202\024W\034\362f,\313\352\273\313 \264l\353\013\337\2233\252c\257m\261\212\351K\243\n\267\257\250\341Z\250\246\235\372\267\020{\256\007T\310"
+	.string	"\333\nW\300\005LH\032\361C\222\374\322$8%\221i\370\0177k\330\206\276\374sh\202\022n\257\220c@\235\373\353\034*w\245UR\262\300\311\270h\311\301\224\236\223\275\342z\005\307\013\310l\324\276W\023\325\335n\024a\316\215\327X\324\357._.\030\\-\027\357\264^M\310\316mN\301B.\264\245/&L\220\311\321\355f\315\273\201+r\0250\315\250\217s!%\376\2071\026n(0\315\021\231\300\233Y\353\252\031\027\001\341E\024#n4\342\317\306(\325\246Fe\254\352E\361i\365\216\035^\371\366\254f\245\242\257\301qGp\336\246\027*\235\236\005\"0\263[\024\334s1\001\t\226\320^\255+^\214\313\304O|\263=\353O\276\375\027\023LLg\013@t<A\022\034\355\266d\b\004\025\255\255Q(\250\355\3465\b\256\027\343\216\341h\247\004\024\363\355\016h\353\216\261\221=g\200\352\202\202"
+	.string	"\266t\343-G\023A\202\267O\016\\V\260\301>\365G:@\234~\030\204j\271\245\213=o\271\223\374\337\366\222\3666\b\302\005\025\333\220L]\247LR\351O\302\241\323n1P\244\022\251\223\262-K;A\337B\376\032\227_-]\364N\263\212:,\222\367:;\311\021|\202\2639 /\331\001\227`\036\f)F}I\202\250\301\321Y\273\240\230+\315\265r\353\272\320D\037\020\341\223\225\002\2328L\t\273\330\203P\3070\005\017ec\226\213\263\273,\2309e\306%\26634zg\253\275\203\375Z\314\006&z bn\267\216'\207f\021@\bs\265\030\215\021G"
+	.string	"#\034\002\202k\336\246D\250\0016\343\021\007S4\367B\345\f\237\247\241\315y1\0314\227\037>\0265\377v\240\023\334\b\f\262\311fX\221\361\366\272:\265=n\377x\023Q\220\265{jp\342p\363\217y\324\215\366\261\336"
+	.string	"(\366\266\242\200A\274\232\004\360\034\025\237\315?\354\002O-M\036\205\353\331'u\311l\301\364Yz'\253\306\307OJ \302^\007\320\217\224v "
+	.ascii	"\2505x\357#\347\203\210W\032(\346x\360\244\204E\021H{\262\t\030"
+	.ascii	"\234\230\3454\032s\311\374\213\231HL\316,\206VQ\223\t\233\201"
+	.ascii	"\277\013\247\257\313\327\240>\232M\247\371Jbl\355PfP\3572N\366"
+	.ascii	"\363!\022:JF)\005p\227\306\373\211}mo~1Z\r>s\021\f\331u`\013"
+	.ascii	";\237\332\3221\357\3255.\273\220#V\200R\247j\211Rp\3765\023\216"
+	.ascii	"L\367vA\020\324\357\267\352e\266\350\234~\223\\\323\351\204\004"
+	.ascii	"\244\250\333\270\034U\312r\255\303\300\007\327E\320\324\177;"
+	.ascii	"\266o\022Pb\214e<4C\266\223\330\323\330\213\335\265/[\237\341"
+	.ascii	".@\367\374\307!*\303b*859\016|\233\004\035\bW\372`\262\020A\340"
+	.ascii	"\272\t6\356\200\027\205\304\215`E\303\332\274R!\033w\277\325"
+	.ascii	"\237\310\030E\236\331@\255\306\267e\006\004\222\342\356\242\221"
+	.ascii	"*\224n\376\263\372\212\300\030\216\205\237~\334=f\350\340\337"
+	.ascii	"\332A\032\032z\316\355\365\303\204\212\030H\347\366\302\222\220"
+	.ascii	"k\006X+YW\351d\360@\254\370\002\200f\314\035\016\021\373`t$n"
+	.ascii	"hV\306\362\n,\256\337\035\337y\306\241\026|=\222\213'Z\001\266"
+	.ascii	"Ae\251\315\257M\347\253\363\374)\265\342\005\375(\305\013\001"
+	.ascii	"lg\225\271/\0233\254\300`\372\203\365\354\211\t\231E^\\\2360"
+	.ascii	"\343{$\271\360\254\240\344\306R\302\336\223\362VlC\027"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.182.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"U\n"
+	.string	"VSH@0\211*\035p$\371A\262,\025\312{\031\210\023q\331\200\034\315\254\277\266\036L\353*\2774\203\277\277e\025h\024\343\265\352\374\026Xg\320\211\204:\021}i{24\300\242\341\367~M\266\224)\0054"
+	.string	"7"
+	.string	"5"
+	.string	"\005$\3149\345\002\270\367\270\352\371\217\275\362\201\246G\n\353\033\033h%5\0060\025!F\024\260\036\273~\200(\325If\316i\375\300\325\315\3356\205mi\377\001qn+\036\366\357\325\2378\334@V\2679\2303\344Va\3168\004/\333\267\330V\265%&\274\303J\227?0"
+	.string	"K0g\030\341\007\3129{v\203\207\001\346eAM\025\261gRk\362n\\\253\312\246\007 \320Hv]\336\375Z\020`\220R\n\366e\017K\276"
+	.string	"\217H\372\357\234OZ8\367\365xE\030 r\322\233\035\242t]\366\003\234N\323U\2148\036\2127\230\213\016Hv\032\031\235\r\f\351\351h8\344&$\222\230\213? NHv\237OHZ\302\323\343\334\226+\262\t\263\323\242\342D\343\332\242\016\375\347\007\016"
+	.ascii	"3\241\017(\206\202\301`\274\027\251\315\005\341y\340\026t!'\030"
+	.ascii	"\303\200\252\275\222B'\256\271\250\304\2411(("
+	.text
+	.section	.gnu.lto_dynLpfDTermUpdate.183.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"=\n"
+	.string	"\226\323F?@\247(\035\300\031\316\255\n-\001T\222\005\354\251\312\212l{F\311\212\360%\245\205\020y\020\372o\255q6\314\223\022\231\221[#\237\026R\365\323\031\256\361\300\323\270\001\306\344A\311'do\231R3"
+	.string	"5"
+	.string	"3"
+	.string	"(\214\001\rvw\306\020\317\213\336eT\317\247h*\037H\272\324<\036\303\253\006x\222\230\335}\200k\006hR\245hv\327\372\201\0347v\333\r\266\247\375,\252\216\243Z\273\033\257\007\353\302\f\220\330\017m\313-\266\257\366O\016\300\373\312-Wv\017\254\n\354.\203\027\264c\230'd\307\344\021\262c\366\354\005\017E\366\302 \032-\312\036!X\nN\352\300\276\200\263D\276\312\027#\375w\314\037e\307\036\035J\b\230|\224\364e\207&\215 \366\345\356\256c\312\376\352\227\252~\2460\022\234O\327m\\\247\323\274\311Dx@\263\353Lx>\022\263\302\363@17\\hf.\336@\034nv\333\306MKXzL\271\222"
+	.string	"\201\253\024MRj*\243m\021\322\177\226\221\024\021"
+	.ascii	"3\003\3469D\2530p\007\214\025\252U \002qC\004\0034\204=\227\321"
+	.ascii	"5#6\253\323\3025\0020<jd\177(e"
+	.text
+	.section	.gnu.lto_dynDtermLpfCutoffFreq.184.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\372\001\205\021"
+	.string	"f\"vF\360\320&\035;F\366\353\373\243p\026\324>\241\377\036^u\314)g\336 \307\360=y\342\275\177\f\372mQ\206x\304\336\333.\243<\006\341\341\307\024&\233\324\242\257\230/\363\335zra\273\0034\351\246\3266\2212\245^"
+	.string	"^"
+	.string	"a"
+	.string	"\232\366k?\361:\217\213\343n\r\215\240\335\032\211\021t\217\247\364\363;\016m\332m\001\024\264\273$6\320=\332\366u^\342e\207\\-\304\215\210\321\b\031\212\032\273\373\215\\"
+	.string	"\351\221;"
+	.string	"\322\243\332\374\365|\371\007:\005\331\214(F\346\345Yj\260\273\316\030\231\231[o\273\200\355\tv\272\002O{Os<m\322t\247\351\222\246IO\307\247\271\247\365\351\324\364\003\210\340\334t\370,\334\345p\273\261Bq\005\316m\377\317\323\276\355\227\237\342@\366~\034rk;\315\210\004M\202\315\341wfSH\206\221N\321\356\036x\364\203\004\n^\367\321\360\323\306`\230p\320\343\222\247\205\211yX\020D3\"\331\021,*\b\215\207r\0325\316P\345T\207>\324\341S\025e3{\001\322b\341U\304\020Q\263fp\273\331\200\331\205\021H\365\320\273"
+	.ascii	"sby\3635\365`Q\207^?d3\026\262#X\336\354\332K*\b\373\334\356"
+	.ascii	"\256\365\203Q\347\371C\336\363\237n\273A\276\363\177\374\347"
+	.ascii	"\366\270\317\337\021)+VK*\2462\2640\234\304\025\253%\305\265"
+	.ascii	"\230\260\250\"\244\260 \260l@1\245V\\\256UK\305\325\371\244\004"
+	.ascii	"E\305\372\\*\025T+)\037\213\312\304\302w\322\272\360\225\f\360"
+	.ascii	"\212\225j}\256\325\252\365y\265\275\215\322\021\230\306\354)"
+	.ascii	"\207\242\364 M\314\323\b\242&\345\320\2039\235\232\224\033\002"
+	.ascii	"\213JJ\322N\017\322B\264\244?)I\275% p\002\021\244\335\330\b"
+	.ascii	"\212\001g\330\002\303\"\\GJ\326\342n\022o_<\363\177\216\314\004"
+	.ascii	"-\017\221\202\240Q\f1\316k\366\371^\246\343\342\206\b\213c\252"
+	.ascii	"\fR\210d\343g60\354\304\022\023>\260\333\022\354*\031\020YJ\226"
+	.ascii	"\331\304\261\230\001$\215\251\025d"
+	.text
+	.section	.gnu.lto_pidGetPreviousSetpoint.185.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"\025\b"
+	.string	"\222\01787@\217\322\001\230>*\\\353\177@\2375\031\312\256\025\373\375g\3545\026\3304\305ot\210"
+	.string	"-\251\271\023\311c\321\353\032\b\214\256\006M\375\305\244r\217\332O\366\3362\245\243\214\002\024\035\372(d\242Irh\310\036\030fD\006\202\230\241m4?\002\326D\013\333$i\33269\336>.TA\3509A\213\212\227\370\323\354\356\201?r\022\t\177u\351\211\222\276\273\364Kp\343:\351\313\366L\n9\354\307\205*[\325\360\254_c\007$E\343\250\223]\214W\314\266H\327\207m\316\346\350Yf\361fw\003eew\rL\240\271\264\355\207\\\204\263\277\350y\254:/\255\013\023\230\335\235\236\007`\227\361"
+	.string	"\330%\3548w\345\374\267\236\340\202\372\272\224\351\232A\330]k\227\312\270\341m\017\330.\260\255\022\013"
+	.ascii	"2\241\245/p+\n\"\026\017b\002r\r\327\304\342\341!\210\250p\003"
+	.ascii	"PyL\355$\003"
+	.text
+	.section	.gnu.lto_pidGetDT.186.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375 \367\305\006"
+	.string	"\242\f/4pM\322\001\240,\007e0\204Z/\376\345\021\341\001\253aa\265\336\rK\325\255\251\0174\304\024d\301\217MP\rE\364B+\210\346\t\r\016-\331D\312\224\002\276\254\004\314\362.\r\f\230\303\302\203\300\020\036\336\245E<\213\300\231EA{\227,\323\336\024\367\332I\2552:a?\344\321 \337c\t\177\362\333\235\357\217t\227\032p\221\311\220\0351\251\031\366\243\325\216\375t*\325ab\361\315\311.EheK\034\t\207mhO\276\307?\240\r\212\342\206\207B\031\321\210\250\354\356\253> \335E\027\220\356T\343\360\t\375\203\374@\263I\3318\230'\200\301\356:7N\305\255/\260\215\021\t"
+	.ascii	"2\003\346:\203k\b\3055Q8\004\216\031\233\270+\322lx\327\275\001"
+	.text
+	.section	.gnu.lto_pidGetPidFrequency.187.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375 \367\305\006"
+	.string	"\242\f/4pM\322\001\240/\200\025\365\215\230\377~yix\300jXX\255\350\243\223\252[S\037h\210)\310\202\037\233\240\032\212\350\205V\020\315\023\032\034Z\262\211\224)\005\276\254\004\314\362.\r\f\230\303\302\203\300\020\036\336\245E<\213\300\231EA{\227,\323\336\024\367\332I\2552:a_\344\321 \337c\t\177\362\333\235\357\217t\227\032\200\221\311\220\0351\251\032\366\243\325\216\375t*\345Aq\361M\311nEheQ\034I\207mhO\376\307A\240\r\212\"\207\207J1\321\214\250\354\356\253> \335E\027\220\356t\343\360\t\375\207\374@\2639\3318\230'\200\301\356:7\216\305\255/\260\235\021\t"
+	.ascii	"2\003\346:\203k\b\3055Q8\004\216\031\233\270+\322lx\327\275\001"
+	.text
+	.section	.gnu.lto_getCollectiveDeflectionAbs.188.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375 \367\255\006"
+	.string	"\342\f/3pM\322\001\240/"
+	.string	"\013r\324\244\336G\301\220\223\013\361\032/R\221=Ruk\352\003\r1\005Y\360cW"
+	.string	"\0269\275\320\n\242yB\203CK6\2212\245\266T\t\326\345a\032\030,\207\205\007a!<<\013\026\361*\002_\027\005\354a\256\013{R\334k'\225\322\350\204\375\221G\177|\315\022\366\344\263;\337\236\350.5 C\223\233\0353\251\033\366\241\335]k\307~:u\372\3200N\261\355Zl+\213\342L<lC[\362A\036\002\355\017\024;\264)\345dC\242\262\273\217\372@t\007] \272S\216\303'\364/\362\203MEI\306\311<\001\fv\327\231q.n}\201m\215\b"
+	.ascii	"2\001\0378\203+\016\305.Cb\306&\356\2124\033\336uo"
+	.text
+	.section	.gnu.lto_getCollectiveDeflectionAbsHPF.189.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375 \367\305\006"
+	.string	"\242\f/4`m\322\001@C\346I\002\246R\245\302b\b\360jf\225;G\377\201,\320f\345\2016\225r\217|\3054\b\n\334\260VE\203\353)Yp\021\311&R\246\024\276\254\004\254\362,\r\f\230\303\302\203\300\020\036\336\245E<\213\300YEA{\226,\323\336\024\367\312I\2550:a\377\343\321 \277c\t\177\362\333\235\357\217t\227\032p\201\311\220\035/\251\031\366\243U\216\375t*\345\t\261\270\206d\227\"\224\262#N\204\3036\264'\337\363\016h\203\242\270\321\241NJ2 (\273\373\252\017Hw\321\005\244;\3258|B\377\036?\310hL\266\315\345\t`\260\273\316mSq\353\013lc\004\t"
+	.ascii	"2\003\346:\203k\b\3055Q8\004\216\031\233\270+\322lx\327\275\001"
+	.text
+	.section	.gnu.lto__reset_template_116.6.191.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`P\001\325\f"
+	.string	"fTNH\320,)\215\001"
+	.string	"\177\017X\225\330)r'M\353\277\320\314\222\232YYh%\220`\213\006\301\303\274\304\007@2"
+	.string	"L\370\253\252\210\233"
+	.string	"I`"
+	.string	"H\002\003@\022\030"
+	.string	"\024\275\004g]\3140}\320EzNf4\243\035\222H>"
+	.string	">"
+	.string	"7"
+	.string	"\261{\346\275\327j\215\024v\215]\315;\f\021q\024%\031\235<\272V\224X8]\3722.&k\227\007V\024\313Gq\322\304c\024\023\264\216\200\255\245^\227\267\r\214I\326c\270\nC\021%s\270\231\2073/g\233\316u\347 \317i\317\251\317\273\237S\240 V\320\303\037\366\r\342\021\377>A\262\212\021!\02706\n\363\024 \274\216I\022\260K\230\020\371\370]\206\310\231\213\b)\321\237\253\340\272\013\306\260\f\316\260\r\256\353`\r\373`\334B8\267\347u\321e;\033M\271\252\214[Y\307\362\331\262\316\345\372\362\016\346\r1W\231\323\231S\232k\315\250Ma(\206\237\213t\204U\032\335\245e\313\364l\233\226\260O\327\205z\302FMa\247N\227j\332VM["
+	.ascii	"\327\rpm\005\\a\007la\tl\333\002_X\003\337\026A0 \300\"\262\364"
+	.ascii	"W\211+X\207]+\0077,\234\313\022\322\030*\227\355\252\217\023"
+	.ascii	"m\201\271^RVn\0251T\260\212Ywt\003\336\262\346\300c\236\226\275"
+	.ascii	"\"\206\006\030\314\345c\243v]\353,\227x\222\203\017\336\356\t"
+	.ascii	"\363\204JC\210\341\032j\230\331\330\217\265\326.\316\204\374"
+	.ascii	"nj\005SE"
+	.text
+	.section	.gnu.lto_pidInitFilters.part.0.245.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\f\035\025s"
+	.string	"\272\264\370'G \214\333\031\0033\267_\032i\250\374\221*\232Nh\201\3708\3061\tm\272\312.rE\311\311\336|\215\257h\305]\276\371A?s\340\333N\031U\020\252.\304\215\"\315\270\356\262c\324Q,\016\332D\344\312\235RJ\001\177\002 \002q\002]\304\334\334\203\024\t\001\0024\206\212\t\201\022\001\001\262+T\326\036\"\372\241CX\330\307\216\217` \322[&\006\214\031<z\362"
+	.ascii	"\241\203\250\206\220_\333\341.\201:B]\037\304>\300\277:N\340"
+	.ascii	"\3528i\307\324\230\320\302\020\212\265}\314\312\236\323$p\363"
+	.ascii	"\355\211\211\300\275\307J9\274GW\367\001\342\373\276\f\264\275"
+	.ascii	"\266\334\"\210q\317\365\b\215\327z\254\214#\326p\240\360\262"
+	.ascii	",\356\255\222\327S\267\341@i\307\324Z;*w\210F\332^\227\306N:"
+	.ascii	"\336\331\331EY\222!\275eT\362\314\364h{\255\023\3537Q\270\335"
+	.ascii	"4\235\333o\242,\311\342^\265\022\3237.\332^\221\274\223\216\335"
+	.ascii	"\206\265\270\304ZN\n\253iq\271-'e9\026\367\246iM\341\250!\364"
+	.ascii	"\276q\314^Y\253\355U\311\356\035'\326l\034h\212{\327\324\330"
+	.ascii	"\235\271\327\264\324m6\0164\205\367\365\322\007\347}\343\254"
+	.ascii	"ze\017m\257\034\327K\307^\333N:\366\312\334i\230YL\215\331e>"
+	.ascii	"\35480o\327\2119\233#\364\276/V\257\357\206\304\260$\025\305"
+	.ascii	"\344oc\\3V\353v\027\327\226\b\255\020YXWV \230UT\037<t\230\342"
+	.ascii	" \265!j\t\245\341\311)\003\206\013M\026\230\226\224\222*P@:2"
+	.ascii	"*\"R&\221-{\\\215\357^.\367Xwq%\341\211\371\323e\355\260\267"
+	.ascii	"\fE\364)t-\302\016A8\350Y\202\212v\034\213\332W\324\266R\024"
+	.ascii	"\004t\020\177\201\374\234Y\247\253\3524\225q\031\350\317\270"
+	.ascii	"\324\353\363\017\036\324\354\300\241\323\035\360\250M\247\360"
+	.ascii	"\362\234\303\035\342\b.e\327\033\356\n\337xT]/\353\032\312\256"
+	.ascii	"5H\331\334\375\323\335\032w\272\323S\343\031\004\3118\006\020"
+	.ascii	"\372BS\264-\030\227\037\030\227\202e\234\311\210\224\025\306"
+	.ascii	"\227\276\254\215i\245\244\356\262\006\327\025\304\350ys\nc\032"
+	.ascii	"\311A\350\243-\335E\r\314q\351mO\fGuQK\363Fg\324\332\274\310"
+	.ascii	"\270Lc\\\352]\340D]\326\264\264\322\270\324b\\\352e\361\244\021"
+	.ascii	")\353}\3373jl\216\214\372\262\206\245[\255<:j\024\273\254ai\326"
+	.ascii	"X\205\030G\320R\032\231\347\231\037K\350(\247\257\311*V\332\210"
+	.ascii	"G\315\002e\2252\177\243*S\214\313\367}[\257\035\255\212\231{"
+	.ascii	"\205\366bS\274\357\313M\346\247yD3\033\323\230\331\214\271\251"
+	.ascii	"0\317+N\305\2376p\350\360~\3528\366z\364"
+	.string	"]BK\311\021\024e\243\232\245\301\265KN\364E\317\334\303\207\367\323\350\227f?\306\311/\372V>\3217`\033\r\345\3619\021\241\370\314\322\330\207\362\327Q\371}h\246|eY\242\"\265Z\255\036\037\312=\230EjD~G\263H\340\353'\037\2159\3121\371Mnnr\204\337\315\246Z]\\\037\372\310\177\202G=[DQ\255V\215\355\377\207\311\331a\277\375\341d\354\257\211\206\321o\256V\253\325\177(\037\377\237\210\034\265\314\013\361\372\307\357\263E\016\342\357W\373\276e]\334\325\005\206p\3039p\354u\375\225\203@E\251\377\277\357q\332!\2336\033\337\227L\252\337\277\235g\246x\225\271OhC<\345\206\343\"\234\347\375\344\274c\257\375~\276\230i[\303F\346U\177(\277Ww\265Z=\304\357\205\231u\376b\235\205 \235\203(\235\201\260\316?Xg\003Xg\037\254s\001\255s\017\326\231\007\353L"
+	.string	"\353\274\203u\326\241t\316\301:\343`\235o(\235m\324 r\246\321\204\232g\260\3162X\347\001X\347\030Jg\030/\210\234]tbs\013\326\231\005\353\274B\351,"
+	.string	"\353\254B\351\234\202uF\301:\237`\235M \235K\264\316$\332Os"
+	.string	"Ig"
+	.string	"\232u\366j\235\273\220\316\\[Ig\021\335\247Y\213u\016\301:g\265\316X\254\363\225\322\331\n\351\f\242ufV%\235\251X\347\017Hg\017E\316\035:\260y\212u\346\200t\226\332\220t\216b\235\227\2543\024\353\254\201\310\371\251\3634;\261\316\031Xg\f\254\363\205n\323\334\244t\266\200tfZj\235\225\272\2569\251B\322\231BS\233\221\220\316G\375\327l\304:\027\261\316D\255\2632\331w\315H\244s\333:\263H\347c\353\274v\\\267\261\3434?\353\354\254sw\004LWj\3367\255j\350\345\262\352\225\3518\335w\335u\335m\272\347t\377uS\273\363t\007v\367\351\366\323\235\330M(\255\245\365]8\030\245\365[\337\211\177T/\017\361\"\314\370 \240d\201\357y\261\245G\304\325g\205\300\372\254w\274;_X\337r\006\245\324\253\357\302\236\262\302':\266\354\203\372\323"
+	.ascii	"\030H\347\317oO\037\337\341\034\253\246\242\313\261z\026\215"
+	.ascii	"\036E)\331\323\241\034\225\371 \236\235;sz(\363\2114Op\275\257"
+	.ascii	"\2269\205FO4K/f\270P\365+\341\021\263\247\246\276\005\341`\230"
+	.ascii	"\372\252\357D?\272\013*\334\303\177x\252gnV\3351'\336\335\213"
+	.ascii	".A;\252\017u\036~\345\303\322t\302\245\236\303w0s\317\234n\216"
+	.ascii	"P\3619\027\355\204\313\201\267q1\360\222\353\360\034B\220\372"
+	.ascii	"uoN4\0027M\352G\265 \330\0167\306M\216\351Mi\303\257\204H\314"
+	.ascii	"vrJ\036\272\232\275\267=1KN\277\341;\221\316 %/_~\324\004\256"
+	.ascii	"\225(\002L\037\274\350\022\364 J\303C-\2418\320\360+^\037[\322"
+	.ascii	"\226g\370',n\226\245\231\006H\230\334\013\334\214\273\305\253"
+	.ascii	"\313\205\227q1\330\032\343d\334\f\\\250\353\346v\354\365i\311"
+	.ascii	"/<\206gv\303dXz\f\337ND2\177\343\251\030\316\273\360\353\336"
+	.ascii	"\235\"\233;\306-sB\360}\311\372\311\376\305\335\\\r\334\r\\4"
+	.ascii	".\2323}t\317+\313+\335\364\255\247\035\016\216M\334\373\276\024"
+	.ascii	"\036\312\335H\017\345\346\024c~\210\277\217\036\312\031\260{"
+	.ascii	"\341\303u\332]\266\260s\341\303\325\r\235~:\266\261ka\346\303"
+	.ascii	"\025\220\355}\307\272\215\331\2630\263\230?_*\021\\\312|\321"
+	.ascii	"\003\307\342F-<\213\306MTj\364Pf\372\377.$gg\351\231\276\b:'"
+	.ascii	"\027"
+	.string	"HW\364P>\nS=\233*\273\245\034\217a\n\235M\223\334R\216M\217fT\267x6U*=[\247x6M&\375\322\243M\351\245w<w\376\344!z\250\362\275\260;[\351\211\244q+_\255\3223\335\022\333\326H\311\274\272\306'\370\262\022L\372\326k)=\206\024\245\311\207r\021a[\341\3277\226\331H\217f\325H\357\322\305?\n\322 A4\322W\370\376\313\243:\333\226\336\255\342h\364G_\364\024\236yE\013\357'\033_\266\037c\3664\004\214\004\237\314,\304%xa\005\346}\337\021\275\262C\340\021\304`\0314h\034{\245\360\035`\215#I\221'L\226\034\235\20010\304\370\304\t\030\024\005\244\324\220Rd\311\021(\n\034\tsa\004\254IR\0030\222\024y\302\244\206\222\260#;\214\0205\220\344+\201/\244\"`J\206,\221\302\302\211\223!M\2420\231\241$\354\310\023#IG\022"
+	.ascii	";\200I\330\r#`M\222\\\344\312\bX\023\254'"
+	.string	"I\220\200%p"
+	.ascii	"\326\022\260!J\260\212\2049\301\272jb&M\216\204a=a\302$\fK\331"
+	.ascii	"\376\246 \373)]_l\244vH\274\237<^\310\027\220\027\362Z\204\203"
+	.ascii	"\234\210&\242~\270@|\007xZ\b\251[A\004\311\375\001\371 \337\211"
+	.ascii	"\204|g\213\"\036\312\036b\307\033\031\306Y\314\342\251\024\001"
+	.ascii	"\217\366n\rd\372\033\270Q \277v\260\027\225\376x\r\232q\376\320"
+	.ascii	"\323\004\003\236\307\377x\343\036\247\237\217\347\361\006\374"
+	.ascii	"\272\347l+`Q\257P\234\217_\0179\375z|\001\337\264G\302\223\371"
+	.ascii	"\352\361\2757(\205\343\361H7\323(\033\001o{N\203Z:\236\247\315"
+	.ascii	"\245\335\361O\200N\277\034\257\343\233\346B<\224\333\215\036"
+	.ascii	"s\274\321!\337\177\311\361\3109t\212R\034\357\205\247}\234\347"
+	.ascii	"\200O\023\356\370l\300\005E\265Z\250\354\306\343\370#\236\363"
+	.ascii	"\214\215\277\361nX\3471p\2436\250\370\320E\245YW5"
+	.string	"~}\263b\366\214\031X3\276\306\367\232\340T\306\323h\343\363\027\270[8h\001l\356\241\021\343\007\220\361XxJ\345\274\001*\210\361\255\330Rs\346\242WV\0174\f+0\256\264\211\202x(#-\250z\361\353\033\025\263[\264\370>4\276-\376\305\367\032\225o\313Y\274\013\263_Cb\324L\374*\356\226\016\202\237\366j\315;y\232{\366\034{u\241\342W\260\020\340W|C\320\034l\0066\r\005x$\333?U|\007j\251\275C\212_\365\320n\016\036S\274\363\317\232\203}\232\206M\303c\257)~5\324\307\346\357\373\216}@\361M\302\227!i\237\354\247\270[\232~\220 9\366\352&\376\004\n\022\177b\321\304\277\025A]'\004V\265\375Q\340\341\241\374\247\th\n\f\241f 5;|\317+\275w'\203\302\016%\370\310\375\221\370\022\177\f\324S$\236\210\334\340 \027D\"QqN\225\303\206"
+	.string	"~%\324\300\354\021#\276\021\023\245F|"
+	.string	"\337\211\200t*\234\353\275\036"
+	.string	"\347\037\t\034\321\017"
+	.string	"\337\317+]\357e\330\365=7(\355\303\365\215\330SV\n\0257,\267~%\204b\006\202Y\250\3620\035R\242P)E\"\"\222$I:B\013\020\b$Y\330jy\003\022\340C=\314sL)4$\"IAA\352\225\341\030\n\212\363\312\001\347\322\032\317\337\203-\242U\025\231\3042D\320R\274\004\240\240\027\206\223@\346\257\322\315\212\231\213\0246\273*\223E\353\305B\235\364o\022\234u\207K\376V\274M\200\032\223<\330\016\206\205\"\210K\"%\314\265\302\224p\3607\3307\220yd0p3;\367\260\337\004\025\265\023\264\340"
+	.string	"\016R.\234\342U\207\327\256t\213#T\016X\230\231\016F_\364\256\177Wq\343S[\370\021\246\332\322x\351\n\246\035\240\016\212\245\231P\220|U\311\f3\r\231\252\326D'\321\002\230\260\252|iN\303\370E\027\305@.\222\312\217\314:\3027\247\022\335\203\340x\013D;\351\361\177r\3166)\017F\020v\241}\n\n#\203\273\324\242G\033\230\350\214\245GNG\013zrl\n\353\200}(\206\312)\243\236\302+1\225\347\247\304{GS\254#\003\265\361\355\261\020\276\334\254r9[\220\337\305Rw.i\2555\034\n\001\277\201\316\371\344\00216\202\362\354\221\272\363\0135(\330j\250\246/ Pfe\2329X\004\330E<\251\201\323F\354\022\001q\357\203i\370j\261<\220\207y\027\325!\231\002\300\271"
+	.string	"\\'?\325}X\330Zi\021\245\002!3\026\254\261N\201e\220;\267<=\223\b2\245}\0224\303\204rg1\346?4\222NH\203\366\345\f\254\t\035\211\364f\245^Z\027\231`\210\240\371\355e\013W\002/\276H\026'\004T\331\354\326\346\306\340\230f\363\371\002y\374{?\035\030\220/\204}\031'\227i\367w\330\300\307\022\305"
+	.string	"\261\336\260\036\306\244\205"
+	.string	"\242MO"
+	.string	"\201\275,\001\207\275}n\336z\017\335\326m\372S]d\347 \265\006X\023%\304$\024\343\337\t,\235[:\b\2023\177\340\r\214\n\325"
+	.string	"\214\306-\2372m\234\370R%\311\234\345p\356g\235Yo\277\031\305\310\307\344x7"
+	.string	"\005\242\016\272=\233\303\035\254\235-\274l\203\301\204T)\235\0027\354\274\327\271\227\032s\253\024=\345\323\310\2653I\255\375j\020M\221\311\201\3008\316\250D.m\235\342\322\203\3366\250_~\335\230\240\021b\ba\316#1b\343\334\353C#\\\341<x\350#\270f-\271\211^"
+	.string	"\252H\023\304c\207w\240Q\247\271\263 \347M\235v\037\\\006\271\177+5_\245\264E[\225\303\030&\0160\336\264(\301+\267[&\342\231qZ\261w\343\034\245\252\006\022\2725\366\013\001\321\031\355\332\207h\300\242\233\316Y\016%\034T#m\021W\2007D\t"
+	.string	"\016r%\304\205\021\236R\024/\216~\b\303\271%\220\235\204\300\017\361\b\253\310\267&#\021\220\263\214\2345\256\250\262\022\271\343R\""
+	.string	"C\222\274j@i\245\302\377&\013\365|\360\230-\013\016&O\373\237\243\335|\322D?<\214\332F5\337\341\022X\334\317X\220+\3675\230\002\340bxQ0*(\202\nm\026VBhsXI(\347\241\224\224\270>6T\364\355\022F1,\371\362\203.\217\240%\345\271r\022\216(\264\354\263\026\226\331\272"
+	.string	"3H\347\026\267zr\"qs6\377[j\240&\255\312"
+	.string	"28\036G;ZF\345\007\260\226FS\025\210G|\020$.\267}\032\200\0060\227>\226\t2)\272\202\360\236H\r\034Q}\351\204\351A\001Z\021\361\355\f\\i}\032\2557p\265\262n\347]w\335\351;\267:I\2651\340V\263\316\324\r\343^\322g\367\321\022\022?p\252\301K\310\2713\266A\352\335]g?Vt\361\244\220\215w\244\371U\346\230\036RY\026\264B\371\251\031\337\363\340\246\212\265\025\220h\240\253\2765\325\023<*\026|(\261B\205&\n\203\367\037\262me\234\366}a>L\201\246\261\212\273"
+	.ascii	"\233\267\275f\313H\305\222q\3129(\340\\d\247\032,CP$q\346m\252"
+	.ascii	"\321\335\202\370\327\320\310'~\234}m\302\351\205\353w\004\264"
+	.ascii	"V\306\265\321\217\300Pk*\217`Y-\210\220-_\341"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.part.0.246.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\234\004\035\035"
+	.string	"\3264\264F\240\232M:\304\353\030\276\206\032\202\250Q>{\365\031^NQ\327`\034\242I\027\306\207\264j5\020\250$\220i\032\034U.\324W\316^/\241\307"
+	.string	"&\301\220\003<\244$'\037\261\032\017qt\266f\t\331\233\354\235R\232"
+	.string	"\235"
+	.string	"\233"
+	.ascii	"\247\265S\371\237\356U6\344o{=Oi\237\352Lv\257\262a\272\353\344"
+	.ascii	"ee\367\007\341\324\r\304S\235\027\250\247\362\003\352\251})\333"
+	.ascii	"\272\236w\366\330\177A\366U\246p\\\271\331]\333\351\004\342y"
+	.ascii	"\360w"
+	.string	"\207rw1\254\024\234r\266\363C\rX_`\346\314\350\343]\004u\300\364\230@\tr\311\207$C9\036\341\361\0324\205r\021k3\372v\034\274A\363%\325\002B\266\206X\216>\2459\257u\020\211X\226\321\307\343R\300g\241\206\335\365\217z\334\264\333Vb;\204\r.\005@\325\277r,@~\224q/\344\307S\377E=M\221\344\251ij\315\221,\223\023\312s6\237\312\312\312\340x>\331\265\2314\255J\317Di1\224\016\237u\327*M\2534\370\337?\253\264\244\322\037`\300\302\324\256\216\2628\353D\261\024y\326\357\344\207\362i\337\227\362(\276\226kY:\367\246\234\312\356U\274\265\223\364[_\t1+Snv\367\203x\272\0036\271\337D\347_\035\3135(O\236\020\311 \336\211'T\320\335\312H\036X\036\033\007\247\023*\354net\235E\n3R\020\003t\206\323\0261B~\264\037&\303"
+	.string	"\330h;\3672$0\200\355\356\0052\0073\341G\235\372\004\n\024\3654\234\037w\b\220r\202\323V\261B~\244s\347\306\344yNp^\211\314\017s1\326\362\243\334\343,gM\3125\346\315\273\236\200\351\213'\345x\376\273{\004~\371_\244\027'\313qsh\031Y\247\345\361\362\273xL\334\345\275\351WP\273V\022\330\221\b\025\262\335\345\331\3427\331\327\"\376\226g'I\316\261\277u.#\237\333\255\236~\372H\022\325D\3054w\2277'\324\003D8\032=\340m\250F\t\032\021\216\306\006\240\031,n-f??BE38\344nE0p?"
+	.ascii	"\354\023\241\005n\310V\344\002\b\007\343\307\026\003\327\023"
+	.ascii	"d\363\311\021\331\"\034\260\320\320-g+\022\022\312\331\344\277"
+	.ascii	"\363\t\353b\227\324\327\321D\022'\224\003\204\325\332\244B\244"
+	.ascii	"\203\327\271d\333\020^\247db\025\226$\341x\036\334\335\r\037"
+	.ascii	"\274\316\332\274\227X\026\245&$-\277\224\203\2432\220\342\234"
+	.ascii	"M\332\264wR;*%5AivU\277\nBv4\0338t\350POis\316\314|\314\303\007"
+	.ascii	"\020\362#\210z*N\312%\266\304\313\tt\375\240\bdb\250a0\247\020"
+	.ascii	"c\002!\031\022\222$I\322\001p\002\23123\035\021\220\301c\246"
+	.ascii	"\005j\317\254\256RK)!\301\255\004N\322\312J\377\231\233A\217"
+	.ascii	"c\212\235\020\273\327\031\322^\001\331\245\027H\\\241\263\200"
+	.ascii	"\222\275ty\034\244\345mb\301\361\204\3254\321\316\342\036%\242"
+	.ascii	"\217 X\372\370\261\351`r\200\267\220\330\027\304|\240\370r\035"
+	.ascii	"Et\366X\204sHb\b\306\367\337\205\005\013D\017\276\235\267p\210"
+	.ascii	"\366\256o\026:SE\035x\311\ba\027\376\017giR\370\362&\250\027"
+	.ascii	"\3320A\316(\201\224\236\215U\020\030F\200\3076\035Hz(\363$\334"
+	.ascii	"'\246\031g\r\231\345\352zj\224\270\021f\214\262\277%dX\217\337"
+	.ascii	"$\227\301tU\273|\310\204\330\035\322"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.part.0.247.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\310\0035\031"
+	.string	"f\357\235F\300\030Q:\3005\220K\217\226i\272\202\244\327k\246&y!\374\2730EV\205\001\020\001\362\342\361@?\332\333\013\030Y\205a\337etY,C\020M\205p\233\343 \347\266\202\200\fB\232\210\375O\032\331D\356\224\002\207"
+	.string	"\203"
+	.string	"\210"
+	.ascii	"R\267\267\233U\332/r#\263\037\201\341\271\233\353\"eW\007\341"
+	.ascii	"\323\r\304O\234\037\b?\345\013\204\237\366\207\330\226\335<\263"
+	.ascii	"\225\256\323\261\207b\004\244$\315\356\262>5\207\365\240\356"
+	.ascii	"\016\345\354\246p\202*\305\231\377\335\027,-\2158\332M \316\356"
+	.ascii	"\n\300\001\201\022\244\f\\M\206\226c\020\033\237/'\340\213\016"
+	.ascii	"fQB3\342j\\m>\341\201\035=\036(\\\f\225\252\213&\013\273\353"
+	.ascii	"\327n\334\247\333\306a\233\202\255^\002N\376\304\345\367\260"
+	.ascii	"\n\036\371\361\323\347\321\027\235\201\317\214\232\0335\371\263"
+	.ascii	"^w\227&u\310*\252\320\357\367[c\025\262S\2424jJ\237L\322b(m:"
+	.ascii	"\321\035N\3519\245\301\353~\235\322\022\224>\001U\005\"\2734"
+	.ascii	"~m67\251\3748\321o\337':\022\277\310)&2\257l\272\305\335v>\223"
+	.ascii	"'\271\222\331\227\270'\322nb\023(Iev\327\301\247'\210\237+\360"
+	.ascii	"\376Nf\247R\237\362:\331\217\300\bBz7\240\305\bT\311\251&\265"
+	.ascii	"A\204\220\037\355\037\365\250\220F\333\260\033\211x\022\244\335"
+	.ascii	"\245\300\345]F\370=>M\242D\211\360\323\244\037m\f\220RA\265u"
+	.ascii	"v\344\307\251\253\030J\263*\250\377)\343cy\026GAa\236y:}g>\345"
+	.ascii	"\t\256\034\321\244\033\353\277\2735\325!\333\347[\221\275\234"
+	.ascii	"\345\2703\226\200lns\250\370U\254$\356\322\036\364+\b\247\254"
+	.ascii	"4\260\243\01729Q\374 \373<Q\2679+\233|c?=\256\027&\300V\353\025"
+	.ascii	"s\201\001\266\023[\341j\001\260N\204\023\256\026\254X\n\024\256"
+	.ascii	"\025-\026\013\227\t\036\226\016\254\207\025\001\201_-v`\254\330"
+	.ascii	"\353\005c\245l\313\177U\310\337]\324\302\346\250\246>&\035\362"
+	.ascii	"\334!:x\200\244\231\322Pe\3306\204\207*\215 I\262\3115\326\203"
+	.ascii	"\273\273\341\203\207\232\322oQ\262\362\023\344\303\373\245\033"
+	.ascii	"\240\271\222\242\236\024\245\366\005\f?c^H\031\276DG\230\213"
+	.ascii	"\321\260\201\003\207\360\023\245z\372r0\035<|\220\037?\204\237"
+	.ascii	"\242N_\233O\250a4\306\224BFffDD\302l\013\035p\002\231\262:\017"
+	.ascii	"\020`jhA1\007\"@*\245H\004Y\361?_\213f\243\021[\243I\317\217"
+	.ascii	"]?d\244\206\361w\026iK\226f\247WSB\270\312PL\306\\D;C\202\334"
+	.ascii	"B&\202\356\271\321k\233!T\370\nZ\001\317\300\343\215\t\366\300"
+	.ascii	"\317\247d\202Zo!\370F\034\271\017\216\323\316\2227\351\272\200"
+	.ascii	"\nqVm\030'\212\266\243\240b\321\035)T-?\364\003\006\2724\334"
+	.ascii	"\275<\236\346\273G\331\316lYV\333\262\226*\312\n\224\354\225"
+	.ascii	"\344\353\312\323\244\330E\024m\320\354\3404"
+	.text
+	.section	.gnu.lto_pidApplyThrustLinearization.part.0.250.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\035\001\365\f"
+	.string	"\006\231VA\020\221\223\016\220O"
+	.string	"\020\341\210\307\272\360\326\n\243\257\030\323\310a\245\003\272BD\224\227\"Y\327\362\242g5k\032i\023\353\333\355H"
+	.string	"\240"
+	.string	"D\204\002x\203\345@W\345y\204\221O\b!{'\231RD"
+	.string	">"
+	.string	"C"
+	.string	"u\013\311I\333\372\204QxZ\223#}\030u\220\300`\001\306Fff~\036\036@\3719\013\240\374\276b\217\217\316S\373\305\t>,5B(%>\007\212\006c"
+	.string	"\273\nAf\326\332\340>\267=\320\326@\353\225\227I\256\205\330\n\261\024b\037b\035bo\222\215\2105\206\242\217\231\314\f\247\231\364\360Z\204h\375B\322b\255\247\305\212h\222]rtRD\273\324\324+\023F\f\026\231Y\300\257\037\226_\003#\035\312\241\352\036\025^\322\367\237:\200\031,/@\035\334\335\337\212\t\356\226!*\335\300\373\277A#>xj\235\30205\325\243Rh\f:\344W7\206\362\363mBT*\301\301\004Ox\225\336\271|J\033[g\263u\024p\264M\023\301\032\002\302@\263\3116\b\0174\021\034d\0224\013D\262\020\316H\006B\240\332\246\001'\3334\215\223av\371\224v\250p\001\002\255_\277\320\366\272eh\264\310\230\374\363\253\264u\257n\375%\220\210\n\251\267\001\032"
+	.ascii	"1\033\303\327\r\303\307\020\260\250\310\\\005\017p\001\343>\225"
+	.ascii	"F\254j\020<\005\310\\\335\372f\263\240\026B\303\252\256\226\326"
+	.ascii	"\212\330\t6x\332!V9@\023\234~\247\347\2024%\265\234~m\031\003"
+	.text
+	.section	.gnu.lto_pidCopyProfile.part.0.252.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375` \002\365\020"
+	.string	"\366\336mG\340\260*\035\353\357E-K\023TP\240\376\314\235\301V\276\310\314F\034\004\f\204{o|\204\244o.\034\372\037\210Z\353\367]k\236\"N\226\232\2101\024\303\"\306\241Lx/.\006\244\001\3711\353j~%\233\310\235RS"
+	.string	"]"
+	.string	"Y"
+	.string	"0&\225^\277\231|\\\025\232U\332\244\022\3547\023\353n\207\333nwL\360\351\003\237O\373'l\277h\206\3315>\212+\"aK\221\321\331]\360SA\034v\225\036\314?\356\035\263\225\223k\200\025\f\227\241{"
+	.ascii	"\030\354\256?\031\356y\333%"
+	.string	"\333([\226\004\217\371\337!k#\016\273*=9\326\303\254\t!E\243\310B\243y\271\345\355\206Qd9\316\266C\241\263\024F\004\266\375\231\257p\271\245\026*\304>\220dhPL\350\354\216\340\247\307\027\370>?\037\360\371:\002\342e\236s=\205\237S\273)\261\273.\351\343^6\b\0243\216;\013T>:\233u\233\027\237^\347\351\324\343\356\355j7\262\031*xr\257iy,\304Y\311]\210x2\304\335U\320\342\273\224\377\362i\t+\371\331\352\373T}\356\016F\274\340\210\270\231\321p\225j@f\303\221\302\023\223=R]\254\336\275\325\026{J\177*=\017\363{SZUZ\006\0061\251V\241\t\250\323H\003TH\370\221Ry\234B\017\326\352\024\262it\nI@\026\b\2040\344\003\034\t\037\210\200&\325\n\034\211\234\"A\251@V*\245\002A\266\345\275\325\026\177h\330\300\211\251L\325\305\266"
+	.string	"\351\033w\214O\365S;\214 ?\363q\377\205\234\r\316N\016\212\236\370\272\303\b- \200\202\031U\354\0025\f\3666\242\266Fld7\242\337\340\311\002\203Lx\177u\301\333\3614\006\221\315v\253\323\031\030\333/\321\031\346\017\327\315\002\255?"
+	.ascii	"\213\025\206P\367A.C\226a\244m2\017-\267v\207\204\023<N5\243"
+	.ascii	"1Z)\235\203\231\204J\254\346\341\355\274\025\013`{\321r\372\247"
+	.ascii	"_k\306"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.part.0.259.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\207\004%\035"
+	.string	"\006u\266G\240\330M:\303c\225\245\373\247C-l \323'\360\362\252\343\017\230\032\305\341\263\245rN\315\376\nH\330d\361\336\372jO\344\273\2364;\317\243\236g\361\003\342\203\367\020\260\243\001f:\005(\321C\335\255\021B\244L)\242"
+	.string	"\224"
+	.string	"\244"
+	.ascii	"\372+%\223j\225x"
+	.string	"\313\313\214\003\325[\035\205V\223\267d\325\367\334e\332\234<\256p\3159\037\\\364\202\331E\373UGK\266}$O\222\263\267B+)*\003\275*\245%f\346\234\266\213;\317\031/\206\0270^\334\037\317\2356\223\215b\270Z\313\371\033\222\306|%\017\3514-yL\237=\353\t\212,5\251L\307\307\220\201\323\225\0337<\031a\216\226\036`$OI\305\025\213\022>\353\035z\244\t\226<\034\337]\322\2303\325\005\244\306\213\261\032\3405Y\317\234\323\327\355\270\311\333\246\262\335c\2075\002Hw\372\017\214\\3A\317$\323\323\342qb\033\370;\331\327\262}d\340Lj.M\253\311\263\263\3231\373L\336\344\346Sy\205\220\276\274\350\013\215\027\277\021\236\274\034i\322iP7\312[\333`0\030\346\365a\343\314\32472\265\315\252k\310P]S5-T\317d\243z\274\357\026\177\365\207\242zo\365k\250\376"
+	.string	"}\232\220d\316\032\3014\023J\204\"\344\276\333\367\035\371Y&\261\216\274\263\313\371X&\227x\353\323\306\324\037X\257'f\316\331\340\242+x\003+\256\215\257\314\230\206K\356\f\332\352\026]}\331\351\031\317\226\266W\032\323i\220\213\007\241\331\212x\002\036i\322\372\3039\347\024\013h\270\343\332\037@\350K\231\026\243_\210c}ay\226\021$J\224\030/\216Kn\021\333\222\362\177\005\211\204\0014\334]\333\304\t})\356N\214E\262o\305\005\201\257\3226\214W\361\261 5\347\224\340u*?>\325E\003\005\005\215\027w\311-i\312\224L:\r\372\\\317\355\370!\251\230\367\237\352\232\232\262\033ew\371ST\n\024\324\354y\r\231P\223\347\211\017\305\300\331\234\0018\240\242\365\301\261"
+	.ascii	"\312\200kq\033\"\302\001\205@q#\002`t{\341\023\372\007\002\212"
+	.string	"\033\221\r\247\"\350\306\"\205\255\305\315G\310\366Sdd\203\240\343!\"\240\"\033nh\250\310F\332\326\2073\034\311\305\331\031\266q\366\277\340\223\237n\223h7\013\346\300\034\222\013>\330\303\344\252r=\f\372\022\303xQ\357\256r\214\315\336\254N\027\2451\004Z\263\266\206\r\343K\233\335\331m=\3137\2739u\n\310\255Y\0351\031E\222(\344@Cc\266Q^\360\333X\333\033\361\302\241\266_z\002\206\005)\235~\262\215\262\307\215\262\f\rS([\002\2760`a\250q4\246\fb\006\021\211\210\310\004\206I\007\240\002\021\262[\035\020Xi\250\024\322\001\336\0048)\203\363\335\341\023\001DP\313;\333\006D\267-%\311{\343FN\177\206W0B\024\256\361_\324\323\327\312H\233\240\023\214\002Y\024\177\226}\274\036\350\225\025\275\013\212!\203\357\363\331\245\373+\363&\266\243T\230\030\331f\267\336\370g\204"
+	.string	"\202X\373\367"
+	.ascii	"\331$\220\376md\243\316F!\332g\205\256\273|\340\232\322a\177"
+	.ascii	"!Vm:6\2116M\263\362_\225\335#5\303\274\0340\205\201!>\250\346"
+	.ascii	"\335\2421a5\325\304\221\367\004\252t\3614\3054g\270Yv_ ,\213"
+	.ascii	"\036\220\310\203\020\241\221&\354|\260\270B,\033*"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.part.0.262.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`K\001\335\r"
+	.string	"\026\331ZD\020\257&\035\003e\024\r\006.\035\205\316.\253\363\200\365\210\250\023\371\326J\363_\310\335b\212\221\026}l\013\326Vv\206\324\023J+\370\t\013@\004"
+	.string	"\224\257\216@\361\370\001\241\302*E\261A7B6\2212\245G"
+	.string	"E"
+	.string	"F"
+	.string	".\356aXP\212\026\021jtv7\036\352\205\233\016/M\314\344g\241U\f\223\303DIQ\370\225\205Z\317\225\032\324\212\233\324\204+\200\324\3115`w\357=%\244P\231\001\216e\241\335\265\247\302\235\335\266f;\332\317\020\253\004,\273)\337\316\272\300\022+\333\367i\336\"\335\203\021\254v8\354.\351\276W\262?\037k^\306\035\036\245\263\272{\233\242bM\273\303\303tV\007z\216M\f\212]o\343\320\032\236C\373\035l\227Tl\262\003\026V>\350\024\270\201\333\370\204"
+	.ascii	"\234\335=\340\203x\b\b>\314\241IJ\362(\207~\tv\370\326\th0\341"
+	.ascii	"\322\022\223s\312\317\372\334]\023U\225\355\016\273*\3157\323"
+	.ascii	"bq\2220RUV\354Z}\261/\363?\313\032\367\301) i\"\036\203p,\020"
+	.ascii	"\215D\316A\003\321\003\006QD\364\021\022AF$\221\003\344mD\033"
+	.ascii	"En\333F\361c;\177\255\2768c\346\205\212\223\242\240\252\324\037"
+	.ascii	"q\022\235\017\343\220m\363\256\261\341\303ia\261\234\362\273"
+	.ascii	"6.\342\346\001! p\202\231\303\362\323\031\230\002\277\247\241"
+	.ascii	"E\370%\263miE$\266\003 \033\271\033\223z[\360W\026\320\362\360"
+	.ascii	"#:\303\214k\241\316\210\330\346\336\304D\330\372\261v\003\304"
+	.ascii	"-\261\244\254\031 \265\267w\034X\343\027yk\251\267\365\2047\006"
+	.text
+	.section	.gnu.lto_dynLpfDTermUpdate.part.0.264.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\021\t\2251"
+	.ascii	":Y\374\022A`\346M:Sm\227\027|\327\360\b\370\246HAQ\323dM\235"
+	.ascii	"\302\367\301\251\223h\254\321\027\304\345\323\252\031\243\310"
+	.ascii	"\200:;\375\222\253\230UgW\220\357D\340/\025\365hR\374c\315\310"
+	.ascii	"\266M\244L2\024\001\f\001!\001w#\366\271\035\300\372\262\344"
+	.ascii	"2\031\342<e\342;\365\304\366i\276f\203jVi\3264w[\202q\253\265"
+	.ascii	"r8\305.\267J\356Sh\031\006\257\326\212\341<\355\275\231\261}"
+	.ascii	"\334\006w\367g\340\254v\252\370V\325\220pV\257"
+	.string	"D\352\321\332\226G\274Z\337\260NW\302y\032\\\346\277\215\231o\265\nr\231w?\346d\210/\263\312\375\325JG\346M\255\025\302\35168O\247\016\325;5\357\324;\335}\230\335\035C\356\022w\017\375\255\255J-\317\314\342\030\325Z\263N\233J\322\366\315\267\357\331\304+%\005\201\277\323\327\243f\263\220\270\367m\210\373\357\250Fv%\273%\234\304\344A&\007\236\312\016\331\204J\013R\t\377L&;d\023S\302\0363>?\205\310\332}k\357\231Wly\214\334\016\231\304\204\252\203R\310\310\224\217jGn\002\325\216\274M\250!W\216B\265\242y\205\007G\321\343\316ije\314M\027\3726\324Z\367>\330\276K\337\275\201\335\205\261{\026\003\333Bf$\206\355l;\312\356U\022\257\203\327}\255\230\267A\220\227\301\002 \257\202\353\371V1o\002\346\245\232b^\004>\336\003\006~\274\005~\274\004\230w"
+	.ascii	"\363\n\240\274R'o\024\363\006\370\361B\235\274O?\363ub\336&\346"
+	.ascii	"\005\300\274L\314\273Dy\205\267\363Ub\336$\346\r2/\360o\377\357"
+	.ascii	"t\337\223y}\224\267w\362R\312k\236\274My\331\307{\n\234\304\022"
+	.ascii	"S\353\220\274G\325\t\215\203\345g~=\177\335O\347\217\363+\357"
+	.ascii	"gWy\222!\237\220\024+\326\256\362\310'$L\226I\274\323\333\371"
+	.ascii	"\351\376\333\375\276\217]\335\022\315\232\306\303\262\315\r\317"
+	.ascii	"\036=c5\317\322I.\231\2748\315\234"
+	.string	"\315\355\354\351~g\203k\306\322\214\211\035\315\376\315\345\274\3160)\227\254\265\006\351\354\204\nc\237\023vV7\037\335\204\nb\237\023\366\242.\005A\304\"\016\0348;\356\2442\001\021\204\342<U\216}n\307Y\337\234k\3133\332&f\234\344\\\327Z\311|\275\216\262\302\"F\323@\027\020\242v\250\235z\252\323\376\260\336\201\006\203\033\244(L\005\327\201\036&\335\320\002m\240;\216@Cu\201\276Q\321\200&\320M\307,\222\200\016\320\003\244Z@TK!\212j\013\203\326\236\370\327\273+X\360\217\001\232\350\244\330d\373\324P}#\336\362\251\207\3116_\326\326lj\247~\334M\230\235-2\356\001\320L\335\3247\262\225\001h\272\324J\315\3247j\021\366R\233\177\214x\2756[\330\301@i\201\214nI\375k%\266`\237\235\324\324\020\260\177\035\354\376c\324\362\353U\236\201\335D%\215\217\321\255\214\363\332"
+	.string	"\332\342\244\326\325\220\227\347\250X\253\217*_\237}=F-e\234\267\334\276\376\235\2330K\263c\304\243\3353\324\202\366o\255\315\276Y\244\375\335\t\355p\241\245\325;\355\376\255\275\271\205rg\213\314\"\375\021\333\220b\267\224\335\r\353\275\301\340\356\212\354h\367\200\036(l_e\267\270\370G\256\336\351\273G\022M\2435\037\234\307-%a^<\264L\223\207\226\r\257\022]7H\330\020\203\361\353\372\272\301\203\213r\351"
+	.string	"\313\261Eqp\201\201\350\352\372\032\346\330\002r\321\030\016\277\300d\f\317\335\212"
+	.ascii	"\303\353F\326PF\f/\032]Y6\274\264jdm\201\205eE\220\332\257\033"
+	.ascii	"\\`Y\303\257/\260\254\340;\312\306\375hvx\372\370\35024\245\340"
+	.ascii	"U\323; \326\255\254\030N\242\272'IV}\325QrG\271+f\320\r\332\201"
+	.ascii	"\025\"\026cZ\fb\026>\022\267\\a4>s0\325\r\370\007\033\211\\\210"
+	.ascii	"^\210_\210_z\247\f\372vs\032AJ\2665\n\266\2249c\222m\300\216"
+	.string	"\262\274`\313\231<\270AEv\304H\f\233\331\257\245l\360\316\267\240\351]\017\353U\235\006\341U\315]\372f\255\265\236\017^\325\013:J\016-\220\221-\001'h\005\275K\034C,\303?\3562\331\214'A\265\326\037w9p\355\220\301\302i\362y\037,\264\325Z/@z\244\020\373*\247+b\304\210\336\251\202\376\021\t#h\252\336=\201\202\177L\320S?\232l\247\232\252\321\035\2552\305\316\355\\\357\024A\177\317\003\200\266\250a,\345\fSD\251\031\021\021M\222\024:\220\002\021*\243n\021\220-d6\322$\2511\254\001mp<\275\nQ\007\357\374\212]\277F\253d\373#\001\337\b\304(\030\2502 .\324\350%\240\267\002\346\302\362\340\036\246\203nG\001 \310\016\336\177\213\031\n\266sO,\007G\341\336\360]\217u\210\327CE\331\306c\305%h\016\252M\022\213\033\222\376,#5v\334 \317\036"
+	.string	"<\262\022\210\355g\372\026\232\220!\013@Q\016\366X\210\361N\004\b\315(q\363\246\316\024np\362\372\371\206-E\n2\345o\2150\356\373I\017\277\205}\021\n\230G\024&\301\372\017n\260\260\227\n|\034\331\267\200\320\200\313\024\"\214\016\274\224\367|\311#p\374\316\323\224\035\257\241r\013\353\336\304\202\372\332\332\325\033\310\227i\"{\315\334\"\220\227\210(CP\n\263\252\347\200^C8Gn\374}\355\321kbvk\201\336xm\001\341\2719\312\356R\225\001\204\227p3F\307\257Go\371\001\255\304\207WB\330\033\020D\002Z\207\t\250):\216\b\033N6\240Y/\241\311\275VF\002eM"
+	.ascii	"\036\355\322)q\344\250\226\020\023\334|.\031*X[#\301\270\006"
+	.ascii	"~b\007W\032&\022\025\262V~\036\365\362\032\r\230\013\317\354"
+	.ascii	"\031\367\336xwY\036K\237\321/\r"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\304\016}2"
+	.ascii	"\nVP\022<@\242J:\237\315\373\346d\307[\211\262\222\201P\333|"
+	.ascii	"4\277\220\035\236\273\271\257\326\310\232,R\253P\336\347\376"
+	.ascii	"\375\377\377\377\377\333|c\366K\304]\344_$S\200\002\253\032\b"
+	.ascii	"\333$\311\027\001\013\001\032\001\367B\345l\351\224\267\245R"
+	.ascii	"\316\242\216\332\244)\2434\252D\257\n\345[\2364\272\205^\325"
+	.ascii	"\t?66i4\013e\302}\226\364\037Q\306\272\372Z\312XVWS\322wD\223"
+	.ascii	"\364\033\241H\3301=\302\215F\0302\275j\021~\304\317\347\323\221"
+	.ascii	"H\237\021\n\341\311!\307\022\302\210A\256\246@8\262\212\031\375"
+	.ascii	"\340C\351\003&\344\243\017\247\007/\362\350\323\371\016\036\244"
+	.ascii	".Uf'\035\375\346s\260\"\016v\246\214u\203\373\236\324dr\275\215"
+	.ascii	"\376\242\032l\210\0063\316\340B2\372i\320\030\254\b\006/z\301"
+	.ascii	"\177.\270\021d\213\276\034\312\342}V\\K\252\342h)\336\005\305"
+	.ascii	"\317N\234\213\211\373\335\347\363\371,\321'\203\222\370\330\210"
+	.ascii	"_\021q\261\020/\003\361\277\024\351C\037\016u\360;4\271\264\363"
+	.ascii	"\320L\2102V\007\316\023\305\2108\274o\003\373\245\314\374\244"
+	.ascii	"\341{2p\242\3642\177U1<KZ\226\265'\206\252\177&IM&\3255\314\315"
+	.ascii	"\274'\366\253\252\252^\350\233A\231\271\3002z}\306\274~\236;"
+	.ascii	"\375<;\375;u\372v\350\364\353\340\365\361\346\364\347\310\351"
+	.ascii	"\313i\366\343\304\3513\231\375Bp\372\205\313>\237\273\276\340"
+	.ascii	"\325\277"
+	.string	"\351\277\271\033\346k\303\201lX0e\326q\245\243\307\225\017+;\346\263\206\007S\346'J\256\254\202T\371P\202\243\nI\004\376\252\365:\376\243\206\013S\272\276\233\271~\2334}6r};4\3755g\372uf\372j\312\364\351\310\\q\f\037\306\261 8~\273 1\354\310\355m\0306\214\360E0'\364\345\204\354\375\264}\220\321\331\372sh\343\275\364\321\254\365\307\240j\017L;`\372.\3758.\3757tK_\214\226\276\033Z?\fz\366\325\214\001\263<\013\313\361<\275\354|d\2348\366/)c\375\312\323\304\216%\354d`\267\362\3650+\007\253\362*\251\327\277R\310w\365\301(\373f\\}/\347\267\372]\250z\255\376W~\246Y}\256d\177\013\253\257\205\252vW\233\001\241\035'c\346=\033E\365\006\370\026\350\200\252\202\331#\260+\251\356\331-\013Hj\031\205\373\346\327\324MZ\307\246."
+	.ascii	"\226l\352\276\375\222\272I,\230\324\005\320L^L\352\n`\357\244"
+	.ascii	"G+\354U\240\256\322z\006\244\025\026w+P7\301\232\240\271\304"
+	.ascii	".\265MbP"
+	.string	"\327\211\375\223\252\252UM!\353y\031\006u\215\260\347\345\025\250k\3252Y\2334\241\254T\326_*M\260\346\027\324=\\\373\007i\203e\007\203\272\n\230G\231\232\356R\233\240\211\200\375\323[\242=W6\335\002\355\235\224\317\306{5\335\036\277QMwH\363\254\270(FV\325^A\237U\353\007{\tt\312\256+\231.\202\025\355]L\367\355Q;\265DgQLW\310\372\243\345\261\236\200\240H\303+\r\334\016\r\270\224\356\327_UU\261\276\025\340\022`\236\227\252\252\362\257\200\302\363\036\336\343!\377\362\351\377\331\323\007$\330\017\244\247o\030\330?\004\354#\376\365\023\375\372\316<\375A}}=|}=<\375\275\275\3762\274\343(\223\035\335'\217\366-\n\264\306KntO\007x&;0=v\"U\315\235\003Y\2732v\")\315\261\023\t\225k\177-\354\274(\333\226\310\366Khs\205\3472h}"
+	.string	"\270\266\304wQd\317"
+	.string	"\f\227\340\323\020\327\017\230\023\244\273\022\r{\366\003\251\364;W\030/Nd\347}[{\216\034,\273\273\032;o\223\365]\354\274<\222]M\354\274Nl\347\275\305\2558\003\354\274\013\230\177\230\222Q\216[v\336\003k\354\274\005\232\247\242sG\250\365\302\316K\200\311\316+\240y\364\371|\032\236\215\235\027@2\222\252\375\272\222\023\357\337\n?\201\220QN\211\333\333\353\357\346h\210\357h\3342\244\330\263\265\300\206\367\311\337L+\354\f\005.\274Il|Lx\223\222\234\307\204\367\210\254\031\363\335\037\2361\337\024\357\3353\245X\357&\025\236\377\334\324\271Aq\336\355\220\205\363n\003\306\273J\315\363cZ\330z,\314\274\007Zf^u\214\231w\211\375!\353\334\032\003\201"
+	.ascii	"\250Q\020E\003Q\211\210HR\220\202\244\003\340\002\241"
+	.string	"!\332t\021\200\030\210\241\"\"\"\221\210\210\224\364\211\243Uk\253Am9\002E\226\b.\221O\364\341\361\b\0267\205w\037q\377\013v\034\201\363\307\026\322=\232\251{R\220\377\374\243a\302\224\257\305\275-\013\272\270\247\304\302l}Tb\334\212\3125\t\355\273\305\255zgKWr\342\007\025Wv[\217\276\317/\272\207\234\317\365\267\305d\004\002\272\271A\\\227\301|v?\310\346G\331\261\f\025\210/\302^h\370!s\016a\217\2035\007\261\017u\332\321\355!C\251\327:\233\335\220\336\265;\227p\261\030[= \006\3766\371o\317\374\267\374g\317\376\233\374\267g\376[\376\263g\377w\240l\200]\206\"\020\375\204E\277W>,\225T\231\261\341zq\305\325w\325\275\340\331z\230\024g\223\032j\2061\035bYPZ\250\001\031cdV\257\347\033\320$$\312x\031\200\317k\b-r\242\321\267\277\327\201"
+	.string	"t\025Ca7#\366\b!\013\355\024\003\r50d\031\nE!\267\313 \017\256\036s\337L\367\373\344fl\371\245\317\341\336\305\234\305\316\251\242\344/6\335\3534[\fxa\003\337\270_\2265"
+	.string	"\216\016c\023;\3736\020C\212\321\375`\2725\320\274\334]_p?a\231~\233\340'NA"
+	.ascii	"\032R\222\f2aAm\034\235\037\254\243\377\223\324\310\231\323\310"
+	.ascii	"&\360-\034\27070t\237\210\t\300\353\340\353\340\2409-\361\013"
+	.ascii	"\231K\206}q\324c\001\274\241]\201\013t\017^C \313\345\235\025"
+	.ascii	"\243Z3_\317\037"
+	.text
+	.section	.gnu.lto_.refs.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`\315\005\325!"
+	.string	"\232S0\016D\220\236I\206\003\004\262\223\006\323\330?@_\333\303|\2130@\202l\"\007xH\266d\333$\320,\002\320\002iD\""
+	.string	"@\206\315"
+	.string	"\345\007\341 \206F\020\3056vl\241E6^\333\264\330\032!\215\020\262e\n\313"
+	.string	"\324"
+	.string	"\315"
+	.string	"m\234\372db\274_Lo\376\227\370\020z\363,\336c5\315\255x_\245`^\345\353\013z\363'\361\235\232\346L\342\373\230\346>_/{\363"
+	.string	"\274\357\356\004\277\247t\035J\327\233t\235\027\276\016\301\217\007~.M\003\343\223\221\031\377\260\360\007\373\n_\013\374\007\005\036k\354T\342O\215/\245\364\n\3107\260{\235\370\271\361k\004\346`\370\005\037P~\030\230.^\272~W\370\021\004\374\026\331\257\220\376)\351\231j\237"
+	.string	"\351\013\224\277+\273\256\374\244\334\347\312N\342\276\001>*\367\025=\257\350\225"
+	.string	"\374\221\321\033\025=\021\321\217\270\017q\017\221\207\267i\353JdG\"\277\034\347G\341\033\201o\253\375(\276\030>\b~\347\275}\255K_\321\242\212R\260D"
+	.string	"\twX\037\007\353\340`\345\220\365\034{\311n\230\032\372\254\352\345j\206\371\3557\277Mu\333ons\352#\357k\277y\315\327\333\233\030\310\373\327\027z\027l\241W\352\n\275\267I\241C5\315\177\274\3575\315\021\210\277\264\327\013\310\325\336\362\341Z\276gy\302\355\360\256\016\226}\226\225"
+	.ascii	"^\352z"
+	.string	"Q\370C\\?^\315C\253\031\241v\2705\237[\023\302\034\324\372f\375`\216\273\232\337x?Z\315\303\252\261\304\211\256\346C\274'\255\346\242\370\263\352\353\240\rj7\b\025\323\274>z\374\346\3551\325\213\203A\257\f\361\033C\252w\305\202~ \002\363\377D\375~\370\244-\315G\203\372\353\3149\360\313y\232\377F\374\3350\315w\323\3467?\323\251\210\307\2769x\233\256\207\\\207\b\257\217\311|w\024G\200/\f@z\354\320\331l8}6\277\371\317N\363\233m\366g\301\375]\217y,\334K\341\236\t\367\006p\237\303=\016D\322\235\354\017\267\254\207\371\270\353\242\330'\257\267v\207\360\2629M\357\331h\276g\312>\353\035\363\231\257\230\315|\277l\326\333\345\257^-\227\365vi\365Z\311\352\2552Y/\225\263\364NYK\257\224\267\364F\201\342\204\311^\275I\220\030\351\217\250^\036J\2759\n\364\332"
+	.ascii	"{"
+	.string	"g \365\276\020\320\333\"\251_(\327\037\004\325\027\204\240\017\350@\337\317\354\357y\254\217G\316e\372q\326\250Y\254\217\246\f@_\314\250/\206\250\250\357e2\375-\217\351\001\227\305\254\2139\232\331\026\240mv\305\334\232U\001\336\373\234b\317(z\242W\334D\332%\274&\321{\327#\372|\342\244\t\223%J\216\b\3611y\350\300a\243\006\r\262O\031\344\317\027\373\371\336\271O/\332|z\3470\370\306\231\317\027\316{z\325\364L\315\206\363%\033+C\206\321\365z\361\332\255g=\275K\250\346U25\330`\337\"D\316\323;\344<_!\343\351\005B\222\273o\216\361|o\264\306i\2752N\373\272\270\354\333b\354\023\032\324\207\374\367\210m\304\307>\373\311H2\f\3714\377\213\323\357\205\354s9\354\307B>W\355\267\262\356z\253\357\314\243\266\323}\333y\336bh]i\264\3175\315K\337\037\365\346"
+	.ascii	"jot\235N4t\235'\247\363c`\250Ah\205\b!F\"\022\221@\002\021i\342"
+	.ascii	"\001\300\"\243\031\255\003\020\3207}\241XGP\334\325\214Lcz\314"
+	.ascii	",n\027M\\:\246\377\t>P\343T\363\037\226\256[\363\212\342\241"
+	.ascii	"\002\315\202\310\200\304~@z\356\274GD<\224/\340\202\3012\302"
+	.ascii	"D!\223\273\r}J\027\220\266\274\213\266$gO\0044\200\004D\343x"
+	.ascii	"O\263\017\314\035Q\002\211\353\370.\337\335\372A\235\333_g%\""
+	.ascii	"\326\332\fG4\237(\363IK\253\231\211|\274p\224\263AS\266B2\264"
+	.ascii	"\007\231t\356w\275\020\325l\263B\265\3336\033\222\220\004\372"
+	.ascii	"\321*"
+	.text
+	.section	.gnu.lto_.decls.6b8f6e46984b810b,"e",@progbits
+	.string	"(\265/\375`O\252\005\267\002\316O\304A\017S\020(\205\3514\006\244xb\001\363v\220\270\316\265\022L\004\340I\324\245\360\354\311\264\304&<r\3671\347\377\tF\031\214m\273\b\002\025F\357&\231\005"
+	.string	""
+	.string	""
+	.ascii	"\333M\022d``0\032"
+	.string	"\004A2\234\236a+J\223`p\352 ]\247\tY\331\366\226[\312\024K\rw\017\252\017\372G\351\240sp8e\231\323L\277\\\2259\202\362\241p\324\310\330w8\177gK\177G\207\376\016\225\376N\f}!\035\215\207\276\261\242\025\345\013\347\013\361\360\204u\372\n\317\350\333\274@j\020\031}a\233\276PM\253\021\"T\233\363\302\006\316\027\216\351+\\\242/\f\242\313\364T\361\260\342\204\363\205S\372 \3409\324\r-\223\322hB\220\374(\031t\356:Q9\364\355\254M\016\025\203\306\335\270\263\275T\225A^\0332\254 \020;hz|6\324\f\207\216\351y:\002\243\b\027\2703\375\240\227\006\203\206\301TT\210\b\001\023\254\241\257\324\375Q\273\240lw\016\316^\f\234\037t\321\205O\253\241khS\013\0309\234\017\264S\003\222\321\007~\321\007:\365\317\304\364\201C\364\333.\220z \016\215V\3116\304"
+	.string	"A\202\363\201S\372@&}4\027H\275Y\367GE\313z\342\220x\321\202\363\3277h\363\314\030\023\027dLp\376\312E\377G\303\256\023\025C\277P1\024\f\205r\343\316\366\236\032"
+	.ascii	"\330\324V\027\275\253\303\215iL\316P\340\324\322P5\301\371\353"
+	.ascii	"\232\376:\246\277\"\321\267\213\207\276\332\005R\323\266\373"
+	.ascii	"\243^"
+	.string	"\265\373\243~\265\322?\315\013\244\342\257\373\243\032\t\2069\003\305\003\347\257L\\\350\026*\204g\335[\213N\027\027\032\205fA\231\203r\241>\266\210.\271\275\257\"(\021t\310u\242\\\250\326Q\031\350S\020\006j]M\235\321\037(\220\353<\033\032dmj\356)C\276(\r\301\371\232O\267\330{\357{6\365w6\365\272N_\203\321\327lh\326\217\316@i\240=R7\262+5\234\261\3460\341)\301\371:\213>\bUTOC\313\244\"\2201\367\364\274q6\264LJW\331\202z\212M\241:\320+4\007\272\003\345q\235(\016\264\306Q+\324\006\212\003\225\332.\246\f@\211\222\255.z ~Xrmj\302|\215D\337\254\013\244n\270?\352u\020}\335C__\351\353)}-C_\277\320h\334\005RM\330\323\031\313\375Qq\327\375Q\321\337\235\016j^ \025u\272?*\332\274?*\272\024"
+	.ascii	"\262\035Ld\360\23084]\370ML\232'\035<\207\367n\334Y~\216\301"
+	.ascii	"a\350\3409j\352\240\033U\302}\327\211\351`\276\\DL\363\n\230"
+	.ascii	"\377\013\243\377\313\242\177\\\346x\357\307d\260\034\226\203"
+	.ascii	"o\330\016\373\302Y\357^q>g\340\374\037\024\375\006\243\301v7"
+	.ascii	"\216+C\271\303p<\353\336Km]\370\rf\203\341"
+	.string	"n\334Yv\222\346\006\343\3418\030\016\316\273N\374\006?\267\374w\215\231\273\306\223\356\235\025\246k\357&~\203\333\3345\236\245\346\226\372]\351\332{\352\355\335\004\241\177\274\360\372!\314\3779\351\253y\372\352\032}\325\214\266\3731\035>\203\327\334\037U\227\262-8\3434X\315uv\300u\273\347\272\341b\232\302\371\252\030\r\202\275o\007\365\366\365\335\016\352\3255\375\301\005R\325)z\204\320q\031\365\253\213\01798_\035\323\271y\201\324\2371\321o\336\037\025\356\307n\227\355xL\033,=\234\257\n\321W\273?\252\360\376\250\217\273?\352\325,\255\252\341/\367\202\2365\327\234pfC\3110\321\361\005\347\2536t\027\314E\205\302\206I\n\347\253P\372i\237~\212\247\325~\234\004w\341\264|G\346\266\204\263\026\241sM\323\013\234\237\316]\301X\256\023g\301M\216\235\340'#D\300Y0\223{\345\306]\231"
+	.string	"\305\356\271w3\013\376\302h7\356,\277\271{\356\275\203@\200\3509\222Wc\206\232\177\f\345\030\355\307K\260\027v\"\201\031\343\003\3473 \220.z|8?\325\242\177\305\334\024Q\233\202\313\260\024L\005[\301Mlv\235\270\n\026;\036\303Q\330\332\240y\222\245y\276y\302AS\005\207\245y\356\275\253\\\274\247\36145\267\021\004\240\251\212\022\004B}z\206\351\341\223\237^\3217\356\002\251\036\234\350\247^\032\203\t\035C1\241\310\017(8\243G\364/\353\r\017\375\224J\377\366\005R\377\274?\352S\027\032(\356\002\251\370\355\376\250\277\346S\003\263\3444\260\353\376\250\317X4\227\220\225\nG\025.\234\203tP\237\234:\316\340\374\374\245\377\343-\374\343:1\020\354\003\b\276\302Y7\356,\205-o\030\b\326\302M<M\315\255\024|R\223\333\323\333{w"
+	.ascii	"\001\202\207K\313\315\225\232\237\237\364\3218\272G\020\004\316"
+	.ascii	"D\271\201\363\321:\375\333\246c\254\013\357\3008\304\236\030"
+	.ascii	"\013\363\270N\274\003\347xnn\020 \202V0\037_/\324|4\215>*F\037"
+	.ascii	"\375\242\217\236\351\243`:\210ni\241\324\375Q1\225\224\225\031"
+	.ascii	"tup>J\245\177\235xJ*\330\004\017O-\352X\352\037!\302\323\204"
+	.ascii	"{\213\355\275=\354\210\301U9\341\214c`\032\377\327\236\245::"
+	.ascii	"V8\377\230\006\236\261\302\231r\005\005g\250\340\023\261-5p>"
+	.ascii	"\032C\377\277N\374\204e4w\220\020\306\020/Np>\272\365\363\236"
+	.ascii	"\366\177\275M\264\200\241\341|\234F\037\207\321\302\254\373\243"
+	.ascii	"\376W\315\261\213\377\236\271hp\023\316\342\020\f\362\266w\205"
+	.ascii	"3f\n\322Y\210l=\301\371\370\212\376\025\373\205\334\264=\357"
+	.ascii	"\0326:\324\304\356\242\200\021j\323\326U\247\007'\364\306I\333"
+	.ascii	"\223\315\356i7\356\354vy\001\363\004\341\277k\236O\343Y\367n"
+	.ascii	"\013S\333{\377\277u\356\034\274\261\322\345\273}x\351\312\271"
+	.ascii	"t\256\363\356\335\274_87\316ss\357\246\275\367o\333/t\367.\336"
+	.ascii	"\323<\304\330\273\255G\004Ml\270\334\320\333{\203\b\002\021\274"
+	.ascii	"RsB\263!\037gi\234u\201\324\f\356\217z<\245\217i\350\343'}\354"
+	.ascii	"\244\217]\350\343%\375\333\247\177\347\350_9\332\347\376\250"
+	.ascii	"\026\334\037\365b\021\372U\363\243J]5\367\331\336\273\007U\363"
+	.ascii	"\362b\016\316\277i\264\272\346\376\250;R\367G\375\005\243\177"
+	.ascii	"\323\364o\231\016\272@\352\257\020\375K\245?\\ \365\212\371\311"
+	.ascii	"y*C\006"
+	.string	"\347\307\240o\230\353v\235\367\355\277_n\333\263\224\254=e\357\346\016\272dCL\032\316\277\037\324\236\276\276\276\276\373A\375Q[p\201\324|\177\324\017\365\343.\220z\bh\236}\177\324?/\220z\265\334\264\353\344\340\252\375b\271fO\227\232\273\271w\263\007\027\241\3434\303\371,\350_\016T\264\257\357r\240~\001\032\337\037\365V\271V\256\223\202\213\366\021\"\034U\222\322\263S\007\254\016\037\316/A\377\236]\002\255-\302;\350_\n\324\333w)P\2575\217\324\375Q}.\220\372_)\024\3644m\314\370\201\363\177\313\376\033v\305.\031\352\004\225\265\317\366nf\370\205y\331:\303\371\222\341\033\3456\177\311\356\330G\210pa\323\026\333\273y\311\362\336K\367^\300s\357\005)\333\221%35\037\3537/\220\252\357\217\312\001(\247\031\325\364i\003\264\264(\303\351\340_\355\336\314vb\262V\216B\303\320="
+	.ascii	"\377\232\345W!\200\212\3713\234\352\202*\344m\347_\301~"
+	.string	"u\313x\027\262\332\026\007\240\243]\271\340_o\334\254j\251\036\240\223CD9\007\367\220\241\254I\324\te\321a.\222\207\240l2\220V\325\340\343W\205Y\177\266\372/\252\366\370U\025\353W\257\312\343\3176\376\013\200\034\002\215\242J\367~\324N\335\361\225\332\251!\250\241\352\310\361_\r\265\312Jk\372\243I\017\240MNJh\361G\223P\366G\225h\321\217\016\321e\373\243L(\r4\004\350\f\264\005z\334"
+	.string	"\212\276@7\032\205\032\375\250\212\037\205\372Qb\004~\364\001(\004~\024\304\377\003\374?\266?\315"
+	.string	"\363\314\237V\200\003s\1776&\307\3749\304\221\333\1771\200\345R\030\200_\212\200i\177~\243\342\370\217\226>\345\274\265\356\317k\324\253??Sd\273\325\r\257I5\340\001\252\244\212@1\360\243C?\272\342O3\360g%\034\340\347\257\212p\343W\013`\003\365\300\217v\340G\333\240\314`\n\201\037\337\241Xf\322\023\277\232"
+	.string	"+\030~\024\371\243ki\004i"
+	.string	"."
+	.string	"\302\330e$\265\306\njU*\364\243>*\325\237\272\260"
+	.string	"\374\245\226\230\372\263\006\252\324\177{\376\214\343\3179\324(\025h\2503~\002\025\222B\205\372\257\3179H'\240\202\372\304\202\332\364\253L\217bu\257\037\030\202?\027\325\235\332\251!8Z\372\324\"\205\013\317\340\327v\377\205\001\335?\252\246&E\243\202\340b J\375\300\177\001\360g\"\325\003\026\330\340QP+\024L\036r\376\271\214\332\201?\223]\030\202\262\231\365\312\005XN\215\341\307f!\362"
+	.string	"2\210\213\201O\360\353\026*\320\302\323_3 W@MR[\034-}\302f\377\305\300\205\301\002\377=<\212\212\364\024\007\341\3278\376\247(\001)\217\240\262P\005\200\276HG\300\362\247!\244\034\244\024\244=\301_]\201\353\374\367x5U\003'\036\244\"\371<\305\205~ \213\347\374X\3161\337\237KP\223\177\272\201?\205\373U\244z\364_\0302\001\376s\370u\362\317a\324\r\374\217r\264\377\376\365\311\237\323T\343\237rP\373\257\376\253\217\037\315\200jx\376\201\022\310[\265@\b\314%\007\251F\377](\372Q\253k\370\201(\376\224\203\034\201\312\002*#\275 \354\317\033\324\342\257f\240\002mR9\370U\013\240H\177*\301\237N\360\253\304\037e\201j"
+	.string	"MB\227\377\325T\r\240Q?J\365\243=P&\364\003(\r\024\004(\021:\003\r\001\352\002\235B[\240K\177\376\200f"
+	.string	"=\372Q\251?\005\372\321\247\377b"
+	.string	"\313\241\034@c\034"
+	.string	"\205\361\347\004\240<~\364\001(\326\217\236\370\321\027~\324\307\217n\375\350\217?\335q\300\257f\340Gc\370\325!\272\201\032B6x\n\024L\n\374\217\364\003\201\32076?v\363c<\374\346\353\017\314\360g\247\212\201\\\346\001\315\352\317b\352\005\376\\\226>\245\310PV\244?o\325\002\177\366\302_j\005\256\317\1775\250\024\370\325\013&\360_\027\376\353"
+	.ascii	"U\002\3779\370\325\b\374\250\325\203\376\025\375\323\024\375"
+	.ascii	"\375\371Hz\201\350\237\223\344\276\265\357Oc\370S\244\377\370"
+	.ascii	"\007\306Q\363\n\240p\007\376\332\370\253\020@\255T\007\\\377"
+	.ascii	"\277\265t\310"
+	.string	"\257\272\220Cm\301\001?J\345G\255\374i\223\377\350\037<\372\323\254?\375\361\247[\177\352\343Oy\374i\217?\325\372\323 \315_e\341O\241\376t\307\237\352\370S'\277\272\302\177\237?\370\201?=\373\177\377`\325\2576\340W\031\360\253\013\370U\005\374j\t\277:\302\257\212\370U\017~\265\203_\025\300\257r\360\253\032\374*\006\277Z\301\257z\370U\016\277\n\364\253?\277\272\363\253\277_\305\177J\347O\371\376\364\371\247w\177\232\346O\351\376\024\356O\337\376\324\371\247\315?\215\362\247N\376t\310\237\n\371\323\016\374)\363O9\360\247\311?=\372S\030\376\264\350\317y\177\266\373S\r\374i\006\376\364\002\177Z\201?\235\300\237B\340OQ\374\351\211?u\341OU\370S\023\177J\342O\023\360g3\177Z\302\237\216\360\247!\374\351\210?\273\375Y\355O;\370S\001\374)\007\177\252\301\237\006\340O/\370S"
+	.ascii	"\374)\005\177:\301\237r\370\323\b\376\024\350O\177\3764\303\237"
+	.ascii	"\366\374\351\316\237\006\377\024\370\247\372\317h\177\206\362"
+	.ascii	"g\245?M\377\024\375\323\373\347\276\037E\363\3479\177\336\373"
+	.ascii	"\263\234?\353\375\031\316\237\237\177\276\3733\232?\323\375y"
+	.ascii	"\314\237\337\376\314\366g.\177^\373\363\225?S\371\263\331\237"
+	.ascii	"\313\376L\366\347\261?{\375Y\311\237\223\374\371\310\237\213"
+	.ascii	"\374y\310\237\205\374\031\310\237\267\376\254\343\317R\177v\372"
+	.ascii	"\363\213?7\375y\351\317\036\370s\f\177n\361\347\025\177>\372"
+	.ascii	"3\f\1776\376\271\350\317C\177\256"
+	.string	"\300\237'\360\347\b\3749\305\237_\370\363\211?\273\360g\026\376L\342\317'\3749\001\177>\300\237\r\360g\002\3749\204?\217\370\363\007\177\016\361\347\001\374\031\304\237?\374y\203?c\360\243Z\376\034\364\347\b~\324\370\347\r?Z\343\307_\377\325\360_\f\374\027\206\037\335\360\243\031~\214\367\243=\177\326\360g\237\037\177\340G\333\374(\233\037\265\373Q5?\n\367\243o?\032\346\277\207\377Q\376\243\375W\373\277\301\217\202\371Q\266\037\355\362?\305\217n\371\321\265\037U\373\357\302\217\246\375h\226\037=\373\321\346\217\226\375(\331\217r\375(\220\037\275\361\2436~\324\352G\201~\364\347G5\374G\361\243>?\212\177\364\376\370\315\217\345~L\346\177\331\377\346\377\026\334\376\213\350\353\353\353\373\201\312\374\027d\370\333\006\004]Z\272~|\251\034\021\256\240\302\240\364\304\320\302j\003\314\017\300\225>\006s\3641\240\323\307"
+	.string	"\256M\033\234\025\324\334T!\340\002G\357\353L\377?6\316\037\033\234\205:\355%\255\017\342p\301\340\353g\207\266\251\303\261\205\3631"
+	.ascii	"\362[s\301\356/\356\2774?5?\253\273\251\244\0340\267\346\271"
+	.ascii	"\245jtp\f\246\364\177d~r\377\315}\356\207F+\355\255\324\334Q"
+	.ascii	"Ac[p\364\364\366\325\325\207\374$\203I\222\337\231\377\320\374"
+	.ascii	"\312\242\240\346p~\336\217\356\377\ntC\306\314\031:3Ui\250\260"
+	.ascii	"\375j\244C\370\252\260\374\312\250oa\216\264\341\341|\f\224\364"
+	.ascii	"\177\217\177u/I\355\275\251\322\346\226b\022\252\377\375M\357"
+	.ascii	"\375\360\357\\\364b\360?\357-D\246\200\275\257\306d\355\275\357"
+	.ascii	"\033\355\225\266\244\003\347\377\026l\016{\357)\247\246\255t"
+	.ascii	"\235\246hM9M\321\222\312\340\364\2465\265\233\246\276\232\264"
+	.ascii	"\262\256S\223\226\224T\323V\312\260\247hI9m\255)\237=e\337p\232"
+	.ascii	"\262\244t\235\232\366\324\336Z\333g;-M\355)M\251\fNS\264\244"
+	.ascii	"\234\246hMep\232\2624\345\264\263\266\217S\363\207\324nj)ex\232"
+	.ascii	"\2624\265\247dMe\330S\264\246\234\344\344(\005\301\225\331z*"
+	.ascii	"\323\244$\354\22695m\0323v,I\371\30495\2636\232\275\357\331\213"
+	.ascii	"-\265\343\366\306`\357\035YRh\226n\\5\2468\032LX\226\262ns\357"
+	.ascii	"\335a\006\323V\326n\212S\272;\316\211I\326\336L\230\214\366\214"
+	.ascii	"\275\367\016A\251\031\267\207\3348\245\037;6\324\213\275%\330"
+	.ascii	"\315\275g\354\255tw\334\336[i\357\375\223\332\321\334;\207\217"
+	.ascii	"S\327\214\031{_\005\315\330;\224\326^\354\215\317\324\250M9M"
+	.ascii	"\331\312\022Z\2532\245k\303h*]'\250"
+	.ascii	"\254\335\265\321hI\351)Je\033j\357}\361t\327T\225\033\234\177"
+	.ascii	"A\025\375\377\306\300]5Y\260\234\3711\204\257\314\333u\376\336"
+	.ascii	"0\034\352\264\367\024\tr\360\340\350\351m)\251"
+	.string	"\016~\201\230\033\316\n&\351r\345\306\371\264\037\230\262\256\275\267\217P\315\233,g8\377\002'\372\347\005\rA___\337\234\275\227~^\360\257\355\367\345?/\357\371\241\371rZR\177]\232S\340\316\320\241\301\371\027,\321M\236\275\271\250887\305\242\242\212d\341\334\f\252a9k\250\375\227\266%\352\311\023\234\177iO\303;mA\276\302\264d\001n\2113g\345\207\366_\226\377w\345\207\005\257\271\251\016#G\316pF\237\027HE\300\375Q\325+B\377\241\005\351`q\263\364s\376\254\004\211zS\206\363\317\312oJZ\225\337\331u\376\254\374\250\230\375\254\374\314\356\232\005\226\324\210}\375j\314\201\231R\363/\b\242\177A\r}\013\372\364\377\223\362+\213#f\207W\231\252\306,\211\030/\315\337\223\2713wh8\013u\351\265)a#\226DN\327\032\"u\266\030\231\303v\204\257k\311]\273\023B\242"
+	.string	"\261\275\237\330\257\311/\354\007\345\367\365\033\373\221\375\242\374\300~N\256\363\367\344\307\004\377\236\374\274\326\374\236\374\212\024`\017J\b\225\336\336\315\264\356\211\245J\004\371\026\250\351[`E\337\202&\372\026\374\320\267\300J\337\002\031\372"
+	.string	"\350\323\007\300\032}"
+	.string	"\260\351\003\300\211>"
+	.string	"v\350\3777\344\307\345b\212\230\030\374\343\372\t\331G~\334\341|"
+	.ascii	"\274\320\377/\310\017\210\036\"\026\246\310\017\310\357\007F"
+	.ascii	"\227\304\320\261\004\347\255\274n\271\311Q\003\347W\220\247\017"
+	.ascii	"\202\216\030]?\254_\217_\326O\353:\177>~;\260\264\345\220!\206"
+	.ascii	"#\352\251k\357\375\363\361\343\341A\03338zz\214\312\233\031\300"
+	.ascii	"\374\n\300\350Wp\246_\001\025\375\n\244\350W@\246\377\337\325"
+	.ascii	"\324\225Q\325\344u\343\203\034:\246/\234\377\237\215\237\225"
+	.ascii	"\024\347\316\303\371W\243\031\027\306V\205\363+X\242\307tE=\367"
+	.ascii	"n\212\315\315q\276u\241\271u\215i\362\004&\024&K\227\231\335"
+	.ascii	"\255\263\002\367\274uT\322<y\200=\267LQ\323UeL\027\224:ar\210"
+	.ascii	"u\251K~<\306kF\006\013\333\242\323\326#I\327\231\2301Ob<\235"
+	.ascii	"\310\350\032\303\004\252k\311U\024\021~\274\344\006\331SH\215"
+	.ascii	"\232E\375\2026\325P`\302o[C\234c|](\026!@x\3708\362\374\301\325"
+	.ascii	"5F\t\21508\306\272\360\230$.\256\314\244\334=\231\004\301\352"
+	.ascii	"Z\"\346\f\207\331\001\004J\006k\352u\221\311y\206\321\021\326"
+	.ascii	"U\306F}\252sT:\352\233\237\013u\215\312\346\027C\205\373-\251"
+	.ascii	"f\3248j\031uO\205\243\322\251mT=\025\215\032\247\222Q\361~Uj"
+	.ascii	"\336\257I\255\363\213R\373~[=\363\243\361{\361c\372Q\251r\324"
+	.ascii	"1\252\235z\247\326\251n~P?\247\237\214\037\214\337\323O\3517"
+	.ascii	"\365\223R\371\3244\352\334o\206*w\235\252\032\365\255-\355\251"
+	.ascii	"\252Q\207\250E\320f\227\t*:\236_N]\250\023\b\016\223E\005\311"
+	.ascii	"\233\026\020\"m`\264\270aA\202C5\362\3431G\314\344\350\312`j"
+	.ascii	"\324({\317\275\2338\214\252F\305\242\362\365\334\273\371\343"
+	.ascii	"\342\232\233s\314\257\240\207~\005T\372\0250\351S\340F\237\202"
+	.ascii	"9}\n\324\364\257j\271\372\345W\257\250XT/\267\006\230-Zpf\223"
+	.ascii	"\241e\f\347S\340\324\377\325-\352\232\312EU\273N\265\213\232"
+	.ascii	"&\302\031\036j\227\324L\217'\035V\227\332%E#E\215\230\336\336"
+	.ascii	"\315!Wn\346\200\371\024H\321\367\213\320U-\371\007\234\250%8"
+	.ascii	"\237\202(\372>/\220Z\301\375QO\201\021}\nj\350S\340\244\357A"
+	.ascii	"\216\276\2074\372\036\330\364=\210\351{ \242\357A\207\276\007"
+	.ascii	"\027\372\023\354\351O\200F\177\0020\372\023\234\351O\320D\177"
+	.ascii	"\202!\372\023H\351K\240\247/\001\235\276\004X\364%\b\323\227"
+	.ascii	"`\210\276\004S\372\035\352h\022.\220\372\016u\372\035\274\350"
+	.ascii	"w(\323\357pD\277\303\017}=\225\310\325\"\277\312\205b\311j\032"
+	.ascii	" bU5\006\347\033&t\225H\317\\Z\036\022\234\337\341J\257\367G"
+	.ascii	"}\207\027\372Ao\364\203\314\350\007u\321\017*\323\017*\242\037"
+	.ascii	"\244\245\037TC?\350I\237\003\035}\016r\372\034\322\3649D\321"
+	.ascii	"\347`D\237\303\r\375\b\370\364#\030\243\177\325\206\325\212\253"
+	.ascii	"\253(X\265\272<UT\276r\324\350\360d\255G\220**a\020:J\362p\246"
+	.ascii	":\033\316\332\373,\312\313X\023\316\252\224\031\24638G5\247\354"
+	.ascii	"\275;\240m_\216@\341\374\b\256\350\031*\324u\2524T\027p\324'"
+	.ascii	"\264\251\246\323\266\236\236*\215\264\216\332\264%\243\013\350"
+	.ascii	"\206H\0165\313\b\332\021\222\325\244\007\316\217\300\253NW\f"
+	.ascii	"\025\306u\252N\352\213)\252\323/\311\0267j\250\234)b\236j>\320"
+	.ascii	"\034} 4j\323\232\233\265\367\224\252\27048T&\016\232\270\\\021"
+	.ascii	"\303\371W\227\324\215\326\205\247\005g8\351\034$kT\245\264\357"
+	.ascii	":\325\255\356\264\016\3343\243\351m\205Q\363\201\312\350_3=5"
+	.ascii	"|)\235t\357:\3239\307q\360\232\272\256\275\367\234T\016^\003"
+	.ascii	"<Bu\347d\031\005\b\237\316\007\252\242\017\324\324\007\022\323"
+	.ascii	"\007j\222\227\276\341\241\242\343\203\016\316\351\233\024O#I"
+	.ascii	"\373\n\202\263\033\264\316\227%\0338\037H\210\376e3\263\246\355"
+	.ascii	"\214\232.\272\272.4i\272\324<\215\247\311g?\271\270\353\262K"
+	.ascii	"\353\3226)\233\364\231\336]g\272&M\223\256I\313``\213\032\261"
+	.ascii	"\257\2757\210\324\315\033:jx\362\201`\350o\220\243\277!\216\376"
+	.ascii	"\206<\375\rx\372\033\332\350o\260\323\177:\207\341\242\314\300"
+	.ascii	"\341\204\363\237\312i\"QahpF\353\272\210\024A{\356\275\215\034"
+	.ascii	"q>_\300\300.>\b\313\222\333\323\023{\222\202\341x\n\241vYr{z"
+	.ascii	"m`P&\264L\252\001fG2\330\022\256&\024\206\221\027NaRc\342\324"
+	.ascii	"\344\366\364\322\260\273\306\263\344\263\233\230\242\272\320"
+	.ascii	"\322\265\324\231VI\325\322/)Y\272%\265"
+	.string	"\222RI\271\244pi[z\226bI\257\244q\351\230\264,5K\265\244n)\230TJ\032&MK\263\244\315tJJ&}K\305\244]R/\327\231\262\245bO\307\322(PR0\257Mw\323`\027h\231\324\nLnrsc]S\262\3345\264\251\246a\230\361=/\227\013\346\302\2050\026'\267\227\301\330R/\257\247\334\236\036\222-\370\213\005Ov\035\223\224\r\337\300\\h\231\224\013[Zl\f\301U$\200\251\311\355\351M\271T\372\266t!\313\222\333\323\3035\330\260\025\256\"\341\205\324\372d\326\3664+s\200,\271\275/.\327\013\231\224\334\236\036\0276)\271=\275\273\206-u\202\341\274\232r{zH\330\360Z\3303eK\225\244]$\274\220j\200\031\221'\222\224\r+\301jT!<\211cK\233x\251\311\355\351qa\273d\306\232*\216\273-1\023\371m\232\027H\345\271\272?\3527\320\351o"
+	.ascii	"\243\277\001M\247_+\035\036\2173\234\277\241L\177\303\022\375"
+	.ascii	"\rC\3647\360\320\337P\245\277\341\205\376\317\235\376\217\234"
+	.ascii	"NB\347\355\013\033\316\377a\323\251\021\264+\345\"\341\205\024"
+	.ascii	"\ns1\236\251\021\024\n=\202\226I\2550'#-\222\036I\221\\gj$\035"
+	.ascii	"r\324\005\372"
+	.string	"\302\311HJ$\327\231\"AIW\263.\307\0333:\377\347L\377'L\263\251Yq~\301\371K\372\204\236\301v<K>{o\245\3413?\372\005\245\303kB\b[\302\222\345\222\241\315\256_\225-1\317\313vv\257,\205\261{\232\213\262\001\200-\021C\233l\201B\206&\r\252f*\0040\271\364)\303Ie\240eR\r`b\363D\315\236.\231{\005mv\375\254l\251y\242N\322'\364\t\032\245*\2031)P\230\350\3410k\260<\367\336>r\222%-\023\300\250\234hn\232f\\P/aZL~TI\372t\315\334\265\033\307\265\227\224H\030\223\323r\3112\b\223\222>\241\317\234\265\2512"
+	.ascii	"\323\332G\231\\\271W\302\344\2400\321\253+\313U\266\006\360d"
+	.ascii	"\013\024&z\350\224\0375{B\251\240Vn\334\325Vj\023\302\030U3\203"
+	.ascii	"53\031\t/\244V\032sQ\236{7\323\247\354\314y$\274\220Za+\f5KC"
+	.ascii	"\267\314\271=\321/h\033jf\353C\030\025\024&z\250\223\364\t%C"
+	.ascii	"\245P}0\266\004\n\023=\274$}B\3530\034Z&eb.\313\230\364)w\345"
+	.ascii	"/\022^H\255Qsgi\217\364*\325Jy\2444R\254\264*\375\221\346H\255"
+	.ascii	"R \351\215T"
+	.string	"*\305\221F\245AR!iV:#\335\221n\2456R\035)T\352#\245Jk\244S\327\231>a.G\221\240I\202`K\317\250\022r\214\036\034ZXo8\377\247K\377O]\244M\351\213\024\306u\246N\351\322\321%\250\327s\352\224\356T\211\247\311g\357\255\"\251S\236\223\353\240eR\332\212\231\221\347\336\315\021\"\244N)\323\275\302\243\344\263\231\346\220t\335\272\324)\353e\276\033\307\265\367T\bM\266@a\242\267\367N\361\216L\241\003\346\3774\351k\220\223*\375\267.\367\345:8\332\340\231\341|\rn4\336\0372\235f\217p\311\206\02628_C\032}\rq\372\317{\317|\177\006\313q\260\335\325\013\303\304\t\316Y\216\320\363^\005Y\330\326p\376\335\037\365\032\300hTC\027\235\337\364\374\020\262d\006\347k\230\242\321\362\032\332\3542\301D\343\231\361r\233\353\314n\336\344&o\311t$\274\220r"
+	.ascii	"\323\214\247\233\314\346o\036\230\234\366\222\217\017\224\354"
+	.ascii	"-\331\222\253p\201\351\241\3635\304\320\307g\340:\3348.\005,"
+	.ascii	"\271\3226\007\366\334\273I\227\271d1\036\230\234Xh\303\022w\266"
+	.ascii	"\263.9(O2\037n\334Y\t5\261\347\336\315L\227\313\234\215\247\311"
+	.ascii	"g7!\371\312tyL\007u\b\021$ozk\362]>\223\353r\232\254&\333e4\327"
+	.ascii	"\231\351\262\231\246\264\n\025=>\r\371\031\246\350g\030\323\317"
+	.ascii	"\320D?\303\021\375\f?\3643\360\320\317`\245\237\341\351\355w"
+	.ascii	"\r\332\006\213\022\033\271(\234\357\263\007&\207\271\316\354"
+	.ascii	"\226\331\272\344/?\354\272\334r[\376\242\301NM\020)=TK\335\033"
+	.ascii	"*j\276\017\230\376\363\227\354\245\316\030\217:8{\311l<Q\222"
+	.ascii	"@\375\300\371>>\364}r\350\373T\351\373@\351?c\261\222\317\262"
+	.ascii	"\232\006\2341\334`\340\234\265\344\264g\265\234eg\265\020\262"
+	.ascii	"\366^\312j=s\366^\352\271\367\202{/\310P\266\222\240\251\371"
+	.ascii	">0t\276\"\364\214\305\005\027\024\025\316\034\334\037\365>[\277"
+	.ascii	"\207O\343\346\005R?\334\0375S1[6\271\363af\212\031J\344\231\246"
+	.ascii	"K\312\263\231R\335\2253p\372=_\364X\216\"\2666\261r\256)\033"
+	.ascii	"\023[\351\304\264\300\t{\026C\363\260\202\034\361\"\273\262J"
+	.ascii	"\303\371=N\364\007\367G\315O.\023\276\236\035\372\327\231\235"
+	.ascii	"\344&Mr\244\3001yn\362\217\020\341\222\335\260\273\27188\347"
+	.ascii	"%\331KwE)\271\360\352\322\346V'\207\222\265\215\2311\\J\360\032"
+	.ascii	" J\264\204\341\374\036\032\032H\020j\245\t\f\037\271\316\214"
+	.ascii	"$k\235!\311[\331\210s-\216\027\341\216!g-\033)ri\320x:\341\234"
+	.ascii	"\211\254o5\254\300\340|\2361\372\317\\\327\231\207\334}\360\341"
+	.ascii	"E\205\363\363\262\220\377+\026b\206\315\036\316\177\026\362\034"
+	.ascii	"Dj[\301\2013\220\337\335\224\234\224,?\262\026\366\261Tf\n\347"
+	.ascii	"\363\240\351\363|\351\363x\345\036\270n\354F\025\234\317#D\377"
+	.ascii	"\317;2\217\353\314X(\234\243w(\233\007a\241n\320<\236\246\346"
+	.ascii	"\236\372\245i\203\205\306\3119n\334\225\317n\272\243s\253x\251"
+	.ascii	"\343F\315\371)\337X\323\205#_e\035\327\231s<\347@\365\262\022"
+	.ascii	"\217R\206\275\203\314\351\312\221\227r\f\236\246\346\246R\331"
+	.ascii	"(m\020\035@\200\bB\001\341\241\244\363\377l\225"
+	.string	"m\\g\276\221kD\345\252\033w\325\334T<W|\324\301\321\273\221\2412\r\017LN)t\251{j.D\272\fQ\363yt\350?W=S\355\304H\363:\203s\236\002Z]\305u\301\371<QY\352\227\206\022\027n8\237\347\205\376u\336.\317\370].\362fc\f\347\363(\351\357\354\351\357\300\321\007!\307\310L\371\305\215;+\001w\367\314NY\306u\346\030\031F\216\201\312\t\303\346\311\223\304+lL\315\337Q\243\363\223&+bpv\221\233\366\316\316\035\0176&8\177'N\177\007\214\376\016\033\332\227\367uf%\264\316\357\032\264\315\203\232{c\311J\350\036J\307\003\223\223\nX{W,+\241r\356\025\036\245\346\216\n&QR\007Go\357f\020\b\020\277\037[\310\210\250\371;D\002]r{Y6\326b\340|\004x\021\342\270p\207\020\307\252\026lb\001\311\322\"a\242X\341,\324!\314\201"
+	.string	"5\341\r\341\r\341\f(F6\334@A\261\262\022.\231\271\375\266\240\231\212\303\371\b\370!\214\022F\t\253\266\320:\240\205\313\020!\325\205U<U\314\314\270\341,\234\n\312\341\202\025\007g\241\024\002\244\2041\2041\2043\256Y\222\252(\332\n\332\016\035B\250\013g\334\365H\201\n#\007g\341\323\352\343K\f2:8\013e<\255MJ\226'\316\317K\301\340\242\346\354\315\0216\t\233\2040\202\364\036\333\272\362\354I\002\206\245L\370\342B\030<|d\336\314\300Y\350\"(gI\310\033\232\276>\341R\220\336cfa\236A!;\350h\b\225.\\\272\353\371\252s\305\ng\341\016\023\244\023\244\023\274\003S\025e\207\313\230\234\034\234\177"
+	.string	",A7A7A\276-gU\224\364\306\225\3303\270\367 _\223\031\031T8\007\341\004\345\374_U91\322\250\310\321\313\322\353\252\322\322\363\206\356\t+\030\0077\241z^\251\3029\230\367\264\235\270\246\215\0318\007\337\244`F\200D\261\201s\020\357\327\003mN\336\357\016O\221\013\213\013{>\203wAY\350\\\224\252(_{_}"
+	.string	"\016\371\241\206\255H]]\360\356J\331Q\036\300\332lu\271q\224\360\312\202v\017\336\245\371@\203C\b\316\3015O\323R\206\246\310\001v\004\321\004\321\004\323\004e)\345\251^\240\204P\241n\\a9\202i.\231\022\257-(\234\177"
+	.ascii	"\250\270\007\313\304\005\351~]\2026S\323\306\032\362\303\027"
+	.ascii	"E\247\247\267\235v|(\n\322\343-h\346A\2727\265\217\212\232Vp"
+	.ascii	"\356w\306\214\233\024\234\203r\251\216\252:&d\376U\310\365\006"
+	.ascii	"\347\006\347\233\340E\337\2044\270\037\016X\027\224\205\336E"
+	.ascii	"\315\301i\333\373\352C\003\236\214\271\302\371&p\005\257<\230"
+	.ascii	"\366_g\360J\360\r\235\273\315}\225\245\324\246"
+	.string	""
+	.ascii	"O\242\344\266\350m\247\253\017<Ol\264\200xy\360\355A\267\021"
+	.ascii	"\"\334\016\031\244J\025\234\203a~\207\340Uq\302\371\301\266 "
+	.ascii	"\230\177]\225\254\301R\007\347\233\020C\007\277x\360=\037s\202"
+	.ascii	"l\267\3033\2664\341\201s\260\313\331\354`)\343"
+	.string	"\nr\371\277\242p[sL8\007\325\202k\327y\267\340\2267{x\266\3000aI\377\336M\r\301\275\233\032\314\362\240\226\177]\267`\001\321\302\371\006\330\323\177\020\313\277\376\320\350tt\341|\003\344\351\033\340N\312u\006\245\004\235@)\024\230x<\237\204\331S\n\236\t\227x\370@\263\306\327\304\252\312\203V\376\240Yp\312\221\031D\320p\016R\021z\260\312\232\0266\346\007\316\035\200T\t\356\217z\003\230\321\177\260\031l\352\033\330g7m\221\251m\251\253\016>0\345L\363\022\374z0J\360\013\211\005O\266\260\310\316j\340\034\024\013\216\005\303\202P\202`\0060\013\026y\260I\260H\320\311\t\r8\241\315iyn\251\035\035\340*\035fe8\307)C\304\b\316\301%A&+\027\250\271\0358?\350\305%w\244\t\316X\311OL\252\311\211\363\203](\2357.I\376\257!\250\363\001\206s\020\211~a"
+	.string	"&\034\254j\244\330\025\t\032y\020\311\037<r\267`(\035Wlp\346\271?*\260O\350A#8\311\231\233\033\3167@\016\375\007\207\004\207\254cR\360\331{+\214ZZ[\227'\3167@\023\235\007ed+\371\354:\201t\202B\204\230\366\322\227\tcL=r`\244A\203s\220\337\322\031:08\277\2048\372W\354)8cM\220F\335T\260\352\306q)\300\311\030TN\020\312\003\223S\nbj\236=\202V\301\0357\356\312g7i\321{\232\005{\004\245\240\240\361\021\004\022\374\021\324\nb\005\263\202[\327\031\354\021\254\021\354\021\214J\363\334\273\331\363&\314\312\r\237\034|\272\235\007&\247\024\242\334\005u\004y\\gp\307\203;\362V0G\001\340\242\236\330\350"
+	.string	"b\307M\0314:\324\374\007s\004q`i\n\301\3039xuwu\303\315\005\316/\341\213\376\2036\2563x\343.\357k\215\357v_\210l\255\351\2270E\007\251\264\231'\0178\234_B\024\375\022\240\350\227\340\245_\002\022\375\022\206\350?8#\b\225N\t\363\006.\bu\257\34091PL8\277\004 :\370\"\350\024\214\361\257=P\324\202\\\301\371%\360\320\017\302\370\277\272@d\314\025\234\363=\233\032lz\320\305\277b\267$]3p~\tW\372\301\245 \323\277\362\240A\342,\303\371%H\351\007\225\256\364\275\301\201sp\353\027%,q"
+	.string	"\344\241\245\207\216:\017\356\037\330\207N\211\241\217N\034\234w\356\217\212\335\204\016\254\003\347\345I\206\363\013`\247\177\301.0\017\230\007\344\013\241\r\336\216\016\322)wNl\354\t\263\234\330x6s\01643Sp\006\312\001\352aT\310T\232-\234\201q\324\262\034Mj8\277"
+	.string	"c\200p\316\360\360\352\232\266\224\370 \322\246\r\034\317[\335\326\032\316/@\024\0336`v\310\310\350j2\307\316n\355\303\362B\255F\016\234O\002^\2324\300\272u\357\275\257LhC\326\325\2276G\246\346\300\2724!\332X_\333\331\254\326\302\304\340|\022\336\344\344\200g\342\360\334`\312Q\332HA\321\035x\246\013\233\2156\234\201f~m\302\fq\303\031X\346\256\2259\003\243\rg\340\334]\343\341\341\374\262\"\241\212\376\201q\300\270\013\244z\3408\341Q\004\347\223"
+	.string	"\005\016\216H\017\375\003\337\200oC\272Hh\n\023&\217\211"
+	.string	"k\276\264\345:`A0&\002p\321'\300\027\033\033\037\027\002hmi\002\271`8\275\225\354\275D\004\370\305\214"
+	.string	"P\372#\274\321?P\r\250\20677B\334\025`\026\240\026\f\347\263\345\366\3125\246c\2044 \026 \226\325\314}\226\270\2140\246?\302\2313\005S@\214\275\265\216"
+	.string	"\277\314\215\220C\177\004'\375Kv\201T\376\021\""
+	.string	"\233\300*\227L\001L{cq\001\301x\211\320F_\2046}`\363\002\245"
+	.string	"\233@\263\\\347n\252}c0aC{\212`\246/\202\021\375\233\353\250bb@2\340\227-!\f\272\260\035\300(\007\222\001\311|\235\321\301\0318\246\341\324\322\204!\203\363\363r\235\377\353\220\215\210\036\316\027\001K\003\277\200_@(y?%U;>\354\324\211qC\006\354@(l3\242\354\216\210@\303\211\223_\332\332\264\227\260~X4\316l\321\313\362\265D\006\316\017\341\214\376\201L\256\023\310\344\227\205\353\327F\203\356k\375\3017CN\312\221#\300%\026\354\275_\354\026qO\212<\367\325\325\007\t4\241\362\005\250\344\300%i\267LK\r'\234\201]g\313\262\246\343\ng`\022\r\327\243&F\316\024\234\201HB"
+	.string	"\323\300\"\300\"@\247k\202W\235\256}u\365\201'L\031\016\0348?\204 \0328\0048dU\272{\217\315Q\221\222\005\006\347\207\200\245\177\240\020\240\220\273\366a/-i0U\025\202\f @\364\215to\255\253\f\236l\2510\250\370\344\340|\020\344\350\037\270\005\334\352\303\003\201N\377@\037@\037\2772\241\246\375cL\265A#\n\223U\f\231\274(8\037\204/\375\003{\\'\260\207\266J\233\366\022\230J\005%\204\n{\235\005\261\302\371 h\351\037\310\003\310\303\202\2749\020\246\364\017\304\201\003\250\343J\351\264\264\272\347\226jv"
+	.string	"\314\241\302])K\202\363G\360\351\217\210\323\277\212DE2\247\205\304\201\013k\252\315\036]\007Z\001\255xta\321?\260\nX\205\341T)\024\322p4\365\017\234\002N\201\251\215`\242\177`\0240*m\307s\004\021\375\003g\\'p\306\017\210\006)\027\222D=G\350\320\277Z\246\226\025"
+	.string	"\317K\206\214U\351\322\231\203\243\367\265\257\256>\230\260&M\031\316\0371C\003a"
+	.string	"a"
+	.string	"\235\364\316\333\322\222E\245\013g\240\223\034\023$}\372\007\272"
+	.ascii	"\272\220\363\024z21\361P\313|\344\235q\003*\001\225|6S\232\253"
+	.ascii	"\256-\317\257\0378_\310\212^\353\254u\326\276\0246\005SA*40["
+	.string	"p\356K\343Z\362\303\211\363\205\222\350\257|\367z\271^\336\356\275\242\376\267K\227\273\206}vS\224\230\256\233\345f\271k'\264\214$p\317\257z\253\036\037\236P\0177+\0347k\036\036\336\232\3073\305\324Cg\303\215\2137_\363\260\330\22423\204f\350\177\360F\377\353s}\312a\222S\263\336\251Y\355\352\352V;8A:f;g\350\250q\255\371j\227\207\254\261\252#\223A\305\005\013\347\177pE\377\203#h\320\3201\373\340\212\314JGf5\243\312\311\255f\356/\016\027\f\007\312\211F\231\257fP J;\336\340\274\316\361\250!sR&\"\216\276\21048\270u\314\235\332{\351*\2031\246\035%1pq8\217\371\301]8z`4p\276\210'_\326\267/\253\233\332\326\266\272]8*\333\226j\004\307\326\2330_\335\356r\031>\031i8\257`Dp\351\213\240bc\213j\353\332RW\035"
+	.ascii	"\263\324\331\370\201\363CpY\271\\ \007/h#\207\2318\234\037bL"
+	.ascii	"\226u-\313\252\266\201\226kY\325\326-\265\367\325V\212\243\256"
+	.ascii	"\255<\350\324\250\245}U\263\242\206\f\227\020f\372!\262\254\254"
+	.ascii	"W\254\254hgg+\232\033\236"
+	.string	"&\203\243i\312\371\025-\204\222\276\007nT\250`\027\032\244V8\243\346)E\377\253\331jF\307\003#\372_\313\3262\273\247\0076\364\277\222\255d&\320\361\312[\233\254ak\223ul\025\373:\206\212!\3425\005\347\347e2\257\253 8\257NV'+\224/f\277&k\234{8\257P\352\270\271\261\204\363\372u\327\240\350q1\301y}r\257\324\261q\333\202\363\363\356\225-8k\322p\376"
+	.string	"\332\364\007\300\304\313\253\317l"
+	.string	"7\224(A\362\242\243\3775\311\232d\257\2034\372_\217\254GB\300\004G\357\253\0037\375\257E\326\"0\254\270u\260E\377\353\220u\210\005r\274\312\204\b\301GR\253\260\027jp~\007J\200"
+	.string	"\301U\250\323^\332\312 \216Y\0079x\360X\267\304\202N\270\234Y\323\372\272%tZ\312\033\303y\305Z}\364l9\323\330\360\221\365[\373\301\265\324\0033\t\347\350ps\246\307\315C\231hA\211\353\300\205\376W\252\353\\\251V\035\032\244V8\023\366\\u\2549\200/\356b8\301\031\307\007\360\346d\341|\020p\364\377\325\306z\343:\327\253\265\006\b\353\325Z\205\263\3202\251U\206\220\034\317\365j\265\302Mx^p\364\364zt\350"
+	.string	"\263\242\346\203H\243\017\"\214>\b5}\020f\253\214\313X\245\256\224\035u\347\336\256>\360\324I\343\266\243\276J\245\001\251\314\001\262\006\347\365i\245!\254\362\241\227\266\322Xg(9B\343F\217\274\260;&\234W(\234\303\216\006\2339 \230\350\177uZ\235p\225*\265\322\020\002\005D\226\376\327\027\327\271\276\300j\253\323\336U\026\304\251\002QC\377k\323\332\224\202\245\260\227\246\006\320\244\255\2035\b^\016,8\037\304R\235u\251\316\252\244\356}\233YQR\373J\352C_\337\252\244\225:Xy\001\223\234\225\t\303\371_\367W\245\273#yzD\360\364\005 f\316\234{\345\372l\2463h]Z\366\366`8\005`\246\247'\207I"
+	.string	"`l\330h8afy\327p\202s\272\332T\301Y\2779[\220#nV8k\274\247\335\2657^m8k7m\236\002\030bg\007\003L\227\217\272\272\016\b\240F\2324$<a\022"
+	.ascii	"\f\375k\272\353\324t\372L\352\2647\325\007|f\372\314q\026\016"
+	.ascii	"\023w\206\013\347\013@\351\355M\227\341\001\234\232\273.s\327"
+	.ascii	"\200\027B\266\340\254\345\316\246\216\241#\327\205\263&\363\264"
+	.ascii	"\"nbN\234u\334\265`\030Uf\342p\326cR\270 6\232\032.\b"
+	.string	"\227\203\n\215\206\323bR4V4\220\250`7\366\005\347\177X\023&\214j\205\245l\252\030\240\330\264}\355}\325\301\216\022(T\230p\376\007\272\266\266{\345\203\037Z\024\331\363\303\232\027/q\346\276\272tyZnn#W\316\026\034\275/\256-[\n\020\207\313\007*\375k5\255\246R\371\020\222S\305\001\035\375k-\327\251\265\334\265\264ig\rQ\353@\325\331\323[mX.p>\007T\250h,\277&U\372\3125\026\255We\r\021\2345\332\331\376\257h\022)|6p\326U\264\023K\216\225\234v\352\263+v1rDuX\275\\8\211\202\263\266\242\272hR\365\366\002g\016\304\314\314\236\226}\366\023S\217!eeO\373\272w\233\034\265\032ddO\273R\021T\245\355xr\26046v\257\004m%7\027\340\315m\260F\377\032\354\327\251\301t\030\226\262\225z\322\226\356\234h\271:1\340\340\254\241"
+	.ascii	"\323\256\\M\341\374\r\274\350o\220\305\211\023\375\004K\375b"
+	.ascii	"\366\274\353'O\273*\"\205\3637`\242\231h&?4z\213\231\263\240"
+	.ascii	"\007W\035\234\277\001\226\376\365\222\353\324K\3227\253\323\336"
+	.ascii	"T\0264\341r\325A\017\235 p6\316\337\300\206\376u\327\257Swi\034"
+	.ascii	"\250S\326\2362a\255y\325\001\017\035\264\036ep\376\006SH\220"
+	.ascii	"4\301\333\200\206\021#\367JP\226\222\033\013\364\240\330\264"
+	.ascii	"\351\355\335\326A\246\303\206n\b\316\327@\215\3765\021\247&\362"
+	.ascii	"\264\024\266\2132\022\370v\007\327`N\377\232\313\251\271.Y\320"
+	.ascii	"V\302;@\036S\263\203k\300\246\177\350\037:\210\336\2771Lp\364"
+	.ascii	"\276\366\225\324\2074,k\355\251\201\334\311Q\245\3318_\2031\235"
+	.ascii	"\343:\207\326\272\317\336\233io,\036?\2669\251\017\277\336q\255"
+	.ascii	"u\355\343\001Vt^\340|\335Cg\375+\346Ag3\301\371\0328\321\232"
+	.ascii	"\207\306\372\277f\200\205\212\t\347"
+	.string	"c\r\212p\360\363r#\006\037\260\213\317\b\022\234\265\216\f&%\316\016\234\237w-J\274\304p\202\3635\300\322\372\212L\2271(\234\257\301\r\255md3t\373\r\316\327\340I\353\032ui}g8?\203=\375k\252_\247\246\322R'\356\216\221f\326\343\271\367U\007A7>\247\033\316\317`\214\376\365\224\024\032\030\027;\234\243\360\205\023'\312\016\234\237\201S\377\262i(\rC;\241M5\255ek\307\023\352\207\247\227\266\006\340\265\304\215\232\236\246\241gh\031:\206~\272N\r\245_`\321P\332\205\327\222\034\223\227\226\0335=\r\245\233@\240r\243\266\303\005&\313\026\341\0247:\264\215\3633p\242\237A\226~\006V\372\0318\351\007\200O+u\020\242\275\310\202b\246\316\257\357:\365\376\275\251\243Z\3358\256\024\240\270\351\235\302\371\321\271q\\)\324y{\346&ydyj\236\203\2052\364\306p~"
+	.string	"~{?\275\237\234_\234\353\374\361\375\362\316~p\322\314\262\004\354Q\005\261Ej\201i\024\202=2\266\355\220\330\036\331\022\354\221\261\r*\217\212+;\f\022!\215\304%0\305\006\r>lK|\241e\213z~\230G\244\244\021\363\2475\036\031Y 2!$\321\262\3542Y\024Q\004b\2528\201m\211G\244\342\221X\234`\210M.\223\2126\364\334(DkD\252\240D1\244\341F!\230\313d\233\\&\333d\013-[\264\323\032\221*d`\217m\233\\\032\245@&\r\005\211\332%\007\230\251\211\023,"
+	.string	"\001\2318\301\202\211\023,\264F\244\n?B)N\374\264F\244\nH#\021\205\235\241\241\023|\036`Tl\223.\264,\n=CH\242\212!\"[\202\210G\t\201!\366\230L*Q\030\217l\nL\343\221X4j\211G\"Z&2YL\211Z\244qyTo\024\242\370B\313\026!\215\313\226\031\301\361\210\204D&\221\277v\310\306`d\252,\222K\2436\211\374\021\021\331cNR\026\217\330#\225\311\036\021]\0302*u\2222I\202gHl\211C-\313\344I\321!I\231$\001\324\336(D\221RD\221\362\247\210D\n\246\314a\221R\330\016\221E\312\024Y\244D\217*\033\203\221\231\223\224\311b^\266Jt\210\375\r\261L\244\314\374}9,R\206\330IZ\266Lc\021\373\302\216\222\330B\013v\b\251B2\005\223h<\236P\\F`\342D\n\024\264l\221\004'4\244(\241#\340"
+	.ascii	"\2734A\244d\001\2314\004T\2044\036-\211A\023'R0q\202\005\025"
+	.ascii	"' \223Dl\t\016AB!$\300\016\031\231-\222\003\330#\003\230\304"
+	.ascii	"\243\004\313e\222\3041\t\0044\"\304\321\222mK\260-\221\203\361"
+	.ascii	"\304\217O\206\017Bh\350\001!\304\222Uq\204\344\002{D\\\232h\231"
+	.ascii	"\304c\206\bB`\221\212L\366\005\246\262(h\203\b!\332%\261E\301"
+	.ascii	"\016%[\210`\311\036w\220EF\0247\n\301,."
+	.string	"E\024=\f!\211GGI\022\305\345z\243\020K\266\205\361H\004\223=\022\213(Z\030\217\326!\243R\267F\244\nCF\245\206\337\013?FE\306\0244\210(2\022!\221\354r\211T\314"
+	.string	"D\302\247\035b\217\222K\023DD\022\254@\252\360\223\324\032\213\311#\033\201\026\304\243 \322HDa\345\331\0312*wLl0\361\323\262(\f\031\225\034\222\312\026\f`W,\221H\364d8Z\262)J\004\235\220!\202\226E1dTR\260\301\202\0278H\".\227'pHR\002-`\303\221XL.\225\306\"\373\002\005\023\244\0302*1\250\200m\211CJ\b\f\031\225\032, H\250=Q\2044\242(.\201\206\330\030\214G\242\2615\"U`Z\340\201H\311\002\273\302\330\022W\030\227l\211\026iL*[\026E"
+	.string	"< \215D\024:\260\314%\273\002\251\002\fF%\n\"\242\237\226\231L.\200\210h\247H\324>&\216G$d\017\322D\004B&Jlh\205HC\236U\370\023\0342\236\310\300\363A\210vIT\206`\016\031\225@\2542)\005\017\221\222\005\026k\013\342\221}\241\247H\374\025\211\302\244\"\222E\342"
+	.string	"\27341dT\n\211\224,\024\211)\tV\305\206\224=2\246`!\bi$\242\320\003\304\266\304\026\005\323\330\342\004\342\206\033\205(\016\331#c\213DZ\212(\022\001\200YD<\232`\207\222-\364\244H.\213'$\035\225J\242O\322\330\022_0\241\201\311\262\313\"\266\004\211\r\031\330\241d\013\fh\217\306\024@\355\220\271d\217H\f"
+	.string	"b\207\220Zc\333\022\265Q[\204d\227-\212#\273\202e!\205\342\221X\fb\016\221&Z\226\311\276P\244\0042*\177\311eRQN1\204o\024\242\bI\005;$b\350hDR\301\016%[X\221F\"\nE\242\372\302\016\362\204\243%\333\252\300\201\311d\213E\242\212\001\020, \224\001\f\200`\201\0172"
+	.string	"\\&\333\"\033\001V\330\266\355\021\3332\223PH\320j`[\366(\t\024\203Q\261H\004\026\213Da\333\016\211\330\241\0167\n1\304\266\354Qy\224$\261\2019A\t\240\344\222\255@\261H\374\231"
+	.ascii	"bA\244\300\321\222m\225=\032~N\364\274h\\\262H\266H?\204\021"
+	.ascii	"<\030\201\204\026\277\223P\302\007%|\240\236\204\022\204\204"
+	.ascii	"J\030AH\177\004!t\204\020#\b\t)\217\330v\330\262Lv9\004Z&\227"
+	.ascii	"K\0060\215-\210kKL\036\211\322\026iD\203GI$;4d2\331br\251\034"
+	.ascii	"\016\031\225\031\330\"\222]\262D\354r\303\215BP\300\034\026\031"
+	.ascii	"\211\220I\022\313$r\311\256H\026\371\260CI=\304\262J\346\020"
+	.ascii	"\221]\221,\312\240D:&\223J\346pE\262\310g\270$\262E<J#\260h<"
+	.ascii	"\026\2234 \215\304\242\b\220Fb\321\212dQ\005-\323\310d\022\207"
+	.ascii	"\313d\233<:\032\211\355pE\262\250\0032iT\201\210\b\250}1\304"
+	.ascii	"\220QI\264\002f\016[$k,\032\211\210\330$\211!\243\322G\271\002"
+	.ascii	"6\256\200\207V\300\255\006\346\360\304\220Q)\214\301h\310\202"
+	.ascii	"\230\304\023\203\321\320'\006\243!\236\2269$\0322*\325!\243\022"
+	.ascii	"\315\320\"\331\342\222=\321\"\215\311\023J\244!\244Q\002\034"
+	.ascii	"\202,\210\024h\215CF%\017{,B\236pdW\260\307\236\266\310\022\021"
+	.ascii	"\375\260C\311\243a\273d\225-\330a{4\266Cd2\006\3432i\024\364"
+	.ascii	"\002\013bR\206#[,\236\300\266\304%\0172il\215L$q\231bhId\261"
+	.ascii	"L\232\030bY\"\240\326xdd\001\030\203\3210\003\017\253Lj}4\264"
+	.ascii	" \036\331\2451x,B\022\203\230\306\026\304a\021\222\nv\210\003"
+	.ascii	"\322H,\312\300<\032\016\021Y#\"\f\311\344q\270d\221F\342\262"
+	.ascii	"\035&\227Eb\007\244\221X\344\303\201\210(\331\"\025\207\307\344"
+	.ascii	"\262E&\213C\246\n\242\006V\231\324\016Gh\210\301h\2104\306`t"
+	.ascii	"\264d\333\241\r1\030\227D\026id\241\375i\231\311\244\212!\021"
+	.ascii	"\221f\217\210.\260G#Qr\251\f*\231C\266%\036\223\312\026\304\243"
+	.ascii	"!\021Q\206\326xd<\016Y\030\214J\346\220\210\210g\231l\213D\242"
+	.ascii	"\241Q\233L\0361\207DD>Ie\013v\310\256X\"\025\207D\312\343\020"
+	.ascii	"\2314\244\201\211d\225G\311\342\260\210\310\034\266D\025+\200"
+	.string	"\210V8&\211V`\231G\244\023\307$\t\026\304\244\035\242\025\212I$X\020\223t\313DZ\032\245`\231\304\005\260 &\355p\200]\022\rY\346\021Iyd\034\022\021\r%`&\021Y\034\211\032\330\226\270\034&\021\213\354\320p\231\\.Y\037v\205\261-\262\307c\2628d\221\212Lv\231\001i$\026m`\217\214-\213\344\020\322\310b8\\&[\342\n\366\310N\320\022\261C\303\226\303\215B\260G\266X$b\300D\0322\217\214\313\024F\305\326xb\by\302\361\230\\\376\260 .\321\033\205@:2\036\217\311e6*\266Fe\312\202\230\2042Y\244#q\205\332\336(\350\310\310\302\021\022\n\2259$\266\304\022Lc\213\023\206\214\312\235\023W\205[\342\232\270GH(P\3460\271L*R[\266hIly\332\341\b\020\330#c\253L&Y\340!\"Q\342\204\340\021\022\212U\002C\354Q\005\021\311"
+	.ascii	"$\213\344\020\007\241\024\302\033\205\320 e\016\223DF\023j;d"
+	.ascii	"B\200=2\266\232\t\201\226\311\262`\221\232\251&\211\214D\271"
+	.ascii	"\355\031\376n\024\242-\"-[\346\b\346\260\005\333\"\035e\200\241"
+	.ascii	"\230<\016\207j\213DJ\026\207\303\337\222E\262H\016\207?\346\222"
+	.ascii	"e\"!\207C=\2044\3020\034\252L\244Q\311\034\016\177\310\244\221"
+	.ascii	"i<\262\303\341\332\016[\246\361\350s\243\020LV\231\324z0\304"
+	.ascii	".\211FL\017D0[\243\n\021H\310\"\017Z !\215G\017B\030a8\002\t"
+	.ascii	"-D\260CH\307\"\322(b\311D\022Q\200\266\005\213<\022\221K\266"
+	.ascii	"E\032\207CDvi\324*\207C\016+\330\245r8T[\246\3618\034\252\304"
+	.ascii	"\22684\034\252K\242Q1\2631\030\231\303\241\nC1y\314\255\021\251"
+	.ascii	"BkD\032U\244"
+	.string	"\312\004B\232H\022\031M\f\021\331%p\331\236(\"\221L\020[b\211!\"\373Br\231\204B\007\244\211\235\033\2050\266-\330%{\034B\022S0\266-\330\237\026I\204\231\303\"\373\002\fE\242\212\343\221H\302\330\266`3\030\333\026ln\231C\243\022\005\021[\202U&\245\030\252p\002E\220-\"\211-\023i\324\355\320\001*d\244\361\004\222YT\215J&\312\034\222\030\241B\220\304\b\025V\2658\302\210\336(\004\023IE\007\346\260\205!\237%\3332\211G*\223\311.\207\206\210?v\005\361\210\002Iy\244\221\206+\330!&\222\n\315\034\262E\343\n\266\004\023IE\220\035\262\312\244\024L$\025+\253Lj\231H*~L$\025({$\026\231ir\311V@\223(q\302\t\r,\210/\220(\001d\227H-q\311*\217\3306\330\336(\004\222\362h\230\\&\025\025\213D\021\314%\273\302\270\034\022"
+	.ascii	";|\341\003\021>\030\001Iy\364\203L\032[\244c\222\311.\201\314"
+	.ascii	"\341\006v\210\244<\n\266G$&\373\002[\002Iy\244\201\035\"\213"
+	.ascii	"\214G\342\220\007Yd<\2360\334\211!\205\025\330\226\370B\322\020"
+	.ascii	"\221}\201\330\022\207\326%\223hh"
+	.string	"Td4\032\022)\217B\"\345q\030\203\021\f#@0\322\300T&\227%\226\354\220q\205\261\004\222\362\250\247\035\026\021S$\215\277\"b\nc\333\202\001-R\005$\345\321\016;\344a\227D\026CKb\nG\2279\034*\211~Z\030\227-\261\2056\271\344\361Y\361k\333\341\b\020Z\244\361W\2044\"\215\304#\366\005&{,&\025{\230C\022\311eRQ\206#$&\332\336(\004\323\250%\036!\207G(s\270\202\035j\231\277\026Z@1tL\016\217T\024,X\344\360H]\022W\240\310\244\261%.U\030\217\304bpDr\231T\024l\215\212\214,\013\2259\024\2667\n1\274`\350\230LAi<\026{\230C\023\311eR\221\006\315\026!\211FE\365\307\202\370\002\023)i\\\301.\225A&\fE\244\226)T\221D\266\005\"\"\343\220f\213H\242qI\214"
+	.string	"\021\221qH\210L\032\231HDj\313\034\256`K\254`K\240`A\\\n\221F\242\021\211`;\202\211\231C\266\210\330\242\330 \304\304)s\310\016\021\213L\"\211\236\026\211\224$\301\026\021[&\260hl\211-S\270\341\270\003\324\336(Dr\231T$\202\271L2\221,S\202\fHC\026\222\313\244\242\237\026\206\313\034\006\331\226\3302S\266%\266(\204Z%\317\b&\223\250d\221<\362"
+	.string	"-\333\023>-s\250G M$\035\225\312\023\"\340io\024\202H\0042yt\224,N\360\244\222]\212h\223\311\245\210\340\210$\314\034\016\021\2218`T\301\363\201\n,\244\002\217P\201\205\210x\004\021\013\265\300#Z`\241$<\002\231T\302\250\330&\221=1\244\300\266\304\027\330\243\362\210\210\242X$\366\260L\b$S$\227IE+;\224l\001\2314\266E\266M.O8\200IL!\271L*\352P\2044\026\241p$\"\225`\231H\033\332a\013v\bi\0342\213\306#\"2ih\310\201ilqB\021\222\n\266Dr\231T\264\263d\333\243\321\204\020i\034A\250E\032\221t\013b\013DJ\026\220ICk;$\241E\032\221~\027\022\"a\001\004\\@A\027C\f\031\225\"Z\243\"\343\221H\004\322H<\022Q\\2E\204\340"
+	.string	"\003\223\330\002\323\330\342\004\026\311#\321\222]\221\3649&\223\013\030\246\337\001\262\003dG\3105,\211}"
+	.string	"#E\215X\220\357\b\371\321\341-C\372\322\234\320\247\323\360\2334I\206la\027]R~Pi\t\253P&X\342\312\370\020\316\310U\344^\200e\255[Z\310\0228\254\036B\030h\2204\"c\260\204KY\016\217\317\f\217 \337\f0\246\035\270I\016\235/Npn\366l\270zB#G^\317\217+>'\216\325\016\033\271a\327\343\312\211\020\317M\310\232\033P\260\022\263/^l\b\233k\222-u\352X\301\371e\211\362%G\r\215%u\332x\223R\005\\\262\303\267\265\265\251\204TV, saS:H~\302\365\004\216\324\252\203\347\031\307JK\224\020\255\347\214\211\222.;4r\2357)s\274\354\314\310\221\246G\306\311\316\213\235\027;Ox\036\210\325H\222c\307\351;O\377\b\021vd\250\021\302\026\006\357\304\350\371\222\327C\r\347\237"
+	.string	"F\357\300\310uP\271:G\342\234\220\246\233b{7yT'F`\254\341\274\303\264\343\244\257\207\025\316?\301lgiGI\227\311i\232Z\350\354\354\340\235\327\322W\237\260/\230f\001n\240\200\324Y\245z\260\370\2102CG\237\271d0\346\322\346\254f\276\326v\330\361i\255/U\210\260i2\261\362E''H\367\253\242\247\205J\357I\224\263\2537\234\177\\\336\230\266<\265i#\314\273RnB"
+	.string	"Cf\253\213\336\276\252\361\341\027\276\2710\317\211\231\335\032\316B<7_\372\027>u\030\b\275 R\330"
+	.ascii	"\353\356\260\224\224\301Y\270Fhw\341\335\205wXx\207\366\365\251"
+	.ascii	"ce\254\250un+\036\215(njV5\240\263\257\315\032a\032\215\003\216"
+	.ascii	"\210\227<\234\205f\314\b\317\334-\265\367\030.B\272\013\317\334"
+	.ascii	"\315\221\321\2419aK\377\3022\332\nk\341\335m\231\023\002\t\""
+	.ascii	"inq!\007\324\321c\245\312\23182w\355\206\013\276+8\013\307\334"
+	.ascii	"2f\302\252\204,\t\201C\023\263\216\245lW\224\270\336V%\214\365"
+	.ascii	"fO\317-\005\323\316"
+	.string	"\273\270\2470U<m8l\024\001#\324:\202f\314\2156\254\246\262EyY\363\005\247U\375H\203F\310v\241\02776|\350\300Y\310E\330\345I\027Z\032\234\357\274\326l\211\202\263pM\270\245\207\253\313\311\345l\376\224\322c\242\247F-\370\366\243\021\306\027$m\035\203\265\364\320r\322\362C\003f7F\230E\337\250\203\343\nK\210\305\211\320i\313\331\036\316B+B+B4,UQ~]\364\266\230\234\027\242\241cO\270\222\340,<;Aj\312\024!\225\240,\2456\002x\362\2041\263\305\2043\225\024LJ\034\247S\237\024)\300\272%Qsp\262\266\332\024\03311a\223\202\034Q|[\364\356\322W\034\031d\0276\323\316\344\264Y\302Y\030\345lPQO\240p\026\216]2\0363zb\364p~\036P\007\02066@p\276\002\334\276\276\204P\200\260~P\236s\350\300.\204\242\343 Y\023\243"
+	.string	"+J\224\b\235\334\035Q|[\276\314\234\215\345\0206\271\320I\332\2274o\226\340,dr\2669=\274j\340,\364J\313\200\254\311\341,\\\242"
+	.string	"(I\222\350'AYJq\2005h\320}\345\346\335\332\034\234\257\200 G\216\300\251\241\2456\246&J\024\234\237\2007\302\"\302\"\3014\033\342l\271='49\302\340\374\004\214\0312\004XG\001\223\25098+\231(wo8?\001iB\204\254J\035\256\242\370\266\254\201!g\004\347'"
+	.string	"K\370C\370C\b$(K\251\215\006a\242\366j\250Oxxi\023\002\271W\322L}\215\275\311\312\022j\235\375\210\360\311\331\341\343B\255\340\214\272\267\215\363\363N\2641\021\"\207\205\265\252y\210\023\214`\250D$\017\227\006\310\224y\034\214\244\034'\021c\n\031\3216"
+	.string	"S\025"
+	.string	"0X<\026\017\312\345q\217\017\024"
+	.string	"\rW\330\214tN\033\314\244(\307\220C3"
+	.string	"\003"
+	.string	"\200\200"
+	.ascii	"@\003\001lY\360S\177[\006\f\321W\340\r}9\340c\031?\026\263\326"
+	.ascii	"\026b\277\254\020\243\351^\\\2359\f\215JI\341\300\300\350\fT"
+	.ascii	"\0242\t\312\306\002\361\361\200\367\211o\033\024\213K\026U\343"
+	.ascii	"\244\301\225r\013\347\225+U\341\b\362^R5\007&|b\f\267\234J\336"
+	.ascii	"\215\231r\025\364f\252\257\370\024\301\344rDc\345\346&W\367r"
+	.ascii	"k\313\030\023P\006\016j\376R\246\275\275V\326\033\3348\325\252"
+	.ascii	"\003\340\244\3750\370\017;\2176\177\250\355\030\244\254]\234"
+	.ascii	"\032\345\036\003EdCZ\261SK8\340A\2511\242Mv\315\027\214\373\235"
+	.ascii	"s$\215!\230M_=F\036\375\364\024)\035TS\203\017Y\224G\3261Z\007"
+	.ascii	"z\315\t4/\246{\321\201\364\026$\327N<#\006\311\037\007\376\277"
+	.ascii	"#~Vq\220\253\023\"F\230\002@\277E\336\214\rEM\235\366Y\347]\002"
+	.ascii	"\223\020\363\252\034\261\263\267v/\300\247 \312\372\232\355."
+	.ascii	"e\301%\006w \275\266\360\263\244x\201\220p\325{\035`f\330\267"
+	.ascii	"\340\253\016\264\304{\270_W\317\325ImzT\333\337\241\306B"
+	.ascii	"\177\242\225\337\320\310\247\251\366`\363V \267F\375Vn\201\024"
+	.ascii	"\200Q;\337\t\005\370\306X\017A\260\223\2778\324\001t{\r\033\251"
+	.ascii	"\354\375\021O\244\215\274@\007\315|V\336\2723\r\275Gg\374\354"
+	.ascii	"\216\244\326\360\330\277\274\253\325\374\037\307\200\020\013"
+	.ascii	"\352\324\020\270j 75.\366,o"
+	.string	"\263\205\246#\013g2\274\235\327\353\333\260\0134c\260\356(G\255\260\223tR\r*rI@\n\202\206\001\277k\350\032$\240\216\027\224\253\247P8\260\306'}\275\304\210\317\246A\350NIl\252\227\222p\3744\021W\204\223\346\336\375]2\270T\255\f\375F\316\205Y\372\251\bzf[\n\200\025\254\024\001\\J\262\230\310A'\225\2564\f\327!\322\220J\242\033\316\253\214\243)%\332\332\200\224H\303\211\026\016>\237E`;\002>:k\254\243<\234\261\214\335p\332\204\312\257\240]\206n\227\374\b\367A\351\021\302PQ\277\251\206eT\341\267\t@VN\221\276\366\177\207q%\342\345+\254]q\223'A\227\377CO\370\332\037Pu\314\352eD]\356>\201?vG+\302\234\224\271\364\216b5\346\354=\231\026\357\023\270]\020\355\276\020sk\006F6\001\027\005\317\017\202d\024\233\275.\300\372\356\234T="
+	.string	"F\"a\252T\233|\031_:\027\223\021\032Q\343\263\354d\022\347\037\273\220\301\202In\f\340a~G\253\317\237\r\021SJXG\n'\233BL\030\031\032\244\030\275Ah\021\377\002\233\234#\226\234t\330\251_\3300\001\274\230\353\326\315\311\036h\226\226\272=\202H_\214\302\333yP\201\230'rC\013!\362\017\"\2269h\263;"
+	.string	"\027\264P\246|\360\t\260\320\n\322\355\177&\325q\003\264c\345\375\320\272n\307\202\bo\251\334\237\260^FNh~\006\214@\357\245M\333\306\r\345Z|\030\372\224b\244m\232\210i\253\021<\265\275\312\n\240\361A\260 \022R\005\312\rB9|\244DV\rP\370i\275"
+	.string	"D\006\034m]C\245\306\b\302\243\335\246s\321I\310z\016\255"
+	.string	"L\334\2753uEy\374\225)I5S^QV\211\242\250,Bf\351("
+	.string	"<\322D{\244=\326\231\316\205\342\214\307~1Q\270\261\307\263b\001\177\323r\351\360i\311q\306\242\004\032i\2161\222]\336'\304\374\326\261\372\203\374\002\254\273aTz\025\262\224\366n\033\257\360)\255\270\262\242<\220\201\303\003\236\032\336\275\n\017\260m\222\254H\377\334\262\033{\\\016\201\315\007\036\226>\201F\211\013\207'\rm\016\214"
+	.string	"\206O\213\237\332\"\201\037\267b7\352w\217\247>}A\2405b\263@\006\356t\266\327\336\347\312}\017\235#[\037\262\3625C[#\272\351\300M\203\347C\261+u\024\316O\266\013\340\006\322m\336\"N\022\351\255\022\354\310\032\306"
+	.string	"\231X;\201FC\237kwA"
+	.string	"\270\245\360\267\265\035\322\352$g\364\002(KC'x\255\321#R\021%a\321+\250\307kk\241\003D+\222\213\232Z+\3434\327@\301\235\3674Pm\361\345\316\027\323j\006\252s\021%\204\032\266\323\305\375\305V\355!\301\303]\365\030\207\311K~\257\004\005\367\177i\367\346E@\201\211\240\210\246\003;a$\241\237-W\311\253\034\332\235\"?\222\345\262\360\317\274\255vf\346\201\312$\203\036:\006\260\3478\204\336\376\342\271C\264\250\006b0\261\260\373\t\327J\362"
+	.string	"\264\341\244\211k\256\211U\300\271K\306\200\201\313{ \377\330]\261\253\260\211\r\234\353bc\f\362\375[\351T\306J&0C\257\325\037\213N\321\322\035$\342Wq\207\023\370{\bV\217A\361\225\304\211\207q\242\214\336r\216\355\233&\361\301\222G\013\342\021\r\212~\215;\243}\233Qe\2402c\244\022\031;\020\326r\245zg\302\324:k\035l\325\226,\366\352\250h\017\345\017\027\003\272\022\262\"\325\302\342e\262\206\025\0017\316p\304\201\350\326j\213]~NV`"
+	.string	"\247\331]\307\244\252sVO\207\232zn\324=\334\315/\225{\322A\236j\264\335\364J\351\212v+\210I\267\333\323\337\264\324t\315W\210\021<\237]8P\036P\313->\001\022[\317\345\322\006\334-J\024\323Wi\265\241\223<H+\222\244msn.\206\260\342G\213,\247|\350\212l\3478rJR\n|\013\226\311\314\206\3377a\t\222\213\264\237#&\253-\371i\276\322v6\303I\277\256\017\361S6q`\226\321\301\034\247\365N\323E\223\365\207\345\tl\356\f\220g\202\203\341k\267\236\216\2566\005\"\026\245\341\267{\265\206\211\025Y\210\240\2002\313\322[F\356`\360\025\206~\266-\275Y\300\\\035\274\221\206[\357\354I\f\317\234\212\032\311\363\313n\202\334\365\f\350\337\306w\34114\340\352\007\313\357^\037"
+	.ascii	"\022C\305\314\030\026\243\340x\321\235!\264\2335\314^\350\350"
+	.ascii	"\376Jk*\254\271\037q\324\331_g?t\023\030\262S\217\276\205\021"
+	.ascii	"\301\3367\\Y5\262q`6e`\032\322\037\020\200\337}"
+	.string	"9\310j&\030&\351I\265\250\217Q\374\353\3235P<\215\224\0212!\350\326\214\212\372\311X#\277\026p\027\263\002u:\215\234?\227\235\236\231\030\235J&\t\\sX\220\347\210`\370D\211\356\337\t\351\034_\244\300\303@k\021\355\201X\037-\202\022\237\204\210\"F\\\356\324\b\366\347\342\265\n\375\242\033j<b\253;\205\360)Xt\302kaL\206\266x\265\227*\226\214\017O\f\243\177&m\025k2CL\247\"\307\013\207[M\035pC\001\342\232\203\324\003G\362\320\317\022\350\013\034'\037\263(\037Z\t\246`\\_K\276\024\2337iZ`*\027\002\364\302,OkX9\256\307&,c\302\024\003\265i6\321\332\336J@\206,}\352\317\251rz\300{\232\252\340\260z5v\024\340*\343\274\244-\241\330\251hS\337`\207K\207\243\307\344 [\261\242O\207\003\377\275\270y?\274t\211\006B&\234"
+	.ascii	"\301*\016X;\241\217I\301\320P\2774\320\"4j\0203\344\327\\\220"
+	.ascii	"\271\201f\271\212\\\007\257\312\022$6\265\274#Y\300"
+	.string	"\266\f\332\352\311\031\334\204\2133k\242\266\314\300y\372\030$\b\226Q\241)\2715\212\237YQ;Jm\353\230\210\247Vq\376&\330\351\bAtk\024\234\251\340\3538\252nC\321\005\212\251s:[\225]q_\240J\226J\356\276\003U\361\207/s\235\027\337B\005\350:\246\037\021\357n\334.\246u*\225\t\340\200\n\240\200\002\243\344\300\362I\002\221\242xD\230\305\365\241WB\3515\212z\274\336\357U\207\004\303;),\362\313\262\251\225\201t'\360\2506\362\343\264\323U\363\313-\304\276\334P\026\021\352\235\362s\r\036@\226\277\374\032\345\227r\f\275Kj\360\007\034!\023\343\360\360\032\332xJ\277I\235\266\237\367\0044\257\213\246\336\205\364\246A\343\264+\265\2651u\004\230\356AJ\301`G\312\241E\353\207\332\003\\R\347\202X\330\246:\214\352\360\221\344-g\362\202%U\325h: ]\276\306\262\322\335"
+	.ascii	"\303\305\267\342\224\3002\331\312MC\027Z\217\357\0203Wu\305\f"
+	.ascii	"\205\n\2629\340\324V\314\301\313e\375\363UF\b\246\021y\235\256"
+	.ascii	"I=:\307\030\322{8\017\205-\257(\363V)\301iRrYJK\201\355\354\373"
+	.ascii	"LG\005\350\264[\332u\021\321\2118\316^"
+	.string	"\317\264\322P\354\f\t\214\343 8\233\357\004\256\313'\177\264\004\353\261\275:%\324\226\244\343\2767\222@\321\272\220\272\316B\264Rs\264_\2160\277\260\314\027w.\002\354\304\264\027\203d\2653\022?\200K\031\337\003\351\254uE\345\255$ D\351\337\264<\253\315\214\255(%Wi,,S\311\3048\201\365\036Ip\017bN\362\001\\\033\207\0350\247\326\325\234y!\265\211y\266x\356h\002=\265=\366\265\371\224\273Y!F\334\222\375G#\203\263.\206\242PAD\331\026\257\346;\026"
+	.string	"!\242\270;\250\330\346ou\335\213\226aP\333\202w\343\360\244x\330\314\307\202\316\030\206Jl>\0311\227\375O^\035\2616\036\212\376E\033\257\333\236\r\353q\201\202;i\227["
+	.ascii	"\3460/\271b\276\\\210\350\263\031\b\201\005\320\031'\332\334"
+	.ascii	"\017Y\214\373\252\233\333\350=\252\206R;\310K\325/\033-m\216"
+	.ascii	"R\246\346#\021\023\325K\355!\360\356'\301XBC\262\246X\351\242"
+	.ascii	"\177\257\321\330j\241\341\352\215yCu\325\340\222-\266\034I.\204"
+	.ascii	">\026\250e\032\270Q\303u\317\332/:\234\267\311\2257\004J\330"
+	.ascii	"\346\020FVS\276\235\227\202\033e\2620\246\355$ \267\270GhD4\333"
+	.ascii	"\313\201\004B\350\261\"@\347\267\340\257\201\370[P\\\222l\233"
+	.ascii	"u\362\337m\215b|\306\214\313R[\301\363\264I\301e{\r~\324HCyu"
+	.ascii	"\024\003B\346Cut\255\372J\260\245j\337\221\363\220\310}\320\034"
+	.ascii	"jEW\262\345\2161-\b\302\006\\z\201\345\357\252&\346T\340h\321"
+	.ascii	"\365D\330{\202\354W\2115\365\315\230f\367\017@\2518E\032\ro?"
+	.ascii	"\034\305\314npf-\232\360g]\035<\303\315B\323\006e\363\034Et\210"
+	.ascii	"\367\263\036\374\211\315$\234\233Tr\001%B\2473\217\250B\245{"
+	.ascii	"\"\336Xq\236s\303\360\357\323G\016\340\207\375\033L\303\2762"
+	.ascii	"c\366\244{\034\331,p%\002B<nI\365{\331\027.\246\306\267\3650"
+	.ascii	"\022?\026v\234\351\251f\236<\243L\352\034l\2367\312N\340"
+	.string	"\033\366\347\035M\203a\3078Rj\220\021\256\221-\310\311\355e7\224B\350z\360\3101$&\221\330\305\035T\242-\003\375\363q\bh\312AS%\301\272h\251\3106\360\002$v\002,\035\365UDR\341\033H\201\227`s\374R`\203\245\320\212\300\022x\303\205)b\347\330\256\323\331\235\343S\241\376\001\221\370@\351\365/\033E\bw\230.\320P\272v#<A@\245\256\376\baU3\356d\247@\347\346\254\017\315\230\003\344\272\326\2632\234q~fCq\217p\311\271\3219\337bBo\200@G\257\243:\334q\362\243\257a\376*\263 \341\0051R;\r\324PC\326\253\321\301\261\244\217>>[\374S\"\265`\177\021\316\257\256\320AV\345\256\221\336\003\031\301\f_\266\346\033\001\314LP\325(\221\273\252&\302\325\344\231\006\007*y~K\271\b\300\327\nL\326l\252\t4#L\025\231=\201\301\300K\276"
+	.ascii	"\320\024\337j+ju\027v\026K\355\235\020N\343!\177XE\344\226\037"
+	.ascii	"\212#r\342\237\314y\326\3044S\276}\263;!Y$ O\300\273\300\347"
+	.ascii	"\313\272\371\031^G\240r\2472\373l0\230\"\245\363w\307x\234\340"
+	.ascii	"\327\212)`\271V\030'\204\030\327\026i\340\b\322\036[m \264\027"
+	.ascii	"S1\261i\337\fo\310Oq\216K\277\006XR\030)\254c\026\217\266-\267"
+	.ascii	"x\334d\2712\317\tC<g\315\2607*\025O\3547\275\026\316\346\022"
+	.ascii	"\320~WR\316\215M\242\363\257I\203\023\225"
+	.string	"'S\315\240\304\203\313\026\020\216\363\237\311\232\232\025\274\027\352q\300\370\367\207\231\354\376\331ZT*{H\224\016i\225%\n\351\223\252\252%!\210\247\210\364f\334]\343N)C\221\rvS\226\327\334\353\203\021I\227\025\335T\332\327\367\274nO.\321\217\202'\261\205\352\365gW|\\\365D\202\334\035\276dH\300/\260\204\267f\233\341\317]\017\226\363\3108\363<G(X\033^\316H\256\3556\213\t(,0\272?\365[\2635\b\023S\251\364\244\251\320\236\243\323c\301\001)`\240\253l\312\343\2206q\2145\337\363\226\254\262`\335\314\"\267\342za3\261\321\366\226\022Tl\200\263\207-\\MNpB\264\006}z\346b\224\030,5\267\363\267:\002\341hc\357\315\310\f\177Q\373F]\232\035\3607\337D\026\311\370\362\200#\212\022\024\034\022\266Bk\034\376\316i\336U\223)<\310\033\003\360E\3668\f"
+	.ascii	"{ en\377\264)[)\235c\f\334\346\032|\354\267\376\0230\177>q\270"
+	.ascii	"\223\272\033\r\264\300\276\351\017\365\223\271*\3546\272\177"
+	.ascii	"\247\344\277\355wO\355\356<\353G\271\226\341HP\357r\255S\206"
+	.ascii	"\374%\236[p$AIj4\013\354\307\220\244\213\211\277\214\267\241"
+	.ascii	"\243%\270h\357\273\255\026\237\315A\212LP\261`\277\220i|\226"
+	.ascii	"S\022#G\364\341YP\320'\t%\311\005\242\263X\002\202\375s]\231"
+	.ascii	"\203\334\202\212\341'"
+	.string	"\371_\277\221\230P\202\311<\023\351\024\034\340\221\200\3408\213\006d\217\"\244L\307\235W\341u\316\230\177;\346\033\351\244E\200\211\013\304Z\315r\310\376\201\311c1\0032&Vy\370?\"\234\372}\312\f\273G;9\366s\331\326W\360\246>\374\224\217vC\332\177\027\303g\376\334e\004\240\242\211u\276Om,\037\200\231\001\357\236!eT>Rn v\250\374\004\312\277\214G\345\301\017\221>\265\021\261\264/\327\367\022\2260\324<+\026\t\026$\225\313Q\f\032\322\330\232\320\351\025>\256>-e\311cf\017O\3308.\370RO\025\321\207\272\232\213\351\240a\336H8c\224<\244\367!\211\211r\033Gt2\026\264\b\321,\177\004\277\350H\030z\245\324\371\350f\233\200\340\013MG\244Twl\027-\013\247\tT\t\215{\205N&\375?v\022\301:\b6E\266\245\n\272\303\225\335\027\222\356\347u\207\377"
+	.ascii	"\217\t\244\221\322s\331\332/\231\210uC\003\250SP\253u\325\212"
+	.ascii	"\242E\302\213\222\357\250\251y7\222\346'p\025\r\237\255h\005"
+	.ascii	"Z\237"
+	.string	"\227\336\310}_[X\fw\274\341d\267 kP\250\013\216\201\311\355I\026\247vIl\001\314\300w%\271o\004*\241K\326f\f\322$I\177\2310\013&\034I\327\337\253\360_Y\310\256\"@e\241\307\035\320\205Ah\225\260ac\203\377\332l\360X\022\263\037\202\252qM2\005\224\020\324H\236=,tp\353\360\225\0365M\324\025\343\033zS\205\240;9\361\214`\206\315\032\233\327\224\261*\322\026\303\305s\205\t\003e\322\237#\031\256p\304\363\215\250\017k\321V\202\237Z\241KW<'\362\007\035\\~\330D<WO\323IP\367z\214q\334\237\206%v\235{]\340\200c\300\f\212\027O\350\232Y\362\222\277T\202\325\246\226\371\002\256\263\362\254\221'\327\275\027\255\330%\302%E\303\177\0233\020X2\235>\300\335\227\031\231w\263\261z\007\001\3744'\376\206L7Ah`@\337\303\353\306Y\363\r\220"
+	.string	"D\360\301\nT\210\364s\n\264\235\370\026"
+	.string	"\343\360AV.\350"
+	.string	"\031nu\260\"fX\302\235\312\022_U<\n\334N3\355\374\216\360\320@\317\021_\230\353\204"
+	.string	"'u\256\025C\327^\016\220"
+	.ascii	"\201\210\034\354\246\215!\030\3331}\3076\312g\0032"
+	.ascii	"'\002Gq;\334\377\270#\004Onk\362D\r\231\004"
+	.string	"(\345\314k\1772F\240\234\rE^\222c\b\337\231\b\017\2017{$\376g\311\203\275xU>\331\034@\210\365\004\241\261M'\372\371\2141\203Q\206\272\221*\300)\021v\323\036\022\242w\016\373\"x\b\002\215u\306\t\261\027\301\232\024\005&/|\206\234x\266\02544\370\204M\203YB\265\305I\0252\234\2358\251\257\312\340\251\300=G(\376\305\030\314:\365\252\221\325\313\320NTjdOy\216\371\273\b\307\324\310\f\270\025\336\211jN$\363\314\202\240.\321\361\316\364\241'\316-\262D\263>\r\036\361\252\264\\?\347V\266\326\230\257\342\201\355\032\251@\251\351\266\022rt\201\351\003D\273C\224\367\020\357\204s\300\b\376\027\336>\224D\341v\002\302\205Z\034g\275\254y\221\324\266\236\032\357 \312\213\310\245\224Q\327\323\262|k\001\3706\201C\206\017\002\022\032;\375\023\306\300\306\223\220\003h\177\030'P"
+	.string	"\324\016G~>\247\265\236\301\373\271\234\003+\337\237Yr\307\302\220\356\207\221\340J\335\260\004\217\375\240\002\030aCnY\364\013\bR\307\024&\355%\343\006\207\020\037N\330\277\321\264\256-\245\013\004h\001bqyp\345\210\306~"
+	.string	"\342\211j\003\001\333;\311I\320\255.\222\\\341A\253H\376\220 \354\243h\2544\322\216&\330\242y\350GD\262KT\360\222 \225gP\300\270\231I'3^W6\312p\005(\026\251\303~\007O\214O\305P(i-c\344K\306\362T\347iX\204q\203\364Z\004\363\024\036qt7\200Lk\366<\362\\V\245aM'\207'\"\320a\273{\241\355O\353\312\325\035(t5\277\332\212\220\350ib\364\003\372K\266AZ:\216@4\276\r\271\024\205\2341g8\322\220\007\\d\321\336\006/\213\332\303%\022\215\244\341\374@\tP\f6\224Y\323\213.Z \352\013\201\2704z\235X\220\0160H3\344\257\201\261\336/@H\353\007\241i\216\036\354\215\213\263"
+	.string	"\271U\220\310\217\276\0242\330\024\353\324\213\216\244"
+	.string	"\242\177U~\344k\342G\"\200>;\227Y\255\222"
+	.string	"L\213\302G\033\037^s\022\275\203\266\317\200\223\253}\370\004\235\325\215\260\267\300\025\267\374\004`\332\352\017SH\261\261\211\260\020\351C\326\371\313U/\002U%F\023\031\276\303\226\200\355RdT\207\252\354A&\225\356\2568\2679!\225f\340"
+	.ascii	"\241\323\201G\030x"
+	.string	"\372\270\2729\337\212\327AB\210\245\210KO\252`\246x\312\021\022q\346\013eJ\335Be\302&\035'\371\234\302\024=\335@\277+T\026\304\207\207H\303\025\233\214=a,\3736\360\0039,\347/\365}\334\013#\310\020\200h\037A\214\337U\253\327\353U\201KF\035\2026z\031\331\205r\213Y\262o\343\246o\242\366l\370\2211\\\341\266a\243( \346\336\r\002z\266\270~\031N\361})\236\rrWG\177\026\2466\353b}4\016P\244Y\210b#K\311\236\177q\001m\001\003=\326\20098\207\304\231\306=G\231zH\211R\206\025 \004]\240Y\250\006E\206\031\nrV\025\n\003\030D\373\373\300\253\2712t\301\226:\024\020\205\3272,\234\247\273\232f\272(\005pv7\274[\nr\263\033BW\367\232\304>v\321\001+\352M\331 \276\231\220\366>\tg?\206\321\222\240(6\001\364\033&\336"
+	.ascii	"J\301\001l\366\2519\2165\003\325jLRr3\"\273\205\265w\266\202"
+	.ascii	"\227\030\345\324\243\313\344DF\347\203\201\267\017L\367\210E"
+	.ascii	"\037j\330P\216(\274\322\027Xh\325\302V\333tD{\231\341W\242\362"
+	.ascii	"=2\025\211\200\202,\361\251s*I3v~K\373\347\026I\271E\250\250"
+	.ascii	"\264\307\2219\007\266\332\377\367\342\036s\246x\001\b\337\331"
+	.ascii	"\232U\2115\t\t\207%ES\320\215!{\026\202E&a\021\021\266\361YX"
+	.ascii	"\204-\222\251\\\374:\004\246J\f;\002\274H\245\207\254\023\253"
+	.ascii	"q|\2545TQ\226g\200\372\305h\342\3417\2044\036\270p\331o\350\210"
+	.ascii	"\323\330\033\254u\343B\250O9\233\177=\233g\373>V\262\311\033"
+	.ascii	"\202?ON\016\336\2023\331\335\351\030\354x\"\3773a\350\230Y\241"
+	.ascii	"\016\257\n\021$8\n+V\232=k\334<RR\245\276SB\240?Mw]\360\205\301"
+	.ascii	"R\177\312\020#\237\032\206\n\362\205\266\005\300L\306\344\331"
+	.ascii	"X\216`\263\336W\375\346 \230o\375\253\205\340\373\222m\240\263"
+	.ascii	"\363\304\236\tC\367\313 @,\252w\211\221vS\217`}\342\343H\356"
+	.ascii	"\330m\273\001\333\375t\2241\004\036\233\335o\227\254M\016\216"
+	.ascii	"\365\371(\207\n\315T?\020I\341\215\221\326-\270\033>\t_o\016"
+	.ascii	"\244T\005\245\fX\2661\345\365#\342\0324,\177\236\366a\003P\332"
+	.ascii	"\317\r\3059\017\247\311\336\321\367[p\267\357G\022\340\336\034"
+	.ascii	"\335\362\254\267\2108\301\322\013R\377\333_\255\325]z;\037\231"
+	.ascii	"\223\236\230k\264\325\234\317\357)\237\220\3778\215\367\220\251"
+	.ascii	"\261\312\237\002\350\267 \230\177\031[\360/\314\007c\335\345"
+	.ascii	"Rp\377Y\247@\305\351\2443\301}>0\361;(\260Oj\373\233\334!\335"
+	.ascii	"\030v\376\037N_\364\237_\346>y\357\r#\370\202\310C\321\315X\264"
+	.ascii	"\303b\027J\231\\\342]Pk\327\242:\255e\327g\316<0,4\377)]\326"
+	.ascii	"\376\327\024\026\3701\022,\037\241\303F\244&N\246S\312x\342\257"
+	.ascii	"\017{\372]\364\264\305\245#f\350\rv\f\375\257<\340\221\303\313"
+	.ascii	"'\274\016Nc\314\267?\002\235 \264\177)\256\375a{\f\342\201\326"
+	.ascii	"\263\016v\203zq\007\366y\1771\367G\212\354\356\375\372\023\316"
+	.ascii	"\203S\264\306\021\321\217\324&\335\365Z\350\371`z\327~?\207\374"
+	.ascii	"\307z@k\217(pE\275\341\214H\361\240\032\022\341\341J\363o\n\034"
+	.ascii	"\024\360M\254oa\336\350\256V5\311\b\003\237\t9\355\t\357\007"
+	.ascii	"\376\234\251\356Z\233\274\n\271\307\332E\271\001\340kW\224\017"
+	.ascii	"\016\274\030\367\353\265\270\215\265Wx\276\242#\216k\265\371"
+	.ascii	"\325\013O\274\255\361\017\311\365\200\210\324\006\260\212b\277"
+	.ascii	"\210\217L\330\177\035\306yc~\267\342u\361\354s\250\303R\326\217"
+	.ascii	"\236<\336\214\217H\0337\322s\354\254\233\331\372\3530?o(\233"
+	.ascii	"\320~b<\227O\372\362\373:"
+	.string	"v\262h\037!\006\277\300\376\273q\351J\2325\b\016\320\232F\272\351J6\306~|\316@\370\236\213!\275\301\221\317\377\341o\020\r\017Dw\006\021\237\237pO`\240\277\216q\016d\224\342#!\377d\357\340v\207\001\256i\343I\331C\200\261\241\325\037\003]\020_7\342\371\032\357\344\316\354^`\370x\026%\315\315\371\303\336r\2533jW\212\035\0265rlm\237\242\237X\034\276\300\177\306U\377\333\355\036\304\213\236O2\372\3359\337\350~\350\016\354\375o\261S>\253\374?\217\253X\313\231\317bk\226\030\231\257\016\313\341\276T\323\222\216\223\236\255r\262\354\346f\004Y\2474\274\272H\203\237\036P\372\006+\316\237\017\246\320'\031?d\256\305\332b\226\033\3127t\343&F\367\216@\20709\r\263^\231\373\027w\035\340\306\307h\245}\2576\366<Y\347\n\030_b\330\202\200\271F\335M\246\037\367\316\371"
+	.ascii	"c\251S\370\3677\370\327h\313~\031\374&\337'\356\032\202\211\366"
+	.ascii	"\333_\017\342\035d\227p\267\033`\013O\347=vcz"
+	.ascii	"s\267'\2278\b:A\256\036n\222\303C\022\371\374\216\306\224\354"
+	.ascii	"~\311l8Z\262\034\3375\3325\360`\355#\314=\244\3369\026\273\254"
+	.ascii	"\343b8\265\266\323\314\272)\303n\350\363\353#\321\036]\372\343"
+	.ascii	"\375\036R\270\340\300?0?\240\f{x=E9\315\300G+\230H8\320C\367"
+	.ascii	"@\036U\366\327n\256\241\313%\017\3668\027\244\366\026\366B\266"
+	.ascii	"+]8\211w\320\005\363\303\376\027\264W\275\270\022E\316\351\220"
+	.ascii	"\030 ~\034\256\266\216\343\261\374e\260\250\311\272\236\342\263"
+	.ascii	"1\333\351\365\307\030\307\231\347\315\226\026\021z\256\362\337"
+	.ascii	"\317\363\214\214%\234\f\031];\253p\313\376Y$y\326\375\265\332"
+	.ascii	"a\332\313\207\235\313\371^S\274\305\203\261t\335\272\202\022"
+	.ascii	"'\177E3X\025\307\177\346\256\367Rg\b\276\214c\353\376\224z\034"
+	.ascii	"\311\023\0044\357#\202J\267\237\275\240\353k\334\310<\244\226"
+	.ascii	"\376U\375\343\016"
+	.text
+	.section	.gnu.lto_.symtab.6b8f6e46984b810b,"e",@progbits
+	.string	"pidData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"pgResetFn_pidProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\004"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\004"
+	.string	""
+	.string	"thrustLinearizationReciprocal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\004"
+	.string	""
+	.string	"thrustLinearizationB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\004"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\004"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"pidGetSpikeLimitInverse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\004"
+	.string	""
+	.string	"pidGetFfBoostFactor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.string	""
+	.string	"pidGetFfSmoothFactor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\004"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\004"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\004"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\005"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\005"
+	.string	""
+	.string	"thrustLinearization"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\005"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\005"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\005"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\005"
+	.string	""
+	.string	"pidApplyThrustLinearization"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\004"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\004"
+	.string	""
+	.string	"pidLevel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\005"
+	.string	""
+	.string	"acroTrainerSign"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\005"
+	.string	""
+	.string	"applyRcSmoothingDerivativeFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\004"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\005"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\004"
+	.string	""
+	.string	"dynLpfDTermUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\004"
+	.string	""
+	.string	"dynDtermLpfCutoffFreq"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\005"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\005"
+	.string	""
+	.string	"pidGetDT"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\005"
+	.string	""
+	.string	"pidGetPidFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\005"
+	.string	""
+	.string	"getCollectiveDeflectionAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\005"
+	.string	""
+	.string	"getCollectiveDeflectionAbsHPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\005"
+	.string	""
+	.string	"rcAliasToAngleIndexMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\005"
+	.string	""
+	.string	"pidProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\005"
+	.string	""
+	.string	"pidProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\005"
+	.string	""
+	.string	"pgResetTemplate_pidConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\005"
+	.string	""
+	.string	"pidConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\005"
+	.string	""
+	.string	"pidConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\005"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\005"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\004"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\004"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\004"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\004"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\004"
+	.string	""
+	.string	"governorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\005"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\005"
+	.string	""
+	.string	"mixScales"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\005"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\005"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\005"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\005"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\005"
+	.string	""
+	.string	"isHeliSpooledUp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\005"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\005"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\005"
+	.string	""
+	.string	"biquadCascadeAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\005"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\005"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\006"
+	.string	""
+	.string	"biquadCascadeAddPT1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\006"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\006"
+	.string	""
+	.string	"biquadCascadeAddLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\006"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\006"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\006"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\006"
+	.string	""
+	.string	"dynThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\006"
+	.string	""
+	.string	"biquadCascadeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\006"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\006"
+	.string	""
+	.string	"interpolatedSpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\006"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\006"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\006"
+	.string	""
+	.string	"calculateThrottlePercentAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\006"
+	.string	""
+	.string	"getCyclicDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\006"
+	.string	""
+	.string	"applyFfLimit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\006"
+	.string	""
+	.string	"shouldApplyFfLimits"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\006"
+	.string	""
+	.string	"interpolatedSpApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\006"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\006"
+	.string	""
+	.string	"getRcFrameNumber"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\006"
+	.string	""
+	.string	"biquadCascadeApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\006"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6b8f6e46984b810b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,742 @@
+	.file	"position.c"
+	.section	.gnu.lto_.profile.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"m\005"
+	.string	"$\007\t\001"
+	.string	"\021"
+	.string	"\201\277\312\340\b\n\002"
+	.string	"\001\002\002\002\003\001\352\263\360\321\b\003\240\342\234\212\n\004\261\312\232\202\r>\002\004\005\002\005\002"
+	.string	"\002\006\002\007\002\007\002\001\002\006\b\002\b"
+	.string	"\005\002\t\005\002\007\002\n\n\005\n\013\f\r\016\017\022\350\300\306\254\005\002\023\354\206\342\366\006\002\024\347\273\234\355\f\002\025\355\314\246\334\007\026\332\322\311\233\n\027\240\342\234\212\n"
+	.string	"\031"
+	.string	"P\204\311#\f\301\204\201\273\235\306HO\004\334\201\306R\"$\346\260(\033v\206\276\370\230I\260U"
+	.string	"C\225\001\371r\024\257"
+	.ascii	"\224P\303\314[\203|\301x\271\334\0130\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375 EU\001"
+	.string	"\3009"
+	.string	"\005"
+	.string	"\002"
+	.string	"\001\003\002\001\001"
+	.string	""
+	.string	"\004\022"
+	.string	"\003\023"
+	.string	"\003\024"
+	.string	"\003"
+	.string	"\007"
+	.string	"-\031"
+	.string	"\001\226\0331{\270,\f0\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"U\004"
+	.string	"\002\007\027\"\200K\322\001\372b\306\201\330j\bA2N\227JS\bK\220\214-\212g4\t\301\204\253Cmo\271S\037\f?\277\036\273\013\037\250\037\245\207\004s\261\324\204o\rn\"\025\312\232\017\245\372\007\366\243\304\237p\367\202s>l[\3003,\323Va\277\200U\2659\bi\233x\347B\004\021"
+	.string	""
+	.ascii	")\034%\tf\034p\214J\304\204\351I\300\213\364\303.\256\"C \270"
+	.ascii	"@\002\007\250K\n\027{\223CW\346\344\322\264\006\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375 \324\225\003"
+	.string	"R\305\021\034\240'\351\377\243\330w\277\212Wu%\026<\252\252*\226\357?\024\366;M\310nR\246?\341\007/\250\372\224X(-\272\273;P3\3102\346,\016\b\256(\345\177'\204\206\322\215u\314:\370uj\200\032\";9\021\021"
+	.string	"@\004\334{3Hx\307p\266"
+	.ascii	"t^Q8\357e\023T\261\201v@\230T\321R\202X\024\303\233&\234\331"
+	.ascii	"\034\f\260"
+	.text
+	.section	.gnu.lto_.pureconst.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\004\230\004\022\204\004\023\204\004\024\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375 \250\265\002"
+	.string	"\342D\f\023\300%\303\030\377\377\377\377\356\222\275w\263C\270\033\2212\005_\203N\363\260:\323\2632SSdJ&\326\001\267\312\264\254\004\323\300jL\307\204\342 \016"
+	.ascii	"_\221\240\304\341BtE\207\022\214\0136\024\005\253\002\2712\326"
+	.ascii	"\242\312\326$\340\2365@h\033h\003"
+	.text
+	.section	.gnu.lto_.lto.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_positionConfig_Registry.39.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375 \240\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\266\377\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\307\007us\336\006uq"
+	.string	"\005\001\006'\001\001\005\001\006\035'\001\270 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/position.c"
+	.string	"\004"
+	.string	")\242\302\254\b\242.\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_pgResetTemplate_positionConfig.41.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_calculateEstimatedVario.44.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375`\320\003-\033"
+	.string	"\2663\261J\260\226Q:\264\343\234_'.\rH\f\\\r}\373\006\251-\311#\332GJ\273\035\273\2751X\204\2022k}bP\323"
+	.string	"[\"\330^\262x\003\206\377\007\375\256?\304\353d\376\261"
+	.string	"?\365\026##\0077\263m\023\022+wJ\001\231"
+	.string	"\215"
+	.string	"\237"
+	.string	"\037\2478Y\366\243\234\250^<\307\241\354\2279\034\207\227\211\216\027\007\373uq\332D\376\215\013\375\n\352p|!\230\032<\351\350n\004\025&\241\270\252\265\016\270\350\004tmt`\301\252/\t\304\216Z\237\n\330"
+	.ascii	"\275\3509\355\323x\r\242\003un\325\232\002\310\216Zk\001\023"
+	.ascii	"\240\027qX\266}\031\237A\344\242\td1bL\372\031\335\210Rk\235"
+	.ascii	"\301>3^\234\217\031/\356\212\027}\026\371\027~\307\211\252\227"
+	.ascii	"\004\352h\367I.\250\265z\376\216H\334{\333\001l_\260Y\b\002/"
+	.ascii	"\233zs\350\271\273,*\345\3257\266s_2\365.\365)\235\277\344!\333"
+	.ascii	"\374\3176^\374\222\273(\030H\2749\264\201\275\271*\354\263\352"
+	.ascii	"*\331\236\326\311\371\323}c\363\340-\273\215\277\346\300?\346"
+	.ascii	"\232\246!\247g\350\264\f\235\216\241\3230t\372\205\234\206\221"
+	.ascii	"\323.\344t\013\235f\241\323+t\372E\247]t\272EN\323\3264I\247"
+	.ascii	"G:-\322i\026\235^rz\222\323\337\241J\21289\202\024\363Q\253\210"
+	.ascii	"\341\224Z%\366h\361\247?\030\033\263\352\201(QUm\005\303\341"
+	.ascii	"\222\327\256\270\266\265\257}\331$\344C<\245\301R\226\032/\272"
+	.ascii	"\266\205D\267\265\247R^\221K\367FUl\t\0172\201\326\352;\340\377"
+	.ascii	"8\020\n\376\322EW\240\321\306\213\344\276\234\246`\320h\231\256"
+	.ascii	"\353\306\231\265k\031\346\1776{\341\351\024\027@)W\037v\347\234"
+	.ascii	"\022lg\326\263\204\362\022rS\215\262\205\355\241\316\212\261"
+	.ascii	"\004t\261\"\370$\266=\304\243()&\306\225\355\255J\"\342\262v"
+	.ascii	"\334\227AjV\334\021Iy\305\233\372\023\022\265V\013\360\325\312"
+	.ascii	"\333\331em\366\341\031\362\311\321n3 \334\355\206\353\221\375"
+	.ascii	"\324 \004\335r\025~"
+	.string	"j\033\310\332\315\346\340\202\230\373a\200\023\242Y \335\303\003\204\263\345lC\270\240Y\316'\203\355\007\303\f\310F\273\315z\204\206f<6\306\005\325\204f9\034Nh\366\002\362\276J:\213\303\333\236]Vg\205\036jmY\227\017\2079\333\262\217\022\257\033or\326%\310\243\212fo\366VFUh\246\314\332\017\"\214\377\321,\200`\215*\337\356,\263F\256\343\327$fWVf\311!\345\t\230e\331\230\215Y\275\254\247^\353\204\331\032\253\222\251\327\332\227\225Q)\233l\226%D\2501$\344\214b\n\252\231HDFZ\230tp\242\251+\262\003\021\020*\2532\311\260\277\001_\344\2004%\306\264$\351\317\262\261B\274\n\342\202\251\231d\226.[4\327'\314\302U5\326p*\376P\343\3134\2578,\004\266\244\303r\022`\245\220\212\301\317[x\226\237\036n\327u\252A\3209\n\320\362\002&\227\340{"
+	.ascii	"\352\025\3278@.h\277\300\362H^/d\373\342\261\303\330\215\352"
+	.ascii	"%\320\212\2615\355\316\341\325\2437\216cb\265\200G\034,\317\227"
+	.ascii	"y\001\330\277[#\211\276@\223\006"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.46.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375`\361\017\025L"
+	.string	"\352|\020\034A0\242N\007\033\254\324\031\002\021T\305\301O\312\220$\210$\275\316#7h(iAr\237\355\353\234\241\335\005)\037\240x\021@\036,\"\203B\231\335tD\020\002\031\221(\216\230\210\b\331\273[\222I\006\266\001\217\001\254\001Z\273\326\376Ek\245;\026\377s@\347\342^\234\320g\255,\224qLc;z\201\372%\306\261u\306 !\024\030\307.4\236kD\361\032\265\020J\034\307,|\213\007\302.X\343\030\1779\312\324kb\034\307\"\216\336\022m-z~\256Y\343&\t\342\316\354m\310\022\025g\270g\205\302\321@\027\354V\264g\2325\346a \216\316\236\2408\266\006\360V38\372\326\332\367\234\017\366>\033\032\031\307H\320|\211c\353"
+	.string	"-\340\350\355\323\223\\o\215~\344z\253a\255\363\270\225.\366\277<\031PP\034\307\\?\347\260ke\001\300\272\262\252\242\232zJE9\241\236\234\232\230\226\224\222\220\216\214\212\210\232\314\241\2452\211<\276nk\374\rkOs\255\253g]\317l"
+	.ascii	"\263c\315\205\373\212\320\255\b\007w\225\027\247\362\322eO=\271"
+	.ascii	"H\031\017\334\020\004\347\207l~\306\245\242\f\307\361\330\004"
+	.ascii	"w\024\227\276\355l\271\334A\361=\031\267\344\324\374\360C6=c"
+	.ascii	"\222\033\352\035\307c\333\333N|Wv\323\353eLd\302\305\231\226"
+	.ascii	"\254\270\222\335\223\235\224\347d#\3455\331GFKv\021\223\272M"
+	.ascii	"4\243\316p\017\213\244\007\023o\322\025\331L:\271=\364z!\351"
+	.ascii	"\021\347K8W\302\021\331I<\266!\033y\310\026\367\266\217SHz\270"
+	.ascii	"\371\233l\373\341\256\262M6>\3438\366\331\367\216\266\350n]\315"
+	.ascii	"\315\215\306\255D0\200\230mk\306$\036O\244\312\266\033\373\215"
+	.string	"RI\212`\231mP\3433\215\241\354\263O\341\261]\367~\275\3428\326[\332\326\303\365\226k\275\365h\255\321\264\036B\013$x\320qBlY8\310\257j&\365\216<\277\356h\256KU#\317F\277\272\326O\225o\354\310\363\353\340_*\241<\033\003\270\325O\333g\373*\374\214\034\235[k\260\013\333\245\016~)\320\314\353\264\265\316\240a\273T3\003\305hU\013c\367\253W\377/[\332Zs\360\260]\372\337\224\301\030B?M\207\361\002\227\326~\325\375\313\342]\240\361\253\032\315\335\217\342\257\016\3226z\bW\353\021%\266K\367\253\320K\304&\256}\232F\360eZ,q\260p\256x$\033\370_\375\233s\031n\3273\355\240\376\255Y\333\212\332\037\301w\375\216\023\205\002\3650.\306\206\366&\332\314\304v\251\267\332M\270\336\372\243\321\261(\307\347\246\266\263Z[\241\373\253Z\373g\263\331\254\376$Z["
+	.string	"cn-\341\313+\202\203\344\326\013\222[+\360B\327]\336\347\216\300\255Y\\ke\271\026\327"
+	.ascii	"\\\3205\226wq}\345\203\256\255\232[W5\267\246jn=\325\334\372"
+	.ascii	"\271\334Z\212\271uTrkgsk\250\344\326O\311\255\235\232[7-\267"
+	.ascii	"fbn\275\304\334Z\211\271u\022sk$\346\326G\314\255\215\222[\027"
+	.ascii	"\355\255\211\226[7\227[3\367\326C{\353erk\345\320\326\311\241"
+	.ascii	"\255\221\313"
+	.string	"\255\217\312\255\337\344\326\356\336\272\335[\377\336z#\267\366\017%\214\b\332\363d&\216yd\027c\3036\214\235[\335\263\270kq\027t\357\342>\350^\350\307\375nw'\003\n\352\372\220\210\266^\353\211\036\304\2229\262[\363\257\336\002\216\346\177\2261\314\267z\260\367\305-3\337\t\304\210\034\337\321\365\306l\305\017\001@v\177\214\206~B\035\350\320\013@\\s\247\215\235\242\257j\354\334\221>o\020\327\266\242\336\325\257\f\321W\333\270v\354N{\361\n\255\370\271\312\216\301\324CB\254\325k_tB4b\300T\252\353m\313\2070\317M\255\271\374\255\304\261\256\210V\205\347\346\\o\227\217\341\007\034\346W\265K]su%4+\317Ko\343.u\215<#\375\352[?u\337\244\351\343I@\035\362\274\224\360.\364\372\220\336\307\263~\372R\257\362|\364@\256\374#$\317K\257o\020\004\251\275\206\213\365\323c"
+	.ascii	"OB\007\311\3632\302\277\324ByF\006\360\253\237\302\361\005\307"
+	.ascii	"Cw\247\253\374\005\177`\277\272\t\312\337\203\327\241\257j%"
+	.string	"\240T\236\225_\025\336\244\221\347\244\236\375mPN\204l\266\320\332Tk=\273\234(oV#\200\227\360\376\305\301\022\351\364D\375@\227\311\377\372\375G.\204|\r\306\0055s-\216\325\252\222\357Q4\307G\376\377\211&\276\177|\207\2433#\027R\302N\334\367\313\230\270\036\330\3111\317\373\001~$\221\343\353S\263\343wj\300v\360\035|\347z\353\365\255\233B\330(\216H#Jkx\212\323\201\253@\321\305q\234@\216\317\201\363\2647\361V\303z0\037\314\347z\033\341\3334B\330>\b\202~|\222NW\301\373\354H@\333\235\256\373\n^o\331\315\215\037\302~_\023&\270\336\272\037a/\304:\250hQ\274,\\\025aad\034\316\312\302>\230\221\261X\236\231\311(\353`F\306\342x\346\342k\254\354\204\004\345\231\213/32\260\260\031'Z$\315<\204\275\020\353p\006#\254\254LF\212!\235\202"
+	.ascii	"\2141\26131\26312\256\263\026,\304\\\254\340\202!v\342\005W\212"
+	.ascii	"23.\002N=F\026V\306u66V\306\245\264\252\2711\366R{\250Q\253\212"
+	.ascii	"\300\326\273b\245\352\035\324\271e\t\241\002\240z)\233\312\024"
+	.ascii	"M\306\245\302\032t55`\343\335MY-q\347;\203\004\372C\\\333\212"
+	.ascii	"U\317\327Z\013\330v5\272\026\350\355d?\201e\034\360t\352J\375"
+	.ascii	"\363_@\271P\324K\375\273&\312f\316\372\250o\"\214\342A\311L\003"
+	.ascii	"\267P}U3\035\366s\235?\343\017\321\315\256\203\375tLp\376\316"
+	.ascii	"\363&8\0055\007\365\316i\034X\0229yWY\312\264=\237~)\247\300"
+	.ascii	"\233B\251\224?\275\3639b\344\351\021\324\365I\341\013\022%\025"
+	.ascii	"\304N/\322Qd\342\304\222S\203\003\367\206i\203\205\220\b\270"
+	.ascii	"\004j\207;\375\262\357\017\361\201\240)iO\333\351=\317\233\233"
+	.ascii	"\323s!:m\275\024\220A\177u\232\232^\273\235\035\244\006\017\370"
+	.ascii	"\356\001\025\354\256\007{\255a\0370\220\355\322\246wJ\261\206"
+	.ascii	"7"
+	.string	">\215\311\202\217\255\346\315m\211\351\333h\bq)\237\245gz#a\224\215\322\037\375\322\273x\242rI\217\364JxP={\274\223\236)N\024\n\330#\375K(\232\230\365F\177\364\036\305\263\360F\357R\226\004\212&*A\001\251\222D\304-\372\375\344\357m\353\200\211\034\343x-\201\336\323\235\003\216+\002\0379\342z[\364\001\201C\250\2014$\221#C3\"\"\222$)\244\003q\005\204 F!4\017\022 \304-I\204\316\025q\322\376o(\034\263\232\224p\2472\273(W*b=\206l\230A^\210\201\336\304\312D\365x\002\221}\b\273\377[9$\274\226\327J\354\tf\272\003Sa\003\200k4T\355A\022<\245\307\237\201\313\206-\220\343\020\013\\9\347\3078\017\f\316\002\243\251\323\217\031$\201\234\373\240\336\203~}\026&\320\352\034j\265\fj\230zq\303J\360C\373V\367/\335\026\254@q"
+	.string	"\350C\201Z?Z\366\324!V]\210\223\341\257\036\326<\230\366\341^Wy"
+	.string	"\260"
+	.string	"\256\227p"
+	.ascii	"\350C\2012\335#"
+	.string	"\305@ \034\336\344r\203bD\341\217:&\336\271\374D\371\236\013\2223\253\343\022k\240\255\356Cc\356\257yi+|3?\262\242N\026OQ\315\2208\246n\245\252\346\214iq\360\224\3502'\346\233\327\303\256\237\247\353;\324\363\3303;y\321\210\221\275\023\021\253\243h5\026\200\277\177\022\304D\022\235"
+	.string	"T\340\360\365K\023O\244\264X)"
+	.ascii	"\350vI\302\002P\363\256\210\363\353\202\215\231\212\3750\221"
+	.ascii	"u\200\034K\240\375\204Gp\350 o\330\372\001\233\205Z\332\233\310"
+	.ascii	"\255\363\372 \243A\367\357>e\316\330#\342@n\240\035\356\377$"
+	.ascii	"&@V\017sg3\261\307\257\2651\364\226Xg\203\260`\213t\212E\"\360"
+	.ascii	"\316L\201s\203\n[\351?\\\235\327\336\b\326\353<\202O~\013\200"
+	.ascii	"(\312\337\216\026\202\220aL\370D\235\330b\206\242Uc}\346\tV\310"
+	.ascii	"5rB\246\021\301\026R\362sV%\361n}\246Y\214\274\341\210\306\264"
+	.ascii	"\021e\231i\021\200.\332\335\200 \265F\263z\332M\0224\250\263"
+	.ascii	"\374\352\243\036\237\245\037\021\207Q\257=\351\210\210i\250\""
+	.ascii	"*\245\212V\231\271J-S \r>\017\302\342\007rm\3706$h{\274\227\271"
+	.ascii	"\274\370\271d\t\301;\032G\216\300\207S\244\006\3045&\022\317"
+	.ascii	"Q\004\220\026g\222\013\350\f\336\357\340\223\376\022\247\024"
+	.ascii	"HgD\330G\340\220$|3\351\234\257\342\263OA2(\305I\235Cr\006\266"
+	.ascii	"{\357\222F=E$\215\\!\006\ro\241\177\200\233\373>\350i~\354\212"
+	.ascii	"\363\310g\250,\272+\240\263-\221\342\363\342\254\211!^ \357\324"
+	.ascii	"j\020\257E:l(Q\003"
+	.text
+	.section	.gnu.lto_isAltitudeOffset.47.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375 \350}\006"
+	.string	"\"L-3Pm\222\016\244DX\250\344\253h\326\005\030\200\b2\302\323Z\376-l\351\377\273\035\346\332\236\306y6\213\343ff\212D\334\0337\027@\341\332\250\355\223-S[\250\313\253\256*\3630\356rh\250\036\030\334\245R\200p\026+\343\250\201\037f\301r\327{\226\233\262l\013a#\3504\211\257G?\260\233q\204\006\353\251t5"
+	.string	"\225\260\tXtp\364\031\007\233\350[\311\026\372ql\223\b\te\222\371\031\245\344\210\024\262\361o~\372"
+	.string	"a3\326\f\343SQ\311\004\bJf\346\332E\261\"v\333\321\n\207\306\211\007\304)\006$d\346\350\001U\364\326\277\3407\370)\002\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getEstimatedAltitudeCm.48.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\002M/3`m\322\001(\033\004\242fj@\212\034\035%\326_*\266WNY!\232E\275\303#)\364\272\024<Z"
+	.string	""
+	.string	"\212@WoE\237#\"\207\221\354-eJ\001\256P,o\252&\314\273h\305\26005(\250eBp\320\n\205Q\n\201\337%\201\322\352=J\245l\237\035\314\t'!\354w<\263|\f?d\360\327\235\237\211\3560\003(8\030\262\263\r\246\307~\333\354\330FcJ \021\005\331\225\b\225l\210\373\370\330\326\330\222\257\361\r\215\255\226]`\221\007\024\341A\262\273:\371@t\327.\020\335\245\305\255\243\345\237\343-\3433ra\233#\300\301\356\032/l\342\316\333.\260m`\273\"\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getEstimatedVario.49.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"BM04`m\322\001@\203"
+	.string	"3P\033\273\376\323\301q\324\277\271?\335cX\312\264f\255\207NR\350u\351\020\\\001"
+	.string	"(&\316\347\226h\326\310\255Ymo\"eJ\001\316`4\360U\217\0037\256zpx\020\rN\363\026\"\\\206\3428L\201\341\206\201r\025\204\224\273\\{\025\245\032\200t\302\376\310\257\350{X\242\223\267\316\374N;K\005\310"
+	.string	"e\311\276>\251\034\366\247\335]\253\310v:5`#%\241d\327\242\264\262(\314\344\303\266\307\276\370 \017\3618\346\325q\321F\025\024$*\273\353\004N\320\316\362\003\355LG\217\317\350_\344\023\211tb\205>O\213\302\356:\255\020\306\255\267}`\033\301\266F\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_.symbol_nodes.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375`D\001\335\t"
+	.string	"\244\016@\002"
+	.string	""
+	.string	""
+	.string	"\002,\177\025\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\0052\026\200\204\001"
+	.string	""
+	.string	"\003\0056\027 "
+	.string	""
+	.string	""
+	.string	"\0054\030\002.\177\031\377\377\377\377\0037\032<\033=\034>\035?\036-\037\005\300"
+	.string	" \301"
+	.string	"!$\"\201"
+	.string	"\005*#\200\003\005+$\302"
+	.string	"%\303"
+	.string	"&\002/\177'\0020\177(1\177)\005)*\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005'+gistry"
+	.string	""
+	.string	"\005%,\0013\177-\037"
+	.string	""
+	.string	"\200\200\200\0015\177.8\177/;\1770:\17719\1772\003"
+	.string	"\030\344\006\003"
+	.string	"\031\204\016\304\016\003\004\032\307\377\241\372\001\001\244\001\003\004\035\201\234\313\322"
+	.string	"\001\344\001\003\004\034\200\316\245)\001\244\006\003\004\033\304\006\007\003\004"
+	.string	"\362\277\310>\001\302\037\003\004"
+	.string	"\221\326\302%\001\342f"
+	.string	"# \300\0021\333v-\213\333\265\227kl\016\215\3400\326Cp"
+	.ascii	"\207\301\341\003\202\303\245\bD\230\206%\330@B\036\276\274\215"
+	.ascii	"\323n\357\313\271\022\231\260\241\020\203$\232fv\230G3\223\344"
+	.ascii	"\301:,ix'\370\305\236a\032t\316\023\332\300\343\001"
+	.text
+	.section	.gnu.lto_.refs.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375 \277u\004"
+	.string	"\262\312\037(pM2\214\001\360\007\310\363\245\250\252\252\252\252\252\252\252.\267\376\222g\302\\hD\255Eh\023B\272Qk\215\020\262e\n\007\322%A\211\200\271\325\262\213Vv*e\177x\254wpl\bl\215\200g`\\@\267X\273\"\332\024\320\022k#\242\205\210\366\001\332\341\271a2\203\332\005\265\202\332\204g\021&{\2406"
+	.ascii	"\330\022\271\"\231\022yAn\234\235\263)xav1?i\311v\333\371D\005"
+	.ascii	"\004\0012\013\\\024\007L\227\031\005"
+	.text
+	.section	.gnu.lto_.decls.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"(\265/\375`\213\035\315\221"
+	.ascii	"\n\363\2145P TBJ\007-\341pn`\262/\312\245U\362*|*F}\013\3331"
+	.ascii	"/]\322U\034\376\231\247\273Em\0031\256\243\325\004\300\204\243"
+	.ascii	"5\324\367A\253\211\233\362\335\303\300\243Z\303\253W\002O|\275"
+	.ascii	"\324PO\237Om\312\202C\r\301\333A\266\224)\313\002P\003l\003e"
+	.ascii	"\326i\226\356x\326\315\375X\331\265a\001B\231\310Ru\016\"f\302"
+	.ascii	"e\013Z\243\267=\322\246N\266\023?[\311wg$x\354(/\001\327\325"
+	.ascii	"W\350*\255\326d\361\230V\262\022l\007\244t^\251\236U\\\0203u"
+	.ascii	"\367^\2370]tDR\364\375&}\027\221\276\327R\236\303t\370y4\256"
+	.ascii	"s\256\3431\347Q:o\330\2757\210\231\214I2i\364\215\226\342\320"
+	.ascii	"\273\273\273\273\343\243\361\336_R\264K\352\323b\351{"
+	.string	"+}\007\221\276\225\244\357f*\304'\336\030\020\344\364\001\n\211\233\242\037%\334\234\2524\372\263\034\277\365\320\225\231J\222q\201\233+c\206\317\322\306\220QC\023\263\266%\315L\032V\303m\030\r\033\301q\274\206\3310\034\027\301n\374\3447f;\237\341\266\267\363^\345\275\3671\326\310|\001\303glcYX\f\310\336[$.\013\213\027\213q\033\025\006\\k\270\213\337\330\214\313\270m\311\006]g\346\356u~\202\377\350\227`\002~c5>S\341to\021\"\002 \t\213*Sw\257\263\005Q\013^\025[\032$\210\320\3171\n\036\020\243I\317h\351Y,=WI\317KR\242 \351\n\346\221\026\205\371Ybk\t:\215\236\223\351\213)\214\032R&\202\273\360\223\005{9k\341-\337ir^g7\261\323\362l\3640\244g\026<{w\307,x/!\025b\024\2746\323 }\033\243\340\261\223\277\370i"
+	.string	"\207]\202\tn\223`\267\353^g\020\352\303Z\222'\215~F:@\325\235\340B\351\331"
+	.string	"\036\337\261\001\274wz8F\301\373\371\312\317V\270\213\205]>5/\331\275\316\241T\031\206KW\243w2\n^\312'xih\350\337e1\332\316\374\034\203\211\377^\330~\346\237\203~\336\371\231\204\265\377a\230?\013\325~\316\222\366s\222\231\237\301\312\374L\346?\221\n*\376\263\370\340\031\374\355\364\363\0301\377\331\240\375\254u\366s\230\3772\374w\340-\200\371"
+	.ascii	"\177\013\177&\340\347\373\277\177k\177V\362s\223\237\261~^\362"
+	.ascii	"3\222\237\257~f\362\263\023\"~\226\372\331\352\347*.\377\205"
+	.ascii	"~\273\345g\262\237\305~~\376\354\365\363\224\237\263~~\362s\362"
+	.ascii	"\347\245\237m\3709\3703\322\3176~\256\341\347\031~\226\341g\030"
+	.ascii	"~n\341\347\025~N\341\347\023~.\341\347\020~\376\340g\016~\316"
+	.ascii	"\340g\013~\246\340g\031?+\360s\002?\007\360\037\205\237#\370"
+	.ascii	"\031\202\237[\374\374\300\377:?\263\370y\201\237\013\370Y\200"
+	.ascii	"\237\207~\026\372\357\346\277\334\377\023\376\267\371\337\365"
+	.ascii	"\277\306\377\030\377\323\376\247wwww\177\223\371y\366G\321\f"
+	.ascii	"6\356\276\001S%\b\211!\2104\371\352\362\354.]\245\002\337e\217"
+	.ascii	"\034Z\346v\\\225Mai9?[KsA\301n\022Hl-\210\031\036\036nN\2724"
+	.ascii	"\272\245\261\364\240\203G\225\236'\225\345\331Y\370\214\250\231"
+	.ascii	"\244[\341\305|\003\246\356^2.v\312\236A\242\270\245o0\3560\260"
+	.ascii	"\026k,++s\227\351t\361\2351\351w\306\322sc\361\274\274\372+\275"
+	.ascii	"\367\022Qa\3720s@y\342|\177\335\rP\027\332\234\022X>4\254\272"
+	.ascii	"&\351\233\213\273\353\312\313\320Kvs\200\025E\311r;\253\333Q"
+	.ascii	"\222~\347H\372\262\005x-\t\036q[\347go\265\223\006\273\311Un"
+	.ascii	"\212Yw/\225\013\037.*G\242\032\375N\217\364.\270\207\230\322"
+	.ascii	"T\330.M2S.NOs\227y]\034]\"=:\227\276\241t\326;\312\337QZ\213"
+	.ascii	"\251n\022\016\003Q"
+	.string	"\232ngu\227\212\252\250\237OOZR\336ZU>*h@\242\244\256\321\026\202\355zI\260\2051\322\350\345t\223\377<<\266\250:s\270\322\363n\023\363\336;\265\343\274L'\237\363\016s\321\377\303\226\025\270vu\336\344\230\2328\251\224\262&!_q\277\323v\257\262*\271A\225\224\262*\3102\254\352&\225O\222C\314[\225\\\206\335;t\225\312\244\007\315;\264\f\273R7\007\032)\276\316\252\344U6\357\320U\336\246\025Ke\225\3242\254Ijh\031V%u\303\252\256\320U61y(/s\350\206U\301\271aM)\241eXSj\031VE\305[\3134=H\211\251\261\352\301_\226\312\353\003jH\023S\250m\351l^\270{\231L\307e*p\357\220&\023\256)\b\2339\265\371p\"\242\251\311)\240\234\254\232W\331\266\324j\336\253\345\244t\241d$\235m\227\t\267%\221\f\271O:\356%"
+	.string	"\352\336$\337\266{o\362\336\333c\016q\336\013\204\3202\013\n\352^*\"\250;$\371E\307\275M\266\306Lj\031f\325<\3722\026\226uw8\223\234u\341\252\230iX\362\353>\035\221fI\375\240k\324\351\3541+\242\245\207F;\b\037\2646bl\215\036uJ\225\360\270\035A\204\254Q&\327\247\311\007/E\314I;I_\361\263\250\2258\303\002\240\242\342\003Nz.\342\005\025!\261\272AE\205\245\321\267UWq\363\016"
+	.string	"\364C\254\n\020\215\266\221n\3623E\037\241[\342$\025\227\352p/\247\340\361\335\035\247\3405\221\243w\221\023<&\225\363\222a\320\004\tW\243\266\207"
+	.string	"\301#\243\004W\035\020M\305g@I\347\215\272\200\253\310\020uB\370\331@\364\017\354\274\267\005\321\017\233\331\2239\024\275\345Jo\263\202"
+	.ascii	"\261\"\306\212\254\321\006\322\335C\373\360\006\322?|\224\r\004"
+	.ascii	"\275\267\2119\001 \346\004v\320\2344=y\350-V\372\367T\212\036"
+	.ascii	"\225/F\256Z\252\241zs\252\260Ai\3641\032\212\223h\035\366\213"
+	.ascii	"IB\0327sG(1&\347\315S\363\320Q\335\243}4\223\237\r\325;\336\313"
+	.ascii	"\346q\264\241\030\016\237YgV/\213\025\2359\236\243\3432\240&"
+	.ascii	"\241\253t\232\223\325\326P\034\207\003dD\351\275\362\244\232"
+	.ascii	"\313\201\365\274\262d;h\264\236l\t\023\023\3535<\253\250)f\252"
+	.ascii	"$BL\363\311\327\227}2\330\215\n\300\253\355\r\030\313\305\303"
+	.ascii	"\315\210\005\273}\002\221#\326\206\245\347\212\312\355\025*\326"
+	.ascii	"\213\345\260\363R5\223t\r\030)CE\255\356.\207\024\005\257\214"
+	.ascii	"\250a\271\365R\343\335\211\231U\225\361\024/[[\032\265Vn\273"
+	.ascii	"\336\214H\003s\223\332\255[.!?\330h\305U\371y|\226\250\261\321"
+	.ascii	"\245IoB-\275\020V\b;\205\250\231\204\303\300V\021CL\025\231\030"
+	.ascii	"\023\304\231,\253u;\245\225S\244\344\032\265RxQN\2729\266\213"
+	.ascii	"\323:\262CJ\326o\263:\215\205\256S\232:3\316\372\222r\306\210"
+	.ascii	"u\272}\342\247u\262O\354\222\352\376h!g\346s\305\f\226W\243N"
+	.ascii	"\234\312^\323\233[\231Fob*=w1\355\024\2266?\330\004\261?\fq\246"
+	.ascii	"\007+\325\265\306F]Y!\326\212\333\250\204\256\322K\335\334\026"
+	.ascii	"{e}\3403\270%6\b\333\3042\261I\254\022\213\305O{e\201\270\205"
+	.ascii	"\262>Nd\257,\220\270\2408V\262\004\021B\231\227S\341\264\024"
+	.ascii	"\001\213\233*\213\204\237\326\352DN+;\304\036Q\341\264\274\250"
+	.ascii	"X\021P"
+	.ascii	"\352\220I\321\342\207N\r\234\020\336\221&\020\021N%G4j\215\364"
+	.ascii	"\250\202\244\345\240#\302O[$\225S\345\013\235\313\365\214\301"
+	.ascii	"\262z\223\236'.=\217\232"
+	.string	"\245J\215\230#\302&&=\017\230\364<\\\322\363\214\245\347\301\222\236g+\375\355\224\225\332\t3\023\207M\212\317:\315\332\223\323\224t\005\237\340u\021\237\340Y\036\226\207 .\263+.=P\300:\303\245Q\324.;\rJ\026\324\016 \270'Z\276t\354p\271\213\363C\2436G\252\203G\t\013\023D\274\030\021\322\350m\216\277\347\030K\016wvI4\312H\034\335*{\330\304\314yE\245\347-\3567\267\367\215M\366\2273\n\bjn\210\013\236\216\346\230Y\243f\234D\226H\024\272:\275D\337\375<<a\236\322\f\331\221\276\355L,A\343dJ\243\335s\336t\272\230J-\215\236\247)}\327\265\022?\217\265S\013\303cN\372Nb\0076G\266\032m$R\035)\033\026<k\300\344\032\211\226S\303\275\312~\022B\365\246\321>\242\343\274\3454\335m92\232\3676\265\234\240:\3676\0051'\300\234"
+	.string	"\312e\005e\013\017}\352\226\366\334\321\033NC!KKk\364'\315\222\266i\323r\"\b]\247\267eV\217\315\323\225\373\221r%\211\261)qq\275\006\200\254\336X\2229s\274(\037\236\324Y\303v\274\034X\226l\025I\335\334\372M\204"
+	.ascii	"\326\234\r"
+	.string	"\307\312\0239\227\363~k <Q\244X=A\251y\266\232\266\372\216\362\"\271\222\365\023\205K\314\251\321\247;\320\240ys\336q\241vo\334\230\244I\337l\334mm]\325BW\351\264\314:\253\342\255\361\263\327\330N\004\017\314\350\3149\313\224\351\264\026PfT.P#H\324\3104j\206\210\267\204\022(a\215\276\007%}\357\0071c\330n\305\225\254\336Sz\236]\2303\266k\232\202A\305\311{\223\236w&}\003\341\376\362\245\201\020\335$\034\030S\346\334\316\352x]\312\312\002D\341\357\310\243\256E\344\b)\324!\020\007\215\243\r\341\360Gc\351XL:\252\306\002h\240\350\r\207? r\025\3320b\"\006#\300\201\211(\034F c\206oF\0058\030\251HLC QhtD2\031\031\335P<*\255Eb/\351\247\016\321\025I,\002w\222V\242\3608\344)\255\277%#bqi\251\b$"
+	.string	"\211\370\263\201\364S=\30014\032\177?8\214E\032'V\243Q\320x\002Hd\002aU\221=\304\244\336A\372|V\0371h\334!\006\215Vi\r\022\325!O\315A\210D{8\214E z\\\215\366?8\216+R\030TY\360\r\200\244\022\203\302\341\257\207\244\"\231P\240\212\354\375\267\376\220\216\276\240\361\005\320\361\247\004D}\306%\265\205UE\252,\004\215\007\f-\321X\325\240"
+	.string	"H\241\320\316\225^\030!\r\205L6R\250H\305\023\202L6T$\036\240%\032\352\211\025\205\017\f\2441\b\364s\364b\035r\260\2525V\025\231\224\224\302o(H\024.\035\177=5\226h\020G\030\376\200\302\365\250\336\360\325P!\004\001V\240\217\310t4\002&!\203\277!\b\352\372[\221&\200$x\321\002\222\251(\274\241\036\215B*\022\323*\\\207\034\0200To\330\030/\206\352\215\235%uE\342\250!@\217\214\027\353\220\203\342\361\327\301\212\374\r\177\016,\n\217\277\027\220\324\365\267$\\\221\037\250\353o\310\004\034\376\200\003\034(<\252D5\230^\306\214\bfT\200C\357\025\\"
+	.ascii	"\343\002\030\274Wp\301\321\321\0053\216\322\3178\262\353\352"
+	.ascii	"C\272\240.\t\327\364J\006\b\251\300#S\261\306:\374\361\f\213"
+	.ascii	"\305\016|;H\337o\375y\3004,\326@\032\203C\353\225^ \215A\243"
+	.ascii	"\2420\200%\032\353\360\267\203\364\375\200E\023\220\306\340\317"
+	.ascii	"\372\033\332\325'A\214\225(\354\021\213C\2534\034Z\244\030\310"
+	.ascii	"\036\222\252\032k\364\250\310#S\221\006\022\221\251x\f\372\030"
+	.ascii	"\213HJ\350\372\253\261\304D\344]\351\205\021\362XD\022U$\002"
+	.ascii	"/\032\325\243\321Z,\036\215z\220\276\2400\211X\244qTWuiH5\342"
+	.ascii	"X\221L6\202\210H\240OhD\252@\341\r\025)\b\211T\217HH?\037P\002"
+	.ascii	"\241\220z\374\335\200t\374)\255\276\nz+\221\251\b\364\251C\343"
+	.ascii	"\322\0179\224d\034\372T\244\260H\004Z}3\216V\242\220)\035\252"
+	.ascii	"7|I\300\036`Q\365Y}\301_\013Ea\357GG4V\270\200B\b)\360\005\261"
+	.ascii	"(\\\205\310\242\321hU\n\n\207IFD\341o\311\bxD\032\275P\021\374"
+	.ascii	"\255\276\343\020\210\203\257x\374\331\370)"
+	.string	"\242\265\316\330\310i5\032\306\331\025\025\325\244y\246\nM\022\305\213\025\266\346\002Dd\031\244\311\332\032\336S\230+T\324\310P-?,\261J{\353\200\356)\211\231g\020\\3\311\223-\323Xj`u\3048\255V\226*nc\274zcu^\246\304\264\023\364\307\330\017OhSx\272\336\2740\317\354\240\370\200\"\247Q\353\305z\261`\230\311\244\203`\314\027U\017E\277\375r\013\006mGG\2338h\032\265fGK\351h\361R\323\250-;\332\323\330\254\214\240\241@\276XY\233\323\245\323\3226n\356\263\211H\372\320\201s\243\246\321-[\372\215\255z\364\310]\035rmY\376,6\202c\2502\3714\007\342\224R\312\320\314\310\2104IsR\n\020\204\203a\240\311\245\017\022\340U5\021*\250F\222\244P\3309\2322`uKE\315J\331q\364\326\232:J\344\nw\023<\231n(L'p\252\263\3055"
+	.string	"\345$Qg\007\007\025La\232\351\252\357\201=S\f]\bav\b\312\377\271r\353\036n\263\251\221Wq\263\300s\236p\251\263\\f\302yh\341s\022J\371)\275\240\376\005S\002\362\013\362\201l\00223\374\217\210\375\210k\024\245/\300 \344\224P\212t'5\023\312\371\230X\237\002\f\322\347{\240?\373 \321\202\243J\037\034Ok\342\372m.\235p\n\331\331\300\244\355\212\264\224$\0162\336\271S\016\272\300\003\337\331dJj7\0017]h\232\032\026apc\264\250f\347\377)h\331t\262q~\224\244"
+	.string	"\\\260^\325\372\221\033\t\342\302^\301\3506\270\244Z\302XC\233\037\002\375\0377\001\216\b=\211|\333\250\216\017\374\356\362\335\304\212\227\233\230\322\355\277\370\235p\034\340I\240q\n~\253\220\006\005_\244\243\242\334)2\353r\313@8\322\353\242?\371\336\2428\336(\022\372\252\356a\227\207h\na\336\006'\303\335\357\030\255@\265\2047\270\260f\363\274\007\3443\233\233\324OXL\303]\254,\202\224\330i\314\306s\225\037\374>\246\272.<\030\203^b\247\227v\205\013y\030\233\"\026Nn=\260\006\355\335"
+	.string	"\367P\035\202\241\024\232\r\365|\315jl\361I\325S)N\240\377\351\211\305f"
+	.ascii	"\373\365\001\017\323\351U\241\234m7\370\353\350j\033e\222\"\t"
+	.ascii	"\207>Y'\270%\324\214\t9g\177\201(\317[\272\325e\024\023 \357"
+	.ascii	"(\355\372u\362\247\265I\001\370\215\n\260\002m)\022\276\266\351"
+	.ascii	"\016k\374 \360\202\271t\263P\031)Dn\3007\210\243G\344\222\360"
+	.ascii	"\031\330\216c(y\nl?\224G9\035\323\032S\247\022}H\373\224\312"
+	.ascii	"g\004\027?7\373]\265\377U\262\263\3753\353h\242\263Z\305\033"
+	.ascii	"\2705<\236J-T\255"
+	.string	" \316[\267c8\267\271\301\201\336\222\340\330\225\025\360\222[\027\202?\277\241J\tI\271\2604\362\221\022-EPM\032,R\272\024\037\357\360\225V\336\007\313k\356\370\207\201\311`+i\004\213\340\332\306\344\367xvgu\201\220\200\336\027\205\243\242\377\037\026c\377O\253X\b\363\222?\273\373\r[\236\334)\375\004\034\026\022\314\322\b\231D\022\266;\031\305\233j\264\007C\023x\r}\220\004\245\031E\373 \270z:\270+\213oB\333\272\303K/\345\237?\373 "
+	.string	"F\317\023\243\350__\r9\340\366\004\256c;\370\007\337t\342M%A\325o\270\"\325l\352\322\335\372\002|\217\236\220\211\302\357\375'or\204\332:<\204a0:\b\335:\314\376\375\2075}\242l\362\320.b6\274tx\361\270n.B\207'\237=\276\374>^\243\220c\225\t\027,\256z\017\376\245*i:\252\365.\210={ \334\306\211J\016\t\365\271\275w\305il\020\336\271\262\266\323\257\214\327\314_\370\302\217(\001caG\254<'kK\316A+\260I\251\033e\222\272r\0320\353\035`:()\307"
+	.string	"\322&3W\320\243\213\367hf\276\004H9R\314}\205\002C\231\235\330+-V\322\303\341\342\350\367\373\251U\361\204\374\245\251\004\264u\254\024\202'\210\262\342\233\265\315\036J\231\361\300\210\031\005\273\250}\t\371i\273\242^8\033\201\261\234\004\343\034\255\036\214\216\333\232\203n\013\314\217^\030iZ4\267\222l\037U\363\030\202\001\036Q\244s\370\301 \366"
+	.ascii	"\013\261\004(\260\013/G\263\321\256\243\201\027\036\220\205U"
+	.ascii	"8fc\306\322\343\265\177$&\327O\002 <\323\013\304\210\316\274"
+	.ascii	"H\202),#\306\377p\277\211mG}JW\004\364\033\032\244}\2156j~[\360"
+	.ascii	"\374\337(1\342\003.7F\222\026\035\265K\267\240g\335\235b\271"
+	.ascii	"\n\313\363\201\030\365\250\2610\376\362\307\341\025`\227\304"
+	.ascii	"f\b\002\325\310\345\355J\020\241DY\216\bMH\001\337\367\362\021"
+	.ascii	"\315S\306\362p\241w\334m,?,&'\331\316D\344D\0260\0364\265F_\365"
+	.ascii	"\373\002G\372\315\020\237g\247\204j\034\363\202\376\332\301O"
+	.ascii	"pL=\263\232\303\226\367G08\356\207\277\205\255\002\035\035\033"
+	.ascii	"\022nf\350\310\354\3241\037\346\177\375\036\342%\354\205,\337"
+	.ascii	"d\247\326c\322\367\262h\211\342\r\371\tjxeo\201z\247\032\033"
+	.ascii	"\037|\007\316o\036\266q|M\326?\271\363\316\313\203\247\332\n"
+	.text
+	.section	.gnu.lto_.symtab.28a7c4b9fb5cd46c,"e",@progbits
+	.string	"calculateEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"positionConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"isAltitudeOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"pgResetTemplate_positionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"positionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"positionConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"GPS_verticalSpeedInCmS"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.28a7c4b9fb5cd46c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
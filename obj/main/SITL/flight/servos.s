@@ -0,0 +1,725 @@
+	.file	"servos.c"
+	.section	.gnu.lto_.profile.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375 \252\325\003"
+	.string	"\244\005\236"
+	.string	"\016"
+	.string	"\263\270\273\275\016\004\002"
+	.string	"\002\001\002\002\002\001\001\351\361\316\337\001"
+	.string	"\002\337\335\253\221\002\003\266\304\313\374\004\006\002\003\002\004\002\005\002\005\002\006\002\006\004\240\342\234\212\n\005\006\b\t\303\324\340\337\r\030\003\002\004\013\f\244\376\226\227\017\r\016\205\357\260\272\n\017\240\342\234\212\n"
+	.string	"\r"
+	.string	" \206\tG/\006A-(A`\204"
+	.string	"\\"
+	.ascii	"9\004J\235\201v@\330\245\334\275\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375 <U\001"
+	.string	"\3100"
+	.string	"\004"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\001\001\003\001"
+	.string	""
+	.string	"\001\003"
+	.string	"\001\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"(!r\241\374,\302\022\344%\214\r`\001"
+	.text
+	.section	.gnu.lto_.inline.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375 \356\325\004"
+	.string	"\302\207\035(\200M\206\003\323h8\030\207\217\351\237e\263M\312\370K\022h>J"
+	.string	"[bq\\\024\315`\006\n\253#\217\310\332[\356\024\037\255\006\037\345\030\335\2248\231C\243\023\354\222\031\016<\350c\372E5\030\007R\350\273\252\021LB\"\354\276}\264\034\242RJ9yf\007T\231WF\335\216\326\r\276\377\336\204\2438>#\300+\212\231WH\320oU-\363\312\340\277E\001\016"
+	.string	";\005x\331\b\023<&\300"
+	.string	"\r\210\343\325\035\335"
+	.string	"@\325\367"
+	.ascii	"\033`\211T\211\322b\313\006\332"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"\205\004"
+	.string	"\222\207\027 \240'\351\377c\377\003\373\314\206\243\252`\244\363\274\254f\001"
+	.string	"\f\352/[+7B\333n\"\223\f]\274\342\216\214D\230\nv\fx\202\204CG\f8e`\255\265n<\343N\003y\230$\363qU/\367\313u2H\017\251zi\264r\\\271\216\266\206\326\244\255\231\351\302\325\256:O\343\027\023"
+	.string	"T\031\340)\216\305=v\026L\270q"
+	.ascii	"\tW\032CT\231\235\2620\276\247+#\241\342\362y\203\314\262\201"
+	.ascii	"*\f\252\333\027\003\210jM\003C"
+	.text
+	.section	.gnu.lto_.pureconst.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\232\004\001\230\004\003\231\004\t\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375 \204\355\002"
+	.string	"2E\021\035\2405\351\377\377\243\017g\001\200%[\021\244\016UA@E\263mI.#MH\2232\0057\326\022\205\rO\374D\312\217\362y\345\327\271\312W\033$(\3208\317\003HF\335w\317\271\321^\224\013\021O\253\177\t\b"
+	.ascii	"5\fN\2609\230\36605\306L\032Xn\001[\006P\004"
+	.text
+	.section	.gnu.lto_.lto.e8084a31f46e90e2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoConfig_Registry.56.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375 \235\225\004"
+	.string	"4\bh"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\303\276\310\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\346\006us\250\377\005uq"
+	.string	"\005\001\006'\001\n\005\001\006\035\001'\0014?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_servoConfig.57.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375`\244\001M\020"
+	.string	"v\036lG\360\262&\0352\215\270\202\274z\263\2020\331/z\n!Y)mN\034\254^\n(e\233\\u\016T\237\201Yc\244\253C\301Fx\367+\230\324\f<\003K\037aM\312\330\302\224\320\034\375^n\240\303\216d\023\271S\nV"
+	.string	"T"
+	.string	"Z"
+	.string	"\016_`\273\234\037\260]\372d\353(Y\215\314fT\f\355n\247\037<\257\205\267\026O\227\232\306\223\257s\004\257\036`\013u\251\205\320\324\334\b\320Zi\242  \016\227=\262Z\252\250\341\270\256\227\035\345\325\003\266\\\217!\016v\327\021lm\270\267\333\376l7\260\017\024\366EA2$\25476\247E\317\347\374\333c\267jt\214\321\037\331lh\224\360\354j\230\001Y\037)c\304c\267\037\3722\024Oqz\354d\242j&\213\032\254\035\273\241\202K\253\314K\023\355\234\355G\373&~\342\364\234\230\013\330\275\231\001c7\\`\224y\031+w1:\360\323\202D\263\001\n\001\210\327y\322f\227$\304\203QMV\212\362\324\353e\2276/\0343AT\247:\202B\2518S\345\241\361\021C\315\340\336f\273|\205G\362cW8\217i\356\256\312\316g\201"
+	.ascii	"\210\335\275\210K?f\273\024\301\221\r\361H\305\231\035\242\242"
+	.ascii	"\302\002\245\223J-/\336\003\316\243\024\223w\341c1u0\021H\245"
+	.ascii	"\t-\335Ki\305\245\033}\246.\305\200=\n,_\007\343y_\307\205{\235"
+	.ascii	"\317\235\016>)UI\205Y$\204r*KD\263.\024\313\221!\376\270\266"
+	.ascii	"\273\253)\354'\233*\247w\275zd<\250\342\314Qmc\370\013\b\tDv"
+	.ascii	"$ P\202Q\314\214\007iR\202\321|\"\023\003\312\354\321\300z\347"
+	.ascii	"\270\227f\201\013\2774\370(\211\341\371 \205\316j \234\213\207"
+	.ascii	"\310\024\342a\210\304\034\305\222\370~xC\341\264\253\n2-moa\n"
+	.ascii	"\033nb\227\333\354+\256Y\210E`/\324\216\367\022\351\\\375\t"
+	.text
+	.section	.gnu.lto_servoParams_Registry.61.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375 \237}\004"
+	.string	"\364\007j"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\203\314\301\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\376\006us\324\006uq"
+	.string	"\005\001\006'\001\340\035\001\b*?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\005"
+	.string	"0e\250\004\017\263\350\024E\336"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetFn_servoParams.62.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375`l\001E\017"
+	.string	"\226\336iE\360\262&\035R\\\217 \253Z\325V\372&%n\366a\245\216\3603g\364\262\026\203d\353\325\335\013\202\202\017Q\013\270\034l\032.f)\326\331\f<#<\227Y\2149\032 \351q2$\3373d\304\222\275\245L)V"
+	.string	"R"
+	.string	"V"
+	.string	"'\200=f\037\200=ze\353\2707b\377\271\240\274|\354\256\246\"\234\035z7\314\325#\324\\\3713G\340\322\243k\261\036!He\005G\200\026\007H\322\303\343r\3273\245u\2220\206\345z\327G-:]\213\345\tj\260\273\316\256\345\341\306n;e\233\201\375\024\001\016]\346\007\375\273\341\323\252\351\324\364C\260\0327\n\340\354v\370\001\2629qF\211\314\177\366_\367|\227E\2176\213\267X\375\263M\306Z\311j\276\017;vW\344\321\013\262\307\003\360\"\333O\373*\276bu\031\r\027\260\373r\023c\327S\340Q\366h/y\232\237\3460\266\304\311\261\313\275\363]\374E\005x\022\217\316\260a\357\036\375\r{T\265-`\310w\016\211\t\301)\313\251 U\035\2758\024"
+	.string	"n\032\3305\365\334\211\223\3741\324\353_w\300\243\205\007%\210I\376\250\326\250\374\220\241\nc{\254$\351\341LX_\034\246\227H\247\022\325v2e&\215l\250\013\251\322\246\251\"@0Ix\240\235L%\0234Rj\323F\f\030E\241\224\322T(TJ\023y{}\361g\236\321\330\3101\321\223\2500\006\335hHu'E\0165\3056\030\324\313|;\033\322\347pw\027:\301\241\206\364\256C\237\026\035\016D\026\031"
+	.ascii	"1\003\373\274\201[?ieQ\\\363!\n\210\305\032M\b\223\231A`\006"
+	.ascii	"\005'@\237\265V\211B\262\020\316S\2259hg\225\260fu:h\027\207"
+	.ascii	"E\224\275P\325x?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_servoInit.63.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375`\\\002\005\024"
+	.string	"V\345\204I\260TN:\364E\343\223\313\211\247\354\025!\247FjG\255"
+	.string	"dR\231\023\230\373\376\247\300\266s\323#"
+	.string	"\210\205\376_Y~`\203\265\271\001>KW\222\237\321|\n=\257i\216\007\316\371\030k\246\013\252ZAYB6\221;\245p"
+	.string	"h"
+	.string	"w"
+	.string	"'\037\020\236\202\027\020\236\036\346\233]\344\345P\275\317(GI\253\326:\356\013\277\016\226w8o\027C\n\356\274\371H?\320\"\212\334\331\\\004\305\035\036\"%\273\034p%\313\b\213\227\237:;\334\f\001\024\371\234\366\034\004\021\034qA\225\354p\300\002K80`\273\334\334\227G\371\251\"w>\237\242\203Z\253'\271Cq\277n\233\3076\213=G\004J\263\005\277\301\301':5\rm\236<\265A\330\346I\317%$T\271\265\261K\334\\!\373+Y\272\030\336 ;\366\336M\3514\bN\357N\3179\375"
+	.ascii	"\242\n!&L\265\236\350JR\251\250\223\214\367~\373.\361\032\336"
+	.ascii	"\246)\243Z+\314>\317/\r;=\215'\335\336\363\323\313\206\347\365"
+	.ascii	"\363\361\260j\255)\247Fy\235\006O\207\212\300\322\322\022\236"
+	.ascii	"\202{\322\347\273{\035\226\323{H\360\211<\301e\236t\tO\347n\323"
+	.ascii	"\324\326\212\363\206\244\360\001\256\220_\302o\315'\225\233\\"
+	.ascii	"\266)\234\351\245\201\t- ^\2559\006\267\301\243\302\350d\025"
+	.ascii	"\204\247\343;,\\\300\220a\305\242\251\243\244\303\204\266k\236"
+	.ascii	"\003\206\300P\255u\305\377\035G\214\214\354\262\362\t\\Hi\035"
+	.ascii	"\271\231]\373\333\331jZ\307\246\037\236\231\3352*6\232\210\232"
+	.ascii	"\3146\326\314l\230u\3200z\230\305\320\21425\333\250bb\332\007"
+	.ascii	"Ym\254\241\321j#\254\274\371\006!\375\365\353\241\272Y\334\f"
+	.ascii	"q\205,\002\241\261\335\253\231r\272:\257\373)\244\373$\337Un"
+	.ascii	"r\035\254\265\326P\301\351\306\226\304O\225\016\b7\273&50\347"
+	.ascii	"\356\202k\337z\017\346I\237\350\376#D\211U\255\365\244\243 \250"
+	.ascii	"X\005, P\002QH\315\035\n\262\022g\315+\034\036Cz\035\331OD-\340"
+	.ascii	"\240[WTb\204\027\200d\363A\233!D\322\300ny\2545\0226\237R\360"
+	.ascii	"\035\220\203\312\343:a\032\002,\n\344\003M\2067(\277\t\270\375"
+	.ascii	"L\263\022\275\177\205\313\f\371\366T]\013\270b\360\245<W\004"
+	.ascii	"\231\341\270\201; r\310\342\276\021\352v.C\006"
+	.text
+	.section	.gnu.lto_servoUpdate.64.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375`\003\b\245,"
+	.string	"ZOD\021C`\336\312p\363\250T`\251\361\"T\316s\253\002\252^\330E\347\242w\212\322u\244\003\202K\373m \212XM\270\347\2603\343\230\f\257\201\023\320\241`\365]\032N{\254\243\304c\260\374\261\311\336[\312$\003\005\001\354"
+	.string	"\001\001|z\020\3208\276\301\277\375J\214SY\244\"1\026\201\336\214SY\037)\202\203\273\227\262oNY.\352\025\330\020\027\236\030'\365\350\356\327\366nK<\372(gC\276m\347\324+0\365\255\t\367\267\256\353\202\243\253@=J\340B\351\321\363A\351Q\225\270\310\3355w+\262\276\251\205\253\312\340\272\256\306&\262\352O\267o\221\221\367)\366\360\020wt\324a\212\236\315\310=\363\005\226~\312\260\253\373\234C/\2604\277\003\363qF"
+	.string	"\364\333q\267,.\016\021[\276G\211\347A\304z\234x*X\226\261\361;0\036\247\320\225\036\274Cl\232\001\f\"Fv\23540\035\254\336\201\3558\t4\257\224\0066\306\303\034O\317\003jo\300\024\303\270N#+[F\222\214\336\370y\032-\313\330(\206i\235\007\354\204\360\275y\356\n\333\342\276\333Q!p\200A\304\226\347\341\204u]\227\225ab\337\237\357\276iwQ\354\016\245\0024\262\214\021s\366\255\354\261qw\237k\316\236x\230\243\006\2573X\300\314q\353\240\361\021\236h\233\361\241hi\332\235]\266\307\364\335wM3Z\374fw\241.w\344\340U\267\\[W\255\007\207\333\315\360\270\024F9=\275\265u]#py\027\251\375\331\321U1\305W\036\335S\245G\337o>\001 \237\032\033\026\027\366\233\027a\\\267\331\256[\026G"
+	.string	"L\"\331.\333ujb:y\r\fy\227N^\245\2237\351S\276Ho\373\036\241\274F\315[\324\274\002N^\242\223w\250y\205N\336"
+	.string	"\315\033\324\274@C^"
+	.ascii	")\357O\363\372\240\274E\224\267\007\345\345i^\"\312\273s\362"
+	.ascii	"\352\240\274\352\311;<y\323\223\027m\336\363\344\355\346\345"
+	.ascii	"\346=\203\341\030;$\277u\375*\214\263\326\241rI>\345o;\357~\030"
+	.ascii	"\306\367\244\343\372\006\037\352>\360l\220Q\220m\024(\244G\201"
+	.ascii	"\272\307\316OM\016\213\013\217\367\266\246\247\266\331\376\214"
+	.ascii	"\t\2276\265\f\346\022ej\244\356\332\244tI\rl\356\375I)\200^\352"
+	.ascii	"e\256\261\254\367}M\205\375\331Z\300\200!=\n\240\207h~jc\303"
+	.ascii	"=b\246\376\351]\r\033\370\312\246&\260\325W\273Wc%t\345\356f"
+	.ascii	"\370\036\007\007zy\327\353\340\341\003_\371!=\372\323 \310\362"
+	.ascii	"\2248\276v\246\306\227\264\315\226\317\247w\035\323\253\235\236"
+	.ascii	"\324]^\356\323UM\272\020Gs\224\340\305\267"
+	.string	"\345\f\236O\017\321\372\b\331\212\2556S_Nr\231\305\345{\256+\326RO\027{@\033\236\336\351\236~2\215\330<\215$\247\356\330~Z\314\320\021\373n\366\330\202X\251wG\224\340+w.\304\375\320\352\253=j\245^V\006\016[\355\242\276\344_\332\335\303F\267$\227I\215v\332i_2-\213\013\367l\324\304\311\034;\033\365d\025\345\342\304\224\221\005\325\324\024\025\224\321FM\301h\321R_\250'+\252\027UG+\243\213\250\024R+P\030YH\235\2302BUY\031\237\216\226\252\305\261\312\350\202\212\252\312Ht\303z\2271\257\276\221\251\303\352,%>m\266\3031=N\335jx\301\217\272K\375\316\245G}\266\237E\247\037\265S\337\355\347\233\036n\222\313&6j$\032r\t_\271Em\324\337\222\374K\"\231\352VQ\267}\235-\243pO\233\255\b\034D\035\235\037a\376\362\276v\206\332\200"
+	.string	"\316b\254+\003\r\264\200\003v\202\315\274\2679<\001\232\250uz9)\230u\2732\035]\210D=\324\277r\036\2731\250\003\017\217\016\251\211\372I:\241\036j\302\353q\312J\341\034\241~\260\307\026\324\001\272\253 \235<\316\261w|\225U\201\363&\250\033"
+	.string	"\021$d\343\271#<\310v\200z\020\311\024*\342F\215\002\t\262Be\340\002\342\3211\321i\263E2S\240f(M5\202Hf\200\232\250A4\245\230R\n\225\220H\030IZh\rp\002\031\242\262z\021\220\265CT\"\211r\357\357\363pY\215\356\272\303D\344 MV\274\262\201\262\217(\036.\033]bN\360\302\360DNP\246\371\251\316\3550\315\223\331m\022\216\300\t\273\325\030\367\n\247j\340X\353Z1\200^\025\274{b\021\354\b\\\020\207\263tgm\352\007\222\251\235\205\243h\240\361\367\341F\250\270\347}\002\356\2773+\323\371by2\177F\007H\345\f\221N\252O\224!\005\025\003\177\032\022$n\230\003rg\023q\025\323l\345B\373\210|\032\264\335\003\016\257\366\317\332\370\330\236\277\025)\222"
+	.ascii	"\034\177\206\264\342/\002\224\030\"\310\026P7\3733Q\227\251\240"
+	.ascii	"\021\021\b\313\023W\263\034\035\3321\273\237\r\325\315\rG\201"
+	.ascii	"k\n\032\246\222\327/'~q}\036^C\225\326\374\240\215\271(G\202"
+	.ascii	"\200up\212\037\340\030}\3518\220\034\036\261x6l\013\201'Jr\314"
+	.ascii	"X\003\033\0166\361Ry\372\f\336\350\241\320\321(\303F8\2516/c"
+	.ascii	"\350\261\277}\316\365\026\300\304\311\001X\377u*A+\363\250\351"
+	.ascii	"\262\223YZjZ\314\037"
+	.text
+	.section	.gnu.lto__reset_template_77.0.67.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375 @\275\001"
+	.string	"\244\0023"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\350\007\334\013\320\017?\202\210\2000\177}\274\001{\276\001y\275\001w\274\001u\273\001s\273\001"
+	.string	"\004"
+	.string	"*\202a^\2342\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\275\007"
+	.string	"\024\013\361\001"
+	.string	""
+	.string	""
+	.string	"\0029\177\023\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002>\177\024\005\303"
+	.string	"\t\200\204\001"
+	.string	""
+	.string	"\003\002?\177\025\256\2005\013\201"
+	.string	"\0054\026:\027\305"
+	.string	"\030 3\031\002\300"
+	.string	"\177\032\311"
+	.string	"\0332\034\005=\035\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005;\0368\0376 \001\301"
+	.string	"\177!\377\037"
+	.string	""
+	.string	"\200\200\200\001\302"
+	.string	"\177\"\306"
+	.string	"\177#\304"
+	.string	"\177$\312"
+	.string	"\177%\310"
+	.string	"\177&\307"
+	.string	"\177'\003"
+	.string	"\020\321\371\216\307\003\001\204\001\003\001\021\003\023$\003\003\022\324\223\344\274\001\001\204\006\003\t\026\007\003\t\025\244\013\003\t\024\244\026"
+	.string	"\035"
+	.string	"`\350\234\203\020\232\025h\265\326ES\240&"
+	.string	"$"
+	.string	"$"
+	.string	"$"
+	.ascii	"$?\240a\2774m\004\303e\b\206\02645\310\2201\230\306\364rG\240"
+	.ascii	"\017`\353i3\310\230%\311Pv\300p\021\305U\220.\r&\036"
+	.text
+	.section	.gnu.lto_.refs.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375 gU\002"
+	.string	"r\206\021\026\200K\322\00130\003\253Q(\210fE !\266\265&\311\336R\246\317\001\213\002\032\017\313"
+	.string	"\3150\2770[\321O\364\021f\037\312\033"
+	.string	"_@8\241\177\372\355W\177=9\037\b/\307S\237e\257H\345\"\267\277\021"
+	.text
+	.section	.gnu.lto_.decls.e8084a31f46e90e2,"e",@progbits
+	.string	"(\265/\375`&\036\r\216"
+	.ascii	"\212\347\0343Q0\220"
+	.string	"\312I\007Z<\013\222\035\307<E\337\241\312\266\377\037|\037#\267&\226~\007\357\261Xtr\330\350Hf5G\267\303v\327\355:R\365V\305\224\206r\235\016\244JlE\216f\013;\230-\312\333R?\325\007\252D\237q\367{\262i\262\245L\001\265\002\032\0030\003\321h4\312@l\200v\322\3405qu\337\232\337\227\331\2170\235\252Yo\262\302<st\372v\322C\003\313\223\342\345\b5\347\0270i\316=\346c4|\206\323p\031~\262\031\026s\206\362\030vB\206\271\360\334\334\333\\s\232\3410\314\205\353\204\210\340u\006U\241B\305\217\n\025M\326\303\256\217'}#\325\3271\212\237\016\357\251g\250z\006\243\236\363T\005\356\324\n\230N\305c-Q\033h]\307Z\230\0137\357M\273\367\n\320c\006Y\206\327)\333\361\035?\007\340-LFH\223T\025\025\210{\243Q\036\340\307\227Q\374|\262\f"
+	.ascii	"d\322\306\003H\247\007\2549\240|tz\245\007L\\\334\214N\347n\246"
+	.ascii	"\232|\224\251\267\200\345\370\t\307\3610\255\027y\003\026\032"
+	.ascii	"\\|\374d9\026S\361\323P5+\2524\205\373I\337\240\270htz\256R\317"
+	.ascii	"c\277\320\033\247\361\024\273:qdd\315\200\336{\2530\025~\362"
+	.ascii	"\033\243\235\303\330\311{\2757y\357\275\005\277\320\371\215\243"
+	.ascii	"\360\231]\331n\262I\013\003H62\232\360\335\273\252\370Q\221S"
+	.ascii	"\246\304\206\226_z\236\302n8\\\001Tf\362)G\247\274\306l\374<"
+	.ascii	"\200\333\316\002\203[\244\330\005Ks`\371a\244\323\273P\037\345"
+	.ascii	"\003~\254&t\226b\342\267d\256\267\007\001\265\267\266N\201l\342"
+	.ascii	"\367!\365.\250L\306e\374L\301fg(<\366\033\246\365\256\367\256"
+	.ascii	"=M\204\215\331\223N\177\202zN\361\263\321(\247\370]\003\265\331"
+	.ascii	"\304\317\207Q\374~\201z\b\324\363\372\036\254\213\301[=\033\243"
+	.ascii	"\370\221`\023\277/\006Ka\225O\315[v\357ZBMNA\003\353\364+\243"
+	.ascii	"\370\251l\342\207\006\370\367\002?7\351\362\237\314\177>\026"
+	.ascii	"\\\374,"
+	.string	"\206\027\205\313\3772\377\315\374?3\303\226G\360\367\215\237\221\320\375\034\301\317(`A\363\263\3759\204\016\230\353g+rw\341\347\347\2703\360\267\361g\267\264\3776\034\347\357\003D@;\303\371\337\366\377\355\277\333\317SS\344\376\303\245\370o\300\377\031J\374\235\364\363\017?#\177\276?\003\361s\017?\373\360s\020?7\261\321\317<\374\f\203\313\376\373\374\366\200\237\311~~\362s\330\317]?'\371Y\353g\034?/\177\216\372\331\351\347\344\317/\374\334\302\317+\374\234\302\317$\374,\302\317\035\374\274\301\317<?\267\370\277\345?\227\237\203\376\253\371o\306\024\374<\301\317*~\366\3719\375\271\377\367\375_\363\037\357?\335\177,\377\257\374\007\373\017\364\177\356\277\032\215F\243\277=\361\247P~\001>\bBt\372\033\2511~\366X\223\251\2606\037U\034W\317\215)-0\262\277\241t\224\036\322\300\233f%\252S"
+	.ascii	"\272y#\204\372\267\030?[\254\235*4\231l8\220\205\255K\234\004"
+	.ascii	"<V2\240\326Xi\322\244\327\306\272\252]\026sG\214\2211\272^\377"
+	.ascii	"\016k'\235L\362\324\250Qf\257\323\337\255K\305\276\236\375\305"
+	.ascii	"x7J\026\222\250\201\336\360\255j[[\\\\\335u\307\345L\233\336"
+	.ascii	"\250\372:\355\256\033\273-#gC\220 \351%>\267\tL\024\332\303\344"
+	.ascii	"\242\205E\311{\t\016\227\262\265\311\026\016S\031\346\325V\033"
+	.ascii	"qE\2054\233\303\241\241\205\304J\022\026K\217L\035Y\233\002\352"
+	.ascii	"#8\311\365\216\341\340\225\271*\353\364)\r\225\204\362L\224\227"
+	.ascii	"\"\317.\302W~\326\213\374\345`\263dJ@BO\017\253\013\037\221!"
+	.ascii	"i\0326pK:\325R\325\206d1\351\364\326\213\312\214\203~\301Q\305"
+	.ascii	"\0066\025&'D\025\347l\033;\350\344\240D,\211\203\216\271\361"
+	.ascii	"5\256+cg\0259h\216\257\361\340\334\033\367\305v\333Gc5\220\016"
+	.ascii	"\322=\372G\013i\036\235\305\317nv\325\333\252\257\236\256\367"
+	.ascii	"&\273\331:\276\306\223\\o\021\020\342vx\3611\331\224y'\322\333"
+	.ascii	"3\265\233\214\342\347\200\375Ro\271\324[%\352m\022\365\366\210"
+	.ascii	"z[D\275\325Ro\201\250\267Y\252\002]\334N\357\032\275\3445|\235"
+	.ascii	"\2261\334]A\357rJ\202"
+	.string	"\333\245\372\226\321\312\367\214\317\350(u\2755\370\t\021Tq|\227\311\004\002\016\021\246\343\n\352\035\3650:\367\202\335{\rh;\0355\344:\275\231~\342\261\261\003\n\332O4x\302\2741\241Q\243\3160\343!\325\351\263\207`1<^G\216\b\321\377\3572-\357\2756n\326\273l\3229\3370\003\375;l\231\201\377\351\265\024l\335[doO5b\215\251\252\323\377\n\334\377^d\211\273\336\245r\f\013\251\204b'Ub\275=\004\270c>\256r\305\222J\233\267\357z\371&\261\244tP\256\315\245rm\"}n\262\211\274w\225\362Q\2261!Y9\206%\245\034kJ\225\270\311\213\274cL=\324dSJy\245)\345\243\034c\222R&\261\244J\004\331#\0225\204\023\2545\226R&o\024\224\025\323\322\247N\2716o\336\275\\\346t\227\f\334k\325\\\3461Q1[S]TS\032S\223\327{\357"
+	.ascii	"PMY\315\233\254Sn5\357\335j:\272P\027 \327\272\253\305uH\037"
+	.ascii	"V\367\311\351^\002\240\356E\362\255\273\367\"\357\275\300\245"
+	.ascii	"\325z/\021>J'\024\324\275\314\037\250k\205ls\272\267\313\216"
+	.ascii	"`\223R\216e5\205\332\242\2149\257\214\025\311\316\233\207\265"
+	.ascii	"T\307\220\317\373t\357\3452\252S\352\006\031\037\352\337Bt\322"
+	.ascii	"\216\2311FO\307\207\333\225+\2356Sw\201\031\231\273\241r\033"
+	.ascii	"\216\362\263\221\177_\376\362T\254y\307\356]w,S\016,k\235\246"
+	.ascii	"@\277\236l\306\tl\255S\013\326j:\326\031\320\265+\221\322u\026"
+	.ascii	"e\353[\266\353\247i\357\236d\354q!\223Ppp\335v\375\250\326d]"
+	.ascii	"1\311)\323\304D\b\223%[d\274\024\201[w\236\324H#C\t\243\335\334"
+	.ascii	"Y\341R\326E\344Dl\022\026;\262\303K%;\263\252\262Hn\223\364\210"
+	.ascii	"=YI\323\251-\302:\341f8a\343\264G\200m>\2040i\351\364U\221\351"
+	.ascii	"b\215t\225\335\302\362\252\353\324\026\371Z\032'\246\006u\376"
+	.ascii	"\350j\364\251\371Au[Ee\265\354\235\316E\212\335\032@\264.,0\276"
+	.ascii	"\253d\002\361\320\020\203\365\003\353V\353V\b\013\f\256G\004"
+	.ascii	"\022%J\2476\310Y\253L\024\345\017\013\004\t\230\2646\235^uR\255"
+	.ascii	"\017\n~\245\246G_\026\t!vE(\351\264m\217\3535\224\233\222\253"
+	.ascii	"Nm\363bv\322\236B\254,\017K\227u\327\324\251\265\262W\374\374"
+	.ascii	"\234\335q\0367\031fsQ\365A\360\347~V\307-\021n;~`\241a\3768\300"
+	.ascii	"3\274*'\031\365\300/\352mX\033\026\307O\0239\346\001\035\267"
+	.ascii	"M\030\337\275L\240\034-\252\033I;u\213\303-\307\b\"\354ztjot"
+	.ascii	"\323\247\226k\254\324\262\316\200Y\363Z.\371\312\217\032\216"
+	.ascii	"Z\032\"fZVy\033e\2256\371[\342p\321\366\330@\201\321:61\235\332"
+	.ascii	"'\013ei\330!\354\f\340\224\372['\353\324\253\n>\367fYa\003\026"
+	.ascii	"Ij\021i\243\266\275\357\370\331m6i\225\314{\243\201;\246\225"
+	.ascii	"\004"
+	.ascii	"<p?\262\330tj\233\200L]\360\344\306\250g0\274\316\013\003\343"
+	.ascii	"\345\213\005z-fI\226#\272\013\330\021}=\246\323p\035\323\347"
+	.ascii	"&\245\360u_\203i5\256cz\340\225\327\3062YdG{M\263\261\227\237"
+	.ascii	"\335\327\320\367\226\346\362\237\356\353/|\006\346\245g\357\213"
+	.ascii	"\214\312'\305\273\236\001MJ\025\302\302@\357]\371Z\r?;\315\177"
+	.ascii	"\326{\313:M\223i4\\\307\\\257\215\0345\350\0315\003\250\330!"
+	.ascii	"\263%\257\352\207\346L\332\032\244L\247m\006\310\244\232\023"
+	.ascii	"\242\255\f?{O5\303\325\266\346z9pC\262\244\250\377\225\251\377"
+	.ascii	"}u\030\225\013\364\212N\211\372\037\022\365\277!\352\177?\324"
+	.ascii	"\377\256\324\377\230y]n\306\254\354\321uQ\353;,OMSj\003\261\211"
+	.ascii	"_gi"
+	.string	"-m\367\343\364x\261\001A{R\337u.\f\311\202\366\267_cy\323\3758=w\304\t\325\351\1772\324\367\\_\3113b\366\214\252o+7h\321=\035\235\266\234\352t3&\005\211+)<Z\356\357)M\245\343p\350!\312\006M\247]\245\341\336q\375v;\356\202\346\275L\035\327\323w/S\017\363\002\314\013\244^YG\316~\351o\300\250\317c\024\277\0356\361c\250\320\333-\207\256\n\324\t\334\332\032\343\001\255\367\306\005a\304\234U\340\332\320~\026\030\360\263\321Z\215\305n\r\0223\356\027\267\2363K\256\210t\332N\233\2566k\264\324\337\\\231\231u\0273?x\222\006\345I\242#.?Za<:\006\223\210\303`\361h$*\021\341\030_8\nS(\na\f\223L\304@ZZ\032\241\204\f\302\343\260XC\022\017K;:(\300\300\202\t\342\260x4\006\t\213^ \021\021\207AE\343\213\240"
+	.string	"\220\220^\020\211JD\340q\350\307\203R\361\350\250D\004\272\b\n\221\322\030KDI\302\244\337\217V\304 \341(L\241x\302\347D\214%\245\022P\034\227\202\214\226L\020\021_\344\020]\364\215qH\3478D4Z\272!\032-\331\243\243\021Q\210\364\023\36604\246F\243\260XT\024\004\306XR\"J\213\307%[$$\032\r\221\202\300\"\241\361EJT\032\036\211\204F\340\213CFK+v\212\301#\2424F\361h\034\032\tc8q\363\243\025DC\304\027\305 \242\004\216C\032"
+	.string	"\215F\304aR1\230#<\006\213\226h\310\371\321\212\242\341\322\317\222\222\022\013EC\030\216B\243b\360X\"F\260X\034A"
+	.string	"a\321\260X\024\356\360\302qH\\\001\3478\304\302\202$\341\321\030C\006"
+	.string	"\216?Z\341\"\210\250\224\224\244D\304\"F\033\207\212\302#\322\020\205\242\340\013\035\2069\360T\220C\013\345\320,rh\241`\263\b\266\020\214f\001\243\205b4"
+	.string	"'2\016\021Q\210\301h\t\305\211\206E!Qh\244\376\202\026\024\264\320"
+	.ascii	"\006\360\032pP\001\007\025\374\256\001\007BB\034\264\020R\337"
+	.ascii	"B\310V\260\"\203\f\206\204\307 \322R\222\3608t\024\032\205\305"
+	.ascii	"\241\023\302!\243 \022\nB\243\240\221\206\2420ix\3649&\r\213"
+	.ascii	"\307\3248\224\024,\006\211\303$\013#\230d\213\206IVx\f\026S\035"
+	.ascii	"\204E\027)\360xT\300\361G+\216/\226\216/\224\206\222xX\n2\026"
+	.ascii	"\205;\f\213E\n\\iIX\f:*)\025\203r\216C@\243Qp\006\245\341o\007"
+	.ascii	"\241\t>\307\241\026BG\342\360\205*<\006cH\342\001\006\235\035"
+	.ascii	"\204E\3268d4tAT*a\347BB%(@\203\013)\250D+\214J;\024\205\306\240"
+	.ascii	"\343\221\321\020\311E\020q\030L\n\"*\032\203V\020\220g\303\224"
+	.ascii	"D\327\247.\366\211\032$\t\335\016<2\240]\025\231W]\235\335\302"
+	.ascii	"\313\345\275\314\213$3\001\334\223\310\222\273\333-oN`\366\354"
+	.ascii	":\265v\177S\327\2309\331\322\251\325\362\267\317\321e\361\350"
+	.ascii	"\221\305&I\243\3309uY:2\247\236\227\020,N\2630u4\326\225G\315"
+	.ascii	"]\r4sm$\345*b\004\316\212\355\352\001\023\323\367\245SK\305R"
+	.ascii	"\261q8H\0226\254\320\340\342\273\314)\240\337\276\335\306Y8{"
+	.ascii	"\004\327\027\226\205\263U\200H\036r|]\204\255\312\332\033\216"
+	.ascii	"\266/,\235\036\007\207\333\355\02429zTuj\331l\033\023\347\231"
+	.ascii	"\227\347\365\302\030\001\306-\254S+\305\256\tq\232M\021s\350"
+	.ascii	"\222o\213\357\b5\253\005\214\372Z\003$m\345Z\267\202\240u\224"
+	.ascii	"\216\334\023#Xg\026\307\215)D\336\314:\007\355\311\030*\235B"
+	.ascii	"\201b\311B\030\023d\217k\307\215\212\231\262(\267dk%8\2051\341"
+	.ascii	"\255\253}r\327d\207\027\237N\027\250^\027\261\333'k:J&3M:\265"
+	.ascii	"O\353\354\3112\363\222\203\312\327\227\rc\237\265\351\216\351"
+	.ascii	"\004zI#emr\033\026\202l\250B\0211\306\022\021\"H\225\210\bI\222"
+	.ascii	"\244\003b\n\020\206\202i \b\256\007\022\240d9\020*\307\030\215"
+	.ascii	"$I*\205a;\341X\200\372\220~\351\004\353S<\355\201Y\276q\217s"
+	.ascii	"\2452\""
+	.string	"\306\203s\241\211\002\223\377P\347n<LWti\207u\273\005\244\323\212r\025\354\023\234\330\320\275f\203\317\035{T\250:b\376<\212\247\227\266@\004\233(I\027\030\007?\251]\2530x>\352>\351{\r\016I=\223\217\211\265\367f\246l\031\344\fg\0211\377\325\253\346\225w\343\212P\\_\2016\203s\024I\376\351\314\373\027'\223pg\213\363\376\275C\273\344\215\322\006B\376\232V\246\312o\336IH%qo!OE9\024r\201\336'\223*37\002\256\311\001\216Z\006\033\304\314(=\020\"\210R\343\017\030mK\200B\262h&F\251\305\366\331\301>>\373\200H;Rb\310J/\265\240?\301}a\255\205\355\264\374\201VC,\352\203\003\257\253r\350\247N\304y\201\314\376o\n@{\357\364<\347\305\315r\311~\027\006\037\371\022&\363\225[\262}WTa'\017K\222=\036\353b\215\003\226\265"
+	.string	"\024\262\241,\315%:\347\323\337\221\314k\030h`"
+	.ascii	"\001\"\365\031\324\233M\372o\006Q\fN\252,\273D\266\rb\244\346"
+	.ascii	"\231!C{\2433l~\346!{@\303\230\200r\226\221\201 \"8\035\rgN2\253"
+	.ascii	"9g\275\277S\256E\373l\272u>V\256.X\300\217\352\022\307>GbK\230"
+	.string	"\354\030\372\216[\250v\baqcn\245\332a&\267\200\257QBC\300\025\222l\td%]`\017\260n\036\341dB\030\216\301M\026l/^\t\235L\320nv\344\322 &d\222!\211\177\372i\307\027\353\201\212\330(\244\240A\355\373\346\260\360XBb\331\311}\211$Lq'_\3223o\0162\263_\fS\3247\255J\364cl~\253:\"\354\b\213\352\206\255\226\253\234\002\227\26253\311\335\324H\357\3043\307\320\2211\265C\226\020\236\177[\266\223p\345\224\313\013\376\320\231\222\307w\333\337@\347\"\025\335\201\217\200\032\323\370\375\320n\362(\230\232x(w\216\254\n9IygV\2662\033\200\352\"jk\177\205\2603\235\r\317\354\372O\006\237q\344k\006\"\320\255\340\210\310\260\020\230\314p\367L\030\020\005\225nc\223\273l\260E\225w\274zq\250\367\001\335\362\007V\230\2534\250\001\215\214_\315c"
+	.ascii	"\230\223\313\250\350}\223\276\327\301\2309|\216\243\212E\273"
+	.ascii	"\022\316\240\324\277\205J\202KJ\364\264\307\313}\020\263k!\353"
+	.ascii	" \316.q\334\213"
+	.string	"?\310\325\2754\233\226\206m\350\0049\220\322%\213\276\253\263\013d\202xo\256\326k\317\304\004\354O5\teZ\333\221\245\bn+\020\202^\016\314O\343\252\254?\205\306\273\272{\267%\001\252\221\201\321{R\035\304\322\001\275\234\360\264\2012\340\"\303\031RU;-\2140\206\200Qpy7f\316$\214\242\347#\004\031v'J\267\325\303\n\005\342Oe=\240\033L\252e\016c\332(Dc\376\037ly\006\276\006\231_o\354\351\f\320\340\325\327&\251\032\0251\017U\262\007iB\240\346\337\312\272#\364\013\255\240aR\200\321X\267\031\305\b\221\256\232\345~\2720\215\212\232T\310_"
+	.string	"g\342B\n\"\031\360s\335\251\016\305-c\022\324\331\007\002Y\334 \224\276\201\252\276l\215\r\256\335\222\273\340\204a}\366\251|z"
+	.string	"\"!N#\344Ag\324\303\227;\006ZJIc(\027eP\24239Piv\006nG@j-\251\3208\357:\213\223\265\f\355[\026}=4\2141\272\350\202\242eN\0364\235*\215F\271X\344;\177"
+	.string	"\020<\030bo\233\n\2432\242\232\367\271\313\300\237\204aC)`\b\2770b$xt\n\034W"
+	.string	"K\341\330_\230g\3501\274]:\275\025@&R\355\344\245\367\332C=\255\311h\331\264#\027\237J\344]z!\3640\025o\026O\305\305\031\001\2126]]\255\377\032\237\361\374\371\251}\326"
+	.string	"9\344S\272 \306\033\034\271\365cG\245:\205\260\373\022\316'\023\263S\262aU"
+	.string	"WM\021\324\025\3043(\315"
+	.ascii	"=/\273\f.\340\300\374\033\234\013oZ\263\004\271\004\374\213\255"
+	.ascii	"l\263/\251\2360\330v\350Cr~gz\357\362\330\267\375\002c\3224\333"
+	.ascii	"`<}\373\375\333>}{\360@\371\332p\"\\\tot\257f\3775\022\253\357"
+	.ascii	"o\357\017\366\237\277~\002\373U?+.\326\236\250\357Z\023o\032"
+	.ascii	"\312e\345\033\347\370|\336/A\007\31370\246p{\302\017\242\373"
+	.ascii	"\223\367\304\271\021\r4\271k\274\362\bn9\177\237h\005"
+	.text
+	.section	.gnu.lto_.symtab.e8084a31f46e90e2,"e",@progbits
+	.string	"pgResetFn_servoConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.string	"pgResetFn_servoParams"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"servoInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"servoOverride"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"servoFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"servoUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"servo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"servoParams_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"servoConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"servoConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"mixerGetServoOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e8084a31f46e90e2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,715 @@
+	.file	"setpoint.c"
+	.section	.gnu.lto_.profile.b652e25bbf1bb152,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b652e25bbf1bb152,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\235\004"
+	.string	"\304\004>\001"
+	.string	"\020"
+	.string	"\230\357\333\333\002\f\002"
+	.string	"\002\001"
+	.string	"\002\002\002\003"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\004\005\354\207\264\260\016P\004\002\005"
+	.string	"\002\006"
+	.string	"\007\002\b\006\007\b\t\n\013\016\017\020\367\376\334\304\001\016\021\374\351\233\315\016\002\002\002\002\003"
+	.string	"$ \360\002\252!\017\2370\013#\201i\007\372\315\264#\214\223hW\2059Y;\336\002\243\263\031\024\243\f\003\027\030\364H\022`\032\006\034t\356F\r\326\300z\316\005N\031\211"
+	.ascii	"\334e\357\332XJ\337\325\227S\001\206"
+	.text
+	.section	.gnu.lto_.ipa_sra.b652e25bbf1bb152,"e",@progbits
+	.string	"(\265/\375 j\355\001"
+	.string	"\224\002^"
+	.string	"\004"
+	.string	"\001\002\002\t\002"
+	.string	"Y\001\001Z\001\001\020\002\006\001"
+	.string	"\001"
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004\003\021\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\007"
+	.string	"@"
+	.ascii	"` 8\030\314\343\"U_%\370\r`\001"
+	.text
+	.section	.gnu.lto_.inline.b652e25bbf1bb152,"e",@progbits
+	.string	"(\265/\375`\242\001m\f"
+	.string	"F\026I<0o\222t\020\007\304\272,\035\324\023\032\343~W\264\006\302\207\003\225\027\352\333\313\335\227\217\267G\200\316\f\261\307vT2Cj\024ND\250\245J\033\364\376\312X\177d2Z\333[\356\0244"
+	.string	"5"
+	.string	"="
+	.string	"\037\025i1\362\302N~\376L\247g:\367v\301\365\302\251\226d\346s\361z\224jf&\364\233[\221\231\002\240\037\223\037\224\333R\273\337\307\231dV\004\036/\205.R\022\214\343\246*\033 \2300\025sLa\005\375\324\314\254\032\375Q\255\277\306g\324\354\315\203E\r\351\233m\240\250 \375\003\246Q\220\177["
+	.string	"e4\304"
+	.ascii	"|\001\b\236oS\016*'\022\f,e:vt\217_0\237,\245Q\352(\212\017%"
+	.ascii	"BXbFLGGdHy\320\2619z\224\004\f\026\027p\\\343\232n\205\204#\242"
+	.ascii	"\300h9j\256\302\211\377\257\251\313\314\204\216\301\3754W\222"
+	.ascii	"YY\016\300\361\304\241\032\243A\207\225\215\027\346\245\340P"
+	.ascii	"D0\214\364\365\232j\241J\001b-\255\341l8\200^s$\0214L\030\260"
+	.ascii	"\356\277\324,) 0\002\342\330\230y\275$\003Wrp\206O\221:\306`"
+	.ascii	"\270\025Fh\023hJ\366\254kq\017%i\203m*\036\257E\022I\212\003"
+	.ascii	"\325\001\324@X\311\200\253!\233\253\226\005{ \030nCy\231A\016"
+	.ascii	"\310,\f2\222Z(\300\363\241\211(i\363Q\fd\265\240\361\250g\261"
+	.ascii	"X\330\344\226\243\327\344\272\250X\024\300\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b652e25bbf1bb152,"e",@progbits
+	.string	"(\265/\375 \353\005\004"
+	.string	"B\007\026\037\240'\351\377g]\017\336\244\252\272\354\307\212\337\254\352\370k\237\274\342\276\263\366\350\3356\221I\006<=\363\004\301\351\277\006\274yU\226\201\036\240wz\210\337 \216\021\331\005B\212B\017\033\356\346\272\361\214O'\306\023\353\247o\305^\261\316Dk\341\265L\332\245y\026\037\001\017"
+	.ascii	"\372\b*\\oU!0\\\024\301\245,\242\020\001\256P\371\300\032\334"
+	.ascii	"\2638u\241j\201N\255\316Y\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.b652e25bbf1bb152,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\231\004\005\230\004\020\230\004\021\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b652e25bbf1bb152,"e",@progbits
+	.string	"(\265/\375 O\r\002"
+	.string	"\024\003C"
+	.string	"\004"
+	.string	"\001\024"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\374\007\374\007"
+	.string	"\020"
+	.string	""
+	.string	"\001\002\017"
+	.string	"\001\002\020\021\001\300\007\002\021"
+	.string	"\001\002\r\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"8\203\024\025\334%\2142I\330@\033"
+	.text
+	.section	.gnu.lto_.lto.b652e25bbf1bb152,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_interpolatedSpInit.33.b652e25bbf1bb152,"e",@progbits
+	.string	"(\265/\375`c\003U\030"
+	.string	"\266,\232I\300VQ:\024D"
+	.string	"6`Bm\026'g\231\370\223g\353\367\301&]\205\255\257\374\277\231\031\315a\332 P\037S\312Wr\031^\340\247\f\373\351X#\r\n}\204\333b\347\035\032\034F\372\353q\247{\2435\322\310&r\247\024\200"
+	.string	"}"
+	.string	"\210"
+	.ascii	"\364\367\231\264y\307q{ODX\235\036\003\b\225*\265V\233S#\030"
+	.ascii	"Ok\302O\3736~\343\366\335\210\317\324\272\004\365\243V\036\216"
+	.ascii	"o\306S\363\336\022O\307\007\020O}\263\251\320$\301L!\361\323"
+	.ascii	"Rkum\013\357C\336\035\316\333i\270\363\346\373>SL\225:\334i\b"
+	.ascii	"\240\326\032\243K\n\r\224\320\035\315P\006\212\357\233>\237t"
+	.ascii	"\224:\024\237\252\005\265V\317Rw\342\026o\273f\233\307\336\025"
+	.ascii	"\001H\265\032\025\330\225\331\331#7\343h\006=w\227\346\227\253"
+	.ascii	"\362\235{\022_\334\341;\210\306Z\221t|\247\r\264\361\305\251"
+	.ascii	"?B<\375f\240Qcg4\2036\0177\227\311\376\353.\331\255\367n\231"
+	.ascii	"\357\376\230\377nR5\315\n\247W;=\212\323*:-\322i\272\323!\235"
+	.ascii	"\336pz\356\364\005\320.O\2564U\253\211\240\227\032E\201\300\370"
+	.ascii	"\357\357\331\317\3417\375<$\254N\016lhy0>0/m\337\034\211\201"
+	.ascii	"\237\222\212p(\t\237\"Uk\3259=\322s)EndB\005\037\037\361T\265"
+	.ascii	"\233\"I\251$\0221p\200\324\323\217}\001h\241d\226\256\270d\213"
+	.ascii	"'\272\266\205>\304\300\226\213Zk\002?\310\205\374\030\003\020"
+	.ascii	"P\226\322\312\3144\360\223\\[\303k\276\244\373\246\257\224\\"
+	.ascii	"\211JZ\334n\255\025\267\016\327\367q \314\177\341X\320|\031$"
+	.ascii	"\236\316&\245\225\331y@\240\261e\007<\213(=^\265\202`\020K\263"
+	.ascii	"\307\206^0\237\230\355e!\304\253G&\213\211\r\315d\264\032\005"
+	.ascii	"\016\263\"\226a96\0173Z\221-\006\302e\023\n\232\r\311\\\036f"
+	.ascii	"/\"\027\254\006\302\225C\300\264\242X\315e\243\321j.\222W\377"
+	.ascii	"\272K\276\357t\2112\332#\272LV\025\331\326.\224isrK\340\234\334"
+	.ascii	"\357|P\220&\227\207\3412\221\333Z\325\223\216\334\212\232\251"
+	.ascii	"\332\325\262\326f\320`\276tMnq\366\235|\330y\023\036\035&=\007"
+	.ascii	"\226\260\366\245\322\270+%\343\256T<\211}\004D\250a \345\234"
+	.ascii	"3\bQ 2\021\2158i\f\200\002\2211\263\016\020`W3I\322\032\"%\277"
+	.ascii	"\211\244\260q\216\030\355\223\232D+\315\255\007\3444\032\234"
+	.ascii	"\375\3177!-\177\026\343\2373`'!P\001\240%\344\360\245`\310|l"
+	.ascii	"^n\371m\346\335\277\231\272~\0246\223\325@\222\325\231\264\272"
+	.ascii	"\270\257\006C\027\225\377\216\004\320\335\272-/\b\345\360\327"
+	.ascii	"\3404\272\357\333\366\310\326k\221\360d\333\215m\332=G^\245\323"
+	.ascii	"\25353p\266\275\255\273\205<\243\0241\341H\300\246J\245~\245"
+	.ascii	"\267$\035a\376"
+	.text
+	.section	.gnu.lto_interpolatedSpApply.34.b652e25bbf1bb152,"e",@progbits
+	.string	"(\265/\375`'\031ul"
+	.ascii	"j\260\354&J \320\322\351_\377\361\263n\002\2772\321A\352\340"
+	.ascii	"\355<a\204\265\357\035<O\316\242"
+	.string	"\300wc\220\215uSr\362\267\355\\C-\376\260\035\264\tC\r\004\022iDN\300\007\036\372\321\231\325\351+\333\231UUu#\021\222d\247\224RM\002.\002l\002\\t\235\211\256\363P;\013]\347 \2453\320u\376ig\037\245s\317u\346Q:\357\270\263\216\3229\347:\343\\\347\r\327\271y\235o\2563\363:/\257\263\362:\337\353\234\274\316\353u\376v\366\244s\267ZOd\236\342^[\365\025\361\330#\325\032\330\303$ \224&\354\326\353\336\353\366\322\375\245\333\257\273\355\376\353\016\323\035\330-\330M\346fn1\334c\270I\bDL\356\360\256q\260\267ps\351.\315\327}}B\203i\300F\241S\350An\n&R\031\373\002\231X\300\250\027\306H\225\277#p\255Y[\224\"~\334\256p\353r\327\030\366\005\bZ\034\b\214O/\334:\317vX4\"N\2420\260\307\355\262,-hZ\206\216\361"
+	.ascii	"= \3163<\226n\201'`\356\244:\311W\313N63\224\271\311\314o\202"
+	.ascii	"\220u\207=c\222\005L\212\020\"\240\215G6\3243\034\336\r\262,"
+	.ascii	"\036\025\203h\357,\034\310L\226\205\353\002\206eY*\236Zv\222"
+	.ascii	"\231\271\257\364\035\224\271]\361\344\350>T\247z\215,\313Z9\033"
+	.ascii	"\350vrm\237\333\311\377\240\241]E5%\025\005\365\344\344\241\251"
+	.ascii	"\003\323\222\2223\211\003\322\221Q\021\321\220P\020\320\217O"
+	.ascii	"\017\317\216N\016\316\206\346\rs\251\274\311\365\035\312\235"
+	.ascii	"\327\253\032(\212T\265\262\256\2422\354\2515\251\311\022\307"
+	.ascii	"FL#\263:\307\034N\013]jLG\215!t(1\375$f\320\235\332\366\320\236"
+	.ascii	"\340M~\335\301\257\317\231\306|\361%\276V\342sv\361\342IZ\234"
+	.ascii	"CG\2654\022\226,~t\327FwuiW\274\b1\215\217\004'\262\353\241\265"
+	.ascii	"\251\250.\315\212\013\255\3161vP<\b\350g-j\242s\237\020\234x"
+	.ascii	"\017\b!8O"
+	.string	"\b\275\263F\275\025\"i\304\264\271\025h\005&.t]\232\234\353(\251K[\3429\376\244q\224\364\006\245\246\262\005\334\332\223\276\321 \003gn\340\346\313\272\2646W\"\246\275\365\340\324/['o\324\330z\315Q#\262:Y\226m\252\235\371\257Q\214\1772\364`+!\246\031\256@G\236P;\257\035M\315\314]\331\202eYv\252\332Z\263U3\177\ffF\303\f\204&\315\246AUZg\326\304\272\036\305J\222\3632\346\037\231F67{\202Dnt\276\353\362\320T\311\226\221:\257,A\220\211us\276\341\362h\300Z:\366c\f\0313f\334N\346\274\262\203\024\034\001\227\037\3078\337|\207\313+|d\004\334\3608\257l#\255\223\241\r\216\032Y\033\276\373\026\001\263\276\371+\231V\266\314\354L\317\357C4%\254I\\<\363\307[\330jb@Q\244\206\267\273\344\3075\331\205\201,H\316\205~\301"
+	.ascii	"\004n\334\270\235TJ9\241\221M\324\253\214\002\026+r\353\307\361"
+	.ascii	"\315+_,\317\260m<ve\376\315_\275\3453\377\006J\033\243\213g\022"
+	.ascii	"X~\367\315\001j\275\362O\270)J\033\357?_\353\033\322L\031\005"
+	.ascii	"\356\203\210a\317\261\201O\376\363\033RZ\267~\326'?YF\032\305"
+	.ascii	"\314\253C\272t\"\267K\226eKp\257\320\2108\270\351:\3119\262\274"
+	.ascii	"\251Y\257\363\267g\007\370\317m\263Y\343\2473\226\21525\360\013"
+	.ascii	"\264\245\221\022\232y\225\375\377\225e\244\214\375\376=\215\214"
+	.ascii	"z\225w\234\371\271\345M\355o\222\272\035\232}\031\343x\216gv"
+	.ascii	"\300\313\233\232\365=\330\375\306%\311\341\331\227\265\334##"
+	.ascii	"\230'\2738\276\361\020;X\223\210\346\314\037\231\361\312\374"
+	.ascii	"\343\230\373\253\325j\225\277\t\363u\356\2646\241\273\213\264"
+	.ascii	"^sW\320,tH\177i&\023r\235\203\374\270\316>\302\300\232\260\371"
+	.ascii	"k\007\004^]\375\327\254\365\354\300\346\006Z\2609\253\263t\347"
+	.ascii	"h\274n\034\275\327\\@\r\032\355\245y\006\001\355\327,\243\375"
+	.ascii	"\232\007\350\2669F\267\3150:L3V\207i\026\340:\277\270qvq\235"
+	.ascii	"\257\256s\213\353\314\342:\257\270\316*\256s\212\353\214\342"
+	.ascii	":\237`:\233P:\227`:\223X:\217\270\316\"\230\316\001,\235\001"
+	.ascii	"\270\316!\230\316 \226\316\037\256\263\325u\256R:S]\347\251\353"
+	.ascii	",u\235\243\2563\324u~\272\316N\327\331\303un\272\316\035\256"
+	.ascii	"3\323u^\272\316J\327\331y\235\223\2563\207\353\214t\235\217\256"
+	.ascii	"\263\321\365I\037\307N\337\3417 zx\247?\202lz\017\217D\202\235"
+	.ascii	"\002M\357[\346\260\276\303_*N\024\031\253\020r\330C\372&\334"
+	.ascii	"V\004\337\214\240?A`\226\242\031\217\306\364J\206k\334\372\016"
+	.ascii	"\227\236\351\257\217\340\",}oYt\276\322\273\237\2641\352u.\305"
+	.ascii	"\371LD\303\243\217\373!\017}\251/\322\272\244\037\362\336FJh"
+	.ascii	"\306\341\223\376!\245oH\177\364\034\236\250\r\322\337"
+	.string	"?\016~\374\217?\3726t\262\3273%\311\024#\243o\270\021\214\220\360\251@\3420\315\224\2425HF\343_\344P\330\263\220\214'\340\321x\r\202qs\367\007\303\020\330\363*\004\343c<\032\331\037%\251\222W\205\354=\360\005\006y\002^\310\257A~\212\357\317\307k\375\217\3776>\276\003\237\026-\017\270=:\343q\321\023\034\333\212\236\t\267Hr\016\007\265\313Z\375\250jb<\321\027\275\322o\311\231\241X\240Z\274\251DX\370\354\210\3267%k}V\330De|\330\367\235\\UZ\367\3650\036\354\373Mn\351\257\204\271\241\217c ~\366\365OH\252\344\025\236\371#\017}\320\177\375\373\t\375\020\320\013\375\220\33742\350{LK!r1S\344\302B\037\307=\3301\232Z\003|Q\036\t\323\366f\211\243\3652\326*f\232A\211v\323\366\346\2762\261\r\306\243\365`\333H\3242m\233]\317+\220"
+	.string	"\35778\317\307z4\240\027s\003\372\024H\350\336\260\264E\275\032\364q\354>Z<Zo\224\3678m\177\274^\231\3506m{\264\276(oq\332\356\354\370\001\036\315}\236\357<\317\367\237\347+\023\215L\333\236\347;\335\225\310\035\b^\200G\303"
+	.string	"\013\211M-\262\021\350\347\265\336\353[J\350\363?\337R\306\236\367\371.\\\"8\215\214&\267\004\032\376\364|#\372\005\216\004\213\233\216\257^\274\270\235\354\371fY\r\216mQ\246\02459\237\"\275\363:R\214\372\016-\350\241\240w\036\305\021'Pg\302p\341\341\371\035uf\313\347\371k\345\255\225\276\231A\360ME\311\f\322:3=*\202;n\326;?e$\r\213'\3247\235\032z\347\033\316\217`-\215\354|\273 \0060\262\020\311]\316\307\341<\032\026\022U\315L#\233\r>\225\262`\205e\331\347w}:\270\304\306\300\270^\364\334"
+	.string	"\362\024kr\215=m\004\021\2738?:\270\270x\334"
+	.ascii	"\322\301\345\325\345\245#\254\006X\230\327\330S\214+\002\256"
+	.ascii	"\255\255\253#\027]]8<\274\"\330Z\307\300|\204}]\215\365\b\013"
+	.ascii	"\323j\212\205\215m=a<0\026\026\366u\243\253+\207\213\207\220"
+	.ascii	"\261\225\353\353)\006c\313\006\020.\260\233\036^A\236+oU\215"
+	.ascii	"\201y\205\361\030\343\352a5\366\200\003^\021tY\201y=\277\254"
+	.ascii	"\266\304zXU!"
+	.string	"q\030\017.1\253\261\26001\253&\036\333+\373M\322\336\031}3\246\200\333\345O\323\276\363\332i-\322\016p\255z\361D\376l\211\t\277z\027G\240j\336\324\027\357$\362e\314_\266\243\351\f\225\031z\301\263\320$\235\202\034\313\262#:Y\205b\320\255\\'\331!=\022\352\246\001T\211\222\333I\027\337lPZ*\033\003~\331 JE\003\267H\217K\262z\355I\225\252&\005((\200\231j!\267\213\374\021\006Wf\340VHN\006\t\236(R\325\\\261Y\323\342U\374\325_H\351\233Y\005\317\342[<\221\236\264N\305\257x\026\177DF\032%\006n\227\214+\276\r\347"
+	.string	"\2430\274\320\201\212\307\211\266q\004\2142\201j\251\340\235\320\002\017S\240YD\361'>\305\257~\322\267\002\276\306\243\370\253\247h\346\304+\341\3228\002J\231\250r\026\022\207 \251jJ\274\211\025\260\226\207%\276\003\027\001\243Qk\240H|\241\033\222\361\346\300;\342I\210\030\361\343E<\245q\n\200\312\007\005\001\370"
+	.string	"B"
+	.string	" \344C<\221\007\276\246z*\266\026\346\232@|\030h\\o9\343\177\016\b\375`\016\352\004\352\344v\262\251j><\210\037\202\234FB\271\3253C\241@\245\334\246~x\347\331\227u\311\251z\253'\nt?n\227}U\337e\346"
+	.ascii	"\217\n\273\264\351\360q\214\242\261.\3257\225\274E/\320)/\250"
+	.ascii	"\236\031u\301\261\215\211\215"
+	.string	"\2307\245f\337\235\276\327\201\\\210\nx4V\242\361\274:i\020y\225\256\361hR\235\343\217\330\022\363\026\271p{$\247\227C\251F\321\016+\317\004\005\326\314\374-\221\275\220o\366%\240k\367\224\246\036\352\377Q\352\247\336\350\205\250\227z#H-Y\242\276g\200\372\273F\267\347dZ\0214\344\300+\322\214\247\361hO\317d\230\365Oo\203nO\332\030\201\372\250\201,%\221SfFF$H\222$\205\306\221\005\204\030\306$\254n\021\300(\347$3$B\222\024\024\322\030\037\f\020\350\270\217f\271\235\316d\t*\220\" \376\327h\t*a=\276\241\251z\201\317z{\013P\017\255\246WV\200pw\017Ta\301U\370\355\375U\325\237\207\270\tBmz<\bE\314\263F\305\237\f\227\2247*\257\250>\273\263\271\021\214\273,\261\017W\003\233\304\016\352\346\352\027\272\003]\225\357\\o\023\200\260\304\321z"
+	.string	"(0~=\352h\2065\273\226!\026\201\227\026Bjv\26348(\007\222^\262\007)\321\261.\"\n?\264lV\235\001H\302\323\272\204\255\022\257\007\371\374X\250#\226\016\270+\320\255\322\223<k\217B\037\321\263\223\0344\037\224rn\363\204\004(\265\335\237$\017\023\332i\263\004\314^i&\351\312U\026\212>\365}\3664b\277r:\272\343\221\317\203\201\305\316\264U\371\317\301\266\224\311q},f\013^\262\306\265T\n\2136\003@\306\360\332s\301\b\035\267\366\3350 \334\376\3662;\356\265\220\336\022I\360?\026*\333\024\331)OSp\251\276EI"
+	.string	"Ed\346\245|\025\371)hW;\261\256\240O\362\255\013\024\355-F"
+	.string	"9\260F\202\017\300Shr/\270qA\312\200\224\231\300k\241\3617-f4\354zc\247\356^u\005\371\360\206:\311\361\3242=k\300\032\022x\250\2702\327D\211\356\027\366\345\264\020\022\006\033\006\020\327[U\363REk\f-`\315\341\212\325.\033\363\264\222\256\342]p\325MF\205\267D\357q\316\314\360="
+	.ascii	"\013![\210\001\212\260\216\216\362\013\026\"p\303'G\274\237\242"
+	.ascii	"\371O\342Io\261\332\227\236\035x\346\235\2009\310\315\236.\343"
+	.ascii	"C[\225r\251\313~\250s\3571Hf\274\001W\247j1\222\210\256\241\007"
+	.ascii	"Ixt\r3/\021\257\251\342]\270\256\001\314\342\003\367iM}\347!"
+	.ascii	"\3626\306\200\2519O\360j\021y\216]\321g\243\005n\261\243\207"
+	.ascii	"F\246\016\033\317\333\376\207.7\367\\\211\214Sb\007\030\0206"
+	.ascii	"\377\210\307\261$?'\3674\235\001\233\007\244\213J>)\022\210\035"
+	.ascii	"-B\367;v\203R\227\347\f\342\330\r\330#\351\253?\231\231\316\301"
+	.ascii	"\222@\203\035d~\235\211\b\177m\255V\376O\200S\222\307S\243\t"
+	.ascii	"\314\3622\035\360\237\304\231\264d2\324\2325\230Kb\204 \247\377"
+	.ascii	"\331\034\312\201\005\022\251\350whX\2611\333\032j#V\021sH3\200"
+	.ascii	"\033T\036\t\024:\364\035T\201\330\006\266\007!3H\324f,\017\345"
+	.ascii	"\306\t\334\030\211\225\345\311u\201\341\307\233\3610J\024 yb"
+	.ascii	"\031\340\323\235\300&`\022.\0061\n@a\360\234\204<\3031\227\264"
+	.ascii	"\200\237\t\016\250\340d\337\274O`\241\001\035\370\320\307\003"
+	.ascii	"\255m\220T\273\004\034\257\313_<\257cX\354\377\031;\212:m\300"
+	.ascii	"\212Y\321\255\273bck\347/DYNgv\004\021,\3322\271\245\304\206"
+	.ascii	"\260\236Qx]f\210\210\206O\354\340s5\247\034|\220@\330cQ\344\017"
+	.ascii	"\317U\223?\027\245\0037\270\302\034\300t\r\004\256\351\250C\211"
+	.ascii	"\335Z\001\232\275C\361\254=J\364\003\274\027\324\313\361\252"
+	.ascii	"\271J\330(\331\271\316%\276\021\035\"(\254[\030\367\026\321\251"
+	.ascii	"lA\276e\310\314\212\335\376\205\347\032\337\341\227o\260\204"
+	.ascii	"\341Z\035\370\bEy9\265\330 \013\323`\252\204\261R\326\224\225"
+	.ascii	"1\212M\334E\226\313*)\304\2430W.Pr3\300\250\226z\274\304\336"
+	.ascii	"#\216b.s\231^\322\347`\016\004\270\302<\031\204\t\026\317j"
+	.text
+	.section	.gnu.lto_applyFfLimit.35.b652e25bbf1bb152,"e",@progbits
+	.string	"(\265/\375`2\005\215\036"
+	.string	"\226v\277J\260\324Q:x\302\334\306\342\313m\003n\241\370\202\001\256)\235KC70Sh\226\316\242\204+\215>j\314\213\252F\377\271\335\307\214\353\206\037\374c\277\366\235;\335\222<\237\256\030y&4\327\254<\316\267\377\255\021B\310\226)\005\254"
+	.string	"\230"
+	.string	"\253"
+	.string	"9\262\330\340p\322`\213\306\"b\245\340\373\0336ZV\353\222TV\255\225\3063\261\227\266}\032\257\361cc\221\305\241\2239t$\242\272Rk\305\021x\214\371\222<"
+	.string	"\363%}\361\237\333j\264\231,v\232%I\367\307?o\310\250\031Q\212\204@\267\025X2Jz-\t*\230biI(vv\336,\031!]v\257\340\211*\244\215y\005\221H\002\265\326S\275"
+	.ascii	"T\360hO\023\270\245\211\223$\002%#$n"
+	.string	"B\"2&\t\013(\247\372~\020\n-\035\372\2311M\306\0303!\021\335\363\246\326\352-\022\032\335\267\333>\332\326\261\311b7\243.\240\325\362&cS\020ze\032\020\304\252\342\207g\034\026\253\025\310[T\211<\020k\255\007\336\303v\330\257\024\026\033\326`-\326\003/_\350^\t\273\204v\213]\374-e\262O\217\307\243\025\323\026\366q\3742\317\361\007x\361\207\371\215\377e\327./\336\267rm#\327\265]\323v=\333\265l\327\261]\237\2736w]\226k\222\\\323r\275\344\372\002\236Dcj\210;\326*\342\230\245v\225ZO\376\216Wu\270\016\227#\256\242j\255\264\0166\355\345\355\037\233f\007\\2tFi2:\243\247\021H4\251\214\222_@*2\364\2441\272V@\250\237IOzFI\201\001\211\277=>F\231l\322\222R\230:\"\264X&\034\211\261bG\316\205\223\223\313\231/M\312"
+	.string	"\206V"
+	.ascii	"Z\322\005RH\200Wx\374\253\345x\2224\337*B\232Z\247D(=\247vX}"
+	.ascii	"\257P\224Km\317\\\210N\203a\255\325\201\037\344F\235\357\364"
+	.ascii	"\322\027v\273\"*0t\351\371\005\344\n\332\343m~2\254\220\224\311"
+	.ascii	"6\347\231\247w1\325Dh\261\330\317"
+	.string	":\020\236\357\344\f\275}Q\317|yzNQI\035\005\355\321\367\361\336\251\351\355\370pv8\036\336n\307\313\021 \241\202.\202\217'\347\343\243!\347\245\007\302\3464`\300\331P\366t\034pH\347\324\370xt\274\036_\256\207\363\355\350\3500X\300\361\350pv\270\034\237\036\256f\200y=9\037\234\217\307\363\301\321\212A'+mq\243\267\020[]A\364g\263\321%g\362\265\267\361Fm\0362$\202X\253y\325h\215\244\241\222\215\243\240\255\265\002\321(\223\203`O1\332\0030%\"\254\323X\006^u\231\212-\"\330\223\314\205\336\350\207\004\177\241\247\272\314\311\212)J\310Zk\235\305(\fu\241^`\225!\026)Y2\030J\243\257\372\036\225\350:\361DIe\250AH\306\020DB%2\nR\234\254\001\240\002\221\261\2729\021`!\224\206\246h+\303\034\302\t\304\001\225~<\023\244\272\330r\213v"
+	.string	"7=\002L\002\260\375\210\036\267\341\027\2278\254I\262\345\333\247U\027\311\224\2460K6]\300\001d\324\260\245(9w\311oB\2625\357\325\354\023\231\022<,\0047}\343r\262\266\333\366\360\270\320\353\262f\346\026\311\232F\364\315-\237\247\304:\f\356\213(\304X^\227\356O\213\3535,E\224$x!\330\034#+ \270Y\206\207\366f\002z\337i\266\b\345o\330\311P\321&\325\204\207\375\2143\020\027\374\201"
+	.ascii	"\\\375\227\250T\3472\0059|\335\024\314~\265^!\355\237S\230\223"
+	.ascii	"\005j\366\277\240o\327\230?"
+	.text
+	.section	.gnu.lto_shouldApplyFfLimits.36.b652e25bbf1bb152,"e",@progbits
+	.string	"(\265/\375`\313"
+	.string	"\005\f"
+	.string	"\306\227TB\020Q\225\016;\"\005\030#\360IX>\220\310ACd\024Y\340\273\035qe\020\230/\031\223\236\324p3\367\227\303\023D\311\005\346\256F"
+	.string	""
+	.string	"\240"
+	.string	"r\256"
+	.string	"`,\375C\263F\252\215\371\226\354-eJ\001E"
+	.string	"?"
+	.string	"?"
+	.string	"\034X\377\020\301\201b\306\356\227\351\307K\217P\263\344O81\304\210\025+\317\364x\341\020\022 \331\020C@\006\026\026*\236*\325\342\245 fw_\342\331\341\2412'\234\335u\256\274\n7v\333\fl\037\260\277\t\332r|\310\0173\235\232>f\221A\242\300\265\313z\321X\027q\344\203m\222]\261\235i\237\304AH\017\261\no\354j"
+	.string	"I\261\273\006\234\241<b\036"
+	.string	"{\204\007\200=\332\366\006\001\311\245\177\001 \240\266\2349\324\005-RY\362\334]\223\272\006\\\363\205\b\214T\226\330\366\204\213\330E\331\335\004\276\211\237\340|\017\217\2260\312\257\036\375\021\366x\275t\0309\345\313\376L\251\036\366\341\356\256\003\234F\241\003\355\321t m\013u\037.\353\0368\320 4\310@Z'B\346\021q\231\346\342-\364\021e\335\266\211\262\312\267\207\253-',\360\324\314S;lG\305\234\024\345\324\250\347\250q\312\027\026\325\003*\006\025+\020"
+	.ascii	"M\204^\316\206\307G\2217\304\351\031\b\242\250\020`\023\2671"
+	.ascii	"\034 \227Q\212\032_\261L0Z\ryU\305\232!\267\253\350\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b652e25bbf1bb152,"e",@progbits
+	.string	"(\265/\375`\216\001\035\t"
+	.string	"\262M46P\213\323\001Tbc0\005\203fV\273fkV\343N%\2045+\301\"iS\214=\034\220\231\341,\306\302x\340\037\370\007\376\333\377n\"\"\322|9$\231\3342\005\317\211S~\343\"\202$YM\t\215j\265\341c"
+	.string	"\027N\311qX\200X\253\n_R&\210\204R\026tx\230\256U\021\210\255\212J\007\035\230\255\"h\253\006\231\024!\037\031\333j"
+	.string	"uM0\265\273G\221k\2107 \346|\270\343aO\207?\034\016mx@\303\004\031\316dw\377\035\2065\tpaL\004\261\360%V,\217\353\004\366\277G\001M*\356Z\355m\242iY\206m\032\206ax\261%~daU'\361V\377\374:BYRW\374\374c<dvwS\\\211\377\243C(  \003\271M\007\200Q\bVZ\025\222\241\026\346\273ad}(\236)\365\b\016\340"
+	.string	"\016p"
+	.ascii	"\007p\0208\374\201\200\263\264\264\205y\330\220\200\336\267\270"
+	.ascii	"-\022K:\006\036%\226v\34209\261\006\2079\f.\376\021\t\303\214"
+	.ascii	"Y\231Z\353\217\001"
+	.text
+	.section	.gnu.lto_.refs.b652e25bbf1bb152,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\235\005"
+	.string	"b\016(+pM2\214\001\200\367\bx`g\\\021\247\377\377W\222\362\031"
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"b\251M\013P\013>{\263\255\021\262w#\220\337\b\221)\317\211\331"
+	.ascii	"\314\264\005\322\026\3475m$\375L\353H\003\240\273\270<\213\n"
+	.ascii	"Js\024\227\335\204e'\261v\021\353AX\336\303\332'&%\352$#\"\323"
+	.ascii	"\016Y\007\221\376\361l\017hwp@\337h\256\221\021m\214\265\016"
+	.ascii	"j\0336\203Z\205\235\240FP{\2406\243\326\2402\201z\240Y\240\262"
+	.ascii	"\230\312N\321\n\032z\002,\264P\232\322^\224\246r6j\366\331>7"
+	.ascii	"\t\007\004\001l\371\240\356\315\002W0P\023UC\024"
+	.text
+	.section	.gnu.lto_.decls.b652e25bbf1bb152,"e",@progbits
+	.string	"(\265/\375`1#5\235"
+	.ascii	"\232\374L8Q0\220J\352\026\3505@\244@\213\006\310\325\360\003"
+	.ascii	"\274\272\025!0f!^\377\253\344\336\322r\265\356\377\365\300D$"
+	.ascii	"\301vj\325B\325\315DY\344"
+	.string	"\306\253\002!\b\304N\220C\027\221'\201 \327\230\312\rc,\025k\306\027\274!\367\237b\204l\231R\n\016\003x\003\232\003=\300\\K\223!klYA\262\334L\347\210''!\225u\275\217(S\262:\031\346\272\235\256\313\247m;\236U\272\036\t\315\223.\307\322\244k\2323\364\204\317\211\337\217\037^\324\034\325\306Z\370\347,\203\253p\343'\334\2775\270\177t\270\177[p\377U\367G\375\215\267r\247\r\016\265)e\257\322\340s\327\324(S\362j\377\322p\325\317\360=\236\312\243\357|\031\372w\370\225~hO\020\203\217]\350\363\347\344j\006\265w>\0177\273\3203L\203I\217\251\203\351\3601\035&OF\362R\365\314\031\332\021t\003uC0\301;\177\312\307~Y\232i8\271\242\272t\3224hw9C}N\2348q\242\007dj\214\227\033\265\177C\260\317\007\356_\026\356\337\025\356\037\r\370q"
+	.ascii	"\365\347P\261vx*\362\252:\003\366\251\207\360\025\360\263\201"
+	.ascii	"\333G\006\267\317\r\267\017\013n\037\031n\337\021\334>\036\270"
+	.ascii	"\204o\tw\017\r\356\336\027\334=5\334='\270{]\270{>p\367p\340"
+	.ascii	"\3565q\253t\270\325+\370\001\265\tnU\013\267\272\003\267\332"
+	.ascii	"\304&\246\270\357\032Vq\241\340\2766\340\276N\334\227\t\367E"
+	.ascii	"\302\r\275{\003\343_\\\214\n9'\345\234E\340\004\311!\305\345"
+	.ascii	"U\207\363\270v1\036&\273\030\t\2349\037\271\230\03559\037\355"
+	.ascii	"\270\033\340n\200\352u\305\005\305\247\366\257\301\236\004\250"
+	.string	"\375\r\204\017j\n\232wv\274\230\331\ry\265\177\f\266y)n\2622\334\277\004\367\017\301\375<p\277\375\f\334g\256\006\267\317\341\3666\\\342\n~\340\013\267\003\301}6\205\033\213+\341\226z\b\237Gq)\036]\300\313\332\2418X\367\216\240\031\372ZxO\230\274\332/\340\366\005|7/\317\027\360u\021\277t\372\001\3660\027\363(\to\322\020L\320\227)\226\277r\206\356\344\254A\262&\315\253\255\001\223.\240K\236\240\013\300\355$|\236\347$|S\007\341\343\361\020\276nW\322\355I\374\213\304m293Y\316\320\236\035\250\216&\254W\033\352!|\330A\370~\335\227\313*\200\346\351\276>\272=\314\363\310\221\375\316\353\210\371\234\026X\257\274\307\351\376\353\301\247\273Q\350n\002Z\201\256\240\373\266\320\355\\\376\246\333\205t\373\215n\337\352v\255n\177v;\221\267\361/\217\273\273\311\377\272}\203n\277"
+	.string	"F\023\320\375\2766\240\373R\320\375j\367w\267\343u{\232n?\323\355f\272]\256\333\341\272\275\255\333\245\335~\245\333\251t{\224n\207\322\355d\335>\326\355\321n\027\353vh\267\203u\373W\267{u{W\267\027\351v\253nwv{U\267Su;\261\333\213\272\335\250\333\245\272;\204ngv7\t\335\276B\267\273\320\3552\272}\331\355\312nOv\373\261\333\203\272\033\204n\027v\367Ww\243\350n-\335\335\313\313\313\313\353~!\335\277,\335#x\004\335\r\244"
+	.ascii	"\315GmB\312`#fG<\272D\356\226\346\234d\305\304\300**\311*\206"
+	.ascii	"f\324*3\223\2060{\240\262\025\263\031\315\271''%15p\346\236f"
+	.ascii	"4G\345\031]\242<C\255\2309\311\231{rR>*\321L\262\212jF\217\242"
+	.ascii	"z\232Q\253\250\034\265\312<9\351\bj))C\365\344\250U]\216:\243"
+	.ascii	"x\232QgT3j%\304m,\025\351\272\361EH\326\022\257k&e\247&\252#"
+	.ascii	"(\036i\023\352\314o9;\231R\206: g*'\324\333Q\f~\206$uB\212r\344"
+	.ascii	"th\316yD\023\322\2253'I\233G\2349\037A*\346,\001\023*\315@\\"
+	.ascii	"\312\304\242\312LJ9\013\320\2243\323\2634\347\314\3149\377\240"
+	.ascii	"\250\2409\357\340i>\233\232r\236\362i\312TL4\245\234\237\f\356"
+	.ascii	",\252\031\275r\002\241\215E\237\231\006\224\351\317\374f\005"
+	.ascii	"\205\243\314\260\314D\006?\243\244\306\\\034W\312\347\265&m\311"
+	.ascii	"\2537|H\210\3640\363j\333\204\301\327\351&u\231\n%(\033\032H"
+	.ascii	"L4\226\236\327\351*\325\270L7\3526\335\247\013\345\321\353t\233"
+	.ascii	"}\227n\215\366\271NwF\233\271\224,\317\bk\200\b\221|\221\256"
+	.ascii	"\323\265\361q.\235\312\314:\004\210\240\r\361\3021\263\366\214"
+	.ascii	"\302Q\333f\f\273\217\315\023\267M\025n\033)\3346K\270mf`\036"
+	.ascii	"\007\341\273L\037[\016a\\t\370\361~\215Go\376\274~\034\256\326"
+	.ascii	"\252\2303Gs\206\346\354\344-\25495\334n\302\267\343&|\320/\234"
+	.ascii	"\247'-g\03241\246\246\300^\355Gs\306\2359\223\351H5\351\332\361"
+	.ascii	"\352\357\360f<:\342\357|\314\017\244(4\fC\316>\302\347yy>\302"
+	.ascii	"\367s@\375v\026hay\225\031\201\003Z\217\032\310\214\3712\233"
+	.ascii	"\203\216\3611%\227\fcu\323\0341wP\262i\367\317=\335\307]\270"
+	.ascii	"\273\250\215W}<\204\357\366\313\305%\261rE\366\352\307\375\303"
+	.ascii	"\275\230\376\270\017\203\223\364q\252\033\240\343n@/m\353\210"
+	.ascii	"\211Om\234\303\233\333\017\254I\206\346\253\375n\335\017\306"
+	.ascii	"\317\332\354\237K]\325\335\2538\016\302\347P\200\372\333\356"
+	.ascii	"\231\025%5_\336\213\216\330\223l\367j\027\350\2164I\232\324\253"
+	.ascii	"\215\301p{\0252OS<\246\032\273\247-\317+PZ\236wgl\340\371\232"
+	.ascii	"\274)P\rR\360\232r\317*MlS\033a\246O\254 \231\222\325\200;{&"
+	.ascii	"/\\\310<o\315\023\264\257\247\335\016MO.\237\257\360\324\262"
+	.ascii	"p=\177\311i\215.\315\322T\rM\215'\235\031\246\347\022'`\023@"
+	.ascii	"\227L\201\272^\352\257.\364\214\003$\265)\027)\220)Gi\236_\332"
+	.ascii	"f\360-M\266\316t\370AW\306\351I\016J\316|\314\214)0\032s\323"
+	.ascii	"*^\252\236K^\213\354\211\247ey\341\315\270\373J:3}B%\211\232"
+	.ascii	"\022\035\330C\371\034^\354\251\274\327+\371+/\344\317\336\310"
+	.ascii	"7\371\"O\366\321?\362K~\354o\370!\317\365a\257\3033\371)\037"
+	.ascii	"\345\327^\312\227\275\r\277\345\253<\332K\337\311o}\222\377z"
+	.ascii	"$\017\375,o\345\261|\332\253\275\331sy\266\177\3628<\221\327"
+	.ascii	"\362O\217~\327\377\350\007\362A\374\n\226\331\364\273\334\315"
+	.ascii	"\345.\364\331\242\t\217i\004j\232\317)\336%+;6\340n5\n\216\215"
+	.ascii	"K\210\025\350\021']`\236\314\214\335\225\335p\272rj\r323MjV\200"
+	.ascii	"\006\323\031\223\232\204\347\252\210|\261!\335\261\233A\211\206"
+	.ascii	"Z\243\210\333\335\325\023u\251\255\013\215JNm\372\330{YcBz\325"
+	.ascii	"LU\n{\346\234yp\340\312H!\343R\217\324#5iNn\232\343\314r\273"
+	.ascii	"R\221ZM\302\201\242$\017\313\2163/O\315>3\"sT\275)s\314\255\266"
+	.ascii	"k5\273\331\215V\230\022\r\257\366N\023\017\317\313w\243\006\037"
+	.ascii	"3\362\322\244\271r\316\003Er\373z\276\325\331\027\216\2703g\b"
+	.ascii	"0#Msw\227\243\003\026%+*\230\256\257\035\3355\343v\016\315SN"
+	.ascii	"\346\230\004z\250\221\321q\227\233T&\202j\350\261e\207\276f\266"
+	.ascii	"\370\362\232\234Y]2}\313t\333\374\334\332\264"
+	.string	"\210\361\300\267\256\357\030\036RqGtL\177la\323\201\302\255\263$F\314\225#:Ks\327e\343D\347d\353U\271\337\217\"XO\312\270\271]8\n\352\206xu\251Y+\214\\\230\276p:k^Uv\257\336\267\313f\263\266\004\b\225,]\272\3346\227\253\233\243\302i\n\303S\362\245o\333\315bR\225y\365z\3514\035\270%7\204%\301\255\246v\245>Ht\2302\321\243Q&\235\302\245\2574G\251\251\212\353\325\253\345\262\365\320"
+	.string	"\331!\205m\315\203\326T\r\250\033;_\266\234~l\271\315\"\351\264\355\325\233\305\233d\244\264\224a\"V\226n\270JK\273W:"
+	.ascii	"\300\f\023GG\335\321\224\225\276W>\016\233\031\202\266\226\246"
+	.ascii	"\346@K\262\366TVv\251x\t.9R\300\250\321\232\322\227J\357J\230"
+	.ascii	"2E^\275h\235\226\243\246\207\021\034\257\336\2636\353\205e\241"
+	.ascii	"uy\365\232\265\331NY\330\233V\233\271\reH\240\274\3329GQ\242"
+	.ascii	"\220\341\224\201\002\005\r\f\231G/\331\243\351^R\306R\362\314"
+	.ascii	"y\212\201\034\"^M\220\244cc>\346b\371\351\206F\030\030\252\273"
+	.ascii	"\234\2610\240\342\321\201\001\362j\343|E\243K\246A\304\304~\314"
+	.ascii	"\315R\224\023\032\275\320\237\272\r\035\214\260\335M\201\201"
+	.ascii	"iy\342\320\370\372\312\362\264\363\362z7\037hf\376r\360\320v"
+	.ascii	"\344\310\355\362=\325\371[\027\026\r8\364\3552\313!;Sw\364\352"
+	.ascii	"\275\241\323p\230\236p`z\365\332\360q:mwkwG\275\2544\272,4,\217"
+	.ascii	"^\254[\304\246\251\256\3012\315PS\f\354 \001\253\202v\213t\337"
+	.ascii	"\254[\303%\202\243\343\225\003\b\335\253\317\037\336\021\244"
+	.ascii	"\034\257\266\007#x\310\335\362\350\345\272@\372\006\271Z_\227"
+	.ascii	"\353&]!.%\373\240K\3124\202\313u\177\\)\227NA3sg)\314\b\333\335"
+	.ascii	"\211\023;n[uP\276+\344\372"
+	.string	"\210\202\227\354\360\320\274\372&<\344\300\355\301\t{\366\020\276\037\364\356\006\317\312\352\335\274'\347#\270\347\234\323\243\327\371n\267\251~\305M3\024\024\003}\363\005w\337*\217\336*\037\363\261\340\214\3134CA\031\350\2334\3347\307\325\3217\206\216\341Rah~r)hF\330\356\362\324\224\t\0331\270.b<\372R\365\034N&\300f\313\356.\310\253mwwt\267\215\007\266\0357\336v\310\320{\313\3414\244\213\0139%W^\355;\365?\262la!\363j\337`\341\356n\367\345#\250\234\363\215\0364C!\341\264\367\334Mt\347\370\365\003\272[\315\271\003]D\261,\266A!\001\2107m\220=\022{\355\032T\\\256J\342:B\321\b-rU*\207X\264k\220\b\0224\300\031\200X\227\3125\006\322\305\013\021]D\261<\036\203\302b\033\024\372Y\266F\030?C\310 \007\212\206\220\306\243\003\022\244"
+	.string	"\246PQ\364\263\016\207\216B\244\361G\271\034\372\371!b\225\305\226E\376\210\301\365\250\266K$+\354\021[\244Qy\364\265xAl\321\256\034\f\215I"
+	.string	"\32668L\2260\242\213(\204\312\037!\021\004\213\033\021\313\025\303\343\020[\\\202 \266\b\342\344\344\364\272\210\342gx4\016\301\030\261\016Y\020l\216I!\027=\303#[\264I\256\355\213 #\214\237r\345\031\256k\362E\317\013\242\340\b1Ver\307\350\230L\256"
+	.ascii	"\321.\201\303\025i\204!\304\262 \341\013\212\261\"\330\036W\r"
+	.ascii	"xt\212\202 \020\2116-r\210e\021\2044\006u\232DkD\272H\276\030"
+	.ascii	"~h\241Q\271\"\327 \334\022\244p \205\212\242_\253\250\340\201"
+	.ascii	"\n\036\360\265\212\n\200\200*H\001\204;\005\320m\273\210\342"
+	.ascii	"\007\311\n\t\261\302\001\206\253\220Q\231\364-\201kPP\271\306"
+	.ascii	"X\001\302p\r\n\n\036C\024\255C\244\013\"\266g\225a|q#4\364\""
+	.ascii	"\bi\214\301\n\331\020\207`\334v\005\256I#\022\220\254\321\005"
+	.ascii	"\221\030\342wd\331\f\200\275"
+	.string	"\366\303\022(\302\320\230\304\221Q\004\022\005\215td\024\201<2\212C\235\242\260e\221m\027Q\f\215I\237f\223\253\362\247eY\345\217\207\026\276\004\022\207\306\244O\004w\341\032\370\320\230\274=-r\025*W\021DH\016\r\221F\023Dx \n\2360\364bhL\352\2548\2561\326\343N+\\\211D\020\353\220\025\002\266\312\265=\032[ \222\225aT\262E\237\021\210\202F=\307U(\\\241c\\\"\203J\022\206\312 \221\222m1\\Wb\210\017nd\024\201\020,\227\301$\021{\354iY\035\236\017E\301\343\2524z8\006!\203>KcQ\020\0304\004c\035\212\350Y\n\001\207\301\265\030d\201e\217@\345\2124\006\225-\220U\n\203#xD\020\211l;$\004\036Ye\213d\205\300%\214\340\2075i\324\002!\370 \243\bD\032e\024\205\224k;\004@\206Q\031\\\221\306\017Z\020\355\222ea"
+	.string	"\211D\254\f\026\205\352*\024\fa=\032\211\2542\351!\271<\262I\345\332\"\215EA! \221\330\323\032\205\214G\340\312\2021\251\243d[a\220\b,\266,+\264\004\022\211<l\262h\005\2561\224CB 1y\004\"\215\206\037\220\254\261\r.\221kR\210\025\002\203\202K`\033\204\021#\004\321\203#K\364@\204#\313\202\350\201\320\210\005Q\320\b\267\313!e\221\204u\031\314\200(h\224\323\302\252$\002\327\345q()d\004\022\211@\001\226FA\242c\360\303\332\006\225@\243\240p\035\002\225\254R\271\362\2541\214\255p=\036Y!p\035\022.WeO\013L\001\204\221\306`\020"
+	.ascii	"\253\220\261m\201*Z\244q\350\327@@,J\224\020\002\007X\210\242"
+	.ascii	"E\032\331d\273.\177\332b\220\361H\374A\032\203B?B\345\362\007"
+	.ascii	"\005\001\253\f\343\022H\304\016\221F\"\240rm\217F\"P\311\266"
+	.ascii	"\301\030\353q\035\240\325\033\352\rU"
+	.string	"\207CA\215\221@M\2075Pwy\n\207\211n5G\253:n`\"\207\366\252\212C\225\n\202\344\2502II\346(B\310\f\211\214\214$I\322\001\302\n\020\204dA\242\311\322\003\022\2004I\2173\346f$I\n*5\366\3303\366X\364+2\306O\250B\366\002w5\200\034\247y;|\265_O\205\345h\230\224.\242\301\346\352/\347v\314i\371A\007h{\271\340!\006\314\337i+\252X4]jC\274\333\3211\261}L\222\365\222\2268\276\3351\330\303M^A5x\210\244\251\354 \177\222\351o\\\r\326\267\026v\350eC2\257P\025@q\275J\213`\326\301\371e9b4\332\324\337\211\363\032\270G\221x\315R\f\034\370\362\342\005<\237\bY \227\026v\037\315\255c\272C\357b\334Kd\215e\222\316\324\t\336n\314-\025\255\300\265\350\271&BoA\317\026\304\272t\232\330\221\024q\322\201"
+	.string	"\322UP\261\3213\217\0230\026\324S\210:K2\020\007\036J\017!\002X\257b\201\252\275|6[u2\273'6\036\315\212\247\266I\254zq\313\357\263\330h\326\235\257n\347\036u\253\233\006\3327\344\350\027\237\024\273"
+	.ascii	"\036\373\206\340\177\306\250\303\313/\340K38O\260\025\370E-W"
+	.ascii	"u\241|<\003\372\304)r\257*\210\245A\t\307\223\321\327.\332c\223"
+	.ascii	"\222l#a\262%x\303\006pH+a\227\3418\346\274\300\206h\237(\377"
+	.ascii	"A\r1\017s\242\214L~\"L0\340=,\334\236\274"
+	.string	"fI\224\357\360|\233\336\023\032\033\276\207V\317z\350g\022P\370\217PR@xY\036\224pPL\263\332\021\016ke\324!=@\263\236\221\317H\212z=3<ckt8\360\260\267s\022#5 v\r-\220\361\2543\257\016C\342\217\301\024\032D\264\344a\320\232z9\177\031\252\273\373p\212d\337\230\305\373X\313*\222jn~\354h\326\365i\256Zc\253l\373\221N\276\226@\335\351{>\036\230l4\022}3\256E@\254_w\336\214Kg\274\322.\022\3440E`z\234\002}\257J\222\027\"6o\007\021\"\343\267"
+	.string	"\2203N\265k\002W\351B\227\375\312\273"
+	.string	"Y\252\233\220\225XTC\276=\242"
+	.string	"\n\2616\267\212\323Z\321\264\347p\1773YT\375\222\231\230\3511\212\303c\213\335\be\347\027\031\270\244\327B*\3753e:\352:\366<\330/z~\233p*Mq\260&\025\\\264\361g\253T\345\353 ZT\235\251\274.q=\343_\341(\230B\241\016\307\353\024\321\323\b0;\245\362\323\270\336B\301J\005\301]q\365\324\256!\212\2037O\314\270@\241\346\266b\007\023x\202\360\270\0372B\334\275\323\333\365\004O\370\260|\337\2447\351\b\340N\004i\267\267U\342\ndj\303x\007i4\354=\374\005\003\224\274e\235"
+	.string	"8\264C\"\244\325Er#\261\317J*\334\3569\202vi\\#~[\027&\023\3659\361\251\266\251C\227\261\323\2755\030\bv\343\272\350\223\\\213\243\001-\253\3016~Q\217\0203\353\353\203S\357\200P\200\211\212\245z`\2342\341\026"
+	.string	"\244\266)4\366\352\036\244F\223B\345\231UB\375\313\032N\t\025\361\214\2727\376B\235\305\317\345\023\210ZKD\236\372\354Jf\246\330\1779\343X\272dX\267\212\340\214\247\373\035 \312\320P_\302=\177\3711U\235\022\216E\200\356\276"
+	.ascii	"\251l\311\003\226\264<yZ\332\316v\\\323\013k=!KT\254\266\375"
+	.ascii	"=X\022\024\267w\221\244\264;\"E\362M1\322\006\315\025\347\033"
+	.ascii	"\361\270\021RA\035o\036\027+\374(Yt:\354\n@\214X\006\232wt\336"
+	.ascii	"7\031p"
+	.string	",+\033\373'\235\026x+d\266y\236\211Q\223\243\353\350\353X\260T\350\365\306\244\025\246\3621\t\316e+@Q\353oZ7+\016WK\347\242\313\244\t\244\265\326ox\020G\224\367{\372\317\027\316<@\3441\242x(_\343\266\305Jiey\233YX\257\036\020\350\236\370o\t\246m\344\024n\206\\h\247c\016l\017\303\324'\016\253\013U\026\254wq1\1774\366\377\303[\365!\002\033\243=\361\244\376\244\001\t\365\201\312{\305\332\274\207\275\210=\205V\244z0\314\262z 0\373\270R\270\353\fm\037-\250\247@$\271!Y\246U\334>\371\325\347\374i\211R\036\356\356\261UP\031\234\360+\366\200\016\201\007\t\326\372\237W\253O\225N\302\246\242\376\020v\274z\3708<\305\255\324\201\320\3401\035\001\234\"0\215d\255\021\353N\201\"W!0z\337\360T\301\273\277_\002\271l~\230-\005\034\350"
+	.string	"T0\347:5\337\243\203\372D\235H|@e\006\345\340\274i<t~\3028\344"
+	.string	"\035\231N\314\360\235\343\374\bO="
+	.ascii	"S\365\rr\2571j\013D\037A\201^BbHbp\0200\036d\335X\017\004\261"
+	.ascii	"W\305G\254\017a\324\352Ex\320\360\340\377\r\232Y(\327\372\223"
+	.ascii	"\327q\326x\273N\202\307\240\301\001\346\374\342\326\3722\344"
+	.ascii	"y\037\330\267,\002\031\036\273\336\360\344\362f\377\223\276\001"
+	.ascii	"\234-:\331u\205X\"\226l?]\307\342~\370\311\235;k\262\013Nl\231"
+	.ascii	"\226\034\372\243l&w\211\255p\276P\f\022l\036\306|\305\035\203"
+	.ascii	"\206\001\317\360/\342?\216\275\r\270\202\032^\234>\323\307\321"
+	.ascii	")N\007\303\013\205v\2572Z\001"
+	.text
+	.section	.gnu.lto_.symtab.b652e25bbf1bb152,"e",@progbits
+	.string	"interpolatedSpInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"setpointDeltaAvg"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"interpolatedSpApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"applyFfLimit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"shouldApplyFfLimits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"laggedMovingAverageInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"applyCurve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"laggedMovingAverageUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"pidGetFfSmoothFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"pidGetSpikeLimitInverse"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"pidGetFfBoostFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"pidGetDT"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"getCurrentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"getRawSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b652e25bbf1bb152,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
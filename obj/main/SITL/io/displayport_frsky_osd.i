@@ -0,0 +1,1765 @@
+# 0 "./src/main/io/displayport_frsky_osd.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./src/main/io/displayport_frsky_osd.c"
+# 21 "./src/main/io/displayport_frsky_osd.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 22 "./src/main/io/displayport_frsky_osd.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 23 "./src/main/io/displayport_frsky_osd.c" 2
+
+# 1 "./src/main/platform.h" 1
+# 21 "./src/main/platform.h"
+       
+# 126 "./src/main/platform.h"
+# 1 "./src/main/target/common_pre.h" 1
+# 21 "./src/main/target/common_pre.h"
+       
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+# 127 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 23 "./src/main/target/SITL/target.h"
+       
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 28 "./src/main/target/SITL/target.h" 2
+
+# 1 "./src/main/common/utils.h" 1
+# 21 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "./src/main/common/utils.h" 2
+# 100 "./src/main/common/utils.h"
+
+# 100 "./src/main/common/utils.h"
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return (int16_t)(a-b); }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return (int32_t)(a-b); }
+
+
+
+
+
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 120 "/usr/include/string.h" 3 4
+extern void *rawmemchr (const void *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 133 "/usr/include/string.h" 3 4
+extern void *memrchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)))
+      __attribute__ ((__access__ (__read_only__, 1, 3)));
+
+
+
+
+
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 286 "/usr/include/string.h" 3 4
+extern char *strchrnul (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 380 "/usr/include/string.h" 3 4
+extern char *strcasestr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern void *memmem (const void *__haystack, size_t __haystacklen,
+       const void *__needle, size_t __needlelen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 3)))
+    __attribute__ ((__access__ (__read_only__, 1, 2)))
+    __attribute__ ((__access__ (__read_only__, 3, 4)));
+
+
+
+extern void *__mempcpy (void *__restrict __dest,
+   const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern void *mempcpy (void *__restrict __dest,
+        const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 444 "/usr/include/string.h" 3 4
+extern char *strerror_r (int __errnum, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern const char *strerrordesc_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+extern const char *strerrorname_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern const char *sigabbrev_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern const char *sigdescr_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int strverscmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strfry (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void *memfrob (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__read_write__, 1, 2)));
+# 527 "/usr/include/string.h" 3 4
+extern char *basename (const char *__filename) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 539 "/usr/include/string.h" 3 4
+
+# 108 "./src/main/common/utils.h" 2
+
+# 108 "./src/main/common/utils.h"
+static inline void memcpy_fn ( void * destination, const void * source, size_t num ) { memcpy(destination, source, num); }
+# 30 "./src/main/target/SITL/target.h" 2
+# 151 "./src/main/target/SITL/target.h"
+extern uint32_t SystemCoreClock;
+
+typedef enum
+{
+    Mode_TEST = 0x0,
+    Mode_Out_PP = 0x10
+} GPIO_Mode;
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct
+{
+  uint32_t IDR;
+  uint32_t ODR;
+  uint32_t BSRR;
+  uint32_t BRR;
+} GPIO_TypeDef;
+
+
+
+typedef struct
+{
+    void* test;
+} TIM_TypeDef;
+
+typedef struct
+{
+    void* test;
+} TIM_OCInitTypeDef;
+
+typedef struct {
+    void* test;
+} DMA_TypeDef;
+
+typedef struct {
+    void* test;
+} DMA_Channel_TypeDef;
+
+uint8_t DMA_GetFlagStatus(void *);
+void DMA_Cmd(DMA_Channel_TypeDef*, FunctionalState );
+void DMA_ClearFlag(uint32_t);
+
+typedef struct
+{
+    void* test;
+} SPI_TypeDef;
+
+typedef struct
+{
+    void* test;
+} USART_TypeDef;
+# 224 "./src/main/target/SITL/target.h"
+typedef struct
+{
+    void* test;
+} I2C_TypeDef;
+
+typedef enum
+{
+  FLASH_BUSY = 1,
+  FLASH_ERROR_PG,
+  FLASH_ERROR_WRP,
+  FLASH_COMPLETE,
+  FLASH_TIMEOUT
+} FLASH_Status;
+
+typedef struct {
+    double timestamp;
+    double imu_angular_velocity_rpy[3];
+    double imu_linear_acceleration_xyz[3];
+    double imu_orientation_quat[4];
+    double velocity_xyz[3];
+    double position_xyz[3];
+} fdm_packet;
+typedef struct {
+    float motor_speed[4];
+} servo_packet;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address);
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data);
+
+uint64_t nanos64_real(void);
+uint64_t micros64_real(void);
+uint64_t millis64_real(void);
+void delayMicroseconds_real(uint32_t us);
+uint64_t micros64(void);
+uint64_t millis64(void);
+
+int lockMainPID(void);
+
+void simulatorLoop(void);
+
+# 265 "./src/main/target/SITL/target.h" 3 4
+_Bool 
+# 265 "./src/main/target/SITL/target.h"
+    simulatorHasMotorRPM(void);
+int simulatorGetMotorERPM(uint8_t motor);
+# 128 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_deprecated_post.h" 1
+# 24 "./src/main/target/common_deprecated_post.h"
+       
+# 129 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 23 "./src/main/target/common_post.h"
+       
+
+# 1 "./src/main/build/version.h" 1
+# 21 "./src/main/build/version.h"
+       
+# 34 "./src/main/build/version.h"
+extern const char* const targetName;
+
+
+extern const char* const shortGitRevision;
+
+
+extern const char* const buildDate;
+
+
+extern const char* const buildTime;
+# 26 "./src/main/target/common_post.h" 2
+# 331 "./src/main/target/common_post.h"
+extern uint8_t eepromData[32768];
+# 130 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_defaults_post.h" 1
+# 131 "./src/main/platform.h" 2
+# 25 "./src/main/io/displayport_frsky_osd.c" 2
+
+
+
+
+
+# 1 "./src/main/drivers/display.h" 1
+# 21 "./src/main/drivers/display.h"
+       
+
+typedef enum {
+    DISPLAYPORT_ATTR_NONE = 0,
+    DISPLAYPORT_ATTR_INFO,
+    DISPLAYPORT_ATTR_WARNING,
+    DISPLAYPORT_ATTR_CRITICAL,
+} displayPortAttr_e;
+
+
+
+typedef enum {
+    DISPLAYPORT_LAYER_FOREGROUND,
+    DISPLAYPORT_LAYER_BACKGROUND,
+    DISPLAYPORT_LAYER_COUNT,
+} displayPortLayer_e;
+
+typedef enum {
+    DISPLAY_TRANSACTION_OPT_NONE = 0,
+    DISPLAY_TRANSACTION_OPT_PROFILED = 1 << 0,
+    DISPLAY_TRANSACTION_OPT_RESET_DRAWING = 1 << 1,
+} displayTransactionOption_e;
+
+
+struct displayCanvas_s;
+struct osdCharacter_s;
+struct displayPortVTable_s;
+
+typedef struct displayPort_s {
+    const struct displayPortVTable_s *vTable;
+    void *device;
+    uint8_t rows;
+    uint8_t cols;
+    uint8_t posX;
+    uint8_t posY;
+
+
+    
+# 58 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 58 "./src/main/drivers/display.h"
+        useFullscreen;
+    
+# 59 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 59 "./src/main/drivers/display.h"
+        cleared;
+    int8_t cursorRow;
+    int8_t grabCount;
+
+
+    
+# 64 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 64 "./src/main/drivers/display.h"
+        useDeviceBlink;
+} displayPort_t;
+
+typedef struct displayPortVTable_s {
+    int (*grab)(displayPort_t *displayPort);
+    int (*release)(displayPort_t *displayPort);
+    int (*clearScreen)(displayPort_t *displayPort);
+    int (*drawScreen)(displayPort_t *displayPort);
+    int (*screenSize)(const displayPort_t *displayPort);
+    int (*writeString)(displayPort_t *displayPort, uint8_t x, uint8_t y, uint8_t attr, const char *text);
+    int (*writeChar)(displayPort_t *displayPort, uint8_t x, uint8_t y, uint8_t attr, uint8_t c);
+    
+# 75 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 75 "./src/main/drivers/display.h"
+        (*isTransferInProgress)(const displayPort_t *displayPort);
+    int (*heartbeat)(displayPort_t *displayPort);
+    void (*resync)(displayPort_t *displayPort);
+    
+# 78 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 78 "./src/main/drivers/display.h"
+        (*isSynced)(const displayPort_t *displayPort);
+    uint32_t (*txBytesFree)(const displayPort_t *displayPort);
+    
+# 80 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 80 "./src/main/drivers/display.h"
+        (*layerSupported)(displayPort_t *displayPort, displayPortLayer_e layer);
+    
+# 81 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 81 "./src/main/drivers/display.h"
+        (*layerSelect)(displayPort_t *displayPort, displayPortLayer_e layer);
+    
+# 82 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 82 "./src/main/drivers/display.h"
+        (*layerCopy)(displayPort_t *displayPort, displayPortLayer_e destLayer, displayPortLayer_e sourceLayer);
+    
+# 83 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 83 "./src/main/drivers/display.h"
+        (*writeFontCharacter)(displayPort_t *instance, uint16_t addr, const struct osdCharacter_s *chr);
+    
+# 84 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 84 "./src/main/drivers/display.h"
+        (*isReady)(displayPort_t *displayPort);
+    void (*beginTransaction)(displayPort_t *displayPort, displayTransactionOption_e opts);
+    void (*commitTransaction)(displayPort_t *displayPort);
+    
+# 87 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 87 "./src/main/drivers/display.h"
+        (*getCanvas)(struct displayCanvas_s *canvas, const displayPort_t *displayPort);
+} displayPortVTable_t;
+
+void displayGrab(displayPort_t *instance);
+void displayRelease(displayPort_t *instance);
+void displayReleaseAll(displayPort_t *instance);
+
+# 93 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 93 "./src/main/drivers/display.h"
+    displayIsGrabbed(const displayPort_t *instance);
+void displayClearScreen(displayPort_t *instance);
+void displayDrawScreen(displayPort_t *instance);
+int displayScreenSize(const displayPort_t *instance);
+void displaySetXY(displayPort_t *instance, uint8_t x, uint8_t y);
+int displayWrite(displayPort_t *instance, uint8_t x, uint8_t y, uint8_t attr, const char *s);
+int displayWriteChar(displayPort_t *instance, uint8_t x, uint8_t y, uint8_t attr, uint8_t c);
+
+# 100 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 100 "./src/main/drivers/display.h"
+    displayIsTransferInProgress(const displayPort_t *instance);
+void displayHeartbeat(displayPort_t *instance);
+void displayResync(displayPort_t *instance);
+
+# 103 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 103 "./src/main/drivers/display.h"
+    displayIsSynced(const displayPort_t *instance);
+uint16_t displayTxBytesFree(const displayPort_t *instance);
+
+# 105 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 105 "./src/main/drivers/display.h"
+    displayWriteFontCharacter(displayPort_t *instance, uint16_t addr, const struct osdCharacter_s *chr);
+
+# 106 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 106 "./src/main/drivers/display.h"
+    displayIsReady(displayPort_t *instance);
+void displayBeginTransaction(displayPort_t *instance, displayTransactionOption_e opts);
+void displayCommitTransaction(displayPort_t *instance);
+
+# 109 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 109 "./src/main/drivers/display.h"
+    displayGetCanvas(struct displayCanvas_s *canvas, const displayPort_t *instance);
+void displayInit(displayPort_t *instance, const displayPortVTable_t *vTable);
+
+# 111 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 111 "./src/main/drivers/display.h"
+    displayLayerSupported(displayPort_t *instance, displayPortLayer_e layer);
+
+# 112 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 112 "./src/main/drivers/display.h"
+    displayLayerSelect(displayPort_t *instance, displayPortLayer_e layer);
+
+# 113 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 113 "./src/main/drivers/display.h"
+    displayLayerCopy(displayPort_t *instance, displayPortLayer_e destLayer, displayPortLayer_e sourceLayer);
+# 31 "./src/main/io/displayport_frsky_osd.c" 2
+# 1 "./src/main/drivers/display_canvas.h" 1
+# 27 "./src/main/drivers/display_canvas.h"
+       
+
+
+
+
+typedef enum {
+    DISPLAY_CANVAS_BITMAP_OPT_INVERT_COLORS = 1 << 0,
+    DISPLAY_CANVAS_BITMAP_OPT_SOLID_BACKGROUND = 1 << 1,
+    DISPLAY_CANVAS_BITMAP_OPT_ERASE_TRANSPARENT = 1 << 2,
+} displayCanvasBitmapOption_t;
+
+typedef enum {
+    DISPLAY_CANVAS_COLOR_BLACK = 0,
+    DISPLAY_CANVAS_COLOR_TRANSPARENT = 1,
+    DISPLAY_CANVAS_COLOR_WHITE = 2,
+    DISPLAY_CANVAS_COLOR_GRAY = 3,
+} displayCanvasColor_e;
+
+typedef enum {
+    DISPLAY_CANVAS_OUTLINE_TYPE_NONE = 0,
+    DISPLAY_CANVAS_OUTLINE_TYPE_TOP = 1 << 0,
+    DISPLAY_CANVAS_OUTLINE_TYPE_RIGHT = 1 << 1,
+    DISPLAY_CANVAS_OUTLINE_TYPE_BOTTOM = 1 << 2,
+    DISPLAY_CANVAS_OUTLINE_TYPE_LEFT = 1 << 3,
+} displayCanvasOutlineType_e;
+
+struct displayCanvasVTable_s;
+
+typedef struct displayCanvas_s {
+    const struct displayCanvasVTable_s *vTable;
+    void *device;
+    uint16_t width;
+    uint16_t height;
+    uint8_t gridElementWidth;
+    uint8_t gridElementHeight;
+} displayCanvas_t;
+
+typedef struct displayCanvasVTable_s {
+    void (*setStrokeColor)(displayCanvas_t *displayCanvas, displayCanvasColor_e color);
+    void (*setFillColor)(displayCanvas_t *displayCanvas, displayCanvasColor_e color);
+    void (*setStrokeAndFillColor)(displayCanvas_t *displayCanvas, displayCanvasColor_e color);
+    void (*setColorInversion)(displayCanvas_t *displayCanvas, 
+# 68 "./src/main/drivers/display_canvas.h" 3 4
+                                                             _Bool 
+# 68 "./src/main/drivers/display_canvas.h"
+                                                                  inverted);
+    void (*setPixel)(displayCanvas_t *displayCanvas, int x, int y, displayCanvasColor_e color);
+    void (*setPixelToStrokeColor)(displayCanvas_t *displayCanvas, int x, int y);
+    void (*setPixelToFillColor)(displayCanvas_t *displayCanvas, int x, int y);
+    void (*setStrokeWidth)(displayCanvas_t *displayCanvas, unsigned w);
+    void (*setLineOutlineType)(displayCanvas_t *displayCanvas, displayCanvasOutlineType_e outlineType);
+    void (*setLineOutlineColor)(displayCanvas_t *displayCanvas, displayCanvasColor_e outlineColor);
+
+    void (*clipToRect)(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+    void (*clearRect)(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+    void (*resetDrawingState)(displayCanvas_t *displayCanvas);
+    void (*drawCharacter)(displayCanvas_t *displayCanvas, int x, int y, uint16_t chr, displayCanvasBitmapOption_t opts);
+    void (*drawCharacterMask)(displayCanvas_t *displayCanvas, int x, int y, uint16_t chr, displayCanvasColor_e color, displayCanvasBitmapOption_t opts);
+    void (*drawString)(displayCanvas_t *displayCanvas, int x, int y, const char *s, displayCanvasBitmapOption_t opts);
+    void (*drawStringMask)(displayCanvas_t *displayCanvas, int x, int y, const char *s, displayCanvasColor_e color, displayCanvasBitmapOption_t opts);
+    void (*moveToPoint)(displayCanvas_t *displayCanvas, int x, int y);
+    void (*strokeLineToPoint)(displayCanvas_t *displayCanvas, int x, int y);
+    void (*strokeTriangle)(displayCanvas_t *displayCanvas, int x1, int y1, int x2, int y2, int x3, int y3);
+    void (*fillTriangle)(displayCanvas_t *displayCanvas, int x1, int y1, int x2, int y2, int x3, int y3);
+    void (*fillStrokeTriangle)(displayCanvas_t *displayCanvas, int x1, int y1, int x2, int y2, int x3, int y3);
+    void (*strokeRect)(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+    void (*fillRect)(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+    void (*fillStrokeRect)(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+    void (*strokeEllipseInRect)(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+    void (*fillEllipseInRect)(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+    void (*fillStrokeEllipseInRect)(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+
+    void (*ctmReset)(displayCanvas_t *displayCanvas);
+    void (*ctmSet)(displayCanvas_t *displayCanvas, float m11, float m12, float m21, float m22, float m31, float m32);
+    void (*ctmTranslate)(displayCanvas_t *displayCanvas, float tx, float ty);
+    void (*ctmScale)(displayCanvas_t *displayCanvas, float sx, float sy);
+    void (*ctmRotate)(displayCanvas_t *displayCanvas, float r);
+
+    void (*contextPush)(displayCanvas_t *displayCanvas);
+    void (*contextPop)(displayCanvas_t *displayCanvas);
+} displayCanvasVTable_t;
+
+
+void displayCanvasSetStrokeColor(displayCanvas_t *displayCanvas, displayCanvasColor_e color);
+void displayCanvasSetFillColor(displayCanvas_t *displayCanvas, displayCanvasColor_e color);
+void displayCanvasSetStrokeAndFillColor(displayCanvas_t *displayCanvas, displayCanvasColor_e color);
+void displayCanvasSetColorInversion(displayCanvas_t *displayCanvas, 
+# 109 "./src/main/drivers/display_canvas.h" 3 4
+                                                                   _Bool 
+# 109 "./src/main/drivers/display_canvas.h"
+                                                                        inverted);
+void displayCanvasSetPixel(displayCanvas_t *displayCanvas, int x, int y, displayCanvasColor_e);
+void displayCanvasSetPixelToStrokeColor(displayCanvas_t *displayCanvas, int x, int y);
+void displayCanvasSetPixelToFillColor(displayCanvas_t *displayCanvas, int x, int y);
+void displayCanvasSetStrokeWidth(displayCanvas_t *displayCanvas, unsigned w);
+void displayCanvasSetLineOutlineType(displayCanvas_t *displayCanvas, displayCanvasOutlineType_e outlineType);
+void displayCanvasSetLineOutlineColor(displayCanvas_t *displayCanvas, displayCanvasColor_e outlineColor);
+
+void displayCanvasClipToRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+void displayCanvasClearRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+void displayCanvasResetDrawingState(displayCanvas_t *displayCanvas);
+void displayCanvasDrawCharacter(displayCanvas_t *displayCanvas, int x, int y, uint16_t chr, displayCanvasBitmapOption_t opts);
+void displayCanvasDrawCharacterMask(displayCanvas_t *displayCanvas, int x, int y, uint16_t chr, displayCanvasColor_e color, displayCanvasBitmapOption_t opts);
+void displayCanvasDrawString(displayCanvas_t *displayCanvas, int x, int y, const char *s, displayCanvasBitmapOption_t opts);
+void displayCanvasDrawStringMask(displayCanvas_t *displayCanvas, int x, int y, const char *s, displayCanvasColor_e color, displayCanvasBitmapOption_t opts);
+void displayCanvasMoveToPoint(displayCanvas_t *displayCanvas, int x, int y);
+void displayCanvasStrokeLineToPoint(displayCanvas_t *displayCanvas, int x, int y);
+void displayCanvasStrokeTriangle(displayCanvas_t *displayCanvas, int x1, int y1, int x2, int y2, int x3, int y3);
+void displayCanvasFillTriangle(displayCanvas_t *displayCanvas, int x1, int y1, int x2, int y2, int x3, int y3);
+void displayCanvasFillStrokeTriangle(displayCanvas_t *displayCanvas, int x1, int y1, int x2, int y2, int x3, int y3);
+void displayCanvasStrokeRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+void displayCanvasFillRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+void displayCanvasFillStrokeRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+void displayCanvasStrokeEllipseInRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+void displayCanvasFillEllipseInRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+void displayCanvasFillStrokeEllipseInRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h);
+
+void displayCanvasCtmReset(displayCanvas_t *displayCanvas);
+void displayCanvasCtmSet(displayCanvas_t *displayCanvas, float m11, float m12, float m21, float m22, float m31, float m32);
+void displayCanvasCtmTranslate(displayCanvas_t *displayCanvas, float tx, float ty);
+void displayCanvasCtmScale(displayCanvas_t *displayCanvas, float sx, float sy);
+void displayCanvasCtmRotate(displayCanvas_t *displayCanvas, float r);
+
+void displayCanvasContextPush(displayCanvas_t *displayCanvas);
+void displayCanvasContextPop(displayCanvas_t *displayCanvas);
+# 32 "./src/main/io/displayport_frsky_osd.c" 2
+
+# 1 "./src/main/io/displayport_frsky_osd.h" 1
+# 20 "./src/main/io/displayport_frsky_osd.h"
+       
+
+
+# 1 "./src/main/drivers/osd.h" 1
+# 21 "./src/main/drivers/osd.h"
+       
+# 43 "./src/main/drivers/osd.h"
+typedef enum {
+    VIDEO_SYSTEM_AUTO = 0,
+    VIDEO_SYSTEM_PAL,
+    VIDEO_SYSTEM_NTSC
+} videoSystem_e;
+
+typedef enum {
+    OSD_DRIVER_NONE = 0,
+    OSD_DRIVER_MAX7456 = 1,
+} osdDriver_e;
+
+
+
+
+
+typedef struct osdCharacter_s {
+    uint8_t data[64];
+} osdCharacter_t;
+# 24 "./src/main/io/displayport_frsky_osd.h" 2
+
+displayPort_t *frskyOsdDisplayPortInit(const videoSystem_e videoSystem);
+# 34 "./src/main/io/displayport_frsky_osd.c" 2
+# 1 "./src/main/io/frsky_osd.h" 1
+       
+
+
+
+
+
+
+
+typedef enum {
+    FRSKY_OSD_TRANSACTION_OPT_PROFILED = 1 << 0,
+    FRSKY_OSD_TRANSACTION_OPT_RESET_DRAWING = 1 << 1,
+} frskyOsdTransactionOptions_e;
+
+typedef enum {
+    FRSKY_OSD_COLOR_BLACK = 0,
+    FRSKY_OSD_COLOR_TRANSPARENT = 1,
+    FRSKY_OSD_COLOR_WHITE = 2,
+    FRSKY_OSD_COLOR_GRAY = 3,
+} frskyOsdColor_e;
+
+typedef enum {
+    FRSKY_OSD_OUTLINE_TYPE_NONE = 0,
+    FRSKY_OSD_OUTLINE_TYPE_TOP = 1 << 0,
+    FRSKY_OSD_OUTLINE_TYPE_RIGHT = 1 << 1,
+    FRSKY_OSD_OUTLINE_TYPE_BOTTOM = 1 << 2,
+    FRSKY_OSD_OUTLINE_TYPE_LEFT = 1 << 3,
+} frskyOsdLineOutlineType_e;
+
+
+# 29 "./src/main/io/frsky_osd.h" 3 4
+_Bool 
+# 29 "./src/main/io/frsky_osd.h"
+    frskyOsdInit(videoSystem_e videoSystem);
+
+# 30 "./src/main/io/frsky_osd.h" 3 4
+_Bool 
+# 30 "./src/main/io/frsky_osd.h"
+    frskyOsdIsReady(void);
+void frskyOsdUpdate(void);
+void frskyOsdBeginTransaction(frskyOsdTransactionOptions_e opts);
+void frskyOsdCommitTransaction(void);
+void frskyOsdFlushSendBuffer(void);
+
+# 35 "./src/main/io/frsky_osd.h" 3 4
+_Bool 
+# 35 "./src/main/io/frsky_osd.h"
+    frskyOsdReadFontCharacter(unsigned char_address, osdCharacter_t *chr);
+
+# 36 "./src/main/io/frsky_osd.h" 3 4
+_Bool 
+# 36 "./src/main/io/frsky_osd.h"
+    frskyOsdWriteFontCharacter(unsigned char_address, const osdCharacter_t *chr);
+
+unsigned frskyOsdGetGridRows(void);
+unsigned frskyOsdGetGridCols(void);
+
+unsigned frskyOsdGetPixelWidth(void);
+unsigned frskyOsdGetPixelHeight(void);
+
+void frskyOsdDrawStringInGrid(unsigned x, unsigned y, const char *buff);
+void frskyOsdDrawCharInGrid(unsigned x, unsigned y, uint16_t chr);
+
+# 46 "./src/main/io/frsky_osd.h" 3 4
+_Bool 
+# 46 "./src/main/io/frsky_osd.h"
+    frskyOsdReadCharInGrid(unsigned x, unsigned y, uint16_t *c);
+void frskyOsdClearScreen(void);
+
+void frskyOsdSetStrokeColor(frskyOsdColor_e color);
+void frskyOsdSetFillColor(frskyOsdColor_e color);
+void frskyOsdSetStrokeAndFillColor(frskyOsdColor_e color);
+void frskyOsdSetColorInversion(
+# 52 "./src/main/io/frsky_osd.h" 3 4
+                              _Bool 
+# 52 "./src/main/io/frsky_osd.h"
+                                   inverted);
+void frskyOsdSetPixel(int x, int y, frskyOsdColor_e color);
+void frskyOsdSetPixelToStrokeColor(int x, int y);
+void frskyOsdSetPixelToFillColor(int x, int y);
+void frskyOsdSetStrokeWidth(unsigned width);
+void frskyOsdSetLineOutlineType(frskyOsdLineOutlineType_e outlineType);
+void frskyOsdSetLineOutlineColor(frskyOsdColor_e outlineColor);
+
+void frskyOsdClipToRect(int x, int y, int w, int h);
+void frskyOsdClearRect(int x, int y, int w, int h);
+void frskyOsdResetDrawingState(void);
+void frskyOsdDrawCharacter(int x, int y, uint16_t chr, uint8_t opts);
+void frskyOsdDrawCharacterMask(int x, int y, uint16_t chr, frskyOsdColor_e color, uint8_t opts);
+void frskyOsdDrawString(int x, int y, const char *s, uint8_t opts);
+void frskyOsdDrawStringMask(int x, int y, const char *s, frskyOsdColor_e color, uint8_t opts);
+void frskyOsdMoveToPoint(int x, int y);
+void frskyOsdStrokeLineToPoint(int x, int y);
+void frskyOsdStrokeTriangle(int x1, int y1, int x2, int y2, int x3, int y3);
+void frskyOsdFillTriangle(int x1, int y1, int x2, int y2, int x3, int y3);
+void frskyOsdFillStrokeTriangle(int x1, int y1, int x2, int y2, int x3, int y3);
+void frskyOsdStrokeRect(int x, int y, int w, int h);
+void frskyOsdFillRect(int x, int y, int w, int h);
+void frskyOsdFillStrokeRect(int x, int y, int w, int h);
+void frskyOsdStrokeEllipseInRect(int x, int y, int w, int h);
+void frskyOsdFillEllipseInRect(int x, int y, int w, int h);
+void frskyOsdFillStrokeEllipseInRect(int x, int y, int w, int h);
+
+void frskyOsdCtmReset(void);
+void frskyOsdCtmSet(float m11, float m12, float m21, float m22, float m31, float m32);
+void frskyOsdCtmTranslate(float tx, float ty);
+void frskyOsdCtmScale(float sx, float sy);
+void frskyOsdCtmRotate(float r);
+
+void frskyOsdContextPush(void);
+void frskyOsdContextPop(void);
+# 35 "./src/main/io/displayport_frsky_osd.c" 2
+
+static displayPort_t frskyOsdDisplayPort;
+
+static int grab(displayPort_t *displayPort)
+{
+    (void)(displayPort);
+    return 0;
+}
+
+static int release(displayPort_t *displayPort)
+{
+    (void)(displayPort);
+    return 0;
+}
+
+static int clearScreen(displayPort_t *displayPort)
+{
+    (void)(displayPort);
+    frskyOsdClearScreen();
+    return 0;
+}
+
+static int drawScreen(displayPort_t *displayPort)
+{
+    (void)(displayPort);
+    frskyOsdUpdate();
+
+    return 0;
+}
+
+static int screenSize(const displayPort_t *displayPort)
+{
+    (void)(displayPort);
+    return frskyOsdGetGridRows() * frskyOsdGetGridCols();
+}
+
+static int writeString(displayPort_t *displayPort, uint8_t x, uint8_t y, uint8_t attr, const char *s)
+{
+    (void)(displayPort);
+    (void)(attr);
+
+    frskyOsdDrawStringInGrid(x, y, s);
+    return 0;
+}
+
+static int writeChar(displayPort_t *displayPort, uint8_t x, uint8_t y, uint8_t attr, uint8_t c)
+{
+    (void)(displayPort);
+    (void)(attr);
+
+    frskyOsdDrawCharInGrid(x, y, c);
+    return 0;
+}
+
+static 
+# 89 "./src/main/io/displayport_frsky_osd.c" 3 4
+      _Bool 
+# 89 "./src/main/io/displayport_frsky_osd.c"
+           isTransferInProgress(const displayPort_t *displayPort)
+{
+    (void)(displayPort);
+    return 
+# 92 "./src/main/io/displayport_frsky_osd.c" 3 4
+          0
+# 92 "./src/main/io/displayport_frsky_osd.c"
+               ;
+}
+
+static void updateGridSize(displayPort_t *displayPort)
+{
+    displayPort->rows = frskyOsdGetGridRows();
+    displayPort->cols = frskyOsdGetGridCols();
+}
+
+static void resync(displayPort_t *displayPort)
+{
+    (void)(displayPort);
+
+
+
+    frskyOsdUpdate();
+    updateGridSize(displayPort);
+}
+
+static int heartbeat(displayPort_t *displayPort)
+{
+    (void)(displayPort);
+    return 0;
+}
+
+static uint32_t txBytesFree(const displayPort_t *displayPort)
+{
+    (void)(displayPort);
+    return 
+# 120 "./src/main/io/displayport_frsky_osd.c" 3 4
+          (4294967295U)
+# 120 "./src/main/io/displayport_frsky_osd.c"
+                    ;
+}
+
+static 
+# 123 "./src/main/io/displayport_frsky_osd.c" 3 4
+      _Bool 
+# 123 "./src/main/io/displayport_frsky_osd.c"
+           writeFontCharacter(displayPort_t *instance, uint16_t addr, const osdCharacter_t *chr)
+{
+    (void)(instance);
+
+    return frskyOsdWriteFontCharacter(addr, chr);
+}
+
+static 
+# 130 "./src/main/io/displayport_frsky_osd.c" 3 4
+      _Bool 
+# 130 "./src/main/io/displayport_frsky_osd.c"
+           isReady(displayPort_t *instance)
+{
+    if (frskyOsdIsReady()) {
+        updateGridSize(instance);
+        return 
+# 134 "./src/main/io/displayport_frsky_osd.c" 3 4
+              1
+# 134 "./src/main/io/displayport_frsky_osd.c"
+                  ;
+    }
+    return 
+# 136 "./src/main/io/displayport_frsky_osd.c" 3 4
+          0
+# 136 "./src/main/io/displayport_frsky_osd.c"
+               ;
+}
+
+static void beginTransaction(displayPort_t *instance, displayTransactionOption_e opts)
+{
+    (void)(instance);
+
+    frskyOsdTransactionOptions_e frskyOpts = 0;
+    if (opts & DISPLAY_TRANSACTION_OPT_PROFILED) {
+        frskyOpts |= FRSKY_OSD_TRANSACTION_OPT_PROFILED;
+    }
+    if (opts & DISPLAY_TRANSACTION_OPT_RESET_DRAWING) {
+        frskyOpts |= FRSKY_OSD_TRANSACTION_OPT_RESET_DRAWING;
+    }
+
+    frskyOsdBeginTransaction(frskyOpts);
+}
+
+static void commitTransaction(displayPort_t *instance)
+{
+    (void)(instance);
+
+    frskyOsdCommitTransaction();
+}
+
+static frskyOsdColor_e frskyOsdGetColor(displayCanvasColor_e color)
+{
+    switch (color)
+    {
+        case DISPLAY_CANVAS_COLOR_BLACK:
+            return FRSKY_OSD_COLOR_BLACK;
+        case DISPLAY_CANVAS_COLOR_TRANSPARENT:
+            return FRSKY_OSD_COLOR_TRANSPARENT;
+        case DISPLAY_CANVAS_COLOR_WHITE:
+            return FRSKY_OSD_COLOR_WHITE;
+        case DISPLAY_CANVAS_COLOR_GRAY:
+            return FRSKY_OSD_COLOR_GRAY;
+    }
+    return FRSKY_OSD_COLOR_BLACK;
+}
+
+static void setStrokeColor(displayCanvas_t *displayCanvas, displayCanvasColor_e color)
+{
+    (void)(displayCanvas);
+
+    frskyOsdSetStrokeColor(frskyOsdGetColor(color));
+}
+
+static void setFillColor(displayCanvas_t *displayCanvas, displayCanvasColor_e color)
+{
+    (void)(displayCanvas);
+
+    frskyOsdSetFillColor(frskyOsdGetColor(color));
+}
+
+static void setStrokeAndFillColor(displayCanvas_t *displayCanvas, displayCanvasColor_e color)
+{
+    (void)(displayCanvas);
+
+    frskyOsdSetStrokeAndFillColor(frskyOsdGetColor(color));
+}
+
+static void setColorInversion(displayCanvas_t *displayCanvas, 
+# 198 "./src/main/io/displayport_frsky_osd.c" 3 4
+                                                             _Bool 
+# 198 "./src/main/io/displayport_frsky_osd.c"
+                                                                  inverted)
+{
+    (void)(displayCanvas);
+
+    frskyOsdSetColorInversion(inverted);
+}
+
+static void setPixel(displayCanvas_t *displayCanvas, int x, int y, displayCanvasColor_e color)
+{
+    (void)(displayCanvas);
+
+    frskyOsdSetPixel(x, y, frskyOsdGetColor(color));
+}
+
+static void setPixelToStrokeColor(displayCanvas_t *displayCanvas, int x, int y)
+{
+    (void)(displayCanvas);
+
+    frskyOsdSetPixelToStrokeColor(x, y);
+}
+
+static void setPixelToFillColor(displayCanvas_t *displayCanvas, int x, int y)
+{
+    (void)(displayCanvas);
+
+    frskyOsdSetPixelToFillColor(x, y);
+}
+
+static void setStrokeWidth(displayCanvas_t *displayCanvas, unsigned w)
+{
+    (void)(displayCanvas);
+
+    frskyOsdSetStrokeWidth(w);
+}
+
+static void setLineOutlineType(displayCanvas_t *displayCanvas, displayCanvasOutlineType_e outlineType)
+{
+    (void)(displayCanvas);
+
+    frskyOsdSetLineOutlineType(outlineType);
+}
+
+static void setLineOutlineColor(displayCanvas_t *displayCanvas, displayCanvasColor_e outlineColor)
+{
+    (void)(displayCanvas);
+
+    frskyOsdSetLineOutlineColor(outlineColor);
+}
+
+static void clipToRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h)
+{
+    (void)(displayCanvas);
+
+    frskyOsdClipToRect(x, y, w, h);
+}
+
+static void clearRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h)
+{
+    (void)(displayCanvas);
+
+    frskyOsdClearRect(x, y, w, h);
+}
+
+static void resetDrawingState(displayCanvas_t *displayCanvas)
+{
+    (void)(displayCanvas);
+
+    frskyOsdResetDrawingState();
+}
+
+static void drawCharacter(displayCanvas_t *displayCanvas, int x, int y, uint16_t chr, displayCanvasBitmapOption_t opts)
+{
+    (void)(displayCanvas);
+
+    frskyOsdDrawCharacter(x, y, chr, opts);
+}
+
+static void drawCharacterMask(displayCanvas_t *displayCanvas, int x, int y, uint16_t chr, displayCanvasColor_e color, displayCanvasBitmapOption_t opts)
+{
+    (void)(displayCanvas);
+
+    frskyOsdDrawCharacterMask(x, y, chr, frskyOsdGetColor(color), opts);
+}
+
+static void drawString(displayCanvas_t *displayCanvas, int x, int y, const char *s, displayCanvasBitmapOption_t opts)
+{
+    (void)(displayCanvas);
+
+    frskyOsdDrawString(x, y, s, opts);
+}
+
+static void drawStringMask(displayCanvas_t *displayCanvas, int x, int y, const char *s, displayCanvasColor_e color, displayCanvasBitmapOption_t opts)
+{
+    (void)(displayCanvas);
+
+    frskyOsdDrawStringMask(x, y, s, frskyOsdGetColor(color), opts);
+}
+
+static void moveToPoint(displayCanvas_t *displayCanvas, int x, int y)
+{
+    (void)(displayCanvas);
+
+    frskyOsdMoveToPoint(x, y);
+}
+
+static void strokeLineToPoint(displayCanvas_t *displayCanvas, int x, int y)
+{
+    (void)(displayCanvas);
+
+    frskyOsdStrokeLineToPoint(x, y);
+}
+
+static void strokeTriangle(displayCanvas_t *displayCanvas, int x1, int y1, int x2, int y2, int x3, int y3)
+{
+    (void)(displayCanvas);
+
+    frskyOsdStrokeTriangle(x1, y1, x2, y2, x3, y3);
+}
+
+static void fillTriangle(displayCanvas_t *displayCanvas, int x1, int y1, int x2, int y2, int x3, int y3)
+{
+    (void)(displayCanvas);
+
+    frskyOsdFillTriangle(x1, y1, x2, y2, x3, y3);
+}
+
+static void fillStrokeTriangle(displayCanvas_t *displayCanvas, int x1, int y1, int x2, int y2, int x3, int y3)
+{
+    (void)(displayCanvas);
+
+    frskyOsdFillStrokeTriangle(x1, y1, x2, y2, x3, y3);
+}
+
+static void strokeRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h)
+{
+    (void)(displayCanvas);
+
+    frskyOsdStrokeRect(x, y, w, h);
+}
+
+static void fillRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h)
+{
+    (void)(displayCanvas);
+
+    frskyOsdFillRect(x, y, w, h);
+}
+
+static void fillStrokeRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h)
+{
+    (void)(displayCanvas);
+
+    frskyOsdFillStrokeRect(x, y, w, h);
+}
+
+static void strokeEllipseInRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h)
+{
+    (void)(displayCanvas);
+
+    frskyOsdStrokeEllipseInRect(x, y, w, h);
+}
+
+static void fillEllipseInRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h)
+{
+    (void)(displayCanvas);
+
+    frskyOsdFillEllipseInRect(x, y, w, h);
+}
+
+static void fillStrokeEllipseInRect(displayCanvas_t *displayCanvas, int x, int y, int w, int h)
+{
+    (void)(displayCanvas);
+
+    frskyOsdFillStrokeEllipseInRect(x, y, w, h);
+}
+
+static void ctmReset(displayCanvas_t *displayCanvas)
+{
+    (void)(displayCanvas);
+
+    frskyOsdCtmReset();
+}
+
+static void ctmSet(displayCanvas_t *displayCanvas, float m11, float m12, float m21, float m22, float m31, float m32)
+{
+    (void)(displayCanvas);
+
+    frskyOsdCtmSet(m11, m12, m21, m22, m31, m32);
+}
+
+static void ctmTranslate(displayCanvas_t *displayCanvas, float tx, float ty)
+{
+    (void)(displayCanvas);
+
+    frskyOsdCtmTranslate(tx, ty);
+}
+
+static void ctmScale(displayCanvas_t *displayCanvas, float sx, float sy)
+{
+    (void)(displayCanvas);
+
+    frskyOsdCtmScale(sx, sy);
+}
+
+static void ctmRotate(displayCanvas_t *displayCanvas, float r)
+{
+    (void)(displayCanvas);
+
+    frskyOsdCtmRotate(r);
+}
+
+static void contextPush(displayCanvas_t *displayCanvas)
+{
+    (void)(displayCanvas);
+
+    frskyOsdContextPush();
+}
+
+static void contextPop(displayCanvas_t *displayCanvas)
+{
+    (void)(displayCanvas);
+
+    frskyOsdContextPop();
+}
+
+
+static const displayCanvasVTable_t frskyOsdCanvasVTable = {
+    .setStrokeColor = setStrokeColor,
+    .setFillColor = setFillColor,
+    .setStrokeAndFillColor = setStrokeAndFillColor,
+    .setColorInversion = setColorInversion,
+    .setPixel = setPixel,
+    .setPixelToStrokeColor = setPixelToStrokeColor,
+    .setPixelToFillColor = setPixelToFillColor,
+    .setStrokeWidth = setStrokeWidth,
+    .setLineOutlineType = setLineOutlineType,
+    .setLineOutlineColor = setLineOutlineColor,
+
+    .clipToRect = clipToRect,
+    .clearRect = clearRect,
+    .resetDrawingState = resetDrawingState,
+    .drawCharacter = drawCharacter,
+    .drawCharacterMask = drawCharacterMask,
+    .drawString = drawString,
+    .drawStringMask = drawStringMask,
+    .moveToPoint = moveToPoint,
+    .strokeLineToPoint = strokeLineToPoint,
+    .strokeTriangle = strokeTriangle,
+    .fillTriangle = fillTriangle,
+    .fillStrokeTriangle = fillStrokeTriangle,
+    .strokeRect = strokeRect,
+    .fillRect = fillRect,
+    .fillStrokeRect = fillStrokeRect,
+    .strokeEllipseInRect = strokeEllipseInRect,
+    .fillEllipseInRect = fillEllipseInRect,
+    .fillStrokeEllipseInRect = fillStrokeEllipseInRect,
+
+    .ctmReset = ctmReset,
+    .ctmSet = ctmSet,
+    .ctmTranslate = ctmTranslate,
+    .ctmScale = ctmScale,
+    .ctmRotate = ctmRotate,
+
+    .contextPush = contextPush,
+    .contextPop = contextPop,
+};
+
+static 
+# 464 "./src/main/io/displayport_frsky_osd.c" 3 4
+      _Bool 
+# 464 "./src/main/io/displayport_frsky_osd.c"
+           getCanvas(displayCanvas_t *canvas, const displayPort_t *instance)
+{
+    (void)(instance);
+
+    canvas->vTable = &frskyOsdCanvasVTable;
+    canvas->width = frskyOsdGetPixelWidth();
+    canvas->height = frskyOsdGetPixelHeight();
+    return 
+# 471 "./src/main/io/displayport_frsky_osd.c" 3 4
+          1
+# 471 "./src/main/io/displayport_frsky_osd.c"
+              ;
+}
+
+static const displayPortVTable_t frskyOsdVTable = {
+    .grab = grab,
+    .release = release,
+    .clearScreen = clearScreen,
+    .drawScreen = drawScreen,
+    .screenSize = screenSize,
+    .writeString = writeString,
+    .writeChar = writeChar,
+    .isTransferInProgress = isTransferInProgress,
+    .heartbeat = heartbeat,
+    .resync = resync,
+    .txBytesFree = txBytesFree,
+    .writeFontCharacter = writeFontCharacter,
+    .isReady = isReady,
+    .beginTransaction = beginTransaction,
+    .commitTransaction = commitTransaction,
+    .getCanvas = getCanvas,
+};
+
+displayPort_t *frskyOsdDisplayPortInit(const videoSystem_e videoSystem)
+{
+    if (frskyOsdInit(videoSystem)) {
+        displayInit(&frskyOsdDisplayPort, &frskyOsdVTable);
+        resync(&frskyOsdDisplayPort);
+        return &frskyOsdDisplayPort;
+    }
+    return 
+# 500 "./src/main/io/displayport_frsky_osd.c" 3 4
+          ((void *)0)
+# 500 "./src/main/io/displayport_frsky_osd.c"
+              ;
+}
@@ -0,0 +1,1868 @@
+	.file	"displayport_frsky_osd.c"
+	.section	.gnu.lto_.profile.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"\215\t"
+	.string	"\364\016\250\001"
+	.string	"9"
+	.string	"\317\253\250\341\002"
+	.string	"\001\002\003\004\200\314\324\344\b"
+	.string	"\005\234\315\322\307\005\006\002"
+	.string	"\002\001\002\002\006\203\214\247\213\n\007\312\336\235\231\b"
+	.string	"\b\t\335\231\366\261\006"
+	.string	"\n\324\206\222\355\017"
+	.string	"\013\f\330\267\334\237\t"
+	.string	"\r\016\227\232\363\377\r"
+	.string	"\017\020\021\022\023\024\025\026\027\030\031\313\211\332\263\016"
+	.string	"\032\244\210\203\377\t"
+	.string	"\033\212\355\300\270\007"
+	.string	"\034\307\373\372\231\016"
+	.string	"\035\036\037 !\"#$%\307\356\346\263\017"
+	.string	"&\374\363\3124"
+	.string	"'\365\315\257\266\017"
+	.string	"()*+\337\353\247\276\n"
+	.string	",\310\225\313\200\002"
+	.string	"-\334\317\222\204\002"
+	.string	".\341\345\355$"
+	.string	"/\354\310\222\225\003"
+	.string	"0\242\363\323\343\n"
+	.string	"1\327\371\212\247\f\004\002\003\00223\264\233\356\375\t4\234\305\277\216\r"
+	.string	"5\255\237\343\252\016"
+	.string	"6\240\342\234\212\n7\273\266\332\202\0018\367\202\306\263\007"
+	.string	""
+	.ascii	"  \020\2039\315\003\240T\342\334\371\027:\2039D\035\374q\327"
+	.ascii	"\301\036\"=\216t0C:n\263\341\032\347\031\314!\212q\373`\207\030"
+	.ascii	"g0\016!\036\334\030\334G\255\031\312\007\037\347`:d\361\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`[\004M\n"
+	.string	"2K#&\020\317$\035O"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P"
+	.string	""
+	.string	"P\371`?\360`?p\024'I\222$\211iPHl\244\221F\310\3362\005\377\267x\266\242\367|B\032\177]Hd\004D\037\352\340\376e4d2L\3770\026p<\025zBo\021\016\320\340\002\202\354k@ \003"
+	.ascii	"B}\004}<\035\316\306\275J\343V\305z\224\301\344\305\322*\215"
+	.ascii	"2\221D(\310*{8\372Q\237\365W?\243\266\327\350#6\247~\177tRoC"
+	.ascii	"\266\022\233m\352N1\263\ba\250aI:\324\312\316\001\340\002\031"
+	.ascii	"\252i\036\022\300s,\007u\034\222D!G$\020\211*\242\274\236\003"
+	.ascii	"{\240Ja\265+\3372 \023b\362\346\003\206\222\233\250@\001\351"
+	.ascii	"Q\315X;\333I\276{H\363-\3565\243S\303\223\022:\216\026\375\317"
+	.ascii	"\306Yd\264\255c1\261\230\004\203\214\272\255\243\222\006V\301"
+	.ascii	"X\337\323\254\275\376\377\352\213q\b\331%\323\n\277\r\256@\320"
+	.ascii	"\300\214\363J?\033\022\0033\204m\313\347\271\205\311m\307H\201"
+	.ascii	"\202\234m\0279\023d\023\322\007\206\262G|\253\210\275\260\333"
+	.ascii	"g\223\f\326x\372\226\254\021\365\236L\025L\356t\f\033R\243\363"
+	.ascii	"\212\371GD\376\202:\003"
+	.text
+	.section	.gnu.lto_.inline.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\324\n-\023"
+	.string	"\246\224E:@\345&\035\303\030W\201\346\327=\371nf\236!i\247&y<\317j\252\221\350Bd\0375\214qu\347\317\202\013$\220 \032t\220@\002\t\244d\315\210\021\273\311&[\312\224\0021"
+	.string	"8"
+	.string	"5"
+	.ascii	"\326\270KO\2265\356*R\322\356R\346D\353\"}\256RO\273\313\261"
+	.ascii	"C:R\232\335\265L=\315\333\t\355\227\335\205\261\323\376\226\273"
+	.ascii	"\273j\237\270\023 \320\336t\243CI\345\253<\005\352\272\256{\006"
+	.ascii	"\r3\345\316g\220\312\226\247\002v\327\343\005\205\004\204\003"
+	.ascii	"\203\002\202\001\f\364l\177\250QF"
+	.string	"\177<\3206V\215\222tu\254q\001\3663h\245\313\265\264\273\227964\262?38\371\037Cm{\236\275)T\325\274\260\250\240\230\220\210\200x\320t\210y\275\315o\372kx\372\3161X\343(\333\240\356$\200\322\200\032\313(\366\323\304[\246c\n\310\314X.\321H\"\031\321\310\"\022\362L\220\347\237~d$\260\273\225=\224\353\210\230\243J\2461\257\350e\231\376\233\177{\200\230\250\361tg\322\0302\354\031\220\002\021!\242\252\007\022@\0035\302Q\034\001C\210\"\002\"PB\203\004\304\031#\216\004cC\267\003\262D#\204d\305_z=e\3132\242:p\025\013\225\266~\205\211\356[\0260\232\226\034I\023\n}\323\004\3159Y\234\3242\230:\346_\022\274D\252\"\332\033\203-\232\230A\375\377dE\321\177*w=l\b\001rN\3227\273\346gTn\203\2148\024\022\363\007G\034\234\210H\021$"
+	.string	"|m\n\353\"\303\262;J\204\262H^\204\252\241Qt\223\036\237\327\342\252h\302<\345\301\261\266\333,\002\225D\021\003\036\227v\374H\201l]\t\201T\205^6\263I\220\315\215G\301\207\005\231\271\022\221\250T\364o\377P1[\236\211\037\246\021\274:\\\355\021\2720~\367\366\3350\0176\377\222\331\203\320\302\374\202\372\270i^s"
+	.ascii	"/\232\327\251BW\fE\227\265\005Bf\026\004\352\221F\201i\370S\333"
+	.ascii	"\004\266^\021^,\361\nE\231\204\034\335f\307\003dtD\344\"\216"
+	.ascii	"z\212\261f\222}\366/\3449\252\210\201\245W1\034\215\251\251\207"
+	.ascii	"\007\314\035\355\232\334\276\227\030\234\260L\211\342:\264\233"
+	.ascii	"\311\301I\352\030\240"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\021\te\021"
+	.string	"\226\323>4`U\223\0160\fu\024\305B\245\354\030\300"
+	.string	"A\020\216m[\304\022\020"
+	.string	"\260Hx\256\377\357\353\247\241\\\177_\377\377\377\233\2315\262\275\2334B\366\226;\245\024*"
+	.string	"3"
+	.string	"5"
+	.string	"\223\3060q%:"
+	.ascii	"\036GN\362D\234\334\225\35559\361\223\333\257d?\"\325Q\353^?"
+	.ascii	"\227}\346\020\227\273\361\255]\220N,\026\340\365\244g(\241~\216"
+	.ascii	"\236T\204P?W\255\256\332\275\362\236\242'{R\032O;0( \030h.\312"
+	.ascii	"`.\226\n\205+\215\240\032A\226(\314cF\tOI#\200\201U{\317rK\234"
+	.ascii	"\213\326q\246'Z\024+"
+	.string	"(X\3056\365#O\277\316\376Dc\016Y\"\002\242=T\034J\275\307\0324\f\013\365\013)\324o\200\003-\365\336{n&\344.`\203\214\371Jw\232\335iw\003\\\276\260\375\300\343=:86\212\032\230\350\017uc\206\2377\255\336\264\217\375*\t\200\212\250\200R\321$I\2065\240\002\221!\243q\003\022\300!y\222\3029\034S\212\310H@1\022\212\004\"\022H\242\244p\003\346\270\364\251=+R\244]\"I|\177\2203\363\213\256\021\026\252\007\254HFR2\336J\227k\300\036\030\217\313c\007\205\016\210\273~g\233\236K\007\330\204m\252\030\360\013\343lg%\367 \022n\213\333!\317^\313D\310\001\253\332\270(J\235Bd\356D\352)J\247f\332\246LhN\250\033\254\005c]\214\303\374\277($\227|\243\270\362J0&\204\036\204\230oReOeC2\002C*\215P\352\307\035\002\326P\256"
+	.ascii	"\325\021\340\007\204c>Y\216\351T\020\223b\311' &6\232'4\375\362"
+	.ascii	"]\364\210\341\371T\005\363\257\317)h#\316\210\003\316ac\217\006"
+	.ascii	"0\346\235\346\365\321\025\263QF\307\220&\001+\203\262\003\354"
+	.ascii	"\245\002g\n\210\030\021:\021\021X\b\035e \0040\2728uz\204\372"
+	.ascii	"\234\234(\235\311\227\226\343\345\034\004'\336$\216\235\343W"
+	.ascii	"\t;\254\304x\205\277\301\310\214\312V\016\332<,\315\020`\001"
+	.text
+	.section	.gnu.lto_.pureconst.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375 \246\255\003"
+	.string	"bJ\034\0370\205\265\006\200\366\300\302"
+	.string	"\r\f\f\f\f\f\f\244\305\b\245\224RJ\322RJ)\005\344h2\032\200\313<\346\006\363\227\233\313[\316\362\225\253<\345(?\271\311KN\362\221\213<\344 \377\270\307;\316\361\215k<\343\030\277\270\3055\2578\305'.\361\210C\374\341\016o8\303\027\256\360\204#\374\340\006/\270\021|\372\006>\201/\340s3\347\\@"
+	.text
+	.section	.gnu.lto_.ipa_modref.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\033\002\335\007"
+	.string	"B\211#1`\211\222\0160\f\3030X\256\f\3030\f\274\016\3030\f\303)l\021[\304\026\261Ela\b|\003\376\021j\355?B\254=\360\177#\2445\"w\n?q\304\020\377\262|p\030B(\345e5\035E60,T!\001aW\321\036\244A\001A\007\004\206\002"
+	.string	"n\037O;1\342lR\223\331a.\277\263T\232UQ\377(\023I\004N\021\344\361\034\215\277\215q\027\322;\306F\230\227\324\261\261\317\363\252\235j\366e\215\240\326\274\271\304m\nA\250a`\264\324\375\r"
+	.ascii	"\003!\343t\021p\024\202\020\344T\r\307r(\004U\003\236\362\373"
+	.ascii	"\320;\356s\022LK\253&\177\245L\356[\036WomA\351^\346^_=\204\340"
+	.ascii	"y\266)\024\340\327\274U\354\007\376\352\255\204\352\305\337\344"
+	.ascii	"\313\277\377\376\345-\220\203\b\301C\017\004<\304\005\263.\363"
+	.ascii	"\300\225R\177\2129\231[\336PG\313"
+	.text
+	.section	.gnu.lto_.lto.3ea8fa33787d5f26,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_grab.4.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"M\007"
+	.string	"\342\31526Pm\222\016$\243\252\214*\271J\2705%\247,\316\250\2116\216U\230\231\335\250vl\022\006b\274\031\366\3174\262`m*\001\325\003)\2720N\323\342\267\337\210L\001#\370\030\256?\033\020\366:\244\007\f:tF\360\211H\036\b\021\026\002\271\027r\022!O\204\373@\314m\016~\242\006\350F\357Aw\305\354#TCQU|,\265J\343{\311\n\365\355\332\030h\311\274haI\025\013\305\343\317\376\372\333\276!\025\311\032'\032\220\211\"9\311\214\t+dj\0353\377\375(H\366)\227\330qZ(\261H\255d\246\323\224"
+	.string	"S\353R\001L\255\212\243Y[v;\322\202\224\211\351Tj\003\340d\346\315t\302\350U\177\203\237\363g\004\n"
+	.ascii	"\3043\241L\213`XQ\201\272&\212X\210\nL\020p\302H\265\322\021"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_release.5.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"E\007"
+	.string	"\342\21525@\215\222\016<\314\315\n\002\356\177\207n\241j9\225\241\272#\230\200\0265\242\2255\376Y\f\025,V\370\232\215q\203h\236S.\233\300\t~\006l\003\3557\"S$\370\0262\2038!\354yJ\016\030l\360\220\340\033\225>\017#L\024rO\344\"D\037\b\007\202\230\343\030\374F\f\320\221\336\203.\023\263\177\320\315\204E\361\321\324,\215\257%\255\324\267\200\nMJ\346\305j%Q\256\222\216?\373\314\337\366\005iH\326(Q\201\314\324\bIfD8\001\323\353\210\371\257G?\2627\261D\016\224\302\211\205J%3\335\246\232K/K\007.\275\254\215fm\331\255H\tT\253\023\312\324\006\320\311\314\333\t\205\321\255\376\005\177\347\317\b\n"
+	.ascii	"\3043\241L\213`XQ\201\272&\212X\210\nL\020p\302H\265\322\021"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_clearScreen.6.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\305\007"
+	.string	"\022\21766Po\322\001\2408\2761\347\276\244\321\3402\354\340J\030\374Y\205J\204\331H\fz\357\b;\262\240\231G\275w5b\263\026\216\207\266P1\313\001ci\324\b\331;\245\331\224\r\225C\035\021&?\032\0046\037>\331\224\227\006\212\2700K\024\245\025',\220D\fM,v\020,/\207\0313)g\254\352\336N8\005K\351\002\216<=[\253x\347\314Y)\215\340f\327\355\301\r\373\323B\222\r\003^\bZv3fd\266D\245x\330\246ve\373\317\276\310G\350\253\305\005vI'(\273U\301\013\233S\256\033\333>\310C\250\2552\325\216\216\301\005\243$fwc\3019\232S\323\0074\247 \307\351\037\365Or\003\023\030\256\333\376"
+	.string	"<\273\353\307u\0327\274\355\003\333\036\333\037\001\n"
+	.ascii	"\3043\241L\213`\330X\205\354\232(b!*0A\300\t#\325JG\230d"
+	.text
+	.section	.gnu.lto_drawScreen.7.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\325\007"
+	.string	"bO76PO\323\001\200\340\230\231]\262\300\202\373\007X\024\230"
+	.string	"\212\311\360F8\213\215\230\335\033\033\333\241\351`lk\263Dz\256p\371\320\026*8,\037yb\330\204\354\235R\031\235\f\225A\234\0206=\332\003F\035<\031\235\227\366\201\2700+$\247%%\254O\204\004QLr\016<\257\006*\2639\251\254\352\336F\370\004\314g\021E\226\240\255Q\300w\336\270|\242\310\331\225\203Q\303\276\264qd\307\200\225\001\225]\214\230\227\375&\224\016\333\233]\331>\264\037r\221\355\265\342\002\273#\223\223\335\232`\205\314'\327\3145\324'\333\376\307A6;E\252\034\336\202\313\005I\313\356J\202o\250O\3225\324\247\270\361\355p\363?\362\202\022\226\316\343\016\001:\273k\330y\031w\274m\003\333\035\333\036\001\t"
+	.ascii	"\3043\241L\213`\330X\205\354\232(b!*0A\b\251\333\235v\222\001"
+	.text
+	.section	.gnu.lto_screenSize.8.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`_"
+	.string	"=\t"
+	.string	"\366\221@90\345(\035\2363b4\241p\f\213AAH\205\335\002\210\367\250\202\306Y\235\0316\213\353\200\332`\364F\231\214\3757\f\030\201Ca\300X\360\255\002\n\036\306\022B\210\224)\005/"
+	.string	"0"
+	.string	"-"
+	.string	"\237\207J\363(P&/\273\0135\037\310\216]\027\310\216i\307\273g\347\277\344\330\005FKJezj\235\335u\246T\026\267\336\366\306v\307\266K>&\323`!H\331\255h\001\330\025\f\345\303vggl?\355\217\234\244\373'\361\200\335\225\312\311\356W`\003\3141\177\030\333~\310E:\233u\005zT\200S\266\234zU\275X\023 ^\266\036R\237\221\245\r\021\221O]\0176<5\331\237)\225\303\376\265\272\2625\255eZ3\235\231\001\244-\"d\f\342\204\270\350)-p\233\202\207\264\305Q\351\3030\342D!\030E\320A\364i\200\240\215\203\234\215\343(a\203\244\0307\230\371\366\266\246\232\223zV\325\002\r"
+	.ascii	"\3043\241L\2130,a\b\002N\3244\202fc.\344'\231\275\022\214=h\367"
+	.ascii	"II1]\223\f"
+	.text
+	.section	.gnu.lto_writeString.9.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"e\013"
+	.string	"F\325MB \213*\035\247\202\00149R(\324A\343~\357V|\321\205\002]\002\035T\004'\332Z\255m\370\341&\024!\017\310\013\236\f\366"
+	.string	"1\364xL\320"
+	.string	"p\357\024\2370vo5|\207Q\244\021\262\345N)8"
+	.string	">"
+	.string	"6"
+	.string	"\266}\326[\242\275a\216\fR\023\022\3124\001\304\356v\226Wl\327\346)\266k\272\340\342\245\350\337\302\347\003\325\207SJt9\331\330]\313S\n\301\255\267}\261\rb_$\033\32348\260-\332\024\333\023F\300\242\262\007$\\\370\240\320\300\343\025zeI\035P\035*m\215\214xW\310\272\233@\306qi\037\302#\210\037\r|bw\205!\303\356\230\341\fw\315#\027z\225j\017"
+	.string	"\345O\266\224T\344\251R\257z\215Py0\205\030\311\231=\212\244*\260?WW\366a\377v\327?\377\372U\223\226\232\364\271\255\305\341\242\302.j&\013\340\2770\334L\320\013<\374\274\020\2129\230\016\350i@%\340G\242\t?\357\003\332"
+	.string	"\370\200\236N\347y:\001\236M\200\216\363\201\035\346b\3573\362u\241\347}\035e\334\333\030\227(\261b#%\231\223[\025"
+	.string	"\3043\241L\2130\314U\b\004\314\001\\\023\235\261\241\345\026b\034J\004\203"
+	.string	"~`00\b\300\031\f\3433"
+	.ascii	"0B\240\302\301\335'\325\212I\230d"
+	.text
+	.section	.gnu.lto_writeChar.10.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\340"
+	.string	"e\013"
+	.string	"v\225MB \251*\035/\307\221\005\220{\301`\307\261\024?<40\300\024H\230_c\001\253 \273\226\025Z\303\013/\300\b\006\2203\334\r\214\001\262L\364\335\002"
+	.string	"z\247}\3028\202\031'}\252}B\266\334)\0059"
+	.string	"?"
+	.string	"3"
+	.string	"\027\333\376\200\023\020\355\006sl\251,\246\026\312"
+	.string	"\205\335\3452\227\330\256\315Gl\327\024\300\305K\321?\202O\001\253\t)\025\351\322r\261\273\226)U\312\255\267\255\261\315a\277\013\333\003\b\023\nvQf\026V\2461\b`[\2641v\314\265q\240\245\001\033\375aM\021N2T\332\026\034\361\257\221uW\245\002\306\245}\327\013\210\037M\016\261\313J\260`w\2540\347r\315c*U\325\006I\344S\316\234\224\344MUS\251\237zmXI@](\311\231=\222\244\256\330\237\273\273V\226\375\327\277\035\366k\217\375sJ\353\224\226*}\206\335\2770\364L\321K\036~^\007\306\335\346\003z\035\021\b\370}t\302\317\013\211<!!\020\364\341<\0207\002\362\210p\335\007r\033\215\275\220\307\307\205\236\367q\230qoS\334\341\344@VR\223-\362\001\026"
+	.string	"\3043\241L\2130\214`\b\304\205<0\007p\327l\270\t\020\024\001\343\300\300"
+	.ascii	"\0270\016\f\f\360\bF\360\031\026\314\025\250pp\367I\265b\022"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_isTransferInProgress.11.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"M\007"
+	.string	"\002\31636Po\322\030 [\211RPj|\nw\007\322\212J@\247*\264z\037=\032\202\250\017dg\0264\363\250\367\256Fl6\274\027G\026X\2718\367e\263\220H\266L\001\233\214\f\327\037\rH\213\235\320\203&\035:\233\214Y\310\003\221i\030\bF\fJ`\236\b\370\221\032\324\034\034\263\006\t\267\030%\274\346jg\025PP\243\237\242Gi\274\002\354\356N\231\376-\234ZX\bNvI/.\233R\231t\374\334_\377{\257 \032\302\251\310\204\006\354\232VN\2733\341MF\253\247\016XZeT\300\322\352_a\303\335\351\344 aF\037\025$-\273\023R\033\332\351\353V\035Q\003\017\224\f\225\222\222H\037\206\263\273?\213\322\205N\351\217\360s~\214\b"
+	.ascii	"\3043\241L\213`\370\250\260X\005D\327<d\2070\257k\222\001"
+	.text
+	.section	.gnu.lto_resync.13.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"}\013"
+	.string	"\246\226O> O\234\016'm\001\221\310H\200\221]\300"
+	.string	"\032$y\310\232sq\323@\251\034\023\212\250\314\"\266\360\300!\006\357P\365\013>\016X\207\001#\303q\306t\005&J\2130\251\300F\233H\231R="
+	.string	":"
+	.string	"="
+	.string	"\002vI'R\354v\b\234"
+	.string	"r\350\356\005\250C\310\007P\207\336l\217w\033[a@1\"\341bw/\325\360\355\271\371\357x\006\247\001zV\223\335ur\032\024n\275m\003\266'\3663\001\323\356\256\225dO\351J\323\324\224\206\232\236\316\361k\200\352\303\212H\213\335\t\037/\266\004Up\360G\334\363\2743\003\017\017\273k\035\332\036\333:\274e\373i?\304El\347\370<z\317\230\177\031\002\033\273\253\300/!\001\3637\034\372\037\352\360\034\213I\241&\214Q\214P~\030@\372\236&\346\271I\357\375\027\276\nU\332Z\204<\347\374:\224D\n\262;Qj\006\373\001\234,.\260l\221\\\264H\3518\320\262\006\024N\0267\235\312\203\215\206]\256\210]\020\260\212\346\262d\332%9\340\270\301d\027'\306\354\262\272\320\247U\222\337q\310\007\242\024R\221\253\312MPZY(\215|\026`\022"
+	.ascii	"\3043\241\214\3515j\030\316>X3\204\016@1 7\t\246\325\004y\277"
+	.ascii	"\204[\363\262r\031\310Th@EkVW\300\265\274\020&\031"
+	.text
+	.section	.gnu.lto_heartbeat.14.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"]\007"
+	.string	"\022N35`m\322\001@\203"
+	.string	"3R\033\353^\356\233v2\330Kn\360\311\t5\fY\273\206\223\354\313\236\b\017\324\272.\013d\335Nm6\215\311\036"
+	.string	"\334m\322\366\336;\245\330\224\006\224?\033\320%;\241\204k\"t\260)\255\220G\301\272*P\224Ud\250<\013\3613\257\270\321XZ\0073bR\316H\325\275=\360\214\203\033\331U\324\034\205\375\267\256d\267\211\004E\340c\027bEeO\240\310\205mjS\266\337\354o\234\203\2766\034\263[\002\t\331\255\004.\270\034\272^l\373\031\327\240\366\310\253\026\33142y\360H\331\335\230y\200\345\360\035\300r\350*N\337\250\377\216?\f\211\022R&z\2338\273\353F\312\"nw\333\032\333\034\333\023\001\n"
+	.ascii	"\3043\241L\213`XQ\201\272&\246X\210\022L\020p\342I\265b\022&"
+	.ascii	"\031"
+	.text
+	.section	.gnu.lto_txBytesFree.15.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\235\007"
+	.string	"\202N56Po\322\001 v\273\032 b\342\206\223e\002\3112\303\374\323:>@\030\033\202\250\017dg\0264\363\250\367\256Fl9\210\213\225C\225fA\001c\032\"\204\354\235R\332\224\r\226=\232O&9 \210l>p\264)1P'\002\313\256O\224W\234\270:\022\3213\263\250A\260\304\034f\324\244\234\321\242{[\240\326Z\317U\231\nha\323\320\203\034\366\247\205#\3731h\224Z\f\\v3\352\313\246P(\036\2667\333\262\375\236}\221\217l\247\024\037\330\035\255\234\354R\005/`N\231bl\373 \017\331\314M\264\243\013\020\261\\\224\224vi\314\274\240:5\235\240:\005I\347\3768\377$?\370x\021\251\230t\241?\200\315\356\372at\0337\274\355\004\333\033\333\244\n"
+	.ascii	"\3043\241L\213`\230\245\202uM\244b\201K0A\300\t#\325\312K\230"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_writeFontCharacter.16.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"-\n"
+	.string	"\266SH> \247j:\007\213"
+	.string	"d\003\340\t \236"
+	.string	"\373\270iX\0019\210\002\357\020\200`\033\316\033[\263M\031\214\344\200\331\201\2460!\n0\020\264\275\024:@\253\242\251\0013\225\371\234\236\032\3312\2454"
+	.string	"9"
+	.string	"2"
+	.string	"\332\263\355\b\3323\333n\320\220\016\275\fAMH\tL.\004\273%7A\036\272\206\374\273\216\215x\274N)\321u\362\260\273\326S\252\343\236\267\215\261\035a\237\022/\005[ \033 b\233\264+\266\263\026\206\202eK\001V\020Xy"
+	.string	"\344Y \265l\211\264\341\260=\263\250\252}\222\257\310\227d\374`WE@\300n\311`\315\366\314\345\023\002$S\024\233\237vx\241?i\363\2421E\326\371y\323\202\221\276\354R\244\363\303>\266\273\353\251\262\255\326\336\372\261\263~\325\324\237\030p\030X8\260\213\n\342\2047\305\357\3530\216\327\351>c\007\334\354e\2761\334\200(FQb\363\021C\017\250\253\360\214\340\307\205 \327\001;\013\316\023G.\203q\350\341\210\334'\fE\256R\356\255\315\313h\006\r"
+	.ascii	"2\003\3020\021\341\352r\315\336\231\020A\2110\222\204\270@\370"
+	.ascii	"L\215\202\313\222\246&\232\256\371\004"
+	.text
+	.section	.gnu.lto_isReady.17.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\345\n"
+	.string	"&UM? O\234\0160F\262\003\260\2312\260\326\216H+\256\376"
+	.string	"b\342\200\204\200\3443\343\324\032\301o\372\317\002\214\326\207]\313\314\370$8"
+	.string	"-\207\203\200\207x\226"
+	.string	"x\200\246\021\007!\332D\312\224\002;"
+	.string	":"
+	.string	"8"
+	.string	"\036w\017=\224\036\242oD\"\265\033b\332\341\335+\315\316\007"
+	.string	"~^]\030\256U\002QJC\004\fU\001:F\034G=I\240\227\371\240\354\256\363\003/\334\361\266\027\330V`?\022\247\337r:\246\257\321\300B\n\206\001\025\273\245\0312vEL\361\301\266\307\206\330\316\264\017\342!<?U\270\200]\223\211\215\335\360\200'\327\243\303\023\260\036\257\017\260\036m\033\301$JRS@\352UWZjO\340\362_\324\312-6N\033\324\235uu0\302E(;\034\323\246\320\311\177\327\243~q\240\bc\274\360\364c\207^*\007\373\325\356\256\325d?\231\213\306\302\3414\331\345\213\004\303i\225\016\004n{P\341l\332\246c\211\260\3412\f\246e\230&\263H\300.\033\207I\nX\333d6\214\243i\033\006\tAW\223\217:\003\026\031J\234\310\213\2705j\006\r"
+	.ascii	"]\b\270\323i*\013\225\205\275\206j\nxe\335\3532\254\227\013\216"
+	.ascii	"y\013\tbVlJh\032\203\202\002"
+	.text
+	.section	.gnu.lto_beginTransaction.18.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\204\001\325\016"
+	.string	"6\334bC"
+	.string	"\221(\035;_\034\254\340\342\200\274Dc\315\340\377Pf\222\356\b\025\373\363\r\376=\237\324\240\225\365/u\021\325\264<\261\016O\353\007\377\277N\362\223)\016\006\344R8\325\337sFb|B\366\336R\246\024L"
+	.string	"O"
+	.string	"N"
+	.string	"\235\002/\310\016\335\275@<\314N \036Zd\323x\227\262\230\n\204\251ecw5%q\321#|\232\"\037\023\311\234P\243G\017\207\0322\344C\271\006@\225\236\307\356\276\365<A\22121\221\335u\236P\035n\354\266Ml?\260\277\022v<\313\017\337Y\267\276t\276\3643"
+	.string	"b`\034\220\261\273\341\205c]\320\245\304Y\277\375\267\334a\233\025\312F\0342\227\226\210\230\335.\301\241\033\330\331}Et\026\013O\300\226F\254\030d\207\036\357i\337\304O\210\216\342\302\007\354\246^\264\330\r\316\0250\256\222\216\242\252T\\5*\202\030&\024R\276\240\252|\225\227\020\372\207b\246\270\310\221~(\252\236\264<35d\005\363T\225\273;\322\177\304k\204\0243Jy\303\377G\204z\rY\265\230>\220\362ew\243T\225\375\267\273kM\005\034\310\003!\303\201<\333+\331t4 \256\303\311\274\001!\341\266\221\220\t\367\2210\002\372l\236\220f\202\207\343\220h\033G\353p4\024\264\315\207\323@\fx\363\224|4\320\266}\264\216n\377VS~\353\031\225\027\0260\252\337S}\016j\2700(\311X>\265\271\n\371S\037"
+	.string	"\202O\211E\205\336@BP\214\201\311X\227\016\373\233\302\016\320\034x\002\b\372\253\036Ruu]\200<\254\307\005W\213\225\242\354\021L3\212~X\302\272`}\246PAci\n\265p\215"
+	.ascii	"\fAq \013`FQ5\266\253\224\001"
+	.text
+	.section	.gnu.lto_commitTransaction.19.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"}\007"
+	.string	"\302\21655`M\323\001Ka\2014\036v!\033\346\037\243\222B\241\232JO*\323~\343c\230\355\262\036\211\275\3324\002\222\220\272Q\230N\004Cm\n\326\212\232Yk{\247\024\234\352\242\262zY\223\253\314\246N\215\346Pi\203&\243\023\323\250\007\254Z\0339-yY\024\204\254h\225\031\003O\214Ce6'\225\230o\037m\364\314\020\002M\304\216#hk\021\360\235a\210\n\250\0239\373\343`\374\330\217vw\035=;\006\254\230\034\224\354V\204R\026$\215h`l\037\332\347x\307v\017\211\013\354z$\"\273\037\202\023\246K\376N`\2714}\300r\311\233}\362/c/\237\r\n\020\224\335\225\021\343\333\341\346\377\343"
+	.string	"\235\207;\274,\354\256a\347\261\270\343m\027\330V\260}\021\b"
+	.string	"2\241U/p\270\340"
+	.ascii	"\346]\002hVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_setStrokeColor.21.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`E\001}\f"
+	.string	"\326\226Q@ q\232\016\034A\226\016\302\3002_\b\377c\001#\303\220\201g\300\032\3004aWd7dZ\327\334 \204\331\376\217\330u\333h\200D\021<\003\001\024\3721\213\n4\237%\332P[\262\267\224)\005="
+	.string	"@"
+	.string	"<"
+	.string	"\320a\364\002\320\241/{\345\034\210\265\234\304\300\200B\306\356N\372\341\327\237\346\345?\345\033\332\326\371\273l\034\256\322\206=\314\356\006\330\262L\313\202\335uj\333\206\033\3366\003\333\r\354\217\b&\366KCM\353Q\376\204\244\02702-v5t4\366\003Y\210\260}\311vr?q\035\245\302\033\260\231\207\020\035\321!\346=\355\223x\211\353&,\234\300\256\211g\305.\227\300\n\242Cs7\020Pm\tV^\363S~Qq\361\311\264\243\242\342\245\260'\330+\251-\202\303g\215\334\335\216\236\003RUO\2263,\240\353\272\356\034P\252\252\363B\007,;\233\303RO\354\277\335]kU\004\211\032hQ\024D\250\016"
+	.string	"\326d>\254\350A\022\301\252 x\214T\221CB\201p\254\315\307\0247\223\310\206\n\2314\2255e\0168r\036T\323H\214\325$q%\327T\277\364C \250\031\034x>%\2129\312\035"
+	.ascii	"\3043aP\026aX\206\215\337\301\204\203\340:\365\001\202\013/\334"
+	.ascii	"\260\327\325\302bv\025cCM\303E\303\020!\n\270\242j@g\260/\\\003"
+	.ascii	"\212a4\020>S\243\340\26245Z\334\345\230M\376\224\367]\205\f"
+	.text
+	.section	.gnu.lto_setFillColor.22.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`E\001\205\f"
+	.string	"\326\326Q@\020\221\232\016\374\203D\024@\307\353\232\371\210\354(\224\032@\036\372\326x"
+	.string	"\206d`\037\261E\323z\253\214\020f\013\302\370|[\005"
+	.string	"P\007\202\001(\300S]F\0201h\233\361\254-\331[\312\224\002="
+	.string	"@"
+	.string	"="
+	.string	"\317\037t\003\317\237+\273\345\232\210\305\244\270dH\341\262\273PC\274\272\323\254\374\257\034"
+	.string	"\226q\3566\262\016\327(\263\034\307\356\n\310\256L\f\203\335ub\031\207\373\335v\003\333\016\354\223\b(\266K?M\353U\376|\242\227\030\220\305\356\206\215\306v\236\213\021\266\037\331N\355(\252\253Xp\004\366\002\361\341\003\372\343pO\373%n\242\372\211\013/\260\213\362\242\305\256\246\300\013\240?k?\020O\355\tT\036\363W\276\301\"\243s)\207e\205SaS\260[\022\333\004\177\317\032\271\273\034}\307\243\2520\256|\361\200m\333\266w<\251\252N\f\036\254\334l\315JM\261\357vw\255\001S\024\211\231GI\025H\244\217"
+	.string	"\316x\204P\021\304D\0025E"
+	.string	")\231\342\306D\022\331P\232\020\0305\220D#\215\300\314DA\017\004\216\033\b\023,\211q\202\221vrM\265K\177\344y\252\341\301\214\316\211Z\2062\035"
+	.ascii	"\3043aP\026aX\206\215\337\301\204\203\340:\365\001\202\013/\334"
+	.ascii	"\260\327\325\302bv\025cCM\303E\303\020!\n\270\242j@g\260/\\\003"
+	.ascii	"\212a4\020>S\243\340\26245Z\334\345\230M\376\224\367]\205\f"
+	.text
+	.section	.gnu.lto_setStrokeAndFillColor.23.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`E\001\205\f"
+	.string	"\326\326Q@\020q\233\016<\002H\b\200\227"
+	.string	"m\f\025\325\020\341 \310C\257\300P\343\261\006\333C4!\323\372\257\025u\265\215\352\266\246m\020\001\005\b\240\003\235\004\231\363\005\250\362\037\257\367\177\364'{K\231R<"
+	.string	"A"
+	.string	"<"
+	.string	"\321\241t\002\321\241/{\345\334\210\265\234t\030V\320\330\335IE\374\372\323\274\374\247\234C\333@\177\227\215\303\025\263aO\263\273\231-\313\264,\330]\247\266m\270\341m3\260\335\300~\211&\366KCM\353Q\376\2142\036d(P\331\325\320\331\330\020\204A\302\3661\266\223\273\212\353(\025\236\200\315B\230\350\220\0165\357i\377\304Q\\Oa\341\003vMf\274\330\345\0208\201th\356\005\002Pm\tV^\363S~q\321!\224)\250\005\213\247bO\260WR\333\003\207\317\033\271\273 \375&R\325\030Y\326p\200\256\353\272o\242TU\347\005\020Xv6\207\245\236\330\177\273\273\326U\004\211\035hQ\024D\250\016"
+	.string	"\356p>\254\350A\022\301\252 x\214T\361CB\201|,\317\307\024=\223\210\207\n\231:\2255q\f8~\036T\323H\214\325\204\341J\256\251~\351\207DP38\370\020*Q\314R\006\035"
+	.ascii	"\3043aP\026aX\206\215\337\301\204\203\340:\365\001\202\013/\334"
+	.ascii	"\260\327\325\302bv\025cCM\303E\303\020!\n\270\242j@g\260/\\\003"
+	.ascii	"\212a4\020>S\243\340\26245Z\334\345\230M\376\224\367]\205\f"
+	.text
+	.section	.gnu.lto_setColorInversion.24.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"=\t"
+	.string	"\346\021B:0\345(\035\2363\226E\221'V\310\203\026\023:[+\352\036s\334v\353\277\256Y\314\031/\373\b\214b4\3126\264\206\006%\325\242\324\361XH\351b\340N\353\232%\261[\246\024."
+	.string	"2"
+	.string	"/"
+	.string	"\333\265\315\r\266k\016m\230\317\220\325\2748V)1\273+\343\353\3415\364\217\362"
+	.string	"V+u\325<\354\256\225\325\362\270\343m+\330\206\260\315\022#.\016\263\335\216\031\200\225i+\"\266\317\261\035\325n\360\204\237\030\237\b\0371X\354s\265\017\273I\370\223\214\027\354\272^Tv'\203=\233k\236?\b\231\215.G\220\310TQ\303\233>\332\026\027z\226\0236b\312\032\037\005JZV\001T:\263gJ#\210\375\314\356\256\243\313\376\3745\252\257\021\004\242\221\351\033\235H\335\006\344N$\3563\340PG\004z \324\004\370I\200L\237WBq\024%\260\023I\257\223\244\216\253\220\241\017\224\235\005{\245\321'M\236\367I\316\334\007\n"
+	.string	"\3043\241\214i\3553\034\234-u\r\235\ns\301\211"
+	.ascii	"e\005\\\313\013a\222\001"
+	.text
+	.section	.gnu.lto_setPixel.25.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\223\001\355\r"
+	.string	"\266\231ZB \217\223\016\344h\260Bj\212>[%\320\365|\360a}\200F\004}\t\001\314#\354\221O3dqP\357E\250v\177Q\343\354UB`\241\323\rT`\20062\314D\253;}Y\333F\310\336R\246\024E"
+	.string	"J"
+	.string	"C"
+	.string	"\234\207\017d\016\315\235@u\230\371\200\352\320\232\035s\016\304Z*\034,\234\210\261\273\227\252\\\373\323\324\374\273\\S\332D\177\233m\303\225\263\215\036\307\356nl\244L+\301\356:K\233\206\033\336\266\002\333\r\354\247\002\207_\371\337K\353[\376\314l\264x\201"
+	.string	"\306n\206N\306\242\340\212\020\266\317\261\255-!\021\fX|z\001\226\364\341\302\202\344nB\373\212O\326\354zH\301\354\256\207A2\207\034\357i\177\304Ih/Q\341\002vM/0\273\001\216\022\362%\337\345\033\025,P(*zI\361P\330\231\035\223\2455p\370\234\221\273+RMq\276\243RU\027\244L\031@\327u\335;\252TU'J\207Qv67JM\261\377vw\255&\033\246\255\263<X$\211\036\030:\205g\235\t%\035\020\r{>D\262\030\022\032\3110\b!&X\004\205:$\240\354#r\305\317U\362\351D\270<Xv}\024p\004=\300.\223\030\261\213\303\235\374\255\232\324/\375\221\312R\f\016N\250\023\035Y\223\226B}\352! p\202\031\322\252\003\304&\f\3024\200d\270H\346\263\260=\353\272|\024\334\275p\335\353\260"
+	.ascii	"\331\356c6\224\206\213\302\020D\241s\234\204}\353\017\350ih\177"
+	.ascii	"a\320e(\203X^ \236\022ca\330&\322\016\213\244\345 \221o\367\276"
+	.ascii	"\366\221\001"
+	.text
+	.section	.gnu.lto_setPixelToStrokeColor.26.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"}\t"
+	.string	"\326\221A;0\345(\035\340a\3073J\332C\034[\360f;\231G\263i_[\003\265\364\322P\177\\\001U5\004\266Po\305\206\326\320\250\204a\320\024\355}h,\320R<\241\377o\262wJ\001."
+	.string	"1"
+	.string	"0"
+	.string	"\232K\316\r4\227\376\354\227\327\221\335\264H<`"
+	.string	"vw\306\326\277\303\317?\354\001\251\025\352p\323\260\273\206\251\325\307\035o;\301\366\203\355Yr\245\304\366;\366\013\304\001\326\247|w\231E#X\216\020Ulw=\006q.\021\264C\373&?\371\216\222\361\202]\226Kl\267z\274\300\271t\375A\206\230\221i\304\rK\030#\214\366\205\007\2372T\211\221uD\224]Q0\212\330\327vw\035Y\366_\177\274\353\207r@\246\205\001fW\025`\266\262\3361\336m\026\245\r$`\321g\324\321\2207\321q\022\241\023GM\336Fa\352H\243II\263D\332*\246\210\353\346G\301\324\024\301\315\023\245\334\354\324\275\266\221\025\017"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F@\276\240\303\224\020\"\020\003\\\221"
+	.ascii	"\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_setPixelToFillColor.27.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"m\t"
+	.string	"\326\021A9@\217\322\001P\3301q\227\252\243\360n\3737\331\212\370?\212\342\356q\026\013\324\017O`\235\306n\013\345El\204\016\202_\016f3\261\002\356\032(Qk\314l\333d\357\224\002."
+	.string	"1"
+	.string	"0"
+	.string	"\232K\316\0134\227\376l\231\327\222\335\260N:^3\273;#\353\337\341\347\377u\200\224\nu\270a\330]\303\224*\344\216\267\215`\333\301\266,\262\305\304\366;\266K\244\001\326\257|o\331E\033\330\215\021\017\330\356z\f\342\\\036h\207\366Q\236\362]\005\343\004\273\253\030\330n\365X\201s\351z\203~P\3052\242\206%\214\021F\333\302\203O\031\262\314b\034\021eW\024\214$\366\265\335]\307\225}\327\037\337\372\241\024"
+	.string	"yY\200\331\375\230\3116\026\336/\336m\025\245\r\024`\321g\324\321\220'\321q\021\241\023GM\3366a\352H\243II\263D\332(\246\210\353\346'\301\324\004\301\315\023\245\334\354\324\275\266q\025\017"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F@\276\240\303\224\020\"\020\003\\\221"
+	.ascii	"\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_setStrokeWidth.28.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\345\b"
+	.string	"\266P>:@\345&\035\340ag\374\237\270\270\266\372\323\f`[+\243#\271\365\367\016\260\342\337\340I\377bI\247E\355*j\310pk\362\326\236\300\260\214\364\027\360#8\365d\333&{\247\024+"
+	.string	"-"
+	.string	"."
+	.string	"\006\233K\1776\315+\311rV,\033+5\273;\343\352\337\341\347_\345\001\250\224\351\220\363\260\273\206\250\224\307\035o;\3016\204m\230/%\266\337\261\r\353S\276\263\026.\202=\211p|\260K\204\353\320\276\311O\276\243`\274`W\025\343\262[\031\334\200]\272\376`s\211=*G\204\2642\242\206%\204\321.y\360(\303\226\217\326)\232\354j\202q\304\376\265\273\353\250\262\317\372\3415"
+	.string	"2\343 \263\333\021"
+	.string	"\300\266d\245w\331\305(\373\b8\344\021u\024\344Qt\334\004\210\304\321\315\313*\266N\023M\252\315\221\226Y\314\020\327M\217\202\351&\301M\022\245\334\354\324\375\2651\f"
+	.ascii	"\3043\241\214i\3553<\316\272\270F\021\303\274 |\246F\301eij4"
+	.ascii	"\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_setLineOutlineType.29.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"%\t"
+	.string	"VQ@9@\217\322\001\230N\274\351\022>I]\301\026\r\033\266@\252\300\350\266\264\356\027j\220\221\243\243\221\316\031\253\033\3751\025`09\335gb\200\354\022(Qk0Z\273\311\336)\005-"
+	.string	"0"
+	.string	"/"
+	.string	"3{A\346\323\240\355\362\020d5\252\225\215\222\227\335\245Ru\360\021\364Or\200\023\252\364\250i\330]\307\023\252\343\226\267\215`\333\301vJ\03410\373\232(!\266\277\261\035\303\217\200w]`\003k\362Xu\262\317\003\354\321>\353-\360\"\030'\330M\265\234\354\206\n^\310>\035\336 \363\035\335\204{le\312\017\255W\206\324\360\214Q\332\026_\374\311\321d\3652\311\222\035\226\242\374\260\217\355\356Z\246\354\273\376\210\t\260X\030Tv\003!\356\203\b\2156\021\211\242n<\255b\244u\002\374\341\200\274\352\371$\274.\302C\352*\367i\"\316\333@\264nt\264i\023\364\323y\224\223\340\312\205:J\2525\f"
+	.ascii	"\3043\241\214i\3553<\316\272\270F\021\303\274 |\246F\301eij4"
+	.ascii	"\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_setLineOutlineColor.30.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"-\t"
+	.string	"\006\021@:0\345(\035\2003\226+z?V\361|\240\376\025\311R\316I-3\030\243\276\256\3210g\f\366-\350\236\225@\333\262\227\022\003\252C[`\021\304\006\234\b\226\254\326\332&{\247\024,"
+	.string	"/"
+	.string	"."
+	.string	"?\320<\272\263e^Av\343\202\331@\231\331]\t]\357\376:\377'\017X\261R\177\233\207\335\365[\261:nx\333\n\266!l\257\004\261\250\"b\373\035\333\257\336\244\373\353\"+X\225G\310\207\363\230\220\375\331\0379I\367\022\214\033\354\266bRv+\203\0338\217\256G\320<r\002Tv\352\336%\226\0015\034\337\203\266\005\352}\345\007c\211\251`\312\256\251\007?\354g\273\273\206-\373\257\377e\004-/\016\260]\216"
+	.string	""
+	.string	"6t\222\346gT\332H'\212)\300i\025%\3553\340\220G\304M\020J\202\243\021\240\023\235&\224F2q\233H\316M\2266mB\206('=\013\236\246\021\225\2479\003\r"
+	.ascii	"\3043\241L\213`Xk\330\340&\270\270F\021\303\274 |\246F\301ei"
+	.ascii	"j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_clipToRect.31.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\235\n"
+	.string	"\306SH> \345*\035\300{,G"
+	.string	"\300\001\264\252u.\3254XWhVob\300"
+	.string	"\200+T\351\2608\224\265\2020\200jAn\233h@\004O\216\263\2568\262a "
+	.string	"\300\244\251\350\333\337d\357\224\0023"
+	.string	"8"
+	.string	"3"
+	.string	"\235W\227?\330\274vn\260y5i\327\274<Y\016\f"
+	.string	"\313\005\267\273\036\205\235\374$\375\303\334\323r\255>9\r\273\353\331r\211\334\364\266\023lK\330\177\b\267*\223b\373\037\233\206\0221\033\201\220\331\326\021\354G\t\210\303,\337B>f\233=\273$\271\332\356\202,\352\274\"t\237\366U\276B\236\205\343\005\273\257\231\332n\t\362B\036\256\263\322\216R:\251\255\032\347[\2361\001n,\272\262\313\325\244&\366\273\335]\323\227}\332_?\373\273\313~\372\330?9\0038\032\206\227\335\220\001\271\r\026W}\374\306\305O\343\364\211\004L\n\225Dp4^\210a\305(\025\202\250\361\303@\211\246\222\007\232\274\223\351\313\360H\241\350\205\024\f\242(B/\005\202\241\367)\367\335\322\227'\004\334:h\024"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\344\005\305S\202\261\200a\320D\232\302\002\256\345"
+	.ascii	"\2050\311"
+	.text
+	.section	.gnu.lto_clearRect.32.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\235\n"
+	.string	"\306SH> \345*\035\007,\004X\002\216l\330\272uk5\r\326\025\2322*P\031\037\0361\3201\217p(k\005a"
+	.string	"\325\202\3346\321\200L\007\017N@\341 ?4\001@\033\311u\374\266\311\336)\0053"
+	.string	"8"
+	.string	"3"
+	.string	"\233W\227G\310\274n~\220y\365h\007x\351ZM\253\200\352E\300\356v\264\365\361s\364\017s\016\271J}j\034v\327\223\\\211\334\364\266\025lO\330\207\b\266JS\261\375\216-sI\304L\"`\256q\004\013\202B>\314\362.\343_\256\231\263{2`\266\273\036\2036\257\t\334\247\375\225\263\214o\351x\301.+f\266[z\314\020\037\256\263R\216R:\251\215\022\347IO\332\210MESv\231\2324\305>\267\273k\312\262/\373\353c?w\330O\377\372\247\306\200\004@\303m7\344F`\003\027G]<\307Co\243\344\201\006,\372\214\302/$b\204\240E\350\004~&\321\3130\205\244Q\367\221\272\022\311\323\350D`\330}\026\374\231*\300\356\364}`\327)\367\334R\226)Jl\0364\024"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\344\005\305S\202\261\200a\320D\232\302\002\256\345"
+	.ascii	"\2050\311"
+	.text
+	.section	.gnu.lto_resetDrawingState.33.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\235\007"
+	.string	"\242\31656Po\322\001\240\\<\241\b\330\234er\303S\200\367a'\206\333\224\207\331H\020\343\303\331\373\321\242~\002\265\264\033[\272}\263\324\250B-I\177\266\351\326\b\331;\245\264\242\bU\f\001\376t@Tz\260\b:!<\242)/\254\222\270\250\005\212\322\212!\253\232\210\237Ic\347\300\362z\230Q$\345\214\234\272\237\026rv \351.\340\310\323\263\261\212\367\315\257$\322\215\240fW\355A\016\373\323\356\256!g\303\201\221\225\006\227]\215\030\230\355\250R\b\307\366\237\375\222\233d?\261\270\300.\307\242\262[\021\234\2609\345\372\202\314\251\315\t2\247\234\331-\257\037\253\001\311\300Hy\331\335\b=\236\375e\376Q\016\260\221\264?\215\302\356\372m\244\215\033\336\266\201\355\005\333\035\001\t"
+	.string	"\3043\241\214i\3253\034\316:\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_drawCharacter.34.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\003\001\245\f"
+	.string	"fXVB\020q\233\016+\004\254\004:E\034\n\303\213Y\2508F\f@%\237JF\245\344\305\005w\025\037_\247[\306\214f\002\324\253O\333 \242(\210\r0\201\022\246>\035/@C\207\236\263\350&B\266\224)\005B"
+	.string	"H"
+	.string	";"
+	.string	"G\341=\005\206\007\330\025\271P\331\0057>P]2\370\001\323\245\352\231\351\222=;\306\301\021K\221\360\360\255\230\261\273\227\212\270\367\364\374\247\334\n\221|\236\024\202\335u\206H8\334z\333\004l7\260\237!\231\376\206\200\225\027\013d\354n\bil\213\264b\302\366/\266\343(\004\006\003\026?\361\216\322%fG@%\024T\2270\371\314db\226\210\331\021\020\032\022$x\025\336K\314bk\367C\250\262\273\033wT\2274\361i\377Dv\005.\037\262\346\323\217\243\246\336\322\353Sn`t\362\325\020\311\320\017\0372\251Z\352\374:\2002\264\301Oj\b\373qw\327*\262\245\264u\223\237z\311?\035\345\217\037\375\232\351\f\234G\313\342\026\201\243\335/\234\303,\200`\035"
+	.string	"\314\341\370\3402\217N\002\267A\360\360l\231\326a\0234\256\363qe\235\013\244\203Q\2708\033wq\024p\246=\330.O\226m\327\005\334\307U\221\035\264h\021Q\220\253\274\246R:i\026"
+	.ascii	"\3043\241\214\351Dj\2308\3738s<\341\032\346h\343\235QM\tW\200"
+	.ascii	"\316)\341\002\260\237\216\321u\270\b8\027tN\t\301\002\201\301"
+	.ascii	"\025ij\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_drawCharacterMask.35.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`&\002\255\020"
+	.string	"6\237kD"
+	.string	"\261&\035D\004}0\313\357\344:\005\327\375\263`\214,@\3232f\032\306\301\304\350a\253\320l5\350\350^#T\312@\324\3703n\275\227|\347KFP\b\023\005M\001\277\037\300\370\227|\223F6\2212\245U"
+	.string	"Z"
+	.string	"T"
+	.ascii	"\327\323~\211\233\370~\002\303\007\354\276\354\340\354\202 N"
+	.ascii	"\220=\032|\001\3541{\007\366\350\317\3469\030b?\"bV)h\354\356"
+	.ascii	"\246 \376\375\322\374\374\337\034\304j\261\374\002\320\342p\325"
+	.ascii	"Z\251\313cw\003\264T\231\037\005\273\353d\2656\334\361\266\027"
+	.ascii	"\330\226`\247*\326>\363\203.\363g\247\371?X\032{\315\037o\363"
+	.ascii	"k\2463\323\347  \003\206\203\030\273\032B\033\253\023sH\330\276"
+	.ascii	"f;\332\254\300\304@\270j,\354<P\361\025\337iN)ZUjD\203\354Q\224"
+	.ascii	"\357\300f:0H\360(\276\313\270\305%Z\325\207\026\234\335\005\261"
+	.ascii	"H\366\350\021,\376h\352\252\007\225\241\013\026W\216\215b\363"
+	.ascii	"$k\017<>o\344\356\262\250\3028\377\201a\252/TY\303\002\3020\f"
+	.ascii	"\377\201E\305\324\231\301\203\246\327\337\034AM\270\352Ae\350"
+	.ascii	"\207_\301T5u\256\\R\031\332`*\025\306\376\265\273k}\261\263t"
+	.ascii	"\350\223\001\236\212\211\273:\356\204#\305\216\002IO\277poT!"
+	.ascii	"e$\302aR\b\211\307\215\234L\274n\302\210J\307\231N\243\023\223"
+	.ascii	"W\"\331\270\322\226R\032\241l\244\316\333B\f\2303\225t\233\n"
+	.ascii	"\307u\233\006\242\256Q}\245_\202\205\264%\302\f\035\224\246\034"
+	.ascii	"\312kHSA\232\251]2\311\263|\255\213\006, \220\202\231\271\253"
+	.ascii	"\003\304'\fY\274\303\372(~16\336\223B\013\270\353\355\200\373"
+	.ascii	"\331\243\345n\263\353\214\255km\321p1LI\224\352\217\007\314\221"
+	.ascii	"\234\375\310\036\206\314xU#4\300\210\341\236/D\271\fdD\341\200"
+	.ascii	"\354\2473\272\376\"\316\221Y\300\210r\334\210\301\025i0E\360"
+	.ascii	"rP\223O\362\276\253\223\001"
+	.text
+	.section	.gnu.lto_drawString.36.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"\005\f"
+	.string	"\366\226RA\020\221\223\016PyDq\204\233\270.\340i\214\336(\261\fP\372\2512"
+	.string	"\"'\3034\351\003YtM\235\327F\006\tU}\217R\001\024\3056J\002T\200\311S\r\026\342t\225\321\256\021K\366\2262\245>"
+	.string	"F"
+	.string	"8"
+	.ascii	"\007\260;"
+	.string	"z\261\262\313u\214`:4\367\001\322\341t\001\322\2415{\3069\021\213\031abcQcw)\rq\355\251\371WyFT\022zb\022\354\256ST\302\341\326\333.`\333\201}\t\001\231~&\300K\214\0060v7t.\333\002]\224\260}\215\355\227\022\"\203\201\242d\0046K\262\202\304\202\023\263\274\315\222|\320\240 \271\253\320nb\026gv=\270\254\354n\307\034\323!\347=\355\2378\n\355)2\004\372\324\266\020\363\"s6\ry\322\353U~\240\005\215\355E$;\277{\210\224:\251s\3530\222\235\315\205RA\330\177\273\273\326\221\r\323\323Q~\351'?\274\311\377\236\362g\021tY/>;\206\307\352\002H\305\261a\017\317G\264:\262\t\021\213\320\001\302\254+\253(\\\361\363AY\037\n\344SU\240<\260Hy\f\330\272 `\024\310\2620J\303\355\337\352\310\017\272\026\021\035\361\224WIa\024"
+	.string	"\3043\241\214i7j8\340\354\001\\#\356l\350-\024zu\031P#^\205\013\205\32100 eP\024%\330\r\330"
+	.ascii	"M\244),\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_drawStringMask.37.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\t\002\355\017"
+	.string	"\246]gD"
+	.string	"\261&\035\037\nD\250:y\242{\320\n\367\237\377#Z\372\016\336L\203M5\261t\214\355`m[>\270\3577T\312@\004\374\031\267~jG\373A#(\204\210\202n\003_\217\243l \215I#{K\231RR"
+	.string	"V"
+	.string	"P"
+	.string	"%n\342\364\023\027N`\027f'g\327\013\361\002\354\321\336\013\\\217\330=\256G\237\354\236{\"\366#\263\242E\305\214\335\3254\304O\207\232'\3778\007\300j\241\016A-\016\327\254\245\202\037\273+\240\265\312\3740\330]'\253\265\341\216\267\335\3006\211\235\243\316>i\320k~\3544\377\3473\377u\245\343m~\370\233?3}\016\217\0161\"\274\330u\371j,O\324!a\373\231\355x\303\022##\001\332T\200\001AkL\006:v\225b\304\003\032\027\007\351\035\305\3513v\001;v\005\"C\316\356\206x\004{\374\200O\373\001>\316\017\354\213\242Z\350\300\034[\305\356I\326&x|\332\310\335E\251\3068\017rE\325\235U\322\360\200\357\373\276\203\\P\243:1|"
+	.ascii	"\351\3658W\300BF\313\215T~\376w\226+\025\244\316\226\027U~\266"
+	.ascii	"\247J\215\261\017ww\25506\226\001]\211\264AnK\331D\261\273\351"
+	.ascii	"\026\336\205(\254\204F\002X$b\322m%&\224\216\233PR\3426\222)"
+	.ascii	"\224B\352F&\3326\322VF!\025M\304u\232\b\002o\244\023N+m\033\247"
+	.ascii	"e^\352\n\3250\375\223+S\r$\036xR\2522G^3\305\364\243\227\332"
+	.ascii	"#\224<+* \220\202\231I\363\304'\f[\f\303\316$\376\032\305\033"
+	.ascii	"\\\367G\301\305\213\007{}\026S\332I\311\206\332p9L\371(\225\035"
+	.ascii	"\017\314\221\244\375\306\035\006\373xW;4\300\210\303\335P\310"
+	.ascii	"q\031x\304\037.\205Q\007\266\224\335\005 S2\2216l\"\355\260\310"
+	.ascii	"\267\034+\362\367\336\327\0322"
+	.text
+	.section	.gnu.lto_moveToPoint.38.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\215\t"
+	.string	"F\222B9@\217\322\001\300\370\031\377\\S3@eo\003\362@\337y.cNwp\365\313\361\341\t\254\323\330m\241\274\210\215\320\305\365\037\303\370"
+	.string	"V\300]\003_\302\217\332o\233\354\235R/"
+	.string	"2"
+	.string	"1"
+	.string	"\003\233\317\316A\233O\203\266\314C\221\345\214\274h\304fv\227\312\220\203\217\240\377\330=\254\326\352\221\203\260\273\216\254V\307-o\273\300\266\202\355Z\376\307\206y\266\005,\306\307FB\f\277\002\376\345\231=\273\0364\262\335\ry\324\371$\330\036\355\243<\005\274J\305\005v]0\262\3350\344\203\316\247\303\007\026\362\3023J\031\245=\361\305\263\034]Jh\031re\207\253(A\354o\273\273\226.\373\260_\376\365\307\t2\211Y`\331\345\250\251-m\266\220\330\001\337)\356q\022(n\004\340\222\310\344U\322\367\340u\016$UWS\037\007\221\362N&ZO\024u\342\"h\251\363\250\310\3005\325\320QU\255\035\375\204\373m\245\313\f'\264\016"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F\006\035QB\334@\fpE\232\232\002\356"
+	.ascii	"\362\242\235d"
+	.text
+	.section	.gnu.lto_strokeLineToPoint.39.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"}\t"
+	.string	"\326\221A;0\345(\035\340\341\005\003\263e\206\b\325#\327\1772\2176b\301\017`]\255Y\002\372\270\002\252j\bl\241\336\212\r\255A\345\002V\007S\334I`H\342A:\241\377o\262wJ\001."
+	.string	"1"
+	.string	"0"
+	.string	"\233\313\316?\233K\177v\315+\311rJd8`"
+	.string	"vw\306\221\177\207\237\177\330\003V,\325!Gaw\rW\254\217;\336\366\201m\006\333\263\222\305\304\366=\366\013d\001\326\253|w\331E\033X\215\220\216\330\356\202,\352\\\032h\207\366O\216\362=\345\342\004\273-\232\330n\0059\241s\351\372\202v\210\221a\304\fK\030#\214v\205\007\2772ly\221mD\225]U0\212\330\327vw\035[\366_\177\274\353\207\362\0033\323\260\262\353\021`\266\262\336-\336m\024\247M$`R\250\324\321\221\027\321q\020\243\024GQ\336&\201\352L\245IM\363d\332&&\211\353f\b\301\024\365\300\315\024\245\334\364\324\275\266\261\025\017"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F@\276\240\303\224\020\"\020\003\\\221"
+	.ascii	"\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_strokeTriangle.40.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\023\001\275\013"
+	.string	"6\025N@ O\225\016 4\250\220\0323\036\0374\252\350\332P\370\207\300\365\"A\032\200M\306\b}\303\241\241\340\307"
+	.string	"\252\305V6M\244G\340\324)"
+	.string	"\007\264\221\r\306.\023<,\336I\333\"B6\3312\2457"
+	.string	"C"
+	.string	"5"
+	.string	"\273#\305\001 \237\036\317\241}B>\321>-\332\260\217\246\335@\300,\230\200\261\273\234\374p\361*\372?\361\310\210$\272n\002v\327:\"i\270\345m{\330V`?C\032\231\270ha \266\213!\026c_\023E\b\333\227\330-\025\bX\253\003+\021\005T&\002\251\r\003t|\t\361(\247\3104\266B\207\013\256\335\2458\003\371\354\310\256\366G\234\204\370\223\204o\354\226X\270\002\t^\274&H\n\236\272IMN\231I)U\332\021B\375\310"
+	.string	"N+\226\203\024\331\243H\245\007\373\331\356\256e\311~\353\337\316\372\265\257\376y\325\237=\365\313\243\376\230P1!\275\204z\t\251%TKH\301\016\202\247\313dxS\341\200\236&l"
+	.string	"~\f4\240\317\373\204\235\203\017\330\341p^\207\363t\272\007\334\346\003\271\312\207\275\317\202\217\003y\336\307I\306}\266\262\344\033"
+	.ascii	"\3043\241\214iJj88[\004\327\210y3\006\230\003\231\201A\200<\340"
+	.ascii	"\030\300\004\310\003\216\001L\200<\340\030\300\004\310\003\216"
+	.ascii	"\005EQ\202\335\200\r\320D\232\302\002\256\345\2050\311"
+	.text
+	.section	.gnu.lto_fillTriangle.41.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\023\001\365\013"
+	.string	"\246\025PA\020Q\225\016?\034E\200\264\375j~\027\253uk8\034@\023}.\253bN\214\225\263\177\020\272\206\274>\n\020\013\333\177\202\360\006I\271$\001\201n\313\352l7\0010\216\3567l\333\b\331d\313\224\002:"
+	.string	"C"
+	.string	"7"
+	.string	".^\273#\305\004\"\237\036\017\242}F\376\241}Z\264c|$\261[\211\032\027T\314\330]N\216\270x\025\375\257\270\204T\032]\267\002\273k%\2256\334\362\266\003\330V`_C\034^hd\354f\270Acc\263\305\t\333\237\330.\026\tZ(\r\313\004\202\325\207\003*\303\262\216\265\020\002\203\001\035\237B|\3120KvA\330x\355.\305\231\310'\200\354j\377t\024\342Q\023\356\261k\n\035b\024d\005O\335\244&\247\314\244\224*m\t\241\236\344\0010N\353A\216\354q\244R\204\375lw\327\322d\337\365oo\375\332Y\377\374\352\317\256\372\345S\277JB\002\230P1\"\275\204z\021\251%T\213H\301.\302\247\313p\230S\351\200\336&t"
+	.string	"~\r6\241\317\003\205\335\003\020\350\351p\236\207\373x:\b\034\347\003\271\212"
+	.string	"{ \006\037\027\362\274\217\233\214\373l\245\311\013\002\032"
+	.ascii	"\3043\241\214iJj88[\004\327\210y3\006\230\003\231\201A\200<\340"
+	.ascii	"\030\300\004\310\003\216\001L\200<\340\030\300\004\220\027\024"
+	.ascii	"O\t\306\002\206A\023i\n\013\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_fillStrokeTriangle.42.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\023\001\325\013"
+	.string	"6\325NB O\225\016 \352\363\236`\026\224\003\r-\2736X\376\365\n\261\264\351\016\316\245\020J9\032\016\r\005?\006P-\266\262i<X!jjBfl\266\244\354\306.\023\301Gq\355\244m\021!\233l\231R8"
+	.string	"C"
+	.string	"5"
+	.string	"\273c\305#\222O\217\357\320>%\347\320>-\332->r\330\255C\211B\211\027\273\313\311\r\027\257\242\177\023\237\220L\243\353\006`w\255$\323\205[\3366\210m\003\366-\004:\361"
+	.string	"\241\002\201\213\335\n1`ll\236\370`\373\024\373\225\242\200\353E\240\225\032\300\362 `u\n\240\343I\210W\031E\246\261\0232\224`\273[\261F\362\371\221]\355\247.B\374\b\b\337\330E\261\200\005\007B\304\"H\t\236\272IMN\231I)U\332\017B=\311\"+N\213A\216\354q\244R\203\375lw\327\022e\377\365ow\375\332[\377<\353\317\276\372\345U\177\231P3\"\305\204\212\021\351%\324\213H\301\316\301\247\323d\230c\351\200\336&\\"
+	.string	"~\n6\241\317\003\205\035\003\020\350\351p\236\207\373x\272\006\034\347\0039K\210=P\202\217\013y\336\307Q\306}\266\022\345\033"
+	.ascii	"\3043\241\214iJj88[\004\327\210y3\006\230\003\231\201A\200<\340"
+	.ascii	"\030\300\004\310\003\216\001L\200<\340\030\300\004\310\003\216"
+	.ascii	"\005EQ\202\335\200\r\320D\232\302\002\256\345\2050\311"
+	.text
+	.section	.gnu.lto_strokeRect.43.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\225\n"
+	.string	"\306\023H=\020\005+\035\200A\240\200\222m_\352H\025wif\216"
+	.string	"\005\342\376'\236!;\221\306\365\243k\312\fB\001b\341g\037c\260\b\\\262t\002%\314R\333\t\340p\332q\374\266\311\336)\0053"
+	.string	"8"
+	.string	"3"
+	.string	"\237W\227/\350\274~N\320y5i\347\274DY\217\312\210+\006\300\356z\364\344\344'\351_\346\240\027\254\365\351Y\330]\317\027,\344\246\267\215`\033\302~C\270J\263b\373!\273\226\362@\023q\230\371\326\t\254G\311\007\303,\017C^\346\233A\273$9\333\356\212L\372\274\036t\237\366Y\336B\336e\343\003\2731\033\333n)\262B\035\256\263\322\216R:\251\315\032\347_\2365/8\027m\331ekR\023\373\335\356\256i\314~\355\257\247\375\335g?\275\354\237\036\003\333\215\004\316.H\200\334\006\025g}\274\306\305/#\365\221\002l\032\235D\2604Z\210!Ei\025\202\252\361\273P\211\250\223\007\242\274\024\352\303\360L\241\350\215\022\f\252&Bo\005\202\241\027*\367\335\322\230#fp\0344\024"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\344\005\305S\202\261\200a\320D\232\302\002\256\345"
+	.ascii	"\2050\311"
+	.text
+	.section	.gnu.lto_fillRect.44.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\245\n"
+	.string	"\306\223H>\020\005+\035"
+	.string	"\004\021("
+	.string	"\360\342\320\367j\025T\333\022G\200\202_\304-\016\200\245\033\337\347\243k\312\fB\001b\341g\037\243\225"
+	.string	"\371,t5\342dI\233M\3608\3559~\333d\357\224\0023"
+	.string	"9"
+	.string	"3"
+	.string	"\237W\2277\350\274~^\320y5i\347\274LY\317\212\212+\006\300\356z\024\345\344'\351_\346\240\027\254\365\351a\330]\317\027L\344\246\267\235`;\302\276C\271J\303b\373!\273F\002A\033y\230\371\326\r\354\207\tH\303,\017C^\346\233A\273%\001l\273+2\351\363\212\320}\332o\271\013\371\027\216\023\354\306fl\273\245\310\013\001\036\256\263\322\216R:\251\315\032\347_\236569\027m\331ek\322\023\373\335\356\256i\314~\355\257\247\375\335g?\275\354\237\236\203\033\234\t\334n\310"
+	.string	"\001\033\026g}\374\306\305O#\365\221\004l\032\235D\2604^\210aEi\025\202\252\361\303P\211\250\223\007\242\274\024\352\313\360L\241\350\215\024\f\252(Bo\005\202\241\027*\367\335\322\230%p\271\016\032\024"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\344\005\305S\202\261\200a\320D\232\302\002\256\345"
+	.ascii	"\2050\311"
+	.text
+	.section	.gnu.lto_fillStrokeRect.45.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\215\n"
+	.string	"VSG= \345*\0358\026\001\226\200#\357*\030\262\356\375?t\t\344`b\207B\210fg\336\025?\016e\255 \f\240Z\220\333&2\r\021\3218\005"
+	.string	"\215\347\2128X\327f;\350f7\331;\2453"
+	.string	"9"
+	.string	"3"
+	.string	"\247\036\217\3009\365\374\200sj\321\016\360\021e;),\254\030\001\273[\347\311\305K\321\277\314\007Z\257\325e\307aw-[\257\221{\336\366\202\355\t\373\020\001\353*p[\033\235Y\261\375\217MS\221\230\221D\310\\\017r<\214\370\230i\270\202\r)\021\251\355.\310\"\317\251\002wi\277\345.\342_<n\260\013\273\251\355\216 7x\002\004l\037\023\304T\322\311\3159\345\264U\241|\313\262f\200\2155W\366\270\222\323\304>\267\273\353\t\263O\373\351g?w\331?\037\373e'\341\006\240\302f\003\030W=|\307\301\216\343\324\211\bL\n\225@o\024f\200\337\305(\365y\250\260\323@\201\246R\365L\365d\3526*\351\003k\210\301\036\312\342\253)\317\373\352g\334s;a\246\b\025"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\362\200cAQ\224`7`\0034\221\246\260\200ky!L2"
+	.text
+	.section	.gnu.lto_strokeEllipseInRect.46.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\205\n"
+	.string	"V\023G> \005)\035 !\210%\tZ\035\270\371\363\327\247\005\324\200\234\250\312\215\346\367\304\246\3211\032\252$j6\fF,\312\205\226}\217"
+	.string	"\035F\n@\271\327Zx\003\017l\t\253\355o\262wJ\0012"
+	.string	"9"
+	.string	"2"
+	.string	"\247\036\177\3209\375\334\240sj\321\006\360qe=\261ZK&\300\356\326\251r\361R\364?s\001\327\213u\351i\330]K\327k\344\236\267\255`[\302\376C+2@\300\336h\r\213\355\203\354ZK\004-\0061;q\220\343c\304\313l\303\021,\bJ\210mwC\036}N\023\270K\373.\177\021\017\323\361\202]X\216mw\f\231\341\023&7\217\371a*\351\344\346\234r\332\253P\336eyCrkM\226=\262\344L\261\317\355\356z\302\354\327~z\332\317}\366\317\313~\351A(\301\241\240\331\027_=<\307\301n\003\325\215\006\\\022\231@\217\024b\200\237\005I\365y\251\260\313H\201'S\365N\025u\3524j\351\003\253h\301^\252\342\253*\317\373*h\334s;a\236\b\025"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\362\200cAQ\224`7`\0034\221\246\260\200ky!L2"
+	.text
+	.section	.gnu.lto_fillEllipseInRect.47.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\215\n"
+	.string	"VSG> \005)\035 !\210\005\b\310\003\f.\336\370\352o\b\003\214D!'#\220\322\002=\225\250\rU\0225\033\006#\026\345B\313&\b\270\261\256B \216;\b\325\302\206\253\264\372\3266\331;\2453"
+	.string	"9"
+	.string	"2"
+	.string	"\247\036\217\3209\375\374\240sj\321\026\3601e=+6\255\231\001\273['\312\305K\321\177\315\007\\/\326\245\307aw-]/\222{\336\366\202\355\t\373\020\001;R\200\300\336\350\r\213\355\203\354ZL\202\246\0221+y\220\343e\304\313\214\303\025l\210\211\210mwC\036}N\025\270K\373/\207\021\037\343q\203]X"
+	.string	"\333\356\030r\303'.\267\217\tb*\351\344\346\234r\332\253P\336e\231\323rkM\226=\262\344<\261\317\355\356z\302\354\327~z\332\317}\366\317\313~\351I\210\001\250\240\331\030_=|\307\301\216\003\325\215\b\\\022\231@\217\024f\200\337\005I\365y\251\260\323H\201'S\365N\025u\3526j\351\003\253\210\301^\312\342\253*\317\373*h\334s;a\246\b\025"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\362\200cAQ\224`7`\0034\221\246\260\200ky!L2"
+	.text
+	.section	.gnu.lto_fillStrokeEllipseInRect.48.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"u\n"
+	.string	"V\223F=0\305*\035\200\213\027\004U\240>\007^\276:\332Uc\321H\223\016\265$\033"
+	.string	"\243\277\253~t\302\242h\b@\225\312\271\bQ\f\211\312\341D\211\027\366_\317B\276@zr\3737\331;\2452"
+	.string	"8"
+	.string	"2"
+	.string	"\247\036\217p9\315\374\340rj\321\266}\\-\006E\300\211\205\300\356\326yr\361R\364\337\362\001T\312t\211q\330]KTj\344\236\267\275`{\302>D+r+\2605\n\200e\373\032;\326\222\200\261\"^\253\0079~E\274\3133\256`CJHd\273\273q's\252\300]\332O\271\212\370\226\307\rvU6\331\356\270qC&\264\332\307\0041\225trsN9\355R(\217\262\244\315j\247i\262G\223\234&\366\271\335]O\225\375\330O\017\373\271\277\376y\327/1\t\001\006T\3346\030/=|\307\301\216C\324u\b\374\341\200@\317\023f\200\337\205\207\364y\243\260\323\030\201!P\365BU\024\3526\352\347\003+\207\301\336\310\342\253$\317\373\252f\334s;U\246\b\025"
+	.ascii	"\3043\241\214i%j\2708\373\3205`\317\214\001\346@f`\020 \0178"
+	.ascii	"\0060\001\362\200cAQ\224`7`\0034\221\246\260\200ky!L2"
+	.text
+	.section	.gnu.lto_ctmReset.49.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\245\007"
+	.string	"\242\01667Po\322\001\240$|\211\032\021\234\t\320\335!4\357X[\031\232\026\007j\221 \306\207\263\367\243E\375\004j\251\276Q5\224\345r\253)]\363\220e\337\266\021\262wJ\001\264\242\020U\f\001\006yBT~\260\b:!>\243)/\254\222\270\250\025\212\322\212\"\253\232\210\240I\243\347\300\362z\230q$\345\214\235\272\237\026rnx\351. \311\323\263\261\212\367\315/\245\245#A\315\256\332\203\033\366\247\335]C\316\206\005.*\0160\273\03132\333Q( \035\333\177\366C.\222}\304\342\002\273\234\311\311nEp\002\347\224\353\t4\2478\037\320\234rf\263\274z\354\346c\005\243$fw#\354x\366\227\371'9\300V\322\3766\n\273\353\267\2254nx\333\006\266\027ls\004\t"
+	.string	"\3043\241\214i\3253\034\316:\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_ctmSet.50.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\031\001\365\013"
+	.string	"\246\225O@\020O5\035\200\214\200\254\200\274\001%\"X\fk\256-\343\t`A\033\203:\210\301\232|\336\303\324\376\256\020\005\024\"\316\305\0043\213\n\213\360\273\033 \022a\302\035T\300T\312\365\321z\023\271S\n:"
+	.string	"D"
+	.string	"6"
+	.string	"\253\326\356(q\202\307\247\307\017\300>\037\027\200}Z\264c|$mF\242#\303\212\031\273\253\351\210\213\227\242\377\325!\240\220\3472S\260\273\226\240\220\350\326\3336`\033\202\375\016\001\242\027\026\031\273\034jt,\307lQ\302\366#\266\n\306\203\024\013\007(\023\rN$\006&\263."
+	.string	"\253\341\263a\201\034\257B|\311,Cv]\320h\355\256\304\225\307g\201\353\322\376\211\243\020\237\342\302\003\354\216\002\03680\350\307Sf\212\351\324KU\245\332\026:\362 #\b\001b?\250\307\036=RE\330\277vw\255#\373\252?{\352\307\216\372\347O\377u\323\257/\375\022B \034\305\323\215\342)\307y\272q\236r\233\247\333\346i\330U\320t\225\r_&\230\360\263t&\204\240\004\013\007\3746\235\216\302&\314`\264/\243i2\235\247]\300P\233\034\360\267\211"
+	.string	"j\234\357\003\265\310\270\017\033"
+	.string	"\3043\241L\2130LD\330\253\256\360\202k\230\274\031\016\030\001\371\300\300\200\024\340\016`\fH\001\356"
+	.ascii	"\306\200\024\340\016`\fH\031\024E\tv\0036@\023i\n\013\270\226"
+	.ascii	"\027\302$\003"
+	.text
+	.section	.gnu.lto_ctmTranslate.51.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\225\t"
+	.string	"\366QB<0\345(\035\340\341\005\034\364\003{\321AZ\316\375\247\021\274\030\t\342\227B=\262O\340\243\206+\240V\004\201Ql\236\272e\227R\200\3017\312\203\265\005\205\022\026\r7\376\267M\266L)."
+	.string	"1"
+	.string	"0"
+	.string	"\231\313\315\0172\227\006\355\001\017MVs\222\362p\021\330\335\031K\016^A\377\256\017\240T\246\253\306aw\255(U\310\035o{\3016\204\355X\022\006\305\3669vK\344A\303\273\200g\371%+\330\324\351\343\265\273\035\1776\227\n\331\325\376\312Y\300\267l\334`w\005\340\265\033v\334\260\271tx\204\216P\201q\304\223\245\306\250\321\316\370\364(k\314\b\254#\232\354\320\244\221\304~\266\273\353\270\262\337\372\343Y\277\312\204\224"
+	.string	"\024\002vA\n\304\026\026\237\247\032\236v\032\006I\373\0208\344\021u\033\350\253\350\270\t\220\307m\245O\263(u#\321\334F\2234\322.f\210\353\246\207\301[I\202\233\336\266q\223\023\356\263\215\253\017"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F@\276\240\303\224\020\"\020\003\\\221"
+	.ascii	"\246\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_ctmScale.52.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\225\t"
+	.string	"f\322B:@\305(\035\320\351\316\370#\2733\034<\265\232H\247\265\200\363\310\313\257\304\022!\037\033\200\201\006mB\243bV\360\307\204p\251\334\324\352\361\n\\\034\377c\211U\317f7\331;\2450"
+	.string	"1"
+	.string	"2"
+	.string	"/\270|j'\270|\032\264[\036\212,f\344C\243\005`w\251\f9\370\b\372o=c:\221\0361\013\273\353h:y\334\362\266\021l7\330\216\005\266\257\261Yve\002\273Q\342`\210\341O\300\257\354rf7%\366\332\335\215;\332\347A\366h\277\344)\360\252\213\017\354\242\\\257\335pc\005\355\323a\016&0\fY\362\214RFiW|\361&G\225\024,C\222\354\220\024%\210\375lw\327\022e\237\365\313\257\3768\rT,\334\312nG\200\330\302&\nI_\215\0265\326\215\"\264u\002\374\341\200j\347\371\"\252\007\341\031y\235\350\333$D\225\003\321\216\243!n\233\240\037\257RN\202;\321\203GG]\347QM\270\317V\242\034\016"
+	.string	"\3043\241\214i"
+	.ascii	"j88\373\354\032%`\206\003F\006\035QB\334@\fpE\232\232\002\356"
+	.ascii	"\362\242\235d"
+	.text
+	.section	.gnu.lto_ctmRotate.53.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\325\b"
+	.string	"&\221>7@\345\2501\264\327q\365\227\214w\b\276M;\202m7y\322\034@\241\266\016F\216\314A\311\205\\\\U\202\265>\353\350\345\364\263 K2\254\204,\031\330f\345\2262\245,"
+	.string	","
+	.string	"/"
+	.string	"\033\017d,\353\265/\376<\256\001\371\3108\201\371?c\207=C\257\266\2119\252U\312P\243\360\277P\265\332p\243\333\036\264]h\373\n\255;m\341\347\022\317\255\242\224\363\303"
+	.string	"\270\376{\n\332X\032d\206\255E<\342\231\244\302\002?\013\346\372?O\0236\226\375L\220\261\feh\211Y\304\213J\bcK\201\202V\025\252\254\3040b\252\375R0r\264\316\376\277\221\325\272e\303\254\200\305\345\341\365k\004\210yL\246\2044\234;m\242\244\201\002*\372\214\272-\204\202\3508\207\320\211\333L(-\302\324\221Fs#\315\022I\223\230\"\256\233\037\204n\246\006n\236\266\215\233\235\357\316\036Y\001\013"
+	.ascii	"\3043\241\214\351\3553<\316\272\270F\031\303\274@`pE\232\232"
+	.ascii	"\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_contextPush.54.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\225\007"
+	.string	"\202\21657Po\322\001"
+	.string	"/\306\275\272\273U\240\204o\370\263\030\237Y\031\232\026\007j\221 \306\207\263\367\243\205\333\023\250\245\355\230I\251\344\002\243\nE\022\370\033\306\232%d\357\224\002\264\222\bU\f\001\366p>Tv0\020\235\017\035\321\224\027VA\\\324\372Di\305\220UED\317\244\221s`y9\314(\222r\306M\335C\316\r-]\005\034yz66\361\276\371\225V\272\021\324\354\252=\230a\177\332\3355\344lX\300\202\002*\331\275xq\331\216:\361\330\330\376\263\017\362\220\354\"\024\027\330\345J&\273\025\301\t\232S\256'\300\234\322|"
+	.string	"s\312\231\235\362\312\261\231\216\017\013\022\225\335\215p\343\331_\346\177\344"
+	.string	"\033I\373\313(\354\256\337F\302\270\341m\033\330^\260\255\021\t"
+	.string	"\3043\241L\213\261\232\021.8\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_contextPop.55.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\225\007"
+	.string	"\242\21656Po\322\001 [n\225:(Q\323o\206\300\241r-\024\343u^\263Z$\210\361\341\354\375hM\375\fntuU\rE\333o5\245\255\034\263\354\3336B\366N)\264\222\bU\f\001\366p>Tv0\b:\037:\242)/\254\002]\324\372Di\305\220UED\317\244\221s`y9\314(\222r\306M\335O\01397lt\025p\344\351\331\330\304\373\346\247\222\321\215\240fW\355A\016\373\323\356\256!g\303\002\215\025\220\311\356\305\213\313v\024J\310\306\366\237}\221\217d'\241\270\300.\227r\262[\021\234\2409\345z\002\314)\315\0070\247\234\331,\257\037\233\001)Y\224\264\354n\204\036\317\3762\377\245\003l$\355/\243\260\273~\033\t\343\206\267m`{\301vG\t"
+	.string	"\3043\241\214i\3253\034\316:\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_frskyOsdCanvasVTable.56.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\326\001u\017"
+	.string	"\364\032\226\002"
+	.string	""
+	.string	"4"
+	.string	"\005\001\212\001\202\200\200\374\342\303\316\267\005\177}\270\316\307\005\177{\315\247\005yw\370\314\227\005us\270\314\327\005uq\370\307\367\003om\270\307\227\005\177k\306\207\tig\370\305\247\007ie\270\305\307\007ic\370\304\367\005ia\270\304\227\005i_\370\377\266\005i]\270\377\266\007[Y\370\376\326\005[W\270\376\366\005[U\370\375\246\007SQ\270\375\306\005SO\370\374\366\005MK\270\374\266\005IG\370\367\246\007EC\270\367\346\005A\277\177\370\366\246\007\177\275\270\366\246\005i\273\370\365\266\005i\271\364\306\007\267\177\265\364\266\007\263\177\261\370\357\366\005\257\177\255\270\357\306\007S\253\356\346\007S\251\270\356\226\005\247\177\245\370\355\246\007\243\177\241\270\355\346\007\267\177\237\370\354\326\005\267\177\235\270\354\366\005\267\177\233\177"
+	.string	"?\202\210\200\330\004\231\177\227\177\335\001\225\177\334\001\223\177\333\001\221\177\332\001\217\177\331\001\215\177\330\001\213\177\327\001\211\177\326\001\207\177\325\001\205\177\324\001\203\177\323\001\201\177\322\001\377~\321\001\375~\320\001\373~\317\001\371~\316\001\367~\315\001\365~\314\001\363~\313\001\361~\312\001\357~\311\001\355~\310\001\353~\307\001\351~\306\001\347~\305\001\345~\304\001\343~\303\001\341~\302\001\337~\301\001\335~\300\001\333~\277\001\331~\276\001\327~\275\001\325~\274\001\323~\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/io/displayport_frsky_osd.c"
+	.ascii	"# \220\243\255\006\305\024\223b\246\305\b\025-\354R1c\245\304"
+	.ascii	"\273\354\262R\004\225\302ALRH!\005)\244 \205\224\244\220BJRH"
+	.ascii	"I\n\321\245$\205\224\244@t\270\024C\352P\341"
+	.text
+	.section	.gnu.lto_getCanvas.57.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\023\001\325\f"
+	.string	"\246\030YC"
+	.string	"s\233\016[\262hQ\022 !\371cE\330\362\210\321Z\210\323\036\343C\200DR\"\032@\3263\364\336\037\207\307\323g4\211\350\3064\352Z\377\377\327\376\t\342\002\322\323\252\r\022\272\321\335\237\354-eJ\001E"
+	.string	"C"
+	.string	"H"
+	.string	"\005vK-0v\277\006\026\251\036\375\375"
+	.string	"\365X\335"
+	.string	"\365h\333\016D@\016\3753\2212$\323\311\212\323\356g\351\210\207\236!\377)\256\300\304\f\0330,(\242g&\302\356:=\024\017\267\3366\003\333\022\354\203\b#\030\226\017&\031c\177\242T\021\366\341\356\256\265d?\345\247b\032\302\264\306t\302\364\003\274\307\236thh\331%\305\370\330\227\030\243\204m\220\r\300\266~\237\004\004v\203J\007\b\231\366O\034\005\350)%\017\2327(\250\202\204pI\2655wq\335\333qMM\227\223\037\003\322\336X\310{W\0045h\274\214Td\277\205\006b\332\345p\317g\361\225\f\222h\324=m\273\n\f\325\356>\360U\270N"
+	.string	"\016\022\217~\t\365\030Wd\004\033\214sy:NVuW\006\316\205Q\306BF\272M\363!\351\270\n\032\017\267u>\327\205N\227\215X[fq\262K\2630\256\263B\026x\353l8\313\263m\234\345o\017WK~\210:\217\323)\207\211\216\f\325\236\360\027\2520\024"
+	.string	">\033Ej1\216\254 \200"
+	.ascii	"\001\b`\232\b\201\233!\307+x\311\020O\251S\241\306\004\255\301"
+	.ascii	"\250YB]\270'\306FP\"\030I\200\n\363\272&\031"
+	.text
+	.section	.gnu.lto_frskyOsdVTable.58.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"]\b"
+	.string	"d\016$\001"
+	.string	""
+	.string	"4"
+	.string	"\005\001\212\001\202\200\200\374\342\203\355\247\005\177}\370\354\247\007{y\270\354\227\007wu\370\347\207\005sq\270\347\267\007om\370\346\307\005ki\270\346\367\003{g\370\345\247\005ec\270\345\327\007a_\370\344\247\005][\270\344\307\005YW\370\337\267\005US\230\337\007eQ\370\336\307\005eO\270\336\207\005eM\370\335\327\003eK"
+	.string	"?\202\210\200\300\002IG\312\001E\311\001C\310\001A\307\001\277\177\306\001\275\177\305\001\273\177\304\001\271\177\303\001\267\177\302\001\265\177\301\001\263\177\300\001\261\177\277\001\257\177\276\001\255\177\275\001\253\177\274\001\251\177\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/io/displayport_frsky_osd.c"
+	.string	"\020"
+	.string	"\200\024 \205c\210\006\244"
+	.string	"R"
+	.string	")\200\024@\n \005\220\002H\001\244"
+	.ascii	"Rb\222b&\251\003\200\003"
+	.text
+	.section	.gnu.lto_frskyOsdDisplayPortInit.59.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"]\013"
+	.string	"\206UO@ Q\224\016`\216\230=\n\211\005\302`\300\212\203\263\022I\253\013\025\311\007\013\235\301\316vr_[\222,\023\265A\346\272\0253\263~ \n\240i\005\034\016\250\213E#$D\325\236\214M\266\224)\005;"
+	.string	">"
+	.string	":"
+	.string	" s~\227\277\017\210\257\254\013\210\257\326\303\273\303\325\316\227x\237C+\303\027\0368\275X\021\300\013AJJ\003\210\243\256#\017\244\n\3002\347\264\212\274\322]\335\266\002\333\026\373\004\002V\353\252\0379\016\017\220\031\034\2159I9Bf\213JE\b\333\234=\261\255j\237\304Kp\377,82'\207\020\2179;\0208\201\365\252"
+	.string	"\264\355\217\370\211sG\371>\224$$\026\030L\004\272\243\265\345\302\202`Dm)A/\212\273\357\330 \002\305z\213\337\006)\030!\265\341\250p\355\t\025\364\242\357Q\267\\\334\370\250\361\021\332\217\375}t;\330\207sM\216\377~\030\234\215G\333\030\310\215\006\2430q\246\242\321\344e{\240e\016.\236Lv6\f\204\216\206i.\211]\0210\f\347\312d\332U1`\331\331d\227G\312\354\232|\363k\362Q_ #\306\211\024\352w\321\0337\020"
+	.ascii	"\\\b\230\2473\366\b0\013+\202j\txm\335\0134\254\342\302\0302"
+	.ascii	"\3268\325\b=\306\bh\"\222\022\330\324\3254\006\005\005"
+	.text
+	.section	.gnu.lto_isReady.part.0.115.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`>\001\275\r"
+	.string	"vZ\\C\020\221\223\016_\237_\001Y\t@ \354 \037\224\035\3673\020G*#uE\332\177\004?:\341\200\236\265v\232\317B\254\211?`o\255\033"
+	.string	""
+	.string	""
+	.string	"\344U\231R\246\321 \240\242\1776\265\206\375{o)S\nH"
+	.string	"G"
+	.string	"H"
+	.string	"\207\346N \036n. \036\332\037a\220\016)e\333 \235\222M\347\\P\033\024N)\035\315.g\035\252\207\233\256\371L~\236TL\256_\375\300\fL\007\0302*\026\236\036\177\033!\273\353\315\205\033\3366\003\333\r\354\213\b\347~\215\351\204\351w \310"
+	.string	"\200e\027U3c7\300\026 l\337?\361\256\344&\254+(hv\267\344\376\212ds\354\222\315\261\3469\322_\266\002\334\256\244\254i\237\304K\224\376\262=\300\256J\005\213]N\301\241;\233+\236B\320S\0030\030\\\244\276\363\203\247\270\006\270\354\356\002?f\002\211\377\341\320\337\342\341O3\327\324\244\221R\343$k\314\221~\207I\310\237\256\357\316\361\"DJF\f\0245Im\261\276\277U\225\355t\214i\b\323/\240O\3103\322B\327\306\237\217\021\r\023\331H\264\314\201\310(\303D\233\007\202H\273F,\354\262B\227'\202\365\3114\353#\2011\021(\263F\030\226Y\234\277U\225G\376\246\030\265\202\355\250\0169Q\024\253j\313\352G\311h@\261\304\254r0\374<\033"
+	.string	"n\213\341\274\002?\032\330\317fH\233P\020\314\020:"
+	.ascii	"\305\200\334$\270\310\t\373\370\262\036x\n\220\271\314\025\331"
+	.ascii	"\330\026\312\346\316&\314\210Bp\350\234wh\247\205\232\303\250"
+	.ascii	"3\220\244\006\256y\377\265e\f"
+	.text
+	.section	.gnu.lto_frskyOsdDisplayPortInit.part.0.116.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`(\001-\r"
+	.string	"v\327UC\020q\233\016"
+	.string	"\300\"\245\202}\003\244\241S\356\363F\307-G"
+	.string	"V4\006\005\t\340p\3700\265\365\002\275n\177\247\376uu\375c\3245l_\345WU\247(\225\340}\351\203\336q\366\372qL\2106\221;\245B"
+	.string	"@"
+	.string	"E"
+	.string	"\276\211\237\030\2713\340\241t\b0\"C\344tc\327\223\217\366^\240z\264N\240z\324\021\357\256\220\352|X\"!]\377\035\201\210\215\020\032-H<\034bNulv\327\326\207;\336v\003\333\033\373\"\002\253&\266\241\037e\215\001 vGr\274l\210\330R\342\246\333O!\362?_&\321S\270\f\212\202G+\264\357]\305\350)\234\001\354\226\274\254\354~\013\036\315\300z\314P\366\310\276\036Q\2108\330\016*\253%\026\300\262\202A8\320\342rAI\276\340O\2071\255\335\f.\376\342\203\372\314jV\217?\235Eg\355\202\254\270\312\004\237\304\243\267\016\276\364\350w\024,\300\227\374\357\3370\203\305\005\203\222\240\236X\251S\001\037,\264q\016&\346\311*\\\366\320x\266\311\341>6\355\001'\244M\020\327\211"
+	.ascii	"\3322\217\234\231\224\220u>\322C\333\244&\201'\b\323dhNM^\247"
+	.ascii	"VM\374\357\030\350\355\252A\275\001\321\020\253\352\211\tG\214"
+	.ascii	"\" \260\002\031\253\362w\304\250M@\007r\334\267\3343x\214\223"
+	.ascii	"\303\335`K\2666\214\313B{h\3561~\303\306\216l\353SD\346\2323"
+	.ascii	")\rkk\tc\372m\305\372z\312U~\2547\206\220\303\334\341\007\230"
+	.ascii	"\236\242\340\376k\373\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375`j\f]\027"
+	.string	"\266\245\212G\220\324\316p"
+	.string	""
+	.string	"\324\277>_\305\265\005\177\301_\360_\374`\364\236J\004"
+	.string	"\220\031I1#\353F\244 \b8\304\215\240\031q\023\351_)"
+	.string	"\370W\n$^/\3049Em\025\177m\342\322\013\276\244\254\251\323>Iv\ns"
+	.string	"s"
+	.string	"s"
+	.ascii	"4R\257\211\272\r\324o\236\216\343\364\234\246\353$\277\303t\341"
+	.ascii	"\322\207\310\363\034\337c\274\217\322\325\342\177\222\016\204"
+	.ascii	"\364\240\243\013\031}\210x\242\242\027\021\2358t#\241\037\005"
+	.ascii	"\035\t\350I?/\002\325+\371\334\330\363#\317\221\303/\t\317\004"
+	.ascii	"\\\033e\256;\311T\347M9o\3019\313\315Ul\236\006\327\3452\013"
+	.ascii	"\210}\333\214\007Z\262\256\353Z\363\022\240\355\225\2537\032"
+	.ascii	"\210\373\354\303m\346\341.\353p\223q\270\3076\334b\032\356\260"
+	.ascii	"\f7\030\206\373\353\302\355e\341\356\252p7)\334\\\023\356-\t"
+	.ascii	"\267V\204;\013\302\245\326u\265\205\177\017>\205\332\006.W!\016"
+	.ascii	"\376\004\214qJa6e6\270\2230\370\313p].\327 \013n$\n\036L\360"
+	.ascii	"\025\00479p\024\003O)p\027\345O\b\034\206\3521\003.#\3403S\017"
+	.ascii	"M\027\256\226-\026\255\025g\001\230R\221J\211B\201:Y\325dQ\254"
+	.ascii	"t\225\351\376\375P\177;\036\245\343\336\313q\037\301q\033\271"
+	.ascii	"q\027\261q\023\251q\373\321\270\371f\334}2\356g\214[\017\306"
+	.ascii	"\235\367\342\306sq;[\334w,n\273\025w\235\212\233.\305=\207\342"
+	.ascii	"\226;q\307\231\270\341J\334o$n\267\253\273m\304\315fu\257\211"
+	.ascii	"\270\325\252\356\264\020\001\256B\321f\217\037`\310$\221\244"
+	.ascii	"\037r\251\212\310\255B\335\2076\304\207\361"
+	.string	"\270j\337qU\343\242L\247\221OiQ,gq\225x\305U\367\222\236H\2132\365\216V\231g\264J'\021\217\270\301\273\242U\355\210\352\206\026}\322\t\315\005Y\016h\321g\334\017\234\372\346\343\326\323\306\3036\\\023\252\355\254\232\246\263(\023-g\203\3153\234\2652\273\331 V\231\rY\315\030\215\330L\230\fX\200\257\030/\230\256\227\200\250\2501\bLu\251N\332\016\220\203$\205t\021 \b\202B\222\020\001!\204\020a\204\374\240[+\310c\207\210\022\337\225\344\361`:T\311~\362p\345\332\222\340p\253\036\303j\373m\373\340\303\032\254anp\004>\377\325\037\343\277\206\203)H\2034HAN\376\021F\323\274(\321/\211\247\221=\265\216',\270\b\b\027\225j\252\246eZVeUM\325\264L\313\252\254\252\251\232\226i\0255\277?\006\250\317\034H\335\256\250gi\026\b\363\332\f\277%5F\256"
+	.ascii	"\233\320;@\340M\205\273\271\231\2679[\267q77\3636g\3536\356\346"
+	.ascii	"\314\037{\342\336R\214j\246\310]\232\203\006l\025"
+	.text
+	.section	.gnu.lto_.refs.3ea8fa33787d5f26,"e",@progbits
+	.string	"(\265/\375 \207m\003"
+	.string	"rH\032\"\020K\2475"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\357\377\377\377\377g\220\3739\324\342\240\324\037\f\212\330\264eG%X\260\341\301\351B\304\021&4\250\220a{3\353&\354\305^\313^\303:L\211\212\213\214\215\216\217\220\221V\311I\312J\313K\314L\315M\316N\317O\320P\321\321+i)\300\200\002\007V\327\265*\325\356\356!"
+	.text
+	.section	.gnu.lto_.decls.3ea8fa33787d5f26,"e",@progbits
+	.ascii	"(\265/\375`NR\275,\001z\347\021jV N9\235t\347,S1\322\re\272\271"
+	.ascii	"\217\336t\331\362\252\233\275\026!\205i\023\336\235\336k8u\342"
+	.ascii	"w\227\267\267_{\271w\372\350vEw \206\034\360\261\266\332\212"
+	.ascii	"|\235\3224\202(\244d\306\241H\272A\372\226\345X$\345\320\273"
+	.ascii	"\337\271\214$\225\220\275\345N\001\231\005z\006\306\006\215;"
+	.ascii	"F#\241\341x[C\352\243\256\242'\252\247W\316\031F\305-\232\025"
+	.ascii	"\243q\317h\2437\215\226q\227=\232F\004\2309\3434\r\030\303\234"
+	.ascii	"q`\254\355\300\332\0160WS\2164\025\277\243k\023u\321Y\017\215"
+	.ascii	"%/\032\206:\306D\273\272{\361@\025\007\330\270\223j\334B)Cx\236"
+	.ascii	"s\215\337ik\267h\027V\354\247\201\216{03Y\316O\227\213##\t[c"
+	.ascii	"\016\354\007\025\207Pa\022\023\023\023m\b\365\335\265\276s\254"
+	.ascii	"6\367N\263pa3*R\326:o\026g`_@\032w\2165\263u\316\270'\215\033"
+	.ascii	"\247\223\326w\320j{yh\3702\267\245\025\324\330\032\272\024\336"
+	.ascii	"y=\033\333Bk\266\202\203\f\b\261\261\215\342\222Tvc\254\261%"
+	.ascii	"<\3642\315\330h4\266\203\202\201}\253e*Yo\217\254\266\251\266"
+	.ascii	"\336\362X\355\323I/O\375\322\303\311\302\273\315{\031bu\227\325"
+	.ascii	"\3306y*\2642ll\231\034\312r\204\003\206Zc{wh\024-\314\256"
+	.string	"\261]rh\n\\\\\223\rh\f\267\256$\215o\201V\333fc\324[\035\272\271\226>\272\250&\271\3339\225(\240\024\216\3066\316\232\301\344\340{\343jl\223\250AiV\205\215-\222\263\255L\316\216\020\033[\270\325\211\307t\330\330\0369[*\346\344V\327\330\276\265`\265s6F\375\315\372[\350\020\230B0\255\031Bn\207\254\2149\221[6\266A~\230\002\2354\266ng\203\001\"\326d\352\304j\377\200\374X\241\362\342\nZ\273\375\241\"I\r&6\266j\230\007\216NI\343\007\236\355\277\212\315\002\262\225\326\370'X\177\213v\206\205\360\265E\371\270=\373G \341}-9{\345\234\t\220\036.\3758l\374@k\366_\245\002LVk\215\177k\366\333.\353e\313n\317\0173\237\345\374\364\240\002\326\003\210\2541\231US\332Bj|\027\326\377V\314\216\331\036\031\004L\017\221@\235\306\277\300z\373\374"
+	.ascii	"p2\t\177Y\337kg\033\243\366\220\215Q\377\264\037\324\325\306"
+	.ascii	"\250\277\r\374\233\351\242\370\033\005w\210O\310\352\004O0\177"
+	.ascii	"\352\302\337U7\350\2775@=\203\205\033\301\337/\374]\202\277c"
+	.ascii	"\370\273\304\337&\370\373\003\177\223\340o\021\374\335\302\337"
+	.ascii	"0\374\275\201\277C\360\267\013\177w\340o\016\374-\303\337(h\032"
+	.ascii	"\226.0\001\021\b\b\3617\223\001\356O\242\215Z\301\353\342\277"
+	.string	"\003~\034\366\333+\333\374\355\b\215\3257\267\305o\253\276\200\0241?\206\373\255\214\337\266\340\267C\277\305\341\267/~\013\343\267\371\2677\374\326\347\267,~k\364[\027\277\325\371\355\362\267<\277]\361\333\027\3746\347\267+\370\355\214\337\272\340\2676\3746\207\337\006\375\026\350\267;\277\025\372-\316o\211~\373\363\333\026\277e\301oc\374V\305o{\376\276\261)\354\214\035\201%a9`3`M\260\f\260\034\330\364\206\317\373\334\207\374\307\317\376\207\340\307J\264\220K\234I&\177w]\037%\236\230\n\275\277\237\267\307\006\276\277\325.\317\377\027n\360k 8`@\350\212'Er\b|[\301 \034\013\242$iA\364\357!w\351\002|\330\344\0058\361o&w'\333\277\231\334\235\345\005\304\371\273.\310I\351\303\313B\003\035\225\377\342\253\243\001\013\226\226\034\353\0023\302_\376\324\345\27718\277u\261#\360\300"
+	.string	"\240\307\003\b\237\230\277\207,\377\227h\361\241"
+	.string	"6\306E"
+	.string	"\376\233\200\374[\030~\004\360\337\020/\370\357\001\320"
+	.string	"\032\020\264\301\337\177.\370_\342\352\237\032`\204\026\3548\313\237v\360\337\022X\200\342)\177\212\200\t\274P@\005`x\3607\341\1777X\301\177s\370[\260\213\030pB\214\006\374W\0036\334\021\277\215\223\361\200\337\"\332\304\377\312\250\370-\234E\301\201\377\276\240\324\263#(\255\374\351\0056\020\202\302\355\267F,\220#'\300M\376\026\356\035\376T\003'~\177\314\366\337\022*\370\357\201\215\023\376K\202\233\377\036\300]\345O3\320\315\343\377\022s_\3774\204\023,\215\370;\313\346\351\237\256@\303\217\337\302\275\177\254\366\337\024\3775\376w\206\377\232\370\357\t\376[\202\377~\340\2770\374w\003\377e\341\277*\374\367\204\377^\340\277\025\370\357\004\376+\201\377B\340\277\017\370o\003\376\313\200\377*\340\277\005\370\257\006\377\005\361_"
+	.ascii	"\3747\203\377\272\3747\375\033\361\357'\177\003\376\275\367w"
+	.ascii	"\336\337M\376\226\373;\311\337p\177\277\375]\344o\350\337@\376"
+	.ascii	"^\373{\354o\261\277\275\376v\376\255\3657\326\337W\177S\375m"
+	.ascii	"\365\267\323\337O\1777\375\315\364\367\322\337\314\277m\374\255"
+	.ascii	"\364\367\214\277e\374\035\343\357\242\277a\374\375\342o\242\277"
+	.ascii	"\207\376\026\372;\350o\240\277\177\376v\361w\213\277}\376\356"
+	.ascii	"\371\233\347\357\235\277Y\374\255\363w\316\3378\177/\377\316"
+	.ascii	"\177\277\340o\027\374\335\202\277Y\360\367\n\376\316\341\357"
+	.ascii	"\025\177\343\360\367\r\177\333\360\267\212\277\225\177'\377F"
+	.ascii	"\376\255\202\277S\374m\374\033\305\337'\376\246\341\357\342o"
+	.ascii	"\217\374\366\350\267X\177\317\360\267\211\337\362\375V\357\267"
+	.ascii	"0\374V\203\377%\376\277\360\333\271\337.\3756\356\267(~;\302"
+	.ascii	"oa\376{\360\333\230\337\302\375V\353\267Y\277\335\361[\244\377"
+	.ascii	"\371?\334\377\t$&&&\376- ~\026\373[@\001\001\215q\321\205\002"
+	.ascii	"\363\342\213H\331\334\013\242\324N\tN\224\241c\"(C\372\356\032"
+	.ascii	"c\241\365\251G\222\276\3068\b\003\271\030\321\243b\001\264\344"
+	.ascii	"\306VZc\374\003\003xt\347\326\370*?\260\2131\037\334\243be\226"
+	.ascii	"\366\004\363\034\367\300\304P[.i\214w.\024\233g7\343\2521f\321"
+	.ascii	"XoI\200R\215\037\210u\344r\230\2455\376\261\016\316\201\016)"
+	.ascii	"s\342\366\223\266\003\343\\%\352\f3\265\235\346\372\343\234\330"
+	.ascii	"b\344mH\017\3617\261\361\354\224\231\240\016\025\250\365\277"
+	.ascii	"\2067\n\263\004z\230u\013\177\243\206l8S\215o\224\013E(\fpJ\256"
+	.ascii	"H\227\023\\\343\253\314X\377;x\005W\244\002\241\016o\340\257"
+	.ascii	"`\007Q\362\345\325\370\201\027\n\r3\033PP\236<\341\250\233q$"
+	.ascii	"\013\271kQ\344\344\252\245\360\024\361a5\276\n\213ue\025\\\377"
+	.ascii	"\313w+v\371.\034\013\317\274dA\023{\002#\314CC\r\370\332\265"
+	.ascii	"\376wO\257\223t\222b4\316\223\241Gf\327\370+\325\372\3776\261"
+	.ascii	"b\027\357*\271}\342]\273\313\304\316\031\345\020\256\230\206"
+	.ascii	"8s\316 >H\331\342\232\013\302\370\277w\277L\376\366q\353.S\n"
+	.ascii	"\002\240\0028\324v\325\370.\021\361{\027\243\016\031=\363\231"
+	.ascii	"\217\"#\272\306'\330\030\365+\320\372\024\304\025g\2729\230,"
+	.ascii	"$c7R!f\206=\032\3378\006\200\221\305h\374\024%7\t\222\013\207"
+	.ascii	"4xD\252\361\021\226 EuV\215\237\002]OB\031\337_\316O\250^\217"
+	.ascii	"\261\313\344\327$\233\213\306\001\271A\256\220;\344\266\335\""
+	.ascii	"\227\310}\273l\327\310u\263b\027z\325\336H\356Z\322\323\002:"
+	.ascii	"\242`a\367\313\260\231s\376u"
+	.ascii	"n\335/\241\266h\034a\316\031z\237nZ\f\0373\032G(\326xj\016f4"
+	.ascii	"\216\320\3542\275,\237Y(\245\352\031\215#\204\336\037\215g\347"
+	.ascii	"\214\362\0220\001W9\032\267V\3318\002\007\002?\005j\355l?\250"
+	.ascii	"O9Z\377\233v\321vn0\341\274\260\005\351\024\236]\037.\210;\352"
+	.ascii	"j4~\312\316\372\224\345z\325"
+	.string	"p\275:\270^u\262\202\260\037\324\253v\353U$\353\325 \253\b\366\203z\271n\227\025\003q\275`l]NP\215\306W\325\326\027d\013B}\242\005\241^\025[M\340\261\001\314S\006\320\r-\017t\204\250ye\355\260L\262\264\035\215\311\262\027\224\016\251\361\255\227\323\371\b\220\323\303\202V\224?\035M\215\365\222\346\314\2146o\325\275\321Xv\016\n\003^\205\1777\211\3522\275\334\234\225\016\033h\004\022n\325U\272Lv\316\310\002\\\206\177U\367\351F\001 G\356CB\330\2749\256\216{u\261\256\225\025\273U\266\307\257\324\235\372\340\003\025\030a\316\273\027|5\307j\237\366\203\n\342FA\265\231Q\301x\246\354\360\350\"\2728\332\311K\224(\035s\215\257B\255W\227\326\253H\353\325\242\365\332\270L+\266\301]z\302\270 n!F\033_\375Yo7Pm\242\335@}\032]C\330\017\352\177k \305"
+	.string	"1\303\273\367\005\237\f\035\215\237:9g\020.;C\212\350\032\363Y?\253\307\325L\335\324RQ_\0358\327\207\304\271\304\257\327D4\377;\243\021/QG\2710n\321]6\341mqw.\215\373sY\\\234\333\323\2057_\2356\274F\235\330\203\035\275B7\350\362\334\241\233s_\\\240\353\242\017\257\214\026\274>V\354\306h'\357'\r\345 \2369\353\344\234\213X#\226\356\214\215\210\205\242A\341zG\b\314\246Y j>\372G\017\241\321d]\226\324l\2626\263z5\220$\351\235\240?@\253\267\325H\342\332\016\250\251\304\356Y=\t<E"
+	.string	"\366\332P\037\022\347\023\213h\017\255|\234\365\332\021_\237\325\353\372sb\365\234\315\323=\2753\005%\322G\214\236@\261\2079\212\330:\213\026f\023\227\275C\325d\232\352-\250\246\005\263a\026m\002m}H\234K\356\272O\304\263\017\211\223\247}zI\252\231\363\363\020\370\233k\314\242)%v\266\207Ulm\026\232f\225X;\253g\347\214:d\235\261\257fsuu\017;g\364\314/ \360\327\207\304\231\363\363\326\353\027qc\364_\257\335\3740\263\017ON\213\313\365\327\227E\230\363\363\203\017>\370"
+	.ascii	"\304\007)v`FS,\340\247a\253\207\247\375\240\266\221\215Q\237"
+	.ascii	"F\255O\217\326\247@\353\361\340\372w\037\337\312\204\b\021\274"
+	.ascii	"\306\315\247\376-\t=\033\267\336\020\215\034\037\274\026/\204"
+	.ascii	"(5n\274\356&\235\367\306k&\037\201\204\267\350d\257\234\237\215"
+	.ascii	"\207s\306\261\266\203\027k;H\241U8c*>\006\\\217\345\326\016v"
+	.ascii	"\255$\305\255\206\020\032]\367Vb\371\212\004R5n:\214cH\243\253"
+	.ascii	"q\317\035\252\003\b_T\343\226;\324\205\350\307g\013\023Y\217"
+	.ascii	"\237+\0076F=\246Z\377>\362\246R\203\311\351\302\310\373m\007"
+	.ascii	"\006\321^\343.b\315\226B\202T\215\037\030\002\246\205\231`N\343"
+	.ascii	"\343\244U\204!Bf\310\265\021\006y\013QY\232r\362\325\270\335"
+	.ascii	"Z\254t\274\030lcyax\310\007\244\331\230?g\314\306\3078@\256\337"
+	.ascii	"\232\332\212`\233\023^\332[\355\n\n\326\345h\334h\326\254NJ\n"
+	.ascii	"\260\361\003[\212\020\177\004i\374\013\267\376\331\266\376\232"
+	.ascii	"\255o\333\261\376\335C\354Z\3215qj\334bRx1r4\3560\225\026<jt"
+	.ascii	"\215\033l-\332\303\301\242q\177Y\273\034K\035\215\333\253\261"
+	.ascii	"V\236\2428\324\236\326\317m\265\223\205\271\004p\250y\274\235"
+	.ascii	"\270\360\251\347\253qk\361\020\231\363j\334Y,"
+	.string	"\\,\007\033\367\216C\327\030jry\215\273\252\261\226p]:\032\267U\347\260b\036t\363}\325:\236\342<\3633\347'LO\035\242\2155\356`?\250mc\324\337\244\365\326\003\365&&Z\017\324\246r\261\376-\025\265\002\3052\023\204zG\261\220%D\252q\343\260f/|K\234\033\215\373\311\356Q)\3615n\247\336\341\004lj\3347\032\t,\207\340o^\377\267\304L9k\2022\325\270\231\352\216\037\037\177\215[I\205-\211\021X\343N\272\203Z>D\032w\r/8\033E\001-z\254\252\226\322\303\247\210k\235\f7\302\306\251\341\241.^P\234v4N\243\035\200\301\226\3238-l$\230\251\267\035\251\306\251`\032\245\305\226\222Z\343\224\220\245\250*\261\254\361;H\245\203\035`<y\222\002\272\300O\270\212\300h|\230\304\276\276\024\360\007\343\345\374\300\372{\n\230\026\365\026m\234\372-\331\333K\233"
+	.ascii	"!\3400\350\252\361a\200\344\345\245M\202\\\242@ir\215\017\263"
+	.ascii	"EG\2276\021ZAR\0324c\362\264\311\225\021\244\027\215\323\273"
+	.ascii	"tIj\227*I\353\224\344\344\214^\206\270\230\226\215\017\343\""
+	.ascii	"I\022\032\252\220\237#k\205ppG-j\202v]J\336\336\220R\326\356"
+	.ascii	"\204f\370(R\244\006\313\221X\026`\343\277T\265\265\245\320$\333"
+	.ascii	"\007\365\023M\207<\205F\177p\330h\234\nI\203\244n/@@\200\244"
+	.ascii	"Z6T.\035QC\303\262\262t\r\252\211\277\364\222\340R\265\247kI"
+	.ascii	"{T;\215\323\264\024-=K}\244f|ccQ)BEY<\214\200\201\245bRM .\210"
+	.ascii	"\350H\237O\305\022\313\322\246\032\247a>\270\270R\257\251\224"
+	.ascii	"\351\225\327$\355z\352\345Ef\007\224\345t\246Z\266\3033GI\225"
+	.ascii	"\032\344\311\027\224\306wY\312\312J\265@d\3215e\364Ai\365\325"
+	.ascii	"\355\260Jk|\227 ,\254\364\352W'+\2755s6\n\241\222d\245\245\327"
+	.ascii	"\370-\204k\263\231^\331\036YHU[\272+$\314\331(\304\212Q\021\250"
+	.ascii	"\250\306!\276v<\351k\374\0263\250\264\n*\265z\340S+\226\275$"
+	.ascii	"\255\262\306iT\032\225R\331<\344\244\203\250\233Q\b\0248\363"
+	.ascii	"v\246\236R]()I\204l>\251\024\2164\226\245N\237\223\306o\261Z"
+	.ascii	"\337\"\224:\245O\251\323MTs\266O\246\320\320=\274\2077q]z`\251"
+	.ascii	"%\257\317'\320\222\223\323\025\214\300\226[XX\224&\306\302Xx"
+	.ascii	"K\211Psj\n_\221\260|\002s\342%^\246J'\\=\2019\323\244\247J-g"
+	.ascii	"MAx4Nk\\(M;\224\032\247H/7\204\270\n\323#\226A\347\316\216\364"
+	.ascii	"(\245\301\302\004\n[Y\236K\214\256(\031\215\273\272\360\227\b"
+	.ascii	"WDO`\204\204\2047\212t/\340\025\344\002\004\304\373\373#l\372"
+	.ascii	"\371\265\332\222\304f6\032\352\273\276k>\025\320=\2019\343\342"
+	.ascii	"ZIR\222$Tpp\315\242\213\b\221~K\373\361\243\205\274\235\235\265"
+	.ascii	"Z\02333\277\2622\233\307\004ql\314\236\001uu\265X\215\251\251"
+	.ascii	"vN55u\024\227\217O3\321zz\214,\227\315B\256s\347>DD\274C(P\254"
+	.ascii	"\341\217\023'H\200\200R~~[}}g{{lvv6/\256\256\316\236\361\031"
+	.ascii	"1b\347\364\f\211\020q\321\326f\207\034\245\245\331\037Q\315l"
+	.ascii	"4d\303l\230=\353\220s\370\234\315l4\024\242\003;\320\236\371"
+	.ascii	"\250\n\373\263[\026\373\335\212a?\f(\342\r\020\377\251}S=\315"
+	.ascii	"\306g\311[\317\002]\307"
+	.string	"\3060\237\3159g\243\274\004\024\021\270\034\n\361\343\275c\276\266\272\037?\032c=k\266\023#\007\321\240\201mt\31697S\322\232\370\376\236\2360T\005"
+	.string	"\237\300\234RR\270I\002DO`N1\261\233\263\022\222&\266\303K\216{\274\007\206Zs\316>tO`\204\331\250(\304o\337\277\232q\206r\316/\322g\036\312iQ\177{\233Z\033\342w\261\327\036\340?\3169\204\027r\306\261PV,6\034\244\306\3779\310\351\\\316:LK\f0\021\3510\315\350!c\"\362\320C\306\224\227:VK\017C\231i\331C\226\263\007\035\235e\nL\242\0362\234\354\241\207,\023e\026uD6?\231\226Y\207\231=d\235\214\223\311\230D\034\364\3500\021\365\220\341\020y\350!c\"\312dL\271C\326\301\031\362\321\311C\0362\031\023`&c\022u\350!c\022\365\2201Y\331=\237\256\302\027\203M\247>\273\354\321\311A@5p\206:\314\365<\231\271I\316\366l'\017\345\271\234\017\220s\r\346P\023\234\031\266-g.(g\r\207)"
+	.ascii	"\240\234&f\326\231[\332<\327\263\203\231\363\216\034\024\031"
+	.ascii	"(\347\234#\260|\316\345(;\267\274Q#\377\354\344\254A~\346\f\224"
+	.ascii	"\363\322\346\271\234\3632\347\2342T\343\231\363Q\207\236&\020"
+	.ascii	"P\316F \200r\215\245\333N\316}\226\327F\324"
+	.string	"C\326\304\024\341fF\326\314<\317\245\355\371a\346fn\3024\264\222-\305\362O\316\331>Y\233D0\234\320\341\272\347\313\234\236\321Q\343\2630\321\331-{\375n\305\256\037\226S\351\311\271\210\001\203KE\r\300q0\205A\330\202\032\237%h]b\237f4\216\360\002\336\301\271h\234\323\007v\272\203XmL\270\005~\301\214\3069\237p\324\023I\027\006\313\230\r#\301n\030\212\223\340#x\b\016\202\211`4\f\207\337p\032n\303j\330\b\006\202\177\3405,\304\212\341\"\327\307\355\223\373G\0033\2318\300\372\213\306\021\336C\234\237\3218'\f<c(\032\347\354\201\243\270\214\360\214\254\034\215#\274\204\327P\204\254\266h\034\341\024\326\301\214\3069\023\307\360\031\t\177\3218g\030\216z\342(1\034\205\004\013s\rE\343\234R\370F3\032\347,\202\227\360\r\002\344\364d\234%\007`\315\201x\t\003;D\372"
+	.ascii	"\377\370\314\307\n\\\217,C\263c\037G\236\352^4\306d\270\354\277"
+	.ascii	"J\013\246\2408ev\254L\357\013\312\242\263~%q\375\312\340\372"
+	.ascii	"\025\275\365+s`_\030\216\360k\320\353\370\353\005h\353\210\017"
+	.ascii	"\224k\353\372 2\250\303y\274\225\202\365\304\f\2511\346q\241"
+	.ascii	"\234 \325u\327\030kq\340M\217Ec\234u\231|\034q.5\306;.\023KW"
+	.ascii	"\021"
+	.string	"\032\017$\036Q\027w\215\277\202\266\376X\007\276Z\311\341\203\026\204\233\307W\320Tijn\2501\316q\241\264U\0343Fclu\231T\204v\232\3045\306U\227)\345\305\325\321QcLu\231\364\374\340\2020\245M\202{la\353W\244\242\240\324\2634,C\034\307P\207\236\300,Z[a\256_\241q\243i\025\214\362\fd:n\242+,\333i\2742\264\376\230\211m\250A{{J\270\306\261\r\254\344\206\004\307O\b\234\244\242\363\204Q\271{\222t\326\370+<\353\0031\322\013\335\217\016$\214\204\217R\350\270\252\242YQJ\203\215\257\022]\257\2627\003\313Pm\004\326\375\340\030\3072\242\210\374<\003\310c\315q\204\262\270B1\007#\t\032#r\005\025/J\243M\213\322h\323\002K\013#\224247\037x\2411\"W\260i!\004\032$o8\312\020\223\2549\216\2401\"WP\026W(\232H\022"
+	.string	"\005\020#H\220\330\200\304"
+	.string	"H\024oV\224\030!C\rI\031\027R\200\251!)\343B\n.\220PA\003\025f\2122\f@"
+	.string	"*\030`D\007\017(\222*F`\360\341(4X\001"
+	.ascii	"\001P\032mZ(\200\b (\22127 \274(3\370\214\021Y\264)\236X\037"
+	.ascii	"\201\022\036P\202\t8\244\334\004\n\210@\001\021\324\233@\001"
+	.ascii	"\021\"(P\202\210\365%\210\270E\023)\212\312\344\n\022\307\"\215"
+	.ascii	"\321\006\027\245\262xBe\006\031\344\t\\L\312\024k\212\310\024"
+	.ascii	"\226b\016F\022+,H\031\024#T\222\311\"\362\304\021\031\203M\013"
+	.ascii	"\310\"\rIc\006J\231\342\fJ\244L\021\205\312\214\315\212d\021"
+	.ascii	"\251\322\024glV\220H\032W\245\211\021 P,\"UH\026\225+P\300A"
+	.string	"\311BST\"\21777*^\2243\305\232\"\t\226\242\tdq\205L\0070Xqs\034\201,\256\220\251QQ\332\034U(*\215\310\0330XA#S\224!iL\2611\236(\316\320AiL\221\3428\343\341\345\013H\201&\tC\214\362(@\240I\036\005 \243\224\241\301I\0234\311\343K\321\346hT\316\310(\217\002\204\rj\2601\326\240\220B1\251\342%i\302E\211<\306\020\223\274\341\210\304\311\232\343\f\026A\362x\203G\220<\336`\233b\0219\223\254\251Q\241B1\251\302\205\246\230r\303Q\006\3441\211T1\243\242*mT\034G\314 \203<\241\302\202\007\033\324\342\214\321\206\"\215\212BIc\274!U\2428a,\242P\225&LP\332\030U\244(m\212)\2125\032\2401\"Ot8\n\020fL$\221E\033\214H\232\004\374xSD\206\240<\036\221!\260\334\034W\222&\21253\310\224"
+	.ascii	"\301\007e1\331Bc\223\201\0175\307#\n&R\233\2431\211,\332`\323"
+	.ascii	"\202\262\230\364\260~\250\2511\252p,QS\304\301\030\203\262\230"
+	.ascii	"\214A\241\2441\206@YL\276\024M\024oV\224\320\240x\263\242\004"
+	.ascii	"\006E\033c\215R\005\fE\033c\007\224\305d\214r\246(\303\261\304"
+	.ascii	"\215\261ffE9S\224\001)S\254\231Q)*e\224$N\330\030o\220A\246\240"
+	.string	",&\213H\017.J\023%\210P\332\030U\2545$e\\@\026\22532H\031\024#n\220A\322xXA\312\240\230\301E\023\310c\315qD\006J\0236G\243\362\006\206\033\231\024J#\n\003\250!)\343\302\t\033#RI\342\006\031$\315\213\r\307\024,J\033\3431\206c\211\242\215\261\003\036\222/55F\032Z\2125'ld\214\310\022\030$Wjj\2144\254\312\231\242\f/\311\230\232\032#\r\036\2243E\031lZ(&o\21455\032(\326pD*I\324\324\030i\b\200\262\230,\312\220B9\263*\213$R(g\324\242R\246&i#\203,\221B9\323R\254\221\231!\221B9\263\026\2252\312\243\f)\2243*\312\244\211\244\214\r62#`.B\304\b\016>\360\302\n\353\f\b4\311\243\211\0255$\2214\230P\"\2177+djn\222F\232\020\216\306\020l\2142)B\230A&C"
+	.ascii	"A\001(\222*bP\342PT\332\034gX\376\247\020a9\234\226\004\b\326"
+	.ascii	"\220\212w%\350B(\265ri>\357\224\004\251|+<xiU@\251R\2133\211"
+	.ascii	"\017\347\207/\305\220\307\311\220\013\f\330oro-Zx\301\3340\212"
+	.ascii	"\242\371\210a\303(=\314\236\265\0249\033hV<M`\254\346l8\331I"
+	.ascii	"\021o\0167,C\026,ZJ\311I\247\003\364\362\204\204C\226S\244\002"
+	.ascii	"\004\305C\224\202\223B\247\002\r\213\244,\235Z\020\227\304vR"
+	.ascii	"r\324\n\021\243\276\265\304\024\020\tU\304\006\"V\233\035A):"
+	.string	"\344\321T3\370l\030\252JQ\214\374\016UB\225P-|\302\301\033\221\032\345ja\032\205\311V\024\262\017\200\353\257\016\252fT\313\350\237`\035\nN~\234\002U6\256\032vj\215\325'\352\223!\036\200\037\352\326_u\002]qB\f\362\002T\341,\027\242\320\333_z\365\245\243\t\350\227j\241\321\200jj\254\247\247\362\271\251\340\r\225)\251{W\371\\\332h\364\355\370\007\250j\247\332\251x]s\3218\302\216\343B\374\321\344*^\213W\341r\251\261\312\344By\016\321\340q\367_\205E\251\031\225u\247.y9R\2454\003\307\255hxJ\222\032\377\003\232J\247\322\251u\026\307\305Q\362s\243\261Zw\205\325\364\263%'\247\027\302\241\316Q\343\177pJ\222$\325\002\301\274L"
+	.ascii	"\357\n\2357*\t\017\261\361?\310(RD\205C\302\222\026-#;r\025N"
+	.ascii	"\307\017z\330X}\0131C\253\251\250\261j$\004v\202\304l)\203C\325"
+	.ascii	"MuS\367\222\374\331<<\303\304!W\241oqNW\215U!!\n\371\222\340"
+	.ascii	"h\254\006\2718jq0\032\013\207a\031=\335\255\255\251l\266\303"
+	.ascii	"3'o\355o\325\253q$\004\344*[\021(@\215\325\037!`\330\252\364"
+	.ascii	"\2542PS\323\3244 +\2119\376\276\032?\003\036\352\231z\206\006"
+	.ascii	"xWH\3705d\210\263\3613h\022\023S\315\316T~\204\306\370\312\256"
+	.ascii	"\232\255azy\207\fFK\210*\254\207:\326\264\374\023j\374\fvz\360"
+	.ascii	"\205\205\245Z \230\027\217\350\256\320I\230\225\306\325\3701"
+	.ascii	"B\276\276T%<\225 7\b\253\032?\306\253\253KU\312{\333\323\353"
+	.ascii	"j\374\030\034[[\252\222\336JF\0067\330\3701>YY*\017\020\314\313"
+	.ascii	"'vW\350\304\177muN\252\326U\036Q{1\364\374r\344P\261\370\324"
+	.ascii	"(y\316\210\252\343*\326\230\f\250\265\306\352\325\241.GD\274"
+	.ascii	"\300\032\253\315C\253\314\356\220\342\252\252\372^\202bl\345"
+	.ascii	"=\247\246R@?\036\200;\316\0338p\250Q\204\035\305\r\310\206\n"
+	.ascii	"u5\352\b\016\236\035\006@L\246\352\024\205%\313A\345\2517\256"
+	.ascii	":\375"
+	.string	"H\262\365T\233\236\350\220\3604V\231V\256D(\257\306\367\360D]2R\243\206\252T\210\251\220\002\003\223\256*\271\f\026\351\300\021\345\006\342\2158\257\243#C\226\245^_N\224\221Q\n=Lq.\241\002\033\337\303\f\0312R-\304\353UT\304\327\370\035\016U!UH-J|\301\033\374A\005\343j\021\002\214\314\3255V_\254\031\nI\256\261Jt(\013\233\f\250\303\306\352Pc\275$\2419c0QyT\036\025\250g%J`\017\034\352\317U \271\234\237\261\306\252\2135&;\271\306j\013(C3\275\306\252Oca>%\205I\215\325\236\037jV\263\312\302\347\3139\330\246\352\\e\321W\204C%\244\261\232s\350\312\026cFSc\025\347P\0369\374\266\032\253K\256:\034J\\\201\201)b\206n\250\303A\365\221P\035*\005\241#2\"\222$I\032\003s\030 \b\bG\023IQ|v\023"
+	.string	"E\n*&\261\242\347\030sFHD\202\024\244 \005\245\322r\226\361\016v\177\314\377\2409<uI}\212rt!2D\246\244\221`ib<\001@n\325\203\246\325Z\345\304\316\257O`}b\032\352J0\337\032\226\3435\201g\265g\347\240\254\217[\346AK\336T\274\274w\\q\301T\030@\330\330\334\177\"\351 :o\377\302"
+	.string	"\277\227Z\227R%\375\335\234\230L\303\375,[\377\272y\327\364. \007O<\031z\204\037]4\266\333\305\023\225\334*\310\354\313m\030\312\021\225Z%M\210\253\035._\025Y\261s5^\265\016\031qa\023Z\217\360\324\335H\363\333r?L~\247-\322\356p\235\273yw\334a\023N\336\273\253\240\354\033j[:\226q"
+	.string	"\221\253\026J\340\222\331"
+	.string	" \256\314`\233\337\255\343~\374z\236\337\253\350T\"e\320\215\203\027\366\f]\017\006\2313U\006\316\327\214\325\302\371\230\300?\217\321h\222&\\{\0262\256\302~\337j\024#\033(\002\203\217\374\367\363O\347\311\177\301\321k\364\246\357\274u\tC\024\0304\364Y\236]\211\0212\027\264\245\215r\026_R\002#~\366\217\247n\337C\002\347\247\245\224$\263\310$\353\242-\377\305W?P\356\354\235\267\354~\375\244m\"\321\202o\330[\254\211\3505@7q\272\026\270\030\243\233\037^\331\353\200\340&Tz\375%\177\355>\264>\262vj\204\342(\334\353l\026\374t\231\2500\030\244o__\236u}q\334\006\326m\007\315?\377\262\237\f\354]*\376\022\277\013\200"
+	.string	",&\244\013V\367\344\352\305#\365i\221\236\217\032\325\0251\210\301\255\361!\340;k\267\274\013:\\o\021\001k\350'-\027\200\004q\2756!@_\001\032`\300hY~\266\361;\370JR\022\315\330\251\243\277\206^\tH\237\016/\037\233\r\2143\245\223ON\020\nh\320\022E\257O\231i\201\352\035&\366y\331$B\017\032\004b\235\270\ttN\262\306\242\336t\272NXK\305\3622f\375g\274\326U\305N\303\250\226C\242\002{_\211Na\263 :\321Y\365\003\227\362>\263k)\231/\312\311\n\324\302}\307&\231\r \340\266\203\362\002\336\300\22538P8\321\320\003m\200\033\244\354`.\335\231\357\264/2T\255b\327]r\006\262\005QW\301\3104\370\334\\1\334_\345`\b\376\337\006\364\313\365r\305f\r\214\315"
+	.string	"\2009\374\273\373IR\223\273\227\013\247\216|\035\357\361\342\0355\024\357\255\237\274\021B\177\207\321\247F\227\007\236\026K\216w\361\3225jA\364\201\242<\006\3371\340<Q\230\356\263W\237\267J'hm\321\004\337L\2203\034\205\362\361\246\334\025}V\272\327\277\275Q\006i\211\303\234\003\023Pm@\201!\264>\333\007\\\207\336B\312K\343\336\305\225\027\252\020\220\2170\231\252\371\332\004hJW\001\336'$\b\204,\330\370\323\247\230\260N8\227\355\024t\1775hq\377z(\352\272\1771-O\003\321\0256\251]t\242\223\356P\214\330a\036\037\020A8\3216\350\303\316x\360\307vz\022\006X\177\311\177\323\233D?\241\211A\341W\363\340\352\331!\002p\316ot\356\005\302c-J[\2521\200\267#T\371G\365m\rbk\240\305\354\257\022\036\266\300,;\035y\327_/\277"
+	.ascii	"\256\266\264\353\230B+\367\257l\320\332\t\227:1\307J\202\204"
+	.ascii	"\"\240cP\342\224\266\260+\270\372\023\b\252\006\0300\004\324"
+	.ascii	"(w{@\204\t\234\250\331\313\223\227`\004\206G\177D?=W\360.r\325"
+	.ascii	"T\275\352\255\232h\212\240\255U\304\361\t\034\001\210\205\224"
+	.ascii	"on\244\006\3062\005\325\221\334\210\3207du\247\372\273\330\034"
+	.ascii	"\322\tL\335\355\234\321\371{\357\242\036\376\025M\242C\352\237"
+	.ascii	"k\271ESM\225\241\356\2228\371\246\253+\233\330\2614\300\204l"
+	.ascii	"\343\307\357\342.\fo\030\261\023\250\237\225\276\222j\362W\370"
+	.ascii	"=\020\023\032\202\2042u\322\342\243\306\205\255\242[\351 \003"
+	.ascii	"\2202\356%\037\271\220\361 X\030$\330\274\005u\007\241\213\005"
+	.ascii	"\260\233\200zL\246\n\344\222)\325\360)\336\200Vz\220\2656\021"
+	.ascii	"\b\024\315?\236\237\256\311b9\311\313\007\351\345Ml\330\025\336"
+	.ascii	"\342l74\364\340\244$Y\325\3412\233N^wR\t"
+	.string	"4\253\262\346\235\302\350sg\263F\211\203\t\0371\311\224\247\364\270.Q\021V\026\332v\365\372\243\257w\307\314\336q\034\033nv\337\"72\305w\3204\331\233iB\031\304T{\307\326\251\373 be\263\306\b\211\223\356.\247\237\365\035\360\003h\034\357\220\007\256r\177\242>H\025tCDE\335I\227\320\241\352+\f\016\331W\360j\001\2537\250\262CwL\021\276\256\322\017\313\200\265!KL\304\245\026Y\227Y:\027\377\031$\002;l\356\206\345\374\232\327\023\324\026R\310\277q\353\2036\211JF3{F\220s(\240\251\272P\343\223\024T)\330\317\317\2327\331\342\fbM\300\243\205\017\027\t\321\370\0379\377\226\f\201N\320\250\236"
+	.string	"\224\002\357_{\013t\317\"\253\350\212\310\264u\003-\362\372a\215&\017'\234\244\362\21283\007\006\256\211\314J\031\016O"
+	.ascii	"\225\314E\214\244\007\363\331\317\002\340\361\017-\344\243\343"
+	.ascii	"\342\234\352B.\203/Hm\200\213\306\324\252M\375p*\026\230\262"
+	.ascii	"\016\302A\016\024\027Y\020\007\323\227\226\353\231\024\363\235"
+	.ascii	"\226|8\237\020aI\344I\322\235\017\242\263p\b`;\347&\351\203\254"
+	.ascii	"|~\340\"\r#D\361\223T\357\360I\3676\347\3666"
+	.string	"\032@.\356\277EC\326\177x6\344\035)g\220)w\004\036\036\253R7\\\2446\207t\t\330\\\330\255b\344p\372\304\330qh \261\346P\300;E\0026\037\030\243/\b\256\036(U\260\275\234^uU+\346\231]\306^o\025\263_\207\2500b\335\007,C0a#r\002.\304H\013\004\016\3210\325lPR$\253\270\022~\021\0268\337\344\223\234r\032\227\022s\332\305\025\207[g\212!9\002\362iF\350W\274\321\354\244\3670%Ig\2765\214\226\b\206\242/\244\"\2048\fKlI\036\2352\033\364\b\032\374\031\037\037X\337\266\211\236\367Dy\n\331\267Z\300\361d\275K\016JA\315}\335\n\263\341\354\031 pA\377\253LHcW\353\311\325L\366j\355\021\303\305O2\276\332!u\263\326-\370\277\302\003:\275\265\310\034\240\207\332\273\265\202\212\016\035\227\t\251\243A\214\345H@\037\306\254\340"
+	.string	"\264\252h\260f\206\205,)\343\272\314\207\323\231\227'\203/\376\230\245\337\204"
+	.ascii	"\037)\332\003"
+	.string	"K\233\013\275\367q\277S\254\262Qd\316\340\361\253\031\215I\025\201\n\277B!\217 \034\024/\222\340\337\303\037>f3\0215\3710{\350N7a\340\376\03405\376v1]\304f\347\034z\335\035M@L\254\276\336\2102,\035\240t\204\003 \227\224\002A\001;\232\332\035\320\303\356\351Nf\213\002\207:\243\365\213\2516G:\231\3444\257\2428\373\017\324\b\032h\003\313E\005\361q=\3425z\322\205\021\264S\030-\216<\320L\341\003 Q\304\200S/\354\013\215T\36664\241N=\316'\353\240\3333\033,\237\335E\306\252.\350\231\f\356\345#Z\231\250\262\242\323\301\"\315\322\331\017\243GA\315\317\363\016\3474\216\377\263\335\244u\371\363^l\371\263\213\rW\371\002\340\252k\200:\3102D\007|k\341\360\270\243X\0047\253\360\022\0225o\213Q\027\331\241\374V\210\2609k\356\243c]9YBL"
+	.string	"\246k\307!\003\304\367\215\b8\177H\n38I\377\031\035QYE\330\313{\366\300\206\226\304\355\333\026\273\254\005[\365L_\f\242\033\204M\177\210\024\321>\354-\n\2265\322aSp\310\017P\243\3037\264L\206\271\212\003\036\374\337=\0025\206\246\313\315\364\352\322\242\021\n\236y\237\302\351i$\230^\336\357w(g\242]\222\305c\310Eq4\334\360\320G\270V\333Y\036O\b\210\362\205o\316\362\301K\326\325K\3009\244\037\370\300\362\221\225\013\324\032\365S\320\025\304H\215\177\277.9)\266\222\030\352\235G\206\215|\212\322@\236a\0338\240ZW\277\037\216g\365+D&:`\365\353\360\372\271\231\232\033\002\355\f\252"
+	.string	"P\305\022b\274nx1\201\253X\310\240\364\221\370\316\347\224\360\327l\\!\033D\347\203\027\006*u\224\257\200\272'\031\275m0s&\303\023O\332\\\330\024\221]\377\024\246\222\024\360\003%\316\225\233"
+	.string	"\271\fQ\263M.UR\372\2520E\361\017\020\364\232*\370\243z\216h\203\347\303v\037\320\016\021`\372\304\213B\237\232\022*\361}\274;\036\210\003,H\235\352S\177qu>&J:\026\321p\330\251\007\3073g\270\341"
+	.string	"n\310\356\n\200\325\351\234\034\334{\314wf\336"
+	.string	"\037\204\363MD\364\247\360v\006\320\030Kb\277K8\217\360iE\235\250b\346\305\017\302\375N\370{|\335N\363:\314\377\024hN\016\016\357\274v\317\314\035\007nx\332^\343\215\272\271\025q\216\023P\326\003\202\270\013Yl\377\322\017=\276r\357r5\013\256\363\350[\253\210\354\024~\215\242\343\372\004\227\255\360\\\"\225I|\306#\032\370\"\230\305\207\210\362 <\324\037\032\333\003\237\270\303\214\360yp\332\365!\270u\200E\235\366\206\030\023\327\315\037hx\027~\377\302\326]\371{>\362\"\247\256g\304a\035\273D@g\204\177\037\215\0319ft"
+	.ascii	"\361\232\253\231C\003\213\201\327!\332l\350\030\207R\360_\f~"
+	.ascii	"\264\310F\365\202\004\361v\270\r;x\366\226\255\301\2362\265\021"
+	.ascii	")\263 \026\024\342\n\346\017\245\344\f\345\256\323\376\337\366"
+	.ascii	"J\375\016\214\311\236;\223\332#\353\374\214aD\351_\326\245aw"
+	.ascii	"\265\306\341\320\354a\024\2549Z\243\302\317Dpz_\270\263\177\021"
+	.ascii	"\026\330\025\215w\377]\033\267\343\205\302\031\227%\367\207\237"
+	.ascii	"\207\030\362\314\351\223\207\315\177\371\377\347\b\220/~\236"
+	.ascii	"\373\207\025Z\036\004\302\037\355\253\202\216Q\370@\3703\364"
+	.ascii	"!\200\233Z\363\200\203\312\307o\350o\02472\307\013{\222\327G"
+	.ascii	"\271\276K\313s\234\363\3144\b\210]\013\326\231\373\325\274\306"
+	.ascii	"\374-\351\227\357\231\207z{\351D\321f9\345\311N5\272\022\037"
+	.ascii	"\3421\313\316\300&\230!Y\211X5\220\350\n"
+	.text
+	.section	.gnu.lto_.symtab.3ea8fa33787d5f26,"e",@progbits
+	.string	"frskyOsdDisplayPortInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"frskyOsdGetPixelHeight"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"frskyOsdGetPixelWidth"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"frskyOsdContextPop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"frskyOsdContextPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"frskyOsdCtmRotate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"frskyOsdCtmScale"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"frskyOsdCtmTranslate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"frskyOsdCtmSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"frskyOsdCtmReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"frskyOsdFillStrokeEllipseInRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"frskyOsdFillEllipseInRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"frskyOsdStrokeEllipseInRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"frskyOsdFillStrokeRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"frskyOsdFillRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"frskyOsdStrokeRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"frskyOsdFillStrokeTriangle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"frskyOsdFillTriangle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"frskyOsdStrokeTriangle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"frskyOsdStrokeLineToPoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"frskyOsdMoveToPoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"frskyOsdDrawStringMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"frskyOsdDrawString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"frskyOsdDrawCharacterMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"frskyOsdDrawCharacter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"frskyOsdResetDrawingState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"frskyOsdClearRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"frskyOsdClipToRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"frskyOsdSetLineOutlineColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"frskyOsdSetLineOutlineType"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"frskyOsdSetStrokeWidth"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"frskyOsdSetPixelToFillColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"frskyOsdSetPixelToStrokeColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"frskyOsdSetPixel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"frskyOsdSetColorInversion"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"frskyOsdSetStrokeAndFillColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"frskyOsdSetFillColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"frskyOsdSetStrokeColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"frskyOsdCommitTransaction"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"frskyOsdBeginTransaction"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"frskyOsdGetGridCols"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"frskyOsdGetGridRows"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"frskyOsdWriteFontCharacter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"frskyOsdDrawCharInGrid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"frskyOsdDrawStringInGrid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"frskyOsdUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"frskyOsdClearScreen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"frskyOsdIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"frskyOsdInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3ea8fa33787d5f26,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
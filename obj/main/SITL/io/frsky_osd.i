@@ -0,0 +1,3003 @@
+# 0 "./src/main/io/frsky_osd.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./src/main/io/frsky_osd.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 2 "./src/main/io/frsky_osd.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 3 "./src/main/io/frsky_osd.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 120 "/usr/include/string.h" 3 4
+extern void *rawmemchr (const void *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 133 "/usr/include/string.h" 3 4
+extern void *memrchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)))
+      __attribute__ ((__access__ (__read_only__, 1, 3)));
+
+
+
+
+
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 286 "/usr/include/string.h" 3 4
+extern char *strchrnul (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 380 "/usr/include/string.h" 3 4
+extern char *strcasestr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern void *memmem (const void *__haystack, size_t __haystacklen,
+       const void *__needle, size_t __needlelen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 3)))
+    __attribute__ ((__access__ (__read_only__, 1, 2)))
+    __attribute__ ((__access__ (__read_only__, 3, 4)));
+
+
+
+extern void *__mempcpy (void *__restrict __dest,
+   const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern void *mempcpy (void *__restrict __dest,
+        const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 444 "/usr/include/string.h" 3 4
+extern char *strerror_r (int __errnum, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern const char *strerrordesc_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+extern const char *strerrorname_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern const char *sigabbrev_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern const char *sigdescr_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int strverscmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strfry (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void *memfrob (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__read_write__, 1, 2)));
+# 527 "/usr/include/string.h" 3 4
+extern char *basename (const char *__filename) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 539 "/usr/include/string.h" 3 4
+
+# 4 "./src/main/io/frsky_osd.c" 2
+
+# 1 "./src/main/platform.h" 1
+# 21 "./src/main/platform.h"
+       
+# 126 "./src/main/platform.h"
+# 1 "./src/main/target/common_pre.h" 1
+# 21 "./src/main/target/common_pre.h"
+       
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+# 127 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 23 "./src/main/target/SITL/target.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 26 "./src/main/target/SITL/target.h" 2
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 28 "./src/main/target/SITL/target.h" 2
+
+# 1 "./src/main/common/utils.h" 1
+# 21 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "./src/main/common/utils.h" 2
+# 100 "./src/main/common/utils.h"
+
+# 100 "./src/main/common/utils.h"
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return (int16_t)(a-b); }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return (int32_t)(a-b); }
+
+
+
+
+
+
+static inline void memcpy_fn ( void * destination, const void * source, size_t num ) { memcpy(destination, source, num); }
+# 30 "./src/main/target/SITL/target.h" 2
+# 151 "./src/main/target/SITL/target.h"
+extern uint32_t SystemCoreClock;
+
+typedef enum
+{
+    Mode_TEST = 0x0,
+    Mode_Out_PP = 0x10
+} GPIO_Mode;
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct
+{
+  uint32_t IDR;
+  uint32_t ODR;
+  uint32_t BSRR;
+  uint32_t BRR;
+} GPIO_TypeDef;
+
+
+
+typedef struct
+{
+    void* test;
+} TIM_TypeDef;
+
+typedef struct
+{
+    void* test;
+} TIM_OCInitTypeDef;
+
+typedef struct {
+    void* test;
+} DMA_TypeDef;
+
+typedef struct {
+    void* test;
+} DMA_Channel_TypeDef;
+
+uint8_t DMA_GetFlagStatus(void *);
+void DMA_Cmd(DMA_Channel_TypeDef*, FunctionalState );
+void DMA_ClearFlag(uint32_t);
+
+typedef struct
+{
+    void* test;
+} SPI_TypeDef;
+
+typedef struct
+{
+    void* test;
+} USART_TypeDef;
+# 224 "./src/main/target/SITL/target.h"
+typedef struct
+{
+    void* test;
+} I2C_TypeDef;
+
+typedef enum
+{
+  FLASH_BUSY = 1,
+  FLASH_ERROR_PG,
+  FLASH_ERROR_WRP,
+  FLASH_COMPLETE,
+  FLASH_TIMEOUT
+} FLASH_Status;
+
+typedef struct {
+    double timestamp;
+    double imu_angular_velocity_rpy[3];
+    double imu_linear_acceleration_xyz[3];
+    double imu_orientation_quat[4];
+    double velocity_xyz[3];
+    double position_xyz[3];
+} fdm_packet;
+typedef struct {
+    float motor_speed[4];
+} servo_packet;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address);
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data);
+
+uint64_t nanos64_real(void);
+uint64_t micros64_real(void);
+uint64_t millis64_real(void);
+void delayMicroseconds_real(uint32_t us);
+uint64_t micros64(void);
+uint64_t millis64(void);
+
+int lockMainPID(void);
+
+void simulatorLoop(void);
+
+# 265 "./src/main/target/SITL/target.h" 3 4
+_Bool 
+# 265 "./src/main/target/SITL/target.h"
+    simulatorHasMotorRPM(void);
+int simulatorGetMotorERPM(uint8_t motor);
+# 128 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_deprecated_post.h" 1
+# 24 "./src/main/target/common_deprecated_post.h"
+       
+# 129 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 23 "./src/main/target/common_post.h"
+       
+
+# 1 "./src/main/build/version.h" 1
+# 21 "./src/main/build/version.h"
+       
+# 34 "./src/main/build/version.h"
+extern const char* const targetName;
+
+
+extern const char* const shortGitRevision;
+
+
+extern const char* const buildDate;
+
+
+extern const char* const buildTime;
+# 26 "./src/main/target/common_post.h" 2
+# 331 "./src/main/target/common_post.h"
+extern uint8_t eepromData[32768];
+# 130 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_defaults_post.h" 1
+# 131 "./src/main/platform.h" 2
+# 6 "./src/main/io/frsky_osd.c" 2
+
+
+
+# 1 "./src/main/common/crc.h" 1
+# 21 "./src/main/common/crc.h"
+       
+
+struct sbuf_s;
+
+uint16_t crc16_ccitt(uint16_t crc, unsigned char a);
+uint16_t crc16_ccitt_update(uint16_t crc, const void *data, uint32_t length);
+struct sbuf_s;
+void crc16_ccitt_sbuf_append(struct sbuf_s *dst, uint8_t *start);
+
+uint8_t crc8_dvb_s2(uint8_t crc, unsigned char a);
+uint8_t crc8_dvb_s2_update(uint8_t crc, const void *data, uint32_t length);
+void crc8_dvb_s2_sbuf_append(struct sbuf_s *dst, uint8_t *start);
+
+uint8_t crc8_smbus(uint8_t crc, unsigned char a);
+uint8_t crc8_smbus_update(uint8_t crc, const void *data, uint32_t length);
+
+uint8_t crc8_xor_update(uint8_t crc, const void *data, uint32_t length);
+void crc8_xor_sbuf_append(struct sbuf_s *dst, uint8_t *start);
+# 10 "./src/main/io/frsky_osd.c" 2
+# 1 "./src/main/common/maths.h" 1
+# 21 "./src/main/common/maths.h"
+       
+# 63 "./src/main/common/maths.h"
+typedef int32_t fix12_t;
+
+typedef struct stdev_s
+{
+    float m_oldM, m_newM, m_oldS, m_newS;
+    int m_n;
+} stdev_t;
+
+
+typedef struct fp_vector {
+    float X;
+    float Y;
+    float Z;
+} t_fp_vector_def;
+
+typedef union u_fp_vector {
+    float A[3];
+    t_fp_vector_def V;
+} t_fp_vector;
+
+
+
+typedef struct fp_angles {
+    float roll;
+    float pitch;
+    float yaw;
+} fp_angles_def;
+
+typedef union {
+    float raw[3];
+    fp_angles_def angles;
+} fp_angles_t;
+
+typedef struct fp_rotationMatrix_s {
+    float m[3][3];
+} fp_rotationMatrix_t;
+
+int gcd(int num, int denom);
+float powerf(float base, int exp);
+int32_t applyDeadband(int32_t value, int32_t deadband);
+float fapplyDeadband(float value, float deadband);
+
+void devClear(stdev_t *dev);
+void devPush(stdev_t *dev, float x);
+float devVariance(stdev_t *dev);
+float devStandardDeviation(stdev_t *dev);
+float degreesToRadians(int16_t degrees);
+
+int scaleRange(int x, int srcFrom, int srcTo, int destFrom, int destTo);
+float scaleRangef(float x, float srcFrom, float srcTo, float destFrom, float destTo);
+
+void normalizeV(struct fp_vector *src, struct fp_vector *dest);
+
+void rotateV(struct fp_vector *v, fp_angles_t *delta);
+void buildRotationMatrix(fp_angles_t *delta, fp_rotationMatrix_t *rotation);
+void applyRotation(float *v, fp_rotationMatrix_t *rotationMatrix);
+
+int32_t quickMedianFilter3(int32_t * v);
+int32_t quickMedianFilter5(int32_t * v);
+int32_t quickMedianFilter7(int32_t * v);
+int32_t quickMedianFilter9(int32_t * v);
+
+float quickMedianFilter3f(float * v);
+float quickMedianFilter5f(float * v);
+float quickMedianFilter7f(float * v);
+float quickMedianFilter9f(float * v);
+
+
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+
+float exp_approx(float val);
+float log_approx(float val);
+float pow_approx(float a, float b);
+# 150 "./src/main/common/maths.h"
+void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count);
+
+int16_t qPercent(fix12_t q);
+int16_t qMultiply(fix12_t q, int16_t input);
+fix12_t qConstruct(int16_t num, int16_t den);
+
+static inline int constrain(int amt, int low, int high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+
+static inline float constrainf(float amt, float low, float high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+# 11 "./src/main/io/frsky_osd.c" 2
+# 1 "./src/main/common/time.h" 1
+# 21 "./src/main/common/time.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/pg/pg.h" 1
+# 21 "./src/main/pg/pg.h"
+       
+
+
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 21 "./src/main/build/build_config.h"
+       
+# 44 "./src/main/build/build_config.h"
+typedef enum {
+    MCU_TYPE_SIMULATOR = 0,
+    MCU_TYPE_F103,
+    MCU_TYPE_F303,
+    MCU_TYPE_F40X,
+    MCU_TYPE_F411,
+    MCU_TYPE_F446,
+    MCU_TYPE_F722,
+    MCU_TYPE_F745,
+    MCU_TYPE_F746,
+    MCU_TYPE_F765,
+    MCU_TYPE_H750,
+    MCU_TYPE_H743_REV_UNKNOWN,
+    MCU_TYPE_H743_REV_Y,
+    MCU_TYPE_H743_REV_X,
+    MCU_TYPE_H743_REV_V,
+    MCU_TYPE_UNKNOWN = 255,
+} mcuTypeId_e;
+
+mcuTypeId_e getMcuTypeId(void);
+# 27 "./src/main/pg/pg.h" 2
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint8_t length;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+static inline uint16_t pgElementSize(const pgRegistry_t* reg) {return (reg->size & PGR_SIZE_MASK) / reg->length;}
+# 75 "./src/main/pg/pg.h"
+extern const pgRegistry_t __pg_registry_start[];
+extern const pgRegistry_t __pg_registry_end[];
+
+
+extern const uint8_t __pg_resetdata_start[];
+extern const uint8_t __pg_resetdata_end[];
+# 194 "./src/main/pg/pg.h"
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+
+# 196 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 196 "./src/main/pg/pg.h"
+    pgLoad(const pgRegistry_t* reg, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size);
+void pgResetAll(void);
+void pgResetInstance(const pgRegistry_t *reg, uint8_t *base);
+
+# 200 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 200 "./src/main/pg/pg.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg);
+# 29 "./src/main/common/time.h" 2
+
+
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+
+
+
+typedef uint32_t timeUs_t;
+
+
+
+
+
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+
+
+
+
+
+typedef struct timeConfig_s {
+    int16_t tz_offsetMinutes;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+
+
+# 83 "./src/main/common/time.h" 3 4
+_Bool 
+# 83 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 84 "./src/main/common/time.h" 3 4
+_Bool 
+# 84 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+# 85 "./src/main/common/time.h" 3 4
+_Bool 
+# 85 "./src/main/common/time.h"
+    dateTimeFormatLocalShort(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *utcDateTime, dateTime_t *localDateTime);
+
+
+
+
+# 91 "./src/main/common/time.h" 3 4
+_Bool 
+# 91 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 93 "./src/main/common/time.h" 3 4
+_Bool 
+# 93 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 95 "./src/main/common/time.h" 3 4
+_Bool 
+# 95 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 96 "./src/main/common/time.h" 3 4
+_Bool 
+# 96 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 98 "./src/main/common/time.h" 3 4
+_Bool 
+# 98 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 99 "./src/main/common/time.h" 3 4
+_Bool 
+# 99 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+
+void rtcPersistWrite(int16_t offsetMinutes);
+
+# 102 "./src/main/common/time.h" 3 4
+_Bool 
+# 102 "./src/main/common/time.h"
+    rtcPersistRead(rtcTime_t *t);
+# 12 "./src/main/io/frsky_osd.c" 2
+
+# 1 "./src/main/common/uvarint.h" 1
+# 27 "./src/main/common/uvarint.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "./src/main/common/uvarint.h" 2
+
+
+int uvarintEncode(uint32_t val, uint8_t *ptr, size_t size);
+int uvarintDecode(uint32_t *val, const uint8_t *ptr, size_t size);
+# 14 "./src/main/io/frsky_osd.c" 2
+
+# 1 "./src/main/drivers/time.h" 1
+# 21 "./src/main/drivers/time.h"
+       
+
+
+
+
+
+void delayMicroseconds(timeUs_t us);
+void delay(timeMs_t ms);
+
+timeUs_t micros(void);
+timeUs_t microsISR(void);
+timeMs_t millis(void);
+
+uint32_t ticks(void);
+timeDelta_t ticks_diff_us(uint32_t begin, uint32_t end);
+# 16 "./src/main/io/frsky_osd.c" 2
+
+# 1 "./src/main/io/frsky_osd.h" 1
+       
+
+
+
+
+# 1 "./src/main/drivers/display.h" 1
+# 21 "./src/main/drivers/display.h"
+       
+
+typedef enum {
+    DISPLAYPORT_ATTR_NONE = 0,
+    DISPLAYPORT_ATTR_INFO,
+    DISPLAYPORT_ATTR_WARNING,
+    DISPLAYPORT_ATTR_CRITICAL,
+} displayPortAttr_e;
+
+
+
+typedef enum {
+    DISPLAYPORT_LAYER_FOREGROUND,
+    DISPLAYPORT_LAYER_BACKGROUND,
+    DISPLAYPORT_LAYER_COUNT,
+} displayPortLayer_e;
+
+typedef enum {
+    DISPLAY_TRANSACTION_OPT_NONE = 0,
+    DISPLAY_TRANSACTION_OPT_PROFILED = 1 << 0,
+    DISPLAY_TRANSACTION_OPT_RESET_DRAWING = 1 << 1,
+} displayTransactionOption_e;
+
+
+struct displayCanvas_s;
+struct osdCharacter_s;
+struct displayPortVTable_s;
+
+typedef struct displayPort_s {
+    const struct displayPortVTable_s *vTable;
+    void *device;
+    uint8_t rows;
+    uint8_t cols;
+    uint8_t posX;
+    uint8_t posY;
+
+
+    
+# 58 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 58 "./src/main/drivers/display.h"
+        useFullscreen;
+    
+# 59 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 59 "./src/main/drivers/display.h"
+        cleared;
+    int8_t cursorRow;
+    int8_t grabCount;
+
+
+    
+# 64 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 64 "./src/main/drivers/display.h"
+        useDeviceBlink;
+} displayPort_t;
+
+typedef struct displayPortVTable_s {
+    int (*grab)(displayPort_t *displayPort);
+    int (*release)(displayPort_t *displayPort);
+    int (*clearScreen)(displayPort_t *displayPort);
+    int (*drawScreen)(displayPort_t *displayPort);
+    int (*screenSize)(const displayPort_t *displayPort);
+    int (*writeString)(displayPort_t *displayPort, uint8_t x, uint8_t y, uint8_t attr, const char *text);
+    int (*writeChar)(displayPort_t *displayPort, uint8_t x, uint8_t y, uint8_t attr, uint8_t c);
+    
+# 75 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 75 "./src/main/drivers/display.h"
+        (*isTransferInProgress)(const displayPort_t *displayPort);
+    int (*heartbeat)(displayPort_t *displayPort);
+    void (*resync)(displayPort_t *displayPort);
+    
+# 78 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 78 "./src/main/drivers/display.h"
+        (*isSynced)(const displayPort_t *displayPort);
+    uint32_t (*txBytesFree)(const displayPort_t *displayPort);
+    
+# 80 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 80 "./src/main/drivers/display.h"
+        (*layerSupported)(displayPort_t *displayPort, displayPortLayer_e layer);
+    
+# 81 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 81 "./src/main/drivers/display.h"
+        (*layerSelect)(displayPort_t *displayPort, displayPortLayer_e layer);
+    
+# 82 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 82 "./src/main/drivers/display.h"
+        (*layerCopy)(displayPort_t *displayPort, displayPortLayer_e destLayer, displayPortLayer_e sourceLayer);
+    
+# 83 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 83 "./src/main/drivers/display.h"
+        (*writeFontCharacter)(displayPort_t *instance, uint16_t addr, const struct osdCharacter_s *chr);
+    
+# 84 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 84 "./src/main/drivers/display.h"
+        (*isReady)(displayPort_t *displayPort);
+    void (*beginTransaction)(displayPort_t *displayPort, displayTransactionOption_e opts);
+    void (*commitTransaction)(displayPort_t *displayPort);
+    
+# 87 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 87 "./src/main/drivers/display.h"
+        (*getCanvas)(struct displayCanvas_s *canvas, const displayPort_t *displayPort);
+} displayPortVTable_t;
+
+void displayGrab(displayPort_t *instance);
+void displayRelease(displayPort_t *instance);
+void displayReleaseAll(displayPort_t *instance);
+
+# 93 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 93 "./src/main/drivers/display.h"
+    displayIsGrabbed(const displayPort_t *instance);
+void displayClearScreen(displayPort_t *instance);
+void displayDrawScreen(displayPort_t *instance);
+int displayScreenSize(const displayPort_t *instance);
+void displaySetXY(displayPort_t *instance, uint8_t x, uint8_t y);
+int displayWrite(displayPort_t *instance, uint8_t x, uint8_t y, uint8_t attr, const char *s);
+int displayWriteChar(displayPort_t *instance, uint8_t x, uint8_t y, uint8_t attr, uint8_t c);
+
+# 100 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 100 "./src/main/drivers/display.h"
+    displayIsTransferInProgress(const displayPort_t *instance);
+void displayHeartbeat(displayPort_t *instance);
+void displayResync(displayPort_t *instance);
+
+# 103 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 103 "./src/main/drivers/display.h"
+    displayIsSynced(const displayPort_t *instance);
+uint16_t displayTxBytesFree(const displayPort_t *instance);
+
+# 105 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 105 "./src/main/drivers/display.h"
+    displayWriteFontCharacter(displayPort_t *instance, uint16_t addr, const struct osdCharacter_s *chr);
+
+# 106 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 106 "./src/main/drivers/display.h"
+    displayIsReady(displayPort_t *instance);
+void displayBeginTransaction(displayPort_t *instance, displayTransactionOption_e opts);
+void displayCommitTransaction(displayPort_t *instance);
+
+# 109 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 109 "./src/main/drivers/display.h"
+    displayGetCanvas(struct displayCanvas_s *canvas, const displayPort_t *instance);
+void displayInit(displayPort_t *instance, const displayPortVTable_t *vTable);
+
+# 111 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 111 "./src/main/drivers/display.h"
+    displayLayerSupported(displayPort_t *instance, displayPortLayer_e layer);
+
+# 112 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 112 "./src/main/drivers/display.h"
+    displayLayerSelect(displayPort_t *instance, displayPortLayer_e layer);
+
+# 113 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 113 "./src/main/drivers/display.h"
+    displayLayerCopy(displayPort_t *instance, displayPortLayer_e destLayer, displayPortLayer_e sourceLayer);
+# 7 "./src/main/io/frsky_osd.h" 2
+# 1 "./src/main/drivers/osd.h" 1
+# 21 "./src/main/drivers/osd.h"
+       
+# 43 "./src/main/drivers/osd.h"
+typedef enum {
+    VIDEO_SYSTEM_AUTO = 0,
+    VIDEO_SYSTEM_PAL,
+    VIDEO_SYSTEM_NTSC
+} videoSystem_e;
+
+typedef enum {
+    OSD_DRIVER_NONE = 0,
+    OSD_DRIVER_MAX7456 = 1,
+} osdDriver_e;
+
+
+
+
+
+typedef struct osdCharacter_s {
+    uint8_t data[64];
+} osdCharacter_t;
+# 8 "./src/main/io/frsky_osd.h" 2
+
+typedef enum {
+    FRSKY_OSD_TRANSACTION_OPT_PROFILED = 1 << 0,
+    FRSKY_OSD_TRANSACTION_OPT_RESET_DRAWING = 1 << 1,
+} frskyOsdTransactionOptions_e;
+
+typedef enum {
+    FRSKY_OSD_COLOR_BLACK = 0,
+    FRSKY_OSD_COLOR_TRANSPARENT = 1,
+    FRSKY_OSD_COLOR_WHITE = 2,
+    FRSKY_OSD_COLOR_GRAY = 3,
+} frskyOsdColor_e;
+
+typedef enum {
+    FRSKY_OSD_OUTLINE_TYPE_NONE = 0,
+    FRSKY_OSD_OUTLINE_TYPE_TOP = 1 << 0,
+    FRSKY_OSD_OUTLINE_TYPE_RIGHT = 1 << 1,
+    FRSKY_OSD_OUTLINE_TYPE_BOTTOM = 1 << 2,
+    FRSKY_OSD_OUTLINE_TYPE_LEFT = 1 << 3,
+} frskyOsdLineOutlineType_e;
+
+
+# 29 "./src/main/io/frsky_osd.h" 3 4
+_Bool 
+# 29 "./src/main/io/frsky_osd.h"
+    frskyOsdInit(videoSystem_e videoSystem);
+
+# 30 "./src/main/io/frsky_osd.h" 3 4
+_Bool 
+# 30 "./src/main/io/frsky_osd.h"
+    frskyOsdIsReady(void);
+void frskyOsdUpdate(void);
+void frskyOsdBeginTransaction(frskyOsdTransactionOptions_e opts);
+void frskyOsdCommitTransaction(void);
+void frskyOsdFlushSendBuffer(void);
+
+# 35 "./src/main/io/frsky_osd.h" 3 4
+_Bool 
+# 35 "./src/main/io/frsky_osd.h"
+    frskyOsdReadFontCharacter(unsigned char_address, osdCharacter_t *chr);
+
+# 36 "./src/main/io/frsky_osd.h" 3 4
+_Bool 
+# 36 "./src/main/io/frsky_osd.h"
+    frskyOsdWriteFontCharacter(unsigned char_address, const osdCharacter_t *chr);
+
+unsigned frskyOsdGetGridRows(void);
+unsigned frskyOsdGetGridCols(void);
+
+unsigned frskyOsdGetPixelWidth(void);
+unsigned frskyOsdGetPixelHeight(void);
+
+void frskyOsdDrawStringInGrid(unsigned x, unsigned y, const char *buff);
+void frskyOsdDrawCharInGrid(unsigned x, unsigned y, uint16_t chr);
+
+# 46 "./src/main/io/frsky_osd.h" 3 4
+_Bool 
+# 46 "./src/main/io/frsky_osd.h"
+    frskyOsdReadCharInGrid(unsigned x, unsigned y, uint16_t *c);
+void frskyOsdClearScreen(void);
+
+void frskyOsdSetStrokeColor(frskyOsdColor_e color);
+void frskyOsdSetFillColor(frskyOsdColor_e color);
+void frskyOsdSetStrokeAndFillColor(frskyOsdColor_e color);
+void frskyOsdSetColorInversion(
+# 52 "./src/main/io/frsky_osd.h" 3 4
+                              _Bool 
+# 52 "./src/main/io/frsky_osd.h"
+                                   inverted);
+void frskyOsdSetPixel(int x, int y, frskyOsdColor_e color);
+void frskyOsdSetPixelToStrokeColor(int x, int y);
+void frskyOsdSetPixelToFillColor(int x, int y);
+void frskyOsdSetStrokeWidth(unsigned width);
+void frskyOsdSetLineOutlineType(frskyOsdLineOutlineType_e outlineType);
+void frskyOsdSetLineOutlineColor(frskyOsdColor_e outlineColor);
+
+void frskyOsdClipToRect(int x, int y, int w, int h);
+void frskyOsdClearRect(int x, int y, int w, int h);
+void frskyOsdResetDrawingState(void);
+void frskyOsdDrawCharacter(int x, int y, uint16_t chr, uint8_t opts);
+void frskyOsdDrawCharacterMask(int x, int y, uint16_t chr, frskyOsdColor_e color, uint8_t opts);
+void frskyOsdDrawString(int x, int y, const char *s, uint8_t opts);
+void frskyOsdDrawStringMask(int x, int y, const char *s, frskyOsdColor_e color, uint8_t opts);
+void frskyOsdMoveToPoint(int x, int y);
+void frskyOsdStrokeLineToPoint(int x, int y);
+void frskyOsdStrokeTriangle(int x1, int y1, int x2, int y2, int x3, int y3);
+void frskyOsdFillTriangle(int x1, int y1, int x2, int y2, int x3, int y3);
+void frskyOsdFillStrokeTriangle(int x1, int y1, int x2, int y2, int x3, int y3);
+void frskyOsdStrokeRect(int x, int y, int w, int h);
+void frskyOsdFillRect(int x, int y, int w, int h);
+void frskyOsdFillStrokeRect(int x, int y, int w, int h);
+void frskyOsdStrokeEllipseInRect(int x, int y, int w, int h);
+void frskyOsdFillEllipseInRect(int x, int y, int w, int h);
+void frskyOsdFillStrokeEllipseInRect(int x, int y, int w, int h);
+
+void frskyOsdCtmReset(void);
+void frskyOsdCtmSet(float m11, float m12, float m21, float m22, float m31, float m32);
+void frskyOsdCtmTranslate(float tx, float ty);
+void frskyOsdCtmScale(float sx, float sy);
+void frskyOsdCtmRotate(float r);
+
+void frskyOsdContextPush(void);
+void frskyOsdContextPop(void);
+# 18 "./src/main/io/frsky_osd.c" 2
+# 1 "./src/main/io/serial.h" 1
+# 21 "./src/main/io/serial.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/serial.h" 1
+# 21 "./src/main/drivers/serial.h"
+       
+
+# 1 "./src/main/drivers/io.h" 1
+# 21 "./src/main/drivers/io.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/resource.h" 1
+# 21 "./src/main/drivers/resource.h"
+       
+
+typedef enum {
+    OWNER_FREE = 0,
+    OWNER_PWMINPUT,
+    OWNER_PPMINPUT,
+    OWNER_MOTOR,
+    OWNER_SERVO,
+    OWNER_LED,
+    OWNER_ADC,
+    OWNER_ADC_BATT,
+    OWNER_ADC_CURR,
+    OWNER_ADC_EXT,
+    OWNER_ADC_RSSI,
+    OWNER_SERIAL_TX,
+    OWNER_SERIAL_RX,
+    OWNER_PINDEBUG,
+    OWNER_TIMER,
+    OWNER_SONAR_TRIGGER,
+    OWNER_SONAR_ECHO,
+    OWNER_SYSTEM,
+    OWNER_SPI_SCK,
+    OWNER_SPI_MISO,
+    OWNER_SPI_MOSI,
+    OWNER_I2C_SCL,
+    OWNER_I2C_SDA,
+    OWNER_SDCARD,
+    OWNER_SDIO_CK,
+    OWNER_SDIO_CMD,
+    OWNER_SDIO_D0,
+    OWNER_SDIO_D1,
+    OWNER_SDIO_D2,
+    OWNER_SDIO_D3,
+    OWNER_SDCARD_CS,
+    OWNER_SDCARD_DETECT,
+    OWNER_FLASH_CS,
+    OWNER_BARO_CS,
+    OWNER_GYRO_CS,
+    OWNER_OSD_CS,
+    OWNER_RX_SPI_CS,
+    OWNER_SPI_CS,
+    OWNER_GYRO_EXTI,
+    OWNER_BARO_EOC,
+    OWNER_COMPASS_EXTI,
+    OWNER_USB,
+    OWNER_USB_DETECT,
+    OWNER_BEEPER,
+    OWNER_OSD,
+    OWNER_RX_BIND,
+    OWNER_INVERTER,
+    OWNER_LED_STRIP,
+    OWNER_COMPASS_CS,
+    OWNER_RX_BIND_PLUG,
+    OWNER_ESCSERIAL,
+    OWNER_CAMERA_CONTROL,
+    OWNER_TIMUP,
+    OWNER_RANGEFINDER,
+    OWNER_RX_SPI,
+    OWNER_PINIO,
+    OWNER_USB_MSC_PIN,
+    OWNER_MCO,
+    OWNER_RX_SPI_BIND,
+    OWNER_RX_SPI_LED,
+    OWNER_PREINIT,
+    OWNER_RX_SPI_EXTI,
+    OWNER_RX_SPI_CC2500_TX_EN,
+    OWNER_RX_SPI_CC2500_LNA_EN,
+    OWNER_RX_SPI_CC2500_ANT_SEL,
+    OWNER_QUADSPI_CLK,
+    OWNER_QUADSPI_BK1IO0,
+    OWNER_QUADSPI_BK1IO1,
+    OWNER_QUADSPI_BK1IO2,
+    OWNER_QUADSPI_BK1IO3,
+    OWNER_QUADSPI_BK1CS,
+    OWNER_QUADSPI_BK2IO0,
+    OWNER_QUADSPI_BK2IO1,
+    OWNER_QUADSPI_BK2IO2,
+    OWNER_QUADSPI_BK2IO3,
+    OWNER_QUADSPI_BK2CS,
+    OWNER_BARO_XCLR,
+    OWNER_PULLUP,
+    OWNER_PULLDOWN,
+    OWNER_DSHOT_BITBANG,
+    OWNER_SWD,
+    OWNER_FREQ,
+    OWNER_TOTAL_COUNT
+} resourceOwner_e;
+
+typedef struct resourceOwner_s {
+    resourceOwner_e owner;
+    uint8_t resourceIndex;
+} resourceOwner_t;
+
+extern const char * const ownerNames[OWNER_TOTAL_COUNT];
+# 29 "./src/main/drivers/io.h" 2
+
+# 1 "./src/main/drivers/io_types.h" 1
+# 21 "./src/main/drivers/io_types.h"
+       
+
+
+
+
+
+typedef uint8_t ioTag_t;
+typedef void* IO_t;
+# 48 "./src/main/drivers/io_types.h"
+typedef uint8_t ioConfig_t;
+# 31 "./src/main/drivers/io.h" 2
+# 110 "./src/main/drivers/io.h"
+# 1 "./src/main/drivers/io_def.h" 1
+# 21 "./src/main/drivers/io_def.h"
+       
+# 54 "./src/main/drivers/io_def.h"
+# 1 "./src/main/drivers/io_def_generated.h" 1
+# 21 "./src/main/drivers/io_def_generated.h"
+       
+# 55 "./src/main/drivers/io_def.h" 2
+# 111 "./src/main/drivers/io.h" 2
+
+
+# 112 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 112 "./src/main/drivers/io.h"
+    IORead(IO_t io);
+void IOWrite(IO_t io, 
+# 113 "./src/main/drivers/io.h" 3 4
+                     _Bool 
+# 113 "./src/main/drivers/io.h"
+                          value);
+void IOHi(IO_t io);
+void IOLo(IO_t io);
+void IOToggle(IO_t io);
+
+void IOInit(IO_t io, resourceOwner_e owner, uint8_t index);
+void IORelease(IO_t io);
+resourceOwner_e IOGetOwner(IO_t io);
+
+# 121 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 121 "./src/main/drivers/io.h"
+    IOIsFreeOrPreinit(IO_t io);
+IO_t IOGetByTag(ioTag_t tag);
+
+void IOConfigGPIO(IO_t io, ioConfig_t cfg);
+
+
+
+
+void IOInitGlobal(void);
+
+typedef void (*IOTraverseFuncPtr_t)(IO_t io);
+
+void IOTraversePins(IOTraverseFuncPtr_t func);
+# 24 "./src/main/drivers/serial.h" 2
+
+
+
+
+
+typedef enum {
+    MODE_RX = 1 << 0,
+    MODE_TX = 1 << 1,
+    MODE_RXTX = MODE_RX | MODE_TX
+} portMode_e;
+
+typedef enum {
+    SERIAL_NOT_INVERTED = 0 << 0,
+    SERIAL_INVERTED = 1 << 0,
+    SERIAL_STOPBITS_1 = 0 << 1,
+    SERIAL_STOPBITS_2 = 1 << 1,
+    SERIAL_PARITY_NO = 0 << 2,
+    SERIAL_PARITY_EVEN = 1 << 2,
+    SERIAL_UNIDIR = 0 << 3,
+    SERIAL_BIDIR = 1 << 3,
+# 52 "./src/main/drivers/serial.h"
+    SERIAL_BIDIR_OD = 0 << 4,
+    SERIAL_BIDIR_PP = 1 << 4,
+    SERIAL_BIDIR_NOPULL = 1 << 5,
+} portOptions_e;
+
+
+
+
+
+typedef void (*serialReceiveCallbackPtr)(uint16_t data, void *rxCallbackData);
+typedef void (*serialIdleCallbackPtr)();
+
+typedef struct serialPort_s {
+
+    const struct serialPortVTable *vTable;
+
+    portMode_e mode;
+    portOptions_e options;
+
+    uint32_t baudRate;
+
+    uint32_t rxBufferSize;
+    uint32_t txBufferSize;
+    volatile uint8_t *rxBuffer;
+    volatile uint8_t *txBuffer;
+    uint32_t rxBufferHead;
+    uint32_t rxBufferTail;
+    uint32_t txBufferHead;
+    uint32_t txBufferTail;
+
+    serialReceiveCallbackPtr rxCallback;
+    void *rxCallbackData;
+
+    serialIdleCallbackPtr idleCallback;
+
+    uint8_t identifier;
+} serialPort_t;
+# 100 "./src/main/drivers/serial.h"
+typedef struct serialPinConfig_s {
+    ioTag_t ioTagTx[10];
+    ioTag_t ioTagRx[10];
+    ioTag_t ioTagInverter[10];
+} serialPinConfig_t;
+
+extern serialPinConfig_t serialPinConfig_System; extern serialPinConfig_t serialPinConfig_Copy; static inline const serialPinConfig_t* serialPinConfig(void) { return &serialPinConfig_System; } static inline serialPinConfig_t* serialPinConfigMutable(void) { return &serialPinConfig_System; } struct _dummy;
+
+struct serialPortVTable {
+    void (*serialWrite)(serialPort_t *instance, uint8_t ch);
+
+    uint32_t (*serialTotalRxWaiting)(const serialPort_t *instance);
+    uint32_t (*serialTotalTxFree)(const serialPort_t *instance);
+
+    uint8_t (*serialRead)(serialPort_t *instance);
+
+
+    void (*serialSetBaudRate)(serialPort_t *instance, uint32_t baudRate);
+
+    
+# 119 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 119 "./src/main/drivers/serial.h"
+        (*isSerialTransmitBufferEmpty)(const serialPort_t *instance);
+
+    void (*setMode)(serialPort_t *instance, portMode_e mode);
+    void (*setCtrlLineStateCb)(serialPort_t *instance, void (*cb)(void *instance, uint16_t ctrlLineState), void *context);
+    void (*setBaudRateCb)(serialPort_t *instance, void (*cb)(serialPort_t *context, uint32_t baud), serialPort_t *context);
+
+    void (*writeBuf)(serialPort_t *instance, const void *data, int count);
+
+    void (*beginWrite)(serialPort_t *instance);
+    void (*endWrite)(serialPort_t *instance);
+
+    int (*readBuf)(serialPort_t *instance, uint8_t *data, int count);
+};
+
+void serialWrite(serialPort_t *instance, uint8_t ch);
+uint32_t serialRxBytesWaiting(const serialPort_t *instance);
+uint32_t serialTxBytesFree(const serialPort_t *instance);
+void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count);
+uint8_t serialRead(serialPort_t *instance);
+int serialReadBuf(serialPort_t *instance, uint8_t *data, int count);
+void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate);
+void serialSetMode(serialPort_t *instance, portMode_e mode);
+void serialSetCtrlLineStateCb(serialPort_t *instance, void (*cb)(void *context, uint16_t ctrlLineState), void *context);
+void serialSetBaudRateCb(serialPort_t *instance, void (*cb)(serialPort_t *context, uint32_t baud), serialPort_t *context);
+
+# 143 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 143 "./src/main/drivers/serial.h"
+    isSerialTransmitBufferEmpty(const serialPort_t *instance);
+void serialPrint(serialPort_t *instance, const char *str);
+uint32_t serialGetBaudRate(serialPort_t *instance);
+
+
+void serialWriteBufShim(void *instance, const uint8_t *data, int count);
+void serialBeginWrite(serialPort_t *instance);
+void serialEndWrite(serialPort_t *instance);
+# 28 "./src/main/io/serial.h" 2
+
+typedef enum {
+    PORTSHARING_UNUSED = 0,
+    PORTSHARING_NOT_SHARED,
+    PORTSHARING_SHARED
+} portSharing_e;
+
+typedef enum {
+    FUNCTION_NONE = 0,
+    FUNCTION_MSP = (1 << 0),
+    FUNCTION_GPS = (1 << 1),
+    FUNCTION_TELEMETRY_FRSKY_HUB = (1 << 2),
+    FUNCTION_TELEMETRY_HOTT = (1 << 3),
+    FUNCTION_TELEMETRY_LTM = (1 << 4),
+    FUNCTION_TELEMETRY_SMARTPORT = (1 << 5),
+    FUNCTION_RX_SERIAL = (1 << 6),
+    FUNCTION_BLACKBOX = (1 << 7),
+    FUNCTION_TELEMETRY_MAVLINK = (1 << 9),
+    FUNCTION_ESC_SENSOR = (1 << 10),
+    FUNCTION_TELEMETRY_IBUS = (1 << 12),
+    FUNCTION_LIDAR_TF = (1 << 15),
+    FUNCTION_FRSKY_OSD = (1 << 16),
+} serialPortFunction_e;
+
+
+
+
+typedef enum {
+    BAUD_AUTO = 0,
+    BAUD_9600,
+    BAUD_19200,
+    BAUD_38400,
+    BAUD_57600,
+    BAUD_115200,
+    BAUD_230400,
+    BAUD_250000,
+    BAUD_400000,
+    BAUD_460800,
+    BAUD_500000,
+    BAUD_921600,
+    BAUD_1000000,
+    BAUD_1500000,
+    BAUD_2000000,
+    BAUD_2470000
+} baudRate_e;
+
+extern const uint32_t baudRates[];
+
+
+typedef enum {
+    SERIAL_PORT_NONE = -1,
+    SERIAL_PORT_USART1 = 0,
+    SERIAL_PORT_USART2,
+    SERIAL_PORT_USART3,
+    SERIAL_PORT_UART4,
+    SERIAL_PORT_UART5,
+    SERIAL_PORT_USART6,
+    SERIAL_PORT_USART7,
+    SERIAL_PORT_USART8,
+    SERIAL_PORT_LPUART1,
+    SERIAL_PORT_USB_VCP = 20,
+    SERIAL_PORT_SOFTSERIAL1 = 30,
+    SERIAL_PORT_SOFTSERIAL2,
+    SERIAL_PORT_IDENTIFIER_MAX = SERIAL_PORT_SOFTSERIAL2
+} serialPortIdentifier_e;
+
+extern const serialPortIdentifier_e serialPortIdentifiers[8];
+# 103 "./src/main/io/serial.h"
+typedef struct serialPortUsage_s {
+    serialPort_t *serialPort;
+    serialPortFunction_e function;
+    serialPortIdentifier_e identifier;
+} serialPortUsage_t;
+
+serialPort_t *findSharedSerialPort(uint16_t functionMask, serialPortFunction_e sharedWithFunction);
+
+
+
+
+typedef struct serialPortConfig_s {
+    uint32_t functionMask;
+    serialPortIdentifier_e identifier;
+    uint8_t msp_baudrateIndex;
+    uint8_t gps_baudrateIndex;
+    uint8_t blackbox_baudrateIndex;
+    uint8_t telemetry_baudrateIndex;
+} serialPortConfig_t;
+
+typedef struct serialConfig_s {
+    serialPortConfig_t portConfigs[8];
+    uint16_t serial_update_rate_hz;
+    uint8_t reboot_character;
+} serialConfig_t;
+
+extern serialConfig_t serialConfig_System; extern serialConfig_t serialConfig_Copy; static inline const serialConfig_t* serialConfig(void) { return &serialConfig_System; } static inline serialConfig_t* serialConfigMutable(void) { return &serialConfig_System; } struct _dummy;
+
+typedef void serialConsumer(uint8_t);
+
+
+
+
+void serialInit(
+# 136 "./src/main/io/serial.h" 3 4
+               _Bool 
+# 136 "./src/main/io/serial.h"
+                    softserialEnabled, serialPortIdentifier_e serialPortToDisable);
+void serialRemovePort(serialPortIdentifier_e identifier);
+uint8_t serialGetAvailablePortCount(void);
+
+# 139 "./src/main/io/serial.h" 3 4
+_Bool 
+# 139 "./src/main/io/serial.h"
+    serialIsPortAvailable(serialPortIdentifier_e identifier);
+
+# 140 "./src/main/io/serial.h" 3 4
+_Bool 
+# 140 "./src/main/io/serial.h"
+    isSerialConfigValid(const serialConfig_t *serialConfig);
+const serialPortConfig_t *serialFindPortConfiguration(serialPortIdentifier_e identifier);
+serialPortConfig_t *serialFindPortConfigurationMutable(serialPortIdentifier_e identifier);
+
+# 143 "./src/main/io/serial.h" 3 4
+_Bool 
+# 143 "./src/main/io/serial.h"
+    doesConfigurationUsePort(serialPortIdentifier_e portIdentifier);
+const serialPortConfig_t *findSerialPortConfig(serialPortFunction_e function);
+const serialPortConfig_t *findNextSerialPortConfig(serialPortFunction_e function);
+
+portSharing_e determinePortSharing(const serialPortConfig_t *portConfig, serialPortFunction_e function);
+
+# 148 "./src/main/io/serial.h" 3 4
+_Bool 
+# 148 "./src/main/io/serial.h"
+    isSerialPortShared(const serialPortConfig_t *portConfig, uint16_t functionMask, serialPortFunction_e sharedWithFunction);
+
+void pgResetFn_serialConfig(serialConfig_t *serialConfig);
+serialPortUsage_t *findSerialPortUsageByIdentifier(serialPortIdentifier_e identifier);
+int findSerialPortIndexByIdentifier(serialPortIdentifier_e identifier);
+
+
+
+serialPort_t *openSerialPort(
+    serialPortIdentifier_e identifier,
+    serialPortFunction_e function,
+    serialReceiveCallbackPtr rxCallback,
+    void *rxCallbackData,
+    uint32_t baudrate,
+    portMode_e mode,
+    portOptions_e options
+);
+void closeSerialPort(serialPort_t *serialPort);
+
+void waitForSerialPortToFinishTransmitting(serialPort_t *serialPort);
+
+baudRate_e lookupBaudRateIndex(uint32_t baudRate);
+
+
+
+
+
+void serialPassthrough(serialPort_t *left, serialPort_t *right, serialConsumer *leftC, serialConsumer *rightC);
+# 19 "./src/main/io/frsky_osd.c" 2
+# 49 "./src/main/io/frsky_osd.c"
+typedef enum
+{
+    OSD_CMD_RESPONSE_ERROR = 0,
+
+    OSD_CMD_INFO = 1,
+    OSD_CMD_READ_FONT = 2,
+    OSD_CMD_WRITE_FONT = 3,
+    OSD_CMD_GET_CAMERA = 4,
+    OSD_CMD_SET_CAMERA = 5,
+    OSD_CMD_GET_ACTIVE_CAMERA = 6,
+    OSD_CMD_GET_OSD_ENABLED = 7,
+    OSD_CMD_SET_OSD_ENABLED = 8,
+
+    OSD_CMD_TRANSACTION_BEGIN = 16,
+    OSD_CMD_TRANSACTION_COMMIT = 17,
+    OSD_CMD_TRANSACTION_BEGIN_PROFILED = 18,
+    OSD_CMD_TRANSACTION_BEGIN_RESET_DRAWING = 19,
+
+    OSD_CMD_DRAWING_SET_STROKE_COLOR = 22,
+    OSD_CMD_DRAWING_SET_FILL_COLOR = 23,
+    OSD_CMD_DRAWING_SET_STROKE_AND_FILL_COLOR = 24,
+    OSD_CMD_DRAWING_SET_COLOR_INVERSION = 25,
+    OSD_CMD_DRAWING_SET_PIXEL = 26,
+    OSD_CMD_DRAWING_SET_PIXEL_TO_STROKE_COLOR = 27,
+    OSD_CMD_DRAWING_SET_PIXEL_TO_FILL_COLOR = 28,
+    OSD_CMD_DRAWING_SET_STROKE_WIDTH = 29,
+    OSD_CMD_DRAWING_SET_LINE_OUTLINE_TYPE = 30,
+    OSD_CMD_DRAWING_SET_LINE_OUTLINE_COLOR = 31,
+
+    OSD_CMD_DRAWING_CLIP_TO_RECT = 40,
+    OSD_CMD_DRAWING_CLEAR_SCREEN = 41,
+    OSD_CMD_DRAWING_CLEAR_RECT = 42,
+    OSD_CMD_DRAWING_RESET = 43,
+    OSD_CMD_DRAWING_DRAW_BITMAP = 44,
+    OSD_CMD_DRAWING_DRAW_BITMAP_MASK = 45,
+    OSD_CMD_DRAWING_DRAW_CHAR = 46,
+    OSD_CMD_DRAWING_DRAW_CHAR_MASK = 47,
+    OSD_CMD_DRAWING_DRAW_STRING = 48,
+    OSD_CMD_DRAWING_DRAW_STRING_MASK = 49,
+    OSD_CMD_DRAWING_MOVE_TO_POINT = 50,
+    OSD_CMD_DRAWING_STROKE_LINE_TO_POINT = 51,
+    OSD_CMD_DRAWING_STROKE_TRIANGLE = 52,
+    OSD_CMD_DRAWING_FILL_TRIANGLE = 53,
+    OSD_CMD_DRAWING_FILL_STROKE_TRIANGLE = 54,
+    OSD_CMD_DRAWING_STROKE_RECT = 55,
+    OSD_CMD_DRAWING_FILL_RECT = 56,
+    OSD_CMD_DRAWING_FILL_STROKE_RECT = 57,
+    OSD_CMD_DRAWING_STROKE_ELLIPSE_IN_RECT = 58,
+    OSD_CMD_DRAWING_FILL_ELLIPSE_IN_RECT = 59,
+    OSD_CMD_DRAWING_FILL_STROKE_ELLIPSE_IN_RECT = 60,
+
+    OSD_CMD_CTM_RESET = 80,
+    OSD_CMD_CTM_SET = 81,
+    OSD_CMD_CTM_TRANSLATE = 82,
+    OSD_CMD_CTM_SCALE = 83,
+    OSD_CMD_CTM_ROTATE = 84,
+    OSD_CMD_CTM_ROTATE_ABOUT = 85,
+    OSD_CMD_CTM_SHEAR = 86,
+    OSD_CMD_CTM_SHEAR_ABOUT = 87,
+    OSD_CMD_CTM_MULTIPLY = 88,
+
+    OSD_CMD_CONTEXT_PUSH = 100,
+    OSD_CMD_CONTEXT_POP = 101,
+
+
+    OSD_CMD_DRAW_GRID_CHR = 110,
+    OSD_CMD_DRAW_GRID_STR = 111,
+} osdCommand_e;
+
+typedef enum {
+    RECV_STATE_NONE,
+    RECV_STATE_SYNC,
+    RECV_STATE_LENGTH,
+    RECV_STATE_DATA,
+    RECV_STATE_CHECKSUM,
+    RECV_STATE_DONE,
+} frskyOsdRecvState_e;
+
+typedef struct frskyOsdInfoResponse_s {
+    uint8_t magic[3];
+    uint8_t versionMajor;
+    uint8_t versionMinor;
+    uint8_t versionPatch;
+    uint8_t gridRows;
+    uint8_t gridColumns;
+    uint16_t pixelWidth;
+    uint16_t pixelHeight;
+    uint8_t tvStandard;
+    uint8_t hasDetectedCamera;
+    uint16_t maxFrameSize;
+    uint8_t contextStackSize;
+} __attribute__((packed)) frskyOsdInfoResponse_t;
+
+typedef struct frskyOsdFontCharacter_s {
+    uint16_t addr;
+    struct {
+        uint8_t bitmap[54];
+        uint8_t metadata[10];
+    } data;
+} __attribute__((packed)) frskyOsdCharacter_t;
+
+typedef struct frskyOsdDrawGridCharCmd_s {
+    uint8_t gx;
+    uint8_t gy;
+    uint16_t chr;
+    uint8_t opts;
+} __attribute__((packed)) frskyOsdDrawGridCharCmd_t;
+
+typedef struct frskyOsdDrawGridStrHeaderCmd_s {
+    uint8_t gx;
+    uint8_t gy;
+    uint8_t opts;
+
+} __attribute__((packed)) frskyOsdDrawGridStrHeaderCmd_t;
+
+typedef struct frskyOsdPoint_s {
+    int x : 12;
+    int y : 12;
+} __attribute__((packed)) frskyOsdPoint_t;
+
+typedef struct frskyOsdSize_s {
+    int w : 12;
+    int h : 12;
+} __attribute__((packed)) frskyOsdSize_t;
+
+typedef struct frskyOsdRect_s {
+    frskyOsdPoint_t origin;
+    frskyOsdSize_t size;
+} __attribute__((packed)) frskyOsdRect_t;
+
+typedef struct frskyOsdTriangle_s {
+    frskyOsdPoint_t p1;
+    frskyOsdPoint_t p2;
+    frskyOsdPoint_t p3;
+} __attribute__((packed)) frskyOsdTriangle_t;
+
+typedef struct frskyOsdSetPixel_s {
+    frskyOsdPoint_t p;
+    uint8_t color;
+} __attribute__((packed)) frskyOsdSetPixel_t;
+
+typedef struct frskyOsdDrawCharacterCmd_s {
+    frskyOsdPoint_t p;
+    uint16_t chr;
+    uint8_t opts;
+} __attribute__((packed)) frskyOsdDrawCharacterCmd_t;
+
+typedef struct frskyOsdDrawCharacterMaskCmd_s {
+    frskyOsdDrawCharacterCmd_t dc;
+    uint8_t maskColor;
+} __attribute__((packed)) frskyOsdDrawCharacterMaskCmd_t;
+
+typedef struct frskyOsdDrawStrCommandHeaderCmd_s {
+    frskyOsdPoint_t p;
+    uint8_t opts;
+
+} __attribute__((packed)) frskyOsdDrawStrCommandHeaderCmd_t;
+
+typedef struct frskyOsdDrawStrMaskCommandHeaderCmd_s {
+    frskyOsdPoint_t p;
+    uint8_t opts;
+    uint8_t maskColor;
+
+} __attribute__((packed)) frskyOsdDrawStrMaskCommandHeaderCmd_t;
+
+
+typedef struct frskyOsdState_s {
+    struct {
+        uint8_t data[192];
+        uint8_t pos;
+    } sendBuffer;
+    struct {
+        uint8_t state;
+        uint8_t crc;
+        uint16_t expected;
+        uint8_t expectedShift;
+        uint8_t data[128];
+        uint8_t pos;
+    } recvBuffer;
+    struct {
+        uint8_t major;
+        uint8_t minor;
+        timeMs_t nextRequest;
+        struct {
+            uint8_t rows;
+            uint8_t columns;
+        } grid;
+        struct {
+            uint16_t width;
+            uint16_t height;
+        } viewport;
+    } info;
+    struct {
+        uint16_t addr;
+        osdCharacter_t *chr;
+    } recvOsdCharacter;
+    serialPort_t *port;
+    
+# 246 "./src/main/io/frsky_osd.c" 3 4
+   _Bool 
+# 246 "./src/main/io/frsky_osd.c"
+        initialized;
+    timeMs_t nextInfoRequest;
+} frskyOsdState_t;
+
+static frskyOsdState_t state;
+
+static uint8_t frskyOsdChecksum(uint8_t crc, uint8_t c)
+{
+    return crc8_dvb_s2(crc, c);
+}
+
+static void frskyOsdResetReceiveBuffer(void)
+{
+    state.recvBuffer.state = RECV_STATE_NONE;
+    state.recvBuffer.crc = 0;
+    state.recvBuffer.expected = 0;
+    state.recvBuffer.expectedShift = 0;
+    state.recvBuffer.pos = 0;
+}
+
+static void frskyOsdResetSendBuffer(void)
+{
+    state.sendBuffer.pos = 0;
+}
+
+static void frskyOsdProcessCommandU8(uint8_t *crc, uint8_t c)
+{
+    while (serialTxBytesFree(state.port) == 0) {
+    };
+    serialWrite(state.port, c);
+    if (crc) {
+        *crc = crc8_dvb_s2(*crc, c);
+    }
+}
+
+static void frskyOsdSendCommand(uint8_t cmd, const void *payload, size_t size)
+{
+    int required = size + 1;
+    ;
+    int rem = sizeof(state.sendBuffer.data) - state.sendBuffer.pos;
+    if (rem < required) {
+        frskyOsdFlushSendBuffer();
+    }
+    state.sendBuffer.data[state.sendBuffer.pos++] = cmd;
+    const uint8_t *ptr = payload;
+    for (size_t ii = 0; ii < size; ii++, ptr++) {
+        state.sendBuffer.data[state.sendBuffer.pos++] = *ptr;
+    }
+}
+
+static void frskyOsdStateReset(serialPort_t *port)
+{
+    frskyOsdResetReceiveBuffer();
+    frskyOsdResetSendBuffer();
+    state.info.grid.rows = 0;
+    state.info.grid.columns = 0;
+    state.info.viewport.width = 0;
+    state.info.viewport.height = 0;
+
+    state.port = port;
+    state.initialized = 
+# 306 "./src/main/io/frsky_osd.c" 3 4
+                       0
+# 306 "./src/main/io/frsky_osd.c"
+                            ;
+}
+
+static void frskyOsdUpdateReceiveBuffer(void)
+{
+    while (serialRxBytesWaiting(state.port) > 0) {
+        uint8_t c = serialRead(state.port);
+        switch ((frskyOsdRecvState_e)state.recvBuffer.state) {
+        case RECV_STATE_NONE:
+            if (c != '$') {
+                break;
+            }
+            state.recvBuffer.state = RECV_STATE_SYNC;
+            break;
+        case RECV_STATE_SYNC:
+            if (c != 'A') {
+                frskyOsdResetReceiveBuffer();
+                break;
+            }
+            state.recvBuffer.state = RECV_STATE_LENGTH;
+            break;
+        case RECV_STATE_LENGTH:
+            state.recvBuffer.crc = frskyOsdChecksum(state.recvBuffer.crc, c);
+            state.recvBuffer.expected |= (c & 0x7F) << state.recvBuffer.expectedShift;
+            state.recvBuffer.expectedShift += 7;
+            if (c < 0x80) {
+
+                if (state.recvBuffer.expected > sizeof(state.recvBuffer.data)) {
+                   
+                                                                                 ;
+                    frskyOsdResetReceiveBuffer();
+                    break;
+                }
+                ;
+                state.recvBuffer.state = state.recvBuffer.expected > 0 ? RECV_STATE_DATA : RECV_STATE_CHECKSUM;
+            }
+            break;
+        case RECV_STATE_DATA:
+            state.recvBuffer.data[state.recvBuffer.pos++] = c;
+            state.recvBuffer.crc = frskyOsdChecksum(state.recvBuffer.crc, c);
+            if (state.recvBuffer.pos == state.recvBuffer.expected) {
+                state.recvBuffer.state = RECV_STATE_CHECKSUM;
+            }
+            break;
+        case RECV_STATE_CHECKSUM:
+            if (c != state.recvBuffer.crc) {
+               
+                                                                  ;
+                frskyOsdResetReceiveBuffer();
+                break;
+            }
+            state.recvBuffer.state = RECV_STATE_DONE;
+            break;
+        case RECV_STATE_DONE:
+            ;
+            break;
+        }
+    }
+}
+
+static 
+# 366 "./src/main/io/frsky_osd.c" 3 4
+      _Bool 
+# 366 "./src/main/io/frsky_osd.c"
+           frskyOsdIsResponseAvailable(void)
+{
+    return state.recvBuffer.state == RECV_STATE_DONE;
+}
+
+static 
+# 371 "./src/main/io/frsky_osd.c" 3 4
+      _Bool 
+# 371 "./src/main/io/frsky_osd.c"
+           frskyOsdHandleCommand(osdCommand_e cmd, const void *payload, size_t size)
+{
+    switch (cmd) {
+        case OSD_CMD_RESPONSE_ERROR:
+        {
+            if (size >= 2) {
+                ;
+                return 
+# 378 "./src/main/io/frsky_osd.c" 3 4
+                      1
+# 378 "./src/main/io/frsky_osd.c"
+                          ;
+            }
+            break;
+        }
+        case OSD_CMD_INFO:
+        {
+            if (size < sizeof(frskyOsdInfoResponse_t)) {
+                break;
+            }
+            const frskyOsdInfoResponse_t *resp = payload;
+            if (resp->magic[0] != 'A' || resp->magic[1] != 'G' || resp->magic[2] != 'H') {
+               
+                                                                   ;
+                return 
+# 391 "./src/main/io/frsky_osd.c" 3 4
+                      0
+# 391 "./src/main/io/frsky_osd.c"
+                           ;
+            }
+            state.info.major = resp->versionMajor;
+            state.info.minor = resp->versionMinor;
+            state.info.grid.rows = resp->gridRows;
+            state.info.grid.columns = resp->gridColumns;
+            state.info.viewport.width = resp->pixelWidth;
+            state.info.viewport.height = resp->pixelHeight;
+            if (!state.initialized) {
+               
+
+                                                                                           ;
+                state.initialized = 
+# 403 "./src/main/io/frsky_osd.c" 3 4
+                                   1
+# 403 "./src/main/io/frsky_osd.c"
+                                       ;
+                frskyOsdClearScreen();
+                frskyOsdResetDrawingState();
+            }
+            return 
+# 407 "./src/main/io/frsky_osd.c" 3 4
+                  1
+# 407 "./src/main/io/frsky_osd.c"
+                      ;
+        }
+        case OSD_CMD_READ_FONT:
+        {
+            if (!state.recvOsdCharacter.chr) {
+                ;
+                break;
+            }
+            if (size < sizeof(uint16_t) + (54 + 10)) {
+                ;
+                break;
+            }
+            const frskyOsdCharacter_t *chr = payload;
+            state.recvOsdCharacter.addr = chr->addr;
+            ;
+
+            memcpy(state.recvOsdCharacter.chr->data, &chr->data, __extension__ ({ __typeof__ (sizeof(state.recvOsdCharacter.chr->data)) _a = (sizeof(state.recvOsdCharacter.chr->data)); __typeof__ ((size_t)(54 + 10)) _b = ((size_t)(54 + 10)); _a < _b ? _a : _b; }));
+            return 
+# 424 "./src/main/io/frsky_osd.c" 3 4
+                  1
+# 424 "./src/main/io/frsky_osd.c"
+                      ;
+        }
+        case OSD_CMD_WRITE_FONT:
+        {
+
+            return 
+# 429 "./src/main/io/frsky_osd.c" 3 4
+                  1
+# 429 "./src/main/io/frsky_osd.c"
+                      ;
+        }
+        default:
+            break;
+    }
+    return 
+# 434 "./src/main/io/frsky_osd.c" 3 4
+          0
+# 434 "./src/main/io/frsky_osd.c"
+               ;
+}
+
+static 
+# 437 "./src/main/io/frsky_osd.c" 3 4
+      _Bool 
+# 437 "./src/main/io/frsky_osd.c"
+           frskyOsdDispatchResponse(void)
+{
+    const uint8_t *payload = state.recvBuffer.data;
+    int remaining = (int)state.recvBuffer.pos;
+    
+# 441 "./src/main/io/frsky_osd.c" 3 4
+   _Bool 
+# 441 "./src/main/io/frsky_osd.c"
+        ok = 
+# 441 "./src/main/io/frsky_osd.c" 3 4
+             0
+# 441 "./src/main/io/frsky_osd.c"
+                  ;
+    if (remaining > 0) {
+
+
+        uint8_t cmd = *payload;
+        payload++;
+        remaining--;
+        if (frskyOsdHandleCommand(cmd, payload, remaining)) {
+            ok = 
+# 449 "./src/main/io/frsky_osd.c" 3 4
+                1
+# 449 "./src/main/io/frsky_osd.c"
+                    ;
+        } else {
+            ;
+        }
+    }
+    frskyOsdResetReceiveBuffer();
+    return ok;
+}
+
+static void frskyOsdClearReceiveBuffer(void)
+{
+    frskyOsdUpdateReceiveBuffer();
+
+    if (frskyOsdIsResponseAvailable()) {
+        frskyOsdDispatchResponse();
+    } else if (state.recvBuffer.pos > 0) {
+        ;
+        frskyOsdResetReceiveBuffer();
+    }
+}
+
+static void frskyOsdSendAsyncCommand(uint8_t cmd, const void *data, size_t size)
+{
+    ;
+    frskyOsdSendCommand(cmd, data, size);
+}
+
+static 
+# 476 "./src/main/io/frsky_osd.c" 3 4
+      _Bool 
+# 476 "./src/main/io/frsky_osd.c"
+           frskyOsdSendSyncCommand(uint8_t cmd, const void *data, size_t size, timeMs_t timeout)
+{
+    ;
+    frskyOsdClearReceiveBuffer();
+    frskyOsdSendCommand(cmd, data, size);
+    frskyOsdFlushSendBuffer();
+    timeMs_t end = millis() + timeout;
+    while (millis() < end) {
+        frskyOsdUpdateReceiveBuffer();
+        if (frskyOsdIsResponseAvailable() && frskyOsdDispatchResponse()) {
+            ;
+            return 
+# 487 "./src/main/io/frsky_osd.c" 3 4
+                  1
+# 487 "./src/main/io/frsky_osd.c"
+                      ;
+        }
+    }
+    ;
+    return 
+# 491 "./src/main/io/frsky_osd.c" 3 4
+          0
+# 491 "./src/main/io/frsky_osd.c"
+               ;
+}
+
+static 
+# 494 "./src/main/io/frsky_osd.c" 3 4
+      _Bool 
+# 494 "./src/main/io/frsky_osd.c"
+           frskyOsdShouldRequestInfo(void)
+{
+    return !frskyOsdIsReady() || millis() > state.nextInfoRequest;
+}
+
+static void frskyOsdRequestInfo(void)
+{
+    timeMs_t now = millis();
+    if (state.info.nextRequest < now) {
+        uint8_t version = 1;
+        frskyOsdSendAsyncCommand(OSD_CMD_INFO, &version, sizeof(version));
+        frskyOsdFlushSendBuffer();
+        state.info.nextRequest = now + 1000;
+    }
+}
+
+
+# 510 "./src/main/io/frsky_osd.c" 3 4
+_Bool 
+# 510 "./src/main/io/frsky_osd.c"
+    frskyOsdInit(videoSystem_e videoSystem)
+{
+    (void)(videoSystem);
+    ;
+
+
+    const serialPortConfig_t *portConfig = findSerialPortConfig(FUNCTION_FRSKY_OSD);
+    if (portConfig) {
+        ;
+        portOptions_e portOptions = 0;
+        serialPort_t *port = openSerialPort(portConfig->identifier,
+            FUNCTION_FRSKY_OSD, 
+# 521 "./src/main/io/frsky_osd.c" 3 4
+                               ((void *)0)
+# 521 "./src/main/io/frsky_osd.c"
+                                   , 
+# 521 "./src/main/io/frsky_osd.c" 3 4
+                                     ((void *)0)
+# 521 "./src/main/io/frsky_osd.c"
+                                         , 115200,
+            MODE_RXTX, portOptions);
+
+        if (port) {
+            frskyOsdStateReset(port);
+            frskyOsdRequestInfo();
+            return 
+# 527 "./src/main/io/frsky_osd.c" 3 4
+                  1
+# 527 "./src/main/io/frsky_osd.c"
+                      ;
+        }
+    }
+    return 
+# 530 "./src/main/io/frsky_osd.c" 3 4
+          0
+# 530 "./src/main/io/frsky_osd.c"
+               ;
+}
+
+
+# 533 "./src/main/io/frsky_osd.c" 3 4
+_Bool 
+# 533 "./src/main/io/frsky_osd.c"
+    frskyOsdIsReady(void)
+{
+    return state.info.minor > 0 || state.info.major > 0;
+}
+
+void frskyOsdUpdate(void)
+{
+    if (!state.port) {
+        return;
+    }
+    frskyOsdUpdateReceiveBuffer();
+
+    if (frskyOsdIsResponseAvailable()) {
+        frskyOsdDispatchResponse();
+    }
+
+    if (frskyOsdShouldRequestInfo()) {
+        frskyOsdRequestInfo();
+    }
+}
+
+void frskyOsdBeginTransaction(frskyOsdTransactionOptions_e opts)
+{
+    if (opts & FRSKY_OSD_TRANSACTION_OPT_PROFILED) {
+        frskyOsdPoint_t p = { .x = 0, .y = 10};
+        frskyOsdSendAsyncCommand(OSD_CMD_TRANSACTION_BEGIN_PROFILED, &p, sizeof(p));
+        if (opts & FRSKY_OSD_TRANSACTION_OPT_RESET_DRAWING) {
+            frskyOsdResetDrawingState();
+        }
+    } else if (opts & FRSKY_OSD_TRANSACTION_OPT_RESET_DRAWING) {
+        frskyOsdSendAsyncCommand(OSD_CMD_TRANSACTION_BEGIN_RESET_DRAWING, 
+# 563 "./src/main/io/frsky_osd.c" 3 4
+                                                                         ((void *)0)
+# 563 "./src/main/io/frsky_osd.c"
+                                                                             , 0);
+    } else {
+        frskyOsdSendAsyncCommand(OSD_CMD_TRANSACTION_BEGIN, 
+# 565 "./src/main/io/frsky_osd.c" 3 4
+                                                           ((void *)0)
+# 565 "./src/main/io/frsky_osd.c"
+                                                               , 0);
+    }
+}
+
+void frskyOsdCommitTransaction(void)
+{
+
+
+
+    if (state.sendBuffer.pos == 1) {
+        if (state.sendBuffer.data[0] == OSD_CMD_TRANSACTION_BEGIN ||
+            state.sendBuffer.data[0] == OSD_CMD_TRANSACTION_BEGIN_RESET_DRAWING) {
+
+            state.sendBuffer.pos = 0;
+            return;
+        }
+    }
+    frskyOsdSendAsyncCommand(OSD_CMD_TRANSACTION_COMMIT, 
+# 582 "./src/main/io/frsky_osd.c" 3 4
+                                                        ((void *)0)
+# 582 "./src/main/io/frsky_osd.c"
+                                                            , 0);
+    frskyOsdFlushSendBuffer();
+}
+
+void frskyOsdFlushSendBuffer(void)
+{
+    if (state.sendBuffer.pos > 0) {
+        frskyOsdProcessCommandU8(
+# 589 "./src/main/io/frsky_osd.c" 3 4
+                                ((void *)0)
+# 589 "./src/main/io/frsky_osd.c"
+                                    , '$');
+        frskyOsdProcessCommandU8(
+# 590 "./src/main/io/frsky_osd.c" 3 4
+                                ((void *)0)
+# 590 "./src/main/io/frsky_osd.c"
+                                    , 'A');
+
+        uint8_t crc = 0;
+        uint8_t buffer[4];
+        int lengthSize = uvarintEncode(state.sendBuffer.pos, buffer, sizeof(buffer));
+        for (int ii = 0; ii < lengthSize; ii++) {
+            frskyOsdProcessCommandU8(&crc, buffer[ii]);
+        }
+        for (unsigned ii = 0; ii < state.sendBuffer.pos; ii++) {
+            frskyOsdProcessCommandU8(&crc, state.sendBuffer.data[ii]);
+        }
+        frskyOsdProcessCommandU8(
+# 601 "./src/main/io/frsky_osd.c" 3 4
+                                ((void *)0)
+# 601 "./src/main/io/frsky_osd.c"
+                                    , crc);
+        state.sendBuffer.pos = 0;
+    }
+}
+
+
+# 606 "./src/main/io/frsky_osd.c" 3 4
+_Bool 
+# 606 "./src/main/io/frsky_osd.c"
+    frskyOsdReadFontCharacter(unsigned char_address, osdCharacter_t *chr)
+{
+    uint16_t addr = char_address;
+
+    state.recvOsdCharacter.addr = 
+# 610 "./src/main/io/frsky_osd.c" 3 4
+                                 (65535)
+# 610 "./src/main/io/frsky_osd.c"
+                                           ;
+    state.recvOsdCharacter.chr = chr;
+
+
+    
+# 614 "./src/main/io/frsky_osd.c" 3 4
+   _Bool 
+# 614 "./src/main/io/frsky_osd.c"
+        ok = frskyOsdSendSyncCommand(OSD_CMD_READ_FONT, &addr, sizeof(addr), 500);
+
+    state.recvOsdCharacter.chr = 
+# 616 "./src/main/io/frsky_osd.c" 3 4
+                                ((void *)0)
+# 616 "./src/main/io/frsky_osd.c"
+                                    ;
+
+    if (ok && state.recvOsdCharacter.addr == addr) {
+        return 
+# 619 "./src/main/io/frsky_osd.c" 3 4
+              1
+# 619 "./src/main/io/frsky_osd.c"
+                  ;
+    }
+    return 
+# 621 "./src/main/io/frsky_osd.c" 3 4
+          0
+# 621 "./src/main/io/frsky_osd.c"
+               ;
+}
+
+
+# 624 "./src/main/io/frsky_osd.c" 3 4
+_Bool 
+# 624 "./src/main/io/frsky_osd.c"
+    frskyOsdWriteFontCharacter(unsigned char_address, const osdCharacter_t *chr)
+{
+    frskyOsdCharacter_t c;
+    _Static_assert((sizeof(*chr) == sizeof(c.data)), "invalid_character_size");
+
+    memcpy(&c.data, chr, sizeof(c.data));
+    c.addr = char_address;
+    ;
+    frskyOsdSendSyncCommand(OSD_CMD_WRITE_FONT, &c, sizeof(c), 1000);
+    return 
+# 633 "./src/main/io/frsky_osd.c" 3 4
+          1
+# 633 "./src/main/io/frsky_osd.c"
+              ;
+}
+
+unsigned frskyOsdGetGridRows(void)
+{
+    return state.info.grid.rows;
+}
+
+unsigned frskyOsdGetGridCols(void)
+{
+    return state.info.grid.columns;
+}
+
+unsigned frskyOsdGetPixelWidth(void)
+{
+    return state.info.viewport.width;
+}
+
+unsigned frskyOsdGetPixelHeight(void)
+{
+    return state.info.viewport.height;
+}
+
+static void frskyOsdSendCharInGrid(unsigned x, unsigned y, uint16_t chr)
+{
+    uint8_t payload[] = {
+        x,
+        y,
+        chr & 0xFF,
+        chr >> 8,
+        0,
+    };
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAW_GRID_CHR, payload, sizeof(payload));
+}
+
+static void frskyOsdSendAsyncBlobCommand(uint8_t cmd, const void *header, size_t headerSize, const void *blob, size_t blobSize)
+{
+    uint8_t payload[128];
+
+    memcpy(payload, header, headerSize);
+
+    int uvarintSize = uvarintEncode(blobSize, &payload[headerSize], sizeof(payload) - headerSize);
+    memcpy(&payload[headerSize + uvarintSize], blob, blobSize);
+    frskyOsdSendAsyncCommand(cmd, payload, headerSize + uvarintSize + blobSize);
+}
+
+void frskyOsdDrawStringInGrid(unsigned x, unsigned y, const char *buff)
+{
+    frskyOsdDrawGridStrHeaderCmd_t cmd;
+    cmd.gx = x;
+    cmd.gy = y;
+    cmd.opts = 0;
+
+    frskyOsdSendAsyncBlobCommand(OSD_CMD_DRAW_GRID_STR, &cmd, sizeof(cmd), buff, strlen(buff) + 1);
+}
+
+void frskyOsdDrawCharInGrid(unsigned x, unsigned y, uint16_t chr)
+{
+    frskyOsdSendCharInGrid(x, y, chr);
+}
+
+void frskyOsdClearScreen(void)
+{
+    if (!frskyOsdIsReady()) {
+        return;
+    }
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_CLEAR_SCREEN, 
+# 699 "./src/main/io/frsky_osd.c" 3 4
+                                                          ((void *)0)
+# 699 "./src/main/io/frsky_osd.c"
+                                                              , 0);
+}
+
+void frskyOsdSetStrokeColor(frskyOsdColor_e color)
+{
+    uint8_t c = color;
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_SET_STROKE_COLOR, &c, sizeof(c));
+}
+
+void frskyOsdSetFillColor(frskyOsdColor_e color)
+{
+    uint8_t c = color;
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_SET_FILL_COLOR, &c, sizeof(c));
+}
+
+void frskyOsdSetStrokeAndFillColor(frskyOsdColor_e color)
+{
+    uint8_t c = color;
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_SET_STROKE_AND_FILL_COLOR, &c, sizeof(c));
+}
+
+void frskyOsdSetColorInversion(
+# 720 "./src/main/io/frsky_osd.c" 3 4
+                              _Bool 
+# 720 "./src/main/io/frsky_osd.c"
+                                   inverted)
+{
+    uint8_t c = inverted ? 1 : 0;
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_SET_COLOR_INVERSION, &c, sizeof(c));
+}
+
+void frskyOsdSetPixel(int x, int y, frskyOsdColor_e color)
+{
+    frskyOsdSetPixel_t sp = {.p = {.x = x, .y = y}, .color = color};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_SET_PIXEL, &sp, sizeof(sp));
+}
+
+void frskyOsdSetPixelToStrokeColor(int x, int y)
+{
+    frskyOsdPoint_t p = { .x = x, .y = y};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_SET_PIXEL_TO_STROKE_COLOR, &p, sizeof(p));
+}
+
+void frskyOsdSetPixelToFillColor(int x, int y)
+{
+    frskyOsdPoint_t p = { .x = x, .y = y};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_SET_PIXEL_TO_FILL_COLOR, &p, sizeof(p));
+}
+
+void frskyOsdSetStrokeWidth(unsigned width)
+{
+    uint8_t w = width;
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_SET_STROKE_WIDTH, &w, sizeof(w));
+}
+
+void frskyOsdSetLineOutlineType(frskyOsdLineOutlineType_e outlineType)
+{
+    uint8_t type = outlineType;
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_SET_LINE_OUTLINE_TYPE, &type, sizeof(type));
+}
+
+void frskyOsdSetLineOutlineColor(frskyOsdColor_e outlineColor)
+{
+    uint8_t color = outlineColor;
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_SET_LINE_OUTLINE_COLOR, &color, sizeof(color));
+}
+
+void frskyOsdClipToRect(int x, int y, int w, int h)
+{
+    frskyOsdRect_t r = { .origin = { .x = x, .y = y}, .size = {.w = w, .h = h}};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_CLIP_TO_RECT, &r, sizeof(r));
+}
+
+void frskyOsdClearRect(int x, int y, int w, int h)
+{
+    frskyOsdRect_t r = { .origin = { .x = x, .y = y}, .size = {.w = w, .h = h}};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_CLEAR_RECT, &r, sizeof(r));
+}
+
+void frskyOsdResetDrawingState(void)
+{
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_RESET, 
+# 776 "./src/main/io/frsky_osd.c" 3 4
+                                                   ((void *)0)
+# 776 "./src/main/io/frsky_osd.c"
+                                                       , 0);
+}
+
+void frskyOsdDrawCharacter(int x, int y, uint16_t chr, uint8_t opts)
+{
+    frskyOsdDrawCharacterCmd_t dc = { .p = {.x = x, .y = y}, .chr = chr, .opts = opts};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_DRAW_CHAR, &dc, sizeof(dc));
+}
+
+void frskyOsdDrawCharacterMask(int x, int y, uint16_t chr, frskyOsdColor_e color, uint8_t opts)
+{
+    frskyOsdDrawCharacterMaskCmd_t dc = { .dc = { .p = {.x = x, .y = y}, .chr = chr, .opts = opts}, .maskColor = color};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_DRAW_CHAR_MASK, &dc, sizeof(dc));
+}
+
+void frskyOsdDrawString(int x, int y, const char *s, uint8_t opts)
+{
+    frskyOsdDrawStrCommandHeaderCmd_t cmd;
+    cmd.p.x = x;
+    cmd.p.y = y;
+    cmd.opts = opts;
+
+    frskyOsdSendAsyncBlobCommand(OSD_CMD_DRAWING_DRAW_STRING, &cmd, sizeof(cmd), s, strlen(s) + 1);
+}
+
+void frskyOsdDrawStringMask(int x, int y, const char *s, frskyOsdColor_e color, uint8_t opts)
+{
+    frskyOsdDrawStrMaskCommandHeaderCmd_t cmd;
+    cmd.p.x = x;
+    cmd.p.y = y;
+    cmd.opts = opts;
+    cmd.maskColor = color;
+
+    frskyOsdSendAsyncBlobCommand(OSD_CMD_DRAWING_DRAW_STRING_MASK, &cmd, sizeof(cmd), s, strlen(s) + 1);
+}
+
+void frskyOsdMoveToPoint(int x, int y)
+{
+    frskyOsdPoint_t p = { .x = x, .y = y};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_MOVE_TO_POINT, &p, sizeof(p));
+}
+
+void frskyOsdStrokeLineToPoint(int x, int y)
+{
+    frskyOsdPoint_t p = { .x = x, .y = y};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_STROKE_LINE_TO_POINT, &p, sizeof(p));
+}
+
+void frskyOsdStrokeTriangle(int x1, int y1, int x2, int y2, int x3, int y3)
+{
+    frskyOsdTriangle_t t = {.p1 = {.x = x1, .y = y1}, .p2 = {.x = x2, .y = y2}, .p3 = { .x = x3, .y = y3}};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_STROKE_TRIANGLE, &t, sizeof(t));
+}
+
+void frskyOsdFillTriangle(int x1, int y1, int x2, int y2, int x3, int y3)
+{
+    frskyOsdTriangle_t t = {.p1 = {.x = x1, .y = y1}, .p2 = {.x = x2, .y = y2}, .p3 = { .x = x3, .y = y3}};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_FILL_TRIANGLE, &t, sizeof(t));
+}
+
+void frskyOsdFillStrokeTriangle(int x1, int y1, int x2, int y2, int x3, int y3)
+{
+    frskyOsdTriangle_t t = {.p1 = {.x = x1, .y = y1}, .p2 = {.x = x2, .y = y2}, .p3 = { .x = x3, .y = y3}};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_FILL_STROKE_TRIANGLE, &t, sizeof(t));
+}
+
+void frskyOsdStrokeRect(int x, int y, int w, int h)
+{
+    frskyOsdRect_t r = { .origin = { .x = x, .y = y}, .size = {.w = w, .h = h}};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_STROKE_RECT, &r, sizeof(r));
+}
+
+void frskyOsdFillRect(int x, int y, int w, int h)
+{
+    frskyOsdRect_t r = { .origin = { .x = x, .y = y}, .size = {.w = w, .h = h}};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_FILL_RECT, &r, sizeof(r));
+}
+
+void frskyOsdFillStrokeRect(int x, int y, int w, int h)
+{
+    frskyOsdRect_t r = { .origin = { .x = x, .y = y}, .size = {.w = w, .h = h}};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_FILL_STROKE_RECT, &r, sizeof(r));
+}
+
+void frskyOsdStrokeEllipseInRect(int x, int y, int w, int h)
+{
+    frskyOsdRect_t r = { .origin = { .x = x, .y = y}, .size = {.w = w, .h = h}};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_STROKE_ELLIPSE_IN_RECT, &r, sizeof(r));
+}
+
+void frskyOsdFillEllipseInRect(int x, int y, int w, int h)
+{
+    frskyOsdRect_t r = { .origin = { .x = x, .y = y}, .size = {.w = w, .h = h}};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_FILL_ELLIPSE_IN_RECT, &r, sizeof(r));
+}
+
+void frskyOsdFillStrokeEllipseInRect(int x, int y, int w, int h)
+{
+    frskyOsdRect_t r = { .origin = { .x = x, .y = y}, .size = {.w = w, .h = h}};
+    frskyOsdSendAsyncCommand(OSD_CMD_DRAWING_FILL_STROKE_ELLIPSE_IN_RECT, &r, sizeof(r));
+}
+
+void frskyOsdCtmReset(void)
+{
+    frskyOsdSendAsyncCommand(OSD_CMD_CTM_RESET, 
+# 880 "./src/main/io/frsky_osd.c" 3 4
+                                               ((void *)0)
+# 880 "./src/main/io/frsky_osd.c"
+                                                   , 0);
+}
+
+void frskyOsdCtmSet(float m11, float m12, float m21, float m22, float m31, float m32)
+{
+    float values[] = {
+        m11, m12,
+        m21, m22,
+        m31, m32,
+    };
+    frskyOsdSendAsyncCommand(OSD_CMD_CTM_SET, values, sizeof(values));
+}
+
+void frskyOsdCtmTranslate(float tx, float ty)
+{
+    float values[] = {
+        tx,
+        ty,
+    };
+    frskyOsdSendAsyncCommand(OSD_CMD_CTM_TRANSLATE, values, sizeof(values));
+}
+
+void frskyOsdCtmScale(float sx, float sy)
+{
+    float values[] = {
+        sx,
+        sy,
+    };
+    frskyOsdSendAsyncCommand(OSD_CMD_CTM_SCALE, values, sizeof(values));
+}
+
+void frskyOsdCtmRotate(float r)
+{
+    frskyOsdSendAsyncCommand(OSD_CMD_CTM_ROTATE, &r, sizeof(r));
+}
+
+void frskyOsdContextPush(void)
+{
+    frskyOsdSendAsyncCommand(OSD_CMD_CONTEXT_PUSH, 
+# 918 "./src/main/io/frsky_osd.c" 3 4
+                                                  ((void *)0)
+# 918 "./src/main/io/frsky_osd.c"
+                                                      , 0);
+}
+
+void frskyOsdContextPop(void)
+{
+    frskyOsdSendAsyncCommand(OSD_CMD_CONTEXT_POP, 
+# 923 "./src/main/io/frsky_osd.c" 3 4
+                                                 ((void *)0)
+# 923 "./src/main/io/frsky_osd.c"
+                                                     , 0);
+}
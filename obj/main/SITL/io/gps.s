@@ -0,0 +1,3055 @@
+	.file	"gps.c"
+	.section	.gnu.lto_.profile.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\316\013m\""
+	.string	"\244\037\302\f"
+	.string	"X"
+	.string	"\254\240\363\203\f\b\002"
+	.string	"\001\322\340\376\252\003\f\002\001\002\001\002\002\003\002\003\002\240\342\234\212\n\003\356\302\211\306\b \002\004\004\002\005\006\004\004\005\360\302\272\212\017\360\001\002\007\002\007\b\002\b\002\t\002\n\013\002\013\004\f\r\f\002\f\004\f\016\004\f\002\016\013\004\002\017\017\020\005\006\213\326\277\344\004\007\b\t\n\f\r\016\017\020\021\022\023\024\352\263\360\321\b\025\334\307\272\354\tt\020\002\005"
+	.string	"\002\021\026\027\030\031\032\033\034\035\036\247\243\230t$\002\t\002\t\001\002\001\037\326\210\213\371\006\272"
+	.string	"\002\022\t\002\023\023\002\f\002\023\020\f\004\002\023\020\016 !\"#$%&'(\265\375\304\336\013\306\002\004\002\024\020\002\025\026\002\024\005\027\025\030\002\031\004\002\031\032\033\004\002\034\006\004\002\035\f\002\035\002\036\002\035\002\037\002\031\004\035\006)\207\245\203\341\004+,\262\217\357\267\005-\323\345\275\221\b.\315\343\200\255\016/\355\233\206\253\0070\223\222\223\260\0076 \004\002!\"\002!1\371\335\301\245\t<2\265\244\343\267\f\0023\307\333\345\224\001\002\002 \002\0314\370\262\277\340\b5\204\303\374x6\262\273\233\244\013\n7\306\311\227\362\003\b#\002$8\216\243\305["
+	.string	"9\322\277\262\337\n\002\002%\002%:\315\343\301\244\013;\377\331\231\340\001\020\002&%\002%\002'\002'<\331\254\373\355\f8(\002(\031\f\002\n\t\t)\t=>@\331\351\335\210\001ABC\327\351\362\306\016\024\n)\002\004DE\354\263\203\222\001"
+	.string	"F\242\365\310\247\017\f\t\002\tGHI\243\334\230\230\002\006(\002(J\316\271\204\323\t\026KLM\211\370\221\354\001\n\004\002\004NO\216\250\324\236\017\t\t\002\tP\374\340\325\311\fh*\002*+\004QRSTUVW\370\244\336\347\017X\365\240\322\235\tYZ\240\342\234\212\n"
+	.ascii	"\201M\250\34191\021!\005IR\310t\361\004J*\bY\235\007\022\340"
+	.ascii	"\023\"\216\213\214qH\206D\264\240\240\250\250\220a3M\215lzyL"
+	.ascii	"\220#\302\020I0,\031\253\310\302\321\360\270\343\332\215\276"
+	.ascii	"\315\344\310\212\216\370\362\276[\340k[\317#M\272P\261\177\206"
+	.ascii	"X\254t\215\200R\215\217\224\272\325tk\314\305\243I\366\\\003"
+	.ascii	"B\023\375\314\344(:@\321Ul\314\310S'\366\222\310\225k\251\361"
+	.ascii	"r9o\b\3139&\2128\035\1771\031,\344\005.\315\221^b\216ND\227g"
+	.ascii	"ED|\350-\007,X\374\024#\2268Be'\375+=\232\351q\204x5\030\212"
+	.ascii	"t#\245{A\344\236\f1\024\255d\244\306\275\310#\265\306OZr\n`\240"
+	.ascii	"`\246\237\314\333\336\023\031\235\f\352^Q\325\277\034\333%\277"
+	.ascii	"\027%\177n\312\203\222\320;a\023\310WC\326\254\262!b\307O\230"
+	.ascii	"'6\226\342\252W\303=6\341\205\324\210\354\316F\221\267\311?\371"
+	.ascii	"k\204=:\027\337\252\2755O\264\372\377N\375|\223s\303=%-\227\322"
+	.ascii	"\361I\b\314\n^\217\331\034\212\363jd\356\031\321\321\274\007"
+	.ascii	"K\304#\334\373\r\215\025\343\241%\374Gou}\314"
+	.string	"\256\300\270'\315\"n\236\311<\250\312\034\330\025\272\377\217/\232\007\377\177p\246c_\276\317\351\230n@\nZ\336E\264\355\321_i\345\t\\\235\254\307\233\347$\305\201i(o\364\001\030&!\204\326\031\260o\367\257w\361\272-\006\r\302\346\004o\211\205\277\332\233\375\027\235\364\305|\307\256\212\224+\231\223\356T\026\204\314\316\253\373\371\357\374?\025\337\242\304*B\210\374\276\343\227\327\211\367\376\rS\333\017\035\201\310\335W\222e;}\202\177*\215X\037\370E\006^J\027]\351\370l\332\355\255B\305\036\240x\034\304\343 \036\016\003\356\r\246\277\2172\234Kqk\232\203\237\263\232n\212f5{7\360\317+\346\322L\206l\366\326\266\332\237\355l\256\315\263\364\232\350\377\216\356\206v\235\321 V\313\001\377\226\306\364\322\372\315:\344&\271\234\253\310Y\030\236\367f\312\377k\215?AB\251N\230\001\226\023\230\301}\300"
+	.ascii	"\221\201\337\217}?\257>ee"
+	.text
+	.section	.gnu.lto_.ipa_sra.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`V\001\335\006"
+	.string	"\302\207\026\033`W\032\003H_I\222$\270\353\375\346\203\222~\345\222W\316\305\001\331mK\231R\256\034\365l\243Q)\203\271X\364+\352\340\343\231\324\352\352\230\031\244\242\225\007K\330\213\362dI\300w\310\310#C\316\207\343\006\303\027+\024a\230>\363\nz\002\335\023\260\377\267\253O\202&\005@\250\241=e\027fg\r`\0021f\326\001\021@\251S\322\006\325~m\007V\251t\234(\376\273TgK\205\325}\353\242\021\235\214\004\255\242\231\363\367\330\r^\327x\271\371%\230\363\307\310\\\272`\202\231e\250\0041\333\343\204|\270Y\360\200\224\366\237X2\222\202E\340\264\246C\325\266\214#\221*\366^Pv\301\212\261\251\231]\305=\027k\372\025\214\2179\244\310\001\265\255\355"
+	.ascii	"\225!\307\007"
+	.text
+	.section	.gnu.lto_.inline.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\003\n\205&"
+	.string	"Fs\261H\240\330M\032\003@c\373\376f+_\222c\215nx/\020\026\035$\260B[\030\217\375>\321\337\371\003\332\022\332\034O\001\204o\246\273~\333\23749\254>D>\245jd\226\232\323<K\371>\2172\202n\220\023D\266\334)\221"
+	.string	"\240"
+	.string	"\240"
+	.ascii	">*EE\351\214z\355S\037\205\322\204E\235cx\346\363\235\233IZ\216"
+	.ascii	"\003\355\341\341\253\333\0314>\217\366\210;\247?\3309}\n\255"
+	.ascii	"V\255"
+	.string	"u\301\322q\301q\301\375I\322\007\332Zk=\234\275}\"S\345E{\241u\002\206\205#\300N\245*.0<\317\361\221\267c.\306\266\304\313w\364J\233&U\302\367\335\255\2223+l\340\374\020]\002\206M\016\t\341o\3339\177bM\333\026\315\177\246\330!\332\226h\322\347\020-\363\225u$\301\033\230v&AtT\274v\355g\255\304\310\362\332sc5A\323\230\201\235\211\347j\365\234.<wnG\217\306L\211\331\340\265\372nU\210\217\242\326\372{\332\177\333\211D\353\210\221\254ys\320`\001\200\231\"\207x[\242u\236\276\215\202\005xe\301h\b&.\370\343\202\224\312\220\n\263\322\371q\005ei\004\204\243\032\\\230T\370\300\341\341O\370\263JS?\027{yYbg(\361\"\333k\353\220hG\342\367\250V\217-MsL,2mK\224\245H\310\341\263G\275\374\2368\255f\001\270\340\234\353"
+	.string	"\305\017\031BJ{\353Tk\245\215\241n\030\204\f\210\215\234/\214\013\276\243aKUI\245\217&\361Hc6`\013VOd\200\360\330\320\324j\264s\205\272\341\356f\n\223G\235j5*\237\260b\207\267e\244\302|\220K\370\211\037D\367\354\213\354\007\355\b\274\335\302\032RvbG2S\246e'\373L\234\237'\307HL\262T_\220\030Z(-D\302\274\365\255.\225\331TT\330cg\332R\026\265]s\t\203\377y\356\231{"
+	.ascii	"\341\223\344\263n\r\353X\313\032\264>j\255\004&'{\373$\r\013"
+	.ascii	"\244\031\217\013\3167\267UIM]\326\267h\216\276\220\315)\021\244"
+	.ascii	"<1]M\030k\211\330\271\031\027$\251\020\375U%E\365\354]:\330\350"
+	.ascii	"\350\tC\fb\315\224/)\023\3660k\250n(\370\303\206a\201*#\243d"
+	.ascii	"\021\341A\333\003Y\216\035\346\263r\250]]bF\267}\332\243-\270"
+	.ascii	"\226\254jox\261\304\231s\004\n\351\020\032\300 \211K\255\233"
+	.ascii	"\337gg\222\351\263D3\211>[4\235\372\226\352\n\252l\256Q\303A"
+	.ascii	"\341\265\332[\226\273\035\307W7o4Y\211\221\003C\f\270T\200\234"
+	.ascii	"\324\301\316\rgt\211\001\025\034\200\362\250Q=Bd\206f$H\n\222"
+	.ascii	"$\303\030`\002!2TU\036\022\300\024-\006\303T)3$B\n\n\222\244"
+	.ascii	"\375\016\274\023\1777A\227\n\235\240\271\273ja\333\315\237\346"
+	.ascii	"\375n#aW\2438j\367\200\251\321\031\002tI.D\254g(\265M\213\334"
+	.ascii	"\224\260M\3546\315\313\316\370|\317\2152\272\371.\341D\213fd"
+	.ascii	"\304\257\305\200C("
+	.string	"fgF\2140\b*\ra%Z\034\303wx\367\210\261\017)\024\203mI\336\215\322\036X\256|\032\272\303\374:\236\306\021\003\223\224\031\3711^I\002\222\001\\Mh7R\222\377T\251\230\345\332A\026\221\f\327\222;|YN\"\277\2038\020\215\347\331\352\234\244\245\207\352\316\276\325\tTd\322Ba\031\231\305\t\214\301%\262\216\335j\230]_\276\031\201\321c\301\003\006\241U\366\3560\027\302\354\260\336\316\224\272n\3421\035.&=\200\315\002\311\326j\340Jp\360i\233F\022\213\030\337\301\027\305\016\207\2475\021\220Y\347Z\320^\207\243\301\302\f\256#\271\013\254\3039\350\201a\331\024(\262\230Y-\3772\306\222\031v\260\353\305\273\214\004$\"G\b\306'd\257\001\262\333\307\201\032\207\310\263\276\262\335)-Y\343\331Df\\\372q\351Y\201\212~9>\345\304\0279\367\311\372p\360\304\020\222\305F\205Q\033"
+	.ascii	"\032IU)\016\216\330D\361\375\bD8p\304\224\275\201\226\225\004"
+	.ascii	"k\353Y\005\006bcoY/\343\352\360u\006s\002qz\230n\326w\260\001"
+	.ascii	"\006\365\"\022\207@j\033C\275\203\230\300t\256\263\365\fx\n_"
+	.ascii	"\"J4\221\316LXu\343\024(\344\207\374\210O\226\214fl\245\223c"
+	.ascii	"\200G\200@\262\242\016\224\r\365\354zx\023\340\"N3\334;\3715"
+	.ascii	"\352\255\251e\300\023\356\324Gp\336\233\240\257\301b\376\370"
+	.ascii	"\370\216\212\374\207\252o\013\241_\023\305\251\331\030$\275\326"
+	.ascii	"\023qL\301\313\035"
+	.text
+	.section	.gnu.lto_.jmpfuncs.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`c\013U\034"
+	.string	"\306\241nC"
+	.string	"\321$\035~\326\317*B\220\320\024q\215\023E\365r\340.\333\376\367\254\377ZR\274&\240!\rTU\215\225l;\252\241T\207\363\273>4\326\032\321\n\333D\261#E\"J=\2520\232\234\335\310N)\005N"
+	.string	"]"
+	.string	"["
+	.string	"\234\353\002>\036\036\227\005|V0\300s\364\300\366;\320\353\371\354\220\233om\310'l\023v\t\337\315;G@\367\272\335\264\223\004\274o\0020\246\262^\3359_\245\352*\345\266\372\363\317\353\351\247;\333\256|=\373\004\261_\003\265\320\n\310\021\026\265\305Z\017\017\037\033\245\335\020\264C'\b\350\022\355Na\213\\7\n{\300\365\376X\327\315\003\240U\333\323c\345p8\316\020\320o\206\351\017\350\272\350\305u\253\305u\370|\256;T\221\b$UF\n\200X)\302\322q\312{t\374\035k\026\377\246\364Wa$\027\272\256\353,\216\343\002\317C\205\271\266\312\341\270\f\b\2361\250P\236)O\224\227\244\263\241K\\\320r\025xo\035|:qp\240\203?\313\344\277\255\340Zkj^\tJ\244\236\244NR\327`\3514\330`\351\230\244\274\254!!\267\271\313\037l\353\025>\007\370\276\347\354"
+	.ascii	"?\362[\233;=\300\347\007\370f\355\3700a+X\314bK\3040\222)\313"
+	.ascii	"b\026\261\221v|\224H+\230\0261,\226\260\f\206\246\006e\"\022"
+	.ascii	"\341t\232y\221\241\2319\301V\2509\241N0"
+	.string	"\225\262\f\377$T\264;\272\341\210B[R\"\323\306\264\235\020\024\024\003\b\246,\022^0TW\334h\344N[\252\032\206\261\331\360O\356Tk\267\033\033\216-G5\207\002\200\323\250qM\032\232)\005)H\215a\f`\002\221RD\325\r\022@\2039\206\2439\251\b\"\306\030\"\"\023\210\220\214\024\244\240\240\260\320\032\034D!a0\302\224n\303\215[\302\\\254ua\202\220\267\310\221\271>\312\f\210q4\302\026\235\206z\3062\021\030\344\001\025*\213\235[\342\016\032\212\312\263x_\030\233\026\202~\253\200`UP\344\320\306\314qV\302\372rx\2568aGi\"\344E/\r\354\330*rt\220\373B\256\372\237\336\320 bw}\302\344]\363\fi\315`>2G\212?X\3450\3573D\3265\365\243F\3649\301k\221\272\270R>X?\344\344W\037\tF\232G\257\037\216\001{\361p\020<w[\022K"
+	.ascii	"A=B}\367\360\270\211.:uE$\307n\002\340\223\257\372\323\366\315"
+	.ascii	"]\267\026\312\322'\273$\2111\315\0275u0]\324\005\016\307\206"
+	.ascii	"T\026(\020\273\377v\t\033\r7\250\226\304\222\"\213\366\240\371"
+	.ascii	"x\226\0077Q\372\266\"9\225T\232\r\360\362\301J\020Y\272\202\302"
+	.ascii	"\247\023\021\200>\204\276\363f\302\226\254\004\245\242\022\266"
+	.ascii	"U\373}\334\037\320\325\335\013>\220i\037\371.\343\253\324>Z\324"
+	.ascii	",RO\247\257\t\0345-,at\244\2674\317\013\262\203\233\372GGd\003"
+	.ascii	",g$\312tA\323i(\017\204\026\361\034\224i\b?\306[\314\\;=\376"
+	.ascii	"*\301\223\240\264i\312}\350\345\n\251GF]r\017\222\334\343~\300"
+	.ascii	"BL\252\315\326\325\364\241\263Y\317+\305P\322\300\344\f\234\312"
+	.ascii	"$\020\210\036\235\260\270\205h\034\212\270GB\373\374\377\311"
+	.ascii	"0\361\325\013\203\337\347BH\310\334\356~\322==\320\225\200\350"
+	.ascii	"\222j\225{\243"
+	.text
+	.section	.gnu.lto_.pureconst.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375 Y\215\002"
+	.string	"\222E\023\036\200G\351&q\231\364\271\221\tY\031C\2061\"\\\201\321\376\267\037&\322C\222\205\326\374w7\024\267\304D\314\3034\314\302$\314\301\024\334\300\004\314kf\335j\0065\247)\315hB\267g\346\334\3462W\271\311\f\271\307\275\345\356\026\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\212\001\255\t"
+	.ascii	"\302\215),\220)\031\016\240\356\356~#\314\335\335\215z|@6\024"
+	.ascii	"\212\265\217Zy\321\250\212>\211\021<\204kn\267\337\204\240\333"
+	.ascii	"d\223M\244L\001C\323\244"
+	.string	"\301\fAL\006\030\327iE /\225K\355\f/\314\251SR.\351\214\272f\025\025.\303\305\243\226\357\275\267f\2243Ja\024\347\234c\t\017\345\216\021v\224;\264\007\322G\006\204~\026|\243\241\240(jb>\032:#\345\220'X\300\241\336\343l*G,\001?\037]\224/\332\332\013\177Z\373\263\312u\371\245\265g\373|\036V\271\305\362o*V\245\003\354|%\002> @\002d\314\035=+\n \3510\307\023fjH=9\006n|\233\201\035\027\226\243!\313\236#-\033\b\261\030S3\r\237a\025:\002i.\027\367F\254\347\276\240[*$7\270\304p\2016@\310\360\033\356\002\030\2706\3340\374\2061Q\250\350\324\003\3067\366b\302<\260\362\bc\240\315_\264HN\257\265\234$\263<:\223j\3408\214\232\271b\3118@O\352D6\326\226p\230\026\355\232m>\tOH\2702A&~"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.lto.488b1d5191bcbb20,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gpsPacketLogChar.36.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375 <\341\001"
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\303\314\221\t\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.text
+	.section	.gnu.lto_gpsInitData.54.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\265\001\375\f"
+	.string	"$\024\201\001"
+	.string	""
+	.string	"(\001"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\204\205\376Q}\273\001%\206\b{\by\275\006\035\001\001\004\005\001?\202\210\200 wu\300\001s\277\001q\276\001o\274\025'G\206\bm\230\375\001k\303'\\\206\bi\bg\305\006\035\001\002\003\310\001s\307\001q\306\001o\304\003\005\001'\177\330\374\001k\313\224\001\315\307\001s\310\001q\316\001o\314\002\005\001'\267\001\230\374\001k\321\314\323\277\001s\300\001q\324\001o\322\001\005\001'\357\001\206\be\330\367\001c\326'\205\002\206\ba_\330\005"
+	.string	"\333\001s\332\001q\331\001o\327(]3\334\0014\325\001\320\001\317\001\312\001\311\001\302\001\301\001"
+	.string	"\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"!$PUBX,41,1,00031,9600,0*16\r\n"
+	.string	"\024$PMTK251,19200*22\r\n"
+	.string	"\",0*2338476576CD\r\n"
+	.string	"\025115200*1F\r\n"
+	.string	"#,0*1E\r\n"
+	.ascii	"/  \243)\362\005\002\300\252\376\322\021/\270W0\356\"\\`/\005"
+	.ascii	"c\343\224\374\025\250\361\037\301\315\324\326\3124\201\016S\363"
+	.ascii	"\005\270K\367ua,w\373\352\303.\031hL\220u%\2147\035\352a\214"
+	.ascii	"\254n|\304d\007jj\017\253'\2513\246\313n\334\331\254q'\364j\002"
+	.ascii	"4\002"
+	.text
+	.section	.gnu.lto_ubloxInit.55.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375 \200\375\002"
+	.string	"\362D\022\037\2605\215\001f\255\240%IL\037\303"
+	.string	"\n\031\211%\225Vu8\264\325\3444B{o\271e\n-\260\"\242S \177\200\326\002\360\032\363\365\274\312`l\332\357\374#\353q\262\\\276\376\t\273s\356\034\203Q\231I\351\275\374*\b"
+	.ascii	" \023\220\t\310\004d\302%W\024cp\3325\200\""
+	.text
+	.section	.gnu.lto_ubloxMessages.56.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375 W%\002"
+	.string	"T\003\004"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"'\002\002\177"
+	.string	"E\265b\006\001\003"
+	.string	"\001\002\001\016G\003\001\017I\006\001\022O0\005@\247\022\001\036g\265b\006\b\006"
+	.string	"\310"
+	.string	"\001"
+	.string	"\001"
+	.string	"\336j\005"
+	.ascii	" \023\220\t\310\244K^\003(\002"
+	.text
+	.section	.gnu.lto_ubloxMessagesPvt.57.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375 T\345\001"
+	.string	"\264\002\004"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"'\002\002\177"
+	.string	"B\265b\006\001\003"
+	.string	"\001\002"
+	.string	"\rF\003"
+	.string	"\016H\006"
+	.string	"\021N0"
+	.string	";\242\022"
+	.string	"\035f\007\001\023Q\006"
+	.ascii	" \023\220\t\310\004d\322%\257\001\024\001"
+	.text
+	.section	.gnu.lto_ubloxAirborne.58.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375 >\335\001"
+	.string	"$\003\004"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"'\002\002\177"
+	.string	",\265b\006$$"
+	.string	"\377\377\b\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020'"
+	.string	""
+	.string	"\005"
+	.string	"\372"
+	.string	"\372"
+	.string	"d"
+	.string	",\001"
+	.string	"<"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310"
+	.string	"\034l\002"
+	.string	"\002\243\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_gpsConfig_Registry.63.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375 \230}\004"
+	.string	"\024\bj"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001\212\001\206\200\200\374\342\303\314\204\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\326\006us\250\364\005uq"
+	.string	"\005\001\006'\001 \005\001\006\035\001'\001\236 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gpsConfig.65.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375 _\255\002"
+	.string	"d\004R"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\n\177}{\001\001\005\001\006y\001\005\005\001\006w\001"
+	.string	"?\202\210\200\330\001us\301\001q\300\001o\277\001m\276\001k\274\001i\275\001g\274\001e\274\001c\274\001a\274\001_\273\001"
+	.string	"\005"
+	.ascii	"@$\345\356\305BJ+\030(\002"
+	.text
+	.section	.gnu.lto_gpsInit.68.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\022\b\025)"
+	.string	"ZI\340\017Cp\236J:\363\203\263tw,\035\2607\376@\035\333\201]\023u\006\035G\265S\366X\030\314o\241\261\327\017\250\003\273\207\305ES,\275\306\235\225.\347\205\310J\201x\301F\244\202:;d[\333\204H\231d\355"
+	.string	"\341"
+	.string	"\356"
+	.string	"w\265R\345\r\252n\245\031*/\373w\237v\"O\f\r\301\327\327\275\374\270\373[\0357n9\205+\253K\255\365\367rW\307\356\357e\337l\177\373.'\243/\343\361:U5D5G\265\247V\343\204\227\373\300\367r\215'0_\372.`\276\\\272\253\347F\256z\265<=\276\340\325Z\201\275\265=\246'\032\362\365~\263\250$\233\351\336\351D\307\223]s|\206H\nVjp\376V\225\204\024\020\247\005\212\357oUVR\334\363!\371\357fW\362\342\342\363\204\210\325'"
+	.ascii	"+H^Dr \023\353\372[\325\022\262\217`\324\374\210S\\\222\031\264"
+	.ascii	"\370X\373[\225\022\362\247v\207\345W\252\256\230\304\260\306"
+	.ascii	"\255\013\240'D\256\336$\0061D\266#b\024i\024\246\347\312\315"
+	.ascii	"\316@\210P\314\275\016\265\326\345!\221\310\327\350\273Kgw-\354"
+	.ascii	"\366\370\004f?V\033\321\r\252\235v\377!\351u>\320\321\362#f\307"
+	.ascii	"\240\237\266J\207[zc?\303\272\004\274O\013!\202?d\320\n\212\234"
+	.ascii	"q\203z\332\222\270\2348=4\273\005\363ik\342n\202m\236v\262m-"
+	.ascii	"oXW\200\t|\335\314\t\277\361jT<}\270O\3636\024)T\354U\314\025"
+	.ascii	",\370\303\3453wnS\355\264'\363\335\0267Sf\316 \274\245\271\353"
+	.ascii	"\342lKk%\332 \261\007\347.\214\213\t\036q\325Z5\354\303\\\215"
+	.ascii	"i\377\365rg\324\340\017k\314\2277{\204,wxvO\234\267k\204\342"
+	.ascii	".\242a\2432nk\3556\257\203\346m\320\274\f^\366E\362\361\036\365"
+	.ascii	"x\215\232\267h\362\376J^\242\311;T\362\372J\336^\311;'oY\362"
+	.ascii	"\222%o\223\274\334\274\277\360\261*x|F\004yP\230H\213@\256\335"
+	.ascii	"\034\\E\267\f\330\2515j\303\313\345!LE\273H/\n6\301\346\313\331"
+	.ascii	"\300\2562\262\313~\217BA\202> d\367\374\260\215\225\221\265\326"
+	.ascii	"\332\323\360\346F\312\257\265\306\374G\260\200\217\24102xvHl"
+	.ascii	"X}f\027\367o5,\2554E\255E>8\273\025|\t:\213\323\275\013\203\245"
+	.ascii	"\202\0038jX\367\340$\273{\007\033\272\251,(\316k\270\271c\230"
+	.ascii	"\262\213{\036\023\251\017|\301I`>\2652w)\026\032\306\037\"Qi"
+	.ascii	"c\342\026\325N{\244\223zCv1.\351\205\b5\350\243\255\322\005\005"
+	.ascii	"Bk\200\266$~\367\207\321\326\304\373\324\241\005\220\363cNw\221"
+	.ascii	"O\307&\367\2133\271(\016\264\273t\313\351\350\230\257\326(\r"
+	.ascii	"\373<\327C\271P2jF\315\346K\356\362\313\227\261\262\367\256\207"
+	.ascii	"\317\335\351\265\r!\242\037A\246\0306\204I9\232\204%p\334\b\032"
+	.ascii	"\355R\005\0347\202@!\023\320\006\223\213\032\300\245&\034\300"
+	.ascii	"\n\003Vx\003F\0230\207P\330\004\374\031\237\336Z\333\341\251"
+	.ascii	"\241\216DI\254\205\303\034\364\217\253\304X\370\312\321\301q"
+	.ascii	"I0\025\236\362\343\232`\257\340\221\224\343!d\241;\213\023S\007"
+	.ascii	"\301N\235\335\220p\036\365\217tN\372\300\311\035\365r\024\336"
+	.ascii	"\022\356\277\226BQ)\251\371\362y\206u\034xO\177\314>\0052\213"
+	.ascii	"\032\370=\0252\271\336\250w)\025%\362\207G\335\263\253W\355T"
+	.ascii	"\204\233P#F\315x\262\300dp\026E\342[^\302X4\211\022\212\2055"
+	.ascii	"_\026\365\341\310\231!\352\337\025->\217\006'\241[\217\263\""
+	.ascii	"\352\347\371z\350\210\021_\267\034\260=Yd^\276.\366\354\376s"
+	.ascii	"v'\212\0031\341\"\264\350\343'\020\324\211\257\326\332\353\263"
+	.ascii	"\311\225=q\200\216\250Q,\005\035B\f\231\210\004i\222J:\240\002"
+	.ascii	"\021!3z\021\020\245CN\261\022\325R\271\032\322Q\255\375fL\277"
+	.ascii	"\306\201\370X\033\212\017\246\216\214\366\355\274J\200\307\217"
+	.ascii	"\3722\276\2248  \327\260\244H\251C\316\227\263*\276\255\325O"
+	.ascii	"\b\222\021\221!\f;\210\025\3325\022\fK\207.W@3q<\226X\272\361"
+	.ascii	"\024\363\005\235\207q\034\362f\213\006\321\231\364\356\026\213"
+	.ascii	"\n+\236\242S\236!\273\265\033\035\332\034\304nI\372\036%\r\214"
+	.ascii	"#\202 \272]\245\205^\236*8\371oU\037\246\3303$ \257 +>\315\326"
+	.ascii	"\217\354\324\270z\013H\2105\230\271\273\2617\306\177~\033\240"
+	.ascii	"\037\257\n(V\267\336\261\2746:\027U\206\227\001\3024.\217\351"
+	.ascii	"\250\t){{\323\376Ey\003=T\335\003q\217\226$lJ\330\351M~\224\013"
+	.ascii	"\fmM\0033\"|\211)\250yj\032xQ}C\263r\353\353\275*\212\241\336"
+	.ascii	"\225\261\035\277g\001\377\013~N\353=\234\004[A\351\334J\334~"
+	.ascii	"u\352\354{\351\031\r\236\032\344Wt\b5"
+	.text
+	.section	.gnu.lto_gpsInitNmea.69.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\224\t\225,"
+	.string	"jL\260\020C`\346M:s5e\240\276\257\366\330\200\335\214\332\213\\\220(<\035$\222\302\377\020r\177d\275\335\340\267=I\226\267!\257\330u\262\313\327I\0337S\024\016Q\272\301^ \272\005\273\247\366\304\222\275\267L2\354"
+	.string	"\351"
+	.ascii	"\003\001\315\275\332\\d\233\317\332\314\253\315\246m\266\265"
+	.ascii	"\271\326fZ\233\2336\037\002\201\267;\"\356\356\345qw\350\302"
+	.ascii	"\3315dO^\231\310\353_\256\306\354\343\031Ockt\363\3352\317`\366"
+	.ascii	"\335\366\321\330\307\367\3623\342\223\303\263\210<\327\330\342"
+	.ascii	"\314\335\233\326\340\226\235\316[\003\017\232\267\365I\346-\023"
+	.ascii	"\231\377<-\354\236\255\255F\230B\367\336)\372\344\304\037\001"
+	.ascii	"\177F\276^\321\3113m\245M\344\027\177\244\366w\001\177_e\310"
+	.ascii	"#m\344;\036\244\221\227!\213t\217H\221\362\335\006\307\213\331"
+	.ascii	"\311;\036\244\227\257\253F\233_\322\003\311m\205\232SS\007\354"
+	.ascii	"2\326 \217)G_\027W\327\n\365\365\366\003\330\265U\203w\230"
+	.string	"\3709\332\017\224!\2214\035\322\353\3222\203Q\334\304\276\004\211\2046O\302\275\227\373\330\325\343\214t\346\003`\346\021\314E\004\002\247\234J\355ri\227t\242p\206A\2717<\267\245\231WV\337\361\234\232%\\\245`\314\213\373\320\244\224\006\030:[m\210\233:QJ{\217\221\212\026[\275\315\220MS\236\033 ;`3\237@\321?:\321\240\22038-Z\344\263}i\013\\\261\021=\212[\0247J\301\320\360\323P\356\343\325a\203\312Mb\206\177\206\377\234\367\026\377\365\0270o[\351\032\305\336\346\356\275O/\303\377:\303.\362\246\335'_\222\255N\304\314W\037\223\342\274\367V\361\305|M\005\177\354\226\261Z\364\217-\314\333\323\243\275\307\246\370\371:Kf\365\035s\232VS0\346\323\273\273;BL\2330\327f\250\332\374\344\364\344\271\25163\325\346%\333,\2406\007k\263\222mN\252\315\001\314f"
+	.string	"\264\031\311l>\242\315\300\332\374\253\315F\265\331W\003\025\232G\212s\007\220>0\2321K\372(\330\257s4\216\037\265ukM}\243m\270Y\353\271\335\310G\233\250Q\033\233\313Gyn\3024\321 \021 m?\332\317=j\256\335\\\3211\230W\362\205.b\350\333d\271\205\356\211^\311VO\204\250\227GAW>\321&\037l\336H\334\320\320\216\247\244\333B\207\346W\362\325\t\245"
+	.string	"\206\325)\237\340\n 0qe\004Q\305\235\021;{t\203\366\274\210\366\002\r\317\271\"j\227\207\354\222\004\372i\377\223A\201\334\275\306\0375\234\306\005\013\2309x\350sR\313uh@\033+I\336\031\230\225J\221ua\363r\345L\nF\345\206Krq?\n\372\207\246Iy\264.\215_Z}\247'\217I\355\262\316.\031\354\004i\037\232\2262\177"
+	.string	"\321?\262\001.Zd~\235\333\211\301\037\343\020#F\230\267\226Z\256\272\004@\350\bY\n\306C\263R\032`\3700\223\370\234a\334\373=p"
+	.string	"%\254\212\022\n\243\0360q\357\007A\b%\214\242\212\212\020%\024:\200@E\025E\025%\024RY\350\340a\003\202\0022\260VP6!\365\202\005\212)\254\253\251\025WV*\246L\270x1%\245\304X,N\270\230\202\201\205\345b\312\227\226\365z%dQ->\031\t\305F\364z\357\275G\235u\241\271\230A\321\253\261Uk\351,jPjL\242\255t\231U\343\253&\353)j@\246\036k\261%\312\324P:l\211\332\2726\263vB\224B$;\215\025\026\334\nh&\002\2505\236\261\373\361\371\217J]\351c\024l%\235D\211\006\373\253\217(Q[g&"
+	.string	"Mj\"IT\t\212\210\366\"V9\271\203\264\020\242\225J\304B\324B\324b\336\006\240UP\326 Q"
+	.ascii	"D\263\376A\354\3627r\367nU1"
+	.string	"s\211\366A<\2732\354\336\255\b\267\334]\335\203\210V'P0\371\024\314[$\3727|\222\364\210\276F\242\254\200\261\250A8\252\0304E#RRP\220\244\305\300\002\021\241\"\326\001\021\320(\205\034r\206\306\030\224\024\322\030 p\210 \254,\213\233\244\300\177\321RAn\277k\017|\333\226+\262\371\340lS*\212\333\360\355\245\325\265\320)\311\323\262i\312>\204\261\030\374\332\372]\342\375\316\323{\201sO\371n\277>\276;\342\312\036\207\253\006_\346\370\331\326\027\331\301\372\r\024W\227N\225\225p\031\033\264%@\270\307!\031\004h\224w\t}\3635;\221S6\315\230\316)\020\024bd\263-\376/@\370\t\260\002N\307p\323\030Zf\341\3755\322\001\332\377\f\2565'\334\340U\031\310\256Z\216\317/\306U\265\352s\3709\226\2372\230lTiK\243\323u\324\344\314\300\201=pb\250t\340\353\372"
+	.ascii	"\344t7\214t\200\335l,\307\300\231\273\3030\005\202\217\266\206"
+	.ascii	"\216\3321\347j\2009\242:\245?\017z\323\214\r\177w5\320nQu\355"
+	.ascii	"\013\030H|\035\035\304\361T\334B\2460\2703\221\247A\013x-hn\337"
+	.ascii	"\035\206v\275\214\032\035=a\232\237\203\\\235\032\266r\331XW"
+	.ascii	"\317\021\351U\301\204\n\355/\237\321Y_UK\262Rfz\021\246\227B"
+	.ascii	"o/>f\001OAL8\b\234pH\355Z:>\255\017\314\240j"
+	.text
+	.section	.gnu.lto_ubloxSendDataUpdateChecksum.71.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`O\002]\023"
+	.string	"\006d~H\320\360(\035Z\252\305\210\b\3147\002j\210\215\312\341\343\342\310\221\374C\030\310j\202\216\264Cc\272\350H\276\r\275\252\267\250\222\214\222\321\247\235\202\212+\274\300fQ\272\352\002\204T\243\341C5\247\352\340\253\355o\262\245L)f"
+	.string	"d"
+	.string	"l"
+	.ascii	"\017\232\371k\316\036(\027s\206\t\\@\365\317\341E\344?\325\001"
+	.ascii	"\310\177\246\3316\036\376\314\224\007\0258;\2509'\270\035\374"
+	.ascii	"\336cxG\245\375\213\2534_y\275[\216\346_L\331r>\264r\266H\022"
+	.ascii	"\365t\364\335\025\227\253i\f\241\363\375\356q\004O\351\226\323"
+	.ascii	"\271\246 \3149\255\267"
+	.string	"\234\206[\3366\213\355\007\266\356\004~I\265K\252C\244\272%\325 \037'\372Y\027\372=\036\336\253\207\177\352A\277\374\203\356]\265J\365E\006\360\310XA\2323\247\227c.}G \374\242\033\301<\205w\207\006\2119'\353\237\rc\263\376\235e\023\301h\020\205b\004\270\246\315\020\020\202U{\001\003\332C\231\273fmF\006\003W\373'\216\202\026\276\321I\212\376f\002\266\245\261\377\342G\027| \253\304\364\267\230\374\367\332\tJ%6\270PB\266\265.\224\220\365hr\302\351Z\373\333\r\220\375\266Vw7<5\026\026d\034#\377\201\354\215~\240\211\t\247\373\352\276\005\316\216\257\300 S\001\3713\362\337\367:\036\023NW\243\275-B\262\345v}\354\260\246'\371\211z\362\366\330)\r\022\"\304`\\T`&(\260\025\213\311\312\226\274\224T\210\206\215\270\264\234\200\262\024\220%\245$\006\302f.\340H"
+	.string	"\313ZLf\340\213L6\003Ya\315\267\307\0248,\325l\355[\037\353H\n\332Uj\343\342\276\273\nGR\214\375XG\225\273\213\363l\250\206\215F\371\275\313\310\270\253u\300S\272\341\251\3059\347\214V\360\335\2175\301s\272\021QS\335\327\0062 \220\002\231Kq\003T\013\n\003\253G\374\330\002e\021C\257\036\r\342\212ok\026x3\303&Y\321\376\366D7\334n\3134^\205\005\326\fm1\200F#\374\342\b\207\246\256qp\255\241j\005P(\234\260\232\333\334F\373Znjo(\023\016\232+\n\030\037\303\bb_\230a\234"
+	.ascii	"\034\021@\224\352^0\013y\202\222\233\001\224MW\177\002"
+	.text
+	.section	.gnu.lto_ubloxSendConfigMessage.72.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\024\003\375\024"
+	.string	"ff\205I\320\360(\035j\030=%,\007FO$0\224\217\267\321\307_\177\3544\355@\376Y*\013 R\032\"\311\3756\372Cc\030\3566B\261n\3172\206d"
+	.string	"\276\370\004\227!\321\205\220\255\024\301\222F\310JU\364\244\221M\244L)o"
+	.string	"g"
+	.string	"p"
+	.string	"\367\231\325\263\225\354\234A\033~)<\3338E\250TXP\202\232\363W\340\322\006\306U\373"
+	.string	"\202\333w\266\277f\216F\005\002W\373E/q\273Q\316\001\314)\224\3437\347\356\304&\343\245w\017 ^\216\027\021/}\263\235\276\033\232*\020I<>\2519'l?\374v\275\371\367}\245\363\301]U\t\346\234V\235\017\206{o\333\304\266\212\275\036\002=L4\250\215D~\216x\371\305\0016\365"
+	.ascii	"\035\351\347}\300\320m\342{_\026@\251\240\216N\331;\234n\007"
+	.ascii	"\373\341\\!\373\273\237\344F\377H\250~I\265k\325\255P\035\"\325"
+	.ascii	" \253f\205\352\217\253W\253\036C\265"
+	.string	"J\252\305U\313P\035J\365\256ZC\365K\004\274`\232\265\230\363\302\024\217\271$W\2048\357\357\375(\256\220m\361\036\262bP\303\217\016kA\\\200\354\352cY\373\336?V|Jr\351\221~t\244\373b\272qWk\313^x\026g\275\2108\262\253\375\316\210\234NY\265\343{\334&\222\254j_\004\334\261\023\224\223+\376\304pe\212\207\213\003|\352\001b\251\356\256\0353\323\353\\Baq\366O\034\305\215Od\032\215^G#^\356\256~V\367\204'\n\026\314nj11\231\204\330JF6a]l\\\"\204\216\241\324f^`4\030\230\f\214\313\f\026\253\251\301PFL\233\221\325\300lh\264\032\030k7\037\316\0252\013\214%\235\315\361l\341\234\034T\336\373\241x_\021m\006\307\261\322$oDI\005m\007\267QC\025\025E\"\370Z\373\301g\330ZCs\316\024\177\351L,>\321\245!\264\264"
+	.string	"u:b\354k\237\301IF\017Pk]J\001= \240\002\021\2622\017T\027\024\206\376\265\300\034\254\344\n3\275\355\261]\227\245&\220\323\"\267\250\005\2465\277\226\327\357\240k\304\027b5\336\350\340z\002\277\313\343\250\216\327\344\335\316\363\3305=\321\231\002\022\305\246\036\274\035\226\210\306\024\255\256\201wV\316\310\356-\246\313\361\214"
+	.ascii	"\332\253\231q\205V\330\221\030\223)p\313\r\035\301\2368\266("
+	.ascii	"\202\355\205I[\001\3641_\300\b\307'P^\300\021\0010\n\374\362"
+	.ascii	"\242\355d"
+	.text
+	.section	.gnu.lto_gpsInitUblox.73.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"U\t"
+	.string	"\326\221@90\345(\035`\373+\251aD\025\n\252\320\024\024>\344q'\232\216\331z\2061\001]\373\311\317\003\265f\312\376S\211*)(@\231!\372\366\306\320\342\204Ym#D\312\224\0020"
+	.string	"0"
+	.string	"/"
+	.string	"\273\013\325\343\247g\232'\177\343q\317\002V\327\f\001ce\305\361R\331\300k\303\345\256'\205\247\312\324xv\327\331y\026\267v\333\t\266\013l\307\002\006\0351\344\002\225\321\376R\251,\373\032c\214V\016;\323\371\3645\"\221\327\206\262[\021c\313\242\251\264l\237\343\223\375\362\357c\177\002\2330\201\005V\3452%\346\225\241\312\262\035\221I](iQ%"
+	.string	"k\362j\227\036\362]*\201J9\373#'\221\360A\fa\312w\327|S\346\332\365\256\007\376tJ\243\006\270\201\240\b\244\020\202\037R\tv\004\274\215\030H\320a\333H\220\363\241\356Ai\352\032\\\253\203\331o\017\236\001\236\355\356f\233\264C[\276\013\016"
+	.ascii	"2\003N\035\206YX'\002\202iX\001+\200\266\217\205x\241\207p\350"
+	.ascii	"2\364\313\020\342\322\2654M\003SP"
+	.text
+	.section	.gnu.lto_gpsInitHardware.74.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`$\001U\f"
+	.string	"\246UPC\020mj:\327b\333W\031"
+	.string	"\224!\244:\373o\033\344i\300\233\023\353\340"
+	.string	"\227>\350\250\352\335@Z>}\322\361\036\350\260I\307\273\370\370\252\252\016A\001#"
+	.string	"\rn\300\006\304 \0330\270\375\350M\366N)?"
+	.string	":"
+	.string	">"
+	.string	"\"\204\315HE8\3002\261\273\033}\360\317kF\347\307\347\240\360\372\300\356\225\206$\262\207\007q\020\266>Pt\032\3624\f\223K\302\0044@g\205ew=?P\301\255\335v\210\355\r\373\013\002\257\360\025\001\377\364\352\002\236\371\357\325\367h\257\247\033\006\256\330\n4K[\364&-\331\247eY\306LI\366\247\257Y\214\350"
+	.string	"^\365\332MP\236\330\261z\230`\373\024\177l\362\001\036\355|\f\327\300\306n\242\270\311e\372@i\351\033\374\326U\250\035e\3605\230\224<\200\366\372\321\246N(\373\027l\223\032!`\273\335\033\314o=(\243\320La\273s\013\003$\273\241\017\007\276T:\033"
+	.string	"\033\207\3314\030\221\314v\341t\266\312\205\271\315\bg\023\300q\234\215\"\202\236-%\205?\002\021\242\021D=_\274-\331\356n\305\304X\357 Kd\223ig\270\371\317\347@\202\030\003\035"
+	.ascii	"2\241u)`\2027\026 \005\312\001\302\240\032\036\220\202\247\342"
+	.ascii	"\212v|n\232\202\227\001\232\237r\006*\3261c\212\243c)\314b\234"
+	.ascii	"a|\312B\271\214\3622\304\270t\240q\23024\343:u\023\344\333e\345"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_gpsUpdate.76.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`4\022\355Q"
+	.string	"j\2044\035Q@\022\352t\337\315\177\002\307gjU\265;k\354\367\376\357\302\035\375\362=\347{\376\234\231\021\353kw\224m\315\357O\366r@\310\267\262\325\237XH\344\356\357}\020n\334X\242\311\001\371\037\240s\266\030\330\215\2643\253\216\326)1#[\356\235RJ\001\272\001\241\001\305\001\327\031\346:\003\177\316/\253\263\313\352\374\273\316\353u\276\327Y]\235\323\353\374\252\263\253\316\215#\bV\004\252\277\362\332\326\251o\210vME;\322O\272\2430\367\223\333\206>3k(lG\341\240[e\353B\244+\216\256m\237\016\370\265\232\266=|\266\360\362\023N\3536\252\355\020\240]rtm\333\n\320*\027\360+CQ\2257\246\202\231\306\244\305<\350'\323`\002\341\001s\327\320K>\350'\243`\336\001[e\376\200\031\330\252\nd\346v\346V\322_l;A`\227\266\305j\236\265\355s"
+	.string	"\026\361k\225\330\303\333j\332\302\333*\263\314X\372\251\325\346t\001\321$\246\327\266-\321\257\300\251\263\035D\004\372\351\341\331\321\311\301\271\031\332\bkhfd\20210\300\027\227\337z\325\364\205\234\345v&_\030\233\023(d\007\2255\261\214\314\201\312\300\374\307\331=N%\316\223\356\\\375\020dh\t\r\276\343\234\301u\326\02598\315#~\343\305\365d\304\207.\270M\221\026\266\3405,8M\021\256\247-\237I\003\270\372!HWyj\246C*)\b\241\3452\353\n\261n\250\340\tW\0363\326BPvP\022\205a6\260\312\0233%r=U\371\313\017\332t\312\202\025\325l\027+*\023\356\f\326S3\375\255i"
+	.ascii	"tR\360\272\312\323T:t2\262\004B5\371\305\212\232j5]\231\234\214"
+	.ascii	"\004\241"
+	.string	"\230\322\024Z\350\320\372\254\375\007T\322\323\227\027\202\364\377\202\264P*\244\262\341-\b\245LO\274\301`B\203u\020\327\223\023\367uE\333\266\354K\250\250f\021\315\354>\230\031\001\346\231\243{\321\251\023[l\013H\3205\023N\354\342ef\217\260/\220\315\331\255-=\222\323gfah\274\242\315\335_\341\264Oh\322\327F\351\330\256\233\244\263\260]tD\356\274\240*\276\313\230m6\226+~\267\254\023r\3562\366\213\005\363^\252\370\036\251\033\326\222\217d\356\"\213\216+ZY\231@\275\240j\373\334.c\027\355f\f\026q\263u\333\002\334EZe\006^\274(\353\241\030\346\302\340\234\324\255[\232\260\255\237\345sa<_\230\234\267\317\375\207\361\354MS\311V\353)F\031FF\267\325\377\006\353\024\257*\257\231\003\325D\357r\220\266-V\002\035\245\233n\211\372Y\002t\321\3038\303\324n\234\237\315i\327"
+	.ascii	"-\177f\007\036\360^\026=Q\371\310\035\374\223\252\356\242i\333"
+	.ascii	"\266m\312B/\372\226\322g\022\374XY2O@\201\367\222\373\254i\254"
+	.ascii	"\314\361\260\306\364\310\037\323\201)\352?\213\273Shi\241\023"
+	.ascii	"z\"\334\343\366\337\b\223[r-\314\215\3267\364\340.\302\025\034"
+	.ascii	"y/\217n\253\375(\252\240\315)%\357c~&\375\263\316f\250!\216\237"
+	.ascii	"\b\363u\266\261:\327\270\3164b\234\215V\347\031\253\263\214\325"
+	.ascii	"9\306u\206\321\316\356\027\253s\213\325YE?i.\272\316%\2563\211"
+	.ascii	"\353<t\235G\3008\213X\235\205V\347 \325\231\030\343\ft\235\177"
+	.ascii	"Vg\037\030\347\036\325\231gu\336yq\326\001:\347\\g\234\027\347"
+	.ascii	"\033\027\347\341u\266Y\235\205\253s\315\352Ls\235g\256\263\314"
+	.ascii	"\352\034\274\3161\0018o\343\331y\300\371n\333\352\036\213\341"
+	.ascii	"I\363Y\254\336|W\t\213\313\201\355\372\245\335|G1\247\244N\236"
+	.ascii	"\312\231n\266\351\016\277\271\302\342\230\034\215m\22224\201"
+	.ascii	"t\323\273\372r*y_\314W+%#\026\005J\214o1\033\236\210\305`\341"
+	.ascii	"dc@\272\305\330\205\2131\0213\341\255\327\314\254\017'\253\273"
+	.ascii	"\273R\316\264\202\237\305B&\315\376\270B\265\232\247y\341\177"
+	.ascii	"\232\022\311\263\370\003\253\371\2418'\315;Y]\226e\2130&d-J\027"
+	.ascii	"\363Yu\235\304\2258\r-\276\307\230mz\323\275\306Z\264\034\013"
+	.ascii	"O\34218S\367\030\273p.cP\353\205\036\233\371#C\264\314\317\270"
+	.ascii	"\013F\026\210\221\314'1\323\232SJF'g\3018\264\342Z\276\305BI"
+	.ascii	"\261B\204\334V7`\342\240\007\r\272\n\305\033\317J\315\202\237"
+	.ascii	"\356P'\005&\246\004\3072\366\240\360\3260\037\363B"
+	.string	"\266\262<%Z\322x\201\017\363\351]\t~e\264\002\376\016&\224\250\363\245I\313\n\310V\335\227o,*7\201\255\372\265\355R\021\373\224S\261V\354\t,\n,\n\267\325\227\357\200i\026uy\022\2127.\244\213\367\367.\377W\224WI\357K\301\243\212P\277\207\200i\326t\272\b\335du0\274d\261-X\251\263\362\245N\"a\r\351{6#\234\315\340\342@\330G\270TH~p\303\365\220\266i\004\t\223\207\340>\030KO\223\251o\037\237\313\304\256d,\277\266E\366U\253A+\332\266\346\017\272vHk\302\223\334W?\255\366\251}\266&\200C\224\316\307\314.\034i\374y\373<}T\316\337}\276^\326\365^\033\257\372\367{\213\372\020T\005\027\034!apC\325@G\017\244#\225\207\00382\310\321\200\006:p$%\3658\212\341#\002x\354\260\200\b)\007\221\216\034\025d@t\224\304\203\210"
+	.ascii	"\033F\332\201#\211H\003$\244$\"\340S\251\237\310\317n\313\232"
+	.ascii	"\322'\203J<U\363\265\361\222\370\022\337O\002\211\217\200\231"
+	.ascii	"\327$\036\355\356\320;\013\307)/u\264\373\250\2417 \316\td3\342"
+	.ascii	"m\376\311H\305hD\252\306\304\213\376\324\370\021\334\226uRt\r"
+	.ascii	"\302}\3615^\230\374\032S^%\201sI-=\237\325\306K\343\237+Lm\t"
+	.ascii	"\263N\2774\376\336\007\215O`\313\211\243\326d\307c\3647\302\246"
+	.ascii	"\314x\243o\263&>\031\377\342g|+\221$_\371M\305#\333\321\315\335"
+	.ascii	"n\2532\276\227\264\032U\005\027\235\002\300j\bt\347\263|\256"
+	.ascii	"E\3008\306\035\203\360^\212\370&\263K[[R\352\366=\235\365\225"
+	.ascii	"\330.\022Z\217l\034\230W\274\240\315d\226$G\350\373\212'\370"
+	.ascii	"\\\252\203^\350\357\236\362*9\304\226\240o$L\270\250\223\001"
+	.ascii	"\007z\342\3341\013\221\311\365\210\3572\365\363@\237\2325\361"
+	.ascii	")y_\013\307;\332\245`\207\372\335\361.=\346\035\243\367\030\275"
+	.ascii	"\255\376|\213\305\241)y_]\026\237\27720\341\232\316\241\017Q"
+	.ascii	"p,\270=\357Xar\n8\3173\037\367\216}\336\313\236'.=\322\257\360"
+	.ascii	"\274E\247\224\270\006\270\0377\305\273\363]\027\006\204\\1n\347"
+	.ascii	"{\212\371\326t\016\251\264\016\034\333\365{\323\371\0367\036"
+	.ascii	"l\230Yx[\221\355\214\331\246\007\275kl\327\210)J\230m^\320 ;"
+	.ascii	"!Bo6ys>\210\207\364\037\330\244\0179\337|[\314\326\303\220\032"
+	.ascii	"*m\343\201\250\020&\327k\035\201w\250q,\006\025DD#\"\222$I\245"
+	.ascii	"1q\005\204\020\006!\264\033\021\020\251R\322\241\031MAI!\215"
+	.ascii	"\001\003p\214\016\312\214+\365n\353M\240\032;\346\231;k\316D"
+	.ascii	"\317\260xg\324`g\3312\321\004\374:\313\355\004E\213\330s&\336"
+	.ascii	"^\246\230'\374\027\037\030\2303\212\200\200\253&\257\335\260"
+	.ascii	"\221h\232\"\342\022j\244\312\357(\256\206\340P_\221\343\235G"
+	.ascii	"\355\026\203\301\202P?#\304P\212}\037\0260\252\027J\267\226\203"
+	.ascii	"]\327\027\257S\242rMZ\007\260\212\"f\260\213\302\316M\230\311"
+	.ascii	"\333M\265\023`"
+	.string	"6Lj\fgc\332I\2635\217\215\0050\261\260\374ci\033n)\313\240PZm\315\\U\351X\017\314O\311\347\200\013U\006\305{\250\t\304F\\i\273B\313\334\030\353\204\376K\264fx\261im\354\356\376O\026\004\n\203p\264\362s\376\331\201V1\231\240=\340\033'D\330\024-z\216\315\373\375\2531\212\243W\335\001]\312\245\304L\347I\276\033\362\216M\212\302t\002\362\266\323r\037\260\373xV\247{lu\364N'\270\347\325\347\315\024\265/\214/\031\021V\302\f\346\220s\340\177\240\221y(\177F\004\246\313\360\t\254\026v\375w\177Wi:Q\306e\374\366\333\035\322\246\200\355\211\340\277@T\343\372\313\353\267C\240\030\030N\342,B}\214c\t\335\265\262\r\356I\356\274\222\334H\376\250\262L\3644\037Ix\275\322EA\206\213\250\033\356\371%\213\245\377f!q\206\216\357\022O\377\243\234\323\r\337"
+	.ascii	"b\276)\241\327\030\002\263'\2158\n\023\264V\310E4~\002\314+J"
+	.ascii	"\306s\214\r\"^\365\n\335\347\030\002\\\203C5\271\025\272\203"
+	.ascii	"\311}\320\215\323\274\031<\321a74\243\215\rh;\224\262R\334s\237"
+	.ascii	"\266#\212\017\036o\357\304e.9e\232.\312\364\236\304\256\305\372"
+	.ascii	"\243\003\226\367\240\247\277\351\022\364\314l\324\270IX\346y"
+	.ascii	"\370;\224F\236\207^N\314\2054\023\210\374\322\343M\035d\217Y"
+	.ascii	"\214/\203\204\275;8\267\241\206\210\214o\002\265y\252\002\255"
+	.ascii	"6#n\265\024\017\331\270\001\033p\375\224x1\354\271\374\321\351"
+	.ascii	"\b\224\305\2437\261c{\224\372\303\263\001\344<Y\307\337TL\022"
+	.ascii	"\035J0\331s\357\334\367c\335\026 \365\332\210\r}\272<\272\n\230"
+	.ascii	"\215\033i\f1\215C\b\246\230\025\3055\020\316%xb\362?\332\007"
+	.ascii	"\262\3774\272\253\204\2366[\264\200\223\b\267\313\261\202OD\252"
+	.ascii	"\030\023\264\037\260\221I\n\304\377\226\234h\030\322\232\016"
+	.ascii	"M\036\347\022\212\312h\304\311\322\311\301\031\366\216\303\036"
+	.ascii	"h\211\210C\2211\334\203\270\255\325[\246\316\263)iv\310\255\255"
+	.ascii	"e;\331\313~Zz\020w!T?'x\b\331<B\032t\242\006"
+	.text
+	.section	.gnu.lto_gpsNewDataBlock.78.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`8\003\355\031"
+	.string	"v1\256J\260\226Q:\344\312\330\240\001\027\224\0318\247\237,\\\243\313\3466\350\013\206{\2609\212\277\340\fOiW\252\332G\373\326\227\356\035?\t<\235\240\347\260\357\224\376\204\222\232\263xq\\l\r\344oS\333\255\310>!do)\223\f\233"
+	.string	"\222"
+	.string	"\232"
+	.ascii	"\262'\221\270K\255EQL\265\372\030\354\201\362t}o\215\247\345"
+	.ascii	"_\306\323\225\355V\025\320\2513\0076xnKV\265VW\253X\026\313\276"
+	.ascii	"\302*\311\221\316f\331\236Q\024\251-\331\261\233}e\222:\272\243"
+	.ascii	"#\351\t\232\022\210\302\037\377\325\230\225\302\347\304K\003"
+	.ascii	"C>@'g\002a\323\360Hz\200fKw\204\273\361\370s\272\262\373\371"
+	.ascii	"\234\t\204\242L\004\330\351\314\326\021\"\252\007\317\271\235"
+	.ascii	"\215\373\277_\230\202\362\365\256\206|N\234I\013\265\326e\334"
+	.ascii	"\316\347\313\362\335\355\355\356\204\335\216\020MTI\204zQh\\"
+	.ascii	"l\340\223\316\256\233\267\353\253\261\204\025D\341v\321.L\353"
+	.ascii	"\305\345J?\200'\375-_\372\226W\372\222O\372\216#/e\336\311\274"
+	.ascii	"Myy\362\276\200\b+\035\317\356A\212\265\352\212T\252\024\375"
+	.ascii	"\341\342K?p\3678\3669\036\004\256\323\254\301:\211\240\202=\032"
+	.ascii	"\265\366<h\360@\366\245\02113_\325\221DPL=\253Z}\nNW\246<="
+	.string	"\313\356\262\3577dWZ\247e\325:T\305Tke\260\b\312\323\230y\336}\357H\001{&C\"R\265\037\027C\023d\363\226\224\221\202\2724\201\033\214\252\371\322e\347F\214e\367\215'3~NlL\034\005p\367\256\206\r|\234K\307\330z\266\334\335,\345V\345M\261\227\321\236\304x\312-\340'\344)\027D\343\"\033\031\241bA\003\360u<\270@J\034\331c\357\326p\340\343^\232\205C$\251\235\236=h\n\020\223\331\274\375;\214\357\330\257\211\215\211\273k\363\036\035\312Zm\020\366;\316\303\303\336\350ta \3708\020\343\351\233\234QE\021BJZ\360\340\017\004458!&M\rN\354u3\346|\b\001\233\241\257\234\027\315\334\031\031\234\033\016.\230\215\353\203\315\313\203k&\206\343\222\031\260\260\233\232\230+\007\006\213\271X|\264w\321\357/1\274\222\242um\245y\373\340\257\003\3168*a"
+	.string	"4\331\271\007_Z\331\250q\363Q\266z'\267\364\3309\005'\373\277s\013\036%3(SElL\234\265\326\312j\236\323\254u\250\202P\211l\230&\247\206<\355\274\240=v\253\277\023\243\306\305\235M\373\267*\007~6\005\024QW@4.\226-\336\305\220\201\217\0137 `\002\021sg\033Q\340\307\035\362\036H\270Ju\306` ,\312..\332\340\230\254\001\273\003,\023_\017d\254\b@\f\004\0071^\374e64\f\"\231\374\002\033\264G\244\005\205(\365E1\246\267\314\336n\354\003\373\320\226Nnu\207\235Y\306 \023C2\263p\023g\261@!@\f\241\023 "
+	.ascii	"\341F\235\3166h\"mX\202v3\b\034\027\374\340\272\307Sf\334\347"
+	.ascii	"pB\312=<\fk\261\036"
+	.text
+	.section	.gnu.lto_gpsNewFrameParsed.79.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\327"
+	.string	"5\013"
+	.string	"\326TKB0\213(\035\3006^W\314\321\003\270_\350\347\343\217\306t\247\217\263\331\222\311\323u+1\346ZV\244\221\337\n\020\370\261d\361\367\325C\005:\242\240\026\204\342\331\261\2534\224\320\033\230`5!D\312\224\0029"
+	.string	"3"
+	.string	"<"
+	.string	"!\201\322;\274v\013\274F,\230mx`\373\025\213\354\020\025\002\326\333H\251H,\021\273\273i\203\213\236\"\377\251O\304\222\367\224\350\330]g,\031\270\365\2663lc\330\037\020.\371\204\216\262\273\034\276\204\253N|\3243\003\b\345\3433?\244=\273~\201\311\203K5\312\227\275\362R\031\330\307vw\255';\323X\246\365\351|\372\024\226\307\020\342\243,\222\311h\317T=L\037\\\n,y\361N\2637\234|\264F\230"
+	.string	"\f\240\236S-\2602\304V%\355\021O>\246*\207\360"
+	.string	"\370\251\347\253\315\275Bgq@AA\304V\326`\272\017g\343:\033I'\343\3314\240n\303\\\314}6\240\315\204\343@[e\265\307VO\246\204\021\300\221~\276\244\375\001\002\001\374\3243\246\032\036[\277\205\246\212\351I\b\276_\b\025"
+	.ascii	"2\241\025i`x\250d\230\b\002\241\024\017\252\226Bf\275\313\322"
+	.ascii	"#\204\2153X\001\343\002\321C8X\007\304MJ\022\231J@s\031\3602"
+	.ascii	"\030\270\314\213v\222\001"
+	.text
+	.section	.gnu.lto_gpsNewFrame.80.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\235\001=\017"
+	.string	"\226\235eD\360\260(\035)\221\372t0\371\343\204\0266\352\301\\=V\202u\302\365%]\264\314l\255\264\277\207\300\341\265_G\264\273\254S\b4\340\211\360\3003D+\220\331\365\323\033\306\003y\316v\321N\302a\367\2262\245U"
+	.string	"L"
+	.string	"S"
+	.ascii	"\232\177\271`\335Uq\221\331\365\026\370\200\366h\333\f\032\230"
+	.ascii	"\230t\317C\252\243es\022Cc\327\343\264\303I\217P\223\344\227"
+	.ascii	"\0365\366\352T(\207w\035\312\244\310x\271P\241B\271"
+	.string	"\242N\034\002,\232\017\233\n\203&\307\307\356:;\025\207\233s\333\020l#\260S@(\007>\314\275\220\017\342\321\025F\371\356\321\037q\036\2570Rb\270\2140\345g{\247T\026\373\372}_\r\353\212\355\264\307\351\355/\277\346t\3244\324\264\306t\302\364\001\224\314R\033T\257\371vS\237\215\275\2113!l\233\330\035\333\001\252v\210H\276\363\250\001\224\226\234\252zMS\267\223M\354df\312\3177\361\222\231\233R\3368\213\206\305B\225\305G\341\247\270\254eW1\376\t\313\264\2038\217\377j[/Z\376\262-+p\243\305n\351*\266e\331\255\202\316\n\2253\333\022NbD\333\r\237\373\3431\"\021\341B \216\002\bd\204\373\210F\234G\207C$!\"\316B($\342:\236\351pu\305\023Z3\330\212\364I\034\016\230\fp\323\273\376\300%B=\032U\203\255'\277\304\375\001ww\343\200\204jG"
+	.string	"\311w\233\246P\267S\fv\330\023\314\250\201\0012\037"
+	.ascii	"L\023:/$\336\337\n\034P\0017u5\270VC\201\274\217 \332\230i\311"
+	.ascii	"\277\323\006\253\200`\200\346\247\234\201\nk\245\326\216\032"
+	.ascii	"x5\273@f\006.0\237F1\232@\017\327D\217\211c=\027&\270\006\314"
+	.ascii	"\343\240j\n\334\355\334\362\004"
+	.text
+	.section	.gnu.lto_gpsIsHealthy.81.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\r\007"
+	.string	"\262M14`\213\322\001\320\212\210\335\335@eV@U\341\201\310V\273R\316\360`\306ZC\365\202\216\243\366\242\227\252A\020)1\225\300\315{\3220`^\177\262\211\224)\005\266T \246\301\275\213{\270,88\213\005]\205\342\207a\260\\\304{\226\233d{j\025\244:\300\321\216\333auU\325\016O\251c\210o@\200\335E\360G'I\370\2417Od\362\361\315\317ToW\201\f\022'Ov\266I\265\260O\255\202l\2475\323\247\002*B\330M\036\273\237\323\310~\264\222\310\266\306\236\330\340@\343\353\031\306\2072\212\036\016\221\335\314\351\305\257\347\345_\343\n \246\220\210m\236\222\204\335uF\214\342\326\333.\260M`[\024\t"
+	.ascii	"2\241g\037\230\302\004;T\241\270&\246\214 K\210\034\356\234\251"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_grab_fields.82.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\233\005e$"
+	.string	"zB\200\016J\240\230Q:\020=\316\370\272\031\331\226\257'\360\005p~RI+\315\351\332L_D_\033\323\337\013;\363\217t/\00738\3518\215k=\205\321\341E~\005\037\256F\3645\234\337\177\346H\361\203\335[+\277%\204\020\"e\222\001\326"
+	.string	"\304"
+	.string	"\330"
+	.ascii	"\036\266k\r^\351a\336\375\217\017\211N\374\360Y\255"
+	.string	"1\212P\325JD\260\002\320\227KD\337\343>\210v7!D\021\220g\230\304\033\222U+\021g\373\215\371\222\274\215\371\262g,\214w\247\221\305`\257\324\325BO\263$\233w{\020\2479#0\001\235.sz\362\271\340\230\225/(u\356\375\214\030&\003\330\342\257%'NY\334e\345cA\332nO>%n\335\230\200+\216\222\020\222\2440q+\237\n\222i`\361\362'_\220O\322@\360\311\211[\371V\2207S\204Z\322\037\217\315\241a\320\013\023p\351%\311 D\326\322\313\310\253\222\376B0\031\373!\221\266Zk\372;\342\276\324+\fYxa\002\2668\237\021j\255\313#~\300\357\354\273G\260\273\017vK\237\265\276\306\376\203\371\362\335[zJE|\374\303P1\361A\356LZ_\352\002\200\224\271\202\302r\304\306\336\002#GVw\323.\021\004\277\200\020L\322v\214\335\345\355!0\200\347A\376"
+	.string	"\267\023\177\333\362\356\350\344\324pnh6\217\372\326\224\2743\346\2459ye&o\314\344\205\241\274/\2247-y]\314\333:yQ\346=O^\323\344-M^\362B\276}\"_.y_@\366\245\306\357Y\307ZM\034\313T)%\022\034\027\362\023\371\243\336\273\337]\242\375\220\027/\265i\324\216\254Q\022\206*r8 \262\313\032\256\350R+q\301\205\254\222W`\275\210*C\245.\265V\237\227{`\227\344\335\005\r\210\036$\003:V\024\223\324\342\351\233\330wfM7\0203WPUGlLe\307\343\221\352;3\326\003x\032\3261X\273\204d\2264\301\332b\303\325M{\251\337\004\017L\020\275\365\222&\255k\272\327z\316|u\020\024\024\252\347\314\264_\256N\273\241l\320\241\256~O\tm[\267\3725\215\266\313\210\314\021\336\031\327wf\255y\372\024\222)\"=\365\016,M\234\264\272Ig\356\215"
+	.string	"\351p\234"
+	.ascii	"\\\3012\333\326g\263\025$\035e\233\375[\223]\366\0034\331)\025"
+	.ascii	"#\027\336\231\">\376\267T\342\013z\017f\200.A\230\241\361[\237"
+	.ascii	"P\306#HA#>n\212*a\325\231\340:s\326\r\304\214\260\007\215.E\263"
+	.ascii	"\233\202\265\231X\001\030\342S\211\340:\363}\0367\262\373\241"
+	.ascii	"Ck?\007\3420\324\0322t\020\372)\2076\3508\220\030\202\204z1$"
+	.ascii	"\020\002\322\200\313\375\340:\374\\\340\200\303\020$\204K@\333"
+	.ascii	"\034P\206 \334P.\027\204K\211\365\035c\227\212c\222d=\275d\214"
+	.ascii	"S\360\304T\245\237\372\316No\204\2426\242\351\246\356i!})\342"
+	.ascii	"\343_\276'\0362\230N\357\251\323\335\275\205\325z\311\263\326"
+	.ascii	"\354\363\356\371\235\021Be\311yQ\005+\366\312!Q\274\272\301>"
+	.ascii	"\327\351\336"
+	.string	"\222/\234\226\361\256\202\265\356\235\306\027\201\356)\376\324i\335C\362Y\337\n*\313\021\033-\314dmk\032Z\313(\030\215\211r\262\326Zad\252\323(\212WU\345\201\347\334\364\226\265\306\351\336\2465\275d\371\251\333\374\310m\232@\313\250\214\211\302K\236\214\300zu\323\322\212bn\270\002r\250Q,\303\214d\312\320\214\310H\322$\215\001p\002\0312\254\007\020hY\233\264\006\373\2404\2163\025\004'\233q\221j\201}5\n\033-\261\035Vo\007\b\226\247\322)\022\214~8\251)\300\025\311\375<\244a\023\337\006P\252%\316\340\f\210\202\316,\022\200L4\372\2348?\001ZI\334\366\353\232\260\305\267\025r\232y\312\226\214a\323\276\333Uo\217#$\307\327\034\265\"\273\366\"/obL\340*CIOf\201\315!\212\377j\207\227\305B\352\364\"\376\260\334p\226\005u\225@7rQ\316\034f\360\210"
+	.string	"\361fO\364\3249X\034\230% \341\347\302\0240\360\203\215\305n\342K\231"
+	.ascii	"\020\005Q`n\231\037m\007,\032\277\356\202\232\375B3\316\023\315"
+	.ascii	"&\031p\004#$[\333oi\316U\025^\257\263`\232\350\373\003"
+	.text
+	.section	.gnu.lto_gpsNewFrameNMEA.83.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`s+\r\245"
+	.ascii	"\352\376 8E\0208ng\f\034\002~\020\372\344TA\232D\344=]\375\371"
+	.ascii	"\227\332p\310\315\257\323\027\263\004.\r\254\250\261\016\272"
+	.ascii	"\233J\265\354,s\222#\335\266\245Z4\255\n\270}=\325|<u\3268T\275"
+	.ascii	"\211\2242\245\224\002g\0034\003\202\003\256\263\f\3279\206\353"
+	.ascii	"\f\303u~\341:\273p\235[\2743\213w^\341:S%\235\247\\g\251\244"
+	.ascii	"s\324;C%\235\237\210\234U$\235S\0209;upn\352\340\214\242\203"
+	.ascii	"\363\211\244\263\211\244s\211w&\221tfJ:/\0219+\0219\217H:\213"
+	.ascii	"p\235\223\222\316!\\g\020\256\363\007\327\031\311u\366\340\316"
+	.ascii	"G\357l\364\316E\356\334\341\235\211\222\316\311wv\337\231\203"
+	.ascii	";\017\275\363\206\244\263\006\3279\350\235\201\336\031\371\316"
+	.ascii	"\307wn\337\231u\235\327w~\327"
+	.string	"\331\333\005#0x\316\232z\346}\245T\377\274\203,\033\025Z\257\273M\267\232\356\271\356h\267]s\360!\337\340\032\\\310\203\034\310\333L#\235\003s3\367\032n?6\335\327\244\333p\260\004\026}\277\216\304\240\207c\030\337\327\214\201\275 \356\026Z\217{\217\205\3224I\322k\370G\033\225\361}_\241\306\343\316c!5\312\245\257\350+e\350\231%\261\0072\tw\032\026j\226\373L\243I\322R\256%'\321\367\254\252\0058c\030w \233]j\243\266\331\265;\264\315:s\023n\272\256\3532}\307Bf\224\353\333\254\242\203\241K\016;,UQ\345\222\334\036\325\234\262\337\261\367\203D:\306\304\367\215>5\313'\336{L\027\377\373\246I\367\336\367\215\342\022\310fY\274h\302K$\261/=Tt\202dw\214\357\033\235\3725.\3525\332L\345\313f<\276c3\\\206\355\270\216\2436j\320\250\n`\006"
+	.string	"2b\300x\341\242\005\213\025TSR|&\n\352IE\n\247&\024'L\224 \301\264\2444BDR\b\020\037\220<\034\031\025u J\272\034\2066h\020\n\002B\036[v}_r\213mYd\236}5\343\361\235\223\020\234\315@i.\003\345\310\031V\346l\327Q\322\304\241Rq\252Ei\256\343\350\321\312F`\327XU$\362\315`$\205\013\263\341\314\250N#p\352U\201\177<\200\225\212S\355I\317Hr\206=\351\343"
+	.ascii	"\370i\f|\031UF\217\001#\206~\201\230\307]\264\300\323,`\270\343"
+	.ascii	"+\326\027c,\241\351\230\331Y\253\372\220\325\351=A\247:Zi\231"
+	.ascii	"r\330S%@h\251\006;l>\263.\3455\023\035\263\300\265\2123L\212"
+	.ascii	"GA\035\255\250\364\323\0349\256\342h\365\245\357PO\n9Nh\336\234"
+	.ascii	"S\342t\023\034\2758\217b\315\211\274?7\221\245D\037\332\233s"
+	.ascii	"\212\232&\321B;\315\322\264FP?75\317\004\344\311\322T\251\317"
+	.ascii	"\210\030D\240\241\233k\247\031\231V\303\013^H`&\247\331\037\233"
+	.ascii	"t\030\002\360\r\304\337\007\244\243\225\2070Lpf*\370\221\321"
+	.ascii	"\026/Z\371\306\274u ZU\244\315\241\322t\314\376V#B5<\rg\006\365"
+	.ascii	"$\020\037\276-z\234S\376\332\225\023\023\307%\005\2676\266\366"
+	.ascii	"\030\245\2048 \016\3221Y\376\326!\246\riX\\C\002\3157\241\022"
+	.ascii	"\202H@s\240\243\325\037\276(z\234S\322\032y\3458tF\006g\326\364"
+	.ascii	"\226\216Y\332\272\344egc\316\272jQz=Z\335\365\225Z\265\312<\243"
+	.ascii	"\322/\026"
+	.string	"t\026\326N3\300\326}\337\267\310\031\306\\\375h\365\276/;\363lJs\001\315\314\2561\263\023f\024U\001\337f)\007\305\326\327L\016\357~\3537\266\207o)\207\334\343\360\335\205mN\334\334\214\031\236D}\335\325\016\275Cy^\027R\315\320w\032\333\233F6*\364K\235\200\311\r\317\274\214\3634K9\024l\357\373\302`G\343\322%\031#K\272%]\333,\253\310\334\243\3417(\341\371\035\216\034\336L\r\337\3269\343\f:\371/\366-\335N7\334[\326\320\334:v;\240\3009v:\244\0349\3661G>8a\330\343Z>\351\n\354,\260d\340\330\275\254b\272\260\273q\341\302\316V\207\317m}\020NeW\353v\316q\200\262\273}_\331\032;\033#\"\275E\360\301\340(\260?\273E\264\315~\241\300\227%\321\235\214d{\315\336\350\233\202u\252\233\220\025\3643\330\364\206\036K\036\023\316\221m"
+	.string	"B\363\272\322\004\362\242\301\251\250Y\321\360\201\n!\377_\230\2424\223\202\374V\204\240\3437\242C9\342L\007\341\370\253\324\231\245-K\f\003\364O\027\363b;C\244\306\307\206l\377\241\036F\304\277\374m\277\025M\020\373\257\326`e0\361\370O~j\366\033.\311\033\257\247:\220\357;\326\314\003\220cC\232\232m\274\366\003\004\371\276`\315\354\303;zx3\331\177>'\332\240\330\177-f-a\303\013\203\244B\335`\373\317\365\333Y\306\216\023\357\303\212\353K\300v\327\330\354j\231\271\203\336\323et\370\276\257\f\356\304\326\223"
+	.ascii	"w\n\315\362\005@\200\264\315\216`\343\343\377\337dTD\177!lwq"
+	.ascii	"\315\301n\251\363\214\375'\367\024,\314\272\025\017\021\245j"
+	.ascii	"\363\260\357\024a \013\225\221[\331r\277\320\206J\356\024x+\210"
+	.ascii	"73H\333\254\220,\3240|\300\274\272\234a\360\313\247T\202a\321"
+	.ascii	"\347:P\204\334t\030\321\311\214\n\276'-\310\210H\023t~\272\274"
+	.ascii	"\357\233bNsCw\265q\270\377\0301\305\024NPw\265\315v\233\360\366"
+	.ascii	"\365\351\362\206\231\021\221\357\373\325i\214\310d\365\326\361"
+	.ascii	"\203\223\370\232\360\246h\266\241\274SUq\220\314\251\314\321"
+	.ascii	"0\377's\267"
+	.string	"\335\237(/?\n\314\356\334\203I\347\026l\275\346\016d\347\006l5\315mW\027\245\233\353\271\346\276\322v\315\335\354hs[\3511\335\r\245\314un&\330\352\334_\375\266\231\346\245\353\354\345:7q\235\231\274s\227\353\374\201\353\354A\221s\007D\316J\"\347%D\316\\\256\263\222\244s\222\2443\022\327\231\203\244\363\221\244\263\021\327y\203\244\363V\322Y\003\327\271H\3229\203\2443\021\327\031\203\244\363\005Ig\013\210\234\265\210\234+H:g%\235\207$\235\261\330\231\002\"\347\t\210\234% r\216\340\235!p\235\037xg\007\336\271\001\327\231\001\327y\201\244\263\220\244s\220\"g\005\\g \256\363\017\3279\001w\366\341:\367xg\036\357\274\303uF\340\235\017xg\003\334Y\207\353\\\200\353|\345:\023\340:\347p\235\007H:\343H:\013\340:\337xg\253w\266\221t\256\341:\323H:W\275s"
+	.string	"\357<#\315\342\237\034\355\256V\307\017\315\255d\353\230\216\357\274\216\232\242\307\230F\206\315\212\177r\213>S-\370\237\346\252\250\214\277\371\\\244\032|\273\025\254\353\350p\375\372<\346\036=f&\321\257v!\247O]\222\201\260,+k\233\355\301o\262\303\246Z\255V\233\253\355\300o\301\357\275~\242\"\030f\210g\2707w\302\2243\337\227\255\272\243\246d\b\245\376\311}\365(\024p\247\261\200\377\321F\215k\302\351\226\256)F]\375\"T\213h\t\370\253o\262*|\210\020\360G\332\376\304-\215@\350\004j\217\226Y\333\242+u\222y\"\354\206\362,\230\036\230Ol\233!\307#\016\3609\036\317"
+	.ascii	"\257@\233b\243\237P\247\002\307\337i\256V\200\307\301\377\302"
+	.ascii	"\033r\205\260\224\"\245mV\200\030\342\232"
+	.string	"iR\324QN\271p\266D\373\323\226'\f\237\033^\324'TF\035\016\212\260D\253\3617\376\350GF\265\361V6\276\315\023\bX\343\217\204k^\326\364K\327\2628\321\370SJ\261\305\031a\211V\3654\376\b\370\306M\325\037\355h\251>\371>e\324\341\363=\233\245\225\345\225%\032Z\333,\215\266\246T\317\370"
+	.ascii	"\272\3713>\304\023m\221\214\n\246\246[\013c\177M\2774\351\361"
+	.ascii	"K\373\364>\217\235\254o\314\267\360\365\245O.\361\215^A\321\312"
+	.ascii	"\266\233.\224\t\364\304\226\361}\345\327\273\261\264\030\277"
+	.ascii	"\276\214\357\261.ah\272\305\307x\017b$,Zy\030\337\315\177\305"
+	.ascii	"\265\225\355\213\207\321\325V\266.\376\3057\236\213\3570mn\032"
+	.ascii	"\233c\335\342\333\312\257yci,\276\305[\351\025\317\342\331\351"
+	.ascii	"\030\225\t\324\257\370\243;\022\f\307\322\302\274z\302\323z\375"
+	.ascii	"#X\336Z\031\300\207\353\366)\233\240\3722X\246\236\352\327\351"
+	.ascii	"S]t\352Y\251\0262,\364K\265\304\225\220z2XA\242^JNL\324\263\204"
+	.ascii	"ZV\370\322\255\245\313J\246\270G\002\f\273[_\t+\260\263\325\351"
+	.ascii	"k\276\227\325\251\274>\324\013=\233\206d\324\266v\251\026+\317"
+	.ascii	"\364\224\345\337\272<\227-O\325\263\351\222\212\023\036\332\226"
+	.ascii	"\342U|\013\270\246%\305\267z\324\032\245,*9\251\275\232\263\351"
+	.ascii	"\235\236\005<\036\242\370\246\3770\035\023\023\326l\236\323\236"
+	.ascii	"x\024\217\244h\342O\244a1\361l\243\232\f\037\202\236\021%\236"
+	.ascii	"O\002\327_\361c\356\361f\277\266\361\276\312\217P\002\360\313"
+	.ascii	"\272\325\376\330\3014\272 b\n\273\035\365\315\330\351\374|\024"
+	.ascii	"\3661\214\017\205\375\231\247\325\322.U{\343I$\326\036\204\177"
+	.ascii	"\322\3361=\211\240\346j\227\236\351?\344\215\301\205\275\330"
+	.ascii	";Y\372\226O\215.J&\204R\333\177-\335\376\345:\275tkG\274\322"
+	.ascii	"\367\030\234\210\037\361\254\037\324\364\217\210g\t\325\342\310"
+	.ascii	"\200\001\221\264\305\033\225(\030C|\322\263\205dT'\177\352\306"
+	.ascii	"\363\031\024\227"
+	.string	"oK/\336\314\020\317\352Q\3632(&\346\355\003\210==me\373\341A|\2235c\370\360N/\304AB\372<\276\326\036\036\351\233\214J\230WaX\256\020\304\303\267\030\266\302\306&\273\351\313\363\360O\252\356j\217\002\017\r\217\n\301\364K\325D82\372\302:Eo\364- \035\302\"\301F\2437\335\325v\b\004\354 \030\367\305O\021\021\030\227\263\224C\361\307N\223O\004\347M\362[\251s\361M\261\203\033,\004\310\225\017\034;~\370\340q\325\362\215\253+\037W\255\326\026\021%\023\034\331\322R\002\264\305\225\244H\226\026\006YH\"}@\017\255-,$\026\034\267\270x ;\250@\207\022\255\"YX>\226$\021\332\302B\202\345C\t\026\220%I\202\262\232\263\244\222\034\271`\312\b\221\251\r\210`mMe!I2%U\304F\216h!\231Rb\304\b\222)!0\260^o,\177\355\303\356\367\313"
+	.string	"\177\t\354\303\270\337o\300?\212mY\004#\300\213\r+\373&\357\365dU\302\274\332e\317\316~5\371#P\304\270f\016&v\252ZL\376\0074\317"
+	.string	"P\236\254\323.\017\207\177N\264\225\340\301w}\260\366)\342\301\177\360\034\356\266\274a\034\377\344\241V\266\036"
+	.string	".\026\361\340\217@\361\270\351\276\353\244\324\355mP\200\274\356,i\370\002\255|\254\207\316L\347\244\372\260\227_\266*2B\r\303\334\370\247\225\215(\211\035\254\177P\227\231hg\203\203\365}\2356\022\355\274\335\264\237\227\036\222\311\354\305\347\325\347\315\344\267\003\365\243\364\013Z\362J\2476\327/\031\362\\\357\341\316\315\220\214\252\344M\222W\362\354\024\311'y$\305!\217D\220\2038G\236\203g\247F\376H\235\036\362F^\251\320\355\315\006r\266~\203g\363h\360[\377\341\216\206\223hs\265C^\203Wz\272\351\025\001\314\340\213<\013H\3443\3405fD~D\241\333\031\f\004\333O\331\304\306\334s\301c\360\254\005\177\301#\025\216\261\t\033l\254\267\340\225\236\320\352\230\030-\302\366[\2725\261\261\205\034\366*x\255\254\257\340\221"
+	.ascii	"\311\250\\-\326g}\373\365\004b\320\30516\"F"
+	.string	"\bSc\310?\365\271\n\006\016\371Vcg\016\316[\030\032\377\\\303\032\353\375\316:\207K\016\326\303h\353\252eK\3017\"\017g\366*\3642\364fR\360o\007\032g0\354\277x\002;\353\0337yNX\333\364M\360=\007\332\246Q\002\030V\276\245\233\322\236\332\272f\351\226'A\233\270\271=I,@\365\030Oh\267\003%\023@\004yV\351\322\rM^\333\212\267t\273\213\340\273\r4\017\202\030\3262vu\212k+\335\034\004\337\201\320\274\007\364\254c\224r\200[\3268e\230\007\276\341@\3254: \303\312\302\n_\300\254po\016\250\211k\340\231\275\024W\025\226rM\207\354\265\270r\361j<q\330,\257)\254[\274\374xM\275\252^\325B\346\n]\312!\327\266\006\276\377\240g\032\347\272\013\235\304\031L\240;\f|3\237}\325\302\300w\032\364L\\\023\314\320C\303A\263tC\2538\341\235 "
+	.string	"\253\223\235\315/m5\201\375\351W\326\345\375,\200e\201w"
+	.string	"z\027\327\024\362h\177\330A^\310z\205\353k)%\310w\023j\206i\255\342\345\246\353\3500\005\356\005\332f\233\016\371\200\255\"\254T\026\b[\212\211\265\315*\360\016@\315\3045\221(\360\245\311\200\321\321o\3034t\210/\272\356\033\354\313\354\036\3107\334z\006\344\231\264U\033\233`m\367\237\207\214\261\327\312\366\307w\364\307?\025\2660\376)me\233\300w\335'M}|\002\357\224\207}\361O\366\026=\367\316\242\351\276\277\276l}\322>\242\326\020\240\370\370\346cgu\321\343{\216\307\367\360\261\343y|\322\335\216\017Q\350-\376)m\004\276\351\016x\004>iJF\0053\340\017\320\361\006<R\236\203\257\250\002A1\fJ\312\320\314\210\210$I\ni\r\262\013\020\b\002I\330Jx\036\022@T5F\244N\251\032!I\222\026\003"
+	.string	"\004\300\035)\200\266\332\3523l\326!!\272\3412.>x-\nY\271\215\377\023\360\210\030\007\226\343\025\250\326\351m\016\334HAJ\337\213\256\336\332(MY\026\321jFpy\315\337\200\220)\213y\372\203^63*\376\322\021\213\330\363\311\336\nd\035\327\f5\r\211\206j!l\276S\021\265\336h\253i\r\001\346\237\247\n7\226x\202\350\0238\266H\343\035ul~W\337]\363\"}\027\214/\017\357\301\027(\215h\001\240\340E\277\035'\235\300k\t\330\251\030L\252"
+	.string	"C\341\206\212\231\017\243\023(>\311\364D\244\373\031\351-\211E\215\200\350\037\\n9=\353\314\3302D\252h\210-\216rm\247;\326\230\251zN.\213\270\326ke_\001\331n\215\207'\232\f7e\261-\t~\342O\026\030M\243\027\004Ev\314q q\271D9\342lm4\022\300i0\031iV\371e^\020Z\332\347\177>\266\225T\270\214#;\236\344\265\006K\207\213\365\370\221\024-\230\210\216\004\"K6\366\212\244DW\375\035m\253\036\035\201\362\217\207\263d\255X~\310.1\303\321\352z\266z\220o\377;\341\375\257\217\257\332\3046\304\034\227\300h\357\370\300\351\360/\272\252#\364=;\277\224\027\340"
+	.ascii	"^!\n\256\304O>"
+	.ascii	"+%\340/\305\254\377\361\005!\360\325\266 \260|\245{wj\r*>\210"
+	.ascii	"\001Nn\033>\261\030\261V\256:N\225\263\252E\236\353\246\225*"
+	.ascii	"\242t\025\212\331D\322\213\232\300T\t}F\331\246\305K\333\343"
+	.ascii	"4 i\237\021\212\241#R\374vq\374\222\205M\323\215\362\202\300"
+	.ascii	"\177\355\023\363%\003a\243\375\336\233\307\315\3745_\347U5&\322"
+	.ascii	"\215\276\262\360n`\367\343sp\006*\351-\235T\263\233\315I\247"
+	.ascii	"\003\023\203H\271\217\031,\031\332\210\326{\374VA\331=\372O\f"
+	.ascii	"\373\036\271\361Ggwf\314\374\375\305\243r\nxs\n\016\316\307\247"
+	.ascii	"\267@n\351x\224,\300\210\030\335\317\373\334\313mK\273\244\204"
+	.ascii	"\240\255T\335\203\003\330\240\003\020\240\234S\034\025Jo\360"
+	.ascii	"\036i\0012\247\376\225\220!\030k0[\305\0311\300E\3665\f\274\261"
+	.ascii	"\243/\036\202\267\350dTo\306\242\367\213v*\006z\363\3369C\312"
+	.ascii	"B|s4\"\367]6\276?\013h\340'\270\250\017\301\257\\\nf\317\022"
+	.ascii	"\001:\257\031\266\321[\314T\346\2576ce.\223\215}F\001\255!\327"
+	.ascii	"7\3314\255\3321`\201?i\023\322\357\235,4\".\357+\3635\253M\347"
+	.ascii	"\216\374\222\340\022f^\375b\005\234\3600Y*\272\330\212P\346U"
+	.ascii	"4y&d;kL6\020{t\366\214t\211\241\246\235\252\323\242\320\251\214"
+	.ascii	"\f\260\3536\334\266\241\024\344\245\002\271\025\0066\374Z\313"
+	.ascii	"\016S\317\363\275\361\212\004\216\337\215 ?\377B\007\227\307"
+	.ascii	"c\360\334\034fI\230L+b\372\013\367B\310}\322\307\bI\005\361;"
+	.ascii	"B\2134\365\347\305Y\200\027\236\230\355\023\217\230\024\007\366"
+	.ascii	" \333\350\26392\226\277\370\213\313\317\377\201\036=j\325b~\365"
+	.ascii	"B\177\336\246T\225I\256b\016J\033\374'\306\223\377\3157\334w"
+	.ascii	"`\374\223\017\016\257\031\2126}\371\305SE\\\334wS\007\2102\177"
+	.ascii	"\341I\273\355\263k%\t\216|t\274\r\302e\2062+p\334\226\bDN\326"
+	.ascii	"iED\027\223]\363\035\312\246\263\007\322U\363\203FQ\261\201\003"
+	.ascii	"\351\220\264\361\376\275\332\f.\356\305\265\206\221\255n\213"
+	.ascii	"\255\230\232\325\177\203\275p\276\327\214\222\023\212\321\265"
+	.ascii	"\311\210T92>!\034\256($\316$\3537\343\257z\024\326\004\036\227"
+	.ascii	"\330BT})\006\241\244\224\026\1772\021`\335\023\b\311\204\016"
+	.ascii	"k\371\255\265\nlp\013\032S1a.\240[J\231l0\037\2665\257\350\331"
+	.ascii	"\226\367\231M,C\301\310\212\027\377\304Y&I\312|\006\236N,}pP"
+	.ascii	"\3326-\260\025\355\020\303\371\366\347\031\257f7\314\021\355"
+	.ascii	"\2502\376\261\301\005\361;\323\327-\251\r\351bt\330\262\013\003"
+	.ascii	"`\3665[\240U\240k\256?\b\337\242\003c\303\364\274`\263\206)("
+	.ascii	"\n3O\033l>\234\276\030@\277\340\354\363\003\273\226{\366\207"
+	.ascii	"\233\347\343\017\225KS\316;^0\272\323\263\367\324\317\243\224"
+	.ascii	"\235&\235\247I\272\242\177\252o\21419\216X{l\305\004\f"
+	.string	"\240DX\360\016\021;u\320\\\370\231^ \231\301_\200\223\364\365\221\223\352\224\336P\366\327\372:\"\362\035\023\347t\214y\273\337\356C^ \316\024\263q\300\0224m)\340H\322^\\\322C\213?\343\237\017&^\003Fm\322\036\265q\312\300\221v\r\330\351e\240\037m\022\205\225\2406l\027 \274&9\320\220\242\363\370\004\305\220\006-\362\n\030\021v\302\307\216\321\264\267\302r;\277\300\202\371\016\365\2579/\325o\304\204\202\231\274\341\270\220\342\302C\215\350\371\007\207\302\360\341*\360\331Z\210t\367\343\3272*\026\274\335\036\032\350\343\222\025^\0169\302\257R}\210\223s\211\221\200\204Bi,\340\223\353\214)<\023N\001\32735\343*B\252\215P\332\253\333Mvtpmx\nQ\205\361\362\226<\027\366\361\375\302\371\275o\272\361U>\254L\301\302t\223\364\305\006\366`\013\334\324 8\276\204\253\200Y\335"
+	.ascii	"\225\254\021p0\270!X\333\007\350\031\337\357\024`&zjM\232\214"
+	.ascii	"/U\302e\024\254\325\241\354L<\304\237\322\226\223d\212\251#}"
+	.ascii	"&\276\317\367c\373[j:|\271{<\220\237z\275e\354\272Cob).\007\346"
+	.ascii	"=\262Q\202Ez\221\n\0276\360C\2023\323A\005\201\250\201'pm\025"
+	.ascii	"\260r\375\2318\b\342!\255>X1\247\342D\262\241}\3439\316\372\270"
+	.ascii	"\234\371c\376L\t\344f\333)\212\001\327e\237\316\341@<b\324\362"
+	.ascii	"\236\027\020{N\265\007\257P\241\305K\346 Eg\0011\343_b\013\003"
+	.ascii	"K\340@[4\333)\346*\025S\002\335\231@\377\271\034\017?\27455\300"
+	.ascii	"t\2747\367\267\224\b\307\220\322\213\254:0\325\361\2714rW\232"
+	.ascii	"\251\302\0300[\2402-d8\270[\017\267\237\334\243\275\303\271\020"
+	.ascii	"\022\242\005"
+	.text
+	.section	.gnu.lto__update_checksum.101.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\344\001\215\020"
+	.string	"\246^lF\360\316(\035\n\226h(\301b\f\203gP\022Vd4\021\356d\235\235k\001W\267,+\212\243\375E6tl\323;\2057}'C\362\251\321\2608\3345\270\3125\022J\265i#m\255]\005\003\377\023\262\267\224)\005V"
+	.string	"V"
+	.string	"W"
+	.string	"?\260]~^`\273\364\312F\361\017ff\224hQ\201\266b\316\331\355\005?|\374\356\250\253\313\270\272\362\025\200)^\236\311e\344Z1\f\001\274V\344\340\331\2719\355\n\363X\0325\254|O;\004\035\260\366\362V\256\334\2039\247\365\345\251\334\333m\233l\217l\035\005\007\020\372\367_|\366\203\376\335\334g\367\026\3252\252cToTkT\237"
+	.ascii	"\002\0131*\307\t\347\214\205=3G\336d\300\260iT\031\003&\312L"
+	.ascii	"\313\206L\017\203U\333\301h\365/\345\235\323\305"
+	.string	"\304\202\253\375\016\367\260\372Lu\321\234/\037B\314\3715p\202\317\245\277.\2548\347\234qe\2667\276\255h9\031\210\343\332\300\322\320\322#\356\256\364H}\342JP\004\214e7\004\376\245B\367\273{\026.\027\026JWG\274\366\221\372\304\370\252\355\362\273\311@\0200\226\023\r\267F\242\345\355\312\354\317D9`xv\274/\266\3504\277\200\313<\021:DJ\221\324!R\212&\220\tK*!}D\2274HF$t\247\220\316\024B\242\320\225P$\235\206\001\237F@P]\311\351\204\3520\276\371}1\210CK\316\311\262\344\312\034\253\261I\331\320\305r\013;\355O\251\261\231\255h\035\025\264\333\302\214\2329\201\242<~\370\324\306mh9\035\260\346\n* p\202\231\224\333b\340\225#A[3Q\221\243`\024\003C\214\273\r\030\351\263.\235\346\363`\333\240\013\347\005\217o\230\255;\030\2363\340\324\006\263"
+	.ascii	"7:\"\312\035\243\371\2256p\255\r\216\035\003\263a\006\246\224"
+	.ascii	"\035|\f\343\006\340\210\200D\t\367\022Y\310\023\224\335\f\242"
+	.ascii	"l\272\350\023"
+	.text
+	.section	.gnu.lto_UBLOX_parse_gps.102.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`^%}\215"
+	.string	"\352\335l1H N\333\031\003\377 O\245}`\370\221`@\253\020\337\207x\223\004\316x`\210\277f\272P\273\2233i\237%\332\223(\\\223cVF\266a\260\331\271u\250=\310\007-\0221Db\272\335\307}\245\375\266\267\310-SJ)\337\002\355\002\021\003\316\022\264\3169Z\347\bZg\bZ\347\007Zg\007\220\316\r\264\3168\330\231\001\244\363\002Gg\005\216\316\t \235\021\030r\2761\344lc\310\371\200!g\003\206\234k\034\235\013\030r\2461\344<\003\351,\343\350L\300\3219\006\322\031F\353<\300\321Y\200\243s"
+	.string	"G\347\027Gg\027\2553"
+	.ascii	"\255s\213\326\231E\353\274\202\235U\264\316)Z\347*\2443\025\322"
+	.ascii	"y\352\350,ut>\201t\216\022r6\201t\206\022r~\312\340\354\024\344"
+	.ascii	"\334\024\344\\\342\350L\342\350\314\024\344\274\024\344\254$"
+	.ascii	"\344\234\024\344\214\024\344<\002\310YD\353\034\202\235A \235"
+	.ascii	"\217Zg\243"
+	.string	"\326\371C\353\354\201\235;\264\316E\2553\207\326yC\353\254\201\235\211Z\347\241\3269C\353,\324:\007\265\316@\2553\222\235\217G\347\366\350\314\036\235\215G\347\265\243\315\337:;\353\334=\367\242\216\013\0061{e\3777\367*Y\364\363\372\031\327<\333Lw]7]w\264W\346f\3562\334vf\2604l\235\275\033\216\370\351s\016\276\357ku$\303Am\034\323uYMw\302\322\326\334\2535\344UET\003\324s\334b\300t\230\254\246Ca}\311\346\336\261\240i \025\016\361}\303\234\216m\344\271\2433gq\313qP\303u\\VG\211\364;\366v\021\304=(\203\357;'\325F.ql\343R{`\333\270v\021\333FV\321\"\213\225G^Z{P\354\221}I\021\337w\316\352\253@\261\206^\347\232\235^\331*R\240\260\252\242\232\222:\021e\002\352i\205SS\t\022LKJIH#D\204"
+	.ascii	"qd\364\301C\207\"\016\0334\020\re\020\n\002B\036[\326\270\276"
+	.ascii	"+\271\265ZE\373WD\017\256\2326v\247S8\001\035\205\223\352VU|"
+	.ascii	"N\325\267\347SRr\374D_\034\217\362A\335b\342M\032\207\272\353"
+	.ascii	"\247\273^\261\266^J\234M'\f\317\372\"qp\315\031wjg\2600\206\246"
+	.ascii	"\233\034M\227\260k\022vf\234\251\017u\211L+\221\221\363$2QG\032"
+	.ascii	"\2216\026\327\"\340\276x\210\267\006\001}\363#\250\233\033\365"
+	.ascii	"\326\235\376\360t\272\007'=sp\320\016E\353\n/D)M'\254o\025J\374"
+	.ascii	"\252\323maW\234\203\025\337\300\326\032\330\232N4\245\207\314"
+	.ascii	"\246x\006\263\266\260\025\\(\250\217\211NX\024\007bJ\033\203"
+	.ascii	"\322\310\365\204\231\036\023\017s\324\362t[\030\024?\322\t+["
+	.ascii	"\227\332\302\310\274mg\330X\303\363\006\256\2326\326\327\254"
+	.ascii	"\2236\002\2119\351uH\314k]z\337\267\345\332\301\304\272\374\313"
+	.ascii	"`\311\"\345\013H\214\013\216\036\333&\221\002\355\2640'\322\333"
+	.ascii	"\031\357\373\2623\305\306\232Y4\363\373a\346\024\314$\234\002"
+	.ascii	"\257\305G\317\254\\\342f\224O\312\0046\361:\345\023\2501J5\245"
+	.ascii	"\246K\217\276\315\234y\240FeN\227$\n\343\212Q|.9%\247Tk\212\032"
+	.ascii	"}\2679\377\252\033>\300y\370\017o\036\376\312\371\247aH\252\373"
+	.ascii	"\214\035\2344\031\246\272\203\016\376\303\360\361\322\301\255"
+	.ascii	"\203\357@4\364T\330Y\350\242\027\262\263\202\273\220l\276\026"
+	.ascii	"\224j\355\246K\3217_\006$v8|#\231\342m\311'4\337\242T\323\302"
+	.ascii	"\341\033\212\323\316\335\024\206\216\372\322\304O\313\025\205"
+	.ascii	"6`q'\255\3417X\321\360W\316:P\262\240_cGJu\327\331\345\t\036"
+	.ascii	"\247z\310\203I\365\220\3770\206\213tw\210\276\351xL\302!O\364"
+	.ascii	"\375\365g\313\027Y\240_["
+	.string	"\253\372\274\024\"\237\312w\222\035z\241(\035`\227'\256\371Z\262\365\250(\2574\236\332\320\267\036`\037\337t7\277\345\272\217D[Ng\370n>\373\027\031W\025GK:\261\371\231\362JR\323\247d\370v\342\354c\303\207X\350\327n\2277Wm\177\255\225,\024e\026%\227\036\316=7V\210L\261\223l\320\013}\177\2215\t\372*\2752#\320/i&!_#\037\350\373\213\t\227/\272X\362\251\003\371W\316<\350\b&qn\353\257\261\222=\376\025\335\235.Odv$\236D\251\334\242\344\342\315Try\001\234n\252dm\013\016\3064\202\007\324\214\307\262\337~\213f\371\306\345\305\227XT\356\205\303\311\273\330\357.N7P#\324\267\\\313_\345\227\376\243\350\307X\215\256\317\254\214\353D,\017T\245\\Wi\020\0356b\215\003nx3o\260m|)\223\220\023hC\254\251&\363\002]\210\243\t"
+	.ascii	"\302\216\301\001n,md\br\344\370\326\342\304\203F\325\b\231\340"
+	.ascii	"l\343V\330{\035\304f\020qP\313\025_4\023\007\377\327\002\271"
+	.ascii	"\005Q\364\031\274\303\215\207\203\240\0328\267?nj\253\207L\035"
+	.ascii	"\356)\273gF\313\034n:\217\307\017\316\355=\343\343\356s/# \""
+	.ascii	"\234\333\373\312\341\326k\3007\334pX\360\330Hl\033\273\317\336"
+	.ascii	">A-\357\331\033\345\206\027\363\230Iy_\2556cAg\276Q\353\013\305"
+	.ascii	"\37707\233n\223\244@\207\216\257\272+cj\036,\267\032\025x8\025"
+	.ascii	"\0137\tl\033\215\250\205\215\246\323\220\300\215\205/\360\341"
+	.ascii	"\315l#\267\017\266\215\375k\n\007\315\342\310\266|\221yN\313"
+	.ascii	"\177\215\271?q\360\205;\374T\230\233G\347NCk3\315}\206\244u\356"
+	.ascii	"#^\375\266\316)\034\235?`g\017\216\316\035\034\235\207p \204"
+	.ascii	"\2357`\347 \255\263\006\2553\020\"\347\fZ\347\037\2553\006D\316"
+	.ascii	">\204\234{\b9_ \344lA\353\314\243u\336\321"
+	.string	":\353h\235+h\235)h\235'@:'\217\001n\222Tx\356\024\252\371mp<U\022\003\177\305\300\367\236h\334\002\377\302\253Q\340\027\370W<\354\004^\201?\302+\363i\260\\\240q\247-\232\177&\201o\275'\032\004\336\314\227\271\361\b\374K\227|g\354p9{_\226\261\270\230\330\365\276[%l\374\215\227R\\\266\355\360\003\320\270wl3m\374\222\001O\343\017\370\307[\232\325\370\032o\300+\031.\333\n\370\032?\002o9\370\302K\261\232\217\030w\332\205M\272\002\276\371\260\315\370\031O\343[\303e\033\327\317x\016\322j\336rP\306\203\3719\002^F\214'\340\331\275\345\033\027\233\217bMQ\343\334\351\023\025.\306w\333\363L5\n\343\337\036\212\367^\224O\234\\p\247\337\002\214o&\3173\003<\227o\313{-\311\247\346\323\23565\235\003|\223=\353\252Q\001\036\313_y+\376\325\001\274"
+	.string	"\317\032.\337\270\340|\023\013\252\212;ub!\200o\263g\035\364\005\364\251\250\245\311\371\263)f/\252Q\027q/\345\243<\224\275'\303z\242>q\247MT'.\276\241<\307@\243H"
+	.ascii	"<\223\026\017\300\217\265x+i\331\b\026\037\266\342Y|\222\025"
+	.ascii	"\177\365\024#\002\204T\303\260\353\023<\232\352\017>\370\017"
+	.ascii	"s\270\250\342\217|\360*B$\005\026\341\003\221\342\337\355{f\262"
+	.ascii	"\317\030q\247=\346\213\244\370>\303\306\301L\"\334Q\nAv\252>"
+	.ascii	"\2059\277L6\301\360^\3564\251\371]UQ[\207\210fqNM\n\021\215\360"
+	.ascii	"\232gt\377\026iX\341\207_S>a\251"
+	.ascii	"\376\212n\357"
+	.string	"\337\327R>\371s\001\275\231. \333F\252O\301\251X%k\243\350f\247\335\256/\314\303\257Ei?.\036%\227\n\234\207\210\205S\201\236X\375@&\241\324O\375+r\232\260\023/\365G\201\3137.=\316\007\013\006\325\320\355\323\242Yx\342\233\320y\b\215\332\343\204{L|\324\3774\006\327C\244J\320\355\363\024h\342\333\315\311\247\032\205zf\327\320\361\334yz\250\177\251{\350T\"n\325\377\334>Mv\236\370\2701\004l\266/x\035PX\3377M\306`\030_d\032\336\322\026\343.\036\337\367m&\263RK\311\345\315\344\006\374\022\347\327\365Z\354\364M\327\256\310$D\226}\365\341\321\322H\266\351\235~\252\304/}\323#\221\370\0221\272\346\230\236\304GM\227o\\^\276\207\345\322\246\236R\255\375P\3450\275K\331\224\036\351\227>\204\342\322,\351\225\276\034\016\221\316\363F\251\326u\362\222\276\363"
+	.string	"F\317\332\212\274\315z\354\210G\372\020\322e\233\210\037\361k\340\327\237-#\336F\t&\203\312F\251\346\242\271F\304\267\2306\376q\nV\331\bG\372\247\310\325t\243!\271C\007(\324Hl\210o\264\273\244U3\215R\355\211\212&\304[\261q\3705%\r\342C\b\300\231\225J\224b\336L\020\337\200_\274\370q\005?|x\020\020\206\224\340c\004\020\202\224\200\034\322\f\244\212\204\021\204X\2110\304*\204!?@\260\002rE\202UU\007\026a\204 WV%\210 \302\225U\320\334\333O\205U\330\003Vw\227\302\243t\3135\022\313\236\237\272\273\017\256\244=\360\340\375\271\270PE\340\224I\250d\305C\346&u\3432W\346\026Sl\3605"
+	.string	"7\350\2748M)\212 \237\301\372\027\344\177\211\030*fqd\317./0\255\276\016\f~\334\2524x s\3744\340\333\323\003Bu\2463\210\223ex\204\223\301\357x\036V\363:Jn\317o\312M\226\341\207&\236\nOC\304B\026L\026\251\324\217\307\340\337\005<+\233\344\232\037\337n"
+	.string	"\003W5\311\036\223\245g\275\313\332\323b\232i0\370\036\303\326EK\274\020Ot\226!\353\343\257\262bX\355\262\f\217k\231\325L\326aV5\253O\037\266\215>~\307\323\020\032\215\323Qrl\242z|\335\332\326\027|\217\357\245\031\327*f\225\022\341\306\302Y\212Y\213\336\314\254E\266\215\027|\207=\365T\331\304\2571\024X\037\263\247~\337\310\256\032]a\301s\360`DX\016\276\377@\2655\007\337\357\027I\025\357\226f\\`\346\254\004\337D\223J\3248/'OA\267B\267\376\362\326a\317@\304\302\255$\353\\\275\270\340>\003\335\n\237~\215{\305S\3418M\355\365\274\226\370\027\362`B\336\202\257\301\343-\350\302\343\215"
+	.string	"\273{u\"\302\n\371\366\372\2425?}K\263-I$-Z\\\2533\013\226+Vv\374Uu4\223J\324*^{_\353Z\222"
+	.ascii	"*n\223\030jnY\2134\027\215\nM\307w\342\363\017Z\301\224dR\323"
+	.ascii	"\314\210+\266J\301V)\311\030\324(n\023\030M(n\031\213f\231\213"
+	.ascii	"6E%\253\340\233\317\323N5J\301;I\"\361\312dm\342\"q\225\270b"
+	.ascii	"bl\033_q\311:\226"
+	.string	"\214\321\324\262\212\271M\\\274p\237\254an\231\225\022\027m*\t\005\337\205O;_\227\347%\326\304\264\036\351\016`\325(\tn\"\354?\030w\211\325H\203\365xN\335\nI\374Z\222\235\340?\314\237*t|]\236\310\023\254E\222Qt\3541\t\267\334\025\326\245;e\365r\321\222\326\256\t\276\235<\353@\243e\236}\210y\332\355\016\375\230\326\327\030Fq\320\f\356O\313\365\312\367\334C,\\:\241.\004\3572M\306]s\253\270l\321>\277\344\025\t>\371o\310\327\235\366\022\270\025\305\345\033W\247}\224\341\222\017W\226G\304\352:\207\356\264\371\370\364\331\267]\333\210>\363\2409\236[>\006\302=9\"\340\242\330\302\013&\253\002\335\351T\236\b\276\335\236n \360\002}@\352\037\004x\325\007\276\354\305}\235\344\024\f\356\364\211\316\003\337Z\236xP\007\344\232L\022\314\367\361\3559\360\335\345\331\246\332"
+	.ascii	"]\223Q>1\372\251\364\343(\237\300y\323\3007\2316\266=\333@\371"
+	.ascii	"\347\314%Q\352#\200s\032\307\367\221\272\017\202\367\250\302"
+	.ascii	"(-N\322,C3$\"I\222BZ\003\362\013\020\210\001aTJ\267\007\022\240"
+	.ascii	"3-\210\263"
+	.string	" dHI\223$\215\001[\202`%6\"\222\352\034\347m\271\034\255\\\333\373\024Q\016$&-.\345\321.\324\346\035\200\2374\263J\357\n\234i{\307\256\335$2\254\020\023\264\252\271\337i\037\342\3346\265da\177\313\343\022\351S\324+\223cx\024\232\203q\030\215\003\212\303C\366w\bpJZ\267@\013tH\026%}\310\224ru\321V\371\3404\tc\233\024\232\376u%\242w\244\372\027\342\257h\177,l\315\007/[r\355\r\200gI\017Y-F\017\347\305\207\347p \022a\371\205c\352\311c$\325\225>R\311\231f\312\243\370\177D,\rxn=\003\311Hi\317>\022\345\f\320\242\364\002\376\264\b(x\256RE\306\354\263\362^\331\342\303OP\376\336\200,JK&I \255\031n/t\264\375\375]>E\255w\316\356UOw\331*2So\226\257]e\276\024\373\333_h\351\352]\326r"
+	.string	"\026`\223\204\355_\037\341,p\244#$7Z\030\241"
+	.ascii	"\030\336T\221<L\213\241\376D2:\323U\226V\f:\242\202\273V\323"
+	.ascii	"ki\224\306(\327g\245\315U\177\374Y\351_{h\213\004|a\005\204J"
+	.ascii	"f\200\357\376_;W\230\004\352Qd/\311K\213\346\357\025U\222C\274"
+	.ascii	"\006\334\217\016FD@\004\n\337\242\"+\332\213Aa\376\340\\\341"
+	.ascii	"\217\203\024\017\227%\220%\321\315\371=\220~m\205\250\020 \n"
+	.ascii	"\237%\313|S\356\020\020\177\253i#\nh\246\210,\252\240\337\b\243"
+	.ascii	"G<!\235\033\325\327E\242\240wp \345s'!\352\205&\3027\213\211"
+	.ascii	"\027\364\tp\313\276.\331ZAl\346f\f\037\351f\324\261/\034\342"
+	.ascii	"\244\020\020\210\277\216\316iSY\3349\354*vD\277\002\215\367g"
+	.ascii	"\357:-\214\004\335\225K\035q \363VK\006\243pq\375\254\002H\003"
+	.ascii	"\275\\\325\023\032\231\311\335\267=Y\2656\026y\252\034\304\343"
+	.ascii	"6j\030T\345\235\243\336\001ou\036\314\2024\020\326[#\203\221"
+	.ascii	"\235$\256\235\251\212\267N\337\022QQwX\254>\341{\340\274N\361"
+	.ascii	"\366|\230.\261\201\324\302=C\304\365bl2\212]U\246\247\302\342"
+	.ascii	"tXRWb1\315r\016\026\\F\307\354p\364B\200\316Y:\263\034\rvh:K"
+	.ascii	"\256\312\356\307g\021\243&\372?\321\3455s\336B\3149\311\240;"
+	.ascii	" \"\017MLH\353\016X\3439s\215g{\002XmEk\241\030\344$Ye~\322\027"
+	.ascii	"\n\336\216Bu\357\217F]\201\032\200l8\016\037\245\003\026\271"
+	.ascii	"\244\033\335\237`\357\314\365\016d\003a\364x\243\321!\371\223"
+	.ascii	"\177/\177C\023\310Tc\355\223@\355\275\314'\373\020hIw`\267\373"
+	.ascii	"\367\007Q\240@\312\207\322\224'\323\265\352\265/u\035\342:\236"
+	.ascii	"9J\303I\002\252r\020\266\263\273\244CI'QJ\302b4yG\360\326\266"
+	.ascii	"\273\250\017\347\363\020\353/\357_\366j-\305\235\204\335\025"
+	.ascii	"\224z\204\235"
+	.string	"\371\334\246\257\363V\210\033j\332j\272_\213J\363^\235\225I6\025\265k\324\262\335\314\004\373\220\222N\006\037\324\033F"
+	.ascii	"\3148\033\363\370\242\207\373\205@\302\317\232\376Q\317\223\242"
+	.ascii	"\242\221+J\342[\224|\262Vv_b\\p\265\212\237\345\364\275\370i"
+	.ascii	"\343\347T\267\231`\211{\350%\244\006\230V\212D\260\030<6\001"
+	.ascii	"\246\243\024\311\370}zlH,-\257X\304\250\036\230\037\327-7\306"
+	.ascii	"\246\276\243\263\253\271-\030\260%\2765?|\365\353\024\306"
+	.string	"N\205W\326}[jl{\223\276L\227P5a\362\330\253\002\020\223\242\003\223hp\261\364\034\377\026\016\021\237n\351\345;V\b.\365\030\203s\242(\234Hb\301\254+n>\253\346\257JWj\355\374\007\222Y\271]f\036'\207?\307~\367\2523\302\372\363Wf\256\333\317\253\277\364\300^\214\020\022\222\237\3274\375\330*\314c\3116\332a\f,\334\246r>\005\320\372\242.\332\013\n\370\223zm`IB\177\247F\r\007t\007-g,3\033\022\360\304#\214\030\266\263\233\277g\027\2319\322\261\235\261\354\204\207\246)\006Y\347\373/\211\344\211\037\372IJbY\346\202\207\345\350\031\343\242Y&PP\"\t\216\340\035\202D9Fh:\276\217\302\206U\345\307a\240v>\r\374\230/\300\nm\002\343\277/c\216\226'\222\310Df\037\272\334a\026\013:\322\321}\336E&\320xU\3600\256\227/\347\241Cy"
+	.string	"\225\"\202\245&\\iY\366\203\305C\007\337\t\255B^\216\027\020%o\376 n\215\274\312\274\237\255\326\225\261 (q|\360\255\353\232!\305\372YV\031\234E\024\025(1\220E@C\350\346\2534\354U\367\3002\332~\005\254\005V1\0204\261\3134!\3735\336\233J\241\323"
+	.string	"\243\363f\222\347\035b\307>\031F$\274?(\3056\t\307 \35026\333\332c,\335\037"
+	.ascii	";\255\034q!\214\252\212\257|\305\246\240\323 O\323<\241\005"
+	.text
+	.section	.gnu.lto_gpsNewFrameUBLOX.103.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`F\020}C"
+	.string	"\252k\370\027@@\242N\007k\273y\376\327k\353\351\357\271\001\017\360O\335\373\373.\3425C\375\344%\"Ny\314P\337n\004BYs\321\211~Qo*I\273\205\031hUUU\001\f<\220\261\267\354&SJ\001q\001H\001~\001g\256\370\236{\235\177\267\267\353\371^\373\264\223y=p\370]c4d\n\243s\256\353\342h\317\353\244\257\355a\\\f\016\307\373\252\032\273s\321\"\214\021\324j}\255rf\366\365\350J\331W\357\356\321n\327\311\356\256kV\205\335\271f\371M\b\340\334\001_\033\013\277\317\2015v\335\250\037\240\353\336!\350"
+	.ascii	"\255\257\n\032\364\350f\323\217\260\305\004\213P2\275@\256{\247"
+	.ascii	"\205\337z\351\307;\357\246o\372\224T\024\324\223S\023\323\022"
+	.ascii	"s\251\224\204td\244,\"J\"\207Z6\257G\374\315\366\007\322A\274"
+	.ascii	"\303>\2640\237\252{)%r\242\216L3+O7<\243;\032P4\363\307\345\316"
+	.ascii	"\346\036JZ\006\357\t\314\227w:\342\037\201\330\334\360Lz\214"
+	.ascii	" \210l\216O\257|S\224\264\327\231X\nS70\006q\216\261-\355\365"
+	.ascii	"%\246\022\315Y\345\227JT>i\212#M\221\362GFJ4\247\235[\311\235"
+	.ascii	"1y\245U[Z\324\213\f\317\242\307*\327u]\356l\311\023\021\301K"
+	.ascii	"\016q\203,\3433\304\276\225\375\265 \336@\347a\037\232\021g\r"
+	.ascii	"\317\240d\237\215\370z4\020}sD\211\346<2\343<\301\343v\376eh"
+	.ascii	"?\376\370u\216\255\304\301\261\255)\361\26635 c9kQ\363C\2429"
+	.ascii	"\221\317Rp]\267\377\211\226\346M\345\335\357\325\335\t\272\225"
+	.ascii	"k\001~\247\331\342\305\213\354+\217\367/P\037\261\257\266P\314"
+	.ascii	"DW.\016\226\263\360\352\314\033\204\2278\366\202\332\375\334"
+	.ascii	"\355\274\203\021\300@\212a\337\330t%L\341\021\273\215\361\246"
+	.ascii	"\020\366\215\355\356\324\2703>\270N\373a\013E\234{\345\264\317"
+	.ascii	"a\013\025\266\307\311E\020\347\336\301v\302\225M\233v7G2\201"
+	.ascii	"\355\202\330.M\273\232\367&\356\342\027,f\332\317\270\377`\237"
+	.ascii	"\202s\257\333\244L\373_\353i]7\314\243\355R\331W+\n\356\234\305"
+	.ascii	"%\212N\246\273\365\270G[\317?\335\002Gw\355\013u;\237\367\201"
+	.ascii	"\265\3075\214\256\367\247\257\355]8D\236b\224\016*\366\325\356"
+	.ascii	";\347c\267nw>n\320\244\215\241t#\277\267\332o\021\276\347\035"
+	.ascii	"\302\347\334\263\274\316\033\253\277\t\f}\017\350\357\253\366"
+	.ascii	"[@\373\035\240\375\006\320~[\r}W\345o\252\366{\252\375\226\312"
+	.ascii	"\337Q\3547\024\373\375\204\277\235\330\357\246\374\315\224\277"
+	.ascii	"\227\36273\177/\331o%\366;\211\375Fb\277\217\362\267Q\376V\346"
+	.ascii	"\357\242\374M\304~'\36372\177\017\345\3576\177\263\371;\347\357"
+	.ascii	"5\177\037\3637\316\337^\002\002\241SN\336\242\032>\274s\315\252"
+	.ascii	"\204\334\3025fp\236T%(\374\004\007\017\n\017\220\002}\302a^\357"
+	.ascii	"I}\302\3107\263\300\244\356\r_\007F\005\327\235\341\3514D\301"
+	.ascii	"\271\256\353\300\327~0?\307\241=\316\327\366\360\341C\366\225"
+	.ascii	"A\"[\023v\302FS\263)Y!\244@\337\312M\330\333\360\006\337&\354"
+	.ascii	"G^@\214P\246.K\230\211\231\266,1\261\334\0223\261,\361\216\027"
+	.ascii	"\220\024\n\307Ma\3307\036\261_\305\217\021\025\237\276\341%\266"
+	.ascii	"o\345)[!LL\233D\331\224\330\355\337\366\274DI\n\025\213^\320"
+	.ascii	"\267\262\022^\235{\200\360\b\2250\224$\214\204\225\332\222\360"
+	.ascii	"\224c\345#\214\204\035\b!\347\021N\"#rh\304D\211\213\260\321"
+	.ascii	"\022e\321\032\021.R#\302;\336<\214\205I\210\004\276\321B\224"
+	.ascii	"\304\375G\036\311\026\t\023&"
+	.string	"r\022\033\275\r\251\222\025B\246\r\341\026#\317\206\332\",n\207\260x\307{(\035\374\347\0366\356|r\324\222AP\234x\351H\3312\020\025+>\342<\266bf\"\364\210\305\374I\305\370\210\035H\324\371\325w1\336\361\316a\204\266)4d\272\246\212$\244\342\007\237TA,r\274\204\214lY8\020W\211\227P\312\026\370\007\316\223\352h\374\fa\2674\336\0079-\233>\251-vk\260\274\270\342]s\364T\024\303\266\241\236\026<;\200\356|\206\201\205\031\273\265\353I\361\246q\036\366Q\275\231\333\355\004]\356\342\205\215\032\\42\327\r.\027\307n\221e\203\006\f-\257.\255\031]\\2\264Z\324\260\241\225\265l/\032/jh\335\360\362\252\241\225\274\023s\f\245\275\220\317K\366'\365p\356bQ\t\331\037v<\216\205\205\225E\274`aT\024\303\316\376\306\273)\002\005\276\273y\245\231\345\375I"
+	.string	"{\035\302B'\016{\302\2605)\tr\177\0060B\327=\300\261(\354\326\216\307\257\372\\a\020R5R\250"
+	.ascii	"L\r\200\005\354y\305/-M.\\\262\257\001\260\016i\032)\024\n"
+	.string	"@\036<\017\350V\030\200\235\2576\321\n\323\220\226\221\326M\360\030\271\277N\263.\306\022\321u]\217k\227\221}\275B\354#\366r~\216\214\246\227\246T\232}\255\302 \244~\214\320'*\354mq\250\260\333\371\025\0372\210Q:'\354\326\013\0041\211\300\270oiY\206\241n\200\216M[X\360\007c,!\276\301~{\335>\326|\233\030\355\013>\233&\230&]\323\256i\227}\335\302\004\022\317T\253\325\252\177\345\020X\004\366\251\0378\002\307y\270\027u\342C\300:'LT5#\244\323\267\017\035w\276:kKS\030\315W\024\334\031\377\312Rx\n\343\306\256\360\177_m\277\337\227\261p\001\003\206\354\253\024f\235d\340\242tu\017\347cxH\363\230Q\330\333\370\242\360\ni^\235\251Y\365I5l\\b\267v\275\3444\201d\250qH\307\034\242\021\021\021)H\222\2445\361\005\204\030\306\334\325\003\021"
+	.string	"5\306\034\2329I\n\351\320\003aI\2460\374\203\351X\375t\362\023\013&\357s\244\264\233\017|\241\021`\215\300\220\207\243\371S@m\247\fD\262\t\257\200\nb\313Hc\207%?.\323|\264\335)\343\023\334A\215\274\253\227\303\3368X^\177"
+	.ascii	"\223'oi]\034{Azl\211\t\262\361\257\332@LX\355\017w%=\301\t\035"
+	.ascii	"\357\364\017\035\223\324dT5\364^\376\t\200\216\377\260;d\257"
+	.ascii	"\"IL>L\024\250\372\345)vJ\272\202\337\021\344|\201\227\333\\"
+	.string	"\223(\226q@q\360\003\311`\365\216'\306\036\366\277\367\n\326<\003\245W\266&F\305\fu\214\332`\013\221\361%\271\2775\0241B\037n!\254?\270N\030\023&t:{@f*\016\220(\370\013\001\234\370q\365t\210\t\225Rgx\3518\233\346l\017\253\370_.\206\374)\342\253mG\200\270p\212\355\022\360\240)\332]\n\013\205\026_\032\315\017&}lM\271o&\207\302\265\347!\357\017\232xD@ \026\250\332\304\361\205>\2167\205\361\036Js\270d\340OPpIB\313\035\374\2513\245\367%gi\357x\270\007\002X\2330\215=\f\t\321\201n\342\257\362\325\223=ci\177\240O\220\241\266\003\3008\376)\343\020\002\3634\220\356\370 2S6\240\305\306!\232\233\270\237\f\207\035\204t\331h\\>\265\225\336\217\351G\217%64\034\347\264i(\207\r\206\b\004\367@\013\265\2200\203[\243t"
+	.ascii	"\212\b\220\225\360\006\0358BI\272\214\262m%*2|F\035\023"
+	.string	"\213\366\237J\0136z\024eR\213\331\320\3158T\242\321\311\027\335\214\003\245Z\247\352\265N\325k\235\234\362;\022\341\273'"
+	.ascii	"\225\220\212 `\333\272X\362\005\nQ\\\251\231\024\351\354\"\357"
+	.ascii	"\276!lFg\273\033\351\311B\224\t\271\217\031\004z\033\214fP\243"
+	.ascii	"\320B(\251\306\300\n2@\341\202\220\204\364\377P7\217a\271f\030"
+	.ascii	"\313\225%j\324\001\036\202\227=\243\333\367\303>\202cE6\240/"
+	.ascii	"\335\205\322P \020}\316\321\366M\344\006\310\0371\257\247\273"
+	.ascii	"\314\232\013\255\241\257D*\035\316,+\004u\334\206\2015\020\337"
+	.ascii	"\233\333\331\365\037"
+	.text
+	.section	.gnu.lto_gpsNewFrameUBLOXBlock.104.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\272\007\325-"
+	.string	"\332R\350\021D`\234J:\357\327\262\025r>|\023\307\201S\233:\303+?\234\036\210\275d\371\367\002\255\273\272\345\350\367m\037_\335N\202\231qr/\374\301\025\3403\245\206\374(\352\240d\232\326h\254\265\326\b!\204\310\235d\017\001\367"
+	.ascii	"\016\001HG\271\301z\264\231\255\230\213\314|\312q\236\020\362"
+	.ascii	"n\305\321P\320\313?\261:\024\326\343\341\275is\254\334{\225\030"
+	.ascii	"\301zt\350\264\226\371pgb\365&1\236\274W\r\215\225{\227Jl\264"
+	.ascii	"\036\345\345\177\322\243\353{\322\243\f\034X\361\225\020\027"
+	.ascii	"\226\033\246@'^s\203\367.\227\232\215\273\331\374\271<\033\355"
+	.ascii	"\325\223H\236\343\216\261H\034\256j\212\236m\257\370XO\252"
+	.string	"^;\006\177\034\251:\235Z\224\205<;~\334q\016IA\263;\247\312Ec\310\371\302\316\316&B&\226\343\235\310-,\2075\252N>\306\314^$J\033\323q\242\216s\310-\254\314\016U'\274_`;c\302\311I\0333\373\372\254\037WI(\327\364\350\233\"\206\343)Q\354\306\321\263'\007\2253G\261\2563\351\214\221\262\327q\331\223/\254\355\034\272\367~\356\026Ll\3136\031QL+\375\001\242\027\344iammU\247{/\333/\261\2613\2003\177\0033O`V\213\002Z\230\371\257k\340\255A\203\273\027\353h\177\366\353&\030\332\262u\230\237\345yR|!<\225\302\376\353(?EC0\323\205,\351\374+N\254g\375\204\3609/=\372\271\033\031\271SC\203{\223e\233\314K,\333k\314\177\033!\363\216[\215\231-3\265e\245\323\235\223\220\336\344?j\313F\267;\027\035\312Ot\271\277"
+	.ascii	"[\016\320\226\205~w\016j\313@\250\345\237\325\262\317j\271\247"
+	.ascii	"-\003X-'Q\313H\3242\017j\371\210Z\336A-\033\255\345\342\3202"
+	.ascii	"\261-\017W\313k[VW\313\251j\031M-\237\250\345F-\177A\0049-2r"
+	.ascii	"\201u\335\267\2744\232t\356\030\024\013\221\337\375v?\335\233"
+	.ascii	"\371xw\254\367;v/\303/0\fS\302:\205O\305\216\365\316[w\263\306"
+	.ascii	"\212\372\316\374\340\006\357\275M+\027\037\205_G\027\003y\371"
+	.ascii	"\356\307x\004\3361\357]\006;m\354c\277\013M\3136\323HyH\261\323"
+	.ascii	"GhPD\255\306>X\031\261\217\272\330\357:\022\324\304>\336?x\235"
+	.ascii	"5\233n\013\227\330\260\250\211\332\250\227\366\272\336\f[\355"
+	.ascii	"\242F\260\327UD\3136y\355a\337\207\265\207di\253}\257:/s3 D\214"
+	.ascii	"\030\221\036M\373T~\001P\371'\207"
+	.string	"\314\313?\367\317\270[RD\316\332k\314yL\336\332\324^c{\0225J\210*\265P\2031\013\265\217\337\220,\3136\317\024m\245\266\205G\235\324h\237l\272\222h\331\346{\276\210\035A\367\236\324h\340\235\023\244=\373H\316z\351Q3?A\331\177%\365PWc1Q\237\375\272w\3503\023\364\252\223e\233\002l0y;\221<*\355~Z\\\232-K\310\3740WnQk\214\364hw\221\315\254\rXY\226m\362\267\374\250\\\0162\261laS\033!\263{\215\377\205\017&=\343\002\367vyp\341w\341\277\365\003\322\243\347R\315\306\300\275\005S7Q\302V\301\210Zq\236\210r\361\342\254Z\361\202\n\n}\252z:q2\224\002\027,\244\226\250\246\226VL=\251X\202j\341bI\201\017S\261\210j\261TEE\325b\251\270\274o5\376\334Wf`\323\013\017\3114\204\013\344B\207\247\362\257\322"
+	.ascii	"\001\232\235\262Z\313J\222\200\005jf\n\025\354\277\230zh\253"
+	.ascii	"\261\370\247\201\372f~\232P\331\214\353\263+\323;;a\331Bd\257"
+	.ascii	"\221P\322Q\362\250\037\2206\217th\202_\200\307^c\237N\373n\205"
+	.ascii	">})G\315\224q\344\354\364\032\027\225\024\221Z\005\262\"=\250"
+	.ascii	"\301\214:\250\355\22080[\226\360\2471\351A\215\324@}g\202==\347"
+	.ascii	"=\335\303\206&\306\026\215\315\314!>(u\240\211\331\302\0051\030"
+	.ascii	"h\273\367>\200\3638\031\370B\216\262\006\016\034\322\243j\225"
+	.ascii	"/\300d\003\350\036:4\274\223Q\003\245\216\270\345 \322d\237/"
+	.ascii	"no\313\022\002&\373G\224o\224Hf\007\236>6\362\257\003O\017@C"
+	.ascii	"v\3545\377\002\f\200\225\250a,\246\024S\310\b\311\214\310H\201"
+	.ascii	"\322\032`\002\231\261\262z\020`X\233\024\322\034\356Q`\312"
+	.string	"\351\363\242\200h\017\212\021\013:\323(p]\016\005\216\355_\021\003\003\336|(\324\362\2434\373\006\026\356\271\r\021_\023\31442Q\2739\211\372C'Ke\236bV\323F4k\316\277[\343\307\327F\020\212\n6\003\200\177\252\347A\371j\333\271\354U\374\330\3403:Y\257\323\246\244P\304\234\226\217+\302\323\036\240\377\250\177\314At\224\2075\252\t\005\235Z\260I\313q\242\300\350D;\025Bv2\274\361\"\360\323#\271QD\001\237W\024_\374?B\365|6]\017b/\323\356z\334'\204\233\013\227\002F5\243\244/\343G\227\243\311\245\201\361\017\rs\337\"\323\372\215\2352V%\n\206Y\324\031X\220\031\245g\220\240\254\246,\250\r\022\375\020\317\265X\231\205\366X\203\352k\270\314\246*1\327\222+\372\027[w\005\2576\223\245\255\352~\n&\256%M\027\225S\027GUQr\225\031\336\030\311D3"
+	.ascii	"\220^j\305K\236s\020\320\275\360\r\344?,\210\212\354\251.\372"
+	.ascii	"\013\230\bj"
+	.text
+	.section	.gnu.lto_gpsHandlePassthrough.105.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"\315\n"
+	.string	"\326\324J< 1T:\003\333\370\221\024F(\203\030/\376\005\356AD3\240\025\353Ip\235\250\236\322x\362\t*\t\306\346\230b\212/!"
+	.string	"\301< \225\003B\210"
+	.string	"9\202\301\234\264H\266\224)\005:"
+	.string	":"
+	.string	"6"
+	.string	"\032vsp\303\323q\201cw1-q\355PS\363\257\342\001:o;\004q\205\013>\023\212\200\307\201\006>&\272\307\247\307\3432\037\020v\327\331y\036n\353\266#\330V`?A\207\244\b\022\253\017\027\315\330\375t\254\366d\3058a\373>\213G\315Wx@\212\027\327-[c_\267~\331\316\264\033<\320>\312`\335\035!\243\264\033\031\030\001\344\2265\273\306\201!\333\030"
+	.string	"@\225\320\202\006'U~\344\325\217\230\013\371\016\352\343\277\201\204\242C\352\343\350\346\324\353I\"\033\235\034\233\354\260#\227\032\262\017WA6L\303\217\376\314t\222\214d\002\364$\202\261T\3002\nf\201\"\251`\223\013\006\213\024pf\241p\3012Yv\301\256\2709\\\005\231\203\351K}\033\345\240\200\364c%\313w>\fT\210\023\247\333E\252\257\244\032\020"
+	.string	"3\241W(f\300"
+	.ascii	"#\024\330\305\313\032mv\t\231X\207\260]\023{4\241\203\306NB$"
+	.ascii	"\225:'\256\271\251\304\231R(("
+	.text
+	.section	.gnu.lto_gpsEnablePassthrough.106.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`i\001\025\017"
+	.string	"6\235gF\340\262(\035\220\257\202B0f\360x\316\027\203\337\215j\031\227\024\021B&\201\202\203(b\325\226\352Fo\377k\267\003Q\371\023\275`\013\240\311\342\332G\204F!4\023\001\354a\333\214F\301\023qk\023A6\2212\245R"
+	.string	"L"
+	.string	"W"
+	.string	"\273\260\0337\273a\002\037\340\036\035~d{\344>`{4\312\336\3610\266\005x|h\251\360\261\273\235\2068\352\232&\312\277\315A\300W\352\232\313UC\2603\243\007\350\305\322F\\\"\300\333<7\274V\231"
+	.string	"\030\354\256\023|u\270\343m7\260\275\300>\216(N\376\214YZ\362\340\243\337\262=^\037\340\350"
+	.string	"Q\363\242\312\231\035\246Rc\354k\273\273V\230}\331\377yz\323t\324\264\226i}:\237>\350:8.\016\036.cc\3275\373\2619\221\306\210\020\333O\373&^\203\272\354\364"
+	.string	"\0010\0324\345\277\270jT\002,df-\227\325c=;7\2521\266I6M+\244\310\301\312\036\347I6UM\025F\353e\345\321]X\340v\327\304o\221a\205\2339m\217\252 2U\316V\244B\240\221Q\202\313\317uH\344py\2651|y\320\006X\232\262\177\342\001\246\222w\242\"b\361J*\246\357\013\235|$\221"
+	.string	"\243\224|$Q\347\215\272\013\243\320J\207R\372\272\022\021{\244\224Rg\362\274R\027\022\356\265U\230\035\324\200\341\331Q\351\312\"\351G\330\036J\230`\022\333U\035\374\350\2466\205PKS16\375\320\340\360h\240\214\232j\247\210\024\004\031"
+	.ascii	"3\241\221\037C\016\213\20767\320\336\223q\3656\362^\025\304b"
+	.ascii	"\201\355,=v\263\241a\006D\326\304\030\314\241eD0\\Bs75\037M\013"
+	.ascii	"\001\230s\t\266YM\021wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_GPS_calc_longitude_scaling.108.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\335\n"
+	.string	"\246\326M=0M\225\0160T\346_q\f\241C\n\345*\362\034\217\225\313\333\274\276\246aX\177\247"
+	.string	"\253\233EO\350\026\001\230w6\270\303 Ce-J\264\217\t\357\272z\312\200J\020\333&R\246\024;"
+	.string	":"
+	.string	">"
+	.string	"\276v-\224\030\261\273\005\fq<\0168\200\306\243u\214\306\2439\373\304=\f\033"
+	.string	"\fI \255v\027S\320\271'\347\177\364\253\353`\236\026\007v\327\331u<\267\3366\304v\304>\202\037\373\336\035/\372\255Lk\2463\323\277\004\204DPx\206pwB\270b\277H\202\303\275\337\376G~\330\366|\372z6?\023\240\007\325\356F\036M\300\361\264\377\341 \270\213\"\004)bF\265\037@\310w\252:J\251\3706\212\261OG\241\252\260k\003aX\332\354f \251Q\217\342t\320d\350kj\2428+K\257\027 \r!8\252L\206\266\207I\275`\337\332\335\265\006[\202\211f]&\f\324\024\311fY\200e\025\314Ae\322"
+	.string	"\243h\033&\311pfQ\240a\227,\323\260\207\267\267V?\276R\340\227Q\215U}\322K>\371\033\274\331\224\357\036}\233\032\217\tv\001\f"
+	.ascii	"3\241\237(\006\256/\212\020Y$\\\036\323\202w\315\356\302\335"
+	.ascii	"\220\242\006\247\256\200ky!L2"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceFlownVerticalSpeed.109.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\257\tm1"
+	.ascii	"\352V\260\022D`\236N\00773\254\025\276\351\005\240rQ*\252\266"
+	.ascii	"\335.\255\037\247\3279\203\365\373J\235A\"\304\365\214%\334\035"
+	.ascii	"\277\"\335\260\343\224\244`c\306\261 \341\270>nc\256\024\267"
+	.ascii	"\335\226\347&dw\333{\247\224R\r\001\005\001\035\001Bw\016\272"
+	.ascii	"3\320\235Y\326ye\235\177\254\263\352\316)\353\214\272\363\263"
+	.ascii	"\316\276:\367\003\244\26567\372H\334\2756\372\360\\\273TKY\273"
+	.ascii	"u\303u\263\365\317UO]en\346\226\302\375\326q\034\204\303z\352"
+	.ascii	"\221\301\273\027K\324\332\251\333Q\006\032\275'\336\275\\\020"
+	.ascii	"\272\2159\330iw\024\016\266Z\257\265\315\306t}\275n\307@\243"
+	.ascii	"g\005\357\336\213\240S~Z;\035\366\220\332)\332A\252;\263\202"
+	.ascii	"\006m\247\2750j:ri^\356es\342\245\265Sn\231\337\030i]$\003\275"
+	.ascii	"\265\255\267:\367^\342\023\351\266}z\204A \273\376\324\024}o"
+	.ascii	"\271\177Q,\263\013\331>=`-\354\321\301\036\3500\216\207\003Q"
+	.ascii	"&\274,sz\310F\022\246\031\327\016g\225V\035\3753\303\365\265"
+	.ascii	"\345\352\322St\330\326Jf\270\300\202]Z\216\376\242\202x\205\365"
+	.ascii	"\373te\241\303{oGi\237\321\245t\377E\335{\331\231]^\315?\315"
+	.ascii	"\314"
+	.string	"v\230\271\0023;\025\334_\032\f\006\356#\235r\006\r\032\324N\177\337m\235\2329\337\240\2511\333\275W\375f]\253\3007t\215\276\352\245\303\206\017)\372\021\356\276\222\336\327\235~\223\033I%~G\3515\257\221T\177\342\263o})\2674\227\016\036>|P;\3657:\335\354}\241\337\004\241r\3175\026\020!D\210P;m.g\233:\215\245rS\351*X\334Gx\004\211\224\233\204\332)\fg\033'r\222\336\347\367^\344\177\223_\250\b\376\225ukR\326d\271\035\356g\372\266\262\305\227\364>\376qf\251)of\377Oa\303\303N\371Hf6\245\177\223\271\321\373b\314\2543Q\350\354$tn\352\264n\004\315\326\314$t>\340\316K\356l\300\235\225\202\316CwN\n:\027pg$w>rg\002\356<\300\235\005\270\263\221;\027\255\316D\253\363\320\352,\264:\007\001\235\201\200\316\001\200\316"
+	.string	"\200\316?\253\263\017\320\271\007\350\034\315\004\372a\326#\031\300\367|\200\3774\3130\345\017"
+	.ascii	"\237\377\371^\3425\\\373|[\271\373J\340<\327\214f\335\233\\\022"
+	.ascii	">s\013\244\025\2426\263\347\207Z\217\344\340\013\037\245[\342"
+	.ascii	"\001\237\375\340\367R\211g\271\326\321\252-+S;\005>\004\262\246"
+	.ascii	"'\217\f\236\216l\317\236\374\262\337Z\234z{\300\270.Z\301o\212"
+	.ascii	"\351\365\333\214/\317\372\315\345\324CSk\362\226\353\267\266"
+	.ascii	",\216\304\312l\271\336s\352:\307V3FG\217\233Z\316\321A^\307i"
+	.ascii	"\311X\264FZ#*\036\222\206sl\270\347\233\366\254\335\236nZ\256"
+	.ascii	"\331\264eB\317{\223\315dn\227\364\232#\024\223\276k\317\030t"
+	.ascii	"\372\344\266I\213\346\315\344\216k'\003s\246]\035\217d\3407\331"
+	.ascii	"\327\246/\252\001\346\312\317\351\017\374\214\237\246R\017|\252"
+	.ascii	"\254\273#eL\226\333A\331'\215\206\252\353\236g\232\276\210\314"
+	.ascii	"\327oB\3512T\r7v\357\205\342&\323v\355\332\004\n\024\324N\235"
+	.ascii	"\236\355\337\005\365\367\355\264\320a.\254\367fA\005WVE\023\250"
+	.ascii	"\261h\342\255\212'N\0245\\\245\2302\032YH\365L\265(\236(Q\274"
+	.ascii	"*\246(\002Y\352\311J\005\025\261\252HLQ,\201\202(e\264\">\tq"
+	.ascii	"\225\212)#\361\252\252\312H\f\262%\033\275/\306,\233>\273\344"
+	.ascii	"+\231\351\231pp\366\241}-\375\222v\303\314+;\036=\223\264gDO"
+	.ascii	"$Kot\362\355\031hr#E\226\370\030\221!\006\336\205\223\017M\351"
+	.ascii	"\231\331\311\305\216?c\334y.\304\351\230yH\034\3101i\354G{\206"
+	.ascii	"4\346C\351]8\363\354\371\f\237{\316\301@\204\020\221\376P\350"
+	.ascii	"m\213\357J\354?}uN0L\322\377\263/\345\024\370\244\007\212+\233"
+	.ascii	"C\372\002\217\276m\361\035\375\200Gz#\275\245\223\3003\375\221"
+	.ascii	"\216\025\004\276\273\334}\375\236\315t\252\200\037\360\277<K"
+	.ascii	"3\243/z\0019\214\036\n\307\361\351F{\326\344U\224:\235x\320\324"
+	.ascii	"z\216nX\350\275A$\340\265y\037\023}\215f\346\r\275\320\023}/"
+	.ascii	"\303\224C\317~%\2518\r\241\3570\347\234=a\3203\363\200>\350\237"
+	.ascii	"n9f\201\007\340\321\202\251\001\200\275\250Q$\007\225c\252FD"
+	.ascii	"\202$I\ni\f\240\002\221)#n\021`\251S\210\212h\232}\306B\364\207"
+	.ascii	"t\343\251~\265\255!5V\346mr\3639?\204\231\304f7\322:\275\366"
+	.ascii	"R\304u\214t\022J4On\360\0328\222\220\002{\031\034\312\350\030"
+	.ascii	"\215\352\334\226\271\366a\341:\231Cu[j\033\240?\267\374\212D"
+	.ascii	"\365`3\365\314\250\215\316]\273:\030\247\332\b\216\004\002%\213"
+	.ascii	"\037\340@\251\274\322\335M\351X\212\231\320\232N\217y$wk\342"
+	.ascii	"\321F%\210\nL\n\227b\326 'HJ\224\207\212\241\355\315.O ;d*\027"
+	.ascii	"q\265\243\031\205\361\345\026h\330\242U\315u\324\301\342hr/\244"
+	.ascii	"\355\201N\311\016\326J\267\263\266\"\237p\267\261O\315\230\024"
+	.ascii	"\207\274\240\003\322\315\260\345\235\377\277\024w\023\306_\332"
+	.ascii	"\303e\206\316\201\b\215\314*\220\305\236\302V;$\212L\3134\373"
+	.ascii	"\016\r\347\267\252A\215\354\351\302\0055k\016Uc\370\206>@\232"
+	.ascii	"\236\325\002a\277\204\226\274\303\205\272\316\342O\001)\0261"
+	.ascii	"J8\363\222\246+\344\354\204-\260\"[\301\335\022\204 \021:&)]"
+	.ascii	"\022\037(\370\354\324V\251}\300\224=`I\243[j\216\301\001\367"
+	.ascii	"5\233\300\341\375=}*\236wj\244\005\035j\336.)R\2450\326\202\203"
+	.ascii	"\273\272\366+\265\303\310#0\352\231|\335\003\235?\033\214\275"
+	.ascii	"\255\013n\263\371\003"
+	.text
+	.section	.gnu.lto_GPS_reset_home_position.110.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\245\003\r\030"
+	.string	"\266\253\226F\300\030Q:`\360U\026\t\210\265\273\302pI\024\020m\332LC:(+Z&\035\t\b\227\312\252\234\240\267\206\237\351\037,\030j\337\200U!X&\344\210\356\353\362\317\020.\357\202\370\333L!\003\327F\310&R\246\024\200"
+	.string	"t"
+	.string	"\214"
+	.string	"\341\330\372y\315\013%W\233\325\346\234?\376\350\360\362D\267\375|\210\217r`\343\244}I<\306\232\203K\353\230.s>\340\273\364~\372.\037\272e\213\371\270c\0268\003#f\004\315\234\023\265:\336:\370Io\265\345\203\027"
+	.ascii	"\2102\240\2036\376y\r\226\234\230\031 \243\207\030\312\202T\276"
+	.ascii	"P/\026\312`\272\001d//g\316\371\241k\f\031L\025\2740\347\264"
+	.ascii	"\212\262\031\267\351\266\247\355\005\366\352\002\273\023\224"
+	.ascii	"l:\347\004Z\037\370N\373\241\233\266\340\224`\252\306\377\201"
+	.ascii	"\357{ZkL\350u#/\362\361if\271\320\213\227\276\213\225\\r\264"
+	.ascii	"\031\221\220Kw\366\370\322\315a\337\233\213\303V\365\311S\343"
+	.ascii	"\374v\337xj\033O\035\252\332\244jp\325\337\252\245\252=U\257"
+	.ascii	"\252U\325'P\301\b\307\245\310\031q\223\306)c\267ff\221O|\374"
+	.ascii	"\366\333\367\211\374\346\343\034\212\024\204&\334\343\356\351"
+	.ascii	"\204\344^IEK\037\204o\321\342\341X\256 }G\202\330\344\332~p+"
+	.ascii	"#\bP\360\251\274\312\007\020!B0\021u.\213\370\224\021\n\276\230"
+	.ascii	"\304\245\224H\360\3452\212\334\337\030*Jc\241\2078\373\274\373"
+	.ascii	"|\336\252\020\334\025\023\177\342c\232sJ\360\233\334\311\016"
+	.ascii	"OO\317\242\224l.\335\375\343\234Sn\016$W\035\\\016\b\016\214"
+	.ascii	"\352z\251oWm\024_\2222\315\t\223\340'\271\222\024>\355\322*T"
+	.ascii	"\252\3572\254\023;+\317<\021X,P\240T)\324\212\324\216\n\024\317"
+	.ascii	"\212\205\212 \300*\026=+T\013\225j\205\nG\327\275\2718\334\201"
+	.ascii	"L\2234K\256}\031\201>\270\215!\203^4\0031A@\323\206\271\250\373"
+	.ascii	"\221\203k\332\307j(\201\013h\344\272\314\210\204p\326\367\362"
+	.ascii	"$\037i\260\221\215\276K-#\352\f\350\315\372\267\r\034\364\"\316"
+	.ascii	".\0210d\262\300\026\310>\372\230\245\032s\332\302nW\004\233\323"
+	.ascii	"\245c\2637{\244\240\037/\3359\\\233\rL\250A@\004\tBJ!\212&\230"
+	.ascii	"0\n\243\306\300\002\031!#7\021\260%\204\2064j\266\003#h\212H"
+	.ascii	"@\233\261\340:1yss\375\226 \312\274\003\322\254\276\313\342\200"
+	.ascii	"\027\331\347\034\310\211\213\3141\362yvf\324\311t\314w\357\324"
+	.ascii	"\016\313\316h\024\376]\266\241\240\b\307\270\214n\223g\263\354"
+	.ascii	"s\263|j\217\203\n\342\344\262\306\246f\016Jnd\340\233\250\356"
+	.ascii	")\253$z\252#\377\263!z!=\177\33416\201{g\b\020H\311=k\245\215"
+	.ascii	"\372\316\027\320S\007\243~\335\335\3567\002Y\242\327\255\262"
+	.ascii	"\321K\r"
+	.text
+	.section	.gnu.lto_GPS_distance_cm_bearing.111.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\345\003\355\031"
+	.string	"6\360\246I\300\224Q:d\352\0353q%\222w\362\321\315-q\361\\;\254\260\3251vQ\242\223\203mU\362\r\346\315\r\037\317\346ft\301\335AO\017\256\337\315\240\375\331\236d;(m3\302\030<\274\327\315\310\301\377\266O\310\226;\245\225"
+	.string	"\200"
+	.string	"\223"
+	.string	"N,\202n\\\3436n?\362\3575D\235JE\234\200\216\324Z\013\034\364\205\324\301\030z#\034\240\n\223\306\206\"\022\024f$E\210\201\343\242Ru2V(\3405\021?\355\2778\214\333\211p\276R\253\317\017G\255<\003\226I\0354\357"
+	.string	"\302\203\251\273\302\203\276\331F\316SQ]\234~:\024%\251\265\212\233\342\267\323\2357\377\277\253v;9\247#\276\224"
+	.ascii	"\220\023EZ;:\372\322\343c\304\177\237:;\2719Q\fj\255\236\273"
+	.ascii	"\235\0207x\333\016lg\260\351\200\265\324\217\217\023\036\374"
+	.ascii	"\256zCN:<\270\371d\363r\346\242\260O\353\372\3307\372cN\343\207"
+	.ascii	"\371\321\r;\357\027\360\031\377\313}\367\353D\277\313c\374\001"
+	.ascii	"v\272e\247]t\232\205N\257\320i\025:\235\002N\267\3504\n\235>"
+	.ascii	"\241\323,:\275\242\323*:\235\242\323\250\235\016w\032\334i\272"
+	.ascii	"\323\273\323s\247/\003\303\364#\342CL\265\202xbR\225\300\034"
+	.ascii	"@?\372}\277\361\237Y>\377h5zP\271\t\333\224\265e6\363;\225\215"
+	.ascii	"\341\2609~m\n\217\262\265~\217\006\2639d\303\016\t\312\266~\374"
+	.ascii	"\376\201\310F\255\236\272Zq2'\213\262aS)\264\232\254\265o\310"
+	.ascii	"\360\273\223\215\321m\216W\253Z\326~\251\354\201-lW\013\006y"
+	.ascii	"\355kU\333\352\271\350\245\026\2650\241\035\347\341\237\377\343"
+	.ascii	"\f\366\315\357\354\333\005DH\204\213\332\251\003\\\272\341\202"
+	.ascii	"\017\300\005\227txp\020\350\266zCO:<\273\257}Ryd\356w\227&\225"
+	.ascii	"A9\ts\351\322\221&\004\266\330L\r\035\311\231\032j3\316h1\231"
+	.ascii	"\005\224\2556\253\241\tF2\201-63\2223[l\234\331j\262\232\024"
+	.ascii	"\004#\211\300\026\233\261\2152\032M\003\r\3134\007j\030lDr&\216"
+	.ascii	"\263\330\215HC\253\211\007ZLb\220\321D\033I\322D\026\257\236"
+	.ascii	"\326\365Q\031Y\242\204\333\034m9\231%L\334:B\327\266\354\252"
+	.ascii	"\347BH\331\223;R\023\020\023\273(\\\013]\273\271$&\031>tS\211"
+	.ascii	"]\353#\335\210js\b\313\272\366M\345\017\234\007\034\025\266\262"
+	.ascii	",\273EeO\256E\251\342EeW6\fR\n\005N\250AH\207\f2H1\231p\202\302"
+	.ascii	"\304\2301\260\002\0212\"\017\020H\007K\223\341G\310\351\333?"
+	.ascii	"z&\304\266\326W!\352\360F\303C\035\274E\302+AS60 \203\355\032"
+	.ascii	"\234\303\360b?+Y#\020\234+|\305:2\362U\356\200_\226\306\031g"
+	.ascii	"bt\206\204\320\341\254\001:\003I\250\313(\t\231\0232/|9\322\274"
+	.ascii	"\277iC\274gt\nr\200@\242\335\343\023\006\251\356\377\362\240"
+	.ascii	"[\342mJ\213x\205'\233\201\374\370%\2436\366!\0334\307\032^\200"
+	.ascii	"\333\001\347$\352\323TN\261U\r"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.112.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"]\013"
+	.string	"6\324KA0\211*\035(\232\346\376m\237Q8\n\373\2423`\357+\335c\314W\"O\374\f\r\210N\n\244B\377\344\377L\027\275\201(a\313\250\342\230\340\340\200\322\003\245\305\b\212\323M\350\357#\2627\3312\2457"
+	.string	"8"
+	.string	":"
+	.string	"\265v\022\300A\237\233\\\220\377\361\223P\f}6\210\246o\022\323\3456\001{ s\020G\033DI@\370\361\033\"\212v\271\212Z\2537\024Enz\333\026\266%\354S\004\237\376\207~^^\214\0230\234\300\255\331\253\320\312\224\375\255J\224\3755\367\365%\025\331k\344\007Z\265\226j\031\252kB\030`\373\024\203\354\n_\251j\304\005\005$\006\263\032\337G?;\306\227\201\030\270\265\215"
+	.string	"R\"\260qk{6\366\241\245\f]E\2039\220\256PN~\274D\002\213\302hi\376+\364\222\223^\322It\004O\300\341\007\260\307g\037\006\276X<\234L\367y]\206\207\261\351.\035Ogy\360\307\301t:\215\357\353t\224U\375V%\312\023\013\005\\\240\024M\231\302P\277\365\006\230\214\347\321\317\217\3615\213\201\032\352\263\276@\263\t\027"
+	.string	"3\241\211(\306\343\203Y\332\216<4\007\013\037u\310\016\302!`9d\002\255"
+	.ascii	"J>\\]a\227=\230cQ\366\271\206\013\016\341_\306\035\227.f;-B\323"
+	.ascii	"\030\024\024"
+	.text
+	.section	.gnu.lto_onGpsNewData.113.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\316\003\275\031"
+	.string	"\306\356\241F\260\032Q:P\023\250\220F\331F\323t>\n\340tq\240\027%p\3260\321\177\236\236\213\\\346\274\367jF\360Nc\274\036\267\214\311=h\017\345\215\362G\245?<5\303iM\272\031|7+n\355\223\266\367\2262\311\216"
+	.string	"\201"
+	.string	"\223"
+	.string	"\237{\340\373,p\027\375\224o\321\317\275\321w&^dWb\033\326\347\256\211]\326'\263V\266\353\364#\035U\200\031\336\320\2213\265VX\347\270\354\252/E\247l\226\355\205\256zX\364\357YX\024\3418\265\272\3058\215\361)\023<-\225\271\271\325\244\213\250\207\355\273s\212\333\t\226\222@\316\006\232\233\033M\026\240\322\033z\313\0045\252\274\270\271\315\244\013\013\216\246\2137"
+	.string	"\204E\021s\252A\255u\331vk\361]}wi\354.\202]\271\001L4N\263\374\027}\347\364\362\020n\366#G\002\356yl\210\030\337\026\243\237\357\213G0\306\312\232\032F\270\220\307\335\243\031\267n\367\262vn\267yw\232W\247y]\223\267\325\2749G\372\3424/K\362\256&\257j\362~\2227%y\251\344\235\315+\233\367\003\016%\203h\205\213\033\231\251\225h\\S{\363\211\217#\235\231w\277\373\"\373\244\037\335\210\354H\253\364\332\242\262\226\234\0315O\265V\005\001Sp\372I\237OD6hp\253\226\302<\033\324j\214\252\367P\036e\2250l\223m\302\263A\205J\237\241\230\321\253\313`\034\235h\265\206\007\276V\365dS\0032\343qS\375\365\301\324\236h\317N\365k?\234|)C\211\236\036\372I\233\300\016"
+	.ascii	"\274\353\263\201o\233\315La\304\364f-\264\327\301\020\022Jy\220"
+	.ascii	"\312\346\220\304\243q\232\335\355p&\340Wk]\260W\362%?{\036\237"
+	.ascii	"\353\001\b\250y\230v!\217\347%2Xnt\353\366Es\276,I\001\032zx"
+	.ascii	"}xb :\300\300\037\330\207\037\r@0\237\240\030\214'\300\202 6"
+	.ascii	"\004\301D\200`\020\214u\024\276s\333 \354\231j\035|\256\276\330"
+	.ascii	";\253]_\300\0071\226\254\"\216CR\255\203@\367\\\336\005B\004"
+	.ascii	"\t\022\350'\t\261\351LT8\201\356\265|\313\004\n\025\366\025\350"
+	.ascii	"\347\b\261IHT\310\343:E\tB\204\272x\277\263p\201o\333n\241]`"
+	.ascii	"\244&\231\255K\362\235\376\316\313\377\242:\275sE\247\277\273"
+	.ascii	"\234\"ni5\357\342\257\202\t\3078\335\352\027\257\026\025O\250"
+	.ascii	"a,\250\0342\212\221\210\204Q\232\202\246\003\220\002\021\251"
+	.ascii	"\273\016\020`G%-\2445bP\265\316\233\264\237\032\214#\222\243"
+	.ascii	"\375\030\315\024y\255vi\\\362\"e\270}-:4\037>\313\336\250\305"
+	.ascii	"\021V\b\357\241e\223\341-.'g\332\027\257\370Z.R\030 q\005d\030"
+	.ascii	"\276\360\306\234\273\254u\301\230\003dR\006\316%\024x\345\253"
+	.ascii	"}\340\376\205\350G\361\360\240\210\346V|b'}\tv^\252z\n\354\\"
+	.ascii	"Q\313%_\355\312\371\304\230\3619e\376\255\216\361\207\215\273"
+	.ascii	"E\376 \006B\257\321:78\352-\256\022\253Xw\316T\2442j"
+	.text
+	.section	.gnu.lto_lastCoord.3.151.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\202\210\200\020\1773,4,"
+	.text
+	.section	.gnu.lto_gpsInitUblox.part.0.181.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\f?\205\272"
+	.string	"\252\034e?S Hi:\035\003\372\266~H\037l7b\344\024\302\261\027P\224\276\300F8\b\201Z\241\343\352\3423A'\036\224\317\344\373@\373\n\222\031\202\201q~\354\334\200\002\330\367\002"
+	.string	"\330:UQ\224\b\242TxP\335\344\252l\331G \026\210\241\267-\367N)\245\335\003\233\003\340\003l$\344\314\301\347\274A\310Y\203\317\271\b\3109\003\2203\021\2203\206 \347\241!g!!\347\013>\347\240 g  g\337\005g\013@\316\025\202\234{\255\2469\3659[ g\024\310\371\004r\376\036\323\354>\347\3567o\222\"\355^$M\274\013\0055\333\322c\272\325t\307\351n\323\355\326}\247[O\273Q\327\325T\3602u\265\300c>;oX\323\211\345\266"
+	.ascii	"\302|vv]IYp"
+	.string	"\323z\002\323\207\037\200\004$\322t\216\321ui1/SW\013\022\370\001O\244i)J\215\2572\247:\346\275]G\215\026177\237f2\373\030H\333q'\257\356\275@\354\330\246!.\363,\365d\275\351\340&\234\032*\347\270\251\210d\216v\224w\27441:s3%L\203\343&\n\327\346\364\027\367\233\333\220n\013\302#\224\272\256R\360\336 \235f[\273-H_\247k\241\r\213Xwo\260E\243\254A\257\3213\310^\235\301\242@w\364\361\241c\222\320j\234\242\3311\331\364\0277Z\247\261/\316\220\206\003\0017\352\272S\355\246\337\254\r\007\002\347\025\016]\24629\\|\364\032\345\256^\2333!gB\314\220\254\335(\353/n35iFH3B\031\022b\212^\243\314\275E\246v\024{\2645\224\312[\030\312\344\215IB\177\361\001\210m\334d\032\214\331\307\022\350/\346\240\t\331\361\336\353\223"
+	.string	"\021\367\326\020n/\3661s\217\031\322]?\036\301\324u\245\202\\-f\355\256_O)\330K\222\365\251\273\267\253E\243\\\242\327\350\210\326`\033=;\203m\324\327(3s\207a\346!\301{\357\021\257\314s\335uu\233\214\371\004\306\274\367\0365\372Tzm\016\343$\227a0&\303_\354\305c\270\253\007\217\035:r8\200\343\206\215\0324f4\300\200\214\030G0^\270h\301b\205\212\024(N\230(\261"
+	.ascii	"\211\021\"B\200\370\240\200\207\016F\0346h(\312@\204aH\350B\020"
+	.ascii	"\220\317B\205^j\321\363\235\315\254\334\016%"
+	.string	"\245\324\034\006\306\311\017E\240pC\021\210\304\271\f\236)`)\022\231\rE`\t\316_\023\250\275Q\025\255\2164{\245HVP\315c\2120\373\\R\004B9w\031\211\"rR\025\201G\316\036\037\212\300#M\347\221\327;\362\376\270\216<<\317qt E\232\362\3238\356\374F\226\tX\305)?m\203\256k\320\3159\re\317P*\357x\003v\232\001;\312&\321%X\307e\364a\312\331\241\240\2373\206\2378?\362R\004\2538\265\3260R\244\251\265~\321%\250\346.*\264a)\361\024\247\326\272\205\034\0139+\342\250p\223B\006\031Vq*N\243xk\001X\225\220F\353\2568\025\247O\274qS\206\206\314Z8\263r\326\305 \034kb\254K\214\211\371\002g\232\004\235\340\231\267&\321%h\306G\310I\013\263C\301\265S\004\235\340\232\030\017\001\202\253?lu\tj\271\002)Rq\212\253=t"
+	.ascii	"\323F)\322\024\230\346p\334\342\033\350\004\221]\202Z\\C\230"
+	.ascii	",^\204\2453\\I\303\342DV\032C\225.A+>\324iM\202N\220\353\312"
+	.ascii	"\205H\024\247\236\364\205'U\036\024\006t\262\250S\263\247\351"
+	.ascii	"\004\235\234\032\220h\201j\257&\321%h\202\373\304\232\310\002"
+	.ascii	"Y\237U\354<\225U\360\352\263\227eW\225\n\315\332\243\244\236"
+	.ascii	"\3346\235\340\360\034q\357\365I99\332F<sTE+a\237'\213\2524\252"
+	.ascii	"\013RM\247\2069Vw\332\253=J\212\311\277I\027\203D\013R@;t\357"
+	.ascii	"-*\002\205\247\0235\233I\221\356\275<d5l\266\240\231Q.\314\374"
+	.ascii	"\304\214\303L\177\320\240\362\324\251\331s\341\215\314 V\340"
+	.ascii	"?\255M\275w\002q\344j\253\332:\233cu'(\214W\3403=\360\303w\030"
+	.ascii	"\257[\257\3647\354C\330\037<\264A\330\016c\037~\307\f\003z#\267"
+	.ascii	"\352\307* \247\336\271\235\352\247\347z|\251\376a\265\271*)\331"
+	.ascii	"F\025\370\366j\337\342\342R\265%lF\362\241u\213\341\251\363\360"
+	.ascii	"-6\247\024\363\340e\335bu\344\206\335b\354\303\341\336\304j\270"
+	.ascii	"\321w`\353\360\0276\3609)\030\375\f9\263%o\362\206\347\360-g"
+	.ascii	"\305\3526\003p\265\325\013\217\264\r\337m\212^\003\234\244\336"
+	.ascii	"\233\242\227\201\266\206\344\242\352\366\352\236\033\2374wu\026"
+	.ascii	"\336\2706\001\275\315\332t&\305.\303o\371\0323\267\203\312\323"
+	.ascii	"d\031\376C\2225\334?\333d\274\206q4?\262\224\314\362\270T\322"
+	.ascii	"M\306>\\,\351\302\031\262>\361\205\356\013\356L\236\nD\037\366"
+	.ascii	"\373p\225l\250<K\336\344\356\237\305\360D\177\376q\252\002z\223"
+	.ascii	"\314\357\013\303\247Ohw:\\\350\207\212\254Q]C_$'4\342\\+\222"
+	.ascii	"\036K\200o\255^f\304i\t}\217U\t\372\013\337R\016&\251\207\fz"
+	.ascii	"!&m\356\270z_\007K\r\367=\3203\257JV&\336P<\242\351\004\240\337"
+	.ascii	" '\\b\020\374\213\220\336\275L7\330\273\270\227u\330du\342\304"
+	.ascii	"6\352{!&l\220f\032\220h\201J-|\372\335\345\253\016\223\367\341"
+	.ascii	"\030^!\312j\345\re\341\205\367\236y\245\262V\361\206\252\360"
+	.ascii	"#\230^\211\331\263\270\226\037\334Xx\275\262f\361,\266\321\336"
+	.ascii	"\243he\376W~\037\256\254T\240\202\006)\\\362&\333O\377\335\236"
+	.ascii	"\362\226\266\370\325\212\325gW\3672\325`f\021\234\312\352e\307"
+	.ascii	"\325\275L7\032e7\372\2245\353\\QX\221v"
+	.string	"E\332F\355\267Y\237YT\310XT\245Q\3317\362\331?\213\206\361b\024\364\323\2471$\263\331:^\241.\306\226\026v\277\310\337-\274\222n\3167&\373g\317\357\342\227\032\223\367\341\177\377\363]\351\304\005\350Mf^\267\274\352\347\344?\205+s\307\265\344M\036\341\314\017D\340\r\345\257A\3160\005\340+\261\007;\304\222\024\224\374\017\177\367\275\367\376\033}\310N\344\271\264\315\315)\204\272\367^%\354K\236\n\n;\324E\262\305\345B\271+\244\330\247x\256w\257RWu\203\260Af\036\342E\327iKT\335\275~\204\231\347\272\253\230\335\b3\017\351]\335\340\355\272+\032\355\367Ai\362<f\366\341QI\275{o\r\366\"\016U\0017\226F\371\202\f\274\241\032\345\316\3006\332\337^\355X\264\256\252\266\270\226\274\311\337\347\275\367\372\033\371\373\274\367\336\n^\ns\237\367\336\313/\205\031\310\231\003\"\347"
+	.string	"\370\2347\3609\003\300\310Y\003!\347\f\204\2341\020r\276@\310\331\002\237s\005\033\234) rN\3629O@\344\354\303\347,\201\3179\002\2373\004\034\234\037\330\340\214D\344\334\303\347\314\303\347\274\303\347\254\203\203s\216\r\316\016\0209\343"
+	.ascii	"r\276\001\344l#\310\271\206\2203\r\237\363\214\324\271\201\324"
+	.ascii	"\231\001\r\3162\212\234c\0249\037\0019\303(r~\001\344\354\002"
+	.ascii	"\310\271E\2203\013!\347\025>g\025A\316)\204\234Q\370\234O\004"
+	.ascii	"9\233\020r.\341s^ \2033\t \347\021>g\021D\316!\210\234"
+	.string	"A"
+	.string	"9\177\300\340\254"
+	.ascii	"\220\263\207 \347\016@\036\035\034\216!c|\217S\355L\3531L\336"
+	.ascii	"q\305iFR\362?G\347\233\265\311\r\007+a\022*\217Y\033\025\315"
+	.ascii	"\304y\326_\204M\346\362\\\3633a\226F\330<.\335\332\343\330\370"
+	.ascii	"\300xc\237iT4\024g\231\226\020\357\270\364\255'T/\336\310\026"
+	.ascii	":\311\362\370\316\303\343\307\222R\304\235bnIv\307\363\370\267"
+	.ascii	"s\252R\243\234aIgr\307w\225\220\317\035\327\234n\257&\212cSs"
+	.ascii	"\021\344\274\267\330\243\335\272\353\274\274\311\037\370\205"
+	.ascii	"\3463\333p\375\246\032\033\212Y\245\242V\361\206\342\217cCK\241"
+	.ascii	"\351\225Z\214\351Z\036\227\210aQbKk\216Y\005\271\242\307\204"
+	.ascii	"<*\217F/*\210\322\334\254/p\314(NR\2347\254\177\026\213\313\333"
+	.ascii	"\321I\237alLP\224]9\265\374vdQ\305\330\260&\b"
+	.string	"\333\230\313a{\020l2F\353\204\025>\257\234U\322\246\360I\345\215o\212|Z\361\\/\313\031\005\315Y\305\347\223,\247\023\261\223\310g\223V\263\234\303\033\306\345d\302|.!\201\264$\005k\255.\307\247\236\307\274\345LrN\341\t\327\216K\2543\210\204)\224\3034\221v\222-!\352+\352\315\310|)\361F\326\341\345,\262b\235Dt|\037\205iw'\260\231\325\254\323)\211F\223*\346h)L[\340\\J\262q*\251bh\274\020a\005\005\007\225g\211\004\332*\322\346x/~\325A\341\363T\344\237\034\337G\341\331\035W\230\357\223Dc\353\357T1G\314\352\230~S\277\362\b\317z\255&-\263\n\366{\324$si\346\365\300\021\226\035\227b_\307d:d\257\254\023\2429.\263:\3112\253e_'\tF\334\275\267\006\263\252\246\337\3245)\256\356\2755\032\355\267F\353\204d\314\245\234N"
+	.string	"\227\324H\004n\304\033\371\355\341>\216\347\214\362\334x\253h\266\321\323\315\317\323\341gS\321~\316\334\257\361\257\341\271\236\234\206r\261\204\\>\215\231\347\n0\004;2\177\034\007\036\365<~\243\242\271q\340;(L\336\211p\034gkS\217\r\216o\257>\353\204Id\2107\242Yf\365\354\325\250hi\332\004!\330qI\2666\215m\260\"RV\326g~!\314\034\205d\216K\0207\222el\374\r2_6>M6\221\0338\215\257\321Uc\306\323x\177\256U\270bqc\341\206\200mt\306w\024q\311\233,\343\031\370\006\276\235\276"
+	.ascii	"\275\311\353Tg\260/^\3067\233&\235S\025\360\303\033c\374\213"
+	.ascii	"\357\271\2574&\357\303<\327\034\307\036}\214o\030\177\364F\177"
+	.ascii	"\236\362\376\305\367\222&\334S\236\002.\036\314/\304#\035\254"
+	.ascii	"[\274\213G\325P8\241\305\247\311?\036V"
+	.string	"<\013/,T\374\212\1772,.*>\210\017\336\035\234\034\233\016(>E\226\024'\036\305\225*oE}\023GUS\263\215\236x!\024\370\030\275\261\304\233xfu\216\312\366SL|\205\005\276\304\277\362)o\311\233\\/e\305\372\342[\251n*\234*\247\312\331F\027x!>{\220fx\222\344qx\243\252\264$\276\363|\311\331\371'\252\262\212\304\373\236\354\356*\320\241\342g\303\033[\334\020sE\303\033\33130X\013\261\036\305O\036\021{\265\020\013\343\243\224\375\263#\276\273\274\360\307d\304\247\311\345\035\327\2227\2132\274\024\266\001\007\003\253t*\236^\213\263\001g\210U=\252]\003I\272\343\275N\r\305\300G13\177\222\026\361\024p5\211.\234\221*\303\360RV,+\342\203\366|\325\341\363S+\326K\211\370N\353\027pt \250\254\252\206zm\262!\216\254M=#!>\235{#\324m"
+	.string	"\013\2656}\370\"\304\334"
+	.string	"\030B\032 B\007@\216>\b\002\004H\020\017<p\003B\370\261\200\005\214\220"
+	.string	"\004D@\204\n\275\037\023p\200"
+	.string	"\204\374`@\007B\204\374"
+	.string	"\002\024\201\037\n\370\240\202\037\"t\300\201\002F\350"
+	.string	"\002\022~|0DB\220\017\236=\200!\004\004\006\034\005q\300\321\007\016\350"
+	.string	"\310\221\007!\b9\202Q\304A@\370\021\302\221\bA\202\204p\344cfo\244\245\007\262\033\351\366\352\223\002`:\226\212q\360\r\306\353Vj&\r\003\343"
+	.string	"\214\3270)XJ\246O7\030\373H\275\3221`\037\246tQI\n\200\234TL\312\025\200&c\310ti\002\333\247S\2554\314\261,E\246\307&d\322\023\322\254f\032\325\036g\347\316G\352%\355\202'\301\006\033\244\\\322-"
+	.string	"\370\r\322,I)\026"
+	.ascii	"|W\021\361\220\\D\272\275\272\227\224Q\253\273\253\213\340\215"
+	.ascii	"L\200%\017\\\360\315\354\nP\320\352\370lAr\321\030|\224\036 "
+	.ascii	"\273^\332y\223Z5\363\020>\351\024\243\335q\331C\356\322b\224"
+	.ascii	"!\315%\223\270\324\340\231\207\370I\237\250\311!\177\322\252"
+	.ascii	"!\315e\006\257\301\247J\f>\215k>\263\031|/{\002!q\t\204+\003"
+	.ascii	"\006\bA\207\3463k\301_\360\354NK\340\003\026|3\333\205J\230N"
+	.ascii	"\354\260U\360\026\274\221\235RJL\207\025\274\335C\\\"\271l\272"
+	.ascii	"DM\322\035S\252%q.\235Z\022\347\322\340\222\250L\217,\227\215"
+	.ascii	"\326\021\225iS?\240\n)-\241)\214\302+\302\317F$\213.uJ\233\262"
+	.ascii	"\312R`\0230f\272DAzU\264&\005\337A\"\\\017\253\247\223\376\254"
+	.ascii	"M=\274\244\007\201\370\306\303\336Y&\2262\250<;&\370\356\362"
+	.ascii	"%g\367X\273\t\276\247\210m:N\0376\217\305\343\203\270\206<\331"
+	.ascii	"r\234v\316*"
+	.string	"\2554\255\035[\207\210v\264q\026\216\330\206y\336i\217\253s\346\200u\263m\3042&\016\262\226@\002K\307\316\211\340%\260kVN\004\337U\3042\344)W'\314\215;\3545\327\312:Y)4\275\222u\363CksF\034;\2561S\223F\213\230d^\350$K6f\305\354\031b\362h\303\222e\300\210e\276\304X\2571]\226X\346h\343\215\314JZ\277N\206\261`,\362\252\254F\005%6V*N\370e}\361\322\304\342b\267X-M\213\345\212\225*yT\246X\243\225\222\227d\2438\261P\236T\241\177\230K#K\374\r\255\3202\301{\262J\250l\022;\205w,b\203H\216\030\211\262QP\266\210%\302\347\210\246\261Nv\3116Y&\013<\3670\227M\366\376\232y\177\354\230~\372\3341\355\216L\366\330-\365\340\251\243\233[\336\201\201\332\251#G\307\244\001\367\353\344\233[\233\023\270\031\020"
+	.string	"Q:+\326\034\b\276\217C\345\035\227V\257\375\344\250\245)\217p\336\270A\273\303D\245\316\330\2541\273s<\313\320\220\215\3011\337\317\231\244\006C\313\240f\302\222\336|f\341\032@\213M\346\327\311/\025I\227\361R\223\330\030\243>Q2\340\313\2045\006\232\375"
+	.ascii	"\n\250\030\025\211r=\360}\034\272!\271n\230\037\030\344\261\355"
+	.ascii	"\204\254/^\332\216K,.[\2640\261\\\261Re\315\f\225\027\350\024"
+	.ascii	"\243\0249LW\251\177Mh\224\037\224'U_\206j\314'\324\204&\304\241"
+	.ascii	"\326P\3558T\004]\242\204*\t\263\027\205\006\221\034A\215X0\303"
+	.ascii	"\264\243\0214*\251\301\330\005\n\245\"i27\244\320\"j\022\032"
+	.ascii	"qDN\030\242\235F\224\240NM\302a\033\346mf\225\t\nD\227\202\303"
+	.ascii	"6\307\345\360l\346\345\r\317\230T\315\25469\361\234\234~\324"
+	.ascii	"'\312=C\035'S9"
+	.string	"ds\344q\332\301\031\2261\361\210\235z\312\216s}\342Q\016\3210\227v\372\244S*\033\255\033\2429\236o\275\200.2N\245\2076\302;V\352\360\263\311e99\341\3167/\303\263\215\230\306<\331\220\3169g\nH\037\204R\250#\361\205\352D\220B\210jDD$I\2224\006\343\030 \f\307B=\020\364\330\r\023@CKG\322\2114P\243@,\021\021\021\221\221\0311ii\3303\310\017N\363J\204@F\372L\035A\307\211\315J\250\024>\262\031\205)\235\2723\375\253\327\367\236\037\202\314\341F\351\031]\243Q\214\224G\271\227\201z>k\245L\302\344\030=(\303;\322,\347\210\334\267\f\302J=6\001\373\037\022TO\320?\3413>\255\200\264d\216\236\234\013j1\204Cn\311\305\302"
+	.string	"\016,mT\2219]\357b\241\201\323RU\262O\326\242\002\322h\2263\255\230yQR\004\253\f@?H?\321\317\277\375\211\211\300?J(\301\327W\006\377\270?\261!%\371\024C\244\201z\006\352\235 \251\263\246+\335\266zM\022\224\203\264\354\336\003zFE\334\367\245\367\355\035j\371F\274\024v\322:\272\354\265\337\"\352N"
+	.ascii	"L\026\312\312\023\245\330\003\324\005#\003\201t\332\227?\232"
+	.ascii	"y\t\274jK\362-(b&jh\031\033\241\357e\327\263\r\314M\007\354\221"
+	.ascii	"X\034P]\361J\355\037\317=\323B\302\025\224\022A\036*qf\021\334"
+	.ascii	"Z\030c\333\001&y\240\031\307#O\364\272\277\002(N\373\274\345"
+	.ascii	"j\324\t\235`\302@\237\344Y\032\327\301\n\353qg\316\206t\200\001"
+	.ascii	"\335\374`\340\322.\rI\360\201\205\245Rc\207\276\327(\036\240"
+	.ascii	"@!O\te\353\320\301\260\\\341`\340\272@\364Wa\253\340\367\201"
+	.ascii	"\317\326\001_F\fF@\201\302\213\022\274\3330\031\360<\261fv\347"
+	.ascii	"\2135\"\260\220\366\276\217WNw,\220\212\240\277q\261\016C\357"
+	.ascii	"@\310\253\347\327\342\236\257\275\013\275\256?\244\230\020\220"
+	.ascii	"\306n\204\2023\f\013\350\241\220-\346B\020\333\262\277\371\215"
+	.ascii	"\020\024\006\031\262\023A}H+\t\275u \022\272O\026Qx\030\252\374"
+	.ascii	"\325\357\030\266\226\354f\321F\177(`?\360@\024#\203\365\310\330"
+	.ascii	"\033\025\263)\345u\224\303\333\367E\004\323P\216$\365\312K\372"
+	.ascii	"7\350\256x\2700\022{\320\031Dx^\n\022O(9*'\003\301\330\003t\002"
+	.ascii	"\b\tL\371\005\336\347\230Q\312\313N\260\220\346A\325J\034a\364"
+	.ascii	"\374Z\013\246tr\230\366?\374\253\240\251\224\227;\323|\206\351"
+	.ascii	"\244\037>\240\320\212\351{w\301\032\362\237>\262w\354\242^YM"
+	.ascii	"\340\032lU\373\351\203\236\312\304R\017\324Yxu\326s\204Vf\272"
+	.ascii	"\340\261\366\f\335X\352\363;\227\036I\3779hG\205\261\204\374"
+	.ascii	"\360'~\200\243\223C\372l\370(\245}\350\020\231\245\305\333\376"
+	.ascii	"\276\314\241\206}"
+	.string	"W\201\247\372\235@hr\371\230\b?\253\356$\253\232\026\213\250\024\021\335\365\035\2674\017\033\b\300u\244\007hsoy\342l\316\224-\021\365\251\236i\357U\033\363\037\332\267\274\207\361\030\024q\307I\323\307\333~\332\226\214\016\267\204/N9*\212\324\n\316\377\367\311\373\361Y\275\242\341]f_\326\370\375\303\371\2043\021(\245\3265\261\223\3779D\204\220\210\373\216\332S\\\233\271nW\252\336\255\\\222?YJ7u\237\233/0\r\314\242y\254\307\023\030t\027i\271r\200'\243rbN\211\024\266\002V^\307\177\277\037\345\255\266\255N8\262\303\231\357\333\305hw\326~B\021s\025}\332e\257\311$.\3378\3560\3648\251\026\220a\026\277\217\210\262\021\264\254\362(\b+\3068\300#\031\370x\206\005\352\nFOdF\267-\262\367\357\027-\365\f\177\027\025D\356\316\217\264n\265\023\367\rgo\0323|"
+	.string	"\035\304\3167E\025\330\272 \032\227\200\031\nP\016y:\352\225\006\203\247\244\310\215\247\201\357\005\373\241 {\365&{\304;n\365\323\025\352\336\340\301Z\033\377\356\353\337L\016\364\310(\035\341\0325\263=\320\006\262\336\204\203\276\301\203\363\352\236R]N<\371.\200\036=#\342'\223\342q\021\222\035m\035\377?n=\252Ng\256\200\345\251\347<_\\\235&\374\212\321\215+\314|{\fS<\255\301\362%&\311\307\374\207U\021\276\322\342\023\225\007h\332\236\311s%!!y\330>,ac\240\261x*\242'\347\325\343\244\252I\277\277w\277B\254\3700\311a\261\020}\313\323SE\004\r]U\342\022\304\"\215\316m\336\375\032\337\307\351+u\313\301\2237N|\350\354b\177\225:\320\301\303\376\227\201\231\021J\222|\245\347\201\254\262\035\317T\272;<\241\236\356<u\007\315wk\177\376"
+	.string	"aBJ\004\341G5Z\ra\321!\020\252:\277A\017\003T\327\2207"
+	.string	"bb\266\231i\006\r\f\027(\217S\315\330v7aJS\237\2464\374v8\263\306\343\027\321\273@\t\334I\177\020\024Z\3622H\302b%\004\331\260)F\323\005\247,\340\36662\303\030-\rx\324\207\031\260D<}\262\360{\236! \341$`9r\\\354Z\351\210 \340\241\237v\024.\377\206k\374\237\256\326\030\020>\034\231\322\276A\366\034\233\002\212\271\221\344\215\371\343\205n\320/\316xA\306%\310\331x[\274&\021\325*"
+	.string	"C\020I\254\355\351\254\b\\a\313%\236\362z\200w\f\201&\202\2443\375\300\314\271>\202O,\241\230n\363~\241y\304^\274\204^\n3d\005\240\020\032\025\265,s\224\361<y\216i\312\"\247\0343[3T\210Vf\204\210&\310\003kZ\225\310Z\371C\322+\177\232\037XB\337\266\007\261i\316"
+	.string	"t\307\033\r8\314\025\243\320\372\252\362@DY\255B\302\333>\004{NbG\032X\n\351\235n\337(\237\371-\226Dw\036\025\251F\250\244\013u#|T\231\033a\022`\021\003T1&f[ \367\277Sqd@\271\322\372\312l\035\005\377A\227\276\036\326w\350\261N\207%\310\3123C\231\016\037\001\354\331\361$\277\374\377g\356h`\307.i\f\236V\332o\371l.\030\3420W\363\263\326\3344\240XB\317\345\370c\212"
+	.string	"\221"
+	.string	"_\024\216l\336\334\024\236\257_\006\361~a\001\377^\341e%\223K\225\301\0374{\215\211\374\fm=\031'\247\375\361\257a\"\013\264\202\223:{v\031\240\374{\205\017\340\376\317\3707\374\2709\3077\307\313\035\270\rs;3\300\366\036]\2047\343\261\312\313IG\315|>Iu!fQ \034c\301 \374E\351\322m\252\333a\267^\312 \362\204Q\021\326<\207\375\206\214{\034\365\221\005\330\263\250F\242\360\177\0352L\317\224\300\216\373\212cj\211\3320\033H\\\020\257\370\251D\264\324E\320\235\306\213^\013q\341\036\246\210\234l\301\373!8K\334\240\330\003\340\3732>\344\025\304"
+	.string	"\374cs\367Z\335o"
+	.ascii	"F\324\250=\203\210\017,\364r\374\036X\003\360<\357\272V\322#"
+	.ascii	"&\302F\025\210)\031\306\341\366\372\255l\321\024\224\260\342"
+	.ascii	"\264a\214\003\r\271hR0\213\265[\366\271\275\361\364\302\1771"
+	.ascii	"\337\036\307\030\200\204\260\200\372\035\r\017\321#\351WS\264"
+	.ascii	"\246\347\377,d\236&/\2420H\360\230\310\232\213\246\263\264\250"
+	.ascii	"\016h\r\346\306\231\006\227"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.part.0.188.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\211\002u\022"
+	.string	"\326\240rE\320R%\035\342W\264\001k[$cn\363:\344)\377\024\252\343\207\234)\3443\365\327\035q\366\371\b\337\032\2130k\305-\177a7hLl\003cb\017\311\364"
+	.string	"\036\035\222g\026u\021\331\262a\033{o)S\nZ"
+	.string	"["
+	.string	"g"
+	.ascii	"<G_1;\022\367\355\260\337\001\302z\272\332\345!9t\202\326\341"
+	.ascii	"\310\013\304\303\367\001\361E\367\213ll\227\353\360D\266mx<\263"
+	.ascii	"{\374Hh\017`\031\351(\005\331\335\355PK|v\3157\363\273\236\233"
+	.ascii	"\353\213\236]\217\207\247\200?\021\b\273\353\326\207\033\336"
+	.ascii	"\366\211m\022[\021\004~\305\344\273C?&\312\300\362\235\317\364"
+	.ascii	"\374\021\001$\304\376\350Mj\220\365\375\255\002\331\"\351\030"
+	.ascii	"\3230\246\037L\353K\347K?@\022\235d\355r\250e\355\b(e\342K?\355"
+	.ascii	"i\3377\272\n?\351Lv-)\311\242\224dBXNW\273Q\nZ\2074\233#q\036"
+	.ascii	"\321p\264=\001\207\357~\244\252*\225\316\020\353\270,^S\277!"
+	.ascii	"EN\326\254\007AT%\304\007'k6\220oz\322\nS\205\326\233^"
+	.string	"c\301ip\2671C\206K\036\203;\024\203\251\303\260pA%\337\251\304\027\030.\3059\260r\361\322\300*\352M\207Z\001`\265\213\363\316fy\013\316\304-g\361R\"\264\273'N\177\202\361\207\016\00354/\227\027{\271\250[Lhf`6\330k\313\360b\221\331Zb4\233\t\001\303f^b[\r\f\026\333\\\266\363o\025\310\366\277\343\343\304\r\034\315\261\252\006\331\346h\262\267K\342\301\025R\326\034\325\247zU\004\t((P\243*\017O\305\247\220\366\267\003\205\217\252\217\3439&\370C\246\220\222\022\003< \260\002!\253\332\006$S\350b\031<\272\303\032W<\013J\366[<\263n\370P \3129\bwpP1\2469\215\023e\013\332\332\340U\016G735s\262\022\"wn\255]X\362\1774{\340\227\335\360\235\335X\277\264\221\237\r\366\242\265\354\367\006\205\327&(\322L+\310h\301\"\033"
+	.ascii	"\334\203F\200v[\315\301\\p\002yl\340\311\361\242\036\212U\266"
+	.ascii	"\337\372\025\200\3053G\307\357\274\226\216\001"
+	.text
+	.section	.gnu.lto_onGpsNewData.part.0.190.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"M\013"
+	.string	"\206SG=\020\005+\035\020\037\013\211*\005H\205\223\317\336\373\177x,@\335kvV"
+	.string	"\237\347\242#\307hH\216B\026=2\211\271/"
+	.string	""
+	.string	""
+	.string	"T"
+	.string	"hPE\357\"\2064\332\217\234\327\277\311\336)\0052"
+	.string	"6"
+	.string	"7"
+	.string	" \370z\230m\262\345\322\256\371\254d\023v2\0304\233\335\025_)\311\313\323\371\225\276\352\324\343\001\362Y\360/ \264\273\356\204\334\365\266\033l3\330\267\b\306\205,\202\325X\231\344\026:\217\3714\225\257\224g1\356\373\261s\306\265\273\321\355\356\347\325\n\235\327\360\b\234\327\357\006\234W?\345\263\324e\366\300\002\244\246\037#\355:\026UM\3722\375\376-u\331\364\343q\f\210\354v\364"
+	.string	"\354H\205A\371\355\267}\332\367[.\363ow1H#C\201\335\030\232\234\215|\3158\207\254\331\236\264j\001\016\2429\022M\223@(\023\2048\226D\211\322(B$\235P\"\350\300\243\351\341$N\214\343I\004m\317S\227C\027tE\351\313v\235\237\333\024\025\363\031~\354\337x\351\351x\001\037"
+	.string	"8g\340\256^)\342"
+	.ascii	"Q0\314\025NL+\364\317\020\270k\206\2654\006\232\020\327\347\262"
+	.ascii	"\301\026x\352\370\250\022\273L\303h\301`\220\"4v\t\021;\357\316"
+	.ascii	"l\274(\031:C\331\314\333i\001\270\366\200\033-\242\337U\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\244\fm/"
+	.string	":L\370\020>0bN:w\366v\350,\226\252\266C\366\210\236\307}\317)\252\250\267G\325~\374\017L&\325\253\200\001\314\002"
+	.string	"\260\037\034\034D\357Ez\337o\203(\350\304\020*\230|\037\330&m\023\231\002\377"
+	.string	"\374"
+	.ascii	"\004\001\354\030\005u\312R\225\222\337(\215\222O\2306\224/R\305"
+	.ascii	"\362\031\311\301\201\310\037l\363\025\365\223|D\315\346\353\205"
+	.ascii	"\345\273\223z\315\267[\314\371}\026\027\027\023\235\344\323\245"
+	.ascii	"\354\032\367=<3\271&\371\316\224\311\325\022\017J\260\222tP\037"
+	.ascii	"\206D\353\310\021U\274\032\341\320`e\331\266H\3568)X_\371\352"
+	.ascii	"3\257\266B\244\253T5\225!M&\244\307\202\364\024\265Y\251l\005"
+	.ascii	"\222\017(uS,\304\373\221/\230\372\300\220\365\240\307\377x\334"
+	.ascii	"\320\216\027\352z \327\371t\274\257!\361\235\321\331\312\217"
+	.ascii	"\24692\340\260\272Qe\203\252\306\024\r\251\031\367\223qh\214"
+	.ascii	"?\325\377\r`|\361\305\001U\021\027\\\374m\361C*^Y@\300\212\205"
+	.ascii	"z\212V\344'J\037\246\"K5\256\353\272\246\310\347\223\342\277"
+	.ascii	"\333\025\305\006\025\313M\261\360D\376\236\343\312\262+\235?"
+	.ascii	"\377xVz\331\206Xf\"\377O\372?@\230\201re\357Sq\223i\266\266#"
+	.ascii	"\244\035J\272\237\212\271\332V\013\321]\372\237\212\025\274L"
+	.ascii	"Id\023\343c;\333\270\362a|t6\3363H\354\354|\215\363\344[\302"
+	.ascii	"\223{\275\223;\314N\376\245:\271\267\304\345^\243\223[\r.7\226"
+	.ascii	"9\271\321\344\344N\213\223?\tN\276\341\233\374C7\371\221\332"
+	.ascii	"\344Kb\223\237\370\226OiM\276\242\232|Hir\227\241\311mv&\367"
+	.ascii	"\0233\271\305\334rC)\223\273%\223;J\257\353\372+{L~\245fZh\373"
+	.ascii	"\240\376I\274\300\276xt\261\205P\377\033`7\266\300t|\351\360"
+	.ascii	"\252\3215$\303\273\025k1\237\013\363=0\017\364\345\202\274|P"
+	.ascii	"\227\023Zk)\252\03377\330\\\362\375\244[\362\361R-\032\262\344"
+	.ascii	"\347\251"
+	.string	"UH\353.h\371\217\260\344\027^\231p&A\265\222\333Nj\226\033O\211\bjY\276\243\264Jsi*\255\205Dgi\262\016wh\016\235B\260\367\006\317\243S\030\231\370DS}&\320\231@\207NE\0204<$\3206\207'\037\232\013J\341\344\333o\022\212\365}PJ\300\337\224\367\350|\241W$\205\273E\276\357\022'[DK\314\32469\373\311l\315\330\243K<\2405\340L\264\304P\314n\005\314\256\360\245\017\215\253\313\331\306GX.\365p\ny\333\030\035\334;\337\022w\3333\312\326\212\317F\216\221\022\305K\234\266\265\275\200\214\\\231C\227\270\023\235\315 \r\356}J\334\321\266\323@\272\277\037R\342\354\244\331\035f\t\316\225\370\313\213mc\024D\367J\034\304G\363\331\305v:g\022\364J\234\203\r\207\222Ub\003L\247\267[M\231\265\007*1\323\313\3246\026\223\324%\351\354#Y!\334\333"
+	.string	"\262"
+	.ascii	"\026\"\231}\340m\016\360O%\206j\366\367\356\300\271=E\341c\333"
+	.ascii	"\013\320\356\300\0350\n{=;\365\013[S\237p\2779\033\007\367\361"
+	.ascii	"\366\335\270\271\301C\272\213{0\373\211/\357|w1\327\333\237\213"
+	.ascii	"\222}\321]\034\325\036\365\\\267\037\336\305\t\240\b0\013\224"
+	.ascii	"\271qUO;\247\341]\234l\221\224\352\240\207\336\305\315D\274\213"
+	.ascii	"q\\y\336]|lv\253\275EB\373\335\263\3234\177\214\314X=\217K\242"
+	.ascii	"\026\301\250\347\341#\233\335\357p3\r\177\207\267~\207\233\232"
+	.ascii	"t\267\303Lls\230[\371\274\356v\030\331\366\03058\366\320\333"
+	.ascii	"\325\275O\326\353\260\003:\314\324\324\272\036\234dv\2105c_N"
+	.ascii	"x=\330\311\351\247\205\235\332&f'\367\f\022\373#-\234lfia\bm"
+	.ascii	"\324\302\311\2670\013#\375\262p\267\204\035p\263wXX\204\025\026"
+	.ascii	">\276mdt\205\217L\367\215\256\360\326\2106:\272"
+	.string	"\302G\266'\245\025\356&\225\240\251*\334l\247z\210\201`\226TxD\343/\242\302\n\230P\257\001\246SS\333S\321\200\347\250q\024\210J\211FdF\222\244 \031\016\300\002)\032\332\346\021\260\024\303\220\231\021\231@D\202\244\240\007\027X\230\375\3600\017\177?\001Y\263\350\003\"\215\025\232\236\007\3617\206By\350\3634\206\377l\270{\211\357\tk|\320\301\023\300\337\013\314}\207|RQ\004_qo\313c3d\255p\232\365'/ej*\265Y\302;\n\261\327\375\023\331\226f@\226Y\344\210\337w\354\362x\t\f\231\246y\013j\220\205\212\025\323\376\304B\222a\374Fk_fYHII\246\023xLk\311U82\274\376\342\215S\327\204\347\006\261\327\231\322\020q+\365p\302\n\221`\035\204\n\215P\320\264u\273\254\323\216\006NZ\333\213k\205-\251\223\336\035d\340\367\246\376\026\221\334\2117\303\005"
+	.string	"\376\237\217\277\235\305\276\315\306\336\316b\337fcog\261o\263\261\2673\304\200\257\216tS\220\004t\f\335\340\3463\267\025\251\234\271\034X\013q\004=+\223\370\254\031*\021\307\226\205B\221#"
+	.ascii	"&p\336\027\031+\202\300\375\362\313\221'\377\230B\254\375;RK"
+	.ascii	"\006k5\2169\2117\013\355\327\207\307R\335\016\032\263wG\372v"
+	.ascii	"\"\226\316tQ\314\022H\202a(m\253\315\247p\032\265Q\302\375\222"
+	.ascii	"}\275ZN\342\303\024\020\353\002\322?\232\301M\240f\363$L\300"
+	.ascii	"\263\017\366\006\225~p\027\207\365\303\235\343\363\374<\304\306"
+	.ascii	"\b\351`s\032w\357\273\027\235\0039\261\321\r\237\275\224\227"
+	.ascii	"s\370\252{\301\003\352#.\037\375\022\030e\016\257e`\344;%\r\300"
+	.ascii	"?"
+	.text
+	.section	.gnu.lto_.refs.488b1d5191bcbb20,"e",@progbits
+	.string	"(\265/\375`\327\b\235,"
+	.string	":c4\021H\220\332M\032\003\200\220\024\005A\020\224\200p\341\2326|\342'kO\353b\n\210\327EQ\023\304\252U"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\211\256\3413#\355"
+	.string	"5\361\264\231\324\2646\323\361Gkf\204\303g\354\326\244A\321\274\307\226)\004\001\373"
+	.ascii	"\b\001\227:\373\220n'u\037T\356?\345\373\220;\217n\337)\367\334"
+	.ascii	"\320\216#\367\221\334m\344\256C\3565\241}\311\203\246x\264\266"
+	.ascii	"/\022\263\333\276Gp\277c\267_10#_C\352\276]\\Z\365W\b\320\276"
+	.ascii	"@\200~}\364\340\261\003\307\316\257\215\237}k\320\360\331w\206"
+	.ascii	"\214\236}c\300\340\331\367\205\013\026;\373\256P\201\3337\305"
+	.ascii	"m\337\023%F\204\370\320a\003\006\013\342\276\023\302_\to\330"
+	.ascii	"\250I\203\346\214\2312c\304\204\001\363\305\013\227-\343~\226"
+	.ascii	"\361\277b\333\237\002\345,\367/\301\355+1+#\033\023\367\303\302"
+	.ascii	"\177+|\254\360\255\302\247\n\237\200\270G\205\017%\356O\341;"
+	.ascii	"\215{\323\370L\266})|`\370\276qG\032\377\310\266\363\302/\303"
+	.ascii	"'o{\320\270\377\214\3573\356<\343\347l\217\023\3671|\233\270"
+	.ascii	"\213\341\207\342\256\023\376\326\246\275e]\335\313\272\017\325"
+	.ascii	"=\210~\017}\032=Gg\221\276\373\"\222\373f8\332\367\302\021\005"
+	.ascii	"\240\b?\373q\336\364\354\267a\303\223\364k\331\331\307b%i\237"
+	.ascii	"\312\023'M\226$!\023\013\373\372\231\364\271~&\335\300o\2672"
+	.ascii	"\351U\343>5\276\324\270G\215\377d\376\200\337.\340\367\001\314"
+	.ascii	"?\177{\320\244\003\177\373\357\367\246\371\275\337nd\322u\276"
+	.ascii	"/}\273\220I'};\220I\3671\351=\276}\307\244\343L\372\315\267\333"
+	.ascii	"\216^4w\235\336\323\220\366\332\333s\216\326\350+\007\311\035"
+	.ascii	"\270{s\267\367\302\275h\367D\272}\247{]\271\017\225\337\263\373"
+	.ascii	"\235\334S\362\242\333W\231\"\364K!\332\207B\364?9cR\373\225\350"
+	.ascii	"~3\336~\031\357'{#B\373_\345O\304\213\334\347\312\355\366\263"
+	.ascii	"\302\375j\367V\272\275J\367T\345.U~\024\271?\355v'\241\275)\267"
+	.ascii	"3\345\376\324\355A\335+\225{R\371?r7s{O\267\033\351\276\250\334"
+	.ascii	"y\345\357\310\rtGZ\372\243\340\027\325\337\005\277\254\223u\367"
+	.ascii	"\251{O\335w\352\236\253\373\355\374\261\356b\335\303\272\327"
+	.ascii	"\352N\253{\345\321s\3526\351\246\025(H\210Pw\372 \016\2347m\326"
+	.ascii	"\250\351Re\212\024(N\2320Y\222\244\326\0342\316_\022\"@|\360"
+	.ascii	"\300\241b\250\347\371s\251Y\260\\\261BE\nER\311\304\300\004\374"
+	.ascii	"E\350O\204\351\367:\353c\005\240c\001\240_\235_\240~U\335\247"
+	.ascii	"\352K\325\235@\335\241\352\376T\367\001\347\013\250;S\335\001"
+	.ascii	"\324\375\254{\220\276\322\322'\005\337W\037\251\356\275\272\033"
+	.ascii	"\325\275\250\356Du\337\325/\351\017\005\237\254\377C\337g\351"
+	.ascii	"s\364qu\037\203/\326\247\325\225>\233B\210\363\006\370\353\306"
+	.ascii	"\334\227\215\232\336/\0322\265\337#?0#E\276\274\272\270\266\264"
+	.ascii	"\262\204\004\371\375\002\021\367\375\361\033\177u\370~s\020\355"
+	.ascii	"{\203\250\326\002\205\371k\202\267o\t\036\020i\337\016H\277\034"
+	.ascii	"\200\373j\350\005\317\204~FO\352 \347\271h\301R\005\353\247r"
+	.ascii	"\331~\024\361"
+	.string	"\262$fG\306\304\276\206xum\235\2175\376U\375\002'U\335\245qW\032\367\244\272\373\352\032\235\363\352\013\325'\201\036\2736x\232\2363\330\303\307\366\332c__@[\b\353\311\240\236\361yr\207=n\260}<l\327\031\354\253\270\202\361Z\202\234\305\277v\332D\366\256W\244\bjU;\356&\376x\327n\023\277\216\037\260]\365\326N\265\326>%\276\324Y;\001\361\243\316\332\241\304\1772\260\237o\275\022P|\337\325\336\273zr\255\017\022\377\347\374,\037\221\276#~N\\\304\372\332\3704\003{\275Z\253\335b\325\005vZ\325R\355\343\024\335F\277\322\245j\024\324\276\347O\373\322\235\326\251\356M\365\231\350\003x%\372\300\245\377\005\337\254\337\253\177\264PP\335\177*\256\376H\007\024-\325]\251\356\300\272\377\002\200\321\250qtEDLDdD\n\013\222B\032\003\300\002\251!iv\020\270\223$\245\345"
+	.string	"6\3428N\216\033i\331\235 \263\326\242o?b\365\363B\250\035/$\221L\177\204u\242mog\005\031\222\206\212\333\t\262Uu\321\273\223\026/\262\212\320\246\021\032\2152\274\364\357u\240\253\231a\210\277\273\036\023\220\306%z@\212\267\306?\364\222\020\337\336h&!\376\302\037\202!\321\022\002+\347p\025\302\326O\226\r\335\370\374Xj\262\225\030l\350V\206`-\234kT*\232\025\312"
+	.ascii	"X\212\001S\020\240\261\371W\336\207\224\233\037\326\201\366b"
+	.ascii	"\0348H\002e\310\b\243_\205\302\350\245 w#;;\362\362|\260\b\342"
+	.ascii	"\356)\335\375\004\332\241\220\346\264\2132\360Q\345\374\3134"
+	.ascii	"|\350\326\322\217GU\234\367\331\266m\\*\347l\233\346bk\306\035"
+	.ascii	"\212\205\005\237\2027\344\276\037\035\273d\362\233\342\353\337"
+	.ascii	"o\031\267\302\r\234\373@P\005\223\334\3701\303Y+\036\251\203"
+	.ascii	"\f\330*c\274\216\247\n(\231\361\207\312P-\007s6\013>\350A\306"
+	.ascii	"5z,\3650\205\346\201t\335\316\206\356R\005\311P\273\034\201j"
+	.ascii	"uj\322G\373"
+	.text
+	.section	.gnu.lto_.decls.488b1d5191bcbb20,"e",@progbits
+	.ascii	"(\265/\375`z\213\225?\002\032\265\203\315S\0200e\3514\006\326"
+	.ascii	"\366\034H\245\233\217\326WU^*U?e\007-\300xj\214h\231\252G\275"
+	.ascii	"\b\262\320\242v\275\b8C\002\306\b\007Q\253o83\361e\273@\276q"
+	.ascii	"m\352_\213{\222\244\250\324\032*O\2079\037w*\213a\333\336r\357"
+	.ascii	"-\267\224)\f\013\322\f8\r\254\030]\024\0348\037\345\323\307m"
+	.ascii	"rWJ28\224b\254\316\3404\230\017\253\301z\030\rn\3425w\211\367"
+	.ascii	"~lw\343\2361\033\336\303^p\230\033\007$\001nX\327\215.l\017\337"
+	.ascii	"a37\316\314\0057 \312\275\367\361\230\271*\345\036\256\003\001"
+	.ascii	"\002\304\317MJ[S\332\2201\036.s\227g\303y\\mI\\8\037m\352\025"
+	.ascii	"{\357}\317\226\252gK\217\332i\2349}\024\214>\n\247\217b\321?"
+	.ascii	"j\372(\232\306_p\334]r\300`\366\316=\003\244E\024\316G\3074\t"
+	.ascii	"\366\276\034\322\373\367w9\244G\235h\314\005\350\270K\372\246"
+	.ascii	"/\206\031\316;J\364Q\245>\032D\037\275\322\037\256Oz\264\206"
+	.ascii	"\036\341\372\2448\373\372\244\027\225\241q\230\327'\275f\267"
+	.ascii	"'\305U~\200\311\277\254&\316G\231\364K8S\301m\251L\303T\356\022"
+	.ascii	"O\371e\356\237\360\003M\301h\367\254C\213\275\257\254\2007\326"
+	.ascii	"\350\326~@\254K\260\230\361H\363\263\235~\026\243\237\343\364"
+	.ascii	"\217\245\034\227\375x\fC\271g\035\250`\355#\303\362\002g\034"
+	.ascii	"\005\350XJO\232\244bn\263\275\367\316\316\227&N\346p\306mo\332"
+	.ascii	"\207y}R\274\005?\271PrtH\321\302cZ\241P\336\230(\211\205\001"
+	.ascii	"\231yM'\330\tF\202\231\340%n\202\227`/\374\205\223\340.\254\004"
+	.ascii	"\203\335%\016\303F\216\225\370\3103^\025\306\352a\244\031\247"
+	.ascii	"\205{\244\215\021\202}\374\270g:I<\273\305\230 x;\210\024\311"
+	.ascii	"\241\f\202\245\344\212\002D\017H\017\256\246\034\021\035qBzX"
+	.ascii	"\001\205\341!Q\252N\370/^\030\316\272g7\216j'\351\231\300\026"
+	.ascii	"7\227\203oo\346\017\312\364\205\327fA\306\314\353\223~\270=\351"
+	.ascii	"s\023\375\234D?\013\321\317X\372\031J?o\375s\215\376\251\247"
+	.ascii	"\177\312\351\233]\237t\013\363\320SfK%V\266\310"
+	.string	"\364\317$\372\247\026\276\302~R]jp\376)\205\255\316\027\372\307:0\330aN\311\340\221\003\207N\336\330]\022\216c*\257 ?\332p\276\361\203~)\243L\341|\354F[\301r\277\210hJ\256PP\2024\345\354\256\224`\310`)/\0301@\232:\232iS\356\232\210\246\344:C\216H\334\017\264w\371\316'I\215&'\243\231\006\252\t\344\207\223D4%W\032-`X\271\3622\"\232\222k\223\234\220\2603\267Ng\211g/m\345P\356\315|\t\377\005sg\205\347\342\226\271fD4%\327\030rU\315\275\2317\355'\341\004\354\0023\335\263\223\251T\313\266\214\\\271\377\352\241\271u\347\223\244.\203\202\243\2717\363?~\201\243\260\f<\205i\340\032\330\006\216\201a`)\374\204\2350\024N\342&<\343.\261\013\254t\334\002/\375\207\271\367\322\336\3737\354\007\302.n\337us>I\356\245\036I"
+	.ascii	"`\372\242\245\215oo&\210\037\020:cCd09\310\307f:\335\327'}\334"
+	.ascii	"\355I\217\233\350\037'\341m\366\004\317\216\231\221\320\251\031"
+	.ascii	"\271\313\373w\3370\367O\032&\007\344\r\347\343 \372x\213\315"
+	.ascii	"m\263\263FF\2329*64\356\032\234$RPEp>f\272j\236\307\262rN\245"
+	.ascii	"\251.j8\377\372\351\3374\372\227N\377\276i\036+\372\277f\362"
+	.ascii	"P\245\221\2612q;8o\232\310\355\300\371\327L{\270=\351o\023\375"
+	.ascii	"[D\377\356\320w\314\235\273\313\017\227\3567\314\225\373\272"
+	.ascii	"\304\334d{3w\32694Vf8\377R\351\337\017\351\316\337\337\337\337"
+	.ascii	"\375\220\376\306\320\036\256O\232oO:\302\355I\037w}\272\\/\\"
+	.ascii	"2\023\026,@p\276\261\313\271\244a\234l)p\277"
+	.string	"\\v\210T\001\303\003\347\233\345\276\375U\341\302\206\363e\273Z\356\362\203\333\366\273\345\272\035Ubn\346\336\314\035,\304\357\f\n\316<\327'\305\267'\375P\377~\220\236\177\177\367\203\364{/\363\177\005\266\005\331\362\202\3639\240\017\001}\346\355I\257\232\276\321C\251\f\316'\200\376]\336*TX\277\"^\370p\376\363pv\207\2340Rd6\316\037\200\376\332\355I\377\213v\206\345\272<\265\3309o\300\336\264\301\371\277fe'\f'i\324p\276d7\312]bp\2450\227{3wp\240\240\204d\341\374\016\364/\006\351\375\273\030\244\277\313\013\345\277Nn\330\035;\235\236\262\266\331\336L\r\013X\242\343\016\347\313\274O~\307\256\330I8\341g\322\330^\356\275\357\230\tY{+\335\261\0357{+\355\334\273\301\275\033d&[F\320\322|\r\364\231\327'\325\267'\375mr\340\330>\341X\347\017\351\257#"
+	.string	"Bh\342\203<\200c\360\353\013\374\370\314\217\365~\334\3741\337\217\323\374\270\210\225\037S\371q\225\037_\371\361\332\217\263\374\030\356\307l?~\373q\333\217\265\374\330\355\307j~\334\345\\\361\243bh\330\217\347~l\365c1?\256\243C\235\374X\356\307k~l\367\237;?f\363\237\351\231\377\363\374O\374\237\350\177\346\374\247>\363~ty\326\375h\023\224\311\217\203\240`\377-@\036\203~\375\331\013\352\205\202\007\267\003\006T\3440\377\375A\227\374\250\362\177Y\026\363\243E\326\230~u\307\177\206\220\212u\310'\200"
+	.string	"\341\031\374\032\002#\374(\217\034\242\n:\202\f\202\256\300\217z\360\243\037\234.\347\374\203\357\374:\204\377\324"
+	.string	"\n$\204\020\227\210S\270\224\313\220;\370\357\341\3270\240?|d\2373\304)\200L\301\217\366 \300\245\344\016NW\210\362"
+	.string	"!\303\031$\336\204?m\"$\007\361\352\257}~\364\347?MD`\353G1\320\372/\372\277MFw\364\3454\007\315\"\221\356\310R\376\\\366\243U\367"
+	.string	"\003%\316.\r~u\350?G\200\332"
+	.string	"qE`\016\377e\300\335\224\316\035\037t8W\270\r\370\261\006\377\225\001\304E\272G\267xU\374\227\305\177C\360\337\031.\t~l\301\177\225\256\362\222\335'W\310Ur\305\356\327\177\223\374\327\310\217\352@s\374\027\354\277A\376\353\344\277K\376\353\365\337\256\377F\371\357\220\377\216\375\370\347\277f(\216\377|\272T\356\332\217\t\360_+?\316\340\277[\376\234\344\317HP\252\377\222\371\257\336\177\363\376+\274x\377\335\356\336\177\353\376\333\367c\f\376\333\346\307\371\307\351\217;\374\230\305\n\320\341\371\361"
+	.string	"\260\206\037{\370q\005?\276"
+	.string	"o\240\364\344v\370/\303?\370\371\357A\207K\314GH\020\343O\375\376w8\377\256\376\375\031\353Go\240S?\226\341\307\016\3701\004~\034\201\037\307\360c\022?~\300\177\216\340\317Z?j\343\307\005\370\361\t?F\341\307!\3748\005\ft\022\271\t8uL\341\022\330\004&\372q\361\307F?N\361\343\341\217=\200\207\376\323\003h\215\242\037\023\311~\224\306\237\321P\251?k\371\321\250\377L"
+	.ascii	"\232\3741\007~\226\201\377\0360W@\241~t\306\177:\023\347\001"
+	.ascii	"0\360\247!\370\321\030\3777<9S|\375\323\266\233\235|\372W\365"
+	.ascii	"\260N\025\320\027?\336\201\261\360\neJ8\335?\270\317\257\213"
+	.ascii	"9\205"
+	.string	"\363\nuB\202\2728Q|\003^\241\354\024\374z\004?\036\362\002\212\200\246\323\016eB\227\320\026\331\r\247\360\237\025@\225\376["
+	.string	"4\351L\223?(\300>!\023"
+	.string	"e@\t\376|\200\377,\001%\001^\341r@B^\300\177\242\360\b\374\232\351?\325\316\340\035g\232\3778\277J\346?\253\240#\370Q\r\"\270?\007\376*\326\177U\370o\006\377\005\372/\001\316\017\374?CC\360\n\376\024\315\237o\2403\334\037\026&^v\235?\035\363\243\307\377\034q\013\220\315\374\250\361?\037\200~\340\317v\177\276\373\321\243\233\302\t\367\347\035Nw\020\277:\346?\221\271\017-\376'\007?J\374O-\377\331\206\032\375g\006\377\031\200K9\261\240E?z\364\376h\212\037\023y\273$\374\327"
+	.string	"\377\355\340\277(\374\371\355\317p?\352\201\377\246\360\337\023~\024\370c\f\f\377k\302\177E\334\002\234A(Q\005\035\376\301\217\0165\377\257\360\253`~\\\344\307A~\314\343\307>~<\344\307\\?\026\362c ?\336\372q\217\037\023\371s\373c\254\037\353\370\261\213\037\327\3701\324\177\r\277\246\362g\247??\3759\306\237_\374\231\351\317.\376\f\343\3173\376\363\r\355\300\237\217\177^\372s\213?\243\370\321\340\177\236\177\325\340?\355\332\376\363\313\223\377\244\263\362\237e\376\337_\355\362\237X~\224\003?\272\001\f\374\350\005~\324\002?j\342GK\374\230\004?\236\341\307#\370\261\b\376\363\312\217B\340Ge\370\321\006\374(\f\3777\374*\327\177.\340\370W\357\217\276\360\243\n\370\321\025~\324"
+	.ascii	"?\232\302\217~\360\243\034\374\250\207\037\315\340G9\374\350"
+	.ascii	"\206\037\305\371\321\373g6\177n\376\371"
+	.string	"\356\317s\177\376\362g\270?\267\3759\355\317e\177V\362\347!\177\326\372s\326\237\251\376L\343\317Q\177\206\3723\212?S\340\317%\376L\342\3171\374\271\001\177~\341\317,\374\031\001\177&\300\237S\370\363\t\177.\341\317\037\374\031\204?\217\360\347\020\177\036\300\237?\374\271\203?s\360g\r\376\334\341\317\026\374\371\347?7\360g\n\376\234\363g\366\317\351\177\376\375'\337\177\252\371\3174\377\251\366\237g\376\263\371\237y\377y\367\237u\377\031\367\237o\377\271\345?\263\374\347\332\177\246\375\247\331\177F\371O\346\177:\371O&\377\351\365\237\007\370\317\256\377$\362\237B\376\223\353?\177\374g\217\377\334\372\317\035\377\211\365\237:\376\223\352?\247\376\263\306\177J\375g\362?g\374\347\323\177\302\370O\247\377l\372\317\245\377T\372\317\375\237$\370\317\020\374'\213\377D\376\247\361?S\374g\b\377\025\376\227\341\277\025\374g"
+	.string	"\376\023\305\177\266\377\031\364\237\302\377\f\376x"
+	.ascii	"?\016\361c\003\374\247\005~\f\364\237&\3763\002\377I\342?\037"
+	.ascii	"\360\237#\376s\001\377\327\374o\363\337\313\177\266\360\337\355"
+	.ascii	"?\335\177&\340?W\370O\024~\274\302\377'\377M\374\227\362\337"
+	.ascii	"\354\277\304\3774\341?K\370\317\020\377\t\302\177\202\370O\001"
+	.ascii	"\374\217\341\277?\377\371\341??\370O\017\376\263\347?7\374\247"
+	.ascii	"\206\377\344\371\361\362\307K~\254\374\261\221\037;\375\270\351"
+	.ascii	"\307L?^\372\261\322\217\217~\034\374q\006~<\201\037\233\370\261"
+	.ascii	"\004~\334\302\217Y\370\261\002~\254\302\377\022?\336\340\277"
+	.ascii	"\t\370\357\n\377E\300\177-\370/\207\377g\377\313\376\217\375"
+	.ascii	"g\376\207\373\357\301\337\337\337\337?\301\321\337\023\343\027"
+	.ascii	"*\006\372=o\372O\265,S-\351\026\324io\251\001(i\346\300X\323"
+	.ascii	"\324\207s\332\026V\243)\f\347\367\230\351\367<\321\177\312\226"
+	.ascii	"fqk\316\320\3039\305\222\317\230\252\264\341\374\036$\372O\257"
+	.ascii	"\244k|oc^\340\\\245J\272f\245cE\251v\227\351\032\332\344\n\363"
+	.ascii	"\306\331\377\025\335R\203\247\206\363{\254\364\237\242=\245\362"
+	.ascii	"\247i\351\0246G\335\214\0358\337\272\353\223bp{\322\374\004\364"
+	.ascii	"\024\r]2\205\203\210\331\323\263\337\261)qf\242pN\313\200\236"
+	.ascii	"\232\351\254%^[8W\020e\231F\311p\037\230;\351\247k\323\255\361"
+	.ascii	"\355$\025\b\016xZ\343\206\363{\222)\024\03551\366\332p\376\206"
+	.ascii	"6\351X\372d,uZ\322J\362\225\206\245b\371\013\317\016\263W\036"
+	.ascii	"be\232;\231\004\341\033\322\350\247`)\223\247M\2366I\235\234"
+	.ascii	"g\357\335b\357\253*\265M\223n\215oS%?\374\351\362\251\223\314"
+	.ascii	"\304qx~^p\376\336\035\373\277\342<.Z\266p\376\0061\372\277\307"
+	.ascii	"\177\272\225\222{o)\224\271\223-p\322\377\376\242\367~\370s\356"
+	.ascii	"y9\370\237\317?\206\r0\367R\231!{\357\233Fw\251)\351\360\260"
+	.ascii	"\321\270\275\227\264\222\022\240\025\345D\246\025\245\301iI\353"
+	.ascii	"\206\023\231V\224\006'2\255\235\264T$ICrk%9\221\355\255a\357"
+	.ascii	"\275\367\322R\222\013YQNdJ[\203\023\331\216\332La\242\356fj%"
+	.ascii	"\355\245\254\255a/m\245M\226\025\345\301iI+\312\211L)J\203\023"
+	.ascii	"\231V\324&\323\332<{I)\371bi'5l2-\275M\226\025\305\343D\226\025"
+	.ascii	"\345D\246E\345\306\200\261\344\253\006\336\020.\265\253\347\264"
+	.ascii	"\264g\310\250RJ\362\30491\263v\335\336\327\254i'w\334\336\034"
+	.ascii	"\354]\225\225\254S\272q\327Z\304\315h1E)\3532\367\336\034d\264"
+	.ascii	"\330\312\332KqIw\3079%\311\332;I\013\242-c\357\275MHb\306m\256"
+	.ascii	"\033\227\304\243j?5\355m\301f\356-c"
+	.string	"\357\244\273\343\366\336I{o5Y\305\334;\007\217\223R\206\214\275\251~d\354\252$+M{c3\273\265('\262\255, +R\310\224\333\0053\351:=em\345\256\323Jj\262\244'\373i\357}\321he\024\21538\177\303\222t\t\216\322T\02508\177\003\021\375\247JP\033I\272zT5\2119\362\264\353\277VR$z\311\265#8\347}}\322T\t\364\364\310-\253A\005\006\347\025\214\024\221\001\006\214<\"O\213\340\254\275\315\214L\261\345\341L\002\320S\"_Yv\364\r\341`\005\313\207\220[\247\317\362\342b\004\301f\260\221\031F\366\270.\033 )Uf\213*\243\367#\365\001WF\205\211s\017\246\316\213/xRp\376\206\034\372\177\252\225\356H\261\322\253t+\315\272\313\224GZ\205\231\322\034\347\223\244Vk\201\327\264\262\342S\332\3302\223\362Hu\3345\247\362\224)\217\364\206\223+Hj"
+	.string	"\315\374\260j\323\311\327`\247\257\241M_\003Z\212\343\222\225q\265\301\371\032\272tJ\365\235\003\354\261f\246\204\3635\354\320\327"
+	.ascii	"\245\317\303\247\377\264FVJ\003\255J\245\256\221\250$xiT\n\025"
+	.ascii	"\246\211&\n\316\307l)\024\312D\333\234d\312\006\374pk\246\311"
+	.ascii	"t\306]\246POc\244O\251\214_\346vZ\332{\247P\250\233\364\305I"
+	.ascii	"\246l\200\213-MTkL\236T\232s\362\372\244\037Ka\374+\333e\r\016"
+	.ascii	"%\316\347\321\323\251\3239f\311\222\r\316\347\231\323\277r\251"
+	.ascii	"R\232\344\324L\367\0307~\177o\306\274I\225\320?\277\324E\312"
+	.ascii	"\224.\245-\322\246\273L\225\256\246\254\211\031N>\317\027}\036"
+	.ascii	"6}\2364}\236'\372<L\364y\2724\312\206C\366\002\246\356\t\316"
+	.ascii	"\347\371\241Q5(\036\272\247\243\304\263\367\217)JT\r\372\005"
+	.ascii	"\275+CS\242j\320'\250\027\235%\236\275\177\244\241}\350\032\224"
+	.ascii	"\357.Q5\034R)\0364\266\316h\032"
+	.ascii	"\275\244\352\217\n\316\347\271\322\277rf\302\312\270p\2026\321"
+	.ascii	"\274\262%\032\364\f\252w\227h\363\370'\003\t\303\344\245\363"
+	.ascii	"y\246\364yd\350\3630\351\363l\215\332\241jI\226\326\350_703\302"
+	.ascii	"\310\230C\345\250\350\3201(\031\264\016\025s\227\350\334\347"
+	.ascii	"\3208\250\271\333\367\324L\3636\247\003'\177\247\214\376\016"
+	.ascii	"\235\376\316\027\375\0356"
+	.string	"\375\2355\215v\301\271\241\306\006\006\316\337)\323n\250\031\252\345|\222t\300\217\257&\231\021e\331\020.(\034\272\005mC\337\356\022u\373\3210T\314-J\021\345\tn\250\024\"J\234\227cK\035N\376\321\263\243Z~t\f\205\202\262\341\254< h\316\340\214f1\243\261\027\325\304\371;^\372'L\371a\325\224C\3270]\031\020*U\312+h\025T\r\305\202Z\271Kt\315,\215\356J\211\256\241h\307&\335\332\227\216\215\035\203\fN\376\216R\177\347\207\376\316\225\376N\r}:\001\035=\303N|8\005\301\371;.\364w\266\276\316\236\276\016\031}\0357}2\257O*\342\366\244\327\311\242\2573E\237q\327'U\301\t\272d\"\204\307\021\234\321\345\2172A\233\334\263\373\005\311]\037\316i\336\027\320Q\260\261\027xb8\277\214\327\022\035/4;%]IP%\367LU\343\313\232\2023\216\273>\351"
+	.ascii	"nO\212\"\001:\332\225\227tk\320\340\f\002z$\211*Q v.\304\260"
+	.ascii	"\301\3717\016\306\224&\026\252\305d\206\031\2150\245U\214\264"
+	.ascii	"&\024*\265%V\003\275\341\0045\202\nA{\240?P\"h\020t\b\312\205"
+	.ascii	"\362@}\240E\356\022\005\202n\371\220q&\247\003\275j\321\244\271"
+	.ascii	"7\363\352\241@\320'4\024\bJ\205\346\2202\301\2139\227\003\304"
+	.ascii	"ID\255\314\357'_\207\231\205\356\330J\222e\205$\213\253\n\265"
+	.ascii	"\322D\242p\221\202\363u\256\252tl8\2418\206\222\234\215\341|"
+	.ascii	"\035&\375\03466\320)T\214[\031\033\236\r9\375\034*h\024n\013"
+	.ascii	"\242w\003\347\347<\321\311\034$\37299\364s^\350\343\260\321\307"
+	.ascii	"\251\323\307\321\242\177\364\005\352\204:\241.\266\320\246\274"
+	.ascii	"\346\326)\255\270\240L\350\022\256\002\366\325\344\350R\035\316"
+	.ascii	"J\246c\326\226\272\340\374\243-P%\325\253\006Z\335\231\214&\247"
+	.ascii	"A\223p\200\033\f\331\r\234\321\275F\315\213\033\234\217c\246"
+	.ascii	"\331\3445\"\232\222+\214-\273\246\033\374\243N\351&\363}\371"
+	.ascii	"\313m\362\233\354w\227\331M\356s\223\367\362\232\016-\234\266"
+	.ascii	"\222V\007N\222tk|\230\215\212\037\033\233\217C\246\217\263D\037"
+	.ascii	"G\251\377\274FM\223\032>\206\354\235\325J\033%6p>\316\020\255"
+	.ascii	"2\257Oz\276\333\223\3360@\317g2\0175PH\364\350r\312\330}\311"
+	.ascii	"\205y\2631En\213\034\3359%F%\214\016\277\211\301e\272\314C\314"
+	.ascii	"M\214\230\332\215\243\313`\304\270\320\345\255{\246\223\304\334"
+	.ascii	"Pj_\034\335\332\027\231\214\227\233\371.\347e\273\\\227\313d"
+	.ascii	"3w\231\351\362\230_\274<\207*ox\355M\2201\316\225>\016\r}\034"
+	.ascii	"\031\372\300?} \033\375\347\270/8[I2=p\316_~\314\345\354\202"
+	.ascii	"\003\347&\327\006\347\334\005\350\331\313\337\037\026.\234u\270"
+	.ascii	"\300\351|\335`3\333\342\226\337\356X\216\224(Jbp\276@"
+	.string	"\256O\352s{\322\334\006\364\274E\277\3212\203\013\347\t\262\226\0179}s-\2762[\316b\007\266\005\347,\277g\035\250\340\224\232\002E\t\226\234\326%\205\313\r\234\177\345\262\031\016%\0179\031\312\266\\\246#G\301\032\363\003\245\235Pig\217\030@9-K\351\262\"\226\344S\313S\362Z\276\222\253d+\231\312]\346\264|\366\214vb\0353\367^:\325\210]i\362d6\213>\260\212>P\212>0L\037\350\245\377Lv.\271M\311\223$(\037,aI[\342\374\3471f\023-[f8g&\316b\371\31133\207\235\204\023\216\263\264\227{333\357\255t\357\006:\367n\200\262\021Q\202\222\346\003\2178\001S\331|y1\222\3012\220\214\344|\222l\200\\^\263G\237\362\207\231\257\354\225\233\344%\231I^\336e\006\313]\317I\262\222\f\226\267\332\270\375W\217\307}\323Q\342\331K-\330\270"
+	.string	"\313>\356\333\311\\\323.\240\3605s\266\374\342\302t\362e^\237\364\347\366\244\007b\035\271\\ihl8\037\030\245\377\347\"\231H6r\227Y\231\205\004\251\013\033\202\315l)3\327V\2122\301Ir\377\200"
+	.ascii	"\001\002\007\313\362\214\225\316\007\306\320g\375\364\331>}v"
+	.ascii	"O\237\325\323g\311\350\263]\364\3315}6M\237%\323\177\326\312"
+	.ascii	"U\353\231\325\013.\234sU\236\221\251\360J\310U\330\f\253\211"
+	.ascii	"h\332w\247\201c\323\314U\347\224\323\315L3W\235\\N7_py\271\352"
+	.ascii	"|\223c\3348\263\007\300\225\311\221\263\262\216\214#c\345\253"
+	.ascii	"l\225w\334e\256Z\312U\370\312\331B\204\324^\225p}\271\n\223\341"
+	.ascii	"2\2706\271\352l:\317:\274\330[\211\013(\2667\007\020 @\350\310"
+	.ascii	"\335\270!cC\3167\322\246^D\341|V\211\216jS\203\215\257\311\306"
+	.ascii	"F\231,\303\226\247d3\223\247r\215\f\225m\344\250,\225i\334eN"
+	.ascii	"\376\371)\313\320\313\311\223\006\333\215\333\002\245\rO>[D\337"
+	.ascii	"\270\353\223v\270=i\206\361\243\032)3\325\006\347\263X\372\230"
+	.ascii	"-o\030a\347\337\323\230\027M\374\306\366\227\303)+\235>bd\245"
+	.ascii	"\234$#\267\310Ny)\277\310.2Sn\272\313\254\364_\275\323\357\231"
+	.ascii	"\271\367\224\2757\213fI\247\306\223\317R\351\263K\372\353\031"
+	.ascii	"\375\365N\337}}\322\263\215\235\331\032.\234\277\276\3511V`\270"
+	.ascii	"\316\275S\315\231\346,s6O\274\363\356Ds\366\235k\316\274S\357"
+	.ascii	"ds\2229\315\234v\347\231\273<\371\376\363\355\204\323\013\003"
+	.ascii	"\244\013\325W\363\254\003k\356\315\304\363aD/.H\223\017\277\211"
+	.ascii	"\271j\342\305 2\327\246CO\016\013\217\357|Q\304\313\020\345\027"
+	.ascii	"lF\210\222\357\244\313\301Wu\267fd\001\353 \177e\323_\323\364"
+	.ascii	"W)\372k\023\3755\211\376JD\177\365\241\277F\351\257I\372ZO_\203"
+	.ascii	"\321\347\333\242\317\254\353\223\232p{\322s\013>\243\346+\t\316"
+	.ascii	"\327g\3727n\206YS\355\304rV9\255\234W\316\266s\355\314r\262\335"
+	.ascii	"%\332\231\206\337\234\310%\303\256\236\226\266)Tn\335\231R\006"
+	.ascii	"Z\023J\254\211\007\203\212\226\2664\345\336\033\304\017N>\341"
+	.ascii	"e\231 _3\3655\230\306Y\327'\355\340\366\244\247\331\332\364\226"
+	.ascii	"F\r\316\327D4\030\2507J\275)3\312\2757\320\231\365\245F\037n"
+	.ascii	"k\303S\356\360\222\304f\374\224<\332\340\232qQn\254\274\270o"
+	.ascii	"O\3120\251[\327&\006\f%~sk\206\315h\373k\312\235]g\217\2667<"
+	.ascii	"\032mln\374W\217*\357\306\026\227\323\352\007\272\252S\332\340"
+	.ascii	"\373O#g\330\031\344\\\236\312S\310\311\344,;\237\234b\247\223"
+	.ascii	"\363\353$;\223\234RN\257\023\311\t\345$r\0369\213\234J\316(\347"
+	.ascii	"\3309\344\\r2O\260\263\311].\235L8\312(\367f\352\351h\263S\356"
+	.ascii	"\275\237^\234.\376k\345\354:}\234\\\"\232\266N\343&\243\271\367"
+	.ascii	"\256j#\323\314\321vwv\235Zm]d`3i\334\234\232{\357\263\353\204"
+	.ascii	"q\353b(\367f\352-i1\212\250\220\377\023\210\023f\263\262\n\323"
+	.ascii	"\002\347\363\007\320O g"
+	.ascii	"]\224\025\0338\243\267'\275\346\322\327<\364\365\225\276\316"
+	.ascii	"\241\257m\350\353(}-C\177\355\372\244\327.\364\267\364\351\253"
+	.ascii	"i\364\325;}U\214\276"
+	.string	"\352\246E\\\237\364\252\232\276*E_\355\322W{\350\253Q\372\351\237~\272\247\237\342\351\247r\372\351\233~\252\246\2372\365S#\372\251\226NoO\372\346\365I\237^i4\353\372\244\317r{\322S)\247\n\311\0224\234\237Bi?\254\345\276\211\200\261\357\346s3\322\304m[\212\370a\267{&\242i\257H\343F\244\351\207\337n\235\b\251}\235\370\334\206\2709\223\316\215\377\360\233\273\304~?^\303V\236\3750\034n#Bj\257M\267\257\346\336\033\004\213\246\252\211\026\234\214\333\374\030\013\316\202\331\340\254\235\253\2719\0278\343\276l\325\316\235\f%\216\353F\225j[\213\302\371\035\204ak\2605X\034?pg\220\324\310\251\001\245\b\020\226\352,\016&\037\314+\234\331\033z\311\b\020\265&\316\354\224^*\322\305\f\026\316\254\215\224mI.\212\033\033\226.Z`8\277\2035v\006;\203\225\272=\260\246\336"
+	.string	"\353\252D\001\302F\235\225\312Y\233\nR\205M\3420\223v\036\233d\241\3263xwK:-t(\177$a[\234e\372\357\222m\301>\235s\227\271\251\262\222\364\b\320\006\370$\306\0230\254\323\331\247\2631\364\327\2229%\234Y\030\354\013\326\305\313\340$e\236\364pf\233\330\245\365\312U\017-\234\257\242\315\351P\022q\343\206M\372\311JB3"
+	.string	"6%\234\255=&1\277\263I\354\316n\256\3542\234\177v\257\177qoSZ=8\230\275E\275I/(\343D%%\303\241\002F\n\025\2523gV6?YIz*\264\215!\251\301w\206\251\301\342\245\357+\033\275\024\004\354I\t\316+_\232C]\303\343K\027\316\353\232\224,\n\217*]8\257j\356\227\035.;&N8\257{/\263\304\343\b\034\316k\232[\267\274\272\342\206\363\212\346\272\271m\326\346^\360\235R\270\306\204\341\374\016^\224)\2636\177\262\3161@\246\336|\221i\201\265\266\232\371\332LN1\321p^\363\364RZ\331_\030"
+	.string	"\370\325\325\255w:p\266XaR\261\373z\327\304r\266\304y%\243\227\324\274\274\341\335\255`V0\353\334\bpRHj\244T\322t)\3270_\347\306L\361\341&\007\316\253\030`\031!Vz\340|"
+	.string	"\304\255ru\377\327\324\013\224\03368\037"
+	.string	"S\272\374]\326/?Y\347\030\256\2517_8;fh\231\363\362\365\313\372cN\306\023"
+	.string	"\230\344(9\312\n\367\223\225\244'\200\344\023\223\037l\234\330\341\274\302\255o}8\262\374p^\335\204z\224e\301\371"
+	.string	"\230\242\362u\215\312\332\266\223\244\212\355S\275T\271\372\272\362\265\355\253\026\022N8\333\031\031\030x8\257l\277\\h\2448\341\3745\313z\004o\312\033\234W,!X\261\331\341\006\347\325J^\303\025\005\013\325\252V\005"
+	.ascii	"Pggk\332OV\222\336\007/O^KT0`\276\374\320\276\246\2450\325vf"
+	.ascii	"\315\377u\307\253M\2149\234\317\201\026\257\257M\274\326\262"
+	.ascii	"\235\245\2737\225\352\365\324\365\206o;Q}\300lK*\265\261\257"
+	.ascii	"e_\245\220p\302\313\340\340\250\253R\302y\215r\035\252.W\232"
+	.ascii	"8\177\205\262\222\375+\333\325\203\314\013\347s\340\245\037\202"
+	.ascii	"\036\233\212\212\302y"
+	.string	"}r3D\374\256\210\340\2742\317FE\307\367C\314\313\226\\\013\234\327\345\352\344.\017\267\206\355\350\\qq\006\207\3639P\352\337\303\245%\270\207KW&\3000\266&9\234W\260\353cF\\\230\257\177\305\321\0332\025\004\347s D\237\003\036E\212\254J\222R&\271**I\276*ic\372\221\326\365\177E\301\214!\341\262v\255H\324\030)\373\303y5\262*\357\362\\\326#\237\203\261U\205\3639\310\241K\260\271\244\347\200\006\217\257Ax\254C\200\314\237\335bi_]\261bOF\246\370\266S\325\007T\310[\230\215U\310\327!jev`\260\250)\251\002\206\206\363\n\344+\327\277\252tc\340\306p\376\006pz\365\361\365\307\277\242:h\334%\301\371\033h\321\377\332\343_q\200p\361r\006\347o\260\246\277\001\232\326\265\3227wlC\245`E,\371\2657\325\207\263\313\232 c\304r\344X\263&"
+	.ascii	";\"\226\304TegD\260\276f\201\300D\212\f\347\357\255W\377\327"
+	.ascii	"\t(\331re\275Z\255\300\354Y\251\201\363Z\005\254\202[;\202\363"
+	.ascii	"7H\242W\035\371\f\313\352\306\026\234\277A\017\375\377\253\215"
+	.ascii	"\325\306Ju\3076\324\215\"c\352\r\337\336T\037\362\0320G\326p"
+	.ascii	"\376\327\033_\251\306\360\271y\201\363:\245\227\204d\271\321"
+	.ascii	"\265\001\016\375\2574V\0328\314\207\255\224\324\201\022\345\232"
+	.ascii	"\334\021\243\r\347o\300\244\3775j\215J\347F\360\354\275%\266"
+	.ascii	"\266\223T \350\270q\225\361\302\371\036\324\324]\237\321u+\024"
+	.ascii	"P\213\255Td\003\032\311\323*\253.\016\347u\006SU\242\233s\303"
+	.ascii	"\371\036\310\240\321i\360\232{w|\232\315\215\003\222\200%_\232"
+	.ascii	"j.Z\207\026N#\226v\253\013\355f]\272qT<{\251\n_su\221&1\251{"
+	.ascii	"\261\312X\237V\030k\323\352\264\306\270\313\325\205n\263\272"
+	.ascii	"\320k\226d\232{3w\3224)\273\301\223\321\274L\207\026N#\302\362"
+	.ascii	"\232{\267X\231\356r]\372)a]\322~\253\022\001\274<\371x\343\333"
+	.ascii	"\233\t\202\003\210\2343b\352t\244\371_\225\326\244)\314\037h"
+	.ascii	"p^\267Ju\003\216\t\347{8\323\277~s\227z\357\313J\033\234=H\321"
+	.ascii	"\367\300\324\367\320\245u\237\036\323\264\"\242\357\201K\337"
+	.ascii	"\003\017}\017U\372\036n\350_\247\271hdoi\274\340|\0174\2646\243"
+	.ascii	"\365v\230\254\371H\303\371\272\371\177\225!\310\2274\234s\036"
+	.ascii	"\2063\242\224\201\363"
+	.string	"u\031\235\272\"gOp\276\306K\373K\203\003g}\247\233<0}\300ZU\301\322A\346\372\356\327n\332n\206?\27758\277\356\372\244\330\016\350\232\f\320\213\226\246\030\316\327\340\214\336r=Fo\321s#\250\266T\b4\224U \334\"rnkX&,Jcp\326`\264\234\026\363\257+\226'\271*\234\257\201\235\276\016\363\177e\201\204!\242\004g|\317\226\352/\327q\377\252.\223Kg8_\2031\372\272\213\366\302\005\313\013\234\257A\027}\315\345\377Z\202\273\035`8k8\335\244A\225\017V\273\2612B\336\256\341\376\334\345tq\307\360\223\016*38k7\240\3537#fpp8\347\334\236\364\032$ac\323ZF\270\340f\247\343\007u\266\247e\307\225+\032\313\b\027\334\332<\261\022\243\013\026\r\222jjzm\204\013p/\224;\271\005\004\325\n\311\22757S\246h*#\\\200\203R\356\344"
+	.string	"C\343Fe\314\331\231F\033\261\225h"
+	.ascii	"\273\224Li^\250\341\254\3212\250B&E\227\335\272\273\245\366}"
+	.ascii	"\221\304\253J3\003(Q\242\3501\017K{7\355\025i\274\24643P\352"
+	.ascii	"g\240\305d\3521\257.\315\323E\336\226{r=\266dk\366y\375_\203"
+	.ascii	"lA\370p~\006TM\232\350\260#q\332\311u\330k,\301\241\341\254\227"
+	.ascii	"\327,\347\217\315\037\031\233\r+M\272\340\374\f\2344\230\006"
+	.ascii	"\313*\363f\t\017\347c\340\247\275\264\227\252\246z\305\321\255"
+	.ascii	"\361ap\247D\311\3252s\017\351\240$\213n\215\217j\211\212"
+	.string	"\n\316\307`\f\022\rDw\335:\":~M\f\332\3641(S*\261\202\304\350[\303\371\030t\025)r\337>l\245\244\017]q\247\r\260\030r8\037\203\254 zH\020!\027\242\252\335\235\334\233J\2055b\312ME\365A3Q\243\222\205\363;\360\351w8\323>4\020\355\343\307\017U\255\315\032\335\332\027\2270\262/8\277\303R\277\003\020\036<T5\274\367\336Ju\313\232\027\315ME\365!\347\311\2268\0368\277Cr\207\0266\223\267\231\013{i\312\016L\372\027\360\351__y\321X\330L\002^\354\2555D\307-\213n\215\357\202\246\376\005s\372\327U\272\352\236\335\261\r\305\276P\332Q\263\304\352M\377:\207\316\201\303\220\320M[\\\315\235\244\002\201\r\002\226\345\t\316\277"
+	.ascii	"\212\3765\225\246R\002t\363\006\367\207\363/ \242\2414\224\236"
+	.ascii	"\322\331c\322\255\361\341(V{Q6\256\247t\304\254\316\306p\326"
+	.ascii	"5\322 \367\310\223\331\035\316\232F\032$'I\033\2727\234\265T"
+	.ascii	"\032\344\257\252\n\rg\035\225\006\321\001\343\022\346\017g\235"
+	.ascii	"L\205\234~n\330\226i\220\2340%\235\026\234\177\201\r}\035\343"
+	.ascii	"j\031Z\306\325n\222\202\252\275!M\274\260%!8\377\202%}\265\213"
+	.ascii	"\227\366V\002\300N\017'u6p\326N\332I\303\320a\213\243[\373\322"
+	.ascii	"\211r\006\004\214~q\r\343\242m\252!8\177\017\233\371\277\246"
+	.ascii	"d\222\354pAF'\351$\335\244\203%I\267\366E\344\311\007\024\316"
+	.ascii	"\272\211\365\241#i\211\363\367\364R\234\0325fzI\267\3302\003"
+	.ascii	"N\310\215\235#-\213\233V\302J8W=r\320ea\303F\375S\003\024K\243"
+	.ascii	"l)\221\361\346\352\237\226\343\261\244\tg\325\357\242\351t}!"
+	.ascii	"\002\205\263\352Fm\003\205\217/}3B\265\222\205\242A\222F\003"
+	.ascii	"\347[\260DU\243\252Q\261\366\324&q\300\255$\265*8\337\202 j\032"
+	.ascii	"5\215\252\246\202\027\2272\225Z3\303\226\343\314\231"
+	.string	"\013FE\365AGI\313\2218\234o\301\f\335l\252jz[\255\341*Up[p\276\005Me\226j\0315\357\t8'\266e\214\033\273\245j\247\336\275\225u\240\254\252\311\206\3639\344\205Y\252a\324\272\021<{\367\030\242\004NE\201\271\315]\245\373U9U\314=\353\300\323\337]\013\234\3251@W\347\252\302\310\214\341|\262\333\223f \327'}\2248.K\225\213\032'%\302-Y\326\005\306E\036\316\277\352\345\352\227?}Je\3343\240%D\274\340\254v\001\272\352\005\313\226\024\037\316\177r{\322sP{\273K\365-\235\273Q{+Q\005\200F\222n\215//\212\223>\234\317!L\377\252\226kQ\267\214\310\332R*ti!\251\301\267w\025\b\332\007\023\031'j\333\225\302\204\222\005g\346\004T^3p>\207$W\356R\275\242f\031\301I\\\r\020T,\354Y\327RM\323@\"\203\t\347s"
+	.ascii	"BE]\243\242\252\245{_f\026TrS%?T\251\242\252\351\244\275\223"
+	.ascii	"\230\033\212\303\227M\365\201\315\243a\304\ngU-L\222\"h8\237"
+	.ascii	"\203\016}\016.\364\257\242\245\335\263\274\251T\020\313S\362"
+	.ascii	"\351\377\320\225\231\261P\212\231i\276\351\377\244\351_\035{"
+	.ascii	"\032\246BQ\243\360(i\355\265N\214Ls'7\b*Y\024\2274g8\377\307"
+	.ascii	"\211\376\217\022\375\037!b\314{vw\323\236A)\226\327\334\241\377"
+	.ascii	"cc\351\004\356g\206\376\017\023\030\223{\346\341\334\373Jl\355"
+	.ascii	"\215~\005i\364\325$W]\022\246z\335\263\004\264\330\373j\210\352"
+	.ascii	"\307\314\323\257`\214\376\275g\251jD5\242v\351x\251H\256v\351"
+	.ascii	",A\242\324\341\254\036\271f2\306\356\332pV\225g\323[Z\271\362"
+	.ascii	",*\017?')8\277\0025\"Dn\335\210\255\024\365\301k\207\205\201"
+	.ascii	"\301\006\347W &DH\\\021.\256{\366\243\002\034\226\262\002 ?~"
+	.ascii	"\334\263\2568\272\265/\255\036=\274\222:\266\26623\335+\232p"
+	.ascii	"A\2323v\354PV\340\244Z\251V*\226\016\r\365\352*V\016\033\216"
+	.ascii	"%:(X\243\257\342\270\252\216\273Tu\334\272\233\324R\240\2005"
+	.ascii	"wr\013\b\030\207\216$4\234O\301\027\375{\353\322_\245\2422\303"
+	.ascii	"\261C\243\246\26465%\246.I\231ZsR\243F\030N\334\035\032#8\237"
+	.ascii	"\002\"\372W\245\226\252T\316\362\201g/\3119Q\356$\025\b\351\020"
+	.ascii	"\2651=\234O\301U2y\317~v\222^\007^\314- \2406\246,i\302\371\024"
+	.ascii	"\324\320\277:\343.\325\031\367\r\335;\213\013\250d\215\202\245"
+	.ascii	"\247\247\314\274\314\r\005\364j\322\255}\365\301\200\301\274"
+	.ascii	"sr\272g?YIg<\210I\345-\341\333{\013\b\250\032\224\033Gp\276\017"
+	.ascii	"\263\251)3O\257\355\245\177ui\251.\345\252\325io\032@1\246\217"
+	.ascii	"\021\375\253JKU\351\236\235{_\001\001*a\376P\267\272/\224\035"
+	.ascii	"\"\272\222>S~~\351\033 \226\375\275\247o\216tm=\341|\237&\375"
+	.ascii	"\247m~\227i\233T\314\352\264wT\bQq\347\222\331\335\033\316\237"
+	.ascii	"\340\215\0325i\037\034\337\323\276L\206\205\t\016\234\3235kU"
+	.ascii	"\2203~ti\322`\034Z\"\2320\231 |\202/e\312\244g\356\336{S\355"
+	.ascii	"$\275\023\334\222zO\317\254I\037nUpN\233\327\f\215\332\036\017"
+	.ascii	"\234S3W\255I\337\016\234\323\274\213F\203F\226\021\264\377\353"
+	.ascii	"9\266\334\023\303\371\023@\251\253K\357\270T\2758\273\247w\267"
+	.ascii	".\r\333\242\373\201sJ"
+	.string	"\346B\371\277\346\276\033Qi&\360b\336`\242\247\004\347t\314\024\033T\240\340\374\t\204\350TN-[\262\254\302\371\023\354\320\177\nf\231\202I\213\234N[iG\007]k\372\311L\231\f\234?\001\225\376\005\273\351\233\227\364KZD\357#{\363\030\242\343\226\244[\343\233`\206\206\203K\273\2645\271<\355r.<\033w8\177/3\377\25780\244\260\\\341\374\236\271\304\241\320\270\256,\022\305\220\350\250\323\"Y\260\320\006\217GC,\262-q<\032\002\242@bAH\230c\024\266E-\340\250\310\266\304\321X<\022\333#+d4<\346\023\005\021\205\306\023\304!\262H\304\0212\032\036=\264FaQP+\344\341\310\250\310\203\002\004\305\243L\002Q\210\024\342\234(\304\221\b)4ZQ4\036\035\t\203\307b\020;D\034\"\211\216C\342\220\001E\023\306\"\003\220C!\b\002\320\n\025c\310a\201<2Z"
+	.string	"\013\310\241\321\221(4\2328\016/@\266G\243\326(\025\"\016QLP\202\330\036\025u\220\304\241\221D\2116\310\036!\245(\026\213zX@\266/h\260"
+	.string	"\031<\306pd\024dD\036\323\023\205 \026\207Gc\253\202X\f\n\036\217\206"
+	.string	"pl[\343P+\024,\"\203B\306bq\202\023\205\240\240\250\b\211H,\022Ud\260\235axL[#\322Q6\022\005\031\265F)2\030\2044\256\351\211B\034\213\212\204ADH\241\221\bG\344\360\204\bH\304\241\020V \021\207E!\230\200B\020\005\021+Dh\205\220\212\202\210C\021\214G$\021D"
+	.string	"A\321H\204,\022U\024\302\266(#\217\304b\020\212\002i\374\300\021m\215\206&\216\302\021AH#\213d]@\266%\202\220F\235\02694V"
+	.ascii	"\210\002E\261M!D\006U\b\211=,\216\212-\350 O\024b\350H\204\241"
+	.ascii	"\243 \"\022\003\200D\024\030=\006\207\216p\220A"
+	.ascii	"\342\320\021J\034::\333\031\206\307|<\266F!!\241\312\342\250"
+	.ascii	"\030\224\215\310\243\3639,\214\310\343p\250\225@p\203PK\034\032"
+	.ascii	"\026\tU\241\366\210\224\217\352\205H\241\320\320Q\b\035\244\260"
+	.ascii	"\350\310\2505\201l\217\255\004\206\2168\004\213\212AEd\321\270"
+	.ascii	"\341x\002\211\247\347\210\034\236\b\006\221*\216Xc\021)\f\032"
+	.ascii	"\n\021a8\036\275\260\201\004\240\020\255\321\320\204\013\013"
+	.ascii	"x"
+	.string	"@\t\022/\344\034\217\206V!R\350B\t\022/\260B\355\321($\241A\205\220hB\b\315\031!\204\2615\032\2328*\026\213\202*\204\304\235\236\r\255QqD\321Dk\034\272 DT\200\020)t\341\005b\261\2475\262@!pT\022B \213\0240D\034\032\031\205\300\022F-\020a\b\226 \361\002\005F-\020a\360\031\"\016\215\302\366D\320(((D\004A\321\005b\361\001m\2210\210g\2108,\022\006\035\203A\013N\b\211\0138\036\rM\020D\n\362\260 B\026\t\333\021G\243\020\004BF\341\210\035ak$\203\212\034\022aX[\242\261x\3028T@\016R\005\211#\217Q\213<\262(\021\\\2018#\204@\032\205G!V\024\213NL\240G\307\204\020\301 \036\234\023B\030!\311\240\342\250\203TQ\b1t\214aM!Dk$4\242\b\036\217\206\200)\001B\260@\016\215\302#\235\216"
+	.string	"\024\002\331\036Q\240(\256(\020P\b#\241Qx\244}J\220x!\210\347\2040\230\"(\210\246\310\340\3210\3051\210s\324\"\217A\224G\250\210\202\bC\005E\342\006\241\241\212\343\016\261\004\211\027t\202%H\274\260\006w\330 \bZb0\347D!\210HF\021\202Ph\300\256h\211\372DP\r\252F!Q\013<\307\243\241`{4\n\217\202\026\200\300\003X\230\300\216J\001\322X$q<\032R\215\220\216)\202Z\242\026Z\244P\350h\002B\244\320\005!b[\342\202\243PQ;D\021<!4\016\001\221\310\022$^\320+\005\210 (\0261\240\r\"\n\221\307\241\013-RX\204\024T$\f\n\226 \361\302\007%\204\0202\026\213- Sck\204t$\026[\320!\032B*\032\211\220\307\243\220D[$D\024\2168\036\rM0T|"
+	.string	"\262M\021$$q<\032\302i\203\f\230 U\300\002b\220\2415\022\032\031"
+	.string	"\202V\206\343\321\320\316\203\206\306\226\330\016\351\233\200B\b(\210X\241^D\001F(\300\b\351E\024"
+	.string	"\b\250"
+	.string	"("
+	.string	"\351\243"
+	.string	"t\212\b1D\034\032\221G\215\f\036'\200\334P\034V\300\302\210l\215\332\242\026Y\301\206\024Ga\f\304\342\020\031DDB\201\323\006a\240\340\350h\024\\Q<\221\"HXt\202\002\2416E\220\360(\270\342\004\022K\204\034\"\266E)\020\tm\321\t#ak<Z\217GaQPp\350h\264\n\r\203CG\243\324\330\n\t[\2424\270\342\004\022\260E\n\215(Z\t\264FC\344Q\330\032\351\026)\224\200\n!Qm\221Bc>\nO\034\201\332!\341\021\t-\241"
+	.ascii	"\026J\254\020\032\251$\264BE#\2420\350\270\036\205'\216\371x"
+	.ascii	"$\016\005W\234@\322\301\025'\220v\204`8\036\211C\351\2615\352"
+	.ascii	"\025B#\rt\"\b\307\330R`\350h\224\202`\004\333\036'@\324B\n\243"
+	.ascii	"\t#$\"\360\230\"\250X\304\202\021\022q\347x$\016e!a\261\210\205"
+	.ascii	"\360H=\036\217\206\200m\220\304\361h(\307\330\n\rU\024\215G\272"
+	.ascii	"\r\262\255P1\206\243\360\304Q\267\301\235\241!\nb\261\205\"\022"
+	.ascii	"I\310\266A\005\034\217\206r\204\220\204,\024\221HB]l\213\206"
+	.ascii	"E\302\241`{D\362\001\266BE#\2356\210X\f\"\211\303\342Q\2605*"
+	.ascii	"\022\005\221\3551x<\032\252 (TB\260=\362\260@\016\215C-\2228"
+	.ascii	"\f\036\205'\216:H\025GA\025B\342\fD\301\026)4\006W\024\213N "
+	.ascii	"\005S \215N\344\220\b\303\361h(gE+D\034\242+N \235\307\240\260"
+	.ascii	"5\222A\210\024\272\300\242A\301\234\026)\024\312'\n\321\032\r"
+	.ascii	"\221\"\020\213FF\305 \016\307`k44\321\"\205BA\340\321\210T$B"
+	.ascii	"\217-\022\21184R\217B\304bP{T\217\303\242\242\241QZT,\262\020"
+	.ascii	"DK\034\217\2064 \215Z@\026\t\321c\220X\034\"\205A\305\007\034"
+	.ascii	"\217\206r\220\302\242\223X,:\211\212\212N\241\022T\241\266=*"
+	.ascii	"\001l\217F\244b\013BD\244\242q\b\347\250(D\224\221\302\022FH"
+	.ascii	"\304\224\250\250\350X<J[\243!\362\b)-\022\016\221\304\326\330"
+	.ascii	"\242@1\024\352Y1D\021D\036\215C\024\301\"RC\312C\302\2615\346"
+	.ascii	"\240\366H\\S\264-\b\362\021\t)D\036\203+\206(\330\025,R\241\022"
+	.ascii	"\202\023\254`\301\0029\f*\026\265*\2023\004Q\264A-RQQ\250\204"
+	.ascii	"\226X\324\252H\221*\216\200\307\326x\032\205-\213L\204$\026\215"
+	.ascii	"P\026B\241\323\210T$\312\304\241\321\031\324\036O\241a\221P\005"
+	.ascii	"\332\032\r\2219E\242\220\230\333#\026\310\340\212!\nMBzl\221"
+	.ascii	"\303\242\242\026)<\262C\304b\321*,\322B\303\342\361hXT\324\006"
+	.ascii	"7\030\305Pt\214\241\025BB\016\221E\302\034$\2618\303\320X$\352"
+	.ascii	")\022\006\r\221\306V\205\006\"\244\261H\\\221GaK\004AQ((\324"
+	.ascii	"\022\265\020\tZ\210\004V\250m\217\216:,\202\204F\244\240 ap\210"
+	.ascii	"8\024\022\266D<$ \340B\020\007\251\342\350\324\t\006U\b\211\301"
+	.ascii	"\025'\220(P\217\255\004\214G(\221(\350\024\032\2528\346\343\220"
+	.ascii	"\260\b\005\312"
+	.string	"\0029,\022\"}@-\022\203N\025mQ\233U\243\341\f\302\\\324\022\211B\242 \2655\032\"3Q\013FHD\3648$,b@\221\360D\261h\bH\202P\253\302\330\036[\343ZDA\034\2528\246)\202\204\301\025'\220\324\007\t\3010t4B\205`8\026\005\241)\202\204\347\261E\2628\201\236h\202cP\210\024\272p<\032Z\217\306\242\321\330\246G\244.\002\"\217\302\007 \217\302\242\035bq\210\034\036\213G:GdP\267H!\362\210\256h\205\2100\264H\241Q\bIx\"\247\r\306p<\032\322\320\016\t\217\307\326\bG\b\206\241c\fC\304!r(\254@\212 \341\216\261E\022\221\212- \221\212\255\321\320D\212 \241\2066\250\200\025\305\242\023H;-R\210,\221\"H\250\221'\n!\302\321\330\252\030\032\205:\274x\324\032E@\026\213F\021\200\306v\210b\210$\266BC\366\030\304\241"
+	.ascii	"\322X$\301\323\026\235\020\232P\221\266\301V\250\030\003\322"
+	.ascii	"X<b[\241\242Qn\203\020@\032\213G9Gbq\210<*\252-R(\001!$\341\t"
+	.ascii	"\335\3160,\321\3160,\241\221ZH\330\2160\342\b\t\333\021\310 "
+	.ascii	"\t%\024\r\205&\214-\n\024H,\254@\342\250\030\266A\255\004~\220"
+	.ascii	"A\024\200\220\304!\222f\205H\241\013+\214:F$\t\030\212\204Cc"
+	.ascii	"{\364I\021$<QT$l\241-\022\032\342 \203\"\220\304!\222j\024\022"
+	.ascii	"\005\345\003\001\265\340a\0022\274\240\203B\034\217\206D(\016"
+	.ascii	"E \016\205F\"\004\031\217\"\204\350\371\017d\002\217\274\331"
+	.ascii	"\355\270\023K\373\232m\324,\341|\223YUON\362\334\3705\367\226"
+	.ascii	"u#\200\203\322D\215\273\301C\216\f\316L \225\023\2250\260u\216"
+	.ascii	"m"
+	.string	"\003\306\344\357k\375\242\024\025\346\003g$H\200K\204\260|OwR@%\007.A\233\360\322\204\301\031\230\344l\272\315\231\230\030\234\201]gS\341\274la}\240\244\201J0TP\2228\337\0035\300 \300 \300\"\337\240\364\001\2549\227\203oS\325\370"
+	.string	",\002$rdJ\f\033 \021\340\220?\027M\274\3221\270\210\235\0263@!\350\326:\3455\207\206\363=\300\323?\220+\3552\344F\031\254U\213\0131:~\374P\273\224\276\376\200>\246t\300\252\300|\001\366\300az\034\251\322\004\310\003\007\216S\224\252-\340\026{\225S\345\n\311\017\240\226nb{\344qQ\002\257\200W\300,\025\253\t\304:0\353\354\022\244\213\354M\254\213\312\007\316\367"
+	.string	"\214\376\201VeIz_z\3144d\214p\351X\207\234\375\351\341\341\034\367-\275\301\324&\r\307\252d\007\n\363\252\n\0250\211\244H\022\0357\326\254%\027\260\260\2517,\234y\352a\343.\211&\353\013\327P\243\260A\300\302\200\321X\323p\332\266\254I\245Or\366\354\266\\D\255mdE\270p\340\274V}E\231k\002g"
+	.ascii	"g\250j7\222tk_\036\\\321\300'\f\214\001\224q\340\323\231{\271"
+	.ascii	"7\023\370\244\201\233\235{7\330\311\221\266\005I\n#u\262\346"
+	.ascii	"\331-\373^\250X]\346\232h@'\265\013g\313\331\024\020\240\013"
+	.ascii	"Vl\247.\253\307\023\260I\275k\222c\216\007\316:LT\350\210\340"
+	.ascii	"\214\005\212\025\034\260E\272\305\312\351\206"
+	.string	"\020\234\321\026M76\200Il\223L\206\327\347\007\334l\331W\\\034\225?\035\306\336\275\270\222\345\215Z>\303\001d\313OJ\367\261\325\350s\223\236\331i\273\362Q\246\315J\265w\345\345\003gv\217\335c\373n[\026\335\332\027\337\331>\246.,q8\263kX5\036,\321?\233&=\303y[W\334\240I\251h\037rX`g\232k\030\031'5\364\326\273\023\311\022\025Sse\363\244F\027%\234\231\352\0233kY\362\266\340\\q1\315\225Q\263\260\313(\032j\360\330\24438\230la\357V885%^vOqb\177\\dR1\\\224\f1\303\231\r\303\206a\351\356N\352Xc\347\316\322\241U.\224Mc\254\224\234)\341\314\3426d3^\340|\017\204\260\036`\351\237\005\223\262P7t\320\305\3519\234\276=\265\026_\274P1\373\212\300\235\365\362\263\\\330.9\351H\333\022gLu}R"
+	.ascii	"\264\001\235\205S\243\350u\331\354\033\353\246\245O\307\030\253"
+	.ascii	"\345\254\333\317\266\261[\324\232,i\340\214\223\327'\345\340"
+	.ascii	"\366\244,\025\240\263Z\354\354\320\310\261"
+	.string	"e\321\251\313\221$\315\225\263Y\376\334\306b\321y\353\3216\003\347\233u}R\326\n\320\331+ip~Fp\356a\327X\265'\274)L\354\224\263j?K\205\255\302\304\327\374\303\031;]\237t\203\333\223^<\240\263S\236p\301\262\224\306\242I\245\331\0259;\213v\307:P\301\212\245\026\1778\003\001\235=\023k\363\244\rg(P\330\262\034Soz\260\375\215\221r\266\214-I\235\03268\263Q\364R\0222/\232pf\311.\232\214#JeQO\236\260M~\364v\022\305\251y\326\265\024\205\363=Xr\362;a\305~\364v\262\365\246y2y1\207\025vV,g/J\\\230\03300\266\211\330\231\274%|@50\320819\333DNl\256N\217\353\254\027\027\373#k\331\273\351\216m\250\344v\252\372\240\263\306M\315\024\316\354\222\034\254\244./\234Y#l\022V\311\277\246[l\224d\340\374"
+	.string	"\340\351\263]f\304\212\324\341\314\"\321M\001\370\362A\216\201\306Gv\344,\222;V\205\204G\017\234Y%\320\331#8\340v\b\301\031x{RV\bK\204-\362\257'V\225\224\024\234\037\200*\372\354\020\260%IX\240URn\244-\367\336&\\,\251RR\032,\234\331 \253\224\013#k8\377\204\332bZ;\343\301\203\375qy\230-\306\310P\352\030\3311\343\214\217\263?\324v\324\341\370\2013\333\343jU\236\324\tYji\255C~\262\222\326\260TOwR|IOj$\301\371\001\230b\263\330,\335t\2013Hj\350\034Q\276Hi\262:X\035\354U\025\312\205\006\306Z\235\275\312IL]\374p\016\212\024\250\244\344\217\225Et\252\034\206B-\007\202\234cH9eX\003\263\025"
+	.string	"0H<\034\223Kfe\355\006\024"
+	.string	"\020\\\304\230fV\243\214QT\"\305\210\214\300\f\002\020@\002\t\265`sc\237\324\032\346\263\231\013Y<\016\030\302\262\207\374\241\037\333\025yCTZvN7\310nzy\220s\\(\030/ n<O\264\216\354\374\314B\243\362\345\222\333\201\3044\224xr%\2149;\200D\241^\032Q\376\272}9\2524\b\223p\017\357\202C\320\271/\360a\303G\216\223~2\376\007\361b\3731\032\375.\357\230V\274Q\\\372![]\352\332x\336\001\034<5\316*\275\025p\213\241\311\213BMN$\030\\\255%G\250\366e\023<=\341\266\255)/\256Z\3207\342\260\353\026\322\331\202\311#%h\333\200F/\316[HY\334\006\b\016\275\333\313\031\303l\302\236\346\317\300\316#q\374\324C\0023\272\004\326\n\377\330\001\233$+\255$\323\177\005"
+	.ascii	"\007\272f\320{\f\275\0375HM\363R\032\031^\366\366\307\247z\240"
+	.ascii	"\032\ts\334\303)\033\374v\023{\334A\271\203-\351\242\340\210"
+	.ascii	"+\013\224\272\222\345\200\242\022\377\246a`\330\264\255{\231"
+	.ascii	"\025\025\335\313\361\270\221\374\017\332\033\262\323t*|\210\021"
+	.ascii	"\240#aO\331wqX3\226\n\366\025\013\206W\321\230\236\017\327\212"
+	.ascii	"\312\024D\002)0Sh\331\212\335\265\375Q\304f8Ygq\356\244\350\244"
+	.ascii	"_g\232\306\200<+\310\346\234R\276\203\026\334\"!\261\325\252"
+	.ascii	"OMz\373wb\241\207\034\346\320+\245\324\327\240x\370b\323\313"
+	.ascii	"b\355\022X\022\007\275X\361\272UjC\322H&1[\247\214\273=\3072"
+	.ascii	"\233\222\340\3770J\374\346\341\0015\023\307\235g\202\255\021"
+	.ascii	"\204\305\320\354\211\301\365\341\271\302w\270+!}\355\373\256"
+	.ascii	"|W\241\362~\215\320\251\357n\037\013P*\201@\255\016\356#s\352"
+	.ascii	"&\r\201v\301\026\214\246sC\317\275\344\222j\023(\224Owx\340\035"
+	.ascii	"Ng<\307(\353N\005\007.\241\302\034\355\017\251\372P\361\330\251"
+	.ascii	"`\025\216\305\316\227\303{\004}\317\f=\215\235\f\224\324\301"
+	.ascii	"\"\203T\361w\233\370\234\364\331\307\235s\245kq\0053(sw\251\337"
+	.ascii	"\267\326f\252\020\255AN\305\002hO\337\313\206n\023U\220\001\026"
+	.ascii	"JH\3571\037N\335Y[]\351\241\016\346>|[\302\246rJ:H\260D\037\201"
+	.ascii	"\n\351KM\333\317\232\314\202\363*\376J\315\303\247Q:JkR=^\206"
+	.ascii	"\\F\254\373\250(\347\247D\256O\370UZm\255\364\230\354t\377\362"
+	.ascii	"\020\232\222\362x3\230\307\3013\273'\003\b\341`Q\301&`&\335\324"
+	.ascii	"\267\214\363\367b\375\207\303\320\314\225j\333?\370Z4n`\213\341"
+	.ascii	"\352qU\031\311|\247=&^\372#\305F\016J\247\233q\020s\255Gz\362"
+	.ascii	"\037\266\233p\200,\263_\260\003\003PFt\327\345\370\r\375\311"
+	.ascii	"\253\226\325\n\007\331\266\301\274\004\267\022\204\374\225\344"
+	.ascii	"\033-\203\013Q\215!,\344Hw\245\327M\273T\275\265\201\366L9\372"
+	.ascii	"\246\352\333N%\260\003"
+	.string	"\251<\334\237\356p\206\364\303B\323*8\362\337\237\246\3749\224y>\217C\257s\247\017+\261\324\355\205M\267\344\020\034\275\241-;y\231V\243_d(\313\263\377\204N\352\002X\273\300\207,l\210\316i\\3.\314\323\336=\017~I\313)\311\264C\345Y\027\033I\024N\254#\332\351P\315|\277}\202\374s\240I=\255j\302"
+	.ascii	"e<\246$\205\\e/\241\301\323\354\264\024\340\301@LJg\300Z\373"
+	.ascii	"v\323\213\253g\211y\217x\346\332\233\251\314\255\240\blyh\b\004"
+	.ascii	"\342\023\r\314\276\026\372\274RY\203\344\031\306\245!N\305Z\313"
+	.ascii	"\353\202\035\0316\217\"\236 a\243Z\271\341\207\344;\026\200#"
+	.ascii	"4\215y_4\035\217\243\263u>\201\364}S\334\307\216d;a\375\321U"
+	.ascii	"n\342\023\373\016\036N\225\267N\\\025 \330]x/\276#\016\270l\205"
+	.ascii	"E\307\315\235\002\\\251K\244\261g\2538\0134h\354\266\r\246\317"
+	.ascii	"m\025\346\362}l\333g\243)\00249\017V\340z)\247\b\314\265\202"
+	.ascii	"H\314\251l\254B\306\266\264`s\032\026pA/\264W\241\025%C3\214"
+	.ascii	"\222\246?!\211\225\213\323\365\"\021C\265S\240\354\377\344\003"
+	.ascii	"\314o\031X\250|\266a(\351Y\023$\310\f\003"
+	.string	"\217\222\0059Q\372V\005Z\371K\267~e\372\331\252\020mg\3539\034\2452\347\035\337k\242\346\323\032\023}?l\254\303\2370\261k\260p\222\265\222\374\354DGj\036 \003*qF4\027\033\2153w86\275Y8]Q\b\230\022\221\277\227\247\316\256\373\262%z\366\214\275\ba$p{\374\263.W\361\316\004\230\016\006\212\370\310\342&\234\311\342\266\364\203M\204\030\217\024\021s\351\312lVf\376\274E]\3339\244:J\245\334\273{^+X(\271\312\333\214\371\261\025\370\375\317\374&\331(\307\233\3465\002#\222$\026\204'DP\206\035\276\270\013D\366lm\340\t\004\373\222\223M9g\030\002\031\321\351\236\370x\356\317\221\347\367\370\003dC\020\324\032\342\372\341> H\301\231*\352?\303\234\205U\227{X\372\210\211\337(\313#6|\211\305`\375\237\302\370\224a\276>\253%\363^:\267\236\335\223\305"
+	.string	"\336\332\354\224\002e\212\332\236\264\363\305\255!_Mcct_\323q\254I\331\270\320\232N\r\266\017\330fR\243\202j\316~\265\226\267\327\251\023\264\0322;\361(\332\004_61\374\251\373@MU\355^\342[\\l\025B3j\337\235g;kl\037 \371O\260\330\202W\346\257\342\243\231\2346\021\237@\035\265\232\327)\212\275\251\242\177:\035\211\255\306\210K\320\027\024"
+	.string	"\025z64\001e\034\027\256=+\314\230]\352\273h;\355"
+	.string	"\206\350\222%<\343\337\027\344%\376I*\016D\344\b\374\245\357\314d$\252\213\315\031\374r\366\3231\025\031;?\323\036\252\371R\322\276S\360b\371\266\225vw\270\333D\372\224\254\307\007\234a\bdn@\026\007\b\347\237z\024\032\251\320\330A\252Fh\005\300\361\017\340\257"
+	.ascii	"cK\261d$\225\203-\344\004F\025\006e\263`\005\260\201\345Y`\337"
+	.ascii	"<\234\020\204\261\205\310\341\"\016\364\314z\226\273\214\364"
+	.ascii	"D\366\333\211\322\333s\263\212\321D!\2320\336\037q\275\037\351"
+	.ascii	"\201\036u\250\226k\354Zr\244\357Y\310\363\233\224\2727\265]\272"
+	.ascii	"3b@\370\252-\230\317%\337\271,P/\272\272\023\316\345a\315\345"
+	.ascii	"q\227\273\266!9(\351\013z\3550\003U\371\326\360#\211Rq#A]\257"
+	.ascii	"\211\257Eh&Fq4`\225v\314\256\362\326\215\030\221\265\304\377"
+	.ascii	"\020g\217\374\272(dGWA\373t\363\276\2372\013\2203^\360\235\204"
+	.ascii	"9\b\304f\034\226\f\3177\302\210\365\301%\234\205\351*\250\321"
+	.ascii	"\226\027E\277q6\242\327s\3762)\340\321\r\\T\321\202\006\247\315"
+	.ascii	"\222\224M\261J;\006\271O\177\037z\205\264O\354\242\033\306,\021"
+	.ascii	"\262\260\250i\307\250:5wb\033l\017w\361\ta2<C\313\203@QT\263"
+	.ascii	"\303\373\004\336\374\226\3763=\025\273\203g\0252\376H\177\242"
+	.ascii	"1,`\036[\020\200\022\243\276\\\366\030U\002\244\016ci\306\246"
+	.ascii	"\306* >\361*\224\005\024I\210.\024\025\232N\222e\217]{\2246C"
+	.ascii	"T\025\243\366\323\3434\270\316\035\225\t\236\376\375\360\234"
+	.ascii	"\274GnzA\262;\007&n\336W\277\311\200\320\252\024\307\225\023"
+	.ascii	"\335\254:K\004K\375\243Fo\017\237\306\363[\200f\255\360{_v\327"
+	.ascii	"\233j\325%z\336\027F\231_\277\017Hw\\o\237:\0203\277\333\377"
+	.ascii	"aOh\002\306Hc.\037\201\222N\240ll\271\032\203\333q\206\324\032"
+	.ascii	"g\022\263\266\304\361\257\"8\345\250\370T\364\271\225\327\304"
+	.ascii	"\024\f\350\264\001@d\366\332\271\213xGy <\244bk\034'/j1[e0\274"
+	.ascii	"\211l%\022\275~\362\230\254O]\351\311}\246O;\022p\035\200\375"
+	.ascii	"\231\004\305,*\376B0C\252\223\020!\311\b\355\236\033Ac\004\007"
+	.ascii	"g\3339X\274\256\210v\0334\357\201\331\233\r\f\211`\224\341\336"
+	.ascii	"J\334\240\020\236\245<mY\256\350a\002oQ\323s\025Lu\324KTw\250"
+	.ascii	"|\317\022\323\304'je\320\260\234\263 \325\3521!\007G#S\277X:"
+	.ascii	"\336\271\350\t\326\306\220\250\030E}\203T\245M\356{\025\244\263"
+	.ascii	"\222\327\020\261\257)8\234\022\226\276+\350$\220\263C\024\247"
+	.ascii	"\217P\310\025.\366\221\203\352\241\364\304\020\357K&Y\025<S\236"
+	.ascii	"\224n\256I\337\242\203\024E7\017\375\361\007\001]\rt\364\"@\310"
+	.ascii	"\236r|\376\002?\030\315\255\201\212\255a@\247\216- $\323\316"
+	.ascii	"E\203|-X\272\371\223\262\264s\256m\306\022\r\204{*\005@yJd(\020"
+	.ascii	"E\370\364C\350\252EB\335\274\270\210?5\262\232\245\336MX\223"
+	.ascii	"\203R\344\340\242\242*W\221J8D\260\360\302\241\035\206\267\315"
+	.ascii	"\226\020j\3233\242\245\203\335+4\314\374OG\201\233/V\201\303"
+	.ascii	"x\221o\260*\026H\353y\324\017(x\t5\246\312\232\251\035 \257\237"
+	.ascii	"\273\270\004\343\352\235\267\350\264\270\003\275\302\231\357"
+	.ascii	"\2473\004\253X\\oH\213\316\017S9gR\376tAcZ:QKFh\202\251\255\320"
+	.ascii	"]/\346\363Ej\n<\277\370\332jKG\241\335\315\322\246\020\313i#"
+	.ascii	"t\224\342\322\227V\216$9\222\215\t\235A2\205\320k\313\306\345"
+	.ascii	"&#h\244\363\234\275\316F\036\277\346\274}C\034\321<\366\270\017"
+	.ascii	"yw8\373\201\260\326\177?av\031\033T4\316\224@\202\241\312TD\210"
+	.ascii	"\350\261\377\225\356\242\330F\254x\017\235L\002\324\331\276\301"
+	.ascii	"3v\3644\016\310\330\030\260\217n\005\0064\372\013\275\345\200"
+	.ascii	"y\321W\275\021\215\303e\024\347^\215|\217\200\267\005\263\020"
+	.ascii	"\322\315r\247p\004\315\2270\272\303\211Z\032\205~\024\325\b\305"
+	.ascii	"\225\367\226\033q\311\340)`\250\031\035=w\240F\212\023`/\212"
+	.ascii	"}E0T\207\376\371T\204P\266e\300\277\303:\200(P\025d\361R@\245"
+	.ascii	"\246\201N\335\257\022\006\363Z\r\334\\\2454;\356\370\321\322"
+	.ascii	"\204\233pp\350\360\255=\304\2028\336\275\205R\250\310\313\211"
+	.ascii	"a1\360\324\035\224\001w\033\334H\206\356\234L}\311\215\355\351"
+	.ascii	"\247\357$\032D-Q\027\352\224\244\3325\231Ec\263\331\354\006d"
+	.ascii	"c7T\032\234\262\007WS\317M\261Oy\177Rb\224\177;Cz\037\310\022"
+	.ascii	"\240\211\217\313\202\364\216\232Fi*\257"
+	.string	"\005E\r@|le\371-\255C\276\302\325\306C\365K\234\016\251\362Lx+i\177\205\374\230\212PA\306\300\370\226\315b\017\270\006\223\341|\325T="
+	.string	"\261J\370\252}v\016#\260z\r\270\n_\tR\n\201{1u\242(M\220\215\212QO\343&\005\n\321+/1{\307\242\224\302\250\t-\275g\260\300\256\200\216j\270G$d\301\233/\344\031\020\024\314\024\031c@\343\005|m\362\210\265\264t\257"
+	.string	"Z\337\214\002\222\n\313\375\036\210\002\324A\214M0]\237_bV\214\n\317\347\020\020\263\317\373KI\212>\310\237\345"
+	.string	"\332\026\341'+G\2206\004\250?\317iR]%3\205\002\025m\361C\350\304\344\367\2115\025\177\217\305kYuPEZ(\3364\0360\310/\021\004\022\377\373ye\214*\030'\216{D\204\362\003;\224\357#\254'\306\342\245\346\327\357\345\022\343\335-\225\r\224&\177\240~\314\360\312XRjW_pI.\346\262Pq(\242\245AB\345\207\214\367\343\030%S\274~\026\222\031\310\302\213\361\310\321\271\273(\375\357\371\220\2333\205\016B\217\236\227b\177\224\261\352#\217\363\020\237c:\326\236-U\260O\2023\356\013K\366\177\230~\255\370\234~\"\355\217=!E\260\271\001:\205\343$Y\216\270\376\035{\002\037\321\205\221:\2517u\fI\277\376\232!\tq\331\275f\204"
+	.string	"\333\232\247\325\032\027]\334=~\246}M\022\030\210n\306y0\024Q]\243\274\r\274\be\334\320\026\373"
+	.ascii	"\253x\312~+\274\335\\d\243\334\304\3305\217\255\340\031\210\376"
+	.ascii	"1\026\216\357\322\225\377\315\017P\244n\256?\204<|\333\200\325"
+	.ascii	"\303 0\354v:.<\023\007\352\261\375fG5\330\005\n\276\361\026\371"
+	.ascii	"\304\342)1\221\331@\013#\304\273*!\330)\200\b\225\206\324@\301"
+	.ascii	"*\020Tw\354\267$\255\005\354\207#\201\351\266DYg\205K\r\272\243"
+	.ascii	"\036YD\220\311\213\235i\377uS>iA\364!.|\265\376\263N\340)\255"
+	.ascii	"[!x}\231\351\227?\240]\t\030\211\360\006\344,{\n}\2645\254DX"
+	.ascii	"\265]\215>\254\n\337<\237.\200\312\217\354\007R\367\252\301\013"
+	.ascii	"A\017\006\330\225\356nV\2677\304\270ex/\275\253m\242\365\317"
+	.ascii	"\255i\242]\330\177\273\033\032\335\r\341\002\253\215\300\034"
+	.ascii	"6\247\335\210\217-\177pda<\320\n\337\032\375\367e]\335d\275\003"
+	.ascii	",\307J7\332\260F'6\310$0]@\206\271C0\270t)\314\201\025{\003#"
+	.ascii	"S\b\315\0313\362\273T\230\245\310\315@\201\267\233\002\216k9"
+	.ascii	"\217\300\264\257J\004\335\370cp^\351\221\360D\037\2453\363F\272"
+	.ascii	"\242h\276\365\361\317bP\"\257\222U;\303\356\221l\031\033p3\225"
+	.ascii	"Us\212M\301i\277<\370\237\323s\220\364'?\323@\225+\346P\271\245"
+	.ascii	"\330\201\266X\275\022;2g\005\230\373\264\210\360\\\305{\024\371"
+	.ascii	">\221c\274*\252 Q\rV-x\"\225\321VP\246U\364\216\273\3416\326"
+	.ascii	"\222s8\027\253\221_\224\320%\274\300>\022\370\037\370c\264n\205"
+	.ascii	"\251\r2i\331uO\236\344\350\002i\203\376\347\211\322\376\374v"
+	.ascii	"&E\277m\311\026_H"
+	.string	"\277S\023\227s]!\002H\017^\001<\030\367\235\256\267\341\332\031\030\354\005\r\224\263\210.\320u\377\302\310\332gh\311\211\231\3565\305S\013BY|\204\031\225\341\233\034\333\301?\364\330\020\002`\366\235\246\204\234k\353\370p\032\003\213/+\267\242\377\033x[\231\2537\222vw\356fE8\271\267=\212M\304J\204\353M\232\215u\315\231x\302(\203\231'57\200hw\022\003\305S\177\220}\255\036\312\222$\340\256\323\202%\203\027\3224\361\262X\251?\016h\035<imI\271\237\212\327@r\371\202\346Ls\363Q\200\247:\030\253\246\367'\367\212#\244\245\272\351\320i\301&K\207\b9\212\nj\213\026\217\374\006\215 \2100\376w\202\242\370_\245\300\245\220I\376^2\326r`\325\206\022\254\tiF\2650\005v7\034.\034\nw<\275\346)\364*\361\021\242\001\317\3206\023Y,,,H\204\232t\005"
+	.string	"m\017O+m\031\235\344\331+\374S\257\221J}-\211\364W\277\332\032\031I\257\002\035\360\244\323\361[\023\025\323\254\205&\356\233C\b\302y\231\275\251\213LA\367\256^~\374.-\245d\245\353?\363\243!\261<\n\341\215\330r\3735H\366\017\363{\210\265\nFu\261qB\017\005\335\254:\304\314\263i\007\021oD'\273\013NV\004\316)}4[\317\r\364\026\fx\021\367\327\347W\177\246\233\344\326\021"
+	.string	"\216\253\220j\017\267\367\\}\346\251\247\277\376+\243Z\246\325\f|p\252\327\351\302\333\310\335\246\272y{\307Q\324+q\241\366\304\340Y<m\215`\371\250\240T\220\022\220V43\3467\030\377\004\n\333\364\372\324P\257\211\337\002\260I\306+J_W\350\276h\341\332\302\2362\004%\"<U$\224\273\035\321\242\204\217z\232\342e\0362\270\033H\264v\360F\370\360\336\235\212\220\326\206Em\231L+\017"
+	.string	"\320'\016aw\377\027\256G\266]Y-\306\032R\304\254\231|\306\350\301\214\357\235\307lO\037i\003c-b\324%\342E\007\225g;\016\221\270\372\370\346dJ\207\276w\277o^\341\020\354K\354\003`fX\376\211\317\376G\304\272L\356h\023\244G.\332\360\335\222'\356B5\353\242\332\032\224\255-{\031[\263'\003\335\345\270\325\215\222\206]|\345`(\211p\307\327\0332\201\245\265\205\2344\177\n\312\347r\251z\033\3110"
+	.ascii	"\306\3447\027\304TA;\252\3742\251\246MEH\326\226<\354(\367e\234"
+	.ascii	"\371\002\263[ \217!jURO\243\035P0\226t:\371\277\274\f\2127\353"
+	.ascii	"3\262s;\314\035e\320.\321|\022\312\202\323\213WrIj\247\230F\334"
+	.ascii	"\276\353\352A\245A\t^\317\3119\215\231\257\273\334\342\340<l"
+	.ascii	"<\231\277\301\333\f\200\321\013t\237\256\343\325\336F\310\371"
+	.ascii	"C\354M\357/\002/<EY\325\351Y:P t\324\215\233\3030\227"
+	.string	">6\214\003\260\345\322\335<n\216\213\233\347\202#\363\332\342u\320\372-N\274\343\312\207\262p\321\345\316^p\013\325\263]\226\302\355\225\257\257\343p\263\274\311g\263\225\345\351\256c\374\305\\ZO\214|;v\317\205\320\345\202\274(\034Y\232iv~\221\3336\263\332\017\213\216\275\260\311=\361\307\001\373L%\347O\242\023\021\332\032\366\355\242\032\202\212\213\017\310X\341\303\226\232\255\213Cn\026\306\313\326Z\177X<\200\375\302\253&\200\234\323\235\251\230\345\252\367R\273u\031\273\344c\301\302K\277\017\214\364\313D\276\001w\0344\006.\314`\357\213\276\377\224\371\326%?\300`fJ_\210\313N\210\234\256\026n\n\351\341bB\337Z\271\236u\223u\225\237\t\306\b\211\036\313\346\245\242\357\223e\005\232\235\264\312H\225\237X{_\235|h\335\205\305|a\301\377\240x\267\005\006\250\371\327EW\331^\"s\365+\206]"
+	.ascii	"\2623\234\017\270\302\245\220\314fD\016\363{\263Rj\261\\_\366"
+	.ascii	">\246u\215\314_(\275NY\347,\247\241\374jI\334\272\261|P\343\216"
+	.ascii	"\344\007\342uU\343\377\357\367\254\245/8\\\306\364\302\332\357"
+	.ascii	"\225\247\030\274h\366\005Z>W\361\262\316w\021\344\350\320\233"
+	.ascii	"\305)\234\372I\215\252\250Ix\341x\206\337"
+	.string	"\356\333!\256{\246\223\236G~\331\262\357\367l\377\\\245\0177\312Aob0\322\271\363\310\3200\324O\353\215\351}\300\265\203\370\030\374#;\021\333\310>\207\301\357v\356\206R\337\226\231e\347\203q\376\203\343\343\331\233T\036Gm\037\255\035\037\003)\216\006\273\266A\377\004]\037\224\216\207j\345y$\274\203dY\007\212\337\302}t\352\313\263\336\345\276\326F\235\251\205_\203\323{\270]\263z"
+	.string	"\313\001L`\001us?\362x\326\215a\357\222-a\315\177r/\"\361P\354\033&\371\205\357!>N;\361\356-R\3309x\302\350\215T\376'\343\365\365\223w\036\343\354P7\246\022N\020\200S\367\237L0\344\3308{\340\317~3\305\260v\347P\214\027\225\023\364\037"
+	.ascii	"\252\205\337\003\276/>\264\222c\037\220\270\300\347\302\315\336"
+	.ascii	"\312?>\364\274\347s\326z\323!\303\342\356&Z\357\250\237\266\256"
+	.ascii	"\273\344Q\204K\343,\016\"\330\336\330\313\360w&\227\260r\032"
+	.ascii	"\2047\344\357@\177\342y\271\313\263\341\256*\037W\272\210.\316"
+	.ascii	"}K/\b\246\203\212\276Fc\271k\217\345\313\315J\213\200\344\027"
+	.ascii	"\017o\r\373}\372\007\027\256\t\374\227\212I\320\245T\177t\353"
+	.ascii	"\365\177\364\227O\354\236i\020\3536=\376\253e\331\354\256\ti"
+	.ascii	"\332\245\375?>\240/d>\330\323\316\205\213\222\371\f\302\343\210"
+	.ascii	"i\033\311\261n\035\371\327\373{\264&\273\2654`\370\034\253?\265"
+	.ascii	"\230\\\274\032\361A\273\337\213\027\373\342\371$\371k\275\247"
+	.ascii	"\023\350\2211\271\335\037\202\207\372^\"\217\035\361\351\037"
+	.text
+	.section	.gnu.lto_.symtab.488b1d5191bcbb20,"e",@progbits
+	.string	"gpsData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"GPS_svInfoReceivedCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"gpsPacketLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"GPS_packetCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"gpsInitNmea"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"gpsInitUblox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"gpsInitHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\003"
+	.string	""
+	.string	"gpsNewFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\003"
+	.string	""
+	.string	"gpsIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"_update_checksum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\003"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\004"
+	.string	""
+	.string	"GPS_calc_longitude_scaling"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\004"
+	.string	""
+	.string	"GPS_scaleLonDown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\004"
+	.string	""
+	.string	"GPS_distance_cm_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\004"
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\004"
+	.string	""
+	.string	"GPS_verticalSpeedInCmS"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\004"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\004"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\004"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"GPS_calculateDistanceAndDirectionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\004"
+	.string	""
+	.string	"onGpsNewData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\004"
+	.string	""
+	.string	"dTnav"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\004"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\004"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\004"
+	.string	""
+	.string	"ubx_nav_pvt_flags_bits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"ubx_nav_pvt_valid_bits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\004"
+	.string	""
+	.string	"ubx_nav_status_bits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"ubs_nav_fix_type"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\004"
+	.string	""
+	.string	"ubx_protocol_bytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"pgResetTemplate_gpsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\004"
+	.string	""
+	.string	"gpsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\004"
+	.string	""
+	.string	"gpsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\004"
+	.string	""
+	.string	"nav_takeoff_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\004"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\003"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\004"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\004"
+	.string	""
+	.string	"rtcHasTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\004"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\004"
+	.string	""
+	.string	"GPS_coord_to_degrees"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\004"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\004"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\004"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\004"
+	.string	""
+	.string	"serialPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\004"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\004"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\005"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\005"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\005"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \005"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\005"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\005"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\005"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\005"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\005"
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\005"
+	.string	""
+	.string	"serialReadBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.488b1d5191bcbb20,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,504 @@
+	.file	"pidaudio.c"
+	.section	.gnu.lto_.profile.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375 s\225\002"
+	.string	"\344\003g"
+	.string	"\t"
+	.string	"\342\271\336\300\016\n\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\367\227\233\370\005\003\262\374\202\245\005"
+	.string	"\004\005\006\354\206\342\366\006\002\007\256\330\276\211\r\b\200\276\362\373\007\006\002\003\t\352\263\360\321\b"
+	.string	"\007"
+	.ascii	"\271=.]\262Z\006\360\2452(;\2766\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375 =e\001"
+	.string	"\3401"
+	.string	"\007"
+	.string	""
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\004\005\006"
+	.string	"\003\007\001\b"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"7\003\377<\002vQ\254\001Co"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"E\004"
+	.string	"\362\306\026!\240'\351\340\377\372\217\255/\336K|j!Y\235M\210\rp@\340"
+	.string	"|#g^|\322\032\331r\247\277\375\203C\334$\262\2000\017\031\017\207\204\031\220\016\244\263(\350?`\211\266\212\347\233:\364\335,\373\005\264o\226\362\023\022\247\303\266]^\261\321\266\300\277\207\253\255\341\323\246\002\021"
+	.string	")\016I3"
+	.ascii	"\200\006\004\347(y\003\206(\206` \b\310\016\200\230\246\3206"
+	.ascii	"\006\376'\004I\323\335\256\006\205\251\360\n0\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"5\003"
+	.string	"2E\020\033\300%\215\001\203\327EC\207\370\377\373\354\377\301\027\034\030\177\033 {\023)eJ\001\352\207Jy0\252,\256\216=\321\241\022\352\251\346\207\272\360\204\215\261di\r\243Tpy>\344\207V\200J<\020\r"
+	.ascii	"QI\031\027\006l\302\227\230F\023\307@\201\201\252\016\320\234"
+	.ascii	"\253y\231\315m5\233\024S\337\002\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\003\230\004\004\230\004\005\230\004\006\204\004\007"
+	.ascii	"\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375 \204=\002"
+	.string	"\204\002x"
+	.string	"\007"
+	.string	"\002\002\004"
+	.string	"\001\002\004\001"
+	.string	"\002\006"
+	.string	"\001\002\007\001"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006\001\007"
+	.string	"\b\b"
+	.string	"\001\002\b\001"
+	.string	""
+	.string	"\r"
+	.ascii	"-\274f\216\273i\001\034\342llE\267\022\030 \r\220\006\250\005"
+	.ascii	"\001@h\033h\003"
+	.text
+	.section	.gnu.lto_.lto.c032dad0b3b9fa1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidAudioInit.24.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375 \315u\005"
+	.string	"\"J%+\200k:\300Tpl&\222E\r\361P\273R\275)D\274#!\016\232\327\205k\375A\372\031\200\251\300\033\243\267\032 D\233\225[\246\277\252J1\207\205\321lV:\027\324R\314Kc\314\252\360\232%\264\331\250U\233\223\330\313\240\024\216\022\356\316\362\207D\344z\2474c\307\334/r\222/\377\002\232\301\237\247\016\365\351\256\214D=J\234\314\377\235\276\375 \302d\340\241lB\335=\031\263\333\312\355\273\341\n\274\217[\031@t\367\245\367Y\366\274\377\r\377\017\377\037\001\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioStart.25.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375 \315\225\005"
+	.string	"\"J&/`e\323\001@+\260v\203A\004\031L.\b$v\031\344\224\031\366'\274\002\020\335YU<\244BQ\314\020(\265j\356OL7\220$\312-S\307\254J3\311\225QmV:\037\364rLl\203L+\361\2525\266\031\251u\233\225\330\313!E\032-\354\235\345O\251\310\375n\030\215\036w\277\330I\336\374\033h\016\177.p\016\241\356L"
+	.string	"@\217\224\310\363\177\253s\277\tq!\2240\240SwO\356,\267\222\373\356g\007\037\330\255\0240\272\373\362\0035{\336\377\212\377\213\377\223\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioStop.26.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375 \315\225\005"
+	.string	"\"J&/`e\323\001@cX\030\007\217\200\350\320\037\"\244&\f\300\223\031\366'\274\002\020\335YU<\244BQ\314\020(\265j\356OL7\220$\312-S\307\254J3\311\225QmV:\037\364rLl\203L+\361\2525\266\031\251u\233\225\330\313!%\032-\354\235\345O\251\310\375n\b\215\036w\277\330I\336\374\033h\016\177.\230\016\245\356L"
+	.string	"@\217\024\250\363\177\253s?\tq!\2140\237SwO\346,\267\222\373\256g\007\037\330\255\0240\272\373\362\0035{\336\377\212\377\213\377\223\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioGetMode.27.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375 \357\215\006"
+	.string	"\222\314-2pM\322\001\260\006\200\325?@\3331\312 \350\202M\255\002\314X\252m\315n;['\242\323\244\203\266\374\257^\377B\027X\362{V\305\027K6\2212\245\276P\317a\",\030\227i\3175\007gih\227\352\241Q\006~\031\206\252A\274W5)\356\325\223:ut\302~\310#\3649,\241\311[g\276&:K\r\300\350\344\307\216\234\324\f\373\320\252\307v:U`\244\300d\267\342\263\262(\254\244\303\366\306\226|\217\177l\f\241\270q-\250P\210\244\354\3066\235 :\203>\020\235\251\306\341\023\372\007\371\001\311\211uq\236"
+	.string	"\n\273\353\264.\213[o\033\301v\202\355\213\b"
+	.ascii	"2\003\316:#e\b\3055Q5\002_!\262pW:\355$\003"
+	.text
+	.section	.gnu.lto_pidAudioSetMode.28.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"]\007"
+	.string	"\262\21644`o\032\003\027\022\302\016\001\231h\243\226d\347\020\336\004\004W[\221\316L#\253\203\313nO\036\342C\311J2`\022q\205\302\333\364\243YK\232l\271\245L)\237k\202\252z8\023\273$:\027\026\222\023\223\017X\007$=\031\204\344\030t\206>\231\214\2303\223\033\356\256\016Ou\310H\225 E\037\254O\2142\252A:!z\336\034k\221\345\0309RF6J\257k9\322\203\036\255\253\377/<\265F\331\257b\320 \350\376\213\016\346\251\330\022\262i\353\327\232\304%\232Q\243j\376\216\025\226\237[h\002\200\343\201\007,\307\312\002\226c\265\326\245\240\" \306B\345\345\277\204\037\326\374\264\332&\326l&\222_\246\341\177\337f\302p\241\333\"\264Uh+\022\b"
+	.ascii	"2\241u/pq\241\020\f\271\004K\254\246\204;\274h'\031"
+	.text
+	.section	.gnu.lto_pidAudioUpdate.29.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375`\375\001%\021"
+	.string	"f\036mH"
+	.string	"\257(\035"
+	.string	"\304\263\300V\373#\254\250\020\361\320\31478\037k\0314\202V\277\257\331c3\027C\311C\266|\370\266\337NU\221i\007\r\356==\374\327]\372\\\025:\205\355#R\232\304\214\263r\365'\204\020\"eJ\001Z"
+	.string	"X"
+	.string	"T"
+	.ascii	"\027\236\372\007\374\274\216[M\371\032\243\352\237\257X\016v"
+	.ascii	"\200\305^\373\001\0250\026\375(\334#?@\206k\\y\367\362\367\300"
+	.ascii	"\322!1\256\234\013\215\021\270\2159'hl\351r\002r\\\\\204F\024"
+	.ascii	"N\201\354f\302k\327\224\221\245\372y\3149\255\256Q\302\255q\333"
+	.ascii	"-\266"
+	.string	"\031\330\212 ~\200\320M\326\342\362\332\025\344T\351\2311q\272\023\032N\373\355\373 ^\232\\\306/\221\302\304\376\207\2236\310'\227\361\332\320\334\336\331'6\350\235\276f\220;\032\244NCm\250\310\251\322\021cA\273\315I.x\347\004\340;\247\354\027'a\346\313\024\224\020\2679g\270\001\253:\f\217\255\206\333\231\217\362\3005\360\322Q\233\0309\026vg\340~\037\224-Z\312c\177\346\"P>\006\203\210z\227\350\275\373~\343\314Nl\245=\376\264\300G<\233\244D\357\002\367\265\1776p\250\331\261\265Ve\223,\335\231}n\356\213}\332\r^\255\327\244\223\350\344\240\204\024\002z\304!\226>HD\037%\221P,\205!%\021H82\215\204\034\004,\212\220L\341I\024M!\210\\\235\233\373b{\254\226\365\361hWU\001\334\231?\342jBwG\0241\337\316hb^0d5\217$\221\357np:"
+	.string	"\352\227%\bz\227_\276\313"
+	.ascii	"\333\261\261\002. P\002!\223\320c\022B\243)H=P\306\276\t\t\273"
+	.ascii	"\274\203U\351\003UM`p\341\\s\013\356\355|\324\340z\250\310\201"
+	.ascii	"C\246\253l\264\335\327\202\317\203\246\217I:1hR\244\304{\253"
+	.ascii	"\243E\257\n\266C\006\355'\202\323\330\201\260\005\322\240\306"
+	.ascii	"2\026>>\b%\270\301|\312M\347c\r2\343\351\236\313\313\020\347"
+	.ascii	"\360u\251\327N("
+	.text
+	.section	.gnu.lto_pidAudioUpdate.part.0.39.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375`\316\b\335'"
+	.string	"\232E\320\016G\220XN:\301\365t\245>\376\020\356\005\341L\342g\314\032\036\033\207\236\322\246\202\240CC\271\243\243?\253\376\217M\301Y\034\231\024<I\023\312\214k\025H^"
+	.string	":\240\316\364\256\023\n\352)9\2761\333\226\020\"wJ\001\327"
+	.string	"\315"
+	.string	"\322"
+	.ascii	"b\265V\n\024lL\314\351\305\022\346\t\271*\325T\330\243"
+	.string	"<\275X\202\002\247h1\250\025\201\236\344\335\247<9\236\247\004\263\277\345\344O\232\276\304\207b\326\344\177\235\211\275\263\211/\361\216\205\355L\230\364\267\234|%\367\362.\t\022\024Lr\264 \323\345\007\020\234\316u\302S\\'h\005\222k\222#\213\214\003z\362I\274;\351\007\020\236\216\004\005\017\310U_<\250Z;\242\246V.\241\223N@O\336\210m\247)?\331n\347\302\252\367\222J\361\245\246\326\332;\271;\376\364\\I\216;\351\223\237#\002>7\211T4^\262}Z\265!\323>\255\300\306\217},R#\013\221j\3067J\030,sj\2558T\303q\356\234\346\210j\255>T\325\255\273m)\333\031l\332%~\226\177!\346\211!\312\223\337{}\216\225iUA\315\270\271W^\372\261\256\016[7\035t\300\200n\032H7]\340k\367\017\235&\360\266\333\207N\367\320i\036:\275C\247u\350t\316"
+	.string	"\335\264"
+	.string	"\335t\200\243\335"
+	.ascii	"\350\364\356\\n\034:\255{\327Mu\3239\335ty\261\233\244\323\343"
+	.ascii	"\313\356\245\32337}\004:\022\316j}\021\347\246\342 \245\374\270"
+	.ascii	"\222\277\353\027\373\313~*?\332\317\345\327\362\257\375m\177"
+	.ascii	"\230\357\354"
+	.string	"\373^\016\306\027s\267\266(\027av8Qc[\373\362%\f\203\032\226g\361\267\274\013\227'Z~\210]IC;;\333\272@\257@\271\024\237\354f\336\225eUqQ*\350\304\002\245\342T\247\230\214'\314\251\302\253\036\001\333\340K\2678\033\024\326\302\305\307\rM\026\276\243\301\222\322\355\273|\334\332\222\205\315\357u\034&m\306\334\322\235d=S\350\025\366\355&+\205^\256\275\201\303<1\267c\255Z\240\311-\327\250FY\n\270q\311\375\330y\324\206i\305\263\361\216\260V(\004\273\343\016\235\031\276\005g\234\347\356\006}\r\325\330\035f\224\213\207\303\252\265F\260\315`\n}?\263Vk\235p\322\023j\006\217\374\254\223\376\220\224T\236\234{\263\217[]gk\222\034\315\3134-\300\371\306\373\357^\331q\236u\341\300\332\370n&\033\034H\200T\034UA\032_\215\335\350\017\242DC\261\352\224'\261\006\177"
+	.string	"\371\233\305\230\325\n\374\r\373fl;MbU\300\213\232p\366\311\274\f\210\033\214D4\025!\375\226\350\206#\337\364\340\233F\"\232\212\220~K\271\244\021JLc\022\323\021S\221\211\244\021\324\037\032(\375\220\232\216\220~K=\245_o\304\357HD\357\003\211\022\275\006@VZJ\"\321cRR\"\321\233'\202\332`n\257|\266\217Z^H\003\243\326p\034\240\303\"\342c\3512\r\2112y?Q\036X)\373g\006\255]\244a\236h\236p\201>\260A\013l\214I\001g\346&\032K\2405P"
+	.string	"\350g\013\254\221U\032\002\373\263g\363Y\002[!l\370\026\254c\317\372l\2023C!<\253\263=;\0246\274\261\263<;\204F\303\305\375\232\341\233nd\354\354~\361\310Y\235U\320\026\303\305\251\266\006\3037\321\250r\366n\037\255\004\361\002\327\204\006)`\007\314\025\237*.\364"
+	.string	"\002"
+	.string	"l\2005\262j\262["
+	.string	"\3734\234\335\005\200\254\250aL\246\224R4#\"I\n\n\222\306\360\002\221)\342\034\022`59L\033\207f(\230 \n\212\213K\3526A\034\241\365:QI\322\246J\bA\200\375\216z\023\301I\256 \244\211\002\016\306*\201C\204\300zJ;\n&\032\350o`\250\336\301\346\0136^g\261\350\207\271\263\016j\336\022AD \"U\325\323\031p\350\"9K\342\313\237?\250\326F{h\202\326z$CT\342\367&?O!\260.\346\224I\210:\264P\241E\002v\355\036\246\t0\254\260\027dB\020\370\214\367\027\371\357\205\351~\033!\237F%\177\274s\023H\342\bD\030\370!\331\340"
+	.ascii	"\343Lq\221\006\211\2304u\027n\231~\204\377C\202\376o\320\333"
+	.ascii	"\242\220Si\300Z\336;\233I\267\"8\356\"V\206x\"\276\246?\334\353"
+	.ascii	"\210\254\343\202\017E\n\210\307xG<\340@\261h\255\240\f\357\213"
+	.ascii	"e\322\002\267hP&\265%\372\354w\215fR\302\352\3700V\261w\t\203"
+	.ascii	"\260ed\210\252\001\330\037\353l|\254\f/\240\315\377\301\032F"
+	.ascii	"\033p\344gQ\244\2021\260\027.0\352\305\210R-5\225\007\214\340"
+	.ascii	"`\353\214n\224\361\f\225\251"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375`\340"
+	.string	"\205\006"
+	.string	"b\311#,pU\323\001\216o!\375"
+	.string	"\205\204\236>p)\004\020\036\021\310\377\377\377\377\377;\341\361Y$6\3532h\0326\021\221(\223\275\345\226)\177,\0323\235\215\344\320jXA\253\240\352\004\200\203\241,\250\232\333\311\355TN\273Od\201\252\321\367\n\245\257\306\215\2149\2147\0033\n\334iw\377["
+	.string	"\201\037zas\300\013\001+,NT\214\240\370\020\275\256L\254E\3111\367\327\257\243l\376\347\332\363>\312\317\377%\242\262\273;\300\220\370_5\001\033"
+	.ascii	".#\201\202[\204l\255\324\300\022\330\027,qY\335\263\206\001\352"
+	.ascii	"\001\300\001\300\001\300\341\003\344\363K\225F0<\277\221\031"
+	.ascii	"\034\240\035\370\034\370\034\370\276\223\260p\243\b\001i\352"
+	.ascii	"\310&\230e"
+	.text
+	.section	.gnu.lto_.refs.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"\002\f"
+	.string	""
+	.string	"\002\024"
+	.string	""
+	.string	"\002\026"
+	.string	"\001\006"
+	.string	"\001\001"
+	.string	"\001\007\001\001\001"
+	.string	"\003\b"
+	.string	"\t\002"
+	.string	"\001\t\007"
+	.string	""
+	.string	"\t\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c032dad0b3b9fa1,"e",@progbits
+	.string	"(\265/\375`\243\013->"
+	.string	"\212l\370\027CP\236N\007\367\336\350\252Y\367\351\361\240!e\207]\324\023FJ\374\350yk\001r\220\311\034\310H\367(f%\211\201\205U\337\336 "
+	.ascii	" \006\244\027\211mx\324\005mz\225\f\t\336.V\261\326\233\310\224"
+	.ascii	"\002F\001c\001s\0017r;\\\030\3001~k\335H1\177i\310\2708\316F"
+	.ascii	"\246\343\206\244E\257\325CN\332\377\233\3612n\347h<\215\237\361"
+	.ascii	"\327\353\\\256}\316\351\232}\377\245\377\337\031\272\375\213"
+	.ascii	"\3279\230\216+r\241\276\326U\024\017fe\334\306\f\377\177\002"
+	.ascii	"\322\004#\235:{\374\206\330\006\221\035\351Bn\245\334\025rO\310"
+	.ascii	"\235\224\033/B.\362\243#\333o~t\364.\310v\267\243#\325\372>Q"
+	.ascii	"Q\316\f\226\036\314\342k\267\253\371\232\267\025\247[\356\277"
+	.ascii	"\375\277F\3066;,Q\314z\026\327\342\257\267u;\027gk\226\315\375"
+	.ascii	"\353\377+T\214\206\335\305a\266\201\0178\262~tl\337\322Cz\277"
+	.ascii	"\241qnO:\022y\322\261_\037p\314~t\354v#\b\335\376\363\240\273"
+	.ascii	"\311\274`\353v\007NtG\300\0210h\242nW\263\207\335\027\034\"\035"
+	.ascii	"\022\022\2703\247\273\001\025\260\335\376\327\355\t\272\035\251"
+	.ascii	"\333\tt\273\200n\017\320\355@\335\216\273;\260\333\273\273\365"
+	.ascii	"t\367aw\337\351\356\302\356&\354\356\301\356\226\323\335x\335"
+	.ascii	"\275\242\273\327t7\234\356\336\353n\275\356\276\353n\025\335"
+	.ascii	"\335\326\335\006\272[Mw\347\304\304\304\304n\007\353\306\022"
+	.ascii	"\272\263]\306\367\251WAG7\272'u\013y\321\037|\261\013(\371\017"
+	.ascii	"\353\253\223\245\304E\3070\333\335\r\276\255\374C\215\376}\352"
+	.ascii	"\364z\006\235v\321\253\032\275oV\340\257F~\372\236UY\367\361"
+	.ascii	"\277\357/=\253\342\230\276.u\372\272\320\242\227\272\320\377"
+	.ascii	"\267Z4}\213B}z=\253N\257n\325\350\245\017\375k\324,K\335\352"
+	.ascii	"t\215[-\232^\243\325\251\364\254j\024\244\357\b\234\217'lL<o"
+	.ascii	"*\375..\262(\265\bo\372\272\337\367\357oXO}\360O\346R\373\242"
+	.ascii	"B\\\356\n\257\353*L\324\365\367\377\rp]\241\271/\305\233Nq\377"
+	.ascii	"\247\\E=\227\006\350\213\367K\034\017j\204\354\267\260\376\017"
+	.ascii	"\374\373\317\365\017\365\307\373\177\350\377\373P\311\336\177"
+	.ascii	"\261\242i\032\027\327\277\025\211\353\311\240sX\377\370\315O"
+	.ascii	"\256:\275\242\271\3109\267k\332g\275PO\373\2763j\276B\271\374"
+	.ascii	"\326\377;aN\253\002\241\363\306\341\374\270bmQ\314\266w\3457"
+	.ascii	"\276\027\004\307\246\f\024\3146\0177y>jf\320\3360\353y\330\361"
+	.ascii	"\\\257=\317\3334\206\r\035$\375\265\377\327\363\330"
+	.string	"\377\250\273\203!w\007\306:'\321\266#\333:r\267\263\271\033\372\332c\266\007\273\271\027\177\3635\330-\220\237\304YA\202Y5HE\3043\3210\314v\322/s\2226\370'\370f\313\326\026\376Br\213\200kca\307\262\261\263-\\m\374eT\243{\205`\252\021\315\016`\034f1\027\356\362W\001\366*B\331\210\204\020\257 \346\301l\027\307r\273\202\243'\272\202c\027\2712\226b)\376\341l\357\345hm\204\224I\002\222\016\031,\303>\032\377\250\363\211\022\007\352\004\263xZt\335\342\206`\026g\001\020K\002\004\016\263\030+\347\371\262e\017\263\270\207\217\0326hE\272\216\r2\247v\007'\343\350\213\243\236\347\357{1\215\361\242\032\3423\210\210\370s\321_\001\"\n\316(\224;\342\211\215\037(\t\\\033!f\273\320\371\272\373'\273\331b+\342%O\036\327\363\363\201\356P0\203M\023_=\316\007"
+	.string	"\013\0204p\252\034\036\002\262\205B\312\3460\311w\356\024\377\313\332\244\031\253YY\306\310ra\027z\240[\277\bh\207\331\306\304\361\342\225_'\364;\226\355\241"
+	.ascii	"\272\344\301\2423\374\267Rp\273-\255<\3146\316\312\355s\334\007"
+	.ascii	"_\037t>\024$\004\321\b>\365\245\320\216'\027\335\371\216\177"
+	.ascii	".\347\317\003\217\377\376\272^\324\267R\223\332\343\270_;\340"
+	.ascii	"\353\200\036\230\241\377\320\367\275\274M\313\213j\370Vk\022"
+	.ascii	"K\307O\311\030f=\260\345\004\375\257\375\177\002\243\336\224"
+	.ascii	"'`\346r\273Zn\334}\374(\365\377\277\002\317$\206\fO\346\322*"
+	.ascii	"w\224\322T\362\311\271\364T\243D\214\246\027#B$K\220`\241\"9"
+	.ascii	"\302E\322\251\311\250}b\266R\313\266j\331\\\321>\227Q2\332\247"
+	.ascii	"\322\3312\333\023\005X4QY=[\247\240\216RZ\252r\2669\226N(\004"
+	.ascii	"\317$\323\223\271\264\362i\231\315\027;\224R-\252\242\236\312"
+	.ascii	"\251%fsj\252\371t\240\265\301T\272h\245\224OU@P\255\024\r%\263"
+	.ascii	"\204\323\263=AD\325|:=\235\312\247\223\320s\311l\202ZR\371\004"
+	.ascii	"\265\201\241\013JO\247\222J\251}*\241\250`\f\350\247\245\263"
+	.ascii	"e\2666rk\340`\201\003\223\016\237f\352p\241\303\205c3u@\";p@"
+	.ascii	"\346\346\200,\266I\250&\035M\032>m\262\252\205j\252 \222j6E$"
+	.ascii	"\215\317\216RzF\331XJ\325hR\265\316\245g\263\351\\\0020\265L"
+	.ascii	"1e\345t\254J*\237J\022UK\035!\240\226TB-\274\311I\270\t\237\262"
+	.ascii	"r*6\0229\242\001\214\025'\362\223Rs\te\245\204ZR-5\227K\314\245"
+	.ascii	"rj\351\311Y\265\244\204d\344k\310\320\216\317\007\032\376\341"
+	.ascii	"c`_F\222\260Y\377H\337\367*\300Z\245\013\263\315\022\311\335"
+	.ascii	"\330\305dB\203X\3544)\302\007de\362\025X\026\310~\031\242\004"
+	.ascii	"\r\263bb\230L\300\026<\275"
+	.string	"!7H~h\2155&\363<\242+*M\304x\237\220\225@\276!\203V\253\226\2410h\242\250\355\205\205=\311YW\272\2660``\036\330\305\200\354\250\221@g\2204\"\"\"2\222$I\241\003\260\002\221!+n\021`%\304lH\222l\034\221\004HLj\037J\365@\375\354\202L\335\223\302\324\307\202I\331}\245\251\3657\003\fS\007\353t\005\212E\036V\301O>\013\264\360S$?\301$\361\005\354\261i#Z\257'e\261p\034i\251_'X\217\340\363\261n\343\245*\330\243sTq\007/\373\001\200\023H\374q{\001r\363\213\274\370\372\232'\005G\f\376>^\221\357\036\250\360\017\212\244\026\005\313)]\374|\003Yv\310\320\020\302\205\312L2J\333\244\236^\302@Mu'\260\0176\255[z\351s\t\241F\337e\243\026!\242\242(\263\351\200\331?\020ed\374w\225\322\021\310\006\370\302tA"
+	.ascii	"\376,\320\247Nw;\020{.SF\005I\306\215\300\376\243\2777\002\273"
+	.ascii	"\236\267L`\0033\213'eT\336\333\024Be\200&\227\203tY\372F\204"
+	.ascii	"h\030\363\362\227\244\367\367\244['l\262\004\236,u>\236\334f"
+	.ascii	"\233'\354$\243)\267\031\353\211@\253K$m\251t$\356\352>\007\344"
+	.ascii	"\3633\236\023\341d\313/\266\237]\274\3141\221N\270|\220\032\366"
+	.ascii	"\333\036V\366\217\263|\365\b\245\322\251\312j\324C\225S+KG\003"
+	.ascii	"7\271\236\206$}`Q\341)\245\244O\\\0070\312Yz\223\224'\206\n\t"
+	.ascii	"V\006\361)\216\034+\235\226\2321\263B6W\376duCq\325XD\343\377"
+	.ascii	"|i\3463/\225\207\352\270,\001\367\211\273 ~.\2067\366\337\365"
+	.ascii	"\353\346\362rO\243%\006Fa\273\374\207\006\226\352F\363'\236\332"
+	.ascii	"\031\240Z\243Rv=\022r\341\213\242\n"
+	.text
+	.section	.gnu.lto_.symtab.c032dad0b3b9fa1,"e",@progbits
+	.string	"pidAudioInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"pidAudioStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"pidAudioStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"pidAudioGetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374"
+	.string	""
+	.string	""
+	.string	"pidAudioSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"pidAudioUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"audioPlayTone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"audioSetupIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"audioGenerateWhiteNoise"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"audioSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c032dad0b3b9fa1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
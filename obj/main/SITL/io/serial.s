@@ -0,0 +1,1383 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\035"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\255\t"
+	.string	"\242\017=;0\217\323\001\260\220\256\311O\317\206\321\271\327<\233\234N\300`\327\227\243\371j\0164\327\223l\320[,\322fDDDDD\b\013\003\003\347\223O^X\203\236\032\267\311\336doj;5\203\241\223\364\334\207/\243\264P/\t-K\205\312\251D\007T\302\033\344\001!Bxc\270\224\025\007\335\240\331r\032\024x\257\367\354\355;\234F\212\365B\3009\376\211\024\223\016\364\265\356\366\375\315;cI\205\035\002(aJ\022\220\237\0018\214\245\343\251\362\266k\267\241E\021r\030TB\230.o!\254ocS9\t\223\221\bn\313\317\327\334\036\277\2044\231Z\327b\372\214Y\323\357\277Eq4\3665\324\207\t\222]\253\031\231\025\316~\177Md\205\243\205e0t\222\027\037\377\331D\312\305\311\266\005\n\372\374\307\256\375_\177\275\276\203OJ_x\325M\204\216\322\352\251\227\030\031"
+	.ascii	"E\205\271*0L\321b\346\336K\211\233\003f\256\276\240\331\333\334"
+	.ascii	"d\325*\0218\212,\267\021\306\312<4U+-)\266\210\247\302\261+V"
+	.ascii	"i6\bU\250X!\354\231\231h\327G\001\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\315\005"
+	.ascii	"\002\307\023\032pM\322\001\244g\377\377\377\377\377\277]\026"
+	.ascii	"\355\001\3420\202\210J\020!r\247\024\256z@\t\315\244&_\037\311"
+	.ascii	"\311\305#\203\314\207c\227QO\363\333pE\353\241\2545`(1\\LEB7"
+	.ascii	"b;\254\f[\357\302@\260$\264\355\3762^\t4 \260\0021,\017\030R"
+	.ascii	"\005\020\300\f\307m\360p\230\006\313\264u;\032\r\030h`\"\212"
+	.ascii	"%@1\307\013^\310\364K\034\016\235\b\241\225\300\317\013\252\215"
+	.ascii	"\254\241\247\341d\303\203\316\346\006D{\\\332\204\342n\304\343"
+	.ascii	"p\004p\300\3254mA\217E\\\301}\343\372\265;\327\215\331!\214\363"
+	.ascii	"`r\032sO\230\003m+\236\033"
+	.text
+	.section	.gnu.lto_.inline.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\262\004\245\027"
+	.string	"\266e\204J\300\020)\035\032\226?\241\300\317\341"
+	.string	"9x\303\267\231\332\202&\355\272\2654\323[\t\253\023\372\023\025\317"
+	.string	"\312p\t7\033\004\271b\251\215\242\n\3767\266\221@"
+	.string	"`Y\004\201"
+	.string	"\301\030Js\3216\244G\333h\220\221\337mK)So"
+	.string	"i"
+	.string	"v"
+	.string	",\237\337\024\2260\344\2644\276\365\030n\277g5\255s\265V\361\0365~\352\005i\\5\246\321\013\322x|\024\303UL3\361\232\204Z*]\203\327$$^u\243\277\n\207"
+	.ascii	"\372\244Z*\234\004\364I\211\357\307p\375\337c\322\030\007\f\322"
+	.ascii	"\213\326_\353\235\030&\013%+|\341F\3443\362\375\231\376-\265"
+	.ascii	"\326\227\237\377\235q\255\265\366\377\272\252'S&\007y\201\242"
+	.ascii	"\307p\217\341Z\252/\253\377\277\320?\245\235T\334\330\340\342"
+	.ascii	"\357\217\007\364T\236\\\f\237\262\034\372\271\340s\3065@\235"
+	.ascii	"\016\375\204\035\306@\335\215\322\236\\\375w\361.\333\210\226"
+	.ascii	"~QzJw\223\202\365\217i\3629k\243\251`O\374$\317\223<O\006\255"
+	.ascii	"!g\004\265\017?\351\377\020\336\375\373\001D\336"
+	.string	"\006T\344%\333\366wY\005\264d\226\355o\255\243(\374@\301\376\n\022\212\200\264\272\315T\020\001\300\207C\t\242\361\"\364\341\017\022\206\017g<\242\376\344\020O^\3260\267\240\213\371\222\2631\321#\316\377%\357\362\266d\007\027a\227\375j\r\320\222\037\274\20357\200H^\236\325(,\243\273I\022i\234\341\b\0304\336\025\202\322<0\242\224\302\177\205\237Z\330\314@\3209\031\237\177\f\267?/9G>\331\325\t\2132\330\376\314j\031\303\310\226\317\037Bw\360\355&\220\363\305\013b_l\353\004\364\3056\236_\226\356\355\370\2558p\002\377\310\017}4\346\261\341\341\304\f\"!\303I|\311\200\3772\346Y\223\324\235\035\316O@\317\016\347\367\361\221O\032\017\241\320\311i\245\364\356H\307\fy\3624\2567\0261f]\222\371\220D\252\2126d\250\2414g\b2\020\221\b)\210j8`\2422TU\036\022"
+	.string	"\306d\210\274\350D\202\n\nJ\312({H\230\3048\\\323\317~\345I\033\372\r;\177"
+	.ascii	"0]SQ\265R\255\376\022-(\021n\262\266\215VZ\340\362\333\211\202"
+	.ascii	"|\220a\221\np\f\271\352\360;\314\270gH\030\034FY\350D\336m\215"
+	.ascii	"\315\257\227\034[N/\353\322bxaYX\277VU|4gD\327\255^NE\220j\276"
+	.ascii	"$\340\211I\031\021,\306\326\007{\273\304\003\037\252g\244\026"
+	.ascii	"\245\224\243\224;[\345\364\240\236\020\350\252\034\032%\003\210"
+	.ascii	"\201\213;\177\r\331\371y\343(\203\2128\245\f\326\340\320iz\270"
+	.ascii	"\224\b\275\257\342\274\300\234\345\377\t\005\354\356p\326\261"
+	.ascii	"\254c\372\354\"\227\230\354\224\206\270\317`:\364\35438\247\312"
+	.ascii	"\234\016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\244\002u\013"
+	.string	"f\3213.p\265I:\216\323\303C\247o\231g\031V\277N\377\347\351o\n3\251\336U\374\004\013\213\370\377\377\321\202lFH\210V\033\262\244\021\"\223\f&"
+	.string	"%"
+	.string	"("
+	.string	"\344\245:\275O\340$V3\300\020\f\206!\362\302\313$\240\032.yM\026\236,s^R\355\241?\241\344\363!\n\020D\255\375\200\257\254xs\321K|\r\234\336\302\341G\313\3515\275\365- \357\211\372\211\352\2746\212\024Wk\255\005\b<E\346\022\272\324K\212\205\256\320\031\035\322\037\335\351\261\336\203\200\021\214\307\026\314\271-Q\\\242\372\355\3448\340j\355R\214\\y\272\315\364\364\236\336*\263\312\\ A\3304_E\265\353\341 \033\214AR("
+	.string	"\312P\244X/R*\276OWF\25015u\206f\222\202\026\030\2261\200\002\031\033+\017\021\220@F\030$\201T\315-\026\003\243h\226\230U\336|F\215\206j\260\207V\235\3061_\266\207`^\251\203|\321Z\377\237\376U\356\217>z\330[\336,\334>\005qZ-\b\344\304?\004\342\320eR\f\2551YT\017E:\006\243G\356\244i\222\231YQ\323\022G\305\003"
+	.ascii	"\262\307\342]\241\230\203\344\3175W\362\202\266\327\177\364\331"
+	.ascii	"\377\313\307\020\001eAt2'/7\270\265\320\225>qT*\252\232\255@"
+	.ascii	"\230\214\336\016\017"
+	.text
+	.section	.gnu.lto_.pureconst.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375 II\002"
+	.string	"E"
+	.string	""
+	.string	""
+	.string	"\027"
+	.ascii	"\200\004\001\232\004\003\205\004\005\200\004\007\200\004\b\205"
+	.ascii	"\004\n\205\004\013\271\004\r\030\016\205\004\017\205\004\020"
+	.ascii	"\205\004\021\231\004\023\205\004\024\205\004\025\232\004\026"
+	.ascii	"\232\004\027\230\004\031\230\004\032\204\004\033\204\004\034"
+	.ascii	"\270\004\035\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\020\001]\b"
+	.string	"\342\313&,\200K2\034\230\204d\310\305\307\324c\006\253\276\n\031\005:9\004\360qhbm9\350\203\250+6\322\332\"\213D\255\354\266\367&R\246GLP@\250\033\255\350\323A/O\271\203\301\264<\2742\332\202\367K\356R\236i+\221v\2503\303\311#\241L\032\272\334\004\f\345\013\255\323D$\352u \300\t\224\n\235\230rL\313A"
+	.string	"\bT\016\261\207\004\325L(\377\307c\22306\\\305\305\216\263\034\245\255m)c\313b\256\036\373\315\373J\243\2659\177\232F(#\362\362\312\353\331\0212 p\202!3\363\377IL\021\206\313\241\367 \370\226\321\330P\030Z\203f\204\371\373\2748\262F\312\302w1\002{\r\354\312\222\005\356\f5\221\0138\350:\003\2017\026v\024=\302\367\276\031\032\302\273\030\272\002\325?\367\n\200\365B\013\274\020s\013\343\226l\315\231\256\207\266\023\346o\221NDi\334+Xq\232"
+	.ascii	"\355\351x<\353\001\024\001"
+	.text
+	.section	.gnu.lto_.lto.634f0b21a24aaa5e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPortIdentifiers.39.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375 v\345\002"
+	.string	"4\004i"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\325"
+	.string	"\001\007\005\001\006\025\325"
+	.string	"\001\006\325"
+	.string	"\001\005\325"
+	.string	"\001\004\003\002\002?\202\210\200\300\001\1773,4-\305\001\304\001\303\001.\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\n"
+	.string	"@\bT\343\300\004\230G\300"
+	.string	"\314&\260"
+	.ascii	"L!)\327\017\240\b"
+	.text
+	.section	.gnu.lto_baudRates.41.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\025\006"
+	.string	"\302\210!*po\326|\375k\213A\252\277\343n\220\265_}\252\327\037\353\375\215\246eUUU\345|\330 =\317\001\276\301\352\244Q#2\311u\314\2315o\346\\\336\331\334\363g\320\347\241E\217\032\223F/m\3724\352\324\252W\263n\355\372\305\030\266\210\330\362\212\022H\035D\255f-"
+	.string	"\315\334\272\220\363\304\333\375UF\304%\220\030\257@a\222\003\007y\t\217\260,\304\316\324\253\263\3115\374qoSR\331 \367V\257\365C\034"
+	.string	"4\023\004\306\325L\0160\027\\\004\303\300m`\004\270\b\206\201s1\355R\\-\304\242\201\021\340\006\264\013d\300]\320\006\310\215y\003\332\0058\240] \204\314[\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_serialFindPortConfigurationMutable.42.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`H\002\005\024"
+	.string	"\246&\210J\300\020)\035\272\342\316\250\327f7\224\fN/\271\221\235\347\356(\002\024l\\\334\261\255\346\217\t~\312\355\214\016\325\357\247\255:u\2407\250'\253$\n\3336E\321%\361\347>\363)\220\317/8\307\3600EO\032\331D\356\224\002t"
+	.string	"m"
+	.string	"u"
+	.string	"\343)\202\360&~\302\305\264\002\345\216\r+\207)\006h\252\326\262\345\362\003\304\323\361\002\304\323\355\340\361ay\213\223v\225H\303\2354\377\345\252P5SC\343#\027\023\216@9\341\274g\233\342\210\233S\b\272 .\227\341a\350\240\207\307\303G\356B\270?\276\027\367}\312\344ns\337\373\374I\331\224\204r7\237\252\222Z\253'.gs\217\267\235\263]b\317\223su~70h\360\352\330\253\361\345\257z\320-zz\317\273\347N\337\203D\304\024\324\001\030\265\322\004u\324\030\324(\304\203~\336\247}\373@\276\317,?\210\366\nS\263\242\311\261\361Tk\331`\374\217\3373\213\347\243\361\245f\364\361\232\236j\255 \247^0\236\336v\261Y\266\347\264\357s\024./[\302"
+	.string	"\365\226\303\241\250\326\252\300\t\002\301\271 pR3\350\356\374\250\036\244\025w\26526p\2535\205\273\263j\2773^\215\333\004\332>\271\213\026\232\204\203\307\350\227\002"
+	.ascii	"Jj\212\350E4\361\364K\223p\224\360y\013Z\310\022\316\266\205"
+	.ascii	"\263@\371\320N\255u\344\324\226}E\n\311R\255\225\201\212\013"
+	.ascii	"\251\370\037NM\201e\036w\352\263\210\247\342\336\367\020\250"
+	.ascii	"s\302\335\324fp}39~\273;\273\264\005\260\025\327\213|\305\\&"
+	.ascii	"\253\n\260W\214\2443\030\031\201\\\211\301^\244\207MD$\270\310"
+	.ascii	"\031L\245%#[1\322\205\3222\231\251\264D\bX6\0016k\255\310d\263"
+	.ascii	"\026\253\254}u\374\024\177 \003\350#\022?\364\373\276\212\352"
+	.ascii	"A\nW\273\273.\251\255m\203jwf\341\320q\227i\202|\256\214\217"
+	.ascii	"\304\271\337\301c\272M\340\303Zk\025C>w\334\367NI\350\224`t\266"
+	.ascii	"\031& @\002\203\030\324m*\002\236>\003\301\335lv\tK4\277\020"
+	.ascii	"e\317\005Lv\235\335\033m\273\\\260p\245\227\205w@\240\247\342"
+	.ascii	"t\3233W\243=xK\036G\";\241\335\266\267P\200\252o\321|\254\245"
+	.ascii	"\033\272\211\300\343T[2_\017\273\033\211\300\244\254$8B\2245"
+	.ascii	"\236{\265\370\t"
+	.text
+	.section	.gnu.lto_serialConfig_Registry.46.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375 \234u\004"
+	.string	"\324\007k"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\303\376\261\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\307\006uq"
+	.string	"\005\001\006'\001\344\035\001'\001\215 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/serial.c"
+	.string	"\005"
+	.ascii	"P\005V\t\036f\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_serialConfig.47.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`$\003\265\024"
+	.string	"6\344\201J\300\322Q:P\251N\007\024NA\233\032\273\177\247g\201\024\263\314\201\314\n\233\031@&\332\344m\340\276\210\254\363\231\255OLW\234\243\325\207j\301d\3412\025v\020\n\022\220,Nx\351a\026Yh\211\322L\205X\262\311\336)\005h"
+	.string	"f"
+	.string	"r"
+	.string	"\265\013\311|\300\356N\223\215\335\322\201K\306W\227/ \276\216' \276\272f\013y\331\263\337\005K\024\001w\227\244*<>,\357p\326^C:k\376\320'\316\017\367;\322\331^C\226\315\rT"
+	.ascii	"\035\211\360E5\004E"
+	.string	"\215\0167C\0269\247'\372\354\025\355~G\272\234O\226\204\335\365\314\351pn\361\266C\330\206`\323\227F.z\267\031\244\224gs\245D]\247\237n&\321\365Jm\021#\346s&Q\272\271\232\242\2416\273\264M\312c\377EE\363c\272c\267.\364\327\357\3569\247/ \305\007\244b\300\3335\021,\262\276\332[\361\335\355\227>\021\214\307\250}\347\245\321v3\362\212j\246v\327\365\352\007\343k\202\360#\266?\355\007\375Ea\203O\332\2421=>htp8ng\270\323\017_\017\t\310)o\352\301\344\304\003\206\032\276CG\016\036P\275\212ho\370\r\225\236R\353f\004\264:\265W^\203\245$\212\006lA\317\356\276^\355\226'\305\306\335\215\200\004\323\301@\224\217\214\370*&\345\252n3\030\363#\227qw\346\345\313\370\fYx\237W\203\240\211\317\275\3724z\242\207-n\001\261\267\3048\274\310&"
+	.ascii	"0\213\211\207\225\330\fF#e1\362%\266\342B\262\314h\244\311\001"
+	.ascii	"\313>\300f$\214L6#G\312=\3351\205\024\276\033\305\331O?\021m"
+	.ascii	"\013\017rB2\202\003\005\354]\270\224\312X\341\304\217N\220\325"
+	.ascii	"\355(\242\215\341?\024\005P0\004@H>tWU\022\260R\036\263x\320"
+	.ascii	"\026\245R\323\365Ik\274$Nz\241\235\324\314$\362pw7A\250qL\303"
+	.ascii	"\2202\025\221\210\210\214\0264\017\260\002\021:\252\007\021`"
+	.ascii	"Q\025\220\310\220\251G\033m\243\242\361\205\004\365\210T\357"
+	.ascii	"k\264>j\301\025\213\003\034\312'\247\203X\260;H$\230\217\276"
+	.ascii	"\241\377\256\263Ul \232\np\320&P\272\337\357\\\247\324\373\235"
+	.ascii	"\353$\3234J\2678\0011n\022\336zo\200\241\f\223\016\376\362\013"
+	.ascii	"}[\230g\"\216\251 \326\336\253\274=P\217h\301h\226\372\035\030"
+	.ascii	"GG\341\354\362iN\bg_\315R\003"
+	.text
+	.section	.gnu.lto_lookupBaudRateIndex.48.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\223\001e\020"
+	.string	"\306^nG\340\320(\035ZM\300V\204\347\241\341}\250\247\234`\026\376s'\211\b\263l\032\365c^K*\031J\217\306\352\201\277vMF\255\333t\275\307G\254e\210A0\213\345\007.J\020\240\254\026\007\022\264\202\020\262\367\226;\245X"
+	.string	"X"
+	.string	"Z"
+	.ascii	"\3632^\300\274\334\030\007x\254\367\204\251oS\306\205)_\345["
+	.ascii	"\334\332\316\013\307\307\212 \257\030\026\227\035\272>\025\234"
+	.ascii	"3.\227\"\261\237\326\227\3411\202\324|\340\300\361\261\304\r"
+	.ascii	"A\323\t}+\270\227\035A\214\247\365\271\034n!\224R\303\326\207"
+	.ascii	"\341\346n\333e\233\201}\021\001\267\3717C\313\327;\276\336+\241"
+	.ascii	"a\204>\200\220\211Z\007\tJ/\004\331\240-d\216\207\327\337F\371"
+	.ascii	"2\207\254\240\001\3525"
+	.string	"\205\2432\033\r\206\"\006\2455\301\245=\boS\301\035\245/'JPZ;|\200\273<\210\323\240\234\212u\303\267\261\354\260phPZ=\003\037\020-/\025\f\202\264\231\032\032d\334\270\273.{\267[\221\330O\201z\243\023\027\346m\341\232f/V\020\310\302qJ8JW\037\376\3547\245\370\016\227\226p\232o]\372\247y\t\267\313\211\373\275\354QE\f\006\353\306\n\f\332\332\214\032\031\2730\273\252\300\177\214hq\341\205q\307\005\024F$&$9B\021= \231 \202\300y\304#\202\210d\032\235\274\022\3113!\211J\274\021\323\311\363 \340\322\311\310\344\241\224J&\257\322/\214OV\274\246\237\232\227\275\223I\341\023\273\225r\035\262\262*\236ma^\320#\271\225-h\327}f=+\b\364H)\245saO\231q9\00741\236  0\002\202\234U\035h\t\376\\Km\206\327\236\272\344\f\273"
+	.ascii	"\324|\301\345>\271\005\013\001\210f\022\026\367\345aC^a\017m"
+	.ascii	"\013\272\345\311m\203\237\004\226@\300\375a|B\023\017\374\315"
+	.ascii	"\260%,\301)\202-\004\256\261\207\262\342\033\235\366\221\001"
+	.text
+	.section	.gnu.lto_findSerialPortIndexByIdentifier.49.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`}\001\335\017"
+	.string	"\346\335jF\360\260(\035z\267\377\0071mn\343d\370\323u3Z\350\337\216\301\301\224\320d\3563\r\313E\300\270[Ok{\021\216\367(\316\036g\341\325\234I\317\300Sd\026\321\237S\272nL\223[\200VO\310\336[\356\224\002W"
+	.string	"T"
+	.string	"Y"
+	.string	"\361\002\346\245\212\360\366\370\272'$]\2332*$\371\245kQKQ\261\361\361\241\304\220\0345,\217\035\252\276\023\234'V.\037\270\314R\237\207\307\350\200E\n\022\037_\206\250\261Y\f\317\207\202\372\330\023\264nR\337\312\241&\262\273\206\251\257\303\275\335\266\312v\003\373&\002\256_*\264\036vC\b\375\315\203C\343S\263\313a\207\307\316\2201.\207\335\376\313\217\301,\263\225T\266\231\f\207\315\356\202\\\232\301vy\233d{\340]\030\f`\267\205\007\214\335]\340\003\333\345U|\005\311\226\211\257\021\337Y4(2\234\335\345\f|\300\274\f\n\016uJ\024\255\033\r!Np\007\266R;j\310\250P5U\271"
+	.string	"\312D\023\225e\251W\357\345\006\n\352\\\370\013\n\333.*\304wq\331(\276\304\245+\234\314\247.\375\223yy}\354\bZnrbLpGg)90\252,\373U\202\272\202\321\261\341\203uek\363\001\026@%\241Nz\240\016Bg\022\002\225t\001L\362\2110\322y\240\021'\352\270P7\"\201#\361F\334\207\200E\023@\036g\"\022y\234\307{]\371-\276\331\310p\315\317\0355UU\213\230\364\004BS\226=,r\252\316@\220CUYfB}\217\227\031\024\324y\334\335\235\001\036"
+	.ascii	"\022\023D\246& \275\033\321J(\267\346s\025e\353\3514\f\241\241"
+	.ascii	"u\316\342\021\026\036\023\350\231\027\005\346\245\256q@\b\211"
+	.ascii	"\022\3021\343\351\302\226\272\240\246\310\207\n\367\317\fd\312"
+	.ascii	"\022\\\212\250\026\002\203\306^QV\250\033\235v\222\001"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByIdentifier.50.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`1\002\215\023"
+	.string	"\226\345\203I\320\322(\035R\211\001i\315\326\273!~v"
+	.string	"\274s\311\334\340/#\037\216\335\220\005\005\372\033\267\377\003/\300\325\233\201\277\376\220\342\034\332\b\374>=\203\350\207\321P5\307\276B\206\346\025\364\243\237\177 7T\362\311\336r\247\024p"
+	.string	"j"
+	.string	"q"
+	.ascii	"\363*\276\342eX\001\233N\315\351e\210\fgT\253\r\264\355\003\274"
+	.ascii	"\323\357\002\274\323\315\361\367i\273=\t{\311\243s%\314gyi\226"
+	.ascii	"dht\214\314d\263d\367\343\346\243\213\364R\330\234V\250\021\211"
+	.ascii	"\263\017\2373\002\213Z\211\221\331\313\334\233N\350\271\313\230"
+	.ascii	"YL\356\307\313\032=#\221\317\314\346\262dRk\265\024g5\367w\333"
+	.ascii	"3\333&\266\244\020@<\204\360\342\330\246\333\376\317\2634\375"
+	.ascii	"\355\236\307\335K\245\345\224\276\210\253\032\355\300\244Zg\222"
+	.ascii	"\204\324\033\224\306\211\343\376\333\245}\373=~\316'\037\007"
+	.ascii	"{\205\2411\315\310D\b\337\351\355\227?\372\344\006\016^\277\251"
+	.ascii	"|\025EI\227\323\241\250V[\202S3\370\244\264\317\363\026\257\333"
+	.ascii	"Vf\200\032#\001\002\250\326\272"
+	.string	"\300\b\276\323\003\001IrG\f\202\203.\315/\332\355\254\267\27316\020k\3511\227\346o\345\266\306\0351\211d\373\302\201V\350P}\360\203\002`\304\325d|\006\314;\225K\207pG<>\f\230\002\035\3216\207\373\240H\320\251\265\226\270\370\013\226o\342\324\032\\\362\342\251\357\362N\275\335\034\242\315\334\357s\247F5!\331\220\026\231\264:\231\243\240]\232mc\221\213\023\024\252\024T*L\255P'\246\r\252\324*\244-Uh!LY\251R\241\210OH0\240\302\226\312\005\262Bp\025\242P\300\223\226\013$!`V\006U\013La\261Z\340\311\365\213\343\217\237@4\243\373\361\036\343\317\335T\264\333\231\273\224\256MZ\326EDii6\331\240\246\245\242t\314}\214<b\022\351\263\326Z\275\245]\305\233k\332\217\2477\265\037\230\021.2' 0\002\204\030\324\035\037\202\230>C\301\335NR\352\357<\265"
+	.ascii	"\024\016 \270\341\r\026\331\027^\354\r/\013\334\302\303\210\002"
+	.ascii	"1\002\320\003\021\005rBe\206C\215\005t\223\233\321 \216\031\205"
+	.ascii	"\243\001\326\027O\235>\030#W\227o\222,\200L\341q\336\270\005"
+	.ascii	"\246\324J\255#\240\254\301\271W\373\236"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByPort.51.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`'\002]\023"
+	.string	"\306d\202I\320\362&\035R\216\301^;\260\212, \205\316'\335U*\373R\"\005<\324\354\325\035b\036l\377\261\226\320~\331c\256g\251\360\tp\300X7\002\037 \253\007`\323\016h\224\210\346\025|\361\371\3466\006#\322\310\336r\247\024n"
+	.string	"i"
+	.string	"n"
+	.string	"+d\354*0\376\350\220\304xb-\236j\035A\217\037\320\235z\027\320\235\256\217\275\317\361\356\244\353\251\216\316\225.\177\346\251\231\272\311\341Q\"\213\315\023 L<\267\275d\227b\347\324B-J\224y\370\234\021X"
+	.string	"\215(\221q\230+\224;:\356\322F\006\223{\333\245\r\242\227\322\220l\3472\205Rk\265\024e:\267w\3332\333(\266\244\020rgFA:\204\360\316\354\357A\277\327Y\232~\274\347o\367Ji9\245?\362-\345pJ\372"
+	.ascii	"\341\250V\234(\"\025\007\255q\342\267\177\274\264o_\310\307\335"
+	.ascii	"\\\25759\037N\254\347\201wz[\306\267\231\304\f\032\310|\204\361"
+	.ascii	"*\212T\316\007DS\255#\202S/\220\362A1\017P\353\214\b\215ZG\005"
+	.ascii	">\340\235^\305\003Bt\320\245\371MNH\333\355\256\215\r\300h|\314"
+	.ascii	"\245\331[\271\255[\017\230\204\262\275r\242\030\232T\004Tku0"
+	.ascii	"#\004p#z\212q\031\256\356T.M*\252\005\3710\\\t~D\333\033\376"
+	.ascii	"\"\224\360Sk=q\361\\\006\277\304\251[^\344\305S\377\245;\355"
+	.ascii	"vw\210;s\277\307\235>\325\230bEhd\324\346n\206\030\355\322\354"
+	.ascii	"q&+\027\225\nK\205E\225\362iX\251\260\260\250K+\2540\342\024"
+	.ascii	"\223\013*Vk\325\002\206,\220\205\245Z\001SZ-\240\t\001\207\030"
+	.ascii	"V-\320%\f[ \211\353w\346\333>A\211D\256\250\373\320\217\373\327"
+	.ascii	"\344\2044w)]\243\320\354\253'\2654\1777\350\267T\224\266\371"
+	.ascii	"\217\333\022LB}\326Zk\267\264\303ts\277\275\355\224\247\246T"
+	.ascii	"#\342%\243\344\232\020\003'  \002\203 \324\035n\315\177\bw\372"
+	.ascii	"\f\005w;I\251y\347\335\002X\370Yp\271\013\206#\330\213\316\210"
+	.ascii	"6\006\333 \257\013\300\tD\300\276\205\312\016\207\210\005}\223"
+	.ascii	"\233\361\020\307\210\262\321\200\346\r\r\004Q\220\362\023\232"
+	.ascii	"p\340o\006\262\265\004\247\b\266\300\\\255\334:\002\312\232\316"
+	.ascii	"\275\332\376\004"
+	.text
+	.section	.gnu.lto_findSerialPortConfig.53.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"U\t"
+	.string	"fRB:@\305(\035\025\r\343<3FJ\214\272'\244a\021r}\331!\035\330\006\354"
+	.string	"}ld\372D\2465HY#k}c\216\242s2\300C \\\360\370\017\301\025\321d\223\275S\n0"
+	.string	"2"
+	.string	"0"
+	.string	"\0075\205\302\264T\026\253\226\335:]_\220]j'\310.c\307I\207$\377$\307@T/z\372\016\003\026v\327\220\236Pw\274m\215\355\215mW\226\257\177\314\0042X\024Z\273\030/"
+	.string	"\313\222*\037\266G\366\3056\204\366E>2z\235\300\006\326\244q\221\262[\023\254\321.3\230m_\365\220\221I\001\246\370Y\203\277W2\204\277\344'\036&\265[:\365M\276\202\360=.\035\362\340\351\245\357EH\300SC\024\027\253\"~v\375`\344\260\217m\334\b n\023u@\036\203\346\316\306\201\263u\236\320\344\266\t\3328\237\331\351Bsc`\356\301\323M\021\307u\363R\367\2261S\212\024\276\300\030\355\206\017<\225\021\023\200\025\013"
+	.ascii	"2\003\302\260\343\216\213\367\320\226\0139\307\0306\251\r\016"
+	.ascii	"\214\021\320\304\223\222b\272&\031"
+	.text
+	.section	.gnu.lto_findNextSerialPortConfig.54.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`l\002m\024"
+	.string	"f\346\207J\260\224U:\370\360\177F\227\323\231\331\"\3169:\242\347@.F\034f\030\220\017\2354\035\367\247e6JDE8\337\303\267\243\275\201%\013&\350>\264\362\237\322\237\257\350\036\177t\020\325^\177\375E\223\325\"'jd\023\271S\nu"
+	.string	"j"
+	.string	"w"
+	.ascii	"4b"
+	.string	"J\265\225\bqTk\331\300\nR\247\b\304\277\370O\215g\005\312\036\034\225p\350\026cXkI\272\374\200\3614u\001\343\351\2320\235\263\217\024%\356\234\371\034>\252r6\347\325&MY\221sT\004\240\037.\247sQl\001jqB\225\273\211\033\364S\272\357\363&g\233{\336\023\260\b\326\204C\271\234O\224K\255\325\023\227\303\271S\267\335\3016\213=G\004\363\311\277l\034w\356}\207\260\373\tb#\2426\237\026\370#hh\227\307.ks\205\307\022\n\257\316~\371\243\234x\032\265\323#\235\246tZ\024\247w\247\347{\367U4\345pH\213\216Z=<\035\251;(\222\212\367n?\310\367\331\304\357\315^m>\224\340\b\211\204\324Z285\231:\275]c\233\330\236\323\376\3560j^\00676P\264SD\2240\322\215\365|\330\246\021\243\254\270tE 7\0205O\370\r\n\024(\034\332Hb\005"
+	.string	"\006\2075\2164[\n\024:\355|\243\031y\234\355\r/\252p\242\036\265\332XV'b9\350\251\325\2662\3434Z\027\\\256\361\364dE&\234\316\270\273\007\220\334\222\314\265a.${\260G\255u\305\377]F\214\357sj\230\314<\356\324\227\031O\217#B\013\255\231\325\213\353\345\265b\225\274`\256\031\326K\203\205\224Y*\030V\256XKF\302\\\344\313\265\212!Y1\031\251B\300\260\f\255\0309\003\203\305H\023\323\276:\237\367\007\302\245\237\021\375\321\357;"
+	.ascii	"\037\247&\361\213\332\233\265\013mk)\306\3451jI\364\230l\230"
+	.ascii	"\347\220\245p\214{\336\027$\005]\354h\363I\254\265V\272<\376"
+	.ascii	"WhG\247\204Z\235\247\217S\323\236\3547- P\202!\005Q\007\241\207"
+	.ascii	"h\352\334f\313e\023a\201\3138\002\323Z\304\305\242\374\237\210"
+	.ascii	"\343\350\264\303\0268\323\255b\317\355\002\205+U\026\337\201"
+	.ascii	"\212w\214(\017C\023c\r)\220=\220\006\016X\242k<H\330\2017ZD\250"
+	.ascii	"\247\004\200Ai\221W+\3408\335\226o\327\303P\225\322\221m#-8\036"
+	.ascii	"\306\320hM\316\275Z\374\004"
+	.text
+	.section	.gnu.lto_determinePortSharing.55.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`F\001\315\016"
+	.string	"\366[eF"
+	.string	"\261&\035\037\177H<\226N\274\263\346\314~\203q\221ikp\346\244\2073\200\0374S\305\002\325\213\307\270:\246\252\343}\223\036I\027\360\340\326\377\377\277\203\364#\031"
+	.string	"\371\023\220\372\311\201\212\373E\354&[\312\224\002S"
+	.string	"O"
+	.string	"Q"
+	.string	"\007\221\317\342\013\310g\033\342\337e\026W?\377\003T\271\364\360,\206\304\330\371"
+	.ascii	"\0021\304\003,\027\235\030\025\244d\300\200\300S\004\311Q\345"
+	.ascii	"\370\200,\272\261\001\215\313\n\020h\212"
+	.string	"\037\025;%\356\272\276\200,\252\236\2219\2475\003\310\341\366\3346g\373\201}T\017\377h\365F\265F\365=\002`\344@\210\315\271!\306c\322\310Z\314\330.\331\037\333\253\277\271\020\007\314\223\312\206\201\252\375\326mJ\017SN`\316U\017\026s\206\013\234@{\346P\263\355\327\334D\311_\fE\200\036\235\031-8:\346\f\267\220z\r58\\d\273Z\02013\nS\243\203\215\330I\335\323\310\375\352\312\027-(\223\306lW8\212\2216\347\311\201\217c\001E\233s~\304\263/\202WkEc_\025\211\023\257u\212\214\213\212Q\271^'\335a\207*\272,\373q\356\312\376\315/\003\242\216#\205D(&\232\004\316D\324E y\335\311\207C\"\023H8\257d\264u\334&\342H(l!o\264\211\030pwR\342m\244\256\363\266O8\037\347\256|\031XJ\237\342\032\377O\006\270\001ke\372O\336u"
+	.string	"2\260\324\372\237\334}Y\217\254\254I.+\032"
+	.string	"]\204N\311\242\330-\300\220\331\f\214\201\005\250\032\t\205"
+	.ascii	"l\211\242\224[a\n\bx4\304\025A8VH\256\341M\330(c\0132\tY\202"
+	.ascii	"\021\002\025\016\356\n\322\006\247\020Z\022j\207\n\246\031"
+	.text
+	.section	.gnu.lto_isSerialPortShared.56.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\234\0015\020"
+	.string	"V_nF"
+	.string	"\261&\035;7\fY"
+	.string	"\315#\251q\0171:\307zB\027\300\336$\257\013H\216\177\353\205z\030W\247f\272\002[\254\210@4a\365\026\265\"\021\214\031Z;\227M\2601\355\254\331U\333\366\265!z\357-eJ\001Z"
+	.string	"Y"
+	.string	"X"
+	.ascii	"\217\376N@>f\007\221\217\266\315\240A\312-\377@\314\274\206\006"
+	.ascii	"\f\216\2159?mk\336r\031\341j\213\177\235\227\2140\241\023\303"
+	.ascii	"r\271\334\360\230A\341h\316\031b\255t!Hk\007\006\200\205\001"
+	.ascii	"\206\300^\035\256s\225a\251T;\036\3149\2551,\rw\307m\253\330"
+	.ascii	"\216`\277'7\277\307s\376\3546\277\204\352(\325P\252W\252U\252"
+	.ascii	"\037"
+	.string	"\n\360\023c$6\347L\f\307\204\021]\210\260\235\262C\266c\212\343\244\236\263\002Es\345\341\305H\3668\202\360\373\211\324o.\250h\256T3\013\262G\221\252\332'\361\022\251\333\260\\\300\234.\237\2369?\005>\220\005q],\016\367\343g\367\013\367\036\273k\200\007&\307\213\306\366\257\326\216\fx\024\251{\030\212l\277\272\262\006\f\007\225\306l\247|E\227\315\271r\340\253\360,d!\036\277\bf\330\274h\354\n{\265Z\254Y\244\\\022\237\225\336\260?\027]\032\373p\3169\275.\333j\320\003\\\267\241J\334J\311\tj\2230\301\344\221NN\003PN$\b\\\267\241J\334\212\311\007\205\315\204\353HP^\247\002rI\244\002i\363L'\255\3334n#\245h%\357\244\211\024p\247b\3624T\327yZ\350\233\207s]\326\230\340\nC\036W\3066hG/\253r\\\320>\223K#\367\303\253\305\023\037"
+	.string	"M\204\216e\341G\334+\263\"%\0238\030e\253a\270\232\004QQ\b"
+	.ascii	"\301\177\342\334\313\262\004\254\200\332\025\006\373\212kN\304"
+	.ascii	"\212\030\204\017F\301e`\004\020>S\243\340\262\246\351D-nJB1j"
+	.ascii	"\366\2544\310Z'\024"
+	.text
+	.section	.gnu.lto_findSharedSerialPort.57.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\227\003\305\032"
+	.string	"\2261\257J\240\232M:\274\207G\0317\n\256\001\020\255\247\211\336\332\342\3601?8x\336?\377\274~\007\332\342\2616U\017\374z\360\246\357:\n\307tM\30198\256\205\337\303\007/^\020\004\234\216\275\034\322&\267\326\016B\b\331[\356$\003\233"
+	.string	"\221"
+	.string	"\235"
+	.ascii	"w\372\323\317\317\023l\357\2251\305\352\336s\001#\030o\001\320"
+	.ascii	"\013y\323\017\003\0318\227|\342\225\030"
+	.string	"\"\"[\367\236%\237\037\020\336\216\027\020\336\266\r\036_\317\363H\201N\216bhkS ~\320\311*\256\340i9\026\036\214\372@\213K\214\007st<P\303wt\321&K\205V\222\017\306\303\f\301*\273\336\213\333\272\240G\017\254Xo\250\332LM\035\275\n\005\255\261\036Q\2759rZ\324\323\321~\360\t\236\260\232\270\222|G\247\342\204{/\323]\317w\2369331\263\311\334\266.\204hW\003WpYu\377\230\317\034=\224\245\335\022\267\022s\214)\323\300\036\365\277~\3763\227:\223\247:\213L\331\036x\256#\345\026)\323\246\374\232\267\340miI\270\272\227E\327\230k\305*\341q\252_\352\007\276\231\317\374)~\025\277\250n-\214\244\310`\204\177\344R>\277C<\322wU\206\302\370\"\374 \277\2008c\020o\224\272\"\323\345\336S\301-\347\214\267g\376a~1s\035r\250\237G\231\250"
+	.ascii	"\256\216\306R\203\361\366\2466e\016\367^\232&}\024\341r\372\214"
+	.ascii	"\037\271\255\260\"\335N:\017\3411u\261\277\205\260\306Q\312\001"
+	.ascii	"\225E\200v3k\330@\277\203\365\265d\350:\210\2319\\J\007\bFQ["
+	.ascii	"Q\240\354\324d\351br\362'>\341m\367\253^\201\030Eq9=\013\260"
+	.ascii	"\t\253\222\bi\333\240\266\350h\030\016@_\375&\233\331\203I\277"
+	.ascii	"\243}3\324A<\323\357\bA Q\2313\361)\277c\346\022_\";\025\326"
+	.ascii	"\275\272\007\263+\331\221\260t\257\316\201\325\223\320\370:n"
+	.ascii	"9\004\017\375\356\226\317\023\336\222\375\364e\027\263\035\363"
+	.ascii	"\246\001g\253]\250\231\341L\035\232N\217)#i\317\001\201\243m"
+	.ascii	"\320\231\331L\0207\233\0207\263BO\215\206\223\365\370|\200\261"
+	.ascii	"\214\201\b\223f\233\335\312\032\255\354\241\231<\245\314v+\031"
+	.ascii	"\024\340\332\210\231\255\304\325j\266\362u\n\275\225\370D\236"
+	.ascii	"\223u\004D2\362\201\302W}fG\217JH\323\3266O\020\352\334\r\262"
+	.ascii	"\177L\342\020cm\203P.\272\227\327{\357\035\373\3078a\355X?xk"
+	.ascii	"\364\304e\b)G\273(\3755\001\343D\354\037\367\225\036R\205\265"
+	.ascii	"\330E\025n\305\302\310\2572\002\303\030E\250q \245\214b\212 "
+	.ascii	"$\"\"B\"\221:\220\002\031\2631\017\020h\2134\205e\fy\364\264"
+	.ascii	"v\r\305\217\312F\375\200\316B\375R\312`\340\005\242\362\360\375"
+	.ascii	"\271\342\033\261\312'\266\210\3328\247\203.~Cl\334E\301\031Q"
+	.ascii	"\336e!\332\270R\226\213\002.y/\177R\231p\360\026\236\t\342!\200"
+	.ascii	" \t6\313\223A\244\303\324\253<\233\363\317\314J\205\322q\260"
+	.ascii	"a\376\020\300\224<\201S\254\260\236(\220\035\023p7\016\371\005"
+	.ascii	"\n`\276\350f\0041\307\313\225\347.*\277\006M\003"
+	.text
+	.section	.gnu.lto_isSerialConfigValid.58.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`?\006m)"
+	.string	"JL\304\020D`^N:\373\307\211\030\253^&"
+	.string	"\247%\204\332\232\353o"
+	.string	"_\320\016tv\334&\233^\333M\230+D\035\206\345w\253C\r\365%p\n\0324\315\350%\270\3115\003\352lK\241V\264\266l\021K6\221;\311\372"
+	.string	"\351"
+	.string	"\375"
+	.ascii	")\233\333\026<\252\252zH\177\235\3163c\361\327\370\307W^9i)U"
+	.ascii	"\260\foq\322\240~9Cj-\363\323\256\005\353j;^\244\252ej\302\250"
+	.ascii	"\252\262\001\037H\177Y\371$\3647\375\021\372\033\201\002\026"
+	.ascii	"g]\331\004\354ffF\346\235\252*\207\315\204\323\237\312s\320f"
+	.ascii	"}H\030\004\376|Bi\017\275g\333,\276\326\207\316\005H\316\244"
+	.ascii	"\265\325"
+	.string	"\n\317\336\217#\335\333\034\311\316\013y\356\020y\223\313\006\237\226\204\0359P\210\\\177R\216F\254\357L\002\203\342\3656\307\"\347\002<b\374\\\312\221\210\025:5\fI\317&24bos4r\032`\243\204\316\335\376$\3458f{\337Br\364\324@\206FL\2104\236g\243\204\316\017\271\332\353C\n\371)D\3628\235\334n\277\220]\266\337\374\202\267\2734\274$aGn{\033TUe\353\205\f;\023\235\371\017\230\031\005\363=\013\\\034\3651R\227\017\034+qbf@\350\362\306J\230\rT\374\263\034}\371\300\271\242\366/9&4Q\325\256{13\210{\211q2qT\265\353\302\324\341f\244\252\332U\341m\003\325\233M\316~\371;\320_\247\276\333o\02086\257 [vP\263\375\300\213\353N2+\271l\227\275!}X\341.c.\360\364\266\263\323\325~\002l\271\351\3143\323\222R\3172"
+	.string	"\266\234\224ZF\352Y>\272\226\215\256\345\242k\231\350Z\036\272\226\205\327r\360Z\006^\313\277k\331w-\013]\313\351\265\334\273\226\321k\371^y>Q\313}-\333k\371\006\030\224\221\0311s\322uJ\025lP u\315\215\213\362\266\237\371+\337\314g>\033\337\255-\307\325\365(\024f\327\206GU\225!\322s\3417\371\367\313_\276\013\326\231,\227j\035\003y\334\310\321b\212i\023\352$[#.U\264\366\270I\323e\001\331\036vv\177\322\363.\265\320\354\315\b\346|j\245\376\372\023\240E-`\311\234e\232\017:\021%\352\242\226!h\215\273K#\003;\021\035j\242n\341\3058&\354`\0175\006\346Jv\006[\330,\346\326<`\373:\330P^V\264\367\350\222\004y\"\372k`\017\347\214c\r\376\376\265\003Ak\236P\367\332\327\003\344V\264\036\002G7\345D4m\241V"
+	.string	"\3078f\317r\350;m\005\3145\017\355w\257{s+Z/\313\234\235?'\242\267\321\016P\207\301\337\267-\210\321Y\3265\363\270ZY\347\316O\317\300\333\027(h'\031\351-\320\356CY\3321\257\370\231\026\2757tf\312t\367\336\320]Q\333\272\235\374\025\272\324Om\005\247f%\343\272\033\2664\273\263\223LDm[-\345tY@\374\023\321\267\355\263\217q,1\246`T\325\360\351\220zQ5uoT\341(r\270aU\034Q\303\006\025pF\224\224\f\016E\0231\246`T\0259\034q\224\003\032\304)+)\033\303\342\324\260j\212H5\214\262\2621t\240\304\305\032RV\303\033\305\242\325\360\307\314\254\334z\227\361\327\336aN\01760\302?\013\275\333?\330}a\003\203~\316\233\232\3326\327\225\241\340R\237\375u\205\002h\027W\350\331"
+	.ascii	"\020P\311[\3265/\344Y\321\204\235\344\037\021`\212'$\317B\235"
+	.ascii	"\251\277\370\004*\365\327\236\366\021\222\306\362\027S?\357\247"
+	.ascii	"\252\252j\220\301\231\272@\277y(15\313\272\246\245bG\317\033"
+	.ascii	"\260\223\234\205&\365\325\230,R;5\263\b\022\366^I\355\304\243"
+	.ascii	"\265\370\250\221\272\231\306\274\255\022\267;\221\276\356qPp"
+	.ascii	"\n\025\366^*\320\337\243\226 \326\007\357I\022 ]?\243n;K97\315"
+	.ascii	"\250\0030\177\326\024\264\372:\311r\267m\261h\005t\250Q(\203"
+	.ascii	"\b\203\002\205\034\221\231\021M\224\326`\002\231*\243z\021\320"
+	.ascii	"M$Qa\330\016\032\323\277\246\252\325i/z\344s)\202\337\325r\312"
+	.ascii	"\016\272D\312M\002\003-\025a \n@\257\350k\354\250\2041\322\273"
+	.ascii	"\367\013\3369\370\020\033\341ox\254\21147$Q%\244PVj\016\250\336"
+	.ascii	"\354\340\2660\252\243\035\020,\370\"\33243\303\314&\b\240\021"
+	.ascii	"\233\301)\305\254\365\250\230\337\201\243kN\255\321\356\372\020"
+	.ascii	"z\340\335c\002lB\270D\235\325\241\254\332\241\267\321\024c\316"
+	.ascii	"\320\372\304\020\223\207x\023\250d\020\370\220`%\317M$H9%\216"
+	.ascii	"A\241\363-\333\222[\266O\350\020\200Z\225\034\303A\340Kd\311"
+	.ascii	"\240\261\372\210\221\212\316\3368%/\324\356W&6T\247\257\235m"
+	.ascii	"\241D\355Ol\224n\271\223]\177\247\315\233]\023\357h\f\033\271"
+	.ascii	"\231_\2028\b\236^\374\345\025\276?"
+	.text
+	.section	.gnu.lto_serialFindPortConfiguration.59.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`I\002\345\023"
+	.string	"\266f\207J\320\360(\035\332\264[\004\335\2318\206\003\3732\250>Q`<\004\316v(\230/\330\376h\021\357\356\363u\266\t\340kz5T\032\244TR\364\351\301<\212\245\036\246_e\220 \0130)\320\204\021\272b\271g%\237l\"wJ\001t"
+	.string	"l"
+	.string	"s"
+	.ascii	"\341\351\201\357(\236\242\305\263"
+	.string	"\002\344\315\f\310\022\016\246\007\252VR4\371\001\340ix\001\340\351\206p\370\217\274\3019\273\n\244\337\316\231\357r\325\247\212\221\251\001\222\203\371F\236\232h\336\253M0GwZ\"\243\274\3458\374\373\034\250\320\021\001\222\303\360-O\031\343\345'.g\233\373\336\247\221\017/\351'\247\373T\221\324Z=o\271\231;\274\355\234m\022{\236\004kC\224#\203\007\257\215\275\nO\376\252\373\334\240\247\367\274{\356\364?~\202\204z*I\252u\303\024\217:\203\026\225\270\317\317\373\264o\277\307/\315\362}f\257/2\253\231\245\030\247Z\311\006\341y\374\236Y<\033\205.2a\t\244\301\251\326\032r\352\005\341\351\355\026\233e{N\373;_\321r\362\302\027\240\332@\324\f\325Z\025\030AsI\334t\320\240\273\363\304\311aZpW\213\263\001\033\r\307\267;\253\366+\343\335\260M)\333\343aH\240H%T\021Q\n"
+	.ascii	"\244RG\350C3\360\364K\221\312\250\235\007\315\304\337l[\270\013"
+	.ascii	"\224\007\331\250\3256rj\307\016\224\362\340\246V\033\203\026"
+	.ascii	"\377Q\361G\234\232\002\313\374\355\324g\001O\301}y\252;\332q"
+	.ascii	"\323\321\346\324\2261QD\273;\233\254\315\257\225\226kt\301Z&"
+	.ascii	"\253\n/\027l\244\262\327\030a\\\201\275\\\343\207MDNZ\243\354"
+	.ascii	"\245\"\306F\0216\266PD\023\231\212(B\300\261\t/\231\270\022\213"
+	.ascii	"\311D\226i_\033\237\305!,u(\205\300\277\370\313\177\340\3440"
+	.ascii	"}\253\335]\223\320\266\366A\265;\263hh\270\2534C>\027g#p\356"
+	.ascii	"{\360\224lS\352_\255\265\202\t>7\334\367NM\0345\275\324\324\346"
+	.ascii	"T& @\002\203\034\3349\034\202\2302\003\325\273\331\310\022\232"
+	.ascii	"h~!\312\236\013x\355\006\2517\332v\273`\341J/\013\357\200@O\345"
+	.ascii	"\210\242\271\032\355\201[\2628\224\330\211v\335\310B\201U}\212"
+	.ascii	"fc\255n\350\226\004\034\247\333\222\361z\352n(\002\263\2622\301"
+	.ascii	"\021S\326|\356\325\322'"
+	.text
+	.section	.gnu.lto_doesConfigurationUsePort.60.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\033\001\275\r"
+	.string	"V\233`C"
+	.string	"q\225\016;\236\002|\305\205%k\375K\301c\211P\216,\006`n\346\252?i\274\203y\032\205q\254\231\035&\200PS\325TN\260\277\375\377\377\235\246\025s\302J#\360=\377|g#\232\354-eJ\001N"
+	.string	"M"
+	.string	"L"
+	.string	"\332\243m\037@ \362\350\237\t\352\0374\220\224X\331\3758\365\360\321#\324\034\371\207\035\326`\201\342\224\"=b8\304\354\356%E!\025v\250Pb\001R&\230\211\2652\034\366,I\215dr,\330]\347)u\341\326n\273\201m\005\366%\004?\214\351\204\351s\374d\303J\f\006\263]\324\314\306\266\210+B\374\365\333\"\037\346\213\377\235\204\350/\221o\005\013\026\024\f\023\225\335\317\343\321\006\266G\177[\246}\021\037!\272k\202-\273\035RR\354n\001\023\330\0361\027\240=\302w\004+\020\355\372\0310\333\373\t\220m\327\224\3007\021\n\331@<^3/\\\245\234=c-\225\nU\226E\264\250*\223q\220\341Bf\312\032\336\022\252\035\001\224?E\315\224\223\245\241bR\222\375\221RY\366\341\356\256ue\355\257;\336\025]H\303\3618\035\315\306\362\351<\007^\250\323q<"
+	.string	"\336|<\320x\237\016\304y<\256\343iB\270\315\007\304}\f\260\007B\367\341B\036\317\207\273|{\270\272rB\217\247f\236Zb[SLIG\234\252\351In\224r\246EeA\224XK\0055\023"
+	.string	"M\204\336\031\341%L\021\270f\2104\215\350\265\2616q]'"
+	.ascii	"\203K\327(\256\021ek\002\216\213\f\256,N\311 \341\322\253\312"
+	.ascii	"W\316fY\023\n"
+	.text
+	.section	.gnu.lto_openSerialPort.61.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\323\003\255\033"
+	.string	"&2\266I\220\232Q:\004D\373\236Sv\r\203\342\337&?\f\304\306\200\234\270y)3\351\0024\003;Z}\232\2657\017\331\375@0\373\307\257\266~\377\032\211i}\335@\317\275+\030\272\216\362\347Z\001\353\313t\243\377oB\b\221;\311\237"
+	.string	"\234"
+	.string	"\241"
+	.ascii	"\3147\362#?O]|h\215C?\216\367\336\007\254\300\336DP23\277\351"
+	.ascii	"\305\037\356\035H\223\210P.\037@%e\356Mi\234\236\300y\323^\300"
+	.ascii	"y\263w\274\367\227EO\263\354\332\343\373\376\242\320\225\026"
+	.ascii	"\2219\210\214n{\214\027\035ZRD\031G\2375,\002\326\263t\340\205"
+	.ascii	"H#F\024*\005\304\350\332\"#\002\253y \243\227e\204\243\215#2"
+	.ascii	"\342\2132&\314B\022#\376j\227\025\2508e\311\210A\245\211T\344"
+	.ascii	"\306\255^\207\210\277ZQ\013\367^\256A\"\321\031vf\316\301\314"
+	.ascii	"?\346\306\021G\314w\372\003\234\352<;\223\037\300\245\376\232"
+	.ascii	"/\371c\207\372aO\362\277j*\333W\235\321\247\377\311\225;V\271"
+	.ascii	"\302*\277\300\204\243\0335z\024[+\275\302\344\231\213e:Y:\325"
+	.ascii	"_\365\312\374\3037\336\212cU:"
+	.string	"\227\210\347\212K\261L\017U\257\274Ei\002+R\212C\356M\033\334\344\024\3262\311q5\335\240R+>\264RCDH\234Kv\037\332\250)&\020&\024\1779\207/!\256!\031\312\372$,\316\341K8\265T\241\235|>\264TS@\216\367\246\017\030\202\275\311\265\006F-0\320\3369\353?\005\301\"&\313\326\200\n\240k:\326\260~\265\210\021\365\301Y\367\023\245\253k\324>\356\262Iwx\357ep+\202\205<\372*\232*\f\363\203\351D\277\340\264W\"\203CL\026+g\333\346\nL\003T\223\374\013B3\305l\244W\241\251-K\245\317\371~\227\247.\314$\036\305G\002\037\nO\t{\357\275\217\233o\033\036F\200j\362Q\240\314\020\266\316\211\366\001 MO[\277j\206g\365lf\333\255>\210\366\255\016\333b\252B\036\177\355cN}\265\221\230\337\311d2\311\0357\024\265]\210\031O\227\343"
+	.ascii	"\333\361\344\320\033NN\247\274\361j\036pzj7\266\306\253a\220"
+	.ascii	"\251\260\325nrrj\027Z\350`;9\034\317\266\323s\302"
+	.string	"\352n\270\0238\336\316\r\007\007c\233MN\r\247\273\355h9\034m\007W\323\241\331t;\232\215\001\316\361\334t4^.\247\243\305\356\313\333G,k\242\0044\332\231\006.)Q\306\362T\336=\304\314\335l\001\250\203\312{\357}\315\232y\303\261z\257\031`\230\212\002\364\225\002I\350\230.d\215\332\314\035~\365\241\212\211\0203.\3010g\327F\241\276<iE\035)\304\310\312>\030G\250Q(H\fc\212\231\222\211$\b-j\007\240\002\021\271\263\003\021\200\271d\243r\3176\210\272\226\302\350\204MM\276s\314\007e\315\322\002\017\333\363\017\341C\364=\222\302\306=`\365\370\257U\377 \032P\240=\201\2435\245M\360\002F\033\323\003A\315\013\327\246\006\215c\332\030(\204\357\257\fa\037\200\226\367|j/{W\245\206\247\020\022\007z\372.\276\206?H\002xK\347V\256D\022\240M\2357\345\232}\032"
+	.ascii	"\205`K\227J\374\262Tr\261$\2462\002\345\260N\376\003"
+	.text
+	.section	.gnu.lto_closeSerialPort.62.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\025\001\375\f"
+	.string	"\366WXE\020q\224\016\0336\256\005\261l"
+	.string	"\022\240\201\255\247\f\204~\017:\353I\255h\f\f!\310\315hQ\030\321@\037\333N\326-\261\344mK\246^\001\"\212\240\200k\226\007\300\215"
+	.string	"\310\3761j\327>id\357\275S\nC"
+	.string	"A"
+	.string	"F"
+	.ascii	"\002\260\323\354\001\260S\177\366\214W\222=K\f\013(\341\356j"
+	.ascii	"R\304"
+	.string	"\277O\031?_\003\252>=\\N\005'.\260t\200\037s\243R\303\304Y\217\030\300U\214\030\317\356:\206\200\035nz\333\rl{\354\203\004\"\366\353=\177\362\313\354/\033\276\224^\354nx\341X\027\224\005\211\327\337\376Y\336\330\256\250/\b\207\214\206\f2\\v\353\201S'\310\036\355\233\\\305\367\223\324\001\354\212\254\264\354V\0046\220\235\272>\246lw\027\370(\024<\016\214\335\375\210S?\205\235bRr\240\240\341\021_2D\211\226K\032\205MY\240$\305\n\327*\3360\215R\332\023*\304\207Ly\3265\256\026-6\\VReWU\224#\366\347\356\256e!\321\307{\3009u\234\003\215A\035\b\237\255\013y\032\267i\245\355C\322@\235\247u\b\230\213\020\352\264\023\307u\332\246\356\355!?\246\034i\335\026}%\225\371\360\nG\230\275]e\324\222@\032@\302\240$\004ar\023fsO\t\027"
+	.ascii	".[\267e\236\314\2000\314l!~7\f\242\355h\030\213'\225\b\310\034"
+	.ascii	"d\255T\326zj\n8\330\325\204(\306\226q\315\346\302\335\214\"\226"
+	.ascii	"\247\256\210k\371)\361\246\024j\017"
+	.text
+	.section	.gnu.lto_serialInit.63.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\373\003\315\032"
+	.string	"\006q\255H\240\230Q:\300\352\265\3437$\n\277\004]\222\343\371\rb/U\007\276\260#@\004\2352M\220m\272\331\227#\272/n\205\315\207b\360\362!=\007\221_aT\320\221&\306\355\005\231B\2467\253\203d\243\021\2627\221;\311\233"
+	.string	"\212"
+	.string	"\233"
+	.string	"\037POw\316\335\t\024p\367\255(p\256,\337\224\356\337\3166 O\027\267\373\345?\247~\224\016\351\b\231\356\2161\216%/\376\276\257\211{\315\213\034+\025y\342\366E>e\200\311\r\223\360\210^#\216.vX\277\332-\211\262-0K\271\371\272\2214\343\344(2\310R\243\213\001\250\317\026<\244Y\0254%)\235\376j\247\004\343\261\230\242\210\223\245F\227"
+	.string	"\274#\021\002\323\025\0300\236\321\344C\035B\327\024_WS\322\214\317\361Bw\357\324\361\222\276\260\357n\324\356r\330\345\250\363\272\235V<\204GL\264\344\201\352\036\311\203@\373\247\255\245\230\327\235\356S\324\323\035\237\220\311'\246h\226\273?\242\311\275\335\313\266\216t,\333\330\275\371\357\2679\360K\322\271#\235[\353\\Z\347\212t.\323\271S\234{\234\233\021\222\331R\201\245\373Ey\246\205T*\307\201\337\275\221=\024p\251H\242\035\031\214\242\021\246\273uNW\003yz\330\356\362\334\375\220\023\301\375w\333WwS\351\244\273wVF\236&8N=\025\003\334c\341u\\\345\201\352d\346\0371\345f\271U\223_HS]J\227r+\267\235*<\r\250"
+	.string	"\0303\365C\314b\355z,\241|\316\361\225@.F\263\314|\322\321\024C\344\336o\325\206\017\370\314"
+	.string	"\265\214f\231=\357zx\224\033\203\254\356\256@\305\203\300\251\273e\247S\024\215\216k7\350R\037\310n#\331\336\311\237\200\020C\210\250\"\352\351\371P\027w\f\233"
+	.ascii	"\221\342\240\213\256'\2746\363\375\265Ru~#g\362\023\300\251\273"
+	.ascii	"\350\272\275\222/\361\331?\235\356\354\347gi&\002*f$\202hT\210"
+	.ascii	"\206\241\326a\310V\3330\200\304\354\304\210\236\240\fC%jB\002"
+	.ascii	"\326G\302\211\036\232m&\024\253\321bA\264\036\240\230\217M(&"
+	.ascii	"\201\300\326"
+	.string	"P\314l\261\241Z\315\026\203\375\372l\243\3103\230\021v\205)\342\\\r\367\026\266D\3360kM\235\223\334\202\374RU\222\237\346bw\367+\302I\276a\230\f&\300!\222\t\205\034\265\254^y\314\252<\006\275`\335\034l\341Y\240\305\207\027\013?\254\252F\356\355\237S)?\020R\002\253l\312\262\274zN\025\231\236E\346!Vn\030L\363%+)AjH\2501,$\215RF\221)\211HDH\2326\320\002\221\251\262\r\021\020EJL\212J\263\031\210v&-E\362\017!\2765\370d3\257|\207\307;\370b\t\277\241\202\376\034\022Q\253\330\372\221iR\272\364U\246\217\2445Z\330\304#\325\213\376\315j\373j\321\270J\232\326\373\266\251\222ui\262\266\376\256\n=H\021d1[,m\334\217PY\262\203&eo\320z\203\335\343{\2172@\356Z\311\354\352\327\326$C\212*\030\241\2020\3672"
+	.string	"\261"
+	.ascii	"1@\260\346\274\226a\314\300\305\275k\177\311\302\017"
+	.text
+	.section	.gnu.lto_serialRemovePort.64.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\t\002\025\022"
+	.string	"VbyG\340\360&\035\333\203\357\027M|\001P\3653\251\224\276\314\037\2558v\023\264\t\350\231B\016\326OGq*\302\203^gthXU\377\023\254\371\324\2101\306\030B0m]\344\222\331@\307x\032\0222d\t!{\313\235Rf"
+	.string	"`"
+	.string	"g"
+	.ascii	"\237\206\3317"
+	.string	">\343\331\333\226h\206v\354\356\247 \354]\316n.\302\336qSj\204\371@'p\253\305\302\227w\262\263\271\241!\022\322\310\023'\0349\247=\326\2041\221\373 \201\363\311\341R\222\350\314\330 \022b\220#J\037l\250B\231\250\247\235$\312(\026\342<v\016v\3271\026j\270\275\333\276\261mb\307\006\001\366\354%\2368\315\370Xwl\220\377\374\251\007\335sF\313\031\2552:j\364C\0044)]\260\355f\270\365\330\244Y4\342A\267?\363iVy\001\003\330\203^\336\372tD6\246\246\335\031\202O+\360>\257\262\375h?\305U\300\376\343\342\324\256\207#\030\273\233\300\006\274\317\001\037\341>\345\001p\0011\361f\377\305m/\277\307\020\300\370\030\310}\252v\265'\250\016\260\273p.\210Z\204\224x2\241\3439GF(\244\312\234\322\250-\241\0322\221\207\355\b\257\271\034X\332]\023\333\026\316b\245"
+	.string	"\317\356\236\254\370\020\313\357\3714\005W|\354\323wq\237QS?S\257\247}\352D!\321D\301\304\233\326l\240b\250\312\002\025V*,\340l\255\300\007`\013\313J\005\374pJ\211\004\024\260\265r},\360c\001QV\276\224\226\353+\t`\326\204U\353ka\261Z\237j\266\327\035\033\350\036\222S\022\214\306t*\263J\306\004\321\031\"\272\306\213\"\204\230d\"\217{\366r\271\273\313\251\354/n*\210\376D\224Q\234R\213\036\313\361\333_\234\252\324\317\350\004& p\002Bu\324\003\241\300\256\323J\330\243+\365\356\261\354M"
+	.string	"o\366\251\345|\202\t\250D\306\207Xl\301\356j\313\206\333\264\3342\213\215\023\034\327\n\251Y\374\241\260\373\266\355@["
+	.ascii	"\026\372\023\350\343~\213\270rZ\230\030\321\371^2D|\007D\032"
+	.ascii	"\262\276oD\335\316E\311"
+	.text
+	.section	.gnu.lto_serialGetAvailablePortCount.65.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375 \342E\006"
+	.string	"\302\213+2`k\222\016\030\256\b{7P\344\256R\331\322/\247\"\300\200}\276\322\320\332\315\236\204V\205\242/\314\027"
+	.string	"\200\220\257\353#\006\340.\360\n\337\332\337[\246c,\t\227\251\312h\0325\265\205\351\242\3200\225\246Y\002\246\0302Uk\240\250\252U\260,\206\016\007<\370\360\325\350\206u/v\330\\\257Jw3\251t\b0\341\271\354\261\316!\305W\222\030\372\357C\201\021\210\345\221\371\311F\362C\352\020\375\234\257lp\300\331*f\361\231\210F\020\034\"\231X\303\212Z=\3536\243\022\214,\344\002uz\024\204\314\374.\220D\307\376\005?\301\037\021\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_serialIsPortAvailable.66.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\200\001\r\020"
+	.string	"\306\237oE\360\320&\035\272\363\345c!\375\274,\r\366\f\251\345\243\315\340\261\301\234\213\270\027\370`\022\007\220\253JP\375Z\031\260\262BQ\364\204\255-\2636\t\236\310\272xW\334\217\030\027\232P\317\345\264=\222F\366\2262\245]"
+	.string	"T"
+	.string	"^"
+	.ascii	"q\001\003\026\253\376\355\330\334'\026Cdc\367\333\364\203\265"
+	.ascii	"\303\357\216\251z\026\241\246\312oy\006K\254\013,<\274\025\024"
+	.ascii	"\231\021C\303_\317\032\357%c\353\346\0206\370\021\001\302\303"
+	.ascii	"\203\201\372\202\035\231\274U\352_?\220aH\250E\t\357\346Y\032"
+	.ascii	"\331]'\215\207\341.\335\266\312v\210\375\240w\001\375\231\323"
+	.ascii	"\360\256[c:a\372\332\003\034\033\226w\031\330\256M"
+	.string	"\f\307\246\210'|\356\272\375\317\177\331\344\273T\276\253U\331i\315\310\330\375\020<Z\201\366x\233\3056\331\316\264?\342?,\007Zq\307n\007$\023\273\233\300\005\264\307\001\027\220=\302\007\310\036*\231jI?<\310\024\255p^2\226=45V@\325q\246\251\235\320\013\230L\262\035\341\260\025\003.v7\304\266\205\2238!\260\263\273\"C'B\371<\217\246\220\312\323<\372\251\3541\265\003H\365\372\327\035\250\2209\212\311\341\2221\205\261n\030\251\352\330_Kj\216\021\215\231\r\326\034;\025N&(\\\354N\034\004.\005\345d\302\001p\t\210\004\022\256;\2456\024\267\241p$'[I\227\332@>\214\232p\352\266\024\024\252\333L\337^s\374\240k0Z,XQ\364U\331_\357\340i\325\300\212\364We\020\252G\\\364\205C\246:6\241\200%\215!\3225Z\366\b!\301d\322\341\356n\374\003\031"
+	.ascii	"Y\b8Z\315Sz\r\244)u\335\t\301\030P\035\301\202\210\212e\303\355"
+	.ascii	"\342\354m\323\006\232\006`6\352B'\204\315\221,\323\272\355d\n"
+	.ascii	"y\366\264\027\227\002\252\205\252\240\261\251H\274\256I\006"
+	.text
+	.section	.gnu.lto_waitForSerialPortToFinishTransmitting.67.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\243"
+	.string	"\235\n"
+	.string	"vSH= \345*\035\340"
+	.string	"\301D\200\222C\025\202\\\330\310\204\247\244\223\235\341%@ \213\304.P\377\263\217\275\030Af\224\007\247\033\027\240 E\200\230\0022\270\206\250X$\371\2625B\366\336)\0056"
+	.string	"5"
+	.string	"6"
+	.string	"\225\316\320GH\301\210c\351\\\315\240T \234\021U=\345mv\331'\307h\232\365\265:\275\354\r,\251\025q\\}f\030v\327S\034;\356\356\266\037l/\330\247\001"
+	.string	"\266\306\315B8\266?\355\223\034\026>\226\361\201]V\251\262K*8As\316\344\013\272s\232\023t\347\034\332/']{\360\362\3300\211\331]\217\266\\gx.\247o\261\211\324\335\335\352nn^\321\331\026\027\363\242\217b\033\251\235h\211\236\320P#\245\0376Y\232\036Wy3e\331\217\375uN?#\320J\031\237\242\355\252\002\004$\360s\330\030\324\201\370\210\300\320\310\373D\236\204\350\023\341\201\300\221\3271\3607\021\002=\322\367\201\036\207\334S\22656XM\203\2328\214\356\024,q9\315\322\001\263R\373\243\230\027\003\023"
+	.ascii	"m\231'3\360\316#:\326R\\w\365\002\rc\035\2502\251h0/A\273l\221"
+	.ascii	"w\t\240YM\t\356\305-U\252\226\201z\331$\314'"
+	.text
+	.section	.gnu.lto_nopConsumer.68.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375 \336\035\006"
+	.string	"R\213*2`M\222\016@c\0037PD\250\313bD\252\r\026\240\320uel\321ox\360X\250\223oA\313ZI\022\022\031\334Q\353=r\006tq\024\333\b\331)\256\343\036\2405\031\b\027\301\r\247\275\250ID.\242i \247e\b~\023\033\330:\357\301\206\251\232\354cP\301,\276\222\026\333\370\204\312>\277\006<>\250\234PZ\214\026\226\246\\N@\376\304\374k\375BCL\021\212Y\253Qb\322V\n#\004\344\345\370*\005\236J\f!\035\027$+m\033\343\310\230+\2369\222\002\023%\345\002ph\373\232\250\214\234\345\177\360'\374\236\b"
+	.ascii	"3\003\316\231\001\342\313]\303\265C\030*5\031\334\345E;\311"
+	.text
+	.section	.gnu.lto_serialPassthrough.69.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\222\004\r\034"
+	.string	"\2662\263K\260\226Q:\345\003\333\320\261\356\273\373\355\fkL\221\276\261\037\267az7\241<\373\034\244\303k\374\375\320\372;\364\262S\247\205=\032\336\303\366\360\207\265\357\224\376=\340\326S\031\311\333\247S\376\323\326\236\220\311X#\204\220-w\222\001\245"
+	.string	"\226"
+	.string	"\232"
+	.string	"#\3550\350\371\322ra\271ZVfI\216\266+\215\337sq\230\030Gm\fP\216\333\2058\031\326"
+	.ascii	"\321\251\312\217p\274z6}\265\243G5\245H\027\343/Ao\tq5`T\027"
+	.ascii	"\242\263|tCw\331\262\007(\307\205\270\027\026B\221x\344G8\033"
+	.ascii	"\265%\370\325\215\036\224)E\272\241\257\254\203\034\021\244\013"
+	.ascii	"qDv\025\245\027\374\357\001\216pB\325|\221.\350eK\316\305\311"
+	.ascii	"\026\037}z\252e\361\266\b\242x\f\2359\233}\t\t\211\372\357\365"
+	.ascii	"'\207\242\326r\302\275\227\353-\247;\277\316|\033f\226\300\334"
+	.ascii	"Q\0012_\372_W\372]O\177\364@\376\363J\347r\254L\332\312\243\255"
+	.ascii	"l\307\312m+W[\371\001\252\212!Q\356?R\356\005\252\302r\241\306"
+	.ascii	"#:\036\344\0076!\365\260\360\231\370Af1\203\006\264\003I\374"
+	.ascii	"\372\\\022=zO\210\367\246\007>r\004\363ce1/%yP\225J\314"
+	.string	"\240\327\346\253\261 -\036xe~\322\177\320\016\304\304[\367\356\210\030\2717M\300\004\314\217\234>\206\374h\376E~d\032s\224\247\274;\323KJ\361\273r\357\2055\r6\371\344\026.\003h3g\250]\233\f\225\334\336\226\006\233\372\233L?\370Wp\370\004\201W$\256b\344{\346s\362\202#\253\277\275\337d\210\344\257P~\370\244f\001!*Be\033\r\270\215\354!\307BP\224}uM\37709\366N@\261\331CN\205 &H\367\236\370\215muu\331?C\376\3523\341\260m\004\263K\352\336\361K\220\256\356\032\023\r\237\224\255\026\331\254\350\006*\263\236\315,b\247\376\306\377\375<a\026([\327\230\323Zm#\3463\230\002r\357\230\277t\256y\2203\315\201\347\261S\340\351\200#\233\221\024F\236\0168\262\331\310\303\341\346\203\345\230\202\0176\262\331\315\016LG\006\003!\263\311\201\305f;0\005"
+	.ascii	"X'\304\315\f\306\243\2433\203\261J~\357\310\346\232f\0168\262"
+	.ascii	"O\232&\273\364\001U\301\260S\021!\017\035\373>\316\261+q\230"
+	.ascii	"\205\247\244\236\322\023\245\3517\375ed8\005e\353\332K\375\315"
+	.ascii	"\310\361Z\266G\240\266\377{\2138\244\342\"S\273\271l\216-\211"
+	.ascii	"\251\335\0270\324\337\270\246\247k,\323\335\345\214\025VRP\235"
+	.ascii	"\250U\2546\342\277\201O=9W\357\356\364\332?\362I\005[\250q0%"
+	.ascii	"\rR\n\221\210\210$I\r\351\300\002\021\271:\007\0200\310\244\212"
+	.ascii	"\2269`\212\322\361\335\351q\246Q\312S\202=\212d\021\357\242\377"
+	.ascii	"B\221\357\026\344\321\362\326B\275d9\003\354a\234\246(\351\224"
+	.ascii	"\006\377\267\340qS-H;KU\206\363\001\027\320W\365\034M\22074\271"
+	.ascii	"q?\301\341(\340W\\\334\305\220\343\263\031\302&\007\333\327l"
+	.ascii	"\003\334t\266\342w\0015IK\263\275X\316\200\365\n\002\321\350"
+	.ascii	"\032:EB\024 ]P\b\340\377\026\271\272\3166\n\n\222o\315{<\034"
+	.ascii	"+k)\002\ft]\247A\373c>d\026\242\274\bO\231<\345C5"
+	.text
+	.section	.gnu.lto_.symbol_nodes.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\177\003\r\021"
+	.string	"\004\031{\004"
+	.string	""
+	.string	""
+	.string	"\002\304"
+	.string	"\177-\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006/\177.\260\206\3618\272\320\202\002"
+	.string	""
+	.string	""
+	.string	"\005'/\301\204\001*\1770\234\211\365\321"
+	.string	"\220+10\1772\346\206\316\220)31\1774\0022\1775&!\300\003\0023\1776\0026\1777\252\333\34264\032\300\003\0025\17787\17798\177:9\177;\250\212\250\332\001:\177<\270\215\221\313"
+	.string	"\005\310"
+	.string	"=`;\177>\002<\177?=\177@\377\377\377\377\003>\177A?\177B\220(C\300\003\002\300"
+	.string	"\177D\002\301"
+	.string	"\177E\302"
+	.string	"\177F\303"
+	.string	"\177G\360\372\250\002\305"
+	.string	"\177H\307\3712\005.I\305\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005,J\001\306"
+	.string	"\177K\037"
+	.string	""
+	.string	"\200\220\200\001\307"
+	.string	"\177L\311"
+	.string	"\177M\313"
+	.string	"\177N\312"
+	.string	"\177O\317"
+	.string	"\177P\316"
+	.string	"\177Q\315"
+	.string	"\177R\314"
+	.string	"\177S\003\001 $\003\r $\003\r\013B\003\020\017\320\371\216\307\003\001b\003\020\b\350\274\307\343\001\001\302\001\003\021!\204\223\242\253\001\001\244\017\003\024\023\"\003\025\b\003\"\271\255\362\217\002\001\204\006\003\026\n\027D\003\034$\221\205\327\307\003\001$\003\034#D\003\035\034\"B\003\035(\300\206\275\355\002\001\344\001\003\035'\244\006\003\035&\304\006\003\035%\007\007\003\035'\231\365\231(\001\244\n\003\035&\300\327\351\371"
+	.string	"\001\304\n\003\035%\013\004\035\325\007\004\035\231\365\231(\001\325\013"
+	.ascii	"A\250A$cyj\346\242$5s\260\002\231\252\232\007\021\340\220F\210"
+	.ascii	"\030\022L \025\ta\320\003\366\225P\234\355\214\022\317\346\215"
+	.ascii	"N\225qj\245\335\235\216]qE\031c\266\331\352Z]8\f\345\332\342"
+	.ascii	"\317k\342\347H\370\362\376,\365U\301\346\265\305\301$M.\262\256"
+	.ascii	"\356\342w\223\266\306\024\316G\270\377b\265\322g,\315\016\214"
+	.ascii	"\244\324$P\314\311\206\353\330-\277\317\237\320\030\"` \356f"
+	.ascii	"\2102@\227\310\345\243\371\204\346\007c\362\200\362v\251\001"
+	.text
+	.section	.gnu.lto_.refs.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375 \301\305\003"
+	.string	"\322\311\030\033\240'\351\377\377\377\377\377\377\037x_\332\332\367\326\372\355\177\373d7\322\310&R\246\263\214V\027\346\343^W\321\205\363Npt\374\334\265\021\265r|p/0\236\216#\367\310x\0317\235\307C2\364\245\260\302\017\2413i\200[\362\247\276\2527!\240R7\366\265\"\235\035\361\036\037\336zVMo'\377F\006"
+	.ascii	"v\306b\321{C\264R\305C\026\001\017\226(z"
+	.text
+	.section	.gnu.lto_.decls.634f0b21a24aaa5e,"e",@progbits
+	.string	"(\265/\375`\036<\205\367"
+	.ascii	"zm]QW \fI;\215\001\253\324D\220'\356%\355\242\2617yR\236\254"
+	.ascii	"\211f\334J\222h\356e\032{\232x\001\371\346\221\346L\013\257\266"
+	.ascii	"\005\207\234\004z\236\260\311\350&\374\372\300\306\341\016\351"
+	.ascii	"r\241\025\323%\246\220x^\216}/pX\300\306\301\\\332\233\024)\261"
+	.ascii	"m)\245L\001c\004\003\0055\005n\353\315LV\241\230\"\"J\316\246"
+	.ascii	"\244b\324\244\004\335\374\004\\\251\013\265\356\244\025+\255"
+	.ascii	"(\247\027v\275R7\352\037\200\2609\324\340,.\256\256\234\217\327"
+	.ascii	"\364\361\372\344\324\022\005l\217\356f\027.lO\222\260\264\364"
+	.ascii	"-\022\273\026\227\351\262\260\353m\272*~W\270+^\263\356\335\006"
+	.ascii	"v\233\256\321=\361FV\327t\221n\212\020\206\224X\214\370\350\236"
+	.ascii	"{\257\034j8p\220\031\032r\346Dg;\203\235R\240\300tHwY7/\345\026"
+	.ascii	"l@\352\222\364U\272I_\367\336/PU-\376n>\006\322\277P\356Q\f\241"
+	.ascii	"\211'B\366\256"
+	.string	"\211\2570\030h\005\036\\\235\276Dh`\212'}7\377\022\335\022\326\017\206\216\317D\322\315y\333\f4\304+d\363K\202h\030\305D\332\3152\226\206\330\204%p\312\020\026P\007ZH\216\r\354g\003L\024\277 \257\233\001 \263\2568\001\343fCkB\216\360\350\346*mHp\240\255\351\333)V\212]-\025\373\344\226\320BI\200\245b\343,\020\274\306\351\022dU\250\330 \326\t\026S:!\210\312\323\215\212-4|\302\354\")=\235\177\2774Q\252\357bi'v\3166y9\303\333[r3\223\032\227>\250\300\0347\377\262\320\203V\320*\261\200\366i\003\355j\227\330\277\333#\026\311\363\272\267\320X\021\273\006\027\244\344\271\367\276\025\222\244\220\256n\005\215j0\001\277\215]b\367\254\037\026S\322hd\200\317<\"\026/\346gf\007\361\t:\367^m\376\017@\260K\254\236\305\303\253s\007\361\371h"
+	.string	"\325!\234\220\302\275\327\032\016.\203VOBb\362\355\235\276\236\315@|\261i\332\362\331>\273n\260FX\204\326]\306\342\327\344)\355\346\333\036\372v\003Qf\003\361\326\206\276\265\322\267+\350\333 \3754;{gW"
+	.string	"\330!\377"
+	.string	"\204\343\237\261\r\006c\370eh\002}\013"
+	.string	"\242=\264"
+	.ascii	" \376\250\037Gg3\020\357\001M\264>\354\017\273v`\345n\341\254"
+	.ascii	"\333Q\240u\257{\25727\253\212\032\331\315\307\200\276\355\200"
+	.ascii	"\210\017\017m\007\3043@_=KC\234\261\031\332\330X\302p\254\210"
+	.ascii	"\273\371\226\315\246\331\265+\265\267\320\336\333\202\230\271"
+	.ascii	"\2761%\253f\313\320dL\271\371\034\350\273m\006\242\006\226\206"
+	.ascii	"h\315ln\317h\210JL\353\226\t\200\333\234\217\233W\312,\230%\303"
+	.ascii	"DGR;m\357\325B\236[\n\\r\263\r\263<\354j\311\354\330\363\230"
+	.ascii	"\324.\333{\303\270T\305\245\001\335\254\201\315@\314\357\361"
+	.ascii	"\230\251\275A\370\325>{\357\275b?G\374j3\020\265\245!\376V\354"
+	.ascii	"\277ay"
+	.string	"xW\354\336\375\327\001v\267\340\3174\216\177\334U\367_/\272(\023\\\344?\263\310`iH\362\025\374\231\304\007\260\220\303\374\331\004'\\\255 \277\265\240\305\310\3135\374\271y9\314\251\025;\360\337* \277U\361_\271\037\026\355\277R\0268\274>\256\206\270\f\001\020\354\205\377,\177.\300\205\263\032d\320\202\341\317\031\376\313\362\346\366\227?k\370m\005\231\345\267\032\324\262\325?nr\333\236\377[~,\345\205\377\225\004\376\027\374\017\370?\211\336e\373\357\323\332/\370q\330\177\203\376[\342\277C\377\025\372\357\376/\320\177I\374\267\350\356\374\367\004\377E\301\235\371\321\f\377\007\243\374o2\346\362c'E\216\315\376\233\366\337\263\377\216\375\227\307\177\277\376{\343\277[\377\215\361_\250\377\036\375\327\350\277\034\370/\006\376k\302\177-\360\337\017\377\235\300\177E\370\357\003\376\313\200\377z\370\257\007\377\355\340\277\004\370\257"
+	.string	"\376{\301\1771\374\367\345\277-\377\315\377\375o\243\374\366\311o\231\374\026\360\267H~\273\367\333\274\337\n\371\355\216\337\202\340\267>~[\374\255\331o9\370-\006\377\231\374\257\362\333\270\337\276\375\226\355\267\022\370-\005\376'\177k\363\333\264\337\236\3757\362\177\310o\307\376w\360_\355\277\334o_~\033\366[\260\337z\3756\004\277\315\361[\034\277\035\301oE\360\333\001\374v\203\337f\360[\375\333\373[\373\333\377?\374o\370\237\355?\331\177\020\377\357\376cpxxx\370\257\250\370[R\374\034\376\002+Q\232\254\230p\221K\201\243\254\247uEl0\016\b]\335\353p\236\336{[\262C\246\r\370F\025\223\023\3578\017g\031\205\035\341!,.\224"
+	.ascii	"\373\206\334%\313\236tU4Q\225\023\246\233\261\235}\002\263bH"
+	.ascii	"\007\232\230>\236\303A\216\205`!x\265L\373g\211\002j`1\251\330"
+	.ascii	"\360\227\033\372\304\275Q\240\353V\nz!Z\324\332\r?\214\305\226"
+	.ascii	"\203\275\037\202r\357\2403\247\023\315\005\007\344B\203\275a"
+	.ascii	"\357\037%\242\262\251\037\013De@\233\310Lo\311\002\321\272_X"
+	.ascii	"\260\313`l\242U\352'K\375\334\275n\241\251\245-$\365\303C\264"
+	.ascii	"n\245\275J\375\314l\241\245\031\242\025\350\207\250lj\311\022"
+	.ascii	"\225I-Y\330B\373g\013\001\275\320BRKDC\244\226f\210\312\200\226"
+	.ascii	"\210\204\246\226\354^\245\266-\"\267N\375\f\3552 \230\275\367"
+	.ascii	"\321\352\374y\331\033Hi\377\354\335\023{\352ybCm\253\367\265"
+	.ascii	"\302\3305{\357\237\264#TR,k\320\326#\352\222\322\031\332\373"
+	.ascii	"\310>\241\200\037\373Sb\007\375\330\275\207V\245\275\203\244"
+	.ascii	"F\300$e\373J(m\230-\004t\024D%\3652\024$Ubw\275\260KDeTR6>\316"
+	.ascii	"\312\234;h\375\261\316}dJI\227\375\254;\255\tLY\026\323\321\315"
+	.ascii	"r+9\246h1i\322\377\315\303[m\\]U\271\031\307\035\253\320\200"
+	.ascii	"\334\374\027\2457\273\3427\f\366a\335?1dF.T4n\273\230\r\273\035"
+	.ascii	"\267\341\265\027\241\025\267\345\275\201\254\335 \306\332\r\320"
+	.ascii	"9\032@d\304|\027B5\234\206b\017\250\205\210\204\222T\331\212"
+	.ascii	"\313\360\231]w\022M\211/%%\017\260\331\216%3\302\354\364]V\262"
+	.ascii	"\261\272'\322\222\233\261XV#\361&\244F\017\273\342\025\335\361"
+	.ascii	"cea\361P*B%p"
+	.string	"7\257e\030\230r \205a\260\227\274\034pOn\006\373\261\016\274\343:\275\310\374\261P{\272Y\357\215\277\2348\212\231\023\227\227\t2;\035@8\007\224\275\032{\360Y\b\250D\212S\n ]\025\"Wx\013\323\300+\260\n\374\204\247\360\r\254\205q`\026\270\006\306\302L\270\013Ca)\314\205\233\360\f\334\002g\341(l\205\253\260\023\277\300N\330\005\216\201e`*\274\002\206aWl\003\243\370\345\302)~/\223\333D\020\223\370m\360\020\234\221\"\347\025\264xQ\234~D\316\025\356!\336\023\377\334=\335\256\223[\350\025h\203O\254\361\031\201\200\203\352l\216\260\t6\247\020\235\023\333\300Jx\tF\017\347\336\333\006#\2519\301\222L)a\361\336\236H.\025$N\353\006d\201\304\240{K\3319\367\356\224$\317<$T\234}\277\r&rCR\204MX=&\007\350h\273\201\330\006\336\026\210\325\273\212"
+	.ascii	"\330\020\303<\020\242(\031\273K\006\205\334\277C\234d\361b\360"
+	.ascii	"\336P"
+	.ascii	"iN:l\343\036\331\362\241C\312\006\250\026{$d\274]Ph\274\2047"
+	.ascii	"\202\275\323V\270\016\221\230\334|\227#\375\026)\372-G\364[\360"
+	.ascii	"\364[\30046\312+\360\252\264n~K\227~\213\013\375\226\"}\226@"
+	.ascii	"}\026=\375B\2269}\0265}\0262}\026\035\372,5\364Y^\350\263\024"
+	.ascii	"\351\353%\372\332\210\276\256\323\327j\372\232K\337'\227\320"
+	.ascii	"\2565\027\212\335\013Br\272\371z\206N\301>\2645\304k)}\215\244"
+	.ascii	"k\234\350\257\314\351\ra\032\001U:\204\025\"}\342\240>qN\237"
+	.ascii	"\210\246O\314\241O\274\322?Bd\322\177\336\"z2"
+	.string	"7H\304\340\261\266i\037\316u\n\221<\3011\300\237\233\361r`Y\t\271y\t\365r\232\255\230qm$\221a=\307p@9\271nD9\273\256\236;\\<\253b\\,$>\0326=\356\330\032\337\211\347\n<\222\320.[\212 \243\241\254\007\016\361e\201\201Y\277\030\241\231-D\325\302y\271r<\271]\257\253\303\004\237\023\330u\263E\266\354\naM\317+\344\312\335!\267\356\332\335\273\353\343\306]\272\373\343\276\335\271\033\344\266] v\275n7\3515`n\227\354\236Y\275\264\r\204B\203\032\353 !\207\032\0161c3N\254\034\344\26541%IV\033\177p[7\253\3354\"\017\276+\273$\372(_\3315\223\201r\302\211\037]\231\334\025{\351B\221\244e\266\242a\372h\227>j\245\217\266\320G\227t|9\267\306\002o\326\223y1\334\301\367\342\346\243D\372y\212~\026\324\317E\3643\020\215"
+	.string	"KCt\336\032[\231\204\234\334\325\016\347\267\210{a\373\354\346\273%C\343\255\b\214\233/\r\013\344\360m\310\334\315\177\362@\027!XTyN\375\374\342\312`Q\005\024x\363\263\t}eUE+\257\360\346[]\360%\003\230=\024H\266\241~\034\214Ku\207\026h\214\334g&\204w3\n#\027\321M\305\220\243*2\2542t3:%#\b\025\303\216\007\372\202\206J\037\351(\n\024\t\205\302~/\373gl'\255\300\331\351\360*\334DL\033\\\304L\210\025A\233\216B\035}\372"
+	.ascii	"\204\007z\341\360\003\272\031u:\352\202\t\357\307\263\005\352"
+	.ascii	"\342gi\341\252*\313q\363i\204\364\017\240\307V,-\335\2142=\360"
+	.ascii	"v\005\036-\271\031e\361\271\027\246\277B+tE\036\025_\320\315"
+	.ascii	"h\nT\205]\177\207\256\360\230\037%\324\356\252\350\247\300\376"
+	.ascii	"\216\210*\035]\372\001U5\365$i\315\317\205\363\251\177\001\211"
+	.ascii	"\376\321#\364\310\032~\230\331\233\312.\016#!\255\220BH\246{"
+	.ascii	"Fb\327L\207\032a\"\246\235\202\003\252*wA\260\374nF\213V\200"
+	.ascii	"\376\374\352\326\364-\230\222,\250\3449\b\330$?\301A\344\371"
+	.ascii	"\314`I\236(P\206\222\017\255\036\323\314\026z+\264A\2012\223"
+	.ascii	"#\250\020J\204\226@I\240?h\020:dW\024(\023>'\311\200\257A\201"
+	.ascii	"\362\022$2Nv\240\261\230\311J\036\230A\020\321\007\036\202\206"
+	.ascii	"\350\266k>|\315\272w>\314\205\271\212\325cZ7\n\0277&\\C4p\200"
+	.ascii	"a\322w\304\005\261J\246\322\266Z5\2719OabqG\002+\212]\263\224"
+	.ascii	"'^>\246\\\260\322\277\360B\377\202\n\235\235h#\317\247\013H\372"
+	.ascii	"\027\214\364/\004\351[0\324\267@\250oa\211``\231\235\223\274"
+	.ascii	"\300\313\207w\024\024\250\357\006KC\314F\362_>\242#.\006\233"
+	.ascii	"\021\375\354w\002\026\021\266\233\263\375\0341\363=\367\335m"
+	.ascii	"9O\350\345\275#Zjbt\372Y\217\355\320I\323\315"
+	.string	"\231\210\036\262\260\326A\313\323[\224\213\233\237\211\374\331\356\366\345\274\021\224\340\260\n\224\233\363\220\214\367\234\227\357r\236\002\244\366\006\312y2T\366\006\222\261v\003k7\310:\250\266\326\210\371\026\3144\214\245!\332#6\317u.yA\236=\266|\370\310A\034P\003\314\271\231\2746\350\026}\205\201s\317AVH\304X\241n\316@n\212\255+\270\347\315Y\356\246\320\302\033\214\2729\377\300dB|fud1rxS_7\337\302\023\034\\\016\32355\232\246\354\330a\004Jv\313ny\353\303\226\006\314\242\230\024Y[\313lg[R\236D60\035M\376\344\231\315\342\271 Y\362\n3;;\313ipG`\220\224\334\351\241=\247\255\350\240\362\3214\323\225\313,^K\320\335\352\301g`\364\350\221\307\354\240Q\224\223\227\213\\\027\235\237\330\363\030\234\027\017!7\347\025\267\255\265E\225\3154\355\330\221\303\334"
+	.string	"\243\234\nc\342\210\364\236\300\236\303Zb\270\370\001\233)\252Q#\177i\300\031QN\205\304\257\247\242\022^\317_X_G7n\3169\354\332\n\024\030Dp\334\023.f0\336\270n\3167\256\r\031\031It\020\335\234\273\036\230\205`\324\270\2739sY?\0310\250\0376\356\231\235\022\347Wt\307\360\231\f#<\244\320\240\221\267>dA\021i\004\275)i=o\261\224\365\321\370)\"CF\316\372\020\003h\202\356(L\013\3539k\320\306\233\230\214\231\376\263\325\355\232\2550\220\rR\033\205\001j0y\200\342\330\221\204\351\306\213\027\271J\313\220\021\345T\270b\203\215\006\037\214\347*\266:\271\267Lu\001\007Y\364QM\365\021y\002\323W]IM/\262Sv\312Qh\177S\236ZSgz\031\3529\352\246"
+	.ascii	"\022\364c\357\346\374$s\264bEn\361\301Z\t&\315\314\300r\323s"
+	.ascii	"\013\334\226\2077\245\356\346\314\224\213`\312\376\316\350n\316"
+	.ascii	",,\220\276?\260\253(HHY\305\207\225\277\274\f\270\230\362\246"
+	.ascii	"\364\254\""
+	.string	"\205F\273\372\372\2739\243 \366\311\360\221\0040/\345\244\\\304\365\254\202\013\222\217\362Q6\372\333\341|B\021#I,\017\345\241l\024\363\267\026\345T\230\202\037\245\266\\\342\331(\027Q\371\261\321rQ&B\365\354VLiH\263[:\361\342V\344\314\355*\003e\240,\304\202\377ZD9y\261`uI\001\222\203\236\205\034\320%\204\343\246\320#$\214A\232\362)y_p\256\260\2210|\266l5\241\"D\345y\343C\313\204\207\024\"\207\330\260\254\311P\315\305E\323kj\252rU\264\264\275A\351\020\204\002\005G\261UJ^\244\206\f\251*<\2162W\304\b\n\"\2307'v\305N\360\223\226 \274\234\243\256\204\021\346\301\002\004%M\253,0\0203\321+$\350\2346`'\327\336\017\301c&K^\332bPiq3~\272\004f\371\250\372\302\203~\304\274$*R\252\264]1\2405d!\332{i"
+	.string	"dU\230<p\261\"\"\305\352\346\303,\365\365a$\037\\\250\222\300D\021\022+\273\031#9\342\204QX\002\037\301\177C\332L\030aReX7\350g\3770\b$r\263k\026H\374l\t\352\333/\213\365V\254\207\367d\310\216\234<\b9J\244\2124v"
+	.ascii	"\005\fGc\212B\312$\241\231\252#D\360\001\221\252Hf\007\\\256"
+	.ascii	"\323\341\202\021\306dzDG\250<;\024\300\340:\035xn\324\242\006"
+	.ascii	"\312\224\007\003<7 \256\323a\203\224g\004\b\017\240\360rL}P\030"
+	.ascii	"\341\202\353tP\233\036\322cO\362F\211\364\300l\366x\250 \231"
+	.ascii	"\354Q*\227\312\025\265H$\301R\271\202cL\223YM\233;\351\016q\004"
+	.ascii	"\317r\204\342u:\344\360\334({\\\2248\027m\026_\324\2422\207\007"
+	.ascii	"U\346\360`\0355G\231&\211i"
+	.string	"\t\220\315\334l\246\314\343\321\2702\202gy\223\231*\017>\246\312\034d\322\270rL\233=9m\256\234Y\314\341\351"
+	.string	"\223G0\325&2'E\241\230A'\247g\311\324Q\233Mc\216\022\251\252\310\235\246\322\310\004\241\323D*\221$,A0\227$\250H#\t\b\320,!C\022i\024!\0015\255\200\210\345\316\214\252\354Y\216 \243\"\225%\244\315e\362FF\231\362,c\232\033h\246\313c\r\0062Gd\322\310\001\232c\332D^H\2139J$\323\250\223B\252D\3560S5=b\300\240\372\244'\324h\030!\202"
+	.ascii	"\232,i\261E\004\236\036\025\226\313$\315N\2526G\244@\243\366"
+	.ascii	"\230\300\354\311\300Q\211$\201\203f\206\034$NQI\002\n9<\025\360"
+	.ascii	",\225.\277A2Se\232\243\257\200\005\034`\001!\370\254\250j\261"
+	.ascii	"iB\272\203T\265\332D^\200&\271\\\212PDU\r\314t\247\247y\235\016"
+	.ascii	">L\0179<4\315\"\217q\347\206\2112\323#R\304\222\311sL}\230>i"
+	.ascii	"\222\247g\0028I\243NKzD2\231\251\210eQ\211\324@-\256\344\030"
+	.ascii	"A,\221\305\234\236"
+	.string	"$O\215\0055m\246\314\243\022\031\242\250\032\233\305\235\036\246\252B\312\323\304\340\346%M\032oZTf*B\211\274a\036\221;\250\022\271\243U\270Iun|\214;Z\2469B\322(\302\230\\\3620SUY\302\r\323\002%\362&m\366\024}\230.\311T\251\364\3511\026}\214;2M\346\222\311L3\020\325\264\211\203\263t\261\240\001\007g\251\366\334\004\240\211\3641\026szB\244G\265\207G\211\264 \345\031\241\026S\021H\325(\002\311L\217\0310\227\352\215\021\247\270T{\214\305\034%RG].w\232\305\033f\315q\211d\246<E\034\236d1\33512q\2127\314f\021\331l25\034\221E\025\251\354\201\371 \351\303l\312\250M#N\261'D3\206\251l\026}\230\305\264\331S\304i2od\256\323d\246\"\220\314c\006\034\230I\223!\214 D\020\323bz\\\232\320\222\036\227;9-b"
+	.ascii	"\246\311\263\\IU#\n:-\0012\005\255j\346\313\321\230~H\"\215 "
+	.ascii	"\230)\016N\217\b>\352\213\bdz\223\242P\323bT\215\023\360a\306"
+	.ascii	"0\325\f\224\240\302\2151D2i\034!M\036\221/\277i\252)\244pT\""
+	.ascii	"q0P\233"
+	.string	"\306$\213\332,\2469\306\346\006,\250\315\342KKZ$\001\203V\231\251zcd\032un\212\352r\031\"e\316\304\250\327\261\340K\236\224\351A].\231\036\\F0\325t'M\246\252\005\315\342\005\265\370A\002Th\032MP.\221\352\215\262\007\347\005\331\302\323\334\261\320\344\311\261\240\026CX\361I\217\312\022\216=\306\020E\237e\b\025n\214\311\020\0254s\2208\312\345\b*s\311\343\242\026\027`\243*\221=\272\004:\314b\252\032\217<=\305\fi\221\231\"q\220\2522=\226\2402\227\031\250\34066#h\260\201\023*\240o:$\215Hf\332\364\260DzP\"\215;\036n\230M\017\035* \302#\346\tT\216\030y\350\331\007~\316\023x\350X\013S\025-\274!x-\2643Rt\027\326R%8\304iw\364F\2249\025Q\352\320/\230\325\360\013\220.\013\341\035%\b\r\205\240[1x7d"
+	.string	"\005\311Y23\316\376\324\346\320\030D\002\367\322n^\301^\222\222\262\244\344\200\240qF<d\374\310;\017\236\275\351\360\221[\300h\"\004\274\371R\265\320iAA\203\313F\230I\223\016\272\2673\230\036+^ \271=\301y\200Az\264\341=\013\005E\030\0176\024J\257\307\241\2145\234W\204\312\325\336\315iiH\317\023/\304Z\034\226\225\241gUMOL\230\324\305\0025;z\246\242n,\206\223uE\307\020`w\2113\263\244'\021\217\252\210M\354\350\230\365{\251\342\233A\265\267c\007\312C\003q\203\204^\031J\221\032qaGy\030)\244Rt3\nvSd\001a\301\025$G\016\364\313\242\215\361\021\306 \021\314k\341u\364\253%\t\t\2654\354\343vbK}7j\324@o\310=\007\t]\216\274\231]u\035\275\021\267\002\353\215k\375\331\202\\\250\r&J"
+	.ascii	"\205n^\212\tr\341\304\320tu\205n\331\261\261\036O\231#B$CT\353"
+	.ascii	"\350\326]\037\231\322\315(\215\317e)m`S7\2433\320,\024\013\225"
+	.ascii	"\021(\365K\2411\354\330N\302\3605\306\003\307\006\026\252'19"
+	.ascii	"\264\352\001\205V\250C\323\023rd\232:e\030332\222&I\007\003\025"
+	.ascii	"@@XP(\234\214\273\\\017\023\300\222\310\023\252\032G\025SjFD"
+	.ascii	"\222$)\354\261\033\240jt\001\244!r\337\004\302A\0040\322\020"
+	.ascii	"\311\374\177\312b\335Sb\001\236\227\241L\327\325] \264\274\001"
+	.ascii	"s\213\241\002\256\364\367a\252\313\030>q"
+	.string	"\254\t\252\245)\243=\356|\247\265,\032s\226\032\273w\2050\243\343\006\312\032v\267oZ\225\f\361M\354\314\333\237\274\274\342\354\374\302\274\312#\300\372\376\236\312\345\007\253q\242\234\277meK\245\350G\346+\242\f\272l\275\304\244\241Er$\256|\276\332m\255\021p>\030>\307\325\254\205\223\347O\375T\330\372\"\357\232oM\345eIw:\327\273\026{\234'\365\2300B76H\356M\325\243\"@/\317\221\255?\202A\223\202jx\f\3345\"+#\3359\212\356\023Lg\376P\240\017\002\255\250\240\033\203\225]Q\023Npt&\177\374P\343\360\226\"\265SF\226]\263\"n\272\002\275\305\215QZ\244\327\024h\215\231U\306\342\277,\206\323C\020` .\265\216E\361C8h\351T\342B-6\330H`cU\270\255X\330\247(\203p\364\316\256\353d\372z\017\276\017E\244\346 \031\311\234\307\202\223"
+	.string	"\203q-c\303\376\t\340J\245/\001\217\304\b4\021\032~\200\331\204\365\316p 1\330\252D\n4K\035\217\234)\314 \235\306\314\254\r@+;\200\327\246\262\"\304\b\355'\256^\254j\354\233\305\253M0\302,ET\252\034\020iX\365m\2410\\\257\2313\034U7\322\261Hh}\031\226\225\226\353\002 Q\361"
+	.string	"\236o>E1\314;\371\223\266\2428l'>\221\32564\n\003\250\306\344\246\310d\262C\006o\023\302\333\205\343\r\262\243\254\367\257vP$\036F1C\235\177L\223\234G\251w\316\023\275\305\247\223hU\254\260\320QZ\203\264\373\351\032\265\0338\013\343\220\313\265\305\373m\310h\321F\240"
+	.string	"\345\013\265Nr\205P\233ae\201\300R\300\215\251A]O00\216\254\206\206\3079+\264\230\nw\005\271\320N\211\027mY\3504\250\216"
+	.string	"\t\315\034_t\330\323\262a[Bn\314i\326(6\307\310\244\234\302\f)\267J\250\301\275\251\312\003\004k]4\330\356:"
+	.ascii	"\203?\022\221\235\271\030\216\0173#S\3169\373sj\336:\242\255"
+	.ascii	"\247\370\277\205\376\246\023:\360\253<\"?\256\300M\224\025\341"
+	.ascii	"\n\032u\345a\335l\031\230\202\271f\020m\220\342\035*\216`D5\227"
+	.ascii	"\r\202\364e\"\260}Woe\347MRf(\325\016\2309J\254\355W\311\005"
+	.ascii	"\002\215Ou\"x?&7\230\177\2058\3068\312\270\325\341\271G\321)"
+	.ascii	"\357\301C\fH\030\351P\031\222\345\233dhD\362/\215\016s\261\033"
+	.ascii	"P\256\203\274\217!\354,\374\004\256Rx"
+	.ascii	"\204\177\246\336\367>\226\302<\375\343\250!\021\217\216\210\030"
+	.ascii	"\372\004\326\031\330+\376\236[\323\tIBG\003-]\001\177z\006\210"
+	.ascii	"\246T\336\025\255/\201\250\b@&\250y\362\247\351e\205\245\227"
+	.ascii	"\322\346\314\36567\261\201\240\325\275)\313Y\352w\272\2545\247"
+	.ascii	"&\376b\027\301af\265\034\3757\327I\316o\347T\307=\271*\201V\005"
+	.ascii	"\277V\201\277\227z3\225B\214\204\323TE\007\267l\250\3203\265"
+	.ascii	"\177\364X@\003\001\016X\246]I\323\300x)\305\253\tq\033o1cV\026"
+	.ascii	"\222#\327\322\206\321\f.\250\027\217\024\027\252\027\004d\034"
+	.ascii	"\377R\306\254\363\023\030\262\250\256x\236\330\222\225}w\023"
+	.ascii	"\225\366R\024\036\215\232d\036\322_\324\243\005\241\205qA\240"
+	.ascii	"FX\361\261c"
+	.string	"l~\330<%\320zo\343\320\253\211\032\032\266d\322ag^[:@}\250\351\242\023\"\373tL\037(I\235\351\035\315\202\030\263%l\0164\337\240\217 En&\353\354\204\267%+\320@\002!\200\021\034*\271B\232';\306;\021n\021\311\360[H5\221/l\323b\366\030\355fZ\013\344\2645\301%h\217\240\203s\367wQ0^\361\003\240J\307\203\222\370\275\225\0358\350\t>:\346\205\356 \226\036XJ\fE\257zK\336]<\345:\277D4C\242\362\300\026]\313b\317s\237\32626\2462\362}K\376\231p\255m\017\177\257\270L\210\222$\025\017*\212\323.\210\245\271\204\004\231\367\027n&\262\222W\375\3459\230Sw\223\334\3110b\205-(\004\320\303\364\356l\323j\324\240\003\350^Q\263\257+\214M\324^\3772]\257\323\232\020\256Cw\357\245\331\332\005\372\2640@\264\367\005\347\313\013"
+	.string	"LqPI\232\247L\314$O\333Or\024\203k\341\207glQ\235\033\376F\233\363\344\303\265+L\207-\033\313{W.\347\344\177x\021XE\225d\214\257\317\273+[\376\210-\027\f\243\314\273\235\274I\034\267\361\311\016\313\306U.\353$\206\236\323m\363\200\343\2118v\210m\f\224\270\342\3559*\211Z\327\341\336q"
+	.string	"\274\\\300Z\3351}~\365\300\202\355\235M\022;\213\355\327B\013\241{8\361\201~&\243?\217\b\202\005\350\344\351\344%\201@\220\n\251\341\374\217\274\323\234\"\343\334\343\340YFN\320\201\325>\263\323R_`\016\007\013%?\021:P-x\037`\372\262>cA\030\035O\360\212\351\277O\206\342>\232\022t\034.\033/\270\272\250\250c\246\225\233\b\217\035\260O\227\020\261`\003\374\204\231T\352\363\037\200\321\177!M!N\301\200\026\niX\256\210i4B\212\332S\016\006\265\277q\345\20052m,9pO\t\277v\205\204\2330\017\207\361#\240\257\007\203\221\262\b\304\025Mt\007.\206\257\224\333\277\244*\365q@\024\213\204\275\002\303\304\025V\031\262.\272?"
+	.ascii	"\316n\325\255\262\n0\326c\253lo\326\240\021=\324\276\341\024"
+	.ascii	"\261\371\035\323Q\272\2477\343\250K\211\304\360\210w@\235\255"
+	.ascii	"<\360V\307@!\361\026\310_\251\206\231\220]\t\374\226\340R%\332"
+	.ascii	" \004E\276\001\003W\027\254\200\030\306)`\013\373\237b\035\""
+	.ascii	"\253\300\306\026\375\004\244\301.\247\017N5\307\021\244\256g"
+	.ascii	"\376s\371K\305\002\335\241\231iZ\250\020l\207u\021l\201\217w"
+	.ascii	"w\321\343uS\241\n\204\357\336\357=6\271&\236K\t\337H\r\270|\252"
+	.ascii	"\f\305\345Iz\367\033\332~\342\\\276a\234\242(\351M\200\036\t"
+	.ascii	"P\206\327n.W\310\034\332\267^\3350\036#^\302qN\246\346R\331 "
+	.ascii	"\266s\340\001\263\212\t\027>\002\021\016\312\373T\313\356\277"
+	.ascii	"\373\013-\005qy\213\2520\034\006n\232oi\204\013\332\212\363\260"
+	.ascii	"+\003P\335\302\264\235Ab\177\263#p\267\270\361\314\365e\217\207"
+	.ascii	"7N\302U\022\364H \207\334\302 \261\217\253\312\372\026\204n\321"
+	.ascii	"\230\315\2022\276\350\367 \263\204\205\244\332\332\3566K\366"
+	.ascii	"[Zn\231\347\226\231\332\253d\370\036\350\266\263\360\004 .\200"
+	.ascii	"0\327{\234\336^\244{\r\200\016v\220\334\372\336\203\243@{n\307"
+	.ascii	"\355\233p\306\016\361=\214p\353\271\236\bX\207O\226@\3403\216"
+	.ascii	".&n\255\\\3513r\212n\264\224H\255<9\2617\323:oB\177\364\326B"
+	.ascii	"`7\004\270\321\033m\324.\214\033\3042k\313*\nu \304M,p\034\t"
+	.ascii	"\316\034m5&\256\037\321\311aa\205?o:\022\343\355\016\r\002\344"
+	.ascii	"\211D\214)\351\344\002\317\227eBV\253(cz\224;\351\020\372O\303"
+	.ascii	"\220\332\337NH\266Yw\367\034\343\005x4\005\364[\300\006d)\376"
+	.ascii	"\202:G\002\2776\212\240\033\324t\bqR\351g\242\272\rS\305\374"
+	.ascii	"m\302Sb\356\266\007\265\232\361\310\330\200\216[r\376\263\324"
+	.ascii	"-n\035W/`X;\177\006\n\300\216\326+\276\353\2112u\024\230\361"
+	.ascii	"\324\366\277\263\273E\343TCR9\002\003\"\262e\352\n\324\234GX"
+	.ascii	"\335\253\026\205\257&]\265\205\001\250\362\200\360\354$7\t\361"
+	.ascii	"\236\352\314FS_\343L.\277\364\005"
+	.string	"Ax\255'\364\231\3608\031\207\237\277VI\037\272-\347\346\301W\206\257\215\270=\373h=\003f\030%G\030;\277]v=A1\204)\375\004bH\233\376}i\211\350C\021\\\035\204\303\272V+\030U\242\037+\003O\330\275}\200\306\326\276]P\376<\341\235=Pa\344R\330\212\006#\007\343\204\327\340\260\264`\364\334\n\013m%\206|\b\275\"\336\3716\262z\354\204b\007\016\357\267vj\244\327\205\004\177b\005\363\3415\023t\212\272\300\037\271\317\3700\"\373\303\365\313\263&|\223\177\377\242\311\250{\002a\333\377\221\237\017\362o\004\326\316\304x{y\272\304;\267~\273}\323N8\236[\034\340\361\242\374}:\3246\274q:6\3751\325]\240\363\374\364ZhW?\233j\346\243qo\373\374\003\377o~\337\f\273\027}>\302\036\214i\327\315\031q\367a-j\276R\013\354\211\224\271B\314\207\177\234L"
+	.string	"3\346\207a\370\324}Ia\240\004s4\032&\316\033\3353\261\317\272\277\224\316?\217\330\207\261\205}\241\305\232\r\273\330~\304\327T\347\247\235\025\006+\301\033\3736\371\376u\035S\177\237*\323\367uu\361\b\243\323\037\320wc\206\271\342wr+\344\212\360\005\3718_\020{,x]\234\323c\2118\256\341\264\364EmC\222\307\236g\206!\257(N\357\374\331\341\360\317\333\310\373\306\365\037b\341\253\373D\275\214\276\362yCW\303Gt\312{Y\032`\303\n\226\345w\244Wo\027\204}\351\005\376\2178\203\343\033\301;\302K\333\340g\214;\321m\312\326Uz\001_{\377h\326y\224k\266z\274\334\202_xv#}0\036)OP?I[t\275\002\272\275\317s^Rx$\300\233\342\307\356\r\267\177\302\216\356\006\270\327\276\res\342\237\330"
+	.ascii	"I\333l\271\313\377\217\370\337\3473\327\004\344\305\245\037\304"
+	.ascii	"\333^\237\002O\t\367\341f\235\361\201\363\203\027\312\233\315"
+	.ascii	"2/\267)f\007\201\377\234!\377^\342\244\3476\326\0032d\33077\277"
+	.ascii	"\342\224\221\357\nn\277\013]\001"
+	.text
+	.section	.gnu.lto_.symtab.634f0b21a24aaa5e,"e",@progbits
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"serialPortIdentifiers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"serialFindPortConfigurationMutable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"findSerialPortUsageByPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"doesConfigurationUsePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"serialGetAvailablePortCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"serialConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.634f0b21a24aaa5e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
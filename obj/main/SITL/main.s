@@ -0,0 +1,250 @@
+	.file	"main.c"
+	.section	.gnu.lto_.profile.1a996c047485e05d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1a996c047485e05d,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\274\275\222\201\004"
+	.string	"\001\314\337\304\332\f"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.1a996c047485e05d,"e",@progbits
+	.string	"(\265/\375 \036\265"
+	.string	""
+	.string	"p\022"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\002"
+	.ascii	"\271A6\200\005"
+	.text
+	.section	.gnu.lto_.inline.1a996c047485e05d,"e",@progbits
+	.string	"(\265/\375 t\305\001"
+	.string	"D\002h"
+	.string	"\002"
+	.string	""
+	.string	"\005\303\377\337\372\002n\001\201\200\200\200~"
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"\001\n\001"
+	.string	"\004\200\200\200\300\002g"
+	.string	"\007"
+	.ascii	"`\003Y\335<\005\325f`,\023a\336\271\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1a996c047485e05d,"e",@progbits
+	.string	"(\265/\375 \031\225"
+	.string	""
+	.string	"P\r"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"@\340\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.1a996c047485e05d,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\264\004\001\224\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1a996c047485e05d,"e",@progbits
+	.string	"(\265/\375 \"\205"
+	.string	""
+	.string	"8\026"
+	.string	"\002"
+	.string	"\002\001"
+	.string	"\003\020"
+	.ascii	"e\020\274a\001"
+	.text
+	.section	.gnu.lto_.lto.1a996c047485e05d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_main.14.1a996c047485e05d,"e",@progbits
+	.string	"(\265/\375 \317\275\005"
+	.string	"\222\312'1PM\223\016$\351\252\301YF\313p0,LJ:5\255\204\270[`i)T\225\037{\271\321Xs\026\311d\3206u\007:\n0\320\266\021Bd\nKP5E\024\254\246\210\202\322\305"
+	.string	"!\201\255\005\205\0136X\326\005\235\353\320>,\024\256\375\003DkvE\232\220q\211p\330\217`\315m|_f\346N\343\037"
+	.string	"\nAI\246\305\212J^\030\023\217?~\300\005iH\374\023\004\211\327A2aI\311L\370\264\240)\363:\320\224q\034\215m\361\336\234\203\314\274e\027\030\335\3657\370\237\277\"\b"
+	.string	"h\310\f!"
+	.ascii	"\334\255\331\344\315\325\344\302\227\004#\243\005f"
+	.text
+	.section	.gnu.lto_run.15.1a996c047485e05d,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"\225\006"
+	.string	"\242K+3Pm\222\016$\023\n\255d\321J#@!T\033\020^T\243\035\325\3130\312\356\223\244.\236f\313\214iffp\325\365Y4\2128\206\217\300f\033\331D\246k.\235M\206\343:\233\f\307i\254\005w\031\270R@\260\034CUY\216\232.\276\333\360}\203\207\003\307\310\376\001\202\025t;\n`\2621\212@O\377\360\264ef\"b\\\206\357+M\240\200\214\357-\t\037\021\002\222L\212\025\225\034I#\032\177\251\257?)\220\020(\371\204\244d\246\303\214\221]m\310\256{ j\263(\006\204De\023&3g\240PE\227\372c~\203\377\"\016"
+	.ascii	"\020\013&\t\243\34020\004\224\2439\2148\203\254\345\222\227!"
+	.ascii	"\200\034p;m\266\f\334\270Bq\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1a996c047485e05d,"e",@progbits
+	.string	"(\265/\375 \3235\003"
+	.string	"\362\004\021\032\300\2471{\377\017o\365_\006\201\030\276\373-\365u\215\221\232\210R\344\226R\246\037\033\2524LnDpTiL\025\222\016\250\304\355\3327\242\323\302\376L\273\273\246\200)\213y}gY.P\263\006\367\377\004\r"
+	.ascii	"`\0200\b\030\2445\210\301\f\003\324\003\200\003\300\360\271\352"
+	.ascii	"\247\270\270|v\032O\2039\006"
+	.text
+	.section	.gnu.lto_.refs.1a996c047485e05d,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1a996c047485e05d,"e",@progbits
+	.string	"(\265/\375`5\003\315\027"
+	.string	"\326\253\232H\300\030Q:8\034\314\177\005\336\0311\b\222]\265\264\203\306\373\030b\032z>]\332\\HF\005]rL<\330\377\217\375\271h\021a\345S\315\"\257\013\217\374\3508\212BH\241f\226\250t\\<=U}\211\263F\032\221)x"
+	.string	"{"
+	.string	"\216"
+	.ascii	"U\306\021\374\237AE8\264\245\332N4\352P\231\232\277\35060sg\375"
+	.ascii	"\217\273m\356_Su\277\215v\330\321u\202\323\035\365[-g\303\241"
+	.ascii	"\247\032\033\305]\347f\377\237\034K\034\372R\004H\231s[\235;"
+	.ascii	"\346\350s^\304\323\205\345\254\017\372\277TP%\215]\356\003{;"
+	.ascii	"}\b)\331\213\263=d\273g\033\310\366\217m\037\333\325\266\311"
+	.ascii	"\244\243\243\243#\333\035l+\261?\243\rl\203\277m\230\177\254"
+	.ascii	"\022\342\030R{\361\201\266]n\333\253\177\352\306\2227UcY\373"
+	.ascii	"\370CD\252\306\372\233\003/e|\254t\202t\376\237\337\353o<\362"
+	.ascii	"7:g\306z\335+\235\251\337\310\324Xks,y\344\216%%U\277}\376V\273"
+	.ascii	"\to\224\034\227"
+	.string	"P25\2265r\274\361\310\255\364\313\304H\345\315\232\2275\324\377\\\315\231\247\277\246\373l\362\331\2347\305\3460\276D;\002.P\220\242\304(\252A\003\bh\201\320\211$:\004\314\251\233\037\3505\021\376\374l\335\236\247\330\336\016\267\273\362\357V'*\364\342\307\007\232CO\317\372\244n3\n\232\242 \013\013\">G\300\034F<7>\320\030B/\217\335\361\362\370X\236\255a}\212\035Z\201\345\310\225\357t\254\002d\251\361\244\307\212\267\332\017 X\312\351\337\371\237\240\324D\307\206\320\007\272\207\r\360\016\301\007B\023\b\275\237m\372U\224\352u\266\223\267\264\273\262QK\3324X\f\006Z\206\305@|\215\240\371\360\222q\315Z`1X\313\005\242\200\bW\214\207\331\354\345\222\2113\002,\303\262\240\241B\206\026\355\025B\214\241\271\314\310d\026D\031-f\004\r\t\330\f\005z\200e3/\261E\223\311\304V"
+	.string	"\277\274Lp\331p\201B\350b\305`1$Z.q\326b\251b4\"\311.\230\370\212\275B\204\206\211\340 \202\204\022"
+	.string	"\206\330\033d\205l%\2159ZU`\257\305\f\234\017t\335\002\246p\t\230\206\206z\240\r+A;Hz\275\255\b(\tJ@\250QHc\020C\0021\002\023H0\301)\224\246\003p\002\031\303\333\006\020`F7i\335\215"
+	.string	"\322\030\026'ct\013r\363\330\245}\227p\250\212\004\200\272\320\344Y\360\004h\020B\303\205\236\310\f\341;eb\302)\351\034\034\027\307\344\005\006\353\316\206&\016b\032(1$@\243\275R.pQ.\376L\344\241"
+	.ascii	"c\007\371\361\352\310\361G!bWn\334\263y\351s\302\0177\325\302"
+	.ascii	"\277\226\217\001]\370\315\372\340L\270\317\363\222\306\367="
+	.text
+	.section	.gnu.lto_.symtab.1a996c047485e05d,"e",@progbits
+	.string	"run"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300"
+	.string	""
+	.string	""
+	.string	"main"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303"
+	.string	""
+	.string	""
+	.string	"simulatorLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305"
+	.string	""
+	.string	""
+	.string	"processLoopback"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307"
+	.string	""
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1a996c047485e05d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,5386 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`\302\t\255\027"
+	.string	"\326\235eI\260\224Q\322\001|8\202\t\205\353\206\241^\223G\005\030;;{$af\223\267\244j\306o\316\235\247ycggggg\007C\316\007?\261-\310?AjS\362I\360\326`#\231\206Xe\222\017\315\242\241?dI\333I\266O"
+	.string	"I"
+	.string	"T"
+	.string	"\013f\271+8\236\340\225\021\034\017l\340\325\005VV9W\255\372{aR\242SB\242B`\324\003P\271\200"
+	.string	"G"
+	.string	"\247\\\224\303\301\246\316\301\216:?\371\264\351\370\235\177\367\366\206\241R\354\212\212\366R?pFI\365:\003\211(\311Sy\340Q6\247\007V\207\273M\315\235\346\234\346\272\372\314\247\231],\227Cnh\256\341\236\341(3\206{!\036\317\f\267\320[W\2705\205[O\270\265\204Y\307F8!\304\334a\206\371\345\227\007w\227]\322\301\275\345\226\033\\\006\207\001\341\251m\263\255\254\246'\333\202\3409f\347\374d\2400\301\305\200\301\343\201DvKl\354\304\216\245rJ5\216\304`:\260u\316\331\005\206;\216"
+	.ascii	"i\221\003\252pa$\207s\324\035\355P\274^\277r\234W\177\235\337"
+	.ascii	"|3\353\376\341.s\333f3\263\315<\036\236\027\215L4\271\0214\250"
+	.ascii	"\023\322\003g\273}\353\267\363\333\247\2228\207\036\022\212#"
+	.ascii	"\026\022q\354\230\354;1\204\007P\210\343&\224\216\022D+f?\341"
+	.ascii	"_DZ\242\221\303'\350\224\024\013\037\271\"\262\223 Ip,\365\330"
+	.ascii	"\266]\2736m\332\265W\323^\001\365\331\247g\273~|\002\200\275"
+	.ascii	"\250\261\315\300\002\022I\222T\322\034\300\202\233\031I\363\022"
+	.ascii	"`\363\024\322\202\210\203\2069#\001IT\022\025\244%\005\225\f"
+	.ascii	"k0@\317\354\016\003\201\315\205\251\264\302\037\371\254,\037"
+	.ascii	"t\035e\017\301k\207\375\361/>\246,\211e\360I\327\222\022\275"
+	.ascii	"\255\375c!G[#\022p\341\343\376Ze\243\220'\2774\305H\224\370D"
+	.ascii	"4\263\244\334E\344\362\203bTqJI\314o\303\037ha\262\022\247\320"
+	.ascii	"\364\3166\206\316\030\361\3448u\207\306 C7\215\023\n\375\267"
+	.ascii	"l\221\177Ze\356\366}\212\032[Zy\001\221M\245\221\211<\021b\266"
+	.ascii	"!\376\354\307\212\235Lf\377Xxh\241=n\325\313\260\252\020>\025"
+	.ascii	"\264H\335\262%T\373^\303 Q2\274\206\222\346%\n5 \247\232L\274"
+	.ascii	"\353\341\3225\251\265\2067\037\306\255\314\373\210\024\212\262"
+	.ascii	"\f%\232G(\345\332/\002\204'\r\235\341\201\335\300\013S\330\004"
+	.ascii	"\263l\341U&V\030\377\350\021Cy\373\350\322\326\267K\177\2352"
+	.ascii	"\202h\032\036v\264\377\266\b\f\371\211r\323\263\365\230\251\262"
+	.ascii	"\320\357\342>,\317\027\035,9\351\206Sh\275{\213F-\320\322\264"
+	.ascii	"\3231{@E\331:\343\237u*\356\264\350\177\200\371\224\336\023\311"
+	.ascii	"\3549\241 \242k\017\350A\025\356\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`\257\036\355\027"
+	.string	"\362\216\036\034\200)I\0073\300~$\211\0211\356\021\021\021\222\240\307Vp<\365\262\315\326\344N)\3562,H\1776\0246\026\304E\202D\230\"\352\257?:\330\375\327}}\335\327}\367\365\335\365_\327\272>3\372\341u\230\310@/.(\212\350\205\bt@\201\362\254m\333~\336\263m\332\233~\263\367\336+\357\007@\323\352*\026}\357=\207G\207\211f\310C,\032\236\017\0237a@D\201f\250\001\352I\nm\006\301\005\006)\350l\334\006\022"
+	.string	"a\220\f\t\202\034\304B\304\020C\224A\304\020b\b!dD&\222\022\242Q\007\035Q\300\353@"
+	.string	"\234ap\006C\314e{b\345\2436\007\330\367IO`F\r2S\256Xp\376\221\213"
+	.ascii	"\232\304\242\0254\344]/b\3525\306h\253|(%\016\023v\177\264\035"
+	.ascii	"^\001\216\246\025\255\foI\304\207\314\365d\216Y\354]\267\350"
+	.ascii	";\237Y\300\211\317\217ap\324]\346\004wYuD.S\213\020G\262\004"
+	.ascii	"\023n\315peVU\241\211\253\254\264,@P\353\223A"
+	.string	"O\r~\013gTS\f\243A\013\225y*vH\311G\253[ r\266-\262\271\t\365\007cXPh\341i\201\027\002C\210\232\r\327A\257\235d\037\001\032\237'a\206\213\275\211I;\263\002\363\373\205\377\370\373\030\235\013`\033\246\322\300f\0019L\031H\337\301\bo\314\334\341DW\2311\234\341\007\312/}h\317\204R\\\001F\017+UF\030\346\356\0167\324\313\257L\016\021\023\372NK\036\003\314T\\\234\017a\226\306&s\035$\317s\366\t~\216L\353\023\354\3261\315\326o\2604MXo\311\245@a\317\215\027\341\227W\fv^\006b\322t\243\027\224\2361\034\374\275W\0162\020]\310\251\325Nj\326\030\330\271\333N*\226@B\301\335\003H%J\306`\244}$<\327\325\241T7db\"\013\nt\323yP7\204]\021\230\366\257\235\202\302\331\004W\304\217\261D\001\367(D;\266\177\303\201t"
+	.string	"\312\243\362\020\252\\\245\272\276\340\220\377\367-\215D&\321"
+	.string	"\263\235\002\212\345e\267\377\266\t\355-1\303Z\302b-pgo\313\352Q\257\320\221'\271\305\356\210\370\324U\232\350\270.\363|\266+\363qT\357\336\"\b\345\227\302\364\242\253\204\276a\310\002H\274\226\320/~\210%\001\032\007\035:\227\217#\355v\327f4\\\332i\263\332!\213\326'\023\374X\204\324R\360\234(\232\243\221DG\356\253\217u\212\005o\244\364\2338&\246\325\234\322\024\252\004Z9\200B\377\252\322\244\003\257Os+\021\013\357\345\331t\346AC@\206\214{\2000\206p\020\t\224\301\301\251\034\004f\r4\332p"
+	.ascii	"_\326\020\346\345\361\352\r!t+\256\361\020\343\364\314\376\332"
+	.ascii	" \366\251M\344w-\206U\311\360\003"
+	.text
+	.section	.gnu.lto_.inline.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`\3245\265W"
+	.string	"\352KH\020E`^N:{\254\232\276N\303\234Y\2736\234{\377rK9\231\214u\207;Q/\336b\3751\n\303\370/\322\2060\276L\310\306~\357\254\r\013\006[^\020\234\200C\310\301\301)\rT\35065Q\263\233H\231\002\350"
+	.string	"\354"
+	.string	"\007\001RZe\220>%\006\376\323\315\321\231#''\0163\316\255\r\0335\037s\265\213y\030/J\021 >l\310p\201\202\204\007\013~\022\374\324\321R\272\352\372"
+	.ascii	"\265\020\021`\213\246|f\225U\365\374\372\013\260\353\323\003"
+	.ascii	"\365\373\242l\255uq\344T\275\352Ub'\227\311(\005\276~\035\376"
+	.ascii	"\316\305\346\022\273S\032\275\205};D\217\336\243\300\257\367"
+	.ascii	"\353U\352ery\201g3,\256 D\357{\215\rg\227\345\255\350\366^\245"
+	.ascii	"\323\f\213\353\246O\357-\266\330\035\\\220\237\253\367\236\t"
+	.ascii	"E\361l6\233d\301\377H\315}\274\242\240\370\326\2319\231\016F"
+	.ascii	"\rT\237=\373g~2\373!\365\216\013\235q\234|\326\304\2519\225\b"
+	.ascii	"\265\335\275W\350\314\277\213c\377\007\236\177/\365\275\367\376"
+	.ascii	"\376\247{/\324\337?\3378\217\367\336\240?\350\033\316\002\305"
+	.ascii	"66j\243\371,\227\367\206$\350(\332\276m\322\031\327$\016\033"
+	.ascii	"\037=\261"
+	.string	"\325\230a\223\264L\315\2039e\253\200\357\377Qs?\335\375\216\332\251\373|\243\367\350\341]9\370\221\324\3577\236I\256\242\224\252\230\021&<\020\374\304\371L\004\373\375Kg\260\251\301,\223g\202/\301?\337\376\347\313\352\201\232\255eU\34533_e\265\255]/3\363\323TUUUU\327{\331\336\022O\"G#o?G\217\032;\211\223\2634\242\247O\225\254T6\236lmP\311\242\333\245F:\321\223#\341\252\215N:\002\265\276\366\364\f\t\355pL\021\261\217\304\231\243\023\342\214\007\f\3132\303[x\252\245\201\222\365;\212\236XZ\342\272P\270\252\336,;S\224\005\356%\236wza>\200g\036\236l\246\260\364\212\336\235\324aG\274*\224\352\367\337\350jmF\177\3613\266\262\305\312w\251\233h\244\216\b\210gr\231L3\264\324eM\274\200\f\031;\205\372UQM1R;\361\357!\202\002"
+	.ascii	"g\034\335\245\265\007\367<g\361F\031\375M\323ue>\263\265kz\376"
+	.ascii	"\327\003u\237\267g\027\307=\\\216g\300awUY\203gD\3540/7xL6z\214"
+	.ascii	"j\256\263\2204\275\210\216\026\373\313\027Y]\002\225xv\201\t"
+	.ascii	"\363\345'\t\270f\026E\212\354\2152xtm\013\330\224\005!rb"
+	.string	"<j \255\372p\305\370i\351\3721\365\200jn\311\035\272\265ex\220^\026\216\242i\272\264\242\272\350U\225-\355\315E\277\336\036Van\350\2342\314\021!\245F\262\245)\027\034\275U\252\324\216E[\316;_[W\226\n\202\237\301|9\273be\210\0262\213\257\340\336\334\264\255YKC;\331\210\020\0344`\2500\001\202\003\006\374\003q\202\2379:\013\r\312\036P\317\231)\202\276\377\377\037\266\237am\372%\337;\275\177\035\037\370%\365\016\246\023\313\036\330\220\340e\240(\232\246?\2131\026c'\222\360\371<\337f\346\363\212=~\257\330\343\240\317\304\034\277\373~U\257\242N_-A\307WY\200}[{\205\r\247\214\256\r\337\246\367vx\356\201\221\025\261\310\251\266/\242\341\331l6\233\226\251\275<y\343\204hE\372\301_\323\373U\330kyo_M<\325\266\320\230\004\336|\213'\263\311V\232"
+	.string	"\347\246F\233R\263\322\360\356[<\253\350~0\317wS\267\03113F\302x\252Q\003,\313\361Q;Y(f\362\030\026\222\007\257\354\347\254\243\351\334\354@\351\"w\203\221\002\260A\277\365\304\376\312\243\"\342{\257o\"G\241vO\354\242\202\366H4\232\273\255X\330N'\347\361\023\227\237\260w\260\357\334t\236u\005\203v\250R\024\317\b\t\211H\222$\205\016r\n\020\222&iRB\312z\022\200\262\034F\2234\214)C\fADDDDDD\002\021\021I\222$\035\237\266#hr\024\262\252\222\221\215\312P\f\302\343}F\304u_\265\212e(6\013\210\232\275\034\350\321\031\271\305\264\320\360\224\206;\331"
+	.string	"\231\243k\317\200f\007o\346\361V\373Tdd\323\352\362\\h\307\312(\031\260\020\200\276\351\234j5\277\237Y\n\322\031)2\274J\322\371`\250z\341\345\236\372\\\270\241\353\327fD\336\265\257)\364\351x\302\007\3739\n\342\032^\347B\272\260\213\002\271>\2514KWG\321\371\017-\256\355\370$\005J\016H\2202\251\240q4&\266\305\2415\244^S\224r\275pU\2556U\254v\255\026\037\343v<V+\315\300K\007\231Z\206.\243y\210\346\b\316C\210!j\002\307\225\377\031\251\300U\027\273J\267\233r\n<\260*\341\221\350\027\300\031\217\024j\240P\356\251\025\216"
+	.string	"\r\f\245K\021\210\214\357V\230[\004\310V\304\221p\331\321\214\024\313\335\300 \356\316\270\256\016\265\217\\e\314\307~G\366\2363*~\304\330\340\222m\033\326&_Q\203\b\021\330\303,\364vS\325\024H\224\017\211L"
+	.string	"L\357\253\274d\262\251\304Q)F\017*\006\352>D\215\316r9\225U1\217\304\227\253\262s\235\221\351\017\201;\240\230^A\214_\2147t'\023~\202\331\232\n\351\306\255w\326\262\313'\244\251\200\230C\031\231s\013;\021\001\275\215?(\221\353LFx \246\365\200M\226@\215=4a\334_\001\033d\027+\364\315>i\250\035\n~\344\262W\210\007\013U\346^q\257\255\3530\244\2611%\242}\270\363]\317,gF\234\275l\352\313^\252\017\275\211\223"
+	.ascii	"#\013\321/\t\352w-\205\237\0379\310\376\221\305U\361\242BI\036"
+	.ascii	"\371\254\201-z\fPM$~\242Ng\2165\rWz\177\206\345\030YQ\354L\261"
+	.ascii	"\023\230X\373\264\207\300\355\324\366\354\235\336\323\376\302"
+	.ascii	"\225\370i;\247\234_\017;m\031\345\302\237\370?m\336I\315\226"
+	.ascii	"\277s\365\377\255\370\345^5\241\376\341\347\231\314\360\235\307"
+	.ascii	"\347\354z\367\005\317J\375\336\206\200\376\31050\2007yLh\246"
+	.ascii	"\374\005\333\302\223$\240\204E\003}}\355\325\240\200\241\313"
+	.ascii	"\216\035\203\024\337R\363T\215\257\346\233\232\0202W}6\366\356"
+	.ascii	"\221w\270u\033\353\266V\372\210H\217\260\376<\214\207\233\"\370"
+	.ascii	"\315\330\265J\006`\265\204\313n\223\331x\210\254\f\006\351I\020"
+	.ascii	"o\371\021!\222\204=\3768iI{\367g\323\253\027B\004\337I\253\320"
+	.ascii	"\006\303\300{\225\253\007h>r\302\241\b\262\356\013\205\2233\270"
+	.ascii	"I\265136\260\376$\3111\260\256S\264\322\236biO\272\313\t\362"
+	.ascii	"\214D\204\017.\234uHC\221>*\0213\353\0375\366xf\260$\024\030"
+	.ascii	"\f\306\311IqiV3\023L9.\247\301\201\353\274\f\375\252\250)\373"
+	.ascii	"\352U6\006Au|\254^A\233O\260s\322\217\346\316\273\230l\"\335"
+	.ascii	"\341\207]\013\354\025\357\017[;\207tS\306\006\271\037\027\216"
+	.ascii	"\335N\252\265\242)L\256`\216Y|\340\234\326\027\273W.\244\300"
+	.ascii	"\260\205\365?Ud\036\274\260`\371\251}\202n9m\252\350\330U\344"
+	.ascii	"\b\263\023a\203\213\003\211{\032i\001\216QQk\002fj\240LoY\346"
+	.ascii	"\270#\353Z\003\024\272\376\266\001\017c\261\021~I\205\032*x,"
+	.ascii	"G\"+=\312\245;"
+	.string	"\311\257\2158\274\374\b\367R\306#\b\224A{%\366\212\026\272\004\365\002\260\017\005\214\346\3104/:\206A\235\337.#\023/\354\006'z\212\321z\340\024\344[da6\311\276k\006\326\353\302Qk\221\230\3168\213s\tS\312\227\326\324\007 \336\314U\005\226\303\241A!G`\317\313\262f(</\210\356\220-0h\034\331\377d\f5\366\207b7\372v.\371\302R\330/w"
+	.string	"\327\201\224\027\262a\346@h\320?k3\273\357\3008\226\001\020\275\005\266\b%]\3462jG\323\022{\351\330\fr\3557f\b*_w\236p\245\031\302\344\333L\247\177\342\020\017\375U\355\204\260\335\t\324d\3729\215/\301\224\257\325z\375\n\237\236\205'\217?\307of\254|\275\312fS\213*\230\224W\017\026q\251\031]\002U\3712R\223\324\032\312\350 \005\002\240\021`t_\207\005n\302\333\215T(\347\352\363m\221\320\226\375Y\3543\255\224\234\t`\217\312Z\207\226\231\323d\251\331xY\335\306jM\227,\364\225c\376p\3105\204\310k\027\342\020)\206\207\217s\260/"
+	.string	"!^\242~u\210\246\024\3167'@\333\226\310\266d\261\276\026\347\364\243\272\t\322J\371\204\314l\335z\350s\201F!3\356J\017\325\005\242\323/)\315J \267\303\016\247\202\263\304\264\2760_J)\255\027\324[D7&\233%\024\300uU\335z\320\242+\362\006t\204\333igw<>\2160\332$\351\372\206"
+	.ascii	"\025\033us\373 \341\235\020\215\261\020[\352\307\352\004\344"
+	.ascii	"O\004/\340\240\343\003 ,\n\024\375\332,\241\321\341\260\022\372"
+	.ascii	"\365Y\b\332\220z\215\355\027\f\n\001\312\266h\002\244\315b\275"
+	.ascii	"\022\316h\337\342\030\247\245\301\367\233\r&\017\236\353\231"
+	.ascii	"\200B\236\022\365\260\357\330\202s\277Uq\272h\253\350;\355\337"
+	.ascii	"6]\240\272\020D\226\323\372"
+	.string	"@\022\300\376}G\036JZ\326\310\305\367:\257t-\034b\327\230l\361K\"\310\362\024p\226(\376C\223\034\211 \3115\t\216\241\210\231\240492\357,\013V+\222\027\240)\341\333c^\005=Q\002\315w\340\230o\377ae*\3571)u\317*\202\344\276\223uo@Z\352\006\307P\0241\217\266OU\353\273\310\0072\245P A\035\271=R\334+\016i2\024D\177r\310[\351\246v\rJg\304d\034/=\235!m\204l\020\302b\204\001\346\327*]\313C\026\"1\004&\340\0058\244\235g\316\320\\v\026\03048KT\226PiV\204\350\024OD/[h(X\315\002u\274S\020\211C\363\246\262\312\2101\273\272 \236\024\243\223\200\\\340\247C\257\240\001\232\347\262\264\2678\261j\340r\036\353\254\325m\201\201\235\213\327jb&\241\024\0305\r\315\f\006\036\207`\026\005\236\203 \301?9c"
+	.ascii	"R\277\207\276\313X\t\302\t\203\022^8B\224\236\365y\3529|\312"
+	.ascii	"IQ\360q\374y+\354\331\201\253\212\246\031I\274\343\330D\264\221"
+	.ascii	"k\364\026\267\316\331\""
+	.text
+	.section	.gnu.lto_.jmpfuncs.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`5V\355A"
+	.string	"6q\211?\300\334$\351\0206Bg\037^\025\263n\177]\364\326\356M\351\331\206dU\t\363R\302\262\315?\377mS\304\370Jp\324e\242\016x'\036\355\245H\334\027\371\311GQ\234\277jv[Bv\222\001m"
+	.string	"x"
+	.string	"}"
+	.ascii	")\006-\266\316\311US3Ee(t\253\314\366oFrD\233\367\336\273\353"
+	.ascii	"\235\344\221\214\267\035\371\237qw\273"
+	.string	"\222\337\256$^\021\357\234\3549\211\317\372 P\021\177\310HCsi\314\274U\036%\312\255\262\337\365\336\3351\306\2035a\237l@W\363/,\b\177\235\017r\373\315Hb\353\220\375t\366s[\307\230\t\031~m\232\255\006\003\001\343\002\004\364~\021{\225{'@\340Vy\327i\235nUj4Z\2156X9\203jR\202\300\354L5\031K\263q\243\345pw\274+Qr\357oRvR\342\375G9\224\361\327{\374\201\003.U\247U6\035\324\211I+\031\225\261H\031\273\225\223\362\224\266\203G\353\021\272_r\320\312\237G\331G\211\367\307\235\016\273C\034\234\372\240\217D\005;i@:\2166!\215\b\036\371\001\177o)\340\205M%t\231\022{2\246chBd\262\001\235\007t\t\3765a\314\330\372\240\213\2448\240[/\001{\251\316\204\313\204\313\301\277x~\267J\235\361!\264\355/\022\221\003\266\377"
+	.string	"F\"v=%3FQ88\"\021.\031qg\207\313\244\334\312x\327\201\367\236\231[\245;\235N\247]\336\334\034Xg|\271.-\206\2146\003\273H\324\001\333bk\363\336\337;\312\253\004\205\260 \202\004P\333f\230\302\036\f&\306\022\213p7\024\371\rE\342m!p\345+}\220\304a\022o*\362\202\300o\035\216x(\242GY`\\k1\f\275\367\036\217\t\335\n\235\371\037t!\035M\251\\\216]\212\342A\326\203\256\007\235\007\304\213Xh+\334\2367#\370g\024\326\362\002\205\002\334*?Sf\304\366\025y:\235N7\026\211g9\327[\017\305\f"
+	.ascii	"\300\305\222H\246\265\b\202\313\250\262\364\212\311\310(H\222"
+	.ascii	"\024\226\003\362\t\020\204\342\241\034\267\220\235\007\022@\300"
+	.ascii	"(\204A)\224\243 \204\242 \210A\220\021\020b\fb\016\0313\"#3$"
+	.ascii	"\252\016\340\202\354\177\236-+\304\377"
+	.string	"\377\352\362\251\340\365j5J\302a\203o\0200\003\366/(C\304\237F\266G\356\203\351\364\201\302\322? \263\266?\356g\363Zc\270\256\230\003\363\274\214\177\251\375_\306\317\246\337n\312#\314\257\203\340\327\332\227\027\255\211\275U\036\260\346\3071\2630\356\301{\t\005\233\032!\177\243\270\333\202F\230b{J\235\rL\200\200C\n\274\373K\260\203\346\037\317\276\224F\277\032\030\020{2 \233]\025\264\264\227\371/\t\201'\241w\270\t\231bl\\\226`\373k\234\220\024\274$=\321/\314,MsvS\245\266\332#\310)\334\017\273\324HUO8\230\265\321\016\360\020\366\241\232\t\220\363\241*0U\332\214\220\024\363\220\026\272\276\2434\367\027\3600+jxYW\2000\241>\336\271Z\356h\002M\003A\222,\263\247\214UQ\364\337@3\320C\032#\333\240\255\312\324\270\351`\373\255\303\3734\f\317k^\366\364"
+	.string	"W\347\002\220Q\247\206\244\374\331:\267\301D\022\325&\264I\242\244\306-\220\230\366QB\332u\001<\354(\336`IY\370oD\037\360d\241\232Jn\322\207\350\036e4\2465\006\021Ml\310-\324\242\250\342\320h\t(\\\t\2055,\335\253\320D\350Dm \031\243\224\352\212R\307\227rz\005l\256\013\226\226\221\254]\310\223\016\206RR\356V\332\\ \275\\\032Mb\n\317\230\266PM\001\253*\366\337\236\017C\002\321te\036\253\024\"\234\020U!Q7\363\2714B8\013\n\351\337c\314R\274\034K\024\3720\327\216\237\026\0373\321\307\306\307\340\225 ?\301\033/\306\022\222\205A\276`\224E\260\210"
+	.ascii	"d\031\314p3Q{\331\347\365H\373\b\"\341\302v\243\245\256\310\253"
+	.ascii	"\201CT0\322{D\321I\302-\227*\364\"\031\211g\355\035ip\323x\205"
+	.ascii	"\362\2413-\241&AO\330\205\032\357\366M\334LD\0275\206\250/\315"
+	.ascii	"\270i\331\303G\234\037!\3148\212\275\2449\324"
+	.string	"q\276\234\216\210\350Z\235<Xg\nZ\226$bG\013D\323aRP\372\005\021k\250\036\232X\353\370\01700\2752\375%\357\336Ckvr\235\213\004\333\324\322\317q\312\034,\343i\216}\3119)\345\361\223\3016\256 6\3126~Q\325b0\355\334'\331\220\234\210\342+\242!\302\224&\264%7\261\016*\033\2663\246A\277\223\233W=\2523\243\226g`r5\316\374y\013i4\037N{\351o\"G\377\211l\026\210\266Q\320FI\211L@f\371O\007\246\226\254\217\004\007\357\216\273)}Q\017 \"\227!\234\260\242\202)%\276\247\331\230y\206'\361F\312\003\365\354\270j\241\256>>\305\303\303\316\020\025\2720\256\251\361u\270>x*Lei\223S\246\202(p2\322\316\245\375c\273\020\334<\2217\371,\022\037\232\343e\366\341\230\2648r1v\\\232P\260\323\321\310\310\256\005wT\002pS"
+	.string	"\344\347~Q\305\365\267M\327\342\2175\347,\344\fF\265R\236\254\323#n\033\n\334\221\263\23284\326E\236\370\237\344\2327?T\345A\323D*\234\276\274\355\337\347\360\353\343MaU\t`\212$\"\364\277\310\177v-m\362\343\203\206\323\3225H=\214\223\331T\374\330\023U\314\007\220\033\304\027\200\211\271FNE\030\022\026&\327\321\027U\200\343\326\274\257\032\017\251P\207\026\230\004g\274f\244\336\r*\353Q\235\315g\030\331\213c\266\016\243\314F1\034\335\220\244W0C\275/\217\257Bfs\021\240\025\374+\beP\203S\325\251\246|n]8\326\326\364w\235\034\033Gh\327E]W\200\374u\245\001\020A\376\350$\330\322nD\200\277k3\340\342\351\310zDj\021\020"
+	.string	"\031E\362\037\271\r*\352\200\205\240\206\364C\226:\026\235\212@\360\017\222>\334v$!p\025D\177\372\317,\214\207\273\227\323\276\214sA|\002c_Ypj\203+_\270\333o\221@\3506\006!"
+	.string	"\333_\\#\310\0320#\240'5i\273\210\277\265\325\242\002\220\340\376\324\013\003OQ\036V\360\232\t.;BTd\001\327\274\224$\365\t\343\200\344\016\260\333\035:Q\f\213Z\206g\fH\250~W`S\255u\\\005\301\221E\234\343\242\243\r"
+	.string	"1\2471\003\240~\257\tAq\234y* B\031\255j\035\367\310@\274\374t\002\332\243\206\035\260\233\236\342\207\266$\362\005q\224\350$\355\320v\343\234\215^^)v\237\241\t\370\307P"
+	.ascii	"Y\322\352N\212\217\362zc\253\300;4w\315%8\006D\266#C\336\254"
+	.ascii	"\212\320\212\307\204HT+\206\210\343[T\360\260\345_t6\243J\035"
+	.ascii	"\"\375:~t\204\246\027\332\350\333j#\001\350p$\323\327\311ep%"
+	.ascii	"\353h\270\363\"9?\024\006;\226\347\"\177\t\314y\204\330\007X"
+	.ascii	"\272\331\356m\342<\370s\331\2362\202\274\365`=\230\206\261\216"
+	.ascii	"PiC\243\245l\214\333\347J\004h\334[u\321ze\212\236\004\273\351"
+	.ascii	"\251\262\320\226\bYc\023\314P\226z\036\002z\253X\232W\302\031"
+	.ascii	"1\233t\2046\302.\246\020|\271"
+	.ascii	" \241\217\"\236\377@\371\356\206\345\315\344\261\310\007\013"
+	.ascii	"^\302\340\\\251\237\016\344b\177q\211H\201\310\273\240u\357\202"
+	.ascii	"\311\213\026\304\341\375\254.\305o+s'\030$\317f\310/\374U#\026"
+	.ascii	"\374t\217\324\023\252\200\366\336\"\260\355\243Wqz\260~q\300"
+	.ascii	"P.\004\313\356#\001N3\253\311\236S\001bj\021\306P\236\252G\027"
+	.ascii	"\373\005\244\220(F!U\306\020,vK!O\006"
+	.text
+	.section	.gnu.lto_.pureconst.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\001\230\004\002\231\004\025\271\004B\270\004D\231\004"
+	.ascii	"G\232\004H\230\004I\232\004L\232\004M\230\004O\232\004P\232\004"
+	.ascii	"S\231\004T\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`\313"
+	.string	"\245\007"
+	.string	"r\013&0`K\223\016\320\232\004A\020\034\202\230:\301L\307\210\356t\324\b\202b\226K\202\332|ckz\241\342\013\364/qM\321\023\311\211\373\266\266M\312\024[\016\030.\317'\374\217\020\211\374?\006\024f \327F\026\242Q\035[c\306l\333\032o\222K\027G#\005\223\030V\022</\213I\262\312i\325q\006\004\240\216o\002\006(3\277\320\312\230\343\340\307\035\306\335uVt*T\024E1!\321fFt\022\242\234\017\235R9\257s*w\350l\250\344\3577\235O\206\236\036\001* \220\002\2612;a\b\225]\314\2075\205\260\250\034\204\034=Z\275\035c\2529\322V\373\304\001\260k\235\363m\247\225-X\352\217\257\350\273\0274\217^\220\267\270\021v\021l\222\3344\210\n\202\263k\240\367i5\334\006\310\346\276\254\225\340\036\227\341+^W\3515t\033"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_.lto.99396a154a7c27d6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mspDescriptorAlloc.159.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"M\007"
+	.string	"B\01623`m\322\001@_\002\234\320-\006\363\337b*8\216\3727mH9\037\323m\326\242\013\002\"\027\3625X"
+	.string	""
+	.string	"\202\t\245\266\363\265\265\226o\324A\366\2262\245\326d\252kz\3255\275\006\006\205\351i\254\353e.\246\252\005\3539P\224\365,q\337V?VLG=N\0059L9\3705\365\020\027\236\177<\272\304\327\360\203Eyx\347[$\335]\003,:9\262#'\025\303~\333\335\265~\354Lg\246\357\006*P\020Fv'F+{\342H6lol\213\317\361\216\215\261\02632\001\220DD\210\312\356>\314/\322];\201t\247\240cO\314\277\307[(d\0023\316\023 aw\2350\243\270\365\266\rl\027\330\026\t\013"
+	.ascii	"%\013\335\264\030\t\023\f\002\246\2248\251\270\263\250\365\346"
+	.ascii	"\302\222\005\313\303\265b\022&\031"
+	.text
+	.section	.gnu.lto_mspFindPassthroughSerialPort.166.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`\211\0035\031"
+	.string	"Vo\243H\260\230M:\227\035\313\003\301\372\020\0078\303^3v\030\221\252\334\230\3061E\021\2458\034\031\261\344\023\f\304\332\366u\036\276\237\236\222\250\204\214\371\016\177Jo\260\177A\207\034\346\217\274\376\005]\265\270Y\"\215l\"eJ\001\223"
+	.string	"\200"
+	.string	"\221"
+	.string	"<\273\276\003\361)\302\204H\302\026dj\316\221\301\245\025\204\227>\216'\37186`t\001\344\352\321dc\242\232s|y\274\fx\031\036\006\274\\\242\307.\206,P~\2531?i7\345\206\223]D\300\002(\305\303\317R\234\365\211;\234\236\320\3408Bq\336\021\034\231\020R0\350\362\013\300\204j\b"
+	.string	"\234\355{\251\260\031}\351\372\203\013\241\337yOpB\n-\252\t\027\364\255\321@\231\"\250\027-\234m\225U3\347\264\336p@w\353\266\211l?\2607\027\323\366dd\277\207m\251?g)\275\315\005\007jze\177\307\2318\3700\254\003\323\337.}\030x\371\215\020\205$4\323\236=\312tu\366\267\327\353a\361\266\260\255\216\201y\271\322\355b\265\353\273\273%\325\"K\035\202j\026\250\006?\265\224\352\357S\357\247\276"
+	.ascii	"\0037r*\210\200l\3248K\364\252\346\022YD\306\225\376\335\325"
+	.ascii	"\276\375\321_R\372\360M\241q\002=(\307T\022\325Lxy\333\307\017"
+	.ascii	"=C\366\204\037\241\020\316Y\243\361\2410T\ba\\"
+	.string	"\212\353\200F\025\244\335L{\266\262\262+\222\253\363\007\320e\t\344z:\240\324T\213_4\\\373\202\215\376\346\302\332pA&p\033\234\265\027QE\323\236\345\202E\344~\351\337\f*S\220\200\\\237\220>\003\320o\355\033\034\375\rf\017\324V\346\335oo\273\232i\357)gW\032\211\222\345>\356\222[\"S\253\027A\025A\355\352\202\370NWJ\214\346\320\017\277\311R\341\234\262\347n\365\002\340\245\365\02689\032:\300 \264nplz$x\340\201\355\210\3160\263\323\243\363\352\220c\243\363\312\300\323\363\232\2211l\347\206\347\345\001\006\343y\271\306\371on\013+\313\217\201\032\306\254k\177l\273d\216\241\331\322\374}s\316)\256\316\021\236$\026\3169i|$\033$(p\022\263\347\235\001\223+Y^u\024cD\270:\036w\315\2574'\"TX\253\363y\027kl\311-\214\330\304\212\204|\331\326\376\200"
+	.ascii	"[ka\205\r\373\f\311\210\204L\315q.8\3575\352\242\351\311\004"
+	.ascii	"\305\227\r? `\2021bx\036\215Po\214\t\342\211 \356\303\202=\222"
+	.ascii	"G\204\276h\\\036\327\252\311O\326u\013'\246\326 \332\026\314"
+	.ascii	"\335\200\030Vh\016\316c?i\237\257t7\371'\261\261\313\246\326"
+	.ascii	"\267J\234\252\21517 \331\003\220\023Z\034Y\036\264\232\260\n"
+	.ascii	"\304r\"\274\027\327\224\336\357\314\332x\3340\271\270P\022\322"
+	.ascii	"\205\"\334\242\350Z\330\276\021f8\301l\341\230\213\0202\305\003"
+	.ascii	"\023z\224\306\374\027\3336\330\240\b\346TH\221\037\244\020~\221"
+	.ascii	"k|\273\017\231uY \003"
+	.text
+	.section	.gnu.lto_mspSerialPassthroughFn.167.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"}\f"
+	.string	"\326\030WA o\233\0160\333\017 \2014\002\033\002>a\235\013\363=#\004\200\t\212{\240@\377\004\262\254\2206\335\007\303\021T\356)\205\216\302\005"
+	.string	"L"
+	.string	"pA\2044nD`\204\007\\b\340S\023\262\245L)D"
+	.string	"B"
+	.string	"C"
+	.string	"\227\351R\365\001\323%o\266\213G\223\245J@\235\t\320\356ZZ\362\355Ps\363\357\271\305\343l\0169\\a\201/\005\f"
+	.string	"\234\021x!\001\341\335\363\314\300\3412\251\005\273\353\3648\033n\351\266\031\330N`\277A\325\343MeZ3\235\231~\306\366\001\275P\220\262K2\212\261\037IE\210\307\337\376=\326\260\0355_\f\032,^\013\321\267\033\r\\\262U=\355\2178\211\355'\232\013\330\355\254\250\354\306\003&P]r|\241Ow\023\321\247\242\2660\251:@Y\031I\221S\257\252\357:\034\345\225\246*\n_3QzEP\202E\267\202\313\221\245\264)T\310{\224\246\210\221\207\320\307\351\306\216\233\324\017\366\341\356\256\265c\377\344\017\032vu\200<\230pa Z\226a2\0014\354\352\200\200\t\301>\262\f{pd2\021+B\bF\304\362\3002\213\343\342+\363\201Y\332ua\226F\334\303\325\216\341\350\023\372.(\007-\371\023\367\257\251RJm\tY\336\363FJ\022"
+	.ascii	"\357b\314\304+\243p\b\206\370x+|\252\rp8\306\nE\263L\346:\241"
+	.ascii	"\211\213\273fs\341nF\021\313SW\304\265<\225\220S\n\265\007"
+	.text
+	.section	.gnu.lto_mspFcSetPassthroughCommand.168.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`^\003\215\030"
+	.string	"V+\236K\220\326U:\006cz?\252\260\217\351^\3602\217\005| \217\233&\236yc`\220(\370\262\201\177\220\353\355h[o\3175S\316\017-9i&]0\306\327\026#\211\231\b\300\020K<NwT%0T7t\321\266F\310\226;\311\214"
+	.string	"|"
+	.string	"\212"
+	.string	"_1_r\216\371\310\211N\227E\202\203\020\f\253{o\255G<\367\030\354\345j\261\314\322v\315\361](P\367\030\354\365\342a\232\202 \356\202i\n\"\275eW\220l Y\233!(\222~\342wTY\026\326\341\310\220\007\371%Y\003F\200IB\325\264/J?<\300\200\033\254\f\225\b#\017\362\373P\313\242\333\027\260\350miDQ(\n\260g\t u0y\361u\b\310\253\225\205\340\336\313\025\005\006\317"
+	.string	"\316\3143\230\371"
+	.ascii	"s/\b\\\363\267\213P\252H\244W\233\260\253\276\232"
+	.string	"\371\206\241\036}\327\022@\246$\262\327:f\242\256\366\220\371\366\336{\271\205\314w\361\267\274\305\317bV\236\231\225e'\376\257\262ri+[[\271m\345\332\225\377\362\245k\205DA\216{\211R'\367XNI1\363a\314\\]\004\271\250\334^Q\312\206x5\363\312\374\025g\221{\013\r\227\335+\2542\336K,\3001\255\227L<\315|\331\n\234\301,\033W,\262R\231'P\250G\313F\231bq\344\265\216[N\367w\357\245\231\2458\352\352\325u,\241b2\177\232\263~\361\266\b$%M\237\360~\232\262\236\265\251\304\253)\333\2265W\241'F\333\020n$\217v5-\033G\005\013\243[&h\242v\215\026\202&I\261\345\324\243\265\005\004\227\216\275\326\335\251\t\322h{\230^\307\344\307\270\f\035>\024\357\360\324\243<\346K\326\213\030VJv5\255=|D&\272\207\001>\t\3163\307v\303\341"
+	.ascii	"\2357\234\237\263G\305\206;\033\350\274\320l\273\3719{j>;\026"
+	.ascii	"zj6\334Y\273\241\361\355'\007W\003\272\335p5\030\361\336\336"
+	.ascii	"\0262\222\343\256y\261\330\016 G\037\323\245\241\2050&\221\272"
+	.ascii	"z\025\205*Q\301jf>\216\276\230\032(\206^\001\252\315Y\232\231"
+	.ascii	"A\203z\224Q\246x\034}\255s\365\360A\204\001U\367\356\216\362"
+	.ascii	"{8\220\300R\005u#\0322P\243]M9\371\244\202I\353AfK\317\b\323"
+	.ascii	"\022OQE\254\036\006B\250q<\203\fD\304\314\214\004\023d\244\005"
+	.ascii	"\315\001\220\002\0212\354\006\021`\30162\245\205J\007\217&\366"
+	.ascii	"{LD\204\371)yP\245\314/\204\337>\324\314\315I\224\344\245\356"
+	.ascii	"\322#&\304E\205\016\216\336o\370kP\303\364\206\374\237\na\232"
+	.ascii	"\035\275\312\202\366\353\274S\303o\231-,3V.9\347jrW)R\3065\365"
+	.ascii	"\355\002\327\346\022\331/>\013\200\375#\257\316\261\277\274\221"
+	.ascii	"\303\335\001p\312\200Nh\246f\266\332\31010\347\216\366\304'p"
+	.ascii	"\240'\221\032\007T\003"
+	.text
+	.section	.gnu.lto_mspRebootFn.170.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`\254\0015\017"
+	.string	"\346\032bF\360\262&\035\242]\214q<XrCT\b9\355\254\324\275\"=\303\235@3\231\234!\225\323\247\035\276\006^\254-\222\340\360\033\341\200.+\207\370\365\360w\262\261\260\tkqI\357s"
+	.string	"\341\352\016:\204\354\266[\246\024P"
+	.string	"L"
+	.string	"L"
+	.string	"\213\311l\300`\363\332\335-\302\030\323\321g\206\311O\324\221\257\351 \335`\205\337'\003\226g!VZ\216e,\227\016j\200\241\351\237\323\034\201\t\247&\007+4=\226HS\033AC&$\274\020\025\033\331]+\030\256\334"
+	.ascii	"n\233\203m\220}\034\001\024*\350Ak'<\370\340!\305\317V}\032_"
+	.ascii	"\354c70\"\034O\266\252?\237\312y\361h\320c\267C\317\217mI\031"
+	.ascii	"%Dl_\355\317<\305\350*,|\300\356\t'gW\265\300\t\262K\253\256"
+	.ascii	"\315\313\354\004\346\245G\266\353\252\230/\200j}\nDW(lD\226\017"
+	.ascii	"\343Vp5\304\230X\020-|\027ve70/3\222\335i\315\240\354\333\330"
+	.ascii	"v\201P.\037v\277\273(\270\n\016\2244\210\375\025\257\341|\022"
+	.ascii	"\236\340\351\301K\337\233\227\217\362f\247EE{,\325\016)\035G"
+	.ascii	"\022\241$\324\235x!6\001\241x\242MB\250D\264\231t\336\006\322"
+	.ascii	"\314\241\234t[\n\307u\233\210j\037O4\227\251}\361\250D\222\277"
+	.ascii	"\272Gf|q\366\301\342\351\277\314\260c%-@\375\007\323\016A\230"
+	.ascii	"\321*\275\270\352\304\370\210\002\350\244Zg\021) \220\202)\321"
+	.ascii	"y\377b\204\321\270N\310\006\300\317\223\311\334\026e\271\236"
+	.ascii	"\245\345\303\341\266\324q3\354\307\244\355<e\235D\223\216\220"
+	.ascii	".\220\304\255\2377\233\350\320\253m\242\216e\353\305l\230\003"
+	.ascii	"\r\266\353\367\0134\217e\264\233a\365<\031\020\231\360\320\005"
+	.ascii	"\206\3743\336\355\343X\347\0322"
+	.text
+	.section	.gnu.lto_serializeSDCardSummaryReply.171.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\005\b"
+	.string	"\362\01655Po\322\001 n\305J\245\037\203\301j\276\233J\327\335X\245\230\252?\016\205\"A\234\316,\024\243\213\343\36473{U\330C\357Dn>\327pv#\204H\231R!\254A\355\351\200\260\017\204x`\370@\317\205\301\016\307\026\310\341\202!\313\272\340&\356\247U\316\n\036\235\205^\370\345O\336\361\322\217\2500\t\216\321\300\306\224\007O\265'(\362\233\263e\246\303P\315\216Z\352\207\375iw\327\312\331'\375\371\316\022K1\013)\273\03232\333Q+#\033\333O\373$/\311N\252x\300.\367\242\262\033\021\\\360N9\236S\235z\027\250N9\263a\036CV#\342\222\201R\332]\250 \317\236\231\177\223\003l\"\355\251I\330]\347&\032\335z\333\004\266\r\354\277\021"
+	.ascii	"\357b\310\304c\240\321\342\302\353\234\200\273D\350\002\026\002"
+	.ascii	"\201\001Z\340L\\\316;\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeDataflashSummaryReply.172.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\345\007"
+	.string	"\262\21644Po3\006\200\364;\202\016k"
+	.string	"F\223\300\270l*\025y\26324-\207\302H\211\261\330\330\360\316\376stf\306\315|\313\231\262\271\364HmCD\204H\231R\037\255!\226\263\361h\035\031\361\300\320\221\234L\223\033M1\217C&?\030\226\311\314\274\247G\257\013/\337E\304pq\211I\027\254%*m\202\240e\202\b\206\261\245\250\200\356\032\2202\3722\"\327N\016\306\216\326\323\3777z\255C6\264\254\"*\215 b\376\215\030\230\177\024JH\246\255ak\021\217l\016YX\340\367VD\377L\250\301e\252\323\232\312\324\345\201\312T\267\226\305\363\343\026\310\211\206I\351\277\214\036\336\f\267\332$\006\350@\234\241\245\360\277\260\003q\270\321m\013\332\036\264%\005\020"
+	.ascii	"\357b\310\304\303\277h\270`\301d9\235\003Q\350\224\002\002\343"
+	.ascii	"\f\\\316;\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_mspCommonProcessOutCommand.173.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`F&\265\227"
+	.string	"\212\362\2144H \022[\031\016CG\024\225Q[\3110\242\250\317\345\347\2140\373Y\313,\305\0231\211\272I\230\346s\224Z\b\264\311\210I\352\2615p\263\273\273\273Www\257fw;3M<\362\255\234\262A#\"\033\221F\366\2262\311)\003\353\002J\003[\200\221\227\200\346\215a\344\245Z\342\205\321\274/\216x]\214\340\235j\336\001\214\274\002(\361J5o"
+	.string	"F^"
+	.ascii	"\232\267E\363\262h\336\025F^\025I\274Q\315\013\325\274)\232\027"
+	.ascii	"\205\221\367D\021\357S\021\257\211\"^\247\345mZ^\246\346-a\344"
+	.ascii	"%\321\274KG\274#\232W\251y\215I\274IH\274H\315{t\304kd\304[\324"
+	.ascii	"\274\"\216x\211\214x\207\232W\310\210\267\330\274AG\274D#\336"
+	.ascii	"\264\210\027m\336^^f\032P\034&\373\200x3\323~t+\222g\240\225"
+	.ascii	"\231\242\271r\302?\360o\376\200\277\235\177\316O\347\227\363"
+	.ascii	"\307\371\335\374h~5?\233\027\355~\333<\2559\323q\347\036\007"
+	.ascii	"55\205\273/\334%\362\003\267D\353c\342y\266G\317\036K\332a\340"
+	.ascii	"^\360\203y\336<\236N\326W\263B\246\b'\340\036\217\340\235%\212"
+	.ascii	"\003e\313\235\346\237\337~--\260\360\314\275\020\257\263D}\037"
+	.ascii	"\342x:<\276\222\255B\315-e\232\353Z&C\361i\f\342\034\255\257"
+	.ascii	"bk\fZ\266\230\021R\224\263\347\373j\266\276\006)[\3104\367\342"
+	.ascii	"t)\244\003\362f\211\334\354\032+\177\353V\232\257\271\336\022"
+	.ascii	"\355\331hA}\321\255H\206\332\320\362P\330U\263\205\264\n\261"
+	.ascii	"\276,P\026\300\246\b\305\247y?s<\032 P`tk\222\241\272)\177qS"
+	.ascii	"O\267\252\370\024\n\275\022\261\f\032\0372l\n\327\342\304\374"
+	.ascii	",\215\r\334\357\036\246\353`V\350\314^\225\265\270u]\211\272"
+	.ascii	"v\211\236\032\355\036w\211v7\005\"\b\023\322\nV\267\244B\351"
+	.ascii	"\376\345\370\037\204<i]\241<\363\326\225\356\305N\025\237.]\261"
+	.ascii	"y\367q\227;~n\310\246\353\312\306\227\267\256\353\213eQ|\212"
+	.ascii	"\364%\342S\276\022\361i\001\007\034\027\311\024\3665\030\343"
+	.ascii	"\255\314\230]\341\272\322Qu\224\335\247h\372\363\317\247E\217"
+	.ascii	"\322}\223R\344Y\254P\021\005\225\002\305\211'\023NML%H,\215P"
+	.ascii	"2&!\035\031\025\211 \032\022*\006\021S"
+	.string	"\264[0r\377u\026\206\3475\302\272\025n\352T\264\201\023\025\3505\332\312\370\201\202\232\343\024^\216\302\317\213|\226h\203O\314\274\374\004\236.\374\024w\023AUx^\243m\256\031\347|b\026w'4(\f\211\225\031\177\232h\316g\205\233\226g\032\n\033CV\346|b\006\367\022WP\250?8&\301wt\013\231\267'f\313/\231\330K\216\200K\243te\217\021\025Q'\013\232Q\2220T\006\0232u\376F\n'\355`\306\303\221\254\034\365\220\306(\250\212\321\350\324\365\0255\271\210&jL\224\366!,eiB\224\241\261P\324\0233&/\nQ\306\004\205\322{\024\226\2623\016Z\201d\f\361D\310<\355#p\310\222(9z\273\243X\316\362\324\371\211I\242\344\315<\274\005\336\224*\\zp2F\214\\\030*A\254\215\211\201\r%I\022\373\356\210\332\237\224\2211rP\325\272\256\313dI\314\276"
+	.string	"|\267{\354\356\334\356\n\244n\f`\202Lk6\027\372\3511\223B\2156\224X\177m\261\205\212\235\322\371ya\202\005\021;\250\2376\261\2177vH"
+	.ascii	"\243N\220:\360\311\322\206\002\353\257]\026\303c\220m\350\253"
+	.ascii	",RI\206\214\322^L\362,\317\236\270\033\352kw\023\333\232\360"
+	.ascii	"\215\035\022\341\247P+\215\324\340\232\305E\022\271\271\352\356"
+	.ascii	"\200\361\237\235\342]$\025d\017|2n#0K\246\263\231\234\312\241"
+	.ascii	"&\205|Cf\311a\026\265\\\207\364\201\277\360\017\310-\373*O\027"
+	.ascii	"\271Dv\341\223=\r\372\006\022\365^\354\373\303\024\253\341[\025"
+	.ascii	"$\367\246\034\346\262\307\f\023;\203i\222\347$\266\362\335wg"
+	.ascii	"dN\032\305(\030^\"\275\300\200\303\237\330\311\"(\212=-\200\247"
+	.ascii	"4(X\303\024K^\252/\r\023\3355\3048\027W\\\236xj\367\202\f\370"
+	.ascii	"d\3730}KfX\177-\257\277\335k\244\271\0256\277\330\260[\351\366"
+	.ascii	"\255\372b\303\375\237\340\006\231-Z\271\374\266\214e\005\235"
+	.ascii	"\b\317\016\255,_9\333\225<*\313UNd\213\232\224e\036\376\265\345"
+	.ascii	"\317M\271\274\303\327.\177O\226\333\004{`\306\3019YfS\323%Mm"
+	.ascii	"\271\311\242\351b\304mec\262\2146cY\304me\313ay\211\324\2300"
+	.ascii	"qp+\333\r\3138\254\340\343\260\261([N\262\202\367\033bM\r\312"
+	.ascii	"\310\362\221\264J3\016\216l\271\310\n2\031\266A\307\226i\350"
+	.ascii	"@\260\3450>\333\372f\307me\343\257e\"+X\374\207\020\237>\254"
+	.ascii	"\215\264\211\203\333]\301\373a\256\251\255\353\327\327\004\231"
+	.ascii	"l\025\340\351\215\364\355~)}Z\220\254\255T\370p\227.ytm\345\356"
+	.ascii	"\321\265\241\354>\371\\\315\367\315=8c\340|\370\234\357\2610"
+	.ascii	"\361\376\355q\276w\273Re\312\003\277\217\262\303\355|\257t\322"
+	.ascii	"\304\3733\263\377\360"
+	.string	"\277\254y\177\344s\377\215,\357\307N\370\275\330\001\277\017\273\234\357\301\356\346\373$\221\243\371\376\353l\276_\233\027i\344U\233\367h\344\235\241y\207\030yeh\336\030\232xah^!\315\373\002\023o\220\346\3652\362v5/W\363\002i\336\037\315\273e\344\365\321\274Z\315\333\243yy4\257\013F\336\254\346\335\321\274:\2327G\363b\031yq4\357\225\221\267\205\346\2652\362\262\240\304\273B\363\252`\344MA\211\027\205\346=\301\310k\202\022o\t\315K\302\021\357\b\315+\302\021o\b\315\013\302\021\357\215\346\375\340\210\327\203\346\265\321\274\0354/\007\315\273A\363j\320\274\0314/\006\315{A\363ZP\202\267\202\346\255\321\274\0244\357\004\315K\243y%0\362F\320\274U$x!h\336\007\214\274\0164o\003\315\313\300\022\357\002\315\253@\363\316h\336\004\232\027\201\346=\240y\rh^\031\315\001J\177\036"
+	.string	"1\202\376\337\271I\016lR\352\372\344\f\321\350\t\0325\024\343\222\224\240it\223\235\330Z\004-A\277\206G\320\227\223\026XU\325-\227f\354P\006\276\337\353\250F\212d\020 Q\223`i\b:\250M\356\216\260\265\250\317\003\244\254+\330\214m,\235E\275\001U\242.Y\202\245_\347\350\2334?\347\353\230\331\260G\242\225}\245\335\324'\0235\215\230F|z\267\376\336Q4i|\3163(\227\022\004\264\364\200\003\375\200\003\335m\004\3674"
+	.string	"\243\033\350\333\205@\\\240a"
+	.string	"q\242.\320h\033A\2761}\350:\350\217\351\2403\262g\320\035\324\360\004:\203\276\230\004\032e\n\2729\322\307-E\377\b\005\235\302\200\246\240\037\306\200F\377\004\365\276\327\242\277\367\365\002\272\005\001]"
+	.string	"\001kbPu\214\266\326AU:i65\n\017*\025*\304\247T}-i/\332E\277\310\272\242\276\361\311\\t\372'(\307LN9\203\331C\347l\216\230\n\353\257,\215\246\372\320g\315D\335\242.Uu*\325\222\006\204s\316\354[\245\244\347\317\340y\0242?`n\336\0173\254\207>\306V\256\020\032\322\315:\235\322b\252\310r\371\223B\202\377\0215\2708I.\376d\337\254\215mV\362\210\255%y"
+	.string	"\001z\200~\240T\013\320/\354$Cfl#\3512U\316\213\372\345\013\361\251T\377\315\32334?K4D\370\331;\330\007&\020\222\024\007"
+	.ascii	"@\007P\007@\032\037\366Vg\263\301\256\325\367\241\203\316\324"
+	.ascii	"u\335\321Zg\321;\372e\354X4\312\004<\263BE\257\350\343\335\251"
+	.ascii	"\350n\003\350\205\231\374\016m\003\0308Lg\363\205\376\016=\244"
+	.ascii	"g\352\\\375\002a?\241\232\253O\346(\227*tg\306\300\2340F\305"
+	.ascii	"\343\223A5\372\007(\307L\316\310\302f\354\031=\244\007E\033{"
+	.ascii	"Y\214\317\211F\321\350\336\330!\tg\3244|\262\023\235\376\001"
+	.ascii	"va&u\270\024\340\362(\350\311p\315S;\341qS4\341\3243\321Nx\230"
+	.ascii	"D1\221S\037\325\r2\n\321\251\013@\363s\236\261\r\007l\302\374"
+	.ascii	"bC\243V^\tFOP\304\237\275(\021\221.\262\373\001\237H\253{*\037"
+	.ascii	"\340\rE\255\374\263\235\370\222}w8$\371)\242\225\333\002\214"
+	.ascii	"\336\332\320\017\204\270$\266F\216\320\036\b\361_M\035\360^\355"
+	.ascii	"#.\013\252tbp\240\352gG\005\344\223\251\201j\036>Y\023 \242\241"
+	.ascii	"\206\262\314\226\305\314\230\231\342\322A\3112e\314L\320^\213"
+	.ascii	"\370\265\213\360\335\231\324A\246~\363\316 3Y\242It\211=\\G\355"
+	.ascii	"S\\\327\025\201\345!\230\216\352Gu\252\200X\005D|J\242U43\316"
+	.ascii	"\245\021\275\324\307S\ry\216\372,\256+\030\002\313|\314D~u!>"
+	.ascii	"\035\321wC+\263\234S\212j\245\276\336\223\360R &uT/\217\235%"
+	.ascii	"\371\271\017\204!\307\370dI\335yw\262@!\311`c\240\b\322\b\237"
+	.ascii	"\f\251\233yG\t\037>GF}T\324F|\212\366 \341\323\034\306o0\201"
+	.ascii	"\227\335\200T\242\343\r3L\004Q\213\030j\2427\207\272\363\374"
+	.ascii	"\002\273\003\006\226\016+"
+	.string	"\257\036[/Puqmu\371\300\352:\261\023\310\250aA\272;`t\355\360\262\322\242\362\261\245\245\265u\345\304\205\345\205\245\225\342\310b/\037A\266\256\322\254waeye\365\310j\301\352\207\025\r/,\035\\V^F\254 =\254^H\273\264\260z\264\260\305e\303\307V\226\227\025W\020\035Y9|l]-\371\250\321\325\205u\265\305e\303\253k\313\306\217.-$\257.\034m\343\306\0068\264\256\210{\005\343G\227\026\225\217,+-\252+\256.*\030K\273\365\003\213\213\312kk\213\213\212\210\216\310\033\312\366\220\003tg&\375\221\304\333\275\030H\316yg\206\371\356\037\353\"c\315\235\334\037~\253\372\371|~a!D\215\341o\303]\027:g3l\355R\204[V\020:I\273\024a\032S\005Rmd\037\357\211\016\252\335\3628C\037\373xkMfp\016\221\241\207\364\361\320T%\023\031\372Z\232"
+	.string	"\261\214\341\254c\330\200\bC\377L\016Ur\364\202\003\fB\336ZH\337\256\003b\220\376\333\027\264\354X\207\"\t\322\307\242\366\364\352j/\324\206\"]\207\034"
+	.ascii	"i\016~4\220n\262\333\352\037\315\264\347\243\267\354P\032\306"
+	.ascii	"|\034\336I\217\276\023\036\335\303\205\346\221\325.\334\241`"
+	.ascii	"h2\253\257E\315\020\003\035\215A\216\326\321Lt\304\270,\217\325"
+	.ascii	"9:\310\020Gc\365\217A\240\353\023\207\232\341r\016\311\267*\352"
+	.ascii	"\252\205\276\352\343\215\351@\252\022P\013}\254Xh\253\025\232"
+	.ascii	"\005\274.$l?G3g\216i\322\020\237\256\320\227\243\306"
+	.string	"'o\363\346\350\3041\303TH\241U@\241SX\323y\004Q\b<\301\204>\241\2046\241\257\327\200G7v\372\316\021\316\336\221\217\217\370\264\204>\0335<N7._#v\251\311\005zR\230=K\224\350\331\003\325\312=\342\202\302\305\323;'\246~\261\276\237\27783\004`\235\0350\376\363\031\203}t)H\030\241I\230\323s\252\004b\362\215\340\024!\204\026\241\257\343H\001\004\347M\bk@\270\321 \034\351\264\236\372<z\243\003e-\356\177\330\034\375P%\035\344\330\005\021\247\246\327\034\355\034\001\217\201\307<\304\2477\372\204jj\246\270\346\230a\037x\320\0374\343\271\350<\365Y,\323f\216\203\350q\317\261\017\361\330\207\370\324\203~S\315\314\022M/\013o\f\243g\331(\376\364da\206\235\351Yr\302\304\257t:\305i\352\017\013k\0336\272\367\306\236Z\271a\375+}<\277\3216\347'\253y"
+	.ascii	"\263\260\211@\037 \243\021\330\240e\364\3734\227k\320\033t\212"
+	.ascii	"'\206\305\217\006\375f\332sYe\3605\236y\205\f\364\253(\320\f"
+	.ascii	"\\\320\n\364\367\034\235\037<\002\272\240-\260\240\333K\337\330"
+	.ascii	"!\221/\276\236\017\036\237\025|\251\311(]A\007\265y\321\343\323"
+	.ascii	"?|\tS\227D\351\017\0062\341E}\216\251iW\366"
+	.string	"\357\364YF\311s\306\351\r\323\341:\235\2624U\004\254k4\215\273u\215&L\253\223\364\273;\023\021s8\327\324\312-!\007\022\177\027bs\363\366\004I\211\t\372p\272\bX\037\256\317\367\033mq~bk<\320u}\002A\363\007~N\351:\257\001\310\255\360p\372S\230Z\271{j\020\273R\242\241l\203\013\250\362\020-Q\222\0241332\322\202\244\220\326\"\013\020\b#a\230\345\262\007\022 $-K\263\2129$\"4$I\322\030\310r\007\326\330\265?\232W\223\352\236\032z\353h2\231hW\0217\024\023\271M$<\220M|\312\030\007\333;X\257o\304\363|\331Z\371)|\002a\002BY\nx\212u\034S\f\271)\364\036\247X\370\272R9A\r\244\326)\3638SCQU\036\252r\344\r\240\342 L\377\264N\340g\327\372%\367Q\267\271b\006E\314\305}\013P\030\201S\230?\234"
+	.string	"\346\200\205|\345\302\nOp\003\205s\205|\027`p\030\265\035\307\t\231\316m\256+TMe\237\205\313\346\213.Ui\200Kaw7\257g\364\0134%\017V\334\361\271\264\350\2428\204\205\334\337\226\204\264\331\260\223l\233g\022\340\037\243`?\035\361\203L\374\350\363{\217\037\254A\003\376\241$\310\220\020\037\265\364\224\031\223\276w'\217"
+	.ascii	"G\021^?\367\024L\313\004\214\271G\212\254\267\221\021\346\r\017"
+	.ascii	"E\023\032@\371\037^\202\377\3416t\265\003\335!\277P\3572\220"
+	.ascii	"q\260Fm2\"\213\r\244\217G\231\357e\3227a\233\211\206\361U>\372"
+	.ascii	"X@\373\234\222O'\320k\331\262\237\202\205\3053\364\346\230\013"
+	.ascii	"'\314\326\365`w\324\332\251\202m\353cn{\3057\360\317\303.T\340"
+	.ascii	"@YL\246&W\306\224\223N!\246a\023\227\001e\356E\361\245Sll\020"
+	.ascii	"i\310\301\"\207O\001\\\301+\026x\272\025d;\361\337\315\001\320"
+	.ascii	"\025\206\207\244\026A\204\341\351\033\357\346=\003\004\352\250"
+	.ascii	"\001\312\n\214o\201w\362\345\203\253\274\022\212\347{\233\030"
+	.ascii	"/\310\374S\005\f\032+\026\037\3176\355\316\372\3770s|\340\227"
+	.ascii	"3\240K\204[\216\224\025qy\214\226\005\225O\230\212\232\211\232"
+	.ascii	"6\002\305\036\357EO\3766\237\037m\263Q\221c\375\340\221!\316"
+	.ascii	"td\330O\b\223\230\330b\237\266\206\235\242?\003#\030\\\211\310"
+	.ascii	"\301%+\0240\374\300a\257\020\316\254A\243\354\332\360,\236\317"
+	.ascii	"\025\347\277\203]\357\321a\323\017\b\007\370m\205\275<\315+\036"
+	.ascii	"t\341\225\016\311\335az'}\3077f\311\002H\376G\332\006\354\024"
+	.ascii	"W\322\"B\325R\223e\034\325i\262\247\357\005\255L\352u'\215\213"
+	.ascii	"r"
+	.string	"$\225\332\275&\264\027\303[\034*3P\322\274\027Id3\264\234\354\375\317"
+	.string	"\210\b\324\314\024\r9x"
+	.ascii	"@\005M\257\351`\r\221\260L\322\256s\352f\341 \367\030Q\341K}"
+	.ascii	"\247\313\306\350&\265\264WT\277'D !/\354\333\"Y2\250\347U$\361"
+	.ascii	"P\r\260\215J\350<~\305\201\016\236"
+	.string	"-\025QR\231\0359*Ua}\221\377\020\375\301\355\241\315n+\331\223\t\300X\202\n\3022DU\372=\344\013\3052\276\312\307\270\271\253$\t\\\322\373-\355\244%4W\223\206\365q\227\220\333A\317($\224\303\004\007\250D[H\252$N\333\264\024\225\244O\037\350\323\0335Nw\315\367\305\357\026\252\025P\235\353U\246\253\325F\016\307kG\336\033\356t:l\263\324\336\355s\231\"S\357\343\001\335O\221Z\322\252Q\216\034#$\305#\351\230\317\224\002L\217\371\346Q!\367\335\356\206\305\373\0219\241\037\2538f\363H\263Z\023h\2559K\203\327\347\317\226W\266\2231\366h\342\355\\\225C\335\364XL@\222y-_d\225\021\320\357\276\250\237u\331\300, N\3008\357\023\213\004d\036\335\277\223\300F9\027\327\305p\271H\215z>j]\3660}\277\273\320\r\374.~d\307>\2318\212a\316\357\030"
+	.ascii	"\360)\221\005x\203-p\346N]e.F:@\030@#\020\317\321\027\320\234"
+	.ascii	"\250L\2454\277\350\345\267\031\306\226\237\003\227x\204\376L"
+	.ascii	"\223\322\243\373\001\232{\251,/\255\243_\241\244\345H\003U\037"
+	.ascii	"\004\331\250\355\377\304\256\322;\302\260\2519\027\374\262\357"
+	.ascii	"Ku\016o-\300\233\336B\030x\236J\002\017i\013\351\250\276\372"
+	.ascii	"\271\201\f\371u>\353\2758\367\177\023Q\013\200\217\202\252ja"
+	.ascii	"\032M\202\301\273ht$\251C\373\240\362\001K\337~^}\303\304\r\300"
+	.ascii	"!^\223G)T\361gS\215\244\005\317\177\t\374e\320\337-\271\211\f"
+	.ascii	"\244\026\310BuK\325\254\233\025\241\21432\264\215\020\016\311"
+	.ascii	"\226\035\201\005C^\261\022\331\373\310/\211\034F\304\211\006"
+	.ascii	"\032.\226/\243\320\334\214\335T\016S\207\321G\371\2234\033\034"
+	.ascii	"\312\203\f\212&\250`\212\266\f\3332%\201\307\tZ\221XT\334\262"
+	.ascii	"\200!\336\342\b\351%\271\246eo.\r;\245\224\241\023$\232_\n\006"
+	.ascii	"\2319;/\364$\025M \205\232\204Rl\177\021\022\233,m\n\305\376"
+	.ascii	"\246\336\020\002\235\326\253\201P\036K_u\320\037kda\355_>>\312"
+	.ascii	"u\032'{Q\361\023*\351~K\233\211\215\305\215\nay\345\006\261\357"
+	.ascii	"!2\334\030\202U\230F\200\200\335\214\261}\275\231\244\351\201"
+	.ascii	"jQ\215\005r,N\202%\260T\340T\324\226`\005\330D\373ob\rx,\317"
+	.ascii	"\207pK|\256\262\250\2311\341\003\311\267\351T\306\226\363C\n"
+	.ascii	"\340\250\342\255s\330\3323\215\377\274\033Y\225\342\262\315\256"
+	.ascii	"Q\034\037\210USR\204\241\330\262\362I\343\260r\220}\211\210j"
+	.ascii	"\234\317Bi\212\277\331\332H\241S\362\b\325\330\336N<%\016\025"
+	.ascii	"\303\204\223\355.\\\326\256O\031(\330#\312$E5\226\213\305\342"
+	.ascii	"z\307\341e1\211Y\201\351\327\036WB\226\021\005\242\026&\302\226"
+	.ascii	"\004@\021\005\273pi\001"
+	.text
+	.section	.gnu.lto_mspProcessOutCommand.174.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`@\243M\004\002ztK\271R\0208\346X\206\003\017b/\355\242\342\001\205\025.(\270\020\367!U\036\022\025\027\272U\275Z\301\345j\333\353K\"\203)\272jT\302H\315\374U\013%k\003%k\003%\355\003\317\3764@=FI\375\347\240\324S]\214\002BQ\376 d\357\235\244\224\001\360\na\n$\f\357m7co\267\275\267\213|\320\333D\336\333l%\364\366\232\261\267\325\336\333i\333\333h%\364\366Y"
+	.ascii	"z\333\354\275]\266\275=\244\204\336&{o\0131\366\366\330{[\314"
+	.ascii	"\330\333a\357m0co\007yo\0031\366\366\217\367\366\327\007\275"
+	.ascii	"\355UBowmos\225\320\333[\357m-cog\275\267\233\306\336\306zo\373"
+	.ascii	"8\366\366\325\261\267\255\216\275\335\303\330\333<\336\333U\306"
+	.ascii	"\336\246zoO\031{[\352\275\035u\354m\250\367\366\223\261\267\235"
+	.ascii	"\336\333M\307\336fzo/\031{{\307{[\207\261\267\231\357\355\034"
+	.ascii	"\306\336Vzo'\031{\033\307{\033\311\330\333G\357m#co\337xo\027"
+	.ascii	"\031{\233\350\275=d\354m\241\367v\220\261\267m\274\267k\030{"
+	.ascii	"\033\350\275\375c\354m\032\357m\237co\367\274\267y\216\275=\343"
+	.ascii	"\275\275c\354m\031\357\355\030\307\336\326yo\347\034{\033\306"
+	.ascii	"{\033\347\330\3337\357m\033co/\337\3335\307\336V\226\350m\232"
+	.ascii	"\367v\362\330\333k\211^~\276\227\017\217\275lX\242\227\013\337"
+	.ascii	"\313S\214\275L\370^v\032{y\360\275,h\354e)\357\345(\306^\206"
+	.ascii	"\362^\0164\366\362\223\367\262\023c/\003\276\227\377\214\275"
+	.ascii	"\354\367^\356;\366r\223\022\275\314\344\275\314w\354\345\275"
+	.ascii	"\367\262\336\261\227\363\336\313K\216\275\254\344\275\234\344"
+	.ascii	"\275\214\344\203^>\362^6\362A/\343\275\227\357\336\313v\306^"
+	.ascii	"\256{/\323\031{y\356\275,g\354\345\270\3672\234\261\227\337\336"
+	.ascii	"\313n\001\350\345\266\367r\021\022z\231\310{\231m\204^^{/\253"
+	.ascii	"\211\320\313i\357e\264c/\237\225\350e\263\022\275\\\366^\036"
+	.ascii	"b\354e\262\367\262\020c/\217\275\227\305\214\275\034\366^\006"
+	.ascii	";\366r\220\3672\220c/\377x/\177\035{\331\353\275\334e\354e\256"
+	.ascii	"\367\362\226\261\227\265\336\313Y\306^n\276\227\261\214\275\354"
+	.ascii	"\343\275|e\354e\253\367r\017c/\363x/W\205\320\313T\357\345)c"
+	.ascii	"/K\201\320\313Q \3642\324{\371\311\330\313N\357\345&c/3\275\227"
+	.ascii	"\227\214\275\274\343\275\254\303\330\313L\020z9\207\007\275\254"
+	.ascii	"\364^N2\3662\216\3672\222\261\227\217Zz\331\350\275|\303\330"
+	.ascii	"\313E-\275L\364^\0362\366\262PK/\007\275\227m\030{\271\206\211"
+	.ascii	"^\006z/\377\034{\231\206\211^\366y/\367\034{\231\307D/\317x/"
+	.ascii	"\357"
+	.string	"\034{Y\206\211^\216\361^\3261\366r\216\211^\206\361^\3061\366\362\215\211^\266y//\215\275\\c\242\227\225\357e\032c/'M\364\362\372\336\027\306\336\031\023\275\310\367\312\030{cL\364\302\274\327\205\261w\b\023\275/x\257\020\306\336 L\364\002\361\336\027c\357\017&z]\360\336\026\030{[\274\327\207\367\262x/\013\336\273\202c\257\nJ\364\366\360A/\017\357\335\341\275)8\366\256(\321\253C\211\336\034\336\213\202c/\016%zO\360^\023\034{KP\242\227\004\357\035\201\261W\004\357\r\301\261\027\004%z?\360A\257\007\214\275\035x/\007\214\275\033x\257\006\216\275\031\340\240\027\003\333{\201\355\265\300{+p\354\245@\211\336\t\274W\002\307\336\b\224\350\205\300{\037p\354\275\241D\257\003\336\333\200c/\003J\364.\340\275\n8\366&\240D\257\r\357E\300\261\267\206\022\275*\336K\303\261\367"
+	.string	"%z\r\360\336\031\214\275\005\360\240W\006"
+	.string	"\364\306\360^\030\216\275/t\320K"
+	.string	"\016z]x\357"
+	.string	"\216\275-\224\350M\361^\024\307^\026:\350]\201\203^\027\016zUx\357\t\016zS8\366\n\340\275(l\357\t\3575\341\275%\030{\003\360^\022\216\275#\274W\004co\b\357\005\201Do\013\211^\023\357\375\340\275\036l/"
+	.ascii	"H\364\226 \321\333\301{9x\357q{\215$zI\220\350\335\340\275\032"
+	.ascii	"\2747\203\355\305\200D\357\b\022\275\"\336\313\362\336\225\355"
+	.ascii	"U!\321[$\321K|\257\372\336t{Q\022\275\337\336~/\027qT\344)\221"
+	.ascii	"\200q=\237\367\265\316x\026\256x)\233T?q7q\357\340fr+q#q\027"
+	.ascii	"q\017q\007q\377p\363p\367p\313\340\316\341\276\341^r\323p\257"
+	.ascii	"\314\207\314S\230\235\314\202\314Q\230\373\230\2310\3571/aN\302"
+	.ascii	"|\204\371\216\271\b\263\0333\034\263\0343\031s\0313\030\237\260"
+	.ascii	"\313P\313\202\301\r\234\232S7\275\254\354\020\002\334\032\254"
+	.ascii	"*.\335\2215s[\207V\216V\272\313"
+	.string	"z*\342X\226\273\033\200|%\005\206E\2026Z\231\250g\337X\026NW\224\371\007\270\205\325Dw\200[\203-\304\214S\333\0324A\333Xfs\022\254\261\313\002\324G\243op\306vO\373\330\240\304y\300\033\335\324\272~\271\360\324%\355\310\341\3201\226\341\234\356\260\032\306\266\316\262p\232\223\203\227Q\021gY8}\343\262Y\226\335\355\345\n\r\326#+\367\350\2759\025\025[\371F4\265\256k'\333\364\236+aKz[\203\206\273,\205GR r\003p]\277\b\211\340\f:\247\244,K]\223 \270\274 \270\024\226\004\355\300\177;\263\244dp]W\026\277e\341tim\b \223\345&kQ|\313\262\267\202\2555\250\237b\236\220\022t\025\302\200\265\235\251u]]\214,#Y\226#X^O\300u]}\212xw=\2748F\261\216n\1778\262\033\344\263\3456~\3438\236[\026\271\036\364\274v"
+	.string	"\327\225G\006n\005[^3^\334\266\215W\237\225a\344\360\332\002\\\327\265\0076&\202\344\",F\250\371Z{2P\026\352u\240\310\351\b(\247\261\332.\313\266\340\263Ua\313\203\302\351n\213u\001\237-\021\310\237\236\321\326\272\256,\273,\266<\204\315\226\205\323\262\027^mV\0279\234L"
+	.string	"\033P\344\224\307X\b\222\311\202\030\201\346kM\262\334\240\351m\r\256+\217\013\247\253\200\"\247\253\266B\302.r9lY\226\301^\214\220\374Zg\250J\203_[\203\353\372\345\302\351\246(\242\275\313_\374\003\311@^\300\033\254k\016\247\332\272~\261\260.EN\367\253\370\336\345-\346BrW\314\246\353\212\024\247\266\256+\013kB\221S\r\230\003\225\323f\243\312\251\0130 \367\005"
+	.string	"\226I'-p\035\336\204\r\256\353W\212\357\330`\203\022\006\b!\204\020\020\020G\202\355\307\223\320\340\004\022$T\370\357B\232\2460\354\312\360\301\356\246P\faE@\333\335!\307\343Q\205\006\032h\320\202d\213\214~\361n]\211\027\274S\226p\235;\270\202+e\243,\224\r\334'\353d\001\367o\375\266o\233,\223\345\333\275\325\333\274]\262J6\311\"\331#kd\361\366n\355\266n\351vn\3456n\341\366m\335\266m\213,\221e\333\265U\333\264E\333\2635\333\262\035\262d+d\307Vl\303\026l\203,\220\375\261_\b\250A\005\r\0070\300\f\005\220!\006\030^ \200\013\003h!\005\n\026VpQ\341D\n\002@\341\004\023J\b"
+	.string	"\t#\210\020\002\b-&>\360"
+	.string	""
+	.ascii	"%:\340\340h\344\225\304"
+	.ascii	"\006\234\324 \003\fF\210`YQ)\022\325\024\375\026\256\341\036"
+	.ascii	"\356\223iX\3115\274d\033\276a\034\206\3019\375b9\214Q,\256%A"
+	.ascii	"\362\206\364$y\247\020&)M\341u6m\006y\b\376\361Ji"
+	.string	"IR\3765\224_o\024\013\034Ai\302\033\330\204I\357\223\f\210\234d`c\t\340S\312_\020Sn\306\374*\260\266\244O\004\032\227Q\023\0376L\234\230w\320\254\272~\222\224\350x\371:HR\312-Z\224\244\234\353\335\343\241C\217\352*\317m\t\006G5\2248\211K\262\344\325\213\244\214\367\210\021g\327O\222\322\020^<2!\275wK\3141\312\234F?IJe\274v]:\262z\353\270x\351\266x\347\266th\365\3125\016\250\336\270#JM^\270\267cY\340\341O\222\022\026\257\233T\343`\264(I\031\325\333\026\250\243\210\223%Dn0\365\2625\361\256\335]\251\3251\271\031KC{\355\341C\305\263\214\254\211n\364\242\031\361\236y]\231\365\225\t\t\365\016A\177\216(\r\361\222\t1\307\320\341\021\365\223\2444\304+\204j\311\330\034\316M\232\330\bqTGf\374$)\355\360\206\241#\310\350"
+	.string	"\254%I\031C\215\321\032I\312\235\336  \360\273\031\003\302b\243\306\017\t"
+	.string	"\211\355\027\3328gI\025\202U\317\006:l\004<\271\206\235\302Va\3104\3540\372&G\225\344c\310\007@\277\034,\242\201\360&I\3438\333"
+	.string	"\204<\203\240\216\002\264\215_\313\360\3071\240+mgi04UQ\265\262I\303\320\307/D \320\206"
+	.string	"\250\006L\320\026\366\332\005>\036@\222\3216=\252$\037>na\356*E\234\033\2127),\264IY\001m3\272\031sy\306\265\nr|\2420\255S\200c\001\024r1\t\221\033N\222|\340\030\005B\257>\341\214M0\343\022r\020\321q\222\344c\306\0018\302SV\3053\244I\320\200\254G@9\230\021\225\303Gx\312P\025"
+	.string	"\327\2440!\223P\305#\244E\030\344\352\020\272\030\004\364F\340\222h0\332a\307R\264\272e\213M\240\304\035\236%N\376\206\330\257\331\037d\261\007\034c\210\215C"
+	.string	"\240\304\345\214\250\002\020\002\262q\223\250.!\305\0354at-\212*\311G\2129P\022\3469\365\361\211\215O\314+\216\022&\241\212\207\251I\350\360i\342\r\230\246\2119\211j\260\256kK\322\022\006\332\002\tU<G\255\201\016\237%\316"
+	.ascii	"\t\027\241x=\235$\371,1\006$$\371\030\361\210\033\"\212\214\232"
+	.ascii	"\205\b"
+	.string	"\217I\250\3421\352\0256\343\rL\360\242\273I\373IR\"d\225e\331\016\2173\311G\210\213Gx\202\320\021\326u\345*\036\241&\336\3241\tU<B\255\326\340t\245\247\006\243\250\nFt?\030\364,Q\016\214(5\3419n\235\236\232>!oa?y\r\233\274\207%4\361>\317\230i\344\230\225}\3145\177\314\313,f\233\356b\276)\301\210\031\247\267\230a\224\300\305\2343\244\354[\n\021M\341\013Z\006\315P\352)\007\321`\344\340\304\301\245-w\2262b\350\321\315\315\320Y\352,s\260\206Vz\224{wvugh\317%\263\247\273\301\272CC\247\243\"\273BN\342\201RyHH\3261I\351\204\241\2116\254\353\272\235\323\343\303\313:\274;\002\307.\233`\027\350\2051\234\371\370H\2264\2077\305k\003\007g\256\212\234Q\355\361\224\217W\027F\303\302\216aW{\334\310\204\221\006\303\013\207\201"
+	.ascii	"\177\301\005\002@A\2116\355\004\2750thf\016\205^\020*43F6SV\246"
+	.ascii	"r\352\3029\217\323\032Kg\306u\003\325\307S>N\2720\n\006F\002"
+	.ascii	"\354\252\217\033\2318\202\003h\341\003H\361\026@\320(\330wg\322"
+	.ascii	"f\326\232sR\234\225\3601.i\2033\223\317\261*r\031\250\315\247"
+	.ascii	"|\030\2700\032\344:\273\273,0\032\344|\030\204\257\246\t\031"
+	.ascii	"\005\266\035/\rV`4\310\325\346\215J\317g\013\215\202\205\243"
+	.ascii	"X\341,\274\317:\320.\337\235i\233yS9g\205\217P\363\344\252\360"
+	.ascii	"\024\356r\266\221S\366sO\\\205\263\r \220\2378Z\267\273B\f\242"
+	.ascii	">\233\026C\001vg\342\320\236\2319\024z<)\234\221p\n\267\004\346"
+	.ascii	"d\243\351\347\367K\311-\206C\37628s\211\317\253\021\374\254!"
+	.ascii	"\242\245\260\240\374\242\022\r\335V\212\374\242\242@\256\263"
+	.ascii	"\030\234\311CB\262F<\307\237O#m\305\003ED1u\362\324B\371p\350"
+	.ascii	"\261\234\271\362\314\235*\200s\322\316\324\24173w-\2733FP\233"
+	.ascii	"\031$\035,\255\353\032\003\247\213\326\240\313\031%3y3{\3159"
+	.ascii	"\234.\317\354\251\234\n\340\214\307(\340\221\224f\327\023f3^"
+	.ascii	"\031\233\202\347\004L\266\341\312\231\013\202\253\242\232v\020"
+	.ascii	"\324 fP\307*HoN\216\314P]8-\273\316n\017\350\272&!\200\345\230"
+	.ascii	"\001\201\364sU4\n'\034\205\b\364\356L\337\314_s\316\t\377\340"
+	.ascii	"\323\352\206V\213\314\004\316D\321{\336`@\357\3168g\2464\347"
+	.ascii	"\250E\256\ny\022\341)?\340m"
+	.string	"S_\324\300[\246eg\272\023\276\220\302@\357\203w\366\260\374\304\351\262\240\307)\312\333\247rz\210gC\304\371\r\202x\203\200\313'\227\323\262\023qT\316\f\262!,>\307r\020\b5\224\202\330\3254!\361L\256\343\016\002\032\304\n\202\244\256\246\t\267\310\333\246\232p5\355}f\223\245\354\347\356\300\333\246\252Z7\341%\224S\362l\214\224\375T\317\334\265\303[>\251N\311\210\222\252\350\022\002\360\022\336g3\206\0018\252v8\307\002\267\220\3038\274\345\223\317a5\207\372`\264\360i\322P*\310^M\023\246m\022\3366\225\204w\332\267m\240(\373\271#\234\204\337\320\206\344\013es\316\bO\205\034\266\251h\021n^\300\b\341\"\030\240w_\310x1\2439'\204\037\360\220\b\236\362\311\225\241\217\307&\320x\001\244\206g\003\302GX>\271-\007\341l\342%\336\362\301M\234\205\260\324\203\177\360\024\206"
+	.ascii	"\270\007\f\200\263Xup\022/\301\301;x\n}(o\233z<\007_\241\316"
+	.ascii	"\370\243\006\306\257\034m\360\021'\241\30178\bm,p\006\327\340"
+	.ascii	")\204a\360\fF\300\340"
+	.string	"\304\246\210\027?\202\345\"\356\201a\363\266\251+gyK\237\312W\212*W\211 \325<\271\304\377\305\363\315\217\262\237\253\236x\265n\005N\257\336\2036\233Be?\027}\212\242\3479\244\377|sH\323\317}\241\233_\b\251\273/\210^\334h\316\351\177\360\320\013\257\306\205g\262\360\226On\013\335E\236\256\337}\201\343\205Rs\316\362\034\243ZH\313'\367\317'o\233\312\357\"\337\276\tR\366sYh\224_\354Pw_0\275pj\316\341\177\360\220\307\211f:\236{!%\303\322\272\256\234\263\373\202\352\005\217\346\034U\353<\307G\265\303#\274\232'\267\377\230\315\370\006'S\203\200\3116\334\375R\236\207\f\020d\330\214\334\213A\232\236\242\224Q\303\263\244aCu\323\003'\214\031\306\231\273\3732^\033\222m\270\314*E\202\250q\316\231f\373\263\365k\303$#\300 \333\017\021$\302}\211\355\307\326\257\305"
+	.string	"\235\004\331\203\255_\377\345"
+	.ascii	"\374\332\377\360\333\342\332wi\021\321\262\366Z9\342\276\266"
+	.ascii	"\260\216\265~\\\370T\203cT\253\375\325\372\365\037\224\237\252"
+	.ascii	"=\217\365\3531<\243\"\366\221\332O\361\216\023g\352"
+	.ascii	"i\017\265~\357\313aT\3041\230\366M\254\223\n\301\351\330\357"
+	.string	"X\277V\262eT\304K\245}\216\365\353%\203FE\\\203\264\307\261~\235\004\211\2257\366F\3537\003\032\334\341\320\236h\375f\020\2033\274\215}P\341\340\026\326\317\036h\375Z,\207Q\321`\317\336g\375\\\332\242\354\354g\254\237\313Y\020\240\316>\306_\335\324\212t\234=\214\276\266\245\251\345\336\246\t\323i\366J&pj[X\317\375\312\227\366\265\205U\270m\270~]d\312\250h\317\271M\270~)<\365\244l\013\346\255qM\255H\201\333P\226x\331M\001n;Y?\021\304\202\224|\020n\013k]\373\266\375\326\217\206;<\276m&vXjy\333z\353g\20018\272\316I\262\255D.\220\311\324\212dd\373\210\232\223\271\251\025\311n\373.m\006\334\3346\335\372\2418\204;\203\333\216[\277\026\234*k\333v[1b\f\266m\"\353\327\205xFE\373\225\266\255\266~*\344\2510\333>;"
+	.string	"#\255oXS+\022\331\366\020\0038\t\331\302Z\221\304\266\307\326\257\013\001c\b\262\r\266~}\367\302\327\366\217\365\353\302)\243\"\027\270\266\273\326\017E\030\334\nY\333Z\353WT\201cTNS\273A\037\333X\353\247B\022\270uM\262\021\n\034\243.r\327\257s\326u]\327\023\234\356v\217m\253\365\353:@\243\242uM\262Q"
+	.ascii	"8F\345tww\027\271\353\3279\353\272\256\353\tNw\233j\273j\375"
+	.ascii	":\354\311\250h]\223l\264\3021*\247\273\273\273\310]\277\316Y"
+	.ascii	"\327u]Op\272\333R\273\353W\\\327$\033\355\356\356\"w\375xI\244"
+	.ascii	"S\333\302Z\221\326\023\234\242\205O\341\360g\206\321\372\327"
+	.ascii	"\207\273_J\376\363\371\374\3533w\371\317\347\363o\237c\227\231"
+	.ascii	"\360\026\227\274\307[T\366\ro\221\246sx\211\206\375\303K\254"
+	.ascii	"k$^\242[\027\361\022\177\274\227hEB/\221\206\t\275D\036c/q\347"
+	.ascii	"\275\304\234\367\022q>\350%\326\274W\225\343\"\274j\021v\343"
+	.ascii	"U\323\030\216W\325\342#\274j\223\223\360\252>x\t\257\332\203"
+	.ascii	"\235\274*\025\037\362\252N\275\362\252AM\303\253\332\364\222"
+	.ascii	"W\245\341>^u\355&\336\224\257\233x\323=\236\302\233\302\225\320"
+	.ascii	"\233\256\2757-cA\336\364\252\207x\323\036\035\304\233V\265\f"
+	.ascii	"\336\224\251yxSf\367\360\246J\034\20575j&o*\243\225x\323\030"
+	.ascii	"\275\2037\315\031\2417\245a \314\351*B/zxB/j\310]\314ha\b\275"
+	.ascii	"\350\024.\343E\351\272\211\027\235\353\035\274\250\\3y\321\270"
+	.ascii	"V\342E\341Z\211\027}k$^\324\255\213x\321\266\036\342E\213t\020"
+	.ascii	"/J\244\177xQ\266\226\301\213\256\365\r/\252\326K^4\255ixQ\264"
+	.ascii	"^y\3213>\344E\315x\n/Z\306N^t\b\013\362\242d\034\205\027\025"
+	.ascii	"\302}\274\350\0303\341E\305x\t/\032\306IxQ0>\302\213\006\341"
+	.ascii	";^\024\b\203\361\242?\266\027\375z/\352u\354E\273\336\213r\035"
+	.ascii	"{\321\255\367\242Z\307^4\353\275h\363\330\213b\275\027\365q\354"
+	.ascii	"E\257\336\213Z\035{\321\036\357Ey\034{\321\252\367\242T\307^"
+	.ascii	"t\352\275\250\324\261\027\215z/\ne\354E\237\336\213:\035{\321"
+	.ascii	"\246\367\242L\306^t\351\275\350\016c/\252\343\275(\323\330\213"
+	.ascii	"\346x/\252d\354E\223\336\213\3420\366\242H\357E\217\216\275\250"
+	.ascii	"\321\366\2427\336\213\026m/J\364^t\350\204^T\350\275h\220\261"
+	.ascii	"\027\265\361^\264\206\261\027\005z/\372c\354Ei\274\027\3651\366"
+	.ascii	"\242=-\275(\317{\321\031\306^t\247\245\027\225\361^4\206\261"
+	.ascii	"\027\325i\351Es\336\213\3020\366\2428-\275\350\315{Q\033c/\272"
+	.ascii	"l\351Ek\336\213*\217\275(MK/\232|/\272\032{\377l\351\375\341"
+	.ascii	"{ox\354}aK\357\247\274\367\204\307\336;[z?\370\336\013\036{/"
+	.ascii	"\245\245\367Q\336{(\307\336\007\266\364\376\311{\357\344\330"
+	.ascii	"{\300\226\336\377\275\367~\306\336\367\265\364\276\311{\317\344"
+	.ascii	"\330{\276\226\336\357\275\367z\307\336\347\265\364~\311{\257"
+	.ascii	"\344\330\373$-\275G\362\336\0371\366\336HK\357\361\336\373;c"
+	.ascii	"\357\355Zz_\367\336\323\031{?\327\322{\271\367>\316\330{\270"
+	.ascii	"\226\336\277\275\367n\306\336\267\265\364\276\310{O\304\330{"
+	.ascii	"\266\226\336\257\275\367j\307\336\247\265\364\036\355\275?;\366"
+	.ascii	"\336\254\245\367e\357\375\020c\357\311Zz/\344\275\037;\366^\254"
+	.ascii	"\245\367a\357=\330\261\367AZz\017\344\275\377q\354\375\327{\357"
+	.ascii	"u\354}\327{\317e\354\375VK\357\265\336\373\254c\357\233-\275"
+	.ascii	"\307z\357}\030{\177\365\336[\031{\337\343\275\347q\354}\325{"
+	.ascii	"Ou\354\375\324{/e\354}\324{\017e\354\375SK\357\235\336\373\246"
+	.ascii	"c\357\231\336\373\245c\357w\274\367:\216\275g\266\364>\307{\257"
+	.ascii	"t\354}RK\357q\274\367H\307\336\037\275\367F\307\336\337x\357"
+	.ascii	"\213\216\275'j\351\375\320{/t\354}PK\357m\274\3675\214\275\007"
+	.ascii	":\366\376\347\275\247a\354\275\317{\337c\354=\317{?\343\330\373"
+	.ascii	"\235\022\275\227\361\336\3078\366^\347\275\3171\366\036\306{"
+	.ascii	"\217c\354\375\315{oc\354\375\362\275\2571\366^\371\336\323\034"
+	.ascii	"{\237|\357\327co?\337\333\207\306\3366|o\027\032{{\312{\233\320"
+	.ascii	"\330\333\316\367\366\240\261\267\005\337\333R\214\275\035\345"
+	.ascii	"\275\r\305\330\333\201\357\355'&\364\266\223\3676\240\261\267"
+	.ascii	"\377Z\211\267\375\336\333}\306\336n\362\336fb\354m\276\367\366"
+	.ascii	"\236\261\267\365\336\333y\306\336^\362\336Vr\354\355$\357m$\306"
+	.ascii	"\336>\362\3366b\354m\274\367\366\235\261\267\355\336\333u\357"
+	.ascii	"m:co\317\275\267\345\336\333q\306\336\206+\241\267\337\002\275"
+	.ascii	"|\333\234\317b\274\2121\2129E\235\230\037Ab\302\302TN{\031\024"
+	.ascii	"%\326\354-\013P \355\361\264\211q\\\030-\"B\2217Q\367X\213\243"
+	.ascii	"\251@\221\247=^\"\354N\320\306H\3315\255|\3274\315[yv+.c\212"
+	.ascii	"\312bM\314\030YLY\231\312i\323\274\211\330\005\310_\241\021\027"
+	.ascii	"[7\031\002UQ@\206\376\212V\\c\316\272\215\321vW >c\322\332D\217"
+	.ascii	"\037\331\236!\3610f\215HL[\233\312\251\017(x6>\236\224\340mS"
+	.ascii	"}8\301k\362\t\037wx\023H\366\372N>\337\353\033QJ\024(\201\317"
+	.ascii	"\253WPQ\234]\207\206\347\303s\341\331\360\034\023G\004\2349\342"
+	.ascii	"\263\2309\342_L\035\213m\314\035\321/\306\310\013K\304&\304\276"
+	.ascii	"\030$Jb\362\362TN\271\360U\177KF\\\007\302k\203\004\316\\\226"
+	.ascii	"\034\b\244UO\207\036\340\302(\021\"\347)_\200]M\023.\023\236"
+	.ascii	"\247\360\021\036\004\246 \232~F\200\310\323\252w\260\214{\263"
+	.ascii	"1R:\007\317\316\274%{\203\347+\250\264\246\240\224\263 \222#"
+	.ascii	"L\244\234\273\240\320\234Q\240\234\243\334\331\365\305\004B9"
+	.ascii	"cA\2415\331h\372\031\370\344\034xV\002G\234{!\306\021\345b\376"
+	.ascii	"b\234\304\004\006\252\234\362\223\267\020\247WPgN6\b\234\271"
+	.ascii	"\353\004\360\354\304-\n\340]\2002{\223O\\Q=\340\314\335\277V"
+	.ascii	";\377\261\337[\215\355EP\206\310\357<\004%\326\327\344\334\307"
+	.ascii	"\344\334\004\215\230\026\343\214\2312E\345\224\231\234\0051\241"
+	.ascii	" \276\2753\037q\b\261l\346n\371ic\fc\2361O\225S\336\273"
+	.string	"\013Pa\316\240'\313\250\220nh"
+	.ascii	"'9\bj0\340l\314j\013paU\356:\253\227w\326K\022\307\304\362\316"
+	.ascii	">OO\347\022%\347%Jb\220\231; J\256\342\2237h\304\325l/;Rs\252"
+	.ascii	"ro6\0074`\306\363\311\2003\367\305\rFrV\243\253i\302=\0373\222"
+	.ascii	"s\222\243}6Y\312%\221KF\207\206-\231\0311h!9?y:t\0361r>rC\304"
+	.ascii	"\362qe\344\260yC3\336\335\031\017\006\221\207\214\016\n22\210"
+	.ascii	"U23L\320\243\272;\017=\031:\273\354\352\316v2=\304(\342\023\021"
+	.string	"J\206\006\220\214\r\033*\247\\w\346y2l\322\021w\316t \250<w\342\016q\007q\351e\371ie\204d\210\210TNy\356\\\364T\350\f:\344\023<\234\340-\340\314]\271\270\263\334\rb\016\2458\270\2673\334\021\021\t\251u\364&\305\255\315\316nZ*\267\275\315p\020\211d\224\206\332\2424\213\020i\234\213p\251L\344D\032Lb\r\231\035@D\234l)\315\231\355\205\227\312kOi\230\210=2N<k\347\241'\265\303\263\332\331\21478K\200\312iG\017\241\2101d\244\2109D\035\031*\0362VV*\247\234v6\343\023lK\n\215\270\222\024p\346.\332\331\031\315\354|\226\3520\227\235\315|\020of\216\210K\242\215LSK\206\213\253\254\307\023]\223\311kC\002\316\334\035Bv\036\302\002\221\206\230$\256dg\273\247\266*\266\252+\026\362\261\263\020u\nRK\006\031/\225P\346\207"
+	.string	"\364\234cg\273\2471'\233X\330Y\354|\306a\377Z\325\r<\345\223`A\316`AT(\201A\234@~\234\201\204\251\200\177?\316SOa\315\256/\257\363\327\371lLm\"C\306\2472\221);\223IKS9e\257'0g\327\021\257\r6\324@\254{\332\204ta\224-\004\2667P;\345\234\255!\200\355\304\2727\020g \254\353\317\306H\331\305u\356ZS\225"
+	.string	"&A\302u.r:lni\235\267\210\250xM\356\354\264\316EN\206\316.\232\25499\2758\270\3469\313\311\260\211\345\343\214\325\206\324B\241\327\246\026\221\371S9r\227\204\b\233\217s\226S\241\363\312\352|\365\246\246!\265T\216\334\341\005\355\n!\247\242\311\304\275\204\023%0\230\314\3243\2319\231:\231;\031#*\247lu.r*t\251\301\033\354I\3355\216\253\034\232\032hH\231\2366\035\300\205\321\265\353\250U\214\256\235\375T\254=ez\357p\006\302\270\336l\214\224=x\234{\b\351\301\343l\344\004\245Y\205N9W\275}x\203'/@e\252\243S\220\250`2JT|\354\n\203"
+	.ascii	"\241\372\233\222:Oy\005\201%\023\245(u\366q\372kF1\3177\362\324"
+	.ascii	"-\231g\0064vP\264\262\242\316\200N~N\250T\311\207\035\340\317"
+	.ascii	"\256\020t\352\225\025\324\333\307\257I\203Z%Eu/\251#\274d\033"
+	.ascii	"\036`\206\"\315\323&\031\027F\325\216\274m*\252\366\306\031\342"
+	.ascii	"\354Z\032@\355E\2327\016g L\353\317\306H\371\344t~\332S\245\242"
+	.ascii	"\236\240\236\234\232\230\316MLT&\244\326\nK+\323\247.\311\374"
+	.ascii	"\251\370\330-\031m\355\320\301t\236rR\322\354\242Y\332q^r\242"
+	.ascii	"*!\265T|\354r$\341\330\341\354\242\321\301<\3538\367\311\004"
+	.ascii	"\252F\352\215\026\324\310D)\346\240r\312\314\263\217S\222f\027"
+	.ascii	"Xs\216\357\3128e\2464\347\020\r\317=H2\206\352\220\314sDR]a\313"
+	.ascii	"\330\025\302N\025B&Q\016\2344\271\371Sm\250AH\345\022y\003C\345"
+	.ascii	"\224s\274u8-\342t\347\354\342\0379\b\255fX\201\243\002\361\226"
+	.ascii	"eQN\360\222mX\2003\227E.\006\225\346\304&^.R\007)C\204\245u\265"
+	.ascii	"\341\0344\355:3T*+}\001|5M\270\253\372\b\2017CU\\^\241r\312J"
+	.ascii	"o\033\346 LgH\206\0010\232v\225\346%\230Yw6=\224I\307qNb\245"
+	.ascii	"3\216\267\r[ ,+\357\3460\2063\227\205\357\005\325\246\306\205"
+	.ascii	"Q4$\214\242\275\22538\337\372`@\273j\363\022a\315;\033#%\322"
+	.ascii	"\321\031i\206\032C'\007\310\021\216QZ\363F\321\371F\217\272T"
+	.ascii	"kT\245\020$Q\n\275\"5It\356rBs\016\t\235\207\316}4\322\303\027"
+	.ascii	"\031\364V\210#\251!\022(\206\245E\332H\013\221BS\220hH\242\024"
+	.ascii	"7\250\234\262\320e\330\353\032L\2357\334@\036\035\251\234r\320"
+	.ascii	"[\311i\227\023Z3\250\005\346\317\215\027\316\334\265Q\343l\003"
+	.ascii	"G\032\245\b\222G\261\306U\272\002\201\316nNc?4\316?\200\177r"
+	.ascii	"4\372|\234=<\347\036\276=<\2363\030S\336\2143\234SX\223w.\343"
+	.ascii	"\274\223d\346\216\301\224R$H\346\022$\217\030\226d\234\301\230"
+	.ascii	"\330\214\3048\3039\2019ur\316:;R\273&9W\351\242\203\361\304\271"
+	.ascii	"9\343\234\317\230\322\270\227b\332\204|\202\344Q\274\271J\327"
+	.ascii	"\233\315\241sYs^\026!2Xs\025{kJ\303&\323p\362L\303B\212v\206"
+	.ascii	"<\344d\031\257\316\0273\177!d\254f\34650\205!\317nM\205\315 "
+	.ascii	"\032\231\230\313\234\317N\227\002\371\221\203\344\001C\314U\354"
+	.ascii	"y\301\234\335\232\004\235\350\234\344\234\3406 sz\303[>I\200"
+	.ascii	"\001\250AO\233Zpa\364\354\354\374\304\205\263\253A'\021\0265"
+	.ascii	"fc\244t1\304]\234\373\222\244X/\bXrJ}\360 y\3100\304\021\300"
+	.ascii	"d\365\202w\222S\273&(\316 \232~\016@\210 .D\325\213\n=\250\224"
+	.ascii	"\252F\020W\261'\005\2043\210\346\345\207\277\234\317VH\237^j"
+	.ascii	"@J\245NH\252b\3324S\204\344\001\203\336\272\256\020P9\375\341"
+	.ascii	"50\261\245;\322%\b,?-\322\n\351\303\207\312\251\013\316nM\177"
+	.ascii	"\315\240\034>\341\244\325\302\231\273N=\234\252Z\320\342-8\237"
+	.ascii	"\335\034\3224\323$\244\026R\212\003\311\345\205\374\361C\345"
+	.ascii	"\264\305TS\0234^\033Rt\235\017\357\272 \351\215\"\037\2264\211"
+	.ascii	"V,N\264\nK\205\202X\234\257\232\2248\273h\372)g\306(\017"
+	.string	"6f\301[n,\005B\222\025\327\265&\206Mi\244?\3102\344\0312\r\231\246r\312\202\263\031\247WMJ\256xm@qC\243{L\3264\245\205\360\211\246@\026Vp\025|\005=\\\005l\243w\221D\220m\3159=\374qMoxJ\036v8\017\347\2378\344\\s\316\016\177\\\023\221\033>\321\264\266B\nV<\005:|\305\n{\240\346p\035\316g6Y\312\2724'\006\005\f\244\022\024pr8c5\2419Q\200\303Qp\202\343p\227.\323\232Ty\202s\217&\264f\027\215\tJp\023\234\317H\360\022\030I\327\030\026\220H\320'R\311\tz\206\350!2o\017\311\204\211\312)\t\316=\232\316\234\257i\262r9s3\310:\241:=mb\245\013\243ff\037\301\331O\004\037\001\262\017\235\362RD\235(!\362\317\t20P\345T\004\347'3\324^\027M?U0\273\352\364\020\224,\375\205"
+	.ascii	"\004\017\301\007\016\202%h\224@\024\n2\nR\020\351D:UN?p~\362"
+	.ascii	"\t\266\"XF\\'\316\334\021C\004\220\302=%Dau\312\356\201wR\007"
+	.ascii	"\356\201s\007\316@H\312';\005\346\024T\264\354)\334\271\220S"
+	.ascii	"8&\264 ybF\312~6\361\340-"
+	.string	"\237<,\304[>\271\203\020o\371\344\216A\274\345\362\013!\325\220yg\210\327\224\023p\371$*"
+	.string	"\016l\340\0348#\247l\340_\323\321\374\222\016\037(\230\240R\321\2700:d\310\231\360\2043U\252\223`\006\215u\017\023\316\334\325Q\264d4]7%\264\320\032\310\3005\300\311\306\300w\221\317\231dsN\006\370P#\233v\207\342\315(\227377*\247\0308\327`\ns\262\241I}P\0018\023\245\343\013\274\375b\232\230\363\335\031\235\031\031\3159\0278\023r\312\205\01691\347\3339Oh\372\331\373\245d\021\316\236 \022\316\334\035\362n\nRG\200$`FF8s_\250\0268'\315\230\371k\316\261\300\231\220I\220\351"
+	.string	"\022\001\204\364\352\306\205Q2\262\363`\bdO\257N\2029#\315\306HY\001\n\274\002\347\276\t\234\002MP\270\230\"\332\204\276\3158\365\314HM\340<\310)\326\222a\023\204&\023\251\021\f\027F\205\240P\214\n9K\341\034\314\252\253\026!O\215N\"L\306\037\234[\02165\245.\274\245\013K\341\r\366\224\270\360\226O^\315/\317\304\231\2532\344\201\272>mb\033\027F\307\256\343\204\321\261\263\037\253\370\255\233\363O\371\301\330\325\365$\2301\336l\214\224\022\210\300%"
+	.string	"\201G\200\006Z\206\027e\b\031\004\2324\037p\303\037\340\200\337"
+	.string	"\204\212mA\t\003s\200\263\001\fx\003\026p\006\330@\177`\005~y- \257\251\200\004\\\0016<\001B\350V\217'ZY68\021P\303\021\240\3425\020\241>\246\234\\Y\2518g--iv\321\320p\200\323p\3563\300\0170s\003\255\2329ba\023{2\332Z\327\232\030\030pW\b@\224j\006GJ\bu\243\265\265\256k\001\244\320\251\031%\346\314\016&\225S\003\234\3758\315ZR\342\354:c:\361\360@\206\326\340\f}\232\221\nai]i8g\321&\324i\306\tjFJ\212\311\222\f;\n\263\0313S\322\024\274d\033\002\340\314e\311\352\240\270|\312\307\201\013\243b\327Q\036\025;\037\006\241\253iB~\333\003\332QB\354\305\345;P\222#hc\244\234\241"
+	.string	"\237A\206\027\340\374\004\3251C\025\203\336\272\326\024`w\206\007\312\234\321J\241\267\2565Jh\216\031+/\225S\031\316M8\225[z[\264\237\265\267\016bxQ\3716\324\241\027\3051\323l\316\331\026P\244\031-\256\031\257\235\3711\023\2449'\313\003\212!~H1\304\017\306\345\001\305\017+\206\350\201\305\362\200\342\005\b\037V\260"
+	.string	"\342%\b\025\350\200\203\b\313\003\212\227\025:\264`a\202\034~H\221\203\007\313\003\212\227\026B\374\260\342%\205\211\345\001\305\013\017@\340\300\"\205\017-X\260h\221\303\007@\370\260\202\205\017;\364\300\202\004\264\370\301\305\016#\200\360!\210\0269\244C\264P\200\016+V\340C\017,P\031\242\005\n\236\003\373\260b\002+X\340\340\003\261\007^\301\002\034rxIuhA\001 x\330\241\007\026\244 \203\027 zP\300\0168\260 \005E |\b\242\305\002V"
+	.string	"\341\002\005*/;\340\300\002\007\254`\001\npx\351\201\001;\370\320\003\213\037p \001\304\n\r\274@`\005\213\0366\260\002\b\034\030\220\003\020?h"
+	.string	"\204\016\255\203\0178\260`\321b\001:\254"
+	.string	"\342\207\026-hA\020/>\004A\002\210\027\035~\001\rP@\007\0269\250\233\003\212\026\274\260H\321\202\027\026)|\350\001\007\026)r\370\341%\005\n\016\266E\013V\374\220\002\210\026-~H\361E\303\317\261\034\306\305$^87i0(\035\263\031\253"
+	.ascii	"N)\273Is\301\374BE\177\240_\237\001\211\346\312E\177\034\375"
+	.ascii	":\207\261\n\\K\202\344\215\r\321\240\353\272\2561\3579\0044\342"
+	.ascii	"\002\004\322O)N[S0L\326Q|B\020\310\305\231\273^]G\275\214\214"
+	.ascii	"\250\242\352\262\343\332:\312\205dD\024\324V]S+\353\250\226\222"
+	.ascii	"\021MLY\316&\326\321f\336\b\035L,\272\246\217\253\243>\366F$"
+	.ascii	"\341\270rZ\3658j\305d\204\321\215\036oM\036UGy\364\215\030\022"
+	.ascii	"\252rRM\035\245\372\033Q\003h\312\255)\025uT\312\311\b\037\031"
+	.ascii	"\262\0364\352|\305\325\346D\241\320\247\243PC\004\216\330\031"
+	.ascii	"\021c\204\214!\242\f!8\204s\b\247\312)\372\304\325\326\354r\342"
+	.ascii	"\265a\210 \372\351\005\250S\323Q\247)\r5s\327t\036\342:k2-\035"
+	.ascii	"e2\\r\356\320qt\307\020O\035fMf\216\243\314d\016\247R\322Q%e"
+	.ascii	"C\275$\235\203\270\306p \035\305\361^6\324\013\3229\210K\314"
+	.ascii	"\331\205\036\241FG\217\3367\r\205\032\235\207\270\304\2048\363"
+	.ascii	"\3069\251\243\032\352\306\033\212I\220I\261q!|BJ\017^\262\r\203"
+	.ascii	"8sE\230q\343\360\005\335\341c\332\215\256\037T\260\030\245\273"
+	.ascii	"\316\026\321\035-\272\272#-\017\2103_\236\003%\372\017A\370\264"
+	.ascii	"\232\317x\210\013\235\342\272\220\341bFs\016Jt\336\013\254\303"
+	.ascii	"\253yr\310\360\350\320\331\214U\254TT\350\250\241\210@\021P\\"
+	.ascii	"\364,?\255\013\032.\200\200TNQ\241\273\260\025\245\271\305'\002"
+	.ascii	"\211\340\375\020\204\3328\032\344\302\206\b@\021\177\250\215"
+	.ascii	"s\325V\237\263\006\nt\264\206\220\210&\"\370D0qAt\303\305\321"
+	.ascii	"\221\312)\nt\276\332\312C\177P\032G\177p\210\310#6\021\261\004"
+	.ascii	"\245\321\265\225\304\331\204\327\006\027\234\271\353\323s\324"
+	.ascii	"GI\004\022\273\036#<t\315\031;Gg0E\330%\331\241\223\361\026C"
+	.ascii	"\347h\214\035\"\342\370t\336r\2340p\216\302`\022Q\004\020\347"
+	.ascii	"*l\350\315\371j+\r\265A\227Gm\234D\244\275\274@\n\272<Ck\316"
+	.ascii	"W[hNT\211\322\034UB\211\030\362\202B\224F\b\232Dk\242\353\363"
+	.ascii	"\350*%\"\354\205\346\031\344p\314\260\3607\244\022\361\205S\330"
+	.ascii	"5\305I\350\374\ty\210\320\332q6\007\305\232\202R~A+\021W?RzD"
+	.ascii	"qB\t\374\241\370\020A5s7\024x\025\251'g\254\255\260\246\023\300"
+	.ascii	"\337IS\304\323\314\035\022\240\210\246\2773\326\026\2303(\212"
+	.ascii	"O<\351i\301\231\273\177\204\177\203\177R\374\336\367\373i\211"
+	.ascii	"\310\361\242\003IT\354\273JR\223\363\225\226\240[\0216\265\277"
+	.ascii	"\256\277\255?,\274\345\223L\370~&6f\356T\210\250\001\364\304"
+	.ascii	"w\0254\366\372\232zy\277\036\317\314]\rK,\210\230\261S\225\367"
+	.ascii	"\032\230b,Q\362$\277\022.\0210f\356T\254 \002\007\t\364\202\236"
+	.ascii	"\210\233!\260\220D(\226\222\\\305\336\022\311\031K\253\311\021"
+	.ascii	"#\377\021/\0214]FD\254xK\376\356\354\376\273\037,\205`v\204u"
+	.ascii	"wts?]\020\026\301!sQ\344\350\342\340\376\2700\226'/jp\200o\347"
+	.ascii	"+\25579\267\266\337m\214\245\311\213[\033_\221\363\225\226[\323"
+	.ascii	"\255\b\233\032\021\266\237\b\031\013\222\027:6#k\347+\2554g\220"
+	.ascii	"Z\332\257V\306b7\304\2214\026:\2643\226V\332\231\331\177v\306"
+	.ascii	"\0227\204\236\031\313[\331\031K\013\r\313\357\312\257\207_\325"
+	.ascii	"\220\223\375C\322X\324^\206\360#cA\023r\276\3222\3633*\032\362"
+	.ascii	"\013\302[>I\346g\243\367\370\204\037\020^\2133w\001\335\230\024"
+	.ascii	"a\242\306\244\213\311\026\336\362I\f\346\324\306\304\376\261"
+	.ascii	"5\026/(b\\a\316 \260 ?\030\021\226\254\231\273!\b\203"
+	.ascii	"`\0019ce\3355\203~|\375?\332X\254z|9\273\274\272~\2577\026*\031"
+	.ascii	"\262\251\256\263Q\226]\223k"
+	.string	"\353\347\212c\201z\301\331r\322:_e\3255\203\262\232\177\326\034\313\322\314\335NS\007\326\031+\213\256\031\344\343\352\367Q\307\242\224t\345\264\352\361[\335\261\034!\265\214z\234\213\262\336\232<\252~\036FX\210\206\252\234]TS?\225 \213\r\031\262\032Sg\243,7>\251\250_\n\t\213\017R\213\245'\352\\\224\325\326\204z\372\241\224\260\354\274,=\261\304p:_e\025q\00651\375My,0p\230\316FYE\232]K;\376\245=\226%K\315\216\263QV\232\263K\007\363\327\301\204%y\305|\3468ce\2455\203\224\222~\245\276\225\302\255$B\034g\254,4g\020\322\321\217\364\267\"(\345\350l\224\205\326\3542\272\361\0339Y\t|r\343l\224u\346\354*\"\372\213\002W\376\206\020\365\r\235\261\262\316\232ABA\277P\224\025\276\231\273).\324\220D\017\272\312\212\336m\234\261\262j"
+	.ascii	"\3755\376\363\003\271\020\\Q\"C\226\344?EYf\315%\2746\370\260"
+	.ascii	"`\274m*_\020\336\3624\356\363\323p\341\\\271\253[\261s1\305\205"
+	.ascii	"\241\013\027O\225\323\373\234\247\262\302zx\376\236\363YrE\016"
+	.ascii	"\251\025\307s.\312\002\233\361\235\177\306e\374;g\345\212\333"
+	.ascii	"\314Q\233\214\263Q\026X3\206\316\037c\271\302&C\266\246s6j>\235"
+	.ascii	"90\376\234\233\025\2643\030\317&\316\315\217\003ce\b\331\315"
+	.ascii	"m\276\374m\304\302\276<\0275\017\233\257\271\362\257\321Y\001"
+	.ascii	"\362\003\306\306\227\362\214\3254t\311\203\202\267<\315\223?"
+	.ascii	"\r\214\214\225\255\025\255'\317S\315\302\257\177\376\353\214"
+	.ascii	"\025,\0312\024z>`l\254\260t\365<g5\013\233\207\206\357\303\236"
+	.ascii	"\025\036UT\206\205S\336\2054V\242\220Z(\226`\200V\240`l\254<"
+	.ascii	"\365\2243VS\220\320\371&\024ZaZ\331\261\262\004Ct\003\346\350"
+	.ascii	"\310y\036jJq\346\3055\222\2747\274d\033\2628s1\260\222\262\202"
+	.ascii	"\224\357 \240YE\251 \335;:w\235\035\034TJ\022\354kJ\211\362\226"
+	.ascii	"rd\004\343T\354(\347\254f\023(\201o(DC\035x.j6i\366\023\"\317"
+	.ascii	"\373\311\333\311\207\332NN\344\351\277\336\205Q\202a6\347\264"
+	.ascii	"\223\177-\017\360\357\r\b\263c\345\007\251\265B\343\357\\\325"
+	.ascii	"L\322\354+\354\233{\367]\335A\364\307\202\0312Vv\226\357B4\337"
+	.ascii	"Vp\346.\323\212\016\214\225\034\030\247\027\226\326u\205\202"
+	.ascii	"\221\302\200a\250TN\323\275\013\321lS\001\221\bw\223\177\257"
+	.ascii	"\246\ty\254\334\254,Wl`\254|\3004\233M\336N\214\0226\213\024"
+	.ascii	"\365P\205\267|\222\t\337\233\211\326Jr"
+	.string	"e\3453k\356\351\275\367\270T\f\013\365\316X\315\261\274%\357<\030/\025\247\212\240\312 \fL\020\030\230%X\315\261\246\020\257\r<\374\340-\237\\\342\263\244\3475\370\004\222\347\0160c0qN\274\232:>\201D0\005g\356*I\362VB\246\002(C\366\327I\316WXP\234]\215\244\217\274\221\300\224\365\221\177\r\311\032\236\362I$]x\313'\215\340\275\215\300\234\251\354\251\344\251\350\301\244\255\301\020!\242r\332x\347\036X\177H\264\360\360\370\004\022\037x\3116\\\321\3260o0qH\250\212\240\t\001\352\200\2024\347iS\t\\\030\225\223\313A\356i\316I0\013\323Ppg\367\276;b\004\357\316\256\217n\356MG7'\0277\027\007\367\216sk+B\004\256\211\233\233Z\032\332Y\267\235\007\245\362\232\310\017\200\264|r\b\213\032\364\310\204\214\021\311K\327zIe\006\367\332\32350\230\276\032\202"
+	.ascii	"\371\261\266\004\207\023\240\235\241u\rQ\341\322\333\202\t\224"
+	.ascii	"aI\353\354\275\304\016(\222Rb\2023wQ\022\240po\277\353\224\371"
+	.ascii	"\275\313\3369\330\001\314\302\261\022\214 \225\361\326\301\f"
+	.ascii	"\244#\330\3059.\214\306]g\321\021\240o"
+	.string	"\357\034\314?e\202Q\234\263\374\242\242pqo\035,\200*\303?\022\234\271\255\203\331\206\216\240\235\b\322\030_4\004(\334\321\267\353\304=\225q\022\314)w#\330a\024\356i\214\263\204M\371\023\301\020\262!\327\200\025L\037\213\231\251\364\200\371\343\260%\0360\2011\350U\221\275u\260\003\206\244\354B\360\001\242\333\323\246\031\027F\335\334\3368@\340v\242\333I0\235\177\0378sW\210\2209\225(\250'\247\261\267\246X\330[\254Nei\207\016fX\203u\2207\330\235J\022R\013\007\322Q\220\363\240\224\033\220\037o \347>#*EH\255\032\226\210`\376h\320\033\202\tD\261$\364\343<(\325\346\374\"\326\274\277\3368RP\333\353\304\032$*@,j\320\373\201\371S\261D\003&\020\205\236\217\327\231P\252\255\371\3268\232jw\275\337v`\372j\220\001\363GC\f\230@\024:\335u\036\224*\342\364"
+	.string	"j\264>\251M\256\003\315uN\n\302w\326\275\365]\230<\230\275\346\234\346:\007`\230\250\340\300\364\361\330\322\272\326\260\251\334\300\374q\230\336\272\326\3008Q\261\201\t\224A\245Fe\t\003#\b\003\343T9\355\2557\016v@\221T\032\007\234\360\252\320\300LQI\302\030\252tU\255m\340\314]\255\254\267\026\314\263hX\230%%\326^\2746h"
+	.ascii	"\003\304\037O\233^\2700\332\326\366n6\326\273Y$,:\261\33672\320"
+	.ascii	"v\342\217\207\240\344\317\307\325\333G\352g\365\276:\333x\300"
+	.ascii	"3wj\367x[\235m\252\224\375\334\346\361\356qTI\262\030\210\324"
+	.ascii	"\342\r\216\024\"!=q\302\343j\221\024X\263\212\352]u\356S\026"
+	.ascii	"\375\220Z\031\370\b\036\355\nQ\244\330\027\263D9p\"\250STdRl"
+	.ascii	"\022s\003#FG\006\325\373\006\247O\242\236\0308swJ\352=5\243\250"
+	.ascii	"\227'e\030\005\365\216\352)&\221!C\002u\276\212*|z\242Q\304C"
+	.ascii	"j\3359\235{D\0256\233\230\336M@E:\031\2629\246\363U\224\240s"
+	.ascii	"i\307{\311F"
+	.string	"\021\356m\307\271G\224`S\207\016\241b\021\266\"\221\030\242\0331GG\314\036QR\234o\0278s7\207\322;\007\216b\032\232\022\224$\034\357$\245b\031RkH\3438\007E\371\261\314\361 !1\213baGwM\243\033o\243\035E ?n8\213\210\336EL\305..\"\273\346\220\320{\310\251\230\325\024\n\272\215w\020T\361\n\251ee\343\034\024U\007h'\207\267|2+\313\ro\371dV\r\240w\r\251\342\023R\313\t\350\034\024\205\326\374\241\361\376\241*.!\265v\3208\007E\235\371\364\274}x\024s(\365\234\361\314x\363X\025\221\216f\230\355\354\370(\026!\265\210d\234\203\242\314\2321t\3361\232\305 \033:\316\034\030\357\034\255\342\017\r\030\347\241\250\261f\027\r\016\016W\221G\206lF\337\234\207\242\304\332&\212\365\250\224C\226\nLN\204\221\230\205 Chj\004\004\001$\203\031"
+	.string	"\b\306\361<\220\303\022\362"
+	.string	"\024"
+	.string	"\020HrJvdD\036\023\3234C\0219\027\001\021"
+	.string	"&\t"
+	.ascii	"\356qv\363\244+\303D;\260>\314\026\307\002\337\025[\265Y\371"
+	.ascii	"\017\214I\352\013\361\2151\017\264'\370T\032\310S3\230j\307\330"
+	.ascii	"\316\327\2633_\232Zj{\364b\036\031\374\245@)@\312\344PCp\310"
+	.ascii	"\273A(\2018i"
+	.string	".:\t\016\330;\250b\200$\301EE\341\200g\203R\205\2154j}y\330o\201\031\277\330\315\357A\t\227\206$O4\316\224\250\324d\351\007F\013\271\334U{!\201\341\276\177\300\005>8i\\\325\201\275\375\224uf|\202\332U\ttp\006\350\021H;\234\351\b\220\275F\334\025\343\217?I4E\031\177g\324\353W\367D\025Iz5b\250\271\370~\340\351\265\273;\310\343O\273\326\316P\233\243~\021\312\034\253t\004\360\245-\364\206\\\247\252\316P\246\301\\\034\350\217@\344_\206\301\025p\367\375.\313\2503\345"
+	.string	"\371\267\031C\200h\243\307=j\274\375{\375j\204\276\260\336r\250\nP\360\243\352l\266"
+	.string	"I\302M\220\026\303\023\313\262\002!\230\b\371\373\220\326c\313\333\375cQ\303\252\255G\013\353t\245\037.\350-\314\367\245\327vQ\221\304\f\255\252\225\2425c\221\3157CI\002&\310\367OQ \370t\315\235\241\350\271\316\237+\036\235VC\265N\361b\313\361\033\267\236/JE\264\265\331\352G\246\031\004\203h\210"
+	.string	"\261K\307p\035\307\352)\243d\232\223\232\307\3517\350z'\204\003\340\306\035]\035]\335\033\255\316\355\f\361\031h`\027W\305+\366\2239\366\2142\324\215\341\031\006g\0166c\233\036\256]\302\320\262\2723)\355\361\373f\024\233\353\251\264\361\232\277\306\241\361\0363`\364\037\256\253\016I\315\002\337\271\335fA//\260\360E&\013\265\271\266\t@\310C-\354\231\221\354Z\213\006^\360>\006\364n\r\0354\013\024\325m\026a\023\030\264\333\373\320\333d\351}W\327H\270\206\220\241\326\fF\221\241\016I\341_-\300o\373\304\3560E\022-\t\215\370l\233`\234;\241\3721\326\322\326\351\236\013\361\343\235\023\206?#N\371\253fDt\3203\2455\314\302\220+[\311\325\223\302\321\2108I\267a\272f\201\207\fy\234\202q\0368r\222\212\303\020"
+	.string	"\203z6\205r\314U\247Q\005\b\262Vq\001\263\005m\bvB#\321\367\036\372i\273c\022*S\321E\231\310\221\322\302\017]\033O\372J\026\223>\036\224\205\241`O_p\245K\372\331R\351^kw\332>\312\366MP/\364\314\217?\027\371\343=\314\353\300\330'\254\333\b\236\314nu\213H\345)\235`\263\261\006WT4\375\326\270\366\035f\325H\b\210w\304T\201RYa\tK\371NH\027\270@\350O\016w\257}\301"
+	.string	"\0078\005l\t\203\252n\306i\264i\226\307\243\306o\202\2023\332RK*\356YD0\\.$F;\271\027\032aX]_\026\252\251\b\232Sr\026v\020R\030s=\326\002g\020\333\266\035}\313\332\350h\314#\t\227\266\227\370f\315\204\002n\234\357\334\020s;@\255\235\267\216"
+	.ascii	"\226  \215\274\256\333\267t\026~\363\243 \032\272\202\203v\335"
+	.ascii	"N\034r\343<\241\311\201\341a\235*\301R5Z9`\364\001aYe\246\276"
+	.ascii	"\370\025\350\211\300 \301i\254\311\013\365\373\377\311\350\353"
+	.ascii	"\307\fxr\013\210A\033\362\004\030\t'r\364\270\345i\025\321\343"
+	.ascii	"\306\365\376\327\001\223\256\264\b\352j\356\222\017 \024}\241"
+	.ascii	"1r\310\353a\343\310\320\032\207\243\246\365\236~\374+\003\027"
+	.ascii	"\261h\346\325\200Q\325\036\265\236\203P\316\212\332\026\216\024"
+	.ascii	"3 \370 \326\r\r \234C\0331\241\001\324\324t\321\372Bn\204\003"
+	.ascii	"\362k\351)[\363\304`+)s\035\212M\204`\262dZ\270\311/\253F#O\b"
+	.ascii	"A\026\001\221\020\321&h\306\213\303\314=\333%\223$M(\300\230"
+	.ascii	"\025w\305\250%Pm4\253B\335\r\316X!\315\034\237\373\262sS\311"
+	.ascii	"=A\257K`\314N=\0262\275\222c\f\321\350\200\352\003t\027\371\365"
+	.ascii	"\3606\252\262l\036\307\177\222\333~j\345V\246\006\034s6\b6F\312"
+	.ascii	"\371a\3470\006\211\344h\265\206\304\343\361\t\350\210\305wO\347"
+	.ascii	"a\374\335\340\246H\307\211V<\261TsH6\361|\241\026\030d\003\020"
+	.ascii	"\337\":\212\223\214[\253\2353\344\225\351\354\007\336P\022\271"
+	.ascii	"\211\002\255\273\346\274Z\353\rw\177\030\252p\232R\260\327\026"
+	.ascii	"7\223\207\226\320\213s\374(\006\201KN\030\341m\261\314d\242\275"
+	.ascii	"\2069\327\303\304YU\215\3006\201\225sma\313\244\233Q\265\375"
+	.ascii	"s\031\\g\2454\004\233\001<\245\335R\001U\263\214\206\236\234"
+	.ascii	"+\226bl\246\215\245ty/\003/\210ju\210flrYd\205\354w\24354\353"
+	.ascii	"\021\210\263,i\373\232\373\360\313\212\036\315\202Woz\343-\256"
+	.ascii	"\224|\232q\237\274\036\026\317\377\301\306(\247\251\200\236\346"
+	.ascii	"\211\024\020\322\235\273\205\034_\262\271r\005\023\343\b\020"
+	.ascii	"\243\200\233\026\001\335\234N]\344\334C\216u\270m\233`J\315\377"
+	.ascii	"\231\t\351&fX\252\227\026R0\302\373\325\025gj\362\212\240iu\305"
+	.ascii	"0J\322:\353r\300>l\346\020\365\365U\216L$`\f\207=c\020I1\037"
+	.ascii	"\226W\220\370\246\r\242\024AQ\255>W[#\232\210\3003\005)\"\300"
+	.ascii	"F\224\006z\246\306?e\250>t\275f\233\3463\311\376\223\333 \354"
+	.ascii	"\216\020 \224\261\025\252\207\374~\024/SN\fv\226\312\235\275"
+	.ascii	"_\t\2710\341>\320\311<r\223b\315\257P \n/\024\0310\265\023\035"
+	.ascii	"\213\356\024#\364\245\207\004\256\311\013[p\001U:\276\344\252"
+	.ascii	"0;\205E2\242\n\353\"\210\270\3177M2\355\n\237\227[p\332!\325"
+	.ascii	"\021U\264\363\264\206[];h\275\361\221\020,\260x\031\035\334\247"
+	.ascii	"\350\343\362=\272^\315'\341x\247\r.\232\305\006\026\244y\307"
+	.ascii	"\273X6\314\020\020\203\3754,f3\031\331=\242\013\367P\324\262"
+	.ascii	"E\003\006\030\242`m"
+	.string	"\366~\324j\22425f\343\021\3356d\002\3047\353\246Q\214e+\177\227\312\320%/\236n\242J,Tb\272\201{\021\254\243,\031k\345\227\021,\b&\310\253\217\024\360_3\314\327I\030s}\226y4i\312Yq\005\312\270\270\254\203\222\252;\251S\300\312\301\234\030\202\372\025\211\206\277c\355\304\035\372+\305\266\351\3071\004\212\266\325j\376\276D\035\334\220\355\022\210\005\220SX\272\227J\252\260\335\331c\303~\240\2617\002\262\020\025\254\264j\320\225\336/u\253[\232d\333\325hX\031T3\035S\254S\225\222\be\023\240W\256\227\320O`\n\267X,9N.b*L`\200r\251%\035\313\217\301\013\016\362,\033\005\343p\267\370\326d\217\300\256\357\242\332b\233\rV~z\254\220D\332p\365\2151[D\013\314\266\"{\304\0044-i\342w\232\013\255\331\343\362\260\327\310\273\232\032O\332}-\247\322"
+	.string	"J\2768\351e\251\177\032\222\362B\355\256/F,9\365}\336\214\365\226\004\270|s\372\b\320\267\245\274\335\033\007\202W\317\302\024\337\243\225oc\365,@\032\266KV\206~\210\221\256\350\023Am\352\323\034\030\224\370Mx\322;\243\177\365%\rf\017\f\217\251\205\261\307\330i\370r\312\315*\003\261F\230\017Sf\266\200\206\324\375`\036\303\334\032\207P\327N\013.\226\022\350\002\002\254x\205<'\215h\032\351o\346\317>\037\201\251\213\342F/\377n\\\003"
+	.ascii	"\017\225u(V*]M\203{2E\213p\267h\276\031L\027\261f=\342\372)5"
+	.ascii	"5\243\211\313\375l\233\311\036\204\033\304\214\001\322\350A?"
+	.ascii	"\367\231F\0165\024\323\f\364\352\223\332e\220\226\333\024\335"
+	.ascii	"\364\250\255"
+	.ascii	"\300?\260i\324`\335q\005\020\177\355\333P\250O\331/\221&S?`)"
+	.ascii	"chZ\177\206\304<&\220\026\325k\310\304+3&\316N^\fE\264 \267\033"
+	.ascii	"~\363\377\346\204\334r\335W\224J|\312\336\007\032\204\237\350"
+	.ascii	"a\202\177U\034s\357?_X\251\226^\212E\231:\302\250\256\2033!\252"
+	.ascii	"^*[\005\204uY\013\002\300\300!\337\235\267\365\212\235\0164\324"
+	.ascii	"Ms\"\270d\251^\305^!\336;\026Z\361\224\026\266<q\243g\305\224"
+	.ascii	"A\026q\223\030\301\t\t\363\260\305\276Q\356\244^\027\004\270"
+	.ascii	")\306^\223\365\352Z\353\246\360\201\"M\224<(\350\230\233\345"
+	.ascii	"\250Y\227Q&7\200\007\252\030\223\202\234\376W\344\265)A\336z"
+	.ascii	"&\276\255\267E\356\204\206e\362A\213A\220H\365\220\333\343\016"
+	.ascii	"\250\353;\345\230\3151k\305\n\017\222 >\306X\026\225\"\013\031"
+	.ascii	"\324\006;S6\213=\322\350\333[\310\251\177\203\200\320\256K\227"
+	.ascii	"\202\t\270\336\t\3013\f\222\035\024>\301\"`\326\311\224\237\332"
+	.ascii	"\0363\021\036\315\237I\b\351 -\bb\233\344\211\261\300O*\350\371"
+	.ascii	"\" \217\030<\"0LfM\373\234\366\345\033Wm@4M\\\246R\302\214\375"
+	.ascii	"<\207\024\026-\251N\216\277r\f\334\b\362\273%\366A\220\302\211"
+	.ascii	"\374(\204\266\002\017\\\3556\324\306YZg\302\263\031\325\346\325"
+	.ascii	"U\250\244\201\373\202\031\243|;\265\254k)\231\324\225\006tl\231"
+	.ascii	"\032\240\256J\241\224\317\204Z\346\ta\340\333]\353\237\224\356"
+	.ascii	"D\327\211\236\f\035\351s\277\337\001\362\210v\022\2377\231V\243"
+	.ascii	"\\\307\034\201\264\377\214\205U\033\257\315\035\020f\024\233"
+	.ascii	"\034\231]\031\005\351\327\316V\262W\375\032\231\201Tc,E:\356"
+	.ascii	"wY;\362\345\211\212r\377\021\377tc>\206Fz\025\377-Q\347\311b"
+	.ascii	"\314z\271t\214\2419\354\246^\013r.\326z\242\241`\312\334\333"
+	.ascii	"\206\023+Z\205<\026\205\324r"
+	.string	"^\022\315\n}G\327\207>J/\300\177U\361\305\213\260\262\364\255fd\311\253\334Q\220\005\276\334\204\220\220\3130\225\013\342r\t\023\352\3140\re\\\277\b]'\f\200\032\030\272~\244\222\001{-\203fnt\351\021)\005j\252\351|v7\313\320\346\322\352\273\313\2349\265gf\004\227\225\034}\377@P\221%O\013\327?\236s\271\005'\302\005\007\304\373Z\023\376\332\240}\310n\322\216&=\276\335\374yl\257>\350\260\374\"/\205$J\215\247s7\346\340Q\322\037\212\002\243\205tP\235\0132\354.\270\326\212\373\022S\303\205\3001\362\271\037,[\f\200\f\035t\267?9\340p-\302j\332\016\253\275u\017\246\"\341EK\304\001Z\002BE\217Z\247\005\367\301\306\n\236\351\"\303\2442\210\355\351\217\360\345\262\354\376\217\374\224\032n\216z\205\213\362\261V\354\2671\230\2142\3646{cC\264?\307?,"
+	.ascii	"\262GQ\236/l\031G\231\253\253\244\342<u\260inC\272\346\323x\332"
+	.ascii	"\354\311\334\313|\266\316Q\270\365\224{l\n\306_\273\251\351]"
+	.ascii	"\263\023\020\301\363\030\372D\263Z"
+	.string	" \374mr\257\234\034\"\031\2671\n3\213\365\271\236\272\003\276H\303\332ok\263\003Z\302c\023l}\274_\236^P/\314Dj\024\323\245 \274\270l\232\242Be_n\335z.\371\305\025\020\257DOH\f6\032\031\004C\224\016\371\334v\374\025\235\r5\2632\361\201\036\277\t\257E\b#\276-\345b\0074M\321\315\036;>_\034\226\004\275\\\315\236\017\352\002\237\233\306\260Q\022\374\032\345\205$%\325\303\003\002!1P\354\030\315\304a\231\fH}!\257\300\255\342\025i\b\257\\\356\367\342\226{\247P\367^v\t\371\253\231\256\330\007o\276\033\032y\354\316\032\350\036\336\355\264|\020\251K\300\312\343\003-\240\256\004\022\013VG\352\351Bn\037v\300aT;\310\240\036T\355\341B\352t5Cc?\367\311\201p\370|\327\r\272 \330\230\036\342TMf\252\240\251C%+\211_/T5I\022\371\360q"
+	.string	"\324\344R,\252\031\025`\361\323\376\n"
+	.string	"\214M D\341\222\251\216\020,\222\2524n\254\356\323\357\330r\254\002$"
+	.string	"H,\3412\007>\377\207\333\374\221\361\002\345R\nfI\213\244\230s\361a\371\016\325|\372}\313\367\340\314\005!\341\3555W\206\247E'lb\013H\262\374\276\374\343l8}\3335\303\211\361\215\033\217\325\323\237 \252\267\333l\232\232\021'\247\361\246\366 \023[&\345\202-;P\263b\023\306\212\261\001\267^\233\206\036\375[y\317y\016r{\n\362C\2500\225\0040\0174\351\001\234\362\210\203\212R|\2767\207\367R\314\201\222K\345b\306(\363\247Y@dq\224\005?c2\001\337\020C*\346\220!\335\260\372y\0277!\215[\n\243W\200\344l\363\364\006]\243g]~y.\263\237\365X\b^\0252\t\260\355\230\275\030o-{`\211z\036\251\203\201\017tp\230\251\317"
+	.ascii	"\004\017\347\210\263k\3526\256|\231\351\226\3573jS\376)\0279"
+	.ascii	".\242\255l%\207\241\013\303\235\310\f\362\377\020\346\267\036"
+	.ascii	"\370&v\002+\243GW\343\253\034\036X\037'[~\342\252\232 \025\264"
+	.ascii	"\036)Rb_\3171\2704\035\270&\n\350|\032\323\306\013[\371\366&"
+	.ascii	"\257f<\330})\306\013HU\022#\267\253Y,(\267#v\301\271W\221D\341"
+	.ascii	"zO\206X\034J\214\316\335F\207\325f\332S\327\220\250\252W\222"
+	.ascii	"\370\304\200rO\300:q\207,r\242\224g\034\217H-Yf\007jY\200\347"
+	.ascii	"t\300\006W"
+	.string	"X\360#<\b]9IK\346\250\342\331\n\245\2547\302\224i\203\212\263\363\007\020\337\322\271E\246\031z/\022\221hx\275?U\323\276C\367\031\234\213Vb|F\207\374\320\013n\350E\341\2758\300J\272[\352\037\215\344\230\232F\313\247\372\r>\362\214\344\020l&\326\207\253\237\302\024\321\313N\374A\026\220\230+\234jA\314\3208s\376\254\337W@\202\020\t^\313>\335\300y4H|\346F\275\355`|\211\fq\277\3405\243\362\013#drJVTmk\367\024\375\230\307\267^\306%\036\322A\205s!\223\214\310\362J\033\335\302\201\037\267\305\031@%(\270\271\252\350;\360\033\002\342\036\323H\035\332}NN63\013\233\270\352h\"J\034f\017\316\005\263\375\322\330\312d\355\207\033B\302\337[oo\231\007\341\r\025\265\024\"\305\006\274\233c\312<\202L}\322\201\017\226$\370\305&\0162\356mxH\245"
+	.string	"\375\202}\374\t\227\224\363\272780\341;\365\327\371\251\337A|\177=1j\216\327\342\260\320de+qKB\371S\t>\321\313\310\271sJ\206\223\274\334\367cw\332\206,|:\256b\3305\036$\320\346\270\373\221\273-z\025\367\005\025\003\301\227K:\0262\273(e\265\257\327n,\376sJ\304+\r\273\257\215F\240u*"
+	.string	"\\\211\r\b\205^\2731\240?\275\332n\037\254\331\260\253\034\255\207\001\276\366l\004\317\306\003?[\030_\023I\356\207\021\321JT\255\204`\201\256Z\337\f\nX\032\307.('\216a\221\266N\177\242\354\021\3445"
+	.ascii	"\274d\004\350>\275%\325\256-\306@O\230\234K\210HF\342\335h.w"
+	.ascii	"a;\226\222\343]\350\263\246\003\251\370\0324\3411;n\220\313>"
+	.ascii	"\244\316\237\267\223\224\261\303:#s=\3049J_\354\317\2712\r\305"
+	.string	"T-\177\337\275\235\264\253\027\003\223\335\356\002\266.q\325\377b\262\2108\260\333\3779\020\302\232:\216X\215\325\\\356\211\217\303\221\020R\324+\262\234\361q\231\334\037\207\316Z\205\370T\331\372\265_Q&\034\346\f\245\030\333\235;;^66j\256]\203\300\270\t\\Iskt\353Y\341o\tB.SS\214\221\035\377CJ\214\242\376\272\354A/\224\324\210"
+	.string	"\312;\033\305\335\\{\370\343\241\336\t\332\0354\325\272\017%\341$3\036\013\375O\301\276\204p\rU\262kL\247\350Ej\004\212\3246\316\237\362\372Y\346WSV\335\351\250d\nrNE\337Cn^\005\262\253X6\016Z\336\231jQ(8\321\013t\261\373\250\376$\375\301\023\307\036\236g\256"
+	.ascii	"\246\332]\t)\016R\226\3652!\024C\344\264%\264K\266\030Q\0044"
+	.ascii	"P\263\214\210\224\003\264\244\027\330\235\003\361\340\371E\201"
+	.ascii	"\275F\235@\312\357!\314\366-\334\220`\224+14u\034u\323\035\035"
+	.ascii	"=\002$&\216\034\375\201\"\342h\034\224\bt\306Voa6\273\221\237"
+	.ascii	">`\225\027\373-\362\365\027\204\\\311\b\277\241\225F\224\345"
+	.ascii	"\330\333\024\345L\365\320\340\276\215\\9\346\226h\243\300\216"
+	.ascii	"\032\252\274\257\013&\207i\021\246\214\330\226p\312:\004\222"
+	.ascii	"\f`\303\210\244\357\032\277`\343\372\253\373\335\325\236g\375"
+	.ascii	"\255\323/\264\363B7gqo\363\343\336\355I\f\354\230w}j\206}4\226"
+	.ascii	"\331|&Ar\362\254\267\333q'\331Q\306\t\262=\237\036\277\214\367"
+	.ascii	"w\357J\022l\277\035e\230#\3014G9\346v\2050%&\375\235Y\2339\035"
+	.ascii	"/3\331l\227\272\353\374z\371\b\261\353A\006o{\2119\r\265(\023"
+	.ascii	"\356\024k\305\327O\320\373\220R\200\301\273{\313\025\247\213"
+	.ascii	"\022\342|S[z\214T\331\354\"<\314\341{\357{\to\365\375Dh3*\342"
+	.ascii	"\352\317s\237\363S\305\212\245\276\356\307b\216\241<\025\262"
+	.ascii	"\260\211:J\372\007"
+	.text
+	.section	.gnu.lto_mspFcProcessOutCommandWithArg.175.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`5 e\227"
+	.string	"\332\367\3706I \016\323\031\016s& R\220\005t\315\001\ti\312\241\217\314\240T\373\216\320&\347Qh\251&\327\b\264\257=s\\\2753\2559\311\\-"
+	.string	""
+	.ascii	"B\345-l\367\004\325\347\302u\365\212\t^\233$\217\030MX\325M\310"
+	.ascii	"\2262\311y\003\373\002q\003\033\3048\005\264\326\210\367\206"
+	.ascii	"\270F\271\270A\213R\303}\236\357\371\341\0237\b\321\353\311\264"
+	.ascii	"\311\235\362G>\323\022\304(\365P\025\255%\006\342uQ\342\271`"
+	.ascii	"\t\2508\267\302\005~\360\204\227nPa\220;\245\3231,un\207\310"
+	.ascii	"\357d\360\025\272\376l\231\212\360)\312\037yMz\021Rp:\202tM\t"
+	.ascii	"\b\264\206\210\350$\316~\316\006\311\301:Y c\235$\177\033\004"
+	.ascii	"g\325$\201\315\255dA`\b\361V\2636{\276\367m\320\233*u=[\033\320"
+	.ascii	"N\340\333\226\020\224n\252\222\234s\353\221\345\332\2350\007"
+	.ascii	";\336\323|\315\331|o\203~\\\026RD\256W\365Ul\365`\005\3067\351"
+	.ascii	"\272\316\201\240\314[5_\313\326\033\201\302\030F\272\256k\225"
+	.ascii	"\032\253$\347\320\272z\271\341\255k\264\0023?C\344h\254\230\353"
+	.ascii	"\337\n\244\002\243\030\351\272F%P\376\370\271\r/B\336a\251\353"
+	.ascii	"\331\334Z\026\004\306\016\2337\304u\235s\372q\023P\376\370\027"
+	.ascii	"v\203\224\273Dv\203v\0279F\353\013\023\032a\002a\034\275\374"
+	.ascii	"\013\221\327qm`\256`td\360\326u.\305\266\230S\252sw\201\310\273"
+	.ascii	"x\300\314\025\354\253\355I\371#\223\227\371q\037\250\314\025"
+	.ascii	"\f\005(\336\272\256)VI\371#\227\277\021\331\246\001a^e*\026\331"
+	.ascii	"<\277 \256\353\032\225\364#\344\217\352\213\220?\366\232\320"
+	.ascii	"t:\215\261\237~\352aw50\257\316}\235\226\t\331<\215\0312b\300"
+	.ascii	"x!\345\242\005\213\025*\242\240R<9\241h:a\202"
+	.string	"iI\251\004\211\021I\"B\200\370\340\241\003\207\r\032\220\216\214\212\210\206\230B\313\f\030\202\200~\224I\344Qmn\356\235\247\241\234C\346f8C\261\220e(2X\"\307@<\214)dR\f\323\312\020\377\202\360R\204\fv\207]4\025\361{skQ\347,\352\f\362\212:\202\254\"\360Q\352\222\233\342\232\377E\003\325\016uaR\336\330\307P)\224r\246c\f\237\334,\356\261S\233\243X|\216\265Ei\2337a\211\352\375E\371\370\004\03396\301Fz\307LI\033Q\312\312|\311\356Jv/p\t\273D2Lb\314G\250I\3211jR\322_4L\242\030\026\241\302\224\211aZY\231\207Pk\024\3012\347\177\3218\225\003\273&\227\3621\210B6o\211\037\324d\330\021*\377\213\276\2511\024\245g\376\327\002{\210R\306\345\035\376\236c\215\020\217\3139`\211\252\300\033\324\356\002&\357\177Q7\025"
+	.string	"\270-)|o\013k@\226U9\022\225\037\251\035\320\334 \371_\224\212\272\004\007\005;\357\233\302F{?"
+	.ascii	"\320\216_\225\02799\221*@\0329p\376\027mS\337\326\304\204\357"
+	.ascii	"I\341\241\021L\265h\311\013t\376\027]\242>\321\311\302\204\215"
+	.ascii	"\205L\3702\203Z\003\r\0346\377\213\232\240>\241\261aPkH\241\023"
+	.ascii	"\370\277h\tj\003K\316\216%\352\204\203\320\310|\004\226h\023"
+	.ascii	"\006\272\327\342\177\324\305\302+\312\244\215\262\263'\377\027"
+	.ascii	"=\263{22i\203\314q\254\275\t\363\226\230V\266\344\307\244\215"
+	.ascii	"$WU\024R3|\226da\352\321\021*\320\277p\036#\003\343\206K\341"
+	.ascii	"\215\0351 \262/&H\345\272\256O\213.*9ic]\327e(Y\331\027\200\357"
+	.ascii	"\252ivWp\327\203\006\001<U\322S2g\331S\330\234e\310`V\270H'8"
+	.ascii	"d\370\006\007\303\024\022\250\217_\205y~\372O$\374\323\177\236"
+	.ascii	"Q_\205L\266\262\201\326\372\016\237o_<\335d/\2571[\325^\205m"
+	.ascii	"\302a\361\241X_\240x\222\335f\016\367\004!;\013\331\027<\314"
+	.ascii	"\3634\004j\265s\237\260\265\262\037$\\\231\344\273\264\003e\232"
+	.ascii	"r\016\264Q\036\373]\216IU\355\333\351\211p5~\310V[n\247\377\205"
+	.ascii	"#\\\b\325\327u\003=\266+\202ow\243\200\024l\353\352uh\003\315"
+	.ascii	"\325\2739t\360\241{\301C9?\261v\252\307\356\3275\207/\317F/\236"
+	.ascii	"n\207\035<\370\320\356\033>\001k\347\211\214x\371\242:\235\033"
+	.ascii	"\303\037\335 \030+\256\006\326\240w\1774\300\207r\377\205\027"
+	.ascii	"\031\036\302\371\201\265s\031z!.s\210R'3\276\370k#\245[m\231"
+	.ascii	"\311r\023?ga \t\313gt\352\340!YN\202\227\354\343G\266\\v\022"
+	.ascii	"\302~\212 \276m\031a\371\310\341\240\225\365\311\330r\bz\376"
+	.ascii	"d]tce]\213,\033YB\245\227{\200\374\361a\311\276\271\267-\353"
+	.ascii	"\223\265\211\305v\227P\375b\007\255\204uu\036\215\220\241k\323"
+	.ascii	"\217\030\364\311\374)\034j9\202\266.\341\306\3359'\267\332\356"
+	.ascii	"[K\222=3\333Pv\353\272\334M\345}\026\376\372\336\312\307\374"
+	.ascii	"o\273\224C\271\234\357\235(I\202\344n\2767\373\233\357G\370\335"
+	.ascii	"\367c7\362\260\307\375_\273@8\236\357\220\363\371n\3600?\327"
+	.ascii	"\021\277[*/\026\223\367\352\205_\253\327\375\032\274\313\217"
+	.ascii	"\201\312\033\201\312\013\301\362>\240\362:\240\3626\300^_\006"
+	.ascii	"\316\370\375q\305\257\217\005\016\370\355\301C\201\303\371\356"
+	.ascii	"x\3367\001\004\226\274\007\250\274:T^\003\230\2749T^\034L\336"
+	.ascii	"\002T"
+	.string	"^\002\212xo\030\361\016\240\362\326X\362\nP\304\033\200\312\013\200\312Kc\311;c\311+\203\311\013C\345}q\301\257\224\312\353\242\210\267\005\213\347}W,yU\250\274Q*/\224\312\233B\345}Ry\235T^\024*o\023\021\357\211$\257\211%/\323\222wI\345U\032\342-\241\362\222H\362\216Py\223\230\274\"\210xC$yA$y?\f\361z`\362vH\362rH\362nPy5\250\274HD\274GI^\243$o\321\020/Q\222w(\311\313L\362\n\251\274K\2257\203\312\213\201\311\033\264\344\005Z\362\376,y\225L\336\244\312\213d\362\036U^\225\311\333*/_\357\373\2271\240\217.\216\227E\275\006\234[\217L\373\254~\3073Ux={\235\277~\306_\361\307\363\353\371\371\374\210?\340/\370\337\371\013\1779?\234\337\315\377\346\277\373\321\374j\376\274_\357H\273g'\1771\330\006\t^"
+	.ascii	"G\266\204\275\324\310\230\310\341\025H\031\221 4L\364Mc\335\324"
+	.ascii	"(\3728G\f-\305\027\350\246Fz*\366\211\035\016\n+D)\221\344\364"
+	.ascii	"3\336\345i\034\361t\bz\f\202n\306)\033L\221\266\344\322$\236"
+	.ascii	"\235\350!\335|\033\264\211>\321GF\023}&ri\224$\020\233D\025G"
+	.ascii	"0u\006-\002pX\363\311\20725\322\360IX;\031I^\225\265\244\266"
+	.ascii	"/\265\020!\335 \r\276\342\367hq\265\322XS\004>t\251K\264\322"
+	.ascii	"V\227\350\237\311\335\321\001\202i\364:\025\362z^\243\f\033="
+	.ascii	"\207XJ\246\rzK\256\314V?\361?\215Z\272\324\005\332\211\210\301"
+	.ascii	"\032\2205\315\370P\253>\212i$A\252\317\224\275\020$\370H\364"
+	.ascii	"\245'\022\323H\266dq\021\304?B\212\204\t\261\230\224F4\2419\224"
+	.ascii	"\203\006\027\367\241\3256\250\205\016\207\322\307A\016N\337\321"
+	.ascii	"c;:\251o\274a\321I\335\214\007t\301\315\236\207\247\357\350C"
+	.ascii	"\351\377\375\250%n\317\027`\035"
+	.ascii	"\232\b\"^\252\216\330\240xB\264\210\3569\317F\020\375\241C4r"
+	.ascii	"\217\230\226\025\277\223\006\321\033\354\304V\370\342i\035.\021"
+	.ascii	"l.\330>\264\210#|R:t\370<\364\036(\236\366\320\241U\027\026\333"
+	.ascii	"\370)\261\323O\207\343p\031\231\320\363\013k'\035\366\343bb\203"
+	.ascii	"\301v'\37597\202\263\230\327W\f\275l\351\260\001\201^U\003\002"
+	.ascii	"\315\342\21174\007>\256\245\322\036\326\362\211\003\033\254\245"
+	.ascii	"\324\206\236\021\247'1\316k\254\327`)\215\216q\016\237\240\301"
+	.ascii	"\241\300!\201\016\242\343\223\205\356\r\030+^\217\317\254mC\253"
+	.ascii	"-\222"
+	.string	";\275\021\212n\244WEZ\321\t\364\330]^\231\"\256\362U\221\336\b\364\230\206f<t\203\032\256\344\210\336\334\236(Q\214h8z\222V:\322&\316\350IzE\217\275\357DGW\322\253\032!\320?R\253\2419\002}%-\364\274S\310E\242&49z\222>\322\361\311C\327\207\324\t\364\223\364\305\254|!i\244&z\336\351{6\276\ny\263>\222^>\357\344\211\241\035\365\315\272\355\236\215F]\324G\235\344\023\323\362\305\3233XJ\245Q\337K\nqR|?\306\343ZzABs\t\037Z\324Kwm\242\211R\026\314Y~\277\247\361\373\232\246\023\345W\023\232'\260\230\305+~\317v.\021\n_\343\301\007(\236\217\320D-\004\306\316\364\331\310\354\241\276\037\213\3412J\323\274\302\304V\0075\324?q^<\365\202e\024\210\244y\005\006\263}\304\001\272\305}\204~\337\215\314,6i\2715\""
+	.string	"\032\251\261\013X\312\247\300\217\365\004qs\022\237X\250\205\372mX\216k\031\b\335m\246\3605\315+\"\232m\315)b\355\254\302oX/\226\271tEi^\221b\343B\376(\3243\342\346\270\305A}\3317\322l'\206\246\201\271\226\255\232Y$\223\302;K+B\363\037+u]\323j\\\315\257\342\372\334\244]x\272/\243+B\224\241\237F'\230\241\277w\"1\212\213J\336\244\270g\250\325\232Y\232,(\005.\257@\204\215j\031(\0048x\bU\302T\266Na^\013\371\266\376`B\333\ty\342\f*1\206\246[\223KRX;7\2501\364\237\215W\202\232E\034\230\3043/\236\306\251\025\021j\265*$\225\253\270\272-z\274\002\035PU $\310qK\b\325\006T\307).\255d\005U7(\340\322Bne\001\331\322:\n\301\261\245eu\205T\265vh"
+	.string	"d\203,\252-!A\200\264*\250\232R\267\204pYM\035\251\252\200dY@5$\210V2\310{\374\330\301\001\225\020$\325\220 ?\256\264\252\222Z=~\354\350"
+	.ascii	"HU\362\002!A\250|hQm"
+	.string	"y@\301R\210\016\345\026\027\217-\252\f\246\200\\\375dm\365\330\342\272\022\242c\213J\213*+\203\020\034ZZTSVY=\266\264\254z\\iU1\267\264*\350\251,\255\356\361cG\005US\310)-*\002\246\262\264\222;\005u\245U\025%$\b\220\252\250\251,\255(\250\243\265\272\242\312\212\332\262\262\312\212\n\232[\337PvYF\002\341\317O {{\336q\327\233\310\223\371\217\037\243\221\347]\206\346\233\310\007\036h\356\257\345\260\257\r'3\246\241\001\204\327\277m\306\001\203\0230\207\261\263K\f\003d\272\354\370\320\003\372\351\f\364\335\372\035\247N\22712Zm\245\316$\241\002\343nmt\306\214\312\213\b\232\201\036S\352\350N\343\322\321\374\227\246F][m\r\310\321\006\334\345\310s\213\363\302Q@\3430\303\316\252\002\372ha\326$\306y\021p\243\t@\303\316\246\363F\337J\2305nq\r\360"
+	.string	"]y]zm\330\331\305\247\034\240}\204Q\223\030\327b\234@a\003\303\305\0313*R\317\322\021\340\340\b\322\336p0\026\330\201\322Z\360\353\351\364\027 o\245\261\224\270\206"
+	.string	"]\243\177\247\007\234\2568|\250"
+	.string	"\335x\322\334\374\276\332\251\276\b\240\237\2459\330=\033\003\220\002\2401\320\241{\003@\367\2304\026v\360n\027`\227\240\225f\260\027)\246e\361\373\212\236!\223&\272`\361O!ogZ\370\274[q)}(\323\301\347\235\nn\373\217\036\243\361\243it2\205\"w-\236\220\002\213"
+	.ascii	"\247\200P%^U\216\344Q9FD=?`\177i,f\364\261\320\rJi\031=\243\377"
+	.ascii	"<\373\312\362\267\265\214\036\"\307\370\005\b&\315\001\354\364"
+	.ascii	"\335\256;]\205|\350\245t\353M\373V\200@^\375\244\321\t\376 \220"
+	.ascii	"0\372\252\227\237g_}\244\313\020F'\363LUP1\205Cr\023f&\352\305"
+	.ascii	"\233\027\375\306\023\211\231f1\003\272K\234"
+	.string	"K\224B%\277\372@A\203\373\371\274!L\221\301\235?1A\361\260>\01669\335G\217\371h\250~\243\037\2264*8\265\232\217~X#\255-\036\342`\027]{\272\016[\264\213f\273\256=e\213\376\342\217hr}\211g\274x\332muyR\024J\fu\351\207\004\033\027]\324\351\003\327d\242\301\276*\023\217\226\3521\025\2037\030\252ox\302\256\305\250\356b\354\232\362\241*:\311\252\243\244\032\252\031\220sC\007\b\246\315\211V[\346\253\220<R\230\365\251C7\350&\016\033\242\211\245\036}\251ac\b\247/\260\244@#\335\031\022\206\340*\347\321c)\272\243\320\275I\321\227\346y\322\210tJ\330\230T\022\013\254Q\352\352-\261@\367\350\261UI\360\340\261\247N\t\204^\265\004\217V\200J\317\322\002\375\324]\335\214C\372\251\213\236\212\205bh_l'l:c,\t\236\361h\247>\217\006\241\205"
+	.string	"\025\001Wjf\317L\251\325V\r\022E\237\220\216oH\202\226\250\322\3600O\262(b\b\315\314\214&I\n\215\001b\n\020\210bq\036\311\255\007\022 \2059\005ZDC4I!\033\007\\\312q\365\327Y'\006\245c\020/Q|\355\377\226\322\304\221[d\324\3510tM\324\213\246N\236c\355h|*VE\275\307m\320\001\304\212F\345`)\361\306\235\205\364\311\342'x\240\352'G\300\243\034\0200\f\220\360\272|\334\2130\340\275\214\370\225\003\254\3779\355\020\363\271\304G\265\255\260\205\225\036\237q\250\237j\345Z\017\317g\340\034\020\226"
+	.string	"\037\303ec\211\b_\023\267\023\267\362\013\350\344\316\207\037\243\372\250\237D\333L\240\357\230\227J\350\t\b\221e,$\034aO\262"
+	.string	"\275 \301\n\354\250\274\304\342\211\336>B\230\007\314\177\314\303Nja\022\273\233\306\251\272\342\246\036\374h\007\260\240)O\026\256h\004\314@\273\202j\273yBq\t\233\347\006"
+	.string	"gY\034^\366\037~\353Xc\321c>\217\270\370(\230\355\375\203g\024\312\026\003\251%\373-\320\230F\030\270U\257\263\226\274\n\337\326ay"
+	.ascii	"L\253+\322G\357Y\225\233\021z\013\366\241T<(\251\336m\325\261"
+	.ascii	"\002q\013A\023W\267Q\243\330\224\265\374\247i\267r,\002\310\351"
+	.ascii	"\237 pa\002\232j\023LC\343\023U\025\350\002\323\214\037\356\274"
+	.ascii	"=\\\214\032\334\036f\nd\323\305\361\362\263%G#Ox0\353\\\273\034"
+	.ascii	"\257\2218\361\222Xfw\3044\243\255\330\300|Z\302\354\370\354\362"
+	.ascii	"\317\332-En\351\255\001N\366\020\326\220\r\270%dS\375\t\346\247"
+	.ascii	"e\302\264\223\367:\321\344\226\005\2502\263\265\262\t'\221d\036"
+	.ascii	"8\267\374\342\021\025\303\336\364\300:#Tu$\022DvD"
+	.ascii	"\327\005\224\377\375\301\372\005\004\372S\005\317\330\013\320"
+	.ascii	"\\w\032\320\212\2532~\257)y\022\244\350\3535\324\351E\256Ew\240"
+	.ascii	"E\214\236|^\207&\035,#\241\307\243\340\242\357\310\277\036x9"
+	.ascii	"\247\2016\356C\243L!W\246\237\324\340\334\335|\257\260\226\353"
+	.ascii	"\242'\324\b\357\263\272u\021o\250\256aG\024zGXU-(U\033\276\003"
+	.ascii	"\254\317~\352\321\264F\217(o\346\361\030\"N\364b\316\263\307"
+	.ascii	"t%\371\017\013\031\ro%+~`+\367n-Q\212\025I?wa\243)\301\007,\264"
+	.ascii	"\325\210Lv\200\200'=:\313;\006\201 \315Kw\362\t\202d\304\211"
+	.ascii	"\033\374\3520\317j\216}\214\275O#NR\255\335\256\320\023\353\247"
+	.ascii	"X\"\022\343S&w\377\255\036\3101*\250\262\231\354?\003\t\2049"
+	.ascii	"\254\207+\357:\300\037IbX\034\310\017\222\025\341\217\250\216"
+	.ascii	",\307u\244\"\271_E\201pm\035\213\276\t\360\001\305\350\276\336"
+	.ascii	"^\tw\035!\267\253\032q\350\265\032,<\016C\241\026p)\237\275\323"
+	.ascii	"\243'\232/\204\002\263\325"
+	.string	"P\tG\3161n9\244B\302\251\023@4\b\370o\302*\373\276\262H\210\306\372U\263\270\2739\023;3'\311\311\034\241\002\231\270Cj8)\271w\"w\215\003\207\353\372\322\350\3502\003\302C\026\2512\007#\316\372f\206\345P\342wV\340\314\324Yd\270\353\022i\216Vs\306\005\035\263\034\204D\350\321\b\372\357\270\336\322\266\346\227\017R\232\355f~\\\336\246X\f\233\231\337\207C\370\354\243$\032\347L\276\005\bv\203\202\247\b*a\006\205\233\325\024\303\233\334T\007(\253\305\225\3319N\r\032\t\3366`\363f\"\204q\202\274\356\017L\264\363\312\217\035\027\017\234\335\232\253m\346\256\230\3459ux!\203\213\201\203\330\035\303\003\276\246\001y\276\034\263:\327\212$\001\r\227|jh\026\nk\006\n\005\254\035~V;\374\213\323\347\366}C)\235\320\245G}\356\337\370\"\251x\320G\260o\224L\005\3622"
+	.string	"9CbAD\331"
+	.ascii	"o\320\354\301z\345\263\312)(C\034\314s)6~n\371u\245)\224\n\206"
+	.ascii	"\004\343\324\376w\230|\226u\304\223\341\200\266{c&;(\272\226"
+	.ascii	"\231(\310\022\365J\303\027\016\271d{\345\314\t\240'\\\232\004"
+	.ascii	"\340\221G\032\206I\257\n\330\nWtE\003S\364\301\024\036\262p>"
+	.ascii	"\321\376\030\314\342\027\036\002\fJ`\3650\213\274\300p>EH\373"
+	.ascii	"gB)DZ\233B|\313\214\377!\250\2171\260\\G<\241t\234\004~Z\241"
+	.ascii	".\251/\317_\017\205\022:+\334\253\305\376]\244q\343\027\377\275"
+	.ascii	"\013\352R\317\272?\213\024\256\033X5\212,Q\316%<\251\310\370"
+	.ascii	"$\030\224\031\316r\340'\177\242\305P\270A\002\314\025\261\017"
+	.ascii	"-I\213og6Mq\361L\036\243\2238SlQN~]l\263\322\211Hp+\013G\273"
+	.ascii	":\025\257oSCS\240\033\266\352#\246\005E\032\210sy\332.8\215\013"
+	.ascii	" _\360\004\027+h\271)a\321\217\230\211\34044\225y\234Z.\370\025"
+	.ascii	"\006\303\013de-B\314\311\016c\013v\026\302\304`EL\004&\246\245"
+	.ascii	"D\013"
+	.text
+	.section	.gnu.lto_mspProcessInCommand.176.99396a154a7c27d6,"e",@progbits
+	.ascii	"(\265/\375`\357\240\225\013\002:T[\266O\0200\346z\306\303\300"
+	.ascii	"1|\030\034j\224\013\306n\230X\034\216\213\036C\242\003G\230>"
+	.ascii	"U\327e\225\313\314L\234\256\n\251\332\035\266t\271\2217\354E"
+	.ascii	"\352\362\323\231\211OGf>\035:\375j\371\342\351\277[A\257M\255"
+	.ascii	"6\"\f\262\245\224)\245\024\026\013D\n\006\f\256sO\255\316\035"
+	.ascii	"\304un\251\024\347\216Z\235\033J\351\334OJ\347vZ\235\033\210"
+	.ascii	"\322\271\233R\234\373\207\322\271\231R\234{I\351\334JJ\347NZ"
+	.ascii	"\235\033I\351\334>R\234\373\251t\356\036)\316\315C\351\334G\256"
+	.ascii	"s\357p\235\333hu\356\"\327\271\211D8\367\220\322\271\205\224"
+	.ascii	"\316\035\344:\267\016\327\271\201\\\347\376Y\235\333\307u\356"
+	.ascii	"\034\253s\367\254\316\315\243t\356\235\325\271u\224\316\235\343"
+	.ascii	":7\216\353\3347\256s\343p\235\373\206\353\3346\\\347\266q\235"
+	.ascii	"\273fun\032\327\271k\2448"
+	.string	"\267\323u\356\031\327\271e\\\347n\212p\356\030\245s\323p\235\233\351:\367+\302y\206\322y)\302\031F\351\374\"\302\331E\351\334\"\302\231E\351\274\203\b\347\025(\235u\020\341\234\303\352,C\351\034\303u^Y\235U\\g\025\204p\206a\302\371\305\352\354B\351\214\203\b\347\024\234\340\214\002\245s\013\327\371\006\327\331\206\325\271\206\022\316,\\g\032Lp^\341:\237\240\004g\025\256\263\tH8\227\300u&\201\353<\303\352<\002\327Y\004\253s\b\224\3162(\235A\240t\376\200\353\354\201\021\316\035X\2359\240t\336\300\bg\r(\235S\214p\316\200\3229\206\021\316\030X\235/\340:[`\204s\005\\g\n\214p\236\300\352,\001\3279\002#\234!\260:?\300uv\300\b\347\006\254\316\fp\235\0270\302\031\206\325Y\001\256s\002F8#`u~\301u>\300\bg\003\270\316\005p\235\t0\302y"
+	.string	"\256\263\013\256s\013#\234YX\235\005\340:\257\340:\007\300u\006\200\353\214\302uVauN\301uFa\004\347\023\256\263\t\013\234OX\235K\270\316&\220\340\\\202\353Lbu\036\341:\223\340:\217\340:\247\214\340,\302uV\256\316!\\gwu\026\301u\016!\305\031\004\327\371\203\024g\017\\\347\016R\2349p\235A\2448o\260:\177p\2355\020\341\234\201\322\031\003\021\316\027(\235-X\235=(\235QB8'W\347\223\325\331duF\256\316\307\325\271]\235Y\327y\025\301\371W\347F\262\2650\022s\027\226\203\370y]\357Mu\361\235\262jN.\244=H\273U\373U;S{S\273S;R\373Q;\217\366g\273Q{P\373P{\216\366\237\366\235v\234v\232\366\230v\231\366\267\233\261[\261{I7a\267`7`7\265\033\255;\255\233Hw\264\273\254G`n/Nry\027\214\013\231"
+	.ascii	"\234\021\262Y\177Ex\326\224C\035\353*-\311\201\220T^\005\343"
+	.ascii	"V\025X\337\0376M\351\351\006\331l'\201`\217r)\030\017r\201~g"
+	.ascii	"^\023\2454+\177\221\315\226`\373C\373\303\201\370\023'\235b\230"
+	.ascii	"\342\252\006*\"\275)E\2775o3\241i5\224 \235i\003Zi4=\210TbN&"
+	.ascii	"q\262\331\022\026\3605N\263\016\217\330yx\017\367\301\311'Tk"
+	.ascii	"\256\017\371C\367\324\252+b\337\301I\243\022ZZr{BN\304\311f\207"
+	.ascii	"Jh\235=\275o\327]P\t-46\244\367\260\3738\020'\177T\360\264\224"
+	.ascii	"\306\220\236\243\003:SZL[H\236\035\225)-\"$\317!\323s\034~\363"
+	.ascii	"\001\267a\021\240}\200\275\206\333`N\262\fn\303\032\2103r\370"
+	.ascii	"\276o\r'\233\245\361\253\322\321E\310f\231e`N6}\206\2232\212"
+	.ascii	">\310f=F\004S"
+	.string	"\213}\303\231\234\364w\006\255\241\0333\032E4\273\336\234\22314\"Y\207\357\373\236X\204\372\320\224\240\023\271\251\242IT\364!wV\324\354\360}\337\244!'\227\254\300\340\265{;g\257g\310\005\251D\251\247F\240 \367 K\327\227\310\003v\314\236\336\367=\321\307\035\350\327\1770\r\310\242\337\232\327do\247,\360}qN4\3139 \233u\243\021\334k\334|T\025\021\314\256\367&\251$\324\225ux\003\262\331\263\0377\263\037\267\013\224\375\330\320k\374<}YDY-z\215u\220;\263z\3377yD\354\247\316mn\310O\234\333[\330O\033\3516\346$\247\240\327x\206:\267\367}\223\3152\247\2009\331\354\f\206?.z\215_\n\030\204(\353}\337$s\237q\027i5N\246\251\254\357\017\002v\230\236@\200\306\362\334\371!\001d\263)\3140\334cM\326f\234,\203Q\0031'\021\002+\264"
+	.string	"\323Q\225~g\336\035\ns\024a \022\243_\235\267i\216\344,\006\276o\327\211fy"
+	.string	"\25437X\207\301\364\220\034<\300\340m~A\213\274oW\n,"
+	.string	"d\263\334\205\\\273Z\bL{\2618\006o3\006\b\005d\263\0308\273\367\226\013\233\274\357\321a\221\367}S\340\021\310f\261:\013\206gH@\206\206N"
+	.ascii	"r\016\235a\207\357\373\242\020\321 \332f\327\376\3206\373H\031"
+	.ascii	"\230\265\020$\022\331Y\032h\360\201e\331\017\230\377\204f!\334"
+	.ascii	"b\314\027T\253\325j\257]}"
+	.string	"A\265Z\255\366\332\325\334\321\223\031\335p\375\326n\335\326FZ\332l\275\326j\235\326E\032\255\317\332\254\313\232\254\243=\326DZ\254\207tX\203u]\177\265W\013\351\256\346\352\255\326\352\254\306\352\253\206\266UW5UOu\220\226\352\250\206\352\247vj \335\324?\232\251\227Z\251\223\032\251}\364\263{4\217>\352\035m\324EM\324C-\324A\255\243\201\372\247}:G\3674O\357\264N\3474N\3374\216\276\3216\332\246k\232\246k\264\263gZ\246\233\035\3234\232\331/W\271\221\031y\221\0259\221\021\371\220\ry\t\027\262\022&\344A\026\344@\006\344?\366\343>\346c*\357\261\036\347q\022\306c$|\307v|\204\247\\\307t<\307r\034\307p\374\306n\334\306FX\312l\274\306j\234\306E\030\215\317\330\214\313\230\214\243<\306DX\214\207p\030\203\361\027{\261\020\356R@\002\020\360\302\001\fP"
+	.string	"\002\f\300\205\026X\020\300\n\001"
+	.string	""
+	.ascii	"\n\025R@\341\204\211\023J\230P\002\211\021$\214\220\"B\031\302"
+	.ascii	"\025!\004\020>\360\240\003\016@l\360A\203\fZ\016\203\013,\360"
+	.ascii	"\200\222<1A\036[v\375\216\353\271\246\363\031\334\314n\270\265"
+	.ascii	"\241\267\216\302!\262\303Q\362v\243\2669y\0339\2236u\2639\233"
+	.ascii	"\260\234?\274\327\220\230\272\325\234LXK\336iJ\336E\322\202\320"
+	.ascii	"\322n\234y\222\220\267\331PwYRg@\202\253\317\211\306s\2044\324"
+	.ascii	"M\266\303\206wTG\367\030\007GN\034\336DD8r\002\371p\376x\213"
+	.ascii	"\335t\017\351\240n\b\317\021\322Mw\330\r\037\235\002\246\243"
+	.ascii	"\273\216\353\313i\343D^\316S\365\026\322\265\276\240e\245$\302"
+	.ascii	"\221\263\306\372^bm\016\304\005\242M\212\203\347\b\211\246{k"
+	.ascii	"5\321\350<\255\265\036q\340$\021\004\324\34192\212\336Y\317\305"
+	.ascii	"n\254\306+\254D((\007G2\210\336VLt]Y\210UT\177\336Sm\255\001"
+	.ascii	"\317\321\323\257;H_\267T_\033\237w\224\037\325\033j\257\373i"
+	.ascii	"O\317\333\351H\257L5N4\236\243g]7\020\272\356&\272#s\336?\344"
+	.ascii	"\272\231\344\352\342\274\227"
+	.string	"\340\272\225\340\346\336\274\223\334\272\221\334\342\320\274}\234u?E8\2229{3\363\356QW\346\315\343I\326}$C&\023\365\336\361\034\3536\222\031\223!\342]\364\344\352&\222\341\222\331\362\036zju\013\311hey\007\351"
+	.ascii	"\202v\377\310@e\254\274}\25688\222q\362\316\001m\352\036\231"
+	.ascii	"\246\346\201\016A\355$\211\034fA[\247\312\257sNl\021\311\202"
+	.ascii	"\342\334lp\364L\352\306!\302\221L\321*\202\310\373F\333\020\362"
+	.ascii	"\266\251\321\341M\023\004\344]\343\371\323\355\224\371\251\351"
+	.ascii	"5\307\221\314\215\367L\313ts\005A\346\306JB\306\206w\214\317"
+	.ascii	"t\212\214\2157\215\251\276f\312\320\364[\255:72#\243\363\342"
+	.ascii	"\024\226\342\224\216D)9D\304\346C\304CgC\300\346%\200\177\316"
+	.ascii	"\205~\315"
+	.string	"J\374\372\234\t\371\232\007\371\250\316\202{\315\201{z\316\200u\315\177ut\316~s\315}s\034\034\305\3109\363A5AQ\341\232\367\340\336\234\365\334\232\363\334\320\234\223\2345\343\235\2319#)k\276+#s\266\2136\037\211\2169O\2114\327\021\341r\246\333j\236\333\342\340(F\313Y\256(H0\016\253\031\016\353\312\371\r\332\354\006\265rnsj6\342\004\304Y\332\324\314\326\364\303y\355\210\007S\263\232\bG1LjK\316idPE\230m\362\034\332\022\344\340(\246\210W\241\243\230$\34736\023\341(\206\310\231C\316eC4d\214\321\2771=\"?beCp\204\005%1\230\bG16\276D8\212\261Qc/\242\306^s\034\305\324p\026\262\362\330\361\240i\356:\341L/\013z\244C\324\nH@\243#\340\005\242E?\200b\033@1\n'\321\013\200\304\363\321\023<\322!j\002\034\366"
+	.string	"\016\001\335\205\277n\341\317\317Y\350k\001\364\361\371\n\324\016"
+	.string	"u\317\001\240\327(\364\352\\\005\272N\201n\316Q\220\353\023+\th\242\221\266\303\221[A\030\"\263\024\347&V\f\340V"
+	.string	"\270\371\t>t\336\272\304b#\013}h\004\217t\336\332\004\264.\001\355\314I\230\365\210\325\204Y\024N\231\223@\346#\364\354\245\214\271\210\224#\035\242Vru\b\256-w\327\017yT<P\370\031\233k\303N\211\302\321r\021V\021qSg\333\341(\255\312\036E\210\035\205\223\345!\260=8\240@XO\244fhm\207s\265\266\260\024\005\325J\254\374\003h{\320\001Q\024\216\223s\260C\205:\322!j\020G\030 \24044\315B<\322!\352\r\326\243\314\r\220\266\303\371\261\022 1P\255\007\227\374\203\017\035\246\326\300\204\253\316\240i0u\313\255&\210\344xD8rf\255 \216\360\350k>%\307\340\002\f\220\256\332\202U"
+	.string	"2\207B(\211N$\035\205S\344\036PV\023\201iK\332\016gh\005q\003\244F\310\223')G::\332D\207Z\247D\341"
+	.ascii	"9\262\217t\210\372\350\323\255\0059\316\031g\333\016\207h\025"
+	.ascii	"\361\276o2G\306\327\025\004\"9\236\266\303\371YI\034\341\321"
+	.ascii	"\327j\35569M\177\022\213\335q\016\355\236#\201\246\233\316\312"
+	.ascii	"Y#S\003\2103\311It\243\251\312\210(\024\024\243\003h\253\346"
+	.ascii	"$'&\2461f1\252%3\224T\024\004D\346\307ML\242\023*\203C1.+F\251"
+	.ascii	"\346\020\020\013\b\021#\221D,\246%\031%\254\r\216\234Am\017\201"
+	.ascii	"-\351#\034%\026\374\b\303\373\276\35459:\315=m\346\017o\314\r"
+	.ascii	"\204\331\306\b\002$\f\255C\302"
+	.string	"\222\300\276\360H\370upI:\3023/\213\326.\025Wo\307\312\265\344\301\202I{\020emi\215\260\226\362\314\313\347z\245\302\202I\215\240Vka\315`\312\263^Ki\"\236y\211\264N-\225X0\266E\242,Df\b\254A\226L\355\007G\372h\340\262\326\250Uj\331\344\264\204\362\256YJ\265\315\276\237\362E0/\247\326\247\031\220\357\333t\201W'\0309\226UH\3457O\024\rq\213\206W_\311\351\320]\321\"\203<\333dS\\\341!\236y\211\265\324\362\256A\006y\367C\274\0064J\200\356{t\t\032\302\213\360m\330\037\030S\252[\365\232JD\370\320n\033\302?\030\033\337\327\\\323\023C\370\246.I\215\265\211%\250)\323\031C0\201\203\360\314K!\313\257$\020\276\325z\215\212\016\001\341\237\234\244z\300\036=\273\324s'\372q\274\rK\333\307\361\255\244M\376\030\006\2463\326X\222\373"
+	.ascii	"\307\263G\337\301X\222\330\007ak\017\036G\030\370\240\310\003"
+	.ascii	"\304\016\304\326!\241 \rt\360\303\301\277D\303\240 \236y9\266"
+	.ascii	"\346P1\201Y\354\326\236%\031\t\002\230\255<K4\344\272\343\201"
+	.ascii	"eZ\377\230\241\3256\313\232\201\370\2562j>\223y\275Yqfhq\377"
+	.ascii	"\340\345\332R*m\233\335\340[I\257\213\321\347\256\230\016\200"
+	.ascii	"P\314\017\017\376\311\f\207$8m>\263\203\177\236\350\017\277\362"
+	.ascii	"Emz\342\207o*R\335\264\371\314(\322\234\006\317\274l[kT\224k"
+	.ascii	"\215\225f\371\026\267\234\233k\233m\245\032|\2535\007vHq\216"
+	.ascii	"\244\031\006\016\376\311\314\031\324\2552ks\215YixP\210\301g"
+	.ascii	"\200\301\177\340\205\224v\3013/\217|\225\245\301\222\336\367"
+	.ascii	"u\201yy\367\215K\274\027"
+	.string	"x\231\367\214\313\275\022\364\336\367u\241Y~\305_\\\362q\377h\226\227~K\300%`\333\254\007\214\026\374\005\337\316F\013\376\203(\022\227X\267Z\367\022\222\026\210\177r\017\266\006\240F>xx\317{\033f\026\353\373\036)\240\001\273\003\275\274\312\021p\317\373\026\354\300%!\t\275\367}\273\206yY\2704\364\256\341\016l\r\242HPS\231g2w\305l\360O\366\020\325\200\245\372\343R\313\235\350\277\36167\336\3037\340\001\337\303\\W\273D\233\374\007\354\003\320\364\031}@\241\377\306\263T\037\002\215\020\340\fQ\214W\031\345\231\231\005I\007\246p\223\336\367%\300\027\326\f6`\251\270d\364\256A\371\036\354\r\274\220\206\246\315g>\013Q\031,\r\3008\216\251,I\006\377\344\356\226+\t^\313}\017\225\226\205z\266y\206\224|\026\n\205~\264O~\363u\005\224\204\304f\032c\274\312\357\323&|(b"
+	.string	"\203\233\374\tsF\314\211\311\267ZG@)\b\255\227\224"
+	.string	"]\340G\276\007[\224\234\005\377\344n\225\226\275z\226\307\354\256-\223j\364\200"
+	.string	"?>\3229\203F\346\231\314f=\362\233\335\372\343\037\225t\030:\033\277\2100\nE\257\331\253\1770\263\252\255w\037nY\277\302\371h\2336\237\311^\275G}H\2479m\302\307\3324\371O\356@Mj\313\344\365\032\204\232\024\016\344J\375\267\321\332\330\370\366\217J@'N\003H\226\tK}\266Y\306W]\251\177\262\007$\2666\345\020\221\377dW\rj\253\345Vi5(Z\302\256{\3776o\303\\"
+	.string	"g\237y\306\315\214\034\357\032\026a\363\354\237(\375"
+	.ascii	"\036\377\331\320\301\263\366{\264J\273\356=\013V\306\364E\327"
+	.ascii	"\364D'\304\023b\335\366\333\276\325\332\344\350k\257\351\211"
+	.ascii	"\334\355\266\353\177\333\263;\177b\274\312\374v\177\247\302\375"
+	.ascii	"\203g\354\314\350\361\256i\226{FO\333\354\372\31310\304\037\032"
+	.ascii	"^e\363\242U\353?9\002\355\377\312W]\323\023y\335\373\177\rh~"
+	.ascii	"\304X\3607{\346\031@3\202\274k\326\275\367(\217\352\264\371L"
+	.ascii	"~\245n\265\326@\321\3640\220\351\214\314]1"
+	.string	"\357yqC\335s\377d\346wj\206\201\351\214\334m\322\207\364\324t\377\234\343\247\233\276\036p\004\302\361\307\211\250\351+\222e\325\306\357\226\3304\315\262b\343\227\"\272=\275Fi\374j\207iDOg\374hK\222U2\376\262A\270\"D\370\307"
+	.ascii	"\207\002\263\254^\2430\376!\3233\267,\253\327\310\213\377\253"
+	.ascii	"\016\b"
+	.string	"\007\027\177\027\377\255uIDBt\237\305\257\325r6O\257\021\224\377*\256J\305_\305\177\027\200\223\342\017\362F}z\342\207\342?\013,\376\030i\342\007\302f\202\026\270\304\317\244v\023\230e\365\276H\374IgSf=\370\237fL\201;\370\217\312z\370\236\210\370\213\370oE[\214\006\361\013\215%\263\364~\370\201\210\004\351\365\360\347\270\222\361@\323\225e\245\303\277Se\242\203\310\r?\316\017\324\312\006\377\215\236\261\303,\253\247\341\257\351\235\240\263\247\327h\206\337\3317CzYV\037\303\337\344\277V\354\220H\250o\374\313\317\274\253\372ado\344\277\020\230\271\035IdW\254\203\3222d?\234+\022zR\302^\03074\367$\310>\230\006\344\360\217\035\220\317\260\250O|\354}\3747C\237[\231\036\373\036\377\261J\214\210\204X\b\036{\022\376\233\300\222\237\004\330\261\337\361\337\212\026H$\364B\035\373t"
+	.string	"z\201r\354s-\374(\222e\365\032\275\261\303\361\337\f\215?\0020\302\336\306\177#@\342\226\302\032;\333\2116bB\201\236\212\260\247\231@\304\214\375\214Dr\313-\312N\306\177H\022\232\205a\230\377Z\306D\251+\313\3525zO\020c'\302\177%(\374y_f\023%\233\205\231\031\206\371\317k\336\367}\337\023\232e\3660f\376k\313\026\211\204\336\227\331D\314\314\3140\314\177^\363\276\357\373\236\320\354\027y\266\007W\326\353\347\215\334\377h\377a\316F\032^\345"
+	.ascii	"\370\233=\363\214\242\031;\274k\372\333\254\373\251V\324\205"
+	.ascii	"\030\330|&sWL\257\357\373\276\376O\346^\337\367}\371{0;R3R,\204"
+	.ascii	"3\022\254\2274#\203\270\316H\"\327\031\371\343:#{\\g\244\323"
+	.ascii	"uF2]\347\243b\b\347c\240\347h>\266\371O\363Q\352;\315\3075\337"
+	.ascii	"i>\2529N\363\261lu>\216\255\316G\260\325\371($\204\363q+\204"
+	.ascii	"\363\021+\204\363\321*\204\363\221*\204\363q\312c\232\217K.\323"
+	.ascii	"|L\352\255n\266\3524\315\354b\2275\263e]\326\314\022Y\235\331"
+	.ascii	"\260Fkf\267:\255\231\315\352h3{\325\202\315,US\233Y\250&lf\217"
+	.ascii	"Z\261\231\325\321\321\346\265\260\243\315\253`G\233WjG\233\327"
+	.ascii	"\275fl^\335\374m^\263V\347u\307\233\232\327\033\356\324\274\332"
+	.ascii	"\254\316+\323\257\232\327wu~E\277j\376D\327\371\tC8?\240\353"
+	.ascii	"\374\177\256\363\373\271Q\363\367\371Q\363\3179\217\346\217\363"
+	.ascii	"g\363\277\271\316\337\266:\277\021\017j~\251\0175?\233\353\374"
+	.ascii	"j\355\325\375E\232H\363\243\365\220\3567[\235?\007;\177\217#"
+	.ascii	"5?\217\0335\377\216\3574\277\216\3434\177N36?N+6\377M\0236?\216"
+	.ascii	"\026l\376\033\035m~\033\035m~\033\245\363\327(\235\237F\351\374"
+	.ascii	"5\224\316\357T:\377\214\322\371e\224\316\337T:\177\214\322\371"
+	.ascii	"i\270\316\317<\341\354\325\325\331\033O8;\343\352\354\213\253"
+	.ascii	"\263+\256\316\236\270:;\342\tg?\\\235\335\320u\366%*8{\341\352"
+	.ascii	"\354JB8;a\n\316>\350:\273\340\352\354\201!\234\0350\204\263\377"
+	.ascii	"\255\316\356\347:{\237\353\354|\256\263S]g\337\013\341\354z\253"
+	.ascii	"\263\347\241\340\354IVg\307\013\341\354H\\g\277s\235\335\316"
+	.ascii	"u\366#\256\263O]g\257\013\341\354tJg\237C\301\331\345B8{\\\b"
+	.ascii	"g\207s\235\375\315uv7\327\331\333Vg7\262:\273tuv6\245\263\257"
+	.ascii	"\271\316\256\266:{\232\353\354E\\gGS:\373\231\353\354fJg/s\235"
+	.ascii	"\235\314u\366\250\353\354c\253\263\023q\235]lu\366!\256\263\207"
+	.ascii	"\255\316\016\266:\373\227\353\354^\256\263\013q\235\275\313u"
+	.ascii	"v.\327\331\267Vg\327Z\235=kuv,\327\331\257\\g\207\256\316n\245"
+	.ascii	"t\366*\245\263S\255\316>\345:{\020\245\263K)\235=J\351\354P\256"
+	.ascii	"\263?)\235\335iuv \256\2637\211p\366\037Jggr\235}iuv%\245\263"
+	.ascii	"'\255\316\216\244tv\037\253\263?\225\316\336#\204\263\363p\235"
+	.ascii	"\375\310u\366\035Jg7Z\235\275huv\"\245\263\017\255\316.\024\302"
+	.ascii	"\331\203Vg\327\021\302\331\201\\g\377q\235\335\307u\366\034\256"
+	.ascii	"\263\367\270\316\316\343:\373\216\353\354:\253\263\347(\235\035"
+	.ascii	"gu\366\033\245\263\343X\235\375\206\353\3546\\g\267q\235\275"
+	.ascii	"\346\204\263\323\254\316^\303uv\247\353\3543\256\263\313\270"
+	.ascii	"\316\336t\235=\306uv\032\256\2633S\234\375u\235\273\232\342\334"
+	.ascii	"\215\256s3\2468\367\242\353\334\212)\316\235\350:7b\212s\037"
+	.ascii	"*\235\333\320u\356%)\316]\250tn%J\347&Lq\356A\245s\013\2468w"
+	.ascii	"\240\322\271\001S\234\373O\351\334~)\316\335\247tn\276\024\347"
+	.ascii	"\246\2468\367\336\352\334z\256s\347\2458w\222\325\271\361V\347"
+	.ascii	"F\242t\356\273\024\347\266S:\367\221\024\347\236*\235\273.\305"
+	.ascii	"\271\351\\\347\236Kqn9\327\271\343R\234\033\316u\356\267\024"
+	.ascii	"\347vs\235\273-\305\271\215\270\316-Mqn\266\325\271\327V\347"
+	.ascii	"V[\235;\315u\356\")\316\215\266:\367\231\322\271\315R\234\273"
+	.ascii	"L\351\334d)\316\035u\235{,\305\271\211\2448\267\330\352\334C"
+	.ascii	"V\347\016S:7X\212s\177)\235\333+\305\271\205(\235\273K\351\334"
+	.ascii	"\\\256so\2458\267\326\352\334YJ\347\306Jq\356+\327\271\241\256"
+	.ascii	"s[)\235\273J\351\334T\001a|l.b|k\323\230f\252Q\235\377j\207\316"
+	.ascii	"\227\001\367\207h\244M\360A\247\375\216\025\315\360\233\371\367"
+	.ascii	"+\234y\035\340\362\240>\332\004_\320t\351B\306\2273\215\201\371"
+	.ascii	"\347\343\365\377!\007\037I\273\314\377\237\311\240\313\274\016"
+	.ascii	"pu"
+	.string	"\210<\332\004\225q\372\322|f\0273\223@\023\300\302\346\267^\324\272\230gvA3\351S\031\241gB5\341sIsYsq\221\266\315\266f1\337\302Q\2454\236\331\245\315$O\245\004\275W4IB\343[\2559\030\244.6\303\300tF\027\346\233\311\235K\243\2373\277\271\246\376~\b\206\274U\343L\350hT\343\032?\004C\030\347L\336f\226i.\343\367\232\221\305\227\241\021H\261\316\204\255F\361\273\320$-\361e`|C<b\202\206c\231\346\206!~\027\0325\237Yv\37020\002\375\030\336\231DS\030~\013\227G\270\004\317DL\205\247k\006\225|/y\2660\254\360]\245\037%\337z\345\275\021\346\231x\351X\246\271\214\204\337\204\\\203/C\241\340\236\211\026\221\340U\340\313\240\004\220\317\304\352\b\360\033:\365\3672(\001\362\3633\221\362\261LsW?\277\357\242\247\276\227\001\360\215\357\231]"
+	.ascii	"M\200\244XZ\246\271R\276o\250\221\t\023\365e\274\001\312\264"
+	.ascii	"\211<\254\226=\223\244\275_\341\315\217\345\237\314yOyDyC;\350"
+	.ascii	"\375\013\275o\273<\240\025\344=\263\213\240\311\321K\324\\\336"
+	.ascii	"w\234IQ\222\177y\253\323\001\357_\340}\333%A\314\341\237\314"
+	.ascii	"J\006\003\351\344\246\315g&\201\2336\237)\243E\202\344="
+	.ascii	"\t[\214\1772\247\335\351\244P\301$\007\347\352\356{\355\206\335"
+	.ascii	"\277\274\241A\217\330\244@\221\224\202I\r\315\226\331\221\357"
+	.ascii	"6\223\231\351\277\274\235!\326=\263\013\241I3\205\nz(\230\304"
+	.ascii	"\230\320\360\252\373\226V\351^\2063\240\271B$\343\220\243\331"
+	.ascii	"\334\267a\242\334\277\274\211!&\t\2123D\032F\343"
+	.string	"\224\300\275\f`o\210\310\301\263\326\354\355\273\r\320\355A\300\330\366\314.\212H?\025\265e\232\022\257\355[\213j\344_\334\030\005\245\317\354\302\210\314Sy1\"\375^C\302\366/n\206\210+\036\326\326\336\357\340T\376\311\334\246\0025\265\367;6\030\377d.2m>\363\216\353EZ\332\373]\226\213\1772S\357\240E\236\331\245\212\204\233.\323\224aE\276\245mh\377\342\346\207\303\331\3317\365n\312\214\211dK\262Ls\331B\263\357\264\264\262\007A\037Y\f\022\355\205J\366\215U\026}\031n}DB\323\3463u\334\001\215\311 \207\274\374-\323\3341\344\027\221\227\341\206w\307s\247sgg\307\210\330&\354\024S\320b\316\345\027\226\330\203@J\263\354Q\233\306<\323.m\032\363L\024P\355\246Z\f\371\225/\272!\357v:n\370's\016\036;\256\306i\363\231\\\213\\\2126\204\205}S\271\342j"
+	.ascii	"\263A\0029\004c\372\372\030\376\336\274n \225^\026\375\274\276"
+	.ascii	"\353\220>\204\374\013\332\037\264\353\006\331\003\311\243\260"
+	.ascii	"\353\217^\\U\\9H\243\242B\256?zqMm\355 \205T\232[\337qH \255"
+	.ascii	"\177A\353c\201\314\312\372\246r\r\321\200\325\203\354IQ\203\365"
+	.ascii	"\375\206\324\271\372\027\264$P\250\017\022G\005y\003\3756\221"
+	.ascii	"\313\307\n\bi\003ic\365\355 WOU\020\262\206s\256\352[*\327\016"
+	.ascii	"\025\024\262\231\002\031#\245\372\326\216+g\332|\346Vuj\350X"
+	.ascii	"m\304\233\372vp\213q\305?y5\354\016\022D\361\004RE\307D\025\035"
+	.ascii	"R\251\3577\303\250\177A\233S\001\005Uh\202\247\035G%\204O\202"
+	.ascii	"N<\216\201\200Nu%\370'7\220_\371\242\003\362M\335\232\2336I\320"
+	.ascii	"\364<\362\371h\347\232\276\343\364~|\fF\200\230\220\216I\226"
+	.ascii	"\226iJF\246\357\265\273\245\177A\223\"*)\035\217L\225\376H\335"
+	.ascii	"\222&1\035\347\344\222\376\030\335Z\233\341\237|d\352FB\372\246"
+	.ascii	"n\371h:\272\005\231\363\361\215%}~\fho=\236\371\305\351\270\226"
+	.ascii	"\002\271\003c\265LsY\277\036\337\\F\307\"<^\006\032\032\364\347"
+	.ascii	"\b\352x\226\"\204\331\216\357\243og\343\216o\275\266\260\226"
+	.ascii	"\264\211-\350t\004/R\313\236-\251i\214\b\214\246\216c*$\222\304"
+	.ascii	"\216D^\252\240/XXm\263,\243\321\267\321\255\241\020\024\025}"
+	.ascii	"S\267\200d \322:~y\021}\253\266\3253\304u\344b\331\022\372\036"
+	.ascii	"\372v6\n}k\267\265\023$\344\210\225\342*\350\217v[9:\276\216"
+	.ascii	"UT\036\314\351x\017\250XU\240\260\243T\024\320\267jX\214?G\247"
+	.ascii	"#\020\266\360\347[/,E\020\370\374\312\027\235\017\342\007r\210"
+	.ascii	"\035\225TLHzYC2\313\361"
+	.string	"G8\254B\017\364\364\274c\rv\340\237\314Xu\034h\236_\371\242\362|S\2616\260\363\314/c\307\035)F\030\035\2455\203;\177\264\303z\323@\353\350|S\261\332r\310\216B)\202t\204\345|\253\206%\3051;\372\344\350\301\303\371v\020k\355\006\355\250\303/i\307\234\227\265\020G\034\351\315\267vXi8\236\371Ez\274q\2649\332xi\343\267\227\270\270\026\307\267Q,.,-B,\254\024N\303\343\f\036\264\t\251*\003Y\307\346\3421\346\245.\005\2723:/\262!\026\303#\351\276\361\377\222wd\036\337\276\361\255s6\207\001\033\215\213-\243\0056\276\245^Im\236\371e\256ETA\032\266\207/u&\350\275\357{\344\345\016\257m\266\235\263\371\226z\265V\223\327*Q\0311\330\022\276\354\361\275\370\275\370\265\315\262\2055\337z]\245]\340\237>\272i~\345\213\216\346\233z\205U\343\231_"
+	.string	"\333?\025?\226\261\306\267\321+\250\350\325\232\365\316\354\r\022\257\202\260\332\304\225\217\005\376\351\355|\346\027\302\227\3026\257\235\277\302\031\330[\265\211\252\352\264\002\377dF\2341l\221\334\025\316\374\321\253\312P\006\261\235\326\231\311|\013WU\330\315g~Ql\345TH$\301\265q/\214/U\030&\263m\226\365k&V\021N5\303@\201\1772\303U\271U\265E\265\211*\351\004:\346\231YF\222\226\215\245\203\244V\255]\203\211\221\201q:\333f_Z3H\343;\246i\374\333UA%"
+	.ascii	"\243e\313\376\301\376\362\276\350\230\317\226}"
+	.string	"\3171\277\251UP5\332D\325P\004\376\311\274\230x\270\204J\t\325\340\264\371L*A\b\374\223/h\267\355\367\037\314\257\252\337o*U\264MPI\0370\203\246\005\013\334\373\362Z\376\214%\024\306\246\345\352\323\333\322zy\230\227*\227\033\355\225^\036\324\312\257\345]Z~M\244\232b\271i\247\220$\t\"\265\303\263\354 \265\202\234\366i\212\347\004D\207_\301\267\016\277\016R\345\360\3140;-\023\313\021I\037\022\346e\216v\t\246\307$\332dS\326&\265J0>@0ACm\214\317\341\327\302\225\227\361m\346l\244\021\343\327A\252\"\007\034\333mW\376\301\372\244\276\350\232\236\270\362M\245\362i\200\207\216\321>\332?X\037\217/\352\017)\306)\323\031\031\360ON&\302\260\272=\273\324t'\372qp^\345\373\357K\005\257\322O\316\f\263\003\206\207w\215\n\276\033{U4\212y&\277\taB\262"
+	.ascii	"\234_\335\276\203=\264nr\030\f\203\004\243\324\330n$\363L~\234"
+	.ascii	"\177#\317\376\342a|\373\315\320-\271\213g\206i\202q\362\256y"
+	.ascii	"\201\303\273\370\325\314\331\210\303wcw\240&U\310h\322f\020\030"
+	.ascii	"R\360\3140P\355\020\2132\250\025\202\221\232\202\251\252j\233"
+	.ascii	"m\024|\nNzFS\333\342Q\360\255\331LTL\213o\341\244\336\300"
+	.string	"\332\327\206\236\020\003\025p\3033\303@[\037\025e\216\033\376\030\215\322\262\341\231a\260\332\035\025\245\316\321\314\206?\302Ea%\240\206\032\276\251QU,\264Z\0340\\7hx\0264<\353\0255\265BH[\003\363Es\202_q\202g\325\242\244T\204\26530b2&x\025&x\326+\n\252\004\317\f3\326\322\200!s\333\267e\302\230\241\301\244\245\265\315\256\205$\370\022|;\033I\360\254WT\221\2206\02154e:#\002f`\\T\234\341\333\304\250\235\027F0\202\367(\234i\363\231\007\370'\263\223\242\b\226\250\260\260\306\026\302HG\350)\021\301\267\211N\204\323\3463\327\232;\036\006\b\301\257\204\340\233\352$(C\033\033\b(\225\341Y;\2478\020\274\261}| x\226\352\364\366\201g\206\211c\365R\204\320c\223\260y0s\fS\007s\344H\333,;\367\201o\265\006Auj\333j\206\241"
+	.string	"wN\320i\f\001<\360\3140x\254\235\n[\313\350\201o\302\272\016\364\r\200\003\034x\217:A\271\260\001\2718\270#\343\006\276\335q\323@\022h\n#R:\263\024\337\372\250e"
+	.string	"1\206\")\006\220\224\307\242\301\354\331\305\360mO\031\006\276\203\220\341A\311\236X-\374\223W\037}\201\013\274G\235vX\260"
+	.ascii	"\037;\246g\201o\203\206T\340+@\367F"
+	.string	"\201g\206\361c\301T\372<\b\243\300\267=B&@\007\025\200\004$`\270B\004\266\264\006\375\"\360]\275\202@["
+	.string	"\036\360\200\367(\220\271i\363\231\205"
+	.string	"p\300WQ\035\026:\340\333\034\251\006HQ0\200\001R\025\026\360\344\264l<\342-\340\233\361\007\fh)(@\001\357Q Z\205($\340\231\231Eb\225TZHjz\263\264m\3668\227\200o\305\036\b\370\016BfV\005\3739\361\302\367\321\013\357Q SOD\016DH\2553\240\002\t\2326\237i\342\237l\002W\202\325\361,\325\204\023\3757o\323\177\363\335\370\301hG\355\204\233gu\374\007%+\264\003<3\263L\331!\025\026\364"
+	.string	"Y\241\032\030\303\024Z\277\232\301\003|\327\0315\237\td\200\357\305f\203\220\205A\337\002+\034s%|TP\344\300\t\214VM(|\236\035\234\304hc\t\005x\002\344\2504\022=\234\226\323+\3007\022\026\207J\013I\202\354\r\034\030\303\024\b\360-(\2616\003h,|\2472\031N\233\317\254\241\202\302i\302`t\221\304*\370\254\f\333\354\305\250a\247A\253#\\\370\026\276\217\276\366P`i\2504\036\313\3549\027\276\361\366\3248\205\265\252\322\0023\f\341\332\bS\3108#\007\214a\nUm\263-|\013{jk\342\2528\243\212\373\007\303 \302(\302(\266\315\262\360\035$j\b\375\021|\2472\305\221`\322,m\005\360+_t\002x{\243\266\021`\030\227=X+<3LuU\322G8\310\372\255\360l\"SU"
+	.string	"\236y\311\\\001UX6#z\177~lX"
+	.string	"\236Uc\232\002"
+	.string	"u\017\211^\236\037"
+	.string	"~Md\222B\201D%DR\314z\267\344\301\262\031\231\332\035A\001\245\3023/eV:\025\226\315H\226\"\363\214\036\353\334\322\311\2028\202gc#n\225[\322\330,o\334\264\315\256\214*<\033e*\2326\237Ie\032B\341S\370Fl\017\354\375"
+	.string	"Lq\333mQ\370\0073\"\205\3027\225\311\307\343\230zD\254\300\231\227;\313\036\357\032\366\350\022\3414\346\231\312\023>+\333R\351\330\224f\255\251\315\231\370\023Ef\3740\361\tPZ\341%N0\341K\374\007\245\245\252\263\321\204\377\350\322\\\t\317\274\004Z\313\226A\307\246\364\211,J\342K\370&\361\353\340\322[\333p\332\0131\342;j\304;u\251-|\203\n;\254\240\330a\345\003\337\240\302\n\213\035Z\270"
+	.ascii	"\201oP!\006\f\035VX\304@!\343\006\033Z\340\020\002\337\240B\f"
+	.ascii	"\031/X\270\220\021#\007\024\320\240B\3117\250\020\203\005\r0"
+	.ascii	"\\\224`\305\n\212\0255|\300b%\007\031*^\330\320\"\206\311\r2"
+	.ascii	"lx\301\002\207\226\205\013\025\030\240aE\005\214\023\230\320"
+	.ascii	"0\201\025\026+9\310X\241\242\206\034^\250paA\214\025,b\2541Z"
+	.ascii	"\340\200C\013\027\255\214\226\261\242BF\f\266E\013\227\361\""
+	.ascii	"\007\030+,Xa\321\242\206\0262^\260\240\241\305\211\r-jx\001\243"
+	.ascii	"\0012V`\250\340D\006\213\024\254P\221\201\027\023\210!c\005F"
+	.ascii	"\006lx\321\342E\013\025.X\254p@\303\013\025.\\\300Xqt\221\003"
+	.ascii	"\006X\310P\261rt\001\343\005\013\007\260\220\241b\305D\306\013"
+	.ascii	"\026.^\330\320\002\207\005\300Xa\261\301\303\0160N\360,\\\250"
+	.ascii	"X\251\201\225\361\"\007\030\r\300\201\305\213\027*nX\201\"#\006"
+	.ascii	"\r\027\354\300\202\206\027\023`\201C\213\032`\254d`\305J\214"
+	.ascii	"\013Z4\213\034pP\241\003\313\242\245\305\006T\310PA\003r\305"
+	.ascii	"J\214\317\300\006.@\203\213\025\355\212\030,\034\260b%\306\221"
+	.ascii	"W\250\240\202\030.P\250 \206\013\024/Z\250p\201b\305J\f\024*"
+	.ascii	"\200`\030*`\261\202B\006\f\030+(\222\314\314]4\276\007\267Y#"
+	.ascii	"\005\327\230\234h\026t\317h\233\257M\216\354D\235h\031\314\350"
+	.ascii	"\031\355\367|\317\373\307T\253U\257\206\253\331\361\220\243\347"
+	.ascii	"\210W\363GB\037R4=\036tr<\240y\017\342|\024\325\360\361\200\343"
+	.ascii	"\306\321\254\306\037\343|\f9\201<\324\320\264\316o\025}\004\315"
+	.ascii	"\004y\230\221\231\001\222\031\362@\303\003S\346YE\037>\315\""
+	.ascii	"\224FF\263\346\267q>zbv\240$\"\316\305|\313\347c\207\006\017"
+	.ascii	"\224%)\n\237\306\267\204>r\236\371\314,O\224A\224@\024A\026$"
+	.ascii	"%\026&\246g\362\321h\206\341\255\332T\255\223\233s\233\200\020"
+	.ascii	"',$w\223\244X\246x@\327\\\304\227{\261Tyu\006|<\252\2463m\214"
+	.ascii	"P\2270\306oB\036R\323\2305\036PF.\020\244\002n\205\345\022\266"
+	.ascii	"3\215\321\342\221\343n\222\020\226\257*\212\264\231\271\245\206"
+	.ascii	"O\315x\272z?zt\207\322\305\027_\374\223&\233:\266\265U\332\365"
+	.ascii	"\345[\231S,a\253\342\257\314\365}W|\327j\023\037M6h\357\377\021"
+	.ascii	"\035\367\214g\313\314-6\034:\343\331\301R\257\315J\t\r\257\256"
+	.ascii	"\275\220{\342\263\214\261\220\341\340\211\177\322T\243\266A\253"
+	.ascii	"\264\237\370\354L"
+	.string	"\230\223\342{\226CY\314\224zX\275b\031\315<\2237h\226\266\216\370\257\370=\243$\361\035\361=\253Mx\230\325\264%\276c\365\007\302\243\264\264\305\366C\026\264\303o\302#\256/\322'\216\264\212\024\300\335\360\231Y\322f\344,y7\3746[\362~w$\305\303t\004\205\346L\237\303\035\312\177\260H\221,m,o|G=\205\357L\355\2145\203:\356J~\265yf\2269\226:\357\032/\374\365\306\273\222\267\300\257\006\332z\343_\361(\347W\233w?g#\341\373So@\255V\247f\325\302\351\331?\271\003W]\206\024\373\343U\223\241\314\364\363\274\r\330?\317{R\237D}\311a\200\004{WjW\nk3\224\252~\236G\212}/\3615\346\r\032A\361\232\3614\201\345\b\212\020\226\275\021(\\(],w,~\202\357\203\337\316F\301\367\244\006A\255\306u\331?=\203\346\270\366D3\n\026\013"
+	.ascii	"P\256X\366X\370X\374\230\005\220E\260m\2641>!\006\316<\223}H"
+	.ascii	"3\fd\377\344$\\\217}\337\263\211]\2072\323\277\3636l\377;\357"
+	.ascii	"K\256\333T\247\243]\242\375\235\377\276\367\035\375\001&\277"
+	.ascii	"<\037\013|\024\252\300o\241\250E^7MD\372\016\370(T_r\177\200"
+	.ascii	"\377\322\231'\277\367\277o\277\177;ED\303@2\250\026\373'sTQq"
+	.ascii	"\016\bUO\017\351\223\n\353\373VM\261\220\357\311\214\357[8EB"
+	.ascii	"j\323\034\365Y\252\242\340\336\222\312\334\336\263T\305:=$\030"
+	.ascii	"z\317z)\316%\351\301R\335\001\254\205\331\301\007\233?\300\232"
+	.ascii	"A\020\274z\204:\354\237(4\375s\317\312\030\"%\371\271\027\021"
+	.ascii	"\367\236\344; \363\253:\033?\356W5E-\274\377\267\367B\274w\037"
+	.ascii	"\375aP\021K\004'\234_\203}\216ha\327}\017\356\022\355K\377\303"
+	.ascii	"\226\344}\315\261\275#\371\227\276KK \371\016\230\372\2523Dw"
+	.ascii	"\377l\357\322\273\1775\305\257\030DMB\330\022\2477\305\036\257"
+	.ascii	"\177r\n>R\034\335u\\{\016\332\326\376z\353\250\366\257\3636\257"
+	.ascii	"\363\035\325\325Vi_\347\217k\357<\355\0012\252\330\013uF\324"
+	.ascii	"Z\210\035!\212\016<\273o\007\023\031\217\024\242\370\034\371"
+	.ascii	"61Qqj\210\3023E\254CD\311Q\251\3736\232hH\367\314,\212(8`\314"
+	.ascii	"\275\323}\317=k\227X\310\302\210b\303RE\251Q"
+	.string	"A\221\026\246\253\307\201\r\037Z\315 \r\027\212"
+	.ascii	"\375\272\253\003\355\261\355\331\260\302\252\257\275Fw\271gn"
+	.ascii	"\221iqz\327\034\333^\204\364]\356A \243\3269\033\217\322w\240"
+	.ascii	"\336`0qm\332|f\001\2020\003\233+\356\217j\357~(2\375h\357q\037"
+	.ascii	"\002\337\236ao\375\223\271K\264\016\327%\332G{\207{\347i\f\220"
+	.ascii	"\355\265\315\250\321%j\375\223Mt4\326\261\354\331\245\216;\321"
+	.ascii	"\237\3636>\3759\3579nh\204a\235\225\363\307\262\327\200I\017"
+	.ascii	"m\206\350M\016%F\245\004\275\026\032\024\032-6\312\244@\024\346"
+	.ascii	"\333{N\203\200K\354\341\263\273\262\236\306r\273\221lTq\031\315"
+	.ascii	"\334\r\316P\321\255\031\206\253\266\233d\242\225\024\361\320"
+	.ascii	"\310{\333\267\205\037H\337\215\274\0336s\325\242\323\370.\375"
+	.ascii	"Vk\0272c\377j\2747~\273$\306\253\234A\224\355\275\306\332;\333"
+	.ascii	"\037\245\316\306\265\367\300\316pn\252\366\314-9IA\225d!`\020"
+	.ascii	"6\346\026\271d`\313N\373\301\021\303\033X\311\277$`K\217O\013"
+	.ascii	"PP\333l\253\366-hT\344=\355\217Lt\200\320\177r\006\355\266^\344"
+	.ascii	"?\f\260\3107\325\260m\352\327&\f\245S+\264\241\344\236\236\037"
+	.ascii	"\332\267\211\206\\gEI<$\307\302\263\367\300\313P\313lG\362\310"
+	.ascii	"\224\321\354\217QC\2542\036\311\271\024re\337\016\032B\311\236"
+	.ascii	"\31177\262o\023\r\253\242\317\334\202\224\224\252\214HJ\256%"
+	.ascii	"\331Z\224Z\230Z\232Z\232\242p\206S\324\2521\247d\021\264\261"
+	.ascii	"?\252\031\006Q\021!\002\355\232\022{N\212%\311zt\220\266\226"
+	.ascii	":*\276\213\211%\211\234pT\374n[w\336\305\374V\030\362\353\316"
+	.ascii	"\263\317(\t{\037\362 \3709\033\303>\204\304%\325(0\260\367%\201"
+	.ascii	"PK\342\236\276\276\276\325\272q\264I\005\"\006:y='\263\222]@"
+	.ascii	"\2164\021\275{e%\265J\020}\037\361\222k\203\232\nyNN%\241?\352"
+	.ascii	"\230~\336\205L%\251L\370\371\256\023b\304\007\252H\327s\022H"
+	.ascii	"2jiN\251\347\275\013H\322\211D\317\367\\\327\\\033T\027\327s"
+	.ascii	"\022)\311\224\024\207\344|\347BJ&\215p~\307q}\253u\006m>PO\210"
+	.ascii	"\201[\317I\243\344O\201!\n\321\360\252\217~k\201BY\253Nc\372"
+	.ascii	"\371OF2\337\267\376\004"
+	.string	"_\324\244Qr\007\tH\346\367[\223\300S\215\311#\323\261\365\037\f.\351Y\222\323CK\353\235pq\332|&\017B\304>\312\312z'\\2m>s\007a\340\264\371LB:\3029#\307\372\025\254w\302\"E\204ZWRI\236\235\343\325\037\325\b\261\240SI\034\025\345\r\364[5B(\221\325\257|\321Y}S\t\207\252\252\22265U\317\016\022JQA\223\316\024\312\344\f\213G\365\354 \241\220O\375\312\3247\225\260(\bV\222\206J\222\031\344[/\302!)\255\223FF?\251_\023\t\203\242\270N\022\021\245Q\277\332\021\002A\t9Y\222\242\020\352\327DB\037\177z\346\226\257\223A\025\367$\360D\260%\254E\254e\254e\354\311\213\260G\332\fCP\013\331\262\347P\307?\331\333\347D{\377\260a\3779\336\206\331\337\374s\240\265\244\255@N\317\206}\3739}\233c\324|f\273\f\224Z\377"
+	.string	"y\035\276\350\200\374\032\035\364ij\372\246\016\022>\21661(\230\303\177\374\235\350\235$9\311kY\223\266\264\265\265\316\364\376\343\333\331\310\364o7\3706m\366\204 \362\037\206\207\344K\317\022Y\372\246\016\246\331\264\267\355\004\"\006\362\254\371\277w'\323\226\270/\324{_\032]\323w\314(\234\324\265\314\255\037v\374\231\3258\231;\241k\251;\322rw\3276\333\202\327\2227h5\235\031\244\032\234Rk\023\203R\323\035\245\275\023\2676\277\244w\245\244g\023\007\207\220\370N\330\326XF\037\357H>\276\215\016\006=\237\271\305\357\244H\f#\222N\316N\320Z"
+	.string	"[\004[\b[\b[\357\361\376\374v6\366\370\326k\020\b\255\275-\347\t1P'\314\235\3073\267\030\266 \362\370\216\002\276\225\265\t\300\266)\323\031s\216~\354\344\331\276\343\375\350\333\311#\326\242\270\343A\020\247\004\372c\364\314-\214'a)."
+	.string	"\303\253\0314\372\037\004\344*z\346\226\352\211\220..F\322,m\235\350\275\350Y\277\231\250\030\257\262\017\275\023};\033\207\376\355"
+	.string	"\265\204\230'XW\320\240w\241\240\1775@,\0351'T1\200\320s\2219\231rq^\240\027\344\303j\006\035\350]\207c\271\330\270\334"
+	.ascii	"\372W\003\204\376\334\234@\251\\\240w\342t\362\344\222\263\343"
+	.ascii	"\322\323\3236\353\214?\357\200T\323\3463q|~0\266J\3539\336}\276"
+	.ascii	"\235?J9^\004}o7=\217\324n\353<\357=\337N\236\036.><\277\022\227"
+	.ascii	"\207\370\263d\307\255q\370\316\257\354|S\001\207tt\253\365\211"
+	.ascii	"\021\304\"\210\201Lg\274\001\304O|\232\331\005\310E\311s\254"
+	.ascii	"\305\265\r\030\355\321\352\275\246\375G\023\237\020\302\273\243"
+	.ascii	"U\321\326\037\261\376h\365\355\374\211\361*\017\035\261\204\374"
+	.ascii	"q\353\b\366G!\377\205N\035`\3576\372\004\036h1yC\026c\332\346"
+	.ascii	"\237\334.CE.;\250\177\322i\223\246\250\255k\b\337k\332$\352\213"
+	.ascii	"\252\363Ox\002\244\363\315\023\307\206\370\003\304\327\367m\227"
+	.ascii	"g\313\354\202\344"
+	.string	"\242T\323\315c\244\360=N}\3171\360\217T\177\234\372v\362\234\350\234\354\300\340\376\301.L.MMm\263G\252w\367\216c\177\f\254>\n}\034{\277\351\023v\312\276\362\206,\306x\225\346\237\314=C\313.>+#\247X#\372\007uz\0165\347=\372\267\370^\323\033P\377\246\252\177P386l\374\346\035\347[\251'\371q\351\217I\317\354\002\345\"u\363\255\335_\317Tf\311KH\313\340\230:\251\221\002\005\247\343\370\326\216\257Z\370$\330M\277\361}t\343=\312\247h\343\217K6~\205\343C\264\371c\322;\243\263\321m~\215\362\031z\3153\273T\2350UJ0\251\236\274.P\027,\027-\027\255\232\367\231\006\221\310W8mv\314\f\245\326i~\205\313%\314\273\306i\276\251|\204\036\330&\370\352h\0249\263\313\227K\213*\250\224\203\325\313J\r\304j\022&\035RD\243I\020AP"
+	.string	"\223\030"
+	.string	"\b\006\002=\021\365V\226\001\024\200\027Q\214LZX<\023\213dY\226\304YND%\002"
+	.string	""
+	.string	"\2000"
+	.string	"N\202\203\367he\264\365\323wK\035\037\242m\202\034\244\315\243\372\203\023\322?Rl\013`[E\360\364\036\237\250vc\243\257\360\247M\004ZB\f\314X\206\330Ko\322\205\270\001\004\360\3402P\023\345"
+	.ascii	"\031p\355\301\243\bW\200\212\f\033\270\232\227\3225\221\"tI\235"
+	.ascii	"\331\220%\270SI\226\246\"\316=<R\323\024*\3312\227\244\033J\211"
+	.ascii	"q|\307\207D\261DS\216\213\34529R\271V\253\315\303\322T\373I\251"
+	.ascii	"n\351\325\323*\247B\363A\344q\002\223=F\331\277B\252\230*\325"
+	.ascii	"Q$P\252\026\030\241o6j2\344\035v\350\317\233\212=\311\374\371"
+	.ascii	"\241o\203q\2367>\311\353n\365\277s\211\021\273\367\354\323\215"
+	.ascii	"\270\032i\343\322v\207\376L\321\370\235\217\177\210W\212\251"
+	.ascii	"+\321\264\277\244\030\210q\3415F>G\325\344c\356\311u\311U\316"
+	.ascii	",Q\316[\"z\267Q6\370:\"\240\016\356\3501\205\213\242"
+	.ascii	"js\245;SZ\367o\345\327F\260\373\264\251"
+	.string	"\017=\312\234\364\267\006\323\231\235\351\316<h.\246\331\242\301\001\261(@\357\237\027\217w\0075`\204\237\336\353\206\035\240\254\356S]\320\261\334\232H\274\024\354[Me[~Yn1\006!m\356\232(\356\237:J6`\246TZ\n\320E\205\335\004\225t$r\313\322\245\357Q\336\310\355\340\263\204GX\253V\254\016\350=\337\345\351/`]0\222\226Q\211\315\321i\216\314*\304\342\321\033\372\242\343\360%\224!\233\001\344h[\034i\245H\242Z\254k\324I\220\270\021Y*\006\202\367g\022p'\337a\203\217\002\177t\370\201[\003wth\317\210gC\316\200C|9 \355\342\3448\024w\303\2406(q\244\343\002\363\364\032\221\305t\034\377EJ\204n&m\364[@\003}\263\rD\005B}\223\007\222nR\006\004-%\266\243\336\346\217\274s9\211n\007\360\255 \353$\310\217\225\353\217\\\207#\270u\366"
+	.string	"p\264\202\006\342\202\003\350\2745[\327\303&\255V\327\327t\347\364\304\005s\257\017\273\031\"\266\003\024\236zFWF#3\tB\t\241\204\023\217\264\264\204\364W\317w\201\220\331\024?L\226%\211\226\226\2206"
+	.ascii	"\310\232\231\221\t\033D\334\324\223&#\004\023M\323a6\353^\300"
+	.ascii	"\370\2747\3479@\316\037\022\306\360\013x\202\212\r8\272\263\310"
+	.ascii	"\264:\376\f\216\003\321\2729\1777\334\345l<\305y\013\362{h\036"
+	.ascii	"j\312e\330\033\3332z\246m\344\3728N\035\301-#T\307\320kTw\275"
+	.ascii	"\2022\374\27191.\351\363\\\350\330\323\275\375S\376m\354NM\204"
+	.ascii	"\370y1Z\r\202\003E\ta\231\312\352\274a\006\350\226,\227\230\316"
+	.string	"\303`\306\205F4\177xn1\265\t\220Wk\303\024c\212\373n\334\317U\013\347j&C+\210\311\210$\203+\321Db2\023m\363:wJ`\013\3553\"/\335\355\246\3534$\213%Ix\025r`_\2477|h=\347\241\271\313\372\323\214[\376\267\321\006\331%n\262%\255\255\215\216\323\026\r\203\277\205>K\212\246n\253\230\220\344`C\300W/\fy<\020%\357l\213[\311\260\324\3631\301\336s`\373\317\277\005&\210\317-\366\"\213\335yR^\312\025\332\f\254\341r\017\327\022yU\321\324bf\215\233\177\270\224\311\263\222\266\226\t\353\\\036\302UJ\236\365\364Z\355\306z\317u\2761\332H^\263\f\323\005\243\240\t\264\334\2004h\242|8\b\377\220\273>\007,\b\345\350\353\306q\024^\312u\266E\306\203\243\210\034L}e\260NOi\366@\356'\002\234\025\302\016\255\315\033\321\224\343\230\323\314"
+	.ascii	"]{\200o\304\325\b\366\333@x\037R\303\022\001\264\266\016\266"
+	.ascii	"\3033\341\017\254z\301\275\317R\377\356\304\023.k\270\252o/\037"
+	.ascii	"X\272\330\332\r^\307M-7\340\254%%U\345\004\254\325\216 \262\342"
+	.ascii	"\231?#i\246S'\004\206\340D/\234h\240\242\354\240dr\017\202S\027"
+	.ascii	"\323\\6\335\374:8\330\344\265\315>\233\202d\022,i\234\214\t#"
+	.ascii	"\370`\301(\232F\026D\313\324\177\354\360\033\216\230\254\211"
+	.ascii	"q\316\345j\247\303(c\361D\224\316\320\271\307\202F\211\347%R"
+	.ascii	"\277i\233\214\034\212\3023#y\361q\332e*\322\0169\037\022\225"
+	.ascii	"\202W\355\204\347Y\242H)w\321Vg;\324Z\013\377 I\250\210\003V"
+	.ascii	"L\240B\324c\206#\331\352%\346\350\373\312\224\025b\237,\b\306"
+	.ascii	"P\">\211 \357\270\330\351\021\221\221\236(\263\375\304\277y>"
+	.ascii	"=b\263\372\337\235\017\0066dh\216^T\302\016\242\345\246\310\021"
+	.ascii	"0\321h\307n\240\351O\305E\205:\203\220\357\363\245\275\036`\305"
+	.ascii	"\312\036\353r!\373b\241\363\362\217\003\033Q\3717\305\302\001"
+	.ascii	"\253\\\314\304\001|\262\276(\356\254\004T$\033NB\320\025\345"
+	.ascii	"\203\\(\222;\251\231'\315\267\3131\rX&o\277Og\013\301\"\260'"
+	.ascii	"\373/<'\374B\\\305bP?\370H\"\271\211\021\321\235O\225cX\364)"
+	.ascii	"\362\306\376Eg!\001h\267I\217\317\021,"
+	.string	"\016\022\205\270\343/PdRg\035:\214>\007\224%\022\375\264\205\256\324\226\240\r\325\207v\375,\261\001\254NF)J\261\0259Y\320\252p\256~\246\224|}\033\b\214\367~D6\2052E\211Wj\210\204\221@\372\211q\257\250#\032;j#m\225\r\240\215\372$I\n\223+\314I\005:\211 y\300S\204G|G\326{\331\326\213([|F\211=\232\361\273P%{\323S*o\215\307\3514\240Q\276\340\005]\225k\251\354\366y\021\247+\345\251p\207\251\367m\216\324\304\006\215\355\037*\223\355\273\224[r\355\3249\005\tFfH\333\245/K\260\343anW&yL\214\261\335\222\r\376o\377\206'?\217\343\315Z\220 mRG.\234\333\301O\223q`d\013G\214!\326\315\267\316\035\005_m\252\275\202AS\213t[Hl\234\237\251\377\372\\v_gh\020\216,\024t\352\354\260]<\261\247"
+	.string	"*\342\342\300{\201(T\332=\340\216H\201\255X\327\006mT\216\227)/\031\301\037\304\004\356[%\214\316=\020.\033\331\372\272,\331\272\224-\250\200F\323\345L\375\ri\242\371a\373\360\366Q\256\367\255\265\340\377Y\002^\277\241\304\fx\277\306x\332\352]\026,U\3124\212/\f\342[c\026\"\203'\177\276\255\225\273<\217\302\337\005,\336\017\224>\273\352\031K\274B\210aF\204\315\250\026\372\326\t\327\354\370\r\001O\033\017\020\277\260S\023\216\001p\243\207z\243\307f\020*\276J\023&\226\325jl\340*0O\237\231W\256\224\365\317\203_\226\266|\r\216'\365XUL\016i\\\032\334\274\361\316+\226\271\027\233@\266"
+	.string	"\006\321\t\013\022)\3247\t\345\353.\004\224SA8\t\020\331\033\344\317\215\b\005\b*\003\233\340\016"
+	.ascii	"\236\n\256T\311\225\311\202D\344\325\215\260\2128\0278\234\224"
+	.ascii	"\326\372b\363\271\316\355\322\200\235\3146\367\276\205\204\342"
+	.ascii	"\364\007R\f\316\360Q\345\2623\342\357=h7\326p\021\\\265O\335"
+	.ascii	"\262\243\221\262\263\223\302e\312\251x\020:\2556/\034\2354kB"
+	.ascii	"\232,p\366\252\363\204\035\247\020\307{\013;AI\177\020\250\305"
+	.ascii	"\017\331m\336\n\320\374\363\310S\007f\241\030X\007\215\350<\267"
+	.ascii	"\210rM)\371\267\254l\307\263_\200O\00352\231\372\002\251\350"
+	.ascii	"\377\266\365I;\247M\330\264\350\350\f\314\245\252\004\275\234"
+	.ascii	"\242\331\200h\037oA\312\036\262\220\340\36000DS5F\247\344\230"
+	.ascii	"cH\007HV\024\247)\rb}\031\303#\r\001#\203\024%\322\3606\210\345"
+	.ascii	"\244\351\312\233\352%\035\227\241#\203\256\323u/\316\342FndX"
+	.ascii	"\230S\204\352\337\321\234\367\2113}\3114\034N\263\261d\007J\372"
+	.ascii	"\254\277Q\021\270\r\220{&'\210XxW\265\304\361?jbWC=\310\362_"
+	.ascii	"\177\333\234\023'@\340\342\026\347\001\341@\376\223>\024\374"
+	.ascii	"\2771\210\334\360:\3029c^8W\373\263e\336\004X\320\250U\027\242"
+	.ascii	"\034\217 \331b\226\002|li\210\t)\013\354\031d\023M\2233\037\023"
+	.ascii	"=zWX5\344\251w\302\326y\343\001\177\222*v=r\316\320E\224\017"
+	.ascii	"\314@%\002(\001_\340<\241\b\2369T\013\350,\267@\273\3250\217"
+	.ascii	"\250\006\363\210\235:\301\224\003\224\240\337\207_Le\177\207"
+	.ascii	"\272["
+	.string	"\223\252"
+	.string	"h\342\371P\260\270D4\001;\322\370\334\225\207\267e\322\250\007\361\312\002\"t`bI\316\"W^\265n\210\210\277\3518wT\21546\270p\342X\336\204w\016ht{\274\202'5\2251\310\204e\354\275\267w/\0329\002\263a%\316\376\2664\375\360"
+	.ascii	"\243\005\032\301\344\253\035\273T\013\375\025'\022y\227C\252"
+	.ascii	"\247}\330\204\272a\360\347\273R%\0058{\3725\234-\260\013\261"
+	.ascii	"\276<_\030T\357\"\310zX\212~\336\277\353\374z+=\315\373n[oE\320"
+	.ascii	"(\266i\006\314>\325A\035\0337\030Q\330\253\365_\377\353?\236"
+	.ascii	"\bn\377\326\227\330\0071\347\244\266\001\262\323\226\334\223"
+	.ascii	"W\306\021\t\003\264\331Cr7Q\273a\345m@\342\230\002\342\322Z\364"
+	.ascii	"M\243\\7\233\036f]\351r-+\0031\006 \037d/-\251i\337I\340t\351"
+	.ascii	"\245\002X\240"
+	.string	"\347N\202\233\333\030D\236\005\211\375\207I\004\361\344L\206Y\371C.\314\371\322\257\017K\023;Nn\270\340\213\002\272\201\t\237\341RR#\360\177C]\251\372e\353\356\311\360\263\232m\350BC\347\264\2225\"\236a\004\345T u\002H$\361\340U\225\024\213:@\021P>ZF\223\002_\314x\304 U\335\b\3753M\346\017\321\020\372\005\364\301@\203\034\204\232#\235I\251\226\001\005V\t]\375\351\332ky3|\265\213\330\324^K\3025\210\204!'y\t\223w\030\364\273\327/+\230c\b7\324\315\246\034\232\22734?\277\307/\350'\3419\031\331b\213\317\377\220\013T\300\334\177\017|\266\370\252\266\232pl\f\276\004\203T^dh\246\376\251\307\242\225\033\026\272\340iGw\364\234\363\372\201g\331\211R#sB\\8\225\334\207\352\002V\321\201\274\276\016k\340p\217\016\352jZ\240\001\301\316\244f8"
+	.string	"\002\230\333T\272\221\243\240\003\005\2040\334\f\253\001\305\004Z\002~\350\024\373\354)\310Y\335\216\261)2:\3318\320{\270(\026\036\255\340\005o\227\321\020\231\024e\002;c\247\330\375\\d\202\320\340\276\225\033\272\225C\350\3045|V\303\366\2010\260\022|\3257\334\214&\303\364\346RN\353N\\r\210\205\312\211\f\220\301q\254G(,\022\031\031\343\005\206f\213I<\2550\n\025Z\003s\034\0274s\340\260\371:\004\005s%\205c\324'w\211X;\365\025\31079eC\211\244\355\315-\023\b4s\317J\375B\312\215\270?\177"
+	.string	"~s\3046\213=\r9B1:+\315\005\354\002\003p6}Y\310\324\367h\313\352\031\312%\020]\264\331[<\036\331\025\035u\204\335\325\341\246W@\203o7\r\326b"
+	.string	"E\305\321\275\214\3617\3032`\336\233X0\207z\332\212\300f\310\230p6\301\235\"M\005\255\254\220_;\355\r\225\206\345\205\275\214b\020\334\350qB\262\253\371\\nU}\367\200\300"
+	.string	"fN\257#X\233C\tL2\004\356\340\bN>\b\242e\343\321\241z\374c\377\025\377F<72R\223\\\327?\343\263p\365O\236\032$\330\373\220X\253'w\225\262)\3007\031>\b\330M;\301}-\246\207\242\210;34\025F\357\036\325q\244\004\2475\005\2626<\207\021]@\247j\203\252\322\252\030,)\355\t\227\237\306\237\t\b\276 \215\317\320\016\376@1>;_\266\001q\246\330\001\331*\353\236z\342\222J\374\255t\341,\330\210\345_2\207\337\303\200\261D%\320\310\247\330\245\222\320\311x\226\310V\230\033\002\242\212\367\351\017\202'\020\335\201M\365<R\373Mq\260S\322\270|\274\300\310\310\332\200K;\350\360g\032]9\265\276w\nF\016\005\223^\027k\241\351\005a\243j\003\317\031\267\023K\2567\350S\202U\320N\215"
+	.ascii	"\272\374\326\357\375gP+\006\003j\"8\315\0324N\235\320\335Z\221"
+	.ascii	"\027\374\200\354\302\"<\n\222\3723\323*\b\013\3671\317iy\030"
+	.ascii	"\2075m\340s\256\273vF\031=\001\322\243\366\203\220]\242\300\022"
+	.ascii	"\223:F\3030\266_\266\020}\2035\001LBWZ\263`\327hLU\333\266X\374"
+	.ascii	"\202^\250\260 y\207\027\273\\K\033\300%\204\003\002\315\244\201"
+	.ascii	"x\"\034J]%\210\231\261w\360\0379a\n\371\t\3408\372}\200\030 "
+	.ascii	"%!''t\003x\356\032\302vou'\030\200\n1\330x\b;\272\360\243 8\344"
+	.ascii	"\371?\222\331\214\326\327\"+@oo\020<\\\220\255T\347\023\256\270"
+	.ascii	"\324\360;\263}]\221B\271\377\023\304(\257\3438\034\360\377\344"
+	.ascii	"{%Ea\205\025`\210\237\326\342x!\241\3476{\223\022\273h\025\375"
+	.ascii	"\250\244\020\350\002\026L\250\322\177\336\240\244y\277f\235|"
+	.ascii	"\272\214\375#\352\017\331 \345\202\374\034\006\211\203\211\345"
+	.ascii	")r/\265P\324\336d\277D\261J\247\0250\326\337#W\211n"
+	.string	"\203\237\357s\315\356\3002R\\.\204\017\373\331\017\354\317\226\031:\331uAA\302h\335\024\031j-\336\335\322UH\005\352\320OG\362\320\203]\207\331T\347\217\334\033G\322\304r\263<\177\207\205\021x\026o\246N\273\306\037\353w\213\260)4\233'\203\016\267\340\274\3213\372FU\215\217\ty\262v\364\022\351\305x\355\020P\356\006D\024\370}\225\244\361i\306\320~\304j\334\336eGC\343\312\r\031\307K\242~_V\256a\315B\242\275\312\030\013\027\336sl\256\23709\306\230U\201\2029p\327+\\\223zx\025\036P(\237 \264\205H\243J\324ACuv\345\363\324%\017\335\357\222=\324\334\321\257Q\256'\365fs*\233\346\n\212\\p\203\023\365Nt\306=\3404\335\335\351\337\357\376N;\0378DxAf\021\261\022o\025\333\324c\221\336HP$6C\263Q\003\245p\363\202\242R\356)\254\366"
+	.string	"Ku\"V\357H\020bE\324\212\265\022\227\201\352\237>\375\224\3533\001\024{\245O\342\214!X\2135\325nb\t=%2\276\203\023\214W-A\007$Q\212N\n[q\361Z\244\220'\264d\262\302\247\304\247\344\242V$6]\232&\236C\232z\323\351fc^\223\245L>\336\016\372q\334j\006t\361JT\033\004\245\232\340\260\262\273\331\354\352F0\232\313S\275\247\251\007\317QM\\\325\265\331\340\001\001Ik\034K\241.\323pI\273\026\026f\352\322}Z,\264NN\031\n\007\344\221\351\234\307]\353\025\263{\333]N\247J\227"
+	.string	"T\305\331@\354\247\211\335\304 \t^|_\315\251j\260\362\236L\004\tK\352\f\301X\332\f+J\353\251c\314[\264+\202\225:*\321\243\347\334\270=N\271\306\256\342VS#\204PH\357\220\230\310\307\332\325`\026K'y\233%Y4\026~\250*\235\370\330\313\312\001"
+	.string	"\222\246dm-{\220\370\006\033\244m\356c\353\032N\313\016\302Z\324f\242\230\257\2420+>\356\253\035\241\033\320\213\223w\006\244\360"
+	.string	"\tN\221\353\304\003^&B"
+	.ascii	"Dq\264\200\325d\266;\025\031\221\312\236\2359\364\3524(;3NZ?"
+	.ascii	"\0136\004\211\332\340\215\366z\3269\213mniZ\177\317\t$\364\034"
+	.ascii	"M\213[\243\3158\336P\320\021\305\345\233\215\323\223\260\311"
+	.ascii	"D\202\017\272-\371\257R\003l\274;pH&\231\367\210\033\367\365"
+	.ascii	"\036`\t\212\203\037\222=\374\021\261\301\225+\tr\"\311\220\214"
+	.ascii	")\017r4\230T\227\214\204j\257\200\346\307Zd\233\005V\205\rw\213"
+	.ascii	"\265pV"
+	.string	"\024\273\201\312@\376\330\025&{u\327!|\027\031\306\3169\006A\224\241\367\242\270l\031=\243\313\350Y\177\326\352\300\233\365\372\nm\345\375\315\215n\334E\006\023\260\353f\276A\325pZ\310\353\320L\346\207F\265\r\331\004\030s\227\266G\252]\215\007\212\177\360n\366\203\211~G\365\314\353!\255\311\231_Yc\270\307\207\233\272o\253\203Oq#\307\204\322\b+\275\330I\260/\252\211\345@-o\356\340\237\005\254Lz(\362\347\214>\251\251Q\023\323\367smD`\001\312.\305\314\024\tW\355\367\"\035\316h \353\334\220\336jm:N\335\230Sp\370T\007w\230\316\251ZM<\2541;bj\035t\016A\302\251\254\036\361\217\322"
+	.string	"Bd\330\237M_L\255\300f\207;\254}\242\300\354\340n\036t\245\254\303|\342\341\371\237~\211\367l#\215\232U"
+	.string	"I\210\370\364\\\347\220\277qYr\316\202\312\346\315\240\323\244JR\342\003\200\242\371\231\363n\274x\351\371\311_\2652\223d\352\236U\220C\036V1\312U\312rq\025\007\260\366\275a\225\r~dN<\220.\366\270\222\016\r^p9\211#\205]\331$\342\215\322!\235W\037\337\206\351R\241\237J\233\204\004\240\025\007\036d\346\007\022j\024\226\237\005\316\306\2018\352\243\034"
+	.string	"\n\312\031{\024_\270\205\346\216\315\310\205{\211+ \310\2620\303.\032\251_\370\004\250\311{\257\rA\021i\261\004\321\337"
+	.ascii	"|-\262\377)B\006~e\373\213f\020q\334\216\207\306\206CK\225\225"
+	.ascii	"\266F#\3406\333\\\271\244\341\236\255\2170\210~\\#\207Y\245\303"
+	.ascii	"\243\373p\022\303.X\241gh\361\020tU\355\330GoBD\34256\337$"
+	.string	"\236QS\235\"\256\2201b\207\324$\326V\0206!\370\026zI9\247i\016\216m\373\201\266r\214\037\007\246\254\261\232D+\276F\006\340\265mDH\006|.r\232\267\212\023C\332\236\300\032\331\240\b\230mgz\356\314e$\371\232Ms\270\017\312C\006\300\207\360\030t0r\374]e\323\270\"[\236\252\207u\266\204x\217\251j\0345\222\"_\212*x\334\216E4\377z\2176\225^dM#\353.Q~\2363\360cF\246;\301\375\200e\n\036\220\031u\335\373\324\342\321\315\230\311\001\351\342\177`{Vt\273$I\225\370\027\323\214\351M\372\307\316\317\r\317qC\257uC\203>\345\271T\374\357\\\302cc!UXE\305\275\250%6z\206^T\317\n\n\336\007\226;,\317v\276\253d\357\365\213:\361\364\323\275R\222m_`\241=\226*1p\272\212\305.E6\236\016\321\274\262\245(]~LA"
+	.ascii	"\242\272\244\212&\215\300\322\033 \300\214\231\316^2!\265\324"
+	.ascii	"\034\304\210m\315\001\347Hv\034\bz\357w\2210C4\212\351?"
+	.text
+	.section	.gnu.lto_mspCommonProcessInCommand.177.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`\201\f59"
+	.string	"Z`(\025@@\246N\007\007\313/\374\211J\2455j\004:\272\302zQ\261\325\220*\303\"O\311\317 \006\021\234J\1772\355E\3079\007\331\373\016\030\333\376\241w9\027\016Pc\237\031\221\275\273\355\275\267L)\005B\001\"\001C\001^\272}M{\033w\323\255R\307\231\227lX*\333^"
+	.ascii	"\035\215@\301\313\331\350\360,\226\273\242,\357\350\345\234\033"
+	.ascii	"8\332\"\200\216\236\335^\335mw\247j\212}\026\3203>\347\345hx"
+	.ascii	"8\ts\230\034\03189\307U\265\2048\340\031\347e\274\334L\327\013"
+	.ascii	"s\030\230\232\003\240\243\302\357\177\037\363\243\327\234\327"
+	.ascii	"\376\340\344\234\253\032\001\320\3210\016\347\325\256\210 _E"
+	.ascii	" ,\261\b\231s\224s\266\232rb\352\350\351M\251\2438\331\356g\234"
+	.ascii	"7\372\2563\t\227\224\222\202-\273\002\325\024\035\236\370\335"
+	.ascii	"v\2433\3219\t2\245\032\270\276\265\"l.\\:\031\350\305a\344}\314"
+	.ascii	"\232\234\3042,G\247s*-fj\257\2042\325\334\222\374\213\315\203"
+	.ascii	"L4\267V\275\252\363\025\311$K\304\246\241\245\304\227Y\305\327"
+	.ascii	"\314\234\340\225\n\250^\025i\342j\037\263%\355\231\220O\317\251"
+	.ascii	"\234\263\322\231\3309\365cga\217\n\335\220\370\360\324 \306\013"
+	.string	"\233\3671{Ol&\r\235\366L\354O\365\312\215\237Z\360\f\311\tZs\206\3041{\006\306\344I*\3149\373\232\031\225\363\325\253\234s\377\361\254\210w\223w{\215\356\006\322\335\222\005N\004u\037\233\241@'F\342*\374sM-\\\274\037\037\273\033\037\346%\323\356\034\217O\031\337\317s\316\031cd\347i\327\203\241M[\316w\332\355\0268\024\343\362\257\215N{\035*\357J\035}\357\272\235\331\335\207\2009\033\375\311!\017\222\244\214\203\363\222\241\344\005\2166\300SA\376\257\033`\307~%M\220\220\277\257o\266\360\025\340n\030Y\357\307v:w\344\235.f}za\330\330\035\007\366\030\331\355\270\331l6\033O\351\356o,\037\343\276\302\225\336Un\306\275\201\243qW\320\337\t\020\260\337\007\330o\003\3547\325\371=\225\364]`\375&\020\374\226Z\277\007\260\337Q\3547\024\373\375\264~;\261\337\002\330\357"
+	.string	"\3537\221\375\006\300~7\255\337C\366\233\251\375\026\262\337K\355\267\022\373\235\324~\007\331\357v\375f\327\357u\375\006:\033ou\375N\317ot\375>\317o\274~\377\371\355,\360\233\2272\"I\034\255\231sY3R\276C\353\2628\033w\245\177\2677\243%4\370\352l\371\233\316\200\307\027U\334+W"
+	.ascii	"-a\341\022V\025\275n\237\335\363^\265V)\313\217\035Ue\022VJ\302"
+	.ascii	"\252\335\313$\350\366B\272&P\351\017\362b\356\233\273\305\355"
+	.ascii	"\362~t\273\244\216\252s\307\275\026\007\017\274\2020\256\230"
+	.ascii	"\367c\213\325\345\253\304\317\361{\344\216\001\363\235\303\032"
+	.ascii	"\373\277\340\270\024\263\354\257\275\311\272\024\363\030\251"
+	.ascii	"\233\352*\3631\233\350\261\370\374?\026{\235\017\227\311\246"
+	.ascii	"\035\257\222\364\2733\276\337\272\207\223zy\311=\300^q\267K\306"
+	.ascii	"\031\265\325\361-\212\232[q\3242i\007\210\2739x\"+q\364\020A"
+	.ascii	")\201\030\312.I'\305\335\035\274\320\007gJ\362\206\312\223\n"
+	.ascii	"\016'/DJ,\243G\216\016.\347|\001\317\t\215\350\022&\376D\352"
+	.ascii	"\350\223\241\343^\212\231@J2\357\302\2601.\347\254\242\016\310"
+	.ascii	"\373<\333\235R\025"
+	.string	"\217\375q\025c4o\222)F\266\005\264\241\273S\272\256\301\376\307\021\3401\035)\002\274\304\310\r\"\337[\332\265A1\262\335{oi\247\034\342)\215b\214}M\016/\354\037\365\211Q\354\016\334O\n`\316a\027\332\371x\037\025\247[q\264W`\245~t\264\035\013?\300\253\253\302\030\267d\001=\343\201U\261(\025\203\306\373\320\212\201cD\007\017\034\270\266\2128\264Th\311\200\261\303\306V\017\"\016\020\305\242V\326\026\027\212\035\305-\0249\2127\204Y\\E\214B\205\211\0307\262\322\254\242\226\207,\256\242\332Y\017r\024oX\341\240\001\343\206U\026W\321\352\001\261\267rhqY\355\330\332\342\262j\343\276\374\314xJ+\245\245\215\t\272\273\251\323\371P\210\205\023\340\261\356N\200\373\352\013\203\235L\032^\001v\274b\210;\366~\304\302/\367\366v'&\307\337.-\367\351\t\017(\3711b\016\370\031"
+	.string	"\363\305"
+	.string	"$*..2\301\026\252>\006O\360\034Yjf:\205\271\344\364\204\375\243)\354yo\243\002d\337\346\226e!\200\013\020\340\223:{+\256\221*\200\006`)\354\003\024E!y*\311T\031\205S\2737\021\224\222\237\"\345\tC9\341'\254\3169\355\021\300\344\241\250\375\022\017\200\005\020q"
+	.string	"b\036"
+	.string	"i\337\304E\026\030\204\366i\256\02357J\224\324Q?\356\261\356\"\323&\f"
+	.string	"\273\230\026\260o\366\0207\341\024\320\020\247\212^\2739\257\035%\374\302\365\263y\3038\244/I\3568\347l\f2I\371#.\322\210\241\343\036\023V!\275o\302\344\233uU \362e.[\200\365\250aD$\221Rh$\020\021\221$I2\034\260\002\221\241\"\326\001\022\200\264A&\2312\314\020\311MR\032\366\rO\r\260\f\201UU\337{\225\375F\360\n\374\206o\003\344;\347t\367s%g\034\276#\353\217)\313\313#\326C\001\004R\262\271H\032\0217\034\365|("
+	.ascii	"\310\371\r\b\336\207\fR\030K\210\340G\351v\177g@\337\371\037"
+	.ascii	"^\023\265\324\240\033J\235\224i\313 "
+	.string	":,MCNt\261\267q\032\031\233`\212\032\031\265,q\220HX\202W{\216\201\370\n\244\037\267=\267\243\322p\344\361\253\221E*D\203x9*\321Jg\224\221+t\230aN\314A>\206\005P\351\306*\270\023P\204BNE\3535\341\212P\026\242\236\f\f\335\036a?\034\347\312\344D\025\ri\007+\017D\201\377\240/\262\2230\310p\277\310\361$\307`\271\361\344,\361i\301\217\004[\177~\262,\035)\315\333p\301u\262\200 \240\244\210\002CT\222\255z\364\3641\376\220\267<\240\206\023\344*&N.\212\343\022Oy\013\267\315\307\361\302\2157r\274\"2\334\344h\253.+a\030\361w5\227\003\324\261\310W\023\245\231W\245P,\337\0259\003.\005w\005\375\246\345\013`D\234\230\322+\266\362\035~V1TD\213\207#\237\037u\f\315\264\324\236a+\363\264\303\037\0048\310\270=\220\3008\026"
+	.ascii	"j\243\322\365g\341~\317\272K\364\216\002\245\327\203\332A&\b"
+	.ascii	"\335\3567\247\223\350\003mY,L5X\021\f\352*.{\177\364rY\202\341"
+	.ascii	"\022-C\203\3179r\304\357\351\233\336\001\264\024\031\034\315"
+	.ascii	"\204\302\262\335`,\035\374sw\330i\247\246\333\270'\215f\337?"
+	.ascii	"@\032R1a\326:\025"
+	.text
+	.section	.gnu.lto_mspFcProcessCommand.178.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`\025\004U\034"
+	.string	"\246\263\270J\220\330Q:\220\350\207\301\311\311\274\375\306=M\352c\027\272I\215\003\bZN\301\221\276\031\020\362\234\233(\027\333\007u\201L\036\254\212?\033\274\245\00778\001\214\377D\002\333\340\366^\354\027\220\301G\276\276[#\261\204\020\271\223\f\245"
+	.string	"\231"
+	.string	"\251"
+	.string	"8UQ\021Z\370)\240\033\371\031p\273DTH\304{\205\017\330\201\360dk/\325\202\321{q|\021\357\275\017x\301\371\222\231\371CN\004\210\2050\024\001\203\022\212_GG\306\334{u\t\2363_\222\027`\276\354\035\027:z\312\314\222l+\304\177\326s`\024\275\326\340\357\250\002\034JL?g\301\245\313\254$\315\240\005\217\254I\346\252\344"
+	.ascii	"\243\t\032\221\fht\305x\220$&[\026\221\0072\275\311\034\222\217"
+	.ascii	"\225&HD2\020\313\n\363\254\333\027\301!ke\024\356\275l\327\240"
+	.ascii	"\322yvf\266\301\314!\230\311[\253\f\240=2\013\177\266\233\230"
+	.ascii	"\337\307\343\361\310\255\203\331\006w\251\277\346H~\333\255\316"
+	.ascii	"\265_\235i7\362\317><\243\257\372\317\023\317&j\271<-\223\247"
+	.ascii	"\345\226Y\266\004p\274z\310\370p\353^\244\243\231k,\235\374\270"
+	.ascii	"\325\177\365\017\177\342If >\22379\326\263\230\306\314D\326\372"
+	.ascii	"U\272w\201\245\310\005\304P\2450\344\"C\021\fH\207+\365v\255"
+	.ascii	"\334'\201)\206\211\335+\334\240\344K\200n\265\342w\275\3779\025"
+	.ascii	"\273\210\335{\033\274\344\234\363\345\315^\200I\"a\021\026_a"
+	.ascii	"\326\332\004\273A\365Ed\307j\306\252\232\230\335\304Ag-\023\327"
+	.ascii	"A7\264\266]\323\314\036>\330\257\270\326A\025\351\2723&\030\275"
+	.ascii	"<\225\3354\345d\007\341l\b\021\366+\331\226\352\211\214\261\250"
+	.ascii	"\177\3471&F$\273\351=\214\262$\244\273\211{fw\t\252-Dv\214\003"
+	.ascii	"X[\243m\233y\004\t\373\265;\201Q\377\270\326\266M'\254\255\243"
+	.ascii	"3\265\356\252\361\230\301\300J\262~\341\364Rv\bj\255B\f\223T"
+	.ascii	"\224-\024)nh^\256\245\346Vf\023\207r\342\274\367\342<\341Ia@"
+	.ascii	"K\217\227\374\037\363%\3322\247\241W>;_\373\250;\235\372\324"
+	.ascii	"\326\361\240a\207\227\232<\027Tu\227\366|:>jO\247G\345\335~T"
+	.ascii	"\364\354|\345\016/\355T\335YH}\252\214S\b=*O\307s"
+	.string	"\202\004O\227\372T\035\204\034\367zv>\235O\257\347\323\321\204\367\344m\035|\303U\243K\211k\033\327\023\215\323\246i\270jH\265\203\233\375\202\231\315\376\025\250(#\260\207\270l\346\n\317\362\365\213\331e\317\302\212T\310{\357E\017X[N\006\373\325\246_\006\352\311x\004`j\252\312Y\300\332\232\326h3k\340`\277\362\231@-\031\215\372gF\001\301d`\002O\250qH\244\214C\204D\202\021\031\205\205)h\003\300\002\221\271\352\006\021 M\355hA\322\272\001_3\376-DH\355\311$\032\3134\352\352\200\355\2336\330n\206\332\276\215\033H`~y\262t\200/\335\235\263F\330\221 \b\366|\026}\332*\325\234l\032\302\315\250\2511\2666N^\006S\301Wq\223\033\252\274T\210\013z\311\304\324\301\265\266\216\352.\210{\0173\256l\002=\364\265\217\254x[a5\373~\3653l\234\201\206<C"
+	.string	"p\220\re)\346\ty\251"
+	.ascii	"\202*\242\032\263/\023e\347\033\242\b~\250"
+	.text
+	.section	.gnu.lto_mspFcProcessReply.179.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`j\001\305\016"
+	.string	"\326\332aF\360\262&\035\020\310\237\211\356L\271\364L\033\252\264A'\276\177\327)f\262\242\311k\365\312\016\023\230\322\365\250\216\244\2045sH\225\241F\261\032\331\312\3034n'-\031\322E\275\217\211\201\2028\f(\212mo\271S\nM"
+	.string	"H"
+	.string	"S"
+	.string	"\322\363\240\317ev\002\237K\243l\036\2371;\362za\251\321\331\335MC\034\365\250\020\345\207nz\274\257{|\353\013fnzx_\207k\f\260\303BC\373V\242\002\r:\037B\276\024\204 '\273k\350}\034ny\333\fl\207\354\343\bqw\327\252\262?\357x\326\257\n}"
+	.string	"&1\035.w\255\330\335\320\363ca\022\306\210\317\333\247\261\265\277e\315\366D\021\2603\366-9/\0218\2733\301\245\021d\207\366M\374\004\352\254\224\017\330U\271\260\331\235!\037\310\036\"\261\225\fXJ;g1\333\262\273$\272r\301:\310\343\0326,\020\2520#\237k\001\0247Rp\307v\351,(d\327\006;b\224`]\005\n\310\263O\257\261\220\355\256I\n\f\027\f\330\220\271\364S>\227QAf\\/<\027\025\330c\317\016*\214\375\"\356\244\031$\230F\234\264\250\304t\"m\023 8 m\"\356\264\225\200\\2\215\270\255B\251\304m\332\334\307U\2255\022/0\025]\201\"\353\341%\203\263sI\336\372I\007yb\216\346X\305BF\017\340=\307\026+\037\032\214jG \301{>\315\003\037"
+	.ascii	"\357b\314\304\333\1778\234\205\315`&\364me`,h\n\271`\022\220"
+	.ascii	"\213\363\020;m\254!X{,\201\307*\261\002\242:\233\2521\252\334"
+	.ascii	"\336J\b\317K1\246a?;\306e\266\036\261\013a?\212X\236\272\"\256"
+	.ascii	"e\230\022\321\\j\017"
+	.text
+	.section	.gnu.lto_mspInit.180.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375 \321}\005"
+	.string	"\362\t%+pm:\240l\341\030yN\210\003dl\356B\322$\366?\260H\023\363-\332D\307\324\275\252\212\214\307\314\273\317\273\274\213_n\231\002\267\252l\2738\333.n0\024\027[\332\306\025\341X\266\320\330\201a\032Sb\353\202T\270\031#\333}\345\377\200H\365~\b\303\261[\356\0279\271\227_\001\275\340\277\b\322\304\242\242O7\345d\3521\340\321\374W\352\363\037\251\230\351B\b$\351\224\272\233\027\243S\345\274*G\007\336\307\251\024$\272\373\322\373*\372U\303\377\031\t"
+	.ascii	"3\003v:#,\\\347\032\356\026\302x\031\002\\\2721[\333uZ"
+	.text
+	.section	.gnu.lto_.symbol_nodes.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`\205<\205\213"
+	.string	"\332\2718&Q\220\314b\303\001H\320\rR\375\250\202\204(\307!|x\2340~\260iba\244!=Y\033\322\233\251\213\350\b*b\001\236%=D\215$\236!\274\321x\250\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\004F\244wDp\274f1rT\370\017\3328@\f\034\313G\246$\003c\002@"
+	.ascii	"\002<\002+\253\315\025Rd\356\020\"sg\264\271Dfs\213\f\231[\023"
+	.ascii	"2\367G6\327Hl\356\221 sm@\346\002\301\346\"y\315M\362c.\315\307"
+	.ascii	"\334 \327\\%\255\271\336c\356\022\036s\231\260\3466Y\315u\262"
+	.ascii	"c\356\255\347>Q\315\215\222\232;E\307\\*9\346\222\200c.\356\306"
+	.ascii	"\334*6\346B\2511\327\312\bs\257\320\230\213e\306\\!\031ss\"\314"
+	.ascii	"\325\305\230\233\305g\256\026\030s\267\274\230+\305\305\\.-\346"
+	.ascii	"va1\327\313\212\271;B\230\013S1\367F\212\2718@\230\033\004\305"
+	.ascii	"\\ '\346\372@\315\375ab\356\3534\325\213i*\t<\265\204\017\246"
+	.ascii	"~\351\231\n\246\304\324\335\362L\345\r\247~\322T\337\232\251"
+	.ascii	"=5S\211\204S\311\004\247\376N\230jd\302T4"
+	.string	"HSM8\232\nL3\227\321\3145\031\315=\025\315E\235\231J\304\314\324\037\340\324#\277\251\2652S\215\220\231j#\232\n445\311\230\251Ab\246\316|So\275\251R\302Lm\362S\235\360\246>\331M\235\002f*\224/S\253\2240\025\013\tSi^\246\016Q\036\3552U\211r\231*d\267L\225\355\210\271)\345A\302\023\343\007\017\346\352\320\231\317\226*\252e*l\263L\215\351\364\306\366\360\324rSq\354P\205\246\006\301\2429\256,\253\202\225\251@\266\312T\026n*\017*\272\243\302\024m$\2252u\2652Fe\036\215\2426\220\020\261 \205\265R(S[\373dm\334\326\204\223\035\241\311\312`\262\",\331\031\2761\224\254O\320\302H\262.\220l\213\n\366\005\320~p\301\262\260-\215#\333cdK\374,OM\207E4\211\210\256\241\251\232\231\n\207hP\210\236 \333\025\261\255\021dC"
+	.ascii	"\262*`\212\364\322\243\037\232\306\307\246p-\b--\352\241gx\250"
+	.ascii	"\031\226\226Y\351\320\216E\021B\307d\260'Z\305\2504L\0059\034"
+	.ascii	"\016\201\232\232\372Z\035\312%\207n\301\241Zn\250\220\r\275R"
+	.ascii	"C\255\214\2408\032Je\206v\221\241YD\320(1\224\211\217.\201\241"
+	.ascii	".\201\352^(\022u\241E*\304\030\t\330\321\\\205\026S\177\260\230"
+	.ascii	"\352\262\341\351\351\341)\022\343\214q\n\013\245\300\303\303"
+	.ascii	"\303\243+\246\372\330\030#\004%\002l\353\037\377\0327\215?\347"
+	.ascii	"B=\343\227q\f\366bW\267"
+	.string	"\374\206\365\252\327m\255\361\211E\335\203\361\233\324\360\223>\330H\376\362\310\250\213\032\370#\352!\367\365\230\327r\347@o\363\377\251\321f\034{X{\277\330\325/[\376,\226*\226\251\036\372'\261\260uu\314P\364\004\221\216\374\215\212\036\330?\177\"\036j\325$\035\034\022\315\224\344\372\276\267\003\262\265&\260\003\206\215\237\256\321f\262\030\354\345j\345\226\305\277\362\334\246Z\230\373\2436\3423%\251E_T\222\n\374\037Q\357\243n\214\017+\002\275w\254\373\234\353\024\210\325\006,\305[\217\315\304\327Z)\244\312\374\210F%\2514\327\233\023Z\310\210hJRgiJRe\3350~\357\027\273^\225\006\356\347\323\026k\245\322\324t\215Rv\270d$<N\201QE7\202}%)\342E\260\006\257\001RIb\300!Z\007X\363\004\030\217J\222\202\336y\023Jr\307\205Jr\247O(\311\035\006\361 >\274\332"
+	.string	"Q\221\346\203\177\340`Izx\225=\204\213\207\016.,\311\016\235+I\016jJ\222\203\203)I\016\275\341\003\360\f\255\303\337kJ\022\003\277\256$/tR\t"
+	.string	",JpqX\222\253rU\377\246z\350\237\304B\0162R\033}Q\377\234H\367\336C>\356\361;o\327@\3766\376\037\256\321X\3461\330gY\251.V\257^\265\347\"\205\227\250\305U\305[>\305e\345$A\302;\360\016zD\217`\016Z\304\227\260RD{o\300\030\270\3063<&j<\004oYi\301\177\227\225\025x\005\374e%\005\277\363^V\356\200p\022V\202`\227\200?\b\255\364\260[\331\301y+;4\007\177\001\370Wn\370\r\036f\345\206\336\300\001t"
+	.string	",fe\206\336\312\f::>f\245N\347\3448\206\367\255\304\320\027zh\345\005\266\360\272\225\026\334\002\277\r\203Y\251\336\003\0209\363%\346Vj\013\t\251\234 \002\225\312\023D \024\245\0011\027\345\222\271%\370\334\034J\346\252\202\346v\222\271+$sy"
+	.ascii	"\315\355a\233\333:2\327edn\354g\006=\233\241d\035\363\030\243"
+	.ascii	"`"
+	.string	"\376B\271\213M\336\342g\365\352W\255r\227)\026\272\220\203\216\204:\372\036\361f\364\246\"v\024\220\375G4\344\276F\375\251\327\250\347\365\357\374O\357\2656}\213\306(\237\261\233d\3741G\301\034\365\375\342\367v\361o\353U\274\251\241\3205jI\342\372\b\f\272\353}\304[\244\"\304B\334\250\310O\017\344_\017\261\317\225\002\n\236\352\344\316\343\037\361\246Pv\374\324\234\366\262\217y\214\323\f]\306\351Q\336.\326k\016\221\020\274\250^S\223_N\202\275\003\366\021\315\201s\300\260x\223\"x\003\327\024\2601\032\364\3511\350\020\257\262\007\314\00459\220x\223\026\260R\020\303h*h\n~\025or\207A\264\0025>\360!\001\233\374C{0}\007\033\240^\030\r\022o\013<1\375(*\336d\206Wm\241\231\241\261x\223:\256\022\207QLe\3369\030\\)p\227\023TH\274\255Q\230\032:$\336"
+	.string	" \303\002\242\246x\273Iu\023\321\211,\300\243\223}\241\270\001\306\325"
+	.ascii	"(2\020\364G\353\345\023s)\325*i\300\344\210\356\312#h\006\247"
+	.ascii	"\246\330DO\261I\\\223\306\326\262\300\034][B-!\375 \272\324\347"
+	.ascii	"\211A\353\264\235\226\210A\322\200\236\030$5\320z\346/\343X\303"
+	.ascii	"\374_\354\322\320r\r\254\326\260\362W\261\206T\017=\351U\312"
+	.ascii	"8\005\243\356\205MT\222:A\376#6*\002\376\210\206\332\327\343"
+	.ascii	"\355\200l?5~\247\365\214\337[\306\3571\330\253u\\\335b\255T\254"
+	.ascii	"\223\372\367a\0179I\030\324\2757\022\037\275\347\332\210\277"
+	.ascii	"\210?\007l \377\217h\310\337\327c\036\357\032\310\3666\376\237"
+	.ascii	"\032\323z&\213\371\303^.~\226\177\316J\225\223\352\241'}\022"
+	.ascii	"\013[\310\301F\362\243#6\352\242\"\006\366\217\350\311\224$\016"
+	.ascii	"\221\017\375\220\367\274\327<\337\345\336\201vZ\2228\266\326"
+	.ascii	"\375p\231\2579-U\22283\226u\314\037\007\3068/W\267\036g\3058"
+	.ascii	")\377!'\2650\350z\200\025\241-H\277\243\276\001\336\374n\210"
+	.ascii	"|\350\207\330\327=\347\375\216\033(\321\026\261H\033~G\305+\321"
+	.ascii	"\207\263\345PS\274\"\365\307U\362\210\202\236\350,\342j\235{"
+	.ascii	"\335\214U\336lt\226(\344Q\027{\032\314Q0>\275\022yu\314\265\212"
+	.ascii	"D\334\206.\246*\322\305Dg&\352R\255\013\020\25192\237\213\326"
+	.ascii	"\"N\222h\225&(\211\301c\203\036U\030:\030\253\024qR\203\240m"
+	.ascii	"\225AL\304Ha@\315\217-\212\2128\031\202\002\336\355\260\232^"
+	.ascii	"\0069\343D@\264\352\203\253L\263Z\235\320S\353O\304I"
+	.string	"\016=\221J\304I\001Z\002\345T\3706\260\221\210c"
+	.string	"'#\225\241\001\333\016T\314\375\205\266\360\026\330\306m\370H\304e8\341K\324\024qr\002m`\307\245\245\247\210\223\026\202\364&I\02201J\244bS\244\207Ll\022\244\016|\001\312\".R\2216=\245HEj\220\312HE\356\244To\016\202\021\270\321\005\206\004\037\332\203{\350\300\201Uy\004`\337\320\001x\206G@\250\225ST\214\"s\3361\364_h$j\212Q\244\001*O1\312\377\277\016\353O\254P\304\033\b\257\243R\321!\244x\305\220\3050I\230#l\021L\021o.\342\355\305Q\303\2107\237\"\317\371\261\211H\204\241V\035\302\021\264\242U\221\314@\t\242^^3\037w\323\316\225C\220O\r\215\3612\200z"
+	.string	"\023[\312\350\351\307\377g\335"
+	.ascii	"\016`\031E\275\214X\353\003BJ\230q\215SxQ|V\237\263j\225\243"
+	.ascii	"\3364l\324'\265I\330B\234\240\317@\342#\3079j\243\"\377\375\217"
+	.ascii	"\207z\206\317\344{\234\036\357y1x\216\332\261\003\261\315ql\\"
+	.ascii	"\2439\315i\314z\004\3275\005\261\242(\031+\205\243\027Y\364\324"
+	.ascii	")^\3542}\213Y\3755V\216\243b\234\024\017;F\222\307H2\005\331"
+	.ascii	"\204\344\2721\256pQ\033F\256z\002\207No\0249\216\337\377\210"
+	.ascii	"X\265\025\224Ds\270j\032 gN\356c\277\351\261\016O\361Z\025om"
+	.ascii	"\373\035?\375\265\246\371\313:\346&\330\277\332\345\337bV\243"
+	.ascii	"|\305\3577*\276Iy\017\371\223:I\330\246\0172R\243\334\310\277"
+	.ascii	"\210\201\016<\375\232h\250}|\352\371\243\232\307\357;\3666\001"
+	.ascii	"\361\333\230\345<j\265\032\355i(Z\205\241\250s\243\264\243"
+	.string	"\260D43\222$\225\016\363\031 8\222\323(tF\372\023\300\314\246\364HHDc\023\211D\"\021\221\017>\307\b\326\005\254\264\325\340\332\262(\327\335\236\363B$\313\001\002n}\200\025!\013\005\351\270\301\004y=\222njx#l\314J\017PH(\303\216\037\320a\364\036u\260\004\372{\244m\264\212\332@\352+\330@\325\210\246\002\016\027 \357\305\0038\036\237\224\263h\274\037\356\273x2]\243\001 \217\306m\325\364;ABv\364\333\b\304\266/@b\b9\033\323a\333\263\231\337\324\341R\034\211\215\364\324\3464zD\234\004\346\201jG{!\3341\023\364\374\206\2053\271:\023\311~\322\250\374\353\334~\260\251pm4\030\202\256\245\006m0\f\222\341\231f\224\373}\377\333\303\021T\021\235\236\231}<\310\264\277uj\005\274\351\361\364C\306e\240\247m\021\226\307\036\034\260e\003\177}\371\301\001\347%\342"
+	.string	"\\\262\213\356\001\204H\340M\256+F'_\215\311U\341\303\374\221\222\nD"
+	.string	"\bqU\0360\216]0bM\ty\326\016~YI\037\262e5F7\245\267nP\230\220\253\216\203M\002\031\027\231\013\376\321\005\275\341\002\277o\027Za\342<TV\025w\021\340\203\f\254h\271\370\225\017\006o\253\t`\305\255\242|\351;\204\352)\005\250\317\305k\277\345D\013\210\335\227\002\252\b.\325\327\024\275\024\301\345@\334\206\272\351\275\370\250Z\225g\212\325h\274\007l\2330\373b\021W\020\342\t\237\241\204\002\2527\266\363b\305\362N\033>\270\222*\324G\225t\305\222C\350Z\234?W\313\277-\231\013\265Vs\271\320S@@\205\210\177\231\"\246\247\346'Z?\261a)K\201\200\307\214\233^\202Z\310\n\313\325\372TM"
+	.string	"kxQ\221\200\310\357;\256\254\316r\034\\\371\223\367\252L\331\311\351\372\201\247\013\330f\213\005,P4\030\232\030O)\220\301\f\332\244 \326;\003\210\367\0342[Y\304g\271\327Sj\"\270F\237\262\311\206\232y\364\031\030I\262\26398\001^h\374\311\251\325\231\300\262^\254\246*K\277\022(\344\017?\354\233\354"
+	.string	"f\303\304-\313\037{Ny\245(\021X"
+	.string	"\022](;\255\237C\376\337I\210T7\344,[\020\226Xl\220q=\031tYA\031`#\013\310\337rM\211\320\020\201\353e;\262@\r\211\n\340\372Vm\214\034\270`\262R\304\265+C\276\354X\035\3646I\013\306F\020\233k\323\320\217*\216\337>\016\320q3\213\f\237%\317\313\034\261n\344\377\310\243i\273n'\b\020\026\022\305V3\364\233\234\202\334KZ\321\202\266\025\200\312\3640\021\200n"
+	.string	"\271\344\340\f\2342\333\210\020\235\267\240z\371%\333\300\244\273\217\244\017\031\230\306\343]\240ZBa^_\306E\033E\275S\214\335\266j\231?\237|]!\224iI\030\004\n\3025=\221[\260Uh\226[\345\n@\345\033\311\r\212U\261z\337[p\001\274Kp\346\345\022\313\001f\276\001'1\270\365\230\030a\271\377}0(\316\r\214\230\221g\037~\241\370\214(Ib\021\024\251\013\366{<0jT\022~\243\203N\377\002\334\"\023_\311r\036\337}\315\267\r'\361\002\263\361\211\307\306\341\214!n\240\324z\303\247\355\0060\333\250F\371\216\026\243\252}\300U\331\251\032'"
+	.string	"e\213\310\244\251\232']\373SV\006\310\303\022\244d\244s\2126\005\264\260\320\273R\027\004\237\300\340\036>JT\345\212\301\037\252\337\t\236\225\240\245)\277\004\270(\023\326\261\320\001\201;kRX\3075\200\f\236\255\"z\024\b\027:\263\223\316!E\244Je\004\374\201\311\234\327\341\275"
+	.string	"\210_\212\207}?\374\203m\342/\315\276\256\361\237\f.\342\232\223E\345\337\332\276M\363\306\356/\310\353z\247\376\347\370r\032\355\267\342\356n\257\275\267\357T\275\021\301\234\b\365.\374\257\212\317\276\230\345,\2045q\315\023q\031\271]\343\273\f\313\366\330A\313\220\001\255\260\226\020\bz4e*\301\252\025\303\344\275\003\013\300W\353\324\3003\236n\242\347o.\276\177\275\216 \360\316\364\177\001wN@\026cv35<\3001\363X\013\226\202D\346\343\210'S\217\315X\375\017Q\355I\341\n\002\240\005\r\357G*\344gO\276\326q4\356B\016U\333;Q\274\035~>\353\376\357\363\243\034\2654@\233\033\300G10\021\214\361\201?\315Y~\366\250t)v\203N\374\227\352"
+	.string	"NG\324\353-\274,%\336\027W\377\347\177Cg\376\323\271\272\344/\267h\270A\200\371\300\023\374\300\210\016\206'>\254sn\223\263\b\3443\305\b\206\271}\300\252\313M\313F\311\203h\025\375\303\276s2>\177\226W\247\370)\r)[{\316\206\276\361\017\306*\353nm\243\277\316\013ZC)]U\212\337\326\323\234\364\033\002\356h\335\265\237\251-\004=\224\364\374\022\237\206q\250I\336w\263\017\202\212\362\337\234,\310\250\314"
+	.string	"\330\323\002\023\363\240\334\334_\027\351\364f\374\006\037&\334\324\300#\336Uv3\024\320\275\367\003\211W-\301B\333r\f\"\364B\227\343\013-l\313\327\231\336\377\322L\275}\2774\274$\353\206q"
+	.ascii	"Nuk)\032\004\b\312M\236\023<\373\f\224\246<\035\240\002\334\325"
+	.ascii	"\362Q\202\3438,q\237\360Un\004A\250\332\306\304\332u\373\217"
+	.ascii	"\347\276 \324\307n\207\"\361|\023\220\322\211B7\275=\374\226"
+	.ascii	"\374\350\367\363\275_A\376\211VH\353\266\264\t\3457\337\307\304"
+	.ascii	"\271\272\377\374/\310d\037\324$\343\200\306%\375o\222\301\270"
+	.ascii	"T\t0%\247\337x^\n\253\266:`\2200\2014E\344\002"
+	.string	"\006\374\374\235\261\340f"
+	.ascii	"8\276\330hV\017\222%\355?y\013\367\377\345\231\2606\345\307\310"
+	.ascii	"\004\376\215H\355\030x\034S\313\330\237B\354~O\354\004\002\\"
+	.ascii	"N*\320\267t\031.O\n=\201\t:\2549\357L\375\210&\n\036\371\373"
+	.ascii	"\340\324N\236\276\250\017\240\037,\370\002'\006\264h\316?\316"
+	.ascii	"y\227\302\335\214\340\350o\341|\3601\022\\\005\376:d?\024C\021"
+	.string	"}0\326i\265\3770\332\030\237\241L\236c4i\233\2314\005%\t\362\021\244h\004}\205\023\335S\310}<\233\227\376I\235\322\307 lL\336\303\326.jK\035\321\022\227j\234\016D\247JD1\312\247\004\337\347\037\310]\352(KltL)\277\037\235S\263\240\356\205\364\212Tm\335\302\242@\265k\022\234T\001\346\304Q\375`\222\2512\235MQ\323rcAKU\323rcEKQ\333rcEKQ\333rcEKQ\333rcEKQ\333rcEKQ\333rcEKQ\333rcEKQ\333rcEKQ\333rcEKQ\333rcEKQ4\317\023\3506:\031#\023)7:\031#\023)7:\031#\023)7:\031#\023)7:\031#\023)7\256S\320\233\211K\001.\351\346\277-\342\277\037\331\240\307>\346\006-\340\035O.lW\324RU]B\234$\373L\005\256S<\255\271\002"
+	.ascii	"\252h\013\205\347\221[\221y\341X\225\256\n/\244l\026hoc\352\177"
+	.ascii	"\304?X\235gr\253\320\271mR<\321\3018\256\021\267\341\236\334"
+	.ascii	"\321\376\203\024&\303sbM|\203\325Y6\247\340\216\251\342c(IM\036"
+	.ascii	"Y\374\013\227P~\207\245\220\315\364\036\255\220>\2015p\335\210"
+	.ascii	"\327\264\254\367\231\226\n6\021\347\210>\314IW"
+	.text
+	.section	.gnu.lto_.refs.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375`n\bU#"
+	.string	"\352F\230\016G\200ZN\032\003\345ja\314.H\314\376\253_\212\242\017\221\311z\037\343\326\307\347\025\f\243(\252\350\332\211\321\027n)\267\224[|\227s\024\333\345\034\216\203\005\245\312\256\267uD\376\264B\362\364|\210\305\233%\204\220-S\312"
+	.string	"\343"
+	.string	"\334"
+	.string	"\032\336\024\013\353\322BV\311\360\246\025\2067\243HE)9B\344\302\233L\2777\177\030\215t\334H\337\224QG'\327\306\302W\266\2641K.Z\302*|\365\242P\257T\252\246|_\233@!)\342\004$\311H$\352\371:\254{\3233\301\215M\302\357\222L,\302/\030\204_\256\007\277L\034\374:5\370-\302Q\203\347wX\367\206\347\237cP\037n\347\177\333\251_f\301\257E\301\037\246\340\004+\366\326\321\311\261I\343\246&\306K\357\227\313\230\316\357\225.\004\277WVT9\277R\007~\227\f\374*\025\370\035\"\360kc\300\357\326\373\325\004\374\313"
+	.string	"?\022\300\177\344=\320\356\177\322:\020\375\017\346+8\237\200Y\253\204\007"
+	.string	"#\327\221\247\330yI\214\020qbRB2\362\340\031}\374\335\231\253\374n\355\367\2734\240\337\241\001\177gV\266%\213\322K\013\213J\325T\023$@\222\214D\035CB\276\337\005\271Y\363\246F&\026v\245+\211ueE%\025\005\225\344IH\323\022R\321\367\351\216\034\346\247CB\302Oe\324\321\311\265\201C\323\266\226>\232\206\342\3213\263\345\330\357Q0\345\211G\255\b\037\335\312:\232x\024\n\223\022\217\026\021\322\264\364\343\250G\215\237G\203\340\314\305\251yk\373\371\223-X?\313\240A\370\263\214\214\304\237cX\224_\\I\237?\217T\252\240<\211\202\"\342\304\244\204d\344a\244#\370\347\214\021\177\016E\324M:7\3007\327\240\t\361f\033\2107\327>\274\231\346\341M\264\016o\232qx\263l\303\233d\001\347\324o?\237"
+	.string	"\355g\023\340~*A\3624$\210\322Q\221X\224c\310\367g\f84mkd\304\200Y*\273\264\256\240<\r\021\022d\351\310G\221\307\016\"\033\2767\205\204\2739\2043\347\213K\343vF\315\334\353\0301`\276,\273hQzqi\245{\315B\261\327*WS\204_\255\252N\3545\212p\257O~{\205\362}Mr\344\311\304^\233\032\354\265(\307\020\215!\317^\203x\366m\373\355[\206\314\231\331\222\313\205}\307\300\276\272\266\322}\217VTSQPG\2060%\021\365\364\374\306\350\221\213c\243\306\302>\033\2310f^\312*\354+\267|\177\226\317\367\302\t\373\017p\017\002w\001{\315b\26360W\235w\362wk\355\350\311\335<\271+\320y\347Z\277'Wa\006\277\306\261\352[\\\242\bc\325\033\214|\036\235\221{\201\263`\251/"
+	.string	"l\256\334w\345.\352o%{\373\310\336\016\324\333\205\275\375\247\267\373\364v`o\367\320\333\177:{\005\235}\002\202\035\002\202]'g\317\311\331\r\344\354\274\003\2678\360\316\251\t\210R\322\221\261\007qg\364qO\313v\366\224l\247\236\372(\006\367\224x\203\304\236\316\220\341\263\247Aq\350\346|v4N\315[\032\332\231\231\227.dcY\300\202\217\036\257\244PI9\211Z\242$\270\243M#v\024ID\035-\022\213$\354\250\r\016;J\203\303\243B\031vtXG'\227a?\343\330\254\301\260\237p\030\376l3\363\327\331_\373\t\346\257?\267\210}\225\330O\254)Q\366\372\201;\250!\240\"\021\022\211&(I\222$\035\021G\310Ic\021\320\0378\341p\361\340\315J\264/"
+	.string	"VQK)\025\261t\2031H\372+\254\214\332mhX,6\224KT\3238N]@\315\"P\005\221\242\357\216t\b\351\206"
+	.string	"\017\252\210\256S8\024\337\2470d0\307\224a+\244\377\322\270$Ol\301\220=\017\354\241\025B\230\252\016'T\256<\200\356\223O\325@H\251U\225\022GYe3\301\305\346\266\353"
+	.string	"\303\204\270\021Y\0302\230e`d\001c\001\205\023r\035d<\032&?S$ \006l\351~XL\004 \303\017\037\346 \235%\230\365?"
+	.ascii	"\203\207\250=\315\336)\356X\230\tDT\005"
+	.text
+	.section	.gnu.lto_.decls.99396a154a7c27d6,"e",@progbits
+	.string	"(\265/\375\240\3108\001"
+	.string	"\345\331\004nx\307\262\032T\0200D)5\006\275\002h\035/ \032\336_\202\200\377\017\026B\363/\001\263\2257\202\360,\315\344\245\3113\031\215\341#\231\320\005\036\r\242\321\215hf&>\2221bMS\331;;\346#\361\244\351JD\342\231\t\013\\\355\320\271\326\214\244\333\312\335D\356\275S&\027/\033\343\033?\032!\f%Y\200*\213jWm\365\346\332\250z\376\321/\2504d-\325U\253q\277h\233\245\345\262\304\301\026\221\272j\225\205\373E5S\353\242U\222T\302\334XQTO\321UB\030J\002\"\315\205\375\276~[?\260\337\222\237\325\317\353w\365s\362\353\372a\375\246?\255\237\221\037\327\257\310\357\311O\354\307\344G\344\247\344\027\366\313\372I\177C~M~H~I~G\326\351/\312\366\275]k\247\004\223"
+	.ascii	"Q\221\036\240\203\024gLE\271\261\3725S\373\377\317\307\257\307"
+	.ascii	"\357\307\017\310:\375U\375v\274uk\337\256\253~9~:\210B\306y\246"
+	.ascii	"\372Q\365\273\361\243j\225$m0/ \324y\226v\370\340W\365\343\261"
+	.ascii	"\212\021\177\214s\320\\\220(\353\364\253\372A\375\244\3268\036"
+	.ascii	"\363\254\344\201\221\263\272j\025\003\f~_\252\276\256\300\372"
+	.ascii	"4b\366i\266\350\370Y\247\037\216\337\f/_\274X}\032+\233\235\327"
+	.ascii	"\032W\303oJZ\024\0025\221Ua\365i\332\366i\316\366O\352\327r\277"
+	.ascii	"\247V\306*%\254\262\0259\302\352_\024\207\377l\b`L\r\n\253\337"
+	.ascii	"\025\351\236\346\311ni\232\354\337\214\"\216\035@t\254>\315\221"
+	.ascii	"\375E\213i\245\321\022\202^Pc\374\234~M\353\364'C\350'C\217\371"
+	.ascii	"\025\2050\224\244B\320\021U\306\217\351n\026\004\021\315@78\030"
+	.ascii	"\222'\327\244\233\360\230bc\353#\365\366W\265\240\fk\034\017"
+	.ascii	"\n\020y\262\276\021%\241\376\212t\365\007dA\020\021\nkb+\256"
+	.ascii	"\026\026e\2015\244a\215\013\003a\246E\235g\351\257\350\327\342"
+	.ascii	"jD!\343,\024\344\352W\364\023\312@\004\222\316In\017\037\\\321"
+	.ascii	"\352O\351\007\343g\364K\372\275\370!\375\226~G\353\364W\364s"
+	.ascii	"!\364k\302\244\2527\243\217<\262\217\024\262\217\334\261\217"
+	.ascii	"\264\261\217l\332G\"\355#Y\354\317\224\371\375\210\375t\221C"
+	.ascii	"b\365g\270\360\351\276u\372\233u\036\031\275\207\303.\372\233"
+	.ascii	"u\031\2757c\247\305\252%\333\002\206\211\253?\363c\377zO/\310"
+	.ascii	"\267\005\305\247\247\363\210\\B\214p\260\37230\366g\214\366g"
+	.ascii	"V\354\037\371\366\257\303\\\213\3715U{Y\245\"p\322\242\215\005"
+	.ascii	"\2535\030\016\327aV\3600Zb\265\002V\244\373\343\230\375#\336"
+	.ascii	"f\245k\215\253aE\272\372\356i\344\356\206\233\035\027\037\324"
+	.ascii	",QVk.?[\236\324\251\355\037\311\366\025]G\0074\022\303\t\227"
+	.ascii	"\253+\327tW\264\310\304\260Z\323\265a\242tT\271u9\305(c\365\217"
+	.ascii	"U\233\203\025\351\352\270\265\210\336\021\306\376:\325T4\334"
+	.ascii	"+Df\t\334\3335\334\321\232u77\206\325\272M\273\355(\322\317\n"
+	.ascii	"\267y\255\215\217\006\033\320\013\035\025\036lmS\216!dY\254\376"
+	.ascii	"q\305&\303\320\202\t%a\365\177\035e\235j)\372I\230\024-\246\325"
+	.ascii	"\234\234\355(\"\234[\220\201\242\365\257\325t\332\213\027T\""
+	.ascii	"Vk4\240\033S\214)\254\2761\312\3765\224u\252\317\3564\334\260"
+	.ascii	"Zb\365\303h\263\377@v\007]\227<V\353\262\244\031l\006\253\311"
+	.ascii	"\336;%\271%\254\276\361k\217\351'\354\r +J\254\276Q\311\276Q"
+	.ascii	"\310\276\321G\030\273eKF\023V\337\030\305D7Y\247\032L\333\270"
+	.ascii	"\226\241\235\216\001L\327\320QD!\351\254\364f\361\002\246\245"
+	.ascii	"\264\327\032\347d\234\205\356\312\254M\242\360\341\271\272\210"
+	.ascii	"\226r\211.\321J\364\327:\325^\327^\372\206\366A\3749\316\263"
+	.ascii	"\216\275\250\227\376\241\211,\271]~\364\3222`\200A\320(\007\324"
+	.ascii	"\317\326\\\272k\235j\251\336\272\322Zk\234\223t^\">\271\241\227"
+	.ascii	"V\325\222j#\032\211\005AD'\244m\241n4\037i=\\}\343\322\376\265"
+	.ascii	"\326u\326\260E\231U]\022\215\005\307p\212Kc\365\215C;\311\327"
+	.ascii	"\027CV\264\261\372\3052\373\353\364v\372\310\357\364\017\267"
+	.ascii	"\246-V\277X\335/z\331/\332\021\321@\264\2205.\f\004\334\020m"
+	.ascii	"\265N5\021\035\325D\364\024[\027*Q\210U\326\226\253_\254\262"
+	.ascii	"5\022!\2607V\007\321U\363px\007\245V\204\325/J\331/\232\355\027"
+	.ascii	"\3054\017\335c\235j\037z\307W&\232\3061H\347YL\373\320TZ\207"
+	.ascii	"\005AD!\242\362\250\363,\355\360\201\366\241\247V1\342\217tF"
+	.ascii	"\n\n\031\242\227V\235g)\006\f0xq\234u\371p\365\2137\366\257u"
+	.ascii	"\350\0343\210\306\366\244?)NV\2524\016mC\213\213\371\216\325"
+	.ascii	"/\322\330/.\355\027[\354\027\347}\"\230\375\244\241\300\246\270"
+	.ascii	"\256X}\242\226'\242\334^\211p{\225\2565.\206\265}b\331>\021L"
+	.ascii	"\303\200\"4\333\033jb\365\211E\366J\354\261O\204\332GE\030P`"
+	.ascii	"D\254>\221h\277\203\026I\013\265J\222\366tG\020\252v\241\215"
+	.ascii	"\326\251.\322+t\221\036\322-\326\270\260\031\b\306\001\302x\271"
+	.ascii	"\333\303\200\301pZ\325kr5\013MT,\252b\361c\312\242k\177\350C"
+	.ascii	"\007\261KL|\f\2434\320\260h\257I+\322-\323\362\255sb\362Z\354"
+	.ascii	"\225\301\333d\332\274VJ6E\216\325\027Z!#\\\333\027\222\355\013"
+	.ascii	"\245\373aV\373B\251\375\265\265\306\2750i\267]t\323[\216 \254"
+	.ascii	"\276\220h?\230\267W\251\025\351\266[\212qA\242\220\261\372\301"
+	.ascii	"-\255\026\270\272\"+\272\212\260\372\301\351\376\337\322\255"
+	.ascii	"\323\366J+\327^i\347Z+k\\\330<+i\220D\311\212Hu\255\321\026D"
+	.ascii	"Ek+o]\230eY2\302\352\007\303\366\203E\366\2039\366\032e\3327"
+	.ascii	"[k\334\337\332\212tW\263\025\351>h\264\221\322\265\306e\257V"
+	.ascii	"\244\033%\310Vg\004\305\352\303yg\355X\013\205\b\234\347\251"
+	.ascii	"2\321\2636I;\305\332;k\237\314\033D\361\326\256\324\332\264\026"
+	.ascii	"m\235\266g\255\330\333\"\255\021\f\0050\213J\267n\311\332\262"
+	.ascii	"uz\265\326\f($\235\277zH\371\351\301\352\303x;\305<\317\363z"
+	.ascii	"5\367\275\232{Xn\0376\333\207\305\220\264W\255\223_[\227\223"
+	.ascii	"\031\253\303\366\202\276\fa\365\341\257\375\016\266\264^\326"
+	.ascii	"*I\262q1W\244\344j\255\222\244\335\204\312\210\232\3252i\227"
+	.ascii	"\264_m\223\026l\235\266^-\327\333\256V\332z\265X\363\212/\r\206"
+	.ascii	"\f\261\"R\305\340\215\222[3\023\352\3039\366*\265\326\2704+\322"
+	.ascii	"=\f\265\0177\355\303H\3730\321>\374\263\017,\263\333\270\265"
+	.ascii	"\306\215\200\227\255\305V\244\313FW\244\333\316+\322=\220nc\220"
+	.ascii	"\2565nK\264\"\335V\272\"] \006\350z\nZk\213\214\260D[\242\026"
+	.ascii	"Y\250;Z\244\026\307\032\027\246\251T\332\241\035\255\016-<Z\037"
+	.ascii	"\355\217\266\307:mw\2649\364\2177\251\023\254\017\204\262\017"
+	.ascii	"\374\332\177\233t\324\276h\251\3305k\316\272b\365\324\372\304"
+	.ascii	"\t\365\210\325\007\016\331Q\355R+c\215\343\241\261\234Z\027D"
+	.ascii	"\340<\003\255E\333\250vF\353b\215\013\323G\312\250\355S\013\325"
+	.ascii	"\336h\245Z\033\353\264\215ji\224\375+\023\245\225\217\370\233"
+	.ascii	"g)\266\350<K\333\250\266\306\312G"
+	.ascii	"\004\222\316I\357\223!>\270\252\363,\305`\343\030\262\302!\324"
+	.ascii	"\337}\373\233\313\376\236\333\337n[F\333\264\276KiJ\316X\335"
+	.ascii	"\302h\231\326i\2066\306\\\\\361x\004)\261\372;m\243`\236\327"
+	.ascii	"\f\356\332\327\267fp\277\303\366w\326\356\300\341m\222{\225v"
+	.ascii	"\203\f\253\277\213l-]k\334\207\375\330\227\256H\267u\361\267"
+	.ascii	",\330\237\227\261T\274DUY\375\035\265o\266\"]\341\212t\037\267"
+	.ascii	"\"\335o\031\3335k\203\336\002\265aR(D\254n\177\332*EjHa\365\367"
+	.ascii	"\321ng\266\317\305\352\022\224\304\352\357\240\375W\314\376\253"
+	.ascii	"e\357\375l\033\353\306\352\351\273\2566 V\347\t\235p\021\032"
+	.ascii	"b\365_\2661lu\235\262d\330*g\345\330\271\353\016X2l\234\035u"
+	.ascii	"\236\245dX+\254\2305.L\203\271\243\316\363\214\001\003\f\212"
+	.ascii	"Ua\230\216\\\375\263W\316\212\371Y8\226\n\033\306g\n\225\033"
+	.ascii	"\254\006\003\347H\253\352\261\372/\223\375U+\352\007\225\265"
+	.ascii	"c\357X/\354\027\226\013\333e\235\262x,\226\263YX-PX\250[\262"
+	.ascii	"P\245\236\304`\251\313B\305\263\303PDe\263a\324\177\227\3545"
+	.ascii	"n\255q-\250\332\177}l\226\216\303\331+\021\370\201\003\213\325"
+	.ascii	"-\216\375J\2555\356\301\254H\367/\323\376\333b\277\363Z\343\236"
+	.ascii	"\272\267k\342\326\032\227u[\221\356+\255\333\260\324\224\rGW"
+	.ascii	"\244{\327k\247\241\001\227f4\341\301\352\263\fn\221\223\032u"
+	.ascii	"\254\276+d\377g\313X\263u\312Ba\307\240\260_\254\330\032\027"
+	.ascii	"v\302\231\033\013\205%c\243D!\351\374\023,2\303[\253\316\363"
+	.ascii	"\234\001\003\f\210<\246\360\234\\}\027h\377w\267\237`X\241\216"
+	.ascii	"K\006\253\377\223\333_\337\300\266\242a,\023-\352\224u\262N\331"
+	.ascii	"0\266\311\265t\236\303\200In\\\r\271\372\277\270\375_\332\376"
+	.ascii	"\217l\377\327\265\377\213\356\240\324\212t\377\243\261\205I+"
+	.ascii	"\322e\271\264\300\216\256\360\261\372\277\026\373\353\224\335"
+	.ascii	"\322\n\032\371\362\305,\353\254\326\313\204\263\005C-8\030D\254"
+	.ascii	"f\215\260X\377\201E\240-eb\260Xl\022\240\230/',V_\005\221h\235"
+	.ascii	"1\261\372\277y\377_\247,\022\366\210t\306 d\321#\312\021V_\217"
+	.ascii	"\331\017\363\262\377\300\325\bY\222)\253\257\343\3665\224-\224"
+	.ascii	"be\234\035\362\263Ll\f6\312J\005u\270\3459\261Z\b\206=\346\203"
+	.ascii	"\n\t\253\257\227\354\257Z?\207\2505\352\312\244F\r\263U\213\006"
+	.ascii	"\327\024\016PkQ\326\t\007\034\007\251#k\354\317\214\227\255q"
+	.ascii	"ak4\312\024\352<\317O/#\002\347y-\313l\236\347\377\254\017\226"
+	.ascii	"\007\013\204\255bw\260?\330 l\016\266\307:eu\2607\316N\261T\327"
+	.ascii	"\254\016\326\306\313\210B\322\031\310\273e\236{\252\316\363\214"
+	.ascii	"\001\203\240\223\031\021\026\032}M\265Y\251\265\306=\300\212"
+	.ascii	"t\257\231\366\265\322\276~\261\257\213\3665\321\276^\261\257"
+	.ascii	"\201\366\333\276\375vo_\260\"\335\225\f\207\2632\314\242\f\355"
+	.ascii	"\261\372-\227\355rY\221\356\260u\333o\317\366\333\257\375\326"
+	.ascii	"\307f\217X\326\210}q"
+	.string	"\366\210-z\207\017.\024b\217\364<\003\255+\001\210\353J\200\237Z\025\220\227\253\337\342\330o\221X\242\227L\221\225*\254>;f\263+\330\241u\312\262\370\331\240\365\355z\211\324\3745\317\322a\013\324\364V\306\352\257\032\334b___\337\252\301=\233ek\267\375\270\265\306={\266\211\363\212tW\275uo\235*`-\363\225\314Z\345? \351,\235gi\221\375Q\306\211\027\253\317:\331_\025\340\266}}\253\002\334\263]\233]\221\356\331 \233\230$F\001[\b\355\211V\030<8\254L\227$\254~\007V\264\250\261U\377U\313\272e\345\262\332\255X\326/+u\365\262vY\357\326,+\230u\272\342\255t_\257\254u_\245_\337\340\356\332\334\272P\211\263\253\"\307\005\312Y^\231\231\336:\366s \333\353\340_\2314Y\305\210\355<G\225\211\316\263\364\037\374\034\376\016\037\254x\353\334*\266\3069E"
+	.string	"k\013u\236\245_\321~\016xk\224u\212\005A\363\fDC"
+	.string	"8\324\226\240\252\363<c\200\001\006\f\\.\037U\325\n\364J\264\326\270\307\025\351~\035\263\277\326\355\257j\373\353t\033\2616\006\034\373\202\265\306\375\332\2645\2545\356S\260\377u\355\353\224\177M[\325V\251\b\346Yh\236\347\013.\221\320T\021V\257R8|]C\272IN\3229l\236\347b\213E\tJ\fV\377V\244{\347\346`\255q\335\025\351\206\260\326\270\327\331\307\262\326\270_a\237\272\326\270\237\300~u\255qW\2605l\235\006`}\"-\016\371\222\360\351\261\372\r\330_\235\374\302\222\371\203g\330_\003\340\256}k"
+	.string	"\334\277\333\270\"\335\177\375\n@Q\332t\204\303k\311\212%\n\345\306\352\177]\362\257Y\253\326\252\244%2\222\232\303\346Yz,f1\351"
+	.string	"\"\325\232\347\271\b\204\242g$\006\253W\256\265\353\253t\335z\207\017\336\376,\231\265\346y^\245\036H\3153\320*-\356\3153Pq]\t\260\256\004\320XTB\246\256>\273/]k\334\275\"\335\034\233\356\277\376\217O\344\027\377#\223\377\335\371w\223\240\216\177\013\t\346\370\367[\020\307\032\343eb(!$G\031\300\177\254\3727V\220\352o;8\240\005\341e\376D\267\035\303\324\377{\002&\302\177D\002\252\261\005\237\200s?\220\016K\260\006\260K\220\006\020\357\007\202\371\201{?0\357\007\226\371\2033~x\r:\301\306?(\343o\205\300\307?\330\3446\340w7\374\356\003~\330\346\207/\374\301\030\377\357\313\377\253\362^"
+	.string	"\316 \200 0.\b\0036\300\017\037\340\017.\375{\t\377\202J\260\206\037\316"
+	.string	"\326\340\017&\375\260\002\376WI\020\351\337\322?\370\342\207;\004\217~\367\004\370\203\0068@\004\330\204\037\016\001[\340G\363V\340\265"
+	.ascii	"\254B\320\250u2}C\364\300%~x\205?X\364\303\033\370a\016\374A"
+	.ascii	"\027?\023?\234\337\b~<m\n\330\0030\b^\023\340\244>\323]:\354"
+	.ascii	"\327izL\307\301&~x\371\007[\3740\210\037&\341\017\022]\360\273"
+	.ascii	"\361\363\001\347\300:\177\220\305\316\017\363\374\301\241\037"
+	.ascii	"&Ap\305\017\313\377\233\344\207O\374A\241\027\205\256U\030\f"
+	.ascii	"\022\341\nH\301\377v\340\177K\254f@2\301\023\374\301\022\374"
+	.ascii	"\260\226 \212?H\202w\204?\310\302\037\214\377`\362\017v\340g"
+	.ascii	"\337\202%\262V$\377\021\305\017\243\340\017\216\bb\340\177\347"
+	.ascii	"\377M\301\377\242\340\375\371\3317\370\007\016\372a\241?(\342"
+	.ascii	"\207Y\004U\370\367\026\022\234\364\007/\260/\004S\370\337\273"
+	.ascii	" \n?\360\354\007\242\375A\013\3740\214\037f\372\203\025\370\267"
+	.ascii	"\332\377\312\301\020\377K\202\377\215\177x\306\377:\203'\374"
+	.ascii	"/\316\3772\341(\331\017O\301T\177\320\204\004`(\341_\205\260"
+	.ascii	"\026\025/\324\303\313\225\344?\b\376\343\326\357j\371\335\271"
+	.ascii	"\337\315\362\273X~\367\312\357n\371]\273\337\345\362\273u\277"
+	.ascii	"k\345\337OA\022~\027\355w\315~7\355w\243\374\356\331\357\252"
+	.ascii	"\375.\224\037(\202?\b\"\370\341\337N\301\021\376\237\210\337"
+	.ascii	"\225\376\233)\350\341\377\t\371\365\322\257c\374\272\351\327"
+	.ascii	"S\277\246\3725\215_\377\370\265\220_\363\370u\321\257\241~-\364"
+	.ascii	"\353\253_\253\3705\220_\347\370\265\215_\367\370\365\212_W\375"
+	.ascii	"\232\310\257\235"
+	.string	"~\255\364\353\031\277N\362\273D\277\233\202_\327\3705\214\337m\361\273B\277;\377\256\212_\037\371]\237\337]\361k\244_\267\370\335\024\277\313\342\327D\277\266\372]\027\377\355\376\367\310\035\372\335\242\337=\301\357\002\375\356\317\377#\376\277"
+	.string	"\374\277\375\377\206\377o\346\377U\340\372\370wR\220\002?0'8\201\377g\201\337\225\372]\252\240\004P\374\273EP\204\337\315\300\357j\340wW\370\367\212`\004\334\023\\\024\376\375\023\204\300\377^\t>\340w?\370]\020~\267\203\337\355\360\273\036\374@\236\240K\201?\030\302\277O\020l\300\037\004\341\327\367\273\002\370\335"
+	.string	"\374o\n\377V\021\374\300\370\2735\277;\363\273\030~\367\302\357\332\374\373D\320\203\377\207\345\377q\371\177^~W\377\356\357\377]\371\335\377.\373\377\364\376\237\335\377\353\362\377\266\374\277\274\377w\367\377\262\374?+\377\013\343\227\344\337\320`\007<\202\035\376\037\324\377\263\361\377r\374A\016\377\257\310\037\344\340\337=\301\r~4~5X\016\374;\371\267g\377/\306\377K\372\177.\376_\213\377W\364k\372\177/\376\337\322\277?\020\334\360o\016\374P\374\277\024\377O\376\203\f\370\177\316?\250\301\377#\301\037\314\340\377\251\370\203\030\374;\003\377\326\300\037\\\300\377S\341\337#\202\032\376\237\005\177P\001\377\017"
+	.string	"\377o"
+	.string	"\377/\303\220\336\362k.\277\366\362k\352\377\226\360\357\013\004\023"
+	.string	"\345\017\"\340\327g\277f\362\353\257_\233\375\301\003\374:\355\327T~=\367\003\241A\003\374Z\355\017\026\340\177A\374\333\204\177\237\360\007\t\360\353\265\340\005\277N\361\353\026~\215\342\327'\370\365\215_\243\340\327I\377\026!\204_\177\360\353\004\374\272\001\277~\300\257;\370\265\003~\355\301\2571\370u\004\376\r\201\013v\b\377v\300\037\034\300\2573\374\032\303\257+\370\203\002\370\267\007\301"
+	.string	"\374\300\023A\013Th\341\257\211\277\016\376z\346\327\303\177s\360o\016\177\020"
+	.string	"\177\253\367o\r\202\025\374-Y[f\202`\206\277}\362o\005"
+	.string	"\347\037\370\363\0071\374\300\240V\372\267_\177\353\365\267K\376\226\311\337v\235\360\357\002\004/8\371\337\037\227\376\355\221\377\255\n\332\264=\376=\200\177_\360\007k~\340\213 \315\037D\376\300\242?8\363\267T\377\332\342o\221Z\033\177\373\364o"
+	.string	"\004\217?\220\003\f\006\343\0072\375A\343\017lr\372a(4\200\t"
+	.string	"B\375\354[\260\b\244\002\342\370\203\304\037\330\343\017\016\177\240\217?(\374]&?\360\346w\r\360\377D\360\377n\376\237\316\377#\361\353\255_?\021\241\353\177\007<\360\377\002\377\023\020\004\376\301\375\007\327\037\316\373\265\225/?\314\345\207\265\374o\024\030\013\\e\025\0329\374m\207\377m\373[\007\264\030\374-\003\376\026\002\177\233\363\2678\377K\345\337\310\037\216\373[\023\177\253|\203\251\374\355\006\376\326\003\177\333\201M\204\341v\360\337\302\037~\373[\025\376\366\002\377j\366\357\276\037v;\334\326\222\360\003\203?\314\006O\371\267\376\367\357\207\327`)?\220\006\216\362\267 \300j?P"
+	.string	"p\332\337\022_\276\037F\373\333\335\0021\\\200\317~ \021\206\262\263"
+	.string	"7\300fp\031\233\007\223\375\337\362\353\266\377=\372\201\r\200\307~\340\003`\261\t\300O~`\tx\372\0031"
+	.string	";\371_/\377\213\367\303a?\220\003\f\366\357/p\223\037f\002L@\006\340\257\326\202\277\275\340\337z?\360\375\201\307\377\nx\002~\240\007\377\213\302;"
+	.ascii	"{\375\260\326\017g\265@`\2545\306*\374?\365\027\251\324\225\375"
+	.ascii	";\313\317\276\301E^\024E\264\037X\005\f\362\303V?0J\265\255\300"
+	.ascii	"D\336\005\234\370\037?"
+	.string	"\374\373\016\036\002Gw\016\270\007\320\353\007~\375\260\220\377O\376\315\343\177Q\370\201`?0\354\207\203\374\360\217\377]\300\177\013\376\227\370_\017\377\213\342\337\321\377\025\374G\345\017$\373_\255\037X\366\303>\376\235\343\337:~\270\307\277\n\377w\001\377&\362\037\376\217\361\377z\360\277\016\370\335\006\3740\217\337\355\362\003\273~\240\364\207w\374\300\253\037\230\344\207u\374\333\307\377'\377\346\361\277(\374\257\006\377K\374\256\001\376[\360\273\324\377}\300\277u\374\357\002\376_\370\217)\374[\354\177\211\177O\377\227\353\277\376\2171~8\307\017S\3750\215\037f\372\341\244\037&\372a\241\037\376\371\341\024\374\360\211\037\226\177\370\371\303<?\254\363\303\313\037N\3760\b~\330\003?\314\201\037^\341\207E\374\260\005~8\304\017\233\360\303$\374\260\b?\f\201\037v\300\0177\340\207?\370\341\016~x\303\017k\360\303\032~\370"
+	.ascii	"?<\200\037\006\300\017g\370\341\013?|\374a\367\207\331\037X\346"
+	.ascii	"\007\202\371\201x?\220\372\003\267\374\300,?\220\356\007\316"
+	.ascii	"\375\300*?\260\355\007J\371\201j?\020\355\007\226\375\300\260"
+	.ascii	"\037\370\365\003\245?0\311\017$\362\003\243?0\310\017\364\361"
+	.ascii	"\003q\374\300\250\037H\343\007:\375\300\246\037\310\364\003\225"
+	.ascii	"~ \322\017,\372\201A?\360\347\007\236\340\007\252\370\201(~\240"
+	.ascii	"\374\003{~`\363\007\216\340\007\352\374@\345\017\344\300\017"
+	.ascii	"\324\300\017\\\341\007\216\370\201\024\370\201\020\370\201!\374"
+	.ascii	"\300\016?p\203\037\250\200\037H\200\0378\200\037h\301\017\254"
+	.ascii	"\340\007b\370\2015?\260\370\003\205?\360\377\006\363\357.\377"
+	.ascii	"\326\362o\272\177\313\375\033\356\337Q\376-\366\357\351\277\301"
+	.ascii	"\376-\375\367\326\277\263\376M\344\337\321\177\373\3707\217\177"
+	.ascii	"\353\3707\325\277o\374\033\352\3373\376\035\343\337J\377>\372"
+	.ascii	"\267\213\177\017\375\033\350\337(\370w\013\377F\361o\350\277"
+	.ascii	"I\360o\236\177\263\360o\346\277s\376\035\377{\371o\345\277\223"
+	.ascii	"\377\006\301\2779\360o\r\374\233\304\277U\370\367\t\377\366\360"
+	.ascii	"o\021\376\r\201\177;\340\337\037\374\233\303\277\031\360\357"
+	.ascii	"\005\374[\001\377F\300\277\r\360\357\013\376m\301\2771\374\033"
+	.ascii	"\371\357\343\277\213\377\026\376\033\370\357"
+	.string	"\367\337\277\177\263\377\376\377\362\375\357\336\377\346\375o\365\177\305\374/\230\377\305\373\337.\377\233\345\177\353\376\027\372\277\304\337\n\340o\013\360\277\037\370_*\377\373\366\267 \370\337\266\377e\373\337)\377\273\366\277Q\376W\355o\367\3772\377\213\366\277G\377\013\345\177\313\376\227\354\177)\360\277_\377\253\344o\205\374/\327\377j\375/\222\377-\362\277C\3767\372\277A\376\367\307\377\366\370\337\034\377+\343\177\233\376\227\351\1773\360\277J\377\233\364\277/\376\267\350\177]\374o\213\377e\361\263o\3771\374\257\320\377.\340_c\374o\320\377\266\360\277)\376\027\305\377\236\370_\237\377\225\377\027\004\377\353\201\377\325\300\377\256\360\277\"\376W\205\377\275\300\377\242\360\277\026\370\337\020\377k\302\377\222\360\277\037\376\327\303\377>\340\1771\370]\352\357\336\375\256\224\337m\362\273_\277\373\343wq\374\356\321\357z\340w/\360\273\037~\367"
+	.ascii	"\277[\200\337\315\360\273\356\377\303\372\177F\376\337\216\377"
+	.ascii	"W\343\377\311\370\177(\370\177'\370\177&\370\177%\370\177%\376"
+	.ascii	"\337\210\377w\301\257\301\374\332\312\257\327\376+\3715\326\257"
+	.ascii	"\263~-\302\257%\360k\003\374\332\202_#\177\355\376m\331\337\212"
+	.ascii	"\375\355\364o\303\376\026\311\337\002\371\333\037\377S\370[\034"
+	.ascii	"\177K\202\277e\341oG\360\267\314\277\275\371\333\020\374-\211"
+	.ascii	"\277\025\361\237\304\337\232\360\267\022\370\333\b\374m\361o"
+	.ascii	"\341\277\005"
+	.string	"\376\355\373\267\356\3770\377\301\374\367\372\277\344_K\370\337\366\337\330\327\327\327\367W\300\345\027\341\312O\345J\273\212\030\204(\246(\214\024V_\004X\225\b\256\375\023\177\020}\334-\331\362\303\352\237\350\343\304\036H|\354\220\302j\036\277\253(\223&V_\304\220]\035\362y\371\240\276\375D\3156\242\303>\036C5\360\206b\346\252\\\020\217\216Z(\021c\2040\224\004\204\021\344\202:\0343\367C\213\305\017\216\006\020\024\325\211\350D\f\"\256\230{\"\":\t\253\210DD\032\304)b\024q\007\021\0071\007Q\007\361\211X\203HE\204\"\316 J\021o\020e\020m\254S\242\023\261\211\350$\254AL\342\341:5M\255\021\227"
+	.string	"9\222\026@_\004\213\375\023c\020\231\302\224p\321RW&\204\325D\030\304%\2569\036l\254\276\nb\366U\350\262_\020\221\212c\216\300\\\261\362\202h$,\262\204\024\204\325W!\312&\026\251@\266\257\002\223}\025\256\366U\370\261\257\302\324\376\211+\210BQ!K\354X\035W\024\362e\315\335`\365U\230\261\257\202\321\376\005\372\366/\200\267\177\001\272\275a\031=\275\002\r\215\207\330\236\236\334\326\234\367\241^\261\212\254\n\016V\017\311\254|}dnj\254~\230\333\375\007\006\245\370\240\202c\365/\240d\377\002D\206ad\344"
+	.ascii	"\262c\365/\360\264\277N\207`\206_\312\004\201\253\016\277\f\345"
+	.ascii	"\226\262\314\254\376\005\220\274P\201m`cRb\013*\\\232\f\273\f"
+	.ascii	"\257\264suwS*\325\267.Q\270)+_\333\236[\225\273\350\333\226\241"
+	.ascii	"\225\241\226a\226a\335\220\313\360nh7\3042\244[\247\303+\303"
+	.ascii	"9vxe(7\2742d\313\213\321\345\254\372\333B\025kb\243\237B\334"
+	.ascii	"~\nR\366S`\262\237B\221\375\024r\354\247@c?\005\244}\024\366"
+	.ascii	"\366Q\240\333G\241\311>\n@\326\206f\256U\0237\031OfD\253\214"
+	.ascii	"\035E\333\2465\302lP\021C\032\232\r\311\212\250jC\263\241\023"
+	.ascii	"\254\030riiC(C\265\241\224!\3320\312\360l\235\016\315\206e\255"
+	.ascii	"\230\2563\252Q\037\205\241}\024~\366-\240\267o\2011\373\026\360"
+	.ascii	"\262o\201,\373\026\250\262o\001\266\375\017\301\206M\206M\206"
+	.ascii	"L\206]A\274)K?B\260P\251\024i\263rk#\262\212\275\031i\251lYC"
+	.ascii	"\255\341\327\020k\2705T2\\2\364\032J\207I\206\\\353t\3305\274"
+	.ascii	"B2$HK\205R\325R\207]\303(\025j\327\360\310*F$F\026\230)\2709"
+	.ascii	"1\030\364-\300c\337\0025\366-P\264_\001\276\375\n\334\355W\340"
+	.ascii	"m\277\002e\373\025\330\332\257@\220\375\nL\355W \306~\005X\354"
+	.ascii	"\177\bd\350C\007\022\030%\254~\007C\037\303\035e\324\036\303"
+	.ascii	"\037\353t\350c\310c\350c\250c\345\263`\305<KE\005\243GuN\325"
+	.ascii	"\227in\212\222\253\037Bo?D\226\375\020i\373\037\346\030\342p"
+	.ascii	"1\346\n\031\253\251\326\033G\2424a\365C(\331\303\247\241S\031"
+	.ascii	"\022\331\333\322*\366\204\n\214\226\312\364\201\25615\2741\234"
+	.ascii	"1\2541\224\032\332\030F\r\241\2064\326\351\360i\330\364\241\214"
+	.ascii	"\265\354l\233\322*\026\243\213:|\032&\265T\0321~D\257V)\2549"
+	.ascii	"\0364\372!\2346qE\272\017\261b\377\204\276\375\023\252\373'x"
+	.ascii	"\331?A\313\376\tT\366O\220\262\177\302\330\376\207/\204a\300"
+	.ascii	"\2260UY\375\365\215\n\222\226\266)G\027*\025K\335\236\225\026"
+	.ascii	"w[\262T\271\330Q\251`\321\213\252\275\325\325\370\302\326\212"
+	.ascii	"y\243v\311BG\344\024\367\"z\205\257\n\330\021\353\004W'Wg\204"
+	.ascii	"\327F\265\343B\025\206\021z\201\243\316\261(\022\206\021ny\213"
+	.ascii	"\303[\253\016\205\204{\303#a\237\260\214PO8f\330b8\013\371\206"
+	.ascii	".\206+\206,\206FB1\303!!\231!\321\360gX$\254\016\201\204y\303"
+	.ascii	"\240u*\f#\0043\323\002\256\256\203\376\t\322\375\023l\354\237"
+	.ascii	"p\264\177\302\317\276\t^\366M\210\3337\341\311\276\tD\366M\200"
+	.ascii	"\3327Ah\277\0040\373%\\\331/!m\277\004%\373"
+	.string	"%\364\330/!\306~\t?\373$P\367IX\333'Al\237\204\254}\022x\354\223\240\264OB\220[[\220I\326\017:6\341\024\241\024\341\2320\312:\025\266\t\325\276JY\333\276\232\261G3\340\"Fr|U*P\320\220\316\234\242m\3024\370\311H\216\357\235\036\251\273!\324\007A\335\007Q\267\017\202m\037D\330>\b\253}\020QeSM\005\006\237\021!\023\275*\032H\225J\0232o\302\251\260\306*F&|\"\024\023\216\t\235\254S\341T\030&$\234\n\301V8\246\256\275+V\213\f!.\204\372\037\354\366?\320\355\177`\333\377@\266\177\341\227\320\213\025\232\362\372\022J\205K\204J\326\251\320K\270u!\227\260K\350%\334Q\306K\330C\250\325*I\272@\220\320K\250\203\217:\267\220\212\333\332\225Zk\334[Y\221\356?t\t\205<\204Y\254T\22379/\254\306\nZ\211\262C\302\352\177"
+	.string	"\202DxDXDh%\274\022\032Y\247\302$\302!UB!\255\222\244]\026\304\205J\244\032\205\363\321\2010\2110\272\345\307\2350\211\020\310\313\306\204\265\026\354\262\003J\nQ\177\204\275\375\021\262\354\217\340\266\205A\326/\260\036z\254\376\bL\366G\300\332\037\201\307\376\bM\373\036\372\366=|\331\356\274\326\270\367\360\266\357Al\377\302\034\027\342PS\262\363\"\304\361`\016\2630!\225p\352*\016\350\013\253oH\207B\250H<X}\017D\2046\204Q\353T(%|\202\332\"\224\022\326x\323\214\216D\025o\020\241\213\341\352{\250\332\367"
+	.ascii	"c\337\303\213\375\013i\bc\240\271\030\342\302\352w\200dT\366"
+	.ascii	"vDV\345\305\230\220I\270$T\022\302\020:\te\b\233\2043\326\251"
+	.ascii	"0\2060\211H\255h\215\032C\330\202\rM\030C\350b%\302\264\303\354"
+	.ascii	"j\236\245C\035ls\332\214>\005\250\354S`l\237\002C\366"
+	.string	")0\265O\001\244\375\t\344\355O\240n\177\002e\373\0238\262\177!\2131rCfV\177mcR\365\"\333\022\205B%Z\r\366\005\313\004\257\004\255\004\355\202x\302\025A>\341P\260N\370\023\314\013b\021\n\005\357\202TaP0Kp/\250%\250\027\354\022\034\023\f#\234\203^\202\\\202[\202b\202d\202_\202tA0\353T\b\024\234\003\273\233R\266\325\"\312:}q\021E\321V\261\2677\2656j\225\260\340\225\035\025\016nZ\246\345be\"e\n\207\267\226\372dm-*\004\nV\t\312\021\333y\306\321\025\245\342$\272\244\214m\025#\243\232e\211V\211RV\246E\t\207\266171\252\020(\230\346F]\231\234\301\215\2755a\235\272\372\242qaB\240\240\364\203<$=&\f\032\242h\310\225\240?\001\031;(\027f\325\367\002\217\325\237\200\322\276\004\372\366%`\267/\001\271}\t(\331\227"
+	.ascii	"\217}\t4\355\213\220\267/\202\335\276\br\373\"D\331\027\301l"
+	.ascii	"_\004\260}\021\270\366E\b\262/B\323~\004\370\366#\200\267\037"
+	.ascii	"\201+\373\021\210\262\037\001\351\016:\tN\327)\206\240\\\320"
+	.ascii	"\213'V?\002Iv\n\346\025\203\373\276\025\203\373\bT\355G\240\306"
+	.ascii	"~\004~\366! \267\017\201\351>\004\210\354C \306\376\003\366\366"
+	.ascii	"\037 \267\377\200\264\375\007|\355?\300\310\376\003"
+	.string	"r\354?\230\025\304:\0333\007\206\344A\254?x\025L\3226\255R5\200T\205\261\272\245\2565\256\004V\244\273\273px\020I\260\214\030\036\320\221/aV^X\005{\004\177\264R\263MF\365D\rZ\005\201\300ZT\032XY\215\211R5\022,\022\034\022\214\006\211\254\323\240UP\310Yi\320*\030$\004\253 *\256\236\025\325\230(U\253`\325\f\352<KyL\031;\023\352?"
+	.string	"i\377\001B\373\016\030\263\357\200.\333\307W\333\225\351\314\352;\240m\337\001a\373\017\362xp\207Z\231\2653\035\301\034\3534\270#\210\203(8\325J\315v\031U\321\216\235\024\244\"\002\031g!*\027Q\030\317\007\rW\337\001E\202TmS\020F\\\226\031\254\276\261C\312\210\rV\337\001O|A\251`\324:\r\332\bB\005m\354\242\266I\b\332\230(-\231\2577\252\253\357"
+	.ascii	"\242\375\007\237\2025\264$Ycu\260\206\330<\317\027\332%1/#\254"
+	.ascii	"\016\316\340\360 \r>2"
+	.string	"Ea\254.\006\235\202LyWpBX\035d\n\256\b\"\265J\222*0wG\005\"\023\025\352B\r\302\b.\005\233\202J\301\030A\031\3534\310\024L\322A\246\340\254\027d\n\006U\251C\2522q\\D\375\020\304\274\350\361d\252\306\352\207\200e\377\017\026\005]\004\215\326i\360(H\304\002\213V\213\340Qp\250\205\222%*D\323\302\203\332\372!\310\355\207\220\266\037\202\331~\bb\373!\204\355\207 \335\017\241\310~\b;\366C\230\332\017\241\306\376\341\276*|te\262\300{0\030W\013\013+yQ\304\250\\\340;,\2660*\\Q<)O\332`\270\2568xnK\017\036\003{\201\277\300d`1p\025\016\003Sa<8o\235\302`\340.S\234\274a\201\267\004eQa0\360\332\224\n\203\201\255\300u\026\264\230\347\251*\267\2124\365Tm\253\312\300\312`\320o@^\032lGUD\n\212\325o"
+	.string	"\227\375\006\314e\201\265\354*&nM\326\262\224\321\301Wr\2128Y\322EW\244\n,\367\2632\005L\215\325o\200\216*\r\200\332o"
+	.string	"\013\370M\212\017/2X}\020\364\266\033\b\\\366AH\333\007\301k\037\204\"\373 L\355\203\220\264\177X\rN\203\323\016\243\031\321\212\216\261\372\253\232\264\352\325\301\030\314D\313\222\273\255\226\2527\205\303`2\370\t\354\004>\203\301\3402\030\n,\006\233\255Sx\fnR\345\213\253\245\346Q\3411x\n\006\262\306\361\320pe\320\272\310P\307\340*Xk\215\343q\202\230=j\033<\006+\231[\273/zpWk\021\234\2240\f\372 \314\373\037P\367?\220\333\377@m\377\003'\373\037`\355\177\340c\377\203\032\373\037 \355\177"
+	.string	"\224\225A8\035\222\302\342r\005'Y\2470\026\034$\311m\261\306\3618\001\253\r\306\332D0\2225\216\307\t|n\332H\230\2560\256>\302\n]T\267X}\017\316\212\300D`+x\310:\205\215\300B\302\324\340hY\025\027-\310`#\273\310\351\305\334Z\261\305T\224\027X\337\003\033\373\036\004\355w`\267\337\001\335\217v\353\355m\b\253\337\001Z\017\230\307:\205}\300T\207u\370\270\243\302>\262P]\253/eJ\256\376Z\205\013\234\003\336\001\343X\247\260\016;XG\224\027YX\035\324\330\357\200\305\376\341\033\360\f\265\351Y\021\253\337A\336\312Gfe\002\317"
+	.string	"\212\001\216!\376\346yjo\257\013\225\002Xz\324y\236\311\3003\3341p\2145\216\207v\273\243\3023\200zU\252\r\030\n~\202\245`\032p\024\\c\235\3023\340\246\3032`\247-\007DF\231Q\257fk\215[\301\212t\337\201\314f\322Df\320u\261\372\035\260\354\257op\220\033\221\026\2702\360\022\254\004\033\301E\260\013\370\b\206\001#\301/\340\026\353\024N\202YP\021j\203W\260E\333\200\302"
+	.string	"\371V1,\300>x&\266\363,E%\252\006'\301?p\022<\344"
+	.string	"\"/\216\234\021[l\215E\261\321\357\200\265\337\241\307~\207\247\375\016E\373\034\310\354s\320\262\317\301m\237\303\024\236[\352*5\346-\215\325\347\340\265\317\001\310>\207\247}\016+\3669 \263\317\201\335>\007r\373\034\240\001\307\254|\353\213d\345\005\022\253\317\001\330\376\201a\200`\222\242-z\260\372K\211/rJX}\016\214\354\177\320\345j*dK\027\025x\007\344\002\264\003\342\001\275\254S`\027`\226\003\265\264p]\200W\270\250T\260\314u\001\326\255b\026\004\315s\024\224[}1\305V\235g);4\306\350\213\250\317\301\212\r\257H\367\033|\331\337@n\177\003\261\375\r\262\366\017\244\003Z\371\342\222\005\306\3529\251\320\220\255\f\223\023\253\277\201\2218 \025`\225u\n\224\003\276\265\001\335\260\242\363\374%\007\204\003\272\255qN\021\210\242E\235\347/\240\034\220m]r"
+	.string	"1Gyb\206q3\262jl\375\r\220\3667h\261\221\220~H\261\372\033\004\355o\320\233\262\306\3041$\t\253\245H\305\270L\301\022\302\352o\250\262\337\301\023 \031\225\223h\032p:\215\242\001\317\200P\200j\300(\353\024\230\006,\0233\003\222\201Q\215i\001\323\200[@)\225X[\032P\t\320I+\215\356\242\240'T\257\032scB\375\rk\373\033\270\304\200c@)\032^@\254\376\206#b\033\204\354o\260\021\206A\330\264\304K\023\253\277!i\377\0076\0012Y\247@0\240\327\007_[\034\200`\300%H\274\266pU\177^W0\372\\\375\rD\373\f \263\317\200.\373\f\310\002\354b\367\250\324\ra\365\031\360\006\344b"
+	.string	"\332\376\201ZYc\336\236\254X\375\003\263\200J^B\336\242\260\272H\r\211:\317\322\270=4;\267\250\332][\264-\232R\024}\343"
+	.string	"\004\032\213\326\331\261N[\340\250\254S\226,T\260$T,Z\242Z\250D\341\370\206\276\264\242hR\216\242Z\216\nU\2317'B\242\\\336\242Em-\212\330\\D\213\326\214:X\302\305\302)\351\002*m/\273\257\225\232\231\0204\205:\3173\321X\017\274*z\321\226\b\n\324\223**YQ\224\027C^[\321\266(m\205S\225+wT8\263\250(\013'\rk\207\232\344\300\322r\333J5\272\347\310P\207\230dE\351\272"
+	.string	"e"
+	.string	"\251\2008\2005\200@\2000\200M\300(p\005\260\007\320\b\030\005,\002\336"
+	.string	"B\001\217\200N@\033@$ \013 \021\220\006\020\013\370\004\374\001\314\001<\002\324\001\334\001|\0014\002\254\002\372"
+	.string	"&\001J\001\207\200L\300\030\300%\340\f\240\025P\bp\b0\b\220\b\220\007\360\n\210\0048\005L\002\272"
+	.string	"\026\001\266X\247@%\240\320Y9vNm.\243\002\225vt\023i\245\321\022\230\324\240\272\021\225\265C{\312$\b\221X\016\037?d\300 1j\031\332\214h[tF#\252\345\200J[.\217\332\016\001\225v\330\025u\236\245/\017\036s{;\372\fh\262\317"
+	.string	"$\373\f\320\261\317"
+	.string	"\031\373\f\020\332\377\306\333]6u\363\255LS\316\310X]\246\345sA\266\305\352kPf\377\337y\233\314\326\333\325u\272\367\266\0300P\324\275\267\307\330\240~\211\212\356\275\035f\025\273:\252s\272\232gi\017'\2749X_\003\271}\r\332\3665\230\262\257\201\224}\r\3246\033\304\341\033O\343\020\203D\204\325\327"
+	.ascii	"\312^\251"
+	.string	"k\215+\200\025\351^\203\256}\rv\354kPc_\003\243\375\f\366\3663\300\262\237A\331~\006[\373\031\004\331\317\300i?\203\243}\f\364\3661\340\262\217A\333>\006a\373\030h\355c@\265\217A\321\376\002\310\354/\200\312\376\002\310\366\027\240\265\277"
+	.string	"\034\373\013P\332\327\300\267\257!\313\276\206\264}\r\322}\rH\3665\344\330\327"
+	.string	"c_\203\320\276\002\276\354+ n_\001\323}\005(\331W\200\325\276\002|\354+\340i_\001?\373\t\270\333O\300\333~\002\236\354'\340\310~\002h\354#\200o\037\001[\366\277\273\270R0wm\256-W\b\335\032\030\253\265\200/\324\344\220\260\372\b\220\262\337\302\365\310\022\005B%\032\344-\212\267\2556\017-T&\333jG7\2215\316I\027\341B\265\332:\366\2165\216\207\326\332B\255\332?\340\242\363<o\253\355c\377 \376H\347\237\325\314hK\332\025\222}d_\355\254]dcm#;\311:\335V[\b\013c\311\323\326\214\376\367\220\235\243\r\263JE \364\021\003\006\025V\257Y\034\276\207\024\347\312\302\004a\365\021\240c\037\001K\373\b`\261\177\200\276\375\003T\177|\025{\n\231\321\204\325?"
+	.string	"\336\376\001\340\366\017\260w\254|B`\252\362\200\260\372\007\320\332\300\025\351\376\033\007\325\223\262-\247\033{j\235n\252-%\265A\307\203jG\311\361]\t\263\266\324\\\270\372\007H\3327@\336\276\001\260\354\177C\355\247\266H\311\374\265i\354\031\273\306:\335O\333I\313\330\212\321\025\335O\273\251\205\342\301\236\021W\323N\002\346M\311\3267"
+	.string	"\221}\003\350\3307\300\214}\003\274\330\377f\332K\323\350\0272V\023\355\027A\270Pal\245u\272\227\366\322N\202\243\352i\225\212\315\3257\200\213\375\265\212\013-\321}\264\221\266\321:\335/\336bKt\277\330Em\023\020\002\316\214\220\234=\271r\350m\375\002p\331/\300\225\375\002\310\355\027\240m\377\233\205\022(B\342X\315a\377\274^|Ly\345\252\250_^1<\250g/Z\bCI@\026tB\250i\357Z\216 ev\320\006\332+\336\276\227o\017\275{[h\317\353t\377\274lo\213^\275\375\363\216y\363\230\330\240\316\275Y\230"
+	.ascii	"\211jy\251+~P\347Y\272\177^(\267\013a(\t8DwE\345\260\177^\274"
+	.ascii	"U\f>3:\022\245\345\346\240\0376Z\317k\215\373\222!\376\210\336"
+	.ascii	"I\261\372\005\300z\253B\3360\305\273(\035l\254~\001\246^0\005"
+	.ascii	"P\332/\200\320>\001\304\334\275]\354t\234\021X\337\334\235\235"
+	.ascii	"\260\254\315\n\f.\177\355V\276 \231/E@X\375n\321Ob.\206X\375"
+	.ascii	"0\253\330\177\340\217J\f\2272)/\226+J\342\364\372X}\002|\325"
+	.ascii	"\275W\3405\027jD/\335\337+D>)0+k\031\033P\017+mY\342\242\274"
+	.ascii	"`\365\tPd\307\275U\250\300^vL\001a\365\t"
+	.string	" \025G\205\250\364DK\031\334_*;,\354\356\350\355?\260\025\203bw\365\346VCwDu\263\206\2149\322\366\262\341\241E\231Y}\002 \355_\300\267&\305\t\t\327\rV\277QX\241%9\026\254\376\005[\366\3770\353\364U\373Qi.Q\372\366X\375\013\332\366\377\242\255|2V\350=a\365/(\333\277\200\311\376_\2632\251T\2222\254~\313\232V\251u\305\335Q\036\253\327+\034\376\222\021\225\2220\231\216\275b\360\317\2159&\257\330\377\277\214\225J\232\205\202P\234\252\346'\177\247U\372\226\236\260\372\235^,\314O\330\025'an\226\223\034w\254\006\373Q\335)ib\365/\270\332_\253h=\321JB\246\2065\226%\246\344e\362~\275^o\223W\272N\337%/\227PW\333T\026}\227\274[\0370\031MU\253,\330\r\271=\242\376\0052\366/p\261\177\301\320\376\005@\373\003\340\333\037"
+	.string	"\231\375\001\200\331\377{\365\036\361\212Q$\306\352!o\224\330\3163P[\324\310\213d\235\276G^\"\177\255\336\"\037\374+\223\367\310\033\344\215\022\177\244,\215\245\264\265y\2361\300\200\001+\266\326E\305\325l\322Z\343\026`E\272\037\300\225\375\001T\331\377+\344o\364\304\270#G\256\260ze\302\341\257\020\230\214\232\205\304\352\017@\255j\225\222p\244\306\026 =\204\\o^bo\217W\207[\364\355\361\356\310\300J\017\356\352\375\361\372X\247o\217\227\007\206\341\226\322\032\027W\177"
+	.string	"C\366\007\340c\177"
+	.string	"M\373\177s\274SG\346\\\034\261\372\354\317;\345\202i]\270vsc\242\330\275S\356\2271Q\252T/\216\367\306+\265N\337\2517\352m\334kC\317\357\324/\316.:\317\322w\312\035\363B\375\274c^c\242"
+	.string	"s\210\311M\301:("
+	.string	"\273\375>\005\221\tRe\365\005`e\263p/\022\332\324\220\273\327\366\265J\222\366\223\025GZ\336\"\257\276\350\020\224\262\274U\252\001\r\250\256\372\"\275F]\355\030\366\b\003ru\325\253\241\027\311\325\203\202W\364\"\351\031\332I\bCI\025\310\321\202:\317\363\213\244\361~4<\350Z\322\016U]2k\234\323\f\364\343\001\332R]\265J\364\"\271|L\\P\337\032\257\322+\343ezc\2744^\247\367\350Mza\274/\336\031o\323\273\264N_$\267\357n\030W\3141\274H:\313;\304\204\210\372\"\271eZ\031P\210\324U1 z=\231\325\t@_"
+	.string	"Sv\213\327\005\321\256\242{J\373jA4\0276ca\365K\344j\371\211\222\367\256 \3565A\021\302\352\013@\310+\364\006\261cEZ\210\275@\177\203\204ynpL\254~\230\367\347?\220x\205\253\f\215\325\377\373\363\316\304#\271y\352\235\335>\240\030,e\262X}\001\350\330\027\200\215}\0018\355\013"
+	.string	"i_"
+	.string	"@\373\001\b\343\222Y\305D0_8\262%\331`\365\003p\267\037"
+	.string	"-\033\270\006`n?"
+	.string	"N\360\274\304\205\271R\302j\352:u\275\270]\276\274\270v\356\035P\214\013\254\250\266p\021\2758\251\032\323\372\001\230\332wp\254\324\005\027\214\214.0V?"
+	.string	"P\373w\271@m\271\361\363b\303\002\322\222eh\207\204N\007\026\267n\235\272Y\334+n\034\0265\213nJ\022}\373\210\254\230s\365\0030\323Y\201\243sY\334\234+\267N]+n\025V:\317_U\334\270\266\211F\324\212nj\233:\200\321\325t\345\2016.d\\}\013\352\366-\210\243\002\367[\241\205\207\205\325o\300\242&\2752\254\276\005`\373\037\250%\211F\271\212Nq\335\334\266u\352\262\271R\316\322\255T\330\334\265\006Pa\261]\355|\005\271\261\365- \262o\301\214}\013\220\366-\370\331\277\233\346\242\275@\353Bc\265\213\266\212\211\340BQm\306kc5\007\016w\317\326.=%RX\355\216I\343\222\220X\375\016\236\220i9i\241\254E\3351w\332B\351\361\245\253\251\352\226\271d\256\331:u\307\\\261\267,\330\037\035E\025\322\"m\037"
+	.string	"O\366\001\240\265\017"
+	.string	"\2530\260\2670b\272\270_.\023\267\311:u\301\\\257\263K\334\242U\300\\%hXl`\256\364\307\034\026\033\006\256\\\0232:\266>"
+	.ascii	"\206\366+\020\263_\301\226\375\n\330\366\357vq\261P^L\341\335"
+	.ascii	"\345\022\023A\322n\022c\t\313\226kd\006\025\037I\254\346\260"
+	.ascii	"\243-\312!\307\233\224K\365\344\213\325\312\244\211"
+	.ascii	"\002Zz\324\261\245!AVU&5\306\254\254\252U\0160\254\252WG\334"
+	.ascii	"+w\210[\345\002q\223\270D\\\037\256\0207\352\"q\255\\,\267\210"
+	.ascii	"\233\345\376p\265\334 \353\3245\342\366\340\200\003\216\352\032"
+	.ascii	"q\237\\\033\304\2616\214\f2Q\030_\324h\260Gk\234\323\334\332"
+	.ascii	"\315YU\257f\260Gn\325\027\253j\225"
+	.string	"\007\025\024&\276h\f4\253j\3255\342\352\360\262\252V]#\256\323+$\310\n\216\n\032\333K\200~\005@\366+\230\261_\301\320~\206.\373\031\324\3663\200\271S\3038\031Y\246\254~\006\"\356\r\033n\324z\004&\307\021V?\203\013\027\n\303\230}\fu\373\030\246\354c\370\332\307\260c\037\203\323>\006\241\375\013w\373\027\246\354_x\262\177\241\310\376\205\247\375\273I/p@9\002\307\352w\340\276p\215\214\020\031\303Wu\221\326\251\373\302=\372\032RI\265\230j}\233.\3736T\366\357\026i\030\222\271\022t\345\302mq\302\311\211\213u[\254R\363|\201\b\203\311\025\r\242\fH\240\330\320\301\352\337e\341\003)\013\013\2535S\024o\255\032E\312\224:\317\363\332\024'T\"V\354\020\016\262\244\360\326\252Zn?\270\031T\016\272I\noM\250]\321V\265J\222*\340U\245\345\244\360\240\006i\207"
+	.ascii	"!R$+\251\315\205\031\336Z\365\027\267\362\021\201\214\263P\020"
+	.ascii	"R\264\313O\314\357\356\267\345\027\346\267\367\263\362\033\363"
+	.ascii	"\343\362\323\362\253\272A\2772?\273\237\227\037\325]\341\n\375"
+	.ascii	"\256\374\260\374\276\270\363\217\357W\367\353\373\201\371\341"
+	.ascii	"\375\350~Y\334!\367\307\005\372\221\371\351\255\323_\336\257"
+	.ascii	"\312\177r\2779*?8\253\031o\255\n\243\211\035\322*I\262@P\033"
+	.ascii	"\225J\322Vt\314\232\267\362\265R\263\315\302K\217\272\366\261"
+	.ascii	"B\254\007[qxkZ.\357\267fE\305[\253\262\361\265A\027 \231Y\247"
+	.ascii	")\277<\326\213Mk\225$]\200\212\214\272D\215\355\n!\211\031\336"
+	.ascii	"Zu\314Z\355\243\316]Rxk\322_\036\253\204\355\na(\tX\344\265F"
+	.ascii	"U\022A\no\355\252\217\005\352J\302[\253\366\345%\341\255UW&y"
+	.ascii	"\277\266\326\205\225\224\255L\026\365\227\367\213\362S\013a("
+	.ascii	"\251\002^>\250,\333/\217}c\367\226<@\022\227\367c\2632\303[\253"
+	.ascii	"\256}y,\322\226t\306\035\225V\t\372^\244k\215KtZ\221\356m\326"
+	.ascii	"\366m\236\354\333h\3557\340\225/Pa\254\276\215\325\276\r\216"
+	.ascii	"}\233\032\3736H\3736+\366k\252\3735q\3735i;\255\214\233\0245"
+	.ascii	"V\277\006l\377\240\264l\277\261\020\206\222L\230ka\365\037\224"
+	.ascii	"\366H+\245U\222d\2019\027f\277\263\037\332:\375A\371\221\275"
+	.ascii	"\025\322F\211@\371\225\375\250\224B\030\022\225n\241\001\206"
+	.ascii	"n\353\327`\355\327T\355\366\307\f\314\211\024V\317\277\250Nj"
+	.ascii	"e\020\201\214\363LU\026U\373\365\254\221\332&\017\262\200\302"
+	.ascii	"\210a\217Zi\364mB\365Fe\177\274\254b@\355\220nR\242A\022\"u\325"
+	.ascii	"jK\345l\256K+-i\030J\036$\221\373E\1775~BZ%I\025\b\352Bm\355"
+	.ascii	"\242,\322*\326J\243/\030\225\026j\033\367\213\266UZ,0\016\260"
+	.ascii	"\265\244\256Zm\207b\210Q\347y\236\3525\240\251\b$Y\302\373\202"
+	.ascii	"'\265\333k\373\262\246Z\270\277m\213\262K+\337\032\307c\006\372"
+	.ascii	"\taKNk\f{t\200\254%\277\250\236\241\235X\020D4\317K\007H2UWm"
+	.ascii	"\341\300\254bYrNZt\027*\r\220\234\325U\253\255]\264\275k\251"
+	.ascii	"k\234\323\374\343\305\203\255\245\272jU\313e\321XB\030J\002\276"
+	.ascii	"\230\343\242\316\2634\252\361\002\263\026\2210*\261h\t\212\257"
+	.ascii	"f\306kh\024\351~1\244\334\300bu\215S\221\256J\372T\206\32552"
+	.ascii	"\210c0`H\tI\221\243f\251f\251\206i\001iMA\232\200oV\304\266j"
+	.ascii	"`\274\206\351]\002\006\313O\n\250\032\0275.j\222"
+	.string	"\264lL%\271Fd?6\220^\223\244\344I\237\031\253k^\024\273\314\306\300\351\261\272\346h\345\313\302\305\205\312\352\232\242\032\243!V\231\026I5FE\266(\322X\024\273\241\241\032\"\fR\355\334\213\245\264+b\214\026di5,^C\304\212\241\331@\302\036\271XB\213b\365QT\251\t\252\t\252\021\252\212\n\177\204\351\023\252\021R3\242ek\b\253\217b\254\346\247\346g\206\310\032;F\213\005\033\253\217\302\bM\225\246J\323Gtk\262\022#\204#\242ZA\303w\232>\033H\214\332XMS\346jnMyw{\277\037?OF{z\303+V^\210\221\241\311\023~\335%\371a\365Q\330\240!\203\202H\214\230\"\026\006\251v\356\307R\232\036\2422\342\304\352\237\030\003\006L\021k\255\032mI\273*[\202f\006\327\245\013\r\036\261\351\250\316iU\352\202\327\344\3454x\3242-Zh\354\366\214\266"
+	.string	"\277\0049\211\302\3454v\332\212\236\2132V\323lY\305\266ti;;qECGCG\203e]2#a"
+	.ascii	"\023\365\245)\355I\213\272\323`\271c\357\236\324%a5\315\225\027"
+	.ascii	"\315%\302*\323\344\204\022M\025\232*4sLl\222\232\323\r\032\271"
+	.ascii	"\323\314\261[\360\266\302\354Q\241\002\363\031\311\361\375\246"
+	.ascii	"DqUX}\037;\2327\232\267#\335\033\345\305\024\333\025\\\007\305"
+	.ascii	"\005\212\325\3679\243i\243i;\322Em\331kq\226\005J\225\024)4S"
+	.ascii	"0H\375\214q\271\236\372\256\252\305\032\\zIh\326N3\245l\312\224"
+	.ascii	"\262*\037\246\2633\0325\031H\370~Rnx\275H;\215\332\360\247L\013"
+	.ascii	" V\323\240\255b^f\325\331'hl\214\306\f\203T;W\265\224\006\367"
+	.ascii	"q\2712Uv\0323!\226\2451("
+	.string	"2x.\351m\217L\372\372\b\203\024\375\362\344\311\221\016\203T;\007\265\224\366\204i\013\b\253/\263\3218\241qr\244C\262\246\246w5\204\325\227\247``4L\210\226^xduu\3210!.\035\3259i&e\326\200\276N\303\004X\025\246\352\203\306\013\216\306\022\026\032/\232%Xb\274\b\302j\032%!\354\266\244\260\372r\220M#\005\n\265lUk_X}Y\212f\213f\353H\2076&J\t.*2\254\276l\224\225\305aN\017\356\212\370\343g\246\202I\222\344H\207a\317[^NTa\032\321\021(,H\220\314\020\301 \325\316!-\245e\205e\261`\365\2414Fh\214\024a\352\332\013f\211\333\321\205\325\207\202\321Di\2424VOL]{c\370\222\332h\210\234\306J\255\250\025uB\307j\232!W{\333\340\250l@\205\320\004\241\tB\303\303=\"\243\013\327\325\022\024&P>|\320"
+	.ascii	"Y\265\242\260\242V*S\033N?N\003\244\205\222\224\345J\221I\360"
+	.ascii	"\fI\253\b\253\017\235it\320\350\240\341q%\243\013\027\354\344"
+	.ascii	"F\206e\307ix\364Ua\342\266\304jj\305\027.7n\320\340X\227\314"
+	.ascii	"H\r\300\033\303wU\264\332Z\223Bu\032\034z\256\353\n\026\232)"
+	.ascii	")PP46V\2434\250\316GT\273%\tS\204&\35246J\270\031\001Q\031\301"
+	.ascii	"\361\243\b\253\377\364\242\251AS\203\030\245\311J\314\025X\231"
+	.ascii	"\235\027V\377\031\245\231A3\343H\347\365d)-iE\227\026\254\376"
+	.ascii	"3\212\006\006\r\f\032\031U\260\326\316\372Q\005\210\206\3514"
+	.ascii	"2h\232\2428\252,h\232hbh7\261\""
+	.string	"\272\034|S\272\350\021\235\306\005\021\215R{e\225\316NR?^\034\240\027TR\244\244\312\321i\224N\223\324\341\203\333\355\253#W\200XM\203D\363\202\306\350vE\354\214\274\260\232\246\350jNu\325\0353PZ8\252\271 V\323\264"
+	.ascii	"\236E\345\230b\365\337\351\225\032QV\237\004`h\204h\204h\206"
+	.ascii	"\264V\252+I`4+N3\364\203\373\021V\205B\002,\310>d\037\rP^\f\271"
+	.ascii	"\264\252\020\215\210\331L\363s\032 d\036\034CI\0178V\323\314"
+	.ascii	"-\024\241\215*>\256H\340&F\f\262LR\f\271\264\252\273b\356il\357"
+	.ascii	"\3102Z\312\212\035O\364\252,!\342\246\207\314\023#\004\254\217"
+	.ascii	"\325\3101\310\352:\275\033\222\314\257\270\240zb\365Ip\266S0"
+	.ascii	"\273\271'\301\0230`\212X{FG\242\252=\236\310\370`\365I \305\303"
+	.ascii	"\243\021\343n!\242e\007\253O\002\037vvHj\206\265\246 M\277#G"
+	.ascii	"\210\300u9\222z\267G\225\266\261\032yW\244[\301\226\252\270\220"
+	.ascii	" j\313\026d\226\026\200Xp;n\260\372$P\252\253CfY\227\314H& v"
+	.ascii	"m\215Y\302rd\226\255\036I\321\267\252\032\326D\254\217\216\016"
+	.ascii	"\005P;\234\256V\034C\226\350X\375\236:\344\034rn\206H\r\323\276"
+	.ascii	"\022\002\366\304\352\367\254!\337\220o\310*\031\270\232\2024"
+	.ascii	"U\213d2\246E\310\270"
+	.string	"#\253\270X3\336f\260\032I\305\306^\220%V#\341n\327\342\307EQ\317\023\344\024\344\024d\033\324\016\247\253\225N\310K\022\333\221m[Wb\230\306\376\003\333%Za\272\270\244HYi@\355p\272bS\223\242\205\325\357\251B\252!\325\340\202\323\256)8n@\201\202D\303 \365\343e\001XMA\232\212n;\204$!\317\216D\033Fq\310\221\365\304\230N\221eA.&\254\265!\223W\020\036dG\226\255\320!\215b5r\214\025\302\243\214\312j\244\030\321*\310[\027\033\254F>)n\t\3151\231\262\205\3666\225\204\325\357\tj\362&\310\260\325(\r\322\222\205\272\352\340\nR\005vdXP\352\006\213*u\311\022\344\327US\220\246jPi\257\306\023\244\327\221_0\262\034\355\240\313\312BJ\263`3!U\230\025]ZGJ\273\364\336\331\f\326\205\344\212ck\232\302\312\020\306\246\264%\034\002"
+	.string	";\2421!cU\232\214\231\025)\202L\002\004\206c\302Z\003BY2DE\03292\t\362\n\217+\217\n\362\n\211\344k\006\237\223$`q3f \217\020\213\210\221Ea9\243D\210\034\351\370T8\2059c\365\235S\321\350\221\256/\032\304\266\207\204\325w6\001\001\202\f\202A\352G\214\233\0045\006\257z\207U\344\005Yud\0201(R\266\253\377@\020\3500\002\205\325oV\331H\035H\035H\03754\206=\244_[=\216\364q\265'%cU\254~\030$\217\031\321\"E<\220;\230\274"
+	.ascii	"S\004\271\303\355\222\324\225\2065&%\205\304\001Elj\262\322N"
+	.ascii	"\244\326f\344\215#q \251\222\2360yCN\025\245\204\261a\306\352"
+	.ascii	"7\225\354\207)\032\371\017\004\252\245\025\331\302\3527\203 "
+	.ascii	"\237\220O\310\250wOF\027\256\026\253\305\025\033PGF\205a\022"
+	.ascii	"\307\325\324A\203\206\217-QZPa\365\233FH'\244\023W\223\225"
+	.string	"\230\352\323\021\2131V\237\207\332\3244c\203J\310RZ\265\253\354\212\024\253\317C\206\204\201\204\201d\n\342j\311\350\302e\024#\255\b\222\251\270\344\016\216\n\033\253\317s\205TB*\315\020\241\022[J\253\272Dv\f\001b\365yt \217\220GH\244&\341\327\332\036\036\362\305\221H (\202\021\203\207\306\212#[\254@\026\275i\030z \365\240\352\212Tg\242'\r9:l\270!]\034Yt7\267\217\211\331\024\222\350\255\243k[\302j$\213_\r\030[\212\f\375@!\01778<V\177\307\312\376\316\0332\b\031\344V\237\372\256\256\350\222D\315\254\376\016Y_\037\362\007\203\324O\0307\357\251\357\252\372c\202\233\221\0039\037\371\2436\343H\215\035,=\275\2312\256\331S\337U{\325B\313\324\314\336g\312\240\305q\241\302\352\035*2df\234\336\n9i\370\265mI\r\261\372;Fb\304\314\214A"
+	.string	"\023T\227\226\013\274)c\332&\253\2551M\334\360\360f\300`\220\372\361\342\200\245\243<1U\341\223\252\221\237\231/\237):q\242\347\305\212\325\017\003$\373\017\034^\331\321\315\030\243Rgl`\220\372\361\202"
+	.string	"6\031H\370\\$PQ\326\272\270p\231\271\303 \365\023\006>\302\204\265Veg\220\ti\231\261\373\314\335\227\225\252\037V?\214P\310\177\340q\305\217\020V\237\205\036Z\264\314\330\230\341F1u\355U\277\350\360\306\260\372,0\315\315\315`\301 \365\203\027\002\037\024\222\265\352\017+1Q,3ux1\216x\260\372\212Yt*\f\253?\002*3t3V\276\232\210\375\260\372#\230\356\217\240H[\333L\225u\311\214\3642\305\220KkW`i\033\233\211\373L\225\f\260\226\276\250\374\007\256`d\355\214\n\234[%\f\024&\267\231\267\2476\263!\254\376\bzl\267a\231\r(\031k\254\376\bhL\2312C\204\206\nEd\211X%b\003\n\253\317\274\223\"eF-\t\227\221\213\256*i\177\332\214\332\272dF\262"
+	.ascii	"\f\324\016\247*\031u\315\205Z\025\223\f\270*\253\317,[\362\231"
+	.ascii	"\260%3g\305\260u\236\235\346 \2419\312F\005T\240~P\2533"
+	.string	"\221\223\206\341\030\215$RN>s\366\231\261\016\037\314@y\2416%\206\3253d3e\353\364m3f\227\026\211g,\230C\366\327\267\271)X\337\346\316\210\235\350\364vFe\365g\2463O~ l\225\343\013\t\253\317\354\261\317\200\275\244IIi\246\311g\300~`\220Kmh\216\325g\336\3303_\237a\362\003W\035/\342\344X}\346\323\376g\274~\240\320\013\220&\037\254>S\306>3i\317l\315l\315H\2114\005iJ\001\225\"i\327g\244,\202\264\240c\365\f\227\360\311\22791k\021\211^\321\025V\2379ca\315da\220\372\361\302\200%\250\035NPG\242SY\3041\370kI\225$V_GJ\221\"3W\030\244~\274|\300\007E\345\326\262%\275u]!\321E\210\224\030\031\2319B\2543\263\313\301\352\353\3700\242\0035\344Cf\210\254Kf\244\017\274\306D\271z\327\254\242G\210"
+	.ascii	"\207XQ\031\261\372:D=z\314\b\301 \365\023\306u{\352\273\232Z"
+	.ascii	"R\002\n\362\031!wfR:X=\343c\246\352?\220\030D\tZu\246j\006H\332"
+	.ascii	"\331U\020\023\021\312\213U\327\314\017\230\005R\264F\265hT%u"
+	.ascii	"!\206\325\3179\3333T3T3;\232\2024U[0mXZ\350\370\314\216uj\303"
+	.ascii	"\354\007\253gr\024\351\306\262\214a\261z\006\307\273\004\303"
+	.ascii	"\360IU\257\026\003J\326\033\253\237\3635sc\346\306\f\022\rb\222"
+	.ascii	"\321\221\250U\253\t\2312ZQQ368Xg\026M\250\312\250@oez\330\020"
+	.ascii	"\313\242t\265\305\352\347\360xzB\203\203\302\254d\261\3729I4"
+	.ascii	"h\3148\255Fi\320\034\\\264KJK\007\253\237#$C\306\214\323\001"
+	.ascii	"\262N\200DF\025\247\026\312\n.\036I\252JJ310H\375\340]\200$\210"
+	.ascii	"\025B\304\310I\214\031&4\275\267\246\245"
+	.string	"\031\030\301\266\263\"}Y\226p\246\354\231\0273/f\2200H\375x\321\220\304\313\252\n\204\232\316\200\302\352\031\244\037J\206n\200\315"
+	.string	"\315"
+	.ascii	"\315\030\211\360\005\213M\003%Y\2711S\364\031#\265\034?`\260"
+	.ascii	"z\206\305\214\2133\246\2457V\317\264h\201,uaqd\206hf\350?\260"
+	.ascii	"u1\004\n\216\231\241\231\025\323(\2459V\317\b\351\"iSb\254>\316"
+	.ascii	"\216\231 \327\313\311\027\2750V\037\247I\314\305\314\314\353"
+	.ascii	"\222\031i\205\240\256\246\253\"^R\333V\337g\346'U\036o\254>\352"
+	.ascii	"\035q|\335\261`\365\261\314O\213\220\036V\254>\316\212\343^\336"
+	.ascii	"\177`\220J\032\024w\314;\222\021R'\2275\346X\355\013sD\215\325"
+	.ascii	"\217\305\354\343\030Wl\312\226\r9:/^\216`\236\004q<\371\022\363"
+	.ascii	"\345G0\277 d\306\342X}\304+\322\001\217diB\203\257\313\312I\007"
+	.ascii	"\253\037\257\035\271\034\271\034\273L\243+\336T\222\026w?vy\177"
+	.ascii	"\300\345Xb\365\321\256H\267\302jO*\026\333\307\272c\335Q\313"
+	.ascii	"\352\324\024\244\351j\256\261\207%\313\217Z\370\252ry\254>bY"
+	.ascii	"W<\371\340\362\203s\341\220\366\362\272\254X9\322\255\363<\317"
+	.ascii	"N\"\264M\211\316NN\032\212BqXR\216trE\202LY\375\030I\\\334Q\356"
+	.ascii	"\n\b\\\0328\333\363\252\362\243\334^\236\025\240\343"
+	.string	"Y\2222uC\254~\234cm\355\b\347\325\200\350\333\217p-\016\247\275-V\037\335\212]\\\244n\264\261\372\330\32665\221\006\t\302\352#\333\224\230\305\221\354Hv\214\022\245\203\263\241\f\034^\232\250\375\030\305\r\242\201D\006\253\217i\305.`\022\031Ot\260\372\210v<\0232d\354\005\253\217e\3073\2632p>X\375\037\317\216P\222\264\201y\3722\002\252-o\254>\232\021\267X\231\211\276\354g\260\036\305\304\256\266&m\260\025|\3249i\316\3407tG'G'\307i\017b\222\223\206`\221*\240.\254\236\026\273\274,\255\230r\266d\311\021\254I\002\334\232\374\b\306\312\350\222\342\261\372\310\244\330e\205\016\251\214\325\307\257\243\327\315\325\376\221k=J\245?8\340<O\365 \322\270\231\332_\177p\356\177\334\332Z\3050H\375\340\021 \251(\346\b\324\017V\377\246\251H\221c\326\312\301\034D\367e"
+	.string	"*\222\037\263\216X\323\031sV\254>&!\216\255\350B\206\325\277q\261\217W\307#\305\256\377@W\007\032]\013V\037\215,\305\034\211\034\211\034o\024\251K*@\200\034\2433IB~\214\2769dL\265X}\fR\244c\255"
+	.string	"\361\372\302\352c\325\362\313\207\217Ul5\316AuI\242U<x\020\251K\0329r\034u\004)2=\314\217:\254\216\244;\242X}\023e\366\177\244:R\255b\355<G\361\200\331\222\244\031\334\004\336\321\306\321\306\361\206\r\215\243\324\2177~\247\243\306\217\226U\234\0301a\254\276\211+\373?\326\370:=\3268B\375\204f\240$\356R\214.g\254U\230\216\030\254>>m)\353\013S\3337\321%C\306q\006Ph\236\252\n\3220:\022%\234\201\304L\313\321i\007\223%)\253o\202\310\276\211\035\373?\302\370:=\3028\306X"
+	.ascii	"[\214,0XHn \261\372\310\244\306\205\t\034\253o\"\306\276\222"
+	.ascii	"o\377G\244#\322Q\351'4O\001\t\0369\252s\362b\245\312\017\253"
+	.ascii	"\217I\232\356\312\f\206\325W\342\355+\253\354\377h\264N\217F"
+	.ascii	"\307#\rR3\f\006\024\211\361#Z\307\267\225\204\325\307\243\023"
+	.ascii	"\237\254RnZ\306\246X}\345\327\376\217D\323#\321\321\205\006\251"
+	.ascii	"y\311\203/qxc\342\212\202X}lA\0252W\205\325W\"\331W\346\330\377"
+	.ascii	"Qhz\024:\016\265B3P\026\214\245\251hX\363q\305\260z#*\215\325"
+	.ascii	"W.\355\213 o\377\307\3718\037\2014\3541u\3555\241\003\302\306"
+	.ascii	"\352\343\217\016\031Q/X}\021d\331\027\301\336\327\251q\317\310"
+	.ascii	"\007\024\232\201\204\300KLXkU\257\027Z\302\030\313\004\305\262"
+	.ascii	"\034\001c\365E\360\265/\202(\0312\306\274Vh\006\232\276n\257"
+	.ascii	"\222\352\023\2211\357D2\021ta\021\275\302\352\213\240(L\030\343"
+	.ascii	"\030\rR3\f\004h1\3550\253\022\t\243\265\306j\243\2301afV?\231"
+	.ascii	"\267\237\374\262N\215_\202Xo\224&.\267j\321\311\223\2230\254"
+	.ascii	"~2J\227.F/\032\244\200\254B\260\3722&J\260M\317I\033\253\215"
+	.ascii	"TV\314\030\256'V?)\335O\346\260\263\273\023^\261\002F\325\264"
+	.ascii	"e\213\335:G\3665\307\352'\203\262d\341\022}\31349\202c\365C\360"
+	.ascii	"\245\256.X"
+	.string	"c5J\205\350\266D\327\236\312\340\260BG\247%H\344\310\325\034\253\037\002\266\271\271Ul5J\203\350\250D\347y-\203\341\264-\tSY\225*m\323\212.\352<\303\210\023V?\004YT\250\254|\"\326\231\310E\016.\352<\257e\260\243t\371q\203\325\017\001\217\2666\343\033V\020\013\330\342J\325\030\253\215n\\LC\\\254~\b\232\366C\2004e\312*\326\n\315Q<^<\031]\270~e^2\206\260\372 \260\262\177\243\332\324\250f\224\002\024\232\201\200\274QHSOPu\323 \2546F\021\2131\346\305\352\203`m\037\004`\3737B\371:5B1\242i\220\232a\\0$H\017\356\210\022.\032\2546\236\261m\223\224^\020V\037\004H\366A0\265\177\343t\235\032\247F\254\227\351\305\024\233\213\204\245H\221\221\354\306\262\337\370\304(F\004k\267\304I\355`\265q\214\303\215I~\240\202\260:"
+	.ascii	"+\322\235\001\262\"\335\203\300k\235\032\275\214a'H\315L\032"
+	.ascii	"\262\202\266p\025\257\332\334\250\254\376\215`7\206\375\306/"
+	.ascii	"#\023\"\023VF]\325\024V\033\233p\270\021\354I[\031!\254F\256"
+	.ascii	"H\227F\272\"\335\177 \256\253\313\250\244\025\232\201"
+	.string	"~\004\361\2362 \006Ui\241cU\"\202,6\242)F\351*\215\273\362c\210\224\255-`VK$\245\275\212\226\322\256\346y-\003\340[\2250\\\254\376\007\230\354\337\230e\314\332\\\037\340\031mI\253\316\363Z\006\034p\2026\203\325\377\300\217\375\033\221L\215H\214IZ\241YJ\b\274f$\307W\355\n\213\3523^\201\001\311\242c\365?\360\264\377\001\253\257S\243\225\321\310\tR3\f\0040\031q5\005MY25\026\371B\364\004\013\253\357\2011\373\036\250\262\177\243\220\251Q\210q\210\006\251\031\206\003\250FH\316\266\034_\0131\2546F\341\262'NJ\254\276\007\236\354{`\311\376\215?\276N\215?\214U\034\204f\240$A-\342\036\024\031<V\033\201\020\351\350!e\365=0d\337\003S=z\274e?\241\031\210\207\013\306\350HT\365\310\331\214)V\337\0035\366o\334\261\343\025;AjVr"
+	.ascii	"\226\f$|n9\234T!\223#\307;\325\260g1\263-T\"D\256x\261\372\035"
+	.ascii	"\330\262\177\343\324:5N\031\2514H\315K\037\0241\232\252\006%"
+	.ascii	"\005Ua\265\221\352D'\253\024\022\322\0270\254~\007\320\366o\214"
+	.ascii	"2F\031\245N\220\312\340\213\036\334\225\016;4\027\2546\332 3"
+	.ascii	"\327D\312\352w`l\277\003N\366o\244\361uj\244a|\302\260d\376y"
+	.ascii	"\313\250\306Di\261(\211\033\303jc\215\035/\262X\375\016x\355"
+	.ascii	"w\300\030\303\030\303\350\004\201=\243\214\033\235\354\324\246"
+	.ascii	"t\261"
+	.string	"\332\330\3246\005\315"
+	.string	"s\304\007\f\030\3058\021\353L\204F\265E\205\243BvTV\277\003D\3737*\031\225\212p\354\222Y\251\003\264\256\246+/\252)\027\254>\007\264\354\337\370bj|aD\342`\235\3473\252-j\023\222(0V\377\356\331\215H'\276\211\340\213I\013\r\260\242\"\243\321\272dF\022\301\n\213\355j\236\2372\3200\332\350\252"
+	.ascii	"\335^\026oz"
+	.string	"1\242-Z\344\260!|\2222\302\001)\026,\200n\353\222\031\211\304\\W\323\325<\273e\340\376\\\311+\302\352s`\305\376\215B7\n\031W\254F\351Lu\027\235\347\247\f\200qE7\236\200nK`\\\334X\375\r\204\331\277\021hj\004\002\272a\220\372\301\013a\013\r\213\355g\367b\316\t\253\277\001\266\375\033\347\251q.N\321K\346\037\016^V\325+\035&\310\024\223\375\027\371\246E\276b\224\023\244\200`\\`Dn\f\037^\226\224\037V\177\003\321\275=\267\205\006)\240\251\013\362dL\271\r\207`1\tb\3657\220\224\2277\006k\031\3731\367U\253E\274\365(4\343h\213\316\263[\006\3021\363\030\2730b\304D\207S'z]\254\276\006\300|\235\026\301\024\323Z\"\251Y)\002P\244xk\3042S\033VX}\r\\\331\177\321\313\264\350\245\210\327\022I\001Q-\200\251\211\257Hu\236\3352"
+	.ascii	"B\345\br\222:\021\215qum\331R\354\262r0\007\315)1\300\335\213"
+	.ascii	"]\2003\264\220Abu\321\256m\202S\"\232\262\272\310\245HG\r\262"
+	.ascii	"\342e\311\177\340\033\205K\024/V_\0038\262d)\326\355y\236\177"
+	.ascii	"\2443\322\005\256\2461iW\032 \332/V)\312\2758\367\271b\335\215"
+	.ascii	"\363<\003\340\251iLZuvJ\322\360\027\257\274XWm\002wF\367\037"
+	.ascii	"X\202N\013\025:+\301(\215/e\2624\005\345Ia\3653\200\266\377\257"
+	.ascii	"g\177w\006J\232\347y\351'\235\223\202\204\356\277~\375\255\253"
+	.ascii	"\206\177\270\266k\001\376\353\337\003SD\314s\025\027\036\363"
+	.ascii	"<\257`\266U\031P\215\013\346\377\377\205y\236\225\210\204\346"
+	.ascii	"\237\225\350kJ\211\350k*\351H\3446\2454\013)]\tMI\255DBSIIB\363"
+	.ascii	"\317q\376\232J\"\232\247\224\214\363\327,\203\350\013\350g%\022"
+	.ascii	"\232\225\346yj6\316D@J\363\2274\351H\3645\225D\3645\245t$\372"
+	.ascii	"\002R\"\232\245f#\221\024G\322,\235\3729\026}\001)\315_RJ\307"
+	.ascii	"\371kJ\251\005\022\250\033\f\250\343\222\303-\214P\333\330Z\205"
+	.ascii	"Hh~q\364\004\224d\214#\222J\315X\346y\r\033\232\223\346\270y"
+	.ascii	".\300<?I%a\001\222\261\232\005\305\275\b\022\003\222Z\245\363"
+	.ascii	"<g8\n\242\222\232\205\342~\3269\216\250\210\324<\027\t\322\231"
+	.ascii	"\217\346y\236=\370\221\306\315=\326\270\037\034O\263\321\320"
+	.ascii	"<W0K\347\371h\236\177\3269n\236\347\237y\236\337\244'\351<\323"
+	.ascii	"0\022E\217\216\346\331\t\303\321\374\364\003eh\236\3310-fJD_"
+	.ascii	"TR\034\2404\371\212\316,\244?+\221\221\324\034\235\261L%\355"
+	.ascii	"\257\037%\263\321<\317\353\227\035U\202\201W\244\322f\341\023"
+	.ascii	"\002c\3653\240\264\213o,\361,\215\212\027V\177\205\352F2d\207"
+	.ascii	"\036\253\245S\032n;X-\r\232E9abuq\rJ\027\242#\254\376\nX\244"
+	.string	"4NH^\260\272\250\246] VYW\254\376\nk\273\210V%m\013\312\206\002\245H\366Vh\216*\213\316\263\223\206V\307\335\023\024\253\277\002\327\376\213fE\262\355\005\207\335\230b\2237)\222\255Kf\244\f\321\243<1\325yv\322\260\265\266\202\260\215\255\323\"\331a\0377l\\auqZ\024\333:\222\210\235\211\025\2374\235\311=)>!Z\201Z\002\322\305\352\207):\331QU\307\302\311\213aK\325\"#s\354\320\020\244\035E0\340\033\320\r=-\254\376\n8\266W\361k\3752\007\031\261\372+\030y\025\225\314\221\311\3216FZ\344\232\346(3\307\352\227\250\333\177q\253\2505\205\372\302\013\253\213YNV\220Ia\365K\254\355\277\230d\235\026\261~YgR\031E$.\336,\343\211\325/!-\036)\026i\300<\027e\365K )Z)\021\201\2150N\\\242_\247\305h1\310\272d\376\371"
+	.string	"\225\2454\241\226\027Ht\260\372%p\354\277($H\027\0131#\254.Vm\211\251Aa\365K4\355\277\370cZ\374\361N\331%3\2145\315h\252z\345\201jP\026V\277D\322\376\213;\326iqG\261\207\210u\236\247Ao\324yv\312`\375\221\343\212\250\330\343o\211\024y\024u\300fTpM\254\306@\202\314\316A|*\243$\214\325'\341e\177\2552\303\215\233vPc\256\013\353IT\253m*F\025i\024\245\212P\305\033E\252\"\216\242\215\342\324:-F\025\237\204\264\212Q\357V\333\004\365:5q\271U\347y^\271\362\204\310\214\372$\310\366I8\331'\341\265OB\013\350VB\r\030hM_\247\305\246\"\323Oh\006\372\341\322@\322c\372\035\311\322\342\304\352\223"
+	.string	"\262\377b\214\"\223\231\013\256\036\254.\302x\221\350\005\301c\365I\334P\"\2021U\220\226\222\246\305\244\342\213u\311\374\023\234#ZJ{\323\320\2522X}\022G\373/\"\025_$1j+cu\361\350\353\022\033\034\016V\177\004\337\376\213F\354QV\024\2520V\263h?{f-\276N\213-\212,4H\315K\016\340s\312"
+	.ascii	"\016\343E\013\253?b\313\376\213DE\026:\206\214\261cuq(\004\331"
+	.ascii	"\0236V\177\304\333\226\022\363\346\220\306\260\372/\n\025\203"
+	.ascii	"\212xBB\260\024\177\2123\261\257\b\264N\213A/\006\021\371\230"
+	.ascii	"\b\241\242\305aE\213A\304\275$\305 b\031\230\332d%\246\032\264"
+	.ascii	"b\266\302\f\326\037a\265?\202\307\376\210\033\373'\352\021\363"
+	.ascii	"\304\320\354\200\020\363\370\224\364\370\262#\323U,\222\344t"
+	.ascii	"T\3252\254\262Z\0224f\354\213\r\f\234\030\342\035[\025)a\300"
+	.ascii	"p\261A\203\214\325_\212?e\322\216X\375\0211\366;\250\242\306"
+	.ascii	"\345\216xG\224#j\261 \210\b\205+-\304;b\234\027\242\035\261\013"
+	.ascii	"\021\217H]\247\304;\342\026\342\035\221\n[\223\020>\340\222\034"
+	.ascii	"}Y\204\372\030\b\263\217\201,Y\344\320\312\260\372\030\220\333"
+	.ascii	"\377\211u\304+\353\224\210\205h\205\2168\266\025\235g)\021\013"
+	.ascii	"q\2168\026B\265)HSU\007yeqs\3651\320\265\217\201\253}\f\024\331"
+	.ascii	"\307@t\037\003@\3661\240c\037\0036\366O\204{\313\001Be\314\325"
+	.ascii	"V\024,nm\3007-\263;\266\023\333V11\037\\8XM\234\302\341D\266"
+	.ascii	"\341\332\016*\253\007\260\"\335\237\270F\224R\327\304\315\t\253"
+	.ascii	"\211R\276JE@\366\306DG\024\242\032\361J\206Z\330\331\211j?\021"
+	.ascii	"\215\230\266JE0l\302\004\310\n\253W\036k\215[\263\"\335\266\213"
+	.ascii	"\303\211g\233/\312\213\036P\356\246\245\030Q\362c&\314\262\323"
+	.ascii	"\033\362A,#\222\265F^\340i\t\256\310\361%7\366f\024$F|R$\213"
+	.ascii	"\206\351\362\026e\232:\361\322\302\213\035\253\301\2048\316\334"
+	.ascii	"\334\302\210`k\r%h+\366Ru~\322\204IQ\231+^\332\275R\275\372\372"
+	.ascii	"\"z\261]\350\370\212\210^+\037\333[\024-K\224\350\320\341$\214"
+	.ascii	"\325D\351\2132CRX}\f\024\355\257Sb\027W\n"
+	.string	"Qf_\266N\344\312\262\242\005\fV?\fQ\353?\020\276\242E/N\2138dE\036\333\0271\213\210EFKn\215\325I\202O\302 \371`\365E\220\331g\177\330\250\304+\342\021\242\221uJDB,\242EDB\004B$\363\232B%\"!F\211V\255t\310<\343\370\361F\231\260\3260(\016\2715\001\263\365E\324\355\237hE$\262\366\242\355\007\017M\343I\332\024V\023\207\020\233\242r\320\250c\365E\270\005\361\216\t\245\354\223B"
+	.string	",P1\002"
+	.ascii	".\f`\346\030\302\n,,c\235\017\031\006 7\231\027\334\304\315\034"
+	.ascii	"&\264\351#\304\200!(\313Mf\0137\231\312'\020\0327K \252\330\351"
+	.ascii	"\211G0\233!p|L@\367S\026\201\343c\002\372\306&\230\317%\324\204"
+	.ascii	"\017\211\231`N\223\331l\372\214\200\206\270 '\233\361\t\022\344"
+	.ascii	"\330\004\033#\006\021*z\210*z\234K\233\353\244x\366@SH\361<\322"
+	.ascii	"\310\314f\b\242\207\n\256\263a\371D\3464\231#df\223i\344q>K\300"
+	.ascii	"p\023\3131"
+	.string	"\211\242\t)\230%\3344=\304\262\362\206\271\243<\201\001\332\fq\303\354\031.\227J\344S)\223\270\020\313\314'\212`\n*\214\020A\002\t\314\033\022T(S\020\021\313\312\035\237\345\216\362\303\205\370\351\\n\260\304qo\240M\037d\274T\356\364\304#\344\247\022\331\343\224I\304K\345\263\304\f\364\030\357\230P\312>)\024@\216\241<1\217\333\241\203\230\005e\nA9\031\3630K,\345'P\216I,\345\247\333\003M\001\n\307\313\246\362\304\215\007(\364\310\363t\3424C\\\220c\022\320\020P!T\beB\237q\2171\b\002\207\240\254b\004\034\037\023\320\231\020V\270Q\306#p|L@a\032\025#\3344\2318\003h\242p\336\310>:$\202\327\3310\202\263\204\034C\343\021\027n\234)\224\300\302R\331\203\224\2231\017S\016*\345\235\030\004\013Pe\t9\316\231y3\210\270Q:Q8\341A\216s"
+	.ascii	"\360A\216s\b \307957\361\223\351C\202x\204\034\347\034\241= "
+	.ascii	"v\224K\035Y\311\263\201\fm:\227?\034\271\311|\356\270\320\020"
+	.ascii	"\320\020\310\024$8K\310\317\370\204\r\317\207\035\0176\327\331"
+	.ascii	"\340\354q2\237\312\f\334\304\262\222\207)CI\220\343\234\343M"
+	.ascii	"\210\024\316\021T\214\220\3029\302M\223\211C\224\343\234a\274"
+	.ascii	"cB\271\303"
+	.string	"T\236\360 ?\235\"\240<\316f\f\"\226\225#\344\330\004\232\353l\220\231M\246\034'\3458\247F\206A\310\261\tK\371I\274\316\006\0227M\346\b)F\310q\316\314S\351\034!\3043~\372\310K%\216OS\231\202\034\347\034\257\263\001j#'\343\026\230Pwg\307\247\331t6_\024\316\247\216\354l\2768\312xG\307O\237\036\335\214w\2362\324\315i2\2372\211\342u68q\232\314\344\022\247\231\303$!\3079\302\013\342$O\360&D\334\243\242\204\3172\0059\316\021\336\304\3158\036\001\252<a\271T\322<\235\2623\205\fJY\tb\310\204BG\310q\316\213T\261T\346\304(\310q\316\205\024\3448'\350A\216s\202q\222X\224\343\234c\234\274\t!'\215q\362&\204|\243\214G\030A\340\020B\260C\007+\3042\363\251\001\034\037\023P\241\314l\206\350\201\362\274\307\234\247\007\035\231\251\201"
+	.string	" \207K\347\316\216\207\231\f\036z\240<5\3018\331\003\375\320\f\201l\226\320\003\345\261\221c\022\313\022z\240<\025\310\315\230\307'\347\351\301&\276q\2460CB'\307\307\371\324\221\241P\245\210\233&\263\204\036(\217\005\361\2153\005\270Y\302\210\2328i#\033-\220/\3105r2\207\211\203<\200\\3\224+p6U\310\314\035\245\017\tfn\230'\240\305\246\3162\351\304i2O@\223$D\230@\324\371\300\343\323L\222\020a\002\020F\306<\316\023\234%\2307I\022\"L\230\221\335\344s\203%\016,\033e\032\013\016"
+	.string	"\215y\224\027\270a\366l\021\307\017\031d\244\\#'\241\317x\307\207\204\232\370\306Gf\312\262r\313D\245\254\004\261|\272\262\363\247\302\360\202\234\243\344i\345\345R\331\366@yh\b\020\200\002\364(S"
+	.string	"\021\302)\177"
+	.string	"\341\301\006z\023\342\003\364&D1\0037\261\374t\366\364\370@+\240\241\271\316\206\rr|L\3047\277\0212\323\004\371\351\324\201\032c\036f\211XV\202"
+	.string	":\237*r\364u6lp\263\303\3641\021\363(/"
+	.string	"\177\220}T\370\320\003\345\251\340\346\251\374"
+	.string	"\202\004"
+	.string	"\276T\261\323\023\217P\361T\362\360\370\220\320\201*wp\224\262\022\204"
+	.string	"\276d>\343f\234\263\357\001\b\f"
+	.string	"!\204\024\357Cx"
+	.string	"\007\017\340\300}\b\017\340\300\341\001 p\330\007\201C+\313\262|\201\231f\t\"R8G\210[`f\210\223M'T\031\217\340y:Q\210\223\320\034\345N\t\361\216\t%\224\t\202FN>\235r\017\363\271\204\306 z\240<\305g\314\343\003\225\241\261\017\t\342\021\317\370F\351\334\221\235N\023\027\342\344\236\221\177*\224\317\247\007h\274\3433\302F\276\316\006h\362\031\247`\362\274\317\270\307\251\177\262O\217\354\343t\2132R\346\211e\250\n\0223\362u6\254\360BW\270\201oB\260"
+	.ascii	"U\312\256|\235\232'\363\006\bM\3121\013K\245\210\036(OP\276\316"
+	.ascii	"\006\034\037\023<\312\370)\013\340\246\031\267\320$\216\217\t"
+	.ascii	"\250\373\224{Z\034\037\023\355\r\317\262\205\346(wp~O\367)\213"
+	.ascii	"h\312P\247\210\036(\017R\206\256p\204\343d\t4[N\n\205\0310\306"
+	.ascii	";&\224%N\270\362\323\331\003\307I\025\344\247\263g\bu\276\261"
+	.ascii	"\254\034q\343\2434\261\343\026\230$\342\026\230$\266\274\237"
+	.ascii	"\302\033e|\302\016SY\342\031"
+	.string	"\343\340\370\214\220B\026\236`\306\313x\004\006X)+A\244x\022\237\262\210\020\361\316\rSx\235\r\315g|\302\231c\214o\234\373F\031\237p\346\034c\036\246\234\354\361\331q:{\240\311\023\316\234\2472\316!\3660\341%sg\251b\246\311T\346\3304\231\312\234\023\316\034\001\310P&\024\252L\3560\225r\362\2043'\303u6\304<LYV\336$\203Oe\254B\353\310M'\317O\205\362\246\205>}\234:?h,\3734\231</\364\246\351\\\306\320\027\312\334\331a\362\270\327\331P,\032\217P\246\263I\334\211O$q\226\301\034\245\234\\:ca\216RN>w\226)\222\316\247\322\304\360\206\331\023\344q6\343\233$\024z\303\3549\306\313f\374\214q\342'\215|\"\276\311\351)\202\370A}F`\366@\335\034e\211&t\351B}FXv`zXv`\302\361\013,\021\237p\246\340|\252\310\271"
+	.ascii	"\247g'\t\365I:\345d\013:\305\026t\214\0348tH\266\240C\323!)\343"
+	.ascii	"8\241\030P(U$\213\303c\334\243B\276\200\324\221o\230(.\220 h"
+	.ascii	"|\306P\025;\312\246\322\346&\206~X>g6\n\245\n\341MSi\342F\031"
+	.ascii	"\337\034\343\234\035\247NR\336Q\322\334\304\320g|\"~\242P\252"
+	.ascii	"\240\271\316\006c\262\347].\225\311\233\247s\031?\341\246\223"
+	.ascii	"\t\205\306\317\036\036\3472H\224\257\263a\003'\363\202|a\206"
+	.ascii	"\005\2502\205\246\017\2160N\312O\247\b&\334\003\345\221\225\317"
+	.ascii	"\024N\023,,\225;&l\240OgO\320'Y\363\214\345\245\362\251\324Y"
+	.ascii	"&"
+	.string	"e\247\323D\3744\312=\261\f\325%\244xf\210o\234<\372:\0336\b\200\361\210\302\271\223\004"
+	.ascii	"\021\007\307\t\245\211\237>7\361\322\371\354\231Q\361\214O8\227"
+	.ascii	"\361\363\302\315\216S\007\032?u\344$\013K\246\fM\3068J\350\016"
+	.ascii	"S\211\203!\247'\305\023\356Q\362,\237\277\233\370\230\"\336\351"
+	.ascii	"\361\001\201\263\243\324\201\343\033\346\263\311\274 \231\343"
+	.ascii	"\263\323\203\341(\307\320\370y\323d\232H\312Jh\222\307\347)\263"
+	.ascii	"\020\367@\001 \214w\224KX~\306'\232\314\345\363\206\311\363k"
+	.ascii	"2y6\013\313Xg\231B\311\263\213\320\035\345\211\246\223\031b\371"
+	.ascii	"\274\320d.c\250O\212g0\231\302G\231L\241\344)B\335`\334\243B"
+	.ascii	">f\020\200\354\323\323d^\210O<\343\033\013\2229M\346\362\211"
+	.ascii	"\241'\346Q>q\222\313'4\311\204B\237\031n\230I\231\331\364\031"
+	.ascii	"v\330I\361\204\026e\250\022'y\343\2434\221\204\372\230\200\022"
+	.ascii	"\237Mh2\305\023\007\372\\\026kZ\320Y.\225\260\363\031w`\271T"
+	.ascii	"\276\3623\226c\036\347\214\017N|\223\224/@u\2262S\304"
+	.string	"M\323\303\316\216\363\211\204&\225\262\022\004\thO\316Q\346\371 \357(\177\320\344\322\211\002\264'g(+w\332\246s\247\325\331\331io:xo\342\270\207D0\206>}\234\037n\232>\316g\216\260\307y\243\243e%\t\036\237\246{\235\r\320\236\234\r\234\314\236\234`\f\355\311\031\366\3548\t\3077\316\024\240J\023\320\035'\213N\331G\t\307I\017\320\236\234\341\215\217r\004\247\354\243\334\316x\207\271\243\314I\306P\237\2328\031\3378S\b\3067N\036b\274l:\223r\223\351\354I\306<N\235\244\034C\223\320\236\234\0137q\334\003M\336t\220\214\241F\0252\363\231\003U\232\200\022\345\023=\311\023\312f\013:\316\035\023>IhO\316\261x\223\314Q\362\f\2239J\036a\220\230\\v`&s\224<Eb\023\272L2{\2029\312\022r\217\317S(\313I\234\370\346&\226\343\235\036\036\347\007\032("
+	.ascii	"|\222P\036\346\263\004\210\032\3473\356@\216\222\347\225}\222"
+	.ascii	"G\036\247\f\365Y&s\224<\310\241|\235\r\033\344\364\330<c\036"
+	.ascii	"f\211\233\330\346D\f\"\226\225#\204\306\246\223\t}\306'\232!"
+	.ascii	"xP\2108\362\240\020q\023/\233*\240\315\025b\250\017Q\206>}F\210"
+	.ascii	"\241>C\025O9\346\211w\342\022G\250\273\343\\:e\347S\204\374t"
+	.ascii	"\366\330\3444\225&d\346\b\262S\007\n\"\206\372\024c\237\035e"
+	.ascii	"\006T\210wnB\354(ef\016\363\306\246\311\344\t\246P\362\004o\232"
+	.ascii	"J\036\036\347\262\311\344\201\235\"\2108=(\360\364\214x:e'OP"
+	.ascii	"\206\016 \336Q.I\024\217)|\2245\317Xn\306"
+	.string	"\037\344f\314#C}Fp\2434\312\327\331\220\302i\"y\023Bn\306M%\3173\356\tB\223)\234&~\277\230Gy\201\024N\023\257\354,q\023\263\320d\356lh\362\246\351\374p\202)/=\3047N\236\fq\362&D\n\247\211\367&D|\343\344q?\244\360Q\026\345\233f\374B\223qNS9\202\330\023\313$\344\247R\206\002\343\234\246\362\371\213\223\301%3\307\211B|\343\344\001B\223\302\026t\222(\224*\210-\350$\215-\350\334\020\345\353l\270a\366\224\260B\22387\314\036W\304\032b\005\261\3360{\332\243\334d:E\364\370\3344\231\032\270\020D\241\344\200\017\211\033f\0171\336\311iz\330\211O\304;Ey\031\343\340 \345g\334\223\"N\312;L9\331t\266\300|:u0\214@\241Tq\214e\345\223\330t2e&\264\251|\226\270y*Q<\235%\334\3041N\215\314\344a\242"
+	.string	"\267\240\223<\022\343\036\025\262q&\205r'~2\2039M%\006(3\205\362B\223\251\3149By\2227\312XG\311\202\323\271\223|\306M\246\362)'\235\317\2452C\223\251\3141^X&\241&\2243\035fZ\320I6\231-\350\360<c\371\206\246\005\346S\0317\231(\310P\037\250\323i\"\211\203\263{v\234=88\307d\n%O\022\007\347\310\002\263\007\232\304\301!>\235\362R\211\223\324\221\235N\036h\022\007\307\350\354I\021'\343\023O\237e\022\247g'\331Tq3\003m\306=<\316e2G\tM\312J\023'jp,\260\343\304\261@\f\335\361\021\261\343\374\200B\251b\210c\201\245\212\017(\224*\266\f\365y\352\224\210\241\312\021P(U\fI\020?q\2221t\307\247\207\207\231\304\301IV"
+	.string	"U\241D\261\243\234\211e\3453\251B\271\214o\222O\347\363\031\033\343\235\035\3472\031\373,\241\361\363\330d*shb\036\246\214\302y\323d\242"
+	.ascii	"@\013:\311\344\323)+O\304;\361\214|\235\r\033,qb\036\345\005"
+	.ascii	"z\202\261\254\034\201\204BcY9b\371|\235=)HX>]h,+\237\277\270"
+	.ascii	"G\205\214\354I\356\310\262\363\251#\333\310L\036\346N2\226\225"
+	.ascii	"O\370:\033\240;\316\247\334t.\225D\236\2472)C\237L\234d\323\231"
+	.ascii	"\334Q.kT(w\342\233$\317S\te\336$\235\262\217\362x\235\r\312\003"
+	.ascii	"@\223r3\3461\356\3548\237A!4\216\23791\b\024J\0250\n\345\263"
+	.ascii	"\275\316\006\037\036&\206\235\035\347S\353,ef\317\017\205RE\013"
+	.ascii	"\215}v\224'\334\353lH\361\334 \305\023)'\341\270GE\211\r\214"
+	.ascii	" !t>E\244x\356(\231\317\030j\024\306\262r\204\0164~\342\304#"
+	.ascii	"R<\207OYD\023\205r\3043\370\224E\370\310J\231\304S\026\201\204"
+	.ascii	"&cY)\223\210y\230r\323gD\212\247\261Y\002\024\032/\235O\021\313"
+	.ascii	"\247Q\216MX>g\232%\360(\237%,\237E\245\254\004\261\0237\233J"
+	.ascii	"\235eP)+A\304<\312'\016P\276\316\006\350\006<\314\247\254\241"
+	.ascii	"I\036\345S)\302y\342\031C\205M&O\233B\311\323"
+	.string	"\3360y\332XV>5\t\342'\216\354\334a\366\fc\036eS\307<\312\013\004\257\263\001\nU\366\3608s\224<\277\017 <\344(y\334&sg\031\203X2\345\270\231\243\344A^gC\274\023/\227\312\002@\223\313\245\362'/\343g\022^.=\320,\227\312m\002\207\344r\251t\335\345R\271\227K\2450\276q~8\021?\205\317xg\207\211\343\236\210o\332\017 <,\227J7^6U\220\241\312\030\005\331\303M,+ozV\330\211\227K\017Pf\206\345s\203%\016\217\314\034!\205\323\204\020*3M\350\035\245\217\374df\300\002\fr\f\305\301q\272\3623f\356\3640\345\035\037\036\232\017 <`\210w\224K\250\2544q\002\270\243<q\202y\003\215\237\262\322\304\211\341u6\020\267\f\215e%\nq\216\222\330D\241|\202\320\361\300\263\257\263\201x\023\337\024o\342\246\017\214\203\343\224}>d"
+	.ascii	"\205s\307x\235\r\001\200&S(\233L\236\031\0246r3\206\306\317\036"
+	.ascii	"\331\331\224\225&NdX\236\330\031\306\311\2318I\023/\237>N\022"
+	.ascii	"\317X\216S\220\233\361\363\351\263\234Q!3\227\312\036\245\211"
+	.ascii	"\242\254\034!\0031\324g\b\225\237\361\216\207\0171\324\207&\316"
+	.ascii	"Q\312\315x\371\214E4\235L\271\207\307\007\332t.-\2002\241\361"
+	.ascii	"3\226\241*td\245\211\023\3048G)\3578O\354\354\304\313\235\035"
+	.ascii	"\037\034Yi\342\004rg'"
+	.string	"\376\240\342\031\313\262r\204x\371t\342\324\250P\356\364@\23147N\3463\026\201\323\203\202\2544\301\034\3464\231\315\247R\0036;\312%Sf>?<\235%\200\220\225&N\\\270\316\006\013p\212\320\270\204\233\"4\351|\252\310q\3458\347\251\224\211r\262C\0071\017S\356q:Q \342|"
+	.string	"\341!\310\343C\002\250\201\033\022\232(\2347\0278\224\020^g\003\002~\320\244\023\207Y\202+'\241+\304<LyCW\220\2411\212\270\271\241\256\023\207\211\243\345b\362\275\316\006y\351\363\224\241\035\240\311\024\261\354\303sda\351\334I&]\271\351\343\\&\223\3573n\242p&\223/\364\031C}\232\311\344\276i2YH&]h\223\331\003M&\337\246\223\te\356\304\311$PN\312P\346\216\361:\033\240q\217\n\231\0017\361S\251\003e\300\006P\231ib\003\237f\016\003R\3704\231;\f\360"
+	.string	"\204$\b!\244\330 \276\361\331Y6\231\033<\241>\0338@N\0217w\224\315g,7\231\311\033e\374\324\221{\222\311\013'\342gO2\351\312P\346N2\351*e\345M2\351\306-0\241\311\244\313\302\322\271\243ef3\204\314l2\335\246\013\255i\226\340\304a\226p\243\214\237\360S\026\261l\372\224\240\224\225 n\224\361\b\347S\205\t\031\232%\f\257\263\201)\247\210\237\361\316MSy\002SN\021#\345&\016\013M.\343\021,,\225&vv\224\037\230r\212\370\310\224S\304Z\206&\231=$pb\020q\217\212\022\311\020\"H\004\343eS)C\233\314-'U\b\241\233L\021M\350\322e\366@[h\362C\207\020\301\017\035B"
+	.string	"\335e\007f{\235\rP\037\023\031\240\311\024n\214\317X\206*y\\(4~\336\334(\337\370\204r\207\204O\017\317\366I\236\210o\240>&64\031/\231'b\020P\037\023\3018\031\367\250(\001\3651\001\214{T\310P\037\023/\324\307D\033\357(\227\320\237\363\031w`\177"
+	.ascii	"\341A\304\f\n\345\210\017 \340\370\351#+\237q\017O,\007\345\353"
+	.ascii	"l\360\351\341I:\237*r\226K\345\006\320g|\202\371\274Y@\234\034"
+	.ascii	"\301\301\007\034\200\340\323\303\203l:\231\262\317\216\023\032"
+	.ascii	"?ah\222&N\372\364\360\004\345\035\037h<\"\006\341\323\3033\023"
+	.ascii	"'\2339\314\035e\222\330\314a\356xH\016[8\301\002\261"
+	.string	"\254\034\241\342F\031\217P\312\312\033\340\023\212\223\324\311a\352$qzv\2048=;\311\026tX\350\320\201\316\f\264\307\371\004\361\214o\230'\230 |zx\212r2GY\302\311|s\224%\230r\n\022\344f\b\237\036\236a\234$\306O%\212\233\247\362\004\236\025\232L\366\340 S0\237\2622\005\331\371$\032O\274\262\234\354\320\201\334d\2769Mf\223\251\344\211G@\343\235\245\212e\021\232\374\340|\252\3109\362\370@[\371:\033\240:\262\222\247\231\344i\241\311\023\361\215\f}SH\201\304\315\2163\311\343\222@\0217\223<\356Sy\2425\301\334Q.\203\035\234O\0259AY'\207\031\243p\241I\241|\235\rI\002\334\3548O\350a\356,\213\320d\t\316\247\212\234\231\035\3474\225:K\367E\241\034\001\365q2O\304\317\236 \224\205\245\217\f\025\272Me\234\002\016\016\363f\307\313\246\222\371Tf"
+	.string	"\007\207y#l:\231P\037\034W\206&O\304 N\304 H\240P>\205M\246R\347CP\356"
+	.string	"e\241\3118G)\223\240\341"
+	.string	"e\177\320d|\243\\B\225\037\212r\323\307\371!\316Q\312Px)\244\331\031\326\310\327\331\340|\252\310\331"
+	.string	"\372tB\2331\264\202\243O\022\005\347SE\016Rfa\205&\203\261\254\224\241?\016r\017\261\003\024\252\354A\341\334!\326<e\021F\031\232\334\035\232%\250\330\351\351\361`C\224\257\263\001g\203\246\223\207\247\203\n\026\232\274Q\372\220\200i\202\310\201\t\226\203\t\266\203\t\226\203\222\355\240d9\244`;\244`9\250`;4U\200\320Y\312\316f\261\205\023vzx\224$\226Ke1\206\256\340,\341|\252\310\001\3067\316\024\232N\246\274\214e\347S\204\nP\345\t\316\247\212\234\f;N\347\b\311_N\223\231c\302\216\322\007D\f\365\241\221\223)\342\233&3\t]2y\224M\0257IY'\207\271\203s\001\312L\341!\307\307D\f\302\371T\2213|\306\362\016\263\004a\223)'A\340 7\231>;\2052\005\234\036\024\232*n\200,@\225)@\231)<\240p\356\340<\343\023N\343u6"
+	.ascii	"\340\316\236\370\271\201\354t>7\bB\223\037xb\031\252\002JL\021"
+	.ascii	"\3374C\3340{\212'\230\362Ry\214o\234<\311\034\037\023\361\r\f"
+	.ascii	"]2e(SV\312\320$\013P\245\\\324Y\312L\024$\240N\021 \304;L\034"
+	.ascii	"\347SD,+\2375,,\235;\313g|\302\231\364\351Y\016c\036f\211x\251"
+	.ascii	"|\232\320T\341\031\243p\366\330<c&\016Sn\3067!n\236J\247\211"
+	.ascii	"b\013:)\304P\0357\226\2252\211\246\223)+\237>9L\234\246s9\023"
+	.ascii	"\313\312\021q\013L\036\246\334\243\3023\336\361\271\211u\226"
+	.ascii	"\320\0329\031\202\334d\372\274\347\300\341\303\005+\\\300\204"
+	.ascii	"\275\334\320\003\345\331\240\007\312\263A\223\251\344\331`\371"
+	.ascii	"\204n\260\201&\247\311\344yz`a\311\224I\304;&\224\315\370\370"
+	.ascii	"T\352,\365\377\013;\216`JfeV:\242+\264\031\t\312\001\007\002"
+	.ascii	"\013\0162\027p\034\263\272"
+	.string	"\202\254m]\210\272\020ua\252,\204\0136~a\352\302\r\026\213\024\026J\027n\\\220*F\351\350\322\362\033\342\025\345\252\004N\366\177\001\252\255E[\352\322\344)\313\246[\252\262\242\006u(\344mG\020\rd\231\242\2274\212l\006\r\020\353d%\353\210\323\033\035\312\3418\243\223\241D\214\353\352\353\321$\243h\243\253\307X\f\032\033\304%}>\252L\310*d\\\350f\300\300\361\305\205L\231\245\241+T)% ,\337\223/V\222x\020\237\fM\301 \375\340\266\223\273\270\242\027V\253\217\036+\246\216\314X)\264\030\\F4jL\306\374(\232\242\241\310\r\265p1\267J\351\232q\327\202\t\033\005&\257J\204\245m\n\023\305\216\205\335\205!\032\274//\270\332.\254(bU\331\350Z\260\372\002\320\205\240_\020\372\005!\366\202P\333\327\347nY\001s\365\205\331\203\276\013?\2770_:\027\367\212\353J"
+	.ascii	"\326J\f\006\237\253\313\224\261\321\333?\363\\\002 d\310\330"
+	.ascii	"\350\021\257\362n\243G\343F\034^\261\253\025\312\262\245\211"
+	.ascii	"\325/A\222\315\027\233/6c\262<\201\271\315\0301A\026L\242T\211"
+	.ascii	"\tS$\206\372%\270\245%kI\013U\033;\033;\033/S\356n\343\305\206"
+	.ascii	"\n\305\004\253\013\325\246KW\020(mR\332\2717\036a-\254\331\324"
+	.ascii	"\331\324\331l\321Z\200\r\226\333l\261\321\262\376\320\241c\317"
+	.ascii	"F\213M\026\342\235\032\320\230\335\302\211\r%&6Ul\252\330\320"
+	.ascii	"\325=\331\310\335\206\316J\025/@l\254\330\314\005\333\344\326"
+	.ascii	"\314\330+p\325 -X\331\270\331\270\331P\271\021\bY\265\201\273"
+	.ascii	"\r\225w\351\221\231\262\332\346\2158\026#\215\305\226\026f\354"
+	.ascii	"(Ql\330\200?\363\374c\234\203\266<\231I\271\r\333\024\242\225"
+	.ascii	"\032R\262\246\254\255HT\312\234\ba\260i\371\"c\223\266\263\236"
+	.ascii	"\030\tc"
+	.ascii	"\365Up\331\277\r\232\r\230P\f\225\227\2603\232>\342\212\252U"
+	.ascii	"\021(5BE\252 [ef5D\305\331\bJ\250\254&\311\016G\026\0302\243"
+	.ascii	"\323\335\020\263\033c\305.ye}_\304\220h\233-\b\023\r\233'5L\272"
+	.ascii	"\312I\034\030\233\3511\312S\324J\237\223\032\032H\242wy6a5T\277"
+	.ascii	"\031.\322\222h\362t\020F\021\260\274&G\250\251/wgLj\344X\"A\212"
+	.ascii	"\324\370\232\2512\324rK\302\3455\203\330CNJ\337\222\030\032F"
+	.ascii	"\223\031FJ\216J-\337\f\247(\351\f\226\342\020T\022\021\233\256"
+	.ascii	"\243(kch6\\G\027b^\340\266\216C\254\\\224\2278\255#\020\373#"
+	.ascii	"\210\236VV\261Nh\306\365\305\005\326\314\035\224\035[\262\260"
+	.ascii	"zHe\245\326\202\214\001\263\2712\362\025\241\2111BRt\202\231"
+	.ascii	"h\321s;\222G$\210\313\315\210qLP\211\331\324\253HQG\027\226\261"
+	.ascii	"\331\252\330\243\210L\016 K\300n\260:C\273&\245\312\310&j\364"
+	.ascii	"\362N\223\240\331\331\b1\276A\021\311\370\301\352 \352^\fV\377"
+	.ascii	"\320\274\240\332X\235$\365d\304j\031X^\214\3700JA\222Q\243\256"
+	.ascii	"\207\021ml\007\325\024\253\201n((\343d\210\315\216\262\240)P"
+	.ascii	"GX\275jY\371\311c\265T\353\307G\020\033\0343`\334\302T\331\301"
+	.ascii	"jb\325\213\036PS\306\260`\337\0170^7\214JnT!\231\222J\222\344"
+	.ascii	"\213H\023V\250eJ%\214M\224\321\310V\f9\250\2311wKX\232<\031\207"
+	.ascii	"`P\325\261\244FU\260\013\214\252\013\215\2312\003\250a\2056\003"
+	.ascii	"\371\363v\205:u\242\022^I\213\354\220Q$\002U[#\263i2J\005\235"
+	.ascii	"\304\030jb\023\003\211\324\364\204\305\205\264\b\330\325\025"
+	.ascii	"\030EM\252dKK\306\247\033nB\224\230\334bH\211\330$!\243\260H"
+	.ascii	"\3450BB\342\310\240\t\217\251\315\013;0Ooi6GH\037tOD\334Xm\343"
+	.ascii	"b\265qQ$\372\222\232g \033#\233\242\333\270\270\b\214\250\214"
+	.ascii	"\\m\023d\023dCTg\364\272\031\035\211\262\021\272\215\r\213\257"
+	.ascii	"\251\026SlX\330\f-1\272\201u\243\207\333\227'6+\204Oc\306\342"
+	.ascii	"\372\320\366\366l~\350\264\312\334\346\307f\036\342\300\"\225"
+	.ascii	"\304f\356\213\002&\345\366\005X\006\264\303\006\0370K[M\243\373"
+	.ascii	"\261$L\230\232\274+\016\262\202\266p\211yM^\r\031\245."
+	.string	"\27442U\032`G\246R\326\034RX,\215\001\226\255Ic`\320\365\330ww5_x \240\210\321T\265\313k\276\340i\271\312\232\252\301\253\361\362ccJ\025\214\005b\026\245\214\372r\021\261\204\bY\001\265k\270\350*T\030O\254\276\212\244]\243\005\256N\205\321\236\233\253\301\262^ 5\317\3219hN\313\213\325\304\345f\3455Xj\352\244\274\340\b\252\253\271\302$\346KL\216\241Y\324\213*\272\342\023\233\245\256+N\305\317\236y\273br\205Z\245\030'\243\211\214$5qE820%T\214H\372\256\207\222\0258\243\021\233E\256:\364V\263\005?\221\"\rs\2337\223\225\272\271\266\032\255UH\037\225(lF}B\336\262j\246\030W\330h\361\266\006tk]l\201)\223\022\003\306\222\322\341\"Jq\212\22591+j36\202H\317V\244E\321.\304\216d\2409\031\241m!9\233AJ"
+	.ascii	"\013#3(\305\"/e\364\346\314\204\270D\216\204\276\224\025\323"
+	.ascii	"\340|D\tC6s%\364\342\201\343\305\330L\026Uo\f\212\025\233"
+	.string	"\221\006\201c\362\366dFMS9\341qd:s\346\232!u5qR\304#^\241\356\215\205\315\020\031\001\317(\007\013v\004\323\276@\322\205E\223%*K\312xa2\263\203\310\220\232\030\253k\270j\270j\274>\003$D\003$hXl]\257\361\252Y\"\275\022\275\262\244F\311\021\271,|o/\223$wSV\327H])C)-\322\232h\331\307j\224\206\223\215\031\241\037!NMX]s\344H\r\326\232\2244\317N\363\017\236\006R\224X\021\251\316NL\032\376\232$\257\301\032\342\002F\216\3255WW\323s\322e\205\3255HR\304\355\277\306\210\226!\032\0308\263\"\310 /\306\250)\261\372\353\264\306\352H\347d\006\017*\"\307.b\240\204\f9\336\200s\334\271E\243_S\364\276\374\260B\302h~\272\214\261\272\006H\233\202\276\276\276\276\275y\006\252\001\302\326\004\251\251z\r\220\257+\001\326\225"
+	.string	"\305\027\313\025\021\220\253\377\232\037\3102\"&OT5>\216:\356vd\311\302j\351\253\244\213YZ\r\017\244\024o\006\326Z\315\016d\222.M\310\260X]\223\243&\307\221\256-\332\312H\223\366\261\372)\312j\236j\236j\250\212\034\345\211\251\006\261\342\236T\325L\275\206\352.\217*\f\253kn\024\305`\220)\242\305\352\032\251\"\030\231!\"\254~\230\032\033{z4\327\243\306FM\024\032\033\r\271\032()crJ\254~\n\351~\212 MM540\354\227^\250\224%\217\024'e\252$F\362 \006:\305\034\242\"\332\004\001\323\025"
+	.string	"0X<\032\016&\2522\253\335\024\200\017X\276\206hJ\246\017\264(\251\2242F@\b"
+	.string	""
+	.string	"@\002\002"
+	.string	"\200"
+	.string	"b\375\013P\354\214\251_\262\316\210y4r\334\314\266\357&\207jl\023d\364\233&W\264\037LX{\003\226\253\005\020\373\302\210\373/\231\232\336s\231\254"
+	.ascii	"9\337q\222r\231\254N\323"
+	.string	"=\200\370\346pQ\356\235\201k\267\367.\376w54\003\212R\260\364\263X}\033c?Q\236W\336gO4\222\272R\344X\204Z\340\037\035g\342\302j\330F\332\\\276\373R\225\343\255\214m\036#\251\033\301:\256\336\326\276\202K\313,\222\027\247\034\345\206z\232a{\013\362\3070\217R\247T\276X\240f2\245\364\222\305\301Jc\305\021\002\350\351Y\247\201S(\256\354\b\001tP:\377\332\036A=e5\315VUA\033[\214\235\\V\301{\347\244W\207eH\321\256\r\341B\t\233O\017cWh\325\366\024N\311L\264uh\"\213\326\020\026\361\240\r\24497\277\2101l\201\345\351|\234\313\246T\332\257\304\036\215\237)\340\236\024\322\017\263\002\333'\274\316\316\220\022kZ\240\275<HhN\343\377#\314\"\223\221U\371g\2079\352Z\033\033X\007qN\347\212\263\034\244z\003\276\273a\234\026\306\273\303\271"
+	.string	"\211&\032\257\233\232R\326\342\f\373#\253<\263\200:~\036\305\030\222M9&Z,,\016\355\026\241\230\212_\327\373:\254Sd\0326\377m\037\023I\225/?\332\f\202\004\222>\310\326k\004\325\253\211\3705\223TX\217\230\311\241\016\025\202\"8\304\302\310\211\363N\253\277S\373\245t\366\357Me\214\024\350\371\340z/\032tw\031\021\nf;'\362\002\245\001\005\340\006\300D\217q\207\275!\255\205\\\212\244/\004z\277<DK\b\361\255[&\330\200^\031]X\327&\351\324\247\344\332\315q\363\344\305\247w(\004\027\360\201:x\224\364\033\352\030\375\t\212r\\EC\377\360\371\0246\330\201\341\0134\262TAB\350\b&\266A\217\260G3\330E0\252\363\266g48O\272G\211cV\005\336\200p{'\272{P\254g\322\335_\027\213+\\f"
+	.ascii	"\230\223\027q\026D\255(\361N\031\264N\223\007\204\247\274\024"
+	.ascii	"\250\323\314R#\212+)\352"
+	.string	"\fI\347X\256\026(C\372\303.\034@\334{\235\216X\230S\023\311\230j\343|\367\215Y\n\344\245}\210\330\317\332t%\202%\363\026\313\240\331\307\317\224\336?fy4\242\245Z\376"
+	.string	"\f\250\254C\213<\234\214X\226\n\372A\201\006\020F\006O\222\0160ELzg(\376U2\026I&(\334\334\314\016g-\302[\375iM-\245/B\032N-\304\331\364h\006\243U.\213 \226xp$)\033\\!\247\341\313\255J\344\300\336\003\347!\337\355\016)\022~\277w\321\355y'\b\362\245\3545\271\021"
+	.string	"\274K\024\255P\260\316B\311\224r\\\315\317\221,\251\024\312\371\206\273C6\271\306X\303\2269\247\300\250\b\342\2245\311\233\3167'\tN\034@\343)\203\3057\\\306\020\007C\313Tt\347\231\356\322\322Y\252"
+	.string	"r\312x\213\331\275\337\301\026_\340\214L<\351\032V\253\246\253\327\362\233\300\350\007\326\214\036p\177\2070\022\277L\241Y2\354\272\366m?\346\037\224t\235\255E\013\3024\373Y\233:.\200\b\016@\\\226g\257\035<\332\264\317\026xv\357\376\203\340\312\214,:.\004R\214\334\324\016\260\271\271\353\326\035\344\240\033\212>\301g\027\352\331\353e\333E\"\357\316\317v\017"
+	.ascii	"wrp|\203\215D\250\201\267,imys\034\350"
+	.string	"rVt\005\367\242\247\034n\013\312\304.\033C\240i\325\260\345\321L;\243/*9\303\312\362\335\216\357\341\030\276\246\375\242\344\360\373\355\341\262\375\307|\277Q\244T\252\3478\222Y\247K\252\332t\216\221\370%5\244\202\023\246G\347\302(#O\376B\007\263ft\260\345\331\027\222*\311\226\t\273uMK\b\345-\310<\356\322u-\336\004\0334\273If\221\255*\242r!R\373\374\360\244\207*\244\020\363J::\222W\\\354\235\276\247\323\321\331\177\200\3659\032P\243\226qP\006\253\277\177A\020\316\374\365\315\253\016]bI>\302(\016\337bS{\225{\366\023\242z[\177E\341\227%\007\341\tM\256\301\032\201\002\377\301\245\333\220\362\334\327\224z\025\ri\r\316.x\377\255;d\210%\272/\321\327x\ni\333\326:1&:\020\232\330\332\232{\305H)\250\213\3579)C\377a\206\177\210b\346\247\020\215"
+	.string	".fa\302\276\334\177\237\220#_\216\203F\2747;n\224X\353*4\245\376\340\357o%\266b\276\221\324\255k-"
+	.string	"\007\036\004\370yu\312.\343\nz\004\370\255\372\307\306\025\315-uGw\207~R\311\030\206Li\177N\201\324.j;yy\001\232\314*\324\365\177\375\0048\221d(\352\310&\t1e\034\320z\314\356\b\026p_44\315?Z\276\232Z\206k^\234/\033\351\240\374A\272I\243\257y2\376\274\\\326.\264\201r\024\271\227e+\033\371\r\270\207\017\312\363)\250\324\027\367\212\336\340\361\023Zez\033`\344\366\005\301\3527\257\253d\033\323\325\342\2307\322^|\264i\211\341l*\301\254=E\3505\312,\006+H\220\205eg\232Lh\205-\241\t\354\376}T\204\367"
+	.string	"4\370\t\275\363n\0019\204\325I\3357"
+	.string	"]R\310\326\314\244\340\277\310\036\026\247>\343BB/!\262\302\n\254^\215%9\312\327#b\200\200Vt\223V\362\023\034\264\272\2277\240cuO2\310\320\320(\033\357\273@\004\350rp\325\036Bf\324A.\344\272~\216\333X\234\007\264\315\371\220!{7=$4\331b\224L$g\346\357E\360\370\0134\035w\027\350o\267\f^\362\236z\343\303\252\273G\r_\326x9\271\205\227\377\006@\334\243fD\001\352Ql_\326#I\341uw\303M\354\211}\203q\345\273\236\331f\310\365\022\360\230\260J\265\200\265C\343\201[Y\206\027\255\355\343\203\250[b\002(\277_A\037\212\366\201h*s\230\230\300\201\256~\002N\007\317\273~\322\222\n4X\352\004\022\264\t\2460\232\n\266K\201.\262\3557f\254\363"
+	.ascii	"\312\240\"\235\361\031\243n\032\257\f\354\367\254\366\274\314"
+	.ascii	"\371\203\310\344J)\365$\250\274\255O\360\233\306\252\217\022"
+	.ascii	"\264\0275K\367>Z\007q\344d\372n\271]\270\006\276Ex\250+\"\007"
+	.ascii	"(\200_\247\230\347\331V\2156k2]\236\204L\\\276i\365t:]\346\317"
+	.ascii	"V\335x\260\021\335\202\251\024\007\244F\372\300m3V\346\fX\326"
+	.ascii	"6O\364\340\220*\246\222^\267\301\245(Z\035\323=2\305\305r\263"
+	.ascii	"w\332\034\2561hq\217M\300\261c\262\030\327\314=\016\223\212\275"
+	.ascii	"\211)\361\305gC\331\002\204\207\223\321\301\250\337\303\334/"
+	.ascii	"%\243\341?\244\377\24598O(\364\203\243\373\213\241B\272\t)\320"
+	.ascii	"@C\301\375Aq\210\344\f\342\227z\031\316\"\3109Pm\375Z\220;\r"
+	.ascii	"\221\030!\006_!\212\370v\301E\315\214\232\315S\035\025~Tj-\305"
+	.ascii	"i+v\027>(\255H\276\345\207fz0\325\017\300\037R7\251PU\301\316"
+	.ascii	"\366\032\371\270I\363\374\025\336d\330;\274*\264\003t\203\226"
+	.ascii	"U\2641~\251;\266)\326\206\007\326\271\024\2776\337\375T\274\312"
+	.ascii	"\325\236u\030\227\226F\364\373\223\367\374\bM@\255\362\274j{"
+	.ascii	"\260\241\325\024q\353\300\005\272s\300\244\361\203C\2014\340"
+	.ascii	"\254\223`\262k/\310\020`\200\272A$\331\202\304,\200Y\337k\232"
+	.ascii	"j\253}\251\303\224\234\346\270\362\3510\206[r\024\211\204\312"
+	.ascii	"\\\371f\3742\315w\313\263j-Z@\203\315\363BhR\nH\177r\230\312"
+	.ascii	"\357\215\360=`B\177\307I\271\0252c\317a\211u\270\255\037\201"
+	.ascii	"\027\261s8\016Ju\337R\337\2108\373\204R\347~\320\273\357Cd \253"
+	.ascii	"U\305\236\367!W\323\336\016\362G\370+\377\037 sP`U.\036\030\""
+	.ascii	"\347v\353O \202\022e\250\271\331\031\265E\027\fO\200\024\\\245"
+	.ascii	"R\275\035hM)\373\252\002\250\262\030\3056\370I \251\262q`\001"
+	.ascii	"\036o\363\204\313\372\364=\263\022\2472\240\260\031\210h\372"
+	.ascii	"q\\'\300\261\037@\234\227\264\377aWP|NnG;\005\031\250T\234U\374"
+	.ascii	",\355\361\343\301c|\326\213\211\347\327 Z\253z\2111a\3645\220"
+	.ascii	"A\300\223\231j\246#\005\347H\205\001"
+	.string	"h\247L\315vE<\346\271\320\372\320J\326\330\375\206\237\320\034\020#\r\006\275\316\017\317w\323\001\256\f\361\225\361.\"e(\032\001'\364\016\233\210\r=\261-\326\344\262\n\350\336\212\226V\024\277M\266\275\024YN_\224\273\f\327\177q\245\262d-'\3044\214\242\200\202{M\374\212\240%p\231\004\241D^\237x\230}\363h\306\214\003\005\277V\330\224\327\241Yv\231\245\244^\312[\215\367\226\025\214\305\301\357\272<\243g+4\204\333 H46!\223\006\270\264\r\247\204\f\340\362I\345\304\323H\310v[\203\277e\344\226Z\266\322\246=\331\303|\317\r+>s\245NV`t\034\364\315\256\240\265!\337\022(_\256\354\312\350~9\020\037\263\322\020\236\236\036\241q\377\n\270\001\272C\321\236X^{[D~`{3h\361^\263Gk\337\276\324\213\234\313\030\253\r4\323\275\034\320\004\302*=\t~nq"
+	.ascii	"8\021W\250\235\300q\r\357\3535\361\037\313<Qk\026!g6fsK\002("
+	.ascii	"\372\205@c\002\275$*{%\030\240S\237v\366t_!\3714\275&F\272*\030"
+	.ascii	"\205:\233w\243\270\350_U\373Z4\324.u\277&\353Kp"
+	.string	"G)$\372\364A\273\372\376X_\254\253+\332\236\200\305&\t+\f\022P_\032q\312\025\336le\346M\350{\325f-c\356\225\302\331`[\003C\267Z\013\203\337\31196\240\333\3678\226\252Eb&o\233~L]\271\003\250\033N_p\021\336\020\201\310\340\220c\254Iz\027\215.\324\r`W3' P\355[\225\223\343\214\203\n\003C2\260Z\346G\005 U\260\213\376\322B\032K\002\320\343\236\222\261>T@\333\256b;\203!\210\346\323\260\357^v(D\257\223\204\250\313\2157K\270iy0\250k\037\371B\226Z\\"
+	.ascii	"pc\363\225d\023\334\200\006\362Ft\203v\277\240q`\007\355\326"
+	.ascii	"?tc\031\026\341\373t+R\306\247\365A\322q\030\367R\334\375\363"
+	.ascii	"\317\003\256L\3436S\376\212\234 G\217vT\335\376J\253\253Q(.\321"
+	.ascii	"\316\225\\\325z@\367\236*\001\301}\256\311\022\332>\016\337\265"
+	.ascii	"\354\336U\314\244\026\3417|0H\310\024\274Z6ob\336\265\306,R\t"
+	.ascii	"S\362\375\034\367~\317\032\030!\225\025\n\344+\bA\310\030\b\t"
+	.ascii	"\bv\024\204\243\002\374]\253\222\362\361\026l`a\313\205\"\266"
+	.ascii	"\3535\366\266[>"
+	.string	"\034\247\302\255\316|\324\322\335\344^\375`\243\277\212\026\367N\273\343\250r\372$\265%\323\320\004\245\235\311\344\244;U\343F}YE\f\322\253\373?\026\307\221\234\226 \022;%\373\216pL.\r\016{\310\352\202\232(\254\231\204.\265\264\3714\303\226\2228\265(\t\3550\325\356\233G\365\025\233\332=\312\026\372\272\372\021\227\323\337\220D.\244\360\267\233\023\241\217]\332\252\007\255\234p\376\b\355Z,\n\2220!IR\02083\025\3056\337\276A\245\211\030\261\025^\354\365\304\351\351n\370\370\361\325\360d\021*\353\016@\261\377\223\265\246N\201\236;66\250\340\340\177\244w\004\252,)l\271T\022|\365\b\2068\021\212\250\360-N#\266Z\f03\f\310E|Xy\370=7;\300u(s\034\304Xhr\222\025\365\r\274\310\222^q\265(A\225\260c3\007^\207\373\003C\\\030\021@\355&-\027\006"
+	.string	"3\217\207\032\235n\270\233\252\246U\221-cC;i\214\307\325n\016z\226\362\262L\203\2047\361{\273\203 \317w\017\331\001m\300=\016\361Fb8\373b\370Q\244\364$<'/\tF\315\035\377-\364\3176H\0039z\001\327\333\212!\036:\262\307b5\265A?\021\343\240g\\\2222\300B~\306'\031t>\217\307\314\305\360[w\370~\222\00250\242\025\t{B\231z\377@\205\343G\024\276P\256M\301\216\365\025M\232\316\n`\316XV\224P\350&\036\361\246\250\036\274\361Pf\276l\003B+\244\216kA\261\316K\257\020\251_'\304\366\326\311\005}\b[\340\375ROh\343RNc\0206\231\354\303\300y}\207-\t\314V\3037\341\277*~'q-\336P\276\302\002R\346\026(\376O\350\037E\203pZ\271\370@aK\313@\001\202%a/\026\212\247@\252\020\326\001\216x\323\332\370Z"
+	.string	")5\rX\253\323\3031]\262\001\327\026\231\210\213x\321\016\354TF@\006v\342qYn`\266\251\340X\001t#p\340\003H\324\215\003:K\0176\366`Fv\024V*^\2733c}<\224%\201jk\254Pq\001EY#@\304:\322\345\226&\301\177\3109[B\267\347:\301\353\\\303\236\021_H\003F\257i=\210\033\370@6\214\352\211*\020\312\374f\276\322N\346{\317\365q\270G\262\236\204\234[\3230MamI\267\366M\275\343\013\230\361\202f\371\277vZ UL\243\330f\244j\261^\343\216\263\343\364K\f\032j\263\355\351\356\376\026`\270\252|\031\004I\315g\275\264\214~\031\271\331H"
+	.ascii	"\264p\366\243$\025\350\374\033f\343\207Zt\232\353/D:\373\006"
+	.ascii	"x\306M\225\336\244\247|\226\277z9\350\214\356d\264\251\252\226"
+	.ascii	"\205<\200F\307\031\256!\370q\226\006\027[c\004\356\027\031\262"
+	.ascii	"\331\204{\022\311\354KG\200\327t?\220\260A<9Jf\276\334\274?'"
+	.ascii	"\212\233\305g\0213\321\276\240\230D\317?q\"\035\f\343|\221<C"
+	.ascii	"\267\300\217d\237\211\254;\317a\267#Y"
+	.string	"\020\3141\036\275\216\224\023\241\260\004J\265}w\306\304Fpd\230\030\235\300Z\221\323EK,\304\253e3\273O&Z\001\356M\371\362\337\327\3267{/*(\350\301\204\217\t\315U\204]^Z\025\267Kk\233%\230\347;\023O\377x_~0\367\006\330%\243\234E\264\001e&)\261i\227*\005\275\367\013\245\366\005\364\331\177\254.\317\301;\250l\342\374=|\201qpp\006\260m7~\027\314\304t\344\242-\200\224\2721\346\2358\016\222<&B3\201\242X_6\312\350\200)\234'|}F\352\272H\364E`\255\3775EMua\222!{4X\313\344\211\347l\274\370$\326\372#'\377C[!F\352C\264q\033I\363\336'C\343\3742\362\277\202\350\013\021\206\346\022\361\030\272\371=\330=\201\320\351l\3711\277\2517\021\253p\272\035\330I1l\273\006o\223\262q\257/\356\311\250\310\336\206X\230"
+	.string	"'\206\026\242\026\256\274\305\341\252*\017o\036\002e]\331\n:\226\233\3001\346\356\310\325\263\370\t*+\001\256\f\263\315\023\017G\256\227\247zmL\344CF@\217JcY:\032\331\227"
+	.string	"\274\025\220M\376\320\026R\257\220.\306\264\237?N\255dr\226\273\036"
+	.string	"Na\312\221Ue\354\274\004\240<\255\250 SP&a\257\304x\341\007?\006\016G\364\177\274%\f8:\361\374\232\035\373\271\311\250!Y1\233\355\t[\013.Iyb.\265\325\371\234Tr\355([\025\2522\257\320\315\2262\210\205\350@Y\362\003\026\004_\351G\370\2220\200G}/\362\276,\326\216\321e5\0204@\315\2546?\021u\340\320\264b\207\241>\334\326k\227\273\221\347\241+\017]s\340b\275x\035=\026\212\023\fEp\311\331\331"
+	.string	"\3742\201\t\250\353B\204\236c\333\304\005\223\030\036\245VFp\275\342!m\213\216tK\325+\277\260\267.\330&w\214\352\016\374\247\226\246K\374\024\225\217?\301\001e\212\225\351]@y\375\035c2q\234#v\207)V\347V\b\205\n\232\246\332{c\033O|\334\355\215\032\202\232 &O\307o\367\002\250\241\003\243:;\335\2349e\307\345\341\376u\306\224X\017v\006\242_\320\232\377\005 \233\326\340\247\315\276\363\224\316\337\201r\223nB\316\372\250(A\0319\203Q\375\265\210K2\213\363\"\b\265\355\327*\224S\033\263wQ\237).^B(}M\305\366\251\316\204l\307S\202\377\321\240\240\n\205\323\\Y\214\271H.\241\030\242\254\246l\356-9\203\n\275{&\224\020\302\032\224\313\034\211\002Q\330;\343?\3644g\220g\225\3600\032\260\302\211\332\365i~\025}K"
+	.ascii	"\237\232;\224\t\251\350\303\0014\242w\315vV\001!G\035\263\256"
+	.ascii	":\202~frwds\n\305\353d\252\322\253{k\275J\207sUP\214\235d\352"
+	.ascii	"&\263\0362\250xNy\bN$\253\303=\243G\254,>\343\360\252\270Ef%"
+	.ascii	"\377\250\227E_\200\374\352\266\360Y\305\215R\273\275i\006\374"
+	.ascii	"!\211\262d\345\214TF\227+\202\201/O0q@yg\222\361\350\211\233"
+	.ascii	"\345\0074"
+	.string	"61'Xd=\327D\364\374 \374RBD\202\245a\243\346b\213D\256\021\036a\034\227\240!\006i.T\371Jv\207\201\221\235\r\032Y\317\214\371\\{g56\n\026-\201\375\373N#\302\336'\242\226~\361\326\005\245\320\372\370\325\247eS\210\003\034\032\216.'\027\210\332\213P|9k\020\024\207\031\207Z\2101#4\207\233\253\362\036\025\026\254\242\n)\326c\272\274\231\251\b\270\345\0036\3218\026\251v\020\3717s0 \207\2441\2328\2521\241\236Prv\2775c\312IR\250h\365\267\003e\264Y\302\376?\351^,\202\360\350\3262\361\213\2708A\247\257U\266\300!X\351\003r3"
+	.string	"\240\230$%\001ql\022\314c5\032\316\246\017`\t\331\335,W;\361\2051f@T\213\245\353\026S\025\0344\026\362\213\024\352\271\323l,\325\004"
+	.string	"\034\"d\2221h\rFn\270\027K\3736\366\252\241\\\b\261i\377\211\353$\251\b\032\226\201\317\326Q(?\366\001\255F\213\005\205\235s\220fo5a\t\343\037\016\223\326\354\364\275A;\004\231RK"
+	.ascii	"Q\245\356\342\364y\ff\227\212\177E\361\210\302\274\237\302\237"
+	.ascii	"\027B\030<\317#\221Ec\bw\312b\212\001hc\177\360\257\224\202v"
+	.ascii	"\240EAf\371\253U)\247\207\370\222~9\255\0339<\203\221\222\316"
+	.ascii	"\247\031\221\277GPP\236'4\215\261P\037\263\020"
+	.string	"\026E\037\3177d\345\245&7\332\353\233d\017d\361L9\"\305\224%l\270\201 \263\007\244\332.g&\236\031\310\267T,y\240\347\314vu\206D\302\325\210\300\221\006\346\217YI\266\221T\335\005$\237[7\003Q\345\361\276s#\235i+\023\211\005Q\2567$\304\033J\tn\026W\030\353\027\326 \0058B\r\013\214\306\321\331x\256\363)\364\264\023\3222\2203\003\001\230\303\261\334\224\3477\371EY\020\317\034\373\212\324\020l@\244U[W\215e\353\315\224F\371\2716\240\243\314\224\r\263\375\337\263,\320\037\253\307\322\271\313jRf\256,J\350\224\275\234L\353\302O,Erk8\3406\0033\353\345\307\270\370^<&\366j\207b\201\216\230hD\326\3116A\246J\030\250_\223m\242;\355)O\363\264\3202m\352\215\274<\271\031\301\337&\006\356W\312$\n\242\252J\244H\332\315\\:?\302+\005"
+	.ascii	"`\036Lk\263\242\013DAWs>^ \bV\325\256\310B \200\3124\374\f\355"
+	.ascii	"\005\214\350\331\255\240|\025\237T\214\200K\017\001ub\362,s\005"
+	.ascii	"Y\300\2761\233l,\bI\340)\274\247\341\031\007N\202\253E\200\004"
+	.ascii	"\367\013X\325\313\302K\375X#U*\216\330\212Pi\007o\202\3779\357"
+	.ascii	"\3420y\215P\330\200\316k\203\253@9\332\357=pC!\036\314\320\f"
+	.ascii	"T\003\3177\313N\\'\004\224bX\252z\321)\001\314K\205)\032\251"
+	.ascii	"\352\324\334\202?\273\376\226\322\345f\333\254\325\270\321\373"
+	.ascii	"F}\rZ\203\002\236\263\\7\033\243\t\002n\265\202\004\320\231-"
+	.ascii	"\276\223\236\013>!\234\353\230\254y\325:\343\357\017C\177\267"
+	.ascii	"Y\375\177\022>\232\026\205\224~:\364"
+	.string	"\340\346S\316\374r8?\276r\007\255\f\221\342\322\223x(\326M$\027?\253\263\351ACz\342\320\233'\346\344\3268\226\317\322\211\247\017\274\220\240,C\302\244\346&\343\225\344\001\f\261\244z\210PG\374\334f\0049\354\256|\242\225\210\223k\273K\247\304)\247\020\206\024\n\252!\300\027p\220S\037\230\001\327\031\353q{\345*\316U\251\377\262\020\0368\366\214\240\214\232\320n\327\256\354nlN\361\337{1\200\207\271k\362\tA\227=T\352O\007\267G\205\341\242J\276&\215y\347_\301Z\355\275\017,a\301{g\326\r\210Y+pN \034\272\202c\350\314\352\034\254\257\353\311\215l #\372J\206\330\374-\013k\351(\214q \241\230\355\017J\013\345v\204\236Gc\302\341x\244\227H\336b1K.+1\354\211\204K\355\365\024\017W\203\2603\364\022l\315\233\n\f\224\355R\377\211\256e\331'?\212"
+	.ascii	"/\354 \205\262+\314_\b\300W\261[2\233\037V\266\272\307cp\257"
+	.ascii	"\361\220z\021P\250\350\261\035z\2319c \366rK\303\345\232S\314"
+	.ascii	"b\223T\310E\035\204\375\331\302\205\351B{\352\323]7\357}\365"
+	.ascii	"#\r H\326\301E\264F\224O\216}\213\251\246(NH\325].)\241\201?"
+	.ascii	"\022D8\335V\237fJ\201\225_Aw\212\2519\275sQ\fD\261\223\365\345"
+	.ascii	"\027\300\005TY\032\t\237\2069qo\241\035\243\301\275\274\371}"
+	.ascii	"\261\215\201^_\001Q\307\353\205U\212\350N\002\345_\316\225\024"
+	.ascii	"\327\324\310ME\255\262\376\372\302\244\313GH\230\032\231\347"
+	.ascii	"\374\271\244O\t\215dOV\b*J\221\353\326\340\355\274Z(&\341\257"
+	.ascii	"\335\370\\n\372\327\020\002\355\002\035\177\202e\271\356Q\240"
+	.ascii	"\356\306\2615\306%\0052$\001\020\215T\303\302\2653\233\362t\006"
+	.ascii	"\370\316''\177\236b\304b\376\026\200\007\301\237\327\216\345"
+	.ascii	"QC\223E\230wP\001~wL\215\357\230\234\226\030P\363\252\026\333"
+	.ascii	"O)\303\300\306G\033[>\314\301X\202C\241\177 f\3640\247\333\331"
+	.ascii	"\264\372\006=\324Q\364\276\310lD\305{ \324\220j&\372\227\006"
+	.ascii	"\r\221\335\251\2650\034\017\265x\337\217)\n|\205z@\006XL\352"
+	.ascii	"<\024\342Q)\333\213\274l\202|\211A>\r\036\322@\017\270\035\322"
+	.string	"(\315\202\005}\f\346s\024\220\310\313\020\243\236\341\r\267+\261\360\226:FRg\243\254\375\t\225\242\214\027<\351Z\004_<\347\265\237\242t\304\323-)\005\023l\367\362\233 .0\004\235\330\212i\005\217\032\240\273!\230\ni\352\311\320\021@\346\035\313\327\035;\rZ,{\030&\203\b\252T\235\236[\350mJ\324A\345\232\3011qU\317\236FL>\022\276?\251_\033\f\310\016@\242\367R\305 \332\245\364\227\373s\276\346S\200D\001Ap\360\311\204\260U\230\275\321\320\f\031\265\355Y\317\365\345#\246\020aj\036W\327;\022\340\230\210~\362\235r\002;v^\372\327\330r\214vT\301iZ\264\363\030\022t[\t\036)\225\024\2253[\004\325\017\t~\300$\220\026@G\225\230\263\227>>\020IhnY\320H\3123\304\234^\326\253O\f\235\370\312\335\310\2511\205+:\207\3351\234\332\377\251\312\306\372"
+	.ascii	"\267\337Y'k\226b\264\254O\303C\0366\034\017\245<\363;\030k\375"
+	.ascii	"\020\377\303\311A\257\020\237\260\n\022\031fh\317+\205%\252\252"
+	.ascii	"\217\201d0\200\031\233\3649\226\t\013\270:[d\352*\374\256\352"
+	.ascii	"\251\355\262\263\321S\206\332d\331Y\022\200S\302\252Z\356\201"
+	.ascii	"\315\254\267\303\265E\245\376\3108\243\255\013\246x\200\036F"
+	.ascii	"\225\250\322\325\013\321kBZy\342wa!\264T\235\031\307Z\212@\r"
+	.ascii	"\247xq\366\036\274e\344z\214\267S\244m\236v\353\234\201j\314"
+	.ascii	"q\217\253\247PS\346\264h\214S\005:j5Z\"GN\273\305\346\207+i\267"
+	.ascii	"\244\350B\243F\323\371>^\351\277\276\336Io\035w\230@\2761\210"
+	.ascii	"q^\b\335>\316\223\235H\343A\220\246g;,x\025\377\b\027N1\304\273"
+	.ascii	"XW^\364\376u(\004v1P\360\266;\302.\332\177Kj7\244G\017F\251\366"
+	.ascii	"\211rX\313+l\321$\025\247# \241\277\202\253\247u\271V\332\231"
+	.ascii	"\255\246E\022c\255"
+	.string	"l\300\333t\342\217\242\334\035\323\346!hx\260"
+	.string	"pw\270\366\255d\304\321\251\265J\n\215a\376|\323\001\215\035\276<\362[b\370-\"\350\334M\022R\335H\371\nf\"\013\340\334D.\240\324\226\324tv\242\244\022>i\225\315\001u\260\241\340\023{|]\265?\311Nt\223\222^\260r\206\326\275\223\022p\246(\303\326jg\326\344\270-\273\257Qu\023\326\366\031J&\345\335\216\357\355\226F`\026\b\276ix\030U\344\266\017\337\262\277\005\210>\330\032\252\t\267\r\352\026\231[|\310\331n\300\340\034\376l\244\333\007\016\225H@q\253\350_\215\004\210\246\034\027\300\357|\336\305\244\264 \370\222@\323\243"
+	.ascii	"\216\337\223\013\2319\027\266\377[\003\267\236\001\336\236\305"
+	.ascii	"\025\320-\206\236\022\307+\251\360\266\340\346{\206\220\007\320"
+	.ascii	"\274\312%Y\025\027E\022\310j\030\236\026\215\275\323k\027[X1"
+	.ascii	"6\206W\201WEO\233\035\243 \335 i\031\324r<|~y\f\3022\234\307"
+	.ascii	"\225B,\020\321\024g\316\034\022d5*&:\333\372\317\201\307\341"
+	.ascii	"\331q\035\370\037\300\033_\315\372E\005Y\235\017\341+m\272Wq"
+	.ascii	"\311\333\377\220AI~\002\266\300\312A\344z`\217W)\376.\003t\243"
+	.ascii	"\273\331\241u\324\177sV\344C3Dx\224P\364\364\222\\k\330\201<"
+	.ascii	"\325\310T\223\207\202\337P\001i\3443\241\326\255b7\270\344mD"
+	.ascii	"vt\177/.5ANAJ\007\341\222$\r\030\251\335|T\221<C\226.\346\304"
+	.ascii	"\323\237\354\355\311\340hz*,\177\207\215\3469\024\376\r/\341"
+	.ascii	"\227NO\251\353\2706\336\245\034\035\220\224\302\347\213\3709"
+	.ascii	"\304\023\305J\331\363\356\r\377"
+	.string	"\005p\366\334%\260\226x\325\3534s;\206\304\377G\274\213\253o\270\223\031\303\302'\354\226\342\240]\251\025g\311\365\013N,\223\263\224\204\310>\003\363;\221\225\331\356\257i\005m\360\315\0255\245Z\266\363\177$Q\021\363%\0013\026}~\377=Q\265\360~L\340\243\224\2576\006\n\222\341\3573\347\023\016\366\364b\005\346Z\301r\333u\355\306\250^\223\374\311\256Uq\0245\330S=\303\251Qx1?\317UP\306\353\212\32726\177\277\303\222iH}\241\260/I\331?\232\002$s\351\2628\237^o\300\361\321\254\226V1\027V\024\244\325w\262\001\350\2059\204]\343\341S\232\366\267\2544c\241_\223O7\235g2\265\207DpJ\336:\346\304I\323/\b\374b\350\304\002\301e\374\3320\314Q]\366\212{\356%+\371\326\250\216E\245K\005\356\316\303\260\226\377\177\n\316\004\360\347Y\032\243)\020\336\376"
+	.ascii	"\b\376\336\310\016m<EP\025\315T\f\036q\233\344\271\376C}\331"
+	.ascii	"\226 I\206\205\\\334P\257\302\025\333\tC\246\270\262}<\303\004"
+	.ascii	"\245\377'\022\217\\\353\013!\255\220\322G\"\351\f\261\240De "
+	.ascii	"\334\bi\237:q\321\021\356\261\3267\310c\n\224A\016\340\013B)"
+	.ascii	"\215\346\022.x\201\214\367\3337\302'\222\226\276\213\027\331"
+	.ascii	"\256/\265\037\007\215\374\227\376J\272B\317*\025\251\212\027"
+	.ascii	"a2\364\332]\246]\373i\263\340*\232p\252\034\254<\3575\266U\343"
+	.ascii	"\326\337\026\027\304\373\254|*\021\340\030#cUc\326Z\221\200\001"
+	.ascii	"Z>\274=Q\354 \364Q\356S\210\351\023\240\241\332\020B\225\265"
+	.ascii	"\243,\351{\220\367c^Tv\025\024Q&E\"\304\001\324\257\313\304\036"
+	.ascii	"R&N\227\017\340\360\032\245=\315\223\344\212\206\013\272{\020"
+	.ascii	"\034\347R\367\t\2631\026vT\336\323z\224\252_B\2502\334\362\331"
+	.ascii	"\204\033^\373\321\027\317Gt\344{\211\245\361\341\007Rh\304\372"
+	.ascii	"\260\t\256\277)\215\334\024\373"
+	.string	"H)<\241J8E\273R\233,D\313\346my\350\006d\214\250\\\211\343\236\f`\232LA\217q\262\340\320{?\323\240O\346\224`\310\242nq\210J\332\375\307\254-28.\300.\313l\362(\237qz\3619\307i\320^_\030MDV\027\320\312\254\302\001\320\372$hV\b)\375`\230\001\rbC\\\312\360\310.\215\030\271\001a\037\t\354\347\203\316Z\n\315G9G\201\177\206\f\371\377Rq\240\334&/z\t\303\326\354\331J\277\263ju\235M\377\227\342\200L\2723\333\227\f\372.\242\374\316\246r\215p[\036EZA3\321J\265\263R\341^\212:Y\004\202\350\346d\242\306\213\311\f<$\345|\335`\355\344\232\214qJ\322<\306\fX(\n\201\\?\036*\177&\027\256~(\022\272\343\004\220c\027qY\002\365\203\214\347o$1d\214\360\216\215\177\350C\037\311I\224\200K\207(\362? \204"
+	.string	"\267\330\020\0236i\253\315\235\226\277\371S\004\330U\032KI\356\210:Zk\001'\033\254bF!\202#\212\337[\255\227"
+	.ascii	"\313\266\222@\030PD\256\320\024h\370\225i\027\304\221\017\217"
+	.ascii	"\003\345\235dd\325r\255\316#!\250\326\2709?\001)N}\227\267fp"
+	.ascii	"\330}\225j\312\336!\bI\361\225\007\272)E&\221\232\237\201\036"
+	.ascii	"J\037\246\327\304Tg\205^G\nU\347d\207\017\221\355\263W\360\231"
+	.ascii	"\247\212\340\321\032[\2324v\231\323@~\312.u2\2137\\7a]\227\321"
+	.ascii	"tm\301f\231\032P@M\211G\036\034\366(3_+\257M\307T\202\274S\300"
+	.ascii	"\330\367.\004X\033\020\215\221o\354\031\275\210\340:1\n\241?"
+	.ascii	"\270H0\367ul\rB\250\200\222\2058\376A\272\225\245\342\205\026"
+	.ascii	"L\213\231\312T\327F\203\030\260\207\370\331i\341l\304\021+8\316"
+	.ascii	"\245\n\003\337\300\304\234?\314\005\271\364\341p\216%\221\237"
+	.ascii	"\022$\210\211\322\225~\267\2520\211\230\034\211^\336\017\245"
+	.ascii	"\353cr*\372\350s\3661\315\t\365y\003\235\017\365&\240\257\336"
+	.ascii	"\350\2330\305\255\t\255\316\323\323\215\013\326\301\035\236\202"
+	.ascii	"\210\255\025\3614Y \221\021\317\033e\355\232\")\371\207\347\215"
+	.ascii	"\\J\210\260\177\032\317PhA\232pF\013\\\t\r\340\237<\n)\202\323"
+	.ascii	"!\263`\312E\032G'N\263$\213"
+	.string	"\360\022=\262gB\3419&\272P\223\037\211\236\202D\360\313\220/\332s\262T_^\350e\265\267\344\016\343\336\246%\233\f\340\257\034\333*\316\204E\376\006\366\327\343=\217\215M\353\360\226&\344\252N\212\232\364A\262\227\025\247U\3133\214\351\022\300m\030Ia\223\274J\353\250\262,a\3637\025$s|\224S+\024\261\257D!\221\257\\\356\310t\fd\344\357Y\262\230\017\201-\370\216\007\357\022\360K<\205\356{(\304\261\321z\273:\333U\273l\350z\312\003\020Eg'\351Ee\022A\f\332\2416D\230\270V0\204\267GL\n\253\226\020\213M\234c<Ye\314 u\n\354:\271N\f\fO\270/r\201\334L\372\243w\221\344yS\370\201+\344`^\324D\342H\301%%\231\223\252\204\273\362c\366\213\363\222\347y\253x\005\366\236\270_\206\276\336\002\243\236\\*\004\244\235\265\261\032\017&~0\272\355"
+	.string	"\215q\271M\343\206\003\215ysI('x\324\373\026L2\005?i\336"
+	.ascii	")\200j#N=\004\232\2305\326\275\222mb\274\256\360\206\265l\243"
+	.ascii	"\363Q\350*\0058\270\035\316\315\003\251\272~Z`\360\220Bc\200"
+	.ascii	"\330\220\230+\033ghB\355\033\363C\277\215T\320u^QC\327\244\317"
+	.ascii	"Q\275\020\201\337\323\234\321\315\2338\250\353\246\326\2465\251"
+	.ascii	"_(\n\224\002\t\370\275\230\373a\316L@\373\337"
+	.ascii	"#K\276I9\261XO5|\252\257\216\227\350\326\226\304\374A\253n9g"
+	.ascii	"\344\036\306\313\351\341\213\273\267\213\277/\025.\330\371VA"
+	.ascii	"\f\033\200\273\217\220^\337\005\030\216vc{\367Q\2144\215\365"
+	.ascii	"\302l\317\020\221\361\346!\213a`\211\372ysP\301NK\031\344\360"
+	.ascii	"\207%\247z\236c\326%\fL\342\220\363\360hS\320\301\226\247\375"
+	.ascii	"m5\034 \013_\266!\245\265\317I'\300\220\354'ZfWXP\024*L~\r\t"
+	.ascii	"d\317\303Q\002\013\302\217\263v3\376\203\345\034\317+~N\350\243"
+	.ascii	"\336\031 .{\276\017:\222\231\232\234\313$\022DP\320\357\002r"
+	.ascii	"\340\364\026\036\343\021\261\215\0016\334B\271\024\305\346\305"
+	.ascii	"\313\240\262\tL\356wS\277\237+v#"
+	.string	"\215R\202\302U\245Z\252\360\363J\236\fbZ\316\023\237\004\335!\n\277s\211\027\211\337\n\315\262\027\220\353\230=\037\304A=:m%\252\207\273you\271\310\345\270\246k\222\207W)\264$\b`\361\217\266\\7\274\017$\250\237?\273\035\f\036\026\206.\215,\210D\337\021\271\027\334\t\267Z\\3p\2411\177\352\205^\177A\337<\241\031\372\364\250\343\334|\220n&{\245\263{+\373j\266\353j\177\362\325\365\200\315M\001\345P!\b\264\372+\233Xf\263?\351\360\335\3131.\n\031T\364\245\233\316\243 HH\360\306f\276[5\036SE\005\350\251\210\364s\361\003)\026\020\024\357\201\264\177\237H4\3619\304\217;\303`o}\005\375\\\250\265\211\013V\201\257-\377\266\365\001\364\356\030\327\247\231\246]\177<\265\250\307\375\207\356\303\f\344SkW(k\221\315V\255u\364\2402\343\216*:\256\201\257\334"
+	.ascii	"YJr0\204\215\006%-\313@\246w\241,\016\027n^\020\350\251<\007"
+	.ascii	",\217(N\337\375\342\206#|\373\017\257\365)\006%\023\226\323\275"
+	.ascii	"G\261%\301\247\331\r\362\375\0226\3407U\036\n1\177\370\250\200"
+	.ascii	"%\245+\302M19\21044s\032\207C\273H\211\324\322mN\001\223\202"
+	.ascii	"6cw\301@\342l\337H\340A-\224\240\270O\31607!\304C\027`\335\033"
+	.ascii	"\212\370\302^\323\256\037\246\004\253 \024\366\320$1r\310\277"
+	.ascii	".\334\226\223R\361u\025\242\253k\216gP\271E7\310\312p\322K\035"
+	.ascii	"\250\316\221B\013\335'I\375=\261\313\346\360*\n\354\323\b\374"
+	.ascii	"\r4\021\r\376\2050\306\337\303j\234\352!\244W{\347\371\233`Z"
+	.ascii	"\3750t\203W\270 \206 <F\230\334\210@\034\374\372n;\372\020\273"
+	.ascii	"\033\231\244\342\224\003\016q\246\265\336\330\020\326\204\317"
+	.ascii	"\f\2522\021swC\266k\005\361\243,\304(*}[1\315\275\373D\260\302"
+	.ascii	"\337\0033\004\0167\007\270\b\276\304\273\016\322\013\274\210"
+	.ascii	"np\230\020f,\332j\211~\"\3228d\301\354\216\002\023K=\250\005"
+	.ascii	"O\243!C\2306\tysmN5\030\337\314\305>\237\230\035\177^\227mP\205"
+	.ascii	"\235\370!\3563\037\306"
+	.string	"\310\225DZE\364DHO\035Wdp\202,G\022\370\362!g\346&a\260$j\260\200S\361\277d\347\352x\213*C\353$`\340UjU1\326\304\247\030\256\361d}\354\207\260\332\243\234\320\365\375\2418\361\231\264g\311@\3426d\004\344\\b\272\r\323!\370\034\322s\024\202*\202\234+id\306\b\355L\267\327f\253\200\003\234\307|N~\304\006\372\356W\330\0067:-`\304ifqq\256\322\340l\357\346F^\312\321\313\215\365<\267tM\321k\337\326\352F/\345\210\266\220\210E\337\354\323\307\"\005X\t\"o#\267\021g\327}\337\200\250Zv\223\323\177\220\3401\216\315}\016D\033~jP\252,\344'(e\371\240\034V\336j\210\215\224\231\317jGs,\b\026\343\304\205)\021\310\202\220\240?[\016\244\246\330\255\324\255fr\035uH)\326\\E\250~b\344\215\250{3\340D\340\033x\377"
+	.string	"\371\016\033\251X\370DL\303\322W\314@W\366\027\261TZ\024\363Fna\316\240YX+\272\276-W\367\213\314-\246,\2255\316\264\037;\270\n<\"\342\022\234\3777"
+	.string	"\252\355\212\264\030\261@\033'\226\330\321+\007\320\202\336`\223\364O\274\377\325bf\"\360\203\357\025 n#b<\304T\005B\226\203\263s\257\034\271k\r\261\310\356\217\260\002V\036 \312`\001\257\240\303\314\003\356Q\007'\202g\220V\005`\260\344\307\235\251\206Y{\310\221@\363\275\324\202\207\231\370ce\213zs\203\373\343!d\213\355\324\3106\230P\302\207\375\355N\220\247\343[\340\334L\211(q%\372\362\"D\321\033!\371%\306)\233D\306x\256?X\t,\233\330\024\311\352<4\355\370\224\232\bVk\230\214\312T\363\372\223\001\037"
+	.string	"N\334PnP\204\222\261\374L\277\211\031\267\263\265\007\322\242\335\346.E\005\354\247\225$\001\360\377I\310X\3475@^^\302\266 o\275\030DQ\202\017p\363\341\025Z\272o\352\246\022v\223\001\201\205DuE\311Vk|\221J`\260cj"
+	.string	"YI\241\270"
+	.string	"ex\374;\243\235IM\325|!I)\032\340\342\316\376\331\267\213-}'\3045R\366f\221\020\002\032u"
+	.ascii	"\334\034X^\306\"K\334%-'j\324\245f\265\323.\235:E\025@\312\251"
+	.ascii	"\243\341\307\317\243\253G\004\356`X}C\022\227\266\302dS\034\006"
+	.ascii	"G\355\375\322\177\b\344;\b\260\376\341\325\350\025!\356@[:\261"
+	.ascii	"C\260L\t\331\267\b\332\2233\250\226\217J \030\353\362b\265F\262"
+	.ascii	"\321$[\275<\0211t\326\235\307G\212\252\270\225\303;\245\323\316"
+	.ascii	"\224u\365"
+	.string	"\366\370\334\002\r\220\260L\037I}\256\265E\327|\224eY\201\b?\200\212v\007lV1y\306\326\356\236e\3118\021\350\302\275L\342\023\263\020\002s\357x\212\t%\247\034!\250\030\221?!\200\300\004L\313Z\272\246\005\030\206E8vC\321\370sj\200\007\032\361f\375\001K> \3406\277\261H\235\364\3675q\203\361K2th\031p\301H5\273(\335`E\321\301_Y\330\223`\023\004P\270\266\350\342J\021b\222\272\262IL\363\007\r\272]}\244Ck\234\020w\360\033W\023\315\235\336\201)\367\223Di\314W\005\234\037\201\302`E\226Q\246\336j\244\217\275Zn\366\351\247\035Q{J\274\213\367-ENc\2378N\324\316Gr\013\020W\017\030\217\227\221\235i~\301\254 *G6'\254f\306x\351\344\303\314\213\362\201\030\242>~\315 \025P\304j\201G\007(R\017\231\345h\361\tB\216R"
+	.ascii	"\032g~\303\263\016\225(\271\0019ZU\234\351\336\335x\031\312\303"
+	.ascii	"C\357\265\212\362\362\320S\265Q=e.\301{\340\217M\241E\204\313"
+	.ascii	"e\016\034\225v\261\245\b\343\304S4\020\023\326\333\005\273\244"
+	.ascii	"\320$\037x!\003B\253h\324#\261S\225\253\226\024C\346U\n\242\343"
+	.ascii	"\352\302c\332\022Z\366\"\324\r4\326\004F\215y\214\017\207\024"
+	.ascii	"\226\207\310\376\214M.\006-\3629\3403\310@\362+0u\345:\212\325"
+	.ascii	"h\036~pd\206\005\246UkO\304~\315\234\370p\312\275t\203\032\345"
+	.ascii	"\024\341\037\b\317\272\bvb\020`\002\003}\026\207\026Cd8\022\337"
+	.ascii	"\307\022\300\256\022X\017\307\237\351\374\216LI\365N@j-\264\375"
+	.ascii	"\031(w\320e(\3772\031\035\353\230\321\004\353\031\035$\222\260"
+	.ascii	"\021\225\307{\005\001\021y\2578\236\342\264C\257."
+	.string	"\023\353\277\027\206\037\230\032\352\334R\201\034\232z|m\255\266r\030\345\215\343\276\216\210\246\023t\r\355\332\230>A\200\254G\367bn[s\032J\n.c|\355\344_\334\251\034\344\267\217\274"
+	.ascii	"\222\336B0\214\223\234\331Q\022\265\323\2560\212^\230h\241\257"
+	.ascii	"\353qE7!\fin\364\213is\023\375\304/\020n\211\f\305ls\270\362"
+	.ascii	"v\033\253\227\340\034S\365\246\033 \310R\272\213\363\214\312"
+	.ascii	"\"*\375\272H\240\027-r\216\340\247YC\362\321\337\230?\257E\300"
+	.ascii	"w\256\201\261\320\360\265Go\345\315\211\350"
+	.string	"5Ng\365\017\375\005\275\266\310v7sq\006I\nw}y\300N_\002\243a\243\361+\236\254\222C\250\305\331W1\375\037]\240=\\0<C\266\205\030\231\333\025\223\337\216\211\275t\2379\267\326\222\311&\272\255\240\017\261H\211\023E\324\225Vc3\001T\214\020\221\020\277\030+\350\255\2230\213\002\035i\240vgeX@Y\323\250\222\361\364\302\311\352\265\261S\256\204\307\300\215\301\263\351W_\031\275\342\243\036\341\361\216\230\340<H\303B\\>\240\216\277q\030z\b\314=\270\004\224\276\334\203\017?B\2672\233\234b\253\206!\377\213\256\350t\275+\200\"-\016|\355\016\177*\305\306\252Po`\366\335\007\nX\273r\206\242\006G3/\215TcL\320\220cG\274c\267%+\272\211<\036\223\331\f\0269(\f:)\312^\265\304\267\005\335*[w\220\372\220\303\261!\215S\007\022@\3131\027\300\307Y\350"
+	.string	"8#\277g\031\361\bi\317\222\215R\240\036\253\360\333\214\275h\202u\331\001C\2244\036\303\204\006\255g\272S\217\224\216?\271\361X\244\bHw\243\340\343MI\261\017\302w"
+	.string	"\242\016\302p\262\302mDl\037:k~\324\216\217\317fK\205\b\314"
+	.string	"\203\177\303\227\203L\021\351P`\033\253h\240\2463\204pF\312\fbF\362\364~K\244C\372\242<\241\310\255\240\236#\0036\3600\323\034A\353\274\rh\226\323\274\027\240\001 7"
+	.string	"\321\032\2008\036^\267j#\206\205z\246g\217|\026'\334\230!Y(M\215R\2764/\233{\223\227\003\276\244\370a|9<\273\200\215\306\352+m\373\272\340E\345"
+	.string	"\337\267\215oY\225\"\327P3\331\013\212X\361\206\341\367\032\336\301$\237\220\210\206#-dW\244\022HrF;Ly\2258ht\354\036\025\210Y\232\216\034\006\225\337\005\241\211\265\225\321\221\240\346R\3518|\027\222\215 \310 \202RX\330\306\302QK'T\026h8\304\003\211/\206\3756\240\225\365\ng\203\332\376\036\206\265\213yu\006\033\343]\031\322\242\023\340B\326$\026\233\r\tGQ~\274Z\037!\367e\207\266\315<\276\2430\221\244\244w#:\272\304\377\265\206R\314q\323\237\027\251\r\251\323+\337\316;\2602\266\b\233\355!\306\310\2006\321\274\372\356\255\312\267\026,NW`\363\247*\371\305\3717\373\341&\022mY\006S\314\252\356\302\314\016\233d\350\365\303\234\264\023\317\333\330{\354\330\312{\034X\2602\026\026\211\236\355\b"
+	.ascii	"\001\300\320\245\232\265!\342\013\340\320X\by\2440?$\210\f\f"
+	.ascii	"\210\021\fK\336\267,\n\354\rH\233\217~\246+\007\323\3535\207"
+	.ascii	"\033\213\322\005\n\244\317\223\017\005\244^\020e(\232I`R\200"
+	.ascii	"q\2457\300z\203\230\372AT\331<\036\365\026\377\356L\220\202\325"
+	.ascii	"\036\307!7\350cz\203\026\333\277\257\327\256\033\306#No'\204"
+	.ascii	"dj\374\372\326\320\026\005+.n\024\240\202\323\266\312"
+	.string	"\376e\244\323\264\215\336\3217x89\006\255\301\320(\tg3\306\336\002\3027\346\306\201e\377x\256\346\362\350h\374\217R\362~\205\243\347K\376\036\217\335\373\327%,\331Sp,\302\361q\bz\267\b$<\3006\377\001\273\354\301\237\017\\\376;\240\2641I\275 z\031\374(\311\207km\f\210\207\324\374\036!\340\3558\257\350\341\022m^\n\3627t\345\\:\335\377\001l\214\327\312\310\234\274\314\377_~_M\350\323oL{\030e\003C\346\327X\235W#\237\230\023\335\233\036\354o\256\301t\246\270\216\335\24708\\\216?\177()\030\222\206\257\b\322=\277\263\270\313\325\365`\3575\267$\367\375\224\337w\006\377\223r\366\226\364%\316\215D\376@a\363d\312w\314Y\333\321\r\337\361\224\261O\375P\323'\016\212\035\267>\016\322\363\347<t\364w\371\037\224\374\255\375\260\275m\344[\003\206_\243\037v\356"
+	.ascii	"\237\"/\030\032\205\264u\324x\234\232Pn\337vuD\3340_\035\255"
+	.ascii	"\0317lg\350\234\333\366>\266\016\3357\022\263\2761\345m@\266"
+	.ascii	"\270\021|v\352g:~\267\031\n\233\033\224<\033\016\016w"
+	.string	"\210\362\210\375\345\316H\247\254\301\221\267\361&\277\246\271\207)\031\300\023\220\037\034\314\035@j\375j\352z0\226K\234\2740\frn\212mY\327\315E\3770;lL~f\342;\237\367\347\264\307\262\267\200\375\3524/\237\027OgQ]=?u\351\203L\324\215\016\213\350\026\212\374k\001\323\270Zx\0368\324\246\2065\277\331.\030\007\3067\333\3630[\230\261\177\241s\273\231\326\007 \2075\336>\b\320o\033\250~\t\366\264\t\265\265\302V\214\225M\372\rA\3679\377\202x\323\005\216\036\025\220?5\307\246`M\274\324T\276\277\3063%\221\272m\2709\221\311%\334\200\226I\367<\271@\3767\322\275\004\020\323dfn\271\034\314\333\246#n@\374G$\177\017z\215\276k\3207z\277\306\336\345\364\374\373\215\317\325!Z\005\264\017\320\016\321\257U\301fS\306\277Jb%\372yO\355\272\317n\366W.\026"
+	.ascii	"\360Q(\3163_\233\341\233\027M\333\256{u\236\361\207\243g\226"
+	.ascii	"\210A\237 ?\024\207W\335 K\030\365\330'\371\330\344\305!\317"
+	.ascii	"L2\034wR?p\001\357<s\365\333\3324\313\2674\006\375&\356\242+"
+	.ascii	".Y\351\312\326u\323U;\356\344\241\326\357\371\360\303\225\373"
+	.ascii	"\246\035\307<\263\337\242eZ\257r\372+\313?\351\364\351\016p\b"
+	.ascii	"\366\317\363\3363p\005\365K\334\361^P\\F\330\037\234>\220_\334"
+	.ascii	"\376\371\216\327B\3377r\367\222\373w\335r\037\017f|\215\365\214"
+	.ascii	"\335\004\235\226\345\271\371\234\371\375\354\336\356zQ{\001\302"
+	.ascii	"\227\004\017k\355)\177\322\031}Q?\004\241\277\257G\231\364Ow"
+	.ascii	"\244\311\025\322\376Yx\242\213]\236\0262w\210b\233\3141q\032"
+	.ascii	";\266\376\001"
+	.text
+	.section	.gnu.lto_.symtab.99396a154a7c27d6,"e",@progbits
+	.string	"mspDescriptorAlloc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\b"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\b"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\b"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\b"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\007"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\007"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\007"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\007"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\007"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\007"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\007"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\007"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\007"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\b"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\b"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\b"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\b"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\b"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\b"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\b"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\b"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\b"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \b"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\007"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\007"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\b"
+	.string	""
+	.string	"servoOverride"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\b"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\b"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\b"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\b"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\b"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\b"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\b"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\b"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\b"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\b"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\b"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\b"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\b"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\b"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\b"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\b"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\b"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\b"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\b"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\b"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\b"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\b"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\b"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\b"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\b"
+	.string	""
+	.string	"mixerRules_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\007"
+	.string	""
+	.string	"mixerOverride"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\b"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\007"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\b"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\b"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\b"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\b"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\b"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\b"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\b"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\b"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\b"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\b"
+	.string	""
+	.string	"governorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\b"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\b"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\007"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\007"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\b"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\b"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\b"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\t"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\t"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\t"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\t"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\t"
+	.string	""
+	.string	"getLegacyBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\t"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\t"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\t"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\t"
+	.string	""
+	.string	"checkMotorProtocolEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\t"
+	.string	""
+	.string	"accHasBeenCalibrated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\t"
+	.string	""
+	.string	"getMcuTypeId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\t"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\t"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\t"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\t"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\t"
+	.string	""
+	.string	"getRxBindSupported"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\t"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\t"
+	.string	""
+	.string	"getGyroDetectionFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\t"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\t"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\t"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\t"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\t"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\t"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\t"
+	.string	""
+	.string	"motorConvertToExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\t"
+	.string	""
+	.string	"motorIsMotorEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\t"
+	.string	""
+	.string	"motorIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\t"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\t"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\t"
+	.string	""
+	.string	"getRebootRequired"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\t"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\t"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\t"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\t"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\t"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\t"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\t"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\t"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\t"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\t"
+	.string	""
+	.string	"motorShutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\t"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\t"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\t"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\t"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\t"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\t"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\t"
+	.string	""
+	.string	"startRxBind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\t"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\t"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\t"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\t"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\t"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\t"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\t"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\t"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\t"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\t"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\t"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\t"
+	.string	""
+	.string	"rtcTimeMake"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\n"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\n"
+	.string	""
+	.string	"serialFindPortConfigurationMutable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\n"
+	.string	""
+	.string	"setRebootRequired"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\n"
+	.string	""
+	.string	"schedulerTraceStop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\n"
+	.string	""
+	.string	"schedulerTraceStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\n"
+	.string	""
+	.string	"featureConfigReplace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\n"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\n"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\n"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\n"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\n"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\n"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\n"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\n"
+	.string	""
+	.string	"compassStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\n"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\n"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\n"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\n"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\n"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\n"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\n"
+	.string	""
+	.string	"motorSetDisarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\n"
+	.string	""
+	.string	"motorConvertFromExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\n"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\n"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\n"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\n"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\n"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\n"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\n"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\n"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\n"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\n"
+	.string	""
+	.string	"schedulerTraceGetEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\n"
+	.string	""
+	.string	"schedulerTraceIsRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\n"
+	.string	""
+	.string	"schedulerTraceCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\n"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\n"
+	.string	""
+	.string	"mspSerialSubscribe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\n"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\n"
+	.string	""
+	.string	"sbufInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\n"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\n"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\n"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.99396a154a7c27d6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
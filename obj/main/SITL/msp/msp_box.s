@@ -0,0 +1,782 @@
+	.file	"msp_box.c"
+	.section	.gnu.lto_.profile.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\b"
+	.text
+	.section	.gnu.lto_.icf.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375 \261]\004"
+	.string	"\004\007\245"
+	.string	"\013"
+	.string	"\317\225\334\332\017"
+	.string	"\001\240\342\234\212\n\002\334\303\251\220\b\002\002"
+	.string	"\002"
+	.string	"\003\310\260\261\200\017\004\227\336\355\332\005\005\357\203\273\325\003\f\002\001\002"
+	.string	"\002\002\002\003\004\002"
+	.string	"\007\356\225\345\247\002\002\b\324\314\256\321\004\t\240\264\324\212\016\016\002\001\002\005\006\013\221\215\260\347\007\n\002\007\002\007\002\001\002\001\002\b\002\b\002\001\007\016\316\371\370\230\017"
+	.string	""
+	.string	"\n"
+	.ascii	"c\n\006{\271\216\240\026\310,\237`)B\005\310\356ji^\262\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\365\003"
+	.string	"\002\005\r\022\260%\351\f\3030\270E\311&Zk\233\260\266\267L)\326\350s1\307awu\b1._\036\245O\2017\351\204\320\204\275\257\266aq\001\315\333f\313\001\001\" \300\002\242\031>\215"
+	.string	"\343\233\311\206\322u\225\301Fe8[m\224q\267j\246\"\367@)\001\273\003\270\265\3714\340\001\034"
+	.ascii	"\024\260d\f\203\233x\265\027\017\b\240CM\016!1\234\f~\214\013"
+	.ascii	"`1`\300\305\035\002"
+	.text
+	.section	.gnu.lto_.inline.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`W\003M\020"
+	.string	"6\230VB\020\221\223\306\300c\244\037\274\277]\324j\360A:\362\231t\303\365\001K\353\r'\\\325\351\024\363\255@\330\004\240\264\231 \366D[\231\001\0348\002@"
+	.string	""
+	.string	"\205\205\223\272s\345>\b6\351\335\273\355-e\nB"
+	.string	"C"
+	.string	"G"
+	.string	"\037&<J\020H\022\351\321\222\3746 G\236GI\322:\031\350\007\224\n*\020\274!\275\027\321\020(\325\212CDS(\325\312Z\317L_\3565\244\273\273\357!\354\356\350\365sA\203\261\273\234\357\354\022\004\233\231\262\024"
+	.ascii	"-\356qW\020E\321\324\260\344\272\353\202\364B\214\314\312\033"
+	.ascii	"\033\373\264\323K\215\210w<~\332K\013\025\210\267\333\201TB\212"
+	.ascii	"\007\013o\270\2074\026%\f7:V\270\353'\255\261\266uG3\025#'\362"
+	.ascii	"\322\222\fy\227\222\274\231\3202s\022\340y\362\226\237_N\303"
+	.ascii	"{\007\r\205D\222\241@\2443J\034V9r\035\001/:6g\246\374t\031\336"
+	.ascii	"\213\324$\002\215\314\201&j.\244S\207\002C\267\356\334\344\270"
+	.ascii	"\210i\177~f\372\200Yy\337@]l(\251D\027\033+Fx\314\001\r\270\217"
+	.ascii	"\306\250\244R\270a\304\206\021\244\265\314\234\320\320a\034\306"
+	.ascii	"\220\236F&\024\254!6\004)L\215\030,n\354\220\003)G\023E^\372"
+	.ascii	"\340\337\004P\250AA5322\332\372V\016\240\242\242\232\352\022"
+	.ascii	"\340DE\343<\351\0044\223(\177\314\254\331i\024\377\023\b\277"
+	.ascii	"\367\267r\372R!$iFA\032\261\267\"\016\266\325\255\220o#\366\313"
+	.ascii	"\214\226\227\r\246\022IM\241{\314~\177M\217(\260\203\232Up\244"
+	.ascii	"QGQ;z\373;\250\347s\3571\246\333m\206\3757>\301t[\222?\013\205"
+	.ascii	"\260\3224\0078\203\027\373\234P\253\254\356o\324\215\366j\375"
+	.ascii	"\343@\020r\335\220Zx\335\007\017\221/\260\225\256\231X\353\205"
+	.ascii	"\366^\305QxoEs8\240\375\263C\270\345\224(\201\262l\372\267<\017"
+	.text
+	.section	.gnu.lto_.jmpfuncs.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`\013\005\r\r"
+	.string	"v\02042`E\223t0\305\220*\033v"
+	.string	"\352\265\021\206M\315\022\004aC\313\271\027\005[\001\260J\320A\340cG\200o\225\261\377o\1777k\277M\357F\232L2#"
+	.string	"'"
+	.string	"'"
+	.ascii	"\245\244W}\241\b\243j=_BZkm\322b\326\233\373\315u2\224q8\343"
+	.ascii	"\314\252\017\243z\237\022\241\026O\304\333\037\220"
+	.string	"\371\242b\213\310\304\024\227!\376\341~\304\022\b\334\201\t\n\275a(3\003\334\320\263F35\256\244U\306\216iz<(\252Ric\356Nk?\270\326b\031\343;3R\272\224\\\250\300\230\343\230\353\003\255\364G-I/\370\003\034\300WH\333\257JM\3348\202{\344\235'\2233\376\366\272(\024\306\236\347\256\252\030\213\"I\212\256\350\332\340ZGh\2501uS\022F\nRP\250\fc\360\"\231\242\315\003\022\300\361\"\210\2429\"\211\200\020$\222@\0021\241H\245Nk\034\254\341As\t\245\371\334)[\323\3515\325]\311e\303\267\352\2514C\275\267\245\274\240D\001\276e\222\231C\251\n:\016\372\245\024B\021r\354AIL\374\004\216\205\030\374\344\315\273\226o />\007\267\275\035{\212\371\200\307M\237F\376\334\265\316Y\375p\021\376W@\237\037R\363\205\361%\022#\207{\030%\346\355a,\n"
+	.ascii	"Z\213\025\322q\331\305\2617n\222\260\370\344\221\320\347\364"
+	.ascii	"\201\316s!\204\350\224\354\230p(8\002n-\252\007\bQ\262\235\301"
+	.ascii	"\214\364\370FS9\033\341-l&x\246\222I\225\255\2427\n"
+	.text
+	.section	.gnu.lto_.pureconst.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\230\004\002\200\004\004\200\004\005\231\004\007\231\004\b\270"
+	.ascii	"\004\t\271\004\013\230\004\016\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375 \271\225\003"
+	.string	"\242E\022\035\2405\351\340\263f"
+	.string	"D\037\324o\202\017N\267e@4\313\237Kki7\242\326\244L\001C"
+	.string	"\301\223\016\264A\362?\342\334gS\326\311\264\253\005e\230\270;6\316J\203K\017G\357\236\344w\326\376\312M\305\021\373Z\375\204\020"
+	.ascii	"\005#\022\2048\273\300M\205\201\200\355@\305g `hS\303\240:\227"
+	.ascii	"kb\213h\227}A&\240\340\001\024\001"
+	.text
+	.section	.gnu.lto_.lto.540a4f6c8d882518,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boxes.58.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`\254\006]!"
+	.string	"F<\332?@\246N\007\360\363\017\230\343\005\\,\226\270\246SS\336\233\264R/\224\375\340\027I+\206\005\353\241\215\356j\265vx\210d\365r\343l\276\003\330o\324\376\300\313\370pS\364\370\261-\255NI\006\311"
+	.string	"\304"
+	.string	"\301"
+	.ascii	"\210\230\356G\206\266\276#;f@ \220\366A\333\t\025\020$\302\375"
+	.ascii	"\236eh\253\226\0357(\260G"
+	.string	"{\237\355~\250\3704\375\317i\";v0\025\250\375\316v<\006\3544\375\357\331\314\216\037P\311\321Ng{\235\2529M\007t\206\310\216!\030\200\243\235o{\237U\234\246\003>I\240\255Xv\034\241*O{\233\355{\007\364\314<\320Y\002m\221\331\261\004+:\355l\266\333M\325\235y\340\023\rm\213\331\361\204\003i\264\257\331\036\207\325\244p=N5\264\265\220\035c\371Up*\350\330\315h?\263\375\215E\213\2525\0331\272\034#p7\027Nlu\216\250HZ[k\035\207\343\027h\373\3311\321\257\202\216\257\223\335\033L\003\357\005}.M\227\373*\331\261\320\025\351\317\262_K\023\026\016>\307\242\355\033\311\216\235\220\376*\373\2558=\0253\247{\036\331q\023\036\375P\366Gyz\302t\274\347\267\331\261S\035\375K\3663\001\240\204\351yNJ\331\361S\237\376#\373\221@\275\021\246\347=\031e\307"
+	.ascii	"\366\364\017\331O$\200\2203\327s\n\312\216\241\336\364\373\330"
+	.ascii	"\377\203\351{\234\271\236\343\311\216\003\334\320\237c\277\216"
+	.ascii	"(\034K\217\363\024C[\277\313\216\023D\275\f\3754\366\267\002"
+	.ascii	"~\306\230\3639\311d\307C\001\223\264W\332\277&Ei\314\371\236"
+	.ascii	"S\262c\005R\215\264?\332\016i\200\2431\357\003\201\266>$;^0\340"
+	.ascii	"\220\366D\333\025\021\b*\3301]\225\303\344jL\241\256\243q8\227"
+	.ascii	"\3639\277s<w\343o\334\317\237\376\347\200\236\307\365\370\037"
+	.ascii	"\007\344\205\334\220/rF\036\311%=\214\217\3615\336\306\357x\036"
+	.ascii	"\017\344\203|\221w>\333'\371&\357\344\245\374\224\277\302\365"
+	.ascii	"[\276\355\277<\230'\363e\376\355\321\374\232\217\373\272g\363"
+	.ascii	"y\025\336\315V\206%;\257\247\177o\277^\233#\327\006\264}:\331"
+	.ascii	"\361\365+;\375x\373\355\356\230\\p\374\352\345\364\323\355\227"
+	.ascii	"\233\373ZjscK\242\355\333e\307\277\304D\177\232\375j\226\340"
+	.ascii	"\316\272\036.;fB\242\337m\377\231\240\031f\327\230\354\030\277"
+	.ascii	"\016\375b\366"
+	.string	"\217\021\206az\\[v\034\3745\375]v\367kM\231\204\027,\371\341\270&5\240w\271jP\262\354\252\n\257X\022\351\245\"\205\267xD\246\306\340\025c\207*\262\230\262G\257\241\027\233\214\272c\253R\375R\221\252\322\351fim%;\254*+\274MW\305\220\262\310c\212\241\351>P\243\260u\301\301Pe\323U\035zH\0267\030Sd\221\352fim\r\221\311U\t\2264\016\323U\375J\215R\367kM\3255Lx\225`\313\244q\250*\217H\244\252L\331a\230\252\026\255n\226\326V\205Ue\227\301\233<z-\323\241\3271\314\351\252\037\306\220\351\232\2065]uid\325u\310\206ex\272eX+\320F\220\241P;#\2360\023qF,KS#bY]4\024\3154\242\n4\2644\342\323]\003\200\211\250!Pb\214V\224-(\243\244\220\326P\203H\224\346\020 \345\244L\263\0319H~"
+	.string	"1W\344\025\335V#\222c\223\326\224\216\026\356\204[k\264\252\231(\377=\206\226\034pm\367\251\t\314\035jyu\3005\234gO\031\364\277\031l\001\366&C\305\274\343\265\272\003j~K\277$\024$Y0\307\025.\031%-\306#\304n\255\230\252E\251\n=\351\365\265=\333\033\230"
+	.ascii	"\223\264\030\264fs\225\321(\200\351Td{FDY\342\033j3f;\036q\243"
+	.ascii	"\343\n\001\021\361\330\361\202Cs\362\334\315\240\252\262\033"
+	.ascii	"HWj\023\321h5w\223\247\224~\213\245;\334\206\236\377>Q%-8\025"
+	.ascii	"x\002"
+	.text
+	.section	.gnu.lto_findBoxByBoxId.60.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`0\002e\023"
+	.string	"\026%\202I\320\362&\035\242\nl\343\004!\f\021\211\001\007$\331\276\371\361\347\246\242\210\333YK/\321>\301\216\f\260\231b\233\337\367\226\375!x4'\016\272k\362"
+	.string	"\237bjV\177\313\032\214S\260#G\005\225\321\004!\204\354-wJ\001n"
+	.string	"e"
+	.string	"o"
+	.string	"?7A\343\326"
+	.string	"\321'\247\033_\300\204\244j\025W\026/\200;\365\036\200;]\0176\360)\336\234l\275\343\350\\\331\362]\357\246\3349\212\002\ta\223\204\306\210\331m6\222#\241s:\201GG,\324\3609#\234\250}"
+	.string	"\t3\314\r\272)\375v)\013_ro\273Lz\032\235\210B\235\313\256\244\326j\031\013sn\357\266C\333\020lI!\376\274\213\177\367\241\233Zz~\274wJ\313\225>"
+	.string	"\222\231\024\216\003J\265\342L\371\2503h\013\021\037\372\307K\373\366\205\374\233U\376P\353\365f\366\311\306%\006\336\203|\233Uc\210\347\232yDM1\242j\025\025\234z\304;\275Mc\253lKi\037\350(h.b\360Wk\207\"\244Z\305\005\016\361N\021\314\0074\277\366c\264t\277\225\271\300\206\031l.\315\335\312e\2156^\222\207\277r\017\373a\013Oj\241LPR\265\276\034 \201*\027T\315\350G-\356\364K\231\240v"
+	.string	"\235E+\301c\266g\276\002\024\361\251\365\365@\305\211.\314\20785\214\f\367\330\251/\303\235\322\375\355s\211\307)\246S#\247\026\n\204\253f\227f\213.)\362\204s\343\355q+1'*,*.')\037\313U$\314\200(\324)#3 J\205\027\230\226\225\013\313I\313*\205\005\263\032!`\360e\205\265\212\001A\326J\345\372\355\361S\334\244\251\306\355\210{\321\177\373W\3731\232\337\316\271.\251Y\033X\26747\200A\275\245%\244e\3171\336xI\036\237\265\326\312-\355!\334\256\267\267\335d\207G\306\r\007\0339%\327ENT\017\272\001( 0\002\203\234\274m\\\341\035\342>\277\221\256m%\362\324J\216B\027\300\315\317.\267\254e8\026s\221\230\024\241\341\373\303\264\302;\202\240/>\"\266Z\253\021\260F!\242\273\223\354\002{{"
+	.ascii	"\224\351N\315\213\255\276\201\231\020p\234lK&\353\251\2731\021"
+	.ascii	"\230\227\225\006GDY\203s\2576<\001"
+	.text
+	.section	.gnu.lto_findBoxByPermanentId.61.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`%\002M\023"
+	.string	"\266d\201I\320\322(\035\240\221\302\314\275\366\020\230\332\336rx\325\204\003\2251k\345\211\333\217\252\030\324\227&XznfF\034\354\357\027,\304\325\314\002\256\272\334\221/\270\252\254/\006z@\312\244\347\343_1\177K\375\327\b!{\313\235Rm"
+	.string	"d"
+	.string	"o"
+	.string	"&^\206\t\020qh\300\021\307\254'\251V\021e\361\001\276\323\360"
+	.ascii	"\276\323\365\340\002\237\342\375I\330\301\217\316\2250?vpJ\033"
+	.ascii	"\240#\220\333lF\250\221c\373.F~#jN%t\340\321n\033>'\004\035\335"
+	.ascii	"\007\220\233\206\271<<\030\347]\326n2\271\337]\n\361\030\213"
+	.ascii	"~n5\227\240I\255\325\222v\243\271\303\333\276\331.\261%J\377"
+	.ascii	"\356sOK\357\307[N\351\233Jr\222t\030(\252uf\351G\245A]\210\270"
+	.ascii	"\317?^\332\267\337\343\363|\362}`\25726Sm\354\221\204\027\375"
+	.ascii	"\235O\247Fq\236\327\307\2200f\013\177\210\214\216j\025\023\234"
+	.ascii	"\272Axz`\336~\331'\333+m\006\016^\337\311\340\255\025'#\250V"
+	.ascii	"Q\201C\302\323\227x/h\216|\320\315\371:\235\336\316\r\267f\002"
+	.ascii	"\034l\263\2719\177\373u\2156dR\311v\205\013\255\350\020RR\255"
+	.ascii	"2\222\240\326)\206\244kq \330\322!\244\036;_\001Cp\232m\fW\321"
+	.ascii	"\022\301\251U\366 \305\177,\314\2078u\313\313w\332\251\377\262"
+	.ascii	"\347}\316\300!\321j`\344\322\366@\304`vs\266\030\223\"F32\336"
+	.ascii	"\033;\004\277\363*\227\224\312\212\n+\225bZ\271\n\212\013K\305"
+	.ascii	"J\255\\*\226\223SF.\264(L`iY\241X+\251\025*\305\325\202\032\031"
+	.ascii	"\340\026\213\312\205ri\265\\\250\223\353\367\306?\361\023\"%"
+	.ascii	"\036\320w\026?\357&\235No\206\273[[\233\300l\314\f\334\234\027"
+	.ascii	"\304\240\340R\022\322\265\357\030o\310\244\322g\255\265~\177"
+	.ascii	"\310'\027\334\357~b\203\313!\203\213\221Kr\003( 0\002\203\244"
+	.ascii	"\273m\\\341\035\3426\353\034\370\332BcI\255\356\006\324\002\210"
+	.ascii	"\360C\224\337c\270\215\215\272\215\264\306`\002\236p\301\240"
+	.ascii	"\210P\224\342#\"\253,\354nb\037\244%\344\366;\331n\333\026\372"
+	.ascii	"*\336\221\260\031h\to\320\004\233\310#\273\3604o\254\005\346"
+	.ascii	"j%\254#\246\254\341\334\253}O"
+	.text
+	.section	.gnu.lto_serializeBoxNameFn.63.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`\220\004\365\030"
+	.string	"\006i\231L\200\222V:4'\204\251V\223\270d\022\006\250\341\361_\361\024(\330\233\251\033\267\313\360\304\212\006\202\260\211gl\2271\241|\212yQ\235\207\227o\263=Fev\273\317\260P\226e\253\371js\230\002\345\315\220;\356\373[B\310\336I\006\207"
+	.string	"v"
+	.string	"\203"
+	.string	"\331\207K\234\370\220\036\bo\247\313\341n\354\252\342K\354_\352\007L\264Fd\316C\f\364\232 J\022\227\247\232,\217\330.vT\252'7\244=o:\032\335\235RW\364\246c\362\346\212\232\216D\027\267\032\245\270\365\\\366b\307\021;\344\207\273\262\314\244\216$\240\243\253jJ\016\255\035?L\306\035\262x\261\232\242\364\022\352!yT\2220%\264K\375\206@\356\334{{\220s\356kD\002\275E\336\375\221\356\366u\253\020\002E\005\375)\016C\334\t\034\366\3531f\361\202\315\251s\333\356\347\316\305\314\356\343\266m\333\306\313\356;\177\335\237\177n\275\315\252\267W\365\266\252\336\306\352\355\213o\177D\367\025\206\322\346\374\323\372\310\322u\013Ew\177\327\335\367\211s\206\340\267\373P\217\"\336\351\341#9/\257b\344\374Ti\024\334\327~\236\204\375\212{"
+	.string	"\366k\023\273\325\376l\346W\371\364T\365\3109\235\306>\265d\237\0377\314tq\214\257\223\353\367h\023\303e"
+	.ascii	"o5\335\222\301\370\321\245$t\350\310\0160\021"
+	.string	"Z\303P\250\332\320\n\340\366ad`y\026P\207\273]^\356\215\315\303R!\345\3019\f\236\220e\352\217\275\370&M\231\025o[\202c\375\3365\3159/\350\216\371\025\360TM\253\267\220\351\r\301{c\220\375z\361\273\312\266\316dTJ1f\n8\r{\f3UV\274m\335-<\025\r.\3477B\030l3\324\200\373\267r#\204q\231\031\006}\035d^\202\276_\315\320\267R\322\302\231\230\032\237\215PX\343\333=u\256f\274\354\b`R\035\274\323\005n\203w\027+a\302\305\212\2529\347\034\302\342\026\244\246\360\265\n,\316\001\315xZ2;C\352\245\235\035\215E\313\301\212#\021 \353\324\302q\220\255NABS^I{\311\224\214N\273\261\260\213\235D\251(q\215\351\324\257\013\217z\251 \222YP9\002<\202\240`D8\033\247\361\032@\221\007f\250aX\304\bV\"A\224\024$I\n\035"
+	.string	"\003\221\241\242\003\0208\251f6\0059\007\237d\\\273\225\254)&\215\200\267U\320\005=Y\212\024X\021p\222\204\177(AE\007X\225@\312\016\237t\341\236\024\272\336\337\312)y2\370R\307{R\350\37261\276\342\323}\026\263\221\315\352\260`n\375]\2331\005=\362\273\002\277"
+	.string	"?,\375\300>\242\2069D5(\373)SbG\021\332$)^\321#\273\fu\025$,Q\303H\226\314\031L\220"
+	.ascii	"\326\037\322\377\335\213)Wg\315\203<\353#\356\274jt7S8v\317\277"
+	.ascii	"s\354\255],s\255\236<IX\375\250\001"
+	.text
+	.section	.gnu.lto_serializeBoxPermanentIdFn.64.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"M\t"
+	.string	"\326\021@9@\305(\035\265^\r\327;\003\201\213\320\031\307YV\344'\270S\212\316\r\371\233\334\267\240\263\0363\252O\f\307\0351\216\350\314\360\314mK\n\211[\211\271\266\321\332M\244L)-"
+	.string	"0"
+	.string	"0"
+	.string	"\227?\355\004\227?w6\200\307\217}K\344\324z\355.T\217w\317\316\177\311\005P\251\322\023\323\260\273NTJu\353m#\330\206\3663\001\177\226\245S\323\307d^-\n*\273\0341\001\353z)!\266\257\261\235\221\024`\341i\177\344$\335Y\030\037\330]\255\240\354\306\215\023\264?\307\027\004(\037lh\311\327\324\315i\200+~\302i\273\032\f\276\311\205\205\006B\272\374]1*\026\030\313\2241;\226R;\354g\273\273\326\225}\326\377\036\003\243\255\243\".B\355\341\214\266\316\003\210\373@\212\t\210\017\364\2048\3101\360\006\222\bA\321\266\205\240&\356\263\325\225\035`.\223f8\223\251O\355\317\226\017\017"
+	.ascii	"\357b\310\304#p4\341\202`z\240i&\344\301\006s\215m\205\361@5"
+	.ascii	"p\005\314\rPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeBoxReply.65.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`\353\005\005&"
+	.string	"jE$\017J\200\330U:\177\025\020\2418\n\027G\330Q\364\364\370\251$\2418\353\210~=CW7\274\\\314\2522\r\302\301\367\316\222!\332\021\021\343\367\256\371\236H\273\347\336#\212\226\2303\215\2472O<Qt\032\272\201\r\021B\b\331;\311\334"
+	.string	"\322"
+	.string	"\337"
+	.string	"JX<\037\334\346\221\004\237\244\235-\313\331\350\212*\347\334\240w\330\2476\364\267\373J?\022\374\222\213\337\344|\364D\225s\263A\337\330\247\335\274"
+	.ascii	"\365){\034\365i\260\033\354M\036\371K\236\214K\306r\3168\274"
+	.ascii	"\343\300\321\346{\355\026\007Okg2vU\323\032\212o\260\037u\005"
+	.ascii	"?\302\202\222\302\323n8\207\267\325\241\264\361\331Z\301HItY"
+	.ascii	"\002#e\215\263\350%\232\022{\027r\b\235\220E\b\362W\277\307$"
+	.ascii	"\214\273\016\241q\025\225p$\251\007\200d\021\305I\234\252\236"
+	.ascii	"\365\004H\310\241\233\2624^C\035h\3158\362.d\r\364&\207\027\246"
+	.ascii	"#!q\\\024\265u!\211P[\316\271M\022/\276\363\351\262\t\030#\245"
+	.ascii	"\215\337\265B\316\271oPR\371\006\360\356\243\335\315\353NW\004"
+	.ascii	"\006tf\267\013\310n\0238\326{\300\255\336\002rp\276\364\337\\"
+	.ascii	"\311\037\200\275m\363\246w\355O"
+	.string	"o\332\223\374\355\245\274W\365P\357\224\275\215\262\2671{\373\336\333?\320\026\341\332\231\312Y\3063M\266\222B\tr\253\037\353\227\3627\375O?\324\325\356\367\251|\253\273\355\024\237\322\b\204\222\212\224Rt\267Q\216\325\317\352\026J\220\352V\375\253O\005\233\274\252\333\347S\372~\031\222\352;\273\225\002\354\300\344\2424\246\243\352C\351\266}\376D\305s\021);2i\211\201x\223\376T\267>wr\263\021\2339\351\001\207\225\322\330\007\237\356\366\351\275\323\231<\252[(\250\rO7\0331@&.\243\204`\350n\272\261B$\353\264DJ,\347&\203\247M\241\033\007gT\274\354\002x\305?\246.\004p\001|\343\232\006\361/!R.\260\261\234\211\020\274\210h\205`I]\356\365*\025\352S\0028\345\0023\263\004T\365-*\026<\250\303\265\210\330\341\22131\002\226g\031\201\236\371\264s:\365A:\365\351"
+	.string	"\374\254/\340\002\033n\201\022\002\272O\f\346C\230S\274\354\177\347KF\261\206\217\272\216\342\033a|1\212\321/\343P\r\253\030\343T\2151\211\206U|1\017\363i\\\032\336\347u\310@B\203\372T\033|\347\357\r!#L^\304{\246kw\305\375\255\022\275\373 \033\374\255W b\341\225*\312R\006\267\3557\225\206kx\347J\261\350\230\206O\306\270\006\350>\333\366v\252->~\301\254RD\032\336gwsx\361\262\373m\230\224\230\306G\335\351\355\273\336\345\365\344v\275\035\212\234N\326\373\317.\303\217\217\204\332\363\313\365p\220\355P\\X\177|\026x-z&r\275\037\017H\343\225\310\361\240=\300\035n\235\203\037\037\211\021<\300\0238\024\275\334\t\234\356\007\3049\320i\037\017\357\207\353\361\371~\270\266\tt|\324QF\254"
+	.string	"\341\341\030\032^v\315k\226\203\257\266n\037\033\235\245\370Qg\307\256\200\334\207]\235 D\344V1\220\274Z\274df\001\221\341\340F\261\212S|\004\252+\316\301\327b\206\335\331\327U\214\263"
+	.string	"\351k\270\245\251H\206\227\030\256pq\232Z\317\345\317\272\006&-\343T:"
+	.string	"\033\300\307\356\234k"
+	.string	"\337\340\016\200\373\316\313xde3b0\260\320\310\342e?\300RupZ\244\326\307\207As\316y\305\313\337T\001X\007\377\352\030\210pT)\026\r\243(\305\002s\250q8\205\fR\314\004\025\310\214\b)L3\006`\002\221rfu\020P\251\206\222t\223\3042\244\337.W\2727Syv\254V\"\013\263\013n#u\314\331\021\351*d\003\204\325\002\270\350\270\307C\371\336\227\2163kw:TjADC\253"
+	.ascii	"\215\n\220\035\212l\366\215\313\036\256E\002\213\301 $\273\f"
+	.ascii	"{5\220\230\035C\325\364\250\362:\f\342\330\211\241\273\203\030"
+	.ascii	"\322\\\220\034\005$\202V\255\267\3013@\200\201?%!\377W\310\322"
+	.ascii	"22\265P\016\204\225\236\244p&\177V&kM\204\270'1\316\353\b\272"
+	.ascii	"\276Za87:\240p\247\3628\302\310\037,\321\307C\013T\210\314\364"
+	.ascii	"I\016\030\00538 >\213\306tl\302L(]\030\360\036e*\324D\337Z\232"
+	.ascii	"\256\352\034/\004((bE%\371\221\303\351\333\212\343\375e\300\344"
+	.ascii	"\371\275\205\365\206\213\211\342?"
+	.text
+	.section	.gnu.lto_initActiveBoxIds.66.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`\346\ru@"
+	.string	"jl\354\027BP\036R:+\226\271%\f\237\353\363\242`\370\351\277\203\352}& \007J+x\222\037\325\323\337\272\254\316\2104\241\202\223\001\237\027\240\302\255\020\340 \021\256\001\205\007\304\240\361\214~\340\277\332O\b\3312\311o\001R\001v\001\021\200_\231\2170\013\277\366\231,\344\237\035\215\370%\022\340\025\022\370t\203'm[$\204\257\334"
+	.string	"\370\025\301\237\330\257\352\233\330\257D\346\2747\307\332\273\231\333r\223\250m[\252\273%JJJ\211\247X\275\332<;\255\304#\2302P@*\212\300\200\004P\007\002<95\001`ZRJB\032\n\217\202\300\037\273\252\267\211\374&x\212~\236^WG\240\376\262\272\302\274\016\231\246V\365I\333\310zJ\354K\355\006\226/\240^\b\344\005&d\222\327\347ph-u&\247\246\243\314N\240l\356\254\007\034\313\354\t\324\tqM\320^\207\\\252LY"
+	.ascii	"9\017\367l\250V\373\001\346\0030\303\364\223:\254C\202Q-<\247"
+	.ascii	"\264\323\2277\255\035\305\026E\204\260|y9\2002\310.\334Lj\223"
+	.ascii	"\2248}\036\241\217\031\260\257q\351%\265\301\240\322\327!\307"
+	.ascii	"T\017|\306 "
+	.string	"\017\255\322Jb_aOR;\240\221qy\0352\251^6p\360\234m\254\221\302>T\027XI\343\372\332\247\352\220^T\002si\364^\006I\245\205\177\376\3012\355\214\017\313\327\227\037\201=\b6U\006)\245\201SX\276\242\374\367:d\224\255f\237|\325\312j\265\311\257\372@\312\206(\311\313\250>u\2059\236\371\346\362*v\377B\264m\313}\364\372:+8s\2231\263\007f!\237*Xf\026.\372\307\276\303\265i\324\250.u\357\275\200\022\227^4\213\265\273\202\345r\020\366\267\206\023\317\330}\354\324}\030,s\f\031\375\343\357p\315P\324\330Dh\251\371\rX\0014l q\315E\263\356\025#\265z\326\303B\370\233g\346H\032;2\357\340\321?\262\223\334\030>\251\326\275bn\026\373*\231\357\324f+\216\257\026\346\333\034\002D\260\371\303\257\331\303\367\234;<\356\314\3416o\320P\005l\316"
+	.string	"l\306\3609\347\013\247s\266\360k\256@ax\265\263\220m>b\233\203\277\346\337\337\316\354\257ye\233U\266\371\262\315\3156_\304\002\262$\025\345\335\365\323l\273\246\213\332\350\332&\346q\377\236\177\316O\347\177\373\325\376\345\177\314\347\343\371\036\376\334\2358;\217\343\313\325!\272]\017\023y\036^\215v\310\332\266\205{\033\322\342\331\254\002\332\341\337!\022'm\333\246\033\277\016\221*oL\204Y\250v:|6\026\246\021\333|\016\037\352$~\315\3450\037y\034\016\026\365\204k\314\302&\377\311\206\355tX\246\235Ah\303Os\3637G\016\307\310[-d\220\313\231'\235\320\004\276\211\375\032\276\363\310\3314@`l\266^/\222wg\211\332\266\031\f\nt\351\001\307Zd\333\266\016\224\342\242W\315\350\207\250\217\023"
+	.ascii	"W\311\367Vl\206\240\230SNi:\235\342\335\212\305p3\\6Y\354)\377"
+	.ascii	".\206\313\275\325\b\253\247i:\314\b \367\030\361H4\003\266m\373"
+	.ascii	"k\263\2603I\264%T\361\353\215\351*\371r^\302\256\017\016T\251"
+	.ascii	"\267\374lG\341\314\333\202\"Y\270\033z\3137\334\257\035\300\032"
+	.ascii	"EW\206\354\320,]%S\310\223\244\341\256e\303\363\371\205\313\325"
+	.ascii	"\200\275p_\350n\331\305)Q\272\312\274_\270\032\356\241/\001\226"
+	.ascii	"\034\244\225,\362)s\303\223t\225\\\341\376\271\034&\252i/#V\272"
+	.ascii	"\275D]\210f\302\253=\262\261\346BDS/\307\b\373\265\302]\351\366"
+	.ascii	"\370\226\227\323bF\026\374H|\322J\242Y\204,\255\205\210\246\022"
+	.ascii	"\231\"X\021\354W\013\367l_@\267W\364\363|\322}W\240Q\244\253"
+	.ascii	"L\300%\311\231\341\325\302\237~\004\273^ :\332\312\b\tcmk\254"
+	.ascii	"b&\321a&\f\334\265\2551\303W\356*\235<\301\377\362\225Q\244\350"
+	.ascii	"\037S\260_\327\373\347!d\321S\323\206\325SnC&\013\t\237\324 "
+	.ascii	"\231\031\222\211f\t\273\302\216\216\272\234\004U`\253\336!\224"
+	.ascii	"I\324\030d\004\004\356\375\256z\357p\216^\324\230\244C\257\311"
+	.ascii	"'e\323\\3\321,uIX4\213uZ\002e\275J@o\250~\3737N\024\261\252\261"
+	.ascii	"\342\020B\343\306\216\033>h\330\b\3568\r\0378.\333\230P\304\252"
+	.ascii	"\306\214\037AzP\371\330A\243\007\225\r A\250&\f`\253\0378\200"
+	.ascii	"P\t\261\262\002B%lb\375j\341\025rQ\254[d$j\333b\001\361\345/"
+	.ascii	"e\323S\376\362\334j\375D\302\377\302D09:\007\373\365\314w\027"
+	.ascii	"\345\231$Z\024\254\236\356Ap\225T}\006(\\V\017\260wx\271:\314"
+	.ascii	"\3772\267\262\267\251\177\b;\274\024\256\322\241:E?o\fH\335\211"
+	.ascii	"9\334\201z"
+	.string	"N\306\360I\263\356\325\357\356\016[\001=/aw\007\007\0325w\024\316\270-\350\200\0167D\210{\2703\341uYc\310\356\317\226\024\001\020w-Kp>\347\360\345\034\324\266m\333(\016\027\304\275\334K\200U\231\273n_R>\002\037\356\320\303\375p\277\325\3109b\245\313c\223\267F\217\207\273\322\345\351i&1I/\321:\334\317}\001]\336\315\363r\325\016x\004A]Z\t\256\226\243\013\204A\017\357\363\234\231\003H4CD\323?\036\335\2446\267\213u\225Q\004u\225\334O\255\346\207{\220\213\223%\001\370CX\366r\361\345\016D}\241\311\022 x\274\007\357\231\277\22263Q\243\334\323U\362/OS\325\275xG\020.\274\\l\207\025\336/\235\357SG\f\352\024\341\302[\245\366-\241Z\335\204\341>\316\2319\002\201\021\250q8\005\225R\246\002\031\021\005I\222\244\003\201\005\204\030H\251\262\r\021"
+	.string	"1cP\321\310HJR\311\001\337qq\"9\365\301dR\021\321\210$\272\264\r<\271\332p\357A\372\307;I\324\354\036\265\233e\212m\022[\327\273\004\202\313\330?\341.\364\343\207xxS\375\013w\003\306\200\210o\2571\022_\f\211\027\302\372<[pgAr\353"
+	.ascii	"s \301\367/$\302\261\361\021\207W}\t5\254;S Ao\252\210\246\357"
+	.ascii	"L\021\300\371_\346o\244\300\242\375M\243}0\rE\241MR\211\342I"
+	.ascii	"\344\242\370\213\3057\362\333"
+	.string	"KvG\307,\025\004qh\327\326:\\KX]\342);\320\254\026m\215\b\320u\360#\244\350\275\007\001>\360\351\344_\f(\302\032\036\344Lf\211|\221\035\204+\313d)\256D\006\342H\362H\233\343\230\007\244\200o\242>\350\331sX!'\002G\032\253\342\n\231\003YD\375\357\241\tXb\027\\\267\264Z\306rYg\364\363\034\224\376\217\001Kd\037\004LF\365\031\250\3621\340\333\333\300A\345D\246\244+e\265\254\235\361\341\277\3069\330\376H|X]\305\034\346I\225\311J%\252[\366\233\213\220\232\315\027\242\bU\271\"E\016\024\374\214}\321E\177w\031-\002\031\b\355K1\311\247\301\343\376\"a$;F+\231\371\003\372!\037^|\017)\314\270\032\b\006\236\211(\350q\026\2531[\344\372\023\206v\352\230s>\256_\245!CjJ\256u\2115\037\343\234\214\0131\352q\351\362z\267\275w;"
+	.string	"R\326\202A;$\272\271\247\006\373\233"
+	.ascii	"\307M\027\247\342\321\306\355tn\024\330\333~\260\205"
+	.ascii	"q\215\304\271I\001Z\325\347\203\231\265'_\354\265\310O\"U\274"
+	.ascii	"L\354\\\020.\326gT\336\303\254\316\370\354\035sk\260\021\303"
+	.ascii	"\270\366\307QS\2476\0339\260QZ\322\307\031\373\030F,p\220\021"
+	.ascii	"\304 \004\250}SrE\r"
+	.text
+	.section	.gnu.lto_getBoxIdState.67.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`7\002-\024"
+	.string	"6'\213I\3000'\035\333\273Y\310y\017\205<_\352\224\272\341o\325U\007\226@\271O\355?9,Q\337\355jOCms\347\346\311\377g0\262C\214\243(2\354\210>\202S\370S6\213\034c\256SN\276+*GB\366\336R\312\024y"
+	.string	"j"
+	.string	"y"
+	.string	"\313\242\266N;\367\250\265\250)F\255=\005G \356,\260$t\247\\\021\272\363\377\0314\250\235g{%\200\326\004S\256\305\216Z{\263&\261<\033\322)\233y\276=\033V"
+	.ascii	"f\321\r\002\322\230\222\004HI\027\333\371\310\022\255(\035\260"
+	.ascii	"]\007\226\034\2000t;\020\333"
+	.string	"\262\2047C(\266\303I\222+\243\034\373[\376\331\335\230C\224Z\353Y\267\013\332\213\373\177\303\377\224\237e\002\334u\035\216p`}\273\2775\260D\305\345\301\306\301\277\327\303\215\364o\007\203\301\340\373\350\227\374\220\363e\347\203\234\037[\247\335\217\363E\312\017)\237R\376\224|I\371=\371,\371+\"\302\273\242 \243V\240\240W\265\232R)\326\267\373\327\276\277\303\276\275}\252\255OG\254*&`5i\325ZMv\376D\334\271\2002\377\273\"\271)\332\335aK\250\334\320\354\004K[n\371x\3358x\331\023\303\376^\304Zq\016d?\300\222\342\356\336\334\227\r\270P0\264\230\030\272\223\333C\350F\215%\033\323\234\004\222N\374\250p\334\305Q[W\"dH\313z\177\353\221\373\332\035@\267C\372\234\033\272\255\213}1\363E\361\261\206W\267\363[Cwn\207S6\270\206VI\307\263\352F\372\016\375\350"
+	.string	"IF?,\\0"
+	.string	"\342\376\224fE\345\305eT\301\311"
+	.ascii	"C\223\2210ZpI\311\031YF\\h9#\313|\313I\316\310r\201\346ff\246"
+	.ascii	"\201\26623k\261\271\231\235\b\370H\363b3\303\031G\233\031\254"
+	.ascii	"W\267\217\276#\210\252h\254\031\211\310i\202l\021\361Z\326b\377"
+	.ascii	"\374\027\373(\266\276]G\326Z\004A\313\307AYk\255\241\214?\372"
+	.ascii	"_i\341\325\305z\344C\b+\\\367<\353\251\n\0075\331\260Az\003%"
+	.ascii	" \220\002\021\272\354\217\030\256\205\266\230\001\032\344a\244"
+	.ascii	",\327\212\2030_A\325G\213F\327\216\035\220X\325\266\370B\f\330"
+	.ascii	"|2Z2\231\026\023(q\035\232\375\260[gO\316.d\374\346\217\211\267"
+	.ascii	"\200@\344_i\234\304|(\007}.41\320\244p\0054\302\332\003"
+	.text
+	.section	.gnu.lto_packFlightModeFlags.68.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`\251\002\215\025"
+	.string	"\006g\213J\260\020V:\340D\203k=\371\251\235\257\262\227\343\221\33630\327\301x'\201\376\331\f\303\237\212\227\273\225\210'\333*\320\031\360S\201d\263\207Y\313\317\316*%\373\232u~h\"T\347G\331\247\264\177\366\311\b\322\b\331r\247\024x"
+	.string	"o"
+	.string	"u"
+	.ascii	" h\266\212\352\323\260{\317\t\307\210\306y\236\256\220\203\220"
+	.ascii	"\037\353=\310\217\033\344\222\322\256*S\344X\227\322\374\337"
+	.ascii	"k\207\244&\334\256vU\245\027\222\240\336Bg\241\036p\301Aw\340"
+	.ascii	"inw\243%\220\316\316S\034\273\n')|\274\261\241\265\016\200J\021"
+	.ascii	"\265\332\341T\220\234!\234\271\253\241{\340\307\3360\206\217"
+	.ascii	"\316\316i\252\344<OS\334N\347\346\270m \333\nl\272!\336\037\273"
+	.ascii	"U\251;X\253\221\332\274\357W\375\350\256\373\242\233V\352{xD"
+	.ascii	"\261"
+	.string	"@yq\2369\305\033\247pT\"\372\321_\344\033=h\233\246y\t/\223\f\363$|\340\321\214\211\3400\001\215m~\274M\363\1776\375\"\221\262\246+\201A\030P\347\351\033\371h\003\345Gj_\304G\320\356\233\360\326y\376$\2418O\037\001\213\224\037\355+\377\341\001\273ts3d]\326\236\210\324Dm\251\345]\204\334]-\003\244\0317=7Z$Ytw\245\205\036\347\217%'\241M\201\241\022q\\\336\211\177\357c\227\357\307\322\n\3413\350\204\275*\201\354X\fAD\277a\r\265a\223\326\365\203\017^\364\270\216}\360%5\373$T\253\355\362\352\355D\216\\\265v\004\031=\316t)\204\360fk\266\357F\227g\277\305D$\006,'3\230\3128c9\231\301\020\304d/\225\314%\005\306\244\205\005\206\"\343\300\345\005\306$&{\001\360\n\311\f\246\322 &{\271 \274\244\274\\+12\027I"
+	.ascii	"\303b-1.\031\030,\306e\372l\337\037\273\226\273-sCl{sk\315\305"
+	.ascii	"!\332h\261x\252\226g\226\215\024k{<C\3249\327\024\335\377^\326"
+	.ascii	"\340\351\241\316\tX\020$\364z\236\347Y.\317\007^\345\201\347"
+	.ascii	"\211\\\255\353\0068 `\002\221Y\311\r\177\214\324h\362\353Rm~"
+	.ascii	"U:\215\245{\303\245\211\245~u\222awv\233(r\337\211AD\017\277"
+	.ascii	"\214\006e\tCe\205\206&\031\227\177w\346\202\013\3370C\221\252"
+	.ascii	"\333\201\0251\002\354\326\265O\016\224lNUj\024\357B0\034u\030"
+	.ascii	"\231\037\007NL\270L\027l\3100\303H\027\365.\016\325\202\206s"
+	.ascii	"\227\350\300w\326\303pi\215\037\302\350\356\325\004\313@\276"
+	.ascii	"+\222\231\332\360\004"
+	.text
+	.section	.gnu.lto_activeBoxIdGet.part.0.82.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\215\n"
+	.string	"&\025I>0\247*\0350\337\214\bV\r\212\341wos\310\311:wg\320\337\256T80r\376\3003\300VwQ\024\0331Jh\241\234\372\210\240\252\210\201s\023\302\271\026\272A\305\360\242\265\275\245L)8"
+	.string	"5"
+	.string	"5"
+	.string	"\033N\211e\333\033\216\311\247{\261UE\005\001d\346`\327\323\036\365\344\247k\302\223\237]\013u\375w( \326\240k\215<\025\016+\235\335\265\205\344\216\267=a;c_\013\001l\337\376W\2621\266\311\306<\332\326\274W\272\214\004\275m\261\254i\237\300\013\230.#\371\262k\242`\301\256\227y\264\204\345\361\341\f\224G\370\005\312\243\375\001\016\233z\347\317~`\363\001<z\203\313w\217>\327\341\221\357R\377=]\037\212J\205Y\341\341\356\256\365e;\255N\347\275\377\224\b\221\204\222\335U\204\007\353\212\f\002\027\024\243\315\023\375\321\2146OE\210\003i\032\031\026 \355#\3424M\203\267\020\206H\343\3306\221\2069\\}\371\337!\022d\252j\210\272\223R\225U\025f\373\222\327\0338\002\316!\266\001\020"
+	.ascii	"\3571\036\026\356\320\206BY\340\fc\312\225\271\025\220\007F\004"
+	.ascii	"\22709O\316N\273k\216\240\316\360\220\232B\363\322k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`\252\002\025\017"
+	.string	"\326\027[D"
+	.string	"\223\232\016\026\320\351\306\201\275'.\370\364\003\344c\245\332U\224}zej\244kR\364\233\365\\\270f\202\212\245\377?\337\245\377\377\375\254\373\232\371\255\252T\023j\255"
+	.string	"]\313\032\210M5n\264\356/\267L\001F"
+	.string	"H"
+	.string	"J"
+	.ascii	"Ud"
+	.string	"\203\240\317\002Z:\244!\007\3721\320@\177\005\374\037\312\016\203\277\357\373B\255\001\202:C\201\013\220\233*N\202\260t \320)\220\377\355\346\205!\376\017M\216\2330\177\3772-;2\347\234\003\3724\360?\273\0047X\344\211.\205\351\241\b\026y\351Z\200\371\360\003\213\274\225\234'\364g$\364eD\350\223 \364i\240\364g\234\364k<\350\273p\320\177\261s\316\037\324\240\037c\261\232R\211A\277.\370\215\250\3406\022\364[l\227\211Z\224GUJu\336T\247.\200\344\365\352N7%Ld\222\267\323$\253p\310$o\253U\221\215Gr\205CD2\262\334B\222\210\036;'a\025\212\255\316$r\345-|\311\001B\002\213\\\321MI1\"\004\026\231\242\2132\252\t\337\272\025rhJ\331\305\313\355\216Zx\274X\027oX\026rbe\345\027o\236\353:1;p>\026\203\272\245|\344\230\001 Y"
+	.string	"\335uaAA\244D\362\307\033e\222?T\207&\331C\227\332\301\001A\257\316\263\252\252V46 \320\002\2411\233\003\210R\360\033\341>JP\370\300\"\315E\272"
+	.ascii	"\345*,X\032\322F\332G\032E\230`W\330\201\244\335\324\246\337"
+	.ascii	"W5\335lb)N\031\021[\235\234\017\210\003>:\f5\001\022@\022$A\022"
+	.ascii	"H\f$\177\240\343,\005^\030\206%\032h\006\315\331&^G\215'\024"
+	.ascii	"\266d\357\016w?.\031\360{\244\0359\322h\342QK\242\020\f\n"
+	.text
+	.section	.gnu.lto_.refs.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375 p}\002"
+	.string	"\202\306\021\031\260\247\320\030\f\3030\200$\t\304#\320\226\356k\215\020B\310\022\273\345N\001\037\202)p\331\213\231\t\032A{\240\r\264\005eR\027Z\241!K\250\035\324\202\332\245Nj\217\332\250\245j \200\035=\264\355\314\316\025\001\001"
+	.ascii	"J\224&"
+	.text
+	.section	.gnu.lto_.decls.540a4f6c8d882518,"e",@progbits
+	.string	"(\265/\375`J \r\222"
+	.string	"\032\35744Q0\220\312I\007\355\232\006+H\366\3664\207\177\2315*\362\3354uL\325:\013\334YE\372\234\243\377\314\354\247#+\353\362Xc\\w\334}\231\247\"\326\305@*u9\364|D&\034\204\024\256\263\356\261a\\G\027\263\004\235\314\275\206D\"\331R\246\265\002+\003Q\003o\226\027-M\317h\326\363\232\237\3170\032V\343\302\275\320\0364k\316&\235\336\036\276.\276\275N9\r\360|w\301\025\022\257N-\207PGp\220\232r\b\025\312uXRl\235\332\355@\365\220N:=\317q\031\246\343(\333q\334y\007\226;\203\221\251\003#\306\016\013\016\350&\343\334\260\354\370\215\307\370\034\235\027J\035+\343\364E\357\336[\202\247\310\0162\346\2074\275\023l=7Y\317R\353\271i\035\301c8\f?]\270\027\313\275w"
+	.ascii	"\035#=\206\300u\312l\300s[\bu\031\345\274d"
+	.string	"*\337\233%\262N\177nX\371r\220\212\202\243\374\345\331\201\326\0203^D8\1774!\351\224\213\017\224\207)W:]s\n\365\204\211\323#\252\323\313\260\236\3178\215\243\254\306X\316YX\313\205\234\367&\357\275\300*l\346c\357-\342\205%\301\317`\177\n\nX\215\267\260\031\277E]\320\345\353\356^(P\215\2510\324:\241\334\213\304\312\207\314\030+jz\367:\205J\224(\321\363\026d\312\2205}\007+\013e\260\262\025\276\302Q\021\\\346\374\341yz\272jv\372\n\3263\331\007x^\n\036\264\236E\250\334\307\"\324\377\254?C\371\213\307\254\222\251y\311\356u\202\370\231\322#\t\023\347\217\016\332\236\024\037\235\262\223\305\316O\016{\n\nn\217\317\373u\357\345\347\004\315{\221\374\374\201s/\362\207Y\001f\005R/\252'ej\372\017\353{\005rr\220\272r\b\365\303\3377\210\016\364\267\\\325\013<"
+	.string	"\320\200\231\203\370{,\006\27336?\227Y\322\375\2744\367s\222\334\317S;0\231\227\370\273\004\257xS\361\263\005\017\372[\312\331\tV?\327\340F\367_\356\177\335\317\367\3471m\377\237\377\347>\366_\354\006\374]u"
+	.ascii	"\020\266\377\016\374}\303\317.~\026\363s\230\237\301\374\374"
+	.ascii	"\345\347.?s\371\031\355\347\263\237\315~\266\362s\225\237\305"
+	.ascii	"~v\376\374\365\363\224\237\275~\356\372Y\353g)?C\371\031\353"
+	.ascii	"\377\331\377-\377\321\256~^\362_\304\337O?W\375L\3653\363g\246"
+	.ascii	"\237\225?+\375|\374\331\206\237e\370\231\3703\f?\027\375L\364"
+	.ascii	"\363\320\317-\374\314\302\317'\374\\\302\317 \374\354\301\317"
+	.ascii	"\030\374\314\342g\237\237M\374|\300\377\265\237!\370\277\367"
+	.ascii	"\363\003?\217\3709\201\237E\374\\\300\377\273\237\201~\376\371"
+	.ascii	"y\347\377\t\377\017\370y\375_\366\363\357g\365\347\377\307\373"
+	.ascii	"o\346\277\335\177/\377\273\374\347\362?\305\1771\377w\372\372"
+	.ascii	"\372\372\376\024\305\237\"\360\013\361\020\321=5Q:%[uh/\035\272"
+	.ascii	"K\275\227\235\315\247ec5\224w\224G\351\256\365x\357\321y\237"
+	.ascii	"~Hq\242\226$\376\316zw\365\326\017\222\024&Y:\355\255n\255\346"
+	.ascii	"zo\265\024\236\344\355\255\224\025\360a"
+	.string	"V \207K\023\344\230\232>}\256\307k\246\036\2563rA:}\032e}*\265\376\375\253\027\271\274\367\362\310q\336%\022\017\3470\223\370{\330\362\002\377\323{\377\333\377B)\334{\204\336\265Y\243lA\016\031q\007\270\3672\201\224\027y\004\241\2046\231J\266)\346M2m(\241\316\24329\265\344\340.G(/\222\tt\241S\313\013\275@@(\223H&\007wy\225H&\353\270M\246\022:\265\004\241\204N1\225P$\023\350:\357R\351D\262\344\013E2\227\240H&+\235S\314\013\235b\016\300\227\204\322\264\324\207\354\343\2432y\235\232\210 \227@oJg\363\326\335\313dJw\271\300\275D\232\313:$\020>CzsB\302\202l2\001MHT\315\233|Sf5\357\315B\242q\233&8:\337\256\025\277\035\221\020\271LJ\367\026p\235\3676\335{\344\373v\357=\336{\177K\"\316{\205"
+	.ascii	")\261\232\232\356\215\022j\272D\216hJ\3676\231\335\031S\t\245"
+	.ascii	"j\002\321\254@\261n\016\347\221\261n\335\324r\205\036\305.\023"
+	.ascii	"\233\025\213\t\265\246\235\260\016\035\331\323\211nu\006\020"
+	.ascii	"\265\345\324L\372J-\214\020\270N{\t{\311\002\307\374\222\003"
+	.ascii	"G\333\352hx\356=\340\303\222#F\346:\355\252V\262&\351\302\222"
+	.ascii	"\246\244\223\374H\2033K\322=X\212\007\223\260N\217\327H\376\353"
+	.ascii	"\354(iB\227\003\t\025\017\275%)k\316V\202\362\244$\332S\214\345"
+	.ascii	"\377"
+	.string	"\375!\217\354\331u:\326S\326W&\211\221s\264\215\264\024?\357\361'\356L\324\003j\262\271\324\374*\322R:ScVxM\204'\rZ\322\262jH\013\351i\022\345\211\324i\020!v\202S\213\323\351m\221\365\375\203\243\035\325=\260\360\227\217\206\3629\202\270\027\t\030\326\275\316K\320Q\315\243\241\370-\312yy\\\360\005\204/E\032+\303\246\246\357\275\365\335\006\212\325\304\2651!\335\255\1773\373\351~hC\244m\255)\332M\375\224:/s\207j\313\0176\275\273\\>\320N\251\017\231;(\"\321\365\375\325K=:M!c\310\254\265w\374\331t\366X\344\217\266-\235:w\242\224Y\250(\035X\223jf_9Z\351\027\267\226\245C\247o\245\277\223\235\224\224\222\202C\352\024\005\007\251*\207P\033\t|#\331:&\232\217Ns\372\330\267\337\360\270\304\3728\332\227\371\322\276\354\206\343\370$\235\227)"
+	.string	"\222\020\0375\321&Y\322\364\255d=\307\201\323M\265\r\220\260+\235\362\033\356\201\243$xO'\351\274P\23596RdE\3263\t\365\207I\250@\340Y\217\303\366\304\274t\372\016\222\207\247\032Q\022f\245\3236\034e<f\003\305\343-\274\206\311\342\353\211\257':\034B\345)\300\333(?q[\360\234\350"
+	.string	"\205G\354\t*\253\323[(\277}b\261R0Y}\341 u\247\t\360\326\211\312\245\334\363\352\364\203eb\257\222T)\363\321\351\355\325o\255\354\022~\322\320\027\307M\247\257\343 \265\207C\250V\t\3606\207\2351]\356\302:\345\341\020jUUw1\025\237\323\027=\237\270$;\226:\375\332\004u\013\004\312R\3319\236{|\336\247\337\226/}lzW\031EbGlI\214L\221[\252\333\251\024\024\374\314\312\2455\207\354\324\036\271OT[\332]\247\267Fl\363\327\371\020\245\n\272\205f}\004\317\037L\251\237\351\2543Lj:\265D\316%\212NO\311\2201TqH\235\332(\033\204\243\027c\205\334'-GT\f\335z\034\370bT\353\343\366\307\257\243\223V\244j\312m\375m\217_\347W67\004+\314\372\237\232\223\223eV\260\334c\343\342\t\353\001\016ly\313\264OU;vX\246"
+	.ascii	"\302\336\322\254\351y\351\2303b\227n\231\266z\360\252\274Q\201"
+	.ascii	"\243\216y\202\323\203\224UZ\245U\342\302z\223\2342\303\264H\026"
+	.ascii	"\311*\t5-\3352O\213\353\207\246\207#H6\351V\351\267\003\354\212"
+	.ascii	"\331\251M\376\214Jfk\253\311/\211\217\317\036o\223\267\b\030"
+	.ascii	",\034\334\226\234\366\336\036}r8\321!\327i\367\361\230\261\211"
+	.ascii	"\313\203\376l\355-\315\341\275y\323p\204\232\226\2072 |z\274"
+	.ascii	"f"
+	.ascii	"\252KG\357\275\341\374\256\306T\361\350\264{\350\263\244(p\232"
+	.ascii	"j\231n\3636\355F\250i\345\356\362\264\270\356\215\"a\275|\365"
+	.ascii	"\350\221\367v\323\323\205\306\244\254\323\306{\2324\317*iGb\207"
+	.ascii	"\225<\244\2603gz\215\230\037lz;K\270@\255i5\3575\\t\230@\271"
+	.ascii	"\201\335\345\024y6\253\334\245I\213x\201c\322N\352\236\022\265"
+	.ascii	"$\032\346\343Y\206\255y]\255\034m\2716C\242\211D2\260u\267R}"
+	.ascii	")\222\324i\327u\031\216:\320v\357\271\246{\016\322y\235}\025"
+	.ascii	"'\252N\255g\007T\333\327\307\016\250@\034\244\266\312#.\332q"
+	.ascii	"\254\206\237\367\351\203\216\233fM\357\336/\017\374\344iI]\315"
+	.ascii	"\221!\323]V]}k\260\366\334\334\372\t?/\223\030\366\304\227\276"
+	.ascii	"q\202\366dc\35367\254\267\035ac\235v\033\\\226\2232(]\272t\030"
+	.ascii	"\262\237\2310@\344\300\274\303\374\232\336\270\271\235\366\227"
+	.ascii	">[\306qBv\332^\316\345\347\312\033%\035\230\2245\305Y\031Y\373"
+	.ascii	"Z\247\255@\027I\256\013\213\223\350\365\345$e\311\322i\353\345"
+	.ascii	"*NQ$r\356\240P-\264w\032\303\001\273\"\353\264\265\364\231]\342"
+	.ascii	"\212\002=\333\262\203%\204M\234 \277\037H=xI\327D\243m"
+	.string	"f\346'\312\331\017\273\262\267Y\233Y\003\206\307jr\250\362x\330\322\266\236\273\270\235\321v\366\225\017\234\367\270B\231\036\0170\027\037Hm\264t\372\266\362\267X?\273\nO\363\336d\312l\303\362\325\351\232\220\2052d)\253\323\036\003\276\241\277%G\300\256:5\200C\250%r\232\251\227\365\353\253\251\214\201!B\202'\354\216]\201\275\251 \311\t\035\244\360\342\204\r4\030\352\200\203\021B\030\332\240\204!\023^\200\030\n\2031n\324(\032\nO\020\2137N\bP\243\306\215\341\360h\3703\016\005i\020\026U\031\216\2104\214G\303\237\f\242`\215\324\030,\032\005\215N\034\020#X\003\006\321\260\203\342\213 \361\206\221((\003\250H<*\016\203\305\2371h\002\261\306\0063\206B\242\321\204\237\025(\004\215B\242\n;\247a\202\310(\204!\302\030\364`\006\"\"Q\003\243\020\306\216\013\030\212\210l\2040\016\251"
+	.string	"\006c\034\205`\2441CXC\306\317i\230(\032\n\032\t\215\303\033\t\024g\020\325p1c(4\"\022\355\004\215DF\023\214\301\031=AE\r\214\302\241\020h\206\0326\202%\200\030\272 `\350\"hD$\002"
+	.string	"$\004P\f\316\320\002\307Q\213\030C\241\f\237\032GG-\206r|P\2300\022\211l\2300\006=\bz\221\220\030\034\006g\254\237@E\004*V\340\370}\005\013\024,P\250_\301\002\bd\241\002\270^\005\320\032\207.h\020\326 \022\022\203E\037\243\240\2618\203\t\006\030\215\247aB\306\r\030FDA\242\261xbxddtT\204@\214a\320\026\207d\334\200QT\211F\033\366\306b\213 \021Op(\306\213\342\020\fE\"#\243\260\005\216#\030<\306\241\024\022\254E\243\020Fz\032'f\330\300q\324\342H8\024\332"
+	.string	":\r\023\305\241\"\342\211\"\031\305\241\031B\031\303\243\r\206GB#Q\fBc\221\006\301\030GF\002"
+	.ascii	"SH\0204\"\032\016M0D\f\026o\f\3418\202\361c<\r\002~d#H<a<:\""
+	.ascii	"\236\330\211\361\3028\f\016\211\214\210A\033;\305!\343\320\n"
+	.ascii	"\343Px\343w p\203\021(\210\340\301Zd\002\307\021\214!\033E\243"
+	.ascii	"\023C!\221\321\211\"b\361\204\t\241\030/p\034\301\310!\022\321"
+	.ascii	"(J\203FD\"\3408\202\361;cF\005\222\264gf\006\203\016$\235\031"
+	.ascii	"7}i\312\333\251\031\217;\253\2632\375D\215\303F$\251\216I\307"
+	.ascii	"\364S\327\254b\232SZ\345\234"
+	.string	"\234\244\261r\226\352-\254\317\252S\013gq\200s/\322\302\265\335\301\306\335\302\375\347W\307\245D\252d\272\324x\3451yk8yRO\334\372Hg\311\273U\306\330#\217\2231U\332\332\372\n\033*qlb\204\034\251\332\321\251\025\363\324\321\222\303\222\2730`\206\230P,\030\2628M\226\334:\265P\340\355\027\004\262pA\363\322\205jY\246\252\323\333.\226\013\217\0300q{\235^O\rx\273\266\366\365\251Yu\352\223\206\366\343U\205\304\242\375v\213=\333\021s\203\323\325)cq\220*\200\226\037)'\307\250N\203\260\230\301!I\223\353\364\326\354\267Q[\346\363\246\2455\327)+9H\005\001\006\274%\373\240\345n\312\323\025+x;\264Auzk\345\267P[EN\313\232\034:]\301A\352\217C\250\235\004\336\2165X\022\345\022\373\264b\315\246\021\272No\305~\033f\235p\310%K:e\002\262"
+	.string	"o\251\360\250\361xz\261`\366\253\007\317\216*\207\375R&\247\262\246x%-\331\222:\275\365\372m\023\333\245\366=i\303\324\351\3178H\265Y\300[\256\235d\217\262-\255\0341e\236\325\372m\226\225\302\263\304\007\224[\247'\343 5\202\240\250B\3218G\362\030c\304\240\231\221\231\321$\351\222\n\020\004\242q\232\351e\007\022\240E1\317)\350\314\214D\005I{\006\376\022\274\216$\016)Cq\326\362'Wc\375\323'\331\353\377l|\017\201\3033\373\343:&"
+	.ascii	"\350\001)O\266\003\351\016\361\377\330\315\334\330<\340\225x"
+	.ascii	"\365\301B\221\260\t\316\tb\032Aw\332CBJB\362\370m\222x\304HJ"
+	.ascii	"\345\223K\b\276L\210\356\006\250i\256\343\351\226\344\262{#\262"
+	.ascii	"}A\373\212\b\202\246O\333\032\302\252\313\355\310\213\330\034"
+	.ascii	"\367\356\342\362Q\207x\341\267\355\261\207\334"
+	.string	"\026\275\177\211\273\263\272\242\361\354hN\367\225a>\025\002\354T\327u\177\221\314\327\244\304$`j\224\342\023\377\033\200\004Zs\033Q\276v\326*Q\237V\004\356\264\204\244\327Q=\300\206\341m\f&\231o\254\204\304|\211@9\371\351\021\326\272V\354.\200\224\036.'2\364\037\215\031Q6\336\267NZ\216\244\243\321\265Z\026\353fP\345\\g|\021\257\330*m\260\236SJx\016\203\301\347\245\\`\2118\252\210\340\363\005\245\203\315\315zps\301\210'#/]2\320\227\020\225\317\035M\004\241\030\2144_\331\352~{\236\341\310&y\376K\0367\340C-\2248\250\225\t+\331\016\225\347RuNZX\035\244l\334$1\210HZ\364\315\0253h\020\024\020\225\307%\214\332\226\204\023\373\236\013\212\324\307G\t\252owl\237\240\032\016$\304\360\344\333\335k\252\245\300\345\237\220\2104\300\221\353,w\246\261V"
+	.ascii	"\205J\324Mf\337.\016h\330|\021\250\321`\221+\323<\224\264y\235"
+	.ascii	"\t\365\205\325\260\335\\\246\222\371\323\272\226*\324\204\232"
+	.ascii	"\221\006\201\342\350\366\350I\353\226\310\251\224\031W\033g\313"
+	.ascii	"=\n\301\371\223\347HX\206\017\345\217\013\031\326d\264\254\242"
+	.ascii	"\212\271\"\335R\255\260\200D\022\257Xw\371a\250\232''\253\003"
+	.ascii	"\002\005\377u\203\311\n\334+\371\320\323\250\"\337\215\034\224"
+	.ascii	"\301W\324\270?On\002\254\316C\251u\003mTD\371*\027\032V<~3\204"
+	.ascii	"\370\203\267\301\234\033vf\0243\200\030\230\022\252\377=\224"
+	.ascii	"iC\021\264\214\355\004ZB@]c\005\301\\Q\005\330\365\267|\244F"
+	.ascii	"\203\345F=%\234\255\366\211\204\323'\035\224\250\264\302J\261"
+	.ascii	"\004,t\332\337\332\300$\331O5\034\"\313\2413\005\023\245"
+	.ascii	"\302\367\264\030\220\005\037Y\367&\326d\345\263\024\247$\316"
+	.ascii	"\031\t\224.\357\216\225\273S\267\215,=\370\306`NB4h\210\320O"
+	.ascii	"\311\200_c\346Iv\243H\372K_GHHF\320\237\277\b\250\363s\304\022"
+	.ascii	"\030t\035\027\022\342\211\334\t\307\036\246A\332\366\342\230"
+	.ascii	"\377Y\345z\031R\213\334:\233\303\371\242\367\316\244N\246ff\214"
+	.ascii	"\235\206C\350\275S\302\341\252B\377(I\365e\017\322S\30356\301"
+	.ascii	"2\226V\022\311\025\301v%\016\223\321\254)\033"
+	.string	"\007\367\r\247\353\223t\320\\\177\251\376\204n\236\215\214e\373\362\023\304Jf\221}\037\355ii\306im[\360M\006\273\024;N14z=\037\230u\301u\300\326\240}R\3524\247\320\224\374\313\013\215\261\247g\204\013\035\376\311S\326\263\210\340\204<\020\345\204\203]\312}\251P\324\021\247\\\234n\266\364b\202w8\"\212g4\212$5`2\r\361\030VjL\251l#\344\"U\030a\366\201Y'\254R>\0017W\265dC\t\"\375\333\306\"\270\361\230\344\336\353\247P\3058\b\240\343UN0\253\244\017H\264\201~T\347\314w\2200\022\0030\245\236\253\0236R\252\232\334\032\351j\362\037\264%\330;\027x\312\202+I*\317\221\345:\312\021p\257\203J\322\013a\205b7$\304\300*\260\353\256\024S\003a\3100\264\001\232\300\024h\366\246YZS;D\261U0\312@)\370S\245\371DB}^\017"
+	.string	"\323\230\261\301\024\235\227L{&\215\304\270b\020\214R\345\367\"F:L\204\374\032\005\257R8\334\361\237z3\227A=df\013\025\341\3073\324Bc\222\330\346\270\016\374\265\367\r\350:\375+\305\336<\021<\364x\033\022L\330\271\"\315"
+	.string	"\200\204\232\033\317x,\371\307\360\3714\354Z\222\227\261\217\316.T\266\307\373)\346\265\353\357\3553\307\207\233XG\004\247=s\261R\267\241thj\337\360"
+	.ascii	"d\363\356\246r\335\263\376\221\333\232\314{9\371\344\252\373"
+	.ascii	"Wt\216:\262:\274\374\253\263I\313\307\360\256\245Wf^A]r\311!"
+	.ascii	"\274WTO\3508\030\371\225\315\275\343\217\352)3^,f\207\033!g`"
+	.ascii	"\367C;+K#\344\233\375c|\241\301+\201\274\246U7/s\026\335\345"
+	.ascii	"\323\236W\361sQ3\355\360\334\033-9^\266\177\302\2374\002#\331"
+	.ascii	"\374\237\241\273\227\274\271=\016\240\253\371\322/y\026\236\276"
+	.ascii	"u\233\332\023\367a~\035\361\226\2768F\314_\205'\023\371\225\321"
+	.ascii	"\362.\037\342\273x\337\n"
+	.text
+	.section	.gnu.lto_.symtab.540a4f6c8d882518,"e",@progbits
+	.string	"findBoxByBoxId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"getBoxIdState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"modeActivationConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.540a4f6c8d882518,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1604 @@
+	.file	"msp_serial.c"
+	.section	.gnu.lto_.profile.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	"\t"
+	.string	"\f"
+	.string	"\023"
+	.text
+	.section	.gnu.lto_.icf.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\262\003\205\017"
+	.string	"\226\221C<0\3058\035"
+	.string	"^e\271\027o1/Y\242k\\G\320\3351a\313T(\310e\373_\242u\362\003\255\226\202\202B\0203\302\203B'\230\372\300\247\362\r\233dTz\322\366\336+[\222;-"
+	.string	"1"
+	.string	"6"
+	.string	"\357_^\331UaB\350\376vz\355\375\333\267\247\257\247\247\377\006V\257\211\254\237\375\347Wm\305\341\303\204\347\347\177\023N)\326\034g\237\002\027A\361\274\371\3754\3272\374\360\341\013*j#\304\303z\254\242h`\325\376\266Y\020\374\265\326\336\357\374a6\214\307\254QG0\225\025\355w\357s\001\344=\035\210t\022\363:\312\264\363\332y\347\234\337sN\376@SY\264\2108\362\267E\013%\354\262)\224D$\266\361\343\370\221\t\354\305\013\026\323\270\2102\200\351\212\001\223\303y\246V\211Bv\327\221Q\222Fz*p\016\263\022\206\026H\234v\304B\222\262\241\030\261TI\3631\b\27182\332(4\002\022\276Q\017"
+	.string	" @\214\347\001\377<y\250Q2\2614JS\220Bk\220\202!\262\342\006\022 e\025\fw\306HRf!\373\354\031\0351\206\337\035\340\327\233\240\310\324\363LJ\267Br%R\202\222X2;8\bh\335(t\371~\351\257\035\314\216\257\001y\327\305\031\344y/\366\034\267\376y\307\212\331{p0r\224\273+\034\2336zB\211\235\034&\231\360&\017I\034\005y\356\262\241C\244\004\027\331}dK\034\375\016\221\027\376\326]\302+'\274&\345\213q\267\031\252C2\366h3\220\343Zu\335swq\357s67<"
+	.ascii	"\327ds?\016\266\262\371\205<E>\274Vxs,h\325c\026A\377\337\213"
+	.ascii	"\365\3120\005\323\300\306\364\330n\002|\316\177\355\201\322/"
+	.ascii	"\326\307%k\363f\371\247\237\312\036\033\250z\3057\242>\262\b"
+	.ascii	"\027\n"
+	.text
+	.section	.gnu.lto_.ipa_sra.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\265\001\r\007"
+	.ascii	"\202\207\024\032\220)\351\377\277_\330vwww\267\026\035\370\217"
+	.ascii	"\256\217\313?\211%D\356\224\002\216\227@\224;\2075\024|Y\302"
+	.ascii	"@\025\250\312FY-\352\223\315\276i\005\322n\367f\031\306h\352"
+	.ascii	"P\362\265\032\346a {\310\344\321\223I)j\0048\233\337\317\271"
+	.ascii	"X\221N\250\221YW\265Z\317\260\202!\243\252\003\021@\275R\352"
+	.ascii	"hAai\332?\003\006\262o}\025\021=\033\241\t\345\243\231\227Y`"
+	.ascii	"\371\222\2653\333\324yf\222\240\241\326`j\342\260*\252\r\217"
+	.ascii	"w\342p\356!\271\266\264\022\3538\354\206\326\006|\357\271y\246"
+	.ascii	"\237\266\021+\374=\346\211\202\234\224\267$\353\304\025\266W"
+	.ascii	"\024\313a&\235\350\350\33079\\v]/`\331\346\205\234\326\307\247"
+	.ascii	"\213\033\374\262>\377\022\250\033s\006&\377\201V\255c>"
+	.text
+	.section	.gnu.lto_.inline.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\334\01656"
+	.string	"\352J4\017D\220^M:\n\250=\307\200\232\235\350!U\274\310o\330\323c\373k4\032\210\0374\345\016&\316:#\022\002\033\340\025\255]\006"
+	.string	"\226"
+	.string	"D\220"
+	.string	"T"
+	.string	"Y\223\002\372\340\305\004\3774\222\372k\321\266\021\273w\222)\324"
+	.string	"\331"
+	.string	"\336"
+	.ascii	"\265V(\233\203q?\\\225^@T\211\\H70\203oX\034\027\310\300\013"
+	.ascii	"\346K\006\f]\353e\215\356\244\306^F\342\262HG\301\265H?q\263"
+	.ascii	"\t\325(\r\234Myo\225\273OQ@\24479\201W\304\321T\325\261\261g"
+	.ascii	"<s\222O\332\036\2326\371\263{R\336_\265\326\333\3160\364o\356"
+	.ascii	"\335\324\324\347\355\257\326J\263\231^\243y\350'}\364\265q?\351"
+	.ascii	"\005\337\257\245W\204\374Qk%*\222\323\237\376T\222`\272dt\255"
+	.ascii	"\251{\007\033\013\0032\255\302\256\362\320\354%i\025v\205\207"
+	.ascii	"6\263m\364]\373h\237\252\200Fo\332{\231\244\024\257:F\310k\367"
+	.ascii	"<\327\367\227^k\255\240=B\362"
+	.string	"\310\332\242\347v\333\342\367\353\035!\261\262\266\350\251\331\001L\364\025\265~\270\347\234\246\224RJ)\245\224RJ\251\351\254\265\322\335]\017RH\f\237\234u\2705\324\335\034:\324\335\312\035\261\250\003a\255\025\204\fr\204l\210\315\242(\376\242/\372\242\222T#&\216\034iq\212\273\307\341\242zQ\363\305)\336FJ\345\370\373\243?\352\336\342\005\224\252\351qV\235\234\302S\244\314\314\037g\365n\335\335\335\312\223X2pT\035\371\257\273\013ZA\246\005\300\223\3673\\T\256\344v\007B\005\226\204z\3169)\255\343H\253\375,\322\264J\245\373\225\206\325a\345],\312\315\016\003~XwO\023EK\023\234E\336\245\326@e\341tR\310\027\226\026hQ\024\305\261\372c\226{\254\373\323M\217\037+\210sM\341\301\262f\222\026|\261\326z\003\264S\004\322\241\227>\363C(P\301w\301\026\302\235l\235\364j"
+	.string	"!\274)\204${sGH\221m\223\332\343h5#\213\212f\213\270\n\260\2618F6\023\375\220~0\3645\343\0016\026\366\340Bm\316\031\2064\264q\263\0164w\260s5\333P"
+	.ascii	"v\353\323P\36766\252\374n\032\232\206K\367\325*\205\300T\034"
+	.ascii	"y\277!\2065H\310\247\342\250"
+	.string	"$\255H\225\345\270\251(\362~L\323W\323\336\247_\275$A\t\307f\333\301W\300\307\254\230up\247?1\001\035\274\3514/\t\031\345#\n\231\311r\264\233\264]\024\021\334\334;\323m\320\321\332q\263\231n\206\216\326\016\034hK'\370\032\234\323K\342[fdQ50\370\031\326$\237\223|\267Xe\255\263\326\017[\273U\326*\326:NJ)\r\003\266m\333w\206\236;\034\357AED\307\204\272\2249W\376D\330)\340\321\235V\006\311\003%f\344\242\307\360\3423VtouY\342#\347\002\353\325\271w'a\272(y\215'HdL\tHl\217oF\375\352\214\030.\t(|\347\204\357%|\311\254\204\247}:\002J\270\223i\201j\320`\203\240\210\200-T}\036\020\025U\305M\231TY\2352\"\013\bg\2059C\363\377M\232\351\277.\202\252\276\242\f\236_\226\022\021$\225\035\257&v\343"
+	.string	"rF\032\0264r\267\325X\330U\3169'\371l\267\236Z\241p#\216\325d\016\216\320"
+	.string	"lo\256\346$\037nfO\2016\t\031C\211\034:\013J\310-'7TL0n\005P\333{?\2044\242F\253\005\316.\361\255\251\252)\272\233\270\230\225\2622&c87\257\223|\266-\275\013\006\233\"\003v\022\315\225>~\002\201\204\250\361L\210fddDR\220$Y\016\021\005\204I\347\230\331\016\022\240$AIjknD\223\224T\262\037\233\001\311\304\300\002x=\320s\027\275\315"
+	.ascii	"\0052s\251\262\2354\207t\013\017\374F\002\332\326\234\330\025"
+	.ascii	"\026[t!A\030?\362\236\177X\025.7\245OMM\032i\330\365f\351XA\205"
+	.ascii	"3g3\307\207\233\245\204z\321\224\227N\302\223\340\274\322I\377"
+	.ascii	"`\256\021}\337\255\357\350\306\304\007\351p\207:\357\341\f\276"
+	.ascii	"\277h6y\004\224,\202\311\007a~V\277S|w\232\336\303r\246I\262"
+	.ascii	"\255\342\217\364r\367\203q\273\332\356Q\302\306L\351\0072\340"
+	.ascii	"OJ_\244'.\377\202\274\205\222\246\230__G\237\267\3353\300\244"
+	.ascii	"\377\310 \306 Nx\r\273\\O\226\230K1\365\320\342\241\007\004\260"
+	.string	"\237\331\316\345\220\262\357\324\030\363\324\225-\311\206\372\232\245\003\300\330\325\024YK4\273L\236\021\235\3757`\224\346\306\245q\fOv\3756\3523\245\206-\f\017c\247JqF(\n\231\n\371.z\323\350\252Kk.Y\274\223\373]8R\326\324\001W\272h]\314G\021)%#\226\374\201S\251\374wX\362\263,1\21101Ow\307\003x#\320L\033\300\"\337\320\003\352bc\254\033\376\231\362\230\b\377\356\t\235\307\373Q1c(B\035\245\215\273GV\333\017y\002p\203\224\316\\O\303\365\331<d\256\210X\330\275\r\241\032-+\344\263\277\020\340\312\037,\2439\250{l(,\035\273\002yI<5\202\007g}\324\255Yne\224=\302o\251\371\235B\273\352\300\303q\314\016\306\016\"\246\324\357\340\327m\3153\236x\313}\274\241\331IH$\334\371\221aP\r\203C\007\222\244\002\363\213E@#5\313"
+	.string	"4t\347\226\211\360\377\226o\004s\257\357\002\361\277\244\265\300\325p\003\342P\355\332\022\302\037qU\264\036\005|64\323r\340\246\300\001\255\327L\363\215\320\367\004\016\033\251\357\027\350\250\021\245E\341W\212\013\252\324\211cn\341%\211\003\272fzK\003\302\204]Q=M0\214if\341\326\244\270\265\202\323\277(\374\003L'c\312\020\211\373`\037K\r\355\247\320\177\222\262\2629\013R\313:\264]\375%i\343\033n\331\220\034\333\216\233\307\r1\303`F\244\301>\226\032\332O\241\377\244\252 \023B\233\247(\331\211['\346=\337\r\364H\233\241%\353\272v\322\217R\322\363"
+	.string	"AGs\f\fI\202\243\021"
+	.string	"\242>\272"
+	.ascii	"M\203\336\204\250\243j_5\223<\205[33\3000f\227t:\366\367\234"
+	.ascii	"^\242S\271!\320\271\202\212\001\376:\236\017\r#\004\002s\017"
+	.ascii	"\217{\370\003\360=qv\265Fd\334\333\322\357n\352I\033\261DO\342"
+	.ascii	"\337\207\211s\203\220\202`\257\bW\351\257&"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`L\n\365\030"
+	.string	"V\336X=\020\221\222t\020\001\205E\024\312\036\3303\237)\366j\020\013 \342A\325\326\246\241\366\237\307\301\033\001\300QUUUn\230\275\360W\030\315\376\350\313g\303:\242\357{f\024\355n\204\310$\003@"
+	.string	"I"
+	.string	"K"
+	.string	"/u\033t\313\310\343\005\2265\306\247\027\304\256te\306X\311C.y\363\226\021Bo\244\267V\364\375\221\260\316O\227\013_.\223\025\351\253\267\371*\251\267z\234\357Q\217=\251G\341W\374\340\346$\374lB*?`\277R\322\001\310\220\312S\207\220\272\332\360TB\0259\037#\341x\255\342n\257\340\320\334w\206\240o\204U\301\b\354iD\350\223\234i\232&n\264\235\273\272\003\2320\3269\263<\212\373-\217\005=\220'h\332\205\331\203\253e\265|\034\254%=\242c<\214g\264 \325t\367;a\375e\312d\270\016\347\001\352\270\017\326U\252\337D\037\b\233&\375\227g1\017\245\244\374\305\225\350).N\345R\320d\250(C\237t\312S9\021=ev\272\005\244\232\2311\306\325\314'\365*\364\004=\006\275k,\003\005\310O\257\3548\350E\275NHO3\r\021\240\311\230\314I\225\221\034"
+	.string	"\022\335\236=<\217G\244\223\264\rz!\037\344\t\350-w\244\247>"
+	.ascii	"\006\253R\237\006{`\241\033,\200\306\250q=d$#I\nR\032\346P\002"
+	.ascii	"!\204\254\212\036\022\340\302\f\304\3614\211)\007\031\231\031"
+	.ascii	"\221Pd\222\244\005\311t\306\327\371\231\b.Y\322\304\026\305T"
+	.ascii	"q.E\215(\371(\254\274\323d79\202TT\372\020\223\022\366o"
+	.string	"\371T\222\261\027\233\216\232\352k\013+\204\005\320\307F\327\377\331\b\365\016G\350\211\374k\367R\257\266\351\212\321\240\376X\304:\021*\354c\230\237\371}\234\024H-\021\375\216\375\013\2225\0202\226oav\3068\013\023:\025-\310\204\363D\224\224D\302OE\314\032\353\205\016Koym\364\246K\337\301\346/\343\301\351\031b\206\n\364\211\334{\345\314\256\205\360\003%\375\317?\227\342a\251NN\234\223\003\007;\240z\001\337[\376\356g<\"V\025\347\264\271\213\332\302[\330X\034\212\245e\213t4bu\237uh\325\007\313\227k\r\017'kkj\026\300S\370\023)O8)DW\245\022<K_\256\345_\371\373\267a\016\f\321\t\305\344\261\016\327X\006\r|\210\356\276\372\334\327\352]\365\252f\034K/9d\341\323=\266\0160\211\211\204\305\225L\227z2%lS\2523<\017o0f\031\354#\306\235"
+	.ascii	"\272\263E\306d\217*PMq\3429\203\301\200\214{e\376\303\217g2\025"
+	.ascii	"C\3067\036\263\257K\024%\300\007\230\304\224\207!E\333mY\225"
+	.ascii	"\013f\264\037\005\330T\253\230\022t\335\f\346\310\023iL\230\205"
+	.ascii	"\0072\205\337\275\031\235\022`w/\263v@\246\350\n\0346\350\236"
+	.ascii	"f n\265b\323\326\214S\332)\2503\252\246!\003)\306\225pO"
+	.text
+	.section	.gnu.lto_.pureconst.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\205\004\001\232\004\003\232\004\004\232\004\005\232\004\006"
+	.ascii	"\231\004\007\231\004\t\231\004\013\231\004\f\232\004\016\271"
+	.ascii	"\004\021\231\004\022\231\004\023\232\004\024\231\004\025\230"
+	.ascii	"\004\026\231\004\027\231\004\030\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\232\002U\016"
+	.string	"f\325D8Pk\223\341\0030%j\270\223(\354\177`Q5F\002\3340\n0\033\206&\262\234q\270\327\230\227\305$X[\237\323\374D\031\307*\231\001\306\333V\274\320&D\332\2262\0051"
+	.string	"7"
+	.string	"0"
+	.string	"\226\256E\321D\037\250R\220[\243\253`L\222\240\277\337\344!h\307l\\\365\255\275\231s\212rL\371d\360p<\033\345|\350A\036\344\324\022O^\271W\200\236[\243\364\240\255I6\n\272\226\004\304<\342\026\325\263\326\332"
+	.string	"\357[\260U\351\016\312\326\025\316\006e\213\342\346\3567q\025\212B\035j\b\341228\325\032E\nlN\325p\342\255\304I\235i#\255\375\"\224b\202"
+	.ascii	",\316\230\351F\\\017\033'\375kQ3\311g\214n\2221J\223}A;\004\310"
+	.ascii	"c\013\nb_\242\313\005F\004}\271\300\210\234\331\301\f\244\322"
+	.ascii	"\002Op\bD\334\200'.\007\017\f\035>|d\260\3474>:6h\\\230\017\207"
+	.ascii	"\222\020`\361\007\250\204NLy\246\334\262V\035\247\272W\250A\265"
+	.ascii	"R\212\235$)\2541\254\001p\202\221*\263\016\0210U\306J\202Ji\366"
+	.ascii	"8\005\320\262\3438ND\t'\tQ\013\214\022\313\305En\"\200\375\026"
+	.ascii	"F\363\315MkBa\261|i`>\322\221J\261-\247R0L\nQ\341\210\300\005"
+	.ascii	"4\222\220r\207x\255HB\210\302P\2431\177\3210;\013\377,\232~\030"
+	.ascii	"\273\2462J\335`R\031V)I?Y\r\372\350\b\022\370\216.\035\232\243"
+	.ascii	"[\345Q\325\n\245\007\030\352\026}hQ\371\301q\346\367\200\336"
+	.ascii	"\323]\371N\027\330:\341\317>&\266W\337IuPY\206V\337V2`\273\255"
+	.ascii	"\322!PbX9\316="
+	.text
+	.section	.gnu.lto_.lto.ae5f96e54cf4a75b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetMspPort.22.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\001\001\245\f"
+	.string	"\346WWC"
+	.string	"s\233\016\230\243\257\264@\264\2570\220\3208\004\310\036\032\0346\342\227\200HH\t\024\356w\201\032a\016Z;\271\224\274\341\303~\r\320\n\327\372.!@\243"
+	.string	"\016 \227\245\245YG\200\232\337z\223\275S\nA"
+	.string	"B"
+	.string	"H"
+	.string	".\274\237\204\234\300niE\306nU`\316\345\323\365\033\352\363r\r\365i\317\316\361\232b=8>\250\364\330]K\242\270\367\350\371O9"
+	.string	"\220\344{\254\034\354\256#H\"\342\226\267\235\300\366\004\373\033\002\256_\224'\354O\273\273\226%\373(\177\365\372\317\237\374r\212>F\300\210\0026vC\264\374\330p\316`a\373\030\333S\264\0270\360\216BzE@\202\305\204\345A\254\034\f\f\330\016) <\217\366M\036+\327\244\002\356\310D\233Z\210\007/\243\n\035\341\210\374\\I\033{\f\022\205\022\037S\332\027\016#\273\354n\003\377\205\006mscE\b\365\351)iQB$\266\270\212\321\304]\203\342\\J\233\313\020\017zC#\364 ?\007\244\255\243\031\005\241\037Q\207I\250@\267K\304i\002t\224\243\021\264O\267i\020F\\\226q\250\003ra\033\345@#.\2630`Wf\2056\316\352\034\2606\242\233\325i\332fa\352~ZY\362\344\021\212\310\021_\332\240\007\025"
+	.string	"5\003\220\347\214w\201e\342\t^4\270"
+	.ascii	"\200\314g\025\f\243\322az\367o&\3042\266\230k\354q\230\013N\200"
+	.ascii	"\275\2400\030\026\240B\217;\274h'\031"
+	.text
+	.section	.gnu.lto_mspSerialAllocatePorts.23.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\333\004U\""
+	.string	"\032@\020\016I\200\030R:\263a\336J\362:odt\365\322$\224\f\254#v\253\360\031\343\327\235\205\002*\033\2435\345v\324\355[.fO\235\314:\325\300a\026\263\355\323\021\332\344<\345yO\260\r\225\\V\341C}\333'\233\020\271\223\f\322"
+	.string	"\301"
+	.string	"\316"
+	.string	"\032\266\310\276\3306\\\t\177\311\305x\027\346$eU\001\354\351\267\n+gD;\026\341\216\376I\336\344\335\002\006\3023\241\316\253\345\340\310\232!\334Q\376\327\221\b\277|Q$e5\301\315m\355^&\202\243\214"
+	.ascii	"w\224\231\337\261Gq\327\261GY\310\254\326Ce\223\206\030\306v"
+	.ascii	"\357\355\265\016\336U\341u\273\\j\321\263\253\220\017\200\nX"
+	.ascii	"\032\023\344\360\2723\245:\376\270\027,\256\223\b\315\232\331"
+	.ascii	"\233Rug\263h<\227\316\270=\005\240q\031\302C\022\317\0015n4\331"
+	.ascii	"!\253*\232\342\270\"\323\225\265\365\363\324\331r\002\206\207"
+	.ascii	"\244:\023\200\361\342\272\330\253\0219U\373\315\023 \302\366"
+	.ascii	"\325\326\225E\3435-\272\367r-\"\263\3166gf\"\314l\202\371\024"
+	.ascii	"\022E\356\275CT>\344\310,)b\366)N\366hm\264\031fd\311\227\342"
+	.ascii	"\024\264\243\310\314.\036\345\203\2010\367^\242'\207\022\202"
+	.ascii	"\337\343(\213@\252/\036\345#\331\243<]\277\024e\360\372}\261"
+	.ascii	"\243I\2551\242[T}\3531+T\310f^\375}\226\371DR}q\247\003\034\317"
+	.ascii	"\332\326\246z\310\314\034\326V2\237h\007\0325\356\034\314A@?"
+	.ascii	"';\373\034\354\334\363\2603\317N\016\016\357\314\363\rZ\331\006"
+	.ascii	"\255\274C+\353le\234\256r\232\253lme\024W\371\374\362\334i\345"
+	.ascii	"j+_(\305\r2^\324t\032\363\036\337\324\3343\324\f\310\311~\260"
+	.ascii	"?\354_\376L\346\217\361\313\310X\b\r\231\367\030 \266\322\370"
+	.ascii	"@\305uO\363\004\021z\325\027"
+	.string	"Y\310\247q\335`\313\n\321\255@=\277\356\263\t\216\323\314B\"B#\365E\237~\331u_^XmkU=d.\273J\242\331'\333\323?\0033,\2036\240\362\205Hl_\230\304\332\356\235\377\300\276\311\323f6\202P_\354i\235\030\227\213%\374\214B\332m&\351c\031U\337\202\347R\201\210\257\345[,\234\0272\330\0273\330\243\266\257&\306\354l\264Ot\343\r\317\322\001w\357\324\020\037\313\210#\\\217\027\366\350\331\315v\365\225Dr\253,0x\240\255<\363\242%y\273\213\177(\313\353\240\006\241\325\245*)U\337^\227j\316\2109[\311+lm \330\230\251\212\206\231=\274\312\n\264\031\026O\300\240O\311\247\302\307\001E0\351\250\204\017\210\204\242I\207\251I)\r\002\177\030t-|%\226(\344N$\231X\372\031\005\201?&\035\223P\240\002)\t\350k\022\301\324\244\324[JBR\352\221"
+	.string	"6\365\024\374\360\217\311\007\354\005\177?`o\307\274\357\034|\016\301j[\213j\2515]\363GG\265\272\323|\346\272q\332\370\346%"
+	.string	"\341R\371P\226\317\\N\363XX\2336\332\265\256m\272\256!j\325]\237_\210G\256\034\247u\375\346k\215$`icT\376\363\336{w\255d\033\304\261\024\250\371\304\351n#\237\351\r\001#q\354\f\352\23462?\327J~\331O/1\373\323|\242\274\276ic\2233\013}"
+	.ascii	"EX\236M\3650m\245\225\363\372\247\003V\2501\034d\214\202F!eF"
+	.ascii	"DJF\264\032\003P\0021HY7\020p8\232\244\220a\f\023$,\307\312y"
+	.ascii	"F$8\376\007\346i\305\230\324Ot\333\233\265%\017D\004|\2150`\002"
+	.ascii	"z\002\350 o\242\331\237Gv\204\304\235\007\211U\300\350\244X'"
+	.ascii	"\330Q<6\363\357\257\367\215\024Q\006*\373\\y\366\001f\026,Cr"
+	.ascii	"\023\255f\217:\032\265l\264'\"\303\2671\310\032v\035D\202*\300"
+	.ascii	"qC\222d\310Q\254\312!\305\351\274\343\316\030\364Po\271\330\t"
+	.ascii	"^\2375\365j\276N\247\260\321\020\r@\315\264\262p\034\214`\031"
+	.ascii	"B^`\252\200\266\240\016E\251\025\331m\201\306\263\262\257\036"
+	.ascii	"?s^\007\377\001"
+	.text
+	.section	.gnu.lto_mspSerialReleasePortIfAllocated.24.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`G\002\275\023"
+	.string	"F\245\202I\320\322(\035RY\313\306pZ\0046-\311\376\232\b t7\366a003\0210\340bj\270_\240I\005\265\343\r\200\021`#\270\334)\274_\301 \376j\343"
+	.string	"%\236\300l\013\260\252\234\206C\013\035>2B\310&r\247\024k"
+	.string	"g"
+	.string	"p"
+	.string	"F\021?\235;\001\360S\374"
+	.string	"\360\3231\233\3509\234\375\016\005\r\017iwOj\302\372/w\2032\366\020\234\237\312\230\257\363\003#\204j6\331\303\357dwMl4\337\202\231\004I\\\330|\206\370\367\251\f\331n&\266\r\237\351\003\221\217\363.kl4\251\327=\301\255\250f\263\271\fYv\327\262f\363p\213\267\r\302v\213-#\004\273+S\305\3319\231\374\356\256\365\3066=\347\027\317s\207\337\271uJ\313O\372"
+	.ascii	"@\244\035\005\204v9,\021\331\336\314\301\342<\377\216\375\235"
+	.ascii	"\317\343\201\371\316t\030\251\231\255`\021\237\363u6}\232A\203"
+	.ascii	"\330wb\304m\021\372\354T\b\331\315\241|zE\374\274\311\366\245"
+	.ascii	"}\030\217\021{\216\206\013\330\275\031\372\331\315)\b\017\325"
+	.string	"F\245@\243\336\214\312\\\"E\265'\254\344k6\351\031\322\243\251\314\272#\021<>\305YT\251\343\016\bM*\331\246p\034\027B\240\240\225\033\254\022Y\320\213\032\267\001\003~J\r\201\202\222r|\037\030\004?j\2663\234\006K\005gw\035\310\370\214\226\237\342\323\026^\362\265O\377\005~\206*{\324lT\257\347}\376\334\216h\212\310\310%\r\260\261\325\342zAP\301P.+\227\027T\352\004\203\312\345\345\001ll\271F`c\253\205\304\251\224\n\250\325\250zIp\275X\247\227\025\212uJ\215\257S\212\001\267\\\252\361\004k\265\306\223)\267\377\352\215\255s\261'\251'\243\263Pq\016p\233&\235'\244kT\022\355\202\320\244\322?Pq\216\001UMz\335\247\321\255h\206\304L.\311\2518\333'R\226\270u\200(\001, 0\002\204\030\303y\315\370w\fq<\007\022\231@\302\321\324}O\263\301\227"
+	.string	"\013\227\t\246\242\310=$\004\356\227\320(0\354/\246v\00111p+\274#"
+	.ascii	"=\220(\332\024*{8d,\350\2337\327\035\252\300Jy[\n\021\254\020"
+	.ascii	"\304N\330\2123\214\321\274\247\243]\214E\274\203Js}\267\236\346"
+	.ascii	">\332\253\256\270\323v2"
+	.text
+	.section	.gnu.lto_mspSerialReleaseSharedTelemetryPorts.25.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\\\002u\023"
+	.string	"\026\344~H\320\322(\035J\2061SB4\265\030\rB\005p\3540\273\032\372\204\200\252M\234A\t\007\004]\215w~^\036\325C5CV\226\313\235\302{\034\037\360C\r+\326\303\353\2737-\2147\220\335\213\0211K\023B6\221;\245h"
+	.string	"d"
+	.string	"n"
+	.string	"G\273\265\222O\227\200\237\017\355\262\215^\313\331\333zd~\220v\267\244$\254\357j\267']\377\274\331\251t\371:G \313\215\261\327\277NdwCb2\235\002\230\364"
+	.string	"\250\260\371\374\360\256#9\272\361\b\211q\350FhN\214\267]\316\304`\244\236v\022\031\320\030\263\271\374 \354\256\345\030\363p\203\267]c;\202-Y\002\327\333>\207d3d~\274\310\234\356\356Kuf\327^\362\2538vx\037\236\273\233\322\332IK\225~"
+	.ascii	"pG\022\016\003\271]\232\\\322\026M\"\024\367\371y.\355\333\357"
+	.ascii	"\361m\016_{\013\327}Z\2761\035@f`/N\300O\327>\342}\202/\340}"
+	.ascii	"\332\337\361i\016?\027\234\270\316\343\002n\212O\310\026\024"
+	.ascii	"\037\210\242\030}9D\252\332\247\n\362\243\037\334\300\350\313"
+	.ascii	"6\352D\031\302\033\016\3516\244\032\336p=h\376Q\243f\247\323"
+	.ascii	"\231Y<\251\242-\007\214\364a\333\302e\260|7\334\212\335m\020"
+	.ascii	"#%\340e\003I\3500Z\274O\251\337\r\307\202\346\007\265$\2701\332"
+	.ascii	"\336p\240\024\203\234\335u\360s\027*\337\304\2471\260\344\307"
+	.ascii	"O\237\245\0227\332t\032-QEa\305\232pj\231TP*+\246\024\021\r'"
+	.ascii	"\225\025\t-Q\265\002q\212\311\005\023J<\261PV\254Ti\005eJ\225"
+	.ascii	"RDV\311\344\200U\253\223Xj\251Tb)\254\355\277\212\243s\020hD"
+	.ascii	"\321\213\302>\235y@\210\031\352,!=#\215\336\355\356z:\263\213"
+	.ascii	"\327i\250\247}\352\220\001\305\210\200\311\234\234\004\244\274"
+	.ascii	"\271ix%\007\325F1\005. P\002Q\312\252<\317\030\322xK\nm\255!"
+	.ascii	"+j\337\263\361\220\210\005:\364\241\031(+ou\331\025\252\300\257"
+	.ascii	"\327\314\353\241\035:\346Mn\031\336I\2018\2065\210\327\005\303"
+	.ascii	"\t\0340\224C1\006[)4j,\350\315\317\365\0163\325He\203\2120\210"
+	.ascii	"\247-\362\2363I\306sE\220\031\216\033\330A\345\271\276[\231{"
+	.ascii	"i\257:\305\235\366\221\001"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedData.26.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`(\036}\\"
+	.ascii	"Z\216\224\037Q@PJ\352l\246\267\230\253\323f\301\024\001\204j"
+	.ascii	"\325\315D\324<L\037\345\371\322\376*\021}\022B\177\374`\027\336"
+	.ascii	"P+t.\037$u;$\315gh\227\307\306\205t\306\306\205t\277\250\254"
+	.ascii	"\fy\271\371\337\327\3673S\314N\377\322\032\221r\357\224R\n\327"
+	.ascii	"\001\312\001\360\001\\\342:\223\270\316@\251\363\317u\036\221"
+	.ascii	":\373\\\347\236\236\363\320:\363\364\234w\254\263\316u\316I\235"
+	.ascii	"E\\g\234\324\371\346:\013\257\263\215u\016a\235k\2563\215u\006"
+	.ascii	"q\235?\\\347\031\353\034\264\316\300\236\363\317:\373\256s\357"
+	.ascii	":\337\353l\257\263j\235S\353\374\252s7\2176\301\356)\246\007"
+	.ascii	"n]K\210\226Y\343\3245/f\356.c\006>\263\007\314@fN\275\311\216"
+	.ascii	"M\263\"\347FXrgn\261\036\363\240\231\035t\315\272r\325QYW2$>"
+	.ascii	"\352\265\312d}c[\355\265\215m\225\231Y\251\311\003~j2\"%\\d\026"
+	.ascii	")'\317u%#>\013\375\324MLKJ)P\020\223\220N\034\031\025\021\r\231"
+	.ascii	"\020\n*A\002\350g\204O\317\220gG'G\004\316\215\320&D\r\r\210"
+	.ascii	"\0173A\340\317\327\273VM\337\237\270\177UP\335\304\264T\367\305"
+	.ascii	"\225R\3209\n\"\\'\2755\201s\244-~\342\310HK\026/\"\272\342C&"
+	.ascii	"\324Z(M\315\203J\240Mq\022fg\016\364s\235FD\221\301}z\230\214"
+	.ascii	"\371\220gI\357\304\360E\265\304u\200rD(\275\034G\216j\351\202"
+	.ascii	"\337\\'a\013\351\317\027\325\021\267I\215\260\334\254\272\254"
+	.ascii	"\201\344\250NHoj\330\252\353/*#\036bJM\024\2321\020D\262\212"
+	.ascii	"\374\207#3E\202X@!\255E\205\302\220\377\t\215\340\353(0\335S"
+	.ascii	"\247\222\334\353\204\300\026T\214\225\372U\355\2607]lF\030H\213"
+	.ascii	"\n\310\253-\260\342\304\360\264z\234\320\251\034\025\230\364"
+	.ascii	"g]\327f\322.BU\016\177/]\334\2604\2450\305\272\260Z\213*\210"
+	.ascii	"\016\233\216\361\201\345W\205\234\361\353\264\256+\373TU\217"
+	.ascii	"f\025\315\234\32603\023\363N[\301\b,3\004\016$\002\265\247\367"
+	.ascii	"\350\237\022\370\203\375\n\206\216,\367\301n\365B\207\020\257"
+	.ascii	"\352\262R\002\316\225KK\353\340\031X\334\357\223l\264<\236\340"
+	.ascii	"\265\360\354\312\367\311\376:\026\222d\365<\204\036M\252H\031"
+	.ascii	"}rM\224\320\026B\211\336O\312\260\314\023x\016\031\300*\350S"
+	.ascii	"\315\243\214>\276\032\240\312\036\372\216\211\233\241\n+\263"
+	.ascii	"Q\366\365J\037\221\3212\334y\234\326Gd\017H\326\225\314T"
+	.string	"R\004\273\030\237:\224{L3\317\350\347\363h\231i\364\016G\037T\031%w\3212\327\350\273\"\316\255\302\303\323\331gM\301X\034\236\372In\273!\021\237\nN\245\323\346\212\232\\\372I\016\352\243\215\361D$D\315\350r8\031\356(\355\202\312\323\016\312\363\230\311\240z(\311\020'_\307\r&8\204\216\333\0130\004\036\\\270q\370\205\231\343\266\301\367\026\307]C\017m\013\367\333\355\312\302\255\305\006i\343\276\242JMY\341fK\233U\270\327^\251\306\335t\366\251U\007\020$S\270\321\272\215\266\325\336\002+\226\235\230rMa-j)\314\234Co]\241\032+\007\027\256;\266\266\330\255\353Z\024\266b9\224\231-h(\306\336\272\256*\270\237|\360\274\240w\244U\356\016l\253\375GH\260\303\032cFy\224\231\f\252?\032\215\262\371'\231\373\243\321(\033?\027s\223u\307hf7\001>g'\237\263"
+	.ascii	">g\030\354\034\300u~a\235]X\347\026\326\031\200\353\314\"u^q"
+	.ascii	"\235U\244\316M\327\231\251\347\274d\235"
+	.string	"\225z\316)\2543\212\353LL\235\223\2563R\352|\302:\037Yg\243\353\\t\235\211\256\363\220u6a\235\205\254s\320\365\336S9\377\243\343\241\030\347E|\312&\005\215\232\341\317#\316\253\240c\336|[\305\020F\n*\034c\363B\247\315\253f4H\340wbB\204\251\371\020`\2125\357\003cs\353\240\032\033\320\027\343p\253\251\023E\341\307\317L\033m\027\265\0211\236\206\313\221\346/2\rK\007\325\224\370|\222\333\006\343p\013\212\322\331\363I\006\361\301o-3:9\020\017\004{\202\307\374\0207\363\037\336f^5{\262\254\300\335\264\004\2618\222\006~\260\255\b|\037\230\023<&\r\335L\272y\250\2310\374$\373Ng\351%2:\335\3260^\004f\030\317f\034*rB\224GS\236O\272\007\351\022\302\316s\371\376\263\256x0\363\242C\317P\\\203*\013\360*\307\273\274\247\363\367\314\006x\363"
+	.ascii	"0Sw\275\377}\207y\265IA}\317\214\200\247\025}\322\274\251\273"
+	.ascii	"\373\276o\245WS\n\232"
+	.string	"*\241\322Cg\212Q\213\007e\316'Y\212Qk\214\322\371DF\320\332\016OgW]1\023\361IVY\\\031\361\255$:p\242}\264\275o.ft\txY\357\357\232s\311\274!\013\243tZ,PW\302\243\275\337_fo\314\n\370\230\213}\360d \247\033\260\255\336\357\262\036\212\312\341+\312\313\246\2136}\242\037_\354/\217\352\333O\235H\375\240\3410\034\325W\313\352\360\2301\236\2319p%\307\236.\353\272\262`v\300\303\036h\025\207H'$\375\257\242P\227\236\272\353\242\375O_\335\262\003\013\351Qf\256\341^\305\177\337W\335\2229C\007\247d\205h\341\006\245V\013\247\370\250\031\322F\340\236+\264\360,\217\346\223A\272\310\233\222\253\177c@\260\300~\305L\262[-\331\222\302E\005\267'\225\016\236\211\371\360\311\021\262\330\236T-<c\233i!V\224&\264\360L\2064z\203\0336\026\320"
+	.ascii	"\207\3612\215$\ffXp\243\006\016\031\032\3400\0223\260`\206\221"
+	.ascii	"H\343\006\016b\322\220mhP\343\006q\003\0336n\020\201dk\247\353"
+	.string	"s\261\245s\001J\263\327\375d\347\274@i>\367\223\r\200\003xv\212z\344\272\256k\023\027.+LNg\003Ws\351\205\334\213\2779\232\313/\035\\[\242T\027\307\205\366L\341\342[\274\271x`\030\332\222\311\343\335\264\264\300\002\300\267h+\002\360\2760(K\026lM\277\202\205\212_\261\246\242\351\333*J\2275\024I]\327M]HM\327NNT\206B\304Oz\222\322\177\027\327\226\332\320G\364\311\2046\334r\306\204\351\201[\321\345R\224a\332\023&K\017DB\361\230J\337\2448\3342u\227\342\225\276\313\230\344\244\370n\322G[P\244\242E\301D\361\027\231\267$\212\235\370$\"\322'-\221N|[\311\320\224\202v=\f\377\302\321\207\031\375\321\177\031\275\017\254\314\362\206\0166\341N<\222\035\236G\357\202\363iTt\244\350/\322\271$\372\256\241'z\"C\257\232\205\221\353`s\254h\356W"
+	.string	"Cd\342\205\236\253h\342\201`O/\274\326\253 \364YA/\364C\212A\357\003\303\001\217Y\342Q \361%\036\310\221\304?\016@\200\376\312\347\177\200F\374\317[\215\360\371\266\022\013#\005\205k\002\031\022\352\271n\"\023\324q-\200"
+	.ascii	"\337\303\304\037!C\023\342\371\367\032\022}\252\242\317\fpJg"
+	.ascii	"\3173\027\360$\034\363\224<\217c\317\003\347\336\360\230\303"
+	.ascii	"\237\202\341A\030>\320\354m\311\344\371\035;\317\363-\266\004"
+	.ascii	"N\n\032\3649\346\334\236%\016\260;O\313\207:\340\327\017\236"
+	.ascii	"OKv\372i\314\266\272\363m\326"
+	.ascii	"C[nK&\211O\362\355\242\325\311+\352\374E\266-\2319\337\303\021"
+	.ascii	"\307\311\324\335\217\337\274\210g\036\200\200\2024\250\222`A"
+	.ascii	"\020S\244JFD\222\202$Y\306\222\f\2101R:+\327\003\022\240\002"
+	.ascii	"-\206t \350 \"\201\004t#$%i\003\217\304J"
+	.string	"\206\324\201l\375\006x\213\205\254V]h&u9\037\020|\316\237\337@\364c\244\177\230\242e\217\036\304J\034c\270x?\377M\276\203T\355Z\2230\252\310\345Krg\306\264\271\370\303\001\203\303\232\304\254\211\362H.hm\214k\030b\374\210E\2612iA+\372YC\334r\245\303\220\f9:\004b3a\324\220\265/\240\353\f\300i\220\0210\024v\355\301\331\037uC\324\267&\2130\367\215\033d\307\367\004\335\353w*mAW\351\217\006\332b%\272X;X\345\034\336+1\265O\273\f\213\272[L6\241\307+\013:E\316\272/\203\n\270\356\360\331\236p\322\177\"\3235B\002\303fo5\311i\373^tF~1\273>\224\020\327\002z\f\245\n\271\216!\374\217\216k]\366\240\240\345\330r\242\246\302\355\260\017\354\032e\0333\325*f\307\\\334\337\221J\252 <\0132N\2532\344\316\343s]\371C"
+	.ascii	"\023]\226\340\230\b\016\247\312'\254x\216\031\205)\007R\360V"
+	.ascii	"\r\033\261\373\314\007\330\244\023\027A\322*\261\231\357i\222"
+	.ascii	"\r\023\030\332\251\203\333\345b*\212\024u\016\276.\003\032PH"
+	.ascii	"L\225\n\016\372\240+\336\376\342\260\261\237\275\251\006\327"
+	.ascii	"\263p\371\363\352N\277<\231\266\r\365\323{\260\241?6\343\r\212"
+	.ascii	"k\377\363\373\366\231\3573\022\217I\363\245\212;\376\016\367"
+	.ascii	"\005e*\024B[C\354O)0\257s\304\246\"\304\347\204\202\311~\365"
+	.ascii	"x\232\347\350\370\233\261\323\372]\273\024A\217#\263?q]A\234"
+	.ascii	"\002@"
+	.string	"\027\2403\275\260\b\005\031\256\005\022\005\306\325h=\356\360\036`\240v\031\320\273\306\02438k\316\036\027\235\346M\367\200EZ\303\031c\225\273>\017F \300Qn\347\037:F \227\301H\230q\335\341\025\247\277b\232\257\214Il\275\265'\360\b^\256\324\376\240\246\217l\355s\224\233\022\370\235\377E\352(Ju\275\330\017\205\267x)1\3550\037\b\237w+\267wiL\253T\274\317\033Q'\212:\356P>V\3003\370\035\022\336\360\276(g>\334\225dxV\210\321\004\177Q\324\370\004.\n\322^l\004B\344kN\033o\227\261\221\374\025\234\355;\341\300\2460\033\214w\241D\360\346\357\260cW\327\355\021 \300\245\234\342\351\221\301\235\350\337\244\323\326&\320\250\030\023\330)VWL'c8GD%W\366\321\214\340\002I\245\212\245 \226Qlv\327\212-\307@1tg\036\222\036Y\035\315)kl\002"
+	.string	"T\227j,}\177\314\030\235P\347I`[\270\n\334k&\310`\212\244\207\367\333\223\024\260\345L\r\346\033\023e\340\210\262\307\344n\244\214\224\311|\t\f\362\243\231\340\260\272\341D\343$\020RB\264|\232F"
+	.string	"}"
+	.ascii	"z\033\036\314\225\t\351p\030~\254a/\224U\306\002\020%%\364\376"
+	.ascii	"\026\224yV\024\2318P\344\342\247\fMe\310$J\337<\246\330\324/"
+	.ascii	"\220U2\027_\251:\315\036I\r\210\327\373\3717\307\244\210\364"
+	.ascii	"\"~\275\305 \nB\354p\252\326\316\334U\375]\022)F\251e\222\276"
+	.ascii	"\fNg\353\262($A\370\0315\023\234\024\007B\0173\241`\033_\351"
+	.ascii	"m\324\030C\335\371\201H\200|t\374\002\301\355*O\031e\fA\230\337"
+	.ascii	"O\007{\222\376|t\020\377!"
+	.text
+	.section	.gnu.lto_mspSerialChecksumBuf.27.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\203\001\235\017"
+	.string	"\006\236iE\360\256*\035\206,>\227\032#\022\270\204\2054\276\356\237\321XdN\277C\352\375\\R\007\347\261c\213\357\231\276\307\031\203\232e<A,u\023\331\n\347\314\307\263X6M2;\344\b\026Z\371?\004\221\275\245L)U"
+	.string	"T"
+	.string	"U"
+	.ascii	"\326\350.\023,HYu0\006\343X\030QRk1'\350-\007o\3020\f\037\301"
+	.ascii	";\252\3522\256\252|\320\215\205\353\023\271\214\233\026\314\003"
+	.ascii	"\306\327\212 \232\031\227\327\256\257o\245\021\304\311\367\265"
+	.ascii	"G\021\267\030\327wr\335<\230sZ]\237\311\315\3356\312v\003\373"
+	.ascii	"\266\277<\355\216\007\357\325\313\356\003\b\360\"\005\004\230"
+	.ascii	"9a\241\213)#]>\330N\331\035\333Z\342\263\324i~\211\031\223\245"
+	.ascii	"!\3262\347\3340\203\356\322@\\\265\317r\022\251\203!\0042&kv"
+	.ascii	"A\001\370\001\334ew\001\334\245U/Sy\347L9\3212'\270\021\217\373"
+	.ascii	"\225\031\n\226\322\370\363\270\335:\270\305\220\244\3049\347"
+	.ascii	"\214\356\254\256g\365\245\004\303m\025@\272\016~\bw\331Y]\361"
+	.ascii	"\3120\242\241\021|\227\263\250\233\n\222\020+\r\327\006\323\372"
+	.ascii	"vUlPDA1\232\031\357\006\333\023\325\235\2037\247;\355\337\034"
+	.ascii	"\374\271\313\002\036\243\216\r\241B\022\"\t\344DA4\232 \352,"
+	.ascii	"\372t\2048L\243S\204\217\023\311\363\340\b\221<\221\351\344}"
+	.ascii	"\n\270\36412y\250R\311\344u\300\371\030u\277\257\3050\251\221"
+	.ascii	"\031\331\225\\\025\277\366\256\006\205e\273\315\306\003+\313"
+	.ascii	"\341v\367\365\332%\212\211\365\254\243\312\325}\331\266F  \240"
+	.ascii	"\002\2413\356\377\030\346\321\356\004\270f>\326r\265\352\027"
+	.ascii	"cp$\210\205LEA\370\266\323\367\311\034h\311r\353\235'C\336m\004"
+	.ascii	"2\214\220\305\032F\023Z8h\2045j\236\335\307^\236Ev1\007\\\007"
+	.ascii	"&b\272\326\023"
+	.text
+	.section	.gnu.lto_mspSerialSendFrame.28.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\250\003\025\027"
+	.string	"F\253\225F\260\030U:\360az,\203g\202\235\260\304\\>\216<\377\300\356|!\214\245\322D|\036\017\223\340\226\341\3656\360\313\007V\\\037\226\252\027\fx\274\225\347\341\355i/\311\323?\302\327\261\b\247\204\352\222F6\2212\245\201"
+	.string	"x"
+	.string	"\201"
+	.string	"F\002\236\246m\006\213\"s\316\003N\240>@\374TW\373\272\367\240}\027\342\2509y\202\212\314\271;\340\031\361\322;\321\266\277\343<h6\022pg\003'*\001D\002\b\2269\247\252\300a\302K\360\001\302\313\255q\332%\270J\363k\227\fxPn\270\025\007A\0030\204v"
+	.ascii	"\340l \314\320\214)$\234\b]\022\316\006\026\230s\276w=\201\323"
+	.ascii	"Q\025=\230sZo8\025wx\333\027lg\260w(\233\263\017\316\345\261"
+	.ascii	"\017\364\313<\310?\340>\376\230\357~\001\347\335\251\017\371"
+	.ascii	"Q\377\371O\377\361\233V]\222j\222T\277H\365H\252E\251\026\255"
+	.ascii	":\024\251\245T\203\241z\245ZW}\002\001\202\206VL\346D\361\333"
+	.ascii	"2\233\310#9\316\373m\232\3373\3116\357\203XK!\n\211\242\304\312"
+	.ascii	"\234s\346\322\023\304!9\027\022\200\200\230\210\360\023\344 "
+	.ascii	"\b\210\230\323\264\371\3744X\375\217\342J_\225,\272\224\212\326"
+	.ascii	"\306@\243\277\231\264D\264\242\235*=\272\234\265\241\305\212"
+	.ascii	"\021ps\251\r"
+	.string	"wi\370\b\311\r7\244B\242\213I\301\265[.\375M\356\257$y/\312u\316Y[Y\270\233\301G\212M\265\270\244\272\366\315\006\375mWA\f\333\326l\277~\304\2038\347\\\340\033\251\020\023o\204\b/uI;S\262\350r\364g\324~S{.\2475\355\367\275K\035D\204\214\200\241\243?{W\32363\r0\327\312\365b\215\0208\260f\261\331\t\346Z\265\306V\330\032[\013s\255D\254\031\253\006\204\271Vc\215M8\326\330,\216\354\265n!\340\300\272\031]2\032\034\331K\005\273a\275T\255Q\246B \343\030\216kT\315b\261Q\265\233\007\347\362\270\303\013\036\230\032\311h\201cg^Z\023\266K\353\0079\253#7\247\244\265)\320\330\236\220V\372\256\364\240Vf_\234\274d9\355\200\0351\031\255\364\371z`\324\2641+\256m\341\302\b\241B\250A`\205\004\b\031$\221H \"m\2129"
+	.string	"\003\021\241Z\007\021`)\205\244D\022%\205\007\003J\236\362\300\344\332\211\021\2034$@\326\224 \201|\367\366>p\335KD\336'<\307\254\t\201\302F\314\2732\230\243\352L\206\200\2345\200\220\244\203\210\3601p\377-\206"
+	.ascii	"g\022;;o\203\216\\\317\225bo\320\215y\300c\020\327baX\277pu\315"
+	.ascii	"\366\355\367\034\361\324\2150\001g\023\222\234\212P(1\303\334"
+	.ascii	"\016H\005"
+	.text
+	.section	.gnu.lto_mspSerialEncode.29.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\266\r\305A"
+	.ascii	"\272m\b\030=@\350M\007\310#a\251mBH \205\023\270\232Tw\355\244"
+	.ascii	"\254\027\374<\205\237\210%\022$a\221\242 D\373\340=\250\302\025"
+	.ascii	"!\221V\356\232\251uZ\301\035\"\"\"B\233\354\275SJ)i\001Q\001"
+	.ascii	"u\001m\303\300\232A)\346\356]\022\305t\373T>bZ\257[\256\233N"
+	.ascii	"\267\235n\272n>\335}\232u\226\271\371zO\317\316\"8/\266\363\230"
+	.ascii	"\211\314\215\307Ll\365\231[\356\271\256\323w\272\256\355\372"
+	.ascii	"\216\211}|\314\371Y\312\301\352\351=m\363Y\372]\272\301\266\332"
+	.ascii	"7\331x:O\333tbJf\3626\221`\032s\357Y\f\266\325\2443\205\253\266"
+	.ascii	"\355\214\261wLp\316-\323\337\275q)\350\360\235\262\231\274M7"
+	.ascii	"\350\030\022r|\3072\317X9\267\350\337\275w\252U\366\300\276\267"
+	.ascii	"\034!i\3626\263\250Yp8D\002\255\332\231\033\256\337\264\035W"
+	.ascii	"\244\233\356\325R\247\347\3368\t<\305\266\312q,3s\263\3516-\363"
+	.ascii	"]\032\327\206\026D\362\3109\247\322\275\327J\331Nk\253i\007X"
+	.ascii	"[}.\335vS\022y4\026\211C!\033\\\325\364\275\345fvS0\t\025HX\230"
+	.ascii	"\270u\022\231F\370\3333\251\t\235\271\245NK\302<\273\314\231"
+	.ascii	"\025?\032\213U\232H%U\356\265T\231\263)>lBgje\316\244\270\360"
+	.ascii	"\256\245\2600ikV*\030\354\200\205IZ\257G4'^\231\253\204\316\242"
+	.ascii	"\244\312{\357\021O\233\364\247\021\324\37649\242\031I\235\006"
+	.ascii	"ea\324w\355fhM\367`\207{/\373\023\215I3\200fn)f&\302l<\006\f"
+	.ascii	"\242%\245\337x\375`\216\\\340\275\227\251>\033\373o\350\250U"
+	.ascii	"\314\n\234Ku\324\332\340\315\270\205\254\023\236\300\027/\r^"
+	.ascii	"\230F\346\3214}6\3478f\373\036I\203\326\376\265p\217X\377\201"
+	.ascii	"\304\361k\272%f\016\321\216F\374o\360\203\363\357FO@2\217\266"
+	.ascii	"TzQ\t\366\336&\026\267_+2\221~e\255\375\314z*?>\f:je\346"
+	.string	"\tm\027\305Xl\244\024\316\201\273P\033J\301\375\205\333n\005\367\263\325\357\025}2\005\376=y?\263\013\030\336\317\252W6\237\311\334}]POf\031-\210\006{\357\265\020\250m\253q\225\350\013\221\265\325\376\276\353\024\260.\357\371\204\314\243\314qL\1776\346N\357ka6:\323\350\270n\031/Z\240\3102QBD\3535k\310\320v\232\261ZN\367\204\356\323\\\325p\272\247\214\316\016\206\316\rZ\256\231\301\002\005M\247Y\352\350\2544:'8:#H:G\025\235\241\212\316\007\210\316\006\206\316\005\214\316\004\214\316\003\216\316OFg'\243\263\200\243s\200\2423\200\242s\023\32199tF\016\235\217Eg#\322\271\210t&\032\235\207Gg\241\321\231\035:\007\213\316\353\320Y%:\247D\347\037:\273\3209\335:Y\331\313l\361\030'3\306*\2246\212\367S\304?A\271\353\0030\305\301|i\327\220"
+	.ascii	"~\006\240\250\023\332T\305\273\264g\334\3325\244\037z\002&\277"
+	.ascii	"\351\333\271\214H~p\316\243782\2172\322\212\263\215eq-\355\032"
+	.ascii	"\262-\213\244\226\315\327\306\220\037<\344(\020\316x\264\242"
+	.ascii	"vL\001\001\3259\241E#\025)>e\330\355\233\361\203\374\211z\232"
+	.ascii	"C\341\353\007N\020\251\2114\005g\316\017\321Rkx\2500^\334\211"
+	.ascii	"7\231#\250R\244\342kx\007\344\204\256\255\265\022\277\370]\246"
+	.ascii	"f\204\370\275\327\"\236\360QrB9\357\310\2221\303g\343\266\002"
+	.ascii	"\206\215\360\331\270\361Z\270F\206.\250v^\013\311\230\t\263\006"
+	.ascii	"_Pu\335\0302\321\275\027+\310\206\027\230\006\301\253^\370\303"
+	.ascii	"\177\321\342\207T\336n\255\027\357\247\360\257\360\364\372 8"
+	.ascii	"\373\235\347f+\236\332\034\211?\227\\\325v\357\345Fk\253S\315"
+	.ascii	"\334\212i\311x?[\274\262\354\231\\\244\371n\225z\366c\354\t*"
+	.ascii	"S3\302\006\337\217x3\230\002\352E\235\320\340\2631\363j\306\311"
+	.ascii	"\3323~\235\331\246yJ\244v\373V\365\353\007\321{\344\204v\264"
+	.ascii	"\307V\346\226Mg\302\324\276q\352\274~\340\204NM\244^\237\r\332"
+	.ascii	">\326\252\207\372R(N \365\231[7\0358F\251+\265o\220m\036\236"
+	.ascii	"\200\351\253\357\207\234\320\\Cv\260\300\241\365\325C\210\226"
+	.ascii	"\212\t@\214^\\'\264~h\341\b\346\020\373\220C\354C\227\330\222"
+	.ascii	"\307\026\227\216-\326\213\353D\030\016\035\253\027\327\211\255"
+	.ascii	"\260\255\325\353k\3072\214\353\005\330\262k\370\203\213\307\226"
+	.ascii	"\026\330\n\266\354z\336\252\352\241\265#\214ky\003l\331e\345"
+	.ascii	"\265C\253\313j+liU\005\305_`\\aV?\276\276\302\254\210q\267_\013"
+	.ascii	"\373\260\243K\322\020\256\331)9N\265\003v\360\334\201\354\215"
+	.ascii	"\260\3302\275\027\013\207\273n\372\203\343Qn\372\323\352\036"
+	.ascii	"<$U\367^\253o\266\030\375\355L \226\252\031\274Y\377i\341\332"
+	.ascii	"\233@H\226\215\n\236S"
+	.string	"V\352\027\274\0313\006g\360\215\327x\277\300n\205\2036\031I\332%\336O\032\037lr\245<S\331h\244\274\3655\237\371J\016A\r%3l\221\013\214z\004\237 \003\326'@\360mw\245\352\243^G!'\324\3154{\237-\266\303\372')P\240\364\324A\375\214Du\007\362\264g\360\030\370\003v\f|PNN\001:r>\367r\306\n|\377\351\007\207\242\201p\027\372\036\231A\272\230G\335f\351O\317q\257\205ki\350\212C\276\026\222y\243#\026\025\240\220\220\351\215\252\233\257\353Z\264\253D\004\036E\326\023\370\033w\234\320\247\037\220e\342\007<\375U\036$\247o>_\363f\342\225^\326\n\336\351c\004\212\226\230\364\226f\301\211\037\340\005|\t\021/ \300W\310\313\263\340j\201\026\250\2210\346\020C\246FDD\222$\3110\006Q\005\304 F!\342\r\021`\2514T3\"\222\024$)\r\007"
+	.ascii	"9\355T\237\263R\304\037\002\315%o\260\t\262\f+\256\232m\200U"
+	.ascii	"\2620j\327\223\3526\322\322Q\243x|\260t^\210\270I=\002,[d6*\331"
+	.ascii	"\247\340\204\223\370@\021\352G\322\333V5\006\030zN\304\252\221"
+	.ascii	"d\272\204\334\027\204\222\267\234\032\252\261\377{\332\345Py"
+	.ascii	"\031\366\030\325\242m\273Y\3510\337\250>\305M\234\305\033\216"
+	.ascii	"\202J\274\306\307\356Z\253\346\240\177\255\240n8\004\302s\207"
+	.ascii	"\3158\27252bq\243`n<R\262c\006\201R\321\212\251\020BHd\210r\241"
+	.ascii	"\262\363\226(p\346\362vL\017\216\377&X\332#\212\016\033\352\321"
+	.ascii	"e\002\322\305\376y>\217\241\203X%\016`\314&*j\033w\226h3\031"
+	.ascii	"\005Mme;r\002\021\016\0308\007\200\001A\020\2631\221\370eF+p"
+	.ascii	"|&\264%\231U\226e\311\243\344\311>\374\376\330\232\330{DnH\231"
+	.ascii	"\034\302f!\365\327\027\317\350\250i\256x\231h\316p\374v(#\253"
+	.ascii	"\232\270\313hh\177B0\216^\216\301\317\323\256I\221\3269zF\033"
+	.ascii	"eF\241(\212\272m3\201\362\260\005\243\034\016\325\3131K;f{R\024"
+	.ascii	"\303\213d:\302\001\037Q\007\233\254\314\0223\244\2279\346H\234"
+	.ascii	"\027\335\031\263\311V\252\026\363T\334\003C\341\322\326#*\263"
+	.ascii	"\302\314\230D\202S'\224@*?na%\374\005\324C(\354\366\365\222\301"
+	.ascii	"|/\235F%\213\330\221\343/b+hf E2hS\342\330T4\225\021\313\357"
+	.ascii	"\0362\340\023\230Y~"
+	.string	"n\245;f\206\335,\257s\216\\\324>\304b\330\0167J4\253\377y\240\343&\203\351RV\374\273l\210x\214\236\255\223\360\265\356~\207o"
+	.ascii	"\357J\002\021\305\307\021\311\007\200\211'\3359\346\362\333\235"
+	.ascii	",\245&\370\f\260\247\237z\361Q\340\340$\254m\307\317\2345\235"
+	.ascii	"4\234\002*\272\256g\321\213\353Fi\013\276d\275\020\031\242\217"
+	.ascii	"\247\022W\333\222)\272\242\006"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedCommand.30.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\343\004u\036"
+	.string	"\266\264\273I\220\330Q:\304\2442\271H\241q\226i\346\023\321~\262mM\356\354\344\002\352\016x\243H\0212\351\307\250v\260/\246j*\371d\226N\360\t\315\030\241\344d\200O\306\f\324\336|}\217\367eP\356\0029\211\023K6\331;\311\243"
+	.string	"\234"
+	.string	"\252"
+	.string	"P\271'\207\222\364-\244w\023\224\320T\022\262n(\023\346\357S\036\"J\266T\332Q\2751^^BM\216\225\364,\0274\246\264\201(\306`\271*\353n\240_\0162\177i\344wJ\233\276(\326j\375\020\006\217N3a=yu\247\017\030\310\374ef\276\222_%1\312\223\n\243\b\314\270\341\344\244\254;\255qz\003\345\257\371\235\362\327\3728z\322V\224\177\343\311*2_?\240\357$\215[\262\001\231\0244\003\200L\244\201'!\277\033_e"
+	.string	"\227j\235Y\350n\256?`\324\371\236\231\205\230Y\005\363]\020;\007G\346\177=\313M@\217\236\360\213\245\366\031\214\304\255\210\020\023\345w*C\263\240\225\252n\245\377\370R>\245\004?\310P\375\357\227?T\022=\312\216m\314\270\033sl\373\275\301*X`\266\202J\365\rs\352\253\226\007\363\311\266;\230\271\362\317\263\316>O\377\236\017\377\002\002*\2339\225g8\225\313"
+	.ascii	"\225/\200\312\244Y\331\316*\327\262\362\023\034\214HY\031\026"
+	.ascii	"Z\335Oo\330\264\330\2352\344Y?\361\337\372\271N2'\361\235\\\353"
+	.ascii	"\305\033\031\207\013\211l)\235\356\251\037D\272\003E\214\357"
+	.ascii	"z\021=b\316,\367X\037Ks\262>$O\203Z)\020J8\316\354\006\252 6"
+	.ascii	"\226\f\321\362\304\317\202_\252\216\240,\336.\366bi\2137\266"
+	.ascii	")9\331\255\264\367J\230\232\341\265\305\021l#\355\265wr\243\204"
+	.ascii	".9\031\224\ti/U\230\325\320\332\261jo\255-\3334\031Y\342\013"
+	.ascii	"\017\023dVK\200\270E\315\3202\023\035Lq\354\353g\346\313y\340"
+	.ascii	"\330\335\030\356E\203\331\335\266.'8\374\b\273\373"
+	.string	"0\312\337\333\336\030\227_\360ag\356\300\036L\004%\363\207\033ol3\321\367\224\314!n\034\301\266\033\254RvFK/Z\360\212z773\312pt\356tN\244#\334\321Y\032eHa\204\323\351vA\347Y\224\333\365@\360N\335\016\357\324Y\316Ah\201[\321+:\211x\247\256f\264\002\247\253\345zg\r\302\001\336\361\212z\265\243\335\256W\303I\373\374ciJv\211Q\342\026\022\331\235\243\302\271~\262&\304\377XK$c%EF\250\246-`\231Q\034\250\016Z\023\217\272\204\372\3109:0m\017\325\025P\345\352\033\242pDh\343\252\366\273\356\006\005\222s\\ D\247\320!\365?\316\001\253!\026\303\372.\\C\346e\331E\351cy\250\220`\211a\252k\230A}\327\265\320g\250Q4\210\230AJ\221\020\005IR\220B\007p\002\021*\244\036\020P\247h\f\222\346EO!:\371\353\177\211"
+	.ascii	"\252)\266L\216\226\023\344C\317\247\232\351JM\032\3018\260<M"
+	.ascii	"\263\202&\006\2666\362\2344\035\310\2672\323U\020j\350uV\"+!"
+	.ascii	"\364\305z\302Z\260\230,\200\020n\233\307,_\266A<H\013'B\007\210"
+	.ascii	">?\260\024\3247\262\232\357\007\230\020\370\024\215\310\ttJ\216"
+	.ascii	")Z\200\250\031\202rv\320\237\210\362U\005\3245x\324\204\230\302"
+	.ascii	"\342d\bCg\302\345\314N\r(\242hm\305\226\016\226.\033\013(@4\272"
+	.ascii	"\341\372g\\\352\320L\016#\006K\353\213\201'\246eMu&5M\324\n3"
+	.ascii	"\232[\352A\027\304>\225d\177\345\006\302\003\f0\361\240l\233"
+	.ascii	"\237\202\272\032"
+	.text
+	.section	.gnu.lto_mspEvaluateNonMspData.31.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`H\001U\016"
+	.string	"6\032`E"
+	.string	"s\224\016\270\331\344e3\242&\005\305#\"\366\214\221\243\212e\257\021\215\253\207\251\347\273\304\246\266\276\376\3240XG\r\036I8\341\201MX\001^U\352\200h\023\216\r\275\207\322\006k\244\215O\332\336{\357\224\002K"
+	.string	"H"
+	.string	"L"
+	.string	"\247\016\331>\016\262\254F\005\016\02003\273\213I\024\017\275\322)c\310\277\3137\245\257\303\253\351\364\003\347\363\020\247\310g\272\234\tTn\224\b\360\221\346\310j\245\307]\036E|\243\0305\020v\327\261\364\221\2705\267\235\331~`\337D\227a\030\206\226'\373\251\237\036\374\347\214\376e\200\265\332\200\354\216\b\207\254\212\306\260\260}\216m\031m\006\016B\007Q.`G:B4x\264\377\3420BO\245|\300\356)G\215]p\201\025\\\247\006?RO\257\023\250\001S\242\256U\333\302gh\327\356\232\3702@\030\n\260\264\244\324\323\215\211\345\202\365\025%\025\225\224(OyI\362\302\203\024\205\330\336\016\303]\273$\023\377\34516\370-\247\366N\342K'\365\364r\263\343G\220\224(\20668\212\022e\007]\347B\204\n\031\007-\363d\035"
+	.string	"P\307I\370x\233\306\236\222\f\035\255\313<\n\037o\3034h\235\r\363t\036Vr\300\334'\3530\020\307u\030\007\024}\256<Mh\251Dr4wwk\244\321\232\261\214\314J\f\225(#8J\235\222\244E\212h\243\265:\021\035"
+	.ascii	"\357b\314\304{|4(\034\004\r\002!\220\035\026<\200\305^\324\351"
+	.ascii	"\"N\013\007\2746O\263e\212\335\313\304:Nx\016|\2139,+.\274Qa"
+	.ascii	"\\0\"@E\001\356\310\323&\203\240\035H\361\263\351\032\202\202"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_mspProcessPendingRequest.32.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`y\002m\023"
+	.string	"&c|F\320\224\321p\222Kx(\204\271V3 \0251Nkt\212\212#\331\313\242\001\204ej*\f\327\316\023`:\354\323\n\3550\252\325BfD1W\361"
+	.string	"W\3501R\307\254\235\036r\202!WH\034\220v\333{K\231Rn"
+	.string	"^"
+	.string	"j"
+	.string	"\341A\307l\247\367Rl\252ET\215h\311\356\256\024\305c\027S!\370i\306|\331\305"
+	.ascii	"*R\347}\205\343\"\254\235\334nB\225\025H,\214\300G\004N\301\020"
+	.ascii	"\350C\022\237\034\334\277o\301\216\220\021)7\017\237\312\322"
+	.ascii	"\211#\252\033-\365;\220\343yJ\271\315\276\226 J\265\363\236 "
+	.ascii	"n\264\314\324\313\356:m\267\234\033\300m\353\330v`\247.0qw\037"
+	.ascii	"\37030p\020\177\016\3725\341\301\353yO\2403>\355lr\264{\262T"
+	.ascii	"\235}\035\307q\264\346\354\357\376\223/\035f\032\324\364\247"
+	.ascii	"i\325tf\372),IK.$\2738c\324*\201=\200T\266\237\366e\\(\366]\315"
+	.ascii	"\007\354\346\214\034\355\366\032\230\201x\320\275\253\204\007"
+	.ascii	"\305\023\bG>\217\344\t\332\036\035\276\221\235\304\203N\333\342"
+	.ascii	"\204\b\262\217\303\266S\352\007nW\366\235\264\255\002U\017-\233"
+	.ascii	"\330\200\201\n\276 \272N\007\206\r\230@\232\212\232|D\316\n?"
+	.ascii	"\325\335\320\020\325\324O\r\024\271\t\232\371\302k\260To\324"
+	.ascii	"t\222v\313\225\267\245^I\317Le?\224\211\261H\r\013\257\026\206"
+	.ascii	"\232h\te{\303i\0044/W\204\031X+\345\030\227\f0\254\227\f\254"
+	.ascii	"\302\f\254\265\322\300\202i\255b^\260\225\313\212]32\257\025"
+	.ascii	"\215\313\365Z\251z\373o5\227:\363o\334/\337\356\256X C\265%L"
+	.ascii	"h\261)\034\251\003\n\323\nS\250J\302G\214\357x&\361R\002\322"
+	.ascii	"\207\t\355\030\231\274\315(I%\224h*\363s\234\005\247$K&\020j"
+	.ascii	"B?\241\352\3745 \220\002\221\271\273\001\2171\246\343\271+\232"
+	.ascii	"\207+\003&(}\221\212\211k,'\255\340\262\304mkw\217\236\2439\256"
+	.ascii	"\245\276,\232\037\234A\345\342\005\246\262\267sc\351\245\305"
+	.ascii	"\300\360\330t\315-\036w\365\325\202J\211\007\262*3\240\241\321"
+	.ascii	"\346\003X\272\222k\037\035\\\330h\005\004\326\331}\215\276\270"
+	.ascii	"\336\256\346<Z\340\022\237\313\201]\033\233x\220j\206\003\311"
+	.ascii	"\356V\227,\344("
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedReply.33.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\313\001\225\020"
+	.string	"\006\037nG\340\322&\035J\033-h8\fY\021Y\314L\324c\274\216#\273a\350\325\177\b\205\276\243\221\236}\351\250\034\216\320\025\210\323_GX\242\267\002!\020\203CA\365\217\330\016\313_DC\240NJ\f\235\213\244\221M\344N)T"
+	.string	"T"
+	.string	"^"
+	.string	"&\237V\260}\276D\212.%\246\235\371\211q\227\366Q<\005\354=/'\331\305!\202\261+\"\260\311\366i\361\001\264\317\355"
+	.string	"\264O\303l\242\213\261%\355\360\324\214?v\227\323\234\303.a\376\307\213\20470\227\244\004\273k\031\336p\270\365\266\017\330N\261\245\204+_\307\037Y\374\360\323\364\226\3669=\334"
+	.string	"R\024#\217l\021F\352\b\373\331\356\256\025\307\276\370\227\336\363o\233\364$Ig\232\264Ni\231I\337d"
+	.ascii	"\004\016\227\032\273\033\216\202\354\320\224\261s\240\337\376"
+	.ascii	"G\217\370>\377\201\035\350\365\245\261a\260s\242h\327&v\203\217"
+	.ascii	"\017|\312t\352k\206\304@8\215\b\231\316\0229T\355\t\237!\365"
+	.ascii	"\252\252BhH\310\270\302cX\330\244\212\004\t\361\364\\\355\013"
+	.ascii	"\177\001\372d\243>\246|\372\\1\022\n{\370.4\b\210\205\266\352"
+	.ascii	"-\272mwO,Z0\f\330\241\363\242}^)\030\361\b;\254$\212\037\364"
+	.ascii	"\025\001/\226\327}\263%\345\305\362\272\025\020\354T\256\317"
+	.ascii	"\201\007\266H<\260\245V\235\260R\253\257\003Q\036\330\342ZV\251"
+	.ascii	"\026\247\372@\356\244\200]^\367q\031\\\256\217\033\021\367\331"
+	.ascii	"*\216Q!\206bT\306\257lW\004J\221\217\212f/\270\r\225Rl\346\350"
+	.ascii	"0\341\203\200\274\212\217,[I-\205>\f\315(\214\247\006$ `\202"
+	.ascii	"!eh\007\257\030s<\251\302\325M\374\314\005v\367r\025\033\247"
+	.ascii	"\236\372\301\362F\006sR\274\213\320k\007\023\245~p\250\363\005"
+	.ascii	"t\273\021\335\004\334\241\271\220\2614z\337KVlY\377\223\327\027"
+	.ascii	"\016M\301:\307\226\207\217!a\224\370\021\001\033\005ty\321>2"
+	.text
+	.section	.gnu.lto_mspSerialPushSubscription.34.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`P\fE?"
+	.ascii	":h\030\027BP\346Q\007\033\311\241t\331\315\250\370N\300\326\016"
+	.ascii	"\224\333\252\np\020\325\357\036R\002h8\340G\035M\340\310\317"
+	.ascii	"\375\366\320\001$\302\237\376jnG\336*x@\207X\261\322\017\265"
+	.ascii	"\2676\333d\357\235dJ\001X\001Q\001`\001\322\\\366\323\263\254"
+	.ascii	"S\253\256p\235M;\034\234\206\363\334\314\036V\315\"V\227sN\341"
+	.ascii	"\276\365\022\311i\343n\272\201\215t"
+	.string	"6\375E\032\001\221\335@g\337\247\216\306\335\032\230\306\325\274\276F\207\313\305t\325\220\001\252\313YZ\302u\226\270\232\3613\257\267e\ty\312\253\202\310C'\343l\257\227\321Z\263S\232\271~\320\037R\265j\316L\b\316\266\224\353\254\017\300\322\036\003\206\331\213\355Yt\334\355j\036}}\315\207'\345\374\344\217\233\234\245\022\032\202\353lK\235\251u\326\365\245\326\331~\273\005\271\024-\367\256P\225\323j\316\271\370Qz\350\253\324[\210_O\032\n\203HG\300\237\317\355\265\354\372\370m\347\362$w\363\341\332\373\"\263\342y\230h\353\323]\335\233\303)\261\260\027\005\245\271\304\203H\275('\315\247\037\375\230T-\r\230\344\227\207yd%ja\"\301\276\036t)G\211\273+\261\316\035\245\347a\032Y\023<Yb\347To\322\302t\342\236\3039\013\rkS\263s\322\\\342\255\231\263k\201\247\334\220`\031\330\312"
+	.string	"\0174\320\027^\233\2344\245\370\257E\246\232+\3012\257u8\210\313\033ws<V\226\304\270\027\225sn\274,kz+y\267Guw\263\033x\f`\317\244\237#4\027yq\313B]Ohwu\253V\031\367e\2559;\201\3626\377\"\212\322\352\310\340<"
+	.string	"C\244O\376\317\372C\333\224\304\266\250\211!=r^\370\256\025|\323\367\020)\361\326'\276\202\3677\367\240%\t\235\030\245\031,\377\376\353\273\033\3303\211\363\032\377\277+\361B\370\236\021\370#\370\351&\341yL\2709g\247v<\034P\270T\234\365\252\253h\235\365g\025%\262[\353\302y\315\204\273Y\264\300\276$\276\273\271\317O#,vu\311\347\352\226&\361\237\255\211\206!\322\377\244;\210\273\304\0177\t\021\036\347\r\345R\367\f?\334\n\202\270\233|\2157\321\327\334\0178\034\357"
+	.string	"C\334LA\334"
+	.ascii	"\224p/\005q+)\341N\n\342\036\002q\013\203\270\203A\334HI\270"
+	.ascii	"\217\206\270\201B\334\277 n\037\022n\027\210\273w\204\273\375"
+	.ascii	"\341f\177\270\327\037\356\007\342\306?\334n\242E\302\254\022"
+	.ascii	"\362\221\2273Y\036\243|\207}\273\342q\356s\334\353\270\333q\207"
+	.ascii	"\343^\306\275\315}\215\373\260\257;N\273\034\247\343rNm\240\035"
+	.ascii	"\255\250d\330\232e\211\345\350\326\321\032\346<\331\307%\213"
+	.ascii	"\221\272\234\2316\3349\306\246\020\272ls\323\302\215\303A\364"
+	.ascii	"\n\324\243\207zlG\211\007\345Ms\317\216\236\235\202y\201N1H@"
+	.ascii	"\007|7s\306\245\2559]u\317\323\267>\363;q\247R\231\030r\377\254"
+	.ascii	"\375%\322\376\376\310\366\247\002\3669\247\363\032\241\372\234"
+	.ascii	"\313\275H\\\337w\206\377=Q\371\\J\260\222wI\220\256\201\357\377"
+	.ascii	"\315\024\355\031]3\266>\307y8\341T\335\017\264b.'\367F\335\227"
+	.ascii	"\353\275\373\236\002\023\031\201\340\251\373m\202\207\274P\001"
+	.ascii	"t\277\303\351f\367\206\233\336~w\007\314\224\023k\263,\204\203"
+	.ascii	"\320\310\357\031\006\362Fq\266\361\017\016\257\224\005>Zg\333"
+	.ascii	"\027B\305\224\336\375N\251r\340\212S\337h;\271\207^'\320v\277"
+	.ascii	"Y\234\372ni'\027\316)\230C895\001g\334\365F]\3169\255\336a.\234"
+	.ascii	"\361\200\320\2608Fo\032\017\347\264z\347\213\336.\357\2277\355"
+	.ascii	"M\253N\265S\367\033\306\251Y\355\344\254S}\0044,ni\366g\342\276"
+	.ascii	"\232\275?\353DSEC\216\350\215f@\3139?9{\310\357\274\353\274b"
+	.ascii	"\234\317\322\314\353\244\020\320\345\334\345"
+	.string	"\313vA>HC\267\225\024\366\245T\333\301\321L\265\323\273hi\326\022\001\005{E\360\322\234]MJ\236\300\261\177\306\307K\340\3411\244g\216\304\227`\237\370$\336\335\374\263O!o.]c\002\362FU\016\035\305+c\001\255\033XTG6F\357\312C\016\244qH\305\243\n\271Vy\226\361\352\251\254^\034g\2605\220:\260\326+\0172\256^XY\031\245\220H\252\030\306\343\t,\244\325\022\026\322\352;\306\204\033/\252\216T\310),\244U\361\252\352\205U1\306\021Y\234`\240\215XT\307b\016\243\361X\004J\273<\252\353\223\236\244U&\253\355\003\306\276e\250u6>=\360\335[\210\266\024=\320\223\345\016\230\322\247\323\351\235\256)\223\231\037\364\307\231e!\227\351\213~\326\330\244\216\316=ULF:u\363\365\315\271'\331'\215\331\360\317\332\367'(\342\377O\013\301\003\374X\200\007\360\276\266\364"
+	.string	"\266\354\360\332\033]z\004R|\3159ga\004\017\360\">\211\263\f[\237\240\317\367o\246T\236\321:2@\300\004Z\"\031\347l\300P\357s\330\313\233\226\200\256\313V\243\255<\030ww\300\236\253\241\260R\362\375Jz\245\367\243O\372\037\323\203\001\017_\354\035\303\276l\342\327s\265\360\207\357nUF8\240\262@\370><\323@\317\350\333\205\247\221\260\243'2\263\267BGM\021\340\237u\360\221\336\023\261\315Y@\363\222u\277e\257\020\354\313\340{\031\023\257\347j\354\r\327B=\322g`\343c\006\367!5-d\277<\307\321B\375\217\231\212a\013\201\b\250\241(\306\024S\206HDDaR\220\2441!\005\204(\350\250K\017\021p-UF\2324\351|"
+	.ascii	"Z\310\351\260\"\314\331\272\324\337.\210\326zQ\332G/n\"\217n"
+	.ascii	"\265\323\302\330kc>\277\300\031<B\275\264B\tT\267 \022W\342\301"
+	.ascii	"\377\300U\006\003P%N\276\027E\3375\267UD\353#(\337\030t\315P"
+	.ascii	"0\005d\357\222\222\026W\320F\3606|\247\244\2339ql\024\324\376"
+	.ascii	"nU!\254\330\343\030)\241~\t\360\024%\213\215\025Y\222o\325\376"
+	.ascii	"\261\263JL\232z\335F\207<m\251\206\364\346\265\374\255)\013D"
+	.ascii	"\307sQX\244\270\024\316\360\307A\005\211\017\323l\334\364\314"
+	.ascii	"\221\274[\003\336\367\033mDSQc\343"
+	.string	"B\347\260\251+\202\217\310\264V\340\312\007\363tP\002(u\212&\333\253-J\272\321W\030qP\277\310`\356\306\bR\314\302a\244\363\217*\264\245\005\200nO\330MHl{\b\n]\214E-\274\374N\0254\324\212\277\276I\2038?4\204 kR\021C\0050k\273\342\227@A,\3105\373\206\306?\020\322\013\267\006K3\234\366lc\341\"\244\365\253o%\360;\001Z/\004\360\244q\n\253\311\223F\240\036\031\312]\226\277D\260\210\263\020\241>$\016\017\311\003\031\300\215\005\002\264Fe\327\tq+\367\325mK+\213W7\327p`\200YVR \240\357q\n\217\205\366\352DT\316U\366\f\271\006\235N,\346\364\264t\255\360h\221B\2643\321vC\005\225b?\322\254yB\375\033H\320r\242\332\351/\221J\004\253\234\323!,J>r7\373\016?\335f\365-.\232\246\315\310p\314\354\205m\312"
+	.string	"\032\244\364F@\236\352\n\333|\004\230K\345i\202\364E\034%\367q\371\004E\247|\2265\364\236\001\030"
+	.ascii	"\316\323!\240\377\301\214-D\360\363\230\314\304\347-"
+	.string	"\267\226"
+	.ascii	"\222`K\004\233\243\351\354\235gz\307\035h\240FVU\261]_\263y\034"
+	.ascii	"\247\303\316\312\222\250\001"
+	.text
+	.section	.gnu.lto_mspSerialProcess.35.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`M\013\3759"
+	.string	"\272a$\026EP\344U\007\323\364\361\023\327#Z\261\222$\224\237\300\343\230\260^8\037|\330|\240@\202D\266p\034f\267\034\022\007\371\003@\013\200\210"
+	.string	"\n\212\206\300H\001\21241e\025\252\316+\301\262\244\353\333\337{K\231RK\0019\001Q\001\325\242\177}\006\357\337\217\313x|\031\242BW\177L~/=\204\206s\024\331\226\016\274\177\275\312{\355\376\324\017\223_\354\207\367\346YK\255\314<W\215\274\210\367/\321\007\301\377\272_\204\377u\331\275\316W\273f\241\251\033\363\313v\236\347\243\335\304\205\276\337\255\276\013\330\362\013\t\b\020\004\240\bD\034\n\207\202\300_\354\353\361v\360\353n-\373\357<|ywKI]sJ\371B\356\020\314\235"
+	.string	"\245\0050\241\232\362\001\202\274\244h"
+	.ascii	"Z\247\227K\204\215\242\213@D\327\300\332\233+\257uBq\021Xe\215"
+	.ascii	"\371/\247\023=\324:\273\230Z\bSa\375P\020\312\003\335\n\313\255"
+	.ascii	"\325k\235W\356o\0173\316\1779\243\372\027oA\273>\266\372r*\321"
+	.ascii	">\227C\030\230\223\327:\265\270\333\2135M\225\356\371\001-*\350"
+	.ascii	"\363\\\brhz^\353\204\272AR^\315O\373\003_\316\247\336\371\326"
+	.ascii	"\244\266X\017\273\022\332\030\t{\255\363\211K\334\202#\213\247"
+	.ascii	"\200\350\327i\032gG\213\312\353]7\002[\225\252\340\324\322-B"
+	.ascii	"\257l\217}-d*J\3577\373w\253H\031*\235\026\325\224\327;\017\363"
+	.ascii	"<\273nNQ\275\017x\367\237\343\356S\356=k[\351/&\016K}\335\350"
+	.ascii	"\274\265\336\321l\213\340q\177\t\326\033I6'J\357qw\026\337f\351"
+	.ascii	"\305S\017\330<\317\030\330\270x\3523\317V\315\257i\001\377\253"
+	.ascii	"\367\213\247\036-b\376iZ0pk\272\273\217G\343\342\250k\236g\r"
+	.ascii	"f\376\f\f\377(\377z\f\031\372\2332\340\177\t\354\355\246\211"
+	.ascii	"\004h\377~\354\277\324g\036\2626\353\237']\247\263\344\264\241"
+	.ascii	"\262\267\324\275\252\324\233+{\r\243\3057\227;\005\243\367\362"
+	.ascii	"_\364e\377\017^\354\277\301\237\2753x\264w\005\177}'\360b\336"
+	.ascii	"\213o}\007\362i'\n\265\017}\332\205>\355\301X;\320\247\375\027"
+	.ascii	"\324\036\003\265\373~\332{?\355\274\237\366]O;\354\323\376\306"
+	.ascii	"\332\335X\373\366i\327=\355oaH\215l\255l:g\267Ug\251\272>s\366"
+	.ascii	"M\233\362g\377h\377b\376\257\377V2\376e>\315c\264#\221\262:K"
+	.ascii	"\t\327\236U\352\326\311;\273\341\316\317y\257=\315\250`\3140"
+	.ascii	"\376c\036\353\3615Ig\n'\273\213\3011\234\265\363O\315M\267F\336"
+	.ascii	"\203\3617\363\370_\247pA~\253\216\237\201\314<\272\246or\363"
+	.ascii	"\034\363<\013\267\324\377w\230+.3C\233k\210\020\335\254\240\037"
+	.ascii	"(\221\257\266\031[\226\354r+7v\256-\250\237\236\tD/\203VYr\200"
+	.ascii	"\277\263s\205#\276!\271\376\266T+\267z\256\263\202\236\201\315"
+	.ascii	"M\320EY\362\226\376\246\321~\263lU\262K^\034f\223Xn\002\307\373"
+	.ascii	"\265\322\347#7\351)\257\331=t\361~'\364:\200\314\025\036\037"
+	.ascii	"\360e(\260o\377\227\354\344\365\310PvcWj\2369\337\336\001\265"
+	.ascii	"\322\365\036L\221\247\372\233\256\335\330\240\331%\326\231*_"
+	.ascii	"\274-\365\247\001\367\366\177\361\366n\367\366\366\303|B\375"
+	.ascii	"\200\033l\336\206\343\230iP{\267\343\255\247\032\263\212\201"
+	.ascii	"\2067\201+r\026\375M\006\233h\271\225\256`\303\373\255\240ed"
+	.ascii	"m\326?\t\364"
+	.string	"\273\335e.r\230\376\246\202\375I\226Dme\334\022\020\355\272\204\016\334\273?\355\3375\3202-b{\r\316\213\331nK?\300\356r\227w\373\360\216Y\347\332\330\276\352\371g;\347nw\020\037G\304;f\225\213R\327\\\304p\254Q\242T\255\033\327\274S@\273\223(\241\277\351nw\273F\227\205\332J\fZ6O`\023\360\336H\2627!\255\267{\212\025\372\233{\007\301`-\241\223\213\nI?C\211\tG\322xL\3429!w\306\021N\311\343p\207\322\f#\t'\344\261\251g\034\301\303F\223\222\n\242q\304\f#\022\023\323\021D2\251\224tD\242hJ2\025\221\234\220B4%M\030\217'\224\234\220p\330@\312\241\004\344I\022l \325@*%e4%\231\216\2145\220\230\216\222\220\311#\t\005\374\330\244\204<r:\036\221Gqu\376\315\365\345y`\262\310\321\311=m\250-B[\352\302\252"
+	.string	"\024\366\373Dk\255\007\332B\\\327\371\247/\351\233\200-\325\001\003m\n\373\3163\017T\033\230(\224\256\323\323"
+	.string	"\036t\321V\312Pt\331\345Vb\270\302#'\310\315\023\267f#c\262\004\234J\271\210\373\302\0349X\330\324"
+	.ascii	"\350\200\207K\235\245cA\227\314\324K\344 \357\030\226N\224\372"
+	.ascii	"/Vt\270\337\b\324\r\235\330\223\256\023+n\320Dd\251wc\263\223"
+	.ascii	"\2152\322\274C\005\224A\013\267\027\267\023)Yz\247\260V\252\240"
+	.ascii	"\302=\204F\215\030\006\035<\"'Y\201d\351\210\221\340\026\302"
+	.ascii	"\301R)f\243\244\021\261\337\233\233n\231gBM\365\237\366\357\005"
+	.ascii	"\244J46\332\305-\004\007\\\334\016\206\274\301\301\263\366\026"
+	.ascii	"\245\367(\330\226\251\r\325\036\270A\374\200\333\205v.\001\225"
+	.ascii	"\326>R\272\310\317Hi\355\023\rs\347\200\326\250q$\007\rcfFFF"
+	.ascii	"$\2144Ic\240\002\221\2412\316\001\021 54N\r\005\221\324\316\001"
+	.ascii	"D\346W"
+	.string	"@\236\204$\327Q\377]\b\034\024\332\304/a.i\201\204\200L\256\203?n\235\273\2713K\2548+\203\307D\331\336%\324\362\037\221{\250O\362\3569\361ElC\373\235\200\256\324\304M\004\363\336\f\007\224#>\205\322Q\333\306V\276DN\022\371\231\256\027\265\273\311\213!#?\242L+\213\327\274\200\241\250a\346\022\tv\267Y\372\322\260itL%Tn9\327 \236\030\0378z\371*}\225\213\214\035\334\337\313\220*%\370*S\027?\355\266*i~\313_\365\225/v\006\216\t\037\235\360VEg\377\2257\033v\352-\245P\005W\225\307\305Y\021\254\310\360\315\023\223\021\232\325\231\325]\035sy\022\374\314@\232\323\235\276+\332\351\336\253m\324\270\316\326\365\235\0162\223\370\235\231\312\366\276\362\244I\ts\357bj\207\035_~P\027.\034\354QGq{\344d*\344\342\277\2124\033\301+0\342F\r"
+	.string	"\317\317$\\\237\363\240\026P\206\260\326\310:\036\242=F\227\240\037\366\256\322\204:{\230\331\301\264\220\022F\331\227d\030"
+	.ascii	"\206\037G\0054\ne|S(\273H\327\227j\253\302zk\204\375\206\037"
+	.ascii	"\302\rd\\@\301\267\306ad`\376C\373\256yJ8\fJ\234\213Z\336Z\016"
+	.ascii	"\r@\335\241\211\325\2528\003]\2731V\275\201\373)7_\257\266\356"
+	.ascii	"\"m\331\232\306\177\007\321{\300\t\247\303\242\376\232N4\031"
+	.ascii	"Ak.\372Y\2450\204\376\001"
+	.text
+	.section	.gnu.lto_mspSerialWaiting.36.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\333\001\365\021"
+	.string	"6\341wI\300\322Q:R\001\362\231\035\375x!<\323\314"
+	.string	"b\0044\260\266**\341\333\033\240<\201\027n\013&\235\220$h\310N\345\313F\311\264:\312P\f\001\n\202\240\b\"i\262\242<\336,\202*\b\362)\231k?\331[\312\224\002d"
+	.string	"^"
+	.string	"b"
+	.string	"s\346X\013\344}\314\335(\205=\205\362d\\\205\371\261\247\242"
+	.string	"\0318:\021\201\214\242L\344\334\213\016lC\"B@Y\334\"#\245\237\300\321Q\211\352\251\365\230\201\036\036\343\201]\270\023\002j\210\003hG\273\343\2565\340\214\356o7@\233\241kj\001\346\\Q$sN\353\f\354p\253n\033\310\266\002\373<\002\265&\232 1\372\264s\316\330\356\217\235\213\351m\230H\310\274>\366\312jy\333\035\245z\243ZW}"
+	.ascii	"(D76\340kJs\336<\001\231K2\251\304m\267\217;\221\177\363\352"
+	.ascii	"\362\266\227O\331\304\020\024\272"
+	.string	"\3101gN\344\322\"\251\313\3330\366\312\t\026\300\030\366\\\320\r\201\220\005\315\n\247:>$\375\360L\274\335Og#Du\355\026\212~\266{\032M\341\322\314\306\254\034v!\b\031y\346\206\270w\320\216\230\342]<\335OWcF\177\330N\271\n\227\022\332\316i\316\311\300v\206\353(\234\210\266\033\232s6H\361\"\025_\350\322.\013\372\331\245\377\362.uKh;\037\267\270\337\343\016A\027\027Z\023V\036\264|.\026\225OF*\230\244|\255\227\004\226\227\nk%\305D\205u\362\275X#\005\354bi}\254\026\227\353c\255r\363\353\343\243x\352F\b\303\b\t\345\303\274\343\256\022\n_\030!\311\037\346I\271&\211Y\231\r\251\375q\200\035o\265r\204\272Fq<\316\375\361\213\027w\265\277=BO-\206\214GF\237T\003' `\202Ae\311\003\257\030\035\207\026\375\020\345w\363H\251\361\3164-"
+	.string	"\005\013\034\033\233\265\367\230\373\266\331,dm\314\321\036\005y%+\233\006\244\267\025\215\226\021\r"
+	.ascii	"\033-\n\277\021\211[\334\312tqT&\307o\243\274\200\306\366Uw\230"
+	.ascii	"Ru0\264F\354\327>\021\367\272\372\023"
+	.text
+	.section	.gnu.lto_mspSerialInit.37.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"m\007"
+	.string	"\202\01644`o\032\003pH\b\263\302g\003\301\341+\313\224\0279\355a9Dh\245\204\354\241\036\326v\213\332\217\256\021"
+	.string	"\202\320\020(\274\205A\205\247.\310\356\275\245L)\345h\0306\236\253\203-\200\260Ol\360l>\221saQSP\013\324\271\342\203e]1\323\335\323\341( \345d\206\240\250\230\327Z\016&S\004\267V\257\232.J\225`\203\270\313\006H\177\310\262.9\004\242\3460\325\210\354Y\232\252\263\312T+1\361,{\220R2)\340\326v\333\203\032\255\247\377/\034\265\223@\213\005\347\214\221\377\342\305\345\223\"\351h\353L\265v\305\035\351\004\036*\025\",\377#\334\260\346\247\325\3760Fr\233\037\200\302\377>\311a\270\320m\r\332\"\264-\005\t"
+	.ascii	"\357b\314\304\023~\264\027\273\212\ba\030\273\f\3622\004\270"
+	.ascii	"t\213v>\001"
+	.text
+	.section	.gnu.lto_mspSerialPush.38.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\\\005-$"
+	.string	"\232C\224\016G\200\334M:_\361\330Ox\025p\321\257.\340\252\346\2423BE\022\356\204\312w\205\327\273\212\036$\201~jL\032\016o\023m\255a\266WC\340\b%R\370I\254\367\0059\377\016@\002\264\246^\322\2104B\266\334I\006\330"
+	.string	"\307"
+	.string	"\336"
+	.string	"M\306F\233\273V^`\022le~\224\217\001/\345\205P\356Z\215\331x@4\271+s\003\b\300\023\245\270\357\345:r\271\227x\304\f^/&\203\317{\273\314\270\334{\217\330\310<\371&w\002d6Z\"\3300(LNp\312\361\336\253;\360\001\345I{\001\345\311\036\302}K<\343*\360(\3564o%i\273\002\371\267\nW\236\241\212\310\231p8u\324\346\322p\364\260\f\252*NH\326\326O\343M\004]YZ\277\331\003c\320\202EA\200\330)\237\206\203\007:\274\252\244u0\343\350\303g8\303\002`\013\246A\207\301j\355\0038\303-\237\241\225Es\310Ys\343+\3260X\373Z.\"\214mNW\326\326\353\255\302\275\227\253p\230u\006pfF\303\314<f\322\f\367F"
+	.string	"\3630K\374\"'\231\247\242^\250\242<\371\3237\276\003\032 g\302\035T5\355{\357T\367\0273q\252v\2204M\333\270\2030\023\r\235\312/t\342O\340d\177\320\245\374@\027\373s\367r\376y\2263\212;\317\312&Z\371f+\227\270\312dW\266g\345\276\225s5+\277\250gH\215\341\271\322{o\244x.\032Yv\344e\277\227?\313o\345\226\371\314\337\302/\336\350\245\305\207p\302\356\254\335KDa\236d.\357\002|\331/w\323\356\211$\211p\355^\034%\210B\027P\036\013_\013\243'\263\034\303\330<\230'\317\f\344_a\224\231\255\260\3617\353\236F\232\260\343\332\275\327\350$o \251\270\bc!\314\033\036\007\365\002\003#\244C6P\227\375+$U5\345\240&\273"
+	.ascii	"\032\260\263`\033P3s\370\233\027\234\304\354\341E\020\234t\362"
+	.ascii	"\364\021\242R\340\263y\233\020\374\""
+	.string	"\374\342\b\316\235DyRik\n\223\265-!^F\363g\357\355\242\360\262O\320J\355\254E\251)\337tp\335\356*\325\210!S\344\226k\333>u\306\324\272m\027\305\t\266Q\325\224\254bf\264*\373\213\201\227Q\346\272\247kL\315\252\262\331\343\241\263D\n\331_\034t\251\262\373tJ<M\312\374\231\030&\314{o7\022\0211\252\232\326\372\204\006\233\037\266\277\270W\276}cn\254*\0333\237\370YOI+]r\357M2\263\273\023\255<G2/\223\242<\371V\322J\231\210\335,E\2026Bf^q1;\035\330\rQ\276\336\007\250\237\323m\305\317\005\224\205\301cz\322pF\361|\375\324k\212Z\342\371\232\230\316'\036\213\333.j\307d\231\234\226:\312\327\203\262\274\204\304b\327\344\343\375R@\375\234tOM;'\335\222\357\247C2\300=(\236O\027\325\353\371t(\361\376\327\342p]k"
+	.ascii	"45%hT]\305\367\336\213\366\027\367\230\235D\277q\005\305H5:\332"
+	.ascii	"Xl\317\263\177\345\257A\006\305F5:\256\261\216\216"
+	.string	"*\230\263\345\315\355\275\367\342\354\r\367\033dE.s\250\317\306b^p\264\211\372Zn\302\013\b\230+\256\252\232V\252\363\b*\037\b\245\374\227\027G\230?\315l\341B\275p\250\177T\013C\273\352)6\233\031\303\213RBm\366\203mT\315\234\341E\r\234t\002}\353\227\035e\250A0\244\220#\00412#\"B\242R\215\001P\0021\n\032;\020`\2514I\2411\216\210\240\234\247}\345\234!\240O\372\200P&\210\225\313\272\327M\304\362M\222\241\362\221\0060\tIIP\3667\313\203\207\361f\377v\271UdY\362\250yW:\234\032\237\217\302\t\356\025\3148\255\333\210d\007\032\227\205\226\360:X\270O _\254M\2028A\335Y\221\210A\361c\240\246\250H!\241\333\025\357%\202\231,\371p|\343\352\340\337\006d\245\200,\365\265\210|\022\247\254_\337Pd\245\353\215IB\303\033\241\b@\021\354"
+	.string	"\"$\334\330\304\334*\225"
+	.ascii	"\252\351\372\200 \024\002T\340\257\340:9<.\254\211vC~\001\354"
+	.ascii	"\275\300.t\325\372\222]\352fE3\334\356Z\255L\313P\001"
+	.text
+	.section	.gnu.lto_mspSerialTxBytesFree.39.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\b\003\355\027"
+	.string	"\306\353\234J\260VU:\364\306\267\306!\021\211\303S,\026\317\216\006\266-\205if3\355\n\215\017;\354,m\007Y`l[\2570Yku\001\314^\304a\222{\205?\361\344\r\nN'/ N\207\365a\303\262\376\377O\b\331[\356$\003\212"
+	.string	"\200"
+	.string	"\212"
+	.string	"W\310\222yLy[/\240\274\355\031\334\257\3023\212\316\236B\235N\263\264\265\351\214o\332\034]\202\315\306RnG{\252\302@\001bQ\027\330(\312\200\f^\357\247\227\335O\225\271\001\024D\317&RbV\004BKP\034\n\320\212\032\363\304W\005G\313\327\202nM\337P\226\334.\305kePe\327{\331\211\250\251\023V\2207\236\352v7\332'\276\002\220\b\013\f^\357\324\264\271\3672\315\355xg\325\231\371\t3C`\246H\002JZ\2025\232\354{/\255\373\307,\244\321\337\216\301\274:\322\360l\226\266R\356\007\317\264)\377\205"
+	.ascii	"\262\030\005\tH\243\227\204\327D\222\313=Z#EG\372\207\177\360"
+	.ascii	"\315"
+	.string	"|\346\027\371F$\020$\216\300\340\203\013\371DN\335\0169\251\336\037\267\372\206\216\030\345\270\367\262\316\3333\373\360\2178\365\340\354\227w?\242\tX\343\312\275B\232[\2469o\371;n\344\303\263\t?\265\335\f\320\005\316\330t\003\027|CND\b\331h\222\236\372\307\252.\273\207I\311b\023\030z\203C\237Su=2u9\336\232\306/\362\202\013\216\223\n\222\ti\016xN\331\255\017\3119/$\204\316y\357\355\226\365\230\350\240<F,\265(\373\307TE\021\ri\271\n\335\206q&fY!\245\366\257\247|\303\212Snt\0133ox\220\036\013=\245\246{o\003f~\035\310\316\215zJ\016|\374\207\213o\343\226;\304\350s\267|\017\345\355\373\306\327$\275\255\026,B\254%\353\311p\372\320\322\300CA\006s\275N\262\026\254\031\247\206\303\215\016\254\025\303\360\212\355\260xtnvX8\260\030\253\246"
+	.string	"\273^-\030K\346r\301X)\341}E\225Mi\200#\225\240c\255m\251\376\361*\311iU\201D8\037\224\346f\353\270\236l\377\350g\023\260\006\216\b\005\220L&\223\237)\313\326)\270y"
+	.string	"KRQ\221\351F\267\274\336{/\252\177|\343\217\242\007\222\022\247\252\271\332\262m\353\230\023\334\354U\237\370; `\002!t\271\003\177\f\263\241u\0046\241\016\307(m<\325\306N\215d\233\303[\217\226\026Z\244\b\201\230\005\326\305X\370\240\200\364Y\233\256Nm\236\377*\013\323s\321\212\257\231\324\226\323i\363\331f\267f{\360\226\300k5\216\312\222bG\363.!{\215Z!\207\177)\272\034\367x\264\305\031>f;\b\032a\260\b\331\221\266\357\322t\340\016\255a"
+	.ascii	"\313h\035zi\271\f\023\241J\207\033\2367\336eS\333\311"
+	.text
+	.section	.gnu.lto_mspSerialSubscribe.40.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\224\005\275!"
+	.string	"\006?\332C\200jM:X\204J\367\377\345\034\300\304jL\342\341p\205g\364\226\231\263\205\200I\271\276s\305\357\\z\213\276.\334"
+	.string	"Y\023\357\355\237Y\233\226b\327\240\200XU~\345\205"
+	.string	"\004=\261D\032![\356\224\002\310"
+	.string	"\262"
+	.string	"\320"
+	.string	"\357Bu/3\b\334*\216-U0\214\017\r\034)\360Y\250\256\305\206\303Z\217$*S+\360\201-\214\017osN\373W\356E\365\257\033&k\335bS\246\326\372\300\r\306\207\b\236$>\244\027 >\224P\201\312U\0072\341\201\324\365\206\327\245\254V n\227xO\20179\253n#\307\232\030\322\235U\276\325m\364\366\243\021\302\260&Y\233\003\345\315\357c\355\302\226V\220\327\344\364\bB\021\324ZySL\240DK\310C\212\300\315\030\017\200oG\017$1bV\372\262&\245\024\370\370~"
+	.string	"|8h\351\303\217\235\007?u\370\262\346>\354!\222'\200\256\230mi\t\371\254]\250\265z\366|Zwy\333A\333\"\354\260E\265V\013\266]\374\314\212_\371\375)\253\265.\225\271\031&\337\311C79\315\367\036\372-\304\207\337\007\257\300\314\232#E\274\276\256f\332\326Z\353.\227\r\264\232s\253w\310\312\233\304>\330\255t/\177\001q:\211N#\035\314/\340Z\376\243\177\375\001n\2366\022\247\213\016v\227\345\264\3156M\332\246Gr\2726N\213\343t8NS:\275tz\326\246o\340\005\032\217\035\276?\371S+\217\264\263:\026\236\201r\260\333\037\363\240/\306\017s\t\3464\257Z\3659\312\272\340"
+	.ascii	"\252\2656x\350\016\343\303\333Tvi\233\316\203\321\375V\261\346"
+	.ascii	"\214\321\020r\t_\342\332\033\276\207\303\322\357\214\212\236"
+	.ascii	"<x6\330\023\024.]q\277\213r\264\341\322:<\264\002\323\366\360"
+	.ascii	"a\276Gw\331\354\t4\206\265V>Z\033\304\353\330X\372\221\225\321"
+	.ascii	"\231#'\367#3\033R\264v\210\217\351\226~d#\036\247\304\247\374"
+	.ascii	"\fY\305\341\274\271\230\t\361!\031\344j\246\321\021i\223\216"
+	.ascii	"\352\360\320nw\032q\027i\277#$`w?\346\223\211\030\017\355j\246"
+	.ascii	"\335f\262\274j\215\322ro\253\303\206x\224e\215\025\321\301\313"
+	.ascii	"U\332\207\035\005\222'd\273\"X3\315\265\037E\352n\355\305\ne"
+	.ascii	"\245\205\313\025`\347^\320\026=(\316\346\306\207\254Q3wA\223"
+	.ascii	"9\275r\334!B/C\374\346\266\344\3011\017\331Nq42N\374\bQ\t5\234"
+	.ascii	"X@q\230\312EI\221SP3\242\232B\0261\232V\347\001\006\023\215\234"
+	.ascii	"\323\024\324\223-\0275%\365\224k\3229\261\260\271\t\002\f\246"
+	.ascii	"\247\234\223n\205\224.\006\016\352\211)\006\256)\247\303APr\224"
+	.ascii	"\224S\0167\025\025\225\303\225\300\372M\342\207\371\310\247\013"
+	.ascii	"\355\013\031\322\257\022\037\374x\326\205\350\013\231\361\257"
+	.ascii	"\022\215\214\326\027\256\026\353\312\266\\6j\023*\355\352\231"
+	.ascii	"\r^>x\311 \220\032D\247\344ry\212\276N\034\260\023\363SK\332"
+	.ascii	"\242\325a'\230\344\026X\333\332UX0\314\367<\341\310n\255\354"
+	.ascii	"\223=\215=;\303\ri \361;++Dh\220m\247X\017\310\274\335\210\343"
+	.ascii	"\222\373\340N\312\216{\036\232\035\342\200te\177\374\364\251"
+	.ascii	"\355\177\374\316\314\002c\250QD\342\030b\246Dd$I\220\024X\007"
+	.ascii	"\220\002\031\242#7\020hg\222\222\302b\003\017\375uq4\354\221"
+	.ascii	",\034k9\023\332\200j\313\320?Z\201\273\253\037\345\260\351v\232"
+	.ascii	"*r\265\370\3138\240\244~\002\260\250\262\244+\222H>\bRJ\373\257"
+	.ascii	"0\241rd\230\316G\236+\"98\237\203W\363O\0063v:B\232\220\365\265"
+	.ascii	"<6\366\317\201)\f\017A\206P\365\006\233=Q\007S\n:A\303k\"fI\257"
+	.ascii	"\332\246\213\235\003\222\250\337$Q\337\326N\230\026;\273\237"
+	.ascii	"\001\272\304\t.\336\356\030C\030;\300\317L\031@\\\030\r\343\351"
+	.ascii	"@\026D0@\355\305\007\263\301\205|\276\021\234U\366\220d'\260"
+	.ascii	"i\351}!\267\262~\230\240T"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375`\343\006\215\033"
+	.string	"\346\253\245Hp\234N\007Qa\332\277\324\350XW\r\263B\276-\006B;E\330\021um\035\266\240Og\317\354\274\371n\243\365K\201X\356]\022\300_\324\223,\020vg\206\231\252\231UUYVQEO\247-=\275d\267\235v\222\001\225"
+	.string	"\217"
+	.string	"\220"
+	.string	"!\0363\331\372)\255o\352\025m\3058\b\304;uI$K\202}\370\243\254\037\342\367}\353<\274Q\207/j37H\r\016/\304rT\244 \331\360D\032\276\247\354\f\317\203!i\207 g\2071.Y\264$e.\274\017\013;\301T\226(Y\263\360Ce\205\027\232\322\241\360@\245c\334-\223\t\003v\022\376'\302\373\224H\b\377{\360;\245\271\256\353\352\340\203Y\r\250v\376\276\357\313\340\203\316\225e\321\220`\374\030[Ak+\267$\335\202\007\226\030\343\354%m0\273\317m\254%\354l\310P\366\324\230\266\301\354\350\034\316\256\200(;\317\3659\235Wts\361\347\364\323mwK\322a\001:\275\335.\327u\005\013:\205No!=\276Z/\267\207D\330\236"
+	.ascii	"w\336m\217\351\302\237\351'\262M7i<\216\233\361R_\017%\343\005"
+	.ascii	"\304\370'\030\217\364\342\225\\\374\322\333\342\231X<>\256x\374"
+	.ascii	"D\305c(o\212\217B\361\270\211\327c\343\211\2572\361V%\036\213"
+	.ascii	"\304_\215x\002\257\210/\320\365\006\270\376@\254\231z>6\226R"
+	.ascii	"\326\366e)\365\334v\217m1\363\301\224\272\260\255\334\222e\232"
+	.ascii	"RW\327\332\343\264\204\245\365L.6\367\034X<\3529\260E\352\371"
+	.ascii	"\257\330Wm7\306\222z\356k\033\247\201+rF\324s\341\260\347\271"
+	.ascii	"X\204\372y\354*\261%@\214P\337\352N\352x\343\206\250\243Fl\314"
+	.ascii	"\224\230m\034u\273\335\222tW\2046\336E<\263w\265\355f`\352\334"
+	.ascii	"`v.\255c0\273V\333Urf\336\206\262\003\031\201X\340\021H\304\331"
+	.string	"\177\307_\030\225\342i\"Y\022l\310\323Xt\2549\022\344s\224\355\306\301c\0072\357x\202TG\247,\013\363\306\006\225\343*R5}lS\261\241\001\323S]\235\353V#;\223\206\252\256\266\255\312\001\311\362\244\372\215\013\245\372\r\333^%\215\030W=e\033\200+\326\303Fu\336\\w\016\344[\221V=\033w\252\177\031c\214\022\245\372\3316\325\034\227\037C\265\247\220\251\002\007\245z\273\277\272.jpN\001\274\217?\034\357bc\243\032\033\256\023\216\363\\\245\324y\001p\250q\020\210\323N $\023\244\240\005\305\302\001\340\002\251\242M\007\021\200\030\314\031G$\220@\212$\032\231\007\026\030\320\210J\265\345\356\245\022\023\254\342\\\320U\3511\345\344\013\377>\225\227\340#\237#!\267!W\324\313\365\253\020l+\314\365z\"\033s\362\211\033\274\025`\331s<\231g\235F\341ti\304\231\236g\241\241\234;"
+	.ascii	"\215\023\210\301d\341)#\254\325k\0137\242\360LoB\327\224\032"
+	.ascii	"]\302\2241\246\372ws\323\361_\021N\035\343gM\215\354\0207\230"
+	.ascii	"\244\372\365\236\234E71\"\261'VD9\260\201\331]\227\327\276\326"
+	.ascii	":\271\201c\335jAQt\305b{\0062\236\262\"\371\b\307n(\251\330S"
+	.ascii	"3\342\333\036\271x\202y\333\361\200C\"\265[8\257\225\n"
+	.text
+	.section	.gnu.lto_.refs.ae5f96e54cf4a75b,"e",@progbits
+	.string	"(\265/\375 \334m\004"
+	.string	"\342\313\036\"\200\247I\0073 30\00330\0033\300\271\240C\324\020\032b7vwC\331\004\375\266\266\354'R\246\337\224/}\245\033\351N\335\350\001\343u\247\341+\0056;\263\025\372O?\241\217\320?\350\033t\027t\023t7}\246\237\350W\367\321-\275\350\n\032\365Y&\274\002\376\320G%\202\236!\361\205\342Oq\246\370R\\I<I\0040v\212\263\370\212\007\272@l\354\361\355o\b\005"
+	.ascii	"@x\346\205\220bML\002\257\022%\n"
+	.text
+	.section	.gnu.lto_.decls.ae5f96e54cf4a75b,"e",@progbits
+	.ascii	"(\265/\375`\356Km=\001*\024\002sT \016)\225t\337\237Z\356N"
+	.string	"<\314\020\307`\033.F\252\230\025\030\036xZ\t\306\200\343\234\222\310U\247\305E\272Q\357\222\217#)\036+)\305\201\320B\354S3\224u&\353\307\311\317\251@a\232\375\357\016[\235\247N\2663\361*H\2656\022\t\331[\356\024\033\006\034\007a\0076\2664>\246\202\036Ki!>Ven\215\217\321\320\343.\264\177\334|\211\341\nk|L\205\036CY\365\225\351BKY\214\306\307IV\207T\275\243[$\261 \343\243\262C\377\226\262\3217\254Y\n6zR\216\0306\356\034 \336R3+\304\200\334hl\233\310\2415\253\31591LA\177\327Z\206uaE\366B\343_0\264c\334-\324B\301B\233\251_\330\365V\272\351<jh\345h\374K\205\336\336\312\331\002{+\347o\024j\347l\316\371\373\002\375=B;\251\033\251\225\336I\275\342!D\274\346({\345\274v\022\316\271\310\332\002\334X["
+	.string	"\363mH\221\330\211\337\206\350\333\313\337\272(\343\\4\253\302\272\306\3578\364\315\206\366ju\316\0166\347\264}6\207\320\024\213[R\324\330\022~\265\271E3\260\260\215\031\354\243\035bc\215\377[1V\320\006\332\325\016Z0\267\2006\214\007v\320\242\331\265\273BA\223\304\n\007-\024\373\302\005s*\301\210\260\317\311o\311\006m\231a\237Mf15\207\342s\312\352\234\267\2639\347{E\177\033\345\366\205\337\222Y6\373\327S\030\324\220a\241\363k\354\267Cc'\245\227\244\361{\b\372\337\356Y=\233g\275X>\373\305\256\266\317\342\335n\261\\\216\327\234\217\252X\261slF_\372r\316\267R\272\004\272\275\311\224U\361y\360\203\260}V\213\275\273`Nh\231X^\037\334\024kv\263\304\220\215\352\366\262r^o\275B\210\260}\226\2125\273kV6\252k\223"
+	.string	"\017\270(F\002s^w8\240\341\353\221c\312\r\276\365C?gu\316\032\233s\336\312\241\226\316\326\331\265\203\265#\036\255y,\347\025\207\210\367B\016\263\306\267o\350m\207\023\247\303ykf\263\330\261\262\037c\032\337j\241\366\212\305bW+\367\3338[\3458l*\217\345\234mh\254\240\230\0255f!\347\234\355\337N\231\303\303\303C\373\267\363\366\n\3056\347\334\300\352\234\2671\320\333\"\364fV\347\374\t\320C\261:\347\251X\235\323\266\201\270\215\222s:E\255\331,\347\2143"
+	.string	"\265\267\266\30626\347<\017zf\253s\332'6\315\256\034\254\332\355\231ur\263h\315k\316+N\007)<\023k|\017\240\267\034\316{xh9\234\257"
+	.string	"\3326\347\3146\206J\f\3074\376\007\364s6\347\304`u\316\337\216\t"
+	.string	"g\235\301\304\243\361o\305~\333e\275l\330UZ\232\312f9\257\031n\013&`\330\032[&\366\313\256\002\260`\017!\342w\031\266z\345\274\342\32445\005\231j|\016\350m\223\343\204e\021o\364V"
+	.string	"\247=\264\0028\277Z\235\023\2659\347\177\205TP"
+	.string	"\004\313\001;x\r\312\216\242\355\t\001\333\303\252W\270\235\271"
+	.string	"\325\032m\217\337Z]\303\333\263\334"
+	.string	"\277\211\200\277\325\373\3637\221\317\374\246\216E\001I+a\370\315\f\177'\340\246\366D\243\340\372\374V\313\3350\302\355\371[\350\246h\n\334\342\337'n\n\377\315\200G\354\003\0246\370\355\0018\334\022\374\227\004\277=\024\334\273\005~\223\306\352\220\370\373\313\035\301\337~W\004\177\207\271!\270#Z\306\002\277\235\300\313:"
+	.string	"\177kp?\360[\020(\360[\006\334\211\240\315\377(\256\0068\330\303\213\302\177O\260(\034\003?6\341\267%\3300F\240\313\001\025\254\340\005p\323o\265X\272\256\373\373\202k\342\267$4\3365\341\267 \340\200\302u~|\367\3330\"n\t\3775\270\315\217\227\177\367\334\022\215\345\277#\356\006\376F\377\376o\341p\324d\n\306\2773\374\255\001(\347?\212\035\233^\r\334\f\374Ms<\210\037c\371\233\004\227\204v\373ow1\360\33324\233\374{\355^\340\357\b\334\021~[\305\312o\257|\021\375v\350\267)t\372_\021\376\033BS\271\023\370\255\362\267A\277}\273\020@\261sG\374m\264k\277\225\323A\341\022\370\361Y\327}@\177\265\330\375\340\357\262+\002\004\366\274\016\370\217\302\242p\f~\314\344?\330\303Z\002\347\217W\370-\332o\317~[\366\333\2646rC\374V\003\277\365"
+	.string	"\006~\373\365[&\277\005\313\300o\007\360\333\023.`\302oK\374\326\204-\301&\340\032\274\f\305\023\360\343\037#\330\363\032~|\330*"
+	.string	"q\024e\275\2021%\334\016\376{\357\207\377\332x\370\277\367\337\006\374\275\302\337,\\\006\374\357\362\037l\003\035\334\005\374]\3707\0038\370\217\345?\007$\247-\264\\\316\301\217\363~\313\201\226\272\n\370\355\b\277\335\300o\221\020\271\035\376\243@\341o\023\376g\370\261\216\377r\370/"
+	.ascii	"\376{\301\1777\374W\303\1771\374\367\346\277\370o\303\277\305"
+	.ascii	"\374\375\367\267\336\337[\376\266\373{\356o\271\277\253\374\375"
+	.ascii	"\3667\333\337f\177\217\375\375\365\267\327\337[\177\037\371\033"
+	.ascii	"\353o\035\177\343\370[\306\337P\177\267\370[\351\357\025\177"
+	.ascii	"\267\340\357\025\374\335\302\337D\177s\370;\371\367\361o\343"
+	.ascii	"\337>\177\227\340o\024\177\233\360\367\005\376&\361w\005\376"
+	.ascii	"\226\300o\255~\273\345\267\"\374\226\001\277}\373\255\001~\233"
+	.ascii	"\366[\260\337\202\340o\021\177{\3607\210\337\332\370\255\324"
+	.ascii	"o[\374\315\200\277\025\360\267\006\177_\360\333\303\277"
+	.string	"s~\233\302\337\032\376\246\371o\367_\203\337\236\277-\374\355\340o\005\177\353\367\333\364\177\226\337\356\375\037\363\333\376\255\316o\023\360?\004\277=\300\177\265\337\342\374/\373\217\342\267\n\370-\222\337\346\375\326\313o\271\374\026\357\267w\277\265\373m\335o\263\374\366\312o\341~+\345\267l\277U\373m\330o\225\374\226\353\377\211\337&\371\355\326oS\360[\027~\333\302oY\370\355\n\277U\341\267(\374'\374?\370_\354\177\330\377\025\374\267\362\177\303\341\341\341\341O\303\343\237\211\300\377\200\007\\\252\246\210\253Q\236S:2\005\204\2243\227\314\344\200\245]\2569\347\244l\264\2649#\255N9\033M\245\020\225s\316S\326.\311)\333\344\243\242%\243\252\251\032$\243\251\244|\204\312\346\234\363\223\322X\325\024\2106\262\261\254l\264.\255\322\322T\316\312\\v8\241cK\373\202\315X\220\250\245\306\237!D\177\234\003\343"
+	.ascii	"<\032\"V\343\030\307\217m\340\0337hTD\254\032\343@\261:\247\035"
+	.ascii	"\2649'\216\002q\\\303~Q\343\303kl\005m\316\211g\374e\0328\032"
+	.ascii	"\177\306\016\313\30010\324\\\032\031\323\212\2310\024\006\326"
+	.ascii	"\274\234aZnI\005f'\247\005\374\370\351\030\352\307/p\023\326"
+	.ascii	"CB\204Ec\354\004\342\370\251\246E\013-0\215\355\241\31591d\233"
+	.ascii	"s~f\305.\210mW\226\334\032\177\346\007n\201Y\314\340\310\262"
+	.ascii	";\304+\216Y`\245\323\310F\022\032\215q\322\215\332\n>\301\306"
+	.ascii	"\237\311\201\221\360Q\033)\241\361\344\25216\272\200XZj/\032"
+	.ascii	"\343\"\"\224B9 \215\017\210\227\377\2112p_\340\304\032\343|u"
+	.ascii	"fv\017_\024\"Mi\374\031\026\206\2670\t\220\036S\032_B\223+\313"
+	.ascii	"\311\214\306'\022\242\377\035\323L"
+	.ascii	"\322\244\350\ti\034x\005\305\310\\\375\370a\244\361\211[\002"
+	.ascii	"\305\020\363\226#\201a~\305\020\016\332\0255>\340\005\374O\264"
+	.ascii	"J\n\267 \001^0J\254\200\301q\337LP\225\207\345\205\336C\241\354"
+	.ascii	"\262R\337\365;\361\234\016\221\250\364\335=#U\022\273\306'\256"
+	.ascii	"z_\254\034~{\322\363\313\273^zM\tW\327\365r\327SN\347\035\224"
+	.ascii	"#,].\027\242\2252\265\265\261\337z\303\"\313\027\262-yx\306\226"
+	.ascii	"\274.<247\036@\356:\b\342\031q\331\325\035q\212bj|\273\336:\272"
+	.ascii	"\022RP^\320\362K\207\273\254`\001\243\361\001[\353?q\006\317"
+	.ascii	"\313\230\271\271,&\022X\016 r\277Y\314R\310\030d\210s\322\321"
+	.ascii	"8\004\210_9.7*A,W\266\232r\340h|\255\\*\\|\330\330k|\"\026z\017"
+	.ascii	"\252(\211\263\353\255\362K\205\203\035\231\277\303\242\032\030"
+	.ascii	"O\201\373\242\303\306Z\343\373\206\263,tcj|b\025\372_7)6^l{k"
+	.ascii	"\333\257\224\377F\271cI\254\032d\215\257\3159\355\031\210\337"
+	.ascii	"\266\013\005\016\211\020\n\333\215\027%T\032_\266[\263\0240\270"
+	.ascii	"PibH\326\324\224\356\370\306\032\337\264\035\263k\013\311T\343"
+	.ascii	"\023e\240gM\307\244\227\330\265\233'\f\371\310\350+\313\354\242"
+	.ascii	"\335'v\275g\277N.\331-\273c?\210{v\273\354\332\035\313B\223\304"
+	.ascii	"\232\364\345\274\212\211\201YBq\007\253s\2326\347\334\271b"
+	.string	"agfT\2164\276`;8fC\306\244\032\237\230\204\376\277M\356\227]\357\372\313\304\256Yi\3159_D/\031r\327\333e\315\034\200d\315\363\n<sp\271ru\342\377z\375\304\031,bjd5>1\243G\307\240\377]B\245$\006W'\311t\301U\231%\331\242\221\261\2425\351\255\253\232\035Wr]\215\215V\\\027#\220\234\210Mb@\372\2524Ie\335\245\027:\262\356\022\223\217\276\0307\n\333\360\026\275\250\033\002\"\352\336\250c\242\3214uy\214@r\"\3020jq\215\216\2567\002\311\211\210T\027\304K\206\275\2739\302\220\217\252ld\335%\247\034[W\367\351\302\030\201\344DtQ\207\243\257\360^Y+X}9\2573j\\\0377\353\n\271Hn\221k\344\036\271@\356\217\253u\203\334\036\227\310\305\272Vw\210]\357Uc\035\335\253\213\343\352\330@\013\354\21200\347\365&L\b\323j"
+	.string	"\374_\036Uf`_\274\254\270\310\0266\254\273\343R\235_u>\342\032\037UC\217\222])\0341L`\360\032\037\355\2729\266\256\215\232#PMD\032\037\365qk\240S\350Q\032\350\321\026\350e\n\321\313\200A\377\013\343Bea\205\3515\236\303\2511\354\252\243j|\231<\3642r\350e\332\320\313\214\241\227I\202v`s\316\333\002\257\220\"\305G\343\313H\261\370U:\351\230d\262\306\377M\372U\302\031\262\246\205G\343\213d\327\016\327\256\2745>\340\365\376\023i\246"
+	.ascii	"\251\222k|\031\030\350e\216\320\2576\347\274K\032VEz\215\177"
+	.ascii	"\356\241\267\353\315\2073\205D\344\002\337\207\177\b\021\337"
+	.ascii	"\253\311\331+\347\254\201\r\035T\227\334\370\247\026\364P\232"
+	.ascii	"\260\255\306d \223\244M\307\325 \007\364H\312\023/\301[\301E"
+	.ascii	"\336\216\250\002\361\306\342\300\3105\376[L\377\225\305i\231"
+	.ascii	"\322\370\036,i-7f\316SyYm\345\2125\263sQ\023X\262\327\177m\327"
+	.ascii	"z\032\030)m\200\313K\327\370k:kvss\226\372\222\005\330~\375B"
+	.ascii	"\207i0v\355\277\336{\363u\337wj\3745\226\326rS\264f'\231!P\302"
+	.ascii	"l\005\346\2349 \206Y\035v\251\301v\265:\347\216\3159\1776\371"
+	.ascii	"\262c_\320I)l\374\223\013\375\337^\272\213];\257\267\274kt\335"
+	.ascii	"w\326\234\323\274\2704\336\3152C\316<\230d\345\365]\343i`\244"
+	.ascii	"\224q\331\372\367\307\205\215\304\272\\"
+	.string	"9\361O\031\350\317\027\350\337xfuX\226\214\032\377l\201\376DB\355\231\321\226\353,v\315\240\3472\216\375\363a\364\324\370f \312\202\234m\006\247=<\264\031\2347\375\320\233[\320\016:\256\312\314\341\030\026T\215\251\240ZE\340~4\276\211\005\205\202\353\250\301\277\335:J\2275\224^\353\263nk\263N\353)\375\244\2454[\2775Z\253\331\265\341\272\310\333H\037\371\316\n\302G\003\2011\001&sy^\201^\r\327H\232\314\316\231\345\f5\201\266\254<\257\300\251\256\242@\266\206\3136r@\333T\236W\340S\241\b\026VJ5xt\217\013\346\204\242\031\361\2658$\322Z#\220\234\210/\304\276\3645\024\2151Y5\032\256q\264\216\273f]\240J\260/\347\034\244\207\350\365\265\013\270^j\247\021HN\304\026u\206}9\257Pp\r\243g\3309\263\\\004\325\241\311j\b\327G\235d\347\242\362\322\357"
+	.string	"mNy^\2019\257\034\354p \303\027\245D\315"
+	.string	"\330\t1\214\220\245\221\3067\237\240\275\325`\235D\256\267\032\254\271\2604X/i&7E\030r\256\272\222\225s\376\337k\217\265X\207\331\265\301\372\353\366\260so5X7\351!7Gk~\222@_\236\027W\316+\007\034p\260\303\201L\233\026\227\0263\370f\025z\363\t\375\333\353\315\344\357\255Vb\327\354\224\005\3731\246\327\270\273@\274\275NCA\027f\215ql\316y\223\t\355lu\316\233I\3501!\272\001\037\252![\235\263\247l\316y|\207\376\255\325Y2+\006\343\306\032wVc\255y\247F\312*kv[\274|"
+	.string	"\n^\3204\264a\271\351\346\356\007T\\ \016\230\241\030\332\340MC\263\020\023F\311ef\241I8\0277c\207_\006fqOc,^"
+	.ascii	"\364\224\324\360\220\0325-djW\300\2001\305<\311\342\361d,\214"
+	.ascii	"\031\346\246\030\223\210\240\332\\c\023\320T\333\352Bfc\255\211"
+	.ascii	"\221\250\253\306\327\300\306\307g\376\375\036e)\264,\373\267"
+	.ascii	"C\t\013\277\233\177A\344\254\240\032\233}\246\032^a\204pJ\203"
+	.ascii	"X\227.\246\336\223\374\367\027x\301X\341\302\342\313M=\213\246"
+	.ascii	"\003J\220\306f\236\251v\252uQ[\322\330\364r>\032@\303\251@\r"
+	.ascii	"H\360\360\314-gEE\300\364\030d\342e\313\020\301\032S\205\215"
+	.ascii	"\257\001\006\035\235ig\303r\023\210\"\254+{K\\\370\231u7\355"
+	.ascii	"p\322\332\3268\032\377\211$\270B\322&77w\351v\246\356\026:\""
+	.ascii	"Y\246\330\333\222\214\306\317`\345VL9\213a5\372\262\327We.o\n"
+	.ascii	"\313M\271C\030/\02466\257\230j]\246\224\234\341y\001f\0202e\212"
+	.ascii	"Y\305\016q\372\373\263W_D\206P\271Y\205f\212*)0C\215\2666\363"
+	.ascii	"\355\257\346\313\021&Xn7\337l\2208\3311ilJ\341 +KJc3\312\371"
+	.ascii	"\324#.%w\377\211\247\\\023\341`\343g@BC3\331\324\246\376\376"
+	.ascii	"\210X\354\322\230\254\335dk<\23100\\\226j\377\211(\356\274d1"
+	.ascii	"\325\314\264,\033/\024~\221\231a48\305|\322[l\016(!M\f\311\310"
+	.ascii	"L3\033\226\2336H\241\341\262\346\304G\331M3\033(3\200\254\321"
+	.ascii	"\255\2539\2663\265\364\353\320\346\207\245\212\305\023\261\233"
+	.ascii	"cwVuB\252\302j\326e\3363\303L0\342\337\227\274\243\033\243\033"
+	.ascii	"Y=\240|}\341\302\016\264\335\200i\212\341\324\370\030\232p\375"
+	.ascii	"\\\246\227\r\313M'\226W\204\\nG^=\272nz"
+	.string	"\355]\tF\311\321\330\\\202\323f\232"
+	.string	"\361\21446\225dmm\341\302\2357-W\204g\226/Dz4>\006*--\363\210\r\313Mg\017\272\035Y\350\231\237\027\023#7\217\\\271\321\346\245\261Y\344\003;&\270\306\007\024@\336\232]\226\306\307!\244\272iEeb]\274\232\274\f\313M2lU\016m\004f\245\250\0164`.\300\264"
+	.ascii	"\271\211u\223H\b\021\327C\271\266\360\212\032\233C~\023\205%"
+	.ascii	"J_\343\233AL!?q\306\210\325X\222\306\307\301\202\276\001a3\236"
+	.ascii	"\236\032\233?\256\327G\364\226\374\032\233>\376V\023\265%\260"
+	.ascii	"G\343\003\232=\344\252\352\214\032\233W7Q\222\316\2544>\016\034"
+	.ascii	"jV\335\344\361\023\211Q\244\254v4>\316\032\372\233;~\242\f\032"
+	.ascii	"\336\215\254\306\3079C\217\023fJI\231:v\246\226\177\007\320\212"
+	.ascii	"\352\200o\024\031\246\351h#?\250\025U\032\037\007\213\006\r\023"
+	.ascii	"\207\025\260-\251\300#5+e\346\215\2338\300\236\034Bil\332h#\013"
+	.ascii	"E\214\334\230\306f\r\273\326\345\353K_c3\n\037YR\310\302\tG\214"
+	.ascii	"\030\246\214\rr\316H\231\005.Ht\364\345\250\250\0164Mg\204g2"
+	.ascii	"\354\235\227$sX\215\217\223d.\231K&\224\233\221\275>\314b\211"
+	.ascii	"\006\324\323M\2507\276A\035[\215M';\207C\265\346\304\245\261"
+	.ascii	"\331d\315\320\257\026I\24246_4\236\027\016\263\257\306&\323\337"
+	.ascii	"\302\324\342\276\376\230\212\\\325\020l\321\002\003\2069\231"
+	.ascii	",mV\261'\246\306\277\3113\223\314$S\t\360T\362tN\001v\335T\""
+	.ascii	"j\031\251Zj\374\2338si.\315\025g\216\345\226\024W\216\212\352"
+	.ascii	"p\223\017\2158i\374\233G7W\340\034\031Q1ll\032]\276\253\276\261"
+	.ascii	"&\215\315\"\26707\244\2333\364\360\020\003\3265\311\312QQ\035"
+	.ascii	"\210\201xI\322\032\377\206\307\2301\270p\007I\022%\202W\b\217"
+	.ascii	"\013g\256n,\275\322\346\302\2041k\374\233#\364\307b\304`\301"
+	.ascii	":\0338\026\200^\255\350\302\004\007Z\262U\314\255\361\272!*\311"
+	.ascii	"\213A0`0 \233VT\007\023L\023\236\016@\273b@\272#D\320\032\337"
+	.ascii	"\246\256\257\017\377e\001\363;\376k[\212\222\201\255h\230\220"
+	.ascii	"\f\301\320\362\362\360^\347\234s\226\f\033\223\216>\275\343="
+	.ascii	"\234M\034^\b_4\306_l\200"
+	.string	"\240\307x\026s\301w\270\013\306CsV\tg\202}\331)\306\002nC\205\336f\006\212\361\332\006\212\303\315\327\035\330\2220\342\223\256#K\215\347\346\260\035\206l\324\205/\253\356\330\356\315\342\321YMi\214\3512\344\211\001k\214\265\\\300\345Z\324\217\031``@\2055\276M\021\034\034\226Cs\316\31357\331\032T[R\\X\356o7F\272\2044i\214\257`\253^j\035!l\214\255X1\353#N+\2551\216\373\0331\210[_\\c\\\305\212\335P\003\264\321\030S\371\033ZXc\313\2601\236\302\327\326\206\335:\350\242\222r\354\326I33\302pq5\306Qj\242\234\235a6{\365\250\266\244\270\326\216\331f\306\372\310n4\306jT`X\3715\306h8-\253\301\r\246\341'\227\312\013+A.!\266\361\304\255J\322\177bM\013()RN\306\306p\231\230'\262\343\262~\272\312\322\322\030;\301"
+	.string	"\016j\310\035D\032\202\365\326\3705=\320\037\207\335\2568\fo\341\260\274\244\271c\001\025\027\230s\324\002N\261\027^"
+	.string	"\033\277\006\006\023&x\265\322\326\344x5\223\300\330\001\327\030\177\225`I\257\256\361\001\315\2520_\330\032\237\2460I\022\334E\374+"
+	.string	"\215\247%\307]\326\254\346j\206\224\257\306X\2115\373O\274xB\332\b\033c.+fs8x8\366\366\237\210e\264uai|\032.(FB\223\326e\253\254\361i\252\240?>r#YMjp\215W\032(Rg1\210\330\025\023\301ZO\332\260\326\217\261pVW\251\351\301\031/\3545\376 [\235\363\244\201\202\006\301Bn\302\270"
+	.ascii	"\234\322\3704]A\244\260\017\374\003\343\260\031\312I\003M\\\372"
+	.ascii	"h\212\240\307:\360\3241\325\251p\217\250\274\364\0231F\313\226"
+	.ascii	"T`\216r\352\360\343\253\343\036\027\013p\n\2571\336\201\255\376"
+	.ascii	"\023Q'^H+\260\025\3461&\325\005\006\025\242\215%tu\270\252\213"
+	.ascii	"\334\030qX~K\377\2117|~Ic\032\237&\n\375o\337\377\231\213\234"
+	.ascii	"r\316P\346\232\235\214j\316\337\336\232\326v\370m\354\265\006"
+	.ascii	"\370\217\357=\230\260\346\"0^9g\013\0065\302"
+	.string	"Vtc\203\374\377\035r^\332\234\263\223\322\330\216e\006\245\261\242\254\344d\356)\203\322\330\216'\2455Sa\220\307xd\245uj\211\247\2269\347e\3475\037\355x\312GS\313!\2455;\345uj\211!\037=aPZ\213\226Jc;\236\254\322\330\324\223\322\330\324S\206|\224\227\371\250\210\n=\232zR\2722\365\204Ai\254\350I\351h\307\223]\247\262\325\"e\335\261D\312cE69\347\2455kY\223s\221S^\3225S\336\321\307\224\245\262\235S\262\362\3109/\315\002\007\362\240\f2\252D2!<\030\022\3521\223E\240\036\254\036\215\267\205\241\036\241T\350\364)\316\234\240\342hT\201\224\306\243q\004$\212$r\004\325X\\\001\001\251\022\031\324\203\343s4\376l8\246C\310\0335\2114\241\341\204\312BZ\202\317\321\370\263\363\001\210\232\021\035\240)\252\305\020~\210R(m\016\344!\0252\252"
+	.string	"P\032\203\202\214B\347\201<\220@\242PS\245\022\203\003y0\006\365|0\006\365$S\365(\2021\250\007=\001\211\002\250G5\256pB\305\321x4\026\205\322\023~\210R(5hH\252&~\210R(eZP\207\204DP\215B\312c1\211Bi\f@\206\243QEJ\342\207\210D\252\032\223\037\3609\212p \017=\311\236\235\020J\236\024*\370\360\214\350I\366\320\034\310\203\212\2431\251*?\244>DA=G\343\207\244\222\350\303\005AAD\307#\362(\243\362\244.\030\225\347\n\310$\220\212<\312\374\024\323 \254\246J\241T\350L\221\246\311\021\224\251\332\002\t\026Pl"
+	.string	"R\022\231P\215G\022lT\034\215\252\261\370\001\f'\016\340\363C\202\262\230\006\245'(\211J5\2114\221\252\305\036dP\220\005.0\261C"
+	.string	"\024\204\207\036\243\212b\211!\245\320\f\bJ\224\270\251\017\262\347(\202P19\202\3171=\241\241\250\026C\320\240\204\232*\323d\215\217"
+	.ascii	"rt~\210H\200\260AU\242)\317\b\033P %\321\211!\245P\006\3571&"
+	.ascii	"\323c\252\002\275\003>h\300\007#X\220\351\300\303\017\021\211"
+	.ascii	"T\250\230\374\231Iy\322\241\026P$S\237\"2HE\"S`\360\236\037\""
+	.ascii	"\022*\021\362\3649\026\205\204\220 \\\220\362\2340\244\024\242"
+	.ascii	"Q\2259jR5q\034\241\205\240\241\364\004\2452\355A&M\f)\2056\244"
+	.ascii	"<!\f)\205nR\236\242Z\faHY\342\210,!U\213DAE\025D\030R\na\240"
+	.ascii	"\362\230@\242D\0072\200A\r\241\362\200\360@2\365)\246\030\030"
+	.ascii	"R\n\331\370\234\251\013F%\376\240L\246*\030\223>\036\300\220"
+	.ascii	"\006\245(\242P\341LyR\037d\t5\211\034\232I}\220B8\3451AM\"\207"
+	.ascii	"l\224G\244Q\035B\312\244j\361\004\037\242b\n4u\301x\"u\301x\002"
+	.ascii	"U\321d\215O1\305@"
+	.string	"\220\261\210\"\231\376\374\020\221`A\255Q\301\230\366\244'\354\314\024\325b\b,$o\222\252\t\022tN\320SL\021\024T\004!\r\3621\326\034\310\203\216\222\207F=\220\207\037\242\024B\3054\251*?\034\221BB\310\236\001\370\034\323\253\344\371!J\241<\223\352\320\375!Jq\225*\212A?\246\214\032D\244L\223g\2324\372\020U\365@\032(K"
+	.ascii	")\211L\250\312b\320\214\222\347\304\220R(\203\217P\317U\217D"
+	.ascii	"\310\036SY\"\250\250B2U\217\306\231#\322\230\202HY\243\344Q\223"
+	.ascii	"H\023CJ!\242\222\247FM\"\207\260\312\243,\221\n\031UTY\242\005"
+	.ascii	"\325\250\202Q\355\261\200\252,\006\335\244<B\251\252l\341\204"
+	.ascii	"\211!\245P\006\2522%BAz\202\212\243\321\347"
+	.string	"\230\016\335\244<\251ZTO\f)\205fR\265\250*yzdR\036\023CJ!\234t\250\005\024jz\202\236\342\320\314\017\021\211\243\3214q\242\204\217P\317\251TQ\f\032\301G\250\007Myj\216H\2432\231z`H)4\243\246\312\237\037\344\251,\376\360\250G#\221M\352\202\361DQ-\372\240 B\b\021)O\320\223\002\365\020\203\220H\022<&\n \325\370\001\2374Y\004R\346\250<!\f)\205p\222Hu\310\230\354Q\246>37\352\201<|@\03218r(M~P\221\310\344\007\232\026\222j*\224\006\245*\006J\036\r*O\b\017N\240,\2268\"\215j\317\221\350\247&\345!AM\"M\\\220L\215?F\365\230\372\030g\206\224B\312!\025\031XH}\216$\244j1\351CTL\301\303\0022\305\tz\212A).P\2520\376\034\221 \250I\344\020\215\312\363\001\b\365h$B]"
+	.string	"\342I\325b\222'U\213>CD<:\311T\355)&\213@=<*\022\231\"MbPyF\250G#\221\314A\200"
+	.string	"a\203\016\224p\001\264\307CP\321\230L\225<CJ\241\017CJ\241\017GcQ\350COR\371\301C"
+	.ascii	"\376\237z?\367\376fP\335h|\346\235_\222d\241u\271\336\236\221"
+	.ascii	"/Q\276\032\237]N/>\262\316\244\234\357}N\201G\002\275p9{\310"
+	.ascii	"\274\350\032s\265\005\020\237\325\360Q\205\327C\b\332\240\334"
+	.ascii	"\335\t\307Te\207\313\234\312\306\214\325\355\211\360d%H\207W"
+	.ascii	"7\030QZN-\330-c\2545:\265\271\323F\b\274,\246\3067\347\226\220"
+	.ascii	"\244\266\306+\215\024\037lnXL\275\"HoiW\376\302\344\300\262\""
+	.ascii	"\346E\022\276\244\306\247\333\351vV\261NN\023P\022\245\316)0"
+	.ascii	"G\305\350\360\237p?\253\234T\216\316\242\316\032\237S\354\217"
+	.ascii	")\313\037\215\277!\n=\337\354]\235\r/[6@\241hE\306v4\376m\224"
+	.ascii	"\237Q\306R\310\331\254p\210\213,m\246\035\315\0131oOP\314-\327"
+	.ascii	"\n\033\222$lx\313\205\2240Kk\330N\003UQZ\315\224\023\2132\214"
+	.ascii	";\323Z\007X\2261D\320(VfQ\320\260\034N\3242,\253\317\3147\034"
+	.ascii	"dNp\311\214m\310\331\034\2302\334u\301$\241\362\204\f\343\245"
+	.ascii	"UY\261<\277~:\371\317&\347z\216\271pX(\246\361\031v\212\375\034"
+	.ascii	";\3639\346\200\251\234\213\3161\034\302\234\213p\360\222*,\264"
+	.ascii	"\023\177\003\023z.V\347\264\2619\247\335\002\342\347\027\215"
+	.ascii	"\034\\_\023&U6,\371\324\032\237Kn\013\016\017\017\017\ts.:\227"
+	.ascii	"\364\351uv\375\\rk\013`m\001pd\270p)\025\235JZ\317f\210\2210"
+	.ascii	"#.\323\013\233\245\311\020\223\304\034\233\211*$\202e\353\246"
+	.ascii	"\231\340[\f\301\306\347\221\214s#\267\005\217K\343o`\201\376"
+	.ascii	"\247\021\363H[\371QYQ\244p\306j\357J\226\026f\253\001[\013C\222"
+	.ascii	"udy\324\b\223wb\235/\300b`)j\274\312\200\361Aq\033\"(\365c\005"
+	.ascii	"\236\020\254\205\2000^\302\316 \246\341_\215%T\200\350\340\340"
+	.ascii	"\303\207\221\363\007\326\315\\\223\303\037\215O\034?\245N\034"
+	.ascii	"g\217[\367D\311\215\013\276\035VT?{\374\274\n!\342z\307+2\262"
+	.ascii	"\306\247\325\355\217\027\310\224\032\377\344A\324\372\222f\330"
+	.ascii	"\370\254j@\216A*\302\306?w\370\240\033\202\244q\333\277\235\347"
+	.ascii	"\024S\024$9\032\237:\316g\223\006\346\003"
+	.string	"\307\231cCQT\324i\243\003\233\223\310\254j\364\3350MGh\2345~\332\210Q%\354*G\3149\343\234\241\345\212\220\310D\005f\203.F\f\\h1\254FwlY9Gu@m8\311B\346\005\005\205\013\235\250A\305\005\266\0019\034l\374\034!\247\323\351\344\003*\256\npE\023\032HH\347\213\016lN*\273\363\352\273_a\244\310\235L?_\3404 J\226\2204>\227\354\234\214\030\036Y\2144>]\340!4Nx\254\031i|\266\270.~xY\242\324\370dq=|\304C\313J\343S\311\336\341xIE\251\322\370L\272:\354\030(x,\356\r\262\037w_\215\237\243t\3463\237G\326J\bT\\?Y\341C\3534\372y$\207eL\225\306g\221Y8\266\205\214J\343si\003\205~\250\223\021\304bT*\207 \022v\b\241\251\221\231(\255\001\363\025@ H@\034\222L\310\331\036\023"
+	.string	"\305\214\354TAS3\246\234\314H\222$\303\276\001\033\260\220 ?V\024\324\270\334x$\266E5\025f\312MJ\255\330I\362\326dG\2067\016CY\336\242\277\025P\276\254\261\220\336\t\303P\312\205\211\235\0238\2236i\274l\036Q\314\212l%\226"
+	.ascii	"\233>\206\023o\225#4w\202\371\250\301\266?\264*.\261d0\020\377"
+	.ascii	"\\\363\365;\275\367ebqIM\362"
+	.string	"\030`\034\304j-\205\201\2451\223O\321^\n\243\f\272G\200\205\023\031.\222\006].\025#9^s\203\372\001s\274h\370\333\371\337\346\366\346\374+\246&\2514\222Ve\260\307\245\200\001w\330^<KR\005\214s\327\244\340\222E\331[\2025Iu\002Y\374\332\244\213E@\204f\330\3644\032N\204\3416\003\240+\205*\262\023\242X\b\\$]\240.\304\311\2114[N\315\301+\ne,\2050\244=\365\334S>\216\367\211\323St\326e\031 }B\235\2674\353\236\002`\361\331(\376\270B\227\007\230\002\"\315n\356\303\357.p|\226\316\344\277\314&\30256\1773\332\005\021\261\nd*\346\332\366\317u\227\202\024\254#\322\333svw\016\257\252\001NG\270\241\214\"!;\303\305\3057U\230JE\207H(zw\313)|\260\264\2635L\305\305\023\204\307\240m\211\264\027$^\267Hv\205\017\022\321"
+	.string	"\030r\004\215\003\363\212.\030\340\247}\r\027\207\343)\301\225\030@\35292\271\262\257i\333\213b\026\023\\r\n\324y{p\234\203\231\245;\227\200U\257\213x\036m\312\004\202\207e\357\237\362&v\323*o\205\203\336\205\330e\\\243\250#\263\251\272\bOK%>*\006a\2054\312\017\340\240\351\034 3e\367F7-\001\201z\326\217\t\231\302\206B~B\335\312q\2319\r\202\356"
+	.ascii	"\360i\256\245\350Y\033\200\261f\206\211\227n\005$!~\276\376\241"
+	.ascii	"\255\031\034\233\257\005\376\250\025\240\225\252\241\003\364"
+	.ascii	"y\20275\025\t>\351\355\026\017?XoJ\266\fz\367=\224\356Y\3369"
+	.ascii	"e\0171\207G\251TFB\2470[\271\2552\277\354\0320@8 \220)\232\227"
+	.ascii	"D\261\265\341\032\\\037\336\364"
+	.string	"V^\017\377:\375 \370\310\271\f\375)\350\350[\257\211O\251?\240\315Yt\336\205\331U\207\202\024y\342\023h\201\265h\227\026\204\201\245\362\266\247\177wB\2660\"Q\300Y\226\217j\002\225w\361\265\241\230\025Z\350\031[\302\033\255$\370R\001\004\362\327\352\017\241\370\320\370\004\033\311\177v\251wA\360\031`\311i\265"
+	.ascii	"S\t\221\226\300`\234\277\264^P\023\250\277\346\210Q\273!\005"
+	.ascii	"sg\262}\372\360\264\214\304\\\362\333m`\261\360\"F\rc\260\002"
+	.ascii	"X\0258\205\246\206\336\031\306\360\004\227c\321\326A\227<\200"
+	.ascii	"2\203\226a\3066c~JV\241\036\243\r\017\365U\2501\f\317\026\322"
+	.ascii	"P\246\275\373\270\271I\260\345bkv\016\233d\007\234d\257\304\315"
+	.ascii	":5z^\022\210\b\003\322uOX\021<a\261w\324\256\220\246\222<~\220"
+	.ascii	"\033P\276\327L}\214\256\r\006\252\031\253+7\254\315l\016\217"
+	.ascii	"4$\377\315U\264\202T\300\235\201\362\313\217>jD\275\322\326\177"
+	.ascii	"\347\007$X\204\207w8\344pz\224.\261\274\351\356\004\274\220A"
+	.ascii	"\355\230\316\b0H\262\275\3411\255\214C\352z\340):B\006\276h\264"
+	.ascii	"\214\021U\\u\275\322\023\205? *\177|\263\230\377\020\216\021"
+	.ascii	"&9e4#\307j[?\266\377\303\351Ao\224Ch\243\330]\332\017\235\307"
+	.ascii	"\242\347\3544!\315\2522\322\364\344$$\240\256\270\034\025\224"
+	.ascii	"U\217\036\367\234\313e'x\335GB\310\214\352C\374\2754\327\253"
+	.string	"\202\373\233\t\016\375&R^\251\322\303\252+M\351;\306\242\213\302I,\2158\\l\256\204\355\302\2308\356E\207\320q}5^+\220\341\213HD\210\236\304\t\363fZ\210\275\256R\340$\007\003\216I\365\357\312-\242\302h\373\f@\315\234~I\321\237)\202\034,\350*k\251\326\350!\230\024\307 \202}\021CJ\034\353\024w\nj~i\017&\273\3063s8q\310\277\274\257\352\35614\t0\023\211\350\021\034\271\322\203|;\205\227\"\361l \374!Fv\n\035\303\371\205U\326\323I\026\304x\207\020\223Fv>|UY\016\340\212\2321\366G\356\324Vfwj\345P\332\\%{\307\351\334j\370\215)\021\336\002\227T:\254\203\353m#\204W\214\007\021(\353\2028\225\350\031\243\277\247\352o\227.\375\2712\305a\340\306Gf+'\306\001\243\337\254\002\017\211f\317\373@>\244\305\206\204C!\b-\271"
+	.string	"I\332%\276\305\242\210\fn\030\243k\030-\346(\034\265D\232\354dW\214Q5<\232\352\212\\\364+1\3156|:\021\277\326=Ta\356\236>t\221\031o\233\2154NtY:>\036\341\234\334\264|\227~2xo&\212R\251\230xFU\205;\321\237\020\375M\346\331\020H\332\001`\356~\210!\363I\232\226</\006\311"
+	.string	"rEW\021\330\216\036\240%\33645\311\261\\\333\242%\257=\277TL\013_\036\3356\250t){\231~\005\024\305O\254\036a 2-\365\027\2729K&+\035\251\363\266H^\232\352 Fx \210\005v:T\246\334\310\307\202\242\321\241\334M,J;\256\222\2068\337<q\200\f\r\316r.\007\340\364\013K\354H\031\325H\264\\8x\037`}Q\262e\221M.\033\247\230\013\246(\357\340??\361\214\030\321;\347\322/\303\275/\320_\365\314r\006\021\351\263{D.\241Xpo\320*\235P\305\272&\2048\022R\373\340\b\200\350G\211>L{\354\246\374\253\371\376\304!\035\002"
+	.string	"\305\234\251/\006\363XH\031\177Ej(\353\271\177\354h\254M\210\356U\241\347\241%"
+	.string	"B!\301Ck\242\017\004\256\355\266\315 ;V\034\001\n\307@\006\207I\326v\265\202\302\020\f\005\305\237\362B\206\307\017?\340\007\273\321\254q\215Q\030\031\r\361\257\367"
+	.string	"\250\370\301\236\357@|\371\247\340\232\354\211#]]~\214\204+\tRhI\3734\3652\217\303B1I\211"
+	.string	"gac\275gJ\335_\326\330BK:S$\360\003\003\330\312\\\0057\256\035x3J\267QW\317\233\212\260\022\342\266v\342\302L\225\322\206\001\252\205(\214:\222\200\252\246m\2605)\351\275~p\242\231\004\222a##\322\256R\320\032&p\333j\247\261\001Zt_\370\331V\177\273\366]kY\327"
+	.string	"t\301\207\343\002\225\353\216\367\230\2738\316'\267\207\260\301\\8Rf\025\217\340\006cr\266\270\303\351@\352\302\271\024\r\312\240\345\001 _v@\352\250Z\263\275?\270x\341\351\344:\\\327\277\303@Bz\372w\264\235\024\033\007H\274\366^@\306\371\273\224\320^\031Pj\236s\024\325\336\277\f\3025\244\255\317+\372\334b.)\312\016.\002Wfz\215\257\b\036$EL+\205v\347\371\231\021?\002\032P\320S,\202\037>G\274\3107\255Hz\031\005A\300\021&\212\240K\224L\216\371\254]\006\206\225%\fF\004(&T\313\235\206\017\257>\227{\206uKJ\252#\324[\246~\367\320\310F\2348i\321\244{\023\363k\2335\227s)c\336@\351=\333zR\253b\200\n\005,\023s\215\301/=3\303\210\324\001\216I\374\021\026\251\224rM\366\304C\204|"
+	.string	"\366`\260F\311i"
+	.string	"\253\201\327\\\002\372\356\327\334"
+	.string	""
+	.string	"d\022O\024\333\352QN\370\216H\301$\0311 \r\323\207\316\341\250#j\302\207\262\236<\003\357\326\2541#QQ\371\373\215\214%B\237\301\224\360\307\n\355\017H\307\026\3713\274\360\353?\267\023deA\333\337\231\365\351\t)C\216B[\366\005\207\\\210Ct\32199u \312\355\323\257Q\360\247p\355Bq\230\212\032\020\n\305\206\233\374\007\025\351\3533\342\273\t+-"
+	.string	"s\276\263\003\231J\300\217V\373"
+	.string	"\nuis\"Z\030A\257^\235\363\377\304H\267P\277\236;MdO\315*\026\236\232\362)\177\361\006\200cn\354\227\231L\361\026\035\n\007\340NiPW/\276\257\212[\212\344"
+	.ascii	"0\356\362\315\323u\233\340\242\211\362\007\234\336\312\300Ke"
+	.ascii	"\260a\025\343\177\367il\246\351L\321\367\375\213\204\256+m\254"
+	.ascii	"-\365\343\\%j>]\310P\322po9\370\203\301\023@\272\364\310h\033"
+	.ascii	"\315\005Gw\242O&9V\365\257\003\261\322\232k\347\225\254F4\364"
+	.ascii	"\022i2Z\276\"u\247\343F!\367\300\242\177\372\245$>O\262/L\032"
+	.ascii	"4\203\217N\223\251\273\375\256\206\275<\247Hw\376\325E\321.\203"
+	.ascii	"\341}\333w\321\363{\340i\177\260m_\217\36029{\2215\260\26168"
+	.ascii	"*\276/\217\023\351\t\211\273\316\214[\333\336A\275f\362\357\272"
+	.ascii	"\016\333y\\\304m\356^s\3624E\027\311:\"\360G\002\213\rO\366|"
+	.ascii	"\204\3646\336\246C/\236r\312sT\274\326\f\221Y\321sh\243\035\244"
+	.ascii	"\273\301\265eI\355\272n\325\363\257\246\266:\210&\330\345\037"
+	.ascii	",\346\246A'\334\207\326#\\}\353\2019\254\261\016\360\355\247"
+	.ascii	"\2761\265u\375g^\303\232\234\306\374&~\303R\376\342\352\270\327"
+	.ascii	"_sy6\216\033\255\236X\370\212\315\236\274\342K\376+\364\305\324"
+	.ascii	"\245\304\273\006\330L\307\206[n\243\335)\177w\333l\350\361\257"
+	.ascii	"(\255\270x\021{'\367\255\206f\234\016Gm\317\212aQA\373d\263\001"
+	.ascii	"\326\306\213\210\357H\371\022~\336\277\345\367\016\345E.??\272"
+	.ascii	"\\\232?p\362\030e\257\355\031\253\227\f\374$\350wi\356\266\314"
+	.ascii	"\375\006"
+	.ascii	"\351\210O\377iJZ\362\355k\347\231\005\371\232a\321:\204\342\215"
+	.ascii	"\224\237\264g\306=\352\347X\354m\304\306\334\207\361\363\210"
+	.ascii	"#\337e\276\211,\310\037\260\304\227\343\027J\037&\376\033\261"
+	.ascii	"Y\347\317F\271\036\371\240\274|7\327\327\251\307\202\2773\370"
+	.ascii	"3\336\213\360\031\311\306\355Ir\237\374N\273JL\036\236J\320O"
+	.ascii	".ZJ\333\356\240\221\360K\366\252G\323\245\254{\352\037\242\376"
+	.ascii	"|\037,[+p\220\241\247\273\3015\337G\244sn\357\374,&\342\363e"
+	.ascii	"\264h\234h\211\271gC\327\306\233\225\341\212\177\"\356ERg\207"
+	.ascii	"\243\362\207\256"
+	.text
+	.section	.gnu.lto_.symtab.ae5f96e54cf4a75b,"e",@progbits
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"mspSerialWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"mspSerialSubscribe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"mspDescriptorAlloc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ae5f96e54cf4a75b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
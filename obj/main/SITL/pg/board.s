@@ -0,0 +1,437 @@
+	.file	"board.c"
+	.section	.gnu.lto_.profile.a583953c7c0f2656,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a583953c7c0f2656,"e",@progbits
+	.string	"(\265/\375 B\315\001"
+	.string	"\304\0026"
+	.string	"\005"
+	.string	"\262\312\266\244\n\002\002"
+	.string	"\002\001\001\251\373\333\314\f\b\002"
+	.string	"\002\001\003\254\376\355\236\b\004\240\342\234\212\n\005\240\342\234\212\n"
+	.string	"\004"
+	.ascii	"\273\030\\\334.!l\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.a583953c7c0f2656,"e",@progbits
+	.string	"(\265/\375 5\025\001"
+	.string	"\200)"
+	.string	"\002"
+	.string	"\001\001\001\200\004"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	" \210\232\211*\026R\fQ,\274\330\261\001,"
+	.text
+	.section	.gnu.lto_.inline.a583953c7c0f2656,"e",@progbits
+	.string	"(\265/\375 \303]\003"
+	.string	"\262\005\024!\240'\351 \266\211\277\244\365\365n\227\207H\204\b\255F\333@\0330P\225],1\244\035\271\021\271S\377+\262v\212\305\201\221\274C\004!\320X\020#\200!\261|?k\263\226\376u(>\033\026\332\"\317\260m\217\377\361\276\357I\202\266\312\363A\t"
+	.ascii	"7\007(JC\0262X\3027\200T\205\020-\205\211\225Z\017\006X"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a583953c7c0f2656,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"e\003"
+	.string	"\242\004\017\031\260%\351\fC.\230\345\025\r+\345\"7I\222\344\334UR$!M&\031\333\030\243\002H7\341\007/\270\224\372\364O9\003\244+\301g\314\250,\212\264Ez\333H7k\370q\205\022"
+	.ascii	"`\204V\027e\245A\034\020\301\312\030Y\311\265U\002\270\203\306"
+	.ascii	"T\020lN\016\331<\364Rrd\205X\224\261\240\332\007\314\2167\320"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_.pureconst.a583953c7c0f2656,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a583953c7c0f2656,"e",@progbits
+	.string	"(\265/\375 S5\002"
+	.string	"\224\003?"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\002"
+	.string	"\001\270\006"
+	.string	"\001\002\005"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\330\003\b\b"
+	.string	"\200\214\201\200\376\215\001\001"
+	.string	"\320\003\b\020"
+	.string	"\200\200\203\214\200\f"
+	.string	"\0071cO313"
+	.string	"\004"
+	.string	"A\031\b\334"
+	.string	"\026\016"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_.lto.a583953c7c0f2656,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boardConfig_Registry.12.a583953c7c0f2656,"e",@progbits
+	.string	"(\265/\375 \231u\004"
+	.string	"\364\007i"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\202\200\200\374\342\203\246\311\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\347\006us\350\377\005uq"
+	.string	"\005\001\006'\001<\005\001\006\035\001'\001\232\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/board.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_boardConfig.13.a583953c7c0f2656,"e",@progbits
+	.string	"(\265/\375`\266\002\315\022"
+	.string	"\326\241vF\340P%\035\330u\244Fq0A\342_\336P\t\315\035.}\306\366\304\225\367\205\241\030.\021\3126\365Gk\312\212\343$a\327\006\267\374v\242=r\037\306\t\f$\317M\360\200\002\340\354\211\321\353 d\357-eJ\001a"
+	.string	"Y"
+	.string	"e"
+	.string	".\300\035zv\221x\310=$\036\372e\343 \271Y1\345,Q\355.KI\374un\213\360i\276\374\315\304\243\223\301\316m&#vz\276=\326\363\370\f\320\234r\200\310r\236\210\316\211\016'!\317\037"
+	.ascii	"\031\317\025Df\363\b\354\356\225\236 d5\231\233\311\356:;\331"
+	.ascii	"\316\355q\3330\333\b\354\254\n\2730\265\207xeQq\303&u\330#\355"
+	.ascii	"V\206|w\215%\266\212V\2430{\006K\r\262\377vw\255@\366\223\376"
+	.ascii	"U\2469\230\336b:\3024\324\364{i\325tf\372$\372!\247\205\200\332"
+	.ascii	"\256Nm\307F\301\030D\037\266\237\366\217\216\364z\022\315\003"
+	.ascii	"\354\002A5\355\316\016\004(\361\035J<\214z\027T>H=\261\254=\r"
+	.ascii	"zJ\264\037\274)eDh\202\t\252\251\220\024\271J|\nap\200\360\027"
+	.ascii	"\021\240\204\247)e\024\025\222\360*1U\325\246P!\3379\301\017"
+	.ascii	"\316Yt\350\354\225/\265p\273\253`\305\213\0137t\350\323\304C"
+	.ascii	"U\225\352D\304\262\346U\3321\027\362]jV\241\210\312\r01/2\255"
+	.ascii	"\223\017\267\224Xp\255\264XX03,\231\230\025\f\254\026\227\006"
+	.ascii	"V\311\210[3..\326\206V\313\305\372\230\355\337*\220_Q\210*ZL"
+	.ascii	"k8\277\224n\343AQ\371\034M\305\262\366t\243S\264\r\310\225\332"
+	.ascii	"'\013\362\235\337\205t\320\232\242\006\2458\307\200\323H\364"
+	.ascii	"\003\235^\303\350L\217\272=\321\330|\031\237\321\340}\310\016"
+	.ascii	"\0026 \240\002\221\031\333\003\244\311\033\206\036\227\030\\"
+	.ascii	"`\305\313\336D\211\002AD\217P\323N\373\2739\036\033\370\316R"
+	.ascii	"^;\3634\315@\372\367\223(\346\0353\220_\370[u\324P\337\256\223"
+	.ascii	"k\362\261\255\220E;\310\214\312:N\334K\\\364\355\230H\300\224"
+	.ascii	"\304\345!\334\366Q\250e-l\337P\325\305U}x\003\214\331\202m\026"
+	.ascii	"S\302/\331\236\3308<P\303\372pO\312\rqok\215\036"
+	.text
+	.section	.gnu.lto_pgResetFn_boardConfig.part.0.22.a583953c7c0f2656,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"\275\013"
+	.string	"V\026N< 1T:\244W\202\001@1\340\250\374y\013Q\335Y\\k\331\214\002\3158*\252u\3641^\255\230\031\214i\235m\003@\240`7\0218pH\r\350\025\3678H\016Ad\023)S\n:"
+	.string	"<"
+	.string	"<"
+	.string	"\005\260G\373)ls\354\325C\323\206\374\331+\210\006"
+	.string	".8\250h\354\356\366\250#\376]\363\372|P\324\271>\365\004E\037\236\004~9\032\354\2563\020w\274m\211\355\005\366)\004\341\237\232~\206\240\203"
+	.string	"\021\273\240\215\032;\2120J\330\276\375\024\307\3264g>\344\034\265\201\204\353!\344L\373*~\372\216\332|\300.)\306\213\335P\301\243\023d\217\016o"
+	.string	"{\314\036\256X\362\240\031\2146h\307>\013\f\231]\341+.\331\356JT\031:\237\304\243\277\301\036UU\006\030\302\223\033v\244\255\271\220\007\257\017\220\211\026\353\243\235\324\222\365\372\265J\262\257\264>\025\313\004L\347@\363$\"\301\343\272\b[%\263a,\334e\233x\232-\362p\227\241x\233\205\256\3636\355\327*\311\327\211P\213\345\321\217U\265t\016\263!\274\005\3670=8\241\230\021 \017\234\202]U\035\030"
+	.string	"d\311\343[\f\271\025\030\017\276d3\206\026.D\bD,\211\ts\022\253\375ZV\001\357\001\024.\033\314\232\0254Z a\351\234rxg"
+	.ascii	"\316\b\341\256s\031\035\363\316k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a583953c7c0f2656,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"M\006"
+	.string	"\364\b\211\001"
+	.string	""
+	.string	""
+	.string	"\002\026\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \r\177\007\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\022\b\005\f\t\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\t\n\201\204\005\n\013\001\024\177\f\377\037"
+	.string	""
+	.string	"\200\200\200\001\025\177\r\023\177\016\020\177\017\021\177\020\017\177\021\016\177\022\003"
+	.string	"d\003"
+	.string	"$\003\001\f\013\201\001d\003\001\t\244\001\003\001\n\304\001\204\006\007\003\001\b\304\007\003\001"
+	.string	"\320\360\372\250\001\001\202\n"
+	.string	"\027"
+	.string	"C\030\304e\343\234\005\273\f\335\032\3554\001\267\nI\331<\nV\206A="
+	.string	"8"
+	.string	"8"
+	.string	"8"
+	.ascii	"8|\2000\270\364\304\202\341\362c\215S\013\201\205\n:\270A\007"
+	.ascii	"\323\t"
+	.text
+	.section	.gnu.lto_.refs.a583953c7c0f2656,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\002\n"
+	.string	"\003\003\002\004\002\005\002\001"
+	.text
+	.section	.gnu.lto_.decls.a583953c7c0f2656,"e",@progbits
+	.string	"(\265/\375`H\022\355]"
+	.ascii	"j\243\260#Q@P\322\031\016s]Y\226Kw\330\256\220\346L2j\031\025"
+	.ascii	"\225\013\243\204\340\242\204&\254j\351A3\223l\004\030HI2\200"
+	.ascii	">\016&\320\201\227\003\001\037\252\326>)\203>\003\226\374<\264"
+	.ascii	"C\f\200\030I\346p\262\030j\273\335T\025lk\261\233\224)\336\001"
+	.ascii	"\"\0022\002Q\026\352\204\200IZ\264{}\003s\313\266W\316\310\346"
+	.ascii	"\366l\251,\324\231\036A\213v7\227\245\333\033\266\313\312\255"
+	.ascii	"\330\316m\334W\313B\277k\367\262\201_hn\263,\334\016\260[)\205"
+	.ascii	"\253\273\277N\376\375\372M\240\330\271\335\262Q>8u\347\270\362"
+	.ascii	"\341\222\026c\212\257{%A\202\204\007\022$p\266\230\221\351\310"
+	.ascii	"I\177T\201\320\375\tB T\277p\377\226-\226\215\242s\006\304\t"
+	.ascii	"\017N\327M\350\373\246sE+\312\351\001#\250\334{\345\337*K\226"
+	.ascii	"\223\006'\346\203\323\265\"\364mKy\220\221*\302i\252\201Z\263"
+	.ascii	"T\3765[)\273vB\367\262\273\007\320\031\023S\316q\272j;\345\273"
+	.ascii	"\2666\364\256\235xv+w\215\007M\267\222g7\304n\210\224I\026\021"
+	.ascii	"\263`z\f\324E\023\372\246\371\004\233\316\265yT?+3~p\032@\004"
+	.ascii	"\352n\355O\360g}\202\b\254Op\304\376\004\027l\241\254\030\210"
+	.ascii	"\035\273\t\024\007&\301\332\253{\345\321\361[\342\327\307\351"
+	.ascii	"Q\250\337\260\017\240l\024\027@\375\202\b\356\337\202\b\236\325"
+	.ascii	"\253\355O\260\304\225\375\t\376[\303\277M\326\013\004\220\t\365"
+	.ascii	"l\262\356\265"
+	.string	"\003\317\212#\212\007\247_\367'\250\256Op\333\205\377\\\376\277I\340b\003\350\360\257\231\377[\376\237\271\337\177\026\376w\371?\366\177\356\377\332\nL\377o\370\337\266G\305\177C \376\277\333\245\177K\370\367\203\020\377\226\371\327\304\277)\376E\361o\003\377\006\375+\364\357\211\177U\354\317\277\013\374\313\300*\375\357\371\371\370o\n\377&\375;\374\327\350_\021\376\355\340\337\t\376\215\340\337\007\376u\340\377\337\377\276\377h\376\327\375\007\363?\372\037\357\277\335\177\257\377>\377\335\376\247\177\177\177\177\377\266\360\263\331\277C&R\374\324s\024\007@\264H9[\220c\234e\3747\354F\204+\312\214zf2\214\377f\247nH\331\0230\352\371E\215\224\277\275\0308\345'\365\211\345Dp\270J\323Q\305\351\371\351\347%\303\340\302_\2322\234\276n\177\202:\353\023d\245\320\331\t'\316J\364\213\323\034N\363\023[\277\375\363"
+	.ascii	"\3264\220f5\252\360u\277)ps\325\303\311\211w\267:\231hN8=k\251"
+	.ascii	"c\026\315\230\355\013v\357\372\224j\266\2639\342+f\367\276dN"
+	.ascii	"f\373\266\233\335\316%CC\355J;\235#T\273\257!\3123\337\276\177"
+	.ascii	"\311\351\0178\314228\375\230\233\205\223\nk3\303\207#\344\fJ"
+	.ascii	"\244\316\004h\021\033\234\212m\231\215\373\337<OwgS\316\250_"
+	.ascii	"8\365\374\007[\331\354n\0325k7\235r\2765\273#~\235\005n\002\r"
+	.ascii	"\004\301\325m\025\335S\215\330\240\254:\002}%\335\311\016\275"
+	.ascii	"v\223\031\206\225d\212q\231\352\260\366\216\001:\214G3W\254\251"
+	.ascii	"\364\331\334ko/\261\246T`\256\317&s}&{z\371Lv\257S=L2er\231a"
+	.ascii	"XS\314\260\347T\207^v\262\303\224;\324\345s\212\371\366\234\352"
+	.ascii	"a\206)\247\230K\254\251\016TQ\255(\030_J\"\233d.{F\224\225\262"
+	.ascii	"\331\003e\256\317\256\353^\262\247n&\320m\365l\326)\251V\315"
+	.ascii	"\t:\303\351L\371l\002\242\234\262\236\275\2042\217<\273\2178"
+	.ascii	"!u\324\211\344\n\355\037\013M\362\260j\250\247\356\002z\355\216"
+	.ascii	"\352NnC\273;\331\3356M\253\265[\206\036&WTT\267\323CT[%\247<"
+	.ascii	"u3\231\027\265)fX\326Sh\312X\030W\277X\223\313\325uXM5,\371\244"
+	.ascii	"\241\272{\305\250\\S5\302\204\241\262\243\204\212\215\214\323"
+	.ascii	"\375\262z+v\267\215~g\355E\231[\227\372\027\366nyx[\307u\365"
+	.ascii	"\206w\327\304\206\217 \253\327\315\224>$78\375\327\313\332\335"
+	.ascii	"\344\351\230\233\302i\235\007\325\311L\232.N\277Y\352w}\262\001"
+	.ascii	"K\366\2468e.[\030\n\307q[td-9\215\3335\013\222T\335q\312o\213"
+	.ascii	"\007\224R~\001\223\245f\306\332\032\267\355\217\247\252\204H"
+	.ascii	"\024\2536\266\233.#YP\2342\033s\025\266rfc*9KfK7\304\316n\210"
+	.ascii	"\0326!J(\301\3645L\365\251\031\260\363\030\030\253\001\345r:"
+	.ascii	"\t\326R6R\224\320\331\340k\246s\304\216\f=\254\036\\vV;\333`"
+	.ascii	"\002\305\363\210>\306\3068\345\2643\332\0171c\3143F\353\302;"
+	.ascii	"\363\313\242\262\024\006~uf\007\0323\016[\\\204 \341\224\311"
+	.ascii	"\236\307QkH\2568\345(\327\323"
+	.string	"9{\262e\265`\200qYrN\234r\330Y\354\277\271Y\313\321\003k\r\312\177cc\326\245\212\013M}:\246\376\353\374\305\353\202\265T\320\256)w\204\257\3339b\257\222pa\2159\25778\204\201mi^\325P\003\032\007\275\266#\302\351S\250&_1n\262v\031\364tg\311P\353\246S\001\036\030K\255'3\352w\311r\362\334\\1N\362\022\017O\326$\316\336\031\r5\276nZ)0\001\224\027=N\225\254K\033%]\027,x\352\327\313\006\343p\202\3075\250\356\260\230G\022-\353\365\0139\371\206\227\227.\366\301C\026\352\354\351e\032_\264\352\027\342.\336Qg\204i\340$|\204\271\270\b#Y1\356\342\036\347)\246\261\344\030\270\213\255\370\271\320\255\t\274\354\242<{M\242P\365\2446\236\367\301\211\231\201\223/?\013a\"+\306C\356a\355&\033\302Z\034d\241\316\265i\220\240\227#J"
+	.string	"\t\2350suU\301 <\303\331\252%\206S\006b\343\244r\203\341lk\305\370\207:F\311\224\276\347\341\264\001\311*S\017\204\242\036\230$K\275!z\025\307\245\036\030D=\260\207\312W\234c\305D\260\216\263\f\\\365\032\345\272\362\360\fi\312\240X\251_\021A\340\337\337\212\b\036H\245\366\354O\220\201R\352\2011\324\237q\360\215\232\260,{q|#\n\313\301A9qz\340\223\3323\002\212g\260\324\177\303\303D\315GHa\213#\213\237\r\220\302a\007\n\212\210F\344\321F\251X\244`\250\006)lqd\261CL2\"\217AB\243&\245\"bR\220\361\330\024$\200\222R\023\221X$\332\260P4\"!\213D\233#\"\241R\352\202\251hI\270\024<\022P\361\210\2304Tt\324\002)\034\346\270`*V\320\263$D\036]\264"
+	.string	""
+	.ascii	"y$\240!S\320\220\311\247\210\330\204C<bc\315q(\0079D\0342\325"
+	.ascii	"\020\207L@$\344\220(T\n\"\207R\b\251\351\361(4\032\031\021\331"
+	.ascii	"\270`*\026\245F$\023\320HH\034&)\021\331\030\t\217Mi\221\360"
+	.ascii	"hs\343\320\220\tH\307\205\021yL\032\n=\030\n\340H@\304b\322\321"
+	.ascii	"(\\!\310H)\251\t\005\003\220\302\241\221\b\311\341E?%\200\220"
+	.ascii	"F\"&\240!\342\005H\341Q\350\301\220\351\303\213\222\214B\242"
+	.ascii	"p\250\376D\n\006R\250h\301\346*V\224XQ\"x\025+\204\204V\244\020"
+	.ascii	"R\237B\b\210\034\022\272\220t\f\"\217$\300\213LBc\020\262X4\006"
+	.ascii	"\341 \205-r\216C\303\244#b\261\002\035\"\3420\351xc\304\302("
+	.ascii	"46"
+	.string	"!\213\210\216\232\210DK;F\"\244\242T\270D\304\301\rrH\005\222\230\324ds!\241\n\020"
+	.ascii	"\201\003\f\324\"\240\240!S\0201\211h)\250\310x\f\002\372A\n["
+	.ascii	"\020\213IH\242%c\361\210\310\302\310HTD\301\247\017L\362\204"
+	.ascii	"\301\261\243\212S\366\343? \r\\fv\317\373\027\036#xkN8e4\234"
+	.ascii	"f\213\253\214\312\365\036\345\341;\302\347\245O\315fF\223>\037"
+	.ascii	"gx\345\211\366\241]\261\03188/\265/\314\267\177]\242h\320\310"
+	.ascii	"\234\313\364U\221\233\343\224\367x\f\207\2543(t\215\241^C\266"
+	.ascii	"8\3450,\346cX0\324\232\034\352dxQ\006\314\\M\225\347\031f\224"
+	.ascii	".\315*\333J\242\307m\024\204\201\352\301_\256\320\215\275\225"
+	.ascii	"\345\365\251dj\274aqzw\307mZ\\rG\370\202wE\274h!\261\373\355"
+	.ascii	"\230\356\300e\347`\302e\223\026\275\022#\253K\027\246[\272\033"
+	.ascii	"'P1\276\350~\035\033Tq|8\260\234\335\216\205\347\200dvm\3473"
+	.ascii	"\tF\005\033S\247\f\225"
+	.string	"(\r-\347\271\263\234\t\024\034\307\363\025\201]\250q8\247\224$23\"\"\222$I:1\005\204 '\251\263\033\021P\251\203hj$IRH\233\001\266dR\027\221\277(\261<\227\tZ;\310\205^\300\362\375\034\013\013\316c:\355\242\263g\034J\225C\265\340\334\200p\001\277\276\232\325N\313\244\301l\3208\253\305-A\273\253\375\320\377\002\177\022\217\363\032\\:\344O\345\312_9\023\270)\226\242+I\212R}\030\304,V\220\261umY\037U\331\203\037\2701\346'b\002|\007b@sQ\275\333Cr\252D\327\305.\004\207\242\021\340\034\333\203F\261\026\300\375!\225Q2\237azS\366<S\200\237 \223\347\032~ \373\343_\305a\301(8r\261$\222l\367]i\276\333XMD\377\0222lz \022\271\207\037\336\216\314/\nwW\034\323\355\364\244\206RlO6K\275\276\354\356\376\253\007\276"
+	.string	"\220\247q\202\304R\342\313(171r\333\252\254eU\005gUM(\251\216b\013<\334\376\275\332\316\026\255Ud\023\331\265\3353H\360?\023\023~\320\214I\b#\254\001H\020\356#\257'm]\210\2269\313\237*\250y\310\332[\2271\251\201\005\035\303\335O\233\275+Q`\025\271(g`\301T\220\035\004\274$\2515Q\272\002\332\033CZ\364~\311\224\211A\331K\341\263\260\205u\311\364\200\033z\004\370\345R\344X\030k>\235WN\335s8}\300S\331<[\004\321\031\254\374\360\250\346\200Q\237\253$c\n\362\023\273wX}K\215Nh\300c\257r^\217\023\342 M\334\234\243\211\2012`\233[6"
+	.string	"\246\324\343nB\032#\246\222\"\242\311\336]\341\327'\331\037\226D\023i\2561\362>,\021+n\246AA\303\205\305H\347\332\203\250\314@ <\202\345/\034\033\021\315\247D\266g2=yB\371\333\313\304\376\016\025\351d\304/\341\311\027\177M.-\357L\344\232Y\343\001(\322\270\204\206V\005\r\241\231\314\306\244^\222C\001\213\343x\"\220\025\251\356\345\241\333\\:kQ\025\351\013\223\325S|\260\241\370\260\214\005\3145\"\304\275\315\253\013\302\005\275C\337\022\007qe0A\\\025\300\372\221E\372\bi\232\021\320\317\311q \002\277\035\302\311\346\024\200\211}J\013\334\305\272\340J\025\225\037\t\0042R\244/S!\346\016,\251\314\214\376\")\316]\201\256.\312m\314m\206\017M\270U"
+	.ascii	"c|Jk\377\334y\217\005;\351\264\3031\001\372Ipr\361N\340\021\362"
+	.ascii	"\177\373\243p\225\227\027\230/\327\266\300N\245\376\n\034z\274"
+	.ascii	"G6*\330\346\332\301s\031;\354\340\\A\362_\274*"
+	.text
+	.section	.gnu.lto_.symtab.a583953c7c0f2656,"e",@progbits
+	.string	"pgResetFn_boardConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"boardConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"boardConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"boardConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a583953c7c0f2656,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
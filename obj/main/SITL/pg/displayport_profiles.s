@@ -0,0 +1,216 @@
+	.file	"displayport_profiles.c"
+	.section	.gnu.lto_.profile.f279ba9263db746a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f279ba9263db746a,"e",@progbits
+	.string	"(\265/\375  \345"
+	.string	""
+	.string	"\260\024"
+	.string	"\003"
+	.string	"\253\305\214\222\r\001\240\342\234\212\n\002\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.f279ba9263db746a,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.f279ba9263db746a,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f279ba9263db746a,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.f279ba9263db746a,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.f279ba9263db746a,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.f279ba9263db746a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayPortProfileMsp_Registry.14.f279ba9263db746a,"e",@progbits
+	.string	"(\265/\375 \232\215\004"
+	.string	"4\b["
+	.string	""
+	.string	""
+	.string	"3"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\237\371\ryw\250\314\006yu"
+	.string	"\005\001\006'\001\013\005\001\006\035\001\001\200\0048sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"%./src/main/pg/displayport_profiles.c"
+	.string	"\004"
+	.string	"A\b\354\345\206g\222<"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f279ba9263db746a,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\016"
+	.string	"\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\013\001\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\f\002\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.f279ba9263db746a,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002\001\002\002"
+	.text
+	.section	.gnu.lto_.decls.f279ba9263db746a,"e",@progbits
+	.string	"(\265/\375`$\b\r/"
+	.string	"*U\270\022DP^N:\377\375\246\317aX\263\274\233\252\360\241v\365gC\002\236\367\226a\203\203\201\371\217\373\221\200FbC\357sk\241[\277j"
+	.string	"s\n|\030\211y\001\220\035)Y\206\247\211\f\215\334\235\220H\236\330-S\367"
+	.ascii	"\036\001\"\001H\235\2642\350\244\365m\346Sk\331\302G\260\030"
+	.ascii	"\302[\303\365\230\177(X\026\327\304\r\253\347\300\276\305\224"
+	.ascii	"\030s\343\206U\265\177f\3550o\267\177\b\313Q\251\302\003\253"
+	.ascii	"\327\300\276\301t\333?tt7\245M\r\253\257\300\276\277\374\037"
+	.ascii	"\nr\233\352\025\301j{ao<`\002\360\005\207\344\bV\337^\376\206"
+	.ascii	"\266Z\263\265\310\031+\347L\200\306\324\357\017V\233Kwy\263\365"
+	.ascii	"\332'X8\260j-\237\345\234\233\255B\222\234\255\232-\330\227\263"
+	.ascii	"U\260{\251{I-\003\243\022fU\277\304\376\256\225V\243NZ\373l\370"
+	.ascii	"N\373{K\243%\255]Nh\006\223s\016\022\321\241\311K\303\352\241"
+	.ascii	"\255\264\262\235\264\026u\322z\314\376\007\364\337\357\177\337"
+	.ascii	"\377@\377\375\374\227\376\347\373?\215\360\177\356\377\336\177"
+	.ascii	"\275\377G?\356\277\233\376\206\360\367\377\003\377\313\375\307"
+	.ascii	"\323\351t\372\177\305\217\027\374\353Wh\350\356\324\351;X\334"
+	.ascii	"4\332?t\323sgv\372\214\264\363\364^\3279\2212\026\2344\317\356"
+	.ascii	"\037\266\264\357Z\256\353\234\032\312\356\002\365_\3735_\377"
+	.ascii	"i@\335\327\321\2266\2367\231.\203\325u-m8M\247\353\3046\234\325"
+	.ascii	"i\0226\005\365\314\276\020AR\323<\017\202+-\021hxy9C\365\332"
+	.ascii	"OG{\357Bh>\205\177\270\327x\335\007\b\265\222s\330\224\003p\350"
+	.ascii	"\340\314Hs\2066\025h2\342\023\347\356\310\332\207\317\321\033"
+	.ascii	"\324I\037\254\366\036!'\021\271,6=\035\355\274\343\025\345\214"
+	.ascii	"\200\335\313Bf\357y\210\322\214\201\255\261\3573\366M\305\016"
+	.ascii	"+'\357\213\356\t\373f\302\276\237l\307i9\035e\3529\3577m\367"
+	.ascii	" +h\206b(~m\\\260\372\026\302\276\231V\340t\332L\353\273\213"
+	.ascii	"Ej\245\025+\255o-\366}\305\376\335f.\250\013\033=\272\271\226"
+	.ascii	"\003jm%\201\006\300p\332l]a\265\325\364\232\216&h6\320\240\321"
+	.ascii	"\237\226?>\254\276\006\373N\260\366\264\023\254\237b\003XL\b"
+	.ascii	"\315U,\234\021\372\n\037\2561\254:\021b\256???\260z`\036\373"
+	.ascii	"\266\023\202\235\023\316(\034QP\366$\313\262\305\003\373\310"
+	.ascii	"\222\226\007$H\313=\267T\251\373\201f\301\b\366\201\301\354I"
+	.ascii	"&\275\361\017\361\023k\341\035G\300\234\227\270U\301Y\370\211"
+	.ascii	"\277Z\356\250\n\232{dx{\222!\301Ip\030^\202\301p\023\254\004"
+	.ascii	"3\351(~b\257\343+"
+	.string	"\214\365\206\346\334\324D\204\206\f-O\200z\240\031{`\023\366@/\366\300\037,vbL\004\0279v\342!EX\330\251\366\322Q\367R\320\031)V\\V\365\300-\366\300,\366x\217\025b9,\346\302=:*\304]\301\266\273\342\362\302\3521\035k#O[\270\036\277\261\020\360\216\037\343\350\272\226k\221s\027#\274(T\nVq\216\341\261\016\rP\302\312\260\nTc\325NZ%\304\251i\245\225(\214}k\3516{\307u\264\315p\026\252A\253\210\242i=\372\244\271\313+\202Q\034\037Z\033V\247P\241\220\025\2359k\366\260o\2644\335\006\rOT\314\245\007\"\323%a\340%\016xT\f%2\331\2415\"g\264\037ZW\352\310%\016H.\215C\257+\005\003\212\303\324\2629\224\\.;\020\203\336f;C\211\\c\030\213I\027A\327m\225o\324\021\331\354\320\276\310\250\251\340\232,\"\233-\212"
+	.string	"n+\225,\252h\276o\021\200\214\366u\251P \270\203\367QNGf\322\227\314\266\371\364.\227\315'\"\243R\n\304\333\272D\312\027\370m\335\266\031\344\022\217\314\242\227\250<2\203\224G&0\352=*\333\344\372\022/\f\331\226\006\322U]\267mBA\025\205\250\230K\243\372\0221\274J\244\224P\363e\002?\034z`\220\242D\b\326\350\3442\211os\311|:2\237\224\310\242\214'c\323}rj"
+	.string	"\325*\217\310dQ\b\252u\245T\345\022\371\032[W\350M\342\221\351d\324,F\031U\252\346\353\"\217\355\t\"\323%\321&\221/\226M\023osi\202\252\230d\272H(\005Q\260\230\320\216\2535O<6\206\305\204H9\203\025\211\023\322s{\273\303\352\325,\366\307V\357(\266\n\200\206\250a4\350\fC&\020\221\221\021\021i\223tp\002\221\251\262\352\022 f%MA\212HJA\212\r\373\031\242\016\330\361\375\\\343\024)\335\321{cQ\363\225\345\225\321\362\305%8\306\215\216\230K!\004]\324\223"
+	.ascii	"\032N\355\327`\312\262\273Xf\252\002\366\276\256\220 \022\366"
+	.ascii	"\013\216\323\346\326\030-\305\220Q 9\255MX\214\300L~\235+\343"
+	.ascii	"\241~\233ZYR\026\3064q\324\360S\0373\347;_\326\277\024\373\324"
+	.ascii	"\214;\354\006\214\204\373\212\375\204r\223ABG&\242w\322\016\205"
+	.ascii	"4\r\215\203dG\332\0216\374\216\276S\205\204\034\356\007\210\202"
+	.ascii	"\352\207\024$y\"x\271\270\n\251\322\323\304\360S\270+Y\032\034"
+	.ascii	"\330\250K\220\306\270\256\275\377\233F\363\002P=\212\036\n\240"
+	.ascii	"\034\\\037.\006\334\250wK&h\243[h\344x\027\320<\016\200\252\303"
+	.ascii	"\005\306\240\017\"q\254\026[\3516H\203\027\262j!t)/\304\302\312"
+	.ascii	"\207d\324,\335L\001\333\314\025\326\006\013\326\245\312\340-"
+	.ascii	"&\223\207\225&\236F\204\2360\250\317%\267:\372B\235\036\320\257"
+	.ascii	"\304\177"
+	.text
+	.section	.gnu.lto_.symtab.f279ba9263db746a,"e",@progbits
+	.string	"displayPortProfileMsp_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"displayPortProfileMsp_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f279ba9263db746a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
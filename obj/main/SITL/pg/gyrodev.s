@@ -0,0 +1,325 @@
+	.file	"gyrodev.c"
+	.section	.gnu.lto_.profile.40afe3211328c2f0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.40afe3211328c2f0,"e",@progbits
+	.string	"(\265/\375 ;]\001"
+	.string	"$\002/"
+	.string	"\004"
+	.string	"\355\371\207\343\017\n\002"
+	.string	"\002\001\002\001\217\261\245\234\017\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"\240\377\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.40afe3211328c2f0,"e",@progbits
+	.string	"(\265/\375 \027\235"
+	.string	""
+	.string	"h\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.40afe3211328c2f0,"e",@progbits
+	.string	"(\265/\375 <\265\001"
+	.string	"\324\0020"
+	.string	"\001"
+	.string	"\006\n\200\200\200\240\002g\001"
+	.string	""
+	.string	"\002\007\200\200\200\300\003d"
+	.string	""
+	.string	"\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"YD\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.40afe3211328c2f0,"e",@progbits
+	.string	"(\265/\375 S\365\001"
+	.string	"\022D\f\025\260%\351\207%\311\243\f\2440\024\301\340\024@\320\355\366\226)\005\352T\366\213\032y\324\217\332\002F\305\251<\314\016|0s\241v\366H\217\314\273D\003"
+	.ascii	"\366\214\241J\310\033h\003"
+	.text
+	.section	.gnu.lto_.pureconst.40afe3211328c2f0,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.40afe3211328c2f0,"e",@progbits
+	.string	"(\265/\375 -%\001"
+	.string	"\320!"
+	.string	"\001"
+	.string	"\001\270\006"
+	.string	"\001\002\006"
+	.string	"\001"
+	.string	""
+	.string	"\b\b\001"
+	.string	"\001"
+	.string	""
+	.string	"\b\b"
+	.string	""
+	.string	"\003"
+	.ascii	"4E\203P6\200\005"
+	.text
+	.section	.gnu.lto_.lto.40afe3211328c2f0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroDeviceConfig_Registry.32.40afe3211328c2f0,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bj"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\303\306\201\037\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\365\007us\250\305\007uq"
+	.string	"\005\001\006'\001\034\005\001\006\035\001\002\234\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/pg/gyrodev.c"
+	.string	"\004"
+	.string	"^D\200I^\212\"d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_pgResetFn_gyroDeviceConfig.33.40afe3211328c2f0,"e",@progbits
+	.string	"(\265/\375`\355"
+	.string	"u\f"
+	.string	"\006\230WD\020o\234\016\300z\264sR\321\335"
+	.string	"rbxc\022\023\241\016\231M \353\376\237(\204\320\250\f\034\260hz\f?\260GX\326\001\"\351\204\375\377\377_9_\005s\266\271\267\337q\177\300V\033\242?-i;\245@"
+	.string	"C"
+	.string	"E"
+	.string	"\341G6\036`7\365\302dwD`\003\331\251\307\017\300N\263\013\300N\035\3320>\202\354\313\016\013$)\273[-\017\017?C\377\345-\242\007\352\263\302`w=E\217\f\267u\333\005ls\354\207\001\033Bbp\314\225=\242\246\325\301\376\265\273k+e\177\344\237\226\005\037)(\231\022\273\035\253\031{BW\2008\371\333\177\351\213=~Dx\362\224\255\211\003\026\032T\273\030\016\234\272f\247\t\260O\373!\027\t\177\007;\211\227Z&\332\0337/z\226\210\234T\260P\237\253\370\211\333\020\216\"\313`vw\023\2377\266\204\227!oN)J\212\020/a\366\350%%"
+	.string	".vw\343\223L0i\200|8\3657\260S\315\205\026\001\nD\336\326y\334'B\203\356\023\205F\032\346\201\367i\244\315S\261\246!m\236\0174q\225\003U\357\323\351\252\006\206\252\206\200?\320\006V\321\367\201\3652\356\257\265R\276D|\310PqX\024|\272v9pN\376*r\256\214\231\001\021"
+	.ascii	"3CK\215A\201\215\207`\302\002\303\360\231\360\317\303\020*cQ"
+	.ascii	"G\230\232 \352\032m\206\2032e\0304\221\247^\001'yqM2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.40afe3211328c2f0,"e",@progbits
+	.string	"(\265/\375 k\025\003"
+	.string	"4\005g"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002!\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005 \b\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\035\t\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\036\n\001\"\177\013\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004\244\001"
+	.string	"\004"
+	.ascii	"\\L\032\341^\\\326\316\241@\001"
+	.text
+	.section	.gnu.lto_.refs.40afe3211328c2f0,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.40afe3211328c2f0,"e",@progbits
+	.string	"(\265/\375`\272\016\315M"
+	.ascii	"\372\211H\036T@PBJ\007\211\267\007\343\364p\334y\320\250\321"
+	.ascii	"_q\260xM\265\214i\265]\340X\312\024|\033\257\322\256\273\371"
+	.ascii	"\356\350l7h\316&\374K\231\017\233\333\323mT\325?1d\335\260l\377"
+	.ascii	"\007\006u\t\315N+\027\372\003 5\360iP*a[\342\244I\231\002\227"
+	.ascii	"\001\312\001\326\001l8F\235n*0\3150{\266[6m\352\264\362\322\354"
+	.ascii	"n\037  \364\2071aI\364\374\216uQ\342\313*\261^\226\271l\347\264"
+	.ascii	"{i\277\222X5\034\232\356e[Uw\237\201\177\367e\333\265U[\201\243"
+	.ascii	"{iD\205Z\231\023\020e\272\033\250\007\bH\210E\304L=\277\314\372"
+	.ascii	"\315\252\337&\365k\244~\267\374\213\265Y\253\266\313\356\245"
+	.ascii	"\356\036@\307\203\354\t\025>7m\221X\246\317j\371\242\355\330"
+	.ascii	"i\214i\247b\246\224\222|~\205\324\030\272\343\342\326\007]\264"
+	.ascii	"\335\367\210\024(R\2316WN\254J\0168>y\203\324oS}syP\034\030\352"
+	.ascii	"\032\261U\226\331\263e\235\263Z\224\234\240\370\374\260\312\320"
+	.ascii	"q\333\203\336\250\276W\237B\325\031\241\366xP[,\017\372\013\352"
+	.ascii	"\317\362\240]'\016gD\220\360y\b\352c\324\325Z(\313d\261D\034"
+	.ascii	"F\214\347\212Z}\325\235\346\334<1\304\023f\370\274\002\365\273"
+	.ascii	"\365\024\306\216q\233\372e\201n\334\262@\317u\306\362\240\013"
+	.ascii	",\017\212:\371\267\311^\365\344\216L\313\346\352Nwn\330\340\316"
+	.ascii	"\320\370|\272<h\335\024\350\277$\240\360\337\313\177\266\377"
+	.ascii	"km\377\277\374\027\363\277\354\315\235\237Y\374[\343\337\f\376"
+	.ascii	"\305\340_\013\376\235\340\337\n\376\275\340\337\rN\370\027\201"
+	.ascii	"\177!\3707\2025\341\277\316\3177\374[\302\277\037\374\353\301"
+	.ascii	"\277\034\374\213\363\037\356_\232\377Z\376?\361\377\314\377\253"
+	.ascii	"\3776\377\261\374\317\305\305\305\305\375\027\373Y\311o\363\023"
+	.ascii	"4i#\225l\2764\273?\377\315\346\266\200\377g\367_,\351>\342\346"
+	.ascii	"V\177\b3\002\341\363\177\213>\223\356\342N\247\215<nE\025\217"
+	.ascii	"L-\311\235\264\205\f\320[C\372\230F%\317es\247\275\275\024\225"
+	.ascii	"l\341\230.\221\307tY\324\351\245e\261;M\352\034\271\214\305="
+	.ascii	"nE%\217[\313\344N/u\261\267\214B\352\3222y\314\262L\352\034\267"
+	.ascii	"\214\311\343RTr\247\0077\036\220\314\320%\352\312&\217K\355\324"
+	.ascii	"\004eD\352\244\035\323e\257u/W\216F\026\320\r\265D\256\031{\254"
+	.ascii	"\230R\232\223\322\024\343r\323&%\251e/\245\035\227,\273\227("
+	.ascii	"\025uS\003\3054\255\215lZq\bT3\345\350V\321iwSwq;\255\273\213"
+	.ascii	"\335\255CB\245\335?t\216UMM\335\312\236\246\206*\216\345\350"
+	.ascii	"f\256/b\311\343\226\324r7F\304VU\353H\213[\325kQ\310\272U|\322"
+	.ascii	"L\335\275cjU\262\0061|2\216U#\343\304\016\253\312E6.\223\227"
+	.ascii	"~V\332\257\237Z\313\336\352NorF\034\316\302\370<\177\320\234"
+	.ascii	"\375A\177\356%\320\256\266\247\257\2700\271\346\032\326\023\237"
+	.ascii	"\377>\261gr\300\252\336\300\370\204\353\261\tsVe\003\237\347"
+	.ascii	"\"\365{\365\266Yv\t\264\260"
+	.string	"f\372\004\354\013l\243H\t\023[/\257\035\243\322U\025\243\210\215\202\223\353\316\201\253\252;5\263N\254\230u\333&\266\3142\261dv\3142\367m\257|\315\026\213\224)\033\305jJ\263;=\003dke\323\224\0170\311jf\301\210\261o\313\265^8\305\264\237h|\361\270*\323\235\002\355\322JmJ\200\263\351\223srv\226\004\256\202\331\266en\230\345\362\r^\271\243\262kp@\252\t\t\225\200nLI\222\037|v\245K:c\227$\256xM1\025\226\022Ex`\373\201\201\b\342\210\275\372w=\260\221\253/\274\203\026\013\301Y\233\246\324\351%\2602\3151\326b%k[\314\305Q\230\311O\030\n\023\261L\326\342 \316C\230\310{X\213\217p\222M\233\232\340\312K3\307\255I\224\036:\347\324\333V(\0355\300\002\323d,N\227\311Y\357I\273\271\262\230\t;\3314e\332<P|5\325\262\370"
+	.string	"\335\210\331\262\006\004ur5%-2\206On\242S\366\300\202\203j\210e\262U}c2f\346m(\312\250\244\212\324\237B\352O\033\226T.\315 \247S\3759C\375\251T\031\t\373\260L\027\\\305<\234\351\202\342D\375\272@sqq\353\002}\356\255>\327V\237[\253?S\261\021\232-374#\033\205\325\316\230\224\266T\235M\201\266\370\321\201\205p\324_\223c%\266\203\224,\365\274\354\200\352\b)7\002\345 \347\034\376\032\306\342CUSY=\003a\250\277\006g\rI\327\023>\237\013\253\347\0374R\342\334|\360\311>j\216\334\023\027"
+	.ascii	"\004\001\323\201}\374\\\003\333\300J\025`\210;\303\004\237\214"
+	.ascii	"\003\3678+\371\006V6\260\3546\2622\007\256\333\230\263K\300."
+	.ascii	"\001\247\225\224\017^\350\371\334U\375\332\362\2407\233\002\345"
+	.ascii	"\344\356\314\003\005Z\225f\026\2376\271\250z\326\301\307\363"
+	.ascii	"\216\357`\247\332\335\013\345\351\207\2222\255T\376\240JH,\217"
+	.ascii	"4\235\235\016\306\246W\340$\361j\"\343\363o\314\364\277\346\006"
+	.ascii	"\026Y\222\231\230\006\0343\266!E\340\212\350z\222\342\223\311"
+	.ascii	"3\354\225\032 P\310\234\201\251"
+	.string	"\347\037m#\262\273y\004\302!\"\340\020\021\004\243\240\020\003\"\033?\244\025\fH:\n\326P\2214$\024R`\324#\016\223@\020ZA|\321\013\337Q\n\036\020\t\005\220\005\026\322\f\205l\210B@\337\021\r\320w\224+\"\372\200=\033h\355\301\360\033\236C\272\244\243 \357\024\022\217rD=\035Qo\210t\002\203?\"\2577\324](\344;zq#\034*\342\235IB\342\360\347\353}\340s\236\020\020\003bo\330\373\300w\244\342\274\237\260\007\354\371\352\033\220\241\200\214\0317t\237Ac\001\032\013\240\237Ac\267\243!cW/c\227\353\t\341\020_\324C|\321\013\241 `\320\310(\310;\340\301\243\2360\210\030\f\n\203P\330\260\021\024\236E<\342\357\210\346\205\241\244\034\222\22008\004\366\206;D!\031;\"\360\247{aH\230\243\300(H\034\"\361r\206B\276\037\013\300`\215\036\357\347B\317\202"
+	.string	"\320\033=\"\340\217\246w\224D\034\"\255\240\033\"U\360;\032\242\276\241\020\200C\036:D\252\200\007\343\207\016\207=!\021\021\005<\030?"
+	.ascii	"\210B\276\241\020\202?\235o(\204\037\361FOG\024\232A\004\376"
+	.ascii	"\220t\337\355j\264\020\241\203\f*\357\205\013=\242\2400\311\027"
+	.ascii	"\344;\n\002\376\206\214\202x\302a\320\213\001\210\300\236\021"
+	.ascii	"\320\367\2631T\203f\206\202\314\013\030\2603\261*V\276\212\340"
+	.ascii	",N:\244\2400\361y226[-\037N\312\037\035\323ST\331\225\263\331"
+	.ascii	"k\212(\315\314\360\311F\260\025\033 \276tL\261\225\262\023\207"
+	.ascii	"\025S\227f\005b\325#\211*\313\305\007\035\263v\004\013\347\220"
+	.ascii	" \212\313\016>O\363D\205\n\021\247m\272R\206\312m\n\223\247\260"
+	.ascii	"\330\217N\267\024\225X#\225\t\340T1\323\"\303\347\371\213\301"
+	.ascii	"\366\fg\371\362\025\305'\214\3359\feB&\244\t\036t\305YV\277C"
+	.ascii	",#\317R\313d$\007\200\376\250q,\247\fD\310\210\214\220\210&I"
+	.ascii	"\322\001p\002\221\251\252\321\003\021@%s\b\031\215&I\2515\370"
+	.ascii	"\377\350\261\340\360\0344]\261\375s\371"
+	.string	"\202\271\247\237K4#f\270R\236\272\364\202VfT\311\204;\370B\330M\307\227\032\b%\257\225x\303\206V\220\315\233\221YH\300k'\24066+\322G\356Q\334\306@\220\221P.\261'`R\324\360\335\0045\343\202\332h\311\t\302\211\312.j\276\366\342\327c\205\017~\372l\301\352\312j\220"
+	.string	"\n\r\317|\00417\313\003\213\036\273TY\340\305\033@\304\203\016\351R\243\335\222\234z&\245\242\222\346\343OI\241\243\344\260\374'\267\256\003\301L\rJW~\b4V\2640\306rL\257\354\027S\007\234\376\207\211E\202+\261\202\205\020\215\230\345\272\272\022G\235\020\3033\233`\031\033l$\036\222\306\275r\335\366\302\226\323e\216\244\240\255q\260\020N\021\220\336\343\363\"\247"
+	.string	"\237\223\275\244\313\306\354\350\t\035$0\336\n\320k\341\332s2\240f\334\337sy\033H\230y\235\252qk\324\336\t\253\357\304\200\207\366\233P\002\030~\306\333\342\237\344\316\337\306\352h%\261\215\007<7\323\001\261\233\302N\032\264$&\002\"0\\\303\342s{jz>\373\325\347J\202\tgu\253a\335\017Tq)\212\202\241\025\346L\242<9[\221\350\361\230\bdE\022\350\224o\032\221N)\242\n\210n\2078\030\256\310W!\241\330\002\345\340\222\270\0018\200\365\334\354y9\017^\263j\221\0015Lh\365\246reUd\334\215TbsK\021\250\371\022\332\027 hn\361\220U\201\370\343\364\3135\233h\020\213h\240 D\305\363D\025]4\247grO38\374\371\364\002\347\220\270\321\233"
+	.ascii	"\213\332\374&>B\336A\t\276\254z\n\276\231\203\t\177>\004\266"
+	.ascii	"\006=\024\222=\317)B\303\335\312f<\253Y\377\222\021\265o\264"
+	.ascii	"\344\212\262\026\034\\\030{\337\007\003\253\247\3404\326\022"
+	.ascii	"\240\314\237\001\323?"
+	.text
+	.section	.gnu.lto_.symtab.40afe3211328c2f0,"e",@progbits
+	.string	"pgResetFn_gyroDeviceConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"gyroDeviceConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"gyroDeviceConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"buildAlignmentFromStandardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.40afe3211328c2f0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,333 @@
+	.file	"motor.c"
+	.section	.gnu.lto_.profile.79bbee40c1295468,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.79bbee40c1295468,"e",@progbits
+	.string	"(\265/\375 O\245\001"
+	.string	"d\002C"
+	.string	"\004"
+	.string	"\337\364\234\224\005\024\002"
+	.string	"\002\001\002\002"
+	.string	"\002\001\001\313\353\316\360\b\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\005"
+	.ascii	"\300\b \260\222w\327\022\f\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.79bbee40c1295468,"e",@progbits
+	.string	"(\265/\375 \027\235"
+	.string	""
+	.string	"h\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.79bbee40c1295468,"e",@progbits
+	.string	"(\265/\375 =\325\001"
+	.string	"4\0031"
+	.string	"\001"
+	.string	""
+	.string	"\032\215\327\207\370\003h\001"
+	.string	""
+	.string	"\002\034\346\271\206\310\003g"
+	.string	""
+	.string	"\020\371\353\201\220\002f\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\r\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.79bbee40c1295468,"e",@progbits
+	.string	"(\265/\375 ;\255\001"
+	.string	"\304\002/"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001\004\002\006y\001\004"
+	.string	"\001\300\004\001\004\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\004\001\001\001\002\006\035\001"
+	.string	"\006\035\001\001"
+	.string	"\002"
+	.ascii	"\276\210\261\2016"
+	.text
+	.section	.gnu.lto_.pureconst.79bbee40c1295468,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.79bbee40c1295468,"e",@progbits
+	.string	"(\265/\375 hU\002"
+	.string	"R\304\r\031\260%i\f\f\345@d\231C\241\tLC\266\354J\341\272\251m\244\021\231\002\023\231[\312S4\002\005\314%\252K\036\324\n\267\352}\352\341\022\2131\222\261"
+	.string	"\303\256 \006"
+	.ascii	"V\r\\\325\220\237\201\227r\005X\270\2016"
+	.text
+	.section	.gnu.lto_.lto.79bbee40c1295468,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_motorConfig_Registry.15.79bbee40c1295468,"e",@progbits
+	.string	"(\265/\375 \231u\004"
+	.string	"\364\007i"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\202\200\200\374\342\203\246\277\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\346\006us\350\376\005uq"
+	.string	"\005\001\006'\001\032\005\001\006\035\001'\001\206 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/motor.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_motorConfig.16.79bbee40c1295468,"e",@progbits
+	.string	"(\265/\375`\331\003\365\027"
+	.string	"\366(\224L\240\024R:\004\220\215)\340\213\r\374\036\3013|)\273kV\247\210\357\210T\320V\204\256\243\376y\003\230\341Bh+\352\2778\357\374>j\264_\304+\307\311\351]\3407)\366\343\326\b\351->-\3421\367\315]-\322\b!r'\031{"
+	.string	"z"
+	.string	"\203"
+	.string	"\257\221\273\023\320\007\334\333\0032u\357\032\303\006\320\233\274~v\336D\257r\336\3141'!@\004 \252\210\230\274\367\246\r\343d\373r=\227\235;\3544\321\262m\216\037|\001\025W\352NwX\200]Q\221\310\236(MH7Q\244\243\345LiF\323\253L\360\312\027#\224\324\207\267F;![6\035\275?\374\013\317K\335\035\335\302\"\334{\331\252\273\023\347\2233\363\217\231\03307U n\316"
+	.ascii	"\177h\214\343N\346\236\343\300\241\367\336\005\374\033<!hIK7"
+	.ascii	"\371@\347M\n4\222]A\366\213y\325\331\3661\377J<P\220\340\356"
+	.ascii	"1\317R\332\262\354N?\354\304s_x\266\326\362i5\235\222*\251\276"
+	.ascii	"Zo\211\257&\367h\356`:\361\027\026\005\334!\027+d\360W\376\360"
+	.ascii	"\3516r\027\262\261eh\275;\007\274- \314MN\200\336l)m\214\231"
+	.ascii	"o\231\017\f\345\275\367\226\bn{\326\337\342y\215`!d\277\370\315"
+	.ascii	"\314\"~\004\203K\322\275\227\001s\206\033\321\300\202,B3\265"
+	.ascii	"T.\025+\353\3624'3\207\016\366\352\373\303\237\251\330\342H\324"
+	.ascii	":\266-k\266*W\220\375jk\\\312Z\322\355\253\271\220\032-\310\312"
+	.ascii	"\311\023\361W\276\2609\325\206`\022\206\274\271\217\225\007\301"
+	.ascii	"\237l\n\347=p+\020\234\222'\257\235\3149\327Q\233\242\001&\373"
+	.ascii	"\250s(\034\013\222m\317\021?7\036v&\240\340\344|\330\261I\210"
+	.ascii	"\261\215\314\315\346c\323Iqx\322\235\234\032\235\324\346\326"
+	.ascii	"\223\312\320\330\306ssK}l\266[\032[\357\273\307\301\243\305\037"
+	.ascii	"\307\240\026\202\265\217e\252\231\322\215\205\302\274\333\310"
+	.ascii	"\352}v\247\364\267R\fQp\234\026\316\005Y\341Y\026bD\242\222]"
+	.ascii	"'\377\034I\355\300\314\221\027h/>f\027\365\3532\333\307G\273"
+	.ascii	"\3072\265g\335X\026\346\266\215\330x\332\266VB\254!\313\344\001"
+	.ascii	"S\250a4&\235R23\221\244\n\223b\003\300\002\021\302\321\003\021"
+	.ascii	"\260`lL&h\212\013\351\247\bI}Q\373\265\f\226*,\223mC\211\034"
+	.ascii	"\177\214x\350(\256#mU\3309\220H!9A\340\017\033\370\202\224\344"
+	.ascii	"\357\003\215/\272\207\324\355HV\337\252\t\377\325\022\321aa\251"
+	.ascii	"\350D\215\337=\021\27418\363\204\324\275\2419\004P\002nu\225"
+	.ascii	"1\247\210\307\265iw\353n\211\336W\361\250\210\310\024\256^\036"
+	.ascii	"\253^\003\353\320i\324\304\214\366\026\216\327V{\267\031+\354"
+	.ascii	"\357Jz\276@\234`\271\331\016\016\243\343=\361\345k\325\311\026"
+	.ascii	"\025"
+	.text
+	.section	.gnu.lto_.symbol_nodes.79bbee40c1295468,"e",@progbits
+	.string	"(\265/\375 k%\003"
+	.string	"T\005g"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020\177\006\210\223\323\252\001\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\017\007\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f\b\201\204\001\r\t\001\021\177\n\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004\371\354\254\325\002\001\244\006"
+	.string	"\004"
+	.ascii	"F\020\002\2275\313`\f\201\202\002"
+	.text
+	.section	.gnu.lto_.refs.79bbee40c1295468,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.79bbee40c1295468,"e",@progbits
+	.string	"(\265/\375`\241\016\255N"
+	.string	"\n\214\220\036T@R:J\007\226\211\360\214\264\034\335\255UU\022\301\241xJ\350\210h\202\"\205\340j\314\236\250,\307\301\017\316\300c\303\215\237\b;\267Bn^\375\203f+\204U\2153w\270k\316\350\354,{b\377\211\271\357\3612\316!\301\223\351\213\013\256yC\2244)S\226\001\326\001\331\001<\230)cf\275X(\303\3323h6\rP\255\333\210\006\253\273\277WZ\270X\264\335a\275\026Yl\300\312\231\263\356\364\013\374Hh\313f\307L\350\3506\262@B\311\227\2209i\335\251\n\025*\212T"
+	.ascii	"\241`\203\2270$\312\263\222zV\241\236y\324o\234\372US\213\310"
+	.ascii	"\352\227K5\222\222F\2075\3121\003\006Y\0221\243\344\t\227_'\365"
+	.ascii	"\273\244\302X \365]'\324\213\345`B\035\261T\217\364\240\376\314"
+	.ascii	"\202\272`\033\266\307\024+\366\035`\332)7)\342\270\305\345g\324"
+	.ascii	"o\n\263\226Ln\n\3630\352\367\353\337,\273\265^\037t\247\335]"
+	.ascii	"Bh\314\020\t\227\273e\271\354\361\304vy\013\027\257\375\262t"
+	.ascii	"Vw\032\364S\247J\035:\\\236E\375v}(M\273\270P\375\23607\271'"
+	.ascii	"\314\026H_-C\346\260\230v\220I\005L\325\034.\317\325\266D&\357"
+	.ascii	"\220\211b\211\314r\207L\333\016\231,\226\310\206\177k\330\254"
+	.ascii	"\0245\241\017cwu\247B5\370\305+\213\313\247Kd\326\0352\377-\377"
+	.ascii	"\027\361/\377\367\372\217\374o\366_\207\177qx\360\377\354\337"
+	.ascii	"\332\277\373\357\316\377 \376w\371\337\346\337\377O\373\237\374"
+	.ascii	"\215\377&"
+	.string	"\n\370\371\350_\t\376\255\340_\032\377N\360\357\214\177#\370\227\202\177-X\026\377\312\370\327\201\355\340\277\355g#\377r\360\257\006\377f\360\357\005\377\226\370/\366/\317\277@\377\366\374[\377g\375\367\371O\346\177-\231L&\377\243\375\034\347\367i!/\273\366\006\242t\323\200\206Vg\b\003\032\341\362?\212>\225\356\237P\247=\024rY\375\204Z\322\020\205\322\256*\321\\IZ\230Z\021Kcs\247\275\035\264\"\206 L\215Caj\374\331:h\374u\247D\233\260\013\370[!\227\025Q\310e$\nu\260\177\315\005\254\252A#QX\306H\264\t\271\200Da\320\212(4\005\315\211Y\017\032\254\334,Q\030\354\037RT\300\241\r)L\215]\326\275];zx@7\225qX\006\234Z\261(\344\217\250/\240q\007\220\212\2722v\020)\214b\354\216\022\305\324R\f\374Rd\273\260\310_\022\252\366\261\243\233"
+	.string	"\251\356\3376\262\273\177\335\3153\244J\273W\260\t\261\244\244\272\213ERM\365\033\333\321\315]l\304\210B\256+#\322\330\026.\254\346\221\376\026\253\313\254\206\225\353\247\325>\272{\205\250XD!o\270\344\037\\%\353\t\231b\345\036\354c\217,\3652\2131\375\251\001\211\230\t\343\362kd\006\255\221\371s\n'\202R\"RI\270\374\031\005\026\226Kb\220\343\206K\346A\003\314k\f\227\257\245P\277\300\r;f\234\203u%\271El\035\240\235n+\"\260\310~\2440@\234iq\355\327\"\2132\254\320Y,^\206\330\344\346\260s\026\311\244,cv\366%\271`vl\221Ldd\245\235\261\016\216b \357\340\346 \377\366\270\311\035\342Kg\211\250i`\230\n\263\225u\376MWk\307\326\330\315\305\003D\315\017 u\352\212-\221I"
+	.string	"\237\325\264\242R\206\"<`AS\277Zk\312\210i\303f\f\031\037\342,\234=[ \326l\203X9+\304\276Y7{\\\264\375\341\213\303\222\235\323\356`\017ed\266|\030\243&EZ\351\317\007\355kH\225@O\325\232+:\270\374J\203<\300\036\326\210\341\362;C\3527\013\n\307p\245\315b\221\341\207)Le\221LdLA\263Y?\322\f\214\225\305\206\237ha+\234e\221E[\007\301\322\316\266X\013K)\343\302^\334\205\273\230\213\267\360q\217\254\205\253\234a`'A-\326\302Q|P\021\204V\003\227)[\t\345nLD\t)\270b\246\305[{\344,/J;\013\327\300\351\"\213i\007\361\361r\306&\310"
+	.string	"*~\336\250)3b\246X\200\276\322\026\204\340\222\257\360\024\247\310\350\200\223\265G\266\241\302\2412F\347n|px\341\352M}\331\246\276D\3034T\036\316\216\234\021S_\222\325\227`\365\345\261\276\324\252/\263\352\31710\326\016\327\030\2643X\353\305;\230\361\021E\245\2420\332!\223[`\027\370\205\277'\310\212\330\022/\254zf\202\301\013h\274\270,\367d&+9/\371{\230\f\024,\251&\365|\305I\376\036\240\262'G-._^\325\263\325\216W\022\255\b\227\\Uw\224CR"
+	.string	"p\004\f\211\021.\317UL\305\306\017J\224\220,B\016\227\314\002#9\033\371H\263\221\001c7\220\215ADt\003\203v\r\3305\240\264r\005\245\213Y\276\034\326\227-\221\371\263C\346\342\200t^\301\347L\2303,t\352y\310\304s\220\007\341\251-v\255\r\030\222bZ\027\213F;C\200G\272\210\234\247\376\026.n6\242;\253\273M"
+	.string	"\340\204\013\020(\\\036\016\017\371\337S\343aF\2542\204U\220\363\004\b\"\314#\b\312\024\343\021.\217,d\207\370!\"%l\rX=\377f\003\207\335\035d'\355a\324\bswv\215\376\237\255\355\001\177gZ\321;u9\364(\327[*"
+	.string	"\352\001\364\234@"
+	.ascii	"('\336\f\233\356D}P\033$\005\200\236i\005\316iHi\367\344\263"
+	.ascii	"\313\301\275\035_\322\b4i\207s\332\331\341\234jL(nw6\231g\t9"
+	.ascii	"_\351\363\235\275\245\245\033\017\224\023O\251\354\241N\265\245"
+	.ascii	"s\207\3135\335x\226N\337S\271\343\345P\245\323\307\363^\022\316"
+	.ascii	"i\305O"
+	.string	"\357\306\244TB\365P_\016w\332\020\340JI;\t\320\323w\332\3009\021])\327;w'\256\236\201\027\n\274\200A\002\317a\304`\021\203\205y\0301\220\220b\274@\252\177\201T;\223p\267&\tN\334\315\207\003\265\2419\234,\3209\331\360\371A\317D\342<\247\263w\204\362x\275#\237\336\251\313\335X:I\370\222p\271\034;\336\f\021N\bN\364fc\204m\307\313\371z\247\b;\032\272\021j\b\351F\250\261t*\355\240|;\034\247\357\t\b\365\365\236\0368}O?P=\364\324\235M\347\r!4\211\307\207\273\335\340\345\314&\236\022\017\345\365j\240=\236\223ow\353\335 \201\333\335@@s\017\240<&\037\004\247\357)H\204s\251v>5\3358@O_\216\034\031\234MK4\232nh\016\227[\"\261\313\351|\316&\024\345\365\230P\022n:\0374\351\005R]\332\335t:\236\322.\247\003"
+	.ascii	"M\202\201\356rO<GB\232\201\002\007\006\023T\245\025G8\247\243"
+	.ascii	"]\356\246;R\352\371\216V\020\241\273'\336\214\263\211W\243\307"
+	.ascii	"Cy: 1a\204|iB\3069L\231S\266\216_\376\205\303\024\031\177A P"
+	.ascii	"\244\315\342\244u\027\215|\\\230\022\022d\262s\030\035|fX!M\025"
+	.ascii	"\227\f\206\201\\\205!\035\252\365\272\212\323&l\313\330\230\227"
+	.ascii	"\036\240\2229[R\302\276G\016c\241\221\255\373\252\207X\017\213"
+	.ascii	"\t\354\210\301a\322\303\252~\253,\02797\331#\027a/\001\201\006"
+	.ascii	"\250\201,\207\2303FDdDdF\233\244\003\001\005\004)*!3\017\021"
+	.ascii	" \261\203j"
+	.string	"j4I*i7\376"
+	.string	"t\355wV\013\201)&<\320x\246\t\336yN"
+	.ascii	"\031\245\032\364\t\334]\227S\234j\035\3311\300\270\237\377k#"
+	.ascii	"\242Jv\250\257\212o\271-,\2179\364e:K\245,v&=\240\222\356!\327"
+	.ascii	"\257\272\005\266\030\020\223g\024\245e\"\004\347\357\246\264"
+	.ascii	"m*(\371\033)\330\362@w\350\177\344\202Y%Y\320\216\314\204=$\025"
+	.ascii	"J\341\343\"\352Fa7\002\261j6?\257\030>\244\\\f\235-\323\210r"
+	.ascii	"\202\234\210\313\311j\261\022\227\224\227\337\340\206\375\037"
+	.ascii	"\231Jim\220\305\340\206\023\376\303t\341\225oYa\300'z\0044\b"
+	.ascii	"n\271\221\247\2677\2354?\273c\304\021;\272\365F\005\2324\217"
+	.ascii	"\214;\320R\321\340\324\310XF\027\343bi>Q\230\2602\032\220-;\236"
+	.ascii	"\245\304\335\366\221\263sk\325\234?\250\370\355\337Z\262I\003"
+	.ascii	"\356\004\f\344\376b\247\023{\323\370\020d;\f%\240\212\251&L9"
+	.ascii	"\274\336\273\226\031ClR\3450\262k\030F\274\"R\027\327y\2549\310"
+	.ascii	"\3325\313\332\t\310T\304\376\342\275\232+\377|\325\333\314*\324"
+	.ascii	"f\311\200\254\217\036\255\230\254MN+\261\035\361\236\200\253"
+	.ascii	"\245u2sc\233\363tR3\355_j;\204>qn0x\231%d\354E\202\360\262a\317"
+	.ascii	"\207\201\212\266x5Z\004\225g^\367\216\265|\226\032\344E\220\033"
+	.ascii	"F\347GZ\323\035Y\243\200\254\353\242\336\250\n\207\306\321\024"
+	.ascii	"f/\263:qg\240\313&\352\305\246Z\033n\312\262\0324\201nhg}\364"
+	.ascii	"1\241\032\250\036\342\234\245&\024]Z\202\023\244\004G\360\373"
+	.ascii	"\"\203\206\007{Z\017-\301\tR\202C\320+\345\242_'\037>\260>\346"
+	.ascii	"\037Q`\326\217B\372\206C\245\001\366\024|\300\007\365\032\367"
+	.ascii	"\006!\354\2247\375\3177\t\022'q\\\032\367\361\363\352\345&\263"
+	.ascii	"1\323\204\022\320\355\016ke\343\376?\271\215\001=\031'x\001\254"
+	.ascii	"\203\313\245\001\"U"
+	.text
+	.section	.gnu.lto_.symtab.79bbee40c1295468,"e",@progbits
+	.string	"pgResetFn_motorConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"motorConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"motorConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.79bbee40c1295468,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
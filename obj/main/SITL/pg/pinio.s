@@ -0,0 +1,234 @@
+	.file	"pinio.c"
+	.section	.gnu.lto_.profile.b6908bdabbcceecb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b6908bdabbcceecb,"e",@progbits
+	.string	"(\265/\375 %\r\001"
+	.string	"\330\031"
+	.string	"\004"
+	.string	"\210\325\324[\001\210\265\327\242\005\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.b6908bdabbcceecb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.b6908bdabbcceecb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b6908bdabbcceecb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.b6908bdabbcceecb,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.b6908bdabbcceecb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.b6908bdabbcceecb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioConfig_Registry.12.b6908bdabbcceecb,"e",@progbits
+	.string	"(\265/\375 \231\205\004"
+	.string	"$\bi"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\206\200\200\374\342\203\255\277\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\355\006us\350\305\006uq"
+	.string	"\005\001\006'\001\b\005\001\006\035\001'\001\221\004?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/pinio.c"
+	.string	"\004"
+	.string	"\237\n\013&q\020u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pinioConfig.14.b6908bdabbcceecb,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\002\177\005\001'\007\002}?\202\210\200\020{y\274\001w\273\001"
+	.string	"\004\001\001\001\001\004"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.symbol_nodes.b6908bdabbcceecb,"e",@progbits
+	.string	"(\265/\375 C\375\001"
+	.string	"T\003?"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\016"
+	.string	"\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\f\001gistry"
+	.string	""
+	.string	"\005\t\002\201\204\001\n\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"W\005en\323\t"
+	.text
+	.section	.gnu.lto_.refs.b6908bdabbcceecb,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b6908bdabbcceecb,"e",@progbits
+	.string	"(\265/\375`\271\007\265,"
+	.string	"\252P\240\021G`\\N:\255@\373\335\214)\317.\2304\223N\302G\206B\272\212\200r\030\305DY\026*\372\237&\017\273\2456\364\230\2525\335\336+\376\301~\270\221"
+	.string	"\035\r\334\001\277\n\362*\377\226AS!\333\342\211D\211\2252\005\342"
+	.ascii	"\016\001\t\001M:m\376\027\225\257\234\313~\035\240WT\023Y\247"
+	.ascii	"\327\260\236\307\230\354\327\371\365\255\235\305\350\364\023"
+	.ascii	"\326\263\225"
+	.string	"\377:.\320`mu\312UV\247\007B:g\302\352\216tz\256\362s\313`,\226\342\336\246{\257\201\206\272z\336u\312S\230\312Y\214\303>\301\302\177Ja\327\353\336\313b\025~\334\273\304b>|\367.\37107`n\220r\001\321\272\242\246W\260\036\217\177\324\036\026\252\3545<K\3719\n\177\t\325\250g{\307\356\275>\2555\246\246\326\351[\376QW\026\252<,T\337\353\377\266\377n\377\341\240\377s~\316\362\363\317\317\007~\006\372\271\300\317\003~&\360\263\201\237\021<\370\277\367\263\200\237\203\354\340\177\360\357\f?7\370y\301\317A\377\343\376\247\377\325\376\377\242\321h\364\377\375y\352W\255\002iD\030!S\326iz\327jZKh\330\365\310)!\003\253\313)\213\346\345\350\224\351V'\266\023\002\300C\213\217\253N\317t?{1\232\026\321>7\235^\216\177T\236\033\236\317\354\260\201\301\223\322i"
+	.ascii	"N[\317[\314]g.l\306]\034\327`\355\324\211\265\032Tz7j\207\004"
+	.ascii	"\025\354\351\244\324)\\;\266#\325\004G\215\311\352\306ol\306"
+	.ascii	"ex\314\271\275w\214\302\027^\353\371\335\233\345\265\344\336"
+	.ascii	"{>\373\207e\230\215\333\202\230\356\315\342\341\223\305v\345"
+	.ascii	"L\357\336\01344\244\322\255icR\3236(\217\235\2276\t\031\2368"
+	.ascii	"[q\340tz\216\261\236\227\326\263\353y\355g/|\306j)\356\245\002"
+	.ascii	"\340m\216\354\254S\016\303il\226\200\305\264>i\325\030!J:=\322"
+	.ascii	"\372('P\031\314\360\214\266\341H\020\256N\177*\326\224\205*\003"
+	.ascii	"\376Q\317]\276\314\272\026\016be,\254\205\267\374::gPo;:=\207"
+	.ascii	"\365\234\005@\021\267$\001\375\242a8!\303_T\314\307{^g\270\r"
+	.ascii	"U\307h)\206>\203\267I\213\036^\234\177\330T\335\304P\206>7p\311"
+	.ascii	"U\265\216\316\321V}\243q\364\223\315\232\252\237\316y\314\346"
+	.ascii	"@\355\275MM\305\321fbh\221\016^sC@C>y]V\254\202)\353\275.\210"
+	.ascii	"\351)\304\227\035\336\275\355\377\216\352)6k\251\003I\265\214"
+	.ascii	"\266\301\320g{\247P\334Uy\351\335\333\016\035\030\342QSF\356"
+	.ascii	"JM\377\266\3215z\260\264D\326t\3324\200O+\265\027a\353\3373\330"
+	.ascii	"\254\241n\027\340\336\240\225\r\224.l^\267\203f\004\210\224\365"
+	.ascii	"\275\265\276\2218\255px<\330\206\254\357\254\365}\265\366m%6"
+	.ascii	"\023\352\245s\037\307y\316R{\333>\322G6\245\323\367\324z\026"
+	.ascii	"R\177\321(\013\251o\032k\220\177\324~\261\276\357\233\275\034"
+	.ascii	"*b\362"
+	.string	"\330\366~\350\357\t\352G+\240\337\306@1\361\255A\241\332\020X\2502\036\253\361\341\3422\244,I\314\245\207\340\212#\353L\"1\200\375\021\021RhT\262\370\300\036\235;J\025\235\343$\006`\211J$3G\211d\376\216X\244\362\210\244\262\304\013\303\365\330\"\351L\235\316c\323\310\250\bLb.\215i\223e\376\316\223\324d\235I\344q\004\201\033\331\037\025\370\222yl\026\261\313e\263h\207%b`\225I\026@\243\352$\362\260D \262Xb\231\314\371p\350\201\201\t\021 V#Q\021\222Y\244L\026W\024\031\233\316\"\242\037\243\243\022\231D*\002\215\216N\026\251r\231d\215G'\360E\266h\324$\"\231D=\315\342\2211E&U(\227\036\226Ie\222I<\262E$\346\212c\t\366\350<\216@2\021\004i\037h9\222\2105\020\216\213\200\025\346Ica\245\355\314i\225\375\226z\374\335\243}"
+	.string	"\005o\323\024\033\\n\324S\002w\335\241\315\350\024\356\007}Z\273wr\3475l\306r\275\003\b\254U\332\341\023\223\236\231\251\212\352\364\252m\002.\231\211Ks[\317_z\374\346\213\316\r\0344\001\200\211\250a4\310\024$3\"\"\"\201\210\264I:\200\002\221\251\252:\021\240\251c\204hhA\241\322\001f\261o}\263\244\377\230(\035T\200\362\227\325\022\022F9\302\0318\021\237DD\305!\3761\363\317\365\204\3223\021\214\217a\324MK\3537\302{\n[\f\355\321\n\001\253nz\032\360\207\320\261y\250\027\234\354\376\035\203\303\025q~\023\211}8r.q\351\37321Q_\306\212y\013\375a\372t\005"
+	.string	"a\306\275\265*\023\005\217\r\254\270_aB\006\031>@]\177\314\005\323\nc\320h"
+	.string	"\002\264Xo\3355\3035\253\023\2604\317\\\321\013\242\213\367\362\304\360\f9z|\355\226rB\267^\001\354e\327\353g\300\007\312E&sW\320f\222\033\fK\025\026I\002\253<_\223PP\211\322\212%\246\232\373'O\205\314\242f,\013\222\314C\255\004\200\246\344\346q\2647\020\370\254\007\360\247\342\033\271\365c\2319~\335\b\223\3103f\302\215\336\343\035"
+	.ascii	"\364\300\215\r\237\016\216'\373E\253\n\001\337U\336\247'\001"
+	.ascii	"\216\320n\317\230?"
+	.text
+	.section	.gnu.lto_.symtab.b6908bdabbcceecb,"e",@progbits
+	.string	"pgResetTemplate_pinioConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"pinioConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"pinioConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"pinioConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b6908bdabbcceecb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,220 @@
+	.file	"piniobox.c"
+	.section	.gnu.lto_.profile.200dcb88a054de55,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.200dcb88a054de55,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\340\032"
+	.string	"\004"
+	.string	"\252\353\260\366\b\001\343\355\351\305\017\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.200dcb88a054de55,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.200dcb88a054de55,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.200dcb88a054de55,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.200dcb88a054de55,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.200dcb88a054de55,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.200dcb88a054de55,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pinioBoxConfig_Registry.17.200dcb88a054de55,"e",@progbits
+	.string	"(\265/\375 \235\225\004"
+	.string	"D\bj"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\206\200\200\374\342\203\245\210\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\314\007us\337\006uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001\001\222$?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/pg/piniobox.c"
+	.string	"\004"
+	.ascii	"_\304\202Y<E\3357\200\""
+	.text
+	.section	.gnu.lto_.symbol_nodes.200dcb88a054de55,"e",@progbits
+	.string	"(\265/\375 C\375\001"
+	.string	"T\003?"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\023"
+	.string	"\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\021\001gistry"
+	.string	""
+	.string	"\005\016\002\201\204\001\017\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"W\005en\323\t"
+	.text
+	.section	.gnu.lto_.refs.200dcb88a054de55,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.200dcb88a054de55,"e",@progbits
+	.string	"(\265/\375`r\007\375+"
+	.string	"*P\214\021FpZN:\013\n3\035\254\3544\320\207\252rw:\"\344\204\3341\026\241\220\223\024\313\250f\177\274\333\\o\220\033\272\t\324\232L\220\334\201\372M\n\003h\330Ig\265#5%\277\004\257\371\"\236\231\221H~[)S\350"
+	.string	"\005\001\f\001)\253q\033\277\245\267\n\312BO\315h\321\243m\224\325\331\003\006\343\310\\\333\253i\033;\331\215\327\316\353!\374E7f\343\264\240\250{y\334\020>i\241*\363\273\367\022\211|\332`\3358k\217!}1\345\264v0d\273\302\276\310\264=\247\375\334\204W\206B\342^\347\275\267\200\017\037\225uH[>c4v\036\340'\177 \341\300'\264Kv\357*\364\211#\026\347M\333/H\317N\036\354r%\274\323\363\001\224\237|"
+	.string	"\025b \324\362\020e&\305\263\331\317d\\6D\261\266\326\253v\357\025V\b\322c\254\355W\006BS\036\242@\036\242?\013\370\231\300\317@?\017\177\026\376\034\340\347\001?\023\205\376\257\3719\370\263\017'\370\377\3637\204\237\021\374\034\364\263\201\377x\377\355\377\272\377\375|>\237\377\225~\006\362\243\"\002:\326"
+	.ascii	"\215\247\305*\252\355\373E\372\303CT\210\207h3\330\3432\3021"
+	.ascii	"8\037m|\036\300\266\264\265\265d\272\256\210\221\027c\202zD\326"
+	.ascii	"\316\304\344\264=\323\330h\313aR*~\016\001\270\361\226\203\253"
+	.ascii	"\3559\314\317q\254\227\342\371\307\246\355\365\030\be0\305s\036"
+	.ascii	"\217\335\\_\223\266=y\351\371\215\031\356\214\347d8~\353\263"
+	.ascii	"5k\351v5\346w\261\272\032\004\301\336\316\234\265\345-\314\205"
+	.ascii	"\273\374;;rVx]O\322\363\035\200\257.C\222\264m~\025\224\265\234"
+	.ascii	"\355\376\035\0352,\251\2655=\327q\226\177\007\370\227E\216E\333"
+	.ascii	"sXz\306\362\177G\305\230\035bm\371JJ\305@\206v\304\240\355\005"
+	.ascii	"i{\276\362\263\034Sa:\022\367J\265\025\327V\231\266<\307V\316"
+	.ascii	"t\\\3452]\004\035\367B1\235\020\316\275PBf\005\314\n\354\230"
+	.ascii	"W\0216\324\236{\244\357c 4\030W<O\351\"juum}x*<]fS<\332n\255"
+	.ascii	"D\035\250<0W\320\244\34725\314\306\214L\032\2771\r\325RJ\266"
+	.ascii	"pY\026\267\3415db\320d5U_\361\335\326\317\225z\363\353{\363\027"
+	.ascii	";\253\237\030\n\337mU\030\323\223\3215Z\253g4V\307h\032\354\354"
+	.ascii	"\254\236:\233\3413R\274v\026\303\351\313w_\027\310\302\020\021"
+	.ascii	"\211\204i\230\244\325\370\261\254\346{AQU\034\314\370\372\356"
+	.ascii	"]_4\fv\366\325\211\353\275jW\275\242\255\370nk\2751F\224\321"
+	.ascii	"\212\343w\357Jd\200\310\347\214\027=.\324\376m\325.\202n\353"
+	.ascii	"\0174m\273\205\316V\215\272)\271\364\357*v6\213\363\365\334\033"
+	.ascii	"\224\252\t\213S\363=\036+`^p\351\233-}\227uT\372\245\357\206"
+	.ascii	"\335\222\364\215$}\013I\371\217\343\260s\210\237g7\374\3469P"
+	.ascii	"\353];\310\337\232\023\257\364<\204\002\237O\036B\3378\322\037"
+	.ascii	"\006B\273\265\322wV\3723\23359N,i\354\3260\024`\225UNKe\206!"
+	.ascii	"\223Qm:\2018\002R\277Tt\034&%\2334\250\306&O\322D\3474\217z\324"
+	.ascii	"\243\344q\231\223<.\201K\3521i<\201\252G\023\212j\022\331\224"
+	.ascii	"\032S \233\266\33142\225\224\220t\234\226\312$\313T\227\300\373"
+	.ascii	"81\325&\362h\374P\340IJ\306\344\021y\002IG\311\330l\262I%RM2"
+	.ascii	"6u\216\244\")1\217\216\313\242 \023i)\311\036\031U\244\023K&"
+	.ascii	"c\b\325\3304~8.\021\250_2p\345\322\3104R\225J\246\021\217R\007"
+	.ascii	"5iL\"11\215K\236\346\321\021i\"\251\314\200B\211\341\307\252"
+	.ascii	"G\024\324$\262"
+	.string	"I\347\305b\006!\021\0366\244IE(\224%\224\310$rit\\\032%\221HLFI\314\246Q\021qGw\241\177Y\272\246Z\007\277\361H\2212e\244q\340\360C\305\300\236\224iq\375\315\325]\374s\245\274\276\340.\326V\003 \017\2523am\243\020w\362\324\320\256\332\036x\323\263\030\363\227s\037;\371K\333 \236\255O\3019\266\177\250a \247\220S\310\210\214\310\004\"3\323\344\001\200\002\t\306\312\350\001\021\220\251S\206J\244Mjt\371Y\367\350f\036YaE~\004]\376\264d\307$\370\001\031\f?E\355\354i-G\324\257\361\264p[#=6vcXO'\b\340\230#\236\007\255\017\204\254yKb\345&\016\362\220N\\\231\226\236dN\374\376\360\232\360\313m\007/\013\023\323O||\200\225\"~u\272\342\002`\352=\nX\271&\035\\J\215\337Z\204C\030\254\tn\330\243I\370T"
+	.string	"\3008j\246\200\352\201)]J\230E\276&v\304\262\036\367\226y\030\205$\211yo\334\346;\265\032\372\273(\232k=\235\242;N\277\037\0270V\037\210\2114\242M\\\212\341\314\252M\325t\236Rf\t\325\323\022\001\177\215!\262 \232sHb-\020\0346\n\304=\354\206\031'z\030\320\320Jx\341\037d|\314\013\020?\336\306\364a\342\310\201)|0\225u"
+	.ascii	"\374gj\022\020\b\222zT\340\230\337^|j"
+	.text
+	.section	.gnu.lto_.symtab.200dcb88a054de55,"e",@progbits
+	.string	"pgResetTemplate_pinioBoxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"pinioBoxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"pinioBoxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.200dcb88a054de55,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
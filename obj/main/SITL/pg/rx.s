@@ -0,0 +1,364 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.b4623dced79d8129,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b4623dced79d8129,"e",@progbits
+	.string	"(\265/\375 s\275\001"
+	.string	"t\002g"
+	.string	"\004"
+	.string	"\244\211\220\246\003&\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\001\001\215\332\260\263\003\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\006"
+	.ascii	"@\bp\007\"\003Q\3309\005\003,"
+	.text
+	.section	.gnu.lto_.ipa_sra.b4623dced79d8129,"e",@progbits
+	.string	"(\265/\375  \275"
+	.string	""
+	.string	"h\024"
+	.string	"\001"
+	.string	"\001\001\002\200\004"
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	")\202_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.b4623dced79d8129,"e",@progbits
+	.string	"(\265/\375 =\325\001"
+	.string	"4\0031"
+	.string	"\001"
+	.string	""
+	.string	"\033\200\200\200\230\002h\001"
+	.string	""
+	.string	"\002\030\200\200\200\200\003f"
+	.string	""
+	.string	"\030\200\200\200\340\002f\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b4623dced79d8129,"e",@progbits
+	.string	"(\265/\375 K\035\002"
+	.string	"\244\0035"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"\001"
+	.string	"\001\001\003\177\002"
+	.string	"\004\003'\001\206\by"
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	"\001\002\006w\001\001\006w\001\177\004\177"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\tAETR1234"
+	.string	"\002"
+	.string	"\340i\312"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_.pureconst.b4623dced79d8129,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b4623dced79d8129,"e",@progbits
+	.string	"(\265/\375 o\225\002"
+	.string	"\304\003c"
+	.string	"\001"
+	.string	"\001\002\005"
+	.string	"\003\002\005"
+	.string	"\001\200\003\200\003"
+	.string	""
+	.string	"\006"
+	.string	"\001"
+	.string	"\360"
+	.string	"\b\b"
+	.string	"\001"
+	.string	"\200\001\300\001\b\030\002\230\270\002\b0\002\006"
+	.string	"\002"
+	.string	"\001"
+	.string	"\220\001\0200"
+	.string	"\001"
+	.string	"\340\001\020 \b"
+	.ascii	"\226`Ze\016\034\213i\271J\207\232K\002\3346\320\006"
+	.text
+	.section	.gnu.lto_.lto.b4623dced79d8129,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxConfig_Registry.27.b4623dced79d8129,"e",@progbits
+	.string	"(\265/\375 \227]\004"
+	.string	"\304\007j"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\377\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\307\006us\345\005uq"
+	.string	"\005\001\006'\0010\005\001\006\035\001'\001\230\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/pg/rx.c"
+	.string	"\004"
+	.ascii	"\236\n\013f\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_rxConfig.28.b4623dced79d8129,"e",@progbits
+	.string	"(\265/\375`\225\002=\016"
+	.string	"\306WZE\360T\225\016\030\370\265,\307\237\225F\367\323R\257;\357\223\001\340\021Y<\266\2571\302\325\374E\271\203\265\b4\261\3263\2039\240V\347H\013xUD\253\330\375\350\031\344\304\377\325\352n\256\234}\022I\320\336)\005@"
+	.string	"D"
+	.string	"M"
+	.string	"\257\225\267\265N`\227\226\242\262{Bp\003\360\236\317\027\370\356\201\337|\367\\\332F\020\300\002\360\220\335^v7\2543^\236\226\376q<c\316\\\247&\024v\327\324\234\275\270\353m;\260\035\262\353'W\360\331+\276\203\264\204{\234\234\013\013|M\360s\260`\321\\\r\277\365\335\243(\270\0305\335\213\356\354\323E\253\f\373\230\335]W\232}\333O\017T\032\262\023\316n\327\305n\311\342\274\03664\266O\355\337\b\246A\272\027\035\254\272<\334\005\304\221,\b\361#"
+	.string	"D\274\245\216x\021\022'r\273]\342C\310O\364 \344"
+	.string	"\035\243\003\371\222\220\316\242\332\224\376\203d`\272\017z\342+\244\200\226\323U@\030\342S4,\357|6\212\243\250,D\305O\036\016\201>\021:|\270P!S2\231@\211\026V#\350\221g5\206\245T\2102\211N\341hT\205\236\215\305\024i\fS\210\342\030j\316=f+\315\030Vp\257\332\302\t(\255?\257$\203\201\334n\354\246\0060\366\240s\317\336\300\201>) \360\202\221\261\325\001rBo\312\300\306PF\007gp\273\200(L\340\022\205\001pI\bc\214{\314Y\030+C\027\362\212\013C"
+	.string	"3\0134\365\026\027hu\275\204)\270,\002Qqa"
+	.ascii	"\030a\004\372\262b\n\203\004\230\330\254G\314\363\260\314}\336"
+	.ascii	"\b\240\231\247\204\034^\264\207\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b4623dced79d8129,"e",@progbits
+	.string	"(\265/\375 k\005\003"
+	.string	"\364\004g"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\034\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\033\b\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\030\t\201\204\001\031\n\001\035\177\013\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004\204\013"
+	.string	"\005"
+	.ascii	"\\L\032\341^\\\326,\2031\004\n\n"
+	.text
+	.section	.gnu.lto_.refs.b4623dced79d8129,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.b4623dced79d8129,"e",@progbits
+	.string	"(\265/\375`A\022\305X"
+	.string	"\272\231\250!UP\220\252J\007\325h-\200\220"
+	.string	"\001 T\002"
+	.string	" SD\005\tF\272\020"
+	.string	"P\244!v\362\360'X\t0\325\351\244W:\177\232m\001\257-\016n`\317\017\003\r<\214\002\240\262c0\251\277\331A\f"
+	.ascii	"J\202\251?\020\207C3]D\254}*\257\375\237|)S\305\001\020\002\016"
+	.ascii	"\002\313*\377f\251\021\303B\271\245eK\033)S\276\242\376\232\235"
+	.ascii	"\245\002\202u\367\210r\354F~\253\376\225\372W\260`\250\245\262"
+	.ascii	"T.\226\272\243\224\334\201!A\252\351\322\325\215\034Z\340D\217"
+	.ascii	"\035Y\024\230\217\375\250\260\336\0202\025:\352\271\227\312\203"
+	.ascii	"\016`V\344\313\306\0336\267\207\332\367\353\337%\033\005BFtB"
+	.ascii	"v\024\002\252d\271bs\026\303Q\037\003\326\233m\352M2\365\346"
+	.ascii	"\223:\307d!\314\013C\330\274\271\244\3364\326\233\304z\030W="
+	.ascii	"\354L}\027\fL=\314\252\0366\245\036\326\244\036\206\244\036\006"
+	.ascii	"\244\036F\254\347\256z\336\252[f\315l\322\304\236\371\216Y/\217"
+	.ascii	"\005\221\215d\031\356Hy2\246~M\310`__kBv\336RyA\310\202\030J"
+	.ascii	"=\333P\027\314\206\331\344\320\212i\332f)\331xb\363,\244\222"
+	.ascii	"\320_;$;\367\250A\\\243\016\275\251%\260\324\023K\252\212\205"
+	.ascii	"\252.v\251\036\251>\312\006\365V\023\324saQ\257\334\020\262m"
+	.ascii	"\262N6Ibs\370\n\026\207\001\235tT7\222\366\323C\222\036\274\330"
+	.ascii	"|\003\365\373\344 \202\315\342B\365KB\266_KBv\256\327\332\020"
+	.ascii	"\262\022\313"
+	.string	"\r!;rC\310\352\202H\032\341_\022\377\312\3765\377\375\371\027\200\177\023\370\267\200\177\021\370\027\350\337\240\177\017\370\227\347\337\021\377~\370w\200\177i!\376\025\372\237\303\210\237\213\376\375\340\337\334\277\270\177o\377\242\377\032\375{\264\031\374\353\301\277\266\025\341\177\320\317_\376\235\361o\b\377\356\376E\372\027\202\377g\376=\361\257\003\377\256\370\227\201\177\027\370W\201\377>\377\277\374\207}}}}\375\267\363\233A?P\002\001B\303d7u\tYM\333H#\260\205\305\026ja\007K\f\205\306\246a2\330$4L\032\233:i\354\240\026\006\2114\204M\024\352\244\321M'\213MA\303d\261i\2304\362X.\3036:4\211QBEm\223\241\260m0=\005\211A\312!\262\330Z\335\033e\251\211\006t?\025\211Z\301\034k\245\244\264\241D%X\\dw\213`R\202*\266P94R\3546\242d\324L\017"
+	.string	"\221\312\016\262J\340\217\247\256\261\324-"
+	.ascii	"S7p[\331\335\300\356\236\021\237\220\335;\202\206G&\246n\247"
+	.ascii	"!\246~\002^-us\2244VM\303$T\261vE\225<\266\tH\340\036[\313H\254"
+	.ascii	"I`\223\256\321\335\013\247\036\233p\2741R\244\311P\316\0246\317"
+	.ascii	"E~\036\262U\230\210\007\335B\037!+\340\300b\223\217l\303\231"
+	.ascii	"\b\327\300D\036(v\007\231\b\315Nw\220\266[\300n\001\246\022\250"
+	.ascii	"\032\246\310\314\307\260*\317\202\220\355\222\332\231\006\332"
+	.ascii	"\230+q\206\314`\242\n\261TE\311@\202\206d\201\351\007\233?\013"
+	.ascii	"\t\002\033\326(\"\205bV'H\005a\023\310\320\354\210\327\2207l"
+	.ascii	">\266C\375\356\220\245\313\352j\251\352H\361\240&+\r\326\317"
+	.ascii	":\270\310=\330\004.\201m0\016\206\201}p\f<d#\363`\032\374\002"
+	.ascii	"\247\300M\374\203O\340\026\030\005~b\";1\013\354\002\337`&\256"
+	.ascii	"\3019x\007\253\300K\274\302&\031\212\201\347 +\235\221\335B."
+	.ascii	"]\330\274\371kp\256L!i\034\245\260\320\201\262Q\206Y[K\025F\013"
+	.ascii	"\233/K/_\026\013\311\232eU\235)LX\270T@\300\240V\032s\002\213"
+	.ascii	"e\227\032\235\355\252r\303\305\201\277\306P{\207\373\307\324"
+	.ascii	"\261\273k^R\216QW\274\230p-\225\225%\0244h\216^\332\254\026P"
+	.ascii	"\254\273\350\345\310\204L\032)+v\216S\177-N\025(r\266k\225N\020"
+	.ascii	"(\241\242\003C\355\232\325Z%\220\b\242\300\004^7\254\300u\245"
+	.ascii	"-\246#\314\205\344\203\222\230:Ok\334\270\341 \026\004uC\r\351"
+	.ascii	"\331Z\356\330\302j\363Mr\033\016b\nu\007\353X5\321\211\201\b"
+	.ascii	"\266$\321r\245~\223,K\235\251l\222\245x\rl\350\3247\034\bbE|"
+	.ascii	"b V\304H\233as\013\031<c\246\213\223\372\215\272\302WR[Y:\250"
+	.ascii	"Yja.8`-\261\260UT\232e\031\366\302Y\253t\nj\241\225\256\245\227"
+	.ascii	"2\234E\353\f\253\3414\254\305d\330\f\243\331$\227\341.\347*l"
+	.ascii	"\345C\2652\274\003\232%\215k\t\224\034A\346\225\257\031\2414"
+	.ascii	"\264@\212\315\222\007\036\263I\316\372\0202\213\277\260r\225"
+	.ascii	"N\310\276\321Se\351\025%b\201\2377d\264x\310\224X@T\2201\300"
+	.ascii	"a\223\305\314\234r|)\301\bf\223\034\246\306Ar\345\3655=[\204"
+	.ascii	"@\371\250\237\351\250\237\325\340-\265\314\262\205\331R\375,"
+	.ascii	"X/\363\252"
+	.string	"\227\311\251\227\261\251\227\241\251?_Y%\275p\211\261\3421aj(\225\251|\"\nO\341\252\237\207\246\304\n\206\2520\365,\005\003!XUl\232\373,2\246:C\371y\370K\rG&.\365\234\344\034~\036 \255!R\232X\325\363\223X\325\027\227\0166\331I]\22291\361\241\005+>x\260yv\362s\223\235\022\341\353\316\0346\177\026\204\214\247jgd\217\030-\313)6}d\307z\276\201q8\037\371\021\216\252\310Na\245(\337tu\265\223\323\211\212\203\216\226\224%\347\250\263\361\351\021<84\035\207l>\016+\371\3173c\002E\211QI\022\230\023\031+\"@\314c\226#a\330L2\022\006\372\024\265\270\264\330\274\214F\345_\326Abw\337\210!\233\250\344\363\215\355\317\302\326\200\377f\367?B\202n \226\222\253\026\271\022\344\361\022\375\230\262[h\004F`l\022\032s\f\223\306\006\n\207"
+	.ascii	"\205\210m\004\016\223\335B-\024\002%(v7B\221\224\246HJo\032\240"
+	.ascii	"\275\324\306\243\315\340\355`\374 \241\276\336\214\rN\232\357"
+	.ascii	"F(p\274\233\356\327\243+\342X\357\364\361\235:\034/\246\303\361"
+	.ascii	"`F>\234\016=\222\241\"\344zf\257\207\246DD\266\331\f\336\356"
+	.ascii	"f\246>\036\214\b\325\341rG\266\031\021\332\373\2317\2647{z\342"
+	.ascii	"x(~f\244\276^\016\207j \364\333\251\243@\003\034\017\200\337"
+	.ascii	"r)\252Cq\365\017\264h\240\205\213\244\331]\274P\361B\205\354"
+	.ascii	".^\324j/Z\324\352[\324`\251\315\350f\372n\004\342;\036\232\246"
+	.ascii	"\360\355vi\212\236T\327;\223\322\263\250\227\336h\275\023\227"
+	.ascii	"+\322\355`$\245\037x6\244[\032KQ\242\234\214]\312#B\223\322#"
+	.ascii	"[.E{BI\350\021\357'A\321\221\315\350\003J\224KST\306\356\324"
+	.ascii	"\345J\370\316\031\316\306\301.w\342~G\274!!\037\332CS\"].\306"
+	.ascii	"\351\263\365N\244_\352\003\001\345\365\006\360A\217l\267\017"
+	.ascii	"\276\024\225\241\313\335R\242\034RL\227C\252 \334P\243[\222\r"
+	.ascii	"\251\322z0\216l2t\273\234\317v\264\343\245\250Ow\301-\r@\227"
+	.ascii	"\363\235-j\365\206\366~gR\332s\204\352t6\243\333\231\364\263"
+	.ascii	"\235I6$Z/\335\245)\032B\346C{EE\273\036!\021EE;\337\357F@/\227"
+	.ascii	"d;q\277\030(\221\357\307\323\345\002@y3|'*#\347\263\311\310\245"
+	.ascii	"(\321"
+	.string	"\210t\347\273\331\212\316\235\357g;q\272\234\221o\267C\352\235\267t\210h\227KQ\336Y\304;:Q$[Zt\336\322\336\231\353\365R\021D\271\323\227\323\375~V\034%\245=\232\357t\341\323\345~\263\327j0Jt\200A\005\365\206\")M\201\343\245\320\345lH)ni/\005\n"
+	.string	"|=[\321I\364\263\3058{\277\030= ;t\320L}\315\361\212\352!D\002\007\016\323Y'\235\302\020V\177\325\351\352v:\361\243%\211\t6t\235\351pWqJ\b\233\034\207\3470\371\230\341\006\317\221\263D\005\030f@\322x\256\002\201Y\250qD\305\0243#\"#\"2\222$\351Q\005\3040\307$\253\036\022\200d5W1\250\246f\232T\266\366\317\022+"
+	.string	"\213\234}"
+	.ascii	"\350\347S2\324\250\260*\207\232d,a<(\203\353\364\272\201V\f\224"
+	.ascii	"\317\302\tBr\202\304{*g\262zT\247\262\254@f2\020\003\240\210"
+	.ascii	"\222\312G\373q\241\341?\033=\226\006\021\304\242p\245sM\207S"
+	.ascii	"p\333\026'N|\007\ndY\215\036\344@\215\006"
+	.string	"\330\260\033\377~N\017\376&\234\032f+\0355$xY\2015e@%i\271\301\201ry!?\271J+\036\330$\210\204\305(\204\234\200\177\370\302F\t\310k\214\2614gh\221\306`\364\2733\177J\365\230\243\301(%\267\311\027A\020\311\031\266O\374{\f\214\\y\037urI\021FZ\217\330\203\333\343\230\016\225\t\304S\370[\317b\002\243^\252\006f\214\371\244\022:\024\240jy\370&\237\361r\\\212O\320n\r\377\007\202\231.\323\177\033\223JS\3605\017z\232*+M\367\034\3235|.\265=\233\n\031\310Q\347P\004'>\213c\203\275\350`v{\356\227\027\213\234$\232\327\261\035\353\311\305\324\260e\214\342\210\242\277\025*\277\n=\310\004R\260\016\211\020\214,j\330\303\267\201/j\310ENF\211\230%\331\231\356$% \254\002\263\275\227\035\204C\257\004\363)\314\231\337\203_\300\317\375\267nT"
+	.ascii	"\313\356\b\254\320\326\314\356\030\264\232\244\254\324\324\022"
+	.ascii	"PF\320\t\330U\250\245y`\211\035+\033\242\377\234\252Z\022\322"
+	.ascii	"\246\353\211Ogj\n\352:#\243\222\233\345pgd\226w\222l\364\376"
+	.ascii	"[r\t\035n\371|\311\324\006\240\241U\313\350\342\355T[T\347 F"
+	.ascii	"\357c.\b[\261p\241\030\021(\354\2324y\365\313W\031q\016\350N"
+	.ascii	"CD\177\020\342QSM\311\207\321\343a,V\255\361\370l\252\271\226"
+	.ascii	"!]6\326 Q\240\2116x\367\374\254\243E\255n\330\300K\343BK\374"
+	.ascii	"\007\022n\2145R\"rU\233\374q\201\204\252\322\247*l\017\002\016"
+	.ascii	"9c\f\025\210\366\275\f\350l&\224\221\2469\333\322\037+\030-\327"
+	.ascii	"\335\\\027b\334\273Fk\222\253\361\332\b\017\363\302tX\354\363"
+	.ascii	"\337\201cXg\020\0350\004\362r\200^\312\362*@\rq\035>\275\021"
+	.ascii	"\323 m\n\021\241\322\236\0022\017\373\261\321\256o\331,\027\271"
+	.ascii	"j\202}MR\3021\334\024\350\037\202m\036\004\253R\r\210\337\341"
+	.ascii	"[\333\363\256{\204\234\202\005l=\001\335\032m\245\n"
+	.text
+	.section	.gnu.lto_.symtab.b4623dced79d8129,"e",@progbits
+	.string	"pgResetFn_rxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"rxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b4623dced79d8129,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
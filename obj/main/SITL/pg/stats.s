@@ -0,0 +1,245 @@
+	.file	"stats.c"
+	.section	.gnu.lto_.profile.6e1ef1bd59b2f515,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6e1ef1bd59b2f515,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\340\032"
+	.string	"\004"
+	.string	"\200\206\326\211\013\001\251\307\351\314\r\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.6e1ef1bd59b2f515,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.6e1ef1bd59b2f515,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6e1ef1bd59b2f515,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.6e1ef1bd59b2f515,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.6e1ef1bd59b2f515,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.6e1ef1bd59b2f515,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statsConfig_Registry.12.6e1ef1bd59b2f515,"e",@progbits
+	.string	"(\265/\375 \231\205\004"
+	.string	"$\bi"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\206\200\200\374\342\203\237\277\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\355\006us\350\305\006uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\001\243$?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/stats.c"
+	.string	"\004"
+	.string	"\237\n\013&q\020u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_statsConfig.14.6e1ef1bd59b2f515,"e",@progbits
+	.string	"(\265/\375 +Y\001"
+	.string	"\036"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006(\001"
+	.string	"?\202\210\200 \177}\274\001{\274\001y\274\001w\273\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6e1ef1bd59b2f515,"e",@progbits
+	.string	"(\265/\375 C\375\001"
+	.string	"T\003?"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\016"
+	.string	"\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\f\001gistry"
+	.string	""
+	.string	"\005\t\002\201\204\001\n\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"W\005en\323\t"
+	.text
+	.section	.gnu.lto_.refs.6e1ef1bd59b2f515,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6e1ef1bd59b2f515,"e",@progbits
+	.string	"(\265/\375`\375\007U."
+	.string	"JTH\022E`^N:w\302y\361\2306\347\224\035\331\3165\311\207\035\270\300T,\317\346\251KyV\226/I\316\250\r]m\325\264\230\365\005?\202K&\2354\222\0302r\206"
+	.string	"R\350\310\335\306\246\3457\257I\244\266\2252\005\353"
+	.string	"\022\001\033\001\347."
+	.string	"\210\2609\322\244m\363\307\234\254\345\274\345\377\371\314\272\266\326\332\276\002zV\343\265\377\327\303C#\346E\333G\241\347,\377\177)\350~Di\313XP\026\f\226~sU\352\214\264=c\371ye4N+q\357\326\275\267@s}-\351\264e+|\345\234\306U\036%\341=\025U\256\331\275\227\323\"\370\2707\213\323\200w\367f\001\231\0270/\260R\200$\321r\332'@o\307\301\223\210\215N6\203:S\371y\n\237\031\235]\313\365\252\335{\201\235D\315\315\255\355W\016\236(\033\235Clt\276\321\377r\377\337\374w\363?\356\377\334\177\240\237\333~6\360s\322\317H?\037\370\231\300\317G?#\370Y\301\322\177\274\237\203?\017`\007\377\213\376\316\360s\203\237\031\374\254\364\237\356\277\375\357\366\277\327l6\233\377\357\317l\377)\026hv\200\2664\361\354h\313uP\026M\266\004"
+	.ascii	"\214M\354\253\355\271\316\317fl\207\242\211\267\247\355\3458"
+	.ascii	"x\362\034\2503\235\24072vT\332\nEa.;\177a&\2271\235E[o\214P\243"
+	.ascii	"q\307\347v\365x\340s\302\274R\326vn=\262pp\336\326\354\320\363"
+	.ascii	"\230(\t\034\307p\354\206\341\226\026\244\234\331Ax+\213\303p"
+	.ascii	"\370\r\3131\223\343X\315\031\f\207\271]\357\345r\357=\237\225"
+	.ascii	"a4D\277{\307\246(\271w\205:\307q\032F\203\364\342\336\2610\240"
+	.ascii	"\026\032\2662>\367\256MMGMM@F\302\366\204\001\260\274\206\331"
+	.ascii	"03\211\333\f\345E\311\373\323\366\234\206\236\223Nnr\322y~\202"
+	.ascii	"\236\213\240g/\364\234\205\262\031>\303L&v;\223\341\266\377\266"
+	.ascii	"\326{\345\336\025\370\203s\007L\255\355\261\3203\323\tl6\233"
+	.ascii	"Mf:O\205*q\360\264p\034<\317b~\034\273\022\316\001\345\313\301"
+	.ascii	"\263\210\013\263\261\227\377\367\023\303\325\246G\333_@\003m"
+	.ascii	"\337\013C\317g|\307ygr\300p\223\356E\307p\242\3462\236\331\034"
+	.ascii	"\377Y\266\214\366b\270e\321\335b\343c\327Y\275l\027r<:\254\301"
+	.ascii	"\372\253u\364\216\356\301\314^6\327\271\017\373\331j\353eku\013"
+	.ascii	"\206#\202\301,\016"
+	.string	"\020OY\026\035E\226\357^\207\244\345\242\303\331\034\273\306\3219\230\331^?Z\357U\203\360Cy\365\214\276\301p\313\365\332 A\207\007\023\003MCv\334\310}\235\366\357\033m\203\210\313:\344N\333\256\341[\352p[\221\207\376M\203\231\335\3659B\367\"\241y\240\200\311\363\272\24062 \177\320w\036\364-\007\003}c\007\366\306\006}\277\241\3576\264\267z\0053\227\232\305[Eg\035(k\275k\033\301[\263\302\206\236\227\316^\263\311K\347{\r-\342\340\331h\350\333\f\3759\017\017\350\312\031<ox\354\246\347\202\313\307\032\240\333\244\341\322j\373\206\202*\261\321\331Lyx\017P\312\027![\364x S\263\245\255\305\323nI\224\310\270C$\207d-X\310\243\206\242\253TUb\201\020\276\312\211\2104\2222\236\330\240\246\312 #U\003)\205B\252\320HD\002\031\211\310^\225J4\246V\247*\234"
+	.ascii	"\225\242(*\255R\231&\247\246\206>,\344Q\312&Ud\357CXIUY$\246"
+	.ascii	"\037\006\\J}\025\201\037\221i\362I=\036\223OA\252\220\202o*\265"
+	.ascii	"214\246B\341\220R\255\"\026\255\250\214\224\302\364\252\250\252"
+	.ascii	"\302(\b\252\261x\002\275\022\252\312\342\224\320j\250\036U\241"
+	.ascii	"\200CAiP\022\341\201\003*\345\364DD>\031\213\303\253'\251\244"
+	.ascii	"\362\311)8\225\032\211E\253\241o*U\236\260\306cQ\225J\225\276"
+	.ascii	"\017\325\341TRHD:\021%\207UR\226X\2442\0365(\325\241\252\024"
+	.ascii	"\246\352\320\ny\225\206PSe\372\201\210D@\244\201\364\322f\244"
+	.ascii	"\351\351!L\267`\016\231X\007\tbF\b\311]\233\222\263\261\277\307"
+	.ascii	"\032\bS\321\335jC\343\313\355Z>8\353\306\330 k;\027D\267d\211"
+	.ascii	"g\244\356\314\207\231\\\327>\216\320V\025Awg}\313\276<i+\266"
+	.ascii	"n\371\262\342\340\230\t\200\215\250\2010\247\020ChDDFD\244I\222"
+	.ascii	"\016p\002\t\310\250\350\006\021\200)d\206Fh\222T:\026\2313B,"
+	.ascii	"\360d\235\365\2619o\215\222\361\247\220\246P\254SC\006(\004\020"
+	.ascii	"\222\021\251)\3579\225\315?`\2144D\263p;\037\036\333SV\306\300"
+	.ascii	"\324\215%6/\201\001?\207L\202\334\224H`-/\265BG\037\226\204:"
+	.ascii	"\013fZ\033\232\253\334D\302\206N\260{\360\234Z\316]\243\257\364"
+	.ascii	"\247\227\305\254\326p;\311in``V\361\276/\354#\246[O\212\344_"
+	.ascii	"\231\250l\370\357$\017\270\347#z\202\3500\200\2016\301\020\013"
+	.ascii	"\271\333\340\241?\355e\0212\251\361\267n\0246\240 \232\337-$"
+	.ascii	"M\334\342\201\3024\027z$;_\317\351\304ZG\016\202\204?$\331[3"
+	.ascii	"\034phth#\213`s\211B\034,\324\304I\201'\fq\251\236!P+\304?\240"
+	.ascii	"\243\314\323\320\316\333\300\264c\001\005G'\3103\275jD\022,\300"
+	.ascii	"\371\345\333ye\276\\\232\235\374\347\313\034=\304^\271\221,\355"
+	.ascii	"\233\202\b\024HD\364B\226\026-U \210}\246=]\310\036\f\177"
+	.text
+	.section	.gnu.lto_.symtab.6e1ef1bd59b2f515,"e",@progbits
+	.string	"pgResetTemplate_statsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"statsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"statsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"statsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6e1ef1bd59b2f515,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,274 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.cb64eaa4656a1dcb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cb64eaa4656a1dcb,"e",@progbits
+	.string	"(\265/\375 b\275\002"
+	.string	"\304\004V"
+	.string	"\006"
+	.string	"\332\205\333\362\001\002\002"
+	.string	"\002\001\001\240\342\234\212\n\002\237\275\226\271\002\004\002\003\352\263\360\321\b\004\376\314\317\334\f\b\002\003\002\003\002"
+	.string	"\002\001\002\002\002\005\277\257\241\307\t\b\002\004\002\005\002"
+	.string	"\002\005\002\006\002\005\002\007\002\005"
+	.string	"\003"
+	.ascii	"w\202\t\362\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.cb64eaa4656a1dcb,"e",@progbits
+	.string	"(\265/\375 6\025\001"
+	.string	"\230*"
+	.string	"\004"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\002\001\003\004\002\001\005\001"
+	.string	"\005"
+	.string	"@\025\034\024\r\227\0303\203\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.cb64eaa4656a1dcb,"e",@progbits
+	.string	"(\265/\375 \306\305\003"
+	.string	"\202\306\024\036\240'\351\317\371\244\300\263\370\027w-\276\273Q<\033\002\377\377\367A\341\377\023\261do\271S\377\367\256\n^\025\373\266\356l>\215\307%\013\242\020\372\007\216S,\2102\030\177u\213Dr@\275a`\024\316\305{\025\340S\357G5\263m53\323<\216\b\016"
+	.ascii	"7C\2030.AW\304\322p5\220\224\013\030\215\352$V\261^\005v\223"
+	.ascii	"\036\313e5[\203\001\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cb64eaa4656a1dcb,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\002\001\001\f"
+	.string	"\002\n\177\002\b\002\001\001"
+	.string	""
+	.string	"\002\005\004\002\001\001\017\177\002\003\177\002\t\005\013\177\002\005"
+	.string	"\002"
+	.ascii	"\0035\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.cb64eaa4656a1dcb,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\004\231\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cb64eaa4656a1dcb,"e",@progbits
+	.string	"(\265/\375 \274e\003"
+	.string	"\342\004\017\030\2405\351\017.\357\274\252:\352\377\377\377\337P\3646#t\315\332\266R\246\317\303SupH\277\217\307jv`\262\352\233\344\323\307\322\n\233\001\220\224\246Qv\232\362\242\374\211k\247\225\023"
+	.ascii	"H\t\300TN\213\035h\f\246D\227\223\255\262\377\312\202RV\251*"
+	.ascii	"\361\025\201T\001vs\201\272\252\205og\314f;`Y\030\264\001"
+	.text
+	.section	.gnu.lto_.lto.cb64eaa4656a1dcb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxMspReadRawRC.20.cb64eaa4656a1dcb,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"}\t"
+	.string	"\346\022C90\305*\035\210\343\302@\364dy\346"
+	.string	"\253VJ\ro\354\326\020\016\240E\371cd\221\241\256[R\016\230S\260c\004~0Q\213\346h\022`\343\301\305 \301]\355\336[\246\0242"
+	.string	"3"
+	.string	"."
+	.string	"\357\350\354\351\347\252\330\210\250`\263\335oZ~\231\\\352\013&\227\020\343\336\325\363\017r\f\214d\305:]\003\032v\327\272bY\334\360\2661\266\027l\323\002\227\330.E-\300\226H\231\206\355\316\256\330\216jk\024\272\277\"n\331\024"
+	.string	"\227F\325\276\307?\272\177\022'\330m\315Fv\277\004#P.\375Ql\373\034\001\224\335e\360a\017\201\3603.M*\351W\227~ir\031\241\200L\341\341U4\224\326\354\357\244\360\302~\\\330\262\255\216\177\375\032\325\227\225\215!\316C'z8\016\347\340\001}\270Pic\332\006\334\311\214H\240i\332f\350\303\001\315\316F\232\031\003\213F\236mr\"\3216+\337>.l\031\036\240`\312\266'\036\363\002\f"
+	.ascii	"<\241\005(\306\013/J\020\224k\370p\026/\307\204\006s\005*\034"
+	.ascii	"\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_rxMspFrameReceive.21.cb64eaa4656a1dcb,"e",@progbits
+	.string	"(\265/\375`\250\002}\024"
+	.string	"\246\246\204H\320\356*\035Z!A:\0327\324\003\207\n1\231Af\343\230j\215g\321D7R\254M\256\222\374\207Uc\356\033MpT\236\357\306\233\255\313+\270\302\013\256e\207\234i\340E\337`t\301\303\037/\235\321\b\"\233\310\235Rq"
+	.string	"l"
+	.string	"l"
+	.string	"\273\267\237\240\335\035\211\007\214\237\336=D\374\034\017@\3744\314f!`\246a\364\322C\332]\224V\020\375\361pw\207\n{I\234c\250\022\346\363\356\241sy\211\303\366\3423\223\242\tg\346s\234\371\030\226f1\031\256B\002\205\320$\t(\364\236K\030\233L\20682\327\367<DGV\364c\223\271,!\330]\313\232m\302\235q\3339\266\017\330\222Czc\357\\\244\211\205$\240\365fw\\\367sl\234\3477\335w\213\357\3353\224\016/\255*-U\372\036\020^|\001\200vc\20206\305\024\322p\337\337\363\021\311\330\265i\261\341 \374\236\236\207\302\365Q\220\373\001ww\344\323\006\306Oy\262-w\377"
+	.ascii	";\217\207\234\261k\203\"hwIL`\374\024\t/\355\347\276\003\273"
+	.ascii	"\256\345\036\001\037\365\346SM;T\177r\344Sal\333\244S\257\343"
+	.ascii	"\235\210 \223\036\356\356\206.\360\251\035z\242\021\321jB\265"
+	.ascii	"\275r\240\027\210\321\356\232\370\">\202\345\343>\375\300%_s"
+	.ascii	"\211\237rE\315EL\006\355\207`y\2158\277E\017C\023S\016U=\255"
+	.ascii	"\203\274M\210W\251\247\345\310"
+	.string	"d\320S\2579\035^\221/FL\006U}D3\233\006\251\257\254^\254\004\016RV\253\023\006(\032)\252\223\326\202i\224\022\025\227\n\305\322B\255R'*\024J\313\205*\0011K%\245\205Za\261Z\250\323n\2577\243v/\2001\225\371O\211~\211\023\245|\234\033\250T\342\347y\227\270\035\244\243\230\f\226\364\306'\232\271\241\372\033M*~\334C\242\250\362\002\357'\212\272\241\247\231 \255F\366\022m\267.D\002C\316\303\321\324\033\0075 \220\002\23122\017\242\300\002\217\360\250\035\007\230U\245\255n\025\0016;\242\360D\265\032;\346\001\022\253%,q\342t\240\334\313\212\346-A\233=F\322\002\202X\016\231i\250q\323\306xi\b\264\204vk9,Q\252\006t\203\341\202v\022 \221P\205\0330\2406~:l\320\204\300\262\245\005\327\223\200y\341\306\204$\224\215V\233\341u\260\241\321\364\004x"
+	.ascii	"P6]\364\t"
+	.text
+	.section	.gnu.lto_rxMspFrameStatus.22.cb64eaa4656a1dcb,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"\005\013"
+	.string	"F\325M? O\225\016\303\322@R\240&\003\340\207K\024\211,\304f\004"
+	.string	"'X\241\226\374\024\307\270\206\276\272YL\371^N2\370\242\234_ m\t\004\320*H\213\305\353"
+	.string	"\215T\n@\350\223M\244L)<"
+	.string	"8"
+	.string	";"
+	.string	"\366\016\302T\017b\240:\\\354\202\233r\270\367L\323\363I\317\032\260\302\324\267\272f\bZ'V\222\317\224M>6\254x\354i\341;eB*\273\353L}\027\356x\333\016l+\260\177 NM_S\026\312\243@\270\253\na,\212h\302\203\355\333\036\331\022\333\231\366C<ct\215\t\027\260\353RAb\027L`\003\221G\203\237h\217\221\017\320\036m{\001\203Q\231\2768\336\0217<@\260\310\022->4\250E\332U\002G\212S\276\260\277q\021\"\277\203?\240|\352\321\007i\217\327\307\236\030*\300Z\031\254R\2066HJ}\331\317vw\255\256\230\316\322E\300h2\335\346\003!\304\005\360\205\322\361h\266\020\267m2\026\315v\341<\033\205\2009\035\f\267u\034\016\267I\300\275\272\f1\251P#\364\367\264\307\016 \303\007\215\364=-\225\202\272RRS\016"
+	.string	"o\b8\252\343,\026\n\035vHe\b,\266\025\177@\020\211\020\265\206"
+	.ascii	"\271\214\276I\005#U94\227\332\003"
+	.text
+	.section	.gnu.lto_rxMspInit.23.cb64eaa4656a1dcb,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\005\013"
+	.string	"\266\323JC\020\251j:\307u\304J \004\232\004\357\212\024{\301>\013.b\256\263\330\316;\f\301"
+	.string	"\026\304\201(4\227\226\317\272dP\0364\222\260"
+	.string	",\006\b\245$\fQ1\0073\020Q\2102.!\267\261\021\331)\0052"
+	.string	"6"
+	.string	"<"
+	.string	"\3357\247\327p\337\2727p\337l\332\020\236\252\354Y\350\b\002\331\356zZ\312\315W\323\277\201cN\224\351\365b\261\273\256'*uk\267\275\261]a\177#vj\252\032\212}\313\356\256\265\225\375\364\257\027\256\301\203\007\007\273$3\t\013\333\030"
+	.string	"\260\375\214\355\232\226&H\274\332\037p\002\346\013\204|aw\325Z\260\233Nx\023\n>(\372:U`\007Dl\367\364\323\016\337\022\237B]\247\352%&'9\333\343\tHL"
+	.string	"\227\214\341#\316\026\375\300\250\333]\n\237\005\362\241\211\255\224\270o\230\023\227\200\b\247:\013_\331)5\276\020,A\242\f\322\250\360\0019@\342\005i\354\354\341\204\310\320#\215\036\b\354\204\236g$=\216\203\305\3207z\245(\216^&\335[V[\031\343\005;i\"v\307\023\361=\024"
+	.ascii	"2\241[/0.$@\020\250T#\030\2412\225p\251\200&\225\331\323k\237"
+	.ascii	"\331\245\006\273\342\032\305\n\343\201j\340\n\230\033\240\242"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cb64eaa4656a1dcb,"e",@progbits
+	.string	"(\265/\375 {\235\002"
+	.string	"\202\304\020\035\260%\351\270%\216\035\210\020\210d\002\315\006Ub\030\212`\340!\204\220co\255\265MR\377\227m\f\331\375\227m\2062\020,T\n%\\'\274A\212\016\361\027\315\004,\217\037H\314\320\266\007\323\375\037\001\004"
+	.ascii	"]\217G\0021 \3034\265*\003"
+	.text
+	.section	.gnu.lto_.refs.cb64eaa4656a1dcb,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	"\001\003\003"
+	.string	"\003\004\001\001\005"
+	.string	"\001\001\t"
+	.string	"\001\003\r"
+	.string	"\002\005\002"
+	.string	"\003"
+	.string	"\002\002\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.cb64eaa4656a1dcb,"e",@progbits
+	.string	"(\265/\375`\035\026\345d"
+	.ascii	"\272\245\304$SP\216J\3525\313\2562&\341('\n'\f\b}\235\343&O>"
+	.ascii	"\216\370\225\371\326|\267\363y\341\347\224;@\037~C\263\033VN"
+	.ascii	"\267\327\264W:d"
+	.string	"#\032\303t\220\207\236\206\374xQ\341\bc\310.\f\314\207\360\306d\252\306X\262z\177H\333d\357\224R\017\0024\0025\002^\266>QA2\222\342\242\314\204\321\222\202\311x\2315\234\252\250\333\024\t\2315\233+H^I\264\3665\251\356\215)\345W\037\343i\016\345\340j\252\361I\246\312y[\362\3466\004\267s`}\352\034\330.\343b\\+\313\021\210\230&\323}\211~-=\341\035\307\300\372\027\0335\023\240\206\374\332\236\304f^t\313)`\264\\h\367\322Y\330\312\nM\351\327.\343e\335]\243R\341\022\243\244\254KO\231R\232\223\235B\341\005\025~\205:\231\217ug\037\227v}\345_;\004\334BQ.\356\224\244\t\217_}\313#i\214\035\375\332\033`\207zX\367\003#\\\013N\316\033\3260_S4\277z\013~\305\241?\216\245=\213\203u\r\322\231\2378G\033Yb\277v\360\036v\305"
+	.ascii	"\267\377\260:\376\303\266\t\334\001\004\026a\205\203\216\323"
+	.ascii	"\206"
+	.string	"R\017\256+\266\t\206\333\224\255\254\334\324W\224\325\257\236\365^\305\265\332\263\234J?0\242q\220\231*g\247g\2559\037\335\017\320\271\037\200\363:\341\b\205]\373\007w\373\024\307\3721eo2~m\307\352v\247W\371\2253sF\346\2343\340\262\204}\201\371\325\2378\024\207z\360(\355R\334\252qGgv\346\354\324y!i\256\240\374\272\343=\354\033\200\333\237}\363$\217\350\307\355\036Xu:u\017\3543\275\207U\3001\260\336d\327\356\004\003\253trf\035\335r\t\024\353W\236\025\272}\312\251<\250\311$f\266\312\331\311\203\221]S\250~m\247\367\260\3301\2609\272]\3478\272=\247\307oz\247[\205\240\331n\265g\201\356\366\240q\272\325\0046\340n\025\327\3557\272}\331\355I\335\216\324\355\310n?vw\231\356F\323\355\031\272\273Jw[u\367U\267\213\320\355\033\272{Ew\253u\373"
+	.ascii	"\335\256\241\333\271\272{\253\273\265\272\033\253\273\251\272"
+	.ascii	"\333\247\273\301\272\0337\235N\247\335\036A\367\032\325\315C"
+	.ascii	"\"\273)X,\270Tg\334\311EdH#\252\260\354\260\376j\312\223+\273"
+	.ascii	"\265\317z\256\036N\2329\347\035\225\253\346\0177\035P\227f\245"
+	.ascii	"1\371\322t+\247_\351p93\2634u,\001\343e\002\232\035\335\273("
+	.ascii	"U\236\207\224\277\362\250\223\004L\250\bY\373&~\345\321\037\023"
+	.ascii	"PiI\223\242\3322\"I\230f\2211\037\325c\332\254\342R\235\232\263"
+	.ascii	"\016\253\346\333\332\373p\251\316\350\3143rE\266\246[>\374\350"
+	.ascii	"\3001\226b\355\234\027\254\346\234\026\334\317%\375 g\253\334"
+	.ascii	"\221\351\222\364\327\327\332\365o\025P\305\213\353\327\\\356"
+	.ascii	"\013w\356\211;g\004w\316\004\3349#\374V\253\2150\037D~m\366\r"
+	.ascii	"7[\206\233\355\302\315&\301\315\006\301\315\306\356\300\3152"
+	.ascii	"\341f\225p\263H\33487\334\2703\334\270.\334\270)\334\270\"\270"
+	.ascii	"qQ\270qL\270\3274\370\217<\022\207\372|\n>V\264\364\364k\257"
+	.ascii	"f\360\by\352>l\257`p\257W\260O\023\334\353\016\374\263\036a\021"
+	.ascii	"cp\t+\270\325%\270\255v\340V\227\270\257\250F\334\321\227\342"
+	.ascii	"6K\353/\341)g\255\255\b\026'\322\250H\255(\207\223aaD\r\b\016"
+	.ascii	"\267\365*Mk\3727\372\235n\234H\211\032\363\3537%\245\2008\305"
+	.ascii	"p\373\333/}\352W\252s\013\037A\203\244\2119\230\023\300\214\217"
+	.ascii	"\374\221\326\305\202s\035\225\025\361\372\362\250\017\"\335\257"
+	.ascii	"\364LO\343k\374\214_z\033\237\364$\274\322\241\277\364\261\376"
+	.ascii	"\030\217\324>\316\335/\037\306'\325*%\306\202\356\b\343f<\352"
+	.ascii	"\264\223\221\320!M\b\272\375\314_\3604K0\204xW\377\362e\264\230"
+	.ascii	"\022F\312\032\2432%i9;\333\251\272w\277\374\354R\325\331\314"
+	.ascii	"EdV>\370\310\372bb\313\331\371\301\347\303:\226\213\204\b\260"
+	.ascii	"\366'\301kv:\006\326\350\217tB\232h\314 F;\276H\007M"
+	.string	"\207T\026\032\370\217\275>a\346\250G\033ao\304\355dp\273\013\270\267\274\207us4mk4IJ\227[\033\216\026X\027\2463\355mW7g\326d\f\371\325\331\002\313F{\264)^\226\374\252\316p.6\311$M\224\366\252\3015\025\366k\327d\271\232\004U\223<\313cp)\235\r4>\243\032\251F*\022\236!\026\243U$)\031\016\265\034jr\303T\r4I\365H'F\306\206\366Ghhi2CBU\244c\325$3\003URH\224d\245\262\201\306\\p\277\333\243\351O\323\237F=Z\220s\266\001\242&\205\204-;)\177\272Uc\253\307\347B\223\002\223_\377M\3158UHm`j\236\326\244 u\245\371M\272.oH_x\nw\1777\233\217\312\2343\r\2343+\213p\332q\356?\3359\256:\002\335\275f\265\273\177\2109\037\243\230\221\301G\264\2169\272C\356\216\346\214\2042N"
+	.ascii	"\265DB5%\237P\331\210$b\344Qf(c\362\2313OF\"\215(\230\231'\371"
+	.ascii	"\314\313\fcl\351\331\te\314Hf\346\311\310|\354\220DB-\223\317"
+	.ascii	"\343\222'\371\204Z\346'T\336\311\310\2432\0062+y\362\023J-?\231"
+	.ascii	"\313\235\344\223\271L>\241~8\223\030Q6h@\315| \271X\022\231\227"
+	.ascii	"\224\236\216\312\235h\322\311\314f9\273\225QV\"\220\363\023S"
+	.ascii	"ivl\362\255\242\350R\021\225#S\203RQ\0243#\243I$\314\234\221"
+	.ascii	"\024\271\310J\021\030\235\321\f\304\243\306\036O9\311(\347\001"
+	.ascii	"\224r6z\216\346\234\2159\347\234\362\311\2313\216\235dSI)g'\037"
+	.ascii	"\245\374d\3442\312\371\255\300l-\223\317(\346\216+\312\263\231"
+	.ascii	"\217\234Fof3(%~\032\253rR\316\331\327ps\311$m\37338[\316d\270"
+	.ascii	"\375\312\206#&\r\220\032\2776\226\201\373O \302\006$\210K\333"
+	.ascii	"\274\224"
+	.string	"\234\235M\271\224K\363\313\247=\332\267\360^\277\345\311\336\314\217\371\027\376\312K\377\354\261|\231\347\362bO\346\263\274\230\007\3730\037}\263w\341\325~\354\303^\313{y0\337\345\277\276\314\241\277\366V\332\273\276\253\377\233(\240A\351\336=\265v0c4\275\206\234\341\001\225l\236\255\020\226\346\004,\315\312\310\253\240DLZ\3169\357\017xAM\373\342\327\372Z \236\026\030D\241\333\021\016\211p\007p\002H8\314\240\350\352\332\367s[`\333\002w\004$\034 Q\242\230\353\022&D\230\020\301v\t\023\273\235\t\022;\334$v\352\333B\350\002\207\274\242\313\023\032\272>\235!\257\305O\b\030<Qtm\204=\"\237\213\023\006\265<\305vHHD!4\324sa\323\006\375\\\267}\021\344\001\177\035^^\256EoE\360\307kA\034\022\372\360\274\355\260u\203\200?\026\274\2677\344\021\021\335\027\204V8$"
+	.string	"\247\035\352\371l^\267}\001\374\371\334\240\037\021\016\370#\302 \370Z\027\276b\217\b\353\fO\f\365^"
+	.string	"\203\277\2677\024\024\272\355\013\274\300\347f"
+	.ascii	"\376|\355\220\310+\2727\274\"\261\307+\366\210t\206n\320u\333"
+	.ascii	"\036\366m\207BB\301\033\036\rBB\301\227\350+`\370+"
+	.string	"\366x-\210,\332\240\227(\004\3762\264B\021^^\373\342\367\366^\374\3346h\203\033|}=!^\360%\366x-\200?\027o0H4\344\371\\\237\240\340\317m\205<!\341\020\217\347s\207\274\337p\350j\b\372\361\336\037\220\230\363\300P\321\035\352\274\303\236\020/\210\330c\301\033\022Y\fuo\273"
+	.string	"Qt\203\302\326\r\361\006\203n\210\033\241\232\227g\323\nEX\321\001\320\0068n\033\364{\021tU\024\335\241\336\317m\207;/\220\030<\201\323\276= \027\303\326\025j\201\212n\016"
+	.string	"\300\024!\364\200\202z-\220\317\275q_\025%r\300\024C\242\373\252\3000\344\265o\357\335"
+	.string	"H\004*\272;\300\024\303a\353\013\272*|\356\316\333V\340s\001xy/\006\246\030r\320\022\375V\264D=7\205\317\325\351\275=\024C-\020\330s\341\273\031\n\006)\340\341^\036\211\335\013\374\021q\357v':p\240A\005\330\007B8$\nQtC"
+	.ascii	"\177=\242\020>w\030\002\004\206'$5l\f\030\n9\216UG\236c\2772"
+	.ascii	"1\2517 \340!\205DI\216\021\306\322\225S\253"
+	.string	"7p\252\214\234\035\371U%Am\252\221J\363\302RmRm$I\"F\306\346\363\344\210\016\265\306[\301a\232\2211\303\241.\251K\352\022{\025\243\323\217M\333X\216#e\253\001\201\311\250\2410\250\0244#\"\"\"\222$I:a\005\3040\310$+\036\022`t5\226)\252\244d$)\250S\330c7\005\251PAn\256{\031\202\361\032u.A\001,&\241[\351%\330\354g+\211T\024\376\330\b\024\332\364\251\245%\233\f\355\222z:\302\232\376\212\364\345\035\016\303\260\027\330\\\302\245\215\260\310sJ\222u\351\255\231\314\242\004\020]\373=\030V\253\262{X\2050\377\235\324\375h\207t4XBwH\020\230pw\034\003hHe\n\225\026\356`3\334\332Y\021\235\256\215m\375ou\027\274\370\003q?\231\272PV\275\035x\003-J\301\222\224BHM9(\345JJ\245W\245+I\350=t\205}"
+	.ascii	"\227@\003/oUl\217\360\211_\372\361\345\332b\203\303\345\002o"
+	.ascii	"\373\007\3363\305\177\341\016\345\366\200\t\331\204r\365>\351"
+	.ascii	"\330\357\345\3438\272\207\221x\303AQ\241<\255\333\020\177\262"
+	.ascii	"lz\2560CgXy\2717f\214\242\202_\005E\024Z\2019qL\265~\005\336"
+	.ascii	"_m\332\371?=g\251\217T\212\224\354\313\206\305\340\326\377\305"
+	.ascii	"\3063~\350\352U_\212\0176]\211>\3776\312>\222\223N!\203\364O"
+	.ascii	"\205R.\221b\221\b\367\237\263*\022~\357\264\322\033\bZ\263Z\312"
+	.ascii	"R~\325\326\f\200\352! \305\235\351\253\243.\340\240\224\210#"
+	.ascii	"/I\227\261/:\303\212SC\032=r\020\234t\357\362\361\232@\216\326"
+	.ascii	"\b9,FO4\035\224\020\314\033\030\360\242\030#\370-\030W\312\326"
+	.ascii	"!\242\246\365\274\206\257\225\261\177\031\231#\0363\353\001\026"
+	.ascii	">\f\001WQ7\022\355\f\276\306\267My\037\274D\216\262=\307\003"
+	.ascii	"\373Iep\203\211\003\031\2413\031\253\243\223\332\362\301\224"
+	.ascii	"\013\334=\036#\343\201(\333\373\037\241\323{5U\205\224V"
+	.string	"7`\325N\024<\261\270\327v\2065?Q65\277^WJ\267l|v\352\204\376-\022\034a0\207\304H\2437\215\3714\212\017\370\200\030\214\2674\206L\333\336\024\177'\236%\331Nr4\213\227\242-\274\232\240\256\222}\021\344\343\305\217w\321\t_\207*\213\224\007\0029\251B\347\207\031\256\343#?f\f\217\006\325{\360\230\302\243=\3502\017%s(\020\020\013\317\371A\255\271,\275\216E\373F\314\337\326\267\n!\n\003)\214d\371\271\241\344Qi\222\225\2247\320N^~\335 H\373\317\321&(\244\364=1\001\321\021:.\217\320^\211|\337@\312\365\263\207\031;&H!3=\222\030\216\027\242\347P5\347\227-\347\273\002\273B\322r\317a\b\340\02316&\273T\2164\337\350\271\017!\236a`8:\205\274\364\356\314\0175\322\274w\224\260\003\ri\313Y\247\024\021R54L\254\375\316\340#"
+	.ascii	"<Yc1\363\253jd\242\340\231\255\375\311\0177\"(\331\232\361\350"
+	.ascii	"\364\3004\231\223R2R\3537\001\277\021\037pl\303[\037g[:\234f"
+	.ascii	"\207Yvt\267\021A:\207\344\362Y\3700\200\204\304\256k\317>\231"
+	.ascii	"K\272\177e\363c7\034\215\303\354>4\373(K\371K\376\213\205\253"
+	.ascii	"\372\3608!_\n\370S3#\2755\013\232\3552\227\334-\276\213\357\252"
+	.ascii	":_\200nPu\311\311\037"
+	.text
+	.section	.gnu.lto_.symtab.cb64eaa4656a1dcb,"e",@progbits
+	.string	"rxMspFrameReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cb64eaa4656a1dcb,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
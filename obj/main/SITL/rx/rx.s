@@ -0,0 +1,2068 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\n"
+	.string	"2"
+	.string	"?"
+	.string	"J"
+	.text
+	.section	.gnu.lto_.icf.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\205\003\r\025"
+	.string	"\204\033y\004"
+	.string	"N"
+	.string	"\352\375\352\254\017\004\002"
+	.string	"\002\001\001\264\206\337\236\013\004\002\002\002\003\267\335\335\337\n"
+	.string	"\003\317\253\250\341\002"
+	.string	"\004\330\370\241\354\t"
+	.string	"\005\246\215\301x\n\002\004\002\005\006\002\007\006\240\342\234\212\n\b\t\350\373\222\243\013\b\002"
+	.string	"\002\b\n\377\230\224\203\001\b\002\002\002\005\002\t\002\n\002\002\002\013\f\r\016\017\317\336\360\336\002\013\002\013\002"
+	.string	"\002"
+	.string	"\020\021\352\263\360\321\b\022\270\364\236\213\005,\002\f\006\002\r\007\016\002\017\006\002\r\023\024\242\302\263\302\013\027\030\031\217\224\332\351\013\020\016\002\016\032\033\034\035\036\037\231\233\302\213\016\002 !\323\331\354\253\b"
+	.string	"\"#\256\334\323\366\007\004$\307\233\244\242\007\006\002\020\002\021\006\002\006%&'(\347\346\214\201\r)\347\374\221\210\t*\274\274\326\344\006>\002\022\002\n\023\002\n\024\002\n\002\025\002\n\026\005+-\350\300\306\254\005\002./\274\205\242\255\006"
+	.string	"01\354\301\314\336\005"
+	.string	"2\377\245\346\313\017\b\f34\365\273\261\345\005\027\002\030\002\0305\216\223\206\341\0026\274\201\267\213\007\004"
+	.string	"\002"
+	.string	"7\205\326\204\336\017\020"
+	.string	"\002\031"
+	.string	"\002"
+	.string	"89:;\267\205\240\220\r\026\021<=>?\324\351\375\343\005\032\f\002\f@A\323\343\357\213\016\006\013\002\013B\312\267\354h\002C\273\360\260\321\007\b\032\002\005D\222\271\322\347\017E\347\273\234\355\fF\223\335\346zG\006\002\006H\313\331\347\361\004\002\002"
+	.string	"\002\nI\342\201\222\246\004J\212\254\201\341\006\f\002\033\002\n\002\034\002\034\021\002\021KLM\260\233\213\233\tNO\240\367\303\341\005PQ\240\342\234\212\n"
+	.string	"|\250q=QH\350$IA\n\255\001P\202r\244\250<\021@e5G)\025\226\0037\226v\031\331J\327\004\375g\255\247 \203\306H\2651\022\032\t|\324\217\315n\221{GS\374\004n\2453\255\374K&\312\212\020\022X\021\032\223Wl\374'<JV\355w\035\034\022\234\211\260{\360\267\340\345\020Z\"\250"
+	.string	"\372\353\312'\235\302[\231\244\302\005R\375hx(\345I\375\2149\277\210`\270\213\305\267\214\354\322\350\276\324D^\\keVI^1k\325\224N>\305\322\275=\250\357\306\tHZ\266\254I\262\357\206\310\030\032\331\212lA\250<\026?\206wF`\253\324"
+	.ascii	"I\337@{7\204n\024\377\017Y\314\004\360\264\223P\267q\030\002"
+	.ascii	"6\242\200\007\034>9\207\334A\217>\252@\231x\2267\372\023R\376"
+	.ascii	"\nM'\275\007x"
+	.text
+	.section	.gnu.lto_.ipa_sra.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\005\006"
+	.ascii	"2\210\026\032PW\241\00303333\305\314\264\221\337L\264\\\333H"
+	.ascii	"\274\301$M\356\224\002\252N\322\034MQ\250@\363SN\317\354\314"
+	.ascii	"\371\215\2765\233\031s\321\313\242\365*Sv\262\222\031\231\220"
+	.ascii	"\207\203\261X\341'\366A]\003A\007\365\244W]Z\210\252\022l\002"
+	.ascii	"\354-`\301\252\267\341\2450 `\002Y\266\036\372`\233\373\224\316"
+	.ascii	"\301)\221n\013\220\016\257\261\017IS\204z1\224\fb\321\331\302"
+	.ascii	"\202\027\206\344\365\265\205\205`\341\337?\213,\260\b\252\341"
+	.ascii	"\244\301\342\221q\270\316\201\001\317F\273\214\274\302\245C\020"
+	.ascii	"\004\323\242\351\203\003\305\004!\200\321\024\031\234\0233\272"
+	.ascii	"W\006\273\030=\0249\030zqQ\206"
+	.text
+	.section	.gnu.lto_.inline.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375` \007m\033"
+	.string	"v\345\206J\240\024R:\200'\254\347\266\030-\300 \213q\351\317\031\336\241'\260\231>\307$\337\327\251\262\342\316j\311\273\262/\017\357\003\027X\333\250E^\216\267C'C\177\300\327r\023\027N\206\272\373\r6;C\210}\315I#do)So"
+	.string	"m"
+	.string	"x"
+	.ascii	"_\035:\024\343\241\343<\312\256\346\273\232\363\247\007\232E"
+	.ascii	"\244\004\204\277\375\034J\2444l\322\222\242\374{\2544<\206\265"
+	.ascii	"\220\377q\274W\213\343\021\377+\375\021\2617%\216I\274\374\352"
+	.ascii	"\360\360\210d\213\300\311JMt\267\320O\317=\234d\t\030\274\365"
+	.ascii	"\260\222%`\320\366\345s\016ww\227\377\016?\221\t\235T\370\337"
+	.ascii	"\035\256\"\023:\321~\0037o\001]CD\274r\364\177\216\367\373\365"
+	.ascii	"q\0170)\033-\177I\341\032\245\355y\277\375\267F{(\324\r$a\tz"
+	.ascii	"\"\013G\331\203\234\345_\035\236\362\321aw\337\016\340,\245\255"
+	.ascii	"\362\320\237\324\2171\030\037\006V\225=\301\234v\336\217|\375"
+	.ascii	"\317\331_q\352k.w\256\347\271\236\347\372\201.\361\361\344\267"
+	.ascii	"7_\315\377\244/\300+\223`e\030\3505A9J"
+	.string	"\035\377,\222\223\025\214\001\217\220c\366xv\b\224*\330\3445\373yX\206\221\325\f\027\261#_Z\001n\363\257\220\347\375z\024\254\273Y\202\305\243\253\333\0378h\300`\001U\260\233\302\277\017%\036]Dm\022\3774\004\03312\016\271\330\021\370\350\223c\f\025\265\"'\\D\224\037\370O\261\272;\206f\345\273\036?I\2073?s[\235\241>n\352n\332e@p\377\377\263>\312(\004\316\214\266\214T.E\243\220I\3009\374'\277AC\006\032.\f\027v\207\207\272\373\345\026\270\272\033\307_\361\233!&P]S\265WP\341\"LP\306\332)p\261E\260\330\001\210\242\250\206\315'\340p\361\350\n\253\276 \n\031\253\241\274\017\252*w\374s&\232\372b\021s\t\347\335\354q\030\r-b\314O\241J\313\252\343\335\261:\006\332\237\334\200\234\250\021=\345\310\214\tIJ\222\2441\200\002\031)\242\362\022"
+	.string	"%a\343$!\210\030\203d\202\311(('=\034\006\323\325G\207^\267\226\222\300\206s$\363\343\202D\316\031\305\026g\220Y\303\220\0320\002%\351M\232q&\334Qd\376ifu~#\213P9\321\247\302\215\373u\356\274\255\2475\264\377\264\n\235"
+	.string	"l\211\350\003P~ZF\036\302N\0341\350\254yzX\037jF\230\361\300\240gF\004\032Q\003\357\262\315;\273\024\326\365\017a\211DO\242\312\3255\322\312\211\303=W\260\212\263\364)(\345\274\357\335\020nn0\350*\004\210\334\316\316\306#\221\360\303\236}\350a\364\307\230\351\275<\231\227AS\324\241"
+	.string	"M\342y\211z5\231f`\313\202\"k\204\030Gb\302\350[\373\367_\345\036\236\352\b\206bG(\310\002\336y\243A\bP\335\036\rCL[\266 \245t@\213\305\375|a\257\355\225t\026\022kX{m\204\037"
+	.ascii	"\313\322\357\375\365\216\200\217l;\242\"L\230\033\333\033\336"
+	.ascii	"\261m\372\247\242\260\3142\371\r\303\205}\3119dYZ\017\215\375"
+	.ascii	"\247\274=\255N\300z\250\271(\246\253\310\371f7\013\372\225\330"
+	.ascii	"\366\321(L\357\266\330\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`r\003\275\017"
+	.string	"\026\326G<@\247(\035\267\216\355\325\260\026\270^\t\202\211\311/\244\336\362\263b\216\002\230\335U_\f\257\210\n\343\310\262,\273\234x\266e\241\376+|\373?\211q9\374\224\216\252?\211\335;\245\0244"
+	.string	"6"
+	.string	":"
+	.string	"\006\252\273'\177\255\345:]\247Z)+u\227\334\007\025\310\267\213\321o\253\337\346\266\371,\225\027\363\274\354'`\024\316\3538\354\345\274\265\177g?\235\335N\237I\255\246\230F\362H\377\334=\r\323f\0175\003{\363{\316\002\325}\251\352Kuc\3362X\321\212 \337d\223\215\300\367ueYG+\260\023\370n\211\347\356\245\235\001O\007\213,\337+\306\030\237\335\267+4\212v\242\225hEm\250\335\340\006\355J\305\020.@\b\235\004\252\037\300\357\034\270\001\204\003\003`;\2121\202"
+	.string	"\b\003h\336~\034\221\3314\315\262\205\030iE\332\020\220\314G\353\201B-\260K\356h9\332l\003\323\310|\265\263\247\202\375Q)\024{\252\327\305\370D\317MF\023C\363\324.\032\023&)t\367\032\002b\250\3610\314\030\t\rY\206\315P\002Q\252\250z\021\260Hi\b\"\022\322\244Rh\r\246\321z\203\326\177\306yN\"\252\211\266=\355a\323b\241}U\200,\213r\026C\227\250\321\250"
+	.ascii	"\255\275\007\227\254\312\312&m\2426Y\225\363\353R]\266a\336\301"
+	.ascii	"C2R\225(\233>\026_\0232,6\307\370\315\2428Y\312\n\223MR\272\002"
+	.ascii	"\256esbN\017#\230\373\230\261Q\363n\366W\025\356\004[)#\273\303"
+	.ascii	"\017`m'P\217\024\322C\237\304\340'Tu\224\372\305\374\320\340"
+	.ascii	"m\333\207\311 \332[\243\253a\235\262e\231\342\"\211C`J\004\232"
+	.ascii	"\233\335\343j\\\242\343\204\306\316\321\210\301\021\020\331L"
+	.ascii	"F\235\340\325;\310:\341\f\251O\rm\005\257\341+\034\0070\001"
+	.text
+	.section	.gnu.lto_.pureconst.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375 w\355\002"
+	.string	"rG\026\032`94\006\005H3=\031\f\303\024"
+	.string	""
+	.string	"\215\021\211\0363\221\"\201\023&\262;.\2227\362D\036r\220\367q\217\327q\216o\\\343\031\307\370\305e\361\212F\321&\232\304\213x\020O\017\227\303\031\276p\205'\034\341\0077x\301\023A\323@S\023h\001\027\300\245\032J\251R"
+	.text
+	.section	.gnu.lto_.ipa_modref.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`q\002\325\n"
+	.ascii	"\302\316),pM2\034\374\377\377\227\246\377\377\377\377\377O\357"
+	.ascii	"\333?N\222L\020\323\"imhh\315\226\t\336F\b\347\373=\222\304\330"
+	.ascii	"\bI2\005B\036!\324D%\002J\326\241rh\36564\324\f\225\036\306\205"
+	.ascii	".\013\255P\n\315\354\"v\233\267\372\231pG=\251\337d6\342\230"
+	.ascii	"\245$\002k\021_\006\361\254~Y\2501\270j\247yj\026*\n\233\240"
+	.ascii	"'\364\032%h\346\211\331Q\236\224\037~\016\242\3519\275v\n\b "
+	.ascii	"\003\335\346\345\251\037>\240\364t\330!<\327\316\362\264\354"
+	.ascii	"L\2369\352\177\303\214\236\225'2%\001\324\001\tT\250\021U$\221"
+	.ascii	"\314lRi\016P\0021P\215\335\021P\035C\020]\205M\241\3459bl\026"
+	.ascii	"X\232x\221\245\003\333\030I\306>=\225\2207\321\260\217\005\311"
+	.ascii	"\347\210\"\234\253\333\341\231\316\004C\201\376\323M\353\304"
+	.ascii	"S\260\024\221v\013t\264\200\031QUR\246\252\226GU\266\215u1\231"
+	.ascii	")\220FEv\0176\332\246\315J{;\256%\230#O\020k\021\214\013a\023"
+	.ascii	"&\203\327Z?\204<\250\236;L\261Q\312\352\211\354\t\021\354T\340"
+	.ascii	"\037t\313}\006<uR2\205\257I\243\212V\355~\364\337T#\262\356\021"
+	.ascii	"\331\263\261 \253\276L\031\030\374E\320+Q"
+	.text
+	.section	.gnu.lto_.lto.7766df49c0b896a2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxChannelRangeConfigs_Registry.80.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375 \226E\004"
+	.string	"\244\007i"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\376\241\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\344\030us\355\007uq"
+	.string	"\005\001\006'\001\024\005\001\006\035\001\005,?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.string	"_\304\202Yt\212\"o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pgResetFn_rxChannelRangeConfigs.81.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`}\001m\017"
+	.string	"\206\235hF\360\260(\035\263\237\365\324\217zp\024\366\253\377r.\377\2112S;\270\225jA\277Z\320]\313\301{\335\313Z\035\341w/\320\354\261\005\217>\022\007\223I\222\374Q]\002\"\r\246\326S&\304\266\215\204\220\275\345N)R"
+	.string	"P"
+	.string	"W"
+	.string	"\335A\266O\237l\034\017\301=\254\307\212,gw=\035\341y\031\3362\236>\245\306\223?\363\021\320\006\253\205\372\224\036\332\013\032"
+	.string	"\255\f2\301\213L\314c\217,-U\2241-\327\307n"
+	.ascii	"\234\261Z-\217\\\203\335ud\265<\334\333m\177\266\031\330_\021"
+	.ascii	"\236\277~\356"
+	.string	"\260[>Zct\214\321\377x@\320\020\331\261\313\241\246\2636\023\006\211\303n?\364c)\256\342t\230i\035\252C7\223i\310\261\273$\237^\320}\016\220\377\330~\264\177\342(N\177\251\\\300\256k\247f7D\340\221\356\323\341C\266\317\340l%\"@M\351.>j\310Lp7O\331\354\ng\221B\340fw\025\3703\223\005\021\020\346\323W\331>\013\200:R\261\346\250\234\252~U\342\236\261]\243~%\243\2125K\275>v\251\003\322\254\354\244bM\365%\306\207\r\252.v\210\212\352\242\301\334\310\261\272\354\242\227PD\017F$\223\020\312\b\344 Bh4\002A01}!>)1}\236\351\363F\"\220\004\357\344+y% &M\b}\036\005\022\351\363>\341^]\376\314\273\026!lR\252\232\352bN\206zTq\"\311\245\262\314\233\266I\375\013\206\203!\362\270\334\335\225>p\251\036\275\020\035"
+	.ascii	"3\003\3769\204i@\273\266\313\305\262\n\006Gf\224\016\326@\353"
+	.ascii	"\226\372\314\323\036\021\255\2051S\b\314@]\306}\025R-\241u\261"
+	.ascii	"WE\240\252ppgUc\315Jtp/n\210({\241\252\361~\022\351\\\363\t"
+	.text
+	.section	.gnu.lto_rxFailsafeChannelConfigs_Registry.85.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375 \226M\004"
+	.string	"\264\007i"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\307\362\023\032\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\305\031us\350\314\030uq"
+	.string	"\005\001\006'\001$\005\001\006\035\001\022+?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.string	"^D\200I^\212\"d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_pgResetFn_rxFailsafeChannelConfigs.86.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\371\001U\022"
+	.string	"V\343|F\320\2241tX\322\211\276\r\236\245\345hL\025\017\017\220\204\301\027\364\243\324ry\323Zx\226\365F\035@V\262[\\\375\002\251\2162K\304\243+\274\340,'\032\254G9\2345\321\265\265T@\276F\204\354\275\245L)i"
+	.string	"c"
+	.string	"h"
+	.ascii	"\251\233\310G\317\354\037\357\001\315\023\351\334\210\234\346"
+	.ascii	"\234\254%a\001\207\275[\352\354(\031\341\352\314\027:\312\356"
+	.ascii	"\207\313\331\034\005\327\204\220\234U\356\006Yn\344\f\371\320"
+	.ascii	"\025'WS\251J\321\363\370\341\020:0\022ad\225\263\301\025\n\036"
+	.ascii	"5\222\334\006\335\017\235\301\316\b\227\353\271\242\"\3149\255"
+	.ascii	"\270\234\207;"
+	.string	"u\333;\266YlE\020\275\232\026 \342\203\344\375\261K\316\373UQ\215\272\357\226P\035\257\206\253\336U\253\252\277R\361z,(\232S\347Wd\"E\034'\356\273\375\236?\364\3420f\367\371(e\263\223*\"\002\001d\316\231\362h\b\251\307\003\360$\266\257\366\203\356bv^\315I\200i\363\345\330\230\263\247b\224\324\243{\037 \037\003\250\265a\247\001\300\207\246?\030W\247N\035Z4\301\375\261\312\345J\340i\362\371\260\351\223\343\332\027.cF\001\320\234\363\201\037#\203,\301R\211G\277F>\306#\\\220o\\\002I\273\252\205\373\233\025z\357\220\272\273\277Q!W\027\326\270\035\241\351\317\360>\222r\277\037\272\013\213\235\216[PM\177\233\304Ai\304\256\316\016\256\313&\270b^\260\026\031\230\327\253E\241\005&\246%\223q\265\\hb'~Y\241\211\261hb\254\227\253U\201\365\022\223\261VL\f\263"
+	.ascii	"\023ca\200\301b,\222\036\355\373#\364\324\f!$\332\326P\2533\212"
+	.ascii	")\226\3542i\312\345\342\260x\224|L6}R8\347\234ruVh\3403R\227"
+	.ascii	"r\3606~F\242\026\307np\271%\253agt\023\"\" P\202A\f\251\007a"
+	.ascii	"`\357\035\235\033\347\313j\343w\301\373\347@\\\224\t\202\r\351"
+	.ascii	"\227\321kX~G\267\307M\354?[\330s\246\221R\214\007\274t\273\205"
+	.ascii	"\034\213\017\350a7\001\250\n\347\316\336X3E\257{\231!\"; j\310"
+	.ascii	"\312}\243u;\027%\003"
+	.text
+	.section	.gnu.lto_resetAllRxChannelRangeConfigurations.87.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`r\001M\017"
+	.string	"\346\334gG\360\260(\0358=\264\210\f\321\032\243S\"N\242\335\274E%\261\257{!\3712*i\313\"*;\277\213\247\331\250C\344]D\230=\266\340\321G\342`2I\222'\253K@\240\t?\003\362n\230c\224|\262\267\334)\005Q"
+	.string	"P"
+	.string	"W"
+	.string	"!\333\247O\266\316?\023{\331\211\0162\332\356vZ\302\363\362\273e<}J\215'\177\346\"/3\025\013\365)?B\0305"
+	.ascii	"X\034\344\002\327+\346\261\307\025+\025eL\313\365\261\203\\5"
+	.ascii	"T\254\226G\317\203\335uT\261B\334\333m{\266\035\330\227\t\037"
+	.string	"\356\260_\036\274\343a\367?>\302\006\270\002T\263\373\241\326cqf\f\024\007o\377\363c-\356\342t\320!\207\002\301\315d/9vw\344\323\r\270\317\003\362 \266\037\355\313\234\305\351\260\224\002\002v\005\\\331\354~\n,\302}\372;\201\355\223{\340\215\225\310\343rwW:\301\243~\024D\203\205\304\277_9\005\355`I\221\2125\007\260\301p\232\317\353\206fO\316Q6;\303g(\334\3562\360_l\320` \007\346\323O\331>\037;\202\327\215\212\035\225XSu\311\020\341A\325\305\376PQ[!\f\016\232\265e\007\243\237\214\"\220J%\242\023R\b\302\004\021\211\024\222Pb\362\006\330\204\304\344u&\257#\215B\024:\023\317BG\022\342R\005\221\327](\225\274\016\344\333kk\346\034\215\016\034\025MMu\261g\206~\324\024\302\342\310\243\256\036\373g'\324QN-\243\324\353j\336\341\026\365\260\035"
+	.string	"2\003\376\031\343\206\306\341\364\367\321\033\253`\320`l\226i"
+	.ascii	"\264N)\312L\345qc\355\205\271\250\013\272\257L\002\023\225iO"
+	.ascii	"gv\225\001\2522\007\355\254\022\326\254N\007\355\342\260\210"
+	.ascii	"\262\027\252\032\357'\221\3165\237"
+	.text
+	.section	.gnu.lto_nullReadRawRC.88.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\365\007"
+	.string	"\342\01677@o\323\001\230.,u\332\2550u\243\201j\202\372\005\314\277\016cXj1\366\032\311,\310-\022\372z\242\252\006\231\253Ow\344\305\265a\220\333l\030\313\254\233\020\231R\021\033\307e\020\232f\3632\357a\003}<\216\302\341\223\001\326<\237\214\237\214\334'\003EMNDO\307\235\304&\243\327u2bs\037^\004\027\224\310\236!\245N\366\253\245L\266b$\227\003\226\335\214\031\231m\261V>l\2036f\273R[a\001\374I\3059+z\331HP\265_r\023\360\323\342\002\273&\030\225\335\211\340\202\315-\317\215m_\344#\240C\235\035$\200S\bFJ\314\356\214\234\017\\\267\364\235\353\026\305\361\360\032\372Gy\005\34213*\205\256\232\206\335\265\216J\0327u\333\006\266\031l\223\004\f"
+	.ascii	"2\003\202\341\243\302^\025\220kx\227E\3531\241\301\\\201\n\007"
+	.ascii	"w\215T+&a\222\001"
+	.text
+	.section	.gnu.lto_nullFrameStatus.89.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375 \366\335\006"
+	.string	"\222\31516@o\222\016\230\265@x\266\022\\\321\0312M\200\370\r\352\nf\232 \220\331\315\201\271\033Jt<\267\233\346Z\213\316\240\345\021o\021\347\033\227\211\223\215\335l#2\005\230\326\321\0360\320G\013I8\210\240\300\036\216\b>\021|\241O\007\364<0\342q6g\020\030|Z\226\301w\305\354f\025PP\025\037I\216\342\370f23\2476\336]\032,\b*\231\246\030\230\\\251R@\376\376\243\277~\347\276\"\035\031\225d\242\003\231\033-(\2311a\003M\253c\t\254V\232n\254V\377\013\f\243\267F\017S\200\305\311\205\311Kf|TG\267\272\355\266\244\231\220\017\227\322\211T\007\320\220\231\273\322\t\243S\375\017~\205?#\006"
+	.ascii	"2\003\202\341\243\302^\025\360v\031c\272&\031"
+	.text
+	.section	.gnu.lto_nullProcessFrame.90.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375 \370\365\006"
+	.string	"\362\31526@o\222\016\230\276D\030\006n\034.D\030\262\025`~\201\265\303\233\033\005\221\335\034\230\273\241\302F\323\377\272\216\260\342\311O\023\t\370V\t\334t\201\355\257iBd\n \314\2039\200D!l$\321P\202\002\177:%\370J\360\215B\036\321\373\300\210\327\331L\202"
+	.string	"\301\207\221H\360\035\263Nu\263\253\200\302U|<5\267\361\005\310\314\334\251\276=\254^\\8(\231\250\030\230\\Y'\036\177\177\323\007\374\255}A\032b\252\310D\0072U,&\231\221\263\201\246\326\261\004W-M7W\255\177\205\005\323Yc\007*c\221rA\362\222\031\237\343h\326\226\335\216\364\340\243Ee\245$uj\3130d\346\r#\225\321]\177\204?\341\327\b\005"
+	.ascii	"T\b\203\347\220\254\202\343.s^\327$\003"
+	.text
+	.section	.gnu.lto_rxInit.92.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\033\017\315F"
+	.string	"\332vX\032@@\244N\007\327\353TU\016\004\240\367g_'\256\203\234\204#$\b!\224vZ\3318\243\277\307\375:E\374\377\242\177M\377\337\001\016\301\257lr\371B\222\352\216\022A\0075\204h\223\275\267L)\005\221\001w\001\232\001\031p\032#\251\036\212\375X6l\236\347\256\306\375\316\275\214\3734\215\353\365QM\025\2655q\034+p\0318\200=\257G\324\3264Fr\034\353#\224\036\306\361\264\312\255k\307;\343v\260\337\375p\3435n\330\235\035a\034O\013\270\316.\037\210\327\365\002:;\207\335N\327}\244\366\321\331e\354L\223ri\227\266\317\365\261]\316\311\300>m\276(\3474\026\223\200\027Gj\345l\017p\235\215\362f\353\354\352I\255\263-\304\245m\205vX&\215\343\370\310\036\341\356?>\305\022\373\031D`u\207q\034ce4&\223\311\324H\276N\275\2152\354PO"
+	.string	"\234\232\230\226\224\232\314$\244\243\245\2212\211<\026\031\335b\313\256\371\341\366_\002H\005\304\023\333r\2508\177\212\223>"
+	.ascii	"8_\333\342\330\301\271\323\212l\203\216Y\033x\035Bi\251?(\334"
+	.ascii	"7\255\331\353\020\212\377A\337V\t\211`z\234\232\366LW\242n\276"
+	.ascii	"\304\346J\3155gn\301S\373$6-\217\304\266F\321e\371#\252SI\273"
+	.ascii	"P\211\272\371r\315k\203\212\370\037\024\313*a\257H\241\317\271"
+	.ascii	"T\033\264\354\215\256D\315\\Y\2440\347Uxq\244\210T\242f\236\224"
+	.ascii	"B\036\377\240P\326\2506(\331\027\031\307\332\240O\336-\372\037"
+	.ascii	"\324\t\330\267\354\327Q\314\353W\247\022\215\342ym\"Y{*\305\234"
+	.ascii	"k\025\341\036!\207\363\017\023\353\372/R\210\343\270\377)\026"
+	.ascii	"\365\016\340\335o\325\335)\272\223`\001\376\354\206\3118\242"
+	.ascii	"\n\207\034"
+	.string	"z\007\350\311\244\230\273-x\342\205&\342:\370\024\324\346bv\260D\215\301\013e\271q\354|\320n\350\2046t\370\360\241u\266\315I%j\336\344\270\276\232lA\201\322 \331?\203yHd\340\034\331e\034\307lfF\315\nT\327\212\326@\3003\215\346\b\231q\215\34353\243dMh\304\316\315\177x\314x\2364\206\212\331\315\231\031m\362m\350P\333\357\243S\307v\351\263\303\34636\376\371\365\317\314h\022?g\336r\275\334\246\254\371\314E\264\335!\374\215\210\245\3008\216\037\264\273q>\022\355j\316v\t\023l\273\211\326Y\343\027:\267B\256\257.\263\020!\223\363Y\357h=\263\240\n:?\261\221\276\247\261\247h\273U\254x\177zvQ%D$t\346\255\356i\327\347\263ngb\233\363\353l\245{\004\b\017\035\220\337\033<\317[\203\253\361\316\362;\357*/\343M\345So\004\355\367\024\362\373"
+	.string	"\362\333@\373]@\371M@\371=@\371-\205\374\216j\277\005\264\337\001\222\337P\306\357'\3447"
+	.ascii	"\344\267S\373\335\344~3\271\337K\310o%\344w\323\375f\272\337"
+	.ascii	"I\310o$\344\367Q\373\275l\277\215\216\337J\343w\322\375F\026"
+	.ascii	"}\037\213\276\213\214\337F\367\333-~\027\333\357\226\375f"
+	.string	"\331\357\225\375\316\354\367\263\337N\342JZ\006\005-QK\t\274\231\225r\323\34027\001\233E\247\377h\231\331C~D_eM\376\243M\312\314\354_mH9)gC\260DW~\224\221r\023\"\243|\224['yp\300\0221\263Z\243\354x\376X\256\240Q\005\033\261\020\211]\3222\033\345,G\355s~\"\240o\353\362\032\262d\\\330\226\371\323\364\t\364[\372\035\364j\257a\226\262Z\262\030e\267\223\346>(\320L\f\311_\304V\231\265\250}\272\337B\217\366\"r8;,\223\272\231nX\355\257\274\206\214lG\374\002\245\316\366[\371\263\027\321[\205\267\272Zg\225\331\351\234\212\356\316\233\034\340\0329*G\311\334\335WO\005^\222\234\362\206\310\234\364z\2632dv8\247\262\322\267\314g]\024T\216\310Y0i\345\brX\363\265\b\262\313\271^\0265\252Q\002G\220G\344 xw\216d\360\224"
+	.ascii	"X\236\374\030\fF\004\016\013\253{\nz5\207\215\264E\371\230\331"
+	.ascii	":_e]_m\b\337\r\213\301I\336\237E\331@\224\216_W\336jc^\373%\360"
+	.ascii	"\022\243\3008\216!\364'y%p\023\370\tLFV\307\315F8\312\213\301"
+	.ascii	"f\017u\263\317\371T\341\2337\271\034&Q0\217\2625\"\305\341)m"
+	.ascii	"\177\2217\002O\251\002\237\235\265\316\026\351\334\034z\217\266"
+	.ascii	"\177\310\023\351\321\256\3260\032\234\006\247\265\316\262_\334"
+	.ascii	"\270\025j\201\267L\005\262\275\027\334\3059vW\365\002\203\231"
+	.ascii	"\022\363[\360\333\307N\356\n=\231\300pp\234\001,q\314\025-\343"
+	.ascii	"\312\207\026V\f\034"
+	.string	"2\256r\274pq\243\206\212\026ZX-`4\255P\361,T\374\213\0354V\360`gx\267\270\362\241\205\345C\013\313\306\214\0255\260Zh\345\300\272J\352\0338^ha\351\270qC\013\3538\345\362l\245K\230\371q\345\256\236\312|z\324\301i\033\362\024\322\036\260DY\371@\336\220\375\253PC>\220#\030\236y==\376P\036\r\371\371\364\221\343\032\343\006rVv\332\363UV \033\270{<~\005\262\353\371\372V\007\370&w\342\td\227\276\235w\317\375\276\257\363\246\321{\367\366\3326/\337\210o=\317\343\343E\312\204j5\261\373\225\363\322y\177\022\310QR\271\365\\J\273\3168\346\"0 \373\327\234\250,\225\025|\021\n\310Q\331\353\374\033>\001y\301\031\2377\250\367N\333\277\367l\336;/\2367\317\233\247N\217[!\262\211\037\341\223\027\017\220Y\354y\275,WM\200l\265\345PY\034"
+	.ascii	"\344\330\024\215\263zX\310\341]\372w&&\240\035\226\331\305\275"
+	.ascii	"\231\017.`\317\fuLZ\327o\237\327\317\373\263_\230\371!\022z\345"
+	.ascii	"\255.\324\005\220\323\213\026*+\205\3709\021\356O\241\246\276"
+	.ascii	"\f\"6-\201\310Ypi\345TL\2525\216\343\230\211*\203\310N\365\365"
+	.ascii	"\020\032\300\257\262\224\317\332\237\230iv\310\036\367d\215\351"
+	.ascii	"!W\345\260"
+	.string	"\356\247\f\037\007/iJ\375)\250*?e&>\260D\254S\006\220\213\203\331\351\035\374\267,\024W\244nb\232\362\361\013 \242\034\327W\225\3008S\356\360_|)3)\345\2010\250a4\344\024TffFD\222\024$i\f\221\005\304\030'\235\231\007\0210\251s\016\031I\223\016_\303\277\200\276\020\355\362J\315\366Y\327O\322\272\221:\240\213Iz\334'}-\325\177)\025\033\216w\3231\036\020\226\242\211\311M\325P\200W/\202\362\244\240r\327\2062\354\372\235.Y@\264\231\t\210Ap\3138Q\262\375<!\246o#\200|\005\236\to\024\232\317\321\241Q\2232\023\305\300lIll@\331J\276\tJ\375\302\311wC\2732[\256\362\203lv\324n\227\274\244\245\247kG\341\213\224\"\342\363\255\f\250W\275v\223Y^\033,q\013\017z\275\005\372D\342y\254]P\314\374B>\255%\34574\203"
+	.string	"\33472\2673!\023\200\n\361U\216h\265P\210"
+	.string	"\r]\354\027\351N\362,\031\363\366-.\351\356\234k\225\354b\252\300\"\373L\343\202g\fn\233`\3322\354Yu\3253j\276\215q\244t\214\240\365G\304\325\247Ff\365i\013"
+	.ascii	"\005\366\\\237y\024\245\356\225\272\247\377\357\362-\351*\201"
+	.ascii	"N)\211\305\262\353"
+	.string	"\225\310\330I\306zr \364\316\261j\242\250\264\325\246_,a@y\200C\326\324\347x\372/\020G\353\313\234\004\231}\236Xm\023n\006m\023\274\257\242\232\33696Y\025\364\204\327P\252|r\216I\367\332r\371\f\265\035\330\343nc\262\3734\177\347=p\310\350\013F\r\331\253Q\341\257K\373?7\377\204I\306\237\246\326\"\345\301\200XZ\013d>\371o\366\240\357^\223^F`\351\177m\243\360`\312Q\276\317\3013\340\260\301$\356X\347\342\033\224\223!S@\220ZC\302\221\353\357\360\215\026\340\230\256\255\321\253\250\270.\345\206\024\304\f{\364\026"
+	.ascii	"\255\006\3349\301?\311\257S\033\013\301c%tF\243+Z\271\334\001"
+	.ascii	"\277\273G\337\244\006\325\020\330~u\027~\335BC\032A\302\361)"
+	.ascii	"\007\224\207\310=k\212\273\210\355\207D1\001N\257H\005M[\260"
+	.ascii	"\240\2516.\026N\203v\030\254\324\253\366\316\007\234\003\350"
+	.ascii	"\333\002q\004\227\002\212\037\221a\200\004\346bd^\324"
+	.text
+	.section	.gnu.lto_rxIsReceivingSignal.93.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"\202\313*2Pm\222\016$\243\252\302K\264\267T\325\272-\271\322\363\346*{Kv\325\376\335\316\356\b@\205\032\217\233\231ic\250\200\025\222\2008x\352\260\255\355-Sg0\232\3064\215=4,8\260L\213`\030\201)\b\206\306$(\252\261\313\225\305\320!\201\007)\276 \r\251n\307\023\233\253\325\351n,\235\016\0030<7\372\253s\230\361\225\022C\377}8 JQ \311\374\214V\022e\032\361\3709\177\371"
+	.string	"\201s\325k\343S\216\222\n\021\225\314\213\241F\253^u\373QIdrb\201:=\200\204\314\374,\320E\307\376\006\177\301o\021\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_rxAreFlightChannelsValid.94.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375 \336%\006"
+	.string	"\202\213*2Pm\222\016$\243\252\322\262\263\351\205\005\030"
+	.string	" \226\361\346*{Kv\325\376\335\316\356\b@\205\032\217\233\231ic\250\200\025\222\2008xj\214\326\366\226)_,\230\3060\215A80<\260K\223`\226\201\247\210\206\306&\246\251\261\212\225\305\317a\001\007+\276\"\035\241\256\307\024\231kU\351f"
+	.string	"*\035\ndp\356zks\250\361\215\022?\377}H"
+	.string	":Y\2702;WJ\232H\240\217_\363\225\021\0224S\2658:\355\bY\220\240dZ\f7J\365\250\333\220F \241\222\312\263\351\005(d\346Wy0:\366?\370\r\376\213\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_suspendRxPwmPpmSignal.95.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375 \270\355\004"
+	.string	"\322\b!*pm\032\003\240\335!_\022\035J\364Uw!\251\341\352\300~lN6\236\230\2111\305"
+	.string	""
+	.string	"\001\007N\342s\024\026"
+	.string	"d\367\226)[\0256%6%\304\261xHkJdE\370\2120\246\234\\\327\224\224\267\032;\003%V\336\323`\314\274\0026v\017\013\237H1\332\275\234L\033\n\2008\277Rg_Ro\263\372!Y<\337\356\312\250\321La\266jG\007\033\247)\024$vw\270q\030=\352\217\370\017\177#\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_resumeRxPwmPpmSignal.96.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375 \270\355\004"
+	.string	"\322\b!*\200M\032\003\300$B"
+	.string	"\253\030P[\213^\nE\321\240xD\304\340\330\206C\033D>f\b\261\260\267\233\361(<mqo\231\002[\0256%6%\304\261xHkJdE\370\2120\246\234\\\327\224\224\267\032;\003%V\336\323`\324\274\0026v\017\013\231\221\342\333\275|\246\025\005B\235_\251\263'\251\307Y\005\235,\237\322\356\312\270\321La\266\252G\007\033\247)\024$vw\270q\030=\352\217\370\017\177#\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_setLinkQuality.97.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\355\002\235\025"
+	.string	"V\347\211I\300\322Q:R\020\331\007,M\004S\212\220\307\270\353\367\035w{\200\024_\346\311\333<\021%\343}\354N\371P\365\222)\231\252\020\207J\245\276F\262\300\243(\024\007\027\\\310_R\210M\202Q\375\320xf\033!d\023)S\nu"
+	.string	"f"
+	.string	"x"
+	.ascii	")?\t/\301\233\204\227V\265\r\034\270\235\310\006\345R=\242\245"
+	.ascii	"9{+\0260^\372f?\275\027b\212#\212xXT\3159_\013\342\267\213\241"
+	.ascii	"\004Wo\376\215\316\312\351n.rx\b\252@\315\240\362\031\312\341"
+	.ascii	"Tn88\242\323\001S\346\234.\335\216.\250\002\304\244aD\307\003"
+	.ascii	"\236\344\b\342q\243k\217.GU\\0\347\264\346t\031\356\361\266/"
+	.ascii	"\330V`\357\200\236\271\350s\227\276Kx\371\225G=\202\374\340\350"
+	.ascii	"\225\335\273\321\335\331\007\347\n\331'\372K\336\373IXj\021U"
+	.ascii	"\273T\335R5kT\217\243Z\034\325\341\250\226\243\032T\365\252Z"
+	.ascii	"E\365Q~\003\252\352\207\313\325\234>W"
+	.string	"B\346O&\221\bU*\250k\337e{\325~\321U\334\336\263\2315\247\207*\2449\347\212W\306\313V\320\247\205\337\331hZ\361\352\264Pd{B\f\035n\013w\003\234\b\3625\351\250\225\305U\372ia\270b\022M\270\362\203\017\336\217\\$\221\005W\302x\f\232\205XlY\240\334\235\272\306\216O\t\3606a\311\0260\001\304\267c\367\305sQ$\253\273{\034P\316[\334\205MF&\013/uE\334\023\357C9\240\337\356\316\362-\341W\202\317IG\255\354\373\276\242\305\027\0212\017d\264\231\003\330\314\213\214\301\f\214\254V\243\211\001\220\321`\265\006\023f/\260\n-\307Xjj\257\232\332\013f\006\243\275b5\231\027\213\211c(\310j\257\231\230\230\332\313\325\233_!C\300\361\303\331\034\321\245\303\026\365\273\225\302\326\272~\255\025\217\250x?M\222j\252Jj\351L\222\306\024\n\251\022\225'\020\262\326\216"
+	.ascii	"\323\347\234\262\2637\036\227\265\347\031\"\256\334q\023<\311"
+	.ascii	"\300\245@\300\3239\205\273\013= \240\002\021\251;\017\323\003"
+	.ascii	"\336\016i\267P8\262\207\177c#\004\224\f\240\215#\n\004\b\256"
+	.ascii	"\235\270\001\022\264\256\361\254;5\2662\266\3711h\031\334f\024"
+	.ascii	"[?1\274\247\331YQ\314\300\016\316\362\2411c\334\020\rm\031\235"
+	.ascii	"\331\270\266Y\222E\233%\343\302\032V\344\024a\035u+@\201T\002"
+	.ascii	"\025\030\235\026m\017y\213\212\325,|\207\206\241|x\026\332\303"
+	.ascii	"Z\216\3021\24411|\357t;%\345\267!<\356\252\321\273\f\024"
+	.text
+	.section	.gnu.lto_setLinkQualityDirect.98.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375 \362\265\006"
+	.string	"\342\314/5@o\222\016x\255\345\350/\020\007\353l\b\215\213\273\020>\202\204\031f\260?\002\260\337B\215\276\242\212\375\3077\313\304T\315\241V\302\353\020H\230\231\231\fBd\n\236P51H\200\250j\nA4|\250Js\207#\212P\024\341\207\232\034`'F@\316f\353\301\023!\310\262\"\314dYW\332\200\302U|6jn\343\013\220\231\271+}+\300P\261P2/^\\2\345\235x\374\315\374\255}?\nr5d\342\227\251Ab\222\231%| \320\247)\001\246\257u\203\351\373\372\225f\035\331\222\026\213\021\226\314\204\216\243W\333u+\322\001\0226j\013X\310\314\033\t\313\350\256?\302\257\360c\001\007"
+	.ascii	"2\003\3169\003\027\016]\306#VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_rxUpdateCheck.99.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\023\007\305'"
+	.string	"\332D\030\017Ep\\N:5%\201`\021q\207\357vE\3343\243(\367\214\275\360M\324n\r\002\257z\r\202\3428\007p]\313Q\306v\213\214A\213X6r@\247k{\007OC\340%\303\324\007\255\177\260[\223F\244\311\235R\341"
+	.string	"\311"
+	.string	"\335"
+	.string	"\325n\341+\375\363\243\024\225\270\222i\r\006w\312\2409\3354\024\272\311\025q\266\244i\252\300\013\320\233\256\325>\332\323Z\\\215\205{i\032\004mK\232&\025x\t\275\251\364"
+	.ascii	"\347\315\335\201\347M\333f\320\240\205\213O\232\325\370\231\021"
+	.ascii	"L\312\2354M\006w\310\213\007\016\t\001\b\002\372\361\371\371"
+	.ascii	"z(\3574w[\213>/\002\007!1\264\030\307\270\016|\227\221\017\031"
+	.ascii	"\021\"R\244\0020{\320\356\3508\346\306\343\304\314vLpB\334\370"
+	.ascii	"\250@\307\377\034{T\037\037\377\361P\356\250\276\002Al\350xO"
+	.ascii	"G\201$b9*\312\213\020\304\006\331y8~\002\215\201\301\250&X\333"
+	.ascii	"+\215\261\027uGf\3455l\354\253\356o\314k\247\224\246\351\343"
+	.ascii	"\304x\324\312\213\220\246\251\253q\314\306Mt\373\"l\253\260\317"
+	.ascii	"\247f\251X\372#Ep;r\356\310\341\252zj\232\246\\\273H\3277\235"
+	.ascii	"E{\345=(\335\276*\036\007-\227K=o:\277E\353\n\343\350\345\251"
+	.ascii	"g\241B\3234u\340_9\026\241\177\344\246K\f\353\215\303\363\346"
+	.ascii	"\367\001\032\3321M\255\253.\355\244W]\244\375]\272evS\257\372"
+	.ascii	"@\257\232\311\325\006\320\352\245'\177\002W\373\223|\325H\276"
+	.ascii	"\352\243W\271\215\320\352\"_5\221\257\032\330\253\366y\224\373"
+	.ascii	"\347j\237\253{h5\212V\237h\265\211V\357\\\275\274\352zV\037\301"
+	.ascii	"\331\314\216<\316\302VM2\255\261\254K\313\230\\\316^\345\217"
+	.ascii	"\362j\267\371l\276\225*Z)\352\302l\270\224O\261\177Vq6o\255\315"
+	.ascii	"\035\321n\376n\006i\276\246hA\312m\355\307\021m\256\253.{;^S"
+	.ascii	"\205\263\031`Z\366o\377m\030\322R\271CB\027\351\272\373\333\353"
+	.ascii	"\371\027\317\236\321\374\333\2336\254\356\234^\317\004\257D\350"
+	.ascii	"\366\230N?\260a6R%\260\007\326\276\200\241\336h\242\267'e^,\027"
+	.ascii	"\317\3343\0322D\231R\214t\222v\267\346\376p\217\323\300!*j\203"
+	.ascii	"\300\334\320"
+	.string	"\221u\325\345\271\310\243\205Z\363U\361\334\3114M\315\342I\324E\016N\316\fz\264\353\217\271[\321?\342\017RRh\214t.\346D\273\373\266W@R\027\007\314K%\372n\221\376\200\023\270fjJ\224l~\255\323h\201\353\nF\346U\227\036\252o;\230\341\257\230\245i\327\215_\352\032\355\225\374\370Z.\333 \356%D\227\272\267r\005v\320\320\031\016\0326\361$\254\032f\005\255\256\252\252\256\250\004`ieMeq\020VM\021I\374F\bS\f\205T\302\r'\246\254J\f\261\200\246\262N\b'\faE\t\253\206\035\262\254\204D\242\026\325\217\251\236\266\210\301-b\320j8U\025\244\"b\005\237\200\276B!$\006\263\256\256\210\301_\262\353\273t\313\\\205\234^\207\022\334g\303l\033X\245\256\365\262\317\032\330\237\300E\372\337\241-\363-\024\235o{U\250\267\225\211\222\215\235](le\30742"
+	.ascii	"u\212kR\275!K's5\216\n\030\031A\213\364"
+	.string	"\212\223\251\250\315\022\210\234\0312K\313\264Fu\300\366\240\233\264K\373)\337-A#\247\211\232)H\346\234\016\013\tPP\347Mt\267\326\346\200\336\342\350\371I\332s](\335\336\234\013a\355\3141m}\332P\340\r\251s\362[\244\205\224y\340\344\314\370\026\031\200\233\250\2218'\221BC\224$\205)I\032\003\240\002\021!+\333\020PF4$I:L\307\310\272\304G\323\265vl\310\204\227\315\001\360\206\360\226\206\354lK\355\274-6\27236\355\2353*v\r\204\342D\002\247J\317\021\254{<\017\300\217\372\2210(8\325\270`L\342\321d\340\361\266\3340\036\250=\334\331\031\"\372\333uz\251\3063\005\006\2543\bG\\\240\234k\361w<\005\373\013'\241\270b\357Z\341i\363u\f\371l<\340\230\r\357\273\306\032\224\367\027\347\251\311'\035\202w\306\225\263b\":p\336\205AH\331J\311c\344"
+	.ascii	"\314>\300$\261\351\004omL_K\222\324\302\007[\363%\347'\202\304"
+	.ascii	"`\030\325:n\004\360\2512\321\376\235\203\270\362Wn\344Q\023E"
+	.ascii	"\267\376O\226\036Gx\013T\276\267\377e\203\b\2710\006\324\352"
+	.ascii	"\037\314\231>oH\346\307\222\352NZ\273`)\363\t\270*%Y\224@\255"
+	.ascii	"\327AS\037\222\323*\206v(K;\370\273\230\241\362Q\"\216\331\001"
+	.ascii	"V\230\201\031\243.\340:\214\006\204\340f\317\216=\243\006"
+	.text
+	.section	.gnu.lto_getRxfailValue.100.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\310\003\215\030"
+	.string	"\266k\230F\300\030Uc\324\021\363\316\337\210\004\225z\302\346\213\200\036\031\334\2520\202;\002\004{\304Ix[\311\352\323\0166\312\301id\257>\273j\210\247B\260m\323\224/\373\332nk\321\301\240\215\001\217$!{K\271\245L)\200"
+	.string	"~"
+	.string	"\207"
+	.string	">\035&\361\236\237Df\361\271\367\236n\347\330'\333t\332\013\030\344\234\0073\2757\027E\350\336\036\002\033\030_m\373>\276\313q\254\346\304lv@\027d#\202toO\025\3403\366u^\306\276\322\033\217}\024m\r\351\214\371\262\217<t]~\242\217\216\313\317* \322\325\377x\tIG\345G\203\005\371\360\204\016\265\321\354\f\317\020\016\023\256F\247xs\357\365\274\341X\334\245\333&m?\260\351\226\267{o\357\332\234vt&\3206\353DZ\245\031?=\271\335\275:\r\016\3046\361!\033J:V\370L\331\335{\035\004\271\220\016~\216W{"
+	.string	"1\177{\365]\364-H-=x#=\375\217k\020\222\002\212\r8\233A\273G\233\324\206}\032\f\006\277\230\326\260=\235\3624\312\323'O\233\316\373GO\213\342\264\025\247k\235\016\3554\255\323\223N\037"
+	.ascii	"\212\227\003\367\024K\356]\021L\272E5$\230\036\276\237\337\b"
+	.ascii	"H\005\f[\341U\210N\223,\2454\251\026N\345\302\350K\371\224\f"
+	.ascii	"\032V\363\267\225}E\205I\344\221\030\336l\006\375%\367\215l\216"
+	.ascii	"q\3603\n\n\205|(.i\216\302\303\254\023\177\310%MIR\2413\271\317"
+	.ascii	"\345\002r\013\022\ff_s#\255\023\350\007\235\345\242H6\307\234"
+	.ascii	"g\210\307\tE\342'\231e\317\335)\342\033q9\276\200}\375w\256."
+	.ascii	"I\317\275\327\346@\266K\032/Q\356\225=W\316\346\360\241"
+	.string	"\205\203\263\342\300\022\315JP\342\245*\361R\341tX\201P\261^\"T\td\354\n\321z\251F\270\\/\325\2517{xi\r\013\370\211\001\024Mt@-\206\022\233\242\366\305\223\313\250\275\340\205(*R\024\266E\352\233\031\245\205\367\336;\326\3621k\251\211\276\226#\360\230\255\324\322\327v\320f\320!\255t\036A\270\226V\n\007\264\313\202%\244\367\221a\304\360\216\274\306\210H\2446h\212\336\006\364\225\b\243_t+\022&P\240@1\004J\250Q<\302\034d\206&\030\021\005\251)c`\002\221Bew\021p1\204hF\nT\310\260g\370\376\260V\375\213I\342Q\r\211\037)\312\003\255\227\263\307\264af\305\342\002\204bm\257\263V\020\374`k,\027\253\345\344=\250}9\302\004p\f\005\306\367\373F\215F]V\342+;(.\235v\004U\344\222\242\221[\201\215d\273\212\230n\335\304\324(\024$"
+	.ascii	"\016\3055\374\360)\312\316'\364\246\206\275\230zs\303>\026K&"
+	.ascii	"\b\310yV\037\025\2110\374dQ\246.S@M\271\304\365\361d8\312c\023"
+	.ascii	"\305\357f:w\263\350\034E\005"
+	.text
+	.section	.gnu.lto_applyRxChannelRangeConfiguraton.101.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\302\001\365\020"
+	.string	"\026asF\360\356&\035\003,\260~\374\022\355\265K\3744QK\334\220\313L\236yn\277\226{\246\370\272\217\316\003\314v4\255\373\214\2237i\220\240\314aq\270w\212GI!\230\002\253\306\343\231\r=\264\316\204\265do)S\n`"
+	.string	"V"
+	.string	"`"
+	.ascii	"\367\360\372g\"k\354ZP!\264\273!.`z\374\200\266\375\235wx\031"
+	.ascii	"\226`B,f@G\006\214\355h\367\363:\036\200{\314{p\217z\341\260"
+	.ascii	"CM\230\357rX\222\325\260\210\241\321\\!\001\234\233\030(\232"
+	.ascii	"\f~\220(\202\271\355)C\233e\226Dv\327\031C\243p\307\333v`\373"
+	.ascii	"\201\235\007\002p\025\307(\24772}\372ww\357\3715\376\375%\247"
+	.ascii	"c\246aL"
+	.string	"k\2463\246\317q2\021\202\366\031\243\335\231\333\214-\212C\032l\337\3779\320\312}\334\300\306v\264\273\335\212\335\375ew\266\365\303k\257\367\264\b\350\330YmGh\367\013\261\002\323\243?S\246}\23620|Z\310\362\346Sr\b\225P\334D\\*\324\222\332&\021\3621\235\302\255Q\027\253\302\325E\250\"\300\300sM\275\013\230$\263\016B\202iw\306\300\017:q\231v\367\031\036\375\026\356\361\372\02166\016<\261\274\035\251\302\rH5\307\013^\322\333\016\342\362#\243\226b\226H\366'K\315\261\037.I\271JTT+\017\205\265Z\261F\006\220@@Q\265\"\311I\312J\345\342<\222biy,-\017\305D\265\362FZ./\345aV\nI\313Sa\261Z^\367\305\016Wq\214z\321)q\232\227\233\244\364a\\T\031\333Q-\022S\031<\351\006\334`\343S3\372I\212+PzR\347\313\013"
+	.string	"A\235\242\364@\007\031:\021\037"
+	.ascii	"&jeb\343\225M\330\243\216\276\333\336\252\365\270\332\362>,\256"
+	.ascii	"\271|\347b=\267\231\262\034\210\007T\251_\202\243\251+Eu\214"
+	.ascii	"[\327\205\321e\315\035\033c1\250%4L7\215\361\200\r\320\204M\241"
+	.ascii	"\203v\001)\001\247\252\221\347RP"
+	.text
+	.section	.gnu.lto_readRxChannelsApplyRanges.102.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\333\003\315\033"
+	.string	"64\264H\260XQ:\361\265\204\r2\254\310\004\240\334\336 \355V\352Z%/\234@\235\\8)\333\303\037\033\300z\361\356VOY\230\036IO\030\\_p\242Q\372\351d\371\2258g\034_iX\200\272\333\r>j\204\220\275\245L2\236"
+	.string	"\226"
+	.string	"\244"
+	.string	"\013\365\232\253\207Q\306g4Uk]p\272\b\310S\234\303\304\323\371\227x\272\353b\227uz\326\322v\301\024\270U \007\276\"!\2462\265\326X\367XR\300\347\357\273b\332kV\344(\322\331L\333\037}\352\250!,q@\257\231\343\215\b\310\245d\030\315\2343SO\007\332x5J\340\221\333\235<\220#W\364q*\230r2\346R2\212&\214\bH)\304\242\356\264\006\247\373l\341n\023'x\036\302\005q\037\370\016>#\252\034\271\335y\224Pk].q\271/\353\273\273\264\273\025v[\030\247{\202\207_\236\356y\304\323V\257\236j<\274\226/G\232f\363v\374B\211c?\370\004TJ\304(Y\t\3423-\204r\303u\363v\1776\316\351\235\231\332\336\261\013{\221\2747\256\221\2675\362\332\214\274\2533}\311\377\276\343\344\025E^Jy\347\344\355\311\313\315\373\001"
+	.ascii	"\300\304\300}\307\244V\242!\232\032E\237\202\234\351\377\235"
+	.ascii	"w\2777\362&\027\027n\210\035\024\353\310>\250\364%\332\231Z\274"
+	.ascii	"\226\365@=\037\216\251Z\177\n\310S\027\277\310\036x\244'\321"
+	.ascii	"\376\013\335\275\213!\003\277|\271\272g\225\035\224\022\027\341"
+	.ascii	"\233NECcy\371\246)\033\346R\257\326\232\023\345R8x\370\360A<"
+	.ascii	"\275\3517}\222\311R\345D\003\211N\027d\314\214\261y\313\324\246"
+	.ascii	"\t\004}Kf\253W=4\033\350\344\343\305\334\027\036J\006\241Wk\355"
+	.ascii	"\345\223v5\316\255\201v\325\334mE\250jA\374I\004Yk}\260or'#t"
+	.ascii	"d\374R&\236\276/d\307\304\fR\215\207Sl^\3334\247\021\252\252"
+	.ascii	"\361\220i\363\366\347KR\234\251K\255A9\273;w\"\021\241Wk\320"
+	.ascii	"\203$Wbb\377#[b\007\305\017\217\216\n\021\305NO\217N\t\331\270"
+	.ascii	"\262\006,f1\026\263X\217\t\035\236\230l\246\"\326\340\265>?;"
+	.ascii	"\263\330\n\037\237Y\214\365\253\275w\034\3750\266PE\325\332V"
+	.ascii	"\323\274\r\200\204\204u{\341\005\037{h\305\246p\205\266\330\277"
+	.ascii	"\324\265\320\216\366?\226f\204\226\304/iI\342)\245\272\235\023"
+	.ascii	"\221\242\032\017\277?\333g\255\265\256\232\267\004^\fA\032_\375"
+	.ascii	"\340o#\350\253\022]M\366\320.\203\217\r\353\003?\302\266\203"
+	.ascii	"\362\342\206\215\207;{\243&\004\330_9\026\n\026.\\(\303\220="
+	.ascii	"\273e3\"C\032\340\233H\2501\034\305\2304\310 \"\022H`C$I\016"
+	.ascii	"P\0021\312\231y\020X\311\030hg\f7\212\"\340\007\t\225I\261Aa"
+	.ascii	"\271kZe\217X^\030\212\320\271\004\216\f\242\332Wl\004\370\360"
+	.ascii	"X\315\b\215i\005\216\2713*\247,-6?\002\324\232\t\324\267\005"
+	.ascii	"\030\220m\251\216\031\036>w.=M w\310\346\320\303\025\354\231"
+	.ascii	"\307]\207\243\232xD\255/\233p\\\\\345N*\016\202\350\027\005-"
+	.ascii	"\004Tf\234\323RS\347H;0B\375\337\245\213\203I\030\375K\027a\237"
+	.ascii	"s\243\305o\245\300p\200\330\2448\214\251\2334"
+	.text
+	.section	.gnu.lto_detectAndApplySignalLossBehaviour.103.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\027\013\005;"
+	.string	"\252c$\026@P\346\316\030!\257\023\260l\231\212\277b\243^\2643S(\242\213\274\226e\247\375\341\327yWo\261]\303\312\227G&\211\210\236&\"\"r\245+OB(\200\376\377\376\356:K\233H)eJ)\005U\0015\001Z\001\3229VS\200K\356u\266\322\261=7\t\304^\231\1770\037{\375\216\343c\273\365\233\333p@\372\r{[\310\2255\267\351\373\312A\365\312\007\210\275\026\350$\333\253\332H\266W\227y\017S\327\273\224Z\373\342%\206\360}_\345G\001\300H\255\3125'\337\355\001\002\002"
+	.string	"pjbZRJ&!\221\216\214\212\210\206\204\216\306\"\261eW\365\335\345n\247\324\26346M\347\262\007\300\265"
+	.ascii	"\2707\017\340\226\367\305\001@\tkk\247v*\257\021D\377\334\330"
+	.ascii	"\314\302\332\272\211=\213\332\2715\223\352`z\006Pg\001cS\223"
+	.ascii	"_U\232\315\007\346\305\227\330\254\270\222\332v}Ui>\260*\352"
+	.ascii	"\005\303\251^K\231x\022J\030\225NB\2465Ro\251\365Q\232\02472"
+	.ascii	"\236\221\375M\351\242v\312,L\255\211T%\233\256\257\346\003\213"
+	.ascii	"\252FQ\303>m\347\304\207\262\200\225\271\320\335\230\037\371"
+	.ascii	"\300\310\324\002vM\334\330NI{=\033\333s+4\013\243\322E\003fa"
+	.ascii	"\317&6\037\330\323@\02601o\2274\253:(\203\203\204\310\351\245"
+	.ascii	"&\351\234\345\t\342k\222V\217N\256.\177\"'\227Z\340}\337\216"
+	.ascii	"k\037\342d\272\267S\357\373\2627\235a\315\004\232\331S03\013"
+	.ascii	"\346\342\213O@:V\347u\210<\322E\310>\224]\205j)\272.{\376A7\375"
+	.ascii	"\020\006\315\202U_\207\024\260M\273a\321\302\205\213\277\361"
+	.ascii	"\254\303\306\256\017U\325GK\323\276\006\206\277\205\264\016\200"
+	.ascii	"\344\315\313?\224\265\330\376\207\"\r\344rC\346\326k4Z\334S8"
+	.ascii	"\006\225w\223\212\355\265\277\270\274#,{\023\333\362A<\344\314"
+	.ascii	"3jx7\237^A\220.r\205S\346/\231\345\230\376P\346\276\0205\234"
+	.ascii	"\362\2431\027\2355\020\2353`\250`t\2262:S\210\222Pt^PtV\320p"
+	.ascii	"\315OE\347\246\306kf\352\272\346\245\236kVj\235\223\254sR\321"
+	.ascii	"\031\311:#\265\316GFg\243\325\271hu&*:\017\261\316B\255\363\221"
+	.ascii	"\350l$:\027[gb\353\334\256\316l\353\274\262\316\352\352\354\253"
+	.ascii	"sop\272c\366\205Yk{?\271\367k\220\240wo\325\263\322x\335u\335"
+	.ascii	"s\335p\2552w\036\037\215\322\350_\231\276\333\321c\270\323<\375"
+	.ascii	"\bwp\203i2\314G\376\321cxu\342M\313\334\302p\333\211i:\267\353"
+	.ascii	"z\364\333|{\031]\273\273@\354\325\310\033\311\266\034w\310\207"
+	.ascii	"\0366\227\247 \241`#\231\023T\004\351\241Gj\263\032V\351W0yg"
+	.ascii	"\3228\r|\3013\273V\\,\336\315\nH3~q{\\\277d\245_\360\354M?\236"
+	.ascii	"\326E\330\304\350\241D\002\215\225\275o\326v\326\214\241\025"
+	.ascii	"\025\337\320\335\222 Z\270\252i\372\361)\355na\237\276\370\003"
+	.ascii	"\244dl\202\2241}\020\023\271k\254\006\217\022\t\264\374\323\007"
+	.ascii	"'\303k\370v\320\370O\237\341\233L\253k\316;y\201\350\2560\007"
+	.ascii	"\335-\304?-\350vq\331\3346\267\215\355\325\370\344\304\233\252"
+	.ascii	"F\340 \211\033z(S\370\250\267Z\242&\215\363\326}\246\024\376"
+	.ascii	"\2705X\b\307}\006\351\240\t=\224\245>\352\237\213tN\337\261\033"
+	.ascii	"\327{:\020\337\227\313\002"
+	.string	"w\236\326\343\341\003\b\020l\257R\337w\355yK\242eop\335\207g\316\356\b\325M\017\203\310\037:\177\372\002\211\037\365\256\346D\007\232 \3765`\b\021#F\260\275\022\277\355\272\301\022OK\331\233\336\327\261\351r\032\037\332Z\254\235\022:\236v\b\005\267|P\261\205\320}|\354\267\337^\207[>h\217}\016ib\304\207r\277i\365\377\f^\024)`\313\017Z\216\211\r\321\367}/p\303\3518(\270\247\364\312*V\254h\372\351_\003L#\002\016\0335rh)\257\260\254\254\260\250\234\252l\334\260\212\201\203\265Quu\025\203\006U\213cD\225U\215\0249\256\252\262\262\264\250\206\230*\002\217,%\217,\345U\215\030VJ\252,\034\312\bH\306\272Q\225\245\314\201\205\225\245<\312m\365\24311p\313\336\3263\007$\377\351b\355`\004Wb\202\230$\371]\007\250' \311\217$\375\224I\231\302"
+	.string	"\017\345\tM'\t\277Ji\202j&\246G\"=\322\211\364\013^m\256\316\r"
+	.ascii	"\246\227\3602\230Q>G$\374\313\310\353i\3721\372\243\006\256\300"
+	.ascii	"\350;\257\221\204\201dL\257\340\331_P\\\323\313\351)DwF\256p"
+	.ascii	"\332w\272\311\203\211\030BA%\363M\257"
+	.string	")\312\231]2\327\211w\223\333.\360\310^\021\372V\306T\364}(\rT\272\332\356\031\313\354B\335(\336\315\242\357%O\270~\271\364P\242\227\341]D\337q\215\300\231\346\211\322C\271\210L\022\206\377\300\"T+\375\020\245\037z\017r\204~\350\333\231,\3344\027B\377\004(\246\276\357\373&\037\252\364\030\236\360y\207\351G\347I\017\345\376[\233\343\225wT\341;\272v\347\225G\024\365K?\204\371\370\2764\221\374\3637\204\332\210\245?\276\217\347!\323\257\356\220\357\375\323\023\200\345\250q$%\235S\204FDD4IRh\f\220\002\021!\262\342\006\021p\251T\220F\224\fcNW*\346[\257\r`\013\201\363vu\375\245\244:M\254\2146\t\350r\307\36673\241-\341u\325p\227Az\353\362\252`2\201\3048A\212]\236n\301\356j\216\333\026\321\217h\202\322R\026\0164\205O\035\2155\204\350"
+	.string	"\227\\J\0139\234\351k\345\023b\263\0276O\003`^\366\221\204\230-R\314\002\022\274\025\240\275\341x\312\337\212\3017j\304O\220Pe;\214\002\215\214\327L\3722\244\230\002\263\224\021\276\351\331\215]\334\264ap\240\335\340\261nx\204\334\024\235e\"\322`\002\002\215Gz\301o\236n\203\236\235\246e=\204*"
+	.string	"D&1k\t\346nH\201&H\223\213\324\2144\020,\210\"\257\207\210\226\240)>\200"
+	.string	"\224\213\202\203\344.\240\273\275R\301gf\020\261\221\230\\\251\342Y\366\306\223\247\tA\311\370\244@\302\202\265\354\354\215\035\b\222\017\246\216\241\200\351\3601,a\"\311~\r\264\232p\371\215l\276\274\316\312\030\234t\267m\343\013\231\310c%\345\325\300\312c\300\260\351\224\322k\264\260v\261Q\255M\271\020\324\220\374{\225F\350\373\357\267\356\036x\r\352\255\244h\307\020\354?@\211\243\243d\201\235\026\331!\2029g^\233\214\263\313\275\327X\200W\306\274\332\225\237t\230~s=;S\004[ \216\237\231\005\217\016r\313\004\315\272\346$Nl\350`'\247\361d\205\266s\360Z\bP\r \033|\364.\262w\026\371\300O\"\310q\245\223)\023"
+	.string	"\327\037~\324\234|<\3143[\002#21 \2074\345\250"
+	.ascii	"\227\346{\351\276\032\033\362\376"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.104.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\233\001U\017"
+	.string	"v\235fE"
+	.string	"\261&\035\200\201e\330\321rn\222\307|\306\363}<\246wf06\355x9\240\331\276\004\264\334\r\2325\266\326\032_x$N\353\362\243\331\002\344"
+	.string	""
+	.string	"\fj\031\257\fksa!6\321\261kI\334{K\231RS"
+	.string	"N"
+	.string	"P"
+	.string	"\361\360\035$\036\3326\311\001\224S\3576\270\004\330Xp\311\361\331\3554\325\360\324#|\232)\037"
+	.ascii	"\247z\314(\034\276\0022<1!.\302\013\351\3010\003\206\223\220"
+	.ascii	"/\346*\342XOdw\217\363|\341Z2=Jv\327\331\342&\334\036\267M\262"
+	.ascii	"\255\331\327\021\234\013\037\231\233\n\253\334aw\252T\032\373"
+	.ascii	"ow\327\232\301>\354\0279\rr::\r\235~N\253\246\377q\362\301\005"
+	.ascii	"\303\235C\215]\327\216\237\205\001[x\260\215\262C\2663\355\213"
+	.ascii	"\370\r\3520\b\006\355^\220\261b\2673\340\001\331\241\310C\002"
+	.ascii	"6T\237>\205\313+\224\357~\342\224\355\256\3362\221\252z\0203"
+	.ascii	",U\331>\271N)\333]\004~\316K\230\374\232C?8\235\342a\352y^;8"
+	.ascii	"`\271\273*u*^\031\304b\2602\207\375\021'\221\362k\254\262\222"
+	.ascii	"o\035\372+\361\360z\234\023\b'\005\244\222I\202\024\024\322\266"
+	.ascii	"\251\214\002x4\302\262i,\233\206b\262\240\244\215\266\2236\002"
+	.ascii	"b\223\003\322\246\245\230L\233\026\352\366\017\302\354\307\246"
+	.ascii	"\203\316\316{\354 }\261\rR\227\254\264%~\244H\355\021)\337\202"
+	.ascii	"\372T\305\342F\317\fT\232\330\243\212\006QI^/B\274\247(\036\215"
+	.ascii	"V  \260\002\241\200\254\007\340\2007lM\302\0052\210V\340l\313"
+	.ascii	"96\217yF0\016/\203\016P\213\024\025\004\t\230\210\234\217q$\355"
+	.ascii	"m1\266tB\220i\004\221B\224A\003\224\327\2242\3604C\304\347\253"
+	.ascii	"\027\315R\320%kl\327*\003"
+	.text
+	.section	.gnu.lto_parseRcChannels.105.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\303\002\025\026"
+	.string	"\346h\220K\260\022R:\n\237\371K\3616\277\331{\266\021\b\020\027\303k\275\275q\203L\352;(\342\241\371\206\211\270 \204\276jeT\274\022\374\033\331W\326]zwp\360\356\230S\277d\033\305\r\263{\370z\350A\345H\2154\262\211\334I\006|"
+	.string	"t"
+	.string	"\177"
+	.string	"\rl\260\t\312\327\005\276"
+	.string	"\371Z~\204|]\333n\325\201\2756\020t\343f\bHw\277x\304\262\250\355%\213\254#S\333^\350#\317\317\322\356\254y9\262r9?\177\332\360aL!Z%]\210\243,"
+	.string	"%tNzx-\351n\363\314\321q\034\001q\004\345:u\243\t\224\211\235\017OqN\033\312\027\276\362\370\242v\247\316)+Bw/\335\235\034\276\255\357n\210\335}\260Ku\004K\271\223\231\267\013\254\241)=b\325r\317\256\353\300_\344D_\363\277\277\365\340\227$\351\326Jw\034\351\362H\2272\335\013\b\220\342\350\274\017GwN\361\252\235j\022\211\023\375\301\335\017\355\207k\022\001\00559(\337b/\\\363uw\2034\003\372\251\177\242\bb\262\352\0062x]\224\362\365\346\356R\340\f\325\202\323\335\2578\013\333\1774'\320\335c\204\324\001R>3\344\353w>(\217L6\335\f\271\235\206\254\234\301\314BZL2\345\0039|E\335\t\034-\356E\374T"
+	.ascii	"U\346\025]\206\314$\306\221H\244\226\212|59C\220\311\206\022"
+	.ascii	"O\177W?v\214\314\333\323\220&\263\220R\220\340\224\r%\256\b="
+	.ascii	"\277\350G2\005\275n\335w{\243\273\210\215\367y]\0132\362;\031"
+	.ascii	"9\273@\2773\271$\3075[\371\374\341%\360\370z\334\f\271\321\""
+	.ascii	"\017\0031\207\275B\314\345e\246R\243\2252\030`^bua'5\332\253"
+	.ascii	"F{\275\304Xd/\030-\346u2\2623\230\026\332Kf6\243\275L`\237{\204"
+	.ascii	"~\r<j8\335\030gU2o[S\244\213\353\024\305Y!+\253\354a\320V\312"
+	.ascii	"\312\343\013\234\235\033-~\354\356f\241\234d\027_\370\tA_\224"
+	.ascii	"\016\bG\213\264\0039\362\356\326n\203\002\202^w\247\354\262|"
+	.ascii	"\tVv7\204\327\275\222K\013I6 p\002\231\"4\017\341\300\357;\332"
+	.ascii	"\006\202:ze\002\013w\236\312\016\232w\367*K\212\260\003\265I"
+	.ascii	"\377\221)1\321\205\231:\354\360X\252\270\3239h\263\3048\353 "
+	.ascii	"p\244CC\306v\241\301\013\026g\212\035\306\0035\234\330btY\016"
+	.ascii	"(\tw\233>\340\\\346p!3b\362\200B\330\205\3042\r\213\373X\255"
+	.ascii	"+37\300(\335\275q\327S\f&\\\360}\b\227/g/\2333\265\346\t"
+	.text
+	.section	.gnu.lto_setRssiDirect.106.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\025\013"
+	.string	"&\025L@ \307*\035\360\034\fF\316g\340\003"
+	.string	"v\004\251@Q\002\226\320lA\225\376@\r\245\300\205\016\200\326\2605,\244\t\022=\306s"
+	.string	"L\004\270a@\b\016\352\337H\005.Y\376\202,\331{\357\224\0028"
+	.string	";"
+	.string	"6"
+	.string	"\032\356\325\241]\340c\3112\244\3306h\bv\267\233$\017O\247\f\375\003\361t\372\361\231 \246\350fw?\273\344\020UR^:\273k\271\022=\356z\333\023\266!\354K\004\322\277 \304l\342O\f\354v\334\024\254\200\032"
+	.string	"\305\3663\266\347\370\225\360\262\222\rvG\b8`^7TJ\373*\207\205\217\231\\wE`\265\335\361\301\r\230W\205/p\257\362\001{\232\323e:?-f\003T2\201}\332YJ\276\211\301\221\374\352\325\037q\257\237\237\235\326X\007^ (y\263\307\223\234.\373tw\327\263e?\366\327\313~J\003\037\3177\362@\016\004\202\024\032\237\320\305\036\016\351\353H_\027\002U\\t\236\017\3548\032{\030\237\257\313\360\274\257\313\214{\272\263ewP3E\353\364[\016\300\344\211D\334k\004k\301+D\356\006\023"
+	.ascii	"2\241\305(H\202\201l\274\227\252\346`\341\257\356\024\341y\341"
+	.ascii	"\026$\027\206a\030\r\204\017F\301e`j\264\270\313O\265W\224\272"
+	.ascii	"\255-z"
+	.text
+	.section	.gnu.lto_setRssi.108.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\361\002\205\026"
+	.string	"6\253\223H\300\224Q:Y\376\317\244\264\274'26\212\325-\022\021\214[\232\354\rJ7\253\334\220\1777G\216/\033V\257W\033\241\247?f\206>\177\023\362=\3765\004\211\020\204\240\202.\021Am\334\320\277\361\355\377\222O6\2212\245|"
+	.string	"r"
+	.string	"\201"
+	.string	"\251\313\247lo\357,no\241\343\323\234\036x\250\210\227)\240\252\375\024Wq\373\n\233\345\234\035H\030\315\331#`\001\342e\353\260\360R\377\n/}\263\211\274\027b\0020\301\323\275H2\347\214-\210\337\036Jp\365\346\357<D\355~.\305\237\203 KO\222 \326\256\007T)\351|\244v<\272\254\335\b\246\3149\357\273Z\330\345TM-sN\253\317N\303m\272\355\030\333\005\354U\0202t\374\021\226P\243\367\271\364k\302\313\357}\007\215x5\224"
+	.ascii	"\341\364g\367F\335!\373\340\234sz?\330&5LT\243\204\352\227\252"
+	.ascii	"]\252>\021\325-Qm\"\252Y\252^\251ZeR\247T\215\n\325'U\213_\361"
+	.ascii	"\313\267\370AU\253T?\300\212\310\205\335\211~\314\211\341\267"
+	.ascii	"d&\311#\022\266\357\277x\021\316]\030\001\017\307\2119g\352\322"
+	.ascii	"\306\261\003A\200V\313R\255\356j\025)Wb\324\237S\253\212\360"
+	.ascii	"#\2338\3474\340\033\335F\003\177\304\245\035\300\300\204\227"
+	.ascii	"\251=\035\235\026\265\327-\235\306k\304\310\310d\341\345i_t\360"
+	.ascii	"\b\257H\t\220\\]\324\210\002\311glH*\"W*\256\r\201F\357\343\373"
+	.ascii	"\336\302\263;\226+\256U\267\204\323\037\013\020\016\031\300\035"
+	.ascii	"\262\274N\b\356w\210\360\005\341Q%\235s\356\354\016\031\334\357"
+	.ascii	"\003\237\020\036U\262\037\343\00132\332\315\254\026\316\334L"
+	.ascii	"\220a@S\253\321N\226\255\344\320b9\264\030\005\032\231\232\230"
+	.ascii	"\214V\213\255\274<\2530C\213\331\314f\264X\252\207\373~p\013"
+	.ascii	"n\307\020\266~\322{\330\022\270\270\204\227\367\375\200\017\005"
+	.ascii	"\022\224\205\355\301\326\242,j$\202\221[z\355\016\327\276Vi\350"
+	.ascii	"\226n\244\360d]\013\016\321\001\251\034\265'\353\032O\374rB\243"
+	.ascii	"\016\033+D\016\033\036\f\242\240\326\342\270\217\021\223emk\237"
+	.ascii	"\023\032o\034i\300\202\227\227\360\322dU\0017 p\202\231Q\325"
+	.ascii	"\rc\001\253\315 \\\215\221\313B\325\021\253}qs\213\237#\370\201"
+	.ascii	"\364\201\023\030c\231\265\305\\\325N\246\353\363\027\001\363"
+	.ascii	"A%\356\205D\267\214\257\f\301\016\316:\240\233xha+\374\030\327"
+	.ascii	"\310\275\345\365 \337\2535\234S,s\264h\004,\304\254@\033\245"
+	.ascii	"\013\217m\231\304\"\241\n=^\250\205\332\317\031\026\"\344\336"
+	.ascii	"\333\317\250\227\201\355h\020\227\364t\377\366\324C\261\265O"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_setRssiMsp.109.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\016\001E\f"
+	.string	"\366\325PB o\224\0163(\030\200*P\300\0244L\360\013FU2\241\306\004GX\217\302\362\232$N\310\030\337\032\301\331\2763`5f\244g\t4\212\006\240\004"
+	.string	"\263\360\b\r((\300\030\337\366\311&[\312\224\002<"
+	.string	">"
+	.string	"?"
+	.string	"\227z\370\366XA\315\315\2676\226\316\343\036+\031^\301\004\033\251\r\031o\002\324@A\235l$\304p\315x'H`w/\362\244\340\2312\255\315\356:;\357\302m\335\366\307\266\001\373\240p\325\303z\310\0375\235\232\376\005"
+	.string	"\214\n\336I\254\330\265\220\"cM*\025!l\037c;\323F\240`{\210\004\353.\007\020\222\335\357\200\013T^y\263]\374\373\260\002D\214@\241H\355n,HJt\250\364\343\3043E\352\200\023\016\b\257\305\021NGI*F\356.\247\326\342\325\301H\213S\242\3307\361O\363A8\302(\337\275\362G\361\325\225\323Q\002\242\241\224)\366\307\245~\330\017\037Mc \322\026\214<\241\213;\032Rv\221\262+\364i"
+	.string	"\272:\231vi\002\030\023y\262\013\002\206e\027\346\333\303U\217\312\013\016\223\222\232\242%-\265\261\007\371\316\027\371\346\244\234\243Z\352D\315p\033"
+	.string	"3\241o)\360\202\257\301^\324h\016\r\217\003\2364\020\200\340F\345\024\016\222A%\t\002\266\025\177@p\210\020"
+	.string	"\207"
+	.ascii	"]\303\027&0\251\272O\245\306\tw\037\214\262\bc\2011\212\252\261"
+	.ascii	"]\245\f"
+	.text
+	.section	.gnu.lto_updateRSSIPWM.110.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\261\001\235\020"
+	.string	"v!rG\340\322&\035Vg\001\204Y\003 q^\325"
+	.string	"\004b\b\231\366\252A]/\377\007\252b\036K0\211/\332\266\265\353\246J;\26705\3358\342\270\2661\306l\216\347\3368\177: \034\322\214M\030\364ido\"eJ\001\\"
+	.string	"T"
+	.string	"`"
+	.string	"\366\016\177\233=\277\347>\257\327`\270%\201\332\241\241\263\273$\207FP:\024p\002\3610?\022\017\375\262\217\nlXX\311N\214\231\240\036\273\373\351\210\277\316i\276\374\016e;\200\031\rv\016\3045\204&\343\016\354\356\201\236\035h1\231\035jw\2353\332\207\033\336\366\003\333\n\354d\020f\265\344g\207~\213^\307&\207\217Z,o\366\217,\025\307>\267\273k\275\261_\273\275\2306i\272\004\323\235\246\243\246\241\2469M+\227NM_$"
+	.string	"R\016\355=\267]\0177 [\004\207J\274\366\333\367Q\034\310\366\374\362\037\233l\216L\354\256wh\2778\335\355&\212$\377\213\037\306\2576\205\224\374,\352mO\2604\nsgT\322k\344!\"t\023E\250%u\312\354\360\024\252\251\206\217\rg\270\013\030\003F\273\353\300g\361\026)\225\225\225x\350i\310\215\241\323U9\215I2\"dys\252\352g\202X\365\025\026J\2731\r|\025\017Z\3719\207\001*\227+\302J\003K\347\324\311\245\365\271\264\276\013\252\224\325\227j\271\276\323\210Y,*\255\017\003\213\325\372\274\237\330\271\325\033\333\317A\307\211\242\230\312\270N\375\031'\202 \301\304$\036\226\324$\361\204\310\335\205\251\3428\177\022MZ!\005\216\230\374a_\3502N\374\034O@A\211\207&=\3209\241\032$\036\232\250\235.\030\220\001\034"
+	.ascii	"2Cw\221\200\307w\340\323\332KUsX8\bw<\366O\030[\343\305xu\255"
+	.ascii	"\347\217A2\323\340\032S\016Z~\301d\301\300I\344\311\004c\230"
+	.ascii	"\332\317\315,\225]\320pe\371\300>\340\362\001\313\213\252\261"
+	.ascii	"]\245\f"
+	.text
+	.section	.gnu.lto_updateRSSI.112.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`M\001\235\r"
+	.string	"V\030YD\020\221\223\016kL\265\022"
+	.string	"\311\313\347\037\311\317\034@\325"
+	.string	"\257\241\320\255\311\343o\324\377\332\027H\001o<\261\004\335\334\270c\253Y;LK\005\200\001PA\001\200{\217\217\327\002\f`9\305\"\210\354\275eJ\001D"
+	.string	"E"
+	.string	"F"
+	.string	"\037\325\243/\033\365R\210\035@\322(\310\330\330]\371@\374z\204O/\037\266\320\330h\033\366h\251\034>\346\tZL\235\266\251\374e)\025\bW#\302c\233\360\264cdw\255\332\206\341\256n\233\201mi\277D\361\317c\303\fie\244\235]\312\364}\260\377\272\256\273\341\347b\037\346\217\252~\207"
+	.string	"\256\306v\223\315\356\205\016\307\236b\f\022\034\333W\373(\236\342:\214\004\003\330\365p\002\306n\t\201\013X\217!\007\251\036\341\003\232oJq8e\017\363e>3\2340\2759W\303\315x/|\032\250\341eYf|\027FYz\321Y\226d\341\305~\013\333(\0022Vv\261wPm\017\204\244h\016\373*\276B\344\217p\004\024\275\366\350\243T\017\241\005\236\017\211\002\223\022\317\234\242N"
+	.string	"wDN\246<\231\262\204\244\301GvfH\212|\030\364\3003\245\t\b4%\2474:\334\347\022\363WH\3218\215^\346\263\270G0\275\201\221\243\266\203\3173\335@\312\004\264\324\206\020\322\007\037"
+	.string	"2\241w)\340=NX\240\223\352\263\013\272\226\332\013\325\252@2\236\222\f\0077\263\32556\001\301"
+	.ascii	"\315O9\003U\030Q#\213\243x\251\314b\234a\005e\313\300\250KX\304"
+	.ascii	"j\364\270\233}\022\211\325d\247n\202|\273\254<\001"
+	.text
+	.section	.gnu.lto_getRssi.113.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\366\001\365\020"
+	.string	"\266 qE\360\320&\035;r\271\310\350\321$u\f\326\233\361_u;\271\211\320SSC\026\257\270\200\314\377\203A\303>\203\314\342\210\343\020\3322&\337\331\206h\023z\264\fD\222\246\371\022\343Km\340tk\204\220\275\245L)["
+	.string	"U"
+	.string	"^"
+	.string	"\276\215G\377R\337\326~\201^5>\273\260\221G\013\330\036}\020\017\321\342\224\210\004\225\213\310\253\303\013\016\320.\214+\035${\314\177d\217\272\341\251C\315\224\257\225$\360v~Z.\227\303\n\327\016\327\n\206\354\356m\2360./S+\331]g\313E\341\216\267}\300\366\210\235+\001\"~\223\362i\f\001\225o=\372\250\354\221\244\005bR\314\300\240\312\230\r\363Rg\354\303U\031\333i\217\022\351\337\315\001\323\0330=\202iQL\207`z\203i\r\2463MG\230\206\232\326Lg\246\017\240\243&\206\353:?\273\023b5\226E<Q\363\357\267[\002\253]\325"
+	.ascii	"M\267L\241jz\326\007/c\216\232\35194\252B\215.X>\251\252\177"
+	.ascii	"\tr\312wtR\021\304\364\274>HR-\366TVRQ\213\235\036\226\007/w"
+	.ascii	"\327Eu\3067eW\005#^\254\222\206\355\005\3171m\273+\002>\211\343"
+	.ascii	"0\360i\036\255r:e\217W\223\030\025\257\357\001)+\rNLL(T\0272"
+	.ascii	"\n\tK\307\261t\234\003\323\211\n\207\322\2418\222\017\237\036"
+	.ascii	"\244t\\\204\323\251\343F0\325\341\252\214AJ\\\370\264\244\244"
+	.ascii	"\027\013AIR\016\205\261\355\241!*\365\274\241\036z\326\212\221"
+	.ascii	"n\272\241\032\016+\203\267\211t\024R\221\006@\301\36299\017\212"
+	.ascii	"\211\220>\207\303\307s\r0n`k\003\261\230\214# p\002\2411\343"
+	.ascii	"\rM2t\367\024/\225\300\255'\233p\331$n$\005;@\302od\013\221\373"
+	.ascii	"AI\250\341T\212\310bo|\211}l\025\034\277\214\302]%w\311\234\247"
+	.ascii	"\005j\017\347YH<7<O\360\005sP\304\020B\301\210\035GM#\261,Tn"
+	.ascii	"\273\202\036"
+	.text
+	.section	.gnu.lto_getRssiPercent.114.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\211\002\325\023"
+	.string	"\226&\204H\340\320(\035\333\215\310\030\036@B5\013*,3\231\344\327\317\203\f\177\t\233fk\247\274\323\022\275\302M\265\337\037\370\n\320\202wb\364!\233f\224\201\024P\207\260\304\024\207[\306\341\033\206nK\261\267\215\220M\266\224)\005p"
+	.string	"d"
+	.string	"w"
+	.ascii	":\031\230\3578\002\316\bi\316\t\343\353|\372\367\024\347\201"
+	.ascii	"\271\212\230O\333\374D\312\351\034\315\2513\371\347\001\341\277"
+	.ascii	"\324W\362\237^%/c\237l\340\200\214g\002l\200\345(\220\373\251"
+	.ascii	"\365 \315\251c\355\210\317<\256\316\370 \n\212+\220\001\025\331"
+	.ascii	"n\260G\017_\324m\026K\346\234\347]in2U\020e\316i\265\335:\334"
+	.ascii	"\337m/\260mbo\030>1~\216+\260\350m\377|\026\371/\356y\217;8\242"
+	.ascii	"\03561\355\331:\231.\216\3758\367\306\016\325+\251&\221j\225"
+	.ascii	"T\217\200j\021\251NIu\210T\243\242\032\344C\252OQm\372\324\245"
+	.ascii	"\360S\203V\313\357\356\030\325\032\325\007\200:\301\341v \242"
+	.ascii	"9kz=&\215OH\347\273\337\276\277\342;\237\347S\020\204D\366>$"
+	.ascii	"\202.\002\307N7\235\240\327\3231\2333F dS\250=m\310\236fB\246"
+	.ascii	"=\203,j\377\261 \246=\355gD;*\255i_K\212iO\302\203`\224\366\001"
+	.ascii	"\256(\307\023\343\202\275\307\310pM5^\024\321J\310t\316\t\333"
+	.ascii	"\305\361[\022\334\t\274\0333\345\341\357\254r\027\255p\316\031"
+	.ascii	"\002\277\305\177V\374\234\177\246\340r\311\177\340\246\340d\344"
+	.ascii	"x\336\363+\032,\250\244\270\\\\^%\267N^^\254\227\027\353\202"
+	.ascii	"K\205\205\325z\271\260NTn\301\260\362behiy\261N\272\330\343\334"
+	.ascii	"\033\257X\200\340\331p\317\373kj\037\2224\356\307\322\330\226"
+	.ascii	"[\022[\231u\345Jm\003\354\335C\322\344_\233A\003\275M7N\233\205"
+	.ascii	"y\265\337Z\022\311\256\366\264\031\252M-\311\202=\264\020\262"
+	.ascii	"pdU\";\262\002\206hG\016\036#+ P\202a\350\252\033\223\024\272"
+	.ascii	"\016\023^\272\204\264\030.W\022\327\214\n\226_\234\254\302i#"
+	.ascii	"\0219Q0\004\344\3137n'l\037\360\005\243k\315^\306\035C\260\203"
+	.ascii	"\355\266\223-\303]%w\335\232\374\260\275\262\363H\025\3056\021"
+	.ascii	"B\f\235(~\302\001<\301~\211,\365]8\260\257\270j9\260\037z\371"
+	.ascii	"R\035[k\312"
+	.text
+	.section	.gnu.lto_getRssiDbm.115.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375 \356\205\006"
+	.string	"\302L.3PO\222\016 ;\263D\\\243\004\350\0139\204{U2\362CZ\232z\331\326\266\326\234\325\233\317\001\324Df\334\330\351\325\302\221\266\021e\355=\213|\262e\nk2\233\351m\246\027\361\320"
+	.string	"\3614\323\304\313`\226$\034\246G!I\323\273d\331\366\301f`5\317\227\244\031uAWp\260W\335\345Du\330\0044,\f}Va\343\370\002df\336>?\216m\340\003\204\365$\224\211\021j\311\025\247\342\361w\376rC*\322\231R\260\260*\004\220\224\213\022\226\314|\004-\210\352\260\230\250\256u\224*R\267#e\360\240\230\\XU\fX\310\314\361\3022z\353\237\360\037\374\033\001\007"
+	.ascii	"2\001\0238#(\016%\256\321Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_setRssiDbm.117.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"-\013"
+	.string	"&\026M=0O\224\016\247/A\034\006t\206\303\016\206\f(\021nC\354n\327ps\227\230\345\031\233\265\206\033\335\211\207Z\356}\305\237\221\213H\035\013\"\300\316HGH\r>\251?ado)S\n:"
+	.string	">"
+	.string	"7"
+	.string	"0/\231\016\255\331*\316q\330\002\030\034\242\215\025\273\033u\303\265?M\315\017\260y\376\250\n\327\310\006z\223\335}\367\214\260\2052\001T\273\353\034m\024nx\333\bl\037\260_\005/}*rB\302\366\021%v't\264X\023\220\204\007\333\207\330V\356!\264kt\374\330\315\220\242\264\313Q\034\251\303\311\313\264\377\341 \264g@0\334\305\200Q\332]\212\rP\207\003N`z\223:E/R\365z\351P\204\222\205\375\215\213\350\370\035\214e\371\321\241\237M\207\327w\177\245\013.8,|\262\303\346@\251\032\354\277\335]+\311\316\364\364\214\377]\343\327\031\314\225Y\330\224\311\026X\024l.\t4\030v\t0\246\302\271\"\347\212\f4\226M\304\\X\254Hl5\310\\\361\201e]\021\302}\256$\273\372(\350\275GNj[\016\362#\277{\025R\217\237\006\023"
+	.ascii	"2\001/~\364\021\202\300\0350\206T-\203\027\330+b\303\374aAta"
+	.ascii	"\030\206\321\200\030\340\n05E\334\345\246\332\033\n\363\326\226"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_setRssiDbmDirect.118.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"%\013"
+	.string	"\226\025M@ \211L:(+42\t\233\001\tU`\336N\243\363\257\033\030\247pl\025\210p\343\b\311}`\324\360\030O;\340'\316\006\"5P"
+	.string	"m\256\270 \001\260\200\217\rz\257g@(\222\275\367N)9"
+	.string	"="
+	.string	"6"
+	.string	"\362\026\356\325\241\035\341c\200m\030\240\312\230\331v\267\233"
+	.string	"\036\236N\031\372\023\321t\332\361Y\021Q\364\262\273\227]j\210))#\232\335\265T\211\034w\275m\t\333\017\366#\002\217T\036\270\3043h\260\273q\233\260\016\352\002\001\266O\261=\307\037\b\037#Ya7\304V\333\0351\306H^/TJ\373\004^ <\254\344\272\013b\240\266\273\030;H^\027\316\300\275\006k\232\263e:?72\b))\301\376\3544\222\3572(\222W\275\372\"\356\365\363\262\323\332\212\366\3628\311\233=\232\344l\331\247\273\273\236,\373\260\277>\366S*\035\035\316'\362@\356\263\231\360\200 \005F\00741'3\372\272\321\327\201<\025\237\216\363\201]\306b\317\242\363u\027\236\367u\224q?Y\266\3464Q\264N\037\301\023\224\274P\210{\205X)x}\310\335\022"
+	.ascii	"2\003\326\031\235` \033\357\245\2529X\370\253;Ex^\270\005\311"
+	.ascii	"\205a\030F\003b\200+\300\324\024q\227\237j\257(u[[\364"
+	.text
+	.section	.gnu.lto_rxGetRefreshRate.119.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375 \373\345\006"
+	.string	"R\21505@o\222\016\2305\240\016\357\002\301\234\033\222bt\201\221\203\206wKmMYk\233=\240\256Q\022\210\330\031\3075 \274@\356r\017k])\274\007\213hBd\no4\234\b9\021F<4@\300M\234\200\032\314\224\204C\204\024\024\025\341%\313:\320\356\340r\030\177EK*\201\314T\270$\315,.H\337\027\235V\254\357v\246\276\346\006F\256V\372\314j\256\343\013\220\016\364\267\233# \251|:\"en\224Z2\345\241\204\374\236\277\334PE\236\253L\306eeB\"\215\023\226\314\f\026\324`\352k\305L}\316\243U[u+R\006\223\321\n\366\261\332\002\0262\363\206}8\272\353\237\360#\374\037\001\b"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_isRssiConfigured.120.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375 \363\255\006"
+	.string	"\222L.4Pm\222\016$\013j*_*\246\200p7(\rA\030\003YFW\275\236}\373w\313\2163\002P\241\306\2633m\332\030*`\205$\264\2605Tk\355o\"Sk2\234\3478\317=4,88\315\213p\031\201+\b\206\347$\252\3529L\226E\022\"\001\bC\337\215\245\210X\221H\250\035\365\330\334\215':\255W\251\333\261\224*\002X\200\332\351\263OC\214o%\221\364\267\261\265[\t8\241\300j\032\311\034\235R\262\204\n\341\370=\217\371"
+	.string	"\301\263\325Lc4P\002\021}\240df\0163j\265Y\267\245*\230\230H.\354\323vI\310\314\333\205Ut\354o\360\027\374\027\001\t"
+	.ascii	"2\001#8\343\216#D\250@\\\023SF\220%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_rxGetFrameDelta.121.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`~\002\245\024"
+	.string	"v&\210I\260PR:\363\0339\315($\306R\366c\034D\177\300\257\325\331\347N\2343h\330W\307\350\221\265C\\\243\306W\324\210\247U}\247\322{\rf\006U~64\013\377;8\200\366\\\037w\254\r/\361d\254\374\226\020)S\nr"
+	.string	"g"
+	.string	"v"
+	.string	"?\222y0\346\2649}\240Z\314\031$q\001\362\243\203\244m\277\350&d\314sP\323\373%(ba#\324\232s\226#\027\360\372(^\344\365qG\234\367Q\\\345\371Gz\003\037\215\341\315o\346\343\207\213\037\277\032qd\316)\373\321\350\212\"<NS\027^q~5\"\202)\241\236#];\374|\252\260\005sN\353\315O\347~\335v\315\366\003[\217\002>\335\037\373\342\\\037;\246\246\221\352\020\253AH\365\354\301\337#\246\216]\351\206\221\352%\325\nS\037\300G\227\207\337\243\206s\346\fwL\251\321E\320\225\376\322Q\327~\323{\200WO:\023\314\227\214\002\254\032\232s\036\205/\364\2254|\352\314s\220*\212\262\2323x\340\243IH\030[\366Qm\031[f[\325\276Q\300+\242\235\336\372O\027x3* ?Fx\021\nX\345\263\221\"G\310\322v"
+	.string	"\226M\027luC\366L7@\"(\007\304R\t\237\016MS{BM\177\243\253ZY'>\324_\330^\370"
+	.string	"VYDR\276\235\321)!\236\247\335\037\277\345\365\245\220t\203F\271l\333\276\242\205\234s*\360U\334I\305\007\372\350\333\212\376f\345\365\361\213\002\304\261e\324\323\241\035\f\266Pb\303\335\\J\226\034\016\227K!\2603\261\341n\020d;\023\233\n\003\033\256\246\253\340\341\224\222\027]\371\242+Yn5\\\231\242\333\225%\"\316a\260\351J\227\\NW\312\202\275\213s}@v\244\267>\317"
+	.string	"\331#]\034\002fm\355\214\206\255\214\353"
+	.string	"\261\266b\217\301\333\305l"
+	.ascii	"b]\210\307\211J\214\360\212i\b\034.\021:j\3146\266\013\333\331"
+	.ascii	"\276\311\177q\030\022| g89\331\367\0040 p\002!\242\343\003Nf"
+	.ascii	"\350_\221\332scm\220--\026\315\3159\261V\314\301\005\234\265"
+	.ascii	"f\210\326q\265qq\026gi\305\212\216Yf\234j#\215\247\360\334i^"
+	.ascii	"\361\214\033e|;#\2330\364\214o\001{\254-@Gb\3604FX\353L\\\312"
+	.ascii	"\024\201\300\226HV\2118\020\3369m[\346\253\022\366\206\366\211"
+	.ascii	"@i\220\271H{5\301.l\006"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.part.0.164.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\316\002\215\025"
+	.string	"\246g\213I\320\224M:$\242A\252\200\266H.\346\365 \004\200\3716[\334/\254"
+	.string	"\302\255\237QMm\204\n\357_\236B7\274\257\265\314!\240\305\253`\033\314\2320\006\271\032\253\324\017{,$A\360@\335T\223\366-!do\271S\nz"
+	.string	"k"
+	.string	"w"
+	.string	"nq\321\021\262\355\026\227\035\277nK\n\022\240T\364c\"I\255\266\360t3\374u\024\370yt\2564y\371<G\201\230\351\300\n\377~\373d\232\361\370\241[1R\270'e\343\320\351\311\3503Wj\255\251Q\202\234s"
+	.string	"\222\205\247\373\020\"\232+9z\374\244\306\036\271\323"
+	.ascii	"M\307\204\22316U\2340\020\371\355\022h\354\221\022\345&\337K"
+	.ascii	"\255\325\207\315\356\324m'\331\016m9$\364\267\027p\232\261D\033"
+	.ascii	"q\004&wrk^\223\317\272H\266\245QT\032\244\322\037\225\366\246"
+	.ascii	"4\235\322\223J\357\224\226\267\375O\231J6\002\320j\r\332-\251"
+	.ascii	"F4\206\007\333\267\177\323\261S\366\216\235\362\312\333t\336"
+	.ascii	"\344\232\266:\ny\245}\022g\332y\223\313\250Z\217\206\274\250"
+	.ascii	"\325\206\340\324\004\300\323\225\253x\247\363)\336\251}\021\001"
+	.ascii	"?vtk\246\373\025q;d\320\2150\313=\341\b\202b7\2676\367{&\\\356"
+	.ascii	"\305a\310\250V\253=\240\201\b&w\336K\030H\234.\354\326l\317x"
+	.ascii	"\273\rpBz\244\022\373,\336b\206\246\246\306;\335m\231\345B"
+	.string	"\020\311\365U|\205\313\206\305\362N%\022\231\221\023\341q\227\367\225\373\242Y\r\234\356\004-&w\366_\236_\342&^>\007?h\311\313N\375\226\367\255\004+\033\032\030\234\233\225(BP\001\260\212%G\fs\304\360\206F\306&T\211\255\220%\305,\007+1\304a\261\3040\365Y\027\311\277\035\\\242\324\204\302\305\367\277<\324\002\331F\255_`\033C\201\271\230\317x\337\202{\0341\337\302\314\200<)\250\031\352\201\"\355\005\f\344e\226'n\030=\025\211-Omh\t\006~[K\"d\027DKQ\367\310\363\226\306w\336\236\3406\350|h\261w\370\020; \300\"\2512;2R\fG&\370\001\335\3076\261p?H\036\215\301\216\215\341D\300\263\265&\2102\036#\210\210\207\025,\231h$\033n\036\335\376\360\026\333\225\213\231\274\225\267C#\\`\023L\203C\037\355\227?$\001\377IvJv\2573"
+	.ascii	"\333\316s\222\026o\033oF\027\330\ryf\204\033\263\330\035\346"
+	.ascii	"@\274\334\311\331\331]\033!](\300\342^\\\300\0200h\350\276Jj"
+	.ascii	"\212\205\203\254\355N"
+	.text
+	.section	.gnu.lto_setRssi.part.0.167.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\271\001\375\017"
+	.string	"&\336fE"
+	.string	"\261&\035\330rE\242\252\223fn\361\371\001\304\344\036"
+	.string	"\034\275U\241\3030;\261\330\0264\017\362\230a\215\261\241G\323\211\323\006K\336Z\245\273\326\327.A(\376\006\361!\016~\375\330\201\215D>\331[\312\224\002P"
+	.string	"U"
+	.string	"R"
+	.string	"G\361\024\247\303t\216\273+.5\273\037\202G\033\310\036\003\234"
+	.string	"\366\230\007\301\036\355\237\260mR\371d\327\3707b\013\274\2542\264p\354\256\366\250\"~\272&<\371\351\251\240\256w==\025\016O\001\207\035#\273\353\254\303\035o[\201\355\005v2\b\276\337\342/\354\216\271\313\370. \254nJ\354n\347\221f\246\313\266&\373\360\262zq\237\351>\366\251\027\211\234W\202\214\273\257\302\344\273\334\261\375\030\323[&\351`S\036D\036\rW\234\305\351-\023{\354\206\3009\220=\206\300\2165\377\231\016\323\345\267*\2255\3556\217!\301oy\264h\224\367\036\375\021VB\312{\252!\030\024\345k\352]\177\200b\002'\345\225\312\234T\026+<\\e\331\035i\210\245\025K\347\277\377Y\256< v7\344\344\330\225h\343r\232\303\360"
+	.ascii	"\r\027>\021\333\335\007\252\001\212\245=>\346\352!\216\344c!"
+	.ascii	"\206@\033G*a!\216\344\023AT*m\036\006yN6\355d\323&\210>%\032"
+	.ascii	"h+i\036\020\223(\2046\255\002\211\264iy\270\312\362HJQ\254\252"
+	.ascii	",\266\241\3723~\323\371-\376\200@\330\343=\033\252P\177#\205"
+	.ascii	"\006\200L\275\314e\214\262\335\324=?) `\20216j\007\2012\210\224"
+	.ascii	"\f\214\256\221\241\301\274\244y\343Vd\017\235\255\213(\0173\016"
+	.ascii	"\367M\203X\f2g\3565\260\345\325Y\331Lc>b\270 2>\017\260YI\032"
+	.ascii	"'f\254v\253\214\310\024\361\026>I=~hv.\3548^\362\344\354\354"
+	.ascii	"6S\266\r\200i\257\004K|;O\bc"
+	.text
+	.section	.gnu.lto_setRssiMsp.part.0.169.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\035\013"
+	.string	"\226\225K>0M\225\016C\210\323\026C\274\006B\234\226]\022\236\356\003u~\377\252\354\246\335O\007\r\266a\f\361j\350\3010\254\352\340`\356\032<00'mj\212\fK\213\244 Pc\333[\312\224\0028"
+	.string	"8"
+	.string	":"
+	.string	"\306x<\332\327`\373Srg\233\370Ga/.d\030yh\355n\366\250\023\336]\023v\376\277C<\023\350\0321-xZ\034V\004\330]?\030\334\361\266+\2665\354\023\b\216i\b\323\n\323y\325\177H>"
+	.string	""
+	.string	"a\227\364r\255\2048\302\202\355\333\377>6\206Y\363*S*\237\247<\377\226T\262\246M\251tOy\254\273\0210\210\330\3756\036\003\266\001M\336\203\252-V\203\225HAV\3659\274\203\346W\360\001.\357=\372\234\343\361(\274\023\371\fG\252\352\025\270D\371\3625UBbC\210Q\212P\276RQVx\270zr\031\216\033\300\341\004$\270l\"\266L:[\326\331\262M\246\200&\263l\\6\221X\343\\\266\f\201\246m\031f;\017WO~\260\034\254B*RE\331\206\352\1778\b\313\005\203q<j\t,\003\024"
+	.string	"[+0\036\270\201!\005\002\006\271\004V\003\001*8@\024\fs\205\003\247\305\276\302\211W\331jN\3736\363vZ"
+	.ascii	"\256\275\230rZN\277\266\214\001"
+	.text
+	.section	.gnu.lto_updateRSSI.part.0.171.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\353\0015\021"
+	.string	"\226\237nF\360\262&\035\202\373\001\"8#!U\270w\017\020\311\205'bfI%L\367E\301\206\300.\302\261Z\326\2421\362\336v<\177\004\006\0066\263HU\f1\023\034\370\231\022\026\3663\023!\r\2015U[$\233H\231RV"
+	.string	"Z"
+	.string	"\\"
+	.string	"\036J\300v_\n\036]@\364H\372"
+	.string	"\3551{\210\366\270=\336\204m\230\fN\3318\376\272Y\221\234P\246'\266\273\334\243\332<\365L3\246|\020\323(l\251\236e\330\322p\r\320be\244\335\375\316\263Bk\225)\340\021\304\264\273\026m\270\265\333f`{\201\235\247\032\323\031\323\037\245+\201\320.\206!\241\235\2112pX\230\205\304z\335\264\316\323\002v\"\266\254\035\261\355b\226\323\204\314FD\016X\354\361:\367W\274\307\336\354r\036\223\270~H\354\356\346r\037\005\214\277\343\315\366u`\376z\311\323\306p\030yt\246\375\024W\221\372\353\305\243\335g\3212u]\260Q\351\270a\203\225=\254\232\251\b\017\231\037\327T\325\367\334"
+	.ascii	"\b\034\0132>!V9\344-m\b^>L%\255Te\377\305a\274\370\037\374\245"
+	.ascii	"\344\303G?E{\274\222\270~r:\304\344\220\013\321\314\"x<\0204"
+	.ascii	"\002H\225>Rk\254\361\331*\215\255\245\263\230\016~PBy'+\034\312"
+	.ascii	"\347y_G@\245\001\312;)YAA\201\240\204\016\200\273R\013\310\265"
+	.ascii	"\200\034\312\211\003\217\353@\025\256\024\342/\002\n\344V\276"
+	.ascii	"\017\3446\333\371l\225\306;?\205 \032@1\272\232\221\241M\231"
+	.ascii	"\326\270\323|\330ct(\023\023\355\261\304\365\023\333\241\317"
+	.ascii	"\335U\251\326\3305|\200\002- p\202\031#+\017V\216\301(\211\241"
+	.ascii	"|h;m,\312\206\255@k\214\310\2026\026sm\344N\301\tX\327<\366\226"
+	.ascii	"\3700>\275\026\212d\013\033\237\324Z\311\004\n\367Z`\323\210"
+	.ascii	"\3020?\334P\n\302 \240\035\346\360<&\2463\030\323.\255\255\262"
+	.ascii	"\"\335\035\272|Nk\241-e\305\300H{\005piO9\267^\213\307"
+	.text
+	.section	.gnu.lto_setRssiDbm.part.0.175.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\370\002\335\025"
+	.string	"&i\212I\300\222U:\343GtI\264:\002'\374\330\022\2751'\013\311{\252\246/\377\236\263\"\320"
+	.string	"\314\316\304,\005\2066\261\006-\2066\364\024\247\226b\nY\024\005\235\243\215w\t\344\321)L\262\351\001\200-\333V\322\310&r\247\024o"
+	.string	"r"
+	.string	"t"
+	.string	"{\353\200\362\3510\347+l\327y\261i\367C\016\241\335\337j\374\034\020\242\254\362\277\332qh\362\267\273\235U\332G\361\024\266\343\320<wi|B\273[\340\323'\343'\311\003\210\237\362%\342\247\375\023\266k;\333\354\035\377\211X\001>$\235\216\220\335]}j\210\333\2562\264\3711\327S\206\r\227"
+	.ascii	"\036\226Tv\327#\207{\336\266\001\333\tl\335*\215R\351\223J\233"
+	.ascii	"TzT\351\222J\213%\351\251\322\241(\255*-\377\373o\"=\234\364"
+	.ascii	"v1\004\207,\315\034\"q\237\007\331\344\202\205E\261M;\305,\210"
+	.ascii	"\241\361\001\217>\277s\265\357\267\370\217\215\362\354,|\027"
+	.ascii	"\nzA\324\247O\017m\\\241\221\347C:\332]\224\317\331{h\247\375"
+	.ascii	"\315\207\017xt`\234\335WQ\363y\214\262\375\235\332u^d\203=\223"
+	.ascii	"\316\270L\217QKj\322\347fp1.\303E-\023\231H\374\034U5\202'\252"
+	.ascii	"\324\222J\035\271\0228\031\364T\321\3450h\343\356\"\360\211^"
+	.ascii	"\344\362o>\035\341\365\022?\247\232\206TC\275.\311\177\361!\t"
+	.ascii	"\376\215[`\3622\237>L\374T\375\317\247\206\336\017$\336U\352"
+	.ascii	"y\276b\024\024\324%\335dP\252\2155|\270Zc\227\244U*-\"J\247\002"
+	.ascii	"\256\031\013\313e\272Z\261\031L&\272f,,\007-\020\030\274d\262"
+	.ascii	"X\312\255\024\230\330\n&\266\232\360b\265\254Z1\331*\245\304"
+	.ascii	"0\n\256\330\252\002\f\026[\311k\215Un\212\263>\334\335U\265\261"
+	.ascii	"\255R\337\306o\320\036\260X\342\347y\276\002\"((\242*=\211IE"
+	.ascii	"\364d\004\024$g\"\2455P\232RyC\2274r\027\211'E\351\004\352x\004"
+	.ascii	"\036\352IKr\200x\344fp4h#8\200\273\036\020_B\250q4\346\210\024"
+	.ascii	"\310L\211L \225\304X8p\002\031+\244\007\020xG5\313\030\303\002"
+	.ascii	"\241\241G\375\302]\021\335j\\\370][>'\026m\276\026\0013f\351"
+	.ascii	"\006\301\244\231\tH\272\021\327\227\272\250\264\247\022\307\270"
+	.ascii	"\0132\362\371.~\353\016\t5\210\033\205Rzt\224|\241\263{\276E"
+	.ascii	"\300\026v\265X\222e\243\307\020\203\300\"\222\200\376K\233\016"
+	.ascii	"4\337\3124\"\262\334\265\253\r\336\303<\273CT\371\316\254\223"
+	.ascii	"\365\366\335\002\305c\305\330w\360\024"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\236\007}\035"
+	.string	"\366\257\254@PjM:\264\264h\357\245\337\251\004Sn\032\250\325\220R\321\017\360\347A\370\211\246\025"
+	.string	"\346\2071Qbc\356\350\n\241\257\272\376\002e\t\"N"
+	.string	"x_\364x\354u\024Z\204\304\305\336mo\231\002\232"
+	.string	"\224"
+	.string	"\234"
+	.ascii	"3$\310hFC\177\023b4\233\2410\256\347\305\355\270\370\235\026"
+	.ascii	"\247c\353eQ\241\3005\315sE\263\027Uq\262\024\017C\301RN\260\320"
+	.ascii	"\304\305l\t \211\276\":bJ\004\225\r\321\207DA\034i\353\375\360"
+	.ascii	"1\017\337c\021<\217\215p&\316\255C?\021\345\320GD7\034O\201\004"
+	.ascii	"|\355\177>\203U7\263\027N].\227o\032\372m\031\372\2000\364\377"
+	.ascii	"\350\256i\206\035s\367\336{\241\257\026\005\327e\r\330G\243f"
+	.ascii	"X\234\277\177>C\276r\215#K\026\372e\364?\200/\001\347S\310ZW"
+	.ascii	"J\341\242e!k\261g\377RV\337\222\331\207\013\366+\361\355\277"
+	.ascii	"u\237R\224\376$(}I\227\236\364\335\250\223\376#\332\344I&\375"
+	.ascii	"Ct\tg\331z\225\260i\353M\302A$}C\364\b_1\302\\\026\213\255\330"
+	.ascii	"\"}GD\372\215\350\203\n XHC\372\214\250\020\0136H\177\021\220"
+	.ascii	">\333\217\376\232\217~\241\036}B\224G\177\020\275\372\322Z\275"
+	.ascii	"\216\275\003\276\304\326v\364\005]\035\3754\232#\002\016\316"
+	.ascii	"r\203\2116xX\243\371\213\322hV\023G\263\007U\243\220L3\315\331"
+	.ascii	"\322\262\275\032u2\203,0\263\237\365\252\200$?\225\001\013s?"
+	.ascii	"\275*\340d\002E\260\343\225\275\312cc\212Fh\t\214\355U\337\321"
+	.ascii	"zUwr\356\232\361*\277q\275\223&$\356r:6\346\256\257J\305\247"
+	.ascii	"]\345$s\034\231\345\330\315\236*\227\346\255\256~\334\226~\246"
+	.ascii	"b_\223\226\376\246,\315X\210\315U\206}LX\232\265\2564O\341j\246"
+	.ascii	"\302\367\336_j\311V\232O\256Ba\353|\250\274\217\345)?\263?\023"
+	.ascii	"\254#Fz\\\355\300\252qEdAGB\226\343\223i\"7^\312\256v"
+	.string	"2\352\273\235\272k{\2622\362\200\311\234F\231\006\215wde6\276\242>r\306\030\270Xe%0\027\300d\246\002\326\235\221%\300!2\232\242\252ld\007\213\304\f\245\246j\325\007=\250\274\205\203\rr:#\323\2627Cc\240\032T\253\344\237_\265\362\002\364\2538N\316\301\265\211\364@\277\312;\271\276\211kt\350h\277\352\344\305\276%\033]\222\357\3065\326\306\364,\020\035>\031\200\360H\306wA\277\252\343@e5\003\265*M\252:\031wP\325\t\311\\\246+\200\201\250A\020DB\265\032-#)\027\326\260\002\251)\3426\021\260\224\244\314\020\221\221@\3021\242\016\026\203N\276\314X\312\300\3555]?2\302\321\005\342\351\213\022S\033<S/\313\333\233wa\375$\365\315X\235\271\223\206\205\326\3572(\335\004\342\230\226\323\t\244t2Y\032\034\025P\3023\223\270\230\347}q-~\271y\275\267i"
+	.string	"P(\004\277A\f"
+	.ascii	"\200\207\005\025\221\026p.\214\251\016+\236\013\001\316t|\024"
+	.ascii	"v\bE8\035>J\022l\334M\205\373\201\007!K\340\304\026*L\377u\301"
+	.ascii	"0\007\356<\211@\341`\361y\311\327\2240\210HiP\340\003%e\230\020"
+	.ascii	"\265\200\322\003D\330\247j\304c\325\tb\006\003H;\215:\237u\206"
+	.ascii	"\211\324)\r\rY\317\332\323v\035|=\224n\b\n\277\363V\t\241k^`"
+	.ascii	"\235*\323V\376\021\0033x\252\326\017r.\350&\345,d*"
+	.text
+	.section	.gnu.lto_.refs.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`\353\001U\017"
+	.string	"\326)o<\020\2138\351"
+	.string	""
+	.string	"\300\335A\226\341E\""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\020|\337\367\335V"
+	.string	"\360\033\251\302\275\037tx\3054\266\007\361?\330\376\232\232\301>\370\321\310\232%[\246["
+	.string	"^"
+	.string	"`"
+	.string	"\230\336K\037\254G\\\027Y\037\252\374\306\365\030V\037\260u\213\356;\327SX]\242\353\031K\357,_\201\257\301\307&O\351\372\305u\311\366\021\256\303\312O\333\247\266\003\267$\353\021\354'\353\013\247Lg\327_\223\016\221\3440\346T\374\204G\252\257\352\243\365\020\370\020~VS\324\347\206\237\347|6\3605\226\216\261\372\003|\313E\3574\235\233r.\366\312\313+\261o\231o\261k\261g\360\261\330)\261Kb\207\304^\305\376b-8g\236~qz\244\242C:\035v~\252\370\344L\001\207\233'rj\323_V\211|\312zF$\200<\323t\212\346c\246[\020_A\374\224\371\027\244\217\214\2725zJ\324\237\350\002\361.\353\033G\307::%\324'\241\207t<\344x\303\372e\275\330\032y\225\221O\031yf$\306\033^\276\002\365)\346/~A\023\240n\267\200^\355"
+	.string	"}\rW\037C\374=.D\344[\250\200\365)\300\177\302E\277\024\363K0'\305\017Y]\343\363\236\317w\002\237gHIJx\3151d\225\021\336\327\037?\331\243K\376\350\326\036C\240\036\324A\177\2366H\006\275\236\027T\301\364\004~\005?\3417;\301\204\240O\330?\254\007\336\034\320O\\~s\351\032\314Ch\035s\351/Z\267\200zv\251S.>n9\0257p\315\211\372&z\215\324\035F}B\3521\020"
+	.ascii	"/\201g\0027^\224\224\300S\005\\Md1\201\336b\224\030\n\307\300"
+	.ascii	"\013\355S\221\023\020\021Dq+\224\370j&j/\230R"
+	.text
+	.section	.gnu.lto_.decls.7766df49c0b896a2,"e",@progbits
+	.string	"(\265/\375`VY\345t\001\232l\316\206U JQ:\215\001\025\364_\2067*\252\373\3170:\302d\177\222s\312\354O\034\265\353\021\337\017\354\272\364\203\201X\365\337;\3616\26213\307`\337\332 \313\262,\023p\034\306\271\375\315\323}\335\327\272\024\275\252uP\224A\b/\316<\002F\332do)\245L\0011\007i\b\246\b\277\204_\n\273\334\347\305#\323w\r\265\034b%*\030\f\217a#x\007\316\201{` 8\t>\202\3210\017\\\206a\300X\030\t\366\201\177\3403\234\205\213`-,\206\2730\021,\004\223a/\314\205\267\360\020\034\206\203`\035\370\353:\261\031\306ql\205\257\230\366\336\277a\376\333w\305\b\202\355\335\374\3010\346\376\254\274"
+	.string	"\353\273^\306"
+	.ascii	"^y:d\272x{oMzO\264\302k\346\3621A \343\362\314B\305\244\212\037"
+	.ascii	"\324!~\312\373\231\302Rp\367\020\277\200\202\315p\r\314\274\311"
+	.ascii	"{s\245\201\355\275\177p\325\333\355\273\202e\252\304\270xrO\300"
+	.ascii	"$,`hN\267\355\006\335\033+\nX\225\235\205\213\031\260\275\233"
+	.ascii	"?XF\f\200QX\352\3621A0\213\033\374\357!6\303.n\333\345\373\021"
+	.ascii	"\002\022)\317-\377=\304KSJ\234\331\002\266w\363\366]0]\300\366"
+	.ascii	"n\366],\207H\376\037L\343\342\335\344\275w\270\201\355\335\354"
+	.ascii	"\3737(\201\315\256\226\213w\371\230;w\241\013\003F\266wS\003"
+	.ascii	"\r4\320\200G\203\236\035V}$\350\274\357NJ\"\211\212\231x-l\017"
+	.ascii	"D\261\303(/Xc\033?\3077tR)fs\273\355\275q(\210\341\256\016k\342"
+	.ascii	"\325I\237\216\251O{\250O\253\324\247O\352\321+x\206\266\261\327"
+	.ascii	"c\b\326G\251\250G\333\324\243E\324\243L\365(\f\365\205w'=\272"
+	.ascii	"\325\353/\352\265\240zmE\275\226\242^\307\251\327E\324\353\034"
+	.ascii	"\352\265\224z\315\244\346\\\235\364\371\213\372<E\275c.\231\353"
+	.ascii	"\344\271e6\316\355[\212\312\201\365\363\023u\004\373\362\244"
+	.ascii	"?\274<\3513\234\372\\\246\362\334\235\364\231\207\372\274\325"
+	.ascii	"\236@\225\004\235\372\201\230zl\245\336\ro\365t^\324C\351S\317"
+	.ascii	"g\247>\360\356\244\277J\324\n\256N\372\347\335I\377\313G\205"
+	.ascii	"\206\214O\211\260\331"
+	.string	"\334{\363\330\020y\316\3701e/\033\211\362\222\005k).z8\373\260\376\365R\377\337(7\357:\257\336}r\233{7\367\336/\001\345\342\335$\345\354%?-\034lP\342\352\335&\027/7\301\210K\266\262<\367n\362h\240\001N\026\fVj\244\372\227K\375\205R\257\335ur\235!\356\3357(\361\234\264\266\221\354\335\304\2611,3,\203\365\257\222\372\033\"\275\2077D\372\020\250\377\255\013\201\323\264!\203\013\353\377\322\335\271\fQ^Q\272`-\307S\203\306\003K\023\326_\241\236\203\346m\273Q\312\331LKc\300\366n\376\277p7\206\353\274qw\311\257\333};n\356\355\334{\377\374\306]&\267-7\3516\323R\025\006\250\3355\351(\334\273\251\001\217\006\031l0\331Q&\325w\200Z\301\335I\365\325I/B\275jw\355:3\270l\277i\027\355\250Rs7\367n\342\340 g\336\224`\375"
+	.ascii	"\2507Z\273\304S\3657\2034\037\036\336\f\322c\025_\2354\347\356"
+	.ascii	"\244"
+	.string	"g\027I\006\371)\006\326v\333\273\251Ae\262\203C\202\365\233w'U\257Nzw\374\230\351w\206x\004/h\3705\230&\0320\362\353\300\3310\030\302\371u]>\301\226\202\221\355\307\027\300 \223U\340w\206328A\343\370\263\363\277\032\270\033P\362_\343\177\235Z\310k\177\256\201\001\277\363\2431\374\027\017\367\375we\373/\214\263\251MI\362\343\026Y\r\357\003]r\363\226P\206\001\316\353\360\243b\377\375\371s\332\177\013\360_\237{\370\n\030\357?\033*\344\307G\031\rsp\3614\360\f\277\246\362\237\355\342-\035\003\034\2069\020\372\361\212\234\344\277x\247\371\365\034\032\334\215#;f$\031\2008b\324i\267\002\027/\f\005\372\357\333\377\273\353!\037\375\367\231\317\314\376\353\226\001'&b\3741\004r\331\025\302]C\377\325\300]\365\r\214\001\331\237A\370\257\221\261\037\377x\310G\376L\344\277\314;"
+	.string	"'&.\325\255\n\0013`\205l$\354\277Z\336\301\257\227\377\357\fG`\001d \377\347p\001~l\200\213\342\212\370\263W^\342I\361\343\002\370\265\004\376\334\001\027\023\b\344\255\377F"
+	.string	"_`\363\353\023\377\3632\310KX\202\345\177*\347\311:0\217\004\277\376\371q\n\371\306\217AX\3136~l\307\200\344\n\327\350\277 \3105\376\333\004\327Y\360\243[\377W\300=\320\b\374\230\003Y\352\277\025\370\257\335\331d\374\270\3556Y\277\341G\235~\2345\302\357\2176\340\307&t(\340\307 \340+\375\243\007\270I\377U\300\237U\370\257\337\337\214?\263\020\365\337\t\376\213\227e\374\367"
+	.ascii	"\177\326@\214\377&\371\257\220\377~\375\267\354\3170\376\213"
+	.ascii	"\366g\250\037\333\370\361\215\374\"\003LB\016\341\317\"<\375"
+	.ascii	"\267\004\034\002\203\354d\230\233\376\013\365\337\016d\027\377"
+	.ascii	"e\372\257\0072\323\177\227\376\253\374\357\213\377\276\360_\020"
+	.ascii	"\177^\272Y\\\374W\004\200\271\205\377jQ\372\237\302\177Ap\305"
+	.ascii	"\376g\360\237\347?\006\377E\372\017\342.'\375\371\205s\340GC"
+	.ascii	"\3747\357\256\004\3009\371\327\026`\232\243\277\336\231{\372"
+	.ascii	"\243\037\376\347\375\207\362_\312A\374\307\300\367^\3745q\202"
+	.ascii	"eV\"\340?\223\377q\377\331\216\201\377s\3775\363\237\370\347"
+	.ascii	"1\177\336\371\363\207?\363\374\271\303\2377\374\231\303\237="
+	.ascii	"\374y\202\037\033\340\317=\177n\177|\370g\234?\347\374\327\314"
+	.ascii	"\237\331\3779\177\212\302\237=\360\347\343\2377\360g\n\374y\002"
+	.ascii	"\177>\341\317\020\370\263\003\376\274\200?#\340\317\007\370s"
+	.ascii	"\211?\033\340\317=\177\306\340\317\024\374\031\304\217\267\374"
+	.ascii	"\030\313\217\001\177\334\367c\276\037O\371\361\007~,\345\307"
+	.ascii	"y?\306\373\261\321\217\205~l\367\343\272\037\307\375\370\355"
+	.ascii	"\307m?V\362c\264\037\237\375\230\354\307\306\037\207\375\230"
+	.ascii	"\310\217\273~\034\201\037\367\370q\326\217y\374X\307\217\257"
+	.ascii	"~\314\374\261\324\217\243~\034\343\307P?v\3721\323\217\223~\374"
+	.ascii	"\302\217=\360\343\016\374x\350\307*~|\201\037W\340\307+\374x"
+	.ascii	"\002?N\341\307'\374\230\204\037\233\370\261\003~\034\302\217"
+	.ascii	"\031\360c\020~\234\200\037\177\360\343\022?\346\340\307??\036"
+	.ascii	"\361c\003\3748\203\037_\360\343\020?\236\340\307<?\346\360\343"
+	.ascii	"\234\037\323\3748\377\327\314\177[\370\257\007\376+\202\377v"
+	.ascii	"\340\277Q\376\333\374/\363\2778\376K\365_\b\374\327\204\377*"
+	.ascii	"\371?\345\277\224\377r\377m\362_\302\377j\371o\226\377\006\376"
+	.ascii	"\327\310\177\001\377\373\367_\275\377\346\375w\375/\336\177K"
+	.ascii	"\370\317\366_\r\374_\341\377\335\177\235\374\327\356\277r\377"
+	.ascii	"\215\341\277q\377e\362_\347\177\325\376\273\365_\255\377f\375"
+	.ascii	"\027\353\177\212\377\362\370\257\325\177i\374\267\352\2773\376"
+	.ascii	"\033\365\337\030\377]\341\277\021\370\357\211\3776\340\277\f"
+	.ascii	"\370O\345\377\336\177\272\377s\377\221\374g\376\327\373O\200"
+	.ascii	"\303\303\303\303\337\346\353\307Q\372\027\300\023\317\321\221"
+	.ascii	"\216\251r\243\247\376:\314\251\303.\336\315\331K~p`[\252)\342"
+	.ascii	"7qD\210\340\267\n\316\302n\332\324_{9\265\227\0262\201\275\225"
+	.ascii	"\256@HS\323U"
+	.ascii	"A\374\242\350\257k!\277\006\242\203\334\271,d\312S\016\254\257"
+	.ascii	"\333\317\365\227\346\n3\003\006\254/\326\335I9\\\235\3647\\>"
+	.ascii	"|\350\256\n\366\336M\033\351\213\030\363y0\327]h_\221!L\260\376"
+	.ascii	"\r\024\017\036\232\3539<\302\266\256\271\206\244A\305\300"
+	.string	"Zk\025k\244|yI\351,\024\210\026\235\025\235\245\261j\250\226\302l\034?A,UYt\350\300o\305\247\275\247.8S{a\311\0301\254o\343\247\376\332\312\251\255\364\325\235\332[IG\005uUh^\304`J\323Ww\257\205.N`\200h6lh\346\257\324\336{i\357\035^)\216$\251\036\315l#B\3655o`M\204\212J\323\270{\357\315\334I\203$\364\246\320\254\n\253\256i\330\260\001\201[\322O@\314\362\234v\304\210\241\245\\0\231q-\345g5x\025\365\277\b\342\254\206\231(\0317U\374\n\005\261\030\225\224\033Q\332\205v\241\241\360\336{\203\021\231\3640{n&\215\236_\277\270\206\2523c\304\fk\335\244\237\376\0273\250A\221\321{r*\032\361\001\005,C\271\3713\204\302\303\332f\033\032\352\245\234\275de\006X\261)\355\305\022\255t\275\264\342\211\223'\254\017F'\375/n"
+	.ascii	"\316)M'\351=\203\312\334\233\224\252(Y\234\207\367I\00611\360"
+	.ascii	"\035b\375\f{\3523\230\034\346Y\314\305d3\352\336;\251\271g\360"
+	.ascii	"\244\325\241Y\025n&\263\007]\262\004\350\314e\236\315\\\260\t"
+	.ascii	"a\226\023\353\203\311d\254L\341\001!\223\307H\375\225E\371\273"
+	.ascii	"\312\205w\t\r!\020/4\260~\206$\352\177\217\377t+I\355\275\251"
+	.ascii	"\320\346\226Z\312\220\376\367\027\275\267\347\267\271\371\006"
+	.ascii	"\340\277\336\373\003\026{/\265=\367\336\367\213*6\247tU\301F"
+	.ascii	"\371\366f\322J\nAk\212I\353\306\223SkJ\303\223Sk'1\rI\322 \265"
+	.ascii	"\265\222\236\234{k`bJ2\2015\365\344T\332\032\236\234{j\273\350"
+	.ascii	"\233\272\273\251\225\264\231\260\266\206\315\264\225\266\023"
+	.ascii	"k\252\202'&\255\251'\247\322\224\206'\247\326\324vj\355\234\315"
+	.ascii	"\244$\365\202iKi\330N\255\301\355\304\232\312yrbM=9\265\310."
+	.ascii	"\222\027~VUl\317.\0307\351\211iG\311\310\241$\225\303\367\324"
+	.ascii	"\304\332\201{_\267\246-\265\371\366\016\300\3369\260\244\002"
+	.ascii	"\225n\\\272%\276\250\2458%\254\333\334{\177\220\261\264\205\265"
+	.ascii	"\231\370\222\356\346{*\202\265w\221\245\241-c\357\275;Hj\362"
+	.ascii	"m\257\313\227\304\225c\307h\332[\202\335\334[\306\336Iw\363\355"
+	.ascii	"\275\223\366\336D\251\034\315\275\255r\236\300d\310\330\233\311"
+	.ascii	"#c\347H\252k\332\033\273e\241\233zrna\375\324\2659\301\266S3"
+	.ascii	"\351>\305\300\332`;PKJu&\251\355\030{\357K\250\202MUy\301\372"
+	.ascii	"y\360f\302\353\314\204y0?\355=EB,)\207\b\234\303?\261:\254\237"
+	.ascii	"\301I\315\203jSMa\0064Z}\\\3100iA\007n'\247\340\363\363\317]"
+	.ascii	"n\225\374\326\002\216q\305\354\202\365\315\325I3\227\237gAL\304"
+	.ascii	"MO\017k\233\253\223690\307\242\262\374:s\226\354\354\301\332"
+	.ascii	"T\005\b\243\013\003V\2707S\004z\344,\013\023\353\327\004\252"
+	.ascii	"\177\016t\346\300\374\227\237\266\222"
+	.string	"\026\t\261*R\"^\223\247\376\031\360\327\231\001\263^\361io\252\236\264)4\253\302-\305\024asW\205\347\204\365k\216X\371#\342\204\351\005k?\036\026\256\240\335\300\3725@\324\3377*\237\273)\356\r%\t\330\336\233/\357}\356\206\251\271\277\322+jfH\n\367\336\377s_\256r\235\231/O\271nj\240\001O\261,\213\254)\325\257\211\241\276f\253\247!\243\376Y\212^M\332\222\255.\367\311\207W3J\036!\031\"yXg(M\246\246\245\301%\254O\203E\315x\304.6\252&\326\247\221\322\254\241\333\361F\303I\266K\002t\006\301:\323\345\272\353\374]n\262qp\236\200\341A\207\365i\350T\244\275\367\276\277K\211\277K\377<W\005\207\311I.P\216\307F\213\231\275)1\304\305\331q\371\212\273mj^N.pLp\316h\370\370j\026\353\312\030\251\201u^\222\335\236\337r[~\353"
+	.ascii	"ko\245\374\206cfo%\234{-\270\327\002m\266E\204I\252O\003\247"
+	.ascii	"\376\231\315I\007\205\346\205uV\302C\034+3\304\013\326\247i\252"
+	.ascii	"\177^\313jH\256\2602\254\233\315\270\2757\017\315\226<3\"X\237"
+	.ascii	"\306\207z\016\304\362\221\033\246\234\315\264\365\006\226$\303"
+	.ascii	"\300\004\fI>\313f\031-\247]gN\222\307~\0173\331us\3578\300\262"
+	.ascii	"|d\311V\fH\222\344\036\371\307\026a\222\354\225\303r\023L\205"
+	.ascii	"\261\004\367\334{\247J\256\374b\310\240O\243C\2754KE\262\221"
+	.ascii	"\"\226\225\022\2452E\212_\324\027\377\3002\330X\033\264\201\365"
+	.ascii	"\213wyH\026r\235\231H\016\362\225$\023\311@\222\006;\030S\013"
+	.ascii	"\022\246\020UBVu\230\352\027\305\324\027\271\324\027\255\324"
+	.ascii	"\027i\344.l\206\312\2250\254_|\312>\f\325?sa\241\321\372\372"
+	.ascii	"\312\261\205\237*`\030\364\322\032\223\205\317`\3618c\226\244"
+	.ascii	"\n\353\314\343\277}y\007v\2738V6\204`\215\367\335Is\216\237g"
+	.ascii	"\035\251\341\030\030nX\343\\e+=x\204\353K\266\372\263\215|#\343"
+	.ascii	"\300)a\226!W2\263\bH\250\303\r\353\253`T\335\274;\351\335j\364"
+	.ascii	"\330\214\001\\\"\243\221\253X0\231hT\317Un\027\353\246\212\215"
+	.ascii	"\314\n\353<\365\363L\005B\020.3\254s\226\002<\303\333r\233\021"
+	.ascii	"\205*\211b\246\204u\216z\226\241VG\204\017\353\337,\331\t\207"
+	.ascii	"\271m\271I\247:\261\001\351\303Z\204\024\3422?\236\330\352\t"
+	.ascii	"\206\362A\223T\321\311\n\221g\036\256\322c\3103/\345\027\371"
+	.ascii	")\303\310.2S\216\221\2252Tn\272\316\354\204\345\236wN:O3;a3\370"
+	.ascii	"0\253I\251L\330x<\267`/\227\217\231\263\231\330\276\b1\230(\027"
+	.ascii	"A\260\325\263\023\306;\227\017\232\244\212MV\310\236\331\t\213"
+	.ascii	"\261\342\325\344\204l\357&\217\356\333KA:h\275\357N\372\346\325"
+	.ascii	"I\317`\303\233 `\202X\201g\3660\031\034\301\035>\242`}\225N\305"
+	.ascii	"c\256\327\260l\262\222\215\2759\254\257\246\251WaP\257r\251\370"
+	.ascii	"\213\035_\214%\207X_\235R\257\272x\342\301.\031\324\370\312\034"
+	.ascii	"zyv\241\201\002u\367$x\334\345\342\335\030b-\301\372`0\227\377"
+	.ascii	"\305;\027E\311\213\313\347n\260\360\341E\365\341,\203]Z_X\237"
+	.ascii	"(\247b\t\274\231\202\3132\347w\034x@\325\315MP\006\326\030\020"
+	.ascii	"c+\370\3121 \376\373\006%\236\201\t\003\352\275\225\356\265\340"
+	.ascii	"\346^\013\320;!JJR}\242\233z09\256\216\013\031\326'\216\251?"
+	.ascii	"\256\302\307\034C\313\302\032S\301LT}NX\237\310\245\376\007s"
+	.ascii	"\235x\n\336\323[\360\016\315`\215\243`\275\353\354\301R\212L"
+	.ascii	"\315\355\334\273\211\223A\311\206\\\025\254O\274R\177{R\234\303"
+	.ascii	"\303\303\303\333\223\236\b\003\312mKo\270(\003\207\365\323C\365"
+	.ascii	")\030\365\307wN\364\333s\356\020\353_'v\202\355\346\364\376\252"
+	.ascii	"\232\034\333\265e\330 j\306\020\302\370\302\032\307\200\353t"
+	.ascii	"\2168\250\246:\272\035+2\236\315\364,L\314\021\254\377_'\236"
+	.ascii	"\303r\315\315s\275\330\341m\254\237\376\251\007s\361\376\027"
+	.ascii	"\321\2550[\346p"
+	.string	"\034\206\253Q\022&-G\263G\310\020.L\336n\023\253\354\314\232\022\354\304n\027\313\303u!(\203\f\326\230\r\267]\347\007\274\304\313\217\245)\254\237JQE\260\367\375\220\336\303\303\373!\305Xw'\275\340\352\244X\355\347x\355f\252\214\215\t\326\032\256N\372\343\346\007\342X\035\017\037X\3778ML_\330\306:\017\241\245\376\351\337_\3140\370e\003\b\326\017\241C}\b\033T\250\244U8\214U]\361\222F\246/I\312\367\264\n \0306>\264\214#\2352\303\f\231@(P\322\275\273\266g\334%U\200x\205\031\332\350\306\264Hy\272'x\273\372\236WX\247y\251\336\377\"Z\306\016\206)\2754\212\214,\273\031Ak\\F@\274\331\335.\305\343Qw\022\277\274\347\336\314\036\033\273$}c\322\273\247xsY\2018\272\260N\235\340\310\251\005\0069\223\223K\353\262j\272r"
+	.ascii	"F\321=\255\023\304!3\204\253\201u:'$.\016OY\342\247\336\020+"
+	.ascii	"{\201\365A\370p:S& \316\324\314\220\030b\321\333\351\333S&\237"
+	.ascii	"c3\323c\013\326)[\352\226\241*\253p.uK\227\204\t\211\272\341"
+	.ascii	"\007\346Lp)m\313S\270Du1\3639#reL\260>\210\033ii\351Z\372\266"
+	.ascii	"\224V\250\273\310$\311\222\256\245jcp`\235I\233A=\2268\301\372"
+	.ascii	"\023\020\252\237`\313\331Y\232\204CZ\225 "
+	.string	"an\374|@\301H\221<M\202\263d\344+\206#d\\\254\340\210RV\246\273nNs\311o\017lofO\r\025&lC\320\306\306t\027\317\231\337\231\024\n\2040\370\260\376\004M\352\377\247DR\"\251\221\273\266gp8#\034;R\2707\263\207\206\t\307\340\016\254\377\264\310S#\277#\302\200%I\b\326\251X\306j\233\303\201u\n\303\357\254\272\252\340\260N\303~\247\226yK\373\303:\005\373\235\336\224-\036\277\253Qw\266\207\365%\340S\377\024H\n$\025b\302V\242\352`,\2548c-\210!\326\351\027q\214G\0268\254/A\\\032D\0023\365O\177\244?\264\220\036$6L\004\351\252\260\276\004V)\326S\037)V\232CE\023M\327\226\231\347\226\312!\242\206\f\217\027nX\247\\i\217t+\325J\263>\224Q\377tG\272C_\231\220\263w\017)t[\212)\242\246\260\007\334\035\326\377"
+	.string	"E\375-\273\250\340\3212\250\031\364\314u\242\202i\216\237\245\255\024G\242\256\212MV\230\216.X_\021\225\256"
+	.string	"\346a\375\017p*\r\3240\335[\236IZ\\\244N\227\357G\bG\250(\241\207 \226\236L@\222\345\331\227\322H_\244Sr\205O\264\224F\312\024h#\265Jq\2447\322\252\264F\312\274\316\224F\372t\324\fz\346'\245\221.ay\356\335\324"
+	.string	"\347\313\331\222\0339\0325<\027\020KO&\240\t\246R)\325u\246S\347i\356t*\205Jg\\>fsS\325\304@\030d\312\007\rl\274\374\005^\245\372Og\244Qq\315.B\254S\031\314\033z.\260\376\207 \352\237\302\270\3164\206\n\206\254\256\f\326\007s.O\200l\375P\377AK\375\207\032i\223j\345\251c\n\326\3770C\375\007\030\352?0\251\3479T\317#F=\217\027\365O7z\350\214\362e\312!\366\333\213\261\204\365y\004U\334\274;i\317\325IQ1\350\030\224\314_\3041\243\363\001\207\365y"
+	.string	"\325\243\205\377\213)"
+	.ascii	"\241\002\207\265\276\277KQ0G\303\374E\254G\004L\006\326\347\251"
+	.ascii	"\242\036%D\277\374\305\233\300!ojX\237'O=\352\005\356\360\013"
+	.ascii	"\016\254\321A\265\211\007.\003\032\035r<\256\320\347\321\301"
+	.ascii	"?s\271\177\371\355\205\3033b\260F\273\374\034}N\301{\246a\235"
+	.ascii	"\341\352\244\347\361\322\262%\333\361\235\345=y\230\352y\\\240"
+	.ascii	"\201WP,x\257\310\031\024\017\203\352=\350\375\375\241\200_\316"
+	.ascii	"\344h\2040q\211C\255\034\005\314va\234uN'\377\2136kx\\1\260\276"
+	.ascii	"\0078\025\355C\373\320\253\342\336\304\262)A58\035X\337\203\031"
+	.ascii	"\037\337\036\253)\302\327D\020\353{\360B\247\240S\264\030(gP"
+	.ascii	"O9-\032V\260\276\007\246\212\352\241z\250\224\342\336r`\304\272"
+	.ascii	"1NR\304\222\210i\303\372\036d\240PP(h\336_\331\333\023\205\022"
+	.ascii	"\\\372\313\303\3032E\226\004\353w0D\357\320;\024\357WJ\311\212"
+	.ascii	"X\343\306\311\337!\023\217&\210ZS\026\326\357\020\006\265\263"
+	.ascii	"\353\340''\207\326\251\203Y\304\251';\002Q\272\243u\027h\023"
+	.ascii	"\363\2025:\207\367nbh5\331\321\341\016.\356\266U\240\224\263"
+	.ascii	"\231d\274\201\301\251\357\220\206\272\241N\364\355\266\251\233"
+	.ascii	"N\205!\304\355\331"
+	.string	"aL}\007!\352E\\\224\315\211\266e;\275\335\266R\225\005yYhV\205\035v\250\357\020\003m\242MTI\211'U\320\265\243Jl\270\374\300n`\215\252a\300\242\324U\036\225\335\377\"\215\021\256 E\260\376\316\031\3658\312E\223\214\241h=z\273\231\030\203\0016F\375\016\241\331\030z\226\343r\224\264v\261\310\330\213\347\216\026\365;UP\2611\224l\fj\347\016-\202\026A\217p\0319|\242F\216\036!R\335\311\341\330Q\242~\307\210\212\206\241a\232\212\221-mtrM\254\277\323\245\242^\250\027J\344\356\255\227\225\215\244%!2\344(\221\302\2538B\254Q!\031\256\260\220J\fX\037\f\372\365\277HL\262\304L\013\375B\2030\377\350`\310J4\330\335\330\036\n\004\343\300\n\374\022\210\365wn\250h\027\332U\205C\231\255-\264\207Je\n\315\212l3s\364\024\233P\324\260\270\216\366\340"
+	.ascii	"\210f\241Y\272K\213!\330\023S\037\023\326\347P\207\362@y\350"
+	.ascii	"\256\005\300iynf\216\036}\030\005\313y\246C\307=\253\262\304"
+	.ascii	"\024\345\207\3659hYY\241W&\354\234\261\310\342E\2105z\025&\266"
+	.ascii	"\025\003\353s\240\272N\224\ne\232\200\265i\364\234%\005\t\203"
+	.ascii	"C\246'\345\211\3328\312\374\321*\224\006z\003\023o\\\021\222"
+	.ascii	"\207u\023\260\220\314\2115Z\343\347\250\215\0328\2753D\260\326"
+	.ascii	"\271:)\207}wR\334\274:\351u\260\250?*\205Je\034\203:M\242\242"
+	.ascii	"t\327\b\352\320\254\310\270\270Y\321\201Cc\2401\356\246\210a"
+	.ascii	"O\236P\260\276\216\017\365\350\323E\241P(\354\206\233[\212\203"
+	.ascii	"04+\262\035\252\b\f/vK/\342\242M\350F\235~w7\325\276/\260\312"
+	.ascii	"\260<\267\324\026q\235\033\352u\242\324\037]B7\312\224y\204\360"
+	.ascii	"\342I\227Q\001\323YR\277!\214j\346\337\240\004\272\321\244\213"
+	.ascii	"ww\323n\001V\026\370\334p\345\314\317\350\303\n\230\366n\332"
+	.ascii	"-\260\312\366\236\206\327\207\330\355\2027\257\272\rM\324oP#"
+	.ascii	"\324\205\204\232\314\230k28]\350\272\266\270\201}\371J\302\372"
+	.ascii	"\313\027-\246l\f\030\316\034\216\272\2450\327bp\b\221p\001\303"
+	.ascii	"Z\203\301n\250\031\216\033\\6\034Q\277\201k\213~n\321\203\203"
+	.ascii	"\\\270\350.\304\251,4\253\302\f=\330\276\222\004\257\273\334"
+	.ascii	" \271{\216\331\200C\375\006'5K\02615\r\204\177:\360O_\261bE_"
+	.ascii	"\001a\314\fL\355!%\254\n\360:\365\025\364\254\211\206@\365\032"
+	.ascii	"\360\3644\237\236\356\323U\256\373\362\036\020\261\333\226&\306"
+	.ascii	"\364\201\265\024)\232J\230\2240,C\024 PW\246\\S!\022\b\344\017"
+	.ascii	"k\275w\333\376\027"
+	.string	"o\324\222\302\254<\371_,\022\202)s\206\3655\310\251\327\220\246\346\345]<\236\235\344\245\202\264,\ra\352\365\335\325O\236d\034WJe\262\005%\207\372\233q\244\327M\256v\342\344\342\221 2Y\312{j\210R\177/^z=wu]\035\3363a+Q]PvF\375\305{\251\234\334X]\316\237\233\216s\323p\351\336\267\2115Cj3\245z\336\3364\334\335R`R;5\034'dKlL\256\341\212\206R\306\254\366\376\027\215w@\n\261~N\232\372\234*\365\327m\327\251\333\262\325T\317Y\335\0220<\364\260>\316\241\3239\205E\375\365\232^\313UG\2316W\022\260\275\231\"l\302\314\330\226\260>N\263y\361\356\332\236A\343\244f\bC\341\336PD\3503]"
+	.string	"\275\260>N\232z\374w5\032\032\006\274\315=\003\001YhVd_\3521\340\325H\220`@\236\2354H\242,\t\347\312\314l,k\214z}\344j2\247&\273m=[I\351\002\261,4\253\302/\352\357mK\177m\344:\265\221\374\304\204\2554\365\301X\026\024\021yKN\213\016\254\177\203ELLw\005AH\242#\005\326\226h\251B\213\314\360!\237\226\b\251\\\0227\340\340\250\b\b\335I\"\217\254\262M\032\001\025y\216\212\200\212<\352\207|\204\222HV\331\216X\203\226D@I\344\b\266]\216\350@D\264L&\215\222\304\017\030\261CJ\243$q\305q%\322+\273<\322\354\020\020\253l\323\017\371\214"
+	.string	"\002\021\264\022\2518&\037\320\236X\331\245\362\270\256\310\371\220\317Q[4\002\211\345\240D&O\034\265( \261\305$\362X\202\022\231<a\323\032\261@\310\242\364\346C>k\021R9\242eW\026H6HilQh\221DD\310\242\364\001\0248\261\302\b\"\030\037`B\002(\030G@aLqB\303\004\037\362\031\261\"D\320J\204<&%\260\342\303\207|\332!\345\261H\002\232\325\250C\244\001"
+	.string	"\024\26482\032!"
+	.ascii	"\312\017\371\b\035\215\020:\002J.k\222+0\332\032\205\2162(\215"
+	.ascii	"I\241#4)t\224\207\224B\311\225(]_@\266\272mW6(\350Hlqd\004\244"
+	.ascii	"Y\345Q\016Z\223BH\242#1hm\227:i\204T\002\255-\361\254Q\350\310"
+	.ascii	"\307\246\005\253l\221B+\n\013rH\370\264,\254\330\240\363\343"
+	.ascii	"\323.\215\220,V\366h\007'he\227B\310\025I\024-2G\271\226\200"
+	.ascii	"\304\346\024\251\310\021\242Q&W vU\001\331\266B\304\2255Z\261"
+	.ascii	":`\203\013@\353\320\bH\254M\361\003\237\242e\n\004\370\024-S"
+	.ascii	" \333\226-\336\220\370\361YY\r7E\3136\227\360)Z\266(\321\003"
+	.ascii	"\237\266X\203l\333\003\370\26466-\212\265e\217G8-\330#\222\b"
+	.ascii	"\211\264<N\240\004ZY\244\211\026J$\321q9\001\027\222\310\023"
+	.ascii	"\224k\273\026-\333\225\345Pt\244B\321\007T\330YY\021\220X\036"
+	.ascii	"\241$\262=\201\304\352\\\320\262\320\342H\264\232@:\242\260\256"
+	.ascii	"\311\016Jd\362\004\022\233\266\354\222\210H\204\013Xb\272\201"
+	.ascii	"O\221\212\240\242e\253\322p\340S\244\"\250\315p\323\026\2510"
+	.ascii	"\201l[\016\035\370\024\251\bjs\212T\230(RaBC\313\002\262mQ\034"
+	.ascii	"\265((\333#\221\316Q\213\002\315Q\213\202\006\"\262mQ(\327\366"
+	.ascii	"\006\210\265!B*\223,\240\bJ\256G\355\262\345\320\256DGE\307\024"
+	.ascii	"H(\216\220.\2646-\013J\021\224Hk\nHlN\320\312\""
+	.string	"\227\036XQ\b%\221G\345\321\004\022\313s\001\t\037%{<\362a!(\271*\217DK \242#\220\b\025Z\242\245\nAH\242#\213\344\t V'\bIt\244\200rH\bID\002\022\273\203~\310Gh\251b\r\032\021D\204\\\252X\203\214P(\256AF($O\264'\220\330\rA+\013\344\n\264\242@bs\330\245\021\222\305qhu@\333\032\235@tL\n!S\004%EP\002\255\3125\310\002d\333\262\232\006\205\n\250p\"E\n\024\253\362\030t\264\264Q&\227F#\334|\340\210\002\210E-hW\241\344Q\2046\350\270\262\037\222F\312#\273D\321\202\350\350\350\b\200\243\362h\002\210M[\034YV\204\013\326%\321\221\002D\310\343\n$\024\312U\350\206\210h\231\314!\"Z&qF@AD\264L\332\264\001h\215I\022\224k\273\242\020:\002\300\201\220\354\232\\\205\324w\340\201\001<\370"
+	.string	"\211\370\017\022@\"\001$\322\177\220\200\237\237\004x\360\243\336\203\237\334\262\253R\271\236"
+	.string	"\304\346\374\203\003xP\242\003\0166\370\031a\005\024\017\020\341\246hU\266-R\340\260\354\003n~\243\374\220\317\212\021I\243\242\"#\240\t\\\270\255\221]\225DH\022~\224G5\253\362\250lQ\345j\\\201\330\245Q\n\245\361\250$ZM\254EHe\r{\034\002\322J\245\321\nA\253\013I$\221\332\032\223FH%2(i4B\322H\t$\302\032dT\364a5\006\235@2RA\f:\261\006\031\025\245HkP\362\304\362\210\243\374\220O\273\006\031\025\031\201\330\021@+>\034\255\312\024A\311\225\330\032\201n\216Ve\n%{T\266\305U(yd\321\325X\003\204\0242:a\r2***\215\033p\2404\322\254G-V\260"
+	.ascii	"\212\024\031T\310Q&\227@\031V\345\021\305P\273\262+V\024H\254"
+	.ascii	"\r\253T!I\302Qy4\361\201#\212\240\343\212\002\210\255a\225*l"
+	.ascii	"H\222\320.\225Ge\nV\251\202\016\221\221\221\003\214h\222\204"
+	.ascii	"\266]\201\214X\025\200\330\034\345Z\002\020\273AiT\252I\022Z"
+	.ascii	"\026\326\"\344\nk\321\221%\001\210\3059*\217&j\216\312\243\211"
+	.ascii	"bk\\\225Ge\212\265\b\251L.Q \2619D\241#$\226\346\350X\004\304"
+	.ascii	"\242\354\032\204da\304\036\005\255H,\321\021\311\256\255\006"
+	.ascii	"\244\225\350hib\005\321q\210f\rB\262\354\312\302\310\230DV\240"
+	.ascii	"4\022\205\216+\030!\215BK\242#\036\r\312\265]\331\240$R\205Q"
+	.ascii	"yl\215EKV\351\302z\324N\220a%:\002\321(\331\225E\022\t\304\006"
+	.ascii	"!\213\320$\262Hu\001h\035\002B:\026\2518-\321\221E\322\b\251"
+	.ascii	"<\022\031\035\261\2532y\002\210\365\220D\002\255\355\322\210"
+	.ascii	"t,2\"\2615@F\244\345\321\210t,\302iY#\226]wR\345\332\256XaT\263"
+	.ascii	"\036\265Pj\370\260b\205\221r\tDA\213D:\032\205\226*\326 \345"
+	.ascii	"\362(\211\364\260\036\265P\032W\026H\345\221\005\222]\203@\260"
+	.ascii	"FJ\240\343\n\243\221ry4\n%\221CJ#\243\242\326\b\304\362\004\031"
+	.ascii	"!\331\365\310\270\342\210\310\270\026\035\331\025F \2665\"\333"
+	.ascii	"\226\375\020\2044*\221\311\245\315\006DHl\213\243l\217+\214A"
+	.ascii	"\313\243\nc\273T\321\336\260\311\326\210\304\032\327vi\\\321"
+	.ascii	"\262@8\312\243U\331\352u\305\261%B\036I@b?(\215\037(\223\310"
+	.ascii	"%q\r2*\322\312\017\351\334\350heG(\215\214\330\0215H\307\242"
+	.ascii	"\334\032\205\220+\222F#\254B\311#\n\2425\231<\016\215\200\304"
+	.ascii	"vP\032=\370Q&\221K\365??#T\300B\n%\250@>H\354\b$vD\022y,\032"
+	.ascii	"\001\304\266#|6$\221E\371?\261-e\202\023\2275\303\312\306!j\035"
+	.ascii	"\321\242r\342)\201\\e0\220\334E\255\221\271]\274\310`\242\326"
+	.ascii	"#L\356"
+	.string	"\fk\275\024\245*G\332 \232\276rS\030\305\312\213$\272\017\275\203K\372\201$\017\332P\t\023\303\345,\035$r\3055Q1\323pj\226\0172Le\272\013\307\217-\2624\311\240Y\230/\342\230fz!\304\202\2065Q\214(F4R\334R\204\025\354%\021\213\234h$\355\002Eu%\314\327\0271\314\013\beva\302\f91\f\354\215\371F$r\275\236$ya}\n\354T\242\220\214\303\317*\313\025\nbP\177b\020\315u\343\311\274\2025\221\211\204\253*;\254}\370 \376\360\222"
+	.string	"\2773]'\376\320Y\206\206w`c=R#W4\250\270\260\346\301\203\270\345\245"
+	.string	"O\224\214\035\321:q\353\256i\313\227>\254\211YD,!D\034D\034D\035WJ\212P"
+	.ascii	"K\202MN\n\211V'\352 \346pj\275\310#\346 ^\025\327bd\2315\275"
+	.ascii	"\244\020\302Q@\203\211\367j\244\254\231\301\273\201*\211\362"
+	.ascii	"5%\016k\"\025\221\212X\243\230t\243\305\257\313\027\"\215\023"
+	.ascii	"kd;\234,]wQ\260&V\341\275>C!bB<\325\2378\245\251\\\250/QeRi\235"
+	.ascii	"\356#,ceF\212G\024S\";\214\312O\274\372\236\034\022e\354\245"
+	.ascii	"5\255\201\301\032#I\0022\004\353\346\215\220(/\035P(\263\346"
+	.ascii	"0\310\027%/\322\265\2547gd\354)\343P\337\004\371`8i\032\177@"
+	.ascii	"\324\302\020\233\264\324^\027\2750\027\032JM\314\331\207\365"
+	.ascii	"\214\031A\260\226\322*\201X=b`m\306\f1\211\214\304YR\2200"
+	.string	"\351\231\023\223\210{*\315\213\023\342N\017\255\226\034a\322\274=\2368Q\245\206yLJL\225\225\020OR1\277\230\224\3147\344\350\200I\243\207L:\006\311\327\325U:&-L\307\306\252\370\361\254\211\355\300\372!\344\324?\r\243\257p`XB\223\222\202\321KPeCf\244_\204\3701\005\341\b\237\3150]\270\251a\355\367\024\213_:\230\267\250;\251\271\231XI\203\037\234\321\242eJ\341~b\366\020\235e\276\340\320\362t\360i\227\rJ\244\317\256?8\264\364\231\337\036p\344J\013\326\251\340o\230{M\236X?\335\222r\371\2134b=\234cX?\004\021\365\006X\26315\205u\232%\303\245V\326\366\342\322+O\003\377b\r\332]\223\037\326\017\321\245\246V\236\002\376\305\353#\212\257\017\353\206]\250\243\301\363\202L0\346 \006\231Q\310\024\315\220&\031\016\303\025@@@D\036\024J\353f>\023"
+	.string	"\304\212\314\225q \347\230bdfD$I\n\352d\231\003\344\024\3040\006\\-\324\344\362\207\007"
+	.ascii	"\177$\217\207\346\300\305\327\200x\256M\234\016\020\246\355X"
+	.ascii	"P\325)\264\250E\3300\316g\363P"
+	.string	"\rSp\200\305):\262-\261\033#X\367\017\275^\217\351p#\020\207\366KM\315\202\333\3176\340'v\243\006\031Go\215\001e\025}7S\203\204\240m\213\374\221R\026\352S\331Nmx1\227\005\032\345.Ro#\243\224\340_?\003\200]/ \240n\225\350`\311\271\356E\371:\301\352\0364 4KP\220\\^\243m\306\342u\367\244\364\201\036\033\322\322l\341*\360\017\345K.\327\336k\212\357 g\020\203\023\377\267\022\027\276\236A'\3250bi?\333\224\253\021qJ\371\355Y\200\216N\242\341z1\271\244\247\035\016\204\342\007%\244D\373\273\037\324\002e/\007\030\226\025\2646\306\005\305f`\227\203\030\006\370W\016\367\375:1\276xU\300sb\310\223\243/\016\363\324)D\301\236L\236\bQV\333\351{\275v\030_y\301N\320\321\024\306&Qw\036O\0131x!\374\353\bm9\320<\0371"
+	.ascii	"yG\345^D\311\307/j&\223\230\220\304F\204\331d<Yo\302I \327fp"
+	.ascii	" \320\236\213\2405\207\b\340#\343N\026\374s^\241M\217`MC\tvy"
+	.ascii	"Q(\354\35140\3409\357\330[\204#o\241I\336\373\325z!\324\231\210"
+	.ascii	"\302\261\036@\275\006\035\1773`\200e\220uY\034\002\202\214\332"
+	.ascii	"W\006H\"\311\024\270P\016\243 q\307(\274jW\275\321\003\203yu"
+	.ascii	"[1=\233Z^\356.+9\\\3568~\013\r\244W4\202\023\311$\252\326dC\032"
+	.ascii	"e\353\372C\034\360L9\357{\363\345\311\201\256|\316\367T~S1\304"
+	.ascii	"tY\266\361\021n\216\234i\371[\017\362\336\34424p\251?>\266\022"
+	.ascii	"%\254\343\035o\223\375'\373\346o\001)\270L\035\372\005\222\266"
+	.ascii	"\371\360E\256\246w\"\251\374\316\233\221\306\nj\t\252r\233\326"
+	.ascii	"\007\224I\264\f\274\214x8eE#\312.\222\272\305\367\372/\263\236"
+	.ascii	"\237s\214\277\224\334'\365w\353\257_`\251\371\217MT\037\216\315"
+	.ascii	"_a\353\375\207\270VjM\324\204\271\267\334\227XN\242\305\366\205"
+	.ascii	"\264\255\375\2104\326\001\374\376\307\316\217G\327\325\035}\374"
+	.ascii	"\305\264\0028\202\303\222\337\\G\3317h\316\274\371v\305\354\233"
+	.ascii	"\247z\300\022/\253\035N7\266G"
+	.string	"\350\023;\276\277\351\333`\341\200\243K~\300ax\016\230V[\310\261J8\245\022\314\037Q\202\205\331\326\256\"\320\003h\326c\305.\024/\036\225i\314v\244\345\230\215\033\305\026\264\231\223\274%\263\004\312\214~\340uO\r\352\276\343\364\370\226zLH\007\316\032z\021BJ\306\374\t\252\232\361\232\327u\330m\350L\035\034r\034\"<s\242\311aas\033:\244^u\025\334\214Plx\215\237\223ek|\345\335\252\306\240\313]\323\310'\322$\231\304;\233j\003\204\31755\022\211;.O\312\274\212\213\026X\362\304h\301\372\272`\2426 :\024\275\316\314\005\245il\223\307\031\345\250\260\372v\201]\327)Fr\310~\366\036(\347\302\210\"\301\246\371\203\234\315\207$\\F\246k\321\267\005.(\224*;}\343\373\243\303\222\275q4OF\001t\035\212D\356\323\253*+\207\351a\0021z\016\f\331U\343\371"
+	.ascii	"\320\362\253*\301\365\361\021\367\345\351;\301\247\230\033#i"
+	.ascii	"\342,\214\335\217-\231*|v8[\356\037&\372\274eu(\345\\M\234\326"
+	.ascii	";\361\202\2254\223\266\2539\025\337\\2:^z\260\325\235\"\217\330"
+	.ascii	"\314\f\022\024\217\304\330D\200Z\205/\246\217UO\355H\200\201"
+	.ascii	"$\177\241\226\303\354\335\025\263\27595\206*\272\304?\335\256"
+	.ascii	"\250`fU7b\035\266&\274?3|\376\314\026i\b\345\243\3506\352NJz"
+	.ascii	"\031Y\013\204\320\326"
+	.string	":\274\210\366\364l\032\261\204h:\226\t\321%sY\317n\377\260z\256\375\216\004\301\240\333z\211\220W\215\bbSsU\311w]B{fen\306\320\274\363/VqE\221r\037\300\345\317\315h\030\2500\203B\303\260|\213\f\005N-\335$&\020T\306`\262\243\240A\374P\302\203\202}H\203u.X\2127\032\344\250qc\220n\344t\220\250\304W\335\270;g\320b\307\247\353\374g\375\201\023\357\355\221-:\275\304\020\343\305\020^b\272\204\226 2\204]\265\267\252\273\370\001+\346\302\007Z\246\275\314bn/KT\2321\013\271\215F\316\022\027\257\034\305\223P?\252}\300\224\331\365\304t\021\201;D\313,)^\334\016\235~j* \225\025\f\364\262#\244\251\251l[hvV\255\362\200Ix\273!v\214\br\355\301\"\352\tx><\2000\227UrQz\337\2716\232~z\004*\272f^\""
+	.ascii	"\\cs\006\366\373=x\244"
+	.ascii	"\213l\tE+\027N\222\020.\361\321\371ae\310\375\275I\b\325\264"
+	.ascii	"\371!-\034\317\213\355X\230\313%\300D\255\256c@\345\213\020\f"
+	.ascii	"I\0162*)36T\303Q\247U\025\206\005\232\233\274\007w5O\215\b\""
+	.ascii	"Ie;\321\b\363\316\375@T\374[\301I\200ob\021\007D\330<\326\316"
+	.ascii	"\271\302\221L.\036\252\2674\240\213\021\317\345V^\351\246_\347"
+	.ascii	"\375#\017\210P2\026T\346c\bQ\277\354\267\331\333Dk\376\004\277"
+	.ascii	"\302!\223\264X\375\031\003\247\322&+\226\260\033e\253\310\200"
+	.ascii	"WmS\257\352,\303\207mI.\320\333\007^\332\266\375\210\347\352"
+	.ascii	"y\262\003\274\267X\3253\340^\177u?\254\341\301\345\005\336\307"
+	.ascii	"\250\304X\226\n#\363L\272\344<\222\266_\334f\262\301\f\342\022"
+	.ascii	"\226\023\350\211\204\240DX\255b\327s\362\372\"T\234\252\225\374"
+	.ascii	"\256+\220\267]I\373\271\260\346\260\351D(|\363\220\272\243b\363"
+	.ascii	"\305\215\361\362\201\317U\245\343\363\224\262j#\340\367I\343"
+	.ascii	"G|\330\001\022y\335\030\251\341\305\211\377oN\343\251-\322\272"
+	.ascii	"\321\202Z\037X<\312'-'CI\2708\203E\310`r\375\244\350\271-\334"
+	.ascii	"Y\203\300\214t.\207\306xc^\313\343\261\031\027\372\f\0260\231"
+	.ascii	"\3006\327\304\313R\247\2402~\305TX\257\270\313T\311\246\013\354"
+	.ascii	"\232x|O\007\200[V\331\341\314\031P RkO\036\214\357\277\250\021"
+	.ascii	"\362\024\001I{\351D\346\002\034\363\313\232\0071\333E\214\240"
+	.ascii	"b\204\344 \"\376Q\315\314\352\027\004\355\271\272\341\031\265"
+	.ascii	"E\022\353R\330\240\253_(/\216\236\031\362\373\221u$a?\004\215"
+	.ascii	"\373\022[\220\317\226\025\tt\374\227\310kmL\b\303'\313\255\337"
+	.ascii	"X\002\266s\302l\246\022)\22604\263c\360\261\317\334\337\372\262"
+	.ascii	"\r\254\n2\364\202%RvM\373l\245\024\326.\024`\270\212\205\017"
+	.ascii	"\203\264\315p\360\204Y\027\b\333\354\304]\301H\343P\222\201\371"
+	.ascii	":\ri\002\201>\264\255\320'*+\367\221Q\252\364\223o\375\207\257"
+	.ascii	"\334\346\\\336md\300+G\357^\224\323\250&x\033\225\337rK\025J"
+	.ascii	"\240\255\222\tvh\272\200\255\235\370\005\245\222\002|2,\336\201"
+	.ascii	"o\305\013\251\001Zi;\027\326\262%r\242\301\312\265\257\026\267"
+	.ascii	"A\t\343jDJ\373\177?{m\017\025\210:K\307\263\310\016D\t\005qe"
+	.ascii	"A\034mW\007\310\263\276JZ\024\303\326y\035WU\221\305Q\241d\342"
+	.ascii	"v\256l\262\334\263\336\316\001\020\263\360\003e>cG\027\364i\211"
+	.ascii	")h\035q\240\335YY\225!?\322%\225\017e\301\247\370l\267(T\026"
+	.ascii	"Z\342\247:GA&5\343\223\220\234\361\\\3566\210\245L\221\252\202"
+	.ascii	"\201+[?"
+	.string	"p\252.\233I\301.\343\375\323A\344\257\221\002\367\215\013\373'\253p\016\265\345\356\355cU@h\315\307d\260\005\225<\215\002X\020\331\376\"6%Qh\270\356\3411\r6\260\274\247\340\365\211\261\345\317yh\321\n\217S1\217\2658\245\302\215y \252\255\214bS\002G\030ggaB\201\241\253\217\236!W\215\270\013\224\301\255\2260Rl\223\352<\325\\X\\\215o;l\344\034\004\273.\347\277;\244\361\024\342\357\364\n\005\262\005\306\005\201\216t@\333\300W\255\262\327\3003tm)e\250\\\037k\230P\226\"\234\306\002*\234Q\270\303`D\t\034\367u\022|+p*\001\b\017dUj\222\030Q\"\340'\275\2218\037+\353o{\037}\376\362K\036mn\246\204\216\354\202\242`[~\361/\343\n\nI\013\223\201p\316\007\231\266A7\024\3345$\216B\255\244 y\355R6\362\203\334\327!\234H\""
+	.string	"\2577A\3450\243b6\242\316\316\242\240g\240\236\270\253B\211!\367$\267\232\253R\023\300\r\230\211\303\302\035H\226=\"\243\035\264_e\313\374\243[\331\351\366r\231w\225?\254\212m\301i\364P\007\365)"
+	.string	"\250P&\300?\344\200\304\305q\027r\333d\023\342\"k\347\t\345x (F#NT`\211*\r\330\276\344\265\373\3379zB\242\220\325-\3205\0355p\340\026\304\260\\\354\330&J\t5\356\273"
+	.string	",>\026\026\230\337\307\207p)\331\224\361;\033\345K\342\305)A\274\031\006\234\030\031\225\262\3031Z@\234\271\200\330:MY\261\352e\016\320<\236\336\353\345\376\273\243\232wy\234o\235\227\316\027\202YP[\321\030\353=`\037\216;\303\347\211r\203\357\200Z\233\024\205\361\302\t\231\323<?\255\211"
+	.ascii	"\313-?}\305\005\301\315\240HQQ}*4\313Av\270&\251H\2304@\2542"
+	.ascii	"\030\374\342\217yol>\211\026\236\303\337\273@\251\264\n\004\331"
+	.ascii	"=#]\303C\271\027\247\344\357\272\321\321\214\273}){\210\324\035"
+	.ascii	"\275w\271\362\265]E\211\261!\030\222\245\034\323\336\260V FG"
+	.ascii	"\240N7\016\340\202y\037\032\352(\f\360W\020\206\200\204\264\021"
+	.ascii	"\276\302\007\353#\376\247R\351T\262J\274\3435\357\212\215z\336"
+	.ascii	"\253D`\315e\177\263\b<\017tg\001\236G\375\205\263\304\354F\036"
+	.ascii	"\243\350@\277{\206H\375#J\260Hz\300\361\202\343\037\310s\251"
+	.ascii	"\335\003l\341\337\\\354cu\002\204~I\351"
+	.string	"\270d\332u\247\365\363\331\323\t\036^\247\312\343z\253\225\342\"\234f\026\3642\267\361\244}}\321\233 \237\0325\225\237g}\235,j\002\372G{|\226O\337\321\346_`\036\220z\364\333G\307\335Q\272\375O\037\370\271\207\365\234D\032\313\365\2374^\247\357m\020\3731\004\313Mx\214\233\233%L\246\375\204n\364\tU\023\352\n{\337\311\336\245\\\317\371\330\371I\244\321D^\211\324w\f{/\024r\245\241\367\032%'\320\374\347\323\361)\210\263\346\251\022\256\246\354\177\366<|\321{a;\341\331)\220|\251\332\376(6\342\366e\241\223P\310q\242'\313\365T}\023\331\320a\013\205=\361\361PK~\177t=\337J\234\337\001\003\223\376\003\334f\371\323I\377\361\363|\217oy\034@\216\307\n^\006=\265\363\375\\\376nq\316\355\035\240]\224\267>{d\r\307\247\376\215}p%F[\020\341)\3575"
+	.string	"\317\006\255\006\364#/\232Q\354\303\240\235\241\363\335\221\233Y\315\325\332\230\361\213\352{'f\ra\337\006^\365\263O\t>1\232\037\344\376goXM\336,\341\341\341\3318\035Q\366\001\3669\370\276\324*\217B\366%f\342\303\025\306\247\326\261\244\272\357p\232\3057\344\017\025d-8\020\317s\272\035\241\371\220\337\277\304{6\343\272"
+	.string	"\237Knez\n\323\276&\372\207\315>\271I\200\377\311\226g\233\373\026\215c\370<@\272\326\313\t\220]\347\217%\267\227\027\023,\016\341\231\3718\272s\276\254\276\325`\243\t\033\215\202\023\350\266\022\313\267t\220\215\336(\273?\360\031\304w\265\326\252`\356~\205=\304:\021\373\211\320\343\375\266\360\363\022\364\354\302-\216\332\377\366\214|/;wO\371\323W\227\273\2362\231\r\362\261\371\357\025\270,'N\030\037!O8n\310{\t\344\031\273\267\304\265\213\177\377o\364=\367k\227\332\266\033S\273n\227h\366(\007yG\237\257Q\373\366\205\357d\2616"
+	.ascii	"\230\260+"
+	.text
+	.section	.gnu.lto_.symtab.7766df49c0b896a2,"e",@progbits
+	.string	"pgResetFn_rxChannelRangeConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"pgResetFn_rxFailsafeChannelConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"rcInvalidPulsPeriod"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"suspendRxPwmPpmSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"resumeRxPwmPpmSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"setLinkQualityDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"setRssiDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"setRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"getRssiPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"getRssiDbm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"setRssiDbm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"setRssiDbmDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"rxGetFrameDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"rxChannelRangeConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"linkQualitySource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7766df49c0b896a2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
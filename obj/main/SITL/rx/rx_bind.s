@@ -0,0 +1,286 @@
+	.file	"rx_bind.c"
+	.section	.gnu.lto_.profile.6568b80960f3aac7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6568b80960f3aac7,"e",@progbits
+	.string	"(\265/\375 1u\001"
+	.string	"t\002%"
+	.string	"\004"
+	.string	"\314\207\332\246\017\002\002"
+	.string	"\002\001\002\372\266\366\312\016\002\002\002\002\001\003\363\240\215\235\004"
+	.string	"\004\307\253\231\017"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.6568b80960f3aac7,"e",@progbits
+	.string	"(\265/\375 .%\001"
+	.string	"\300\""
+	.string	"\004"
+	.string	"\001\003"
+	.string	"\001\002\001\003\001\002\003"
+	.string	"\003"
+	.string	"\002\004"
+	.string	"\003"
+	.string	"\002"
+	.string	"\004"
+	.ascii	"*1X\202\274\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.6568b80960f3aac7,"e",@progbits
+	.string	"(\265/\375 \340\255\003"
+	.string	"\002\306\024 \220)\351\357\016\3043\354\255^Ob\231n\273\335\273\342h\335\016gff\324\016j\310!R\312\024\017\375\241\252\020\317\351\323\005\212@\177\3569d@$\tf\002\366\277<\340d\361x\320\234\r\277iUU\352_n\206T\026\346#\324\321\250P\230GG\002\f"
+	.string	"\237\202\003\265"
+	.ascii	"l\\\031\"\b\026\216he)\240\354\253\243\217 \027\313\001@\331"
+	.ascii	"\273\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6568b80960f3aac7,"e",@progbits
+	.string	"(\265/\375 N\345\001"
+	.string	"\244\002B"
+	.string	"\004"
+	.string	"\001\001\003\177\002\003"
+	.string	"\002\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\001\177"
+	.string	"\003"
+	.string	""
+	.string	"\002\002\001,"
+	.string	"\004+"
+	.string	"\300\004\001"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"@D\315\303\234-\250)\330\312@\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.6568b80960f3aac7,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\230\004\003\230\004\004\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6568b80960f3aac7,"e",@progbits
+	.string	"(\265/\375 HU\001"
+	.string	"\310<"
+	.string	"\004"
+	.string	"\001\374\007"
+	.string	""
+	.string	""
+	.string	"\001\002\004"
+	.string	"\001\002\005\001"
+	.string	"\002"
+	.string	"\006\003\004"
+	.string	"\007"
+	.string	"\240\020\\"
+	.string	"{`\260\232\325\202"
+	.ascii	"6\320\006"
+	.text
+	.section	.gnu.lto_.lto.6568b80960f3aac7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_doRxBind.20.6568b80960f3aac7,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\245\013"
+	.string	"\346\325O@ Q\224\016\237!z\2430O\021\301\224BDt\036c\004\371(\032\241\202\005EM\212\243\235m\237`\267\352\322Q\311v\351x#`"
+	.string	"\204\207\274p@2/\003\240\031\035`8k\021\331[\312\224\002>"
+	.string	";"
+	.string	">"
+	.string	"\223G\333F\220@d\355^\210\307\202\224\tE\311\256w\351\207k\207\232\232\017\240\333\016\005\\\341"
+	.string	"\030\035dX\035\t\0368\275\340\020\240+evdv\327\311u\033\356x\333\fl_\354;\b\"\257\270\3708\211\244F\371\331\336\226\nb\037\256zpu\324\0373\255N\247\246OQ\022\246\221\312\267\353\361\335X\222\310B\204m\221m\331\316<J\263\274\306\nT\213]\357\342\002\001QU\235\246\034\243\374fLBV\303~\254\001\312\210\022\032[\342x\b\356D\242\nb=\206\352J\340D\214R\332\260\215\335D\205\311\356*\360K\334\373\370 \036}\001\224\347\036}P\365x}\033\017\247\001\266\251\254\301l<\234\b\017B\331\025\312.\017\007B\347\322d\237\013c1FABvY\300\260\354\262\274=T\230J1\242\"}\255J\315\240\316\214\224\004\255T\265't\362\\\225)\351\346\023"
+	.ascii	"b\b\b\303\254&Z\255\367\201f\313c{\233\350\244\016\273\370\002"
+	.ascii	"\\\206\213\212\276\241e\226qa\374\030k\267j$\017&\207g\333-\362"
+	.ascii	"\336\327\324\003"
+	.text
+	.section	.gnu.lto_startRxBind.21.6568b80960f3aac7,"e",@progbits
+	.string	"(\265/\375 \330\r\006"
+	.string	"\"\013*1`M\323\030\300Ram\034H\204/s\276C\246j\b\201\260!\250\036\272\331~y\3108\370?\030>\202 e\253\335\307S\r\207\320{\250,\221[\246K\221\00355,X\317Y\317Q\023\003\204\223\236\204\213\002\256\"\036\236\233\250\252\347\236\270\251\032U\310B/v\232A>EE\313L\025\302P\354#\326\224\343\323Y\325\374mu\022v\243\"\260\262\213iaY\224\213\311\307\177\375\363\001\3025\314\350\201\311\215\220\f\222\315nt\332\2210\033<\023$\007DNFRJ2X6"
+	.string	"\205\335\275e\031\215\\\363/\370\t~\030\b"
+	.ascii	"2\003f:\003-\004\347\032N\030\341\230\020$\334\271W;\237"
+	.text
+	.section	.gnu.lto_getRxBindSupported.22.6568b80960f3aac7,"e",@progbits
+	.string	"(\265/\375 \330\025\006"
+	.string	"\"K*2`M\323\030\300\020X\334\034\b:\260\226\371\0226\324A\007\264!"
+	.string	"\255\216\304\366\313C\306\301\377\301\360\021\004)[\355>+j\370\312\224\007\f\"\267L\001K\321\003590X\317Y\317QSC\204\223\336\204\213\004\256$ \236\243\250\252\347\236\270\251\031U\350B\263\235v\220_a\321\322\242\na(\366\021k\312\361\351\254f\376\266:\n#\233\224\201\222\335\313\212\312\232"
+	.string	"\220|\374\327?#$\\\303\214\036\227\334\320d\210lv\243\323\216\204\331\340\231 I\020r\222\241h0X\266\200\205\335\275Y0\032\271\346o\360\027\3740\b"
+	.ascii	"2\003f:\003-\004\347\032N\030\341\230\020$\334\271W;\237"
+	.text
+	.section	.gnu.lto_doRxBind.part.0.25.6568b80960f3aac7,"e",@progbits
+	.string	"(\265/\375`w\001\325\016"
+	.string	"\206\233bF"
+	.string	"\261&\035\274D\001d>\321\212\030\202SO\377|\021\"@Z\201\217X\362I\211JNg4\277.<\355\33024\252\202g0\003\0325\021\323\377\377\337'\035\236\247 2\343\200\002\261\223\347 $v\357-eJ\001Q"
+	.string	"H"
+	.string	"P"
+	.ascii	"\377dT\t\274\f88\346\374\260\307\375\360\3552\302\325\320\346"
+	.ascii	"{t\247K\002\217\312u\033\016\241\310O\213\033\037\335\005\b\242"
+	.ascii	"\232\341\376]_\272\224.\004\201\321\201\206\250CA\021\326\013"
+	.ascii	"\r\037\035"
+	.string	"\006\325\001\017\205N\346\234\2768\334\327mG\260=b\237'\336\320\341\334\030\333\352\275\367+T\377*P#\2005\247*H\307\204\211.F\330\276\375\317d\213\354\026[\344\325{\267\331\376M\325\312\253\267\331Bn\203\305\t\2369\277\221G\033\270\036\355\327\270\304\304\264\262\355\022\223\026o\001\272z#\003\305\214\224\002\255\220!\346g8V\317n\313\001nA~\327'\245@\266S\256\"\273\346\234\b\374\024\307\241\340\213x\264\312\212\236{\364W\344\343w\201\007\032\317E\203nl\233j\\2s5a\346\201\307\177\217 H\344\3709\351\016\335V\243\022\211A6\222F!\031\225H\017\032\260h\030\213\206\225H\016R0\024M\005#\tq6\001\202\206U\3102\r\023}c,c\230\310\331\211\377&\377\035z:9;z\235\357\276\254O\\\026\345\225\021\200\332$\tz\316o\225\350A\355\311{\0054\235\017\334d\037"
+	.ascii	"J+\200\244\216\253\332\300\016;\314G\2607\020+\350a\024\275\030"
+	.ascii	"f)\254\002\037d\374\361'\251XX\207\2455#p\006\244A4@\024\fs\205"
+	.ascii	"\223\235\211mU\274\251\"\342\fGT7\327\034\341\234x\t>\r\332\360"
+	.ascii	"WX^[\360"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6568b80960f3aac7,"e",@progbits
+	.string	"(\265/\375 \265\315\003"
+	.string	"\324\005\261"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\031\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\027\b`\024\177\t\006\025\177\n\272\220\202\002\026\177\013\001\030\177\f\377\037\001\220\316"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\220\200\003"
+	.string	"\005\351\221\2719\001\304\001\003\002"
+	.string	"\340\236\212\256\001\001\242\001\003\003\002\"\003\004"
+	.string	"\n"
+	.ascii	"-2\350\230\031V\205\211\313\036 \267\223\315\340\246gp\201\217"
+	.ascii	"\021K=\001"
+	.text
+	.section	.gnu.lto_.refs.6568b80960f3aac7,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\001\002"
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6568b80960f3aac7,"e",@progbits
+	.string	"(\265/\375`\023\013\205:"
+	.ascii	"\ne0\026D`^R\007\363\300\307\035\033K?`]\n\007c\306&\226Jq\032"
+	.ascii	"\021\023\347dTt\340\340\315\222\023\377`\2240\236T\342\353G\222"
+	.ascii	"E\301r\370\"z\352gB\203z\236b\202\222^D\347E^\331\306\2662\245"
+	.ascii	"2\001V\001B\001\276\304\215\347A=.`\350\310n\332\355h\316\034"
+	.ascii	"\311u\331eu\312\222<On\352f\274L~$\267\303\326\3667\355\030\270"
+	.ascii	"\207\270\333\333\306"
+	.string	"x\023\212\225\0377u17\351\025\247u\323F\201\273\033\317\263\263uW\300\340a|\377T\376\377@:\327\026\355\243\344`\202\222\371\241\276\343\227\027\270\233\366\023n\0178\311K\027U\207\f>[n\352i\256\3053\004Wk\337\342\\\032\350\230?\377g\242+\346G\213\331M\201~\244\336\r\270\035\202\332\213F\035\202\332\023p3\300\024\240\335>\305\251\270YO\311\325~\332\177.\0022;#\345xS\257\342V<\273Y\267c\361\262N\313\332\207\376\347\241\336\361K\315\332M\223\374HM\335Hm\277\322\277\262\307\320\027\267+\251D\256\244v\366#\025\273\221\332\355\013\036t\273P\331\265\220\324\001\251\373r\350v\002\016\272\035@\203\356\376\323\335%\332\327}\233\272\235A\267'u{\202nG\352v\003\335^\240\333\273\273\373t{Qw\257\351v\242n\377u\267Yw\017u7\232\356\006\212F\243\321\356\236\353\276"
+	.ascii	"\272\203\200\001gh\356EKN\311\332\027o\013\222\304\256\373\312"
+	.ascii	"\2704\356\214\333u\265n\326\255q\223\227\353*=\337-/\323\367"
+	.ascii	"x\221\215\224\377\223\377\337t\267\374\317e{X\226X\355\314\207"
+	.ascii	"\234\033\267\363\267&\360\223gG\306,t\273\\\035\317SC\206\230"
+	.string	"\237\365\335\362,M\247!k\031\224%Gf\367\237\333\251t7\335-\337\343s\275<\366H6a\"\004\021\323\006\226\367\237# EH\343\036)6 M\337\217\214\324\373?\261\261\272\226\fG\221`\357CT\027&\344\314M\373\266\270\257\r\334\367\210\333\357p\177\361#\025\317\361\334\245o\\hpxw\27654mn\334i\277\353\"\244\347\016\215#7u;\216&\345\301eF\326M\033\317\347\200\236x\346\326\306\340:\247C\347\303\362\306'ZVG\027\240\314\2141J8\355ts\277?-\332M=\216\313\361\214\300\347\364\330\262\2472\364'\312\037>Rp;\002\325\243\216@m<\177\343kg\216E\336\264\231_\234\267\266\032F0\320\215Tg\023\240\316\020\347\221\233\266\177\3418\270\037s\213\234\2654\355p\355\206\323\322\352\272n\352n\327\327\370[\273\233\253\351\n\030\332\227\314\356\226\376\037\335\025\374\334\025"
+	.ascii	"\215Ar4S\323\016\377\236[\033\313{\343\342\350\373u\277n\023"
+	.ascii	"\263\377l~\033\032\254\200-\363\276\271T\352\276:\3726\333\215"
+	.ascii	"\013\233\017(n\276\031^la7\355\236\016\334=-\334\267[\375\367"
+	.ascii	"\002\312\277D\372\332\201\334\225\272\207\274\347\013\272;\375"
+	.ascii	"\357\356\036S\336\277\022\262;\314d\355\b\226\364J\377\354R\t"
+	.ascii	"u\262EJ\350\361\225go\314\"e\376\037\004\036\n\344\225\271e\323"
+	.ascii	"\226\275\237?\351d~\262e\255\224\371\227\237[\026\370I&P\231"
+	.ascii	"\217\254\022\352d\272\022\3322\213>\371\354'\217?p\262e*\323"
+	.ascii	"\264L\240\022zd*\223N\246\177n\337\341\330\262\223\315z\350q"
+	.ascii	"\350\377\271\362\030\353\373?.\237\215\273]\357\264\353\372\260"
+	.ascii	"\367\267(\031\310\377?\233"
+	.string	"\006\347\331\006e\344\277)\233\264SY\377p\276\353\002\353\254\326#Y\377\317\312\313\177d\233\242\331z\033\255\345\017}\362\310\205|\266\276,d\253\365M~8S\t}\266M`\262@\307\036\231Y\037{8\316%\206\262\371\375\316\020T\254\311u\323\313T\n)\222\345p\367]F\257\r,`\224\274\345\335-\327\343]z\371\013\326:3bG\306\333 )\343\343~\210\330\005=\265T\241\nk-\016\250P\205\265\026\203\244\204\306\225heuEB\310B\200q\r\032\213B\277F\302\024\226\214k\320\312\003\326\023Q\212\250\243\250V\341P\310\002\367\205\f\0232h\300\002`\354\251%\243&Z\tW&#\221\2702\t\031\241\002\b\255`\2248\361D\302\267\n\245\250\\\020\327\021XkU\220j\025\026\201\306\341\025\361\203Oh\f>M\025\205\353\n\341\023\326:$`\350\364\"\370$\025\024>E\255B\253q\204\006"
+	.string	"C\247\342\325j\034aTE$z\200\002*B\t\215A#\211\341\325\023\326\n\034:\025\213\302(\342:\"j\005\032\205!\242V\001F(#\036:\025M\b[P\225p\212Z\211\214P\031\232\214C\252+\\%\034\016\203SQBAc\020\204\260Ep]\021\324MM\037\222L\210\b\201\243\226\244\206T*\240\260V&\254\225iH\025l\301\024\265\026\231\226\b\f\271\317T\313\016\"O!\267I\364\\=\222A\274\204\256\240=\351\334\264\235\316\373Dj{sE|(\t\245\341q\362\354:\240\270&I\324\336\264\335\336\260o~\217\215\032\330\222l\b\t\332\215.bp\217\0367\f\277?\2534\225\210\242\250\325"
+	.ascii	"r\323\276aAK"
+	.string	"\230<\271\322\300\332\363\005\273^He\317\376\202\254\371\n\223\367\337\224\360\353\323C\217\235(8\307\335\221\3436\325\200\336\250\201<\310\2203\"#\"\"#\005I\322\001\240\002\221\2612m\021p1sjJ\222$Yv\003\324\007\200/\265\352\346\366\345\227\320\342J\234\305\320H\366:x\032\245@\252\345m\347\272$\t\225<\326^\374r\337\260n\320K\002j\251\265\204\020\373\356:\371-\304\327\343Q\002\241\357x(\210\344\243\271\311U`\177\031w\3621\276\t\207\243\272_~\313\207U@\023\247m~\340\260\344\303\024\257e\255R\327\211\020\274h\311A%R\211\025\200#aw\276P^C\211\323\353\002B\207\331M\016Y\213\226\n\210fr\032\tF\213\274\367K )\250#}\266\322x\254SN\247\341\321R\222\033\202\317'\202t\007\260T(\364\212;>\024\245\364\337M\356\343\245\375`\246\222\244eI\211\033"
+	.string	"\240\252A{V$,tO\211\274)\r\023\016?Iq\265J\263\375\263\330`\004\366\226@\310\215\234\317\335\232\n\306\027;e\2204\276\275!*J\373\376\220"
+	.string	"\243\255\250}0\277\243\013\026\302\370b\301\244\317\205;\236\361\203r\"?e\276"
+	.ascii	"\337a\314I\002\331}\022\306n~\273mC.f'\343\206\256 \356\322\226"
+	.ascii	"\343\005dD\333\300\327J\037\211\271\032\367\200\202\350\325\266"
+	.ascii	"\306\245\241p\251\370\263\021\312\323\240>\312f\033\270[o\322"
+	.ascii	"\005\276,,\372\344\260\364\023\025\362\276\347<\006\226I\r\023"
+	.ascii	"jJ\020UJ\370p&\231.w@b\211dc\022S\3221\346\315\177\345\320 \316"
+	.ascii	"\325\325\341 \177\260W\250;,c\357g\2432\2276/\027\366Q\004}\342"
+	.ascii	"\324\270\217\375\267/k\303\3548\330\004\372m\300\232\314\252"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.symtab.6568b80960f3aac7,"e",@progbits
+	.string	"startRxBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"getRxBindSupported"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"srxl2Bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6568b80960f3aac7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1484 @@
+	.file	"srxl2.c"
+	.section	.gnu.lto_.profile.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\244\002\225\020"
+	.string	"&\227YH\360\2606\215\001\370}\224%H\266{\323~8\310{\006\037\253\267\006\253P\017#x\216\315\333\371\231\365\244`~X>\003\317\300c\340\\x\006\236\201\347\242\325B\275\30300\202\261\370\366\373\377\337OM\2046m\222\224\310\016F"
+	.string	"G"
+	.string	"H"
+	.string	"\373\332\202\227\233\026H\247o\317w[\njH|\236\\j\373V\004+\035\"\270\256\001\313\325B7\230\030=8\266\271Bg\346F\313\226\313%v\312\203\371a\t1m\341\363\241\006&\227?s\270\030\274d\212\314.\004K\247\214\031\037\030\250\321\243E\213\016\237\203\207\006\377>-G\006\004\220\307i\252V1\025Do\257{\357@U\016\207\b\246\f\bg\347U\277\036\232\033\023Jt\376\270XY!\215D\241\\\316\315\321-\301\342\351\020\332\016\237V\2413$dH"
+	.string	"`D\361\366\016P\034\024/\036\234\354\233}`\020\253feR\262\357\344,\230\240IA\"\262\260Q\361\214\244j}\027\027\257\233\256W\217N\005\213\007\031\021\271,=\327E'\210B\b\310\007\351%\035r|\334}|\274r/#vl(\200\271v\034\264\b\250\354\213\362\311\023\323\320\202\001\302"
+	.string	"l\354\265\230\02364R6`\303\345% "
+	.ascii	"7gR2\311\310\251Q\"\207\207\034\016r\370\307\341\247\303\027"
+	.ascii	"\025Q\250\241\245\2001C3B\n\nJ\322bP\202Rd6\017\022@\304\n0\255"
+	.ascii	"\005cK[\255\377\031\243*9s\222\306\026=\321\210uY\256tP\231\301"
+	.ascii	"s \340\2126\2513G)\304\217\211\253Y\206z\324.@\033\303\24079"
+	.ascii	"5'Rh\204CL\233\343\245\222\376\320\341\017q\3550\354\271\256"
+	.ascii	"c\304\202\363h\264\034K\210\223\304\321\350uXdU\377\207R\233"
+	.ascii	"\201\372\205\274\236)\2122\320^O\231\007\336\013$\262^>\241S"
+	.ascii	"\266\211\310\264\370\272\026E\364\024\343\351H\265\3770<\320"
+	.ascii	"\222y\374U\245\177\277C\302'\370L\t\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"\r\007"
+	.string	"\022\211\033%\220'I\007\377\377\377\377\377WLUUU\025$\374\330\265\360\327\327Z\213\377\267\r[m\264Fl\263d\313\224\002\356: \312\363\274a;\345B\251\240\210a\007\255\331\326\274JH\bK~\220$\033\374\226\005\326\022@l`\304\354\002\001\013P\n\027o\3542\022}E\317{\371\204\326\354-\352H\313\351\341X\332S\364\204CtW\312xD4 p\002\0313\365\356P\235\0343\003\2707\332\226\215a\355\203\030C\356\252\003\354D6\226T\223\f\267\330\225\242\241\200\205\273h\331\257\326\371\f'\216\342\200c\\\310KPj\210F\326\260v\306f\013\030\267\304`\343\323\027\026\3122\026H\355"
+	.ascii	"a\307A75\230\356\212u\200q\356\034\254\n\002\234\210\375]\333"
+	.ascii	"\310'\266\251\315\237\206\265\221\n0\004"
+	.text
+	.section	.gnu.lto_.inline.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`]\005\375\026"
+	.string	"\006_lH\340\322&\215\001P\333\001\301|\235\fM\247\376<V\206\036V\363\231\255q\342\022\366\277\236\304@2\270\271\365S\234\206q\216\324E[\206'a\216C\214\261c\ba\307\213\345mt\277\300\3535\330Xml\367\220F\266\224)O"
+	.string	"Y"
+	.string	"^"
+	.ascii	"sN\226/=\210\277\242\215\216\217\205\323)\224\234\233{S4\026"
+	.ascii	"\273_\301\252\036g\\\256\276\353\3144\252f\316i\262\177\202\325"
+	.ascii	"u\245-\321\234\263\265)d\266-\267#\036\330l\177\270p@1\340\335"
+	.ascii	"7\326\275\204\335}\215\3059\347\344\336\273\203\020\245\177\005"
+	.ascii	"\362\201\372\252\372\327v\b\311\254l\213\216j<L\257\022}\260"
+	.ascii	"\200\trMX\0347\027!\\{Q\312\270\275\f\241z@\330\354\244T\255"
+	.ascii	"\3277\376\035\030\340\227m\016\200\223\262\304\022247\336\036"
+	.ascii	"T\353\220\304\232\365\037\030er_i!\253\376\300?0\305\305\270"
+	.ascii	"\n\001#\200bN\261"
+	.string	"H\307\307E\265\t'W\307R\357\252E\306_\253:c\031\017hI\207\262\024\216\241-\004\032\331@\215\237\026;\022\351C\316P\001\037\"T\350\360T%\177`\374U%\375\300\310\375\260=Y\325]U\266\206\300\037\030am\241-\305\266H\233\020\215\221G2\263\201\247\247\265\200\327\317\354GsN\221\026\003\335nf\3169\362\202(U\242\2119'k\024X\351\223\327\007\371Y&\271|S4\306\254\270\020C\344W\326\350\005\022\221\203\356\275\261?+\021G\203\r\017\r~}\240b\350\236\026C\026\234\033\205\261\3478\361R;i\027\215[O\350\3550$zd \031A\030\200\205\250\361<\205\224B5$)H\322\030`\242!Uf\036\022\240\2041F\303\310\230\032\n\244\002\203\202\324\273f\374H\346\271p\254i\351\025f\346\\\350\310+\344w*a\236\221\226E\033\036\360\347\334\377\312-:\027\233X\351D\200"
+	.string	"L\320\276'\367\005\212\234\003d\254dI\220\3402\225\177\240n\2078$\305\372\245\257n\227\256\2019\300\231\255\325b\200HB\021\301\373-\272!e\205~M]S\3171[\201\260\2457K\2439\315\307b$\367\242\312\034"
+	.string	"OVI\215\227\245\253\240\255\243\177\005\277`\301\323b\237\241\214\275I_RY\267\177\013{M\317\n,Ol\357\231}-\n\306\0242\3507\260\257\24546W\263.\024R\244u\302\350\210G\371"
+	.ascii	"\275\220\372\322U\274\244/\336\250\346\371FBS6\231\272\204_F"
+	.ascii	"IH`\233\327\241\247\2517\273\215&\325\033\224\257\352|J\200\371"
+	.ascii	"\311\207\377\305\273Rh-! \177\200\344!d%\274\251^\274\023\270"
+	.ascii	"V^A\277\353\211\253\\q\227\250\253\211dZN\023\326\t\316\321\223"
+	.ascii	"\344*K"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\r\005\345\021"
+	.string	"6\231K8@m\222t\306\301\202\362tQ\266\366\315\"{\207$\034\335\024$\313\275h\232\303\350\\X\307\3009\312\307\315El\350\324/\300\021P\013\265\227\2626x\240E%\203\020\231d4"
+	.string	"<"
+	.string	"="
+	.ascii	"\351\343\260JV\256\"\013\220\030$S\362\t\360\276\277\016\253"
+	.ascii	"\223\202G\323\"'\274\257*\342*\232\363\224\372\202\365\230\262"
+	.ascii	"\371\n`\203\222A/}%$K\362\341:\275\016\003\237\032\304\177\270"
+	.ascii	"\002\030cMP\212Mwz\001\276\031Lc\032GF\246\b\333\024Y\225;-\016"
+	.string	"q\231Z\233lZk\3556\345E\357\341s\201\236\013\364mXUN\231\236\222\002MQ\364iX\3455\275\214r\001\373\\D\220\230\001a@\024\314\331\352\267\233\200}\004\355\201\311\304b\2155c}*\247\247\327`\330bZk)f+\335\254\n\255\265F\023\363\304J/\216$W\021\205r\t\002\353\036P<\254\224\001\254\034Q\301\272\205\254/\007\037\225\320d\001\202 \f\367FS\337\303b\031\202\034\2077\265Q!;H\216K\334Jf\253B\222a\365\343\301\275/$\344B#\004{\250\361@\251\f\t\325\244\240\240\220\326p\"\24122\017\022\300\2039\004\342\034R\006M^X-\355\377\006\230\211tI\310\273\n1\231C\332\301\177\n\002\267qZ\242<m\355%\334>\226t\201\036je3\251\315\274\312\200\001\260\2758\256v\006\177\351\207\024g\032\236\207:\301\327\341h\337\200!\211.i\215\2252-\016"
+	.string	"\2272\363\221j\254B9PC`\023U\005k\323kw\023\225\332\006\250\276g\321\023F\254\264F\245\331\374\005\360 \006C\370*\253\004\214\274\354*-\016\030\025\204\2679\222\222\302\223\332\267\222\224\223\236\005\276sQ\242\020\332\2550@\"/o\021\365W\316\2028\365Wv\264\030\366k\302j\254\021&\2402\037O\326\272dY\343<\0045\311nw=\026\327O(\355S5\223\343a\177\030\320\250Z\206\300\304\016\273a!\355\325k\2413\226\023P\310\013\006\225)BiA"
+	.ascii	"\2751\261\301k\t\231+\206]\r\257\030"
+	.text
+	.section	.gnu.lto_.pureconst.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375 M%\002"
+	.string	"\322\004\020\030\220U\215\0010\306<333g\246\333\232\303\340\031\f\233pc/-\312#`\254.5\233f\322\215.t\237\3219\233\223\271\313\251\334u&#2\036\327\270\305\215\270\rW\270\301\354\326\335\005\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\304\001m\f"
+	.string	"\326\022>;@\247(\303\001\020\334\345\256KV\001c\213\331|n\205\365\351\030"
+	.string	"Z/4E\321\271\352\261zb\021\004z(\372\337F\305\253"
+	.string	"\304\023\253\257\002\357\261O\325 a\333\214vK\231\002'"
+	.string	"."
+	.string	"3"
+	.string	"c\355\315\271+'\225\202\231\252p=E\255\t\327\243\362\221\b\341\331\312[g\250<\324\t*\007\265\225\035\345\020\273/\202u\356\217\266\004\227b\234\30346^\217\013\037\256\277l\270\246\246\\\323Y*/\265\f]e\fV\331\303\334\030i\362&\257\013\234rN\307\002\357\021\340\346\032i\027\265\025\256\3052p)`f\243\312\026\244\234H9\305\023\034/\341Z\254\003\005\3363\244\234\362"
+	.string	"\325\210\236\312O\344\226rS3\031\fH\177<\037\001\003<\22474\236o\314\241<@\306\217\301\213Ny\247\023@yI+\356\006\363\212+k^\222N\034\240ja\241*{\251\367\002F\250!\271a\314\325\004\nR\222J\007@\002c\224+>\020\2106\252V\003\002\021c\002\261\035"
+	.ascii	"=k\005<'\204\226\216J\255\243\332Y\321i1u\351Lt\311\213o\351"
+	.ascii	"\370^Qd\250wG\247\352\324*\b\260\020C\300\240\274\017Z#\200b"
+	.ascii	"\r\346\271\215I,a\356\034\274\362EV@\344\304<\325y\366h\234\017"
+	.ascii	"!CGwJv!\033X\225\026;\231$\257\371\267\342\350%\177\336X\204"
+	.ascii	"{\324\206\241]\345\253h\343H\337F\221\202\335k\231T_("
+	.text
+	.section	.gnu.lto_.lto.f3a5334ab1df6282,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_readBufferPtr.33.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\212\001\002\177}"
+	.string	"\005\001\254\001"
+	.string	"{\274\001\273\001"
+	.string	"\005\0018\200\200\200\374\342\203\346\241\013y\275\001,"
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\350\037w\276\001"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\026./src/main/rx/srxl2.c"
+	.text
+	.section	.gnu.lto_processBufferPtr.34.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\212\001\002\177}"
+	.string	"\005\001\254\001"
+	.string	"{\274\001\273\001"
+	.string	"\005\0018\200\200\200\374\342\303\346\321\013y\275\001-"
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\250%w\276\001"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\026./src/main/rx/srxl2.c"
+	.text
+	.section	.gnu.lto_srxl2ProcessHandshake.45.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\177\002\315\024"
+	.string	"\206'\213I\300\324QcTh\330\362\007\355S\376\360\364\342\"\"cDl)S;-\337:bN\332\231\362\335\367W\211\252\245m\007\350\316\002\030"
+	.string	"V\331\301\242\300d\"\020\235"
+	.string	"\325\030=\203e$\227HN\212\226\350\333Vn)eJ\001u"
+	.string	"p"
+	.string	"y"
+	.ascii	"s\332O\272\317\366\037\316\007\334;4\365to\311\300\b\304\207"
+	.string	".\217b\037\212/`\037\3326\313\003\233o/\211z\336#w\226\260\356-_\324\305o\267a\245\363\346\343n)\322\221\026UL\273\240\207\025\245\347\210t\355tj\002+(&&f\025\203N+\013\323\316\311\265\323U\0013\220 \035\370\311\263\313\231\263\345r\357\365$w(\356\326m\207\260\355\300\236Q\001\264\003\220\210nf\331\246\375F\215x\257\016\346/\315j\342\275\367F\017\351K\330\207\247/~d\360|\277\334\f\332%n\322\236}\032\f\006\203\246C\366\177\277X\247[u\332\326\351Z\247i\235>\201\024!<\025=\036ZU\336\236`\223K\025\352\200q\245\337\276m\233\017\364\211_\276\206\355J7\007p\345\305\215EOIX\367\372(x\350\005V\256\217\212\031f_8\020\203a\017\307\")\362*\267c\226!D\372\201u\357\305\331p \007\303\316\223\342e\266\370N\317\361r \214[\217\261\017!"
+	.string	"\r\341\371\254\256\003\364\201#\244=WZD7\263\334\340*\226\322J\277\363\223s\2467\305|#\313d\346\311\207\276\214}H\251\006\240\030<\237\320\017\324\211$\325'S\244\266\210\231y\322\225\342l\344H\211\017\245\275\340k\354\003\262\332\214FS\223\215\342(\363\020#\373`\035[a\031a3\326^6\343k\006\"f\346\025\033k\257\225\024\323hd\343\213\004\2156\276N\312\373z\351\320o\326.9\232\343\233z/\213\026+\245z\357\275Ve\272\356({\033\007\302\030 \"\355\b\022f\323\n*\035\212s\213\332\023Nu\362*7\025\243 3)"
+	.string	"\241"
+	.ascii	"W\261v\205\367\020\227Xj\323\316C\312\3220\b\020\032\277S\333"
+	.ascii	"B+ `\002\221\300(\363c\204\036\f,\330^\225\021\333HX\305\255"
+	.ascii	"\234X-\215\265\346\236\214\240\304;\330\340\335\203\263\236\216"
+	.ascii	"\207\013lP\001!\270\027J#0\206\3555\201\261P\265\024\263\022"
+	.ascii	"z\363c\245\310?o\213\317\330\245\004\313Q\355\315\026\304\306"
+	.ascii	"\233\001\226-\304>c5g\026\270\020\336k\336\344P\227\213|\005"
+	.ascii	"\207\2431\274="
+	.text
+	.section	.gnu.lto_srxl2ProcessChannelData.46.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\323\004]!"
+	.string	"V\375\330I\200\030R:\347\232\215b6[^\207T\002-\221\020\277\345\332\227s"
+	.string	"\214\245\035\316\251\340*\345\262\257Yy\355fu(8\267\335\016\267'\377\335\205m@\234N\374\207i\334'\213dv\005UP<\257\325~B\b!r'\031\303"
+	.string	"\272"
+	.string	"\306"
+	.ascii	"^_\362\216\231\277b\374\"\237rNUe8\334\311\271\212\357JZ\215"
+	.ascii	"O\353\322\353\315\355^e\203\243,\264\036\005:\255R\206\016\200"
+	.ascii	"{\344R\022\341\226\371K\316\244\370\255\031\017p/\017\270(\367"
+	.ascii	"*\037p\320z\224\225\317I\217\256\277I\217r\221\231\355J\253{"
+	.ascii	"/\264\244\027\231"
+	.string	"{o\257}\360j\213\317\255j\212\236m\213|\343s\247\312D\343\352W\236n\234\024\336\334\312\222v5\320#J\352\352\227\307\240f\346\013U\224\324\323+\3358z2\310Q\245\006\017\ny\346X\331\321\205\311\2365\336g\220\326\333\031\017\352x\362|1\375\370\362\326\tj\311ZU\350\336\313\266\t*\352\254;3\003af!\363y\025\\\314\243}c\346\023?C\261\336{\234\3007\033\341[\203\314h\324I\233\326\326\377K\371R^\366\343\007a\340\n\373\246\025\351\321/\037D\305\206$\214\222m2+\215\266\253\314~\230\001\341\346\301\254Z\376\361\271\362'\320s\2613\317\307\316;:\007;\347|\353\307y\327\331\346_g\336j\271fg\231&gy\247\263\254\323Y\316\345,\257\252eU\265\234\256\226Q\325r\247\226\017\364),.\264\007\314{i4\341n\032Z\206u\261\177\354\007\373\273\376/('\033S"
+	.ascii	"t\004p\217UpC"
+	.string	"\356U\026\255G\305\222\274\316\250\370\023~\030\357\300^\204\2511\335\356\275%\326\243\366\001\301\365\336;\201\237\005CQk\225\321\003\264l\331\337\244\274\356\351\207\301\032\203\314R\233g\247\035\\m\030XmH\270\264w\332\232%\343\016X\233f.2)6I\337\224\366\311\376)\2472i\3076\366r\n\023\224\252\376&\305i\235.\201E\206\314Z\242`\365\346\226\376X\346\n\027\272\215\005\214T\224\240\032R\264\207\270\264dx\232\206 +\336pf\207\243\002\326\320\376\362\013\250\304hm\235:\266\377!\375i\346\020\"\354\233\270\210\016\2466r7\273\177\232mRj\3116\031\307\252M\306r6K\033<\247\231I\230\260o\352\266`I\246\256T\033\371\235\323\017\373y&\244\231\214C@\244\n\222\356*F\221\276\207\002H)\210\272\210\350\013\236GB\340o\b\364@D$\016w\304\n\300\240o\250\242\246\210\350\353"
+	.string	"<\362\035\205"
+	.string	"\006\211\216\204/@ \ry\276#\237\205\026@\241\320\307\342\267\343\037\004\t-\220\206\304\036\322\260'$\362\005{\277!\261\007A"
+	.string	"\033\271"
+	.string	"\016{GFF\303\336Ny/\244\324K\271\256\342\223=\227\305\214S}V2\314\253\024m\233v:\331wkL6\265\247\237\305\314\221\3524\257\235\222R\233\236\262\321\306\265\345h\337\316{\357]m\272\246}\332zIJ\361tM\273\300j&i\232\357\205E\261H\002\253`z\0245k\002s.CE#\374\030\351Q\232F\325\234p\350z\355]\037\231\265\304hi\256u}$\221\\\237jG\276\026Y\250Q \246\224b\206\021\023\031\tj\nZ\350p\002\021*,n\020`\311\264i\f\344\321\335\257\nj9\353\004D\336\223\316\241\306-\301\220\262\"\311\273\0308\026/_\316\006\201<\217\372b~dd\t\242\024\353\364:\363\2630\215}\205\013\324"
+	.ascii	"\260\237\322\343\3202\362\tF$\214|\\\276\342cs\204\016\211\353"
+	.ascii	"\030\207'Sw\301\334\021\307\257\325?\345\264{\216\262\342\341"
+	.ascii	"?@\332\205\213\032z\222_I\024\264\321N\221\202\2736(X\017O+\002"
+	.ascii	"\341\224\031\0023\346IF\0223lo\233\237\334W\221\323\001\337\331"
+	.ascii	"\206\2673\313\r\244\203\371\331\226\257\200\376/p\340J\222\312"
+	.ascii	"\230\0274\345:\205qz\034O!T\r"
+	.text
+	.section	.gnu.lto_srxl2ProcessControlData.47.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\221\002\205\024"
+	.string	"\026h\213I\300\020)\035\372\253\344\374:\tT\007\037\371g\324\007jLM\272\253S\375\224J\f\021\317&\031\242\322\3239v\033\365w\346hy\034\325\216\357\361(\222\rY\312\2422o\342 \250z\243\277)\230\017\365\352\265B\b\267\335;\245x"
+	.string	"o"
+	.string	"u"
+	.string	"?\2529P\303Cv\201h8\355\222\tl`|5\371\221\360u\274H\370j\333'\fj|;9\224s!\016\273$\254]\022F\205~\273\030\326\026\2357\237D\214\237*\245\036\356\342\270\363\360\345\013|\200*\253\224z;\25787\341\bQT\221\253\267\243-\235\323\326\001\037\f\235WO\327\032\231\361c\343\345\347\206^nN1ew=y=\017\367x\333:\333)\366L\021\324E\277\323\311=\351*^|#\317d\346y\257\276L\370zZ\322C\345;\342\261\231A\233\304M\032d\237\006\203\301,S \373\344\017r\244\333u\340/\206\323\265N\323:=\353\364_\266\037\326\r\224\034\2739\301\035KU\237F\034\351\267o\273\306/\375\341#\331\306\375\211JU<W\273d\311\253\035\214\224\3140"
+	.string	"\300\352J\020\b\346\264\217\"DR\225\006\371S\376\213\027\375\326\007\312\217\262\325\270\213\273\317\325\223\267\273\020\277\335%\371\223m\253\337g\333V\343\320vXrI>|t\263\207m\225;Q\224\036,\337\021\260\365\337B\177\351L7\031\013K\370*\226L&p\\\004\317'\203\322 \273\350\244\025\312\032\272\251\303v\313\225l\343\256\256\201\317\"\346\302h\364J?\023\276NZ\313\245,\240\202\023\b\037+\017`l\263*\253\305j\021d/-5\030\f\020hh/\232l%&\263\020Z\305\344\304\205\2066\003\243\241\301`Zb/0\025\332\f\314D\200g12\032\2546\233\321`\037\344\276\265\024\250\351.9\206\262\256lh\316o\361\267vw\305"
+	.ascii	"\323\2260\201R\234/\365\3314\025\206L\020Z\251M!6\317\363\002"
+	.ascii	"\237\033\212s\275H(\322JC\340\211\0258%r3\350\273\370\013H\205"
+	.ascii	"\233<N\024\025( p\002\031Q\271\003\235\206\316\314\300\034\335"
+	.ascii	"J\302U\303\307\265\221\354\002D\177u\022\215}\020BJ\274\363\037"
+	.ascii	"\267X9L\\2\252\203\364a\340m\244\255\325]\373\241-\276\225\217"
+	.ascii	">\210\207\302\201*V5R\215\204\217\3340R\3622i\002\315\016s\300"
+	.ascii	"\t\361/gk\210\350\367+\263\315sJ\321\367"
+	.text
+	.section	.gnu.lto_srxl2ProcessPacket.48.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\256\001\355\017"
+	.string	"\366\035jE\360\262h8b\243F\002\205\024:`\333\327:\341\316\343\265\346\372\276o\305\341O\234\237\265\246\260<\352GV\006\265\177\224\360\322\331av\320\t\325<\360\264\311\311a\371B\271rXF\330\021\261}\303\275\267\224)\005V"
+	.string	"P"
+	.string	"W"
+	.string	"74vG\007\026\371\336y|\210\367\356\373\001\357\235m\223<HY\365\361\204\353-/+1:\273#\250-W\275\3434U\376\352\335\204\033\361\005;w\230\213\260r\324ph^\260k\213\345\205\314lPx^*\232"
+	.string	"Jv\327)\276B\334\336m[\260\035\301\316"
+	.ascii	"\001(_\212w>\312{w]\201c\207\326!o\366\270Je\261\257\267\333"
+	.ascii	"m\307*\263\235\3668\375}\374\275\323\356\344\322\377\240b:;$"
+	.ascii	"\360\330u\335z\254\255\253\241\302\366m\247\354\217m\035S\022"
+	.ascii	"\024\330V\355C\203L\373-\376\222:\ru\003\273\262*4\317\032\030"
+	.ascii	"\347\311N\355\021)/z\024\304%\302\326\322\225/s\002 l\253\364"
+	.ascii	"\361\231\315\314\206*\213\037\303\227\361\0314.\033\233\361a"
+	.ascii	"8\347[p\005\336;\247\270+3.\177a;Gu\224\330]\335\204\355\234"
+	.ascii	"\024\227\301'\326\312\037\2669\334E\351\333mA\360k\246!\023\310"
+	.ascii	"T!4\022\231NP(\234\302\001a\350\002(\224\301\263\311\b\211\206"
+	.ascii	"SX\002O!x\"\002\215@\223\260\004\216 0iC(\004M$R\b~\306=\267"
+	.ascii	"*\263\207sC\246&}\225\227\302\202\373\3640\347vF\250GS=h*\313"
+	.ascii	"\217\271K\270N@z\212A\224\027?\005q\221\260\005\" p\002\241`"
+	.ascii	"\325\r,\n\355N\206[J@\021\272\360\301(/\263$k)\311\214\225<\344"
+	.ascii	"I\267}0DK\363\313\031\210(\352\265\243\201\363\354\202\374\031"
+	.ascii	"\030x2\332\274\360\347\017\036\316<\033\207ga\2061\200!\036Q"
+	.ascii	"\343\317xm\017\307:\367\221\001"
+	.text
+	.section	.gnu.lto_srxl2Process.49.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\302\002\375\025"
+	.string	"&\250\217H\260\226Nc\024\013\312\374\235{1\177j\024S\356\333\241\243h\346\314\001a~\321U\316&\346\272\355\354\022\271\215\326\366\210B\321\266\254ukI\234\203\257\352\225\275\227uM\350\263'1<\301\3153\027\026\246\357\275\267\2242\245{"
+	.string	"p"
+	.string	"\201"
+	.string	"<'\250{\201\020\314\240\274h\340S\306\213\345\017\214\027\215\263\221\034\350\273o\032\242c\362\272\367\312j\322q/\311Q\264\225\342\374"
+	.string	"\273\334\313\377\034\235$\233\314\030\255\002\036\322Wl\247\263,B\252t\260\335\020\025\307\244\254$-\214\216nmJQ\2143\266\023\262\017\270\242\224\300vA\264\306v@\226\345\336{\341)\321.\210R2\346\336kz\356\214n"
+	.string	"\267-d\233\202M\271\002L\307\321\343+\271\226C\177^\364s\306\213\257\027\276\201\211\255\257\243\037:\264\2019Z{\366\353p8\034\272\362\354\377~\224\007o\330H]\212\324\244\245\036Ejk\251i\245\376"
+	.ascii	"\003*\212LXro\321\320\311\255\022\245d<\370\333\277\3200\033"
+	.ascii	"\370\033\270\007}\312\013U\022\351\264\270\356\005\266\\\264"
+	.ascii	"\204\362\"\001zj\337\306\227p\377\225x\201{\003\247\372\341T"
+	.ascii	"\326q\352\267u\236\360\324R\r\237X\336\034\375\251S\231\034f"
+	.ascii	"\350\317\231\361\242h\325\345\325\005#\330\344\303\326\236\311"
+	.ascii	"jk\2451V\262\252h\351\236t\270\224\371\255\253(\232\037\361A"
+	.ascii	"\335\210o\254\337\302\262\207?}(\357e\001S\332\372&\254_\220"
+	.ascii	"\016\377Z{.n\216\264\202\020f\005Q&\266g\347a\272\370l\332w\320"
+	.ascii	",\270r\315u\210(\357\27509H\334\254\\)\365T\227\027\277\007\246"
+	.ascii	"\255B\b\332mf\263c\332\314L\001\264\333\354&C\273\251\271\341"
+	.ascii	"\354h\340\261\305l\276D\260\341\261\351\310xl2\234\232\331\215"
+	.ascii	"\314\264\351\310^\020\2706\202f\223\335j5\233\f\006\274\267\267"
+	.ascii	"\362\034\363S\201\354\275\367\226+\024\245\332\026.\320\237\266"
+	.ascii	"5\347\240\367\224#k\257\307\2118iA\221\2254\326\236\3573\302"
+	.ascii	"j\002$+\025J\326\262\266\334\306\220\201\376\204\325\247X1Ts"
+	.ascii	"\366\203\350\234\266\314\201l\b6 `\002\231A\325\003rh\rb\210"
+	.ascii	"\034\021l\005\223T\327\333Q\303-\243\262\226e\256\261\233\333"
+	.ascii	"\201\025:7\332\021\337\222\215\362b\017\332\225>Q\3502\205\203"
+	.ascii	"Q\361\007\241H6x\3610\205\211\2761B\307\225\362Cx\032\354ea\263"
+	.ascii	"3\266h]\355\317\275\206\b\237=\336\324.c\003\023\262\214\034"
+	.ascii	"Q\373\304Bs\322\360\306\205\023\"oQ\021s\004\321\336h|\302v\207"
+	.ascii	"\313\236W\360v\005="
+	.text
+	.section	.gnu.lto_srxl2DataReceive.50.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`r\002\255\023"
+	.string	"\006\343zH\320\224M:\250\346\241uF\324\021\311[\232o4\230K\201\336\345\002\241\301\252`\016\b\230\233\351Q\206%\3300\2056,Mw\317\032\265\f\253\310[\201#\245`\275|[&\250+\307\005\031\270\205\231*K\310\336[\356\224\002d"
+	.string	"]"
+	.string	"j"
+	.string	"\020\332\257q\236\327{JX\356\266\b\022\332\265-p\212w\031\340\004\346%\374\200y\351\227]\344\266\332v1V\334\334X\332\335Oa\374\365)\243\302\227\337\261$\320\021$\233\301>%\006 #\331L\305\243\211\222\231\rT"
+	.string	"\263XD\331\335\373\034\242\230\331@\330\261\354\256\241l\206sw\267\355\301v\003\033\376\004;\206\211\221~\314\274T\234,\351\006\233|\2026k\004\274\354z"
+	.ascii	"\207\347(\2460\333\006\203\252c?\356\356Zi\366{~\223\b\355E\350"
+	.ascii	"nB\317\b-#t\214\320*\241a\204\376\311I\022\022\004\243\335\024"
+	.ascii	"MH\366H\372\220a\373%\266\325v\033\257\337L\344\002viK\237wi"
+	.ascii	"\233\027\227\336[\246O\364\037-\026\\\\\346\245\314\341\226\224"
+	.ascii	"j\024\314!\251\204\233\241\2441\350\250\031\025\276\360)\272"
+	.ascii	"\320{\240.\274\274\314\313\250\016\204\344\334`\323\341\356\302"
+	.ascii	"Tu|\324T\325\3403\304\006\036\261\235\341<P\336\256\213\025\177"
+	.ascii	"\007\211\224\2673\243\247\036\377\347@3\376\216U\253\225\312"
+	.ascii	"\334\020SN\rl\362\325\307\361\034\034P\036)WjCl\255\\\252T+\325"
+	.ascii	"Au\262J\205\301\007\232\226\314G\323\372B\300\244@|\252\226\314"
+	.ascii	"\247R\300,\021\253\326\347b\261Z_\211m\037Wi\025\214\034\325"
+	.ascii	"h,N\315\335\216\232\235z\372\023,bH\235\312\034\021\323T\333"
+	.ascii	"\256\033\265\244\324v\367\201\035\341E\022\020\324<\341A(x\273"
+	.ascii	"\273ri\240vY\222\211N\235\270\233$@\364D#\242\021< \220\002\231"
+	.ascii	"!\354\001Ch\315\007>\361\312>\027\363\205\242=\262\033\255\367"
+	.ascii	"et\271.\223a\025\232\200:\252G\264|\247\273\026\022\266\264\204"
+	.ascii	"\305)\345\210\273s\321\030\245\356E\026\016q\250\244\340\004"
+	.ascii	"\254\313\177\300,c\003&]\rl(P\353\005\013;\361\337\261\213\013"
+	.ascii	"\212\023\031g0\303\031\020\3501\005k\264Q&K\022?\342X\2439\005"
+	.ascii	"\325\236\352\275`k\212\300%\306#\210\313\005d\002K\343\"\307"
+	.ascii	"\372\362\266\313\350\001"
+	.text
+	.section	.gnu.lto_srxl2Idle.51.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\270\003\345\026"
+	.string	"\026%\212I\300\224\326\030d\214\003v\233\f`\277\271@\326\237y!\\?(S@YT\200&<h\"2v\251*x\033~#\214'\032\275\243\214\303YF`\260A\026\fB\323\312\260\234.\336\177c\353\037V\223\262%[J)SJ)t"
+	.string	"m"
+	.string	"w"
+	.ascii	"I\236jtB\261\273,[\235]-NZ\277,\201\304\363\202\353\377M'"
+	.string	"\301:\034\203\275Jr\024\275u\226K\026X\252\3428\0063\360\n\342RL\271J!\304U>;1@\020\323\225L\345ir\024MzN\244%*\007\021\201\220\032Fd\352\206\026K\026\021?B\354%\252ND\371\177F\342\356\240\356t\227,\377\277\235\252?\2742\336]\242\335\245\355zV&\224\226p\2146\262\375\346\027\374\261\013\333\255\246\206\344\261\275\301\b\020D\276\235\350<\026\334\242\024N\035\t\373\377q\276\032H\366\t\277,]#\331e\037\257\260A\341\336b\300iNy\\\306!yd?\341\t\211|;\245\036\356&\341\332y\273,\276\027\355vo\351\275\244\367\216\335+z\257wos/\233\360\220\017\327\226\003\254\377\236a=\235\2072\n\245\001\377s\234\356n\n\337\250\255,\200b\033\017\266\305\2459u!\317_P\327H\234 \214^Za\251\330\345z\270\242/\317`\032\021$\274\274H\245C"
+	.ascii	"\364.LLs*\372\354)\210j\307q\013\345;ZI\347\035 weX\206\355\365"
+	.ascii	"\037B\301r\214\234\332\200\365\377\271\207\222<\316V!/1\ft"
+	.string	"\271\267344$\217\356\243\225U\327.\307\001\033\263\222\200B\316ic\346\234f\205\031\030\233\031s\332\230+\002\366fA\3464/\334n\247)Kz\026\337\213\266\345\211*\347;\313L|d4\022\036\tc\245\0279k\004\200\377\317DJ/\020\334\"\275\374\240\325\005s^\020t\006\324\002\362c*\210\322V \226\217\246(\006\252\321\320\313y=\320YU-e\3451u\323\264\224\002\345\244P\332\252\302;j*@\035920\rS\240\\\017O\002T\250QH\246\030ch\002\221\211\232\244\220\003\240\002\031\241\253\016\020PgfD\332\314\001C\\\215D\207E\325\341\006iPm\275\260 \271kI\373\251\036\016e\320\257\374FH\272.\366\362=\223\346\343;\023\025\376PbaI%\203\370!\025\361!\336\320(\250\n9\214>\350\251\200\\[Q\2232\370\2443\321\\\220\246\306\213E\352\370Ls\324\356\315"
+	.ascii	"\270\221\322\343B\362a o\367@\236Bz\246\3778|\347\f\346cj\207"
+	.ascii	"\353\356\211\227;\250\275IM`\016\336\253\272@S\274\366\016\206"
+	.ascii	"\331\311\366\024\213\254\f[ca\364\203\354\030\215\331D\377\003"
+	.text
+	.section	.gnu.lto_srxl2FrameStatus.52.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`t\017uF"
+	.ascii	"Zu\024\032CPdR\007\223\257%K\036\273\302g\261\317Y\346\201\214"
+	.ascii	"!\316M\017s,\242#~\310\255S\351'[\216\376\203\373\276\320\020"
+	.ascii	"!\340\343\032\0205D\361\022\006\202\352\005\231\364Y\251\217"
+	.ascii	"\r\264\022\273\367\336I\246\024\217\001p\001\227\001\217g\032"
+	.ascii	"\013\271\022\212\341Z5Y\334\315=\315]\214\177\267w\273Z{\265"
+	.ascii	"\203nI\237\262\351c3\263d\202O\r\033\032\252\325\214"
+	.string	"-n\215O\231\026P\033\037\343d\272\203\215\303\325\332U{\306q\034\304\321\035\364\366\355\356\321\036\306\251\035l\027\003\373\342\260w\314\224k\335\003\237:\230\036\236\246\243\2505\215\235'\332\22093z\333\013|\336\026\331\234\273\375\314\275\364p\264\035n\024\307O\346\320\304\361\024A\017\360y\333S'\272\336\372\034\311\365\266\273{\212A\217\206}*E\b\360\307\034\0275P\034O\217\037\305a\217\202\002\360\344\324\304\264\244DLB:2*\"\032\016\t\203\300\237\357u[\3663\334\376R`\315\346\332\230N\245G\2419\024\232\227\f\340\314\237\316\272d\247&ifZ\032:\227Y\262\022\027'\262\003\244\202\330x\235&\027\326Im\213\312\225\234$\240\311\020+\216d\245J>2*\232\242\245)%\023\r\235\313%yx\304\207\204\254\001%,1I\016z\325s\020\347\322\2654\221d \353\004\215S\304\3534\241\354"
+	.string	":N\366\270\226\346W\376\001\235G\334W\247\351\305\026\3438v\252\013\320\322|\3467sq\027\013\025.W\330\244i\346\n\343\306\276\200\316e\333\032q\2265P\227&\217(\004\0133\350\324\312\317\"y\255\305\r\235[\354\201\270\261/\247z\356rf\345\374R\210\343\2703\3239\304;\200w\347\251\356v\321=\244&y\255\256\335O\323\371\342X\351P\367\r\256\267\235\231qW\220\260\230I,\345t\335M\347\016m\272\314\214\245\212\313\274\327\355s\276g\003\207\016\035\236\004U\217)w\203\020\221\235i|\250#D\340\262^\331rR\377nW\275g\373\321\002\356\235\034+"
+	.ascii	"\310\005\220\273K\313W;\377o\221=\351\223\230\t|\267\t\024\331"
+	.ascii	"\231-\\\003\bN\353\225\335yM\344\310\330\217\266\253p\363g(\235"
+	.ascii	"\302\337T\370\342\030\254A\373\034\036+|V\274\315\377a\320+h"
+	.ascii	"i\371\3529n\314K\314\177\264o\270\376-\302\350\321\312\202\272"
+	.ascii	"\035\216\307\271\301\202\212\312\365\326\377}RH\372t\330m\267"
+	.ascii	"z\033\270\335JW\275\310\316|\341zk \312\031\364\354\016+_\273"
+	.ascii	"\247Y\371\243\335\376\327\353\265O\377\223\356_n\022\301\334"
+	.ascii	"#\336\334\"\202\271C\274\271A\004s\177xs{\350\260\341\315\235"
+	.ascii	"\301\335\274-\274\271#\004sCp\360\346^\240 \230{\352\030\314"
+	.ascii	"}\300\323\274\215R\216\346N\240\350b\304xG\275\271\241\336\334"
+	.ascii	"Oon'`\356\24677\323\233{\t\230[\351\315M|s'\001s#\275\271\217"
+	.ascii	"\336\334Fo\356\24277\321\233{\370\313=\364\346\026\002s\007\201"
+	.ascii	"\271\201\300\334\277_n\337\233\373}s\273o\356\326\227\233us\377"
+	.ascii	"\233;\273\271\275\004\0039h\222){\002\306\367\360\2766\305\311"
+	.ascii	"\321\177\225O\022\353P\256\324+\370\023r\306p\025\311\222@\266"
+	.ascii	"\004\016\t\202Q\035;\260\b\017\301\350\215\037\341\235\r\212"
+	.ascii	"\321\1775N\357\211\365\307\263\325\353\250\350I\206\272\361\213"
+	.ascii	"\256yM\336\214\210\2308\301\023~M\211\336\315\340\340YB\207\257"
+	.ascii	"\204\2552\377\374\022\215']\343\017\337\303\340\274-\241Yv_x"
+	.ascii	"r\314\356\334\247\033\222\242\241<O8\372b\350\337\2558zB1)eD"
+	.ascii	"K\237\232\003cg\347m\301O\t\337\370\013\336\321\344#\311(\032"
+	.ascii	"\204\003\250Vi\322\036\241\274a\006\342A\"\301o\331x\271e\210"
+	.ascii	"D\207\214\231\211\fX\005\276R\334\022\002\374\266Z\225>\305\364"
+	.ascii	"\334\t?\332\257V\354I\327\302\033\257D\t\223\247@\376}7,\006"
+	.ascii	"\217egZ\370\242Vf\346.\031M\006\227\301e\256\267\277\367\252"
+	.ascii	"\033\267\332\364\236\277A{^Aw\343\276\367&\326\354\003n\351\013"
+	.ascii	"\337\277\3216\3513\352\253\255\016\bwq\017\274S\375\350\r\036"
+	.ascii	"0;;s2\374\201g\302\343\332s\377\375\f\357j\234%\273S7V\246\026"
+	.ascii	"\226\265\005{y\377\367L\313X9\013\376Rt+]\341\302\005\327[\367"
+	.ascii	"[*\233\3363\355\367Qo\237\313qK\306f\246\300k-\316\227t\333G"
+	.ascii	"\022\362BI\f\0324\270\336\266\377\273\263&\365>\356T/\221\004"
+	.ascii	"N\231\013\305\215y\235y?\312\307\233\2022\027j\367|\206\312\230"
+	.ascii	"+\356G[\257]\020\013\204\231\327\016\350\351\354\332\357\002"
+	.ascii	"\r#A\025\215\030W\307\032V4hXQ5\271H\262\260pU\243\n\211LR\005"
+	.ascii	"\257f$oT!]\034V5\276\352\212\305\225\210*\0321\256j$C\344@\016"
+	.ascii	"\233*\301\324\214\034\310\033\307\034\310c\215\030,h\034\251"
+	.ascii	"\2207\216\t\224\332\312F\025\362xee\205<\006\247X\316\306\377"
+	.ascii	"\244\370\303/;8\254\317\212\202\372\316l\262\025\366B\002+Q\302"
+	.ascii	"\374\203\345\006\365\357\026\253\364\231\006E\365\037X"
+	.string	"\025\313S\207o\326)\300\027\277\253\033\312%\361O\2622\240\303n\361I|g\256gV\276\002\370h\024\017\360\035\376\203\036+W\2218\216\225O_\266,\035\333.yD\007\337lR\324\273\330\232 M\033\\\251\017\360]q\376\224\3332\232\002K`00\327\333\247\377#nzO\254\036L\224U\272\352\342i,\345\271\020\353\264\366\213c3+\003\345L 2[\316\230m\370\023y\3068\2519\275?\345\256Ma\232\364\004\334\tk6}\264\177\3316\302\216\023\245\235\2359\"~\004\323\033_\304;\231<e\372g\243&\r\344\371\215\021&\264\353\331^\240\273,.\365\307?\361\366\266\304e\351\375\371fU*S\372\257\022Z\n1\210\016\210\017A|\343\203x/CF\374\257\002\302\363l\225\243\364\321=\037\373E\361\314\356\322\352\304\356\002\3359\354F\275\203?!\347\312U$\t\313\343!q\343'\275?\345"
+	.ascii	"B\252\202\364_\2453pF\227G\374h\273X\227 H\n>\271d\357H\352\243"
+	.ascii	"\276\353C\036\035\017\377\341\350\003\2016\250Q8%\225C3#\"\""
+	.ascii	"\332\024T\322\001\261\005\204\030\345\244\263\016\021\360\254"
+	.ascii	"c\214!\232\241\202B\332\f\n\300P\371\357\272\212\t,\323\224\340"
+	.ascii	"\203\024M4q\362\222\007{#\020]\346\350\033i\366ZW\352\002\246"
+	.ascii	"?4\344\235\307Vt\2733\322v\365V\301V\271\314\001\224 T\266 \245"
+	.ascii	"\376l\003R\377\020\013\013\351\026\003\253PL\234B\256\b\206F"
+	.ascii	"\321\200E\315\307[\322\262\252\213e\375~/\210\357\264\335*\b"
+	.ascii	"\177\203\342\275\305\301\322\033$\016\215\263u\356H#\217\230"
+	.ascii	"/\257OUl\347Jkd\314\332~_;\255\350\177\351]G\276\224\357\260"
+	.ascii	"\3445\240\b\264\337\251\362\203pY=07)\204\006zX\f8\b\373\033"
+	.ascii	"\021#\311\277\307\006a\232 \340v&\227A\373Kh\244\305\243\263"
+	.ascii	"\212\263}u\344o4k\205\230_\325fg\3347\031\270\026\\\277\035\363"
+	.ascii	"\354X\211Lu\374\242]\316I\316#\341L\022\00417\031\300\346\332"
+	.ascii	"\220\343\333\351\"\224\215\214\274\023\027ED\273\360\214\360"
+	.ascii	"\301oh\004\203u\336\251\b\275\241\373\340\021\301\346\357x\242"
+	.ascii	"{\211\004\250h{U\2676+&\253\237\371"
+	.string	"gcO\"\217\020XH\272\250\316-\200\331\023\231\237\257e)b+|T\200"
+	.ascii	"\372 \023\377w?\303f\202\331Z\265+|\222\005\311\"\212\024\223"
+	.ascii	"S\200\b\310\\\013\017\261$L\354._\002o\002\303\217\270.\264/"
+	.ascii	"_7\366\233\247\217\026\265\225\232\366%\332\017\370\\\370\342"
+	.ascii	"c\301\217Y\240\006\300\004\032\301\242\033 D\315\355\344\300"
+	.ascii	"\217\0019d\302\034\276\332\027\240\343\214\270\366\n\021\216"
+	.ascii	"R\372\024\355\3328\351\033RP\342\023=\235\brF\020\261\307\264"
+	.ascii	"\030\337\320d \247;\033\344\325,\240r\022o\356\255\206\343\177"
+	.ascii	"&p\217\3354\315\367D\207I\227Z\001\b\" '\313\314K\205\3177*\306"
+	.ascii	"\257Mw\0077<~C,\245\037\201\313\303\304; \\\374\342\202\206\232"
+	.ascii	"\215LA\032\341\337\344\207\321\020\216c\360>\250\2541\263\311"
+	.ascii	"\226\223\364:\2151\013\314\3653\022s\033\212$\365V\206\322\212"
+	.ascii	"\275\241\307\211\236\203/\307\253~\262\330\357\017"
+	.text
+	.section	.gnu.lto_srxl2ProcessFrame.53.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`G\002\305\023"
+	.string	"\266\245\206J\300\322Q:RD~\337\tJ\003b~\237\262}\221\213\254\211\351\004\2127(\237\243\331\200\200\344\326(\227\327W\373\327\233#[\033X\201\306\237hl`\220\203 \b"
+	.string	"AQp\360\343\035\334M\366\016\264E\243\271\r\262\211\334)\005t"
+	.string	"g"
+	.string	"s"
+	.string	"\325\227#\251\3262\201OT\247.o\"\236\252^\"\236\332\266\n\203\232m/Q\360@<\b\351\214z\324Z\222{\342\266\2134\334i\363Y\275\333E\225\315ix \n\006\017\023\036\317n\354q\230aH"
+	.string	"\247F\210\221^Mx\202\303\004\324\330\243\231\033\026\360\215\220\032\351\345\302\026\r&\335\201\237\035z5s\202\254\324Z=w\275\0177\310m\273\330v`\317\\\2668-B\247C\350\364(N\263\376\273W'\372E:M\351\364\322\351I\247\017\240\201\017\216\210\235\241u*+/\350\2432Q\245\236\377~\373H6N7\372\221=Z\346+\274KP@\265\326Q\306\036O\247]\363\201\036\375\362E\265\3774\264h\312\332\213"
+	.string	"\305$\204\340\324\013T\247\255pN\373B\037\252\235h\303Ij)\212t4\335\030\227\265\002v\350~\314\335\035\367H7\300\323\303\323\035\371\344\224ZvW7\277\277x\222\253u\035\277\\\\\304\323\271k\343\024t\363\233A\217\323\266"
+	.ascii	"\233\337\255\366O3J\251\250\334\336>U\"\310b7\307(\342\227\002"
+	.ascii	"\360\211fN\331oq\027(\276\216e0\363;\030\361\364\013\364C\002"
+	.ascii	"g\350\0067\203v\231\233\233c\177\203\301`\320\353\013\256\220"
+	.ascii	"\362\202\275\320\310\230\f\006\223\271\006\310\310b\373\242\265"
+	.ascii	"\320 \274`/\264X\206\0073\263\021\273RT.\314\314b\310\231\031"
+	.ascii	"\031{i\201\221\256Y\f\231\022\3002\f\257\031I\223\311f\344X\342"
+	.ascii	"\276\276\333D\257\3406\027\326Z\253X2m\t\023\346w\336\275)\260"
+	.ascii	"\201SA7\307\3379\213(\322\364s\013Y\021\272\253\r\331\037\311"
+	.ascii	"\240\273KPA b\350\200B\026\221\265\007\236\004\030( \240\002"
+	.ascii	"\221\032\365\3270\2100\340\336\031\032\307\003m\305/\377q\254"
+	.ascii	"\334\206n\324LZ\342\354\366q\205X\320\3200+\025Q\360\254\302"
+	.ascii	"\226\207\306\030\276\177;\207\231\004i\223^\213\270A\f\206K\366"
+	.ascii	");G\020(\230F\214\253\243\342\260\031!\343J\363 \023q\337\201"
+	.ascii	"\221K\005+\n"
+	.text
+	.section	.gnu.lto_srxl2ReadRawRC.54.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\275\f"
+	.string	"F\031ZC\020\221\223\016\023 \013\257\210\243\305\304\254\0011\"\276\250\027aM\002\223U\210\be\033z\256\265o\254e\270\227\005`F\373^\"\332\001\250\201\002\210\t\362\037\234z\027"
+	.string	"\302\211D\020\314\"i{o)S\nH"
+	.string	"B"
+	.string	"E"
+	.string	"/q\023%\2332\266l\330\210\230a\002\023\263\033\261\216{\300\277\274"
+	.ascii	"\370\247 n\272\3234\371"
+	.string	"\033\325\351\356J\271\272\003*-R8T(\347\301\372 \343\253'\212*\225\251\351\354\256\363D\305\341~\267\335\3006\003\373!\001\360/\377{\374\235\323\371\322\277\b\310\260\264\326\256\206\326\314\302x+F\330\276\355\222\315\261\355\322\006QP\372\013\206w,*FK\202L\373.?Qz$y\200\335\225\230\024\273\021\201\013\\\177\216\227m\007'\232N\006=\371)T\247I\215TA\203\325A\225\305O\257\021V.R)c;t\024\242k7\265\300\207\271P\341\332\335\207\370\363I\340\337\365\253\033`1C\302\245$[v<\245\262\330w\253+6Lk\\:\244\020\007\"\231\246y$|6\331\3103\202\220\205@#\315\302\003\322\306\341\317\007\210\bi\033\301H\033\246\201<!\354\263\215`\037\003,\242\220m\330H$\3320N\334;\335\360\360B%}\023LE\261\235\352N\211\242\034\200\204\352\324\006M\310\007\021"
+	.ascii	"p\b\b\303h&\232\255W\364a\205\252\255L\261\376\022\236/nA\027"
+	.ascii	"234\366\200\021\002\025\016\356\002R\r\266\bMcPP"
+	.text
+	.section	.gnu.lto_srxl2RxWriteData.55.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\272\001m\020"
+	.string	"F\240mD\360\3204\035{\305T\350o6\337qV:\332\241\251'\364\275!4\243\237\276z\306!\373\347*\332cQ\261@\013\243B\303:\021\302\360\024\231\231-\334\006\366\330?\275\254bg\021l\007#1\353F\233H\231RU"
+	.string	"Q"
+	.string	"b"
+	.string	"'\274\343\030\345\320n\007\031<\273+\342\020\354\021\244z\332/q\023\336o\f\364"
+	.ascii	"\2734+xvA\021\033\300\036\r~\200\365\210]\263\036\355\3315\016"
+	.ascii	"\326\354wR'\024\341\356n\372\341\336\323\363\237\363\320'\003"
+	.ascii	"\363\274\030\354\256\363\223\321p\353m\027\260"
+	.string	"-b\247I7\312\362\320\253\265!da\232\211\311\224\r\302\244z\260_\355\356Zi\264\337\374\243\343\374\036\232\356\300\322\331\225\026Y\351PLcW\372\262\322VL\307\230\256\252\264j:3\375\017\002!f\220R\354fH\345X\237\330\003\302\366\355\353\330\3313\333\t>!!\216S\020\217\246\327y\003\022!\220\351\206HE\177\024\210\324\332\301t\244!\017SR\f\323\314\245\276\212.\345\203\206\215\357b=\376\263Q\"!!\245x\301\245\372\203\201C\324\221Zz\323\210\030\315\2524\352=\264R\b!\214,SG\212\340v\205\225\374\247\nbR\030_S\025u\n*e\312\027\002,(*\312\275p\023*\237\214$P!u.\033\251\333X(p+\333I\347\262\215|\270\305\002J\267\275\264\264t[\006\356\253U\032\233\210\360)i\214;\324G\375\305\001\337\306\016JJ4\355\320\007a\352\024$ 3\035\271\340"
+	.ascii	"\324\354\226\376\371-\336\023\301\267y\264\004.\377q>A\311\177"
+	.ascii	"\3264\323\347<# p\202\021\261\355\001\362\320\356\016\214\241"
+	.ascii	"\205\346\353t\017\216i\237\333\200\025\023\2521\223\255e~q\251"
+	.ascii	"\214/\230 \216\022$\231-\023kb\214\016\362\231\274\333\246\f"
+	.ascii	"\243\214\365\300f\212`\203\305\f\310\214^&gH\364\253\271\260"
+	.ascii	"\205\220\223)\020./\332G\006"
+	.text
+	.section	.gnu.lto_srxl2FrameTimeUsFn.56.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375 \357\235\006"
+	.string	"\222L.3pM\322\001\260\006\016\020\377\353B\214\202\020\021X1{\321]\344,\325\266f\267m\214\323\007L\246X\025"
+	.string	"\220"
+	.string	"G\265\242\300:\245\001\276ido)S\n\276P\b\r\231\207q\231\347\036\030\024\034\334\345a\034E\340\nb\341\271\210\252zN\212{\375\244N\036\225\260/\362\b}\016k6y\353\315\337Do\251"
+	.string	"\026\236\f\331\261\223\232a\237\255~l\247S\013<N4%\273\024\241\2255i$ \333\034[\362?\016\3021dq\343\n"
+	.string	"aL\214\244\354F7} zc\027\210\336T\343\360\t\375\207\234u\250\240XW\347iI\330]\247uU\334z\333\007\266\rl_\004\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_srxl2RxInit.57.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\265\007\005,"
+	.string	"\232M$\021Gp\\N:\345\300\n\332\256\241\212\304\206\001l\375\230 1|.\374<j\311s"
+	.string	"\017W;!\020\340A\214\033\304&\265V@ vG\342m\371\272QLr\2147\340\350\031\275\301\324\313\036bUe\326\210\335\204\354\235d\374"
+	.string	"\356"
+	.string	"\005\001\317OR\273bW\0239\"\322\243\357V\352o\271\262{\335\315\305\306\231\255\222yJ\235;\323\360,\037S\272\226\033@\247d6\236\230c\206\005\035\355\n\351Q\340y\2238\232B\326v?\354bJG\352x\200\234\221x9\3139\331\240\025\244G;y\002\370hz\001\370\350\203\bJ\275>\271$\352][\304-\314\234\223\301\253\244\201?\223\357\323\256\377\371|zz\274]\252\303\350y\355\332_\372Ow\341\004k2\303\342\214Lm\335\247u\037-(RDl\317\311\300\212\f\315\331H\r9\005,\247\034\351e\235\227\205ew?F\246\256\236\262\221\272:\201\312\377@\221\262\262\2723m\035\237\020\246\360"
+	.string	"\3433\022\317\036\031\\\224+\237,z\236\231\325\3463\3568-\020\333"
+	.ascii	"\20126\331\323+\310\357\313n\321\3104-\313\214Anu\027r\316m\213"
+	.ascii	"\306\2517\200w?\250\273Gt\353\032\004opL\3351+R\3313#R\274N\211"
+	.ascii	"\233\261WGD\213C\376\366\321^\306D\237\253Q\244\260/\246pS\244"
+	.ascii	"\323*NfE\232\263\223\204\376\230\023,R.\035\367\312+X\242QA2"
+	.ascii	"\331&z\217\275+\336\240\213b\331\206:\333\030\233\223\225\373"
+	.ascii	"\231s\316\347=\376\b\367\334\240{)9\264'\255&\333l\233\363\207"
+	.ascii	"pw\277x\230\241\002Kr\316\023\372_\016\306E\237\353h\327"
+	.string	" \262/\036\355\023\341\243`b\\ZaoL\266y\257\034d\221\253{\217\335\311%\373\303\222\346M_$\335Am\033\350\347\\\336\300'\177\003G\376\003\332\366\317w-o\237\223\275{x\266{=\266y=\333\273\236\355\224g\033\357l\243\251\3553\265}S\3336\265}\006\330\230\231sr(s\216j\316\3454TL\327\311~-?\227\353\354\331\335\245_Fv\024k\370\266}\262\304\030k\323\272c\335\201\217\332-\024\254\357\336\257=\260\316)\177\205\302\301\277\313\352c\215Jo\347\350\355^\215+\020\373\"\276\2741\031\353.\t\261y\255b\256\310\365\n\275\275\2578=\237\373s\225\324x\367\330?\336\321Jw\277\201\377$.\217.\375\r\354s\241\344~f}\356\274hU[\334\356\036\361\223\"I\322^\201\357m1\306\326\275\022y\334\275@\3104-1d\217\231,^t\367x\234\346\254\n\266\201\201\367"
+	.ascii	"\262kl\315\311\312\265\003\333\311\257Ep\367zd=\332\027\201W"
+	.ascii	"hKH\232\323]\352^\225\254L\030,qr\267\365\311\2209e\327\352\025"
+	.ascii	"\345rV)\315\257\225\312\202\325\312\333V1\254;pE\252\365\n\206"
+	.ascii	"\316p6\rq\212Td\230\033\276\034\372B\303|\003\336\004\356\356"
+	.ascii	"\3606&vJ\320\200\275\235\r\221\202793\275\270\246?\\\r\2104\347"
+	.ascii	",\241\237FD\b\002\001E\207Q\364\302H\230\001i(\244\301;2\022"
+	.ascii	"\026!\321\020\352\210\220\206\220J\020\315(B2\262A\"i\350\203"
+	.ascii	"Q\364\302H\230!i\230\266\013\241\0072\222\206G\301\244a\320\250"
+	.ascii	"hhF\320\305\360("
+	.string	"(T\240\2054\210\206A$\241p\030\354%\363/\222\326E5\211f>\240\rq\276(\315p\177\305\277\337\355\013L\267\351gy\274w\201\356\211c\210\364\356U6\343\254|\027\013U\346\001{;\275\224U>\367\330W\3250\357\266\030[\263T\266JUs\243.\227\370(\357\242J<qV\273\333\026\210\r\262B\251k*\034\025N\235\373tv\265\r\247wwO0\034l\267:g\365\262/\246\027\301\226[Z\323]\352_u\303m}\330\037\252\233ZG\205S\341\360\321\3735\007\366\246\306\251w\022\250xlQm\332\036\303u\351\247[\3025-\313\250R\265\037]=\312{\350:C4\343\375\334>w>\327w\241b`|?&\207\305M-\200\220\250Q4\343\024T\210fH\224&I!\035\200\002\221\261#z\021P=3\251$I\n\212\031\003+\260R\334\001%\003\243T\220',]\240\231\235ut\235"
+	.string	"\362\215\272\260jY\347\373\330\260\r\263\020\240\036\374\276[k\220iw\032\006\342\253\345\214\026E&\351\241\341\264\204\366\037a\310\bvY\346\023E\321\307\033\033%\271\255\230\306iS\016O\311\266\013\265\t\034\270:\345\232\230\210C\r\200\310\227\"V2d*\242q\001\274\020R"
+	.ascii	"\234\266\256\267\355+\bW\326\310\027&\213\365$\340\035\245z)"
+	.ascii	"\237\262I\211\234\203\030\365Q~\344*-`B\036\355\215\263\222i"
+	.ascii	"\"\227\f\206\001%\366\006q%\213a\341I\304\371n\260\367\273\355"
+	.ascii	"O\036\323\222\2249E\343Q\313 \345\260\320\3401\250\033\023\374"
+	.ascii	"\002@\211\307\235N\372\212\021]\202RU\212w\364g\237\323\004\\"
+	.ascii	"\026\330\362\025\231\"\201\346\265\022\030Z;\007i\377Q\206t\023"
+	.ascii	"\004\214\005$\177~\232`\263\003/t\254-H\302\322\241D\312\202"
+	.ascii	":\315\241\376\0233\213$~j\314\3516\345\243\366\020\032\357\325"
+	.ascii	"=*"
+	.text
+	.section	.gnu.lto_srxl2RxIsActive.58.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\302\314.4Pm\222\016$\243*J \351\312Z\022 \203\026\001\r\304\201?o\367\214\266v\267\3477AX*\001\303\331\231)$A\247sF\310\225(8\372\260\3667\221)g.\030\207\315\323\270\315s\020\r\013\017.\3634\356Bp\025\301\360\234DU=g\311\262XB,"
+	.string	"\341\365\355T\212\210\r\211\\\365\350G\347\232\236\340\264b\245.\247R\252\030P\001j\247\317>\r1\276\224\304\322\337\306\326.E\340\302D\252h$st:I\022*d\343\367\274e\f\202g\253\231\306h\200\003\013\201\230df\0163j\265Y\267\035U\270D%\030\351\323\006\220\220\2317\214D\321\261\377\301o\360[\004\t"
+	.ascii	"2\001#8\343\216#D\250@\\\023SF\220%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_srxl2TelemetryRequested.59.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375 \343E\006"
+	.string	"\302\313+3Pm\222\016$\243\252\214\252\216l]"
+	.string	" \003\024\201\nRi\245\360\2255\373S;\273C\231*\001\303\331\231)$A\247sF\310\225(8zL\263d\313\024k0\231\007\216\3334\216k\021\016\f\020M\3436\rS\360$\321\340\332\3044\271v\271\262#3"
+	.string	"\261\320W\244#\357zL\321\301R\225n\007\240\0222\001\f\020\216\376\372 \323\370Z\222e\3748\262\201\r\023\253\242\222\314j\264\222)\022\312\307\357\371\313\231\004\317\257WGE"
+	.string	"RU\220\250d^\215q\364\025\337mH\027B\242\023\312\372\024\003\0242s\244\254\213\316\372#\374\007\277E\b"
+	.ascii	"2\003\3020\021\341j\327\304\302\210\274\204\310\341\316\231\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_srxl2InitializeFrame.60.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`*\001\215\f"
+	.string	"\246VQ?\020Q\225\016+\034\331\034T\020\374m\375\r\250\277\233\315a@\340\274\272\254\261^\326(2\033C\bk\311L>A0\240\314\377'"
+	.string	""
+	.string	""
+	.string	"\024\031\303OKM\021V\352\257U\026\210%\233l\231R<"
+	.string	">"
+	.string	"B"
+	.string	"\001vO,\027\273\243\001[\266O\217\037\240}n\027\240}:\264e|Dm%\304\006\322\252\306\356r\322\303\303k\350\237\304\001\210&\321\365\241`w\255\242\351\302-o\273\200\355\213\375V%$L\210\240R\237~H\373|\234(\321\0201\2144f\217\"\225\034\354g\273\273\226'\373\252?\223jU\365!\221\017)\323K3v-\304l,l\276"
+	.string	"\001\261}\265/\342#\302\253B\017\031$Jy\355\002\030\022}\207\333\245e\322\3364\320\213\276t\264`\025\244\310~\013p\022c\305Yp,\t>Y\224\233\303\301U\304\236\3023A\355\216.\372(\276\352\270\363\350E\317w\023\340\266\273\b\374\237\217\201\264\006s\340\001\310\3738\220\307A\340d:\234\306\3738\f\305]\204\215\307}\272\316\343 \343>[y\362\326\301\001\033I\n\226\250J\002\227*O\272\341\372\213\343\247\234\001\365\"\250}^V^\032\002\036"
+	.ascii	"2\241]h`x\370\"\226\201a\267\243\231\017\201\346&\030\320\017"
+	.ascii	"\020\214\247l\350\021\332\360l\365\231\256\312\006\254\273\004"
+	.ascii	"I@\030%8@\273\241\340\226R\242B\203\331\330\001,c\305\301\250"
+	.ascii	"KX\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_srxl2FinalizeFrame.61.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"u\013"
+	.string	"v\326PC"
+	.string	"q\225\0168\320\205@\264}\272\223\006\216v\376\221\320\005\372B\307\002~M8Z\005\235Y\221% |\360\b\030\204%\372\267\327C\003\250^\373.\3410R\346R\026\025cE+\r\364w\373\271\221\224)\005;"
+	.string	";"
+	.string	">"
+	.string	"\273)\025\255\335\360\304%\227G\207\017\311\036/\007\311\036\355\3312\036z\330\221\017\253\n'j\354\256\246\035\356==\377#\216\001M\337\323\222\262\273N\320\224\341\326\333&\261mb?@~"
+	.string	"!\017\372(N\030`\257\t\372\331\341\227\312\301~ew\327\232\262\317\372\243\2465\323\231\351g\016\330(]0\335B\212\335R\354\306\272b\213U\306\366\323~\210\213\360\316\212p\217\2526\201\002\026T\207\347\223\007U;\250\274]d\327T\r\205\r\244\214\231#\243\332\240\004Zi\301\240\341\222\240\2371\371\360&:M\214\335\021\211\227\330|\325\243\035ty\360\321\357\262\307\250\016\241\016\201\332\263AQ \342:M\304i\f@\006\026h\036\256\3236\"\336\032|8-\264m\234\226\t\367\225\325\224\001\234Z\260\327HI\3669\231\277\342,8\276\312\002:\235\354q\200\206\027 f\2142\346\217L\r\017"
+	.ascii	"2\241\265h`\3610\002,\305\034\326\356`\302\250>$\265CS+\\\324"
+	.ascii	"\322\004p]\354jV\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_srxl2Bind.62.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`8\001\275\f"
+	.string	"VWTD"
+	.string	"\221&\351\230Q\334\025\254\020\366=\341(`>\221B\177\377\200\221\323\365'\323\363y[\235\363\\\241\377a \326\374\016-2\345\243\355m\210\005"
+	.string	"@-Z6pjq2\r\037\333\300\206\274E\2154B\222\f="
+	.string	"?"
+	.string	"C"
+	.string	"\035\262\323\301\320\2402C(8\366"
+	.string	"\347x\351\313:^\013\260\216\025\2658>\225\222"
+	.string	"\f\347afGfb\320\304\242\237\250\317\335\331H\243\337\007\203\314\354\333H\".\274\255\201\266\t\332\2731\313\244\364\023\235S\351\333\361c\r\326\021\305\305\006\017T\313K\265\247\321\203$\332\253\314\314\302\227\366\275\036"
+	.string	"\200\212\027\244?\264\310\004\221\352\221]\254A\261\351\333\347\n\322W\314B\264\211\345\foEp#\243\343"
+	.string	"G\205\017\256\221\002\3024`\033\341\031o9\216qM&\301\363\272\307:\016;.\337\370\f\243d\256\302\005\232\2461\026vq\211\013X\255\3113YGZ\fs\241\216\0349:R\036I\017\024N@\023\252~D\026\\X\321B\330\212\206\235\200<&\330G\013a\"!\315PJ4,C\226i\030\310)\257\022\276\224sc\323\265\300\re\2512G\220lz\224\314K5\344]\327\306\3724\2472\240\264\265\r\034\274\034"
+	.ascii	"2CO\025\330x<\264+\002\270\016T10\0063\327{\212\235\274Q\200"
+	.ascii	"\270\261\305i\214\331\310\030C\3000h\003\b\342j/h\007H\f\256"
+	.ascii	"\021P9~T u\031\375\325e\001[\300e^\264\223\f"
+	.text
+	.section	.gnu.lto_srxl2ReadRawRC.part.0.82.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`_\001\275\016"
+	.string	"\226]dC"
+	.string	"\221(\035\317\212b\020*r\030\223\023\236\231\326bN\354\255\213\036\365x\375\350? \246\345\332\343\030\365\221\320\033\304\377R\363\277\314\377\032\020\324w\2128OAyI\272\357\003\352\370\332\277\311\336D\312\224\002P"
+	.string	"P"
+	.string	"O"
+	.string	"\333\212y\331\355\016\374\331@\374s\027\355\2278\261l\373$\316\202r*;\025\226\006D\214\222W\314n\267\375m\234"
+	.ascii	"\374\313\017\200\177\352\341\251kf)?MR,\\\017{\366\"\003\206"
+	.ascii	"IJ\206'\3073"
+	.string	"\rdw\0355\334\357\266\025\330^`\037&\351\030\323\032LC-\375\264t\366\327\2570\235w\371\017\240\203\001\313.Jl\306vx,B\330\207\235\354\215\215\2627~\371\2279\037\247nQ^\332\234\017\324QP\370\306\252^\250 \320\274\313\351-\246\002\335b`Y\323\376\211w\250\267\230.`\003Q\363\265\252\241\372\n.\345\257\370!\360O\323\237lx\232\n\365\253\021y\303\300L\237~%B\2251\253f\372h\224\324\260AW\021\022w/$\360ST\b\371+\177\276\t\376\245\036\366\273>\230 \311X\252\313\232=[m\3311\255\211\351L\f%\b\rD>\"Q'\202G\363!uH\017>!\020I4\301A\211\013`\217\007G\244\304\215l%n\023\201:\241\315\303\215l\036\035\036I\370p\033i4\342\266\215\355|\266\332\362a\347\310\214j\364\304\266F\rB\242*U\227m\315\305S0jF\277\342"
+	.string	"\357\026P\323\033"
+	.ascii	"\33774\031C!\326P\206\020\201\251\220\314\f\374\245\002\001\344"
+	.ascii	"\201\021\256\030|\261\001\221,\224\036\342\334\f\303Uc\001\335"
+	.ascii	"\254\202\344\274\223\235\366\240\335\257\204\300\275\233\303"
+	.ascii	"\204g\330H\r\244y\364\265\005\017"
+	.text
+	.section	.gnu.lto_srxl2ProcessFrame.part.0.85.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`>\002E\022"
+	.string	"\026\340rI\360\262&\035\322\024\226\240P\335_j\243\207{\374\201D\035>\177h\317\317 P\343\362D\356\235u\007k~\003\243\r\346\326\320\207DxX\252\027d\n\004&\306\212B\251j\030\212\321\037U\226\325\221j\272\202X\262\311\336)\005V"
+	.string	"c"
+	.string	"^"
+	.ascii	"\257V\320\275\272\354b>\216I\257~\3557\261\253\330\340\261\224"
+	.ascii	"\0133a\350F\215h\267,yu\202\356\325{\001\356u;\001\356\325\244"
+	.ascii	"\355\343\345\356\350"
+	.string	"C\255\205\207hw?Js\362tn\244/;}\317\347\f&\304\347\200o\243\223\335u'\342\256\267}\262\355\300\236\264A'\200l:\221n\331\223\331t\212\271\365\262\306\345e\267\344\271_\\\370\345\261\22450\fX\266\004\346W\203\016\033\r\n ?^\277\363\237\021:\316\342-l\222a\3671\025\032J\261\273$\230\247_\222>\317{L\302!w\310\353\250x2\001\2732%\200\350\264\277\3429\261\353\250\030(\027\304g\3600\t\025\346g\366<P\231\375\030\227\021ZH\245\270WJE\350\244o\031\342\013\035\006\211O\263\n\004)\002\233\03517$Vf\221\377\026\347\007\375\305\005\3574\257P\346g(\334\353\217M\216\230Z\220\234Y4\351\214\351\366mw\327T\306\026\231\246\335\364\034M\2773\031\n\020\263\353R$dM\324\306P\002\303\225\353c\211a(\252\016\200\256\224\013\002\030\256\\\254\327\203\224\021"
+	.string	"LdQ\253J\246\f)c\353K\031?\326*\025~\252\261\365\225F,j"
+	.ascii	"\307\317%\212\343G\262=\177\262B9\230R:c\022\016\307\250\247"
+	.ascii	"\007Q\220\2219\351}n\003\265\240fw\3453\237\306kD\360i\257\226"
+	.ascii	"\200B\331\024\0027 \200\002\221B\363\3334\3200\377\303\342(\024"
+	.ascii	"y\017q(\320\201\377\323Vim\311r\335\235\222\320\034\032E\336"
+	.ascii	"\261)\306!\311\253\332\334\372\215\224k\317D\3710\033A\212\016"
+	.ascii	"]d mJ\242\205\373c\372\023\337`\366\002:\\\307\035\331'\224\340"
+	.ascii	"\021\215\035\226\2654*\335\272h\002\202\206C|]}\206\226\270\316"
+	.ascii	"\233f\344\300\231\376\262\355\214\002VK9\217\247\013\323\344"
+	.ascii	"\0230\036"
+	.text
+	.section	.gnu.lto_srxl2ProcessChannelData.part.0.86.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\266\002m\023"
+	.string	"v!xI\340\322&\035T\235\204\324XV\244\034\3411\241\n\361R\002\0361\337\b\343s\364\373O\200\372\251\2670\002\257\017e9\276\237\266\360\323\364\335\357d\013(\002\231\2468\256\211\006%\302w\fY\361\320\337\230\001x\262m\223\275S\n^"
+	.string	"f"
+	.string	"`"
+	.ascii	"4\020\0175\244\005\335\253\313\256\305]\304\376B\245[\241u6\266"
+	.ascii	"\037G\273e\202W\217t\257\250\0170\275r\0271\275^\3066\214\346"
+	.ascii	"\230\255\343%\212\275\255\310\305\346cw\277Wz\342\261\323\311"
+	.ascii	"\305\3749{"
+	.string	"Y9=\3179\026*z\314^@|\n8w*\331]w0w\275\355\006\266E\233\316@*6%\223\373\\\206\377c\357\326C\032%+\367\205\266\273\267\3717{=dN\016\033G\273k\241{\235\276\r\346\337\\\347;\347\261G\003+a98(\025\007\245@\310\312fdn\021\272W\033\330kRP\264\303\262\230\270q\263&\305D\003\021\261\241H\301\253\035t\257/Oc\357\325\207\361\030\261\317h\370r\b0-s\311\276\321k\254\374\024f\265\346g-\323\353\351y>\202\203\007R\b\226\2714i\315\224;\267\273kZ\302>M\317\323\364\253\310\201\244\335\017KI;\242\376\254\370\316\257\363\373\374D\377\320o\363\347\374d\337\037\":\r!X\020\220\212R\314n\031t!{3\020\240d!+\253%\305\254\272\257\013*\272\"A\026\347\022\303\324\030NP\221\344\350\205.\320U!d\251\\\"\n\205\327\030"
+	.string	"t\201\020\310\007!\013\034M"
+	.string	"\254HP\302I(\212 \206\224\347\024\t\203\223\327H~\257\361\023U \353K\215\344GB\300\255\f\341\370\271Z\255\361\363l\317\227\260\320\026SJk82F7KIx\322\033\237\355\350n\300t:\351]\002? \220\002\221:\263\003m\"\224\034\320\360a\207]\223P\372g\350\016|p\225<\27407\237]\022-\303\332\217M!8\364#\274\356`B\354\332;\274\200uM\241;h\224\341\035\236\320\305\036\021\263\026RA\330g\332j\215;\254\2410L\005\003\343xygc\217\261]\302\254\203\343\226a\222\241eG\346\002c\2756\225]s\370\330a\343\200\225Z"
+	.ascii	"\362\240B\236\007\330\375\236\332\2269o\215\005\200\366\320\261"
+	.ascii	"\220i\351\to\f"
+	.text
+	.section	.gnu.lto_srxl2ProcessControlData.part.0.87.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\351\001\265\020"
+	.string	"6]jH\340\260*\035hB\017\304 \355\021]\017\371G\3018\202e\320\023\004\344\0238l:\005\363G\27275\f\005Y\2645\367\226\344\216\005V_\206\f\017y`\207\3641\232\f\3128\032#\023\t\310,\367\216E\322\270\321\336)\005O"
+	.string	"X"
+	.string	"V"
+	.string	"\257\336\013t\257\366\312g\261\347\325!\220\325Od\360\226D\347f\223\022c\267\004\275:\201\367j\322\276y\271{\232\211\313Fcw?J;y:9\244\317:\375\355s\006M\315\346\346\341\344\223\3009\235\220\335\265\207r\327\333n`;\202=)\0042\026\332\367\372\231\037\346w\371m\267\217\202\364k\207y\314o\366\314\310\240\346\247\334\0171\031\324\227C\214\343$\006\346\300\013\201\220\266\227\024\347%\365\031\260\032j*\271\220w\027\362-$\036\264\303\266f9:\355\247x\271z\013I\027\343Pq\2310x5\310{uy\003]\363\b\272\323I\357B)y\356+.\370\"\\\n\347_\257~\330\275\236V\030.J\244\264\346\r\234o\274\225\215\255l\027\274\376v"
+	.string	"8\232\032\326\2641\351\314\224s\316\322\020vgzv\246\337)0!"
+	.string	"\304.\354F\215\225U\026#T\370d\017V\271\002\213\371\364y\242Q\364`$\024GS8\362\200\243h\234"
+	.string	"\226H\243\t%A%v\210\240\210\b\264\320\211@0\245\302\352\321GhD%\236>\225\370\231H\242\3227\022O\337\307\001\207\030@\361\033\303P\374\346CZ\264\204\322\231\355\216I\017v\240\333\025H\363/\007\300\275\250\331@Y\236\264\305_2\002. \220\002\221\261\341\003B\0059W4\302\243@P\202\276\340*\362\240\263\204\302\336nv\271i\243\214\001\030@^\241E4\f\363\303}{\340C(\210c0"
+	.ascii	"\r\3238c\253\321\273\327\225\324\261_\207I\202\214\022z\210\360"
+	.ascii	"\021\314\311\016\217{\206J&-\273d\243\256\26561I\247\035g\331"
+	.ascii	"k\261 \347\003\351Vo\377\to\f"
+	.text
+	.section	.gnu.lto_srxl2ProcessHandshake.part.0.88.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`;\002%\023"
+	.string	"f\243|H\340P%\035X\nFq\315\370@\264a*\"\224\025BZLH\341\207:J\326)\241Q\244\350!x\023\177\240\2062\351s\210\250\244\276\235\231\3054\224\306 \206\305\220OTF\013\202&q\3652S7B\306\336d\357\224\002e"
+	.string	"h"
+	.string	"d"
+	.ascii	"W\372\022\3544\235\017\330=\242Q\333\035\027\234\272\204;\365"
+	.ascii	"\370\003\365\224{\201z\352\320\316\361q\3673\361\347Ikw\273\371"
+	.ascii	"\341\341\3516e\r\375\330\351\245\236 \253\205\207+\024"
+	.string	"2\r\337\244(\033\372\334\030\370hq\020\221\365l\001\266~n\\\352\022\203\214GJ\002\257\037*\273kn\303\375q\333-\266\035\330r(kD\255B\2440JJh\033$ \333FI\201\331f\344FK3\021kw\354N\037\365?}\332\267\377\024\372'.\345\220(\250\033i\002u\263-\321\270B'B\2521\246p\247N\341\233r\034\004\363\235\034rj\227\270\t\330\233rHb\343\306@\0205%\255\335 \223S+\300\022\271<Sx\232\316\310\270BA\276\264\0035\232\321\2343\3733uN\260\tG\217\334\262\355r\026\223\332P\261\203&\247_{\325\347'yB\214\274x\352\307\324\3239C\314\262eN5\303\355\3664\360\247.\270\374\244\323\371\233z*'\325\220R\321\022mG\366\220s\346Y\277\355\356z\036\331\037\322[\225\236UZ\236\351?H\t\f\001E\273@=x\004\237\214\007\363z\241\361`"
+	.ascii	"|/\032W\315\353\0039\360{\361>\230j\227\023\024\n8\340\253\303"
+	.ascii	"\001;\232\030o\246s\001_\335\t\002\273j>\260\263\340r\201]\210"
+	.ascii	"my\225\235\311CA\252\2002D\355\354\340\355+\325\217q\031+\017"
+	.ascii	"XX\262V\214\320\261\031\220#\"\366\020\3526\355\b-\362\242I|"
+	.ascii	"f\314\276\213\277\250 \301\363\352\264\232\"A4\357\2530 p\002"
+	.ascii	"\031Ih\007`dE\001,\005\202\356\336\013\331\266\024\247Z\212b"
+	.ascii	"\267\204s\264x\034\211\037d\372oi\360\326\"\236\022\221]N\254"
+	.ascii	"3\326:<uds\246\013\3306`\230\007]\202.q\251\033\013\357\030\212"
+	.ascii	"@\201\362\270\212A\252\270\247SS\263\312\265eQ0;Z\262\270\210"
+	.ascii	"&\222\357\016\367Y\0016\222\344\334\213\3704\030\367.<\006"
+	.text
+	.section	.gnu.lto_srxl2Process.part.0.89.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\353\001%\022"
+	.string	"\306awH\320\362&\035@\202\270\325b#\024\b\263\216\\\353\215t\254s\007\321\030M\337\212G\345x\004\351hB\n\326l\313\317+\267\221\313M\201v\332@T{4\343G[\276\324d\220\367\207\240\362A\210h\213\031\023K6\221;\245_"
+	.string	"_"
+	.string	"b"
+	.string	"kKR\332\035!|\272\201\367\351\361%\335\247\367\002\335\247}\030\266e4\317\354\037\037\201\366\267\0348ECv\367\373T\026\237}r*\273\231?R\243\371\224\334\311Q\223XCq\345\034\3608\235 \251\335p%P+z\374v\231S\263\221\222\300;U\312\356\332\333\271U\267\255\301\366\004[V\b\332\235[\265\331*\351\371\361\347:i\235\322\222\223>"
+	.ascii	"\003\f\244vu\246\244\266g2\271\270\321\355\033\311\374\233WE"
+	.ascii	"\262\023\311xA\315\2704\332\213\274\372\364g|hv\"\031o\225\274"
+	.ascii	"\034\034\037@v\307\007\237\226\340}\n\220\226\362\243\354B3\t"
+	.ascii	"\3065A\263\224\366c\\\306\354B3\037\260\001\262\210\021HNUm\026"
+	.ascii	"\f\362\342\324\b=%\224\306\276\r\030\005@\273{\321\316p\246\r"
+	.ascii	"(\346\360\245\016&;v\027E\211\204\007?(\246\252C\334\361\223"
+	.ascii	"^#\306\002A]\335 \"\222\342\352#\235F\313\017r\b\327\364]\335"
+	.ascii	"\247F\211Aj\344\224G\244\355\362\222\027\257\277\3756\235\251"
+	.ascii	"'\033\245\221\372\343`H\001D\013\306j\211\201-,0@\013\306\202"
+	.ascii	"\261\264\\\\\260\227\330\205\230\220\304\240\311IKL\b\363\305"
+	.ascii	"\204\337\213\213\345\362\201!\314gr\300/\021\255\360\203\275"
+	.ascii	"^\341\267zJ\215\332X\247w\225\316o:\016\025\013+\362\342J\367"
+	.ascii	"9m\267\027B\364r)\nJ\005\247?H>NG\253>\326\277\205\310\363\244"
+	.ascii	"\372c{D7\365\303\020\217\233+ `\2021\007\251\007\325\t\2009\033"
+	.ascii	"\211\320!\024\313\316Up\350Y\323\200\332Yd(\2671\301\310\302"
+	.ascii	"\200\274s\224\343\"\n]\216r\300\343d\347\033L6U\236}\020\275"
+	.ascii	"a\306p\342\310\320\032\255\bvr\007m\226\205\002\206\"\343\n$"
+	.ascii	"\251\323>\264/0:\257,+\224\227\\\325\036\006\206\320\361\271"
+	.ascii	"\327\2061"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\341\005\355\027"
+	.string	"\206\243\210G\200\234N\007yn\227\002G\267\374\353\205\320\\o\325\327\256G\305\231\232\315\374`\334\323P\033\251T\237n\331D\321\210\210Zq\273\236\202\202\026\266\273\377CIo\210EH;\266\036\210\371\007]\005 \033C\226\"\311\224\002r"
+	.string	"s"
+	.string	"v"
+	.string	"E\325\274_\214\326\205VD\304\023\205("
+	.string	"\"\201\375\360\254\305\303\263Z=;<\247UO\3234\345\360I5x`\003\002\253\001h3<\243U\f\257\344\273\246y\231\\x\306R\231hAA\005\237\243?\252\024|\226\211\023~\326O\t=\313\304\b?\020J{>"
+	.ascii	"r\360\303\352\314}\336\006C\366\232&\230\027\3633\227e5\200{"
+	.ascii	"\357e\360L\225\231\311\266\\\326\304\347)}\237\251\374\263\225"
+	.ascii	"\036\317(\217g);\236\301t<\207\345x6\2468~\352\306\263\230\215"
+	.ascii	"\347(5\236\253\364\275\227\271G\343\231\254g\274T\225\361Q5I"
+	.ascii	"\310\306x\250\n\343\237^\274\223\013\036\263-\370\250\023\306"
+	.ascii	"\345\215\3057\255\330Y\025\006\312\\=RM\361\302\212\202gO<o\251"
+	.ascii	"&\336\250\226\320\245V\037\254\372%\252 \0229\253f\304\007N\325"
+	.ascii	"<\306\210\231\254\036\236\343\334\226vn\305\264s\234\311\243"
+	.ascii	"\353.\264\256\264\234\316qg\373Q\r\013\bR\316Ic\363\210kM\b\344"
+	.ascii	"\274\335\222r\245\0226/\245\2347"
+	.string	"\332\034\306\f\212\326\260\347\210\307q\3056j3\277rv\334\252{\315\220\364(\334\361\3362\312\3616\273\236\241\351\242\2053\300\201\212n\234<\233\263<\361\"RT\035\353\371\312\371l\346\343\371\314\374L\032wD\336\305]0*\350\013\244\202\0164\025t\362\334\352\023j(\300\227\037G\204@\2345#\231\023\320\005\234O@\277B\373\007\f\222\254a\351U>h\0139!\223\306\255\311\261 \\\303\322u\266\332\223\21093,=\007\355\0336m\2044\225N\242\302\222\323\024\337\226\374\312 \2562\242\357\347$\312\364\023\372\274\213=\237\267Q\327\363\346\365\034\347\245\033K\214\355\270\343\005o\250\201\fDE5\243EI\312\r\300\002!*\262\003\021\240\220F\031\"\201\220\0042\021\205\231\007\2607L\350x6\347\001SU\357\335%\177wLP\240\335\247G\360W\254\302S\306\354\021r\263\017_\035\345\"kW<\357"
+	.string	"\246J\313\341\204\326\352\354\035\243\211\245\",5P$A\275\262\312\300\361\251\230\303x\236\332`\362\227\233\232l\345=w\366pfU\270Y\013\250\227\033{\037\220\221\\\234\333\272\273jFY`~\364\252\244\321r\213\253'\374\201aNY2~\323\007a\006 \347_T\3415\365\241\267\3042f\310\027\252\330\0210wh\261\264\206"
+	.ascii	"\362@\316\201\313\207)j\330\340\220\317\225X\032\340\322\227"
+	.ascii	"\3511\"\314\354#1\0057k\267\223Putf\230\367\005\325"
+	.text
+	.section	.gnu.lto_.refs.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`%\001=\013"
+	.string	"\026\337Q4Pk\222t\230hch\024N\020UUUUUUUUUUm\013\250\336\f\002\261\241o\3641\022C\337\374c\315\242\265\215\020\333lk\215\020B\b\3312\005>"
+	.string	"C"
+	.string	"G"
+	.string	"m\254\237\352\216zF\375\322t\247:[\237L\027\347\262\325\345\352\017\325\037\365\260\375s\371[\275\341\362F\353\216\313\235\325\031.g\264\336\270\234i\277\260\316\326+\365)\365\246\323q\373\375\214\002\022\225\031\355\210\264kzj\237Q!\322\316\344U\344\207\374y\375=\351\220/Io\344\206\274M\005\364\006\365\005i\200\264jz6\003\310S\323\333\374\310\027\346\027{\305|\337\0165{}=\271\202\237\357\233\002W\2400AB\204\350\207\300\364\037@}\007\261\337"
+	.string	"\376\f\342/`\272\002\250'\210\035\001\374\003\2247\020\237@\354\026P\257\240\364J\354\023P\217\221\207\210?\201\357"
+	.ascii	"\277\001>4\371\007{\007\363\017\324_\364\r\364\255\035\317 \027"
+	.ascii	"\350LR\0029\203|^\344\275H\213t%W\364\302\007t\n\374X\351\021"
+	.ascii	"\225\217b\237@\375!s\t\354\221%\177\216\274q\356H\344\f'_(r7"
+	.ascii	"\351,\322K\321\t\370\0310\260\377\302\373-D=\r\004\001aL\364"
+	.ascii	"J\027\034`@f\036\263znh\033\"3\026\370\n`m=d\025\242"
+	.text
+	.section	.gnu.lto_.decls.f3a5334ab1df6282,"e",@progbits
+	.string	"(\265/\375`\250U%b\001\032J\322~U \016\241\225t\242M7]JB\364\304\1772\203O@\004\231z\177\033H\025\232\252"
+	.ascii	" 7\221\201\024\025\244\210h\260+g\262\301\222\342\024\017&t\371"
+	.ascii	"\246f\n\225[(\226\324Cz\250\224T\3072\207\017\035\215\013\310"
+	.ascii	"\275=\\\312\035\rZ\240\261\033!{\313\235\002\313\006\317\007"
+	.ascii	"\025\b?<\370;j\252\253^\254\360Q\313\b\351\037\357\013\201E\024"
+	.ascii	"\r\213,`\177b\177\b!\275\243\276\345\034)3\324\220\007W\325\031"
+	.ascii	"\301\234\225<\037>|\370\360\341\342\345$\037\033\356m\034\276"
+	.ascii	"\312\232\341\324\352\255\034\037I?\2535\255\261\316\322\361\253"
+	.string	"\3521\327\3676\211\033\353\327\314\n\307\"\321\250\262\354{\253\003\337\302\300\267J\370nu\207\252s\340\270wNj\205_\250p\334,\351\260\304\270\361\306A\306\206\f\240\213\037}\333\306\245jkb\321\367\201\365\355?\215\211%\246\313\262\357;\013\236\3214d\334\224\335\021\026B\231!\243F\256)\216)\306[\306[\316\031+5\030\377i\352r\016\211\013\006\323\336\235\224\027}\337f\330B\315p\366\213\232/ZW?\372\276\201\340\327e?9\345H5\341[\272x;)\361\332\232\337S\337\007v\323\177\032\333\366\326\007\326\367\357\246\026;Y\236\376\224g\222 c\214\364\375_\227\315\324K\312\314S\301D\221\222\373\276s\340\267\023\376{E+\325\251#d;\372vR+\301\300[\352\373J\006\377\017\254\313F\372;\370\240\217nr\026\3139_p\273H),\323\267\263R\347\006\211\306\223+}_\377\360\353\035\316"
+	.ascii	"\016sP3\020\0166\013>-\032\203d\316\032+\b\233\364\255\201UL"
+	.ascii	"]jP\307\274\nV\270\233H\312\254\314Y\251\323>\314\260\235\365"
+	.ascii	"\355&\370U\203\323\026\026V\r\302\340\341p}\0359\002\210\201"
+	.ascii	"\216\222\306S\026\230/V[~\024\351\373\327/~!\274\275\320\353"
+	.ascii	"\373z\346W\323*\026\253Lj \t\310_\365\253Z"
+	.string	"*\237-\213\302M\362\274\376r\276\362W\275\324e\365\253\\^\273\324\276\337\017\037xp\350\204\344\375\235\327\264\252;\347\341j\206\363u\t\256[\252^]z\250{\257Y\352\331i\224\224\031-\347;\235j\205\206D\326\367\025\f\277z8u\n\013\013\013\253\207\363\225\b\2765\303Y\363:\230^\264x\261\322\367\225\013\377\257W\352]]V\274We\316Jju\255\342\325(\325\212U&7\200\305\365\227s\276\007\177\b\274\312V\241\344\034)\363Q\r\326V\023\234`\316\271\303\207\0175\bU\326q\336j\307\243\023\205.\310\213\276\257,\360=\220\362\365\327\271JW\253\324e\255{\225\253ju\355U\231\231\224r\316\377 \256\276\345\330\234\253\300\2229+_\341\376\020\177\007\037\324\272J\245\276]\220\224sU\216\234\035]\322\b\005sV~\340\371\360\2413\233\324\025\276\017\001\376\353\224\237\246\246\312\030\033\311\276\377"
+	.ascii	">\007\360/\200-\324\235\363\"\340\n\345\257huI}CA\316J9g\016"
+	.ascii	"\346\224A\271\260\276\265\255:\251K\f\252\333;\370\340\366\310"
+	.ascii	"L\007\347\f\2223\204}\337\001\336p\225?x\006\374\212\301Y\013"
+	.ascii	"+\006ge\022\342\265I\2063jJ\231\327r\316:8^b\312\334\367\313"
+	.ascii	"\232\341\274\016\346\251;\247\255\031\316cl\346\272s\336\255"
+	.ascii	"f83\250;\347_\315\252r\230D\n\326Z\337\252\354\252\244\226\275"
+	.ascii	"*+\331;\370\3407JY,geU\336\234\221j%@N\255\0040\343\274\220\316"
+	.ascii	"\316\373\306\177\035\373k\222*\346\30129Y\345\265\234\225\027"
+	.ascii	"p\310hI\002\353{e\3359q\315p.\2613\352\006\354\331\236\031W7"
+	.ascii	"p\267\312\342J\332\211\333\016\004\334\355\002\260\006\272\316"
+	.ascii	"o\2725\365\230\315o\252\340\267\030\230\335\204\275\352\037&"
+	.ascii	"\t\376\352A\b<n~s\003-\202\277A\360w\t\376\2162\202\277O\374"
+	.ascii	"m\202\271\366\261e\277%\373\033\035\373-\206\023\001\377\225"
+	.ascii	"\330\024$\371mQ\330oW@\322#\276\341?\007`\205\3000\360\267\n"
+	.ascii	"\366\310\337\"\376\212\344&F\334\302\177\006\340JN\234\272\302"
+	.ascii	"\225\2344\177\243`\215\374\rXo\213\374\365\370\327\n\374U\205"
+	.ascii	"%n\240b\200\310\337\017\260\360w\315oS\374=\304\n\371\353\007"
+	.ascii	"\177\315\371\233\005\265\203\277^\033\344\257\033\374u\303\337"
+	.ascii	"Y \376\212\301_A\250\036\374\320P\315\f\240>\351\t\374\327@\203"
+	.ascii	"\377\027X\022*\t\376\352\325f>\360\233\204,\370\375\257\031\233"
+	.ascii	"\374\377\326\305\256\0130\374O\200\211\276r\3667\226\345\372"
+	.ascii	"+\003B\270 \3538\2779\342o\037vK\203\356\322\360\233 \370\353"
+	.ascii	"\255\326\305\346\254\002z\374V\004<\252\n\254\325\337P6\353\357"
+	.ascii	"8\213\225A\353\331\032u\205\032\365g\2778\3407\363Z\n\312\357"
+	.ascii	"{\255\302\342Pr\236\337\244\2617\234z\005k\343\257u\352A\202"
+	.ascii	"\017\300\177\263\374\255gk\374\266\004\215\377V\376\277Q\371"
+	.ascii	"\357\367\272\273{y\337\277\\\203?\257c\360\233Q\376^bg\374\335"
+	.ascii	"fe\374\237\373\033\350\002,9\277\311\366\267\232\215\361w\230"
+	.ascii	"\205\361\327\"\177\327\325!\177=r\201W\332\316o>\375\027\364"
+	.ascii	"\300JE\375"
+	.string	"-f\241\376z\365\333\027\177\325\262\007\370\033\205\247\337N\300\351\257Y\277u\361W.\252'\340\177\t\256\001\207\3376U\257Nb\252\360\367\235e\372k\213\352\364W\026\1775\373+Y]\362\337\356\267K\277\315\177U\353\271^\332\026\374\225\351o\240\neY\320N.\200\337\304a\200\377\177M\343\357\032\277]\301\177\3637;\374V\005\277M\341\267\307\337\032\177[\374\355\211\337\216\340\267&~\353\201\337R\340\267 \374\326\001\277\375\360[\004\3746\203\337\n\340\267\032~\213\341\267:\277\305\371\355\371\333\373\333\372w\341\337f\376\016\374\033\360\357/\177\357\375\335\3677\337\337X\376\306\373\333\311\337W\376\256\373{\356\357\264\277\223\374-\367w\224\277\335\376^\373{\354\357\256\277\223\177\003\371\373\307\337Y\177\363\370\233\352o\033\177\327\370[\352o\250\277\235\376n\372{\351o\245\277\217\376f\301\337&\374\275\202\277E\370{"
+	.string	"\377\363\376\312\366_\311_\201\374\365\307\337*\370+\327__\374\327\340\257!\374\275\302\377\276\377{\177\253\370\353\3776\372\353\t\376\212\201\277\217\177\033\377\272\201\277Q\370\273\370w\212\377A\377/\370o\374o\342\277\333\177\301\277\201\376F\377\036\361w\005\376\246\300_W\370[\002\177G\340o\017\177\037\340o\003\374]\200\277\t\360w\006\177]\376\265\311_\231\374u\355\257j\177E\362W\260\377d\376\372\365W\257\277\372\370k\327_a\374U\352\257P\177U\301_E\370+\004\376\017\376\007\374\017\346\377\337\377/\377\313\376\213\375g\361\237\356\177"
+	.ascii	"\n\013\013\013\177\233\265\037g\304?\201\245K\312\243\312\344"
+	.ascii	"d\225\223Y\357*\n\243\035\225e\247\234s\005\304I\251\030`\372"
+	.ascii	"^?1.\002\247\364\275\205\250\333w\271\f\265\226\300P\366\275"
+	.ascii	"\205$\374_\276\n\245\214K\237\236\336\362\352U(&(\363QM\222\\"
+	.ascii	"\023\234`\216\212Z\300u\306`\245\030\024\224\017+-W\016Pd\212"
+	.ascii	"\221\276\257kce\376rV\336+\031\310\273W,\331\255b\225I\232'I"
+	.ascii	"\204\1779\347+V\314\f\336\315r\363.\226\272\274W~\355\256\225"
+	.ascii	"{7EIX\222\232[\267\352\316\271S3\234\267\216\307f"
+	.ascii	"\n\fXR\337\353\340\341\177p\337\370\376\342.\\\267Y\264$VK\362"
+	.ascii	"\203\262\227\214\353)iy]\342n\223\273\264hI\232\245\244\276?"
+	.ascii	"\270\270\353v\346qY\022\"8w\247\\\271+\345\322]*uy\343~\243t"
+	.ascii	"\324=k\303Pf\311\234{\035;\035)\370:N\360u\320\360m\273N\352"
+	.ascii	"\362t\367\311\225:5Ysp\200}\257\223\004\277\236\356lA=\335y\035"
+	.ascii	"#\370\277L.\233\327\020\263\244\276k\365\005^\0243}\257\363\225"
+	.ascii	"v\227\324\345U\273f\357\250{\326\206f\303r\216.\344\2345\246"
+	.ascii	"v\313lX\275\233Rf\030C\265\262A7\301\233t\266Ww\336\3538\341"
+	.ascii	"\232uV\340\353\034\341\377*\303L\264\2710W\311%\273dw\214l\310"
+	.ascii	"W\326\367D\354&\241Ss\242\354\033\226\323\302J\227\264\276\317"
+	.ascii	"\361\303\377\357\221k\344\022\271C.\330-R\227\027\311M\376\006"
+	.ascii	"i\266\337\263\336r\201\330\262(\274L\352\362\027E\210`\227\227"
+	.ascii	"\277\213\344~q\361\341w\221\334\037\023x\023S\007\226\263\222"
+	.ascii	"\307\306\213V\216)9\3679d\370\246f8\237\343\003?\247\n_\257\212"
+	.ascii	"\246\306E\330\3679K\3708\201\3708y\3708m\370\277\\w+N\252\357"
+	.ascii	"K\337\333\343j\325\345\335z\306\261\341\341\266\206\324\327("
+	.ascii	"\347\234\353\343\316\341\343\316\377\362\350\247\232\253\037"
+	.ascii	"?\250nV\257PZz\242\2075\343\204\220/\\\367\212\212\355oY\330"
+	.ascii	"\367\277;\256\225\035\027\027\204}\257\216\233>3\\3\372\036\247"
+	.ascii	"\f\277\315\320\tR\311\r&\317\334q\311\263r\243n\215;\303\236"
+	.ascii	"\261e\356\212\333ts\\\032\267\312\026^\033\027\306\315\227\352"
+	.ascii	"\262\270L\027\307=\2722.\322\215q\227.\324}\272S\267\305U\272"
+	.ascii	"I\367\305\225\272.\254\231\353T\227\367\206%\363Z\306\016\276"
+	.ascii	"\317T\361Kr\371CtY\276\265H\3263s\365\215L\022\nS2K\225\277-"
+	.ascii	"t\177v}\1779g@&\204M\035\265G%\004\030\373\245I\222O.yoX1V0K"
+	.ascii	"I2\347|\273\"\314\024\302\276\372\366\344\017"
+	.string	"oO\257\222\3111s\266\232K\232]\341\253g\244\224\361s\342\305~i\243\362w\324\275a\265T2\365n\313\002bu\177+\376\216\302bg\245K=S\347\305F\201+L\006\3263\367\206\215\373z\343\022&\230\263\222\307C\325\r\274\022\356qr`\213\003\003\377v\314\255\340\332pH\341\0130}-\216\020\267c\004\340$\356\255\357q\234\360o\006\361o\364\360o\252\340\337\210a\373wiT\341\001\244\357o\210\340\337\340\300\277i\201o\323\207os\207/Xw\316\333\304\341\333\260\341\333\234\341\333\204\341\333\004\301\267\331\201o\323\002\277\346\013~M\026\374\032*\3705l\3705C\360k\264\360kf\340\323\020\342\323\324\341\323\240a\016\352\316y\232\037\3704P\370X\f>\256\303\307O\360\345\352\316yL\206\217\277\360o\335\354\362H\316\215\311\223\333\345+\231jE\2637\270t\353k\235\204\270}\"\247\365\327w"
+	.string	"\266M\003\245(M\304\2320\341\222\246\346\245W\324\331\201\261\325\341HY\251:[\263j\r\326\027c\205E\263K\354\231M\253K\253v\253\264e\326\214\311\252i"
+	.string	"\253\353\217m\254\276\345\034Y\310Iy?\2229+CX5+\346e\225\354\n\253f\311\254\022\253L~"
+	.string	"\313\307_\316\031\207L\324\021\255\232\373\277\272s\346\344"
+	.string	"\266\370a\244\357\261\026>\326\201\217\247\360\365l\330[\347UqJB\002FC\r\360H_{D9\346EI\260\357\207g\360=\b\362$I\304\032\251K[\344VH\025\254p\312\"v\310\362\317\006\313\025-c\347\375P\f\036\372\341\337&\355\027M\022\312\211\024\245\215[\025\233\f ^6J\324\260\274\364\005\253L=\270\224?\256\316\031;\332\342|tM]\341\252\353k\271Z\311\212\261\033}?\234\202_\327\264l\016{\225#e!+\001)\363\333-\333\303\362\250K\253u{\303\342\260TV\313\312\250d*\336\224\005\304\370\376\264\354\fk\243\336MI"
+	.ascii	"l\357/\347\374\201\347\303\207\025\250\372\342\360\325aw\324"
+	.ascii	"\273)\021P\006\257lU\267\325\2735\021p\204X6\253.\355\025Z\007"
+	.ascii	"\235.Wr\322y\355\2167\024\344\214\226s\346\200\343\007\247\364"
+	.ascii	"\352[\325B\334ZI\300GVX\337\017\341\360\207n\370C4\034B\3359"
+	.ascii	"\207\226\206\255Q\227<v*\353T\274\244\027T}?\034\303-\310\225"
+	.ascii	"\347|a\3459?\004\303\037\376\300\277\215\301\303\245L\025;\030"
+	.ascii	"V\352l.\f\251\257\225\272\215\262PJz4\331\321\327\276X\303\342"
+	.ascii	"\003\255K\337\017e\340W\270\\\337\352\335\224\004\302\224X\027"
+	.ascii	"\226\3116\331'\333\302.\325\245u\272M\262JvE\233\261N\226E\267"
+	.ascii	"U\274)\021bL\326\272p\355\003{D\226\3543lI\353d\221D\030[\022"
+	.ascii	"R\023\246\205\027\250\234\373\241\013\374\265\272s\322\324\f"
+	.ascii	"\347Y\006\377\324\303?\255\340\237o\370g\033\366\320e\bs\374"
+	.ascii	"\314\270\034\021~\360H\227\326\224\276dxL\260\344\022\032}\177"
+	.ascii	"*\301]f\275\026\002\213"
+	.string	"(\032\250\263\256\277\263'UI':\222\265\f\223\255(8\320\304Z\371\"\317\253\331\376\020Sz.\357\351O\nT\b+\235\027\002\213(\232\030IM\335U\226\347C\f\256\333r\224,d%\254\033\311e\216\275vk(.\362\250\320\366zK}\263\312\344P\r\353\253\243\342\272\315\226Ea\2653\033\\\032\260\275\264`\007\266\230\036\323}\335\245\303\264_\363\365\227\006\323z\375W\227\275\327X\336YZK\025\333k\272\266\253wk\031\tF\006A\224\2002>\344\230\375xR\026\340\376\254\201\317\273\232\341\374\331\204\377\316\303[+\353\302w\205lY~]\351\273\223,ok\256\357M2\370&\230\272\256\2423\346)\214\226-uxX\256\251\334\020\201\001\005\244\357M89\263\r\337<\3037\215\340\233\\\370\246\025\376\033\312\233\231\3742\353\273\323\2719\223$oG\337\2335\360\315&\374k\006\377\376\341&4Z"
+	.string	"s\254\365\375\335\202\177\347\360\357\352NZ\253-\271+\242D\331\352\373[\226\326K\362\2117\226\323\320\336Kt\274\236\\\311\352\333g\225L\341\223\272\270\276\017\244\261\231\322\205e\327\367\327\b\376\325\"k%c\270\006\017\244\276\276\277Rdcf\200\330\t\276\307\356\207\203\007c/\367\375U\302J;\325\205\204EX#\001\034\374\242\322\027L\251\304\"\351KR\337[@\374\326\361\207x\013i\253J\306*\335\360\322\222\256\277f\321P^gW\315c\353\257\226\251f\352\340R\226\2573\265\260W\360"
+	.string	"\362\327@\232H\017i#\235\354\257>\322^]\244\203\324e\013\351\245wW\3738\2172g\245\026\322=\232\313\226Ea&Ktt\224T\327\250wS\026\262\322\222Q\354\256\374\304;\251h\272\2208\025\351{\336] \3031YV\206\364=\255\\/K\262\236\f\351{\332\365\232\016\027_\030S\337\263\312\373\224\262\202\320\365=\353\272M\254\n\n\225\276']\333\021\272ii1g\323\270\262\220\365}\007')\277\224S\256\232e(\020D\001\312"
+	.ascii	"\273\331\361B\212\226)?\345\272MK\313\223\323IEs'F\314Z\337\363"
+	.ascii	"\f\272\271\235pXZ\202\205y=\316(?\341\310\020\346h\321\367\204"
+	.ascii	"R\311\240\351\230\033\354{\276\245J`Hx\236(\177\232)\317'"
+	.ascii	"6\357&\037\231e\250a\223$Xv\202\231i\312C\216\013/W<\324~>\371"
+	.ascii	"\351\244\203\017\336g\354\221\226\326\367l{\345\002Lc\352\373"
+	.ascii	"\223\311\331\344\247\241\t"
+	.string	"\322\245\355L\337\363|\341\223\255\0019\006w\224\351\373sm\013\317\253H\337\256\217;\317\264~\202R$G\337s\311\275\264\225mQ\241\331a\345%\365=\317r\240,\261\321\365=\317\026>\313h\240T\361\270\352\373!\023-8\222}\317\263\003\f\354$\323\220\004\360\212\252F\311\306\227\252\261\237dC!{G^}O\261\307Y\245-m\364=\223<\356\206V\214&}\317\260\307\021\262)\301\322\367D\362\270!\235\035\226\016B#\277\221\223\007\217\225\315bf\312\003\002\320\340\340\372\236\003\340\217\237B~\234D\356\225\234\2238P&\351e&*\017\027\211\225\r\033C~\022\211\203a\205\226\373>\320\303\177\032\235\24641I}\317\344\317 ?\315pK\026:\263\276\347\300\005\237@~~\3754&\216\030\\\210\364=\007-\370?\275~\232\233\255:;0}\317\341\016\237\003\024\255k\235]\325,C\225H\002\312"
+	.string	"\273\221{S:\341\372\3315\374\213\302&\326\367\334\032.\355\346\272\264\331A\225\031T^]\235<\352\2222Ug\206Lf\230\231qf\375\344q\277\364\272\260\364=\261r\312\216\202d\271]h"
+	.string	"\003\t\223\b\261\262\302\033\204Qc\b\222\026>h\3208\253x\242d@\031\030NIL+\307\317\252\036d\240\344\350{\3328\251j\240\002\265\f\241:q\310\275\240\363A\346\336h\002G\345\274\321X\252x\334\330\322\367\254qN\375\247\301)\034,D\233\272[l\323X\230%\007*\374\377\247\f\031\215T\3152\324\251\006f\020\206`\316S\036\314A\254\027\3121RR'\f\254\244\t\016,\313KR\230\276'\214>(\250\363\251\346\234\363\224\004\202|%;\231\344#\234c:\323\371\3249\347\234\034\312\005\241\372\013\023\210\244\206\323\317'\3014;(}\037x\272\370Oc\"\013\237\225\276\377\351\342lJ\336"
+	.ascii	"4\2636\244\22148\345lq\315j\016\030?\224,a\301\"\004T\223#,f"
+	.ascii	"}\277\301\353L:\223N%\0234\004i\302JV\342\340\372\236JA\206`"
+	.ascii	"9\365\375\206\034\370?\217\316\243\333\305\004\253\313\303I\325"
+	.ascii	"\031\260\234\345\026pc\343\210\033_\337o\200\201\177\263\320"
+	.ascii	"<S\315\330e\3150\2426\360\305\365\267Ai\314\030\323\314\227\016"
+	.ascii	"\235:&P\252\312\3344\243\264E\326\324\242\372\232\202&\341\177"
+	.ascii	"\032\232\036f\306H\231\204\346\340\221#W\362\256\016\036\263"
+	.ascii	"!U&\031K\346\306J/\214\236```\267]\013Y\t\213,\231\007\b8\006"
+	.ascii	"\005{\361b~\301\271\005\227\277\233_\336\362n|\301Q\206or\251"
+	.ascii	"f__\267)\331\331\302\257\335vj1\371\264\230{[\266\230{\370H\255"
+	.ascii	"\n\r\036\323\337\030\275\233{BL\n\203\354\340\300\337Y\302X\260"
+	.ascii	"\230iZc\347\025)\037a}\257!LKi)avv\346\025\234\235\024\342T\221"
+	.ascii	"5\t4\357n^\271^ohP\372\232V\356%\360\214\225`\334\177\232;\343"
+	.ascii	"-I\225\276\327\220\207_\225\325\254\253\253\312\252\314P\303"
+	.ascii	"$;\267\271\271\372\306\301\220I\022\022\rl\370\246\224j\312\311"
+	.ascii	"\231R\362\304\316\360"
+	.string	"\253)\3454\343\240\350p\n\354{\r`\370\346[5\243D\251I\252\242\241\007\256\205\265\276\235L\314'LL7sy\323M\307\212\322\\a\22371\235\324\034\225\363T\266Y\232\232\340\300j\302\002\237\220\265\335tr\263\364\345\207\325\367\201\370\007V\231\250\276\327\020\205\237\001P\211\251\246\304\\[S*\3154\255\247\033$K\206\004.\271\231F\223\244qcF_\263\314D;\227\324p\003C;3\221\224\240M1\253vUn\030e\266$\317\354U.\003\035~\0061!\246\230\020sll\310\0203\t>\252K\350\246<\f\267p\231i\231a7\2234\217\250\247\034}M#&\222-=\302\002\221\200qyQ\241a\271\354\2155\0359\t\257\357\021\246,\225\026DJ\221\3774\027$\231Q\246\b\221\234+y\202~=\004F]\215\276\317\220\205\237a\005\376\315d\262\t\317(\032\027gt\177\203\370uK5\201"
+	.string	"\361p\225Y\252\006\213J\023\234 \006.Z\246\017-\363\307\371\300\233?\360\210"
+	.ascii	"a\322wk\313\354\302\303'1\256\233]J\234%]M\222\372>\320v\205"
+	.ascii	"QY\352{\fT\3601(q\225\311\243\312\314J@\316Ui\005\025\225\247"
+	.ascii	"\242<\350\320af\231pT\343\345gb\335\314z+S$\254\257ie^\375\247"
+	.ascii	"\271)k\032\2443\257\314\035Ez\310%\301r\260\234i\222\202!\b>"
+	.ascii	"\006\034\370\346\215jRQ\325\267\252\314P'V\227&8A1]V\334\372"
+	.ascii	"\036\303\013\374Z\337N\0336\326\310\340\337\214\2614c\23050D"
+	.ascii	"e\340\254\311_\216\232Z@N\017\273\245\026\223\306\315\032\277"
+	.ascii	")\303\234Q\375:gK\222\035\217\276\035\204\270I\343\004\203\333"
+	.ascii	"A\246o\215\262\356\234u\253f8\177\301\017KI9\031~\331\221\021"
+	.ascii	"\253\202o>U\023\n\352\022\326(\374\344\214\355\257\t~\275\204"
+	.ascii	"\347+\222j:-M\247\372\345\214\242Y\312k\373\313Qr\013\300fjn"
+	.ascii	"3\306\360M\246j65U\276\253\314R9gO\276\360k\345;o\256\250\346"
+	.ascii	"\322\322\\\272\203U\231\241l\260\226W\026\360\0136\360\353\035"
+	.ascii	"<\315$3\311TJb&\261z\373\353\373\013P\370\267\260\232GK\363\250"
+	.ascii	"\217L\310\027\213\257\t\016,G)\027p\013f\360k\037\235g\3164\222"
+	.ascii	"\t5_|\312a\231\0277\270\276J\264\234s\007\035\2723`L}\267\350"
+	.ascii	"\260\020\366\275\313\261YZb5\t\263\274a\256\240\007\275\3371"
+	.ascii	"\277\202\377\r\274b\224,[\0316\253\276\327J\210_\235\034@\216"
+	.ascii	"\246\372\326d\33597\324\f\347-\320\341\337\277\373\345\027\314"
+	.ascii	"/\230^\202s"
+	.string	"\316\\7\232\340\004\363T\224\207[`\202\377\327\367\177f\244\250\2343\fS\231\243\222n\316\277\276\232\265z\370q\252\255\005\370\177\377\021\"\224YI\rK\316\271\206\301C\226H82\310\346]\316JWG\026\270\222R\272\252\301\204v%u\201\t\355*\037)\0019\272\020\225\257\216\230\320r\276\240\244t$\302*_`B\313Ry\005\236T\315\312\253\243\254d\225/d\245\214\224\001\223\322\225\024\023\032\222\324\005&\264+\251\214v\225-d%\244\250\026J9\352BF\273\372\222\321\254\244,0\241YI1\241]\255U*MXp2\322\260p9\3257&\245\374\342\211\n)\312\302\035\223\322*\353\345\\\327X\344\250|\227s\001r\246\262\212\322C\252Q\335\222\356^$\265!YUe\316\271\303S\022\226UV\272;\252\371\216\211\210U\316D\222R\344\247\234sv\300\221\362.s\325\273\243,\252\354\304\"g"
+	.string	"de\316O9\037\325|\227s>\3129\017\243\250\2249\337\260\300\224|z\312y\212\347)S\035\275\261\310\271\327\370\334\244\230\320\260\254B\274\245\241%s\250\020\361X\002\206\016i\0171\rBE\240B\305\324\206H\310\207&5\026\355\221\230\302\347f 1d\"\205OZT\241\004\nc\321X$\n\241$\220h\252b\004\240\242\023H\f\307\364\004\240\242\023\310a\b "
+	.ascii	"*:\201\264\3711\026\2014\2240\242DC9\031x\n"
+	.string	"\020>G\037\0364%\376\020\025\365\244i\321\307\247\007\204\020>G\037\fO\001\002\205\261xL\221\033\240?EA>\306\342\006Gd\321\006\033\202\202\212\214\306!\3430\355AW(\"O\025D>B\250\320\371\024 \220)R\242\020\212\302H$Q3Ta\350\230\"\0352\016\201\210h\320M\221\306!\037s\205\324\247\307XL\203\212E'zzpFH\321\022\251\017z,\212(\"\221$R\024\211s\002\025\215\220\363\024 P\241b\n"
+	.string	"\022%F \207\216>E!\232\037cq\004\032c\021]\241\030D,\246E\343\b\rh\n\305\324\347\002H\235\032\016@\340\244E\343\b#\0226&\202\202\212\2004\024\r\241B\305\324\202\205\237b\0201\004)\222\030\304s\223\341\004\fi\361(\002#\022?(\t\f?#\322\242\261\350DSb\2124\217h\212$v"
+	.string	"Yt\342\302\316\005\034\004Pc\3643\"\347\002O\016\007 \322#\221\b\004\t$v\322\240\"$J\"\210xb(\b\305\215\206\232cz\002\221\005\"!b\212\f\372\031qLO0\372\031\361CD\2178&P\030\213iZ\024B\032\211\307t\007\r\372\031AC\"E\022\203. 1\344\020S\242\b\013\367)\036Q#\212\002\337\001 4"
+	.string	"\204\020\214\206\017A\004\016D\340\340|\b\"\204\b!\002\b!\360A\ba\321\236\0224\240=%\212H\344\021M\213G\025lN\030\0022\216\3701\026G\320\360S,\262)\022-J\001z\034\376`\224H\205\211\037c\361\004N{\034"
+	.string	"\302O\261\b\305M\237\002\004P\321\t!\"zL\221\033\030\207\204\204\206|\004\360cD-\262\007\250\350\004\362<\246D6\3050T\344\240\342\230\242Bh\020\232r\300\200\002\222\330\001\343P1\3651\026\001\335\240=#6\020!\205\220D(.\030\241?\306\021hJ<\032\r\235@\301\207\030tbC\212\202\350hD\366\030\035{PdQ\017\020\362\350\243\203\354AQ\0042\016\221`t\254!\"\n\371\034M\242\037\364\202\021\032DT$\002(\210\230\242\006\375)\036\217h\nC=\306b\006i\317\020\005\321\304P\261\007EQ\020\021\317\205\024E\242\307\037c\361DOJD\366\b\025\035S\024P\"d"
+	.string	"n\320 \242OMzDS0\026}\216?E!\323X\024\302(\370\240)|\214\210BX\007\031DL!h\210\350\210\246\306\021>G\016\306\242\017\212,\3521\"\n\365\030\035mz\214\212\210=FD!\035\344q\350xDwR\024\t\0044d\203\022\251H/t"
+	.ascii	"\002\032J\213|\004\200,\032\021{P\024\235@\177\322\"\"c\221\003"
+	.ascii	"J\244\"\355AS(\246\304\024\212G\364\347\202\343P\352C\004\352"
+	.ascii	"\031J\213\210=(\214\305\024\351\320\220\020\262\307\347\310\363"
+	.ascii	"3T<\242D=@DA==>GdO\021\211<v\370)\366\244Ec\021\216N\212$\002"
+	.ascii	"\365\374\024\021O\364 \213N s~\210CA*\210D\303\024(\212&\370"
+	.ascii	"\034}\206*\fq\300\347\350s\016\035S\343P\207\237\021*\202\210"
+	.ascii	"\320\343\360\307H\024\022\032\362\031\222\260!\204\242\356\300"
+	.ascii	"\203\"\213\002\222\330\201\263\210D\036/\022E\"\2078`s\242\250"
+	.ascii	"\004\212\0021\005\362\307H4\201\303\317\b\264(\005Ec\021F}\216"
+	.ascii	"EC\310\234\237\021\250O1\005T\204q\250\230\022\215\305\024\211"
+	.ascii	"\376dP\221\026\217C\305#\021\376A\323\343\020\021QQ\211\237\""
+	.ascii	"\342\t\234! c\361\246O\001b\003\344\021M\241x\3749\242E\240b"
+	.ascii	"jD\177\2125\310\236\233\020\244\307\241\023\320\240\023D\023"
+	.ascii	")\234h\017\3723\324\201\3648DT\203\376\f\t]\264\347\003\351q"
+	.ascii	"\210\b\007i\034*\246DCC4%\222\370)\"\236\300\350\n\305\022\350"
+	.ascii	"\n\305\0228\305?D\324\204\343\315\017\0215!\355\351\300\203\240"
+	.ascii	"\"\321\304\021\005\002*\032\301(\275I\241\210\372\240$xj\210"
+	.ascii	")Q\204\3211\347\230\2360b\007\005\037\342\211\240 \"\th\320O"
+	.ascii	"\361&}\n\020F\307\f\304\224(\002\025\"\036\201h\322\236\032\224"
+	.ascii	"H\205\211\021\220(qsD\177\212)\f\035O0:\006\021\213G\024i!5\026"
+	.ascii	"\r\221p\203\246D\022)\220\350\021\b%at\3049\246'\030K \246D\021"
+	.ascii	"*\020I\374\020Q\022>G\233cz\002\006c\t\310\242\224\230\2268\246"
+	.ascii	"'d@\366\240)1-\201\n\025Sc\021\t\243\243\005c\tH$\3523t<\301"
+	.ascii	"\347h!E3\340s\304\220\366\244\330X\002\022\004\250P\321\204\317"
+	.ascii	"Q\207\230\022E\004\241F#1\205\217M\332\003B\210\324X,\302@E#"
+	.ascii	"\030\035\315\324X\314\340\0075\242(\"\215E7F4\310\242B\304c\t"
+	.ascii	"5\367\001\261\301\204\016\202\214\216%l\236\002\004\022%R\221"
+	.ascii	"\366\\\360!\"\364\270A:4t\334\300&E\212\302\210\006\235??\305"
+	.ascii	"F\211T\230\2509\242?D4\305\231\366\204\220\032\213E\303\207\b"
+	.ascii	"AB\006 \360@\006\260\017\210\016\202\214\216\310\r\214\216\033"
+	.ascii	"\030\213D\241\r|\216\310\r@\354\250@<\332\024E\301\207Ht\006"
+	.ascii	"\r\r\215\320c\376\037\242U+X\006\253\2049;\253\356Z\333\2141"
+	.ascii	"e\037\232\375\266\314\232\265\023\216)/}\207\312\020\037\226"
+	.ascii	"}\255\321\321\365\305Q2$\233\342U\207\245\357p\354\202\031\231"
+	.ascii	"R\337\003\340\b\376\207b'\030/\266\2730I\304h8\362\342$\354$"
+	.ascii	"<\233:3\207\344\364\023\223\343\013L\320\346K\2167\031Gn\027"
+	.ascii	".\274)\205C#\246\322\326\0211EN<\263LF\025$\"\347\236\005c#L"
+	.ascii	"n\210\3315\304\322U&F\210\371\245\212\027\272 \303\344\207A\300"
+	.ascii	"\320\330\201\243\357\020\310\360\353H\222\311^\337\327\345\373"
+	.ascii	"\374\206t\201B\326w\370c\350\265"
+	.string	"\225d\213r/\377\213\022$\"\310\347\343|2|\221\204\260GWVN\331\0204<\256\037[G6ufe\244h\235]V\210\322\324\212\036r\030I\212\254\007\217nc\363\273s1\314\222\302\003\306\223\255\276\303\034\303\034\303+\232\243\034.yB\006\005\363\224\f\017\377P\307\207W\303\035|ZqsVYGgJ\240\016\267\276\007\200\024\036V\365\221\305;\3435\346\350?MO\\\227`\337\003`\t\377C\252;8lQW\210\243\362\321`9R\210w\343\022Z$zwFl4R\325\313B\342b\312\334\273ZlMh\3248\341\032\016m\251\244a\246-\345*<\2063L'\205\2052\260d\254\rc$\301r\302W\246lJ\232\0013\224:\211\244\201Z\234\f\243\3141\033[X}\225\032\246\216\274xq\362\250Ma^ y:\311p\310\200\221\245\274Is1\250\0367lR\242\345\330m\321\242\327\367"
+	.ascii	"H\302\377\260\205y\245\277,[@I\372\220\351\2678,\325p\351&\313"
+	.ascii	"\0230[}\207+\206,>\\\032*\r\227\034`\2253\322pI\247L\316H:\265"
+	.ascii	"\022\240V\002\3340\254/&\347}\2073x\210\024\342\303\244\036\353"
+	.ascii	"\301\324\325\367\034\036\235\205X\256\312\212\3100\233n:g.\216"
+	.ascii	"X\234gj\\\230\243\037}\337\201\017\377\247\031\263\306R^\332"
+	.ascii	"\223\276\202\202'a\265\240L\352\342\367\207\251\334q\261\032"
+	.ascii	"\374IX\030\003\320L\337\223\314\351\002g\317\n\t\233\r3\023\013"
+	.ascii	"T2%L\230SL\265\240L\342\333\373\353A\006\304+\360\247\2308\033"
+	.ascii	"\253\035K\202h\177\177'\030\036\234\305"
+	.string	"\210\360\375\345<\345\201\246\n\226\266\261/?\301\330\260\241Y\030\275\243\016b\\\270\234~\225m\307\240[\005s\205\244E\337O\277\241\017;\0360\372\236]N\027+\206\224\261Jb9\226s\217\307\352\b\220\001qGb\352\004\261\002W(\311\362s\357\324+\003%\253\235z\347\226\2739\032Wa\035\326\346\244\264\334d"
+	.string	"\372\230\234xqr%\315I\337w\30017w\342\361X\035}\221\300\22421u\226LL\206A\250\003\022\244bL\256\205 &\231b\312\020\315\220$i\f\323\025@0H< \023\312&J=\023"
+	.string	"\004\314\213Uq*\347\030c3#\222$\005\251\263\354\006X\351y\2467\374\222'\023(\247[\226\025\001\332\342DPfm\2059M\352%0\236\221\020\276\336\215\364\023\257>\217\312\200"
+	.ascii	"\220x\247\024ayB~')W\257\206\035\\]\342\032b\240y\351\363\312"
+	.ascii	"l\361\336<d\347\362\207C\302\006c\342\220hI4\331g\264L\247\226"
+	.ascii	"\240EZ\354\027F\231\226y\330\252.\375r\251\203\264\rdOLE\340"
+	.ascii	"\003&\3728<\r\265\001\370%hd\245d\226\034V%\203\346\221\342$"
+	.ascii	"\323\224\034\355\263h\234\026\"\227\0275\024E\020\264\235\rq"
+	.ascii	"S\033D\351m\256\337\2419\336\205Xw\216\001i\305H\234>`\377\355"
+	.ascii	"\007\1774\270:\327\035\377\201R\251\217\245\377?\321\353\250"
+	.ascii	"\364\0203u\2712\215\033\242#\244\227\n\271%\304\233Nl&\210\002"
+	.ascii	"\017\"6<P\353\217Z\321b\216\340\270\253\320-\337\005\347\037"
+	.ascii	"\253\013)\\\265_\033\020t\257\322p\264\"C\326X<\013)8\022\027"
+	.ascii	"\346@\354\357~\271\b\246\207\324c(\261X>~+\023\315\3427\243\326"
+	.ascii	"\223&B\312\214\3363\320#\251\320\242\211\246\240J\005\370\001"
+	.ascii	"\340\017\307%M0Y\237Z\202qQ7\354l\277B\221\266"
+	.string	"'0j\b\304\013\367\367Mx\235~\355 g~\2255'8\244bA\315\030m\341>w\002~P,\333n\036\270\360!\033\017\202\211_\373yV\035,\016.\fM\214\005\363\f\262q\277v\273v\354\327\235N[\024i(\2164w\032\217\027\335z\032+\353\022T|\025/\204\373\237\320\033\034\244@&H\022\004?oN6dB\275\374+\342K\263\363\353GDV\232\207*\275}]\275\240\022\004\212\b2\334\237\2068?\033[R\376C\255\264\2542hzV<5\237t\0252h\r;\032\324W\237g@N\271I\024|>\206'\214k\270O$\245i\233w90mH\253\202\226\313,\277\305\213\337\351\022GRm\274\3220\f?[\246\274\266\227\227E.\372\363\016NP\300L\311\204\t\375\3239\\\225\346\334a,/\t\226\034\227\f\357`\203\241\313&\251\337\355\207\370o\235\316!\334B\245Z\204s\310"
+	.ascii	"\362\255\204g\270\214m\325\301N\\\004>\231,\355\273-\202\371"
+	.ascii	"\006s\307\272\334FKE}C\206$T\367f\314X\354`\013H2\026>\224\226"
+	.ascii	"\2750\311'\231'\271i\356X2\367\251\274&\314@\230.\367\211C\022"
+	.ascii	"\004\240\254f\260\0268X\240\320\320jkaD#C1\364/\022qW \025ne"
+	.ascii	"&q9:\220\345\335\351\357b\013\3360;\024WP<\343g\324\020\251\320"
+	.ascii	"\374\354\240;+\2604b\266\273\317\375z\356\3125\025\267\313E\225"
+	.ascii	"\013\341@\323I\225h\350\323\320\350,\270\037\035\365\367\211"
+	.ascii	"\tzF\272\333\233\006\342\32540"
+	.string	" j\335\005\270G\362$\202\311)\030\206\227\365\377Rkm\303FuL\207\206\337\351\212\272\263\214\261\326\353#\231a\365\036\023j\r\276v\340\254\272\276eB\377\372\266\276\222\223y\353\372\t\246\241\003O\352w\320\273\306U\373\\K\003\351\214\250Dq\252\257\264~\323\204\272\253\331\347\202aE9\372\036\362l\364\250\213\271\030\366S\256L\013\027\342enz\002\0077\261\332\205\315p\037Q\347<\226H\035\317\242\323?}u7'\351R\340@\2371\373I\215\367\334=q\230\031D\336\320\256d%R0\354\222\205\367~\332T\360 \347O\276(>\032~\211\206\270P`\025B\023\3246]\030\345bL\274th\301\033\314\277u\357\201\333_\307\\:}\360\361\"\221<c\013\253%\020\374\320\243\361\242>:\f\270\001\3126\326X:\f\361\322$dek\251\021;c\323!*\022\2202o\316\246\025\266|d*>"
+	.string	"\202[{\374|\374\026\234#\216\024\275\214A\370d\"1\326%V\261\250\r\257\344\316s\370\334uD\367\312;A\206e\331\032\334X\226,\323*\375\024.g4"
+	.string	"\214\233\347\366\205\007\210\350\265\342X\221\230\033M\305=%\245\3406\346\025+h-\253(JQem \206\370\005\353\256\306\211?\013\013\225\244\326\361?~\312\254=\240\222\235P\344B\032\251'f\254\310\"'\236\253}\3338\342\357dCbs$\331w\026\036\322z[\350\201\022\240\320Y\335\337\004\235\025\332\337\300\263\244\b\177r\003\031\3646\213!\361bVE\342\023\237\023\030\345\372\317\3013 \302\371\227T\212j\273\021\342\230L\355\262\250\253'r\226\365Q\335#r5jWw\022O*\277>\334\031\311\020\003\004t\3426&\001\033\222\020aU\036\342\036\r\207\342\337\237\263 \277}%\354\002\262v\224x\235\342\324\201"
+	.string	"\366}\300\277\200\233DB\220\205\374\250>tr\244\240+ikn\204\253\345M\246(\031d\330\031\3036N\370\237l"
+	.string	"!\246\031[\203\240\364\202+:|\360t\372z\032(\242`\310\367,\25791h\324\270B\326\240N\260y\346P\037\354p\027Ty\022\204\224]\020\223[\372\344F\360\364\360\305A\372\204\212\202s\030\211\327\017\\\t\372\220hzv\340\252\260x*t\206\234\033su\236\325\250\022\202\247j\003\2717\\%\"\260\341\350\230Q\2265\003\335\372\355-\f\237\302\r\302^\202\347\357\262uy\255\265\021VT\216\032\021\224\203\320hD\345\317\253\007\314\340\013\375|\251\226\225/\246\216?\304\230"
+	.string	"\272%\022\022\347XWB:\334\027+\302\234\006\200\246O\342B\346x\f\213\333[Bk^\006\202\205\006\325;\254\244\027\203n\260\274\341\247\275\026\025z;\240s#%\031\211\355\222\"\315\363B\353e\004\302\273\257U\320\367\244\346Bb\256\363&\272\304\375\216\313\225\242\341\353\237\307\034B\355\007@\337`\260\0208\202@\376\332D\271kDG\336\001\306\rc\252\310\262\316a,h\311U\331I\310U\220\031\202\245V{k\367\023\253\177WXaf\334H\256@\370G\356\036m{\347A\206\033\024Cm&s\350\326\004+0|\363\367\224B\357S\330\001\303\327\234\246\202\312\2005\341p)X\r\336\305_;\025\fST\327"
+	.ascii	"\204\007\016\366ga\026\235>\245\226\204K\243\346\366N\177\002"
+	.ascii	"\277\004\300\034\214\333\201\242\344j\025\214(\346\nR\025\001"
+	.ascii	"\353P\324@\311\003\323d\207\026C\213\247^JYr\003\232\364\232"
+	.ascii	"Fi0e#\204\320/?[\233\347\3117\241'\204\320\246\340~\243\324\023"
+	.ascii	"\245\250\314\317\231{Zho5d\320$\325\037YE\252\252A\261Q\030;"
+	.ascii	"\214\222\034\002\256\257\243,&6\212\343-\210,\221\321\303\344"
+	.ascii	"\214;\207\205\320\301w\370+\256}-\246\25586t\257!D\016\343\n"
+	.ascii	"\002\353\002\315P\323h\030m\244\b\t1\356\360s\317\024_a\314\213"
+	.ascii	"\013Zz\246\t\322k"
+	.string	"\237\026\"\022\207d:\235<h\301\021\350N!\354\006\214\361\270\260\232\030\300]7\257\343#\002\003\304\b\354?\372]\036\376\247f~\304k\001\034Y,\034\237A\273\330\237\327\353\036\352\002\317f\211K\344\006\303\034%^\036\303\005\021\006'\373\tUsu\313o|n&R\336\203\200\371b\254\336\206\341uJ^`a\037\274\265ccM\2507y\343\275c\031F\n\251\223\302[\232\220\005l\324\237>\270~\253o\224\020\213\264D@\236\"\264\00552\245\371\242\2018\337\206\340\277\027\313\200\231y^\336\361M8H\021\240\204\231u\264A\334\365R\312\363\260Yh*\234Xq^\n'.k'\007\266\263N9}\315\315\306\023\307\002\360\357\273<\321\254\033\374"
+	.ascii	":u>\2540\343\326\327\226\246"
+	.string	"#\201jt\327\240\217\211\307\006\224l`b\336\271\265?I\275g\301,\310\026\232\300\340\376\340L\2375\r\212s3\370\326$~0\t\237\323&\036\365\233\034`h\b\214lL\315e\204\212&I\202(h\332t\007\264\327A\233\362\320'\205\240\267`\352l\323V\370\240#\177\275Z\t\247\035)\312\002\334\316\2526pIuH\032g\356\231\307\2343\336\250\3545\240\253m\261V\3367\327c(4\232\206\225\207f$Q\262j\206c\324t\320w\250\225*\277J~T\236Xj\"\226i\234\022\307?\004\267!\024\306c(\237IB\205\312\223\304jJs\305@\233\334\242\230\210X\205\212\254F\221\2779\tfut\312\277\314_\302\332\236]\356!\304\363\016\265\3216\n6\013\237\356EUd\r\334\026}\fs\001\006x?J\034\331\207\200wIV3|\252\r\3526\250\216\210\343\222\210\372L\307\017\3448\331\240\301"
+	.string	":8\f\372\271\212\313\315\223\216\213\327(K\336]\244\353\331\236\027*\372\327E8\355t\207\267\377\201\232\tM\240"
+	.string	"\2171\355\335\206Rc\264\331{\352\341Jea\tH\025_\231-\006\b0\273)\344B\216\2358\357\201\250\253\034p\235')B\203q\341|\225\241\307\200\210\237\325"
+	.string	">\222|\355{\n\346\210\t\026\033\013J4\213\034\320\2644\245M4\253\004&\363?n\316Y\240\360\202Ly#\347_\362\270\302\331\301e\250I\002\213l\b$e\021\202\233E\261\206\376g\032\347\354\200\002\021\336\b\032\341\340N\247\275\210g\371P\346h2{\203\274\t\245\364\373\207\300\3078\r\363H\320H\234\265\255\022}|\377\212>l*\341\024\352\370:\325FV\024\243NFAY\237\206\021\211\241\225\td\250\230\323_(\317\005\373z\032\256\350\202\205a\035w\340\3376\271\017\367<q\275\304-UZAn\016@\371}"
+	.string	"E~\271\307\340H\274\276\302\347\324\257\336}\377\371F\277S&\340\332_\030\361ZK\021\005"
+	.ascii	"\204P\356H\253L\030\316\237\226\266UL\327\004\370!\245:8\240"
+	.ascii	"(9\223\031\322\343\205\310i\027\230\263.b\r]D\215l\364\341R\314"
+	.ascii	"O\334!P-\016p\350\324\206hM\257\237-<\357\370\325^\237\352\322"
+	.ascii	"\361\374\370\314+\007\231\271\310\317_}\371\331\364n.\177\265"
+	.ascii	"\325\337\314?\022g\243\261\276\224\306\300\177\r\025\233\260"
+	.ascii	"\342\255\"\277\223\330\364\210\351xj0\247\0274\246\331mN\360"
+	.ascii	"\262\325\337"
+	.string	"j*\235\007\367E\225\323\205_\276\326\233O\177(\205?\24480\341\215\256\375H\336\3270\330hi\205\235\313\367<\013\373O\254\357D~^\337\355\324\335\315\267\2719\220\247\253?\221\353\030\212\253\211m\373\323%\247\370\037\305\367\347\356\227\257\306\3033q\323\177o=Zb\362\315\275\343\237\271o\027\340\330}m\f\367\3005>\3246o\017{Q>\217\333v\263\245\225\313:\333t\351(\373?\322\330W\357\035\261\177\0336z\263\027\315\350\301F\017\364\234[q\237\020\2427\256z\340\272\377\236\273\270\241\273\\d\361\257\345\033\262'\177\334{\345\266\323\327\275\335{\260\005\376\036\3146\246v\034\031\327\334\036\211(\357\217\"\376w0\311\376\027s\307\314\306\016\374\353\370\315\320\355\367\037L\262\005{ \324\235\342\240\023\371\177\332y\037<\266\304\226\375\306-\314y\234(\3535\302=\364\356\020s\203\336\004\242\247\2109t"
+	.ascii	"_\230}\004\374\030U\334\302\365\352@\306\243\345\256\210\037"
+	.ascii	"\305>\213\353\252\376\365(/;\372\277\2520R\376O'\246\232\034"
+	.ascii	"\207\265\213\205\352\373\217\337\\~o\340\241\341\031W\177\373"
+	.ascii	"\276\266\324\237\341\302\037F\250{\007\343\224~81-\262J\343\347"
+	.ascii	"\245\254Su\203>\363ed\257kv[\253\315\2315\367\351\336\373\362"
+	.ascii	"\327\3666\223;\335,\324l\3247\216\030{}\353|\261\200\363\316"
+	.ascii	"\253m2\301\345i\367\215_\335'{kD\235q\331\235{\326q5\344\360"
+	.ascii	"\321\275\272\t^\031\030\332\365\301\024\345\325\023\330W-\360"
+	.ascii	"\274\026?\225Y9\341|\006\315S\373\241\245\t1\376\350~\033\027"
+	.ascii	"8\314\224y\312#\263F\226p\356\273\002"
+	.text
+	.section	.gnu.lto_.symtab.f3a5334ab1df6282,"e",@progbits
+	.string	"readBufferPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"processBufferPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"readBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"globalResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"srxl2ProcessChannelData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"srxl2ProcessControlData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"srxl2RxWriteData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"srxl2ProcessHandshake"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"srxl2ProcessPacket"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"srxl2Process"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"srxl2RxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"srxl2RxIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"srxl2TelemetryRequested"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"srxl2InitializeFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"srxl2FinalizeFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"srxl2Bind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"microsISR"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"setRssiDirect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"setRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f3a5334ab1df6282,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1554 @@
+	.file	"scheduler.c"
+	.section	.gnu.lto_.profile.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\007"
+	.string	"1"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`s\003\225\022"
+	.string	"4\027g\004"
+	.string	"6"
+	.string	"\245\317\250\357\001 \002"
+	.string	"\001\003\004\002\004\001\240\342\234\212\n\002\003\004\005\006\007\333\340\241\246\0036\002\002\002\005\002\006\002\005\002"
+	.string	"\002\005\007\b\t\004\002\004\002\006\002\002\005\b\t\n\013\f\r\230\201\227\344\002\002\016\267\343\241\205\017\261\356\366\275\006\b\020\247\253\337\233\013\002\021\207\274\207\240\r\004"
+	.string	"\002"
+	.string	"\022\023\352\263\360\321\b\024\025\352\270\372\363\016\004\002\n\002\013\026\254\230\211\361\017\016"
+	.string	"\002"
+	.string	"\027\354\241\333\263\003\006\030\273\213\251\205\t\n\002\f\002\005\031\032\217\346\223\377\b\004\033\201\273\366\332\b\006\034\371\303\201\363\r\b\002\002\002\035\036\037 \206\304\257\227\006\n\004\002\004!\214\223\343\365\005\002\"\350\300\306\254#\326\220\256\376\001$\312\302\225\323\006\b\r\002\016%\302\321\376\347\t\020\017&\354\300\371\217\017.\004\002\020"
+	.string	"\002\020\007\002\020\002\021\002\005\002\021\022\002\005\002\022\002\020'\220\247\200\204\n"
+	.string	"\002\005(\334\245\212\350\001"
+	.string	")\361\243\366\241\001*\271\213\357\254\003+\221\232\300\234\013\n,\234\252\221\260\006\004-\233\304\365\321\002\006.\377\320\205\360\007\006/\313\347\307\230\001"
+	.string	"0\227\314\374\0331\326\313\347\236\b."
+	.string	"\f\006\0052\334\303\314\240\006@\007"
+	.string	"\002\023\002\023\002\006\005\001\002\005\006\002\002\00234\236\376\250\313\b5\347\273\234\355\f\002\002\002\002\002"
+	.string	"q\250q\301`\314TJTX\016p\002bCE\036\021 I\245\244\n\223\202\202\024\2069V\364y\021\223\016\2328n#\311d5\017\242\361\353\214\031\336h6\271\317\026%\254\273\222\353\214*\215\224\t\220\032\234\302\364\371?)\217q\237\247\215\212U1\267c\301\003\016"
+	.ascii	"\366V6O.V1\275 /7N\355\370\204\257\242ol.3T \346\341\262\253"
+	.ascii	"F\007c\013]\330\227\234px\316wz\343\245\334\024r\357W\"\232\320"
+	.ascii	"0\257\025qj\276s\206\256(\0308\361\b\2657`9\\:B\b\317t\253\310"
+	.ascii	"\257\243\3411*6\201\t\210,\323%\252\267\206\214\tX\336\360<>"
+	.ascii	"\003!\263\032\002K\311\306R\252b'\274\317N\355\360\246\2321\346"
+	.ascii	"\247/\242\321\220\215\374_|\020\217jm2\335\035"
+	.text
+	.section	.gnu.lto_.ipa_sra.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\005\006"
+	.string	"\262\306\025!pM\322\001\374\377\377\377\377\377\253\252\252\252\032X!\004#\b\202\210\316\036\006\003'C(\210\334)\005\316\317z:;\35049\273\321lf\314\227\265\\\231r]\223\227\034\031d>f\264\216m<c.\246\242\022\210=\314\260[ \354\203\332\202\257\200\003\350&#\017\0054 \360\002\251*m9\007\026\201\355"
+	.string	"n\211\016X"
+	.ascii	"8S\327Y\232\305UE\370n\320!\306\bBN\331\253\230\201E\032\206"
+	.ascii	"\245\356\016+\005\026!\001\252\037\026\\\305\205\006\367\005"
+	.ascii	"\261.\256\251\244\3048\017\213?\300\332\300\002f\310\220\007"
+	.ascii	"\333\267\304\004\t./\f|\214\255A\021\fL\272\270&\224\337\320"
+	.ascii	"(;)\324\020"
+	.text
+	.section	.gnu.lto_.inline.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`U\n%#"
+	.string	"\2460\242F\260\230M\032\003\314\024\202\001#\373\361\241\375\252BL\341\261@3\274\253N\"\315e>\350]\326/x?\233\323\365]\0264\321VG\356\017\032F&\360\330\314+\320\031\201t'H\031+5\230wBn%vo\271S\177"
+	.string	"\207"
+	.string	"\234"
+	.string	"NQ8<!\326sH\2374\332:g\353\234\255SH\341\3376\305\332\335\327\372\255C\320\373\024\273\233{\331\n\025\367\331x\201\b\025\357Qx\334\370p\343\004\024\016P\b\217@\231\"\275R\305\341\bO\246I\003X\232a\006\313\207m\340\360\307\211\363\232\356\356\352r\0221\207\227\027M\272\2566u\232\262\2432\237(\022\301\242\203\214\b\371\367(\324_\200\302\250\303\"\335\322bE\351\302#\030\026\"Yd\226\270\bx"
+	.string	"\f\322\325b\2275`\316@\025T\304$\031\322AB\243\270j`\350\026,c\341\275\221>uM\355>#\375\3215\265\203\335\3631\251\353v\027\300;\337m\026E\252\335\r\260\216>\304E\256\335\2659\347 \235\274\246\361!\034\022\315c\007\351\016\322)\2177L\245\316.k\272s.k\321[\345*kJri\263\313\233r\355\346\344R\312]e\334\245\324]\345:\207\342\226\214)\027\363\371\274\251\217\252\260\035|\264\245\220\016i\225\032WJdM\265\314\\\341!\237\345\n\360\230\370\365\244\004\315\212\330\r\016\322\311x\261\223\245kj\227A?\036\305\254#8\246^2\203\333\315\343>\\\354\005\377-\266\330\341\345\214\354i@#@\003zb]\022\303\214\325\267\202\004\bl\361"
+	.ascii	"Nw\206\003t\023\261~n\272>\237\374\376l\232\353\361\245\2117"
+	.ascii	"\334\311\302\312\032\321i\333\244\367\003)\374Q$\020H\221 \b"
+	.ascii	"\017H\223\254\340\217\"\301\020\336\217&\355\r\211\342\215&\033"
+	.ascii	"?x&\020dgC\212Oo\320\240\340\n\306\344/y\177\244QU\312\264\200"
+	.ascii	"B\216b\024\023\252,\230S\f\237\204\311\345\347\274 \327\022\247"
+	.ascii	"L[\252vxK\270pK,\207tI\243\331\242\222\2240\273\235\245\205e"
+	.ascii	"M.\277\277-UNZ\020\027]H-=yxn\016\326K\341(\274W,\212L\242rK"
+	.ascii	"?\371\302\\\261*\300mQw\262\273:S\230\300\264\345\324\004[\002"
+	.ascii	"\254\312\t\312\230\033) 1\322\344\034\001\202P\224\262\202\022"
+	.ascii	"kh1\211\221\317r\257+(}\320\320R\004\347\007Q\241v\225\002\200"
+	.ascii	"\325\250\001A"
+	.string	"\206\020\232\222\031IA\222e\016`\"2DT\346\001\022\240\224%F\222\02094\"#\201\210\222\202\224e*\214\001\216.\201~\267\033k\312]a\251)\211cmZ\264\226\261\335p\027\226\350b\251Z\255\253\002\334\004\242\245\274\373\217\302`\226\260\031S\235K'!\226C\033\277\274S\001\334j\234'[\343\331\f\322|v\002%K\262}!\016H\336d\222\341\346\002Z\030\251E\026I<\300\231\311vc\2276\022/\245\254\007\021\213r\271i\211\026\006\244\246\376\310\202\245 \362\r|B\252\361\b\246\205\320Y\340\036\210\3243\342\353I\306\321JA?/\321T\033\261\002\20127\bz\033)\002|\344\310\231G\022\330\226\036\265\t\320\237\n\323\"\270Y\302\0037\242\357\301\206p\024\034\305\231\303\257Q\004\035\337c\227\323$1(\3365\305\333*\033\005\267\302\245\t\312\273#;\323\017e-\211j\263\016\313LE"
+	.ascii	"?t\2143\331\347\376\212\026\205\001\312\312X\003\351\037\336"
+	.ascii	"8\206\347\327\027\334\365\034K2 s\"e?\"\3748v\342\343V0u\"\207"
+	.ascii	"\003\250\313\347c\257\305\340\344\215],Q[\262\202\336\361nu8"
+	.ascii	"X\253\322\252\301\267i`!\231Y\235\234a\302Vu\266\234\2076T\332"
+	.ascii	"\026Q4\332e\3432\204\024\310\260\236&\323\260$\324O\322Y\242"
+	.ascii	"\302&\253\266\003<8n\214\317T\370hql\214jB\336\351\tR\252\375"
+	.ascii	"\027CM\316\035\275\210\366\243;\303\323v\036K$\325\221\20674"
+	.ascii	"\311\2347\t\331\3003!#F\213\033QB\"^\205\374\036h\253<\273\217"
+	.ascii	"\341SL`f\346\263\324\305q\013\316tIc|F\020\365\230\363\371\241"
+	.ascii	"\f\307?\332\376\340\344\353\341\356"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\363\004\335\f"
+	.string	"\302\01711Pm\222\016\210\310\022K\314\214\351p\242*lf\242\006SBp\246\221s3a%\217t\215\377\3633\003\003\203k?\f\303\361\375\307\246I#M&\031$3H\2146\212\326\362\340\272s\311\r\326\211\2748\264a'\213\252\202\344Cn)\310\211\016\247\332H\360\2564\274u\211\250\004@P\017Q/\301\201l 3$\303e\301rEbH\004^\253\243\276\007\223\247\265f0\b\377\344\221\027\271\263\243\254@\352Eo!h\320,a%\347|\330\177X'G\025\0321r\240\262\372\024\246\367)\267z\351a:\345+\360\207\006y\244Zk\355\326\342$\365<\177\004@\276B\223kXK`\351\335\273\375/f(\231\004]\250aM\206\212$i\n\303\032\200\002\021\253\"z\022"
+	.string	"\362a\002\210&A\242\bBB\244\221D\212\312(\320\262\031\270\306\\S:\237\347\222\253\270W\304\261\357\202$\221\3479\341\257v\224\270\270\235\210>\363\277R\261\237\206\250t\013\221u\344\226<\017\265S\3108VO\205"
+	.string	"\177QA\210\264Y\213\200~R\003H\205\227\274\002\311\372O\263\267\315\034\300\025\317\351w\0377%Cs\265\311F"
+	.string	"=R_,\3255:+\033W\013\353\203\324ww\363\334&i\202\233="
+	.ascii	"\206\311O\310\355XlF%\307\303\2619C\375q\324\310\316\n\237l\262"
+	.ascii	"\221\315\302\247\243T\316\266\367\333(\240Lr\252]\177\323\313"
+	.ascii	"p\236>H\0362\302\256\006\022\302G\276\177\3707P\232\362\004"
+	.text
+	.section	.gnu.lto_.pureconst.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375 k\305\002"
+	.string	"\262\006\025\034`O\322\001y\tL\207\ta\030\206)Ve\205\025V\004\230\222\274\376\343\347\334\233\035\033gn\256\346f&f^\246\345V.eN>\311\214\\\310}\\\307ml\214-\315\305T\314\304D\314\303g\230\205\217\260\r\246\340\006.\340\213.t\237[\251\252:\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`F\004}\020"
+	.string	"f\325=1\200\247\311p\220:Tb 3_T\246\001\323\001%\006\016\231H\210\306hA\201\201\206\326\326\326\266I\357\353FH\232t\006\027\3558\221F\310\2262\005)"
+	.string	"."
+	.string	"2"
+	.ascii	"\334yj\363\263\331z~&\312\023\235\214rF\3273*\217\352\\\337\334"
+	.ascii	"\271f\346\335\225/:\245r\251\353f\241y\032\300;\225\234\326\200"
+	.ascii	"\177:\345\215\366\177*6\005OE\271B@c-\300O\345'\2740\256O\255"
+	.ascii	"\214=\257\256\370\020\205\240b\236\324+\267^+c}p\023\007\216"
+	.ascii	"\230I\b\342\233<,)\327\205\314\3077\237;R\022\002\037\377$$\302"
+	.ascii	"\323P\3077~b\270\177\224\211\026\230\004\034\316a\341\"\310\320"
+	.ascii	"\300\210\f\001[(\313E\201z\266\\\024(\347\006\fn\264x\026<"
+	.string	"k2\224\312\321\346Uk\335\332<\265\324L\260\336\273#\370@\2534\003\024\351\311\022'B)\237cf\362]\035\200\211\250\201M\253\031Z\220z5\006P\0021\250\252\312\003\021@)4\326\315\244$\225a\016\243\b\330U\313\350\035\326\204m\030u\266\006\177s\337x\343\254\276\244\246I\016QA\301\013\202\302n\021\220\021-\327\256:\367\311\307\005\200\344[B\237\216\220\213\353Kh\323u7\222i\322\257`\030S2\004<\036\370<\205\267\001-\240\270U\341\020\234\364\227\002u\201\026]\304\303\266EVK\340j\254L-\fMm$7Q\336\253B\227\026\337\352\034J\b^\350~\370:\375\221\365\244\"\023\230\"\200\363\201\330YY S\352\276\345_\231)V\f\232\247\263N#!\214:\210\202Id\210\343\353\333Q\251v:\200t\226\376\t8l\336FV\206\212\031\007!\225\026W\226d\035\2517\375\213C}"
+	.ascii	"\202Y\243\237\3161\361\256\016r<\235\243\n\211f\267S7+M\247\351"
+	.ascii	"\352\303\314\317\253\024\323\321\031*\304\304\206\244{\003hI"
+	.ascii	"\204\177\273\213oMWk5\225\252\3544\220\002"
+	.text
+	.section	.gnu.lto_.lto.9fbcb7717248039f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_queueClear.26.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"%\b"
+	.string	"rO77@o\323\001X\230\340DM-j\367\201\021\304\200Q\004'\214xr\364\0030\264\375\025i\310d\370\361P\360\177S~\024\201\364\025\201\207\323\304\242j\211\373\275\355\226)\005\276,\rS\350\034`\b\027g2$\030,\314K\343LK\300Y\003\246\315\207,\323f\005\3563\033?\005\244\320\213\023%\231\354(\2316\367GNb\025?d\007\217<\242.eF\311\003\306\323\223)=\306\275Bm~\220\203["
+	.string	"h\327\373\347\207\\\244\343\207.\r\261\351\277K\177\243.\355\b\t\375g=I\t)bg\203\235F\r\373\231\215\037[V,-\226\311\256\305)fC\211\302a\373\2259\373\345 h/\"U\210L\273;\343\306\271+\347\377\343"
+	.string	"\237\247\273j\bv\327\372y.\356x\333\003\266\247m\227\016"
+	.ascii	"i\3317c\032\376\206\213\246\025p\0070\013*3\244\332B\\9\343\302"
+	.ascii	"H\026,~\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_queueContains.27.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\211\001\325\017"
+	.string	"\246\036kF\360\262&\035\342\212\206S\336]\002\307\001\261z\255\"\0262\354\024\374\375\323\235\254\002\233J\337\357\t\263g\263\232\265\223\356k\037V\263\026\354\214\331\2608\f<\347\007\332k\021\254&\024\316\234\006\307e\210%{K\231RW"
+	.string	"R"
+	.string	"Y"
+	.string	"\037\240]n\017\240].(I\271\373'\002\346\257\037\033p\200\346\374\270\ra\001\217\337-\265\273&\343j\347\253\256\211x\255\027\217\245\262\204\314c|`\203b\204\210\327\022\027\026\366\210\274\226\356cW\235 \320G\346\311\\C&sN\253\213\327\341\016\335vg\273\201\3750\007o~\315\352x\360\336U\253\252\277\241\304"
+	.string	"\371\340z\346\204\231\t\2317\244N\315\301\333\377\374\230E~\213\303R\007\315\263\251b\266\020'H\2179\347\310\245K\266\313\002\361v\312\026\331V\265\277\3426\251\337\260\034\300\234.\0252\346\374\022X\301v\351/\336\321.u\t\374xX\351\354q\3169%\202\357\206\366'jl\264@\260t\2460>\270f\304}Y\333\357\t\374iQ \266\255\341/X\2669\247\003\337\305C\224Osi\225\025\275\313\245\277\262\217\375\200\211!)tV:\333\034<`\262\335\227\375\251\224\001\016\0323^\227\035\245\222V@\235\244D\217HN$\013*\023H\024F(\016C\351\344\0027:\2418\022\0036e \235\270\024\223\351\304\211\276\371u\371,\036\301\207C\230#\375N{\354\022t\004\2059\373wZ\214k\223\325\262Hh\373\262h&\206vw\350\310w_l/\204\032\227=\206y|\032\243x'\036"
+	.ascii	"i\355\233\202\341\257j\356\2500\221F\214j1\204q\2776\244\002"
+	.ascii	"V\bmK\n\302\033\023\305\363\202\302<\n\232h\211O\314\212\242"
+	.ascii	"\013).281V5\334s1\316](\021\252P\256\251\363\236m\237Z\332T\257"
+	.ascii	"\275\204\371\004"
+	.text
+	.section	.gnu.lto_queueAdd.28.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\232\005\305\""
+	.string	"\326\375\330I\200\332Q:;\\\224P:\343\344\005\370\037\351\374\313\305\302\220D\006\202\222|\374\235\264M\336e\351\242\251?za\315\007\357* B\311g\031Z\352G\363\372\307\220\003F$\270#\300\313\200\325\251\335\366lF\032!D\356$\003\305"
+	.string	"\270"
+	.string	"\311"
+	.string	"g\022\363z\3242+1\257\314l-\363\267\316\245\364\256\337{\367\032\217L\271\027\331\200\035\250G\031\371\001\351Q\365\001\322\243\017 (\361\322\221UO\247rj\ncs/\322\327T::(\007\370\211<\257\275t\335\232\303\251\267]\212\236\315\263K\374\027\327\245A\021\227Mv\365\t\"\265\343\271\016L\236l\265\371!E<N\207z^`\336xz\032\324\324i\211\254\245\3712\207\275\235i\307w<R^\224\020hQ$6~\236\026\270\262\204\360\242\202g\177%\317\256\274u\212\022\332Vm\234w.(f\251\3614\250\3429\300\013\2202\367\272O\022(\242\2657\f\367^\266\303(\2513\2003\277\0013K`F\027\004\177\2044\264!\2746r3}\213"
+	.ascii	"\333\022\264n\230\037\345R\270\311/\302F\314\264\03723=\372\276"
+	.ascii	"\327m\026\021\253\3105\305d\333\230\221@\333G\2638\3070n#\023"
+	.ascii	"\350\341\261\226wt>v\356\275\353\317a\313\273\223\235u\247\345"
+	.ascii	"\365f9wZ\306\335,\253\251\345[j9=-\243\250\345\023\265\334\326"
+	.ascii	"\262=-\277\200\201\253\"\221JF\253!\357S\333\233\333\0055\263"
+	.ascii	"\372\330Ov\313\214\344/yUB\240\205\334\312\022\373\030_\311k"
+	.ascii	"\230\322\235<\311IG\262\007\"Vq\353\336{'\3740\376\327\301\222"
+	.ascii	"\376\204\233\007\202\310\033e\301\352\312\026\233{\357\317Q\206"
+	.ascii	"\240\036=\020\267\276\031a\022\240mc\264\323~S\234\236~\243\235"
+	.ascii	"\306\321:\023^\361\230\235\301\201;\273\333v\201e\tZ7Z@\234\375"
+	.ascii	"\346Z\027\013\035mH\2757\030\201\217\305E\211\356FS4\322\305"
+	.ascii	"d\333n\271\200[\232\324\377R\313\314$~\345\314v\023\"\030\253"
+	.ascii	"\214qu\274%\240\021c\270k#?\371\fj0\222e\350\231\277\362\033"
+	.ascii	"\302\300I\226\365\227R\002\002\332|\361\261\346\013\033\221\264"
+	.ascii	"\217\274\0169y\272\331x?\357\265S\257\337\027s\336{/\312\340"
+	.ascii	"\275\346\351cYq\021\026\201J\036F+g\037w:\247\217\300\326>\274"
+	.ascii	"\312O\275\367N\340S\271\031\021\277\310Q>QT\224\036\335\351&"
+	.ascii	"8\320\024\271\314\372\013\231/\262\356#\007DD\366\004R\020\213"
+	.ascii	"\223\205\200\216\206P\264\0301dB\b\311\227\202(\250\310't\204"
+	.ascii	"\344\003\362a#\025CG>\026FFG>F2\275\215l\355\231\351\362\033"
+	.ascii	"\324\252\222e\2707\177\257kP\233\221,[\317\374n\327\214\201\251"
+	.ascii	"\201b:&9\235n\266\335\317u:.A\353\346\266\251\\N\255\272\326"
+	.ascii	"\351/\377\243\004\nPM\314\"Y\3625#\247\352\232\317\233\256{\326"
+	.ascii	".\363\241\232\367\332\024\264\324\204\305\234f\373\031X\303\001"
+	.ascii	"\243\264!\366\354\255\325\3165s\210 \373!W\350!\354\027\314\027"
+	.ascii	"\263bg\f\212\207\371)\250\002\223kk"
+	.string	"\206\301{\032\327'\034a\021\370\264\025@UCf\346p/\277\013c\216vQ\033\r3\274\241\236\321\322\264\003s\250a8\344\b\203HdF$\020\221\304\031\016p\002\021*\263n\021\3001TFR\220\333\001h\370\351d\310q\222}\204\035\r!J/;<yM\310\277\271\243>\001\0348iD\337\204\366h\242\254@\022\375\366-\031,}F\201<\351\374f\340\023\222@\"\365\232\307%\006\276\302\345\361\224\377,\321\027\224U<\334W&\263ZC\243\200H@\201xA\235\260\242\232\024\353\001r\004r\023\255\223\023\250l0\017\256\033\326\001\024\377\317\3269\233\241\030M5\375\363\021[0\315\320\025\\\256e\303j\234\212-\261D\232#\001\301S\034\364\370\2173T\023\263\352o\255\037\353$\r0gd\212\233\257\003\2557\033\247)\244W\365\237\262U\357\245\250KT\361\034\335s\001\300\003\330\223\313\272\265\237\207"
+	.ascii	"\325\271\310\330\272\346\347\2366\335}BY[\343\354\027i\204\032"
+	.text
+	.section	.gnu.lto_queueRemove.29.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\311\002\035\026"
+	.string	"\246\252\222J\260\324Q:x\301\321\261E\345\263\024\231`\\\343)?\335\016p,`w\001\027\305\356_\217\224\317\007L\005\177c\375\355\257P\3643\317\302\007\356?\350?\350\\j\f\270\312\036C\242w\222{\007\350\273\254'\262\204\220\275\245\224)~"
+	.string	"v"
+	.string	"\177"
+	.ascii	"\263\237\374\317\374\357\211e\232m\223l[\265\352LD\325Z\266\374"
+	.ascii	"\300\270\364\345\252\204K\307\005\020.E\3602;mK#\240-\n\341\223"
+	.ascii	"\302H\255\245\253\213\236\262\263\334\207L[1\244\263\231\366"
+	.ascii	"\255\255x\222\363\371\311\3318\034\021\264\224\226\260\221\003"
+	.ascii	"\350\313q\3309c\230\224>\234\3440\314~\352Q\221\271\036\356\345"
+	.ascii	"-\313\240a\003\372rA\313\242L\255\365\214\313m\330\217\373\037"
+	.ascii	"\350\277\202\237\213\004*\266\367\372\"-\275\205\030/n\3517\326"
+	.ascii	"KB:\206\230\244x8\3309~<\371\272\211\376\262\306\tpT\035\275"
+	.ascii	"u\177k\233vQ\3167a5\237l~\311\356\366+\312\037)_l~8\371t\362"
+	.ascii	"g\363\273\371\314\374M\271\220dD\b\203`\255@A$\365\006\225\022"
+	.ascii	"\261\273\375\267\374\362N~Q\354\323lw\377\2155\rc\257\247\024"
+	.ascii	"\244\326\272\262\364/\343R\002s\377\373\373\357\213t\t\237\372"
+	.ascii	"\024n\210\313r\2274L\025\311\264\305\036\373\277\311\341\305"
+	.ascii	"\035\306\303\255k\377\306\330\t\300\003g\243d\006\214\240\306"
+	.ascii	"f \337\027;-F\265\326\305\375\207\255\013Y\f\217\245-\304\246"
+	.ascii	"?\\\020\313\256:lq\307mh\334W\205\263i/\220\033\t\033\007\337"
+	.ascii	"={}\222\254\232\273;L\262DuK\262\t\200!Dd6\321Qz\033\266\353"
+	.ascii	"\321\303G\376?\302\256\220\215\265\326\005\33766|\023\233\321"
+	.ascii	"\231\247q\201\325\340\354@\250\231@\023sQ\260\231\311q\321\300"
+	.ascii	"b.\227\002\177U\250\201\271t^/\230\213,\353\266\356\353\264\016"
+	.ascii	"\200\276\036T\370\245\205\313\333\007@\247\036\324\334\245\205"
+	.ascii	"&&}\031\236\266\201\020\233\350\344\021mu\373\340\225e\375\254"
+	.ascii	"&\273A\215\036>r*\262\007\364\350\300\303\301\235\265\326\032"
+	.ascii	"\262,\253[\275\274U\3711\013!\335\f:\233\325\253\376Y\035E24"
+	.ascii	"\331\334?\177I\177\247\0022 `\202!\346\214\007i\373\246\032\376"
+	.ascii	"\332\334\2310\246\241\305*\322\301\025\2273#Vd\"^}lL\375&\221"
+	.ascii	"E.\360f\261m^\221\312q6\201l\342\222\320B6\260a-\026\260\300"
+	.ascii	"&w\b;\216Y\177\242\363\206\267\024\275\002)\353\200\222\374n"
+	.ascii	"\353\023X\024\200\3268+e+'b,\016\356\267\214\312\033\265@V\035"
+	.ascii	"\2679[\254O\320B\210@<\367j\361\023"
+	.text
+	.section	.gnu.lto_queueFirst.30.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\005\b"
+	.string	"B\01777@\217\322\001x=\344\260\002\3435\r\273.\250\201\260e\242"
+	.string	"t\370m\006\350W\375\206\274>-\246\204\273\317$/\212\242\352\237"
+	.string	"5X\034r#\342\327f\311\336r\247\024\3066[\006\321i\310\0340\216\224x`\210\220\330\306\221\233\002k\023\331&)4m\223\232\271\207\253%U\202\220^ |\204\313\354n\202\037r\221\216ozt\205\307\243\030\322\312%up\037\344\323(\276\311\026V\275w\217\276U\327c$\255N\254\320k\331\023\364T\303>\334\335\265\226l?+\0048\261(\230\354f\264^v%\246:l\177l\215\357\361\217\217\271\201\3111\272JR0HZv\247\364\274\300\365\230y\300\365\250\033\347\3768\377\250C\026J\245\023\201\3760\013\273\353\327\211F\267\336\266\201mi\373$\f"
+	.ascii	"i\331'c\232\372\f\267\254\224\030\333I\363N\214\025 e\313]C\264"
+	.ascii	"\020\231\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_queueNext.31.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\355\b"
+	.string	"\226\220<80\345(\035\200\277\214\221\016p\022j*\031=\326@I\266\034\214-\202\001? \214k?\326U\373\030\307\253J\033\037\021\021\211I\002\357\247`#|M.~\335\335\244L)*"
+	.string	","
+	.string	","
+	.string	"\033\254\231\335\b\035_\360\3566'xw\nr\355\251\371/\271F\306\304eC\225\236\001\016\273\353\334P\251[o[\3016\264\035 1;\226R?\354kVU\266\323.\323\231\351\277\201\026\230\006\226]\216\030\200}q-\021\333$\233\343\217\234\204d\315 \206\244\336\n,\253;\213F\243w\347T\240\225\212\242\257-\306\2241/\374\232z\r\217\323O\036\375\362W\306\260+\277\335\371v\275\273\353\001\254\303\224\001\366t\262\317\204\b\342\023\341\t\301\n\211\007\n\350\311B\260\223`\220\305'\203\027 P\0069q\257*\247\b&=e\\E\333\354.\203\237rV\310\017\017"
+	.ascii	"i\331'c1\345\315hE\371\263\320\234\220\034(C`1K\211\255Q\214"
+	.ascii	"\2700\316\016#Z\260L\\+&a\222\001"
+	.text
+	.section	.gnu.lto_taskSystemLoad.32.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"e\013"
+	.string	"&\324KC \2138\035\177=C\301\214\201\026\310>\200g\300\177\246m\210)$\351u[\263\376\016\2518\035\231!\304\213\025\332X\323\0069\007\035\234"
+	.string	"\256\006\2549 W\310\2036"
+	.string	"\262@\300\340ck%\275\311\336)\0056"
+	.string	"7"
+	.string	";"
+	.string	"N\235l\260?\245\004\230V\273\253Q\006\027o\321)\372\330%\013\215\235[\006N)F\220U\331\335S\370\0340~\346\304.\273\353\031\032\013\334\365\266=lo\330\357\b\013\354[\273\273\246#{N\037\2538\300\201\243\334%P\206XT\335\360\200b\373\323\276\204O\020O\n\340lW\001I\303.\231a\r\211\327\312/\256W\353\026\327\253E\007\257X\207\013+\225u\0021\be\004\325K7e\242\021+\325\334\335\016ux\235\216\224<\200&\b\373\025n!\364\035\030"
+	.string	"g>\364\352s\256\327\323L$\342C\002\317,m\2623i`\b\327a@6\031\356\373\302m\302\233\345\343LB\022\256d\003\265\fF\244\323\266\017\324,\030\366N\270O\333x\336\247Q\310\275\265t\344\017\004(\017\375\330\357.\037\3033t\236Fs\005\030"
+	.string	"i\3317c\232\215\032\006,\200m\n\313$\303N\230\020"
+	.ascii	"\320\201\313\200\316\003C8\020\210\255\270\006\252!\342B\030"
+	.ascii	"\002$\230w\t\200XM\001\356\0220`Q\345\266\253\350\001"
+	.text
+	.section	.gnu.lto_schedulerTraceStart.39.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\205\013"
+	.string	"\346\224MD \213*\035HA*X\206\001\3000\30582U\242Hbb!\t\002M\261\202*\030\267\003\375/\372\375-\266@\370\210\214\301A\333\315\204+8\300\370\032\215 \231Q\0344\210\001\231\311@t\264\355\277wJ\0016"
+	.string	"8"
+	.string	">"
+	.string	"\273\233a\r\210\323\212O\324\323\312%\352\251E\033\303G\002\373\006/\023\005\270\335\355\346\200\213\227\242\177\332/\252\225\351\322\302\261\273\226\252\025\312=o\373\302\366\206\375M\001d\267\223\314\331\243IN\227\375\312\356\256g\313\226\322\365\263\237^\316\202\3416td\330=\311}X\013TB\001\373\243\2159\306\366\245}\331\r\210\237\225|\331\025`\213\020\025b\267:}\007\257\225B\337WOO\373S."
+	.string	"\3008\235u~\274\206C\rBI\007\024\203\021K\212B\354\t\276 \244\251\t\270\217\252\177\340\bF\376\313$$y\325\251O\252\247\024\256X\241\307\007\2224\236h\003\2120'\003z\240\321\207\007\302\t\273\020\317&\324q\300\260\313X\370\023\361\300N\364}`\207\031\367\225\235-S\026\314\203\206\323D\371\357T\377\301m\035\317\347SOi+\027"
+	.ascii	"i\331'c\272\214\032\2063\006,.*\317Q\306\301b;\2447\225]\260"
+	.ascii	"\007\032\003\212\271\b=`\035\020,\250\221\217\324xs\231R3\"\261"
+	.ascii	":\r\256\345\2050\311"
+	.text
+	.section	.gnu.lto_schedulerTraceStop.40.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375 \361m\006"
+	.string	"\302K,4Pm\222\016\200\013c\020\240\214\252\253\326\205\337.r\r\372\031\224\341\361\027\313\326\356F\314\321X*\001\204m#f\331\346&\324U@\304\354z\217%\203\020\231\002SS\254\030\"\022*\005\252\002\035\026\020\032 \025+p\032\330z\250\"\204\260\254\b\245,\3538o\223)%\0317\361\265D\327\323\017\313\335X\342\322\212\365\335K\324W\320\001ax\234dZ\3503Ls\235/@:\316\273n\362cr\200\222Y\021\002\345\310\023\341\370+}=I3\215l\210\207\002\344\223\231\320e\364j\273n;*\200i0m\001\006\231y\3034\026\335\365'\370\341\177\021\t"
+	.string	"i\3317c\261\2003\202\305\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_schedulerTraceIsRunning.41.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375 \354e\006"
+	.string	"\302\013,3PO\222\016 ;\215=\240.,aL/\256\002\t\322\"\225\305\305\337\032\326n\255\201(j=\332\361Z\212\031\"\210\214\251\261B\237!Jo\206\232\335[\246O\032\213z\240`\240\032\246M\213pX\200h\223\265i\232\202+\t\312j\023Ue\265L\226E\321!\301\007-\276$-\271.\310\025\234+V\351r"
+	.string	"*\035\nh|n\364\231\347\220\343\213I\024\375\367\341\300\006\213\202J&h\364\222+RJ\310\337\371\314\007\b\235\257f\036\240~\234\\\230\270df\r;z\365\256\333\221bDPZ\260\220\247\027\220\220\231\037\026\312\350\330\337\340o?F\t"
+	.ascii	"i\331'\323\342\2543b\206P\\\023\377\"\360\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_schedulerTraceCount.42.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"\375\006"
+	.string	"\262\21503`m\322\001C\203"
+	.string	"'p\257\367\026\206\350J&\332\033\212\241\244\213\"\230\3264v\320\350B\300\267\226\244An@\202\263\333ON+\300\034F\262\267\224)\005\236.\217Z\310 P\t\023\3065(\0340\270\351a\334e\300\225\003\365\334CU='\305=[\365\250Z8\032\341\253\352;)\377x\314\370\030\206\320\344\2557_\023\275]\003(8\031\262\343&\265\302>\333\335\265z\354L\353\323g\025\r\023\203\220]\211\020\312\226\264\221\f\333\320\226|\216w@\233\204\305\213\353\037P\007\344dw\235\345\002\321\033{%zS\213\303'\364\357q\266!\002\262\256\315\023\240`w\235\3265q\353m\023\330v\266?\001\t"
+	.ascii	"i\331'c\272\365\206\325\301T\204jo.,Z\260L\\+&a\222\001"
+	.text
+	.section	.gnu.lto_schedulerTraceGetEvent.43.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\317\001\215\021"
+	.string	"F#yE\360\360\026:Z\274rFg&S\026\271\324x3\300\217\323\361@\377\\&m\316^\300\317\362y\310\341\362Qh0\241\2319\006\373J\372\362\234\354\252\370\022m.\034\260\371\231\301+\370[\027\264D\310\336[\312\224\002i"
+	.string	"["
+	.string	"g"
+	.string	"\253\335\021BE\273;b\005\252C\221\207\304\303\367\001\361\320\266\0270\220y\366\\\211\233\353$\321"
+	.string	"A\355\346Z\232\363\331\341\323\234\371/\207\312\203\203iF\213\032\210\277\207\300\206\364\341\243&\363B\226H<\261j3\251\257\325ah\347\243\026\363\004\324\340\201q\335\323\2466\223\231*\331]gM\315\303\035o{\202\355\007v\216\0047\230\220dR\207\235{I\275\331\177\273\273V\034\373??\200\373\374,\247W\231Ve:\225\351\230i\230\351\367\322\232\351|\351\007\270\b%(\033\022r\354\336\354v\254\0224\332\261-\263Y\2665w\025\262\377\270\034d\027\247G\321nn\304\rT\207\316\2512\355\247x\217\354>>r\360C\307\350,\236R\225\026"
+	.string	"\242\031\2614jJ#\017\232-\025jTxD;!\262\367Q|\n\3654[L\356\254\372\204`\252\021rp\266\036\037\352\211\203\214\2477\263L\350\222\256\251\247\351\001\223;\373@_\221\301\307y\245%_s\350\267\304\303\253\001\235\0200\271{F\311\304\210R\2759\301Yz\335A~P,\005,/\227\006\027\334\340:y\241@\233\220\304\\\027ZN\\\026LVZ/\024\n*-\223\330J\213\344\200a\030\\\261\026\013\f\026k\261r\373\267\212\343T\276\350\321\211F\020\321\373g\361\272Cpj\n\"R\177\026Wjc{\245.\201\321\030\2507\277N\244B\300\201\357\342/*\370\270C\243\244\344kR\342\320\211J6\355\356q\276K|\036"
+	.string	"i\355k\3024\035\214 \307\026\020\332L{\255\035\265!\265m\316\326\236a'\330\036s\021\232+\003>h\f\t\270`l\t\223J0\361\262\261(X1\312\"\234\025\223k\"\325\004\017\304"
+	.ascii	"W\230\246\303\030\241\034\243/\025\005"
+	.text
+	.section	.gnu.lto_schedulerTraceRecord.44.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`y\0065&"
+	.string	"\212C\304\016E\200\234Q:[)ty\031@\212\002\205\212\346\3057\036\341[\006\206\302\346\3346hC\301\372\335,\360e\233,:\301\217\nJ\312I\315v\221m\266V\256,\233^Q&\341\204OB~y\364?i\204l)\223\f\327"
+	.string	"\276"
+	.string	"\342"
+	.ascii	"\273b\246N\252\340\371u\034\324\247\326\332\340\345\222\330\245"
+	.ascii	"\274+\241\002\357F\036/\252=9a\037\302\364\240E\325\367d\n\006"
+	.ascii	"\356\372\027\336\301\364\330Z\255N\222\025\316\227L\364\274\373"
+	.ascii	"\255w\341\235\313\307\215j\205bg\254\326\256\007\033\341|\271"
+	.ascii	"]\027`\276<\217d\276\\"
+	.string	"\336\356\236wI\251\264)\310\237\027\262\326\332\324Q\316;n\350f\253\2354\263\244\315\274=MC\r(\244:N\311\207\256\004\223\360M\t\022\266\035p\"\344\310kq\202G\300~\340J\320\b\2376!\221\323^uu\223Hh\365\343\222\251\326z\023\376`J\223\024\300y\222\347&\364qS\006C\262!\217\023\274\242\002\340<\311s\2603\020a\217\231\246\241\326\272\f\024\n\371\022}w\363\354\356\211]\363A{\254\315A\361\201PMa\312U\025'\377*\300\341\233n\342\362\247\314\002= \n\240\342\321\307\203\266\273@\277\320\357\254\212\223\273c_2\223\273\373Vd\357\244\346n=VYz\234\\\034\357\027\230\2732h\360\201\357\027Z\302\304\254\217\257\251v\273\250\270\211\273\247\265\326\272\re\327\306\233\340a~\004\007\3633-\335\370+]\314\267\300\271\376\244\033\277\001N^\244\223\367\350\3445:y\213N^"
+	.ascii	"\224\227\210\362\342j\274C'\357\215\362\332N\336\332\311{R^\032"
+	.ascii	"\3455)oIy)\215\267i\274l\362\276\301\263\202H?%\304j\r\222$T"
+	.ascii	"\337\224e\254\\\314w?f\367\366\203\355m\003[\206[{:\260\300\302"
+	.ascii	"\032n\351\351\036\3522\353\253W\347\353\354\326\273</\307\343"
+	.ascii	"\324D#\362\316\361\300?\t\372\326\007\373\213\024\313\276\316"
+	.ascii	":\231\374\002\023A'\350\217y\203\037\306b\035c \246\336\335p"
+	.ascii	":\034\232h\334Rk\265\260\2735^\326\341VvA\316\347xX\020\"\370"
+	.ascii	"\300\021^F\255$\265\266\365\177gpJ\364\255\314\313\354,\252w"
+	.ascii	"2\335\324|Id\240*\002h\306\324\320\232h:\231g\353\212\3075g\343"
+	.ascii	"d\342\351\251k\276\244\326\025\177\311T\352\245\316 \306\347"
+	.ascii	"7d\002\225&X\312&.\255\313\356+f\323\246\365R\033\253a\017\305"
+	.ascii	"\323\230}\262#\327\246\370\031\025g\255>\013{3!V\234X>\314\227"
+	.ascii	"ec8rUq\222\227\316\0320th\023\367-L\332\027Tt\263\037;\231\026"
+	.ascii	"\001/@\330\330\345\244\314\235\214\334\215\030\345\356)G\024"
+	.ascii	"\r\251\234n\352\205m\367$\245\313I\355h6v9)\272P\020t0nL\275"
+	.ascii	"\2001\003j\327\224\203F\016G\023\224n\327\004\341\300F\351\200"
+	.ascii	"\241k\222\212\212\3225\335\272\352im([f\005\315\372Tu\017\327"
+	.ascii	"D\036\026s\271\307>\036\226,\236\026>\220\247\245L\f\031\350"
+	.ascii	"CH\315\341\210\304T\324\013\370\347\250\221\232\266\261\372\215"
+	.ascii	"\354G\355\242x\307\307\203\316L\0345\315KL\313f\324\204n\244"
+	.ascii	" +\254X\3078\344Z+U\215*\365RV\362p,\364\0233\227zi+u\200\006"
+	.ascii	"\262\273NfQ\273(\266A\362\264\236\212\272\364\n\323\272\002\320"
+	.ascii	"\202\210\032\200\201\344\367\214\211k\242\246a\277+\007\2675"
+	.ascii	"\256w\250\021\263\032\006\340r@<\222\260\266\376\370)\211_fI"
+	.ascii	"\206\272\234\017\217$\254\200\207\250q8\303\fS\316\214L0\"IA"
+	.ascii	"\322\034\220\002\021\242\253\035\021\340-DC\2234\323\030\351"
+	.ascii	"\345\324\317\337\3239'|+\204\2135R\303\241\210\231\032\226\201"
+	.ascii	"\341\004\203j\206q\022\334V\226\003y]n\334\345\333\022\245rh"
+	.ascii	"S;\304>@\350-K\026q\307\372l\t\242\034+r3\253M\231\323\374k\205"
+	.ascii	"z\006\210n\030\016\321\220\2714\007\272\205\213\255\016V\030"
+	.ascii	"~ \243^G\351\001Y~v\234\322s~\377\323x\364w\262\2446y\207v\007"
+	.ascii	"G\033J\213\351\305\035\343\304\212o>\340x=M<\267F\3332J\3271"
+	.ascii	"<\373\356\bc\232\350\221\210\3720\220\340\221\032\312\344\200"
+	.ascii	"]Y[>\001\314\225iQI\337H+\n\366\013\376\f`W\013E-\237C\343\241"
+	.ascii	"\276\242\373\327\347\333\327U\201x\347\r`\275\\d\002\016\205"
+	.ascii	"\204\303\013\226\336\3414\021\r\034]S\353\314Q\022\035\304>3"
+	.ascii	"\b\314i|;\316t~\337\301\264\337\261\216r\231\354\256\266w5"
+	.text
+	.section	.gnu.lto_getCheckFuncInfo.49.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`A\001m\f"
+	.string	"\306VQA\020Q\234\016\037\352\253-"
+	.string	"\244\213\366p\351(r+\203\317\321vZ\rr\264\3335\314n\013\364\324,b/\341\352\233b\026t\006B\022\013"
+	.string	"\300Bn\310\345\303\325t\305\265\237\026\367;\322&R\246\024<"
+	.string	":"
+	.string	"@"
+	.string	""
+	.string	"vG.<v\303\0026p=:\274\305z\274\036\300z\364g\307xH\332w\214\320\300!cw1\r\361\357\371\3717\361\t(\372<7\026\354\256\023\024u\270\365\266\t\330V`\037$:I\205\230>\200\262\304\016?\251 \354W\273\273\326\221\375\323\177e\332\312t\314t\225i\315tf\372\025\001\034`<@\355n(\231\261\"\361C\004\305\366\323>\211\227\370~\362<\316\274E|\001\216\304\033\304R\255\364\031j\204:4\252\bR(S\252\275\371\n\025\\*\305C\b\311\325\266p\016\357\332\335\004~\212\215c!\225<\340\310O\034\205\347\227\214\241\223\007\037\375\216\365\370\234\204\255A\266y\f4\231\206\311*\316.\235F\301\213\240a2\016\266e l\260\254\343`\227\001\346*h\035v\201\343:\214\022\356\253\325\221\035\210D@\032\262\245\266\366\217\212\306Y<\252\3451!\352\201\024\212\244R\007\036"
+	.ascii	"i\331'cz\200\032\206\263*\320\006\005\f\002\026\320.\300\002"
+	.ascii	"\255\221\202\2106\260\007\216\001!\300\024\270,\b\036\200;\270"
+	.ascii	"\354\210\201\232\270\2335&\300nP\206YT{\r\020\\lhVS\300]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_getTaskInfo.50.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`g\006\355 "
+	.string	"\306;\317Dp\250M:Cwv(tFU\035\370\216\314\f0\372\003&\240%\2656\00440\234\026\372\377\250lN\327`r\272\t5\262\260\005\b\243\026\365my3\337\013\251\270\221\016h)\001\216\375C\032\331[J\231\002\264"
+	.string	"\246"
+	.string	"\304"
+	.ascii	"\275E\3331\337\261`\036\201\312\025"
+	.string	"%]j\255\213\366M{\356;6\314\215\006\274\2065\2105\306\246\013\203\245\227\360\035\177n\351\346\376\363p\277\364\326\254\307*\325\032\246\347A\271\364\303r\371\337.K\326[/>NT+\023.gj\0356\270\203r\251\201u\"\227\316e\"\227\276\367\367\331\341\223\272\305b\020\264@\265V];y\323\316\341\236roI:\233{\337\263e0\267_\0331\370c\311\243\340\327\220\340\217i\025\260\235\023\213L\213\330Q\320k\266Y\032[.\370\305\275\305\3455Cgm\304 \3302NB\255\365\f\f\026\331\343\366?\220\377\024~\322H\265B\370\232Y5\024_)K\237B\213\027\250E.\245\352-\356\n\375(I\262\346\343\267\266\303\307\214\3307b\250\376]l\361\002\267\t\260!\231\343\325?\376\341\217\273\311\277Wu\336@y\207\375E\374\035\345[UM>\325\232\355\016X\342>j\275\354B\021\361\237&?"
+	.string	"\345;M~S\311g*\371K\223\257T\362\223J>\322\344\037\225|\243\311\007P\362s\223_\204\343\023M~\211\343\343&\237$\371t\362'\345\367\344\363\344\357\025u;\022\205L\267\r+\221\267Bu\016]\033[\342\356\277_1K\374\0267-\n\204Y\210\372\237\260|\342T\330\343\f\242\236\022+\273"
+	.ascii	"\033\026\\\377\0266O\r4\f{\247\006\017\327Rd\023\020Z\241\375"
+	.ascii	"kX:\034\334:\254\034\017e\255^9h\353\216\263\021\b\227t\377\037"
+	.ascii	"\026NV\033\002\376\371C\254\233\2546<F\224:\310\245\335Vb^|\374"
+	.ascii	"\306\215\200-\311\256\177\022\273\206\353\352k\274P\342H\217"
+	.ascii	"\224\036\344\322=\333\005`y\316\332\210\177|\374\026\205\354"
+	.ascii	"&\317A\231U\335{\230\301F\365\020\253\216\352\np\276k\233\346"
+	.ascii	"\306\257\224\237\270\232\253!\227Z\365\200\343\021\337\254\265"
+	.ascii	"V*\265Q]\325{eL\316\227\222\337\230$alf79Uo\363\316\216^<\350"
+	.ascii	"\031\366\214\216\262\006[[\334\325bF\271B\003\227\215\0247\310"
+	.ascii	"kM\361X\304\300\261\202\305\013-\033\272\031[)d\350\264x6tS\007"
+	.ascii	"\336E\203\005Ow\243\253\213\247\313\r}\333a\3371{\241MH\232\032"
+	.ascii	"\375r\221[\334\rx\f\245\251\365.\027\271\033a\234\343\353\337"
+	.ascii	"\237\2340\360j\024\r\370\307'\306B\256\006\342\251\261\002t\003"
+	.ascii	"!\032\247(\f$\253\314\024\376e\211p\352\235XS'`+c\032\343j\\"
+	.ascii	"A\273\324L\rUe\017\231X\352\235R+\020\222%YYB\275\262\351F\367"
+	.ascii	"F\022\251\223Z\200\361\353\320\017\313\006R\201\324\017\216Z"
+	.ascii	"J\310\305(\313\272\341\331\262\200ze-\214\372\352\b\240\027\b"
+	.ascii	"\267\344\372\357qY?\275\262i\354\221m\237^\031\214\\\357\216"
+	.ascii	"E\035t\250A8\303\230E\304\002\221\221\t\232$i\r\360\002\021!"
+	.ascii	"\343\034\0210=3\314M\220H\013\233\003\312\006J\263\377\216\360"
+	.ascii	"\034$\020\003Q\360\375o\")1\364UR^\fv\016\315\334\307f\325R\351"
+	.ascii	"\3259\006\f\301\344\345(;/?\344\246\201\207\235\365\213\231+"
+	.ascii	"f\003i\315=\001\256\331V\027e\275(\341m71\240\366c\352\3648\270"
+	.ascii	"\n\201\266#\372\332\227\363\335\312\323\265\203~3\310!\320\330"
+	.ascii	"ID\251\214%\240$\341c#!Xo\026p\311w\004J\341\203@\336\302\361"
+	.ascii	"\351\026p\307\305\016Jq\312vH\232%\211X\372yM\246\222n\306\217"
+	.ascii	"\004\2509\266Bc\370\035\322t\332\f.Th\250\021\375\"\356A\264"
+	.ascii	"a2\200\211:\310\021\317\020\243\204m\363\342\006{\207\317\254"
+	.ascii	"\373/\031\376\001"
+	.text
+	.section	.gnu.lto_rescheduleTask.51.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\224\001\205\020"
+	.string	"\346\236oH\340\262(\035\220\257/\037\254(\266\207\b\340\023\007#\364\n\201\017 \030\224\016U\230\3231\b\027\212%\334W\213^C\030O\263\360\373P\035\352?\243A\316!\202J1v\274\320CQ\220h\377\350\211gYkd\357\275S\nY"
+	.string	"W"
+	.string	"\\"
+	.string	"\257\364\002\266W\303\354\035\027U\354q~:\324~\354n7S\034\366\255\322)a\376iN\002\303\330\267\321\312+\r\t\322\021*\2054jR\211\001\271\220\203\244"
+	.string	"\302\225O\032\302R#D)\234QS\017\212\237\323\\z\beR\212\034\354\256%\030\202\270E\267\215\262\r\301\376N\336.\376\3643\377I\005Vz,"
+	.string	"\355\252\214A\226\247\322\220y\355\366o\376\302\2671\367\352\327\034\006\354\265\327\227\366\201\004\256"
+	.ascii	"\n\332\025\023\274\372\2018:g[\212':rvW\304\rF\257\276\264\337"
+	.ascii	"\342.`\237A1i\367\304L\316\256(\342\005\243W\0037m\001\254\317"
+	.ascii	"8\031\355.\003_\206\247\241\224\003\346e\363\267\370(8\235\242"
+	.ascii	"\371\233K(q\343\206&$\223\243\375\030\307y\3710\376\\\362\240"
+	.ascii	"k{\335\346m\216@\204\017 $R\344\370\030\220\205g\316\027\017"
+	.ascii	"8\312\366I@\206E\215\317L\016\331bL\316\027\373s\034\307\321"
+	.ascii	"\323\305\246\322\242\327\036\253\357\324\242\037\205\024\213"
+	.ascii	"\304SM\330\2402\341R\021V\337\251\265\0315\342\2510\270R\252"
+	.ascii	"\013\250\2573!9\225t(\357\353F\016\230\225A\345u-\026\313\353"
+	.ascii	"8qOw\272\270\302\b\236\224)\243\273\273\033'\351\374\264W%\362"
+	.ascii	"\240\353\214\031\210f\007G\r\320\"\303\243\306\306L\016I\235"
+	.ascii	"\036=&\250h\332\001! p\002\"\242\264\003\351\3337\232\356\261"
+	.ascii	"\261\267r+\221\313\352\326\344i\250\303v\213/\205\375\307l\332"
+	.ascii	"a0\226\306\236\266\232\004\267\300X\2445\006k\376l\021y\330\035"
+	.ascii	"\321\206\335\344v\222\204U\337g5\002\273\rh\244%\244\317\210"
+	.ascii	"\032\027\335\003"
+	.text
+	.section	.gnu.lto_setTaskEnabled.52.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\345\013"
+	.string	"f\027R?0O\224\016\347\274\005\252\003'x\nQ\324\204\201 \"\340J\254q\244\007\242`\275WHY\333\307\266\n\332rU\235\363\232f\2230(\345\364\220aQr\0370\311\032\254\377j\215l\262\245L)>"
+	.string	"A"
+	.string	"="
+	.string	"\360\002\342+k6\213{\037\366&0l%^\354\356\245\036\256\035jj\276e\221\244\270\322aD\343\352\361\314\300\241 ew\337\361\274\300\2352-\313\356:S\334\206\273\272\355\213\355\006\366\035\004\351\314\364\001\030\350Pp\\\354j\370blH\005\002\302\366\355{\330\223Olk\332\n\026h\367F\005\336\342\203\343\004\203\310+?\355s\\\204\366\216d\311.\207\356c\327C\340\004\221W\224\023\210\257\002\271\3150\345\356\256z\024U3$T\240\022\206S\257\252\272b\323\b\220\nel!\006\234\024\241^\037\244\3706\220S~\266WJ\355`_\277\357\373\254\033\366\275\337\322t|\367\303Lk\006\033\254\223\301x0ks\221"
+	.string	"\302\204\2425\225\f\353\2106\030G\003\272<\0210\023.M\006\272*\007\374\241\200eW\350\363\311\256\211\267\327\rC\030\021b\322\023\2041\243B\265E\025\362)\277\343\026\013Z\262\245Q\035\024"
+	.ascii	"i\3317\323\342\235!\013\216\002w\300\330T\265\f\016\241X\221"
+	.ascii	"`\226\301\2723\245\240\031\330p\215!\205\273\005\252i\340\004"
+	.ascii	"\001\003\0365\262?\2242"
+	.text
+	.section	.gnu.lto_getTaskDeltaTimeUs.53.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`&\001%\016"
+	.string	"f\232`E\360\262&\035P|\224\245\226\217\245^\354\256\262\036|\315\224b\242\303\303m\321\352\360\341hL\316mO\375\315\"(\f\326XL\t\022X\333:\207\305\311\347|.\230B\336,\332\317S\n\365\231\232\265{o)S\nM"
+	.string	"I"
+	.string	"Q"
+	.string	"#\361\360]@<T\020\327\036\341\323\324|\021n\365\030\2329|\b|\364\004!q\027\336\210\f\3166\342`\362U\310qc\343f\256oA\013\216\207\304\265\036"
+	.ascii	"\027\017\022"
+	.string	"\327y\306p/\231 \223\335un\034\207\033t\333\rl\227\330g\005jc_\273\256\353\2545\216/\375\376\372\325\351\324\364E\004\200\330\200\340\263+\323\r\331\032\360E\216m\027{d;\363\257\026\213v?\310p\261\013K`\005\241C\333>\212\247p\261\366`!8\320\b\021\030v\204\354nf\340\001\253\303\304f\260\200\001\n\270L\304h\264\362G;\364d\350\361N_\241\225\370;\026(\204v\3677,\3610\252\350u\025\217\261\3707N\251\362\333\241\257\212\207WP\211\030'hX\331Y\007\316\217\r\2526\036\360\226\250J\343\312\211\341h\345\217\r[e(\fRR'+\321%\022\224)\202\n\305\344\240\224\312$<8Q\311J\250TFr\300\247\t&T\266r:\241\262\021l\377Vk\354\301G\303\363\265\350\007\237^\347\242\0350x4jj\214\332\204\245/ow7\216R\325NQ\311oO\237\006\031"
+	.string	"i\355C\303\364\304\330\220\306\006\370\031\204\006i\214"
+	.ascii	"p!\244\320C\343 \212\026\222\264X\022\3128\212j\357\250\034\201"
+	.ascii	"EQ\233\220\270\214r\325x2\023\256\370\231&i{\204\200\002M\253"
+	.ascii	"\366"
+	.text
+	.section	.gnu.lto_schedulerSetCalulateTaskStatistics.54.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\345\007"
+	.string	"R\31776@o\323\001\233>\302\236\323nT\222\230\351\257o"
+	.string	"\341\333\310\326\3456\325\177\215\3671K\2014\372\255\"v\374\212"
+	.string	"\221\024>\230\265\264\303\017m\316\f\246\255\355\235RU}\300:\225ZZ\265\264\2519x\352\354T\332\274>\364\232\264\300\224\223U\327'\242\222\240URXsB\322\254J\216\201\261\212*\223\032\206er\343\355\247\215%\210oe\024/\f\243Or/\344\203\330\002\004\317\235\362A"
+	.string	"\2474(*\"\033#\370\331\236\bF\016\373\323\306\222\375\356\207\023\301\f\213\347e7\343\223\331\025\352$\304\3667\266!\264\025\026\266w\241\201\303\264t)\273\036\202\023\002Ny\263]\356y\354M:\214\222\230\335\225\261\343\333\341\346\177\344\002\034It\250a\330]C\216\244q\307\333>\260\335`\373#\t"
+	.ascii	"i\3317c\372\365\206i0\255\2700\206\007\233Kj2\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.55.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`j\001e\016"
+	.string	"\006\232`F\360\320&\035\270\353\204\241A\251c\251\205\301dQH\311]\327\262\327\\L\362\005v\3179\300.\360^\013\304\201\214\301\340\377\017q\365uf\246\t\225M\244F\324\341\347\007\360p\301\262\371\344\254Z\3766\356\275\267L)K"
+	.string	"G"
+	.string	"O"
+	.string	"\027`@\273\273\301\017G}\312\b\025\345?\347\036\235\227\372\f\255.\243\b\215\236\033!\236\205(\212\261\3514\257\202\306\017ou\030Ed|4\204x\252(\222y\370y\316\025\203\007\243\332\261`w\255\235\227\341\356\270\355\221m\022\373\260*\r\262])\205,\373\360\373\276\317p\306>\316\037U\375\217\002*d),vc\276\034\033\223)@h\266\257\366E|\004\3528'{\354v\360A\261\353J`\005\241\313\003\027\315\313\370"
+	.string	"\363\322([\306]4{\236\235\034\"\312yV?7*?\001t\023\267K\337\321Z\263\033n\332\022\256\303\205v\227\304\207Q`\031@S\3432/7\0305^\342/\027\277\306\023Z\364\335\245\3372/\017\245\316\013\034\033^\364\273M'\023\203\220e\001?\315\b\t\264B\274b\004&\fP\270\222\225\351\321\210\211\224\302bBz0\3426\b'%*\333\310\304m#\b\\\212@2m+\245\222i\323\\\373\270p\246\301\212\330\013\204\211\273\273\023D#\264\035\234\350;G\230\362\f\022.f\022\262\f\340\247\031\241\201\326\354\325B\245A\332cC\026\035"
+	.string	"i\3317c\032\375\fk\325\n\220B\350\325\266\265\3146K\201T\323\004"
+	.string	"\206\001\376"
+	.ascii	"\333\200z\221\022xR\224h\352\2146{\203Z\006E\311\033\352x\234"
+	.ascii	"\r\001\243.a\021\253\321\300\035i\252I_\241\250\321\252="
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.56.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"E\r"
+	.string	"f\030[E"
+	.string	"\261&\035\203MO\243\364H\300fM*#\367\327\315N\021O2`\233\327\273\327\243\036\022\032.\274bl\b\f]\020\002FF8\313\"\275gH\262J\200\301\006\310\350?\306\331\356\225<S\263v\357\275eJ\001G"
+	.string	"D"
+	.string	"H"
+	.string	"\026\f\361\355SF\250\233\177\324C\\W\372\004\271\\\306\017\03185::\fq\3242\303\211\272\013\0329:\227\303\370\361\262\202CGg\212\243\025\b\235\243\256\032:\026\325\317\202\335\265r\335\206\373s\333\227\355\020\373\r\002\207\337\367}\2060\366k~U\365?\004n\254Jvv[\276\236UI\025\"D\266\257\366I\274\304\366\032\025\207v?\300H\261\353%\260\002\320\245\201\217\346e<\200y\351\315\216q/f\217B'\203\215\215\335\r+\017\021\236\254M\233\302o4\320\356\206\3706\026N\004\304\310\244\314K\004.f\374\304S)\276\214+\240\350\271K\037e^\036\312\233\236\021\035V\364\373\f\367\242\202\360\344"
+	.string	"W\231\n\007\320\240R/L\312c{%\205';#\f\"h\"&\323\027HF\222p2BzpiV\t\004\021\022\353\3124\013\344\200\261\t\244\3142\301\260\314\022y\373\270\020\306\016>\325\nd\211\273\273\223C\025\332$\230\236s\204%\357\230h\221#=\n\320\344\244X\230\224Gqh\004\027"
+	.ascii	"i\3317c:\3076\262\262\002\255\020\202Tp!\244\360\243q/\344\030"
+	.ascii	"Y0\332\304\r*\f\212\2727T\363\270\025\002P]\354\"V\243\201;\322"
+	.ascii	"T\223\276BQ\243U{"
+	.text
+	.section	.gnu.lto_schedulerResetCheckFunctionMaxExecutionTime.57.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375 \354M\006"
+	.string	"rK+3PO\222\016 \346\0215\363V(\302\355\352\324\202DP\n\3612\b\315\022\255\335z\220\321\f+\335\204m\372\210\231!b\0177\234|5h\325_\373\204\310\024W\024\264\026 \020\254\204\352\362\032\024\016\030^\005/\217\032\370r\260\340{\270.\370\246,\353:\006\032\236\215\233\370b\242+\322\021\314\365X\"\323\032\013\335LTH\302(\001Y\331\264\317g\232\3466\276"
+	.string	"\351:\357\0042R\"P2->-\351\201N>\376Nc\257\322\254#k\022)HX2\3639\216bm\330mH\245\310\321\264\005\024d\346-r.\272\353O\360\277\277\"\t"
+	.ascii	"i\3317\323\342\2573|\206[\\\023\311B\300/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_schedulerInit.58.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"}\013"
+	.string	"\026\225L@0\345\2521"
+	.string	"\336os\322w3\377\202G\257HW^\265\237\307\327{f\366\217\031\303)'\227\312]\366}\377m\340`\221\365h\264\333\354\306@i\310\234E\351QEXD\242\263\017h\022I\231R6"
+	.string	":"
+	.string	"<"
+	.string	"\266\246\001\225y\357\365n\355\222\355\335\336\263\311>\360\223u\177c\"\022\273\335{\277\312r\323\251\311\377\353\2342u:5\200\270\367\232\226\251\222\273\3366\203\355\317>(\243\316?\0373\362[\376 \321\227\267>\251\273}0\013\250\314\032Is\366\211\242u\305~\301\255+\233R\237\343PS\241\270N*\201\363\216\344\022\334\231\005\340\262}\377\345\260\322\315\226\331\026\333\255s\237\3465\016pa\231e\335\255U\261\271x\364)\267\200\256\363\303|F<`\335K\306.\223\341\267n\035\022\351K\261\203u\210\350K\037\366\210\001$8ZH=\371\017\006=c\2501\262\b1@\321\267\001\372\204>p\024}\236\005\213\034\341\370y\210\342\370y'\371\272r\305kFV\224\023\350\253=A\241\200@\375\206\316\376\200\365\257K 8q4\220z\262\t\003\027"
+	.ascii	"i\331'c\361\374\315\200\307zL\\\237@;\016\t\362\r:C\013G\220"
+	.ascii	"\366i\303\032\340\0166\bCT\324\224h\333T\330\256\211\004\230"
+	.ascii	" \b\025\370\345\np\351\026\355|\002"
+	.text
+	.section	.gnu.lto_schedulerOptimizeRate.59.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\035\n"
+	.string	"\346\222E>0\305*\035\300c\373\276\237\277|\337\241\334\f\273\034\222U%\b\315\230\224\372o\267\255\302\205\247\217\337\260\252\271\217\002\\\231(\303\204\211F\206\312\231xJ\036\224\207\266\002\326\262\237\354-S\n1"
+	.string	"2"
+	.string	"4"
+	.string	"\373X\207\312\304\266\273\235\374x\370)5\364/\034\314J4}n\\\036\210\250\251\260\273'\271\262\304\224\352\205\263\273\326\225\250qs\267\035a\033\302\266\201\376\\\351\262\017\373U\325\347^k\331\006\220Nv3n\tv\205C\031\261\375\214mU\273\301!<\254\224\360\002#Lewd\360\246\340\234C;\300G\220\\\255u@\300I\242|\351\217/\361\314\0271\206e\372\3259\3372\3139\f\307Ios\312\227\352\356\232\244K\026\2253\205\346A"
+	.string	""
+	.string	"-\245\b\354\321\244\362\345\336\250#\341\221>\240\317(\364\031\330\243\001\275\212\213\t\217\302#\352,>\035P\347\001E\235f\301_\310\003\273\321\367\201]f\334\317\225.\253\334 \304BT1}\270g\226KV\020"
+	.ascii	"i\331\207\324\364\307\262\302ejK\260E\252\312EEA\215K\t!\270"
+	.ascii	"&Nd\002)\251\311\300]\002\006,\252\334v\025="
+	.text
+	.section	.gnu.lto_schedulerExecuteTask.61.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`<\t\3151"
+	.ascii	"\352XH\023Fp\\N:')\300=\025OphE\260\b\340\331\335\021\020#\024"
+	.ascii	"\362\306\006\303\026?P\t\256\275Q\2704%\363\320q\261m\264K\003"
+	.ascii	"\303\275(\236\221\237\213\374\023KjR\310\252\207\252q\351'\333"
+	.ascii	"\b\355F\344N2\035\001\f\001%\001o?\225\337\312\337\306|.|/\254"
+	.ascii	"v)~\245\261\376\305\\\034<\177\221b\341oyC\221T\201\007\307\225"
+	.ascii	"2\313\334,Y\327\365S\236\205Y\345\025\307\302\352\\S\275\024"
+	.ascii	"~\225_\261\302\314&\261\345*\204\201\335*L\337\273\302jq*)\232"
+	.ascii	"\300\226\353\214\rwqN\350@\254`V\337k\346\026|7V\231\271\255"
+	.ascii	"\230\202\221\245S\230lr\353\272\224z\217+\244\366P\212\354[\327"
+	.ascii	"\036y\013\254e\276\362l-\276d\361\240u\365\021F\313\272.\251"
+	.ascii	"\330*}\217\227)3\363\233\334I\013.\236K \311\033gm\314\215n]"
+	.ascii	"\227UM\037\272\357\235\027\272\357\365\217\027\257\376|)z{g\333"
+	.ascii	"\"\337\355\023\2140\230\310$\330U\263\377\036\206\343\276\237"
+	.ascii	"!33Bv\303\246\004\320\367\240a\343w\354h{\277d\215\237g\224\334"
+	.ascii	"\333\235\237\244\213sh\306\020\244\232\024\263}\n\231aI\363+"
+	.ascii	"'p\206\f\3079\225\346\310\215\273\335\306H\032\255E\035\254\353"
+	.ascii	"\312\026\231\244q\356937af\037\314\351[rZ\315\f\342d\200)Q\234"
+	.ascii	"\024\230f\0245V\346@h\2556\2623\206\367~j\b\375,?\2214\345\270"
+	.ascii	"(\221\222f"
+	.string	"\264y\314\034\374\230bU\334\272\256\b\370`\212I\204\377\002D\310{ou\256Y\247tj~\230\213a\301\027\302#\266\354\221[\367\275_\271\0010M\265\034a6\317\2469b\366\326,\256S?\312\034\036t\320\260\021\263x\230\227F\333h\314?\327\366\301\214Z\326\272\226!\260\345\005\357rV\360\266s\326\337\316Xl\371\352T\316V\250e\252ky\352V\316Q\250e\250C\371\237\276\374\235\330r\023\323\333\316K\327\362\200kY\311g9\351g\031\351g\371\350g\331\350g\271\350Z&\272\226\207\256e\001\327\262\320\265\034\340Z\016B-\003\270\226\201\256\345\237k\331\347Z\356\271\226\325k\371\347\263\354K-\247\3272z-_\324r\017\265|^\313}-?\302\333\342\316r\020Q\266\232\345:#\317n\205\353m!\362.\177v\025j\240\026\320\327\355x\026\240\203Z\250\221\356\216iF\272\003u\200fj\036\361"
+	.string	"tP\177\f\017\017\b\240\033\254Q\206i\335\256\b\324\250\235\331O\343Q\362i\265\177\3726{:\253}\372\210\3141\315x\366r\325\356\351\245\346\021\317\310\022>WT\033-\233\303\352_g\365\231\345\230f\374\265\2012d\224,V\263\2579\301\0161\246\360:]\215\226\335\251\303\352o\371\327t\210\20136\030\337Fc d\363\213\327\336\345\201s^uS\307\030\336\264\211q*\244\335`\354\324\235\275#\313l\341\202=\362\252\317\266\303\330`\347;=\342\324\316\024\327\252U(\363D9\233\267\031b\320\240\341\276g\325R\312:gk6\302\336\3412s\270\232\016\27697tu\320n\026\221snw\243}\2769\236Q\365\355\217\341\365\372l\252\206r;\0329\033\252{\235twd\342\341h\200iz\366\257\274"
+	.string	"\031%\334\331\232r\252\241\272\237z\252\317\374p3\305)f\267Z\346FM\371\324e\212\352\230\232\272\034Q\315\300.\3161L\342\200\260k\353\253\312\304\260\253k\030<\002\202\260^\032\270\270\200ZB\342P\204\020BR\210\341\026Qx\342\n\203@\342W\317\304p\353\013EP\250BB\t/\340\227\220\227\006a\327V\206/\023B\"\021E\320\247\204\0270C\b\341WP\310%\364\352\341\340\001\242\220\013E\b!\211\240W\225\211-`WU\220\350Uu\200"
+	.ascii	"\017O\b\211U_\303!\261J]\206\375\364-5j/\347LL}\267\007\301\235"
+	.ascii	"9\002\027\326F\325\311J}@7\265\223Z\261\211"
+	.string	"=\222\233\306\032\214\233Z\251\007\364\337(\235\355\230\\\326\311\375\032\315\327h\314d\033c\242\227\363o\371\017\355\016\316\315\352\245\216q7\267\352~\322F$U\262O\315IvFWRQ\336\345\310\212\224\241H-\203\231G]\324H\314<\2264Gv\254\334 /\217Nl]\303\n\030\365Q\243o\216F\212:\252\215\332\350\356\230\266f\221\314,j\364N\214rA\277 \022\304\206\202\316\352\005\255\300\313\361\216\261\310f\217E\333\246\240\357\345g\223\271;5%Q\213e\365P\023=\260aC\215\332\211\021\320\314Z\001\200\244\250a$\247\214T\310\f\221\210HS\222\244\003p\"\221\203\265:\021P5DD4\243\2608\3319\200{d\260H\032\236\027\002\225\212\244?\264\020\232\"\214\254X\342\214\213\202`\242c\032w\0229=\006H\325\212UY\276D>!\363\350\315\004y\227N#\017\337\"~&\020d\335\004"
+	.string	"\273X[\326#\250\337m\0378\362\316f\356\311P\032\273\245\273D_\325;\360\354\202\025\371\306\026\247\205\215\303W\200N\227\275R\377\"\300\343\221\233E(=\360r\264?\001r'\037F\013a\266\021\222\212n-\332}\207"
+	.string	"\306\255\r\321>\001\272py\213;\244W\306\341\2679\233\017\344!q\217,-\360\337u\036k\372\235@\354,\034\026@4\362\204\377/\002`\r\032\274'2\225\031\215>n\244\r\374\332\212\204\243!c\022\361\343\263\234\315"
+	.ascii	"\321\bc\017\233\205\264\323\025\335\374\n\250\222j\326\232\344"
+	.ascii	"\006\257\323 \373\304\215\353\3434\016zDIZ\367:\n\035\224!\203"
+	.ascii	"\254\370Qi\257b\240Ubz\034/0F\217_0\303P\320\300\205\263\255"
+	.ascii	"\r\317\335u\234|\316\333.\322\250\216\362\216S\214\240?Z\220"
+	.ascii	"e\\\227\274LW \036\335C&\237\002\3007K\361\033\007<Zm\242W\213"
+	.ascii	"\004H\2261_\307\222\277\247\006"
+	.text
+	.section	.gnu.lto_schedulerUpdateEventTask.62.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\300\007\355)"
+	.string	"\232J \020Dp\336M:\3672\027;\240G\360\212IC\023\345(\225\250\005\230\r\037\2545\021\243\354f\031\217\3752\267\035r\n\270\324\264\315I\346\333,)\324\233\032\362u'\340)\376\300\270\217\357\3632d\t!\204H\231d\356"
+	.string	"\323"
+	.string	"\363"
+	.ascii	"\025\206\244\224\031_\343O\255:\346\004\3256%\031&_\373\275\354"
+	.ascii	"\376\313\036\314\356\326\274\214\300\206\324\243\034P\234\250"
+	.ascii	"\005\321o\331\253\355z\351z\345Q_\343\315\311\225\267Z\317\024"
+	.ascii	"\274\334\017(\227wy\361-\373!]\003\367r\367\305\356\356%\357"
+	.ascii	"v\267\265\304\340\031\32504+\027\370\354X\204\317\342E\032\325"
+	.ascii	"\260\"7\036\240/\237\310\363\356\253\334\212\360\307\031?\252"
+	.ascii	"\325\210\233\230Z\317\026,\003\364\345\236]\311|\211\036\311"
+	.ascii	"|\271\302\335;<\261\n\306\300\211\220\2614\270Z\353T#\271\360"
+	.ascii	":\3644K\262Y\270?\251tE\343\327u\350I\005u\376\270IJ\275\215"
+	.ascii	"\361Sd\034#\225t,)\356\214D.\311'7;\322\235Q\214\311\223\212"
+	.ascii	"\b\017 \357\"c\030\371Tk}\332\331\206q\310|R\325Z\227\213F\036"
+	.ascii	"_\241\357\256\217\335\025\333=\201\004n\304)C\236[\262\313\376"
+	.ascii	"\230\034\330\211\237AA\366\315\314\341\216\352n\223\215\330d"
+	.ascii	"\270U/\343\305}=)\0323\256\265~\365\201\346;\005\032\2350\006"
+	.ascii	"\264\273\277\217\001\242\265V\b{1\302\262\025h\331\313\375\f"
+	.ascii	"\363\345[Bz&\356\b\306s\273gC\356#\273'k\033\331Ey)\\\313\037"
+	.ascii	"\341\344u\360\265o\203{\371\372N^\251\037\377\004\317\362G\231"
+	.ascii	"\274\bL\336\003&\257\001\223\027J\307\373t\362\0268y\t\234\274"
+	.ascii	"\003N^\247\223W\300\311\333t\362\366P^\336\311\313t\362.\235"
+	.ascii	"\274J'o\322\311\213\264\343\r\260\343=:y\215\204x\001\230\274"
+	.ascii	"E&/\221\311;d\362\356L^!\035\257\316\344EM\336\363\3445O\336"
+	.ascii	"\022\345%O\336>y\331\344}J\355\353\245\356}\315\230I\255\324"
+	.ascii	"'\312\325\271\035\257\013\030\370E\f\346\313\244>\217)\034\263"
+	.ascii	"4\252\221\332\327\335F"
+	.string	"t\342\335\r\034\370E\244\276\332\227\340\334\314\265\031\366\227\024\331\232\036f\037i{\200\326z\234\313\t\356\313\266\203\007~\321\203\3712@KH\331\230\245/\203\346Q\323`b\n\035\325\013\240\217\372i\177\017\342\217\035qob\375\265RM\241y}\306\344\214:\252\245\372]NFi{\243\302eK\223!\210\303\361JJ\362>I\214:I\311\021lE\334\215\025\200&\221\256\211#\213\232(\tQ\027u\247\021\311\206g#\314\001\334\3070_\022\265\211f\203\213\215 C\3156\b\315w=$\324h\357\372\304'\272\026j\222m\304\325\224@k\r\323\365\237\244h\342\216h\357\232x\232\"9\355V\324\363\003\315\263\321>\221\314\354\263\311\2651\271\262{\001\313\302\007\274\nrMae]]e\375zU(\030++\310\325\365\003\302\300\360\303\352\312`\365\003\262\370\361\266\254\266\252B\254\300\nr\005\253^\fm\211"
+	.string	"^\005Cpa\001\265\264\272~DV[U\\\344\376|Z\300\026]*\200,~[SX\301\252\253\251\237\326\326\224\017j\263\\"
+	.ascii	"\265\246\270\262\262\264\246vg`'k\033A\337Pi\003\326C]\037!S"
+	.ascii	"\303\r\216\017\212\340@#8\320&\032\2160\006X\f\252\r4\371\324"
+	.ascii	"P}\036>\3311;\356\232\340/\240\2144\016\034\2379\257\247\275"
+	.ascii	"\334\221\3069\035\364\240\253\375es\032\264\257\035\364\0047"
+	.ascii	"\242\237@T\032\364\301\\C\220\264-.-\320q\276&\320\005\372D\262"
+	.ascii	"?V\b4\257\r\310\200\356\343\324M=\240K6\001\335k\247\356\231"
+	.ascii	"!6\031\272\275\251\005\354\021^i\352\273)Iy\335\263\360<(x\375"
+	.ascii	"2)\234\270#S\343yQ\317R'5S\227\203\210d\001\200\217\250Q,\247"
+	.ascii	"\fdH\215\224HA\222\202\2441\220\002\221\251\033=\021p\251UD\""
+	.ascii	"\232\024%\351\341\210X\022\242\232~\216\361\001\244\350\260\321"
+	.ascii	"\335X:R\271\345\0356\024\003\350\311\234\252A\303\353X\3134\025"
+	.ascii	"\252\022\304\344\360P\034\316.\261\305:C\213\037\177BA\004\355"
+	.ascii	"\330\024\001\272\210j\304\321M\213<[\211\272\025\230'F\247\314"
+	.ascii	"\366j\377?\256NZ\030h\354\"\344\223\210w\326\327WI\025\232\235"
+	.ascii	"\342^\021\210\215q\246\273c<\307\037\022\226\300\272\220\300"
+	.ascii	"\016\001\364\002\316\342\001\223<\245\322\301$\257i\372\363\250"
+	.ascii	"\230h\221r\311\250\325\241P)}\"\332\314\017\217\227\266\313m"
+	.ascii	"2\020\233l`\356\016\223\230\"\030Puv{7hv\350!C\277\031Y\321\377"
+	.ascii	"I;}\022\220\371\320\333\246nc\007\272\205v\373\"\006\240K\031"
+	.ascii	"\272\323\257\2007\336\300\243b)-\2730\235\243\311}9\224@\263"
+	.ascii	">\363\336\034p\005\277\341;Q\255\023\017\0075\003\326\377\224"
+	.ascii	"@\230\204\007q\266\331ci\202\177\001\372\367\235@\330+\350'\273"
+	.ascii	"V\303\315,\321\254\231\274m~\177"
+	.text
+	.section	.gnu.lto_scheduler.64.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\334\021\r]"
+	.ascii	"\312\235\374\"N0\320\322\031\016\255Q\267D\246\252\321h\332\n"
+	.ascii	"`O\212\233@>\222\376.\023\256+\334\306k\002\270M\177a\r\220\021"
+	.ascii	"+\200\034\206\301oPlf\"\257\031\307\331<\202s\026\303@\b^iS"
+	.string	"\303\006/\267\273?OO\r\210\204\354\275\245L2(\002\346\001\031\002\3733C\007e\331\026uW\303\006\315xA[\266\271\371\233\037g\263;\224w?v\325\334N\352l\266\357,\321\236\033\\\023\204C\373\322V'\016(\265\233&\001e\031\031>\303\324\351\366\003e\031,S\273A3\257\333\r\256\007\247\333cQ\222\t\376\205=\f\237\333\240\234\220\342j\267>\f\n\233RO\313\231*\342\226\224\030\332\352HY\017v\203O\177\337r.\357r/\027s2wn\260L\325\bV\326\362 \031s\365Ul\275\bu\330D\320{\327\227\2039>\214\020t\035c\256b\277\262\263\027\260\230\300\013\251M,t=sbKZ\351\341\302\341\216\217\303b\322b\256`?\270\263\347\0132\200O\213|!\025\305\212\343\231C\230\262\230\353\227Zv\206\307t\002>}\333\335\216\177#\302T\204\271\206\371\224\235\351\265\021\360t\017"
+	.string	">e\372\220\372\024\275\220\372t\217\273r\316<[\225\326\356 \273\324Y\327\265\251\243l\021\037\317\024\002\304\222R\022\322\221Q\021\321\320\007\241 \240\342\017q(\f\372\364"
+	.ascii	"\177j\2126\037\367?\247\021L\262\316\024\342\313\026\006\341"
+	.ascii	"SVE\257\215\217L\354\313\227\336\334XI\r\254\315\215\223\264"
+	.ascii	"\034IK\013|\204\n-\031S\303\211\032\326\224wfa#\364\307\365\225"
+	.ascii	"v;0,(\002v\364\316\230\300E(\210U9\021S\032\017}\260\003\243"
+	.ascii	"\2022\275Ac!*\017B\227\332\250a\273\035X\n\350\210&"
+	.string	"O\304\3749\205\201\256\225\366\242\035\330\331\325\300\244\360\317\317\351\371\027eh_\332\370\310\304\252\234\030\347\313\222\207j`NP&\347\222\205'\023k\362 \223\3730Q\003Sr\217\b2\261%\007\332\201-Q\003\033\343\037j\"\213\035\272#5\271\246|\016\311j\216\036\234^aJ\236\246\310:\270\2730aJ\216\242\003,\323 !\206q\241Cl\312\340\274\256\b7:\200\236\031\036>w\021v`M\320\241\2574\257;\317\311\260-\346\237\323\272\256\313^ab_\021\337\345\017vwo\367\307\030\312\243\033\020M\b\312\302\02398K7\365\270\205\265\252dt\352%\r\337[\221\212[\f)\257!\330]\235\207\3724Fs\227\244\022F\243\350\t\372]+lq\236\225\240a\364\221}x\336\267s\f\254\034\337k\345\324\247\022tZB\035\337\230\026\347\001^i\201\016z\274\0135\202\366\001g\303\353\266\305\355\270"
+	.ascii	"\256k\021\026{\276\243\322\201=\332\003\352\323\b\372ug'nX\226"
+	.ascii	"noH\314\027@\335\205\021\203\357\205\242?w\241g\036\333\263\210"
+	.ascii	"Q\233:\316n\263\035\242\276}\300\345\025a;\273\337\341s\206\354"
+	.ascii	"\321vF\r\276W\r\365\351\273\303\344\236K\267\261=\226\372\270"
+	.ascii	"7\0339+\313\2669Z\234g\207x\027\207\016\276WS\027\320\334\242"
+	.ascii	"\307\247\267\325Y\273\314-n31I>\022\266\241\354\ny\241\206\274"
+	.ascii	">P\336'!/\006B\336\013\212\274\026\024y{\024y+(\362\362(\362"
+	.ascii	"\356(\362\352\030\362\346\030\362\342\020\362R0\344\275ac\310"
+	.ascii	"[\003\345\2451\344\2351\344\2251\344\215\021\304;\001\020/\f"
+	.ascii	"!\257\004D\336\b^\fy]\264p\022\362\262\030\362\256\370\231\257"
+	.ascii	"\n!o\212\313}Q\274\314\267\351p\276&\276\346[\342o_\022g~G\274"
+	.ascii	"\331\3742\205x\230/\210\217\371.1\257\022\363&1/\022\363\036"
+	.ascii	"\ry\215\206\274EC^\242!\357\020\363~\030\362\n\ry\203\206\274"
+	.ascii	"@E\336\342\220\367g\310K,\362\016\177x\205D\336 \363\3720o\017"
+	.ascii	"\363\002Q\336\037\363\252(o\312\274\350\220\267\205\274\314\274"
+	.ascii	"\217J\252\203k\023\267\206\247\357\230\353W\236;\3533=S\345p"
+	.ascii	"\3765\377\231_\356\177\373\231\177\334\337\374\303\374c\3762"
+	.ascii	"\017\356\036\0079{%\312>,q6\b\207X\226\206w0@\033\236\027u6\001"
+	.ascii	"\375\270\237\275G[\020\367\036\255\302\035\241\223TVP\002O\301"
+	.ascii	"\"6\036/\035\216\245\362\350\n\372]\313\035\255\243y\364\273"
+	.ascii	"\324\202\275\243\203\332\034\301\001\331\267]\356 \271|\310\341"
+	.ascii	":\272\263\274\254\301\351\350%\034\005K\210w/\035r\264\216n2"
+	.ascii	"\310>\034}\243s\364\321^W\013\0244\216\2771#BA\237NJ\215^\352"
+	.ascii	"\033\3757O\257\214\355\301\3355\255\374\256\254\352\212\003["
+	.ascii	"\243\177wFss\223\254\363\245%\324f|6\357rt\342\265\324%L8>a\274"
+	.ascii	"\033\226<\273:k\177\302\035\rQ\202\332l\237Ta_\355X\306\313'"
+	.ascii	"aS)\337\3601\332\0328S\200\316*D9\202\247\330\303\203\273-\270"
+	.ascii	"\311\225`\377y\023f\350\316\226no\355\245\216+\354\347\004+\205"
+	.ascii	" \260<\306K\216f{\214r\224\302\367:JQ\237\322\350_Y\034\2763"
+	.ascii	"\004|\217\207\225\354\3341\205\225{\336y\312\022\017\2013;r\210"
+	.ascii	">\335bD\367\264O\247d\220H|ND%\321=\251\035%\r[w^\332\2668\317"
+	.ascii	"Mt\271\003f\330f\313\301\024\355\244\tC\0315\305\2214\315\310"
+	.ascii	"a\002N\"\r\351\f\376C"
+	.string	"TV\277\367;\017t\303f\004\351\344\357}D'?\367\2369lT\220\316\240S\263\332\324 \260\211\200trS/u\022\310b\300\276\363$\302\346\360\226nB\247n\274<4\301\037\372\253\363Q\251\250s\317\255\236\224\211\253\263\026\211;\355\224\231g\246\325\306\222\3006\333;\332'\203\313\023\200w\217*\034\327\370^h\363\227\274-O\023\334\324(z\367\310\3021\013\337k?\367\2335ax\362\351q\371\224\245\261\362k\263\275\nt\226\251\f\b\276\252 \235h\214\236\321\311]\"*\213nb$\312\223\035\332\254)\302v\326E\263P\321M\355\242\237\346\254\334\353Z\321)\332h\257\251U\364\212\376\fG\331\336\350\321\361\322\2642\243\273Utw\351Zr\267\026\346\"\002\\\327\225\305r\221c\313\201\001F\251(\253\246 SRRSPG\031\030\251\242\256<0\322\b\372Q\365d\205\002\215VWPF\020\\"
+	.ascii	"Q=Y\325\370Pu\303(\025e\303*\210\221\212\352\nj(\304\262\212"
+	.ascii	"\242\232\212\242\222\001\025%\365\024\004\253\201\f\214VPF \306"
+	.ascii	"\252\244\252\r\202DYE=\t\021\006y\242a\224\212\262\002\362d\244"
+	.ascii	"\372\251\272\201\365\004\304\330\300\217\252'\033STX\033\374"
+	.ascii	",\224\001TF W\031\0309\200\252j\n\022\365$\325\004EU\325d\200"
+	.ascii	"\210\235\352\300H\325d55E\325\024dj\275\241\274\330\323\343\323"
+	.ascii	"\323\352\255\305B\327\225l\201\307\001\351\271\220\204I\001>"
+	.ascii	"\361\375\225\272\3246\270\216H9L\236\310\316B\251\310\261\013"
+	.ascii	"\241\324W\0133\202R\357`\322\034*\231b \226\332F\312\274\001"
+	.ascii	"\317\223\253\263\220\230\330\321-%!uR\253d\220H^4\211Fj\r\266"
+	.ascii	"\252\340\200Db[\315\224\332l\001\350Zs\004\251E+5iPs\004\302"
+	.ascii	"\304Q\237\254y\3244\224}|cPm\242_\244`\312\276\255\273\346\322"
+	.ascii	"GC-\265Q\373\350\343`\324h\f7\360=\267:+i\213\272E\243o\220}"
+	.ascii	"ZW*Q\027"
+	.string	"5\322\\\3272\375\316\251CM\324Gq\272\372\2668O\222\271\\\205@7\324\227S\336\311\362&\204&l\005\244\017}\262-C\214\324\370\320\217s\364\214\222\016\337X"
+	.string	"W\310\360\216\320\242\020m\303F7\227\2725\270<!\267\257\240\006j!-_\307$A\335Sl\240b\177\240\334\3132\366\323Y\216a*\261\177\230\215\257\034\303H8&I\242>%\212)\347\360\215\351\031\265\331\036\221b\210\236\372O0H'\221F\227`\252\303\226D:\211\317\341\":\271(\021\210\236\303\346\205t\022y\353!:\271\365\022\315\201\021\265';\2649\272\256\353Z\364\374Wh\242I\033\032\212h\246N\376y\237364H\347P\211^\264\030\242Atr7\2047^S{\352\036\f\332J\317y\351p\342\0274\006i\027\364\355\316ZL@c\2426[\021=\354\253\301\251Y4\254a"
+	.string	"atn\226nC\026\004\201f\250q$$\025S\b\315\210\210\310HA\222t\361\004\304((\251\273\033\021\200\255CW%I\322\001Q\242\220t\020\355Hu\352\312\353\032t'\264B\334\333\023\246.\006\342L\372i\235\306\352C\314\r\224\202\036\207\224;\2640\302\201\2149LK\241\316\226]\303D\003\2217\025\232\353\375\230z\272i1\216\226\021(\215\003V\273\367\324\346\274\323s{\336\252\225\315C4\337\377"
+	.string	",\271\302<r\313\030\032\371\376T\326\017\365\370\357>\223\254\314W\333\302w\021\374R\305+\327\013hs\271\200\324H4\005'\2450\032\373\230\215\331'\246\016\rZ\033\270\021O@\003y}\316"
+	.string	"\210\236q\340*x\340\312\002^\230\033|\003#\232\024Br+\272z\307\177\020\332\272<\371\305\2471\205\321#^\265\005\001\276\357\246\246\377Vdni\021\374G\3157htF{UJu\202\207Ez\001\021\213\313\232\201P +\244\243\007m&\260U\212J'\032_\251\342\025\020\211\345\272\274\274"
+	.string	"4\341W\225\330 R\277\203\361G\253\024&\251\017F\265\202\013,h\035\004\352Q\304B\301E\313\360\035\350/\037qw\216\203R6oN\236J\347+\272\357 u\3450\033\323\317\\\306\244Xl\345\254"
+	.string	"\366'\242#{\363\rU1\344$q\254/\247\3426\276\317%\216ofe\232\300\334K\247\332\223\212\313\t\326\264\337\317\212\325\374+/$\232\3503\330\274F\013\216\211<\3543*zR\003\221\234\324\367\256K\257\005\355\272\327\321SL\300\017BSo\2034\036\347A\263\225\240m\365F1\334\177$3\005\353Q!\332\2539\323\241\020\205\316\210oG\177f\222UJ%\304\2622\024vF\235\265\006\240X\244\217\213\336N\321\324\364\027|\247\254k\206\254Gg\334\3241I\305\344\327OT\021qO\276\301Y\327\334\353\350\004 \232\252}\272\"\205]\251\305\203$8\364\203,\372\026\252h\032\260\204\350\270E\372D\034\305\266\263\265M\306B\321P\210\2518)\013\246\t!0kSrI0\251\275\327\2746\301\232\023\323H\315\032\232\241"
+	.string	"f\204\271\030\342\331\273\022\223-\371\216\236\207\224J\313!\216B\0162kG\024:\306\321`t\332$v9\002\344\374_\211\320%!\177z\220\214\002&\315\231\224\374\r\236\315\320\203\005\232\0304\210io\001>5>\247\325Z\245\257\361@pQg\257\254t9Fp\317N\315Rf\215\223lp>\227\r\232X\257\212\254\327"
+	.ascii	"\254\371\313\tY!\234Y\276-\274r\211 \036\376\013%\271\220\215"
+	.ascii	"2P\340B\313\252\220\241\202\241\006\302nP\314tY\r\f\202\3331"
+	.ascii	"Nx65\317`\362\004e\2726\214?"
+	.text
+	.section	.gnu.lto_schedulerEnableGyro.65.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375 \363m\006"
+	.string	"\342K,1`/L\007D\375\372(\f\333"
+	.string	"\034\216 \370\314Rt\301Em\367\252)iD;\304\270@@a(\001A\003S\224\255\002\231\002w@\355\277wJ\001~\234\t1@$@\n\317$\243\005\204\006\371\314I:\004\226\034\240)\037$i\312\246\356\341v\260RYR0(\341\237b|\220\207P\376\206#\252\367\354\321\257\230\307HKN.>T\260w\261\353\365 \206}\200\205\233\r\243N\243\240\347Hv\265K\313\232\304\021\016\333ol\331(\257\032;\320\3411!\322\355\256\204\031\267\376,\377\334\0052z\375\005\030\354\256_F+nx\333\005\266\245m\213\t"
+	.string	"i\3317c\361\2003\304\305\027\272\206\317\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_getAverageSystemLoadPercent.66.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375 \374\265\006"
+	.string	"\302\214.3pM\322\001\240_?\027]D\370b\343\360\206\301ap\024b\306\200j#\304n;[}\300d*\2130TE\240\277{W\262\302\370\177\374X\262\233\224)\005\226.oz\240`\230\032$\214\213pX\200p\322\303\270\313\201)\211\351\271\t\212z.\212{\345\244\032X\272\261/\362\b\375\216+2\371\353\315\317@o\251\001\032Vfv\254R9\354WV9\266\323\251\002'\035\354\236l\027#KY\223V\342a[cG\276\347\037\215\241\305\302\252,\037!\027#(\273\321\r\274"
+	.string	"z\313\023@o\332q\370\204\376A\256\260\371\220\\X\365\004H\330]\347\205e\334z\333\b\266\235\355\215\t"
+	.ascii	"i\331'\323\342\2543\202\206P\\\023{#r\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_rescheduleTask.part.0.77.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\335\002\305\022"
+	.string	"v\340qH\300VQ:\262C\016\2337d\007A\3224m@g\246\261\370\241\360FE1\253\311\n\026\250!\240\233\351\235\214\b\177\305\277~J\036\321\366Y\375\355w\205\331\034\213\267\355\331|\b\267Y[7\311@5\231\204\221M\344N)W"
+	.string	"a"
+	.string	"W"
+	.ascii	"\336\270\266\232\245\264\217\3438\262\347\300\330\264\373\002"
+	.ascii	"'\267;6\370\264\003\360\363t\003\337\247\367\002\337\247\375"
+	.ascii	"\033\266c5\313l%\037g\354qIF\334\222vW\374T\031\227]\245'\363"
+	.ascii	"\177\273\211f\213\271\006\260\241\270$p\017\200\204\3355\230"
+	.ascii	"\342\236\267\375\3006\006[3\004aP\f\310@N\263\001;\203Q\"w\001"
+	.ascii	"\314\375\300|\232\375\300\2765{\022LL$\355v\227\302q\317\341"
+	.ascii	"\363\350\211\235\347%\021\214[S\303\331\341\315\357\361u|\207"
+	.ascii	"\354<\257/M\315D\243\261d\267;.\370\364\204\021\224\376-f\207"
+	.ascii	"\241U~G\007f\325\201!\311\355n\004\360\323R~\214=\007&r\311\240"
+	.ascii	"\274\332 \\\3624\251\037\372Y\330<A\232i\214\324\033\253wow\327"
+	.ascii	"\032\303\236\322\336w~\275\356\226\037\377\203\007\024(\355\236"
+	.ascii	"XRZ\027\023\310\306}\376\240?\367\353~\243\277\350\237}?\310"
+	.ascii	"\211|!?"
+	.string	"2*\212\262\023\032\322A\331\t9\364y\017\337\307\1778(\025\311AEz\256\r*\326Jk\245\341\265r\tU\025X\\\250\227\317\251\224\326\312C\b\325\252C\312%\272\254\240Z\304T\313%\246$0\353\303\252%\276\260X-Q\336\007\211l\220dt\306\252zc\333S\233\345E`\002\214\354.\004\237\210\210\026\277\306\353\373lqD\205\214\\2\203\253z\372\243[X1\304\tM\223\231B\250\321L( &\020!RT\324\264\330\220\002\0312j\007\022 \347\261t\252\362--\254\377\016mAG\325\231\241)P\202\222\232\354U\237&M\334\241\341Pcl\212\356\024o\037P\301>\273a !\352^!\376\016\245\340C\342\tX@'+\374\375\303\0253\275\216\304A@\332\001\0036m\206GG5#B\360\274\201Z\030\261\240\312\202\306\016\244\033`\007\277\357\366umn\224\2343\b9{\266m[\330\256"
+	.ascii	"(\305\2625\310\303\0324"
+	.text
+	.section	.gnu.lto_setTaskEnabled.part.0.78.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\221\002=\025"
+	.string	"\246\347\213J\260\022R:\340D\016\230\017\225\003\273\024T\326\034\270\245\256\237`@\263\003\361\335\327\036\\(\r\341\257\337M\225\3536\333>~{\375&B\327\257\353\013\177J\317C\372\316\271\034\222\177\364\005\255q\232\213\321\251}kd\223-S\n|"
+	.string	"p"
+	.string	"q"
+	.ascii	"oa\233\027t\317\366\361\262D}\f\0175\304 \265V\331\351$\361\336"
+	.ascii	"_\256\026I\307\271\260\236\177\342Mxd\375\2040\177\225\270Z@"
+	.ascii	":U=7 \336\032\023LI\t\231\204\340i\212\tk\226\034E\200(~\317"
+	.ascii	"\021\314\031\031PA\001\241Y"
+	.string	"\272?!\316G\230\020\347s$\301Q\254\t\021\372F\005>#\254\356\364\265\021\312\354\0168\254E\241\326\352\307\350\334\261\333\366\261]\301^\021\001\277}\037\306\223|'\307\232xg\332\355HYo\202\276\322\227zg\332\275\322\004_?\240\034\252Z\313\006\247\236P\272\210\367\211<;\026\363\270G2J\n\357G./+p\\\033%\245\367#\227\221\377xrq#\202\353\324\273/y7z\031\313*\fz\327\376\213\027\365n\364\342W\255=EO\265\226\016N\375\300uJr\021\362t<\001\362\324\016U3>\314\235t\332\330\205\034'\202\240\035t\016\375t\250\235\377\343\025\333\376w\352\333\310\3239%\230\310\211\331,\317\357\214Te1\276\366\323\276u\330\377v\336j\3077a<\377+\236,\2459\207.\360\027\362\363*h\n\251\207o\257v\016=a\037\353\364\261\3115I\327\364H\377H\327\223\256\367\345\177"
+	.ascii	"\006\026`\325\n\314\302\252;TF\2127\005\266\334L7\252\324X0\314"
+	.ascii	"Zj-\025\013\266\334LG\232v\202\253\261\354Tj\032h9Y\313\312l"
+	.ascii	"\203\214\206\313\311NJ|\343P\303\311t\267\033N\026\263\275\367"
+	.ascii	"]QF\305\230)\363\272p`E\3217a\224\226t0\271\004,\235\366\214"
+	.ascii	"\266\3779$J\250H4\244C\324\232C\347Hr~\310\256\275F\316Uk\205"
+	.ascii	"\340\323\320e\360\177v\344)9[INVE6f\200*\3109t\200\023\343\234"
+	.ascii	"32 `\002\021df\007\255\366c.I\202Q'D\032Dhw\340J\246\261\255"
+	.ascii	"`\035\257\306\245\321\023>\206Iw\342\267\335\263\216x\330x\023"
+	.ascii	"\317=\314\312r,\207\350\035f\205\353\265\305\376B\260\027\177"
+	.ascii	"\r\220\305\340\030\302\275\210\304\246\0271m\001\177-6xe\362"
+	.ascii	"$\372\314\266\300t\336\265\254Y\336\343\372\321\260@\bG\247\032"
+	.ascii	"Z{\300\343>\345\341o\260V\345\001"
+	.text
+	.section	.gnu.lto_getTaskDeltaTimeUs.part.0.79.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"\315\n"
+	.string	"\026\225I? \251*\035\017p"
+	.string	"\200\001@\023\204\017\343L\321\331\362\001\344\016\362'\330\001\034\276\321\024\326\210\032\306\252h\206\310\r\353B\241\272"
+	.string	"A\026Ll\001\303G\036Df\244C\341\261\310'{K\231R9"
+	.string	"8"
+	.string	"4"
+	.string	"\036\374"
+	.string	"\244(\003\002\204\300&\354\356\366\b\361\206\354\021\236!{\324\223{\327\204\236\237\250\224\351\372\327a\205\b\022P\251\222\247\345\220\242\331]k&w\274\355\t\333\031\373\024\001\337\177\212\003\346\301\356H\214\302\252b\003\002\366_$\273b\227\354\2125\377\3355\202\337~\027k\3365\362\302\356\312\301\202\335\357\362h\t\355\321\376\001\022\211m\277\300\r\224\034\266?O\340i\273\233\361a\036 _\300\243\337\221=\252>@@p\312\230\265\274\332\033]\036\225\312@\005\242\246\324\226\025\036\356\356ZYvL\303\230V\230\316\007\235\212O\267\021e\346`8\017\006G\307c\301\351\266\214\213\rh\343p\335\206\211pH\303\303m\242P\210\333*\266\363p\225\345\277nIU\250\"j\315I?\254\252-\333P\301\352*\023"
+	.ascii	"hm\371\264\354\343X\336'\016\224\277\240\001Q0L\256\320\313\020"
+	.ascii	"j\253\240\261\232rU\320Y\225\0034\271\211WxZ\210\324\024\232"
+	.ascii	"\227^[\306"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.part.0.80.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`D\001%\f"
+	.string	"v\226N>\020Q\225\016(\214\024 \270\036(\351j\322P\355o\322\262\225\232\367\2232@>`\321\240\333\3078\265\177t\006\f\3326fv\002"
+	.string	"*\240T\001\025\356\001\330\r\270\0368e\255\222\275\245L)9"
+	.string	"<"
+	.string	";"
+	.string	"\004\256C\373*\333\241\322\356Fo\266\214s\251}\253E\207\r\032\273\033\017u\304\267k\276\315?\353\021\222It\r`\372\360\034\360\007\240\301\356\032\002\342\206\267M\261]\261\337\n\252\351<\367_\200\001\006\035\273\036>jl\b\370\242\204\355\333g\205l\211\304\231\347B_\201\036\267\246\2223\355\247\270\212\355+\220#\273\":8v9\005\207^"
+	.string	"9D\360\002\327\341{\030\242*\326\235\360\263\313\346|Ev \265\273\025\177CC\005\237\304\241\237\341:\244\304\2301\312\017_y\265?\027\362\244T\2543\341\301AE\251(\353\373[=\331\232\206\232~\232\016\030\007\233\216\305s\3712\3212\022>\230L\204K'N\320X8\361\242u\342$\2013\n\031-z\262L\213\222\277\325\223\037\300\360\030\351\006\253*\312\206p\016\317\004*\326\2514oYx\212u(\316\342\366\346.\002\036"
+	.string	"i\355\353Z\033\325\3130nO\300\032\032\214\001\373\300\300\300|"
+	.string	":"
+	.string	"\013"
+	.ascii	"4V\202\301fY\r\002L\275_\t\b\210\202a\256p\023\266\330g\2348"
+	.ascii	"\202\351\234}f\347\2026\235\006N^\314;-M?\241\214\001"
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.part.0.81.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\025\n"
+	.string	"\246\223D9 \261\322\001 \320,\272\240\202nTJ\265\021Y"
+	.string	"\320\257c\037"
+	.string	"v\354\2132\315b\334xog\300P<\314\275`"
+	.string	"\202\311\220\226;$\320#\240\034\360\3716\310\336r\247\0242"
+	.string	"2"
+	.string	"4"
+	.string	"'\266S-\203\266\314\303\330~%\306\203V\263\273\335\247\222\034\274F\t\372\237\235\303r\251\256\001.\220\307\201K\200\207\335\365&\344\236\267\335`\373c_!-&\266o\177\226\262;\235O\3331>L]\206\222\341\272Z\216\321>\312S\300\313P\346\354\216\300\260\354\206\013\237f\330|\"\274\200\373\224'\340>\355\007\264\r\f\277\344\323\327\340>=/3\253x3\027\257\366)#\236\025U\300\205\246\326\241\252\2500\253\274\334\335\265\276l\215\216\017\377s\006\016\266\335\217\233mEf\"\b\212\022\310\3049\344\371F\025'\321H\"T\352,&@\244.\364\225:O\202\275\213\321\327\231<\357\353:\227\253/G\334j+\345\260\252\302\354q6\351*\336Alw?~\022"
+	.string	"i\355\223\231\r\225e\030\267G\214!\251\207"
+	.ascii	"\001Q0\314\256\320g\270\236\263\317\354\\`\323y\347\262\300\311"
+	.ascii	"\213y\247\245\351'\2241"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\345\005\005\027"
+	.string	"\206\242\204J\260\330M\007|qz\271B\025[\007\032\353\037\177\236\f\022\342\302u\224\033\360!H\201\364Q\330\017\227\374&\026;{\266/\234p\255"
+	.string	"\\+"
+	.string	"\217[V\267\261\201\2646 \263bB\235X\347\210\366c\334\250\361\265\335-\311\224\002o"
+	.string	"q"
+	.string	"s"
+	.string	"\016`\302\006\317X\f\236"
+	.string	"km\331Q\265\340\007T\023\350\244\207\202\257\251I3\244"
+	.string	"6\001!3W\364\016I\3604G\317K\214\236\225\344\236\263n.\212\356\212\236\223T\326\235?!\353L\\\310:\242\240\220uC@B3\366\223j\211\023t"
+	.string	"\250"
+	.string	"\316\300\317-t\346\336]\037\004\341E\321+\305\374\314XN\r\273\367\336\236\367\251\314,F\t7\223\335\305\263\325\322\363U\213\347\037\213g\252\025\317E\372\336\313l\243\342\271\252S<\373P<O\235\250\205H\232\262\3040\361L\244\226x\244J\202\026\216\370#\021o\024\342s \276\350\303\237\036\336\354\360D\034~\310\203\301`p\303\013ix\233\341K\f\337s\341y,\374N\255\360:\024>\247\262n\002"
+	.ascii	"\t1a\004\231\020\302\337<x\033\245\267\3250>.\242d\2177\257\033"
+	.ascii	"\006\325\226\325\270Sk:\336\276f*SP\270^r|&\235\221!wcO\366K"
+	.ascii	"]v\261\236\370\363a\342\370\315\304q\245n-9\202Wf\315E\264;\n"
+	.ascii	"\212F\324\254\346\"\257\353\225\221)Gh5\027\323\246\301\262a"
+	.ascii	"%Gs\331\257iZ^O\271YQ\f\214\337\226z\235\222\343\213\313\276"
+	.ascii	"Z\027\203\215i\363\334\330\222q\306<\314\004l\330\017/ [gB\233"
+	.ascii	"\246\006\260Ii\375E\3329P\274\256\323:\315\327\215\203\353\t"
+	.ascii	"\217\230u\362\264N\222\243\221\365\321WZ\0272\243\311\264.K\217"
+	.ascii	"\254\313|\355\242c\013Hi\275{]\223\202%\313\264~;\255\3270\351"
+	.ascii	"\256\342\024\344\251\204\215_%\314\006\344\322m=r7\312z\315W"
+	.ascii	"x]Rg\351\355\233\341p\256\204\363\346\005k\2501 K\244R\202\246"
+	.ascii	" I\2469\340\002\241!\342\034\021\260\214\204L\232h$\230\2604"
+	.ascii	"tH\363\371P%U\306\337\202DETX\"\346*\001\fA0\230\243\030\213"
+	.ascii	"-\367v\022\"\303\r\013\f\357gX\266\017qV\371ws\306 \261\307d"
+	.ascii	"\361\246\313\027\023O\313$4\2150\223-s\302\226\323\250Py\225"
+	.ascii	"?\352>\031\255\332a\254\305\037\315\336\370\241\316\346\327\""
+	.ascii	"*2\213\222\302\375\032;\\\335\022N\330\235[\367\t\330\3521\217"
+	.ascii	"\236\275=s19\r\177\252Q5n\353\230\\(L\231\037\255\350_\353\341"
+	.ascii	"\312\202\177\375\262\016\0038r\r\341\356\313\231\364L3\212\377"
+	.ascii	"\251\331U.\310.lC\3213\271\003=\201\3512=\335\201W\003"
+	.text
+	.section	.gnu.lto_.refs.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"\305\t"
+	.string	"\026\332E4`i\222t\300hX~\037\256\242(\212\242(\212\242(\212\242\nq\r\375}\374\037\303\353\377\177\033\277U=\232\265\326\022B\033\366\333\326Zk\226\020\262\267L\0018"
+	.string	"7"
+	.string	"6"
+	.string	"m\370\310+\236N\361\374\204\323+\316K4\375\241y\n\323#\346\241e\006s\004\353\020\330\033\360)\253K\353\243\354\220\352\023\325#\252;\325\037\371\016\354\r|\326_\370^\004\004\326\213\241+\251g\324\033=@\255\334\002rt\r\200'\364\244\003x\337x\275i8\323P\262\206^\227\264\016i\270kx\323>\333\367\035a\274\336\267\r\301\363ut=E\320\325+6\254P\367\351\001\212\211\336\245\006*\035\241#:{\027\300\227\346\027\363\351|\237!\324\216\372\225\217\353\207\274k\207\033zY)\235\261\276\332\023;\256\336l_\206\031\364N]\320\257\300~\n\323?a\371%H\375\b\322\177\021\365!D\377\203\366;p\375\006\356+\355%\\w\230~\261\370\234V\340X\262\274c\217P\023\344i\021\013"
+	.ascii	"\035#cgX\312\335\227fR\222\036\207x\223\n8\"\302\027\242\330"
+	.ascii	"U\f\316\n\024\032"
+	.text
+	.section	.gnu.lto_.decls.9fbcb7717248039f,"e",@progbits
+	.string	"(\265/\375`\3222]\320"
+	.ascii	"J5\021DX \212IH\351+\320\335Q\213\023\305\253p\217\376\341m\215"
+	.ascii	"\016Ki[\345\324p\300}8\330\255F\231\3012y\024\273\304\251\376"
+	.ascii	"n\007\2002%\373\271\253U|\223\212\361\001\303u\221\275\rz\\\330"
+	.ascii	"\355\371}\325j\203\256Q\372%\224\315b\366%\024\217\342p\034\265"
+	.ascii	"~\357-Ss\0039\004^\004E\364\004\200o\343\326\227\254vCu\213M"
+	.ascii	"X\222\216,\230\265?/\033\0267\016\255\345\335\327|Y\254\017\004"
+	.ascii	"h\237\r\227\234\2316\335!\272C`\260\251\032\2160Yo\315\364\362"
+	.ascii	":\316\315,\310\342\316\353\t\224q\355Y\334w\266\355\032\357}"
+	.ascii	"\327u3Mi\337\341\234\231\335!j\272C\274\264\365`\026\t\342\333"
+	.ascii	"\261\265\261\264Y\r\221\324\022(\266\030/*\254. \353\337t\177"
+	.ascii	"\207\265X\317]'\0214\237\345,\355\020\004\334\233\256Y\271\367"
+	.ascii	"\334\357fr\026\3139WP#\326\226\227\203\305\327\322f\377a"
+	.string	"X\264\361\250j\2557\026jm)M\355iN\307\335\203\020~\227D\244b\030\350I\r'\213o\227\326\016\344\300\316\t\336:\327wu\355\240q\202}C;\351i\006\375\344\335\326n\177aJ\263\324bu1R\004o}g\020\274\201\201\235A\360\035\267\3364N\320\366\207`\257\365\222\236\276\255\231d\033\233&Z\242\324,~\267\2553\b\337\026|\017YA\264\326\372~Z\337G\353a\254\035X`\275\nk\023\351\"=\025\321e\357!-=LS\232\311r\226\332\3140\225\224\304Y|\006\254\377\311N\001\221\034\302q\326\267\210\240M\213\b\336\256 \032'\210\245\324\306\t^\3328\301\265?\004\241'\236\022\240b\211\304\034\220\343\023\003\033\244\271X8C\007\354\013\255\306\305\266 \264\261mY\260\0168\003\376\033x\274\003\322\234\213E!\377W\006{\202\334\377.v\306\004\374@\241\013'~[\302oMt\371"
+	.string	"\376\373\367wU\013\226%\201\352\017\374w\256\365\250\344\270\314\177M\374\215\303&\300\t\001\177\371\257\224\277m\330\021\2246\370\333\353o \277E@\377\360\371\373\310\226"
+	.string	"\373\314\177C\374\355\302\337\367o\026\034\360\267\375\033\305\3370\177?\340\357\230\277a\370[\346\205\277\377\367\313\337\020\370;\205\025-\330}\203\3776\371\273\001%,\200\001\177\2330\364\232\377\232\005\340o"
+	.string	"\374m\301\337 \004\360\"\370\367\214\2059\300\377\n*\360\267\b\326\t\f(A`\260]\255M\035\377\367\311\202\320h7\372lj?\370\237\301\330\377\230\377\002\351\350!\302\377v@\310\203\377\345\200\212(\315\177\207\277\035\321\217@\313\303\177-\360\267U\326\327\377N\300\002@\3470\377]\341\267\035\374\226\203\337\032\340\267\001\370-\315oc~\033\374\355\375m\377\035\370w\227\277\253\177k\371\233\357o\275\277\241\177;\375\215\367\267\322\337?\376~\376\235\345o*\177C\371\233\355\357\265\277\225\374\215\366\367\331\337\323\277\213\374=\366\367\220\277\205\374\r\3667\220\277\243\177k\375\235\365\267\325\337:\376\246\372;\307\337O\177/\375\215\364\367\320\337\316\277\203\376n\376\315\374;\377=\303\3370\376V\376\215\374\373\305\337\306\277{\376\273\360\177\313\337\021\370\333\204\277\021\3607\005\377\347\376\326\371\233"
+	.string	"\177c\360\367\005\376\266\371\233\305\177\025\377\355\376\266\300\377\270\377L\376\347\375\177\362\237"
+	.string	"\377\313\376\216\340o\n\374o\341\357\t\374-\201\277O\370{\204\277A\370\373\203\277=\370\333"
+	.string	"\177\217\370[\203\277\013\360\267\210\2773\370{"
+	.ascii	"\177\013\340\357\016\177\337\374O\361\277\305\377\267\377\030"
+	.ascii	"\004\006\006\006\3761I\377*\374Cd\020\330Z\351*\321\314g\231"
+	.ascii	"^\246\372\352^\272V\373\0073\363\231s\246\361\"\315O\240\231"
+	.ascii	"`\2774M\337\276 \337\377\023\370H\363\322-\013\207\225+\215\211"
+	.ascii	"\343 \362O\315\271)\265l\200\024RSj\311I&\225\227M\255e\207g"
+	.ascii	"\226Z:\311r\356\220\233\315\245\t\320\334\301I\226\221\262\214"
+	.ascii	")H\235\245R\313\334\204\346\016\271\231\231 \234M)$'\031\023"
+	.ascii	"\251\203\223L\n)\223I\345\233\334d>\205\232\371\331!\223I\351"
+	.ascii	"e2(\322\215\223\f\212\344$\223jj,'\226*R[\326\324U\3539\233\331"
+	.ascii	"\250\310\211\371\274"
+	.string	"\241:\245\320L\227s\237\005\345\347\0059;A\237t\314\245V\003\242\032\001\2411\241-\3159KP\0044\005\315M\252\263\013\232s\027P\f\271\b\204\245\224\232\257\232\272\244r\312DA9O\220\2459\027\345\274\354L\3159/s\316\302\247\2234\347\246\033g\264\250(g\246\234\242\354\264\\\013\312\331\236aQCr\222MAu\326\312\310\242y\206t\331\321L'\365\\\311\226c\231\210o\215\"\325\330\263XJ&\224\372!ECJO\255\024\273\005\343\314\231\006\b\037\3229\260j~>G\034\303\331(\007\310T\242m\026\3121\021(\315e*EI{k3\031(D\270\270=\251\322E\237\240X|\303K\020\337V\026\213m\023\241\026u\353\357\310\372\226\262\241\340\222C\265)\251\232f\221X&\026\315\256\331$\326\315.\261J\254\232m\353\251e\263G\322\304\2128\363Bh8{\326T&\022\276\376\362\330H"
+	.ascii	"d\353=\02594%U\323\330\250\fUa\263F\372\256\346\346\f\345W\305"
+	.ascii	"\254\331\232zf\302\222.yl\315%0\312fmh\263\246\236e<%\204\217"
+	.ascii	"\254,\005\345\340\213\2456=\005\310\310I\253l\372\004\nli\261"
+	.ascii	"%\303a\351\310\342c'\261,c\266\210\035b\245=\265D\254\020\264"
+	.ascii	"\026bm\250\213\216\265Y\rL\316RW\242D\232\213\364\002,MI_9\032"
+	.ascii	"h\240A0J\325\226\262\030|,\264v\276{\353o\303\300\256\\\221\023"
+	.ascii	"b"
+	.string	"\361-\330o\277l\020Ke\233\207\023\007%\213or\316\371\207\316-\020\232\261\260\267<\213\003\020\350e\245\366\2325\320u\321\005\367\246|IqmM\261\201+\312\342\333\255\337F\255\017k5\003\3159\202 \216\352\2228\213c2\264?\004\255\226\316m\r\037\202O&i>\223A\362\326\245\006\213?\364\207\036\326\nKi\021\335\310\322\253\026Q\245Xo\301%\031\177Hx\344d\341\022\005\356J\004M\016r@_V;n\230\035\222\225\234\227,*&<\035w\3020\267\251\263*\252\231\276)\2753\213\355T\216L\215.3?(+\324FY(\233\243\247V\352X\232\263\216\224m\262N5\344\331\032O\226\251fy\223\201\254\200Eu\244l\222e\272\322\250\320\254*\210\216\224\275\321oM\265\312X\306\2274G\246\212\232\f\265\030\374\353fq\300\310\361=\235%Y\177\247\353/\330jmX\245\236Z`\227h"
+	.string	"\203"
+	.ascii	"\376m\255o\013\202\035\330\026\004\177\261\326\022\215C#\203"
+	.ascii	"\265\311\004\211\230\305\277E\262O\016r\037\r\026\333#iNc5\265"
+	.ascii	"\266,\376\245Z\337bM\336\322\324\232\355H\025\224\274\026\033"
+	.ascii	"\363\213r\371\213\332`\244\315j\2327\271YU\215\376\226\006Kd"
+	.ascii	"\201\354\220m\332\334]\254\323\026Y#+\3032\355\214\006\354@\273"
+	.ascii	"\264A=\265B\177\373\365\337s\24497\225D\241\322l5MiF\212\251"
+	.ascii	"R\322\224T\375 \007#MIU(V\250\243\364\333\225\252\2553\246O\204"
+	.ascii	" y\332\035{B\020d\005//\347l\303Y\016i\277\007!X\241\206\353"
+	.ascii	")Me\312\327JZS\322W\316M\235"
+	.ascii	"\275\2566\225I\232i\304L\2174%U\321V\263\251\224\017\256\264"
+	.ascii	"^\220\0254\261\277\253X\241\266\322t%\202\23603d$\311\313Y\372"
+	.ascii	"\226\376}\344V\250\223\264\331\035{\346\346\324\224\003\224M"
+	.ascii	"\227\242Ts\226j\220\243A\212\274Efq{~\353\022W\020\241\242:\267"
+	.ascii	"@.\026\277Fi\275\323\211\207\232H>\n\356\310\201\007X\315\231"
+	.ascii	"I\204\360jo9\206\205\216\207d\330\220\330]\211\260\031*\353\003"
+	.ascii	"\332\"C\006\016z?\233\202[\250s`\325\232\033gE8\250\337b\260"
+	.ascii	"\306\202r\274a \f\324\027\334\362\f\336\300\374A\003/\361\222"
+	.ascii	"\004\037\231&,0\360Rm\t\016\231\332Q\343\316\207\237\337\355"
+	.ascii	"\3229o\260Emh\207\022\024\227\337.f6FU\314\362,\276\177\026p"
+	.ascii	"\013\220\311\026\032\247\365\267\257o\265\2327\023\270v\320o"
+	.ascii	"\013j\321\302G\223\304\2714w\205\217\357R\3411Ee\256\210\240"
+	.ascii	"D\336\364\364.\225\036\324\212Y\230[\rvv\027\257\211t\016\354"
+	.ascii	"\013\357=\211-\271w\277xwWu6\262\314\020Y\261r\263\254Y\220D"
+	.ascii	"e\232\2008\377\260\374f\251y\376\361P\263\370^\261p \224xU\321"
+	.ascii	"-YF\025\321\315\255yI\370r\310\331&\253P\026\273*\271\231\f\007"
+	.ascii	"w\251\254Y\002 P\233\262\270\032RS~\251\\\013T.*n\002\246\035"
+	.ascii	"M\342\2506[c<nH\261dW\357\311\tU\n\236\233\333\205\202#\230\203"
+	.ascii	"\f\260\260\373\366\013%\n\b\321\233\305\367\311\3330\024%\277"
+	.ascii	"\273\353\004k\351Dt\235\334\033\344\252\030\241\331\251<Cv\027"
+	.ascii	"dy\233\334\300\204\311eS!_I\213\256U\260\222\364\261\275\r{a"
+	.ascii	"\021\342\203LM\355\256\251\200s#\206\211\026/\257\265\206\361"
+	.ascii	"\3015E\224\245D\311\245\352%\2659\260/&JW\226n\254G\216\\\264"
+	.ascii	"5\333\200!\"\207\244\354\"\371ES\001\205\210)#c\375-\353{v\317"
+	.ascii	"\372\315J\3633\210\007\225\361*\242\272\253[\337\3756\235Z\247"
+	.ascii	"\273\350\223\365\277E\212X\247\230\036yc\353\330X\317u\316fw"
+	.ascii	"y-4d\207\303\326:d\310\0252w%\372\214\006~Y\255bbW\210\210\277"
+	.ascii	"<\007V\2551\242a\353N\210\005|\313\361V\344i\375\375\352\013"
+	.ascii	"6\275`\326*\247H\032\203\264\276\255Up\353\002\331\272?\270\270"
+	.ascii	"\356\2175\2659\260j\020\271!K\327\353\367\207\360\254\013W\021"
+	.ascii	"\213o\227\205[\235\0209\302\321w3C4\230@Y\374\030\346z\230\272"
+	.ascii	"h\364\207\212\227P\375\232P\265\264n\326\2323\020\355\362\221"
+	.ascii	"\244\245\t\017\0367K\205\007\244\324 "
+	.string	"-9\t\303\372\315\272\263m~Z|\2006pG_\235\021+\253\267\275K4l\375\210\276:\256\216\267aiF\022\036Ia\264\326\251\251KU\201\2749\260\257UJ\322\320\324\265\374RM\351\322:2\025usDA\241vuQa\025\020.>\213\017\223\327\257n7\356\323\215\353\324\324t\235\326e\316Ki>\222\300I\020\210\313\210\013\307\257S\313\030\2221%\310\372\325F\215\273T\343*\335\244\233t\225:?\333p\2349\2266~\225\232\355\345\211d\032\005\016\246\215\255ke\256\027\322\255D\027\211\350>\2039\267\024z\364\274E\277E\367\331\371\2313\223\002\220\324\345e&&\0210^]\3144{\364\373\264r\325\252?\213\257\221\205\023\336`^-\205N\326\013\213\f\r\365\b&-9\005\355p:\265b\372\234D\313,\276P((\250\315\360Mnb}E\355\016@\252R\226\346m\266\231\n\231\211T"
+	.string	"\257\274\033F\274P\223\240iF\230\227\331w-\315G6xO\037~~7\337C\316\031(g\250\254`\r\265\300\337<c\204n*g\261\345b\001\271\364\334"
+	.ascii	"\273\314\004u\005&\301J\242hX\261\330\376\311\270\001\326\240"
+	.ascii	"\204\025W\355\242\263\370A\246\352\324V\373.'/\371\024`\003:"
+	.ascii	"\007V\r\322\320\327\027\225\027\3148\364\324\342`\301<<_0\362"
+	.ascii	"\224\367\322\267\267\327o\366&7\205\240\242uy=\265y\375\006\303"
+	.ascii	":te\225\227\237\322\021\177qrw\327l*d&\r\035\033\317<\342/F\326"
+	.ascii	"\333)\226"
+	.string	"\312m\225W\261u\315\224\227z!De\246\247\210\337f\271\255\373}re\345\314b;g\261tYUMa\271\322c\007\022\220=\262J\264\204-Y|Kw#\0372\336,\266rmV\263\344G\224\303\0062$\207*x`0\036}|\216;\022\274\360\331\201Q\032\2137\006\317P\331SD\301\006y\334!\261\323\002'\006\317\220\210\342\305\361\310\002O\361\305\214\017\321G\370\0308pa,\"\225I\022D\236\237\236\035c\221\0042\371C\002\202\236\236\037\243\361h\024*Y\0207PL\0065pD\306\240<\032\205-\206\304\036\254$&}\210$\222H\"\214\"\222g\202\344\021\271S\364I\312\220\034*I\354\264\200@hBItA\301\021\031\303\205\f\214\222\230l\321\342\205d19,\301x,\236xQ\001Q9DA\334@\321\247\250|\361\202\262h\\\201fD\317\360\204\222\230BFItq\243$\246"
+	.ascii	"\201\212\017\311\025\"xq\364\220\342\203\322H\334A\022a\310\351"
+	.ascii	"\220$\366\274\360\031\246H\2720\026\225\305a\004rx\206G\026|"
+	.ascii	"\210\312d\214\024\312\031\210.\300(\223\310\"\nF\"\022\371\263"
+	.ascii	"#\203C\204q\364!\242\220\341\3411\261&\215\305\241\322x\244!"
+	.ascii	"n\240\230\202&y\204a\0069$\366\234 \376\020\1772\020sA\001*H"
+	.ascii	"\022Q 1\360@t!AM\007\034(\221\303\027\034\020\2218-P\240\302"
+	.ascii	"\202\026B$w\212\312d\212\237\235\236\341N\004\312!\317\213\025"
+	.ascii	"9.\214E\243\361\007\305L\214\013c\021\005\317\220\250\002\214"
+	.ascii	"Q\003G\036\245\361\347x\342\305Q\231\302Cr\305\021\031#\005\245"
+	.ascii	"\r\017\362\270CD\361\300w\212H\242\221\350b=\b\"l B\211\031\204"
+	.ascii	"/1B\007#t\020|\211\021ttF\020Ag\275\b:\367;1\206H\244\t\342\017"
+	.ascii	"\361\007\0025D\026<+\304\360\020{004\236\220"
+	.string	",\302\364tP\2628\2660\256p\242\305N\007\017C\b\224,\224F\"\214\023\210;C\244\n\234\244\213aO\213\027%\013\017>X\241D\016\225Iar\305\020\371\303\023\243dQB\310\263\202\222E\3601\204\370\361\005\021IBy<\"I\310\364\f\225G\345\003\310a\f;\230\3503tA\206\344P\005\006~\2222=\307c\t,^v\2101\354\300\354\030\177PX\223+x\216E$\021\206\022Jc1\250\034*\22351\224E\344\261\210\204a\247\35034\306\340\261Q\262\020AGi,\376\254I\0234J\0262D\345\220\005\031\222C%NrE\317\320\350\242\230\342Fi\202\207\210,&\211&(\223\303\036\032b\317N\214\023D\027C$\021\206\211\234\241\262\207h\202\317O\n\027\306\"\214\243\317\003J\026\312\365::'@\254p!\205u\207\003$\261\347\207\207\030\303N\222\204\2618\364!\261\203L\222\340"
+	.ascii	"Dr\005\321\247\250\302x,*\177v\2103\2340\303\320\307\203\332"
+	.ascii	"\3155\356\306\232\322\326J\330#\252\302J\272`me1b1F\303h\314"
+	.ascii	"\247l\203\207\317\360\031>\002\363|\362\205\320\"\305F\216\217"
+	.ascii	"\230\315h\001c\202\207%\207\035B\304\332\036`\002b\204\313l]"
+	.ascii	"\f\035\2229)\236\342\"\252 4X,=\022k3"
+	.string	"\262XZ\023\374\2215c\315bl\003\266\001\217\301,k\262\304\375\365U3S\222\210\037K\217\307\330\260\354h{b1\036\322fS"
+	.string	"{l\361!$\3136\315"
+	.ascii	"\022\025s\262C`]\214\302\256\322\2102\253#`\367\307K\0205/f\220"
+	.ascii	"\373\264Q\222\363\201\3675\364\004k\371\207\177\324\300\315\311"
+	.ascii	"\321\365\360b[\312\221a\341.\353d\344\216J\003\346\302YFa\177"
+	.ascii	":\360\026\216\252\241\016\t\274\2628\372G\357Z\016\364\332\255"
+	.ascii	"\371A}\275T\355Y\331<ii\335\265\356\021\347\007\325\324\272\032"
+	.ascii	"p~9\216\247r\340,"
+	.string	"\233g\316D\37163\224\224(\314\214\037Cp:\216\263\216\261\214:\312\312,\306<\216\235\256\370\312\234W\330\311G\035\032\240\305\330j\203'\277\034\\v\334jJ\017/\213-\256*Z\342\365d1\246:\036\r\332\230\225\223\324\336\321q\215#\034u\345f\362\222H>\022\2469\351\353\253f'\223\b\2311\032\306\342\232\216\243\216\241<\b\341v\353\327\0179\246\305\370\351\330\211)\312\222<\034\330\351\207\211\341\252\"\003\302d\375\006D\224\220\220,\3067ng\273\354\210\364,\306Loc\232\253\356\300K\027n\212\n\220\3058\t\333\350\351\337\260\322k\226\3140\362\206\266\276\003\375\267 F:\246\261\004\252J\212\354yD\016Gt\310\372\232/\"\"\034\204\234\250\243\023\304q$,1\245\030433#M\222\306\323\024@0HP,\236\215\330\351\001\023\300T\2473\232\034F\035B52#I\031)d\347\215"
+	.string	"h\323\226\270Z\370~\t\302\331}r\330h\031;\313"
+	.string	"\243\340\202\255l\341H\341E\303^\266\257\240\361uU\253dE\257d\255\313=\200b\272l`\3123\007\342\260\270\277z\275\243\365\225W\313\177W\356\r\t\tO\201\356\376\213\350\314Q\352\220\327\310C\322\365\377\321\314\033:@\234\273\036M\001v\345\303\006M\205\302\253\321\254A\234\007\212N\301Z\250\224\351\006 0\333\324T\316\357\226+\217\007\344Z\314\026\342}\264\323\032R\026a\031\241UN\317c\237\252C\b1\365)@xL\001O\r\250\312\225\303\332=4P\271\236\363\032$\233\316\035t_\264Z\002kx\235\244\220\257\264\364XF\004\203\262\261k\n\036CC>!p8\022V`\021>\254\255\020\313\221(\334/,\312c"
+	.string	"\324CO\336\005A\263\207!\365xc\177\225\371\034L\374\\Y\b[\342\322\356tG\f"
+	.string	"\026\3259e\023\326\315\260jr\224\210\326MXL\312<\227V\313la\024\337&1:.}\232\337\213\007\0074\031\350\022\006\310\r\321\242'\206\276\034/\244\"(\013_4P\211q\200\031\247vC\345\333 OKH(%\207G\2317\307\023\213\314!\264\f\227\222\205\366\r\021z$b\271[\035\330\230q\337\334\217\037\236\tTM\203\261#h\237y\347v0\361jo\0318t\311$\331E\305\214#k\021\247\366Q\233\230\317D\237\177v\026E\r\341\206\235\257N\r\265\360\257\031\026O\fA-`\246/x\244Ad<&QOAA\314\032\n^|\317ho\234\213\311\b"
+	.string	"\234\031\362\301\317!\314\222$WO\335GcO\036\013\214\030\344\316\246\225I\213\231\227\223\263\313\316\255,I\335Q\202\331\342\335\242\376\312\002\337\203\252\017\250"
+	.string	"c\231Ok\216\013+\001hjj\025iO\035}w\024\242\234\261\364\375hk\366\222\352\325\327\207P\017\205\212\345C\303\341O\3573\232\302\t\264\304"
+	.string	"O\0131Kk\t\366p\271\373\206V\224H\02126B\001.\207c\332_ey\031'^\2220nG$ E\006I\\\301Q\313\"\007\340]h`ln\255\332\361]W\375=U\242=\214\376\273\310\346\317S\343/\243\372\370\024G\003\f)0\321\343\034\251\345\255\324\352\364j\2477\354Oj\222\253\301\353\254\224\007\034\003-L\214o>\3349\013\327\327\nd\323\303\306\2247\032C\275\261\262+u\230\262\253\021)\\\314B\"|X\n\022\324\261\373\302cF\001\033"
+	.string	"\311AI\231!\375\362r,pJ\347\025Z\301\273&q\203\226\002\f\023\302Nq\310B\\_H\202\202,)\026\312\240f\364\007\261g.\270\350]a\302\327\226\037o\243J\363|+\350nS\277\330\205\271\027v\2021\3107\031xn\333\360u\3100\026\255\265\244\320\r_s[\371p/\271Neb\270\356\313D\301\373!\252\013\331\311\\gGp\237\266\017\356\247\364D\367D\035o+\311B\310\315\3221s,TJ\241E\273\271T\323M\201\223\202\204)\225\335S2/\2300\340:\341\215\326nH\222Q\344:\236\0208\244\2269\307\240(g\377\3734\236E\216B\"\343\024\214\261QA"
+	.ascii	"8\026H\210\220\376\217\207\246H\tu\264\227"
+	.string	"\347\351\266b\215\252\016\034\314t\306;\252f*A\364\267&\351T\342\303Wo\220#\022\030\270\022\245\202\231\262\334\027\204M\306k\273h!\036o\266\034>'\357\236\200Y@\244\317Hr\004\323R5\210\301\216\003\020\002\214.\363\205\006G\360\363\254\005#\nh\216u2\303k\\\321;o.z|\222{\312\265\315\020\350\345\242\313\003\230\026\200'\332\227y\235(N=\222F\320\315,\215\307Q\352*0FH\b\\\257s2`]\246\002x\223tC\201\246d\206\270@G\004\233\265\311\332\036c|j,C\324n\305\f\0257\\\277\362\013\254\320\270\225&\b\266\363\226Y\200&d\354\227\213\332G,\004\320\2607\3516\364%\255\r\264%\270\325\214\353\002\004\230\0217{d\217\310\325\\\354-[\004a}DZ\rt\377\234\206\205#\277\021\372\027\r$\374\2121_e1\203q<\036\351\006 {\237\b\004s\371"
+	.ascii	"\331d\255\271G\025jVyFc4\317\334\tm\003qlI\350\216\374\016\222"
+	.ascii	"\233\254\377\b\027\237\363\272K\225k\375~'\211\213\346\230\350"
+	.ascii	"\201R\226\336.m\264\272Ji\204\032-\270\300Dc\335\224\207lk6A"
+	.ascii	"<\331\n\244\246\216+SMbK\216\013@I\314%\005p\230=\221\356tP\356"
+	.ascii	"\323v\246\330\217\217\275\234l\341\317:I\246\260\223\245M\227"
+	.ascii	"\3335\353\2368\313o\333\252^\203\367|I\032P\310\261v\tX}z\377"
+	.ascii	"x#\260\b\305\344\374\226:\235M:\004\334R^\365\374\023\226\bA"
+	.ascii	"\303\353t\217\266\037\364\315\301h\f\351m\022\352$\n\234\256"
+	.ascii	"q\247\262\354>2>\304\211\007\"Jq\n/\310\350\360\035\311\366i"
+	.ascii	"\302\362\263\331nX0=\265E5\266\3773\302\206\030%B\3443\216\\"
+	.ascii	"l\215\035\202x\023\342\030\212v\357\346R9\323v\251\366\323\262"
+	.ascii	"\373\016\375!\340\274n\335\343;\250\330K\032\271\343`\321YW4"
+	.ascii	"\212`\\e\372\200ha-}\333nM\250<\350>\257\354\234\020\017\377"
+	.ascii	"\207\330\215\356\333\022\017\260\310(\177:Pc\217\327\210\002"
+	.ascii	"v\256 -\247H!\002\200ty\035c]s\2031\305\370\347\215\243\350E"
+	.ascii	"Vq!\305\363\033\231?\212\204e\274\271\032\302\240y^f\277W\225"
+	.ascii	"\030e\r\"\341\331\254\035\310/\fV\021\261\331\370\241[\243X\334"
+	.ascii	"&\354\026\264\b9\327\022\210\350-\027\007\373\270\200\252\001"
+	.ascii	"\b<S\r,\204\001\017\320R\213\2507=5\3046\326\207\211\3318Y\211"
+	.ascii	"\272a\226\254\301_k1\275\020\342\025,\265\261\351\374\335\375"
+	.ascii	"\301|\n&\341\262}\333\376\3677\240"
+	.string	"9\255\036\2723+\023\016@\326\023 ez\265i7\024T\270\253\231\033\003\006g\031S\313\273\212\301\3450\3469oM\235\030\233-\233\231{ZP\274\236\002E'\035\356\352D\203\263pm\315\213l\213sB\305\244Y\251\2235\232\245#w\250WQ=\302\034ZWE\256Q\210\2054x\265(T\350\020|@\353\276\n\033T\277\027\227\317\347\343\b\022q\026\220i\336"
+	.string	"\360T\353~\367\220M\317\024\257\243\3550t\020?\317\317?\333\230N\315\355\320<\245o\205\235@z\340\367\365\312\021\255_\357\337I\350\202\200&\221;\262\361\177v'|]\373\302*3(\367u\352\246\325>\360U\325~,\232\255\332 <\305z\325\354\343\363\215\201<m;\264w\260\266\337:\217\276w\251\274n8\247n-W\037\331\270O\253\347Qp?\272\025\355E\372\007g\274}\267\273O\3367\377\021uO\367\ng\347\320\275\227\255\242S;\333\332\323\252K\361V\2364v\371G\364\215yk\034\214\347\262U\341m\375D\254)_ G\332\017\242\023\314\306N\257oW\\\263\256>\304>_\305\317\262\372\274>\017L\236Pv\324;\2279E\312\216\313Oe\376d\2771\3614`\246\373%\313\016\200\234\337\325`^\247\235\3534\344C\333N\310\n\376\231\352\335\311"
+	.string	"\332\240=\325\b\347v\344!\233p\347\021sO\256\253\314&\272\007\2749\340n\216\251\325\312F\223\307+\350&\337l\373\303ri\224\007\376!\235.\217>\3115y\005e\237J\276T\304\275@\247\214\016\231\013\354X\302(\332ei\215\372\235c6`\271\372i\334-\177}$e[\365\276\373\357z$\226\310\315\361\370I{\317\367?\340m\337\006\260YD}[]\203\263\303\266\217\315\374\035\263;{u\2004\002\355AY!\322'=\273\221\035\027\013\276z\217pn?"
+	.ascii	"\215\031\234\3032\007\005\034g\375\306?\312\370\360\212ONy{\363"
+	.ascii	"\346J\277U\023\245\274\253\033\301y\371\271\251\221\211\2173"
+	.ascii	"x\331>\334\340\304q\013?0to\355\233\323\330S?{\020\352h;v@mK"
+	.ascii	"\370\322zXdM\377K\3437\002O\322q\262\353\311\245\353\031\274"
+	.ascii	"G\204\303\230\216\320\304.\246\336\321\303\246\354\rDC\252\346"
+	.ascii	"\372\313\247\271\3031\2467X\207\003\026\223$M\357\253\353\300"
+	.ascii	"\361p\306\247s?\352\rZ\267\f\263\3367_\255U\357\371r60\034=_"
+	.ascii	"\005-C+\231;\376 \327\361s\327\235)Lu\005"
+	.text
+	.section	.gnu.lto_.symtab.9fbcb7717248039f,"e",@progbits
+	.string	"checkFuncMovingSumExecutionTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"checkFuncMovingSumDeltaTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"checkFuncTotalExecutionTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"checkFuncMaxExecutionTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"queueClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"queueContains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"queueAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"queueRemove"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"queueFirst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"queueNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"schedulerTraceStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"schedulerTraceStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"schedulerTraceIsRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"schedulerTraceCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"schedulerTraceGetEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"getTaskDeltaTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"schedulerResetCheckFunctionMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"schedulerOptimizeRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"schedulerExecuteTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"schedulerEnableGyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"getAverageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"getTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"pidLoopReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"gyroFilterReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9fbcb7717248039f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
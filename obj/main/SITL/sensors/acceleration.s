@@ -0,0 +1,1486 @@
+	.file	"acceleration.c"
+	.section	.gnu.lto_.profile.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\036"
+	.string	"$"
+	.text
+	.section	.gnu.lto_.icf.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`\032\002\275\r"
+	.string	"\326\222IC \253\2525w'\373\256`y@m\355{U\205d\245\307`\030&\005\352w\267\360|y\303\266a\301\"\204\343@"
+	.string	"Ab\005\001\004\001\f\255\3124M\263/3M\3234C\342\336\376[\356\275\267\224;\311\0355"
+	.string	"5"
+	.string	":"
+	.string	"$\346\261c4\331\020#\001?[/\312U{y!\202\t,\267\273\030\332)8\370\367g\257\336O\247\223\276\225\0132\025\355\246wwWPvj-\350&:\257\f\240z}z\303\235\f\370x:\234\315fs\325\254\261?d\036\267\217\233\233\333\3139@\006\004"
+	.ascii	"\3002\016"
+	.string	"\233/Z\310\265\334\314\361S\235g\355\322\023\316V\022K\362\207\356\345\240A\333?{\366l\357\334\361\034\330L\006$,gKz\230`\263\b\032\332\224\206\n\r :\361\201\n\344\034y*+\n\031D\223-\b-\224PxX\353H\b\355@\335E\271j\257\2152\002\206\031M\343N\216\251%\022\\\0022&\235.,\214\372=A\352\345\343\302>\372[ \305\224\262x\225\213\225*\026E\002\260\024P\334\315\320\346\242\315H\250\321%\241\242\232 #Ii\271\001\220\002*\"\352\001\021`I)wR{,\373\006\027&\b/vl^\252k\346f\212\223u\001\363y\367r\026\324\251\326\3761\236\302\304\231\355\316\362\206\335\253\216*\215R[k<\nWa\f\271~\017\316\343\023\344+\347\022nzZ\251\330O\3227\2216\357s\350W\341\004\303\360\323\371\214[\300s\003F\013L\203\314\007\345\242\3138\366\006\306"
+	.ascii	"f\03539\305\350;#\003J\006\225m\367\220\244;\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375 \372]\004"
+	.string	"b\006\023\035\240'\351\377\377\377\377\317\f"
+	.string	""
+	.string	""
+	.string	"\021\377\377\337Y\243\267?\336\377\nk\315\221-S\n\236\030\364\366T\226\266\0357V\f\003\371\217hQ*6\261_#\352\260\233\2345\303\026J\302\203Z\240\232\307\277\217\310\001[.{\3667`$\032"
+	.string	"*\341c.JxXQ'\202j\274&\036\330\275\301BM\033`\347b,\251\266\227\302Ij"
+	.string	"\nvT\032\203\2050\216\035\030C\260\245\245"
+	.ascii	"U\225\312B\234\312\264\227\3406\320\006"
+	.text
+	.section	.gnu.lto_.inline.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`\021\003\375\016"
+	.string	"\206\223G? m\225\306\360N(\211\201\376\225\225\345c\204\254\2428\t\004(\215\315]a\235\247\220\264x\032"
+	.string	"\354\032\t\264\027\036\001\210"
+	.string	"\t\020\3527Gk\330I\377\322\327T\274]\377\177\361\350\023)w\n4"
+	.string	"4"
+	.string	"7"
+	.string	"{2\236k\247\037\01600\260\353\tE\201\bTk{/\035\214@\300!$_\275\224"
+	.string	"+@"
+	.ascii	"\344\230\347()\354\356\344E\252\371\221\224\273\273\221\257X"
+	.ascii	"\213\004:\007\316\201\027\315\323\226,\346\212{\312\013\273\373"
+	.ascii	"k\315.\312,\251d\314Wr\333Nm\355\004\220\035R\254\tq\225 \004"
+	.ascii	"\t\312w\252\222\251JDPr\3465\031\215\002\363\347\316\247\031"
+	.ascii	"v\367\323\345kw7{\346@\210\037-\372\267\212-\b?N\0316\200}\236"
+	.ascii	"1.FZG\267\344\230\322bJ\020\273;\261\305\034\0309\360-\001\377"
+	.ascii	"o\0012\222tc\251\262G\250K\f\025,x\320\310\007\3044\3146wh\""
+	.ascii	"\002Tb\322W\212\025^\346\330\030\351\240\277h_\370`\006\372d"
+	.ascii	"<\036\275\334\360\241\"\204\316\bX\250!E\251\204Dd\026\024$\315"
+	.ascii	"\030p\"2Uf\007\022 UE\203A$\200&\252\241\211\013\013\3539\300"
+	.ascii	"w\212\203\036\301\252l%\307\352\032\201u5Z(\363j\245M[:\r\216"
+	.ascii	"\256q\202b\354\320\036]\332\267\327\020\206\026\3448\222B%\301"
+	.ascii	"\301\256\024\331i <\1775\367\230\336{\020\257+M\334\3134y\022"
+	.ascii	"[[\371dF\211\02332\330\004\001r!O.K:+\221[\306\225\207,5\322"
+	.ascii	"f\027r\304\026\267\215\362\360\306\b\023\250\\\312\253U\0248"
+	.ascii	"9\241M\254\250\314\370hw\330vv%H\2705\325^\327\177yp\323\263"
+	.ascii	"\252\304\301\3567\376\3136A\360\243+\246&\273\356\272y"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`\314\001\375\t"
+	.string	"\202\217..`k\222\0160\fCE\223\200L\274\210D*\025\004A\302k\005a\247"
+	.ascii	"\242#\270\020Z\363("
+	.string	"\372\373\327\363r\277s\332\321f\344\357&\223\f\204\312\347\035\"\r\033C\345\316\nuL\t}\027H\005\322B\316\234\371\221J\216\271\033K\237Dz\274\276$~I\375\305kB\3456\245X\"\rQQ\377)\243\210\223\265\326\232\023\211D\200\350=t\200/\205< \r\240\002#0\373*Rk\345\3539~\343\001\213\325]0C\036\306u.\203\231!\317\255I\257I\235\233\232\242h\\\3476\230y\354j\2124\250\355\007\264_\007'\344\246$\233\232\222#R\033!4{\317S\200U\0018 `\242Q\354\314\003\233 \347\253\226\261\0045/\007m\243\005\005a@\021\013\266vy\201v\313\002ed^\256qQ\007\257O3\336^`\263\347\235$|\022 \357-\206=\230B\334\203\315\356\206\243\210\204$\305Y\222\2651 \2205\022\005:L\320\364\240\265V\217 f\016&\3305\240\331\003\007\216\276\362\327 2"
+	.ascii	"\347U\314\227\217\364s\001\306p8\214\276\337\241]\214\220\027"
+	.ascii	"!L\323IMj\300\r"
+	.text
+	.section	.gnu.lto_.pureconst.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\232\004\001\232\004\007\232\004\017\230\004\021\231\004\030"
+	.ascii	"\232\004\031\232\004\032\204\004\033\232\004\034\270\004\035"
+	.ascii	"\230\004\036\230\004\037\231\004\"\230\004#\204\004$\230\004"
+	.ascii	"%\232\004&\230\004'\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`\017\002\005\013"
+	.ascii	"\022\017,-`m2\034\226\023\004A@\0303\004A\020\344d\213\002kj"
+	.ascii	"\360^\212\260\2017%k\253\307\326K\t\330\270x0\325\fBC\236X\231"
+	.ascii	"Rr>@4\233\202%4B)\203P\217\275=\250\2036Dk\255\2169\307|c\220"
+	.ascii	"\306<cN\315?\333\317\334\263\365\f`!3\306\226\013\314(\225)l"
+	.ascii	"\226\340\026\033\301\313\345\300\314\244\222\r \222\3251r\262"
+	.ascii	"\226\310Z2\314;\333N\205WP\365\200\002J}\265\255\346\225-'@\235"
+	.ascii	"\226\3642\355f\256\331j\216ti+yf\0233\247\330N\314-\203v\232"
+	.ascii	",{\275t\227\332\244v\310\022\030\351L\002P\250\201\271s5RXPR"
+	.ascii	"Hc@\002b\224J\362\021@\265s\322\314\302$\355\006d`\225\352\222"
+	.ascii	"\006\234|\230\26723\212\254\367\340H_7\334\370\334R\033l\335"
+	.ascii	" \227\300s#\272\263\024\312)\342.\307\365W\233\313X\325\274\021"
+	.ascii	"*\226\307T#\035\353R`\251\312\020\"\31684a\327\017\332&\\\316"
+	.ascii	"\333\246#G\225\n&\376\226\310=\004Q\242QNn; |\347\330s\370B-"
+	.ascii	"\302\214\007\347bU\317\006\034\347\035\277\254(\022\005\001\252"
+	.ascii	"\n$\212\026Q\302\205\317\343fZ\366q\265\271\n\303\344D\257G\334"
+	.ascii	"\032S\230W\177\346\036\002)"
+	.text
+	.section	.gnu.lto_.lto.c9d038b1d2f677e2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetRollAndPitchTrims.40.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"e\t"
+	.string	"\226\321A< \005)\035 a\310\216\022\342I\300L\300A1\332VDA\3278\002\323\376P\b\301~\354>\026?c\203dN\230`jH"
+	.string	"\007\237\205\201\241\271 \343#\250a\3317\302m\311N)-"
+	.string	"/"
+	.string	"4"
+	.string	"\237\235\013h\237\026m\232\217\254\375\253\265\261\002`wi&r\361R\364\177\362\200\224\352t\271-\354\256eJ\325qg\267\215`\273\301\366M\3669\273\273\316V\366]\277\234\233GLA\315.G,\300\302\346\013\211\307\366\245\375\326M\304\273L\377\354\256f\\v\307\004+t>=~@\013\234\315Vv\370\200\2412\r_\3456\305[X\fX'\320\354\360\257\n\207l\213\247\\8\204\202\221!eF>}\223\366\271\201\300\224\330\240d\314\036O2\013\t!\311\253\020\022\\\311{\210\370\030F#\260~\314\201>\320+\211j7\3528ND\303\n\206_\027\322\317\023\221(WC\n:08\321UZ\002\301J=\343>\r"
+	.ascii	"2\2419\034\030.,\310\256S\t\267jBL\274\241\027n\301\220K\260"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_accHasBeenCalibrated.42.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\355\007"
+	.string	"\022\21766Pm\323\001$\243\2605\350/\346TX!\370VU\2317d\244\372\207\376\203%\203\330\206\317S=\313\361\324hbf\232\313\300K\254\235\017%\243~Vk\373\313\235R\2564\330\2748Tf=XUEI-\233\032fi\022\273\250\215\2542Mj\b<!\254Lr\346\314d\346\343\256\"\325\001N;\373\001\227\253\352?$\235\257\2078(\230\354\315\277y0r\304A\264\002\323n\005\303\307I\022\376\306\243':\360\336\243\337\271<^\001H\034<\331_\0075\303\276eUd\033Z!\364-\230\216\024\201\222]\320ieQb\211\303\266\307\3168a\301\343\355\337\bt\f\223\217\210\312\356'U\343\333\341\346\337\343\261tq\342\205(\0161\r\273k\350\205,n\275m\003\333\b\266G\002\f"
+	.ascii	"2\001\3138\343\350#0!\366K\3401\323\313\246}\256\341\217\021"
+	.ascii	"n\tA\302\2353\265\363\t"
+	.text
+	.section	.gnu.lto_accResetRollAndPitchTrims.43.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\315\b"
+	.string	"V\220<:@\3056\035\340z]\267$?0S\026\2519F\024d\016\355a2\212`Z\f\350\brC\304\370\030\032\325\263\034\323)q\\X\360\360\311\356D\333,\2752@\345o\373\357\235R*"
+	.string	"+"
+	.string	","
+	.string	"\363\2259\273\345\240\307\276\244Ra\202\332]*;\316=r\376E\027\360B\024\217\231\204\335u\364B\031\267\274\355\003\333\b\266S\001\243S\027C\033\004E\311a\377\262r\303\276dL,\005\341\356E\230\332\225i\002\261}\237\364\357\363\221\027N!\273[}\332\037\273z\377g\206\247\240\234\004\234"
+	.string	"\363\317\235\227\2527\377\374p\222\315\233O\037\374\b\204\377\361\351\b\211x\357s\340\023\230\317\177\217\"\026(\215\2764Y\345x,\rk\300\256\313\242\233V\267\f\333h\306\261:\364\3226\2521pu\3004\352\251U\243\025\330]t\005\022F"
+	.string	""
+	.string	"\235\004\371%\001\016"
+	.ascii	"2\003\302\260\306\302R\231\300\200\034(\030U)\201\020\260qM\354"
+	.ascii	"\016\221\001\025\342\345\np\351\026\355|\002"
+	.text
+	.section	.gnu.lto_pgResetFn_accelerometerConfig.45.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\305\b"
+	.string	"\266\020>8@o\323\001"
+	.string	"\027\236\336\235c\035K\260E\352\260\365\264n\370,\373\023\332nYb2\210y\364\375Z\0130u\342\270:\254\360\357\207\016A\2104\315\353^\351J\233\354\235R+"
+	.string	"-"
+	.string	"/"
+	.string	"\004\327\247A\333\345\365c_\242\3228I\355.\225\036\007\037A\377#\017"
+	.string	"\2112\036\001\"v\327\021$\332\270\345m'\330~\260\275\022rd\277\364\307)QS/\007-\273\241U\314\262L\225\220\214\355G\373\"'\201/y>\260;R\241\354V\0067`\237\2567\270>\261\007\025\346\024\312\217\005\256p\331\0267\271\260\303g\201\t\325\301B\b\237\004\243\023M \276\347\372\\\b\2418H\2470\256\354\372\211\262\303\276\265\273\353\233\306e\234\217\333`\3264\\\267\341d\3366\261iZF?\257\373\270\355\243\334&\243\240\232\367Q\r\202\273\212\315\243\234\256\363h\246\206\267V\216l\245\004\013"
+	.ascii	"2\241\007\034\030.h<Y\0175/d,3\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_accelerometerConfig_Registry.49.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375 \247\345\004"
+	.string	"\324\bk"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001\212\001\202\200\200\374\342\203\307\202\037\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\366\007us\250\307\007uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\001\243\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/sensors/acceleration.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_accDetect.56.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`\247\003e\032"
+	.string	"Vp\251H\260XQ:\360\361\016}\211s \236x\024e\214~e\203Y!\371\272\216\t\203\30703!\034\257\200\357\006e\321\307zo\306\250\026p\0325\377\037\307|\341\360G\353R\2714\236\311\266\203\304\306\375\267F\b![\356\224\002\231"
+	.string	"\212"
+	.string	"\221"
+	.string	"BFN\265\356(\330\002\371\320\273#\020\037\2227 >\274\200!\307:\337\001\371\271\216\210-\251L\255;\327\376\360N\235\263V*r\024C\272S\307\257\235\365\035\034_\321\b\2764I\217\302\335\240\t\220\354(\271\021\034\216\251\332\031JH^\230\212"
+	.ascii	"\2354\202\2531G\272\274\336\357Q8\033T\303\222\242 \266)\222"
+	.ascii	"4\036"
+	.string	"\006\310\275\240\fj\255\357}\372\344`LJ\021\374\f\271\255r=TB\220\n\231U\356\305\334U\016\350s\264\251\265z\336r2\356\326m/\331\036a\257\213> .0\246\032\377\311\337\373\206_\320L\2606\323\320Zk\335\325\331\273\332\314\020\245E\210W\310>\223_\300y?\200\226\247\311+\335\343y\267\350\351\320\323\324\323;}\003?\022,3fB\257\326\2375h*\227\360\211\310\225~\373~\322{f\331V\242\2215\034\331\224d\024\254u7\341\241?\334\3509\177b\340\0374\t\326Z#<4\007\362\341\356Nr\316\243YU\253\217)\f\344C\006tN\373G_\222s&.N\240\326\273s\351R)\266\032\276\213\273+\212\261Y\371i\342\270s\337;\315\002\365\263=\361\3145\026W\007\345\266\371w\210\327\303\022^G\374\226H`z\346\031\213S\300\332+Z\314\337\276+\202vf\202=[\363\231~"
+	.ascii	"\013\217\0039\023t\242\253\363{W})\322D\336w\323\t`\305\365\261"
+	.ascii	"\253\030\b\201\250\300\235N\305\300\365\002\265j5\031\270\240"
+	.ascii	"\210<M\364\371Q\f$O\023\037\222 *\221\323Q\321\201\020\302\350"
+	.ascii	"\310Qk\355:l\0338o\265\212;\003,Z\211\023+\303\330L\204,D\254"
+	.ascii	"|\265(Q\276<\300`\257\001,b%\326"
+	.string	"\260\n72\0238\2572v\"\006\203\275\\\263R6\273\211\315\\7&^(\\\260r\346\252\320\300\262\024\261\322\205#\223\225.\326\256\016\235\256:L\331\350MQ\375\312Irm\263\263<,\325\264e*\346o\241\r\317\326\034D\351\341\264\032\377\273\2518nk}Z\253\200H\n\351K\317<3\244Z\035\223\324\321R]\037\273\024$\004E\376b\020\r}\245\246xLc\222\035[\302\377\376.A[\350\237>\256\317\225\323%\021G\250Q$\244\024C\212\020'\230\t\213\002Q\213\001`\002\231:3\017\021\200\315T3\3122\007\213\252@\3779\004\247d\t\374#\3711}\366\026\326\311\273\2152\305~\247k]\362\233L\246\005\232\276\234\364E\177y\371\367\210w\364v\034R\331\f7\266cC\210\016Z\210\237\312n<)2\370\020\214gV\242Vr\303\362\333\0201ry\321\204\035\021-\322o\300\207\211;\274"
+	.ascii	"\276\301\314\260\320\370t\271@\303\227\201\353rf\351\331\034"
+	.ascii	"ii\377\001e\201Ma\352\215\233~\345\371\253`\\\373\300\261\251"
+	.ascii	"t\233\340\007"
+	.text
+	.section	.gnu.lto_accInitFilters.57.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`\365\002\215\026"
+	.string	"6\253\222I\300RN:\242\302!\020t\003-\3526\225\272N\007\213N:#}\313\207+\271\262\273$2w\013\004\320\225\225\347\340PY\267\225\350\267\266\343\210'\036\005A\351\b\026\032\034\277=\264\222\257\177\3679\n\023\226\020\262\211\334)\005\200"
+	.string	"s"
+	.string	"}"
+	.ascii	"\237W\361#\233#q\030ox\306\247\235\"\253\335\336\311\247\033"
+	.ascii	"\214\237$/\020~\202\037\020~\276e\033[\307{#\366NB:J=v\367\245"
+	.ascii	"\"\254\007{\267(m>\212\341\004U\332\370\342JI\225\r\335\356\346"
+	.ascii	"#\030\200\201/'\305\022"
+	.string	">\017\035T-\351v>\237\276'\250\301\363\323\332u\220 \200\335\207\253\310.\007$\331\335\033]\356\354p\244\024Wv\327R\267\353\271Y\267-d[\202-\177\004\276\0349\322\207\355\331\227h\306\335U\361\225\316B\203O\364iZM^\367\351\327t\362\220\272:\302\311\237\335\303\221\312\263/w\367\306\nd\217\034\351v\211\322!\2424\353I\367\030J\213S:\224\322\023\224\006AiUi)\245/\300@\017\032\027\246v=\374\200\354\214\tU\364\244\037\351\322\276\375\025\276\317\255$G59\241\260\332\335\b\343\247\375\024~\317\255S\324\353@L\r\365PS\357\273IT\214+\325\020T\227\252RN\206\252_|G\317\356\332\nrvq&\240>G\205#\177\226\252:y\344\254\256R\337\373\224\242\372\351\004\231\312\263\224g\372y'dh\210\262t\347Lg\351\001\022F,\365\237\356\202\306'2\206\227\227\360\223"
+	.ascii	"\216\037\234\374\201`\206\267\200A\270\261\233\243\3427\335)"
+	.ascii	"&\203\201\t?C\224\365\335]U\236i\302\353\203\002\267\331\006"
+	.ascii	"\030xk\221\321f\025d134\030K,\006s9\226\"S\233\325\300l\262\030"
+	.ascii	"Y,\006{\335l\265\233\214\354\366\222\231\301h\257\230\355\366"
+	.ascii	"J)qmFf{\325\324j\266W\253\207\273\002\331\350\243\324\325\f\234"
+	.ascii	"\342xT\236[C\341\210\316\241y\362QwP>\252\f:(.\370\250#z\023"
+	.ascii	"UK\271\020\b\244KC\025\325\236@A^g\222\234\336\330\237\272\211"
+	.ascii	"\\g[\346R,(7v\367\001\214G\265Xpq\t\0379 p\002!B\272\003\342"
+	.ascii	"\200\237\206$\345\242l[\353+Q\"{\347\2271\235Mt\350$.v\fo5ZY"
+	.ascii	"+\214\251\226\307\261\2122\301\340\246\340\273\035\3064\201z"
+	.ascii	"s\347\242\364;\262\263\376\r.L\210\375\207\362goT\230\237\f:"
+	.ascii	"\232\303\274#\225\323/SV-|\316\254T\004\363l\256\330\334Qq\341"
+	.ascii	"\364k\242s\214\360\005\334m}p\036`\217{0\004'A\331t\371\362)"
+	.ascii	"\347\351\261\2467\001\227\001"
+	.text
+	.section	.gnu.lto_accInit.58.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`J\005\355\037"
+	.string	"\326\371\313H\200\334Q\007\033\336\222 \342\265k\327\217G\303h<\036\260\205+\021%\016$\340\372ac\267\030\216\203\264M\375\353\r;\313o!q\323!N\342\376\341^vr\376w\374\321\333A\250\f\016B\314\354D\335v\313\235RJ\001\263"
+	.string	"\256"
+	.string	"\277"
+	.string	"]\240\271n\332\230\021k\367*\255\245\271`U\312SWuc\2653\033q[u\026\343\230\364\225Qc\021\241\303\027\350\026\362\253\003\332\325\200\311\275\354%F]U\3247\351\305Mi\253\312\331\275K\005]\331\007\355\312K\364\235\271\221t\022\243\246Z\301\365\336\035C\242\334\273\\\300\r\320\256"
+	.string	":\347\354\352-\340\354\312\314\354"
+	.string	"\202\021\333^*\225\332\211\312x\225v\357r\367?\332\366Y\315w\313m\223\034\366\211\316\350\212K\"\271H&\271)\243\337L\300tE\206.yd\346\204\365\b\323Y\355\310d\321\335\326s\357e?&a4\333\232\231Sf\026\301\\m\237[\352\"E\305mE\305\005\004\312\024\030\372K\003\025/\363j\2003o\340\340}\364G\340E\003\254\330SXt\310\031\273\367v\020\356\340\207\226\002B\307\034\242\271~n\224\367\336\b]\243\370\023\344\r\242\257q"
+	.ascii	"g&Q\342uh,\201\025\177\3108\336D\232\255\234\n\272\265\332\211"
+	.ascii	"O\247\274\227\330\244\267z\334A\272r\352\363>v\345\366\001\235"
+	.ascii	"\360>rg5\b\251\253v\226\364C\346e\321\277\211\271\315\373>\230"
+	.ascii	"\233\252\233gG\347\235u\354\234\353\252\346\233\306j\306\261"
+	.ascii	"\263\r;\337n\316(\352lC\235O\324\271\242\316&;\277\315\331O\347"
+	.ascii	"\350\267\226\023\255RN\031\302\207?\004\224~\331&m\f\357\343"
+	.ascii	"\355\r\330\036\375\3562\256Yj5\366)\215\355sQg\036xk5\032k\303"
+	.ascii	"\307\330\342h5\233\243\302X\332\317\204\26137:,\017\367\372\002"
+	.ascii	"C\372!\343z\264\031\2422d\252\030\232Z\r\242\257\231|\376\316"
+	.ascii	";\226\263\2626\323\235\217C2\353!G&\260\377\246\266Og}\023V_"
+	.ascii	"\216\034MS\203\371\322d\366\007\003\261NNg\327\372\265\253\314"
+	.ascii	"|\235w1\343\032!\355\305>\211u\027\013\205\336{m\021\033e\215"
+	.ascii	"|.*\214\332?\263\225j.vK\330w\035\311\260\235j-6\tz\357Q\004"
+	.ascii	"n,\235\305*\361\261`\341\354\372\001\302_*\364\363\001\005\361"
+	.ascii	"n\302_*\364\363\001\005\371\b\001"
+	.string	"\205A\242\036\216\212\f\251\220\347!\rB!\304\373\320\353\361p\270\307\340\007\004\022\362\206\322\240\264\327\343\355\202C\300\340/\r\356~@<\241]o(\270cp\200\201(\322\241\235\020\b\034\332\341\226\3046+\0060fYPL/v\356\221\314\234{\356!~\361\244\340\272g\266H\326\350}\264\371\316\352\236\243\0372\317\353\236\335\270\306\271\320\302v\324ob\333\215gG\026\361\214\035\313\274\205\205\302\241\231\261\2219\273\261\350\201\362\336\244\026\236d\221b\216d\241\270\301\225\230#\310\0262U\366;\337PSL\256\363\270G\332\363\366&\254\310$x]\250AD\204\024$\206)\221\t\0244)V\016\300\"\0212\252\007\021\0201e\310L\032-c\370\374\0222R\316\016\231\373p0%\340\334g\371$\334S\356\216\352G\002$;@\260\275\210'\244\207/_\317\334O^\204\316)\344\373\350\267Y\367wo\217\225"
+	.ascii	"\212!L\034^\216\217\033;\270\t=\321\217u\370\204\213\223'2\227"
+	.ascii	"\374\350v#m\301\001\376\037\316c3!\004e\337\016\035\311\227\237"
+	.ascii	"\031y5\246{\357A\330\026oc$V%\2556\2178\256\266\302~w\027s\030"
+	.ascii	">tE\007]\351\025\360P\254\216s\242\3537\222\277\344\327\335\007"
+	.ascii	"\346\033:\232U\244\"\214~\252\207\215\341\346\3409\230qkm\207"
+	.ascii	"\002\317\013\377\233\242g5"
+	.text
+	.section	.gnu.lto_accStartCalibration.59.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375 \356}\006"
+	.string	"2L-2pM\322\001\240\361\327!\246{`/h!\341\314\210\363\013\301mhj\241\326\220F\017\327N\331\241apo\274\376\347\352\202Nf\0230\216-\373\313\235Rv\224\tV,R|\n\3179\251\311\b\345\364d\233*\322BsQ6\n\201!\303\213\315\002alQ\265\327\016\302\204G\243\016V\210_ \237\343\035\027\037\303\r\230\365y\346c\2403V\361\241Q\242Y\037\273\312,\245\260\017\260\332\261u@b$Adw\3639Y\017\013\311\260\375\310\224M\362\352b\0172\037<Lv\267\251\305\251/\312\377\306\005&'\363\025p\260\273^\223\023q\353m\027\3306\260\275\t\b"
+	.ascii	"3\001\0038\343(\276\3055\221,\004\3742\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_accIsCalibrationComplete.60.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\355\006"
+	.string	"bM03`k\323\001\320\002\356\204\211B\230\f:\024\273mo,\360\272\333\274\251f\366\265\332\001\377/\350\212\273f\323 H\030\027\007#\356yC`\361\240F\244L)~\023\013V\224)R\n\324{\223\273\"\274,\352rV5-\270\027/7!0d\240\242\243@\030\235d\333kGu \243\032\373\025\351\252\372\215G\363\214kT|\n7X\362\331#\337\"=\272\006<d\362co\230\324\b\373\320j\307vZ3}H\340\342\243\342\330\325>#\353\021y,l_l\211\017\020.\306\276Mh\257\3206\033\"\273\233S\211cO\314?\306\241\020\220\216\214\203y\002$\354\2563\3438\334z\333\005\266\rlC\004\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_performAcclerationCalibration.63.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`~\007\205)"
+	.string	"zH\314\017Dp\350\315p\323\270Gx\"I\021\245\366Z:=\253lq\002^\345\300\275C\255x\234\3371\020\273\271@\025{I\t\301\3004\223"
+	.string	"\022 \250)\311A\341\022\232\036"
+	.string	"\261\342\351\222'\250\t\331{\357-e\222\001\345"
+	.string	"\330"
+	.string	"\364"
+	.ascii	"l\220?\356\307l\230\213Q\217\266fR+\255\324\fMl\317\272\256\016"
+	.ascii	"nn\206\364\346\201\362G\347\013\263\237\305\300\203&\306\227"
+	.ascii	"\227\315\370qO8\256\031\273\357r/4~\334\336\322\303\273\271K"
+	.ascii	"c\227w\263\344\355\356y\367Z\276E=\227\032JE\353\025\331\r2\353"
+	.ascii	"zlZ\t\351\315=\036\351\274\231\376\350\274\271\352\356\333\217"
+	.ascii	"\306"
+	.string	"\025m\342$\253\f\271\256\253\257\225l\277<~OV\257K\321\323,\233\325\375\330\023\274\001\"\026\255\256C`\244G\220\247\345\004\033\310\256\303\321\nR\366\346\262\344|\354\b\244hq1Z\026\255\353:T\314*#p\216\342\220\317]\224\255\233@^\226L^k~\f\025m\224Ho\216\340\341\025\257\270?\346Lw\326\210\305\2553za]\327eb\261\307w\367\335\255\262\273\032vQ\030\001\335\006\226\250\275\271\031\rk\217\232\2474\315\273\223\314\tS\023r\222\315u\360\335\355p4OD\306u]-\354\317|\355\304\036\354\346\006Q\2408o\232g\332`\201\273\320l\355F\331_Z\377\235\005\272\253\n 2;W<\267{\265\227\371\355\301\026*\212O\214:o\026\350\2239\203-3r\\BN\366\272\256V\335_\273\307!\377k#\331\355\361258\227?A\217\267\300\321\276K=^\245\036o\322\216W"
+	.ascii	"\217\027\251\307\033\200\307{\204\362\002@y\215P\336\242\035"
+	.ascii	"/\021\312;\204\362\n\241\274\275\035/O\307\273Cyu(o\212\362\242"
+	.ascii	":\336\023\3455S\3362\345\355\224\227Q\336C\030\260\346\315\212"
+	.ascii	"\344\272\362H\006Z\335\230jO\216\366\223\367`N\346\305\323\266"
+	.ascii	"\317\004\177\214\032@Q\033\261\r\316b,\276Y$G\324C\026\0165\021"
+	.ascii	"\362B=\004\350\275\026j\3425\331k]\334[\230\032\257\005\005Z"
+	.ascii	"\241k^\227lY\203\346vM`\t\227V\332\272F\313\260\304\206g_3'\332"
+	.ascii	"i\233lqO\351\037\264uqy\344\324\226\340x\234\245\277\223\251"
+	.ascii	"?v#2+E\374\304\351\303\324?;\207QAzmA\373kunf\203n7v\360\245"
+	.ascii	"\316\321\364\245~\034\231\333\025\317\275\\\327u=\037|\251\033"
+	.ascii	"\364\273\356\254ay\r\235N=N\006\3324\374mC\232\007\310\201\200"
+	.ascii	"\021l\352\274\311\300\bw\267\337\231\362\360\201O\374p\336<\033"
+	.ascii	"MR'\214+mwYA\235MCj\243#b\3108\007MB\007\2114;\316\223\220\021"
+	.ascii	"\016\261O\331f\037\213M7w\3515t\263i\006"
+	.string	"6\304\333\210Hj[\327\265\002\333\331\220(a\302\304y3A)\031\27728%\005\034\241\002\312\205\024\210\024T\030X\260\250\002\032-\024\004\252*)\027?`\024\213((\250\237/\b\254\nRE\005}TR\277)\037\0240\350\203\220`\253ZD\001}.\252\252\200>\336Q\370\257\215d\237\330\334\b{\270J}\244\223\311\377\316\244V\3523\221\2446\267\342\344t>\336U\217\250_|\342~\354\351\0346\"r{\206m\265\277\323\251\204\273\234(\264-\341!*\223&\343\252MX\b\207\005\\\034D}\262j\024u\n\237\250N){\031\205O\035,\354\343Ux\013H\n'\\:\257p\017\247\255p/\253\206qQ\315\262\025n.k\251b\352\226=X\215\363\346\275\234\305t \275\264\300\t\350\035\254\243d#\366Aj\001\375\254A\001\372\250\221\032\375\203\005E\035\343\034\277\233\355b`b\206\227\2651\216"
+	.string	"}3;\\"
+	.string	"\364Q\243\001\200\227\250a \350\224S\f\215\220\244\240\240\240i\r\220\002\221\2512z\021\20013V$\nT\231\266\003c\350\200\354\"\007/dd@\213\262v\026C\355\\D\240\374\246O\240h!-\324\342\264\301\274&\024\356z\034\252\377\351\367\263b\002HP'6\331\256G\001\266\255\300Xb\216*\355\033\177~\032\356yFN\247\336/\353\262\313\364!\020\256\271\315\275\007G\276\002B\344\345\302m\326\305\210\001q\275d\330\035\213C\301\322i\236z\236\323\r\347\177!\007\227_\346Q\255M\224\201s\203w\260Q/\220\205e\203!p\231\265c\311\200\"\026\237h\326\031\013\332\220\023D\271/\036\350\2061\367\263n<\350|A\267(\3703\215A\346\034\001\224\017\314\373/&\323\260R~F\244\376}"
+	.string	"\3477\360<\340a\332\261;?\300_o\223\275\bd\371\216\251\331\210HH[\232\312\307\257\fP\266\037\254G\301z\260\375'\375IB\224\022\271\342\310\277+\331\316\300\240\314\374"
+	.ascii	"Dr\330 \001\022\364\021\302\251%H\216=g\263\253\001\f\034\260"
+	.ascii	"8&q?\215\373L\335b.#1u\350\376\007"
+	.text
+	.section	.gnu.lto_performInflightAccelerationCalibration.64.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`\b\re<"
+	.ascii	"\372a\250\025@@\350M\007\270\3721]1 \213_a\032\307\030$Gw\217"
+	.ascii	"f\2677\337\331K\001\233\035$l\020\243\001(\006\233y\206v65m\240"
+	.ascii	"\031\006\3572U\016(\206/\361\021\tm\262\367\336{\313\224R7\001"
+	.ascii	";\001N\001\375\373}\273\354w\353~\263\356\367\352~\253\356w\352"
+	.ascii	"~\347\366\373\331o/\341\220\300@\025\r\351\342\270\254/R\374"
+	.ascii	"G\255\373\342n|}\365\323O\273\231\355o\346\274\r\354n\332\216"
+	.ascii	"J\214\031\237\255\200B\333\036\270\332 ZW\251RoZ\343\\\356\207"
+	.ascii	"3\233m\342\371\321\355j\034.\2103;\352\215\r\331\026\307\361"
+	.ascii	"\353jw\220\356\327\325\374v\267\177\267\267\271\033\354oB\240"
+	.ascii	"\230b\2615N\350\30413Bc\265\2566\323\235VW[oZ]m\270\033\2213"
+	.ascii	"\2231\333\005J&\007\215\343\370*\253u\366\224\351\335>\354JA"
+	.ascii	"\340\373s[vU\227\322\374p;\373\3015\236\rq%\244\007S\007|u\034"
+	.ascii	"y\236\0312u*\363b\224\362@\366\203\025%Q\374\255\262\242\004"
+	.ascii	"\212\377\322\nD\240Q<\317\fJ\n|D&\350\311\273)\223\223t\302\033"
+	.ascii	"\"\337\262\037\262(9:\213\346+\331\233\261W\235x\364\245<\263"
+	.ascii	"()U\034\307\276\364*1fS>e\3429u\200\344\303D\351L,u\002t\345"
+	.ascii	"\220/\375\217\234\025\377\331\017q\034\367\033\317\224x3y\267"
+	.ascii	"Wu\267\210n \223\036\307q\274\224\2614T[\2325\205\304\376Q\312"
+	.ascii	"\346FOF\215B\270\"\241\3079\371\330\214\205\306F\271fD\302)\347"
+	.ascii	"\236"
+	.string	"\226\201\244\0372\321aB\322=\021^H\350q\030\272I8!-'\034\305\004\207\244\220\325\3255c\221\311E\337\324<H\317\001y\240\274\367\266[]UsPMN\231f?}\"8\237=i\016\252\305E\353r\316#|\362;\307\203\242y\250x7\252\2603.\"~\037\004\267\023^H\306q\254\241\233\205\337i\321\306q\214\301\016\220-\tN.\303\325\325\234/\254\3259\035\2573t\361\342\305\352\352\347\367.N\331wD\312\300\344\234\326\024\234k\365\034c\r!\261\177\324\355q\\\016W;\227\356\362z7\272\332\356\265\272\352\271\303\231HH\267#\361\373\272\231\305\317iq\034\017\351\214\245;\313\337\334\261\334\215\367\002\367\333*\370\255\200\375N\020\374F\360\373\256\372}S\271\337S\277\357\003\277o)\367\333@\373]\340\367M\340\367\035\005\374\206b\277\237\330\357\001\356\267\223\373-\300\375nr\277\003\270\337"
+	.string	"\332o&\366{\251\375V\372}\007\337o\340\373\375\276\037Q\001Y)d\220|6U\357\315\b\235M\362\313hup>\031\001\031k\016O\371\326\224\305\204\371/^\232\242\0012\227-\277&l?\031 \007\233|\224u"
+	.string	"r\026\241\225\363\323`lM%%\375\025a\373V"
+	.ascii	"\344\fkuT\2302\333\274\213\036!\374\353\360\332\332\ro\201\273"
+	.ascii	"\274\033\233G#:Q>\261<\244"
+	.string	"\035\312\027x\214\r70\310\266'\221\306\332\217\366G\032p\030x\314\0305;\3503\352Y\326\346\347\\\353R\006{&K\331\227\336@\315Nyt7\247\365\253\205\315\312\252\226\245\007\276 \037\351\005\371\263x3\213\236\2669mA\316\312N\006\3327\206,\n\3273\241\225\363\315blMEH>?\211Rf\233t\321#]w\177\202#M\367\3444\302g\004$\215\260M:6h0\223\301\313\245\344\217\271q\0210\007\263\217\365y\363/\003\221\305\027k:+\270\314\027\3413R\316\037\362DX\t\247\201\335`\267\325\3257[\255\325\271\371\227\177o\214\257\017^\266\223\334\234\233s\224\237\331\007.\306#\301K\247G\016)\253\007\210w#\210\325U\026M\016\333\323\211swEV\237\343mv+\3206\373\033o\320\214\023\315jNk\367a_>\272\3220\034_`+jx\355\370J!#G\326\215\033C0"
+	.string	"\355%!\307\360kG\027\330\214\0333\274\274\272\256\302\300\206a9f\204]\345\370\352\302q\345\005\026v%\001A\017u\314"
+	.ascii	"\273\3321\034\202]\275L\242g,\315u\346\0171\027\2256|7\214\004"
+	.ascii	".{7\266/\275\325\203d\026\345+\n\327\263O$\264\340\\\362\210"
+	.ascii	"\340&\021\032F\373\275-\005\206\376\020\354\004\n,"
+	.string	"E\212\234\247a\0245\331\236\203\334\341:\304\023r\266Ob\324\352p-\342\365\204\215\301\341\232\304\013\322\352v8\1774H\240\310\266\247U\316\003\204g\\\244 [e'\233\224 #\310\n\262*i\fL\361\373\246\274\037.\016p\225\357\003_\301\200\227 sX{\253\312\b\262*\211*W\355\321C\225\335\346 \345T\306sw O\311q\251|\300\356\216Tv\233z\321:\003\271N8Ug\304\226\024\201l \247xd\223\350\nd\251\265#\205\250L \253vch\212q\340e\013'*\237xK\"\335\334\274s\202\240\317;nl\311`N\353w\342P9F\317\245\301c\240rF\023\244\004>e\271\276>\347Z\007\344\247\354\0177 \263w}\242G\177\2352s\271\027\342\335\204\316\306\331\246\345!\231\306)c\335\341\005\201\025\250q8\250\030chD$HA\222\244\320\030q\005\304\020I\025\245\007\021"
+	.ascii	"\255c\214M\215(\2511l\0063\274%-\003e^X\305\331\345\242x\314"
+	.ascii	"\242\314\205\246\030\027\001[\245^\210`*\274\245\002\242\rXT"
+	.ascii	"\266xE\t\330\271\b\324F\354&Rw\013!\241M\356\334\215\352\224"
+	.ascii	"sB\035\233W\333A`\031\202\033\375\035O\201\271\241)\352\343M"
+	.ascii	"&\310\322\350\336E\003\253\317\201\323n\226\177*s\2522\271\021"
+	.ascii	"\311\036\fair\023\034\030\n\224w\345\307`u\237@:h-\210f\336\335"
+	.ascii	"rhv|\003%\325f\265*\374\264\212\253b\227=\324\030\312\354O\253"
+	.ascii	"\2669\033a\364\201[\304\257\276P\315\340\022srT*\266\340\321"
+	.ascii	"\310\354>\236H\257T\306\303\327<\004\231$\252\2473\302\300\303"
+	.ascii	"\005:\271]\340\251\373\321D\333\305\375\036\023\340\275?T(H-"
+	.ascii	"\306wr\273\232\327\237P\333\271\315\306\305\030R\213\341\035"
+	.ascii	"8\036{:\373\331\2679\bI)r\312\353/@#\307\233.\367\213w\204zr"
+	.ascii	"\b;\341\236\021\264\025\t\213\211X)`\246\351\017\276\033\267"
+	.ascii	"T\325\216;6a!!`\362A\355BJm\034\364\025\216\234.\205\t\007\251"
+	.ascii	"\344\251\353-_\357\224(\f\036\333P\b\0020\213\037\214\357\341"
+	.ascii	"b/P\026c\360\025\206\275q\2654l\"\245\022T0\0026E\317\334(l\235"
+	.ascii	"\211\n\315Tx\205#J\255%\220=\223t\214\340\371Q$u#\241\001\327"
+	.ascii	"=\323\013i~,U\326\001\326\306u\002\006Q\222z\230\355\374\005"
+	.ascii	"\341\264\230q\027\215\312i\313DG\330\331\037$\265\330\203\005"
+	.ascii	"=\215\230\310\231\376'x\365\b:\350\213\345\200W\031&\006HH6\n"
+	.ascii	"3\267\212\033^\02116g\003J\215|Pe\263\327\256\316\227nw\255\247"
+	.ascii	"\376\223\032-\3733$5\224\177\267\202`\323f\370\0371Ri\241\213"
+	.ascii	"t\3049;F\364\032\252=)\211%\306b#\275\270\317%\002\253\260\034"
+	.ascii	"\316w\202\372)\243\242\006"
+	.text
+	.section	.gnu.lto_accUpdate.66.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`*\001\315\r"
+	.string	"\306\031^D"
+	.string	"s\233\016\334"
+	.string	"t\007@\274\255"
+	.string	"v\375>\343 B\254\202\177\215D\025\004\266FI\0376\004\370\377\337\262Ix\333\240\335J\002\265$\322\213(\250F_j\345y\0244$\320\"km\362\030\364\244\355-S\nH"
+	.string	"H"
+	.string	"M"
+	.ascii	"U\201\217X\257\344\005X\257\374\331:\036\256\354g\310\230`R\273"
+	.ascii	"\213\305\022\337\367\311\3572\352\347\207\234D\227\027"
+	.string	"\312\243<\220b\003es\"\311\221\033#d\376r\345p*\251jJv\327\n\236<\334\325m;\260mb\037\f\177K\n\304\006G\025\373.\277\346\250?J\265F\365A\254\017a\212\207\206\035\273\035f|lLU\003\205\355olk\370\226\357.\030.\262\253\362\203\301\365\312\341u\265\257\342,\337Q\031\f\262+\"\005\215\335\020\201\023\\\017\242\335\335\350\013\226F\b/9J\332\303\034=\213\313\220\300Y\331\035\035\214\321\021\200\0215*\bQ\212\"\333\333_P\030`\177\356\242\003\200cw\027\300\274\205\005\377\304+{!=\030\262^=\232X\021\223\302\202\032\351\214\035\2224\222\260\003\336g\233'\0232\320f\022\201k\340\361tS\304{\240}\266\023\020\247\315\031\3128\316H\270n\003u\246\346\321\262\254\203y\263\3638\315\303\270\255\363\301\262\351a$\006\334U\320&\006\352\272\211m\302\221\351%\243H2\311"
+	.string	"\252\211v'\323\203\2261\031"
+	.ascii	"2\003\303\341\327X\270jI\317\024&\324\2550\317c!b\232\030 8`"
+	.ascii	"\b[\341z\271\304\306j\343\r\256\033\373\3215\240\030F\003\341"
+	.ascii	"75\005\356\005SS\202;\322\322\036\rL\355\001"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.67.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`\375\002}\027"
+	.string	"\226-\232F\260\332*\035\270\307\320\237\351pS\301\254\312\005\017\252?\345\206^k.\214\246bt\216\377\237\244G\223\250\260\275\366\013\365\035FJ\273\033\013\177J\177B\365a\317\312\362Q\264\217\330>\230#F\325%\215\354-wJ\001\210"
+	.string	"|"
+	.string	"\207"
+	.ascii	"\376\216\363x}\347\237\223j\325\371)R\353(\301\025\304S\217/"
+	.ascii	"\205\247\342\t\204\247\026.\274\f\373\230cQ@\267\273\371y\251"
+	.ascii	"u<m\r\357\347xO\330\302\036\n\351\\Q\302|[\354\241\027\017C3"
+	.ascii	"\274\317\335-\210JP\020\333\213\3239\240\326*\300vbR\250\265"
+	.ascii	"\336w\231\3026\223SF\207\363\025q.N\0049Pp\004\330h\323\301\224"
+	.ascii	"\031X\316\273\002\034-nR\206fj\255\2265\233\213[t\3331ls\260"
+	.ascii	"7@\247\337\363\016\301H\217\214\034\0367\231\f\332cL.\316\376"
+	.ascii	"\231|\331q\361\352\330\245\357~\222\245G\377\3352\357\335\242"
+	.ascii	")-J\351\020\225\016\2514\235\322\323\322;\245\345J\337\300\201"
+	.ascii	",3*>\035o\203\306\312\"\030\246J\241"
+	.string	"@7\376\373{\227\366{f\365\251s\306\n\237\035<\037}\237G~\217\373x\275\347$\257.\352Q\344tA\264\324ZM\247\326 \236&\230\322~\331#\333R:\006z*\226\320rf@\006G\f|\220\003\272\216\233\025\036/\342\372E@\030\330 \267\343\373GLm\213l\345\212N\302%mhO\3131\357'!\335pO\3031\223A\213\226\356\374\335\214\371\316= \206\246E&\2034'b\240Xk\305\340\013\371\220\032\177\347\324\254\020!\366\276ohq\253\362\005H&\203\273\265\326\330.\316\377k\255U\\\035\233\376\355\320\213bB\202\261\357s N\342\357\330e$\362\265S\337H\302\256U\t\324Ty@\265T$2\320\214\250\031\221J\241\b85\301\206\265\022\201j\251hT\251\024\352\344j\261\\6*\327\311f\205\2529\245Z\256\323\204\005f\201P\265N\"X\254\326\311c\375\fW\f\243\003\376"
+	.string	"\322\037\026\216<Z\317\310v\026\352\271(\247kr\003\224\246\313"
+	.ascii	"\220\244\265W\037\344k\273scw\2708%\347\235\302\270\005\361t"
+	.ascii	"9]\234G6\266\264\324\206h\272hSH\270h%\215\336\025\023\022\314"
+	.ascii	"=\306>\247#\\\264\245\r7 `\2021eF\0176F\340\262\204\211\316m"
+	.ascii	"u\214\351FR\006.\3662\272\032\035n\340&,k#E\003\327\273%9\237"
+	.ascii	"\f\354\335`W\"v\353\337kGV-\330{\347b\217\210WB8\"\005c\214n"
+	.ascii	"d5'\227\270K8{\241{\230\336q\354\004\352\302\022]\210aU\3127"
+	.ascii	"$\2636\003\201d\265\341\201\201\255\020\341\3450@\361\334\245"
+	.ascii	"\213\206\231\0263\370\0066\363 \300R\317\265\327\3224\rlA\001"
+	.text
+	.section	.gnu.lto_setAccelerationTrims.68.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"U\b"
+	.string	"&\220;7Po\322\001 yyXFA\235\347\252C\347\242\225l\ri\220\032\n-\313\255\241\326\375\330{\270\271f$q\200\310\324eT\321VU\312H!*|\202\310&{\247\024*"
+	.string	"-"
+	.string	"+"
+	.string	"\217\346l\230w\034{\360\321Bq\"\263\273\022n\234\373\343\374\223<\200T\022\375\0010\354\256\037\251tq\303\333N\260\335`\373\024\247\377U\002!/\245W\240\354Z\244f\026\025U<4\266\377\354\213|\204\373)\364\201]\223K\312n\247\340\205\353\321\335\013\254\307\353\004V\320\344\213e\0055\202\023~\320/\271I\310\357\260\004\350\235\364\350\203\254\307\007\214\030\220\214\321K\331\235\350A\r\373\325\356\256\241\311~Zu\230\234\332\331(\307\300\331\3063\267\017F5\b-\3130Y\351\254\036\255J\317\206udF\253\334 xFhT~\346\244R\323\355\253\r\t"
+	.ascii	"0\223\241\214i\3413l\234-\007C.\3016\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_applyAccelerometerTrimsDelta.69.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`&\002\235\017"
+	.string	"V\\dC"
+	.string	"s\224\016\233\006B\234\325n\323pWY]\214,\352t\313\212\241\362\215\370}$:T\035\021\240\276\271&\013`\226@\2479\2133\263\341\337\275\032\307\223Ju,RK\"\224~,\327\377%\237\333J\231RM"
+	.string	"E"
+	.string	"Z"
+	.string	"B\326%\256\210\350\330~\332/q\023\246\207'\027\331]\301Tv]\007\214@{\264\353\002\262G\355\001\262G\233l\037w\261\366C\242\007J\nlw7\005q\323\323\344\377\3047)\325\205\247F\301\356:S\252\r\267\336v\001\333\r\354\034\021o=\332\202I>\365\350\233d\217\327\3038\304\004\tO\031\263]\250\324\017\3663\273\273\326\225\375\360\007\220i\217\246;\232\346dz\243i-\323\232Lg\232\216\232\316dZ5\235\231\276\210'l\251\236!fWC,,:X\033=L\210P\243\032w\032+3T4\372\021\322!\314TF\f\030/\236\372\0215\313hj\324\017\013\006\017\250\214Y5\343\242\373\313\253\305Hc\001\241\344-\257\326I\366\250\372\027\036\327\324\243\f\261\204\247t\tX6\205\257\030\221\330\273\212\022\003\257\335%A\361\024\240\003\240\222\210c"
+	.ascii	"\216\272\357\301\204P\251s\020\201\264@$\362\276\001\016\215"
+	.ascii	"\220\274\256\004\3728\021\027\n\2016\360\363@\022\007n\244\016"
+	.ascii	"4\332B\037\270\215\020\260W\201\373\266\222\347}[\307uzfuem\007"
+	.ascii	"\020\227\223\242\354\321\0348n\330\350\250\207\243\232v\364\323"
+	.ascii	"\262QN\215\3560\254, \260\202\231\032\355\"\241\02730\206\247"
+	.ascii	"\004\326\220\217{0\2763\211\356\r.\310\337\204\220\304\356\365"
+	.ascii	"bZ\003\006\016\361y\260\016\241 E\212\361b\304\342q9X+q1\027"
+	.ascii	"\344\005G\374\031J\276\035V2\212\305\270\206\342l\237\201\320"
+	.ascii	"\246\277L\350\275\315\372\353\320L\3266\373\024\350\345E\233"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_accZero_saved.2.89.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"\005\001\006\025\001\002?\202\210\200\030\1773\273\0014\273\001\274\001\273\001"
+	.text
+	.section	.gnu.lto_angleTrim_saved.1.90.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375 *=\001"
+	.string	"\370\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001"
+	.string	"\005\001?\202\210\200\020\1773\273\0014\273\b}{\274\001"
+	.string	"\002"
+	.string	"_D\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_accDetect.part.0.104.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`\253\001\035\020"
+	.string	"\346]jH\360\2606\035x\276\350\253\006\205\303\340\362n\272\352#\373w\356\377\332\214fmp\237\204B\256\2355\270\205\033k\236F\315\203~U\365"
+	.string	"\217\023\002\226\374,>xe\346\334\342\201g\027,\346\203\216\363\231\257\316\264\311\336)\005S"
+	.string	"X"
+	.string	"T"
+	.string	"5\273\207\366\352\307\234|\n\317\270\002\032\236\335\005y\365\202\355\3652&)\031S\266MRB\272\364\025\f\313K\325\006\226\215\335\025\367JM\274t:\263\222?Q-\246\323\277\236"
+	.string	"\005\254\204\216\253\345\303g\3073"
+	.ascii	"&\273\353\r\304]o\333\201m\n\366\024\0208\177\371S3~\306\366"
+	.ascii	"\350\032\177C\232'{\nA\347\r\311\034\273$vb\021\266\327\326x"
+	.string	"\233\321\007\345\260\2472\226M\373,\316\"o3\322R\034\036J\225\310\253\037\254\266{h\244?\363\032\177^M\363\025y\025\244\315\224\332rX1<\273\253\220W3\330^?^@{)\363(\317\030224P\223;~@\263-\362\027\240\001\230\335m\340\303\036\303\340\237x\265\2502\217R\321^\377:H\215\234\025\035\027\215\323\354\231\2644\315\236-}\261=\375\032\"b\200\313.K\317\215\035Qa\250\216\363\267~\327\251}\373+F\277\305]<\2378\001\224@ \303\207B\277\260\033\241\204\335\211\347u\037R(\372\302jo$\004\202D]\370Y\370<\257\343\304\020\024C\237\310\205@]\n\347\205\"7\202\300\340\205/\344D \030r\237gK_\374\327!\354\270\264`\363/i\247\035\250MNt\205\322\322v\2009\017\322\354\n\001# @B\004\235\331\006\306d\361dc\f\221\b;\002tOi\257\332"
+	.ascii	"@\236G\230c\220\337\002\356\203\371\022!\035L?\2244\016\334s"
+	.ascii	"\271{\372\b\256'\247/\t\333n\333<K\036\370\373H-\261/\344\013"
+	.ascii	"/\205+\026\273X\013\253\021T\303KLQx\377\265e\f"
+	.text
+	.section	.gnu.lto_accInit.part.0.110.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`\304\004\325\032"
+	.string	"F\357\246G\260ZQch\013\2601\346\365\202g\023\026@R\203\210s,<\376\221\203*\376\214\343D\302\372\312\365I`$%\236e\250K\002\030\304No\250\315\030\365\324\223\271Px\370\202y^\234\036\206\325\337\263\315\312-eJ\001\212"
+	.string	"\232"
+	.string	"\221"
+	.ascii	"\254%\027SB\260n\031\210G\362$\272+Y\361+\344k\025-\005\241\356"
+	.ascii	"=!\334:\003\353\326'\313\"\375\231\373\021\034=\257\317g\221"
+	.ascii	"\3327\362$\335\217\340l\357=\372\361\344\336S\302\255'\260n\005"
+	.ascii	"\274\200\352\226\236\200\352\326>\021S\250\220\363\3316\205\n"
+	.ascii	":\373\374D*z\217\244\241\237\360\336\223"
+	.string	"\274\255<\356\363JE\037\237\366^\374\274\036x\007B\206Y\236\224^\3048\035pq\205s\3575K\306mo\033\203\355 \266\b\f\246\001\250o#\201\310eto\321\020\315=\262P\200|\351W:\226\330\3141\034\027\236\214zV\252\310\202;\324WEfZv\340D\202\001\300Lp\bM\320;8<\242 Q\211\nT\021\341\005:!\250\360N%\n\332\345 y7\204\310\264\354{v&\327\031`\204R\002\314\370\022\245\025\344Ex\357\265[h@Y\375\242\336\364'\366h\363L\266Q\302\230\366xk\025g\362\312\251\314\220{\357\270\362\225r\376\322\201\036\235\344~9\353\374\337\235x\\r&\2727\261\261~|\0016\302\234\2322\365\327\023#V7\335\024\350\336\235\003[/\024\344\321\241k\025k\235\022\202\252\265~(M\024.\302\230\234\007bh\035\203\246\244\020\3203\035\n\204\001\244{w\357\205\311Q"
+	.ascii	"\246z<\002\252?\266C\334\313\210.\\^\355T\215$z\217S\331$\376"
+	.ascii	"\204\263\261K|KN\r\322\275\327\202\226;\231\360}\334\372\004"
+	.ascii	"\n\372\036\n\325\355\201\247>\200h1*\022\265\243CZw\270\212\027"
+	.ascii	"o\325a\233z\365\363W\271\250\255\213Z\024\251\253\r\r\326\271"
+	.ascii	"1k\270X\002\353\334\260(S\2305\\\214\214\365\034\260\316\253"
+	.ascii	"u\243\2253ZL\306\223af\336l+`\256\026\035\312\333KD\311\3233"
+	.ascii	"{\215\200\301^.\303nh\246\354\366\252\225<%\f\366\"m5\323F+m"
+	.ascii	"$M\366\232\221\260\232\215\274i`\263\247\254\2217\323\254\221"
+	.ascii	"\343\305[u\370\300o\3502d\322D\177\037\325\252\272\260\275\252"
+	.ascii	"\306\331U\236\353\305Zw\330^@m\r\034\350{\246R\246\256\360\352"
+	.ascii	"\217U\325\366p4\270\2323\326)\215\224\r[\355\017\227rS\\\250"
+	.ascii	"\241X\001$\245$\020\tfH\212\322\302\001\260\002\221\272\332\034"
+	.ascii	"\0210\261b\222\210\005U\220\032\231v\003\214\026x\276\251YH\027"
+	.ascii	"\213\3327~\007\001'\3739t\236\311\001rj\266,Vb\206\013\227+\200"
+	.ascii	"\271bCv[\262e/\303\202\320\314\372\3403\034\332\256\266~\226"
+	.ascii	"t\365\211K\"\314k\267\004\335\274F1`w\027\233g;\230\213\305\302"
+	.ascii	"\314\276\232/\261\254\271<\247h<\333\347\261\206\214\032\300"
+	.ascii	"\273s\2050\262J6\216\002w^\213\250\267[\031bP\275\006@\277\300"
+	.ascii	"\370A\273P\366\225\t\352\224G\004\032\317\326q\353\301\222\343"
+	.ascii	"\221\233d\345,\325\342\210\312\2424_\211D/\351~"
+	.text
+	.section	.gnu.lto_accUpdate.part.0.112.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`p\r\335?"
+	.ascii	"jj<\027A@dR\007_\327\216\"\373W\371'\245v\022\354\370BQ\024\272"
+	.ascii	"\252D\331a\221\013%2\234\246\240{v\207\214\375\001\013\021t\207"
+	.ascii	"\260\037O\355\215-\216\362q\251e\245>f\245m\273\311\336[\246"
+	.ascii	"\224\002Z\001M\001c\001\316\234\206\306\246\361Z1\264\366\tu"
+	.ascii	"\304\227s&\321\216I\343jl\270]GPB\275\344\234mt\273\031?\323"
+	.ascii	"\035\354\033n\327$\352\274,\343r\316\301\033k\373\030\260\366"
+	.ascii	"g\007\273\333\313\200y]\216\357\220\221kV\2766\246s2\257\327"
+	.ascii	"\345h7g'Mc\353k\224\032\354\177w\202\371\334\016(gVC\353\377"
+	.ascii	"n\227\3630\257\317\355p\245\234\2418b\223\263\263\201\257\375"
+	.ascii	"\240\365\265\235^d}m\235\211\365\265\333\301t7\030Z\367\333\035"
+	.ascii	"\310\235\314\354\320?fu}9g,_q\033\013l\354\252\323\273I}\275"
+	.ascii	"\330\304\264\244\224\204D\034\n\203@\267\375\261\253\212\337"
+	.ascii	"\351m\027\363\"\025\325\301\224o\212\242\366\346Lr\\\205k\302"
+	.ascii	"9Q{\363%7Wr\223\362ILGR\027\360\265A\344y\320\230j1H\225\244"
+	.ascii	"?\227<Qj\370\313\340Dm\351B\317\203\246\304\237I>\250&9\3103"
+	.ascii	"\362\300_\206(jG\334=\342m\236"
+	.string	"K\345AC\242F=]\n\013\232\362\177jR\316\231\230f\246:\370\263\264\261g\201pk\276~2\215\210\253\352\202%\235!\3044\036j\021\317\223?\3014\262\307\036\365\005SA\311\2645\377%w\372e\3109\267#\253x?y\267\213\351\356\023\335\302\020\001R>\025\007\333\246\212\242+\306\201>X\360?\016h\003\007\017\036X_\241\370$\t!\177\252\303\367>x\2364\347L\241\033\204\373\021\341P\022.-\341j|\355\203\261\347\371\211:\362\371\246\207\212\331Z\365\023\254c\217B\347\207\354\027u\273\036\337s\242\375\255Q\250P\301\372\3528n\256o)\247\3049g1\214\331\372\310v\257p\275\243\220\231s\236\320n\307\357\260h\177\363\265[d\275'\263X_\375\351\217f\356\3172\316\020\362\247\217\331\032;y\306P\272\021\270\337U\3567\225\373}`j\370-5\374\216r\277\r\270\337\005\332o\002\356\367"
+	.string	"\367[\200\373\035\240\375\006\340~C\271\337O\356\267S\373]t\277\233\210\337L\354\367\222;\335\225\200\337I\303o$\3417Q\370=\024\272\337\301\3407\320\375v\035\317\273\005~\377X\367{m\277\325\366\033{\033\357\377};\006\025.\016i\231s\220i\243\314d\215Z\3616\356x\356q\234NC\220"
+	.ascii	"\326G5+y\340?\217\364\342\3722\231\323\n\202\004\033}\204\342"
+	.ascii	"\201\367\244}q}9;\261|\3652\355p\344\304\351\321\007\327\274"
+	.ascii	"\313\303\363\254\226\335\007\023\356\214\017\352v\355\3216`\035"
+	.ascii	"E\026\375\006y\323\346\364\310\2200\033#O\302\312\037mb\n\351"
+	.ascii	"y&B\336\271$\354j\374\233Z\3668Q\302#a\267\373\245\022cU\222"
+	.ascii	"\"\257\221(\"F:\340c\216\331#\237:\fv\210\211\270\337L9\366\323"
+	.ascii	";9/\314!f{\267{\345\253D(\315\031\371.\371\"o\023\t\314_+\201"
+	.ascii	"\365D\354^\310\373\244\315\031\351I5#\2254\255_\266\267\355="
+	.ascii	"\331n\227'\213\036v\2531O8B\327\337)\354\020\273\220\362@\336"
+	.ascii	")MM\342\177\224 \236\r\331(\3234\303\0041[\007\335\\!^\335Z+"
+	.ascii	"o[\374Q\036\330b!v\242\353q'\210}4\364\351{\030\233\336\354P"
+	.ascii	"\222\220\202w1\020w\277V^\270\367d\020G\361\300b\335O\306E\305"
+	.ascii	"L\376\330\233\345\002"
+	.string	"\323\327~\261G\276[\336.o\263\311\372\n\304\236\\C\376\264\313\247\r\245b>2\372S\352\310\305\236\347+\232\262L3\352\2663\347\334\366\013\206\375a\027t{\212|\321\013\346\225{\347\3369\326\327\037\366\247\253X\224uM\345\017\263\265\273\267\262\030\357\275\225?>k\340\217\035\021\335\036v5\347\234Y\006\376\230\305\236d*\250l9\366\323^q\242\206\026\245\032\034\221\221\310<\344*^1\306+\343+\364\241\001\223\220\210*\351\240\022\006\002G.\034Y\352\361\304\326\f.\0235\272\266\276\276lh\r\2173\270\276L\304\320\252\3015\342E\227\006\0312\274\276\224Z\353\252\313\213\253F\326\327\226\214--\255,\254\343\227\327\261k\353\210\325\305\2255\003K\353\353\210u5\325^4\266\276\260jxy}a\005\335s\006$\036+2!\300xo\311\312\247\246\232\030\370\024F\200\231\350\316\240Ux\216\034*|"
+	.string	"Wa\325Q\331r\fNC'0\337\030\257\244yTx\202\224/\177\327\320\266?\372n\214a\203\336'OX_\017`\227S\247\311$\205\3310\360(,\205\275l9\246\346\3274^\241\276{O\366\035\353kT\233:\275\245\234\322"
+	.string	"Fs\306L\001<"
+	.string	"\033 \200\013<\313\020x1O\206n\314{\343\261\276\016\300?Cq\004\340\2710r\0010\024\026"
+	.string	""
+	.string	"\007"
+	.ascii	"\363\005@\203\367\322\305(\344\002\205\177\206\214D\237\260\226"
+	.ascii	",F\341cq\302M\370\t{\331\225\"v\302_\247\214\357J\330\241+f\316"
+	.ascii	"da\211\336J\230\242\004\322\234\311&TI\021\306\250\375-\314\021"
+	.ascii	"\353k\021_I\2112\370\267\206\"I\317\264\206\237b\024\2725a?\343"
+	.ascii	"\277$L\243\245\\\364\333\236\251\325\376\326a\323WL\214\365\225"
+	.ascii	"\t\003\225o\232J\344O\227\306\336(a\266>\262K\026^\365\327\214"
+	.ascii	"\355~}\274g\357\311%\354\342N\217\f\213%Ux%\334\001\201\n\250"
+	.ascii	"a0\345\030S\206FFD$I\222t!\005\204(&1S\017\022 e9\307)\307L\231"
+	.ascii	"$\245\205\375\032\003\335+\3374\277$\013\266\216\207@\255\006"
+	.ascii	"DS\256\263 xn\237\314\030\244\365V\353\356\362n\330\0264S\305"
+	.ascii	"\340\354\303\030\037%\326\251D\231O\327I$aF\240Y\324O\325+WX"
+	.ascii	"`\300_\213:P$\b2 \"A\236\376\250&UY\225\254\006'!\342\226\336"
+	.ascii	"4'Y\266\315\264\rJP`\"S\340\240\224\241\242\252X\206G\336\030"
+	.ascii	"%).\304\314*\037\0202Q\374\f\356\260\315<\23696\336\222i\360"
+	.ascii	"\3067\351\235Q\312\361\330*\005B\370rxt\214\332\302\367\227\003"
+	.ascii	"\231I\221\031\3053\031\031\362\001n\334\265\332\314E"
+	.string	"\311\353j]\225Nd\262\347h\377\013\375`|g\033\027\343{\241c\241\r\310\034\036I\353M\257E\215%\353\321E^\311\004\335\210\321g\332\372\215, \263c\036\257\235\315\316\b\240\237\307sXX\343\314s\006\002\325&\343\021\202\350\002n\305\264P\004\262d)\r\201\355\341iTn\356\037\313\241\275!1\245\034,b\353\245\035\355h\006;\270\275\3029\264&\020b\023g\214|`\253\347o\320j\237\261<\030@\244\341(\363\227\235\200c\225\272p\005Q\211\177\211\304\3119\017\270#4\222H\250)\212\2115\313$0\307.\226t\235W\203xPlm\371\226l\364 \366g\300i\307z\234\233{b\2361\347=\234~T\246\205\203\300\213\253\315\336\035\t\321\310:QEL\247\375{\031:\234x\306k\004j\255\343\0041\004\020X2,\246\205\344\227\023\017\347\225\f\377\nAL\273\234\037\025\\x\bx\371."
+	.ascii	"\241\351\016\237\246\036\206\361\210S\205\004\350Fd\267\362>"
+	.ascii	"\264\227e\227\366\030\032\231\307\301{\0346\315\004\033z"
+	.string	"\270\262j\240\217\341\037\325\244,\300\241\306\271\361\215`L!\331M1\242\201\312"
+	.ascii	"w\245\365\237pb\225_\370\212\357&)\337\316\276[PH\036\375\310"
+	.ascii	"\331Y\317H\003"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.part.0.113.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`,\002%\022"
+	.string	"\206cwE\360\320&\035:M^\352\24000\275 \350\210\200\360\252\341#\365Q9\210\346\373\372\213g\371\353T3\253\307`\030\305Ve\333\301v\364\026\003\317\300v\246\237\223{\235_w\364\213\036lK\3550-\331{K\231Rc"
+	.string	"d"
+	.string	"\\"
+	.string	"\245Cw7\020\017K\367\210\207\366Kx\204\204\365\032!i\331\365N\207\246\200\214\247\302\017\322n\267\035\252\007\353_wk\272\016\237ft\371y\001\326r\250\225\364\374\361\330\324\300\211\021\004\313\360\367\006\354n"
+	.ascii	"\030\314k\260\273'z\312\300\\R\001\3100<=\036\265\222\335uI\303"
+	.ascii	"\255\3356\213\355\bvr\001I8v\003d\001\342\263\177\350i\337\037"
+	.ascii	"\"\022\022z;\333\2073331\342\263\373\370+l\002b\371\003\246["
+	.ascii	"\330\253\307\007\362S\374\247u\025n\361\255\331[\320\221\005"
+	.ascii	"\331\330]\220CC(\035~\274\364{X\266\311n\331\246\303|\307B\320"
+	.ascii	"m\315\313\232\366O\234\247u\024.z\307nN\321\321n\027rh\007\001"
+	.ascii	"\273\253\032\263\315\340\327\250\007|f\214bnl\244\300?R\261\221"
+	.ascii	"\377\301wQ<\\ \003I\237B}\214\210w\273\210\251\252\217\t\361"
+	.ascii	"\222I\276\246\236\350\360eC\343%\006P\016\227L\262^w\267%5f\215"
+	.ascii	"\377j\216\355\264\0265\r\337\375\357\245\365\245\363C\367MO\366"
+	.ascii	"B\300\315.M+\023\n\334CI\340T(\226\007'+(+\247\023\347\341\223"
+	.ascii	"HJ\312D\205S\241NP\247\023\267\255T\251U\nj\265\245\230p(\333"
+	.ascii	"I\265\332D\02285\001\245\332TR)\325f\372Ws\b<\337\0255M]\342"
+	.ascii	"\242/Pc~\007\022\f\02247\263U\016\326\377i\314p'\202\334\264"
+	.ascii	"\223Q\2572\266\035\362kv\360\231\001\2237\254\177\033+ `\202"
+	.ascii	"Aw\266\r7\"PAb<*\360i\230 \327\270\020a\247\250\272\216\355\030"
+	.ascii	"\315K\334\331\213\037\255\276\021\216\030\235\nNi\300\003k\020"
+	.ascii	"\336W\262G\351<F;\232%v\231\257@\251\220\200\001\200\342\271"
+	.ascii	"KS/\336k\222\253\f]l\200zX\023\266[h4.`\007\305\023\347\n\322"
+	.ascii	"\337{-\306\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`\037\004\025\023"
+	.string	"V\234mH\260ZM:<\374\220\353\016\304\016\226u\335\273\203MU\244;\377r\324\037,\261\021w'P\376/ \265\333:KHw\021\016N\347\251\321\033c\306M\277\313\\$\312\376[\355H\305l\365\323 j\004T\bA\204\310-SV"
+	.string	"b"
+	.string	"Y"
+	.ascii	"#\316[\021\375\253\020o\242\265\222K \372`\346\207{\361p.\035"
+	.ascii	"N\305\341S\033\276E\303\265\020\310\360\336\244\224\3460\364"
+	.ascii	"u\363\002\315\302\017\370\\\001\004\025\216\005\344\177Ij\363"
+	.ascii	"\001\377\327\320Z\351\322Rh\t\263\352\230\376\376\241\202\354"
+	.ascii	"G)\245\023:g\376\007\007\004\317\321\320\001\377\036\270##\242"
+	.ascii	"\333\020.\350VD\373\222>\210v\300\031}'\267~\271\2753K\306\310"
+	.ascii	"\3507ab\206\310\217\241\376.FG\230B\ra\3028\324\213S\001]\364"
+	.ascii	"\203\031\324\017\323\242\035\324\252\246\220\260\350\006+z\366"
+	.ascii	"\251h\031eJ\321\t&\212\276\230y\202\307DO\t\006@5\022\217\002"
+	.ascii	"\0036\245\216\310\256#+\262\253\334] \362M]\331\020*!\241\310"
+	.ascii	"6\005.\026\262\332K)I\242$\013\371\246\234\205\f\200\\\001d\200"
+	.ascii	"8\311\226y\364\243\354\350KA\352?\035\365\247\030\365\241\340"
+	.ascii	"\372Ot\364\257\024\365\245r\364\255\340\350W\271\321w\262\321"
+	.ascii	"\357\362\217ij\364\263lg\325}\200\003\f\024\373\266\356\2121"
+	.ascii	"nU\355\214*\363\245\bl\344V}\215\314J\352\031yI\237\221m?#\307"
+	.ascii	"j##\301\276\232\335~80\016\313e\036\034f\355\326\300\223\021"
+	.ascii	"\236\353\305\233\264\253\204\346\212\267\363b\026\271\253\243"
+	.ascii	"\224\346\210\334\262\332\331\256\251G\0239U\250\201\020\263\246"
+	.ascii	"\rIJRXi5\260\002!+\316\003\021\320 \205\320HT1\022\314H\017\306"
+	.ascii	"\022\251Z\004\245LS\3042f;S\235\200}\363\307\227\352R\036\305"
+	.ascii	"\274\3744L\244\305\300\342~_\236\357\373}<_\317\347E&v-[\203"
+	.ascii	"iR\224\230\037q\362\361[\231zX\260\256\310\257\371K\355\026\322"
+	.ascii	"[Y\356\255\207\003\361w\016\304\216T\310:y\301\214\177\271\b"
+	.ascii	"0N\242\364\321'\244E#s\222\310y(\213\275\344{F\327h\275\347R"
+	.ascii	"\270\316\344`Z+\263\006\253+\006\\\311\337\267%\263\224\254\217"
+	.ascii	"\244\003\271\326Q\003"
+	.text
+	.section	.gnu.lto_.refs.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`\005\0015\n"
+	.string	"\366\234H.P\207&\351\210\235\231\231\231\231\231\231\231\231\231\251\310\324p\342\224\244\240*\376\020\265\177\002\037\354\373[\243\331\377\376\2665\"\226\020I\266L\0018"
+	.string	">"
+	.string	"<"
+	.string	"?\375H\363\220\206;\3307\030\3360\2745\276h\\5\236\324\223\275\210\2068\376p\337\260x\324GHOI/Q\037I\377\270o\3243\345-\361\325o\372\2248o>\376\030\263*\003\336\376E\236%\2442\037t\360\027,\276\202~\202\346\0214o@}E\363\024\016\237p^\202q\002\354#\230\037\300\274C\373K{\206\366\013\352\243\006\2670x\002{"
+	.string	"\352)\345P\303_\023\326\r\311\335<\257\036\236\326\b\352[\234\213\225\233\353\003~"
+	.string	"\342\005\372\025\320SL\370\304\344%\312#\372\020\345\r\375K\271B?R_\271?\200zK\372\220r\207\344v\372\214\347\177\017\267\316!\355,\316\326/\250x\341\316\2043\020O\320s\262\200~=\206[\340<*\320a\271\237\336\221u?\312\031\226g\242g\226_\224\257\365\252<\225\263\027\300\271\225\263\246^\013"
+	.ascii	"%\023\260\323b\344\021-xE\334\257;f\266ll\340\213\035H\002\306"
+	.ascii	"F\367<\312\327\301\240\001"
+	.text
+	.section	.gnu.lto_.decls.c9d038b1d2f677e2,"e",@progbits
+	.string	"(\265/\375`|V\265m\001jf\346\205U \fQ:\215\001\024\364\374 \024\317x&\367\030\201\350\323\344}\211\314<\264\300\231\3600\034\347<Fu\270\353[UL\253\222w\251\201\307I\346\332\247 7\273`*\227\003g\312%\236\356\260*\027PI\337x_\263\3219\b\206W\r\2212-\211\334RJ\231\0028\007n\bk\b\373I\235\215\263t\036\224\234J\270\221\3469Vg\341\352\336\215\327\227\2312~{7}B\204"
+	.ascii	"\352\210b\326\225\361"
+	.string	"\263\023\375[\272\271k\345\004eM\023\245\253\322\002\304\342\377\325i\345\254[s\373\334xa\261\303X\374|\246\237\305\364\263\020\375\314\245\237m@\261l;N\255\2620\213\237\251\240d\026\372\271I\327f\315\220}jO~\023\375k\362[\264\332V\327*\220*NI\024\213\217\372\351\334\223\357V3\344&\336\201\201\345t\262\370h\026}\016\212X\260\253DJ\253\365\b\362\334\273\371\337\222Y\263\352\264e6\f7\367N+\263H\354\230\316RsO!=\367\370\302\366n\206\360\t\221\243\346\247fF\306b6\311N\013 +~X|t\207\030z\245\2172\031\261G,\025\223.4F0\237>\276b\205\324,f\322<Y|\354\246m\020\353U\235\366\353\370,k\243\355\335\314\271\314\031V\332,~\005\221w@\344c\247>&\323\347R3d\313e}\334v\331\036\333vu\220\2657\323v\355\254\331\233\271Sk"
+	.string	"j\r"
+	.string	"\026\333\362R\313\3708L\037\377\320\177\326\f\331\352x\335\033\301\336p\201\212\024\016\213\217u\350\337\371\325\f\331f\325\f\231"
+	.string	"\265'\377\231\245\203\315\232!\327\252\332\223\217ah\253\267\331+cn\370Y|\354BW\251\332\223\177\371t\315\2621`X&,\2304,\2660~\373\242\222Y*\233\265\367\322\336{\003\216\333\232\246\031\026\333(+U\235\227\263S\301\245\346F\363A\267\364a\361\257\027\235b\357\275\353\3452\360\357\357\357\257^.\343\324\236\\\235"
+	.ascii	"\335B]\267\271\2465.\016\240\227\340\326\306"
+	.string	",\376m\013\026\327\311E\326N\333\273y\001\250\206\004\016\214\305\366\311\247\2329Sf\303\342\3378\375J\326T\313X\346m\272i\266-\033O\333T\233\365N\207\331\334T:Yj\\]\371Y'\273\302.Y%\313T\235\266\251\216y\345\253d\236\330\246\372\245>u\230\315-\005\\R\205\005\257\346\351,\233;*o]]]\371\355\335|U\033\341\201m\252zu\3576\277\200\316-\253\347\336\315\020!|B\204\b\221\3035\005J\024\034l\227hu[\324\266\305\277M\375W\333T\247\335\365\f[es\233n\272m\253\305\323\356\252\244\232\321a\362\354\245-\026_\026\370\272\2562^\343\223\323#\313\b\016\213\177\271\364\253\332[\233\277\252\251h\252\263\246\251~hij\224\272\246\303l~`su\025\266\367\016\341\023\342\242A\263\362\314\370v\214\276\265\322\367j\346\257e\325\fm\357\275\341\006\306]\027+\213G"
+	.string	"\275\366\345\260\270\034h,\276U\323u\327\f\231\247\366\344\333\"\272\202\251a\252\363"
+	.ascii	"ULs\307\376`\343d\211\305\267?\364\353\001\362\375\373\253\007"
+	.ascii	"\310\267Y\272r\251]\252\363\202\352\345#<\370]\236\355\344\264"
+	.ascii	"A\322F\215\305\267U\372\365\202\\\377\352\005\371\266\205\256"
+	.ascii	"y\266j\251[^\363j\226\217\360\3408K{l\357f\315\303{3k\r\200N"
+	.ascii	"\255\001@\345\2000\227d|\313\244_\375\264O\315\220\257p\300Q"
+	.ascii	"k\312\022\303\253R\255Tg\265\253P\224\324'\365\216\213\004\261"
+	.ascii	"\272\247]e\253u\365\216\213\2046U\236{o\016!B`#}f}\031S\361\301"
+	.ascii	"a\341Gf\361k\232\376_\245\324\271JW\345\252\263N\251p\267\315"
+	.ascii	"\275\323\332\342\332\324\336\240T3\267\272\246\203\356\235\305"
+	.ascii	"\366\265\367>\007?\320\353\224\032\245\256y`\332;\013\253\207"
+	.ascii	"\t\206\005\033\277\275\267O\210\020!B\354<i\335\030c\001\277"
+	.ascii	">\351\033\351\023\351\237\320\027\201\336\240f\310\337\200>\t"
+	.ascii	"\375\327%\257O\352Z\315\332\033t`0\t\273\262\270\242U&\325\311"
+	.ascii	"\241\246\275:\251jG\231\315\335\334{\357T>.\245)\213yj\206lk"
+	.ascii	"O\276\002t\007\346\366\340:\032\005{W\016\271\376\375U\016\271"
+	.ascii	"\236\001\275.\371k\222:\326\223\245\252\232;m\357\275\023\302"
+	.ascii	"\017\035b\026\337\332\223oA\337\352\0175C\306\265'\377\256f\310"
+	.ascii	"o\326\fY\327\236\374\337\003m(\216\213t\305\352\336\215\300o"
+	.ascii	";\200\344\267%\270a$\300\376\033\302\177W|9\362\327'\035\030"
+	.ascii	"\271\230\257U.\325\354\257\021\270\227\213\377:W\247T\021\006"
+	.ascii	"\360\271\226[\344\267B\035$\374h\t\277\235\2731j\332_\233\326"
+	.ascii	"\352\231\005\352\212\377\006\271+\374\267\353\277:\376\213u\005"
+	.ascii	"\203\0375"
+	.string	"\373o\002~k\242\352\277\227\277n\251z!\240\301\301\1776}\377\357\217\346\274\376(\020\370\327Zw\235\037\355b\371\362~\013\345\322\370\253O\375r\017X\266\234\037\305\372\355\326\235\361\327]\233\177UZ\n\177\341GK\\\020\277EAF\305r\345b\256\n-\0068\003~\314\346\267s1\376\323Q\371k>\253r\245R\251>=\027F\235b\342J\375\367\305\177]\324\272o\360\343\274\275\374\243t\377\305\\\025\307?\n\367[+\227\305o}\376\373\364\333\031\327\351\257\366\277\031\370\357\212\246\277>\371-\b\277=q\231~\273\341\277K\277\355p\225\232\374\365\376\227\251v?\260d\362\327\244;\202\375_d\n~\373\201\377\036\236\027\005\377MX;\007\374(\331\177M8\301o\227\374\026\355\232\340\252\370+\016\306\375v\0037\351\246\370\t\006\370m\007\336\341G\211\374\266\352\252\360\327]\2274,\374\250\210\377v\370/"
+	.string	"\376{\301\177-\370\357\206\377r\370\257\207\377~\270\003\270\350\1771\3747\303E\361\237\347\317%\376\212\377\213\251\026\216\376\230\3567?\352\365\237\356\277HW\371\327\374W/'\360\371m\334q~\324\307\3774\377\375\336\346\377\232\277V\373\366_\377\350\326\177\223\377\035\376\027\004\377\325\300\177-\360_\022\376;\302\177!\360\337\006\374\327\203\377j\360_\004\374\267"
+	.ascii	"\377\035\300\177\003\360\3332\277\345\373-\333os\374v\357\267"
+	.ascii	"]~\253\367\333\274\337\332\375\366\312o\247\374\226\306o\351"
+	.ascii	"~\033\367\333\267\337\266\375\326\311o\235\277e\362\333\256\337"
+	.ascii	"r\375\226\307ou\374\266\306o\255~\033\365[\250\337\266\370\355"
+	.ascii	"\323o\233~\253\364\333\375[\024\374\366\004\277U\361\333\024"
+	.ascii	"\277E\372-\362\267$\370\253\322_\201\376\372\200\277&\375\366"
+	.ascii	"\304o;\374\225\357\257b\376\372\364\333\021\374\325\313\177\023"
+	.ascii	"\377\327\376k\371k\004\376Z\377_\371o\201\337n\340\257\027\376"
+	.ascii	"Z\301_\203\277\025\3766\004\277\365\300o;\360W(\177-\373+\334"
+	.ascii	"_\333\376J\367[\016\374\325\347\267&~\213\302\1771\377\325~{"
+	.ascii	"\201\337Z\340\267\026\374\225\314_\307\374\365\371\3270\177\005"
+	.ascii	"\363\327/\177\335\373k\227\277r\371\253\336_\361\376\212\345"
+	.ascii	"\257w\177\275\362W\273\277Z\371k\225\277\326\375u\312_\251\374"
+	.ascii	"U\312\177\023\376\332\363?\205\277\336\374\325\302\377\024\377"
+	.ascii	"\353\376o\370\373\373\373\373\203\373\347)\372\033\260\003Nh"
+	.ascii	"\314}\301\tmOm&\274\251\272\233Z\313\275\224\265/\354\245\315"
+	.ascii	"\334hYS\037\234\226\264\246\234\320\230S\027\234\320\264\246"
+	.ascii	"6\232\326\346\331"
+	.ascii	"KL\251\247\245-ua\243i"
+	.string	"\215\331hYS<NhYSNhZP\252\023\213#Cb|\311\362\321V\2258-\355\027P6\230R<wN\315\254\315e\357\232\326\264\245\366\335\336\002\330\333F\226\024\027&\215\352\246t\367B\351\t3\2536\367\336\034\240\224\266\262\366\322\335\262\356;\247\"Y{\027Q\"\332P{\357\335\301\262y\267}\324\273\245\016\033\333E\323\336\035vso\250\275\227u\337\355\275\227{o\240\224\215\346\336W<N_PP{W\371@m\033\313\267\246\275m\232\027\267)'\264\255,\240\267&h_{EsY\235\\d\355\257\315EKJ\243-\225l\027{\357JF\177M\301\340\263\030\357\351\225\305\253\331\334\273\271s\343v\303I\f\213\257\3400g\260a\261\370\025\360\250\202\255X\330-\304\320,~\005SU\352\356\2066\344\351\212\305M\fU`/\346^\235x\016K\t:\355=\365\001L\313k\314oKUe"
+	.ascii	"dC\267\324\262\030\323\341\210\351\361\"\211\305\277\300E\377"
+	.ascii	"\202\026\0208n'\270\205\fVZ\035\216bi\264\030Be\361/\260\341"
+	.ascii	"7\354\306t\333\303;\303m\370\210\363,\206\237\305\257f8\242*"
+	.ascii	"_W]\333!\346\371\305\345\271w\263\307\032\035O_A\366\236\225"
+	.ascii	"\317\207\337\n`*\037\227\032\254\032@E\362\250\f\261\362\004"
+	.ascii	"\362\352\362\265\303\351\266\310z\361\325\306\203\251\315m\221"
+	.ascii	"\303\t\365\274[\376\333\342\206U\345\323\252{:K\236\255\244\347"
+	.ascii	"\202H\035\020\220/O,\370\b\026\262\303\356\271w\263\362m\325"
+	.ascii	"\347\212\026_;\216\340\037\365Y\357\2706s\t\202\025\274\037s"
+	.ascii	"~L0\031f\303M\\\206\307p\030V\303J\260\031^\303Mp\032\206\202"
+	.ascii	"\301\260\023\213a'\370\f?\301H\360\022\234\004\243U'>\202\215"
+	.ascii	"T\360d\2477\002\377\002\017"
+	.string	"\375\013L\372<d\364y\362\364y\246\350\3638\321\347\t\323\347\331\322\347a\241\277\323\247\277SE\177\347\211\376N\231\376\316\n\372;V\372;K}\0350\372:S\364u\322\364u\276\364ut\350\353\300\320\327\331\3729]\364s\352\364\217m\340\032,\316la\263\370\252\34682\327\304\342\347\244\351\3271\030\230\tG\325;.l\327\366\3543\303f\246\246\356\255}\3355\027\215\332\327e\343\304\003\373\244\356\351\334\275o\244}a+\\\205\2450\025\246\201g`\0318\006\236\252N\f\003+\035/\331\035wK\032\261'\3176\230Y\357\252B\b3{b\030\367\314E\003\364\361\266W\346\267w3D\315\022\313\302\205\001\277\270dV\254\b\261\3709X\372?v\201[T'\206\302M\307O:L\236\275\273\302<1TU\202\305\272<3\0212mS\031\277\252a'\314\002\257\250N\374\264\344V\327\360S\215R\327,"
+	.ascii	"\021\242g\347\027\002Y\266C\215\306\307\311\323\307\221\323:"
+	.ascii	"\265'\037\347L\337?\274\253\323\007/\361\224^\330\260\3708It"
+	.ascii	"\nv\365\311\377\253>\3718F\364q\202\350\343\364\320\307\311\322"
+	.ascii	"\307\221q\375\360\f+;\202X|\034(}\034&\375\0335\032\204\232!"
+	.ascii	"\377\267\314%\363\305\255\217\314\342\260f\232\005&io+\370\312"
+	.ascii	"\274\330ei3\346>k0\333\274,n\206auq\"\306\372Y\245('\\\230\353"
+	.ascii	"\344\0257'\007\306\nX\006e\345\364\345\356\201\300c\f\223\305"
+	.ascii	"M\2554\003\357\315\313\027\272\204\212\030\263K}\202\242\252"
+	.ascii	"\252\214\313\325\263^v\2601i\371\325\373o\336\335R\367*\025\235"
+	.ascii	"\226\227\305 j\206\214\326\236\\\313\200~\265`\035f\242\206d"
+	.ascii	"\271`\2479\003J\007^\315\003&\231\333J\303\262\265\034\033)Q"
+	.ascii	"\356l\023$\226\024\277+\034\200`o8x\330e2iZ^X\2613^,e\251b\231"
+	.ascii	"\300>-N\250\324]*um\215\t\031\225zg\301J\212F\217)w.\347H\026"
+	.ascii	"\026P\026\277\222\375\226\306\235\263U\326Jg\251\271\227\037"
+	.ascii	"\204\271\272\362\2231gg\214\020su\345Gw\245\\\271\033W\235w\356"
+	.ascii	"\276\375F\271p4\356\234\275\252O0_{7\357\234\305\272n\313\020"
+	.string	"\276\354\340\216'xZ\026\360\315\256\031r\375\252=\3717}\372\266)\241\t\342g\361o\276h{\343\354\206]3\030\004\200\313a\265,\020;\344*\221\322kLPO5\227\351\262X\362\367\245E\304*\251wi\233\271\005\342m\207\345a\273@\300-o\213\263\353\342m\365.m3)I\200\031\2262\033~v\005\f`)\263\021\366c\204\007\367\254\342\325\274zW\265\227c\b\3606\246\314\006\007\277M\373=\263k6\r\bMR\023\330\361\364\334{\237\335\250\013\346A\311io\252\016\314\224hmY\035\365\256j3\227\035\300M\225\331\360[rf\235\365y\233nz\005\023\026\227\355\242]\265\353\274i\027\312]\273\315\273\3446\271J\356\223\353\3442\251\316{f\331\334\326\2606\254\2323\273\346.\201\320$\025|\301\304\311\236\375v\311=\263Ll\223z\307\265\367T\007oB\312l\370\355\275u\226\330p\323\003"
+	.string	".\253E\230\314\212X\374\233!c\325y\311.\222\245Kv\305n\222z\227\266\367T\002\220L\211\331\325\032uJW0\276I~\213\303fY+\033t\353Be\304\342\337\310\320\277Y\352[\340\323\367\b\207\035\035=\230y\026\337\002\236\226\2720n\363k\004\245\027\317!\327\310%R\235\267\310\322-rc\\.\020\232\244.\240\004\365,r\205\274\212\007%\247\315\314\261\201\0204D\312p\023\256)84\276\205\036\372\265-\213C\275\343z\300\2205\263\035H\236\227\353\312\2708<(9U@\312\223\312\247u9\235\340\336Zi_c:\304\236d[ \352]\232\bnc\317\275\233\227\353\362\270\234\316\022\317^\n\022\366\254|\227\353\346\340\220}\370\360\222\342w\203\334\257\353\343\002\271?\356\n\327\353vU\347\345\272=B\370\240M\230\370\251\251"
+	.string	"?\210\247\037\254\323\017\302\351\007\327\364\203g\372\301$\372A\"\372A\0377|\354R\f^\224\305\017V\351\377\267\306\265Q\235\027\353\322\230q\255t\200\371\272X\367\352ZU"
+	.ascii	"\246\013\2175~\227m\257\f\223\214\257\351\364\177\255n\325M\033"
+	.ascii	"2\2546\267\352\322\320)\363r\241\303\342k3}\035\246\257\205\350"
+	.ascii	"\353.\375_\252\013u_\330\256\021\240N\236\352VX|\247\200~\251"
+	.ascii	"\230\270\\PY|\200-}}C\333f\315\220A\324\236|\rC\177\250=\331"
+	.ascii	"\351>\255\320@\362l\304\265qZ\221%ms\261\370\256x\230\354e9\227"
+	.ascii	"\346\314UZ3\343\315\313\342\003\361\364\253\3632\357\022J\221"
+	.ascii	"\247'\026\337\345?\302\203\232\207\263=\340\244\251b\027\303"
+	.ascii	"\342\367\331\277\377A\235-emp\177mt\240\360\266V\033\313&h\206"
+	.ascii	"\013\233$\026\0378E\037\030EoP{2\032\037\273GF\243\211\305\007"
+	.ascii	"6\321f\354\231\352\264~\326\355\326\211U[\362\263Ol\033\260\313"
+	.ascii	"\323\317\276\3312\365\256\212g/\205a\363\254M\346\332\360e\234"
+	.ascii	"g\307|\371\"c\371l_u\3322\267el\024[\247\263\274\2607\2175_e"
+	.ascii	"l\025\233Eg\251\271\251\262\230\275Cp\b\021\342\306\305\016\254"
+	.ascii	"\245\306b\354\263:\355\030\033\246\213\005S\357\252\232\233J"
+	.ascii	"g-\313L\031\2771v\213\345\342A\311\211\204\270\275\247\206\353"
+	.ascii	"\212\363\221\361\201b\372\267`n\277\344<\265\021\321\363b\367"
+	.ascii	",\310\250\272\213\263\370\300"
+	.string	" \332\313\353\013!Lu\026\037\270C\277:\017\306\352=\f\376Qe\006\231\305\007f\351\003\255\364\2012\262X+\366\256\336\245\211`\027\346\271\367\306\263Z\252\323f\261X\262X\270\272W\357\252B\240\"\346\251\343E$\tY\306\007>i\f\266\344\264b\257X\273\235\223\023\006K\256\210\305\317\177\372\331O?\227\321\377\355\024K\245:m\235\225\342\323\334\001\271Ku\276.{ysG'\312\n'u\026\037\203\031\372\365u9\005\365u9\347=o\371\203\301(7vhY|\f^\350?k\371\203@\265-5\276,>\006O\372\0300\355\3542\026\037\275\307\244\244=o\21504c\260\334]\262\035emw\371\n\016\036\230+jh\210(M\321a\361\001PF\212\224\\\245\347i\313\214\224\312\304\204$*W\311u:<\2420\t\253\243\302c+\b\220\034*c\320,M\261a\326\311\215\025\312X|"
+	.string	"\220\271\335-\317\325\263\035\305\301R\317.,G\214\013\213'\271\3479\265\035E\256X\234\337r\\\360\306\262\311\2168\2703cnm^\270\261\251\"\225\243\340\246L\206\013\220:"
+	.string	"\330PS\313l>F\370\264S\315F\r(\317lav\316\\PAcq~B\367d\306\306\342\274\3666)gP\236"
+	.string	"pJK\273K\237\254\253\007#L\032\364\315\310\033\22064\264\334\244\236\355(\f`0\366\342\374\314\322\340\221e&\317Mr\372\230\334\225]\220\303\354f\371\354wi\337\200\362\205\323V\305\211\247\344\371\254\022\371\202%\306\342\334\\\363d\305m\357\177\020\3352\363\245\315\342_\300\002\f,\223U'K\364\256\202<\302"
+	.ascii	"\211\313c\317d7F\310\2745-\316I\316fe\256\315\r\213\337\227\305"
+	.ascii	"\374\352j\034\311b\031\t\230\2730#esm}]\302.\022\214&\246\246"
+	.ascii	"g\361=\270yye#\036\300\242\234\241\202\243\367\004\243\227\213"
+	.ascii	"<\033isb\366\221Y\234\2772\221\377\301\235-']fd\"y\310\233\016"
+	.ascii	".\346\022\23455\370\364\262\020\024\354\026\321\022\273{[5\302"
+	.ascii	"\206D\255\354\307\217\f\304\001d\360\326\334\230aA\306i\205g"
+	.ascii	" 8\213\331\026.r\377\203\331.jM\032\213\357\001F\217\036\331"
+	.ascii	"G=\333Q\nP23\023\266w\025\b{E\306\256\213\353\331\307-\264i\032"
+	.ascii	"\263\006\367?\270\201\227\037A,\276\005e\362\216\274\003\245"
+	.ascii	"\253g;\312\207\310\222\262\247\337\336U p\022=\2506\213o\001"
+	.ascii	"\232\376\363V\336\262,@\360\354\245<,\267-U\225\201\235\202\305"
+	.ascii	"|b\361-\370a\346Y\311L\316\001\244\264\231e \336\360ld\260\363"
+	.ascii	"\003\314\005\020\213\263\200L\275-S,\276\0057\364\353\330Rn\372"
+	.ascii	"\362\314+\366\236,\262\213z\307\365\200#W\236\026.3yPr\"a\314"
+	.ascii	"\313\323*\277\3103\330\374\236\331*?q\251\221q\344\033\331F\256"
+	.ascii	"\312W\031\253:\263U\206\362\311V\331\351\001c]\236{7w\312$q\322"
+	.ascii	"\340\301K\007\343A\311\211\204\2620\317,#\323\250\316<\343>\034"
+	.ascii	"\344\0319*\307\270\201BF\254\b\207\0209|Z\270\324\310\370\317"
+	.ascii	"12\214'\315\036d,\316TU4\352\230,~\2076\372\317R\325\231\247"
+	.ascii	"t_\330\233\0320\377\2037t][j\364;\364\351w\340\222[\350\274'"
+	.ascii	"\226\235\305\357\200\247\337\301N\277\003\235~\207(\372\035\240"
+	.ascii	"\350?7e&4*e\354,\3763S\335\263\342B\311\342wp\242\321\277\274"
+	.ascii	"\314\314?\270#\346\306c\315\342wP\242\237\367\377\240\005\272"
+	.ascii	"\256\254Y\214\353\3452\312\346h\233?h\353\274\276\240,~\2071"
+	.ascii	"}T\r\272\346\017\352p\t\342D\211\305\357PD\037M\363?\210\256"
+	.ascii	"\375\225\261\262\030E\243\233:\3608\200\005,6\0345\3203G\321"
+	.ascii	"\374\250\237\375a\273T\374\2619cqN\355\311\366\005\320\32137"
+	.ascii	"vsO3\213\337\341I\243e\3202!\b\001\363UG\326\264d\3619|\321("
+	.ascii	"\n\0065\223\261\230\325*+\306\026t\314Q>\234\275,lf\320g0\311"
+	.ascii	"\226\025\364\211\212\211\242V\346\345J\\\331.C\303T(@\252;\272"
+	.ascii	"\025\026\237\003\235\336\333C\343Hx\343\363\261\343\005\237\305"
+	.ascii	"\347P\246\273tA\351\364\346\360\246\345\005\r\020)\026\237C\227"
+	.ascii	"\376Q\275W'\252\207\263\200\310\332T\035\220\301\3731\227\317"
+	.ascii	"\334\265P\262\370\034\252\364\217b\251N\024\013\232g\317\366"
+	.ascii	"Rg/\307^YP\257\r\031\022\213\321\274\037\305C\263\240Zj\025/"
+	.ascii	"P\264\254|\305\260\270\336\325\f\331C\355\311\367QS\207^\251"
+	.ascii	"C\355\252TA\355\3642\003\330\215\033\216\"`V\216\332\211aA\245"
+	.ascii	"g\361\373\352\363\177\020\233\021\251\342a\361}\310\350\373h"
+	.ascii	"A\247\240SP\272j\244\252\nD\016W\233\226\f\213\357#\247\3219"
+	.ascii	"t\016\245k\300\022\273\347\256\252\002Q\305H\211!\305b:\024\257"
+	.ascii	"H\020\265$pph\034\t\033C\022*\2346*Z[\026\307\371\360\320oo\230"
+	.ascii	"\317\007\354\f7)3\333\262\370>Qkh\333\032\312\206>A\237\240l"
+	.ascii	"uK\365e\032x\300e\222\270>(G\331r\366\240|xY\374\276\263\t\231"
+	.ascii	"{:b\3617\364\351o\210\323?\352\244:Q'\326*KI\200\t\326s\303\230"
+	.ascii	"\376Qgu\242\316\313U)\355d\272\361\334\220\245\177t\205\352D"
+	.ascii	"W@\231\004C\220\213\2022\371Q h\020\024\215G\2254U\026/\321P"
+	.ascii	"\272\266\300,\376\206)\rTD\212\220\032nc_eS\200\210H\371\332"
+	.ascii	"{\207\331M9rD\312\323\353m\365.\255~\315M\031\3626\235\340\336"
+	.ascii	"R\222\270\241e\350\030\332D\225\240IP3\364\fE\202\222U'*\206"
+	.ascii	"\202\241b\250\221\267\351,5\367\n\300=\346\031*!n\252\334\234"
+	.ascii	"\270`\300\327\300\247\257!\213\276\206;}\rV\3645P\321\327@\247"
+	.ascii	"\257!N_\303\233\276\0066}\rk:\177\251=\371\032\224\240]h\327"
+	.ascii	"\231\006#\372G\271P"
+	.string	"\256\372\344\350\322\326A\366\265wU\0069B\304\230(Y|\r^<x\324\275z\266\243,\2548\343\243\302F\314\026\037\026_C\013,T\013\013\325\201n\035\325\201\336@o\2409\364\222\003\233\263\233+%\25504\353h\016 \023\01751,Fq\340\273\377A}\244/\215\233\206\245~\206\247\376\321\032N\264\306\325\253g{y\202\223\026E\374\366\256\312\240\322\361\t\261\263\370\031\356\364\024Z5\205Z\345\275k3+J\352}G\255\202B\210l\271\260\030\245B\251P\032z\211A\216\317\216-\255\221\2413\216\322@mt1\002\305b\024\006*\343\177\020h\325\307\006f\361\217\312@cT.O4\\mn\333\227\272\274$v\377\203\267\f\216&t\026?\303\234~\006&QQZ!x\371\221f\3613hAA\325\274z\266\243R\240\362\032\013\303\301TD\214\305\307\260F\377h\013'\332\242\346\371d-\307l"
+	.string	"7D\347!\351\222\262\370\030\256\350\037u\372C\237,\214\272\233\244("
+	.string	"\225\346\211\301\212>\206)L\370\017m\262L\275\335t\024\2505O'\372\030\300\364+\222\2122\377P%\333\004o\256\275\251\200\256\f\331\031\034\203\017}\fV\372G7\272\353\023D\026\223I"
+	.ascii	"8\246\327\230\337\336R2\300vQkX\026\037\303\222n\323\346\n\263"
+	.ascii	"\307\212\376\361\232\352\304k,\013\f\354\315\243F\002\336\360"
+	.ascii	"\356\230,(K,~\317\231\376q\032'Ns\251\\\247\315\334"
+	.string	"\nAN\353K\377\370\f&\203\375,\214\007"
+	.string	"\321Ie\360\236 \372=]\372\230L\305}N\334W\237 6\223I"
+	.string	"9f3\203\367`\351\327\372\314`\016\006\363\325\275\367\256\332\3131\036\310\341I\201\370\361\230c\276\235\025f\244\330\236\225\311\344\305\363)\246\002\316)d\354\022\307\305\036^\032\034\246\2361\002\243J\223\305\257\340O\037k\301y\307[\276\005\357\351\275\367\262\271\243|\314\206x\215\371\355\252*\020\331\210\223-Y\330\313\361^\235\341\243\017w\371\037\3049S\207\005\243\013\346\022l\001\366\205\206}\312\351s1\304\005\326\253ct\230\0318,~\005X\364_o\377\274\231R{o*\264\271\245\224p\362__\321ZA\3749\365V\001\374\307{\233"
+	.ascii	"\202\275\227\300d\355\275k\031M\244\215Y\343\303\376\377\243"
+	.ascii	"w{/i-\037\2405\265\244E\303\tMk\352\202\023\232\326^.\005Y^\220"
+	.ascii	"\332ZK'\264\275/,--E\310\232\nI\243\"\322\204\006\013<=\312$"
+	.ascii	"2-\"&\025\r\215\305\021\214\027H\026\013\020\244L\223\027\234"
+	.ascii	"\350g\310XD*\223\032\212\212\220\214\306\243\021\250"
+	.string	"\024\246*\212\311\254\302\021I\244<\032\201B\303\264\b+\323\244Qj\224\223H\0208\321\217\262h,\232\200\034\341\303\b'T@Y4\226\320s\242\237\224\004C!a\b\022)\t\206B9'\372\021\341!(-:14F YB\212DR\016S!\036\0244\234\350'\b9<\236\020A\200aQ\003\030\222\212\216\216H\\\020\246FE\245\021\t)\202(\204\2012M\301\302\211~D\034\213\033\362\211~\206\212B\306$\241\242\362h\201 #\t\024\303dO\322\321\261\204\217\362D?CG\"\206\216z\210F\244\033\243\220E\223\302\241#\034\245\3208t\204\032\207\216.\221r\310\230\026\345TE1\211\223\216\216D\214T\036\335\240\024\030\224&\221p\022x\244p\350\350''\t\251L\026\207R\024\206\036\206\312\242T\004\022IEGGC\017I\f\311\022\210\304\241\017r\250L\201H\034\366\\H\032\"\221$<"
+	.ascii	"\207:(\020\211C\016A\2511M!\220\034\222@$\0161\240\240L"
+	.string	"\223)R\003\207\241!2EA\302x,\222P\246\022 \022\207\037\222\033\224F\244c\211\240T9,B2B\"\022\207\026(O\364c\301\210$\233\024\006\r\221JP<\241\263\301\t\013t\302\2168a\201\206v\304\320\002\245\260#RX\240$;\002\2218\f\252 A\211TB\350\250\002D\342\360\006=\321\317\020\322\2114HDPQ\021\351D\032t4!H$\016y\222Ai\320Np\203\037%rx\364\243$\246J\036\243#\362\204\bD\340\250LQ\fS\020@j<\212\200DJ\016S\023\n\220\242(*\211$\214\307\022D\"\t\017'\352\006?'\356\016\320\217Q\021i\"-\0322\016/\344\214\370\tJQ\f\223\302\035\f$\214%\030\300(U&\223R\020v\2700\254\034\374\f/\211!#\016\221H\302\by\024B\246G\027\b\215#(\323d\212\302\320\321\005'\026\221\2511\035\322\357\340\003\r>"
+	.string	"!\005\360 ,`\203\005l\220\017\302\002\200\200\026\360\001\220\376\007@W\251\024&3\220\032\025\225\032\303\211J\"qx\225\302\021\034\244\3024\350h\0022=J\323\0238'\3729\"\223\206p\202\212\216D\311\024IdBiL\215R\024G\023\216\310\244\241\017BGE\3024\211$<*oT\020\twT\020\361"
+	.string	"\001\215\020\252 \3020B($tT\"\021\225B\307\244\217\n\303$\2412M\n\t\035wT8\026\t!S\024\027 \0011%\"\346\\H\217\222\224\302\021\311\344\360H\205c\221\020I\204\022Gd\322\320\006\241\320QQ\217\n\"a\212\241\322\230\022\221\351\221\220H\031TTaC\tnT\020\t\215E#\036d\232L*\032\032\207B\"\242\362h\024\032\223\202*H\026S\f\205CH'\322 !2U\026\025\205\204Gd\322\220\206\2404yD&\r\345(O\364\203\"\r:\"\223\206D\f\035\371(O\364\2434\246FH\302\013$\214\216\312$\022q\347\210L\032\252 \247H\203\214E4\211\004\201\342Q2\017\rM\030\223\304\234D\202"
+	.string	"qD\221\004qD\321\202R844q,\002\207\206&\212\312\024)PiL\215\202I!\2218D\225'\372)\200\362D?I\"\345\320H\204\361hdt$v0\252I\241\360H\250'E\021\251\034\232\240<\"u\224;B\340\211~\224D$\24429\")L\221*\221\214.\220\200x,\022\n\263\322\210t$\n\205@djT\341(\024\002\223\3104\211d\024\nu\220\261H\002\2410'\215\305\243\244P\b,J\205\302\240R\250L\026\213xN\364\223L\217\222\224\032\004\245\310!QR\003\021Ie\361\204\b$\343\220\006)\220\214\305\"\r:\370@\370\001\b)D\244AHEDcQ\0042\211$B\001\312\024\251\261hhD\246JcQ\0304L\221D\312#\241p\003\212\024y$\024fe\262X$\024\346\241r\030$\024\346TE1)\024f\022\020\217E\230\230\"\205\022"
+	.string	"R\026\215%\030GP\026\215\305\214T\236@4\"\215\0204LQ \022I`H\nQ\244\"\020\211Cm\034!h\230\"\2632),\036\245 \224\212\220\036%\231\020\226pB\n7)\3218T&\215E\255\024^\240\004l,\236`L\022s\361(y\223\302\022#J\270)1\242\204`&\216(\336\023\375$\221NpH\nM\b\342A\246\312\344\320('\223)2(h\bLQ\f\213R@:2\322HB\024iP\022\351\204N\nSb\021E*B\022\351\304M*L\217\222L$\221N\004\323\243$e\022\351\0040\211t\342J"
+	.string	"HH$\016\263\nC\024J\210@\"+O\364\203td$<\"\223\206R\024Ed\020\002R!\n\033x\260\301\007HGF=\306cQ\211TtL\246H\013I!\206T\230\002\322\221\321MV\026!%S\024\214\307\242\222\230*S\021\220\216\214*H\205\306\241b\321P\250c\034*\026\221 \022\207:)h\230\2420T\016\203\202\310!\021\021\247A\307\022\306c1YD\221\"q\220iQQQ(\243H\203\256\n\022R\345\020\205\264\350\310h\230\304)!\002\t\"q\230S\242\361\002\312\3440\255\200\222DP\252\034\006\035e\240(%\022I$\213\034\224\302\021\034(\215E\240R(\r\022*7\234H"
+	.string	"I$!\021QY<!\310H\242\250\350\210\354\251 )\034*\n\031\217%\220\25125:j\025DB\241\243\"!\2218\264\240\024\202\2404\026\221\200)r\250B\020rXt<B@\210\"\223BB\242\241\"\221\220H\034\342(\205\322 \016'\372\271\340\307\243\024)By<\"E\334\004\245\312\264\350\310\350X\342D\261hH\304\220\264\240\250\350\210\304DDe\361\bUa\230t\223)R\321\020EF\022&\215\212H\023Ib\321hhL\022AI4T,\022\312\240\024~"
+	.ascii	"\2444\026\201\007\002*\361!\003\026\220\200&\376\030\217E\345"
+	.ascii	"\020\231\026\245D\342PD\022yL\032\323\244\bcqh$\202\210L\212"
+	.ascii	"\370\t\200\nC\344=\"S\017\020\211C\340\263\231\233-pf\362\304"
+	.ascii	"r\223\035.Y;\\ \301|ag9k\342\322\224\001\313d"
+	.string	"gR]q\300#Fz\f\261\273a1\360\013\370\005,R\267\224\232(@\"\007\026I\200\013\256\027\300!;Ka=\250\200C\200B\260\022%c>l\215+\033l\026\377\303\234\376\201^\300 ^\2224\331\263\332J\215\230)@V\250\200\023?\250\346\223'\245.\\,\217\363"
+	.string	"v\275\002\346\336J{\337\300\n\201\f\336\217\271.\240\017)eg\224\370"
+	.ascii	"rm\273.N\274\246\255\262\222\306\016\330\003\033!c\352\222Z\303"
+	.ascii	"\201\003\250\343G\216\2752`\326\201:\266n\222\2505oli\365\350"
+	.ascii	"\n\033r\325\314b8\340\360\2009\260R\260\306\0223V\344d\274%\261"
+	.ascii	"b\361?\210]]\001\261\252\024\237\b%\034WW~\273*\006\b \026\320"
+	.ascii	"F\034\363\315\013\320\006\260\006\2161\007'\004\211\231.n\026"
+	.ascii	"\377\003\017\375\003\2552\020\264/h\330T\261\001\231p\231\341"
+	.ascii	"\240\201\352\330\001\013\303\004lF\366\321\004l/M\006J\347\304"
+	.ascii	"\212k\313b \025\020\306\2011\016\214a\2011\356\337_&\323\342"
+	.ascii	"\314\030(\005\224\252rT^ca\037\366\213\027h\\\020\b\216\n\320"
+	.ascii	"\005\320\005JW\267T\007H\3160\030\323?\260\005jw\363\345\356"
+	.ascii	"j\251I\305r\212\327\023J\343>\303 \311s\272febcM\340\212\271"
+	.ascii	"\026O\374\200MYZ<\031cgqs,*\352G\326\022\2327'\005\n\234\305"
+	.ascii	"\315\261\275\233:\371\310\n+\336\200\314*a\317'1\340\022\313"
+	.ascii	"\235\037\023\026pg2:wf\177>\376r\233'pQRls\211L\031\27186\231"
+	.ascii	"\r7\301kB\262\006e\002\374:\323A\245\246>3\r&5ki\260"
+	.string	"\024\271\034U\274\320\034EC\303\206\356\210\037j\005\001>\027;\316`4\177Xj\366\216N\232,Qg,\230\022\0301,\316\362\254\227%\223\271[p\366\362lG\001\333\352\324\\\371m\247*\0207JZ(\301\022\346\231\3143\337\b\017\016&\354\310\026\246\305y\314u\252\254DyZ\374,&?\377\240\005\";\320\300,>\006X\372\032\234\315\230\232\2628\203\261E\300\270\030cq\376r\271*=\277\036y\317n+\213\222\305\231K\205\336\250C\222cjD0\346\030\216dJ1\245h\2046\311pc\025@ PT \222\212\306\321v\023@\303K\254\264q\242g\035C23\"\"IAQ\n\205\351\312\026\332\376\265M\235\t\177\b?@'n\322\0346o`\270\345\026\004LVeo\317\223~&\377K\254.\342\253\345\332\316)\3770\366{\205\313l#\321\251O\306$\375\247\3074S(\032\331\237\323,"
+	.ascii	"BM0\303\006\t\264\226\222\277\272\033s!\206\003QV\340\367\034"
+	.ascii	"rpu\224\230\002V@\253\031~\303\023+"
+	.string	"\356\214{\230?)!\272$/1\003z\376\206\005\226\322*\031\2161P\007\202s\322\226v\204\220'\355\247\323R\017\350\375F\326<f\317\205\314\315-Q\315K\033\003r{\250\001\245\317\225\204\350\253\313\330\316\312u\267\266\275C\334\327\371O4\334\340\230\n3\242e\262K\016\007\344J\031\032\301\262;W\007\362-O\314q\364\270q\030'[\001\001\312\361|\035\245b\026\206\206\024%\276\017g\200\023}\340\304\351\307%\347\212\367\256\207\340\372\256\240*\205\360\340\254\035\3009\364\3209S\001(8&\256\206\016Pf=n\254\202\361q\206\204,\017gDM\227\025H\246\210\337\213|n`7\235e\324\317\320\374&eh#\325V\347[+\263\215(\355\351o\263\257E\205\371>\376c\333j(d\307\207\333\331^\254\354p\334\3625\372\222\271\376\f\177\242\302\257\224\005\307'\352\370\202e\342ip\301\025\254Pa\332"
+	.string	"\215:w\260\277\375[8\270\2748\r\354D\037+p\210\374\002<Q\320\257\225(\220Z\001\211\024\261\241-G<,:\356)\315.\263\333P\2549Nw\350\367\2618yI*W\270\362?\235\314,\300d\020\373#3\211\351\f\002\001u\257#\250\202<\220ls\306\370w\334\207W#\244\212MW\031\2427hTZ\020\223\220\253B!\264\243U<\2647\2161\357?\313\034\230\266\316\020\242\246\220\317L\274I\250\024Ra`\350Q\3555n\210f\233\210\016\270q\001T\332\316\351\315\314RC\261\320Q\313\342{\324\334\2254/M\315z{\263wBs\027ba-\304\036\316^\026\346\354\335\356\007\227\325\223\221\346\037\260W\247\234{\371\fr\365mR\243@{\321/\275\271y\031\353\017A\214\324vx0S\001|"
+	.string	"Mi\244\253\024qq\233K\374\301\255\226\"\210\273\204\356e\tF\313w\222:\300>\026\0045W\007PH\024\002\275\034\r\315\342\265\003\005\346fh\333e\352\334\313+O\375\212\016[\231*\245\277'\303P\246\217\027\036W\001f#z\351V\317\257\361\372\364\003\034\315\\ NW)\240l@F\223o~B\265\371\0251\275\325\360\223\325\\\201\321c=\006\337<<>\026\310\332[\353\246\205f\037\037`\352_\214\210\345X\324\317\240,\r3a\3000Y\262\314\267\313\363\271\352\030\025\021k\254\305x\2724\323.\371A\006+\343\230\356\013E\331\034X'\3229\245\353\270\177]\241kT\016Wc\304%=\374\0061~5L\364Y\215q\215Q\r\231n\212/\025\266/F\356\336\004\235\335}\247\234\223\333\232\207\351\021\241\243M\036a"
+	.string	"\231\244g(N\306\312\350\304~\3215\334\257\234\250h%;mu\377\220\201\224\356\235\201c\353\245a\341v\354\267\242D\004\242\2044\tR\213\223\267w\003\212`w\211[\034\305\223){\200\bY\264![\327&\202\200I\005\214G\224\246\212x\365,a\237,\205\005\314\016<\264g\207\377\356V\213\300\334Q\264\212\f\314L\345Se\034\212{\372\334^Y\300\367{YL\315\f\373"
+	.string	"\246\267\251\256\306i8\004\273\345\021\344Y\332\345\203\301\331\027\227\250T\260\035|,R\377\246\0355\314\0246\237\313.\244)\230m\273\341}\366\251X\235\017\216\261G\2575}4\201k\266\213\241\332\016\b\343\265z\240\027\264\004\002\375/\260\227RA\ti\"\314\363\200\340\256O\251\354\024Gx\340\215\241*\206\230v\257>\t4K\254\313\232"
+	.string	"Q\301s\003\n\243\203c\f;\204\236M\265\371Zpk\002\275W\351\340\243u(w\273\273>R=:\221:\030n\317T\345\200\032\374\307\213H\035\207Cr'\303\266\240\360\236^>\360\323\0038\264~\2747\371\"&\213L\304(>\336\022M\331\024\273\223\030Q\261j\310\221\273\327X\357\236\301\365\265\261\017#DXG\002\267o5p\215\004*6\006\037$\216b\b"
+	.string	"\272\r\260z\317~\354\251\nR\\U`}"
+	.string	")a\364\304\273[i\032\320\231*T"
+	.string	"\230\017Bn\302["
+	.ascii	"\3065R\263sm\n\201n\2201\313\200$2S\314\305\217\035\206\251\353"
+	.ascii	"\271\332\367E#]\240\260\003\300\024t\b\035\036\263\311\267y0"
+	.ascii	"\353\no}{\306\364l\311\251`nl\337\326\271}\253\031\277H\327\257"
+	.ascii	"J\016?\337a\250\376G\r}\350\002\227\332/\023\006?\325\026g\366"
+	.ascii	"\302\244_\007\266(A\321\346\361<\372)n\345X0Q\240h\325k7\241"
+	.ascii	"0\307\235\2747\003>j\0365\304hZ\201\006~\037jCF\332\370*2A\254"
+	.ascii	"\033\301\320\031\nO\350\024\0138\315\201\001\355T\372\356QZN"
+	.ascii	"gR\t\0353PR_\330"
+	.string	"\207~T\306\306\367\261<\212e\0034Bf\350\261\224\f\004\345\230\252}\332\350\253\227\312\362\351\364\36331\f6\365\223\373\003\255%{\255\005\242N\250\234\244\r\233w\307\251\016\300\227\b\347\371k\200\261\006zb\242k+\342w\202e\bhn\367~\007\301\323i\020\307\350'>lH\320\0035\312\021:e\271\226\206\376X\017\203\366y\347I\330\366\371\362\353\333\037\f\266\036*\305\r\317\213T\322"
+	.string	"+\006\376_U\212H\020<\224('\233\206\023!\366\353\t\215pn\3728*I\250\216\023\203D\233\305\003\032\341\023<6\003\314\266\0135\317\364\341\221\211\230\013\270j\274R\362\r\301a\207T~\333LW\301\363~f\323z\r\351i\001C\t\006\342\031\222j\365AS\254\254\r&\b.X4f\374m#p\326\204\351h\006\343bP\330\036:%\220\314&\236\206\361y/\331\200\240\311\352\023\340\007\200\270j\304\343\364-\272eT\\2h=#_K~)\346\222"
+	.string	"\026\352\366\365]\024[\204\006\027\373\252a>\355\311\031u8\204\235\032I\016\344\201\202O7\2047\271\035\214O\366S\345u\003Q\372!b\3743\233F\204\210\023i>9\266\335s\340l\347/\032IxI9\354\n_$\300R\360\243\216a8xu\231O\203s\303\322^\re\204+\004\024HU\217;X\353v\030P\023V-3\310\2313 \312)Z`j\242\321\277ZK\250\331g\330\024\247\321r\251\253\356\360C\307Q\326p\231UC\\\231\253\240\177 \005\017\b\377d\275\006\210\276\375\323\017\305\303\312T;h\214#m\243"
+	.string	"\2643\\@2\323\244\2066\265V\205\217\001@\315\303\t\356\205X\254N\020Z\2742\331\244r\317\007\225\036\001\\\254\334\347\235\274\340>\254\272G\216r\263l\035-\227\255(\301s}/L\022-\260\362\032S\214\016Qv\201\f\b\321\337V\370\250\037\337l\332\224\200\305\374\372P\034'\221Q\\\023\220\370\315je\231h"
+	.string	"\022\001\326\357\272\271w\004\274\326g\243nn\312\320r6\002\260Hb4Q\036*\213\256\310m\003~\203oY\201/\253\227\212@E\345\006\016\315X\025\276\004\037\215sb\311o\264JG\322\302n\211j\210R`\2605\036\371\ns\031\034>J\352\373\340\355\274\353\310\363Dy\f\r\\n\bWN\f??K\364r\032\177\211\023\214\210\326\352\007B\322:x\374\361\005\363\357~w\rd\344\233\276\"\003\351.\266[\370\252\247#_\b\240"
+	.string	"\233\355\343\244j\267+'l\257X\b\315\r\032\032\374`X\372\253\006Vr\300\340\252\200\273\351,\311\031\031\304\0329Rw\376\342!\241'\261\031E\rj\326\255f\251X*f{-\345^\351\003\206\223\037\"\313\333"
+	.string	"\321\247\ny\307\373\2154)Q=\363\323\377\216\343\351\301p~/\355\207\340\r\301\313\366\037\376\316?\213\222q\240\374CO\234\216\360j\245\315+\275Q\226\332|K\271d\306^2,p#\310\216s\215_7#\361\354\255\265\374\230\"b#\246\370\004\275P\346X\270\334]\n\023?\251\227\337\005ez\354N6\223Qm\237M\3458P\361&#\215Hf\315+1\334\304\334\360(\336\263C_,\353\305\243\230!\002\3412u\216\013~\231\326\231\304\333\211\353}\2522\375{\360z\0223(\371h\3612\002\362\277\240|\370\002\367\242V\275\217\252,\321\004\003\251R\343\n\013\373\030\305\210~\232\021mDv\247\005\321\377F\230"
+	.string	"R\020"
+	.ascii	"\007@\224\222V\336e\241\272b\322\234\315\002\020\215\277s}\306"
+	.ascii	"\247ol)\211|\333\372T_\325\305 C3z\323\223\312\005>\255f\\\353"
+	.ascii	"h\264Q\247\0053\214W\332H\003L\223\225\035\021:>e\032\211\266"
+	.ascii	"\027\302\322\021\277D\305=i\326i'\310\276\365\253\2211\266\351"
+	.ascii	"\320\023"
+	.string	"N\226t\207\336\265\302\f\332aD\322\265ul\020J\271\235\2452\252\233\300!R^p\345\003\203Q\366|\325\342\0327\320\230f~\fG\235\352\353L\r\n\305\252#\340(\315.\315\273\246/O\301\371@\370%\374\254\233`x\322\270\022\2660\206\220\305Yf\303\352\005)\031\355\310X\263\254\366\006^J\337\3570/\244\345\262?P\016nq\215\013\230\204\355\035\t\036\202\316\214\301R\246X\354\244\213\352\2009.\215u\313\331\256\206\335\004\216\207\262\024u\342[\376YS\265\330)f\367\340\303\272q>\336\330;p>\002\341\020\202\243\200\345\202=\255v\"\037d\341\031f\277W\206>\331&\317$~?Y\260,@\304Ya\323\302\257\251w\347:D|\200\257\207\266\334^\016\314|\0278\210Q\262\354\342\241\005s\307\313o\353\031t@0\264\034P/\301=1\227@\\\326\241\035\r\315\244\325\320J\230\026\024\304"
+	.string	"\030\322\003\375NEZ\250!\0059\274\322\002\342\210\332u8p\236\206\217\354\351\013ha\265\357\203\302\242\330\037\\\020A$\376\243L\375\024|\256\224\367\203\374\200\367\031D\274\320\340k\224\307>~\341\345!\023_\032\203/\020<3\362S\234G\236\302k\2419\353\267\317\220[\303\364\324g\354\227\374\331\326\016\004.\267\371\223\340\340\216[,\377\272\332\242\341\022\033\231;\247\2727\321\312\276\335\265\235\006\206\305\336\n\276\003 y\003\013\2767\373$\316Q\316CV\377\355$F\235\345Q\034\227z^S=\217\351\362\203\356^n\016m:\326\365\207\235\217y?ly0\244NN\177\225\321\212~\277U\272\003\225}J:\274\274\333\342\373\262\347H$\337w]8\337?\253\376"
+	.ascii	"\363\016Gh`\335\325\226\037\323\336H\026\372\"\360\211\360\351"
+	.ascii	"NW\322\217\265\347p\311\327\022J\316\020ly\323\271L\367\325\363"
+	.ascii	")\335\237\372}-\361M\340+ \026`\361\221\221\267\204\367\204L"
+	.ascii	"\274\254\236\321\266K\370p\336{0\237\335\365\003\3721\325>f\377"
+	.ascii	"\206\227\340}{lo\367\353\2209\347\336\247X\273\004\202\325\315"
+	.ascii	"\336\355-\2440\357k\002\253\367\362\377\t\245wK\017\2147\275"
+	.ascii	"\2713i/\001\377\260b4\360N\277\013\036~\200\374\315\325}\367"
+	.ascii	"_\335\335\"\375\314\357#\304\335dd\370\344\227]G\362\342N}\177"
+	.ascii	"\224\364\n\234\214\240\353P\334US\336\227\356hO\375\333R\354"
+	.ascii	"\007\321;\302\017\\e\250\247\305\353\241\201g\204\301\256"
+	.text
+	.section	.gnu.lto_.symtab.c9d038b1d2f677e2,"e",@progbits
+	.string	"pgResetFn_accelerometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"resetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"accHasBeenCalibrated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"accResetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"accDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"accGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"accelerometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"accelerometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"buildRotationMatrixFromAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c9d038b1d2f677e2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
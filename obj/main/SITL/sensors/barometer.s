@@ -0,0 +1,886 @@
+	.file	"barometer.c"
+	.section	.gnu.lto_.profile.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375`\026\001}\t"
+	.string	"d\f\n\002"
+	.string	"\036"
+	.string	"\245\357\300\317\017\026\002"
+	.string	"\002\001\002\002"
+	.string	"\001\367\255\350\337\016\n\002\003\002\003\002\004\002\004\002\003\002\005\352\263\360\321\b\003\004\240\342\234\212\n\005\205\320\323\240\004\016\003\002\006\006\007\b\t\274\205\242\255\006"
+	.string	"\n\267\335\335\337\n"
+	.string	"\013\200\333\377\224\002\f\r\342\315\302\207\007\016\215\251\367\230\f\017\350\300\306\254\005\002\020\347\327\360\252\007F\002"
+	.string	"\002"
+	.string	"\002\007\002\007\002\b\002\t\n\002\013\002\002\013\002\f\n\r\002\013\003\016\002\016\002"
+	.string	"\002\017\004\002\002\013\022\253\327\227\253\013\024\025\026\027\030\031\204\323\252\315\013\022\002\002\017\032\033\371\364\264\234\013\026\002\003\002\003\034\364\201\355\242\016\035\036\364\302\210\333\007\037\240\342\234\212\n"
+	.ascii	"1 \200\002JS\365\002\002m.lA%\001\222\030\360\367.C\333\370x"
+	.ascii	"`\366\201\350\212\255\357h,\022I\312]1\215w\301|P\013\031Y\230"
+	.ascii	"\273\260u\301\222\273\013\033\330\225\3215\037\002\346\203\204"
+	.ascii	"\233\2726\316\022,\3066\\!\267B*\0279\306\267\213\204\311Oj0"
+	.ascii	"\021\334m \353\217\255\274Z\250\020\336)m\016\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375 n\205\002"
+	.string	"\204\003b"
+	.string	"\f"
+	.string	"\001\001\001\003"
+	.string	"\002\005\003"
+	.string	""
+	.string	"\001\003\001\001\002"
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	"\001\n\002"
+	.string	"\020"
+	.string	"\007\013"
+	.string	"\003\r"
+	.string	"\001\016"
+	.string	"\001\017"
+	.string	"\003\020"
+	.string	"\003\031"
+	.string	""
+	.string	""
+	.string	"\033"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	"6\205\244$T\325"
+	.ascii	"X\365Ma\177\326S\271\366b\335\006\332"
+	.text
+	.section	.gnu.lto_.inline.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375`H\001\035\b"
+	.string	"\342\013+2`M\222\016C<.\001Q\366\002\223\016\f\216\231\t/\264P\227\376\3764\251\f\027\260\3156\200\301\206\002\203\306\246`X\225\3206\232u[#!{\223\024\3475\"\321YH)\351"
+	.ascii	"I\370\340\177\326\245=\253B\216\226\303\200\237\033\364h!\024"
+	.ascii	"6\220\032\373'\367\263\362\217\034&\257\353:\331\350dL8l\260"
+	.ascii	"b\305s\361gi \302`&\333\227F\271!\201\207\266\234\317\003~V\""
+	.ascii	"\340/!\233\315\252\374\360`\250\020\354\266d\006\333\026\340"
+	.ascii	"5\030b\"\202RPa\304G\203b\232\215TNO!I[\b\237i\322\242m\364\226"
+	.ascii	"\261!( \360\002\2411\352\262\001<\013a\230\346Z\314\334\230\232"
+	.ascii	"!\bX\304+\201 0\t\340\201\373f\205q5)4\r\351\204\t\262\037\327"
+	.ascii	"\332\220LR\340q\254\265\226\013\231<L\210]\343$\257\321F\013"
+	.ascii	"\3409\324\352\262`\215\025\230\271\216\35486\201\255\241\001"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"\275\005"
+	.string	"\322\211!-\2007I\007`\006\223\350\351\254\032\267Y0\220\031\020\"\350\007\242\232\021\0241\203\2704\\\312\260\207\377\377\377[\267\331\377k\233%D\312\024?8\\\032XA($L\017\320Z\004\3024\035d\312\276o!h\200\300\300\233U\314U\272\310@.\260\334\240\224.\366=\255\265\346<\364\317?\336\361\214I\217\364\311.^\361\361\036kTJzPOCr%\216\222CJNyA\0315\031\305!]\215\310\336\"o\314*\022"
+	.ascii	" C\243\226!\0250.\036\004\206\222A%(\272\256\226f\204M\316\231"
+	.ascii	"\224LRf\032\202)\360q\270ij?3EE\345\312\002\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\001\230\004\005\230\004\t\200\004\n\200\004\013\204"
+	.ascii	"\004\r\230\004\016\230\004\017\204\004\020\230\004\031\230\004"
+	.ascii	"\033\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\275\005"
+	.string	"\"\311\031!\240\265\225\003\377`U\277|VU\020"
+	.string	""
+	.string	""
+	.string	"\217\005\320\326lm\367\342WKf\311d\311h\223$S:\362\350lv\317\t\302y:3v\324\223\332-\236\212\021ev0\024\034\364\324\1770MJ\2002p$\352\232g\342C'=\245]\364\214^\253\312\313\232\030/\347\204f\026\005\234\326\242s\335\347)"
+	.ascii	"\230\004\327\b# p\202!S\036\205@p\271\337\210\210CY7{\030A\004"
+	.ascii	"/9\274sm\023\b\243\223\bV>\300\223\315%\nA\0018\321=`\265YN\f"
+	.ascii	"\362\306\343\262\265`,8\217\2301\344\300t2\026\276\270\374M\331"
+	.ascii	"d1p\204\024`1\335"
+	.text
+	.section	.gnu.lto_.lto.3b6ceaced9039577,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_barometerConfig_Registry.18.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375 \243\305\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\303\274\234\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\316\007us\250\345\006uq"
+	.string	"\005\001\006'\001\016\005\001\006\035\001'\001\246 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/sensors/barometer.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_barometerConfig.19.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375`\250\001u\f"
+	.string	"6UPA"
+	.string	"Q&\035\003N\207\251\004\327\370D\374\220\247\334s4\377\311h\233\315\206\253\377\253\361C\273Q\204\277r\321\002#\356\276\331\031-\375\353F\313-\323\002)7\335.\034\211i:\320\2256\"\366';\245:"
+	.string	"<"
+	.string	"A"
+	.string	"\252\030'v\311\001\276LNM\336\322\235N\376\321\235Z\264e"
+	.string	"\250\260A\243\004+w\327\3434\\\374\024\375\273N1\241F\237\222\003\273\353iB]\270\271\333\026`\333\200=\013\004\037$L"
+	.ascii	"\331\300\341\324\027u\247\024\004-5\322H\363f\223\243\311e\260"
+	.ascii	"\037\331\3355\247\262\337\372'\007\265P\022\021\002c\367t\253"
+	.ascii	"\255\214\246\350P\261\375i\177\274\007\361-\321=v\003\326\234"
+	.ascii	"E]\325`m\276bf+9W1\303f\342\266\203\243\230\325Jw^\202\262\252"
+	.ascii	"\375;\211P\202\323\230\032%- |\004\306UFb\007uvx\030H\201\213"
+	.ascii	"ey\250\263#\374\025\232\354.\001?\033N\003\317\207\240\303\232"
+	.ascii	"\013X?\265\363\201\031\006^\b~\241\247\206\236\207\223\351x\032"
+	.ascii	"0\364.\001\374=\250\240\367\371>\320\253\220\373\310r*c0\310"
+	.ascii	"H\034\205\005\177Q_!b\2673wQW\267\3329\" \360\202\221In\205\253"
+	.ascii	"\"'\336hF\303\260\221\201\240\230\313\231b\314/GGx\370\007\272"
+	.ascii	"\215\373\330\221\031?\333E\030i:\301k\267%\221\324\035\336\216"
+	.ascii	"\350H\b\036\225\003\374k@\333f0o\002h\326)\221\207\027\255'\003"
+	.text
+	.section	.gnu.lto_baroPreInit.27.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375 \304M\005"
+	.string	"\322\211$-\200\305\351`\230,\004j08\001@\255S\315\206\260\214\214\325\333\357\007\326\356\301\355\202\227\332e\"\246\002;\\+\300V?\370\243\275e\n\226 *+9M\0329b\245\263R\262F\n\022MQ\2425B\b\317\210\244\261\232\223\306\207\373B-!\201\023\233\273\036\274\330;\370\177C\315~\207N\300b\363W\n\b\016@\340dl\357c\313\026Xn\373v\033\245\033\370\037!f\255}\226w5k\300\262k_\241\361\337\017\313,k\270\266\025\266\031\266\037\001\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_baroDetect.28.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\365\007"
+	.string	"r\01776Po\322\001 \333\250\026\204\002\301F\2731\216E\023\240g\331\267z\037\215\217 _\b{\017\267\373b\263'\030\320 \205\203\276F\202\366\026oa\361\004\321n{\247\024\2216H\2068/\t\317\274\0264\021\321\343\334\261f\f\305\217\234\227\003\244SRP\244\020\364p}`gRhm,!\342\204!)'\314T\213gTs\"\273\212\2323\331\307\354\356\332\225\354\237\376\273k\324\026\026\203\224\335\321\213\313\256<\024\017\333\230\235\261\355\352I\260\237&\034\260\273\241\302\251\376\n0\255\331\017\271\b\366\021\212kvK '\273\365\300V\365\347z\002\352\257\372"
+	.string	"\365g\333\034\004\314\331k\307\350\246\217\013\223\226\335\n\035\307\263\267\314\027 U\274\001$\354\256\033\006)\343v\267\275\261\255`\273$\f"
+	.ascii	"A3\240\314\200`\330\250\260]\205#\327\224\213\211\030\204\317"
+	.ascii	"\324(\270,ij\342\275\212\023"
+	.text
+	.section	.gnu.lto_baroIsCalibrationComplete.29.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375 \375\335\006"
+	.string	"2\315/3`\213\322\001\320b\035\224\231\n\031\026\223Y\205}w\025x\335?\357\bo\033\252Wh\355\230\356Y\357z"
+	.string	"\bY0w\035\340\030uD\205\177K\210\224)\005\266P^\313\264\213{\025\005\006\237\203\230\006\031f\241ra\226\007\031E\300\216\241=\226q\356\261I\334\353Hu\300\243\037\373\232\310U\365 \322\347\031\327\320\370\025n\330\344\255S\376&r\352\n\360\340\311\313\216\235\324\b\373\323\352\310vZ3\375)\240\364\221p\355\206\256\220\365\240H\027\2669\366\304\006\007\034W\217\023\241SX\2006@v#S\211W\317\312?\306\247R\007\207%\352<%\b\273\353\264D\016\267\3366\201\355\002\333\020\001\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_baroStartCalibration.31.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"E\007"
+	.string	"2N36Pm\222\016\244\004\"\205\262\251\002\036\260U\337\003\233\245\"\214\nI\252\005\025\375\237\355v\214-\033\241\335\301{s,[\004\221\371\2421!\327\250\3529\272!Bd\nk0\361\352\\\033,f\030`\026\261\214se\220\323\220\331@M\314 \246`\314\341\212\260\203a\021Z[\250\246\n\224T\244BOtQ\365\\\356V\020\317\325\370\341\343:ju?\227V=\365\240d\262b\021r-\277\211\334\273\370\002df\376J\377\b(N\024F2%ZX2U\221l\374\275\037=\201\352\361\002JGfZ\255\036\364V\253Zk\237\322-#+\202\212\bQ\311L\3700\252\325i\267\246\016\214H\020u\001\t\231\271\033\221&\372\353o\360#\374\034\001\t"
+	.ascii	"2\003\302\260\024aK\f\001\306e\n\240B\274\\\001.\335\242\235"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_baroSetGroundLevel.32.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"E\007"
+	.string	"\242\r26@o\222\016xW\346e\353\006\301\214\266\331;2\211\210\256\003!\f]\256Wl\307f\217\271\263)\3211\2707yug$\214\256\241~t\252\276&!r\033\204\310\024k0\361\352\\\033,f\032`\026\261\214se\220\343\220\331@M\314 \306`\354\341\212\260\203a\021Z[\250\246\n\224p\240BO4A=\227\273\025\304s3\206\370\270\216Z\335\317\245UOE(\231\260T\204\\\3527\221{\026_\200|\245\177\005\033'\013*\231\023\251\226DU$\032\177\357GO\240z\314\200b\265z\320[\255j\255}J7\214\254\310\210D\310Jf\302wQ\255N\2735u`D\212\250\013P\310\314\335\210D\321_\377\203?\341\357\b\013"
+	.ascii	"2\003\302p\024a)\f\001\272\206w\207p@Eq*\362\345^p\351\026\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_applyBarometerMedianFilter.33.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375`#\002\365\022"
+	.string	"f\343\177I\300RN:r\230r!\212\001\365\235zI\244\032Sws\365d\3308r\305\032\215\310\231\330\2404\003`\265\376\361l\367\025\021\030S\001\356#\336\340(\304\342\364)\210l\270\334\250\2074\351,\234a\020\200\255mdo\271S\nj"
+	.string	"e"
+	.string	"m"
+	.ascii	"\265z\240\332\325ZS\254\322:\265\355\227\270\221\215iS'ds]x\332"
+	.ascii	"A\301\243\326\n#\371\210w:?\300;\335\334i\367\350\\I\363o\356"
+	.ascii	"\2610\345\030m\031N\247I\325\013\253\227Mg\216\364\024\215\026"
+	.ascii	"\344\364\371N\223\333\223\317\313V\233#3>\334x\322%\217-GJ\326"
+	.ascii	"J\255\325r\264a\270Y\267\375\3006\213-\033\004\022\207\316-\347"
+	.ascii	"J?a'\237\310\023\334$?\236\372n\362N\277S9\242\333\221\006\034"
+	.ascii	"\031\304\326\335\310\305\331\237u\203^G\372]-"
+	.string	"K\317\353\356\365\244%\225\276\b\n\207\333\317P\214\255\241\253=A|T(\n\003\304u\237r\245\224\323\266\361\223\034b[g'\222\232\256\332\016,\2550:9u\002y$\232\001\004BWU;\2728\237\306\006\031{\362\220!\252\035&\331\332]\036[\364\344\266(\331\250\311+\357\344\256\017\220\335%V\324\017\022\256\265]\341.h\005\244j\255\b|\026o!\363\211NM\001\004\275\323Y.\352v\3643\027w\321\363S\\\205H##\343\235\262D\354\030\241\343E\343\rj\027\347\224\267\226@.\204\322TM^\031\345\337\326\0065\337\313L\301\027!F\026c0S\363\315D\034\314`^b\337\202/\224 \212_\310B\363\315\004\330E%\374f>\031\030\306Z`b\b\212\263O\204\315`b2\230K(\302T\f\030\214\371B\330\f\b\206\260\020]\375\006\371@V\323\265Oz\311H_;\347z\005gs\274"
+	.string	"\362&\356\004\226H\325\212\363\261\3110\020\344\307\327\276\003\320\256GUmo\002% P\242!\350\366\221\003\316\234"
+	.ascii	"wW\354e+\324\352z\213\352\013i\343\024\r/`\002\370\013\237V "
+	.ascii	"`H\222\017\341.\031b\370\006\211\342@\006\034!\237L:\264\216"
+	.ascii	"qs\340.\024\2767\\C\201c\271\022\334\3407{\020(\t\007\025+\263"
+	.ascii	"\342\315Q^#\342\313\036cJ\321\241"
+	.text
+	.section	.gnu.lto_recalculateBarometerTotal.34.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375`\251\002E\025"
+	.string	"\266'\215K\260\324Q:\270dfbD\313\264\356\305{z\244:\230\211E;\264\bs\232\351\347\007\2639\327\2340\211\364\205\356\227\310d\265\021\202\331\245\0367z\206t\307?X\351oN9\317\203q\356\fwD\264\261\2415\333>!D\356\224\002w"
+	.string	"m"
+	.string	"x"
+	.string	"b\021\216\306Q\255\225\305\016\350\20191@\335\365\204H\260\3246p\340\346D\027\274\265\376\200\034\325\ndq\313\352\243m\177\305Y\3348'\002I\364"
+	.string	""
+	.ascii	"m\320\tJ\325\n\214\rx\n\371Q<\214\374\270#\236\273\2704\347?"
+	.ascii	"xq\210I\310\353\351.\362|E\002\277\034<&\275\235\230\302\243"
+	.ascii	"\347\351\301\323\235^\016\245*\005\265VS^\317\303=\336v\003\333"
+	.ascii	"5\233:\005A\2669\211\236\367\321w\022\371\361K!\350\351\327\302"
+	.ascii	"\207C\223\330@\035\335\037\373b]\037\033\345\300\033v\340\177"
+	.ascii	"\362\242\377u\242\337\325"
+	.string	"\272\321\315RQ\257\226Z\245\242&\227z\\jq\251w\251\351R_\345)DHEM\020R+\207$Gj\323\210d\342F'\351H\327\276\361\203.\261m\344\341J\327a\365\002\310\007Uk]\371\350\n\001\013[\252c\\ro\341J\270\325p\\\026\022\216\rqYNJ*|\273\2661\274\006N\305G\255\025\201/\374\221\314\017\372\350\232\331\214\3748\016yC\\\364\2656L\f=o\227F\t\325)\250\335\352\304\375\271\f\351\313\370\f\031\232i\222\037G!\341P\221\227\340\375\232v\177\334Z\272..~\354\250\021\273\226\356\271\324C\007I\201\177[K\203h\370\345\034\306cx\350\0076\345K\215\301\315\246\254\275`j1/\262\022\302\003\\Y;\231\221\335L\t\345Yc\263\225'\215\353V\2531\027\224344Y\204\227g-gy+i\346)s\211\331N\323V+m\261Z\214\214\026\233\235\266X\213"
+	.ascii	"\2334\345\031\273\231\346\031+\001\326\257\217\357\204b\307\256"
+	.ascii	"\274\004\b\204\216\220\266\226\265;\266Q\326\344\003\221&\234"
+	.ascii	"\3151k\231T\031nL\371V\013[\224\023\252]\315|\t\267\302\241\232"
+	.ascii	"B:Y21 \240\"\031C;TF\222,]A+(mk\315C\026\b\021\242\263\262\354"
+	.ascii	"\345\f\343\333\023\007\n\365\r_\214\305\t\204\272F\007(Ky\331"
+	.ascii	"\262|\270Bj1\315\231cr\316\326j\223\302\020\034\237\355\205\271"
+	.ascii	"\335\001\371G\225e7\353\221\340*>\306\250-\237\306\002n\246\216"
+	.ascii	"\225\007\210\325\032\302\205\201\307\233\215\351\235\f\024\305"
+	.ascii	"5c\323\350\024\r\356\001"
+	.text
+	.section	.gnu.lto_isBaroReady.35.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375 \352}\006"
+	.string	"BL-3Pm\222\016$\241\212\200\270\252\243aI\006"
+	.string	"\210e\274\271\312\336\222]\265\177\267\303\256\215P\352\340\2759ff\210\234.R\271/0S\207\3064K\266L\001c,o\332L\031\367.\013\215z\216\322LT\3230\\2\r\363\250f\031\3305L\257m\234{\255re\231\b\031\301\207=|9\332Q]\214\0358X\253\322\345"
+	.string	"TB&0\361\301\321_\036d\024_J2\321\217#3\b)\311I&hd\222#\022H\306\337\371\312\b\t\235\253^\026\240^|@x\224d^\215U\264*V\267\033\245h\210\214\254\220\247\030\240\220\231\243\025\222\350\254\177\301\177\360G\004\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_baroUpdate.36.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375`\314\f%5"
+	.string	"zV@\023H`\\R\007{\"\366[\311^\267\373\252\017\301\006S\362'\374\265\335\314\023\031\235#@\301@\343~\243m\303W\340i\351\n.8]\t\340t\227\210>\017\n+\024,\017\377\201\250\332\327\252\371H\327\b\331{\357-SJ\001\025\001\f\001-\001\277o\241\373\375\266\337A\3407\360\367\375\003~\273\277\357\326\375f\333\357u\375V\331\357\274~\277\372\355\023t\212h\021\221%\216\235\372\324\304q\353\224\037.\365\374\337\355\335\375\242\235\254\203.u\341*\231\356\222'pc\342\270,\201\257\r\344\372\332.\346F^4\254\226A\233\354\0237\2463\2758.\013B\272\221\365Uu\"\353k\316r\330\215E\"\016\200\033\233\241\360\r\002\177n\313\256j~\270]\250\316\313\262\251t\343\202\266 \305.'\272\034\263\213\353q"
+	.ascii	"\264\023\254\236\266\374F\013"
+	.string	"\3726\352\001\264.`\376\305\324\241\036\301\244\322\344\230\316\037\n\277\230T\377Z\360\232\n\002\177\276\2308\376\367^\356\376X=9\275U\221rL\247\212\214\3438\330dz\326\311\374\002\327\036\031\253'/_\253rL\271\025S\n\006\013\234nM\201\315%V\265\341YEP\365fc\330TR\215Z\256\350\234\314\277\251\231\364\337N\210\343\270\177\331|\362>z\267;u\367\203\356 \232;\224\262\262\273+\270\334\205c7\006\327\222,\316\305q\354 \213\307e\320\260a\003\353\353\232\327i^T\212\364}\355i\236\303\026\247\3745=\335\232B\327\374|k\207S\271\332\332\3352\325Z\273\225w\242\322^\305g\310\210\322.\305C\260\276\366/\343\2464@\342\035\335\016\245\273\355\3348VzUw\267\335\027c\030\\tc\3428>\200dz>45{8\243\346\334\335\n\334\t\007\033h;\023o\342\241\275\313\327\376"
+	.string	"\002\304\262\314\347\234\235\211\317\317\\I\210\026\"D\260\276~^\237wQ\367\261\254\212\313>\202\365\\\302\354\213\322\243\351\366#\216dD{W\223\030z_\372\332>\304\372\352y\r\023\263\347D\372\276\356\262$W\343\374\354v5\316=\272%\b5p\251\367\217\373\215d\277}\330\357\236\367\233\207\375\336y\277u\324\357\001\300o\001\302\357"
+	.string	"\357w\216\372}\024~\033\337\357\342\373M\f~\343"
+	.ascii	"\277o~\3376\300\357a@|\300W\355]\304\334\342\275\3559\031tq\361"
+	.ascii	"\360\262\327\202\263\334\317z(|\005?\341\254\367%\234\205\263"
+	.ascii	"\224\225Z\377\204\271\216=\222\305+\234\274\256\275E\245\017"
+	.ascii	"\304\340\352ln\236\007\005#\364w\274\016\233|\223=x=\025,\306"
+	.ascii	"\003\315\221\314\201N\331\344\026k\355\212\277nV\206oRj\302\341"
+	.ascii	"\337\370\250\207\022\346\341\217\257\361O\337\024\3466J\215\315"
+	.ascii	"_7\261\367\315BA\336\351i\374\2147\377\242\322\332\276i\b\332"
+	.ascii	"\313\370\030\317\024\204\301~\351\302\361\225\222\305O\n\346"
+	.ascii	"u\rm\352\257\233\216\340\332+\361\316\200\371y\306\201}|I\003"
+	.ascii	"\3205\277\f\f\3634h\366~\271\215:\233\342\257[\215_~\372S\331"
+	.ascii	"\345\tq\363\263\363\316\360\351\335!\230nUi\363\263\375\004\353"
+	.ascii	"f\2672\003C\340\216B\321L\322\300\\\2316\273\231C\324\307\300"
+	.ascii	"b;b\222G\2736\267P|j\376Z\311c\331,!\377\232\206\307\234\016"
+	.ascii	"&#\020&\3313\007\206\315?(5Q|n\r\313\323\273\363y/\363.\024|"
+	.ascii	"\346\342\030\311\227\\\222\005\240[\326\334\020\002D)LtXAD\204"
+	.ascii	"\342\350\327C@FD,\210R\024\031\221(\021tdTt\244\202\350(H\205"
+	.ascii	"\t\022)\202\206\214\216\202\200|\272h\005\221Q\020\213\242\""
+	.ascii	"\243\240`\031\222\347\036\355T\260\202B\331\307\256\320(6\310"
+	.ascii	"-\304\260\270\355\234\273`}\214\214\306*!\377\344\246\356\376"
+	.ascii	"\311\303\251h\034RN\312}}}d\214\310\334\340\341`2\002\377\226"
+	.ascii	"\354\371+\310\374\213\242\213J\213>@\337\306\346\223Y\320\211"
+	.ascii	"a\342\353\371*\2776}\357)\313\223{\246\360\344\026\253K\324\271"
+	.ascii	"\263\340\243p\310y5\235\274\223\246\223[,.{8uw_D7\363\001\331"
+	.ascii	"\255\376\311"
+	.string	"\200\334\016\341\022u\342\254\036\202e\302fa\003\240\004\213\336\235\016\234\035\336\215\200\245Orb\347\315\222G$\002r\033\205%*\r\220\313r\335\262L\204'fc\316\221\0017\275/\003d$\214\254\354c\316\311y\306\217\301Nn\034+9\350\027{#p\263\006\f\005\305\372z\314\236\246%%\362Q\370\006,%\305\372j\314-\036\334^q\352\207\204\201\025\363\017\013.\352$\346n\230\352\203\300W\305\201\004\250q<\347\0344%\"I\nR\3104\006\021\006\204\020\346\\\261\003\021\340(b\0169TcKm\006\222\002\007tU\326\211\352>\313M\223\256!YY\330E\214\214tY\013\2336\252;\312\322{=^\316*w\306\375\255AB\234\331\310\330A\222\b\274#\215\0254\222O+Y\226\351&IA\255\360'IS\216\r\312'\354!\267\203\272\327ZTr\252\245\205\261\257\365\241\337>\005\245\311\207(\256"
+	.ascii	"\225G\366\310Fh\033n7\f\244\027\373\361\210\266r\302\336\006"
+	.ascii	"\330\204\375\3321\337\3064-3\266\335\227\355"
+	.string	"\252\320\307\302\313\230\034L\254\204?\325\273T\242\216\231\004\377\250\364\303j\222\374\214\b\016Z\375G)\233\363\225'\001\027l\211v`\275\354\374\262\242\301b\035\322\3562\033\331x\344\205\250\032\303t\267:\364\003\"\017\227\007(\241\200\347\315\224\007(A\317\336Q\217\002\223e\203\244:\250\345\354\307\222L\024\250\033\354Q9v[3\032\326\026\023\332.Y5\361\201+r\344\246\204\003+\242\b\023K\233\243\211\276x\276k\035\257\232\311q\222\035\214Q\370\177\254\314\211x\363\037k\036_\224[k\257\\\307\256\327\004Z\244\377\3056#\006vw\250w~\360^\001\266nK\251\f\245\241\b\241\323\013\205\347\023?W\032\307Gr\337\224\027\027G\370\374}\262c\027(\270\250D\234\323\302\276\201\351-\241\323\235'\3500\016\210\333\244\003\374,@\276\304\005\t[\205\334\243\034\220:\370\241\033\314@\223azE:\225\213\311"
+	.string	"\026\351d/\345\314"
+	.ascii	"\267\016\375b]\203J\242\372\226R\372\342mn\277\356\302ETdF\224"
+	.ascii	"\275\266\217 \345\242\340\226\322\024\361V\003"
+	.text
+	.section	.gnu.lto_baroCalculateAltitude.38.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375`\201\004\365\034"
+	.string	"\0266\271I\260\326M:*jh\243\315\361EA\033\211\0175TG\361\020\021\270a>c\213\224O\320\3004A\007\t\362\237S\247"
+	.string	")\254\303\313~p\336\260\376\261w)\272\327\\]\237\363\036\267\315i\303\017*\343\361o\204\020\"eJ\001\235"
+	.string	"\227"
+	.string	"\251"
+	.ascii	"+\2525T?\300\314D\023$+s\216\370\3622\201\"\221\031\367\375\366"
+	.ascii	"}\036\307\352p+/\n/^\035\354\353\370\225\035\263\207[Y\334\022"
+	.ascii	"\2541\347\214]\264=\330\261\213j\177\360\253\034\273/\007[\""
+	.ascii	"\001\353!\203\253k\3169\340\242\207`\027\375\033\307\361\301"
+	.ascii	"\271\320\nFo\224A\245\t\313k\316Y\243]g\274\030\036g\274\270"
+	.ascii	"/\236\273\030\256\346|\022A8\304\353\307\353-]<\3610\246w\342"
+	.ascii	"+\353\355B\332\234\363UW\021=\235*\211`\316i\345\365J\334\343"
+	.ascii	"mK\260m\300\016\243\004DD\343E\335/\331\362\035\310\203\024\031"
+	.ascii	"\331l\343\305/\001\024A*\235s.\355Ba\030i\373\252\333\354\360"
+	.ascii	"\265\300\342dk\247]\354\367\270\017\f~\2243h\320\3634\214\027"
+	.ascii	"i{\254+\025\024\320)\207\n&\375\262\255t\272P\366\303\271O6\251"
+	.ascii	"\026\262:\bFM\003\272\357\236\221\352\037R\355C\252{F5\017L\275"
+	.ascii	"C\252uHu\016\251\306!\3257\244\332\206T\327\220j\032R-\033\325"
+	.ascii	"30j\031R\035\033\3251\243\032\006\246\206\221j2T\217\241Z\034"
+	.ascii	"\325\341\250\016~\222+I\260\200\001\203\361b\314\306\\|\241\362"
+	.ascii	"\301\354l\201\366\245\224\356\310\221\344\0328p0^\204\3311\210"
+	.ascii	"D\005lg\253UzTh\355\007\020\306\363`O\221D\013p\327\364DcHhI"
+	.ascii	"\255r\312g\375\373\234S{V\215\224R<\352\337\257\270\242Xx\371"
+	.ascii	"Y\377*\202\204\361<\237\245\201\330%\373w\250\037Ls\372\300\327"
+	.ascii	"\027p7'\223\020\271?\373\253\207G\270~\345\324\270\344j\260\354"
+	.ascii	"\022\367;.\200\254\322F\270\342\320w\303\235e\225N:\375\262\356"
+	.ascii	"\356\233\276x\302\207P\200\315\271+\340\013\371\257\202\037u"
+	.ascii	"\321\026\002\034\216\224\210\2246$\270\341\212\024\304l4\204"
+	.ascii	"\263)\331\216n\270\242\013\265$\334-\t\311\226TC\312PtT3\302"
+	.ascii	"%\325\206\200|\343`\303\325\224n7\\-f\305\364p\356S\320\322\230"
+	.ascii	"V\347*9\030\225\240\025\233xp\361\211\003>eK\204\362\345\225"
+	.ascii	"%4\317F\311\311\244@9\357\312\316\362\254j\321\331Y\332n\227"
+	.ascii	"\234\2635\253\263\213U:\341\254\315\346\354,x\203\263@\301RJ"
+	.ascii	"'\333\233\025\220\005\2646\353\363D\027b\005\220\213fkd\033["
+	.ascii	"\232}95\263\262\035\265\312.\231\235\311\33580\227\203\211\314"
+	.ascii	"\276H\f_\314\306v\203eW\256\352Z9\330\234\263@O\250!8\005\215"
+	.ascii	"\201\306\231\022\211\023\264\205i\fp\002\031A4\274\001\021`\265"
+	.ascii	"cpHamm\006\362\244;i\371*\021\277l\356OJ\332\215\311%\004\205"
+	.ascii	"n\264q\362/\027\376B\234\324EHp\334f\332\t`\fq\034*\345\375\016"
+	.ascii	"A\037\304dk\373\037\"\341S\343\21350v&\257\"a\017\216\025qUm"
+	.ascii	"\223\311\242\350#\030\307\016L\364\036]\2312F\326h_&\225\330"
+	.ascii	"\320_\232M\263\325\215}\255\310o`\333\361\003\030\227\237$\242"
+	.ascii	"!\235\022\217\246A\271\333\247p\301\372\264\231\035\335&\017"
+	.ascii	";\025H\035\n\272\271\216\024\241E\001\245$\202/\214C\244\267"
+	.ascii	"/\374\001"
+	.text
+	.section	.gnu.lto_performBaroCalibrationCycle.39.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375`\030\003\355\025"
+	.string	"f\347\210I\300\020)\035z\252N\006\367\272\364_V\246\030\250!\004~\331\326#F\343'\317\023\2030jDu{\303\246\372\375~\377\2249\031\263\243\356\376lo\344OQ\264\376\025\035\321\022 <\312\307\314\314\315\316\255\375\237l\222\244L\001n"
+	.string	"i"
+	.string	"v"
+	.ascii	"f}\275\332\265j\327\243\270\226_\213\273\376\256w\327Z\" \251"
+	.ascii	"if\306\234\030\2067\246P\"\201\320U[]\246\261e\250\220\207\251"
+	.ascii	"A\0136\300\2509'\355\035\224F"
+	.string	"\245\370\245\261*\220\262z\276\032\2258*\252N\346\234-\037\216^,\240\343\"\303\313\267\023eM\034b(\220n\005\237nWu2\347\364\366|7\352Qm'\260m\300\376\205f\251\325F\225\362&OA\271\022:\004\241\305\305et\215(\222\332\353\377\003y:\272\035zF\2554\352\367\312\373\321)\t\rz\261\362\330\026\263\332Si\215\031U\352]NE>9\271\035\332B\272\375\317Vq~\307\376\232d\\\217\214k\331\256c\273\206\355ZD\256C\344\032D\256?\344\372%\327\036\273\356\330\265\353\353\32678x=\037wP\347\234\013r\021\310\013\021[\007u\350\351H\303\215\327\355\005\fV{\037/\241\360\032;\250?\025\2719m2\034\nws\346\bx\374u\345\365t\334\343\242\022\217\206\353\035\037o\244\226x?\256\247\320\036T\353.\222\263\336\272\376\254\037\270\272x\222K&\336\217\352\253\231\216W\035"
+	.ascii	"\223\374x\265\311\341\006\212\342\301j\316\335\001\353\t\005"
+	.ascii	"\252XyT\006f\231\335j2\265\027\333"
+	.string	"Me\205\206\273\331p05\034\r\246E\345\205\306r\303\321f\003l\213P\273\321dl\266\033\315%\224\323\357\330\201\2220w\235\204\035\206\204)\242\036\324\310\231\206CE\031e\037i!\273\\\nJ\345\354\n\033M\033\304\377\024e\264\262\320%\024\004))NFQ5\364COG\370\377b\207}\305\304\323n\247\222&\304\316B\202]Ed\344\223#r\244 \344\"/r;\264\331\0211\013y\200H\250q<\306\024Q\312Q\345\024)\303\001\220\002\021\272\252\016\020hHD\031\016c\334\2222\214\203LC\224\236+f\326dbj&\r\317\262\355>K\271L\271\314%m\275\334#B\344[\00574\"\255T\231yN&\346\245\004\212\303:\340\271v\372S\217\213=\304\244\214#\227\242\336\034\321\036b\211\232\376\245\343?\325n\354W\r\272\275\310\361\361\016\346\3261\204\t\353\231\\\037\003\377\214\272\203\025C%"
+	.ascii	"\244>|bY\363~\3106G\367W\332 \324\302\275\037\201j"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375`\343\001\r\013"
+	.string	"\322\217=9@\257:\217\212\265"
+	.ascii	"d@\277\260\345c\333u\2424\274\361z;{\017\001\0246\215EU\321k"
+	.ascii	"\250\206j\320\330\266\365|\337\367\0076\006\231e\361\003\272"
+	.ascii	"\273%9\266\323\2262\245\213\t\021y\252\006 \007\022\253\267\302"
+	.ascii	"eH\254a\355\35367\260\2269\003n\230\232w\362\236\"\247\355\353"
+	.ascii	":&\307HPX\372\253\254\302\335\377?w\365r\3146\227\226\223\221"
+	.ascii	"\353\205\277,\334U\341-\376\377\335\317\013\205\263x\342\353"
+	.ascii	"]\217Y\007\207\206,c\206!\333 \227i\037\022`G\300\032\202\340"
+	.ascii	"\301I\324\201\323\r>\242[2h\026DN\030\016\364\226b&vj\005S\357"
+	.ascii	"\356\230Pj\230\037\274\\D]>\266\374CY\002\275r\003\322\013\036"
+	.ascii	"\247rO*\205\352\234P&\017QpU\"\273\3562\355I\252\336]\357M\363"
+	.ascii	"GF\0162Kp\273\276k\002\302\335\377?\202o\350\356\322\2241 \360"
+	.ascii	"\002!*z\376Afc\177\nQ\242 /I0\004#\270\004\253\210\262v\r:g\220"
+	.ascii	"\315\323\322\363$\030\312\017\326\003\267\303}h$?\333\030\306"
+	.ascii	"\235t6\320a\336a\356\204\327\030\2121?\240\320c\376\210\351\360"
+	.ascii	"\275 !\207H\fCt\326\027\344\214\202\001s\206\214g\254\214\030"
+	.ascii	"[\200>$\003\247\214\335\215\366bc"
+	.text
+	.section	.gnu.lto_.refs.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"\225\007"
+	.string	"\266\0248+@k\224\016\3030\f\3030\f\3030\f\210\252\2426\303l\273a5\2022o\212!\022\037\213\377\326\375\fG\r\326\276\375om\313\024+"
+	.string	")"
+	.string	"/"
+	.string	"U_\336\3271U\271\317\r\2002z\335S\247\234\316\200^\202>r\036\202z\363\264y\226\030\034Z\376\301\3560\235Yz\361:_\213_\2208A\376\344u\201\304%\371[>\344u-\361G>\366\272\225x\346\277\327\251\304\033\371.\177z]J<\312w\3367\001?\242\277\310\257\250:E\325'\254\227\250z\304\365\020\216\177x\335\341\365\206|\006\254/d\257\200}B\366\312\365\b\331\017\254\247\\8\305\302\r2\217\022\3140`9\022\351\233\353\232\373\207\353X\344\257\355-\2553\266\336d\317lC\246'\371\003\3313\373\227Oi\317d\277`_\027\005"
+	.ascii	"I\303?\375\020\002\216%\305\b\200\245\310"
+	.text
+	.section	.gnu.lto_.decls.3b6ceaced9039577,"e",@progbits
+	.string	"(\265/\375` +\005\305"
+	.string	"\332:\335DX JQ9\351],\\\354\312\203\356\223\002/\362\375\340\317j\212\273Hr}\317\034l\236\177\016\372\2318\254\3305\266\r,D\300g\344\2766\205w=\321\356\266.\016"
+	.string	""
+	.ascii	"\023\020\0048`\226\3638\256\240H7!\374VT\320\273\347\024'\356"
+	.ascii	"\036\363\377\307l6\356\275e\n\225\003P\004d\004N\355\324Pe\314"
+	.ascii	"\001A\202\002\303\037\310\2715\364:/\2575\364j\nC\2571\026 \004"
+	.ascii	"\213I\275\2661\300\320\240\304\214\207\017\246\0278Q\2740Q\326"
+	.ascii	"[\225\352R;\353\213_0f\263\307*\245\324\310\352}\177\350\375"
+	.ascii	"|\350\3755\251\"UqQJ\241\336W\244\277&\253\022\247\315\355\254"
+	.ascii	"^\236\334\314\033z\315\033\300"
+	.string	"bf\325+\324\030Z\300\253a)(m\324\373\306\373\273\256\237\364]eJ\300Sv\267$Uo\333u\233v^K\273y\277i\264\347$5\263\263\263\266$\263\352\275\225\tn\341\353k\351\3614\206^\217\r\275\331`\350-\247\232\371\307\226\241-\335\255\241\3635A\273\032\253\267\351j\317\265\2327]\247\341Ij\272\233\263\262\273\203Ow\007\034-D\224Qz\367\225\013\377\375\364\200\223\316\252x5\232\226\2733\304n4\325{&\210G\213\231\260\265z_\255\360[\n\025\270'\227.}\226\206\266\345K\026-jS\274x\t\323nm\246Yh1M\246\313t\\\303u[\277\265\263\307\264\332{\255\301\2746sN\3129\037\203/\\\312\314\372l\355I\263\305|l\316;\310h}\261\265X\263M-\200I\231\366\3521M\326X\232\rH\007^`\23697\257\301?\364\217\320\240\307tZ\237m@\312y\207\016"
+	.ascii	"`\205=\251\331\345"
+	.string	"\334\004\021\004\242g\265\026\206M\320}\303\341?;C\317\247\321\360{\n~/\301\357!\370M\205\203:\006\346\340\001\374a\205\236\026\226\264\360\246\336#\361\203\370\002\024\270\253\264\225vz\350+\357\261\236r\034e37\253\020\274)Q\352=\004\360\333C\317\346\345\265\207\336\033\200\201:C\257\226u\206^Ci\260vR\320a\037\241\301m\022,{\345\334\374\271Rj=\212\324\373\004\340\377Q.\001X\326\340?\370MA\257\363\232\202\336+>\033\\g\350\375\355\244\275(\260LM\314<\226s\363\302OS\312\t\253\3367;C\0177\206^\3558\r\2775\373\217\201\277\221\336\352\357\002\177\265@\005N\201\377$T\n\374\355V\301o\247\374\335\342o$\365\204\212\242\236\370;\351\357\374\267\006V\374M\374{\370\367\006\376f\361\267\213\277\217\177#\377\256\340\357\364o\343\377\f\305\277CT\023\276\324\t\324\333F\026"
+	.string	"\340\177\320\337\275\377\033j\t\f\370m\326U?U\022<\330\242\277\032`\204\250\236\337v \343Q#\3607\316os\374\257\"\3747@\357\267P\367\2671\336\277\365\300\177\026\376\207\371?\346\177\330\177\266\377d\376\227\371/\346?\334\377\270\377mn\277\360[\t\374u\202\277\n\340\257\024\3745"
+	.ascii	"\177\225\340\257\032\376\272\341\257\034j\005\025\347\257\021"
+	.ascii	"\3745C\r\341?\320\177K\374\025\204\277~\360\327\241\277z\370"
+	.ascii	"k\005\177\355\360\267\334\337q\177\303\375\375\366\267\333\337"
+	.ascii	"m\177\203\371\373\313\337^\376F\373;\313\337f\177\223\375}\345"
+	.ascii	"\357*\177\217\375\035\366\367\327\337M\376\356\372;\311\337["
+	.ascii	"\177\023\371;\310\337\313\277\177\374\255\343o\346\337>\177\377"
+	.ascii	"\374]\377\337\375\237\373\217\342\377\225\377g\376N\376\275\343"
+	.ascii	"\357\016\374\215\343\357\033\177O\375]\343\357\031\177G\375\177"
+	.ascii	"\363\177\205\277a\374\315\364\367\213\277\227\376V\372[\202\277"
+	.ascii	"\201\376\306\177\373\376\266\377\361\376\253\371\177\342?\232"
+	.ascii	"\377r\377\275\376?\340\177\332\177\237\274\274\274\274\377Z\371"
+	.ascii	"}*\374\003x\nk\317\274\\\206\270\257\t\3376Y\247[\031\2672\354"
+	.ascii	"\262\247rr\256C\216f]\227]\236Z~\370\355\323\355\262\357~\232"
+	.ascii	"@Q\241\353\273\036\031\256\252\027f\370\257\177/+\2279\347(\234"
+	.ascii	"f^\"\361\364\032\247\373\303\337\323\266\t\360\377f\n\"\220s"
+	.ascii	"\322\fS\r\336\"S\3468\207\374\263\345\234d\225\354\300\n*\311"
+	.ascii	"\312\006\223\323*'\223\212$/,\263U\222\311\231\363\205\234\224"
+	.ascii	"\224\374\200\231/093TVb\001\252s\323*\231\223\230\371BN\312J"
+	.ascii	"\016LIVPLN%\324\005&\247\025TvZe\240\234\244\\\302H\312\313\013"
+	.ascii	"\331i\225&;\231P@LN&\024\223\323\212\252\341\230\350\346\240"
+	.ascii	"\3060\257\2564\024\246\244,\303\211J\271\004bcj23\\\316=\266"
+	.ascii	"\224\227\004\310\231\212\271\204S\332\3502$6\031HV\224\314\326"
+	.ascii	"\340\204t\305\314IlL\\\314\234\271\220Vd\247\f\222M\266\234\325"
+	.ascii	"lI,\252\334\264\224\363\004N9';\263\345\234\2239g\337\222\252"
+	.ascii	"\2313\016 &-'\247\234\247\202\2342U\322l)\347:V\246\f\212\311"
+	.ascii	"y\305\0342\023sj\345\027\315dke8\253%v&\241\344&:\254\0055cn"
+	.ascii	"\006\376m\ncv\346\272D%a|\350i\363\206\324\305t\306\356\355J"
+	.ascii	"\351\305{\354@\262&\257.Y\244[\007\004\311\353\tU\337\371\344"
+	.ascii	"\344l\345F\313KG\3371i\363\264I\253d\223\254\262\235\026\251"
+	.ascii	"\266\360\232g\263E\252\314\212\267\001\211\351~\331\335\260H"
+	.ascii	"\025G\337q\360&\212\006\216\21727\245\316\3555{M"
+	.string	"w<[\276\360\222\365\276\247|\326\271ZW\325T6uMMS\335T\272\332\246\332\265\263\276\251Q\257;*\217\007\365\023$\\\216\274\251\\M\327\313b\223{\3267UI\035\223\324\311b\312=\253\200\250ie\021\251?\260\322\264\212\030\361\222\025\344\313SJ}S\267\310\236\265\312\252\376\340\262VD\253\016A\353Rs\274\251p\025\315S\356\t\302B\201MY\022t\317T93n\31306Q\360\0313=R\322p(\343^\315\360\260Y\272\243Ro-c\301\340\371P\222\351\371\322\032\203F\346}W\215\3100\262f\311[\215sbC\214\b\016S\335\332Y\305T'\257*\324$\017j\212\251K\252\027\224\217\314SL\375\252m\3156\005\224\223\344\360\236 @\264\030Z\013s\275\273B]3\243\305V\301T\026\332Y\333^\333\352\223:\346\223\274\220\263\217;\255\266:\245\226\371$5sT\017M\316 4\200"
+	.ascii	"\261\323\324CG\022\337/U\255\235u\255\246\241U/\3156\325\314"
+	.ascii	"Q>U\230oQvk\365\254j\331\200\304$B\226\270'>\013\222%\253w\217"
+	.ascii	"S\345\245K\017\f\262\2551[*\027\235\032SlYj\340\177\313e\034"
+	.ascii	"QJk\372\231\232\345B\276H9\251\3678/\360q2\376\275\303\265\254"
+	.ascii	"R\251W\232m\354\2035\271g\316\231\254\232\265\263\226U,\277\315"
+	.ascii	"\234\307\032\255\314\013\232g\020\b\037#[M\234<\361U\222$E\255"
+	.ascii	"Z\251UrO\217\234\016-\\o\370\027\f\376M\253bUJ;\353X\r{=R\273"
+	.ascii	"\036\324\314\331\312X\205R\235\033\220\230L\354pS\307j\263\317"
+	.ascii	"|\222\315\374\264cD\353-*\b\004\b\037\326\nO\202\364\356\257"
+	.ascii	"\2263\212\275\301t\345\256\211\263e\312\215\bXu\262S&\205,W\357"
+	.ascii	"o\026\376\255\302\277S\370\367\t\377\"\325&?R\254\276\272\332"
+	.ascii	"`&6\r\356l\313\340\016\372\202o\317\360-\025\f\004\005\337.\301"
+	.ascii	"\034\220\330\250B\244\032\211\023f\r,|\233\003_"
+	.string	"`gT\037X<1\230\356l\022\356\201U\271\326\230u]\275b5]\245;\363C\256\342\3417\333`\234&\2274\370\265\r\277,\013>\333\224\r&O\360\332\324kC*\210\225\020!5^\245.\307\223\363\206\r2\2044\251\367k*\215\3779:l\242\200\264\2411\243\343\332\334\354\352u\326\0315\352\315\234\203Z\212R\211D\005\377\025j\311bj\352\253\336\327\345S3s\036\363\231\021\326\205\243\336\332T\003\\9Q/\214\224\325{\373t\245T6\226\365k$\353\036\3515\335\314S\314\344\\\001xt\231{\332e&\252\017E>x|\321\372=\362\245\227\027VfE\326*`YB\245\336K\344\267\310\237\343\033#&\rl\211\257\220\337!9f\304q\305\b\362\347\360"
+	.ascii	"\371\2626W\357}\224\360{Z\300\357q{\334\037A\314d\032\013\236"
+	.ascii	"$\321H}\350\305=i\270\271>~\177@@\214H\262\354\352^\265\\\020"
+	.ascii	"P\316Wm\312,\222\322W\223\266\317\337d;\355\363VY\246\251<#\004"
+	.ascii	"\031U\210\036\226\324\263\256^f3\311\247\034\363\326\245\b~{"
+	.ascii	"\335\244\273\364e\346\310\213\253\344\025\227\302mj6 \035$\001"
+	.ascii	"S\233W\311\253\314\215+\343Ja\261{N\2717.\214>\203\313qy\334"
+	.ascii	"\035\227\352N]\034WG;\357\215\353\364\253\274H\367\306e\"\363"
+	.ascii	"\243\246\211\024\033@7\351g\276\344j\\\033\355\274RcW\352>]\032"
+	.ascii	";W\322\224Qc\247\001D\317\234\033\\\216\036\215\031>V\232?\350"
+	.ascii	"\352\275Q\276)\033iJ2\226\355\274PxM\227\331\233\237\331\331"
+	.ascii	"\022\344\252'\006~\217\022>\217\335\215\201\305<u\254\315\341"
+	.ascii	"\363\310\341\363\214\301\347a\001\237G\r\377w\351*9\275\250Y"
+	.ascii	"\273Jga\324\232\220\272\340\372\2411\364,\236\315\273\371\317"
+	.ascii	"\371aR\346\243\212\031\276m\341\177\016\tA\300T\251\367\3327"
+	.ascii	"\267wiF\264\234\254\340\3336\326\315\237\343\003Wd\n\024'\276"
+	.ascii	"\265\253\222\247\346F\275\266\016/\361$\361\240\243\003\013\217"
+	.ascii	"\034\365\336\326\375v\256\277,\033\f\344\234\304\201<\274\272"
+	.ascii	"z\255\032\273\346\226\215\245\313\226M\006\314\234\225\226\315"
+	.ascii	"\317]\316\312\237\356\016\335\035.\223+#Tz\367<GpO\335\320m\232"
+	.ascii	"\2355\264\347\223z\3173u\206\214\225\353\273\2414l<I\370;r\370"
+	.ascii	"\226L\333\270\270\263\234\206\207\274\340\372Zzppi|^Y\306\260"
+	.ascii	"\236\274\331\267\235!a\302X\2674\005P\333\002\222\024\305\255"
+	.ascii	"\247\364\005dI\275\337\221j{;m[\313Y\246\234\241<\240YV\036M"
+	.ascii	"\236\310\345\341[\265\266`,\030+e\301\331\022\r~[\251"
+	.string	"/N\373\245.+X\216\322ya6\025\242\347\b\2230$2\370vK\333.Z\254\027[5C\203&M\2350\370:i\270\266\255BC\353\263\006\313O:/\240$\341\022\342\342\241y\313R\202\317\316l\226\252\345\023\253\342\345y\221\300V\250\313b\313(a32\304\314\314\216\211\220a\t\021\335\0252L22\373E\346\212\026\212\025\222\344z\257\343t\345\212\206\033\27573]\202\330\341\333)m\2538m\225\306\362!+\225\026\230i\305\341wc\351I\221b\307DH\346\\\203\255\256\253\313\027\305FF\323X\316\221\255\253&\263f\323\206E\260ei}\240A1\263\316\333\260\246\363\341*b\346U\257\205b\243\340\210\311\270\022\263Q,\230\216\231\025\025\322\334\211\211sb\272A\365\265\004\215\230\023'\366\013\347\234\203\264d\252\017=[Z@X\370\232\333/\034\026\270\212P\251\3679L\230X.\333\244\"u"
+	.ascii	"\203)\347\250\241#9Y\3709R]N\333\325tA9\231\346\2023\266\272"
+	.ascii	".\273\234&\025\270l\222k\301\311%\246\022\343\351\331\006\037"
+	.ascii	"\273\0311b\267\np\004\311\355\226\225\272IdhQR\257=\322g:f\316"
+	.ascii	"\266\032\365Z-+U\321\234pH\230\n\266C,\224%\322t\034ZG\256\353"
+	.ascii	"\352\312\313f\210\343.|\214e\263\240l\220k\271y,+\243:\344\310"
+	.ascii	"!\216c\340\373\236V\267\262?0PF2\363\346\231\247\246>\340\263"
+	.ascii	"1\032e\254\217\333\0375\231\246\204\315\366\310\n3\243\324\003"
+	.ascii	"\213\016M\231|\346\247\255\310S\215z\257Z\255'\357\306\030\016"
+	.ascii	"4l\231=\025\314\013\265(aTo\247\245\262;Dh\346d\317\3519\025"
+	.ascii	"\242g\215\033\330\214z\255\216\fT\225m\371\302\367-\301T\027"
+	.ascii	"('\365p\322\n\321\025G;E\310\312(\016fv\252\347\2729\262t2\004"
+	.ascii	"[\033\037l\215\2347:\035c\365\336wE\003OG\214Z\023f\f\013e"
+	.string	"\243\032\257\363\322\022\0020\002)\220h\244\002\207\210\242\bA\372;\236\200\036\tS|L\321\023-\210\306b\021\370C\201X\324\271_\021\034\002\215)\206\302\2248\344!:\022\0369\240F\240Q\020%\342P<\"\002\251@\201X\274FF\300\3401\025\246\020B\016\213\020\320\0029\024\032! \003\022?\022\033\264\020B\211\220F\301\241P\310xD\n\t\241@4\256H\211C\237\n jt\323\343\220\030\304Q\221\016\205F\243\336\212\024x$4$\036\035\021\203\023`\240\201\240\020\271\001\b\\\024\211%\"H\213BEE\f\301!rg\250\242\032q\216?\236\3647,*\342\f\213\212vEZ4D\215z(\007\204\307\353\242H\f^cZ\264D\350\260Hh\004\364\021\241G\344\r\242G\337\215\277\242\242\210\036#pE\360\2720\246Ga\021j\002\206\013D\020\241,\200\307\fFA\027%\216\214D\025F\264\030"
+	.string	"\224\b\231\nS#\007d8B\323\243\213\023\277#\344\211\037\034\034\022\"\216\276\257\020!Dd$D\246@\211\210#\024!S\240D9h\n$*\236\240\343\301Q\270c\204\262@#@4D\022\215!\244\350\211\023\036\024\r\203<hJ,1$\nS\2401\205\320\bX\342hBC\032DS\364\003\235T84\201\032K\310"
+	.string	"\002\b4\210\300\b\230\022Q\240F\r\027F\210pA\004DM8\302\020\204\201\210\026(\321\320D:D\215Fdp\202\337\020\204\024=\242&\024\0255\240?4\005\246'\200\322\213\376N"
+	.string	"\340\301!PH\204\216\340\201\013\243b\0218\301\203B#:D\213\3603 \201"
+	.ascii	"\022\033\264\360}\003\016.\340\340\202\3367\340`h\210\003\022"
+	.ascii	"C\370$\206\354\220\210\343\t#\232\032\tA\b:\376z\351W\2108@\211"
+	.ascii	"\b\320\024h\204\f\032\001\2039\351\361',\236P\201~\3603Q\302"
+	.ascii	"\211\03548\004\246\307\241\020\247?\t\230\270Ca\t\303c\260',"
+	.ascii	"\036\355\361Wb\204\211\235\022#L\344\364\202#\204\366+D\034\221"
+	.ascii	"(\013\241\221H\303\3617\002\220\021M\217\300\243\236\017e\001"
+	.ascii	"4:\201,\036a\344\017\037\177\037\034\221)v\320\037Zt\201\342"
+	.ascii	"\210L\221\343c\201\022\035\221)z?\"t(LqD\f\366\244H\354\002h"
+	.ascii	"\204\022\375\212H\234\246iQ\002=F`z\304E\344\217\b\210\032}\306"
+	.ascii	"\264\204\340\020\tB\212\206PD\376R\264\250\307\002%\262\251\221"
+	.ascii	"\003\210F\240\007>\324\210L\201F\264x\204\242@\215\310\022\216"
+	.ascii	"?\026\350\0079\351o\004\006\351P\3503\"\022=\370\341\244_1\200"
+	.ascii	"\023\213\250Q(%\022\215B;F\243`\213\343\257H\250bH,q\001-\272"
+	.ascii	"H\217\310\024?\303c\360',\036\321\240\220\005J\364s<\242F\"\""
+	.ascii	"\340/"
+	.string	"8B\b\204\032\201(\020\031\201+z\322\337\006\276t\210$\006\177\250Q\361\bx\274\240\242h\364C\217B\342\320'\375\221\030J\207B$6BY\374T\004\177;\351\257\b\210\202(\364}h\250\004\207\023H\b\001\007E\030\321\024=\022:\032\211\307!z\024\032\n\201GBA\343QH\204"
+	.ascii	"\212\200\351/HD\177D#0\005\317\233\315\235\262\035Sh|\261\\R"
+	.ascii	"\272\336\300\034\021\263\303\022\325D{\341\226C\315\351\333R"
+	.ascii	"v\345m\331r\323\024\220\366\244\341\3457\215\354\322\250S\202"
+	.ascii	"r\273\334\315\212\031\244\336\223].I \234\247\267:.Z\370?:\320"
+	.ascii	"\354V\025[RI\275+4\275\236\236\2040\263H\341)rl1\316v\360\004"
+	.ascii	"q2\245f\005[%\304\206\033\260[\306\243\224\302\322V\357\177h"
+	.ascii	"\220-\245\206\374@\202\345\207\033^\2150\365^*\227\312\265\322"
+	.ascii	"y\231F\003\033Z\267\212U\013\262\345\304\362dk\312\307\233)\215"
+	.ascii	"\245gC\351M\225:f\177\\\3159\031R\257\330/v\235\033\316\252D"
+	.ascii	"\340\252\222\367\334\372\205\262u\235\027-\347\245\245O]\027"
+	.ascii	"6RQ~\235'\253\202\273\361\243\336\013v\262c\201\002'\244\371"
+	.ascii	"\033\204GrKI\275w\311\375\272O\256\334(\235\342\360\257\223\213"
+	.ascii	"\346I\021\270z\257\027^\362Y\363pcP\261s\326\373\353\325C\205"
+	.ascii	"\004\253G\275\227\311\320o\023\234\033iUB\352\335i\f\275\253"
+	.ascii	"\302Ur\273xPE\211]\301\277I\226$\341\312\341\203 \313\255M\227"
+	.ascii	"W\237\365\224I5<\352\275\001\203\236\250b\3318\311\322\230Rf"
+	.ascii	"fFdF\222$\215\0012\n\020\204Ca (\252\365\022\300$A\316:\307\314"
+	.ascii	"\210\210H\222\202\224\322\034\364#\310Jw\223\334\f!\260\266h"
+	.ascii	"\022Y'\3560E\231\314\3420\257\252fj\202\254au\027\271\302\335"
+	.ascii	"5\nKBUL-\305d\023\231.\362\034E D\311\344\227\217\357\306nHN"
+	.ascii	"d\331\033&\376St\255\356g1\"\331\331\032\240\350L\333kf\017T"
+	.ascii	"(\276\261x\220It\376\224\201\235\017\227\031\256o\242\215\311"
+	.ascii	"\366\202\243<\2172\214}\326\351\234]\372\261`\322\363Y. -9\240"
+	.ascii	"c\246\306'\3077W\261\020&\330s\366\t\354\3122\315\317\221\217"
+	.ascii	"\024/\367w~y"
+	.string	"\3250\271\202\246\037\257\026&\2058\263\301\026c\033'[-\206\257\027No\263\007\343\324\337\310h/\221\026\340\322\331}\2646\002s\304k\274\246\304$\326S\321\252\026Fho\017\004\034\352i\222oy\276\373B\302\003\247\343\224\frAQ\315\221\r\255\211\302V\211zle1Y\201=\020\244>\037\001\2643\271\257\350\342\242\225!\237\327\260^b\354\t\007\262\017P\313\226\253t\3035\203@)\004N\266Dt\372\275\202Y\215\311m\b\022\266\027\361d`\3544\210\036s?\220Y\345\276\311G\374\261m\323\363hr\370\363\t\034rN`S\202\205\261}\020Ip\356,\315\273\251V}\322\346\ra\004Fkx-\212\367\016\365\254\372\212.y\345\337\257\363\2171\004V\301\\\025{\340\206\006\213\207npS -<\342\340*ch\314\337\322\267\271\0329\201`\256\342zS\221\350\307\024\336\024N;LO\376b"
+	.string	""
+	.string	"\260\201\204\263\";4h,6\246w$\233\336\3250\310\035.\256\227\200,\360\373\013\t+24\245\025\b\023^\333\203h!\351,j\376\214#\242\027\232N\260t\246\217\316$\"\222_ \026\013\201\206Z\247\310"
+	.string	"\271\\u\2440Q'\363><a*\340\202\332Zm\202\344\246\252%,Q_\020Pa\364\241\326X\255\242\345\211(\216\b\024\376\f=^'\212\241p\350\270\0336\037E\001\367t\204\252\227\\\357\307a%\363\367\037\231F5\230\305;?\266]\001\230y!&$\375\276\013\026\332*\305\f\245\277\376\214QO\217\t\257\"\334\363^\216\246?Q\207\353\217z\265\370\261\244\037\313:\230I\201\332\262\013gY@\251\313\272\373\230\351\362V]6p\312"
+	.ascii	"tm\245M\361\263\030\323\241\3673\234\373'e\217K\277\242\305\007"
+	.ascii	"\357| \372\256X\364P\233\\\217=0\224\210\026\027 '8C\004\210"
+	.ascii	"d\204\002\271\364\327\020\2734\235\347Wes\034y\312Q\273P\215"
+	.ascii	"\022\372\243}\254J\3119}\022\020x\273\372^\333\333\034\347\220"
+	.ascii	"k\n\204a\0052\r?\236D\027=\215\002B\217SE\205\013\177\263\315"
+	.ascii	"\261#\006\240fz;X\016\005F\237%d\355j\277\300NQ\346\342\265\305"
+	.ascii	"\275\355\261b&\353\207Ar#:\331\312\016?\320\320\032\373W\274"
+	.ascii	"\304a\344\343\213\333\356\350o\020\252\243\177k$\362\001\205"
+	.ascii	"(7}\353\304\251\331o\t\236@G\244\006\033iI)\333\023\032JX\234"
+	.ascii	"\371\270\213 \304\217\263\301\240\253&i\234\026t\270\205\213"
+	.ascii	"\224$M]\203\335\204"
+	.string	"|\206X\001\2426\327H\036\331\255\353Et;\300\023\375\215V\311\317`h\004>\310\351V6\260k\210\274>\301\271J&\217\315\326\374\2547y\365 \001\212\3539@t&\225*d\323X\bs\005P\252p\f=\3060\277\325I\324m\247\345\353\367\3172`\344\340\337\312a&Zl\007<\355\341\0018\006d`\315\037\200a\004\241I\256p\265=\215OXk\362]\300\367\322\356\317\200f u\2139\320\254Y.\263\002\367'\233\355&\310\202H\357\316%^d\220C\211\"\362\336\276\310E\006E\270h\003\f.\321tJ\340\3133*\335Tf#\237M\307\225\037\336\274\311\365\373\017Q\361\310\344\241\307\242\"\343B-Y\2745E\215\351pA\232\365e:\271\337*\242\206hS\230v%\201\254S\362w\317AZ\251|U\347l\263\275\247\315d\"W8\030\214\242[Y\232\367\276Wy\t\214\237\246\371\357\200\235"
+	.string	"\251\306\254\304N\277\217\023\203\365\314\273"
+	.string	"u^\345\001\3172\302\304\271\332w9'L\274\0078\b\2256\310-\204d\233\360-\231\311+\003\225\273\210\034"
+	.string	"J\034\371I\0135\021D\251\026C3\r%C;\231\002\026vb\326]\372-\236\211\2213\b"
+	.ascii	"O\302)\273\002\311\215\"T\363xW\bU\266C+^\354G\323?\222Vm\246"
+	.ascii	"\350l\326\326O\026#\\@\021\2240\364\245G]z\376\t%\325\035\021"
+	.ascii	"\202\034m\323\371\237\311c\024\213\237\205R\362\364\302\2469"
+	.ascii	"\030\202`;\274\020\303z\224\271\254a\n\003\0164=-\266\272\236"
+	.ascii	"\236\311\256}\342\033o5@\033\3661\272\031k~\327\204n\310\210"
+	.ascii	"\224\241$/ \273\331I\212\300M=\315\255GT4&\202\244\370S\357\216"
+	.ascii	"\230\301\031\322\230Nlcl<``\234q\267\013\271\213\224\3008\t\217"
+	.ascii	"\331{\b\205\321\2654\214\226\352\205-b\225wh@\034p\343h\322 "
+	.ascii	"\377r\277\023\325\247$\353\253\023\344\034\\\270\270.\031RHA"
+	.ascii	"}\255<z\001\303r\201\336\037\356\004b\362\206A\0059t\357BGU\327"
+	.ascii	"\f\216\370\311\335\274\240@\227\006 J\315e\273\3535t\240\216"
+	.ascii	"\r{\210,\b\264b\236\301k\017\007\200\312dhc\004\btI3%u!\242\n"
+	.ascii	"\201ml]\332\034\026@]\f7\006\334f\323\223\232\334\234E\210\246"
+	.ascii	"x4\r\301D\356S\023\230wc\003 Z2\nJ7U\263\341D\353\341/\216\342"
+	.ascii	"\377\t\013\312{\214\342\341\025c\t\001\202i\364?\215\371U\222"
+	.ascii	"\b\361\fFge\357FI\"\253*#u\237h\215\371G"
+	.ascii	"\343\231\234Mp\206{T\377\032\354uL\240\3121\241Z\370%\003w\""
+	.ascii	"Be\324\020\211\262\254\016u\340\243\245m\f\313K=^\246\341|'\370"
+	.ascii	"\002+\374\206\373\276^\250\300\374\212\021t\331\333\026\271\345"
+	.ascii	"X\334\306\377\350\224\3110\245\311\n\376m\301\250K/\366\034o"
+	.ascii	"\223\252\021\004C\323C\307\361\037`c\3121,\220~\221\261\356."
+	.ascii	"\227\367\304\315\267\361b\305\202\310\207~A}\354&\252\276\365"
+	.ascii	"\256\205|\333\341\215\037\270a\313O\232\223\230\027\037\233W"
+	.ascii	"\365\tt5\317L\350\255A\017B_\243o\324\234\237\t,a\201v\354\254"
+	.ascii	"\321\276\021(v\241W^\026\354>\234\214h\025\016\355vO\345Y`\032"
+	.ascii	"\376\323\333cw\333\364\314\273\351\320o3\317\214\320]\355\201"
+	.ascii	"\336h\247\036&\020\37775\306\314\273\271_\227\324\275}\202\330"
+	.ascii	"EL\006\020l`\306\237\355\031\272\235\177\206\337\220{A\003\246"
+	.ascii	"\313\356\206\200?\225\274*\271n\335\201\345\263\315\317\352M"
+	.ascii	"\032\353\303\263\316{<\216\376KN\252>\030\336\027w\341{\340\205"
+	.ascii	"\243\216>\204\374\227\027L3\236\003\2067\240\360T\211\213H^\222"
+	.ascii	"\205\316\343\350o\005"
+	.text
+	.section	.gnu.lto_.symtab.3b6ceaced9039577,"e",@progbits
+	.string	"pgResetFn_barometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"baroPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"baroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"baroSetGroundLevel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"barometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"barometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"pow_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3b6ceaced9039577,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1596 @@
+	.file	"battery.c"
+	.section	.gnu.lto_.profile.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\363\001\275\r"
+	.string	"$\022\347\002"
+	.string	"+"
+	.string	"\254\372\361\363\002\024\002"
+	.string	"\002\001\002\003\002\004\005\002\004\002"
+	.string	""
+	.string	"\002\004\001\240\342\234\212\n\002\003\004\314\346\255\372\005*\002\006\002\007\002\006\002\006\005\002\005\005\002\005\005\240\342\234\212\n\006\007\b\t\246\300\251\343\t\002\n\013\311\215\301\376\005\004\b\002\t\r\347\217\220\351\016\b\002\n\002\001\002"
+	.string	"\002"
+	.string	"\017\246\320\212\236\0176\001\007\002"
+	.string	"\001\006\020\021\022\313\322\375\213\007"
+	.string	"\023\354\206\342\366\024\025\026\234\236\237\233\f\004\002\013\002\f\027\361\220\342\261\005\030\256\274\321\260\005\026\006\r\002\001\031\032\353\370\300\233\f\n\r\033\352\263\360\321\b\035\373\310\241\374\006\f\016\002\017\036\336\253\202\201\b\016\002\003\002\002\002\037\314\344\207\235\n\006 \355\241\206\304\017\002!\250\267\374\351\002\002\"\300\253\277\314\017\007#\205\246\225\244\001$\317\356\361\267\004%\350\300\306\254\005&\307\266\257\307\n"
+	.string	"\002"
+	.string	"'\367\345\303\353\007(\207\312\266\244\016\002)\320\374\270\356\001*\325\241\220\227+\326\327\255\312\n,\355\220\274\212\006-\240\342\234\212\n"
+	.string	"M\250\221\255AD\f5\006\255\034`\002SR\303\007\021pI4G\224e\337\b\255\261xo\231F\223)\207\367\264\002\217\f\251\233c\016\023X\306\273"
+	.ascii	"\260/\032]\262\374\333F\007\343\205f\2128\213\362\032\263\003"
+	.ascii	"\001LU\027\340\242}\237\364d\375\355\022;O|\021\222]G\217J=\027"
+	.ascii	"SD\322\032\353\345\352\365\270\337\267a\013-\264s\272Z\203%\225"
+	.ascii	"{\022\003\260\2418#\242q@\216\351I\316c|}\203\016c\tqI\377i\370"
+	.ascii	"\241\247x\305\020B\357\035"
+	.text
+	.section	.gnu.lto_.ipa_sra.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375 \307\245\003"
+	.string	"\"\305\020\034\220G\303\001\377\377\377\377\377\377\377\273\210\210\210\b\230\261\200\275\031\001\313t0\031\231\002.b\017k\330\302\022v\260\202\r,`+jN\322F\333\266|\234m\226\331e\225M&\262c\032\263\320\265\t\231\b\024"
+	.ascii	"E\b\243\263`\346\335\235\246A\233\231\020p\001T\260\003\307\246"
+	.ascii	"\262\2222@\237\0245\303b\036\013\312r\316\024\330\2602\370%\214"
+	.ascii	"\r`\001"
+	.text
+	.section	.gnu.lto_.inline.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\313\003u\f"
+	.string	"\342\216880\221\322\001\200\247>\355%\225\317\344\377sS\254\321\274\325`\254\020\022\r\257\217\331\r\fP\215D\342\322 \206B\320\370\260\266x\251\016\214\327 Mx\b_\244\021)w\n\306\270\260\250"
+	.string	"\027D1!\361\211\020\241\211\255"
+	.string	"\030\"@S\376o~\020i\316??\343?=\366v\346\237\034\241\222\376\351\331!$Z:$f\266\271\316t\2152-\031j\357HE\3268nx\201\2646\377A\243m\251NJ\236\025V\213\361$t\037\272F"
+	.string	"\371?\355\365A\250.\247\325K\036vZ\275\254\262\001\301\332r@\226\334\240\340t\333\"Q\031\351\\\360e\"\355x\223$\315\376\226\333\322\313\004\343,\260)\016\253&\304#\324\227\030\213I\2073\265~\372\377\232\r\252\230B\2314\324\226\240\272R(S\203\315\340\f&N\250\001e\205\002\"\252\366\330\fp\002\2411+\036\022\200CEA\314 f\220"
+	.string	"\033&\234\231\370\371\216\336\204\367k\253\253A\030\374\216\016\253\345E\275\205\203m\276\322\246\336\360J4'\204\250\030\"\327\346\310\264\0335\352a\236,\033\315\002\323\004T\324 &\201\325\350H\030\016\003\377\232>U\206m\242\263\024b\274.\321\266\022D\003\251\021\300\354\177\324\377?\227cY\312r{\264\241x|\305\215"
+	.ascii	"\317up0\306\353\350\033`\325xp\260\351\304:\364\263\316\022`"
+	.ascii	"\315O\222t\b:K\211\037\324\032\320i9\234\n{\365\275y"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\345"
+	.string	"e\006"
+	.string	"B\013!)pK\222\306\374\377\277\256\n\201RUUU\370~UW0\n"
+	.string	"\200\003\312\365\377\377\237C\340\376\254jy\370\r1\304n\231\002\267\270b\212'\2268b\210\037v\270\341\f\227<\317\363\240bj\265-\\\341\204\246\030f\027)\255G\252\332l\263\034hPnp\301\224\t\036x\262\344:6\216\275\303H\205\232U\322VI\265\033\205\234\223\202Tf\002\007,\313\220\023\031r6\262\214T5@\304T\003\331\"\334G\035"
+	.string	":\206\333\243\340\270\200Yh\200\001ap\035\311\"!\365\212\307\264\003\352}A\034\031\230u\326\246\265\206\322\340\343\031\202\306\036\244\332\007\305\332B\220\231B\216O\022N\035\344i\0174\001\342\242\231\003\030\275"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.pureconst.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375 V\035\002"
+	.string	"b\305\017\026\200/t3\212\310\300L5\003-\330\220@\302\022y\020g\227\331\0163\233\330\274\2465\253I\315iJ3\232\320}\256s\233\311\\\345&\023\231\3074f\361F\334\341\n7\270\300\375\336rwZ"
+	.text
+	.section	.gnu.lto_.ipa_modref.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\375\005"
+	.string	"\242\307\026\037\2407\303\001\377\377\377\377\377\377\377\217h\366\035\021\021\021\021\031i\273\375\212\370\377\326\354O2\005:\032\323Sb@\213I\225\324\350\2014z\252\307i\024\007\355\236W-$\2018\350+8\317\3469\202\016\\\307<\231e\267<\025\202@\362t\206\235\362&\273\365\\;5@\304=\002/ \320\002\021\233\365\246\210"
+	.string	"\276\207\036\254#\335"
+	.string	"\036n\211\231\bD\022\374\007\361}\260\322:\241\3661\244\323\200\002\362\242\352(\221\223Y1*"
+	.ascii	"\022x5\340\341>\271D\0233\245\261\006&`\026\246\350\026\306K"
+	.ascii	"|\206\265\002\013\306;h^T\371@J/\370\026l\363\025u\034\254X\344"
+	.ascii	"\241\025\312\r"
+	.text
+	.section	.gnu.lto_.lto.4a7ff220367600ff,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_batteryConfig_Registry.59.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375 \242\315\004"
+	.string	"\264\bk"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\337\301\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\376\006us\250\326\006uq"
+	.string	"\005\001\006'\001$\005\001\006\035\001'\001\213\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_batteryConfig.61.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375 \252=\004"
+	.string	"\264\006\235"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\n\036\005\001\006'\001\232\003\001\005\001\006\177\177'}\001\002\005\001\006{\035\001\344'\001\254\002\336\312\256\003?\202\210\200\320\002yw\311\001u\310\001s\307\001q\306\001o\305\001m\304\001k\303\001i\302\001g\301\001e\300\001c\274\001a\277\001_\276\001]\273\001[\275\001Y\274\001W\273\001U\273\001"
+	.string	"\f"
+	.string	"`\b\230\013\216\250\330"
+	.string	"\315\200\334\3131\241\332\343)\021\\\2212\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.62.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\226\002\025\024"
+	.string	"\306\343\200I\260\326M:t\374K\311\023\334\013\271a\020^\364\270'\255\371"
+	.string	"S\270\221>3Z\333\222"
+	.string	"\254d."
+	.string	"\263\266m\241\264\304\322\316\345g\3134\330\200\205\237\037\370f@\t\313\354\007\341\211\347\377n\233\304\211M\032\331d\313\224\002k"
+	.string	"b"
+	.string	"q"
+	.string	"1\342\247\201\267\204\237\340\005\204\237\266\331H\336+\3327\375zv`\355\356K\312\270\355.\261\025NP\252\315G0\243\307\310\273\335u\\\320\305\023\331\005\235\351\007l\354\200\264\305\342aO\n\2350W\340\231\016\3420\372\215\274\237K\260\305*\306\021\025^\016\204\021\252\362a\341\351T[\020v\327:\362V\334)\267\335\302\266\003[o\004\241J\002MFt\352\3046\2107\355\210\273\272\031?\307u\310\374\243O\213\240\351\307O\237\026~\252|\340s$\244\264\204\323\237\335\313\251$\262\017\356\356Z\016\331_\372\303\251\236\240\032\224j\251j\r\220a\207\245D\201\323\256\212\337\223\365M\0375Tl_\355']\311\366\245\023v\355\302\200\212\332\355-p;C\005\312;\031=\324\327\204R\222\370\324\177\324\370G\266`c\023~J\331\302Qe\001\315\002RQ\276pC\345\323\271\330\027"
+	.ascii	"OS>\225jb\365\002\034\240\357\035\nG\334\305}\364\237\316C\303"
+	.ascii	"\006\034\375\210\023r\b\355\034XJ\222\017\205\274yE\355\017:"
+	.ascii	"\372\321,OH\276\234\274Y,\332\335\356\276x\230\352e%\271)\224"
+	.ascii	"\323\030\205|\362&\002\264\233\330\216\016\206\032Ol6\033\001"
+	.ascii	"[1L\246\304,V\253\345tx\321f2\032O\214\366\342\321\311\331y\301"
+	.ascii	"f\264\227\214\213e!b\263WM&\233\275Tz\270\203+\207\\\201\211"
+	.ascii	"\017's\256\004j\333\220lJR\336.J\"\037\310\245t\371\271jMi;\346"
+	.ascii	"U6&\006Ev\267\201/\344C\"H\240\241\t?C(\343\022PN\371\236(\236"
+	.ascii	"\360 \024\304\3355 \200\002\031),\017cB\007K\214|(\367\006m>"
+	.ascii	"\327EFQ\"cJZ\330\004\257\007\211\346\330\300s\223K\326\314!\215"
+	.ascii	"\256\227\207\350W\214\255\305\263\211h\366\234d\376\321\261O"
+	.ascii	"\266G\203qw\327\340n\374\236J<7\024~^\020\355\037\001#\007,\314"
+	.ascii	"\002\033\242\356z\201\3266\300\365\355\"^\243G\227|\223(s\236"
+	.ascii	"\331\345r;\020\364h\346\253(\307q#y14\202\330\003"
+	.text
+	.section	.gnu.lto_updateBatteryBeeperAlert.63.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`@\001E\r"
+	.string	"\346WWC"
+	.string	"q\234\016\263|Z\004(\353\021\342u\346\020|%s\207S\f\253\306\271+\242\214A\257\315\001\025\n\337*\340\177=\345\ffU\225n\264\341h\357*\001\004U\265{\033\250F\254i\242"
+	.string	"\377\367&[\246\024C"
+	.string	"A"
+	.string	"F"
+	.ascii	"\237\317"
+	.string	"<\262M\036zlE\305\222 Rcw5\331\361\321\347%u\344+\b\214\017\364>\r\314\270\316\372\365\341#\305\007\242.K&\214\300\252D\303\005<I\255\034\330]\353\007V\270\261\333V`;c\037$\020B\372\357\323\017a\237R\276u\305\320A#\025r\201\244\243\035\226T\252\354\313q\034Q,9lUK,\353\020##cw\302\230\262\342\\\261\301\366\375\220\267D\007a}\341bw\263O[dg\001&\351\371$~I\021=\265\361U\311\212\205<\341\243P\353\267\247\021\016\233A\304/a\023\313\256\367\324\017\302>u\300FP\265Nv\027\363\021~\312\342\261\0246\\\f\353\tZ\250@91\351\r\373\341C\200\374\017\007\346hB\\\347\363\331,\320:n\353<\235N\3630\3304\3208\\\247i\nxs\320\341\264\317\266qZ\026\222~\255\3440\002\017\"I\226|\021\377\265\273;+$\026L<"
+	.string	"\t\352\002\240\226o\230\375\240\323\177\02602\212\001\036"
+	.ascii	"3\241\233)\006\340\005\017r\201\354\002\216\247\032\024H\266"
+	.ascii	"T\222\341\300g\266\272\306& \030\350\322S\331\026\335\3511s1"
+	.ascii	"\263\215d6\026Rm\327\0055\240L\27441\3169\230\302_\016i\032s"
+	.ascii	"\252Q\340D\347\226'"
+	.text
+	.section	.gnu.lto_batteryUpdatePresence.66.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`2\nE3"
+	.string	"\212U\330\022E`\332N\007\273\267);\361u\324\301\n\326Ha3)\376\257\314N\322p\324\366\261\207/\005UZ\2255\324\262B\227a\270\363\204;O\270\363\024\346\323(\255\3435Kk\302@aI\355+jB\266\334;\245\224\002\034\001\377"
+	.ascii	" \001-\2265J\220v\353\206\353v\322\317\254\306=\307H'AE\026W"
+	.ascii	"\305&o6\002\333\226\255Y\214\363\001\307\315\344\253t\205u[\273"
+	.ascii	"q\2771R\2113E\253\361\007\257\263/\265f\343V\322H:I\212\2362"
+	.ascii	"\335\222\212\255\305b\263\200,Q\033\352\225\211\212\275.[y{U"
+	.ascii	"[\347\246`\356\265\226\256"
+	.string	"h5>\332\253;\353\225y\0053\262\327\025\311Nf0\315\026\326v\333\031h[a\333\266\315\357\321\316V\356\350\344\340\334$mjh\220Gc\221\275\253\372\356\344\036\240\366V\205\305\242\225;d\352\222\251w5\346:?:\347\007\216\230\017\277\021\223\206y\222\f\207\333\250J2U\250\354\352\313kX\006\026\240catd\2215\r\222\251#\353F\037o\3145\263\354\312\206\033Y\006:\262\272\272\310Uv\265\345l\032\324\357\212\304z\272j\203\325B]\266m\333qT\376j\201,;\274\264\336\225\227\352\363e'\243\323\332\255\260\246\334Y\006m\333\262Wae5\3634s\317`\346$f\343\206N\323\274\013\235\207\367\363\311\262CC\346R&\360\211\372Qf\376\362\001\324\370\303\320v\031\212mK\245\304m\245\257h\330\300\201\303\355u\371\013\304\244\035\307K]\205\251\330\266\255\0227\225\256k\342\036\353\225=\200"
+	.ascii	"q{e~\3075P\326!\232\264\241\210\311\222\343;\350\372\367t\365"
+	.ascii	"\230\336Qy\031N&&&\236\351\240\333\357\337\317\257\251\206\322"
+	.ascii	"QBp\217\361\210'\357\252\247\333k?r\257\rmK\312\023\231\331\246"
+	.ascii	"\374\243\314\255\266m\333\362\2031\263\316J\254s\002\3269\351"
+	.ascii	":#\270\316H\254\363Q\2735\037`\235\233\327\331\210u.\272\316"
+	.ascii	"D\254\363P\3035\013\261\316\006\256s\020\353\ft\235\231\327y"
+	.ascii	"y\235\177Xg\037\326\271\207\207uV\266\223\346\344u\266\271\316"
+	.ascii	"5\327\231\346:#\257\363qu6\256\316E\326\231e\235\357u^\257\263"
+	.ascii	"\272:\277\352\354\357\334\n\222WY\232d\3326F\342a\1774\245C\243"
+	.ascii	"yn\304Ndj\340\300\301\355\365\317T\t\"\377\3704\177\351\236e"
+	.ascii	"\017\3720\203\031\344w\233\237\324\370GC\343wZ\027\355\230b\270"
+	.ascii	"E\363Qn\265A\274c\361l\020\210\221\347\223o\305\\\034\323U\202"
+	.string	"\311/\276\n\264D(\"\362\2437f\\r\307\007+\262\037\324\0058\305c\237\347]\f\024\221\250\357\263\377s\367\374Z\377\252\317\374\365Y-O#|\241\0073\b\252\337s\255\232I\221C\223\032\377\271\001;\020B\004\t\022n\257*\320\336\252\004\227}f\\\305\2172\205\373\0175\355\302<\241\275P\370{v\372f\270\245\375*<]\225\240T\210\333\207\324z;#d$q}e\354\316\320w\371\351!\031\334\273\023\372\241/\322\362,4\360@/\364?rO!Ao\340\033\212\b\307\026zO/\350\235NL\n\364\315\244\325\2652\302\351\226\267)\2568\276\353\363=\3574\265\363f\272\253\374\236\367\021\363,\233\362D^\276\362Y:(\"\363}\276D\220:(b{\235\205\025\256?\037Q\"D41\255'883\031\241\200j2ab\251C3\n\352)\212DST\223\004\210\245\021M&\250\250\246Q"
+	.ascii	"~*\321\004\3254\361\364\004\325D\262I\365\2031\005,,R?\245t\260"
+	.ascii	"\346a\234\312;c\272;\330A\274\302\006\364\034x[\204\376\3450"
+	.ascii	"\274\253\323zH\353\356\214p\347\243\3549D\335\322.\362\345\001"
+	.ascii	"\301\261\032j%\002U^i:\037\265sQ&0\347\301\022|\321;M\361\260"
+	.ascii	"t\322'@\372\244o\302 uPD0k\206_p>\312\b\236\350\235\246w\027"
+	.ascii	"\334\206s!\200\223bf\360\006\351\211\362Z\312\030\274\006\r\244"
+	.ascii	"oi7\223h\365 \323\227\344\353#\245\337\337\201?j~\321\0370\372"
+	.ascii	"\246\005\227\341ZFD_\344\306K\216\345WD\337oM\340\257\006\330"
+	.ascii	"\327\232\324y\314\001\312\331t\210\333/\300\253\310K\315\270"
+	.ascii	"\346j>\3524\033\342/\234fV\306)\2253B)\276\206p\231\235D\334"
+	.ascii	"\005\204\037.\376t\250\263\210\023\315\231\346L\273\275\032\245"
+	.ascii	"\320\025\022\3328\025\223s\315A[\315\037\337\346\357\235\363"
+	.ascii	"\210K9\213\232\200\326\250q &\021cJ\r\211$II\n\035\220\002\221"
+	.ascii	"\251*v\022@\025AKk&5&\331\330\177\003c\2505\207N'\316\021A\306"
+	.ascii	"\274\231\003\226\246 w\254\317\306\315.2\207\217N\013\205\321"
+	.ascii	"R\366\273\005\253\256\204\325J\222\375_\t\224\023\262\307\213"
+	.ascii	"\270\334'\311\364<Z"
+	.string	"e\247\347rz\265G8fPB*[\212^*z\006J\r($\237\245<}^\313kM\202\366\261\"\211^\272F\336\233\003\215W\272[\205\002-n}~\327\250C0\244\373\234\335\231\202tei\215t/)\333eM\336s\f\353w\275wt\225\336\205\255\370\207\376\234q\342n\266iV\266=cRD\377\020\212\356\354\366#<\212\332\0300\032D\210Z\216?\226\030c\330\320G\240w\231\013\321\270\357\315B\353<\327\024~&\375`\343yjB\233\247i\302\361\243\030i\201\261\361\t\351L\027\202\016\235\244\2248\201\240s\203\241\032gP\312b\267ehC\321\001\354\263\331\375\2461D^\330\366\323\334|\223\336\024\211$J\312\216\004\233\353\242-\020+\310\n$C(@\243D\307\001\271 \322\rl\023\f\004\034\205T\231\336\330\247o\372]y<Em#\230K\240\305 \372\214\032\233Q;\312\257\251\017"
+	.ascii	"\b\266\345>\205\016\244\325\327\260\373\274\266\240\246\266\f"
+	.ascii	"\3711D\345?\025\016\364S\212\232\020\217\262\227\231\240\266"
+	.ascii	"\304\310q]\034?\027yl\247v\336Wg\254>&N\255\"\322\350J\263\320"
+	.ascii	"\211k|\273\236%\007\232A\347S\366\262/w\240W\347\356\233\244"
+	.ascii	"n\243\006"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltageState.67.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\203\007\255#"
+	.string	"\246\275\326I\240T\322p\005K2\370\f{k\017\374\367\312az\235\246\263\247\031\301\034$\020\035\004V$\200pk\0021\333\275\007\223\016\304\006a\256\314\263\360k\260.\261\336\302\271\"w=6\343\230\231\217\220ndk\226\354\275\267\2242\005\277"
+	.string	"\255"
+	.string	"\307"
+	.string	":\225\237C\3718\224\257\246\374\024\345\243'\377D\371}\362\271\371K`\005\253\314"
+	.string	"\221umjBY\311\320\260\026\314\312F\373\2612V\313\303\3068\272d\266-\372{\370w\213\362\356I\277\332*W\254\252\n\034\306\255\266u]\205\255b\223\366\347\353\361v\272\034NM\321\2639\351\253\372\344\216H\245\375\371\242\222\334\343A\355\016\312\004\353r\213\345D\202q\347\200%<\330\266\210S\211\023\330\304\342\270Y\013"
+	.ascii	"\313\351\211U\325'\005 \025\"j\321\"NQ;\344\007>}H\246\363&k"
+	.ascii	"\031\004r\211\373\204Q\207,\246)\353\272\256\224S"
+	.string	"\324\311\252\317\272\256\347#2\304>e\377\r\376O\360\253\300B_\253Eoah(]\224[]\242\301\320\"r\363\313\265\277$\231\022G\331n\252\375\372\352\3407\034\337\034{v\265\242\350\372\332\270\032n1\244\213\236\217\253\021\354j\267\376\253\365\b\256\266uU\332$\037W\0017\037\370\355\337\031K\003\303\327\352DC\336\343\242\337a\272\350\366\003$0\236\210\334\374\225En\252\177\317\265S\374(\277G\345\357\240|\035\225\217\243\362mN~\315\311\247Q\371\301\223?\203\362eP~L\312\207Q\371/*\337\005\345\003Q~K\312gA\371+'_\005\345\247\234\374\237\312\367\241\374\036\312\347\245\374\235\312\017g\277N9K\362ku\311\274\261<\260\245\352\353#g\332\221\t\321\3279`Yd\305VJ\233\352k$7\225\366b\r\325\351^/\326\315\366b)\257{\035Lc\302\3325O\301\222\021\331\365fm"
+	.ascii	"\250\244YR\206\326N\353\264\3124\276\345Z\327;\275\312=] \217"
+	.ascii	"\344\350\342\232\341\177\001\003\336\243\256o\212\255\364o\220"
+	.ascii	"\035k\320\301\201\203t\321\\\243K4\267+\327u=\233\3528)\032B"
+	.ascii	"\226\370\311\325F\033\3271[LWEn>m\365\301\002\201\200[\327\245"
+	.ascii	"\002_\037\373#\202\204\t\023\322E\323\336\2613\255\263\321\355"
+	.ascii	"\261bA\024~~\322E\317^\257\252'\356\3565\276\375@\033\026\204"
+	.ascii	"[\327\265\300w\307\362\b\277\300s\224a\bi\203\260hHD4\f\222y"
+	.ascii	"\020\017\007#!$$\240\n\302#\243\341Q\221\320\221\260h\b\210H"
+	.ascii	"\030dt$\344\241\371P\203\220\221\020i84\022\356\224\304=\267"
+	.ascii	"Sd-.\314\005\031\261\213\337\032{\237\363g\303F\233\316\t\023"
+	.ascii	"\301K\252Y\215\027k\276\232\246\351\225bbM\013\253\236xm\322"
+	.ascii	"\264\272l\272y-\017,J/\030%\3309`L^\327\023(\273\231\376\rY\342"
+	.ascii	"'m3\335\233r\342&V6\205\246\373bc\0036\2618\346zZf\3136\246e"
+	.ascii	":\310\204\351\230\003\273\326\004&\312\n\247{\\\372\245qz\265"
+	.ascii	"^"
+	.string	"\372f\211K\243K\246\333\323\200\344\330\b\034\260SZz\245\201\035\363\305\322-ji,\275B\252TzE\t\202\037\225^\257\200\233\250a@&\221DC\")HJ\222a\r\340\002\031\241\251:\021 \245\203\n\241Xhg\337\013\007%\034\2272R:W\226\254#\036'\027\302\242\272uo0Y\225\271\275aR\250\345\211\236C\217\220\004;c\233\330\317<\225\345\311\034Bw\027TAc&\b\362\001\271\264U\276\231^L\315C\021\360\361\2123\274A\335C\fC\236\203\2133\253\354?\351\365+2Z\004\177\337\311\333F+\365b}\235\373\335\364\233\006\222\242yPTj<\375^\237B\251F\310\236\036\363\376\032\217\3570\003PB\367\266*\276_\"Z\274\017\\\312\b%\341\334Z\2039\020\004\212?\250\037w0\274:'&\204\037\307R&\013\024n\215\361\307\353\270\363\346f\312+x\214\326\253C\274\334\252"
+	.ascii	"\r\034\206\323\275NK8Pf$\322\322;W\227P\251`\b'\002 y\261k\254"
+	.ascii	"\3242\312\026\3318q\277P\261\242\343t\364\300\360\305_\365\""
+	.ascii	"\344\006\311Am\036\313\346\200\020\353\f\f\343\262\032"
+	.text
+	.section	.gnu.lto_batteryUpdateLVC.68.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\366\003\345\031"
+	.string	"\206n\244H\300XM:\300\033\207\342\271x?\031H\247\241a\022W,\305"
+	.string	"\na[V91\216y1|\370\252\223\352,\377\f\321-\320\266B\210\266:,6\3466EA\220-\331\033A\3337_\265[\3760\261\204\220\275\211\334)\005\213"
+	.string	"\202"
+	.string	"\230"
+	.string	"\326\261\305\317\213\266/\355\357\370\021\317\221v\034\326\n\203\311H\255;\b~"
+	.string	"~\"\370\212~z\247\241\237\346\261\271|7\243~D-\200\226\244j\255\254\225q\236\253B\360\243\323[\311\343\1776\341\r\327sU\202\360\263\201\201\202\305\301\0256N\250\220\037\220\244)>E\234-"
+	.ascii	"\216\204\364\274\006\271(A\001p6o5%\206\026\021\367#\367\351"
+	.ascii	"\004\013\017A\255\365<.K\340jR~6\265V\313\033\016\305-\3366\016"
+	.ascii	"\333\026\354}\nS\3567\304\224C\205\254\265\366\354\352L\345/"
+	.ascii	"\372\355\240\324\364#\303\330\366\360\037/\260\326\237\b\276"
+	.ascii	"\217/\201\360\213>\r\213\311\337>\375\030\375\374J\030\212\312"
+	.ascii	"\035"
+	.string	"!\371\310){W\223\253\263\357\325\035\262?\351\025\225\2469\322?\263\322\342J\253>\351\360\223\006?\351\357\223\246TzNioJ\257'-W\372\003\026D\345\204\210\204\326\312\256\232\230\032S\235\346\221\032~\217'\351|g\006:\243\334\216O\007\347q\001I4z\276P\241\331\325~`\200\312\314\235Y\232}\322\275\033\270*L2~\030\325\344\224\247\3548\315\235AKr\374[\235\221{;J\241\201M\336zJ\234 \321\325A\375\206\332\025\376\344\306\211\030\224D*jf\355\013g\262\263\004\203\356E\356H\350\247Q$\264\003W\216\204PLRQ\016\222\2004\231\247\321]\031F)K\2063\321\300Zk\004\237\310\213h\330\300\201\003\375\334\375\022\321\315\204\204\t#ou\3628T\356\250\204\345A.\004\307/r\313\345\242\017\376P#\013\361\232\321X91\030,\326\" \273q\301^\026f9\256q\244\265"
+	.string	"\270U3bt\315f8\035X\2621&\313q\311X9/\034\030\2535\312X5\006\034\023\341\032Y\263Xld\211;\237{u\207(\210q\362\331\232\352Y\260\\\307\020 7/\241\270Vn\024\\\251\262\345\346\305\007\312U+\356m\271pUK\233t\\ \251\340\206\313\200\214M\307j\277\005\267"
+	.string	"\030\233\r\272\206\272\225\320o\rl\261\031\325\226\3567FH\027\2402\336\325Z\301\325\331{*\232\372\004\272\332K\250\021\300\220S\320\t\n\032\212\023$%\315\001p\002\031)\274:\021p-4\210Ha\266\031\371\214\2377\"PI\353i{\312\260\264)\352\235\bq\2612\212p\0178\367\321}\250\310i\227E\304m\266\374\205\310\246r\320uC#^h\350\365\342\"i2\3146k\373{.\3114\300)\210@\261\230\300\265\0319!\026\206\264\024X\022*~\210\237G,6\264\003\371\242\340%\301C\272\346\004\336D5\222\217"
+	.string	""
+	.ascii	"$u\\\310\034r\214\004\271r0\304\246\324H\376\301\030vu\311\273"
+	.ascii	"\253\260\211eE\246\345qd\231#\030\250"
+	.text
+	.section	.gnu.lto_batteryUpdateConsumptionState.69.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\230\0025\022"
+	.string	"&`sG\320\322(\035R\303$\265\003\003\332\304@f\215Ln\tu=\302\035\252\272\263\322\"b\022\205\340\324\232=\332?\r3\316?\207\236\320?\312\306\200\261\320V\017\320\022\017(\020\r\001\2733#P=\250\372\223M\b\2212\245_"
+	.string	"Z"
+	.string	"]"
+	.string	"\337\273\227\374\262q\374\026bc\r\212\227\236\035\273\013*\210\277\016B\372\242\327q\232/?\226\220f\264\226\203\214\220\276!\230\016\234\b\t\030\231\214\261\304C\314\314\275"
+	.string	"\264\227\022\355Bv.\311\311Rm\037\031\202\231\341Dv\3679O\f\264Xf,\331]\347\214\026s\227n{\3076\003;]\002*O\261\372ve\013\374\333w(\3706\357\334Z\311\317\336\371+\336\273k\224\021\361\260\301\362\310\276\305Rk\366\271U\032\373:w\344\322\034\227VMg\246_\022`bF\003\026\273\031\216|\254P\367ss\235\333?\341\333\022(x]\207\345\333\021\321\247\306'\307\356\315\300;\037\b''\336\273HDc\207\016Ok\276\213G%\360\241\004\217QH\332\246S~\026\365\266\377F\003\007\241\230\266\330\267\335\355X<U"
+	.string	"\266\267\270\017\213o\343\020\205\362\336\251\376\206\221\f,\217\362\234\326\374\024/5\177\244\276\"\245'\365*\214rw[Tk\276\005\357\212\302SC\226=l\007(UJ\2252\251\204\017B\224\311\245\nO\254\320\301"
+	.ascii	"\237H*\260B\227\313\204\002\266X\253\226*l\201\252\224I\005<"
+	.ascii	"\261Z I\001\257&\204,\320\265Z\261\300\322\rv\245q\316? \034"
+	.ascii	"!\230\306@\034\304\331\b\"=FQ\310\356~ZsTN/\202G\006\204\003"
+	.ascii	"E\370\341\024\301\206\"\034[\314\233x\376\213\3030\221\0208 "
+	.ascii	"\320\002\251!\363\263d\221\263\355o\262\237{\333\367n,\256p\344"
+	.ascii	"\346u\3672e\241-\334^\2755\3541\b\305\225/[\371V\215\270\360"
+	.ascii	"\255\273\360`\375\222/\372s\233U\244\313\200\354Y\246\322\356"
+	.ascii	"e#\233\371\250\332M,5\024=\036Q\203\006r\202\244\025\311n\321"
+	.ascii	"r\\4ap/\2702\234\263\002\023\334\202\033\355\205\241\020z\273"
+	.ascii	"\321h\365\325\243]\207\217\3452"
+	.text
+	.section	.gnu.lto_batteryUpdateStates.70.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\b\001\275\f"
+	.string	"\266\227UB\020Q\234\016\030V\374\214\003P$\355\324\243\312\241FD\320\337\212\001 \246S\206\200%\321I\207\214\034\350\265\222:\330\300dOJ3\031\231\270\231"
+	.string	"\270\\\204c\2165\034\2358\232\003\366\335h\223\275S\n@"
+	.string	"A"
+	.string	"C"
+	.ascii	"\337?&x\262\313\341\304\310nX\300\004\256"
+	.string	"\323\313\003T\247\324-\325\251?[\306\303\017\373\323\013\013\"6v\267N\017\377.?\377 \237\200\244\320\245\225`w-AR\307=o{\200m\004\3667\004\036\366\224\276^\272\255\233\356\352\037?E\261\264\200\241`\334\3050\346X\221\222\210x\3517\331\017\375\022\0171\201.\343\310\201\253\004\372v\354/\3408\305\230\261\033bNm\340:}\305\366\245\375\021'\021\025j\214Pd\326|\t\b\377t\023 ?\204\035h\362\340\251\257U\247\325|\310+\215\222\033\032Dr4ER\323\356l,D\n\020,$\225\264?\021\344A\313\025*\304\321\f\331aH\316\016\366\251\335]\317\033\215\344hd\327 \353h\f<O\306q\037\f\200\261\214\004.\363\274\r\247v\334\326y\262\256z\264M\247b\\W3\002\274=\310\270\352m\033W+\341\236\332\351\341\005.D\321\034\371\232)\260\203\374\031\254Y\315kbD\002\032"
+	.string	"2\241=i`\\ \210\003\22755\036Sc\202\024\320\256O\324E\252\025 \034HA\263\3415\005C\327@/\356\226\320"
+	.ascii	"\374h\302\302E\035^A\004\234\242A\254N\203ky!L2"
+	.text
+	.section	.gnu.lto_getLowVoltageCutoff.71.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375 \365\315\006"
+	.string	"\362\314/4pM\322\001\240\237_X=\037\t\303[\0312\347\220\247\350x\r\241\353\267\206\264\244G&\247\354R\226\324L\375\365\372\027\312\006\217\214\262z)id\223\275S\n\266T\030i]W%\001N\031\347\305\232\360\242PY\200\0269a5\340\310`Ix\305(\341T\367\316cs`\322\356\346\324\337xm\360+\376\214\301\332\351\237\217E\177\004\033\347`WMs\022\366\241u\036\273Q%\"\b\237]\210\317\311\206<\020\013\333\031{\3621\236\221q&P):"
+	.string	"#$\017\035&\273\025\272> \372\223NE\177n\342\331[\346_\343\320\305\207\007\345h\336(\007\273\353F9\235\333\335v\201m\003\333\021\001\b"
+	.ascii	"2\003\336::V\b\3055\261\032!\264\020\231\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_getBatteryState.72.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001@\341\334\364\016\310B\n\237Z\203wU\0210\210t\251\005\337,\352=\234d7\320UB\357\262\022\025\340\024\205<\327\np|\265do)S\n\306X4p\262\254\013\302\253 Ue\246\352e\022.\n\017\003\253g\0310\2650\301gQ\024|R\334\353'\265\342Q\006\373\034\217\227oa\315&\217\335\371\233\350.\025 \302\223!;vR'\354\267\325\217\355t*\005\024r \262\373\020\002-\210\373\270\260\315\261%?\343\032\034_-Vd\001\016%\r\035$\273\361U.\020\335\265S\242;\245\370\365\274\374o\274ax\214`Y\34791\330]'\226A\334z\333\004\266\013lK\004\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getVoltageState.73.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"B\r03`m\322\001@\203"
+	.string	"\247@f9\364\2515xW\025\001\251\"}\321+\321,\352=\234d7\320UBoJ\207\223\300\034\205<\027\253\026\370n\311\336R\246\024\316\\6p\262,\214\302\253 Ui\246\352i\0260\f/\003\253w)0\3250\301gQ\024|R\334+(\325\362Q\007\373 \217\227\257\341\r'\217\335\371\234\350.\025\240\342\223!;zR/\354\267\335]+\310v:\225\200\342$AdW\"\224\262&nd\303v\307\226\374\216{t|\265\230\221\005D@<\204\240\354\306g\371@t\327.\020\335)\306\257\347\345\377\343\215\243\204\004\313<\317\n\302\356:\261l\342\326\3336\260}`\333\"\007"
+	.ascii	"2\001\0238#&\016\345\256!Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_getConsumptionState.74.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3pM\322\001\240\f\030X\201s\303/\017i\234\201\231\2105x\233\242\212ZC\332\366pd\3242\345\244f\356\177\327\277\260\214\356\2711\f\334X\262\267\224)\005\306X4P\252\252\313\302\243\340De$\352e\030.\r\017\003\251g1\360\344 \301WM\023|Q\334\353'\265\342\321\007\373!\217\226\257a\315&\177\335\371\033\350.5\240\302\223\231\035;\251\027\366\333\352\307v:\265\200\303D\341dw\"K\331\0227\262a\233cG\276\307?8\266Z\314\300\004\"$ DPv\343\253\234"
+	.string	"\272k\037\200\356\024\343\326\323\362\017\362\326A\222]X\347\t\220\260\273\316\013\243\270\365\266\017l#\330\266\b\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_batteryStateStrings.75.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375 \357u\006"
+	.string	"\204\013\216"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\320\331\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\by\276\003\005\001'?\206\bwu\301\002\005\001'I\206\bsq\304'R\206\bom\306\001"
+	.string	"?\202\210\200(k3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005INIT"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\fNOT PRESENT"
+	.string	"\tCRITICAL"
+	.string	"\bWARNING"
+	.string	"\003OK"
+	.string	"\b"
+	.ascii	"H \r\002\006\204\203\214\001\341<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_getBatteryStateString.76.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"M\t"
+	.string	"\306QA;0\345(\035\r\276G\036\203\316\211\206\273)\252\261]\366(L\226F\204J\344\r\374\2147\370\355\341\005\021b\203m\rj3!2R\034X\340i\020\t<\320\002\032\266\221M\366N)/"
+	.string	"/"
+	.string	"0"
+	.string	"*\315\nG\306kf\267R\327\017l\237\233\013l\237\322\343\245\307\222\377\3265\031\213\f*e\361\250i\330]GTJu\313\333N\260\275`;&\266\243\245\214\216\032\201\313\305\341eWc\026`[f\f\304/y\035\335\345"
+	.string	"\fX\310\356r\237\366\310\346>o\223l\316\0379\t\311\245\202\372\021O\371hg}\332\013m!\371\326\025``\"\261\233\374\004\364Y\236\020\305\243>}\321\366\031\345\353\021Pd"
+	.string	"6Lqf\327S\224\035\366\265\225\253\366p(\276.\f;\017\024\374<\020\324\201\024\004\321\371P\317\007R\216\201=\211\356\243\241\347}\224\253\246k+WR\036\230\344\311\266+\256\022\261\331\275`\360_\001\f"
+	.ascii	"2\241\365/\260Z\302#\235\2333q\216\324}\256\341DL8\250B\027T"
+	.ascii	"8\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_batteryInit.77.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\324\003M\030"
+	.string	"\366g\222L\240\024R:VZ\2419\361\017\205_\f\24536\334*:\267FQ\357\317;nV\267~Gm\030\32098\246\\\355\267\037u\350\352\321Qv\370\315L\377\341\331i\374\230\016/MF5wGJ;\303\227K\243\036\375d\023\262w\222\001y"
+	.string	"{"
+	.string	"\177"
+	.ascii	"i\232z\265\375\351\256\265\353k\337\344N\305\244\026\204c\316"
+	.ascii	"\033R#\031i6\005\273\373\261\306\335Y/\006\3453\225\3301&s\316"
+	.ascii	"2\013t\374\363\232\245\255\270_y\\\241>\335O\nQ\267R\365@}<7"
+	.ascii	"3\004\360\351\\\023!\247\241"
+	.string	"\035[~\370R\205T\212\372>\334\226$Dv\252b>^i@')\242\304\327\253\365t\3119wE}\035\336\260w\367\256\273W\272\313\224\217\271\335\016~\214y\002\240S\225\254\352\007\257QkJ`\342w\231\333\035\3413dN\260r\316-\375\030\227!\241Ot\263gf3+*\030g\242\241\331\234F*\232\333w\361\0274566\367\346y4\365\245\033q79\0238%\354\327n\177\305Y\324,\334n\367\246iuL\226\307\335\276\322\211\270>Q_\310\325\2437\373\271{\263@\221\260'\211kW\323\356\"\257Z`\367mE8\210\203\370\004F\261\205\273X\370(\367\341\tX\031\021V4\253\264\213\256~\2258E\311Q\t\026\2249\344_V!9\016\221\272\372\325W4\210>\326\002\273\217\341\336\236\264\330\321\253D\220\256\003\017a9\367Z\372\310\347\300Jx\351\345\345\336\274=\215WH\304\001\265\373"
+	.ascii	"\002\224\020H\236\325uJ}\322\245``9\357\216\366\243\216C\301"
+	.ascii	"\002\030\230{\263\233A\203z\264\353\221\007\331\263\272\356="
+	.ascii	"c\311\331h993\023d7[\355\206C\273\311pjfnd3\333M\306\"\240k\025"
+	.ascii	"h6YN\255f\223\305\212\273\333\237\017\017\203\272\201\334Y^?"
+	.ascii	"\310\333\245<}\240<\f9\3111\275#\274\316u\224\256\0139\t=\231"
+	.ascii	"\311\276WM\215\362OH\277\253\263`?&qovE\263\206\"F\337\352\356"
+	.ascii	",\013\302\2060g\335{b\277^=\002\274\026\006\002R\355i\374B\""
+	.ascii	"\256d\341\240\217\377\300C\001\\\250a@\013\225\022\253 E)J:\240"
+	.ascii	"\002\021\3011\017\02109\244\214J\2450\254\001R\034a\301\266\264"
+	.ascii	"\260\213|#\017\265\177\323\020\3164\347(\371< \220\241\205\272"
+	.ascii	"\362\266\351)$\001B\304\254\022Z\370\244N\007\320\022\2110\310"
+	.ascii	"\275\030<\215\221\"\232\240\240F\310^\335\034\243[\033j\365\334"
+	.ascii	"\363\020\005q\037\020@\016\230\36138@\221L\316\350\347\007\032"
+	.ascii	"]\344FU)\nJ\342G\314\302CN\f\033\007!\004!\300\030Psd\030G\211"
+	.ascii	"\333q\001\005\006Q\013\336\201\301\025?Z\211\302\"\347\035H\224"
+	.ascii	"\226\237%\001A\250\266\2017v\303\343\241\344\026\235\202>\225"
+	.ascii	"{s\311\005\321\304\260\n"
+	.text
+	.section	.gnu.lto_batteryUpdateCurrentMeter.78.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\307\005m$"
+	.string	"\232@0\016BplMc\f\032L\222\002j\334P7p\013\250\022\005f\240\t\277\273\322\023\367R\303{\021\021Q\235\374\240\260*\266\314\260\250\013\213!\332\322\257e\346\206\205\357\363\235\220\377\247\255\324\204\354\275\367\2262\245\316"
+	.string	"\302"
+	.string	"\330"
+	.ascii	"_5p\214\201\021?\240^l\344\202\304+Ec\314\310\005\341\2453\240"
+	.ascii	"/\375-\347r\343D\323\222\210\331^\3327l\333\313j\263\375j\237"
+	.ascii	"\353]\351\275r\230v/V\033\260{\211\022\034\001}\231\373\221\371"
+	.ascii	"\222\274\221\371\322\251Mv\342\222{2O\204_\312\356\275:\253\344"
+	.ascii	"\351m5\032z\232%ik\352\003o\323\375\210R#\013\303\265E;\223\376"
+	.ascii	"Du4'%\212\252\236\344\203?g\006}N\324\024y\004\344\311\360`\204"
+	.ascii	"\325<\223\264\334\203\2232\200\312cE\021\331Q\223\322a\006P\200"
+	.ascii	"\0255\204$)\360\t\343\"\204\025\204\310-YAGY\025N*H\336\314\204"
+	.ascii	"u\256\345\225\207\024T\255g\322\275\327u(\025\344\276\3356\034"
+	.ascii	"\333=\273\224\021\302\263jq\266\310\236\313;H\251\312cE\370\245"
+	.ascii	"\005u4OC\302\251D\t\223\226D\214\220\235\202\262E\214<\252'\036"
+	.ascii	"L\005z\357\323\207~"
+	.string	"\231\233A\3417y\351\024*T\230+X\324\017}s#\310\030\264@\343\001\363\272\2626\313J\346m\213.z\202\325\314\276\230\217Q\362\233xiW?\334\231/o\261P\251c\3255\365T\2176\021\252\332,\373\366x<\036m\221\330f5\202{\271\007\374\3536:\253\213n\325D\367\372q\267\352\332\255\232fV\243\266\352\263Vm\326\252KZ5\211V\333\263\272\232\325O\360@\267\fP\214\343\275@\216\206\256\261D\003\345^\376\257\227\325\332\267O\364\277\034\214m\001GC\250\346\255\206I\352\244~XZ\013\305-\223f\263n5F\326\364A\231L\322\336\310\272\354iP\003<\215b\332\351\224\224J\375\220\264f\327U\320\002\257 l\212\220\263\206id\t\024\253\310\tD\207\301V\232\245~hd\017\346\207R\244b\204\022\373\255\030\305h\356\321\343\264\313\300\220\\%\262\266\206\r\270\"\325\337\374m\264\312\376"
+	.string	"\353!\337\341\361\347JI\347un\307d\030\264\254\252\3549\324\241\321\227S]\207\327G\230\326\275\202\343\307\3719\230/G\334>a\\W\356\275\016^\364\275\300[\241K.\205\2620\256\262{u\035\330\256t\3243\333\036\336\346\003zo\360\202\317\346a B\210\020a\276\264\366\374\262\263\345\205\263j\236T\271\262\352\252*\262D\366\024\024~\201\344\223\001\343\347\244k\34211\361\226\n\370\234~J\277\022\277\235\317\205\013\021;\031\277\037\257\367\342\207\363\235\3301\3010\361k\332\365zNK"
+	.ascii	"\274\204d\243\267\373\375\224Z\350|=\236\257i\347\3235\301Pb"
+	.ascii	"\322-\365|:\244\003\346\315\330\365t?\036\257\247\263\021\237"
+	.ascii	"N^\213\244Z(\177\316\235D\336\343\031.\016\021c\320\315\257\345"
+	.ascii	"\357\021G\210\261f\263\\Q\b\277\215\025\275\316\b\257Y\036a^"
+	.ascii	"\310\214\312\313H\241\016\2605K\263DER#\365C\347\204\026h\004"
+	.ascii	"\226V4&<\373\017\230\250E`]\205Sb.H)=\262C\355\204*~\266\246"
+	.ascii	"N;\300Z8\3023\244jZ;\315J\225\230\037\2366\027\264@\333\314\315"
+	.ascii	", x\357\323\202\322\232\266\264\263C\nT\ru\250\201\034\347\224"
+	.ascii	"R\306\314\320L\020IbH\007`\002\0212\243\362\020x'\243I2\214\001"
+	.ascii	"\315[<\344j\260\027\026B\274X\004+i\367\235\274`\361\346\310"
+	.ascii	"\"|Y@\243Kt\013\300\177\364\03452a\357 \336\243\007\030\301("
+	.ascii	"\264,\021\247\r\205|\342\202\211\321\0363\313\216\360\311\237"
+	.ascii	"\0215\r\222\003\277zp]\346\b\351#\341\211\b\017\245\362B\277"
+	.ascii	"\020\273\227\005\233\367^\027~\365\245\177\277Z-\363BH\326\226"
+	.ascii	"\367\247\306\n\346\211\341\245\315\350,\363\324\343\030-\362"
+	.ascii	"\3143\016\260\3222\320\267\216'q\235]D\345\302P\016:\260kC\213"
+	.ascii	"\274\310\021\n\030\332\032L\032/\317\336%\342\005\347F\244\325"
+	.ascii	"\255\024sX\320\260\311[\254\364\367Ei`\267B\003\313\327\004v"
+	.ascii	"/\264\023\033\374e\204\302Ql\031\225'@\327e%e\254\027e\034b\313"
+	.ascii	"\266\367EgW$\372\005\234\223\247\236Q$\250\032"
+	.text
+	.section	.gnu.lto_calculateBatteryPercentageRemaining.79.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`q\004\315\035"
+	.string	"\2068\302I\260TN:\371x\261\372\240L\377\006\350\rN\b]\210\252\371K\303\3324V,-\033\222\302\030\226*\300Jd\263[6\305M'\357\266\305\353\005\274\331\355\354uA\255\177lkV\241\305\361\026\207\0325\365\213\330\275\211\334)\005\252"
+	.string	"\233"
+	.string	"\264"
+	.ascii	"K\200JH\362D\032\026r\214\n\231z\326o\365i\237\253\006V\3449"
+	.ascii	"\276e\333,\342;\334\242\"\314\312\261|-\333>\274\016\245g\001"
+	.ascii	"G2\310\370\364\005\325`<\225\371M=\235\257\251\247\266\b\333"
+	.ascii	"v:"
+	.string	"m%\377\312\266[\005G\222\252\3065\325\242\214$\207\006N}`<u\002\005J\016~\030\343D\235b\341\264e\205$\207\270\215z\360\225\212;\203~\315\201h\343,\355I8\3425\305\251\2130\305\305\233\220\204M\3304W\353\323\204\260\024\001\220$\371\253\317\022B\2469k\016H\222\364|\022\242\270k\267\375\301\266\221-\n\003]\367\332\371R\247\356ptTO\205\366Z\027\020\365u\003k\222$9b\027\206\203\365\313A\013J\323<\263\357\343?\202\276\224=\360\346\237x\365\364[\213\362\272\262bi\246\331C\246\2710\354\213\344\276\260\211\206\236u\013\325\351\240[\335@u\372g\234\366\031\247{\3524O\235\336\251\323:u:\247N\343\324\246o\306i\233q\272f\234\246\251\3233uZ\246N\307\324\351[m\032f\234~\251M\333\352\264\013\235n\241\323c\235\256\321\351J\247)\235\026\353\364\322\351)N?"
+	.string	"PY_\231\r\022\203\331\333\336\t-\302\305t#\022\230=\231\f,\333\276,\215\342\204&\341G\200En\204B\005\013\026\352\251m\021\324\b\273\202Eu\226h@\0250-2.4\003\317Y\235\365,\251\230\311\035V]6g\317u\021\207\324p\006\031\217)-\353\262bW\231d\334\272-\373\362Hm\307}YV[\2370'\264\257\367\360\255\211$\227\210\350\326\355iRV\211;\227\356K*\246\231\346]qu\304\3122_8\030\206\221$\311\005\276\220\017\311\240a\303\206z\272{\260'XB;\3676\316\276\312\262\213\007V\241\365\271r\341\334\277t\n\234\220d\323\002?6*J2\372\345x8\244\036\217\327\323\361"
+	.ascii	"\177G\272\034\210\334\203\230]\207\334\017i\247\363\355&\314"
+	.ascii	"XW\004\364\355~\277\034\007\\\222\257\227\204\264K\302!\035\345"
+	.ascii	"x8\235/\tW\364\343\036\210\235\017\367\353\365|8\333p\351\342"
+	.ascii	"\367\205oF\203\016\265d1\203\022\2116\204\024\257y \007\332\022"
+	.ascii	"\266\201\366W\277\t(%cK\313$\326\230\035\n\013\332\030\"\377"
+	.ascii	"\331\240\375\226\317\376\254\330\325\2636\353\263\005\262\224"
+	.ascii	"8x\266gge\226g\031\230\225U\267\305\331\235\305e)\251n\026\007"
+	.ascii	"\302\227\214\335\354\214\"\003k\211@\255Y\233-\260UV\321\354"
+	.ascii	"\313\326,O\223\222jfid\366\2663\373\262*Q\250A #\221AJ)g\"\231"
+	.ascii	"\321\264\260\325\200\002\031#+\017\020XfE\311p\303cE*3\366\213"
+	.ascii	"\312s\226\322\306}\2363G\205\332X#b\001\270*,\254\343m\306\374"
+	.ascii	"1h\204\"\222/\032#\205x\351u>\027\361\356\377/r\f\r\235\362\017"
+	.ascii	"\300\271\305\331<~,D8<I!\233_\nsX\027\rP\233\r\317\212\320N\260"
+	.ascii	"\t\245\223\236\0348\250Lz\ti\201\315\032\264\025\345LF\003\006"
+	.ascii	"\242\331\322\223t\360\214\302\357z\200\320\211\257\373\324\206"
+	.ascii	"\2620\332\325\203z\256;\376H\tx4Z\":*\252;\237\330YRD\276\177"
+	.ascii	"j"
+	.text
+	.section	.gnu.lto_batteryUpdateAlarms.80.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"\035\t"
+	.string	"&Q?80\257\322\001\244\266\026\234\320\213\322K\260.Q\303\367'\340\301\355\022\003f,)\314\371\241\376\003\336B-\2667\314\227\206\0024\006)~N'F\234\t\332H\032\331[\246\024-"
+	.string	"."
+	.string	"1"
+	.string	"J\362\267\315\356\236u\f\030\226.+\036\245AL$E <\311\201T\006x\326U\"\374T\267\315\356Z\301\220\342\326n;\301\366\201m\222:\263]\237F\013\373r\243\312\276\372Z\301\204\311\250d75cY\2306\242a\373\031\223l\224\273V{\220\r\324\207\312\356\316xq\322e\f\001\257\026\330\027K_\311b!\321\021\227\307\216\307\311Ie\266\275w<"
+	.string	"\354\236\020|\216\267 |\214k\026\215\364\3405\177t\271\366\270\241^+-S\366hD\335'\024\342t\246\327q\036\350\343M\320\002\207az:oj\b\3145|\272\031\342\270nf\\\246\313\215*+\2040S\374$Fm\316A\017:\r"
+	.string	"3\241\305/\306\326Pq\330\233\250\266@\n\212\270\355\206"
+	.ascii	"]\303\t\230\340/\343\022\227\313\224B\355\001"
+	.text
+	.section	.gnu.lto_isBatteryVoltageConfigured.81.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"E\007"
+	.string	"\"\01635Pm\323\001\300\2104$"
+	.string	"\024^c\035Q\240\b\236\036\236\022\311\330\271\377`\311\240\331\210Y\017Vz\2707\307\314\fQN\367{\005\001i&t8h\023)S\n\306X0\213\272\256\213\002\214V\0253T\204\231\205\013\003\304X\021Z*\256\032(\013^UeAJ\247]Z\365\250\016h\272\331\217\323Uu\nmB6;\274#\006\354N \370\034\007=\370\031\177\206\300\362\334\237\217M\177\327\212\tH\313\221\335m\251\026\366\245U\217\355\264f\372\222@\005I\204\310.g$\332\221\007\362\261\255\261)68\3208{\207\301\371\307c\023:\331\355\240^<{f\3767\376>D%\\G\342\t\220\260\273N\256Cq\353m\023\330.\260\255\021\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_getBatteryVoltage.82.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\025\007"
+	.string	"\262\21514`O\322\001\034@\200\013\2140f\341\013\313\006\227\240\365Sq?\254`\264\206\220m\207\210\354\"2\226\334\364\303pX`8\02708\207\013:\016\262\211\224)\005\316\\6\220\272.L\303\263`ei(\353i\0340\017/\003\255w1p\005A\301wU\025|S\334G\253 +\202G'lG\234$\013\330\335\005\177\344Q\302\347\270\363\206\223\327\356|\216\n\210x2d\307N*\206\375h\025d;\235z\340\221\202\231\354V\204X\026\305\235t\330\306\354\311\3778\b\346,\343\206\205\264m\024%+\273\361\r\274@\272\313\023Hw\252\361\354\231\371\017y\244\322\262i\237\316\023\200aw\235\332\347\342\326\333N\260\255`;#\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getLegacyBatteryVoltage.83.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\265\b"
+	.string	"6\321<5@\217\322\001\227\353\345\225#A\352K\341&\326\220\b\321\005\375\210\230Y\215\334\377\021\353\214&\020\203\327IM\370\031F\227\322 \2008\250\202-\235V\2737\2212\245,"
+	.string	","
+	.string	","
+	.string	"\220\304d4\262\262\333E\201\023\300\277\374"
+	.string	"\374\323\214sO\316?\310\337I\245B*}\236\027\206\335u\222J\026\267\336v\202m\005\333\251\335'\025\303\276\265j\262\235\206\232\2664\255\232\316L\377rpB\361\244v)V,{\362J8l{l\214\357\361\017\217\271\3544*\002\357F\301T\325\207\022]\204r\345k\352G-\216\270\b\007\260\273\013~\310;\315\337\370\263D'O\372\363;\360\357Z\220r\002\345\312\016\336d&\262k\3334\rQ\3130\215si\221\343\240y\210\233L\213\031\003c\020W\0267\f\313\"\246\333[\253&\250\b \r\331R\030\240j\351S\211:\002\f"
+	.ascii	"2\241\347\037\230g\002BE\027\004\207f\214Cu\265k\342\372\b\235"
+	.ascii	"\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_getBatteryVoltageLatest.84.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\262\31514Po\322\001#\333\302C\220-\202ae\007\006G\200\225WS\372\343P\334\232\250\265\316\021Y\306E\005\2653UU\305X\355\177\356\211\206\252\341\003\221M\244L)\346h<\260\272\256M\203\263\340\263:\225\345:\016\233\007\307\201\226\323\030\370AT\320]\357A\227\211\373i\225dE\020)\205\355\210\223`\001\273\273\340\217<J\370\035o\366|\362\331\233\377Q\001\021Q\226\354\030J\315\260?\255\222l\247S\017RX&Pv-J0\273\322N<l\203\354\214\377q\020\220\261\214\034\027\224IKE\311\313nt\003/\240\336\362\004\324\233n\034{b\376C>\271\304\250d\243\320\023\200aw\235\331\b\343\326\333N\260\255`[#\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getBatteryCellCount.85.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375 \350u\006"
+	.string	"\"\f-3Pm\222\016$\307#*\241\352\272u\001\006"
+	.string	"\240[k.\370\267dW\355_\263\377pZ\204v \366\346\230\231!r\2728\271/@\f\236:\254}\262e\nc,\232'U\325E\301Qo\2422\022\3452\013\027\006\207y\224\263\b<5H\317U\323\364\\\005\313\266\0206\002O{\370n\224\303\272\027k6\330\253\321\335P\032a\013\230\360`\366X\007\033\305w\222-\364\343\330\006FB\034\262\314OV\222 \321\007\306\317\371\312\007\b\234\255b\026\037\n\206\bD\007I&\346ZE\255\242u\253\321IF\346q\201:E\200\204\314\034/\220Do\375\013~\203?\"\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getBatteryAverageCellVoltage.86.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"5\t"
+	.string	"\326Q?80\345(\035\016\362\0160\261\263ph\3608A\272Ha\223\222\325\210\3429t\036k\r;\003\255A\f\266\371P\233\303\300\300I\002\322\346\345E\273D\355F\237\220M\244L)0"
+	.string	","
+	.string	"/"
+	.string	"\236F\305\205\002\300t\362\262\353E\201\023\\\207\371\201\353P3\336=;\377!\207\035\237\313\t5zb\r\273\353<\241,n\275\355\004\333\n\366\003\002\2667J\305\260o\255\246l\2471MCM[VZ5\235\231>\346`\265\322\261\354R|\253U\201)\034\266Ev\306\3778\210\310]\006\371Y\325z\311M:\276\312\017\036\217.\264\\\\So\n`\355$\035fw\031\374\221{\021\276\352\320\\(\177:\364C\327\341\265`C\204\224_\346h$\266\f\004\3328Dn\323\270O\306\305Og\343\211\234\215\213\032\003k\020\331\026A\232\266\305\214\267\267VS\230\"\220\264d\250\230\245\251P?\341Q\n\016"
+	.ascii	"2\241\033(\260\365\005d'YN\025\337\232\354f,oe\346P\265\342\302"
+	.ascii	"\370\200\231\316\202\345\341Z1\t\223\f"
+	.text
+	.section	.gnu.lto_isAmperageConfigured.87.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"M\007"
+	.string	"\202\31634Pm\323\001$\243\264h\212j\225]\267\2600\323\026\336\200\311\222\241k\206K\006\261\221\263\036\254\364poNvf\2124\276\326+\210\321\022\005\214\207\b\2212\245\306X0\213\272\256\013\003\214V\0253T\204\231\206\213\003\304X\021Z*\256\036(\013^UeA\312\247=Z\355\250\022h\272\331\217\323Uu\002mB6C\334#\006\354R$\370\035\377D\370\032\227,\201\345\273K>6]\272VH>Z\206\354oK\275\260\037\355\356Z;\266\323\232\351G\002\026%\336\271\217]N\350dG$\020\217m\215M\361\001\202\306\331\277\f\316\300\006\267\001\231\354~P1\236=3\377\034_\3308\221\316\233x\002(\354\256\263\363*n\275\355\002\333\006\266=\001\b"
+	.ascii	"2\241g\037\230\302\004;T\241\3245z\t\221\303\2353\265\363\t"
+	.text
+	.section	.gnu.lto_getAmperage.88.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\035\007"
+	.string	"\002N24Pm\323\001\244\004\252X\205\352\312\353f\024~\364\232\215yE\215K\0307\362\332\374\323\247-\271BA\3313\203$\212d\277\275\002\324J\212\312\252\2777\2212\245\306X4\261\302\260\013\003\274\242ue\252\013f\032.\016\020\023/h!\260\365PE\210YV\204T\267\227VA\326\212\246\036\333\020\377\310"
+	.string	"v\027\301\367x\027\341c\374Y\263\311o\177\376f\372K\r\350\320rdw\235\324\013\373\322*\310v:U\022}N\"\262\373\031\235\354\310\013\311\260\315\261)_\343\033\034g\n\022\032W \252\230"
+	.string	"1\331]X\371\300\364']`\372\323\320\263g\346\237\343\013\036\212\222\215\353<)\t\273\353\3348\213[o\333\300\366\201\355P\b"
+	.string	"\003\013\275\262\030\005\205"
+	.ascii	"]\303q#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getAmperageLatest.89.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"5\007"
+	.string	"\022\01635Pm\323\001$\243\252\022\261\270\362\272\031\205I\274\214\306\322\212\252\3258k\344\265\371\247O[r\205\202\262g\006I\024\311~{\005\250\225\024\027T\260\336D\312\224\002\316\\6\261\3020\214\003\274\242ui\252\013j\0360\0200\023/x1\260\025QE\210YV\204T\267\227VCV\213\246\037\333\022'\311\002vW\301\037y7\341s\374y\303\311o\177>g\372K\025\020\321rdw\236T\r\373\322j\310v:u@d\301\035t\262{1Z\331\224g\322a\273cS\376\307A:\316\030(4\356\300#\243\242Dew\241\345\005\323\237t\202\351OE\317\236\231\377\2207|@(\033\347y\002,\354\256s\3430n\275m\004\333\t\2667\002\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getMAhDrawn.90.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"\035\007"
+	.string	"\362M24`m\322\001@\203\300!e\200.\3605C\321\260\013\310\245\244K\r\004M\032\352\275CMvc\252G\350]B\301I\n\313\334\253r\255`\267\277\246\335\244L)\336d:q\252*\215\303\243\"\2448\023\3658\017\032\210\267\211\324\313\030\030FL\361U\020\306w\321\366*\262b.\r\331\226x\211\025\260\273\n>\311\265\t\177t\347\216'\217\335\371\036\351.U`\344\312\315\326@\251\032\366-\253\"\333\351\324\201\216Qv\213m\367b[\331\024\207\342a\373c_|\220\207|l1P\\\331\301GF\205\211\312\356>\314\013\244;\313\t\244;\335\270\365\264\374\213\274!\204\235`\031\350\t\260\260\273N,\303\270\365\266\021l'\330\346\b\b"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.part.0.129.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`@\001\315\r"
+	.string	"\346XZC"
+	.string	"\223\232\016\333H\331\002B\237\002$;g;1@\257\310\351\337\234\003\004F\323.\b\001\375q\217e\204#\003`\"q\032eLD\221"
+	.string	"\262\003\264@\212\245\331\300\206'\222\212j\327FN\020\242M\344N)B"
+	.string	"J"
+	.string	"I"
+	.string	"VP=\"x\001\352q:\001\352\321z<\013\333\335\007{\266\217O\322\276\246\324b\363\355\256|\324\024\367\256p\362\374\323|d\344\242\341\n\300%\304\341\200O\"'\273\353J\304\035o\273\201m\n\366I\001',\0358L7&\276\026\337n\230$\2669\214\220U\fL\022\b\221\034\022;\202|\273S>zV\237\271C\257\261\342X\367]t>\215\255\231\356s\005BX\321\b\222GCh_\346/\274\317\025\217\354\242\270\301\261;K\036\003\027\206\202B=RBF?\256P\3372\304\366\234\306\205jw\035\3702>\343\343\253xt\226\002?z\364St\001\217\03412\"X\202\nc\235>\255\276\330\0244\214\320\217\tb\004\224\330\365P\312\331\023\021gE\214\316*\001\266\260M\300>\036\t\034\b\323\264\fW"
+	.string	"_&!\r\343\270N\005\271i\331\006\3026\t\362t>\362\3226ir\300\031\006L\223\\\226i\322\372\264\372\342\b@t\210\224\305\252\nc\033\252\355\222\337\3500\350\261\273\017\374\032\267\021  P\202Q\224\261\003\370fh*\006\254\004\206\303\031\3021\030M7\243o;r\366\024\265\247D1\314\021\356\226\002\277!\260.\200\330\260\2330/CG\030\004\317#\2151-\335[\272\024\247\006h\245,\031"
+	.ascii	"\264\027\221S\234~-\036\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\305\005\325\024"
+	.string	"F!|I\260XQ:<0\217\250muzN\303\306\341\037\323\271\240`\f\274\274p\017\020X\360\303!\217\361\304\333\270\316\207)\017\037\304\241V\220\316\b\2443&\255\177U\277\375o\377\333\210\305\001R\312\004\301\031n\327\220o\273\311\275Sc"
+	.string	"h"
+	.string	"j"
+	.string	"9\375%\275~\022^\037\311\256\177\244\352\372Fjnfq\273[\037\311v+Ux\177\324\032Xi\277rs\205Br\326\264\250\362\225\345x8\034\222i\320\301\312\240\266\340P\366E84\313\267\006\247\240?\244&\260Y\276\bt\366?%\213\016\360\354\025\n\257\217\277\377\244\031tu\357\275\006\372f\375\317\022\022\027C\357\275\177\314C?\212v\350\331\377\205\020\321P\213 \016>\373\367\020\365\374\020\001\r\001\t\361\004\271\220\235\22206\374\254\206\376\224\f})\030\372N\027\372Q,\364\233*\364\231(\364\241L\350?\221\320w\022\241\277\004\241\257Tw\372E\352\203>\221\352\240\337$x0\026x\252\341\257\237T\003\334\254N\237\211\357JluiL\024\016\032\214iY\203\355\210a\004e\20315)I\351\021\323Q\323l\206\307S"
+	.ascii	"I\317\024\225\303\213l\3055%\3051z\242![\361\253U\322\007\271"
+	.ascii	"\367\312V\354\323\327\322\323\337\302\242\317\205\247\337eE\337"
+	.ascii	"\213\212\376\227\024\3750(\372U'\372R&\372XJ\364O\022\375,#\372"
+	.ascii	"S\"\372TB\364\237@\364\253|\350\367\241TG\231*\245\231\033\366"
+	.ascii	"y\214wlb\\`\025c*5\300\206\001\224\271\221iN\336\3104fo\344W"
+	.ascii	"\2313\262\353\364\215\354\")\001'\0365tFn\231\277\221[$pd\326"
+	.ascii	"I?%\243\252Gp\344\237\033\271\221_\347M\344W\211\023\331U\346"
+	.ascii	"Dn\231\364TJ@l\350Df\231;\221Y%M\344\026\322\013\306\364\244"
+	.ascii	"\001]\250A\b\203\321\325%\005\005\005\251t\360\002\241\"m\016"
+	.ascii	"\021\200\020\212\b!BDB\tH\005y\2400\341H@a\177\2204G\003Y\356"
+	.ascii	"\234\351YG\361\211\244\303g\242\b\270$\352\314+}@\375\305\207"
+	.ascii	"\003\177\263\347\3565\367\214s\315\037\303]\335\217\247K.<\240"
+	.ascii	"\\ Q\230\222\344|\247\262\305\375\347\271\347\271\317\303\365"
+	.ascii	"\207\340\307\353\366\373]\257\202v\005\026\032\\+z\327$\366\347"
+	.ascii	"\330\233\202nr\t\217\354B<Y\030\375$0?tf\026\013\3025\001\253"
+	.ascii	"\315\325a\305\360C!\354\345\235e\026a\203\240\217\263\265\n"
+	.text
+	.section	.gnu.lto_.refs.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`0\001\315\n"
+	.string	"6\334F-`i\223\3060\f\3030\f\3030\f\303 n\263\251\256b\006\021\261\255\370x}\233AlM\335\335m\232\033\337\310\023K\366\336d\313\224\0024"
+	.string	":"
+	.string	":"
+	.string	";q{Yj\271}X+L\027\326I\243\022\245\020\266\216\333\266>L\233u-e\224~2\017#i!i\237\244N\322E\332&-K\253\222\246\323WG\217\"\226f#V\210\265\016k\003\244\025h%k\004\332\307\352h\333\270UP\312V5"
+	.string	"\212\317\263\216\322FA\231:\225:\3062=\2732\341\334q\261\013\330&\270E\320\350\001\245\025,\3219\344d!\024\235\255m\302\272P\267\232e\326\246\333\203vg\t\303\213\b9o>v\334\330\323\005X#4\013a\355\003h\035\264mp\313`U\260\032PJ\241T\"\355%mN\\\305}\024I\342\262GZ\nl\202\2148\210\007\207]I\240\341\3122gUS\346\034\220d\264}\332:m\025$\2009Y\033JW\244i\031\226\f\321I\211\316\310\202>\3211\3122\024M\001\027"
+	.ascii	" D\312\231\245\272\354,\236x1 \002\234Ii\354\323\035eX\337#\226"
+	.ascii	"\204\006\377*\220\244\0218\355\331X\330\252\264%0Z1j\"\372\030"
+	.ascii	"\215\025}\210\006V\3152\t\214\024"
+	.text
+	.section	.gnu.lto_.decls.4a7ff220367600ff,"e",@progbits
+	.string	"(\265/\375`\373:}\362"
+	.string	"\272h\375OW LQ9\351\224tK\264\340\362\013]\271\361\004\234\362\f\no\350\\\374 \327T\223\300\272\231?\320o\260\364\2428\225m\327\350\233\nL\255\302j\267*\310\314\025?\263\3139~\277\n\013\214AS(!\217\253\022\002ry\344\366\267t:\002\353\241(\232\326\366\226;\005'\004\373\0040\005\3511Sj\357f\2044\341b\213\321$L\213\022d\331\270\233z\231V\341\361`\316\375>^l\223\034a\316ZuN\237\250\224\250\217\026\333\005/N\211mb\241:\032`&\0305\302f\327f\270\226\252h\311\032\003<#\222o\025\246\254\261\262~a\313X16\260\225\354\240\rc\307X2\235\324\271a\264\262\227,`3YA\233\326K\373\345\366\317\2029~\346\234\224s\366\341\263k\026\332\374 \310]\264\2276\317\356\345$=3\324\272\347\344I`\033\222\301\2541@\350\224"
+	.string	"t\311\032+\213Rg\3572\340\323\300/J\326\030\240[\022\273\226ss\306*\343|\203\263k9\312g~\362\200\f\225\337\347\275\264}\266I\316\362\231\231\037\330e\215\335\232e\260A/-\024\273\026\002)g\254\032\001\200\301\345n\0200\347\347\210\017#j\260\220\336\306\034"
+	.ascii	"\267\226\3550,\300\215K\177\315\322\337\035\351oT\372\006L\337"
+	.ascii	"{[,\027\034\350\214,H\350\266\240\331,\326\351\313\215\261\306"
+	.ascii	"o\030R{"
+	.string	"\305\352\3314\213\345\267V,\225c4\255\254\226\363\023\347.\251\244\304\361\fu,\317\360m\225\342v!\265`Lj\342\256\255\024\213w{g\355n\222\354\035\316yi\355\0059\326^ \244\203a\2316\304\267`\322\333)i\007j\351\255Xz\266%\226\211M\023a\351n\345\354\334\205\313g~\266\027\231\266\264\306\267_\351\255\210\341\035\034\264\"\206\267\315t\307v\030\266\234]\246\207\022\245\307\362\223>j;\f\237\"\335\001\264\035\206\366i\213\330\264\n\254\3323\330\340W\211\226\315r~\352\340\224\001RF\260\361\033\220\002\200J\336\340\024\244\267\025\f\355\240\255`\370N-\260\033\206\374V\2105\253\340.\305\320\312l9?3\350<\251\234\272\032\377i;\fS\273a\330V\367\266I\375\326\001G\236~[\302Z\023\332\213\347\315\177\225g#0s\021\344\250l\370_\017X\261\364\277\035\370q\325\224\004\021\375u"
+	.ascii	"\374\327\002'd\264S\214\277Eh\372\273\004\027\376>\201I\305\022"
+	.ascii	"\006\376\243\320&\374\r\343'\376[\302\337\002x\226\026\241\324"
+	.ascii	"#:\001\034\356\363_\024\277\255\321/4P\300o\261\376N\372\033"
+	.ascii	"\351\357\374w\t\376\016\301\337-\376\376\300\337\353\337\311"
+	.ascii	"\3776\377\005\241\351C\205\301\324\361\177\021\320F\377\205\377"
+	.ascii	"%\300P\037\257\363_\"\223W\023\331\020`\032\340\240B/\351\032"
+	.ascii	"cw@Ds\340U~\333aC\253i\00755P\257\260\027\020]\005\021\277%\376"
+	.ascii	"\375s\236\377\346h\2403\360\333\232\327\374\375\367\333\334\030"
+	.ascii	"@\262\340jW\376\356p\201\277)h\013T\340\267F\024\370\207\377"
+	.ascii	"\007\370\037\342\005\370\273\177\213\377\223\371\037\370_\370"
+	.ascii	"\277\314\1770\377\005\377\337\377\203\277\035\376v\346\177\230"
+	.ascii	"\337\246\377\241\374\327\362_\357\023\374\227\314\337\366\357"
+	.ascii	"\377\266\314o\305\374v\314o\007\377\276,\374V\357\267\201\277"
+	.ascii	"\005\354\025\376\357\374\230\346o\025\376\226\300\337(\374\235"
+	.ascii	"\342o\024\177\203\360\367\006\177\227\370;\001\177\217\370\233"
+	.ascii	"\347\357\013\376\026\300\337\025\374\r\200\277'\370[\347o\233"
+	.ascii	"\277\207\177\343\337F\371m\333o\217\374v\355\267h\277}\376\366"
+	.ascii	"\354\267f\277\r\362\333\262\337\212\375\366\307o\235\277\005"
+	.ascii	"\373\355\327ow\3746\307o\271~k\343\267Y\277\275\372m\363\267"
+	.ascii	"T\277\235\372-\324o\233~\313\364[\030\277}\361\333\022\374\026"
+	.ascii	"\351\267\312\337\212\340\267 \370m\213\337\266\360\333\344o="
+	.ascii	"\360\333\343o\211~\333\201\337\026\177\013\302o'\360[\240\337"
+	.ascii	"\256\370-\361\267#~K\342\267\033\370O\367[\024\376K\371\355\317"
+	.ascii	"o5\360[\f\374\326\002\277\245\300oW\370m\n\277\215\300o!\360"
+	.ascii	"[\235\337\246\370\257\342\267\036\374v\001\277=\361[\f~\233\200"
+	.ascii	"\337\026\340\267\004\370-\210\337~\370\255\207\337\336\374\326"
+	.ascii	"\346\2674\377\315\376\003\375\257\373/\200\301\301\301\301\277"
+	.ascii	"\006\3775w\277\b\232@\354\255a\323n\215\233\245\201\t\201&\253"
+	.ascii	"hf\322 \321\2032\352\234\027\353\206\017\f\212\367l.\275\331"
+	.ascii	"<YY\335+\r9\037q\243q\323\025c\211\362*\354\322\305\200\003\f"
+	.ascii	"l6\235\206c`\350\312\362\250\250\356T\212\235\214\244e\311y\321"
+	.ascii	"\240Ty\321II\335)\rY+g\347\f\022&\301h\230Z\337\222\251\276\323"
+	.ascii	"Y\"(\245f\355:]\247\013\345\207A\r(\r\036lWc\n\220\306\027\352"
+	.ascii	"2A\224e\311\227y\237l\244\230\202\020\301{\352\034\201\206\261"
+	.ascii	"j,\243\245n\372\234d\301\360\321\324d\327L\314\030\341j\212\016"
+	.ascii	" ,\252F\213\3512\311\325<\245\027\306\205\321}i\306\223\303\301"
+	.ascii	"\272K\252\n\264i\367\205]\373M\312Xf\316\234\237\220\300d\370"
+	.ascii	"\256\354\340C\272H\375\325h9\252\006\306\034X\024\300\234\233"
+	.ascii	"$p|\004YC\212+ss\231\253\034\346l\237ZO\314\253\034\034\354,"
+	.ascii	"\2512\347\017D\242M\036\232\245\262\0374A\322\323`\215\031\343"
+	.ascii	"\244\201\022#\306\2113\005\004\004\224\233y\361&\350c\312\237"
+	.ascii	"\227\006\323Spf\313\313\250\023\201r\351[\372\224\314\3576\255"
+	.ascii	"\375l\023\236\274T\362\370xBB\350\225c\214\312F4\332}'\002\265"
+	.ascii	"\376\367\356\023R\t\003Ka\\\245\365UC\207L\032\031UdD\337\\l"
+	.ascii	"Zs\351\273\024y\031\365A\f\317'\211\317\210\321r\233\326Z\332"
+	.ascii	"\316B\345\274\254:A\026m\222\260icN\222\362\322w^_y\353\245\265"
+	.ascii	"^g\261\315\254\354\333@\312\331dbygy\227\233\034\"\307\214.\032"
+	.ascii	"\330\370\177\315\374O\363C\307\003\220\211\035\346%3\347\034"
+	.ascii	"%|f&\322\315\320\n\255\345\371q\354\265\003\310\367\204gV\216"
+	.ascii	"\371\372\222\306\020\267\274\262 \377\320\234\223\266\224\r\330"
+	.ascii	"\202J\332\232\261\244\266\225\225I`\312\f\314\274\245\\R\313"
+	.ascii	"9CNJR\216\240\2253,\251e\250\374\202\n\224\315\317-eN\322\312"
+	.ascii	"\031rR^Z\260\224\264\005\265\244\266\204\312\260\244\266\005"
+	.ascii	"\225\325\266\362NNZ2\231\22223CV\333\352\313jZP;KjZPKj[XV\313"
+	.ascii	"\222  T\230/..\266o))\313p\242\261d\356@\227\236Z\031K\316\226"
+	.ascii	"M)3\007\2203\r-&\226\345\f+\207\004\225\201\224d\251e\2379g\020"
+	.ascii	"NH\\Z9\t\272\024\246\225s\030\322Pv:\241|B\363\016\013Uv\321"
+	.ascii	"\3101\224r\246\300)g\245\315\320\234\2632\347<\303\244\361\314"
+	.ascii	"\331jg\311\351\344\224s\363\203S\246\241\234S\312\271\331\366"
+	.ascii	"\344\240\226\324\270\264|\346\214\25093\214\247\322:3\226-f\252"
+	.ascii	"\246,\222c\370\245N()/\215\2379\303\261/\030s\215S2\0379\004"
+	.ascii	"\033?\221X\331\345h\f\205\346\212_\r6\274\0175>xl\251\321hj)"
+	.ascii	"6uJ\302\006\033\177\306)\355:;\307\267D\006\312\223C\223L\306"
+	.ascii	"\027'\267i\355\244\225|\330\311\231\253\351\034\3521i:\2767&"
+	.ascii	"cL\230,QR\343\346\344\311\326x.uZ5\263\326\336n\323\372\255\343"
+	.ascii	"x"
+	.ascii	"r\216\372 \006\246\037\026`f2I\300}\020*{4\2154\376\260\231~"
+	.ascii	"\330\324n=\243\351GT\231\024I\333\032\315\023\312|j|\r\320\340"
+	.ascii	"\314\314\372\231C\223\363\326\023\347Z\027\351\347\314\216(\037"
+	.ascii	"\0230\347|\244\2154\233M\353\265N{\253\3317\214\025\355\301\224"
+	.ascii	"\342\033\341\\z![z!\220\264\207\364\231M;]\023\331\341D\271\303"
+	.ascii	"G\332b\346t\303\013u\b\301\022\004\b\232\223\312W\3437\220\277"
+	.ascii	"\311\272\254\303n\264rN\022~ar\002l\334<v\303\320Z\361y\217\341"
+	.ascii	".0O?\304:\314bq\326\260\013\213AG\310\024\216\257\247\031\315"
+	.ascii	"\234\240\330\013\215\333\331>\336?\272G\356\037'\264r^\366\017"
+	.ascii	"\23519/u\254\275\300\332\013p\020\256\036H\206\370B\256\364o"
+	.ascii	"0\273\005\206\257\026\232\315\263\306\357\257\366\262Z\331C\216"
+	.ascii	"\324Z\231U\343\326\321;l\032\210\346a\275\350@\202j|\341UJ\202"
+	.ascii	"\234-\210\241\035\034\264 \206\215\303\347\235c\303\220\331|"
+	.ascii	"\352|\340\325\025\244\361\265\033n\200\230!\233\313\302\321\305"
+	.ascii	"\325R\376\300\360i\265\215\336\262i\315\325X\357,\013}kP\303"
+	.ascii	"\3169\307\3254"
+	.string	"f\334\344\364\304p\365\225\275\033zA\365\304P1\022\210#\305C\334%=\276K\217\227\244\307h\251\2104i\211\233Y\325yp\002\257 \225u\263g\334\f\311A\326\325M\325S\375\202M\353\031-\225g\264\214f\336\"\314\364HZ\225\006Q\366\356>\2353F\270\236\242\033\374>3\032\252\371a\304\210\021C\036k]\202)>\356\221\036\347H\217i\360\364\323i\222\236Y\355fI\0057\245\361\261TZ\330\244\364]\372\246\226\305\005\273\253\254\303T7z\201b\212D\3518\333c\020\257\t\024|\225\363B\222\253\034O\372p[\225\016.'mg\245J\022+Mn\224\241[\236\027\222\306J\224`&b\2347\2060qM\226\0343\261Hr\363\213\303\022\271_\016\353\260hN>&\240\016\336\223\013M\"H\220`\270\017ZJ/<N\242\252L\3214\271\213\261\003\016\277]9\223\bi\214\223\334\f\352U\341"
+	.ascii	"\205\335\002\327\3260\033\007\262\2503@\300\033\"b\250\f9r\314"
+	.ascii	"f\357\376\326\240g\330\310\335\323\0301nE\212\340\264\020D\250"
+	.ascii	"\b\221\003\304\271\001\306F\206v\234\026\207B\351li\327\316\005"
+	.ascii	"f\313\206-\262\343!d\230\210\375\263\317\334\324Rz1@V\0242&\200"
+	.ascii	"y\211\006\217\020\216,\273\263c\"v\303\3015\271\255818 H\032"
+	.ascii	"c!\307fzyuh{)\006r\034\344JJKX^\331Os\243\303\356\316\013^z\r"
+	.ascii	"O\234N,\006\345c\226Eq\222\312\022v,v\031P\362rc\034C?S%{d`\215"
+	.ascii	"\361\017\354\303\216\257Kc\354\303\336\245jR0\250=\207Y\302l"
+	.ascii	"\300\030\002\006\206uD\371\230e88\336\364\234\334\370\372\352"
+	.ascii	"\276$]O\336\2424\276\006'\036<\272\017\252'\246,\215f\275\254"
+	.ascii	"@.."
+	.string	"\254\203\357\310\240\222*\307\261\216\316\203\346\375a\034\\O$(\306\201o\364\320\243\"d\216f\360o\214\256\253\323\240\f\311\242\242g\303F\240\263\212\216\263\245%YY\335\007\202\034\037\263\foQ\0221\"\244F\215\356\213s\016\317rD\235]\3157\361\225\335y\"Uy\342\274bUR`X\035_\245<\252P\271\321\030Wu\023\373\204\210\216$\031\230PP\230j\001Zzb\312l\274\232\220^8\246\302A\302e\354\017O\335\005\037s]x\nK!\301\202\252\002\227q\030\223\255$8\252\261\206m~\202le\234\234\360\323\007 \313\0344\332\312\357\216\007\226q\374TSF\251\317\255\223\230\330\363\002\303K\277\204\227p\323\260m\211\243\311\203s\210\031\262\207\233\260\013\201UZd0S\320\215#L\204\244\337\tK\177\254\204\225\332.\205\0269\241\031\025\335\223\r\273\337<;\234\344\203\224\227@L\220Eq"
+	.string	"\265\210E\033c\244\231\245\336\025(\215\2773\225\336\232]\271X\266d\321\302\345\362Y\250\216\006\214\341E}\366\256\236\331^t\314\355\273\201\026\332\334\311Ip\200\321\271;\346n\301R\006/\261\362\016^\301K\006g\233v\307\334\350?P\271c\256\226,:_\204\034\231\261\203\257\234K\b\244\245\024g]"
+	.string	"\257\030\233v\003\377\341\351\023x\275\3340\026\332|\346(\2337/[\314\021 F\340x\261\202\345j\030\346\202\311I\362\314\341\327\370\376\3154g\324\275\370\342g\323\356\227\364\257lN\360\\l\234\360\340\352K\257\243%\275\316]z\273\244y\321\032wO\322\3530I\257\363\226^\207-\275\3163\275\216\020,zB\265(_\356\256\236]\253\"%\006\022Yz\251\\+:A\344p\270UA\201\007\236[c<\245\353z8\235\2409X\300\332\2124\376\305\023\272\r~\251j|\357R%\235\035\"jj\300e]5\376\275\373o\022\353\006\202A2a\032\267\232\317\257\024\233\273&Q\"Qn\277P\256\333\215\222\242\231\243>"
+	.ascii	"\2223\305v\005\332\370i3\007u\351\256\223\373\344\247\241Y\022"
+	.ascii	"\243\n\r\027\322\337&5:\250\300 \326\270\355\351\206w\311/\223"
+	.ascii	"\237f\306\214\231\324\326\370:/\322\337\271\253\344\247\271d"
+	.ascii	"\354\2260\221I\177\345J\240\305\006\220\3067.U\312\351\"\202"
+	.ascii	"f\017\215\313\215\373/\234m\353\037\033\350\030WM\276\3069v\303"
+	.ascii	"\360&\361\371}\353\036luu\215qr\344\332\332\260\230\266,\231"
+	.ascii	"\242v\344\310]\373\300G\225s\007\023$]~\250\251\335\265\326\312"
+	.ascii	"9+\345\026V|8E\205O\262\272#k\375\034\2768\323\001\004\007\032"
+	.ascii	"\332\025\373\033Be?,@\032 dRH\215\237\003\365|\nFi\274\304\020"
+	.ascii	"\206\310\227\263\263\373\325\243K4m2#O\b\324\314,\3130\314\352"
+	.ascii	"\t\026[\220 \267\214\317./\017\013\324IFv\3134\344l$..J\242\314"
+	.ascii	"\217\256\254I\215W\021%\033XiX\330\025K\321!\260q4\201\242\022"
+	.ascii	"\273\243\361\021\003W\214\306\307AJ\177\374\350\2760Z~Xe5@lL"
+	.ascii	"\211\341\273\316\353d@\333]T\205\331`\225\272\013v\3016\230\021"
+	.ascii	"\275\031r\275\256\327\375\2421\200\237\226\037\026 \315\327\025"
+	.ascii	"Y\376\262k6Y\240\312\2064\376M\325\216\035v\315\242\345\247\032"
+	.ascii	"&%\021/\200:`\306jxqI\177\273\354\305q\273n\216\236\222*\231"
+	.ascii	"\251\033\fgQ\033\273\3646m\351mO\031rqu\026K\007\365\303*\373"
+	.ascii	"s\202\212\353a\303F\3671\300mGTG\251\264\224\343Jo\0038\307\""
+	.ascii	"\021IS\\\217z\216EDDE@\031h`D\004$T\215+\210\253\n\235\225(\002"
+	.ascii	"Q\021\222\204dqg\202\"\344\n\244\376\254;\311#\343\272\026!\207"
+	.ascii	"T\360\360\241\022=\016H>@E\036\255D\225\305\316\207J\364\254"
+	.ascii	"CBE#\213#\243\343\003V\265\004\244\332\242H\204\363\241\022I"
+	.ascii	"\243\221\b4\264\022\211z\222kqE\317\321Q\b\203\026G\307\242\021"
+	.ascii	"\203\023\034\374p\320A\213\0365\350\310\bt,\366 \223G==\037("
+	.ascii	"B\016\255E\307\031\026D\325\210W!\213\365XD\032\207\024\224\340"
+	.ascii	"!\003\212\021B\330`$\036\255\310\"\013\036\206\222*\222\305\004"
+	.ascii	"AD5\005\024#\204\260!\303\207J\364\024\025=\f?T\242'\211T[(\""
+	.ascii	"\203(X\177\222'$\213Fc\221h\350\302\250\b\205\206\325"
+	.string	"\250G\310h\003\320\361\210\204UM\332\034Y\2640\371s\263\376\034\205\214\204G!\243;\264\n\035U\343P\005A1\211\223I\025\031\024D\234qaT\004\204\221\253\321=\216\013\344\232,\n\251)\374\004\251G\241\242\2218\023\244&\2170\220\232\2349q%\006\255?BF%r~\214\210T\025V5\251\246 dT\301\t\031VU\310&\204d\221\003\013-\204\020b\203\007\027@D!\325C\206 \025y\224,R\220$B\022\215!$+(\022\211\324\024\214G@F\"\020\001>T\002\350\347x\204\354\001b!\200\244\020\321H\202\320\261H\204$\332\354\230(\021\244\002\025[@\252*\326$Q\003\212\265x|\200Mr\203\320\261\210\\Ut\020aU\205tLXU\241\235\035\025H\002=A\306\342\321\n\020BG+\324 \241\211\022+\222hT\002"
+	.string	"7\"\034}\230`\203O\211\344\t\252\320\2218\264&\211\306\016\035X"
+	.ascii	"A\244\202\003\n\026LPWb\220\321\n;\007*\"\325\243*\224\376\004"
+	.ascii	"\007\030p\320A\213\231w\340\201\t\017L\f\337\201\007>>\036p\340"
+	.ascii	"\223\236\003\237\273\376\254\304UE\316z\243\376\240\030!\004"
+	.ascii	"\025\353\327\033\365G\r*:\001\251\032\251\352\212\233\017\225"
+	.ascii	"\310I\327\244\272\022MP\205\210H\325\210\210\230\263\376d\240"
+	.ascii	"\301\361\003D\344\bC!\020\245H\342\020\020\236\371P\211\344O"
+	.ascii	"\016\tA:A\306\"\213\343Q\315N\362\207\005\213\242\365\b\005\013"
+	.ascii	"\037(2j\bR\215+\210Gu\306\250f\375I\256\240\022\025\327T%*\252"
+	.ascii	"\260\"\211k\222\346C\025\274\310HE\366\254EE\310\036\233\344"
+	.ascii	"\217P\221\305\261\250\005\361X$\322\360\201\365\250&U\244\321"
+	.ascii	"Zt\004\001\324\202\021G\375\321\240\376p"
+	.string	"P\201\220GE*\220\352\252\236\260\036U$\362\bH\203\213\265\bD4\"\242\320Y\211\"\260\240&\217p\214EE\"\374\b\223+R5\206\200BM\036q8\252@HU\002FDG\311c\021P\210d1\251\"\3255\351b(g\375\341\300'U\205\210\253\261\250\005\243Q\0052\032\217XlX\217GE(\214F\025\205\b*\020\262\210E\007\027D\243Q\262\310!\250\250\210T%\300\302\310\204\225\270\242\210#t,\036\221D\nL\260\376t\260\036\213G3\367\361Aa\301\n(\224\220\002\225p\201T\327\225\270\242'\211,J\036\325d\317\261H$\352\001B&{J\2040\022\201\212k\021\211\002YD\302\261\250\270\022\221G#\254\304\025-x8\025\225\320\252\017\204\264\030YcB+a\325M\316x\2102MY%ln\371Ui\351\272\247\316\0304\265<\341\f\373\305B\201\223[\233K\205L!S8\225"
+	.string	"'hZ\354\204R\027N\321\t\225\266|\241\322X\030u:\3016\"V\032\013\241N7Sw\307\225u:\374\302\234\020)_\351/|\302bVsa\332\2367\354H\331\025'\"3F"
+	.string	"\341\242\2041p\332\f\225\253#A\204M\230M\007\213\326\215\030B\027\3402\337Y\024\023\2230N\224(5\276\331C\202\367\007\003\353\270\312$OuJY61\312\354\240\302\027\302$\262\"]J\215/\304!D\3027\260\366\262\032\177\220\363\271py\345\232(\215\021*\205\371\007\312G^\343\013\363\217\r\220\201\241\t\2571.\343s<\030\2007\272\271\3063d\360\030a\221%0x\314\217\005\255\023\036/H\3415\246\021\342s,F\247J\334\037X \006\244zQ\244\252\3611 \016\215\037]`|\216\303\b\253\352lx5\266\371\303_l\364\214\330\265\341/?\366\202\375\372\307\006\340\244\254\341h\314c;\f\205\307}8ZsU\244\f\024\357\371\001\007\316J\021$|\235\245\214\227\2659\334\345\013\354\251\344\005\227\246[\027'F\266eJ[\027hSc==\274g\231^>"
+	.ascii	"\242dO\t`nN\361\3748\313\361^R[\263\2551\306\322"
+	.string	"S^\305jO\257\247\274C\323\025\250\216\214\256&\257<\333d\306\013A\267\306OO^Z\215\237O\0339\254\266\251\306x\n\236r\305R(1\020\365\303*\023\304x\030\357\212\321d\246\t)O\016{w\370\251\306\bY\205B\250CC\364q$.\2352\016\315\314\214\314$Ic\003\025@ PL*\234\216\247-\037\023@\023\b$\252\224\205%)6#\"I\nR*M\007\263\236\324\346f\036\r\203z\005lc&\333\344\323~\315\266\25481\326\203\310\350\261o\255\202~N\350Y\210\203$\337\276\340D\351\350\035\177\305<n\307\315\342\370\017\330\203\312p\366\312\362\306\365)Z\201\210\237\013\317\231i\211Z]\275\355Q=\232\305\220p\004\213\360\335W\206\353\374I\234r\225\323\3627\355Uz\311\333i\321\022&T\212\231,z\240\250\363hY+\312\201\004v\363]\177\356\243\200N\311|>\237E\215\211\314"
+	.ascii	"\327\344e\327Y\007M"
+	.string	"u\342\312\346\306\367\372N`\273\002\235\212\2623\334\237\363\327\303uN\274\260G\027L\022\235\273\205#\376\373:\030\363\321\366\330\340-7\232q}\202|}\037(4\017\257a\341^\240?qX\370\225eE\236?\227\315?B^\024\324~qM\247\347y@T\177\007\377\004\013\317\266\265\255\236X\344\324\252E\357\223%\351\003`~#q\267>\204\376\006\351\350x\340\256[\274\233%\342\244\235\3171\tN\f*>.\f\271\235\314\267I\202\323\r\226&\344c\0215\232\351\346\212\335\211\232\375\016\322,\236\243h\250?\035\bR\374\242\305\325\377\320\2664?\003\034\375\216+%\232\026D-}\030\272\\\324\223\f\276\336\314\241\210JWO\027\360\254|\217m\034o\227u9\2051\247\311\ncu{\013\321\024\376\247\005,\b\372[\nV\023\205S\255|R\212\322\320xV\005\260\256\354\307\021\353\320\024\374\270O\334\233\330"
+	.string	"\212\274~.c'\032u\343\221v\305U\030\231\2312\t\355hB\263\323\244qrh\004\034VY\013\327\320\202\245\302\034\301*\036gD\003\3208\341n2\2106\301\344\361b\271\203YG\367\343\362"
+	.string	"\265\206\216$\243B\245\243\377(\006:\020\\!\355h\023\310!XJ\023\320\346S\364\243^\022\301v^\004T\260\021\260\025\361\247x\037\327\237\261\250BmU\016[q- /3\244\257\272\201\027\224%T\226 \352|\375\001\323u\313\bZVQ\344\305\2533~\300\355\260\b\337\326k+\343\271\271\324QK\330a\032\305\021s\221[\272\336%\037\016\374\270\217d\275a\177\324\354\375\006\361<N\232\303\024{\326\022`$\204\323zI"
+	.string	"\236v\003l\2434b\260\265~\321\256o\351e\360\r\220#\026\332\333\212,\316],\215\356`\r\rgG1Q\206\341N\273O\007k\332$\364]\250\226\rj,j&\307\021\230\rPb\246\326S_\221J_\217#$\343I\004\026\325\207\025S\232\270\321B\357I\322r\b\317E\\t\320A\255\265/\300\343\252=\222q\2232)\005\3442n\310\244\245\355\020\226|\324Yz\271\270\177\206)p\311\336\301u\220\241;d"
+	.string	"\210A+^%\232;F\274OL\352\022$\2052\362\2029"
+	.ascii	"\341Y\304\214\036v{\247\232\0067\005Gh\377\202\326\227\243\022"
+	.ascii	"~D\177\024r.TM\362{\254\221=\230\206\241LW\222\263\3315\267\233"
+	.ascii	",g\007b\330q\334\035\223\225Nu\320\2527H\\\\"
+	.string	"s\016Y\t\373'e(\231\246\372A\331\243\353\330.\331\\i\264x\022\253"
+	.string	"\320\263\031\t&\252D\374>p`\352\226j\240 \371\335\240\325x\316\334a\021\250Pa\235gf\036X`n\034\036\245\200\222\205b\222\246\265\021-\316;U\372\001\241\215\204\212V8\3468`K\211\215wSn\360\215n@ry\252\256\003M{e**\032a-\275\336\217\025\350\222<\250\304`\341\032O\203M\033\322b\373*\233\205h\214-\322\005\032"
+	.ascii	"4\\\337\273D\304\327\nE%o]\274\3224\003\313\335 v\227<lsU\213"
+	.ascii	"\016e\216\306\022\276\235 G\356+\333\314\363y-`\2474\360\276"
+	.ascii	"\"/\375\316\036\274\252\354F x\2665\357Lc\367\354\017q\243l\027"
+	.ascii	"\315NH\006\276\261\352\304\203\225\271T\001\324d\0175\313;o\243"
+	.ascii	"\246\214\003\237~\322\t5E\f\310Hn}\375\372\246\034r\2545\254"
+	.ascii	" !\327\033"
+	.string	"\271\236\005]2\237e\304\304\002 EM\3024\246\030\326\264(co\233\206&\033\256\201\026\343\266_8D\223\333\211\245,JSj\"\2573i\305\364auX\360|\336\310WrXT,E\250\352\3045\247{\273\277\025i\344|\024G9\0171\303~X\330\203\343\204N\350\254\203w` ^+\301Y\272\257\020\245\332\212\301\243\201\024p\233\n\352\214\020>\372\364\226\224\350\325\211\2671\335\221B\025P4yn\344\206\274`\031\030<\325x\304\241\266\365[\223\345\335\211\024=C\030vN^\301\322k\376\337\362`\006\315\324\366\346\366\230\355\254X\035wZ66\370\275\177\f\363af\0248y\334\310\2410\271\300JN\226\307\005R\313\210DF\005\342\301W\211\0240\351\331\001{'\3713\265\033\025\252&.\243\201EJ<b\342\222\355\207\341\t\333\345\342\361q\362\3036\263\013c1\313\203q\220dq\001\246\205"
+	.ascii	"\036NG\206\267\321)qc\200\326%T\013\347u\2049\3504\214\376\313"
+	.ascii	"\263j\240H&\034\245\201hu_\342\231\265&j\230\233\002\025+\224"
+	.ascii	"\363\200\364\032\237;#E\3659\346"
+	.string	"\351\227)\274\n\217\342\003\273\311\347\333\222\365z\204\206\355C\330\274\222\001&\353\003\375\261\206=\022-.\352\177\332\360\"\t`\030\023p\270\335AvM\346\0020)\266\354\323\036\323\361\305\277x*\371\220\204\331\275\210N\355`O\017\314\006\2263vi\005^PR\253v\260qOA\247\025\346y\b\311\241\336\034\202\264\222*V\256\026\336\321\332Qj\222\023V\007\330h\232\033f\312\020\nm\001\t\310\340&+\345\242\356\034{\013\031{\204\250g\322\2118\n\f\021'\032\223V\326\333+^\363\366a\361$7\r2\f\017h>(\254\344=\244A\022\r\017\016\026\262\205\273\370d!\005\332\324\362\277\262BH\325bn*k\242\261g\236\206\246\002MmNc\313\335\221M\006\272:!|\311I\226\"\310\027\237\343\350.\t\327V\"\352\234\233\036\305\256\312\325\r\351@\233)T\206\376g\002s82fL\035\271\210"
+	.string	"nSR\300\220em\371\2544\372\276\362/\327T{"
+	.string	"\305\033\n?\360\003\2405\353\225\336\270\215\321\205\007\327\270\332\321]\013\345W\370\032\371\261\213Q\024\212\350\240\200\304\255\210\254\"F\241p2\326\375\350r,\251Bf\321\366.\033\020\240\"J\232\277vb\362\324m\233\004\021\323\310W\rQ*\245\354\337h3\316\r\240;:\300E\004o\221\001\276\330\007\265\354\203\203\272\345\366 \007z\223_I\322\330\262\276\n\240\346\001=\352\fd\022y\243^\250,Z\260\204\1775\021\366\353E=\335\315\230\256\345}\250X*d\t\212\241\375\3169A\275\r\261\f\256\313\"\222\320V"
+	.ascii	"\204\333\020\371<\355\007\n\007\036=F\023\265\276`%\272\020\375"
+	.ascii	"\023\350\353\376X\312\3577\0023\270E\333m\034yzT;\325R\204,,"
+	.ascii	"\253\3303\346_\030.\236\221\316j\005_\230\322\221\246\330X(\025"
+	.ascii	"=l\017\032`@9t\221\240\341\321\343\257\217V\254s\236\227\231"
+	.ascii	"\020\301\t\302\352\212\242a#\206\2543\221\337\272\273V78\304"
+	.ascii	"\311\017\004\271IO\372B\021\265\237-e\243\201\222\2125\345Cm"
+	.ascii	"\372\233\252\263\326\351K\206\343\274Zim\0165\323\026\234\021"
+	.ascii	"-?LJ\377\216\266/\360\232\302\232hx@\230\355u\204\365\311\276"
+	.ascii	"\007\364\022\353e\034\200#\\*\251\272;SJK.\250\226$:g\243,\356"
+	.ascii	"q>\211\300DRL\277\233\371\203\220+\220\373qz\362\216\2042]\307"
+	.ascii	"\243h\206\\\222#\332\233\356j\364\007\266\330||%\f\226\204\246"
+	.ascii	"\250@`\237\235#\217S\367\324\224/\021\032\234\277\033\234\255"
+	.ascii	"S\356\033\372\333p'\320\315\252 iI\006\032\024\274;\034{n\206"
+	.ascii	".\200\243r\271\2161\244cP\326\317\372\323\335\243\363\003[\215"
+	.ascii	"@\336Ln%\334k\316Q\313{e\270!\n\236C=\006X\204\377`\314tEm[\364"
+	.ascii	"\346Zvg\342\2765vlx\021\377Kv\223\331\337i<\225\271\242\3413"
+	.ascii	"{\036,\372\226\017G\027O\206\312S\236gT\235\324\rY\307\361\364"
+	.ascii	"\361D\215m\223\267\203\251\033GV\f\342\322N\027\206=\320d\343"
+	.ascii	"I\363\305\037\257\361\272\334\345L\262\330e\266\333Ih\343\316"
+	.ascii	"z=\314\256\313\353\356\\oe\246\347\013}\252\234\306[\276V\342"
+	.ascii	".\376\334\310:1p\313\322\227\301GY\377S\302\f\211M\212C\235\243"
+	.ascii	"\277\023\271s\356\323\325\376%\374\352\302_\376@\367o\304#\322"
+	.ascii	"\031\375\264\325V\3107\207g\230[n\352\215\212\223\243\205Z\337"
+	.ascii	"\203z\363\244?\270g\261i\377+8\375\235\270\242\370\314\236\034"
+	.ascii	"\004\317\233Z\257{^\003\370\204\321\203q\370\306\"\305\037\031"
+	.ascii	"\033#F\355\376\332\033\342\226\001\234\377n\243z\360\330\377"
+	.ascii	"\247\\_\372\353\371\225\235[~\265\030?\300\372\357\027\347\336"
+	.ascii	"~\201\376\333\346\357\361\313c\372\2377\030\222\236\331\177\250"
+	.ascii	"\376\217>\240\256I\375i\001\276G\177\336\366\375z_\232\373}>"
+	.ascii	"z\332\262\2337\336\217\317\320\243q\317o\333*\377\0273\332\316"
+	.ascii	"\365Wb\263\013a\246\324\177e\314\034a\0360y\033\205CW=\265\260"
+	.ascii	"\344\232\0248\303\275\005\367e1\363\355\"\331\3316\206C\223\323"
+	.ascii	"\t\207\345;R\354\240Y\003\253\037\2132\374\242\375\237\244\021"
+	.ascii	"\253/\3300D\366\321\221\035\240oKXB\3740\371\207\350\213\177"
+	.ascii	"+\352\033\341\3232\016q\200bE\337\327\366\250\036\020{o^\232"
+	.ascii	"'\347\020s\223\356\277\260\377\205}g?\035\227\033\021\373{#\222"
+	.ascii	"\035-E\272\002"
+	.text
+	.section	.gnu.lto_.symtab.4a7ff220367600ff,"e",@progbits
+	.string	"batteryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"batteryWarningVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"batteryCriticalVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"batteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"getVoltageState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"getConsumptionState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"batteryStateStrings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"isBatteryVoltageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"getLegacyBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"getBatteryAverageCellVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"isAmperageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"pgResetTemplate_batteryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"batteryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"batteryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"voltageMeterGenericInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"mixerGetInput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4a7ff220367600ff,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
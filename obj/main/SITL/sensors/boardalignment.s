@@ -0,0 +1,472 @@
+	.file	"boardalignment.c"
+	.section	.gnu.lto_.profile.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375 \310\035\003"
+	.string	"\224\004\274"
+	.string	"\t"
+	.string	"\207\235\361\201\006"
+	.string	"\001\240\342\234\212\n\002\214\230\327\245\016\026\002"
+	.string	"\002\001\003\002\003\002\002\002\002\003\242\302\263\302\013\004\240\306\347\273\002\003\005\273\337\224\231\013(\002\004\003\002\003\006\216\305\332\310\005\007\b\240\342\234\212\n"
+	.string	"\n"
+	.string	"*# \314\241\027s)x"
+	.ascii	"\013;\027\200%\260@;=6\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375 o\205\002"
+	.string	"$\003c"
+	.string	"\004"
+	.string	"\001"
+	.string	"\020"
+	.string	"\007\001\002\001\200\004"
+	.string	"\t\002\001\003\002\005\002"
+	.string	""
+	.string	"\004\001\004\b\004\001"
+	.string	"\001"
+	.string	"\004\002\001\001\f"
+	.string	""
+	.string	"\001\201\f"
+	.string	""
+	.string	"\t\001"
+	.string	"\001"
+	.string	"\f"
+	.ascii	"\370\200 \342\210\020\240\253\303\235\205\254\f\343z\324\\\003"
+	.ascii	"\360\252\230\007\332\207\001\026"
+	.text
+	.section	.gnu.lto_.inline.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375`\031\002u\013"
+	.string	"\306R6,p\247I:n\275\200\200\200F\207\300\321r\342\020\013\276,\006^\033~C?~\370\367\302Uq\362\323\361"
+	.string	"\232\375OZk\233\310\235\002,"
+	.string	"("
+	.string	"-"
+	.string	"\317Zh\377<kE\206\300\030\006\330\0040\f\243\r'"
+	.string	"\351@K"
+	.string	"!\241\220\360O\244g\203\035\320\026\362|[H\225\266\314\337\311 \237Bb\3664\n#q\243l\024\007\013\264\220\303\3470\224\2638\005VZ\3102\357:\017\242\315\336\3402\331\311`\333\332\341\253\356H\353\353\227\336\241\016\376\206f\212\252a\226KO\213\230\206\221\031N\017*0\020\231$\274\254\220<\202\215\304\267\007\023D&\013\020\001\337\365\276\233\267RS]W\316t\234\235\365\202n\256\271\256\257\347\007z\3463\315\272\025JeoA.\022\013\245&F\250\221DF!\252\221\224$\305\214\001`\0021g\233\007\021@-bJ^#\323\032\337B\345R\255\262R\200\244 u\200\202\371\312G#"
+	.string	"F\325W\302\241:\343\257\345\205\032\022\373\204\254x"
+	.string	"\330\335\266\232\314h\235\277\r\350\226\252\261\306\023\330\n\272\267\032\315\264\342\331\260kVE\2436\031z\214\244\323?\365\346\332\227\334\341\375\267\257\331o\206\214}\007!\340p/\b\244\356:gx\371"
+	.ascii	"\r\260\223\373\371\t\217\245d\221X\022T\f\013\313\337\324\003"
+	.ascii	"\300"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"E\003"
+	.string	"\022\206\020\031\260%\351\f\303\002 x\030V\251u\200\034\206a\200\203,\266\244I\222\222\f\032\340\331#\320\t\235iv\261\373B\237\3065h\301\025As\021}4\212\032e5\bL\244y\207\334\241\324l\333U\323!\r"
+	.string	"\031S"
+	.string	"\020\220D\224\243\220\r@\f\003\226\322*L\353\234\322\222s"
+	.ascii	"W!4\250\302\220Y\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\231\004\004\230\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375 |5\002"
+	.string	"\264\002p"
+	.string	"\004"
+	.string	"\002\001\024"
+	.string	""
+	.string	""
+	.string	"\001\002\013"
+	.string	"\001\002\005"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	" \340\f"
+	.string	"\001\002\f\001"
+	.string	""
+	.string	"\005\002\002\b"
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"<\273\020U\300\252\004;\3235\355\3144"
+	.string	"**i\006\006\n\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.1ada37230af5bddd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boardAlignment_Registry.16.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375 \230}\004"
+	.string	"\024\bZ"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\256\230\ryw\250\337\005yu"
+	.string	"\005\001\006'\001\f\005\001\006\035\001\001\0028sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/sensors/boardalignment.c"
+	.string	"\004"
+	.string	"@\b\341\345\206g\222<"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_initBoardAlignment.18.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375`\224\003\275\026"
+	.string	"\226k\222E\300\332(\035P\004\212\340R\273u\360\"\266^M\003\377\372{\021\021@\202\364\375&l\301\276p\201\377\365is\353c\264I=\375\326\372\031\b\301h.\302\033\272N\312:\342U\301UdhCA\032\331D\312\224\002z"
+	.string	"w"
+	.string	"\202"
+	.string	"\321>a\217\036\177\235G6\356Bb\317\245\360\226\310&\220\001\245Gh\027\206\202GO"
+	.string	"\"=\355\367\034H\3547\025\007\260\313\023\304d\027\267\300\r\300G\343.\340{\004\037\340{t\314\336B@\207\244e\347GhwO\212\343\261\213\276\350i\306|\331E\"\033\335?\031\217:\351\215l9\251%\333\n\357\300\356~\367ta\243e\212lv\327Y\263\305\270\301\333Fa;\203\255\267\016?\223\222\262\350\202r\022\214\2773\316\213\204\340n\216\003\237H\b\023\376\216G_\305\367h\322\357\036 J\r\032@n\263\034\262q\264\324\033\366\275U\036;\246kb\232&\246M\277\375\245/=\212\351\031/-\023\323\340\227\026\305\364\347\245cL{_Zc:\275\364\013h\213\235!\003\256\354\276\030\n\263@\321\t\217\347~\373\376\317w\366\310'\356\343\037\351A\243\347\001\372y\032\325\223\262\343\021\207\002\356\256\247Z\273}\271\251\332\035\376\304K\f\344\260=\\\367A"
+	.string	"\226\335u\360\350\375\324\272"
+	.string	"\310T\033\004*_S=\220\2432_S\2773\306\244W\0137\332\225!c\236\372\374&w\222\362wX\265\312\327V\337\343\203\036!/\212\333\225})\274]\033\021\236\373\f\037?\270\344\214\333\335X\243\244,\254+\251\321O\321qOo\0309\215\246\225\021GB\243\020\202rwe\032/\025\211UKB+d\301P\260\320U\222Pr\212\001\254\245\302i\255X$P\"\\\2500\304\351\345\n_-\325\353\324b\241pN)\327\353\304"
+	.ascii	"\201\303\022*\327\t\026\206\256\323\b7\273\267\312c\233\231\322"
+	.ascii	".\342\222\313!\033\310\373\334\312\r\270;{\315\247\362*\024*"
+	.ascii	"\334\334|\217\367\271\356B\315\306\240!_s\356l@:*\363H\355\r"
+	.ascii	"\007R13#\031\235\001UF\275$\254K\001UY\004\371!R\233\303\243"
+	.ascii	"$\371D1? \300\002\231\031c\007@BJ\016\212\246=\265\361B\232\202"
+	.ascii	"\222\306\270\265\216\253h\2645K\tZ\213Q\r\221\311=\306\244$\206"
+	.ascii	"Y\\f=\217\371\004x\320\"\306\356 Xf$\213a\320\205\367\215\020"
+	.ascii	"x\340\016F\367\300\013\345l\fAQN\346k\337\f\337\271b\004\"u1"
+	.ascii	"E\301\035\320\205\013\242\374\252fqu\200\002\364\206W\264\306"
+	.ascii	"9>fZ@\006>$\356\315;T\244o\356\324K*\332yEB1\240\033%\247\267"
+	.ascii	"k\225\001"
+	.text
+	.section	.gnu.lto_alignSensorViaMatrix.20.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\325\013"
+	.string	"f\026Q@ Q\233\016\037\b\315\310@[\025\360\tqKg\024(9Q\232 \\Y\b\024K\340\255\355\314\376\333\341\255G\204\345\345\006X\310\354@(2x\030\024K\210\"\fP\360o"
+	.string	""
+	.string	"U\262\367\226)\005?"
+	.string	"<"
+	.string	"="
+	.string	"\234=\343\237\307>F\307\006\220\032\273KA\020\347\036\241r\376?\036\240\3636\217\222\207\303x`\304\005\215\311\363\304\t\207\210\356\037W\016^G\025"
+	.string	"\203\335\265v^\207[\336v\003\333\017\354+\b\360c\377\373\345A\177\204\352K\021\bF\201\026\273\034%66$_\214\260\375\311\266~\031n,\270\3327\361\023\334A\016\271\200\335\017\013\221\335\017\201\023H\227\376>\211.\245\017\210.\035\372\316\361\036$#\"\320\232\350\260\222B\206GI\354\2538\210\306\017\341\231\321w\231\350\362\020z!%:8Z\342H%\214\320\266pA\337YW\220\bi\200\033\373\353(\374`?\356\356:\030\256l\253 `\363\332\252mF \260i\326%\332B\3310\013\203I\270(T\227\254\232\025J\313\246\206Y\032\205]\025\206\262d\032E1\340Y\301\312\250m\316\214\232>\316\343\302\217\035\240\bq`'N:\001\023\024"
+	.ascii	"'\324\300\231\320;4F\326Px\330+\264q\025\226\001\257,\366\032"
+	.ascii	"\260\035X\230\245\305\205\367\025\306\003\252\032\270\002\346"
+	.ascii	"*\250(\342.\307l\222\006\246\366"
+	.text
+	.section	.gnu.lto_alignSensorViaRotation.21.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375`\006\007e "
+	.string	"f9\306I\240VN:\"\326\007\233\036\214\261\257\027\331\270N\032u,\243W\326\005\026\212\033j\"\277\242\005\231 M\251\261}7tks{\210g\372j\340j1^N\r,x#F\035\372\311U\230\243\237|\354nM\332&d\313\224\002\264"
+	.string	"\242"
+	.string	"\265"
+	.string	"C\003\202K3\256\324Z\033\2344\205\362\244\201q\256\rAB\357\304\022\236\265\"U\231\360\265\277\343<z\217\262\326eje\312\342\252\225\350\300\021\312\223&\336\206\236,OCO\272g\213\235\350T\337$\306\211\251.\265\326\334\204\361\336q7[\255\244Qr\234\333\363\327)K\220\310w\034\326\307%\025X\224\212\206\277\215\f\256"
+	.ascii	"\331\362\033C\303\321f\005\215\340\231\f\271X\033\211\242\366"
+	.ascii	"\245\024\243M\241_P\344\334\202\032i7V\277\260t\205E\251\310"
+	.ascii	"\350\263\205\360\004\320\204\220\215(\210\226\265\326+\r\031"
+	.ascii	"\225K\273\251\265z\203DEw\314mw\261}\301\246"
+	.string	";\002e\315$P\205+\203\267\374\247\221fb0\212r\255\f\336* \345\311\267\026=931\030\201\2450\372\355\231M\f\332\331d\177\254\223\311>\361\267\271\324]s\252\233\346U\367\314\243~\031\332:\206\256qt}\243k\033]\327\350\272\244k\032]S\272&\351z\244\353I\327K\327O`\033.!\340U\353\2123\263\032Fv\325\270\324O\365W}\332\367\177\034\313\276\031\304\257<\213\250p\324Zo'm\020\366\355\344?\365\342\255|\253\222a\201*\204\001!\0015E\320\223\215\n\345{\334G\357R!J_I[@2'\337\"XI\243M\035\322\030pK\016\241\2262\341\222oq\b\215N\277\253f\322\251C*\222\344\324\035qQ\362-\352\2403Vr\b\307q\352\216\266\220|\213P\344\234S7\034\003\356\364\265v\352\206Q\200dE\276E\026\343l\232>\327f\005g\346\247nX\004\222\321L"
+	.string	"$\021X\231\360\267g\376\220S\2630\337\2021q6I\361\247\224fO|(\2641&~\023J\005\314\017#\223|\371I\306\"F\374#\363\007\021\337\313b\345\276\004=\351\r\326\240(\033\365E]p!\266\305\376%\254\325w\244\r\326\005'm\246\202*f\265\305\206\261\337\025\">\342$\356\263\343\001\302\001\332\361J\240\037\235\r\243s\036"
+	.string	"\371\350\364\370\354\360t\300\331\300\303\331i\310\375\360v?>:?9\037\036\234\236\\\016\357'\367"
+	.string	"\201w\036tx9\240\335\216\227\273\021\177\037\353d\262zyu\024\366\233A\270"
+	.string	"\373\254\375\355\224\265\376\036\364\326\365\345\370O'\255\263\263CO\312L\037\213\207\303>\350c\335F\345\"\314\304\364\335\311\313\025\256\333\007\03235\370\240\"\264^\354\177\271\331\007\377\311=\273}pGO\306\314[\375@\321T\2310\310}\343[06\034n\352\222\316n\267\251K\342\002$\263\331\246.i,\312\267XV\253\325\246.\311\253,\247.\200\205\250aX\244\02444\"J\nR\320\2445"
+	.ascii	"\003\221\231\3326\021\3004\351\0341\231@I\n\316\001r\350\221"
+	.ascii	"roE\325\220\034\3679\340\013=\252 \257M*^.q$\330H\206l\255\221"
+	.ascii	"\260\265\b\261\235\337\005\356\354O\272G,g!\005\ri}#\236N\216"
+	.ascii	"\370e(\326#\315u\346\013\003\301\203\270\341\227\355j\307{g\002"
+	.ascii	"\276G?J\320\215\365\"\272\\\003y\270\236E\260\221\355\r6A\233"
+	.ascii	"\216\303\200p\217-\f\230d\n!\323r\267\300W\205\006t\357\220\356"
+	.ascii	"\035\322\275C\272wH\367\016A\367x\r\231I\305\237\037\304\202"
+	.ascii	"M>\355\264\276+\3472\017\033a\301@T\t\247\341\246c\313R\217_"
+	.ascii	"Z\331\201\204\370`%\334@\024,\220RS`\253&\363\r\307\276\215\224"
+	.ascii	"\020[\234.b\rW\002AS^\371\350|\302\241\335`\022\300.\266A5"
+	.text
+	.section	.gnu.lto_alignSensorViaMatrix.part.0.26.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375`\030\001\305\f"
+	.string	"\366\227S?\020Q\234\016\203\237\024\006\220o"
+	.string	"\305\323\231\356<\001\027A"
+	.string	"$E\013\316\314T\240\300\202\352\302\177}_\317i`\274`\301\342\355\001@\325\021\350\244\260\221\332O\025H\303\305\344\265\361w\333;\245?"
+	.string	"B"
+	.string	"?"
+	.string	"\224\372"
+	.string	"\310\251\375\023\266/\033\177\266\214\207$\3661:\033D\032\273k\235N\320\277O9}\276x\031\242\006\310\301|~\274\354\314"
+	.string	"9\037.\005|\342x\260\273\246@\334\364\266\035\330\206`_\023\225-'yr:*\313}\025\027_te\373#\221w`r\330\fH\301\251\247\310\263\321\200:\255,\345\303\213\201p=l,\245}\024O\361=\344\216Gv=\245\027\273\341\202S3\240N\035\276"
+	.string	"\344\001w\341Q\273\231\322[T\277\304\251/x\362\340\251\357AN?\375\221\303 \017\372\343\003\220Dxh\230\0309?\236\323\264\323c?\374?E\022|\354v\270\361\261#(\f\023\037\375\366\375\025\037\355\031\262\255\273\"h5\353\256\256J \320q\030e\362D\322iXE\243\220U\270(\333U'X\334V9\r\343,-\273*\326d\343,\t\002W\013\330fu\265nV\365i\247\307\026O\221B\036\231\251\231\363c\033\200<\213\035"
+	.string	"'t \304\306\330\334 ?\013'\023h\321\250P"
+	.ascii	"y`\204\353\260u\326\n\323\230\200]O\264z\204\307/\326#\2026h"
+	.ascii	"\242\210Gj\310UB(8\246\323^\361\264\333f\312N\003\300\265\007"
+	.ascii	"\020\315l\376\te\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\325\005"
+	.string	"\022\311\",pU\323\001\216{\375\376u\377\376V\307\002 \350\355\334\215sG\374\254\002U\305\372s?.\200\321M\002\205\214\r7\201\355&\267L\001\307:\b\256J\325\013@\207\363\347\331\330Eo\243%\232\201NW\323\315\305\267\n\350\2331\206q\246\335\375#\002.6\2505\301s\005\t\376\223M\022yh\216\255\241A\026\327I\251(\002_\217bk\020\237\354\314\304\325\333_gC\002\370?\321RN\314\317\377\246\242Ow\267\304\207\367_\031\001\022"
+	.string	".\343gU\b\030\032\024\354*Ib\206\001\352\341\003\304\307\245\242'\030.?\326d\242\020\f\256\276\f\350"
+	.ascii	"\216\211Z\t\315\241\312"
+	.text
+	.section	.gnu.lto_.refs.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375 +Y\001"
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\001"
+	.string	"\002\002\001\003\b"
+	.string	"\002\001\027"
+	.string	"\001\004"
+	.string	"\003\002"
+	.string	"\002\005"
+	.string	"\003)"
+	.string	"\002\001+"
+	.string	"\002\006\002\007\002\b"
+	.text
+	.section	.gnu.lto_.decls.1ada37230af5bddd,"e",@progbits
+	.string	"(\265/\375`[\023e_"
+	.string	"J\244\250#R@\220J\032\016\352\234\213yR\016\n\037(x\263?6hr\310^\216\345f\n\232\327tJ\204\r\032\013P\330rE4\023h\016)\025\023\215\220\244\375C\274\003\364\203R\324\305\035\354F\330\\@\036?\373o\216\355\325g\304\016)\357\375v\2736\2212\005\334\001$\002-\002\311\316\352^w\r\355F\356\216\350\331\035\201\203\005\007d3E\277m\300x\361!\243\323\301\n\243<\254\331\216k\331\201\232V\334z\331\263}6U\226\332~\331\346zy\b\365\t\232'f\212~\237\027c\346"
+	.string	"\234f\346\307\034\243\213F\364M\373I\227Qk{\355\306\312\230\3340\312\273F\355\322<+k\220\034\333\324Cp\245*\253\254\3276\226\230leY+\027\353I\256}$U\263\272\221\265e\265,\227mn\226\305\"$$\024\264ue\334\262T\364;E\375\256\352\327\211\372U\242~\253\324\177\311\376u\262Y;\266S61\333\253{\005\221\2669q:2*\266&w\240\270\321\205a\364+\245RY\260\255\262\315\r[)_\257\375:\272v'!\210\242\2255e\241\364\344tO=\271\352\356\357\326O\364\r\333'\013\305"
+	.ascii	"\032\335SR>\\nf4\231\353\356 !!!\265\211\334\031\227\212\336"
+	.ascii	"\247\376\271@\351N\b\352/Pw]\256m\036\313:\277Z\273\365\234\344"
+	.ascii	"\332\316\356\366Y\"Y\216D\030\275\004\352\267\353\004|\351\216"
+	.ascii	"\340>j\214\356n\336\036KzVE,P\212\256\013\224\252\373\223~\370"
+	.ascii	"\331\347\205\177[x\357g\023\377\246k\334]\361;?\347\374\213\302"
+	.ascii	"\3775Kd\341\277\226\377Y\376o\371\377e\223\206`\377\247\374\247"
+	.ascii	"\262\302\177W8\002?\037\360o\007\377\262\370\027\204\177=\370"
+	.ascii	"W\203\1779\370\367\203\177CP\341\337\241\1773\370\027\203\377"
+	.ascii	"=?S\375\013\374\327\367\357\t\377\232\360/\t\377\212\360/\320"
+	.ascii	"\277\350\277\275\177{\376\345\375\027\363_\354\177\017\377\347"
+	.ascii	"\376\263\370\377\366\237\204\377m\377A\370\317\366_\355\377\330"
+	.ascii	"\377\026\377\203\376w\371\237\326\325\325\325\375k\366\357:\370"
+	.ascii	"}\030\bC\2169\310\270\211mP\201bR%\266\362l\201a\221\3025V\312"
+	.ascii	"N\206*-;d\251t\034\003\035\317H\273we\342Xv\324\262\304\317L"
+	.ascii	"\347\031\233\246\f\373Rs(\243\261\244\315\272\371\276\371\033"
+	.ascii	"N\252\307\356\343\3328V-**\252\004\017\226\rt\275tN\036n\247"
+	.ascii	";\253\273\r\320Q\202\206le\224\221\017\3339+{\363\203\321\247"
+	.ascii	"\341\343\377\034\336\\\227\036K\370\310\255\276=\231(Y\223S&"
+	.ascii	"\226\246\215\321\346\326\355\031\324\2115e\215\321\357nP\277"
+	.ascii	"\263\241\236\377\264\221\313\356\206\302Y{\271\264\223\376\373"
+	.ascii	"\305\331-\361\363\354n\023\370\217\366\356?\212!\335Vlr*\022"
+	.ascii	"1d\017\026\321g\322}\004\321k/\225\316\251\243\022\312\227'\020"
+	.ascii	"k\007\031\240\2355\264r\235zB\231\315\275\366vr\352\211\005\345"
+	.ascii	"\312\\*W\346\261\327I\346\261{}\352)\275\220\307U:\247\236\224"
+	.ascii	"N\346\023\210N\366\261\235\310 j\222\371\2444c>\365\224N\344"
+	.ascii	"\22329\365\004\242\212\315\210[\r5]f\353E\231\354\033N>\220\313"
+	.ascii	"\336S\2712\233\255{\275\230z\231@\267\017\346\222\r\271c\307"
+	.ascii	"\226\2367\226\250 \231\273vw\b\247%*f'\237\312$\314\356$KI\355"
+	.ascii	"\204\342\270>\233\310>\2175\370\350&\246n\002z\355v\352>n?\273"
+	.ascii	"\373\330\335\274\245\217\265\233\206\236\362\312\311\251;*\310"
+	.ascii	"\251}\034\311\230\272\331k\314\330\223\322I\305$\"\213\342\274"
+	.ascii	"\352\031\353q\257\232mj\251:\217\\\335\204F\275z\222\341\f\233"
+	.ascii	"9\336\302\312Z\3134\267\314\316m\260\3661\306\026\035Ps\275\\"
+	.ascii	"\232X\023\264Ibx\222\004\0075\3156W\315\236Q\263hVn\307\265\314"
+	.ascii	"@\355+n{tYJC\345\376\215[3\373\314\031k\203RbD=\357P\231\271"
+	.ascii	"@\351\002LC]\267%\263\315\003\366mw\354\362\341y\323\344M\033"
+	.ascii	"F\317G\365u{@\272:w\306LIK\303mk<'eT^\214\356\032\257\230e\373"
+	.ascii	"\256m\230?\020\301w\002\311\355j\034\333\204\213*\241\323Uv6"
+	.ascii	"\203KY\031\033\234/,7\300D\261\322d+|eAt#\213\214\3652\312\304"
+	.ascii	".\314\021&c|\320(\301\330\256\324o\223\345\035g\"\333\344\035"
+	.ascii	"L\026\304\265\036?p1\363a\202\207F\245\346\204\3211\036rM\314"
+	.ascii	"\026*\365\233U\305W[dp\310\301\r\213\263\226\244\351\300VYc\370"
+	.ascii	"\310\027oq\224}F\365:\0316\027\307H~\"\376\342&\013\267\317("
+	.ascii	"\t\260\330\300X\214\303\230\n{\361\024\256\262M\376b\255s\021"
+	.ascii	"6\222\344/N\302L\3669d\202\254\2668!!!\0379'Rv\364\320\252\277"
+	.ascii	"\031\260\244\334`\013.\256{\375\317PX\31269\312\203\326n\257"
+	.ascii	"(\374\204\235\373\214Z\033J\247J\334\230\255\271\356U(\204\020"
+	.ascii	"\317\0310l=Rg\263\207\312z\003\032F\271\213\027\265\243K\fK\353"
+	.ascii	"6\231KM\303\204\254\315\233N\226\"T8\255\036e\243\036}s\242\206"
+	.ascii	"\211\223B[S\217\252\251G\315TV\302K\266I\202w\370\2421\222\343"
+	.ascii	" \327^\331\b\335W\323\212\372%\221\356\352\352\226Dz4L\355-P"
+	.ascii	"z4\212z\224K\375\371\212\255p\234\\\344\320\330\nN\355\254iI"
+	.ascii	"K\355\355O*b]\240\264\304\376\244,\204o\340!\177\216\017\326"
+	.ascii	"\230\r"
+	.string	"`J\324\263\r,\212\244\2011\2122\325\271\206?\207\273X]9]\251\347 <\365\347\364\260U}q1zt\210zf\202\325\311\361`\224\201\250L(\r$>H\205\001a ?\363`\032\370\007\n/\324\321\255a\224}\260\324\371\007\367h\376\201\202\331\215\344\037>n\272\221>\273#vG\240XTVSR\364h\016\365l\013\224\362\354O\272^D\347(\035\264\262\270't*C1\024\347P\233\210\332ve\006\216\031\3169\026\t\031\2512\214\262\f\017sC\343ll\341p\250\324\220\021\023\243~\303,/\377\007\"\330&/wm\327\306\241B\313j\342;1\225i\234\006\337\330\250\336\221q\333\321\232j\302\303\351|\303G\307Z\016%\334\024GD\237\260\202\017F\237P\311\005N\213\"0\250\030\364\001\217|#\bI8\352\031u\216\224\2000R\370\221\2414\034\372xd\f\205\026\374\274\370\031\2132Z"
+	.string	"\031\237t\002i8\2044\3741\n\302\310\300\370+\352\004]\260\361W\374\021q\212EH\303\035cQ\020i\210\023D\032\356\222\214H\301\237Rj,JA\244\376^"
+	.string	"\026\321b\361G<:\362\361d\f\205F(\3218\334\035\375xG\277\"\f\324\350W\344\235X\2044<\301C\364%\031\2412\210\306\"\020\3517\302"
+	.ascii	"GD\337Q\320g,\nP\201\021\030\004\002\020\200\003'\214D\337\360"
+	.ascii	"\204\017hB\213\002n\004$\376\202?$\365(R4\220BE\f\336U\254p`"
+	.ascii	"\205\003\351U\254 \"Z\221\202H}\n\242\335\215\214/\266X\024\003"
+	.ascii	"H4\372@ \026\r]\374\004\205@\243\317(\034\201\307X\244\302\030"
+	.ascii	"\004\302\340)\t\205\025\024\341\270\340#\356\\\374\216\212x\236"
+	.ascii	"t\242\230d\364\275\030\n\n_\274\020\032\021\340\202O\306\256"
+	.ascii	"h\350\"\007\305)\376\224\220\202\276\324\370\244\005.\034\376"
+	.ascii	"\210CF\241\2208\244\343\202O\306\207b\021\005"
+	.string	"=%%!Q\307X\364"
+	.ascii	"\004\306 \220w\"\"\013D\224\300B\003\325\350\2041\370{\021D\002"
+	.ascii	"*\371\216\210>a\nCE\242\260\030\374\025\207\202@\337\213!#bq"
+	.ascii	"\350\204\002\305\337\217\210\364\273 \311\310\b\034\356|n\216"
+	.ascii	"\331\250G\036\225\r\035Ps=\234\331\244\253z1V\203v1\271\256\272"
+	.ascii	"\273\2673F\256\212\027V\232\031>:\314\300X\221Kn\327\262\310"
+	.ascii	"\0254dt\302\274"
+	.string	"E\3418\343\205\247\207\016\264\246\031n\203\242\005n\216\337\370\215\313l\200\246\003j\016\356\\f\327v\326\324h\002\222\006Q\371,\271\206\203\313\215\257Xi\345\370\302\250\232\032\267\005\251\255\245v\026\207\023\027\204\214\020\266s\233\330\346x\223bZ\373\225\334\221#\243\f\206\303l3\004\21393d\351\211\321\247<T\030\2727D\272uu\033\"}\252\344r.\354e{\353\222\332\333\025\332&WF\213\237g/\350\323\2336L\214r\027NC\233\272\244x\3404\264\2379\24703>\353\351!DH\r7\252\331C\360\2101\003\305\r\207M\275\026-\034\201q\250\241(\207\024DfdDDD\222$I\007A\005\204 \007-\244\036\022\300\0259\020\"\207hj$I\241\376t\016\220\313\374\346i\214$\b\340DO\260\003[\220\3722\322bjn\254\227\374\035\033\276&\207\220\2502\317\363\035s\247\252\252\221J\344"
+	.ascii	",K\036\215AHwW\340\344\322\276or\372\342\037Y\037\221\327\f8"
+	.ascii	"[\202\230DK\362py\332\3143D\261\033\317\302\f\237\372\335lI?"
+	.ascii	"\244J\307\362\315\367\345\217\316\213\020U\247\216\032sm{$3|"
+	.ascii	"\207\002T\362\3741\023q%\220v\353\346\226\360\257~\367/\3233"
+	.ascii	"\272(&\222c\332U\273\373z\212\216&4\354DW\tT^gcn\337\2538;1r"
+	.ascii	"\"<\203\305w\324\220Nt07$\216\313\025\323\356\225D\271]\262f"
+	.ascii	"\316\177<>\032V\377\364&\247KB \t\310\026\324\\\210\312ZR\036"
+	.ascii	"\250\344\377L\030\247\346\004l\322g'l\213A/\310\372.[\030\317"
+	.ascii	"\322\025\257Go\261.\005o\263>\232|\3125\344&4Q3W\350rs"
+	.string	"n\017\351\244/\223\333'A\376)\013\260S\003\332\302?\030_\335\260\250r\337\361MrW\235\030\n1y(B\244-;\256\272\221\035\373\221\332\030f\247nF\242\224\004#\347:\201)\271\306\226\377\333\225\026#s\311\240P\221NlT.\315^\326A#\231*\230[\353\206\213\350,\330$A\f\302\323\343\245\017Mh\356 \001\242w\005\0349\361\233\330\232\3161\307(\026\b\f\365\223\210\207\2112\366\002\206\261\272A\316\364\260\354\371\224\230\300\250`E\262\206\332\235\313`\334W\221-\231-\374\ts)\355\216FU\262;\305\203\f\002\334\356\313\220\020h`X#z\030\002d\354(\203\214\325S\366c\246\307:(v\314V\020\355\311\332\377I}Y\235m\340\3412\274\304+ \340\357\377\252\255\347M\343{\237\030/\231C\261DH\371n\222M\0228\371\223\302\227\321\211\022`u)\362\r\353\016\026\203\312\260\203"
+	.string	"\032\313\363\352H\n\340o\276Zy\020\324\262c\352^+\367L<C\262\t\271\031\222\306\365E6Xa\267*\273\255!\254\322\300\371\013k\222"
+	.ascii	"\364\030G\277\365\374\330x\355w\260\363\257\251u\036\225Y8\013"
+	.ascii	"\304\035\300\315D\306\351\023\214O\265\263S\305\362r\301\233"
+	.ascii	"\\\302\243\320\330>\316+\344[\332\0232`\225\331\272\230z\254"
+	.ascii	"\022\210\013\244+qF\006aCv\037\236+\254\343\326\346\345}\bE\301"
+	.ascii	"cF)\211y\362\260\177\266\311\231$\233\035\357\216#\017\275\224"
+	.ascii	"\201\345Gd\240\312I\375\377\365t8\336g\n\236\320\3753L?.\177"
+	.ascii	"K\256gW\335\021\377\250\202\365g\256g\315pg\353\366\252\017\212"
+	.ascii	"\331c$\bO\376m\330\bG\374\247\021?\245\025gy.\231\351\025Y\360"
+	.ascii	"\257\n"
+	.text
+	.section	.gnu.lto_.symtab.1ada37230af5bddd,"e",@progbits
+	.string	"initBoardAlignment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"boardAlignment_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"boardAlignment_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"applyRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1ada37230af5bddd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
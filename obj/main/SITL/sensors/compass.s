@@ -0,0 +1,685 @@
+	.file	"compass.c"
+	.section	.gnu.lto_.profile.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\f"
+	.text
+	.section	.gnu.lto_.icf.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\335\005"
+	.string	"$\b\"\001"
+	.string	"\022"
+	.string	"\322\266\272\274\b\022\002"
+	.string	"\002\001\002\002\002\001"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\267\335\335\337\n"
+	.string	"\003\315\344\253\361\017\002\002\003\002\004\004\240\342\234\212\n\005\240\224\254\300\003\006\006\330\344\353\301\004\n\002\005\002\005\002\006\002\007\007\352\263\360\321\b\b\t\n\013\366\344\227\262\016\002\f\373\306\226\226\0070\002\b\002\t\002\002\002\n\013\002\t\002"
+	.string	"\002"
+	.string	"\006\002\006\r\016\017\020\203\325\356\324\t\021\240\342\234\212\n"
+	.string	"\030"
+	.string	"\031#\222\272\273\207F1\037v.\330\t@\200:\f\362\020"
+	.string	""
+	.string	"\250\302\003/1\260p\325*[\320X\212\210\256\256\345\306\345s\350\216\200i\006\017\364Z\271\253"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.ipa_sra.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375 B\255\001"
+	.string	"\204\0026"
+	.string	"\b"
+	.string	"\001\001"
+	.string	"\001\001"
+	.string	"\001\002\002"
+	.string	"\020"
+	.string	"\007\003\003"
+	.string	"\003\005"
+	.string	"\003\006"
+	.string	"\001"
+	.string	""
+	.string	"\013"
+	.string	"\003\f"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\004"
+	.ascii	"\220\242\265\213\364\022\306\006\260"
+	.text
+	.section	.gnu.lto_.inline.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\275\005"
+	.string	"\022\311\034&\220\245I\007\177e\\T9\375N\357\026\230\377\036\251\331g\021\023X\212\335]\236\273\366\177\375f\377Wkv\313\235\002\377\342xFZ\271\377\203A$\230*\312\006\240+\230*\352\204\025\207|[\307\311\177\302\207\007m\001\236edq\341\337:\2046R>\032\236\361\021y\201\266\321\346\360\354\031\351~\204\301\271.\361\213\006m\r\244m[\300\265\255\342\013[\023\033"
+	.string	"8\007q\0256X\327I\212\\\212"
+	.ascii	"E\201\030`\247\325\320\036\200v4.\314\\\343(\304\\\201.\001O"
+	.ascii	"\252c\240\005X\307Q\344\250r\341&\362\240\214\266\262\2533?\225"
+	.ascii	"i\026\363|\332U\200!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"=\004"
+	.string	"\"G\027!\220)\351\267\372\370.\350"
+	.string	"\376\237\337r\276\305\236\206\217\337\314\207h\235\017\363\372\3067m\273\267\224)\037P\304\320\"\264\314QK\205\204b\261S\274\220\024r\302r\b\243\361\330){\320|\340\277\007|\tz\303\336\361\312\365\211`\021\237#\237+G\2654-\361\247\2049\026\0259\263%\020"
+	.ascii	"\240\210\234et\fP0!P\364\021\262\302\324\0357\032\215h\307\207"
+	.ascii	"/\244X\3374\003\215\321\024\322;\t\331@\033"
+	.text
+	.section	.gnu.lto_.pureconst.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\001\200\004\002\200\004\003\230\004\005\204\004\006"
+	.ascii	"\232\004\013\204\004\f\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375 \315\305\003"
+	.string	"\242\005\023\037\2605\303\001\f+\313\005J\bDaH\f\006:!\025\255N\227\372\335\033\210\255\227\264-e\n;\017\324\250\327\200\310\341\312]'+g\355z\342'S\276\224\253\333v"
+	.string	"\024\"i\372\375nm\245\023\2146\347\367\244\f\360\342\365\013\002\021"
+	.ascii	"n\004\b\002\201\250\004tA\330a\202@\200\235\031\300\\W\005\265"
+	.ascii	"\246\354f6\005\255\3019\250\271\\\027\001^F\036@\021"
+	.text
+	.section	.gnu.lto_.lto.b5957db761a7ac7c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_compassConfig_Registry.47.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375 \242\275\004"
+	.string	"\204\bk"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\203\305\341\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\374\006us\250\324\006uq"
+	.string	"\005\001\006'\001\030\005\001\006\035\001'\001\250\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/compass.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_compassConfig.48.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375`\251\001m\r"
+	.string	"\266\027WC"
+	.string	"S\234\016XZ\356\234Wp\200\317\365J\023\355\ti`\246&4U.9c\004BH\312af\316 B\016U\340\025\276\006\271A\354j\322]\306\363$\335\005\021>\350uEP(\016\364\243\330\206\366N)?"
+	.string	"B"
+	.string	"F"
+	.ascii	"_\215.`\367\224#d\227D\340\003\225c&\237\251\307*\037P\217\031"
+	.ascii	"\264y\234D\355[%\020\256rw3\232\342\340'\350\377\305-\242)\374"
+	.ascii	"\004i\260\273\236\242i\304Mo\273\200\355\005\366t\020\266\206"
+	.ascii	"\303\370*\273\233\300gm\340\220A\2518\346\217\3521\t\245\321"
+	.ascii	"\204\352\2044_6\031N\212\302>ew\327\364d\177\365\3239}\f\003"
+	.ascii	"\262\364A\240\307\256\210\327\217%\301DV\\l\177\332W\335\005"
+	.ascii	"\030\257\301*);\027I\225\214\255\333\332C\276PGyr\317i|\021B"
+	.ascii	"\260\370V\355\317el\031\013k\306\b`\326{\244\032\370\251\r\342"
+	.ascii	"\346E_N|\240\241\375\030\0350\242\215\341.\357\230\346TA\211"
+	.ascii	"\227H\342_\r\237\355B\210{\020\300\332\306\363:\"\020\247e^\307"
+	.ascii	"y!\217\227\205\266\016(\323:/\333h\314\211<]\226\201\343\272"
+	.ascii	"\354B\356)KO\206\320\202\204D=\3708nO\370\b\307\264\243\344T"
+	.ascii	"\233\302opB\223\262\302m\244LF\013\001\" \260\202\2219\3633e"
+	.ascii	"\221e\017,\255E\013\364F\035Y7\246\016\330\371\335\315\375\335"
+	.ascii	"\315\341;\304!B)\317\230&!+\247\001\022]\302\001\355.zD=\342"
+	.ascii	"\b\316\264\032*\3302\355\220\307\234\330&<e\006\333|S\300./Z"
+	.ascii	"A\006"
+	.text
+	.section	.gnu.lto_compassPreInit.51.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375 \302%\005"
+	.string	"r\311\"*\200k:\300h\030j\201\022\031\3165\250\003F\366j\001\360\177{\331\277\247\267u\021\255\031\302T\340[=\2030!\215\342\336)\005\256\246Z\251\354\232\225\254tV\314\252\022SP\227\254h\225\323\3003\263\250\\\314I\245\364\355\243W`\304\206\375m0F\354\0036z6\214<\033Bf\367\021\002\255&\200\241\330\276d\315\356\374\233\354-\034\307\345\263\2732J\256\035j\376+\027p\335v\030!v\327\220\353 w\274m\203\355\203\355D\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_compassDetect.52.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\215\007"
+	.string	"\242N56Po\322\001 n\013\0020\004\227\007\300\r\350/\3041\330\346D\314k\020QC\220\013g\323k\233\351\003\233\020T\025\021\005\f\235eBg4\326\271\267\214v\333;\245 L^\230\204g\242\n\240\220\021\317V\207\322\352sM+\322lRL\322\210y\252+Z\031\215\235\002\317\217\314\"h\316,r\352~\243\f.\036\206]C\356u\330\327\354\356\372\221lw\016\323)\006BeW4#\263&\310\022b\373\2665\233c\373\325\n\230\005\347\354\227\274\244\335\304\342\002\273\244\322\312nUp\302\346\320\365\004\324\341\346\003\324\241m34h\336^?D\007!\311@9\355\326\370<\276\335m\376O~0\322\342\362\2222\n\335\001<\354\256\235\306h\343~\267\215`\333\301\266H\n"
+	.ascii	"2\003\202\341\243\302f\025P\270\f\b\n\301e`$\001*\314\353\232"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_compassInit.53.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375 \376\355\006"
+	.string	"B\21505Pm\222\016d\254\210\006+\213kOug\027(\"F\377\226_eUN\252\033\332\355h\243\356l\335\301\277\331\314\021\313Y!5i\013\214X\3603\344\206\b\221)W\226\0301\034\215U\301xYq\223\211p\303\200\321\300\352\212\320B\260\305\311\\\260\301\262.X\331\262b\224/\331\373<\351w\006\357\320\220I\003Zf*\334QA\036\356F\251!:\256\240R\267C)U\217\272\021F\007\305\207)s\247\337>\356]|\001\362Y\374kE\311d\262P\222\031:\235d\211\"\341\370=_\031!\3013\326M\013UcDB\304\224\271\301\227Q\254\016\273\002\242\210\272\200Kf\356@\242\211\376\372\027\374\007\277\026\t"
+	.ascii	"2\003\302\360\030aF\035\302qM\314\212\300D\210\034\356\334m\213"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_compassIsHealthy.54.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375`e\001}\f"
+	.string	"6\327P?0m\224\016KaTY\353\370E?\007(Vt\254DS4\202\330\301\243L\243B\225\262\0203\330Ova0FZc\276\325\217bd\004G4\354\335Zw\246\363\221Oi\030D\366\336R\246\024@"
+	.string	";"
+	.string	"A"
+	.string	"\242k\035\032\247"
+	.string	"\001#\004\305\256\026u\302E\207\317i\212|\n\363N\200\370P\312\260\303\215\277\007\351$\331E*\200\314\201\243\354\356/<32R&\205\331]g)\213pS\267\355\261]\261\357\021\025\376\334"
+	.string	"\224/\375\371 \370w\235\224\030\031\345\311\326\260T\016\373nw\327j\262\235\206\232v\231\326Lg\246O\t\330\020\241`\333\3258\251\330\020o\304\202\355\220-\261\201\003!\007j\322kx\007o\027\341\3609\310\206\333\003\374S\275\210\336\245\246\204\002\017\361\026A>\226\217\324\370\334]L7\002W\035\361a\342\"SX\256y\233\220\330\335\004v\365\f\237"
+	.string	"\035\273\213"
+	.ascii	"\303=.?\326\\\256+\343\341T\232xY\325\325\331\\\261\263 \303"
+	.ascii	"\211\032\353\212\227\001\256<\033+2\250*+J\264\275[59_\345\351"
+	.ascii	",w\232a\033*e\244$;\205z\214\025\243<Y@\345\200\252\355b/  \340"
+	.ascii	"\002\031\n\316\003\013\031z\306\031\336\313\"\003.\307\204\346"
+	.ascii	"\021\270\344\rV\356\326\214+\275\353]\022\272(\263q;\345\224"
+	.ascii	"k\324\030\001v\3343\201.\032m\346\341\2353\260b\203\214\357c"
+	.ascii	":N\262\030\352F\371\351\355\312e"
+	.text
+	.section	.gnu.lto_compassStartCalibration.55.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375`\001\002}\021"
+	.string	"\326\337pH\320\322(\035PgY8\t\272\351Cm\003@\267+\n\227\203\fg3\250\n\263\3223\244\265\325t\362\273T\373\006\034\325\244zfj|\177\365\201\214\346\360\202\273X\333\207\nx\305\372\272\032"
+	.string	"Qc\rn\214\354-wJ\001X"
+	.string	"Y"
+	.string	"b"
+	.ascii	"\323"
+	.string	"'\243O\0047\300}\312\023\340>O\262\313\326\361pf\317\323\201\203\216\217\335\355\324\204\3652\274et}J\215.?D\245\346\tlE\240\354\365)\007\354\256\210l\203L\2111\262X\224(f\327\207W`\253\201\262\331c\210\312\356:\2022\0207w\333-\333)v\\\tJS?\347+X>\215\275\227\351\277\374\200D\260x3\027m\013\030\342\301\253H\210\022A1}\331a,*\315\376We\354\322qn\251\321\032\243\343\243/`\304\346F\204\242]\017\267 \0334}N\034\347\366m\374\320\244\337\\\205\3538\376\031\275>\214vxD\354\330]\223\0073L$2P\007b\334'\345\225\225A\242\250\252\362\007\306F\315\265n\346\301a@(\021z\361\036\t\236\300\022\017\262p\237QI8z~\370\300\342\315\276\211\263}\341.L#B\273\333\300>\275\005j\264\273\fX|'U`fwO\363i\n\252"
+	.string	"_q\237\017_\242\323\223\202\007,\336Tw\367\245\001\237*\303I\032\205\362}'\027\226\207\352\276\226\367\265\244\276\256Eubu\250\326\327\241\220\330sI\265\272\n\236\327\352H!\354_\225\361k>\002\272\t\202il*\315"
+	.ascii	"\206\264\244:\024M.5f\301\245\276G\316\220\206\b\344rwW\236\\"
+	.ascii	"jI?\302V\203!\021\253A\003(\345`\365\231-\207j- `\202Q\252\316"
+	.ascii	"\003#\241\227\022\203A@3\265\213VK`\005K\332\003\331c\321s\260"
+	.ascii	"\007\027\270\004\310\340\356p\274\214\005\2459|c\221b\273\026"
+	.ascii	"Cl\035\267g\200a!z\t\356M\3024g\006\334\333\032\331x\321\375"
+	.ascii	"\274%i\270\234C\276\235\221\002\3559;\301i\345\020\242gF\343"
+	.ascii	"\2067X\331\333\032\360E\271s\211'"
+	.text
+	.section	.gnu.lto_compassIsCalibrationComplete.56.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"R\315/3pk\322\001\220\365\377\003Hq\026\226\333`<\312\270\315\206\375\255\023B\265mh\350\230EW\331\342\331\322\371\252~\343O.\213\006F\004\004\216\204\020)S\n\266*\b#\225\211\263\032|\016R$\260Q\026\"\223f=\330\252\001\273\212\3445\006\347^\243\342^?\252\004\032\335\330\267LW\325s\262\315/\216a\361)\334p\311c\227\374\313t\351\032\360\240\311\220\0353\251\021\366\243\335]\353\307vZ3\375H`\343CAc\267\023\nY\017)\253\260\215\261)\037 `|=\202:\237"
+	.string	"q2@vcS\211_\317\313\277\305\243\254\203\003\363d\236"
+	.string	"\t\273\353\304<\016\267\336v\201m\003\333\020\001\b"
+	.ascii	"2\001O8c\216#D\250@\346\032\275\204\310\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_compassUpdate.57.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375`Y\fe6"
+	.string	"\212Z\270\023E`^R\00730\007\305\251D\353\001v\324\261\203\327+\231\260i"
+	.ascii	"a\026N^\211\311\304V\255y\221\262\201\036\345FN\275\305\346`"
+	.ascii	"\343\005\033Qx\212\313!\266\036(\304p"
+	.string	"q\242\332CZ\362K\354\336;\245\224\002)\001\t\0010\001\354\356\334V\306:f4\330\271w\305t\317\235[\343\2004\224n\267n'\375\314\035\3458\026\274ciuA\336\254X\221\343\206r?q\302]xae<)V\326\336\334{\241ze*^\257\357c\346v\346f\322lm7\001\343\336\2758\330\262\334\013\215b\002\274^\217]d{U{\310\366\312\3342\267i\250\363\266\025\037dP\356\334{\221\317CH\344o\025\332\254\252m\017\025\211C!a0\b\b\3643\372~z\274\035\273\252\357-\367\316j\251L\031\246YX\017\375\350\242\217(iN\334q\246\326\303(\r!\255\016\016\2163\265\026R\203Ro3\\\270\263\332q\366\354\240\263\203\234o5\034\210\326@ho4\374\327\312g\033{\f)\003\342\276\0372\374'F\367\324\343\231\262\030\352\261\255\225\206\224\301p\236\322ng\205\343\354E\263\352"
+	.ascii	"49\026@32\265h&G]\267-}U\203\367^\240\031\tU\312O\230\211\271"
+	.ascii	"*\204E\177?\351\001b\340\230f,\332wV\367^v\246\331Y3Q3\367\031"
+	.ascii	"f^\300\354\213\n\322g\360/u\250f\372\023Q\315\364]\307M:\346"
+	.ascii	"yZU\t4\3233\370\236!\006n\211&\346S\376\017\303p\305(Wh0W@"
+	.string	"\247\227\376r\001C\206\fl\257\315\214\343\377\377]\226o\224>M\322\\\260\022l\361\357'-\240\313\230\2658\245O\377\357\275a\317Bohk\321:r\302u\226\rYZZ\320\306\322E\214\336\253l\346\225g\237\r\022\037\306\314[]\245\003\357\336;\305=\245\251pq\253\365\312\036\272\274\231\275rw\261\275\366\277\021\271\265&J\2372C\305\374\233\314\335\367u03\250\242\352&\335S\253\263TCivj\267\346\246v\322\314\364\316K\254\263\022\353|d\235\223\336\031\211u>zg\243w.R\235\003\2743\200w&R\235\215\357<\244:\027y\316D\236\363Pu\026R\235\205\357\034T\235\203Tg\240\352\f\364\316?\325\331\247:\377\250\316\275w\346\251\316\273\2353\313:\257\253\263\252:\377{\367\376\276\311\335\306\327\001\344\261\2346\030K\374/\2671\303\237z\342\217\030\363e\031D\314\007\306\016\375\205\303"
+	.ascii	"\313\3216\233l\257\303\177\272\272\037\241w\321\202\205\360\203"
+	.ascii	"^(\370\3023\263\262\240\237p\025)\034\2057wa{\r\372U\r\f\340"
+	.ascii	"\233\360\022N\006\364\276\007\376\036\210\204\217\271\330/\312"
+	.ascii	"\303\374N}\277\246\t\023\367\363|\366\350\351\375\356\177\276"
+	.ascii	"\227Ax\337{\347\263|\203\007\353\311\331\362\350;\355\223W\247"
+	.ascii	"\355\264iM\255\217\026\310O\267B\330^y\377\364\214\233#\347\n"
+	.ascii	"\350\214\263\373\325H\232\2658%\364\336\333\373&wK\204e\237\203"
+	.ascii	"\233\264\333\264\233\226\b\267\032\267FZ$\336\314\026\t\333+"
+	.ascii	"\373\337\202\016\317\013\036\223\257\337\320\256cs\345$m\227"
+	.ascii	"\264lG\251__\214\036\262>=m\021\254\372R\317N\366\202\271\260"
+	.ascii	"%q\356\216i\032\374\242\016\232\356\301\201(\2323\020xf\256\232"
+	.ascii	"\242s\034A\2027\223\177^\364\314\221\3700\250'R\300\260\337"
+	.string	"\344^S`\325\347\340\266f\314\3630\363\204\226\243\300\023\243~\2675\023\0352\3537\271\027I\256\021Yj\362\302V\027\227\205\020\037\266\276\276Dh\001\261V\201d2\013D\227\227\0262\371\345\225\374\260\225D~\340\312\352Bj}%\221\005\216\330\013\304\326\0272\204\227\327\027\322\007Uv\337\327\301\030\354\314)_\214\207\f8s+\243\245\341m\335*\276\300\231\023\373\260\342\220\352W\251\020T;9\021\235\236J\315\022m\351\233`!E\235\315\231\264iFN\245_z\225\216\254\2173\373\370J_D\267T\222\364G\177|\"(K4\244OR\202\325^\326\332gsI\202\364\355\345\031g\364G\337d}\212\370\021,\005Q#\355s*Z\304\350;J#[\324\371\3417c\364\220\266vj\322\2713G\350\233\354\223\006\253~\225\032\241\272\251\351\375\210\360\233M_\245\306\203EA\200\374\250Q\364\315\204\214\224\240"
+	.string	"d"
+	.string	"|"
+	.string	"\265\264\0365Z!"
+	.string	">\250\351\006H\364N\254\247(\217\366\351\024\335Q|\242o&c\354,\311H\335{\201\276i\374\342\367\0207\271\2417\276Jg\371F\007VU\216\366\211\300o8\2166\215o\264Bx\350\253\332#^\203\341\222\320\256\214h\024\277\337\372\211N\033<s7\200\367\250a4%\231B\246Fd$IRIc\300\002\021\031\252\252\003\021"
+	.ascii	"\2513\314!2M\222Bc\263`\230\n\355\030+=\301!s\304@\001\f\266"
+	.ascii	"t}\360\327\361y\217k\034\216\035#n"
+	.string	"r\246\204\222+\334\214\305\214\222F\316\373/\351\203R\022\221\260\216G\266\003<\032\240\020T\017p\303F\007\0175\001\007\n2\004\212\335P\033\304\007*\201\222\344N\205\336\303\202@\375k\367d\371z\035\307gW\335f\330A\274qD\366\bRp`S\256wk\314\\\3513\260\261\267[\344\340X\362(:\234\020\r\362\377\223\346\301\r\300\335\241wZ\362\027:\304o\277\"$t\n9\007:c\025\326\336\260G\213^\350\232X\315\244C\004\022\322\220^\325bHo\272\364\324Q\003G.\356i\021\314\342\322\373\213\233\273&\335EP\034XF3\245>\025\204\236\223\344\023\331\021\214#*\210Y\300\246\016C\361\224\274\353H\337\215bY\301\023\244\001\202c\260\242\372\337\001(+\222E\262\376[\274\017\372\222\321\253\005\326X\265\316\2760(;\265\233\222\236\232\342R\365\227\273\007\213i\t\321\034x\251\016\034\265\351\336"
+	.ascii	"\017\t<\2232\317\256\232p\276$\355\272b>8J\320\374\224\215\342"
+	.ascii	"\220\273\024\037\263)\017s\007\005O\262\032\033\240\347\037\255"
+	.ascii	"s\332\232\260\035\355\375\20170'\027\217TX\224\336\377|\241\373"
+	.ascii	"\002AWv5\225\265\350\213\b\273\"|1\3419\017g\365\017\td\311\006"
+	.ascii	"\233,5\326o\301\240jW\241\317\267\340\311\300\3162:\240\340\325"
+	.ascii	"8\001\304\254\374\025\256\277\326\212\017\261(Y\362\230\212\001"
+	.ascii	"\b\261\343\300\3219\215}\254\256\253\330\200\257\r\257LuX\306"
+	.ascii	"\317\205\323\213\372\013ug[T"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\305\007"
+	.string	"T\013\353\001"
+	.string	""
+	.string	""
+	.string	"\0020\177\033\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\0023\177\034\2004\177\0355\177\036\005+\020\201\2046\177\037\2007\177 \001\005'!\200\003\005,\"\005(#)$\200\003\0028\177%9\177&*\023\201"
+	.string	"\0051\025\200\003\0052'/(\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005-)\001:\177*\377\037"
+	.string	""
+	.string	"\200\200\200\001<\177+?\177,>\177-=\177.\003"
+	.string	"\022d\003\006\023\001\001$\003\f\026\330\307\302+\001\344\006\003\f\025\250\270\275\324"
+	.string	"\001\304\007\003\f\024\200\200\200 \001\304\037\004\f\200\200\200\200\001\001U"
+	.string	"\035"
+	.string	"\255@\344f\030\240\036"
+	.string	"\034"
+	.ascii	"\034>@\206\277\264e\t\206\313\357TC\200\314\3004\260\006|\343"
+	.ascii	"\n\257\201\0355y\024x\bW\001\201\276\300\016\030.\310\301\006"
+	.ascii	"A\003z\200?`\270@\206\313\3161"
+	.text
+	.section	.gnu.lto_.refs.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375 \263\005\004"
+	.string	"\362\312\035\"\200EI\00730\00330\003s.\"8\030\330\261\243\330?\"\342B\373\255\3447B\biD\222-S\177\315\251+\234\r\024/`O\260~ q\001\306\003\330\003,\036Y\017\351?\322;\312\031\352\027}EyB=\242\177(7\250o\372\f\363Ko\245\335J\357\325\036\225\237\345o\271\257\335l\023\0323\255\360\304x\262x\025\277\304\004\215\372\247\317\216\316,\017\377\203\001"
+	.ascii	"\210`>\001"
+	.text
+	.section	.gnu.lto_.decls.b5957db761a7ac7c,"e",@progbits
+	.string	"(\265/\375`\225'=\265"
+	.ascii	"\212\"\021@X0\nQ:\035\036\364\357c<N)\r\343\030tD\034>h\342\337"
+	.ascii	"\244\2138\251j^\204{\316x\300\257\r\236\220P5p\347\215o\207E"
+	.ascii	"\343\312Z\0334\274:\246\216\273\032*\352\271\204!j\332V\305\246"
+	.ascii	"\022\002\031\203\236\345]\327,N\264\n\275\023\003\033\311\036"
+	.ascii	"R\246\224\002\202\003\364\003\366\003/\325\336\343a\364\325\301"
+	.ascii	"\241\341\261t\244Jz=\337\257\217\352~\250oj\266oR\360K\360\246"
+	.ascii	"\364\266\360\314\205\201o\264\337E_\370\351\020\022\203F\013"
+	.ascii	"\0261jWUT\177\237\t\30765\275\334$\334Nf\247\227w\305\353\352"
+	.ascii	"\024\360H\236e\212\226\020<\273&N\\\212\227\243?\361I\217\342"
+	.ascii	"\231\277\364F\257\342\225>\305\257p\350#\271\226\366-\256\207"
+	.ascii	"\305\353\2026\347\251*Zbt.\245\213\367@r.oB\216o\n\025\257\363"
+	.ascii	"\350\323\007`\\\356rv\266\227=\222\233\371\234\226\275;+\033"
+	.ascii	"6x$\277\363\272`\322\231Wx`%\306\230^\316NO!g\004\r\347\376\322"
+	.ascii	"\362\210\213\333\212{\345'\035\372E\276\327\336\027T\332\344"
+	.ascii	"\234e\367E\376t/\036\305\272`t)\327\025\266\245\364\266\217\r"
+	.ascii	"\251\362"
+	.string	"\345\263\3639\324\373\226}u}A\2453+}\240\022%\247\203\243\243s\034\263\362\202o[+\334\356\305\311\226?&\"dn\177=\215\247\275\213m{3\332\373\333v\t;\216M\342~<\334\337\004\367\277a\034(\356\017\3039'T\241\371\262\343\213\227*\334\337\002w\360L\354O\034\212C+\360(\275a\203\266\311\262,\226\263\263\3466\305Y\335\370\333\237q{\005\251\367y\005i\373\025\334hn!era\006j\324\004\213\223\363%\016\365\250\263=}\r\f\356.\352m\036\347Q\254\020\276(\271\3139_\320\321\2719\262\364\310\222^%3(\364x\374m7\303I\374\210#q#\016u8/\322\357\314\031\215\354\215ml\210\232\013qs\265 L\316\3155\255\234s+\240\233\247\035\316\211\270\032\006\02397a\334(\241@\257\350\345\234qttttj\216\250\246\360dn\373\022\367\017n\"\356\r\340\316"
+	.ascii	"\316\360\001\367\007\270}\315\325\274\231)\b\262\360\361\365"
+	.ascii	"\342\257\2379\232C/x\220\3664\037k\030"
+	.string	"\2453;=\017\253h\351\357k\200\273\033HO0\2277\350 \006A\316}}~!u\037<\355?nR\245'g\256\371\340\204\031`\177\255\f\356\307\335\346\026\322\f\334B\232\336\2446n\201G\267\207\271X\005\226\211\324\314h9;+\3248\233\222f\374m\247[H\261\337\244\335\236C\002x\335\257\001\204\356\347\240\373#\360\020`\352\366\016\256\241\273\2738u;\263\333\247\272\035\2531\270\004|\2475\350\2666\254Z\256\273\325\336\001\335\177\301\007}A\343t\333\025\r\"\246\333\246\350\366\001|\003\322n{\002\001\335}\273m\262\275\333\006u\373L\267\307tw\224n\377u\273M\267\303t;M\267\327t{\360\r\340A\267\343n\277\335.\323\335U\236\001\026\272\255O\367\313t\177\260\373i\272\037\330\375\277\356\217\351\376\231\356\267\361\274\356\277\335\017\363\035t\267M\367-@\367/\240\373w\272_\247\373s\272\377"
+	.string	"\335\177\323\375\025\272\035I\267\277u\273[\267\267u\373Z\267C\273\375\254\333}t\273Y\267;\273\335\253\333\271\272\233Iw\217\320\355V\335\235\326\355\021t{V\267?u;V\267?\240\333\005\320\3554\272\035"
+	.ascii	"\335N\325\355\315n\217\321\355R\335\036\325\355/\272=\203n/@"
+	.ascii	"\267\023\240\333-\350\366\f\335-B\267K\320\3557\335-\326\335"
+	.ascii	";\335\r\327\3352}}}}\335\366\203\356\337\206n\001P\020II9?\341"
+	.ascii	"$e\251\244\020\243\234\037mJ\333\022\363Y\325\344\021\362\343"
+	.ascii	"\251\225O8\223\256\225\245P)\341g\222,#]\301ZK,\362\262\2406"
+	.ascii	"\313\275\344\344\314\224!\214\211\022\006\035\363\204\325\016"
+	.ascii	"\265X6F\f\363v\365\335}\225'OO\177;fiF;\324\316\2604r\2349\211"
+	.ascii	"a+y\365\246\227\225\2360\250Y!\265D\361\327Z\005\2714\371\341"
+	.ascii	"\254\303\215\351r,U\314\322\231\2373\312\2465&Q\031\355c\005"
+	.ascii	"X\337\220f\214\037S\222/j\247d\264\316fD\031\301\335\026\306"
+	.ascii	"\233\301\230%\001SJ\271\227#\214#z\037\365B*\252\004\322\302"
+	.ascii	"6Y(\313\302\272\260N\366\31129\324\276\370\253\266Jv\251q\204"
+	.ascii	"\330\027\377\365=\362\202\360\330\023\366\bK\217\273\327\263"
+	.ascii	"Frhb\366\305w\245\211\331\027\377\343\267`(b^7 \237\202}\361"
+	.ascii	"\\j\237\303\276x\347\3738\002}aQ\330\025\030\212\230\371\236"
+	.ascii	"1\251r\373\212\241\301#\352H\0047\315n\341&\265*R\340{\322\220"
+	.ascii	"\262I\026I\306MJ^\024\233\242-\222\325Z\322\266\245\306\214\234"
+	.ascii	"V\n'l\231\301\0327\216\310\370\333X\211\373\307\207\367p\354"
+	.ascii	"\331r\307\333\245C\255\211\347\202fM|\027[\004\244\255\257\205"
+	.ascii	"\336L>\342\"\344\026Y\245\n\025w\314\2776\031\243\244\205\013"
+	.ascii	"$k}\016\265\271\355rdp1\375\355,\377\345\257\236X\351\362\245"
+	.ascii	"\237O)\237A\375\335\373\331-\315\225\211a/\317E\206\322\311\322"
+	.ascii	"\016\334\277+\334?*-O\205\207\323\217\277\375k\302W\036\213C"
+	.ascii	"?\313\007\301\311\362g\017]\372\321\335e\371\264\307\363\350"
+	.ascii	"\223M^\332\361\335\371\217\267/y\351\235{\273\277{+\237\347\320"
+	.ascii	"\307\353\307{\265\177\013&+\344LcO\013\357\215|\224)\265\222"
+	.ascii	"\257t\351]\320\321\001\"Y\301H\342[\345\353\034\372vO\005\312"
+	.ascii	"O\361\350\22333\005\2034\257t\351\331}\223\177\202\241\210\031"
+	.ascii	"\002\021*wxH\026\221\032\351\355\037\212)t4G"
+	.string	"l\\Q\242\274\024\031\027OQ\"_pw\224v\025[&\340\262\340\272w\322v'(i\342q\207;\245\303\235>\301\255\200\350\037\3718\217\242u\220\263[\362L\034\372\321\227\273\321_\363\272$V\356pt\2028\270\302x \301W\307\362,\356\357#\371$\016}%\017\227ih\354`\024\351b\303$~]$\355\024\rw\372\304D\276\210C\377\355\207\3408sN{{\266w\303P\304\3640\325\345\356\355\327\2008\264\256t\341\350\350\374f\270\365\310Jo\247P\270\373\335\204X(\246\332\236\023\306\310\223\023\033m\037\0048\005E\266\373\333)\023\356\024\005\3564\211\033F\0177L\025\264\007RsF5\3665\207\006\223\0047\314\220\177z\023-]\216\236\370\311\276\314\241o\326\267\254\231\2379;i\254\262)\216-'\255\361\234\264at\214\341x\227\211\036]UX\314\241\317\343w\360x\260\017\013.\2359\311"
+	.string	"\245)Z_\036\005W\264\344\336\260\356\367z\035\037\025\323F\307\224\343o\303\030\341\276y\270o\023\374M\267\220\032\300o\322\f\212\340\276j7[ZNE\227U\344\257\326\343"
+	.ascii	"\026\301\"k\221\325\217\303\306L\316b9g\f4\3159\257\263\277o"
+	.ascii	"\343\037\205\277\321o\343O\230Y\276\215\233\263\322\335\202\240"
+	.ascii	"\273\0050El(\315\322\333\367\f?\215\257\301\364#\312\254\201"
+	.ascii	"\205\347\216\200\250\375\355\307\372\253\356\2343M\2208\275-"
+	.ascii	"c\270\263\274U\f\336\223%XVj\327jk-lF\364\233T,\233T\315\311"
+	.ascii	"@)9]Q\345\320p\201R\364%cjf,\316,\255\351\235\\\310O\375S\263"
+	.ascii	"\005cr"
+	.ascii	">\242D\353\247\376\305Gy\024\355z\3015?\206C\177*Hx\177\357T"
+	.ascii	"\027y\212\242wuaX\271\252&E\177\357\213\033\345\320\206\273R"
+	.ascii	"\035t;\001\004n\n\356\020x\303\245\327\251\357\223\333\224\025"
+	.ascii	"\325\\Sw\314\017\n%J+\016\367\314\033\356\276,.\213g\221c\223"
+	.ascii	"s\325\222\266\031(5,Q\314p\373\016\267pm\353\034j\341\356\022"
+	.ascii	"OQV\356\310\260%C\n\003\213\265d\"\366\367*9\227\312(P\220x\341"
+	.ascii	"v1<{e\254\212\305B\305\213\345\363Z\362k6Ol\212\275;\262}\327"
+	.ascii	"hMo\354\036\331.RR\334\025W\305E\272\314\213\342&9\364\036\331"
+	.ascii	"/m\355\254\225\306\271G6\213\345\342Q\254\b\210\321\335\325`"
+	.ascii	"\t;s\262\271\026\257\353\306\354L\334\023\016\275Fh\327\350\273"
+	.ascii	"\334%P\r\257I\013\275\013:4yN\244D\245\267\373.oQ\232\363\352"
+	.ascii	"\312\337\253\374=9\301\231h\302\016\275I\234\345K\210\227\256"
+	.ascii	"\003\032\311\252\232Q\302=S\264\207\237\334\301\220\343\303\r"
+	.ascii	"\344\202\033\230\207\255\026\273\305\241\027X\275?\201\017\210"
+	.ascii	"\031\035n\277 \265}}~A\332@'\270\201K\256\330<\230g\022,r6\257"
+	.ascii	"\256I\034R\021\034\316\220\3437\251\245\263Tl\225\356\230\032"
+	.ascii	"\2606\032A\206\340\266SF\310Z\022\344\357\365.\222\332(m\245"
+	.ascii	"\300\341\320JZ\303m\237X(\3351A)7\200\220\375\300m\235\300\004"
+	.ascii	"\351\303\002\365\3276\301F\300\257\013d`\254\305\260M\272m\234"
+	.ascii	"\225\263s\034\370@\037\337\226\2776j\231\264\235\263K\262\235"
+	.ascii	"\323\240\231\263\322\316\325\354\345\254\254q\267\300\335\202"
+	.ascii	"\013V\205\003\232\336\006r\341\226\342\026R\032\277I\037\212"
+	.ascii	"\247\255\022\240\334\333]\017)\334\326\210[$\016\265H\274\016"
+	.ascii	"''\3632\204\341\001[\340v\257#B\304\276\331\270\243\311A\304"
+	.ascii	"\306\230-\322\366-(V\344\216K\225\260H\226\336\337\006\032\271"
+	.ascii	"\271\345\210\361b\263\223\242kk\3639\257\220\363\f>\255$P\273"
+	.ascii	"\346s\226\031\302\336\336\235L\2204\207\332\264g\341T\031C\251"
+	.ascii	"B\341\3118\2747/\334\026\315-\324\241\026j\253\2563/\311\340"
+	.ascii	"\330rb\3202[\270\335V\245gg\326\313\237\034\020$\351.\030\346"
+	.ascii	"\204C\203\362\341\303\232\205\260\225\3741Q\264P\362\267e\230"
+	.ascii	"ee\326\314\241j\250\300\226x\231mqU!\355}}Y'NZpR\2672\226\036"
+	.ascii	"m\235p\\|\304\375\265bv\f\001kKGv\314\362H{ \361Jb\247bN\\Q\265"
+	.ascii	"\260a\035\300\342+\n\003\343C\242\265\366\317\356\236B\246%\356"
+	.ascii	"\257\335\001|\206)\267"
+	.string	"\330\345\310a\275\034\260t\365\366\225\237\244rbd0y\201u\226\266^0s]7\240Kp[\024\254\215\2667\372\206\345\3029g\234-\262\247\247\034|\325\204\002)\205\266\\5P,nrv\353\273\262\272\330\331-\253\205#\rm\371LOiEe\177-\016\3272c\027u\262;\303\335\337\235f\245R\316\231\t\306\231\225\212fR\207q\317\351\246q\353\004\310\271['\0049+\215|a\301\\l\312\250\f\271a\2429/\251\222\021\240ZZR91\237T9\271\274\221\254\240\224\251\222\314g\316\025\362r\231\354\320\314\025\230\317\274\224M\314-yvR%\363\262\231+\344eVf`.\251\226\230O\345R\005\346\223j)?\251\262M^*\225\216\226Y\251B~R\341\345gs\311\206\371l.1\237TY\276vt\302\030\323\333\227\025\n.\203\271\314*\222\244\224J6Q\246\263\231\245\344\354hFY\211"
+	.string	"9K5\225\244(\235\274\255(\252\242(M\331tgRQU3/\243\314\256f\316]E?9I\203\2443\232kx49C*#\031\345\f\200\244\234\223\236\2439\347d\316\371\247$\345\314\371\205\rS+$\212\307u(\202\004=\307\241P\b\003|\030\0261P\302\004\375\243\201\030\200\022\"\212\253\320\b=F\020\324\021C\344M\377h@\n\035\211\305\240\324X<\256\310\035\265\207\b\210h,\356\034\221D;\023"
+	.ascii	"\001\021\031\215B\306\337*LM\020:\376\254B\306\237\210\241\n"
+	.ascii	"tW\025\031\244\006\245%\206\2048D\260\366\217\006\237\241\035"
+	.ascii	"\237\241\033\242\221"
+	.string	"\bx\204A\ngV\241\321g\b\306\3503d\177V\037\243\n\224b\365\003E\344-1$D\274\307u\310\366\250\277\036\025It\211*\362\327G\241\317\220\006\232\343\360\207xK\034Wd\321G\3750\201\272\016{\206.\200\304@bh,\2120\024\244\202\bRWd\211\022\204\022\\\016\353q\270\226@A\211\237\025h\250\206\200\364`\003\\\211\352\252v\240Q\217$\004\205F\n\254*R\375\3403DA\023\213G\325\250\372\340\326\200\203\004p\320\001\211_w\340A\006\036d\220v\007\036\360\360x\300\001\017n\016x\254\t\303\0171#\324\016M\364\031\006\331U\210\274\200\032T\\\361\332?k\321\350a-\032\213\367\270\222@4\022Q\240g\250~\360\031\212 A\317P=\336\376\321pT\201z\214\303\020nV\243\210G\n\211\352\007\017\020\207!\200\200\206\034*\024W\022\352]\221\302\342P\t\"\324\016B\017$\224"
+	.string	"T\211\306\341\2124\026\361*\264\200\207k,\222`D\022\323\342\020\322\"\205\0346x"
+	.string	"r\330\340!&%n(Z\242\020;\310\243:\242x\354\271\200\024\212`sTW\3440(\375\251#\206@%\020\r\005a\"!F\n; \211B"
+	.string	"U\241:T\002\004\222(D\314o\204\332\203$\n\221\252\302\340\372\263\016\203"
+	.string	"\020\344H\241pH\304\r\211\342q\035\212\260\n\035\203>C\020\305\225\304\004V\243\007cqX\001 !!\t\ba\220\302\021j\007\237a\020F\302p\350"
+	.string	"\202\3170(\355@,\256\252q\355\237\n\326\376\321 \024\024$D<"
+	.string	"\221\260\002\bAB+\222\210x\203\024\372\024E\030\2058\324\030\213@D\265\307\250\006\031}\212@C\032\36584\241\3478\374\231Q\207J\254H\242\020A$R=\366\364\f\205\304\r\305\232U\330\301j,\022\375Tbq\204\332\0234\"\211\302\342\020R\3503\f\002\256B\237!\b\241\342\317g\bb\035\":\036\325\325X\234YE\250=\027\372GC\005-4\244\036wV!\241\343\016\260G]U\240\241 !\016F\241\342:<\206(\002\r\211\022 \003"
+	.string	"\004$t\274?\304\2658\004c\302\260\204E\252D@\303\021)\221\020\031T<\202@\022\213ACc\211\016\353\217O\021H\204\205U\310\001\317j,\376\232\207\207C\206\013\214P\001L\324\200D\016\207\202\204\210;\310\243\020\322\250\"w\214\305a\320\016\361\210\334\321\200\301\204\341\321\n\035U\r\370\f\203~f\326\353\002\201\302\252*\2738h\366\210t\301B\366=~\fL\314\351\374\250\337X\022\024\263\207\2162\245,\"cUJ\312\366\336x`\271\224\031;R\210Y\032@\\\030\375\3700\253h\217\276\032\027\354M"
+	.string	"\251[\241vwp\241x\352@\341\357Vo]\035m\227y*M+\206\206\235\r\"^}u"
+	.ascii	"s\\\021\342\374{s\364Z\334\333\227\251\333\365\323\203\213\362"
+	.ascii	"\272]\227\253.\372\225c\354\215-\013\335M\341w\334'\03048\205"
+	.ascii	"\002\n\027\007N\323\322\t\261\222\3675\303\246\344l\356\336\350"
+	.ascii	"\213\303\271\252\300\260\362\367\332\350\265\275\243\2706\257"
+	.ascii	"\253\322Re.+\313z\341p\221"
+	.string	"\331I\335\260(Il)\\u_],/\313+\3223&S\344\364r~\312\301N\\;\216.V\325\255\362\326G\243\204\333E_\250\353\342ZY(39Y\226W\374\330\220D\311\323\313\314\247\034 Y\n2&\337\354k\325w\306\206\r\272\356\313\013\212\362\357\255\352K\365\024\347v'\343Ru\307\310pY=u\340\341N"
+	.string	".kZZ\372{ct]]\203C\250R\261@\307\002\2352H\241\021\231\031I\222tb\n\020\004\303Y\034\3071>\022"
+	.string	"\025E\216*\310\f\215H\222\024$\255\001_\211\211\312\263!\326Y\243BB\342\f\006\211\341%\2311\351Y\236\270E\271I\2351.\r\252#\216\022\345\007A\233\260|G6\213\224\245R\311\236\200\375\360\312\215\260\311\344\370\r\336\240\274\225\325\270\007\366C\227\352J\321m\264\030\017\177h\021\303\356!)g\312"
+	.string	"\023D\003U\b\310\210\2248\200\356[\332\221\002sY\377\350\211\030f\230c\272\253\t\030s\305\016q?8T\340\200\210.\0201\006\261\264\232}\320\037\333\215{\203N\n\254]\270\356\212\306xP\017\374B\217\034\362h\325\231\376~ \231\220?\346\236\022w\222\356\226\220\017\342\226m\030\332\305E\365\320:<\036]\350\227\272\304\016\262\030\242\247\307\033\024\025W\253\032\211[@\335\3258IN\0253\263\317\310?\236S\362\317\035\373-!k\354Y\360X\341H\306"
+	.string	"\036|\2275C\320\230]\351\002$\021c{6\271\330\241\300\345\301^\272\254}\027q 5\214\230-\021\341\323i\206N\345`\347\035D\344<\214E\005\034\227f\263\032X\r\017\203\2043\177x\034\003w\267\272\025\002\336Xo\272\254d\3018/o20r.gT\002DkX\323D{\265\273\205\320\200\335\325\202\032w\301\r\310\2143\020+_,\3603\277\f\360l\3704e \245\243\201\007\031zI\331J\370%\030X\034\021\217-\002\214\004\351\222\005\367\337\302\305\250p\016\343\304c%\240\f\200\214[\025\036\325]/\317\256\335\347\205h0YF\344\331\334\313\026\354w\002\250\303I\253\316:\006j\003$\2242\327\025\2379Y\323-\213Q\032\323\333\316\304(\240\0201%\002gn\302\013\235\315\024\300\377\200\331\210\302\264\031\256\377"
+	.ascii	"/\006\034J\375\277<Q#V?\214KZ\257\335X\352\244\323\320\005\\"
+	.ascii	"\273\345:=\315\224p\372\335\370\007\227\214]F\002\0043\315^O"
+	.ascii	"\245t\335\262\370\364KYA\351\362\3155\272\246.\342\264\024\007"
+	.ascii	"\321a\330\306\b\224\203,X\035\004\365\\\201\332m=\031\365\243"
+	.ascii	"]\346\001\017_Y\350~\262yJ\001\265d\222\230\315\023\205\341d"
+	.ascii	"f\234\344\035\210"
+	.string	"\002E\303\340(\316v\215#\b\244\266\370\361\250\326\017\033\245\320\255,b\206\0028\347\341\240U\0339p\004\376\346\335.\270\325\177d\240\352\202sc{\013\030HHJ\362\224\314\207\312i\326\351\320\246X\217\241g\324e\323w\261\271D}\225E\027\263+\305\342!2a\020\326F\3501$(\213~\232\236\273\266\350ja\275})\035\263^\217\266\222\235\341\276k\231\255\376\330y\202V\307Qs_@\235\247\377\347+|\036\rW\354a\225\222\252Ry\214\274\036\366\004\201B\315`\210\003v\251\210B\313\210\342\203\316D\032\222<\356\313\177yR\036\364{z\f\nxZ\002\003:\360H!A\001y\313ye'o\031#t\321y \252L\327\016\240i'\fO\201\247f\341 e\233\004\204\365b\246\335sDK2\352mQ\320R:\n4'\257\341x.\242\004\305\335\231\313\260\036\356\244PC\360\222\226\313J\330"
+	.string	"q\370[\220r\222`\273\b\203N\361\215\035\376\260\205\343%\335e\242\226j\343q\030(|\273\327]\202\033`\001\036T\337>C\251\217\032\203o\234\372\312"
+	.string	"k\206\207\373:\362y\273\316\202\177\361\004i\254N\345QC}Q\274[D\020\207\005\205\275\301\210jEa\234J\001~h\276\304'X]\0059 \360\002?v\b\300g\362\364\322\023\330\230\364P\3504\bv\347"
+	.string	"E\243~\326v\250\322\3235P\200l\361c\210T\240y`\240\207Cd\355\240\231\017g\250:\370"
+	.string	"\367\016\243:\367\265\003\315l-\020K\376\260\333"
+	.string	"\310\003\251\314C\302-k)\216\0326\006\276\020 RP\2364\016\333\312A\200\252\327wp{\201.|\223\332W\330\266?<\203\222\343\344\"\030\366\314\243\331\331M\300\024\243q\300\313m!\254\270\251\007\310H\200\221\216\314%\261j\305+\023\334\250T>\343\251F\325|~\026%\237\020\302C\241N5\234\026\232\342\021[)\251\357\003\320*^G\370\0231\3765\224\260\246\026\364A\225GB\225\371\241\273\337\003\207g\025\320\"D\026\232r:\367\330b\360\205\241\341.,\203>\245\315D\262\fxT6$?[%c\r\006cp\352\002\330k\213\007j;N\350NO3\314\275\200\222\311\260\332\036\251\227'X\364"
+	.string	"\333\264m\f\361"
+	.string	"\201\031Q\3663\037c\016\242\367Q`\367\341\267\0033\327\t\016\036\250\004F\327\310oK2\371a\246\350X%0\004\177F\206\352(\323\214am\310\340\301\370\277ub\225$\220\240\022\263\302\321\202o\r\030\310\347\231\250\370r\343\264\001\325\316pD\002X\3614\266\366\334\351w MZ\005\2665\2778\334h\"\261+\246\006\3541Q\313%HO\3110*"
+	.string	"\234\003U\330\225M\313\374N\375\217e\221\336Pf%!\364\201\013AJ\211\264\n\320\276p\016\222R\231JTf\021\016m\252x\304}\312\361^e\024Q\337E@w\n\023i\3532\222M\201\341\315\240\204\034\022'\336\031\234\353\361x\375\025\0368\374\250\316jm\367\343\205\336\263\"\231\336;\215\016\033\021L\005_.\t\303\353\344]\342\001\375x\343\200~\017\354H\3365\354\325\260Q\260\276\217\374,\\r\301\340\274X\020"
+	.string	"& \325\233\036v\025U&\256\370A\210'\352\225#z<\213\215\257\006H\323\243\265\025\372e\202\270K)\250\351h\225\021\345\360\2778\241\327\205\262\356[\211^\265G%\250u\222\303HD%Fh\374\0331\334\266\327\377"
+	.ascii	"\314\376xFp\366\200\366~\270\254\330\177\342\357\021[f\366F\376"
+	.ascii	"\2423\217\330_\220\033\004\251\237\274,\331\254s^\027\226\356"
+	.ascii	"\371\206\274\223\311\233\340+4\3139y;\177\203\263#\337.p\372"
+	.ascii	"G\307\036\216IO\275+\304\367\356u\303q\313\356v\r\305\237\370"
+	.ascii	"\037\342[\245\213\313\307\220^\227S%7\2331\304\177\274l\2657"
+	.ascii	"6\266U?\315\305A\"\243=\317\357\276\277\210rX\356_\276#\221M"
+	.ascii	"a\373\352\212^\364\007\017\241\227\032\267\002"
+	.text
+	.section	.gnu.lto_.symtab.b5957db761a7ac7c,"e",@progbits
+	.string	"pgResetFn_compassConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"compassPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"compassDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"mag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"compassStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"compassIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"magDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"compassConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"compassConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b5957db761a7ac7c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,844 @@
+	.file	"current.c"
+	.section	.gnu.lto_.profile.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\235\006"
+	.string	"d\tB\001"
+	.string	"\026"
+	.string	"\326\214\251\333\n\n\002"
+	.string	"\002\001\002"
+	.string	"\002\002\001\240\342\234\212\n\002\246\201\307\205\t\006\002\003\267\235\363\261\017\002\002\003\002\004\004\006\007\250\335\362\322\004\004\002"
+	.string	"\002\005\b\260\355\222\212\002\022\005\003\002\003\002\006\002\007\013\233\346\244\226\006"
+	.string	"\f\242\233\362\205\b\020\002\b\002\t\006\n\002\013"
+	.string	"\002\013\r\016\270\272\250\266\013\017\215\232\327\322\003\030\020\315\232\225\331\016\021\022\340\207\245\357\f\023\262\235\221\362\004\024\025\026\253\327\227\253\013\027\231\366\331l\030\367\343\320\264\b"
+	.string	"\031"
+	.string	")\"\324\334\017\2615\355s\350\203\001+\004\332(\f\317\276\304\241\221\235\f\b\260\312kb:\354\326\316\324"
+	.ascii	"{@\310\340bfg\236\322\330\243\304\007\224\375\313\rvy\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375 d\365\001"
+	.string	"\024\002X"
+	.string	"\t"
+	.string	"\001\001\002\003"
+	.string	"\001\001\007\001\001\b"
+	.string	"\001\013\f\004\001\016\017\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\013"
+	.ascii	"6\t\026j .\207\254\n\353\214\241\022cf`\232w\250\f~\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`E\001\255\t"
+	.string	"B\01722`k\323\030\300\203\205\301\217\241a\b\b\213\017\016\002\037\r\035\251nV\247&\240\213\253u\223\300\224\001\257\002"
+	.ascii	"g\251\037\007\342\020m\374~k[J\231\002o]\360G}\304\235\216\222"
+	.ascii	"\013\r\031\007\305\222\243\343\001\202\340W}\276\212\222\030"
+	.ascii	"\233\b\215\376&\277+5>\235\t\367\304\362\022-2*p\312\355\007"
+	.ascii	"\300,\2322a\210!\263\361\221,\020\360\357v\031\265\253vW\272"
+	.ascii	"\251\344\354n\001\224\210\217\024(\345\206\225H\312\r\335Z1X"
+	.ascii	"R\330]\313s\216h\271\351`<\022M5\035\214\207\372a\351\240\037"
+	.ascii	"\217\277\276u\231\334\326eIs\327\242|EP\211\335\035X/\335\335"
+	.ascii	"\325\214\316\023\362\330#\0373\275\330\335\367\220\363 . `\002"
+	.ascii	"!D\326\016\013\032o[py\025\3720\032\020S\330\332\256\210\222"
+	.ascii	"a\215\357f\322-\333c_\304\352\355\300x\023r\236\360\2700\260"
+	.ascii	"\b \2464\211\300\267\375\310\345\313\025f\237\003\213#;\346:"
+	.ascii	"\025`\321\324\bNbD\007\267?[\327\020\220XV\240\033^\374\341\255"
+	.ascii	"`\277T\321\316\356N\333pj\230B\302hUsn"
+	.text
+	.section	.gnu.lto_.jmpfuncs.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"\005\005"
+	.string	"R\210\033&\2205I\007\227/\216\330\263\217\325\027\375\252\177\265\037K\241\231\325\335\336\217-\365\002\333Z7{\370\237\250Md\222\001$\257\177\326\366\f=\345\253$\314\3521\275\243\177[k9\207\302\200Y\300e\006\250\222'\356\220\177\334\271X\232\024\300\016\201\b\364\220\212(\032h<\017\003Q\273\033\365\215\352tj\0207h&MF\246\266\227\236\004n\001\024"
+	.string	"\"F\326\025\006\323\235\202v@`\200\t\324)q\231\303L\313\031\016g\020J\r.\207|"
+	.ascii	"\027\361\031\005.\036%\030V\205\2542d\001\334"
+	.text
+	.section	.gnu.lto_.pureconst.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\002\232\004\003\230\004\007\230\004\b\232\004\013\230"
+	.ascii	"\004\f\232\004\016\232\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\325\004"
+	.string	"\222\006\025\037\220+\303\001\377\277\242\372\377\217\375_\235\276\353\246qR\256\353\272v\376P\331\337\265\277eJ\001b2\232K@}\210\303\324d+\231G\346\220\315\307\320\223\036\001\006K\301\261ml\372@\306v\013\220\343\274\330H\227k\352\242\350\256\342\304V\355\315\022Lz%\036"
+	.string	" \013\311\030\254\241!\300\0216\001@\034\036&@\\\315\013\260\213E+b\366~\300\210\341\002 \\\024\024\236\020\024h\222D\303Zp\322\262e\265\004\n\253\200"
+	.string	">=0j\022\304m\t\376\022\310"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.16c1935507a1951e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_currentMeterSourceNames.23.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375 \344\025\006"
+	.string	"\244\n\217"
+	.string	""
+	.string	""
+	.string	"I"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\257\001}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'1\270\257\005}\276\003\005\001'6\206\b{\by\301\002\005\001'?\b}\304'D\206\bw\bu\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004ESC"
+	.string	"\bVIRTUAL"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\b"
+	.ascii	"gH\315\323\216\253\266\346\231\007\310\334g\326\001j\277\001"
+	.ascii	"\024\001"
+	.text
+	.section	.gnu.lto_currentMeterReset.26.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\315\b"
+	.string	"FP<8@o\323\001XPvq\300\214\307\230\t\247\032!\031\233\320\004R\\\025gh\275\224}\315\016\365oWH\032\350\3540\214\016d\177\344\216\r\201]\3215W\372\264\355\336)\005)"
+	.string	","
+	.string	"-"
+	.string	"\237\366\354\230\207\340\236\004\2740A\355.\225\033\367\036=\377!\007\020\215@\217\233\206\335u\024\2152ny\333\007\266\027\354_\001~\351\217U\345\002S\200\262\213\221\232\331\323\\\351\270l?\332\3778\210\367\322\347\002\273_K\312n\250\340\004\353\323\341\t\252O\353\003U,$\317K6\036&\024\302m\211\217LX\273\313\340\213PT\004\200\034\237\376\247\372\234*&\222L(\246\354\020\024\245\206}\315\356\256\345\3475\353\262\3164\306\351\264\254V\017F\271\272qZ\306Q\r\342\241C\261\312Q\216\201\267\210\254\322n\333*\275\302\275f\345g\207\227SHZp?\t\017"
+	.ascii	"2\241c\034\030\027\006\\\003\016\242`1(\306Q\224h*l\310\004V"
+	.ascii	"0\357\022@\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_currentSensorADCConfig_Registry.31.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375 \241\275\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\346\201\027\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\334\030us\347\007uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\200\002?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_currentSensorADCConfig.33.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\320\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\220\003?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")C\017\240\b"
+	.text
+	.section	.gnu.lto_currentSensorVirtualConfig_Registry.37.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375 \223U\004"
+	.string	"\304\007\\"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\356\241\033\007yw\250\366\006yu"
+	.string	"\005\001\006'\001\004\005\001\006\035\001\001\201\0028sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.string	"B\b\354\345\006\320$d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_currentMeterADCInit.41.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\235\013"
+	.string	"\026\226N>\020Q\225\016+8\264,\302\313\232\241f\354\340g!\230\001`\316\357\316\004\364\204B\t\267\223\333\320\200>0\222+\025A`\261[Q\004\262\b\342\220\234 \374D\005\317:\332\032\333&R\246\024;"
+	.string	"6"
+	.string	"?"
+	.string	"\371\364%\022\226\213\0024v1\2046\266\025Y l\177b\217\035\343\240i\257\3220R\325\330]L=\334\363\364\370\027\361\310G\372<9\024\354\256\363#e\270\365\266)\266+\366-\004w\213G\345?\035\354:L\273\336?\037\365\324\346\177x4\205.\377=\372\335\343\321\356T\310\177N\023\251\226H?6\bJ\355`\377Z-\331\232\216\232\2764\255\231\016\341\f\033\002&\377E%pA?V\365\352\033\f\t\355z\224K/b\001\312\320\251\252\006D2\256\251\037\335\260\263\2534\310n\b\201O\342%\"d4\232\307\343\365\300\213\025!P^\206\216$\200\316,\234\215\306q\235\f\353\270\255\333h\035\266\311`$`\031\327a\226\001\336&h\034\306\3316\016\233\200\336\257\325\322\002\025-OA\026\220Q\177z\212\013\344\304Q0hp\2718x\020 \275:\007\030#\300\004a\026"
+	.ascii	"3\241\005)\360+z\027\310\004\f\004\311\240{i\226\005\3420\225"
+	.ascii	"\211\244\222q\003W\246\233\313\232R\255\0050B\\\345\343\232\310"
+	.ascii	"6\004\3752\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_currentMeterADCRefresh.42.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\345\b"
+	.string	"\266\220>90%\2511\200\003\250\311W2\263\204\241\020e\365^?.k+Z\214\006@\024F\332\245\344\017\331wr\255\275\3050\307 \r\252<\276\251\353\261\020S\350\226\261&\367\226)\005*"
+	.string	","
+	.string	"0"
+	.string	"\004\035\313\206m\216[\"\267kd\303\005\373?\263\020\207\216a\355\025{R\252\223c"
+	.string	"\304\377\306\224j\345fn\233\320\366\241-N\326\376\277\031\253\325\266\016\032\005\233\237#\026\340/)S\262\265ul\215\342\224\320*\246z\376\017\230\230\377\re\020\260DpA\307Rs\250L\343\363\213\313cRs\262\340\226d\027\223\301\315\177\207\232\305-\0305\211e3J\321)\313\272\324\261\334V30"
+	.string	"\250\030k[\247\230\201\264\001`\004\007\202(F\023\340\007\262\030h\350\003\2128\317#\205\346\347u\237\210\373\246\250\002t1C\3367?\007\355F\2347\301\256\363\346\326\272\265g\254Jx\274\002\f"
+	.string	"2\241\343/0.\f\270\003\214\333\224$3\225\200"
+	.ascii	"\363.\001\020\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_currentMeterADCRead.43.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`M\002\035\021"
+	.string	"\246\037nE\360\322$\0352\323\335\330F\221\352\216ioF\004\372b\003\r\357\317t\370g\257\013\215\305|u\3406~ZT\220\334\376`\343\261\300d\301\257\264 y\360\024\243a\250\240=\216\t=\027sK\236\265\266\367\2262\245Y"
+	.string	"S"
+	.string	"a"
+	.ascii	"/vc$\036A\035:\366\220x\210\272\201xh\226\215\3431\236}\320\n"
+	.ascii	"\233\240\035\273\233\251\207\263\036\341\323d\371\247\223\335"
+	.ascii	"\375\317\001t\256\231\307\234\303\f\030\362\341\\\037\002\035"
+	.ascii	"\"\034\001\256\232\027r\324A\351?O\r.\232\314\323\311\356:;\327"
+	.ascii	"\315}\272\355\026\333\t\354|\005\250\335U\340\227\270\t\013~"
+	.ascii	"\317\241W1\371\356\320\217\211\207W\220\033$\230O+\233\354\330"
+	.ascii	"L\352\313\376\333\335\265\356\330\367\371\003\274t|i\250\351"
+	.ascii	"\227i\315tf\372\004R\"\216F\230v74\371X#\030\003D\312\366\323"
+	.ascii	"\376\210\223`"
+	.string	"\335G\346\005vw\206\002?Z\331\364\177\350t\214T_>\360\224\370\364\002\320\215\232\354a_\306g\244\370=\206\240\222\357T\342\341\323Sk\t\306A\325\216p\030\022\356b3I\362\312[\250H\222\016Y\250\016\270Q\202\245\332\332U\344\322\204\247@\221\232\n\201\304\343j\263\374D\020\205\026\020\236\036\231x\250E]\016\273\034h\013\234\006\243\271@\253J`^4\216\213Qe+n[\275h\253\354\205e\305%Sq\253\254D\304[\005\215\313`\266\215\313R\261\375[\3351\003\230QKibT\333%/\"\212P_\276\320\237\212\3440=\250\266O\343C\rLxvw\201_\3436\034<@A\211\207y\013u9\240\236t\330\004. \300\002\021\241\354\001\263\320\305\307\360\f\345^s\343c>ck\013 \330\245;\331x\256\026\224\301\253\202hQ\017,ir\245Xl\357 \241\035<\032\316zx\003\363\240"
+	.ascii	"\254T^\235\3411d1%D\330O\212\177\003|\253e\331&\214\002\351\332"
+	.ascii	"\202=E\f\311\335\035fMa5\213\321\246\253\025G\0262cJ\221\241"
+	.text
+	.section	.gnu.lto_currentMeterVirtualInit.45.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\325\006"
+	.string	"r\r02`M\323\001\300.\205\203\254\373"
+	.string	"3\004\250\3114\340\341\n\004\347\n%\326\261\204\217\035\320\354E\360\327N\tR\206\004K\262"
+	.string	"[\242\363\216\272{H\231R\216 \313$Ax\211^\005\251j\222\2527)$,\274\bV\017*0\305 \301g\241(\370\036m\257\032\204\222\r\243\020vr\340\376p*\277\3065\213 \333\305<\372\033\347\270\370\027wn\260\362\361\316\267\234;\333\341!\037\235\035 [\204b\266\206\245V\330\007X\325\330\372\220\204@&\273\023)(\2739\017\f\333\177|\331#\327\262\375FDbs\262\273O-~=/\377\031\027\210\031\354\031p\260\273\316\230\241\270\365\266\rlWlg\001\b"
+	.ascii	"3\001g8\203\004\3365\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRefresh.46.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`\036\004\335\033"
+	.string	"\3662\262J\240\230Q:\301\352\365R`\342F\222'\001\206\257\200_\214=\204\025p\002z\367\035\316'C?@N\336\336\370_'LQ;Pf)\345\207\261\032-\360\r\270\366\205A\377\222f\274\220\f\305\245\021\367\352\231m\204\020\"wJ\001\227"
+	.string	"\216"
+	.string	"\243"
+	.string	"<<\256\024\364$\343$\271\\\264\203l\227\213\324\305F\272\2050u\027\003*G\207\320\201\005\\\\\221\260\324n\360"
+	.ascii	"w\240\020\354V\240r@\325\n\\\340\b\254\213>\265\237\343G\270"
+	.ascii	"\377nn\325\n\203\210\217Z\353\002+`]4\360\001\343\305\3602\343"
+	.ascii	"E\343\354)\007\372\352\203XJ\004\257\324Zc;\343\270\217b\270"
+	.ascii	"\024\347\223\023Z\274\336\320GW\217\305\305\025\017I0\355\350"
+	.ascii	"\276\364\316\320@\255\365\301S\023=\035\245\344\204Z\253)\257"
+	.ascii	"\227\342&o\273\307\266i\207\017\002b\270\205G\365\245+6\225\260"
+	.ascii	"\362\207;\365\260j\335A\360\233\336#\204O\343\242}Jz^9^\374:"
+	.ascii	"Pbu\343\227\243W6PG\267\310~XW\206mH\352\032\222\032FR\323\374"
+	.ascii	"\367\023X\352\031\222Z\346Kw\314\221~\001\327\361\303\034\370"
+	.ascii	"\007X\352\327\221n\327R\267\226\232\265\324\344R\217#\265\270"
+	.ascii	"\324"
+	.string	"\341R\357RS\221\3727//\222\304\242j=q\245\245J\211@j|\351\366\223|\246%?\261\206P\260x\314\340M\325Z\023\\tN\254$W\222\243\2433^\224\331+\235\036\251\360\021\035\375\242n,$\255\r\222T5n\221\317\364\326T\224U\230\340\016W\300\272\326\204\3152rCP\344<\252\231\245\313Z\361\310ID>!wfo\230\2348b\226\224r\032\211;.\271\205\303\241:\f\0217\302\216`\325/\027n\314^\312I\324\340~\032w\303\265\t\2368\\\353\332\335[\331\030r\032\351\350\225\270E\017W\206\220\303\354\213\026Yh\255uh/4\006XX\013+;\242\354(\026\323\265=<\310\255\300\223Z+\004\377\307\201\310f4\332\370\265\322\234\311,\2304\033\017O\206\027\240\322\304\251\225f\211a\347\207BPy\201&\3024\313\032\b\223f\207\346S\223\211&\005\232)\333\001\322`\332d\""
+	.ascii	"x\306\300\374\241\325j#f1[\255\264\375"
+	.string	"\320l\261\237\036\231OlV\263\305\030\334\270\004\242\325bfY\326b.\300\334\303\007_\201\212T\325Tnu\266\301y\224\333\313\007%G\307f7\370\242N$5\353\304N/_\023Z\205G\005[\231\255Y\261\351$\3229\375G\205I\252Z\302\325\225\322\256\326\334\001\232\205\355O\243\327\322l\315\3239E`[\373Z\362\310i\244S\262\206/qQ\250Q(E\225Q\b\ndF\202\314\322\302\214\001p\002\2212\253\016\020pFCI\306b[\326Z\211=M*\210\345M\260\202\307\020\206\021 q\371\263y\031Y\223\377\006uu\373P\267*>\250\277\035\351\254f\221(\270\3075\253\310\311I\255\032\205i\215\263\315\r\305\231\247\203\241\\\207\bT\003/cj2C\026\372\220G#\346LS\201Ax\304(I6\f\3706\002\220\205A\2246\245_x)\036\023q;:\314\215+@\224\362\222\345\332\001\312/"
+	.ascii	"\331\2248\305O\304V\256\342]\325+\264\251\n\201NP,\272cM\031"
+	.ascii	"'>\267\235\360\007"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRead.47.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\005\013"
+	.string	"F\024JA0\307(\035\220\313\313!\3373n\316\237\344\357\325^\374\354\352:\004\254\220\201r\306\215\251X\206B\204h\r{\036\342\177\320\312\206g\b*\002N\r\300h#z\207\201\004\311\005\360\345\223\310m\367N)4"
+	.string	"6"
+	.string	":"
+	.string	"\226\320N=\376!;\325\356\220\235\032\264\035|L\355\001\234\220\260 \354n\235)\007/A\377/W\bO\245\313\004\214\335\265\fO&\367\274\355\b\333\024\366E\002+\321$c\366X\222\023\305\276fw\327\023e_\3745RZJ\351k\013+\f,\f\354\226\304\"\354\213\"P\331\330\276\264\337r\027\360\"\351\r\273(\005\007v\307\211\003<\025v*@N\006Wk%v<\200\306j\301\247\375\371\f\013\244\343\244T\244\354t&\b\037\370\3432\237\266\273\025>\314cD\276\352\324!#\371\360\324\037e\247\237\034W\201\036\027\342>\324['\004\342<O\264\325\317\353>\020\367U\220g\343S7\357\253\035\bw\036\234WC]\347\325\315\270\327\354D9\203\345e\232#\226\323\336\336\222\r\270\023\370.`\346x\025"
+	.ascii	"2\241Q/0<\250^\320\206\260\007\017&\233\n\201\020\260<\310\r"
+	.ascii	"\336q\024\035La\243\224\364j\202=\0251\244\272\273`\324%\254"
+	.ascii	"f5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_currentMeterRead.48.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`\252\003\205\030"
+	.string	"\206\252\230L\240RR:\263\016z\305\204g\036\"\2700\232;\t\023\307\256\372\227\361\006\306\036]\214\310[;\327\311k\335w\274n~#!~{\024\2765\355\325\321ii\265tV^\022\204\253"
+	.string	"\323\b\371\004\003\316K\004\321a\263\204\220M\366N2\177"
+	.string	"}"
+	.string	"\206"
+	.string	"\307mLo\273O\374P\356E\233\216\345\274\363\224\224\263\261\244\031\244\307\b>r\036\233\037p\036w\256[\353Fa>\362\006\317\310+\347\274\336\025\317=EOl^\233\353\037?b\264\253\242\341\273y\372\243[\024I\242\020z\335\357'/\204\305$;:\277\233\247\"\361C\342\330k*"
+	.ascii	"B\225\b\340\003a\216L\361`\375x+\302\267\263\026\215\220sn\333"
+	.ascii	"\363\351\274c\357\356_w7\350\276K\001\300\241\242\316.\317\242"
+	.ascii	"\007\224\272\327Gv\233\363\367D/T\004\251\272\302\261B\272\215"
+	.ascii	";{}\272\177\227\313\345\262oO7\266\255\242\266e\247\355\330i"
+	.ascii	";=m\243\3306>\321\177_\374O\340@A/ )2r\036\261\004\313Rx\251"
+	.ascii	"Ew\277?\343\310\231\027u\202$0\305L\267j\364#\232\027u\201a\020"
+	.ascii	"H\3149\253\307\3354\335\352\261U\273\333\032\037#w\242\232\213"
+	.ascii	"\344\334\003\266\246\001\371A\277\352=(\244\250\250\234\307\366"
+	.ascii	"\335t\036\277\247\304\027\355\342\205A81$\307$\371\312)\273\036"
+	.ascii	"\216\347\361\250\225\376\260+\260\330\367X\316c\331EuYB\277X"
+	.ascii	"\313\241,\\G\355\004\331\027\236\003CI\362\370)v\005\350`\t\245"
+	.ascii	".w\262Y/\307\301\224^\325\205\325W\261gW\252\001\020&}\240\365"
+	.ascii	"\2075\347\361\335\321S\036\331\032n\243\226\346\234\035\364k"
+	.ascii	"\034iC\177x\33406\373\236\355<F\357\225\211\2407\232\f\r\006"
+	.string	"g\250\331\236\231\310\304\320n\267\016\263\025w\263\341bh\2705\246\366\002\263\316n\270\325\304@\3338\320n\253\214\315v[U\243\356f>\036\005(\370\265\245\273;3\347\234\323\226oa%\247\240\331\265P\240&/\256\005\377Q\273\034\353'G\b$r\351\354\362Q\273!$\364\200\275\267\033E\202}\257\315{\323J%\017\323y}:\351x\221\0370\254R\327T\020\253&OZ\251\367`?Q\2740|Ou\037\023N\2049\007N\250q$\344\020\203\346\220L\220\221\202\202$\035\200\002\221Ac\007\021P\271F3\263\205\225cb\302=?\266\2642l\353\343\274\207c\nr.\220\007\345\230\320V{l\204\365\004`\244_~\374\242\r\366\r\367R\274;\251\227B\276\221\226\337\"'\207\022q\321O\202h[E\233$-gJKf\211\307\232\327w\270\271\237&d\350\255\255\003\205\343\177\004\205U\364>\330C"
+	.ascii	"\313\t\213\254\342%5\224\212+\330M\215Q\205\031\217\201e\034"
+	.ascii	"\302]\224\036s\373\223\001\f\376\213 %\313k\001\375\311A\276"
+	.ascii	"\3518\271\352`\036&\211\247\006"
+	.text
+	.section	.gnu.lto_currentMeterRead.part.0.59.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`\360\001\205\020"
+	.string	"\206]hH\360\2606\0350\033c\024\255\004\216\300\t\375\363f'\303\233\256\007\232\373\363\302h\025\370\313\2768\230\274\255\310\251\355!\214W\375\267\252\352\355Sw\323\3249\232!\362\257\274\030\330\335\277\231\237\320\327~\016\305di\223\275S\nP"
+	.string	"R"
+	.string	"Q"
+	.string	")<4\273\244\202W'\330^M\376C{\335\356\241\275\332Wa\333d\342\321\266qre\0373\363\241\265\263\273\335+=\361\361tf\243\357\372G\253$\007v\342\341\364\345=d^r`'\">\007<\373@\330]o#\356z\333\017l3\260'\207/I\177\031\301N\newI\366c\016\2639\217\374\345\002+Uj\305\356r#\324ga\362]\346l\037\306\364\026\311\224\260'\022 \257\246/o1\276Eb"
+	.string	"\273&d,\330^\017d\234\347<i\272K\211"
+	.string	"\271!L<\247\375\226\263\306\273\224.`7%\355\225\336\240p\274t\206\277\370\266\335m\340\327\334F\203\277zu\b\234G\201\332\353\351\313\317\030\212N\252\205u\232=\223\252\230f\317\226\246\330\237iz\362\237\237\351o \250\216\324.\210\036\236U\325\032\024\207\371\355\3733\247\021\377r\026+!\272\b\030\276\031z#/T\r\n\031\211\2740$\201:1\004E\221'v\242O$\324\201B\261\0131`p\203\027v#\020\f;\356\256GH\241\312q\343DKL)U\261M'\034g\306*\374\346sP\332\302k\\\350t^iP\332a#\303\302\022\371\f\n,8\006=\306\027`\005F\007\317_\0050 \220\002\021\263\343\006"
+	.ascii	"\nPs\017\022\201tC\3723\246`x\234\330`\255\301\341T\201\006\314"
+	.ascii	"^nj\243t\216\002\202gkN\246\300\006\017C\270\033B\210<0\302\037"
+	.ascii	"\203\214\212\022\b+aJ'nS\320v\327\275,A\243T\366d\212\275\332"
+	.ascii	"\377H\372c\350f(\302\220\307\313\235\244\325nc\312\032\003\200"
+	.ascii	"\366\216\236LKOxc"
+	.text
+	.section	.gnu.lto_.symbol_nodes.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`\025\001U\b"
+	.string	"d\013\021\002"
+	.string	""
+	.string	""
+	.string	"\002;\177\036\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005,\022\201\204\001\032\177\037\272\200\202)\177 \005(\020\0054!\033\016\200\003\002*\177\"+\177#5$6%\002-\177&.\177'\"(\002/\177)0\177*\377\377\377\377\003%+\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005#,!-setdata"
+	.string	""
+	.string	"\005\037.\034/\0350\0311\0302\0273\0013\1774\037"
+	.string	""
+	.string	"\200\200\200\0012\17751\1776\003\003\033$\003\003\032\304\001\003\003\031\344\001\003\013\033$\003\017"
+	.string	"\323\243\362\362"
+	.string	"\001\342\007"
+	.ascii	"% \260\002)2v\030\332\032\272\032$o\030X\017? l\271\0242\t\343"
+	.ascii	"\260\021\2010\2603\3462\006\316\370\031\357JH\354\024\270qlY"
+	.ascii	"\013\341\334O\034p\376(H\200\026\217H\201\207.\374\033\274\266"
+	.ascii	"\r\346m\360\302\2633\300\033\276k\350FM0\236"
+	.text
+	.section	.gnu.lto_.refs.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375 \2335\003"
+	.string	"\242\b\026\032\200\265I\00730\00330\0033P\304\343\343\267\265\247\337\324\255I\333D\246\024\016fXa\004\263,M\031\202\3268\364\224V\351\312\344\b&\300{x\227UY\223\027%5\357\311\200\341\017\331\204\026\241-\016%JMi\034W{]\314\342\314\021z\315\030k}\235\032\020\003"
+	.ascii	"\237\020\254\317@0\033\3142"
+	.text
+	.section	.gnu.lto_.decls.16c1935507a1951e,"e",@progbits
+	.string	"(\265/\375`\374'\345\257"
+	.ascii	"z\025!=Z0JIH\351\256(\224\327NnB\323\262,]\261\034^\236\006\347"
+	.ascii	"\274vFgFwf\326\351\364\225\302\234\314\037\3175\325\337\212`"
+	.ascii	"4\302\344{^\2559*\2308\316\341\235\276kv\250\212\027m\205\214"
+	.ascii	"ZE\232\246I\n]e\263\005mq\331%$\245\026\265\316\266\221\266\367"
+	.ascii	"\226)0\003\316\003\337\003\302d.\352\264\222hln9'\033\315\257"
+	.ascii	"A\0075\252\335\272\254\231\307l\331d4\266\252\234\223#0\354H"
+	.ascii	"\332\002\007\203[\221\315\341,@\216\b~\356\210\237s\201\177\327"
+	.ascii	"\340\337.\370\027\313Rea\207\371\224FK\222\245\035\365E7\251"
+	.ascii	"\371pR\357\357\022\256Iu\330\312\352\342\327\n2\271c\2056\306"
+	.ascii	"\270D\234<\"\316[6|k\206o\301\340\f\340j\303\3518o\270~\223a"
+	.ascii	"\330p7ga\367\005\273\356\013r^\214\b\225\347\275\375\302\267"
+	.ascii	"S\360\007\026\211o\215\370Xn\332\205V\206h\2657\233n>'L\346d"
+	.ascii	"%\002\227e\211\370\035\342\264qq\035\342|U\303=\315\341\254]"
+	.ascii	"c\360k\026\376\231\024\374fs8_{\340\036\267\346p6Y\233i\345\207"
+	.ascii	">s\r:\270E\262\222\255rN\362\354\304\201\022\347M\275\257P\370"
+	.ascii	"\375\341\354\270\376p\276\0161\210\336p~\340I\332h\352Q\357\030"
+	.ascii	"\006\255/I\254z\305"
+	.string	"|0\025\216c\324\032\376\006U\270Xe\001\323T\300\364\b\372\312.'g).\252\234\263\230\016\323a\255l0\375e\204\317\335\321D\262\204\357\333\f\277\277\340\277\275X\"\0232\251!\347\313\220\2551V_]\245\257\330\253\"\3162e\244\331_\215\245\271\330\253b\216\214\251\"]\032\254\225\375\325\\\357\256\366\032\216\360\311\025\371\272\232:\357\231\315\341\314\320Vx\213\317n\211-LY\357\033\211\337T\262\316\325L\254\246rB\246\331ZZ\331Z\215\365\226\322V\277\311\234\261r\316\337\340\377yku\226\276\342a)g)\035\024X\271\2424\346\226s\036\3413B'\311\006\023\346yO\204o\002\376\003\360\025\200;\331W\255\274\227^\276\2474\225\347\f\223y\231s\346i!_\220\204\324\373\037\374\266\362\t\2049wp\035\274B\3169\353\372^\316W\f\2429\234\2677\234O6\207\023\367\206\263\007\3667\213z"
+	.ascii	"\237o\371\327y~\273\341Z\275\200\203u\bJ\030\374\225\304)\370"
+	.ascii	"\255\016\034\b~&*\353o\022>o\363\367\001\3766@\332\337m\177K"
+	.ascii	"\240\016\240^\3607\234\n\342\357\n\376&S\005\360\327]\r@\375"
+	.ascii	"P\201\377\036^F\251z\370\355\007\376\336\372\273\353\277\375"
+	.ascii	"\355\324\337N\376\216\3627\224\277\237\374\275\344\357&\177W"
+	.ascii	"\375mU-\370\033\371\267\222\277\223\324\n\376\367\374v\311\377"
+	.ascii	"0\377\301\374\027S\303\376f\363\327\016\177\365\371+\207\277"
+	.ascii	"J\360W\r\177\355\371\257\373m\231\277\362\374\r\367\267\333\337"
+	.ascii	"\315\277\317\376&\373{\314\337a\376\366\372\273\312\337S\376"
+	.ascii	"^\361\367\322\337J\177\273\370;\004\177\203\340o\017\374\275"
+	.ascii	"\302\337*\374\r\374\333\350\357\242\277{\377K\370\277\345\357"
+	.ascii	"\r\374\255\201\2773\3607\007\177w\360\367\t\177c\340\277\330"
+	.ascii	"\337%\374m\201\377\313\277U\374M\201\277'\360\267\b\377\341\374"
+	.ascii	"\335\200\377$\374\315\200\277\023\360\267\007\177\227\370\033"
+	.ascii	"\001\177c\360\177\314\377\261\377]\376\253\370\237\200\377a\377"
+	.ascii	"wqqqq\377%\372uV~\017T\002 \222$\217$\356\332\021\251$\035l\330"
+	.ascii	"\324&\316*\272\332\336\2522,1\251Qf\355\265\231#cr$g\t\243\241"
+	.ascii	"\325\264\016r\333[\225\356H\02180ZxM\303m\230LEC\246\2469s\356"
+	.ascii	"$\322\251\230\217E\021\177={MS\313\230ek"
+	.string	"u\254\216ye\236Y\3150R\316\035n4\333\336\334\362\361(B'\312\231*me\257f_\223!g\253\234\263\207S\313-\310X\275\365LU\336\036\3135J\365~\255\232\371\237\2433\225Lb\232\251dH\320\220I\021\313\211[s\342\245^e-\323_\3160S\242\310\314\3601\027\374\327\377\314\302b\316YF.\231\213I\031\316\277\337\271n\021\377N\333\036\300\377\233\263\001FHfa\02655\274\204K\230\003D\3161s\036J!9@\3128\224z\".\2452\322\360\b\222\206b\226B\".s\326\220\207C\244\024\310\254\201\270\314\306\354\202\314\3309)\205\224\207\310\254!\017\263\020\004q(e$.\205F\r\304\245\2241/\245rO\036\n\213K\303\\\324\220\227Rm\362\022i\354!.\221F\342R*H\217-M\211\311\300\242\346\243\251\215\304a\216\321\004%,\3660\211Id>\313\271\261^\344\342"
+	.string	"r\206B\026\317\204O\335\225\304\214\221\264%Dv\207\246\244)d\0362\211L\22093Ib\221\2338@J2\263\220f\"\365\200\312L/r\256\240)g\244\316\314\2343R\316YW\204J\346\214\243\207H\325\324\224\363\321\247)C!y\275\310\271b\251\3512\022\227S\310\037/,K\252\254\224Dj\252|&U\304K\244\253\314\344\002\2462\316p\263{3\343\324VoR\247kG\026\2150>6M\234!f\302_\332\213\r\321\t\034/oe\365R\271\316\"\005|\2405q\234\222/03^oe\365\252`9b\026.\001\001v$\321m_\224i\365~m\3550\273\254\021n\341\353\236tq\225aS\223\245\336\312\245\262"
+	.ascii	"\003NJ\275\327\345X.\353\226%f\241T\006O\250\332\336\334r\261"
+	.ascii	"HB\313\002h\250<\265\311r.0S\250\260\352\225s\0259\321$\331\304"
+	.ascii	"h\251Y\255\254X\025\013V\016\024\036U/\300\360\317,\370\347\025"
+	.ascii	"\376\271\344\252Z\311\251A\"dI\275?\245\256\222\\nR\313\0224"
+	.ascii	"U\250\354\244=)\373Q\357\224j\325\312J\245J\251\311\234\227M"
+	.ascii	"(\275f\223]XI\031\205J\215R\233\354\204=y\230\004\205j\304\b"
+	.ascii	"]\234\022\027f\316\373\323\005~.\016?\347V\025b\b\246e\365\304"
+	.ascii	"\211\n\307#\225z_\2354i$\005\273\031W\252p\324[\225\324%\255"
+	.ascii	"\354P\231\270\t\222"
+	.string	"d\254\367\271&\016A\316\335\341\354\270\270\356pV\252\237\327$\033\316\3421\231\261B \322#J\275\266\"\351\240{\342\025\365\243\036\311\r\217<I1U\"0\206T#\265H++\221\032\344\215\246\n\331\362\252DtSM,\320\250[?2\023|;\347\302\340\277\002\251Q\370\006\231!\305\246S\257\355r9#\303\250~j\323X\363\207Xah5\327t\233^kf\020\007X\275i\232\235!\265\341 IF\332B\205\306\346\306,\363SDc\253\372+\262J\325\034\365\251\332\250S\025\252\322\2507*\216\312\243\352\250=\352\216\352\243\326\250?\352\261\2255\252\032_e\324\031\225)\204(c\2325\252\n\253\322n\230\314\306\335\026\266\266\027\322\250i\306\325\334piL4\266\252\027\336\032\3564\322\334\240\210DcsCk\241\313v6\347\035q\250\274\322\272l\207\224\314N:$]5\252\306\350\265]<\316n"
+	.ascii	"\251\327\2769\327\271\\\235\021a\342\273\271\033\353\346#\005"
+	.ascii	"\311&F\204\016\020(\263\030m\267n\347\251\212\243U\243^\353\202"
+	.ascii	"e\3130\203\207\033\027\333\232Mb$\306\223\326\232\2245IV\255"
+	.ascii	"b\251i1\330\300\341\352&\\\240h\371R\363\253\261\315\034\342"
+	.ascii	"\0053\326\364r#\346\204M\0066G\230dj"
+	.string	"Z\013I\235#q\213]\363\333\264\f\310\234\2079\265\245&\2674\333\202\024\032?\212\344x\275iR\243\336\236\362s\213v{\2609)\211\202o\315\332\236)\355\2315\363\311\267\251\330\366V\225\242yra\b\266fu\007$\004/Iu\3052C"
+	.ascii	"\227\225\244\336\333\262.C!\347\244\0061\305\250z5\370\271=s"
+	.ascii	"Vu\341\361\002\263-\231%\263L\237\214\324&\204%H1\022m\244\312"
+	.ascii	"\214\270z\277c\302\265-3i\225\301\311\211\br\314\030\037X;k\216"
+	.ascii	"9H3,\314\212\201\351\302\340\304\005\027\266\373\352B\246\315"
+	.ascii	"\027\330m\0300;%\205\027\030~\230\331\322\254!\204\243\243^\373"
+	.ascii	"\305\202\261#\260^l\227\035%W\267ZW\326K\304QH\003\004\224f\243"
+	.ascii	"y\201\023\253\267+\271\304\302\244M\275\337\271\201\271\330-"
+	.ascii	"\255\264\\v\013\n\016\3135u\203\005\032n\033\bk\341\205\363~"
+	.ascii	"'c\213e\265\344\2001\231\201\312\302\020\204\314H\223zk\026\235"
+	.ascii	"Uq\230\205\305\302\211\201-]\021\001\032\017(\365\332%~\221\241"
+	.ascii	"M\210\0345V\322\210\324{\273\374\255\262\323T\246\034G6\365\356"
+	.ascii	"\232~n\255T$XaaZ\252T\251bjO\036NQ\351Z\003\365\342i\b~Ci\013"
+	.ascii	"\343\026\252\225\026\206\235\362\223\224\205Q\n \245\013\212"
+	.ascii	"D\305B#\027\251\327*9\324\t\321\230\205\251\367\031t\340\267"
+	.ascii	"U\224\345\321\202\024\332\017\033\304\t\231\346\317\224EZ\251"
+	.ascii	"i6\261C\254\222f\036{\362\220\213[\263i\233X\037gO\254\024\033"
+	.ascii	"\305VY&\326\211\205\322J\333\304\n\271\325aw\334\3076\261=\322"
+	.ascii	"\360\250I\311\362\324s\243\236\346!\211\b\001*k\222\330%\255"
+	.ascii	"\264J\356c\225X\"\226\252\231\307d\226\241\263\245\r\231\222"
+	.ascii	"\021\035F\354\2709s\226\343\244B\262\333J\002q\241^{Dw|\ns\001"
+	.ascii	"W\244\225\326\b^\253\362z\363\264/C\246\336\360u\324\360u\320"
+	.ascii	"`\013\004\2275u\214)\203\2573\206\2573\002|\035/|\235,|\235%"
+	.ascii	"\017\213\\\212Q\033c\221]V\315\2141%%q\025\321\033N{\2648l\216"
+	.ascii	"?\207'J\327\017\255*|{\243\204!d\264\352\275\326\306\355\323"
+	.ascii	"\237S\303\220P5-\301\2674l\215?gwv$K\207\b\276\235\221\323\212"
+	.ascii	"S\273Q\257\225\201_\350\350\b\201A\007\227\250\034\365\336\312"
+	.ascii	"\370mS\243Y#\n9\017=\020\007\327V\257u\262\305[\243\215\221\255"
+	.ascii	"\221\003d\316Bk\344\201\223\263\220\247\373\202\356\013n\224"
+	.ascii	")$Z\316{\235#\336\351\rgw\375\3342\351\214\031A\263\212\232]"
+	.string	"\262K>.\344\26677{\344*\212\341\337*)\255R\025c\002\346R\216\361\3442Vo\242\330l\263u\201\363\033\325\0132\240\256\354\360\326EN\2140e\271^\233\324W\276\324<9R\257\0256\\\02216k\352\265H\r\207\2273\214,1D\305\211S\233c]mon\230I\232*lJp\340T'\317\rs\217)T;I\242\\\301\200\364\326\312\372\326em%;aP\272B\262\303-g0$.\034\0333!c\330\315\255\246\365\344\244\262-*\261\262+\260,5\265\312\346\343e\207l\230\205V\327^\331ZK>\026\351+g\032&<\224\224\270y+\253\233\n\006\002\310<#h\312KU\240)O\310\350\250\002_\017\230\006M\240BGDA\276\236\t`\360\310\304\004DDG>\337\317\247K\201\316\016\374\200,\322\237O\267\202\207\022\335\024\r\026\241E\247\257\307{\300N\020-\342\225\020\024\212"
+	.string	"\217\t\030*\n!4\005\376\214\214\216\202\025X\360!\bt^\312\023J\321\340\016E\212\023DFEh\0050ha\364C!\200\324\310\304\220\321\206 \337\321\b)\032\324\361\255\250i.\b4d\224!\005\362\r\031\345|CF\226E:\344C\211N\324\003\275\340\r\006Q\240\220\020O\327\302\350\027t\201\251\221\025B}C=\"\236N\b\r\036\335 4\250;\020h\310\250\304\016\220\307\"\350\266"
+	.string	"\246\301\336\020z\002\001(\270 w\026%L\b\021\365\216R\350\200\n\375H\030:J\001\025\312A\221\342\304\006\026A\024\270\002=\241H\205\004i\317\027\001\024)NlH\321\240\206\fJ\244@\236Q\t!\036z\002\005\017\352\001Q\037:\204\317\201\007\b\360\340\203\025t\377"
+	.string	"\204\f@\310\340\374\007 \374\374\200\340\301\017\276\007?6M}R\t\322\263(\261\302\204\357WT\364\013\262\200\003\035\004\372I\215t\2029 \232\022\365FHy\"\364\202\204x;(\220P\004zTx@\211xA\301\\\212\006W\254\370\235(R\234\230\340,J\004\201\206z+|\277\025x\276^\021"
+	.string	":\220\372\320 \n4J\177\276\016A*\020\355\240@"
+	.string	"@\201$@\203\200G?\025"
+	.string	"h\221\366\202xF\274\024xR\236\b\027@\203G;D\277\237\b@\271`\nD\211N\240@\203G\022\370\320  j\202Q\321Q\320\367\013\362\020\354\005Q \232\006[\260\330\245@\036\374`t\210\227\022\375T \"B\203\210\210\216VlH}G?\024DD(\212\026@4My\"\240A\300\337\n\016-xDF\301\236\004B\277\036\0205a\205\321\004R^\n\275\235!_\317\007\344a`\202\024\350\203\324\327;\322\021\361\202zi\017\210\002\370\033\301\367\353\245<\340Q\212\224\227\202\n\024\244A\240]\032DS\336\004vA \"\336Q\n\354]\240\202\364,>\374g\204\002M\244\277\037\320\204\316\b9A\240\023$"
+	.string	"\321\024%\301\202\023E\030My\251\n_\007x\300\024,xE;)\220\006\033\244\276\236\356??(@X\240\204\007\340\240\022\251\017\005\002\217\202L\004\201\277\240\017\r\232\360\365xE&\202\200A\023%<\240C< jT\304\303F\322 m9\205\335\036\357q\211t.\346\354u\207\374\022!A\307\013\034\365\336\037W\310\023\027H\216Bn\220\2677\027\305-;6\316\226T.\220\306\"NUA\251\367\372\350+\247S\322M\223'\b\376\357T\335\322A\322\345\350F\312\355\222\271\360\246\214\207\205\323-\021V\305!\301\354\2341\263u&\252\202\331\2708:f\354\270N;f\2258!:\252\230',OP.\224\025\333Uq\311rusX\2570\3046!\027\307\275\221\321`\021\313\2727\376\373t\217\326\210\002\227\261+?\352\025\321\034\316\234\215\032@\306$e\365\376\3260\242"
+	.string	"g\004\006\231z\357\214\237_\032\001\330\342\305\253^\335\225q\2158x\370`\341\032\2279\\\202\fi\326\033\367\233\024w\235\254Y\206\214d%;\351\270\302\274}\271e\342Q\204\316\025\214\2532\227\205_\247\337\030\032t\360\264*'f\302zo\323/\323q\354\253\t\3432-\361\261|\262\204\217"
+	.ascii	"+6\214\306z\357\322\323\316$\215\251M\275\227x/G4n@\256\322\307"
+	.ascii	"L\231I\252\367\016\257\213V>\354\276\370\356K)+\254\336\363\b"
+	.ascii	"\361E\320\017;/\322\257\360k\207\017\2517\254\305,\007\325\032"
+	.ascii	"\376n\315\333\233\205\363\301y\212\2310\315\035\260)d/\300\271"
+	.ascii	"\205\343\272\001\203*\250\222\3118H\342\024CF!\231\021\321$I"
+	.ascii	":\002\n\020\204\203a&\310)>\022`\024=\3151\347\230\241\021\021"
+	.ascii	"\021\221\024$e\2452\214\001LS\340\264y\216\220#\332\320c\207"
+	.ascii	"H1C^\354GDW8v\034`\261M"
+	.ascii	"\312"
+	.string	"\363\372\027\265q\246\377r\231GGE\306w\250\273`\025x\252\204t\222E\201\372|\035\355\303\273\023\371\333\340 \232\235\273}\276\373a\375J\314\244\310\233\007\307\353\374+\020\327Y?\371Z\2531\f\303\210\327b\021G\031EY;\323\341\247\031\353\302\334\211}\362\n@\0022\347\nm&\322\341\001\273\264\265\214r\033\251\310j\312\320\3072g\216\214\twW\022\2058SA]%\312\364\354\354\177\016OD\r`\006X\177\363\255\033qE&j\013\023\276\322\251\341Y\262\201\0051(P\2277\t\312gs\276o5\253\260\3038P\3664\372\032\300\340\261$$f\322t\003_Y\037\027\212k\242}\372b\304\302\232\203\230y-\242\321\033\b\311D\355\207N\220b0\260\035y\007\256\270\305\335\327<\366\203\362\360R\234\256\007\341k\013\265\212\326\200+D(\233\313\304\302\211\370\242O\t\246\335\275\372w\020^`\372W"
+	.ascii	"\030\tii\301\273\006\271\336\202\351o;\210\336\251\235m\0215"
+	.ascii	"~\213\223:\335|U\365\024\003_\377\323\347\200\034`\217\\\320"
+	.ascii	"\353\370I\330\310\240\271\235\351\001{\315\225\214\031\2242\036"
+	.ascii	"X\262\231\360\311\002\300@M"
+	.string	"|\265\004\356\337\002+\037Ov\252J0o9\323s\341[\244\305`\317\352@\266\341\377\020^\321\216b\271\200\354+\376\336h\345\375K\016P\207^\271\322M\313=^\214\337\376\330\331u)\373\311!\003\035e\354\366H\366\213\037\354<51\204\273\032\247\322\365j \004\260\254\364\270\n\202\240\024@\314\004RY\312\022\211T@\236\0017\030\271\250\007\355t\246\251\236\313\267=\t\325>j\0203\fWk\344}wU\001\364`\032\262\212\347Z\354.\200\356\302\370\320b\356\b\340\356\276{(Q)\200\003\346O\221\325\335\375X6bn\305\254\232\037\200\207$o\217\3303\230\264\236\260,\303\2532\271o\260\320\031H\006ZSF\205\275\354\374\017W\375V\240=\024:TP(C\373\220\021h\007.;[\214\005rc\022\217bYR\005\320\032o\330D\310$\302F\364\301r~!%\245\0136\353\f\302\253=\377W"
+	.string	"\340\265\017e\021\310`\0332\036+2892\f\276kM]\270\357\006\025?\207\031\027\306\240\244\027\203\221\223\001\3669\305e\351\344\364$\341\244\267\354~\301\231\224\354\355\232 \264VL\356\344\302\327\256\347\004\343\030\205\242zb\214\2751\361,\342\353!\251\254\226\336\347>\235"
+	.string	"\353 A\341\030M\223\301=r\t-l\337O#\326\216\374\203\024\276\022\267\276x1\353`\274\246\322\210\333-\024\275\032S\367O\225\024\ng_\001'\226\352\254\253W*\372\214\303\316\344\261\370\274\225\206\366\326\367\377\304\225=*\013\001YzTy\305`B\\\216\272XgA\227\305\300\247\034\006\031\232%d2\246\220\375\2630Tsd1\023[\223\344J\227\005\021\270@r\207\260r1\250\026V\263\225\220\247~\027gt\320z\263\366\002l9]ts\354\007!O\216\302\254\247?\214\344\265\353Q\016e\021\345\301\350H\257\354\373s\235\303\3239\234\035"
+	.string	"\222\213\251\313\2001\314x\222\002E\370Y\300\0244\326W\034Z\336t\370\323f\213\325\315\316`z\266u\331\022\326\310\316\371\023w\371\357>\3278\006h\236\004\214\031YP\027\254\230\253e\253\222`B\0138\300\322\3745\230}\331d\306/\257\335\255\215UE\322\202{6S?\247\223\364V$Bcf\306H`f\261\207:\2231O\236C\322\235[\177\\\201\f\324\2056|\354\215\271\220\003\342\267\300\237\322E\354\243\003\225\325%\006 \035\242\216\254\2407\247\217\320w\304\001i\263\b\nH\200,\341qw\317Q\264%\374\342\367rs\027uf89\207\367\244F\216\344b\350\265\332Dy\306a4\243\372\025\335\353\027\241\361yt\227\037\030~(t\350`\233\211U[$\245Z>t\336\220&\275\362\224\324"
+	.string	"\364K\340\260\301Ex\337\235\020K\320\034,\327|\032\330K\023\231\226\223\234\271 &\227=\203(\002\027\024\352D\362\247RlTg\2465\320\013\325\r\277\217:7"
+	.string	"\f\355\333\351,P\362\340\034\327\304\030\230\356\212\020\220\370\215\341\360\001\240\006P\215\376\363\223[\275{\037B`\253\266 \177\242ne\377k\224GA\235,0&r\243\325\215+\363)D\257\356\303i\361i\334\207^\361\200\234\227,\347L\006D\352p\323\315\346\331\345#Z\202[\322\221\303\373d\313G\355b\366\037\2512?\247.\360\321\202\221\307D\361\225M[\215j"
+	.string	"\221\304\366=3G\226\261\201%\334\253\215\3210\034V<\305\303\n\306\265\315\3021\240\023xv\026\255"
+	.string	".\345\002\227\032\rIq\346\263\317\"\370\032\272\345C\346\007\243\237\346p\230\314\215\343]XT\261\016\306\211v\300\025.h\030\f\222&2\264P\230\025\336&QsL\372\210\317\f\321m\373#e\n\224\351\247\323\227\341\0052F\017T3\260\346\224\034\207%%\224\211\035*I\326/\306\257\003=\314\305\203\364F\302*\323\325\303\314\370T\007\274~E\366O\346\001\216\371\277t\362\341l \255\007\354\377\037bObg"
+	.string	"\361\240^^X/\202(+/`\246vsn\b\356\\J\031\237q\273?o\216\304D/q\013\2432\340pz\334\032\311(H\220\310\"\200\217\315\003\370U]\360\036\247x\017\004#1YLMq\004\355\273\244\253%\324Ix\213\352W\234s\375M\304K[\277\177\213\035\244\273\247\027\024\357\323=u\273\272R\351`\005\277\024\352)\357\252\361\334\321#D\233\261\213\346\227\325\235\223%x\357I\213\234N\232\360>Z\221q\302\370\025`\217\330\233 \343\236\327\207\373\034\353C\236\031\336\354\357\360"
+	.ascii	"\277\t\177\371<\316\237\326\227\327\2745\350\026:rX\375\244+"
+	.ascii	"\247\316\237wt\273\233\313\351\223\347\316&\377\234\276\177p"
+	.ascii	"\325\330\305\3226\365\340]\017\256%\275\230N\312y\037\002\217"
+	.ascii	"\270>@\355\376\300\364?\204;\020>\324\267\342<m\365EV[\001"
+	.text
+	.section	.gnu.lto_.symtab.16c1935507a1951e,"e",@progbits
+	.string	"currentMeterVirtualState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"currentMeterADCState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"pgResetTemplate_currentSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"currentSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"currentSensorADCConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.16c1935507a1951e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
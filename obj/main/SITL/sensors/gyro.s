@@ -0,0 +1,2030 @@
+	.file	"gyro.c"
+	.section	.gnu.lto_.profile.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375 \030\301"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\005"
+	.string	""
+	.string	"\f"
+	.string	"\016"
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\037"
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`w\005\275\023"
+	.string	"&\027YC"
+	.string	"\263\2465\007\210\315\351\321\005\333\324l\253\303="
+	.string	"\275\2256+m\373kx\2329ZoFf\266\371Ki\002<!PUUU\365\252W\357o\001D\231\362m\332\357\222\314\376-\367\226{o)\245\224i\313>"
+	.string	"E"
+	.string	"H"
+	.ascii	"\333!\210P*\204\250\332\332O\255\036\242\245\321\215\005\232"
+	.ascii	"\375\331\365ll\255\262X.A\246\214\032\312J\252\245^\247\323\271"
+	.ascii	"\374R\030\0328J\\\327\303\b\341_\303\035`\245\227\0244\320\004"
+	.ascii	"\322\223\237\373\231\300\202\362 2\277\344B\251\214P!\236\355"
+	.ascii	"!\003\242\246\223_\2663\332\260\342r<9<0p\363\021\257z\331\361"
+	.ascii	"\271\310\021(\244L,6\254fG\314\312bw\313\035\355\335~\017\271"
+	.ascii	";\306K\347\206o\001\0358\233T\017\f\221\006\222p\213\016\022"
+	.ascii	"\t\300\033\220\024\031\225\257^\3535\261Re \241\361\007\tGEh"
+	.ascii	"\331\232\261a\201\344\362\257\225\217\021->\241\255\334j\304"
+	.ascii	"\3101\215p\177h{\247\203\206\330\242\256dr\311\341\335\003\320"
+	.ascii	"\236bN$\032\230h04\027^\030P\350Y\r3Xt\026\300L\004N\nJ\301\235"
+	.ascii	"\r\016\247\233\004\363\304\213\031\025\202\270\265VP\354\034"
+	.ascii	"0\020\347\367\340D\306\215U\201\357\3707\311r\362\364\250F\004"
+	.ascii	"\344\366\007\027-\235\001\002J\002X\356\017\200\211\250\021\272"
+	.ascii	"`$\030\223$\305\312\001`\002RUS\334\022 \204)\313\263\006\t&"
+	.ascii	"\230\021\021\222@IAJK\325\001\342|\033\034\b\275i$\036,F?\371"
+	.ascii	"1D\253\364\344\031!\361\341\324\371\312\357)\365\265\364\024"
+	.ascii	"\263\314\rWDk\203VwL8 ]CC\303\024\351\206\317\274(\312\256\355"
+	.ascii	"=\302\243\373\n\355\370\037\303\346D\2575\310q\020]\261h7\233"
+	.ascii	"\274\326\241\325:\205\026\301\304\304v\324e\213\331\253\033\206"
+	.ascii	"\357#\316Q\343\206\2411\303\020\030=\375\364\326^\022)\024\021"
+	.ascii	"\331\031\0164\347TeL\b\027 \276\365\317\260\213\305\370\3262"
+	.ascii	"\r W-)\374\241\033}\272\314\265\r@\021\026\266\321\205\332=|"
+	.ascii	"\347\277Y\t\245+\\Qv\350gR\315\335\033\210t\235aX8\367\330\220"
+	.ascii	".\321\0037\245\274}\373\354F:\363@\036\020\216\310Y\334\0325"
+	.ascii	".Z\231\333d\343\331\321W\242+%\254\257x0V\311\310\271\361Bo;"
+	.ascii	"#e/\3219x\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"E\005"
+	.string	"\342\305\022\032`O\322\0010\f\303\341\222$\t\257\334<\356\362\211\006\351\210;AD\356\224\002\205\271XfeR&+\251\035\371\207\252\343\270QN\306\022jF{\004\345\324/\246b&V\364\fQ\207\375\306\240\005\202\203\257\300&\035\340\205x&* p\2021fu$V\304\r,N\016\3269\273B\b\217\021\030\030h\330\303\001\007\223,B\306\204\360\360\236\226L\021\374"
+	.ascii	"}!\226\275X\255G\004iHG\202\240)\327\233HB.\037\302\200Ei\360"
+	.ascii	"8\223\300dX\0056b\002.\300\367\272II\fr\2310\r\276\255\270n"
+	.text
+	.section	.gnu.lto_.inline.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`L\tu$"
+	.string	"\226\263\253H\240\230Q:\200\332E}&\b\261\3400f\306\314\002f.\343\243\f\212\322c\276\241\203\302\200\347\330\260\264j1Z\210("
+	.string	"b3\027\203\007\274\016\236\001N\240\245I!\347X\317lZ\340\225\037aA\rnC@\376\336I\246\216"
+	.string	"\236"
+	.string	"\221"
+	.string	"R>\342\227\240\357|=\247\007Ao\362\365\234lDp\322t\016\300\232\376\344\371\025O\t\310==}\344o\327\b\364C?\274 \223~7z\352\320a\317\227L\251\312\302r8\363\303\231\037b8O\311\207\225Z\346\332\177\273\313\362e~\217n\330\335\234\335\262\334\003\237\271\252\f\205}\310\226?i\245"
+	.string	"\302\2163+D\322\017\307\313\254\332wwA\251\335]p[\336$\222\365\376M\276\330\335\032\373v)\273[\340\266\376H\335\356\302\354\230[\263+}sU\032Zs\234\335Z\t\243\021\300\232\017\271e\tt\243\024Or\304\034@\033\374\234\307\356\306<\322t\266\013\334\355\256\353E\273kc"
+	.string	"O\276\236\023\204\273\212\311\310\b\006\342\214\324\341\353\265\300\021e\\\240\314\264\320c0a\201R\021\031\236\002I\220\020n\"\21217Mg\232\3564\235(cn\341 > \355d\217<\3013\021\205\306s\364\344\271G\373\034JI\225\247\331\341\310\303\022\215\035$\243\226\250t\311"
+	.string	"\332\216]\325\326\031\032\373\220\332\326\t`\3548\225\226B_\002\305(s\356T\253\355;\340\347\342\255\004\330.\332\344n7\007c\032\331l\346\031\3178\256?\303u8\216\265{\326\244T\213\334Q\214?\347R\251\347\327\267\277(\321\343\210\253F\025Zs"
+	.string	"\f\354\244u\2568\327\234\253Z\376\264\206\346\274VZ+\20092D3@\004\307\341\210D\241p\262\300.Q:\f\227\352J\222\023w\270!\270s=\327\337\257\257?]\335\331\314o`\237[f\331\350\217\022\306\366\221R\200\355\031\333\354v/\253\223\276\001\255\244e0\0016\314H\3268\264h\\\221\330\"\301\304\222\213)\016\234\300\366\226,\364NMJi{\261N\216\355\232\304\371\321ps\341)M\271J\334\311\324\323s*\230DP`\202\343|&\236\322\224\350\033\2407\355\256\316\315dw_\266\261\201\344\324\016\"G\017\002\005\345*J\205\030\006\332:\276H\020L:$\321&!\331\3731Y\241\3732\260\271\226_\266\2350\031\031\021ztMV\371z,B-HE~\350L\333;W\033\272\363!\023\301"
+	.ascii	"w\216\263\264\322\244\202W\343\002vQ\222\323\220'\002\267\242"
+	.ascii	"\321\004\002\200\332\250\341<\250\224\031\233"
+	.string	"\221\244\240Ri\fP\002A\250h\250<\022\300t1\207\242\322\320\004SbRR\243\260\261o\2173\b\203\310i\b\177\254=S\016&\020\355i\245\253\323\336\242\b\334O\365\337\330Em\030\017\032\2358j\262\371!(\fJ#B\021r?\305\236\035\321f)\177^\257\220{s\246\230\312\f\\\212\224\241\002\334\324\345}[\027\305\212\303\376\226g,\003{\f\271\030\203\347\250\220\016D\001d\274b\245!\3061\311\212G\362]1\r\272\210d\234E\"\327\211\272\212\264G\216\275i\034\355\b8\313\017}8\314{>\207\352\257\310\236;L\333\\\326\002G\311\202$X6\340T\206\271U\002\215\337J\364\375DK_\356l>\261Xt\222\224\327\213\355+\035u\211FK}\340p\313LA\333\220\003\344v*r>(pv\346J\336>\234\240M\350\001:6t\253^\023\271'\365\367\340%eSw\r\213\344\334j"
+	.string	"a\262/\341\3608\310\356\361\337i>\230\350\304\262\230\2625\344CX\262\326E\374S\222\306+C(\216\006\311\252<\r\336GA\331\b\242\333\330"
+	.string	"\214\310\017\270~\232\357\303\347\356\351\013\201_\367K=\025\203_\224l\327(\237\264W\321\263\333\232\325q\247%\202\322bzp(\251\210\2366\272?\343\002Z\270\360\306\n6\034\352\215\222\352\200\271\367\337t\327@\277\020!\037\310\352O%\210N&[\345\233\345l\274\272\245P\004\216\211sE#\2362\325\331\260O\347@\340\300\265\301KKz\240\365\214\264B\024\016'\343\005\341\226(\257\337\0245)\266\252\340\273\321\261\003\"\331\226\255{U\270\213@\030\327\003Jp\204J\207aEK\016.t\250\261\375\302\364\032"
+	.ascii	"v"
+	.text
+	.section	.gnu.lto_.jmpfuncs.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\267\005\345\017"
+	.string	"\366TE:P\305&\035033+\265%\030&,!\211 \211\272\321\021>\343\025\270$6\013\204YHV\325\030\025U\325\024\211\252n\207\031\032\317\306[\235b\246\225N<i\233\354-S\n/"
+	.string	"8"
+	.string	"8"
+	.string	"\366\212\341\355\233b\272\231\034\216\237\0223[_%f~\362V^c'\246\215\217{\244\213\266O\310\325\220s\335ViQ!;\377\354~\032M\001E\310C\b:\250;\023\214T\355\213\341*h\031\364\332l^\f \335\00313a\227\353\031\t\271J\302-/\251E{\223o?)f\352\301Vs\335*\270\236\265\031\263\004\220\343\333;\212=O\201\001&\360N\036\026\360\017\210\325\001|:H\215b\252\337\036\222\3260U\316\030\321\324\313D\276\235\244\330\313,\264\365\210\024\332v:\331g'@N\003m\3336k\026!.\021(\324\202\332\207\353qtA\022E\034U\344\037\264\203a\203&\224N\233\241Z\265\252T-m\300\325\"\234\306t]\327\271*}\373F\261\027i\250!]\246ff\232J\235\306\300\002\021\262\3326\022"
+	.string	"\3021\006\b9\324H'82\025\211\004\205\245\005e\024\262\214\001\ff@\344\247\366u\343\344L\362\231\210\332\2423A\255\355\335\376\323N\363O\004]\016\243\b\274>\310\352\323\017\316\346\247d\242\327\027\021\234\220\"Dp\375\350>_\203|\304\021\007\264\373>\2331\301k/\316\2019\332\006\355\213@\016\340\323\344\325jF\270=\301&\232+\252u\204\261I\335\230H$\330\336z\320v2\267\263\0224q\023\020\030\035\b\320\036\022Z\230$"
+	.string	"4\274\2202\371\363\307#\n\340\215w;\202\021\353m\027\221\210*EG\\\271\031\223\373&Yo?\301\034\b\303QK\201\204\376\237t\361k\353\347x\321\201)b\362/ff\363"
+	.ascii	"}\320\357\177\370\347\fQ\235Q\364"
+	.text
+	.section	.gnu.lto_.pureconst.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375 Y}\002"
+	.string	"\222\305\022\034pk\322\001\374\353H\253\252\252\004TU\\\271\353\177\\\377\377\17733\356\3142\336v3\362\004\362=>\307\327\230\214\271\270\212\211x\035>\303-\254\b\253\301\025\254\002\027p\247)\315hB\363y9\267\231\314]\246r-af\222"
+	.text
+	.section	.gnu.lto_.ipa_modref.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\366\002}\016"
+	.string	"v\324;2`E\224\341@\271\3078C\021\313\314Tc\023\204:0\344$\f\3030\f"
+	.string	"\250\002\377\335\213\340=\242\261\r\373\322\370B\025\325\272@}\323m\377\337R\246+"
+	.string	")"
+	.string	"4"
+	.string	"\242G\217Z#5\347R\033kh\316\030\007\314)\214\030s\307\2367\336\265RUs\363_c\306|\035\321u\247\374\001\200[^\002\002\363\356\3329\355\217"
+	.ascii	"\027\362\323S\327=\3453\026y\237N\250I\352\267,\355\037\307\232"
+	.ascii	"r\r\247\362\251\323\225{\332\337l*b\230\362\207\020\345$\325"
+	.ascii	"\324E\265\366\373\255gi\374\220\002\027a\310\343\224;\027\271"
+	.ascii	"t\323\006\326\234\203\3665\230\350*\220\020H\345\022u\216B\201"
+	.ascii	"z\345\036\225\233\274;\374\343\224y\214\344\226\326\227Ly\246"
+	.ascii	"\023\242\341bU\236\362\023D\213\331\351\254hL\206.8\036\025~"
+	.ascii	"\002L\370\311O\235J9E[\223\274n\250Q\271\203\246f\nS#\303\034"
+	.ascii	"@\002B\030\273\363\021\260\2553H\2655\366\f\320\322u\020\032"
+	.ascii	"\270\3310\n3\255\216\214\207b(\301\b$\323\327\005\f\356\325\375"
+	.ascii	"\035\373\020\"\320)\343\300%\304Z\333\003\321\262\232\215M\005"
+	.ascii	"\361\301O\375|\025\352|!8\333fgt\312(\025\332x\217\322\031\031"
+	.ascii	"\312\315\212\377\334>\b\377\222\346\325.\225\352\002\331mdiD"
+	.ascii	"m\320i\005O*5\357\245\221\t\241D\2121\022\001\377\030\254@\020"
+	.ascii	">\225\b\222\201\343\016\027\341\346P\374\366Cp*\330\032\340\223"
+	.ascii	"\322\301\356\2015\006\313\375 0a;\245\247\267\336\243\336K\305"
+	.ascii	"\232\002\271\275oZ\017|\324\347D\277\247\204\311?\240b\005\275"
+	.ascii	"hu\226\253,e\214\035\244\362\002l,\332\035\336\001\252\212S\020"
+	.ascii	">]\023"
+	.text
+	.section	.gnu.lto_.lto.87ab8e2f9ab38e11,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroConfig_Registry.62.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375 \237\235\004"
+	.string	"D\bk"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\303\336\321\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\335\006us\366\005uq"
+	.string	"\005\001\006'\001(\005\001\006\035\001'\001\212\240\002?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/sensors/gyro.c"
+	.string	"\004"
+	.ascii	"\236\n\013f\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_gyroConfig.63.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`k\003}\020"
+	.string	"F\032dH\340\2228\035\303\353V\361j\304\023\240\bU\314\270"
+	.string	"\034\036\230\024\311\272*\206\326\340\331F\317\032,\307\212\212\347\227\206\357$\217e1y\001\370\360],\216\246\321\324\270l\310\031\221l\030!:C\243\311\313\177,}\262S\nG"
+	.string	"O"
+	.string	"T"
+	.ascii	">\265\377z\214\325YN>`\3275\023\263{&0\202\320;\237/\340\275"
+	.ascii	"\013\235\200\367\316+\373\346'\213=\r\230\022.uwAn\305W\247+"
+	.ascii	"\3772.J)Y\247\240\007\273k\232R\236\270\271\333>`{\201\375\021"
+	.ascii	"\0056\246?\374E\364BV\025\\\345\331\343]T\001Z2\323v\322\263"
+	.ascii	"C|\006\031\332]\006~\213\210\021\002jZ\274\363O\274w$\0230V^"
+	.ascii	"3\024z\263O\026\345T\330\377,\347\262\317\362\323\221\203\234"
+	.ascii	"\252c@\266\253r\253m\254\223q\361\331\001\026\016\004V3o\334"
+	.ascii	"\276\360\032\022\306SI\236\215\341?H%\217I3\334\007M\303c4s\303"
+	.ascii	"{\320\354\354\270]r\036\344\327\332)}\206fVM\317\241j\240\222"
+	.ascii	"b\345u:\016\220\016\016\021\324eZ8f\207\307\210Zn\352_Ln\203"
+	.ascii	",m^\343vx\230'\024\207T\b\001\200K#\241H\236\300Q\f\307\224i"
+	.ascii	"\004S\250\022\023\260$\216\340\310\310\241\007\223\b\202\bC\021"
+	.ascii	"\374\316\375g9\027\311-\206\302\221 y\021\325\307\272E\370\220"
+	.ascii	"\236z\024\022N\353q\235p!$\bf\253!\n\317\371J\233\371\321Q\341"
+	.ascii	"A\310V\215\233\005B\2501\034\214\245F\202\005\345\233t \003\021"
+	.ascii	"\231\332\006\021`P\251De\342\261\254\003\230G\235Z\267\225\004"
+	.ascii	"yi*\230I\213\025\263S\212\233\356\200h;\241\260\341\331\270\243"
+	.ascii	"\200\222X\232\375\346\023\034\223c\\\025\242\211\204\2104\031"
+	.ascii	"B\237A\216\216\352\327A\325o\207lCO\215\335\331\244\004tJ\377"
+	.ascii	"\232\221\306x\341\246&O\234JF\315n\027j\3022\265\007hf*8\375"
+	.ascii	"\013\255\252\001"
+	.text
+	.section	.gnu.lto_isGyroSensorCalibrationComplete.64.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\r\t"
+	.string	"F\221?:0\345(\035\200\213'\271\374D\026\017:\f\036\023;\007\236:w\025\fLs\231\263\266\327?\004k\3345\254\246\366\021TH\241,\260\030\217\252kU\340\324\265\354\311'\233\354\235R."
+	.string	"/"
+	.string	"."
+	.string	"\266\025\030H.\275s\26122\016U\n\200\335N\302\217\227\376J\376M\036[@XV-\323_\306aw\375V\255\215\033\3366\202\355\005\333\262\217\232\221\227\216\312.k\026`]bL\3046\311\336\330~\317>\311KH\177\215\n\0026\005\323X\331\355\022\334\341\036\335}`{\344.\260=:(\317\303D\034\030\273\036\305\202\333M5\234`\\\020\270B\036\375\321\366x\310\211y\235\336\314\356L\017z\330\327vw\r;\254\375\365C\370\034t\326\020\350A\343\217g\322\214\bY\351\254!P\225!\t\210\t\371\241Uz\f<)@TV\314I\345\246\333[\203\007'\210\262/\332\0165\270\311T\261\f"
+	.ascii	"X\211\"34\030q\r\307\2622\343b>\306t\324\263\214\313(\233\206"
+	.ascii	"Cu\bc\272&\031"
+	.text
+	.section	.gnu.lto_gyroIsCalibrationComplete.65.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`1\002\r\021"
+	.string	"\346^kF\360\260(\035Z\030\226>\365\334Mpg\036\227\365\354Y\317(/\024\341\301\225\371Y_^@\320\027\320z\324\332\376Bx\302\253\226\377v\231>\342^x&\275\274\370pL\342\343@\262\303\304\316\257\370d\357-eJ\001W"
+	.string	"R"
+	.string	"\\"
+	.ascii	"%\367\340\bSk\231sz\036\355\022\333\363\250\266\211\3551\202"
+	.ascii	"\004&.\375cA\341l.\250b`\314\371u\253\341\245\313\bWK~\207e\272"
+	.ascii	"\344\244<\036p\001\357rX\363\252\255X)\337\223\224\024\360\232"
+	.ascii	"m\350\260P\253\334g\316i]\261Z7w\333\016l\033\260\325BZ\303\266"
+	.ascii	"\310Ax\2349\247\207\017\363\017\021|\016\217&\221\350W$\362\361"
+	.ascii	"{\227o\264b1`'\275\331\037J\327e\177o\267[\fo\006\333j\016Ts"
+	.ascii	"P-\255\216V\257\325\272\352\003\350\310X\301\361bN\224\333\214"
+	.ascii	"\251\"\312:\330\376\2473\225\277\034\026-D\300u\201\244\334\270"
+	.ascii	"\322F%C}\3768\n\320\306\315\347\320O\210\006\260\314\231\362"
+	.ascii	"0\361\030H\310\367\007\362Q\356\277\353L\205\233\225\227\307"
+	.ascii	"\334\037\223\322\370k\366\242\355\272\374\031\277\204m\232BE"
+	.ascii	"e\374\021\266)\255\346/ \037\037\302\266m[4-s\232\276b\323\325"
+	.ascii	"\344\360`H\005\016ux\243\t \035i\344\221FD\244n$\004$\322\205"
+	.ascii	"F\244\256\203\200=\b\242Q'\301\363F\235\347;\035N\030u\027\260"
+	.ascii	"\200\034\005'/Ul\343\356R\260\275\353\317iQP\006P\233A\003\375"
+	.ascii	"J?\2505\371$\342\272d\347\226\003\363\307k0\207N\243\371le\270"
+	.ascii	"=\354w\0051 \240\002\0312\353\006F24X\212P \301\333\0136\220"
+	.ascii	";\257\031s\325\235t\253i\301Q\320\266\206\350\215!\211\335\202"
+	.ascii	"9\260\230\350\344o&a\021\324\324\314J8vJ\004P\266xD$k\364\027"
+	.ascii	"\023K\367\005\310\276b\267\272-\246m\307\267\351\275\244\255"
+	.ascii	"\353\002\016\343,K\021\247\313\\8\346\302\333;\nM\340\220\373"
+	.ascii	"\220f\314\335(8\321\271\346\t"
+	.text
+	.section	.gnu.lto_gyroStartCalibration.70.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`B\005\255\035"
+	.string	"\206r\264J\260\322U:\362"
+	.string	"]\300V\325D\226\001\221\252"
+	.string	"\377M\251\315\335\315\037\342\034\332\375h~\217qW\315A.&\366\037\377\207\323tZ}v\024\236\357\310N7\262\323\341\354\320\0229f\312\313\357\206\177\246+\332\2665B\202\266L)\234"
+	.string	"\217"
+	.string	"\245"
+	.string	"\031\266D\330<\266\354\345\312l\357\332\013\030\370\274\330\003\340WV\212Bj=&\260\201\327K\373\330V?\"\325'\257\220HZ\251\265\346\350\213\373|&\213\301^\247Y\272\350\372\370\261\340\317g\302\313\250\200\302\026\033\223\201\335\\\020\261\370\353T\300\025\311\313$\001U\354Yt\223\022e1U9\005\213^\272\0268\005\237jA!\027m\206U\322\221#\326\345:0$\202\0027e\004\345I@\341\322Z0\3105\240\326z\343\267D\360\267{:\250\265z\207\202D7\355\266\243l?\260K\231\024IK\n\224\213\022s\374\024\302\235\256\243\307\217\341\034\336~\210g\276<-"
+	.ascii	"C\005\320n}k\255?\324=&\2457\376\206\\\232\272B\342$h\265\354"
+	.ascii	"\343o)\321\276\253\322#\334\271\2069\327/\347\332e\327\267]\267"
+	.ascii	"\230k[\271"
+	.string	"\256\355\232v\256g\347Zv\256c\273\206\355\372e\256\317rm\276\370\323\257/@@q($j\321\252c=\261\205\245\036)}\310\260\375&\034\311Rxd\343L<\277\341\232\"\245a\261\326\372\343\221\266\210/9\024\367B](\f=\225\b\325\370E\270\221\t/\237\310\213P\330U\250`\276|\241O\302X\272Q\027?\001o f\013\275Q\263\210P\322o\267l\243-\364$\262\234\311\026.u\341UkP\003?\310\205`\320\260a?\264\301|i\243g\372\322H\24144.-\017(F\325D\360#\315\341@f\btx\024\315\017\032Q\226\022\226\245L\354\200*)\321\267\353\314\032\365\300\324$h\265|\244k\336C\027\203\204\264\315y\334\340\230\324Z\033\354\370\023\216\037\343\245w\037\216\377`\276\254\321b\321\321\320\270\004\264[\001:\274\335\216\256\347a\007B\007\001Gg\227\323{\260\343\353\355$\370v"
+	.string	"l\243\200\327\343\301\311\371z<\237\316\215/\247\263\323\345\344lz\276\234\202"
+	.ascii	"\346\205\270\351\345vx\274^Nv\004\272\253\322#\333\001\020\375"
+	.ascii	"\315(\361=f\025#\034V\260\036eTB\222!\371\211\321h\326L\f\026"
+	.ascii	"\215\355*9\2434\031\215\321Y\204O\221\"\203\321\330\220\277("
+	.ascii	"\354\244\257&[\270U\224\223\276\t\2264\207?\231!\320\341Nh\232"
+	.ascii	"\274\240n&]\363\252\244m\276$\311\225\320\034&}\362.XR'\216R"
+	.ascii	"\315\304L\321\330\216\034y\004>\252\374\252\234\250\300\004k"
+	.ascii	"\250Q \245)\247H\315\310HA\222$\215\001\240\002\031)\243n\021"
+	.ascii	"\020-5N\331,T6\3663B\331\242BZ6\032/\2234je\261\020l$c\272\252"
+	.ascii	"\021\224$Y\001\244\033K\007f\316\361\222^\3436,\332\r\030$qK"
+	.ascii	"\346hQ\323\243X\265\246\351\255,h\235\3061\367\004\375\232\300"
+	.ascii	"\347\025t\277F2\364{\322q/\257\314\301\343\236\350\341\345\332"
+	.ascii	"\326\266@\333\225l\0236`\203H\225\303\370\302\013\216\357\035"
+	.ascii	"3saB+\243\203suf\335\003\341\332\344\303\317.v%i\002\233A\nI"
+	.ascii	"\f\027\017)\241#\032\267\327\372\022\335\227\333@\341\336\025"
+	.ascii	"\226\313\270pDM\022\344\240\031\300\315\324Kb\312<\317\307\230"
+	.ascii	"Q\212~\306\"\354\0056\273\023\265\256:\251fWyE/\231\230\030\265"
+	.ascii	"oqW\003"
+	.text
+	.section	.gnu.lto_isFirstArmingGyroCalibrationRunning.71.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"\375\t"
+	.string	"F\223C:@\305(\035\265\256\252\253Y\1770\345\221\223"
+	.string	"\241\021`\n\247\n+\237\214\222\371\246\235\325~\202\370\323\241\351J"
+	.string	"k\235\211\212\342FB\3406\250\335L\250\254\3116\262\211\224)\0052"
+	.string	"4"
+	.string	"0"
+	.string	"QU\337\016-\315\315\267p\340\207GJ\347q\207\227\212[\030\2174\221\232\361H\226fw\017\3624y\243L\013gw\235\235Gq_\267\255`\233\300\376%\327\214\206\205(W\366\307\245\246\354[\253(\333i\230iM\377\312t\254$\240\354\236V\004V\005\232p\330\016\331\030\037 \204\274\375\3138]uQ*\021\260\373\005PS\376\325R\324\310\323\222\266\026\221\357R\177\2021R\356\271\273\234j\312\366v]3"
+	.string	"\t"
+	.string	"R\016\260\037r\221\315\337\260\004(\337\035\372\240\3530\356l\260\f\304\020\265\f\323>\036-~\032\026\034b'\323\342f\300\330\203'\213\020\030\226E\314\267W\224\323*x\252\301UM\266\241jD:\262*\324\227\n\210ru\005\022"
+	.string	"K\b\230P\307\353C\231\251\302"
+	.ascii	"c\240ZA\210\230gC\320\256\211n\b*?\0010\226\205k\017+|\252\032"
+	.ascii	"\262rGK\216\255-e"
+	.text
+	.section	.gnu.lto_performGyroCalibration.72.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\210\016\255H"
+	.ascii	"\332z\374\032;0\346\316\030\304.<{a\206\240Sha\031\251\"J\334"
+	.ascii	"\023I\002F|\326=\003\211u2#\342\301\331\032n\272\005[\225h\215"
+	.ascii	"'\334\374\204\362VEO\242\270\264d\213\334)\245\024\244\001|\001"
+	.ascii	"\240\001\177^\355\307\354\023BE/\346%\036?\2460x8\247\307}\247"
+	.ascii	"\357\307\324X\365u\373\252CL\243\030\003I\247\355\004\351:\234"
+	.ascii	"#\315\3204\315^[\031\314o\n\030s\020\346\245\034=\376>?\275\206"
+	.ascii	";\016\267\233~\3436\034\366C\206I\221o\336\264!\276\357\333\240"
+	.string	"Yv\201lv\312\330Nm^\263\031\322k\370\237$.\233e\036\302\274l\226]:s\004\nnW\215t\363\205\0166\231\320\316\334i\332\316\355\273#\355|\3375\303:\357[u\300\013\220\315r\265\241\332f\221\355\3246\313.\363aW\333\336#\333\324\254\215\342\373\276X\317\306\337\306js\223\273\r@*\n\352\311\251\311\331db.)-\225I\344\261e\215\357.\267\362,\254\001H\301u\024\334\233C\305I\303\274\371\223\240\024\016\317\315\235\214M0\306\007\357\373B\275\351\250\325\005\355K;\275t\323\b\301\232e\261\231b\376@;N\332\346LG-#\237]u\256\231K\021\336\364\244y\264\005m\332J\306\bzg{-(\305b\\2s\030\327\177W|i\314\262\233\363\362k\336\344\3518\251\025W\nJ\325\214S\357\373\306I\253x\362\300\0264*\21542\230\366\201\002\025\310\305P\307I\247\370\321\250"
+	.ascii	"\022\"_\013J\251\030\245\310\234\274-\317\314\274\355;}@P\352"
+	.ascii	"\245\343\264+9+s6J\033\215\022\310\024\2570\317\310\214J\220"
+	.ascii	"\314\002-\317\306\374;N\263lm\211\266\240}i?j\275\357\313\036"
+	.ascii	"=Ck\016\320\314M\207\231g0/\251\bVfv\004\314\274\242\r\261\325"
+	.ascii	"\252\355}\337\013\314\256\231.\344\312U\265\271tm\350\326\021"
+	.ascii	"r\357\\;\251B\267#m\263\313E~\212\212L\247\317\233\036\343S\031"
+	.ascii	"\303\037\370\216\323\316@C\274E\203\204\306\034\022_x\f\026\276"
+	.ascii	"\352/\374QP\031\032\250\253\246\t= \337\367\255\300-\250\007"
+	.ascii	"\201\020A\202D\333\254\205\3576^\356\254\276\212\367\244\315"
+	.ascii	"~-\204\267\372\026\260,\016\352W\226\360\020\276\315&\331\341"
+	.ascii	"\255\026<\001\250\003Q\260\n\026\336Q\026m\263\022\276\355\264"
+	.ascii	"\323\245\315\265\225\271\332\217\013\344\373\216U\340\006t\357"
+	.ascii	"^p\2735\353s\r\243m\366\300\267\265\275.\315\320\324\356N\314"
+	.ascii	"\257\377\276o\330?\225\271\n\365_c\356\026;\323\233\362\257\231"
+	.ascii	"x\347\255\246s\211\2463\211\246\363\210w\026\361\316!\234\316"
+	.ascii	" \336\371C\323\331C\323Y\253\351\334\341\2359\274\363\006\247"
+	.ascii	"sV\223\263\206w\316\360\316\030\232\316\027\232\316\026*(\235"
+	.ascii	"'8\235%\2743\204\256v?\350\276\346\253w\266j:W\275\363\201\276"
+	.ascii	"\353\236j8\315R\357\034\365\316PM\347'&g'\246s\223\322\331\251"
+	.ascii	"tn.\235\231\224\316L\245\363\222\322YI\351\274|g\345\3229\271"
+	.ascii	"\344\214Tr>&\235[\2453\253t6.\235_\351\354I\347N\361\213z\330"
+	.ascii	"\324\236\260\372:\271Jz\001\261|p\335\327\r\207\317\036\226!"
+	.ascii	"eNO\007|\216\240\204z\212<\374\007\255\357\360\036\\5N\3655-"
+	.ascii	"\016\337a\2607<\207\254\337\300\207\267|\213k\311\372\346\323"
+	.ascii	"z\252$.=\265\377\230\313\325\236\221\250\246n\035Z\342\034#\f"
+	.ascii	"p_\224\236\312\316~^[\r_#\357\217\237\213n\345y-\360\307.\325"
+	.ascii	"\253\270lP\205\032\276\377\332\323H\3613=\265\345/\377\277\344"
+	.ascii	"\365Q\376\362\273\f\361\301+\377\330U\207R\334\224Oe#\355\203"
+	.ascii	"W0\255\3133\034sH\311\344\225Kq\261t`\217\342in\030\273P\227"
+	.ascii	"\214\254E~\362\001\b2\233\224\345WI\\%m"
+	.string	"G\221\337\252e\031\373\260N\342\345\201\"\237\312Om\244=~\017b\227\372\231\021n7v\231\270N\274\243\256\223\266\331\343'\363\004\321M\021\363\353\200\3052}\307\247r\203\226z\005S\266<\013\336>q\243xG\257\276\357tS\233,\002\032\373\260\366\251\355\242\315\200HK\313a._\222\341[\316\332\324\356n\202\033\277\245\342Z!\363$<\224\034\211\013wU\350f.\031\253\3022\267\256@\373\021\352\376D\323\330\3671\207\272rT.\006\025Ud|\177\366\273l\372o|\026\260\f\321_\027K\357\251\365\325\325\322l\n'e\265\375\367\236\027>Il\255\212\344\312QAr\353\240\374\223y\200t|\354S\231\035\261\325\252\220K7r\345\250\250\235\350\262I-A\363\314)6\360~f\027\214\033\306;\312Sc\037\306\334\212x0\243\211\\8\n\027\3064\242K\006\013\021U\177\0064\204\321\264B\272n\334"
+	.string	"\002\326\202\351 B\303xc\207W\016\260\256\257\034-zx\351"
+	.string	"B\343\253\206\216\0354@"
+	.string	"\351\321\305\243K\210\027\212).%\333\270\362\372*\202\003\013\354\313\013\254G\027\030V\017\0354x`\331\370\002\303\272\022\300^>\272\276\260\200xy}a-\253b\375k\254%\366\320,"
+	.string	"\242\276\217\317\255{r\373\031\251\205\372\250wP6\205r\271\365\031\311@\333\236[\367\004\365\307\301E:)\026\336\375\374\023\370\034dZ\001\235\344\224\340\211R\320>\275O\312c\272^\377\\[A\353\364O\037"
+	.string	"\320l\n\ng~\022>\tyG\235\276\363d\201~\030\224\215\266\351\277\362\f\333\270\033\033\317B\317C\317Cm\263M\377}\215\036M\361\247~&j\231\237\213\236\211J\326\277"
+	.string	"\214\234\300yb\322&\276\361\332\211\007)\220\rs9\236\211o6\355\364TN\032:+\374\033\272\022\007-\365\335\250\215MV-\365\025\330+h\336\270/\036\232\tt>\365\347\\\r[\035\334\271r\t\354\\6\002\205\023\236\371\316o\375\312\304@\233K\2415\325\367\345\016\327+\243\261\367\025C\320\374\t?"
+	.string	"\260,\216\351\233\337&>\0359\232\347#:\246\227\360\004\021\335]s\261\321Z\323Q\036!\346\373\031.n\306\225\243*\343\262\265\211*Zz\245g~\227\355\331\372\2457\223w\b%t\203X\342\267H\374\210/\201'n\f\t\021?\"\304\213"
+	.ascii	"\361!\360\360\226\303\275\201\370\306\343\306\326\336+\004\343"
+	.ascii	"\312\365\234/\034\224\020`\231\"N\355\370X\216^ :&\346\207o{"
+	.ascii	"F*\300\346\3261\365_7\b\201(\250q(\005\231S\210FDD\222\024$\031"
+	.ascii	"\016A\005\304 F%;\017\021P\261C\220\215$Jc>\274\236\213\335\227"
+	.ascii	"^P\355\313\374\023S\245\034\037\327\r\321r\322\376\001g\301\323"
+	.ascii	"{)/\206W\215x\215\324\"\313\007\356s\005\251\302@b;R\251\317"
+	.ascii	"\226\321\310o\313\2357\304\"Fo\254|t\037b\036]\301\220E\313\225"
+	.ascii	"6\343\\DX\214\230\254\206\226\263\317\215_[\027\3241\364B\243"
+	.ascii	"\330\362\004\327GR\f{\261G\020\237\212\326\031\373\331\306\312"
+	.ascii	"/5\362R\034'L\224\317-\t\213\246\245\335p%\342\"4J\233j\336|"
+	.ascii	"~\360\r2 \247\305\352:\244\313\332g>\365\210\271\300\352}k\274"
+	.ascii	":\0230G\332\234<\004\001\341\020 9\272=\b\210K`\334q \336\273"
+	.ascii	"7\337\223\303\024)\177\030\035\001R\317\376\305\022=~k\3109 "
+	.ascii	" \261\3076)\237?\245`\032p\340`\002\230\312\335Y\251\331#"
+	.ascii	"9\307\031\"\356\307\211\251\340\201,?2g)\226Yif\337\217p(\320"
+	.ascii	"a`\007d\342\3106K\274\230\320\005`3>W\031W\334\257\274\325\364"
+	.ascii	"?H}9\267r\355\310\205\354t\235\237\205\321\257\033\211z\357\017"
+	.ascii	"\022\027\204\006\200\361\215i\316\035\314\0277-;\211-\271-\313"
+	.ascii	"\363`\275\323\267\340\333\024\302\211\025\223\324\346r\352\036"
+	.ascii	"J\353\247\266T\312\205 \2402\241\330+\347%\331/\024\366$N\225"
+	.ascii	"\235da\337\275\360HK\030\215\240\305\325\352dC\032l\330\314\017"
+	.ascii	"\272)\252\212x\322z\177'Y\307f6\005C\035\3246t\203\341\217\233"
+	.ascii	"\033\227=-\243SL\314l\342Dc\341M\270f\036\206\373\022/\307Q\274"
+	.ascii	"\337\343\033\377?HEf\316\246ES9\357],\256\347e\276\003|$\030"
+	.ascii	"er\020ED\037Jap\003$)D\374\352R\203\224D\253\372!\n\247\036&"
+	.ascii	"->\212K\262\204U\006\304\301\3463\013\245\206\324\004\f\001\363"
+	.ascii	"'|\304\017\004e\351WmT4,\fP\312<\203\347\201\035\374=\n,*D\360"
+	.ascii	"\bn\255<\350\007\373\312\336\020% \016\"\250RJ\346o\364\316\177"
+	.ascii	"Nv\223\236 \302_mvmJ\271+t\250|O&D\246\002"
+	.text
+	.section	.gnu.lto_handleOverflow.73.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`Q\003U\027"
+	.string	"\226k\227H\260\032Q:\270\367\323\351\331\201F\264\372g@\037\313\202\006D9\017-wu[\325g\314A6\365h\256\375\372\220\266}\r`[\035\211E\317\017\323\303\236\2767\250\307\227\b\306^`;H\241*\033\213%\204\354-w\222\001\200"
+	.string	"w"
+	.string	"\205"
+	.ascii	"\273[\232\370X,\004\304j\334\270\322\335\r^7\302\367\272\273"
+	.ascii	"\237\273\377q\236\325{N\354\250[\306\017Pw\371`\031|\257\bN\323"
+	.ascii	"\275\322\007\350^w\265k\345e\255\275\0325\235!\271\356\016\231"
+	.ascii	"\306W\377\274\256R\236\253\275g3\212\311X\377<\033/\201\214\026"
+	.ascii	";\357\242\260\330\201\315\212bRP\366\232\f@\246C\021t\367}>S"
+	.ascii	"\310\\sz6\335\2753&k\361\035}wU\354.\207]\276\t\363\007\246\303"
+	.ascii	"\265\037ndm_wC\330\023y\221\323\336\306\353\216\"\346c\257{\021"
+	.ascii	"\335\353\371D\353\001\203\247\2475\303\354\226\256\311\264\335"
+	.ascii	"\323\356\356\345\331n7W\246\316%\275\347\217y\371\005\353\334"
+	.ascii	"\217\316\365\350\334\216\316\255t.\245s\231\316\235t\356g\356"
+	.ascii	"\242\314a\231`\353^\021\306K\023\325 \034/\377\335\357\203\\"
+	.ascii	"\310.\2709\007\262|\033\312\345\354\202\257\277\317\202\001\224"
+	.ascii	"\007\225+;\230\020\311\341z\223;9\261\267\261%Q\354^?\346\333"
+	.ascii	"\020\227\235-\273\273z\214\352\330\343\177\271\222/\0212\031"
+	.ascii	"(\272}\205\272\327\216G\263'>N+\243(W\376\227\007O\262\266\005"
+	.ascii	"5 \223\201\"\033\345\321\f\307%hv7\213\231\266 3o\b\202{\315"
+	.ascii	".;\231\371B\260\\k\035\374gm\007\212\272[\302n\207#1\t\250\275"
+	.ascii	"\036\231\354\335p>\202Z\266Wyu\367\036xu\267\024\234A\016\353"
+	.ascii	"\241F<\231T!j<\235\306\022\001Q\205s\243\022S\342M\211\021\004"
+	.ascii	"\007R$A\201&uA<\231,\250P\"I\216(\221\266T3\2229\035\302\024"
+	.ascii	"9\246Pb*D\231pNa\211L\2055\005v\f!\222\241j\034\311\020,[\247"
+	.ascii	"\315\263\n.\210Z\354\372b\230H\302\214\032\f\236\027\\v\263<"
+	.ascii	"\246a\350\366\270?\301\220A\203\206\356\325\233\002\245\207\226"
+	.ascii	"\216a@\307\351d\370>\237\211\202#F\026)C$\226\341\001[t\300|"
+	.ascii	"\034\303$\276\220\007< \220\002\031\"\354\006\204Y\260\244\330"
+	.ascii	"\263\361\270\026-\217\013\225\310\212g#V\206\001\2076\024u_\244"
+	.ascii	"m\352\262X\221\026\316\fB\016\031\302\"\0272;Ev\006\222g\004"
+	.ascii	"R\034\006|R\311\026\202\204\264]g=\313\326\035\r\354\342\034"
+	.ascii	"\320\262#\324v\313Kc\303\037\335\305t\013{\016,`\315%\016\330"
+	.ascii	"\306\251\254\241\022\200\265\347x\bK\023F[0\240@2\004\227\234"
+	.ascii	"\233P\212\365\203\340\032Ep\f\262\301\335\250=\275]\246\f"
+	.text
+	.section	.gnu.lto_gyroReadSensor.75.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\227\002\305\024"
+	.string	"\226%\207I\300RRcR\021f\321\202\226\266F\307%\224\235d\304?\274\330\365\375\330\213\030\301a\201\342\361\013wj\"\262\"\264y\013$8\217ck\244vU\204\202*\b\202\354d\205\350\341X\244\303C\205\022;I\376\336[J)S\nr"
+	.string	"i"
+	.string	"w"
+	.ascii	"\276\2133\315l\251\332;\322\215\271\020\270&\254{\357K\345)\342"
+	.ascii	"m=\212xKI|vr\024m\245s\346\323N:\320A5\326\004CS\036\\:\\M\341"
+	.ascii	"1\302\207\370\337\353\220\034C&!D@B\267\257\t\275\272t\267\252"
+	.ascii	"r\357%\321\331&\255(;\240\220D\327SY\204J \376\373\314\351x\346"
+	.ascii	"\034]\356\275\236>:\240{\344\2669\330~`O_\267 O\225SPmf\331="
+	.ascii	"\332\244F\366\353\245E\2668mr\337\335z\357\037\021\247\307:m"
+	.ascii	"\351t\265\323\264NO:\375\223\263x\302\nB\341\307\275\035\262"
+	.ascii	"\210\\*[#\305}\277=\363\177v\331\366\351\374\366\374\214\370"
+	.ascii	"\344\206\200\334\333[\271\365\002\362v\332\347\035\306\354\275"
+	.ascii	"\235\237\334[\204\343\351\336\236\002# o\335#m\007P\027\n\f\375"
+	.ascii	"\362\247\030\001\224B@R1\364\202w\340m\330i\340\0048\032\233"
+	.ascii	"n\264\270\252\315\254+\355\200CK\215\376\252\025DV\025G\2344"
+	.ascii	"\006`\266\250O'-\t\212\242\262Q\332\024*\355\240\250i\304S\230"
+	.ascii	"\237\225m\016\261=s'\032\177FMI\352\210\267\247\366fc\211w\031"
+	.ascii	":\004\216|l\233\307(\311{o\203\246\232\f\007\206'n\375\035\361"
+	.ascii	"\266E\377\273\201\033`\021\312X\216\3148\241\345\230\2262\226"
+	.ascii	"#\363\222\305J\331\rL\366\272\231y\261y\305\304d\257\226\001"
+	.ascii	".1\300b/\re\031{\271z\367\365\322\"\2179&\\pdy\211\t$\\\320\232"
+	.ascii	"H\310\225\300\005\353\312G\232\263=R\273\324(\017)Er\333\201"
+	.ascii	"u\345\036I?(Fjd)L\245\2262\020a\2434\333\025\036U\251\3750\265"
+	.ascii	"\304\333\001\205I\"\245&\364\270\"\266\3604 `\242!\313\354\027"
+	.ascii	"\"0E\341\027O,\303\026f\270\267\254\030n\301\3440\214\350\222"
+	.ascii	"%\022\023\301\3410HkT9\322\246t\2553[\233\241U\250\214\305v\273"
+	.ascii	"=G\256\363\033b?\307\377\204\013\007s\321\344fqe\260\335\371"
+	.ascii	"l]\255\350\324\177\330\232\303\246\310jdh9\013Y\270\210\235\207"
+	.ascii	"\254d\220\b\"\262'*\331\240\255\016B\033P\324Y\273\222\232\262"
+	.ascii	"\213\272\327*("
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.77.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\374\007M,"
+	.string	"\252L\374\020F`\034R:{\b\272\020\223u\250y\032N\336\006\317\275;\301eQem\264/\355\336\316\037\257\376c<\374\221QuX\202\33203N\256\314xB\256\0331R\304/\017^'\242PX x\377V\362\244\021\271\223\f\361"
+	.string	"\362"
+	.ascii	"\007\001K\f\352\013\346\337\225ca\376q\214\247q\353x\376b0\377"
+	.ascii	"\276C\231W>\223\177\314\214\306mj\025\227\020\326\0338\316{o"
+	.ascii	"\203\357\230I\265\366U\270\013\367\356\035\322\307\355\336\373"
+	.ascii	"\200!\3342\377\354S\326/e\034\350\336\"d\334\356]>\340\005\352"
+	.ascii	"w\274T\231\231\037\345RV\3466t\031&\306S\233\313b\342\271\367"
+	.ascii	"\n\221\036L\277C/ \375"
+	.string	"\256\215|\375\317\327Sy\351\016m\273\362\231G\315\334\304\321JV\3757\344\206\217\373|\274\207\006\267\306\264\216\206\253\007\312\300\371f\347\314\037`\302\345eU\036\323\333\017\f\271\321u\036\312\340kL\016`2\013\r\306\021\231{\233\225M}\311\035\337\001\223X(\322\275\367pW\026\375\261\353\215\n\360Z\223\003&\255P\007re=\316\274\245\221DZ\313c\272\367\262\325J\3368\377\234\231\2510\363\0303\257*c\232\314\374\3648\016g\013\273\367N\350\3603\036\236\326\004q3!\216\026Vf\311\366\222\016>y\266X\2712/7\264\301nq@!\263\321\037\221\276OXq\203\264z\230Y\304\305\2148\nc&\3610&\324{\257\0040(\232\202M1\031\351wo\036\223\317\223\263\243}2/\255l\2031\277\237\317\347\223\273\b\022\320\362\021\320\262\001\240\345\002@\313\004\200\226\215\254\345\"k\231\b\200\345!"
+	.ascii	"\226\205\316v\016Z\313\003~,\007Y\313@\257\362\003\370\362\377"
+	.ascii	"9\332\271g-\253?\313<\237e\324g\271}\226m\317\362\021\030\215"
+	.ascii	"\211+\021\347\336\255'\237{f\267\205\354l?\032\337\313\277\024"
+	.ascii	"\357\306=\346\\\221\313\341X\334\215\177Wl\314Xd\371\333\213"
+	.ascii	"\273q3\351\256\345l\374\266\265\325\3704\336\201\325\231\031"
+	.ascii	"\371k\306\253\265P\253\270T5\032m\316{\003\006\232-\026\035\201"
+	.ascii	"6\352\002}\2540EM\240\277\006\313I\324FIu\350\254\330\2449\347"
+	.ascii	"\230nrx\r\306v7\3405\314\2708\337l\241\374\325IZ\3244\370\353"
+	.ascii	"\223\264\250\211\306\350Xi\023\354\031\2532@\363l\254\371\245"
+	.ascii	"\354\032j\242&\252\223U'\324\301\036\352\1779\332d\215s\212\221"
+	.ascii	"4%Ql\326\252T\205\272\307\234;\033\363\223\275Z\225g\262\361"
+	.ascii	":\305\"+Ph\202\260V!\226\302\316\306$\354\321\204R3\330o\273"
+	.ascii	"\025\033\223\362\245L\201\232\002r9\240\211\352`A\261\262O\016"
+	.ascii	"j\240N\311d\325\275\314k\255\271k0\376\2054\250\177\240\034\216"
+	.ascii	"-\274\356\202z/R\002\277\017\n\f|\261\f\351wA}\270'\035\333\254"
+	.ascii	"\210)\317\320\336\243'\317\347\374\216\235:tt\316]\362t;\343"
+	.ascii	"\300y\360\2717n\332\2048Zs\251{IG\237'[l\313mP\240\341k8\034"
+	.ascii	"\251\t\356\310h\3159\332\247\203\243\331\360\f\245d\204\242j"
+	.ascii	"\"B)\r\211QTB\251\"\221Xt*b(%'\247&\241qj\350\"j\352)\311\bb"
+	.ascii	"H\214\372\360C\005\225\"j\370\"\2051|\222\3120T\261\202\330d"
+	.ascii	"\374y\360\261\223Rq*F\n\241q\252h\224\032\032\205RQMD\241\323"
+	.ascii	"\224Q\250d\304\305\025\303)!U\2618%\374-\217Go\027\3515\260\207"
+	.ascii	"\2303\307\266Bo\004\2536\217\325\013\351\252\253\230\327j_KV"
+	.ascii	"\335\352\303v\255?\354\016\313c\005\262\nY\211\330k\021I\277"
+	.ascii	"\3435\214&a_\312\2630=N7_\203\331\237f^\215\254G\354\265\370"
+	.ascii	"\3143!\273\352\313\325\026Y\257\301\370o\357\005\021\223D\262"
+	.ascii	"\305;j\242\022N[d/I\212\324g\036\250\3123\216N\032$6\271&Ijb"
+	.ascii	"\341\225\314"
+	.string	"r\255K\206\302\356E\332-\024k\331\332$\375\016\251\217\345V-G\363K\2516\0303j\240\217:\265c\325vV\221\367\036\023\024\350\200\231\250q(\245\0203\320\214\220\214\310h\222B\007\200\002\221\251+z\021\220)46B\201\252\262\261w\355\001\022\023\223\004c\340\bB\023\367b\357\235a\300\320\313\343XE\023\305\376kS\375\222u\274\003\362\004\354\215dm\245V/]f\201\340R\301\340=\0247rI\200\033\340\220<`t\302\305\304l\273l%\276\215\b\2214`\024\026G\335+\201ud\342\340\362hh\003\001\350[\227\257\324\352\031_\221\273\370\256P\366A\353\021\337\375@\nlC\201\013\313\367Mr\272\215\264,G\375\262!\223\221\260+\273\206\303\250\t\001\323\336\003\247\260$\331\023\023\022\327\241\300~\023\226\350\251\352\315~z\340\223\223\371\334\260>%R\020<&Idm\177\236\245\374\016\261i"
+	.ascii	"\017\256\002\350\005\343\023\324\027\313\375w\tE=\342\255md\323"
+	.ascii	"\001A\302\2748^V]\304\315\030i|\347X\002_\2777&\222\017\353\202"
+	.ascii	"\271`\025z{\374\330\210\200\316G\f\342iVL\247\227\257\270\313"
+	.ascii	"\307\314\3012\\\0230\365\241\020\302b6q\360\177\2351\330`\356"
+	.ascii	"\312\221\004\312v\300$Pd;t4)\244f8#\004\2237 (.\"\n5"
+	.text
+	.section	.gnu.lto_gyroDownsampleSample.78.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\374\003\265\024"
+	.string	"\346\343{G\320\322(\035P\256\211\204h\360\0220\234\326\t\354\327\001B*{;\004\364\354(\023\221\016K\211\236dE\240\215:IrX]\215\327\321\243s5J\255\031\344W|\215\"\256H\f!\035\267r\203\007\373\266\2777\2212\245d"
+	.string	"W"
+	.string	"p"
+	.string	"\024\232~l\021\364\341\260\262\375\264\017\342!h\317Y\347\324\256\220P\317\356\266\\"
+	.string	"ux\362"
+	.ascii	"\361\320;\200xh\232}\343:8{\332\220#\241D\217\335\375\024\303"
+	.ascii	"i\207\236&\315?\245\244n\270\332\241\nWs\017Use\341f\274\223"
+	.ascii	"\335\275\210\347\004\234-\363\224\262\273\316\033\256\302\035"
+	.ascii	"o;\201\355\317\366\\\002\266]\276\023\203\332\335\003\376\210"
+	.ascii	"\223\230\371\032\016\r\001&\177;\364a\342\341U\201\210\230r2"
+	.ascii	"\331d\353\324R/\330\367Vo\354\347\376\022M\223hz\344i\221\247"
+	.ascii	"YO\207<\r\362\364\352i\325\323\251\247QO\237\236\216O\303\247"
+	.ascii	"\275\247\365\351\314\364ML:\0309\b\332\r\032\221lRJ\364\302\005"
+	.ascii	"J\243"
+	.string	"\246N\212\032\022\n:\265\376\323\202E\324x4\344\003uE\017\214\265\323\375\246\344i*T%\242\261`\313&\227\250\252\247p\007\315\007\033\217u-\234\327U\300\b\340\244Pme0p\024\326\t\330\355.\002{\345'`\254\335\241\211T\270t\224\343#\223M5O\2256K,\177\263j-\3251\361\312`'i&}\004/\rV`/\230h\025\224\230,\302\3127\223\305f-\257\331\327\002s\261|*\262\331\2072\300\261\007/\331\367\022\213\311\276\225\316\336[\275\261\002\017E2j\203$\312\303\265\364\273\342\210\222\250\362,\270\016\227\322\210\306\03169\021\315a\035k\207\203\245\"*\267a\035\252\006K\025\b\211)\027\242I4v \252\322\220\225\202 \035\311X\035\306c\030\025\335?\361P\025R\250qX\307\2242\2210\n\212J\n\232\003\320\002\021\261\2526\021@%\024\030\203\220\331\251\254\001#X\224\374"
+	.ascii	"\210yy\341\226\3739,8\223S\"\266\372:reW\354}\363\202\364VAf"
+	.ascii	"\007\226\333=l\371\373\203\211\"\355\260@@\261\257#/\212\224"
+	.ascii	"'+\247\204\2403\20411J\262\221\240J\317\341\276\"\246\326{\030"
+	.ascii	"\022\352\216\354\350\036\274\335]\344\337P~[%\273+\353\222\250"
+	.ascii	"\250\355\326\216WX\032\374|\352\342i\220h\021\304H\317\032U/"
+	.ascii	"\276\313\266\352m5\037\375\001d\253\026\320\250\033\033\262\376"
+	.text
+	.section	.gnu.lto_gyroUpdate.79.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`$\026\245S"
+	.string	"\252\206t\035RPPRI\007\253\357\370\350\022\237\032n\352.\323\365c'\266\356\227!\210D{~\234w\016\004\307\2666\035\304\343b\333\355\037\327\027"
+	.ascii	"\305\332X:}\007l.\006\320,\004W\020\300$\203\352\034\220h\366"
+	.ascii	")\350\356\372\377?\356n\230\215\244\021B\244L2\300\001\234\001"
+	.ascii	"\320\001\177\333o\345G\376j?\224\277\311\217\366\237}f\367\273"
+	.ascii	"\327\262+\\a\362w+\314\342&\003\255\3416\244\267\303Q\277\336"
+	.ascii	"\300j-\302@o\356\234\314q\316\270}\335\n\351\234\260\276`x\201"
+	.ascii	"\316\355$\345\342\366\004\022\273\267=\\\331\225\275\033Y\225"
+	.ascii	"\313\260B+9@H\331T\251\257$`-\320\266\034[\306\n@\221lS\326\264"
+	.ascii	"\262\206\334K\331\222\245\266_C\372\210\262\305\352e\177\262"
+	.ascii	"\301\235\254Y\345\213\360\205}Z\223E\242O\305\235\252\274-'\226"
+	.ascii	"\354\231\240m\233\232\236\021z\262\275\0137\273\222\364g9\320"
+	.ascii	"\247\"\n%/o\257\326J\342\346\002\200\336\004q\235\363fy\234\363"
+	.ascii	"\346\356\006\273\302\2330\302tW\357g\307\372\274\244\216\027"
+	.ascii	"t\250\265\0265\021\030\233\r\006\006\006\006\276<\373\002\225"
+	.ascii	"\351\203\200~|zxvtrp\206765432\302\030\0304x\232es\272\037{\b"
+	.ascii	"@;\342\325\323\203\334N`\240\261\377$\271O\222#E1\356I\002\327"
+	.ascii	"\002\363x\325}\361\316\241\276\256S\367!\272\242\227\021\316"
+	.ascii	"\351:N\027\034\n<t{\021Y\030\027\326\330o\326~\260\315\3615["
+	.ascii	"\247\331\322\342\031\022.s\272\"\tR>t\244\b\204\205A\026k/\362"
+	.ascii	"\021\306\205u|L\031\234\2622r\272\"Y\251\242\313\036\333\231"
+	.ascii	"H1L\220\205\tXYG\207\270"
+	.string	"\260|<HW\364Q\202\250\265\352\340\223\307\3152\200\275)}4WT\245\216\225\021\342\323\316UWS\\\006Y09\222\227\336\r\\XY\357\"#\304\\E\2356\265\326s\025\311J\016\262\250\265.\023\257\260\276\036\276\313\031\354\356\214\335\234\004\002f3\360\325e\371\223M\342*\005F$\237\254\022\023\027\3409\326*\305\034p\007\f,\235\335\201\363\346\212\376\2233\224\035I\255\262S\207\205\372N\230jI\350\310SL)\216,\025\003\002>1F\013\375\340\233\233\352\247\363\370\352\333a\266qs\2340\272\013I\035\332\235\024w\3514+SW\345\016\371K\270.\211H\326\nu\342\256\004\017dJ\221\274\t\2703h\360\2110\372.\374C\336\336\346\244\372i\317w\240*sO\374E\305\261\313^\267\261\313\336\013\033\361\333\353p\253\017\300j\t9\354\271\254\036Z\353\323\265\366\036\316\233\313\304\372\001\036X\255\025"
+	.string	"\034\366Z\350\261\026\353Y\005@X\302\024\003\356\356\004\337\253\201\326ZS\354\365\276\245\202}\327\315\275\240\211O\274\271o:o\276M\036\\\304\314\2408p\367,\212\333\270\373\317 \004\357l{\310n\2207\202 \357\222\214\030A\336\007~\366\205\321@\220W\351E\220\327\305\241|\223\220\202\274+N\3675\200\200 \357Q\2207\305\333\276(n\345{b\304\337\276\"~\345Kt\3447\304\325\276Co\362\005q\264\257\320\311\373\341\344\365p\362\006\235\274@'\357\317\311\353s\362\366\234\274<'\357\316\311\253s\362\346\234\2748'\357\360\344\2759ymN\336\232\223\227\346\344\2359yeN^\341\311\033s\362\302\234\274\350\311\033<y\317\223\327<y\313\223\267M\336K $\303\f\030 k\265\n\334\241\316\231l_\267\373\263\374t\377\333\177%~rC\021]\205\242\211Z"
+	.ascii	"3\"9D\3758\346\262$\224\003\037\001-\244\025\210\323\306=\321"
+	.ascii	"D}\270sW\231\0274\270\341\336\322\210-LGG\326C\321\037\372\256"
+	.ascii	"0\336\322\210;\246\243c\226\023}\031~\243\026\227\277\270\233"
+	.ascii	"\232\006\332\274\213!\361!\027=\324_Kj\027\375\030l\206\272\201"
+	.ascii	"\376\332]\200\375\245\205h\253\261\251\201\206\272\232\026\266"
+	.ascii	"\315\fsX\220\216\344\342j\332\310\217\n\315\233\333\225\231\026"
+	.ascii	"6\215\225*mTb\230\221\231\"\005)\354\230"
+	.string	"\226Q\213\202t9(0\b\235\2445y\201IL\033\371!i\370\314d^\364\313\370\264\204!\272\312\203+\r\353\354\202\260m\022\273\300\266J|f\306J\332\211R\237mf\250?\205\311\226\204\216cI^\264\220\026\022\2316\362\323\223\372R\316]dxB5F\222\256\300,\360\nI\375(\377\020\271\255\276\177\3541r?b\332\270\016\020Q\031m\3365\211\013u\325\003-\004\003\210\006'\300a\364\003}\030\316[yT}Q\034\370\022\246\215\027j\031}&w\001\246\347G\245%\202A\364n*\226\216\361\211\233#w\305(L\207\201}\241]6\f\037\331\253\013\005\244\243\023\230J\024\341o\333y\023m\243\276@\261`\233`\034rv\331\301\022\314\025\244\204-\255\363\217\315l \213\024\221\226\361\217\026A#\344\021q(\273\333l\2378\252#Q\034\250\204},\3626\364@\272\034\017\246S\021\241\354\333\220E"
+	.string	"\016a\221OS\261\213"
+	.ascii	"c\2658 \001\276B:*2\225HZu\033\365\001\212\261\325\341-q\022"
+	.ascii	"l\343\376\017\213\226\031\243_\026\007X.\362\313R\265B\021\201"
+	.ascii	"\350\252+p\256\350\247}X\027F&\202F&P\r(\230\240\006\r\034g\215"
+	.ascii	"\337\240aA\006\0270\335"
+	.string	"\b\356\214\001\232l8MPt\303F\323\r\fh\334(\302\240\006\323\005E3l\334(\032\340g\2332\240a\243H\203\246&\033E\3023\250\367\220\225\340\312\034TG\355o`\361\304_\202\304N\370Aj\363\356\206\304\211\272\352\310-E\037\365\361\316n_\250\372P\364\211N\321\327r\216\302\005\210\250\221\372n\217\261\303\213\335\210\303\375;\260\224\375\264q\327\016GY+\327\001{K8pM\360\361\272,%\001-k\262\026\357K\216\265X\013\251\020$i\330kH&S\343\333\216\333*\244[h\255TA:\205T\310\2214\354M\216\367\273\324\210\342\304\343\365WJd\247H\033IQ(\321^\251W\372\305x~@jV?\355\207\244\207\366\351\017E\234\230\312\221\210\207\240$P\373t\320\020\247k\021\302\005\364\223\364\351\236\376\331\312j-\037 ?\262z\004'=m\324#\357\217\247{p\251\266\323\303\346\351"
+	.string	"\362Z\004'\246\262#\2044\214\243\3544S\3211\221\323\303\326i\017yTG\242Jt\321\351Z\254@H\303NCN_K\026\034\243\337-rU\224j\303\276i\234\356\311\353*'t{\252\211i\330\260\217l\016\234\244Z\007\016\264\247\232*\r[q\254\2656\245)\2347o\372w/\303z\344-\224\036^\210>m\334\b\262\320\3446\251\243\344V\251\241\314\372)\202\276\\O\335c\202\374\255\355\030\320[\352\210\350\021K\303:\276\271M\342\300\271Ub\300/K\3759\036\025f_hX\244\270\013\r\354e\251D\262\013\323\231$\377\f\350\327\375^XD\330i\343\362\016J\210:t\374"
+	.ascii	"q\b\350\227\005\201\244\250Q@\306\2343#3\"\"I\222\024\032\003"
+	.ascii	"\301\005\204\030\345\240\"\363\021\240 \210\230Rh\254FA\222\244"
+	.ascii	"5\243\304\331\216?\210\324\337\244?\035\005\315\30229\320\217"
+	.ascii	"Q\362\007\024\213g\302\245;\316\r \373\210\204f\345\\@\240\314"
+	.ascii	"a\252\2510\252\265\345\330\324\210\002\347\020\342\3700\210\246"
+	.ascii	"\027D\301\263\007w"
+	.string	"\004\341\006y\025\374\210\346\032qi\232\207\311j\374\324\320M\204\252\332\364Xc\210V@\177\200\025\005\032\311\3510\030\232\007\330P \310\034\234F\303\236X\t16\222\357\034\306\226j\003\343\203]\272+G\2417\\\314wU\216\353\346x\337\332\304x\2156\326 7>\006\354\030\214\314"
+	.ascii	"BK\226\253\264\003\020A\312\217Xv!5\204*\002\337\334\2269\304"
+	.ascii	"e\373\363\363\274\205\254\374*\3605F\251`\202\213\205\314\220"
+	.ascii	"\273\220?\26668\220\357\324\006\234 \220\334\021\265\237$\324"
+	.ascii	"e\346y@\330=\224\2073\234z\357\211|\226\310\247\356dn^P \215"
+	.ascii	"d\216l\357\013\314\n\3404i\235\316\270\242O9!\343\316\334\204"
+	.ascii	"\326\200m\270\214\362\020\326f\034>\326E\372\312\200\202\277"
+	.ascii	"g2{Zh\327\265&\207\346\2631r\276\243\324\230\004r\224\342\317"
+	.ascii	"\fZos>r\fZ\330G\001bS\037\264C\277\243_\223\356\351\367\253A"
+	.ascii	"K\335\346AC\267\216\230\331\212,x\007\r\271\234\020\006]\300"
+	.ascii	"\005\016rp\372\345\225\240\254I:\363\tv\320(;\245\31738\270\311"
+	.ascii	"Q\271It\220\201\016"
+	.string	"OJ\016Z\236\030\204}S\273\332l\324\204d\345\357HRr\201y\276\335/f\341n\320\270)\277\022\344\245TiFW\022\bv6\032\330\334eQ\256$U\201R\242Hn\b\005p*$\331\272\350\366N\234\226r\376m3\n\331$\256-2O~79i0\350e\030D\273\265\030\346y\240{<\220\2560h\f\271:\362K$8\311\"Y\354\224\364=\225 \254\271\3610\016\333\272\227\034l\3615O\203\262\215}\b\236\n\346Ek}r'\322\336\367*L+\337\323u\232\032)\352\325\371\356\t\007\367v\320\262g\003n.\002\371\300\001\365\340\253\255bbpm\246p'\276\025\022\224\225P\375\216VA\251\234\371\3157\036\220#\235\233\200\311\234+G\206\\\355\347YI\025S\303\225\375\001Du\224\301\320\201\337\324U\224wAe~\261\210\205\206a\270\302\032\263^\360)\207[\204Q\345_\324\355\t\325"
+	.string	"\340\221\374)m\362\347\023a\001F\3700K/\371\247\034\365\333\365\312/\357 \241\213\276F"
+	.ascii	"\200\346\236oQ6\325\257\024$\223\221\330\227\331\362R!\231!\357"
+	.ascii	"\001Q\335\267\331/\225\370\003\021(\023S\037\264P\232\033\013"
+	.ascii	"2&\222\271\210%;\377b\303\244\223Iw^\314n0\231w\326\352\362n"
+	.ascii	"\300\315\370|\204\177\177$\375\305\216~kKI\201\244\017}q\261"
+	.ascii	"\202\376\003"
+	.text
+	.section	.gnu.lto_filterGyro.80.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`+\006\255\""
+	.string	"\006<\324I\200\030R:\273`\363 \020F\337j\340\264t\365C\271\032L\333G\030q~\361\276\365]\020V\334\313/\344h\3370\350\364\277\247,\027J\226\007N8\326\321\024\202w\277\267<\247\214\213\020\325C\353\262\276\355\023B\b\221;\311\275"
+	.string	"\261"
+	.string	"\303"
+	.ascii	"I\256\244\351Z\\v^/\fE(B\353Q\237\323>\213q\374\342\215M?\372"
+	.ascii	"\316\353u\032\031S\273\367\376\034\345\007\353Q6\273\200\364"
+	.ascii	"h\356\001\322\243\314\334\304\354\345H\342\225\260\004j\213y"
+	.ascii	"\357\325\365\017\034\367O\344\331\326M\317\341n5\266UM\321\263"
+	.ascii	"m\023?\353\226j\313\351\f,\370{.\307\327\r\020\231\302aqV\277"
+	.ascii	"\035h\365\232\023\300\225)\035\247\203\244\223\265\371\240\272"
+	.ascii	"\361U\265\361\364$ \2342\303&\bu&\260\322"
+	.string	"#\r\027\204aQU\350\212\252\352\247M\360\305\351\323u+\025|\262\375\344m\031\262\270vEu\343V\025\272\367\262\215\nR\235m\316\374\032f\346\300\214n\005Ig\342+@<J\306\323AG\326\310\216\274\367\236=d\027\351\233\247\205\366d\3150\363\211+]\254\367^\b|\261\217-\361\201\034\345]\n\373\250\243\374\024\351\321\367\273~\023VDh<\002m\263\357\275\277\356!3\362g\177\033\213\271\207gG'\007\347`\347\233{\235o\266s\235\327k\235\325\324r\212ZFO\313g[\356\266l\255\345\027\370U\0220W\304\372\fye4\317\\3\224L\310\301~\257\237\353\327\372\217`\374\260\3657\225\003\205E\210\332\227\317\023\362\006'\340P+2\267\370]\214\343b\345y\275>\344\230\226a=\222\237d\334Q~8\355\363\242\177\314\337\262\"\207\030\265,\232\2604\372\331Q\020Q\313\331!\254\312D\325"
+	.string	"\332\246\t\005\304\233~\330\355\216\030E\241\221\fh\233}\353!\377\257i,\266\241\255=\335h\366\347jK\001]\355'\037"
+	.ascii	"\r\313\317{\357\265\235\352:$\226\346\344i[K17\270\332==\006"
+	.ascii	"\304\351\214Kh\353,V\nX\346\230B\035U@\333\264k\017\331FyLwZ"
+	.ascii	"\3552\206\256-e\306\312\236e\025\037\316\222\312\206#\223\251"
+	.ascii	"\366\260\273w\272\313`Dq\262\315)\254\004\222\342C\020\245{\204"
+	.ascii	"\221\301\364\340\222L\225\314l\017\330\376\225\026\025\244?a"
+	.ascii	"\345\352\3046\220\021\311\021ez\023V. \336{#0\007%."
+	.string	"`\260\260\343\265@Z{I,\212\316#%\246\245\"\01776\nRbZJ\"\342\035\251PJ*A\264\343\265@\322\365x\273\036\212\243\236\016ER\321\222\316\210\327\323\005)\340\035\323\021O\247b\267\343\351p\310\373\337\306\342\r4\314\200\355\304\276\363\336\253\n?\376jJl\023\r+s\3133a\222L\346\207Rf\r_\033\312-\231\317\272\r2\203\207\260(&\327C\266\241\335t\272\321j~~\273\365\311\340z\310\267\326\351\177\235\201\225'9M\206\225\0038|\214\317F\f\005\031L\241\261J\307\342t\332\214vN\213\340\021\246G\001L\207\217y\270\332\207\n\313/i\253e \336ED\032\332\352/\313\332\361\306\336\364\331\314$\210\354\243\002~\250a,\244 cf\244dD4I\n\351\220\002\2311\252n\021\240!3\020\321\004\231\f\233\001tD\247\367\364\215\030\3454\332\300\363\342\016u\314\204>8"
+	.ascii	"\231\232\247\0230/0\356X|$\203\332\2176\207y\222e\213\317\233"
+	.ascii	"l\215\204\302\r\360\004\317\242\260\210a\022\222L\361jc\347\007"
+	.ascii	"\214\374\336\374\003\030\334\374\305\005\213\007I7\bN&`\033U"
+	.ascii	"Nh\342\222\301b\0333\223v/BS\353\300\225R\356\331\205\357\033"
+	.ascii	"\250a\\\220\"\246\336\224\3541`\355w,\221Q\222DX6+\231 \\AAo"
+	.ascii	"DK6\353\204\035Rn\336eo\n\312\330\322\017\367E\225\f=$/\242\201"
+	.ascii	"A\004\256|\207\007\333\246\210\233i\3029\253\322!I[\331\313\265"
+	.ascii	"[\312~\362]\266\311\330\327A\221\273\377\250\261\264\016\256"
+	.ascii	"\020n\211\311\361\2149D\r#\254\246\f1\362\257\f\006\206H17\342"
+	.ascii	"\357WAs^J\247\002"
+	.text
+	.section	.gnu.lto_filterGyroRpm.81.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`;\005\255\036"
+	.string	"\246u\275J\240\226U:\304/\004\203\346\352\200\321\316\024\b\210}fg\303B\275\033x\346\004s)\031\245Pux\274=\303\267\354\365\350+8\262\370\001M\323\30689o\314+\337\204\037\360OL\321\311.\370\325\304D\333\326\b!d\313\235d\246"
+	.string	"\237"
+	.string	"\253"
+	.ascii	"|\341\207\271\023q\366>Y#SY\367^\235\227\f\001}\311V\027`\276"
+	.ascii	"\204=\200\371\222\231s\314^^\f\336\tK\214\230\220\367\336Y\377"
+	.ascii	"xq\337\026\317\255\316\035\366r\305Z\350i\226\266k\216\257\364"
+	.ascii	"\332c\332]E\361\210\016\313\001\365\003D\220n\324\027\216\273"
+	.ascii	"\256\303\361\230\005\200\005I\207}`\334\325\226\217\236\215\243"
+	.ascii	"'\215\233\226\200\217\212\f\031\317\310*\270\322\203\313\213"
+	.ascii	"\347\242\226g\317\257W\343V\306kas\234^\217xE\265o|\255*\n\311"
+	.ascii	"\374z6^\317\236{/\327\027\274\336Yv\346\307\230\271\003\263\255"
+	.ascii	"\n\\\342)\013\364\336\033\201\317\344S7>\220\227|\"E\375\213"
+	.ascii	"\227\374\024\346\313\367\235n#U\3047$\352j\262\357\275D\335@"
+	.ascii	"\346\"Q\375\355$f\234\033\233\232G\235i\376t>\3157\235\313/\235"
+	.ascii	"mW\356\256\\k\345\017\370/\t\030,L\372\252x"
+	.string	"c$\315\\\253\222J\310\243\376\247\277\351_\372\211Q|)\224\b\t\307(\213\220,\250\234\242\342\345Q\270\221%D2\361\235\370\325\304\251\275O\037B\344\242\001}\221o\344\327K~\222+\311}\211\253\354}\312 \214\322\203\276\314\261\365J\374\n\261N\342\326\021\305\351>V\235\333>\332\271\355\033\037\340\230\345\366\336{[\366,909co\332\354#f\007\267\215\323S@vWM>\263\2258\025\200\005C\372t\324\320\325dE\033\310\262\224h\332\364\331e\252,\373\310\212\323\002XVp7XU6\020\221\310\263\201\335m\323]\345B\312\256&\251p\2723\005\227@J\367\207!\203\351\261\305h\246\314\\\021\324\376o\251\212\320\241p\212>\251\2753DB,Q\334\t\247\f\202\367^\t\314\2657\301\031\b\276\244\272i\236#d\250^\274\367\332\0062\013\363m[:\026\3252\314\001\"0d\270P\263\255"
+	.string	"Bo4\025>\366'hH\310\307\203\213C\360\004\r\t\321@\330~L\004\321D\200\250\331V"
+	.ascii	"\315n\266\332\215\304\317mF\202\346#4\013a\273\315x\026pm\350"
+	.ascii	"\30763Q\253\331f\257\342\375o'\361\206\031V\272\3361\316\336"
+	.ascii	"\373\263p\342\237\245\244&\277p\352\245\fcD\"O3\231\201\276\205"
+	.ascii	"\006\303\272\367F8^\3515\210\f\036>\241\030X\003\271ut\325t\037"
+	.ascii	"c:?\317\376\230W\003\371\354\232>\324\033\\\201B\323X\234\016"
+	.ascii	"\b\216\370\025N\246\245B\f\244o8\264 H\323\227z\335\001C\350"
+	.ascii	"\033R\351j\262]\r\344\377\001k\250a,\305\230Td\244d\202\314$"
+	.ascii	")t\240\002\2311\262:\021\240\245#\210h\202*\303ft\253\263\222"
+	.ascii	"\242\224c@\237\335\232\030kY\237\t\264\277\241GL7\247\f\035M"
+	.ascii	"yp\"O\223\020\270*\254'P\200?}\216\225\r\210\031\232\2101^\237"
+	.ascii	"\364\302\375\\\211\005\236\231@\354\3524\tZ\257,\222\236\264"
+	.ascii	"\363\355F]\f\231Y\240\372(\330\226\004\333\b\031J\301\020\222"
+	.ascii	"f\021\205\304\342j\225\212&\216Y\226\275\223\345\246\250d?-+"
+	.ascii	"\240\270\304\326\360\266%\001\363-\255\326\216\260\362\031<\020"
+	.ascii	"lF\237,{\036\261\366\007\205\033\322\275\245\316\001G\377\277"
+	.ascii	"\037\b\034\355\030\312]5\314\333Uy\253\005C\231\226-,CSf\250"
+	.ascii	")`\211U\271\2072\017,5\307\266\231\005\261\310_\337\372\003"
+	.text
+	.section	.gnu.lto_filterGyroStatic.82.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\236\005\225 "
+	.string	"f9\312J\220\330Q:\300\321\372;\241\231\303\031\017.\301\243xX\344\376G\033\362\212\311m\361bD\212\3067\236"
+	.string	"\311\"\377\371/\341\364\307=\031H\254%J0\022L\206\030\013\221\327\205\035\200\033S\234EY\221\262\366?i\204l\271\223\f\264"
+	.string	"\251"
+	.string	"\271"
+	.string	"Z\027\206Lz\320\2339\266\276\212m\374\341\211H/\366\354\325\262B\276\312\356\275:7\331\001z\223\305ns\336\274\035\300y\223\231\221\230\263\334(\274\021\2160])\357\275\271\336a\343\2765\236i\215\364\233\255\206\243\241\263\323\264]\221\370U\257PWJc\\\277\244\337jl\275"
+	.string	"\220'\032\325&\365\332}R\307\331\231)O6l\203\243R\245\351\200\232qt&\343\247\025"
+	.string	"|\362B\346\307d\021H\311Af\373\261\250\346\254g\n*\352V\346\267\302\346d\275:\375\226j\377\370\032f\034\202\231\202\232\361:\353\271\367rm\372A\235e\316|\0343o`6!\004<C\300\200\335x\357\265\035d\025\347{g\225\\\252a\230Y\367T\005z\357}\300\367\372W\t>\217\233\3143Q\337t\223o\342\274\371~\326i\272\202"
+	.string	"\211E_]\366\2757\251;\310lL\252\277M\305\214scSCs\256\363\314\265\316\350\354X\347\363Vg\323V\266]\271\273r\255\225/\340SE\264L\361\3521\343u\261\024s\305L0\037\347\372\265~\254\337\352/r\361\273\320\244\247"
+	.ascii	"LT|\224m\345,\031\357O\002\215\262\241\362\212\237\3056,N\355"
+	.ascii	"\325\372\217\"\031\006\364F\376\221m7\371En\004\351V\034foB<"
+	.ascii	"\302*\266;H}i\212\341\253\313\242\004\302\231~\327\353\215\026"
+	.ascii	"C \021\314W\227]\353 \377\3075\025\323\222(Nw\262\352\334l\247"
+	.ascii	"\235\233\375\343\001$\251\334\336{/\315\316N\r^c\354M\317\332"
+	.ascii	"\211\231\301\315\306\351/\036JcX\300YWqj\203\274)\2016\242|u"
+	.ascii	"Y\321\016\262LZ<mz\206\345\313<\333I\214\323\001\310("
+	.string	"\275\032$\224\fE\245r\326\301\356\266\351\016c\321D\251.\237p\272\343\244w\240I\367\007\"k\311q\345x\246\314\\\r\324\376\224\025\024\022_\302)\252\244\366\016\221H\321<z\022N\025\b\357\275\020\230\211\216\244G@x\023\354\246\003#,\\\250\240\333\245\bByB(|,\320\220\021\221\017\207\032\377\360\f\031\021\t\211\330\001\035\r\t\215\020\241\333\245\b\312\361v:^\021\020/W$\344C\224\373\331\361r<\tXg\004\264\313\035\351t\273\234\315x\377\333T\234\001\206\230\257\225\270g\357\235\242\360\342_f\244.I\274\013\247\\\314-G\245\362 Nf\017\327\002\342\206\274\367>({\325k\217\0278\200C.\267\0162-Y\253\351N\342t\216\242}/\266\0162\3325\375\255/\220\262\204\246\263pz\023\342Xz2H\262\t.\224@b\324L\235i\333\314>?\365M4\235\263\242\223\230o\345D"
+	.ascii	"a\023\022H\002\362&s\320\307\002p\250A8\244\234cd\304d\202\314"
+	.ascii	"$)t\220\002\031\262\252:\021\200\2453\016\231\202L\206\315t\323"
+	.ascii	"\351uB\344\030To\340n\373\023\225\366\307?l\007 \3362\317aIH"
+	.ascii	"\300\363?\322nc\211\226(9\234\343\306\216\311\024\241\274\350"
+	.ascii	"\267\034\374\002sl\002\004A\366\211\210\307\357\223\n\334\373"
+	.ascii	"\353\230=\231\t\030^[c6\331+\204\334\263\013\337W\2428\312#\""
+	.ascii	"\244\306\324\354\340`\236w,\345)\354\204Y\200!\t\273N\353IX0"
+	.ascii	"\313\001U\262\211\3240o\254\262B\211\223\276\240>A8\216\334)"
+	.ascii	"\017\252\235\341\345\217\373@1\212\272\263mp\265\346\0370k\""
+	.ascii	"|9\355\240\375E\273\353\304\343\244\016\266\334WGyi\003\213\r"
+	.ascii	"7\312\\Pf\016C\007\343\243\316u\330\347M\231\301\b\251\232\266"
+	.ascii	"\324<\b\302\370B\326\037"
+	.text
+	.section	.gnu.lto_filterGyroDebug.83.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\222\r=;"
+	.string	"\252`,\025AP\244N\007\323\364[\337\341&\371\252\032n\001\376\033_S\301\343L\300\202H22\3438\302\370\205<\374\261?"
+	.ascii	"\200`\210\021\221B\264\340\243\275^\256p\"B\021\261:\304\350"
+	.ascii	"\240\221\220\275\367N)\245B\001\"\001H\001]\206dhJ4\340\304\t"
+	.ascii	"rY\236\331\335\264\254 \202t\203[\270\365\270\230\307R\365\356"
+	.ascii	"\365\223\250\235\255a\333q\343q\261W\356,\255\205\331w\374\247"
+	.ascii	"\336\275\nte\264\206\275.U\357:.r\3235\224\331\3211\365\356\251"
+	.ascii	"U\372\004\357\275\006z\345\005\303^\271M'\331^\215\215d{ef&3"
+	.ascii	"\236\266{\273\016\274\320\3302x\357\275z7(\376V\355\232\221\317"
+	.ascii	"\354((\345\223S\023\323\222R2I\n\211tdTt$2\026\207\210\303\226"
+	.ascii	"]\325w&w\253U\327\256\266\305\f\220/\215\254\243\242j\002.p\016"
+	.ascii	"\005m%]?\321aq\247\271n\232\223s\246\271+\276\024\327JqN<\031"
+	.ascii	"\327\245\211'q\227A[J5\252S\023\23092\211\032\223FZ\322GK\224"
+	.ascii	"\270\321\2227/::\233Hur\252\001\210\270\261\325jSc\353"
+	.string	"\342\033\264!\352\362\336+\304\207\246\332\324\20241\n\032\020\037\366\033\264 SQ\320\326\274\375\321,\215\031\276\366hU-\340L\303\343\230&CM\2729b\247\365\332o\244\235\3717^\373\237\035\035a\233\032\223\366V\353\336\313\336LSk^6\263{1\363\006\346\242\230c-\346m\215\372\235G\307\217e\235O\320\372\317G\303\325\340\255\315\364\031\r\274\201\203w\223\003\333kK\250\271\247\314\013\351\232\fW\263\231\336{\261\230;\364\030\017\1771>\364\337\024\016\006\333\353\177\263\241\343\307!:\f\214\341\275\227\0017\230\366\033\301\r\327+\223(Q\342[OI\264\314\013\273\313\364\310\324P\377\311I\335\305\366w\222;:g\036\210\271\277t_\0277\034\233\360\362n\366\312\355\305\366\332\337z\215|3uB\327\312\274\360\357\275d\377Of;2\357\373H\230\267&hea1h\276f\005\275\327\\E\325y\315"
+	.string	"\372\256yJu^\262\316R\356\034\245:C\261\316Jw~\032:;\265\316MFg\246\242\363\322\220\263\222\352\234d\235\223\334\0319tFj\235\217Tg#\326\271hu>\256\316DDg\243\352\\d\235\207Vg\342\320y\330:\267\2523\313:\257\253\263\252:\377;\273;\267\205n\313\242\347\315\227\007\264\273;\n\007\3356\253_\\\363u\357u\347u\337uG\231\233\217;\022t\034}\353F\215\\\264\212\2007\005\337]\332\331r\3209\241I\377\344\356\226z$L\fD\332\372\017t\003=\3657\270\247\276\377\334\005\252\367\336\213\374\347\324o}\037\234\031`\236\223\352\353X\232t\200c\320\t]C2B\340M\267Q\364F\257\224CU\364-[\221\263';\372\347\264\373\361\340p3R\217"
+	.string	"\276\370\245Pq\302S\375\r%\016\267\242\177\362Q\032%\322\372\366N\237\021\300\337\3603\226BM\335l,i\352e\031\242\203\203G\242?\276\326\377\337\2143f^\350\227\245\b\n\307\252\n\035_\004\224\365\034\251\203G$ef\247\"\372n\273[s\346\201\344Z\020K\207\201\210\036\001T.j\034d\351\2007&\226\0064\026\365g\302[Y!\364k\273{o\361\237\374\305\032?\354.\360\314\003A\233\317\327\036\343\023\2502T<\320\202\\\315\346-\317\320\027_)\2078d\207\245\rXg\254\375\004\022\277\001\375"
+	.string	"\224AK\210\017~n\370O\236\372\341\207\265?|\277S\327\200\022\206s\332\2070\205\260e\343peM\341ts\317\372\3543\375\321(\024\345\3523o]`\273\271\376\362\354\311\270\rK;\017C\263\t'(T\220"
+	.string	"\026\006\003\305P,\305\213.\325kE\213\257\256\016Cl\302jE\213\257\024%\302\274\\\254Hq\242\004X\030\f\024Wba`b,\274\304\256X\244\350\372\2722\021&ve%\200\301Zx\205]\271"
+	.ascii	"\003\013\273*\332\335\356\373H8C\2176eo\306c\352\275m\021:\332"
+	.ascii	"-\250\305\013\275\216\245\321u\017\336\340`w\261\314L\"\216\245"
+	.string	"\3138\235s\302\243\210\223\256O\324?\231\030\250\314\372\017\2242\320UUPU\237\365\315\245\t\270!\203u\205\245Kolne\354X\005L\241\234+\227?\205\353\301T\212\324/\237\tK\352\331\247\177\362w\027\033\365\235$.\352\263v\b:\241kNP\317\314V\336\004N\371PX\312\246'%OLNM\357\344&a\230\244\351[7s\b\243W\316\340\231\236\227\036\353C\024A\202\342\301\021\346\221\356{z\033\323-\302\324\b\323\267\177M\037e^\250\304\331\230L\234K\337\222\305!$\340\n^\351\231\231qL(\336M\006\277\224\361d\314.D\205\322[\323\2030\245dM\231T\034\b\323\212\325\232\322\203\020\002\250\351c)\371<\334\207\367\360\346?6\351\223\n\222\224\220\377s\236\206\374\306\243\223\254z\244\243G\362\035\001\201\037\250\2014C\225S3\"\"\"I\n\2224\006\301\005\304\030\306\240\273\r\021"
+	.string	"%S\222\251\231)),ct\n\035E\225\331\321-f\224\251\355\310g\276`\354\256<\007\252\204#\316,\273j\230\234\007\206\231~\342\335\1774;*^%\235\277\317\343\013\373=\3149\f\2431\255\271\237\361\016\006\250\250V\303qF\254h0;]\\3\021\267N\030z\b2\321?\031D\250\337\237\243\005\376\356\307k<\022\207\321\302\206\255q"
+	.string	"\301>\345:8\031\303\341&\342\026S\261\200\332\237\002\316c\267\373\r\367\255h\220\\\227?(\366\023\030\370\307\207w\247\304\003+:\372\366\273\3446"
+	.string	">"
+	.string	"_\317\023\221\260\304\242\314\0054\2148\3762R\366\352\330H\rF\241\300\230kM\354j!\212\022B\315E\333\221\255T\3556\253\021"
+	.ascii	"\036Z\210\276\322\\\253\006Q\214\362\3314\351\336&\321a<]f#R"
+	.ascii	"M\2132T\232\377\251\254<8\201u\370\275\237k\247\314`\277[\356"
+	.ascii	"\205\234\f,}\257d\253i\267\257\271\2757\262=3\353j\235v\364 "
+	.ascii	"3\264g{\235\034\361\230\305A\322\303g\006\251 \306\243<\0354"
+	.ascii	"\312y\377X\f,<H\034\354jfC\326`\214;\b \024\f\220\026\223\257"
+	.ascii	"\274J\316\377 \333k\372)\305*\b\313\231'\377\034\230A\3439\344"
+	.ascii	"\034\314/K\254qb\003\307J\016:\315&&\261Q\346N\331~,\020i\271"
+	.ascii	"l\213\314\216\215\345a4\b\314\020\322\240\t>Q\241&\334\374C\240"
+	.ascii	"\323\n\bD\001\360\013\220\031L\026\036\225\352\366\"\244\314"
+	.ascii	"\347\ra\351{H@\203\342<z;[l\334\005\335\2603\314\323\215[\016"
+	.ascii	"\376n\303\326\005\t\263\342\377\227\230 \234\320B1\tz\027\r\273"
+	.ascii	"]\346\003\331\002\364}6\"\t\333\317\347\325J\356n\374\257\023"
+	.ascii	"\001\207N\216\376\026\207\357N\005T\347\305=L\235\221R\215iH"
+	.ascii	"\356]y\267\031#\242\233\321\245)\261I\227\321\177q\n\025"
+	.text
+	.section	.gnu.lto_gyroFiltering.84.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\364!uf"
+	.string	"z\237\354\"J \016[\351O\336V\023g\023\030\212\006\020\004 '\377[\350\202h\223\237&\034\316L\3540\375x\366\"\255\025\301\351H)~!"
+	.ascii	"\212.\b\323\373\236\276=\272\023\023\336C\032\221\323\"\036\324"
+	.ascii	"\002\356E\254ED\210\334;\245\224\002\020\002\350\0017\002\326"
+	.ascii	"9IuFB:\037Y\347\r\326\331\310:\027\251\316D\252\363\320;\013"
+	.ascii	"\251\316AHg \353\254\301:\377Xg\037\325\271\007\351\314c\235"
+	.ascii	"w\254\263\216uN\252\316H\325\331\276\263\372\316i\352\374\357"
+	.ascii	"\354\357\334\335#\351\013Z\230'{uOf\360\266E\345\334D\325J\222"
+	.ascii	"~\322\314=\310M\370\204\261\364\205\273\255\343.\005\275\306"
+	.ascii	"{oU\253\354\225l\225\233\205n\342A\017\362\277!\276a\376\335"
+	.ascii	"{yZe\366\200\231\247U\347a\346v\346\376k\300\265\003?`\235{\205"
+	.ascii	"\004R\271w\360\212\247\222\255:u\221m5\355!\333*\257\314hz\360"
+	.ascii	"\356*\355\321\255\021\276\271\367*\277\b\177\247\203\315^\276"
+	.ascii	"6\330\227WW\030\327\226V\210,%\326\225U\025\325\224\024\210\250"
+	.ascii	"\017\036\240:<951-)qHB:\332`TD4$\024\004\244\341\307\247\207"
+	.ascii	"gG'\211\264j\372\276r\247vzn\330\336\314\032\314\261\277R\240"
+	.ascii	"7i\026!\032\367B\222 \002\227\246\273\372,M\2079\202q\203\343"
+	.ascii	"\\\214\275\325\304\214k1\226\361\020\214\213\236\245\204~q,\030"
+	.ascii	"\372\n\006/n\365\354\252\347\013N\325\245\247\272pq\251-\rb\213"
+	.ascii	"\323\243\016\373\303\341\024\367`\330P\206.x\207\026\372\251"
+	.ascii	"\005)\356T\330M\205\202\316\024\330K\201\200\256\364\327\034"
+	.ascii	"\376\230x\022\022\324\317\217\372zC_\0227B\322EH\2168\221\221"
+	.ascii	"\0362\242\347B\320\016\202\3429\320]k\270\003\342?\314\366a\376"
+	.ascii	"\360\036$\t8\037\315\223R1\237q\r\306\315GZ\024\203\335\231\026"
+	.ascii	"\354\247%nu\276\263B\236\005r\243\263@OB\334\240\251\016\030"
+	.ascii	"7h\352\264\304m\316\223\357c\360\317\017\271u\344\004+\330K;"
+	.ascii	":*\177\216\252\332\316[\016[\224\207Eo\355\323\026\002'\327\237"
+	.ascii	"R5Vi\363\363\226\226\026\265!ak\301\366\035oh\356H\022\367^v"
+	.ascii	"\2667\270f\021\315\234\256`f\021\314L2\002<\337\344\242&\263"
+	.ascii	"\352\267\nN\026\333L\237!\3436\302(R\244\260\255\252\337nsh\034"
+	.ascii	"\345:Lw!\031\277\235E\356,Nt\343\366\3424\2229#\206[\221\237"
+	.ascii	"J\30003yw\335\356\340\235\332\n\222CE'~I?\306\034c\337{\257\016"
+	.ascii	"\016\373,\372\211\343\205\177$\306\271h\322E\324\331=P\370\022"
+	.ascii	"\035\033\221/\270 v\027\216\321ba@\307\\\351*M\001\225D3\177"
+	.ascii	"\004\353Q\302\032\365\233X\270\263x\007\271{zJ"
+	.string	"n\020+\334W\272\227l\253t\203\177}\367\336\251\246\302\314h\222\367\23253\307\3275\376\365\335 wj+H\232\317af\031}8\305?\306\234\323\261\365\232D\311\222\0069\363\2141o6\356\3021L\022\321\336\214\021\001\373\212\3747\231\231\314\366O\340\244L\232\303af\032-\205,y\357\355\342\216\322\205\025p\033i\225kX\340\315f\201m\265\377\253\03062\001\003\317<\312<\210\326\035\215F\345\3707\231\273\243\321\250\034\376!\314\375\244\271\343:\260\273\335R\347n\353'\315c:\316\022\3508\317\260\316\021Xg\b\254\363\003\326YF\3229\206u\206a\235\035\260\316/\254s\003\251\263\213\324\271\305;\263P\235W \235UXg\006\254s\n\353\274\200uFa\235\025\260\316b\3269\001\325\031\001\244\363\001\326yi\235\r\260\316'\254s\001\326\331\204u&\300:\227P\235I \235GX\347\001\254\263"
+	.string	"\3269"
+	.string	"\353,\302:\207Yg0\353\374\245:{!\235\273\2543\227u\006\300:o\251\316ZH\347\020\3269\313:+\2553\226\352|\205t\266\262\316U\326\231\312:O\251\316RHg\020\3269\312:\177\260\316\036Tg(\325\271\203\352\374\244:;\275s\223\352\314\204t^\262\316J\326\231C\017\b\366\356\\|&\354\354\031\240\277\302\312\327g\240\357\267l1\320\357\023\353,\320\347\373\372\236a\261\352\233l\324dv\217\312\353Q\330\353z/\256."
+	.string	"~\353\271\224$Y\272!\222#"
+	.ascii	"\350\345\341-[\361\356\213lM%\221\322\372\346\017\t\361ZY!\224"
+	.ascii	"\217\365YoB\220\245\033\002a*\337\307\327=\335\262\025\177N\016"
+	.ascii	"\013\204^\3247{\220`\365WUVT?\365UponmTW/\302\207\360;\236\355"
+	.ascii	"uL}(\342A\312\352\327^\r\304KE\201\370\360\036>\352\321\376l"
+	.ascii	"\351\206o\366\367\303\234G9\313V\214\003\307\003\024\242]\007"
+	.ascii	"\2507n\330\314\260F\215\fPOQ\247\016i\320\2341Sf\331\317Eh\207"
+	.ascii	"\2468LO?F1\f\230\030\022\277<-5\271Qrz/\317.\\\266,\373\251%"
+	.ascii	"\213\023\207&\304\2469~\320\226\"\343&\321\314\037\223\230\254"
+	.ascii	"TYz&\245%\016\237\364J\207S\f]\340 \2450\n\024\302$\2440GHN\232"
+	.ascii	"\034=\322\206#\243/\372\r\202\201K7\004\3743Z\301\257o\331\212"
+	.ascii	"|*\024m\020\0224\"\302r\024\366NP\222\004\311\021\242\"&DC\217"
+	.ascii	"\347zy\336\214\305\026q\"&ZLs\331\317U\317\207\270\335\320\220"
+	.ascii	"\220\233 \324f\f\027\241\007\302\004\372 \r@?\357\363\032\352"
+	.ascii	"\350\346\344~\274\007\tq<\340|\202\334\314i\007\324\363n\253"
+	.ascii	"`\023\336y[\263\251\341\371\236G\"\\\2333\345;\317\274&YO\260"
+	.ascii	"\315\306\363Nio\306:\237\374\235G\362\242\266\004\315\243{\036"
+	.ascii	"\002;\035q\307\322\r\235M\254\347\270\016\235wD\274@_cg\263\271"
+	.ascii	"[Sp\265\225\257\031=\307\262\025=M\254\2658Z\362\233\r\236\206"
+	.ascii	"o\262V\223\331\350\017\362\312o\364\252\037\345\304\201\343\210"
+	.ascii	"\364\371&7c\253\257V9\214\323c\337\315*8\242\331t\233\325oe\262"
+	.ascii	"\002\256\200\266\325#F65g\036\265\3525\253`3B\357\275_\314%Z"
+	.ascii	"\215\211\026s\242eX\366\023\201n\024\353\303\273V\323\330o\306"
+	.ascii	"E+g\036\355\235\306*m\0027jp0\226\336pAvA\215\026\032`@VV\266"
+	.ascii	"\001\r\037\246\201e\243\254\203\n\2247\312l\334\300\200\354\206"
+	.ascii	"\022\203\032c\027(i\224\335Pb%\261\215\f\310\312\224\032\330"
+	.ascii	"\260Q\246\344\031<k\277?\204\223e\036\023\317\036\rL\202\327"
+	.ascii	"\353\031/\301\267\032\023-\275K\361\030\313\032#2\242mu\306\267"
+	.ascii	"\340\323O\356\353\233\314\223\327\325q\257\346\205U\365\330\357"
+	.ascii	"\030{'\322\251\3277\307\276\343\336\310I\336\0275&\032\021v*"
+	.ascii	"A\233Bhyn\"x;vF\335\t\201\340\033\370\b^\365\242\306Ds6\247\367"
+	.ascii	"\236A=\360\020\310x\030\377\300\267\332\222\030/\343\225\b\325"
+	.ascii	"\032\317<\252#\005\262\356H2c|\223\301\013t\340_<\f&\332S\204"
+	.ascii	"\264n\345k'4\245s\340\373)WB\333\312\343\3057!\036\b\177)\t\354"
+	.ascii	"L\246<\322\270\225\357m\345\301\303\266\332\3007a\253rtY\034"
+	.ascii	"\377\273\276\311\035\366C\\\274\271\370\026\354 ,w\314\037\\"
+	.ascii	"\\\336n\317\335d-a\235\353\271\302$1\355\315\266\272-\025!\035"
+	.ascii	"\001\307Z\267\376\370a[\355\266\357&\355sD\032\231\200\203\367"
+	.ascii	"^\255oz\351\026\357*"
+	.string	""
+	.string	"Iw\340H\331Z<\326b\207\370&\367jgY\254&\244k\253]\362\336\264.Ns\244jk\263\310\212\207g[e\3611\350\016\035\003c\350\366{\257Y\326\212\024-=S\361+\030P\221\342\025x\006\026x\024\237\":\347Q\316\002p\034\337\270i\203B\354\023x\005fX\243F\006\2614h\030\317\230I@\311\004\353\233\274\b=\340\021X\036`\300\233\370\345\211/\340\rP\024\023\006\314\211\304/0xy\026@\300\227x\023]\270l\321B"
+	.string	"\026\304+V\252\224\270\372f\n\315gE\342\235\253`?\371\303\021O\342\217\330\f0B\200\017\373\001\036i\212\232\222"
+	.string	"^\304\013\360J6.\260\363\237-,\037Q\212\330C\271+\f\340\377\211\007\205\235\376H\270\3629\233'Kgt\"\346_\276\211\210\367G<+`\377\365a\317\304\370\203\354t'\364\005\227\036\005\372\201b\375\b\r\202\234\250\342\260)\016J\205fD$(H\n\222\2441\342\f\b1\216Aj\325\016\022\200\362$\204\322$\211A\267\304$\325\272\001\323\221a\236y\343\340>$E^5-~L\353\271Gc\341\020\221*"
+	.string	"]\370\337m\362\214T\275\334I\220=Y\270\221C\243\303yzF\265)\032\226\213\032\336\023\337\214\325h\340\202q\237\\\351S?V\\\220\266\255\r\004\260\320K\021\t\367\343\233\266\305\236T,\336\207\364\2245z\013\033\np<\252\350\205\016\252\246b^?\232Z`\226~\n\002&\245\036\220\221\327t\324\177P\373\233B\334iA\241\221L=>_\213\311x\023\314\333\301$n\200\264\260\351\250~\nbB\016\217E\300\0241\235\223\221^\2358\240|\212\212X\256\022\032\264v\350\305r\226\26558\213 \2656\027\006/\235\016\246\261\216\277\205\345\200\312\024L\367\374\325\362\267Mo\bL%\373\3278\301|?\327b\272x\243\272\376]\307\274\fM\003U]\200P\351\307\311\037\331z\246]\233z\240w\307\300\371\373"
+	.ascii	"$\"\253\2675\244\304\024\314Y\335[\305\2224\327\331M\247\350"
+	.ascii	"#v\2725\256'\307*U\202]\303\213\222\330\323\366k\334\321tF[\356"
+	.ascii	"3\211\006\273A\003\314\347\226\017\261h\220\307\243\331\271\324"
+	.ascii	"#\365?\322\213O\367\331\222\034\205;v\251\007\b\323\033f\336"
+	.ascii	"<H5\004\016\362\350\230\330\3554\222o\177l2c,\24742r\237\345"
+	.ascii	"lb\375r\363\\\310\220\353l\034\234\016\333`^\301\334\035\202"
+	.ascii	"\372\266_\020\277\002\246\255 S\004\022q#i\314r\221\212#\204"
+	.ascii	"\346\323s\020\267\301\312\35403\362!\277s\227<\243\375\212Q\321"
+	.ascii	"\331\337\343\356\316\323x\"\252\260\247\275\024\f\033\347\\\t"
+	.ascii	"\017B\304I,\243\26201\275\003B~dY\272\355\332\0239L\025B\267"
+	.ascii	"\3754R\277+\342\275Q\211\255\326\242eIu\334$\276\333\254'\374"
+	.ascii	"P\260\002T\256\277y\317]*\347\232\257\312\023\222%\370\374z\177"
+	.ascii	"h\177\305{\022\241 \256\245h\376]\231\262\375>0J\246 ^\003\232"
+	.ascii	"F\234\"\244Hu=\226x\221\024D\245\021S\003=\375\262\251\006[\006"
+	.ascii	"\"\372M\272\371s;vi\376\301B\256{\bD\363\312\354\323\212_\307"
+	.ascii	"\304),\307\254\276eb\226)\320\336{\244'n@\305\276VPl^\216\373"
+	.ascii	"\220\247\255p\343-t\324y\252\234eB|,"
+	.string	"\212C\023\375NU<\276/\271\263\376\034\007\255\226\242\325]\242:\2117\325!\003\030'0C|A\367\bH\252B\314Q<c\235\265y*\237\004X~1\222EW\364\023\036\t\007_s;\373^>\t(\346\314u\023\327Em\360\020<#8=\221:4g\336\267\222E{\317&\321gA`=-lXdJ|\313\251or\271\233,\240\231\341@1\212T\322\2130#2v\303\311\026[\373\277=Z?Io`^\206\304\323\235HMC\221\222\231c\305\352\323\203\241?{\323\3120\303\205\"\216\001\347\243\024Q\027\227`<F\376\373\256\346\252\242\237p\033\377\204%\226\\P\006\240\230\034\251\210Fk\035(\fG\343(\267\344\252\217\327\271d82U\332\f8\006\241\354\311\272)\353^4\242\375By\257HU\362b\2700v\203~\233\367\3478\005\004\305\216\006\347\2168i\203\twn\024\320\321BO"
+	.ascii	"\324\2402\242\243A\322V&H\242\203\237?\017\025\311\230a\325o"
+	.ascii	"/\354\356\273\375\225T\306{\243\244Uk\0332\332\rcB\016\037.\006"
+	.ascii	"e.\332U\304\330\t\004FQ\266U\312\361\t\024\234R\266\251\220\261"
+	.ascii	"\023(x\310\307\rE\2517\225\325\351\025\032\222-uj\311\211+\224"
+	.ascii	" \215 \311\001\036\001\240\212\335\250\3638\rR\371\352\351K\307"
+	.ascii	"\320\273?\224A\266\245\211\n\211b\237\242\341g\307\b\205w\b"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.85.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\260\003m\032"
+	.string	"\206\362\253I\260XQ:\360\347\357\201\205\374\350J\327\261\373\240o^\330\231\214\224f1m\372\362B\367\016l\363\225\253\025h\370\332yB+\262!6\256'\344x|\233\301y\001\374\035\002\362a\001eu\314\252\372H5\"\204\354-wJ\001\224"
+	.string	"\214"
+	.string	"\227"
+	.ascii	"\265\362hN]a<E0\245\255c\243lKi\177\350>tN\344\244\017\250U\006"
+	.ascii	"\320H\255<\007f0\236\232w\002\341\351\370Tx\032A\202\216g\347"
+	.ascii	"\351V\304\354\216lEO\265\362TK\303\373\311\273\351lg\037\305"
+	.ascii	"\220\316\2253\377\345\266\363\361\264\240\213\276cxbci\350\n"
+	.ascii	"\f\240\240\207S@mB\370\365H\212\243\305\247X\363\373\314\201"
+	.ascii	"\203\322s\022rk\361\rp\263M\004\265\326\377\270\374\271\361H"
+	.ascii	")\326\324Z-}n@\267\313m\323\260\375\301\336\027\001\362>\247"
+	.ascii	"\276\227\302\323\357\177<\301-\211\316\205\217 \232\f\332\274"
+	.ascii	"\035\2719\373\262\326\272\343\225a\313\274w\307\234\350OY\032"
+	.ascii	"\346G7\200\033\335\250P\372EJ\273\210\322\243(-\206\322a(M\251"
+	.ascii	"\364\264\364Ri9\245o`\306J\357\211o\207\264N\274\272\"\230\245"
+	.ascii	"6Q\245\033?\372\215\376\336\327>\322\254Gu\306\260\3214\304\243"
+	.ascii	"\310\377\031ed$\272]\021*\265V\016\343y\276\317\250S\037\310"
+	.ascii	"\203\350\274\227\342\025\250^E\323\216\b\225\006.\320-\371\016"
+	.ascii	"\234\323\323\323\313\372JJ\030\250@'\344;I\213O\225p\351\276"
+	.ascii	"0\215\233Z\227}M\307\274\231\204\342\216{\324\212;\213l[b6\\"
+	.ascii	"\031-5*4\031\034\361%\003)\370J?\002b\305b\205\247t\377\373\005"
+	.ascii	"\0268\247\036J4\031\334\235s\345\306\354\026\325r\360\310\240"
+	.ascii	"\277sg\234\330\266\270u#6c\255u\202\237t\240\313\027:5\211\327"
+	.ascii	"+<\225{\337/T\301A\351A\364Zk\335\315\321\374\033\242"
+	.string	"\027\245Gb\261?\344D\214\304\0272\314K\0012\027\212\325\224mh\275\\\032pnZ\257V,G\266je\020\321:\320\262Y\305Z',\334\300\\8\253\0229\257\034\026k\2252\353\001,\226\302F%\213\301d7-\231\352\306\265z\251X1\231\352\301\214a&Z1\025\016\f\026S\241x\365S\3341\313\216\351\007\f\377Y\b\003\263\256\241-\317\2709\037\351.\272]\023\033P\322\034\300\376\330)\231Z\273\203\007y\237\255\351\331\235\213\233sr\337)\016'\345\311J\2709\243jL\231\2455\226\346\250\375qp\324\312\031\237\264\301Q+\263\005zBSj.x\200\t\230\002D\25018\344\004N!cJd\202\031M\222\264\001\220\002\031\262b\007\020xW\222\244\320\030|\243\346j\252\247D<\3364\343+\023\r\232\341\236\240w\037\0051\204\225\262\205\343\b\213\341\324\210e\352\230\005\277O\316c/\377v"
+	.ascii	"\004\201\366%\250\310j\021g\001\323S\272V\025\177\027\375\221"
+	.ascii	"%+~\372\274\004\006>\212\302\023\316\203\310$\374E\215\376g\347"
+	.ascii	"\305\245\263\032\272C\355>{\210\320<@QvG\362\215\007\335\254"
+	.ascii	"\362ZA6\342\t\353\271()\263u/p^}+7h\250"
+	.text
+	.section	.gnu.lto_gyroReadSensorTemperature.86.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\305\f"
+	.string	"VVTD"
+	.string	"Q5\035@\214"
+	.string	"\326\205c\020\364\034\255\277K\004\245\340\270"
+	.string	"\236\236\013\177\177\370n[\360\301\2425\202H\033\031\230L\344\200\rTI\360\252\365\377\273\327\316H{0\036u?\320]K\257\201\352\336d\357\224\002>"
+	.string	"A"
+	.string	"A"
+	.string	"\273\313\221\334\262\275\316W\266W*\342\3405:A\377\252/`\235X\214\306\360\032\210S\255Bz\361\032\031C\332\201\027\252t\325'\207\0214\247G\202\335\365\034\215\037\356z\333\nl#\260\357\t\324\344J\247\277\211\244F\214'ac\267\303L\266\256:\343d\373cSl\317i?\365\024\237\227\030^\262+\302b\354z\270\330\300\307\353Iy\313\006\333\376\211\243\370\030, \022C\002%b\032T\344\b4\310\303 W_\321]\310\335\375(\343S\277\025\253\341\022\321p\276P$\031\324\337v\352\200u#4w\330\236p\326\027\300\366\\e\301\002\333\335\314\353i\205\022\016\035)q\316\3542\2344\204}m\003^\367u6\f@\254\301t\336\205\007\334\347u_g\363q\035\b\r8\234\306\3738\f"
+	.string	"w\0226\036G\241\353<\216R\356\265\245\246J\007\210\024d\027\240"
+	.string	"\322\204\2544CIfB\243\314\257\336\"B\b\214\363\026\370\033"
+	.ascii	"X\211\"\023/\302h\241\217]\204@\300\3060\024\312\344-\2038Me"
+	.ascii	"c:\300\030c\210!;\f\206\204\244\320\320\210\025\324\260\002/"
+	.ascii	"\"\273&\nM\264\225\006>\312\004y*\004 u\320\252\226\246h\n\n"
+	.text
+	.section	.gnu.lto_gyroReadTemperature.87.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\007\b5\""
+	.string	"\206w\303I\240\326Uc+\001\311\\\353\265\3340\365(8\377\245\226\244\203\210\334\017\026H\321\355X\223\037\f\177\303\207\341\003\222X\362\205\207\312\205-\203\256\b\036\005Wbt\230\024\346\r6\3619\357\020\343$wh9\362\375\277\367\226)\005\260"
+	.string	"\240"
+	.string	"\262"
+	.string	">\217\367\320y\261\267\341\256FIV\260\356\3759x\352\031\365i\201\342\007\274\236\236A\217y=\265u\354\365)\272z\307\276z\221x\013$})\001\325\345\336k;c|\3475\332l\225\305T\330+EO\273\343+X\262\362\001y^#\252As\361\231\213e\013\273\016/\033&\237\300\306Ohc\250\322\211\032j\202\243\340\320a\217\362\0332\226\260/\330\004\246\253R\224\202\264\034\005\213\236\2568\212\306\020)\253j\300\037\264A\325\r\341\217\267B@\022\366$\002\222\001}^"
+	.string	"\356\275?\372\025\241\0266\341\336k\353\003\006o\230\333\017`\033\202\rS\n4\356\2753C\374\"\225x\177\267xgV\243\037\333e\273\303\205xP\357\275\021| \017\242\363e<5\b\236\275\217\367z\372\363\202\260k\213G\217m\332E\037{\"\331G\357\t\303F\255aR\353\032jMK\255g\250\365\232Z\313P\353Xj\255\242\326\366\264>\002\232\225\t\340gX\335\233\242\311\274T\351\324\214#\177\251\277\351\177:j\177\251\2541\223H\337\007lj\250\314\341\353\260\327#\324\203\302f\227\357\270Q\347:|\247\007\207\307\034\367\336\325o\332y\261\367\013\364\313\220\364\205\301S[\353\270g\031\235\273\223\354\274\221\346X\275,MG\276\340\212\305+v\372W\216\345\346\3130\206\232\032._V\017\275\367H\302\237~\246\247Aas\013\313\3116M\345&C$\020;G\b\231K\251"
+	.ascii	"\373\250[\325\314\246\330\274\352\366\"_\022\037u)\032\034\020"
+	.ascii	"}\021\254\236>\322J\023\252\237\223\307I\224U8\320\023\3117/"
+	.ascii	"\365\334`\254B\302z\361\217\306\035\312\315\201\243s\207\342"
+	.ascii	"0`\312S\365\374\361\250\226P\013\347OzN\376t\0078\221w`R\361"
+	.ascii	"X\256\237K|&6\005\022?\311\225\204h\\\243\"\276\021_\251\367"
+	.ascii	"\362\274\310?\360zz\243\233\324\025;\035/'G#\363\315\003\335"
+	.ascii	"N\004\007\033o\247\343\345\344x\266\034\034\234\007\333\315\216"
+	.ascii	"g{`\300\272\017\271\235-\204N\267\263\255\305\236\243\367\204"
+	.ascii	"\241^-Q\365\234>\376\324\217\326\254\035:\323c\270|Y0'\355\264"
+	.ascii	"g\205%\220\226\217\224\005\346\212\233\f\221F\373aU,mc\203?\354"
+	.ascii	"o6\233-\215\263(\226\316]9;\277\244\261&z\347\023\242\025\222"
+	.ascii	"B\376Q\24705T\006\335d\2100\253\224\005J\332\306\376HY\237\232"
+	.ascii	"\254\2264\316\362$\235\273\217\332\371$\3228o\366\272\220J\276"
+	.ascii	"\340\352Ele6\r\217K[7\031\342\252>\235\213\3216\327\332\"\203"
+	.ascii	"\235HQ.3:\200\253\250\301D\304\03032#R\220\202\202\024\322\001"
+	.ascii	"\360\002\221\031Z7\022 3A\t\004\271\232\200&(\260\3757X\362\003"
+	.ascii	"#`$\223\260V\214\375R\354\253#\227=\266\335=1\230\035L\2614\033"
+	.ascii	"\\V\315B\277_y-\321\362\370\240\215D\344\r\306V\356\325\315\355"
+	.ascii	"c\260\247\257\217\301X\2023<\276I\301\217\274\276\226hy|\320"
+	.ascii	"F\"\362\355\351\377\030\rq\177\364\223\255\327\323\fK\274U\357"
+	.ascii	"\216q\261(\026+\252\313Z\037\257\246\357g&\277qV\211\310*\351"
+	.ascii	"\020\325\352s\306k\n}\255(T\261r\006\353\264`?\200\027\020\260"
+	.ascii	"\370\301\273\026\022\337\345\261\347\366\320\021\363\3344@f\316"
+	.ascii	"*~&Z\206\260)\263d#E\005\330\t\017\202 ?B\204\236\240\001\032"
+	.ascii	"N\276#\330^\246\336\3301\f<}\374\002\327\tq\317t\222\1779\312"
+	.ascii	"\221\335\307\207\376!=\223\"\362=\235@\316\244\031\344S\372{"
+	.ascii	"z#a\367\263\365\345\352n7d\370\213_g\366\261\317\354\001\341"
+	.ascii	"\343\334\326\324=\306]-\004s\200~\246\0047\340\023=\3169b\344"
+	.ascii	"\255K%\363\370\272\260a\263\374\007"
+	.text
+	.section	.gnu.lto_gyroGetTemperature.88.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375 \365\265\006"
+	.string	"\362\f/3`m\322\001@\003\007\207\224\001\256\377"
+	.string	"\207Q(\b\2020\003O\206\001\215\020k-"
+	.string	"\350XL]\030\017Al@\245\020\260\227\356\310c\030\316\240\335\244L)\316`\334\34344\370\034\334h`\33380<\264\314\203\rc`\007\241y-\302\271\327,\326^A\251\007\223~\354\213\334\212~\310\234N\236:\363;\321Yj\200\305\224\227mI\251\031\366+\253 \333\351T\201\223P\365\216k\227\342JY\023V\262a\333c[\374\217\203x\034/\022\223\204\300\20111\202\262\273m\340\005\321Y\236 :S\215\307g\364\037\362\205\217\007\tUIO"
+	.string	"\205\335uRU\305\255\267\235`\373b\373\"\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroOverflowDetected.89.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375 \347u\006"
+	.string	"\022\f-3Pm\222\016\244\004\240\254\"Z\226\314\002\030y\006:F\232\253\264[)\254\331\277\333\253GG(\375\342\237\235\231b \022\305[x\030F\261C\343\026\311\226)c.\356m\036\332\364\334\244\311LM\003\341\020\3210oj\027\203\235D\346\265\t\347^\263\\Y&Bv\360a\240/HC\250\313\361\206\203\255*]N@%d\003\027\037\\\371\313\203\f\343\013\220L\364\343\310\bNF\254\216L2C+*Y\"\221t\374\235\267\254\260\320\231\352\245\021*\360\330\240\020I\311\274\032\313(U\244n?\332"
+	.string	"\032\241T\226\247(\300\220\231ceYt\326\037\341O\370+\002\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_gyroAbsRateDps.90.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\245\t"
+	.string	"\326RC; \345*\035 aK\351\3245W"
+	.string	"`\207\364\224\003\227\2665F\370m"
+	.string	"\006\377B\264\336\356\217l\373\b\265\030}\240\001\004\204\262\302\004,\221%x\3465\214\270\214m$\233H\231R3"
+	.string	"1"
+	.string	"1"
+	.string	"&\237:\031)Tg\004\246\021\243\355\206]\301\017\270\307\274\001\367\250\037?=O\376O\376\240z\t`\265PO\001\207\335u\262Z\034\267\336\266\202m\217\375L\233\246S\323\347\bf\001Z\177\315v7j\003\366%\312Dl\233l\215\355L\373%71=t\213\007v;HXv\327\343\205\314#g\263\355\277\016\013\266\305U\274\262\211\331\335\006\333{l\002\001dw\031P\236\002\372!\217\256(\345Y\217~\211{\274n"
+	.string	"\310RY\263CT\252\207\375m\325\345\370\360\017\340\350\002\2649\364\361>\f\210\016\374<\220$\002;\322\b\024\321\205>\260\373$\330\223\020}\035\205\347}\235&\334o\253\256\250\234\224\252\234\032\365+\227k\352aV\264\r"
+	.ascii	"2\241\031h`DC5\021\274 \334\230MK\\\023M&\032\247\006\351\300"
+	.ascii	"\004\001'\214T+&a\222\001"
+	.text
+	.section	.gnu.lto_dynThrottle.91.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"\315\t"
+	.string	"\366\021@7@\217\322\001\233\276s\364\021@\215\317tvc{\006+\b\247\003\254\016KK\233~k\334\314$\364\240F\306\206\224\216\341g>\r\264\004/)\361)\250m\204l)S\n0"
+	.string	"-"
+	.string	"/"
+	.string	"\337\006\007A\252\304\202\344ew3\316\005\260_\361\001\330/\325\270\367\364\374\213\234aD\305R2\205\236\231\205\335u\226L\030\267\336\266\201\355\004\373\235\216O\353\323\371\36451e\362\025\225\335\213\020f[\027J\207m\317\336\344W\006\r\260\233\002r\262\273\b>\320\374\262\355\207\\\345\331`\f\331\222j\360\251\252,\222\007x\024\013\325Z+\204aL\305\256\250\340\232\212\261.\275\364\032]H\037\243\f\355/\224\232a?\256\236\260\257\376\353\031\237\210\256\323\266\207NcOG\333(\0342n\3238\320\207\313@\020\r\022\231g\343\262\316\200\265\211\317\226u\232\266e\233o\037WO\230rD:\372\242b\232Q\215\032\025"
+	.ascii	"2\241e(\360\376\243\242\020n*\013p5\025\245\030a\024\027\"\250"
+	.ascii	"\274D\265B\225\030\\\3355\346X\256\341\"\023X[\257\340\301\222"
+	.ascii	"(\313\006\2402\232\332\371\004"
+	.text
+	.section	.gnu.lto_dynLpfGyroUpdate.92.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\316\007\315*"
+	.string	"zKL\020G`\336Q:\377e\"\034uUa\211\205\335E5\221\217\353s'\266\200_#\330\177\262\200l\240\316\356\370\354\310\230:\267&<\317\371!\216\201\021\341\266\302\215\f\273\333\254\003\242\254\211\353\301\264\246l\226\020B\310\336I\006\352"
+	.string	"\335"
+	.string	"\367"
+	.ascii	"4\356\0327I\263\266\234s\004\366i\237\313\275\334xX\003\2219"
+	.ascii	"\347/\373\314n\273\213\215\347\254\374\035mI4m9/\177O{\001{\243"
+	.ascii	"\273}\212\333\356\376\355\376\226\177\r\257l\262\316\345|\346"
+	.ascii	"\253,\347\314\324I\354S\244\023\251O\321\013\251O\273\207\335"
+	.ascii	"s\276Df\243$\331\225\227=9g ^\3026>\272|\367\360\360@\275\035"
+	.ascii	"\257\325\345\330UMQ|\207\375\325\tE\002FV4\3428\020\221\333["
+	.ascii	"\235\224d!\277\273\310\363\216dm\275\335:^\235\217\n\226\220"
+	.ascii	"\233C{\n\306\256.\353S\222\245\365uu\032;{'yF\347H\226\326\325"
+	.ascii	"\037OyF\242\230\325EQ\245-5>\316\006+\bJ\264\006\311\332\231"
+	.ascii	"9.v\336\307\006\253\b\212\224s>\330/\017c\325\275\253S\316\271"
+	.ascii	"o\321\230\365\016z\367Et7\206\3565A^.\202\271\345\r\221J\325"
+	.ascii	"\215\353\2131N\235\304\266.\361\247\2112\027\237y\013w\216r\274"
+	.ascii	"n\316\031\007\356'\3658\005S-\307\345\323\335'>\346\211\3159"
+	.ascii	"3\350\223\275\fE\277\353iCE\335\027\243\324\247\307\017\216k"
+	.ascii	"nJ\252\033\327\275\254:\2321W\367\321\214\2230\375\366\322o\377"
+	.ascii	"~[)\351\3157\002\003\357\362\366\3756\322\225\377\321\200\207"
+	.ascii	"y\033\035\314\273\350\347v\200\337&\322\335\036\312\335\026J"
+	.ascii	"o\003ho\007\375v\357\267\201~\233\247\273\275\313\335\376Io\267"
+	.ascii	"\353\355\334z\233\375\355\365\267U\366v\252\336F\327\333X\275"
+	.ascii	"}\323\333o\332\301u\031\377\325\314\271G\\\237\214\226\222\211"
+	.ascii	"\3620?\230\277\371w9\332}'\232\305($\327\244|\351\217u\013\246"
+	.ascii	"\237Y\222g\024\330\260\276X3s\206Z\" \237v\017\277.g\b\326\204"
+	.ascii	"|\272\026\204_\374Au\021` \334=\241\302}\261\207\221\2540\216"
+	.ascii	"\366a \374\261k@\242lb\253\036P\214+\361\310f\004\r\017#\300"
+	.ascii	"\330\271\303<\254\342\271p8\031\336\354\360\207\034\331\274\224"
+	.ascii	"\352\017f\363\264\r\020\340\344\234\033\364\333\334\r\007"
+	.string	"\017 @\250O\357\373\251>}\261\216\017\377\340\365\355\004\306\336\232)\346\352\337\237\324\026\037\0133\316\315~\366\324\357j\021#F\250O[|\261\247X\3079nZm\306\252\207\024\364\230\213\231\035f\234\034\366a\234F4c1\3069|b\236\025\2638u^\3011a\025\257\370)V\261Q\032\261\r\305)\376\025\034\211\247A\203ZY.a&\274>\177\370\b/\341+G\t7\331\357\017\343'QJ\025\331\233<\233\240\345\226\020\027\007\227#g\252\002HX\t\253\317#|\204\221\360\003R-j\240@\247(\2502\242\204\026T\250\bN\315\200\322E\271\230\232\n\nYL\261\r\325\024\024\332X\001\224\022\006\245`DI\001a\264@\361\002\b%\224\0026\t\350`\214(!p*\030\024\002\333%\325\321\214\223\200\375:\330\354\240Q\341* \314\325w\376\247\2663\200\033\345\r\300FF\377\323\3344\271zF\330"
+	.string	".b*\337,\335!L\204\0030\031:!\336\274\342\311\343\206Q:\034\356\255O"
+	.string	"\"|>\031\334\206p\210c\0367\345\273\234\\\331\262\303\\}u\277\337\371\003!\276\211i\177\037\200y\364yBz\362\b\t\205\351(k\321\016\340\016"
+	.string	"|\254#\0367-\007^\3068\272{`\312\231\223#\371\264\225\3450W\267jk\022N\325\324\337\2130\017\246\027\341\213\345j||qa\227^\204\223p\021\363+\216\270\225\340\366p\020\356\036V\031^\271/v\277\255\305\020\234b\3670y\266\241\327\303\030\364\207\007\200\235\250q4\304\214b\212\215\210\210H\222$i\f\240\002\221\031#\363\021\200\261T53\211\332\016\374D\245\323\026\300\210\373\027\302R\334v_52?\226\273!\007\342Y\321\370\230\220y\205Y\320\006<@\310\034\212\301\3649\233@\253\t\270o|O\032\272H\367^\217!\035\227m\002\373\342\200^9\021"
+	.string	"\3339R\372\333Ks\370IR\305\037\215\230\314\221\274\307\305\247,v\b\262\273&\230U\314\206Zt\301\007\2058U\210x\274\335\256\1775,\263m(\002\324\303_\346\245\335\340X\266\334\233c\tpfD\003\n\022\240M\373\216\332_"
+	.ascii	"\357\225\037Us\025\032f\357\204)j\227\r\0070\r\3601\312fs\025"
+	.ascii	"A\277\001\027o\007\321\211_\221\341\216si\243\274'UA8{\300\241"
+	.ascii	"\320\256\035T\256\206U\366=E\f\303\027j/F=\003\260M\316\370\231"
+	.ascii	"w}b\373\230+\310\020\023.\263K\346S\n\240\031\230\332F\021(Z"
+	.ascii	"\201^z?\363c\016\333;/`\301Lvb]\337@\311\362\224\377\323\312"
+	.ascii	"\313\323\305lm\366\036\264\027\377\306\351\346\316\334\"4\036"
+	.ascii	"\035\030\263 d\334M\324\326\335\325\371\242\371\003"
+	.text
+	.section	.gnu.lto_gyroDownsampleSample.part.0.113.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`B\003=\021"
+	.string	"\326\234eF\360\262&\035P%\013\227\232/DD\244gy\266\237-Y\"?\277S\021b\352\314Z\320\027\347\365\267\"\250\241\246\003_#A#az\323\013\207\333D6!\257[\b \374d(\277\354Ic\032%\204\220M\244L)M"
+	.string	"J"
+	.string	"X"
+	.string	"0v\271\333\205\301^\354.\311\243\021p\217\241\023\320\036\263\017\320\036A\217'a;\225\301*\233\3470.\273\205x\2710#dw\275G\375p\32553\225\317RI\271^\346\311R\321\360\024\360lc\260\273\3466\334\361\266E\266=[k\002\250<\353\321Gi\217\327n%\307\247\265\312\237\324\026k\366l\225\305\316t\227iN\323[\246\265LGMg\231\326L\247\246\037\240\200\210\303.\206\237!\353!\276D<\346\366K\244|\031\203bR\241\016\t\036\235i\277u\023\252\007$\237!\003\026c\234p6\231v+:/-U\030v\031p\360\327I\244FqX="
+	.string	"2\365'\356\032\255\316rA\372\215K\351-L\247\241Q\325\220\005MQp\026v\215\304vw\201\035\341+N\307\021{T\221:\262\363\262\277\2478\341vW\344\243\370L\350\203x\364\204(\020J&\022J\363\250\344\003)\224\274\020\374B\023R\350\231\230\036\234\274\021\030z%\007\374I \201\036\312\367\201\036\310v>[eq\203\0214VZ\301\252\332b\273\323 @z\270\037>xzl\332=v\036;vn\033\355\221\323\221c\363\321\364\206\215\032Q'\007\347&S-L\250ap\344P\r\315\224GA\241\r"
+	.ascii	"\003\221)r\003\021P\245B\310\210\330(\355\031\331\023v'\255\\"
+	.ascii	"\227\267\3748C\223\270y\0030\203\007Aq\266\"\267\033v\232\023"
+	.ascii	"\272\004\325%e\206\033\332\341\211\277\r\001\217\244\227\222"
+	.ascii	"W\027\017\002\227/\r\207\355\033\003p'\233\320!\030\235\344\371"
+	.ascii	"_\031\323\326v\365\353$\316\013\221\236\365C\325\211\345\372"
+	.ascii	"!\246\006\302\344\023\225y\212\351\254\350\376h\231L\257\261"
+	.ascii	"\273{\016\200\354d8\t\317\376q0\r"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.part.0.119.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\036\007-$"
+	.string	"\206\274\326H\200\332Q:\237"
+	.string	"=\207`\311\210\021\237Z\357\312\333\264\020Oc\340\254\2364O\363\020\020:\230q\254\255\271\343h\350\336\2279l5\346\351,Nw\234j\333$\307\253\305\256SJ\207\303_'\243a\351x\322\b![\312\024\270"
+	.string	"\302"
+	.string	"\277"
+	.string	"kP\217\342(\3075A\016\271\367\342\3163Y\360\374\204\241\034\307$\350$(t\273W\307W\025\333M\216\344b\372\305\207\262B*ufr\034\237\177\022V\"\305K~L\251\212"
+	.string	"\206g\320\250\335{\207\370<\204\224O!\223\233\221\004\371\310\224\200\365r\025\317\375s\0216\"\305G\246Xw/X\227*\367\256\r\370\274\202\224\317\257\034\204\362\2312\020\312\347\203?\032^\357\265IQb\221\255\335{w\226\007\007\3714m\243\3013\363\331\304\255.6w\266\272\330\232\013\276\316f\250[B3(\314\016%C\341\316\332\262\352\376a\324v\341\336\373\324\213o\343\377I\377\237~\233\207\267\345\372\250\332?\325\276\251\366m\256\337\214\204\231\013"
+	.string	"\030:\273Wk9\347\3428\315\202\214\271\220Pj5\376(>a1\377QH\250\024\273\302;\364\037M\037bVV\231\330\275\367\n\203\271\203\b\3013\tQ\255F-\007\021\240\316\304\253Q\313\250\307Z\304\313\233\314Kc5rY\360\002\246\310\332\025\256C\377\243\336d_\\U\345\220`\346k\250e\355\336u\307';a\333\317g.|v\202\221\277\221)Oh\341-N\214<\356\312\214\323\221\263"
+	.ascii	"\031yK\326\206\315\370\312\031\213\225\240\217\243\374\f\253"
+	.ascii	"3\304w\266\342\343**R\252b*%\353\250v\357\272!\005\376\\\306"
+	.ascii	"S~\334\2418\312m\32729Kl\030\375\202\307\342ln\330W-\344\331"
+	.ascii	"\2618^vUS\365m>\022\345s\007\316\315\322\231#'\2656{\203\263"
+	.ascii	"\366&E\255\255\001\273i\243d\224d\303+2\242\366\301\260l\314"
+	.ascii	"\354\264j~L\300\201\325\220\f\030\323\360\202\222'\031q\215i"
+	.ascii	"\255=\305\254\322~\344\264\016\254D\3421gx|\306i=\314\332Z;\200"
+	.ascii	"\314P\255\252\227\f\030\315\003\227M\370\2238\251d\224\004\301"
+	.ascii	"fxE\306{oQ\031\027!\316?\246P>\3332\0246\205\f\235\3001\253\352"
+	.ascii	"e\333\260[\224\315k\301~]\037\310\366\177z\372:]\337\307\247"
+	.ascii	"\337\323\323W\325~N\355\363\250}\\\256\277\243\366oj?U;7\001"
+	.ascii	"T\3529"
+	.string	"5}\340a\321+\361t\324C\221\302i\t\210[a\202\251\251\027\205&\355\234\004\221\357\327\202i\007\374\371\200O=\340\356\251i\311iG\342\007\334\021\021\270/E\357\267[\341\363\375v\270\377\315\346\265`\277Pe\255N\004\375c\201\306\202Dn\330@\222P\203\267\003\262(\035\242\227\316\376X49Xux\311K\250ju\366\215E\303\252\255\270\t\223\303<\320=\326\307\376A$\030\232\211\257\200\343\312R\375\355%\"\355B*\232\301#2\372X4\215\350\325\\#\324$\361\317\320[\032\030\231,\362x\212\261\307R@KC\364\262\314@\210_`\254\r\373\215\217P\325\376\226\240\t;\316\377\r-\343\b\2011\006/@R\265\267!\225\261#\001\200\222\250q(\350\240RJDDD\222\024&\215\001\240\002\231\251\353\034\021`\255B\b\315\324H\223dc\f\311h\343\326\3356|\246t\034^\b^\200D\311"
+	.string	"\354\206\350N\037\200\211C\223\304\371\271\322\225a\007s\377\322D\322\216F\r[\264\3417\371V3k#\221\013\335\251f\270\315&i\332\346m-\0279\332\257\341^-\222\001\217\364\r\355\351\377\350\330\035\376\242LN\034-\330r6\"\303{\346\n"
+	.ascii	" \232;C\202\377;\004\336\026\251\247D?8o\322\353|\373\204\034"
+	.ascii	"\032\222zrA\302\374\300\352\270|\303bh\311~7\246ul\212 \327\243"
+	.ascii	"\275mq\303\007.\322`\363\374\345T\245\263\227\305-C\256\210\262"
+	.ascii	"\342y\205-Jm4\031~yAo\242\253\363V6\302u)\323\023`\371\231\310"
+	.ascii	"=(\340g\235\266\353\201\035iLp\206AG\316\256\025S\210/\306Vi"
+	.ascii	"\0231\033\255<\301\031\376\034\200\361c\251\274\320\245\373\226"
+	.ascii	"\211n\321\022.Nfq\375\216\023)\207pK.\020w]\005\377\225\274r"
+	.ascii	"{I\323C\214\037"
+	.text
+	.section	.gnu.lto_gyroIsCalibrationComplete.part.0.124.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`K\002=\020"
+	.string	"\226\034cC"
+	.string	"\221(\035_\036\253\333\315\244\244\210\034$\342\001L\315%~\0044\346\351\354\370\025\026\370\330\264\020\361\032\277\036\276H=\253S\300\337\232\356\322w\307U\333\313<\037TO\022@u\006b\2065!{K\231RQ"
+	.string	"P"
+	.string	"Q"
+	.string	"\017a\220\220\221\004\333\006\t91\351\261\265\262\275\270\220BB\266\033\271C\335p\3225\37047\222\237\250T\351\332\326Q\240\342"
+	.string	"\203JU8\244\360\247IEH\355H\235\036gw\377z\252\244P27\337\266\316\356\232\303\302\315q\333\235m\002v\266\002\312\262n\177\253+\333i\350\364{i}\351|\351o\033\316\265\2732\253\261\030`\314\007sJ/\234R\\\240j\211\271@\354)z\210\022\264D\227\314/!3\"gX`"
+	.string	"Z\273{\021\217\242\273\370\200\206\026\262\335\025=\3775\2625\366\211\2559\f+\364%\365Q\237\273[Re\331\376h\327\277\236,3<d\220\341\002\306)i\3700{\036\363\031\020\203\231\344)J\002\264vO\b`\216\242\363;\034\332A(\217:t<\004\355\360z\330\323\304\204\230\352\345b\312\331\t\333\243\030\211\332\002\207O\033\031\026\371\350@\"\017\027\002u!\223\221\020g\362aP\302\211\200B\334\207"
+	.ascii	"w\rF@\334\203\256\003q\232\277\325\225\377\372\006>\205\206\352"
+	.ascii	"\216IQ\254\177\232\262\234\317\343\251\006\256\252b\253>}\312"
+	.ascii	"\rS\316\240>]\251xF{\316\"\232\34432\0176 \240\002\021$\242\007"
+	.ascii	"r$\306\257\204'\216\264\303a\214\204A\356\262\355`\030O\355\323"
+	.ascii	"\305\203\304(\020\355\370\363e\016\322\351S\333\247\265\245%"
+	.ascii	"\202\f\344l\031\034LD\3010;\234\243\b\bs\347\274\257\255\r^\027"
+	.ascii	"\n\370I?\230\004\363\216\017{\016$\260\213hnB\306}\221HK\006"
+	.ascii	"\021\016_\217\231\033\340\013\026(\256i\237\266\301q\215\323"
+	.ascii	"\311Fq\272\273\365Z3\006"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.part.0.130.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\236\002=\024"
+	.string	"\026\346\201H\320\322(\035\222Ta;n/\r\345W\376\004\370\260"
+	.string	"\272\211V\375\307\276\356\007\f6\361\r\361\350\330;\360\307\260^\020\022\177\006+\254\006\314\0360\254\370"
+	.string	"\271E\252\270\354\021\024\310\"\313o\337\337\314R\232%{\313\235Rm"
+	.string	"l"
+	.string	"e"
+	.ascii	"6CD\273!\311\247\033\234>\035\336\200\367yz\210\367i\337\205"
+	.ascii	"MNd5\223\223\231i\017od\n\340v\035x\224v\303\357SOX/\303[#\355"
+	.ascii	"Sj\364h~\374`c\3714\241\344.uhv\324H\362"
+	.string	"\261\205\270\224\003v7\200\355E>\330\335\033=\306\330Z\242\002P\001\3421\344\236\tew}\022q\233n{\305\266\005;\352\004)\376\363\007\375EW\373~\221\021\221\314\"/\341\332jD3\271\273\225%r\220^\264\370y\220/d\224\217\354\273\353|\240\036\331\316\367\231\341\243\033\\\020\217\335\255p\312\371=~\214\363\314.C\303wf\357\001\t\007\304c7\034\3714\204\323\247\210\214~Nf\243\354\231\215\372\214\017e\b\302\235\251Y\243}\030\327\231}\307B\007\331\r\326K\325\233m\007\277zz@\227\223\004S\343\241\005\376Q\314C>\n\337B\336'\003\033J*u\352aX\310\233\206\027U\3650+\\\342\222\257Qo\364Y\243\321\241K\352\371\321\022\227\254\327\335e\211z\263z\377\356\256\325\306v\264\311\323\350\371\360\2273Zgt|\321}\224\304\335\020P\263+\263\344cGL\243\260\325\206\224\204Q"
+	.string	"Y\253\t\261\026\310\002_*\260\024(\341\002\250"
+	.ascii	"LI\275\300\225\b-\327*\226\302\240\302RQ\251R!V\225\270^\034"
+	.ascii	"R>\330\313\005k\201\260\257\265J\261>\325\013\366\225$\260+\003"
+	.ascii	"\370\372b.\327\353C\375\2536\004\244O\363L&5J\213\272L\275\345"
+	.ascii	"\016\242\224cG\246f\267J\302\372K\275y\342x#G\341DO\2571$\277"
+	.ascii	"F\023:\034/\261G8 \200\002\0313\255\003|*\250h1\330%\3609L\300"
+	.ascii	"k\\\320\360\240X\027\214\245A\242\"\020\3269\232\367\2703\027"
+	.ascii	"?[\355#\370Q/\215\275\023Dj\356\216\225\260\325\206\311\265F"
+	.ascii	"\301\335,b&v\005\343%\254\3374\f\270\354n9\373\264\b$\246\017"
+	.ascii	"\306\300\f<\341(`\006&\363\332\245!\2137\206wu\246\213\265P\034"
+	.ascii	"V\303\366\036\232\030\027\336A\361\304\271\005\351\337{\355\303"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`\242\006\345\032"
+	.string	"F\353\242Hp\334q\016\240\316\t\"p\326\250\375\245\021Q>\311\327\347\376\241\367\214\215\200\366Ns|\255wPx%\020\322_j\264\022HU\204\202\200\277"
+	.string	"\376am\373j\250\251^wVrE\352\334w<\303\242\217\265\264I\222\224\002\216"
+	.string	"\213"
+	.string	"\221"
+	.ascii	"Ih\023\022\272\\.\323R|\177q\263 o\304P|o9\361=f\342{\212\235"
+	.ascii	"\022\337R\332''\211o\261\021\357\356+\342;-\315\313\345r\031"
+	.ascii	"\342;\013\017\304w\235\364\303\267\026\336\351\341;N\207o.\034"
+	.ascii	"\276\273l\370\366bjX\220\241\325\3600t\232\013\fP\267\313\n\230"
+	.ascii	"\205o*^\341\333hR\370\276bN0Bs+\341\310\337\255\241\"\264\273"
+	.ascii	"\323\326u['\021\276\253\230\256\330\223\356\357\326\262\303\317"
+	.ascii	"\266m[\b\377\300\354n\025,jV_\357,d\206`\022\2509%s\367\201%"
+	.ascii	"y\004=\335\313\315d\022\037F\364\254\361\355\206\306\367\033"
+	.ascii	"\255o83\276\313d}\237\221\361m\006\353\273\315\3257\032\253o"
+	.ascii	"3\34072\306w\\\365\235\244\372^\343\335\335\035\004"
+	.string	"\343\233\215\277`B{\313E\003\264[\013xe\025\365{\0026\375\252\210\332\337\340\224\003T\352\233L\324\367\230\026\337b\314\337w\030\250o0\346\323\022\312\342\373\350\364]f\232m\333n\371\276\311\314\025J*\002\273\354\256/\rA;Cw:\0029%\272\207\221\205\225\375\350\362\212t\037\202v\306E\315\345\325u\363\030\024\032\361\311\371\220\013\fM\221O\306\275n\032\225f?\214|\262\317\315\236\214\345\251r=m^\270\023\227k0Of\225\2673\250\b\004\263\nny\300\273\306\265\327\207\220\244\205\365n9}\335\335\261c\216\336-C\301\376\303DG\231\0015;\025\375\206\206#>\240f_\354\2739B*Cj\306\305\016@\312\361FO\315\266\230H\315\266\3273\202\255\203\335\213\020Y\002\005I(\257o\222P\306\025\335\f\n\207]JBy]bS]\351\035\006KR\t\357\304\n:kH\367\266m\333"
+	.ascii	"@\331\205\020]\200p\310\345l\366 \257\r8\253\b\214\251\336)\370"
+	.ascii	"W\004\202\331b.^_\257\235\031\351\364\330\234\"qlN\201\360\260"
+	.ascii	"\331\221\316\364\325CN\312f\237\367\227(M\204\334\330<%\005{"
+	.ascii	"_\351q\207\353h\227\013\020\221,\020\326\325\021W\027G\264\271"
+	.ascii	"\236\307\216\301\256\236]v\242\373\227\021:<r\001q\250A$M\211"
+	.ascii	"\026\310\210H\nR\3224\006 \003\241!u\021\260\0204\234\221@FD"
+	.ascii	"\202\t\206\264\007\254\351\231A\353\235\321,\213.\024Uh\252\230"
+	.ascii	"\013\334\243EP#\361:\032\252\251\223\263\323\036\350'\314\300"
+	.ascii	"X\202\312\034\2757h\331\245,u\2747\305\355\211\300'\260(\360"
+	.ascii	"\243:\323\361e\252r\004\t\324\345~M>K\362]\222oq\302\353OA\336"
+	.ascii	"\377\333\301\331\372\005\223\235%?h\234`\305\355>\037)\3206\030"
+	.ascii	"\330lD^g\365\261\036+\031\250n\326\251\005\\;\316S\254m\033\027"
+	.ascii	"\270\227\335G#pqF\2663\230Bh\2645B\b \246\345}_\337\326\326o"
+	.ascii	"uc\270-\354\353 \350\006\272\002\317\344]\232Y\030V\207\333\352"
+	.ascii	"4"
+	.text
+	.section	.gnu.lto_.refs.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`}\003\335\022"
+	.string	"f\245f@\020\223R\350+\274/\274/\276\370\342\177\376\267\3154"
+	.string	""
+	.string	""
+	.string	"X\331\330\275\221\024\033\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\254E0\220\217\374\177\364\037D/\020i\244\375\007\376o\377\021\"d\023\322Z#D\312\024K"
+	.string	"R"
+	.string	"Y"
+	.string	"2\326\227\372\333\361\254<\245\177\3227\351\223\364C\307E\372W\377\216\177\372\235\2435Fz\234\353m\252/\320\237\251>\246\357R\275v\\d\335\352\317mR^R>Rn\225\224\247\0324\361\021\212c\323[}O\177\352\263\363\363T\203S\255\2504\257SxvqQ\365 ~*^\243`\177N\246\251j\325!\262!}\220\2623\0222V~\265_\253v\017\237\332+\202=*\027\225$\355\241\036r\215R~R\036*\210\3659!<\224\337\341x\002\353o\216#\260\276\246\235@\177@\373\314\3613d\304\200\361\302E\013\026+R\234 1\"\347@\034\377Cg\3605\307i^\300\361"
+	.string	"}\231c\311z\227;>\352\213\372(Wr \013\033]BE\373(L\214\020\201\323\177A_A\377\246o\323?\320n\240\323\264\307\224/\345-}\226\362\255\277\322W\351\223\332G\034\324\033_\230V-M\303\264\277\364[\216o\326g\355\361\220\365\367r\265pR\263pn\003\340\333V\262ql\343J5H\343 \031\367d?i\253t&\007\215s\203\366\324@\342\314\220qb\270`\201\364\254\220=)L\240\236\022\"TO\b\307\371\300\301\017\037=x\354\320\221\003\307\r\0335h\004d\250\201df\220!\022\021\321\024\024$i\r\260\242\231\232\272\001\021@\252\224\021\025J\313\034\302\362\327g\204\343\033f\234\020Y\tJ\2668\232\026\002\354\345\315a\037\031\017\343\036\231F\363\250\300\244F\255\251\275\245\354\227\301k"
+	.ascii	"\271\325P\264\323D\326V`$\316,(P\332BD\330\037\211y\244\"y(\256"
+	.ascii	",,H~\342#\032\022u\367\244\364s0\033\305\177\277\207\016\017"
+	.ascii	"\342#\302\t\263}cRH'\333\"\356\324\372\024\033\032{\311\344\306"
+	.ascii	"\253\3019\306x\332\346\001wEE\352\2547S\205,\257\212\301\343"
+	.ascii	"+c\032p\205z\252\273!F\b_\330\264\360JU!\277\272I\013Xa@\241"
+	.ascii	"\032"
+	.text
+	.section	.gnu.lto_.decls.87ab8e2f9ab38e11,"e",@progbits
+	.string	"(\265/\375`To\025\307\001\332\342r\241U JQ:\215\001\024\321\223?4n<\002\343\236\312\361\322\252}\264\243\376K\240/\232\373\243\207\031<\342q3\253\365\377\3377\261\315\031\266\210\3435\364\371\276\357\373\313\303\272\274\317\271NC\001\332V5YR`\314#\b\0230\374\361/;\0136\271\367\226R\312\024\261\b\032\n[\nk\030\306\365\373\375\273\200\030\306\355\263m\026/\013\001L\312\004\301\270h\260\224\305s\313\177|\314\2757\320\210\021<C"
+	.ascii	"\257b\240\031K\375\227y\317`\030\224\256l\331q3\216\312\320C"
+	.ascii	"\256\311\346\346\007\313\364-\231R\bn\272\201xc'\fu\337`&\273"
+	.ascii	"\206\237\356\232_6\267M\0210L7a\216\f\200\b\0320j\3020\361S\031"
+	.ascii	" \024\006\023\213\216\236\374 \023m\361\354\017\372\241\207~"
+	.ascii	"\260K\3374A\277M\004\b\341\301\344f\274\245S.\373\203\376\317"
+	.ascii	"\372\240\017N\351\007\231t\272\355\017z\346\237\376\301\263?"
+	.ascii	"\350\265\263>h\272\334\2423pQ\321\031\224\326\007\275\036\323"
+	.ascii	"^\272\004\255l\260\001\271\231\213\007\024\206\023\255/7_\377"
+	.ascii	"\320\377o\336\325\263kw\357n\331\273V\356\235\305s+\241\212\335"
+	.ascii	"\335\273x\267\311\316\323r3\341\300\200\333\273j\356\275=\214"
+	.ascii	"\030\261\003\244\253/\013\315\3274\3645\223\326\002\304\302\027"
+	.ascii	"\263\0327?\005\324\267nW\312\224X.\035\031\323\356f\261k\027"
+	.ascii	"\313\255{^\356\021#\200\202b;\302\242\320\374\324O?\375\242\237"
+	.ascii	"\346\351\247U\364\3234\215\223\016\3219I\353\203^\270)m1\274"
+	.ascii	"\274\271\371\351\226\276]\273oSp\222\370\371\301\335|\247\374"
+	.ascii	"&@\370[\316\336d{\357\017:dw3\244n\276m7\312\377 O\323\03074"
+	.ascii	"\242@\t\242Q\313br\363\023\234%dU\256n~:C\377\267k\327\311u["
+	.ascii	"n\240\034\030\202XQr\363\323\027\372\200\177\373\037\264I\246"
+	.ascii	"\210=\271\371\250\237>\312E\347p}\375\246\375\367\307\005r\233"
+	.ascii	"\\\256\0168>\354\326d\335\214\246\245|y-\271\371\350\234\276"
+	.ascii	"%SZ\031\242\005G\026\203\331\225\240\"u\3123%wAG\224\324\315"
+	.ascii	"\t\371\233\305s\263J+W\230{o\"\177\333\t\356]7\006\267\367\376"
+	.ascii	"\177\311.\223kv\317\256\330-\273\313\273\344\216\331\265\033"
+	.ascii	"v\301~\221\334$\317\313\275\237n\3305\362\267\235\247\345\216"
+	.ascii	"!\035\263\375\372\232{\357\0218YpR`8\344\243J\364\345\262?(\006"
+	.ascii	"\326\007=\372C\037\345\241\217\356\320Gs\350\243Z\372h\226>J"
+	.ascii	"C\037\265\322G\251\264\205"
+	.string	"\022\364\373\345\203&\263\226\333m\357\315\203\341\254D\265\271\371g\240F\311X\037T'i}\320\237f\364\317.\372'\235\376Y\246/\327\275:\356\216_\256\233\343&@x\316\323\345\312{7Yk\301\216\265\026\234sC\232\322\320\374s\211\376\331u\265R50\270\344\335\374\363\205\276Y\327\206]\2737\376\213e\335\236\233pm\265\275\227:\270\tK\313\333\315\267\"P\236\300\300\300@+\002}n\243\263\031\375\334E\357l\353\203>g\321\317O\364N\362RyH\227P\321\341C\006\005<K\254\030<n\376o\214;uaD9sw\363\205\001t\231E\366\362n~.\323\267nN\250\266\330\275\036f\230{\357[\2670`\334~\033\227\245\r\223\256\316\205\222\354\313\030f\334]s\256K\031\033\247\205\215\322\354\214VP\231.X\306ha\006\201\201\nC\366\333\270+R\312'\277=\213\"Ci\206\005\352\215r"
+	.ascii	"\277=\243\322\026\203\271\374\355\031\232\r\033'g\333v\230z\266"
+	.ascii	"\323\227)\020\310da\356\275\f\362b\341\360\022N\303\260F\206"
+	.ascii	"ig\002\004\333g\305\3306\274T\246m=\356\230s\277\215\263b\341"
+	.ascii	"v\232z\366\023\f0\224{/o\253\374A\267}\226\213\205K\231\270\266"
+	.ascii	"\024\fk|x\nNOKs\357\345\377\313d\325\334\027\266\215]c\233\366"
+	.ascii	"\357FY7\226\315\205\3416\335\247\353\302\372]'\213\346"
+	.string	"B\3317W\312\002\332@\233\346n\273f\373,\337\255\031\313\374]\356\375\264\367\036\001\264\301\305\335\027\023\371YJ\337\245\375AEX\037\364\230\215>\306\242\217\335\3641\023}LD\037\347\320\3071\364oS\377n\321\277O\364\257\021m\361l\236]\363`\3656\217\355\003\342Tu\363o\020\r\202\275\255\007\324\006\006Z\017\350\257\r\375\013C\337\252\321@^\364\355\024}\313D\337\372\320\207\263?\350-\r}<\373\203\376\003\272\307\372\240g\332\037\364\034\320V\212\235b\3276\260o\267P\354\223\237M\313\275\334{\311s\205\270q\222v\363\215\364\355\006(\016\f\264\033\240\227\200\276\326\007\355\261?\350Q\350\020\366\007\265Ml\232]\243\300\262\335\004\b\307LM6\331\336K\036\2357bo\330\334|\004\350[\265K\240\267A\270\007}K\001j\003-\005\350\257\026a\177\320\020\326\007\365\300\376\240\277-\373\355\230%\333"
+	.string	"KMqm\267\275\227\032\364S\034\024\262\233\277\264?\250\266>\350\377\n@\241\177\252S\200\257\260-\210\324\3769\004\327\237'\320\361_*\277\005\374\257\0244\253\225\343\277\0312\216\254\365\177\005\020\317\340G\323\330\023~\f\202U\003\177\233\202E\341\330\345\317'\260~\253\201\337\212\360g\005\320\370\355\360\267\030\310\f\270\272\036>\377\353\346\256\371\3176\343\317V@)|\250B\341\035\374i\321\177\024~\377Th\205\277Y\300\202P\361c\036\370G\376S\b\360\270\036\232{\364\017\357\360\247\f\370o\013\377-\372/\226\273\374o\361\210\3539\177*\302\217\2372\325o\265&x\0056\310I\030*\305\321\267iB\226q\375~\213u0\316M\363c\t\344\030?F\377\263Y\020S\377=\362\004\374i\007\377\375\313\277\235\340\347\262Y\020\326\303\177\013"
+	.string	"\375\303M\374\350[vA\214\273\316\217\0329\201\203O\366y\361\333\251\377\002\3766\206\265(\374\331\205\005\321\002J\367\347\022Y*G\375\031\352\t\033\263\323\245\373/\332o\265\260\013\271\351\307+\374\030\304\345\222\231\362\016\301\217\247>\200?\r\300\177\3770\266\034\310\037\370\361\316Q\270\206\037\315\373\361\005\262\007r\007\360\013\371\205\021y\351\277[\356\330\177\223\374\327\312\217I\210\270^\330\177\213\240p\221\271\305\237\217\177N\372\263\021\304C\370\3213\377e\373\257X\334\177\315\376\013\345\277\307\377\316\375W\351r\261 $`A\310oQ\310D\231\370\337&\356\331\300\350\310}~\224\306\217\277\3748(\017\177\\&k"
+	.string	"\237\371\361\007Y\2301\370\355\026,\2243\2201\220\366\347\233/\360\347\324\002\377\365l\217\377\302e\234\n\374\226\356\267z\277\255\373m\336o\265\270Pp\r\260\030\013\034(S\340\317\020\310\023\310\021\370\277\002\210\253\360\243c?\006A.\301J\377i\006?\326\200O\254\26186\307n\261]\376\333\344\352\375\327\256"
+	.ascii	"\3527\260i\376\f\201?;\300\202x\005\177j\301\217A\220K\300 ."
+	.ascii	"\033|\002\033\340\037B\300\341G\003\177\273w\363~\374\341+L="
+	.ascii	"\370\247\036\3767\177\033\374\317\346\277\232\377i\376\373\375"
+	.ascii	"\366\374\337\346\267\332\342\377}\277\275\377\001\177\233\377"
+	.ascii	"\377\375\177\363\337\315o\321\337\246\277\265\377\321\374\017"
+	.ascii	"\374\032\233s\n~4\306\217\353~l\367\343,?\276\362\343\271\037"
+	.ascii	"\323\375\030\313\217\357~,\2649?V\373q\225\037\307\3758\305\237"
+	.ascii	"I"
+	.string	"\370\337\363\247g\177N\361g\021\376\\\200?{\360g\013\376\374\341\317\034\376\234\363g\375g\374\3436?\356\3731\337\217\301\374\230\313\217\363~\274\345\307`?6\362\343!?\016\362\343\037?\346\361\343\256\037s\375\030\352\307[?\276\361\343\254\037c\375\370\352\307V?N\3768\004?\236\372q\324\217\367\217[\374\270\003?N\372\361\361\307-\374\230\370\343\242\037\253?\026\372\361\360\307\302\037c\340\307\023\3701\013?F\341\307\017\370q\003~\234\342\307\t\370o\231\337\252\371q"
+	.ascii	"~\233\302\217C\374v\313\177\355~|\342\377\333oq\376\213\346\307"
+	.ascii	":\377\345\362\343\237\337j\3757\313\217\017\360\343\r~l\200\037"
+	.ascii	"\363\374v\354\267C?\376\217\013\360[\365\307 \374\370\203\037"
+	.ascii	"\007\375\267\370\337\243\337\202\370\357\221\377+\374\230\304"
+	.ascii	"\177\r\376\243\360_\357\2779\377\315\360\237\355\277J\377E\376"
+	.ascii	"\270\203\037\013\340\307\034\374x\304\217E\374X\203\037g\360"
+	.ascii	"c\f~\f\200\037_\360c\013~\f\342\307\025\374\230\202\377*~<\301"
+	.ascii	"\217%\370\261\207\037\003\375\270\303\217#\370\177\302ow~\253"
+	.ascii	"\363\333\234\377d\377=\360?\313\377\n\002\003\003\003\377\235"
+	.ascii	"\017\277\017\213\037\205#\001An\032FK:\300)\213\235W\2312ie\341"
+	.ascii	"\322\3300\357\214[\343n}P\206\267w\225\231\350\213\023\f\030"
+	.ascii	"s\357\252I\006'1\215\020K\366Y\030\364\305\235\273^0Z\022\005"
+	.ascii	"\257)W\356\313\245rB\fn\357\252\231\274U\201\314\2533\256\275"
+	.ascii	"\253*G_\334\270K\345DT2\b#\255\216\371\204G\002\270\366\256\302"
+	.ascii	"\346h\234%\367\256\356\f\364Er\357\252\211\2768\307\340-\260"
+	.ascii	"\345%\203\251\306\230\350\213\323\313\331\345DT\262\001i_\314"
+	.ascii	"K\006}q\315`\031V\037,\301;\305\200\301\355]5\357\f\364\305\355"
+	.ascii	"*[\2426\370\274\310R\344\237Y\332\037t'\313\372\240\007:\323"
+	.ascii	"\007:\242\017\344\245\313\004\275\370\341p\273\371@7\364\201"
+	.ascii	"`\350\0035\351w@\243\337\201\214~\207-\372\035\332\364;\214i"
+	.ascii	".n\354\350\346n~\007\"\372\314\303aN-'\242\222$\354\271h\362"
+	.ascii	"3\017\257a/\030-\351\200\275\027x\247\336\271g\327\316\274\363"
+	.ascii	"\356\330\f\237\241\345\235[N\260\252\023F\224\31317\376\272\350"
+	.ascii	"\374\016;\364;\\\351\031pmN\350n\226q.s\016\354c\247\251go\257"
+	.ascii	"7\345\336;\313\3108\354\336\007cMi\260\232\371\311\216\271\\"
+	.ascii	"l^Z\362\266mM8\213\307\337\240\320\004 v\204\f\227\251r\346,"
+	.ascii	"\353\340\312;\252>\020\323;\227\247\220\363\f\243%\033\340d\206"
+	.ascii	"i\253\334./1|\347\022\233\301h"
+	.string	"f`P\326$\rV\023gyEa\356\275\353\262\227\246.\004\210Ye\246\246\276%\233\374\"\307\030\353J\203\325\304b\226\267\207\205\263x@v\023\323\2112\275\fu\2710\030kr.\363\217L\367\301Ijo+\f\304\272\322`5\351\262\223m\033\323K\203\325<kf7^\002X\262d\263\304np\240\305\313\332Lg>(\263J\203\325\314\3144\031\315\211\250dP\306\236\031s\357\3452\2779\277ND%\035\3405\306d\223\243\262\213\275,\314,\203*oy\211\030\263J\203\325\344;\2278\r^c\345A\331\2214X\315\313<\227\271\013oa\264d\212=)8\226\371K6s\"*\031\244\332s;\345N)'\335Y\345L;\343N\267\363\312\371v>9\261\234Q\316\265s\312\251vf9\355\316\271\263\311I\345\254;\241\234p'\332i\345l;\235\234lv\355\\\342\252\343/\030\f\216X\023\223\312"
+	.string	"\331\214\307FW\016\273\233\337\301\005\223S\354\034;\311\354\332Yv.9\036\203\311<\227\235IN%;O={{\tQ\236\225\235FN0\214\226\324mi10\367^\236eg\330\036\021\345\331Yv\0169\225\026\017\310\336U\037$\251\222\006\253\271\367>\375\206\250y\311\220\037\201\026\375\b\252(\371\355\331\211\344\004\263q\306/\355\346G"
+	.string	"E\337m\177P\021\347\221%ON\023\326\224\274\233\037A\023\375\b\304\364\177\026\371\251\3743\363\214\001\373\260M,H\224\334|\022\t\372Y\244\002)sTnN\255\017\372\b\216h\034\301\020}\006\341\341\361\243\251\313\315\217"
+	.ascii	"\207\316\201g\024^*S8\311`\3668\201\234>\354\332\371\343O?N\030"
+	.ascii	"N\255\023QI\b8\305`\3768y\334\356\203\223\324n\332\341\201\221"
+	.ascii	"5f\220d6 Wt\350\374\037=}k6\303\203\305\003\242\200#P\334\262"
+	.ascii	"\304\230\247\326)uZ}p\222z@]\024\032\237\333\t\356\335\345\246"
+	.ascii	"\254\301\304\316a\211\260xn(\340\310\230\247\326i\343s;O=\373"
+	.ascii	"\211H\330\251u^y@\203|\2151k\236;N\257s\353\344:s\234:\316\256"
+	.ascii	"\023\207];\265\316\033O'\333Z\223\315\206\374\037\034\372?X\372"
+	.ascii	"?2\364\177\242\3649\270\321\347\200F\237\003\237>\007.ULf\364"
+	.ascii	"\250n>\2078\375\377\224qR\331\2653y"
+	.string	"\276pqN\361(\243<\223g\214sjC\0311z}M<e\314\337\032\232\317\301J\377\347\324\t\003\347M\031\2167'\214\363\305\216Y\221)\0367\337g\215\276\217\237\276\017\031}\237.\372?\231~F\375\204\322\200\023\027Y`\270\371t:\237~B\235M\373\204\372\200k\357\246\023\212\247\315\336M<\326Z`\255\005\231\211W\221'h\276\017\236>w\320O&( SV7o`}\320\373\\\321\367\221\323lr\2335\307$|;n\276\217\031\2335\370\213\031F\251\346y\r\323\030(_\226\350\373(\365_\006\364\013&\241\341\204\314\315\367\271\361\347\027\364B6\005M\337\263\037\006\314\341c\210\230\263,\032o7\337\207J{`}\320\314G\006\t\033?\270\233\277\001P\337\256\3452d\236\3244\271\033\363L\3467\001\302\345\262c|{in\316a\262\030\255\244b\202\022cU\227\345\315\r0\3013]\266"
+	.ascii	"\001c\367z\030\2312v\3637|\321v@\270\355I\354\346\377\231\213"
+	.ascii	"]\313]\362\025"
+	.string	"\267.\031K\336sREIX\316v\241\206J\336\323\2632d0\245n\316yA\273+\032Wn\376\2060\375\347-v-\343\361\211\330\001fu\363\001\363\335\377\340\375\321\305\314\232\233\377|\367\254%\271\333l\334l\227\362U\3515\271\371\033|\350,\371\312\335\321\304\245\352\346o\360\322\337P\245\277a\312\312\230\262\032l7\177\303\216\313rv-\317\345!\317=\262\217\003\315\345 9\206\235\247\345\256J\303\364\315e\"\231\212\305\313\352\331O|n,\233\2257}hn\222\247\220Q\302\345\267\\\305\256e*\317Tr\221\034\266\303\244ao\037m\224T\262X^Z\241f\232\276\352<\214\030\2013\325\003\007\223\316Q\262\024\273\226\247d(l\371\211\305\313Zn\253\035(]_u\315)9-\257}p\222*An\fS\307}\311\005A\3635\374\351??yv\242\343\342\r\354K[v\313@#\013O\356\346k"
+	.ascii	"\243\333ne\030\201\312r\3635l\321\267k/\223\325\316\227\205\330"
+	.ascii	"a\225\335|\rX\3645\304\351kx[f&\271\314\342\271\241\270;\313"
+	.ascii	"hv-/\263Y^f%\0263\314\235\"`ceh\276\2064\235\227<\265i\271\231"
+	.ascii	",\217m\035\035>\034sHn\276\0061}\rG\3645\020\311J\362\022\273"
+	.ascii	"\226\303r\222\333\270\f\344@\313\275"
+	.string	"\243\344\260l$#\371\340$eB\2165d9,+m\333\016\323rS\341\0249\362U\327\334{\t4bD\312\243\312\331\027\232\257\301I\377\031I\006\263!%\245\315\362\244\313\3422$\037\311C\304\274\330|7\277\247\215~\317\237~\317\030\375\036=\375\036+\372+\013i\3532\013\273\371=Q\276z\324\264\355Yj\273\264?(\020\023\375\036#\372=A\362\016\274\034\2706QX7\277\007K\333\036\030\372<\201Z\213g\006\2166\251\233\317#F\177"
+	.ascii	"xG\266\302hI\375\344\007\021f\316\3127\354Z\266\221gd\033\371"
+	.ascii	"*\327\260xn\273i\006\006\200g\336$\201F\350<i\262\301B3\215\214"
+	.ascii	"\305\003c\b\fBb\240\301\263C\237g*\231\253\256\325\332\227\213"
+	.ascii	"\233\317\263\223e\264MZ\0374O\331=4k\\\334\374\235\273\fC.K\341"
+	.ascii	"\345\224+z7\177\207-\303\260\303D\177G\251\357\346\245\277\223"
+	.ascii	"\324\257\263?\350w\266\306o2\226\226\036Dn\276NS_G\214>\030\373"
+	.ascii	"\203Z.\353\203b5<xD\254L\271\371:Yps\n\240E\002u\206\344\346"
+	.ascii	"\3530\361\263k\370\0173\361\037>\203\373,\236\333\336U\002\020"
+	.ascii	"\253\322\353kZ\255,N[r\356;\336\202\013c\225\344\346\353\204"
+	.ascii	"\351\353\360\320\327\241\241\255\316"
+	.string	"\223>\353\254\017j\341\332h\237\245\375Ao\230\365A\273\340`\3712\205\343\346\347\210\311\303v\030o'\270w\227\033e\036v\303W\230\264\311\303Xv\t\345\336U\030\027\274\207\365\354\032\316\303Y\216\323\260\032\320\005p\312\245\316X\013\276\263k\237\303[\202O\313\255\026\204\216)\310\315\317\321\323-\366\336\333~\016M?\207>\247\212~\316R?\207L\377\367\213\r\267\341\2723\313Y\026\334\315tm\234\374\214\334\374\034$\372\003\210\002\345o\030-\031\301\213=\030p\237\303hI\315\3465\305${\"\207\251\3408<\207\255\3305\\\005K9\236\202\337\346p\025\354dC\251\t\300\210\021\275\276\346\2104\207^\035\\N~\016\rm\271\354\017\312\301\372\240\317\211\241\237\023\245\217\023\250\217\323\324\3079\243\217SFc<\373\203\" O\347(\326\007\275J\353\203b\2349\r\264\264?(\226\262>(^Z\037t\f"
+	.ascii	"g[Nn\030G\0160J|C+\fS\t\336\201\301,\236[fn\301YJp\0221K\260"
+	.ascii	"\030f\202\303\354\032V\202\221d!Z\226Y\031\362q\320\364q\220"
+	.ascii	"\350\037w\351\300\\\370\310\265c{,\354f#\026\212\023f\214\233"
+	.ascii	"\217\263C\343!\270\007\366a\361\200d&?\360\326Np\357\246:%\036"
+	.ascii	"\202\201\340-\213\347\226\225\2741\205\340\030\260\022\027\301"
+	.ascii	"D\354\032\036\202\203xY\270\235so.,x\b\376\262p;M\313\235L\241"
+	.ascii	"\030Y\362\246\271\367r\204\346\021\005\306#'?\203\031\375\fv"
+	.ascii	"\372\031\342\3643D\321>~\314\303\232\331=\233Z\311\241U\271\371"
+	.ascii	"\031\226\032\005\323&\202\216\273\3200\271\035jn~\206\030t^\332"
+	.ascii	"\037\364n^\372K\353\203\332\260s\177\273[\316\344h\336\374\f"
+	.ascii	"X\372p\326\007\315\261>\350\361\254\017\372\fT\032\205\3034\216"
+	.ascii	"\257\260\333\222"
+	.string	"\212\324\3153p\036\022-\272\233\237\001Jc+\\\20521\343\224\274\371A6\372A>\375\240\036\226\361\3372\227\017\307\310|gY\232n\306S9N\310<E\335\374`\025\375\037\273\300/lZ\t\304\205\313\344-y\023\026\374c{\003+r\255t;B\345w\263\026\242\211\340\340\340\272\202BD\017\311\371\253\341\303n\254\213\336\256\241c\300H\236\204lA\335\254\277N%l\264X\271Y\007\321>\244l4c\334\254\177h \377\203\250\224\037\017-\032\210\231\r\032PRn\326<\264\017\260\300\246(\355C\367\230\353Q\006\343\346\315\263\263f\217*\r\006At\016\235C\357\220\242\314y\263k\323\343\272\336a\301\310\3400s\263\326\361)m\\h\201\303\300Jci,\275\345!k\352\214I\320\007\337\0209\255u\275\205\223\304\217\312\362f}\343S\264Xy\223\303\306\377`\332\314\242\245D\333\320Ye\360\302\222"
+	.string	"\006\255\274\001\206\32150S\215\311\223/uZ\206\226\241\257\304\226~\251\\\323\313i\306\365U\331\022 En\326T\332\352\177P\007\257\351\207\235\266\322U\\M\345\f<\305\363\347\005F\016\235\274~VL(3\326^\274\320S\266g\351\264wEy\3065\361\266\300\270\236\342\333Q\223\233\222F\246\2414\224\226\002\322\273,\r\013s\357,\021@M\272|\201\341Z\212\217g3\2734o\326Qcau4"
+	.string	"\200\344\315\033\355d\233l\252\017chz}:\252\331\266D7];\231I\242$\242\231\324\254\265\301\322Lz7\351\242A\205\016O\031\206\226\006b)\200H\260\374\335|"
+	.string	"\350\370{\272\346/m\223\312\001m\247\247\235#\210\017\233\251%f\315-\265%\242\310\207\016;6O\333\330\241\201kp]i\363\251\232?\230~\351\222\245\311\315\277\340\213N\321<M\363\007O\255\031c\220\334\374\013\364\364\237\002\376\301\034 vw}7\377\002;\375\013\346\230\314\264\017\210\213\t\315\316\215)0+9Q\264\346\264\244g\236\366A\275\200\322K2'\207d\314\315\277"
+	.string	"K\214\230\224\357\370i\347 \202\222M\025\261\303S4\344\220\360\225\341\273\333\202\345\346\224\214\336S\323#\313\315\267 /\035c\001\224\324\213\227\024\f\020\027\023\23249%\304Js\357,\021\367\206\337\335\327\227\247`\3702\274\211:\003\345\310\377\240\007b\204\020\271\371\026\304\240\237\352\331\224K\312\305\266\001m\2463\"\300\366\3528\300\231b\372Jr\363-\260\241\255\265m\350\237\346\245yw\252\204\236\275\275\334\340v2\213\2033\310\327\f 7\337\002\027\372V\314\246I\2366I\223\244[\202\234v\023\021\001,\211\333\342"
+	.string	"g\353L\017\272\233\357\322\246/^\256\334\374\020m\364-YZ\272F\206\231\262\215a:I\241X< \nP\262%(+S\265\017NR%\220\211a\322\245RR\271)\315')]\352\006\346J\252%\265K\261\244V\322\2724\213]K\351\322()]\332\246"
+	.ascii	"\2620\314\275\227<\177cm5zr\232\3662\037\234\244J0\343K\343\322"
+	.ascii	"9\273\226\312=\225\313X\322*\005\270\233\372\241\3640B\247\217"
+	.ascii	"\013\030-\264\n\225\345\017\277\233S\270\254\032Y\240n~\b;\375"
+	.ascii	"\247S\354Z\372\246\001\303\250\260)\363?\210C\367\345eE?\204"
+	.ascii	"\223\364\211\356\302\304qw\363C\244\351\2078\323\017\021\246"
+	.ascii	"\037\002L?\004\021\375\247k\251\232\032\226\277\273T\315\266"
+	.ascii	"\355i\231r\272\371!\276tj\226.S\264?\310\303\004\316\007\224"
+	.ascii	"\233\037\242K?\210\302\327\026(7g\262\247e\177\360f)\242\214"
+	.ascii	"q\363C\340\320O\231\244c\177p\007\f\021'h7?\004\r\375T\fJ\340"
+	.ascii	"\237\215\233\3230\035\025\002\206\r2\340\230\242CK\311\323\260"
+	.ascii	"?]\202\333\274\020\350&\315\315:\326\007\3056\202\236*\301\271"
+	.ascii	"\263\302<\273\371 \374\300\300P\346\2227\246\225\253-_7\037\204"
+	.ascii	"\236N\213\244ER#vK\2400w\326\226\210\240\235\033.M\251\362\251"
+	.ascii	"\221\26761yq7[\021\"$\035r\271\366\336Q\273\005\230%dL\235\027"
+	.ascii	"\203[\215\030\236\016\261pf\177tP \332t\220 h`po@\374\204Y\004"
+	.ascii	"\356\346\2038\342\303G\372\3436\271"
+	.string	"\375\366p\316x\361\273\2739\375\001V\226\206\355\346\203\320\241\377\224\307Z\312\303\356\211\330MM!\300\322~(\233 \\tu\241uw\357\275\225i]\0226\314\235!}P^\2009r\244\\\357i\332\333i\357\0346P-`:J\242\342\320t<\345\262{:cmRf]\244\264\242\330\334\374\n\262\350?\335J\267>g\223\272\315\351\006s'7\007\257\340\354\306\r\274\005\324\263\267\227\r\345\021\375\247Yv-\315\302[Xj\357\252\023`NI\016^\301\r,,\364\211F\301\274~(\303\260\013,wEn~\005SWWh\035\005Z\2342\314\355i)\273\371\0250\351\324*\265B\003K\330\034\374f\374"
+	.string	"C5u\363)\320\222\312He\244\311-3v\230\260Y\253\243z\232\314A\310\320\030s\363\001/\327\377`\316\013\253\270\0347\237\0027\235J\245R\351\224\016#\267\303\017\306\323\251s\013\263M`\372\342t\2225\227$}\221\272\330\211\022gUcg\212\036\033\324\315\247"
+	.ascii	"H\332\224F\245M)\024\232:\245N)\224\005D\2578\235.\266\356\344"
+	.ascii	"\322\247\247Pcb\004)2\305\210\025\027Jn>\0051\364?\214q\223n"
+	.ascii	"7h\240\006o\336\240\201\301\235D@\\\034\212\204\207\231\256\233"
+	.ascii	"\003\215\200yMQ\321\377\240\374C\325\374\241l\326\034e\303\227"
+	.ascii	"\316!92\007x@\264y7\327\336\312\264\r\n\031&\332|\273^^\222\\"
+	.ascii	"nF\321d\240\222,C\345\346\003~\356\1770\323\2402\246\345\346"
+	.ascii	"\177\320\241\377\001\2062\350\2312h\037\272\267]rQ%\373\370\370"
+	.ascii	"P\246f\262t3\314\034e\222\251q\211q\363\004}\372\023X\0313\006"
+	.ascii	"J\2300h\235\365;b\226\305\344\313\227\t\276\364/\227E\273t\271"
+	.ascii	"\\@\233\351\214\007I\234&p\241\177to\r\335Cw\374|\332<\312\224"
+	.ascii	"{gq\240c\204\311\232\323\315\237\300)/\317\266\331&\233*\003"
+	.ascii	"\fiK\2164\367\256\343 \2731\343%\310\315\227`\213\376\321-v\r"
+	.ascii	"\335r\247l\325\336MY!\226\304\341hA\343\242O\n\026,\250\026\344"
+	.ascii	"\336\017e\230\335Q-\027\310\037\230\270\233\321,h\034\035\216"
+	.ascii	"*_n>"
+	.string	"\240m\373\037<\275\320\220y\273\371\022(\241\243C\353\322 iG\314\320\272S\017\t\221'7_\002&88t.\b,M\356\350\334\034Z\306L\016.\356\177p\347G\222,o\342\320*0\342\240\256p\241\322DL\355f\224\312y\327\324u\003\315\315\367\320\247\177t\312\032:\345ry\220\276\355\301`\346\351\037\215b\327\320('X\t\273\311\n\003#qK\016\356\241\212\233\033\372\304\356\275w\326f:\003\002\r\247\244\210\037ur\364\311\016\331\034S\315\315\007<\301\376\007\205s_\315\233\357!M\037=C\227G\321\216\206\262\351\2757\323rS\001\211\201\375P6wV\226\210T\315\024+u\350\332Q6?97L\250Z\023 W\237Z\032\352\327\024Fwa\374i\271Q\2036\261|\271\f\352+y\363=\020\321\377\355\357\217\356\246\344\336\333\352\\\356\244S\016\372\333\333\323Z\021\277\216\305\366\202\377\371\337"
+	.ascii	"\321rG\315\375\355\275\355\237\006{k\322\n\261\377\275\237\272"
+	.ascii	"\230\024\320U\365\324UCJ\255\253J\203\224Z\327fz\"\302\244!\271"
+	.ascii	"\273\230\244\324\366\326\360\364\304\204\202\253JJ\255ik\220"
+	.ascii	"R\333U\033J\257\312\356e\027\323~\342\332\032\366\323n\332j\\"
+	.ascii	"U!\244\236\272\252\244\324\232\2524H\251uUm\265\256\335\263\237"
+	.ascii	"\232\222.\236vR\303V\353:\263\325\270\252z\244\324\270\252"
+	.string	"\244\324\272\304X\0340\276\354\260\344\376\206\004\261URO[F\214\255\246d\017\236\324\222k\203\331\333\272E\355\344\306\333\373\202\275\267\270\222`\232jX8'<\031NQ\232\270\354r\357\355!\206\223\027\327~\302c\262\033O\n\t\327\336H\234\214v\214\275\367\376\200i\211\267\203X<&\036[{*jo\t\366r\357\030{3\331\215\267\367f\332{\247\311\255\345\3367z\244\2241b\354\235\005\024co1Q\211\332\373\272\211\201\253\222R\363\342\n\242\302\246\246\3340,\231\254\324\024\327Vn0]I\255\306\204\266\247\366\336\326O+\253f\364\335\374\333\265\277\241eh\312\275wO\216\230?)n7\337\203\323Rgc9\0233&v\367ee\311\355\032\272\004\025\013J\355]\205\201\221\031?\224\315\235\314\342@\223\211\362\302\312\315hX\236\\\331\324\315\007\312\323\007\262\323?\252\344v\031B\367'w3\212\204"
+	.string	"{O\031\007\206\032\2715`\034\261\272\371@l\250r\211\003\227\303\311\325]\252\355\275yr\304<\331\0028\344\314\343\233kB&\2062;zd\230\304\tA\277\236P9\r\2719G\331\004N.\b\220\f[ouh7g\300z\352\373\373\221a\370\270o\366\305\214'\260\036\367\006\017-\263\260\030^\270\231\206\205IS\027\272\203EV\226\331EwX\256\275;\354\314X\013\273\301uv\331\331\"\265u\240:\372\316\266&WM4\007\212\343\310\325X\226\233\227O`>d|m\341\255\324,\206\r)\255S\213\005RD\251u\343/\267q\333K\263\301\225\216Y\361r\313\022\241\306\213S\330\315?Z\343\213j\f\314\315\271K\271w\325\004\023\346\ts\357-f\214\023\265\265\233\346\301\030\327\336U\223\214\314\311g\203\031\224yp\355]a\341\032\230\f\243%\033\2206$3\277"
+	.ascii	"a\226\341e\fjlc\311%\016\270\275\253\346\311t\242R\006\242Q\347"
+	.ascii	"\233\223\r\n\205N\235\177(\fg\233s\r*\205\316@c\234nP&t\2434"
+	.ascii	"\320\253\023\315\331D\235\320$*\343L\203R\241Oh\323\tx\252A\261"
+	.ascii	"\320*\324\nu\201\302\260k\350\213\363\314\317\276\323\317\314"
+	.ascii	"\311\007\266}\004\031\326\"1\004\262\250\224s4\246\350Y\213D"
+	.ascii	"\214da\310H<\252)lP\301\201\250H\034\0363\334\210\204\212D\\"
+	.ascii	"W\341p=RQ\250H\304\025'\tI(\270\"\217Eb\212\"\004\220D\nT\025"
+	.ascii	"#\024\025\325ux\244$t4\254\240H\034\222\2403\302O\212\024\036"
+	.ascii	"\360\303\243B\0047\"\261\026U\244\241\343\320\270\002\203!1\002"
+	.ascii	"\0346\034\207\352\321\b,\324!m\204TJ\201\205:\224\022Y\250(\206"
+	.ascii	"\216\303"
+	.string	"\241\342pU\301B\035\342p#\022\310\243\243\241\220\321:D*\341\202\361h\264\032\213)\321P=\312+\262h\024:\211\326\"\361x\204\336\210\204\020qE\266\200\034\256pT\217\224\206T#!\344\207\033\221\020\022\252H\304\265\250t,!D\004B\025\0169 \213\206G)\324\243\025C$\021\205Z\364s#\022%\214\304\016(\222\261\250\242H2\032\0370DLAeA\\\205\206\033\226\222\214#\360\2547\"Q\224T\242(\311G\250\250\204\263\252H\365x\"\205EI9\253\260X\224t\026\213\222\260\321ZTT\217P\365\005\"2/%\031\205\362qM\302Cj:\244\"\22522\375QX\224DBg\351\270\"\211E\252\n>$\364\250G\353j<\032\255P\\\032\302A&\241P\327\241\n\310\025\"pXU\0226\374\370\254\340a\202\243\022r\250\2360\244\016;\024\025\211\031\212\212\304bQI\205\024H\""
+	.ascii	"8\220\200$\202\220\240hxTY\210p\244\204\244$$$\302\252\222`<"
+	.ascii	".\025Y\340aU\217\222\220\214# M0\036\227\212B\364"
+	.string	"\250\353p(\211\005\016\036\220X\217\303$\022\023dP\321\3033\244\256\307\341\252\0029\224@Q\221\210t\024aE\036\211D!\316\033\221(RZ\241\016\225\030:\"*\255P\207\214'\004\221\324\025\271\244B\250\201\004\244\243\221\350\250&Ep!\022GIHD\r\220\222t\206\206\252\n;F;\302b\212UE\252*\024%q\270\020\361\250\026\325\"\375\017B\350 \204\023-\322\2370\200\007\006\360"
+	.ascii	"\375\t\003\004\005\031 \204 \375\020\202\360:4\036\021\235\027"
+	.ascii	"\"\261\032\217KEY\025\016\231\320\002r\270jU\250\016\031O8\252"
+	.ascii	"I\252\272\"\007\211\256j\321q\270\356\254B\023\003P\221\210k"
+	.ascii	"\222\321\370\200\035\242\021P\210\200\203\244\244\"(\201!\365"
+	.ascii	"h\305\260\310\200\242\013\306\241\016A+\344\334\210D\006'Rh$"
+	.ascii	"\"\246@W!\222\005\025\211\270j$\013+RuA-j$j$\"\022\345\225G\230"
+	.ascii	"\336\210\304*\244t\\\221&\220\302\026\352\252\204\244\241\005"
+	.ascii	"!\343\221P\210\256E%\243\220P\230\036\325\242\013F\2410E\036"
+	.ascii	"U\244RQ(\324CEb\013B!\212,\022\223\220BaZ4\022\221\304#U(\f\256"
+	.ascii	"\302\025I<\352\271\021\t\244\232\264\264v0\244\036\207F\310\016"
+	.ascii	"J W\342\212\022J\305\242\016Z(\025\211G\035|\020\2020\204\023"
+	.ascii	"-J\250CJGBEb\211#R\251D\001\326\026j\361hX<\252k\221(\034\032"
+	.ascii	"\252G\2435I(\354\300B=&\t\205\350\212$\036\t\205\350p\035\016"
+	.ascii	"\t\205\350qh$\224\325\027\210H\241\020mA\310x\224Wb\321\204\225"
+	.ascii	"X$\242E\024\371S"
+	.string	"La$\"\246\030\032\252\307\f\3075\005\241\242R\212\341:D14TU0\036\227H\360PL\241s#\022\304\265\205zT\217\206\212\303\022\210k\013\325g-\022]\244PHU\241\005\241\341\212\243\243\341\b\304\265\205\252\201\270\266P\363\212\024\022\223T\020\251(\324\244\245\025\204&\244\240\002G\025*\016Wd\221\250W!\004L\310Eb\nE\244\020JLBb\244p\004\023&\340\214`\302\204 *d\202\210oD\002\251\264Bx\302P\317Q]\221C$\024\211T\217CC\303Te1<R\241\224\204\244\225\204,\324!\244\322\n\215\024\252BD\026*\n\244\322\n\034U\250&-\255\200TZ\021T\223\226V\244\322\212\024\251\264\002\253GC!\344i<\252\025\320#\240\020!\205\r.\fU\030\001E\006\365\250\264\016\217j\022\222\272\342\2547\"\241\224\204$4\036\227\212\204\204\206%\220G\225\005\3618\024"
+	.string	"U\250\202\007 x\020\202R\022\222O\321H\\\225\216\214H\365\230\001)\344\240\n\225\222\220p\326#%\244\252B\321HTJB\332\240\n\213E\304\243\241p\247XD<\022A\250\363B\t\016P\327\241\nKCCU\205\341:\034\n\022%\035\345\020%\035\t_0j\301\304"
+	.string	"6 \223\214G\024Gu\210\310\202\210B)\t\211g\025\026\rW0\022\323\242\341\n\304\265\005\003\326\242\tJIH:\252p\247\004$\213\024\n\223\210|Z\020\217\353\360\204\325x\334I\327Uhb"
+	.string	"k\221\230\026\025\211E\342\020IU\001\251\036\t-\t\361 \205\032\220\224\220x\275\021\t\244\321:D*\n\2210R\310B\035Z\221\351\t'\250\030:2\n\221P\025.\250E!\022z\034\262\300B8&V\243\"\242\352\002\212\024\346\2547\"!\264`\350\310XB\022\361H\210\007)L\241\325\242\342\320H\bua\250\002R\311Hd\241\036\223p\220-\b)\255\310\034\2648TO \"\"\016iU\2508$\036\207\021 \"\"\016\345\024\215D\244\022\021\272\"\205,T\024,T\024*\\\030\036s\212\304\241\321\b8\253\t\344E\n\325\242\341\252\202C\020\362\236H\241:4\024B\016G\340Y\213J\306\021\324\242\341\212\314 D\\\207+2\207\303\221\316\317\252AI\370"
+	.ascii	"\343q\251\310gm\301\"\2058\352:\\\221\247\272\016W\025Ak\322"
+	.ascii	"\316\316\317qM\241gE\n\265\211b\212\245\243\244$\021\"\330Yo"
+	.ascii	"D\242D\321\210\204d\024\232\300\304\322E\n\207\206J\034 \256"
+	.ascii	"\330\361`\305\rZqM\254\270A\303kbx\203Z\\\023-n\320\3225Q\\B"
+	.ascii	"\301\363B\t\352:TA=JB\032\252\020\022\032\362\250H\026\214+\030"
+	.ascii	"\217KEAu\310xB\321H\\\205\324\325xL\0019,\301x\\*\362pd4.@"
+	.string	"x\026\025\211E$\034\r\225P\250H%\016\253\260\205:T$\n\221BD\244aqiH\270\032\025\021\217\210: \211-D(RZ\241\242H\221S$\266\030\236@\224\364\200\342\322P\260\005\344\360\004$\261\205\b\306\236\365F\022\334\230\244\036K\254F\343\261\004\316\220\272\n\251\253\212\002\211\024\026\021\211\212\306\234\241#\243\021R=\032\255\260\026U$\225\205\361\004\343q\251(\004Q\322\221P=\016]\030:\016\215\216H\"\241Q\021\321HGE*\t\215+\316\013F</\030\365\004\005\231\020\276`\304\301\204\220\210\310\270*\t\255DF$P\352\302pI\270\252H\"\"#\217\013\306#\242\243\312\002\002-\b\251FB:\032\324\244\245Uh\002\211\034&\271`<\332\240\204\242h$\256\303\343\n\342\321p\004\343q\251\250\203\220(\351HX\\\032\362y\301H\330b\270\026U\241\243\232$4Z\207\210.t\340"
+	.ascii	"\316*\f!h-\022\225\364\013F\302\"\021\251\347\250\"\227\216\206"
+	.ascii	"\305\241\320Hh5\026\205\305\245\241\r\253\360\304Z$*\245\017"
+	.ascii	"\n\032!\004\013(\220\240\205H\030\217KE%\220G#\262\250\"K\024"
+	.ascii	"\211C\244\022BGd\t\022\036\220\304\026Ca\221\322\nuHxT\327#\""
+	.ascii	"\221\320x\\*\212\340\177p"
+	.string	"\207\336\241\323Fn\315\037\327\226m\222\374\322\201\346\2321![\006s\004qX1clc\256\266\301\306\314\225\254\254\240\32674\341@\200\037\336\336UP+x#\247\316,\rZ\360F\320\306\335wa\332n\226\2265w7_\0032\372\017\326\020c\323\213\022\303B\313z~l\272\320\320l)XSX\340\325m\242\306\r\235\222\340\214{WD.\253\357\346`\225\036\203\222\304\355\346k\260E\377\301d\n\225\256\0019\323A\205>A\337\364\255Q\221Q\027\234\nN\241O@\260\2617E\377A\030\372\212\307\r\211\021\271\340\013\034\343\316\340\021\006L\320E\220I\021\275\0337\353\036\026\263\361R\326\301\020d\312\201\373c\203!\n\223\245|f\354\204@i\345\336U\022\032OL\036\036Yl\23485\355\224\210\005\233\3209(i\262\250nF\315\356Y\222\306V\340\316\335\027/`n\276\006O\364\257\337\240}Nl"
+	.string	"\361rsTK\f7$j7/\311\250\204p\261A\331h\225\351\370K\273\224tY\335\374\367\247\233\301\244\237"
+	.ascii	"\342\252\244\301Js\335\344\241\203\222\027\003\032+F~\bA\243"
+	.ascii	"\001q\266\320\231\271\300\341\252J\362\345\346k\260\244\257\017"
+	.ascii	"m\332\002\210\245i\320\245\227Tds2\306\214\321f\372>\270\222"
+	.ascii	"\247\327\307wm\346MIZ\031*7\3532\177C\353AE\357fMF\203\032\372"
+	.ascii	"\327b\300\354\232\264\261r\363\336\236\006c\223~\035\220M\231"
+	.ascii	"Y\323\334YW\"~\335\345\032\214\376\"\346\307\034\226\253\275"
+	.ascii	"\360\320\001\352\200\273\371\031\234\321\232\013\326{3$M\006"
+	.ascii	"_"
+	.string	"\364\257\365R0lK\306\270\345\361\331\321X\036\301K\373^0q#c\211\244-\314\313]\332\206\2559\305Jk\321NUo:\252h;-\225C\356\n\232,SY\350\240\004\301\202\353\360\356\342"
+	.string	"o\326u\272N[)\201\311\00232pB\205\212\266\022\364\200\316o\356\332\n\021):\344\344\364\232\270$I\344t\334\031`\340U\227\245\216C\262|\253\202\263\364"
+	.string	"[C\346\346g DK\321R\364\233\375 \313\336\017eSO\271~\313\300J\353'\372\211\206\322\027\342J\332\017eSC\301xPf@\304n>\006~\372vM;\t\\@\337T\0177\224M\355\211\227\346\315ii\232m\357\212N\\\231\236\232\265k\266\267\274\003\214\215\0377k\265\277MA\003#\244\313\330\3074\232m\262\251\016\240\364\353\013\253\002\246\noy\215\026\366\006\n\215\2335\231>\233\261\243\371\246\317\264\231\221!2jh\271\200c|Ne\267\256\214\f3m\336\216\374\210\026\263M6\025\001\270\374\372\302\366\316\022a\204\3257\245\303\256\305\370x\232LaQs\263F\242\227\320\2718s\243\227h%Tx"
+	.ascii	"iBk\243\325\367E'\271`H\272\230\340\335\254\301\376V\327D\n\363"
+	.ascii	"\344C\357\250\332\254\021\363\272W\207\340\250S\262\223jT\246"
+	.ascii	"\306 %\225B\nQ\215\314&I\007\023\025@0HH\"\223\212\267\321\347"
+	.ascii	"\001\023\200C\313\213\304\231\242&\235cdFDD\223\222rR\243\003"
+	.ascii	"\346\036\202\276h\364{7\222Ql9\320\351\232\343\234\003|3;\347"
+	.ascii	"\344~Yu\023\326\336\324\201\352'\034\320\001\262\306kg\013\310"
+	.ascii	"\333D\007<\364\304\310\216c\017\212\231\316@BE\343\276./K\350"
+	.ascii	"\274\023o!\343#\343^\307y>\372\306\341\210\210\245\242\307\211"
+	.ascii	"i\246\247h\347&\224\326\335\f{.Pp\226@$D?\241\016c\271\303\355"
+	.ascii	"&;\313d\210\373\001\342Dj,\370a\320\033zH\374\2303P\244\001\375"
+	.ascii	"\237\024,\266\031\002\325Nl\261\212\020\267\200\001\217\244\306"
+	.ascii	"\252P\321~\255\366\253\177\276v\215\0166\366\341i\n\037\2539"
+	.ascii	"G\t\364\017\233\375\316\326P\341\0029d\343\320\214+=\216\312"
+	.ascii	"e\274\302\341(4\365\341+\234B\025$\237\226\365\311\030\026\342"
+	.ascii	"\263\264\017\376\265lMz`\247\376E\225\213\214\215\277\355\222"
+	.ascii	"oa \345\013\223\230\214\225Fu;~\300Z\327\030\300\323e\035\374"
+	.ascii	"\365\327\347[Xw\315w\3121\025\360\317\276\233\305\326,\031q\354"
+	.ascii	"Vh4Cl\216+UU\206\221\333X\213\226\221j\t\250t\253=\027\301.e"
+	.ascii	" 5\004\313\267Jj\352\247\315\352E\021\207 \327\212\223\f\351"
+	.ascii	"\247\177a7\310\217\365\025\005\025Q\204\206\362\245E\224\254"
+	.ascii	"\024\327.}\221\211\272\264yO\316\232$\341\023\2415\300\2515\337"
+	.ascii	"\032\227\322\223\210\215\027U\226\025\327\210;\231\342\324\005"
+	.ascii	"`:\025j\320M\320\003\245\371\2779\266C\330k@-\315)cYH\217D\360"
+	.ascii	"\237k\f\0032\034\373@\243L\347t\376\020t\227\0242\030\212\323"
+	.ascii	"{\211@D\304\003F\032\222\244\265\244\355Pfst\307*0\217|\276%"
+	.ascii	"P\026\305J\3175\207#E\273\336\227\037R\204\266\346iz\n\206\205"
+	.ascii	"\031\247\017\366\354\352`]\016\377\226\346YU\333\307*9Y\f\310"
+	.ascii	"\326\r\232\305\273\327\0239\230K\371\270G\2337\314\224\025\243"
+	.ascii	"\274\025\230\021\032\2310X\221|\332\252y8\377d\226\256\017p\275"
+	.ascii	"\022\27169\177]\021@\375\033g\271\323oo\211\002\254\374\037\331"
+	.ascii	"\312T\200\207\270r\266\242=r`\261\205\264\220'\241\n\202\303"
+	.ascii	"x\033\325X\036r\365\006,\311\343~!8W\275g\26014\317\267F\365"
+	.ascii	"I$\312\353\354\330\005\271S\352P\037\007npQ\274\346\263\250r"
+	.ascii	"\255\275\022\233xO\232\3400\226.cG\331\034\353X\\\251\235\034"
+	.ascii	"\002Gc\006\331+\"\372\257B\303\025r\226\374\b\272\247F\271\035"
+	.ascii	"M\250\032\021j\2542\tL\256k\272"
+	.string	"xN\231[\252\242 \346;/\316sA\252\372\252\307J\305\224]1\b\345\321\3000\300\263]\250\234t\307\375\366\347x<\212\234J\274\330m\371\230\212V\006\317\356g\245\341\020\037\017\037\252\334\333\n\356\247\222Y\221\346\002\337\223\274j\312\301\\\374\t\277\346\340\277Yp\b\217\036\214l\212w1\013?\325;\215\204\021\230$\257\344\020\360\3719\252\235\240\226\022\032\277\027\234C\366\320Q\274\277\240\237\034\200\327\250Z\351\242\241\217\017.`e\366\221A\016\324t\250\370*\301\352\241T\n\304\207u\231 \341\f\213la\227/\265`n\376\306\375&].\234\213\272\244\177\336EPB,\232-h\367z\320\346\177\265\027\374\340\346\223\217\021\242>\253:J\373\"\274\316\223\3550\207E6\327\362D\264\216\312\224\026s\374t\341ZQ\232mA\277Sh-\rI\216\314\366\352\363\312^f\013=\321\350\210f\354H\tY\027"
+	.string	"\025\212\237\244\03796']\302\226(\213t\\\372;e.\321\323\200I\n\310\360_\006\027\230\365\3755>rdf!\"\351D\013K\340\310\205\342l\226\336\270\231\235i\347\253\353H\263\231[\350h\326\0062\342\034:i\033\257\007;\003\352\372\006h\367\325\263M\345\\\324"
+	.ascii	"\027\361]\211V\333T\001Kz\342\325s9\352M\263D=\327\364B \231"
+	.ascii	"CU::\331\212\b6\336\374\200\343E\031\\\302$\037\334\270\351\257"
+	.ascii	"\301d{\n\350:\324\304\302\001\242\306\215e8\256]K_K\243\245\023"
+	.ascii	"c\311k\327\253\032\373\343\367\254\303/n\362B\026}o\275.\333"
+	.ascii	"e\307DFwy760m\020\375\314N\321\363z\303\030\224\004\313\tN\310"
+	.ascii	"s\354h\340\252R\227\276\231\004\202{?\267\005o\346\272\304k}"
+	.ascii	"\024 ^\n(su\356\b{v\244\033\240u\355!\203\322\001\032P#\330H"
+	.ascii	"&+s\267\274\360\"\357\037\\i\017\245\351&\260\247\3325&\226k"
+	.ascii	"\301\fz\013\220\265\224\212\323\f\030~\201\342\211\231\331gO"
+	.ascii	"_\204\236.\026~\312\211\333\212\t\b?fp\fN,\2556=\013\241\023"
+	.ascii	"\304@\375}0M\250\257]\320\226m\323\b\370h|\227eN*\201^\025\270"
+	.ascii	"p\265\016\017\326[<AZ)E\316r\031n\262\205\211\216\373b\2253C"
+	.ascii	"\347\231\023q(Q\220\001\177H\254"
+	.string	"\232Q\244\021\225QC\262\006d\276/t\372\002\\\240w\243p\306\243!\225\344T\260\223\377\350\203\217\234;\330\317\226\270\026f<\0064\240\243\343\302\274qC\373\305\212a\340\350\031\256\333\035G\220\330\273\356\002\351\205\262\317\005\030\244\231\257\316 \021\236n3\367o\217\263\351\271Y\251\217\266\350\354\003\333\313Dnt\357\007pL/\226\307\330u\330\364R\217\231\311\034\030\f\305\324\2459\376\237vv\332\376]\364\2078\332\"\350\0037A\025\322u\225#1\362\236\300\336\252\237\333\362\317\240U<b/\255\215\236\b\355\272\357\346\213\216\005\276\2510\327\323\226i\252\273\024\\|\271\327\215\"0\354KBj\267r\363i\032\367D\222\361\033\344\312qW\304\032\235\016q\233\256\313>\272i\230\004[N\021\017\265\212\274i\365\233\373\177X\375\307\246;\020j\3124\215\032\"6\2529\356zQ\331{\273\267\346\340\246=\t("
+	.string	":\231W \b\222\3649G\317\374\"\376\030Cq\306\303bW\255v\252C\341{\213I"
+	.ascii	"A\206\007qQ\227\026\212 \350\353\313ge"
+	.string	",B\341@K\004\323l\026\301\260\037\226\004\306bv8\333\202j\274\020\373\263\r{\006\351w\2771\373\202\367\202l)\261r\372?PB(DN\215f2\314\267?\263\224\265\213\245\226\327\215\221D\307"
+	.string	"e\257O\377\327\306\021\221\013tnl\215\346\007\275'\316`\024\275\354n\241O\026\320\300\217\312=\245(\326\340\0328\345\021 \004\207\225\033$"
+	.string	"7\237\257\241\2218\201\0075\267\342\3221\207Z!\b\301\221LE\2477\035\2306eg6\302t.\243B;\013\313\226~\006\262\370\333\213G\322*~\352Z\233LTr\013\t\344\022\243\240\203\354Q\212\266\310$\263\270\204\320?\341\221\204\223J&\373\030Z+\004\221\0017\252A$\361\302\367\333\034\223I\345|\310\330\354\016\224(\022\302\330\364\246\036"
+	.ascii	"\212X\221\220\203\"\271I\347qy\016W@\372\233\026\214\274\220"
+	.ascii	")\253\253\252\366U\342\232\205m\351\027\305\226Rg\032\017\225"
+	.ascii	"\212M\342(\\\207\333x\003\247\200>1\022\333//\344*\360|n\200"
+	.ascii	"\240-\033\035\256\r\355\221\346\277\006\363\314\247s\225n\025"
+	.ascii	".A7\3229\375cn\320\036\260\325\365.\342\275B\016\241A\323|\225"
+	.ascii	"$\315\255Z2(\354 \276\032no\303\337\007\223[\312\270 \374\227"
+	.ascii	"\005\272c\224tAp\032\267\226\246F#<\300\306\310:\210UA\201\374"
+	.ascii	"-\267fU\354Nsk\005 kK\245\344\310\351,\337c\310v\262WDe\242\034"
+	.ascii	"\273\360#\223\257\376\366\340O\365W4[\261\314Tg\261\302$^\307"
+	.ascii	"4~T+\314\221\273\311\322'\204\200\251\306p\377~\005Xd\300Xvx"
+	.ascii	"Za\340V\346\360\343\240\024C\021\b\t\324O\337`|\r\233U"
+	.string	"\327d\033\312Zu\003\372\030b\267\236Y\221\033\027W\255\210\023\016\355\204G\340\333\004\317\305\320\340G2k'\035\256U:]\261(\363N\205\250\370\211T\373Q+h\314\274\307\226\341l\032\314\227\357\330\211\300K\334\332\314~\r\f\021\312}S\236/\233\274)\022\244\242o\376t&P\200\031G\212\300\313G\211\243.\312L\021\0204!\032\005\257\353\3541T\274\316\377k\304_Yzvy\264\246\223\355\277\007\257\340\364\252#\331{\004|\343\337:\245\332\331\317p\2737\314\031\200#\357l\204\"z\212\0301D\204\375\300\0323!=[\235\303CC\234\200d0'\250\365p\367\007\277\234{\222K3\276F\005\310q9\024.\025\0311<\265\323\221\333\234\331O\024;`OB!\343\273\270\177LdNU\225\215\211ZF$)\001\251\230\224Y)F\226S$\030\263\234\267\035ql\260\323\347\342\335Qk\314i\371"
+	.string	"UQp$q\025\3440\250,\021X\200b\301\205h\267\377\314\020\236\250\305\361\024@\3469(\341Y("
+	.ascii	"\210\243`"
+	.string	"\3612zR\365\222\370\254\307\331{\361\344%\303\017 \250\307\217\233I\330\323QA\275Mq\211\2053\357\020S\220\226G\226\220\202Sl\221\306\034\206\256\0227\376\024\262\364\243m=e\006*\224\267\352)\344S\3046j\241\242\373u\"4\325\375Sq\005q\373\254\331#\264\235\217D\233\307\032\213%C\352\023 K\313}\031\322\025E\023\201\033\220\204]+\003\b\2443\204\027f:\362\331\017N1\334\360\232\265j\262\016\214s\306\017\211#\316\273/0\341\252Z\253\370KC\346\253\210A\313\210\340.~KV\351\257\005\025\">\313\231\320\254\304[\355\005w\337\363\376\230\020g\240-R\265\017\224T\313Q\255#\022#\002 \323f\253nV\023+\254CE8\213B\030\b\312kx\b\347L\342\b\352;\223N\232\261\316@{\215\3205\223x\203u}\fP\207G7(\266=\035P\325\020_\234\314\001\371!G\276"
+	.string	"bR\036\020\177\212\221L<k\273\240\n\206f\354\275\337i\220\034`5\225\245Z\310\025{;\3328\241\352\230f\234\3366S\313K-\330\314\036V\356\217T-6\213\206x\334Q\267{\3252Y\373+\320c\276=\320\260\260\372\375\3739#\357\026\220D\372+\373\230\350\345p"
+	.string	"!\233\307J\005\0167\377\370X4\342\350K\252C\367(\374\007G2*\302C\033\341I\231\2239\017Y\321\345\037\376\017\375\365%&\333\213\345\347\233<\226\b\016C\322\206m\304w\344\004\243Z\255V\375\276\252\253'\240\264i\017\316\fcc\266-\220}@\261h\036\261\352\005\357\304\273="
+	.string	"Y\263\226\023\030z\213\214,`]E\2430\3067\013\220\302IF\370Y\022\275z6\005\023\302\b#\374k\035cC"
+	.string	"e\362\\\345\215\302\301\221;6\264\264U\262\213\324\033\276{.\023\300|\240$\032\213\264\244\004\322'\240\363\037-#\"\260\306g\346\335\2145\006\031\005\007'\271\220\321\205c\355O\r\207v _\340\020\225\226+\246\271 #@\007\255qb\323\357\235\"c"
+	.ascii	"\242/m\327\334\320\236)|4\333\272\227\214\356.\023\376\244\225"
+	.ascii	"\204\312:G\002vJc\313\223\355uK\241\347\362\264klm\231\006O\241"
+	.ascii	"\232\357\377N^M\230i;\254K\224?Mv\277\372k\224\034\002\350\320"
+	.ascii	"3enJ\b\255\203\350\264y\342\245\244\030\240\230K\346\021w\376"
+	.ascii	"\013\212O\205(5\222\340\0032\201\240pp\217rP\f\377\035Q\271&"
+	.ascii	"7\323\245\314\324\365F\035c\263Mt#u\314EJ\336\017\317\0377\251"
+	.ascii	"&kZ\033pl(\304\024\350\201\226/\037H\310\332\307\233\203}S\006"
+	.ascii	"\322\006\\e\201D\337\205\357\224f\250\206\263\3771$\237\221F"
+	.ascii	"\\l\217\306!(R\002\n\362\f\225\034\323z\036$\320\347\201*\022"
+	.ascii	"\250\351>\032X\223\217\200W\030\373\354\375\312\261*\276\345"
+	.ascii	"\311\313\002\026\303\252\316u?z,\345\205`\0341d\3611N\244\364"
+	.ascii	"$\034\270q+\004[\257~\200\022\275q\361\232\313y\267\266\006\376"
+	.ascii	"\345\005\263!)/\262\0205\363\\&\3664\311\214\304[\252u\224k\247"
+	.ascii	"\201J{RX\275\003\006f\013\332Nd\322-\013\262\003\0369\254\374"
+	.ascii	"\250|\033\245\007\210\365\2554\004\245\241\322\207Y\355\363\233"
+	.ascii	"\024\312o\316J\351\b\307\t\204\211!\370\004\241\356\310mss\264"
+	.ascii	"\366\023\360\013\005C<\305\307\327\263\257\360`7\377\376\331"
+	.ascii	"\016:\004T\346M\f\254\307k\240\035\036'\024o\023f\310\n\271\331"
+	.ascii	"\030\307\036y\356\255\200a\222O\265$\017\201\252.YJ\222\370S"
+	.ascii	"\357\236\013\276\224+5\005L\357Y\0355\\#G\264\215\016\372e\324"
+	.ascii	"(\233\375\b\203\267\274\254\230\343g\304\257_\213\305\317\205"
+	.ascii	"\312d9\002\302a\235\235\250n\343,\022v:,j\352uq%M\314t\020N\037"
+	.ascii	"\004,\320H\337\340\344\304\316\244\210\376\033\257\322j\206\201"
+	.ascii	"\017\265\321\322\366U~zT\271\220\344\350Y\004\004Ny\016\030$"
+	.ascii	"\225\025\247\303_0\367\333 \243\013\324\334]\004\270F\252\306"
+	.ascii	"\2439\303\232\221h\020\206QJY\335\377\343\033 f\227\254\320\245"
+	.ascii	"7\3627E\210p\331^\340T^\257\206-YR\213\352a\322\236\034l\276"
+	.ascii	"<\200Q\035\f+\032d\276Cc\346)t\356\0015\277P\300Do{m\241\252"
+	.ascii	"qd6\305\244\307q\3721d\037?!\305\255\021\263\221)hd\025\302\023"
+	.ascii	" \367\362\367\376\322>\366\252J\237\227\\\336\ny\307\207\230"
+	.ascii	".\301c\n\313\276`f\341\315\254q\320)\300O\367;]L`<;\270\031\200"
+	.ascii	"x4t\224\257\2319\013\235m\237aI\357Z"
+	.string	"v=R\236\325\203\351%\374\345\351\271\350\3269\234ah\\\236NuY\337\034\026\226/\215\0072=4O:\344h\260\247\350\200'<\373\315QCp/$\204\307\025\031\226\225\3743:\234*\321\237u\256<\312)\336<\f\331\351\243\027\357\326\345x\200C'\232ya\237\223k\316\224\372\322\242yX\334X\031\022\331H\034\177\312\364E\373\260\336?\210>\212\003 \304\367\317m\370?\003\233\037\030\027!\336\025c7\003\334A\353.\252\323Qr\210\017F\223\321^4\037\211\272\341\356\3733\335\260v=+hO/Y\311\023\367\346\372\210\3577\335\\5(\013E\277\3514\365\017j\331~t\207:k\206ob\374M\037N|\031\256\317\346\326\304::\311[^!X5\375#\b\266\262F\341\322\255<\362\375\034\234\365I\244%Tw"
+	.string	"\234-\314\364d\316\333 \242^#&Y\257\177\322v\253\275\266\350C.\376\314\327@\367\233\260\367\212\366Wf6\305\223\330\267\315\341\334\026\217\373r\241L\311\263\221\335z\031l\352\253\357\352\367\330\375A\255N\357(\373\316\232\016\302V\263a\021lU\374\031h\372M\230\377\310\037\353\232\357w\007\337\f\013\016\016\226w\361\327\315\300\036\022\372\220y1\265\315\230\365z\362/1\233ky\031\370\024\276re\376\247\0057\026\177\377<\275\016g\261\342F\325\372\254\350\0255n}w\335|\177\344\277\211I#Jn\0212\353W\020^\024\367\352`&\200S\236_\313\0346"
+	.string	"\275\"\350$}z\213\254\235\345\031\250u\0040\275%}]yC3C\315^\263\316\333\320z\363Q8'*fsV\373\340\\\327a\273\263O\332\320a\357\276gw\243\375\0025g\327\237\215\\\363\373:x\376\035\233\237\220`\262\351\336\352\315\240\254\243\372\265\346\r\300{\357\247Ll_O%\367\002mT\362p\"\355\255\272;\311\227\020\314,\0345\332\265\305\2237\035\3276\3543xW\214\033\331\224\270g\306#"
+	.ascii	"z\265\335I\265\274\356\315,\320\n\351\"\023\0249\317\357\330"
+	.ascii	"0\242#\342\242b\264\211\352\n"
+	.text
+	.section	.gnu.lto_.symtab.87ab8e2f9ab38e11,"e",@progbits
+	.string	"pgResetFn_gyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"isGyroSensorCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"gyroIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"gyroFiltering"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"gyroGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"gyroReadSensorTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"gyroGetTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"dynThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\003"
+	.string	""
+	.string	"dynLpfGyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"gyroConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"gyroConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\003"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\004"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\004"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\004"
+	.string	""
+	.string	"biquadCascadeApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\004"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\004"
+	.string	""
+	.string	"gyroFusionApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\004"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\004"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.87ab8e2f9ab38e11,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
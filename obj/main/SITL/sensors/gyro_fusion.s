@@ -0,0 +1,335 @@
+	.file	"gyro_fusion.c"
+	.section	.gnu.lto_.profile.fcc406db0a408d47,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fcc406db0a408d47,"e",@progbits
+	.string	"(\265/\375 \313\255\002"
+	.string	"4\003\277"
+	.string	"\003"
+	.string	"\360\320\332\270\f\026\002"
+	.string	"\002"
+	.string	"\002\001\002\002\003\001\337\336\237\211\r\002\002\004\002\005\002\224\333\224\343\001<\002\006\002\006\002\004\002\002\004\005\004\002\005"
+	.string	"\016"
+	.string	"K\021"
+	.ascii	"\034\200\005\240\273\231\034\240/\267\261s\301\252\025n\322@"
+	.ascii	"p\f \204\235X\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.fcc406db0a408d47,"e",@progbits
+	.string	"(\265/\375 Y\235\001"
+	.string	"\330M"
+	.string	"\003"
+	.string	"\002"
+	.string	"\003\001\001\001"
+	.string	"\001\002\006\020"
+	.string	"\007"
+	.string	"\001\204\004\202\f"
+	.string	""
+	.string	"\b"
+	.string	"\n"
+	.string	".e\256\032`\324\200\225\004\300\b4"
+	.string	"\253Y\326"
+	.string	"\216\300"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.fcc406db0a408d47,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"u\006"
+	.string	"\222\f',pK\222\016\310\023Q\341\n\006\214X;\372\207\300 \301M\340\317\365bQ$\264\342\177\367]\375t|\277\240"
+	.string	"E\021-jd\313\235\002\357@t\240u\f\244\240`P\b^B\016\213\214\b\273\340\277\320\266Or\033\025\020\023w\314\267w\240\373\005\322\237p\225v\362\370\205\213\332\006\360\355Y\233Z\251\251T\263j\232\0319A\322L\220\304\23483\002+m\227\311\314\b\333\326\346T8\250\235\254\177N\242\255\301\332\"E{\213n\240\341\331\333\034"
+	.string	"\036|8m\317i\264-\370\333\016\002\023"
+	.ascii	"\257N\214\030<\260\002\266\256\to\314\230\026=\224f\r\240\t "
+	.ascii	"\004\310\355j\223\235dHEtQ\231<\347\024\313\2658\347\374rG\001"
+	.ascii	"\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fcc406db0a408d47,"e",@progbits
+	.string	"(\265/\375 \277\035\003"
+	.string	"\"\006\021\030\260%\351"
+	.string	"\025K&\305\001\032J\017\206aX\310\231\2434\272\211$R\246\257|\340,\253b\244b&\301\300\377\361i\326\262\002\n\232\375\361\241\t\263W@\373\216\306\242\241u9e%\222^\267\022\322&\017\002\013"
+	.ascii	"3\307\b<\231\340\341\177\341\r+\366\244\220\307\035\321i\270"
+	.ascii	"fC\227\371\036\f\260"
+	.text
+	.section	.gnu.lto_.pureconst.fcc406db0a408d47,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\232\004\002\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fcc406db0a408d47,"e",@progbits
+	.string	"(\265/\375 \371}\004"
+	.string	"\242\007\032$\240)\303\001\347\244(0.:\356\023`\204L[\376\362\2357\240\003\353\t9 \267#i\2156oB\266\224)\037\022\f\3033\021\027\213$\343\210@\336?\214\332XNE\340\254\334\363B\354R\271\324EM\324\324X\035\312\346=&7\034{Q\371\240\254\220s\327\250\001\264\320X\315\271\240\035\352\344\201\366_(\372\232\375\230\016"
+	.ascii	"H\ts)\272:\013\021\034A\205\271Ta\005\023\035R\027\264\266\235"
+	.ascii	"\005\214\374\f\245\213\204\273\360\007P\004"
+	.text
+	.section	.gnu.lto_.lto.fcc406db0a408d47,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroFusionInit.5.fcc406db0a408d47,"e",@progbits
+	.string	"(\265/\375`S\001]\016"
+	.string	"f\233_C"
+	.string	"s\224\016\370=\264M\273\205\352\277.\0058\210~\036\230y\037\310,#HsOf\206[`\300\377\375\246\314\0243\234##9\204\024\240\252\312)\252\017\021H\300\274\237\330C\345\256Ca\033\331[\356\224\002K"
+	.string	"J"
+	.string	"J"
+	.string	"\216\034\033\300\034\033j\177 p\001\240\003\304\213!\377\2634\3214\354\\\370B\2160_\250N\371\215\340Q2\211\034!\201\377\002L.\360\004\306Dz0E\214\323+\277\033\254\222)\306o\023\341\177_\311$\302\305\334vk\013\2415\211\377\233\247vc\224\r\255r\315\t"
+	.string	"\243#\344\017\361*\362V\254\201\302*\267\356\352U\013\273\bYU\033\3604\022fz"
+	.string	"\371\357q\254\003\216c\002h\222\266~\255g\314\"dT\213\013\374\247\0314\376\256\244'\034\307v\356`\001%H\357\325\262\\\370\217\026\264\365`\031e\035\250\371\377\240\315\340\030\034\347\177\003\232\r+\003jN8\326-\230\243W~(\025+\206\214\336+\363\277(\013_}\27090\217a\266,\035\236K\355\244Z/)j;\321K\231\326~\334\207\003\n\304\232b\002\322>\334J\005\n\332\306b!\3436\215\003\251p\031\350\203r!K\331\270\314DA5\f*[\246A\323\266\214\244\273\375<\245<\001Gk\224\244\2302\035q\345&\323\365<v\302\224\330\351 *\327\207G\304\0202\260s\223#;X/\001\036"
+	.string	"o\231\"\023\257\362\241e\354\210\207\266"
+	.string	"nF3\306\004\250]oh\201\213}`\316\305\230~B\215\001+7e\035\227Y\265\204\323\205\201"
+	.ascii	"S\025\003\234X\325n\263\222\002\\\213\033\"\312^\252\032\254"
+	.ascii	"g\326?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_gyroFusionUpdateFault.6.fcc406db0a408d47,"e",@progbits
+	.string	"(\265/\375`l\006\335#"
+	.string	"V\277\330K\240\326Q:\004\350\305S\\6\002'\356\305\017/\273T\314\"4\004e\\\2133gO\274\306\t/\205b\017\337\262\246\005\237\356\024\030\250\365c-\310\361b^\230\373\304\305?\032\332+\200?\024\305F\304\177\373\337\032!\204l\271\223\f\310"
+	.string	"\263"
+	.string	"\307"
+	.string	"g\006\342?=\3113\250W\211b\312\001\341NA\366\"\335V\202\"\b\023\315Mn\220\336D\376\324XP+\363\231\256\003\350M bpW\304\023\211 \367\"\r\360\201\364&#\017\340\274\231\376\345\274\211 \001\020\007\035i4a\301K\230\004\273\027\271k\031\334\267\310\263\255A\307\335l5\332L\026K\321\323\264]\203\370\250\003\023)\251J\021Q\3508~\320\370\233\321\346l-\\\324\032\215\305\212:cq\231\n\335\321(E\215\351\322$FI6w4B\252(\214\023I?mNhsI\242jZ\334\275\327F\034a\017\f\211C\325\3328z\177\352\325j\253\210x\364\212:\270\367r-\"\2368\267\234\371\013\230\231\002\263i\025\335'\272Q\317W\347\273\366\211\216Cu\311.\375\276\362\326\306\226\2270K\260.\273\357\275B\335Ef\244P\375m%\346\231S\235uG\3769\256,\363\246?"
+	.ascii	"W\216\341\3120\261\312/\227:\273\264\340\322\312\267\264\262"
+	.ascii	"-\255\\\273\323\231\226V\236\245\225e\207:\307\322\312)WF\321"
+	.ascii	"\312'W6\317\312\266+\267Y\271\232\225O GKJ\022\260\336B^\023"
+	.ascii	"\313+7\313\254\252q\252_\352w\372\241n\231}\360\225<\373q @\247"
+	.ascii	"\352\261\327\370 \fK\224\t\351M\\\375\313y\036\374)\236\335\344"
+	.ascii	"\367x\024\320\245x\210\275Q\327\306\330\312\272\022\322\2339"
+	.ascii	"\033\307\342%_\200\230\004\373b\344\275\367\264-M\353![\213\353"
+	.ascii	"\330\257\036k\244\0223\314.r\314I\3174\252\244\2524w\311\"Tv"
+	.ascii	"L\230PY\177\365\226\036~\352\266\n\213P\3310\375\344\355\321"
+	.ascii	"\212PY\371A'\256\207\006\356\322\247\362\344DD\r\273\275\367"
+	.ascii	"^\3135w\351\231\216mm\021\2650\322\033`,r\343\372\324\013\340"
+	.ascii	"X\026Mii\264c\316F\273\261\b\205\f\325e\205[\365\024p\335{\031"
+	.ascii	"0\347\234\210Nz\357U0$\202\206\232\233|\020\347\315\263k\307"
+	.ascii	"R\025\256\315\206i\256\302\243[Y\036x\3326{E\227\220I\327\266"
+	.ascii	"\005`\021\205\005\353\222\371U>=\357a\244\301\3779o\352\032\355"
+	.ascii	"\032\246\bv\256\003>7\025\250\343\203c/\364xxt6\360\320\013\275"
+	.ascii	"\234\035\234\f<\264\007\347\327'\363lv|:@\017\030n|\277\237\234"
+	.ascii	"\035\360\347\003\356\364\200\273\035\035\034\016;\336\017\270"
+	.ascii	"\263\321\261\217\247\367\333u\360\371~\273\031\362\376\267\225"
+	.ascii	"\270\332h^o5\177\351!3\313t.\330C\374\3222\375\023\327E\3769"
+	.ascii	"\353\336{k\2457\371\255\353\361\351H\224[\3334\2516[\327#\024"
+	.ascii	"[\233/\224KM\301\272\254\325\372\311k\375!\t\t\355v\3369\353"
+	.ascii	"\020OX\\\2636\265\200,5\315\272\250u\346\2333A\265~\200}\311"
+	.ascii	"\272\310\264\216)\241$&\353%ESz\271\224\365\215\220\274\322."
+	.ascii	"\362yg\332!\262\322\264M-\036KMh\027\277\316;\231q\002\200\207"
+	.ascii	"\250\201@\304\230C$32RPP\322\214\001p\002\02123n\021\200\255"
+	.ascii	"d6\2430)\245\335W\253\3420\371^\322\276\300\035\203h?\"\240\t"
+	.ascii	"k/#\300\r\"Z]\226b\001\352\325\260@\364&\366-!\022\316\035,\346"
+	.ascii	"\225[P\275\376\034W+\374\236\200\366\376i\256\334\201\002\330"
+	.ascii	"\205\024H\3762$\213\211\032{\330I\237\b\217L\217Z\016\256N!v"
+	.ascii	"\304\267\317*\316\r\235\245?\r\"\314\250 \227\236iE\244\361\023"
+	.ascii	"p\331\215\177\333\372\202\177\332\251\024:\216M\262\315\330M"
+	.ascii	"\257\221\033+\304\217\337\327\0368\260\320\236\005\246\230|\266"
+	.ascii	"S.\362\366\215H\024\\\311\374\007\344\222\346\200}\261=\362\374"
+	.ascii	"\001\fBIQ\363\274a7|\352\255c\036\352\001\314\241\r\225{v\241"
+	.ascii	"]9\312wE)%E'k\001hE\200V\355\233Qk\020)\371mS\316*\001:B\250"
+	.ascii	"\365l\304\341Zl\212\326f\265\304\215f\0274d\030\216l4\004\315"
+	.ascii	"\226\210nS\377\265\035\005\377\001"
+	.text
+	.section	.gnu.lto_gyroFusionApply.8.fcc406db0a408d47,"e",@progbits
+	.string	"(\265/\375`\301\022\325S"
+	.string	"\032\214\244\036N \324RI\007\301\370\232\013\356\007\177\272%<L\320>\017JO\025\313\213\177\016/}\300\243\317k\220>K\247\370bG\254xU\rka.\025D6\r\217\\\214\231\230\242\307\304\023#g\306gp\034\207\226\374\034\322\306h\215\020\"e\222\001\342\001\217\001\341\001\337\357\371^\325\207\330\"Z\312\252v\363\354R\275}\020L\"\240\035\331\342\034o\237\267\024\016\\\025\264#br\206\317\263\rVG\206\316\336\316{\370\334\361\334\207\377\360\273\245vv\306\324\305\241\321\365`vG\356(wWB\\\225&\256\242j\334\302K\013\001X\307H\226w\255\273\331\317\311\272\234\205k\342BV\260\036c8\260\361q"
+	.string	"\034\356\341,\275\271\347\341o\206\207\253\002\324\372R\352\"cAO\255\325\306\315\265\002\274\331T\226\327\341oO\276\315R6e\322\252\326\020\313\312\005Y\303\256\272\314\261\361\twX\321E\017\033\031(P9\262\256\306J\223\026\262z\375\350\302\307\306W+\322\306\315]\262[\342\260k\334\304\034\3504\032\364Y\200\321l\3606\244\317h\260TT\271\332V"
+	.string	"\302\310\r\220\330q\336=\333\315d\235\206\016nTk\331\033\233Z\2218V"
+	.string	"\340\315E>x\336\004\036\351\274\271Y\273A\034yVO\267\226\305\215\257\326\352\324)l\277D~\2318\353'\230\226L(\005\223\220\216\214\212\210\206\204\202(\320\017\360w\232es\326\376\027\325\346.\316\216\350\002\323\372\211\262h\206R\2009[\314\204B\330\332\227L\210\271RY\343hG\313\361|\271P\006\357\220\001\361=1\034$\203\347\253\005NB:b\341F+\224M-\324\276T\340\242\263\023\235p\306CP\266\364\366\204\tC\273\220\227\007\035\307\230v)\233\324\276\2740\320\335\021 \223\263'L\030\231\377\264"
+	.ascii	"\376\242\302\204\231\360\037\236/.Y\370\334rs\b\fK\331Tk\245"
+	.ascii	"`E.\313\246:sY\216\347K\254dQv\002\237\337\235\215`\\\334\237"
+	.ascii	"s\223,\207=a\302"
+	.string	"\326\316\277\250Z\353r\027X\330\027\305w/\267\273pv\2156w7\355\214\305\311\262D\327Z\265z\217xGC\361\350\035z\370\216x\200~\352\335'Q\370]:\372s2\314\361\321\203\245\265v\257\004\216'\201\004T_u\261\353:\0371\306]\327\356\336\370\021S9\316j\255\004L\271\021B`\255UG\021Y\307\tp\234\325Z\217vs\337\301y\363\251\177`qmvj\266\\\341\276]\344\326_k\255\334f\273\177\255\265n\227\355R^)\2247\n\345\205By\237P^\b(\257\223\343}\233P^)\312\313\204\362.\241\274\017P^%\2247\311\365\276H.\347{\204\3626@y\215P\336\"\2247\201\343\360\023\241\274\007P\336!\257\363\025\362\270o\220\313}\243~\347\013\344t\337\037\257\373\372\270\335\267\307\321\374\006\034\371\027p5_\036O\363\357\370\016_\035?\363\017\3605_\250\263\371>\235\206_"
+	.ascii	"\312{\203\362\332\240\2745(/\r\312\013\300\345|gP^\031\2247\006"
+	.ascii	"\345\205Ay_P^\027\224\267\005\345m\242\274,(\357\n"
+	.string	"\312\253\242\344MAyQ\224\274'(/\023\345]\242\274&(\257\022\345\rR\336$\312\213Dy\217(\257\021\345-\242\274D\224w\210\362\nQ\336 \312K)/\020\345\375\241\274\300\222\367GyO\3465)o\311\274\r\304\313@\274\027&\2219\216\221\315\320v\310\352\325\247D\2353\335\2109\336\257\367\327\371\343~\271\377\316O\367\327\375v\277\234_\315\277\303\277\346g\363\241\335\273E\0308\337e\3248\262\304\231\343j\255-j\242\016\2226f\223\177c\204a\370\rE\3757y\206Z\250\211\332\354SL\333\032\352\237\233QL\250\237v\214c\024\273\022\324Q\264\177:\210\366\031v\274\241\230\006\324@\216?\372\247\201\372\367VTC\333d\2163\007\230\005)\031?-\004F\b>n\200\335\243\1774\353\025\351\370\350\036\r\354\273\361r\004\223\366\321*\362\310\362\316 \211\210\322=\272\211\027\273\342\361hP@\256"
+	.string	"\0044\322}\266\266\304\257\201\246\321\306\335\317\355\261\035k\207Y\032\275\234\202\005\233\f\236\355\232\363f\212<\\\210\364\257\031\2568f\353\307\207\221>\341\030\210\243\201N\221\304\177m\266l2\217\037\312M\276"
+	.string	"\240\215||\r"
+	.ascii	"\364\202\331\244\212]$\374E*xWk\215\241\002\227+"
+	.string	"\334W\236m\306\033\007\204\\\236\331e\273k\345\324\321\024\210P\246\255\314\234\032\340\224m\306\243u\030\315\355\201\331\243\303\343b$\366l/\233T\032\013c\322b&\204-\351$\315\204?\370\003\275$I+\351\007\2204\222VR\302&\203JxKX\222\"}6\022=-z\273\204G\b\203Q\244\037\004\326i@\2338\356\324\265\331\245i\257M*\211\360\263!\316\332X\224\006\301\370\256!\240\264\223\216\322\rW<n%\277@\372\372\214\340\252\365\312\213'\r\245\231\340\212jN\032\202~\322'\\\223n\322\020t\331\247\250\346\301&\203J8\213\224\220\2236_\200\303G\252\313n\322\374VL;\336nV\032c\331d\216;\274]\302\\R7\356\266\262\216S{4\342yS\252\237w\316\013\001\355h\306\rkeP\005\270\337\240\377f\024\343.\240\273_\034S~\353\234o\356\027\325\266\270og\364\373\001K%"
+	.string	"\"\025\254\251*'\253aU\325p\312\211'\250\337\223\360j\212\n\361|\202\022\022\251\206V\247\325\220\nk\212\352\002a\004?XTUT\013`M\021R \274\242D\252\f\246J\341\004VST\246\234OP\277'(\254\n\254LIpF $Z\221\300\204\202z\302`\352\252|\022V`A\325\024\361w\356\224"
+	.ascii	"\254\206TD+\022D\031^i0\201\023\361jH\264\022\022\235\254\250"
+	.ascii	"\246\252\234\246\\\021\235\002h\261C\013\204WNX\303\341\225\023"
+	.ascii	"E^\371k\227\2659P\215\227\271+\275u\242\315\366\007o\351H7\036"
+	.ascii	"\333\370\2146\356\214\276\021/\231\332lF\037\351\3179\215;>\264"
+	.ascii	"\331\245Yj\263u\022\203\222\212\237/u\300j\360\n\256h)2\032\356"
+	.ascii	"M\214v\3212\332t\203\3211:\205[Q\315E\277h\030\275\004WL\223"
+	.ascii	"\322R\372E"
+	.string	"\237E\264\331$\214;6.\372'\314\215O\213^\363\326\324,\272E\227uR\272IM\315&W\344\300\202\315h9;\232qc\242\315\202\264\212^.\022\201\244\223+\243\324f\033d\357\314e\313\234\030:\272\036\204\364\212\376\236\233[\316\222\305\240\026\262\2446[>\032\322Dt\214\016\350\0337\210\244@\372\rC\372\247\307G;\016h\026tF1#\" 1\f\331hc\007^{mvl\234\261\241h\t\315\035\026\242.\343>^B\264\331\031\nJ\240\273\314\314\022@e\r\024\n\364[\327\020L\255\324(\372\214+\036\267N,\265\211f\352\245\270\032K\315\024g\242\177u\301Vj3\330\327rB\322(Vc\20650J\254\2150\246\347\213PRGu\002}\276\025\351D5\220N\352\013q\"\\\216}O\037\2601\006\265\331\ni\244\276Z[\\\220Fj\356S\344\3033\302\027\022h\233m\n/\031\276"
+	.ascii	"\035\265\220f=\344i\324Gm\272\025\325P\360O\007\201p\250\201"
+	.ascii	"<\344\024CR3\"\222$\005Isq\005\304\030\347\034T\017\022"
+	.string	"\300$=\312\302L\031\"\021IRP\222B\273\001\261\266\0077\032\f\222::\020>\"\207\302`\032x\236/J\305\202\231\351\347"
+	.string	"\225@\210WyT\326\036\001\222\321\247Ti\032j\205\027\221\306\272\252\346\316\262C\206\257)\200`\326\276\016?\211[EV\b\024-\316\203\356\221\324a\346\022BP\025\340\305\017\321\327\307i\330\376\304V@Q(\266\226+\215\3465\234\231\344&\270\326\374t\275\210Ys\326\371\361\211\252\252\241\246\\\224D\250\244\217qS\224\3645a\016\304]f\266t\203?\312\023\204252\375\347\001\001R\377~\341\312|D\002-f&JX*\251\301\344B\025\030\352\345\215e\370\232\n\307\250\300V\200"
+	.string	"H\370\266[\307\315\310.Et{\342\372;t\377\017\266\003\311z@9\314\341\201\332\230F\t\342j\t\006<\306"
+	.string	"n\277\256k\2431I\230b\367\203z}nu\324\211\302zaf\313\247\t\247\211>\3324+XC\037\0036{\204\251G\001\337\204\013\343\2705\034\211\271#\021\323e\204?*Y\002\372Yg \314Ef\320G W\354\026\276\307\200\313\372\350\372\r\027)nU\215&\212m\276Y]\312\302N\003\222\263\211\313\263\373\337M\255E@C\272Ab\022Z\355\250\224\267\266\001\250\322'\323\336\321P\n}>\002\352\032S\017\005\271\351\254j\220\352\035\336\323\033\207B\031p\334\247\323dk\357\223{\326\037\3248\177\312d\275\210P\375\213lS\3029i\241D\367\005I\213\201qb\361`\t\3140\007\030f\220\221\220yQM\241\205\177c3\235\234\257\0041\3006\306*\375\b\fI\241D\221\244 \017pBm\302!\324hc\315\"\214S\213\230\271*\226J\001"
+	.string	"\336\262#a\213L7h$l\321o\254-\033\2012f\016\253\316\337\360\211\326v\035\342<\f\013\031H\005-\304MDT\213\340\211=\221\345\317\330\363w\371\262\323i"
+	.ascii	"\021j\264w2T\214\312\331\265\216\027 \240\2756\"\210\005\034"
+	.ascii	"\b\023\n\220\t\n\210\t\005\030\230!W~\311/\347\342\022\223D\b"
+	.ascii	"\327[\362\024@x\216\260\024\342U=\347\311e\335d\323\204E`\372"
+	.ascii	"\370\267\b\243\351qX\300Y^\034T\360[\261)\020G\361aQ\0203`\204"
+	.ascii	"\331\204\016E\300P\0074r\023@W\307\305i\002\306\322P\274N\340"
+	.ascii	"v\223\3612\3768\250\351\204\210\313\316MO\t^)jK\227\276yO\204"
+	.ascii	"\0012vr\347\361\257h\261\270\352\236\326\344n!\022\332\027.8"
+	.ascii	"a\2429\224\337\244\366\376"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fcc406db0a408d47,"e",@progbits
+	.string	"(\265/\375 \260E\003"
+	.string	"\022\305\022\036\2605\035\fd);\001br\302\253\254K.\343k\030\026\212\252\023\321]\023\334\326\244L)m\b\266@\nL\203\235\023\262o\367\234\217\301\303\377[\247\260\240a\005\013\313\003\022$\254\355z\346\253\026\333Ad\377?\202\313\332\226\n\n"
+	.ascii	"-E\244\206\201\206a\370,b\225i\024\004\303e\017\220\333\311\346"
+	.ascii	"\3651\237"
+	.text
+	.section	.gnu.lto_.refs.fcc406db0a408d47,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.fcc406db0a408d47,"e",@progbits
+	.string	"(\265/\375`\301\r\235J"
+	.ascii	":\204\340\034T@T\032\245\003\025)md\334\332\304\n\267tU\265\364"
+	.ascii	"\304\006\336>\013\356\312:\337\002lE:\265P\227\316\367\340\310"
+	.ascii	"\332\t\266Ea\327\022V=\033\355E]\337E[\304\356\3156\343\345\204"
+	.ascii	"1\342\236\211\363\025\034\013\002K\b\b\251W^\330pd\304v\2232"
+	.ascii	"\005\177\001\275\001\301\001\233f\277\026\315\246\313\\2\337"
+	.ascii	"\256-\363\232~\257\376\305\312\332-<\265n%\231\250\356\364\f"
+	.ascii	"\374{\345\313\\\257\335R\200\216n\345\220\024_`\262\244\316\272"
+	.ascii	"S   \025@@\250\223\222\224\223\255\276\005\224\225\373s&0\204"
+	.ascii	"\336\004T\314\277`\366\313\265\230\317\214\r9\343\372\021P\033"
+	.ascii	"s\177\316\257\227\177\265vk\273\254\262;\251\273\007\330\231"
+	.ascii	"\301\013\025\327\222%ABr\335*\334\227\013\305yL\246}E\333\002"
+	.ascii	"\243T\207\3535@e\354\317y.\212s\261l\226M]\254\226N\273\323\036"
+	.ascii	"\2062\002\313\212\353%@\277.NZ\263\271.\316\323@}\304\366\347"
+	.ascii	"dae\305N\023.D\220p\375\267\312\277P6\312.iE\037\312\276\352"
+	.ascii	"NO\354\227#Rb\340\272Rv\312\246+\226\352[\265V\257\021\3234\355"
+	.ascii	"\356\036\036:i\226\346p\365\331\237\223\027@\277T\036\300W\327"
+	.ascii	"8\243/t\357\212s\233\315]q>\335\237\023]\024\347\277\035p\360"
+	.ascii	"\237\316\177\"\320\374g.\317\006g\377\307V\203\177+X\b\266\200"
+	.ascii	"\237#\370o\346\277\327\327\377.!\\\305\277\017\374'\301\366\377"
+	.ascii	"\304\317\006\374\237\363?\314\312\270q\364g\030\3776\360/\356"
+	.ascii	"_\003\376M\361o\317\177\017\376\327\371\317\365_\315\177\253"
+	.ascii	"\377Z\376+\360\357\3767\342\177\007\377\331\374_\363\277\312"
+	.ascii	"\377\345\177\001\376w\375\257\315f\263\371/\006?O\360\233p\021"
+	.ascii	"\007`i{@\323\300\272\221$1C\245\264\210B\270\376g\321w\322=<"
+	.ascii	"\321i\037\213\313\246a\261\312\027\362D\332E\006\350\245S\027"
+	.ascii	"\323&dU6w\332\333IM\310\024\212\251\362XL\225C\237NR\016\273"
+	.ascii	"S\244O\361\2128\334\342\262\tY\\*\221':\251\207\275$\026A\223"
+	.ascii	"\224\310b\031%\322\247\270$\"\213IM\310\023G\222<A\351\241\244"
+	.ascii	"\nk\321\024\223Z\006#\023\361\350\303,\246\312\006\353\336+\245"
+	.ascii	">\036\320\315\244<\202\021\203\354\026\022S\006\244,D\345\256"
+	.ascii	"0\"\031Qv\022\263\310D\331\315\004\211\250\2154\206)\263\237"
+	.ascii	"\2269tbj\037J\335\004\030\273\207\333\314\356\036v\367\316\221"
+	.ascii	")\355\276\301\247\030e4v'U\030\233i\310E\251\233\257\302\266"
+	.ascii	"\220\305\245\021%\216\213\225eT\357H\207\033\325`MGt9\244j\037"
+	.ascii	"\335\275eh\024\222\0062&\362\260\204\r5\350\320\222^k\233\347"
+	.ascii	"^7\257UJ*\037[\230\231\226+\256\225\213G\030\021GN\031(\256u"
+	.ascii	"\020\240\302\204T\304\0338`Qn\376\r\013\302\215\330\234\025["
+	.ascii	"2\2613`sv\210\260\263\245\263E,\021\233\356\234-\373\232\255"
+	.ascii	"\020@@@@**\224W\232,Q\277f\350\311|\323\006\375\222\375\033g"
+	.ascii	"\345\354\232\205\322P\234p\235\201\373\216\235N\274\024!\202"
+	.ascii	"\211\326\364*\f\372t\263\320o-\212\223\005\263\215\0134\251\013"
+	.ascii	"\226(l\326\324zt)\021\303U\215\212\305\202%f\344\372m\202~\243"
+	.ascii	"0\227\313zYf\222\n\304\030\261/aV\f\017\211n\242\230\250\356"
+	.ascii	"\306-s\307\254\230e^\325)-\261\3566\263g\002/jPd\246\324\340"
+	.ascii	"\344\374D\353J\030\232.\327\332\037\266<\311\342\312Sg\2476k"
+	.ascii	"\272\252\270\362\017\347&!4\004\301\204I\2222f\310\266\320\323"
+	.ascii	"\262P.r>R\204\227\320\330\330zX\325K\016\030\321\005\346\254"
+	.ascii	"\213\311\027&\250b\240B\243\303y\3119jF\215\303A\235L\261!r\345"
+	.ascii	"\036\316\223\364\342\022\343z\336\201y\220:\262l\002\205\036"
+	.ascii	"\006Z\005\004\211\344\312P\207\303L\340\370\030\343\312J\376"
+	.ascii	"%\331\346,\207'\232\031#i\220\2702\022\316a\323wq\222\363p\355"
+	.ascii	"\300\352rB\017\303\276\353d#g'\256!G\232\230\232~\022;Yl\204"
+	.ascii	"D\005AO;&\223Ld\323<9\31749*\031r&r\345\303R\031W\306\201\177"
+	.ascii	"\230\300A\371\003\013Wfbbm\252\b/0\\Y\310V\001\240h\303\231\221"
+	.ascii	"+\337\300\304\263X\346\344\305\225m\330*6\251&Q\351[\320%`xL"
+	.ascii	"q=\255\221G2\220M6\355\215W\362\205\t\2622$\254\032\316@\036"
+	.ascii	"g\211cR\214\374\203\233 \0051\362\203\006\233Y\020$e\352\364"
+	.ascii	"\254\371\352 3lY\022\024\223\2161\364\214\304Ig\035\327\301K"
+	.ascii	"h\332K%\310\0012\345\254\223\307\027?\3678/\3753j\260\321\326"
+	.ascii	"]\300\016\235\2570a\\\331\310\354\203e8\0339\206\317\250q[RG"
+	.ascii	"\351N\331X\273\211\273-xv[\324\276\354@\264:\353\031\013e%\346"
+	.ascii	"Q\302L\0079e<\212<@\270\232\207\032\022A\262\266\262p=\357X2"
+	.ascii	"61[\316\274p\275\020[\345?\t\022N^t|\340z\226B\317\377"
+	.string	"\331\304cw\317PK\373\210d;\267\266\373\342\001'\212\021\364\375\212\212~:\002\206|\274\034\260\004\005)N\024#\330\353\345tD\302\\\321-(\344\235p;\362\345\200\301\302\221\217\327\203A#H(\310\006\0137a\320\367\323\325\206\204\300\024\202\265\023\305\310\341\343\001\205\301\333\016\307QO\347\343\335\200\301\243[\212^\357\310\347\373\371v\204B;\027x\301s\205\037\220H\370\363\355\f\345v\275*\334\005\213vEg\013=##\tz\204<_\006<\327\365~\277\t\204j\302\336Q\316\202\2350\207\303H\204\237\353x\300\235o\227\003=\215 \030A6X\330\271\215\0332n\3108o\343\006\016w#\b\207>\bG\023\346~\275\241\232PH\224\203\267[\341\f\n\331N_n\327\001\272\323\371r<`n\204\241!\036\016\233\360D-\3763\332\001o\302\337\017x3\201\243\367\303\300\210\327\323\365\004\205@\260 "
+	.string	"t\227\303\227#\322\235+\344>\b\036\375x*\354\200F&\216\320\340\256gT\224\003\001\005\335\2210h\023\n\005\341\204>\336\316q8\nX\210\340\301\005\250.\206\357\307\013\036\r\t\375\200-\344\270\005\201\277\240o\027\274\371x\271\242\233\016\030\274\305`\361\324\314M\017OZ\236`5\307\336dY\342\201\311\215\025W+V8k\217\307!\031\2151\3144Qg\235\374\201u\316\232\262\202su\255\032\325\021._\\\371\312\265z\266P\201A\341\220\246\274D\207;F\236\254\316\3138\\L\261zp\345*\346Q\307\236\226c\2702\325\277<\214\312\024\325\253\022\232F\351Ny\316)\035vp\341\312QX\312y\312\2470O\2415\233u\272\211=\273-v[\234R\324\\9\241,aRi>q\225:7\221\342',\266i'\225\2645D\314\224q\322E\246\201"
+	.ascii	"\250q0\205\0344DdjDD\222&\351`\002\221!\273\252\003\021P\255"
+	.ascii	"\203hj$I\222\3759\204Gp\371C\252aFV-\273\304!\2121\357B.\370"
+	.ascii	"~\354\255\316\356\217\376\213l\236Y\275\005\2001\005*\266,[\210"
+	.ascii	"\232\363\223B\221\023\030\276\027\022n\363}>\210\357\365\307"
+	.ascii	"\302\342\255\316\022;}\236\2137L\352\216\242qH\271\336\266\225"
+	.ascii	"\301\273{+t\276}\302\353\245Q\3313\235\005/\314\330\n;\303\245"
+	.ascii	"I\302mv"
+	.string	"1r\320\354\302\004X\323\215\262\260Qfl\327\273\202\234w\366\200\006$\274\204\360\355Q\364\302\222\2105\312G\337\332\177\311\022wMG\364?\252\305/\251\262v{\377rjKM\271"
+	.string	"\200q\240]e\275pBAr,E\315\302m,\\P\247\237\266\030\024J\352\321T\256\202\225\003C\343\345\263o\226y\236p\246*Bz\316X'\202\2200\347M\266e\001\232c_\237n\r\251\267\306J\232\313L,Dil?\264\n\024\202h"
+	.string	"\017\317\303({\033\274\256\261\375\202\003\211\313\377\344\214+nL\311\304(*\270dG DHIL\214\223<\212\314\214\020%\240\253\222 \345!\341f\314\013\"\317d\314\325\352\253ycc(\032\f\2454\371;\215\022\357\230\367-\213\345\024=\317\335{h@|h\002\255`\376\346\373\276v\333\022\227{9\363e\237\202\b/7\317*z\341\353D\002^\231\027\2013\354\034(t\254'p\f<\264)\220\243\334\232\367\024\206\354\221&\250\023\354\201\212r\t\205\3619"
+	.string	"$\266\245_Os\304\3003\316\265\020\025)h<\324\217\351\375\347\024\003w\276\2501\206\357\200:\273"
+	.string	"@P\246\031\333\242\361$\236\013\255!\n=\252\206"
+	.ascii	"S\360lpQ\206t\2757\303\265r\362\370:\306&\363c\277\306\273\231"
+	.ascii	"\020\337\365\263\370Y\366\023\304\005\266yX\260\007\276vx\276"
+	.ascii	"9\217\365\240Y/\353\375\016\037k\001X,\232J\0043U"
+	.text
+	.section	.gnu.lto_.symtab.fcc406db0a408d47,"e",@progbits
+	.string	"gyroFusionInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"gyroFusionApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fcc406db0a408d47,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
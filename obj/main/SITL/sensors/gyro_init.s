@@ -0,0 +1,1380 @@
+	.file	"gyro_init.c"
+	.section	.gnu.lto_.profile.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\017"
+	.text
+	.section	.gnu.lto_.icf.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`t\001\305\n"
+	.string	"\322\r57@s\322\030\t9\225\306\0054s\217\3642\353s\341\226\302\307sOX\321\204L\237\2478\244Q\324\232\243(\212\242(\212\177\177\274\0215i\233@\030\331\204\354\275\223\334\001\020NS\013\006\204\207\276U\223\202\304\246\004\201\232jP\007g0\241\223\203\301\016#&\002\215\\\n\276*<\223\f\002JBu\234\004Vv\366\215s\334\255g}Nm-.\\\022\242\024\327\201\025\3137\003\332(=\233.g\304\0068N\277<\026\267\262\341q.\270\237\260\241\206\256\253q\364q)\215n}\375.@b2XO>^4\260+i\341\021\362\241;\224\364DSb\2600\031\016\224\207j\312\215\317\345\001\227\272\233\t\271\307\367\227\222\364\361T\336\341W\221\221\210\0248"
+	.ascii	"W\b; p\202RT\306\003\023\002\274?\323\266\366b\021.\013&\345"
+	.ascii	"fl\024\b\342\027\360\210\255;\315\227\253\215<F\345\035\333\254"
+	.ascii	"\036\016-p\201?:\253\026F\002'\b\3300D\033\030[\315\n\217\303"
+	.ascii	"\r\022\002\233<\315\367=\317=P\356\316\202U\013\b\350\365\354"
+	.ascii	"\2552 2c\273\n6\247to\213*f\237\021\034\253\2010\300<\200C\300"
+	.ascii	"\353\032\256\313\b6\247\334F\320\265\327]`8\201\273\245pn"
+	.text
+	.section	.gnu.lto_.ipa_sra.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"5\004"
+	.ascii	"R\005\017\026\2207\351\377\377\377\377\177\005\376\327\327\255"
+	.ascii	"\335\335\032rj\220\310\235R\3266\324.L\302\034\bf`\235\312&#"
+	.ascii	"\037kh%\244\351\360\357\210\274\3304\350}j\367\2115\263f\271"
+	.ascii	"8   p\202\231S\036m\026\\\2300K\207E\326<!c\037\320\314\333\200"
+	.ascii	"\261\360\362\331|\331\013R\313\0030T\272-\265\340SA\203\005F"
+	.ascii	"\202\230\303d\022\344$9\b\n\326\013\303\227\210\r\374c\030\227"
+	.ascii	"\f|\231\024`\b"
+	.text
+	.section	.gnu.lto_.inline.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\031\005%\026"
+	.string	"\206\037dA \255&\215\001\2008\021\246H\261\306h(\223n\001\033\275\021PW\332\225\033\243zA\311\3214\200\363n\023\323\332\256\335\004b\004\370\240`\036\204](\246\234\031;\367uw\353\255\r\321m\267\2242\005Q"
+	.string	"S"
+	.string	"P"
+	.string	"?\247\375\030%_Y\346\321\343\332\246\034\361\241\203\206\226\026\\&\204"
+	.ascii	"\240\271~d\t\226\223\n\031\273\221\314v1\r\217\024\261;\"\272"
+	.ascii	"a\356Q\251R\305\234\274|D\251J\025\203bq\346yr\357\241\253\335"
+	.ascii	"}\211\177(\361\034S\271\273k\361\241\035'\017\3415\001\022\025"
+	.ascii	"70\304\003\206R$\0378\270\263\246\324\304.\n\202\255f\215O\277"
+	.ascii	"2EN\263H7\213\364\271}8\262\274\225n&\335\335\224w\273\235\024"
+	.ascii	"f7E3\351\026\341\302\356Z\326/J\374\300\006\2122\004\031\270"
+	.ascii	"P\212`\206d\327D\343\212+\313\330\311\274\307i\360\224\252\354"
+	.ascii	"\256\201\006\211\262\213%\270\203\312\314Y\355n\305\233T\255"
+	.ascii	"\304qLY\277\257\354\351o\362\f)NP\320\274\371lk:\311\345`y\277"
+	.ascii	"\022\256\366Wj\277_G\276lxi\311\037\356\376N\257\264?\017\022"
+	.ascii	"7i?\345\226\270\177e_\331\007\027\270\213\fY\263\f\030\321r\036"
+	.ascii	"\200\241n%\240\345H\377\013\t\273\030\350\213\337\224\251#\023"
+	.ascii	"\367 \271\202\241e%Y\362\025D]^"
+	.string	"T@ \207A\247\374\363\247\265\263#\021E\002B\261\213\021h\211\250@\037%\242\216\037Jb\027+\260g\334d\200\217\250AASfh\204$)e8P\"B4h\036\022`\3464\313Qe\320\224\246\244u\366\f@\220\016[\023\220p\225s&\013o\3510o\261\373\020\027!\342\2732\257M\330\300|K\004\020\247\255/\313y\270\243\202\030\030=B\020\320\315\360U\263\253fu3\370D\3144\203\031\3274\242\377\236\225\027\256*\001A\003~\251\316,\254\335\225\260\022\001\301\t\263\201\245\332\261\304\377\303p\356\351\376>>\313\037\335\273$\324R|\240\376\037UN\030U\375\200\206\253\355O\367Y\377\013\305\023\303@N-+e\310\313\201\205\302\225\230B\307\211\203\033\346i\356\231\026\177#\353&\021P\310\321!\324\337<\005\232\232\347o\210\020\350.|\262P\233\007\035qb\365\003\006\2268\22479>7\306"
+	.ascii	"\206\240\254\034\324\035\251\307Z\334\233\266\315)P\326O\200"
+	.ascii	"\n\317\035\303\2535\272K\274:\343Ku+\216\037/\013\340\341\300"
+	.ascii	"I!\226\375\376mx'9\245\033\"_\265~\032\024Bs\177H/\373%\002P"
+	.ascii	"`\317\\o\021\005$q\250\322\246\274P\246R>\250\340\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`k\003u\f"
+	.string	"6\32044P\245&\351033+;\023\3012,xS\363\262\252\253\032T\006\210\252\232A\036\226\370\256\202+\214\323\2117\347\376\267\201*z\205\262B\377\221\304\020\"e\n#"
+	.string	"\""
+	.string	"*"
+	.string	"\004'r\250'3V\227\264\326\032\217\234ErV\371G\325g\252\017\037\262^}\241\036\324\223\220\035Zu\004o0+\244\263^\"[0?\325\215\325*\224%#\275t\275\205\036\033I*\366\212\036r"
+	.string	"\027\324\233\004\027\213\213'\222\207f\2031&\251Ox\204~\"\216t\030\005S\037\2234U\026YY\245\205e\0058\033?\260,\215\027\226\035\004\317\306\250\027AL\036\336\341\033\216\242g\020@)y\236\305L\207\322\251\261\230\t\020\225\351\217\300\346\f\214I\275h$*"
+	.string	"\004Q\250\221\275B5\024&)J\2065`\")\246\364\022\240\361\230\022\242I 3\016\331\320$\212\314\3657\227\tb[8\201\224\374\363\2429\224\220U\356\b\032\203u\255\004\350\260\275\026\350w\334`}\246\347\313_\035\214H\267\340\354-\222\362\261A\001\226\t\t\036d\211;\002M\351\363\360\020\207c\333\372\342]\223\030\215%\035A\265\3044nx\217\r\243\352\251\357\372\222\022\n\006\034\305K\215\347w\022\030\355\003m\323\233\322x[$\200\016)\243\316f3\332"
+	.ascii	"Lw.\352\327u\203 If)Cu\344j\346\f\311)\224\347\013\201\377d\253"
+	.ascii	"q\222m}\375ej\252\037x\235"
+	.text
+	.section	.gnu.lto_.pureconst.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\204\004\002\204\004\004\230\004\006\230\004\007\230\004\b\232"
+	.ascii	"\004\013\230\004\f\232\004\r\230\004\016\230\004\017\232\004"
+	.ascii	"\020\200\004\021\231\004\026\204\004\027\230\004\031\204\004"
+	.ascii	"\032\204\004\033\205\004\034\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"E\007"
+	.string	"RJ )\2205I\007\177\371N\357\244\275\274\273\373\251\273\273\273\023\027\201\020B\b\265\206"
+	.ascii	"\375\177\376\277\261\355\377\366\t'\313\355K\231\002\377\377"
+	.ascii	"B#\006%\344\037\347\361\215\343\013\312\306w\214\272[\323<\271"
+	.ascii	"cZ\2230?\265\024\346}\306\026A\225Z\023@\223\333\255m\240\335"
+	.ascii	"\351\251\203\311\005:\241\032\024\023j\023\314\214-\322\234\007"
+	.ascii	"\224;\345E\274D\345\221R>\020J\236\262\214\362\247\374\225\246"
+	.ascii	"H}1\021\002. \220\002\221\243\353\001\204\331\315q\354bl\327"
+	.ascii	"QM\355:`\314K\347\216\005\361r\200c\350-\300\210azh\211\340\345"
+	.ascii	"\327\272)\273\033\273\376)\335\360i`=\026\217\222P\005+p\244"
+	.ascii	"l\257\245\343\2003d+`\303\367[\246\360\344\320m\n=\302p\207;"
+	.ascii	".\273u\204\217\202\033,\034G\020\377\261\2122\004"
+	.text
+	.section	.gnu.lto_.lto.2e1eaf2685c61950,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_calculateNyquistAdjustedNotchHz.39.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\214\001\375\017"
+	.string	"6\336kE"
+	.string	"\261&\035@\032(\240\350\2731\252v\246\261\250bL:\273\211\221\036\2275\b\236O\\\bj(\3317\346Mql#\210\031\275\026\253-ZY\023\001\214V\177\311G6"
+	.string	"\221q4\025\377P7B\310\336R\246\024U"
+	.string	"S"
+	.string	"Y"
+	.ascii	"?.v?\004\036\321\036m\373(\236B\305\251\374D\274t\200\260a\275"
+	.ascii	"n"
+	.string	"\354~\033\310\007`\217\371\020\354QC<\365\b5S\276\002\031\236\226\226\352\261\243\005s\350\321bI\375hm\200\"\273\373\327\323\245\265\312\314\026\354\256\263\245\345\341\306n;\202m\t\366w\002\252\324\032\373p\225\306\016\375\373\265\273\376\3549\256\033\302\264\302t\302\364;\262\0172\b\350\354v\b\312\261>\361\205\315s~[\305\177\331\3037\307Qy\016JS\275h,V&l\354~\007\036\335@{\024\201\017\301\276T\202,\313J\206$\363\256\224\343\356L+\272\212Z\023\322\t15X@\207\252\035N\217\246\252\032bb\260\200rwU\2525\3064\325\002\016\f\226\374q\246\251\020bxX@\327\00273\3470Ls\006\207\023+\237|\005\247\355.\211\257s\025(\376\210G{\247|\313\243\177\302\036\257\001vzp\270V2\310\376\002&\217tBA=@\211J\243\023\312\250s  \245\304\304\2043\235\030"
+	.string	"H)\301 2q\245\314\242\021\023\251D\242\300u\250\013\233\327q^i\344m%R\205\223M\324y\333\210\001s\031F\335f\342\270n\363\370\366p\225\306\th\250\237\302\376z\210D\211\0260\244\206\231)T\027\333P?X0>\001\036"
+	.ascii	"F\305\251\325\301\2051\215\004b\213\314\326)\241-<\263\230%\200"
+	.ascii	"j\246\366\264A\207\317\202!B\324\220*l\327D\225\025\331M|gP<"
+	.ascii	"\371\207Y\215\033d\350\374j\005\020\031 \003\3126\342gF\230\215"
+	.ascii	"W%\350\232\247\267\253\224\001"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch.40.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\324\002]\026"
+	.string	"\346,\227H\300\030Q:\322\301_\362\226l\361}\222\025\326\355\r\\\233,\302\002E\310"
+	.string	"\013MN;98%\231\355c\254&+\311\024\3535|PS\020'\022\215\020\226- \td\241\370\007\204\3239\244\312W\377\021!do\271S\n\201"
+	.string	"|"
+	.string	"~"
+	.string	"I7\342\251\245\264\317\343=d\327\2110\255\365\205\223#\265\356jl#\236\246.\003\236\312\003"
+	.ascii	"O-\263\253|G\243\2060\212\334xZj\255\252\235\341\375\334\335"
+	.ascii	"T\312\016\322\271R\346\2078E/\220\373\215\270\331\301\231\252"
+	.ascii	"\265\242p\266\251\240\326\372\336\bIs\250\370\\\220\2032\342"
+	.ascii	"T|'\002\037\022\226\367.M\340lS\346\304\215\361E\227C\270\232"
+	.ascii	"\224!N\255\325r\304\245\270\303\333\036m\353\330\322J-~\267."
+	.ascii	"4\371\263w3\271D\366\267\346\323\225\360\306\260c\316\273a\256"
+	.ascii	"\273S\327\375\250\357\376\323\217\356R(\375\002J\213T:\244\322"
+	.ascii	"\340\224\246SzN\351\225\322RJ_&\324I\031\220\245\326\023\277"
+	.ascii	"\244\032\205\"\301\361\243\237wi\337\276\020\277g\323\221\227"
+	.ascii	"\2103\024\342\020\243'\021\304\377\360\203\330t\352\033\035\210"
+	.ascii	"\354<!q\206\"\300\020\f'\276Z+\315\251!\210\2473\363&{\027/\373"
+	.ascii	"q\005\315\027\216\204A\254\265\336\370F~\204\307\267q\352\236"
+	.ascii	"\225\374x\352\257\300Sq\337\273\001\244*;t4\371\333\255\265\316"
+	.ascii	"\346I\202\033\256\r\304\222\037aR\033\356m>p\037\3443)\327\304"
+	.ascii	"\346{\255\265\356\022\371\037@\272\031\214\250\214\220[<w\227"
+	.ascii	"\256\274rcq\"?\355\334\311\305\027\001\246vWB\316\310MIM\376"
+	.ascii	"\\\222_\271v\220"
+	.string	"K~L\355\f\211\235\031\265r\177\332\257\2030\026\210\236\271\003\206\310\371\371q\305<<8\205\310\321\260\212\271Z\241W61V\213\305\343z\t\001\251`/\027\254\345\003S\265X=A\252\325\013\246\262!`\027\007\237\227*\346r\275T\246]\375\306(\272(\304G\024\332\326\300%\262\251\306\214YZci^\332\241\232\227V\312\370\244N\360\322\306\354u\344\240\330\\\b\220\277\016\b\263\342\206\373\262\366\316\004\371\321\263\262\330\231}&\035PSF\333\033\276\204\002\003\032\265\326\006\025\256\304\302\201)\247I\002. \200\202!\263\222\007!9\265\037\024-~\216\241\243qV\272\353V\021\366\335es\257\260\246\375\002\220\3738\312\252\332na/\2662\345\005\306K\336\\\260p\2410\314\217\341\367 \036\\\023\330#\332(@\003\360\007\204l\210\257\006\271\023\366\307\211\302{'\241\261*\3416\302q\013\230r\356\005\207"
+	.ascii	"\227\265\261\201u\266\224Y]\007\n"
+	.text
+	.section	.gnu.lto_gyroInitFilterStaticLowpass.41.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\220\004\245\035"
+	.string	"\326\266\274F\220\332M:\213\330h\033\222\242\261\032\343\036\005\007\017\377\0364@\364\261g#\260\316b\341\222@i\311\267\315\3055\313b\332\355\025$\201@\320\332{\002\001kS3z\376b\346n\"\277O\f\307\266I#\204\310\235R\246"
+	.string	"\235"
+	.string	"\251"
+	.ascii	"v\360J\230\216\325\302\342\256\024Z\224\335 \220\035\220\027"
+	.ascii	"u\346\247}$O\302\364+\207\331\266\313c,\312\356\0029\210\274"
+	.ascii	"\350s\236\361bx\001\343E3\331g\036\254\332Z\2171N[mv\027\247"
+	.ascii	"?\254\017\20379\231n#k\243\030\336t2\3715!\004Ub?\340\356\266"
+	.ascii	"P\247\301|\0026M\362\307\207\214\033\257\035P3\326\204B\260\035"
+	.ascii	"Z~@\033\027}/F\036\2530 7\240\223\206\347\335\370\355\207\bT"
+	.ascii	"\216\251_\377\341\002\205#\364\331\335w}>\001{s\326\204v\327"
+	.ascii	"\363\007\224q\343\334v\026\333\036\354\360B9:\277\370\214\364"
+	.ascii	"L\342Or\344\356>\360\233\334\211\t?\310E\243\320\315\377t\343"
+	.ascii	"\305k\216\0246gW\274Y\332\301\335T*\373Z\226\345\030\353\224"
+	.ascii	"\335\363\253?\300\261\376\235k\335:\347\272s\356u\337"
+	.string	"j\323\266q\232\024\247k\265\351q\234\026\307\351P\234\326qz\212\323'p\233\261\305\200\330n\214\022m\311D0!\367\372\265~\256\253}\373K\374/\343x9\354+\253\214\003y\361\337z\227q\270T\220;(\222I\257\214\331nPHk\211\334A\365\374z\2301\333\335\005\027-\201\274\030\020\304\354n\004\020\277\022\002\250\352\242\225Q\377\253\2213u4T{\210h\376'\252\317\013\335yGC\325\260C\214\312ki\310v\363\215w\227'*\225\230\201\320\206\254T\230\031\370\f\271\273\363\374m\357l\310\356*\370\024?\212\254Z\250\r\256\202\213\001\364_?\214.4dM3mww\241R\371wY\226nn:\345\034Uu\2215\266\243\252\272\345\224\306\233\345_\226\345\032}\213qG\013\3048\222E\246i\272\261\241\334\247\243Lj\327\023\312\322J\323./\301T\035\235N|DzS\217$*\214\317\354j"
+	.ascii	"K\352\2711I\271\025\"B\245\244\\\212\243%\fKCED)\216\210\220"
+	.ascii	"*\fP\2420\262\2600\302\350\204Hd\264\244\024z(H)W\224\013\241"
+	.ascii	"CZ\"\201KB\322%\025\021%\341\212r\"P\340\206\220\222pA\007\254"
+	.ascii	"3\"B\302)\351tH8\234\340^\247\272N~\321 \343i\257\314\246T\306"
+	.ascii	"\261\252\365\250hu[\360\233"
+	.string	">\001\375\246\323\307\303\335]\222\301o\332\243/\022U\372\242z`\377|3\235j\005fMI\265\251\235a\203\017\314\027/]l;J\352}f\274-9\222\254\246\"0\355\354\252\312\001t\235\215<S\324Q\355\016\036\346\177\366\307\216\006\210\371\331.q,\037\002S\250A(\305\b\222\306 23#B\032k\016p\002\031\2522\017\021\200-V$3\255\2355\n\003\367U\032\372j\247\177\013\3264}]\353\250\235\224\310M\b\r\306D%\031?/\263Np\3567\224 \310\315\3225 \266\377V\364\245\360\243\211\307v=\317Dl}n+]\334\307ql\351\242l\274]/v\214:$R\024\031\361\2759\004\227,t\024\tQ\355\365\316\003\025\004RQ\024C\022\243\031\302\3672\016\026\213g\334$\331\241\236\263\223\203\316`RS\365\031\203\331v\n\202\021\303E\232S\035\205:\001=%\004LL\2017M3"
+	.ascii	"\345\325\223\335\351\371T\036\352\2023m\323\367\233@\005"
+	.text
+	.section	.gnu.lto_gyroInitLowpassFilterLpf.42.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`1\b\035."
+	.string	"\372Q\020\022F`\\N:\373\306\0047\225\345\241\311\347L\304\314\364\336qt\316v\327\305\361\377\361 )\264\322`\270b\254\332\367\236i\232\263\330\363^\370Tu&\360f\371\237i\n\316]zO)\367\266\266\265m\204\020B\366N2\f\001\367"
+	.ascii	"\024\001\355\003\254]\216-\225V\333f\205&/\347\247\n\266\250"
+	.ascii	"\240e1gY\331\225\215X\213\nZ>s\223\024ctN\276\234\363\203\253"
+	.ascii	"\375\241M\267\344H\213yyD\f\003\226\247M=\213\324-\346\245\222"
+	.ascii	"\371\226\363\223\250-\264W\213\367\001\326'\234\t\355\325\276"
+	.ascii	"\267\373\316W\231\272\225\206\366/\34701o9g\242.j\257\006}\300"
+	.ascii	"z5}\200\365\252\004\nS\235\374s\211\017\326\312\fK\013_\316O"
+	.ascii	"#\254\004\330\370\351\363=\304\311\023{\206\302 \360\327\262"
+	.ascii	"\253\232\342\233\354\003\267\250N|\225\221\367\320y\335a\221"
+	.ascii	"\013\331#\272\337"
+	.string	"\2635\347Y\030W\221\007\323\242\032\255\2574\202\202'ZB.PA\022\256!\377\311=E#\313s\366\205q\ryK\344aZA\224\230\305\272k\317\2262\r\3129\007\267\256\256\372\270/\340\252S\326\261m\375xz\215\034/\255\326\001bP&\300-%\276\354Q\316\271/s\213\353]|\367Ct\267\217n\226DP1\325\314\037\367\013Fu\361\\\f*\006MqS\314\373\210\352\342\351\037\253\365\3602\303\270y\246\211zN\333\227\231\255\332\3122X\231\206\320s.\2321\035'H\316T\377\3529\227\231\035\\%\200\037\367\025so}y\313\233\247\373Iuq\263\3738\032\215\3565F\322=$\364\347\237\340ko\240g\371\177\316\3666\360.o\237o\371\013\334\312O\240o\003\370\034\364M\374\333{x\270\267px;\310\336\006\006o\377\202\267[\341m\226\275\275\006o\253\301\333)\3606\376\335\276\277\333o"
+	.ascii	"\204\344\313\253y\206\353\236\331G\364NN\243\302\221}\356\207"
+	.ascii	"\376k?\333\337\345\177\373\341\316v\237N\350l\315i\3660}\271"
+	.ascii	"\016B\033\272\005\203,\357Y\355\325\333=\325\347\362\266{9\230"
+	.ascii	"\307u\020\316\370|\245\365\313j"
+	.string	"\203\206\343\313\335\246\376\366\224\346 \317\314\205dB\347\254\361\f\353U\026_/*\036\342\025\377*\n\2037\2315\305*>\021\247\370rW\321\310\242X\270\311\0177?\204\270\260\244\347]dx\314\256*\274\313x\362\345\0350\323c\323\322iOd3:\247Y^C\270S\366\177%\300\302\266\2754\313\233\247Y\334l\037\2141\21743?\030c\266\n\217\262N-O\325\215~\305\315V\355\244}9\"\334\360\251vn\037\016\211\003v&Z\240`\341\330\fq\026{\227\366\337\250h\021\343\007\347\306\214\275\273\375:#\203%\315\242E\f\022?\356|9s\316\025\256\nqV\267\324\372\203}\200\300I\273[^;\335.^ \260\313\271\352\314\376\232\0311\256]\223\276q\275\212c,\312\354*^\003\370\342n\244\244{&\020\016\262\302T\375\203/v\032C\323n\277\"\202\007\226sg\210F\307,s\256Zpl"
+	.string	"_/WO\224\307\357\032S\273\312\253\272\321.\200\021`\001{\216\325g\b\013^Z\335\0264\345\215\366\311\274\217.T,\307%\035Hi\223\007)&''\r\002\240\224\220LK\036\216G$\247\034F\246!\362\270\024\365$UB*\251I)\352I\t\312\203"
+	.string	"$\207\265i\t\211F\252tc\t\351d42\265;@\314pbR\225\234\244\220)\322\310tL;\251\b\271\324\264$\303\b%E\303\350\be<6)\035\215\232\226\220n\030%A\035\215\212\022\264\321I\t\312\bi4B\031\005\237\371i\306H\032\250\304\013\313\255\347O\256\217\373\2076b\324\334p?\271\002"
+	.string	"\200/Vv\037\245D\334\274\005\2755k=B!\254\336\005\037\274X\034\026\261\020\276\363\314\315\301-\200/\016\222%\235\\E\225\222P\236')\345\202\215\016\024\202?<\304\300\327y\213\177E\334\342\323]\225;\233\023\342f\222J\362\314L\357\217{\313F\257\254/\210\233\035\274\373\ra\365\256}p\"\316\":\021\337)\327[\243\246\005\204p\"\036\302w\222\355]}\t] \314\342\356d\225\344\225{f\367\373h\b\320p\276\r\024\354\366\240:\024=\005\200\222\250Q(\243\230b\312 \222\031\221\3214i\fp\002\0312*\333\021P)U\254FAZ\222d8\207I\212\2618^%\220\246\245%S\331\3751\322\265@ \303\273!GZw\216x3N\200l"
+	.string	"\311>\005"
+	.string	"\362\"\177\334\001'\260\025\364\033\030\2156\262O\002\220\371\2372\216A\002\355p\032\262\005wf\007\322\264\367\360\377R%\272\201\036\326"
+	.string	"\341\202~\217 \352\247\252\200U\202;\312\304\303<\240\361\237\3163]\200\026\200\312\262\rU\377\323\316\013\303\227\342\245\305\215(J\006C\017\220K\327\301\326`\331\340\206I\275\2708\305!\226\211yJ6\231/\344p$\271\263\017\274r#-Z+\273\017\324\031gc\234\325B\220\3262\205J\033\243\353\034f\302\352\355\252\031W\025{\020\303w"
+	.string	"=\355\246rQ1\344\320\020:\247o\030\237\367@\336e\250\356V\020\21600\303\246q\305\n\017\211I0>\257@\376Eys)G\004\313up\225\322\3205\"\n\360\b\2638\271\326\020\020[a\201\3243f\336\2472T\305\254\225\230\021[e\240\037U\277\262"
+	.ascii	"\326\007#\355\350vx\370\003"
+	.text
+	.section	.gnu.lto_gyroFilterChainSelect.43.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"\375\f"
+	.string	"\326\330ZD\360\262&\035\270\215\233\371\361\3023\331\374^\177Y\231\360\233j\301(Ly\003\366\306\b\024OO9~\263\b>\374D\030\303|:F\005\016\324aq\370\253\304W\242<[\032>\324\0206j\202l\357-eJ\001I"
+	.string	"D"
+	.string	"L"
+	.string	"\\\225\340\006\342\341;\201x\250%\256\035>M\315\027\260\221\016C\374=\007/l\314\2006\225w`f\004\214\317\266\222\372\020\260\354\230"
+	.string	"m)O\201\016\t\347\250g\313\266\222\t`dw\235\246\355\345\216\267M\3016\004\373\030\002'y\323\241\177\022\017\257G}A\f\031(T\224\262\2639R\352\311\276v]\327Yal\247U\323\231\351\303\001/4&\344\354\272t?v\006\3049a\033\305\376\3704O\201b\355q1\033\350F\206\305Fg7\247\024\341\302\203\346Y1\025dG\3507\026\203\224\375\340.HBbvW\302\241-\272M\206\002\251\303\026\251\036\0205\236\252\301\221\243zr\211\207\006\251\335\322M\327\013,n\250\244\017\333\327Wl\b\260\273\021\374\232s\231/sh\016\001\016\211\230\210F\242\n\027\326\201\244\312\260+\033YY5\022Y(\251BXV\211\204\370\322`a\225\311ua\325\207\333+\214S\363Z\004\311\321\343\303\373\265x\324=$t\354\244\257E\325\026\333\252\036)i\312\333\335\205\032\022"
+	.ascii	"U\b\230Y\247\330q2\215\366J\023[\266P\334\240\242\215kR0\004"
+	.ascii	"\213A!_\026P\036\f#\342]S\022&\262\361+Ah\257\270\232\212\002"
+	.text
+	.section	.gnu.lto_dynLpfFilterInit.44.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\332\002u\022"
+	.string	"\006_qI\320\322(\035W!U4\315\312\233\311\204\207\003\274\0351\263\244n\307\036\0052r"
+	.string	"\243 \001=d\004\030\315\356\355\177\203q\257\303S\024\364\351\355)\253p\003\245<\205\241\210\346\360#\342vJ\331\203XCl\204\020\"wJ\001]"
+	.string	"V"
+	.string	"]"
+	.string	"\037\216\b\333\0371\313\036z\016\304\206\266\0301\233\335\356\212j;\353\244\020\374<\235,\037\001\256\224\315Z'\035\b\205\300\320g\304\027\2424\260\361\360\360\360\302\341\336\005"
+	.ascii	"3\0308 FG\006\203*\311,\346\031\330\335\237\370\3140{\315\031"
+	.ascii	"\242\354\256\247l\366r\213\334\366\006\333\nl\r\020G\266[^3\246"
+	.ascii	"\230\032\346\004\005yY\226Gj\022\274J\250\321\001\233BlS8\n\222"
+	.ascii	"\264\013;\361i\216\253\340\207\370g\013\253y\331?\177\005\376"
+	.ascii	"\273~9A38\327,\355\334kj\315\276\226eid\205\261?\255sz~\372\245"
+	.ascii	"\222\037 \006D\273\032\312!\253\013/\335\320\2003\007g\310\204"
+	.ascii	"\213\227nJ|Z\373\t\264M\2779\t\020\332\335\023_\306g\254\240"
+	.ascii	"XX\300\177\241\217\035\273\"\327,\375\025/\271\351Z\323\310:"
+	.ascii	"1:2\236\326\374\027>\214\367\334\226\306\302oq\002\340\277\235"
+	.ascii	"\333\256}\033\333C\244\335\326;x\3126\366s[\332&X@\203\3156\231"
+	.ascii	"\270\240R\250\224Q\265Z\021I\325H\246N\244\230B\251\264\210&"
+	.ascii	"\025)\232\024\3608\341\244\022]\306Q%\216\344\\\367Va\354\300"
+	.ascii	"\206\316\245/\253\332\020\216\343\306\314\341\b\007\"u\252\""
+	.ascii	"\037\200\314\340\324N\371\217J\311\347\001\216H\326\3035Kow\227"
+	.ascii	"\244\265\235\367\234HxH\374\330\025\205\256A\203h\247\"? \300"
+	.ascii	"\002\031\261\233\007#B_\314\030\240\005\305\270\025\022[;\225"
+	.ascii	"\306\366Wn\264\202+Xw\031)H<\332\340\\\b\377\216.\275{\231Y\030"
+	.ascii	"W\204\r\252d\204\230\017\203\023\330b\361\303\240\235\313\ba"
+	.ascii	"\f1V\301l\r\322\347\347\322/\033\315\017\21684]\023(\255\322"
+	.ascii	"z}\302f\305U\220\005-\b\273m\277\205`\032p:\230h&\271$\262G\016"
+	.ascii	"\007\206\201'&\326\203\\\003\207\317\362n\315\313\255\261\t\253"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_gyroInitFilters.45.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\204\005\245\036"
+	.string	"\246\367\276H\240VN:\225\313i\243 \025\360 \304i\221<\327g\271m\203\274\371T\210\222;.\270\322\272\030\024?\206\335\371)*n\310\222\027q\245\201\225c\034zk\207q\344l\037\031s'P\237C-\234\2726B\310\336R\312\024\241"
+	.string	"\226"
+	.string	"\263"
+	.string	"\027\231\0376\2372\1776\277\231\317\313\337\003;YV\036\214\325\252b\315L%\243`<\026\270\377\016\371\006\177[\"\373#\027x\261\221\267b\364\3622\323\245\326j\264\364G\343R\242\355\t\227\316\335\t\227\356\355\344\277e\2038\352z\221\261:2\246\326\232\353\033\357\235\301\375drG1\244\263\231\374\212J\003\232\224\225=\336\216\002DQ\251\006\213\254\r'\221\325$\342B\301t\342\324Zmz'\246\002N\321\243\342\331\343j{\203{"
+	.string	"XV\366\256\226E\245Z\353\271\354\261\330\333\366\177\215\377H?\325\nULfg\255\265\316\336\372\217`\207\272\250\027\006\260\f\205\f*^;\016o\377MN\274\345\211\252\232\367/\022\023\270-\377O\330#OGf\265V\007K\377\017\333\005U"
+	.ascii	"G\2555\251\310\032\001\361\325\261\364!t\274\345\322\257.\\\272"
+	.ascii	"\275\301\235>\200\\J\254)^\353\256\265\362\272\267\376 \025o"
+	.ascii	"m\255\277h\201\373!\312\027\022\371A!\037\250\371?\224\357\323"
+	.ascii	"\374\036\346\363L\376N\363u(?\247\3718\314\277i\276\r\345\327"
+	.ascii	"4\0377\3717\346\3234\337\306\374\2619\006\314j\235\"\203,\026"
+	.ascii	"R\210\215\331\225\305R\262Vb\211\004\370\326\270\266i#.\222\210"
+	.ascii	"U\363^"
+	.string	"\3236\215\224D\f\t\\\262\245\261\232\246_\232\370h\032\327\013a\253D\030k\255ITn\335W^\276\007k\255\3412\2054\355\341\277\204\235\"\205\246i\030\022\237\330\266\261m\024V,l\f[\254\260`O\302^p\325\225\026\304\335\264\177\013\027N4\357\263)\206u\3625\333@\226\037ww\002+\265gX&Lc\255UI_%\273D\303\006\016\274%\207p)\367r\355\374q\325\345\373M\361\032\355\255\333\316\272\250\373\214\215v\250S$\330\241\3360F\316\002;(\022M\363NG#\240\242\240:\350\244J|\310\355\244t\273\250\247].\n\252)D\316Ij\227;\np\235\210'\251\334\b\235N*w\013N\355\013\262\251\246\272Po\325\310\026\2703%Z\0135\203\261Rk\340\202|\301[\0065\200\026.\220\370'c\2203\030\254\f\031U\363\016Dc\323v8\2631S\254D#\300;\335\323?\215"
+	.ascii	"\250}\372\307\306\202Y\372\342\323\024\b\2244\236\356\351\315"
+	.ascii	"Z2\266\265hL^x\232\002\211\342\373\335X.\021\306-;m\353\022K"
+	.ascii	"\033\215\030\247u\372's\220;rZ\247\367K\313\322YN3\310\362\273"
+	.ascii	"i\234\336/\036k\306Tv\323\r\264\302|?\262\007\371#h\25010\344"
+	.ascii	"\224\242\n\225\310(IR\2204\006\240\002\031\"2n\020@gd\210\024"
+	.ascii	"\344\001\002\342\342Z2\370+V\304\326'v\367\265\004\263\210\200"
+	.ascii	"T\234\220\331\305\321\2016\321tX\021\260hyE2\0062{\2707\321\224"
+	.ascii	"M\207\311\356\312\214$\247x\022\f\211D\005b\265\t\212\361Bk9"
+	.ascii	"N\340\314\204\374\345 \215\025\355\312=\237\226\260\240\256F"
+	.ascii	"\02010`\261{\214\211x`\270\315\333z,\214\205\243\301H\205hY#"
+	.ascii	"_\3462`\203\347Q\214\241\224\031\204Y\363\007\365\306z\272M\207"
+	.ascii	"\205u\013\3224\027\255\323:\023\3631x\252\205Hm\213\002zW\354"
+	.ascii	"\225\244\357\0020\227g\031\234\376Q\353\315\371\265`\365\022"
+	.ascii	"v\203e;cX\301\020\344JM\262\257\221\016]T"
+	.text
+	.section	.gnu.lto_gyroInitSensor.47.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`c\005M\034"
+	.string	"Vo\247H\260XQ:sO\375\330qa\"YLf6p\256\007\025SC\250\036^!,m?\024\360\240\f:V\250\377\255\315\276\203\371\351g-\302s\202\357\r\341\243\036\207\236\247\366\220?\020x\275\324\261nfK>\331D\356\224\002\212"
+	.string	"\213"
+	.string	"\236"
+	.string	"\323\341No8=w\372\005\316\363\375\304d`\252\025F\360L\205\242Lt\330\376\313\366\364\265 "
+	.ascii	"\240\352\204\314\200\360i?\351J\344{.~S\253\020\222%\265\372"
+	.ascii	"\03486\236\332w\230x:>\200xj\322\006s_Q\275\221\037\317\322\257"
+	.ascii	"\326*[\242\223\027i\270\223\364\347\224\250\262\347v\021\013"
+	.ascii	"\245TrW\302\007\271\002\031N\271\250#=>_]N\204\0315\341p\365"
+	.ascii	"\354v\262$\324Z=\313\236\0307\353\266g\266#\330\324(\341\332"
+	.ascii	"\031\276d\003S\370TN\355\206{\236+\034\207+I\022\242\303\330"
+	.ascii	"B<\335}\365\260\002\316\265=\374\310\212\002E\366\207\033\001"
+	.ascii	"1\326Z\037\024!!\302fK\016\027\342ihUN\341n@\374\316=\217\223"
+	.ascii	"\234G|\251\304X\253\356\201/\344Cp\374\034\247\316\321\231/u"
+	.ascii	"\304\323\357\t\242-?J=\334\f\332\276\334\334!\373\033\f\006\201"
+	.ascii	"^!\373\276\377\346\275\337\3465M\343\232~\265\246]\343tk\247"
+	.ascii	"\307\235f\261\246Eq\232\322\032\252\024\251$\244\nT\031\274\200"
+	.ascii	"v\363\312\306\245\310\240\005a\006\320lkG\204\327\213\275\326"
+	.ascii	"/ \335\336\206\376\205$\362\362Z\2724\243\347\272\361.$\016."
+	.ascii	"\264\251\234b0[:\310\035\363\245k\023\350\264\320bEY\222\264"
+	.ascii	"\366HP\230J\237\221\307\257\220GV\252|\034\252\312\2705C\202"
+	.ascii	"\274\036km\222\367'\362\307\024\245G!\201\260\366Eu\005\354!"
+	.ascii	"\230t\305\265'P\230/\235`\2677\373OR\350*\334\311\302iL\334\227"
+	.ascii	">Nl\263\264/\274\t\206;\025"
+	.string	"1\271\022\272.\246\250\322':;&f4\034\221\203\31381\025;\263\235\021\264\032\013\035\231\255F\263\315rl\262\331N\211\0232\234\232M\026C`\032\212\234\232L\005\215V\223\275|\270\207u\205Ly>\240\024nsa\255\265\212;\264\373\013\236*b\016\363A\255\233\271\2472\207\035A\001\245\302\035:y$\332d\215Y\311\243\003AXMU\323\217\352c.\340\007\3526\255n\324d\344\264>s+\203i\360\373\241as\363;\360fZ5Q\250^u2'\203\310 \361\024\312/\t\251V\373S\256\365\366\2371v\250QP\243\2244TC\013\212\nRh\f\260\002\2211\353\034\021`-CJ\225\b-((\024:\274\205\302\256Y\215\267 \226\271\276\244\267H\231\317<K\271\327:\223z\004\025\253\334\237(\251\306\353*6 6\311\r6s\365d\264\340D\311\237\366\017\323|p\242\216\007\254\254\315\311"
+	.string	"9#\243\214C\203u\027\320X\354\311\004\026Y\313=\030\263a\n\234\265Hx\344P0h\326 8\365Y\252\342o}\213\242\210g\223\032\375XBR\007\313u\253,dkyh\270MpD"
+	.string	"\236\304\226\021\271\270\203\362~\022NT\214\260\036\030\246\305\266\250:\255u }\311\177\231\214\376\337R\306\221\357\332\263\344\021\356\276A"
+	.string	"\233\334\303(\024}>\225\204\324\007\335\325\312\272\202\206"
+	.ascii	"\270\n\354\017c\306\304\202*R~u.\206\216\351\177"
+	.text
+	.section	.gnu.lto_gyroDetect.48.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"E\f"
+	.string	"\266WVB q\223\016\270h\324\304\017\f\275\344\305\b\312G[\367\273D\263\n`\312N\220C\210\272(\325l%h\313\373\033\210\261\241\224T \270U"
+	.string	"\tK\264"
+	.string	"\320%\270\004\007\260cCfT\204l\262\345N)D"
+	.string	"D"
+	.string	"?"
+	.ascii	",-0\250h\331\235V\201\017\210\237\340\005\304O\n"
+	.string	"\342\332\241>\315\377\350\013<\031bp\335v\330\341\nAV\270\244xt\037\030\240\304\205\024\037\375\201:\317{T\202\335\365\343:\016\367t\333\rl#\260\257 $Zp8(\355j(\345X\322\364b\304E\277\335\361G\306\370\"\255\3326T,@2n\354N\003\237\fR\275g_\345(:\237\025\376\261\033\232\341bw\036p\246\372\344Y\331\366O<\245c\rN\224\016\023\026\324\003\001\274\177$\332\230\204w\316\035+/fA\t\361A\365\3047\211W9\262\361y.\216\017\252=\241\344\235\273z\254\300 }t\263\347\366\364\304>\\\r\331\027\335\324\347\017\365\371U\354\002\227\324\224\210H\r\203\016\n\227\210:$C\262\341l\036`\322\004\202\225I,\343\\\231\305\331hF\254\020\231Y\031\002\306\"\\\322\"\3010ia\346^C~\215\027\025\375\270\026o\242$\342\371Z\244\024d\233\322\223hx \005\020"
+	.ascii	"A\023\020\305\001{\352\370-\354\215T[V)/\256=\027r\261\315J\322"
+	.ascii	"\354\346\204b>u\016\332\005\244\004Zu\323\224BA\001"
+	.text
+	.section	.gnu.lto_gyroDetectSensor.49.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\006\001=\r"
+	.string	"\206XZC"
+	.string	"s\224\016\230\203\002:U\266\241\377\353\326P=\333b\021\001r\231R\310%\365\336~\3431\355c\275\036\203\301#8'`\020;\233\020\001\361\367*I_\205(\332\020\200&\3233\257\216\306\204p[\271S\nD"
+	.string	"G"
+	.string	"G"
+	.string	"\004vS7h\354\316\006\336d\227\2367p]f/p]\332\366\003\b!\2134 F>\034\244\2108a\375\330\235\233\246\270\350Q\344\237u\013(SKx\032=b!\273\353\030\236J\334z\333\nlW\260\037\"_\335\362+\177\224\321\31749H;V)#\224\307\\\022\255 \253C\326h\361\325o\207|\2261\376\213\253B_\201\264\322\334SFe\232*\013.\035\222]j\027\235$\232\001[R\255\220\020\243}\225\273\b}\245\344\001\334gx\020\250\220!\340'Pp"
+	.string	"A\301\304\253\275A$>\224\252\225td?\206\007\006\241\355\035F\207lw#\260|"
+	.string	"'\364`q\351\227\\\227\327\003(\023Kh\302$\266\3549\212\212\302\376ew\327\232\262\035\215\005\334\307\001e\3708\024\002x:\r\037\257s]"
+	.string	"\340\316f\244\373t\030\274\217\304\263\201\237\007~8p\373t\034\221\255\363\201\333&\201=\016\334\267\215x\336\267a\346\376\262\232\302T3Q\222}\320%\025\323\f\312\324rb\203\024[\226j\007\030"
+	.ascii	"5\203y\036+L\3232\366b\2646\366\033A\301\fX\f\216(\202\312&D"
+	.ascii	"\343y)\3064\005\324\016v\315\036\232\200\361\260v\b\tW\230@."
+	.ascii	"(\f\206%@E4]\363\t"
+	.text
+	.section	.gnu.lto_gyroPreInit.51.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375 \306U\005"
+	.string	"\262I$+pm:\240\373}w8\302\tR\377\256/\374\2638\277R\264\267\237CN\331\302\360\033\307\377\317\225\t%\316\264\300\343m\374{\313\024\267*\r\313\260\305\244\221\006W:kvU\3160\306\203-Z\2712|B.\312\332\234\224\251\220[\t\0368\331\375a\027\345\345_@K\360\217\004\316\350[\n\250\273r2\265(\360\321\374_\352\333O\3320\323\205Mh\342)u7K\314n\033\267\357vv\340}\222\215\002Ew?z\237e/\367?\342\177\342\277#\b"
+	.ascii	"3\003\316\2311\340\313]\303\335B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_gyroInit.52.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\202\032mh"
+	.string	"\212\242t$O0\316\322\032\003\304!\\\006\370\035o\350\323\330\361\373_\306\364\322\213\273\240\317\203\211\203\223M\222\345\330r~6l\250$\202\375\246\361=\226y\347p\235_\351\026\201\020\b#\225\331\370y\374\202p~\3253H\244\032"
+	.ascii	"\350?\317\032e\223)\245\024$\002\030\002;\002\316!\330\331\210"
+	.ascii	"\235A\260\363\007\326\331\303\320\271\210\235\211X\347!v\026"
+	.ascii	"b\235\203Xg \326\271\203\320\371g\350|\034:s\020:\373\260\316"
+	.ascii	"=Bg\036\241\363\216\320YG\350\234\303:\343\260\316\033Zg\243"
+	.ascii	"\320\371\246u\326\300\316E\2413\261u\266a\347\232\240s\313:\007"
+	.ascii	"Yg\226u~\326\331Y\347n\361\323G\325\302\204\210\336\343\245\275"
+	.ascii	"Z\3273/\226`\234X\233uO\333\231\373h\3274\366x\363\0015\373i"
+	.ascii	"\223\302%t\032?\327\334\030\324\354}_\"\313|\002\367Y\2431q\232"
+	.ascii	"\024~=\313\0300\354`\233\271DWi\257V\373\245\343\211\331R\007"
+	.ascii	"\331i\330A~\202:\201\335N\223j\355\020\311[\252\225y\3374\344"
+	.ascii	"\203\265\333&\242\240J\220x\032!\002\351\324\304\264\244\224"
+	.ascii	"\204t\024\302\b\304\007\017EDCBA@\035~\216\034|zxvtrp6\030o4"
+	.ascii	"\024\21165Ca\033d\337]\356\2536\341}\035\005\305\327%X\035g["
+	.ascii	"\227\316\262\265\3072u!{~q\022^\372\311\213\236\217\310k\021"
+	.ascii	"\326F^\261\272\323\025;o\312\253s&+\275d\245\212+Q\351\244)\215"
+	.ascii	"4\305\217\244T=\004\213\244\313\322\352,[T\330\rR3~on\344\326"
+	.ascii	" dh\363\017\334Xn\355\301\250\224\246\231\005z\321\220\241\213"
+	.ascii	"\234\304\340DN\232\370\020Z\013\005\t\t\360\2421m\24033\357\200"
+	.ascii	"\366\203Vd\013\006?\226q(C\342>E\266\222x\217\330\020\347\021"
+	.ascii	"\322;B\202\270Ng\331\002\322\3479a\215\023\366\3037\204\031w"
+	.ascii	"\240uQ\221-\251\337\024y\321\200\266\006\035^\314\262\005e\211"
+	.ascii	"\336\367%\262J`\340\306t\226-\034,\217\326\020f\027\331\312\341"
+	.ascii	"6\377"
+	.string	"\224bVV\323h\235\300\227\023\214Y\240\027\215g\017\235\315\226'l\016H{m=_\310B\267\301\030D\256,gm\270X\350g\225\240Vj\334p\301`y\356\276\2764Z\273\f.\245\273\220\200\367}\331\231\\4\232\001h\346\2672\363\006\314>H\001H\300\212\037\345\240v\202\232)U\257;\331\242\370\t\236}\331T\372\325\235.KK\214\030\245Q\374_\271\205i\205\270\323\025k\276\032\363/\370\355\3672\r\021\277a#\370\235\303YW6e\237\331%\363\256d\221\206sa\376\035\361-\327b\277k8\255\260\373\202\317Hqdu\025P\374\t']\340\264\254eG\301Sp\313\222\270g\356Y\333A\341\225\033\022\250\231^\267\243Ac\363\321\273fv\300c\270Y}\3039\207\004\220L#uA\253\371g\206\300\225\311\033\3072*\235}\314\277/\275A\016,W\216\246\303\346\302\344\206\3762\337\361\255)"
+	.string	"w\232\2473Ke:\260\3150\337Q\256\311\323\263c\354\345\361&\215i\356"
+	.string	"J\301\371c\276#[\323\b\206\371\216mR\332\016j\367\270\371\230\357\350\326|\337\253\206~\007\265'\360x\311V\030{\3377\251\27503_7\224\371\206\322w\353M{\223\330\027\207\247ank\347%\271\203\260\213V@\001m\007\377\217kS\232B\336i\335\005\001\267\276/V3\231\025h.\013"
+	.string	"up\0133\320\2007\223}\215\b\217@00\376\212\033Ecq\257\324(a;\0035\003l\267ev\240\255\270\305*W$\035\245\231!\350)\311\242\024\027\3154e"
+	.string	"\305\byN\356L\031@,\277\366\025\345Y\223V\b\367\204\f\377\375}U\203\376~lI\034N\314]\223e;\3312K\320m\311\033\353\373\276Q\3342\264\023\n,\270\340\202\266\203V\3151e"
+	.ascii	"{\b\023Z\345?\332\235\242\365\227\242\346\301p3\314\214A\263"
+	.ascii	"\245\030\276/\214(n\265^\313\200;H\007Y\305\2247\263\203\334"
+	.ascii	"Sm\007\375\033\255\215\340\330\306\240gS,\2772\247)\375\243\314"
+	.ascii	"\375\327\3535\f\277\017f\326Y\212u\236\240\247\315(\212\316Q"
+	.ascii	"Eg(v.A\342\251\315\232G\020\235E\020\235\2216\316N5\316M\254"
+	.ascii	"3S\215\363\022\353\2544tNbg$\326\371\210\003\376\267\304\017"
+	.ascii	"\f\237\373U\264\356\271`B\326/)\2702\212kP\266\002\301p\024\033"
+	.ascii	"T\354B|\224\217\314XVAxxz\022/\203\203^\212Zw\355d\013\364A\377"
+	.ascii	"{1\240J\277Z\361\200\376\341\344\260\3640\342\262\245\207*\305"
+	.ascii	"\313\222\274\271s\361T\343\362\246c\013\210\217r\207\267\272"
+	.ascii	"\222\034\332u\370\n\236L\002\247\036\266\367"
+	.string	"\344\352C\367\0270\252\231\207\037+\357\317\033\225R\266e\215#\024\270v\024}\224\217\317\341\213-Lq\265|\315*\305\355\3524V\033N\347\2025\2405\312\361}-o\206\313\271Zm'e\227\313\241\270]\035%\316\005\3536)\034\007\366\005%\3253D\354q\004 \331\f\313\252\020\3733\342\237^\0063\373\274\224\361}\336\004\347u\250\347\253os\314\277\266\344\320I\317\367\023'\232\262)\226\320GchB&\350\243k\311\035\253\032\tN\246#\302\202\033\020\317WQ\365x>G\t\305[6\225Y\304\236\035>\352\324\336y\241\215\277\303K\364\342\234?\376\024k&M\252p\035\221Z\235\367\026\250y\3226\276\316\013\335\226\312,<\0278\340\374sU\201Pc\310x\333\363Y\3229\337f\250z\337H\255\361s\276\355\234\200T<\266\216\353\371(7 Y\335\262\272\323w\255\001\031\225eU\247\353z\304\313"
+	.string	"\3228J\222\3034\234\377\273\252\017\350\031\317\206\237&\205\244\357\373\236\031\177\303\373(u\340-\323\264\324\f\230';\3051w~Zx\3500\333\230\304\370G<g\023\313\25797e\336H\255\206\277qA\303\223\340\344RV\003\247\370T*\374\365\240\272\021*s\223\223\025\031\263\341bC\212\322\r\037u\034\335\336c\3067\260\353\r\361\303\232\371\327H\255\315\023\277\2275\224~e0\233'\301i\027\330\f\203Z\351\322\360\321\272\256y*\025\372\256\302h)\341\315\304\243\256\363\325\254\315\204\231\311}\2708\204M\204(\001\350 \273\227\177\271:\334\035n\217\036m\007;\315y\270_\002H\335\250\357p\301ZN\352P\367\207\013\304\233Y\363-\206G\326_\261\334Y\334\201\323\bS\032p\340\202C\213\fT@@\025\301\013\242\006SU+D"
+	.string	"a\352\201\251\020VTQ\360\001U\225\213\251)\035V\341\024\302\212\026+RPU\225\300\001\362E\025\325\213\026S/\220-Vd\360\001RE\325\013\244\323\020S\271\230\252B\206@EU\205$\246a5\373\276\017\366\340\210\035[5\252\357\272\321zx\206\254\312V\315\351\272.Q\342\231"
+	.ascii	"\254W\262\357\373\276&>\032\365\321*mWg\302s\257\214\225_K\305"
+	.ascii	"\312\357\247\214\360\334C2\2665\004JD\336\323E\021\343\345\345"
+	.ascii	"D|\307=\277\224M\221{\037g\345\007\367u}_\265\362\3737\327\313"
+	.ascii	"\355\032\006\351 \022/p\212\365E\355I\230\022\037e\026\255S\033"
+	.ascii	"\013'N\177\342\211WF\342\243\034\003\013\241&n\027\222\315\005"
+	.ascii	"3Zc\302\342\206z\243%\b]\223\022\256\336\244q\231r\025y\346"
+	.string	"v\035\231\271`AI\232\276\315\236[\002\031\312\023\323K}\031\022\246?\361\334R\366.\260"
+	.ascii	":\342v5\031q\301\206\244Of\025\346\211\260(Z\307\210Z\200\220"
+	.ascii	"a\336Xzf+1?\204\253\305\027\342jVd\036\bW\233\302\334.\243\037"
+	.ascii	".\230\217t\351\333\310\323.p\004r\316\316\211\251\243\224Z\210"
+	.ascii	"&\275\322\227\227\3335@\217\347\221DW\206\364\320\327\021\365"
+	.ascii	"H\"\240\300\201\315@\036=\216\177\276\363\233G&\260\364\031q"
+	.ascii	"\n\3617\336F\210'\336\315\031Q\362]Jh<\327kE\177\205\2371\005"
+	.ascii	"KV\223\321K\201\370\017o$\365 \276\227qJ\277J\375\207\377\275"
+	.ascii	"e\3343\223\237\202\324\237x\316\005N\261\274\230\016pf\253\031"
+	.ascii	"\254\320t\023=8,\312>%vxK$\376\257\344\256^J\037eGZ\352n[\203"
+	.ascii	"2\344\210\251\241<<33}\214$\220\224\037\306gY]\257\\\245\262"
+	.ascii	"-z\017\037\344\262L\363X\256V\263\375\225\3335\300\277.\030\324"
+	.ascii	"\265\350\333\034O\267@\242G\343\336\234\tB=Q\233\364Q\226\323"
+	.ascii	"\236\370X\"\275\217!7\313\315$\273\2134\320\355j;i\0312C\337"
+	.ascii	"]~\364\022sO\354H\350\213]\250z(\\\214\013(\364\304;9+\364l\032"
+	.ascii	"\200\367\222\202\037\250\342\020-R\202\2249D\"\"I\222J:\242\013"
+	.ascii	"\020\206\002aRk\352\001\022\240\302Q\016\210A\310\214\222$\031"
+	.ascii	"\016\236&C \026\020C\345\300\264H\364 -\305\354\224\231V\367"
+	.ascii	"\232!\266T#\317\366\016\2217\235#\020\331w^k\360\001V]\257\t"
+	.ascii	"\333\302V%l\200\223\316\212\260\3715\231\035+]\207\301\023k\212"
+	.ascii	"A;P\013\025\332#\023(;\320\003\323\026\366)\023\257\331\244\337"
+	.ascii	"fI\373\227DT\260\245XP\326\317)\371X\213\276\371xp \272\271="
+	.ascii	"-u\325\215\031\030\002\035\003R\035BS\017\347\351\244^\306\341"
+	.ascii	"\002z\232\316\033\200e\215\330\270%\277\246C\357\240\304r\n%"
+	.ascii	"\352\243\344\227qg\353\"\237\325\326\346\205\016\230\305\321"
+	.ascii	"\206V\376\n\365\025\031\326\212\246\251\034\3372\273oF\277.\020"
+	.ascii	"C\225R\230\347j^\007&\315\242\362uh\352\013.A\325\334\237O\212"
+	.ascii	"\251\253MM\343\205\3565"
+	.string	"&\275\257E\322X\222;y\\\037\306\257i\006\004\320A\232\236w\365\216\004\003\322B\237\210\261#Q\274\222%\321\345\311]`\216\302\253\206a\331\233:\306\344^\2242\236\276\377\301V\202T\b\325\344\020\251\326\362\341\307\223\202\247@\350\266.\320!\312p-J\243\313l\307\215\223Z\360\035\227j\213\"u+\374\371\236HP!h\371\223 \213\352\2247A\026C<\205a\017\302\225S\302\320X\364j\261\201\021\245\332v?\024P\365\362\341\312\3470\236s\303\022\203\267\036JN\327GN\355\265\317\033\322\222\330\033\345'\370<\355~\374\274=_\262(`\310\312\261)bG:\324r\261\366Xg\324>\034\231q@c\2068\025rT\270\2540,Z\334\273Z.\223\275\261\231xC\372\211\353\236$n\020\002\213\231\263\377/{F=ydN\333\265.\215g\300M/$\370dZ\265\274\262\364\025\223\367|G\344X"
+	.string	"\032\035H\2616\252\006\314\212\250\027\217\277h\316D?\342*\205\307\304\004\274\276\216)\245\177\025\272\251_\354(sy\216Pp\360.\035\004\373=\247\003\270\317:\325\313\037\367\342\271=\2146\201\350\213a.wcD\271OH\236o\361\177\035\257%\243pBh\264\223\031\241\232\004\r\013\204\2525T\327'\371\231bTYg\265-h:\343*\332\212\006\241j\320\214\007"
+	.string	"\212\251\207\375\267\257\262v\001\341\355J\300]\n\317\364O$\013\023^\365x\256\232\007\n\225\2146\245\211e\b]$\313ba2\201\271\021\255\262~[\2041\264\267\251\277{Bw\272P\236\262\200^spN\f"
+	.ascii	"\340\212U\0040\237\267\227\357\260E\363\257@\r\353\363\206\003"
+	.ascii	"\"\322\356\021u\327\351\213\266\221\200\203\202\227\263}\370"
+	.ascii	"\310\207\354\207\357\\\rW.\005\017\362$\335\206\007 \226\026"
+	.ascii	"\004\3739\024\252N\265\225(\323\276\030D\232\354C\211\365\264"
+	.ascii	"w\032\035!\250\250b\324\223o\031[n06\303H7E\0160\b\363x\226\325"
+	.ascii	"\324}\345\036T\265<%\3322\357Mn\235\353L\037`\240\373\224\022"
+	.ascii	"\237\310\271\273\020k\016\316APEc\3048\225\332\2309\205q\341"
+	.ascii	"\330\273\017i\031w\027\224:fAJ\304\321\002\362\370\n'\261\247"
+	.ascii	"\300\243\316\300\021sp\306\217\314f\310G\343L{~\247\216\017\344"
+	.ascii	"j\311\245T\026\303\265\243\006\n\210\230\377\302\022;\345\201"
+	.ascii	"\343x\2639kY\024oklDS\223\322\021|\244/\355\215U\013\251\347"
+	.ascii	"rL\031U\027\233\271\346+~\261\235k\341m\227\210\266\323\035\220"
+	.ascii	"\370nW\261?\322\335\337*\370\263:\264<\250\006\364\356\274\307"
+	.ascii	"\025r,\345\370\352\270\2254Az\264\001\335\026\257\265B\271\321"
+	.ascii	"\272\255\317x\246/\313#K6\337\036\326\b2\016\001"
+	.text
+	.section	.gnu.lto_getGyroDetectionFlags.53.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375 \372\345\006"
+	.string	"B\21504`m\322\001@\203\t=J\223\271\376C@\314\016\344|;\227\213\030\0064i\250\3670\355n\334\005\317\fC\020\322D\310m\347I\357\037D#ld\023)S\n\276X2TE-\300\250ixV\204V\205\261^E18\274K\264\236\205\300\360\001\023_\006\302\370(\333^A\251\025L=\366;\276]>\2065\233|v\347o\246\273T"
+	.string	"\n,G\366\326I\265\260/\255\202l\247S\003D\022\332C \273\023\243\222\025q\037\031\26696\305\027}\203\343K\001\002\373\034h\214Dx\220\354n\257\362\201\351N\272\300t\247\027\277\236\227\177\216'xB!\231\326yN\020v\327\231i\237[o\273\300\266\201\355\212\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroSetTargetLooptime.54.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\311\001\245\017"
+	.string	"6\236gC"
+	.string	"\221(\035\240\236P \3655W\225\315Z\365\033\214]\361h\037?\343<\313\220\3407\021|\207Q\366\255\236B\320\240\354Y>\307\355\005]U\002\020FP\337>&\376\345\305\347W\365\257\375\222O\366\2262\245R"
+	.string	"P"
+	.string	"W"
+	.string	"\036\333\231v\002\005\250\263\220Xw3\274\250\330u!p({4\312\226\271\253\303\n"
+	.string	"!S\342rcw5\345p\324#\324D\371\233\017N\353K=f'\207\235\357\344\n\372X\260\300\356^\304\263\302\267\312\334|\354\256\263\365\231\334\330m;\260\355a\347\202\fPhp\214"
+	.string	"\251O\342.\022_\305\023\272|\353\321\357\260G\023\nM\b\f\252|\331\256T\352\006\373p5\305>\313\017\212\351\017L{`\272\003\323\234Lg1\215\301t\204i\230i\325\364;"
+	.string	"\304\260\360\335\303k\367\302\213fc\"\213\025\333\017\003ZV`\224\324`j\213\216b\004\222q\342\255\032Q1U\032\336\013\250^q\033&\273\353\003\254]\225\201\250\367`V\371\262*T\350\302\233\271\252\006\320\260\322\242\244&w7\245\336\260+\204\226\031\254\314a[\344&\266lw=\374\022o\221\340\253<\232\304q\330\3435$\2564j\020a3e\026\205F\266\322\006\302\235(\210h\335\211\353J\243N+m!$Mt\352\264\020\001s\246\321I\033\341\270\223\346q\355\341j\2123\231/F\245+\030;\322~"
+	.ascii	"\222oY5\265\360\243v\310S\274x\364\323Q\217n\\<\030\216v\364"
+	.ascii	"\336\207L9zo&\323# \200\002!I\263\003\323C\243I1\\\f\373\016"
+	.ascii	"c\201\333Gq~\315\210o\177\364\032\213\004!&\231wf\226#_\261\b"
+	.ascii	"q\027+\3432w/D\3542<B\037\225\214\270\334\021\3369}\313\355\363"
+	.ascii	"\207\017\023\341\250\316\344\320%\r\330\236<~zk_\031"
+	.text
+	.section	.gnu.lto_gyroSensorBus.55.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"U\f"
+	.string	"\306\226SB \221\222\016\f\301\320\371\033~\215\245\203\353\227\234\347\030\304B\232p)\336`\201\025\312\\\216cK\276~Nv\355\023\313H0d\233zX\bQ\002z(\204Ej\201'\204\004\213Q\243\366\311\336R\246\024?"
+	.string	"?"
+	.string	"B"
+	.string	"\273\035\345\356\235\351P\363"
+	.string	"\323\241n\270\350OS\344\037\346\013F/3\"\207\362\267r}\005.\264X\341p\243\327\221\321P\3430O\025.%\263C\301\356:#W\341\206\267\315\300\366\207\375\006\001\371x\350\233L\207\327\316\f\210-Kv\207\222\332b\377\255\262\330N?Mg\246\017\001\304 q\177q\261K\241\224c_\300\025\034l\237\330\033\337\303?\234X\244\023\"l\031\ft\210\022bn\004#\373&<\234h\177^b\344,h\270z\214\003\022\020\254\247p!i\323\341\323\313\210\026\266,\275\247-\231*l\310`\320\223LW\2051b&%q\330\276.\202D\263\273\007\374\020\3572\237t\350\220I\366\200\224T\240*\344\302\264\021*\303\256\f\364\311(P%bQ\036,\243@\004\370z\360\301\250\222\353\302\250M\267\177\253,\366\210\352\243\320\020\204\204\254\004\0361\375\023\032\001\227\335M$d}\244\252\330~:`\323\026"
+	.ascii	"5\013=\205\340\001!>3!e\t\24520\325:\214\323\rK\220\211Z\177"
+	.ascii	"\\]\004\305E\221'\242\264\b\320x\b\3205\274\035\213\367\207 "
+	.ascii	"\307]\261\252\321)\232\332\003"
+	.text
+	.section	.gnu.lto_gyroMpuDetectionResult.56.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"e\f"
+	.string	"\306\026TC"
+	.string	"\2216\03587 m~\266\274\326s\363n\f<\214f o<\271\002a\"\244H\215@8\365\0332V)\362\321\264zp\216\377c\002\252jY\233\005L\361\004\244\240\003\214\004&7\343c\333[\312\224\002?"
+	.string	"?"
+	.string	"C"
+	.string	"\273_\345\357\035\3521\363"
+	.string	"\324\243bx\351P\263\344\277\345\013L,':O\344\320\344\n\013XXa\262\361L\260\003s\022\343-O\022o$sC\301\356:;\217\302\035o\233\201m\217\375\006\001\371\356\321\007\241\036\257\235\230\016\\\236\354O$5\305>\\E\261\235\206\232\316L?\002xQ\302;\313\313n\311\251\306\262\210)2\330\016\2615\376\206s\bqI'D\340N\fh(\221\3402#&\373/\241Mg\213.\242\343*`\330\272\213\203\020\020\256\233PY\331\250G\250w\321U\340\362\004\241\246d\242\220\001sA\357A]\265\005\210\230\221\244a\033\373\007\217\314\356\036\360=\374\323\374\225G\223@\002\016}>\254\221\005\302\262\255\243\3222L\033\211\264jdq\\U(\323\252\217"
+	.string	"c\017DY\365\201aY\245\371\366p\025\305\234N}\022\033\002\020\351J\300\351\322\037\261\021P\331\3458H\227'\225\3046\324\001\234\006\026"
+	.ascii	"5\013=\205\340\001!>3!e\t\24520\325:\214\323\rK\220\211Z\177"
+	.ascii	"\\]\004\305E\221'\242\264\b\320x\b\3205\274\035\213\367\207 "
+	.ascii	"\307]\261\252\321)\232\332\003"
+	.text
+	.section	.gnu.lto_gyroRateDps.57.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`~\001\225\017"
+	.string	"\006\336hE\360\222(\035\262\272\361\357\241*z\217\330\313\210\346\3746\260\026T\007\355\372}\023\364\333^*\216\354TZ\333++yE\022G\005\373\365+n\n\321\016\245\231\234z\375x\364d*:u\273Cl\353\311\336R\246\024V"
+	.string	"M"
+	.string	"Y"
+	.ascii	"\253\300\"\317#\b\332\366Q<E\312*\004\032X\253\320\t\017+4!\273"
+	.ascii	"\313\rx\311\366\230'\260=\352\210\253\0165U\376e\376\240%\013"
+	.ascii	"\362\202\255\016[\2560\301\007\034-\002`-X\202#B\3472O\026\230"
+	.ascii	"+\023\200\203\335u\276`\035\356x\333\020l/\260\017$0\217"
+	.string	"\356R\362\257G?e{\274\206H\334\260r\307\236\255R_\354\303U\027\177>\373=[z\213\351\250i\250i\205\351\324\364\003\220\360\320\201]\326c\227\303\016\221\325\021oJ\330N\331#\2663\355\307\\E\3523\327\360g7\204l\306nP\355\t\024\266\277\242\202\\\272\262\352\025\352wl\270\321\252p\031\256\271\217\232O\036c\344\201\341\221\256\023\203\371\364> \324\227L\233\0378 \364\246-\225\304\304L\216+\207\330.\375\205\311\343\"\225\313\211\261Qg\341\232Plw\033\330\247\323,\030\250\355.\203\231\257@\361\003\337\t\303\b\232$R9\241N'\235\227\301\304}^\367\241J\037\207:\215P8\222\367q\242\003\356.\224<N\245\353<nd\266\207\253.6\241Q\237\306w\033\021:\322s\230\320\244o\363\235\026\333e\375eK\350HoQ\333\224\305\366GA,m9\352G\277R\204\225;.\220\001\035"
+	.string	"X\013\3751!\001\242\003\315\255\254\030\b\261\343f\264\022\261/\260\335\023\3302\243]\316\n!(V\344`Q\022\013\240h\202\263\n"
+	.string	"\301\335*uA\2201\233\201\270&j-\032\r\021\273'\023\004\234"
+	.ascii	"\244\032\264J\244)\205\202\002"
+	.text
+	.section	.gnu.lto_gyroReadRegister.59.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`?\001\005\016"
+	.string	"FZ_C"
+	.string	"\223[8\373M?_\216\226\3439cK\253R\267jL\245\315\311HZ\227C\312\210\030\303\003\377_k\226*@\305[\227\222\227\331\326\352\3721g\256\301vK\031\0340\337\006\244]\036\257\306mK\244L)M"
+	.string	"F"
+	.string	"M"
+	.string	"\337\330v\t\203\024\203\004VH:H`R,,|\354\2524\005q\360\227&\350_\346\022B\324\214I$\375\002\020\242\350a\022=\\\257\222\225\030cDT\271DN\3440\361\361\331\"\206\231X\204\335u\232\304\016\367\346\266'\330\206`_D\372b\377Zu\261\2574\3464\347\250_\237\3723\323\017\021\3311B|\212\326\356\206\026\220emf\224\260}_\305\307\321Uvp\252\021\263\273\331\310\316\236bgv\252\346A\346Q\240u\367\303J\306\256j\201;!\001[\002\320[p\005l|\364\205PG\341D\343cw\033|\203i\213m\216\036(ih,\257\230\332_\206\274\211\243\227y"
+	.string	"V\215\310ZQ\322\245/\306A\202\007\007=\310Q\375x\004$\032\230\0257T\362\207S\257g\tR\312\226\255\n3\240\315\323\n'\037\356DC\346O\007\205\023q&\2357\002i\237\327}\242\355\323D\234'\244}\274O\353\030p\207a\3634\224\256\363\264LU\372\265\352\342\324\217\207\341\031\360bS\260\342HLB\235\205\023\215\230\013\310\217w\341\031\t\261[\272\351\243?\237\t\031"
+	.ascii	"\323#\360\371\241aW\360`\f!\3601\3256\207\"M\346.7s\300\257v"
+	.ascii	"H\325\325u\001\312\260\236\013y\271\215\301\240\226\2240m2\266"
+	.ascii	"@90\030\030\3413p\365<H\263\245<\202\202\002"
+	.text
+	.section	.gnu.lto_gyroSetTargetLooptime.part.0.114.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"m\n"
+	.string	"\366\222D9@\217\322\001[\266\334\206\303\342@\223V\f`\204Q`_\237\204\273\005<\350\200\326,2\243\271n\244\265\324EXG?\303\004Q\331\307\362\342\237~c\3039Nf7\331;\2451"
+	.string	"4"
+	.string	"4"
+	.string	"NYX\264g\037?\226#2\243\220\321v\267\236N\217\213\237r\023\375\217\017`\265T\237\002\255\213K\202o"
+	.string	"\n\273k\016\343\246\267\375\261\r\262\237\020\033\273\0255\231\355\240-!\217\335~I\312\037\275\211\331\363I\035\206\222\234U\305\034\234zJ\333\363\021\017Cy\356r\254\260\354\216\b\247\356p\247\233\323\223\330\001\262\333\243\253\244\324F\374\222\306\376\216R\032x\331]\220o\362\223\320\00795\304I\236u\352\2374\247\022\03134\230\225\254\311\371\362\334\276\355t\331\233\3240\b\243\317\023-8t$\316\241\216\251\363:\206\017\214x\250!\370\205\236(\254^\3270\252!0\254\235\002\177$\021XM\337\007\326\215m\371m\247\313\334\254\345\262\232\023\236s\276\002\027"
+	.string	"<+0\036\320\300f\224L0`\334S\034\200\341\250\252A\360\024 s\231S4&t\353\202`\037;\355\025\325C\347*\233~;W"
+	.ascii	"N^\314;-M?\241\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`\204\0045\022"
+	.string	"\026[gH\320\224M:\220_&h\356\265|\n\305\370/iF\356\373\f\tJ\375Q\367+\361\"\020\025\034z@\326\177p+&},W\b\244\031{ \n#\243sdtFm!\243\223:\311\nf'\006\222\036\336\310&Dn\231\002Q"
+	.string	"U"
+	.string	"T"
+	.string	">\247Y\231a\210\242\3476\302\363\233\270s\233\250s\323\320\234[\206&\301\271L\024\202\3401\321D\021\030'n\016cc\031\267\244\346\2548\231\246\255r\340B\272\265Z\255F\363\231\017(@\234m9\303\260\325\302\276\275\324\322m\3169Y\177\211\266\271\03162\3347j\030\036t\341f\262p\363\250p\317\240p\327\230p+I\270c\332\212p\307\200\360!m=\270a\352\340?\261\301}b\321{\030\234\207\310=\270\005\337Qp\2358\344\245\024\343\340\326V#\230\220\013\027d\035\334\021\240\347\374\034GI\202\327\204-\027\032\335\223\214\251Jo\213\\\274%J\2516\204z\bR\222\212\226\324\266\350f \265'.\002\250M\321\324\263\327,\251"
+	.ascii	"*\316^\263\027\013jMd*+\335JZ\310\322m\347\322\235s\226\030 "
+	.ascii	"W\312TS\344\202\260\\\017wS\207\333\007\207;\307\206{\207\206"
+	.ascii	";V#\226\200U\232n3(\333=i\004\020`I\034}\340\216\240\251\211"
+	.ascii	"(9\005\211\001W\304\223\372G\n N\037\270+$\025\030\233^\260X"
+	.ascii	"\241\002W\312\220\310\200k2\373\266\216\366\362\255t\301|\273"
+	.ascii	":\212\336\256\302\315\333\223/\354\274M\305\324\2609'\312\333"
+	.ascii	"T\250q\024\002]kFaii\2261\300\002\241\233\322\006\021\320 6\206"
+	.ascii	"\020\301\020\td$\240\022z\370x\023\216\245I^\240\026\352\210"
+	.ascii	"%\253\347]\230\363\026-\246\267\203$'q\336.\346\336\314qn\261"
+	.ascii	"\263p\222\342\002\246\3178\323\305\367\272\226^dH\212\034%\306"
+	.ascii	"0U\225\f\321\303\036}\270\315\fP\035\035@\017\031l\237I\362\337"
+	.ascii	"\301-\305R\247b\233\313\004\005\372\226Q\3311ca\203\200\r\264"
+	.ascii	"\263\004\262{\235\336\3467]\347\200E\236q<\022\3335z\263(\321"
+	.ascii	"\242\202\203\267\020\020F\325\330\033\224F\262Q\005"
+	.text
+	.section	.gnu.lto_.refs.2e1eaf2685c61950,"e",@progbits
+	.string	"(\265/\375`Z\001\245\013"
+	.string	"\366U?6PM\223\306k\363\323\374\200I\305g\022\244\310L\210(23333333\203\230Y"
+	.string	""
+	.string	" H14\377?\310\037f\326\322\2665#F\326\326\266I\262eJ\001*"
+	.string	"+"
+	.string	","
+	.string	"\0233#\271g\023R\026\201\210\331\264\fy\2046)\3730\243\267r\n\275\224w\362F\336\307\253N?\037\211J\231)_Ws\020\222{\214\021\204,f\201w\300\213qzq*`\2658\355\234r\224\311y\245\323\314z9)\247\221\323\307\351[\204\321\336\277bN\001k\203[\006\353\202W\301\233`Ep{`\251\201\265\004\226fHf\306&\306\332\213\245\223dN\233\235ws\252Yk/o\224\321\311fN\001\036\013\245"
+	.ascii	"(\243\316\234\307\227\233u\205\212\024(Ntt\230(A\202\203c\204"
+	.ascii	"\210\020 >x\350\260\261\301a\203f\325\220\001\303\352\005\r\311"
+	.ascii	"TcS\013\025n\2450A\302Z!\254>\b6 \240\002\261\"\352\006m\210"
+	.ascii	"\250KA\034\200\001\016\317\3707\306-\2303\333\342A2@B\366\215"
+	.ascii	"\301\004\263\023\214\311\204a\007\033\273M\320v\t\214\325\232"
+	.ascii	"\300v\037c\231\260\303\330&\3325\206&\253]ZuvMVl^\300\252lvS"
+	.ascii	"g\017\253)P\030W\326\330X\213P-\b\233\327W\303\226\3252\343@"
+	.ascii	"\205\335W\343\372\271\017\006(@C\302\342\254&\t"
+	.text
+	.section	.gnu.lto_.decls.2e1eaf2685c61950,"e",@progbits
+	.ascii	"(\265/\375`Hd\275\234\001\032\242\332\223T \fQ:\215\001\026\364"
+	.ascii	"\374\240\224\371\177c\376\270\206q\216\020\236\361U\377K\340"
+	.ascii	"\340\034\002/]<F\240SQ\261r\016l.L\300\023\034/\326\331;\310"
+	.ascii	"\315. v\026u\215\262\222\320\3305?\215Z\365\230\316\216R\251"
+	.ascii	"\b\312krD,&\267\334RJ\231\002\375\007=\tj\t\200\036P\036wro<"
+	.ascii	"\370z\211\256\\U(g(\242\257\201\350\353\036\372:\251\257\263"
+	.ascii	"\364\265\225\276vU(\203P\203\362\265\223\306m5([e\r\312\027\375"
+	.ascii	"\323C\313*\224\357T\r\312wY\203\362u\322\300\211\016(\213\217"
+	.ascii	"\346\351:0yJ\373eN\257\031\307\336Y7\325\216\r7\301\330.q,\234"
+	.ascii	"\275@;\347n+\2472m\034\373\006\207\321-\223\026\360\3210\372"
+	.ascii	"h\234\266n~kg\303X@[\315\266\331\230\305mj\225)M+\213\217>\321"
+	.ascii	"jl\031k\246\332\201\341\2623\226\316Gg\357'9\245Uc\373,]\265"
+	.ascii	"c\303L\334\322X?\313\306\376\3315\225i\325X4V\376\312'\246\266"
+	.ascii	"\371\234{syQ\356\275\264jl\263\266\371<-7\026ZE\371F\016\340"
+	.ascii	"\336K\017\372KJ\354\213\007\037\275\322\317q\364\263\032\375"
+	.ascii	"lF\233\371\355\030K\306\362UT+\356I\026\213m\236\325\253\314"
+	.ascii	"\rvo\377T?0\250,\213\237\305h\023\354]7\344:gN\335"
+	.string	"\220\237\3454\007U(\347*ZD\210[\274<\026\347\303\215\305\317L\215\227U(\237\315L\177Y\203\262\365R\337\356f\301\244\341\001h\361\263\021\375\267\032\224yjP\276]\r\312\317At~\263[\256\345\262-\261LY\034w\303(\311\301\305\342\347\035\032\316f\311eh\240\260,~\336\322\317R\372\347\033\375W=k\304\036\261Wp\237\223/O\026[\341\231b&J\312\342\237{Tl\225\312\264mV\311\355\022\313D\304\007\266\315\212\325\265j\227\004\241\354Ls\357e\233mb\247T;6\274\246\257\271\367\036\362\340\341\247\310\337\f\253\214\177K\206\304&\261lL]\300\370\260X\212\205\037q\200p,\376\251E\277\236\245\t{\203b\227\366\211e\3325\353\304\252U\246\215b\315n\317,\332[3\257\231\246\327T\203\206M^\024[\246\327\334{G\251~w\363\211Zn\"\020\310\333\232\033\362\220c4\275\364"
+	.ascii	"\302?\263\350jW\2052\0074\375\263L\333\261\020\267d \204}\225"
+	.ascii	"Y|\225h\224k\315\227\376yC\243\273\n\3457kP\376Y\245\205\354"
+	.ascii	"\252P\266s5(\243\3136\332\002\227\236\266\240\254A\371\030N\007"
+	.ascii	"\001\242\243uc\r\314\342\037\033r\214)9\312X|\354D\377\267]\326"
+	.ascii	"\2532\355\227\345\372\2626l\217j\307VB\2269\373e}X(\237\250\345"
+	.ascii	"v\332\211\361\206\227\004\334{o\360\340\301\007\254\313/\231"
+	.ascii	"\361\261\226\376\225\243y\fa\240L\232\r\213\177\375\364+\034"
+	.ascii	"\0164\245\315a\223gM\273\303\352\250L\233\303\3368^n\017\036"
+	.ascii	"\206t\310|\214Ie\374\333\324\277b\364o\235\376u\323\277K\275"
+	.ascii	"s\207h\036\254\032\224m\326\225\024+2r,\376\275\241_\231\026"
+	.ascii	"\353jg\211\0325o2n\257~\021\037\334\215g\357\263\2757\207\236"
+	.ascii	"\263\272\255)\213\355\224\265\372\257\363\363\304\027H\303\342"
+	.ascii	"\337Z\331*\0356\314d\231\3051v\232\234e\231a\361/\226\376_\231"
+	.ascii	"\226\312\302X\356!\236\027B\2660\261\370\367\205\376\337\335"
+	.ascii	"\376\353\324%W\310\250X|\333\324\267a4\017W\r\312\177\325\273"
+	.ascii	"\215\372+\231Z\306BY.\r;@\346\336$-\266OC\332\312\020\257&\026"
+	.ascii	"\337f\321!\322\3105+__\216\267\2633i]B4\345\224{m\352B\250a\""
+	.ascii	"\327|3s\267j\307V\225[\2724;\370+\037\232\273\371\350\354-g\366"
+	.ascii	"\266\367\376_\003+\234:\307\356\372\246\312\261N\025\260\306"
+	.ascii	"\251\314\352\246\256y\375\253l\216\227{G\355\275_\341\376\020"
+	.ascii	"\325M\365\273\033\007\030{\313\365\240 \252\315\326\022\300\275"
+	.ascii	"\267\207!\017;\311\267\251\274\f\3706\210\266\\U(oP\203\362m"
+	.ascii	"R\337\322\320\267Z\372\366J\337V\351[\030\372VJ\337B\351\333"
+	.ascii	"\255\201jP\306\240\006\345*%\304\253^P\306J.7\333\336\373\347"
+	.ascii	"\276m\221\212c\361kSg35(\367`\325\240\374j\247_\267\350W6=T\205"
+	.ascii	"\362\253\021]\353l\245\253`^\353\352\334E|p\236\250Z\207\367"
+	.ascii	"~\2525\003\237Z38\265\024y\202\222\361+\230~\335\322\035\252"
+	.ascii	"P\256r\250\233\030b\302X\374\022\350\252\245n\251\314\312\345"
+	.ascii	"\257Y*\334\261\032\327f\356\275\354\271O5\350\334,~\355\220\177"
+	.ascii	"\346\314\2313\247v\310W\322\030T\241\214kP\276\b\364\355\252"
+	.ascii	"P~\006\264\317\256A\371\315*\224\353\224J\2452\013P\253\274J"
+	.ascii	"\251i?\237\226{\271\367\362\307\206\005N\201b\361M\350\327\002"
+	.ascii	"\344;gN-@\376\b\332\326\240\\\237T\265"
+	.string	"\312\264\240F\271\210\017~\235\324\366\331\336\313\237\0369dr\340X|\007\350W(\257@m\177\360 \375jA\256s\252\005\371V\373`\325\240\fT\205\362_\321\376jV\317:\334\251*\256\315\266\367\362B\217\0332Pc\026\177Y\205\262\256A9J\030\352\001,b\t\027\275\374\217\262D\205\021\374\326\207U\373\353\007<\360\237\303S\324\021\374\327\360\243a\303\337Z\375\025\017#y\375v\211\215~;\343\267\027<\312\320\255r\341Gm\374\227\bN\177\233\3056y\025\034\202\023O\021\206j\200y\374\2430~\013\345\2675~\033g\333~\353\345\267>\376{\244\350\277'\230\270J0\321\217\037\253\270\037\300\302\377\016Y#X\004\277\275\362_\356\277\367\267Q~;\347\277;\377\025\342 \016\301\2175\3701\b>\360[\264\337j\371\355\333o\331|\236\242\246]\022\376o\301\036(;\341G\231^\177\264xq`\rd"
+	.string	"\210\317\217\232\370\361\371\333&\030\370m\003\254\003\376\323\345\370\316\217.\340\267:~[eC\370\255\226\345\302?)~\273U\177\233\365\327(\377]\300\217Q\374\270\202\024\376+\201\037_\340\2679\376z\366[\0337\002\326\353\267D~\013D\347\277'j\332oE\370O"
+	.string	"|\342\307(\3745\313\320E\374\250\n\277}\242\204M\374\367\210O\370\255\334\177/\374W\377\366\313\177O\200+\360_\fR\230\002\267\347\267\201\377]\001\233\360\337\237\377\036\357\2240\002\016)\360\210\217\370Q\341o\335\376\013\364[)\226\371?\n\317E\177L\302\177\203\270\304\t\360\240?\353\375\225\002\377\243,\325\013\034\376\372\223\364\377\347\317t\377\215\203'\360\327\f\376j1\211\037W<\302_\005\360\327\013\376:"
+	.string	",\302o\251\3748\204\337\326\375\225"
+	.string	"\277\235\362[\272\377r\240\376\374\365\002\226\300\217#\360\277\003\030\002\266\311\213{\370\321\237\377\242\301\017\370\357\032\f\302\325\303\r@\001/ \3057\374h\375\257\230\377b"
+	.ascii	";\340\257&~\353\344\257(\\=\334\200\377\036a\006\374x\304Q\300"
+	.ascii	"\013x\005\177n\363\333,w\003\370\203\377\005\370\261\007\027"
+	.ascii	"\351\026\376\214\345\307\035\374\370\303\2177\370\261\005?\006"
+	.ascii	"\300\217\201~\314\363c\375\343\374c\373\337\300\377\266\371\357"
+	.ascii	"\337\177\233\377\335\373\357\230\377z\371\257\226\377b\371o\225"
+	.ascii	"\377\256\3757\354\277\314\377>\371\257\223\377\236\375\267\354"
+	.ascii	"\277M\376\273\344\277\312\377\026\371/\220\377\346\370\257\215"
+	.ascii	"\377"
+	.string	"^\375\367\305\177\367\177K\360\337\025\377E\376w\351\277\304\377\"\375G\341\277\302\277\306\375\226\304\177E\370\353\362\257\027\376\033\374\357\006\376\323\375\266\313_\235~\313\345\277 \370o\007~\273\374/\007~k\344\277\030\370o\n\377\243\374\367\304o\233\374O\361\277\312\177Q\370\257\005\376\233\370\257\211\377\232\360\337\022\376;\201\377\222\370\357\b\377\335\360\337\241\377j\370/\005\377\025\372-\336o\357~\033\346\267v\377\317\376k\340\377\227\377\031\346\314\2313\347\327\001\3721d\370)\220!r\367\351>\301\242"
+	.string	"\224\"x\f\t\030\324\225\"\342\342\205\031\226\227/oxI\300\263\254\266\371<\001\355(\250+\345\224\363\355d;\243\234n\347\2263\355\304r\256\235\3143\313Iwr9\245\234UN*'\230\263\356\\\236j\247\225\323\313)w>9\273\234W\316\266\323\311\t\345\264;\277\234s'\334\251\2452\317\270\323\354\347\331\211Fv\216\211\35515\317F\335'X\025\200\372\322\fs\207\246t\302V\333\356\362M\277\200\002\247Y\257\324\270\332\305\0034;\274$\036\213;\223\2105\361\222\200E\260\330-\0304\331{bg\234\255a\203\334'X(x]\241\001f\265F\220\275\341%\001\235\324\345\034+nN\270\360\222\200v+\316\316\260Z#\244\260tb@\221k\246\341=\200\013/9v\245bq\202\205\227\004\274\022\207\205\227\004\254|q\347\022K'\266\304K\002\026\211\263of\3153\356T\236GFHaQ"
+	.ascii	"\312\220f\2213\316*\255\233\226\007M\354\342N%boxI\300+q\325"
+	.ascii	"\016m\231o\364y\235\225\300O\263\254B\331'Y\203\3623\234\321"
+	.ascii	"\317`\247\237\001\213>\233\350\220Q\263\203\315\342g`\323\317"
+	.ascii	"@\246\237A\251\237\341K?\003\016\375\fV"
+	.string	"\372A\177\372Az\332H\340\034\027-\026?hN\237a\367\310\031d\204\024\026\tx0\232S\377\205q\251\316\260\033\343\022\271O\260*\200Gu\0169\211\234E*\363\f;\301~\243\256\213\027a\247\020\034\2305\002\211r\311\207c\315\030\215\037\344\246\037\244\246\343\336\244L\341b\361\226\223\352\222\261f|\236\200\366\366r\263d\376\273\345\216\261|\036\230=Ui\253uw\251D\327\274\350\232\365MJ}\352b\346n.\236 \200,\311\331U\222\205\314I\231\274\253\227\345\001\331\335I\205\377N\030\367\t\026\005\240\3204\257\032U\265\253kw\251D\245x\3555\357\222\223\3522\271h[\033\240\251\225e\001\264]\370\332\232{o.l\344\251\013\0042-\266)~K\265,W\213Y\227\330\177\225'U\025S\333\252\035\330~r\032\201vg\245\326m`\246vR]4\270\307\326\332\200\254k\377\212Q\251fweY"
+	.string	"\367\2268\212\027\002\232d)\313\002x\241\374W\215\3522\357Z\265Kn\2474\036\240i-\361\230\023\2346B\nKG\006^Zs\357\345I\205\331\360\232\021RX\025\3602\273jW.\226\373\004KS\301\373\322\274[.\227+\306\253\203\231VY\026\300\273\204\352\246\335'\325\216m?iq\200\226\244,\013\240ErR\335=Kw\237`\225\300\263RwR\341#\270\311\b),\235+<\266\223\307i\343\364q\3528\255\316\035\247\326\351u\3368g\234_g\215\363\352L\2362\316\037'\220\263\307Yu\3468\273N\032'\2163\306\311uf\235['Ve\236T6\313o\221kd\207\354\251y\325"
+	.string	"<\365s\243\213\307\234\305\017j\242\377\237Q'\324\351\342\224\252\314\363\305\351\364\213\344&9>_\3409\347\366\211\002\332\333+\354|\201\341\340\300\373\004KK\201B\244\271\367R\304\007\347\213\363\251\256\3718\001m(<#\312\275\227{\347\013\334\006\277\251v`{gy\260$KY\026\300\275\367\251\246\b\223\214\005\374\240\030\372A\373\334\177\335\303rp\340\2154j\240X|\fn\264\335\035p\234\345\017\317S\215+a,>\206\246>\2062\372\307n\216\337\374x\f\263\261f*\240\027%L,\306\200!\216\335\\`E\013\026\213\321\032\224\217\301N_\f_4V\363\363\025\344i\214\305\307PEO\301ow\251,\001%\003\r\366\303\315\312\304i\036\225\006c\301cFHaY"
+	.string	"\312\252\231\006\367}\216\003\324\324~\362\301\001\2227I\232x\r\254K\017\215\217\001K\337\222\241\333P\355\300$\220\244\n\334\035Ys\357\345\030\234\005\317q\200\232:A\256\r\314\265\260)\303\2245\355:T;6\022og\315\275\227x\f\306\273\026\237(\240\035ed\f\217\301u\033\262\220!F\336"
+	.string	"\362\3413\230\f\336\303yX\017\233\301e*\023\217\301b\242\316\265(\200p0\340_\250\242\177\201\251\177\341L\377\202\022\375\013a\372\027\276\364/\350\320\277\240\365\245\315\t\315\335\225\305\277\340$\207\273T&\366\202\343\340\360\226\2573J/\230\013\336\202\341\314\036\020\036\200\367\n\337\232(\031\037h\251\177\274\005k\221\203\266C\216\305Zp\234O\332\221\252/\213\017\004\246\017\344C\037\b\207>\320\226\376q\225\343\267\037\257a)\330M\004S`|ya1\266\202\257\034\273\341\266\215\335<\340\332\373\t\273\375\304\331\373\351\247\326\fj\315"
+	.ascii	"\227y\035\241\222\361\201dhL%\304q\025\027`UZ\026\027\240\006"
+	.ascii	"\345\003\275\320\007z\322vY\205r\207\032\2241S\315\270\244\317"
+	.ascii	"\207\031(jwHSO\371\344X\315\211\257J\2311\372?u\372\f\243\231"
+	.ascii	"\351,\2411\305\f\333\231\231\016\231\263+l\312\216\315\356\037"
+	.ascii	"\017 E\2228I\322p\263\370?h\232\203\032\2241\223\252\004\316"
+	.ascii	"\217\227~e\342%X\t\032\345F\255N\354X\311/\342\203ZW\315\372"
+	.ascii	"\360\332X\214\221\340$Zy\345\344\"\t"
+	.string	"\334\217\334\02798\224:i\306\200\001SZ\276\037H\256\230Y\374\037\032\372k\350J\211\"\263D*\023\027\301>\330\212\340.\0346\005K\2335<\033\206\033,8lH\225!\2439e1\026\24237\203F\027\213\357CF\3778Heb\260\276\016>\304\264,\376\037\006\362_\307\006\031\203\346\215\305?\006r\374\003kK\271a\361\027\332\227u\247\026\347\205}X\037Ob\262,\276\017\026}\037'\372>e\230\207\345C\263\261f\361}\214\350\3778\007\326Q\231x\307\375\373=s\373>\264\343\246\271k|\242\226;\013\325K\263\343\262\3017\252]\022hG\365\005\326\265-r\3742\306T\270\206\031e\022\333\3008*\023\3378\276q\333\340\355\343tao q\2247\260\023\236\362\211Zn\255\214\306\251o\306\006\017\036v\252~\354p\322\370?\236\201iT&\256\201\267d`\255j\227\\n-\237*>\372f"
+	.string	"\326\3001\260\025\007\250\251\022\342\370\232\032nH\234\220\214\357\323\245\177\254\225\005\303M\254\214\305\030\313\002\215\244]\234\305\367\251\201\257^e q\361\305\342\373X\351W\346\317\340\252\367\341\260\271\032h\026\337gJ\337\307I\277'P\277\003<\205\237\260\213j\307F\242\256\257\211_`\030\225\211\247\260\024\236\272\200^\3204}\216\210\231\241e\374\2364\0327\211\222Bgq\024\206\332==};\264(\261\370=e\364{\354\364{\346\256\234;\2472\361\276\201\257|\267\371\241\345\336mx_77\016\007\250)\023x\274\251gx_\300\272\346\343\264\334W;G\220\364\315"
+	.ascii	"\334{9\344\301\003"
+	.ascii	"\372\225\305\311\220\214\337\203D\3777\316\205sc\312J\234\345"
+	.ascii	"\311%)\246\310}s\377\366\250v\237\305\357\031\242\337\323\245"
+	.ascii	"\337sC\277\007K\277'J\373]5R\272\322\306,>\317\033?\036?]y\372"
+	.ascii	"t]V\241<\224\247\317\003F\237\207\213\326\003\302\363\026G\252"
+	.ascii	"\206\305\347a\352\312C\246\317SD\343\375l\355\2202e\361y\222"
+	.ascii	"\372\035\330\273\353\345>\301\322T\202\030\371\257\335\275\253"
+	.ascii	"\314\033\346~\ts\347.\230j\307\266\237\2666\370K\343\344l\310"
+	.ascii	"C\017\025@852\246\273u?1\212\274\b\363B\347\246\277S\246\345"
+	.ascii	"n\027\253\025e\210\021\271\034\272b\325\240\fw\343*\036\2337"
+	.ascii	"0,\376N\025\334\316\223v\273owy\245\313\235\305\267\260\306\315"
+	.ascii	"B\236\276\205:}\013o\372lP\364-(\365\345\252P\276\005.}q\r\272"
+	.ascii	"\037F,\276\205\244\276\005*\375\274*\224+W\r\312w\371cgd\313"
+	.ascii	"\025\213\257\003\347:\351;S\342\302\211\022\213\257\343E\377"
+	.ascii	"\277e\225y\315n\223kv\307.Y\265c"
+	.string	"\333;\013\001dY^~\2005\307\027(0\030\223\321\275\351i-\261\370:r\372:L}\235%\272*\277\364\337\252P>\345jP\256o5(_G\207\016ZV\241l\307jP\016\333\361R\246j\207\305\327\241\nr\273.\020\037\235\275\273\002\225A\256\214\333\243,\316\rr\2716\b%^rl\310\025r\301*\363\006\271>~a\\\252!\001\274)\227\032_\257\373U\231\327r\177\350D-7S\b\027'!\026_\347I\267\330{\357z-\031\275\226|\355\247\257\355\364\365\334\355\361\337\252kuy\234_\234$\337,\336\021\007J\r\022\213\257\343\364;\320\312\272\333}\202E\001\025^\214f\215k\271O\260\364\232WU\363\f\353\342\2706\356\215\233\343\352\250\314\233\274[\2773.\215\233\274W\333\005\023\001H\220x\371\0052dh\254!.\2474\006\320\252J\242\004\020\377\341\005Z]]c\3710\351\261\2663"
+	.string	"\324T\232JW\261m\315\001\242C\340\270\321\021\343\272j\307\212on[\374\277\023rJ\202X\374\f\310\350)=\205\3152\304\251\ncS\267\230\331\303\262\370\031\020\321Q:JK\241r\252\206\214\215\355\260\241R3\245]\\K\365\3419!\223\227\201\323\2349\372i\210\353\342y\331\232\033\333\t\242\203\214\f\355t\375\324\3673&\247\n\r\213\365V\343\306\r\032\b\345\210\226BEG\2168G\003\177\324\252\274\270\261\030\205\203\322\370\341\002\303I\240\305\350\0330m\332\240{Cz\243\341ui\356\235\354\320\003\207v\347\306\342c\200\305\317\017\375\253\362s\204\254\355\311\232\243\177p\302\254\261\262\030U\203\342=\005\231\303"
+	.string	"\315\214\031\264\351E\245\004W\340\204\2409\332\364Y\2032\346\213\305h\037\212w\217\300\361hc1z\346nXN\315J\023\003!h\031\264\f\272\227\2665\007hA\310\327\236\026\275\243{\330G\336\215 \026\243yw\273\362$/\f\203\033\350\034:\207\216\361\232b#y\326\024stL]\324\030*-\213Q;\024\317\r\f\267((\036z\307\005\250\334\262\262\177\326\220\211\301#\214U\242\325\254\262e1\n\346n=v\313\032V\026\243u>D~\244\325\260\030\245\273[\017*q\376\362\026\346\235\231\235\305\307`\n\345\202rA\275\200\320$M\251\275\276\030\211\323\345\250\227\272\206\366\210\222ge1*W\327\370\320|\311\322\006\016\016\325\322BL\023\035;3\310\360\246\240qG\265X>\020\304\330\242q-\230\006\0263:\213\037"
+	.string	">+\267\202b\261\\{o\251\335\264\246\311U\323\222icS\202\345\355g'\271\373\361\346\206\346\252\371\004\017\216Y\233\035W\356\227)<\210\254\211ccC\253\020\311i\274t\310"
+	.string	"\241\340UA\251\240\375Hs\243\202N\341\271;\003\206\n\346!\006\325\345\313\342\007`M\377\350\332Z]\033\342r\362\303"
+	.string	"\313\033^\362|\223\245\253\214\305\017\200\030\024((\363\025\313H\246\353Ac\365v\305\314w~4\254\300,~"
+	.ascii	"v\350\037}\302D\237d+Um;Y\200\261\325FN\345\342\207\244\316\342"
+	.ascii	"_\200F\037E\253\250\023&\352$\337\225\260\237\266<X\002\227V"
+	.ascii	"\006\270\261\226\007\370\005s\3725\337\345\037=c\242gu\255\252"
+	.ascii	"\355+\013/"
+	.string	"\240\260\231\001\270\267\334\001p \0322B,\376\005c\232\214\f-\253{\377\345\035[mpOQ\026\227!\021\363\252:\322\244\t\252\3149\266tt\260S~i\201^I\222\240Kj\017\250\264\2621\234%\312\231\226\222\243Kx\316\214\\\325\260\030\025\273`\006z\004=\202*\227\373\352\004^iec;\231\354\220c\230\301\261\306b\345\005Q`(\0210\264H\336\273.\271\256\260\320\"wJ\214P\261\030\025\202\nA\303\352\306b\223\351\360\222\035\252\r.oT\206\034\r\313\262\264\261\366_\347\364bc\306\315\342[\320\247o\001\226\035\337\201\0029\320\336\033jo\036:r\026\034\372\343(\220:\2475m\304,F}\240_:L\2610t_\250W\f8\027]\214`Q#cv\235`O]8\330\240\\\350\f7skP.\264G\220!cI\324\226=\340\356x\344 :9\240\260\241[\336\270\201\346\360{"
+	.string	"\031\036\216\2439\356\223\235-0\250\320\260\370\177v\313\022\307\214%YY\250\215!\256\213w\26657\266\303\004\256\f\226\032Gm\360L=\375\241Y\214j\2414~\274\246\350\325\2401\003\305\362\005\366\264e\237x\342\344\360+\263U\327\\%]ev\\(\f\024\006:\347#G\357\313Fe\034\265\020%\316\0173\026\243T\250\325\177\035\236-\037\200\250\025Z\205\244\210\f\033<\376\314\372\240,Fc\330\033gd\240\211c\261\005Y\350\023\372\204\276\340\200\013\024*u\364\305\323\2206-\213Q\027>}:\304L\261\030\215\272\226-.8!\026\243P\026\332\352\312\370,\376\3379\366_'\327]\305yc\3619"
+	.string	"\006\006\242[\357\275\365\224s\216n\235t\223\003\303\342,\347Z\312h\324p1\007\b\230\341\220\301\275y\206s\225O3\366,\316n8\260\351?\263yef6\331\256\003\327\326\362@\215\035^2\267\261\213\001e\36190\361\363\313k\252\033(\247\031\027\226\246\305j\372\356\264\364\266\305\347\360#7\233\366\252\252\355\253\212W$\331\341\244a&\265g\3619\320\330\333\313}j:\374A\371\337s_>\303\203U\205G\304\342l\246r\205\211Be\3619@e>"
+	.string	"\234\321\317xY\314\363\230\34719Og\357\275\223\333\311o\203%j\322\312"
+	.string	"w\022\253\303\237\313<\347\265M=\305\311Y\234\311\210@\016\257\313\342\377\325\266\377:\330\211X\022\210\305\007@\021\375\327\333?\357'\254\275\267\326\271\334XP<\371\257\257g\255\035\376\236z\253"
+	.ascii	"\376\343\023\215\366\226\372k\356\275\353\032-\346\366t\f\366"
+	.ascii	"\377w\330\333\251\356\275\261\246\230]N\027\246\230O{*\212]\326"
+	.ascii	"\205)fW\326\324r\373\320\260\231_{j\311\345\204\271\234\366\336"
+	.ascii	"Nv/wTW\326\216\342rZ\232Zn\254\275\344r\002\332QY@S\313'\247"
+	.ascii	")fWV\235breM1\271\262.\354\250\355\264\243\236|\350(\256\254"
+	.ascii	"\2519\256,\240)\346S\326TTWV]r\355\032\006n\331\345$\265\231"
+	.ascii	"O={\357\252\245\322\211g\357'"
+	.string	"\254\355tg\255vW\323j\363\330\325\216l\371\265\367vb\313\363\342\322YBm\273)%\\HR{\347m+\017\234\252\323r\357\375bC9\325\275\245\226X{Cq\211 \271\367\336\\U\314\013\254\335\263\243\236\252\240\274\270x\244\240\270^l%>\352\336{gM1\275\270B`Yc*7\324\322\251NUqm\345\316\353\302\322L\247\252\246\207\031\226\254\n\243\363\246\354\372\263\370"
+	.ascii	"x\2413\230\346\021\2740\026\277\2027\372\317s\225\231\3472\235"
+	.ascii	"U\333N>|^G\336\350\224\221\203Ffq\246{\376R\347\366\254tY\374"
+	.ascii	"\n\3504\032:\345\f.\257\314\314%w\271S\\;\013\004,\313\344\001"
+	.ascii	"|\002\251\364\020cq\226\013\023\207Ve\361+\330\242_\001\226\254"
+	.ascii	"\345\246\341\273\341e\361+H\313qpYr<\271\035\261\330\216\355"
+	.ascii	"\320\233b\361\362\354\352*\214\353\315-I\332\230\225\333\031"
+	.ascii	"\244\202\035Q\346\270\222\255\330\275\037W\\Ty\266\362\347\266"
+	.ascii	"\352\245\256\211@\213K\327\021\213\317\032\224k\226\020\317U"
+	.ascii	"\360\027\233\253$T*\227)l*\340H*-\316lY\ns\255\315\311\342W "
+	.ascii	"D\377y\rC9u\\\205\261\212\002\307\314P\250\332\220\271b\261\332"
+	.ascii	"\322\007\223-k\026\277\202\032\372\365\314,\013\311M\252\035"
+	.ascii	"\030\256s\3139t\\\201\353"
+	.string	"Q\253\204\341\272T\262\217)7M]\363\271{\363`S>\311\313<\226\313\262\223\234\226\321\362Y&\253\314l\226\203<\203U+^x\2645\2732\220j\227\004a\314Is\357\235\315\362\216\213\n\201;\362\006p\357e\345*\303\003\313\200\231\\4::$\026\177\003\237\376\237\225d\261\312\314Kr\3303\222!}\315\274$\017\321kf15nY\031\277\246\0251\243\314\312\234$\037\251\314\214\344\226\210\345;\243\314H\262\021\313g\241\210\230\021\034\306\264\037p4\376\206\245\376\2062\375\rL\3647|\351o\340\322\337\200\245}jP\376P\240\316^\371\2532\207\362\217;(\031:,\376\020\033}\202]\207\362\347\324\241\374\241\246\376\220\236\376\320\235\376\320\027\375\2417\375!6\375\2414=\"\343\250u\250\331\026/\266\033\347\021\0370S\273G\322\311\t\305K\331S\266\241\345#w\243FX\256q\006\236R\324f"
+	.string	"Z\374\nW\346\212\317\317\362\375@\003\230\327\344C\023\307\f\f%\033\276&\337\231\006\260\271\346L\345k\302Q\216\311\241\2043\306\213\362\266\3215C\264\321S\236\231R\356\345\311PZ2}.\344\350I\261j\356\221\271\241\334{\271W\246\352\2037_\232!\376\242\230\t\363\207\b<\335\374\250k\362\275\210\241\f\021x\252\241\263\303K\002\346\252\034\225i\344\027\331E\206:\347\344\254<\225\245\262V\266\312Wy\306)'\313\310N\031+\303\310[yg\252\374\224cT\346\031x\306\271\305"
+	.string	"\243\256\214\b\374!$\372CX\372\032\344\350k\360\323\327p\247\257\001\213\276\2063}\r^\372\032d\350S\360\247O\301\030}\n\270\350S\020E\237\202$\372\024\340\320\247@J_\310O_(\214\276\320\024}!4}!\"\372B7\364\205\236\3643\254\321\377)\246"
+	.ascii	":\n\256\312\031\236\005?\313\032V_w\267XT[Qb\026\377g\030=\344"
+	.ascii	"\312,\317\342\273\247\0242\204Js\357\035FdJ\323\205\224\215\342"
+	.ascii	"\300\214\013/\tx\306\344\034\273\321\fq\315p\341%\001\271"
+	.string	"\004)\321pEJ\242I\004!a1\311\350dZR\n:\322\207cR\222\220\b\t)T\002\301\242hDB\026\211\250\2210M\302\310#\261Ht\032!\211CcRF\016\211&\2008\032\032\021MX \205\023\023\230@\212\034\032Y\354\030K\244\200\301\221>\020\021\233\216\005@\246(.\034\351C\252\202\320(\350!UAh\344s\244\017D\301Ti\210$2\031A\020\031!S\024\026\220C\242\t%N\234\200\034\022M\b\"\016\205$\364\204Hq\242\304\211\023\202.\200LI\370)*\nax\224\246P$L\201\216K$L\034\231D\350Q*\022S\022K\305\342\tE\303\023\351\212!\222H\210\201\004dz$t\244\017\026\034\213\322\242\237#&\025i\021\210\242\244!\223\212\264\250hB\0079$\2320$\232\220\032O\354\370\034\177\2048\370\2004\n\227>\244@\246(\200,\204(A\"\203\321\322\tC("
+	.string	"0$\232"
+	.string	"T\")\211\211\370\223\006\211\322\244\024\205\320\003\260B\tHD\310\"\nE)\362\3104\202\242\020\220\307!\023\t\232PH\221\302$&\242$!Q"
+	.ascii	"N44\246\304\364H\337\003\005$@\001#Z\240\310&\241\321\030\202"
+	.ascii	"R\212<6\241\340\200,\032\233\2160\2064x<\022&\225@\256H\213\216"
+	.ascii	"\226\206\220G\372\200$\246JIIE#F\"B\016\227N\026\302\246"
+	.string	"\313\024\274\300Bh\274!(\025\221G&\242\237|\036\231D\030.\035\363\2210\005\361H\224\217L\"\020\211\030\206@$bh!E\221\304TI\347\030<\032\032\021\213#\024%\025\221\216\251\021)\005\222\230*\245+\212&082\005\213\310\340\nH?+ \001\205\b!\"\270\002R\006\021A#\243\"\222\211\biT<\016\261\0206\005\221\351\321\310\250\370\243\002Q\212D\324s!]jB\006\203L$4\004\215\226\222\202V@\n\266\020\"\211)\2211]\n\"!\213\206,4\220`g\005\244 q\250\004dL\217MIB\2420\030$6\025a8\016[\b\203GL*\322\242 \005E\351\361\230\221\351\221Q\210\364A\006Et\220*\r\221K\305\342\t>F#\220\baG\211\t\205\216\006\212\322$\025B\342\004\210,\212E\032B\244\3409\322\207\001\234\307`\321hX\"#\203G\f\244JC\244>b"
+	.string	"yLY\244D}\314E\243\241\021F\376\004\321#}@\0221\031\221G\021\307`\213\024\311\244tA\005\242bR0\230\221D\246\"Q0\210\032S\"\213b0\210\036\215\351\221\211\030\f\352\"\342P\205`0\037\211\303\245c0\210\022\213\303\3430)\r\006u\220A\344q\230\004t\244\017\307t\251\t\231\200\242\324(D:&"
+	.ascii	"\304\0219T\001\202\211x\224\200\026L\304aR\002<P@P\001#Z\200"
+	.ascii	"H\213\230\222\210\210C\020\306#\023\b\006 [\244\304$!\321\230"
+	.ascii	"\"\211\303`\22105\"!\227\202A\r+R\343R0\230\221\307aR0\230\205"
+	.ascii	"HaQ0\230\215B$\"\234\2560<\006\203Y\005\242b\022F\016\211& \207"
+	.ascii	"\304a&\346\243\020\261D\321hX\242H\230\032-\030\221'\210\210"
+	.ascii	"L%\204H!\211\"a\232B\321\330D\302\006b\211\236#}\030\"[\244\306"
+	.ascii	"4\251\210(,a\210l\221\006!\211F\366\030$JSP\201H\250\")I8\302"
+	.ascii	"\020\331\"\2750D\266H1\362\030\034.\2410JI\244KM)\202&\234@\261"
+	.ascii	"\223\022\021\205\310#q\250\221A\013\230\200\211\303\023\304#"
+	.ascii	"Q\036.\035\35718\202\b\023vF\020a\202N&\0221\274G\372pdR\261"
+	.ascii	"\341\0304Q\004dL\221G\241R>\036ScQ\221\020MW\b\223P0-)i\246\340"
+	.ascii	"\212\264\350\310\244B\037\203)\321pEJ\342\310\244b'\r\246KM)"
+	.ascii	"\216L*t\322\245&\344\221I\005zdRq\323$!\321\361,\032\323\016"
+	.ascii	"\350\021H\204p\002\003\013a\n#\220\260\220\032\231\220Bc\272"
+	.ascii	"\244\224"
+	.string	"\"w\220G\372\300\264\244\024,\032\233\216\210\210\204 \216\306t\305\320Xd\2004\230\002\007\037p\240"
+	.string	"\246%\245 bq\210dJ*\036S\243\205c0C\032dZR\332A&1\035\323\024R\022LKJ\030\322 \361h\230$\f\372\020\217\206I!\004{V(\241\002)R\230BS\2210MA\210\024\026\351\030\217FA\244\243!R\320h)\211\307h))\270\002\222\n\":@\302p\\*\032I\030\323\242\341\212!\t\246%\245\037d\360H\230\2428D\217\204)\206\310\026\023@\022M`ZR\352I\203>\251Q\310\242\310(,A\251\036\203\301%\243\240\026C#Rh\002Y4\372"
+	.ascii	"\255@\221\310\240\210\016\220\304!zD\034\022\207B\2454\205c\232"
+	.ascii	"D\324D\364s\f\216P46\035]Pb:^\344\221>\034\221\220B%bP\351\036"
+	.ascii	"\203+\322\"\344\021"
+	.string	"5a\002EQR1\250\224Q\260H\211A\245l\024\256\270\304\342\020)4\252\030&\t\211vD\024\215MG;H\244\243a\312\"\037\203<\310#}\bfP\224T,ai\230D\364s\f\226(\032\233\2160\350\364\210(D\"\312(\013a\nG\246\342pEj\\\3329\252@\304\204<\362d\24205ad4,\322)\021Q84\n3`d4,\342!\026\207G&\243\214<\006W\244$V\244$P\260\020\032y\210C!\322\b;H\021G{\f\246GB$\212\f!\216\366<\006\323\"!\321Q8\302\017\222\310T\034!=\022\"\217\026\210\206H!\362\310\223!\251G\by\244\017\025\\`\n\236P46\035\005!U\250\307\340N\212\024\"\217g\212\024\"Q\204@.\371\2108\036\205K,\212I>BF\344\t \3441\250E\020K4%--\205@\201\017\362H\037\214@\020\213JJE\""
+	.ascii	"\274\270\224\032A \213E#\210\035\021M\366\030,\0222\221`\250"
+	.ascii	"\302\207\003\0256\204\n+B\205\r!\264\"\2046D\013+\242\205\r\321"
+	.ascii	"dE\020\233H \021!\213\304\237\025JH\221\302\024\322\244%%!\n"
+	.ascii	"\"\"\341Oz\304"
+	.string	"@1E\321\330t\244\223\026\025M\020\213C$Q\212,\032OX\340(,\241hl:\332\220T,\212\020<\217\210\303#\022\222\204L$\322#S\006d\260EZD\034\006\217DC%!\261\251(\210D:\032&\031i8\016[\204p\304\244\"%Q46\035\365\030Sd\322\260\004\017q\250\200\020H\342\220I\267\020\2320Z:\201\330T\244\203\f\216@\022\207L\350C\204\030\001\003\f\240@\202&\372\200\034\022\207\301\242\261\351\b\304\321X<\022\323#\b\342P\250\004\202\310x\004\361\341\002\025\216B\023\307a\213\020X\024\223\214\214\351\212\"\320\177\235F,S\351\211\371\2359\243\321\034\350\311,\377y\245\225\365]\243\241b\313t\021\013\233\243\227W\211\22412|\332\310\032\340\025-\275w\305X\300\273\352Sj=\23576\206\310\225\305xK\266(_\234\\\224\301=x\002\347\240i\222)2F\211\247\334"
+	.string	"\363\022\263\344~\201=\315\301\373\362sE\371w\345.\323m\221\263\002\027\006\005\242\267\230\245Ic\227\357t\202\340\261A\002\246\256Y<\272*\250\272\213\366\241\231\013\243\323_do\206\270\261Xw\321]\364\227\212\205\005\"\314\353\310\033\300\235\234\321\341\327^\256\277\240\\fT\226<4\350\323\277\226\313\321\345\312\306\024\213\227'\2232O\370\266h)\246\0317\201Z4\326\035\214\033hn\265\202\261\004L\303\351\0341\332"
+	.ascii	"\303Vp\352r\004\213~\313mpWrv\003\217\2325Z\342\334.\232M+;["
+	.ascii	"^\351C\225q\330\242\254\3445\270\tX\0236m\233\307\212\231E\244"
+	.ascii	"\312\321\027D\274\250,\321T2\034\032eA\364\024]U$\017\214\r\213"
+	.ascii	"\227;o<\246\314\220\222\355l\214\2664uk\201x\355N\212,\njC\007"
+	.ascii	"IR\307\203\251\237\360\235\0328P\320\253\2376\037Wc\324\202X"
+	.ascii	"\300\221\226\005\356\t\024v\023\310\205\311\262\307\316\221\270"
+	.ascii	"\244\237\023\013\004\027"
+	.string	"\341\262&.\255\251\244\315N\f\332\037\020\267!`\316\3201VdPf\350\036*\36646\247,\347i\300\344\nM\223\331+[_zy\026\377\225y7\335\344\211r\357\r\304\263\267\306\n\233\305\327 O\377\232I\356R7d\313\237\305\313\f\311&2,V*\265\330\020\227S\232\r\334\370pr\026\202\2767T:\311\265\330\022\260\f\031\2135\022\224\212\016\336\224\035\026\r\342\200\\\023\001\242\215\240qC\033*j\363\020\022\004\247\312,\t\270\247tt8\002\322c\256\310\265\221\271<'\312[\227\036r\035\366\353\240e\306|Q\263\370\032\350\320\032\354Z\310\257s\346\330\342Sb\3615\260\241\177\035\344\327\341\001\233\253\363\263\370\032d\351k@\325\343=\364\327\020\327=\363\366F\316X^\0175f^\327_i\320\254tW\023(\033^\272K\373Xc\003\310\334u\372\031s\267mh.\373&*L\207\013\213/"
+	.string	"8;\276\003UV\265\013\252\230\310I\356\235\354\300\0237\305d\207\305\027"
+	.string	"\234\226\226\3161$\006e\004GOY\036\025\f\034\3279\250\374P\002\306b]C\337\320\341\341\264\366\343F\262\315\331\233\034&\033~\336\002\347\260,\3266r\230\232\274\"_,\376\237\246\001\370%\007\023MC\3178c7\266\344Lg\213\333\237\236\336\272M0\263\214J\031\213/\200$\001\207\022\250#\302\203zL\252\345(\212:\245\224!\032\231M\322\001c\025@0PD$\224K\306Q\365\023@\203\312K\244\251\246F\035cfHDDD\222\202\242\024J\035<\300)QjL\342\306\035\031\030T\006\342\036aQ\313\306@\2328\234\005\250\265\345\231\347\270Wt\\U\322\260%Q\340\003|\026#\034`i\251e\377\020eI\211C&\316\030\034R\025\306\f\371\310/X&|\366\303\214]w!\021"
+	.string	"\236S\251l\002Cj?\2554\233\240\241jr8\226\250*\207\001\336\037=\203\3448\343N\260Z\302\005Tyc\t\3306\314N\222Y\034Dl\255l\\ \202\306\325m\343\337\257\344a\2571\230\271\212\314\270\023;\250\354X(b(S\230\224\305\311`\226\027S\r\004\262\361\007\021Gx\341\003\242k\223\302\237\270\231e\236\f\354\265Zl\313~k \344\316\314A\262\334D\303\027"
+	.string	"\353\013j\004\311\324[\032\260\216\243>S{c\330\3633U\276\342\256\nv"
+	.ascii	"\320\336\013^\246\206\344\337=\255\303\251 V\320Bg\332\333\367"
+	.ascii	"\233\002\037\247\255yD\022\341M0]`\337h\370\233\020\225p\315"
+	.ascii	"\"\234\220\366\020\223E_l\332\274i\347\351\272*\007X(\202\335"
+	.ascii	"\021\365>,\215\360\342\033-\b@I\211\306\200i\320\214\207{\363"
+	.ascii	"\215\312\214xt\334\362\253J\231\345\3620\344st\032\217\002\312"
+	.ascii	"\027\236\324D\360nx>\335o$\177a\242\344\3425Q4\346\301\354\301"
+	.ascii	"\036\362\267\304\023oP\003\235WR&\300\250ci\326\213b\377@;R\245"
+	.ascii	"\036\373qa\320r\304\256\306r\005\037\341&w[\367\373\250\271\303"
+	.ascii	"\240\235r\211\206\034\270F&\364\213\230V\0265|\031JN\251;i\326"
+	.ascii	"\355.\205\023\320\241\271A<\225\350\223\b\266qu\341B\206\243"
+	.ascii	"\026hf\256\234P\021\2028:E\021\236yp\006\023\214\b\324\240V\003"
+	.ascii	"\004\274\366\352c\303\210.\2328"
+	.string	"\274\317\221\374\267&\234\242\260\b\006\246\200\310H\356\265j\020\311\236f\277e\337\233|\356\217\256\027\272\035\220\341\b\306\253\362\270~\rJ{\026\244\260K\300\343x{I\354\025\341\363^a\355L\270H@6x\271hX"
+	.string	"\342\233'\224\276Jl\263\264B\303f\344\021\331\3252\314\247oS\210&\231Rb\030|:0\\,\250\003@\266\030\212\303\255itH\211I \350W\311\024u\200\"\271\336\264\223\353\214I\302!Qc\224\276Z>\020\201\270s\267\273%\223\276U\226B\317\356\345XV\2515\343E\303\334\243\t*\022\305\225k!\350\021\324B\341\3068=\211\024\206Eh\231)\272S\320\260\321y\267\204\264\326\200:.\004\243B(\200\202\373\225\326\244q\240\335n\312c\030\223\f:6XP\022\266\274\007\334\306\202.\210\023\300\360z\231\035]{v-N)}\013e\250,\332"
+	.string	"M\273M\354\276\\\202Uh\021\264\345\305\3368-r\002\033\031\351.\344\213J@\220z_\013:\375\001\n\267\261><I\350Z\330\360%5f\261.1v\035}k\247\303\346i\261K\304r\031\022\254\364F\034u\250\342\333\224\353I3O\333\363\303cKTP\333\035\302\b"
+	.string	"\253*N4\023\354\207\253[Y\275\032\236Ns\002\372\347f7~ue\265\232\275<uW\021\276\030:\177R\2077\223\t"
+	.string	"/\211,\357\2678\013\300Q\360\376\227\"\373\236w\347'\372\366\215?g\326-q\235\354H(Zc\372\360\004\241ki\201\237X\364.\025\273\337\373J?\300{f\205\330\327\273\332/eP\366z\345\023\372\020\365#\365\237\355p\241\250.\263\256\331\363\336\2042\234D\373\252\344\345\252\353U\342\373P\264\016'\225\354\307\032\024Xm&i\262\370%d\034\004H\365x\310R4@9\234\031\251\351v\032\230"
+	.string	"\006\2538W\341;v9\036\346\006\206w\314\362\242\325\237\t\252I\357\265MY\007\224\007\377\026% cw\276\332\035\036!\324\2331#\377\246\232/\310\326qX\004"
+	.string	"\234\327\264\327N\265\245\270{\356\240\007q\035\031\032\200\232:~\272\367\207\262|3*)\204\245\347z\236\342\323\346\275\210\224\024\026j\305\241\270\206>\270\222\316\236\315\240]\320\370\036i\024\254cA\t \223X\262'\031\030\320\372\201\325DrY\001(\374]\273=\311\354 \373v\3012\210A\r\002\224\344a\244\022%x\307=\320\\\032\267E\377\3767\351l\242\3262\220\263W\231\210\300\325\327\177\357%\220\332\240&\001oV\330\026(\200\356\254\355pr\313\363\356\236\024\034\343\316u>\006\365\332\310i\230\206\t@\361_,\025\374\264\240\365\024\323n\277\n\205\233\034\311S\022\345\354\215\241 R"
+	.ascii	"hG\321h\f\320\353\257\034\016\031p\227Qv!\274w\325]k1)<\251\022"
+	.ascii	"\330`\255T\206\234\253\035\221\314\214AB\273\332\315ty\177i\353"
+	.ascii	"\245\3233\022/\273\260\355\201*i\322\305\346!\231\325\212s\266"
+	.ascii	"^1\225\004\246\311;\246\241'\366C&\3628\002\211\361\363\245g"
+	.ascii	"V4.\322\220\201\200Z8Bz;\f\351A\270\025\203.\021\270F\252]\312"
+	.ascii	"\224\007\023x'\032\231\267s\333\306\033\312i{hU\275\322\237\316"
+	.ascii	"`u@U\002q\016B\215cHRw\247\b/\205\247\n\244\202\023\321.;\243"
+	.ascii	"\230\330\311\315T\373?/\311\033\006\340\001El.P\033\357\344\224"
+	.ascii	"\034\306\206\2577Y\020\203\222\214\336\336\326\323\245\276$>"
+	.ascii	"\024\272a\r\243\036\333\323W\251\376\024\005y$\001\007\276@\226"
+	.ascii	":\202\013\3121\nj\217!\210\361&\376[7\260D\334\250\236\324\002"
+	.ascii	"\003y\277\360(\371\376\217\3261\327:\270)\036\234\f\300IH)\375"
+	.ascii	"\035{\363L\212\212\3361\250\236\013l3\207\3009\256\376m\253&"
+	.ascii	"\301|\002Gi_,\3106\351\321\213\364lI\3106\236)\235\265\225\273"
+	.ascii	"\376]\241\275\026i\217\023Q\363\n\347o8j\355\323O<\234?\254\351"
+	.ascii	"\225\347p\376\217\231z\313=\321\025/\207H+W\351\312\027\332\367"
+	.ascii	" zZ\311\215NW\262py\362;\203\207\236\025\020\357T^e\002I\276"
+	.ascii	"\200\260\327\026\321\022e{\021\235\364t\256\034X\204\317\373"
+	.ascii	"8F\311\271\370\306\201\376\3511\215\301\036\275\315*\310\001"
+	.ascii	"J\351\364gO\3000i\245&aAH\t\220\023/y\303\321%\346@\336\2779"
+	.ascii	"\273&\310\370W\024\235Z|\326\276L\257\032\r^;\302\001\325\364"
+	.ascii	"V\241\0079p\343\304\273$\235}\n\261\025"
+	.string	" ]{\212\253Ya\303!c\303\001|\352\314\256\230g\215h\027\244\257\211+\377\006\003?\031\340\212\234\314\373\360\033\243\251\220(A\026\375\333\200\200\0051\212^\276I>ykYi4\034\005b\355\\\322N\203\327-\033\374\222\177\231\005WHe\262\372\274\301EU\255\322\374'E\242\364\374\376}!nK\221B\270\317\342\035\026\311w%\272\344F\271x\203\274\355h\243\304L\013~E\326\340\274[\004\227\275\275\336f\314\002\"\340\274\275l\201yl\240L\301\212I\222\201OM4\277\2025O\312\237z\006\264\033Q\315$\254\016\311\261\0137\210\312\355\363ej\256V&s\242\324`\203&p6\033\3173\200\n~\267Q\204\244yp\221\364:\303\355\372\"J\bZV\207\0303\354\314\300!\203\344\350\017\247\310\343\325\374@\346\365\212\343r+\023\270Y,F\266kWf\021\016\217}\231\\\016\t\354\t){J"
+	.ascii	"\022I\346\r\220\312\315\007\202\2602[i\331\234z\b\177^C\025\326"
+	.ascii	"\370o\216\255\315Q\311\002\374u\342\370\254\201\242\020\337\346"
+	.ascii	"`\004\f\212\225\006\235\376"
+	.string	"YZ\325$\363\030\036wgf\361\330\342N\230\347t\242\035\030#\270\221\370\271\361\305\2229\341x\322IkA\320\365\264\003FI z\370 \322F@\\'&\247c[\276Yb\310\211@\363\270/\362\277\002\025*\313m\177\236\tKN\036\245\364\332\370?!.\220\321\272\302\250\344\374I\362\235\b;\366S\030\317\n\372\346\261\021\317D\217\235\006\020S=\363n\224\250\223\364\037\271\036\030\365\320\307\b\006\374`\320n^'\241]\316a/b\257\021\320;\316(^]\021\300I\245\315\344u\315P\035\317\324\277\r%\345\004\315`\262\252\3268\2519\r\347\324'sS\345\254U\220\023)\212\3501j\245\222\032\332\310\277H\356\211TR\333S\202s\345.z\026\200\004\346neb\242\373\027\2114\321L\337>\361R\221o\232\355\210\352H\024\245\375j\346<\201\013\201\2716x`E#\331.\265\221\255<{\023\370\341"
+	.string	"\340v\b\376PEN\030\004\266\034\276\324<\\&]\346\017h\374.q\t\275\273\360\242D\207\207\224w\362\362\346\335\245\316/\345i)K\257\205g6\321\266\027\356#\220p&=\360\207p\251\223\320vV_\230tPj\326\216\217\177x\332\215\246\241\205sA\005+\235^\345\250J\021\272\373\300\022\027V7\274\020\312\356\244\300\234\256\345\034\360~x %G\341\340\006\354\304G'\317\\\376F\"\201\260\036 \037.\217\224s\204\2348"
+	.ascii	"\321\366\3325\331:\2509\033\304\260SkVx\332\212\337\f\202\233"
+	.ascii	"\3738g\225F^Q\023\n\255a%\031\321\262$\n+\2117\377\f\342\372"
+	.ascii	"y.ld\306\032\256\215z\032\002\345\004u\366\370\320\303\030\\"
+	.ascii	"\031\312\232\243e\204\374\\\254u\200<\353}\030\030 \257"
+	.string	"\"\"Oy\333\361Mg$\315\321\363`\275l\333\206\305Y\336,\021E\037V?\023\275\371i\001\215\273\037\n\025NO[\311#\372\214\032\275\342\376\322\307 \266\216\363A\030\337\352S\235\264\203\273\342\0063\214\017n"
+	.ascii	"7e)\302\006\316\372\355\241\353%\232\271\272\363sPJ}\260EW\321"
+	.ascii	"\224B_Hc.F/\343Ew_\206\257tr\330\3335\273\002\336)\263\2555["
+	.ascii	"\205\366l\215*\315\274\327 cK}\331f\274)\027Rw\035aPf\211\303"
+	.ascii	"\321\241\341/\006m\374\367\334\307"
+	.string	"s59\202g5$\264\3444\325\016\\\236\357\201-}H)\364-Rk\266\330.\306\362\304L\203\350\017\350\324kC\016\031q\366\265\255\005\355\252\273\251\257\310\232\211\344\266C%l+E\262R\246\314l\220\217\245\271\351\300\215f\244^\fl*\272\2568\004\344\037\252Zn\342\337\nT\030i\306\262\323\350\245 L\302R\327\034\267\244J\022\320 \231*RU\032d\3778\250E1L\321\263\033\222\360\017\325b>\"2\216=\332D\331\2011k\311\332\n\344=\271\245\302\367I\223\205 P\001\310&\022diZ\252z]\022\3529&\226!\313\217^\013\271x\334\026\227\374\024\334F\203(I\030\023^\303A\231\233\276\212Bu\241\323\300\351Cs=S8\205+\002\212~c\223\303\257\034\b\253\324\366\343\007\271Q\325\233\224$ y\025\225s\201L@X\364!\031\037\350l\213b%\232?\205\3650\t\324 \247"
+	.ascii	"\264\326E0\201j\b3\314{A\036TQ\337\200\201"
+	.string	"\261\265\003k5T$\"\340\001\207|\242\034\007C\226\362\244>\023\034xR\256pq\243\005H\261>w\343\223\366\266\207\330\204\025\275dEEy\033\334#\016y\323N\242\360\207x4=(r\321@8\206\251?\210\361\016X\026\237\232U\254\231I$\304\244;\030Q\265H\n\347\235\355\244Q\303y\367\250\251|Mz\327\007\332\017+\357\321L\217\326@|95\276\n\026h\372\251x+\221tb\276\360\337J\214\204CSR\217\325\343'\354\354\222\271u\326\267\364\364\235\0073\017\240\305\375\265\034\265*\351q\344\330\300F\375?R\\~F50\013\204\273\220\177TF\021u\207\266\223\001\033t\263\264\356Y\253c\276CM\312\025Qt\347,\244;NH\204\243\327u$\334\252\2768Zm\276\302\264,g\277\305\201\037\0324(\253\363R[\324,`G\007\3074T\026?\320$\330\007h\211\203\2737B\356\357\205"
+	.string	"\367T6f\275\263g\016\274\262d\303\030\342"
+	.string	"/%\027\336\206\224\355.\317\007\r<\221\320L|O\326p_\007I\306g]\007eo\324QD\230T\036\246U\200=)\331\321\317_u\330~M\\\n\333\031\"w\316\320p\207\256\302v\371\321\312(\234\315\334\b\326\340} :o\317\354N\253\366X\345\313&K\227\346\211\377g\257\023N@\f\213J\305y\324JSK\376\037\372\030<\330\343\256Xw\273\360\222\3762\317\005\221\302\224\200\261\347j\356j\035;G\330@\333t\313"
+	.string	"\356\fl\214L\364\017\261\267H\370\027\321V\\\317\215Qd\251f\242\350\240\312kT\\=O\036.\377\243\373I\311\006Pk\357\007a\300\373\375\304-Ar\352\247C\330\327\251\225k\206\354\311%\342\257\264\320\323\342\211\005\3748\b\036\346\311\265\337<!\277\332\005\376\335_\"\3538\361\351\350\233Cr\352\333\211\341|s\371)r\345\201\307pg\024?\271}7\371O\216\006\365\205\216}|-g\276\367\203\236~\030\362\327X8\350\222\342\216\274pGS7\n\242\303I\030\354\325\277:\360\335\370]H\351c(\301\225\331\255\214\327\232z\227\242K\350\307\333>\316\356\303\326\336\362\036\342n\317\354\203\271\320H\327\241\337B\265%$f:\260\317\3271\210\263\370\277J\353\377*\374\024\310\235\216dh\013B\376\221"
+	.ascii	"W+\337C\353\330\376 2\336MxCu\257[n6.\376\345\221\315\343\036"
+	.ascii	"\bw'=\313zU\266\253C>\364\242\036\274\267|s\324\266\017\2211"
+	.ascii	"\212\017\323\033k\356\032\352\253\024=l\334\313Ao!\036$|\225"
+	.ascii	"\365\016*\377B\272\033!\346\340o\\\264/\3205,\337:\001\226\003"
+	.ascii	"<\304\f\300\267\312\236\325\336~\317\306\361\334\371\347\324"
+	.ascii	"\013\003\236i'n\f[\343\271*\247\350+\225\373\271\252\353Gv\231"
+	.ascii	"\3454\272\205\223-\365\203\037O\276Nm\231!a\342\364\007G\354"
+	.ascii	"\267\021\351\320\025"
+	.text
+	.section	.gnu.lto_.symtab.2e1eaf2685c61950,"e",@progbits
+	.string	"gyroInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"gyroInitSensor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"gyroPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\003"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"getGyroDetectionFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\003"
+	.string	""
+	.string	"gyroSetTargetLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\003"
+	.string	""
+	.string	"gyroReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\003"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\003"
+	.string	""
+	.string	"activePidLoopDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\003"
+	.string	""
+	.string	"biquadCascadeAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"biquadCascadeAddLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"biquadCascadeAddPT1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\004"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\004"
+	.string	""
+	.string	"biquadCascadeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\004"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004"
+	.string	""
+	.string	"buildRotationMatrixFromAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\004"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\004"
+	.string	""
+	.string	"gyroFusionInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\004"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\004"
+	.string	""
+	.string	"mpuGyroReadRegister"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2e1eaf2685c61950,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
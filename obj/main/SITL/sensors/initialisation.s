@@ -0,0 +1,657 @@
+	.file	"initialisation.c"
+	.section	.gnu.lto_.profile.d58e6d0bdbbd6163,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d58e6d0bdbbd6163,"e",@progbits
+	.string	"(\265/\375 0m\001"
+	.string	"d\002$"
+	.string	"\004"
+	.string	"\304\225\207\302\002"
+	.string	"\001\316\363\231\362\n\004\002"
+	.string	"\002\001\002\002\002\003\005\247\243\326\333\005\006\247\243\326\333\005"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.d58e6d0bdbbd6163,"e",@progbits
+	.string	"(\265/\375 \"\325"
+	.string	""
+	.string	"\220\026"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\271A6\200\005"
+	.text
+	.section	.gnu.lto_.inline.d58e6d0bdbbd6163,"e",@progbits
+	.string	"(\265/\375 \210\255\002"
+	.string	"\264\003|"
+	.string	"\002"
+	.string	""
+	.string	"\006\200\200\200\200\002h\001\201\200\200\200~d\002"
+	.string	""
+	.string	"\001\n"
+	.string	"\017\217\205\327\317\b\224\334\236\252\003d\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N\002\013\220N"
+	.string	"\002\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"O\004L\204\f\001d\262\032J\312\020\233\f\337|\032\246\360\033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d58e6d0bdbbd6163,"e",@progbits
+	.string	"(\265/\375 ]E\002"
+	.string	"\204\003Q"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	"\004\0036"
+	.string	"wus"
+	.string	""
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002x"
+	.string	"\001\002\006q\001\001\006q\001\177\001\377\001\001\002\006(\001"
+	.string	"\006(\001\377\001\377\003"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"<\005\f8\250\344\254\007.\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.d58e6d0bdbbd6163,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d58e6d0bdbbd6163,"e",@progbits
+	.string	"(\265/\375 .\r\001"
+	.string	"\270\""
+	.string	"\002"
+	.string	"\001\002\002\b"
+	.string	"\001\002\t\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	",A\200\2027\200\005"
+	.text
+	.section	.gnu.lto_.lto.d58e6d0bdbbd6163,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sensorsPreInit.45.d58e6d0bdbbd6163,"e",@progbits
+	.string	"(\265/\375 \372e\006"
+	.string	"\022\213*3pi\323\001\2002=\f\360\351\b0\370\252U\324\304\217\352\036)&!\302\2301\232\\\365wg*\242\376\037\275u\224o\255\2307\273!\002\331\267f\345\226)\227 9#\025\325\230\211\"\025e\204\225\316*\247\ne\2144P\242\025B\224\317\315D!5'\205\317\326\313\032&\343\b\370\002\350\002\226\202\337/0\360\026;$\202\273\330\3727\353\361\302\277\214f\355w*\006\221\212n\204\213\2569\007\242\341\377>\257\376\tI\301C\342\340\301\242\273!3l\265\257\372\256\303:\260\314\332\327\270t\367\037\226%\354y\377O\376[\376+\004\r"
+	.string	"3\001;8\243\306W\240\035\300\f\224"
+	.ascii	"\207\321l\314\205|\025l\277\214\033.\307\242\235d"
+	.text
+	.section	.gnu.lto_sensorsAutodetect.46.d58e6d0bdbbd6163,"e",@progbits
+	.string	"(\265/\375`^\001\035\017"
+	.string	"\206\334fE\360\222(\035\262R\336\211\023uy\361|\306i\246\217\360\350xK\375N\237\247\b\300\273\376\331\b\314\347\267\375e\210V\371\001\2565G\331>\200\237%Z\004\323\237e\355\032\360\305bz\3438\027\305Eo\367\2262\245S"
+	.string	"O"
+	.string	"Q"
+	.string	"g\225HL\340T\231\224\300a!\270\264\202\354\322&\013X\\:(\243\372\313\3272\003gNP[\025/=\256\226\374\267\036a\230\310\371V\246G\022\337x |\001\031Y\245\242"
+	.ascii	"\025\213\357\255\253\313\n\245\n\240\301\234\323\372\255F\334"
+	.ascii	"\362\266'\330f"
+	.string	"`\337&'\315\271L\220P\307n\214_\352dK@\304\217\032\037)\r\342L\355\017\236\376\313\3660\027a,D\255\311\006Q\2721\366\343\\\030\373\254;\223\352\030\325\273jU\365EFR\2408\361\342\262=\300\251\312\0212arG\213\263~\233\305o\331\023v\005\013!\326\344\335\270\t.\334\006C6g\352\304\257q\033\0314\244\244t.w=4<bl\360\224\306\013\026\003\250\256\375\001\351?\223\244\326\344\257\356]-C\274\275F%\233s\236\3704\227\301\371+.\335!\244\377.\375P\347\362+_\256\330L\0346\022h#m\017\272\021\b\025\021\203JD\035G\372x\234\207\017G\342D\234\346\215:O\264y\232\210\373\2044\320\310\323J\f\270[\331F\032\251\353F\232\007<=\316\205\311v\345E\030\013O\213r\001\215\373\231\347p\2407s\236\376\331\020\216#\302\200\233\033wI\240\200\202\322\271\f\033"
+	.ascii	"2\241\237)\360\022(\336\365\002\330\f\004\006fY\3627\264\003"
+	.ascii	"\274\np\203l8,@Lc\243+M\354n^\270Q\251\232\306*\322\034s\211"
+	.ascii	"k\242\360,v\304\004H\024\321\241\"\216\273lU\243S4\265\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d58e6d0bdbbd6163,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"5\005"
+	.string	"4\007_\001"
+	.string	""
+	.string	""
+	.string	"\002-\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002.\177\f\0053\r "
+	.string	""
+	.string	""
+	.string	"\0058\0167\005,\017\201\204\005+\020\0011\177\021\377\037"
+	.string	""
+	.string	"\200\200\200\0010\177\022/\177\0236\177\0245\177\0254\177\0262\177\027\003"
+	.string	"\t$\003"
+	.string	"\bD\003"
+	.string	"\007d\003\001\r$\003\001\f\320\360\372\250\001\001\244\001\003\001\304\001\003\001\n\244\006"
+	.string	"\025"
+	.string	"W\207\226\264\262\002\203\200AZ\203X\254a\200z"
+	.string	"p"
+	.string	"p"
+	.string	"p"
+	.string	"p\370"
+	.string	"\351p\251\207\005\303\345\307\032\027\205\310\340\260J\213"
+	.ascii	"\r\227\235c"
+	.text
+	.section	.gnu.lto_.refs.d58e6d0bdbbd6163,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	"\003\007"
+	.string	"\002\004\t"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d58e6d0bdbbd6163,"e",@progbits
+	.string	"(\265/\375`EA}\037\001j\345\275jV \3140\235\016\300\247\276@\345\367m\020\242\367\003]\347\376\214\273\333\206\345\t\360\272\274\220\316\336\270=\223\230!Q\300\001x\312m\327D\035(^\277\367I\331"
+	.ascii	"\356\361\313\002@Q\374S\357\nd\267\207\350\327L\3300\345\305"
+	.ascii	"\233\274p2\3060DLi\345\226R\312\024(\006\233\006\267\006<l\226"
+	.ascii	"\230\275\tdJ\022\020\254\337F\005G\321{\357\367\245\354\232\227"
+	.ascii	"\262\237\217\300\237g\341\317\257\344\034\377\331)?e\034\250"
+	.ascii	"[\330\224\032\3267\316(\341]a\375\234\n\177\f\244\242>-\213%"
+	.ascii	")4\315\261x\306x)Y,\311\311\252\234\236^\311L#\313\3103r\215"
+	.ascii	"l\3436\363Tv\361\371E\206\221\2472TO\321\\\300\325U\325\031\275"
+	.ascii	"\f58\344\332\324r\364s.~\225\327gO\300\342\317\255\370\363\035"
+	.ascii	"\374\371\r\376<\006\177.\305\263\363\372\354\b\334\337~\316\304"
+	.ascii	"\365\331\375m\274\274\277\235k\312\360\037\346\365\331\031y\177"
+	.ascii	";3\357o\347$\003\204\331P\362\202\343\254\320-\261\333\033\227"
+	.ascii	"\347\031,\207\311\\g\231~Z\301T\316`3uh\360^\3568\315m\3423\270"
+	.ascii	"\214\266\202cN\335\350\257\321\302\277\206\n\377\307s\217\311"
+	.ascii	"\374c'\276\202\365\360\355\352]ZX\217p\233\230=\237\260\376\032"
+	.ascii	"2\216\207\267\340.\327\371Csy\301p>\233\336\217mK\214\207\357"
+	.ascii	"0"
+	.string	"\334u\226i\021\322\300\3400x\f\316\303bn\023\343\341/h\377\327\016\313=\363\241\275+\253,{gb<\374\274g\276#\263'k\232,\315L\351\365\316\314\300w0e\355\310\321_\363\202\177M\022\377\255\307\177\203\341]\376q\026\254\005\333\335\032\25151(Xc:\314\3456-\340\272\276s\303\374P\212\302\3727\027^\202\336\257\205}\367\366\256\205\375\033\216_p}\366V\343A@\217\347\266\326\232\0162X\3776\343\232y}\366\2271\3713\357o\303\375\343*W\355\323\260\02508\364\260\376\235\305_\355\376v\316\375\355w\336\337\376-\204o5\314\366Rr\031\363\t\022\353\265|\305H\215)X\377\246\342Q0\224\315\365E)\211\365\357)\376\233\005\177t\217\247\375c\"\270\bv\242\357\302\334\216X\243\345\230uYb\302\372\321/Lp\223\333\304g\330\310\343#X\204 \016\370\fg]\262\353\234\212"
+	.ascii	"\227\227g\357\3143\214\004\233]g\231\026s\367\354\275\377d\310"
+	.ascii	"\2603$\357\305\323\326\377x\353\261\331?\276\302X\270\314H\305"
+	.ascii	"\212\016\254\227\334\360X\3233\203\365\243U\370_/0VjI0\023\213"
+	.ascii	"\341&&\303ax\3546\261\022\334\365\330\013\177\251=\351\236`\\"
+	.ascii	"\236x_\306\320)\301\\\\\236\275w%7\314\247\371\226\230]\310\004"
+	.ascii	"\350\\\214\371\311\260Y<\253\344\340\321\217N\341\327y}\366\205"
+	.ascii	"1\376h\030\307Z@\217\267\"`\265\203\013\353\274\305k\224b\200"
+	.ascii	"\360Gq\360\232~}\366?\357o?\032\305}\234\327g\343\267\373\333"
+	.ascii	"5\3143\374Fy\307o\226\367\267_\267q\037=l\244f\220\375\300\232"
+	.ascii	"\207\205\315\302\254\306\026\254_7\371\377c*\\u\233x\007V\356"
+	.ascii	"\3002p\216\353,\013\001\345\r\357\300"
+	.string	":\260\222o\211\331\223pX\250\315a\351\365\336-d\310\340\373A\025fj\353\3272\370k%\216\343g\003[\300d`\375y\004\3767\n\215\257%\256\201\247\274\236\370\006\266q\233\270\006\236\361\232\3313d\370\261\331\322\241\305\264\365\347<\376\231\013\377<\307?\257\361\317J8\216\362\376\366\347\"<'y\177\033GA-y\322\222\006\353\3178\370\337&NB\341\034\301\303Sk\361\030\352?\210\303\247\345\364\356\325{\277\240\343\025\347\002\2115F\342\247\377\267\3319\332\241\201\201\365?~\302N6c\232S\\X\263\300A\342\005\345\005\326\237a\360\377\277M\334\204W0\373O\216\n l\"`\375\331\211\177\336\247\375\277\315=\342d\213\t\326\217\363\370c-<Gy\271<^\372\277Z\356\026\254\204\225\025pz\274\225\231\302\032\037\1778Z\220*$X?\236\302\377z\375\003\201i{^\273\273\032j^^\300\250"
+	.string	"=\333\226u#\304\001\341\211\320\366T\353\362i\327Yv\227lT\236\030\374_\273/\237\346\263\351\275\255K\255\367\376\377\027\3155s\367p\277en\032\234t\365\356\231\333\274d\256\230\277yw\314kf\357K\275\367\277Q\376\201.\231\033\346\323.\254\350\275-\007\205%4Q\302\364z\357\031~2\340L\251!\351&\350\307B8V^\237]\301\375\355\3077\370c\032\374\261\f\376\370\005\177\034\305\037\267\340\217Y\360\307H\3768\005\347\271\277M\301\375\355\273\004\350/\227\337NN1{Y\357}'\253\2611\235\301\372o\036\337]\356o\353$\357o\377\315\302\377\272\361\277h\374\347\372\354\277Y\374\306\341\013w\255\374\215\273o\037\304\341s\226n\234\356\375x/\001|\367\022"
+	.string	"\2252\344\230d\353\277C\370\337)\216\341\372\354\333VC\206\005\226+X\377\355\374J\271l\267y\247\374_(7\312\3531eo\366\316\324\311\307\030piX\377\305\260w\366\366\366\366.\206\375EN\301\365\331\372\376\366\253\374\235\327g?\b\270\257\337\337\376\347\365\331\327\3542\271M\013n\223\277K.\330\243Gfg\366\316\334\301Vh\314\222`\375#\370_\013v\336\333\273\026\354\017\301\361\375\355+v\307n3"
+	.string	"W\311\007q\370\2344\326\275zg\356\350\244\331Jc\006\353\247"
+	.ascii	"\377\233\344'\220\353\034\376\307\377\006`\337\275\033\200\375"
+	.ascii	"\230\373\222\367\267y\256\317\376\277_\377\267\353zY\220\221"
+	.ascii	"N\312^\326;\263\207/Ei\342\205\3653\257\317\346\367\267\3773"
+	.ascii	"07\2408\202\177<\302\177>\372\317\022 \022\r\377q\022\243\377"
+	.ascii	"\374A\370\237?\360\377\027\376\037\204\377G\300\303\375?\005"
+	.ascii	"\377\233\305\177\006a\203\020~\377\357\024\377Y\004\377\271\350"
+	.ascii	"?\013\375\347\022\377\331\003\377\231\003\377\031\204\377<\342"
+	.ascii	"?{\360\237E\374g\016\376\263\005\376s\005\376"
+	.string	"\263\004\376\277\311\177\206\300\177v\300\177\016\372\317\035\3763\206\177l\346\037_\371\307\316\377\367\372\377\237\377w\373\377\274\267\267\267\367\177'\374\353\274\375c`\201^\362\035\332\224\277\350\034]\252\202-\252\3769\213\311\355\222\343z\323\253cj%U\013@\002\205\353M/'\371\317cM\271\231\311\256s\252'\201\311\340K\212\251\265\3024X\007\246\244M\2139\260g\357L\264I\227i1\035\230\222\030\250\352\312cN\362\223,\226\344L\346\334\236\231-O\311X\2520tIq\275\351\345#hS\006\313bR\027|aq\275\351\341+\264)\327a\270,\226\0041\207\026\2076\351\"\032I\007\246\244\r\324\\\031\212\003\225\201\352@m\240O\350\rT\n\255Bg\240/\320\035h\f\024\n\235B[\240<\320\036h\016\324\t\255\201R\2410P\032(\013T\211F\241.\320\344m\242M\030\312\347!\231\b\316\326\361\t\365"
+	.ascii	"\215\334\231A\205\343\r\353\377y\361\377G\227P%4\005\312t\233"
+	.ascii	"\250\n4\351\363U\306z\215\252\320{h\367-\361\364^e\265\254CU"
+	.ascii	"h3\032M\026K\362%I\204<{g\006q@U\240\307K\346K\342\351JsD\226"
+	.ascii	"\2753\353P\025z\004]\346:\177\364\036\225\301\021(\\oz\275w\024"
+	.ascii	"oHS\313\215\376_\222\377/\005\332\377o\235"
+	.string	"N\243\321\314"
+	.string	"\203\227\004\353\227\220\206\343\216A\237a\356\344\034c8\271\202\365K\310\343/\241\013\377\327d^\227\371\327Zz\f\356r\365\252\030\021\001k\255\007\364\232\214"
+	.ascii	"\320\244<\301\272\346\376\366K\310\302\263\004'\327x;;|\034\263"
+	.ascii	"`\375\022\324\270\231V\313\314%\b\245\026_t\030\375\274M\r\346"
+	.ascii	"\227\300\350':K\007\246\244\007JOO0\372\356\337.(!\373Q\307\005"
+	.ascii	"We\260\312h\262\037Trp\375\022`\360\307Z\340,\\\347\017\n`5\211"
+	.ascii	"\"\267\365\354\235\231EC\321o\027\224\220\031h;\263\362R\312"
+	.ascii	"\226W\270\236N\f\327Y\366A\315\353\331;Sg\321s/\305\267\304\323"
+	.ascii	"\227\210h\351,:\316\302\006\022\244\310\013=;\355Ek\321u\232"
+	.ascii	"Ns\321]\364\226\333\324Y4\226%\224L\211\236\031\t\372{\324\370"
+	.ascii	"\367\230\361\357\021\343\337\263\305\277g\311\277\007\b\377\036"
+	.ascii	"\035\374{d\270\235%}\221\203\302\372{\230\3324\225\333\324U\364"
+	.ascii	"Z\024\315\266\303\313\262\212\236\242\331$x\251\353\241\245\227"
+	.ascii	"\235\330\211Q\262\365\363(\341\377\232MKI\363u#\r\326R\364\232"
+	.ascii	"\017\254\210\323\016\254\237g\b\177\236\036\374yr\360\347\231"
+	.ascii	"\342\377\272\311k\265\177M\246\227\350\264\020\230\255pS\201"
+	.ascii	"\265F\323N^\247\351\263\256\3232P\366~\324i;gz?\356\334K\200"
+	.ascii	"{\t\240\271\252\2120\331\372y\\p\315\004\350u\223\024?\234\244"
+	.ascii	"\260\266\340\376\366\3638\361\347Q\3011\363\372l\f\367\267us"
+	.ascii	"\254x\344N\007\230$c9\310\223\313R\354\365X\222]\223-u\374w\346"
+	.ascii	"\270\227\376\352\2629\002\303\254\013\232W\227\215\026/'c\270"
+	.ascii	"^w\345<\034=\206`\205M\301H\303\372w\306\370\005\367\267\265"
+	.ascii	"\b\327\210\231\235\037\374oS\037\321Fj\226\310\214\305e\2756"
+	.ascii	"\362\037\304\341\306\335\256\273\271\021\260\326W\032\213/\241"
+	.ascii	"\222R`E\331isKCci\003&\213\225\037Kl\307\343\312I\027\326\277"
+	.ascii	"C\203\357\370\311K\226\266\260\220\333\324C\264\216\262!\232"
+	.ascii	"J[\231=\031!MN_A\346\211\266\nr[\264x\"\261\326@l\336^\300\240"
+	.ascii	"\202\365\373\354\370\277\366q\233\372\307\035\006\035YRX\177"
+	.ascii	"\236\356\361\3776\330G\226/e\260\376\327=^\363H\366%3\260\336"
+	.ascii	"Qs\027%7F\245J\353\300:\216X\242\260~\037\033\177_\223\277/L"
+	.ascii	"\343\300v_2\310\260~_\026\377\177]C\333\270M}#\347}\366\222\357"
+	.ascii	"\376\347F\006\223\305\370\226\230=\252\206\013\230\033y\214\236"
+	.ascii	"q\235S<}\351\016\315%cK\023fk\335\244ctYNi\031\232\306m\352\031"
+	.ascii	"\257g\344\021t\367%\365\364\336\343\314r\206N\322H\337\022\263"
+	.ascii	"K\355/Iw8,d\310\200\343\304\343F\022\327\377\257_h\030\267\251"
+	.ascii	"ch\027-\264\324uN1\273\224\257\211\216\277^14\013\375tA\t\031"
+	.ascii	"b\315\356\311\243\004Y\003\262\365\373|\360\177-\365:JgEZ\326"
+	.ascii	"\026\254u\362\006\306\224s\r\353\367\325\320P\177[\\\245p\303"
+	.ascii	"\372}R\374o\363\275h\247\277\323Vo1\276\260~\337\023\177\037"
+	.ascii	"\023\177\337\221?\006\032\251\217:\305u\226}\210\273{j\025z\305"
+	.ascii	"mj\244f\322\310\254W\345\313\323W$\253\353k\353\327\031\3035"
+	.ascii	"\222\245%pX/i\245\256\243swC\212\021\254_\247\013\177\235,\374"
+	.ascii	"u\256\3444y\3576u\317h\376\332\345\347\3770{?\323=\223\311g."
+	.ascii	"(!E\340(\363\354\235\031\304A\367\254w\311|I\314\016\205S\344"
+	.ascii	"\352\016\207^\357\314\237\f\031jv@\t\013\262\365\353\210\300"
+	.ascii	"\377\363\231lf\006\022\355\f\023\2352\205eH.\223\363\352\232"
+	.ascii	"\372\035\326\257S\204\277\216\017\376:8\370\353\300\340\257\263"
+	.ascii	"\202\207\311xK\250\300\264\260\376\234\27509#\360\233\203\307"
+	.ascii	"/\363\372\354\037/\374s\260\360\317y\343\\z\344\250\235a\212"
+	.ascii	"\201\365\347\230\361\233\003\306?\007\213\317\355\270\270\261"
+	.ascii	"\004\211\365\347\334\340\217\001\226\313U\262X\2223\361A\344"
+	.ascii	"?;\263\334m\346+\331\355J~\313V\256\263\254\037]T"
+	.string	"\220\007&\214\355'\203\016\023=31\266\206\313q;,\206\250\260\262\002\267\306\037'\214\267e*XJI\220\2546%\277\311\373\333Q\362\332\235\033Sf\005\326\217\023\025\005G\005O\313j\231\351\204\212\034\231\264\033/\374o\346\370\337H\341_V\306\377\346\b\377\266\353\263\377\206\007\317:\006\034\017\"X\377\315\r\3767P\374\351\256\317\276\312\373\333\231\271\343$\302\346\004\353\277\311ax^FR\204\031\301\372m\254\360\377\317\\\267\231\2732\222\334\225\265\362\326u\226\365\036\265\200\255\250\2523z\267\206\233\222\025\255\267\340\324\270H\035\301\372m\340\370\333\230\361\267\341\342w\t\204\277\332\365\331h\333\375\355\253v\177\373mt\360\037\363\372l\254u\177\333\n\247\312\026\247\033X\277\r\224\217L\225{\370lz\247B\263\364\221[\344\034\\g\262\217\254\354\033\226sXZA2\220\374\3436\263\217\254\343\363\212\334\364S"
+	.string	"\265%\223\353\\\225w\334\346K\311\001\307\272+\254\037"
+	.ascii	"P\033\355\356\264\346N\333h\227\331\223\366\220,+\033z=9\245"
+	.ascii	"\200\233\236\325b\013\326oa\217o4l\201\214\0057\312(t;\232\374"
+	.ascii	"F\373\337g\267\312%\013\201\324\024\252\"X\243\367\267/\024\240"
+	.ascii	"\337M\364\2161PXf\177\233\333l\203\341\261\236\344C\203\202\247"
+	.ascii	"\225\303\205D\007\024\326oA\216\377\357%\177\233{\311\366\312"
+	.ascii	"He\217\212\300\023\346\224\002|h\230\344\300\002\327ln%\023\256"
+	.ascii	"\252l\220d\361\330Rr\225U\345\204\365[h\302\177\207m\346o\261"
+	.ascii	"\337b{\214\367\336\223\230\035\352\242E\261\262\241\327\247\246"
+	.ascii	"0\3504d,\244>\357\367\030*g\204\b\023\254\337\202\f\376\377\367"
+	.ascii	"\361\377\356\307d\357]\ne\366\244R\316\376\277\177\321{1\374"
+	.ascii	"\353\334|\013\360\377\372_\004\036\364\316\264\246\325{\277b"
+	.ascii	"xV\332\261\006\005\035u\366\276D\225D\001\252\250%*\031\310&"
+	.ascii	"UT\017\262I\325\223\226\210$\365$;U\022\262\331{\317\322R\322"
+	.ascii	"\007e\024\262y\354=\310f\217\352)\344\242ngR%\365%e\357\351K"
+	.ascii	"\375\330\233\312(\n\220KTQ\310\3461\252\007\331\244\212\352M"
+	.ascii	"\252\316\323\227\216\311\025K=\331\323\233T`zS\031\305\203l*"
+	.ascii	"\243\220M*.\367\216\205\21741\322\264\206\340\270:\220K\275\305"
+	.ascii	"\223\215c\222\307\211d*;]\357\267\214\251'\273\263\367\002\364"
+	.ascii	"nC\231\244;\312\270jJ\316\026JgG\345e\366\336-<)U)\373\2223\351"
+	.ascii	"v'\322\210\262w#JE\375\251\367\3363Hb:;\220\353L\332a\243;1\365"
+	.ascii	"\016\200\316\354\375\251\367\244\333\235\275\367\244\336{M\322"
+	.ascii	"\006\263w\032<\310\345\323S\357S?O\335F\322\023\246\336qY\235"
+	.ascii	"Z\024\262Y\245\004zB\326\\v\025\314\244\213tR\366e\247\243J\362"
+	.ascii	"f\222Xw\352\275_<\276\214r\021\006\353\375%\245\213\2228\254"
+	.ascii	"\377\307\311\367\225\265/'\254\377\207\n\377\337\\\017\344&\013"
+	.ascii	"\\\2272\310\337\346\016\262\2652\222\367%\2604\317\336\247\024"
+	.ascii	"\240C\206\213\307\025\326HD\240Cm\n\326\377\003\205\377U\033"
+	.ascii	"\222{\224Y\272\021\311=\256\263\354\003\027\231\215\265E\330"
+	.ascii	"Gv\326mn#{\371\333j\013\331Fv\221\r\344\202\022R\203\351m#\373"
+	.ascii	"*\367(\202\205\247\245\327"
+	.ascii	"{G{\250a9\336\350\377Q\302\377\007\214\377\017\027\377\037,\376"
+	.ascii	"?T|\323\335\337\376\237\033\373\307\02404IX\377\217\013\376\377"
+	.ascii	"\333\306\306\261\253\266rSm\035\373\306\356\261sl\036{\307mn"
+	.ascii	"\037h\232\237d\333\366\261\245n\334\006\"\267}l\027:G\322\r\020"
+	.ascii	"\252=,=&\270\345\323N\341\266\334-\252<U\274=\257\335\366\261"
+	.ascii	"\243\322\342P4;\305\005%d\210\266\270'\324v\272\240\204\f\301"
+	.ascii	"F\345\271}\354\027\273F\2230{X9j\314l\353G\317\3304\246\260$"
+	.ascii	"\225\214\301\372+\254\315\230\322Y\342F\343(\343\367T\316\030"
+	.ascii	"\2463L\260\3361\262\0254=\2160\376\337F\007l\271\205\rF\356Q"
+	.ascii	"\244E\221<\254\277\002\023\376\025\222\360\257p\204\177"
+	.string	"\005!\374+T\361\257@\203\177\005)\376\025X4m\026+.\326\227\022\006\232\246\275\202\312\312j#\177\257\270\320\302\252\213\202\030\376\024\272\354\245\034\026\3103d\260~\np[i\037\261\221\274'Z;\351\367\021\343y\361q\207\365\347\355\376\37767c\244~\220\301\372\177wt\357\332]\301\242\207\356\241i\226\034\217JX?\205(\374)\234\361\177\364\f:&\f\025\251$\254?ge\241{^\251s\213\302\345\255\n\335\205[\332\345*aP<\324\f\n\006\025\203\352\241d\3202\350\b\350\023\315\273Mt\fz\367\350\227\213\366\330K\033\326\262\345\306-\261d2_\356\035\007\227\345\\\256\003\032\203j\241\200\227\025\016\377@c\320.5VRxZ\031\250\342\346\306\374h\337\375\355\247@\203?\205'\376>h\370\373<\371\3738\371\373\244\361\367\021\343\357S\204\277\217\222\277\317\013\376>*\370O \303\377Q\271"
+	.ascii	"0c<\355\300\372\037\275\022\004\252\213\016\353\\\267\004\022"
+	.ascii	"\204\311\263\367n%\304\354\231\202\t/]\320\245\234\303\322\363"
+	.ascii	"\022\001\325\232\361\004\312]\224sXzS\332\3621\213%/\220d\210"
+	.ascii	"\326\272\372\241"
+	.string	"\224\231\204\244P\321\225\254\342\2466\207\245\207r\3353\337\221\247/)A-\315P5\264\fU\202\246\241l(\030\372\004%C\233(\024\024\016\235\202.A\233\240LP+h\034\312D\307P4\264\n\332\206\212\241TP'\350\031\032\206&A\235\250\033\372\206FA\245\334&\272\206v=\352\205~m\241ZY=\313\245\303KY,\211\001%\267\347\025\271\257eX\331=\313L5\256\"\211\231\347ur\327.\225\f\276\234sXZk\r\305\312z\316a\351\ry\202\331(@\322\353\262\3205\034\003\373\310bI\rT9\201\361\003Ku\330R\233\303\322\013\273\314=\264\2640\345\034\226\036v\261\206_`\251\016LI\033\026I\332\236`s\022P\316ai9\271O\302\222sXzN\326\222sXz\327n\r=\202\341\262\230sXzC\326\260Z\327\023]C\227h\221\016L\311\013$\t\362\034\202\256\341%N\223\312"
+	.string	"\211s\r5\222\2456\207\245\347d\355:\277\230{\306]\225\027\b\375`\230\327g\373\246\356o\377\2040\374'd\341?\201\215\243Hl\264\340\335(\303\372'\240\361\237"
+	.ascii	"\306\177\302\021\376\023\200\360\237\220\203\377\004)\376\277"
+	.ascii	"2\374\177w\234\b\232\267)R\260\376\337\025\216Z\345"
+	.string	"\"\250\217\016LI\016\346V<\221\377yEnB\2552\213,$\213%10\327\204\006A\205\240Cn\023\265B\177|^\312)TX\241@4\232\250\016WK\246\035\r1Y\270\376\337\032\377\337\022\276\246\266\304l\n\326lhS\326\202\273\370\216<\275W\245a-\377\231-g\301v\031t\035\233\234\335\270\314\\\326\220U\301=\257\332\222{\244\322\345\323R\210-`\013\313+\033\201\262\025\266\205.s\211\312`K\016m\322y\350\212,\226\274\200\322\227g\036k\272\316K\226\231\313\232%Uu\317|\004m\312\"\344/\027\025|\215q\275\351a*vg\317\336\273R\0239RE`K\252\314,\fs\fJ\226\322E\225\365\237\227h\323\305r\317\256\363G?&u\370\222C\273q\025t\215\345\355:\024\361E\032T\241\032\f\002\013\320\256C\021\301 \260\246]\207\"p\332\240\332\336|\221\206v\035\256_\244!"
+	.string	",\360\310\210\030\364\261\252q\004j\221\207\025Rw\376\336\373\250\221\332\262H$(\020\213HDZ\210\330\0327\350\371\n\332u(B-~\300~p-\252C\225\210\177\006\0320@\203\016(j\276\303\003.x\300\005\373;<"
+	.string	"\b\350\001\032"
+	.string	"\361\327"
+	.string	"(\267=m\273\325\242\221e\325\342\007\3546\241\n\345V\270\001\261\b\254@\r\b\272\375\"\r\300\022\023\324\026(4\006\205\300\240\315\026\002\252\305TH\035\256%\214\210A\235\326\310\221\200BU(=2\362\266m\215i\253\022\035ypdL\333\"\260e\371\221\261F\345\200M\201%l\216\214i\253\022\355/\3220"
+	.string	"6%Z\207\206D\017E\265U\215\326#vg\310\006\323\365\210\335I\203A+O\317\320\2210U\331\2258\364\tU\023\351P\020\207\b\330\246A\242\232C\004l\323\2420\210\"%\026\201%t\330\224XD\"\332\255JT\004\266\2766\r\302@5Z\333#\"1\003\276!\017\0376\30012\222\260\351\200\220*,\001\034Z`x\202(T\001\b\204\234/\322p"
+	.string	"\224M\211C+\210\335\246\354\006T\243\265\345\354\006ZV=\241\0169\273\211C\353\220nw\322\232/\322\320\006\215\305\226\rbS\024jk4\352\t!H\024\246\351n\207Fb0Mk\212\352\360\0041Mk\330\242\312\032\207i\312\205\206k\bi\272\331\341z\304\246i\315\220\270\262\253PMS\2336m\331U\310\363E\032X\365\b\251e\200\220Z\004\026\261\f\330\300\266k\211\r\306!\021\003P\030\207\253\220\001\031h\220j\320\001\305\006U\310(\f\016\327\rE\326\270\301\001-\nu(\004\016\213j;\\S!\240Z,j\217\322\264\202\t\265x\224\246\273eWa\232n`\013\024J\323]\004\026\005\265J\202\225M\323\035B\220(\324\355:\024\321\256\303u\0177\3533\004A\034ZA\b\001\325\342M\261\375 84\202"
+	.ascii	"\266\300\017B@u\004\261\210\304\201\205!\b\235/\322\260\266("
+	.ascii	"\324\242*\024\032\002C\254-\n\365\327\016\2070\233\006\325\021"
+	.ascii	"!\004\201%\204B\240\207\265E\241\366\254-\nU\267l\272\036\221"
+	.ascii	"\030R?\250GH \244\"> \201\243\006\207\300\226\035\256\274M=\020"
+	.ascii	"\241\207\353\007C6\270\327#6\263\251\207 \0218\036\202D\330\354"
+	.ascii	"`\320\232\277H\003k,a\201M;\020\342)\252-\0134\332,\253\026\205"
+	.ascii	"\204\2005\252\t\240\220\204\361\310\210\033S\023\252\020k,\301"
+	.ascii	"\331T\r\256&\324\017\254\261\004\216\232\252GH \260\306\0226"
+	.ascii	"\352\021R\313\032K\324\260\306\022Y\025\002\203,J,\252\037\340"
+	.ascii	"\036>l\360\201\204\023\300\021\036>\334\250Ec\013,\252GFj\213"
+	.ascii	"\323~\221\006\343\221QJ,\"\021\005\203\300\rlQ5\261\026\205\022"
+	.ascii	"\240\246#.\340p\201\006\306#\243\337\220\270\266F!\221U\2137"
+	.ascii	"l:AM\215GF8\255\320\310\252#\324\017\306##\tj:$Z\205\300\324"
+	.ascii	"7$Z\205\033\244:$\b\201\001\265\005\216@\022\002\252#\200-P\310"
+	.ascii	"\246\310\016\245EDkQ:t$\314\031:\022\246$(\n!\b\203\"\t\354\021"
+	.ascii	"\261\370\241\250\n\255&\326\017\306#\243\2356%\002\202@"
+	.string	"\\k\210\200 \254-\n\013\264C\021\306##\0355\365\251E\340\t\241\"0\204\321e\323\364h\350\207b-\266\300\016Zb\321\307c\242\246m\323 \f\332\341ZC4\\\207+\320H\035\301\252\302 Rp\207M=\020\213HD=FF6\267_\244\201-j\201F\303\324(\263\251\tU\250ek:\350\200\204\220\220\230\032m\022'\324aj\264\213@\023\271Xb\025\002\2038A\304\"\022\021N[D\264\252'6\233\346\264_\244!%\200\220\220\030\342h\025\006w\330\024\004\261\210D$\201\253DC`Qp\327\234"
+	.string	"\216`\215\304\325\204Z<\302aC\b\032[6g\017\201j\007CC\253\020W\203C\340Z\004r`hh\025\312\031\022W\3268\264[65\241~0\241~ q\002X\314\031\256\300\"\0178m\020\213\331T%\002\266$&"
+	.string	"\261\030eSU\b\030d\201\036v\332\241\221\350A%\002\266\354Mpm\201-\2333A\250\343\323~\221\006b\021\211\b"
+	.ascii	"=\3064\003\304\"\022\321\257\r\341\262)\216\332\002[\026U[`K"
+	.ascii	"\002\250=\362\005\261,\360\350\004Q\350\363)\266\037\360\264"
+	.ascii	"l\312\203\206 \220\204GG\033P\360\265_\244ah\303\220hdD\fN\360"
+	.ascii	"\304#\265\270\241%\022\213\033p\202\2200\233\n\001\215#XK\370"
+	.ascii	".(\201\201J\340\240\022\030\b\210\203\200\030\b\005\016B\201"
+	.ascii	"\201\220p\320\020\351CQ\260%\016wH\020Bm\201#T\341\221\021\220"
+	.ascii	"D0\b\334Q\331\r\020A \026\221\210lT!b\007C\342\332\006\325\226"
+	.ascii	"X\374\300\003\026\030\202XD\"\262 $\022+\220\242D\303\225\210"
+	.ascii	"\003!\320\370Ae\215\023\332\024\205*4\\S6\270\032\001\207HBi"
+	.ascii	"[D\264\n\207*\260+\212\r\210\214%\324\017\304\"\022\221NQm\205"
+	.ascii	"+\210\234\341\252\001P;\\\215\034\005\260\203\241\243\f\f\221"
+	.ascii	"\204l\332\264C;\\\2155\017\004\344\201\202\rh\200\003\036\324"
+	.ascii	"0$\256-\220]\205\300\265]\207\353\006\266Hd\207*\273a\270\002"
+	.ascii	"\2156\004\213\354\006\r\006\b\201\005v\300\256(68A\024\016\025"
+	.ascii	"U\023D\236\377\337x\257\025\344kJL\0309,hS9\260fzAAY)\237`\332"
+	.ascii	"\005\331\f\247/\233\256\213\223\306\322\235W\\\020\266<\254\377"
+	.ascii	"6\267\027%\025\b\343\304cw\331cf3~Ta]W\267\225$\321ZL\222\274"
+	.ascii	"a\375\023\254i\321\262\3518TuA\271\321\221\303ljo\371M\267\277"
+	.ascii	"4Im\301\372\363\356\331\377\333\350\260\254\251\036X\377\004"
+	.ascii	"@\260`\331J\222"
+	.string	"\334&If\220X\377\0047\252T\331r\023\256\244<\250SQ\346\312o9\237\021\"O\274\260\336q\333\211\222\265\250\"sn+7O\316\216\200\331?t\262\330=!\341l\200m}\301z\277\3512W\311/\254\177\202\344v\233 E[\333\036\373Q\346-YHhd17\220[T\330\330\200\242d\215\321\352}\n\203\317\251\313.\211\365\003@\310^[\333cw\254C\375\\\0351\354|\331\340\342\206\365\003@\311\177\253\335\r\005\312F\373\334\373\261nYS$\204P\250\223\262\343\2114 \005)\f\345\230S\b1$$E\315\001\263\024@@`d*\223\212\227\315\036\023\200\002\314\212\264\331\242&!S33\222$E\251\261u\242\021\013\347\"\312\003YJ\025\2769\234\332T\203xB&\311C~n\307\373\215\313\214\215\007\3438q\360Q\020\206\232\177\032*\226\261\034\333_\244m\246\251\207HK\316\275\317v"
+	.string	"\353\321\t\003x\022\3447\365\177!a\231AX\360\217L\241 \"\217a\240\351=\240'7?\271\341\232A\275\334]gLY\203\205bL\222\255\326\334\257dOAhS\007\266_+^\024r\203\274k\231\213\\qO\220x\360\340o\026g\237#\3647\032NF\220\300 ,\203\373\031\347\211#H\314\211( #\004\033`\366\265\230\353r\244\1776\204"
+	.ascii	"\250\213?\036W\033\234\034j|\370@"
+	.string	"\006n\213k)\276\017E\373\215\032\2273\017\271\3565)\325t7\235[i\020\004Z\\\251$\233|\270KI\003\360i\"\215\245\220~\263\340H\254\276\324\312\354\256@Cr\345L\031\202\020=\305\305\311\3458p\210,\244kd\326p7]{\376\230,Q\301\023\275N\215\t\247\365\331\210\202\222b\315\b\313\211\3175sPmO\223.\232\357\251|\022SS\220N\304t\310<g\304\203[&\245\024\322\002\222\335\2144N\256\227\370_\331\257\3737\266[\343\"4cc\217\250B\340V\267&\370\315\222s\260\320\323\336\216\034\264\254\264\f\201\273l\004\326\fa\265\277A \201\241\004J\202\333\300\217\327F\352<\354\030\353\021\231=\251\207~\201\242 \t\020/\307\355;\2152N\032\216\360d\214\301\263\027\200\374~\036`;\257\230\270\363\277\366'\213\205\367\261\312.\030\004\215o\006\372T\357\213\342\336\242\254G\210\314"
+	.string	"\320\370\\B\016\207\207\365\221\212\2111J\004D\232%\220\226\200{\037Ev\207\227\244Y\220\236(\036:l\372\274.g\320V\354ml\341(\221\340^*\335\321\374\013\232"
+	.ascii	"2\272\2355b\246\263X\365N\375\255z\360)\373\270\201\235\343r"
+	.string	"\351\240~2\r\326\353\bW\227&[\003}\f\226\361e/\223\r\262R\fh\340\025\311\204LM\032\304m\311c\003\247\021\325\204\2331\361\371Ev\220F.\305\\\365+\"-[\244\367\001\211:/\343\233\200\366\331\245\210\002\234\231n//\302f\311\013{\262\370\215\331\004\230\354\263\017/\227AC\361&\341\225\224:F4\022C\031\2036\236oy/\363)\321KK\241\202t4\004l\375\365\320[\rrfXo\213}\312\004\264tF\331\240*A G\021Y\027\2473&?\264\204\232~\265q\202\307\357\271\007\261E\021\360\244Q(\216K\274\253\246\220\230\244j\375s.\355\367.0\020U0\346\003\355dH\240\334\230v\277;\275\302\364\205\021*<J\343mh\t\222\224\337{\336L\316A \205n4\345\372\330\274>\020\202\351xG\021W\276Ac\331A\335\034\207\256\024\261\na\342\314\220@\257\251F%"
+	.string	"\033F\026\242\247!Sml\326\346\232e\366\275!\316pA\026H2\240~\002\037\002\r\363\326\217\020f\207\rwtb\265p\307\245wI6L\261l#\273E\213$?\266\007$[n\257*{\351"
+	.string	"\020\333\237\366\020-\312\214d#g6z\341\255\325\330-\2464d\300\2067\374\234\310M\342O"
+	.string	"\02493\002\340K0S1\037\276\360\rP\332\330\317\375l1*\247\027\377\036/\007\271\365\361.\325k\212\3312~\354\256H\321\203\316B+{\256Wf\306\261&\276\360\027\276\021\203\"b\002\344\200i\200&DG\033\330y\200>o\201b@B0\232\201v\351\005\343\310nY]\330\371$\335\212a}f\330\223;)\212 \027\007/\203\223\245\264S\037!\031\227\317\333^\214\300\004e\223*\254\315O\227\333\016XK\006\361\210iV{\317\236m1_\031\033\223\315\026\037'\002\026\342\216\352\177d\016\215\316\315\264<\024D\306\240I\205\233\037\364\327#\001\0028["
+	.string	"-9\333N\343\025\341)g\206Q\335\216\231=\234\305\213\371f~"
+	.ascii	"e\351)\353\330\004\235\b\3742\320\301\321C\357e\035@\261\324"
+	.ascii	"\273-\220\006];\007\037DX4\201\001r"
+	.string	"F\353\002-B+)GLr\323\fY{\216\b}\350\335\t\260\007\027Z\255()\201\034N\313NfP\345\rT\b\226\016\n\200\030+\271H}p\344\005\222\356\304\216=\332S\246\264|\027\367\237\232\\\360[!?\021\231#A\212\233\375\352\211M*\022\324l\240\270\216\274(-\032\236\363\332[h\346/\177\300H\2430*\265\202\254<\341\304\300\366\001 \334\020\247'R>q)0\274\276\230wSy\213\264\350@\253\016\213O\343%\357\245\314>o\230\367Vy\271\312\245J\241yzm\321\326\002C\233\020\303\027N\031$\342\225~\177\256\214\r'5\243ZW\030\nQ9M;\364~t\320\\\304@\025(\330\207\326\233$\305Fw`\022\013\250\313\021`f\337+\270%O\222\323k\375\b!]5B\232\fME\376$"
+	.string	"o\200 \211-C\021X\245\002\344ly\320\354\b\326j"
+	.string	"\342\367\265k\017\313\357s\336\243\212\303\277\025\356\221\212\373\001\"\313\200\244W\232\340\251\t\237\255a%\214\330\021\022%\002)\364}\206Hr\236\016\245\314\270\342lt2\001h`\3249\351\007$#O2\224\304S\203\203|L\261\262\232y\n8L\0016\257\r6Ok\332\021\375\351\020\335\221\347\343\3512\215\032\266"
+	.string	"~\022\021\351\0366eN\r\377i\207\343\316\214\302\230bm+H\020=V\217^\263\276\264\035D\276\343\205\223\361m\221*V;<\333\0070\203xT\001(X\226\036\033\212j\223='A\242X-3?\316\323\367\203\275+\212V7\277\220\003\377\217^\325\005S\356\f\204\203\220\323P\257\351\024\200f"
+	.string	"\315]\325\201H"
+	.ascii	"bZ\235N\336\200\220}L_\3446\360\305\244\343\325\221n\274Z\206"
+	.ascii	"<\312{\374\232\254\327\341zT\221=\207\320\204\313\0327b\345\324"
+	.ascii	"2\035\244\336\003\3052\177\270?\364\034#\245\325^PD\237D\024"
+	.ascii	"\231\365\007]\224\265a\221\204y?\007\326\366\207\352n\370U\311"
+	.ascii	"\327D\342\351\220\255\267U\230\034\002TV\016R\207Sm\224\271e"
+	.ascii	"\234L\212\201\004\217n\347\206x\206B5\263\315~[AQ\023Bh\235\222"
+	.ascii	"\036R\200)\377\246G\026D\360\302\231)j\242\222\273\354\022G)"
+	.ascii	"-a*\303nT\227w\250:\346\3035p\214\335\246X\031\353\220&\">\013"
+	.ascii	"\344\"\013I\357L\033A`\004<:\004\301\327Y^\275\312a\001\224\\"
+	.ascii	"\237Bj\216^{\\:nq$\207\013\267l\211\362\026C\221m8\206\270IR"
+	.ascii	"\024\343\036\272m\234\b\001\327C\231\323\006$\222\fH5\3534\265"
+	.ascii	"\204\310\035\016\365\331\345\022$\310T\345\201g\270\003\220Z"
+	.ascii	"\271\370\305\320\326f4c\327\316\210\305\235<\024+\002\024H\370"
+	.ascii	"}\001\362\\\027\223\335\252\321j\230\356\203\334\251\202\223"
+	.ascii	"\007\203\352\334\221v5\252\314\t\236\303\201\303(4\220\241\243"
+	.ascii	"<1\301\364Y\240\024^$\277\201CR\224\345n\344\337\036t\027{ \244"
+	.ascii	"\007\200\250\323g\343`\032\241g\315I\232{\225F\323\216\242F\005"
+	.ascii	"\016\r\253R\300\250(`+95@n\215:\324\216\t\2503B7\2225\367N\220"
+	.ascii	"8*\334\365=;D\216\351\374\034\030\310\374\220\376\036\2115\363"
+	.ascii	"\006\232\312\311\377R\272@\243\257\016Y\341\2443\365jx\257D8"
+	.ascii	"{P\017\237`\314/\321\3269l\244\373wv>\275\276\026\217\323\322"
+	.ascii	"\310TB\354\310\332\001\313m\257E\\e\307\032-\001\341\005I=*\324"
+	.ascii	"X\341\241\026\371)\247\233a\367r\177\206\223\360\214H5zY\020"
+	.ascii	"8+\202{\372X\307=Te4\243\266\016*\230\301\332+B\034\340\241A"
+	.ascii	"\212\262a\007Ew\321\202\323\200n\245\007\324\332\347?9q\346\367"
+	.ascii	"f\315Nn! \013\312\276\255\237\354\254\316\207N\266\350\020\211"
+	.ascii	"\370pox\2014z\267\017\037\304\366\023q\311\004Qf\346\210:Z<z"
+	.ascii	"\251\037\352\025\003\314\260\307\261<\374S\273R)\301\363gf\256"
+	.ascii	"\361_\314\226\242\240!\262\270r\017G\342\032m\003M\2262\316\310"
+	.ascii	"\246MB\013\270\017\264\301\353\226\355\270\305\026\310\244\213"
+	.ascii	"\367\004\324h\2130oH-\243\273-R\231\350k\030\350\253\217C}\374"
+	.ascii	"\235\027\223\301\356!\243\247\202\377v{1v\205\366X\232T\366\327"
+	.ascii	"Y\316\005\362f\340\005N\n\246bD\215\206\300\0071\301^L\303\265"
+	.ascii	"\327%\013\264q\235\300\305)ctL\355\001\377\263a\353\233\276)"
+	.ascii	"\264\211\364Q\335U\177\271q\371\356\017m.,\373\271\235\230\307"
+	.ascii	"R\n\376\244\274n"
+	.text
+	.section	.gnu.lto_.symtab.d58e6d0bdbbd6163,"e",@progbits
+	.string	"sensorsPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"requestedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"baroPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"compassPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"gyroPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d58e6d0bdbbd6163,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,886 @@
+	.file	"voltage.c"
+	.section	.gnu.lto_.profile.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375 \363]\005"
+	.string	"T\b\347"
+	.string	"\026"
+	.string	"\217\211\332\324\013\004\002"
+	.string	"\001\216\235\241\221\t\002\231\331\257\376\003\b\002\001\002\001\002\002\002\003\003\240\342\234\212\n\004\314\341\206\214\004\004\002\002\003\005\371\265\336\203\t"
+	.string	"\006\241\355\342\223\n\004\001\002\001\007\333\326\241\250\n\b\207\216\227\262\004\002\002\004\002\005\n\274\205\242\255\006"
+	.string	"\013\f\r\357\313\212\236\006\016\017\244\310\245\335\004\020\314\251\277\367\n\021\224\265\361\317\013\022\023\024\242\302\263\302\013\025\026\225\254\310\321\004"
+	.string	"\016"
+	.ascii	"A\211\245\356\362\230\366\203j\345\206\274_\320\005\306\255\032"
+	.ascii	"B\021\246\354\224\200<\357\277BXn\240\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375 nM\002"
+	.string	"\304\002b"
+	.string	"\r"
+	.string	"\001\001\002\004\005\003\006"
+	.string	"\001\007\002\001\b"
+	.string	"\001\001\n"
+	.string	"\001\013"
+	.string	"\001\f"
+	.string	"\001\r\002\001\016\017\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\f"
+	.string	"\270"
+	.ascii	" `\225A\020\001D\202\352\022\247\250\300=0\230\312\264\227\340"
+	.ascii	"6\320\006"
+	.text
+	.section	.gnu.lto_.inline.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375`i\001-\007"
+	.string	"\302\013#(\220'I\007\227\352U\305=,\337\276P\003\235\347f\310u\313G\326h\234\275\356\356n\275\360\243\326Z#\204\220F\266\334)\3174\367\371\244_uUA#\032\214E\0278\376\325{\270\325\205\037\271\004\264\2520~\212.\032\f\207u"
+	.ascii	"\300\242$\310\337\217\3174\313\231iN\301\003\244\217\b\b\221"
+	.ascii	"\231\003\253\3773\353\301_)\272N\210!3\033>1\3740h{|\3243\354"
+	.ascii	"\351^\326\314L\364\211\252\376\250\367}\tl\255\265\364\313%\b"
+	.ascii	"& \260\"\261\232\036~\t\002H\321\242\b\020\215J\332\260\356\024"
+	.ascii	"y\272$\231\222\342L\236\221\025\232m\036\206\330\320\035\256"
+	.ascii	"\001\024\257\366\232\205uCH\265\024\361\326h\\\020z\273\242E"
+	.ascii	"8\373\260/'6!\337\255\2353\201\353ig\243\353\206\331\032*\344"
+	.ascii	"\253C+\300\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"U\005"
+	.string	"\022\312\037$\220+\035w\n\364\373}\"\034"
+	.string	"\337\316\316\276-K\246\333\252\314L\302\rF\256\222\317\3417B6\2212\245\024m\363v\342\357\t\230\006\367\204\336f_j[+h\003\255\271\031\366\326\005\337\025\233\342\032lA\034\303\030\242\271XU{\270.\216\243\252\032\204c\232b6\305\3562\216\026\032-\267\226x\222\250#U,\356\207\037t7\314\317a\033\3353zN\366\241\226A\017\336\331\363\354J\355\004\021"
+	.ascii	"J\220\033\332\270\251f\030\334\245\331N\316w\340\256\023\230"
+	.ascii	"<\301\360PQ\340\342!X\220\206\bp\031\230\246r\345\006\332"
+	.text
+	.section	.gnu.lto_.pureconst.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\232\004\002\232\004\004\232\004\005\200\004\006\232\004\007"
+	.ascii	"\232\004\b\270\004\n\200\004\013\200\004\f\200\004\r\232\004"
+	.ascii	"\016\232\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"\265\003"
+	.string	"\262D\017\030\260'\035\200$y\r\311\270B\252\026\350j8\204\360\265m\322\244I\231\002\033\007R\004\263U%\262E@\242p\225\303w<\255B\357\314\337z\316Uy**\373\214=\271p\342\3634\001\027"
+	.string	"\220ei\031L\254\030\210i\007\006\203A\300\001\313J\220\257\202T\016\240\275Y"
+	.string	"-\002\0063<$J\210\236\022\354J\027(\003;;v\016\326e\3662\362"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.f5f87d18c4b7617a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_voltageMeterSourceNames.32.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bU"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\265\001}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\270\265\005}\276'6\206\b{\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\004"
+	.string	"U\245\366iu\200\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_voltageMeterReset.35.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\205\b"
+	.string	"f\320;6P\217\032\003\240\222>\b\263\277\033\t@\033\275\243\1775\2224(\032u\304`\355\205\001\202a\357a\035\320\213\356\314\270\212\321c2\020<o\266\r\236\220\225D\312\224\002)"
+	.string	","
+	.string	","
+	.string	"\231e\2756\305\037\352f\2450Z\260\3773r\3303\364j\207\030\240d\032\031b\030\376\027\226L\032nt\333\203\266\nmQ\002\247\326*\033\312\fvR0\362g\304Z\376\222%\036\232\266\206\255?\f\342Y%\262\300\1772!\371\277\204\"d,\373\231 \263\314x ,\267\022nI\025\027\314\241\254\245\260H(\363\177\241^UX\004\240:,kQf\211Y\271R+$\030k\277\021\214\033\255/\377\337\030\234\006\322<\262\235\215\346\300\001Al\023\263\343\266\356\243u\363\363\300\361\314\016\327\315\215A\267\b\215\233\240m\343\246\346\273/\217\2476\260\274H\361\242\016\013"
+	.string	"2\241!\034\030.XIQ\362)\262!cY\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_getVoltageMeterADC.37.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\025\t"
+	.string	"\306\021@80\221\322\001#\224\230\241O\027E\036\244\007\254\316E\356\342\370}P\331\2413Tk\270y\245\265\001c\200\351C\033KA\201*\"1M\3339e\340A\215\355\267M\344N)/"
+	.string	"0"
+	.string	"."
+	.string	",\220\007\215j\345f7\234\016/\320\271\374<\240s\251 \377\036?\377&\317FZ1p\205z\364<\354\256#\270b\335z\333\b\266\027l\313\004Q\243/=50\0056\273\0341\234}\221-\"\266O6\200m\2156C\303\351\260\f\353nk\206e7Tp\302\347\322\266O\362\222\223\277\201\360\025\326xJ\305\301kw\035N\216\342\371!\227\2660\305\203\227\276I\037\003vD\275f.\252\234T\214\331!*\352\207\375l\325e;Z\017\373\003\030\032\304F\222\036\205\264\bQI\202\273\230^\307y\233\346\315\215$\232\230\243\316\233!\002s\024Z7K\034\327M\207\373l\325e5H\351\206}\225\017\364\002\355\013"
+	.ascii	"'\023E'\306\345#\251\232Pl\202u^h/\241\272&RbA\240:D4]\363\t"
+	.text
+	.section	.gnu.lto_voltageSensorADCConfig_Registry.41.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375 \241\265\004"
+	.string	"t\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\203\375\241\037\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\030us\250\374\007uq"
+	.string	"\005\001\006'\001\003\005\001\006\035\001'\001\202\002?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_voltageSensorADCConfig.42.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375`'\001\215\r"
+	.string	"\346\331[C\020\221\223\016\243\252\2618\364\331X\n\342\225<5\333\031\344k"
+	.string	"\027c\327\373A9\206\202~\234\364\027a-F\035\fl\020L\256\024c\250\252*]\271n7\036\202\334Q\341\036\003/\206\035\261do)S\nF"
+	.string	"H"
+	.string	"H"
+	.string	"2\356\241\354\277\230\r'\033\273{)\b\377\320\273an\217Ps\3633 ,G\200\002\303u\242G\270\331\335"
+	.string	"]\006\270IR'\2220D\311\365-WpR\203\353J\236\031\220\335ur\235\207\273\272\355\314v\003\373Z\273$\251\230u\211*T2\377\331?\335\363[\254y\264I\274\304\366\317+,Q\007\013\365\345\230\261\273\035\217f`=n\3405i_\304Gl_\301P@\300\216|\034R\354z\013\354a=\332;\201\352\321\372\200\352\321\233\035\273PM\250\237\b\201O\271\t\013\023\362\345\305\256\206s\217>\352B\210\237\342W\250\036\023\274\220LF\231r\324\353Ow\300\342$\305\321\030eJUM\266'J-\355\256\310Z\262\277\362\307\177w>\375\f"
+	.string	"\023\027\007`\002\237{: NH\003},w><\0178!\b\030\205K\3130\r\344\321.\320\207\023\341\352d\332\365a\300\230\004Ov\2050,\2734\336^Kf\271\205\342\203\313HE\034\325\344L\013\365\270\306H\222mw<U\205\004\307\007c$o\034\356\006\031"
+	.ascii	"2\003\376\031\322\340E?\256\304\212S\267q\272\b\316$s!\314b\\"
+	.ascii	"3\346G\224(.\013\241=U-\007rV\035\313\332\002MX%\020\0277D\224"
+	.ascii	"\rv\332\333s\300\237\224;\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRefresh.45.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375`&\001\315\f"
+	.string	"V\027UA"
+	.string	"Q5\035\200\302\020p\217\016\226\350(\375\265&\306\023N\3104B\372\3029Nf+0\314\366\003\363F\204\210\b\337!A2\321\304\335\020"
+	.string	""
+	.string	"P\"\275\315\350\320\226\345w\252\325\227\203\2376\331;\245@"
+	.string	"A"
+	.string	"F"
+	.string	"'A\354\313V\206r\266\273\034\375`m\202\257\032\235\240\317\3724\341\020\275j\225\335\r b\320*%1\234\032\211\323\351\307\317\016\027a\214\230x\372\214,\330]O\222h\272\267\333~`\273\200\3750%d\243\031B)U\331\244h\316\335\025\231\246\354\273\356o\r\310Y\r\013\215]\r! \373\242v\254\356\272\375\327[\376\350\311\253\201\003\340]!\311\216\210\304\312\321c\227\264\274\372\"y\375\304\240=#+\330\r\0302.\314\034\327vw5\277\274\335\371\212\017\005\225R\221\002\200\007\331\314\376g\263\273\243\370PP\035\020\330\276\374\304\007n"
+	.string	"\341\320\332\335\004\260\233\220\340\213x5\205\n\363\244W\337\302\366\372\327\t\330\220\005\234[\203\3318\310\200 t\023\270\317\353>\317\346\343<\234L\207\323x\037\207\031\340.\302\306\343@]\347q\023rOS\2543hA~x\214h\350JUV\300\202\376\241\255\206\230\217\375\264d\207\266\323\217\027\360\021\033"
+	.string	"2\003\006j\214\250\303\213\232j\212\212"
+	.ascii	"\001sLx`0@\004\021B4\201\2513e\315fx0\213\201\271s\271\24732"
+	.ascii	"U;&%\343\345\212 3\334N`\264\253\302\357\231uPD^\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRead.46.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375`\r\001M\f"
+	.string	"f\226Q@\020Q\234\016@\307\224)*D\351\377\306\354\370\001\366\337~95e\325\260\320\n\323\004h\375\326\264Z1EQ\334\004\177XJ!"
+	.string	"\300\b\311\"\336\200\270\203\260\223d\317W\221\2024\376F{\247\024<"
+	.string	";"
+	.string	"D"
+	.string	"\326\356fDc\227T\340\004\325\353\201\023\210\274B. \362j\321.\235$\261\017\225:\204L\273\213\321\021\027?E\377\240[\243\006\363\331\341`w=G\315\207\233\3366\002\333\023\373!\002\"\354CvwM9\366?\177\275\347\247tz\322\351W\227\311\206$\265\353!\205ZR\025\225\260\375\313\366$\277B\374\347R \300r"
+	.string	"\201`P\275\232\254>\355\247\270\n\361\036\r\016\242\322$#\306\244\226\250<\235\332\224\303\340\252\277\b+\003nt.\243\021\207'\334\005wm\312\005\2663\274\205\007\300\004\352\304\3566\b\235E\005\277\363j\320\302\374\210!\362zzmJ\024\236\314L\331$f\322\337\026n\020>,[\327e\022&Z\204\314\303\232d\243d\241\305\273\200\201\237\007v\033\210u\225\214\303\264\017\304$\006\354Q\330>,\364\274\017\273\310=d)\307\017N\244\f\335\340Im\3555h\216\35538+\032"
+	.ascii	"\2263\241\214\351\3043\f\267\352\030h\003/\002M\240\273i\310"
+	.ascii	"\362\0069M\2572\226\035Tcc3g\204\216d.h\263\225\341-k.\274\305"
+	.ascii	"0/\b\277\251)p/\230\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_voltageMeterADCInit.47.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375`\237\001\215\017"
+	.string	"\226\235fD"
+	.string	"\221(\035;k\263\016^&\344\320\302\374J\266\220\350\366\037\032\342\236\270w\264\371(\362\221;\020\365\321\377\365&_E\325\"\311\340\255\337\372>k\377\237\036\343\331\200\210\0332-u\253\005+\377O\366\2262\245S"
+	.string	"M"
+	.string	"U"
+	.string	",d\033nvc \2176\320y\274\307'\333\306c$\3665;Rjp\354.\247#\f\363\364\b5O>gD\346\003bd^\013\365\b?\273\373\321B\201\237Ti\251\022\302\254\\\377z\001\0242\257\265\362\344\214\354\256\323ky\270\267\333\246`\373\200\235\016%\276\211Gw\030\362\336\243]\312\220\367|\330\317a\006\242\306R\224\252\272\3301U\346\356\242\254-\366]\367\006\323\021\246!L\253\2463\323\367\370x\221\301}\273\035>\035[\2130N\334u\373\260\247\360_\366<&\0209\335e\352\354\013'\366\003\b"
+	.ascii	"\322\264\263\320\230\2111\370\276\033v\004\ty/\352\007EQV5\355"
+	.ascii	"\"\334Y\355\246\b@=\313F\225\237SU\337\202usM}\312\016{\302W"
+	.ascii	"\200:\273+\005\276\212\313B\242\321G\333\343U\344\203,\346\225"
+	.ascii	"\312\317\236\364\270cl \367i* \370L$w(D4\002\235X\3504p%RW2\021"
+	.ascii	"\2258\023\022P\t\027\"\225\270\020\001\356.\210H\334I\327\221"
+	.ascii	"8O,um\221yg\006SK\251\312Q]\274\300F\177\323\026K\344_|S\025"
+	.ascii	"\337\264m\n\013\301B3c\2259\016\241\003dT\337E\203\331i\016\340"
+	.ascii	"]c{\f# P\202Bw\342\001b\300\2171\340\003\341Q1\026%>q\025$.I"
+	.ascii	"0\204\204\f\377\225\2178?=\302\357ag\"1\0315@\217;\374\356\322"
+	.ascii	"k\035\343\354\343\312\b\017T\fs\315?\250F\246\3321]\306\177\305"
+	.ascii	"f\206VYX\326\216\362 \322\271\304\023"
+	.text
+	.section	.gnu.lto_voltageMeterGenericInit.48.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375 \302M\005"
+	.string	"\262\211$.pU\323\001"
+	.string	"\345\276s\304\3725t\240\326:\236\343\247\347\0301\201\032\031\265\235\372u*\266\tU\025+\277Q\246\375\301]Bn\321\3362\005\266\250\253Qe\2209\221\225\316\212]Ub\217*\"-Z%u\360\224\\TfsR9}\337\350!(\261b\177\033\214\032{\005\377\357\350\331\320\340)-F\377e@\340\244\201\250c{'k6\300~\234o(c\001\005\374\227q\263\332B\315\273\237-p\335\266\220\300\370o\310u\230u\\\333\t\333\n\333\216\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCInit.49.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375 \3025\005"
+	.string	"rI#+pm:\240{\375\f \207\004\350\302\365\205\2676\206-\231n^\324v\312V\346\354\356\376\177\347U\316\274\275x*\357G\264\267L\001\267(\271\2500\307\214p\245\263^\262\362\325\250\036l\321\312T\341\023\")csR\236\274\336\330\031$q\362{\032\214\230\177\001\035\273\037\022.\241\304\327])\221\032\024\370l\376\357\364\354\027\255\247\351\375:\024\317\250\2739f6[\230}\227\263\203\215\323\026\n\024\335}\270q\226}\334\377\207\377\210\377\214\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_voltageMeterESCRefresh.50.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375 \3025\005"
+	.string	"rI#+pm:\240{\375\f\320\352\231\221\313\213\226TI\344\226Zl^\324v\312V\346\354\356\376\177W\n\303\274\275x*\357G\264\267L\001\267(\271\2500\307\214p\245\263^\262\362\325\250\036l\321\312T\341\023\")csR\236\274\336\330\031$q\362{\032\214\227\177\001\035\273\037\022<\241\304\327])\221\032\024\370h\376\357\364\354\027\255\227\351\375:\024\316\250\2739b6[\230}w\263\203\215\323\026\n\024\335}\270q\226}\334\377\207\377\210\377\214\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadMotor.51.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\315\n"
+	.string	"v\224KC\020\3478\035 \364\274\364\356\365\276q!\003p\376\342\262k\231\023\217\002\200\213t\007T]\207\376\342\177\267\214G\321\0076\324Zp\r\302H\004\252\f\202\023\222\3440\303\f\021\020X\230Q\315\317Z\337vJ\0016"
+	.string	"7"
+	.string	"8"
+	.string	"o\245X\333]\t\030\260KV\230\302sj\321Vp\222\265\207%`\321\221\355n\247\315\\\374\024\375\273\256\220\032U>\0236v\32735\302\334\332mK\330\346\260?\021/\263\007{\200\022\250\261}\377\365\262\364\034\2034\260\331]\356\324.\331\334\3519\333\332\264\177s\034\361\244\t\242aW^-\031\344\037\266S\317\035\266S\317i[\\\210\001\017@c\005d\007\267\22769\fd`\355.\206\277\203B\362iN}\323v\372\362\263\345\202`\325bp\2323\233DMM\306>\302j1\366\311\177\322\217*YL\303\300n\237\027z\036\013\237\027\"\"}|5\254\"\316\241\217'\002\nI\352I\007~\025\034y`7\032\001\211\272\320\007v\237\b\327\022\357\353\302Z\277\216#Ow\275cT9Xp\322P>\200\277t\r\017"
+	.ascii	"\2473\241L\2130\334GX\024\023\260\243&\t\2510t\r\347\320\304"
+	.ascii	"\0034\032*\334\006s\277T<p\347\026\355|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadCombined.52.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\225\t"
+	.string	"\206\022C: \223\322\001\004\\\f\205&J]\013\250\332K\260\327\021\357\"\232F\t\260J\233\031n\036\333a\337[\204\343\332H&\200\200"
+	.string	"\207H\017\300G5%B\215\257\301\366\260\017\331)\005/"
+	.string	"1"
+	.string	"1"
+	.string	"O\340>CG\340>-\332<\257\257\375\f\310\307\214\266\273t;\271x)\372\227]\200\325\362\270\f\200\330]KVk\344\336n{\301\366\203\375\2028\0229\273\"\265\240\275\2315)\276\313G\324\253)bXv\267\373\264Qv\367\371\316\366\245}\330[\304\307R7\330u\355\320\354\326\0063\204>]\003\264\237\270\217\326\370\354D\360\332]\007\377\245\203\303G\371\364S\334\347\307KX\210N\t\354G%kv]\311\315\304>\300\356\2567\227\375\330/\347\301J\240g\362&\006L\022y\025#\323\305\267AC\360\013K^HK\026#\fJ\002C*R\360\227\341\201\324\364} \355\252\352\262G\220\250"
+	.string	"\365\250\266\225\017\363\217\016/3}l\002\r"
+	.string	"s\311\"\3236\030\351#"
+	.ascii	"\211\t\330Q\223\204T\030\326e\036S\241\001\025\255Y]\001\327"
+	.ascii	"\362B\230d"
+	.text
+	.section	.gnu.lto_voltageMeterRead.54.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375`+\001\315\r"
+	.string	"\366Y^F\360\2226\035P\220\316\201\236\230\250\001>Bm%\372z\336lj\217\211\216\\\322\322\0075\216\002\334\307\306\202\276)\ny\222VL\322\nO\216\002|\006\236\023t\016\\p\2442\243\320\306eRBF\221\354\275wJ\001H"
+	.string	"G"
+	.string	"K"
+	.string	"\247\346l\035\007I{\026\251\f\250\232\335\255r\304\271\323)#\347\237\336A\201N\037\236S\243\243Iy,\237\026\313\345D\360\315\3600\300[\231\235\031\0219~z\324\340u1\2060\330]G\221\327\341\256n\333\201m\005\366\275\034nlV\206\3060a\373>\352!\312W\270\300K\313W\332\335\353\324F\261\257\323_\266#x\025\334M)\347\354\272\330T\353\324\240\365h\277\364\024\334aT\f`7\204\214\027\273`\002\213X\247\007\336\251N\347\tT\001)\325\351\303\307\322\206\033_\311G(\336D\030?f@\314*JiW\270\020/\362\224\240\227\020}2R\216\034\340*\325\345M(@=hp\254\304 6\330E9\262?ww-]\354\233~y\230\377\226\b\351\373@\"F\332"
+	.string	"7\032\366\301<\364\201It\311\b\006\201\344#!\263P7-\333N\260\255\236\230\220xj\211\266\325\021\003\316&`Z\375d\231V/0\364\323\033\234h\001\262#$;*G-\376\320\021\356\202\362\240Q\363\254zh\317c2\001\244\335]\340\2470P\360_\002\031"
+	.string	"2\003\302p\323\204\365\t\250\364;\236\306\342GM\202T\034\313\306"
+	.ascii	"h\260PR\213\272\030g\257\271\314Fh`1\334\013\354oj\n\334\013"
+	.ascii	"\246\246\214\273\031L\0061h\336DcPP"
+	.text
+	.section	.gnu.lto__reset_template_127.0.55.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375 /M\001"
+	.string	"\370\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\356"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_voltageMeterRead.part.0.64.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375`\324\0015\020"
+	.string	"&\035gG\360\222(\035j\032add\311\347\033\361\363%D\275\242\2369\f\231\216\220\373t\267\350\227\243#AjadAyJ\305\324\006\033Sm:2%0cX\214\336\t\261)\323\274|\316\347\0066]\030\263\210l\"wJ\001O"
+	.string	"R"
+	.string	"R"
+	.string	""
+	.string	"v[\264\232]1\301\247\021x>-\236\204\373\364<"
+	.ascii	"\367i\337\205\355S\213Qv\217\213(\36642\017\260\234\335\365>"
+	.ascii	"\365\304QW\271\241\374\330I`\035\256\037?\022\204\205\207\f\204"
+	.ascii	"\210\313\221o!\017v\327\236\021\367\274m\007\266\027\330RB\237"
+	.ascii	"\3611\3453>\300bebwS\354\323\\fwV\371\214\t\270X\253\027\273"
+	.ascii	"\333\251H\037\306\311\217\271\263}\231\323a+2\302\246H\224|Z"
+	.ascii	"c\\\006\352\260\025\177v]l\024x>\rl\235\245\274xz\214i\200\270"
+	.ascii	"!Z,\245}\230\277P\2171=;T?>:t\033_\347"
+	.string	"Rc\360\321>\215\317NDV\320Z\354n\203\232\327\020\371\256\317\217\027F\362*\220\323\300}^?^\336\224\300Y\301\274RrG\352\213u\373\266\332\2629i\275\370KN\372!%*\221\325\356\207\035\332\262\346,\305e~\373\016\026D2\374J\337h:d\362\235\200J\030\300\r\036)\004I(\037\311C\021\201F^($y&\005\ff\370B\257\004\202\241\327}[m\331\261CP\301\322\361\221R\026\253\352\213m\235p\035\n\204\302o\276\317\254\226\223\303F\3653\253\351\274\\\3418>\0018\376\r\016 \337e\n. \220\002\231\033\225\007\344$\206\233\004A\334\220\002\030S0\312'F3\006\243\023\353m\030`\307\214:\343yc*\232\253j\035i\301\201\201lm\237\265\222\247#\354\030t\223(\302\307\024t\356f\027\023\264\267\312\213L\211\327\360\037H=\206h\206&\fi\274\364$-\3546S\026\032"
+	.ascii	"\2647\222\331 i\351\tf\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375` \001\365\007"
+	.string	"\004\013\034\002"
+	.string	""
+	.string	""
+	.string	"\002*\177\021\201\200\200\200\002\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\0057\022\200\204\001"
+	.string	""
+	.string	"\003\002\300"
+	.string	"\177\023\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005$\013\201"
+	.string	"\002#\177\024\272\200\002%\177\025-\177\026.\177\027/\177\030\005;\031\0020\177\0321\177\0332\177\0343\177\0354\177\0366\177\037\0055 \005)!\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005&\"'#\"$!% &\001:\177'\377\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\0019\177(8\177)\003\b\031$\003\b\304\001\003\b\027\344\001\003\017\002\340\236\212\256\001\001B"
+	.string	"\037"
+	.ascii	"8C_Q\036}t\030\240\036>`\030h!!\025\f\227\037\030\r\344\006r"
+	.ascii	"c\311\215\240\031o\254\301\001\332\201\317\201\317\201\317\355"
+	.ascii	"\374\234\326\317\013c\r@\217\251\376@\006\360 \217\235'\bn\261"
+	.ascii	"Q\247\035\025\376\242(\264\301\304\003"
+	.text
+	.section	.gnu.lto_.refs.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375 E)\002"
+	.string	"A"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	""
+	.string	"\003\003"
+	.string	"\001\005\002\003\002"
+	.string	"\002\006\001\003\001"
+	.string	"\001\003\002"
+	.string	"\002\007"
+	.string	"\003\001"
+	.string	""
+	.string	"\003\003"
+	.string	"\003\b\002\003\001"
+	.string	""
+	.string	"\t\002"
+	.string	"\002\003\007"
+	.string	"\003\021\002\022\002\023\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f5f87d18c4b7617a,"e",@progbits
+	.string	"(\265/\375`\034#\035\235"
+	.ascii	"\312\372<7T@\020JJ\007\352\217\017\354*\335\237CkU\355rD\204"
+	.ascii	"\036\245\327\315\321)\344\241HU\037\212$vS\020\271\243\233J5"
+	.ascii	"\346\022\331c\321>\320\257|e\362Uu\240\366\211\224}\036(\035"
+	.ascii	"@h\026\013\263\377\024\220\275\037\264\334\201\005\363\377\307"
+	.ascii	"\373f\311\3362\005\333\002n\003\201\003\252\017|Be\302\277g\360"
+	.ascii	"\255\270\341\233E\361o\026\276\234\020\374\351\245\201\177\360"
+	.ascii	"\032\350\3275t\232\216~h<\2366N\332\350Y\3657\006~\177\370\365"
+	.ascii	"^\177\370\335\326a\020\315\341\367\301\347I\365\004\304\316L"
+	.ascii	"c\355\271i\261\352\324\207\304ZR\261\352\255\224L\323u\231\216"
+	.ascii	"v]\177y\203\351\270[\270\016\353\361\345"
+	.string	"\314\354\322\374\252\353\267\n\330\250\246\034\210\240\353:L\317\365 \237\231\206\003mTS\2777*yB\260\332s\266\305\364\230\367\\\313\355$\237=\2476\002=\335\b\370\262$a\372\332\302\267Gp\003\r\364\373\331*|\353\204o\221\370o/\017\201\223W\302\266\254\372\267\324\355*\235\230\317\r>\320.VJ\253\266\005\351\254\301\270qe\016w\351\265\346\322\321f\353\2617Y\227%s\316lm\326j\267+\ng\306\225\334\264\277\246\374\344d\223[3\347g\263\265X\207\3650=s\324\315W\033\224\023/\347g\320\210\021#\360\230\325\026-\254\246\005\225\020F\n\016\253\276\237\370\355\205\345e=89\247Ei>\360\017\265Wgi\264\227y\220\221s\332\016\037\246\270\031f\360r\316[ZKG;K_\271\372\314\331J\316y\304\210 \034'?\2340~\352\233\n\277g\340w\022\253.\360\245\r\364\333)\302\357"
+	.ascii	"7\225\256\322\321\020\r\366\206\366\327}L\317\374\314\371\351"
+	.ascii	"c\217\260\211~Y\365\027\340\377V^\200W\216\340\035\360;\304\357"
+	.ascii	"\356\355u\210\337o\260m\016\277\237\006\372\201h\240_o\365\363"
+	.ascii	"*\235\230\331JV>7t\022K\314\313\252-\245\271\336\317\216r\007"
+	.ascii	"\"\370Ez\345\255\234s?!`\346\314\324O\237593\371t#\320\215\200"
+	.ascii	"\372\344\n\013\354\247\336\342?\033\350\207\233\303o\005\207"
+	.ascii	"\337N\371\333\304\337\023\374}\342\357\022\376\253\277M\002\264"
+	.ascii	"\366:\277\345\372\315\177y\216\363_\234=\275\337\246\375\266"
+	.ascii	"\355\377f\373{\357\357\003\376V\266\371\273\216\315\377\020<"
+	.ascii	"\274\303o\353\026\270\317o\307\374\347\362_\315\3559\277\365"
+	.ascii	"\362\367\232\277\365\202\374\335\344o'\177;\377\326\372{\206"
+	.ascii	"\277\263\376\246\341o(j\376\366\3617\326\337\315\274\377?\377"
+	.ascii	"}\321)N\002\376-\231\377tf\376\373\355\330\337f\177\247\371\373"
+	.ascii	"\314\337\276\377^\375=\375\273\355o\265\277\317\376\256\3627"
+	.ascii	"\364\357\256\277\271\376\336\372\333\351\357\242\277a\374\235"
+	.ascii	"\374\033\206\277_\370\333\205\277_\374\275\302\337K\177+\375"
+	.ascii	"\235\3647\213\277W\374m\302\337#\374\355\301\177\260\377\323"
+	.ascii	"\377m\377\323\376\346\340o\r\376\316\340\357\013\376\343\375"
+	.ascii	"]\301\337B\377\355\376\233\371/\375\357\366\377\371\177\304\377"
+	.ascii	"\265\377\033\366\366\366\366\376{\374or\376\016P\001\3224\373"
+	.ascii	"\366\313\271\237L\032Qy\031%\302\276\361\200\321i\241Q\273\232"
+	.ascii	"u\303\310\234;\n\006\345\304\263[\334\220\214i\273u\263Y\202"
+	.ascii	"\034\261aU\313f\2770\332T\r\266.w\306\2223 ]\326\300zH\301M\325"
+	.ascii	",,Vb\\\372\313/zF\317J\034>&\303o'm\261\334^\261Y\254\026\234"
+	.ascii	"\233'\300\355Ms\324\024\211g\022G\006*=6O\3601\020|\033f\305"
+	.ascii	"\306,Z/-\370Z3\315\313\245\210\034+\2616\255\263[\264\227\331"
+	.ascii	"\311\036t\332\234\271\222Z\365h\254\231\232\225&\310\224YY\017"
+	.ascii	"!\\sP\226|iqZ5j\311,\023\236-2\260\340&\374\367/3E\345\234k\370"
+	.ascii	"\2369\252i\347\327\276n\021?O\337N \337\377\007\274\2203r\217"
+	.ascii	"\310\035fR\306\264\343 \362/\3159i\205\304\300J*i\205C\t\265"
+	.ascii	"\312\310\244\022\344\206\250l\205TBs\336\220\223Id\nf\336\240"
+	.ascii	"\204f\251\034\303\233T\347\247\0252'\231yCNf&\020\312\244\225"
+	.ascii	"\224\022\312$\265A\t\265\222\312P\253\374\223\223LQ2\2229jC\206"
+	.ascii	"Z\231\311P\246\324\217\022\312\224RB\255|4\230rOK\252\r\221+"
+	.ascii	"\275\366\242Lf\250\247*\246\250\037\251\362\311\314r9\267\025"
+	.ascii	"\0309*\201\234\253\230QrL8\332\254I\n\325$\306\304\354g\316\271"
+	.ascii	"\303S\323\0253'\245\312,f\316YM-\362\023\004\310\2474\027i)\022"
+	.ascii	"HUv\202\2213\001O9#;Ks\316\310\234\363MT\3253g\035?\312\346\323"
+	.ascii	"S\316\313\240\247\\\205<\203\221\263\2652g&\245\204^1\207\316"
+	.ascii	"\250@\2339\306\023\331\315,g\025\205\241\310\256\354t\0067\245"
+	.ascii	"l\330Y5\332guJ-\262*Q[\305N\tzfdO\323\230\250%\t\2375/Qd\234"
+	.ascii	"T\246\360\264\251Q\225\201\266\233e\016\320ohI\366\254:4t\013"
+	.ascii	"\345\360\213Z>}\232K\257kK\227\365\272Hj\324\305\030\322%\305"
+	.ascii	"r\331\2721,7SR\242l!!qKcU(;\316(Z\344\254\372\237\036~\004K\234"
+	.ascii	"4g\350\274\036\344On\202s6i\260O\254\223\216Z\247er\233e\233"
+	.ascii	"\274\235V\353\352\t\325\224\020\252\344\007V\377\213\303A\r\364"
+	.ascii	"\273c\370\277/\374_\223\246%\222\303\315H\224U\227k\315!*\266"
+	.ascii	"\351\220\224\235\n\233Z\246\246\016k)\021\f\266\364\246jzM\347"
+	.ascii	"!\315@\260$\317\030k\332\265\341\335\241\031\212\262E\354\021"
+	.ascii	"\013\3042\255\017\213\304\006\261<\254\225\275\262F\254\020\233"
+	.ascii	"\304\016\261Jl\017\213e\177t\324\022\261:nw\330\252\241\033\235"
+	.ascii	"\327\322e\005O\332\246\226\210\225\301F\365$\237Y\252g\314&c"
+	.ascii	"\310c\323m\246q2z\256\245\313|\351\244vmN\033C\331s\277$\323"
+	.ascii	"\007r0\367r\347\365\334\234{\264i\226!\315\274,\021\213#\354"
+	.ascii	"i\327\206\267e\211X\030\235w\203\225\355\332F\004\215\310\351"
+	.ascii	"\3214\266f\001\3252\033\350\247\300/\006\276\357\016\337\347"
+	.ascii	"\005\337\007\206\357k\342\373\254jX\033<R\034b\300\254z\337S"
+	.ascii	"\r5\226F?\335\005\321\262\352U0\330:\331\247\216Z\250\253^\314"
+	.ascii	"\f\315\371\311s\231\250\330\312D\374|Z\304\357*\032\276\352\205"
+	.ascii	"\257f\341\007<gkk\267-\b\347(pjS\236+Q\336\362\330~\333^\246"
+	.ascii	"\376\220\3131\304\252\267\313\313N\326%w\344\013\377\312\257"
+	.ascii	"\\\265\366\3124\372\213\213\fK\021:C\252\342\240\322~\325|\234"
+	.ascii	"m\302nX\365b\271[l\374\300+\333\242\345.I\002\205#\r\r\2242M"
+	.ascii	"7K_\241\203\252[S\326\204\314\tX\223hGo\364\236\371\224j\232"
+	.ascii	"\230i\217\024\314\016<\263\033$mh\340\260dcO\235\245rL\212U\177"
+	.ascii	"\313\376\013v\303.\331\316\b39\322.\331\035\2032%\004\211\017"
+	.ascii	"\316\231^\023\350\320\257\3305\323\002c\215U;\210\207\007\376"
+	.ascii	"\235\322\267J\025\003\350\240\234N\236d\024\034j\254z\236'\257"
+	.ascii	"\276P\350\225\001W\244\013\t|\227ud\207\035\356\2762~\377\355"
+	.ascii	"\352\n\362\253\301\356\331v&\245\243W\312\345\352\237\234\257"
+	.ascii	"\304\314x\260\374Hc\205k+\205\234\007\310\201N\315\351Pr\241"
+	.ascii	"~wt\364B\335\255\253\\\346)\022pjl\227\251\026\226U\241\3340"
+	.ascii	"\205\211S\373\201\337[=.\223"
+	.ascii	"\314\2171\323 w\210\226\333t\310\352\372\330\232\233f\335\"w"
+	.ascii	"IK\227?9I\2067\375\272Y\027\210\234\326}r\235\\\032.\223\333"
+	.ascii	"\344:;z\263.\221\337\252\313\343A7\353^\211\361\271\203R\005"
+	.ascii	"\307\217\332\343t\036\232\224\035H)\323\2743t\364.y\320]r\215"
+	.ascii	"\\\254\226.\237\271\206\316\230\231\267'\035F\360\330}\221\333"
+	.ascii	"\361\303R\322#\366\034r\306\2527\311\315\022\307\332\016\362"
+	.ascii	"HG/\0224\3163\275\323\351l1r\325\006_\007\017_g\314\025\202\301"
+	.ascii	"Ly\264\201\301\327\361\202\257\303\005_'\013\276\316\030\276"
+	.ascii	"\216\025\374_\346\365\341\203r\271k\273>:\317\302\26195A\261"
+	.ascii	"\025\321\034~\027\307\315qu\3748>O\314\204\204m\341\337e\bF\334"
+	.ascii	"\302\254\252\366\263\374\356\215_\252\037\307\256a5\237h\300"
+	.ascii	"\2776\356\324\217\323#\247$\332\205\205\177k\204\355\335\345"
+	.ascii	"\260\352\225\3020t~\204\310\341A\346c\207U\177\245\376\033\325"
+	.ascii	"{\375L!\347d\013{l\322X\225\2479\374\232l\350\227\206N\233\226"
+	.ascii	")\227U\257\203\304\2773\372:E\257\323\235\321b\222T\221\360\255"
+	.ascii	"\311Q\347\234\303w\206\315\221\013a\3174\341\001\345\312\270"
+	.ascii	"\211\301\246w\303\252\317\035\0324\2160\2572/\205\234\267|\262"
+	.ascii	"d\2735\253^\030\027\206\215\023#\003\224\323yE\310\233\023\261"
+	.ascii	"\213\274\310\233\234k\342\273\035T\314n\323o\322\312\3133[\365"
+	.ascii	"2u\336\016\2332\315g"
+	.string	"\016\223\275\2750eM\2360\031S\304T\261ac\247\235s\030.(\2473\007\255\2516\306\252\317Q\352\351\331iW\321\321\223\307\234\341\234\346\275\2436\317\202u\300\3146@,y.I\250h\224X5\255\245I\003\246M\323\347T\247\027C\025;;\213\006L\031(\247\023\307\312\215\"d\354\335-\032l\004\356-\210U\355\031\373\3544.\"b8Lp]\235\235\342<e\013\312\211\367[C\365dw4\267S\337[\226\022\260*,'g\351p\356\271\242\253\022q\023&G]\226\230[:K\006H\026\036\0252cv\252\3040\225l\263shH\264\314\365X\216\\\263\214\222\316\363]\325@\006G\306\227\177\261q\235\243r^\346\013\347\204r:}t\244I\233`n\343p\2324\033oQ\002i\030,\036\215B\353\321\222\320h\030\024*\032\227\204\004\020\n\227\206C\342\360\346X\364[\201Xlq$\016oX"
+	.string	"W\241z\\\215Ik\322o\030\004r\300c\\\223\200!\030\217<\3609Z\217E\242\222\322\222\221\200\027JD\"\020/\200\305\"\212\004\216oQ\002II\bI\211\203\321pIg\310\302\372\214E;\307\242!\222\222o\210\244t[\034\221\206\253\360\267\266\0204\252F\343Z<:\002\336\274P\"\032\251\305\243\322=Z\207HA!\360\346h5.\251F\253\361\346\305\"$\245\022</\212Gc\020i\035\241\350"
+	.string	"% \b)< \036\211R\240\310\351\243u\030\\\221D$:\002\026P$\036\211 \034\001\203Th\240B\003\016\222T\004p\f\016=8\002rha\\\213,\326\021\210R\2400\341\270\"\001\320@\211c\021\250T\342\b\270\2160"
+	.string	"\207\006JH\340\300\220P)i=\026\035\213\200\212\206\033\034W\343:\002\222\022\210\033\005\213\353pE\302\207\300\004\003&N\260p\363\023\0244@A\003\277\237\240`h\210\002\023C\370&\206\356\321\b\264\026\035y\360\263\026\035\213kP\250\024<\n\227\222\002 J\201BE\320*\004\032\031q\204@\027.\202G\306\265\310\363\026%\214EHA\026C\"\013\300a0\t\200\025\0048\016W\343ZT:\022\207\035\214\\\by\326\""
+	.string	"\326\242"
+	.string	"V\243\342\022Q\305q\270\026\213KF"
+	.string	"\2748\006\215\200J\300\025>G`\006&\254\306%\036\343\261\270\nQ\020\255\306\245"
+	.ascii	"\206\253Qq\025A)i\3118$\032y0\006\215\306\027-z\204\302\325H"
+	.ascii	"(\\b\301\3418\\\"\022\t\205+\321\213\342z<\0023X\215\212D\026"
+	.ascii	"@\001\034\021\203\305U\004\026J\037\034\201+\202<H\303\340\260"
+	.ascii	"\b<\341\304\215\020h\024<\006\213DE\342\006Cb\360\b,.\2458\002"
+	.ascii	"W\270\030\340X\324\363\026B\"1\203\"\037\013\026\304\343\022"
+	.ascii	"\221\t+\020\205?\306\242\236\243\325g)\347\370\017\307\267(!"
+	.ascii	"4$&%\021\215\n8Qi-\n\035\211\304\242\220\216\nm,\032:*\351\030"
+	.ascii	"}G<\306\242\365\b<\252 J\201\242\270\036W\0206x\001\024*\031"
+	.ascii	"\203)\0048\026\231\030:\016\203K\370CCD J\b\201\003lTB\310X$"
+	.ascii	"\032\207\253Qh\030\004&\t\031\025\215B%<\034\255\305\365(\f\262"
+	.ascii	"\030\226\260\"\001\217B\242\213\rE`\013#\265\351-L\236\232.\225"
+	.ascii	"\251\325t\260\260,\355T\344U{;\243\007\306\252\267\355\206\t"
+	.ascii	"\223s\357\356\201}\201\023\373b\333L\245\\{E\330X-\331\027\303"
+	.ascii	"\226\235\334\232\017(\230Yj\351]\2562E\244\276\250\261h*\362"
+	.ascii	"\216i.\017O'\f\225.Q\253\376\342\375\267\206\233\246\237;dlS"
+	.ascii	"\204XUD\003\375|gC\277hT 5\320\230\341\356\214\216\037AfX\365"
+	.ascii	"\367\f\024\207\214\210\221\251Um\326\320\257]\005G\200<\261\252"
+	.ascii	"\364\367\213\364No\334NFze\0327ejuixY\271\024\241\323%C\227\227"
+	.ascii	"1\277\323\337:\007\"8\235S+\216\311\252\267\314/\335\222\rmJ"
+	.ascii	"\346\322\37589L\202@i \203\317\200\027\225\224\224U\357\334\351"
+	.ascii	"\236E\347d\306\252W\314\263\354,\303\340\r\271rmWpMV\275`n\\"
+	.ascii	"G\277v\303\274\007-Ft\r\f>\f\375\265\337}\373\205\373qp\320z"
+	.ascii	"\004\261b\363\362\343\334\200\305\355h\246\341\007\202\320\250"
+	.ascii	"r\3314\210\362\030B\006\321\314\310H\222$\0352\n\020\204\203"
+	.ascii	"a\242\211i\017\022 \0051\317:\247\320\220\310H\222\244\264\354"
+	.ascii	"\031M\004,\366\252\205\036?\355L\230\346\260+\233\250\211\345"
+	.ascii	"\252%O\034y\302\033\206_S`\022s!S\344|S\004x\322\372h\214\230"
+	.ascii	"j}\237\265\244\005\304\334\321\005\177\246uD\324\252\232N\252"
+	.ascii	"\276B\3644H\f\266\2044\254/\370a\211S\257\t!Z\377W\311S|\263"
+	.ascii	"\332\221\206\007\001\247P\304b\016\305B\366B_\316xB'S\303)\340"
+	.ascii	"\350\035\306\004\023|\222+iq-\203\020\311w8T\252\355\340a\213"
+	.ascii	"!(\215\222\264gzz\210\r\321\021\301\274\346*\307>\002\311\331"
+	.ascii	"\221\300\206\363\350\213\031\301\f\325&\300tE\211\031\255\342"
+	.ascii	"\322wa\224`Z\005\262\377\362v&DqCp\2669\031\370\312pR\303S\267"
+	.ascii	"44v\307\200JE\374<\224\005\203\247d\322\227|\266\0043\367_\207"
+	.ascii	"\016\250#\316\\\253\035\324\035pdC\276\365\205\231;Rp`\007\""
+	.ascii	"\353\333\224\025\255\216\250\214L\3023\037Y\0312\3406{v:_[c0"
+	.ascii	"n\217gm\306\013m\313E@\220'\330\345\204\342\177\321\257)\337"
+	.ascii	"\253\361L\303\376\032\001\367;\207\273\212\0024\321\001\232\306"
+	.ascii	"MF6y9\360\037x\251Mv\\\024fdo'3\270\215B\024s\030\274f)\202\354"
+	.ascii	"\314\363\262\031\366\347m_\367\026\233\330\345\372\256U\212\250"
+	.ascii	"O_5\331\220\301m$\2705`\261\316\270\220\272\r.\003!c\265\230"
+	.ascii	"S\375\211\354ic\007\023\234\226_\331\360\350u\246o\270g\2656"
+	.ascii	"\356\030\232;6>\022+\342\316\266"
+	.ascii	"!\260\325\277?7`\253\231Ex\033:\312\257\326\026\234\301&\313"
+	.ascii	")\267\275\210\245\375\3277\321\327\037Y\356\016\221\310\031\301"
+	.ascii	"\246\203\236jy\231z\317e\201\233\023n\b\nD\274\036W\016HY}\320"
+	.ascii	"\233\307EPc\215\250\"\032\373\036~\336F.\240\213\226(\3577\206"
+	.ascii	"\036Q\340\331:\312\323\267\007)\316\356e\016tk\363\006T"
+	.string	"\243\223\3472E\300\377E\333\314\255\276\023\026M\376,\241e\322\007}!y&\006\303\350-o\326\363\225\3764&Ess\231\024\325xMY\264Q\322\255j\027\341\034\377\345\333j\t\307\214j\273op\367U\022\003{\353G1\243\213\307W\013\210\013\035\256\260\326y*\277c\204.\204\210\300\017k\"\313\332\212\335V\202\360\025g\334V\003\367HT\245\325\265\325\005z\3766>\177.HL<E\027\212\304x\213;{#\336\351\261\371\312\330H\357\216\253\2028\317\210\016\245\020H's>\270\251\201\203\330g\302\\vo\365ylA~#MT\372\220\273C\032\252\344\3170\255\323\032\210:\212MJ\314\377zM\340*\006@\027S;VzD5\016\013\235$`%\1776[\036\030(3\341#B\350%#4\313\2062\324\003\227v&\032\3016\266\321\201L\303B\374\260_tMk\304*\026G\221V\r\336\255"
+	.string	"\2566\230\001\017\037\200\202NC]\203d\004\352\004i,\213\207<@\312\247.\317\005\234\016\377\305\351_\216R\271\2152\266\356\t\343\315]\357\250L\243\350i\021\226\304\357\306\344\037\361\210\325\300[\306}~\247\351\372/Dv\033\340_?\312G\207\325\3067T(2\365\307#\311\271i&.\216\227\341\313n6'\3340_&|\206\013\030b\367\300p\204?\n\023\300o\f\3408MF\251U\026g\3237\372>\254\027\300(\361]x\307B\033\357{\001Nl\246\326,\243V,\314\353\222\374,D0\273\347\314\332%\344Z\304\357\004\345\244B\302\203\365\215+Q\312\256cD\r\005\2203'`\372\013\361\023 \303\005\262\232X\257(\\!t\203Wf\210\334(\r`\324\230\243\177\225a\021\226:P\214\005\035+\201\305-Z\356\030\203\324+f\375\272\003\022?\361\026"
+	.string	"\340&\3705\344\233&\200\332\345f\027\034\274mb\212&\304xR\022S\366\245Y\371;J\301\235)\0211\234#\036\n?\322\030b\024P!\006*n\363\204d\340"
+	.string	"\b{z\235@\304aHQ\t\321h\305K}\275<\3463\364\001\336\031\221\324 \241\245\"p\261\232\226\002\222\265\367\306\326\230\210\372`&:\253\367\005X\351UN\201\210\345Xm#\356\302\020\006#D\033\216\351L\2566\0033\305&tF\005\313"
+	.string	"1\030H\360\221\374B\r\347F\017\245t 9\323L46\341=')\310\266\255Y\365\306\020f\026(\311\230\210Q\261j\026X\025\030\326YF\230\367\374\331~e\001\035\234\331\201\231\221\343D+\272\321\"f\236\\\224\314_R\221R\031\030\0278[\240"
+	.ascii	"\251\025$?!\016I\242c\211\025\250\004\002\330D\273%\003\024{"
+	.ascii	"\315pT\2032\357L\036\327X\n\257\324\214\264\034\362\354\337y"
+	.ascii	"pVN's\211\320pT\303\216\336N\321\367\373A\002\034>e4\003D9\324"
+	.ascii	"J\314\232\370SJ\304M\203H\276\273\\\234\3769\035\032>\223\253"
+	.ascii	"\210r\367\310\354\326\335\246\324\326\344\254D^\361\252\347\304"
+	.ascii	"ox\016;\371\205\374\230\330\246<\3113\017\210\007p\311#\377C"
+	.ascii	"\360\311\375\230{\335\347\263\341\"\257\276\177f\256\353\033"
+	.ascii	"\226\270|\214/L8}\346\356 \273\317o\322|\340\032\032\006\b\243"
+	.ascii	"\027\271\245\317\246\311*\237\252\376\242\004\342Q7O\340\265"
+	.ascii	"\331\307lie\303\276e\262Y\215\315\321\204\346I\367:\332\316>"
+	.ascii	"{\256'\337\273}&\342\257\036e\222#\203\262\025"
+	.text
+	.section	.gnu.lto_.symtab.f5f87d18c4b7617a,"e",@progbits
+	.string	"pgResetFn_voltageSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"voltageMeterADCStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"getVoltageMeterADC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"voltageMeterGenericInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"voltageMeterESCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"voltageMeterESCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"voltageMeterESCReadMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"voltageMeterESCReadCombined"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"voltageSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"voltageSensorADCConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f5f87d18c4b7617a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,587 @@
+	.file	"sim_heli.c"
+	.section	.gnu.lto_.profile.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"u\004"
+	.string	"\344\004\243\001"
+	.string	"\007"
+	.string	"\333\336\365\302\016\f\002"
+	.string	"\002\001\002"
+	.string	"\002\003\001\235\341\243\256\f("
+	.string	"\003\241\261\246\345\007\036\002"
+	.string	"\002\004\003\274\357\207\303\003\006\005\002\003\004\232\323\322\261\001X\002"
+	.string	"\002\001\003\001\007\002\007\003\005\245\303\241\217\003\b\006\313\276\352\271"
+	.string	"\034"
+	.string	"2\253\2527\306\260,\004D"
+	.string	"\001 \0330\036@\342&"
+	.ascii	"\340\007V\314|\360\324\003\360`\345\301\013\004\241\017\256F"
+	.ascii	".\235\360;\2570\005\007\201v\004\207\201\2632\237\331\275\001"
+	.ascii	"\274\257\201!"
+	.text
+	.section	.gnu.lto_.ipa_sra.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375 \253\035\003"
+	.string	"\224\003\237"
+	.string	"\007"
+	.string	"\003"
+	.string	"\005\001\001\001\001\002\001\001\002\200\002"
+	.string	"\001\003\001\001"
+	.string	"\001\004\004"
+	.string	""
+	.string	"\001\001\001\201\001\005\002\001\002\t\002"
+	.string	""
+	.string	"\004\001\020\004\006\f\003\006\020\004\001\020\004\006\003"
+	.string	"\022"
+	.ascii	"<'\002a]\256\002\232\350\205f\334\262\300\341\312cC\341\003\226"
+	.ascii	":\215\301\264\251\0241\bVe(%\\0\310\006\260"
+	.text
+	.section	.gnu.lto_.inline.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375`\232\001\355\b"
+	.ascii	"\342\317-.`k\222\016\300\004\004\271\225\240RT\t\023\250\022"
+	.ascii	"\016\205y\257\253\b\350~?\357\231`\251\202\2500\350\034\240\031"
+	.ascii	"\220\312j\337j\373d\313\235\002[\235\247\260?~L\245\330%\332"
+	.ascii	"F\013\3667\2046?\013\245\266\316\016h\r-^\024\376\201\031m9\301"
+	.ascii	"\337\241\321>\bVH\255]\254\336\036Z\002\352\257\234\324\026\362"
+	.ascii	"\224\273L\333\347\373-\247i;\300\267\013\t\346\320\212\\\302"
+	.ascii	"db \221\314\310\025\265ZM\006\266\2555\320\242m\301c.\232\246"
+	.ascii	"MD\300\177\031\366m\323\334\017m\207\3064m\306\330\240eo\221"
+	.ascii	"\233\026Jm\364\274\303\255\266\b\374\303\334F\033\035<\300\244"
+	.ascii	"\b+ `\"CG=\354\016\305-/\326)\310\2570\212\313\364\344`\263J"
+	.ascii	"es\035>\336u\255uO\202\245\007\260\337\n\207\340p\201\256\274"
+	.ascii	"7\350\307\\M{\035\360\305\316X\007\341~\271(\230\002'\016\254"
+	.ascii	"\"\334\347\315(bl\217k\032\351%\307B\307\203\177/\225\361t0\017"
+	.ascii	"\257\0358_\016\347\36647\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"\r\004"
+	.string	"R\007\023\031\300\245\320\001\377@\340\267\377\377\372\321\377\342\267\3377\320\fi\273\311-\223\f\232\247b\002tc\336\230=Bq)e\311Y\326\023\377\244t\320a!f\322\205'u<4\217\265\312\021\341*?\301*\353\340\367\266>\311j\370E\001\255\024"
+	.string	"\2565Rc\371\031n(\376\030=\fP\312F\f"
+	.ascii	"\006c\0030\bvh\340\242.7\304\327\031\270\346Ee\022S9>\2639\212"
+	.ascii	"\204<\303*\300\020"
+	.text
+	.section	.gnu.lto_.pureconst.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\205\004\006\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"E\007"
+	.string	"R\013 $\220'I\007\377\340\235\345rW\351sjw\251\342\235\177\373\376\013\277s2\273\201\215\020\032h\330\326\310\2262\005\037 $\030\034#\3555A9\345\360\370\272F:\257L\tb\363t2\275l\177d\302rRJq\2100\013\r\237O{\230\007\330\226z\267<o.h*\252\251\272"
+	.ascii	"7\322\030\237\231\271\240Z\030V\024\223\2533\357\255\340^p\257"
+	.ascii	"P2o\033\200;\200\374\031\f\244A'F~\017\001, P\202!t\326\003\002"
+	.ascii	"\206\013\300\351W6\240\304\031no\347a#\035\275hKQ\220)\002\n"
+	.ascii	"\222\321ErW\004\242\007\266\277\354\265\230\027@$\020\030\206"
+	.ascii	"\370\330\225>\216\275\021f\025~w\372\324X\214{M\327\274\260\344"
+	.ascii	"\250\b\341\231\006J2\207\344\377\266\267\221\264\200u\375`\303"
+	.ascii	"Y\264_\361\024\253\025\306P\340"
+	.text
+	.section	.gnu.lto_.lto.4e1742033dcbefe1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_simHeliDefaults.2.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375`[\003E\020"
+	.string	"V\231`H\340\262(\0350\343\314\213>,fCC9\002\204\204!\313\220n\252\030\267'\266\215\360\033\2321_@jMm\\\221 \264\310\337\320\327\220\305\021\342\234y&\216\261\322\022\373\206\t9\003\024\007F\205\220\225DnKvJ\001E"
+	.string	"K"
+	.string	"T"
+	.ascii	"\276\264\357\342/R\227Yy\201\335\020Vcw\354\314\200\373\364\370"
+	.ascii	"\003\333'\367\221\355\323)[\207D\204\200\230\0214uw\251\346z"
+	.ascii	"\3522\345\037\306\001\264\270\260\\\206H\330]\313\026\027\023"
+	.ascii	"\267v\333%\266\035\330Z\220\020B\261F\326\202\365\351p\032\372"
+	.ascii	"RaG1\356\256IV\273\252\022\333\303g\f\343v\267\201\037\343\003"
+	.ascii	"\210\0018\257O\177e\373|\360\"V\225\234\331#\213\324Z\366?\253"
+	.ascii	"\205\366e~)\002\3221r\263Kb\326\263\261y\203\005\310\0160\004"
+	.ascii	"8\273+\262Q.\363>OT\210\273\215\356C\301\253\262\002|\217\321"
+	.ascii	"\027O(\345=\250+E\316\314\310C:\217\316%\332\030\300\360\035"
+	.ascii	"\035L\255\245\343\200\021mDL\267!j\325\022\333j\303i\264D\326"
+	.ascii	"r\247\317\020\205\365D\215l\2140\233\365\2548\\F\247\222\007"
+	.ascii	"z*\233G&\244\f\337\005\224\022\351D)X\230P\201\242\276\024\320"
+	.ascii	"CQ\r$\257DG\340\211\232$\260I\345\003)\312d\002)h\334\177V\013"
+	.ascii	"gLL\245\205\b\351|\007\210\274sl\237'+v\b\254vU\335s~\330\226"
+	.ascii	"\013~\343F\250QH\210\326HRVA\241\341 \003\021\251\321\001\021"
+	.ascii	"p\030\206\245\222\002\nDr\353\030S\bX\261n:\341\017\205P\371"
+	.ascii	"\266j\267\017\242\331\200\024\330\345\354)\3048(\333\274U*\324"
+	.ascii	"\006\344ti\\(\036\356\274\204\202\262ZF?\335\003E\261\367\271"
+	.ascii	"X\350\265\210\271a\242>3K2\3752N\337\204\021\r\277\020\032,\006"
+	.ascii	">\345\240\362\243\342\361\375\343\020\370vu\b\204\311F\320\254"
+	.ascii	"\265\342\350_\264U\r"
+	.text
+	.section	.gnu.lto_simHeliInit.3.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375`\325"
+	.string	"M\013"
+	.string	"\366\024NC\020o\225\016`A\244 3\271G\332>Xll\225rL\023\323\2622\007"
+	.string	"\362\rM\315\306\267\230\365\001F \204\305\026`\202\020\220\023\002\023\020\201\244Hs\257\237\300\r\220R\237V\302{\376?7\332;\2457"
+	.string	":"
+	.string	"<"
+	.string	".\021\273b\210E,\247\026\257\311N-\337\310N\r\332-<\032`\244x\320\032w\267N\n\007/A\377\033~\tQ\246\313\n\311\356Z\206(\t\367\274\355\215\355\217}R%\356\023\031\347r\332\b\024\310\207\326\220\2009\230&[4\3119\301>ew\3273e\237\365\313JFE\207\207\335\b\261\027\013\243#,`l_\332\317p\r\340Y\245k\354\246\002\243\213\177\270\313\257\f\026\243\203\340\344m\";\345\2540\370uK\006\273\247\215\355\316[~q\250vw\3046\360\016\236ew?\034\022\034\310\250*\234\372\245\354\264sa\034O2f\212t\332\007\372<\352\220g#\240\r\b0\332\274j\002\240\344\244~\232\200\016\364\325\002\033hTC\235W=\037\346HZW?\216\353*F\334Sv\246LQ\300Ns\201/\020\302\025\027e\366\366\020\"\220U\022"
+	.ascii	"2\241\201/p<xb\027HB&P\b\0340\362\304#'\264\301\005 \016\367"
+	.ascii	"bL\377\366l!\030r\t\266YM\twx\321N2"
+	.text
+	.section	.gnu.lto_simHeliDecodeSwash.6.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375`\316\004\r\036"
+	.string	"Fw\277H\240\330M:\3023%\"\353\314\313d\017\025\323\323\361\216\224\331\200-\017<G\004\247\312G\307W\024\357\277\355%\352kY\306?C6}\n\032\360\303\032k<3\266\b;\177i\177h\036\031\346\261F\3727id\023\271S\n\250"
+	.string	"\236"
+	.string	"\253"
+	.string	"\3646\320G\362$\347rm\213F\006-\023\r\320ju\"\344\353\302\215\374\b\360Y&\226\301\027\002bT\315"
+	.string	"SkUpj\n\345\251\201\261\210\022W\2049D1\300V\205XT\017>\355\0179\021\340\257T\\\247V\033d_\265\016\207\354\240<\365\360\001\310\323\362"
+	.ascii	"\310S\003\355/\037\346\250\263*(\026G\312\324Zo\213\303\373q"
+	.ascii	"x\217\023x:\356\004\372\263\t\\\017\232\322\342\024\025<\035"
+	.ascii	"m\265V\234\250\025c\203\371\024\3054\307\0372\276\367z\002)1"
+	.ascii	"\247(\031\237\263\t\265VO\247(\0307y\333=\3339{\364\022B\b\366"
+	.ascii	"\321\233\360\312Z\205DL0\214@@\266\003\005y\372=\330\207\300"
+	.ascii	"\272\314,Y\232\305\335Zkp\367\206=\f\316\327\265a\013\005\321"
+	.ascii	"i\240\037:\355\323\363\"\177\201\177\335<\037\376\004~\365\007"
+	.ascii	"x\327\275\243c\313\241\3238t\372\206N\333\320\351\032\235\256"
+	.ascii	"\241\323\264g\335\345\265\356\331\267n\222N\323\235\036\311\351"
+	.ascii	"%\247'\235\376\001\322I\225\001\305Z]\024\321\3241\272\244\307"
+	.ascii	"\277\376\256?\353\327\372\267\354\023}0\327\276\222\236\252h"
+	.ascii	"\200\351p%\276\227k]\016+\203/J$XS\034\312\007`\247\371\260\362"
+	.ascii	"\332\236=\327\313.VP\323D\333S(g\237\206\276\263\277\302\342"
+	.ascii	"\"\234g>\216^\360\235\025\332{}<#%\006\264\266\r\332\213\251"
+	.ascii	"m\315\002\355\206\351j\253TC\270\301\232\355 E\306gu\366g_\326"
+	.ascii	"DE[\272>\273R\232\200\330L\236\265w!\346\235h\353\223%dL\270"
+	.ascii	"A\347,\335\236\235X\232\250\230\376\244DR\351+\221\247t\3774"
+	.ascii	"\2654\213\336-\260\343\276)\310xG!\347\356~g\347\232\220\322"
+	.ascii	"\302\"\315\022\361Pe-jTK(\026\307\bk]\022\372\362\354\364\322"
+	.ascii	"\004\204i\0269<,\211\210\254\326E?\022G\273\023\270\331\356\272"
+	.ascii	"\022\273_Ngd\304\313\325\030\031\361zcQ\356\267C\242E>\\\222"
+	.ascii	"\217\372\216p=\034\022\251\373\341~>\352\034\203\235\221\256"
+	.ascii	"\350\303\321\316w\303\260\301\202\206\333O\007\242\207\373\335"
+	.ascii	"D\354pG\267\\\317wc\020d\036\222\256w\373\361x\275[mX?\352li"
+	.ascii	"\333\331>y\034s\226\254\360dli\231\214\263\266\207o\351\232-"
+	.ascii	"\316\232\230\242r\263\366\207g\231ac\2717\233bJlm\334\257\230"
+	.ascii	"H\344[\331\220\273\311\241\202<\235eNat\204\351\030KC\256\r\235"
+	.ascii	"1E\244{\3033(<\246\202\357\240\261\232\262?5At\3122V_6\210f\333"
+	.ascii	"\247\007]\250QPD\0243JI\211\004\005\211A\322\030\300\002\021"
+	.ascii	"\242\233\007\021\300)U34I\255\326).\361.\245E\243-\363\253g\205"
+	.ascii	"f\034\374\330(\211oG\200\331\252T\322A\361\005\201]\0033<\226"
+	.ascii	":\271\n\270W\234x`_\017\321\215\331b\373\223\372X\2306\357\237"
+	.ascii	"1\255\263\200\270\321CB\b\266\201\343\026a\242\301\037\205\220"
+	.ascii	"\302\317\221mB3c\274s\256J\017\261,\341\240^=\024&\314\0244\022"
+	.ascii	"\247\305\207\210\n\350\272\241\nMA\325\333j>`g\251\202\217\306"
+	.ascii	"\322>n\033[\304\236\003(\262cCP\345!(\255p\270\001\006\001Pq"
+	.ascii	"^\b\250z;\235\fA\272\325f\317\361\247\223\316'\376"
+	.text
+	.section	.gnu.lto_simHeliIntegrateAttitude.7.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375`A\n\3650"
+	.string	"\372Z\320\022=`\352\311p0\245\032\374<F0\261\234\206\322\260\334\003\327\204\221\236\216'\025U \214\306w5M'\fwaq\006\357\020s\200\320\004\037\337L\200\325\232\343p\362\247v\322\310\336)I\031(\001\357"
+	.string	"'\001Z\332J\332z[m\353\302P\"\323\207\252\3174\225\364I2\371\224x\\\326\316\256\232]6\273nv\341\354\316\355\326\355\336\355\342\355\322Y&\325U\335:\272w\264\311\216\346\001\325\226"
+	.ascii	"\333\244\251"
+	.string	"\213\001\334rw\315\266\3317\033g\351\326n\345\354\234\315\323&:`\342\302\360\320\252\330\302\304\265\270\023\263\242N\353\326<\227,\025\031\222Id\232r*\346\260\244\2003\346\356\204\033\264\252%\323\274CwW\202\315\023?e\276\324\240\001\325\226D\021\251\320%2M\363jK\355\240j\271=\223\266h\324\216\024`\026\207\305;\3234\203\272\001\270e\025\271V]2[&m\315\b\331\001\246Y\005\321\235i\312\005u\013\270\245\312\255\201\337\226\300\205\372m\251i\252\210V\016\316T\242\262\245\310\232G\246i\n\177E\311%\345VI\247mI\336i\272yk%\305\021\261MmK\022@ /nOmD\310\013P\346\002\355\235u\261mh\262K\223\375\336\331\no\216\210mM\326J\"L\323T\023\333\230\254\376VU\315TU\206*\023\216\367\272\351H|\357K\2559\217C\367a\255\036\265\203\300\245Z\266yz"
+	.string	"M\323\324\200g\210$\037\013\006\231\246\271Z\204\374\266\334/u\321\023\006o\315}\252rj\276\225@^\240\334\351\253\250\206\255\232U\026\313f5\305\272YE\261pVO\354\334\252\211\255[-\261w\253`\213\267\372\265tV\275\026\315.\2115\263;b\355\254v\331\n\302\326\017\266z\260\265\203\255\034l\345\262u\203\255\032l\315`+\006[/\330j\301\326-[\265l\025\332\232ek\320V,[\257Jk\005\322J\201\264N\260U\202\255\021l\205`\353\003[\035\330jek\003[\253le`\353\002[\025\330\232\300V\004\266R\331:e\253\224\255\007l\215\262\325\200\255\005l\205\262\225\200\255\003l\025`k"
+	.string	"[\237lu\262\025\200\255M\2662\331\272d+\320V%[\177vW\025\033\373-Q\302\253\330\256\246\020\376\340\021N\002:\215\f\016\341\t\370\316\243\203[\375\301\247"
+	.string	"\235\306\251;8\325\241\363\330\340U\267\272R\336i\204z\203K\3519\275\352\213\367\266\307\340\272\212\026\234\201\202'\370\202\237\317\353\n\020\234\352\t\276\216"
+	.string	"\354Tw\361\266g\352\272{R\237:\360\250K\031\275~\300\300\013<\n\354\006\276^\340.\336\354@]\367\020\201C\r\270\200\023\370\372\200"
+	.string	"\177\272"
+	.string	"#\330\003x\375\351.\336\354\234\256k\350p\304E&\016\340N\337\274\323\330t\246\003\370\371\316\270\024\007{\323I\275\363\270t\340\231\356Fg\034\212\177}\351\317\363\272\322\201'\256\364\017om\316E\2120\244x\311\267\247\205\342\344\241C\272Z\260N\374z\206\206HR\273\003p\023V\353~[\232\270\213({E\267\265%DV"
+	.ascii	"\216\250\212c\007\351\210*q\256(\202\210N~\007+\377[?\013\350"
+	.ascii	"\217W\363~[\226_\352\242\027\206\374\327O\006\227\317\236C\302"
+	.ascii	"[\263\333$|H\246\230\246\206\350\353c\304f\232k\016\034d\013"
+	.ascii	"d\314hc\0162\346\036\373c\201,\332\006Y\035fe+x\220\325\0203"
+	.ascii	"[:\263a\2613\032g>J\255\221E\226C\354\306\f\035d>\204*\302P\274"
+	.ascii	"\020\236\211\215\231\3218\023\356 \243\241CX\303\314\2070\313"
+	.ascii	"J\313x\210\231\t\317\312\312\314\204Mr\346\276\212\232(\303g"
+	.ascii	"\355C\005q#9\362\001D\334\320\303?\234\244;\217\035\316\341\036"
+	.ascii	"\214[\357\360\037_\360\301s\370\036\245\354q\005m\244\310\206"
+	.ascii	"six\206o0j=x\rY\317\360m\"E\020\206\233M\355\002\320\360\320"
+	.ascii	"\tN\217\270\210\274p\f\026.\374\205"
+	.string	"\227tg\334\326\265n\341\277\275\255\377\364\212nk\206\264^\002*\272e=x\341\311\274\3638T\224\025\374\346-)I\312\236\242[y+\252\204\347a\177!_m\327\213]_3i\n\2619\322\222$\326v=\354A\336\034\235F\254;\261\370\325\261\276\215\316\3430RZ\026\265\003\352\325\267\350F\341%^\341{~!W\363\374&\234\302\367<v}\302\367\316\222_\336\372\212LZs\337\017e.P\227\253\204\253\335\232\005\236'G\b\200\271\250a8$\2213DC#\005I\n\222\346\320\002\221\241!n\003\022\340\004e\210\031bjl9\205\245,{\007#\330\006\372\367'-\361}-\341\021\323\216\251oC\310f\003\320\036\342H\265%\b{\035\266\027\374d\203\021\253\271\277\0303\236Ks\322\321\254\267\235%\3223~#c\230m\232\254X\224\266\177\310\027\246\247\027T\330\305e\202G Q\201\366\260\007i"
+	.string	" X\315\002h\031\2210\320+\006\340\201\201\210"
+	.ascii	"i\351\240D\034\271\355\240O~\036\n\205\342\bI\240\225\362v\315"
+	.ascii	"\311\237\363\306\200RVsd 5\344P0\037\331W\242\327\245\034\323"
+	.ascii	"2\22326'\341\3047,gm 2\001\177\351aA\270]y\031\022\266\007\""
+	.ascii	"\303\370\f\212\326g\360_~%\227\301*\274\246\005\330\\{\013z\003"
+	.ascii	"\246\214\004L\025]\370\301\021\256\274\233\363\274\212\353\007"
+	.ascii	"\f\017\215m2\276\332\334\336b\243\320\302\253\344\"\\\230C\\"
+	.ascii	"x|\201\213\224\353K%\365\037\002\354h\344RDoX<\"\360D\222\346"
+	.ascii	"\235\350\336\222\355\177\253\037\265;\230A\271\332N\203\013\335"
+	.ascii	"\005z\002'\333\261\t\363\340\212\202\200;\365\344\361E\021\021"
+	.ascii	"\024\320N`\205\301~\0028\300\001\345\034c\022\025'\244!5\240"
+	.ascii	"\241\202\210\215\242\272\377O+\235^\376\003"
+	.text
+	.section	.gnu.lto_simHeliStep.8.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375`l\026\245["
+	.ascii	"J\235 !H \222;\031\016X\005\237\033F\335\314\352\037\032\242"
+	.ascii	"\034\320\314\212\211\2453\2303\233\231\202\020\302\322\254m\231"
+	.ascii	"\337\r6\204"
+	.string	"\035\310\027l\221t\004\330\367\335ggD\315A<\fP~17!\311\234\334\276\030\t!{\313$\245\f\350\001\331\001\021\002\315\272\243Y\247\232\025\201f\325\321\254\0074k\216f\225jV\034\315\032\325\2547\232\025\252Ym4k\215f5\240Y\013hV\002\232u\200f\245\321\2543\232UF\263\306hV\030\315\372\242Y\237\232\325E\263\266hV\247f\025\240Y\233\232\225E\263\256hV\246f\r\240YU4k\212fE\321\254'\232\325D\263\226h\326\245f%\321\254#\232UD\263\002\320\254J\315\232\324\254\301f\0056\353\257Y\313f%\233\265\233\365\315\312@\326]:I<\020jAg\232g\216\220L=\262\316\204\315\263\253gw\317.\237\335>\273u\273~v\377\354\002\332\305\333\r\264+hWoE\250.\243\037\303\273 \026\251\335\325\311au\350\262\205\264\207\331\237 \272\250\356\231\361\251\203\210\347"
+	.ascii	"\341\260\206T\225\324k\013\351o8W\3074M\245%U\275T\225\226,W"
+	.ascii	"\206\235a\347\226ni\330\032\326n\357\326\206\275a\363v\320\022"
+	.ascii	"R%\275\035\322\004\t\201\026h\2103x}nb\200\"}\375!\036/\360\203"
+	.ascii	"\306UW\334\322'\r\213\017\033\226=mT\364xy\n[2\311\310\314qs"
+	.ascii	"\222\307\013p\f\032\025cktx0M\263\306\222z\004\3300\254\034\330"
+	.ascii	"\306\240t\275d\222\021o\350c\232&\224\022\001.\371\324\177!\214"
+	.ascii	"\021\b\307a\300\264d\206\335)\263cYu\355,\013`k\324`K\230f\034"
+	.ascii	"=}L3\016J\245\200Kj\334\246(\227\004\356\211rI\005S\335a\343"
+	.ascii	"\330\314\275\263'&\027\204i\232Q\227\263`\013\374\225d\237\301"
+	.ascii	"t\tmp\254l\314\002\177B\324\314\316\366W\b\315\331\236\030\227"
+	.ascii	"k\226<\021\221\341N*\363`?\242,\254\237L\323\\C\313deD\346\237"
+	.ascii	"\020\3234\225\307\312\314V\203\253\252d\252\272\246\252\002G"
+	.ascii	"$\236u(iw'\036\211\213\211`\333\261F#\236t\022gGgQ\304\001\370"
+	.ascii	"\210\377\354N<'LF\304W\256\r\353J\007\340\345\242\244_]\351="
+	.ascii	"w\272\021\23701\351\207\003\004\2371\370\376\325y\356|\003>\370"
+	.ascii	"_\337\351\366;y\340\233\344\3167\"\037\265\374\357Mvg\020\303"
+	.ascii	"(l*\035\3204\315)\335\343\227q\212\006\345\222\345\027\221\""
+	.ascii	"\343\260\312\366\221_<\212\266\355\177\277\363\3167+;\204\020"
+	.ascii	"_v\256`P.\371/\241\255q\002\020p\306\241\252r\214%\337\266\227"
+	.ascii	"\217\350V9\3144\2071\370K\256|\376@T,\373\310\013_\311\205G|"
+	.ascii	"\306%\336[]\202\253Ze\341\035S\2457\347\307\250\256\017[;\246"
+	.ascii	"\212\265\215\262\200\246\0316\325\303\327\013Z\300\021\302\224"
+	.ascii	"K\356\267N\361nl\315\220\217\252qD\376\232\352\266\3718\252m"
+	.ascii	"lrDX\213\023\202\032\2347iE7 \264a\203v\366\301\0325\036\244"
+	.ascii	"1+Cs\246\203 \353\232\t\262.\007\315\272d\315\272c\315\272\033"
+	.ascii	"$\261n\231 \353\212\005Y\367\f\262.\231 \353\206m\236\3255W\317"
+	.ascii	"\352\327\356Y\315`\371\254\212\331>\253`\266n\365K\220\325+\310"
+	.ascii	"\332e\375\254r\355\237\325\n\026\320*\005\213\267\252\265\201"
+	.ascii	"V\265\254\240\325\254\215a\027k\365V\257\202\254Y6n\327j\215"
+	.ascii	"\273\022\354\013\273\0204+\226f}\240Y\2574\253\003\315j\245Y"
+	.ascii	"\033h\326*\315J\245Y\2474\253\224f\215\322\254P\232\365I\263"
+	.ascii	"V5\253\223fe\240Y\2334+\223f]\322\254J\2325I\263\"i\326#\315"
+	.ascii	"j\244Y\2134+\221f\245j\326\005\232uH\263\ni\326 \315\n\244Y\177"
+	.ascii	"4\253\217f\355\321\254\n4k\002\315\312#B\3262\350 \027\362\333"
+	.ascii	"\315\240t@`\220+\025\362\303\007\004\216\230?\345Q:\247=\250"
+	.ascii	"= \377\275\371\2013\336\340e[\003\223\303;\006\346Nc-\350\205"
+	.ascii	"}\214j\371\217\1779\317\265\261\334\217\377\352\350\342\374\216"
+	.ascii	"\240\266D\300\020\276{?\322DO}E\360\361\335\353\361\035\367\361"
+	.ascii	"\317)\360\036\t\\\201\267\310\343\361\004\336\344\210\016\307"
+	.ascii	"\361\370&\"\201\215;\256\244\306\007N\204\333\031T~\r\205\265"
+	.ascii	" \3715\345\257\034\023\214\343\313v2}\333\251/\"\004.\365)\035"
+	.ascii	"G\340\200\353x\013\271\034?\300\004\206\313\361E\324f\034\236"
+	.ascii	"\300*H\361\261=\005B\333\201\332\356\306\032\365\327\344|O7\""
+	.ascii	"\233\2469\346"
+	.string	"_\303\3615\2641\3408\240sgP\030\013\241Q\207:\216_\356,\022e\020{\244W\336x\324\367|\343:\326o\274\351\020\030\n\354\006u%\26398\343\260\f\fjo\202\034\217\217l\234\213\004\033\3775\332\303gd\254KpU0\025\300\340x\307\224\365\270\321#\3631Z\343s\332\f8\215\327(\340\004\334\200\227\216V`9\005<H\233q8\300\tx9G\343\025|\200\277\217C\340\2658\253v\345\2224\3161\240\3158\23472\376\3423b\\\306\177r'\036\021\306c\274\314{q\n\016\343=\007\305E7/\316r6\324=\275\r\033\027o\372\323\371\320Ylq\247\273x\331w\342\021\371\310\002\237\265x\020E\002\334\351\245]\323\265.\300[\356tS\033\274F\351P\260\231\246\311C\025\254\005V3d\311\246\223C9\270:\026\257`\305\0038\213\227gi\307\323\215\351\277\257\240\3424L\017\252\301"
+	.ascii	"\247\342)\036\300I\273\"\\\246\342:\216\360\231\024\017\2169"
+	.ascii	"\362\2418\005\347\271\023_:\212\223}\347[\0226s\342\"\b\035\341"
+	.ascii	"\264\334\304\265J|\351&N::\337\210K\230\254\304\247\024\031\207"
+	.ascii	"Mx\203\245\007\313\"e=\353Z\356\342\206\363\355\017B\254\254"
+	.ascii	".+ay\205\205\305\345E\206"
+	.string	"\021jumi\021z\261\n^q\241\332\262e\253\353w\305\205JK\026\241\026\027\360\212\013\325\005VaJ1H&\320\372\362*\251.UR\277\252\034e\225\324\026-+aY%\325\265%\334\342\362\023^\261\320\013\227\005Z\244\027\027\253.+\256\022Kh%\364\"5\313\r\255-XZ\"\340\242\345\025\305DJ\222(QB\254\254.+a\224\005ZV\\\242\262tyE\335\200\241[\\X]Q\302\255\255\256(\245\270\341\366>\216\362o\315\030:\241\204\322\3077\316\311\224\364\2407<Q\261\374\007\037\036\370\225cy\223#\262+\371\003v\346\034\307\276dce\276\033|\031\211}\313\234_\261\363d~\206}\311lX\227g\351\222\347\365e\344\300\247\374\212\225;\320\300\215\334J\261\312\251\274\201\377\016\201y\2253\345\241\355A\024\367u*;,\232\302W'\345:\344\020\345P.\345Mrk\256\344Q\334\346"
+	.ascii	"q\276\025\332U\363]\303\204VM\232\257\007\337Ef\3374\254\267"
+	.ascii	"[\3665[4/\033\264{\346\213f;\370\031A\273f\276\035\230\341\274"
+	.ascii	"\345\340\273hg\340\271;!=9\003\207R\365'Nn\344Ugr$\346D\356\244"
+	.ascii	"\270\227\310\211\201\007\315\356\340\352\232\374\020\032\033"
+	.ascii	":\304\344I\336\344,\372\316\242\332\225\234\311\221\342\034F"
+	.ascii	"\347\333\302\371\252\275\234\363\003g\323\276oN\364\235<\f\213"
+	.ascii	"\337\264+\213E\032\036\217\307\005kS\256\233o\361\244\n\214\304"
+	.ascii	"\316@\270\033"
+	.ascii	"\262\315\027\204\223x\022\235\220\330\274M\t6'\361\f:#\021\317"
+	.ascii	"\216\366\315\023[s\006\211\003}\031\301\332\350\216\240}\026"
+	.ascii	"\314\315\007_\035\226\357\356\310\330\f\323\030O\311w\220\"$"
+	.ascii	"\247z\222\367\242\263\370\345G\216\344d\236\221\027\371\2213"
+	.ascii	"AZ\363F\276\342\020\230\023y\221\"q\017"
+	.string	"\"\024\"ep\"\377\035:\337\376(\235\214=;'\252\007\315\376\360\325-\260f\335\002\377\275\331\361\r\371\242S:'6\250!g;\264\201\266\250\2018\005\221R\206dDD\222\202$\031\326\261\005\204(\306\330Y\007\021\260(\310\234B#3\"J\222\244\240\220\016N*\n\244X\251\nD\035\300\366\2374K'\221\3131\317g\224\244hlB#L\0337\b\307\201\300\265\256\277\373\271\210\265\214\2421)\240\260A\305\235@\375:1\353\030\207\255\247\363\"\322\276\0308\f\204\311v\302\2672\240\257\345\bc\320a\224\304\262LI>\365q\225\316\020>7\004\232a\340\304|h\024=fX\\\"\344\345akb^x\034\254V\017\213\332\242\307l\226\226\265fQM6\206\301^\221i\203t\264\207\017d?\357\367\205P\376C>\330\f\314\007\025n\366 \034\323\r\364P\344\234\223\277\206\363\355\004\216xj,\f"
+	.string	"\201U\261\034\325E\001HO\207ijM\227\237mD\206\330\220]\025\020\255\231\275\017\036 \026\263\307\017\255\003\005\351i\264\325\224\032\3756\3659"
+	.string	"\363\355\031F\375\237^s\006d\"\240\256\342\266\207{\315\312\272\206}\360\034\323\244\337\275e\362Y~\322\202\365\273\f\262D\214)p\254\022\223{%\206\233j6\241\321\207\"\304\205Sgb\bMBw\341e\221\202-\026\367"
+	.ascii	"=\277?\211\362'\320\004Z\006\234|:\345\326\223\347\211\330#\311"
+	.ascii	"@\030\350!\202@\225![\004o\333 \275xb"
+	.string	"6;<\213\220\353\341\320\266\207\3230\n\374F\002\342\270\321bW\033\214P\260\230\227\333\341i\201\221$d\316R\375\361|\254\217\022\260h\246\322\272`\325$[Q\005\006:g\267\371\337I\244\246t\343\245C\363\327&\244\224\263Q\245$\316\256\322\355\361[}\316P7\215%L\227]hB_\301\350`%\035E\034\270\342\231\351\036B\344uB\353\034\021\263D\032\336\215+\334jm a\331&\224\267\342\353\023\247\221\210Z\360\225#\305\220b\311@\374(\226\025\035\313Q\231\310M\336\271\006\371\022:4\240\2503t\024\303\375*yF\350\220\006\277\327a \237c!\301-7+\350\nU\2600\004\265\360\245\017H\312\211\356}@|\321\251\212\262\211\324\036 \276b\267O\352\236\202=i\001&[n\"\244B2b\022\222\312* \300\303\267\025\372\365\201P8\004\342\205\320\0332$\037\"\234\304\204\333\274\340w"
+	.string	" \326\027>\304\304\247\257\367\332AL\005\335_\235\230b\303\202RKU\304"
+	.ascii	"A|\027\216m\032w\307h\220\210\035!Q\377\t\016\355\034\022\210"
+	.ascii	"x\245 '/&r\b\006\330j\004\356\004X\037\374\013\002X\203cX\203"
+	.ascii	"bX\033\352\001\260\324\341\303\212\300\2104\340\363\250^\236"
+	.ascii	"\245\017 4P\017\363\254I\213\200 :eK\034_2\306\232\277\320b7"
+	.ascii	")\2065b|\022\324\343X\006y\3705\037\300z\317jao\2672\254\337"
+	.ascii	"Y\026\353=k,\346\215\305\265\0301\301\220\263\324y`\320\2677"
+	.ascii	"#\2548 \364/\2744>\300a\030f\246M9e{4B\335\233\221\374\001"
+	.text
+	.section	.gnu.lto_simHeliMotorRPM.9.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"\275\n"
+	.string	"\266\023JC \253(\0358\013f\345.\371."
+	.string	"\2061T\0376\221U\301\020\207\245\301\300"
+	.string	"\240e;\025\265\337\260M\302@\204\034f\034\027J\233\202\214\t\364\262\210\321\262\201U\302\025\n\244#\335X'i{\223\275S\n5"
+	.string	"7"
+	.string	"7"
+	.string	"W"
+	.string	"\332\017\260\220@\352\026\020\260\2644\354n\315|\202~b\217\240\237r\300\301G\320?\353\230\253\300\005\323I\364x\351\330]G\323\t\300-o[c\233\303>F\2162\372\027\007W\005\213\t\273-\257\rKaF0`\033\2641\266\343\nD\361\260%V\200\215G\373\252/"
+	.string	"\037\206\016\261\213\222"
+	.string	"a7\274pF\366\3510\263\355'\b2\303\312\001\022w\007\r\276\023\020\375\214Rc\357\fP\262\335\222\206\337JQ\311R!\372y)\201A5\212/;\024E)\300>\266\022e\313h\372\325?\037\376\230\214\001\236G\353\264\017\335>\355\363\2469\233N\311F\"\342\351x\365#\304\003\244~\333H\247}\325\244\243y*\247\363\352\246\302\334g\353\352\307q]\305\204{\233\312\314H\222\034\345%\225\001\022"
+	.ascii	"2\003\3020\001\023\027\\\007\210\003{S\232\3335\273\366`\227"
+	.ascii	"kx\217\026%dB\004%\202\021\002\025\016\356>\251VL\302$\003"
+	.text
+	.section	.gnu.lto_simHeliTailRPM.10.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"\255\n"
+	.string	"\266\223IB0\251(\035(\304\203\330\346"
+	.string	"\236&\321\346U\364nMv<H\302\023\317\016!\2136\204\243\277\355c\333\230\036\204\034f\274N\223EKE\350\r\034\023\331\r\354|_\310\200e\224BO\376\336d\357\224\0024"
+	.string	"7"
+	.string	"7"
+	.string	"G"
+	.string	"\332.,$\200\272\004UJ\253\302\356V\314!\350'v\007\372)\007\034|\004\375\263\216Y@\271J\246\320\243Ecw\035K\246\225[\336v\306v\206\375\212\2162\372\226\013\200\b\023\nvU^\027\026\302tP\3006h_l\307\325'\202aI\254"
+	.string	"\030\217\366SW\201\017Ao\330==h\260\033R\330\"\373t\230\331\366\017\004\222\002\212\201\021w\006\013>\222\017\375\2142c\357\tJ\262]\322\205\33729\311P \372y\3710!%\212/;\fE)\300>\266\362d\313h\372\325?\037\376\230\214\001^G\3534\017\335>\355\363\2467\032\216\310\026\362\321\341x\225\303c\243\243~\033H\247}u\204\243u\352\246\363\252F\302\234g\353\352\307q]\275\204{\233J\214H\216\034\345%\225\001\022"
+	.ascii	"2\003\3020\001\023\027\\\007\210\003{S\232\3335\273\366`\227"
+	.ascii	"kx\217\026%dB\004%\202\021\002\025\016\356>\251VL\302$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\255\005"
+	.string	"\202\b\037'\220+\035\377\213\364s\276\233*\360|AW=\311\t\222\230"
+	.string	"\273\273\316l\302\373M\303u\361\357o\204\354\333l\271e\n\2260\t\203M\250\350T\262\201N\035\227t\032\261S\b\244\032a\351\314\252\256'\025B\353\243R\377S\242\265\261"
+	.string	"\306\016\242\025\344\177\373\321Yl \025\013%\366Al<\254\266\351\032g\330\346\314\252\256\302\302f\373}\232\236\261\327\346T2\377\237\260\257\331NK\027"
+	.string	"\240\240\313f9Ks\031\017\347x`\344\326 \336f\324.\231\002\365"
+	.ascii	"\340\360\001\342\343\322\314\023\f\227=@;\3609\360\271\235\357"
+	.ascii	"\252\262\t\210]\0258\2647\365"
+	.text
+	.section	.gnu.lto_.refs.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4e1742033dcbefe1,"e",@progbits
+	.string	"(\265/\375`\262\025\025e"
+	.ascii	"\352\246\244$R0RBJ\007IK\323\342]\234\002\211\036\023~\207M\322"
+	.ascii	"\016\234[P\373\n{\022\356\235\360o\243h\"\377a\361\267\364\013"
+	.ascii	"\307\034}\243\216\327~\316\0253\356z\376\347\314<\222\250\"*"
+	.ascii	"\002\240\"\314,*\350fU=\361\250\312Lhy\270\336J\276\224)\350"
+	.ascii	"\0013\002M\002\347\036\352\227^\313b\314\332\215\020M:\250\360"
+	.ascii	"\327\233+\346\247\2262k\007G\314\033\025.>\317\307\372o\230U"
+	.ascii	"\323!\221\224\313\025:\"\214\254\254\360\231\266$\200\267\326"
+	.ascii	"$\033\343\363\373V\177\301\326\030\326\022j>T\232d\013f\307\226"
+	.ascii	"\313\242m\331\212\255\331vY/\373e\267\254\226\375\332\263\005"
+	.ascii	"\373Z\331+?\227\335G\237\256\260(Mh\2112e\013\026\027\227Ub\317"
+	.ascii	"\026\313\206\021\205a\226\355\222\t\262\253\177\243H\021[\255"
+	.ascii	"*o\346\364\272\303\252Lu\367/\370}\376\315Z\255=\333\346\233"
+	.ascii	"\007\034u\207=\261\220\272R\345)\256\273%\220@\002\002$\270y"
+	.ascii	"\262E6\344\200\363\033\366/\224\305z\223\225\335\307\356\036"
+	.ascii	"\200\313\332~\304\361\271"
+	.string	"Y|\276I\354\025\013^\322i\331\\\335\255\243\363\312b$\307'[U\035\007K\244~\275\276I\2744\006\337\241^\250\276F=\f\365'\324\177P\237A\375\004\365\r\324\235\003\352\001\250\257\365\\]l\013\336\271,x.\314\266\005\017gY\360*Xn\013^]\026\274\030\226\250\275\367s\222\177qV\305\356\374\313\373w\203\035\253\300\346\270\3707\206\321\277\t\374\253\203\350?\004k\374w\207\006\016\343\347 \253C\016:\337\3719\307\277+\376\265\371\367f\206\034\313s\031\016\300\317\303\177w\275M\361\377mq\300q\234\237\223\376\217\375w\342\377\227\377\\\300\374'\373\277\345\177\331\177\263\377]\376\237\375\327\362?\354+~\326\361\357\215\177m\374\373\363/\r\377\306\360/\f\377\246\360\257\b\377~\360/\007\377f\360\357\003\3772\360\357\371o\213\177Y\374O\3737\202\377(\374\027\363/\004\377:\360o\003\377\016\360\257"
+	.ascii	"\377\006\360\177\355\277\332\377\031\377\021\370/\366\277\316"
+	.ascii	"\315\315\315\375\334\365\353`\374;Q\001V\335\306\025\275\354"
+	.ascii	"$\222\031eD2\341\205i\305\262\203\f\320L!\215\\F1\235\312\346"
+	.ascii	"^\366\3661\212\351\006\344R\231D.\225\306\235>*\215\335K\246"
+	.ascii	"\035$\027\221q\221\314(&$S\311\264\242\217ml&Q\220zT2!\271(\231"
+	.ascii	"v\220L\"&\3441\212iE\223\270$K<\260\264\314l\020\344\261\225"
+	.ascii	"\222\240\210\222;f\310\245\262\325\272\227\313\250\223\013tC"
+	.ascii	")\223jDA\254W\221\231RQ\027\221r\227\335]@R\221\224\262\217f"
+	.ascii	"H*e7U\021P'\3010.\315\272\310\232\031\205@5\222Q\267\001\275"
+	.ascii	"\354N\3526n\233u\267\261\273m\222P\313n\037;\310\251\244\244"
+	.ascii	"n'\002\222\032\312\370e\324\315\\b\274\230\220L)\245\317\327"
+	.ascii	"\026s\252w,\215;\325jQ\311\3124f5Rw\357\231:\305\324\303\315"
+	.ascii	"\210\"8^o[;x\327l\260\222MPD\212\310qss\323\342028\271!:\252"
+	.ascii	"\2242f<\210\020\302e\240\322\260\361)\225b\t-L\021>\2573R\177"
+	.ascii	"\301\0173@\330\007\031\006\302B\224\211b%\007\331/\006\302Og"
+	.ascii	"(\036\242\267E\315\022[=\257\033RW\271-x\001\350\202\250\327"
+	.ascii	")\325\353\220\365g'\036\025i\320\212\254\202` \272\216S<\370"
+	.ascii	"L3\001\311\032\033\237?7\361\017\325\315LH\030\237\334\243u\256"
+	.ascii	"\260\2641IS\277Zq<\256\240\210\002\315\322\032\271)5sJ\260=\361"
+	.ascii	"\321\272-\334\361\314)M\017e\370h\315lXKA\261\021\367\300I\214"
+	.ascii	"\304IF\262\017\314\203\225\230\211w\360\322~\361\321F\361\235"
+	.ascii	"\343~\342\315\234\343N\363(B\362Y\2717\327\214k\247\230\254a"
+	.ascii	"#s>b#\353\320e%k\224%~\260u/w:\2040\242\315\200\223\211\270h"
+	.ascii	"\277x\370\330;.\233\331\275\324\351\241\235\031\202\255~yx:\313"
+	.ascii	"\303;\257\325\235\362\n\227z\006\253g\256z\206R\317K\352\231"
+	.ascii	"H=K\325\363\020\365\354T\277p\333\326U\217\340\326\250\341s\317"
+	.ascii	"\370|\33780\"\344\t\237:\356Q\267\267\005\357\254T\003L\320\210"
+	.ascii	"\370d\270\363\233\323\030\030\333\031~[B\004\263\311\232\372"
+	.ascii	"\027U\013\b&&>\271\355d\250\310 \265\361\311l\307r\247\264\270"
+	.ascii	"\"\314\350\310\244\316\212\370\3441Lf\277.\306e\236\003\266C"
+	.ascii	"\212\030\232z\036\366b<\026\323\003\373AD\324\227)hOSf\272\234"
+	.ascii	"\323\272\360\030\263\355\262\235\224\3066\031V\342\326\242\210"
+	.ascii	"k$\024\317\316\310\026(M|2\2303\332\337\263I\003#\246\325\244"
+	.ascii	"\362\331\371\313S\2175*$\274\374=\034\"\\\310\334\216\324\357"
+	.ascii	"\206\224\225\361\330\356,\213\300 MUc\326\017T|~\367T/&\306c"
+	.ascii	"\253\325K*L\211IZu;\361\304\240\205\304\215\313y\254\031EL\027"
+	.ascii	"+pZ\264\260\023$\200\301\232\342U\021\253\262\202\006v0v\242"
+	.ascii	"\347\324\001\230'l6\304\025!&\313\331\211\246\256\211+%6>\331"
+	.ascii	"\nc\231s\202Dc\271\242\202I\246\251\314\206J\2117-/\256\034m"
+	.ascii	"e\341\342b/\265\233\253#Or\315\263\227\\Q\367\300'W\341*N#\002"
+	.ascii	"3\202O\246\302JvpnbH>Y\nw\241\200\204\021\252\253\211\024HG\274"
+	.ascii	"\270\244\2364\247\320L\341'FSF\004e\n\223\311[\265\273u\335?"
+	.ascii	"\312\246\324\2041\363\205\211\363\226\215\031\033\020P\\\225"
+	.ascii	"bM\215\2248(P\240\260\326\230$\330\332\311\211gG\365C\311K\326"
+	.ascii	"Yk\227`)\231\343\345\315\026\242\252\266%\026\357\214\034U\021"
+	.ascii	"\037M\243\017$N\234\360\325N\027\235!\231J\342|\265\213;\013"
+	.ascii	"\203\342\223\237p\225\032\026S\310\233[U\305\311\024>\1776\325"
+	.ascii	"\263\021>r>\342Gp\223\272\354%\033)% W\342\332)\311\3633\223"
+	.ascii	"s\223\337\002\f^\006\247\373\252\273\017\320Q\242\244\351\210"
+	.ascii	"OF\202\253n\226Xb\nQEU\211\244\251i.\341\036}\303\204\022>\224"
+	.ascii	"K"
+	.string	"6\n]S\225\254'|2\022V\222s&\013\024L%S\275cW\031W\332r\013\255\314\027\237\347$\013&\007'6\206\317\303\355\030\336\333\227\025YY=\377\274&Jv\267\017\273e'\213p\276\273]\236_\305\352v\201\377g\353:\260\352\276\212{\253K\232DOw\321\017h\0218D\001G\310G\204\341@\024\330\020\002\211iQ\200`pH(\034\nm\322\0374\007`\221\227\242\305 4\210\027\f\372~\305\024XC\317\220\320\306\013\034CB`\360\005\214\030?1d\340\350Ai\f\005\177B`\017\2618\324\323sc(\264\251\341C\203gZ\024\016\177\273\032)\361\206\342\2568\374\335\034\210\202\"P\352\013\352\021\016\203\202\206?\003p\f\211BB\276\037!\260x3#\205\025f\244\260\202\216\020\232\262\220\002S\024\323\340\220\257\006\032\002Jc(\005\246\251\0076\320TX\002\001\377\261\200\322\030\376\320\020"
+	.ascii	"\370\017HD\205\250\215z\0301^\304\220\201\303\34624\250@\203"
+	.ascii	"\nx\227\241\201\217\217\0061|\352c\370\350\322\263\370\223\016"
+	.ascii	"\t\tK@\203i:$\002\245u\227\246?\026\\\220\n\201C\225\006\212"
+	.ascii	"\026\317\342\017\232\372R\026rzB\240oF\020\350k\2417\003-\372"
+	.ascii	"\200\204n"
+	.string	"n\202\301!\361\004\372\245@\241\035\232\372\210g\352\033\272\341\034\022s\3308\177?\237.\365\r\2035v)\320\002\037\n\241\304\236t8$\366\244"
+	.string	"J\207\202\2009x"
+	.string	"T\364\335(\342\024\177\212A>\242/\005`\020%!\bX\324\271\217\017\b.\\@a\204\372\243"
+	.string	"\030D\201~\202\200\305\236\023Z(\201\205\236\024\265A\364\245=B\240/\250\347G,\366P\240"
+	.string	"\016\337\f\032(*T\244\341C\201p\202\303\241P\261G\3037<\001\305\001\230\376\320`p\370\313!\016\323a\320\315\nA\240/\355\375\200\301_\216\337\r\232\372V@\203\200-\334\360\345\260\271\341\213\001\035\272\2018L{\302!0\365\021k"
+	.ascii	"\342\320C\213\300\241p\207\274\322I3J\022\321\355h\362C\223\022"
+	.ascii	"\022/\367H\032\226\"\370\324\025-\017rE\274\020\272\211t"
+	.string	":t\307\353\212\336\273\n\354*\240s:\241Re\305;\347\346t\306j\214\323\365u\306\2341qM\230\fy\341\213\0215|\236Gd\315\277\206\307\266\223\335N\255;C\002\271b\325N?\360\234\007U\227\374\026&I\021(\026n\007\020f\231\032\036\2232\3276&\315\023fXsE\370\fs^\013\303O\350\320tf\302\334|X5\322\211'E\026\217\254.n\347'\316h,\300\340d\252U\201\301\250\2618\205\2303\"\"#\"\"I\222\244\003A\005\304\030\006%u\035\022\340$9\223B\210\204HRP\376$\255\001(S\245\370L>^q\341TR.\266~\n\227\"\215-\267\363\265D\271\006\277_\317\026\346\323\363\304p\230\341I6\270\021\363\033\262\222\023\303\231\215\f\321O+!\001\261\253\330\345\206\350\361~\332\233\237\233ZI\236\243\t\361\n\324<\241\373\206\237-\3455\027[\007iG\030\317\030\007"
+	.string	"\337.+5\352\265\334WGjT\265\262&\177J\251\247\007\311QSX\326\027\211q\0241\f\323\365\205\020\333*\210_\223\374\341\b\317\030Z\202\n\224\r\302\035\251M\265\262\306\026\2731\266r\363\324ddS\377\270\016]\356\351\267#\n\254\245\207wg\242\004\220T\330L\005\335\361\277\366\365\f,\370\326\035\254zY \0017\237(#\332\240\314\025\242)J\253\224\251\0046RR\214;\375\246>\343\024\364E\237\316\204a \233l\214)\312\200]\235\277\344\224\277\276\033\357\006L\004\022\264\025T=\314\244!-\376\362K\356\237\340\253W\3772\211\352F1\025\275?\342'\207\223\202\\j@\221Z>\367\332\377hd\001X\213\006Q\273\347\265\203\235\262\244n6w\323\274\003\346\346&\325\377\243x\267\244\024h|\346"
+	.ascii	"\214\035\270_\251\302\245\267\324ZiQ\221N\311*\327A\212\212D"
+	.ascii	"\004\317\353t\007K\271\244o\246 F-i\314I\027)\377\326\224\002"
+	.ascii	"\006\302e\006\322\2444\201J\264y0\375\210\272FkG\322/p0\345\023"
+	.ascii	"\213\224\006\231DB-\354\234\227`\033\334\317MzL\202\223+(ufH"
+	.ascii	"Q\002\\]\212~\313t'\372\244\372\"V\220\225a/O\001\272\323\231"
+	.ascii	"Sz\363\267-\261\224\r\360}\335\344\235\nn$\220\377\332jE\360"
+	.ascii	"f\253\371\036)\00199\342sm\350\213\222\232\t\322\223=\302"
+	.string	"\306\362\251Q\302\224\035\006NX\215:\223\351\252\255x\377ZV\256\231\031\227\222\\F\224\006\236\357\361\030\2453M\034\252aq\340h\276/\t\266\304\036\025\301}\031\206n\032\223\304\237((\177\302Y\b\330]\300\202\016\2207I\310\266\013\233P\325C\330\016H$C\202\031%\322%\266`\300/2\336\006\260\357\n\307\334z:\001A\303}\006\346\226\315\325\f\327\306\266S%!N)\023\3543s\226<\227}\301Q\363\311\223\205\351\035(!\240\031>\347\350@\306\034\212\216^\341\257\370L\306\2079\216x\214&\222\235\177\007\375\032\301rg\266e\355\020\242\345\204\231\272}\347\203R\"t\344\371\021\356\226\231\263\2076n\005\252\227\213\372\276D\302;\370\211\237\211\361\241\361D \246\251fJg\313%\346[y\017\362C\306\203:\233\337\230I\365\005q\271\255\030\370a\212\257\334\257\027\224N\264\017\031\234\"\274\303F"
+	.ascii	"\353\240\245\303\345\025\25772\372\351\373\273w\367\367}U\020"
+	.ascii	"z\266\035#~\2411\005\337T\275\245\266\004\276Df\225\360Q\371"
+	.ascii	"\241(\036\265}\222fS\330\241\307G-\033\217\233\220\013\312!m"
+	.ascii	"z\234E\013\300S\233\361\230\312\300\201\321W1\305\037\323s\225"
+	.ascii	"\206\367\r\357@a\373\202\235\244\333\320\314\304W-\347\323P\b"
+	.ascii	"\3345\232\033\232G=\1771\313\313!U"
+	.text
+	.section	.gnu.lto_.symtab.4e1742033dcbefe1,"e",@progbits
+	.string	"simHeliDefaults"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"simHeliInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"simHeliStep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"simHeliMotorRPM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"simHeliTailRPM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4e1742033dcbefe1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
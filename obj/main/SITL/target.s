@@ -0,0 +1,3572 @@
+	.file	"target.c"
+	.section	.gnu.lto_.profile.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`v\006]\037"
+	.string	"\244)j\007"
+	.string	"z"
+	.string	"\226\342\223\316\016"
+	.string	"\001\327\346\357\377\002"
+	.string	"\002\336\327\276\377\017\002\002"
+	.string	"\002\001\003\257\231\321\314\002\004\337\313\242\204\n\005\202\321\322\374\007\004\002\003\006\240\342\234\212\n\007\b\232\246\323\206\017\t\n\261\263\351\341\005\004\013\f\226\234\261\244\006"
+	.string	"\r\242\302\263\302\013\016\316\242\321\205\002\034\002\005\002\005\002\006\002\006\002\007\002\007\002\b\002\b\t\002\n\013\002\013\002\f\002\f\017\020\021\022\023\343\261\325\353\003H\002\002\002\003\002\r\002\016\002\002\002\017\020\002\020\002\r\002\021\022\002\022\016\016\002\016\024\025\026\031\032\033\034\245\303\315\330\013\n\035\036\313\350\342\364\013 \002\023\b"
+	.string	"\002"
+	.string	"\007\037 !\"#\256\234\262\364\013"
+	.string	"$%&\333\231\316\372\013\022\024'\352\263\360\321\b()\203\200\250\371\b\002*+\301\355\336\254\001\b\b\002.\342\267\346\357\013"
+	.string	"/\252\360\231\215\013\b\002"
+	.string	"\002\004\002\025\002\0010\261\275\225\211\t\b\002\026\002\027\027\002\02712\345\246\304\211\b\002\002\025\002\0304\316\357\366\331\b\030\002\031\026\002\0265678\353\252\315\223\t9\310\373\201\350\r:\240\234\314\004\004;\234\362\341N"
+	.string	"<=\251\306\315\231\b"
+	.string	">\240\273\376\266\016?@A\335\322\215\360\bB\301\325\215\205\016"
+	.string	"C\274\205\242\255\006"
+	.string	"D\225\221\315\200\006"
+	.string	"E\210\377\206\247\006"
+	.string	"F\271\303\275\241\r\n\027\002\027GH\234\235\350\364\001 \b\002I\355\236\254\375\nJKL\353\311\240\325\016\006"
+	.string	"\002"
+	.string	"MNO\247\333\250\364"
+	.string	"P\306\223\324N\026\002\007\007\002\007QSTU\345\247\247\276\r\032\002\032VWX\315\343\301\244\013Y\350\367\206\362\016Z[\\\230\336\335\312\001]\272\302\257\305\007@\002\032\002\033\033\027\002\027^_`ab\263\330\307\313c\243\353\360\263\004\004d\246\372\201\303\be\215\207\350\235\004f\260\252\223\225\007g\222\321\201\352\027\002\027h\230\274\251\331\r\002i\245\254\217\325\007j\314\345\244\232\005"
+	.string	"k\223\277\274\335\003\006l\202\220\306\317\004\020m\333\217\352\217\004\034no\313\322\375\213\007"
+	.string	"p\310\342\324\f\017q\303\272\266\211\013\002r\255\314\361\341\001\034s\350\300\306\254\005"
+	.string	"t\213\237\200\352\003u\317\253\250\341\002"
+	.string	"v\351\361\317\236\016\004w\241\271\241\253\t\022\027\002\027x\254\341\326\252\002"
+	.string	"y\304\333\264\225\017\f\035\031z\351\377\201\334\001"
+	.string	"{\346\361\327\375\t"
+	.string	"|\324\365\343\372\002"
+	.string	"}~\201\001\240\342\234\212\n"
+	.string	"\200\261\250!=\203\f17\"I\n\222\f\007p\2021CV\333\021"
+	.ascii	"Q\203\030\233\031)HI\322\001q\203\035\371\263\247\324B0\212\324"
+	.ascii	"RM\255\312\367\312\016iQ\316O\337\021\243\221\35041'\231\300"
+	.ascii	"'\243\315\036\277t\025C\317\206z8<\365\212A\264\267\006s<K\r"
+	.ascii	".~\305\006,\351B\272GS\226\346\210\234\247\347\375\204\271\320"
+	.ascii	"\322*d\330f\306'\005\373Y\tAd\316t\356T\207\334<\2635(.\330\303"
+	.ascii	"\353\"[|<P?!\337\331\203\240\371\353\320$\214\240\247\345\203"
+	.ascii	"\336((\214\033\351V$`\225\332B\031\244\261\"\313i\210i\0342\213"
+	.ascii	"\276\223c*\\\327:\345\366\211\321\322\314\221\306\354\213yNv"
+	.ascii	"|\220eb!>\253ka[%z1\322\371\234\313\201\337<\255\245)\300b\362"
+	.ascii	"\261\n\2134\346l#\331\207\353\203D\372\177\250S\200nRr\001\306"
+	.ascii	"\314*U\344\306T\035\326\f9t\210\234\265\255\274\263\323\027@"
+	.ascii	"\246A=BI\020f9\005t\246\032\255\353\005\212\005g\2479%\270\215"
+	.ascii	"Ox*J\345Id\332\231z\002[\017t\326\030\fJYY\352\tpd~\314\353l"
+	.ascii	"J\3329\f\003\261\311\330\272\264\240\211h\221I\225\356\354"
+	.text
+	.section	.gnu.lto_.ipa_sra.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`u\002\345\n"
+	.string	"B\314$ \340\236\2441@\201)\224\005zp\330NQ1\006\016p\n\337\007f\003\323\227\333$\220-eJ\001\356\346,\316F7+\263\261\032\232\231[\306bN\230_\354$'\225\313\326r\262,9\371\312)}-\217\025\330K\217}\314TRP\016\235\270I\t\311\210H\310\n\344\303\243C\347pc\327\3303\366\304\270\330\336bA\025SLH\230g\304\366w\020\017;\230f\003\303\275\360+\254<\001A\017\f>\004\003\n\354E\001"
+	.ascii	"\333\331\326\026\235j\355[\220\027\nm\250aM\313h\222\2159P\202"
+	.ascii	"a\312\252\036\020`5b\232\244\322\001*\240k\021zp\344\250\nY\331"
+	.ascii	"\350K\262m<*\370=\017p\243\034\343\250X/x4\251\353%\210c\245"
+	.ascii	"\013\322S\"\324\252R2W\003\204\224\342\366\372v\345\003\214\317"
+	.ascii	"\345\376W\346{\022\350\007\344\353\372\345E\203/\005\203\304"
+	.ascii	".\311\001\350C\304\2564\370i!\035\022h\036\264}\346\022g\b\031"
+	.ascii	"SH\214l`\315O\306\322 Q\021\177Ad\007C\232\221;\3422;\305\360"
+	.ascii	"d\202\034\212\005\322|\321\303\231_\374\212\322\312\3074;)\246"
+	.ascii	"8B\243Tp2$\005\260d.E\306\233\255\200\252\032\230\336GH\370\323"
+	.ascii	"\225\t\377\024\363\005\310\n\026\213\031"
+	.text
+	.section	.gnu.lto_.inline.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\235\021\3051"
+	.string	"63\272Hp\336M:\201~\3502_\272@]\005^\241\260\370\200\034cb\262Q\206J\305\003\355->9?\246z\306\031\003\363u\260\032RN6r\211QD.r\005\247\225zD`5t\257^\201~\352\026y\202\274Y\262\345N\001\230"
+	.string	"\250"
+	.string	"\260"
+	.string	"hJ\244\025\006\024x\252\214\327\227\202\377\226\260\026\343\030\333O\2206#\030\336\207\276R\365r\276\377\004\324\377O\272\237\251\225qI\242\356\261\251\257\252(\253\3560\b\210g\256\355\332\376\367\366r\377\235\372\310e\306\314\206\376\261S'\303\262\\Ehb\357\242\027\275\367\351 \0263\216\321\3215\365\026\343\330\232\357\351esGw\247y{\353'\333\310\2343Z\244\324\273\347\314\377\375\337>p\315'\365\373\rl\335\217#\347,\374\361\177\242\276\277\307@\234s\316\346\317\341?U\001\271\003\020\237\303\326\006\r\367f\031\225Q*\355\263\361\312S\347\347\030.X"
+	.ascii	"\342\016\362^\241U)|m\357\205\030,\303yj\360#N\216\330\225\227"
+	.ascii	"p\232\251\372\024\251\313\276\312\234\364\323\247\254\216\364"
+	.ascii	"\352\201\3510wsP\321\0255\213c _e`\003\036\341\276\017\226s\366"
+	.ascii	"!\202p\363\006\273\n\017\021\264\240\016\266\023<D\320x\177p"
+	.ascii	"\327\366\310\301\365\3510\321\316\216&f\227\242\033\227j\264"
+	.ascii	"\324a\305*G\016\234\301\327\026\251\340\277J\r\267EK\313\202"
+	.ascii	"`'\327\210]CG\300S\302\311\2343\200\033\375o\237Nq\023\016m\317"
+	.ascii	"\211\"\233\022\352/\2561YBG\361\265m\272G\371L_\333\243\255%"
+	.ascii	"\035:\270/Xiz=\356\030\245\002\250A%V\030\005YD\325\224To\320"
+	.ascii	"\003\261DA\026\317n\003E\353l\367$$\266\263|YZ\001\375K\375\304"
+	.ascii	"JO\334=\302\204\245\204]\336\276TO\334\037Y\316Y\200j\242\004"
+	.ascii	"X\316\031\350$.$ga\007\036o\314\270X\370\210\277}\272\033E\346"
+	.ascii	"\350\205\366\235\341S\376\271\210\377\336\273\266\337"
+	.string	"\362!G\rk\231VD\205\311T\330\315\036\342\277\235\204\367\230u\021\367d-\325|p\233b%\355K\025\304\375P\220\372\301\303\3276\277a\343\257\001\304a\256\222vN\26756/T<\216\005\332\262\330\226\034\235\006\333C\252\320\316\240B#%H\216W\275\317\370sjq\302\212\374\324\344\f\365Se|m\205cu\240\220\234},4OD\336c\300\2002\"\305\013n\367\027.\376{\327\366mbZP]\305\267\t\370\307\230(7\t\324\026\3465\221p\2270\355\r\330\246\351\3248\315\232+lvga\236\346\305l\257PA6\024s\206&\207b\316\316;A \"z\253\352;=\333\275\237\347\333\274\371F\352\313\242i\377\372\336~\006|\003}\257)\364\024_\003\201\205\250\301\265R2R\222$\225a\r\241\004\004!\345\240\244\322\003\022\2402i\b\211I\205\fBFD&\022\021\221 \312L\2324\006"
+	.ascii	"-y\246\007B\234]\3753\211p-\355\251\331\n8\206\262\360*\222\312"
+	.ascii	"\210=\342\227\221\231V\350-\353*]\204VQ.\245\377\320\332\325"
+	.ascii	"#\374\330M\rx\316\270\266\004h\2769[\337\362\241\277S\367\210"
+	.ascii	"(8>\222\034\313\355\302\314Y \273\005\250\005D\206\257\2729>"
+	.ascii	" f\242\0239\023\260\314!\241\034\271\267\277~\202@\375\237\345"
+	.ascii	"\306\253\034^\255M\nI\345\263C\2174\035L\353\225\001\220y\020"
+	.ascii	"\271B\377\314'\314\t\341L\375\370\t\317\276\260\366+\202N\331"
+	.ascii	"\003(<'\334T\222\017)\t\017\303s\262\3524\234Y\324\346\361\355"
+	.ascii	"\311\212r(\315=>\312X\002\no\225c&\347X\030\252mqBs \305\266"
+	.ascii	"\367U\254\r\242o89F\327\013%\242\331n}J&D$\335\212\310\310\245"
+	.ascii	"\354]\277\242\035\251\t\372\304\314v\3262T\212Ab<|n\031K\216"
+	.ascii	"\314\222B$\315DEv\350\222ct\371A\202\266\225\023\310\226\360"
+	.ascii	"\201,\271\250\336H\265\256\261\230W\242\315t\346\\\271,n9\327"
+	.ascii	"\345A\256\213\f\367\033\"\366P\206=M\b\202\216\275\201h\t,\366"
+	.ascii	"\\\003\2517\005I\315E\210e\271De\370\243\242\\u\320!\001\005"
+	.ascii	"\352\362\"Fz\002P\212\3506\037\274\022\367~U\200\377\316\331"
+	.ascii	"\317\305@=Z)\0060\341(\020\255\033\245a\276,c+\370}X\325\025"
+	.ascii	"\001\322,?L\350\020\362=\006A\355_\244\025\327\005\300\b\315"
+	.ascii	"\333\337Z\013^\\\032\212z\360$\312\022zq\3051S\326<\215<\021"
+	.ascii	"!{\f0\217\211\210\020\223\025%\030\246\220\204\200\346\202h/"
+	.ascii	"s\030\252\035=\033\006B\235\004\tE5\\\016{+\037\347\260AOl\370"
+	.string	"[\266(4\327\253BHW\331\215\255A;&A[\301\322\254\255\343I\361z[\037\2135\231\004\367\332\270W\331\343#\367 !e\250t2Ym\230!H\223\206\371\224\352o\371z \262\362/A%\277c\302:\t\220\360\230\374]\313f\377wTG\310\242~\371X.\"\240\246\260\227\313\311.1{\225+\217\3222\030\3548(!\271\254o\023\365\262/c\272u|o&r\251s\304\347\" \341_\350j\257\340\216\342C\332w\373M\217w\t\367\233\210\257\243\205Y\340\232\016\350/\3023}\252 \025\376\r\021\355\351\302~J\246\226\243AaX\204\314\300\241\226\005\334Vs)\3223\374\2015\001\325\r\214\030Fv\311\272\030U^\337Cy\027Q\r\024\177:\262\021\215-\235\272\274\300;Z]\320\243\315hv\304(\243\b8\0345\033\224]\202\261\315H\316\250'\217\220\277W\357\264\033\361-\303\256\035\016"
+	.ascii	"v\350\206*e^\t\353M\004'\333m\360\240\\[\346\350;\276\372R\307"
+	.ascii	"\275w\224\337w\275q\264\207\225'\"\r\334\376\243$*de\"\274}G"
+	.ascii	"\324\312\260!F\371\324\277\263v\264\024\037'\343\b4\347\260\004"
+	.ascii	"\225I\030\r\206\262G\275\t\321.\250\202@\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`-\035}N"
+	.ascii	"\232d\230\025B`jm\016I\351\312\2724[_\321g\304q\354h|\212\031"
+	.ascii	"\232\r\222\023\025T\2413\252\266\267l\315t\323o\322\032\332\372"
+	.ascii	"@\357\227\321\350\243R\260\342\372\026\347\235\243\332\252BA"
+	.ascii	"\3216$\253\267\224)\0057\001F\001P\001\331\354i\003\024\324\033"
+	.ascii	"\030\251\376\346\310\355\335\243AGn\257\030\366\343\300y\036"
+	.ascii	"\271\275HJ|\211\224X\354\221\333\037T\342\361Gn\377L\211\313"
+	.ascii	"\202\344\366\215\2248\177\234\277i>\233\275\3339;\303p\361\350"
+	.ascii	"w\206\344\366\205\224\270Hn\277-\361\223\371\353\036T\307{$\267"
+	.ascii	"h\211+\\\3746\013b\025\376+\272O9I9$$\376n\347\214\021\324\315"
+	.ascii	"\375\377\377\331&\343eEvIn\271J\354T\367\237.\013\340\377F\271"
+	.ascii	"\204\026S\027_w\207\340MM\357v\306\033\224\272\370v\361\350\376"
+	.ascii	"\344\327\331oA\341b\321\346\340\315\337\340\261DO \0344n\324"
+	.ascii	"\305-\356\204\213\263\231\3772\377gg\277`\034\232\325\370\005"
+	.ascii	"\343}\366sf\255\344\226@\211\335\331\007\356\005\312X\221$\313"
+	.ascii	"\256\3315{\2373\336\007\363\377\345G\367\001\316\346O\026' \316"
+	.ascii	"\316 \341\200\363f\356\242\231\231\215\247{\335\331\177\366\312"
+	.ascii	"x\337\331+\216\361\027\307\274\355\275\260X<\003\233%\267_~\022"
+	.ascii	"\276\265\353\376\037\300\211t_\322\231vY\247\3132\375\337$w\321"
+	.ascii	"\375\322^_\026\377;\316\223\316\270+`\021N\253\273\352UU\227"
+	.ascii	"\310{\352\254y\335\351\262\372\262\274\353\035\376\377E\030\264"
+	.ascii	"\240;\352\342\347\t"
+	.string	".\013\342\377\261\317\225\002)\005\272.\366\342\325\374\3753\f\n\314\335{\356\276\335\335tw\236\213\006\327\361\277\216\205\273\257p\367\256\\\247\304y\b&\267\231\211+)*\361xs}\372<\333e\307\016|\201\364\321\372\272\370\372P\222\243d&xu\374\024\2172\271U\242rf\274\342m\225\200<\244\377G\317\342bG\357uq(\362(*T\326\344v\034T\342[\233\334\216nJ,:\232*h\252\274\031[\250`\177('\267#\227\277\354\377p\316\220\353b:c\331\326\305\271\021\236\334\216M~\230g\314\272wOn\307 %\276lX>\271\035\315J|\207~\306\013(\267I\213\022\r\005\3456i\r\241\334&\221)1[(\267IaJ\234\224\244\304\316\207\217\241\334\212ZJ\234=\222G:\224[\261-\361\350%F\224!\312-\246Sb\361\352\372\275r\246\037.\312-.Sb\021w\377\376[\271\343"
+	.ascii	"e)?I\204\237G\271\305GB\204\3403<\313-\326\361{>Xc\274\376\341"
+	.ascii	"\321\274\207\017\034^\317\263\242\230\315\002\347\312\333>\037"
+	.ascii	"\312\263m\337\272\242i\330j3\367\016"
+	.string	"\252\346n\207\331tUT{\335\2456]\025\225n\312\013Mc\200\331L'\265o\233\350O\333T\241\026\326\264\030\357\\\265-\270WU\367;U/\nzC\212\366t\230\272\363\365\264\325U\226\036as\322\254i\032\215\246\333&zb\247B\257\003~\273\335\326\023\210\245K\367\357\\\275\230\234\226\256(*\002\345j\340\264u\253{K\367\333\253\032C\365br\322\334B\275\242@\255\236:\253Fs\022\202G\221a'\327\335Ny\022\234DW\r\345\244\2246}5\355Ao\031\247\252m\245Z+\265\271\315\035\352\323:1\036\352\003v}\335<*\305\016<]\334~h\032\334\033\200\247\260\332\322R\361\305\325\205\373:\241\265\225\273\272\372\312\342\302J\201\300I\265\2467\230\333w\356zz\257gJ\246u%R\204\310\032\341\305\300\311\nT\275\252[\315&\364\325B8\215f\002\2676w;\r\343\n\362\326&\277Q"
+	.ascii	"p\241\001e\212\330\214'\303*\271\005\240\344\274\036ve\220Xr"
+	.ascii	"Kn)q\026E\221\fRb\021\352\262O1\262\344v\211P\211\305\2472vK"
+	.ascii	"n\227\244\224\230tw2\255\227p\2149\t\003\276\236@,\025x\346\314"
+	.ascii	"\255\n\201B&7\201\247\210\2370]\305vP\025\340ZX9\022`g\017\210"
+	.ascii	"\342\264\260\0048\271\366vz\025\362t\272\311\320\240&i\266t\217"
+	.ascii	"\241\272,\303TM{\270`\246\250\212\337.\005C\323\034m\203\001"
+	.ascii	"w\251\356\241z\025\242:X\323m\260]\356\352\311IU\250M\340^U3"
+	.ascii	"E\311\314\255\356\322\255\325\r\266\013jaml\247Z9\231\225\325"
+	.ascii	"\205B{\240is\204\204\036\325\255V\026A\003O\237\360w\252Z\325"
+	.ascii	"\275\n\267Z\331"
+	.string	"\356\247U\240\266\201\215\355\264\224\n\324\275\251\255\252\273\240N\267Oh\3560\236\352\301I)U\250uW\016\247mj\020E}\332\n+\247\205\276\032\004S\330\324\344\271+\256\024&pZY{\335\231\301\005A\024\315\002\236\273_\003\336Ju\233\272M\3350TQ\221b\300\323'\324\372\221\345\364z\002\317\006\267\333-\335c\351Vu\316\252K\257\351nU\0238-E\323t\353t\213\245\250\212\240)\3248\005\236\242\353\313\004\016\213K\200\243\320\302\342\n\261\325e5\300q[\331\3235x\246<U\343\2664p\007\321\bNB+k\311\311.\030\352\363\235\273\325\026\306[\317\240\315\347CS\333\036\013\201\365\250\001A\246\020\315\210\210H\222\244P\030\016\321\004\2040\b\035\204\346\001\022 \022Q\212\202I\006\002)f\220A\214\f\215\310H\220\244 %-\034\302\031\330\304\375@\200\315\024\3070z\210r\3173^\221"
+	.ascii	"\374\330MM|D\302\302\250\302\361\306!\005\356\326\024\221\202"
+	.ascii	"D\351\322\"\335\006\247\205r\025\023\227kn\251-\242>\261\036"
+	.ascii	"#\250nacS\277\322-Ee\276\t\022\253\210\037\320\216\226Y\253\004"
+	.ascii	"r\260;\020*\037\307\360J\352M(\036\b\017\037o<\377?Q\210\304"
+	.ascii	"\bA \340\235\003\367\372{\225t)\276\372!\237^\243E\300\340\032"
+	.ascii	"\300\235\315m\270\313\341\275w0\\\200\227U\250\351\362\017x\234"
+	.ascii	"\340\350\007\235\023BE?\240TLt-\2339X!q\375\264\253W\rp\223\261"
+	.ascii	"\220q\024\004XL\"~\035"
+	.string	"}\376Z\353\253\344\032*\277\277(\312J`\371\274qNE\331u\276xPdH\220\n\217K\023\215,X\006\314u\212\261\327[\364\272m\232\370_#xlx\212m'\206\375\324m\304\227\265\353V\244|A\325\242\303\t\210d\277\337M\256\326s2\240D\212\016\331\324tM\255c@d'\272L\234M\215\374S\253\033\262\321\304\202<\262\232H\367\325\222{kP4N\353R\347\315\013\216,Zb4L;\375b#\240\252~:\"1\237(\2521\271\251D\212(Z\250\322\0302q\3050g\244\"\252\336Jt\323\363\312\034\322\\\203t\266\016\345\343\203\342A\205\327\262Al\023B\326\030\273\fv\224\216\207tGJ\365ZHI\213\006;\004Q\003Z9\033MD`5\312\230\373I\200\324?\271\032QdM\217N\252\017$\b\364\023\242\264\030\326\367s\004\270B\2040\003G\370\n\225t\330\023\262\270\006\276&"
+	.string	"\202\376h\r\353\245NIo\326\223\214_\023\227\262\363\022\375\240\366/9\326\313\2630\264\250\270\241\325o\372\237\357\365YAx\265`\231F\326\214\005\356a]\237\356\372E\035\210\247a\354\341\275\342\373\201\2000\276\023\221\220\203\333/\317L2\346zM\262\005ls \213A\233\273\366\002t\356"
+	.ascii	"T\306\321\376\322@\202|!\253:O\020\341\370ar\251\030\377\303"
+	.ascii	"\224\3735"
+	.string	"\022F\361\001\024=Y\275\023\357N\254\"\212\263\026L\355\210\351x\335\346\363M=\271\022\357\345\225\231\360!Hp\325Pe\001E\005k\302`%\357\327\033\235\310\037&!\246\245[\n\204V\341E\032vn\007K}\363/\r\322W\334\247\323QT\220\004z\267\2429\022\231\364~\200c\254\026\004~\025\230\206Lz\233QZ2\370\275\254g\345\360\216\370\323\211\370\223\340\271C\271fw\250@\277#w\356\n\026\304\030*T\266\023\362\257\233\037\3757\037\020\375t)#\377?3'c\026\317e\321"
+	.ascii	"\310Rf"
+	.string	"\037#\250\034\356\352)$\331\325\210i\020\3231\312W3J\337y\335j'mCu\364\235/\312-gN\tB|!O\n\316 :n\272X9\255[M\305+\"\370\260\336.\032\254\217Y`\033\363xHb/j@!\030\3346\244M\273\2771]\274\375\340!\032PG\007I&=\024\bh96eN'\267\227>\016(\221\300\332\313\356\310\031\026\240\351\217\022-\013\211\260\324dVz\007\261[\274\367\032=\234z\243\013\307\214\030A\247\324\210Y4\307I3m\032yO\t\223^\013\005\367\334R\032\261e\204.\212\254\314\326\233.<\373\366\013!\005`&\nSP\341\023\221\0206\357\247F>e\"Op\234\254\360\343\307q\036\200X\203\220\236a\363\254[9o\262\307\026\256L)\227\257\250\334\323d\377\311Ts')3\270\374\240\246,\004\310\361\205\365\275\261\340\207<\250Ui\003\003\210\203\354\262\002"
+	.ascii	"\237*\302\033@\020\207\352\016=\323#\340\t\002\374\326z\2000"
+	.ascii	"\351!?\236M_\t\3066\264a\353\036\n\222\r\203'\261\306\241KI\017"
+	.ascii	"\222s-^\n\204\343\304\254\022\373\320\325i\036M\315\n\264\027"
+	.ascii	"\315\244\242x\235\304\330z35^\303\264\305\3122\232\376:;\357"
+	.ascii	"\214\301\002\001)\236)\252B\351`\336o}\375\006\031\224\001"
+	.text
+	.section	.gnu.lto_.pureconst.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375 \315%\005"
+	.string	"\322\f((0W\226\003\3000t0\024\004\312\276\370\"\005\340!\305I\200\223 \271\301wp\037X\303T>D\230p\353\342u=\306\016\373g\373\354\236Y<{g\353x\216\023\216\337(\262\361\032\004\032\237q\222\361\030-\030\257\027w\361\026gq\264\342*\236\342(~\342&V%N\342#.2*d\027\310\376X\345\341\035\233c@\033N\241\2551*c\024\206_\270\205W8\305\252\t\227\360\b\207\360\207U\016\336\340\f\276\240\245\340\225\260\017\034\031\354*PD\340\003.\340s=\300\t\300I\nI\222\024\024"
+	.text
+	.section	.gnu.lto_.ipa_modref.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\204\005\345\021"
+	.string	"&U?40\2572\034\300\300\300\300\3000\230\210\210\210\210\210\240\227+\332\266meX?\330\320\365\363{\230dv\356\262%\277\036\320\377\334~\fT\315{\302\025\255m)S."
+	.string	"/"
+	.string	"1"
+	.string	"\234\252\234\202>\021\312S\235\242rQ\347\247\374\323\367\0045\225\034x\026NG\201"
+	.string	"\200W\312'\252\204\251\346\314OS\371\251\274\2417\277\341\002\025\024\257V\003\325\216\225\307:a\345\260\276\211\177\225\021\203N\355\017;\264\201\f\357*\357\302\n=\230\255\362V'\253\234\325\231P\276\352\344\312\003\233\246\273\343.\345-\233\337\200\"!\005\241\225\323\372\221\361\030\335\331\341)\367\364ql\235\235\366Y\271\321+\252\306\031%\306\224\225\313\332\320\177a\001bK\214J\020\032\332\254\225\375b\303\336\313\305\026\353\325\343\376fT\252\324KI\324o\275\323\351\335d\337H$N\314;U%\345QxB\223\022\022\323_\032y\317\200\243\250QQ\310jRP(\f\273\001`\202ASU\364\021"
+	.string	"\0252\242\241\031\221$\005\251d\231\003h\020-\253_l\223\003J\371\246\2610\222\216\"\351"
+	.string	"\214\301L\276\177{/\023\305\2255\002\013\020$\224\310%\201\240\003\366\033l'2\013YK\035\214\n\305-1)\246bcDi\224\364\315V\343v\327cM\003nN"
+	.string	"\240\221iH\236\210\363E\277\032\355LZB\260\251\231\331-:a\222\213\033\033\362\337\177\332\210\364qS\277\275\tzOG\r\211O)1\023^\001-\324\230'\226i'J\251\017\t\307"
+	.string	" XE\377\366]p8x5u"
+	.string	"\304\021\236\275\177\363O\226\017q\2106u\022r\314\345\036\205&\fz!\206\213\261W\241\204\304\373\360\033\274Q\0165O\021\224\033\252\376\242l\342ID\237\231\nG\303.\234"
+	.string	"\251\240\031k\362y\354\272\253\006\367/\215TUe/\341~\231\313\256\030\\m\304\242X\201\ng\327B\336-\305\026\035r\213\372t\214t\366\352 \343\311Q\227^lF\356\365\b\216\331J\214\347';/|\216\002H=}g9\314\335\224"
+	.ascii	"\320\336er`\n"
+	.text
+	.section	.gnu.lto_.lto.1f5243c49cc38346,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lockMainPID.104.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"-\007"
+	.string	"BN23PO\323\001 :\345\307i\247\206\206<\222\037\215\032\340oj}u\021\331\222\240\346\277\261!e\260\254\215-\020@\304\n\336xM\260\256\260C\310\336R\246\024\316L\007\t\006\b\320\322(T\030\0136,`\030`\246\332\300I2\345\240\251\240EQ\025\274l{\267\332Q\2258*\341(\037\362\221\013`\227\363\350o\027\331\370\034\177~\270\362\361\317\277\240?\033\"\"\037U\245\t\315\354-K\315\260\357V;\366\323\352\006T\236\322\262[\361aY\224W\342\261\215\331\027\337\343\037\230m\342\266\r\355\030'\024$+\273\013\245\013@\177\356\001\320\237j\034{b\376A\356:.>Q\313\236Q\301\356:\243fq\353m\023\330\236l{\002\t"
+	.ascii	"{\311'cz\366\206}\017\026\272\206\357F\f-D&\356\212\251\235d"
+	.text
+	.section	.gnu.lto_sendMotorUpdate.105.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\205\007"
+	.string	"B\21635Po\322\001 [\370L\001\005\270(\325\016\215\330\363u|x5\325W/\303,A\214\304\017\0021\244\214\326\273\332"
+	.string	"#\212\254\360`\372\032\006\r\036\203v\2232\245\366P\b\n\007\t\020\373,X\035\f:0t\032\240\307\272 E\340\352\341cA\254\252,\270\341\366\231U\221\rR:\220VX\223\002\367\311\364\321G\256\201\025\221\223*\210\353\232\376>:\227\005\354\202\036}\220\207D\370\035\177\226\310\362\361\317\317\246?{\202\"\037\235$(\235\205n6\267\245j\330\317\254\212l\345\270\\\245\264\213\021\003\263\3353\361\260\375\2155\273\345\034\307\236\304rQz\331]\250\033\327\236\232\377\217kbh{\002\024\354\2563\2062n\275m\216m\312vI\f"
+	.string	"{\311'c\332\371\f\303\331\0062\001\003\357Q\031\272\206\223\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_updateState.106.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`4\0205O"
+	.ascii	"\272\212$\036P0\322RI\007\027N\304\372\311,H\267\267\350\t\244"
+	.ascii	"\033K!$\3700\357\216{\tA;c/\006\320\302x\336\225\265o\307\004"
+	.ascii	"\200 A.\313\023h\305\005|\334F\004\\\275\2130\376\257\242\036"
+	.ascii	",\033\340\321(c\301OyN\036\032\255\021\322\244\224)\271\001\234"
+	.ascii	"\001\352\001\374!\312\027\242| \345\007\231| \312\037A\371?\224"
+	.ascii	"o\232|\037\223O)\277\207\362y(\377G\371>\312/)\237\244\374\036"
+	.ascii	"\345\267\017\237)\177\247\204\316\b\345\320T\271k9cmr\274S\343"
+	.ascii	"H7\026\366\315\256\233]\271]\343n\230]1\333\303<\374c\236\177"
+	.ascii	"\277<\254\334w\356t\207s\333\254\233\357\233\365\341\224\315"
+	.ascii	"\271\346\354`{xQ\024\2610\262U\373\351\266\371\356\020\3673?"
+	.ascii	",\256_\232\2268u\265\326\246_\007\3375\313\346\024\016\311H\013"
+	.ascii	"\250jia\263\205)\207\325\241\203U\203d\244e\254]<\350\356\214"
+	.ascii	"\025\374\2264\352\255P\211f\337\250V\355C[\302\242P\375f\276"
+	.ascii	"\270\221\350\022\026\245\r\r\0313`c\230-\315\326\2606\374\364"
+	.ascii	"\036\254\332\213\276\356\302\310\226\374=\370\351\222\277\235"
+	.ascii	"a\3176\355\224\206E;W\214\022'=\244\314q\345\370-\271\025h\205"
+	.ascii	"\3120\037l\035r\3610\331\n\241\256Vc\003F\253^\0053V-<\260\030"
+	.ascii	"\311\\,y\031\277\345\177\311\266\354\\3\0206\250V+c\332j5\302"
+	.ascii	"x\360\267\344\215K\242\\\362\267B\345\222?\1779k\024\253{vGD"
+	.ascii	"\273\253\265\006;\205=\227\366\360\374|%\331k>\277=]XK{\322V"
+	.ascii	"\005\025/(\313\343{\200\212\227\t\373SA\305\013l}`>\020\271\\"
+	.ascii	"\036\270L\350\031\325Zi\327\220\311\336\0211o\205\237\256\255"
+	.ascii	"\336\211;,\267\345\302u\002\367b\210\315\221\341Q\361:a\273'"
+	.ascii	"c\353.\312O\227V\317\207\b"
+	.string	"\242\233M[f\322%d\366=Pk=\027\273\274\366>\373\037\314\377\372\217\240\013{\347\004\363\2535\213\210\265s\302\360s\354\004\303[<\301\224og\331)\303\333\362(\213\303\253\0336\326k\364\020\244\035\032\036\030\331\3379K\347e\244\336\306[|[\271d\243\025\355\016\301\332Y\375j\325Z\372\nqu\027A\026\020\312%\311\366\271\241\215\231e\361\361rmfS\272\257\274\327\333B\316\330h1\021\177\231\235\343Uk=\013\255Z\263Vt\367z\207aB>\236\273{\207u_\272\225s\343\233\345P8x\2138\312%\271[`\001\253\321\333>\304\330\206uY|<\n\376wP\300[\254\321\234\245L\305\253\0236\326M\360\252m\232\005\277\342\213\375/\300\200\267\370M[\0362\304\341\325m5\326o\024r_\371\267W\333\312o\362\223\230|)\223\037e\362\241L>\022 \377\b\220\317\301\272\331\033\001\362\213"
+	.string	"\371D\200\374\r\366\315\376\t\310\037\002\344;\001\371B\206\370M&_\203\225\333\007\021\342\003\021\342\377"
+	.string	"\362}"
+	.string	"\371\031"
+	.string	"\371=\200|&\223\277\303\344\3530\3719L>\016\223/\201\311\277\261\306\275\2155\333\215`\303\354k"
+	.string	"\3714\200|\006|\370\013P\376\f\312W\200\362\227(?\001\312W\242|\031A\374\030A|\004\202\370\007"
+	.string	"\361\203\224\237\004\304\207A\371/\200\370.(\337"
+	.string	" ~\001\224\2174\202\337\302\344\2630\371G&\237"
+	.string	"\223\277\202\362\007\240|\025\224od\362\005\240\374"
+	.string	"(?\005\345\003`\362QP\376\t\312/\372\341\2330\371D&\277\204\311'a\006D0!\037\021\350\036\035\221\314j\253\374\020&\355m\253\311\226\372;p<\326\261\321\0074I\345x&\227\366\205\001.\240\203#\234M\222:\350\305J\251K\212\244Vz\3210\270X-[\013\r\274\350e3\240]\260`\265rVx3\240W\016\034\244.\240a\020\363\2228\213\025\257\315u\261\n\247\223\255\203\324$\224']\302\312\022`\002\372\250Yt\213'\247\t)\260X\023\224\023\005\024\312%[\354h\0269\372H\202&\340\355FK\260\242o\364\232\031\240W\250\350\001\332G\307\250UX\251b\364\005G\347\020\240q\364\272\005\320\002\244\350"
+	.string	"\332G\007\200N1\305JiN\n"
+	.ascii	"pJ\350\022V\346\246\243w\240h\035\275m'\032E\2349p\310H\251c"
+	.ascii	"4\326\177\250\250O\264\217n\310E\030\305JI\nC\021+j3\013\315"
+	.ascii	"\230[\220It\211&j\023\375\237U\316+FD~\302`Ng\n'\026,\345\222"
+	.ascii	"&\232\007\f\252\211|\272Do\321N\252I\270\2319\223\263\301.\252"
+	.ascii	"\245\206:\252\227\214P\017\001[(\250\201\354\305_Nx\311\240\022"
+	.ascii	"\246\210\260I\332\207\231,P'\351\0353\242\201~z\204\331?0\270"
+	.ascii	"\t\t&\020_w\302\312\334\256*\026\222\206\352\363\260\316\036"
+	.ascii	"\217\3733%m$\2756l/\206,\306191sz\232\366\256\r\331d\361\261"
+	.ascii	"\355\007)q\306\f\263\246\324\277\207\247{\332\2076\344\362k\236"
+	.ascii	"f\270\341\013^b\265$V\253\326\214\377T\201C8\265,I4\367k3\f\333"
+	.ascii	"\230\333\002a\006\203\031\331W^\346?\257\260\321"
+	.string	"&\276\344\316\326\370\272l\033\315g\206[\204sx\313\327IX\300XX\266\332W\\XY\203\2610\303\016=$\006\332\253)7\r\327\323\013\321\\\336\036\317\026\\8\275x)\227\3344\001/\222DU\244\252\t*\030%\005\005%\345t\302\351\211*\252\347\373`j\252\311)\bU\324\217\252*\210\022\251\250R\211TT\220'(#UH\232\236\246|\240\214\\\320T\205\344i\310\257\352H\222\276S\322\004<r\\\020\254z\"2\325T\025\2142\322\004\025t\232\242\n&\031]*\311\323T\260JJj*H\215Y\333\253m\345\017d\265\220i\321W\227\260\262e'3\250\235\365(\351\325J\305\201\025\263[\027\206\217\277\301\253\306pWv\324\360\232\253!\256\360\256\354\\\331)\257\212\270:\362\026\317d\300\304i5\326i\364\323\234K\336\350h\264\017\2075<\263\254\276\231s\353G\f\007\006\332w\2666f\266"
+	.ascii	"\2671\\\321n\201.A\246\205\270\031\274\366\246hw\303\214\261"
+	.ascii	"(dae\313\323W\016\367\202\257\211\007\213\232\274\222kX#\315"
+	.ascii	"d\347\226\347\n\034\031\037\020\035kl\210l\345\027\251|j&\277"
+	.ascii	"\002\255\3662Xo\343\265\242\335R\333h\005\272\337\fu\020\266"
+	.ascii	"\214^j\222n\311\227'sN\274\270\265\211Q\352\004z\207\\\216\264"
+	.ascii	"R\227pC\"-\243\227\207u\201\003\332\231\234\230:\016\272H\037"
+	.ascii	"1\322\0344YD\221\336\257 \3306\350!M\244\367\2517h\362\r1\317"
+	.ascii	"\251\205\364\220\356\241\t\031\355\334\242\301\251\217\204\233"
+	.ascii	"vn\t\351\365a\217\352\334\031\373i\320M\275AZ\203^.9m\206\\\200"
+	.ascii	"t\220^:b\3362\225?\032\210\217\376\321>8b^\257\371\341\253\356"
+	.ascii	"\271\244\314\240}4Ig\030\003S\367\350\fz\347\226\344\222\363"
+	.ascii	"6\334\"\244\321d\255\316\327\243\231Z\b\233\235\311\270L\311"
+	.ascii	"\021\013,(\227\354\321Dp\314\262\334\374$n\332\271\344Wk]b\352"
+	.ascii	"\023`\260\022Vf\366:R\240\264)\367G\031\243\205\234\305A\240"
+	.ascii	"\017\350\030\335k\001\201(\250a$d\221c\210FDD4I\ni\ra\005\204"
+	.ascii	"(\346\2503\036\021@1c\f\215\320$)d\332\f\333b\214'\367\337e\312"
+	.ascii	"\254\342\252\371U\334\224{\275\313\243\320"
+	.string	"\261bT\243\367\3479\275+\341Kd_\336\321\n\347\214\005\335C\303x\271\273\377\352hx7\216\036\245\027\323\330\204D\020\357U\201\350\036_~\214\217\312\003\351-\267jy\247 \207\344\021\361O\022\330o6\235\004\032\315]\211\035\347\214X\001\370*\033\035\261\2364\341\256\272\rY\030E\312\303\001\200\re\341\024f\206\303\236m{c\206\2007t\215n~'J~\274[\236,XM\213(\335\271\262\013\b\232X\020\264\264\"\340uF~D@\017\242Ij\353V\202[Hv\255=(\t\007\244\223\036\317J\320\302w\320[\344\034\3716\347f\347\177\274\243\022\2769,\372$\206\342\332\261\326\320\361\366S\272`\275r\273\021\372\200\301\2403\231\200\004\r\265c\177aH\333\336\200\274\200\300"
+	.ascii	"\315\256\302\370c\016\330\322\031\002\bq]\224H \337f\nN\033<"
+	.ascii	";\271\205\0060&\t\234\304\244\330\363\3004\037\364\032C\344Q"
+	.ascii	"\217M\361\311\366,\001\224\307<3$\021\371\242-~\341L\323\002"
+	.ascii	"[9\272\345\267\213\336\rI\330I\240\272\202\3775O\224W\216uZ\264"
+	.ascii	")\203\307\214\221\363{\252W\307!\021\340'\024\2451x\335\f+F\365"
+	.ascii	"\251{\217\322\232\343\3445\232\373\222\002\204'\323\360\243\201"
+	.ascii	"\377z\277&|}\233\346\315\n\030\033\201\031\225\027@i+\036Kt\261"
+	.ascii	"-\342\n\303\333W3h\321\024\373W\243\255\245\260m\0374'3\202\325"
+	.ascii	"\r\204g%fa\027\f\207\307\230\366#.Jo\253,f\262\253\342\256\201"
+	.ascii	"\273d=\320\201\246\361\351(\247\307\245\013\374\337D|%\313\036"
+	.ascii	"\332(\250\272\223\236\260\030\332\253\215\263\221@A\201\026\221"
+	.ascii	"\177\245\212^\031 \374<\272Es\221\243\306\003\341\363\007\270"
+	.ascii	"?\373>/%\273'zo\377\304\235\032d\327\223\315}gH\266\317\355R"
+	.ascii	"\021\3333\366t$2\352*f\246\204$/nR\001*\314\241M^\375\277|\356"
+	.ascii	"\360\205\350\016\"\034h[\361Ut\b1\35700B!\245\350\370\324"
+	.text
+	.section	.gnu.lto_udpThread.107.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\027\002\345\022"
+	.string	"6b}I\320\362\2501P*E\025z\302)\272\007\035\tZ\360\006P\310\215\013\3310\202vP\257\3428:`\372s\023\227\266*@:\0264\006_2\\\354%1\003\242sTf%#p\027\325\236\230\247\216\t\221\251\374\367\336rK\231Rg"
+	.string	"g"
+	.string	"f"
+	.string	"\247\212\032\221\250'\246\206\220{O\322\347\013\204\267\343\t\204\267\225\307\241m\265]\f-8Vj\363k\024\024\224\221y\273Hb\306\370NO\2309\032\2328\267"
+	.string	"|n\016\226\370\340|\004'"
+	.ascii	"\375\254\370\023M\016X{D;V\246\216\326\373\236\340ESN\312\310"
+	.ascii	"\2749\025)\334{Mwf\315=r\333(l[\260)\203$J\320\357\304J\013B"
+	.ascii	"\363\253\212\251\267\n5\325+\252u\307>o\224e\003\004\303\225"
+	.ascii	"g\277w\213\224\372#\031lfR\034I\220\272w\246\b\221\353d\223\\"
+	.ascii	"\274\367\3336\337\347\225}\236\206\355=+\2157\232q\210\247E\325"
+	.ascii	"\275\267\301\255!\214\267-\220>\310T\037p//(\307\275\347\003"
+	.ascii	"\223\343\355e|\206\315\246:\02098Z\304?x\357\275!\312\023\023"
+	.ascii	"\013k\001\364B\327Q\262\222\374\212\321\357L\202\364s\322!@\322"
+	.ascii	"\001\002\326\035\377\265H\207\2674V\236\314\255\024\212\225\245"
+	.ascii	"3\345\363\241\243C\034\200:\352,\341en\246\360B?*\025\3640\372"
+	.ascii	"\215\020-e\031\336^\3506j\343\275\270\357\374\241\023\215\360"
+	.ascii	"{n\375R\243\337\335\372\26561\201\311b-\230+6\003\241\342\002"
+	.ascii	"\253\225\310\356\242\271`\240_'\030T.\244\220\264\330\207\231"
+	.ascii	"\213F\312X\\-\344k\366B\236\264\\\272\304f$\255,g\344\352\276"
+	.ascii	"\362\310\213\370\345\374\252p5g\003\324gJ\261\035\234\207\006"
+	.ascii	"G\270\3350\232@Y\300\241\003\305a:\351\352\355G\254;\206\t_+"
+	.ascii	"\374\360\225\276\004\343\367\330\303\312J\255\276\246\030\001"
+	.ascii	"* p\002\031:\353\001{\371\023\264\213,c\242\261\260Q\217\326"
+	.ascii	"\330\260]$\372\262)\035B\236\027n-B\263\202[_Y7\370\256\364\344"
+	.ascii	"b\016\204~\220r\336\300=\346\023A\253P\241uB\215.\035m\304qe"
+	.ascii	"D\024\035\220\355\005\220\254Q\373\334\306pkd\223\001\302\301"
+	.ascii	"\034\261\230\274\276\232\t3^\227!\003"
+	.text
+	.section	.gnu.lto_tcpThread.108.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\\\001\325\016"
+	.string	"\206Y`F\360\260(\0350o\253\343\376\210\272\367LV\325\235\275\323\312\344\366~@\231v\036\215\035\035\n%\373\231\355\377\276\234\247#\020\326\t\027\224l\003\252\323\256\256\201\262C^\321n='\271~\t\031d\227\255%{o\231RH"
+	.string	"J"
+	.string	"O"
+	.string	"\324\340\017h\237\236wh\237q\204\345\222>e\\\222\037olld\276\322\247\354\244TJ\b\370R\362\203\023\326\274\365\375\360\235V\242`y|\353 /\261\030\0322\037\313\267\343\240\326\352U}+\267v\333\027lC\260/\"{\225\r\310BYx\212%\033,m\fa\377\343\202\023:\256\354]\037\300\262^0\277\221Q\253\312,\247\302f\215\t\333$\233c\317r\354\005j]\261^\265\202\013L=\237_q\030\222\035C"
+	.string	"\272\254t\\3\036X\330\250\025\f4-\330L\321\036\037\324@-\216}\327[\244\370$<\"\332\253>}\221\366\371\030cb\262\026\323\316\244\314\200\022\200F\005,\272b\244\276(IRx\3260>3\343\005D\255n0\233\345\240j5\201\330\033N\006\234\200\241b\311sm\016(\001\376\370\b\225p\036\241\215\3530\210\230\200<\002\233\267\205\244A!\022D\"L\240\0367\322m\036-\021m$\024\324\235\320\020\017\217L\270\216z\243QG9\300\372\270\242\327p\243E\026\232\342\311\035\353\277\240`+\270\213\n\376|Z\360t`\220`\003\275\270\r% p\002\221Z\346\001{\362\205\206\327c\226]\030oMj\265\213<\025\300]Q-A\307'\270\303\336\256B\212L\343\b\"\300\035\276[\022\237\nv"
+	.string	"\006\fp\316\347`\214X8\017.S\0216\207\246K\316&i1"
+	.ascii	"\277\205c\021\204\364I\344P\312\257\013?\001"
+	.text
+	.section	.gnu.lto_systemInit.109.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\360\007\025-"
+	.string	"\nO\320\021E`^N:\303\225\231\264\030\327\265\273\366\026\212DR\365{\213%\313\224l\303\253\323\354\365L\3763\032\335\370\250\266<\377\317o\353\306\017\2212\214\347\252 \231)$\322\250\215\263\274\250\231\2748\255\023M\b\331;\311\001\001\371"
+	.string	"\016\001nvs\260\235\263\325\021\355\323B\325\267'G\373\325~\273\337\337r\266n_\327\370\263E\b\311\0333k\333\326w\265\273F\267\357\352\257\345k\355s>-_\255\341\200Z\316\266I\001\355\256\275\300^\005\246}\263\237\345\243\331H\3330g\273\243\204\0267fym\353T\272\332B\366j;O`\275\312\336h\275\332\271\233\316\235I\332s\231\303\265%\257m[!F\362|\242"
+	.string	"CB?_\020"
+	.string	"\026hUS|s?\250\231<\021\203"
+	.string	"=$d\354\nQh\023c\246WdG\222\377\322\bcq_\237c\212\245\004\344\310\344\\\n3\310\365u\020\220\037\027@\263\237c\372\220\302\f\273@\275\246\031\372\304u\031jr\245\230\254\212\362\252,\330\323\364\300X\334W\222\034\231\034_s\353\342T\001\335\032*CM\255\264A\020\"n_\373\305\321\314\272\027HC\333\266}\227\315\035\357\242w7\233\356#u\257v\001\034\230\230\326\253\003\326\352\332\356\250\370\370k\332\266m\253\342\262\3375g_p).k\245'\341\257}\300\032\0078\t\037\216\353O\202\033\364\206[\373\036\326\037\356\263}"
+	.ascii	"q\277t\200\317\366\177\365\270\342e\347Ny\233s9\320`\\\3266\326"
+	.ascii	"\037N\345\242ix\350\340h]>m\300\f\211$7m\253\374\322\004\253"
+	.ascii	"\004\201\"\305\375\362\207\027\350\330\203\236\016\225\266\366"
+	.ascii	"*\326\376\230\277\251\3507\351\025,X\254WU2~\362\362`\335h\023"
+	.ascii	"\335~\030\033\335K\007\343\324\027\256>\261J\f\017\206/23\357"
+	.ascii	"N\013'\333w\377\274\033\221m[\254.o\223\3527\271\332T\304\373"
+	.ascii	"\345\325>q\275\272\364\356\030\306\373e\177\355'\242\255\336"
+	.ascii	"\335\026Nv;\263.."
+	.string	"\353>\216F\243\321\306F\272\323\333I\352m\007HGFWC{\377\322\333*\276\235\246\267qz\373\342\333\2070\240n\315.7\007\022o(\tR\217U\376\313\003\344\036\322\017\0010\250\336\235\206\253\364f[\362\347\275\221\223\013r\026\253\274\332\203\253\177^e\356\272Zw+oq\345\256.\034\331\353~i\204\205\336\322@\271\356\230\264\273/\241\013\267;73\0172\320\254;\251\223\326\366;\2155\215\2468-\343#\f\353F\243DQ\343\303\322g\017\214U^\311\357\355\n4\f\032T\204\257vD\016\017]\205+\374\237\331G\006\222\305\366d\262<\327\223\205\020\311dde\031\311\375\262\b\013\275Q\201r\271\265\235\001\030\273\253\243\204U\336\013\372#\007\213\313\032\237\356\177^N\034&\371\354~\211\261\200\037\320-\234l\034\255c\323\005\b\302\315Or\024\001_P-\234\264k\223\247\260J\343\260\311\324\273;"
+	.ascii	"\304\312\212\313\372\246J\277P\242t\360\322U\214\343b\027kp\222"
+	.ascii	"n?WY\377\374\\>\203^._\311Y\362Y>[\263\226\r\367\313\213\207"
+	.ascii	"M\334\217\273\032\032\001PW\305\241\214\342\320Xt:\032\013t\020"
+	.ascii	"TR0\030\224\252\212\232\002\216\350\200\002x\274\022A5c\004\360"
+	.ascii	"\030U\025\205\240'\004%\004%\004-P\230\020T\034J\025\211)\254"
+	.ascii	"\236\216\006\254\210\304&\004\315\240H,\026\207@\251'b\323\360"
+	.ascii	"\350\004eu\005\034\036\235\206E\016H\r#\350\"j\n\352h\024\016"
+	.ascii	"\241\256\246\236\252\242\204E\343\225\360\250G0\2350\361\201"
+	.ascii	"\203\210\246\026C\035\f\006\217QU\036XP\r\217F\032\306\025D\307"
+	.string	"a\021[\r\217F\251'\342\024\333O\301\246\023\036L\b\217\303\027E\247\243\260*\312\211J\370T4\n\203\300&Z\r\213\302#\221X\024\372\234X\307FZ\003\026\316\032\342\325\206(\304]:{d\335\332\215\264C\276\271d\300\240[P\274\210\005\350s\305n\220\233\334+\"\303\033B\302W{\222D\3069^\330\355\201\234\223\311\356\227HX\350\r\357\350\013Y\307\016\253\374\233\036\314\2457\033\2233\377\3632u \361\344\256\373\345\021\026z\263\003\345\302\311f\272F\370\317\200\226\250A0\306\030dhH$\230 IR\230\016\300\002\221!\262\016\021P!\224\220\211\2236\003Pm%\333E\206\251|\f\210\340\2579PY\334S\tf\246\235\344,XE\202\246<K4o+\215>\320\032q9w\326s(\306\210\304i\ba\263\025\305JH\235\031Nb\344O|\2177\303A\316 \235k\304\346\276\344\243\t\177"
+	.ascii	"!<\250t\024l\357\353\t&\037\026Sf\346\033\207\304o\3014\230S"
+	.ascii	"\211LF F\333\266\022p2\334\317\214&\342_w ?@\310\322E\305\365"
+	.ascii	"T\006\031\353C\204E\261\203\323/'\231\366\237\020\255\334S\266"
+	.ascii	"\315\333S\020d\037\364\257\356\232\273\3152\331\303dO\204\353"
+	.ascii	"\315\005N\330\021\316iU\2415\004\263\333\206\215\346!\353`\366"
+	.ascii	"\r\253\220\375\211\220\3649u\013\231\260\350\023f\223V\321M."
+	.ascii	"\222'\242\3135Y\034\272s=\217\233n\343\206=\2243\025\203{\362"
+	.ascii	"\240\3345lKf\fh\226\321\036\232\264\030\372\213\266w_\304\343"
+	.ascii	"\363<\005\"Fd>\177\320\241\220~\334G\327D\317\302\226\032"
+	.text
+	.section	.gnu.lto_systemReset.110.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\007\001\305\f"
+	.string	"\326\326TC\020S\224\016\034\241\004Bx\370\\\001\200\205\250-P8AL\212\212=\021\003K\327[`\367\241\f\213\326\267\232\330\023\3706\017\266\210-B\020\264C\023\260\306\202C\313\020\344\200\351\031\035\351[\262\211\224)\005@"
+	.string	"A"
+	.string	"B"
+	.string	"\255\230#\205\355k&\331?\316*\231\247\221\362\001Ee\316)\327\304I\307VI\2761\325\027+\340\302!DK\235\260\f\nEx\223+\210\024\007U\313\2029\2475L\205\270\343m'\260\255\300\276)*v\250\0041\351\313\027\365_d\260\017\334\305g\004\217\032.\036$\201G{\203H\037\372&\347\210h\rq\235\266d\263J\272#\366\261\271%\354\253W\325z\3655M\341\301\342@\212\314\211z\021\231\001\257\227\254\270n\354\216\330'\327\255p\322\343\244+\2561\352t\272\002Ht`\324\247\220}m\317G\323\341(\227\261\2018.{\374F\222\026\211\026+\177\224\3710\036c\344\237\260\205N\037>\372]\366\030\003\036"
+	.string	"n\337\346`B\267\201\237\350\353"
+	.string	"\360g\323"
+	.string	"\002\203\007\022\334@\236\007\224\0278O'?\336'7\032\2070l\236\004C!Oj\026\337\001\324\300mN\204\314\b\026\206\321\317\370\332\330$p\273\253\362\261be\322\032"
+	.ascii	"{\345{\303\206\315\332\251\2305\007\333W\210\266\270\30110\314"
+	.ascii	"\265!\244\t\212[x.\004\006\201\253\272zk\246,\f\347\3014\260"
+	.ascii	"X\251L:\312\nxZ\355\232\350?\004\3622\004p\371M)\024\024"
+	.text
+	.section	.gnu.lto_systemResetToBootloader.111.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`G\001m\016"
+	.string	"v[cF"
+	.string	"\261&\035x \312\242\233\350=\251\266\260\217w\340\232\362yk\265\233\2516>\211Z\244\337\360\304\367\021W7\031\"!\021\004\227`\333\215\374\377\254\310\350\004\241\206VK"
+	.string	"5i\214\271\336p\f\031\240H6\2212\245N"
+	.string	"L"
+	.string	"P"
+	.ascii	" s\216\350i\315\311R\340\355\343Q\364P\366\210]${4\312\3569\313"
+	.ascii	"f\236\307\306\313\316\317\234s\333\325Q\307VQ\276\261\230/v\300"
+	.ascii	"5\303GS\245\260\020L\211\3609\327\017*\016\252\036\f\346\234"
+	.string	"\326P\025\342\216\267Mb;\202}\022\001/\203\250\257\303\331\t\316b\305\013\036\275\017\017$\005\036m\026\r\372\320\317\271\311\f\b Wj[lV\213n\215}l\3169\2754\266\252w\325\252\352k\006~^d\004\2501'\314k\307\274\021i\230\320l_\355\2538\016\352+68\2731>@2.\372\272M\220\253\265[c\273\270\256\005\035\034)\rr\fp\302IW\300\352D\210\372'\331\327\256@\322\207\026u8\317_\224\244\311\224=~\343\352F\004\216\214\017f\376\316[\200\376\215QN\372\360\321?e\217\021\205\216\0249\\4&\320\311\013$\016\303\307q\r\270\321'=\t\341$E~\036\350Q\030 U\300\321\347I\226\025\331i.\215<\0309(\331>i\352H\337\226\001\205\224\262\225:o\033\021\231S\221\335\366q\\\267i\036\376\322\330\006\240\bn\227\230\204f\\X\210\036\306\267U\222`\332\030"
+	.ascii	"{\345\363\206\255\212Ys\260}\205h\213\033\034\003\303\\\033B"
+	.ascii	"\232 \270\205\347B`\020\270\252\253m\315\220\007{\3006\245\222"
+	.ascii	"\352(\323\340iu\301\250KX\304j4p\227L)\324\036"
+	.text
+	.section	.gnu.lto_timerInit.112.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\005\007"
+	.string	"\342\21405`O\322\030 \374\224\004E\201\030]\205\024\020\202\351g\223\222!\1773\006\201?\303\354UD\016\261\311V1\370\231\327\275\021,\247Q\007\244O_\b\021\262\267L\001C\bg\005\332@H\352S\315\007\202=\260\301a\303\211\223\212\220\235\031AU\347\023=r\"\302\202-\tJ\306iY2j\264Ui\237\210\023\263e<\215\001\334zB\361\tjR\261\202N\026\002\034\361@\247\277\300p\232\355V^\266\215\207\275\206\271\027\362*\355\023\375C\030)\213\313\256\307\314h\267I\205\344W\315\327\267\2506\262\232\"\323\201\002\263\273\361\211\350\245\356Z\265D\007\262\020\246.\200awwY\350C\177\372\033\374\013?H\n"
+	.ascii	"{\3117c:\363\206\271\241?y\256\347BN\026\354x\031\002\\\272E"
+	.ascii	";\237"
+	.text
+	.section	.gnu.lto_timerStart.113.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375 \305%\005"
+	.string	"2\t\")pm:\030\272 Q\027\240\2408>\260\246J\"\267\324b\363)91\023\210\204P\323)\201>\2343>\252\302\2731\356\235R\276*\204\342\220P\r[LK\323G\303r\3505#ZQ\316 \330T-\313\246N\340^~\224DNl\220\213\362b\037\260\362\263c!<\210\264[\tG\373\tx4\266?y\263C\0073\373N\211\302\021\355\256J\314\267\307\315\377\346\203\316\343\036\005\206\335u\354<\313-o\233`\273\262\315\b\t"
+	.ascii	"{\3117\323\342\234\031\001\276\3345\234,\204\3612\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_failureMode.114.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"M\t"
+	.string	"\346QB< \005)\035 \241\201\001I\001P\004\274\216\227\311\300\0026*\004"
+	.string	"\333t\340\233\215g\221\261A\213\fcFu6)\312F\202+Saf\231[\004H\305\n\0348g-\331{\357\224\002-"
+	.string	"2"
+	.string	"/"
+	.string	"\247\376l\232\207\261\375K\307\006\313\315\356VYb\031\277O\031?\037\001\366\031r\271\275`\217\234\321\356:\272^ 7\275\355\221m\222m\227\224\243f\305\022\264/\373\3434\360\370\214\315\356G"
+	.string	""
+	.string	";\2431&\036\333\217\366O\216\362]\226\341\200\335\221\026\230\335\360\300\265s\n\372G;\235\037\320\002\276\004\375)\301\317\335])A\333Z\214\362\341UV\002\261\335\326]\026\235VB\301\251}\201\021\357\362S\276\311\210\3144$\313\016YQ\222\330\017\336N\004\240P(\364\300\235\272\005\316[I\240J\020\016\037\356\324\245\246M\"\205\006\022CUq\021^IU'P\245T5y\025U\004rG\301yU\325u^\365\3306'\013"
+	.ascii	"~\311\005\346d\344* [\356], VS\202{q;m\266\f\334\270Bq\002"
+	.text
+	.section	.gnu.lto_indicateFailure.115.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"u\n"
+	.string	"\266\023KC \307*\035\220\b\"\002\3010\023\003\331J7"
+	.string	"]|\n\016\323\363"
+	.string	"\244 "
+	.string	"\346e\b\022l\032\241G\003 \251\300Za\003\214\220\242\240c\314\0049(\341\t\356\307\264\002\036\252\240\002\330\266F\310\336)\0053"
+	.string	"5"
+	.string	"9"
+	.string	"us\256;C\346\334\366\205\3149\217\366\203\227\261\375\201\024\024\003\020v\267R\227\217\237\243\377\001\347\220\257\326\247&\264\273\236\344k\345\246\267\355`\373d\233A\333\356\256)\314\276\354\237[C\214\203\216\332\256J-\302\322\270\004/\266\337\261=K+h0\333\335\217%6\347\374i?\300\005\214\227\221\230\263\313\202`\266[~\034\253\n\352\f\252\276\260\212 \030\326N\271\337\226\302\314\001\200VBM\254\231\223\236\300\013\254\024b\273\256\223\254\215+\004q\316\026\031\231'=\027\300\320Nh\313.[\223\266\330\017N =t\036\217\347\343#\201\031%\217n\"\004K]\310\312;\225\272\n\013Q\367\205\254\223\311\273\210\020S,\220B\364>\325\027v>\022\210\332<\002\211604\252\370\201\204\236XS&\017UGa\013"
+	.ascii	"\3369\312^\222\310\330\013?k\202\263;\256\241\2550^P\345\b\250"
+	.ascii	"\333\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_nanos64_real.116.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\227\001\025\017"
+	.string	"F\035eD"
+	.string	"\221(\035\230\303\357\234\002Z\364\361\273\240F\2568\306\264\333g4\177\033\227\"\200\342\b\330\007\220\304\177\365\303(k_\275\265\370\321\332Y\370_ \026\\\\\215\n\274\276\362\032\255*\333\267}B\310\336R\246\024Q"
+	.string	"K"
+	.string	"Q"
+	.string	"~\314\034\330O\244\376\241\276^\212&\306C\006\331n\312\200Gw\334\343\367\343\223x\211\224U _\207\025-\306\205\001E\216\335\257\363\367\017\355\221;"
+	.ascii	"\355Q9\\\365T\371\217=\266\300\230i\251\254\236\333\202\335u"
+	.ascii	"\266TVn\275"
+	.string	"m\001\266\013\330i \\\213\300mS\205|\313\037.\253CvAW\366\267J\335`\037\256\276l\247?0\355\201\351\016Ls4\275\201i\rLs\232\336`Z\203\351\250i\b\323\n\323\251\351{@p\201\342\032\021\001\307.\312l\307\316\210-B\374\373\355T~\212\253@\371\037\036\r\"\345[\217>I{\334\024\001\013,\252\252\246\367\\P\243j\f\223\307BPCh\300X\334\206\013\314\256\023X\330e\005HU\275\327r\2223_S\363\206'\263%<&\342v\367\3005\004\304\313e\002\306\312\231\271\374\313c\244\246S\272d\244\301\003\006\016\272\023\310\244Dr\352&\204HD]I\311\324\215\210xD\001T\352N\243Q\251\343|{\270\372\372\250\bKO\214\202\273\032\024\374\373e/9\263G?zOFG5\365h\224\361DpT\243\235\215r\024\344\305\212\220\314F?\303\302\251fSN\267\0320\242\036"
+	.ascii	"{\311'c\232\211\f\027M\346To\bm\254\006R8f#\024\314\n\362\003"
+	.ascii	"\313\001\201\b\333f\022\235\267\260\022,\b/\013A\264\3233\266"
+	.ascii	"\241\307:\233\277\337\022.\214\324\325,*\214-I5\016\356\226j"
+	.ascii	"\2018)\246k\222\001"
+	.text
+	.section	.gnu.lto_micros64_real.117.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\304\001-\020"
+	.string	"\306\236kE\360\260(\035\350|J\346\231\210\323+\023\237\013\205~F\322\363\367@\260U\307F1S\361\232\351\350A\334\2371\363\361)\252\257\026\013\374r&\374\340\363C\261\r\206\252\227\243\321\n\327\362\266\366\177\311'{K\231RU"
+	.string	"P"
+	.string	"["
+	.string	"\336o\247\3702\217p\216\"\345\036\312\267s\t\355\204\240\231\355\272\034x4\267=~\001\370&~\223b\225"
+	.ascii	"\336\007\030mg\006\203\216\216]\217\263w\020\355q\373\207\366"
+	.ascii	"\250\036\256\362T\361/;\354\211\361\305^V\236\240\005\273\353"
+	.ascii	"\214\275\300\334z\333\005l'\2603\025\336\3629\227\231l1\004\267"
+	.ascii	"O*\344c\006\261\371\3311\273\240+\266\267\222\332\301>\\\225"
+	.ascii	"\261\235>\301\264\t\246K0M\202\351\021L\2134\035\202\351M\323"
+	.ascii	" \230\326`:\3024\324\264\302tj\372\037\020f-1%\"\320\330m\371"
+	.ascii	"x\354O\354\021\361 \3354\304"
+	.string	"\207\005\313W\361\025(\376\314\243U&\371\330\243o\242=\202\364: \242\246j1,/\236\201\304\206\032\032lz\\\254=\362}),\354\302\006@\215\372\256\206%?\253B\2152J.[\251\022\260\201sM\325\034\335\314\226p\031k\333]\005W\024\315M\314\t\034X~\001'\2574\t\252\301\003\006\016\270\227\252\304\225zq\023V)\026G\342:\341P\"nQP\271\270W\253\345\342F\336\036\256\312\234T\004\246,F\201\273\034Ff9\371\331\244'}7\003\206\003fwm\240\244&M\236\256\206\244\232\226T\273\321\215\030\351\246$\r\361\021\351(\244\"\025\320\203g\325\"\244\207\021\" p\002\2312\332\003{\362\211M\327\3210\177\332\327\215\375\335\216V\35308\315\203E\321\257\274;~%$\210i\354F\346pit\261\25577Qt\344\300\217\207w\"\343N?\306W\315\235\267mn\030\333\022G\221"
+	.ascii	"\223O\336\311:\r\020I1]\217\f"
+	.text
+	.section	.gnu.lto_millis64_real.118.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\304\001=\020"
+	.string	"\206\236kF\340\222*\035P\303\242\256\347\341\331\310\360:j&YIG\"x\204\214lT(\360L\336\f\035b z#\357f\230\003\225j*}\226\3035\033\205\210\243\003sd\303\030\b\t\020\261\033,\f\327\2264\262\267\224)\005U"
+	.string	"P"
+	.string	"Z"
+	.string	"\277\375\362m\376\300|\305\353\240\353\363K\351\314\204x\271\315\231r\340\322^w\371\t\300\177y\212\227a\002\300\017+\334\214\013\006\231\036s\202\236\301\213p\227\335C\270\313\365p\330\025\346\337\366X3C\007M%v\345,\230sZi*+\367\336\266\001\333\tl-\005\372\230\333T\035\r\301mV\005=\315\"'@\037\267\013\033\263\301\230n\007\373q.\213m\365(\252EQ\035\212jPT\177\242\332\263\352NTw\253\346D5\027\3252\252\343\2527\252u\325\017\201"
+	.ascii	"\004\245\346\022\341fN\224\020\310\264!kH\034\f;b\363\002\345"
+	.ascii	"\267\270\013\227/\342\322&\225\236v\351\253\270K\316^\006\204"
+	.ascii	"\\]\2566\223\361\f(6\334\320`\242&\306\264K\302\220\205\2059"
+	.ascii	"e\004\342\312\375\3272\323\320\273q%\215\223\333N\273\005p\300"
+	.ascii	"|u\227\307w\263%\334\206\352\346\234\n\276\244\021;j*`d\032\272"
+	.ascii	"\013\254\226\332\204\324\340\001\003\007^\313t\262*\265\274\t"
+	.ascii	"\247\022\3123Y\261<\022\211S\024L+\257\225J\255\274\0178\037"
+	.ascii	"\347\262\214\226D\2663\273\342\234\034Jn1\032Z\264\243\375WC"
+	.ascii	"\366\303\001B+Z\245\371Z@\313mh\271\034_\211\317v\013\332\021"
+	.ascii	"\033\317~:\353\331\001AhN0:\373\033\316v\001# `\2021e\264\007"
+	.ascii	"{\362\211M\327\3210\177\332\327\215\375n\017\243\260j\035\006"
+	.ascii	"\247y\260(\372\225\373\016^\t\001\"\032\273\2209\\\032]l\353"
+	.ascii	"\315M\024\0359\360\343\302\203\310\200\323\207\361\265\346\316"
+	.ascii	"\30767\214m\211\243H\200\311'\363dm\003DRL\327#\003"
+	.text
+	.section	.gnu.lto_micros64.119.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"\005\013"
+	.string	"\026\324IA \213*\0358Q`"
+	.string	"\305U3\022\266\030\3209\271\036\244"
+	.string	"4\"\3530\"\236\n\257E\321\276\277e\\k\242\222\235\3510@'`\034\330\254\337)\200\233\021b\201\023T\360\020\336l\203\354-eJ\0017"
+	.string	"7"
+	.string	"9"
+	.string	"\021\332\345\036\270w\031W=_\002\202.#\250\307\r\n\022>\020\365\215\024\251\002\261\007p\024)\023`\245\263\256&P\244\352`\231sZ?\360tk\267\255a\273b\337\"\253\262\037\347\246l\253\245\325\273jU\365#\027\257W\3100\347\200\331\206\t\223\021\024\330\376\330\023\177\301\031|\354M\204\bN\032\004W\351\201\2069\303\315\341%\264\313\310\003\006f\256\270\252\326\035x\0016\033\355R\256$]X)\3515Wk\217\366\365ha\030\251\314~\203\207\036?\201\005t\364\337\245\337\321.\277g\275\002e!F \2443;\004i\306T2:086N\346\243\273p\266\020\220\213f\303t\233\255B1\007 \323m\034\216\353\266I8\037\243B\254\334]\223\355][B+\222\022\2655\234\376\323\335\005]\026\025"
+	.ascii	"{\345C\030\2130\354h\341z,\200\212Y!\250\246\250\022n\325\021"
+	.ascii	"\260x\b\031A\225\021q\007\016\001\272\206\337\216x\003\023\344"
+	.ascii	"\270+7\333\203\n3\232VA\001"
+	.text
+	.section	.gnu.lto_millis64.120.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"U\013"
+	.string	"\026\025L> O\225\016\223\225\f\205S\250\216K\001\221\036\225f\306\204\025|\320\016%\316\f\220e\256h-\343\23219\247,5@\007\020\026h\020X\001\f\013\230\345}\211`n\0335\315\356\275\245L)9"
+	.string	"9"
+	.string	"<"
+	.string	"\217\217k\310\307\275p\356\021\256r>\304\353<>H\207\233\212D\347\221\2760@\251B\013\303\003AI\211U\350\250\253\310\373\250:(sNk\347\215ny\333\007lO\354\023\b\376:\272&\373pn\311\266ZZ\rW\275\253VU\377b@\213\233@1\347\204\027\213\271\212#4\330\346\330\021\237\303;p\314\001\3700\214\244\bV\b\304\2129?\314\3377d\016\3269\251+\367\0226|\236\372\007\356A&#\037u\035&\025'\215\240\232\247\365F~\025\244N\200\324e\337\303\277\215\237\301\0204\372\356\321\327\310\307\357Q\027@J\321\242\340\321\227\003\266L\f$(\200"
+	.string	"\333.\013\264\312\2065`P\301`\026-\203M$\316\034\\4l\3132\r\213|\363\020n\306\312\205+\262\r\327\024\317~\"DmL\246\357vw;wYx\205\200\001\026"
+	.string	"{\345\303\030\2130\354j\341\272,\200\222Y!\250\246@\n\"\356\243\3014X<\204\214\240\312\210\270C\207"
+	.ascii	"]\303\247G\224\201\211|\334\225\233\355A\205\031M\253\240"
+	.text
+	.section	.gnu.lto_micros.121.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\362"
+	.string	"M\f"
+	.string	"F\027SA \217\223\016\223\237\007\2605\t\327C\202A\307A\345\264\232\212\313\204qI:A\tK\004\216Zx\264\206\373\343\325\2725\2554\247\217\246I \240\\\004\020\004\271)@\f\002`\025\246\270\337[J\231R@"
+	.string	"@"
+	.string	"A"
+	.ascii	"\326\t\274\273\375"
+	.string	"\200w\247\033>\272[\315\221\377\221/J\345D\3334\356V\001J\nm\363\270n\001\220\f,\002\266\215\265T\244\230\036\237\035[)\023\300\001\b\241S\333.\334\357\266\033\330\306\330w\020\233~\233v\233^M\253\323y\2514\240\210D0\201\320B\312\005Lq(D|\021\217\030\017a-!\261\002!\254\356l\f\273\272\273\235aW\376\207\203\310\360h#\207\355\235\250`*\261\002a\274\002\327\234\252j\274\345#eb5\244\344&\035\314\343y\216\203\305)9P\360\244\027=\325\007$-6\262\305\376\210\223\210\374\016\376\204\362\332\235\037\322\307\033\360X\301\202\201\224);\226RC\354/T\020;\326`\0220@\260\340\002m d\031\3205\201\223\351\\\232\354sa,c\0246\331\005\302\260\354\252l;\222\276N\037\177\3718y\320\325\247\035\266S-\222\226\3744\365#_\224\312\211\351\205\013\220~\344H\310\027"
+	.string	"y\311\005F|k\327[\314]B\257\336\241E\253$C\300C$6\033K\240\312\b\001"
+	.ascii	"\361\200LX\256\341y\232(P\305+\250\310\306\235\246\331H*_0\227"
+	.ascii	"@#(("
+	.text
+	.section	.gnu.lto_millis.122.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\006\001\255\f"
+	.string	"F\227SA \221\222\016\237\215\002\001\217\265_N\023\020<\277\342\3239\220HoO\362\217\"\224\200N\271^-\233\335\037O\003\362 \310\224\214\232mH\304\022\0204"
+	.string	"\241Q"
+	.string	"<\203b\001#\233\311\336R\312\224\002?"
+	.string	"@"
+	.string	"A"
+	.ascii	"\324\t\274\273\375\200w"
+	.string	"\247\034\356\271[M\217\377\225\257\310%\206\266\215\334-&Z\241m&\327-p\222\001F\300F\262\024\213\026\320\343\263d\3132\245\003\020B\247\266]\270\337m3\260\235\261\217\005\233~\233v\233^M\253\323\t`\332\320\"\345\201\013\b-\214h\300\026\247\"\305'\361\030\362\021\326P\350\005B8\335\331!\366tw[\304\236\374\020\027!b\317\306\016\333KQ\001d\342\005\302X\005\235\267\352\364\024@d\017\375D\307\352\350x\022\312\f\225\234 \202*z\220\247\332\200\005\006I\306\330/q\026\020\337\203=>\362\332\235\377\241\2177`\"\003\006\303'Gv\314RQ\354/\324\023{\323R\336d\022,@\240\240\3028\016.\rVE\340\320t\252\315\345Qe([\0228W\205Y\326U\305\317\367m\274X\371\240N%-\261\235J}4\263\244\251\240\032.@\372\221\003B^{\252:\362\030\r#\024+\271<\033"
+	.string	"z\345{Z\r\001\331\332\272!\264\205\257\326m&s\202PW\241\301D\310GCh\bx\210\304jc\tT\031!"
+	.ascii	" \036\222\t\3135\274S\023\005\252x\005\025\331\270\3234\033I"
+	.ascii	"\345\013\346\022h\004\005\005"
+	.text
+	.section	.gnu.lto_microsleep.123.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\266\001\275\020"
+	.string	"V\240qF\340\360&\035\302J'HN\261\256\222/\260QZ6\377\302\232\343\347=\345\374\027\302\254G\310\020\336\251\346\237\351\337\252+\300M\232\375\302\314\203x@\017\355\020_h@xqD\234\314\210\247=\t\363g{o)S\n]"
+	.string	"X"
+	.string	"`"
+	.string	"k+`\356\343\220\344\001\342\341\373H<\364\313\276q\233\316~H\303\fP\216\335\345\264\2035_\207\361i\276\374\314@\324)\t\315`\207\026)a\363(\223\357\351-H\206j\026\363\016\364\244\360\220\232\301\244\276\373"
+	.ascii	"\024D1%\241\231\315\323#\301\356:e3\f\267\307mW\260mb\037*Q\266"
+	.ascii	"\r\226Z\263oR\343\350\203\225f\337\347\017\201\351\030\323\020"
+	.ascii	"\246\337K\253\246S\323W"
+	.string	"9\330\241\301a\241\022\264K\023\005\265H\360\305\210\337~\373\357\234\262m\377y\375\346\362\225\251\001q!bC\323n\r\201C\033\3708\374\212<\355\363\274\347u\037\013\006\331\315\331)\332)\235'\0221\205]\223l\334\204\236\326\\\362\247\271\3231\301\244\016\253\362+\336\255>dv\212J^\366Tu\243\002)Fa\371vwUkjGx\267\222@2\247T\325\317\354\360X\272\217\3425\3652&b\031\345\020\275>`\2421\263\343,\321f\275c\321\245\3355\021pb\t\207\007\307K\006-\256DY\265PxF)Y\320@\001\003\316\265Ji\235\2708\t*'+\034J\253\205+!1k\302\252\305\271X\254\026\227\262\355\225f\b\243\350\251\351Ecvy\2739\b\232n \240\326\374k\013\016\264\031Qi~\267Q\214:\362\343\224\344\017\271l\024\302w\214x\030\025\016]\270\001\2206\204\223x\031\324\037"
+	.ascii	"{\311\027\323\360R=\340\273\266va\f\013k\n\346\241\220\202\213"
+	.ascii	"S\003f!\t\026\343lu\0314\266a\327\210\b\263a\023a\210K\030\267"
+	.ascii	"\212A\317\313E\253E4H\351\251pp/\234\242\022\334\033\337\237"
+	.ascii	"\b\204\244\272J\320\354\325\316'"
+	.text
+	.section	.gnu.lto_delayMicroseconds.124.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"-\013"
+	.string	"&\225L> Q\224\016\017\301\004u\315(&\350\344\303)|Fe`M\304\303\241l9\247P_\336\331\366\tr\251x\033E\337No\027\210\364]FT\200\305\331\025\021jMT\260S\t\"{K\231R<"
+	.string	"9"
+	.string	"9"
+	.string	"\032J)p\354nT\020\317\016\237f\346\007\340\264\303\313\364gY\305\3308\323\365\0258\311\270 \200#=\tH\007\032W=)p\243L\217\313\356:7\316\302m\335v\002\333\006\354S\002~\352\177\232\316L\377\242\240>\243\306n\205\020\035\373\001_\214\210\330~\332'\361\022\331S\023\f`\227\203\212\026\273\035\305\361:\234\\b\035\276\017\260\016\235\3316\336\205\330\257\b$\325\3744\325\262bQ\332q\324v\372P\207\254+\003\024+R\346\260o\342'B\276\b\177@\371\355\320\007Y\207\327\253N"
+	.string	"F\006\f\242\f\261;-\365\203\375\267\273k\365\340\235O:SA\260\340\200\202\350\3214\3000\236\b\301\001f\0233X'V&\346D\320`\321\303\341`1\322\355/\"\035\301H>\265\037l\362\233\237j\351\342\006\310\206we\252-\241\223\337<\t\023"
+	.ascii	"{\311'\323\"\f\317,,\031\201\"f/\241Z\005\002\205\352b XD\ba"
+	.ascii	"C\200\005S.\301\022\253)\343.\337l\017*\314hZ\005\005"
+	.text
+	.section	.gnu.lto_delayMicroseconds_real.125.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"\035\007"
+	.string	"\362\r24Po\322\001 \361q\253\350\306\324\204*\3229\235\270\214\351\230\265Q\264>\"\222\030+\223\210\2202Z\257\257$\bj\206\321\313S\225Jf\226\331 {o\231R\242\210,\310\203\240p\220\020\255\020C\365\261\342C\303\307!\202*Q\364pJA\204\252hQT\0257\332\375\356H]\200\331*\234E_\246k%&\322Y\223\345e\273pX\253a\3518Z\277\377\257#\265.\331\371:\"nY\3713fd\276A\025\220M[g\353\021\223\\.QT\363o\240\244\374Z\2471\300\220\343\201\311\360Y`2\354\325\272X\363\270OB0Lb\376G\327\341\313y\325.\261&\033aN"
+	.string	"\203\377\315l\244\341:\267%h[\320\366#\t"
+	.string	"{\311'c\032\366\f\217\263\256`\336%"
+	.ascii	"b5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_delay.126.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\203\002]\024"
+	.string	"\366\244\203J\300\020)\035\202O\207"
+	.string	"\314R%C\336>\244\265\016!\264\325\235\265D\277\217\204#,j2S\245\300\314g2Z\364v\332\1772'\314\006\240F\025\004\20578\272\324\177\tN\203\320yC\341\365*\320F\371-!\233l)\223\fr"
+	.string	"f"
+	.string	"n"
+	.ascii	"\266\0246j\255dgX\312\263\263VbH\301\331<\333\323"
+	.string	"\316\232aM\306\303\231fpf\310O\312\350\274\032\257\004\2102\245\242\335\224\016\315\315\303\031 ga\352L36\363\003i\311v\237\215)\210\232\203\347}\216\210r\272\341j>\357\202\363\236\004r\222&\270p/\323#\006\206\250\363\3161\270\2229\024\251\265.\337p4\337\361\273\273\333]\003\273|\013\271\335\311\353\232\274\034\223\2675y\307\346eM^\361??\235\274=y\271y\3371\206\240\3529q\252U\246\212\252.\201F<@`\223\214\237\270\217\345\275m\027M$j\255\343\301]\226\335\361 \217\273{\336\375\356>\263\377\264\354\252V\235\016E\265\366\n,)\036\374\270\007=8\337A\017\356lw\306{;\365D\273Cg\255`\365}?O.\247\302\254\265V\032>\275\205\356\226\234\367K@\242\260\364\322B/j8\260\305{ \223\023\376M\354\003]\244\f\331\371I\315\025\323\336\205E\340\337v6\r"
+	.ascii	"\r\206\211n\335\356\256\320w\003\024P/\374\333}\320\205V\366"
+	.ascii	"\0346E\205\177S\241\007\337\347\235oD\320\310\361\261q\341\252"
+	.ascii	"\335^\311\255;\322p\264a;)(\274/\220\004\f\020, e%\016b$2\362"
+	.ascii	"\201\t\t\n\371\212\245\220 \037\013\203P\022#e0X\214\034{.\357"
+	.ascii	"\334r\227\254)r(P\001ec\021\266\332\3251\335\334\007\222hwO\""
+	.ascii	"\333\r\261]\315\003`\232J\247\240\017\345\312\307\321\335\264"
+	.ascii	"\377.T\r\211\341\323G\350\330\255>L\211\222\253v_\364\026#$\257"
+	.ascii	"\027=8v\250\253\321\3035\245\332\023\266.5 \200\002\021\262\353"
+	.ascii	"\001;\346\033[\214\037\262$Lg\356\305\310\3063\363\236\265\202"
+	.ascii	"$\343\367\230~\312bP\234]B\371\323\264\"\2004\003V;\021\330@"
+	.ascii	"\215\213\215\334]\311(\273\201\206V\236\035g\020\207p\226\303"
+	.ascii	"m\311iA\251\007\327eh\343\341[a\214\033\226#\210\"\030.\310\320"
+	.ascii	"\023\031\214F\314\225\274\335\004A\013jm]\325\210<\256\325\033"
+	.ascii	"Y\027\024e\362\246\"C\206\002"
+	.text
+	.section	.gnu.lto_timeval_sub.127.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\263\003\205\030"
+	.string	"v\355\233G\240\330M:\301u\017\3213\30601Cx\310\207\303>\375\223\236\030\034\343\224\202\016\317\221\340\031\343\016\233{?\270\356_\227\370C\337a\274\200\356\035k=\201Wp-\214\362h\313\3725\254&\275!#\226\020\222dJ\001\212"
+	.string	"t"
+	.string	"\212"
+	.string	"\225Q\341\324\214h\321\350i\bT\003O\341\204CJ\241\025\016\"Nb\334\031\360\327\005a\r\241"
+	.string	"\264h$5B\001\215+\t\234\255\243<#\347\235\220cbl\262\332\021\343\356@m\241\277\356\302\266u\f\313\310\265Y\336\316\304\222\237\266\216lP\2111\332j\256\001\375y\236\001\375\275\204s\366\236\271\032\306\300\323\352B\202\2644d\217\311\237-\031y\265\030\243\253\234IKE\2310\0061\306&\322R\b\367s\333\007m'\264\336,Cy\247\326^|S\353eo\274\263\005\370\312\265q\r;\200i\330"
+	.ascii	"<\345\326\230\312\245\001\2633\231\225\311lLfi\231\205\311\354"
+	.ascii	",\263/\231u\311\254,\263-\231\215}\331\320\313\302\236\005\237"
+	.ascii	"\3752\353e\366\231\315\314\232\200[L\221B\321\323\025#\210/,"
+	.ascii	"\261\310\327C\205\257\354)\233\312o\335\332\252\306\252\354\252"
+	.ascii	"Y7\236\2268\2111B\b\235\253o\270*\326A\321\334\345\337\221#\257"
+	.ascii	"\226\307.\273gC\007U\004\204\247\345\0054\330\007\017\205\330"
+	.ascii	"]\345\002R\260\274\360`\017\357f\2016\207\335J\\Dt+\300\333\334"
+	.ascii	"M\216\274\210\034\004~\007o\235\b\357\337a[G^\327b\302\024}\003"
+	.ascii	"\177\357_\024\035\214\242\374\252\237\377\215\345O\211\353\207"
+	.ascii	"\016\252(c\214C\277S\363>\006)-\243\264\302CB\036\200\222\366"
+	.ascii	"X\307-A\235\203B\2070\306\350\024B\240?\377$\240T\211\"\312\257"
+	.ascii	"v\027:;?>\036,\b\207\313\321\271\360\343\023\006\371\203\201"
+	.ascii	"6x\370\331\301\201\325A\020\301\202\203\n6"
+	.string	"\240\235\f\270\034 \233\217\206\234\036\233\016\356\307\206\240\326\033\207\035\234\r\350v\303\331d\273\3507u\213\305\303\330\t!^i#\256y\222\261\034s\332\312qB\bW\3268 \315\223\332\336\274F\364\242\316\374\346\226y\314g\236Q\216\\\024\221\371\200!1\277\017\257\027Q\264k\335\232 =\201\371\354\264\232\303\374\3132\273\231\272t\274<\b\317\203\016/I\216 =q\271\354/\017E\250Q,\346\0302\206\261\022Q\234\2024\215\001\220\242\221+\363\021\240\235T\314D\nKm\354{\356/A\210\032\3101_\337\227Jb\206\221M\263\237\234\321\3254\003\232\274\364\234\222]\371\007\374\206c@\0237+,\246:)\303\322j\226+\217\313/HNO\\\346\245N\274\031\035\177\002(J\300\236\373%\207\241F\210\220R\367n\005I\215I\342l\325}\334\032\255\375\243&\233\331\347Eg\341\370%\261S6\"?o"
+	.string	"\021\230\306v\363^\277\233\254"
+	.ascii	"Zg\223JE\333KZ\267%\370\017"
+	.text
+	.section	.gnu.lto_servoDevInit.133.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`C\001\305\016"
+	.string	"6\033dG\360\262&\035\262dA\266\226\252\305\250\355<GL\230\225\2775.$\336\025y~\243\344\f^\322v\332U\201\026\001\233.\360Z\260aMPM\376\r\350\353\177R\344\2779|\234\272\217\301\271\204N\240N\b\331d\313\224\002N"
+	.string	"L"
+	.string	"O"
+	.ascii	"\326\361\361f\337\022\341\201\347\265\273\235,a\356\331xg\n~"
+	.ascii	"fRA_\347\032\242\025\272X\242\313g\266\311|\270\001@\354\220"
+	.ascii	"\211~v\214\210\021C\315R\320\\^u\245\361b\307\305\022i\256\233"
+	.ascii	"\203\335\265\302"
+	.string	"\210 n\355\266Ul\217\330o\tR\375mB\316L\315KCkw&\006d{\346\f\024O\335\376\350\253\f\262\202\005\340S,\334\342l\254\026\t\237\335\021\301\247\033p\237\007\331\276\332\317\371\n\360,6<\300\256M\215\030\273c\002w\334\247\307\017\320>\271\013\320>\r:0\033/5\241\306\374{\232\235\362\225G\200\201\355\226\273\270\020\302\261\273\242\026\347)\371'>\215aE\017\363\351\257h\237\006nz\2344f\225\227W\375\200\n\030\241k\025\344\2441)W20\031R\242\354\321EE?/8\2266\366S\251[\003\031F\024H$!'(\025H\336\003O\345\033\225@6\021\201 \201$Bg\032\235|%\246\216\204R\222\322\231|\245N\244\200=\013\243\2573y\336\327\201\306\275\316Gx\364\300|N2\234\022\345\020Kjr\232P\307\250\217\235\034\034\364\307\263\335\335L\242\316\242\251\324\344_\001\034"
+	.ascii	"\200X{\311\027\323\020\232\253\266v\211\205\274\214\276\253q"
+	.ascii	"\322\022\013\364x\035\306\021\033s`\232\002\233\006aZ\202v[\342"
+	.ascii	"sX\341tq\306\305hV\247\203vqXD\331\253\253f\364\f/(\312\257k"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_motorPwmDevice.134.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"U\006"
+	.string	"\224\n\321"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\303\346\230\032\002\177}\270\346\230v\177{\370\345\230Zyw\270\345\230Tus\370\344\230pqo\270\344\230vmk\370\337\230X\177i\270\337\230Vqg\370\336\230\226\001ec\230\336\030a_\370\335\230Z]["
+	.string	"\005\001?\202\210\200\330\001YW\305\001U\304\001S\303\001Q\302\001O\301\001M\300\001K\277\001I\276\001G\275\001E\274\001C\273\bA\277\177\306\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/target/SITL.c"
+	.string	"\r"
+	.ascii	"z\311\002K\265\r\363\236\211\337\006\257\200W\300+\340\025\360"
+	.ascii	"\nx%\346+h\276\205\201\""
+	.text
+	.section	.gnu.lto_pwmGetMotors.135.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375 \370\275\006"
+	.string	"\262\314.4Pm\222\016\004\210\022z\001\250i\323\210YW\225\337\25557|\376\305\262\265\273\25556}7\322\330w\206QS *\254;x.\n\257\314\354hb\t\221)s&\004\205\203\004hu\026\252\215\005\035\0306\r\220SA\300I3\365\320\251\240EQ\025\314\304\254\033\275\310\205\311\0045\273!\215\021w\243o\211\2535\353\273\227\324\247\001\271\211\217\237\346.\276\227t\243op\243()\231\025-,y\362J8~\317g\256G?<c\0041C\024@\242A1\242\222\031\341\261\003R\037\246\002R\237\303(\326\206\335\202\364\322\261b\222\205>m"
+	.string	"\006\231y\313B\242\356\372\027\374\323o\021\t"
+	.ascii	"{\311'\323\342\255\243c\205P\\\023\253\021B\013\221\211\273b"
+	.ascii	"j'\031"
+	.text
+	.section	.gnu.lto_pwmConvertFromExternal.136.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\265\007"
+	.string	"\242\017760q\222\016\200\240\013F\0169\234\211,\245\271\027\227\325\371>\003\354\352\325\331\332\275j\322\246\345{\037\333\216\301\001\321\2172RI=\204EE\035\307\243\265\255\021\"S\031E\bs\ba\"-\333*\262\200A\237\205\006\005\206\270e\017\032\266E\021\004\026\021A\332D\374\\\217$2-n\243\221\026=\377]\266J\210\032^%\210q\341\203\315\230)\275\324w\244\007=\276Uf\346\020\365\360\375\332\265\255\nhd,R\231\033\251\233\214\261^F~\356=\377{_\224\246p\355.\2662;`\\2\273\203#@-\201\367_\223\236p\337Ru !\235\026\021\215\225\232\314\214W\t8\265\252\016pj\301\217r}\334\255J\253\022\033\026\323\211\324\327I\310\314\237\351\304\321a\177\203\037\341'\t\b"
+	.ascii	"|e\301\2319U\260\227\256\321\034\230 \340\304\223j\305$L2"
+	.text
+	.section	.gnu.lto_pwmConvertToExternal.137.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\255\007"
+	.string	"\362\21656Po\322\001@\372Fk\215\026_\300\020X\206_B\261\220TS\372kA\2705\004\327C\354\261bA\250U\202oL\rS\003\243\322a\365\320\256\3607B\366\226)\005\230\205\304\365 c\026=\033w8\f\016\013\r0\303 \344\225\301\211\210\313\003;\262\002r,G\nL\302,F\t=\367o\335\310\316\0029\f\337\251{F\013HO\366\374\250\363\260\377vw\355F\326\317\377\317\300\364r\001\263\273q2\255\013\245B\262\255\331\002\266U\355\223\274D\3734\212\003vWXRv\027\301\020\340\224\365l\373\245\217h\336t\202plH%\215\023\231\335\t\007^P\235\322\023T\247\334\307\267\353\346\337\344Od&&$\372\\5\n\273k\r\211:nw\333\007\266\023l\207\004\n"
+	.ascii	"z\345+\303\n\316\330\360\224e\\F\2314F\007&\b8a\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_pwmDisableMotors.138.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375 \376\345\006"
+	.string	"\002\21506@o\222\016\270\212\t\303uL\3257\t\334\361\304\224\b\023\022v\257uw\233\352\377\r\217[\335T\024pf?\256\376K&\321p\3371Bz\"m\314\232\fBd\no\252\204\005\004\205\210q\030.\r\026\037\0324\016qsE\304j`\013\202sE\314\262\256\230\331\262O\004Q%\224\n\350Y|;\227\227\250HG"
+	.string	"%3\013nHM\023\327\243p\n\217\253Vx=\227B\003\323H\003\204\005\344R\277}\334\343\370\002df\376D\377\212*\235V*J21R-y\002MH\1773g\237\322m\224\030\022\311\305\310)3\343\353hV\227\335~4@\013}\3520\007\231\271\323B\031\375\365'\370\253\177#\b"
+	.ascii	"{\3117c1\2043^\307\027\332e\374\313\270\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_pwmEnableMotors.139.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"U\007"
+	.string	"\202M37Po\322\001\200\344\211\"\022\332\245\t=a\033\233\352\331\314\360\321\327fU\333\215f\355\326\007\236\030\200,\236\331\212\252\342\342\272"
+	.string	"N\034\001_\335\205\031\022\262\311\336)\005\336d\t\013\b\n\222\3430L\215\223\016\rZGn&\204\314"
+	.string	"\274=p\246\344\266mJ\254\356\253\205$\327wP\0302.!X\341\237Zv\304I\250\206ew\013\374\221\233$\374\217GOx\336E\217\276\307z40\2252J0\241\227\262+\350A\016\373\325B\222\r\217\3228\275P\304\354v\251\231M\211( \266?6\346\001\202\217\351\253Gwu'\026%\247\335*a\307\351\037\365/\362\200\220\026\225\025\223\021\350\357:\330]?\321\350\342\206\267-`;\263\275\021\t"
+	.ascii	"{\345c\230i\223\331\004p\260\30651/\0023!r\270s\257v>\001"
+	.text
+	.section	.gnu.lto_pwmWriteMotor.140.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"M\013"
+	.string	"\306\326O? O\225\016#\364y\221\351\210\345\220\315 \346\373\260:d\270\327)\311\310(E\362\2031\245G\037\333\326\267\347\227\246\356\200!\002\316|\2439"
+	.string	"\314)\346\"\210\r\034\004`4\022\264\211\224)\005;"
+	.string	";"
+	.string	"="
+	.string	"\320\231\266\001KwV\310\272\233\241\004\307\356Gq\314\016\335\331.\376\245\026[\2450\205\210\261\273Q7\274{v\376=<\342\235DO,\301\356:\275\323\205[o\273\200m\004\366\031\004\317\376\375\330\225\206\231\2764\255\232\316+}"
+	.string	"\0044V\204<v-\264dl\007<\261\262}\211mM\373\032\337\350\376\331\204#\273(Zp\354.\305\226\354p\362\001\220\303\353\002 \017\333\346\301P\205\232\037%\025\231^\372\017\323\214TLU_\342@\312\226\257\251/\275\370\207\203\340\370*w>y\357\320\377@\016\257\030\013\217\016\030F\331\262?Q\252\006\373\327*\312>\353\001\332g\302\005\004+h\0206\031hLe\201\003\005\r\242G\213\300]<q\223\271h\"\206\353\304\312\304\033\005\215\213\236m\343\242\344\333+\312\0176:FJ2T\333\240\223\340\004H\355\356\001_\304GH\360U\207\326\004\017"
+	.ascii	"{\311'c1\347\315(.<\344\215\202a`\374\305\270\256\214\261\250"
+	.ascii	"\366\\\310\215g\026\020*\314\001wy\321N2"
+	.text
+	.section	.gnu.lto_pwmWriteMotorInt.141.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"u\f"
+	.string	"\226\330UA s\222\016\206\344\001\323\004\341\264\005\264\243\305a\316\306\305\245\026tN\274!\324*\356*\247\2521Y\031d\265\342\037\261[\315N\354\002\212P\202\310\200n\nN+\310\017\341!\304\023B\266lR\246\024@"
+	.string	"@"
+	.string	"C"
+	.string	"\356\212\037\340\256F\264\025\204ho\341\340\334\0251\203\306\356\226\300\217\272Z\263c\276\251\354\304\302\003\245\005\220\335}i\342\332Q\363\357\362j\224\342\34185\330]\343(\005\304\235\267}\3006\003\373\241\256\024M)zrh\367\226_\363\355OD\243\242o\025\270\241\243\203\215\335\017\245 \013\2435Xl\337gq\322\311WX\202\214u\265Ol\353z\313~\212\253\320\276i\260\356\216\210\t\241\256\002N \372\321\017*\253D\031Q\216)\237T^t\"\204%\273\234\362w\361\027\036\177\305\230\t~t\365M\334\325\345IG\260\243\007\212\020\232\304<\312L\346\023\300\314\213\310\007\bK\366\026\302,a_\263I\302v\030\327\005\n\034\f\232\341\232P\322Q\213l\036Dp"
+	.string	"\341}\256\221\214\363y%\035\216\347\211d\026\336\306\200\261\nW\366>\030\226=k\003\335\345\324\013\016\030P\206\\\345I\366\206\313\360\004P\331\335\005>\214\307\030\361W\256\356\220\220\270\007\024"
+	.string	"{\311'\323\"\f\357,,\332\026J\021\271\231`\034\330"
+	.ascii	" $q\261\r\246]\256\341\3375\001\201F\221#\322\024n`\252\251)"
+	.ascii	"\205\005\\\313\013a\222\001"
+	.text
+	.section	.gnu.lto_pwmShutdownPulsesForAllMotors.142.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375 \376\335\006"
+	.string	"\302\314/5Pm\222\016\2441\002c\032\234YW\326\252G\021\264\233\030\355b\250{T,[\273f\234\016h\3057\322\330w\206QS .\303\265!A\"\374\330\254\t\"D\246k\250\204\005\004\205xm\030\254\314\025\037\0322\016QcEDj\340\nbc\305\253\252\254\210\321\262O\0047\220\312\311\347Y|9\226\227(\211#`\222\231\005W\244#\023\367\243p\212\216kVx;\226B\003RI#$\345\343\266\327<\356q|\001\362\211\376u\003\235P*\266L\214m%K\260d\364\0273\366\246j\036y\031\231.HN\231\031_G\261:\354\026\244\001Y\310Sw9\310\314]\026\312\350\257?\301O\375\033\001\t"
+	.string	"{\3117c\361\2063^\307\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pwmIsMotorEnabled.143.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"}\b"
+	.string	"\246\220;6@\217\322\001O\035\304\277\367]\b\027\0217#\373\205\025\226\237\353\377EO\361\033\352\363\226\222\320\301gc\266\313\207\334_}K\0052@|\271\341\223\n\032{\313\235R,"
+	.string	")"
+	.string	"+"
+	.string	"FP\030y\373T\235\276\2021\225\274\354N\251\037\337\3766\377!\207-\335\n\207\"\375\0054\354\256\037\207\342\270\365\266\rl'\330F\t\232\262\375\f\317\372\237>?J\231\253\270\354\236\272\230M\211'+\333#[c[\337Y\031\326\335\216\226\311\356<\260\024x\264\035,\273\273`[\343#\026\004\252\335eh}\206|\220G_\210\336\271G_\004\360\bu@\344\351\365\246\231\322\353\354Iz\352a\037n\030\227\004\350\023\355\341<D8@H\355\232\310:\232\004}:\024\322\223\205$gc\254\342\312\244\206a\231\324\314=\\MA\335\224t\3036v\222\255 \013"
+	.ascii	"{\311'cz\373\20613\366\266i#\260\3125\234\003\213g\2068\323\363"
+	.ascii	"\240\251\235O"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.144.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\177\003\035\024"
+	.string	"v#{G\320\362&\035R\274\207\365\302\267DVb\022\200GD\345\225#(\007t \302\211\234X\200o\2502\342\304\233Y\177\211\307\020`.x\026\330\3345\335|\250\260\032D\337\013\317\265R2\367c\370\3336-\210%{K\231Rb"
+	.string	"]"
+	.string	"n"
+	.ascii	")UsQ-W\035W\275\252\326\253?`\325\343\203\366\rEsz\b\205\314"
+	.string	"\233\264\375\330\276\347\032\333\351\265\0223\365\023\342\260x\232s~K\3425\227q\265\306W\321`\227\035\210\307\231G\263\321\215\004vD@\265h\262x\202\343\206s\241k\007\232\215j*e\316i\005i\037n\356\266Ul\243\330\013$*\276\342\202\357s\351\030\227\213\273\324}\210\034\030A\266G\215\b\215\3264\334\327\302P\323L\243\354\2378\n\032\337\307\032d\364\340\245/\303]~/\364\b\224C\024\224\023\323\320\256\301ty\354\307\271;\266T\233Du\311\252IV=\242\352VT\263V\275Z\265\247jUT\213\254\272[u6j\254\226\345\355J\265\336g<\211\206\336I\334\245*F\220\310\"\3118\352V$\265\035\267)\004\177\341\202\203\262\311}\013\037\005`r\205\033\261\260\230\346\234\t\210^\324\342\362\362\302]\256\022\030$\256\334\343\fA\272\214\203\216\355\251)Em\332\013\302\320i6g\254\300n\334\337"
+	.string	"\3114\264\356\256L\272\371\021\323\360\300\207`\2729\247\002?nAi\240\302"
+	.string	"\3027\343\362\362b\231\3710\300\260\304|-/\231\017\345\304\256\f.\257o\306\345z}^m~w\234\022[\231\024\240\266\203\007z\320\2730G\365\3504\305\345\261\201\233"
+	.string	"\320\233x\217\225n\316\330A\177\307yD\220\260\242\007W\270K{\002\005=h\2627ZB\272\315\026\346\222]\322q#\331\222\221%i\355\210R\216\026\024ko\004D\250QPG\231\031\251$RT\220$m\320\002\221!\262\016\021\300@\247\030\271"
+	.ascii	"\311\376\347\373\236\"\013Uh\341\006\025\016p\013\270\211[S\234"
+	.ascii	"\\g!\346d\220=B\026\333\t\022\315VA\346\321y\271\215\272\220"
+	.ascii	"\314G\3510\254\307\256P\032\3354\330_\242\236\345\004\334\001"
+	.ascii	"E-H\301v\201\004\263U\340\213g&\340,\bB\341\301\371s\263\330"
+	.ascii	"@\354\230\026 \376JF\210\032\fQ\002\034\316crZi\251gS\024!\364"
+	.ascii	"\345\304\020\376\277Y)\301S5\0135"
+	.text
+	.section	.gnu.lto_pwmWriteServo.145.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\355\t"
+	.string	"F\224G=0\305*\035\236\013\371^owx\242\215\264\305\036\334M \257\206j\231\267\371\240a\200Y\253}\314N\211V\206\270\343\f\206\r\305\0277F\025\326\333\374S6\312\033\352>~\333d\313\224\0024"
+	.string	"4"
+	.string	"4"
+	.string	"\260\r\307]\020\330l7\364xj.\375\331\001\036\266\026\341E\242\222\025\330\335\031E\376]?\377'\337\200+\3245\323\260\273Vp\365q\307\333N\260\315`\237 VU?\263\275\\\007 \333\365\250\031X\232Tq\331>\307vT\373%7\371\036:\305\233\335\025\226\331\356z\f\322\\v~\200\271\334n\200\271\264\252\255"
+	.string	"\372\036~\354(\027\376\310\245K'=x\351\2370\227\007\005lQ\243\016\350hIi\3151>fb \001\325\201\224\326\354\020\2451\304\376\266\221e?\374\267\303\376\270i\334\211\"\204!38\t\322HZ\364y\210p\200\230&n\302\013\231&i\024\252\230\"\2574?\035w\026\2347M]\347MN\270\3376\262\254yq\241\245\"\2075\332\326\270\254+h\355\356B\n"
+	.ascii	"{\311'c\032\202\032&\234\301^\254s\r_\314BA\2500\021\334\271"
+	.ascii	"E;\237"
+	.text
+	.section	.gnu.lto_motorPwmDevInit.146.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`c\001M\017"
+	.string	"\226\034hG\360\260(\035;\375\222\343p\321\312e\275%Z\363\001F\322\366\227\265\330\274\275\367v\221\242\325\345_Nk\373\353\345'\353O\321\366\355\027[^\\h~\255\272\32433{ \223\310\345\tS\366]\211'\204\220-eJ\001R"
+	.string	"T"
+	.string	"P"
+	.ascii	"c\001\203\3367\333\276\211\307\244\254Z\r\031X, /.PR\324\346"
+	.ascii	"\034A\217\037\300}\363.\200\373\266"
+	.string	"\"T\252\272\\U\371_lu\351}\370\312\0035@\240\370\210\265d\007&cv\3325%\346R\355>sN\353+\346\341\336n{\201\355\021\3730\001\007p\331\357Iuw\231_~\346_\253\265S\337\003T\203u\210\235\003\2139a;t\314\030\333\n\022\266Sv\307\2461}$\260b\023\323\002\202\001\004\251\317\240\356\231-\234\232\006r\374,u\231\023\365LWk%\201\367\315\243V\275\f\303\003\314\331R\263\2313\"\375\353\333\323\376q\355\312\273\335ZQr\276~\315UT\360Gx$\352_\337|\221\373\366\227\r\271_\005*8Z4h9,\335q\002&\304\315\256\213\345Q\334\256\312\206\022\263\03387.\315a\217+]\027\373\237\301\362B\346m\261\255\376N\363\243\013\"%!\210tb\"M\bM\250\217\023\t\365\205&\023\224HhR\"\032\371B\"\n$\221AI<\211\243\216A!\017$8\210"
+	.string	"\236\302P\211\344\004\222D$#\020T2\201! \026-\204%\360$\212%\2603\316\313\225/0h4\365U\234n\312\372\303\332\226\364\320n\355P\034"
+	.string	"\353\314c\257$\037c\033\214"
+	.ascii	"\232\300\264\336W\231-\204\355M\f\355\030j\035\231K%E^7+~\226"
+	.ascii	"U\3055fn\002\004%\301\025>I\302\\\022\202\005\34135\n\307\216"
+	.ascii	"\320\234\361\323\305\246\204\2461(("
+	.text
+	.section	.gnu.lto_simulatorReadRc.148.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\303\006\035*"
+	.string	"JK\220\020E`\336Q:10\361\340\313\300\nN5*\366\202-\177\374\204\356\034x\327\371\213TJ\377\267D\317\323\354aU\n\240, \245\373K\314@\231DG,F\242\215\307B*\250e\244A\365\333\377%\237\020\"w\222\001\370"
+	.string	"\351"
+	.string	"\365"
+	.string	"\367\302\372\224\237\353\231\241\370a\374\343\177\371\027\324\301\202\374\036\357Z\307\271\244\356^$\204\247L\\\237\016\357\005\250O\355="
+	.string	"\365)W\300"
+	.string	"\305Q\004\250\244\354&8\267\252\310\374\334\373$6\024\356q\220\207h\324\207\206BB\242 \360\347\353\255<5E\333F\361\245>$%\314h\207O\224Q.\304Cj*\245\\\370\251\345\211\340\220\314\263)6\270u \332\341\253K\n\034R\t\332bfj~\306\264?\224Ge\304\312\341\220IP\r\200\352\316\334\007\207\324B\215\322~\244\005\231e{GO\224\313\2576\234b\354\232\312\255\363,x\311\242\242\027\346\222Z\302d\025\372;B\027\367K\036m\352\344\264b\327T.9\212>`\272a\t\223T\250"
+	.ascii	"8M\346~v{\225\024b\373a\037\021G\353\354\313\237\2462\312-\017"
+	.ascii	"\351\336\313\326*\251<\0038\363\213\314<\202Y\005\006\2672\320"
+	.ascii	"]'n\317\033UKq\323a\001JQ\346"
+	.string	"\355\346?\350\f\017\332\\\254\340M\352\233iLN\210\005\304|\265\25751\207e\032?U\370aJ1\226m]VO\371O\375\263\223h\242\225\347Jk\312\336\245sm\350ts1?\245l\217\251\311q;af\260\340h\347#\325r\002\324r\321\307\316\006\3302\321\320\020\265,\364\263,\354Y\016\372,\003{\226\177=\313>\324r\357f\347\225-\363\330\262\312\226\323\3252\312\263\334\250e\253Z\276\003\2452F\212$\277\354s\257\221;A\367-=s\345h\377\330O\366\233\375`\314\027\303O\343\037Z\217\344\233S\255\356\336\013\342O~\230\227\375\214\177fOH\306!%\234S\260\334\373\364@\366t\244 '\225\272{\313l8\230\213A}\354\307\360\302]+\327\345\364\252\2737\276a\257}\325k\277\331\353\030K:^Y\003\254\357\334\246~\314\313\222\326\265\231Y\270\260\267:j\364I'\311\333\261\245\370"
+	.ascii	"\326W\327\257\2718BPj\215\312\355\275W\312\327\\\374\264\037"
+	.ascii	"\311\321\013le\320\214\022\r\365\260\257\242T^ws\314\216\332"
+	.ascii	"i\363\372UX=\265o\364&5A\247\215\222U\2351\332;\032Mk\202n%h"
+	.ascii	"\320\036\205\017\233A?\355'\214J\336\034\267\304\271#\206\266"
+	.ascii	"6\027\027\225ua\246\006zA_\005(\353b%\265]\324W\314\020\316_"
+	.ascii	"s6\334\366\202\331,\263\251O},\337\370\341\2036?\315\325\300"
+	.ascii	"\340Wa\0313\354\f+=\335h[<G7Sf\316G\311\r\204\334;\245`Aw\013"
+	.ascii	"\031\223\3649j1\332;\356,c \336\001\"tn\234\006y\247\332>\331"
+	.ascii	"m\257X\266\361\312\032\332\213yY\022\220\245\233\025s\215\242"
+	.ascii	"\r\305\0368\222|\244LN<\332\206\216b\027s,9\241E\035K8P\256!"
+	.ascii	"\001E\013\023,\210NE%\246$'\242\216\245\244\034\304\032LMD\t"
+	.ascii	"F\274\203G\221\211\350\264c\007\023\361\367\274o'\374\260\257"
+	.ascii	"s\3167fd\206w\363"
+	.string	"\237}\025\344t3##\374\243T\"\242f\244\2516r\020\260\177\250\271\306\\\250C\3301\262\302\266\367\3710\245\025D\b{+\2416\272\335\365,\211 AB}*\354\207\035\355Z\262\375\311\232R\263\240\264\r\315\250uY\2665sBO\350\275\315\017'{\333\255\351a~\325\211\t\211\332\tg(\363b\002{\315+\352\241\276\032\nv\2106s\301\224\313R\316\021\3041\241\013\002\233\231o\334\216\211\001Q\356\275\032\370u.w\202_\345)\247P\241B=j`\247s\252\006\375:.\302}\375\353\037\231F{\307r|\375\264\247X\226s\177\262\246\354\235-\260\266\265\007\210\006\200\210\250Q8\306\220C\244jD$\214$I\032\003`\002\0212\243\333\020`H\243I\322\001\273~\365\033\016\363\307h5)\236\030\020\024\022\322\204\310\310\225\326\006\255+y\226\304#\371\203\371\351\217\225Sz\275\362?\332J\212\324"
+	.ascii	"\370I\223\317\270\304\324?\215\365p\302ii\334\276\334o\245\367"
+	.ascii	"M\255U[\332\177\201\217\"\001\250 1\301\202b\275ekB\024\002\373"
+	.ascii	"\346\004y\231a\206\277\365I%m\302\270]\224q\216\016\004\202\\"
+	.ascii	"~\220\360\021\002\275\322\244\3170\241\323\225\236\331?\304\264"
+	.ascii	"\002p\024\232\"\274\361\375\213\371\214A\2173[\025\024\177\350"
+	.ascii	"\353\253]\020\227\360\262|iF\214U\357\205\032\234\271\220\020"
+	.ascii	"\024\026\302\260\021\362\227\202\241\252!\210\365\030\202\370"
+	.ascii	"\210V$\244:\242\313\246\227I\370l\024\355\317,\025\264\003\327"
+	.ascii	"|\266\237\221*\013\307\356\265F\314\362\203\037\303{(\255![U"
+	.ascii	"\275a\273$\3075\234U\250e]vn\240\370D\001\356\300\263\307Q\237"
+	.ascii	"\305|l\364#(X\177j"
+	.text
+	.section	.gnu.lto_simulatorUpdateRc.149.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\335\003\305\031"
+	.string	"\006\253\234I\240\230U\007"
+	.string	"<\350'\366\254\231\214\037`\r\244~\245\311p+\235\216\005\220\367]\305\030g\036\307\332|N\254l\250\013\216\276Z\254\261i\360\310\032\336\023\316\002\343\201\017\266\034\234[\262\254/\274m\341\207\343\311\227[\246\224R\210"
+	.string	"\177"
+	.string	"\211"
+	.string	"\334'\0271_A`tq55\224H\307\254{\357\354]\260e\363\213\372\214\301^.kV\331{\021\267\003\240\017\\\237\rX$1u\254B\300rdi\2407\203\327D\037\320aW>\246\032C\364\245\376:Q\235\273\372\312\367\233jG\201\"\271E\227\332\214E)u\035\020\265\324\262:\001\271\324k\242\257\251\272\214d\226"
+	.ascii	"\350\316\277\247\272J\245K\035\226\020T\251\335E\341\336\313"
+	.ascii	"\316C\223\232\00143Wa\346\031\346\267\021m\346\244\\\262\266"
+	.ascii	"\364\037}\232\247\205G\0339\t\367\023\3770\322\031i\333\354\337"
+	.ascii	"I\271\024\177U#\200n\013\250:G\215\373\251q\004\335\n\274\270"
+	.ascii	"7\327\2746\271M\3306i\322\245"
+	.string	"\021k\b0\347[\337\004\350c\371?d\256\302y?\210R\344\361;1WgY;\237\3259V\235a\325\371\345\316\256\352l\253\263\371\316\365\235\337\235\275\235;\201\210_/\005\332A(\367\366\266\274\\+\023\t\r\346ZL0\330\207\375\224\364\222\033\r88\266M\363e\222\277\234o\365[Y\001\225\345\372a#\351\372}\003Y\377w\030\201\nR\375\272\353\275\367\332\b*\230\3040\1778d\217\354\244_\016\370?s\007\017\336<\216\331=\216\271\211t\221\241\017:\256c\333\374\227\220~)\376`\210Ba\375!w\177\220)-\226\310\230\310\372\333\214\312\235k1\2143\203\340\361\346\371\0138\322\341\353\202E\3678\356&\262\334?\032\bQ\017\215f\003\3343\223\201\203\315\206\231\020\315\307\306#4#\361\303\0034\353\261\335f31\\+A\263\315\204j5\333\354\274\375N/ej\225{\335){*I\331\347"
+	.string	"\217E\006~~\343h\254\233\202)\334QZJ\005\223\203n7\333&\263\205\013F\217\343\253\363i\200=\272\330\023HU\261\037rL\312\370d\347ZV\261\227\201\321$\354\033\373z\330\367QP\367\344\306\006\347\3655\311&@tr\204\365\220v}\b\243\262\211\353\037E\n\203T\257\037\276\te\347\001]\250a8\310\034Bc\"\243%IRh\f\220\002\021\"\263\016\020X\311(Ic\3739{\347\3269\213\211\215\343\206\017'\375\bD>gy\354\220+|\225\320@jT8\\J\247\f\007\245\331t\214\254\257q\310\033\004\362\263\031\356\373\331\301c\b\264\317\316\375\302c.\314\2765\032\255\306\226\3132\tH\326\0161\030a\340I\327\2268\001(\227+AA\020\235_\302F\227\021I\347\027\224\346\362\215\210X\202\034\005\301\230"
+	.ascii	"\216\034\314\022\222\315\334\366\023Z\245\025\016`\374\2023\263"
+	.ascii	"\371A\017\340\250\217\375\332\212\274\020# S\2121A\264\376\374"
+	.ascii	"Q\r/\253w\302\030\005\0360\033}u%\031\250\240`\213\252\001"
+	.text
+	.section	.gnu.lto_simulatorModelStep.151.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`p\022MO"
+	.string	"\032\207\204\035M \324RI\007A\306\177\023\347\373\2208\363@\240\226T\261\316\342\003=u\337\300u\312\356O\371\252J+\376l\373z`"
+	.string	"\030\210$\375K\342\333\035H\276\233obHn\360\216\025\226?\350\360KN\317q\271\237\021k\266\221\266\t\221R\246\267\001\225\001\320\001"
+	.ascii	"P\276\211\037?\311\344#\231\374#\223od\362\213(\237\210\362\207"
+	.ascii	"L\276\220\311\0172\371A\312\007R>\220\311\377\231|\323\344\373"
+	.ascii	"(\237R~\351\343\223\224\337\224\317%\177-\300\200\216\212\t\304"
+	.ascii	"\335r\254\225\312\236\022\265\256\204\353\262q\273d\226\377u"
+	.ascii	"\323f\216\315\265\212r\313\366\225[5\273\346\334\270\257\331"
+	.ascii	"\021\372\204\201!\257\326Jen\311D\356\021\375a\341@\3304\317"
+	.ascii	"Q\374\241\317q\321\374\037,\333\211\024\337\210\371\340\007\341"
+	.ascii	"\177\033s\213\303f\207:cg\354\330\230Q\272\033\3332\213\303\017"
+	.ascii	"|\b\313v\035\305\273>[\376!\374\300-\315];\360{\303\252\235K"
+	.ascii	"F\204\255b\365\347%\314\226\274Z\303bly\241\271\345\272\260I"
+	.ascii	"tK\244=\242[\376\374\363\234\210R\267l\204A\373\312\241O\255"
+	.ascii	"U\330Y\336K\262\355M>\027\351\310\250\210hH((\b\004\372\231>"
+	.ascii	"Z\222\315\347\327\347cmW\024\221h\273s#n-R\332\036\221Pyi\370"
+	.ascii	"$Q\211\001l\277\204qa#\362\250\312\233\335\316\tK#\243\354\300"
+	.ascii	"\024\267p\221\226%\322\202\306CX\304ZX!r\211\016]\230\235\023"
+	.ascii	"\326\002\271\202\205\262\036v\215\214\203\212\260\210]\331 \311"
+	.ascii	"\304\002\311\004\264\002\007\264s\302\212h\266\351K\330\025\376"
+	.ascii	"\221Ds\302\252\2203\272\330lzAll}%W\036\037\220p#\256\260T\210"
+	.ascii	"8$\231j\255@\342\027\227Q\334\220$\024\331\033\024\204\210^d"
+	.ascii	"\222\0343<;\267,\205\370\305\275r[\232m\301\273A\017\213\330"
+	.ascii	"\330\262\317G\255\365\fF\024\333'\355\277d\377O\370\213j\004"
+	.ascii	"yE\271\256;\267=\2766\036\2104Y\246\320>"
+	.string	"\363ZRA\2106:/\366\223\005\313\017\305\262\215z{{Fg\353f\213\312\3200L\202\316\033/\366\223\007A_I\320\020\364\332\031\346i\235\355\327\320\"-A\227>\f\311\214t\22162\323\242\347k\211\375#\006\255\017\331\306S@\215t\222\266 \274\330\317w\356\207\202g\355\320\331:\021\0249\302\013v\204ni\244wnI5\3057\275\256\265nu\033\373\237`\327~\fB\253\265\336`;`{\216\333E\202\225\272Z\337co/\217W\255\\,\270\273w\370\245\213\367\276\315M\302\031\346\375Q\033\207\002\263\326\232\343\013g\351\220|\323\266<V\026/\330\226\337,\272\345\266\217\2105^\310\324\340\270x\357g\353\332\255\265Vn\343\277[k\255\357\263\337\3443\241\374%\224\237E\371JL>\326\306\355\223\230\374\nJ\276\021\223_\304\344K@\371\020P\376\025\345\023)\371CL~\003\033\267\267\002\362\021"
+	.string	"\362\205\230\374\003L~U\220o"
+	.string	"\345\007\t\362\201P\376\217 \337\007\345\367\b\362\013\240|\036A>\001\224\277#\310\327A\371\003\004\3719(\037G\220\177\203\362\251\202|\033\224_#\310\237\242|\032A\376\f\312\027\006\371R\224/\003\310\217\002\362c"
+	.string	"\361\241(\037\006\345\277\240\374'\312wa\362\235L~\013\223\317\302\344\257\240\374&\312g2\371*L~\n\223\277D\371\002P>\n\223\257d\362\0030\371'(?e.\240`\321Jv])\232\305\211N\321\213\003"
+	.string	"}\302\310D\003\320\344\237+?:\341qa\026\254\230\350U\241x\247G\324\3067\241I+\360X\023\030\316.]\350\226I\255dgnl\350\211\177-\324GM\366\177\2029\30309\365\021R;\0255R\357\033Q\027\r5Q\024\237 F\034\032s@\0131\330V\365\001L\302\006\273\252\327\r\330A\240\006\312`\023\246\224"
+	.ascii	"\324;V\214\243\007\307\244\177\375\245H\327v\347\266\007J\335"
+	.ascii	"j\240\231\364y\310\247ko\317\327\r\364\356\260Fu\246\024q\306"
+	.ascii	"\b\332\276\336!\206tU\336\352\200\274\312\246]\3460\374\322\305"
+	.ascii	"_?\2728k\340\341\225\n<>\034\205\267,{\327\026F\2318\027\310"
+	.ascii	"\324\340nFL\233\nB\301\254>B\003p\365\354\302\001m\236]4\277"
+	.ascii	"\035b\227\264\024\016(\331I\332\356\234+oq\360M\3739\346\264"
+	.ascii	"\341\264\241\247\212tc\306\232\030\217m\327\316\265(4\260e[%"
+	.ascii	"\252R\240\371\331$~\004\251\252b\333>\t\230\265r-\330\227\317"
+	.ascii	"\"!\304*\201\004\350\002\f\360\202\375\305\235#\352\276z\353"
+	.ascii	"K\372\037\262kK\242)\276\331\nj#\212\274\032\332\004\373\354"
+	.ascii	"\316*\301Q\247\007\f\260\215A\254\222^8\274U\322YX\255d\357\266"
+	.ascii	"\202\306\032\322\025\\\215\232\0304\2406\332\355\020\251\335"
+	.ascii	"C\304\220^4\2776\336\327\306\227\244\373\016\307X\253\226\"c"
+	.ascii	"\255\272\313\024.eE\320\271\343\305~\2264\333\370#q\364\252\217"
+	.ascii	"\320Pz\271Y\2479+w\344\217\313g;\267\213\302\020\210\030\372"
+	.ascii	"\307\377\314\202HK\371\243\326\252\223\364\220\331\026=C2\"}"
+	.ascii	"<?\232@\373\003\273v5\264\345\312-\031\007\252Ac\311\224\224"
+	.ascii	"S\224\007\0318\375\270\005R\035X\240\205\244\211P\003'M\2328"
+	.ascii	"\301R\272`\265<\330@\203\013\312cI)@\304\352\001\241V\026\223"
+	.ascii	"'H\264\204\032\\\200\244\211\020\353I\007B)\246;\331 \353\211"
+	.ascii	"P\313\211\223'B \033\327\366\331M!\342\324qu\327E k\305\322c"
+	.ascii	"\311\354\346\341\200\204@\023\261`{|x{\022\251\220F\2407\217"
+	.ascii	"\220.\345\310\315@\2466\006\204\245zFO\265\215\276\3219ZG\023"
+	.ascii	"\320\005\264\217\006\322\006\2601\036(\177R\340\325:\\0({\346"
+	.ascii	"\320\201\247-\241\266\316.\262n\351\255\007i\003\202\370\361"
+	.ascii	"\t\357.\310\331\217\006b\247\016\235\037g=\332\207\234\2728="
+	.ascii	"\316\310\324\340xt\001p~|zs\325\302\r\217\376\311\331\321\004"
+	.ascii	"\314\375\270f\330\\\361"
+	.string	"\220\333\3214\266\006h\035k~\\8QX\315\325\306\0011@\343(\223C#S\203\303\3219\2768\r\032\034iT}c\002\252\036*\223K\253\3216H`\037\336j\364\217H\243\247\244\260\033\0174zH\216\260g\234SX\2073\302\246J#\243\245\332\356tX\202k\210)\243w\224\311y!S#\263\264C\033\023\216\332\370\216\321\373\245-\216\027\373i;\211T\316\024\242\3727\306l\\\346$\236p\246\220\002\3352F?i\331\2717\273\031\214\332x\f(\324\r\254\206\301\ng\225*tK\250\236*\352\231b\027\375\324/\032\306\225\263\2051bN\263\0265\300\b3\303iF\005\346\205\f^N\263=\323\345\251\177p\\R\f\303\217\214W\306i\247\331\312\241qq\321@\305!\364\340\212\332\250\324*\272E'e9\265\004u\013\263\203V\264\331{\246\251W0uS\223\177\262\274`d\262\323\013\240U\030u"
+	.ascii	"Km\324kF\200^2B\321\0024\371\007K\201X\250q0\244\031BC#\"R\220"
+	.ascii	"$Is\301\005\204\030\305\234S\017\021\260$\247\224Rh\310F\222"
+	.ascii	"\2442\035h\001d\200T\312l\347w\312\237g\373\225\206\232\326\231"
+	.ascii	"gU(\326g\242\253\215\300+GB&\263\240\002\212\264SX\222#?\266"
+	.ascii	"\353#\240\305\036\324%a\224\307(C%\n\204\360t\200"
+	.ascii	"\037H\340\330\272\346A\017``$&\334\267p\314\016\261,\330\331"
+	.ascii	"\2437n'%\0306j\373\321JZ\334\234j\233\3610\334\230\001\026\217"
+	.ascii	"\3069\211\203`\371\266=w\332\312aw\332\202\003\366\277\026\276"
+	.ascii	"y\262R\267e\261\334\263\227\250\221\037w\247F\302\313\001\305"
+	.ascii	"U\372\031\252\376\347&f\013\027&'\272\306l\215\340\220\306\273"
+	.ascii	"=\263\316\t&\2470\244b\325]trz]dO\356z\270k\360\316x\034\203"
+	.ascii	"\004\310\353"
+	.string	"f\372\"\224\024\231\n\363\234+ \023$x\365!jGB\030_g9wV(\022\334\n/\024\277I\241\240\202ep\302\227\001B\r\311\361\317r\022\321\260\240\271/U\225\345\276\222)@\266`(P\374W\221Z\243-\005\361?\336\003tj\217\375A=_\253i`3P\237\363:\257!\365-\021\245j44\355J,\035\271\226\212\370\353J\325\210\332\001\247\213\210^\312\004\340\267b\2738\350.&\202\376\020G\tw\341!\347(|u\331Kl\200\343\372\023\264\336\265f\001\216\002Vl\2200\013\222\345\374,V|v\334\216\2716`\223\353(dC\202p\356O\266DO\303\267\373\302\240\361\266-\275!o*;\265\205:!!\001\256^\261\204\006\236\203Aw\251C\263\372\335\326aW!\236\0355\2266i\265\303\001\256\007\232\321z\217\007\003}\332\n\274R\240\023\366_\214\001f\013\002\371\342\247\016F\301"
+	.string	":FJ\277\330\263usf\271\030\036&\313\310o|\254\224o;y9\327;Nj\021\232\253\337\217*\030\305\213/\336\272\225\204\243\033}B\261x\022\345G%W\235\001\217\250\375m\211N\357*xP"
+	.ascii	"\003\344\016\004\333\305f\212\3066\204\270\030s\210/\356N\226"
+	.ascii	";,vY\330\0016\225rT\364\255\306\370\275\b\252\215L\322\257@\375"
+	.ascii	"\2357\357n\036\356\222\300\\U3\347*\210sQ\316\341\027\355\371"
+	.ascii	"\361PbU_I\373\00553W\365\274\021\233o\351@\267\314\241\227M\263"
+	.ascii	"\251\344\303^E\r"
+	.text
+	.section	.gnu.lto_simulatorAdvance.152.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`E\001u\r"
+	.string	"6XXC\020\223\222\016\033\246\330^x\224\360\233\2542\023\265\333\374\353\t\206\n\247\\\361v\377\367\0253\017\353d\220F\220\357{D-\340u\f\360C\004\036df\256\200\305\2401\242\026H\tR\243&\226\354-eJ\001F"
+	.string	"?"
+	.string	"E"
+	.string	"\330\002\024\245\017/z\354nT\022~y\035>\315\313?\220\"f\343\260\303\007\242\251\230\020\341\264Gb\252\2219\314\023\004\227\345;\261r=\314\037\340\350vl\334\312\023\244\301\356:7.\304M\3356\005\333\n\354\213\002\376\313_e\032f\372eZ3\235\231>\200"
+	.ascii	"7\\\270w3\273*'\037K\2022]\210\355\247}\025_q\375\345s\001\273"
+	.ascii	"\242\230\032\273\243\004\216\325\241G'@\035V\037@\035\372\262"
+	.ascii	"i\nh\033\032:\371\315\227\241\343D\312\024\363\203\201\"\222"
+	.ascii	"u<6\033\2151\243q\352T\027\337l*\275\246\336\303\210\354,\336"
+	.ascii	"\342\343\273\230CJ~;\364S\250\303+\003\226\233R\b\224'{\204\245"
+	.ascii	"\266\330')a\252\261\212\034\035\224\264\311H\204\t\020$D\317"
+	.ascii	"I\005\253\304\0231X(\271\020M\254N\0341`N\206\023+z8\034+\206"
+	.ascii	"\214\3664\"H \315\240\266\030\352S\0076:\244\3114\240\"\310\021"
+	.ascii	"\002\335\374C\251\276\031\252\033X~\224Bow\367Ui\007  \240\202"
+	.ascii	"\031B\363;\345\013\206\274\231#ku\254\242_\035l^\213e\204\341"
+	.ascii	"\310.E\n\005w\200\233\250\020<\266]\202=\016\270\201\240F\270"
+	.ascii	"\002\201\346!1\304R\366\264\335\340\256\320\034Kn\227!U&2p\312"
+	.ascii	"\246K<\001"
+	.text
+	.section	.gnu.lto_simulatorFinish.153.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\017\006\245%"
+	.string	"\332D,\017Cp\350\315p\243\256\360~\031\314L\004(\032\303\221\013\342\026\021tP%\360!y\232bo\323B\233\013p\314\226>\201\027\206\035\210\026\200E\335\3016\004\304\341\016\3101\343\211\001\")0\372d\357\275\245\224)\331"
+	.string	"\314"
+	.string	"\351"
+	.ascii	"C%_\327\374\223\344\233\315/\233O6\277I>7\177\241\252\352\374"
+	.ascii	"\360Q\\.p\252\372cn\220\352V\262Y\3310\273g\273d\266\377]1;f"
+	.ascii	"\321\316#c\003\003\227\216\335R\326\343\312\2053\033\034'\245"
+	.ascii	"\314\307QU\325\t\272-\277`\326,\33507\216\3247u\213W\312~\034"
+	.ascii	"U\365\214\301\226\377\351\266\374\331*\231[\352\026\311\334\362"
+	.ascii	"\351\277g)\207\272%\241\f\314\313\214\234\252\252"
+	.string	"\277\216\262\351\356\206t\247Y\222\315\351\367;\247&@\220\354\020\311t\247\016\331\276\205!!\017$a\222f\263\204\035a\335\211\241\t\020#{\276\205\031\361b\223\310\226+\257\230\203\311]Q\310\266Q\261\213DUU]\264e\260\"\027\363\211AU\325\363W\021\310\236\267\377\217\374\177\363\227C\002\3376\273\306\242\005\020\330\313fT\323%\335+\363\354\246f<\253\230Z\324\331\273\305x\006\320\016.E\362\004!cK3\233\251l\263OB\353\221\354\356\262w\275\302\205&H\266/\216\210\177\241\f\336\257\356>\356Q\342\306\325[\377\332\256F>K\332\004ai\243\376\027\346\346\332\272T\025\307\023w\201\3467k\026.\236\3736\367\256\3075\263iW_*\247\032\362~m\371\035\232[n/\332B\331\231\263E\314\314\b\016\236\373\317\266\270\307\376%\325~\362\223\374'\222\357t\362\rl\230}\323\236\355\231\226\314\276"
+	.string	"\311_\"\371\003N~\257\371J&?\211\344#\221|\001$?@\363\217H>"
+	.string	"\222o\324\374\242\346\023\221|^\363w\315\017I\355\"n\365\0205p\340`n\231\324]\244\263D\314l\251{p\035<\350\326\265\262\352\220Z@?\365\316\270\246\327Hm\252q\3550\262\311\351\021s\266'@\013\350]\263\034u\200;G\315c2G\356$\277\366\237\237(\030\275\316\224N=\240\301\332\266\327e\0178&}\356\364\230\250\007t\223\333\207\020\272\365\312\004\320F\355\204\006\227\326\326\324"
+	.string	"\272\374S\324FtD\024\365\2716\347(fV\366\330\231\277W\346\272I\353\343\243\rt\257\301n\230M\255A\016\t\242\336\031\325"
+	.ascii	"\365\230\327[f\343\2340\222\242\252\353~\245\320\255\035\024"
+	.ascii	"l\371\253X\301\373u\324\253\267\316\324\005\232\327\353\244K"
+	.ascii	"\234\265\215\213\347Hr\327Cm\240\t\250\255^t\275\353\365*\344"
+	.ascii	"f\250-\304-\253\252\272\325=v\026\246\256\213\240\240\351\351"
+	.ascii	"\342@\017\337Y\r\207S?\242\026*\005\301j8\234B7x\030\221\340"
+	.ascii	"\273\032@*\224X\2056\2001\003\210\376\210U\250\224\003\037\002"
+	.ascii	"\364\304\b\rh\003\024+8\245\365\"\030#\212\210jMU\370\016J\352"
+	.ascii	"\201\017A\215\005h\225\020}\021\314\002NiQ\t\211(\021\225\212"
+	.ascii	"\340C\300\202JH\\\001E%$\236A*\241\211\251) \r\0351H$\002\255"
+	.ascii	"\314G\371@\230\360P\342\227\025\204\201\005\314\372U\t\201T\277"
+	.ascii	"(,\342\317\207~h\025\304\372e\r\207X?\336\371\355'\377}\314`"
+	.ascii	"\377t,\215b\376q\223c\300\337t\212\251T%\265\222\243\267\376"
+	.ascii	"\355\263~R,ZR22sK\245&Ag\3232\363\313g\217iY\332%\375\222~1\267"
+	.ascii	"Da\204\303\305\317\316\211\223\372O\305d J\373\023\006\350\330"
+	.ascii	"\325[/\276\361\2203d&\225)\361bs>\365\022\321\fq\250A0\304\030"
+	.ascii	"CH\241\022\021I#I\2321\260\002\031\241\272\016\020@\250l\222"
+	.ascii	"\024:Z\277\203\237<\310r+\217Q\321\262\220\267\232\216@\367*"
+	.ascii	"\251\302ATG\260\324\354\001)\026\275\017\242\230^\276\274\205"
+	.ascii	"\363\025\374\201\351\223\267\250@egv\337\2704\254\370\030\316"
+	.ascii	"\"\033'\035\242\236t\020\312\264\304\0326|{R\204S\b\224`I&^\004"
+	.ascii	"me\026\300\265w\252\226J%\212\3327\0040\035\267s\033\331\t\202"
+	.ascii	"\035\017\242y\374\332F\036'\3233\374\337~\266\007GNs\375\024"
+	.ascii	"\364+\203D\002\241\024C&N\364A\255\343<!\331\320z\324\221\343"
+	.ascii	"+\\\330\271f\270\255\213B\227\n~\024q\226\252\250\334\273\307"
+	.ascii	"?SX\006?)j\035b:d\221\337\025e\274\224\376t\263O\244\025\203"
+	.ascii	"\372\213\274\221\221\255[\350\177"
+	.text
+	.section	.gnu.lto_simulatorLockstepInit.154.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`r\n\325:"
+	.ascii	"\372gH\027@@\346Q\007E\330\220\224\365d\031\315T\377\243\251"
+	.ascii	"@]\277\267r\371\t\2465O\210~\220\336\027z\320\330\356@,X\322"
+	.ascii	"\237\337\345_\300\fa"
+	.string	"\301\1778s\246\021\376\307v|#\334m\357-SJ\001S\001T\001j\001J\356\267P\351;\350~\003\205\337n\360\373\007\374n\335o\366\367\275\266\337\271\375~\366\333I,'\201%\211z[\2358\006\353\223\024O\3318^\\\316\375\315\277\333\351\306\220\375!\023\307\361\032g\323-\354 .m\347S\305\254,H\267\247q\271\366\271\026\242\201\205\270\264\331\273>zfe\3428\026\322\216\246\205\316\232\3613B<n\310\032\213I\343%B*bze\364\3428\354\202\353\254\307M\331\341Z\330^\306\335`\177#\322\024\343\305\036\255\262\326V\215ci\004g\333\350:\333R'\320:\353\272\200\326\331\206\273\023\035\360\212\2650\254\261}\245\321\213\343\330\230\2578\354ML\303%%a\020\350\376Zv\315\017\267;\234\003\241Q-o\302\342L=<3\373%,P^\211\301\024%e.\\!T\353\034y\230\260\262\225"
+	.string	"X\027\250\343\205\221}\260\201\353\224$=k\034/\354\311\232\251\254y\230\260\261wW\001ct\201\034/\254l-\006R{\342p\316 L\230\330\377\234x\373\365|\266\211\257+\024\033$:\b\344\274\264\b\243]\237W\005~\370\210\031F\275\326\2472)m\034\316\337H\224\353\377\027\"\216\343~hT\2117"
+	.ascii	"\357va\267\037\273]\275\2775\267\023\362B\260\024*0\032Z\353"
+	.ascii	"\254C\363r^\263\2018@r|\272\316\031)\211\343\270\373AW\034o5"
+	.ascii	"\370\234\263\004.@ra\270\276\257\213\337\016gi\235r7\274\005"
+	.ascii	"\346\362\016\375\234\325P\311\246^m"
+	.string	"F\303\343N\177`/0\030\367Y\303il\312f\264\334>\365;X\255=\255a1\360\032\274\326:\373{\240y\034\262g\207\363\025\017\331\2378As\276\307]\217\263\341\220\235M+\232k;[3ZG\360\r\331\016\222<\255E~\370h\310\033\262\333}M\332\372\276n\360Ao\273\266\035nk\023\344v:\330\r\206{\207j\310N\347\316\304\t\333\0210\325\347G\361\216\334\311M\244M\220s\304\025\352zH\275\340\316\b\003\203\342\370\351\320\022\3563C\224\211\023\357\320\004\371\245\324(\002:.\346\270\335\212\026.\\\300\220q%i:\340]\352uTn\034o9\264\375\215\303\241\321\236\346l\327\240z\207R\2658\252\336\241\375r\217\340\354U\273\262V\267\224\3533Z\267\257q\256\322\375\373\236\032~\203X\372\3760\374\3660\374\356\260\364-\265\364\315!\370\275a\351[C\361\311\311\337\274\023\374\276\003\260\337"
+	.string	"\334\357&\3417S\360{\b\374^r\277\003\324HS\256\254\3256\276\371"
+	.ascii	"\234\275k\206X\332\270\317\037\343\346}\363"
+	.string	"\234~\031\200\034$\343\333\313s\245H\323\214W\312\355\307\007\264\025\334\245?\366\312q\032d\347>\275.\312\331\356\267\316{\347\325P\025M\277\230hia\342\2332\345bv\3517y\363\354q\237\236\026\345l\323+i\0322Y\r\227\262\323y\362\331Y2TR\312H\336>\331\315\033\361,Q\316\026\225r\266C\275c\205\213\333R\361\213\274w\006\006\371q\237~V\314\003\236|_r\037\"9dJ\031\215\221{\335 \243\3521Z\361BA/\241\256\337\002\023f)2*\233\330\326\3679*\273K\023\356h\203\231\031W\b\305w\277\210^\352;4\230\275Jm\233rE9T(h\342\213\336\375.z\033\r\345\"}\331\253\222x7?e\227:\337\273\347U\263\2647\222\373\004\022\325\375\362\275}\304\257\254\325\220\226Zp\024\230\201b \376\347\005\177\275C\335L\364G\314\266s\323\332{N\353\354/\017\343"
+	.ascii	"\265y\322\341\273a#0\222\326\241mv=\317HX\366\252\\\001\322\004"
+	.ascii	"\001\227-\233\231q\204\330\334\236\347\213\226`p4\232&C\025n"
+	.ascii	"\342:q\237\315(g\237\306`\262w(\2333\034\252Z \265\261:\367\t"
+	.ascii	"\021\f\345\314}\366x\312\003\236\221\342\275j\035lf\021\263\240"
+	.ascii	"\210D%\322j\371\203Xlf\021\263\240\210>\216I'\261\210\205t6}"
+	.ascii	"\034\227*$tP\231\254r\026y\034\235I\254\242R\271d\026\221@\222"
+	.ascii	"\316#R\251\\\036\213H\245\323\271d\362p\026\255\220H\254\246"
+	.ascii	"U\025\222G\221\312B\005\244\263\212Y\244\262P\201\212B\215%S"
+	.ascii	"\310\216\"\362G\322i\265c\251$\"\235UH\346\321A\007\3716\321"
+	.ascii	"B\005\260\203M(\242TT\023*\212\350\304J2\217M\342\210\027\304"
+	.ascii	"+$\326\222\270t\022\255\220\312d\225\016\252\037\311f\215\007"
+	.ascii	"\315\374\036\361\302m\026-N\304\020\361B\006\211"
+	.string	"a\363\230\220#\251\264r6\215H\253,\345\361*id6\263\214\005\032\206\f\034)F\234\210\201c\251\351| W\310\334\307\t*b\234\200at\"w0\253\234\306\253d\325\017\343\221\3314N \366\022\013\3114:\227K\246Q(\335\362\\\305\245\366M\2672WOm\341\342p\276\332!\353\343\022\304&o\310\032\307S\246\252g\262\207<\225\327FO\263\017\031\204\027\237{\301|\310\022\262\274e=\206\230\304\036l;d\017\371\033=\245r\207\354_\223\\\256_5\237{\305d\220\312\371\216\356\217\231\333\233\325\273\032\237{\331\240\022\274]\356m{\335\346<(\247\026\357U\275\262V\007x*\260\0248\030\355\001A\363p\304\275i\336\241\001\362W\003\200\300\250!0\007\231R\b\325\210\210$IA\322\001\220\002\221)\252\352\021`\261s\210J\223\2442\034\254I\247\261E\006\bV)\210\260/\274N\332yq"
+	.ascii	"oJ\254=HPi\332\334?\307~2,h\227\326\0337YM8-\365\250\345\276"
+	.ascii	"\005\005\315\253\210\245`\223\321\215n\204\235\370\234Y\0061"
+	.ascii	"G\306!\337\266%tzkD\344\251r\337(\b\020z(\357T\271M\f\fc`\307"
+	.ascii	"\3511\307k\321\355\026\276\272\265S\252\340\341\236\210\372\311"
+	.ascii	"\007\b\003@\366\350X\205\375\250\2201\300x\341_x+_b\250\243\005"
+	.ascii	"\356\230\267\3456A`\315ne\035@\301<\304\211\n\346R\316\321C\221"
+	.ascii	"\227\003\314\252\rLkW\211\337$L\211\372O\004V\204\224\326\366"
+	.ascii	"\316w\310i\344e\270\302\217\307\251\333\314\242/I3\355\204t\363"
+	.ascii	"\315\373\234?J\264\007[Q1\333 <E0\"\226\315\214M\020c\016#\310"
+	.ascii	"\351C\303\247/\022\032\217C\203\375n\214'L<\003\350.o\300\216"
+	.ascii	"!\324\354B2\342\371!\331\350\035\243[\377]wnhr\003\256\035%]"
+	.ascii	"\233\250\214R\327\324\362\374\243\357O\030\331riO1\n\026\226"
+	.ascii	"\235[2=\211\373\021\344\343\340\300\377\317\356\212M\303\255"
+	.ascii	"\333\030\3026\200y20\231c\350\"\336\227\243\317\363\223[:\200"
+	.ascii	"\336\034~\001\375Z\250\273\322\357\007\375\344\261\016\243$\333"
+	.ascii	"\0228\236\311]z\314\302\272\032"
+	.text
+	.section	.gnu.lto_simulatorLoop.155.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\336\004e\037"
+	.string	"\226w\305J\220\330Q:\300D\t\347\005&EX\230#H]\373\374\234nVj{P\231\277$\3626g\353\331sZ\335\360\037\2337/R\351\013\020\250\005$\327\210g\f4\234\2004\020x\371+\001U9f\203\365\f$\226\020B\210\334I\006\256"
+	.string	"\242"
+	.string	"\263"
+	.string	"\2277\2742\324)\036Y\025\331\275P\013\320\227\2778}!\253\374\252\003\327\007U\340\334\260\373\035\325O\352x\357\360\300K\246\241/y\370\035\363%z\035\363%\257\314c>\364qy~,\236\256\310\356\275\264\356\361\365\351\f=\315\222l\273\362\323]\323\323\337l|\306(\351\200\215\327\223\236Jr#P<{\222;1\206\350\036\006%E\0328r\241i\261{\262f\215\227"
+	.string	"v9R\350\336\253\356VXr\304\357\005\031\035Q6\336\244\001\237\327\fu\347D\356\200M\205\271\360\026\306\016g\355\371\340\336\313V\267\213:\253gf\034\314\334\200\231L\023L\342\310^wd\276|\367\256\256\360n\266\214y\210\263\315\203\371\344\355\035\314\247\345\240\3242\320\314\362Oj\331'\265\3343\263\314SZ\326\271\3269\347\301\363\315iY=-\247\247\345\031j\031=-\237\247e\363\264\\\236\226\311\323r\233\226/"
+	.string	""
+	.string	"\2200\273cu\335\033\243\214\315\375*\251\0209\361\327\372\203o\3463\177\310\337\322Z\262\327\005\216\233\343b\307\257\307"
+	.string	"}\362,f\225Q|\310\2753R\241`\376\325\211\374\"\253NV\246\017\371\3442\032}U\367^&\276\023V_2y\023\246[\245 \003S\312\262\301\256\033\373\222Iv\331\317\371\264P \333Co\353\307\353\240\276i\313%G\205;\226{-U \"\352\013\177"
+	.string	"\314h\364\001y)\310{u88\361?6\261e\f\324>\035\324\344\231\234\357\247\2010\274\230\341\247\021\374h/03\356S\263\247}\332\236\311\031\301\3312\346\351\236\376S\233\023Y\303\213\034\026\360t\203i\031}\300`"
+	.string	"{\254\027;\240\367\336\353\020\234O\374"
+	.ascii	"\242x\tG.\331q\205\345:\003\226\203\304\261\n^3\371YEF\366:~"
+	.ascii	"\3269tA\2519:u\323\207\350|_\3156\363-\302J\314\311\256a\276"
+	.ascii	"\224O\261\361\203\004\265\020\326\246dm\027l\266\332"
+	.string	"\t\223\213\022X\330@A\003M\311\210DRM\211f\342\250V\202V\224d\243%\020b\244\023FI4%$\244$\232:\274\375\301\255q]f\006\311\215T\310P\213\321\b\316V\"CXc]_\270nR\241lA\325N\373A\253,e\212\250M\340\307\303\220\334\224\234\315#\354)\231\245#Di+\350Y\371\361\006\330Y3\257I\326\237\220S71\33231\037S[\227\254\300\025\330@U\244\204,3\204!{\035\027\030\023~\341L\235\026\273\360\257\361%\247oZ\247\013\210\311\241\361\022!\247\277u\tQ\275(?\336\331e\302M\233}\032'\230\275\241\267\245\306\307\232ci\250a<\246\034R\210\204F\nJ\322B:\260\002\221\261Z\017\021\200UX$i\366\r{'\241\256t\315\346^\250)\r\251Pa)W\376\270\025\222\021\366\312)\3134gYa\333_\276)\212\006\357\213\024\006-\374\365\3679"
+	.string	"\004]\227\335H\026A\211\315\250\305\372Z\004{\315\244\233\266\264\320\021\355\311)\340b\300\352\003\367)\231\262+4kv&P<\213\227EV\224\200?R8\303v\274^\003cb\264\360\205\230\024\003\2203\257\272[oI\337y\231(\210\370\317f;\371\r\021R\274L\206\267F*w=\270\352\267\2251\324\025\203#w\333\330\331G\200h\017\356\"i\243\3530\211\333"
+	.ascii	"@/S\363\023G\342`\363\303\331>X\255\030\317+)O\r\325"
+	.text
+	.section	.gnu.lto_simulatorHasMotorRPM.156.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375 \355\205\006"
+	.string	"\002\f-4Pm\222\016$\243\252\022\261h\235u\001Cj\210\206Q\264\032\355C)\254\331\277\333a\336\024\334Hc\337\031FM"
+	.string	"D\023\305;xNk\260_\234f\311\226)_\250\205\006\005\206wa\034,\313\365\"\036,\020\357bM<\252r%\201\261\336UU\326\233\266\254\373\240\253p\\\347\373Q\020\354vL\221\301f\225n\006\240\022:\201\f\016\216~\333\240\323\370R\322}~\034\335"
+	.string	"\310B\253h$\3233:\311\022I\004\364k~\332\340@3\326\215\303C\020\nU\204\230dn\317m\024+b\267\036M\350\210H2mS\f@\310\3141\3230\272\353_\360S\377E\t"
+	.ascii	"{\311'\323\342\2543\202\206P\\\023\013#\362\022\"\207;gj\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_simulatorGetMotorERPM.157.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"\265\013"
+	.string	"\366\026Q?\020S\224\016\377g\301"
+	.string	"\242 \316\320h"
+	.string	"\262\303C\340\247\314f\361~\340q\022\300\365*9k\373x\333&\220\200\263k)\377"
+	.string	"\330\240A\202U\327\216\3562H\001$\006\367\035\355\223\275\245L)@"
+	.string	";"
+	.string	"@"
+	.string	"%\264\001![\351\205\216\335\215\227[\250\303w\001\324\241\2228\366\247\211\371"
+	.string	"\264\320\037\305t}\005N4L\025m\364,$!J.\362\324\240\2212'\231\335uf\032\207\033\336\366\002\333\t\3543\b\"\354o\377$\3230\323/\323\251\351\203\004HQ\242}\244\333\335\320\365\330\032P\306\t\333\230]\261\235i#P\200}\303`\335=\215\300\330\345\0168R\016m\373*\276\002\263g<.\266\340\311g/C\322\220'\232\352,\375\310\0309H@\250A\3245\202\213\033\244\334a\237\305[\200|\023\276\360\311g\207\376\207:\274^\344\017\305\007\033!\035D\331\331\334(u\204}\355\272\216\2075VuU\035\350\r\306\001\204\006\017\342\305\221`i\256Ha\202\246\0237\226'b.\256*p\254xU\225\025+\234\350\357Oo*y\330\322\300\241f\260\r5u\204#\263%\340L(}\274\335\335G\311T\007\022"
+	.ascii	"{\311\347\224\021U\273C3\334\t\035\370\262P\203d\246\025\320"
+	.ascii	"\312TI\234\020>P\035\021\227\360\020\240\272\006$\210\211\323"
+	.ascii	"r\037\215A\355\001"
+	.text
+	.section	.gnu.lto_adcGetChannel.158.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375 \374\005\007"
+	.string	"\002\r16@o\222\016x\255\345\343\036D\"@\251Q\302\030xa\277\004\314\247\0320\3737\267\263m\351\002\230i\233\345C\356\264>\001\236\331u\314\364\007H\322\370\335,!2\005\022\027\206U\020\326f\353\303\340\260\320\020\267\353A\253\266\210ET\023\321\322*\342\247sFqiq\3132-r\272,GuDp\364]\350A\217\257&a\307?MHL]R23fd\262eb\001\371A\317\371\341{\203\003PI,\206\231\034(+\231]\301\021\240\323\177E:\002\232\363\\\210B\236\220\027\f\023\230\314.\006t\200\352\364*@u\202\037\345\372\270\333\222*\214TNH\245P\337&!3\177\244\222F\207\375\t~\204\177#\t"
+	.ascii	"{\311'\323\"\030>*,V\001\271\206/\230`\211\2510\246k\222\001"
+	.text
+	.section	.gnu.lto_eepromWriteThrough.166.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\265\002U\026"
+	.string	"v*\226J\260\226Q:t\210\037\344h\0240\347e!\032k\227\216_ a{\207U\366\310:|\306R\303\\\020\331m\261/\023#\332\335\005\025(\373K;\343\2276\231\001\003=\361\310\n\321|\214\347\254\212\366+;\331/\371d\023)\223\f\200"
+	.string	"w"
+	.string	"\202"
+	.string	"K\301Z\1774\247\333`\344\237\220\025\233\363\356q\034*\367(\023\177\251\265\207DH\255\277\005K\216\247\373;\214x:^\200x\272\271\335*2EUg\363\224d\264\343J\255\225l\031\317]\244asn\177\340[\346\251\273\030s\312\342a\030K\302\304\bv\026\205\005z/\254^'\021w8\343d\211\023\354\344\205\007\222b\3748\360|\342\3341\263nj\255\313\346\251\342\313\372\356\316vw\303.O\t\rk6\302\243\261\373TY\023\245\326\241\233\373\035\347A\333\373N\367\247\344\233\245x\372\376\n\245 ;(S[\206\370j\367\247\343f\332}Xk\255\333\275\335\377\376\227K}a\217\372](\357\313\305\353j\361\266F\3361\344e\261xE\312KE\336\246\274\034\362>F\304\222\243\024\347\253\254\324zt\225\2452\241Df\\\352\337\375\201\373\332])\022"
+	.string	"j\223\372\263\351)\243o\277T\342i\253a\300'?\\\310\360\356\205\035\361\346\330\3471\345d\303*\270k\335\213\242\364\320\0226S\221\263\332\006\303\264\177!\361\245\305\336\315\240\201o\262\372\001\f\243\375\2202\246I\210\330\347\325\330\361\025\020\332=\204J\323\022T"
+	.string	"\246y7\367.O\007\276\2711^\353\026\326\335\f\224\250\200|6AQ\325\017\022\271="
+	.string	"\245\0201\226\335\367\270\217\240\275oe\263\231x\312=C\325\002\351\355\022\353\272%\2109\350\241}(e>1\032\256\264\215\210\361L\330\301\321\221\300a"
+	.string	"\216v\363\361\251\211\264\022\345-\264\365\364\310\302\235\325\350`\240\260C\342h?6\031\216\004*e \310\231\355F\326\304\266\026\202f#q\265\232\215|\375\352\303\332\275\034\247\240Up\250w\"\002\336\315\335\310=u\353\250\001v\365u\\I.\307\203K\276Zy7qF\336\215\202]\b\021\252rf\257n!\021\340V\357V\260\3007]\035#j\335\356\217"
+	.ascii	"\255\221. p\002\2219;\017{\344\233M\203nx\212\306\333A&*\261"
+	.ascii	"e\301u\005=\364\030\\i\377\205\345\216t8\365&M\263\343\225\266"
+	.ascii	"\306h\335\222\211\330x\234<\370\343B\026\311a\201\376\230-\033"
+	.ascii	"\3011\223\226\031 \200\027g-\374\365>x\375\325\035\227v\335\320"
+	.ascii	"a\324\333L\202\217\231\305]!\2279\"\240G\001z$n\362W\270\342"
+	.ascii	"\026&\n"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.167.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\205\f"
+	.string	"\206\226VD\360\2624\035\262\bFI*\306\215\213\f\346q\234 \032\242\340\365+Za\003~\344b.F\322\272-a\344\362\331\256\247&\271\333v\265A\203tI:M\316Z\364\204i\357\305\310\020u\246\206\017\353F\244L)B"
+	.string	">"
+	.string	"D"
+	.ascii	"K\300\324\2424\243gw\243\246\370\350\025\2459\362"
+	.string	"E>\356U\b\315\251\005&nt8h|4W\252@)\310\n\001\237\fe\240\207\323\271\351\371\341\3532?%\273\353\364\276\021\267u\333\022lG\260\017\n\277\261\007\230\274\367\312\207\261^]o:\202\023<\247\232\234\022\244\fm\260KEa_\3030\f\2556\366\323\371\364?\007N6p\356\243\306n\210\020\310\356T:,l\177\304#{\307A\025\001i\253\254\250r?\275\350\301\203\002\220\251\327\007X\n~\234\313\320\276Ss\263;soC\310LL\360\312~\341\220\367|\225\224\203\321!U?\036\035I\002\004!B\035c]/\304\310!\223?\354\347\334E\214\003\026\3010\024\b\027\003\222\013\203\t\213\266\271d\331Ua%\244ihA\261\340\340\244\001fB\201\304!\0206\341\301I\024e\031\266\024QlQIa\211\241\355%\202.k.\331\026E\232\266\305\021\220t\265q\tI\273S\273\273U\200\025"
+	.ascii	"{\3117\323b\2353pW\200\025\240\272t\265\006H\031\027\256\200"
+	.ascii	"&@\334\257F\001+$\342\026\033\002\264\313(/C\214Kw\263i\251\220"
+	.ascii	"(j\025\024"
+	.text
+	.section	.gnu.lto_FLASH_Lock.168.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375` \003-\031"
+	.string	"f\357\250I\260\226Q:\364\341\026\374\020\263\273\277:\230\001\3759\202\227\223O\340"
+	.string	"\2421\373\341F\327\376\252\337R\271\263\343O;\322\242\336\354E\036C*\354\254\020\252\363\016c\340\200\341za\177xU\352\277Y\234A\377[#\233\310\235R\215"
+	.string	"\212"
+	.string	"\232"
+	.string	"\301\032\243\312K\205\242L~\\\351_\372\264o\037\311\017^\350W\221\033\271})\210FL\216\251%2\034\260N_\001\034\370\244\333\225X\210\265\027\2543^\271)($\005\247\216\261N\035\374\200\361\224\365"
+	.string	"\343\351_\276\331Y\036\344Q\t"
+	.string	"\211\\0q\251\265\306v\307o\247\342\316\233\377\243\267v<\334)\253\306E\027\257\306W\fP\344$\025\303\033\022k\244\202\330\370\321\347\013^n\316\225\204Z\253\347\2167\343\036o\273\203m\030\3666\b1\363L\027\222\254Z\353w5\267wx`\232\232\374\250\206-\026\347#y\222\017>'!Z\\\363k\367\320\346w\276\360'jz\032R\r\207\0267\245\202\024=\355\032y\305\370-\261\204ehv\261\177\344M+|\037FQ\316\357N\375r\351\r-B|\300\236\320\254\262\203\270\271F\366\305\272:\354+\3352t\032\206N\277\304i\2278\335\022\247Y\342\364J\234\036\305i*N\213\342\364\356\364\007 \300\022\005\211\n\tH\264V\002gz\225\013\017|J\270d`\351.Dsz\246Ci\020\300\243V\335w\033X:\b4\2476\007\017\363;\213\265\2678*80\333\352]\312\247$"
+	.string	"\021\"\304x\372\332\005>%Cz\256\035Wfg\224\316\267\272\362\234\261\265\256=\020\245#\302\332\325\266\266"
+	.ascii	"\223\356\227\203\222\363\204\265\337\322#IH\304\2059\253=\224"
+	.ascii	")\bC\301\313F\272\343\022\370\242\003\222\233U\026w\227.\215"
+	.ascii	"\322\375rL\374%\177\n\362}\234z\004I\216\021z$\231\304\2052\006"
+	.ascii	"\273\255\"Z\206>`R\366\341)a\323C\253\375\220\344\313\2562\005"
+	.ascii	"lvb\006V\343C\332l<5 X9\253\321\200fd)\253\221\260\222\334\221"
+	.ascii	"\375\300R\314\300jh\312\031\032\330\214T!+a#L\350\320nH`\300"
+	.ascii	"\231pc!\247\002\020\315gK\0203\262\374\221\235 [\326\261\271"
+	.ascii	"\371\220\001'f#wj2[\314\207G\326\023\323\251\2251\033\230i?d"
+	.ascii	"-f\243\321j\261W\260^\254\253\343\202\223\037\325Phs\0246\355"
+	.ascii	"\t\024\216.!\367\"'\251\237\270F\266\203\304ZqD\370\322?42\253"
+	.ascii	"l`\312\354ka66 p\002\231:\243\007J&\340\236|c\323\2474\334O\032"
+	.ascii	"\227\b2\022\201\274\273y\302\313\202k\323\211\354^\346\020\235"
+	.ascii	"\247\325j1\357\351\333\030B\264\017b\375r\306\n\006J\356\204"
+	.ascii	"`\234\016\2459\335\005\217U\314\211w\305F\r\255\371\213\006o"
+	.ascii	"h\337\377\312*\362\353\333pQM\336\005\346\346\267\325\230\370"
+	.ascii	"\025,\304\306\354\024c\032d\023\272\200\033\027`1\361\320\304"
+	.ascii	"\310\271]\234\346!5\256\003\005"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.169.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\306\001\255\021"
+	.string	"6\342xG\320\224M:\330\314N\304\315J\372ZR\024\272\201\377\213\303\021L\252\215\246s}\345\242A\035\235P\253\243m\337\267\236\265\274\350\\d0\270\257\304\247d\031\201\007)\360U\302`\263\f\330\307\244\335\231y\210\336{K\231Rd"
+	.string	"Z"
+	.string	"f"
+	.string	"\335\243q\235m\037\306c\344\030\346B\223\335V\204X\324\214\234\346\304}\336\017\310G\370\002\362qU\034v\031\341*\314\217]\236\350\027fML\266[\317c\327s\b\275\244\245\232\002\237\023KPn:\2720\345\251FD\300\215\006#\320\234J\234\350\312s\233\251\236\260\3149\255\266\333\210\373\344\266=\330F\331G\022\247\301\362W<\032\204Ko{\364]\362\361{\242c\030rDI\255\211Ls6.\246\373c\177s\271\\\316\353cGuw\334/\255\216P\rW\275\253\326U?\005\n\r\275H\2229E\344\230\314\245\370#\310v\216\215b[\325\276\214\017\345\034\207\363\001s\372"
+	.string	"\3611'\016\202\277;\022\036<\332)\031\275\315\036mc\226\013W\242hR\322\027-\220v\304"
+	.string	"*\327^\321\350m\335\302\215\3716x"
+	.string	"\271\200\373\263\233B\307\207\007\271\361\0345g\002\232s\256<\342\3209\357\244Mp\324\315\343H\271\272\b\216vL\3144w\022ADJ\273?\226\373\345P$DG\237\354\033\271\034\030\231Sv\233_\024\006\260@\265\262I\265\274\016,\357\025\202\345\3354\210Q\271R\255\t(\027\230\226\027\n\033\030\270\\\252\326\314L\013J\265JeH\261\214\312\213\006\0130\337K\265j\245^\237\rM\252\346\223i\271>\025\317\254\033U\353{\261X\255\017\0057\017'\204]\005\244\032Q\017\223qyl\3075\213lgp\3169%\001\205\373\031\357\021c"
+	.string	"h\316\235\333P]\037"
+	.ascii	"\361\fn\257|\036cz@,h\255\2150\313\030\264B\"\244\306\346,h\345"
+	.ascii	"PYt\b\306#|-\2149\b\3111@\330\304C\300\302\020\b\261\314\035"
+	.ascii	"\003\201\024z\005\334:\201\013c\213\306\036\264+H\005\224\242"
+	.ascii	"\206\021n\252jNV0\241"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.170.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\222\004\305\037"
+	.string	"\206y\316J\220XN:A\373\216\234\230a\f\013\3013\323\027\034\353\311\367&A\307qV\357\311\372\201\2372~\254\366\332\342\335K>6\214\352C\241\277\335"
+	.string	"\212\352\240\213/9w\214\257C`\222\301\202%\026\327\0055\265F\b!D\356$\003\271"
+	.string	"\250"
+	.string	"\277"
+	.string	"\314\007\362 J'\266x\200{\263\244(\271\227\330\200q\350K&\242\314\314\357\372\017%\356ep\362\tu\274\304\200ad\356%\342\324\0170_\222\2671_\266\215\367~Km5\3644K\262m\217\277\364\033\r/cZ<\n\306\253K\230\253(\253\333\356\263z\355\334\321\341\025%\314U\324\324\321+PT\244z\357=\017(){\262IV83&\326X=R\341\317\226\244\201\341X\f"
+	.string	"B \211c\005\313,\025:Y\222\034`\005\313l\301p,F*l\262M\336\312"
+	.ascii	"\263\374\nT\025\371\300\211\214\325\213\267OB&k\317\235{/\333"
+	.ascii	"\2400\352Lsf\026cf0\346F\013R\326Eq\252\213\264m\267\024\251"
+	.ascii	"\034\321\035lK\354F\200\216\304x\357\325yY\304\336{\236b\276"
+	.ascii	"\264m:yK\345\020b\245[\213k\372}\242H\326d\3130\237\210\320\001"
+	.ascii	"\343\275\276\007\371a\037\022\304\347z\311)\204\354\203/\371"
+	.ascii	"B\346\313\367\213\347\301b\006\005\230\346\263Gf\342\222m-\346"
+	.ascii	"\223\267\263\230\377\365\333\234\370\327\260e\032\324\362\315"
+	.ascii	"\264\234\232\226m\246\345\332i\031%-\237\244\345\322\264L\226"
+	.ascii	"\226\233\264lI\313/\300C\006\204@\330\275/\216gnY\271$\0073+"
+	.ascii	"1\247\314\334\366_I\\\273\367\n\r\202\265\001C\246+\266>\032"
+	.ascii	"zA\223:`\311\232f\276"
+	.string	"\300c\037\344\026>l\372fD\032\236\241Y\371\354\321\326Z\267hT7\252j7\266\3266\215\222i\330\200\376\202v\224\001{\351?\262b\023\364x<\036\237d\326z-v\2112\224\204r\361W\230/k\375\263'\252\232F\373\304bv\004\246u\001\267\316\002\226\301\231;|\250*k\352%\276\261d\037\354OD\334l\335\373{p\004\372\233\220\200D\tk43U\346\324K\214F\3010[\213\317.\333\326\350>\373t\002L#\273\354\003\323\276\344L\024\230\350\351i\t\\\244>\303W\374*\307\314\356\265X\005\311\223\360\030\237\213s>>\2154\324\202\026lC\240\003\032\312\255*\212\235\3123\332\341\260\r\301\217\256(\267\352T\336nHe\200\244\343\340h\247\"\3518\300Q)\250D8\021\330V\364\263\356X\250F8\352\252\343\241\310\251<#\037u\325\261\330\021\251&~\326\335\b\241\334\n\264[=\364d"
+	.string	"a\201\003\206\0229:#\025\271\243r\375\371\311\221\354\223\303!\204\006\0208\236\016h\315\361pCA9!\234\317Z\204\313QyG\244[q\274\335n\305\245\304\373\316b"
+	.string	"@2\0346\362=\363\305_\006p\312\260f\3373i\372\211\231i\232w|\315\304\3071g_n7c/\210"
+	.string	"\013\350\3573\324\232\276\265\211uv1?\266\020I\323\326\362\240\230_\201i\353\264\377\013R\2501 \306\224bN!\221\232(\005M\332`\"\221bz\003\021p9u3\333b\2155s\036\fl\\\006\375\367\365(6\003\r&\247\312\326a\234\315p\210\276\031\364\223\313\370\237\204UH\245u\261'\374E'\013\362f\363\224\002\234\300\264K\203\311f\002\006\246\311ip\244\312\305l\032\226\301\202'\\~\274\327\004\232\027\336\016JQ.\367\250\210\254\fL\267\234\300\037BOw\204~I"
+	.ascii	"\251\005\007\243.OfQ\031.Zc^\"\233\341-\366\231;@$yRr\300\257"
+	.ascii	"S\317\210 H\r\271\236\214DL\220\370\r\321\376[\270\242\276T\300"
+	.ascii	"\001\240\263\242tr\"'\345T\223\025\025"
+	.text
+	.section	.gnu.lto_IOConfigGPIO.171.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"5\t"
+	.string	"\206QA< \005)\035"
+	.string	"9\335X\022\250B`(\241Y\256;\350\006\210\346\205\020\264v\247j4d\020f\305s\007\203\376\210\005\340\222\037\220\244\236\244F\373\320\350\201\310\020\325u\016\333m\357\224\002-"
+	.string	"."
+	.string	"0"
+	.string	"r{A\347\322\237M{E\331\003\330\214\210\354fwg<\371w\370\371g\271\247\345b\035\006D\354\256a\313Er\307\333N\260-\262-\0236\273#\001"
+	.string	"\354L\306\244\330\376\307v\204v\310\341{\345p\334-y\t\035\332_9\354{\254\343\004\273/\025\230\335\332\340\271]\272\336\240\3633\217\370a\017\364e\324fxK\206!.U[\310\203\302\245\255\261\001\337\362B\215f\006\022Yve\301hb\237\263\273\353\370\262\343@\314\305uZ\036q\024\022'\224)EE#N\340d\352\"EAw\240\t\013\256b\256J'\217\264\232)\024\351bv\236j\202\020L1J\336\\Q\352\315O\335s6\276\274\325j\002\013"
+	.ascii	"{\311'c:\374\f\303Y%OK\354\032\004\025\306\005#\002T\024p\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_spektrumBind.172.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\245\b"
+	.string	"6\220=:@\345&\035\005t\267\204\221'%\260\2125\306\002\325\375g`u\200;_8b\004r\360\301\222\355\226\372\223M\244\213M2[\026\371\343\356\222\240\204\021\b\205{O\266\375\367N))"
+	.string	"-"
+	.string	"-"
+	.string	"\237\366l\231\207)\213pb\215\270\314\354.\225(\367\036=\377\250\013\224\300\357q\363\260\273\216%\320\344\226\267\255`[\302v*\322dK\202\030\022\360\253\325nI\213\265\252\t\243\302\261\375h\177\345'\357,\036/\3305\241^vC\007\323\353\323\341\0174\237\327\r4\001\322\344+"
+	.string	"\250\372\220 \336D\277\205\263\033\236\"\331\363\251q\211x\026>m\216\216\370\222\031"
+	.string	"\264T!\362\263\303/\312\023\373\001\273\273\016\276\3202\b\021\251v\031\330\210\033\be\030\332\026\261Q/\203:\024\026\023\025\264\303B\365\323Q-\373\210(\250r\264\223\340m\204U\332m[\245\234p\037\n"
+	.ascii	"{\311'c\261\204g\300E%\317@\004\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_unusedPinsInit.173.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"%\007"
+	.string	"\022\21515@o\323\030\316\262\220\340:\023Q\303\016\3154\t`\371\037\246\345&\351`\r9\325\232\350X`\3726\363\365\177O\034,\272\322\022\362\f\302\362\376\315C\354\3362\005c\324\354\\\223j\200\230\256lf\233?\034\206\207\216\203\304\246\b\313\203\311Iy$\344\307\272$\207\340jb\262$VU\226\324x\253\230\215\240\314(\344\303\210\031\003\3005\224=\202\242P\234\240REfC\032\250\364\026\027P\271\017F \237F\334\336\333`\024y\305l\004}\334\260\224t*Z\331\355xq\331OR1\371U\263\366-\352\221\354@\210\343H\021\355\256\214#\252)\324V=Q\001\256\333\024\006,\354\356\220\353<\364\250\177\301\257\360\177\004\n"
+	.ascii	"{\3117c\232\363\206\305\241\025y\256\347B\356\026\354x\031\002"
+	.ascii	"\\\272E;\237"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.part.0.235.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\303"
+	.string	"\335\n"
+	.string	"\306\222E>0\305*\035@\340\207\360#Pq\177\240\347o\313\250.*k\r\2509\342\353\204\304\230\rv\235f1^\206&\306\212A\345\252\t\225\036\367Q\315f\264)\213\005\322\227\347\232\b\"\233\354\235R0"
+	.string	"4"
+	.string	"4"
+	.string	"\364&\266M*\213\266\201\217\255\275\270n\033\262\003\273[O\247\310\305O\311\211\376\351\023\323\341qIp\356\302\331]{\0377\275m\006\333\r\366!\002\273\0347\333\202P\001\256\277n\377\304\344\303\234y\231$\302\270$*\224\247\210\037\035@\263\263\225\264Z\311\252\266\273\013\247\256\336\251\307\033t\247\336\013\272\323\314\0034\226\267\204>\221\250;}\354+%o\027%\273\312\310\03795\251$\237:\365K\027\030\362)\037\366\267f\003\nh\314\223\234,O\356\334\316\020{\312\225\202- \n\317\247\023\222>\317\237\315C\204C\247\206 \t\320\023\326\212\tO\250~\300Q\335$\370\263"
+	.string	"\2015\374>\260fl\313sP3cN\226m\214\324\334\004\272\307\016@t\020\034"
+	.string	"\177\311\017s\024\213\240\265@\320\2010\220\t\030\330Q\371\r5\226d\332\002O\0012\2279WcBg\r\2241\320\242\347\252\240\034\220VR\212:\247\323B\233);\r"
+	.ascii	"\327\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_eepromWriteThrough.part.0.243.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`*\001\325\f"
+	.string	"\346\026SA\020Q\234\016H\231\340\237\003\346\021\205)\256%F\320\343\214C"
+	.string	"L\235\033w\301}\357\220\204\312\234O(\323\007\241\243\350\032\004\350\277D\340i6\3411\216\035\315\316"
+	.string	"5\234\\[\030\354H\366\336;\245="
+	.string	"D"
+	.string	">"
+	.string	"/`\235\036\264\335\331$\017O+\302\236Mr\340\303~\013@\021\210\325\216\335\255\247\022\305\275\3138=\377\"\007"
+	.string	"\n}\227\223\020\211G\002\237\037\020v\327W\211\233\3366\003\333\017\354\247\b\246\204\035\310\2523W\235\343\030qp\235\252\272\247<\225o\300ni4\"c\312Sa?\342\006(Jp\352\006\327\351CSN\275\342,\274\267\340 `m\354C'\220\224c7Dp\352z\235:\274\001\353\364\n\366a<\206\006_\2053l\361\240S\177\263N/\025\214f\3600\361\211%Q\232,\347\347\312\222M\243?'\210\n@\332\rQ\322cOP\031\250\207\374\252\037\344\322\276}\027\235\377\342!\027\t\330\206\3156\265L\34629l\323h2\313\030\213\004\n\021&T\016\263\240]\270zas\341T\214\266UK\305\031\006L\253\\\226i\225b;~\256,\371\322A\243\306Gv\220\322d{\0229Y<\310\025\017\362\013\037"
+	.string	"ze\221]s?k\367\020\304)\207P"
+	.string	"y`\204+\306\224m"
+	.string	"\027\202\301%!3\001\340\0132\004\235yU\216\250\320\276f.\301\230O\243\nv\255\251\227O7Za\355D%%\b\335\031"
+	.ascii	"\270{1\333i\021\375\2562\006"
+	.text
+	.section	.gnu.lto_micros64.part.0.247.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\324\0015\020"
+	.string	"\226\036hD"
+	.string	"\321$\035\230G\216\214]\305\003\005\222\304\302\027\027k!\362\001\026\375\226\226\215\306(\3336\364tP\004\375t\342\255\017\224?\235\260g \322\032\264u\245\2100\321\377\204\337\n@\333\330Z#\215\354\235dJ\001T"
+	.string	"O"
+	.string	"S"
+	.string	"\243\230\235\036U\214\335"
+	.ascii	"\303b\227a\353\322\226\fS\264\310\264\255O\030\205K5\221.\004"
+	.ascii	"\215\265\243\023\2233\024c\207\031\266s\210ex\031\3042<\bk~>"
+	.ascii	"\255\316\323\314\213\357\224\237\212 \241\323\314\005\347\207"
+	.ascii	"\237\210$\306\330\013\203\013\335\326@[\002m6\b\266\206\r\036"
+	.ascii	"^l\177\311\333\364\317/\276\246}\326\343\331\216\227\345x\331"
+	.ascii	"\322\263\244\227\035\275\354\365\262\242\227\265\236\205\317"
+	.ascii	"\276\227"
+	.string	"\375\263i\034\327 !\005Z\304hau#~\200@#\214\343\3267-u\252%\034wZ\212t\221F\306\235\346\310\311\004<>\325\030\235ts.\256\377\243\233\207\353\260\335\372us%6\026\336\351\017J}\352c\031\212>B\301[?\017\247z\367\341\315\221\330t\036\274\003\200\201\312\377\346Tu\216Wh\265\210\246d\260\316,\303\3743\310\260\201\202\311UE\331\256DH\237|\247\002\0222\225\327dD\001\203\004\0130\226\023\007\246\022\026L\005\245$\00531\255`#\001\232A81a,Yf\302\322/\276\246N\371#;\356\361\nm=^\022\230o\277M[\216w\364\307\033\005\016@C1n\272\330\"X\255hL\210\021F@\351\034\245\037\b\022\342T~\317mf\230@\221\036+ `\002)W\307\rz\344\343\226F\302I\333~D\216\3634,\3172\264y\027oe\030\3705\255\325\022\241\362\260f"
+	.ascii	"5/\301\316\230\326\342k\204\364s-WX\230;\n\206<\317\210]\034"
+	.ascii	"\to($\317#\254\030Gn\303\270\350\002;2\344\315k\201\312\332\023"
+	.ascii	"\333]\221\r\333n\364@\342\321\327><"
+	.text
+	.section	.gnu.lto_millis64.part.0.248.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\324\001-\020"
+	.string	"\226\336gD"
+	.string	"\261&\035|\341\353\n\370h\020\277\267'\376H\022\265\b?\310G}\036\320\036pi\377\3141\335"
+	.string	"\033c\006?\031J\225\bt1-\253Ik\320\234n \203\211\376'\274\024\253R[[3b\311\336I\246\024T"
+	.string	"N"
+	.string	"S"
+	.string	"\241\027\234\037V\214\335"
+	.ascii	"\303f\230a\313\322\216\fK\254\300\264\255G\230\004K\267\217\216"
+	.ascii	"\203\314\205\003\343\345fF\214]f\330\316\036\227!\346\216\313"
+	.ascii	"\360\033\274\371\371\266:S1-\276W~&z|R1\024\234\034~ \221\030"
+	.ascii	"c\261\n.t\333\002m\t\264\271 \366\005\f=/Po\311\327\364\317/"
+	.ascii	"\236\246}\326\364l\351eI/;zV\364\262\241\227\305^\026\364\262"
+	.ascii	"\327\263\360\331\367"
+	.string	"\262\1776m\343\272\303#\244E\214\023Z6\342\fd\341\3016n}b\245^ud\343n\313\217.\312\300\270\333\0349\2309N\311\b]ts.\260\377\241;\207\323\200\372u\354\346B\240T\030\247;&\325\251\316e\bzH\005\177\3759\034\353\335\2077\367\001\225\242\301;\200\030\252\374o\216U\337\030\305Vw\350\211\006k\3552\314\337\202\r\032*\227l\025\224m\312\203t\312\367*\0204\224\227\004\004\201\202\003\t2\225\022\006\247\021\225\f\305d\344$#9\245d \001\2529(9e*\232v\312\322/\236\246^\231#K7]B[\323+\342r\324_\323\226\364Rw\314e\370\231\341\251\001B'\266!\255\026O\204\030]\004\214N\032\335@\217\017\307\362W\274\346\206\b\225\350\001+ `\002)W\307\rz\344\343\226F\302I\333~D\216\3634,\3172\264y\027oe\030\3705\255\325\022\241\362\260f"
+	.ascii	"5/\301\316\230\326\342k\204\364s-WX\230;\n\206<\317\210]\034"
+	.ascii	"\to($\317#\254\030Gn\303\270\350\002;2\344\315k\201\312\332\023"
+	.ascii	"\333]\221\r\333n\364@\342\321\327><"
+	.text
+	.section	.gnu.lto_delayMicroseconds.part.0.251.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\235\n"
+	.string	"\006\325G>0\247*\035\220\313\201\305\353\223\335q<\360~\337\331~\bICAC\353yD\025\256t\021\214n\026c\002\330\222\2536\213\216\2016Q\341 \250\007\346}\022\003%\332@\227\f\355-eJ\0015"
+	.string	"5"
+	.string	"3"
+	.string	"\207\2303T\016\337\027*\207\366Ql\223T\336\354\005\347J\366\003B8`\016v7\036*\311\267k\276\315/]\023V\036O\205?\204\315\356:\373\270\341\375`_\"\252\351<\367?kp@\260\333\321=X\021X\340\304\366\355\277H\366\345rh;\363\034\351\256\321\343v\245r\246\375\224\003\330\356\032\331\262;\" \266\313e\016\035\263\372\364\250\003\247\354\354\0078\314\004|\023\213\034\313\247\016}\307*\207\252\026\220k\352_\177\006\0240@50e\227\332\262\276\277\335]+\313~i\250\351\247\351 Q\272\243\211\240\200\230\210!O\205\306\tE\f\013\316E\354h\240\250\301\370\223\341\321b\350\363\321\342\345\312\362\306\244'\253j\313v\226Pm\rP>e\314\206\226\374\024j\006\225\300\224]\024"
+	.string	"{\345w\215\0058g\340\327D`\363"
+	.string	"\207(h\006"
+	.ascii	"\310\003#\324\025\360\f\207r\366\231\235\013l:\357\\\0268\361"
+	.ascii	"@\216\226\246\255\210\372\340\340"
+	.text
+	.section	.gnu.lto_delay.part.0.254.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`p\001E\016"
+	.string	"&\032\\C\020\257&\035\203)P\033x\3570B\324\200\201\001\331}\230q\375A\020\001\257\016\033\020\363\017Cl\177\336\037\321\216\326<b\006\375\354 P\225;\n\002\241\353\020r\211\004\250\240\3431Nz\244\326\366\2262\245C"
+	.string	"I"
+	.string	"K"
+	.ascii	"\207\316\256C\215\017\330\034\276\013\330\034\332\347`{"
+	.string	"\324\231\263[<\252\354eP\245\024kw\263C\315p\356\232\217\363\323t\022\271^\365\307\262j\231N\026\236\001\3768\235\335\365u\341\206\267\235\3006\002\3734\001\241\277XM\314l\330],\224\376\207\221\2572\3462zJ\224\031qM:\037\304CpO\211\276%\035FI\006\306\305n\3348\264\201\353\320\361\302\234\3718zK\310\213{\352\234i\277\303=po\t1\306.\212\006\022\273\261@\251W=W4\245\027#\331JM\261\276\277U\f6L+L\347\343\377\r\201\216\232\335\n\255\232=\201%V\356\362\354FX\324!Q\230\360bV(P\254%\211\033!\2132\242\212\311\201\023\021\305\332\215\366c\340L\212\2138\214\2159\233\346\331@\020\004\222\366\340X\320@\001\203l\373p\240y\266\f\302\003\017H\346\241\2012\016\r\177\"|h\331\366\371h\031\366\316\210\222TSl\353\312\212\227U\024_\251jK"
+	.ascii	"\345M\3568!Q\021sT\034\300&UUY\224\260\220\262\345k& \200\202"
+	.ascii	"\2315\027\007\273\363\007\265\360\271\225\021|\024\bX F\362|"
+	.ascii	"\204\035C\210\006\257{'\007{\302\bL\003\344\203jB\341\fb2\350"
+	.ascii	"\304\306\355>|\3542\r\377\020L\346\265{\"qr\367\310t\336g\326"
+	.ascii	"\002\313yaY\200\342!\2470\\z\355\033\003"
+	.text
+	.section	.gnu.lto_motorPwmDevInit.part.0.262.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`r\003-\031"
+	.string	"F,\236K\260VU:\362\024\336\237\274~\222\260\223H}7\034ek\203\301xix\360\372\202\017\366\2179\227\354\361V4^\253\204\205\266f\002\nde\310X~\342\372\016\2578|\037\322\022b\023\006Ov\\\236\225\331I\007B\310\336{'\031\206"
+	.string	"\206"
+	.string	"\203"
+	.ascii	"9h\217\311\271'>\222rN\025\034\267Y\036w?X\353\333\200\324\005"
+	.ascii	"\t\336q\034h\353\233\r!\204[\241\372\035\001\261\343)\347\324"
+	.ascii	"<\356\3643\343qy\231\361\330\266\350\372\233\276m\275}\304\327"
+	.ascii	"V\362\326\257\273^\320\307\027\037!7\344\264\353\2318\276VH4"
+	.ascii	"\342 h\343E\252\207\253\367\316\300\230\361{\351\t]\004LE!_z"
+	.ascii	"\025\321\323U\353\362+\361*s\222\304\3119wy\342]\276\273s\335"
+	.ascii	"\375\323mi\001J\277\216\037\351\007\362\333\375\276\220\007\351"
+	.ascii	"/uJ\251\326\274\244\017\261\235H3\251ti\356\221\303\021L\200"
+	.ascii	"O9g\f\345\261\352^f\024\276/\254\365w\334\307\213\235\002\362"
+	.ascii	"\343u3\212[I\201M?^O\013\370\222\200M\023J\244\332{\304T8g\242"
+	.ascii	"\313\343D\333{\304jL\326\345|\020\312\343\230\252\343\303\231"
+	.ascii	"*\310\005\315q\343\372\341\354\001r.zjP\332\272S}\353\323\266"
+	.ascii	"\271\251\245y\210\327\267v\333\334\330\036Fm\251\2204\277\271"
+	.ascii	"Q\253\275\025\321o\246\361\266b\031R\321U-m\177s\316\331Z\243"
+	.ascii	"\356N\360\333j\177\236\214\220\362\301\227\253Q\375\277\306n"
+	.ascii	"\237\037y\021X\320\335\036\336\304\202\231\222sfP\344F4\364c"
+	.ascii	"\034w\013\255\337\035\367\321\361\370K?pD\244\341\003^\301\325"
+	.ascii	"\250\266\257B$'\026\325\032\265%\377`\r\242%m\213\032\337\332"
+	.ascii	"\367\351o\353\225\336\007p\177P0\276\234\207\242\2402\021&\""
+	.ascii	"\343\001\035\316\036WN\213\203N\317\271r\321b.\013gl\366r\306"
+	.ascii	"\200f:'P\017k\307\305\207\225\301\225\222\271f\350\003\030*C"
+	.ascii	"[.\275\252\221P!\207\202);}`<2\323\305\342i\231+X\314\254Q5\272"
+	.ascii	"\341\204\2312\024\205\231\251\333\242~\361\002\354\021\261\212"
+	.ascii	"\017\2303\356;\214m\343\340ln\274\360(P\310#\"\024$\357\336\271"
+	.ascii	"\223W\223\363P@\331\270b\273y\356D\233\271\222/Y\235\267[\361"
+	.ascii	"\006T\020\201\276`\nl\223\330kI% \2660\305\250\222\345\332O\250"
+	.ascii	"\241DC\2202\006\231\210\310H\n\223\026\003P\002A\n\3536\020h"
+	.ascii	"Y\224\264\006R-\265\354\354\343\016\373Z\242\206\206\235\276"
+	.ascii	"\370\305\207\300\002\004S\026\244\317\3302E\270=7b\354\214\375"
+	.ascii	"Ia\265\033\037WW\024N\276\032\220\221L\247\367+b\3100\\\201\363"
+	.ascii	"0Kh+\216\270\200\200.\034 \267\264 \326\200]H\231\242\002L\273"
+	.ascii	"\016\273D\231\306G\021v\037\r(]\267M\224v\251g\370\231\302\n"
+	.ascii	"\340\002\020&\363\245mgk\312#\375\177NtA\037V\311BW\350Z\177"
+	.ascii	"\242\207\221#\353\332\204\371\221.\223\225\365\023\323\017"
+	.text
+	.section	.gnu.lto_simulatorLoop.part.0.265.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\377\002\315\024"
+	.string	"v\245\202H\320.'\035\2523\212\312\2503\033Y\203C\0344|1s-\022\271\351\307!\317G\3568\031\214\363Q\356\276C\263-Q}\335:\241C\207\026=\341\2045\004\220\013*\224\361\b\200\031\3105\002A9\253%\331\266\211\334)\005e"
+	.string	"s"
+	.string	"m"
+	.string	" \340\347W\343\363\217j>\222ac\355F,\222c\334\233\333G\303>M\364\"\333\215X4V\305\336&H\350\202\325\356\330\361\351\020\374\364\370\001\255O\360\002Z\237\007a\273v\263\315\206\361\021h9\204fd\222z\273\033~j\206\333\256\362\263\371-\327\227\r\316\345\306?W\310\356\032\314\271\347m\027\260\215\300V\230\0354\213\034#\320\315\253\007\347b\f?\257\273\313\276o\3429\177\352TPO\342\214\223TT\024\313\2678\215\205\311\235p:"
+	.ascii	"\376\310\207z\022\345\326\360\354F\215\217\220\216\001\220\304"
+	.ascii	"\235l\230U\236\263\332\360\202\254b7\371#\\%x\2743]\347\357\f"
+	.ascii	"[\252\321\236\363\254b\361aghwa4\177)\304\223hWZ\371\0267.\016"
+	.ascii	"\254\007"
+	.string	"\327\033\352\355\336\002\252*\257b:\274\250\324\313\314\270\316\261\357H@\256Z\325\304\333!*r\221Y\016 /\342;\023pwO\343q_w\"A\236\306\337\375\245\344aeXU\320\026\251?\326\357\337\252\217\r@\272\005JO\227\364\007J+(-]\322\207I\235\016\254]\013YX\3133\2378\374\350\237\372\245\344\355MGa\021\350\3469&\246\241\336\302\214\001\021FdlD\2123)2\020\305XJ\313$\037\013\034(h\020\316JLd\261YH\341$6!$\221\211\341\007\001\243\244\224\310\302\031\n\212,\224\377V}\034\342\242/V\325\037\333-\365W\234'\372\033\374@D\236F\244\365y\244\177T:S/-v1V\276]\f\t\256\373\255\220d\226\247\252\266\364\273\212\331\371tB\370n\344S\017\r\232\342E\316\376\325\222\001? \240\002\031:\223\007\272\363\205\022#Fk\230\327L\264\261y\227\325"
+	.string	"\f\267\016\226/Gn\357\345\266\334\032a\013\362\364\220\271\233\033W\261vS\344\316w\264\343u\327!\256\303\246\364\344s\035x\343\226)\343\374\214\375\304p\310\2144\303>\216\217N\254\304\322&\352\251D\204}\b\325X2\031\361B\374z\300vo\331\276*\002!\272m+\265\013.\230\020\327|Qu\200E\230\304\274\242\262\320\226\262\324"
+	.ascii	"\270\275r\243&\372]f\f"
+	.text
+	.section	.gnu.lto_simulatorGetMotorERPM.part.0.266.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\005\004\325\032"
+	.string	"f\261\252H\260\230M:\261f\312\251\322\354\031\310xT\030<\374\327=H\202>?\031-\240\375K\235I$xJ\255\355\267\330t\020d\331u}\202\313\332\205&\n\017\316\177\r,\334\303-\314\003\345\351\342\36415\206%d\023\271S\n\220"
+	.string	"\220"
+	.string	"\235"
+	.string	"\365\250N,/OR[\265\326\234S\363\274n6\314;_z\207\307v!B/+\013#\357\264wxn\027\"\344\2555\t\211U\255e\203S\223\257S\373@lF\266}\037\377q\263\201a\351\343\021x\nR\364\343\252\265\222\2478\277\021O\303\017\020O\327\306o\027i\270s\274\371s\307\033\272x\240\227\344\311\216\367\342t\251\272\204\377\335B\217\352\311\216\347\342\233#\022o\230\2007jx\272\235\002>\216\025j\255~\301\270_\267M\263\235\301\016!\004\376\224m\233\326\334\325\005\247_\234\334\354\362w\356\177\247\275\251`Q\027n\006\347.y\307o0\030,\343\255a"
+	.ascii	";m3N\303\306\351\032\232q\372\265\323\2438-\212\3234\334\235"
+	.ascii	"\236/\377\017\230H\021\314\324\312\"h\246*\321%9^\344Gl>\021"
+	.ascii	"\326\030\245\357\350=$[?\270j\256\314\261\324\215\240\360\t\003"
+	.ascii	"\245\357HBT\2310\\\265\226\344\251\313\327\264o\024\207\262\007"
+	.ascii	"$2=j\255\260\373Cl\376\317\260\"6\343\344\312\332dt\"\256z\035"
+	.ascii	"\022\370j\315=\320\362\254\017 B\204\020O\351\336\n\211\314\323"
+	.ascii	"\022\334\fz?\201L\300&\232%\246\223\205\345\n\220\002\237\025"
+	.ascii	"\021\341\023\223_J\f\2170\300<\324\253\304H\337\224S\351\361"
+	.ascii	"\211\305\304\323C=\n\220\202\254Zq\337\371W\207\362\3437\235"
+	.ascii	"\232\004\320\374\356\324\007\222\315\346w\273\363J\314\016,\025"
+	.ascii	";\344W\335\204\023\326\320<\343\375\231\200LNv\227\354&>\360"
+	.ascii	"L\224\2448U\245\272\300\312Wb\255\327\205\304\252\227\257\032"
+	.ascii	"\375J\365\351\312\211\312\266\326\016\022\230\036\265\016=\311"
+	.ascii	"\001\036\241C\233\325f2\362'\250\200,\210\266\264Ym&\243\366"
+	.ascii	"\321\301\300\341\302\006\262\026\373\241\365\324\310\022$zd\244"
+	.ascii	"\017\315\004\251\203\343YP\214F\326f3\032\t\263=\037\326\255"
+	.ascii	"\341\tQ4pP\233\267(\222\021d\346\034\300\022\371Sw\205P\334%"
+	.ascii	"\2173\240\302po\242f$\355.\315\256\260ak\263\327U\301U\275\327"
+	.ascii	"eHY\253)\004\203cr\265\342\020\324,l\307/4\373\332\232\275N\307"
+	.ascii	"\270\257\235?\335\226\270\343\276\250\213\301\351\212;\376t]"
+	.ascii	"D3\230\342\\48\200`o\370\226R\250aHc\2301\310\230@d$\230 \303"
+	.ascii	"\315\001\220\002!+\333\034\021\300\265\2033\211\2265\356\333"
+	.ascii	"\365W\325H\f%\035X\207Z\362@\227\370|\302\"\201\274j\260\003"
+	.ascii	"q\341bQ\204.\033\\eY\0356.\237\036\351~\356\200:\375h\031\203"
+	.ascii	"q\365\3070\334\302\357\307nTQ\007\210\210\300u\302\203\342\204"
+	.ascii	"ZD\005\003\376\020KO`\"\335\202M\026\271\306\261j\2669\27093"
+	.ascii	"\320\326\261\327\216J\\\006p\201k\\<\241?\363\253\255\242\237"
+	.ascii	"\365\375\002\213}/\331\245\227cR \"\025\254\267\332\275\005\313"
+	.ascii	"\260\223\314\271eq\321\177\311C\003"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.part.0.267.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`t\t54"
+	.ascii	"\332Y\370\023AP\250Q\007\227\323\314\240\bE\317\225f\364J6\217"
+	.ascii	"\353\306\350\203\345\341\312\247\002|\223P\371\032\211\244'N"
+	.ascii	"\354v\312hu\206\250\323\304\313\317k\225\305M\034\377`\364\336"
+	.ascii	"\271\241f\271\333\336[\246\224\002*\001\034\001.\001\256\306"
+	.ascii	"\337t\247\255Y\213\212f\026\366\226\2572\205!\335i\b\246\320"
+	.ascii	"&.F\217\334\2437g\327no/sj\373\032w\323\206\315\221\315\261\311"
+	.ascii	"\352\310\211(\232\027\r\256\263j\314\216fG\253=\323\f\256K\273"
+	.ascii	"\035\215\223u\367z\210S[\310SP\231\234so\310\267K\215\264\217"
+	.ascii	"uO\314\210O\213<\202in\222e\306\317\274>-\262f\255in\302\353"
+	.ascii	"J\273\023\366\226\363\224\202\263\035t\235\355\251\033h\235u"
+	.ascii	"\235@\353l\317Y\217v\267\221\254~\273\331|\n\315\b\242`K\262"
+	.string	"\267\234s\320Y\234\305_\367\365x;W\327\262+\376\244\267=\351\276\006\275\365\207\246\266t?YSV\006X\250\3009\230\254\255\347a>w\302\300v\356'K\n\230,\347\273\272&\023]{\326\302\340t\272\2461op\245\311\024o\225\232\313\365\227sv7\312gW\334E\306\375di\255 \"\245\251\3515\261~\3455\2358^\027\374\3313F\251y\265:\230b\205\215\217\371'iZ\375\017\360$]S\316\271\275\352\351\255\344\335\315\247\333Et\273%\002o\030G\314EK\204^2`\2562\b\320Y\247\372\2407\352\276RW9|\317\204xg\256\370\247nT\324\260p\373\037\007\324i\"H\220h\235\3651_\022c\363\302%\325\302\253\202\347y\323i\333Q\264\216\333\311R\254xg>v2w\tI\267\020\265)q\262\261\177\323\217\222;\030{uw\221\326\361\256\017[\030j\241\253\207\324\b\364\274`"
+	.string	"\315Y\351L'W\t\003(c\006\3767\267(jW8\331~\307\363\324"
+	.string	"\362\004\364\326\036\241m\257\343v\"\264\177\265\215\0337ZgYElU\270\302\032U}\265\003\274S}\216\320\315\271*\216\313yj\377r\266\241\204\357La\353l\005\357\3461|g\266\2179\257\214L\033\\\033\026N>\366j\234\344\270Z\255V\033c\351n\277\007\360\276\005\354\276\003\270\337"
+	.string	"t\337J\355wR\373\355k\277{\274\366{\327~\273\336\306[\307~\267\3557\333~\257\3547f\277\337\305\274\335\302*e\002\340\312\231I5R\256\302\306\351\342b\356m<\030N\2425.\351\327\016{!r\037&\372\360\363\345~\313\335\336\351\303\330\314\215\221\332\207\247>\2247\372a\215\372N\220\214\n@\035\271Jw#\300\314M\221\2322\301V\031w\301\222\2700\263\214\257\364\210\367\263o\276QO\303\004\t\347m\\_\3108W\351P`7R\016YU*I\366p\207\347#\335\207\3679\327a?{\346\033\3652\250\237\375\221\027\353"
+	.string	"t\351*\207"
+	.string	"\221\274I~\315\215\216\332\322\253\213\026u\265\330\253yX\207\261X\242,TB\034~\207}\316\335\217\255\237\375\325\353\\\360VL\336\346;\223\207\177\313\317;L\343\331h\303\177\316\336h\255W\375\314#\275\316\002\320\234\253 y\334\373\344\215\362:\235\355\326\373<\232Q\273\360\256\225\267\353\221\2131<\331\300\264Z\254\303O\266\234\263\360l\226W\313;\263\305\277+\234lF,\326%\331\016qI\265&\374\257\270\373\345\362vy7\356J\312\242U\340p5\020\2402\026{\265n\r~\f\\\202\235\375\353\235\326b\234\244\330\256\030'\331\376\254\270\335\220\037*\276_\3360\001\315+.\375:\b\215C\342\261A\363 4\205#n\236\361IH\204\222\320<*\343/J(5|\332\361\240y\301_\224\324\322\317\303OHdX\374U"
+	.string	"\026\227\200\277(a\324\023\225\324\357\206\017(*\251)\0318N8\205PQ\302\006SS \342\236\032\352`\372AE\004\"\024\366\332i\004\214\0263p\304\220!\002\307\212\0260\\\220 \201\343@\367`\3221\224\2122\026\203\302\250 RPS\303 \261\030$x@Hd\350$\305N\2711\b\024n(&\0251P8\005\215B\036\304'cpj\370\364#\bE,\006\231~M\005DH\f\032\251\250\210\301\236\257\031c\351n\252\302V\215}\3159g\337\210\027\200\235\372c\220x\320\\\345_\001:;"
+	.string	"\314"
+	.string	"\274\323z\361\001\370 \373\2743\005\340\337\325w\311\321t\274\347\264\316\006\300J\324@l\244\260\370nd \344\240\326\231"
+	.ascii	"\260\237-\317\274\301\265Y\371\006\231\351=\226+a\"\265P\212"
+	.ascii	"\367\341\307r\237\373z\235\356\026\244!$\242w\246\022\36657\271"
+	.ascii	"\rr\320\327Y \213\233\271\305IQ\302\233\213\204\345\n2\221\""
+	.ascii	"W\351q@g\223\250$\341\200\266\250a$\007\2312H\321H0#IA\222\016"
+	.ascii	"P\002!c"
+	.string	"\256\252\016\021`5tf&\2106)d9P7\325YS\260_k9F\344$\230\264\020\276\246\026\177\2724\271%\253z}\246\366\301`\245M\221\tF\243\230Q\270)\177\217J\222\217GY8\001\0246\237\300\321\220\262\335\201)\210\321Ac\022\t\215\216))\023\263\333\034\225E\261\213\374\320\300\035\203\313\320)\032\004\331z\264\311~\214A\363\222\022hy\345$\030b\205\303\251\007\273`\302\276\322UT_\3532\020k\261\026\233\352naK.\223\276\003)(\361\017D#-K\0340I\007\316\333\250\3179@\224\251\2464\201=\267o\013\357\002\b]\206\233]\\\f\n;\372\245^\n\253\320\342\257}47W3$\024\306O\240\202\216\t\232\021\330\001c\305\207\024\b\362\205wO`\271&^\364\027\201\263]\243\223p\276\233\363Zr7Eh\217\001\342\037\005\341j\321\311#\021uD\346|\276\006\330\177\351"
+	.ascii	"a\256\240G\255\261\262\375\307\315\362\306<\272\n\352\223\372"
+	.ascii	"^\312\375\362\222p\331\356\272\330\316\373\007\b)\"\315\312\335"
+	.ascii	" \312\342\235\2045\275d\261V\nF\375\301\021\024p\237\247O\222"
+	.ascii	"P\271  \204W\tW\020\b\260M\277\374GC\264x\033^\003\373\033\345"
+	.ascii	"s*4\354\304\002\003\021[\016\300\310\335\230a\204\234\301\261"
+	.ascii	"Y\256wz\230|V\3174"
+	.text
+	.section	.gnu.lto_FLASH_Lock.part.0.268.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`V\001\r\016"
+	.string	"\206\231]F\020\221\223\016\030\242\220P`To\246\372>\002"
+	.string	"T\307i\210\005\335\243\270\243\203\bV\212\245\351\016\204\320\326\3434\013\261\266\264\026\320\344\264\261\202?\241\007\201]\n\2038\313\232\202\320@\361!\024K\277\355\275wJ\001C"
+	.string	"L"
+	.string	"H"
+	.string	"7\300\371\264N\200\363y\377+\331\327\365y\025\266K+\366\354\033W\231\330\003\337\007\025\231\034\273K?c\211{\217Pz\376\277wL'\223\307\217\023\313\341\200K\017\b\273kK\304=o\273\201m\r\366S\004\227\362;\021"
+	.string	"\265\013\342f\307\216\2305P\274\346\2479\264\357\323\034\306\2579\f_3\245\230\222\377\3711\237\361\345\342/\274\313t`\001@\302\206\306\212\003\353\363+\300,\256\362\336\302\203\334\026\325\206\270PlV+\026|\232Z\237V\0056V'\021%F\027\333\027|D\360\002\034\006?\314g\200\276B\275\354\246\334\024\262R\036(\370\264+\007x\2231\225hb?\306e\224\370/\356H\360\246O\237\024\343\tG\n\365\265\234\300\033\030]\034\345\345\306\224-\241\003\376\020\321@Y%\331H\330\250nX7\202\205*'\3224\f\003(\253\236\f\023B\"x$\\HPR\267\330Y\020\321:\321\207D\3538\003\361T\240\020BG\332\006\3563\242\333\310'D3\256\243 \230\253H\343\350\250V\216^\266\341\345\306\224-\035\001\037"
+	.string	"ze\331]\326p\033\r0(.\254\340\001Q0\314\025\316Q+\364P!p\335\023\037c\260\203\226\201Au@\006\234\002c\300 hBU\256!.T\005\313E\265\323\271\240M\227\235\013"
+	.ascii	"'/\346\235\226\246\237P\306"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.part.0.269.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`!\001U\r"
+	.string	"\206Z[B q\223\016\203-\"\210\001\211\360b\004\361a\372\021}"
+	.string	"\344\320\034\216O\0074\023\343\2700_\326,\332wn\264(l\351\233Y$\002r\030\342G(;"
+	.string	"\302\034H\263N\177<\202\035\362\311\336R\246\024I"
+	.string	"D"
+	.string	"H"
+	.string	">\013\310\332\343D\230Rl\373&~\"d\315\301\311\310\204\200\205D)\305\216].\036j^\240:|'P\035j\210k\327|\232\237\233It}\352\rH6tl\246\016\317\001\177\037\"\273k\313\303\ro;\201m\005\366U\002\177\253(\273JC\230~0\255/\235w\371\217\311S|\331\335\320\275\254\n|Q\302~\ndg\354\220\235\261\346]@o11\300-\207\024k\332Gq.\364\026\223\013\330E\311p\261\313\0358t\264\016\315Y\016z\224\023);\373+\316\002\304\037\341\013\313o\207>\246\237\323\f\036\037F\3319@^\305\2576\207\004\003\016\032'*2&\255}I\365\356\206Q\245\332\235\013\371\315\032\024\025\371\232\372\324\031\200\250\321\225z\214\262K]\261\276\036\317&\033\031Y@a\303\271\""
+	.string	"0\026\002a\302\003\t\361\263\341d\327'V \271J\"\226yb\210\306\035\013\233,~:\235,fl\347\337*\312O\375\032J1n\344\273VA\315`\033\252EFJR]\261\375\264\305\267\034?H\245\372\002\027"
+	.ascii	"ze\211vm\366\030\212 \020J\361\030U{Y\226\261\t\312B@\024\fs"
+	.ascii	"\205C\324B\227#\024\022B\347\274\223\235\366\240\335\257\204"
+	.ascii	"\334<.<-Dj\n\315K\257-c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\002\026]D"
+	.string	"jjx\026J\220\322N:\212\002,1\202\261P[\204p71\372\364\025g\265`\342\335\315\344]\207\350\363#a'\210\231\006d\032\251Yh\b"
+	.string	""
+	.string	" *\n\n\b\""
+	.string	""
+	.ascii	"\200\200\301\305L\02429^B\302\004\250@\355w\337H\2027I2P\001"
+	.ascii	"B\001d\001^\375<\036\f\307r\034\332\365!\\\374\206\316\244D\253"
+	.ascii	"\255~\361\204\021\302\302\321\241\331\003\217\241Z\354\265\243"
+	.ascii	"\331H\0263\261\330\f\325\301Ar\364\217B0\030z\325\254\304\252"
+	.ascii	"9\311\211\336 a_\325\334\304\321|w\336h\266\273\215f$\0348\211"
+	.ascii	"~`\261\247\304\253\032\315GN\032\315s\032\270\214x5\243YNF\237"
+	.ascii	"<'U\237;g\214\267\200\361u\352M\250\204\037\373.\325\247N\324"
+	.ascii	"\333\320\333\327\327\267w\250>s^p\213>\365\211\203u\3038\344"
+	.ascii	"N}\326\234\252\225\213\376\223\263\305)<\016\300\332w\321t\246"
+	.ascii	"c?\t\004V2\261\017\324\330\3679\0370\022u\300d\007X\364\353\226"
+	.ascii	"XM\211\331\222x\b\332\200\327b\340\254r\216\324\037:\217\370"
+	.ascii	"\307\213}##v+b D\3346t\032\007.t\033B>c\300B\202\256\342@\375"
+	.ascii	"\242\037FC}x\271\202\211\240=\234F\264\272]=\346\316\323\027"
+	.ascii	"\332\341\036h\205'>;\020\315EN\236\271\316\211(3\237\251\326"
+	.ascii	"UN\177\305\211\323\357\271\351\363\330<Ek\256\2424\375\035\265"
+	.ascii	"\257s^\346\253\304\253x\r\232\366sf\3728?b\232jU17\363\230\317"
+	.ascii	"\001\020\211D\342\211\375\233\223\231]\236\004G\204\370\236\003"
+	.ascii	"\274?5]\271oU\254\334\253\277_g4?WWn\t\232\225+S\263rclV\356"
+	.ascii	"R\037M\251o\225\324\347B\352\3538\352\357(\366\263\214\372[E"
+	.ascii	"}0\242~\330P\037\210P\037+\250\357\003\250\257\365\323g\372\364"
+	.ascii	"\341V\364\333\236\376\033O?\271\323\317\241\323g\313\351\023"
+	.ascii	"\301\351S\335\364\335l\372r5\375\0364\3751\265?\247\242\017#"
+	.ascii	"\355\307\230\351\227\235\304\376\262\257\237\366\244\177\303"
+	.ascii	"I\277F\223>\016&}%__l\257\217\324\353\377\310\353w\341\365\331"
+	.ascii	"%}\036J\372^I\372_\304f\377\352N\210\332\365\327N\324\"2\033"
+	.ascii	"@\322W\373\221\2630r#Z\244?U\327\227\242\353G\315\365\241\344"
+	.ascii	"\372/\230\375\2473\256\357\004\327_:\231\274\355+\275\365\223"
+	.ascii	"\334\372H\207;\252e\275\255\017\304\326\377!\322\267\031\362"
+	.ascii	"\231\273\032\252/\3734k\315}l\006e\026u\265\346'i\315N\320\232"
+	.ascii	"\233\b\3513\231\340\246\006\365\263f&A\232\371\314\232\367\200"
+	.ascii	"4\353\235?\232\363|4\343\235\"\370\013-{\225\3623\310.\343\034"
+	.ascii	"k\246\353\321\274\344L^\210\330\317\302\372z`\034\206\"\037\344"
+	.ascii	"\353f\0017?2\362\016P\177\306\t\315@\275)\310%\310%(\030\324"
+	.ascii	"\342b\n\253\305\310\017$\306Kj\223\372\017#/K\3723\316X\204\016"
+	.ascii	"\330\256\254\016#/P\035bd\213\024\363D\355\3178\032\305\262+"
+	.ascii	"1\362\246\254(9-\337}\345`q\034F\336\022\310+\343\302\211\221"
+	.ascii	"\354uc\230\307\21592\313\305[\274"
+	.string	"\305[\367\267j\370\023\237\235\362j\013\r7FC\206 \fW\306xAx\241\311\302\215)&\r\205\034gxQT\243\341Ea\227\2067ee1\274)\254\212\372\333\007\327~\235ixUX\365\357k6\233\200\354qx\201\355_\220\252\2564\274,\355/\325\262\032\207\267\205\375\313\321\316\213\2067\250\022\ro\220\035\032^\027\365+\314\254\353\f\357\325\243\b\2072\203\nr\244\bE\bw\004\214\203\233\222.\020^\224VGxQ\326!\341\375\265?\215\034\230\223\023\t\357o-\022\336\263?\177\334v\320n$\2742B\013.\360x\346\203B\242K\240\340|L}\310\007)\2701\007\220\340\252\260\377\341\330h\335\247\200\200\031F\343\177\324\216\274\360\200\005\356\217A\230\213b=\001dZ\317u\202\327D\273\023\274$X\236\340}Y\317lU\027\321{\202\227E\235\371\212\340\r\256\377\0319\231\375\006xU\332\252\343"
+	.string	"\003\334\204\t_SG\334\327\217\\B\336\273)\352_\263\354\002\202\242\256\274\027"
+	.ascii	"(\350G\336;\253d\234%\177d\275{\256\377k\354\251\306\005\326"
+	.ascii	"\273)n\1771\031Ge\201\363n\312z\\\213\234wK\374p\236\334\216"
+	.ascii	"\246\335\220\361\212\264x|\336\304x\367\251R\004Vr[\350\206\262"
+	.ascii	" p\363\266\244W\021{c\245\033\f7/0-\2402\275\310\315;\202\231"
+	.ascii	"\334\274?>\340\273\373\343\252c&\327\335\247\214\306uw\304\t"
+	.ascii	"\314\244\345p\300u\027\001\335Y\266\244\315\310r<\007#g\211\r"
+	.ascii	"\206\347\356\217L\226\273?5\354D\314\274\207\301\3148\270\373"
+	.ascii	"#\032\267\367)\233\361\233\333M\241~\212\227\367\004\027\257"
+	.ascii	"\361\362\222Xwxy"
+	.string	"\r\250=\274|\221,\034Y\347\341\345\375\265g\2462\313x ^\336\r\274\266\\C\273\b\314\256\213\362\272(o\360\207\225\267\005\230\302\246\354\305\312{\226\354\216\370\313\230R\022^2\331\215\371}\253\343\002\273\024\223\335\026\252\244\322\237X\001MyO\333\027,\313\312\242\0369y\226m\331\t\035\212\223\027\310\365O!\331\ncd\373b\304\246\"\026\206\365\027\355\312\246\200=\252]Y\0245\212\223\234\344\344\225I9\311\311\373\262\276\350\306^\354o\237\232S\201\222\250q(E\2613#\"\"I\222\244\003\201\005\204)\006\231\331\034\021\260\234\203\322\230\021\031\021\021\tB\322\001h~:\233\365\235O^\267\b\307]\352g\"=\333 \246X\275\031\350OT\f\210\003O\320\202\317M\240O\f-s\377D.;\262^J\321\005Wj+\363D\223\222^\211U*K5PfG\2117\220\207\025\305F\005\235\333\220\001"
+	.ascii	"D\330s\244\275&\034\020q\370=\310D\3767<D\342|p\217yt\335\016"
+	.ascii	"q\364!\316\004{\223#(F\3446\224\307\222\004<\364^=\227\327\200"
+	.ascii	"\237<\360\331\226\fT$g\231\303\372\027\374fK\235&\016\3368\n"
+	.ascii	"\365e\234\321=\236\2110a\303\237\227\312\n\300\276\2276\003\273"
+	.ascii	"\344\304r\210\344\300\n\334'\340\314\001\220>Ka\001j\264\017"
+	.ascii	"\362\260O\206\362\311\020\231\330(\226\013_\\1\230\241<G27~Y"
+	.ascii	"~\204\302\035\352\252;P\214)\340\027\034\360\356\024\243.\037"
+	.ascii	"\276\303\250\237!Z\023\207\270j\242\247\347\271\267\346"
+	.string	"VC\f \200\322u\336\235\244uh\013\363\030\310\235?D-B\243\035\243\270W\rR\243\212\323\001\224K\336\342L\254r\020K\305\260u\270L\224R\0038v\237 d\005 \326\320\340\365\205\0215Mq<q\373j\027X\001\273\256\177D\232\212\311Q'II\022\343\361\211b\305\001\200u\003L\200\375N\004\377\244\223\340\252wgt a\314\024\215\321\317\3349.O\217\216\374\325\316}\356\262\277\332\271\317]\366W;\367\271\313\376j\347>w\331_\355\334\347\353\330\257\354_s\356\273\225\375k\316}\217\031\033\3069\b$\340\022\242\303K\322\210\216\237\017LJ\375\352\017\267%\214\354/^\247;\311\254\316\353\206\344Jb\334\320\373 }\2154l9\213\256\377_\337\354\007-\226\331\027\213J\340\320\272\rZ\236\211\033\355\034\177\027-kg\020\272\365\206\227hY\240`]\024\037\366\034W\264\275\\1r1&"
+	.ascii	"\251\272\372c\361\304=!\207\257"
+	.string	"@I\302\375,\211\366z\255zd\020\005\212"
+	.string	"pN\230\016\232\243\242\022\272\330>Q\311\021s\322\270\203\322\256]\3746J\037\035\214\332\255\361\242\304\r\353...\304\272\004G\007\031\324\365t\356\370\371\\6i\324t\371\237j\t2\3514\013.\006\330y\304\373\260.\243\nV="
+	.ascii	"\364^\364\327e]\031\343*2b?E\246M\304\311$SvE\222\306\237\324"
+	.ascii	":\334/\203\\`\206\256\371\322\333y\330\0317\036#\254\267#:\316"
+	.ascii	"\363\346h\0026~\357AGuL\025\346\373\336N\354H\327\0275o\n\024"
+	.ascii	"\345/:h)Xg\244\315\205]\226\005/\002\361*\321\003(\260#\222\006"
+	.ascii	"\335\217*D\323\240\246}>\240\250\001"
+	.text
+	.section	.gnu.lto_.refs.1f5243c49cc38346,"e",@progbits
+	.string	"(\265/\375`\272\003\335\027"
+	.string	"6;\241F\340\222(\3510\314P\231e1S\305\215\b\314\240\025\"\2461\032c\2141\306\030c\214qC\231\251\222\bu\003H1\244\016S\310GD\fO\025\004\033\323\037\261\251!\364u\210\217\376o\250\326\206\376G\373\255\221-S\214"
+	.string	"\212"
+	.string	"\215"
+	.string	"=\262zz\337\321wU\325\350O\370\036\223\317Lz\f{\303S\332\0179\351\007\371\341\243\007\017\0358vrj\340\3048\371oL\376\027\250\277\206\306\305\f\370\313\200\257"
+	.string	"\374\003\340\027(y\001\340\267\300_\201\037\236>e\312S`\376\225^+}\267I\254U\276gy\257\032\365\224\327M\274\357\274.\"\351\310\266\326-\352\311\035*\250o[\217\236?\271g\353\365\254eVP\256\344'\265,\213\fef\226\315\363\"\031\271\033\233\375\254E\260\\\025\373\324\253\237b_\202\345\244\327\177\260\334{}\367\372\320\253\177\020\364\b\323\363\245\327%\017x\177\f\274\307\224{\300<3\345\031\230\005\264A-%\320C1\007\305\376\211}\213\275\\\007h\217\304\376\003\313\267\327\307\327\027\226\002\264\373:@?\261\344\246V\377\266\037\265z\267\275\250\325?\333o\255\036\267\257\353\225\320m\345UI"
+	.string	"yIJ?\205oZ\345 \353I\341\217R\236\004\345;\222\027\205\037\372\036\364\365\355\373\f%\025\264]1\277\322u"
+	.ascii	"\250O\201\323x\3228\337\205\317=\343A\313xm\233)pg\335G\036y"
+	.ascii	"\277\311\t\331\253c\344\253e\362\360\233\374D%/q}I\224\227br"
+	.ascii	"\217A.b\3119W\217\303\350}&%\210N\320\322\tl\323c\323|\200\330"
+	.ascii	"\253\240:\353\353\252\357Q_\367\256\351\241iz\202yM\031\241\233"
+	.ascii	"{\346?\317"
+	.string	"\f!\037do\313\274\346\372\030\363\331\325A\326 /\203\\\320=/={YA\336\330\t\272+\366)\260\034%\017\302t\022\314o0\257!\370\270\302s\006K\025\271\367\362$0\317\271\374\346\362\331\253)<\307\330(\362DMtUX\363\250\3238\035,M\243\177\3362\372\210\250\245\004w\364\224D\217\245\216H\021D\032\242\256A\304\017=\327\331C;p\330\220\307PCf\310\037\302\222/\004\310;\372?\366q\217u\3729\333\274\343\027\234\276U\362\335:\236k\345\234J\036:G\007\255\243g\347\030\203w\350B.z\347\306\316\215-h\213\316\351\3346\372\266\316g\347|n\3434 \240\"#\323z\365\024\376\024\255\213\002n\201\363\300y\241\201\030\004\227Qv\030\345\204Qj\bL\371}81\354i\311\277\f\216\201\221\341&\347\302\352zl\344m\244\266\347m\352\213i\2277\273\312\237\207\227\240\336\272V"
+	.ascii	"-\357\333F\020;Q\005\004\257\345d\200\272\371\321/\263\302\336"
+	.ascii	"\313\\\271\207\313\304\n{_&\274\300\n\366H|\217\316\n\217\225"
+	.ascii	"\221\001"
+	.text
+	.section	.gnu.lto_.decls.1f5243c49cc38346,"e",@progbits
+	.ascii	"(\265/\375`\220\266\035\355\002^\271\204\220\020V LQ:\215\001"
+	.ascii	"\276~\223\231\031\320\212tJ\205\204S\231\200\025\f\362\235M\263"
+	.ascii	"\210\306(\227@c\340:\033)\206\242\347\025\243\362\357R\b\201"
+	.ascii	"A\202U\364\211\334\354\242p=\204\346\257KEnv\013I*@\210w\357"
+	.ascii	"c~WL\364\315\224\232\b\331r\313-\267\224)H\016m\020N\021{h\213"
+	.ascii	"\n\225\361\361L\302S\263\006\307\225\221\362\234[z\263\207.A"
+	.ascii	"\207Nv\327\276N(\323\343\211:\241Wh\024\232\004\235B\261\320"
+	.ascii	"&h\021\324\b*\004\225B\225\240OP&j\205\"A\241P(\350\023J\205"
+	.ascii	"\002A\217\240N\320*\224\t:\004\r\202\022A\243\\'\272\004\227"
+	.ascii	"9\312\003e\232S\202\203.\301qB\240M.\333\250\013\210\031z\204"
+	.ascii	"\303\212\360\031^;\034\225\034\250\214\033\317\033yd0\033>34"
+	.ascii	"\245M\035\276\273kM\031Z\242\256#\314\313\246\327\001K\231 X"
+	.ascii	"\215\034fC\302\f\245\225F\024\326sGG\034>\303hX\255k\013\347"
+	.ascii	"\230\201\326 a\206\322j\243\353\350\211\003\207u\331\300a$\314"
+	.ascii	"PZgD\325x\266m\263\204\tt\t\206\203\363\320&S\2752$\344\331\266"
+	.ascii	"\255]\016\034&\307\\\202\"\341\260\017CE)4\321{\3422t\t\332\204"
+	.ascii	"\376\270kMm\273\004\002k\n\216\325]\333\266#Ft0C\005\307\213"
+	.ascii	"\0022\372\343\307`p\030\f\006\203\360\254\b\230\0338\243=v\216"
+	.ascii	"\372\270\316\017\fMo\t\316:WG_\025\332\301\346\335\240o\230\253"
+	.ascii	"\243\257\361\366u\334\276&\263\257\275\354k\257}m\265\257\247"
+	.ascii	"\366\365\217}\235\264\257\203\366\323\271\375\324\314\376\321"
+	.ascii	"\032h\321\026\322\362E\r-Bil\r5-\341\374\324l?\345\262\237f\331"
+	.ascii	"O\271\366S\254\215\006=G\214\324\032\0318?e\262\237\026\331\177"
+	.ascii	"^\035\375\264\307~j\264\177\214w\234\007\006C[A\f\242\241=\234"
+	.ascii	"wv\216\361\256s\267\360\270\300\340\374\264\335\035\356\260\335"
+	.ascii	"\355\342$\314\021\347\343\260\233\377\007^\020\364\342\301\243"
+	.ascii	"\013\347\347\272\375,\267o{u4~\342\271\353|\032\246{\030X\026"
+	.ascii	"\021\316\317gv\t\332\247\351g1\373\307qp9n\324\3164\341\360\233"
+	.ascii	"j\346\251\305\b\347\347\261\375\374\265\257R\0327\324\b\211\007"
+	.ascii	"\0327\214F(\026\204\254\f\347\347\254\375\274d\377\370\214\231"
+	.ascii	"_X\2206#3\270L\016\325\332\331\025\316\317R\373\271i\337\247"
+	.ascii	"\253\243\237ml\234\206\305\\\347\321\360\2307s\204]hdA\303\371"
+	.ascii	"\231h\377\036M\227\340\036M\037\325\333\227yu\364Q\273}\237\356"
+	.ascii	"\006M\301\325\321\267\211\311\360\2273ql\214\035\177\371q\027"
+	.ascii	"\354\345\226\271\351\231\230258\343\247\273Aspu4\346\262s<&\\"
+	.ascii	"\302\262\342\304Y\003\026\013\261\211\274\200im9ZnBF4DKX\360"
+	.ascii	"\307\025\2507\234\177\2358\354\030\354\004\253\037kp\306Y\260"
+	.ascii	"\363\030\f\177\265\030L\204\247\266\025\302`9ym+\224so\006\367"
+	.ascii	"f\220\263\242\2268u>J\267\177\214\345\312\026S\033\312r\345\277"
+	.ascii	"]\230\b\266\002|\252`\245\362U\246\2073\366\312o\2365\350p>\312"
+	.ascii	"\266\037\202\221\213\335\265\257\313\264Z\363l\333\026s\341#"
+	.ascii	"8J\016\f\250\371q\023o\341)\230\n\356\302U\256\363\ncq\341,\254"
+	.ascii	"\365a\250(\205'r\317\273%\356\307\023+\377\265\343\302R\027\023"
+	.ascii	"\0225[\252\021\336Z.\\\244\004\334\217'#:\214\0301b\304U\243"
+	.ascii	"\333A'\314\277\316\303a)\217K\222\306c\n\316G\305\354\243g\033"
+	.ascii	"7\357\006-\342\352hl\325\001\223\311Q\265\341|\024l\377\307N"
+	.ascii	"\360\223\353\304P\376k\207\247\302\332\266}\bH\260\222\247\030"
+	.ascii	"(\270\n7I1\346\307\223\273\266mv\0301\302\007\347\fmL\347\037"
+	.ascii	"7ar\305\266t\220\341\214\231\277#&^\226p>\032d\377\277N\274\244"
+	.ascii	"\331v\2707\230\310@\303\371\250\017%\230\n\254)\317\006\3168"
+	.ascii	"\311ZNZ\304\312\220;\234\217.\355\243H\373\250\214}1\234}\034"
+	.ascii	"\267\217\327vz\034\205\241\362\204\\1\003\344\030j\310}j[\257"
+	.ascii	"\266m+\370\345XK\323\003g\034\004\013\271N\017\370\251\315\271"
+	.ascii	"tSCK8\037\207\331$h\333\353A\337\275\275\353A\227\3309\006\242"
+	.ascii	"\243\225\232\232m\216\276\3722\344\215\223\207(cB\244p\376\361"
+	.ascii	"\017\274#\307F]\236\021\316\277U\360\216{\345\206\t\211\232\355"
+	.ascii	"\222\332u$\306\305h\347x\307\r\203\227\202|e\212\332_-[\356\226"
+	.ascii	"0\250\331&\371\272l\344P\272+a\002\357\270c\227\fm2U,Q5\236>"
+	.ascii	"0\023\356\201y\340\246\353\304;0\216\343\034XG\2074\215\0322"
+	.ascii	"n\200Y\267w\203\376\332\325\321\307\316\255\324!'\357HI\033\316"
+	.ascii	"\307Z\333\354\354\246\t\2034\264-\221;f\3336\377c$\234\204e`"
+	.ascii	"\033\230\006>\302Dx\0066\302E\270\306u\342\033X\350\267\354\202"
+	.ascii	"y\207f\333\022\265m\333\205\207n\332\233\034Jwst\267\356-\207"
+	.ascii	"\322\235[\232\013GB\\\016\245\27377\357\303PQ\n\\\322<q\320M"
+	.ascii	"\3730T\224\302\225\332sG\017\267\bps\213\273O8\273\273\373\274"
+	.ascii	"kM\315\026\307\bjr(\335\231\211\271h\356ZS\223\003\271\034JW"
+	.ascii	"m\333|\b\377\235\3037\256\233\233\2066\231\264-\021'\013\314"
+	.ascii	"\230\301av\327\266\315\021\035F\244R|p\025\351\220\217m\354_"
+	.ascii	"\275\375\333f\377\270\335\033c\233Q#\316\357"
+	.string	"\336\305~ffbJ~\305\344\341\005\340\207\023/p~\361n\031/kojW\366\357\326\316\020e\377\267\256\315OL\333\323y\331\374\266\t\222\365\260\372q\311\322(7obS\033\304S\016\002tGE~\345\356\326\312\304I\324\021\316\277N\373\277poP\366\232Gk~\337n\335\f-1\234\257\032\334\243Y\343\211\363\353.\366\177\275P\266`9q\376\345\261A\270:\372\277h\332\260\\\r\255\0338\377\367\314o\233O\215\221%88_3+\232\304\005\357\t\316\257\273e\376\257y\313I\223\024\316w\314U\273\316\020w\355\227\314e{*\324l\233m\333\314\301I\364\262t\341\234\341n\320\370\352\350_\244\375\033B\243{{7\204\376%\332\377MC\313YzLE\341\374\277\356:/\332_\302\304\343\200m\253\325\266\355\207\224\355I\225\023\347\003\3557\257\216\376q\247\315\273A?\314\325\321\267\313\365r\235"
+	.string	"\270_^\302\304\321\240*9\3018Xq\360p\376\212\375\013"
+	.string	"}\367."
+	.string	"\364a\330O\261\377u7\350\253\260\317\345n\320\027\313\375\272N\021\027\354\327\353Z\371J\324l\275\332\266\231\323S\004\313\027\234_\302\376\315r\f\252\264&n\301\376\025\241s\366\366\366\366\256\b\375\275A\334\r:_\035}.WG\177\355n\320W\312\325\272[h\321\321S\373\325\266M\r\252\224\262\250/\234\357\026\276Tn\363w\353Ny\t\023\007\022\265Zm\333\274[\271m\205\356\315@xo\006)\231\022\241.\235\217\367\233w\203\336WG_\017\204\020\312\360\257\351\325\212\261\331\244\360\353\023\277\212\302\257\035\240\037\360\253'\374\332\304\257G\370U\023~\275\243\226"
+	.ascii	"\201\037\307y\300\217\337`\023p\233\r\250\016\370Q\026\331g\213"
+	.ascii	"\371U\023?n\300\257\216\360\243OU\204_\177\370\265\007\013~5"
+	.ascii	"\204\017\277Z\342WA`\261\3074\360\r\f7\327\355\360\337\r"
+	.string	"T8\260\2612\226k\226%\300\364\347\023^\327,\257Y\3152\226%=\345(r\026f\002\372\323/\332\215\372!3 (\233\330>)\b\337\003R\f|\013"
+	.string	"\362\024i\005\276\017~\354\"/@\035\361\253\004\370Q\037\"~\324\207\321\033\037\242\004>\001\204\370\321\035\355\237\205~u"
+	.ascii	"\277*\200\377_\362\b\376\033\261\212\022\374\327\371W4\206\377"
+	.ascii	"h\034\250\033\374\350R\376\301&\264y\b\f\3141\346\376\237\035"
+	.ascii	"M\203\037\365\220O\310>h\177n\200\232\001\210\037\323\245{W\003"
+	.ascii	"\360\353T\305\340\317%\240Y\005\300\217W\212\372\341\277\036"
+	.ascii	"\310\f\370/\200\177\217\340l\027\374y\305\237[\374\352\005TX"
+	.ascii	"\210\255>\235\252,U\200'L=\345\232\205\300Lj\360#\376\275\365"
+	.ascii	"g\025\252\005?j\342\002\277\352Ac\340W;\374j\005?\032T9\374("
+	.ascii	"\0036\374\330\231\312\375\351\363W)\320\036\374\252\316\217&"
+	.ascii	"@\235\340W5\374h\003\244P\007\\3\f\203\232\341GQ\320-t\361Ws"
+	.ascii	"~}T\205\377\327\247\220\362\020j\220\305\007\376\265\204SQ\177"
+	.ascii	"\252\357G\203\324\365G54\311\314 Z\0133\205\320L\376\301\277"
+	.ascii	"v\240C\326\340\032\020A\201?\r\372\325\235\n\375\252\372\337"
+	.ascii	"\272\377\266\371\357\363\277v\377\205\3733\007?f\322S\256\326"
+	.ascii	"\235\373\257\332\225\273t\251\221_\325?\326\241\246?N\252YE\377"
+	.ascii	"\253\345\277`\377\305r\303\216\342J9\013*\376u\034}\367\347\016"
+	.ascii	"\377K\370\367\316\237*I\253~m\227!\375\362\247d\277v\023\367"
+	.ascii	"ga\006\201\204\256\323mn\212k\200J.\300\177\020\377\316\300\237"
+	.ascii	"r@\323\375\231\303\3312\005i1O\2203\244\311\377\252\240\347\376"
+	.ascii	"[\345\003\270\022\370\365\363\277\023\270\\\247\262\001\360\347"
+	.ascii	"\r\374\231\003\277\216\373\227#\375\266\235\214\335.\251\352"
+	.ascii	"\313\371\177v4\374\377\252]\020)PP\271"
+	.string	"\005\377vqM\330\353\2775d\275\203l9\3575c\020\327pg!\216\252\367_\016\247\362\346\277\034\376S\201\363\353\267\353_\235C\335\034\375U\270\377,\260\345_M\363\337\023.\nz\215\357\367\337\n.\360\277\302\377\346\377\372\376\253\377\373\373/\372\337\364\277\353\177\325\377\356\377f\320j~\264\315\377\275\343\335\275\315\345\376\3666\235\301\257\326\375\227\001&\374\330\003x\370%\353\341\235\312Sd7p?fr\373\312't\232kv\r\377\336\361\347\023:M\334\377\364_\305\374\371\204N\363\347\020\332\355\232\035\370\257`~\215\346O\355~\335\366k$I~}\346)4p\315>\301\277\216}\3456-\230)\233y\360_\263|aI\372s\020\255\245\247\\\003\031\353\367\257J2][\200\374h\b\364\004\337@\026r\341\2776\300\314\217\226x\n\247\003\224\371Q\0172\323\007\277\377\032b\351\277\372\257\033\204\310Ik"
+	.ascii	"P\350\036\315\376\232\r\005\241\201W\360\257\025\374\032\350"
+	.ascii	"GO\220\371Q\030\364\332\217\366\250\241-\322~\215\364k\264\037"
+	.ascii	"\375\200\276\361\353\263\377gG\3233\210-\350\366\3274~m\366\243"
+	.ascii	"!\302\374\032\206_\203\321=~\024\250\354\317$\024\377\253\202"
+	.ascii	"&\373\365\006\277\376\362\243%x\311T)\004\364\004h\bR\350.\031"
+	.ascii	"\311Z\201\364\2044\002\022\320X\376\237\035\355\024\374Z\314"
+	.ascii	"\237B\340GY\350+\177\006"
+	.string	"\346/\332\312\257\237P\021h\257\0377\365\222.\343;\374\232K+\241\302\301_Z\364\2475~]\345\307\026\3705\327\237\362\320\315?\177\300/\374i\322\237*\375z\353\317\030\340\024\277\246\202+\360c\r\350)\177\016\242\265~=\301\217\205R\364\325\377\r\234\005\274k\340?\2120nt\024\315d\003G\341_\223\374\251\230\037{i\346\217\233z\311\237\216\371u\325\237k\374\367\375\253\316\237\242\371q\234V\242\251\376\247\370\376\327\337\257\223\374\232\310\257\207\374\332\307\257o\374\232\306\257_\374\032\371\353\342\257\331_\303\360k\f\374\032\305\257O\374\372\001\277\036\341\327%~M\342\327\034\374\372\303\257-\370\265\316\257\365\257\377\247v\177\372\374S5\177\352\366\247c\376\224\354O\253\376t\352O\231\376T\351Ok\374\251\320\237*\377\364\003\177\332\201?m\341OW\370\323\t\374i\004\376\364\204?-\341O\025\360\247\"\376t"
+	.ascii	"\177\312\301\237j\360\247 \376\024\203?\255\340O'\370s\320\237"
+	.ascii	"c\374\331\347O\203\177f\361\247\353\237\207\177\316\300\237\252"
+	.ascii	"\177\232\376y\357\317z\177v\363g\t\3749\356\317k\376\374\366"
+	.ascii	"g\267?\267\375\331\314\237\261\374\031\353\317d\376\254\366\347"
+	.ascii	"\264?\207\3713\331\237\267\3749\354\317\316?\177\375\331\353"
+	.ascii	"\317\\\177\246\362\347\254?[\375\371\311\237\233\374\231\371"
+	.ascii	"\347\252?S\375\031\311\237\247\376,\365g\"\177\036\362g!\177"
+	.ascii	"v\3723\323\237s\374y\351\317I\177\266\361\347\032\177\226\361"
+	.ascii	"g\241?\307\360g\240?'\377\374\363\347\343\237?\360\347\026\177"
+	.ascii	"V\361g\030\376\314\201?O\340\317'\374\231\001\177.\341\317\016"
+	.ascii	"\3703\t\1776\361\347\021\376\\\342\317 \374\231\304\237\013\360"
+	.ascii	"\347\021\177\026\361g\016\376\254\301\237A\374\031\203?\177\370"
+	.ascii	"\263\005\177\356\360g\016\177\246\340\317\023\3749\303\237\205"
+	.ascii	"\177\006\376\331\367\347\375g\375\347\374g\374\347\377h\234\037"
+	.ascii	"\315\373Q8?z\367\243n~\264\315\217=\360\243t?\326\300\177\024"
+	.ascii	"?\006\376h\013\3777\360?\304\217>\177\354\365_)\377\305\373q"
+	.ascii	"\362\277d\377\035\373\357\013\377=\341\277\031\374\027\304\217"
+	.ascii	"\306\375\350\333\217\002\371Q\247\377&\340G}\374\350\216\037"
+	.string	"]\372O\345G\217~\324\350G\203~t\004?\032\202\037\215\361\243@?z\374Q\343\217~\340G[\374(\213\037]\361\243=?J\374Q\030~T\003?\212\342GU\370\321\023?\212\302\217\226\360\243\016\370\321\006\374\330\371\243\f\370\321\004\374(\002~\324\304\217\226\370\237\342G=\370\321\021?\032\342G7\370Q\020?\372\341G/\370\361\007~\324\303\217n\370Q\r?\032\374Q\337\217\246?\216\363c\275\037\277\371q\233\037\323\375\327\003?\226\373\261\225\037s\375\270\307\217\231~\274\343\307\312\037#\177\354\342\307\354\217W\3747\376\327\354\307*\376\177\371\317\302\177\266\037\353\037\257?\206\341\307\303\037o\340\177\013?6\341\307%\374X\370c\364\307\370\307\367\277z\377\315\373\357\335\177\313\376\333\345\277[\376\257\360\337*\377\325\372o\212\377\262\360\377\205\377\256\360_\025\376;\201\377\242\360_\r\376{\301\177-\370\337\374o"
+	.string	"\376\243\375?aooo\357\277\300\351\367"
+	.ascii	"\367\007\331\005LK\037\360\356\356.\032\226%_\317\017j\334\270"
+	.ascii	"\271x\270m\333\226\251:\227Hy\222m\265\215\332\346\356\035\240"
+	.ascii	"\216\214\016\021\377@e\217\251th\321\321\023\327\223\266m3\334"
+	.ascii	" eLS8\377C\224\255>\217Ol\001;\303\371\037\216l5N)\213\023\024"
+	.ascii	"\234\377\341\307\376U\270\267\224\213\021\225#8\257Q\243\340"
+	.ascii	"U\321\341\374\017J\373\231\210\221;8L\346\032;'jL5M-\243\222"
+	.ascii	"Q\235\352\227:\246\226\251iT6U\215\n\246\236Q\307\250a\252\233"
+	.ascii	"\332E\375\242\242Q\265\250k\352\026UM\365\242\242\251f\252\031"
+	.ascii	"\225L\345\242\212\251g\252\030\025\214\232E\rs\235j\233j\345"
+	.ascii	"\327M\275r\347\216\304=\375;R\304\204\324`\316I]\2627\314\247"
+	.ascii	"\"&\0241\317(hO$j\325]kR\300\025\334s\247\351\304r\311\204A\031"
+	.ascii	"\332\241"
+	.ascii	"2FvXf[y\b\230]V\230\020\332\324.\325K\210\266-\221-f\333\266"
+	.ascii	";\\Y\230ZD\360\264.\331\226g\225&i\256\316\230LL\324D\3451\333"
+	.ascii	"\266\2713EK\025*y\310]kR@V\330SmS\255\322\236\327\356\311\030"
+	.ascii	"\023K\336\230SrC\366\230U\276J\230P\333T\250Kv\327\232ZT\316"
+	.ascii	"\313\226\210 >\330P\310\277\340m\243\027\220\331^\227Lu\262w"
+	.ascii	"\203\016\347_\200\266\177A\226\375\013\242\354_@\265\177\201"
+	.ascii	"\215}\013\350\366-X\333\267\300k\337\202(\373\026P\355[\360\264"
+	.ascii	"o\201\217}\013\226\366-(\332\367p\267\357am\337\303\327\276\007"
+	.ascii	"\255}\017\314}\017O\373\036\214\266\232D\245\272\316\016\252"
+	.ascii	"\222\234\3136t\303\t\347{\030\332%ho\007\375\275\333A\277\203"
+	.ascii	"\335~\2073\373\035\300\366;P\355w\320\261_A\336~\005j\373\025"
+	.ascii	"\\\331\257\200j\277\202 \373\025\334\330\347\260\267\325 D\231"
+	.ascii	"\315\314\323\223\352\224\003W\266\203\r\316\347\320f\377j\323"
+	.ascii	"\325\037\277\332C\365\221\303\3441#\b\316\350\324\335\240M\\"
+	.ascii	"\035\2552\355\\m\372y\t3{\303Y\004\035Wy\374\372H\335\201\301"
+	.ascii	"\202\230\200\321\302\0317\335\rZ\315\261sU\207\22591-\316\032"
+	.ascii	"$]\305\361\253J\352\322\257\210\020*k8g\257\253\243\325\033;"
+	.ascii	"W\223\270\324y]\301\371]*\222z4\247\207W\006g\241\227\240<.8"
+	.ascii	"\377\252\r\325\350\212\252\n\f\3165\232Enn\244\301\371\034\312"
+	.ascii	"\354_6\225F\026\242\312@\233\314\225FT\215g\253\026\2513\256"
+	.ascii	"S\245\241\022\2514\324\241\256\242\037O\356~_Pp\220\321\252\214"
+	.ascii	"!\273\211\350\210\007\316\347\320e\237\203\225\375\353\275\253"
+	.ascii	"B\277\332\252A\030l\310\r\034SpF\335\356\006\275\200\253\243"
+	.ascii	"\263\233\235\353\275\274\"J\254\362~\235:O\353M\240$\20126\236"
+	.ascii	"\350\036\216%Pp>\007*\373\327p4\234\214\224\026\265BN@0!\343"
+	.ascii	"d\3537\177:\247\357r[W\273E\n\347\373u7\350|e\347\332\316\013"
+	.ascii	"\216*`\334\350:\255\245\214H\021\234u\233\246W\333\266\036n\034"
+	.ascii	"\020<2\234\317A\310N\003\306F\317]\247\246\273\246K\277\364S"
+	.ascii	"\030\324l\227t\r$@g\020\0324t\326O\257-SH\236qqo8\354\330\277"
+	.ascii	"~{\323\\:4[\034!\004\321\225]\265J\\:8\007\033[\257\371S\274"
+	.ascii	"\253eoI\233#\2345\225\235k5D:\234Ui0\030\fC\2704\265h\2676):"
+	.ascii	"\244\250\332t[\312\205C\204\223!\034\202\266>\363k0m\006\211"
+	.ascii	"\216-v8\337\253\273A\247w;\327e\246\250\254\330\364Z\035\222"
+	.ascii	"\2658\234\257\323\264\230\3531\327c\364\332m\333\266mj\203\346"
+	.ascii	"H\250kR\022\241\327\340t\026*\252*\234_w\270\377\353\017\f\222"
+	.ascii	"\25018\177\203\335\376\357\361\257[!\245\266mq\244\315Vi\b\250"
+	.ascii	"\377\373\233\336+\342\017^\364j\360?\267\355\006\220m+c\314U"
+	.ascii	"\333\266\267\315v\"&\364\003D\233\256\265-\021T\220\003\240\226"
+	.ascii	"\210\240\230\212\274\240\2264\024yA\265ADUA\032\224Z\250\240"
+	.ascii	"\"\257\266\325@D\024d\302\323R\221\227P\253\241\310\253]je\260"
+	.ascii	"-\335\266\t\025\324\022=\265\032Z\242V\250\365zZ\002QD\004\265"
+	.ascii	"T\344%\264\244\241\310\013j\251\365\202j3\264DBJ5\210Z%\r\255"
+	.ascii	"\027\324\\\353\365\264\224\241\310\353i\251\310\013\n\355V\031"
+	.ascii	"\305\305\331!\346*I\326\035RD\324\336@r\022R\312\260V\324|j\335"
+	.ascii	"\332\366~\315h\225\332\265\266\325\240m\235\236\224\334\204\230"
+	.ascii	".\227\241\265\033CaBO\267\331\266\255\007\244\241\250\247\226"
+	.ascii	"h-\350\266kEO\236\332\366\311P\213\026\251m\333V\204\240\346"
+	.ascii	"Z{\344\256\005\021qj\217f\264\255\005m\263m\221\3326\350\266"
+	.ascii	"km\333\006\265m\253*95\333\326G\206\"&\022R\3336u@j\235\202\306"
+	.ascii	"f\264-\376R\303e\251\310+\352ig\354\212\027\263\245\321\f\272"
+	.ascii	"EGO-\263u\203R\332^A\\\355Q\333\266\227\315f.\345\240\303A\312"
+	.ascii	"\320H;\323f+^\020\250,8{P\333\024y\241\201\263\006\223~\351/"
+	.ascii	"w\255)3\341<u\231\016s\235\032\214&\323`\324\244\254;e\244C\215"
+	.ascii	"\316\337\320\265\365\027\f\006CK\246(\fg\335e\347\332\213WU\021"
+	.ascii	"\026\316\006\330\342\324[4\027\264\250\025\212\022\301I\020]"
+	.ascii	"\331]\253\304\245\003-V\201(%3\234\277\001k\177\303\222\375\353"
+	.ascii	"\260k-mzz`d8k\260\235\353\260'\253(Q8Wpu\364\227\316b\200\266"
+	.ascii	"\fS\352\313\212\256\242\257\204`O\317\016\347\273\335\r\032\265"
+	.ascii	"\262smeL\331s\013g\355\365\353 \231\t\203\035\375h\222\303YW"
+	.ascii	"\331\271\356Z\362\205\206\206s\360\352h%7)xI8\353\346\227PO\211"
+	.ascii	"\r\265)\232\312\025C\262#\207\032\316\353\325\321W\312\316\365"
+	.ascii	"\2242buU8k-\f\246\207p)"
+	.string	"!\273\322X:\313L\r\031Zp\326f\256\216\326Qv\256\257\320\300M9\301\371e\236\\[\375\232\206\206R\202\023 =p\306nw\203\326Lv\256\237\250MC\212\270p\326N~\315D7i\305P\215\341\214\327\356\006]\200\253\243\365\222\235kf\326Bc\307\006\347\016\250R7Z\t\006\203\341\212\025!38\337\251\273Ac0;\327T;N\331\215#G4\022\237\023\215\016*MG\212\\O\375ZJ\033\331i\274\242\226\340|\303\334\r\372\202\253\243s\326\316u\221\353\260q\363\302\302YGi\272\226\311\t\347oh5\324s\225\247 *\304C\214\230\220\353!\1776\243\237r\333\224\221\331\031\316\277\273\033\264\016\262s-d\357\355y9\202\263\020\310\341\202\270\242\230\375\320?\270\350\312\356\330\354_35\351\036\252\214\273\347\036\316\270\350n\320\031\\\035}\347v\256\2316W\232\027\242\034\327<~\255C\357"
+	.string	"j\261c.\301\0313\357\006=\200\253\243s\232\235\353\034XL\225\220\220\244k\034\277V\322K\2767P\276D\301\031\177\335\r\232"
+	.string	"WG\343\253\235\353$+13Qp\3267\364\01667w8\353\243\235k\244\225F\021\034%\2347\320E\3276~]C\0339M\351\t\301\031?\357\006M\342\352hMc\347\272(\350D\215\r/\234=\320\255S\267ZF\207\247\026G\006N\232\264}\271k\333\246\016\200`hsx8\377\232\350Z\306\257\203\264\320%\0236y\243\305\304Y\017\355\\\023M\211\325`\303\371\356\355]\035\235\241m\257\216>\005X\322\275\037\035\203\337\344\"A\324\b\301\371O\363\236\306\371S\275\374\243\304\321\021#8\377\256\216N\361v\236\346\025\341e\341\354\273::\205\363\247w\351\233\037\227Z\036\026\316\227y7h\016WG\247nv\236\332\345"
+	.ascii	"\251\nj\302yC\2336\031ID\263\315\2412\231\243+\273\242\300j\377"
+	.ascii	")\335S6\307`0(AB\342\3049\235\333yJ'&E\215\b\316\036R,\327\231"
+	.ascii	"bI\345\2340I\343<\344\0201\"t\006\347S \265\277R0\264\311Da\350"
+	.ascii	"\206\232\024.]s\235\351[\372\226\206\245k$\314Pja\b\351\371\226"
+	.ascii	"\246y\332\207\241\242Vh\b\bL\340l\225y\0301\"_\2312\023\262\363"
+	.ascii	"u\326\354g\2450\036\356\332\224\003\232\200Y\021\203\265\226"
+	.ascii	"jI\301|\030*R!L\330\363\354\213\231\226\365D"
+	.string	"\023q\327\276L\340\242\265\226\2169Y\325\325s-5\363\240\217 \221\362\274kK\335R2\351\231\264Lj&E\223\262]g\272\226\252\245W\254\334\341M\220\257#\265\257#d_\207i_'i_g\306\376\004{\373\023\330\355O"
+	.ascii	"W\026$\307\226\204\363'H\363\222~\271\316\224,\025\333\222\216"
+	.ascii	"\3011\333\266\231\222\245]\322\261\t\340\3248\321\201nY\323\306"
+	.ascii	"\212\316\237\340\307\376\323\261\224\313/\316\024 qR.\251\030"
+	.ascii	"\225%GDp\376\004C\373\032\362\3665\324\355k\210\333\177\352|"
+	.ascii	"\nv\f\006C\232\245\006\032\r\234\323,;O\2352\246\216p\340\034"
+	.ascii	"\342\352\350k@\263\257!m\377i\327\2573\355J\255\244E\255P\023"
+	.ascii	"\021\230\244^YhDc\251\r\316\327 \266\257\341k\377\351\217\353"
+	.ascii	"L\177\244\\\"8\031\2226W\261\267\270!\234\257\201\312N\265\322"
+	.ascii	"+m\244\n\222\273T+\rb%%\312\222g\272\225RI\263R))V:\345:S\255"
+	.ascii	"?uJ\201\330=\245O\356\332\227\nO\254g\252\225\n1\241IV\252\225"
+	.ascii	"Z\245Or\bi\b!\271\023\212\215\321\261%\314\327\220c_\203\322"
+	.ascii	"\276\006\244\375\020\224\244K\214\310=S'i\223\224I\n\345:\323"
+	.ascii	"')3\247O\322!)\024\332d\256Fh\362\236O\322\250\364\b\312\245"
+	.ascii	"\264\301h\274I\237\244HR\252\022\030E\335]\265m\023\255\352J"
+	.ascii	"\323\304\227\257!\250J5B;C\205\3633\324\355gP\263\323$\350\232"
+	.ascii	"\031\321\025\316\317\260\266\237\001\314\376\237N]gz$5\342\225"
+	.ascii	"\036I\211\244Ri|D\335\371~\244\031\241\221\3633"
+	.string	"<I\213\004\303\210\031\363\202\3633 \331\317\020\265\237\301\307N\241`h\333\2570k\246\264\301\371\031\226\3663\034\355g\240\261\237Ah\243\315\273A\223pu\364s\340\354?\355\341L{\340/\023(I *\353\231#\267S&\037\221\263/lp~N\333\376s\335\2573\327\245;r\200\200\302\245C\002Uk\2368?\247l\343\211\231\313wni\220\0303\265\221\342H\215\322\032i\216\364(-J\221\322\033iR\272\224\322Hg\\g\252\224\022=\273\311vi\033&\204=3+q\316\362\322\334R\245T\006\372%\224F\353\215\332\034\2341\314\254\207&\264%UJ\207t\032.{\276\254+c\244>\344\347d\331\317\301\332\317\241\332\317\201\332\317\311\261\237S\264/\214\263/d\263/t\333\027\256\355\013\303\354\013\267\354\013\275\366\205T6\272v7h\005\\\035}\341\223\375\347\271_g\236\313l\326\242\266\305\241"
+	.string	"(ctew\255\222R\007\231N\213l\316\n\347\013\211\366\203x\373\317p\317\317?\307e9\f\006\203Y\213u\003\347\\t7\350s]\035}\315v\236\341V*ku`ok\200BY\306\350\271\3454Y\r\020\027\225=\234\361\324\335\240\005pu4\356\262\363\354\346+2*\242:\363\214\246\r\206\266\r\253kb\226\327\324j\3336g\035\303\203\262\003\347lf\347\371\314u\342\274\261\361\205s\316\325\321\231-\333\260\203\222\206\363\203s\373\317g;K\334\232\215\265\254\346\253K\362\304ML\036\203\255"
+	.ascii	"\237\256\022\0176Op\246\240\231\226\321\304\232P\230p\316gM\240"
+	.ascii	"\215'SN8?\330\266\361^\2277\246Y\366\222\301d\262\374%\227]g"
+	.ascii	"\016\363g.y,\207\311`9L\r\263m\3330Y\354c6\214\2501\347\264\244"
+	.ascii	"an\311YZ#n]9L\376\312Y>\f\025\265\355\022\bzL\220\334i\244'V"
+	.ascii	"\216\204\371A\263\275\213\256\216~Pl?h\265\037\364\221\303\376"
+	.ascii	";\227\235\3014aBx8?(c\343\366n\3209\313\237\257d,\037\003\242"
+	.ascii	"G\200\204m\301\371\300\273}\233w\203\356pu\254\210\b\276i\033"
+	.ascii	"\272\362\312Zd\316.6p~\b<n\031a\332\266Oo\224\376k\227\265\362"
+	.ascii	"R\306!L\333\026\252\207\3343G\326q\327\232\034\220\205\307\366"
+	.ascii	"_\273\035Y+\373\310Wwm*\247\305=\231\264r\323-s\327\246\034\240"
+	.ascii	"u\367\254\222\233y+w\345)\231+S\271\316\254\225\261\236\263\262"
+	.ascii	"\224\315F\305$\226!_.w\203\266\340\352\350\003\325\354(Mz\234"
+	.ascii	"\331\302\371@\263\375kE*-\377H\242F\213S\232\f%?\311KrUV\222"
+	.ascii	"\231\331*7\311L2\325uf'"
+	.string	"\031\t\306o\214\240M\235e\"E\3040\201\\2!\332\266A\334r\020!\031J\210\266\355\223ZV*a\";\311Q\227\354\2565) k\314\323I>r\313\b\205\232\255\222\n\266\324\246\343\256m\233\302\032S\264\224q\310\007&\331\007\372\330\007\"\355\377\362\366\177j\366\177h\373?-[\204\024\250<\344>\331\211\371\202s~\312<\304\024\251\302\371?'\373?\252M\302\216\375\237\214\3750w\203\376/h\337\247f\3377f\377y7\350\373\272\354\373\260\350\370%\203\241\255@\303\231\222\020\234\357\273\332\031\307-\243&\231\271\221\204\363}T\033\204\234\344\005\311*\013\347\207P\224\215>\f\025\245p5\365<\3127\2563#e\033\031)\313\3104~E\314\226p\271\033q\225\344z\230\351\374\025\315\3165n\034\261Q\204\363\3271\373+\230<\343S\214\352\320p\376je\177\235\262\377L\364\264\f\006\nW\320\020"
+	.ascii	"r\232<\220\210d\241\334\332\361hr\3039\267\350"
+	.string	"\036\272&$j\2669F0\207\344\356*\007]gnssD\007\023SFjr\376\252\264\1774NQS\303%Z\022VE/O}B\341\030\223\207'Dbk\241\360P8\253\0337=)8\177\245\361Fn\206\023\034\\p\376\265R\306\006\263-\316\265#\223\344\226\307l\333v\347\314\236[\332\017&*\207\212A\327\31241\315\030]39\024\r\375\022\022eh\333('\346\033\372D\331\240t\250\0334\016\275C\347\3206\250\035\n\207\326]'*\207\2469\252\006]\363\334l[\"\266\213\t\2112\2646\206\216\320\350=Q94\fz\206r)m,]A\236m\333Le\364@2gAN\237\356\006\375/w\373;n\177\233\331\337g\373[l\177{\355\357\255\375\215\265\277\237\354\037U;\272v1\274k\324\351\301\301\031\035\263sTM\001I\210d\341\214^\035\375\275d\177#\331\337R\0335[\333\330"
+	.ascii	"\371\302\371\033\310\376n\002S\206Vq2\255\225\221\345\204A\213"
+	.ascii	"\343\203\f\375\242\263\344\206\224p\376\276\261\177\324K\227"
+	.ascii	"Kf\017\007\330\330\321.a9uA_m8\243\\v\216\216a\240\205l\fgU\f"
+	.ascii	"\314\214.\216\tg/904\313\305\204k\333\206\201c\266m\273\203\202"
+	.ascii	"\241W\320/!Q\263\r\322pk{Vw[\3200T\313u\242`\250\363\271\303"
+	.ascii	"z\006'\351\271\363\325\264}\325\313\376Q,G\277~\324\312\255r"
+	.ascii	"1\214\325\346\202\334\341|\311\354\034\305\202r)\233\221\207"
+	.ascii	"\363U-\033\370\265\177\264\253\212\257\311\032X\033\274u\264"
+	.ascii	"\312\2176Q\256\034%3rT8gh\357\006\215\333\253\243Q*;G\267\200"
+	.ascii	"FFL\332\340|\367\320)\250Vp(H\310\007\252\205JaZ\313s\2023\232"
+	.ascii	"\345[b{\226\341|\265k\223i\303iH\230\241\264\336\210\322*\303"
+	.ascii	"f'\023\022eh\211\242\276\230;N&\\\333\026j\r\223\250\351\251"
+	.ascii	"ed\024wU\330~6\340\231\243B;$\274&h\336\222\274\2309\360\f\331"
+	.ascii	"\t\251\"\"\234\201e4\227"
+	.string	"\237\327\031\2648 T4\254\216p\376\016\224}v\340\030\340\031p\rg\215\205\300\273\022\241\256\031\205Q\003\252\035\270\206\347\306\t\005\230v\240\230\177\005\306\205Q-\301\371;T\033\210\266c\004\330\005\030&\313X\271\236h\232"
+	.string	"\301\034\030\346hj\250PA\341\f,\273\034]\0223i8\003\311\216\306F\355K\021\316\300/G;[\222$\017\330#\344\245\210Y\320\020\024\234\277\303\003\357\367\341\001\271dp\352PA\017l\303\371\266\003\354@.\007\212\2250q21SJo8\003\265"
+	.ascii	"\267\370\270\320dm\001\206\335)>\300d\340\374k}xD\360\302\f\301"
+	.ascii	"\371\332Mk\t\23218w\375]\300,\007\201\t\3053\203\267\005\370"
+	.ascii	"u`\02654\037S\304\340\f\274\002\304\302C\250\250\r\3079y\353"
+	.ascii	"B\005g\240\025\240\227\322\325\201YW@.\264\3556\333\246\247\240"
+	.ascii	"\271\003\340!\305\351r\367\343\262\301Ef\312\201\\\0076K\230"
+	.ascii	"8"
+	.string	"\334\276\262j\023\302\031\270ua\223\230.O\234\017\244\242u\270'pGs8\003\245\234\f\330\204\346\316\b\020k\355\022\244\b\024\316W\235m?\2305\236<\001Z\351\242\030m\242$y\256J9t\264@(\007Z\355\305\345e\355\b1\177&\260\311Ah\016\235Y\"1\345(\211\325\235\017\312i\314\r&\0076yZ\2144\243&yS\016L2\005X\265\233mP\2256i\202\035Y\214\2317\034@%\007V\371\274\264\235\031*\2023\220\312\327\346T;\243k+buV\2053p\n\210d\337\230\"\243\2063\360\310\257l\253+\357\fg\240\221_\027\230\020\023P\352_\203VX\255^]\220\003\237\200A\200DFLAB\243u\267\226\325\025Q2\344@\"\007F\2250\201\303\"0\004\b\020\n($\016\350\004t\002\372\250b>\t\013\022Fm\307\277\003\350\343Vi\223>@\341\262gu\267\245\354\240\342"
+	.string	"{\034\350C\f\005\323\272\361\304\031\310\003\330\344\333\303j\322\002\233\200LA/\270\035jM\365\311\2246f8\277\316\203/5\256\210\025\035hT\004\314q\253\264I:K7\242\332\\\265EM\"v\215&\332\022P\351\300\034\007\342(a\342doqn\326p>pi{\031sr\006h\003\230\204v\006\307\t\316\300# \322u\236\fxc\314\351\215\031\316\007\201\271c\220i\225L\003k\200"
+	.ascii	"\265\205~\240\020p\006\t'GI\254V\2416\242\"\240\214\003g\\q\242"
+	.ascii	"\305\341\f$\362y\021\342\244\251\016g\340\320\323\234iFD@pz\363"
+	.ascii	"\277\001\266X\250\211\266-\2639Tf\256\003'\227\315\231\267\250"
+	.ascii	"8\007\266\377\355\2250\201\325\200?\210\330\274\374\362~z+]\225"
+	.ascii	").\227\3733\347\356\311\235\032\234\177xXM\216\213\024\"\234"
+	.ascii	"\177p\260\232\020\356\253\312\t\204\035t\377\271\241\373\331"
+	.ascii	"ux\n\2323\361\003i/\316][\344$\002\330\226\225\205\311\317\356"
+	.ascii	"_\244\212\304\304\340\374k\363_\335\277\342\261;\037Wp\376\007"
+	.ascii	"o\366\217\315\007n\277\267\377\342~o\277g\220\013\230\220\342"
+	.ascii	"tQ\275\340\024\331\311\375\367\304acZ\306\250\374\276\324\374"
+	.ascii	"j~d\267J\233\224\003\344(\211\325U\324\330\032<\256\265\377\310"
+	.ascii	"\374\326~n\\%\304 \3415\361\221U\251\312\361;\363\237\333\177"
+	.ascii	"hJ\2308Y\216\031\227\215\0378\377\327V\3673\243\364f\351\355"
+	.ascii	"g\346W&H\221\033i\\\332\345f\256\f\333=\004\333\346\254\254\371"
+	.ascii	" \307\017\314\017\314o\314\021\034H\356\356\025\232\21681\377"
+	.ascii	"\215!\313La\236[8\377\314~i{l\n\222\240\264\037Z\030\031IPiS"
+	.ascii	"U\343B$\313\357\354\027\346r\3010\256)\247\017l0\377\363\362"
+	.ascii	"c\376\310~\333\037\331Q\022\253\273\234\245#\265\264/\377\221"
+	.ascii	"\221\255\345\3011\342\345\367\204\2247\006\347\237\330\257\213"
+	.ascii	"\257\213\013\335\026\316?.\2771!\034\254\035^y`\277-\300#G\264"
+	.ascii	"\354\341\374\013\373i\021\006yR\342d\203\345\347\354\311k\353"
+	.ascii	"\302\371\367\365\313\202\271\2744q\203\246\353w\005h\2675\227"
+	.ascii	"\005\347\237\327\317\312\272%\364\314Z\333\372U\3111c\305\345"
+	.ascii	"\r\347_\363\307\345\263AD\f+\214\224\037\025\325\354\311\320"
+	.ascii	"\f\234\177Z\277)y\215\020-E]\242\374\262\256\036\0304*\234\177"
+	.ascii	"W?\254\373\305\244\221\345\353\007\345?\253\177\315ART\346\t"
+	.ascii	"\347\223\330\332\3779\371=\371W-\306\214\214\026\347\223\260"
+	.ascii	"\332?&\277&F\300\334\214\341|\022U\333\b\022$\277\252[\245MZ"
+	.ascii	"\"\321}\031\301\027\260\032J\376\253\302q`h\260p\376%\371Q\025"
+	.ascii	"e\351]\371Q\3352L2\360\300H\264=\336\3437u\253\264I&\230{VW\231"
+	.ascii	"\007\223\230\026#\377M\345\r\265F8\377\242~R\030\215P\027$RE"
+	.ascii	"\366\024\0328bD2]\353\2632\305\307\023\0214\r\272c\013W\026\316"
+	.ascii	"?!?\250::\264\"\250!+Q\230\332\227"
+	.string	"\216+mqc\277\247\224(\257\016\355\r\347\237\217_\220\377+\013M\202\234~A~@\216\250\270|\341\374s\312\311\022c\272\301\371\036\314\355\337\017\324\211\335\250\tQ9\203\003\307\217\211\215/i\306\223\024\217\377\230n\033^\03478\377v\240e\250\335\234\235\026\316?\0359\314~6~6~J\035\236P4Qvp~5\366\222\224\371%\375\247\024\305\266u\205\363\357\006\232G\204\r\230*\234\177Hx\210\327\0161@p\376\035\341!+\227Z\017)C\204\3146TA[~D\377\021\375jtx\nr\243\273 \2559\273\323rG\\\340~E\377\325@\333RW\207\363\217\306\305\366U\032(=\234\1773.\306Ud\214\r\347\237\214\213\345l\341rK\002U\367\327\375\204r\236\035\332!\2426\210\023\007=a\030\0353\276\354\376\023\372/\250\204\211\223E5\247\344\341\354\213\363kS*\247<\0318\373\366<"
+	.string	"\002gH\036\316\367\275\231bS\002\005\347\373\362|z\377\032\374J\332b\003\347{\360c\373\340\370\360xx\231\211\203\363=\320\261}w\2767BGG\274p\306\367d\372$\364\246\302r\340\354s\343\373\2626\344N\006\316\037B\265\004\307\321\333}qo>6BT1)W\017\2451\317\373\330\334GW\302\304\307~FC\230\254\231\223\363\265\251MQj\204h\256\340\222$zF8\373\340<\220\241v_\0315\237\232\243Dm\220#?/Hh\264\356\332\242&\0219fSK\324\240\271O\315}iJ\230x\332\023\23482\234\357s\3639)\342\025\005\347{P\205\307\322\022\316\2763\2766\261!\036;|n>h\330\341\3543\243\271\200Lf\234\335\371\310\334\307\366\257+\016\032K\322\354\337\267\026%\203\013\316/"
+	.ascii	"\231\375\002\234\215\215\371\304\034\204\346P\0312\003\030;J"
+	.ascii	"bU\202\t\226Y\230\373\304\334\227V\302\004\016\223\241\303\t"
+	.ascii	"\017\347\373\316|h\377\212\352\030K\272\302\371\005\360\262\357"
+	.ascii	"3\213\322:\352\201\363q\001\266\204\330lR\244\360p\366\225\371"
+	.ascii	"\300\354u\311\302Z\323\252\232\302\331Gv\262\2563\254\036\276"
+	.ascii	"/jdp\340\375\306\226\210\255\361\342\353\222\216\021\261a\006"
+	.ascii	"\315R\3014\201\350}\211\211]\264\243\264\251\313M\017*Z\264\370"
+	.ascii	"\300wPd89\222%\213\017\354\007\263m\233D\244{m\336$9\357\003"
+	.ascii	"\253\363\302\0266\026\345\bMK\016,X.\332\315\320\034*\203\304"
+	.ascii	"\004V\265\025\025\301\371\005"
+	.ascii	"\240a\305\312E\353\360\024\344F;!mQ\271\013\322\306\314\033\234"
+	.ascii	"\337\001\031*[\276\256l\243m\207@h\016\271\265m\223\b\016]\356"
+	.ascii	"\2524\357\353\272\257J\t\023's@\234*Y\\\377\212\263\210\251\233"
+	.ascii	"\202\363;0\333\257\323n\377\327\234(x6\332p~\007\316\375\016"
+	.ascii	"\254\354\337\207\344:}H|Z\"\232m\320o\r\227S\007B/?\222\204\221"
+	.ascii	"\222\335t`\tI\341\360\236\354p\366e\335\207\005|\n\002E\306\031"
+	.ascii	"\316WMFqw8\277\003(\373W\f\037\321bB\345\351k\342K\342\253\352"
+	.ascii	"\232\362\3645\301U\270\t\t3\224V\243\256\254g\023\337\222<\344"
+	.ascii	"\203\033\244,\272;\237\225\017\212/\212\317\211\357\311u\372"
+	.ascii	"\232\370\230+Z\024\231:`~\0078\366;\020\332\037\021\307\247\004"
+	.ascii	"ciU\241\341\374\021p>\252\021l\373#\276LM]\271[\245M\272Q=r("
+	.ascii	"\335\265m\223\bm\225\346)\t\347\217\330\362I]j-\352\360\204\226"
+	.ascii	"Ij\022\021d\203\005\225F\t\021\"\030\254\203\002\260\362\230"
+	.ascii	"\255RS\007*\026\2426R8\177D\221\375\373\240|P\030\3546\333$U"
+	.ascii	"\310\030]\331\325\215\266vh\307\323\323E\3332bf;)\"3\234?bF\217"
+	.ascii	"\036\276 \n\230\222\307Ls\224}\241\362\001\271/\210\325\022\263"
+	.ascii	"\b\347\327\371\234\376\257\352\024,YP>'\337\217&3\\\232\254i"
+	.ascii	"3\223,\212\030\237\017\325\n\360\311\255\215\033\316'\300\033"
+	.ascii	"\237\016\237\016\037S\230)p\317 \0217`b|<\356c\322h\352\270\242"
+	.ascii	"p\366\355\300Z?(z[S*\020\244&Ur\340|\002\274m_\222/\311\207\343"
+	.ascii	"\031Z\263% \330\217(n\276\245\373p\354pr5\341\354S\312UN~\240"
+	.ascii	"\235\331\260\341C\002\321\266\355\2146\206\033V\334\263mr\022"
+	.ascii	"\241\226\305y\222\341;\272\017\351\226Q\215\330\232L\004\b\333"
+	.ascii	"\276\032\276\032Wnm\333%\241\233\263J/\n\r\032\367\315\215\336"
+	.ascii	"\261\277\240\tJ\302\371\0048\342\013\362\005\371d\320\021\240"
+	.ascii	"n\210\223\210\324\351\264\344\344\223\341#\3221\272\241\003\347"
+	.ascii	"\337G\344\033\252C\243\004\r{\265\3012\0369\270|B\004p\332\377"
+	.ascii	"\272w\235\353^V\233@\211\205$#\002\354\270\273[\365\304z<\335"
+	.ascii	"T\3412\312\373\252\247\231\360\242\200\340\375_\177l\206\242"
+	.ascii	"L\341\255p\236\320\245\241\252\021\354JzC\343\215JT\346\354\314"
+	.ascii	"\027\316'@\321\363\271\272Q\"\346\251\352p\312X\253\373\352\206"
+	.ascii	",\312\323H\024\316k\233\225\016=S6F\003\347\225\315J\247u#"
+	.string	"\215\031\272\324\r\221]\022\2729\017;\326@Y\347\262\215\324)$\214)/.n;w\320\025\263\307\025\242$8_\304\231U\315\372\266\252\331\3165k\266s\007y\231\003\356\265cFp\276\b/\373\"\262\366\352\266\272m\347\002\2644=\313\206\230\254\340|\021K\332\332V3pG\314\270\034<\334\340|\021Se\312\254f\306\202\350\312\256\3267k\244\034\231A\317\324DY[\202\363E\f!C&\312\020a\330\2144h8_D\216\375\257c\326\262U-#\335\326Hi\025\033\302\023ac_D\320\376jvW\264\264\217\335v\206\022\007g\2317\317\020t\373!\310\354\217\375\307\033\b\225H\tB\2053\230\2625L\024\234\247\227\375\020]\\\270\254d[AC\350\216\200\371\362\225L\214\334\325\035\316\257[\275\374_}zE\354\232^\272\370 \262&\225\317\324\270*o\254\340\274\216\205\210\262nY\267\254B\b"
+	.string	"\005k!3\225\003\347\2078\022\006\307\204r~\305=C8\355+\353\327\025,X\246\344Qav\341\374\0209\366C\f\355\257U\356\352\345\3651\264\250\2251\246"
+	.string	"&s\003\300\333\037\273\230\250m\2056H\203\254\020\251\202s\223+m\312mS\206\226\b\314\315\376"
+	.string	"\344\366W)w\235\262f\255T\322\246\333\316PZm$\331\362\\\263?\2003\3737m\322\353\325\232\265^\255BV\254\025k\025B"
+	.string	"\254\240\261,E\264p\376"
+	.string	"\322\366\007\020fe\245\205\331\365\344\t\231\001D\331\377\332\244\tz\226\253\264K?8GtyWN4\220\360p\376"
+	.string	"\216\366\2772W\346\336\256\252\232c\302\024q\001\310\355\177\245\242Z\022\301$L\007(\336\231\324\027\234/"
+	.string	"5$H.Z\007\275\261\337\021\243*A8_"
+	.string	"_\366\277N\255Ss\002\260\262\377Uj\225J\233:dh\211\272\2200\243\354\257Pw%\262\022A\317Rh\205pp"
+	.string	"\205\211"
+	.string	"\224l\337E\317\364:d\035\242\355\226\004\300\264\006Y\203\254B\256\200\005yn0\035C]B\322&\324\f\330\23158_"
+	.string	"F=z\254N7\230mS\223\210\fd\350\t\366\343\253S\366R\246E\007\316\253\017\241\233\272\347\221\223\345\035cR\304\300\331\261ceZS\203\031T\322\321D\b\217\257L?0V\222\252$A\263D%\005\347s\020\267\346Xs\244\211\303l\233\234D`5\247\267\2452KK\027\355\n\031BWv\025&\016\231.fHHk\322\0172wM\213\027%8\377\353\215\257I9ac\3153\234_\247\211\374_; \005e\f\347s\300\265\332Xm\\\264\333\343J\204\017\214\231t\003\347s"
+	.ascii	"e\2574V\032k\215\005t\301=\333\246&\021?08<\312\244<\215=\277"
+	.ascii	"\026\261\341H\323\342|\016\212\254D+\321*\203\002)\253X\r\"Q"
+	.ascii	"8\2572\310\240\250\231\302\004\347s\320\003o\025\302[\203\362"
+	.ascii	"\362\326\240 *\331X*5\347\346H\357k\320\332\356&\267\273\"8\357"
+	.ascii	"\275&\037Sv8\237\203\243\035'\227y\373\302a\206\3637\310\333"
+	.ascii	"\337\340\214\335~cww7\226CV\244\213\007\316\337\340l\177\203"
+	.ascii	"\257\375\315\346\356\272\272\247\251h\257R\033)>\236\033`\355"
+	.ascii	"\022\334\247\351\177\323\321\211H\301\004)=\230\033H=\237\"\326"
+	.ascii	"\266\205:\242:\t\332@\307\333\216{\203\203\213\262\204\024\006"
+	.ascii	"f\006\347o@c_\0036\373\337j~\235[\215:\207\253\264A?\261\271"
+	.ascii	"6\035\276\272958_\20353\333\315\314Fs\346\314FS\2472\221\t\026"
+	.ascii	"E}\221\262\333\276\321\234L\247\031\342\343M\003\347\276\006"
+	.ascii	"J\330\330\260\2704\b2f\257\215QSs\243.i!;f\364\300\371\032(\355"
+	.ascii	"g\200\247e\237i\331i;m\225\302\365\365\265e\3136\233\322?\226"
+	.ascii	"n\017\346\231\252M\366m\266\303H\261jc\206\001\203\2621\267\264"
+	.ascii	"\312\324\2706\307\311\0223Ne\030G\016Z\335V\026\316{l\177\271"
+	.ascii	"\242\006\247\350\313\366\362\245\313\325P\224\016B sN\266v\227"
+	.ascii	"\214$\211\371\343\016\347\315\345\226Q\273\342f\006\347-\266"
+	.ascii	"\343\334\350A\264\365\177\005\032\341\360\022\004\347g\260f?"
+	.ascii	"\203/\033\313\006\303\262\235__\333\271\203<\200\341\362\275"
+	.ascii	"q\343\243\b\316\377\316\362\355\314e\266\332\334p~\035z\366\177"
+	.ascii	"\325c\222\362\340\340\374\f\266\354g\300\265\377m\305\n\252\325"
+	.ascii	"\241J\213\303\347\345(\211\325U\333\206\351\300g\326#G\034\234"
+	.ascii	"\237\001\221\375\315uwW\027\252\265\323\266D\202\250L\310d\360"
+	.ascii	"c\377\242Z:koe\355\346nJ\221\262\251<\203\220\352dO\371\246\022"
+	.ascii	"\027DC\246\215\023\347\255\225\313\374\200S\322\302\371uX\355"
+	.ascii	"\377\212\216\211*3\204\3633(\332\007\021\267\177\267\356\276"
+	.ascii	"\272\232c{\262\255\236\\4\335\266\267\371\224\244\3246)\211\330"
+	.ascii	"P6\224\213\2667\007\002l"
+	.string	"\037\204\222&M\242,\201\030\262\377\315d\336\255\333l\223\f@\006\304\216\252\252\223\245\320\n-\201\020\205\013\004\r*\252\2136eH"
+	.string	"\352\220 \tZ#%\265\247\324\226\266\221\357\2518\025J\220\223G\332\224\324dF\344\214\b\221\264\251C\263\305q\200%\272\262+-PPP\226\250<=\241ZCH\300\n\200\223 A\320<#CB\"\273/!8?"
+	.string	"SNNhY\207*-\016!\026/vp\356\3326L\007\277\251\"4/\234\217\301\334\376\267\217\355\003\355\222\301\034\031\f\32045]\264gh\333v\250m\203"
+	.string	"\321dA\030|\341\301\003\325\322J+\215\256%O\347\376\267\216\255C\312\023\203&\016\034'\273J\033\313\320\224'\006U\373\337J[)mB\213Z!(\016\242\004A\335\270q\345v\333\266N\306\350\312\2560\300\261\177\247\334}\344\334Gw\253C\0334\007\202\223f\007\307\200h\377\333\350:\267\021\276\"\200\271%\245\246\016~6\240\250z\350\025\025\3356)\264m\033\324l\2236\3541i\022\241\036\t)\352\202\363\001\260f\306\214\213\266\333\266\r\312\320\016\311\3051\265l\242Mt\333n\333\352-i\355\177\0139\267\020\206\302\031Z\242%HL"
+	.string	"4\331\377n\235\273\305CD\264BB\031\314\315)\265\035\034"
+	.string	"Sq\342\334\267\333*\231\300\343\362\261\325<5\357\312\355\274\031\003\200\321\376\305\272*\234_\247\nG\225\273Km+T\245\003F\344\222\230\177J\026\200~J\020\352\254\360-\217E\020,\216H\343\036\002\035Y\370\330$\320O.\"\227\304\374\026$\224-\226D\237\017,8\026\211\311\365\207e\215+\020\005/xX\027~z\200\324\tz\200TvId\223<oA\"\271\034\022\227F\326\004\027Jb\n\326\b\324\303\266\340Q\262I\241ri\004\"\256`M8\026\221\037"
+	.ascii	"\036\223@K6\211<\356e1\006\2333\364\020\331\344\212t\311*}X\037"
+	.ascii	"\335s,\302`\223\332hd\227+R\037\375\342\310.Y\026"
+	.string	"z\005\024.\030\213\304\024+\240p\341-(X\016{\212+\353S\\.Y\026C\027<H#O\320\005\313*W\244K\345\021\311\223\362 \215C\3441\231dY\034\213\311\344R\271[(\201\214+*p\301\2034\306\220\\\0167\364\034\331\027~z\200T\037\"\233\\*}X\237\341\221\375A\n\217\354\017\322\207\365Y\261\331\242\013$\222g\305\357\310\376 {Vh\021FP\217\354\017rE*\302\b+{,\032\217E\344q\363 \215F\"\3333b\263\306\342\212\037\237\245\312*\221F\236\025\372-H\374(}>\210\221\244\200}QdyX\027~\224+\304HjX\376\260\277%\373\302\222}\001\310\247\270$\002Q\200\355\001Z\026\227\313\007,\331\027\200|\212\023,\211>I\344\n\275by,&\177V\250=oABE\321\310a\005\2215f\030\310d\213%\362\250\032\221\313\344R\251\225J\226\207\207\250w\n"
+	.string	"\002\214\254\\\262,V\244\313\342\261\270\272\340)\246\240`\t\204d}\212)\226\254r\303\357-H\364\020c\350QQ4~@\242\202a\0171\206\236\240\321\bt<\"\217\252r\t\3643<\026\227\306\"\220\212\341P\250\\\002\375\344\345[\220\320\312a\016\013\342\022e\207\025\310\240dA4\242\300\262 *\201|l\222\b\243'IL!h4\002\371P`4\002\261\340\202\207\270T\262C\225\rA\361\205\241\013\036\342\362\205\341\261\270\3020gY<\236P\036\213(\204=\307\"\004\200-\234@\021\201\026N"
+	.string	"{\222\310\013\370\020\223,\220I\024l\004xz\210\301\025P\270@L\001\371\"\311\276\340\003\343\007\250\227\305\343\t\240\n \345\320H|\301\372\024\227?\016\032\224=G$\017\273B\207\037\2265\372\264\016\252\"\220P\256B\023$2\004G \301\372\024\227K%\321\230\303.\203 \354\024\215\306\242ONQ\251.\225Dc.Ab\251$\032\365\022\b\211\206@b\t\204L\267\b#(\221I\236\242O\216\222\205\255d!\006q\005\240\237\022|\212\312\337[\220\350)\376|\260l\301\242h\\\321\201\365).\177\220H\025z\212(4"
+	.string	"[(\213\307\"\n.x\220\306\022\330$\262\204\234e\361x\302\247d\301h$^\300\247\250\024*+"
+	.string	"d\202OQ\031TV\300\005O1E\361x\302Hd\223C\021FP\"\217\304#\020\005vI\344)\366\034\2139?\337\262x<\221\204"
+	.string	"2E\005KV\311\272\240\374\365\034Ye\216\t'P\034\213\304\025\\\360 \215?%\320\222\270|\201eAD\301\301\005\017R\005\237\n\032\226@%\b\217\354rYL^@\331\223D\366\260Jb\362\004%\313\202\210B\003p\230\302\013\017P\001\005\035\037v\251\214\341\205\t6\254\200\302\205\023\330\b|P\262\240T\n\203?H\244\n\024\344,\213\307\023\034\322\030\210F\266\007\370\026$\220\305\236\245rC2\311\366,\225\272\007\205=A\013\026@\310d\213\024\036~\330\245\322\005\317\217\003\b$\226I\342\017\t"
+	.string	"(+\260<\262/<\340\027\344q\241\002\032|\212\312\225\3459\022_\364< \003PY\001\326\247\230\302XD\201\005R\005\237\242\322\367"
+	.string	"\337[\220`]\020W\f\221\311\030X\360\360\020GD\200uA\\\361\363\201\201B\271\376\260\313\027\214l\017r\205\tXc\021\205U\203\262\002\313\030,\013?\036\027z\210\254\013I\344\222h\004\362)*sX\034\213\307#\220\0130\202\372\204\017\214\037\rF\343\003\222H\024\224/\370\300\370\001\300\362x\"\203\017\f\024\312\225U\032\201P\260\306\236\342\272,&/\340\003\343'\350\003\343'G\2504\301\007\306O\006\n|\220I\024\220%\370\300\370\341\300\032U"
+	.string	"!{\364\362-H\304H~\300\342G'yT\016c$\207\254\022h\270B\231\344\311\211\221\364\375\020}x\222i\222\355)\276@&\177z\330\030I#\261\230d\225\032b\260\306\037 \023V\030\211-|lO1\231d_ \207\307\"\210!\013 \343O\007\rKV\311&{\216E\025\303%Q9\364\001J.]\260?\312\013\200\254\221\310\343+\362${\212>\351\261\350\263]\360\260-xb\020}v\216\322H|aD\376$\331\345\361\004O\262\202c\221\207U\002\rc\020}\2061\222\277a\f \3420\006\321'G\231D&\223\354\006\215\374\261?1,5xX\261\002\271\004\342\301@Y\214A\034\262"
+	.string	"R\301\366\024+`\177bX\016\331\027\305%\361E1\311\366|H\"\227<\304\025C\344\022\2108dq,\266X\"\221>\312!O\262C\017\262\230d\177\206+~\214C\326\207\230\\1\344I*\207E\2452\351\241\2478\\\026\217@\301\022\306\030Ie\316RI\\1\354\001\"\252\030*\201T(\205\310\242o\331\263B'\211K\245O\207g\311\263\\]\034\213*\260K\342R\271\246\340)&\331#\313b_\204\021<\030\201\204\030\352I@"
+	.string	"\b\b"
+	.ascii	"A\237\004\004\354\354 `\204\235\375\021v\320\3450\271\\\022\205"
+	.ascii	"\3135\311\272H\"/\360\323\003\264\262\303\236\023.\224\304\345"
+	.ascii	"f\207l\017r\0056\td,\022W\004\331!\373\023C\212\245\222\005\002"
+	.ascii	"\001\353B\222\355!\"\215K$RE\005.x\220*\374 \221*\034\213D\037"
+	.ascii	"\340[\220X*\221?\303#\322\307\007\311C\\"
+	.string	"\022Mp\301\2034\036+\340\203L\376\260l\206e\316\221E\321H\034\016\325\267 QB9\214\301.\201|4\f\365p\250&\331#\f\344p\250*\223\254\022\3508\034\356\236c\321\305p\250\225\307\342\217r8T\217\310\242\262hd\207\303u9\\*\213\306\foA\302\203\0366Il\241\364\340"
+	.string	"\313\030\354\361Xl\261\374\031\016+x\301&\177\206C=\324C\315\206\240\250\034\016\265\013\036\244\n>\344\213$\253\004.]\240\360\201\361\243\227C\027\307\242\n?=@\353[\220pq,\032\177z\2002H\262/\222\354\013\312\342\356Y\201\213J|,\016\223==D\027<H\345o9$*\1771\030\213>\304\025\303\343\272L\"\177\336\202\304\261\370\301\222=\026\227\354\321\002u9\\\225:\331\323CD&\331\020\f\217E\345~\301\303&\3632\211\374\311\311\236\036bvq,\252\340\003\343Ge}\210I\024x\\\360)*}\313\241\b#\264X\002\371\024C\360"
+	.string	"\240r\230\023\203\270\002\220\365)\2460\"\221?\312\265\207\210TA\350C\026\227D\027\214E\342re\227D\027|\212)x\212F\236\030x|\354\222\350\002\fb\f*\353SL\001\203\030\203\n\203\230\001\026\b\004I\344rUQ|\261\262\312\"\362\230*}\210I\"\n\237\242r=\317\322\247\250\334\313ar\371\263<\026\201\326%\353\202\207\3703\364\351Y\341+*\221?\300\037\037\342r\215\341'9L\022\215@,\216\304!\220O\261C\bb\210\221d\215,\017\017q\230$\262\307\242q\b\344S\274`I\004\002\301\360\210,.\211\313#[L\"\207@>E\nB\020C\214a\f\313\"\017\322\310\276"
+	.string	"f`\361\303!\311\372\024S\364\260\034\224C\026\305\025Gd\t\031\330%\321\005`\206#\262\250L\262/\216'|`\240\320\340\003\003E\017\313s\214Ay\254"
+	.ascii	"\253\004\022.\225I \b\260J\240`\f\311%\353\303\032\331\024\032"
+	.ascii	"\226CU\311\202\230\002Y\324F$\017r\211L\242X&\221?\312#1\231"
+	.ascii	"\202\003\213#Q\305\262\b\201%\262\205\322\004V\t\224\363\202"
+	.ascii	"\355AY #\321\002\306\236\023F\342\262\310\242\330\303\341X\364"
+	.ascii	"\371\305 \372\374z\216D\037\037$\317\261\350\343[\036\201\220"
+	.ascii	"%\260F$\n\341\212\037\025|~\\x\013\022\t\340a\177\224\313!\353"
+	.ascii	"S\\\016\207\233\207U\016_,\365r\310\342\2104*\207F#\221G\031"
+	.ascii	"\203r8\324\300\303*\217\303\027K\365-H\f\177<<\304\255\034\262"
+	.ascii	"K\342\362\205\036\226\375Q\366\020\331\026\353\261H\\\301X$\246"
+	.ascii	"XY%\261\305\217\217}Q\\\362\260F#\222\307g4\"\223\271\005\317"
+	.ascii	"\262\370\223\262Kb2/\211@ \310\310d\f,2\017\017\021]\016K\204"
+	.ascii	"\320\303\262\312\254\034\276`M@&c`\261\276\005\211\242\221m1"
+	.ascii	"\364)*5P\016\227@?\307\023E#\233\202OQ)d\215\313%2\331b\271["
+	.ascii	"(\211"
+	.string	"0\224\251\261H\\\346\023T8\201B~\013\022K\036\240\344R\371\201\222\375\211a\371\201rYT\361\001\320\221\205\0071\200\216E\243\007\"\2140\034\201\204\030\037\260=@F\236c\361\203\244\022\350\003\003\224\350a\225@G\240\341\326\311\345\017\260\207\310&\205\311\345O\317\221\035\002{\216\354p\005\220\nVIT\021d\225D\025\303\037 \027<D\025\303\026N\fsz\216\354\220}AT\016[81\004*\223\254\213$\321g\270\217Eb\013\236\241F\036Ycq\305P-\241dA4\256\030\252\313\241\332cD\016\177G\037 #\222g\230\004\342\031\376X\243\n\342\362\305P\270\002H\3052\211l\241\034\256\313a\013'\206>\027<H\3430]\016E\030a\305\n\344p\270\"\207j\013'\206\277\345\013\036\266\007\3113\334-\234\030\006\211Kb\317\220\355)\302\030\372NP\341\004\n\303\026N\f\367RY4\006W"
+	.string	"\251\030*\331$\313&W\f\201\313!\033\202\242R\233\350!\376\f\207\232\355A\372\f\323$\261\005O^\016\227I$\212\026|`\374\344,\207-\234\310\310\"^\016KH\262>\305\245\360-H,\201~\226@\310\241\017\214\037\020+X\023\330\237\030R\fW8\221\342\347S\\\242\313\241\013%\224\340S\\\356$\017\017jd\217Gb\013\036\2255\022y^\360-Y\345\212\025-\260J#\320\317\017\006\322\270\"\311\276h\201\345I\"W\004U\345\220\345)\276`Mx\013\022\037(\223\354\213b\262\347\202#\177\330\344\007K$2\371\301\357\b\003\331\263\004j\241\334\312a\n\013\004\227\305\343\211\245\022\371\263\221)\214\304c\222]\3068\001\231b\231d_\034\221<\0344kTAT\026{\324\236\025\224E\3412I\\\276\360K\227\303\021v\226\307\"\320^\036O\260\313b\022\306f\227\254\361\307\007Y\002\273$\366\374"
+	.ascii	"\tY\243\nb\212\027z9$ay,\002\251\313#\020\222'\355aCP4\022\213"
+	.ascii	"\313\342\261\370\353a\325\345p\271\277\263S\002\210\n\260\020"
+	.ascii	"\201\315CB\205\024'^\370`\311\262H\022\227\037\034\213D\237\017"
+	.ascii	"x\222\312\017H\004"
+	.string	"@\271\002\353SL\301\032U\020\217'$\221K\244\217\006#\022\t\201a\372_\210%\313/M^\225\242+\\\302\265\255\275#B+@\253\034-8f\340\204^\300&\027INH\220\260+\335\303Q\270\210\314\020VI\341\344d\025!BCxu\241\226\360J\330\334\222\2026C\213p\312\205\315\013\267J\230xZ\220]Z\032\316\027R\021J\021f\t\261\322\b\255H\240\227\205\t\316M`RR\222'(\352\234\024\023;\270'@\037\350\034[\022\230\023a\023\2441lV8\337\265\031b\254\340,\244\022R\t\231WI)\001Ism:\204\314\277\204\t\341\222\346\231\252\"K\204U?\302\224\320\250O\022<\301\021#T\222\261x@\021k\303\371!\210\331\2770\311\246\362\303q\266C\n\022\365\307m\266\001\203\346\210\266\361{\032R\202f\212Gnj\276\2512\262\006\345\300ib\304\224\302e\304\034\r\025I\343"
+	.ascii	"\271\222r<!\242\342P\323\363\221\024\245}\350\243\2670\031P\273"
+	.ascii	")\034\222\262\311Ystf\313\023\260]\277|E\311\023\002\234q\004"
+	.ascii	"\214\022\\\020\031D^\210\230p\316Y\213\256\fM9m4z\255\315\n\354"
+	.ascii	"\207\325*"
+	.string	"d\251M\323\207\226\222\003\366\006\212G\017`\030\337\225S\0210M7r\256\212pY1\351-\256\"7N\036)X\312t[3\"\334\361{F!\265B\035Z\313K\0273\007\260J\352\nX\023\207n\016\227\230\234Y\322X~RV\234;\224\200iR<\247&\257$\240\034j&\013\333\026\022\322*\344\031\216h&c!l\331\277\360H\363\270<\252\312\b\261\241\n\245j>\262\306\030i\0349\254\352K\256F~\002\213\232\\i\213~B\302'axW4\202o|kG\214\360\230\221\356@\303\210\2306dd6tkD\302\b\211\246\330\300\316\240\341,l\205\255P\350WI\217\221\021\006](\344\234\262\027&\204\254\r\007N0\216\222\237\223\336\203q\254\272\340\306p\016\346\005\361BX\262\177Nuo\262,\335\375\252P\036uepv?237!,\016\364\223J\022#\367\251}\352\002S\203\022l\003"
+	.ascii	"\256\255,6>1\301\031Q\334\234\321\371\330\360\210\363\366\204"
+	.ascii	"s\360\371f\352\005F\347\205"
+	.ascii	"\363C\220\332\177Pn\247\251NXe\302\304\341!E\230l\221\002\247"
+	.ascii	"\312U\3750{\303V\332r\3549\327\254E>\275\2521wj\2663{\275\275"
+	.ascii	"\321K\263\247\220$\261\222\325\0246\241\2113\207\346g\267\325"
+	.ascii	"\260\001\033j\013&\301H\236\244\310\234q\002\314\342\204I\232"
+	.ascii	"\031]%\274b\"\373*\003<\223\242\355\320[b\003\272\311\341\321"
+	.ascii	"\306D\216\314\031\324\307\0320O\324\036\\;P,MP\021\335\030\235"
+	.ascii	"\006\313\220\333\313\022\003\344\222\023\246\345D\225\266\346"
+	.ascii	"'C)M\006Z\360\306\232/bxgA\0329\250\262ty\372\240\223p\311b\342"
+	.ascii	"\374\353\f\206\001\256\005\227`\021\242\006&\350c\307\333\227"
+	.ascii	"1e>5\252\026\016-<2/`\273&\305\366\005H\244l\313+\017gyP,K\260"
+	.ascii	"\313o\027\241\366\254\002(\230J\352\310T\260\313\203c\301,5\""
+	.ascii	"9.Z\036\334\362\257@) Bp8?\204\037;\b\366`\330\277\006\353\346"
+	.ascii	"\254\240p~\b<v\320\031\302\322\376\203_>\2606aI\306\260\370\272"
+	.ascii	"\202M\247\262.W\310\366\222\233\251$V\264\036\336\230\323-\350"
+	.ascii	"\025\034bg\245\213\221`\327\257F\226\026\"Ep\336lXebA\256\037"
+	.ascii	"S\033\354\302DH\223`\363\247\324\245In\t\316*\033\340\023\330"
+	.ascii	"\033\217**i\223\214\037rs\301)\253\020!G4\330\264\2009\234\250"
+	.ascii	"\246\206\340\034\304BK\260\267\267\267\227\327\266BA,\034\224"
+	.ascii	"\022\314z\020\3539\252\333U\221\220\316A'A'\301(\237@(\211\357"
+	.ascii	"\356F\224\264\007\255\036\214\222\316xk\303\206s\020\312\311"
+	.ascii	"6^\226-38\007\237\234LE\033\023%\244\304[\363\253m\2339\272-"
+	.ascii	"\312-\r\223\324\212/\312\033\265&&W\t\302\252\224Y\362\033\263"
+	.ascii	"\332\261\2219U\245rX\no\312PP\311\317\355\310\310+\n\316RR\301"
+	.ascii	"$\267J\2334\001\233\033Qm\206\024\235\005\221<\230\204L]2\304"
+	.ascii	"\203\f\316A#\301#j\224\324\f\037\301#\301\251!F\340\374\330R"
+	.ascii	"\330$\211\203"
+	.string	"3[\324\203D\242~n#0\341:)FWJh\t:\005\235\202C\204\220\334\335\2418\200\240\025\005\237\036\034B\206tc+\007\316A!\277\264\026\007\r$\234\203A\016w\223\200\001\301ja\304x\225\260\022Tz\020GP)\350C\312\231T\330\036\323\203>\036\354Q\302\304\311\300\004\335p\342\374`S\220\307\317\214\223Y\336\217\340\016)A\230p;\202:\204Bd\246`\3516Mu\013\210\2156\230#\270\324$X#X#x\343\032\241Cr\247$\303K\030\322\2037~\030qUh8\007\217~i]\250d\021\341\034\264\241\335\264\221\223\033\016\234\203F'\033C\362V\002\311\335\201o\356\2024\240 \3415\331\332*\2426\364 \215\007g\2240q2\036B\252\270r\240\204t\234\341\034$\362`J\350\b\025\316\3016(\204\367\304\001\366\304J\211\230`\220\346\202\345\r\225\025\234\201x\300==65\314"
+	.string	"\261\250\301k\213\243\207E\210\036\033\017\272\007\325\220-\300<M\266~Y\tc\303\031\bG\263\375_+\240\212\203\005\213\231\266(\242\022?\346\346\200nn\2256I\210\343\306\022\272+8qZFu\007\272i\273+\202\2073\260\215v\366\020:\022\304\306\007\205H\222't9`\352\204\300\355\357\214Y\263\006(w\204)dr\345\210\003\214;P\316\311\026\223=8\337\231\020\2249 \034\360M\263\311{r\304\207X\220\217-h\320"
+	.string	"\323\334*mR\007(O{Vwj\024!l\354\200n\007\246Y{\362p\372I\375\326\300\311\022\215X\250\364\243\316V\307\311\253\242 \212\324 \b\025CL\325\320\264 "
+	.string	"\263\025"
+	.string	"@@8 \221\buu\364\016\024"
+	.string	"\022d\304\210fD\244\214Y\024\"\306\f\210"
+	.string	"\200\004"
+	.string	"\200"
+	.string	"\200\002"
+	.string	"\200\230\354\241O\213S\221g\006Eq#E\021\346\"\310\343\017\260\207]q[\226\362\257#\273\351"
+	.string	"\337,\234\261\332ZD3\266e!n\344\036,\020\f\006^:,\"\341}\0218\207\272\244\207\203/\374Y\224\001d8q'`|\221\0174\362\003\027\374\301d\364\374\246\340\027\367KTv5\005H\306\313\243\227\322fL\324,\314\035\035L\227\350\203\274\366w\204\235\b\2208/\353\214\030(\017\212\247\304\230]\360w<\371y{\355\337\223r\246\"iV\222\313\021\256XUf\\\n\274IX \366l <i\234|\246\304Ix\025\024\305\256l\325\274\t\"k\303\267\373F>\322O\352\301]\215\312\034"
+	.string	"\204\357K\3571P\366\3158Q\020a\"\030\275\263\206\321'nV\343p\232\212X\326\263\377\326\005\361[\255\022\336\371\251\317\230\330\034J8\353-\245\002\023\371\314\365\224\366\261\267\341\2174\b\305\256\355\2120\220T\215\263$\315\004\220F\363\016\023\226\351@\2627\036\023c\004\002\3245\333\3074\203\005\235I\321 {c\306\261W\006>\332\"-\313e\016\310]S\344\214?\370/v^i\341\373Te\274%\310\254)\037\261\037\224\001\333\177A\366q\214\252|\023\330\033w\350\321\243wN\237\031\274O\237\001\"\354\242CQ\240\364L\026\360\315\255.\004\315f_\026$D\206\017\324n\352\300\f"
+	.ascii	"\375\025\235\347\021\234 \240\243\275\301\256\004\\\206\360\274"
+	.ascii	"=S\030\301B\307&\254\225\332# '\227\2410G&\023\371\256\217Z\367"
+	.ascii	"\335\335\0058\246\255\300*fa\006\0308\234&\230\270\022\300}\t"
+	.ascii	"\334\266\263{T\017\304\007\313s%\217\361!t\273Z=$\220y\005\275"
+	.ascii	"\236t\016s/6(\363\222\332{V\202\031]\204\311\325V+\030\370xa"
+	.ascii	"\351u}\331\271\344\314\366\304<6\207\363cq&B\222c\210B\3555\030"
+	.ascii	"r7W"
+	.string	"\301\020\f\022-\227\204\023\203~\276)\233q\030\037\221\352\334z\001\331\362\320@\327\032y\n[*<\233Ps.\226\320\"[{\346\273i\245\024)\3171 A\203\217T\277T\013\266\272\356\371\273\212a\247\0272\233p)>\214\335\261\214l\3518\257\013\221}j\357 @$R\024\016\026'\275&#\362a\367\017r\025\346\305\231\322\274\rp\271\244d\350SZ{n$\005\221\025\200\312M,\377)\264\347\013\214\226\356(\254YC\376\356\304\357<C\343\0205\2513R\373/\212\300\323>>r\346\025\217\360XW\215\312\262\017-\364QB\300k\261\023p\263yl<%\025=\266\325)\025\205\r,\323e\243\2722a=<\341yn\241P3Lp\035\320\354}\244I\024\317X\360E\231\245g[U}\005\r\341j\216{\"]\221Qc\261^\372\250\260\030\013\354\376\323d\241\216\210\311R\034\225\323 \327\003`"
+	.string	"\206\377\377`\360\006\237\275\013:\243\324\006\276\b\371\346\232v\271}\366Kz\216\367Q\306\234\240\2215\267\311\276\0015t\343\n\240\016e\030)'\204q\036Hb\270\251\305\245\246pVy\032F\247\274HA\253n?X8\006=p&\252\223\234\217 \346\027\020EO\331\244P\375\253\250|"
+	.ascii	"\313\367MB{u\367\024\f>&\322\212\260\236\004G\2314?\367\261\341"
+	.ascii	"Sw\353\244\303\232&\255tsr\377\247\376N!\221\210^R\332_\254\207"
+	.ascii	"'b\301\3111\006\307E\211(\006\214Sf\nc\205\307<u\301`N\301\226"
+	.ascii	"\275c\323\211\343\261g\357p\332\r\343#\271\356@\316;\261'\314"
+	.ascii	"\213\025\372\330"
+	.ascii	"\241^9\203E\274F\035\372\367Z\315\355\240\310^x\306L"
+	.string	"\rL\002\254\365\3604\310\301Mw\320\2163tm\217\363R\275\n\337@\324\265\205\270\231\254\314\242\313IQ@\001\255a\033Y\240\301\325\345\324\360\311\020u{\355l\342\034\022\3442\311\bL\306N\200\277\313\316\350M\002\375v>\013\256Q\213\240\310\230\2220\351g\311\277\255~\227\004\337y\255p~\006\352\024\2350k4,D)LQ\331NJ\265JB\233\337\332e\317[>pN\030\233\177\021\230\366W4\036t\266\342\223\0246\263N.\347\233\241\\\344\336\357\277\3133\026@^\200\256\264\276\341\202\240\005\2025\237@\017\236Q6X4\200\341\257\334\213{\375\227\255\214\345\252D1\241\f\213!`\326\036\200\216U\361K|1\002\n\234'\240/_\220\241&\241}f\237\177p\bw\322\230\320\260&-M\261\236EF\311!\350\224L\263\235\235i\0275M\220\212\223^+\355\027X\376\276\266\326\363\375\362\034\206"
+	.string	"*\021.9'uUv\025\t\245#\370CB`t\177D\235\340\275Y\320\253\340"
+	.string	"\3416\251&\321q\004\360/.\264\205\t\021\016\275\253<\247\256\372\326\355\226\013\277\367\212\374\246\3258H\302j\341\362\322\033y\350:{L"
+	.string	"\023k\246\343\026\226\216\315\207\241\251LG\032`\242O\213\b\3778\335\237\217b\304b:,\261\323\320!\1773:S'\017\356\201\313\332\357 \230\204\232s\302\022L"
+	.string	"\2178\307{\326\367>\rq\024\026\215\001\315\231P\226\020l\324r\302Md\300\271\331\226\317\373t\371fsbx\035\035e\216\230\"l\272\226\210\331\373yp\225\366P\013\025\315\320\033\350g|\304\224\2500\326\244%\335\304U:\263\335x\374\013\002\336\032\364rIjG\027\305;\376\324`a8\216n\faw\256G\215\232\324w(\364\\\251(\354\204\270\354\221\0279\306f\001~ml@\260\be\256\267\002!i\325D\323t\361\273\242\305V\347\3154'\212\264\271S\3020R\021;\250\017v}C"
+	.string	"\030\252]\341\356\016\222\210\3060\267%z\271\304\353)~\276\225v3m\200\241[|\274\004P\303\221\335\251L\252dzS\362\262^\325\262\303\252\036\370\242\224\206\377\311\367\372\310\023\020\340+NV\366m\266aCV\260\212\254\237\312\207\034\262!)\314F\213\255\216\231e\024\330Y\310\033\211]\366\036\353\273\306$\214v\320F\220\227*)s\005\227\2250\n\334u\223"
+	.string	"\211\353\217b\254x\355z\371p\253\276\341\023C\234r\200\212\005u\315\274\333\352\276\t\227\353ih\243/\355\242L\242\273\215"
+	.string	"\310\246p8S\251dh\305b\224\243\264\351q&u\004(\211ESQ\003l\t\275\032\312\313\201\030}\314\302\331\356Z(\320\234,_\350\3045o=\351\005\273\362\266,\263\351\250\260\307\210\351\247\270:\266\035\001\216C"
+	.ascii	"\350\230C\367o=c\231\215\344\200\266<\357\365l\001\034\0273\305"
+	.ascii	"\214w\264\312\243XB\332J\0277\233+\\"
+	.string	"\263\307\310\257P?\263Co-G\271\027\246\256\205\035\036)\364\240\242Wz\t3\306\303K\005\213\2239\370\026\021w\246\025\334\226G-\204*<\370:\220\304%b\364\350\365\300\260\246rN\004\244t\244\030\372d\211r\240\335T\327}`\307k\270)w\201\022BQ\261\223\355C\350\243\272\020\236-\220\302\234*SI\321Jx\363\266\252\374\r\264\321[\337\331\025&\335\037\n\361\020\372\363YZu\274W\324,\206-\016\217l\304\331\276\324L37\274\262\332\026h\347\356\214\237\\\303\301\217\322J\243\346\350xH\216\343a&\001\033=\302\225Jx\201\027\356v\355Qu\330\331\261S\267oz):~Nu\307\265\362:\b\235\247\336\373\307\024\342\353\312E\322\033\345s\036\250|\"1t\343\2525\343\373\246V\223\"f\204o\335\353\2014)\370\350L\003\236\270\252\255>\353\002\204\\\350\210D}?\232\0031\335;"
+	.ascii	"\276~=\203\016,\232\346\032'\223S\312\263\025"
+	.string	"E\372\034\235\276NC2\203/\312\207\334\342}C\273\003\242iUf\202\300P\201\330<f!v\376\030m\366yL,P\253i\240\312\202u\337nY\025pin\003\272\306`\t\2737$]s\337uC1\371`\265\207\334r3\035\253\"\277\2565\352\222\225\367\223\351\002\314\353\217K\256\217\n\352eeW\301)\272\250\261\212\321\212\016\323\213\366s\250\260\270i\031\"M\226\307\323@\344h\221\030\365X\002r\232\235\315\362\037\220U\300\260}\365\236\343\372c'\353\036\262\307\"&j\"\215\t?\270E\343\202-5\377\313\261\200\020CD<\355\271C@\250\267\006\216\031\230o\327\020\354\177\2127\272VPP\030\304\330\"o\325\223\212\006?S\370\006\255\002/\263\254(N\030\0042\302\265F\315\317\242\235(R|j!\242\245\004\215\246\315\321\35238n\240\353\241\256\241\230\200\232\222\330g\324\340\264\034\025\220\242T"
+	.ascii	"*9\037i\371\024M\325\210\225\266\326\023#\036\215\231\213Q\372"
+	.ascii	"t\324$\024\037\275\016\310\353\320\353\023\214`3V~N\235\023\023"
+	.ascii	"\2422\377q\370\024\355\201\334\202\303\251\315\366\325\030V<"
+	.ascii	"\340<hLP\f\\\372\330\361\013s\177\334pr\263\370\006E\353R\315"
+	.ascii	"&\353~\311x\360\203\374\023e\230\232\366\204h\257\277y\305x\217"
+	.ascii	"\324\222\274\370\245\377?%>1\037\037\013\034#\t\367\362\354,"
+	.ascii	"Ss\352^\342Q\027+3\004\313\243\356g\361V\202\306\363\244\b~\313"
+	.ascii	"\306\bo\264\313UP\205\374L\201i\306m\n\313X\373_e\351\317\331"
+	.ascii	"di\345\326\263\221K\305$\362`\316g\217r6\357G\237\0322,1\372"
+	.ascii	"\321`\353{\203}\324\200\033\244\373j\226\274\3300\215Iq\366\321"
+	.ascii	"u\322\345\306\321I\273T!\252xw\272\b\216\372\037!\202\322\to"
+	.ascii	"'\004\207dS\"\331p\327\037\020\212\360\\L4\307/'\245\336e@\267"
+	.ascii	"K.\351\013+pB$\235\361)a*32\350?d'>7\230\311w\315\237'\242q\337"
+	.ascii	"\330\372\355x\234P\303\320t\271\366\246\t\316\264U\242\265\205"
+	.ascii	"U\246\2725\364>\226\2039\311\274\374)\341F\r\217_]3G\212(\022"
+	.ascii	"nJ:/p\362\002j\361\030\254;T\315\271\355\t\232)\323\347\270\347"
+	.ascii	"\222\373~\222\252\346~\330I\214\360\030\216\026\357@=\263\340"
+	.ascii	"\217Ta\326\3403\352\217\020\237\024\336\245\267\326\345\243\027"
+	.ascii	"\333TI\340\303\205_1\2117\0162\346\023\232\btyy1\355\244\340"
+	.ascii	"w&\350{\267\315\221{\025j\026u\341\247U\347\347\003|\2567F\003"
+	.ascii	"|X'\265\302\363\372\026\2559\371\276\374\001{ \225Zc\006\020"
+	.ascii	"\316\225\204\252B\365u=m\332\305\226*9\225Wk\375\244\372\235"
+	.ascii	"\210\276Q\243\307\b\2506{\337\315\324i`$\025Y\317\307\177\323"
+	.ascii	"\202\245Vg\224\341]\3366\002\247\234\343e\032-T\211\311\214z"
+	.ascii	"\013\3164\231y\243\3130V\260\001i\360\315\272B\2264\r\342\\\t"
+	.ascii	"4\312\303@S\257<\343\037\006?\224\205\240\242`\355\345\365gy"
+	.ascii	"\353y\300B\265>5\rK=\344\002\367\275\007\274\203\\:WE\270\322"
+	.ascii	"\215\246j\030\355s\302\217 \364\375\3330\370*J\262U\207\204\020"
+	.ascii	"\324\343\025s|\234j/\274\363\330\262\266\302\335u\374AO\322\224"
+	.ascii	"\374\216k\201\253\213\001x\206S,\264\262\212-7\001{o"
+	.ascii	"#\242yT{\034E>"
+	.string	"\374\023?9d\325\242ysO\230\242\230\002\270\241\370\310u\201\374\267\272\266\244\305\t\024aX\2278\363\257\313\262g\007E\\.\331\344W\254\373'WX\024\262\260\243T9\b\235\n\3342\020\022\352\321L\307\344\371\274\211\325\322\016\324\274\220\315Mw\300\322\350\326\2042\253^\247`\t\331>\234\227\3518$\313\373\023\tkF\264A\320\253\016\256I\340&\377W\363 ya\201K\007\377\323\212\033ET\357\311\"\264\230U\272/\247\246| N\253{\372F\020SO;\035G6\003\016e\360:\363\326\301\303>4\022\017\274\277Q\375\026\226\300c\\\252\024\f\352\374_qqc\021\212\034\331\301\370\020S\363A\340\346T\270\301\005\304\003J\006\2211P\3008\364\261Mk4O\223\335\316\331\304q\327%\205]|\367\224\322\353\310\306%\354Q\240\360\024n\250B\364\007\373.\264t]\022\\7\231\277\350\252o\r\305"
+	.string	"O\340\230\037\205\364\304\366\343\005\355\223pb\331/pv\017M!rCA%u\213\317=\324\2618X\004gl\343\256\310n\244?X\341Z9\005\352Ox\nq\372\307\345\036[h'=,\334\376\266~\022\270n\225\034\347\030r\340\022D\277\206\024KC\240\323\214\351wf\255\241\360\355y\005J\323\350|\300\350n\372\"\265\033\027\244#\\\364\212\240k\203\f.|u\313\351\316\351\225\350\210y\266\2508o+r/N\b\004h.\345\242vH\226\275\200\256L\352\301k\275\333\236\237\217\301\022s\244 \227\210\344\301e\325\211~\331\241\352F\243=`Wj\260\374R#\222\317+]Gg\345\255\002\003\270*\307\033\375\202\244z?\016\345\204P\b\245\321\333\246\326q\005S"
+	.ascii	"\372\256+7q\322`Fc\321\022\215j 7\333\313\357\220\340\310G\247"
+	.ascii	"\261\243\274\037\344\304\341/Z\037V\354\266\017\026is\202\036"
+	.ascii	"\362uy\344\005\273o\225\253\352\026\304\246\246`q\202\023Cl6"
+	.ascii	"\032\345\316\233\302\256\370\213\312\312q\301a\224;]\351\231"
+	.ascii	"G\311\023_\361\224\004\004B8\336\200\342\261\226\2504\243i\027"
+	.ascii	"\206D\206#;\362\013\201\021v;\017\243/\366~I\350\355S\035(\213"
+	.ascii	"b\357V!Ht\021\365\344\022\202K\240\002&\271\304\334\016\324<"
+	.ascii	"k\243\350\3607\204\354\034\240\220;\246\207\363\206\0221\252"
+	.ascii	"\327-\266)FP\341Rw\230wW\371\020\357\306\3671\205\272\305\346"
+	.ascii	"\3342\027\252p\016\3505\324\255+V\375P\376c\237E||\312!\226\243"
+	.ascii	"a\307\377\333\t(\354\322\305\f\301\236\302\275\027\214\327`\006"
+	.ascii	"\371\370\262+&)\306B\004\263\370\334aJg\302^vT\322\230\356\336"
+	.ascii	"\t~\306:\223\241mD\0138\274\024\251uL>>\302[\361 H+\004\214\361"
+	.ascii	"i2\376\301\360\345\224\\*bP7 \317\377\317\212\341\234\305}\340"
+	.ascii	"\022\276\2763\025%\030pw"
+	.string	"\300\357!\213\322\361\200{?_\356\226\231\361\263\351\263\376I|\366\241b\241\224\277\026>z\200a%\034\335Z\364!o\367`E\3475fZ\203\352\274\002 \335\376\237\321W\220\03754\361\2552\320\311n\340\326k(\270\025\0169F\204\344\264X\017(\026\275\363\203qnx\020\351\307\326\036\030\3667\256pR\256h\230\240\3051\303S\224h\271E=}\274\331E\313\207\272:eu\223\245;\204\200=\262j\251\330\351\350\007,S\025t]\":)6\3759\351\322]\275OcG\233\221\210\263\316\031\276\307\241\302\350\266#\t\206\221'M\255\201\b\244A[\322m\027\013@\213\272\253\030\\\007\023\245\243\320:l\004\016!c\214g\032\016\035\232\r\260\027\247\210\241\017\355\\\036\370c<\265\357\367\250\235\270\262f\"\351\242&\017\003t\004\221\320\270\002\342\306\303\345J\\\272\377n\231\026a\263)S2\335\266\247\262"
+	.string	"\267(+\346E^\036Ew\354T'r\025\225\225T\345\034\027W \351\305\336\210\301m[}\327\033\350\216CL\216\304e\234"
+	.string	"\3354P\357\020\362\263D\024\325\224>3\304\376\260{\260\251&\264\260\031\373\354N\013\006\005\364\271ymqC\202\004\247 \0277r\304\023\335\214^\366a\227\026\210\n\021\005o\226A]:\215ozr\302\260\362\001<1\005\351\313:\212Q\344\273\322\311M\356\350\261F\367-\203d\006\2779\304\034\032*\207\3772\203\200\306\236\007\252\203\227\023\375\343WLA8\327\332Hz\215\247\346\251QR\221\360\n\255\3308n!\256l\237\341:\274WRp"
+	.ascii	"\344\3643\331\345\341\2052\326\302\305\3234\303\204;\214'\255"
+	.ascii	"\270\375_\007\372e}-\373\201T]\326\262\020\022\036\202\224g'"
+	.ascii	"\236<\240J\204[q\241+\360u$\344\020\246\232\263]!ye\330\226\210"
+	.ascii	"\344\221\255\357y)\016\342\207\314~\235s\317\2004\350\251vZ_"
+	.ascii	"\003\013\326\377\222 \271\"\272\216\020\037\225I_8\370\335&\270"
+	.ascii	"\313\207#\3555g\"\211\026\037\320pm\225\225\307\336mCX\005\321"
+	.ascii	"mK\254\rk\002e\2001\207\215\242\242\220\006e)0\027\363\244V\342"
+	.ascii	"\362\021\237\315\024\205\267Q\304\274R\367\024c\232Y\032|\305"
+	.ascii	"\016\345\336\344H=\334\t\233\020\334\264D~\235\274\213\257\235"
+	.ascii	"\t\232n<\214\2753\257\334\354<3\351Q\371\\\227f\346\023\375y"
+	.ascii	"4\205s&\004\274\342\004\313\242:r8\365+\222\220t\324M\305\273"
+	.ascii	"\013\344n\212B\323N\025\220\321g\310\001\3302\373\327t^|\007"
+	.ascii	".r\357\210[\201#/\361\321\373\326E "
+	.string	"\361U\f0\317~\217\350\346\276w\237\210\223\260r\277\\\351\2146\205\301\030E\360wYNP\204U\262\367\030\\\276\207\323\031T\266\321%r|\341\021\314\036\210Me\212!|$\260\202}\031\372k\254\204'Q\204\211s\372Q\006\330\311%\202]\235\247Q\274g\271\363\"IE4\210\t\302\202\272?\320\233\257\317z\274Y.&\204y\033e\226\3628\312\022\255I\371\277\341\t\013\317\017r\235\221\022\241\004\327\2228\025\020\374\026u\306\212\223\313\255&?\216\006k\035w\361m\344[\234\200k\227\342\370\3028rz\027\301\002\254\241 \345!\003\032o\347\245d\205G!3.)j9\367R-\034\370xUh\"Ke\362PVC\314\327\323}/Ov\342?v\330\344\327L\314\2129\024\034l\376wo\254x\005\212\347G\005`~\253\016\t8\366a`(<\242ReXw\245\320\307\301\256aP\322\t=\220"
+	.string	"\0253\204\032\tH\325\353M\332\220\007Q\373;\240\315%gl\f\031\001\320\276\226\304|D}\334\t\202\327h\376\346v\0221T\332\322f@\2709\002v$\265+\267\331\354\253\227\201\230(\211\024\304\374"
+	.string	"\344\2067D\214\314\005\375\bXma\245\367C`,~\t}\372<\252\036{\017~\202\377Az\241\\d\260\277\240YQ\214\272_"
+	.ascii	"\257`\025X\330\337\2711B\033\324%\035\002N:\203KV\354]G.\302"
+	.ascii	"\037\242\b,\275\007\350w\266\321\262\351Ek\026Y\306f\240g\341"
+	.ascii	"\330\314&=\240\253e\376~\020\005kg\243\346\272\353i%\242\274"
+	.ascii	"\230G\022\211+M9\3226\320\b\344(\307\024xd2I\221+\177\n\240'"
+	.ascii	">f\004\3656\023\330}\350\374\233F\250Y\234\030\262\037\252R\206"
+	.ascii	"`S\017\250-\347\333\331Z0\024o%\205\316a\0166u\006\250Y\276\001"
+	.ascii	"/4J&\031\007"
+	.string	"Ws\003\255\251\321\326\271\267e\307\342\237\304pj(\315\367\371\261\006\031\220e\331\267\207\0078\251X\243;\374\204\ne\024\263\244\004\032\027LT\212\373\353G\220/`\016\337\001B\353\354\316~\026#6\243`\271U\271\002\345\223\370\374\256U\247\341"
+	.string	"a\024\2701a\257Ld\003\024\005Y\235\016Wj\003^6\002i\260T\013\355\340m\275\316\272\r\247\200'\210n$\346\300C\3301v\251\252\373\333\030q}#\220S\005\007\31679\205[c\177\bCb\201\017\025U\232j7\033\241yf\261&\205\224\234d"
+	.string	" \3764\003J\276[\343\\u\3165_o~\037\207\234\206\370\364\226\235\233\303\n\034m\370\260\3236\236\243{\t\027\036\263=\246\277\326\306\311\251N\231\344\255\216}Fo\017\216\225\255E\035\202\270\326\f\360\2570B5\251\267\331\344\025\017\273"
+	.string	"Y\335W\013\b\360'#\244PO\375\021\036\203\037\247R\271\362\t\362\327\213K\0047\370\\>\r\232 @0Z\001.r\230\327M\267`|w\0168x\316W\033\253\352dc1k\247\237\323\025\005V&\370L\003bt\336wO[\225\0171j\037 \371G\242\2458\272\272\256\262\225\231\026*\212\270\255Q\240\311\311w\033\226\303X\270I\027\021b\250\372\253\264\305\t=\205\323PQ\030\273\337\236v\340\210\3555\357\374\3259\247\366\323M6\3648U\356\313\376o:,)J\004J\035jV"
+	.string	"\002e\311\320}\374\265c72\233"
+	.string	"\300zH.4r\370b+\214:\276\225?c\274\267GC\242-\300\b\031X\310(\22174\227\373\214\017S\007s\353\213\301>\007\311\376=\026\214=\233\3108\260\027\b\266\350\"3\256]L\033\2513 (?\213\004\300\023P-\211\201\f\254\266RW+Hr\372\351\302\242\316\240?\235P\254\t\242,\177\200X\236\246\006\234F;\t(B\361\367\333"
+	.ascii	"\232\323\271\003\220'"
+	.string	"\332P\371\021H\330\013O\245\1775\232\r\224\256-\023\233\031\314/\344r\332\322\bUx\325rJ\241<q\273g\266\366\317\310\324Qcx\221\201\2268\013&'\311\200\354(a\343\035}PG\211\216\227\007M\217k\260\377\241\025qS\212\212\226~\001\022\266\377\026\361\363\354d\211\216\022O\260Pdrsht\204\353\033\272\002\371\342\227\372\234\355\017\230%\023\rG\222s\006\202\366rG.O5}\370\321\265\255C\277\277\005\013x\217l\222\245A'\250\377W6B\003?\b\212\002lA\241\327\217\227N\214\320\b\317\355\3602X,L_\204\bo\026\353\274\321:\224<\264\336\327u\006i\323\213\247\024\260\325M\36063C\270\277\331\362\b6\262\334\267\024\030k\253\225\220 '\344\343\374\3262p/\246\341HD\260\f+\214\245\025\242?\252YN>\fz\316\035\275\266\360\205\006\243\301\f\355\202\205S\2601\361"
+	.ascii	"\225%Y &c\362\204\310\374\311{\2016\363?\210\301\222\345\f\226"
+	.ascii	"\222\270Xd'\237\026\024\264C\0014\304A"
+	.string	"\220\2247=\244\006z\322\247\371\321\235w\356\350\220\205\22706\266\177mt\246\242\2743a\343%\341\341/\221\204\343X\366a\331}!\177\374WO\006\265\277]\2133a\363(\207e\016~\224\277\363\336\3729\252\2431\264\314\307\265c\255\320X\334\262w\376C\324?7\360\207\251\275:\214.\356\325\265tc\270\270\202\250\330\335\325\225\300y\310\347~\270\240\2667\336\267\270?\372\352\214\314C\257\266m\026\326\267\2267\224\216gz\267T\204vj\274\262?\305\213f\347T\366^\301\376S\210>\357\255\313k\004~k\336\t\311\377A>\007\322.W\215\276\320\351\030Og\355\233\035/\360\312\"\031_|\372O\260\355\250\347t\2434U\265s\344f\337\355<\251\306C\034\263\273\3321Ae\313CK\326\240\377S\352\315\234\273l\362E\274\275\310\364E\272Rs\322\032\231\353\332\307R_X\022\343\217|\356Z!fK"
+	.string	"\0370\207_\b\323\337\315=m\177\006=\005x\1770\rc\013\033A\273\234O\367\225b[\340>\216\362\361\367\272^\366\246\224\216i\224E\311\357\0348\233\3000S\225'\341\356f\n\257G\022\342yz.\262\341\243\362\224\373S\342^\205\270-*\362\215\230\357\355\267$j\327k9\226d\226\367\031fK5\203\316\341\326\206\325\027\224\236\273\032\217z\364\024r\354\020\324/\"\270\021s\3608\352\314@/-rm\253\237\202\234\301\315\336\b\273Q\374\"5\230\207\267\247\272\361\201 \017\355\334\213\234\347\271\377#\320\231\203\024\313\271o4\372#J^A\255i+\370\005vj/\262\373O(\314\324\3231\376\216\020\353\016\250\271\353\304\334\360\260\342"
+	.string	"\332\203\023}\003\206\037/1G\016\364\351\222>\275\026\023<\256\311\3257#\323\235\355<\270\037\243\256\223]/C\027\335\364!t\026D\370\213\246SK\\\231\005o\342\361M\r\253\253Q\356i\334\351^\217u\274\017\003\220G\027j\365\013_\326\237\326\376|;\202\246\207\361\327\247\216\0342E\335\037s\033&\350&"
+	.ascii	"{\372>\376of\322S\372\002\214?\367\355y0=\230\344~\314\323\306"
+	.ascii	"\n\345]\022\262.\215\236or\374z\266F\245\275\3451"
+	.string	"\016\334G\026\375\304N\017\326\323!\212\321\306\346\372\324zk\2409\201`\236{[3\231\313\364\232\341\t\035w\346\320\235\276#\365M\223.N8s\357\227->\271\346#\020\317\244|\347\231\3613\265\243z\204\003\252x!\321_\352\347+\223v\306\343\031\t\317\004/\013~\216\3603\371\304\340\316\365\265I\362'x?\310\337\203\221e92\374E/\3764\234 \335g\027\334\346b\231u\272\377G\3327\326\310\006\024g\253\004\337\337\220\230w\335\215\234\343\365\271\326\311\031=\007\0314\224aOM\370\260]\"\206!\330\334\006\3720\305!\r\035d\355\253\243Z\t~\325\362*\n\371\342\236\375\260H\237\341\356N\213\306$\030\322\305(:\036irF\252\313\371\324%v67\371\212\351\207\211\037U\346l\257\377Y\035:\345\200}X\266~\275\032\\\372G\260\235\026\367>\252^$\2430\226\370\bR\\\240\300\336\347"
+	.ascii	"H\347!i\377\303\312\365\374\236wlmR\033W\336\025\360\2140y\234"
+	.ascii	"\305\"'r\317\334Gqst\361\375\364\265\232z\032\274\353\342b\r"
+	.ascii	"\2773\270\316\366\250\007BbDQ\342\"\016\250\277\276\3749~-\332"
+	.ascii	"\264v\300\033\224\3547\005\305r8\344?\tN\360\321\333\373\361"
+	.ascii	"N\316.|>\036\331\302\243\276J\373\356\025\323\331\031\326\250"
+	.ascii	"\354\336\364\002\377G\337\202\235\354\227\244X\346\370\030yy"
+	.ascii	"\200\336\317\204\3641V6\3753\274an\223\374\375\315\347\305\277"
+	.ascii	"\342\341\2239\0332\2751Q\017V\205g-\376.\250|u\230\026\242\221"
+	.ascii	"\217\016%3\256\342X\361\321|{Z\264\357\257\247~_\335\371\004"
+	.ascii	"^\355)Y\372\333l_\323\267\022\273j\346\246\322\327\257\270G\235"
+	.ascii	"\333x6\310\375cfo]\335\354\255\243\344\355\302\360S\3039\374"
+	.ascii	"\257\340b\212\277\022[o\370\267\206m\205'=U\250\333\bf,\f\017"
+	.ascii	"%N\314\227\023\214\202\312\004k'\030\365\364rr\276\251\023X@"
+	.ascii	"\032\316\367\253z)5p\320\273\3429e\343\003\t\254\007<\215>\220"
+	.ascii	"\303\344\321\223_\225<\376\003"
+	.text
+	.section	.gnu.lto_.symtab.1f5243c49cc38346,"e",@progbits
+	.string	"pwmIsMotorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\004"
+	.string	""
+	.string	"motors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\004"
+	.string	""
+	.string	"lockMainPID"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\004"
+	.string	""
+	.string	"sendMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\004"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\004"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\004"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\004"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\004"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\004"
+	.string	""
+	.string	"nanos64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\004"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\004"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\004"
+	.string	""
+	.string	"micros64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\004"
+	.string	""
+	.string	"updateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\004"
+	.string	""
+	.string	"millis64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\004"
+	.string	""
+	.string	"micros64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\004"
+	.string	""
+	.string	"millis64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\004"
+	.string	""
+	.string	"micros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\004"
+	.string	""
+	.string	"microsleep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\004"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\004"
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\004"
+	.string	""
+	.string	"delay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"timeval_sub"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\004"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\004"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\005"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\005"
+	.string	""
+	.string	"motorPwmDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\004"
+	.string	""
+	.string	"simulatorLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\004"
+	.string	""
+	.string	"simulatorHasMotorRPM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\005"
+	.string	""
+	.string	"simulatorGetMotorERPM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\005"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\004"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\004"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\004"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\005"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\005"
+	.string	""
+	.string	"spektrumBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\005"
+	.string	""
+	.string	"unusedPinsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \005"
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\005"
+	.string	""
+	.string	"_estack"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\005"
+	.string	""
+	.string	"timerHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\005"
+	.string	""
+	.string	"fakeGyroDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\004"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\004"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\004"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\004"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\004"
+	.string	""
+	.string	"motorPostInitNull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\005"
+	.string	""
+	.string	"motorUpdateStartNull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\005"
+	.string	""
+	.string	"dyad_shutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\005"
+	.string	""
+	.string	"dyad_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\005"
+	.string	""
+	.string	"dyad_setUpdateTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\005"
+	.string	""
+	.string	"dyad_setTickInterval"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\005"
+	.string	""
+	.string	"dyad_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\005"
+	.string	""
+	.string	"fgets"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\005"
+	.string	""
+	.string	"strtol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\005"
+	.string	""
+	.string	"strtod"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\005"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\005"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\005"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\005"
+	.string	""
+	.string	"simHeliStep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\005"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\005"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\005"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\005"
+	.string	""
+	.string	"pthread_mutex_trylock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\005"
+	.string	""
+	.string	"fflush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\005"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\005"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\005"
+	.string	""
+	.string	"fseek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\006"
+	.string	""
+	.string	"clock_gettime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\006"
+	.string	""
+	.string	"simHeliMotorRPM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\006"
+	.string	""
+	.string	"simHeliTailRPM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\006"
+	.string	""
+	.string	"getenv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\006"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\006"
+	.string	""
+	.string	"ftell"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\006"
+	.string	""
+	.string	"rewind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\006"
+	.string	""
+	.string	"fread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\006"
+	.string	""
+	.string	"pthread_join"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\006"
+	.string	""
+	.string	"simHeliInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\006"
+	.string	""
+	.string	"simHeliDefaults"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\006"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\006"
+	.string	""
+	.string	"pthread_create"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\006"
+	.string	""
+	.string	"udpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\006"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\006"
+	.string	""
+	.string	"udpRecv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\006"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\006"
+	.string	""
+	.string	"nanosleep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\006"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1f5243c49cc38346,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,197 @@
+	.file	"ibus_shared.c"
+	.section	.gnu.lto_.profile.75b3380a229a1982,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.75b3380a229a1982,"e",@progbits
+	.string	"(\265/\375 %\255"
+	.string	""
+	.string	"h\031"
+	.string	"\001"
+	.string	"\303\370\326\315\t\b\002"
+	.string	""
+	.string	"\002"
+	.ascii	"9\211`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.75b3380a229a1982,"e",@progbits
+	.string	"(\265/\375 \031\205"
+	.string	""
+	.string	"@\r"
+	.string	"\001"
+	.string	"\002"
+	.string	"\003"
+	.string	"\002"
+	.ascii	" \223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.75b3380a229a1982,"e",@progbits
+	.string	"(\265/\375 z\345\002"
+	.string	"\"\305\021\035\240'\351\237c(\340\223\306\272<\227\343\370\350\352\302BUU\227\200%\032\361{K\231\002\277a\333^;\200l\230\030\016\212\2726D\263\346`s\022\330\266\345\017-\022\b\207\240p\34367\275C\217\204\321"
+	.string	"\374.\004\007"
+	.string	"-\245^\302p\271\226b\270(\323R\354\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.75b3380a229a1982,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	"\002\001\001\017\177\002"
+	.string	"\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.75b3380a229a1982,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.75b3380a229a1982,"e",@progbits
+	.string	"(\265/\375 $\325"
+	.string	""
+	.string	"\220\030"
+	.string	"\001"
+	.string	"\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	":\3427\200\005"
+	.text
+	.section	.gnu.lto_.lto.75b3380a229a1982,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_isChecksumOkIa6b.36.75b3380a229a1982,"e",@progbits
+	.string	"(\265/\375`Z\004e\035"
+	.string	"\266\267\276I\240\330M:\3013\326\276VJW\223\202k,&\205\037F\216\301\227\253k\236\020\306\233\320\230\330\037\271\033c\237=\232\217+|\273\277\036\326\344)\340\306xh\235\030\225\336\200g\234\334d\220H?\250\207l\333\204\020\"wJ\001\251"
+	.string	"\240"
+	.string	"\254"
+	.ascii	"\246@\017\3366\262G\333\337<Y\344\255uW\362j\265R\340\bs\332"
+	.ascii	"\227z\017\243O\221xL\255O[\274ZI\005n@\017\232<Mx\220^\026\036"
+	.ascii	"l\340\300\310G'c0\315D\241\310]Q\251\225\234-\f\277\224eY\376"
+	.ascii	"#\357o\036\235\212!\370\355<\362\251\376\361p\022r\353e\351\220"
+	.ascii	"N\007\270P\341t1G\n\247\031~\007vG\232\\t\271\217f\311\213'\247"
+	.ascii	"\302M\360\023\225\230l\270\350\224\276\007V\244t-\351n\363\213"
+	.ascii	"j\372\336\353\323H\226\252^\226\256\351S\224Pk\365D\241Sq\303"
+	.ascii	"n[\207m\r\366G!]\367\314\271n\231\247e\350t\f\235\2069\371\277"
+	.ascii	"\304\246]>\365\267|\323cl:6\247a\260iz\336-\322"
+	.string	"\35106\r\316\351\0176\275\260\351I\247/`Oh\231\210Z\332\036Y\231J,U\t\330u\343\274\237\353\357\372\332\367\207\274\313\367\362\270e\364 \347\362y'\342\021\210\221U\355>\f\213\262\302\261\223\252\265\216\017\342oe]\253v!\005(R\n\232\025\345J\006zP\347\253\371V\007\342\361W\377Q;V\bZy4\307UEJ\005z\020f\326^E\244\203DV&\b%O\n\301\301-\234\260\252z?\276n\340BydQ\243\234\232^\272\327a2\312!\213C\253\224\273\271e\371\020\341\315.\331v\316\316\354\204#&\246\025\3136g\267\311Wk\255\337\013\2043\033`\237\243L\202\333\331\354\315\342\354,\202\303Q\2636\373\334W\322\205\232\375\022\315\266,\200=n\307m\226\236Y\232\275\327\277\257\262\227\373Z,#J\272]\250\257\023\205.+\333C\301\355n/\322S\344\323\360I\204\007]\366Dn"
+	.string	"F\226[O\213E\322,m\3626\027\312\376\203\030V\244x\237\354q:'"
+	.string	"\316\r\235\266\211M\327\314i"
+	.ascii	"\260i\232\007?\017\"\252y\340\241\371\360P\332\210"
+	.string	"\037\f;\266\235\036\352c\353\360\201\006\024\332h\036xv,\304\314\263\240\2076\264\343S\333P#\342\3603+\032\262\321\202h@4\333\354\303\317N\320\214g\2506[@\300B hC3\233\220\320\320l$\223\276O\236\"\202\3170\301G\231\325I\332\233\307\225\t\351B}\fz[3\304}r\314\302\320)\261\215YO\240\030\335\226\205\225\2405W\270\335\305\205Y\321\3516\313\313V(Q\t\277\357f\305p\277Ke\305\244\312\t\270\241\210\"Zk=\rp\267e\277\243\313\302\271\273\177\331\271!\222\334\027\275\213\204\342~Ou0O\250Q8c\020D\002eJ\202\232`Daa\032\003p\002\021\252\354\001\020XVT\222Bk!R\312\267O\204\247\354\035sO .\006\313\231\017\325\360\034\262o\002\031n\264\311L\352;\322\r\365l+\262\326\241\340|\034K(0iMq\234\016\361\267M\250\343\235\216"
+	.string	"\272\305\026\032\236L\\G\342\335/M\020BM\005A,\335X\b\200\036\030\314\326\0345\002\260"
+	.ascii	"\356\303\033\274\306q\324RG&xZ\300\326\275\263\356\002\214[\006"
+	.ascii	".~\317\304\270\004\254\357\365\310!|@\377\267\221\250\252a\236"
+	.ascii	"\366\2003_\331\225\022\247\r\017\272|\255\227\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.75b3380a229a1982,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002$\177\002\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.75b3380a229a1982,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.75b3380a229a1982,"e",@progbits
+	.string	"(\265/\375`N\003\335\032"
+	.string	"v\366\274J\260\226q\306\224\352\030Z=\323\262cb\223\b7^r\200>@~\324\267\3428\203\b\217;Vob\226H\333FN\377x\376\335+9\333\257\\\274\302\bZ\3568\342\033\340\363\320\217\002\222\001\221\237s\036\017\337\020\350\251\021\231\002\231"
+	.string	"\240"
+	.string	"\252"
+	.ascii	"\245\024\320\037:-\211J\317\266H\215I5\265F\017b\313kt\253\025"
+	.ascii	"%\3332\351B\377/\024\322(-\361$\024\355\273d_\033\027\351*\261"
+	.ascii	"N!\365N?\373b\211\270q\365#\024\357\215\213\343\26217\31178f"
+	.ascii	"\225J,\322\317\np\r\r\301PC\3215\244o\016\023X\217\343\220\364"
+	.ascii	"\215\031o\360\306\214fo\201\221\274\004F\3333\266\023\330\036"
+	.ascii	"`\273\201m*\333U\266\233lc\350a\333e_\025\266\241l'\331V\262"
+	.ascii	"\315\262M\304v\030\f\006\203\266/\330F\262Y7\001\354\232\366"
+	.ascii	"\326\023\257\263}x\0261S\364k\371:\377\224<\315\277U\237\236"
+	.ascii	"\355S\227v-\317\256%\311>}\357\246\372:{kz\266kz\317\366\350"
+	.ascii	"{&:\340\274\232\276]\235\334\223]\321\263U\323\327\311t\2252"
+	.ascii	"1]\231\270H\316\336G\370~&\n\003<Y\365V\377u\002:*\363\377T\324"
+	.ascii	"\312<q\243x\300\021\274'S\275\354\377\003>^\221\372\036\360<"
+	.ascii	"R\377#\036\317}\017J\026x\027\027X\262\370]\b\350Gp\366\367\375"
+	.ascii	"\345=\360\177\371\237\005\375\261?\n\230\323\310\347\373\211"
+	.ascii	"\f\370\376\013\244\357\314\310\n\006\357\314\350(.EF\222\030"
+	.ascii	"\tE\337\225\364m/\223o\023{\233.T\213\315yK\210d\222\202ASSN"
+	.ascii	"DD\343Z\221\0361\332\341\013e\337\340\334'\327\237\240%\006\r"
+	.ascii	"$@\241x\237\302\333\343\372\360}\272<\\\275\337'\3617\357]\020"
+	.ascii	"\340\336\005\255\251\030\346\322(\372F^\247\273\324\362{\361"
+	.ascii	"\304J(:\312\325a\273\245U$\205\311_\256\324\270B%\024\255\201"
+	.ascii	"\f\355\361&\372\237D\213=\312s\215\366\365m\335Kc\277\\\326\225"
+	.ascii	"\261-\376/-~!\253+r\306\0173E(\332V\360\026\360dk\376\001\273"
+	.ascii	"\035Yl\347c\373!k\273\331\355\207v\233\321^f`\334\207Z\016\266"
+	.ascii	"\303\341r0\227\033\016\007a\247\265A6\243\340\301B\317\217\316"
+	.ascii	"\003\255\306\023Ag\2031\315\226\253\371\324:\220~ s \313\001"
+	.ascii	"\301\342\034\035\033\035\233\3219:\261\230\216,FZ\026c\355vr"
+	.ascii	"v>\266\037\026\307b\021\024d\250 \201\244\325p\250\345f<\272"
+	.ascii	"\035\335\317\006\033,DnW\353\251\335j;\230\217m\326\003\243\345"
+	.ascii	"t\260\032\031GE\335\252\t\345_\262\037\002 \243IP\225)'Bi\354"
+	.ascii	"+\345[5\344ZQ\341P\022\212\027\310\rr\331\231+\304w\352R\271"
+	.ascii	"e\262gC\030Vv,\205\"\314-0\206\367(& @\002c\024\242\344\001\221"
+	.ascii	"\b\367\177p\207,X,\335v\207\360C\313\245\235\265\352\004hm\241"
+	.ascii	"a\020\021\232M\\\017\013\367\207\005.\030X\244\250\266\213\326"
+	.ascii	"\035\200t\224\003\n\243\021<Q Y|\300\016\236\232\002\351\352"
+	.ascii	"Im+\263>mW`\354,\311r\303\332\311\225\035j\315\342\265rP\300"
+	.ascii	"\203\204\230\fC\001"
+	.text
+	.section	.gnu.lto_.symtab.75b3380a229a1982,"e",@progbits
+	.string	"isChecksumOkIa6b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.75b3380a229a1982,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,567 @@
+	.file	"telemetry.c"
+	.section	.gnu.lto_.profile.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375 h\005\003"
+	.string	"D\005\\"
+	.string	"\f"
+	.string	"\243\213\367\305\001"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\243\323\223\377\007\002\002"
+	.string	"\002"
+	.string	"\004\241\234\233\266\016\002\002\001\002\002\005\006\354\301\314\336\005"
+	.string	"\007\346\273\301\227\n\003\b\240\342\234\212\n\t\352\263\360\321\b\n\210\304\357\247\004\013\220\274\332e\f\240\342\234\212\n"
+	.string	"\003"
+	.string	"<\3037P\343m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375 D\365\001"
+	.string	"$\0038"
+	.string	"\007"
+	.string	""
+	.string	"\003"
+	.string	"\002\001"
+	.string	"\001\002\001\003"
+	.string	"\002"
+	.string	""
+	.string	"\004\002\001\002\004\002\001"
+	.string	"\004\001\020\004\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	"\001\006\001\001\007\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	"\017\025\343f\230\033h\003"
+	.text
+	.section	.gnu.lto_.inline.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"m\006"
+	.string	"r\213!%\220'I\007\177\251>\026/\365\256\216\237\246/d\203\203\352\370q\315H\334\355\373\037\344KT|\220\266\333&R\246'\212\372L\234C\354@\001\027Z\352R.\001\004[9!W\271Ki?*\371\347BH`\250\003,\005:p\006\033\333\232\370\231\215Y\013>&\243H\256B\364ki#\201a\201F\247S\377\321\322\300\2166w2]<4\032"
+	.string	"n\352\335\335\341\237\234o\352\035\334\235\342\373d\016\343\356\354\221\271\020\033"
+	.string	"\211\013\261+\230\016\027s\224\024\025K\356\311\244\b\354\031\221Y\301X\315\260\262\f\243\237`\004\262\271\203\2336\3002`\306"
+	.ascii	"c\226\252&\226\256\177C\bdP\021\004\226=\025F\267\334\346\"o"
+	.ascii	"bV\200!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375 Y\355\001"
+	.string	"B\304\f\025\260%\351\207%\311\243\035\215B\030\006'\023\3256!\233\310\224\002\226\031\361U\323':\202\231M\341G\007\336\0343\342\247\353t\312t\266\f \233Z\016\001\002"
+	.ascii	"\365i\336\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\001\200\004\002\230\004\004\205\004\005\200\004\006"
+	.ascii	"\200\004\007\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375 _\035\002"
+	.string	"\324\002S"
+	.string	"\005"
+	.string	"\002\001\374\007"
+	.string	""
+	.string	"\001"
+	.string	"\004\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001\002\013"
+	.string	"\001\002\004"
+	.string	"\001  \006\001\002\007\001\f\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	" \b\2442\266\212\006P\201\361\214"
+	.ascii	"B\004\245m\240\r"
+	.text
+	.section	.gnu.lto_.lto.a1ad57870b0b9a64,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_telemetryConfig_Registry.36.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375 \246\245\004"
+	.string	"\004\bk"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\206\200\200\374\342\303\276\232\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\324\007us\250\347\006uq"
+	.string	"\005\001\006'\0010\005\001\006\035\001'\001\237\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/telemetry.c"
+	.string	"\006"
+	.ascii	"\331Z\b\204&\237Z\013\346\343)J\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetTemplate_telemetryConfig.38.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375 \223\325\003"
+	.string	"\262\006\031#`O\322\001\037#\371O\020\004A\003GQ\020\204\202\240\bB\001[\304\024\025e\223\317\230,`Ch'\031\005\334\201\376A\fJ\034R,Z<bl5n\216\333c\022\344\026\271$\3314\371D\271U\276,_\027\314Y\314\3239\364A\216Oe49b7w\325\330+\306.\344H0\b\246rl\266\345\004\b"
+	.ascii	")\"^NAcC\211\\\211\bN\244\264\202\201\""
+	.text
+	.section	.gnu.lto_telemetryInit.39.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375 \307=\005"
+	.string	"\"\311\"-pU\323\001"
+	.string	"\355U\f\200\013\327\303\345+\234[\214\177\215c\304A\202\354s\262|?\tl\257\252\216T\003\366\360\201\n\035\337\332\275S\n\226\242\310\264$%\033\322R\307\304\240T\232\020\215\020\256\036r\252UUS\241\016{\344\016X\314\354.\203\321b_\260\221\263\241b\343\t\030\276]\3127\260"
+	.string	"\203\217\306\366!_v\300;\314\276\223\231x\274\335\325x\371ux\371\347\274\240m\222C\302bw\r\265\255r\307\333N\330V\333S\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.40.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375`\201\001=\020"
+	.string	"\366\236nG\360\320&\035[z\264\243\265\275*\026Y\326\025f\210\"\272\237\032\375x\331\362\217\002\210\376B3\200[\f\035\266\341\016\325\302\277\335\350\220\351\243M\350&2?\301\205\312M.\257`\312\344\234\267z\242\326\310\336[\356\224\002["
+	.string	"V"
+	.string	"]"
+	.ascii	"\323\266K\016R\314z8\342\365\231\036\256\034\241ZCnk\316:\235"
+	.ascii	"r#\313?\354\222\005\211\030\037\330:\325\300\227O\321\313\245"
+	.ascii	"Lp\203'\007\tl\221\037\257\023\337\006\262\304\225\rZ\204bH`"
+	.ascii	"\006\t`\207\353\347\260G\027p%\306\fB\255\325\361\0035\334\331"
+	.ascii	"mS\260\035\301\376\214\"\354\313Zk\365\322\330\033\275i\017o"
+	.ascii	"~:\037\336\273"
+	.string	"\321\017@\340\347C\314\314\320\002\205\365\025\343Q}f\017\212\207\277\235\342\303\274\371!\013\244\025\326WIF\310F\301\247\037\210b\264o\363\026)\277A\361\250\326\020A;\265\206\013\314@\364\t\362\017\372)?\200>\353\350\202\271\214\353t~\t\223\234\246\177\242\237qG/`\350\200Q\211\261\234\025\036LL-\332(U\374\267\273\333B\320a\006\207<\213~=\234\240,j?\241\266\205\013\361\337\227\244\303\301\207e[\006\332\271\001\261\0056\324\340\324`\211;\374\243P\272\331\226db\256\236\225\030\263\303V\334#]\311\004S\252\313HR'\317TA\302\312S\231l\026\t\301\340\255:TW\322\255\270\324\311\204\342D\274\023.\344\200U&\235\307\255T*\217\333l;\254\227ui|\330G*xhLm-\345\356\210\213\241\230\355\\\027\333sI_\n\037\225]\241\333j{\330\005\330p\r\375\006h\334-\035"
+	.string	"jm9\365Zb\265\025Sh_u%\224\211\357EXU\030\r\350)4\264b\265\301\252\345\264Z\rHQ\r8\231"
+	.ascii	"\311\274\216\3130T\f\203\025\004%\fy8\253\005\323D&&X1N5CS\350"
+	.ascii	"W\367\031uPQ"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.41.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375`w\001}\017"
+	.string	"\306]iF"
+	.string	"\261&\035x\374it\f\233\323\342Q\016\244\203\365\323(!M0,j\276\212c\216\371\220\220O\361\212\261\265\016\0307-Vd\325Q\315\261\230\250\325\255\177ipm\310\314\300\022\306\016 \200g'm\223-eJ\001V"
+	.string	"Q"
+	.string	"U"
+	.ascii	"\307\262\017\210\307l{\001\003\224S\377J\274\274%\242\305\346"
+	.ascii	"g\367\323\224\304S\217\030\324L\371\252G\3351\003G\017\f\017"
+	.ascii	"\3041\210 \246\006\f\310\r\231\034\"\217CB\221\267J\r\340u\200"
+	.ascii	"!\273\373\327\323\305c\311\f\221\354\256\323\203\367\341\016"
+	.ascii	"\3356\311v\004\373(\002\273V\226"
+	.string	"\375\232?t\327\037\235\2060\2550\2350\375l\302\210\037\035\007zv_\202z\254\r,\306\214m\224-\262\255\337W\240^s\202\037\273\222I\241\263\313B\304\016\262c!0\323\276\212\323\240\356R\271\200]\026\220\316\356'b\005\3311\177\007\211\001\332r\202\232\033\032\230\262\034\372)\206\224\200\317kg\225@y\250-\027.\b\243Z`\347\271\273*5\027S)\274|V\td\177\347\3425\025\312h\t\301b\foQ\312vW\r|\233.Cv\342\230\257\022\217]M\300\360\210\241q\255d\220\375\251R[\366\341n\335Va\244\201\353$l\350NJF\335V\372\2700\262@\342\036\230:.\005\200MFN\235iC\331N6\223F\032\225\240h&]I\0331`.e\3534\023\307u\232\350\333\303U\226\023\036\347\251\307y\344yq\223\223~*\376u\b<379\330\237\212P]lC5\311\212\262\304\035"
+	.ascii	"i\355\333\302tL\315B\235Y\002\214\013\312\024\354>\214\235\251"
+	.ascii	"\346f\006\006\246\201K\251\232\301B0VT1;D]\020\263;\227\254\365"
+	.ascii	"\335\205\320l\214\303\224\r\320\244i\212\r\026\3452\341*\260"
+	.ascii	"d\315{\333U\364"
+	.text
+	.section	.gnu.lto_telemetryCheckState.43.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375 \3075\005"
+	.string	"\"\211\",pU\323\001"
+	.string	"\355\325\301\257\317\372\242^\241v\322\376-\025\310\206m\3669\301\342\375$\260\275\252\272"
+	.string	"\004\335\201\006\200\212a\377\336)\005\226\"\310\264$%\027\322R\306\244\240T\232\017\215\f\256\032r\252UUS!n\037\267B$Jl\016\203\321b?\260q\263\241C\343\001 \276]\312\027\260\036A'c\373\220/\373s\016\263\3578\223\316\333]\215\227_\207\227\377\315\t\231\206\035\016\022\273k\230i\225;\336\366\301\266\332\236\002\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryProcess.44.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375 \374\235\006"
+	.string	"\242\f.1pm\032\003\240\321ZG\277\267\037\035\224\f\020%\305\372\033\256>S\335\244@\020Y\"vkJ\016E\377\356-\b\323D>Yn\266\r\324\222H\231R\217\322,\304\315\203\020b\222:e80>\3525\274\3506\032\006\312M\360\301e\bZ9<\350bUA'\315\233\205\212\221`\023\355\354,\206\321\272\362\377e\241vqD#\023\204\223\337\"\005\345\242F\262!\265\365j\315\341\016i\217\210^\376\013\221\221\177\032\364 \300\r\343\001\213[\305\002\026\267\312\266\304S\343\016\251\240"
+	.string	"\031\375w,\303\322K\326\376\360\305\363\351x\001(\374\357\362|@.s\333\202\266\tmA\001\t"
+	.ascii	"i\331'\323b\242f\340\302\t\230w\t\200XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_telemetryIsSensorEnabled.45.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"E\t"
+	.string	"\366RB90\345(\035\340\341I\341\025Bi$\026\341\301D\370y\360\364K\200\227\344\2253\201\376c+8\240\0061\030w\246IIA\001\312\345Z\340>\350t\230&\027\376\337\335\244L)1"
+	.string	"1"
+	.string	"0"
+	.string	"\230\017\304C\333VX \271\364\317#\365\025\213w\022`\367\313t\365\322\263\344\177\344\360\305ZA\251,\236\231\206\335u\242T\030\267\336\366\201m\217mX\255\037jZ5\235\232~F \304\205\301\265\233\212\301\266\005\246\200\330&\331\033\333\231\366E\316\"\275U\341\200\335\r\027\312\356\207\340\004\315!\347\004\3610\247\214\371\232\372\027O\303\333M$4\273\027\036\237\344%\235\377q\350\211Q\036u\350\217\342\341\265"
+	.string	"@\313\2241\373;\245v\330\307\354\356Z9\034\037\334\326\205\264.\372\323\241\340D\032H\203\320DY\350\301\001\224}\270.\353\030x\213\320\270L\264m\\\266\371LwT\216IO\366AQ5\352\275\027\324T\325\250\342e\004\n"
+	.ascii	"i\331'\323\"\f\273\207\263b\2328TMwA\345\252\366\017\035\314"
+	.ascii	"\230\332I\006"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.part.0.49.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\245\013"
+	.string	"\246TLA0\247*\0350\257\024\310\001qJ=\377\344\037\337\234\016\317\013U\017\225\333K\206$\362?M`\355\243\214]b\2224`\225\301J\301\016\364\021\3030V\006\002y\006\277\361fU\\\tG\177\023\271S\n7"
+	.string	"<"
+	.string	"8"
+	.string	"\234\223\210mo8(\217/\001\254\216\002\001\244v\253\265\364N7\345\343wr\243\337\t\200\200d\245\276\257}\222\254\221O\3149\313D\255\325\027\222\233\336v\3076\205\375\213\261\331\3512\323\254\250\252\022\005;\355\227?\200\272\314\304\225\225\365\006-\007\021\247\356\\N3g\250\234r_\250\240\374\230\273S\277\300\230I\225u\265i\335`\020\247\226\270\234\236\2007\001\252\365\360\356\276l[f\302K\025\233\243c\236\3746$0\261}lj\356\313\313qu]\366<\355>\305<\300j]ExPO(\003\001\247\375\263\3337p\362i\257\271\013\032#P\350\331\260\020C\220\324e|!\f\317\350\263\370\2431\205\342'\372B\237\350\215@\036\221\367\tK\236\306\301 \351\013=\021\004C\257;W\327\345\303\026\304\346wn\210\355\271\n\344"
+	.string	"[\032"
+	.ascii	"i\331\267c\3435j\007]\215\f\310\003#\\\207K\226\021Q6\226`\024"
+	.ascii	"L$f\001\034\tv\210\313s\021\013'\223U\207\226%\257rj\325F\234"
+	.ascii	"\013\326DA\235\366`6\036S\316\273\312\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"\305\005"
+	.string	"t\bM\001"
+	.string	""
+	.string	""
+	.string	"\0021\177\r\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 '\177\016\272\200\202\002(\177\017\0050\020)\177\021+\177\022\002,\177\023-\177\024!\025\201\204\005*\026&\027\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005$\030gistry"
+	.string	""
+	.string	"\005\"\031\001/\177\032\377\037"
+	.string	""
+	.string	"\200\200\200\001.\177\033\003"
+	.string	"$\003\002\016\240\276\320\347"
+	.string	"\001d\003\002"
+	.string	"\363\243\231\"\001\242\001"
+	.string	"\023"
+	.string	"/+\303>E\306\317\324o\004\303\345w\325\230\344\334\230\225\256g\254\f\177\324 "
+	.ascii	"\301\034\004\320\003\374\320\252\035\200\306N\226\200\033t0\235"
+	.text
+	.section	.gnu.lto_.refs.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	"\003\006"
+	.string	"\001\007"
+	.string	"\b\001"
+	.string	"\003\013\002\b\002\f\002\n"
+	.text
+	.section	.gnu.lto_.decls.a1ad57870b0b9a64,"e",@progbits
+	.string	"(\265/\375`\256\036\005\216"
+	.ascii	":\346\0303R0\220BJ\007\0248\357\340]\233\340\365)\364\212\226"
+	.ascii	"\345m\367\016\367\265i/\366/\022\005O\232\226\b\fM\366\373h_"
+	.ascii	"Q(\352\340-\365m\"j\020\177\r\206\353\\F\226\271\230j\023\021"
+	.ascii	"\225 \007\253E\246y\016\021f\263<\226\374\240Vm\220\275e\n\261"
+	.ascii	"\002,\0033\0039'-\200\221\220\021I; \275\271\221x\016\244i\360"
+	.ascii	"S8l\251lU?C\330\032\315\006l\nK\013\236!\347\016\301\353\273"
+	.ascii	"\273\016\301{z\206\2372\361S\037X\251\221x0l\214tM\231\021"
+	.string	"\0326}j\005#\216E\376\330\231\302\222e\306\036\337\024\272\310\033pVl\372\033\305\277j\370\027\t\376\335\201\177i\340\244\236\363\367\233\206\323h.\344\f\242\2010U8l\332vKo9G\274\253\254f&\302wwlAl:T\007\337\256\221xD}\304+\352#^\327\365\232~\222h6o4\235\346<\310fn\332!v\244\234\331\364\266\r~\223\340\335\273\273&\301\273\315\202\213\032\211g\255\023\337\212\341[\036\370tv\006\026Q\327H\274\016\343\363\206V\245i\323\271f\322\320\f0g\242\300\301o0\r\327^:\256\277\364\263\345\272\355\335\245\335\2366sN\252Ui,V\246\316\324\345\234\337O\336\354\232Pz\320\276\324@\360/\265\\\2635\227\013\345\n\243\235\231\251K\223\322hC\307\242<5\227\206\231s\363M\366/\375\017H\320r=\245\321n\223\231\247\346\256X\360\005\246\206\026\273\234\233I\013"
+	.ascii	"\251\001\322\305e(}3\301\2176\022/\250\201\340\316\322Z\372\251"
+	.ascii	"\324[|\222\315\354\364\031\323\246+\315\246o\035\370\255\304"
+	.ascii	"#R\342\275\261\372J;\321\202\304\200{\255\255\364\223J\253=5"
+	.ascii	"[fg\316Y\b\310\0074\riS\027=}-\274\017q\332G<\021-\340\213\200"
+	.ascii	"\237\326H\2746\353\263~"
+	.string	"\022\320Q\376\200\004\277G\263L\226s\223H\350\316\222;tlz&\374\337\371\002\314\262\004\017\201\337\004\360\372\256\t\340A\333\032\211\247$$g\314\324\230M\2334\031\001WI\265\314i97\215\210\2327\252z\330\364\315F\342\341>\342\305\341\337\036\177+v\373\333 <\340>\347\363\333\256\377Q\234\374\235\001\231\277\243c,\370?\364[\031\254\214\277A\374M\300\337\007\374=\342\357\002\376\366\360w\322\337\b\374\215\364\267\210\277\005\370\373\303\337\001\374=\300\337G\177\207\370\333\310\337\351\337\377/\347\277\207\377\366\376\316\362w\333\337\\\376\326\362\367\225\277\331\376\336\362\267\233\230\277\313\376\206\376m\245\350\277J\376\216\373\033\356\357\267\277\303\376\336\372\233\205\277W\370[\305\337'\374]\302\337\036\374\215\301\337L\177k\3607\004\377\347\376^\372\273\304\337\f\374\337\362\237\304\337J\177+\360w\002\377\303\374w\362\237\354\377"
+	.ascii	"\377\337\376\377\334\335\335\335\375\026\377\274\035\377\207"
+	.ascii	"8\001\f\b\355\330*\343\262\3511\214-[l\033\235l\333\346\244Q"
+	.ascii	"\343r\333\366\201Y\234\034\233\003\206\233\302\324r\006\013\026"
+	.ascii	"\233\005\347\027\240p\240c<fY\342\234\226\3556\313\334\2231t"
+	.ascii	"\315\205\367\305\252\316\2347(\324\236\341c\027\313E\353.\t\032"
+	.ascii	"FC\263k!d6&\320\230:n\256T\271]K\303<\223p6\265R,\2256\257\037"
+	.ascii	"lT\324\242n7\274\346\232!\322\334\260l:\245\333\004@\243\254"
+	.ascii	"b\323\277\261iA3\356\330\211A\224F\307\0177\"\370\267\317\377"
+	.ascii	"\001\t\372i\237\215\326f\331\352gF\2363f\227s\033\003Dpt\350"
+	.ascii	"\032b\323\367dlff\317pNJ\022\345R\022\n\203!'\212M\317\236\206"
+	.ascii	"G\016\211\221)l\260\022\373D\211m\362r\356\346\322\352*g])\375"
+	.ascii	"\177s\333\364\021;\362E\225\304\352p;\366\264c\266\f\037s>6\263"
+	.ascii	"\225\207'P8P\273\234\225\2454\204\005D\211\333\222\3332\262\240"
+	.ascii	"\234\311r\316\003\b-\301AN\314\246\226\314\332&\326\311-\231"
+	.ascii	"e\022\224\264di\316\310\356\021C\335#x\264\024A\236\361\322\363"
+	.ascii	"\246\340\277\261A\254\234\020'\232M\317\033\202\317\203\201\377"
+	.ascii	"\346e\344U\316\331\006O3_M\005\361\232\247\205\372\366\001\377"
+	.ascii	"\323|\177\001f\310\371\b\206\351\006\037\261\202\334\272\210"
+	.ascii	"|\236h\316I\257\243\006^XI/\034J\247W>&\215\034\215\256\262\327"
+	.ascii	"Q\351\314\331('\223\307\016\226\331H\351\314X\031\206\034V\347"
+	.ascii	"\246\3271'\227\331('3R\2042\351\205\245t\"\261\214\224N/\254"
+	.ascii	"\354\364\312E9\211\274\232\221\314WF\331\351\265&;\227XEJ\347"
+	.ascii	"\022K\351\364\332j*J5L\260\2760\277\310\372\250L\346\032U\\\310"
+	.ascii	"\253\242\250\262\271\314t9wZ\214|u@\316\\\313+:$\216\206NEkL"
+	.ascii	"QA.\273\231s\016Q5\365\265\314\311\250\022\3112g$SP\271*\202"
+	.ascii	"c3\232\203t\364\330\203+S\305\3109\200\252\234\217\235\2439\347"
+	.ascii	"c\316\271\347\212\253\231s\216\"%\263\252*\347\254\244\252\314"
+	.ascii	"u\274\022#g\233V\006\212\245t~-"
+	.string	"\227\256Dq2\263\214\346\261\231\231\316\353\n;\217P2U\033\314\304\262\201\215M\217$\335+SEx\254a\246\025k0\032cS\236\314\"\326H\366Y\3468C:)\"\304\016i\362x\261q\214\303\024\002\304\202\361\302\004\271R\306\246\347\361\002\322tz\310RR\303\246\277\365a\227<4r\260\272\223\306N\02173L\372\314\022\b\356\206\3746\313\352\260_\326\313\356\2608X-\333\303\336\260<,\227\305a\267l\227\275\301\346\350\247]Z\254[\033\326\206V\323mn\023\212e\234\215\325\355P\246\311\222\255a\207[\266SS\276\204\324Y\345\277dg\2001\257\254\325\020\262('\247\272\350\3241B\206\216\254\316.m\322\312X\233\013R'\201]\366\035\"\355\306.;N\317\311_a\3144viiX\253\216\202e\3441\202#\3212Wv9\251[\017\222\314\230.b\370M\346\344>9\3234\343\274Qt"
+	.ascii	"S\007\345\226\221\225a\273i\027\332\321\254\242\234\\\263\253"
+	.ascii	"c\273g\215\326\321\254\013\230\320i\271]n\333\335r\261\334,\227"
+	.ascii	"K?/\333E\373mr\311\324.\3335\3536\035\005\323\200l\007\"7M\320"
+	.ascii	"p\024\245N\216f\200)e\bei\254\334+\375\274P\350\225r\327:\232"
+	.ascii	"\325\3146"
+	.string	"\200\252\254\221\233\023b\001!6a\350\266xkU\206\2504\201\264\261\351\245\322\223\205\343\r\006\326\224~^5\374f\354\n\235\240\032\370AJ| :\370>\261\230\272\256/o\360\201\326\340\003\225\301\007\022\203\017\004\207\017\324\366\344\2269\335\334|)k4;\007G5\225\005[\245>\342]%w\t\021\023\350\017\265\261\022\204\200Q\263i\252\203}\013cV%\031\2423\"\005\n\022\036\265;7Z6\275Gp\f\240($~\272\326vl\331\364\367\310\177u\364\0161\334\331\211c\323\356\262\364\233\003\320\227-uO\212\340\367\222\276]\277Fn\327\rK\2414\217Cau\\\f\\1\311\250\030 /6h\352lz\205\\\"\267\310\357\343\303F5\307\345\003\377\016\371\001\223+\222\304\246\366\202\375\006\371}z\310\256\222R\226\370\367\307\005\362\373\\;^\330f\330\364@Y\370\327\007\rfx,\261\351\355\201c"
+	.ascii	"\315 \341S\306\f\315\355\361\267]\217\271_\226j+K\215M/\217\353"
+	.ascii	"\365\373u\227"
+	.ascii	"\371~E\260\314\031y\277\210\352\344\214$\352\036\321=\"e\362"
+	.ascii	"\0256\205\227\036(\211\257\216\245\337\0356,\355\355\315\246"
+	.ascii	"Ba\360\257V\337\255\347\335\272ZW\231\221<.\350\322lc\200G\306"
+	.ascii	"\rr\216P\374\276Z\274\377j\375f)\021\002\204\213Mq\360\2141\237"
+	.ascii	"7\316\360!\bc\313X\235\t\251SC\243\203i\343\314\016\246\031\260"
+	.ascii	":6[u^\340l\\\215\271\"uKp\254\234)sUo\254\356\\\244\rS5X\271"
+	.ascii	"\271\243\21117\244Ms\031J\026\345\344W\016f\232.\031V\215]CA"
+	.ascii	"\214+\037\032s\\\326\313\225\321U\302\352\334h\335\031\027\353"
+	.ascii	"V\335\033\327\206{\303\305\341\322\2705\\\033\227\352*\257\325"
+	.ascii	"\275\2721n\215~^\031w\3527ya<\211\354\312\260s\254\235\216\246"
+	.ascii	"e\244\r\021bP\216p\r\231\021\251j\036\220\362r\364G\013\377\027"
+	.ascii	"y\217iP\316\224Is c%\354f{\307+\233\003\373Q\342\377\034\351"
+	.ascii	"\330:Dq\252\334\214\201Cg\215\265\013Bb\303\312\310\\\034\237"
+	.ascii	"7|\037,\370>O|\2371|\237\2605u\3140346\215\022\005\335i2\307"
+	.ascii	"\303\246\367\371\201\357\243\205\357C\205\217\357\3601\033"
+	.string	"Lgw \223\302`c\003\353Bw2<9'9\312\230[2DE\326\342z\330\324\212\3516wk^\264\034\r\020\027!__\326\360\361\023\374f\037\361l\024\343\360\201D\023\004\203\371\362c\307\310\027;\233\376\213\234\215\0352\027>\364\326\355\375\264n\026\211\2172g\254\005\324@\257\262\002\253P5\252\305\023\200?\341\220\311\327\002\2706m`\004\2128T\tc\257)\204\007*\234P\301\264A\317\203\016L \241\307\204\242\227\342\204\321\013\342\220\311\303J4\361D<j\022J}\260\252F \241\223\3451\366\202\326\236\360\211\310#|\"^\250\365I\250\006yj\f@cj4\252\305\337\317\327\363\2028lJ\213+\361^\350Eq5\002\237T\024\275\237*|\002\006}=?\325(\225\252\306\236\373V\337\257\330{\"\226\030*\372\240\232\322 1JU\261\252F\025\305\023\321\200\265\027d,\252-\200\305\337"
+	.string	"\306^\220\nE*Z\360\324\236\372\033\222\360\243\376\206Q\251\3323\301H\034\366\250\253\017\005Vc"
+	.string	"\246\300+.\006\375|j\bA\240OEQur\222\342\300\305\032\324\002\2506\251(\222~|\253\257\003\027\305\241\342z\302\t$\026M\276\025\301\240\217I\r\376\200AQ\352j|\221\342\203\361D\222\321\2506\r\213'\024\035\375T\027(X4\251PL\001\034\252DSO\215\002\256B\251\242\211&'\003\214O\276\340\007O\276\023Bo\n\016\207\034\364x\np\240\304Z\364\021K\250\253o\025z\240\n\201QEuU;P\340M\300\242*T\237\360#\230\240\201\t(p\321s\n*p\240\002\007x\247\240\202\245\245\n&X\302\237`\351\256X\355\375N\270\030\256\350Q\211/T\254\200\"E\220Z\364A\245\020:\324\b\243\325W\324\243\376\244V\340\223p8\202\013\340\007\303\022~\352ZT[\b\201"
+	.string	"\270P\203D\251\016\234\202>\250\037\265\367\001\223\221\b\002\322\352\213*\016\235z\352\352\023\002\177\305\341\260\251\007B\355\255@a\n@+P(\365#\034\002\215\300&\265H\354\031}N-\212N\036\202\276\026Eu\025\236\370\t\245\206)\242\212\276\340\006\353:\204\372\240\302\270\201Q\225\n\372T\370\001\211\036\324'\337\032\034\266\350\005\203jSo-\036\031_\2600\276\b:\r\255\275\t\226\212C#\260\005\360\327{\022\002\177>\025\252g\364\365\240|Q=\026B`\260\205/\252"
+	.string	"c\212\237\032\\\3413\002\177\305\241Q\250\032\001 Z\241\236\200*\f\275\2658$\276\360\005\211F\340\257\347d,6\201X\017U\302\304\020\b\342C\242Z4\261\016\207E\023@ \214\275'\240\223p\310\004\300\332{"
+	.string	"\002\314\302\350#A8\004\256MB)\247 \265wb-\016O\b\372\200E\325\370\241\250\002\235\200\253P\375\001\177\210\306(##\361\311h\355Q\260\n\201R=_Zb\022\221B\t \340\246\022/\212\253\032\245\006\325\325\204\020\350\2132\321T4\232(!\302\205\372\023\236PW_\361'\345[\321s1\\\301\242\311\027\\\361\201\31669`C\345\203\314\215\023Z\303\004\016\221;\006\211\2327bP\254\230\260\036\350\231\037h6\235\233CA\214L\216\261;\344\206\225\271;|0\007s\343\332,[yx\022G&\207]\316YJCs?j\240q\243\277qSI\210T\t\023\032C#F\213\r\356\302Y$!\330\201\3320,\0304\312\304~\231\334&W\354\276]eV\266\241\204\025(\206\323\022\005b\003\202h\250r\361,I\322\224B\006\241\031\221\021I\323tB\n\020\206\204q\236\310\262\007\022"
+	.string	"\0055\314\262\216\231\231\021)H\222:\205\2155$\024\373\203\""
+	.string	"D\224[\035\337e8\241\214+\253E\244\374\351\265\314\205\374\265\366v\321h\002k\003\254\312\357L\342\223JH\234U\260\034\220\247Go\271\246a8\323\216q\266fCa\201\316\213\035H\252\nNv \261WTu\026\"|X\302L\231v\200\215j\216H\226`\022*4\350I\\\bD\331\323\251\030\022\214\310\217\254\241"
+	.string	"Z\272\346J,4}1W\261\212h\273\035\035\274\354\270\035:\375\f\273\256\257\364\360\221\257\310AL8*F\200)\034\250t^\325\247\305\365\324\034'O\311szQ\215\020a\340\251\346\243@xi|\311a\202"
+	.string	"\271\316\3566\310c\354\323\346yu\216\320^}\357r\376\337\360W\214\370\310H_1Wk\013$\210\211\001Kt\262\373\315\225\233Y2\001L\027{%I\006\271L\310\3644\007\371c\307P\261xS\311\350\240\224\307\350\343\030\201}\002Yh\342\377CZr\360\271mIh\177lZq\026fs\326Y\374.\016\006\271\007\351\307N"
+	.string	"\300\211\201\032\0211M\266\321h\323x*\227!D\261\3319\337\350^\033Ng\262\211j\260\210\210\037Z\026\357\271\256\253^\311l\375\301\254\325\363\226\240\3537\270\230v\n\031\314\220?\217\336\274\236\351&ez\326\264\365\005ePc\332\336b\270s\352\277\301\272\213\240<\212\037\236\317D\020?|\264\304\001Z\212\343#1\232\004\"\365is\211afN\211q\210U]\030\016A\316\022ef\353.\217\224~\227E\f\027D{\254\336\323\263m\250\342\373\221\370\220\343A\002O\221\354g\004+"
+	.string	"\342=\223\330\n*\004\251\203\026\336\237T\266\t\202,\213\240\204G\275\222\240\274#\253\265\244!\004\256\243\327I ~Y\316i\254\205\356cb\325\242'\207\333\210\251\343\232]#\371\037&\346.M7\224\021f\371v)\200\330\211>N\251\346-(m\377KOJ\362\013\327\203\321\033AN7\370=#}\330\306\267\221\261y\324\276\241\236q\254\257}\272\314\206\205,>\022\261\212\253\375s\220\222\\\361\315\013rD1a\330 \321\\`\027\006w\2319\3410%\330o\307\211Ll\262V\334\\\034\301\013\031\027\202\313\361J\365*\253Zcr!\302\363t\367\\w\206\322\001O\241[\356J\355\330\223\220\023?@\234\234Q\233O\233\245U\312\342\361Z*\331\361"
+	.ascii	"\243b\007\036\301(\315\006~@\024)\342\244:\212|r/\325;\211\227"
+	.ascii	"\306G\350,"
+	.ascii	"\334.K\177\345\"\021)\020+^[M\345=q\030K\244h\006R\341\350\030"
+	.ascii	"V\372\367-\271\252\304\247\343\2206\262a\211-'\241Y\001\222\005"
+	.ascii	"\231\366@>\311\346\016'\326'\265\344\3126\021\221,fp\024\340"
+	.ascii	"\225O\375pP\336\344\303.\257\362\222\275=\340\330\223\021\334"
+	.ascii	"=i|\366\325\f\270SJ~K\316}]\276\222\b\223"
+	.string	"\024+\253\250\025'BX3>\n\203\341C\225I\214\223|\020n\036S\337\243\032]QQf\344\362\026\220\030l\333\265\314\032\334\306\243\234 \217\262/Oy\034*\343\311\324\263\230R\247\244\240\251f\200\307\351\371\256\177\341aO!\273I\216\261\274\303Uy\016hK\017\332@i\3263\231 \310't0\346;k\255\374[\237]\220\340\027\211\204\312\333A\250\340F\202r$\3053y)ih\0251\214S.\235:r\222Hc~\261\243\350!\376\344\"\031\016\016d\251\300fO\036\301\362\020\360M\r\352\266\301{\305\372\342^!h\372\216DX\245d\256Q,\256\030cw>\017\200\226\"\233\357\361\252\006}\351]\307\"\242\033\225\227\306j\231\334\223o'\223$\007\rg'w\267/S\002\263C\230\0302bJw\2062\021\256%`\020\260\356f!\003\tR\3070M\003\200\205\035\030\362\231\230R\252\304,|"
+	.string	"km\314\236\201\346d\023\264\016:\b\240RW-D\312\200K\326(G\311\264\263\247\340\227'\006\345\225?\024N\304\354\352\360\227z%\362\3703t"
+	.ascii	"^\256\005\232\321\027\364P%\351\271+ib@\275K\035F\346`\310\314"
+	.ascii	"X\315C\244\346\r\023\204K\303\324v\246\021}\353\033\377\276V"
+	.ascii	"$J9Am_F\306\213\204\202\236vLn\276u\n\025\377\266\323~q\237+"
+	.ascii	"\330\231\274g\335\363\270\244}\351g,\217\343#k\254b\201\340v"
+	.ascii	"v\270\225\251\301\245\021\273\202\2650\336R_aS\331Y\314I\352"
+	.ascii	"\036\346\027wa\332\270y\256\337\3207\312\300;\372\370:\320%\241"
+	.ascii	"\341\364\275\230\243\347s\313\024\006\362\244\025"
+	.text
+	.section	.gnu.lto_.symtab.a1ad57870b0b9a64,"e",@progbits
+	.string	"telemetryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"telemetryIsSensorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"pgResetTemplate_telemetryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"telemetryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"telemetryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a1ad57870b0b9a64,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -28,6 +28,7 @@
 #ifdef USE_BLACKBOX
 
 #include "blackbox.h"
+#include "blackbox_compress.h"
 #include "blackbox_encoding.h"
 #include "blackbox_fielddefs.h"
 #include "blackbox_io.h"
@@ -39,6 +40,7 @@
 #include "common/axis.h"
 #include "common/encoding.h"
 #include "common/maths.h"
+#include "common/streambuf.h"
 #include "common/time.h"
 #include "common/utils.h"
 
@@ -87,13 +89,14 @@
 #define DEFAULT_BLACKBOX_DEVICE     BLACKBOX_DEVICE_SERIAL
 #endif
 
-PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 1);
+PG_REGISTER_WITH_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 2);
 
 PG_RESET_TEMPLATE(blackboxConfig_t, blackboxConfig,
     .p_ratio = 32,
     .device = DEFAULT_BLACKBOX_DEVICE,
     .record_acc = 1,
-    .mode = BLACKBOX_MODE_NORMAL
+    .mode = BLACKBOX_MODE_NORMAL,
+    .compression = 0
 );
 
 #define BLACKBOX_SHUTDOWN_TIMEOUT_MILLIS 200
@@ -552,41 +555,63 @@ static void blackboxSetState(BlackboxState newState)
     blackboxState = newState;
 }
 
+/*
+ * Frames are encoded whole into this buffer and then handed to the device in one write. The largest is an
+ * intraframe with every optional field present, each at its full variable byte length.
+ */
+#define BLACKBOX_FRAME_BUFFER_SIZE  (1 + (42 + DEBUG16_VALUE_COUNT + DEBUG32_VALUE_COUNT + MAX_SUPPORTED_MOTORS) * BLACKBOX_MAX_VB_SIZE)
+
+static uint8_t blackboxFrameBuffer[BLACKBOX_FRAME_BUFFER_SIZE];
+
+static void blackboxFrameBegin(sbuf_t *frame, uint8_t frameType)
+{
+    frame->ptr = blackboxFrameBuffer;
+    frame->end = blackboxFrameBuffer + sizeof(blackboxFrameBuffer);
+
+    sbufWriteU8(frame, frameType);
+}
+
+static void blackboxFrameCommit(const sbuf_t *frame)
+{
+    blackboxWriteData(blackboxFrameBuffer, frame->ptr - blackboxFrameBuffer);
+}
+
 static void writeIntraframe(void)
 {
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
+    sbuf_t frame;
 
-    blackboxWrite('I');
+    blackboxFrameBegin(&frame, 'I');
 
-    blackboxWriteUnsignedVB(blackboxIteration);
-    blackboxWriteUnsignedVB(blackboxCurrent->time);
+    blackboxEncodeUnsignedVB(&frame, blackboxIteration);
+    blackboxEncodeUnsignedVB(&frame, blackboxCurrent->time);
 
-    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_P, XYZ_AXIS_COUNT);
-    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_I, XYZ_AXIS_COUNT);
+    blackboxEncodeSignedVBArray(&frame, blackboxCurrent->axisPID_P, XYZ_AXIS_COUNT);
+    blackboxEncodeSignedVBArray(&frame, blackboxCurrent->axisPID_I, XYZ_AXIS_COUNT);
 
     // Don't bother writing the current D term if the corresponding PID setting is zero
     for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
         if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
-            blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x]);
+            blackboxEncodeSignedVB(&frame, blackboxCurrent->axisPID_D[x]);
         }
     }
 
-    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_F, XYZ_AXIS_COUNT);
+    blackboxEncodeSignedVBArray(&frame, blackboxCurrent->axisPID_F, XYZ_AXIS_COUNT);
 
     // Write roll, pitch and yaw first:
-    blackboxWriteSigned16VBArray(blackboxCurrent->rcCommand, 3);
+    blackboxEncodeSigned16VBArray(&frame, blackboxCurrent->rcCommand, 3);
 
     /*
      * Write the throttle separately from the rest of the RC data as it's unsigned.
      * Throttle lies in range [PWM_RANGE_MIN..PWM_RANGE_MAX]:
      */
-    blackboxWriteUnsignedVB(blackboxCurrent->rcCommand[THROTTLE]);
+    blackboxEncodeUnsignedVB(&frame, blackboxCurrent->rcCommand[THROTTLE]);
 
     // Write rcCommand[COLLECTIVE]
-    blackboxWriteSignedVB(blackboxCurrent->rcCommand[COLLECTIVE]);
+    blackboxEncodeSignedVB(&frame, blackboxCurrent->rcCommand[COLLECTIVE]);
 
     // Write setpoint roll, pitch, yaw, and throttle
-    blackboxWriteSigned16VBArray(blackboxCurrent->setpoint, 4);
+    blackboxEncodeSigned16VBArray(&frame, blackboxCurrent->setpoint, 4);
 
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) {
         /*
@@ -595,69 +620,72 @@ static void writeIntraframe(void)
          *
          * Write 14 bits even if the number is negative (which would otherwise result in 32 bits)
          */
-        blackboxWriteUnsignedVB((vbatReference - blackboxCurrent->vbatLatest) & 0x3FFF);
+        blackboxEncodeUnsignedVB(&frame, (vbatReference - blackboxCurrent->vbatLatest) & 0x3FFF);
     }
 
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_AMPERAGE_ADC)) {
         // 12bit value directly from ADC
-        blackboxWriteSignedVB(blackboxCurrent->amperageLatest);
+        blackboxEncodeSignedVB(&frame, blackboxCurrent->amperageLatest);
     }
 
 #ifdef USE_MAG
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MAG)) {
-        blackboxWriteSigned16VBArray(blackboxCurrent->magADC, XYZ_AXIS_COUNT);
+        blackboxEncodeSigned16VBArray(&frame, blackboxCurrent->magADC, XYZ_AXIS_COUNT);
     }
 #endif
 
 #ifdef USE_BARO
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_BARO)) {
-        blackboxWriteSignedVB(blackboxCurrent->BaroAlt);
+        blackboxEncodeSignedVB(&frame, blackboxCurrent->BaroAlt);
     }
 #endif
 
 #ifdef USE_RANGEFINDER
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RANGEFINDER)) {
-        blackboxWriteSignedVB(blackboxCurrent->surfaceRaw);
+        blackboxEncodeSignedVB(&frame, blackboxCurrent->surfaceRaw);
     }
 #endif
 
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RSSI)) {
-        blackboxWriteUnsignedVB(blackboxCurrent->rssi);
+        blackboxEncodeUnsignedVB(&frame, blackboxCurrent->rssi);
     }
 
-    blackboxWriteSigned16VBArray(blackboxCurrent->gyroADC, XYZ_AXIS_COUNT);
+    blackboxEncodeSigned16VBArray(&frame, blackboxCurrent->gyroADC, XYZ_AXIS_COUNT);
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_ACC)) {
-        blackboxWriteSigned16VBArray(blackboxCurrent->accADC, XYZ_AXIS_COUNT);
+        blackboxEncodeSigned16VBArray(&frame, blackboxCurrent->accADC, XYZ_AXIS_COUNT);
     }
 
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
-        blackboxWriteSigned16VBArray(blackboxCurrent->debug, DEBUG16_VALUE_COUNT);
+        blackboxEncodeSigned16VBArray(&frame, blackboxCurrent->debug, DEBUG16_VALUE_COUNT);
     }
 
     //Motors can be below minimum output when disarmed, but that doesn't happen much
-    blackboxWriteUnsignedVB(blackboxCurrent->motor[0] - motorOutputLow);
+    blackboxEncodeUnsignedVB(&frame, blackboxCurrent->motor[0] - motorOutputLow);
 
     //Motors tend to be similar to each other so use the first motor's value as a predictor of the others
     const int motorCount = getMotorCount();
     for (int x = 1; x < motorCount; x++) {
-        blackboxWriteSignedVB(blackboxCurrent->motor[x] - blackboxCurrent->motor[0]);
+        blackboxEncodeSignedVB(&frame, blackboxCurrent->motor[x] - blackboxCurrent->motor[0]);
     }
 
     // Write the servo I frames as unsigned since they will always be somewhere between 0 and 2020
-    blackboxWriteUnsignedVB(blackboxCurrent->servo[0]);
-    blackboxWriteUnsignedVB(blackboxCurrent->servo[1]);
-    blackboxWriteUnsignedVB(blackboxCurrent->servo[2]);
-    blackboxWriteUnsignedVB(blackboxCurrent->servo[3]);
+    blackboxEncodeUnsignedVB(&frame, blackboxCurrent->servo[0]);
+    blackboxEncodeUnsignedVB(&frame, blackboxCurrent->servo[1]);
+    blackboxEncodeUnsignedVB(&frame, blackboxCurrent->servo[2]);
+    blackboxEncodeUnsignedVB(&frame, blackboxCurrent->servo[3]);
 
     // Write helicopter headspeed
-    blackboxWriteUnsignedVB(blackboxCurrent->headspeed);
+    blackboxEncodeUnsignedVB(&frame, blackboxCurrent->headspeed);
 
 #ifdef USE_DEBUG32
     // Write extended debug
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
-        blackboxWriteSignedVBArray(blackboxCurrent->debug32, DEBUG32_VALUE_COUNT);
+        blackboxEncodeSignedVBArray(&frame, blackboxCurrent->debug32, DEBUG32_VALUE_COUNT);
     }
 #endif
+
+    blackboxFrameCommit(&frame);
+
     //Rotate our history buffers:
 
     //The current state becomes the new "before" state
@@ -670,7 +698,7 @@ static void writeIntraframe(void)
     blackboxLoggedAnyFrames = true;
 }
 
-static void blackboxWriteMainStateArrayUsingAveragePredictor(int arrOffsetInHistory, int count)
+static void blackboxEncodeMainStateArrayUsingAveragePredictor(sbuf_t *dst, int arrOffsetInHistory, int count)
 {
     int16_t *curr  = (int16_t*) ((char*) (blackboxHistory[0]) + arrOffsetInHistory);
     int16_t *prev1 = (int16_t*) ((char*) (blackboxHistory[1]) + arrOffsetInHistory);
@@ -680,7 +708,7 @@ static void blackboxWriteMainStateArrayUsingAveragePredictor(int arrOffsetInHist
         // Predictor is the average of the previous two history states
         int32_t predictor = (prev1[i] + prev2[i]) / 2;
 
-        blackboxWriteSignedVB(curr[i] - predictor);
+        blackboxEncodeSignedVB(dst, curr[i] - predictor);
     }
 }
 
@@ -688,8 +716,9 @@ static void writeInterframe(void)
 {
     blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
     blackboxMainState_t *blackboxLast = blackboxHistory[1];
+    sbuf_t frame;
 
-    blackboxWrite('P');
+    blackboxFrameBegin(&frame, 'P');
 
     //No need to store iteration count since its delta is always 1
 
@@ -697,21 +726,21 @@ static void writeInterframe(void)
      * Since the difference between the difference between successive times will be nearly zero (due to consistent
      * looptime spacing), use second-order differences.
      */
-    blackboxWriteSignedVB((int32_t) (blackboxHistory[0]->time - 2 * blackboxHistory[1]->time + blackboxHistory[2]->time));
+    blackboxEncodeSignedVB(&frame, (int32_t) (blackboxHistory[0]->time - 2 * blackboxHistory[1]->time + blackboxHistory[2]->time));
 
     int32_t deltas[8];
     int32_t setpointDeltas[4];
     int32_t collectiveDelta;
 
     arraySubInt32(deltas, blackboxCurrent->axisPID_P, blackboxLast->axisPID_P, XYZ_AXIS_COUNT);
-    blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT);
+    blackboxEncodeSignedVBArray(&frame, deltas, XYZ_AXIS_COUNT);
 
     /*
      * The PID I field changes very slowly, most of the time +-2, so use an encoding
      * that can pack all three fields into one byte in that situation.
      */
     arraySubInt32(deltas, blackboxCurrent->axisPID_I, blackboxLast->axisPID_I, XYZ_AXIS_COUNT);
-    blackboxWriteTag2_3S32(deltas);
+    blackboxEncodeTag2_3S32(&frame, deltas);
 
     /*
      * The PID D term is frequently set to zero for yaw, which makes the result from the calculation
@@ -719,12 +748,12 @@ static void writeInterframe(void)
      */
     for (int x = 0; x < XYZ_AXIS_COUNT; x++) {
         if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
-            blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x] - blackboxLast->axisPID_D[x]);
+            blackboxEncodeSignedVB(&frame, blackboxCurrent->axisPID_D[x] - blackboxLast->axisPID_D[x]);
         }
     }
 
     arraySubInt32(deltas, blackboxCurrent->axisPID_F, blackboxLast->axisPID_F, XYZ_AXIS_COUNT);
-    blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT);
+    blackboxEncodeSignedVBArray(&frame, deltas, XYZ_AXIS_COUNT);
 
     /*
      * RC tends to stay the same or fairly small for many frames at a time, so use an encoding that
@@ -738,9 +767,9 @@ static void writeInterframe(void)
     // Calculate collective delta
     collectiveDelta = blackboxCurrent->rcCommand[COLLECTIVE] - blackboxLast->rcCommand[COLLECTIVE];
 
-    blackboxWriteTag8_4S16(deltas);
-    blackboxWriteSignedVB(collectiveDelta);
-    blackboxWriteTag8_4S16(setpointDeltas);
+    blackboxEncodeTag8_4S16(&frame, deltas);
+    blackboxEncodeSignedVB(&frame, collectiveDelta);
+    blackboxEncodeTag8_4S16(&frame, setpointDeltas);
 
     //Check for sensors that are updated periodically (so deltas are normally zero)
     int optionalFieldCount = 0;
@@ -777,35 +806,38 @@ static void writeInterframe(void)
         deltas[optionalFieldCount++] = (int32_t) blackboxCurrent->rssi - blackboxLast->rssi;
     }
 
-    blackboxWriteTag8_8SVB(deltas, optionalFieldCount);
+    blackboxEncodeTag8_8SVB(&frame, deltas, optionalFieldCount);
 
     //Since gyros, accs and motors are noisy, base their predictions on the average of the history:
-    blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, gyroADC),   XYZ_AXIS_COUNT);
+    blackboxEncodeMainStateArrayUsingAveragePredictor(&frame, offsetof(blackboxMainState_t, gyroADC),   XYZ_AXIS_COUNT);
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_ACC)) {
-        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, accADC), XYZ_AXIS_COUNT);
+        blackboxEncodeMainStateArrayUsingAveragePredictor(&frame, offsetof(blackboxMainState_t, accADC), XYZ_AXIS_COUNT);
     }
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
-        blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, debug), DEBUG16_VALUE_COUNT);
+        blackboxEncodeMainStateArrayUsingAveragePredictor(&frame, offsetof(blackboxMainState_t, debug), DEBUG16_VALUE_COUNT);
     }
-    blackboxWriteMainStateArrayUsingAveragePredictor(offsetof(blackboxMainState_t, motor),     getMotorCount());
+    blackboxEncodeMainStateArrayUsingAveragePredictor(&frame, offsetof(blackboxMainState_t, motor),     getMotorCount());
 
     // Calculate helicopter servo deltas from last BB frame and write as a group of 4 to this P interframe
     for (int x = 0; x < 4; x++) {
         deltas[x] = blackboxCurrent->servo[x] - blackboxLast->servo[x];
     }
-    blackboxWriteTag8_4S16(deltas);
+    blackboxEncodeTag8_4S16(&frame, deltas);
 
     // Write helicopter headspeed with delta from last frame
-    blackboxWriteSignedVB(blackboxCurrent->headspeed - blackboxLast->headspeed);
+    blackboxEncodeSignedVB(&frame, blackboxCurrent->headspeed - blackboxLast->headspeed);
 
 #ifdef USE_DEBUG32
     // Extended debug
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
         int32_t deltas[DEBUG32_VALUE_COUNT];
         arraySubInt32(deltas, blackboxCurrent->debug32, blackboxLast->debug32, DEBUG32_VALUE_COUNT);
-        blackboxWriteSignedVBArray(deltas, DEBUG32_VALUE_COUNT);
+        blackboxEncodeSignedVBArray(&frame, deltas, DEBUG32_VALUE_COUNT);
     }
 #endif
+
+    blackboxFrameCommit(&frame);
+
     //Rotate our history buffers
     blackboxHistory[2] = blackboxHistory[1];
     blackboxHistory[1] = blackboxHistory[0];
@@ -819,11 +851,12 @@ static void writeInterframe(void)
 static void writeSlowFrame(void)
 {
     int32_t values[3];
+    sbuf_t frame;
 
-    blackboxWrite('S');
+    blackboxFrameBegin(&frame, 'S');
 
-    blackboxWriteUnsignedVB(slowHistory.flightModeFlags);
-    blackboxWriteUnsignedVB(slowHistory.stateFlags);
+    blackboxEncodeUnsignedVB(&frame, slowHistory.flightModeFlags);
+    blackboxEncodeUnsignedVB(&frame, slowHistory.stateFlags);
 
     /*
      * Most of the time these three values will be able to pack into one byte for us:
@@ -831,7 +864,9 @@ static void writeSlowFrame(void)
     values[0] = slowHistory.failsafePhase;
     values[1] = slowHistory.rxSignalReceived ? 1 : 0;
     values[2] = slowHistory.rxFlightChannelsValid ? 1 : 0;
-    blackboxWriteTag2_3S32(values);
+    blackboxEncodeTag2_3S32(&frame, values);
+
+    blackboxFrameCommit(&frame);
 
     blackboxSlowFrameIterationTimer = 0;
 }
@@ -968,6 +1003,9 @@ void blackboxFinish(void)
         blackboxLogEvent(FLIGHT_LOG_EVENT_LOG_END, NULL);
         FALLTHROUGH;
     default:
+#ifdef USE_BLACKBOX_COMPRESSION
+        blackboxDeviceEndCompression();
+#endif
         blackboxSetState(BLACKBOX_STATE_SHUTTING_DOWN);
     }
 }
@@ -1024,19 +1062,25 @@ static bool inMotorTestMode(void) {
 #ifdef USE_GPS
 static void writeGPSHomeFrame(void)
 {
-    blackboxWrite('H');
+    sbuf_t frame;
 
-    blackboxWriteSignedVB(GPS_home[0]);
-    blackboxWriteSignedVB(GPS_home[1]);
+    blackboxFrameBegin(&frame, 'H');
+
+    blackboxEncodeSignedVB(&frame, GPS_home[0]);
+    blackboxEncodeSignedVB(&frame, GPS_home[1]);
     //TODO it'd be great if we could grab the GPS current time and write that too
 
+    blackboxFrameCommit(&frame);
+
     gpsHistory.GPS_home[0] = GPS_home[0];
     gpsHistory.GPS_home[1] = GPS_home[1];
 }
 
 static void writeGPSFrame(timeUs_t currentTimeUs)
 {
-    blackboxWrite('G');
+    sbuf_t frame;
+
+    blackboxFrameBegin(&frame, 'G');
 
     /*
      * If we're logging every frame, then a GPS frame always appears just after a frame with the
@@ -1046,15 +1090,17 @@ static void writeGPSFrame(timeUs_t currentTimeUs)
      */
     if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME)) {
         // Predict the time of the last frame in the main log
-        blackboxWriteUnsignedVB(currentTimeUs - blackboxHistory[1]->time);
+        blackboxEncodeUnsignedVB(&frame, currentTimeUs - blackboxHistory[1]->time);
     }
 
-    blackboxWriteUnsignedVB(gpsSol.numSat);
-    blackboxWriteSignedVB(gpsSol.llh.lat - gpsHistory.GPS_home[LAT]);
-    blackboxWriteSignedVB(gpsSol.llh.lon - gpsHistory.GPS_home[LON]);
-    blackboxWriteUnsignedVB(gpsSol.llh.altCm / 10); // was originally designed to transport meters in int16, but +-3276.7m is a good compromise
-    blackboxWriteUnsignedVB(gpsSol.groundSpeed);
-    blackboxWriteUnsignedVB(gpsSol.groundCourse);
+    blackboxEncodeUnsignedVB(&frame, gpsSol.numSat);
+    blackboxEncodeSignedVB(&frame, gpsSol.llh.lat - gpsHistory.GPS_home[LAT]);
+    blackboxEncodeSignedVB(&frame, gpsSol.llh.lon - gpsHistory.GPS_home[LON]);
+    blackboxEncodeUnsignedVB(&frame, gpsSol.llh.altCm / 10); // was originally designed to transport meters in int16, but +-3276.7m is a good compromise
+    blackboxEncodeUnsignedVB(&frame, gpsSol.groundSpeed);
+    blackboxEncodeUnsignedVB(&frame, gpsSol.groundCourse);
+
+    blackboxFrameCommit(&frame);
 
     gpsHistory.GPS_numSat = gpsSol.numSat;
     gpsHistory.GPS_coord[LAT] = gpsSol.llh.lat;
@@ -1430,6 +1476,9 @@ static bool blackboxWriteSysinfo(void)
         BLACKBOX_PRINT_HEADER_LINE("dyn_notch_width_percent", "%d",         gyroConfig()->dyn_notch_width_percent);
         BLACKBOX_PRINT_HEADER_LINE("dyn_notch_q", "%d",                     gyroConfig()->dyn_notch_q);
         BLACKBOX_PRINT_HEADER_LINE("dyn_notch_min_hz", "%d",                gyroConfig()->dyn_notch_min_hz);
+#ifdef USE_DYN_NOTCH_SDFT
+        BLACKBOX_PRINT_HEADER_LINE("dyn_notch_analyser", "%d",              gyroConfig()->dyn_notch_analyser);
+#endif
 #endif
 #ifdef USE_DSHOT_TELEMETRY
         BLACKBOX_PRINT_HEADER_LINE("dshot_bidir", "%d",                     motorConfig()->dev.useDshotTelemetry);
@@ -1523,6 +1572,7 @@ static bool blackboxWriteSysinfo(void)
                                                                             rpmFilterConfig()->filter_bank_max_hz[13],
                                                                             rpmFilterConfig()->filter_bank_max_hz[14],
                                                                             rpmFilterConfig()->filter_bank_max_hz[15]);
+        BLACKBOX_PRINT_HEADER_LINE("gyro_rpm_filter_fast_update", "%d",     rpmFilterConfig()->filter_fast_update);
 #endif
 #if defined(USE_ACC)
         BLACKBOX_PRINT_HEADER_LINE("acc_lpf_hz", "%d",                 (int)(accelerometerConfig()->acc_lpf_hz * 100.0f));
@@ -1560,6 +1610,15 @@ static bool blackboxWriteSysinfo(void)
 #endif // USE_RC_SMOOTHING_FILTER
         BLACKBOX_PRINT_HEADER_LINE("rates_type", "%d",                      currentControlRateProfile->rates_type);
 
+#ifdef USE_BLACKBOX_COMPRESSION
+        // Must be the last header, the compressed stream starts right after it
+        BLACKBOX_PRINT_HEADER_LINE_CUSTOM(
+            if (blackboxDeviceCanCompress()) {
+                blackboxPrintfHeaderLine("Data compression", "%d", BLACKBOX_COMPRESS_VERSION);
+            }
+            );
+#endif
+
         default:
             return true;
     }
@@ -1700,6 +1759,9 @@ STATIC_UNIT_TESTED void blackboxLogIteration(timeUs_t currentTimeUs)
 {
     // Write a keyframe every blackboxIInterval frames so we can resynchronise upon missing frames
     if (blackboxShouldLogIFrame()) {
+#ifdef USE_BLACKBOX_COMPRESSION
+        blackboxDeviceSyncCompression();
+#endif
         /*
          * Don't log a slow frame if the slow data didn't change ("I" frames are already large enough without adding
          * an additional item to write at the same time). Unless we're *only* logging "I" frames, then we have no choice.
@@ -1840,6 +1902,9 @@ void blackboxUpdate(timeUs_t currentTimeUs)
              */
             cacheFlushNextState = BLACKBOX_STATE_RUNNING;
             blackboxSetState(BLACKBOX_STATE_CACHE_FLUSH);
+#ifdef USE_BLACKBOX_COMPRESSION
+            blackboxDeviceBeginCompression();
+#endif
         }
         break;
     case BLACKBOX_STATE_CACHE_FLUSH:
@@ -1919,6 +1984,9 @@ void blackboxUpdate(timeUs_t currentTimeUs)
             && blackboxState != BLACKBOX_STATE_ERASED)
 #endif
         {
+#ifdef USE_BLACKBOX_COMPRESSION
+            blackboxDeviceEndCompression();
+#endif
             blackboxSetState(BLACKBOX_STATE_STOPPED);
             // ensure we reset the test mode flag if we stop due to full memory card
             if (startedLoggingInTestMode) {
@@ -0,0 +1,192 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Streaming compression of the blackbox log, after the field predictors
+ * and encoders.
+ *
+ * An adaptive binary range coder, as in LZMA. Each byte is preceded by an
+ * end-of-stream flag and coded MSB first down a bit tree of probabilities.
+ * There are two trees, picked by the top bit of the previous byte, as the
+ * bytes following a variable byte continuation differ from those starting
+ * a field. The probabilities start even and adapt as the log is written,
+ * so nothing but the coded bits is stored.
+ *
+ * The log is coded in blocks, each started from scratch. A block is the
+ * BLACKBOX_COMPRESS_SYNC marker, the coded bytes, which start with a zero
+ * byte and end with the flush after the end flag, and the CRC of the bytes
+ * coded in it, MSB first. A decoder reads exactly that many bytes and
+ * expects the next marker right after. Flash and SD card writes that fail
+ * lose data without telling us, so when a block does not check out the
+ * decoder skips ahead to the next marker. Blocks are ended at I-frames, so
+ * the log picks up again at a keyframe.
+ *
+ * Undone by src/utils/blackbox_decompress.py.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#ifdef USE_BLACKBOX_COMPRESSION
+
+#include "blackbox/blackbox_compress.h"
+
+#include "common/crc.h"
+
+#define PROB_ONE        (1 << BLACKBOX_COMPRESS_PROB_BITS)
+#define PROB_INIT       (PROB_ONE / 2)
+#define RANGE_TOP       (1 << 24)
+
+static void compressPutByte(blackboxCompressor_t *compressor, uint8_t value)
+{
+    compressor->buffer[compressor->bufferCount++] = value;
+
+    if (compressor->bufferCount >= BLACKBOX_COMPRESS_BUFFER_SIZE) {
+        compressor->writeFn(compressor->buffer, compressor->bufferCount);
+        compressor->bufferCount = 0;
+    }
+}
+
+// Moves the top byte of low out, holding back 0xFF bytes a carry may still reach
+static void compressShiftLow(blackboxCompressor_t *compressor)
+{
+    if ((uint32_t)compressor->low < 0xFF000000 || (compressor->low >> 32) != 0) {
+        const uint8_t carry = compressor->low >> 32;
+        uint8_t value = compressor->cache;
+
+        do {
+            compressPutByte(compressor, value + carry);
+            value = 0xFF;
+        } while (--compressor->cacheSize != 0);
+
+        compressor->cache = (uint8_t)(compressor->low >> 24);
+    }
+
+    compressor->cacheSize++;
+    compressor->low = (compressor->low & 0x00FFFFFF) << 8;
+}
+
+static inline void compressBit(blackboxCompressor_t *compressor, uint16_t *probability, unsigned bit)
+{
+    const uint32_t bound = (compressor->range >> BLACKBOX_COMPRESS_PROB_BITS) * *probability;
+
+    if (bit) {
+        compressor->low += bound;
+        compressor->range -= bound;
+        *probability -= *probability >> BLACKBOX_COMPRESS_ADAPT_SHIFT;
+    } else {
+        compressor->range = bound;
+        *probability += (PROB_ONE - *probability) >> BLACKBOX_COMPRESS_ADAPT_SHIFT;
+    }
+
+    while (compressor->range < RANGE_TOP) {
+        compressor->range <<= 8;
+        compressShiftLow(compressor);
+    }
+}
+
+static void compressStartBlock(blackboxCompressor_t *compressor)
+{
+    for (int i = 0; i < BLACKBOX_COMPRESS_SYNC_SIZE; i++) {
+        compressPutByte(compressor, BLACKBOX_COMPRESS_SYNC[i]);
+    }
+
+    compressor->low = 0;
+    compressor->range = 0xFFFFFFFF;
+    compressor->cacheSize = 1;
+    compressor->cache = 0;
+    compressor->context = 0;
+    compressor->endProbability = PROB_INIT;
+    compressor->crc = 0;
+    compressor->blockSize = 0;
+
+    for (int context = 0; context < 2; context++) {
+        for (int node = 0; node < 256; node++) {
+            compressor->probability[context][node] = PROB_INIT;
+        }
+    }
+}
+
+static void compressEndBlock(blackboxCompressor_t *compressor)
+{
+    compressBit(compressor, &compressor->endProbability, 1);
+
+    for (int i = 0; i < 5; i++) {
+        compressShiftLow(compressor);
+    }
+
+    compressPutByte(compressor, compressor->crc >> 8);
+    compressPutByte(compressor, compressor->crc & 0xFF);
+}
+
+void blackboxCompressInit(blackboxCompressor_t *compressor, blackboxCompressWriteFn *writeFn)
+{
+    compressor->bufferCount = 0;
+    compressor->writeFn = writeFn;
+
+    compressStartBlock(compressor);
+}
+
+void blackboxCompress(blackboxCompressor_t *compressor, const uint8_t *data, int len)
+{
+    for (int i = 0; i < len; i++) {
+        const unsigned value = data[i];
+        uint16_t *tree = compressor->probability[compressor->context];
+        unsigned node = 1;
+
+        compressBit(compressor, &compressor->endProbability, 0);
+
+        for (int shift = 7; shift >= 0; shift--) {
+            const unsigned bit = (value >> shift) & 1;
+            compressBit(compressor, &tree[node], bit);
+            node = (node << 1) | bit;
+        }
+
+        compressor->context = value >> 7;
+        compressor->crc = crc16_ccitt(compressor->crc, value);
+    }
+
+    compressor->blockSize += len;
+}
+
+// Called where the log can be picked up again. Returns true if a new block was started here
+bool blackboxCompressSync(blackboxCompressor_t *compressor)
+{
+    if (compressor->blockSize < BLACKBOX_COMPRESS_BLOCK_SIZE) {
+        return false;
+    }
+
+    compressEndBlock(compressor);
+    compressStartBlock(compressor);
+
+    return true;
+}
+
+// Ends the stream and hands on everything still held
+void blackboxCompressFinish(blackboxCompressor_t *compressor)
+{
+    compressEndBlock(compressor);
+
+    if (compressor->bufferCount) {
+        compressor->writeFn(compressor->buffer, compressor->bufferCount);
+        compressor->bufferCount = 0;
+    }
+}
+
+#endif
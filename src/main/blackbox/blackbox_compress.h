@@ -0,0 +1,61 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Written in the "Data compression" header line, for the decoder
+#define BLACKBOX_COMPRESS_VERSION       2
+
+// Probabilities are out of 1 << BLACKBOX_COMPRESS_PROB_BITS
+#define BLACKBOX_COMPRESS_PROB_BITS     11
+// Adaptation rate, as a shift
+#define BLACKBOX_COMPRESS_ADAPT_SHIFT   5
+
+// Output is handed on in blocks of this size
+#define BLACKBOX_COMPRESS_BUFFER_SIZE   64
+
+// Each block of the stream starts with this marker, for the decoder to resync on
+#define BLACKBOX_COMPRESS_SYNC          "\xA5" "BZ" "\x5A"
+#define BLACKBOX_COMPRESS_SYNC_SIZE     4
+
+// A block is ended at the next sync point once this many bytes are in it
+#define BLACKBOX_COMPRESS_BLOCK_SIZE    4096
+
+typedef void blackboxCompressWriteFn(const uint8_t *data, int len);
+
+typedef struct blackboxCompressor_s {
+    uint64_t low;
+    uint32_t range;
+    uint32_t cacheSize;
+    uint8_t cache;
+    uint8_t context;                        // top bit of the previous byte
+    uint16_t bufferCount;
+    uint16_t endProbability;
+    uint16_t crc;                           // CRC16 CCITT of the bytes in this block
+    uint32_t blockSize;                     // bytes in this block
+    uint16_t probability[2][256];           // bit tree per context, from node 1
+    uint8_t buffer[BLACKBOX_COMPRESS_BUFFER_SIZE];
+    blackboxCompressWriteFn *writeFn;
+} blackboxCompressor_t;
+
+void blackboxCompressInit(blackboxCompressor_t *compressor, blackboxCompressWriteFn *writeFn);
+void blackboxCompress(blackboxCompressor_t *compressor, const uint8_t *data, int len);
+bool blackboxCompressSync(blackboxCompressor_t *compressor);
+void blackboxCompressFinish(blackboxCompressor_t *compressor);
@@ -32,7 +32,9 @@
 #include "blackbox_io.h"
 
 #include "common/encoding.h"
+#include "common/maths.h"
 #include "common/printf.h"
+#include "common/streambuf.h"
 
 
 static void _putc(void *p, char c)
@@ -86,51 +88,51 @@ void blackboxPrintfHeaderLine(const char *name, const char *fmt, ...)
 }
 
 /**
- * Write an unsigned integer to the blackbox serial port using variable byte encoding.
+ * Encode an unsigned integer using variable byte encoding.
  */
-void blackboxWriteUnsignedVB(uint32_t value)
+void blackboxEncodeUnsignedVB(sbuf_t *dst, uint32_t value)
 {
     //While this isn't the final byte (we can only write 7 bits at a time)
     while (value > 127) {
-        blackboxWrite((uint8_t) (value | 0x80)); // Set the high bit to mean "more bytes follow"
+        sbufWriteU8(dst, (uint8_t) (value | 0x80)); // Set the high bit to mean "more bytes follow"
         value >>= 7;
     }
-    blackboxWrite(value);
+    sbufWriteU8(dst, value);
 }
 
 /**
- * Write a signed integer to the blackbox serial port using ZigZig and variable byte encoding.
+ * Encode a signed integer using ZigZig and variable byte encoding.
  */
-void blackboxWriteSignedVB(int32_t value)
+void blackboxEncodeSignedVB(sbuf_t *dst, int32_t value)
 {
     //ZigZag encode to make the value always positive
-    blackboxWriteUnsignedVB(zigzagEncode(value));
+    blackboxEncodeUnsignedVB(dst, zigzagEncode(value));
 }
 
-void blackboxWriteSignedVBArray(int32_t *array, int count)
+void blackboxEncodeSignedVBArray(sbuf_t *dst, const int32_t *array, int count)
 {
     for (int i = 0; i < count; i++) {
-        blackboxWriteSignedVB(array[i]);
+        blackboxEncodeSignedVB(dst, array[i]);
     }
 }
 
-void blackboxWriteSigned16VBArray(int16_t *array, int count)
+void blackboxEncodeSigned16VBArray(sbuf_t *dst, const int16_t *array, int count)
 {
     for (int i = 0; i < count; i++) {
-        blackboxWriteSignedVB(array[i]);
+        blackboxEncodeSignedVB(dst, array[i]);
     }
 }
 
-void blackboxWriteS16(int16_t value)
+void blackboxEncodeS16(sbuf_t *dst, int16_t value)
 {
-    blackboxWrite(value & 0xFF);
-    blackboxWrite((value >> 8) & 0xFF);
+    sbufWriteU8(dst, value & 0xFF);
+    sbufWriteU8(dst, (value >> 8) & 0xFF);
 }
 
 /**
- * Write a 2 bit tag followed by 3 signed fields of 2, 4, 6 or 32 bits
+ * Encode a 2 bit tag followed by 3 signed fields of 2, 4, 6 or 32 bits
  */
-void blackboxWriteTag2_3S32(int32_t *values)
+void blackboxEncodeTag2_3S32(sbuf_t *dst, const int32_t *values)
 {
     static const int NUM_FIELDS = 3;
 
@@ -183,16 +185,16 @@ void blackboxWriteTag2_3S32(int32_t *values)
 
     switch (selector) {
     case BITS_2:
-        blackboxWrite((selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
+        sbufWriteU8(dst, (selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
         break;
     case BITS_4:
-        blackboxWrite((selector << 6) | (values[0] & 0x0F));
-        blackboxWrite((values[1] << 4) | (values[2] & 0x0F));
+        sbufWriteU8(dst, (selector << 6) | (values[0] & 0x0F));
+        sbufWriteU8(dst, (values[1] << 4) | (values[2] & 0x0F));
         break;
     case BITS_6:
-        blackboxWrite((selector << 6) | (values[0] & 0x3F));
-        blackboxWrite((uint8_t)values[1]);
-        blackboxWrite((uint8_t)values[2]);
+        sbufWriteU8(dst, (selector << 6) | (values[0] & 0x3F));
+        sbufWriteU8(dst, (uint8_t)values[1]);
+        sbufWriteU8(dst, (uint8_t)values[2]);
         break;
     case BITS_32:
         /*
@@ -222,28 +224,28 @@ void blackboxWriteTag2_3S32(int32_t *values)
         }
 
         //Write the selectors
-        blackboxWrite((selector << 6) | selector2);
+        sbufWriteU8(dst, (selector << 6) | selector2);
 
         //And now the values according to the selectors we picked for them
         for (int x = 0; x < NUM_FIELDS; x++, selector2 >>= 2) {
             switch (selector2 & 0x03) {
             case BYTES_1:
-                blackboxWrite(values[x]);
+                sbufWriteU8(dst, values[x]);
                 break;
             case BYTES_2:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
+                sbufWriteU8(dst, values[x]);
+                sbufWriteU8(dst, values[x] >> 8);
                 break;
             case BYTES_3:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x] >> 16);
+                sbufWriteU8(dst, values[x]);
+                sbufWriteU8(dst, values[x] >> 8);
+                sbufWriteU8(dst, values[x] >> 16);
                 break;
             case BYTES_4:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x] >> 16);
-                blackboxWrite(values[x] >> 24);
+                sbufWriteU8(dst, values[x]);
+                sbufWriteU8(dst, values[x] >> 8);
+                sbufWriteU8(dst, values[x] >> 16);
+                sbufWriteU8(dst, values[x] >> 24);
                 break;
             }
         }
@@ -252,9 +254,9 @@ void blackboxWriteTag2_3S32(int32_t *values)
 }
 
 /**
- * Write a 2 bit tag followed by 3 signed fields of 2, 554, 877 or 32 bits
+ * Encode a 2 bit tag followed by 3 signed fields of 2, 554, 877 or 32 bits
  */
-int blackboxWriteTag2_3SVariable(int32_t *values)
+int blackboxEncodeTag2_3SVariable(sbuf_t *dst, const int32_t *values)
 {
     static const int FIELD_COUNT = 3;
     enum {
@@ -304,18 +306,18 @@ int blackboxWriteTag2_3SVariable(int32_t *values)
 
     switch (selector) {
     case BITS_2:
-        blackboxWrite((selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
+        sbufWriteU8(dst, (selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
         break;
     case BITS_554:
         // 554 bits per field  ss11 1112 2222 3333
-        blackboxWrite((selector << 6) | ((values[0] & 0x1F) << 1) | ((values[1] & 0x1F) >> 4));
-        blackboxWrite(((values[1] & 0x0F) << 4) | (values[2] & 0x0F));
+        sbufWriteU8(dst, (selector << 6) | ((values[0] & 0x1F) << 1) | ((values[1] & 0x1F) >> 4));
+        sbufWriteU8(dst, ((values[1] & 0x0F) << 4) | (values[2] & 0x0F));
         break;
     case BITS_877:
         // 877 bits per field  ss11 1111 1122 2222 2333 3333
-        blackboxWrite((selector << 6) | ((values[0] & 0xFF) >> 2));
-        blackboxWrite(((values[0] & 0x03) << 6) | ((values[1] & 0x7F) >> 1));
-        blackboxWrite(((values[1] & 0x01) << 7) | (values[2] & 0x7F));
+        sbufWriteU8(dst, (selector << 6) | ((values[0] & 0xFF) >> 2));
+        sbufWriteU8(dst, ((values[0] & 0x03) << 6) | ((values[1] & 0x7F) >> 1));
+        sbufWriteU8(dst, ((values[1] & 0x01) << 7) | (values[2] & 0x7F));
         break;
     case BITS_32:
         /*
@@ -344,28 +346,28 @@ int blackboxWriteTag2_3SVariable(int32_t *values)
         }
 
         //Write the selectors
-        blackboxWrite((selector << 6) | selector2);
+        sbufWriteU8(dst, (selector << 6) | selector2);
 
         //And now the values according to the selectors we picked for them
         for (int x = 0; x < FIELD_COUNT; x++, selector2 >>= 2) {
             switch (selector2 & 0x03) {
             case BYTES_1:
-                blackboxWrite(values[x]);
+                sbufWriteU8(dst, values[x]);
                 break;
             case BYTES_2:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
+                sbufWriteU8(dst, values[x]);
+                sbufWriteU8(dst, values[x] >> 8);
                 break;
             case BYTES_3:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x] >> 16);
+                sbufWriteU8(dst, values[x]);
+                sbufWriteU8(dst, values[x] >> 8);
+                sbufWriteU8(dst, values[x] >> 16);
                 break;
             case BYTES_4:
-                blackboxWrite(values[x]);
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x] >> 16);
-                blackboxWrite(values[x] >> 24);
+                sbufWriteU8(dst, values[x]);
+                sbufWriteU8(dst, values[x] >> 8);
+                sbufWriteU8(dst, values[x] >> 16);
+                sbufWriteU8(dst, values[x] >> 24);
                 break;
             }
         }
@@ -375,9 +377,9 @@ int blackboxWriteTag2_3SVariable(int32_t *values)
 }
 
 /**
- * Write an 8-bit selector followed by four signed fields of size 0, 4, 8 or 16 bits.
+ * Encode an 8-bit selector followed by four signed fields of size 0, 4, 8 or 16 bits.
  */
-void blackboxWriteTag8_4S16(int32_t *values)
+void blackboxEncodeTag8_4S16(sbuf_t *dst, const int32_t *values)
 {
 
     //Need to be enums rather than const ints if we want to switch on them (due to being C)
@@ -404,7 +406,7 @@ void blackboxWriteTag8_4S16(int32_t *values)
         }
     }
 
-    blackboxWrite(selector);
+    sbufWriteU8(dst, selector);
 
     int nibbleIndex = 0;
     uint8_t buffer = 0;
@@ -419,16 +421,16 @@ void blackboxWriteTag8_4S16(int32_t *values)
                 buffer = values[x] << 4;
                 nibbleIndex = 1;
             } else {
-                blackboxWrite(buffer | (values[x] & 0x0F));
+                sbufWriteU8(dst, buffer | (values[x] & 0x0F));
                 nibbleIndex = 0;
             }
             break;
         case FIELD_8BIT:
             if (nibbleIndex == 0) {
-                blackboxWrite(values[x]);
+                sbufWriteU8(dst, values[x]);
             } else {
                 //Write the high bits of the value first (mask to avoid sign extension)
-                blackboxWrite(buffer | ((values[x] >> 4) & 0x0F));
+                sbufWriteU8(dst, buffer | ((values[x] >> 4) & 0x0F));
                 //Now put the leftover low bits into the top of the next buffer entry
                 buffer = values[x] << 4;
             }
@@ -436,13 +438,13 @@ void blackboxWriteTag8_4S16(int32_t *values)
         case FIELD_16BIT:
             if (nibbleIndex == 0) {
                 //Write high byte first
-                blackboxWrite(values[x] >> 8);
-                blackboxWrite(values[x]);
+                sbufWriteU8(dst, values[x] >> 8);
+                sbufWriteU8(dst, values[x]);
             } else {
                 //First write the highest 4 bits
-                blackboxWrite(buffer | ((values[x] >> 12) & 0x0F));
+                sbufWriteU8(dst, buffer | ((values[x] >> 12) & 0x0F));
                 // Then the middle 8
-                blackboxWrite(values[x] >> 4);
+                sbufWriteU8(dst, values[x] >> 4);
                 //Only the smallest 4 bits are still left to write
                 buffer = values[x] << 4;
             }
@@ -451,24 +453,24 @@ void blackboxWriteTag8_4S16(int32_t *values)
     }
     //Anything left over to write?
     if (nibbleIndex == 1) {
-        blackboxWrite(buffer);
+        sbufWriteU8(dst, buffer);
     }
 }
 
 /**
- * Write `valueCount` fields from `values` to the Blackbox using signed variable byte encoding. A 1-byte header is
+ * Encode `valueCount` fields from `values` using signed variable byte encoding. A 1-byte header is
  * written first which specifies which fields are non-zero (so this encoding is compact when most fields are zero).
  *
  * valueCount must be 8 or less.
  */
-void blackboxWriteTag8_8SVB(int32_t *values, int valueCount)
+void blackboxEncodeTag8_8SVB(sbuf_t *dst, const int32_t *values, int valueCount)
 {
     uint8_t header;
 
     if (valueCount > 0) {
         //If we're only writing one field then we can skip the header
         if (valueCount == 1) {
-            blackboxWriteSignedVB(values[0]);
+            blackboxEncodeSignedVB(dst, values[0]);
         } else {
             //First write a one-byte header that marks which fields are non-zero
             header = 0;
@@ -482,29 +484,124 @@ void blackboxWriteTag8_8SVB(int32_t *values, int valueCount)
                 }
             }
 
-            blackboxWrite(header);
+            sbufWriteU8(dst, header);
 
             for (int i = 0; i < valueCount; i++) {
                 if (values[i] != 0) {
-                    blackboxWriteSignedVB(values[i]);
+                    blackboxEncodeSignedVB(dst, values[i]);
                 }
             }
         }
     }
 }
 
-/** Write unsigned integer **/
+/** Encode unsigned integer **/
+void blackboxEncodeU32(sbuf_t *dst, int32_t value)
+{
+    sbufWriteU8(dst, value & 0xFF);
+    sbufWriteU8(dst, (value >> 8) & 0xFF);
+    sbufWriteU8(dst, (value >> 16) & 0xFF);
+    sbufWriteU8(dst, (value >> 24) & 0xFF);
+}
+
+/** Encode float value in the integer form **/
+void blackboxEncodeFloat(sbuf_t *dst, float value)
+{
+    blackboxEncodeU32(dst, castFloatBytesToInt(value));
+}
+
+/*
+ * Single value writers, for the header, event and other rarely written data. Each one encodes into a small local
+ * buffer and hands that to the device in one write. Frames are built whole with the encoders above instead.
+ */
+
+void blackboxWriteUnsignedVB(uint32_t value)
+{
+    uint8_t buf[BLACKBOX_MAX_VB_SIZE];
+    sbuf_t dst = { buf, buf + sizeof(buf) };
+
+    blackboxEncodeUnsignedVB(&dst, value);
+    blackboxWriteData(buf, dst.ptr - buf);
+}
+
+void blackboxWriteSignedVB(int32_t value)
+{
+    blackboxWriteUnsignedVB(zigzagEncode(value));
+}
+
+void blackboxWriteSignedVBArray(int32_t *array, int count)
+{
+    for (int i = 0; i < count; i++) {
+        blackboxWriteSignedVB(array[i]);
+    }
+}
+
+void blackboxWriteSigned16VBArray(int16_t *array, int count)
+{
+    for (int i = 0; i < count; i++) {
+        blackboxWriteSignedVB(array[i]);
+    }
+}
+
+void blackboxWriteS16(int16_t value)
+{
+    uint8_t buf[2];
+    sbuf_t dst = { buf, buf + sizeof(buf) };
+
+    blackboxEncodeS16(&dst, value);
+    blackboxWriteData(buf, dst.ptr - buf);
+}
+
+void blackboxWriteTag2_3S32(int32_t *values)
+{
+    uint8_t buf[1 + 3 * 4];
+    sbuf_t dst = { buf, buf + sizeof(buf) };
+
+    blackboxEncodeTag2_3S32(&dst, values);
+    blackboxWriteData(buf, dst.ptr - buf);
+}
+
+int blackboxWriteTag2_3SVariable(int32_t *values)
+{
+    uint8_t buf[1 + 3 * 4];
+    sbuf_t dst = { buf, buf + sizeof(buf) };
+
+    const int selector = blackboxEncodeTag2_3SVariable(&dst, values);
+    blackboxWriteData(buf, dst.ptr - buf);
+
+    return selector;
+}
+
+void blackboxWriteTag8_4S16(int32_t *values)
+{
+    uint8_t buf[1 + 4 * 2];
+    sbuf_t dst = { buf, buf + sizeof(buf) };
+
+    blackboxEncodeTag8_4S16(&dst, values);
+    blackboxWriteData(buf, dst.ptr - buf);
+}
+
+void blackboxWriteTag8_8SVB(int32_t *values, int valueCount)
+{
+    uint8_t buf[1 + 8 * BLACKBOX_MAX_VB_SIZE];
+    sbuf_t dst = { buf, buf + sizeof(buf) };
+
+    blackboxEncodeTag8_8SVB(&dst, values, MIN(valueCount, 8));
+    blackboxWriteData(buf, dst.ptr - buf);
+}
+
 void blackboxWriteU32(int32_t value)
 {
-    blackboxWrite(value & 0xFF);
-    blackboxWrite((value >> 8) & 0xFF);
-    blackboxWrite((value >> 16) & 0xFF);
-    blackboxWrite((value >> 24) & 0xFF);
+    uint8_t buf[4];
+    sbuf_t dst = { buf, buf + sizeof(buf) };
+
+    blackboxEncodeU32(&dst, value);
+    blackboxWriteData(buf, dst.ptr - buf);
 }
 
-/** Write float value in the integer form **/
 void blackboxWriteFloat(float value)
 {
     blackboxWriteU32(castFloatBytesToInt(value));
 }
+
 #endif // BLACKBOX
@@ -20,6 +20,11 @@
 
 #pragma once
 
+#include "common/streambuf.h"
+
+// Largest unsigned variable byte encoding of a 32 bit value
+#define BLACKBOX_MAX_VB_SIZE 5
+
 int blackboxPrintf(const char *fmt, ...);
 void blackboxPrintfHeaderLine(const char *name, const char *fmt, ...);
 
@@ -34,3 +39,20 @@ void blackboxWriteTag8_4S16(int32_t *values);
 void blackboxWriteTag8_8SVB(int32_t *values, int valueCount);
 void blackboxWriteU32(int32_t value);
 void blackboxWriteFloat(float value);
+
+/*
+ * Encoders into a caller supplied buffer, so that a whole frame can be built up front and handed to the device
+ * with one write. The caller must size the buffer for the worst case; the byte stream is the same as the
+ * blackboxWrite* functions above produce.
+ */
+void blackboxEncodeUnsignedVB(sbuf_t *dst, uint32_t value);
+void blackboxEncodeSignedVB(sbuf_t *dst, int32_t value);
+void blackboxEncodeSignedVBArray(sbuf_t *dst, const int32_t *array, int count);
+void blackboxEncodeSigned16VBArray(sbuf_t *dst, const int16_t *array, int count);
+void blackboxEncodeS16(sbuf_t *dst, int16_t value);
+void blackboxEncodeTag2_3S32(sbuf_t *dst, const int32_t *values);
+int blackboxEncodeTag2_3SVariable(sbuf_t *dst, const int32_t *values);
+void blackboxEncodeTag8_4S16(sbuf_t *dst, const int32_t *values);
+void blackboxEncodeTag8_8SVB(sbuf_t *dst, const int32_t *values, int valueCount);
+void blackboxEncodeU32(sbuf_t *dst, int32_t value);
+void blackboxEncodeFloat(sbuf_t *dst, float value);
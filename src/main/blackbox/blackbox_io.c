@@ -43,6 +43,7 @@
 #define DEBUG_BB_OUTPUT
 
 #include "blackbox.h"
+#include "blackbox_compress.h"
 #include "blackbox_io.h"
 
 #include "common/maths.h"
@@ -84,6 +85,7 @@ static struct {
         BLACKBOX_SDCARD_ENUMERATE_FILES,
         BLACKBOX_SDCARD_CHANGE_INTO_LOG_DIRECTORY,
         BLACKBOX_SDCARD_READY_TO_CREATE_LOG,
+        BLACKBOX_SDCARD_RESERVE_LOG_SPACE,
         BLACKBOX_SDCARD_READY_TO_LOG
     } state;
 } blackboxSDCard;
@@ -91,6 +93,12 @@ static struct {
 #define LOGFILE_PREFIX "LOG"
 #define LOGFILE_SUFFIX "BFL"
 
+/*
+ * Space taken for a new log up front, so that the log can be streamed to
+ * the card without FAT updates. What is left unused goes back on close.
+ */
+#define LOGFILE_RESERVE_SIZE (64 * 1024 * 1024)
+
 #endif // USE_SDCARD
 
 void blackboxOpen(void)
@@ -106,9 +114,30 @@ static uint32_t bbBits;
 static timeMs_t bbLastclearMs;
 static uint16_t bbRateMax;
 static uint32_t bbDrops;
+
+static void blackboxUpdateOutputRate(void)
+{
+    timeMs_t now = millis();
+
+    if (now > bbLastclearMs + 100) {  // Debug log every 100[msec]
+        uint16_t bbRate = ((bbBits * 10 + 5) / (now - bbLastclearMs)) / 10; // In unit of [Kbps]
+        DEBUG_SET(DEBUG_BLACKBOX_OUTPUT, 0, bbRate);
+        if (bbRate > bbRateMax) {
+            bbRateMax = bbRate;
+            DEBUG_SET(DEBUG_BLACKBOX_OUTPUT, 1, bbRateMax);
+        }
+        bbLastclearMs = now;
+        bbBits = 0;
+    }
+}
 #endif
 
-void blackboxWrite(uint8_t value)
+#ifdef USE_BLACKBOX_COMPRESSION
+static blackboxCompressor_t blackboxCompressor;
+static bool blackboxCompressing;
+#endif
+
+static void blackboxDeviceWriteByte(uint8_t value)
 {
 #ifdef DEBUG_BB_OUTPUT
     bbBits += 8;
@@ -148,19 +177,61 @@ void blackboxWrite(uint8_t value)
     }
 
 #ifdef DEBUG_BB_OUTPUT
-    timeMs_t now = millis();
+    blackboxUpdateOutputRate();
+#endif
+}
 
-    if (now > bbLastclearMs + 100) {  // Debug log every 100[msec]
-        uint16_t bbRate = ((bbBits * 10 + 5) / (now - bbLastclearMs)) / 10; // In unit of [Kbps]
-        DEBUG_SET(DEBUG_BLACKBOX_OUTPUT, 0, bbRate);
-        if (bbRate > bbRateMax) {
-            bbRateMax = bbRate;
-            DEBUG_SET(DEBUG_BLACKBOX_OUTPUT, 1, bbRateMax);
+// Write 'len' bytes to the blackbox device, in one go for the devices that take a buffer
+static void blackboxDeviceWriteData(const uint8_t *data, int len)
+{
+    switch (blackboxConfig()->device) {
+#ifdef USE_FLASHFS
+    case BLACKBOX_DEVICE_FLASH:
+        flashfsWrite(data, len, false); // Write asynchronously
+        break;
+#endif
+#ifdef USE_SDCARD
+    case BLACKBOX_DEVICE_SDCARD:
+        afatfs_fwrite(blackboxSDCard.logFile, data, len); // Ignore failures due to buffers filling up
+        break;
+#endif
+    case BLACKBOX_DEVICE_SERIAL:
+    default:
+        // Byte by byte, so a full transmit buffer drops bytes exactly as before
+        for (int i = 0; i < len; i++) {
+            blackboxDeviceWriteByte(data[i]);
         }
-        bbLastclearMs = now;
-        bbBits = 0;
+        return;
+    }
+
+#ifdef DEBUG_BB_OUTPUT
+    bbBits += len * 8;
+    blackboxUpdateOutputRate();
+#endif
+}
+
+void blackboxWrite(uint8_t value)
+{
+#ifdef USE_BLACKBOX_COMPRESSION
+    if (blackboxCompressing) {
+        blackboxCompress(&blackboxCompressor, &value, 1);
+        return;
+    }
+#endif
+
+    blackboxDeviceWriteByte(value);
+}
+
+void blackboxWriteData(const uint8_t *data, int len)
+{
+#ifdef USE_BLACKBOX_COMPRESSION
+    if (blackboxCompressing) {
+        blackboxCompress(&blackboxCompressor, data, len);
+        return;
     }
 #endif
+
+    blackboxDeviceWriteData(data, len);
 }
 
 // Print the null-terminated string 's' to the blackbox device and return the number of bytes written
@@ -169,6 +240,14 @@ int blackboxWriteString(const char *s)
     int length;
     const uint8_t *pos;
 
+#ifdef USE_BLACKBOX_COMPRESSION
+    if (blackboxCompressing) {
+        length = strlen(s);
+        blackboxCompress(&blackboxCompressor, (const uint8_t*) s, length);
+        return length;
+    }
+#endif
+
     switch (blackboxConfig()->device) {
 
 #ifdef USE_FLASHFS
@@ -189,7 +268,7 @@ int blackboxWriteString(const char *s)
     default:
         pos = (uint8_t*) s;
         while (*pos) {
-            blackboxWrite(*pos);
+            blackboxDeviceWriteByte(*pos);
             pos++;
         }
 
@@ -404,6 +483,10 @@ bool isBlackboxErased(void)
  */
 void blackboxDeviceClose(void)
 {
+#ifdef USE_BLACKBOX_COMPRESSION
+    blackboxCompressing = false;
+#endif
+
     switch (blackboxConfig()->device) {
     case BLACKBOX_DEVICE_SERIAL:
         // Can immediately close without attempting to flush any remaining data.
@@ -430,6 +513,58 @@ void blackboxDeviceClose(void)
     }
 }
 
+#ifdef USE_BLACKBOX_COMPRESSION
+/**
+ * True if the log is to be compressed once its headers are out. Serial drops bytes when its buffer is full, which a
+ * compressed stream cannot survive, so only the flash and SD card devices compress.
+ */
+bool blackboxDeviceCanCompress(void)
+{
+    if (!blackboxConfig()->compression) {
+        return false;
+    }
+
+    switch (blackboxConfig()->device) {
+#ifdef USE_FLASHFS
+    case BLACKBOX_DEVICE_FLASH:
+        return true;
+#endif
+#ifdef USE_SDCARD
+    case BLACKBOX_DEVICE_SDCARD:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+// Everything written from here on goes through the compressor
+void blackboxDeviceBeginCompression(void)
+{
+    if (blackboxDeviceCanCompress()) {
+        blackboxCompressInit(&blackboxCompressor, blackboxDeviceWriteData);
+        blackboxCompressing = true;
+    }
+}
+
+// Called before an I-frame, which a decoder can pick the log up again at after losing data
+void blackboxDeviceSyncCompression(void)
+{
+    if (blackboxCompressing) {
+        blackboxCompressSync(&blackboxCompressor);
+    }
+}
+
+// Ends the compressed stream and writes out what the compressor still holds
+void blackboxDeviceEndCompression(void)
+{
+    if (blackboxCompressing) {
+        blackboxCompressing = false;
+        blackboxCompressFinish(&blackboxCompressor);
+    }
+}
+#endif // USE_BLACKBOX_COMPRESSION
+
 #ifdef USE_SDCARD
 
 static void blackboxLogDirCreated(afatfsFilePtr_t directory)
@@ -453,13 +588,21 @@ static void blackboxLogFileCreated(afatfsFilePtr_t file)
 
         blackboxSDCard.largestLogFileNumber++;
 
-        blackboxSDCard.state = BLACKBOX_SDCARD_READY_TO_LOG;
+        blackboxSDCard.state = BLACKBOX_SDCARD_RESERVE_LOG_SPACE;
     } else {
         // Retry
         blackboxSDCard.state = BLACKBOX_SDCARD_READY_TO_CREATE_LOG;
     }
 }
 
+static void blackboxLogSpaceReserved(afatfsFilePtr_t file)
+{
+    UNUSED(file);
+
+    // Without the reservation the log grows as it is written
+    blackboxSDCard.state = BLACKBOX_SDCARD_READY_TO_LOG;
+}
+
 static void blackboxCreateLogFile(void)
 {
     int32_t remainder = blackboxSDCard.largestLogFileNumber + 1;
@@ -538,6 +681,15 @@ static bool blackboxSDCardBeginLog(void)
         blackboxCreateLogFile();
         break;
 
+    case BLACKBOX_SDCARD_RESERVE_LOG_SPACE:
+        blackboxSDCard.state = BLACKBOX_SDCARD_WAITING;
+
+        if (!afatfs_freserve(blackboxSDCard.logFile, LOGFILE_RESERVE_SIZE, blackboxLogSpaceReserved)) {
+            blackboxSDCard.state = BLACKBOX_SDCARD_READY_TO_LOG;
+            goto doMore;
+        }
+        break;
+
     case BLACKBOX_SDCARD_READY_TO_LOG:
         return true; // Log has been created!
     }
@@ -42,6 +42,7 @@ extern int32_t blackboxHeaderBudget;
 
 void blackboxOpen(void);
 void blackboxWrite(uint8_t value);
+void blackboxWriteData(const uint8_t *data, int len);
 int blackboxWriteString(const char *s);
 
 void blackboxDeviceFlush(void);
@@ -51,6 +52,11 @@ bool blackboxDeviceFlushForceComplete(void);
 bool blackboxDeviceOpen(void);
 void blackboxDeviceClose(void);
 
+bool blackboxDeviceCanCompress(void);
+void blackboxDeviceBeginCompression(void);
+void blackboxDeviceSyncCompression(void);
+void blackboxDeviceEndCompression(void);
+
 void blackboxEraseAll(void);
 bool isBlackboxErased(void);
 
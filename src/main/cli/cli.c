@@ -46,6 +46,7 @@ bool cliMode = false;
 
 #include "common/axis.h"
 #include "common/color.h"
+#include "common/crc.h"
 #include "common/maths.h"
 #include "common/printf.h"
 #include "common/printf_serial.h"
@@ -844,16 +845,8 @@ STATIC_UNIT_TESTED void *cliGetValuePointer(const clivalue_t *value)
     }
 }
 
-static const char *dumpPgValue(const char *cmdName, const clivalue_t *value, dumpFlags_t dumpMask, const char *headingStr)
+static const char *dumpPgValue(const char *cmdName, const clivalue_t *value, const pgRegistry_t *pg, dumpFlags_t dumpMask, const char *headingStr)
 {
-    const pgRegistry_t *pg = pgFind(value->pgn);
-#ifdef DEBUG
-    if (!pg) {
-        cliPrintLinef("VALUE %s ERROR", value->name);
-        return headingStr; // if it's not found, the pgn shouldn't be in the value table!
-    }
-#endif
-
     const char *format = "set %s = ";
     const char *defaultFormat = "#set %s = ";
     const int valueOffset = getValueOffset(value);
@@ -875,13 +868,31 @@ static const char *dumpPgValue(const char *cmdName, const clivalue_t *value, dum
 
 static void dumpAllValues(const char *cmdName, uint16_t valueSection, dumpFlags_t dumpMask, const char *headingStr)
 {
+    const pgRegistry_t *pg = NULL;
+    bool pgEqualsDefault = false;
+
     headingStr = cliPrintSectionHeading(dumpMask, false, headingStr);
 
     for (uint32_t i = 0; i < valueTableEntryCount; i++) {
         const clivalue_t *value = &valueTable[i];
-        cliWriterFlush();
         if ((value->type & VALUE_SECTION_MASK) == valueSection || ((valueSection == MASTER_VALUE) && (value->type & VALUE_SECTION_MASK) == HARDWARE_VALUE)) {
-            headingStr = dumpPgValue(cmdName, value, dumpMask, headingStr);
+            // valueTable is grouped by pgn, each group is compared to its defaults once
+            if (!pg || pgN(pg) != value->pgn) {
+                pg = pgFind(value->pgn);
+#ifdef DEBUG
+                if (!pg) {
+                    cliPrintLinef("VALUE %s ERROR", value->name);
+                    continue; // if it's not found, the pgn shouldn't be in the value table!
+                }
+#endif
+                pgEqualsDefault = memcmp(pg->copy, pg->address, pg->size) == 0;
+            }
+            // nothing of an unchanged group goes into a diff
+            if ((dumpMask & DO_DIFF) && pgEqualsDefault) {
+                continue;
+            }
+            cliWriterFlush();
+            headingStr = dumpPgValue(cmdName, value, pg, dumpMask, headingStr);
         }
     }
 }
@@ -2470,7 +2481,7 @@ static void cliMixScale(const char *cmdName, char *cmdline)
         {
             mixerScalesMutable()->scale[vals[INPUT]] = vals[SCALE];
             // Update mixer to perform immediate change before saving
-            mixScales[vals[INPUT]] = vals[SCALE];
+            mixerSetInputScale(vals[INPUT], vals[SCALE]);
             cliPrintLinef("mixscale %s %d", mixerInputNames[vals[INPUT]], vals[SCALE]);
             cliPrintLinef("# Be sure to save when you are finished!");
         } else {
@@ -3281,7 +3292,7 @@ static void printEscInfo(const char *cmdName, const uint8_t *escInfoBuffer, uint
             if (bytesRead == frameLength) {
                 escInfoReceived = true;
 
-                if (calculateCrc8(escInfoBuffer, frameLength - 1) == escInfoBuffer[frameLength - 1]) {
+                if (crc8_smbus_update(0, escInfoBuffer, frameLength - 1) == escInfoBuffer[frameLength - 1]) {
                     uint8_t firmwareVersion = 0;
                     uint8_t firmwareSubVersion = 0;
                     uint8_t escType = 0;
@@ -4036,15 +4047,8 @@ static uint8_t getWordLength(char *bufBegin, char *bufEnd)
 
 uint16_t cliGetSettingIndex(char *name, uint8_t length)
 {
-    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
-        const char *settingName = valueTable[i].name;
-
-        // ensure exact match when setting to prevent setting variables with shorter names
-        if (strncasecmp(name, settingName, strlen(settingName)) == 0 && length == strlen(settingName)) {
-            return i;
-        }
-    }
-    return valueTableEntryCount;
+    // exact match only, to prevent setting variables with shorter names
+    return valueTableFind(name, length);
 }
 
 STATIC_UNIT_TESTED void cliSet(const char *cmdName, char *cmdline)
@@ -4436,6 +4440,49 @@ static void cliTasks(const char *cmdName, char *cmdline)
 }
 #endif
 
+#if defined(USE_SCHEDULER_TRACE)
+static void cliSchedTrace(const char *cmdName, char *cmdline)
+{
+    if (strncasecmp(cmdline, "start", 5) == 0) {
+        const char *ptr = nextArg(cmdline);
+        const int lateGyroUs = ptr ? atoi(ptr) : 0;
+        if (lateGyroUs < 0) {
+            cliShowArgumentRangeError(cmdName, "LATE_US", 0, INT16_MAX);
+            return;
+        }
+        schedulerTraceStart(lateGyroUs);
+        if (lateGyroUs) {
+            cliPrintLinef("Trace started, stops after a gyro cycle %dus late", lateGyroUs);
+        } else {
+            cliPrintLine("Trace started");
+        }
+    } else if (strncasecmp(cmdline, "stop", 4) == 0) {
+        schedulerTraceStop();
+        cliPrintLine("Trace stopped");
+    } else if (isEmpty(cmdline) || strncasecmp(cmdline, "dump", 4) == 0) {
+        // Read by src/utils/sched_trace_to_json.py
+        const int count = schedulerTraceCount();
+        cliPrintLinef("# sched_trace %d events, %s", count, schedulerTraceIsRunning() ? "running" : "stopped");
+        for (taskId_e taskId = 0; taskId < TASK_COUNT; taskId++) {
+            taskInfo_t taskInfo;
+            getTaskInfo(taskId, &taskInfo);
+#if defined(USE_TASK_STATISTICS)
+            cliPrintLinef("task %d %s %d", taskId, taskInfo.taskName, (int)taskInfo.desiredPeriodUs);
+#else
+            cliPrintLinef("task %d TASK%d %d", taskId, taskId, (int)taskInfo.desiredPeriodUs);
+#endif
+        }
+        for (int i = 0; i < count; i++) {
+            schedulerTraceEvent_t event;
+            schedulerTraceGetEvent(i, &event);
+            cliPrintLinef("ev %u %u %u %u", (unsigned)event.startUs, event.durationUs, event.taskId, event.flags);
+        }
+    } else {
+        cliPrintErrorLinef(cmdName, "Invalid option");
+    }
+}
+#endif
+
 static void printVersion(const char *cmdName, bool printBoardInfo)
 {
 #if !(defined(USE_CUSTOM_DEFAULTS) && defined(USE_UNIFIED_TARGET))
@@ -6027,6 +6074,9 @@ const clicmd_t cmdTable[] = {
     CLI_COMMAND_DEF("rxfail", "show/set rx failsafe settings", NULL, cliRxFailsafe),
     CLI_COMMAND_DEF("rxrange", "configure rx channel ranges", NULL, cliRxRange),
     CLI_COMMAND_DEF("save", "save and reboot", NULL, cliSave),
+#if defined(USE_SCHEDULER_TRACE)
+    CLI_COMMAND_DEF("sched_trace", "scheduler execution trace", "start [<late gyro us>] | stop | [dump]", cliSchedTrace),
+#endif
 #ifdef USE_SDCARD
     CLI_COMMAND_DEF("sd_info", "sdcard info", NULL, cliSdInfo),
 #endif
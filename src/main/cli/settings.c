@@ -481,6 +481,12 @@ static const char * const lookupTableGovernorMode[] = {
     "STANDARD", "MODEL1", "MODEL2", "MODEL3"
 };
 
+#ifdef USE_DYN_NOTCH_SDFT
+static const char * const lookupTableDynNotchAnalyser[] = {
+    "FFT", "SDFT"
+};
+#endif
+
 #define LOOKUP_TABLE_ENTRY(name) { name, ARRAYLEN(name) }
 
 const lookupTableEntry_t lookupTables[] = {
@@ -588,6 +594,9 @@ const lookupTableEntry_t lookupTables[] = {
     LOOKUP_TABLE_ENTRY(lookupTableEscSensorProtocol),
 #endif
     LOOKUP_TABLE_ENTRY(lookupTableGovernorMode),
+#ifdef USE_DYN_NOTCH_SDFT
+    LOOKUP_TABLE_ENTRY(lookupTableDynNotchAnalyser),
+#endif
 };
 
 #undef LOOKUP_TABLE_ENTRY
@@ -626,6 +635,9 @@ const clivalue_t valueTable[] = {
     { "dyn_notch_min_hz",           VAR_UINT16  | MASTER_VALUE, .config.minmaxUnsigned = { 60, 250 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_notch_min_hz) },
     { "dyn_notch_max_hz",           VAR_UINT16  | MASTER_VALUE, .config.minmaxUnsigned = { 200, 1000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_notch_max_hz) },
 #endif
+#ifdef USE_DYN_NOTCH_SDFT
+    { "dyn_notch_analyser",         VAR_UINT8   | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DYN_NOTCH_ANALYSER }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_notch_analyser) },
+#endif
 #ifdef USE_DYN_LPF
     { "dyn_lpf_gyro_min_hz",        VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 1000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_lpf_gyro_min_hz) },
     { "dyn_lpf_gyro_max_hz",        VAR_UINT16 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 1000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, dyn_lpf_gyro_max_hz) },
@@ -744,6 +756,9 @@ const clivalue_t valueTable[] = {
     { "blackbox_device",            VAR_UINT8  | HARDWARE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_DEVICE }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, device) },
     { "blackbox_record_acc",        VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, record_acc) },
     { "blackbox_mode",              VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_MODE }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, mode) },
+#ifdef USE_BLACKBOX_COMPRESSION
+    { "blackbox_compression",       VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_BLACKBOX_CONFIG, offsetof(blackboxConfig_t, compression) },
+#endif
 #endif
 
 // PG_MOTOR_CONFIG
@@ -892,6 +907,8 @@ const clivalue_t valueTable[] = {
     { "gps_auto_baud",              VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GPS_CONFIG, offsetof(gpsConfig_t, autoBaud) },
     { "gps_ublox_use_galileo",      VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GPS_CONFIG, offsetof(gpsConfig_t, gps_ublox_use_galileo) },
     { "gps_ublox_mode",             VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_UBLOX_MODE }, PG_GPS_CONFIG, offsetof(gpsConfig_t, gps_ublox_mode) },
+    { "gps_ublox_nav_pvt",          VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GPS_CONFIG, offsetof(gpsConfig_t, gps_ublox_nav_pvt) },
+    { "gps_ublox_rate_hz",          VAR_UINT8  | MASTER_VALUE, .config.minmaxUnsigned = { GPS_UBLOX_RATE_MIN, GPS_UBLOX_RATE_MAX }, PG_GPS_CONFIG, offsetof(gpsConfig_t, gps_ublox_rate_hz) },
     { "gps_set_home_point_once",    VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GPS_CONFIG, offsetof(gpsConfig_t, gps_set_home_point_once) },
     { "gps_use_3d_speed",           VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GPS_CONFIG, offsetof(gpsConfig_t, gps_use_3d_speed) },
 
@@ -1052,6 +1069,11 @@ const clivalue_t valueTable[] = {
 #if defined(USE_TELEMETRY_IBUS)
     { "ibus_sensor",                VAR_UINT8  | MASTER_VALUE | MODE_ARRAY, .config.array.length = IBUS_SENSOR_COUNT, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, flysky_sensors)},
 #endif
+#if defined(USE_TELEMETRY_CRSF)
+    { "crsf_tlm_sensor_weight",     VAR_UINT8  | MASTER_VALUE, .config.minmaxUnsigned = { 0, 100 }, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, crsf_sensor_weight) },
+    { "crsf_tlm_msp_weight",        VAR_UINT8  | MASTER_VALUE, .config.minmaxUnsigned = { 0, 100 }, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, crsf_msp_weight) },
+    { "crsf_tlm_displayport_weight", VAR_UINT8 | MASTER_VALUE, .config.minmaxUnsigned = { 0, 100 }, PG_TELEMETRY_CONFIG, offsetof(telemetryConfig_t, crsf_displayport_weight) },
+#endif
 #ifdef USE_TELEMETRY_MAVLINK
     // Support for misusing the heading field in MAVlink to indicate mAh drawn for Connex Prosight OSD
     // Set to 10 to show a tenth of your capacity drawn.
@@ -1452,6 +1474,7 @@ const clivalue_t valueTable[] = {
     { "gyro_rpm_filter_bank_notch_q",     VAR_UINT16 | MASTER_VALUE | MODE_ARRAY, .config.array.length = RPM_FILTER_BANK_COUNT, PG_RPM_FILTER_CONFIG, offsetof(rpmFilterConfig_t, filter_bank_notch_q) },
     { "gyro_rpm_filter_bank_min_hz",      VAR_UINT16 | MASTER_VALUE | MODE_ARRAY, .config.array.length = RPM_FILTER_BANK_COUNT, PG_RPM_FILTER_CONFIG, offsetof(rpmFilterConfig_t, filter_bank_min_hz) },
     { "gyro_rpm_filter_bank_max_hz",      VAR_UINT16 | MASTER_VALUE | MODE_ARRAY, .config.array.length = RPM_FILTER_BANK_COUNT, PG_RPM_FILTER_CONFIG, offsetof(rpmFilterConfig_t, filter_bank_max_hz) },
+    { "gyro_rpm_filter_fast_update",      VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_RPM_FILTER_CONFIG, offsetof(rpmFilterConfig_t, filter_fast_update) },
 #endif
 
 #ifdef USE_RX_FLYSKY
@@ -1485,6 +1508,9 @@ const clivalue_t valueTable[] = {
 
 const uint16_t valueTableEntryCount = ARRAYLEN(valueTable);
 
+// valueTable entries sorted by name, see settings_index.c
+uint16_t valueTableIndex[ARRAYLEN(valueTable)];
+
 void settingsBuildCheck() {
     STATIC_ASSERT(LOOKUP_TABLE_COUNT == ARRAYLEN(lookupTables), LOOKUP_TABLE_COUNT_incorrect);
 }
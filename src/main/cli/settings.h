@@ -127,6 +127,9 @@ typedef enum {
     TABLE_ESC_SENSOR_PROTOCOL,
 #endif
     TABLE_GOVERNOR_MODE,
+#ifdef USE_DYN_NOTCH_SDFT
+    TABLE_DYN_NOTCH_ANALYSER,
+#endif
 
     LOOKUP_TABLE_COUNT
 } lookupTableIndex_e;
@@ -219,6 +222,7 @@ extern const lookupTableEntry_t lookupTables[];
 extern const uint16_t valueTableEntryCount;
 
 extern const clivalue_t valueTable[];
+extern uint16_t valueTableIndex[];
 //extern const uint8_t lookupTablesEntryCount;
 
 extern const char * const lookupTableGyroHardware[];
@@ -245,3 +249,6 @@ extern const char * const lookupTableItermRelaxType[];
 extern const char * const lookupTableOsdDisplayPortDevice[];
 
 extern const char * const lookupTableInterpolatedSetpoint[];
+
+void valueTableIndexInit(void);
+uint16_t valueTableFind(const char *name, uint8_t length);
@@ -0,0 +1,109 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+
+#include "platform.h"
+
+#ifdef USE_CLI
+
+#include "common/utils.h"
+
+#include "cli/settings.h"
+
+/*
+ * valueTable is ordered by parameter group for dump and diff, and the
+ * entries present depend on the target. The name index is sorted once,
+ * on the first lookup, and the lookups are binary searches.
+ */
+
+static bool valueTableIndexReady;
+
+// Shell sort, Ciura gaps
+static const uint16_t indexSortGaps[] = { 701, 301, 132, 57, 23, 10, 4, 1 };
+
+void valueTableIndexInit(void)
+{
+    for (unsigned i = 0; i < valueTableEntryCount; i++) {
+        valueTableIndex[i] = i;
+    }
+
+    for (unsigned g = 0; g < ARRAYLEN(indexSortGaps); g++) {
+        const unsigned gap = indexSortGaps[g];
+
+        for (unsigned i = gap; i < valueTableEntryCount; i++) {
+            const uint16_t entry = valueTableIndex[i];
+            const char *name = valueTable[entry].name;
+            unsigned j = i;
+
+            while (j >= gap && strcasecmp(valueTable[valueTableIndex[j - gap]].name, name) > 0) {
+                valueTableIndex[j] = valueTableIndex[j - gap];
+                j -= gap;
+            }
+            valueTableIndex[j] = entry;
+        }
+    }
+
+    valueTableIndexReady = true;
+}
+
+// name is not terminated, only length characters are compared
+static int compareSettingName(const char *name, uint8_t length, const char *settingName)
+{
+    const int result = strncasecmp(name, settingName, length);
+
+    if (result == 0 && settingName[length] != '\0') {
+        return -1;
+    }
+
+    return result;
+}
+
+/*
+ * Index of the valueTable entry of exactly that name, any case,
+ * or valueTableEntryCount if there is none.
+ */
+uint16_t valueTableFind(const char *name, uint8_t length)
+{
+    if (!valueTableIndexReady) {
+        valueTableIndexInit();
+    }
+
+    unsigned low = 0;
+    unsigned high = valueTableEntryCount;
+
+    while (low < high) {
+        const unsigned mid = (low + high) / 2;
+        const uint16_t entry = valueTableIndex[mid];
+        const int result = compareSettingName(name, length, valueTable[entry].name);
+
+        if (result == 0) {
+            return entry;
+        } else if (result < 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+
+    return valueTableEntryCount;
+}
+
+#endif
@@ -92,6 +92,37 @@ FAST_CODE float slewFilterApply(slewFilter_t *filter, float input)
     return filter->state;
 }
 
+/*
+ * Alpha-beta filter. Samples may come at any interval and from several
+ * sources; each one is weighed by the time since the previous sample of
+ * its source, so that the tracking bandwidth stays the same.
+ */
+void alphaBetaFilterInit(alphaBetaFilter_t *filter, float bandwidth, float value)
+{
+    filter->value = value;
+    filter->rate = 0;
+    filter->omega = 2 * M_PIf * bandwidth;
+}
+
+// sample taken dT seconds after the last update, interval seconds after the previous sample of its source
+FAST_CODE void alphaBetaFilterUpdate(alphaBetaFilter_t *filter, float sample, float dT, float interval)
+{
+    const float residual = sample - (filter->value + filter->rate * dT);
+
+    // Benedict-Bordner gains, low overshoot on steps
+    const float k = filter->omega * interval;
+    const float alpha = k / (1 + k);
+    const float beta = alpha * alpha / (2 - alpha);
+
+    filter->value += filter->rate * dT + alpha * residual;
+    filter->rate += beta * residual / interval;
+}
+
+FAST_CODE float alphaBetaFilterPredict(const alphaBetaFilter_t *filter, float dT)
+{
+    return filter->value + filter->rate * dT;
+}
+
 // get notch filter Q given center frequency (f0) and lower cutoff frequency (f1)
 // Q = f0 / (f2 - f1) ; f2 = f0^2 / f1
 float filterGetNotchQ(float centerFreq, float cutoffFreq) {
@@ -203,6 +234,80 @@ FAST_CODE float biquadFilterApply(biquadFilter_t *filter, float input)
     return result;
 }
 
+void biquadCascadeInit(biquadCascade_t *cascade)
+{
+    memset(cascade, 0, sizeof(*cascade));
+}
+
+static biquadCascadeStage_t *biquadCascadeNextStage(biquadCascade_t *cascade)
+{
+    if (cascade->stageCount >= BIQUAD_CASCADE_MAX_STAGES) {
+        return NULL;
+    }
+
+    biquadCascadeStage_t *stage = &cascade->stage[cascade->stageCount++];
+    stage->s1 = stage->s2 = 0;
+
+    return stage;
+}
+
+/* appends a biquad section, same coefficients as biquadFilterInit() */
+bool biquadCascadeAdd(biquadCascade_t *cascade, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+{
+    biquadCascadeStage_t *stage = biquadCascadeNextStage(cascade);
+    if (!stage) {
+        return false;
+    }
+
+    biquadFilter_t filter;
+    biquadFilterInit(&filter, filterFreq, refreshRate, Q, filterType);
+
+    stage->b0 = filter.b0;
+    stage->b1 = filter.b1;
+    stage->b2 = filter.b2;
+    stage->a1 = filter.a1;
+    stage->a2 = filter.a2;
+
+    return true;
+}
+
+bool biquadCascadeAddLPF(biquadCascade_t *cascade, float filterFreq, uint32_t refreshRate)
+{
+    return biquadCascadeAdd(cascade, filterFreq, refreshRate, BIQUAD_Q, FILTER_LPF);
+}
+
+/* appends a PT1 as a first order section, y = k * x + (1 - k) * y1 */
+bool biquadCascadeAddPT1(biquadCascade_t *cascade, float k)
+{
+    biquadCascadeStage_t *stage = biquadCascadeNextStage(cascade);
+    if (!stage) {
+        return false;
+    }
+
+    stage->b0 = k;
+    stage->b1 = 0;
+    stage->b2 = 0;
+    stage->a1 = k - 1;
+    stage->a2 = 0;
+
+    return true;
+}
+
+/* runs a sample through all stages, disabled filters are never added so cost nothing */
+FAST_CODE float biquadCascadeApply(biquadCascade_t *cascade, float input)
+{
+    biquadCascadeStage_t *stage = cascade->stage;
+
+    for (int n = cascade->stageCount; n > 0; n--, stage++) {
+        const float result = stage->b0 * input + stage->s1;
+        stage->s1 = stage->b1 * input - stage->a1 * result + stage->s2;
+        stage->s2 = stage->b2 * input - stage->a2 * result;
+        input = result;
+    }
+
+    return input;
+}
+
 void laggedMovingAverageInit(laggedMovingAverage_t *filter, uint16_t windowSize, float *buf)
 {
     filter->movingWindowIndex = 0;
@@ -41,6 +41,26 @@ typedef struct biquadFilter_s {
     float x1, x2, y1, y2;
 } biquadFilter_t;
 
+/* second order sections run back to back in transposed direct form 2 */
+#define BIQUAD_CASCADE_MAX_STAGES 4
+
+typedef struct biquadCascadeStage_s {
+    float b0, b1, b2, a1, a2;
+    float s1, s2;
+} biquadCascadeStage_t;
+
+typedef struct biquadCascade_s {
+    uint8_t stageCount;
+    biquadCascadeStage_t stage[BIQUAD_CASCADE_MAX_STAGES];
+} biquadCascade_t;
+
+/* value and rate tracker for irregular samples, predicts between them */
+typedef struct alphaBetaFilter_s {
+    float value;
+    float rate;     // per second
+    float omega;
+} alphaBetaFilter_t;
+
 typedef struct laggedMovingAverage_s {
     uint16_t movingWindowIndex;
     uint16_t windowSize;
@@ -73,6 +93,12 @@ float biquadFilterApplyDF1(biquadFilter_t *filter, float input);
 float biquadFilterApply(biquadFilter_t *filter, float input);
 float filterGetNotchQ(float centerFreq, float cutoffFreq);
 
+void biquadCascadeInit(biquadCascade_t *cascade);
+bool biquadCascadeAdd(biquadCascade_t *cascade, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+bool biquadCascadeAddLPF(biquadCascade_t *cascade, float filterFreq, uint32_t refreshRate);
+bool biquadCascadeAddPT1(biquadCascade_t *cascade, float k);
+float biquadCascadeApply(biquadCascade_t *cascade, float input);
+
 void laggedMovingAverageInit(laggedMovingAverage_t *filter, uint16_t windowSize, float *buf);
 float laggedMovingAverageUpdate(laggedMovingAverage_t *filter, float input);
 
@@ -83,3 +109,7 @@ float pt1FilterApply(pt1Filter_t *filter, float input);
 
 void slewFilterInit(slewFilter_t *filter, float slewLimit, float threshold);
 float slewFilterApply(slewFilter_t *filter, float input);
+
+void alphaBetaFilterInit(alphaBetaFilter_t *filter, float bandwidth, float value);
+void alphaBetaFilterUpdate(alphaBetaFilter_t *filter, float sample, float dT, float interval);
+float alphaBetaFilterPredict(const alphaBetaFilter_t *filter, float dT);
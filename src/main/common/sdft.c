@@ -0,0 +1,116 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "sdft.h"
+
+// Damping, so that the twiddle rotation is strictly stable
+#define SDFT_R  0.9999f
+
+static FAST_RAM_ZERO_INIT float rPowerN;
+static FAST_RAM_ZERO_INIT float twiddleRe[SDFT_BIN_COUNT + 1];
+static FAST_RAM_ZERO_INIT float twiddleIm[SDFT_BIN_COUNT + 1];
+
+void sdftInit(sdft_t *sdft, int startBin, int endBin, int numBatches)
+{
+    if (rPowerN == 0) {
+        rPowerN = powf(SDFT_R, SDFT_SAMPLE_SIZE);
+
+        // Twiddle errors add up over the window, so not the _approx functions
+        for (int i = 0; i <= SDFT_BIN_COUNT; i++) {
+            const float phi = 2 * M_PIf * i / SDFT_SAMPLE_SIZE;
+            twiddleRe[i] = SDFT_R * cosf(phi);
+            twiddleIm[i] = SDFT_R * sinf(phi);
+        }
+    }
+
+    memset(sdft, 0, sizeof(*sdft));
+
+    // The window needs one bin either side
+    sdft->startBin = constrain(startBin, 1, SDFT_BIN_COUNT - 1);
+    sdft->endBin = constrain(endBin, sdft->startBin, SDFT_BIN_COUNT - 1);
+
+    const int binCount = sdft->endBin - sdft->startBin + 3;
+
+    sdft->numBatches = constrain(numBatches, 1, binCount);
+    sdft->batchSize = (binCount + sdft->numBatches - 1) / sdft->numBatches;
+}
+
+static FAST_CODE void sdftUpdateBins(sdft_t *sdft, float delta, int startBin, int endBin)
+{
+    for (int i = startBin; i <= endBin; i++) {
+        const float re = sdft->re[i] + delta;
+        const float im = sdft->im[i];
+
+        sdft->re[i] = re * twiddleRe[i] - im * twiddleIm[i];
+        sdft->im[i] = re * twiddleIm[i] + im * twiddleRe[i];
+    }
+}
+
+/*
+ * Add a sample and update all bins
+ */
+FAST_CODE void sdftPush(sdft_t *sdft, float sample)
+{
+    const float delta = sample - rPowerN * sdft->samples[sdft->idx];
+
+    sdft->samples[sdft->idx] = sample;
+    sdft->idx = (sdft->idx + 1) % SDFT_SAMPLE_SIZE;
+
+    sdftUpdateBins(sdft, delta, sdft->startBin - 1, sdft->endBin + 1);
+}
+
+/*
+ * Add a sample over numBatches calls, batchIdx running from 0 to
+ * numBatches - 1 with the same sample. The sample is only taken into the
+ * ring by the last batch.
+ */
+FAST_CODE void sdftPushBatch(sdft_t *sdft, float sample, int batchIdx)
+{
+    const float delta = sample - rPowerN * sdft->samples[sdft->idx];
+
+    const int batchStart = sdft->startBin - 1 + sdft->batchSize * batchIdx;
+    const int batchEnd = MIN(batchStart + sdft->batchSize - 1, sdft->endBin + 1);
+
+    sdftUpdateBins(sdft, delta, batchStart, batchEnd);
+
+    if (batchIdx == sdft->numBatches - 1) {
+        sdft->samples[sdft->idx] = sample;
+        sdft->idx = (sdft->idx + 1) % SDFT_SAMPLE_SIZE;
+    }
+}
+
+/*
+ * Hann windowed power of bins startBin..endBin into output[startBin..endBin]
+ */
+FAST_CODE void sdftWinSq(const sdft_t *sdft, float *output)
+{
+    for (int i = sdft->startBin; i <= sdft->endBin; i++) {
+        const float re = 0.5f * sdft->re[i] - 0.25f * (sdft->re[i - 1] + sdft->re[i + 1]);
+        const float im = 0.5f * sdft->im[i] - 0.25f * (sdft->im[i - 1] + sdft->im[i + 1]);
+
+        output[i] = re * re + im * im;
+    }
+}
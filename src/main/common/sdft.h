@@ -0,0 +1,53 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Sliding DFT over the last SDFT_SAMPLE_SIZE samples.
+ *
+ * Every new sample updates each bin in [startBin - 1, endBin + 1] with one
+ * complex multiply, so the spectrum is always current and the cost per
+ * sample is fixed. The update can be split into batches spread over
+ * several calls. A damping factor just below one keeps rounding errors
+ * from accumulating.
+ *
+ * sdftWinSq() returns the Hann windowed power of bins startBin..endBin,
+ * the window being applied in the frequency domain from the neighbour bins.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#define SDFT_SAMPLE_SIZE    72
+#define SDFT_BIN_COUNT      (SDFT_SAMPLE_SIZE / 2)
+
+typedef struct sdft_s {
+    uint8_t idx;                            // oldest sample in the ring
+    uint8_t startBin;                       // first windowed bin
+    uint8_t endBin;                         // last windowed bin
+    uint8_t batchSize;                      // bins per batch
+    uint8_t numBatches;
+
+    float samples[SDFT_SAMPLE_SIZE];
+    float re[SDFT_BIN_COUNT + 1];
+    float im[SDFT_BIN_COUNT + 1];
+} sdft_t;
+
+void sdftInit(sdft_t *sdft, int startBin, int endBin, int numBatches);
+void sdftPush(sdft_t *sdft, float sample);
+void sdftPushBatch(sdft_t *sdft, float sample, int batchIdx);
+void sdftWinSq(const sdft_t *sdft, float *output);
@@ -27,6 +27,7 @@
 #include "build/build_config.h"
 
 #include "common/crc.h"
+#include "common/maths.h"
 #include "common/utils.h"
 
 #include "config/config_eeprom.h"
@@ -77,6 +78,38 @@ typedef struct {
 } PG_PACKED configFooter_t;
 // checksum is appended just after footer. It is not included in footer to make checksum calculation consistent
 
+#if defined(CONFIG_IN_FLASH) || defined(CONFIG_IN_FILE)
+/*
+ * Flash takes more words after the saved copy without an erase, so a save
+ * appends just the PGs that changed to a journal after it. The latest
+ * committed record for a PG wins on load. The whole store is rewritten, with
+ * a new generation, only when the journal is full.
+ */
+#define CONFIG_JOURNAL
+#endif
+
+#ifdef CONFIG_JOURNAL
+// Entry in the journal, starting on a streamer word. An entry without a
+// record commits the entries written before it in the same save.
+typedef struct {
+    uint16_t size;              // of header and record, without padding
+    uint16_t crc;               // of the generation and record
+    uint32_t generation;        // that of the saved copy, so older entries are not taken
+} PG_PACKED configJournalHeader_t;
+
+// Record in the saved copy holding the journal generation, under a PGN no PG uses
+#define CONFIG_JOURNAL_PGN 0
+
+typedef struct {
+    uint32_t generation;
+} PG_PACKED configJournalInfo_t;
+
+static uint32_t journalGeneration;
+static const uint8_t *journalStart;     // first entry
+static const uint8_t *journalEnd;       // after the last committed entry
+static bool journalAppendable;          // nothing but erased flash after journalEnd
+#endif
+
 // Used to check the compiler packing at build time.
 typedef struct {
     uint8_t byte;
@@ -251,6 +284,9 @@ void initEEPROM(void)
 
     STATIC_ASSERT(sizeof(configFooter_t) == 2, footer_size_failed);
     STATIC_ASSERT(sizeof(configRecord_t) == 6, record_size_failed);
+#ifdef CONFIG_JOURNAL
+    STATIC_ASSERT(sizeof(configJournalHeader_t) == 8, journal_header_size_failed);
+#endif
 
 #if defined(CONFIG_IN_FILE)
     loadEEPROMFromFile();
@@ -269,6 +305,120 @@ void initEEPROM(void)
 #endif
 }
 
+// find config record for pgn + classification (profile info) in the saved copy
+// return NULL when record is not found
+// this function assumes that EEPROM content is valid
+static const configRecord_t *findSavedRecord(pgn_t pgn, configRecordFlags_e classification)
+{
+    const uint8_t *p = &__config_start;
+    p += sizeof(configHeader_t);             // skip header
+    while (true) {
+        const configRecord_t *record = (const configRecord_t *)p;
+        if (record->size == 0
+            || p + record->size >= &__config_end
+            || record->size < sizeof(*record))
+            break;
+        if (pgn == record->pgn
+            && (record->flags & CR_CLASSIFICATION_MASK) == classification)
+            return record;
+        p += record->size;
+    }
+    // record not found
+    return NULL;
+}
+
+#ifdef CONFIG_JOURNAL
+// Entries are padded out to whole streamer words, as flash words are written only once
+static uint16_t journalEntrySize(uint16_t size)
+{
+    return (size + CONFIG_STREAMER_BUFFER_SIZE - 1) & ~(CONFIG_STREAMER_BUFFER_SIZE - 1);
+}
+
+static uint16_t journalEntryCrc(const configJournalHeader_t *header, const configRecord_t *record, const void *pg, uint16_t pgSize)
+{
+    uint16_t crc = CRC_START_VALUE;
+    crc = crc16_ccitt_update(crc, &header->generation, sizeof(header->generation));
+    if (record) {
+        crc = crc16_ccitt_update(crc, record, sizeof(*record));
+        crc = crc16_ccitt_update(crc, pg, pgSize);
+    }
+    return crc;
+}
+
+static bool isErased(const uint8_t *p, int size)
+{
+    for (int i = 0; i < size; i++) {
+        if (p[i] != 0xFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool isJournalEntryValid(const uint8_t *p)
+{
+    const configJournalHeader_t *entry = (const configJournalHeader_t *)p;
+    const configRecord_t *record = NULL;
+
+    if (entry->size < sizeof(*entry)
+        || p + entry->size > &__config_end
+        || entry->generation != journalGeneration) {
+        return false;
+    }
+
+    if (entry->size > sizeof(*entry)) {
+        record = (const configRecord_t *)(entry + 1);
+        if (entry->size < sizeof(*entry) + sizeof(*record)
+            || record->size != entry->size - sizeof(*entry)) {
+            return false;
+        }
+    }
+
+    return entry->crc == journalEntryCrc(entry, record, record ? record->pg : NULL, record ? record->size - sizeof(*record) : 0);
+}
+
+/*
+ * Find the committed entries after the saved copy. Entries written after the
+ * last commit, by a save that did not finish, are ignored. The journal can
+ * only be appended to if nothing but erased flash follows the last commit in
+ * its page. The streamer erases a page as it starts writing it, so whatever
+ * lies at a page boundary is left from earlier saves and is overwritten.
+ */
+static void scanJournal(const uint8_t *start)
+{
+    const configRecord_t *info = findSavedRecord(CONFIG_JOURNAL_PGN, CR_CLASSICATION_SYSTEM);
+    if (!info) {
+        // Saved without a journal, rewrite before appending
+        journalStart = journalEnd = start;
+        journalAppendable = false;
+        return;
+    }
+
+    journalGeneration = ((const configJournalInfo_t *)info->pg)->generation;
+    journalStart = start;
+    journalEnd = start;
+
+    const uint8_t *p = start;
+    while (p + sizeof(configJournalHeader_t) <= &__config_end
+        && !isErased(p, sizeof(configJournalHeader_t))
+        && isJournalEntryValid(p)) {
+        const uint16_t size = ((const configJournalHeader_t *)p)->size;
+
+        p += journalEntrySize(size);
+        if (size == sizeof(configJournalHeader_t)) {
+            journalEnd = p;
+        }
+    }
+
+    const uint32_t pageLeft = FLASH_PAGE_SIZE - (uintptr_t)p % FLASH_PAGE_SIZE;
+
+    journalAppendable = (p == journalEnd)
+        && (p + sizeof(configJournalHeader_t) > &__config_end
+            || pageLeft == FLASH_PAGE_SIZE
+            || isErased(p, MIN(sizeof(configJournalHeader_t), pageLeft)));
+}
+#endif
+
 bool isEEPROMVersionValid(void)
 {
     const uint8_t *p = &__config_start;
@@ -320,12 +470,21 @@ bool isEEPROMStructureValid(void)
     // include stored CRC in the CRC calculation
     const uint16_t *storedCrc = (const uint16_t *)p;
     crc = crc16_ccitt_update(crc, storedCrc, sizeof(*storedCrc));
-    p += sizeof(storedCrc);
+    p += sizeof(*storedCrc);
 
     eepromConfigSize = p - &__config_start;
 
     // CRC has the property that if the CRC itself is included in the calculation the resulting CRC will have constant value
-    return crc == CRC_CHECK_VALUE;
+    if (crc != CRC_CHECK_VALUE) {
+        return false;
+    }
+
+#ifdef CONFIG_JOURNAL
+    scanJournal(&__config_start + journalEntrySize(p - &__config_start));
+    eepromConfigSize = journalEnd - &__config_start;
+#endif
+
+    return true;
 }
 
 uint16_t getEEPROMConfigSize(void)
@@ -347,26 +506,26 @@ size_t getEEPROMStorageSize(void)
 #endif
 }
 
-// find config record for reg + classification (profile info) in EEPROM
+// find the latest config record for reg + classification, in the journal or the saved copy
 // return NULL when record is not found
-// this function assumes that EEPROM content is valid
 static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFlags_e classification)
 {
-    const uint8_t *p = &__config_start;
-    p += sizeof(configHeader_t);             // skip header
-    while (true) {
-        const configRecord_t *record = (const configRecord_t *)p;
-        if (record->size == 0
-            || p + record->size >= &__config_end
-            || record->size < sizeof(*record))
-            break;
-        if (pgN(reg) == record->pgn
-            && (record->flags & CR_CLASSIFICATION_MASK) == classification)
-            return record;
-        p += record->size;
+    const configRecord_t *found = findSavedRecord(pgN(reg), classification);
+
+#ifdef CONFIG_JOURNAL
+    for (const uint8_t *p = journalStart; p < journalEnd; p += journalEntrySize(((const configJournalHeader_t *)p)->size)) {
+        const configJournalHeader_t *entry = (const configJournalHeader_t *)p;
+        const configRecord_t *record = (const configRecord_t *)(entry + 1);
+
+        if (entry->size > sizeof(*entry)
+            && pgN(reg) == record->pgn
+            && (record->flags & CR_CLASSIFICATION_MASK) == classification) {
+            found = record;
+        }
     }
-    // record not found
-    return NULL;
+#endif
+
+    return found;
 }
 
 // Initialize all PG records from EEPROM.
@@ -393,6 +552,50 @@ bool loadEEPROM(void)
     return success;
 }
 
+#ifdef CONFIG_JOURNAL
+// Writes an entry for reg, or a commit if NULL
+static int writeJournalEntry(config_streamer_t *streamer, const pgRegistry_t *reg)
+{
+    configJournalHeader_t header = {
+        .size = sizeof(header),
+        .generation = journalGeneration,
+    };
+
+    if (reg) {
+        const uint16_t regSize = pgSize(reg);
+        const configRecord_t record = {
+            .size = sizeof(configRecord_t) + regSize,
+            .pgn = pgN(reg),
+            .version = pgVersion(reg),
+            .flags = CR_CLASSICATION_SYSTEM
+        };
+
+        header.size += record.size;
+        header.crc = journalEntryCrc(&header, &record, reg->address, regSize);
+
+        config_streamer_write(streamer, (uint8_t *)&header, sizeof(header));
+        config_streamer_write(streamer, (uint8_t *)&record, sizeof(record));
+        config_streamer_write(streamer, reg->address, regSize);
+    } else {
+        header.crc = journalEntryCrc(&header, NULL, NULL, 0);
+
+        config_streamer_write(streamer, (uint8_t *)&header, sizeof(header));
+    }
+
+    return config_streamer_flush(streamer);
+}
+
+static bool isPGChanged(const pgRegistry_t *reg)
+{
+    const configRecord_t *record = findEEPROM(reg, CR_CLASSICATION_SYSTEM);
+
+    return !record
+        || record->version != pgVersion(reg)
+        || record->size != sizeof(*record) + pgSize(reg)
+        || memcmp(record->pg, reg->address, pgSize(reg)) != 0;
+}
+#endif
+
 static bool writeSettingsToEEPROM(void)
 {
     config_streamer_t streamer;
@@ -408,6 +611,27 @@ static bool writeSettingsToEEPROM(void)
     config_streamer_write(&streamer, (uint8_t *)&header, sizeof(header));
     uint16_t crc = CRC_START_VALUE;
     crc = crc16_ccitt_update(crc, (uint8_t *)&header, sizeof(header));
+
+#ifdef CONFIG_JOURNAL
+    // Start a new journal, so entries left after this copy are not taken
+    journalGeneration++;
+
+    const configJournalInfo_t info = {
+        .generation = journalGeneration,
+    };
+    const configRecord_t infoRecord = {
+        .size = sizeof(configRecord_t) + sizeof(info),
+        .pgn = CONFIG_JOURNAL_PGN,
+        .version = 0,
+        .flags = CR_CLASSICATION_SYSTEM
+    };
+
+    config_streamer_write(&streamer, (uint8_t *)&infoRecord, sizeof(infoRecord));
+    crc = crc16_ccitt_update(crc, (uint8_t *)&infoRecord, sizeof(infoRecord));
+    config_streamer_write(&streamer, (uint8_t *)&info, sizeof(info));
+    crc = crc16_ccitt_update(crc, (uint8_t *)&info, sizeof(info));
+#endif
+
     PG_FOREACH(reg) {
         const uint16_t regSize = pgSize(reg);
         configRecord_t record = {
@@ -437,13 +661,82 @@ static bool writeSettingsToEEPROM(void)
 
     config_streamer_flush(&streamer);
 
+#ifdef CONFIG_JOURNAL
+    // An empty commit, so the page after the copy is erased should it start one
+    writeJournalEntry(&streamer, NULL);
+#endif
+
     const bool success = config_streamer_finish(&streamer) == 0;
 
     return success;
 }
 
+#ifdef CONFIG_JOURNAL
+// Returns the number of PGs differing from their latest stored copy, and the journal space they need
+static int findChangedPGs(uint32_t *appendSize)
+{
+    int count = 0;
+
+    // room for the commit
+    *appendSize = journalEntrySize(sizeof(configJournalHeader_t));
+
+    PG_FOREACH(reg) {
+        if (isPGChanged(reg)) {
+            *appendSize += journalEntrySize(sizeof(configJournalHeader_t) + sizeof(configRecord_t) + pgSize(reg));
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// Appends the changed PGs to the journal. Returns false if they do not fit or could not be written.
+static bool writeSettingsToJournal(void)
+{
+    uint32_t appendSize;
+
+    if (!journalAppendable) {
+        return false;
+    }
+
+    if (findChangedPGs(&appendSize) == 0) {
+        return true;
+    }
+
+    if (journalEnd + appendSize > &__config_end) {
+        return false;
+    }
+
+    config_streamer_t streamer;
+    config_streamer_init(&streamer);
+
+    config_streamer_start(&streamer, (uintptr_t)journalEnd, &__config_end - journalEnd);
+
+    PG_FOREACH(reg) {
+        if (isPGChanged(reg)) {
+            writeJournalEntry(&streamer, reg);
+        }
+    }
+
+    // Nothing above is taken until this is written
+    writeJournalEntry(&streamer, NULL);
+
+    return config_streamer_finish(&streamer) == 0;
+}
+#endif
+
 void writeConfigToEEPROM(void)
 {
+#ifdef CONFIG_JOURNAL
+    uint32_t appendSize;
+
+    // Append what changed while there is room, else rewrite the lot
+    if (isEEPROMVersionValid() && isEEPROMStructureValid() && writeSettingsToJournal()
+        && isEEPROMStructureValid() && findChangedPGs(&appendSize) == 0) {
+        return;
+    }
+#endif
+
     bool success = false;
     // write it
     for (int attempt = 0; attempt < 3 && !success; attempt++) {
@@ -25,6 +25,7 @@
 #include "common/axis.h"
 #include "common/maths.h"
 #include "common/sensor_alignment.h"
+#include "common/time.h"
 #include "drivers/exti.h"
 #include "drivers/bus.h"
 #include "drivers/sensor.h"
@@ -75,12 +76,23 @@ typedef enum {
     GYRO_RATE_32_kHz,
 } gyroRateKHz_e;
 
+// Samples drained from a hardware FIFO in one read
+#define GYRO_FIFO_SIZE 8
+
+typedef struct gyroFifo_s {
+    timeUs_t timeUs[GYRO_FIFO_SIZE];                         // estimated sampling time, oldest first
+    timeUs_t newestUs;                                       // estimated time of the newest sample read so far
+    int16_t sample[GYRO_FIFO_SIZE][XYZ_AXIS_COUNT];          // raw data from sensor
+    uint8_t count;
+} gyroFifo_t;
+
 typedef struct gyroDev_s {
 #if defined(SIMULATOR_BUILD) && defined(SIMULATOR_MULTITHREAD)
     pthread_mutex_t lock;
 #endif
     sensorGyroInitFuncPtr initFn;                             // initialize function
     sensorGyroReadFuncPtr readFn;                             // read 3 axis data function
+    sensorGyroReadFuncPtr readFifoFn;                         // drain the FIFO into fifo, if the sensor runs one
     sensorGyroReadDataFuncPtr temperatureFn;                  // read temperature if available
     extiCallbackRec_t exti;
     busDevice_t bus;
@@ -104,6 +116,7 @@ typedef struct gyroDev_s {
     fp_rotationMatrix_t rotationMatrix;
     uint16_t gyroSampleRateHz;
     uint16_t accSampleRateHz;
+    gyroFifo_t fifo;
 } gyroDev_t;
 
 typedef struct accDev_s {
@@ -125,6 +138,36 @@ typedef struct accDev_s {
     fp_rotationMatrix_t rotationMatrix;
 } accDev_t;
 
+static inline timeDelta_t gyroSamplePeriodUs(const gyroDev_t *gyro)
+{
+    return gyro->gyroSampleRateHz ? 1000000 / gyro->gyroSampleRateHz : 0;
+}
+
+/*
+ * Estimates the sampling times from the output data rate. The newest sample
+ * read was taken within a sample period before nowUs, less the pending
+ * samples the sensor FIFO still holds. The times carry on a period apart
+ * from the previous read while they fit that, so read jitter does not move
+ * them, and start again from nowUs when they don't, after samples were lost
+ * or the sensor clock drifted.
+ */
+static inline void gyroFifoStamp(gyroDev_t *gyro, timeUs_t nowUs, int pending)
+{
+    const timeDelta_t samplePeriodUs = gyroSamplePeriodUs(gyro);
+    const timeUs_t readUs = nowUs - pending * samplePeriodUs;
+    timeUs_t newestUs = gyro->fifo.newestUs + gyro->fifo.count * samplePeriodUs;
+    const timeDelta_t lagUs = cmpTimeUs(readUs, newestUs);
+
+    if (lagUs < 0 || lagUs > samplePeriodUs) {
+        newestUs = readUs;
+    }
+
+    for (int i = 0; i < gyro->fifo.count; i++) {
+        gyro->fifo.timeUs[i] = newestUs - (gyro->fifo.count - 1 - i) * samplePeriodUs;
+    }
+    gyro->fifo.newestUs = newestUs;
+}
+
 static inline void accDevLock(accDev_t *acc)
 {
 #if defined(SIMULATOR_BUILD) && defined(SIMULATOR_MULTITHREAD)
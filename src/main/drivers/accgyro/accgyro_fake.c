@@ -37,10 +37,18 @@
 
 #include "drivers/accgyro/accgyro.h"
 #include "drivers/accgyro/accgyro_fake.h"
+#include "drivers/time.h"
 
 static int16_t fakeGyroADC[XYZ_AXIS_COUNT];
 gyroDev_t *fakeGyroDev;
 
+// Scripted hardware FIFO, drained GYRO_FIFO_SIZE samples at a time
+#define FAKE_GYRO_FIFO_DEPTH 32
+
+static int16_t fakeGyroFifo[FAKE_GYRO_FIFO_DEPTH][XYZ_AXIS_COUNT];
+static uint8_t fakeGyroFifoHead;
+static uint8_t fakeGyroFifoCount;
+
 static void fakeGyroInit(gyroDev_t *gyro)
 {
     fakeGyroDev = gyro;
@@ -81,6 +89,58 @@ STATIC_UNIT_TESTED bool fakeGyroRead(gyroDev_t *gyro)
     return true;
 }
 
+void fakeGyroFifoPush(gyroDev_t *gyro, int16_t x, int16_t y, int16_t z)
+{
+    gyroDevLock(gyro);
+
+    if (fakeGyroFifoCount < FAKE_GYRO_FIFO_DEPTH) {
+        int16_t *sample = fakeGyroFifo[(fakeGyroFifoHead + fakeGyroFifoCount) % FAKE_GYRO_FIFO_DEPTH];
+        sample[X] = x;
+        sample[Y] = y;
+        sample[Z] = z;
+        fakeGyroFifoCount++;
+    }
+
+    gyro->dataReady = true;
+
+    gyroDevUnLock(gyro);
+}
+
+static bool fakeGyroReadFifo(gyroDev_t *gyro)
+{
+    gyroDevLock(gyro);
+    if (fakeGyroFifoCount == 0) {
+        gyroDevUnLock(gyro);
+        return false;
+    }
+
+    gyro->fifo.count = 0;
+    while (fakeGyroFifoCount && gyro->fifo.count < GYRO_FIFO_SIZE) {
+        const int16_t *sample = fakeGyroFifo[fakeGyroFifoHead];
+        gyro->fifo.sample[gyro->fifo.count][X] = sample[X];
+        gyro->fifo.sample[gyro->fifo.count][Y] = sample[Y];
+        gyro->fifo.sample[gyro->fifo.count][Z] = sample[Z];
+        gyro->fifo.count++;
+
+        fakeGyroFifoHead = (fakeGyroFifoHead + 1) % FAKE_GYRO_FIFO_DEPTH;
+        fakeGyroFifoCount--;
+    }
+    gyroFifoStamp(gyro, micros(), fakeGyroFifoCount);
+
+    gyro->gyroADCRaw[X] = gyro->fifo.sample[gyro->fifo.count - 1][X];
+    gyro->gyroADCRaw[Y] = gyro->fifo.sample[gyro->fifo.count - 1][Y];
+    gyro->gyroADCRaw[Z] = gyro->fifo.sample[gyro->fifo.count - 1][Z];
+
+    gyroDevUnLock(gyro);
+    return true;
+}
+
+// Samples then come from the scripted FIFO instead of fakeGyroSet()
+void fakeGyroUseFifo(gyroDev_t *gyro, bool enable)
+{
+    gyro->readFifoFn = enable ? fakeGyroReadFifo : NULL;
+}
+
 static bool fakeGyroReadTemperature(gyroDev_t *gyro, int16_t *temperatureData)
 {
     UNUSED(gyro);
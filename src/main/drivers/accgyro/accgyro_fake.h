@@ -29,3 +29,5 @@ struct gyroDev_s;
 extern struct gyroDev_s *fakeGyroDev;
 bool fakeGyroDetect(struct gyroDev_s *gyro);
 void fakeGyroSet(struct gyroDev_s *gyro, int16_t x, int16_t y, int16_t z);
+void fakeGyroUseFifo(struct gyroDev_s *gyro, bool enable);
+void fakeGyroFifoPush(struct gyroDev_s *gyro, int16_t x, int16_t y, int16_t z);
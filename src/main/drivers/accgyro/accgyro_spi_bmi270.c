@@ -326,6 +326,24 @@ static bool bmi270GyroReadRegister(gyroDev_t *gyro)
 }
 
 #ifdef USE_GYRO_DLPF_EXPERIMENTAL
+static void bmi270GyroAddFifoFrame(gyroDev_t *gyro, const uint8_t *frame)
+{
+    const int16_t gyroX = (int16_t)((frame[1] << 8) | frame[0]);
+    const int16_t gyroY = (int16_t)((frame[3] << 8) | frame[2]);
+    const int16_t gyroZ = (int16_t)((frame[5] << 8) | frame[4]);
+
+    // If the FIFO data is invalid then the returned values will be 0x8000 (-32768) (pg. 43 of datasheet).
+    // This shouldn't happen since we're only using the data if the FIFO length indicates
+    // that data is available, but this safeguard is needed to prevent bad things in
+    // case it does happen.
+    if ((gyroX != INT16_MIN) || (gyroY != INT16_MIN) || (gyroZ != INT16_MIN)) {
+        int16_t *sample = gyro->fifo.sample[gyro->fifo.count++];
+        sample[X] = gyroX;
+        sample[Y] = gyroY;
+        sample[Z] = gyroZ;
+    }
+}
+
 static bool bmi270GyroReadFifo(gyroDev_t *gyro)
 {
     enum {
@@ -342,7 +360,13 @@ static bool bmi270GyroReadFifo(gyroDev_t *gyro)
         BUFFER_SIZE,
     };
 
-    bool dataRead = false;
+    enum {
+        IDX_DATA_REG = 0,
+        IDX_DATA_SKIP,
+        IDX_DATA_FRAMES,
+        DATA_BUFFER_SIZE = IDX_DATA_FRAMES + (GYRO_FIFO_SIZE - 1) * BMI270_FIFO_FRAME_SIZE,
+    };
+
     static const uint8_t bmi270_tx_buf[BUFFER_SIZE] = {BMI270_REG_FIFO_LENGTH_LSB | 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0};
     uint8_t bmi270_rx_buf[BUFFER_SIZE];
 
@@ -355,38 +379,56 @@ static bool bmi270GyroReadFifo(gyroDev_t *gyro)
 
     int fifoLength = (uint16_t)((bmi270_rx_buf[IDX_FIFO_LENGTH_H] << 8) | bmi270_rx_buf[IDX_FIFO_LENGTH_L]);
 
+    gyro->fifo.count = 0;
+
     if (fifoLength >= BMI270_FIFO_FRAME_SIZE) {
+        bmi270GyroAddFifoFrame(gyro, &bmi270_rx_buf[IDX_GYRO_XOUT_L]);
+        fifoLength -= BMI270_FIFO_FRAME_SIZE;
+    }
+
+    // Whole frames queued behind the first come out of the data register in one more burst.
+    // The gyro task normally finds one sample, more when it was held up or runs slower than
+    // the sensor.
+    const int frames = MIN(fifoLength / BMI270_FIFO_FRAME_SIZE, GYRO_FIFO_SIZE - 1);
+
+    if (frames > 0) {
+        static const uint8_t bmi270_data_tx_buf[DATA_BUFFER_SIZE] = {BMI270_REG_FIFO_DATA | 0x80};
+        uint8_t bmi270_data_rx_buf[DATA_BUFFER_SIZE];
+
+        IOLo(gyro->bus.busdev_u.spi.csnPin);
+        spiTransfer(gyro->bus.busdev_u.spi.instance, bmi270_data_tx_buf, bmi270_data_rx_buf, IDX_DATA_FRAMES + frames * BMI270_FIFO_FRAME_SIZE);
+        IOHi(gyro->bus.busdev_u.spi.csnPin);
 
-        const int16_t gyroX = (int16_t)((bmi270_rx_buf[IDX_GYRO_XOUT_H] << 8) | bmi270_rx_buf[IDX_GYRO_XOUT_L]);
-        const int16_t gyroY = (int16_t)((bmi270_rx_buf[IDX_GYRO_YOUT_H] << 8) | bmi270_rx_buf[IDX_GYRO_YOUT_L]);
-        const int16_t gyroZ = (int16_t)((bmi270_rx_buf[IDX_GYRO_ZOUT_H] << 8) | bmi270_rx_buf[IDX_GYRO_ZOUT_L]);
-
-        // If the FIFO data is invalid then the returned values will be 0x8000 (-32768) (pg. 43 of datasheet).
-        // This shouldn't happen since we're only using the data if the FIFO length indicates
-        // that data is available, but this safeguard is needed to prevent bad things in
-        // case it does happen.
-        if ((gyroX != INT16_MIN) || (gyroY != INT16_MIN) || (gyroZ != INT16_MIN)) {
-            gyro->gyroADCRaw[X] = gyroX;
-            gyro->gyroADCRaw[Y] = gyroY;
-            gyro->gyroADCRaw[Z] = gyroZ;
-            dataRead = true;
+        for (int i = 0; i < frames; i++) {
+            bmi270GyroAddFifoFrame(gyro, &bmi270_data_rx_buf[IDX_DATA_FRAMES + i * BMI270_FIFO_FRAME_SIZE]);
         }
-        fifoLength -= BMI270_FIFO_FRAME_SIZE;
+        fifoLength -= frames * BMI270_FIFO_FRAME_SIZE;
     }
 
-    // If there are additional samples in the FIFO then we don't use those for now and simply
-    // flush the FIFO. Under normal circumstances we only expect one sample in the FIFO since
-    // the gyro loop is running at the native sample rate of 6.4KHz.
-    // However the way the FIFO works in the sensor is that if a frame is partially read then
-    // it remains in the queue instead of bein removed. So if we ever got into a state where there
-    // was a partial frame or other unexpected data in the FIFO is may never get cleared and we
-    // would end up in a lock state of always re-reading the same partial or invalid sample.
+    // The way the FIFO works in the sensor is that if a frame is partially read then it remains
+    // in the queue instead of being removed. So if we ever got into a state where there was a
+    // partial frame, more than the buffer holds, or other unexpected data in the FIFO, it may
+    // never get cleared and we would end up in a lock state of always re-reading the same partial
+    // or invalid sample.
     if (fifoLength > 0) {
         // Partial or additional frames left - flush the FIFO
         bmi270RegisterWrite(&gyro->bus, BMI270_REG_CMD, BMI270_VAL_CMD_FIFOFLUSH, 0);
     }
 
-    return dataRead;
+    if (gyro->fifo.count == 0) {
+        return false;
+    }
+
+    // Frames flushed were taken after those read
+    gyroFifoStamp(gyro, micros(), fifoLength / BMI270_FIFO_FRAME_SIZE);
+
+    // The newest sample, for readers of gyroADCRaw
+    const int16_t *newest = gyro->fifo.sample[gyro->fifo.count - 1];
+    gyro->gyroADCRaw[X] = newest[X];
+    gyro->gyroADCRaw[Y] = newest[Y];
+    gyro->gyroADCRaw[Z] = newest[Z];
+
+    return true;
 }
 #endif
 
@@ -408,6 +450,13 @@ static void bmi270SpiGyroInit(gyroDev_t *gyro)
 {
     bmi270Config(gyro);
 
+#ifdef USE_GYRO_DLPF_EXPERIMENTAL
+    // Every queued sample is drained and used
+    if (gyro->hardware_lpf == GYRO_HARDWARE_LPF_EXPERIMENTAL) {
+        gyro->readFifoFn = bmi270GyroReadFifo;
+    }
+#endif
+
 #if defined(USE_GYRO_EXTI) && defined(USE_MPU_DATA_READY_SIGNAL)
     bmi270IntExtiInit(gyro);
 #endif
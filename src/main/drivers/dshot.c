@@ -40,6 +40,7 @@
 
 #include "drivers/dshot_dpwm.h" // for motorDmaOutput_t, should be gone
 #include "drivers/dshot_command.h"
+#include "drivers/dshot_gcr.h"
 #include "drivers/nvic.h"
 #include "drivers/pwm_output.h" // for PWM_TYPE_* and others
 
@@ -102,6 +103,11 @@ uint16_t getDshotTelemetry(uint8_t index)
     return dshotTelemetryState.motorState[index].telemetryValue;
 }
 
+timeUs_t getDshotTelemetryTimeUs(uint8_t index)
+{
+    return dshotTelemetryState.motorState[index].telemetryUs;
+}
+
 #endif
 
 #ifdef USE_DSHOT_TELEMETRY_STATS
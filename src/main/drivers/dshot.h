@@ -64,7 +64,8 @@ uint16_t prepareDshotPacket(dshotProtocolControl_t *pcb);
 extern bool useDshotTelemetry;
 
 typedef struct dshotTelemetryMotorState_s {
-    uint16_t telemetryValue;
+    uint16_t telemetryValue;    // eRPM/100
+    timeUs_t telemetryUs;       // when telemetryValue was received
     bool telemetryActive;
 } dshotTelemetryMotorState_t;
 
@@ -85,6 +86,7 @@ void updateDshotTelemetryQuality(dshotTelemetryQuality_t *qualityStats, bool pac
 #endif
 
 uint16_t getDshotTelemetry(uint8_t index);
+timeUs_t getDshotTelemetryTimeUs(uint8_t index);
 bool isDshotMotorTelemetryActive(uint8_t motorIndex);
 bool isDshotTelemetryActive(void);
 
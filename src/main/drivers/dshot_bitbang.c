@@ -36,11 +36,11 @@
 #include "drivers/dshot_bitbang.h"
 #include "drivers/dshot_bitbang_impl.h"
 #include "drivers/dshot_command.h"
+#include "drivers/dshot_gcr.h"
 #include "drivers/motor.h"
 #include "drivers/nvic.h"
 #include "drivers/pwm_output.h" // XXX for pwmOutputPort_t motors[]; should go away with refactoring
 #include "drivers/dshot_dpwm.h" // XXX for motorDmaOutput_t *getMotorDmaOutput(uint8_t index); should go away with refactoring
-#include "drivers/dshot_bitbang_decode.h"
 #include "drivers/time.h"
 #include "drivers/timer.h"
 
@@ -456,35 +456,42 @@ static bool bbUpdateStart(void)
             return false;
         }
 
+        uint16_t pinMask[MAX_SUPPORTED_MOTOR_PORTS] = { 0 };
+        uint16_t periods[MAX_SUPPORTED_MOTOR_PORTS][DSHOT_GCR_PORT_PINS];
+
         for (int motorIndex = 0; motorIndex < MAX_SUPPORTED_MOTORS && motorIndex < motorCount; motorIndex++) {
-#ifdef STM32F4
-            uint32_t value = decode_bb_bitband(
-                bbMotors[motorIndex].bbPort->portInputBuffer,
-                bbMotors[motorIndex].bbPort->portInputCount - bbDMA_Count(bbMotors[motorIndex].bbPort),
-                bbMotors[motorIndex].pinIndex);
-#else
-            uint32_t value = decode_bb(
-                bbMotors[motorIndex].bbPort->portInputBuffer,
-                bbMotors[motorIndex].bbPort->portInputCount - bbDMA_Count(bbMotors[motorIndex].bbPort),
-                bbMotors[motorIndex].pinIndex);
-#endif
-            if (value == BB_NOEDGE) {
+            pinMask[bbMotors[motorIndex].bbPort - bbPorts] |= 1 << bbMotors[motorIndex].pinIndex;
+        }
+
+        // All motors on a port in one pass over its samples
+        for (int i = 0; i < usedMotorPorts; i++) {
+            if (pinMask[i]) {
+                dshotGcrDecodePort(bbPorts[i].portInputBuffer, bbPorts[i].portInputCount - bbDMA_Count(&bbPorts[i]), pinMask[i], periods[i]);
+            }
+        }
+
+        for (int motorIndex = 0; motorIndex < MAX_SUPPORTED_MOTORS && motorIndex < motorCount; motorIndex++) {
+            const uint16_t value = periods[bbMotors[motorIndex].bbPort - bbPorts][bbMotors[motorIndex].pinIndex];
+
+            if (value == DSHOT_GCR_NOEDGE) {
                 continue;
             }
             dshotTelemetryState.readCount++;
 
-            if (value != BB_INVALID) {
-                dshotTelemetryState.motorState[motorIndex].telemetryValue = value;
+            if (value != DSHOT_GCR_INVALID) {
+                const uint16_t erpm = dshotGcrPeriodToErpm(value);
+                dshotTelemetryState.motorState[motorIndex].telemetryValue = erpm;
+                dshotTelemetryState.motorState[motorIndex].telemetryUs = currentUs;
                 dshotTelemetryState.motorState[motorIndex].telemetryActive = true;
                 if (motorIndex < 2) {
-                    DEBUG_SET(DEBUG_DSHOT_RPM_TELEMETRY, motorIndex, value);
+                    DEBUG_SET(DEBUG_DSHOT_RPM_TELEMETRY, motorIndex, erpm);
                     DEBUG_SET(DEBUG_DSHOT_RPM_TELEMETRY, motorIndex+2, dshotTelemetryState.invalidPacketCount);
                 }
             } else {
                 dshotTelemetryState.invalidPacketCount++;
             }
 #ifdef USE_DSHOT_TELEMETRY_STATS
-            updateDshotTelemetryQuality(&dshotTelemetryQuality[motorIndex], value != BB_INVALID, currentTimeMs);
+            updateDshotTelemetryQuality(&dshotTelemetryQuality[motorIndex], value != DSHOT_GCR_INVALID, currentTimeMs);
 #endif
         }
     }
@@ -0,0 +1,258 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+
+#include "platform.h"
+
+#ifdef USE_DSHOT_TELEMETRY
+
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "drivers/dshot.h"
+
+#include "dshot_gcr.h"
+
+// A telemetry frame is 21 bits, of which the last one is inferred
+#define GCR_FRAME_BITS          21
+
+#define MIN_VALID_BBSAMPLES     ((GCR_FRAME_BITS - 2) * DSHOT_GCR_BB_OVERSAMPLE)
+#define MAX_VALID_BBSAMPLES     ((GCR_FRAME_BITS + 2) * DSHOT_GCR_BB_OVERSAMPLE)
+
+#ifdef DEBUG_BBDECODE
+// Samples of the last invalid frame, for dshot_telemetry_info
+uint16_t bbBuffer[134];
+#endif
+
+#define iv 0xff
+
+// GCR quintet to nibble
+static const uint8_t gcrNibble[32] = {
+    iv, iv, iv, iv, iv, iv, iv, iv, iv, 9, 10, 11, iv, 13, 14, 15,
+    iv, iv, 2, 3, iv, 5, 6, 7, iv, 0, 8, 1, iv, 4, 12, iv };
+
+#undef iv
+
+// Bits in a level run of n samples, at 3x oversampling (n + 1) / 3 but at least one
+static const uint8_t bbRunBits[MAX_VALID_BBSAMPLES + 1] = {
+    1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4,
+    5, 5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9,
+    9, 10, 10, 10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14,
+    14, 14, 15, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 18,
+    19, 19, 19, 20, 20, 20, 21, 21, 21, 22, 22, 22, 23, 23,
+};
+
+typedef struct {
+    uint32_t value;
+    uint16_t lastEdge;
+    uint16_t end;
+    uint8_t bits;
+} gcrPinState_t;
+
+/*
+ * A level run of len bits is 1 followed by len - 1 zeros
+ */
+static inline uint32_t gcrAppendRun(uint32_t value, int len)
+{
+    return (value << len) | (1 << (len - 1));
+}
+
+/*
+ * 21 bit GCR frame, start bit included, to eRPM period
+ */
+FAST_CODE uint32_t dshotGcrDecodeValue(uint32_t gcr)
+{
+    gcr &= 0xfffff;
+
+    const uint32_t n0 = gcrNibble[gcr & 0x1f];
+    const uint32_t n1 = gcrNibble[(gcr >> 5) & 0x1f];
+    const uint32_t n2 = gcrNibble[(gcr >> 10) & 0x1f];
+    const uint32_t n3 = gcrNibble[(gcr >> 15) & 0x1f];
+
+    if ((n0 | n1 | n2 | n3) > 0xf) {
+        return DSHOT_GCR_INVALID;
+    }
+
+    // The nibbles xor to 0xf, the checksum being inverted
+    if ((n0 ^ n1 ^ n2 ^ n3) != 0xf) {
+        return DSHOT_GCR_INVALID;
+    }
+
+    // eeem mmmm mmmm
+    const uint32_t value = (n3 << 8) | (n2 << 4) | n1;
+
+    if (value == 0x0fff) {
+        return 0;
+    }
+
+    const uint32_t period = (value & 0x1ff) << (value >> 9);
+    if (!period) {
+        return DSHOT_GCR_INVALID;
+    }
+
+    return period;
+}
+
+/*
+ * Timer capture of the frame edges, 16 timer ticks per bit
+ */
+FAST_CODE uint32_t dshotGcrDecodeEdges(const uint32_t *edges, uint32_t count)
+{
+    uint32_t value = 0;
+    int bits = 0;
+
+    for (uint32_t i = 1; i < count && bits < GCR_FRAME_BITS; i++) {
+        const int len = (edges[i] - edges[i - 1] + 8) / 16;
+        if (len < 1) {
+            return DSHOT_GCR_INVALID;
+        }
+        value = gcrAppendRun(value, len);
+        bits += len;
+    }
+
+    // The last level has no closing edge
+    if (bits < GCR_FRAME_BITS) {
+        value = gcrAppendRun(value, GCR_FRAME_BITS - bits);
+        bits = GCR_FRAME_BITS;
+    }
+
+    if (bits != GCR_FRAME_BITS) {
+        return DSHOT_GCR_INVALID;
+    }
+
+    return dshotGcrDecodeValue(value);
+}
+
+#ifdef DEBUG_BBDECODE
+static void gcrDumpSamples(const uint16_t *samples, uint32_t count, int pin)
+{
+    for (unsigned i = 0; i < MIN(count, ARRAYLEN(bbBuffer)); i++) {
+        bbBuffer[i] = (samples[i] >> pin) & 1;
+    }
+}
+#endif
+
+/*
+ * Decodes the bitbang input of all pins in pinMask in one pass over the
+ * port samples. A frame starts at the first low sample of its pin and is
+ * at most MAX_VALID_BBSAMPLES long. Each edge appends its run, looked up
+ * in bbRunBits. periods[pin] is set for every pin in pinMask.
+ */
+FAST_CODE void dshotGcrDecodePort(const uint16_t *samples, uint32_t count, uint16_t pinMask, uint16_t *periods)
+{
+    gcrPinState_t pins[DSHOT_GCR_PORT_PINS];
+
+    // Frames have to start early enough to be complete
+    const uint32_t startLimit = (count > MIN_VALID_BBSAMPLES) ? count - MIN_VALID_BBSAMPLES : 0;
+
+    uint32_t waiting = pinMask;
+    uint32_t active = 0;
+    uint32_t previous = 0xffff;
+    uint32_t stop = startLimit;
+
+    for (uint32_t i = 0; i < stop; i++) {
+        const uint32_t sample = samples[i];
+
+        uint32_t edges = (sample ^ previous) & active;
+        while (edges) {
+            const int pin = ffs(edges) - 1;
+            gcrPinState_t *state = &pins[pin];
+
+            edges &= edges - 1;
+
+            if (i < state->end) {
+                const int len = bbRunBits[i - state->lastEdge];
+                state->value = gcrAppendRun(state->value, len);
+                state->bits += len;
+                state->lastEdge = i;
+            } else {
+                active &= ~(1 << pin);
+            }
+        }
+
+        if (waiting && i < startLimit) {
+            uint32_t started = ~sample & waiting;
+            waiting &= ~started;
+            active |= started;
+
+            while (started) {
+                const int pin = ffs(started) - 1;
+                gcrPinState_t *state = &pins[pin];
+
+                started &= started - 1;
+
+                state->value = 0;
+                state->bits = 0;
+                state->lastEdge = i;
+                state->end = i + MIN(count - (i + 1), (uint32_t)MAX_VALID_BBSAMPLES);
+                stop = MAX(stop, state->end);
+            }
+        }
+
+        previous = sample;
+    }
+
+    for (int pin = 0; pin < DSHOT_GCR_PORT_PINS; pin++) {
+        const uint32_t mask = 1 << pin;
+
+        if (!(pinMask & mask)) {
+            continue;
+        }
+
+        const gcrPinState_t *state = &pins[pin];
+
+        // No reply, ok if the ESC is busy
+        if ((waiting & mask) || state->bits < GCR_FRAME_BITS - 3) {
+            periods[pin] = DSHOT_GCR_NOEDGE;
+            continue;
+        }
+
+        // The last level is high and has no closing edge
+        const int len = GCR_FRAME_BITS - state->bits;
+        if (len < 0) {
+            periods[pin] = DSHOT_GCR_INVALID;
+        } else if (len > 0) {
+            periods[pin] = dshotGcrDecodeValue(gcrAppendRun(state->value, len));
+        } else {
+            periods[pin] = dshotGcrDecodeValue(state->value);
+        }
+
+#ifdef DEBUG_BBDECODE
+        if (periods[pin] == DSHOT_GCR_INVALID) {
+            gcrDumpSamples(samples, count, pin);
+        }
+#endif
+    }
+}
+
+/*
+ * eRPM / 100 from a period in microseconds
+ */
+uint16_t dshotGcrPeriodToErpm(uint16_t period)
+{
+    if (period == 0 || period >= DSHOT_GCR_NOEDGE) {
+        return 0;
+    }
+
+    return (1000000 * 60 / 100 + period / 2) / period;
+}
+
+#endif
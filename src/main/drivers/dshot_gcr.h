@@ -0,0 +1,41 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*
+ * Bidirectional DShot telemetry decoding.
+ *
+ * The decoders return the eRPM period in microseconds, 0 for a stopped
+ * motor, or one of the codes below. The period is converted to eRPM once
+ * per received frame, with dshotGcrPeriodToErpm().
+ */
+
+#define DSHOT_GCR_NOEDGE        0xfffe
+#define DSHOT_GCR_INVALID       0xffff
+
+// Pins in one GPIO port, the bits of a bitbang sample
+#define DSHOT_GCR_PORT_PINS     16
+
+// Oversampling of the bitbang input
+#define DSHOT_GCR_BB_OVERSAMPLE 3
+
+uint32_t dshotGcrDecodeValue(uint32_t gcr);
+uint32_t dshotGcrDecodeEdges(const uint32_t *edges, uint32_t count);
+void dshotGcrDecodePort(const uint16_t *samples, uint32_t count, uint16_t pinMask, uint16_t *periods);
+
+uint16_t dshotGcrPeriodToErpm(uint16_t period);
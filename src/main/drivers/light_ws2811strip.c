@@ -41,6 +41,7 @@
 
 #include "drivers/dma.h"
 #include "drivers/io.h"
+#include "drivers/time.h"
 
 #include "light_ws2811strip.h"
 
@@ -65,6 +66,11 @@ uint16_t BIT_COMPARE_0 = 0;
 
 static hsvColor_t ledColorBuffer[WS2811_DATA_BUFFER_SIZE];
 
+// As in the DMA buffer, so that only LEDs that changed are converted
+static hsvColor_t ledColorSent[WS2811_DATA_BUFFER_SIZE];
+static ledStripFormatRGB_e ledFormatSent;
+static timeUs_t lastTransferUs;
+
 #if !defined(USE_WS2811_SINGLE_COLOUR)
 void setLedHsv(uint16_t index, const hsvColor_t *color)
 {
@@ -171,18 +177,36 @@ void ws2811UpdateStrip(ledStripFormatRGB_e ledFormat)
         return;
     }
 
-    unsigned ledIndex = 0;              // reset led index
+    if (ledFormat != ledFormatSent) {
+        needsFullRefresh = true;
+    }
 
     // fill transmit buffer with correct compare values to achieve
     // correct pulse widths according to color values
     const unsigned ledUpdateCount = needsFullRefresh ? WS2811_DATA_BUFFER_SIZE : usedLedCount;
     const hsvColor_t hsvBlack = { 0, 0, 0 };
-    while (ledIndex < ledUpdateCount) {
-        rgbColor24bpp_t *rgb24 = hsvToRgb24(ledIndex < usedLedCount ? &ledColorBuffer[ledIndex] : &hsvBlack);
+    bool frameChanged = needsFullRefresh;
+    for (unsigned ledIndex = 0; ledIndex < ledUpdateCount; ledIndex++) {
+        const hsvColor_t *color = ledIndex < usedLedCount ? &ledColorBuffer[ledIndex] : &hsvBlack;
+        hsvColor_t *sent = &ledColorSent[ledIndex];
+
+        if (!needsFullRefresh && color->h == sent->h && color->s == sent->s && color->v == sent->v) {
+            continue;
+        }
 
-        updateLEDDMABuffer(ledFormat, rgb24, ledIndex++);
+        *sent = *color;
+        updateLEDDMABuffer(ledFormat, hsvToRgb24(color), ledIndex);
+        frameChanged = true;
     }
     needsFullRefresh = false;
+    ledFormatSent = ledFormat;
+
+    // The LEDs hold their colour, an unchanged frame is only sent now and then in case one was missed
+    const timeUs_t now = micros();
+    if (!frameChanged && cmpTimeUs(now, lastTransferUs) < WS2811_REFRESH_INTERVAL_US) {
+        return;
+    }
+    lastTransferUs = now;
 
     ws2811LedDataTransferInProgress = true;
     ws2811LedStripDMAEnable();
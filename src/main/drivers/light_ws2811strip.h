@@ -44,6 +44,9 @@
 #define WS2811_TIMER_MHZ           48
 #define WS2811_CARRIER_HZ          800000
 
+// An unchanged frame is sent again after this long
+#define WS2811_REFRESH_INTERVAL_US 1000000
+
 // Enumeration to match the string options defined in lookupLedStripFormatRGB in settings.c
 typedef enum {
     LED_GRB,
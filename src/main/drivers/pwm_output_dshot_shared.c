@@ -46,6 +46,7 @@
 #include "drivers/dshot.h"
 #include "drivers/dshot_dpwm.h"
 #include "drivers/dshot_command.h"
+#include "drivers/dshot_gcr.h"
 #include "drivers/motor.h"
 
 #include "pwm_output_dshot_shared.h"
@@ -136,62 +137,6 @@ FAST_CODE void pwmWriteDshotInt(uint8_t index, uint16_t value)
 
 void dshotEnableChannels(uint8_t motorCount);
 
-
-static uint32_t decodeTelemetryPacket(uint32_t buffer[], uint32_t count)
-{
-    uint32_t value = 0;
-    uint32_t oldValue = buffer[0];
-    int bits = 0;
-    int len;
-    for (uint32_t i = 1; i <= count; i++) {
-        if (i < count) {
-            int diff = buffer[i] - oldValue;
-            if (bits >= 21) {
-                break;
-            }
-            len = (diff + 8) / 16;
-        } else {
-            len = 21 - bits;
-        }
-
-        value <<= len;
-        value |= 1 << (len - 1);
-        oldValue = buffer[i];
-        bits += len;
-    }
-    if (bits != 21) {
-        return 0xffff;
-    }
-
-    static const uint32_t decode[32] = {
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 10, 11, 0, 13, 14, 15,
-        0, 0, 2, 3, 0, 5, 6, 7, 0, 0, 8, 1, 0, 4, 12, 0 };
-
-    uint32_t decodedValue = decode[value & 0x1f];
-    decodedValue |= decode[(value >> 5) & 0x1f] << 4;
-    decodedValue |= decode[(value >> 10) & 0x1f] << 8;
-    decodedValue |= decode[(value >> 15) & 0x1f] << 12;
-
-    uint32_t csum = decodedValue;
-    csum = csum ^ (csum >> 8); // xor bytes
-    csum = csum ^ (csum >> 4); // xor nibbles
-
-    if ((csum & 0xf) != 0xf) {
-        return 0xffff;
-    }
-    decodedValue >>= 4;
-
-    if (decodedValue == 0x0fff) {
-        return 0;
-    }
-    decodedValue = (decodedValue & 0x000001ff) << ((decodedValue & 0xfffffe00) >> 9);
-    if (!decodedValue) {
-        return 0xffff;
-    }
-    uint32_t ret = (1000000 * 60 / 100 + decodedValue / 2) / decodedValue;
-    return ret;
-}
-
 #endif
 
 #ifdef USE_DSHOT_TELEMETRY
@@ -222,20 +167,22 @@ FAST_CODE_NOINLINE bool pwmStartDshotMotorUpdate(void)
             TIM_DMACmd(dmaMotors[i].timerHardware->tim, dmaMotors[i].timerDmaSource, DISABLE);
 #endif
 
-            uint16_t value = 0xffff;
+            uint16_t value = DSHOT_GCR_INVALID;
 
             if (edges > MIN_GCR_EDGES) {
                 dshotTelemetryState.readCount++;
-                value = decodeTelemetryPacket(dmaMotors[i].dmaBuffer, edges);
+                value = dshotGcrDecodeEdges(dmaMotors[i].dmaBuffer, edges);
 
 #ifdef USE_DSHOT_TELEMETRY_STATS
                 bool validTelemetryPacket = false;
 #endif
-                if (value != 0xffff) {
-                    dshotTelemetryState.motorState[i].telemetryValue = value;
+                if (value != DSHOT_GCR_INVALID) {
+                    const uint16_t erpm = dshotGcrPeriodToErpm(value);
+                    dshotTelemetryState.motorState[i].telemetryValue = erpm;
+                    dshotTelemetryState.motorState[i].telemetryUs = currentUs;
                     dshotTelemetryState.motorState[i].telemetryActive = true;
                     if (i < 4) {
-                        DEBUG_SET(DEBUG_DSHOT_RPM_TELEMETRY, i, value);
+                        DEBUG_SET(DEBUG_DSHOT_RPM_TELEMETRY, i, erpm);
                     }
 #ifdef USE_DSHOT_TELEMETRY_STATS
                     validTelemetryPacket = true;
@@ -74,6 +74,26 @@ uint8_t serialRead(serialPort_t *instance)
     return instance->vTable->serialRead(instance);
 }
 
+// Reads up to count bytes of those waiting, returning how many were read
+int serialReadBuf(serialPort_t *instance, uint8_t *data, int count)
+{
+    const int waiting = serialRxBytesWaiting(instance);
+
+    if (count > waiting) {
+        count = waiting;
+    }
+
+    if (instance->vTable->readBuf) {
+        return instance->vTable->readBuf(instance, data, count);
+    }
+
+    for (int i = 0; i < count; i++) {
+        data[i] = serialRead(instance);
+    }
+
+    return count;
+}
+
 void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate)
 {
     instance->vTable->serialSetBaudRate(instance, baudRate);
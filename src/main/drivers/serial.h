@@ -126,6 +126,8 @@ struct serialPortVTable {
     // Optional functions used to buffer large writes.
     void (*beginWrite)(serialPort_t *instance);
     void (*endWrite)(serialPort_t *instance);
+    // Optional function used to read received data in blocks
+    int (*readBuf)(serialPort_t *instance, uint8_t *data, int count);
 };
 
 void serialWrite(serialPort_t *instance, uint8_t ch);
@@ -133,6 +135,7 @@ uint32_t serialRxBytesWaiting(const serialPort_t *instance);
 uint32_t serialTxBytesFree(const serialPort_t *instance);
 void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count);
 uint8_t serialRead(serialPort_t *instance);
+int serialReadBuf(serialPort_t *instance, uint8_t *data, int count);
 void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate);
 void serialSetMode(serialPort_t *instance, portMode_e mode);
 void serialSetCtrlLineStateCb(serialPort_t *instance, void (*cb)(void *context, uint16_t ctrlLineState), void *context);
@@ -271,4 +271,5 @@ static const struct serialPortVTable tcpVTable = {
         .writeBuf = NULL,
         .beginWrite = NULL,
         .endWrite = NULL,
+        .readBuf = NULL,
 };
@@ -249,6 +249,46 @@ static uint8_t uartRead(serialPort_t *instance)
     return ch;
 }
 
+// Copies in at most two runs, either side of the end of the buffer
+static int uartReadBuf(serialPort_t *instance, uint8_t *data, int count)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+    const uint32_t size = s->port.rxBufferSize;
+
+    for (int done = 0; done < count; ) {
+        uint32_t tail;
+
+#ifdef USE_DMA
+        if (s->rxDMAResource) {
+            tail = size - s->rxDMAPos;
+        } else
+#endif
+        {
+            tail = s->port.rxBufferTail;
+        }
+
+        const uint32_t run = MIN((uint32_t)(count - done), size - tail);
+
+        for (uint32_t i = 0; i < run; i++) {
+            data[done + i] = s->port.rxBuffer[tail + i];
+        }
+        done += run;
+
+#ifdef USE_DMA
+        if (s->rxDMAResource) {
+            s->rxDMAPos -= run;
+            if (s->rxDMAPos == 0)
+                s->rxDMAPos = size;
+        } else
+#endif
+        {
+            s->port.rxBufferTail = (tail + run >= size) ? 0 : tail + run;
+        }
+    }
+
+    return count;
+}
+
 static void uartWrite(serialPort_t *instance, uint8_t ch)
 {
     uartPort_t *s = (uartPort_t *)instance;
@@ -289,6 +329,7 @@ const struct serialPortVTable uartVTable[] = {
         .writeBuf = NULL,
         .beginWrite = NULL,
         .endWrite = NULL,
+        .readBuf = uartReadBuf,
     }
 };
 
@@ -212,7 +212,8 @@ static const struct serialPortVTable usbVTable[] = {
         .setBaudRateCb = usbVcpSetBaudRateCb,
         .writeBuf = usbVcpWriteBuf,
         .beginWrite = usbVcpBeginWrite,
-        .endWrite = usbVcpEndWrite
+        .endWrite = usbVcpEndWrite,
+        .readBuf = NULL
     }
 };
 
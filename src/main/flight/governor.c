@@ -28,6 +28,8 @@
 #include "config/feature.h"
 #include "config/config.h"
 
+#include "drivers/time.h"
+
 #include "fc/runtime_config.h"
 
 #include "pg/motor.h"
@@ -92,7 +94,7 @@ void governorUpdate(void)
     if (getMotorCount() > 0) {
 
         // Other code looks to governor for headspeed, update it on every loop.
-        govHeadSpeed = getMotorRPM(0) / govGearRatio;
+        govHeadSpeed = getMotorRPMAt(0, micros()) / govGearRatio;
 
         // Governer update in different modes
         switch (govMode) {
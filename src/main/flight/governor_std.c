@@ -61,7 +61,10 @@
 //#define DEBUG_GOV_PARTS
 //#define DEBUG_GOV_PIDSUM
 //#define DEBUG_GOV_THROTTLE
+//#define DEBUG_GOV_HEADSPEED
 
+// Headspeed is lost after this long without RPM telemetry
+#define GOV_HEADSPEED_MAX_AGE_US    100000
 
 static FAST_RAM_ZERO_INIT float govMaxHeadspeed;
 static FAST_RAM_ZERO_INIT float govRampRate;
@@ -81,6 +84,8 @@ static FAST_RAM_ZERO_INIT float govSetpointLimited;
 static FAST_RAM_ZERO_INIT float govBaseThrottle;
 
 static FAST_RAM_ZERO_INIT float headSpeed;
+static FAST_RAM_ZERO_INIT float headSpeedRate;
+static FAST_RAM_ZERO_INIT timeDelta_t headSpeedAge;
 
 static FAST_RAM_ZERO_INIT float govMainPrevious;
 static FAST_RAM_ZERO_INIT timeMs_t stateEntryTime;
@@ -107,8 +112,8 @@ static void changeGovStateTo(uint8_t futureState)
 
 static bool headSpeedValid(void)
 {
-    // Check for valid headspeed signal
-    if (headSpeed > 25) {
+    // Check for valid headspeed signal. Short telemetry gaps are bridged by the RPM estimator.
+    if (headSpeed > 25 && headSpeedAge < GOV_HEADSPEED_MAX_AGE_US) {
         return true;
     }
     return false;
@@ -117,7 +122,10 @@ static bool headSpeedValid(void)
 void governorUpdateStandard(void)
 {
     // Other code looks to governor.c for headspeed, update it on every loop.
-    headSpeed = getMotorRPM(0) / govGearRatio;
+    const timeUs_t currentTimeUs = micros();
+    headSpeed = getMotorRPMAt(0, currentTimeUs) / govGearRatio;
+    headSpeedRate = getMotorRPMRate(0) / govGearRatio;
+    headSpeedAge = getMotorRPMAge(0, currentTimeUs);
 
     float throttle = mixerGetThrottle();
     float govMain = 0.0;
@@ -587,6 +595,12 @@ void governorUpdateStandard(void)
     DEBUG_SET(DEBUG_GOVERNOR, 2, govPidSum * 1000);
     DEBUG_SET(DEBUG_GOVERNOR, 3, govMain  * 1000);
 #endif
+#ifdef DEBUG_GOV_HEADSPEED
+    DEBUG_SET(DEBUG_GOVERNOR, 0, headSpeed);
+    DEBUG_SET(DEBUG_GOVERNOR, 1, headSpeedRate);
+    DEBUG_SET(DEBUG_GOVERNOR, 2, MIN(headSpeedAge, INT16_MAX));
+    DEBUG_SET(DEBUG_GOVERNOR, 3, govSetpointLimited);
+#endif
 #ifdef DEBUG_GOV_COMPAT
     DEBUG_SET(DEBUG_GOVERNOR, 0, govSetpointLimited);
     DEBUG_SET(DEBUG_GOVERNOR, 1, headSpeed);
@@ -32,6 +32,7 @@
 
 #include "common/filter.h"
 #include "common/maths.h"
+#include "common/sdft.h"
 #include "common/time.h"
 #include "common/utils.h"
 
@@ -86,6 +87,18 @@
 #define DYN_NOTCH_CALC_TICKS      (XYZ_AXIS_COUNT * 4) // 4 steps per axis
 #define DYN_NOTCH_OSD_MIN_THROTTLE 20
 
+// The sliding DFT alternative (USE_DYN_NOTCH_SDFT, dyn_notch_analyser = SDFT)
+// takes every downsampled sample into SDFT_SAMPLE_SIZE (72) bins as it
+// arrives, spreading the bin updates over the maxSampleCount gyro loops until
+// the next sample. Only the bins between dyn_notch_min_hz and dyn_notch_max_hz
+// are kept. At 1333Hz a bin is 18.5Hz wide instead of 41.65Hz.
+// Analysis is one step per gyro loop, 4 steps per axis, so the load is the
+// same every loop. Up to SDFT_PEAK_COUNT peaks are found per axis; with dual
+// notch and two peaks the notches follow the lower and the upper peak.
+// Its state is about 1.9KB on top of the FFT, so it is off by default and
+// built in with OPTIONS=USE_DYN_NOTCH_SDFT.
+#define SDFT_PEAK_MIN_RATIO       0.1f // second peak power relative to the first
+
 static uint16_t FAST_RAM_ZERO_INIT   fftSamplingRateHz;
 static float FAST_RAM_ZERO_INIT      fftResolution;
 static uint8_t FAST_RAM_ZERO_INIT    fftStartBin;
@@ -100,6 +113,12 @@ static float FAST_RAM_ZERO_INIT      smoothFactor;
 static uint8_t FAST_RAM_ZERO_INIT    samples;
 // Hanning window, see https://en.wikipedia.org/wiki/Window_function#Hann_.28Hanning.29_window
 static FAST_RAM_ZERO_INIT float hanningWindow[FFT_WINDOW_SIZE];
+#ifdef USE_DYN_NOTCH_SDFT
+static bool FAST_RAM_ZERO_INIT       sdftAnalyser;
+static float FAST_RAM_ZERO_INIT      sdftResolution;
+static uint8_t FAST_RAM_ZERO_INIT    sdftStartBin;
+static uint8_t FAST_RAM_ZERO_INIT    sdftEndBin;
+#endif
 
 void gyroDataAnalyseInit(uint32_t targetLooptimeUs)
 {
@@ -139,6 +158,14 @@ void gyroDataAnalyseInit(uint32_t targetLooptimeUs)
     for (int i = 0; i < FFT_WINDOW_SIZE; i++) {
         hanningWindow[i] = (0.5f - 0.5f * cos_approx(2 * M_PIf * i / (FFT_WINDOW_SIZE - 1)));
     }
+
+#ifdef USE_DYN_NOTCH_SDFT
+    sdftAnalyser = (gyroConfig()->dyn_notch_analyser == DYN_NOTCH_ANALYSER_SDFT);
+    sdftResolution = (float)fftSamplingRateHz / SDFT_SAMPLE_SIZE; // 18.5hz per bin at 1333hz
+    // one bin either side of the range, so that peaks at the limits are seen
+    sdftStartBin = MAX(2, lrintf(dynNotchMinHz / sdftResolution) - 1);
+    sdftEndBin = MIN(SDFT_BIN_COUNT - 1, lrintf(dynNotchMaxHz / sdftResolution) + 1);
+#endif
 }
 
 void gyroDataAnalyseStateInit(gyroAnalyseState_t *state, uint32_t targetLooptimeUs)
@@ -152,6 +179,13 @@ void gyroDataAnalyseStateInit(gyroAnalyseState_t *state, uint32_t targetLooptime
         // any init value
         state->centerFreq[axis] = dynNotchMaxHz;
     }
+#ifdef USE_DYN_NOTCH_SDFT
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        sdftInit(&state->sdft[axis], sdftStartBin, sdftEndBin, state->maxSampleCount);
+        state->notchFreq[axis][0] = dynNotchMaxHz * dynNotch1Ctr;
+        state->notchFreq[axis][1] = dynNotchMaxHz * dynNotch2Ctr;
+    }
+#endif
 }
 
 void gyroDataAnalysePush(gyroAnalyseState_t *state, const int axis, const float sample)
@@ -160,12 +194,22 @@ void gyroDataAnalysePush(gyroAnalyseState_t *state, const int axis, const float
 }
 
 static void gyroDataAnalyseUpdate(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn, biquadFilter_t *notchFilterDyn2);
+#ifdef USE_DYN_NOTCH_SDFT
+static void gyroDataAnalyseSdft(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn, biquadFilter_t *notchFilterDyn2);
+#endif
 
 /*
  * Collect gyro data, to be analysed in gyroDataAnalyseUpdate function
  */
 void gyroDataAnalyse(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn, biquadFilter_t *notchFilterDyn2)
 {
+#ifdef USE_DYN_NOTCH_SDFT
+    if (sdftAnalyser) {
+        gyroDataAnalyseSdft(state, notchFilterDyn, notchFilterDyn2);
+        return;
+    }
+#endif
+
     // samples should have been pushed by `gyroDataAnalysePush`
     // if gyro sampling is > 1kHz, accumulate and average multiple gyro samples
     state->sampleCount++;
@@ -399,6 +443,163 @@ static FAST_CODE_NOINLINE void gyroDataAnalyseUpdate(gyroAnalyseState_t *state,
     state->updateStep = (state->updateStep + 1) % STEP_COUNT;
 }
 
+#ifdef USE_DYN_NOTCH_SDFT
+static void gyroDataAnalyseSdftUpdate(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn, biquadFilter_t *notchFilterDyn2);
+
+/*
+ * Collect gyro data into the sliding DFT and analyse one step per call
+ */
+static void gyroDataAnalyseSdft(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn, biquadFilter_t *notchFilterDyn2)
+{
+    state->sampleCount++;
+
+    if (state->sampleCount == state->maxSampleCount) {
+        state->sampleCount = 0;
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            state->sdftSample[axis] = state->oversampledGyroAccumulator[axis] * state->maxSampleCountRcp;
+            state->oversampledGyroAccumulator[axis] = 0;
+        }
+        DEBUG_SET(DEBUG_FFT, 2, lrintf(state->sdftSample[0]));
+    }
+
+    // one batch of bins per loop, the sample is complete when the next one is ready
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        sdftPushBatch(&state->sdft[axis], state->sdftSample[axis], state->sampleCount);
+    }
+
+    gyroDataAnalyseSdftUpdate(state, notchFilterDyn, notchFilterDyn2);
+}
+
+static FAST_CODE_NOINLINE void gyroDataAnalyseSdftUpdate(gyroAnalyseState_t *state, biquadFilter_t *notchFilterDyn, biquadFilter_t *notchFilterDyn2)
+{
+    enum {
+        STEP_WINDOW,
+        STEP_DETECT_PEAKS,
+        STEP_CALC_FREQUENCIES,
+        STEP_UPDATE_FILTERS,
+        STEP_COUNT
+    };
+
+    const int axis = state->updateAxis;
+
+    uint32_t startTime = 0;
+    if (debugMode == (DEBUG_FFT_TIME)) {
+        startTime = micros();
+    }
+
+    DEBUG_SET(DEBUG_FFT_TIME, 0, state->updateStep);
+    switch (state->updateStep) {
+        case STEP_WINDOW:
+        {
+            sdftWinSq(&state->sdft[axis], state->sdftData);
+            DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
+
+            break;
+        }
+        case STEP_DETECT_PEAKS:
+        {
+            // the two highest local maxima, and the lowest bin as noise floor
+            uint8_t peakBin[SDFT_PEAK_COUNT] = { 0, 0 };
+            float peakPower[SDFT_PEAK_COUNT] = { 0, 0 };
+            float dataMin = state->sdftData[sdftStartBin];
+
+            for (int i = sdftStartBin + 1; i < sdftEndBin; i++) {
+                const float power = state->sdftData[i];
+                if (power > state->sdftData[i - 1] && power >= state->sdftData[i + 1]) {
+                    if (power > peakPower[0]) {
+                        peakPower[1] = peakPower[0];
+                        peakBin[1] = peakBin[0];
+                        peakPower[0] = power;
+                        peakBin[0] = i;
+                    } else if (power > peakPower[1]) {
+                        peakPower[1] = power;
+                        peakBin[1] = i;
+                    }
+                }
+                dataMin = fminf(dataMin, power);
+            }
+            dataMin = fminf(dataMin, state->sdftData[sdftEndBin]);
+
+            state->peakCount = 0;
+            if (peakBin[0]) {
+                state->peakBin[state->peakCount++] = peakBin[0];
+                if (peakBin[1] && peakPower[1] >= SDFT_PEAK_MIN_RATIO * peakPower[0]) {
+                    state->peakBin[state->peakCount++] = peakBin[1];
+                }
+            }
+            state->noiseFloor = dataMin;
+            DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
+
+            break;
+        }
+        case STEP_CALC_FREQUENCIES:
+        {
+            // no peak, hold the notches where they are
+            if (state->peakCount == 0) {
+                break;
+            }
+
+            float peakFreq[SDFT_PEAK_COUNT];
+            for (int p = 0; p < state->peakCount; p++) {
+                // weighted mean of the peak bin and the shoulder bins either side
+                const int bin = state->peakBin[p];
+                const float sum = state->sdftData[bin - 1] + state->sdftData[bin] + state->sdftData[bin + 1];
+                const float meanIndex = bin + (state->sdftData[bin + 1] - state->sdftData[bin - 1]) / sum;
+                peakFreq[p] = constrainf(meanIndex * sdftResolution, dynNotchMinHz, dynNotchMaxHz);
+            }
+
+            // PT1 style dynamic smoothing moves rapidly towards big peaks and slowly away, up to 8x faster
+            const float peakPower = state->sdftData[state->peakBin[0]];
+            const float dynamicFactor = (state->noiseFloor > 0) ? constrainf(sqrtf(peakPower / state->noiseFloor), 1.0f, 8.0f) : 8.0f;
+            const float k = smoothFactor * dynamicFactor;
+
+            state->centerFreq[axis] += k * (peakFreq[0] - state->centerFreq[axis]);
+
+            float lowerFreq, upperFreq;
+            if (state->peakCount > 1) {
+                lowerFreq = MIN(peakFreq[0], peakFreq[1]);
+                upperFreq = MAX(peakFreq[0], peakFreq[1]);
+            } else {
+                lowerFreq = peakFreq[0] * dynNotch1Ctr;
+                upperFreq = peakFreq[0] * dynNotch2Ctr;
+            }
+            state->notchFreq[axis][0] += k * (lowerFreq - state->notchFreq[axis][0]);
+            state->notchFreq[axis][1] += k * (upperFreq - state->notchFreq[axis][1]);
+
+            if (calculateThrottlePercentAbs() > DYN_NOTCH_OSD_MIN_THROTTLE) {
+                dynNotchMaxFFT = MAX(dynNotchMaxFFT, state->centerFreq[axis]);
+            }
+
+            if (axis == 0) {
+                DEBUG_SET(DEBUG_FFT, 3, lrintf(peakFreq[0] / sdftResolution * 100));
+                DEBUG_SET(DEBUG_FFT_FREQ, 0, state->centerFreq[axis]);
+                DEBUG_SET(DEBUG_FFT_FREQ, 1, lrintf(dynamicFactor * 100));
+                DEBUG_SET(DEBUG_DYN_LPF, 1, state->centerFreq[axis]);
+            }
+            DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
+
+            break;
+        }
+        case STEP_UPDATE_FILTERS:
+        {
+            if (dualNotch) {
+                biquadFilterUpdate(&notchFilterDyn[axis], state->notchFreq[axis][0], gyro.targetLooptime, dynNotchQ, FILTER_NOTCH);
+                biquadFilterUpdate(&notchFilterDyn2[axis], state->notchFreq[axis][1], gyro.targetLooptime, dynNotchQ, FILTER_NOTCH);
+            } else {
+                biquadFilterUpdate(&notchFilterDyn[axis], state->centerFreq[axis], gyro.targetLooptime, dynNotchQ, FILTER_NOTCH);
+            }
+            DEBUG_SET(DEBUG_FFT_TIME, 1, micros() - startTime);
+
+            state->updateAxis = (state->updateAxis + 1) % XYZ_AXIS_COUNT;
+
+            break;
+        }
+    }
+
+    state->updateStep = (state->updateStep + 1) % STEP_COUNT;
+}
+#endif // USE_DYN_NOTCH_SDFT
 
 uint16_t getMaxFFT(void) {
     return dynNotchMaxFFT;
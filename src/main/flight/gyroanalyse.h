@@ -23,8 +23,10 @@
 #include "arm_math.h"
 
 #include "common/filter.h"
+#include "common/sdft.h"
 
 #define FFT_WINDOW_SIZE 32
+#define SDFT_PEAK_COUNT 2
 
 typedef struct gyroAnalyseState_s {
     // accumulator for oversampled data => no aliasing and less noise
@@ -48,6 +50,21 @@ typedef struct gyroAnalyseState_s {
 
     float centerFreq[XYZ_AXIS_COUNT];
 
+#ifdef USE_DYN_NOTCH_SDFT
+    // sliding DFT, bins updated in batches over maxSampleCount loops
+    sdft_t sdft[XYZ_AXIS_COUNT];
+    float sdftSample[XYZ_AXIS_COUNT];
+    float sdftData[SDFT_BIN_COUNT + 1];
+
+    // peaks of the axis being analysed, in frequency order
+    uint8_t peakCount;
+    uint8_t peakBin[SDFT_PEAK_COUNT];
+    float noiseFloor;
+
+    // smoothed notch frequencies, lower and upper
+    float notchFreq[XYZ_AXIS_COUNT][SDFT_PEAK_COUNT];
+#endif
+
 } gyroAnalyseState_t;
 
 STATIC_ASSERT(FFT_WINDOW_SIZE <= (uint8_t) -1, window_size_greater_than_underlying_type);
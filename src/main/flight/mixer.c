@@ -27,6 +27,7 @@
 #include "common/axis.h"
 #include "common/filter.h"
 #include "common/maths.h"
+#include "common/utils.h"
 
 #include "config/config.h"
 #include "config/config_reset.h"
@@ -58,6 +59,36 @@ FAST_RAM_ZERO_INIT uint8_t mixerRuleCount;
 FAST_RAM_ZERO_INIT mixer_t mixer[MIXER_RULE_COUNT];
 FAST_RAM_ZERO_INIT int16_t mixScales[MIXER_INPUT_COUNT];
 
+// Compiled rule: scales folded into float gain and limits in output units
+typedef struct mixerOp_s
+{
+    uint8_t input;
+    uint8_t output;
+    float   gain;
+    float   offset;
+    float   min;
+    float   max;
+} mixerOp_t;
+
+// Consecutive ops of the same operation
+typedef struct mixerOpGroup_s
+{
+    uint8_t oper;
+    uint8_t start;
+    uint8_t count;
+} mixerOpGroup_t;
+
+FAST_RAM_ZERO_INIT mixerOp_t mixerOps[MIXER_RULE_COUNT];
+FAST_RAM_ZERO_INIT mixerOpGroup_t mixerOpGroups[MIXER_RULE_COUNT];
+FAST_RAM_ZERO_INIT uint8_t mixerOpGroupCount;
+
+// Outputs not started with a SET, these are cleared every update
+FAST_RAM_ZERO_INIT uint8_t mixerClearOutputs[MIXER_OUTPUT_COUNT];
+FAST_RAM_ZERO_INIT uint8_t mixerClearCount;
+
+// RC channels used as inputs
+FAST_RAM_ZERO_INIT uint32_t mixerRcDataMask;
+
 FAST_RAM_ZERO_INIT float mixerInput[MIXER_INPUT_COUNT];
 FAST_RAM_ZERO_INIT float mixerOutput[MIXER_OUTPUT_COUNT];
 
@@ -110,6 +141,7 @@ void mixerInit(void)
         mixScales[i] = constrain(mixerScales()->scale[i], -2000, 2000);
     }
 
+    mixerCompile();
     mixerInitProfile();
 }
 
@@ -118,6 +150,96 @@ void mixerInitProfile(void)
     cyclicLimit = currentPidProfile->pidSumLimit * MIXER_PID_SCALING;
 }
 
+/*
+ * Compile the rules into op groups. Rules on different outputs are
+ * independent, and on the same output consecutive ADDs or MULs can be
+ * applied together, so each rule gets a level: the number of operation
+ * changes before it on its output. A stable sort by (level, oper) keeps
+ * the order of the rules on every output, and turns a typical mix into
+ * one SET group and one ADD group.
+ */
+void mixerCompile(void)
+{
+    uint8_t level[MIXER_RULE_COUNT];
+    uint8_t outputLevel[MIXER_OUTPUT_COUNT];
+    uint8_t outputOper[MIXER_OUTPUT_COUNT];
+    uint8_t order[MIXER_RULE_COUNT];
+
+    memset(outputLevel, 0, sizeof(outputLevel));
+    memset(outputOper, MIXER_OP_NUL, sizeof(outputOper));
+
+    mixerRcDataMask = 0;
+
+    for (int i = 0; i < mixerRuleCount; i++) {
+        const int dst = mixer[i].output;
+
+        if (outputOper[dst] != MIXER_OP_NUL && outputOper[dst] != mixer[i].oper)
+            outputLevel[dst]++;
+
+        outputOper[dst] = mixer[i].oper;
+        level[i] = outputLevel[dst];
+
+        if (mixer[i].input >= MIXER_IN_RCDATA_0 && mixer[i].input < MIXER_IN_RCDATA_0 + 16)
+            mixerRcDataMask |= BIT(mixer[i].input - MIXER_IN_RCDATA_0);
+    }
+
+    // Stable insertion sort by (level, oper)
+    for (int i = 0; i < mixerRuleCount; i++) {
+        int j = i;
+        while (j > 0 && (level[order[j-1]] > level[i] ||
+                         (level[order[j-1]] == level[i] && mixer[order[j-1]].oper > mixer[i].oper))) {
+            order[j] = order[j-1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    mixerOpGroupCount = 0;
+
+    for (int i = 0; i < mixerRuleCount; i++) {
+        const mixer_t *rule = &mixer[order[i]];
+        mixerOp_t *op = &mixerOps[i];
+
+        op->input  = rule->input;
+        op->output = rule->output;
+        op->gain   = rule->rate * mixScales[rule->input] / 1e6f;
+        op->offset = rule->offset / 1000.0f;
+        op->min    = rule->min / 1000.0f;
+        op->max    = rule->max / 1000.0f;
+
+        if (i == 0 || level[order[i]] != level[order[i-1]] || rule->oper != mixer[order[i-1]].oper) {
+            mixerOpGroup_t *group = &mixerOpGroups[mixerOpGroupCount++];
+            group->oper  = rule->oper;
+            group->start = i;
+            group->count = 0;
+        }
+
+        mixerOpGroups[mixerOpGroupCount - 1].count++;
+    }
+
+    // Outputs starting with ADD or MUL, unused outputs stay at zero
+    mixerClearCount = 0;
+
+    for (int i = 0; i < MIXER_OUTPUT_COUNT; i++) {
+        mixerOutput[i] = 0;
+    }
+
+    for (int i = 0; i < mixerRuleCount; i++) {
+        const int dst = mixer[i].output;
+        if (outputOper[dst] != MIXER_OP_NUL) {
+            if (mixer[i].oper != MIXER_OP_SET)
+                mixerClearOutputs[mixerClearCount++] = dst;
+            outputOper[dst] = MIXER_OP_NUL;
+        }
+    }
+}
+
+void mixerSetInputScale(uint8_t index, int16_t scale)
+{
+    mixScales[index] = scale;
+    mixerCompile();
+}
+
 void mixerUpdate(void)
 {
     mixerInput[MIXER_IN_RCCMD_ROLL]       = rcCommand[ROLL]       * MIXER_RC_SCALING;
@@ -140,8 +262,10 @@ void mixerUpdate(void)
     mixerInput[MIXER_IN_STABILIZED_THROTTLE]   = mixerInput[MIXER_IN_RCCMD_THROTTLE];
     mixerInput[MIXER_IN_STABILIZED_COLLECTIVE] = mixerInput[MIXER_IN_RCCMD_COLLECTIVE];
 
-    for (int i = 0; i < 16; i++)
-        mixerInput[MIXER_IN_RCDATA_0 + i] = (rcData[i] - rxConfig()->midrc) * MIXER_RC_SCALING;
+    for (int i = 0; i < 16; i++) {
+        if (mixerRcDataMask & BIT(i))
+            mixerInput[MIXER_IN_RCDATA_0 + i] = (rcData[i] - rxConfig()->midrc) * MIXER_RC_SCALING;
+    }
 
     governorUpdate();
 
@@ -166,27 +290,29 @@ void mixerUpdate(void)
         }
     }
 
-    // Reset outputs
-    for (int i = 0; i < MIXER_OUTPUT_COUNT; i++) {
-        mixerOutput[i] = 0;
+    // Reset outputs that are not SET first
+    for (int i = 0; i < mixerClearCount; i++) {
+        mixerOutput[mixerClearOutputs[i]] = 0;
     }
 
     // Calculate mixer outputs
-    for (int i = 0; i < mixerRuleCount; i++) {
-        int src = mixer[i].input;
-        int dst = mixer[i].output;
-        float val = constrainf(mixer[i].offset + mixerInput[src] * mixer[i].rate * mixScales[src]/1000.0f, mixer[i].min, mixer[i].max) / 1000.0f;
+    for (int g = 0; g < mixerOpGroupCount; g++) {
+        const mixerOp_t *op = &mixerOps[mixerOpGroups[g].start];
+        const mixerOp_t *end = op + mixerOpGroups[g].count;
 
-        switch (mixer[i].oper)
+        switch (mixerOpGroups[g].oper)
         {
             case MIXER_OP_SET:
-                mixerOutput[dst] = val;
+                for (; op < end; op++)
+                    mixerOutput[op->output] = constrainf(op->offset + mixerInput[op->input] * op->gain, op->min, op->max);
                 break;
             case MIXER_OP_ADD:
-                mixerOutput[dst] += val;
+                for (; op < end; op++)
+                    mixerOutput[op->output] += constrainf(op->offset + mixerInput[op->input] * op->gain, op->min, op->max);
                 break;
             case MIXER_OP_MUL:
-                mixerOutput[dst] *= val;
+                for (; op < end; op++)
+                    mixerOutput[op->output] *= constrainf(op->offset + mixerInput[op->input] * op->gain, op->min, op->max);
                 break;
         }
     }
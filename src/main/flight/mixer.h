@@ -117,6 +117,9 @@ extern FAST_RAM_ZERO_INIT int16_t mixScales[MIXER_INPUT_COUNT];
 
 void mixerInit(void);
 void mixerInitProfile(void);
+void mixerCompile(void);
+
+void mixerSetInputScale(uint8_t index, int16_t scale);
 
 void mixerUpdate(void);
 
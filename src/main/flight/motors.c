@@ -68,9 +68,20 @@ FAST_RAM_ZERO_INIT float          motorOutputStop;
 FAST_RAM_ZERO_INIT float          motorOutputRange;
 FAST_RAM_ZERO_INIT float          motorOutputDisarmed[MAX_SUPPORTED_MOTORS];
 
+typedef struct {
+    alphaBetaFilter_t filter;           // RPM and RPM/s at timeUs
+    timeUs_t timeUs;
+    timeUs_t sampleUs;                  // newest sample of any source
+    timeUs_t sourceUs[RPM_SRC_COUNT];   // newest sample of each source
+    float bandwidth;
+    float scale;                        // eRPM/100 to RPM
+    uint8_t sources;                    // bit per available source
+    bool valid;
+} motorRpmEstimator_t;
+
 FAST_RAM_ZERO_INIT float          motorRpm[MAX_SUPPORTED_MOTORS];
 FAST_RAM_ZERO_INIT uint8_t        motorRpmSource[MAX_SUPPORTED_MOTORS];
-FAST_RAM_ZERO_INIT biquadFilter_t motorRpmFilter[MAX_SUPPORTED_MOTORS];
+FAST_RAM_ZERO_INIT motorRpmEstimator_t motorRpmEstimator[MAX_SUPPORTED_MOTORS];
 
 
 uint8_t getMotorCount(void)
@@ -113,60 +124,184 @@ int getMotorRPM(uint8_t motor)
         return 0;
 }
 
-int getMotorERPM(uint8_t motor)
+float getMotorRPMAt(uint8_t motor, timeUs_t currentTimeUs)
+{
+    if (motor >= motorCount || !motorRpmEstimator[motor].valid)
+        return 0;
+
+    const motorRpmEstimator_t *est = &motorRpmEstimator[motor];
+
+    // Extrapolate over short telemetry gaps only
+    const timeDelta_t dT = constrain(cmpTimeUs(currentTimeUs, est->timeUs), 0, MOTOR_RPM_PREDICT_MAX_US);
+
+    return fmaxf(alphaBetaFilterPredict(&est->filter, dT * 1e-6f), 0);
+}
+
+// Estimated RPM/s
+float getMotorRPMRate(uint8_t motor)
+{
+    if (motor >= motorCount || !motorRpmEstimator[motor].valid)
+        return 0;
+
+    return motorRpmEstimator[motor].filter.rate;
+}
+
+timeDelta_t getMotorRPMAge(uint8_t motor, timeUs_t currentTimeUs)
+{
+    if (motor >= motorCount || !motorRpmEstimator[motor].valid)
+        return INT32_MAX;
+
+    return cmpTimeUs(currentTimeUs, motorRpmEstimator[motor].sampleUs);
+}
+
+/*
+ * Newest eRPM/100 sample of a source and the time it was received.
+ * Sources that are read out as they change are sampled now.
+ */
+static bool getMotorERPMSample(uint8_t motor, uint8_t source, timeUs_t currentTimeUs, float *erpm, timeUs_t *sampleUs)
 {
-    int erpm;
+    switch (source) {
+#ifdef SIMULATOR_BUILD
+        case RPM_SRC_SIMULATOR:
+            *erpm = simulatorGetMotorERPM(motor);
+            *sampleUs = currentTimeUs;
+            return true;
+#endif
 #ifdef USE_FREQ_SENSOR
-    if (motorRpmSource[motor] == RPM_SRC_FREQ_SENSOR) {
-        erpm = getFreqSensorRPM(motor);
-    }
-    else
+        case RPM_SRC_FREQ_SENSOR:
+            *erpm = freqRead(motor) * 60.0f / 100.0f;
+            *sampleUs = currentTimeUs;
+            return true;
 #endif
 #ifdef USE_DSHOT_TELEMETRY
-    if (motorRpmSource[motor] == RPM_SRC_DSHOT_TELEM) {
-        erpm = getDshotTelemetry(motor);
-    }
-    else
+        case RPM_SRC_DSHOT_TELEM:
+            *erpm = getDshotTelemetry(motor);
+            *sampleUs = getDshotTelemetryTimeUs(motor);
+            return true;
 #endif
 #ifdef USE_ESC_SENSOR
-    if (motorRpmSource[motor] == RPM_SRC_ESC_SENSOR) {
-        erpm = getEscSensorRPM(motor);
-    }
-    else
+        case RPM_SRC_ESC_SENSOR:
+            *erpm = getEscSensorRPM(motor);
+            *sampleUs = getEscSensorRPMTimeUs(motor);
+            return true;
 #endif
-    {
-        erpm = 0;
+        default:
+#if !defined(SIMULATOR_BUILD) && !defined(USE_FREQ_SENSOR)
+            UNUSED(currentTimeUs);
+#if !defined(USE_DSHOT_TELEMETRY) && !defined(USE_ESC_SENSOR)
+            UNUSED(motor);
+            UNUSED(erpm);
+            UNUSED(sampleUs);
+#endif
+#endif
+            return false;
+    }
+}
+
+/*
+ * Feeds every new sample of every source of the motor to its estimator.
+ * A sample is weighed by the interval of its own source, so a slow ESC
+ * sensor only trims the estimate of a fast DShot telemetry. Samples older
+ * than the estimate are applied at their own time.
+ */
+static void motorRpmEstimatorUpdate(uint8_t motor, timeUs_t currentTimeUs)
+{
+    motorRpmEstimator_t *est = &motorRpmEstimator[motor];
+
+    for (int source = RPM_SRC_NONE + 1; source < RPM_SRC_COUNT; source++) {
+        float erpm;
+        timeUs_t sampleUs;
+
+        if (!(est->sources & BIT(source)) ||
+            !getMotorERPMSample(motor, source, currentTimeUs, &erpm, &sampleUs) ||
+            sampleUs == est->sourceUs[source])
+            continue;
+
+        const float rpm = erpm * est->scale;
+        const float interval = constrainf(cmpTimeUs(sampleUs, est->sourceUs[source]) * 1e-6f,
+                                          gyro.targetLooptime * 1e-6f, 0.1f);
+
+        est->sourceUs[source] = sampleUs;
+
+        if (!est->valid || cmpTimeUs(sampleUs, est->sampleUs) > MOTOR_RPM_TIMEOUT_US) {
+            alphaBetaFilterInit(&est->filter, est->bandwidth, rpm);
+            est->timeUs = sampleUs;
+            est->sampleUs = sampleUs;
+            est->valid = true;
+            continue;
+        }
+
+        const timeDelta_t dT = cmpTimeUs(sampleUs, est->timeUs);
+
+        alphaBetaFilterUpdate(&est->filter, rpm, dT * 1e-6f, interval);
+
+        if (dT >= 0) {
+            est->timeUs = sampleUs;
+        } else {
+            est->filter.value -= est->filter.rate * dT * 1e-6f;
+        }
+
+        if (cmpTimeUs(sampleUs, est->sampleUs) > 0) {
+            est->sampleUs = sampleUs;
+        }
+    }
+
+    if (est->valid && cmpTimeUs(currentTimeUs, est->sampleUs) > MOTOR_RPM_TIMEOUT_US) {
+        est->valid = false;
     }
-    return erpm;
 }
 
+static const uint8_t rpmSourcePreference[] = {
+#ifdef SIMULATOR_BUILD
+    RPM_SRC_SIMULATOR,
+#endif
+    RPM_SRC_FREQ_SENSOR,
+    RPM_SRC_DSHOT_TELEM,
+    RPM_SRC_ESC_SENSOR,
+};
+
 void rpmSourceInit(void)
 {
     for (int i = 0; i < MAX_SUPPORTED_MOTORS; i++) {
+        motorRpmEstimator_t *est = &motorRpmEstimator[i];
+        uint8_t sources = 0;
+
+#ifdef SIMULATOR_BUILD
+        if (simulatorHasMotorRPM()) {
+            sources |= BIT(RPM_SRC_SIMULATOR);
+        }
+#endif
 #ifdef USE_FREQ_SENSOR
         if (featureIsEnabled(FEATURE_FREQ_SENSOR) && isFreqSensorPortInitialized(i)) {
-            motorRpmSource[i] = RPM_SRC_FREQ_SENSOR;
+            sources |= BIT(RPM_SRC_FREQ_SENSOR);
         }
-        else
 #endif
 #ifdef USE_DSHOT_TELEMETRY
         if (isMotorProtocolDshot() && motorConfig()->dev.useDshotTelemetry) {
-            motorRpmSource[i] = RPM_SRC_DSHOT_TELEM;
+            sources |= BIT(RPM_SRC_DSHOT_TELEM);
         }
-        else
 #endif
 #ifdef USE_ESC_SENSOR
         if (featureIsEnabled(FEATURE_ESC_SENSOR) && isEscSensorActive()) {
-            motorRpmSource[i] = RPM_SRC_ESC_SENSOR;
+            sources |= BIT(RPM_SRC_ESC_SENSOR);
         }
-        else
 #endif
-        {
-            motorRpmSource[i] = RPM_SRC_NONE;
+
+        // Primary source, for status only
+        motorRpmSource[i] = RPM_SRC_NONE;
+        for (unsigned j = 0; j < ARRAYLEN(rpmSourcePreference); j++) {
+            if (sources & BIT(rpmSourcePreference[j])) {
+                motorRpmSource[i] = rpmSourcePreference[j];
+                break;
+            }
         }
 
-        int freq = constrain(motorConfig()->motorRpmLpf[i], 1, 1000);
-        biquadFilterInitLPF(&motorRpmFilter[i], freq, gyro.targetLooptime);
+        memset(est, 0, sizeof(*est));
+        est->sources = sources;
+        // motor_rpm_lpf was the cutoff of the RPM low pass. The estimator tracks
+        // the RPM with the same gain at that bandwidth, so stored values carry over
+        est->bandwidth = constrain(motorConfig()->motorRpmLpf[i], 1, 1000);
+        est->scale = 100.0f / MAX(motorConfig()->motorPoleCount[i] / 2, 1);
     }
 }
 
@@ -212,8 +347,11 @@ void motorUpdate(void)
         motorWriteAll(motorOutputDisarmed);
     }
 
+    const timeUs_t currentTimeUs = micros();
+
     for (int i = 0; i < motorCount; i++) {
-        motorRpm[i] = biquadFilterApply(&motorRpmFilter[i], calcMotorRpm(i,getMotorERPM(i)));
+        motorRpmEstimatorUpdate(i, currentTimeUs);
+        motorRpm[i] = getMotorRPMAt(i, currentTimeUs);
         DEBUG_SET(DEBUG_RPM_SOURCE, i, motorRpm[i]);
     }
 }
@@ -19,14 +19,26 @@
 
 #include "platform.h"
 
+#include "common/time.h"
+
 
 typedef enum {
     RPM_SRC_NONE = 0,
     RPM_SRC_DSHOT_TELEM,
     RPM_SRC_FREQ_SENSOR,
     RPM_SRC_ESC_SENSOR,
+#ifdef SIMULATOR_BUILD
+    RPM_SRC_SIMULATOR,
+#endif
+    RPM_SRC_COUNT
 } rpmSource_e;
 
+// Estimates are extrapolated up to this far past the newest sample
+#define MOTOR_RPM_PREDICT_MAX_US    20000
+
+// Estimator restarts from the next sample after this long without one
+#define MOTOR_RPM_TIMEOUT_US        250000
+
 
 extern uint8_t motorCount;
 
@@ -46,6 +58,10 @@ bool areMotorsRunning(void);
 int getMotorRPM(uint8_t motor);
 int calcMotorRpm(uint8_t motor, int erpm);
 
+float getMotorRPMAt(uint8_t motor, timeUs_t currentTimeUs);
+float getMotorRPMRate(uint8_t motor);
+timeDelta_t getMotorRPMAge(uint8_t motor, timeUs_t currentTimeUs);
+
 void rpmSourceInit(void);
 
 void initEscEndpoints(void);
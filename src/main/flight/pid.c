@@ -214,12 +214,9 @@ static FAST_RAM_ZERO_INIT float collectivePulseFilterGain;
 static FAST_RAM_ZERO_INIT uint8_t rescueCollective;
 #endif
 
-static FAST_RAM_ZERO_INIT filterApplyFnPtr dtermNotchApplyFn;
-static FAST_RAM_ZERO_INIT biquadFilter_t dtermNotch[XYZ_AXIS_COUNT];
+static FAST_RAM_ZERO_INIT biquadCascade_t dtermFilter[XYZ_AXIS_COUNT];
 static FAST_RAM_ZERO_INIT filterApplyFnPtr dtermLowpassApplyFn;
 static FAST_RAM_ZERO_INIT dtermLowpass_t dtermLowpass[XYZ_AXIS_COUNT];
-static FAST_RAM_ZERO_INIT filterApplyFnPtr dtermLowpass2ApplyFn;
-static FAST_RAM_ZERO_INIT dtermLowpass_t dtermLowpass2[XYZ_AXIS_COUNT];
 static FAST_RAM_ZERO_INIT filterApplyFnPtr ptermYawLowpassApplyFn;
 static FAST_RAM_ZERO_INIT pt1Filter_t ptermYawLowpass;
 
@@ -279,10 +276,14 @@ void pidInitFilters(const pidProfile_t *pidProfile)
 {
     STATIC_ASSERT(FD_YAW == 2, FD_YAW_incorrect); // ensure yaw axis is 2
 
+    // D-term notch and lowpasses run as one cascade, except a dynamic lowpass
+    for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
+        biquadCascadeInit(&dtermFilter[axis]);
+    }
+    dtermLowpassApplyFn = nullFilterApply;
+
     if (targetPidLooptime == 0) {
         // no looptime set, so set all the filters to null
-        dtermNotchApplyFn = nullFilterApply;
-        dtermLowpassApplyFn = nullFilterApply;
         ptermYawLowpassApplyFn = nullFilterApply;
         elevatorFilterLowpassApplyFn = nullFilterApply;
         return;
@@ -302,69 +303,65 @@ void pidInitFilters(const pidProfile_t *pidProfile)
     }
 
     if (dTermNotchHz != 0 && pidProfile->dterm_notch_cutoff != 0) {
-        dtermNotchApplyFn = (filterApplyFnPtr)biquadFilterApply;
         const float notchQ = filterGetNotchQ(dTermNotchHz, pidProfile->dterm_notch_cutoff);
         for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-            biquadFilterInit(&dtermNotch[axis], dTermNotchHz, targetPidLooptime, notchQ, FILTER_NOTCH);
+            biquadCascadeAdd(&dtermFilter[axis], dTermNotchHz, targetPidLooptime, notchQ, FILTER_NOTCH);
         }
-    } else {
-        dtermNotchApplyFn = nullFilterApply;
     }
 
     //1st Dterm Lowpass Filter
     uint16_t dterm_lowpass_hz = pidProfile->dterm_lowpass_hz;
+    bool dtermLowpassDynamic = false;
 
 #ifdef USE_DYN_LPF
     if (pidProfile->dyn_lpf_dterm_min_hz) {
         dterm_lowpass_hz = pidProfile->dyn_lpf_dterm_min_hz;
+        dtermLowpassDynamic = true;
     }
 #endif
 
     if (dterm_lowpass_hz > 0 && dterm_lowpass_hz < pidFrequencyNyquist) {
         switch (pidProfile->dterm_filter_type) {
         case FILTER_PT1:
-            dtermLowpassApplyFn = (filterApplyFnPtr)pt1FilterApply;
             for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-                pt1FilterInit(&dtermLowpass[axis].pt1Filter, pt1FilterGain(dterm_lowpass_hz, dT));
+                if (dtermLowpassDynamic) {
+                    dtermLowpassApplyFn = (filterApplyFnPtr)pt1FilterApply;
+                    pt1FilterInit(&dtermLowpass[axis].pt1Filter, pt1FilterGain(dterm_lowpass_hz, dT));
+                } else {
+                    biquadCascadeAddPT1(&dtermFilter[axis], pt1FilterGain(dterm_lowpass_hz, dT));
+                }
             }
             break;
         case FILTER_BIQUAD:
-#ifdef USE_DYN_LPF
-            dtermLowpassApplyFn = (filterApplyFnPtr)biquadFilterApplyDF1;
-#else
-            dtermLowpassApplyFn = (filterApplyFnPtr)biquadFilterApply;
-#endif
             for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-                biquadFilterInitLPF(&dtermLowpass[axis].biquadFilter, dterm_lowpass_hz, targetPidLooptime);
+                if (dtermLowpassDynamic) {
+                    // must be DF1, the coefficients change in flight
+                    dtermLowpassApplyFn = (filterApplyFnPtr)biquadFilterApplyDF1;
+                    biquadFilterInitLPF(&dtermLowpass[axis].biquadFilter, dterm_lowpass_hz, targetPidLooptime);
+                } else {
+                    biquadCascadeAddLPF(&dtermFilter[axis], dterm_lowpass_hz, targetPidLooptime);
+                }
             }
             break;
         default:
-            dtermLowpassApplyFn = nullFilterApply;
             break;
         }
-    } else {
-        dtermLowpassApplyFn = nullFilterApply;
     }
 
     //2nd Dterm Lowpass Filter
-    if (pidProfile->dterm_lowpass2_hz == 0 || pidProfile->dterm_lowpass2_hz > pidFrequencyNyquist) {
-    	dtermLowpass2ApplyFn = nullFilterApply;
-    } else {
+    if (pidProfile->dterm_lowpass2_hz > 0 && pidProfile->dterm_lowpass2_hz <= pidFrequencyNyquist) {
         switch (pidProfile->dterm_filter2_type) {
         case FILTER_PT1:
-            dtermLowpass2ApplyFn = (filterApplyFnPtr)pt1FilterApply;
             for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-                pt1FilterInit(&dtermLowpass2[axis].pt1Filter, pt1FilterGain(pidProfile->dterm_lowpass2_hz, dT));
+                biquadCascadeAddPT1(&dtermFilter[axis], pt1FilterGain(pidProfile->dterm_lowpass2_hz, dT));
             }
             break;
         case FILTER_BIQUAD:
-            dtermLowpass2ApplyFn = (filterApplyFnPtr)biquadFilterApply;
             for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
-                biquadFilterInitLPF(&dtermLowpass2[axis].biquadFilter, pidProfile->dterm_lowpass2_hz, targetPidLooptime);
+                biquadCascadeAddLPF(&dtermFilter[axis], pidProfile->dterm_lowpass2_hz, targetPidLooptime);
             }
             break;
         default:
-            dtermLowpass2ApplyFn = nullFilterApply;
             break;
         }
     }
@@ -1223,10 +1220,8 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
     // Precalculate gyro delta for D-term here, this allows loop unrolling
     float gyroRateDterm[XYZ_AXIS_COUNT];
     for (int axis = FD_ROLL; axis <= FD_YAW; ++axis) {
-        gyroRateDterm[axis] = gyro.gyroADCf[axis];
-        gyroRateDterm[axis] = dtermNotchApplyFn((filter_t *) &dtermNotch[axis], gyroRateDterm[axis]);
+        gyroRateDterm[axis] = biquadCascadeApply(&dtermFilter[axis], gyro.gyroADCf[axis]);
         gyroRateDterm[axis] = dtermLowpassApplyFn((filter_t *) &dtermLowpass[axis], gyroRateDterm[axis]);
-        gyroRateDterm[axis] = dtermLowpass2ApplyFn((filter_t *) &dtermLowpass2[axis], gyroRateDterm[axis]);
     }
 
     // HF3D:  iTermRotation acts as FFF Pirouette Compensation on a heli.
@@ -1234,7 +1229,7 @@ void FAST_CODE pidController(const pidProfile_t *pidProfile, timeUs_t currentTim
     rotateItermAndAxisError();
 
 #ifdef USE_RPM_FILTER
-    rpmFilterUpdate();
+    rpmFilterUpdate(currentTimeUs);
 #endif
 
 #ifdef USE_INTERPOLATED_SP
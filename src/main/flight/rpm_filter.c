@@ -20,6 +20,7 @@
 
 #include <math.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "platform.h"
 
@@ -46,25 +47,56 @@
 
 typedef struct rpmFilterBank_s
 {
+    uint8_t  bankIndex;
     uint8_t  motorIndex;
 
     float    rpmRatio;
     float    minHz;
     float    maxHz;
     float    Q;
-
-    biquadFilter_t notch[XYZ_AXIS_COUNT];
+    float    invTwoQ;
 
 } rpmFilterBank_t;
 
+// Notch coefficients are shared by all axes, the DF1 state is interleaved per axis
+typedef struct rpmNotchBank_s
+{
+    float    b0, b1, b2, a1, a2;
+
+    float    x1[XYZ_AXIS_COUNT];
+    float    x2[XYZ_AXIS_COUNT];
+    float    y1[XYZ_AXIS_COUNT];
+    float    y2[XYZ_AXIS_COUNT];
+
+} rpmNotchBank_t;
 
+
+// Active banks only, compacted at init, in config order
 FAST_RAM_ZERO_INIT static rpmFilterBank_t filterBank[RPM_FILTER_BANK_COUNT];
+FAST_RAM_ZERO_INIT static rpmNotchBank_t  notchBank[RPM_FILTER_BANK_COUNT];
 
 FAST_RAM_ZERO_INIT static uint8_t activeBankCount;
 FAST_RAM_ZERO_INIT static uint8_t currentBank;
 
+FAST_RAM_ZERO_INIT static bool fastUpdate;
+
+// sin/cos of the notch frequency in radians per sample, at 0..PI in steps of PI/RPM_NOTCH_PHASOR_STEPS
+#define RPM_NOTCH_PHASOR_STEPS  64
+
+typedef struct rpmNotchPhasor_s
+{
+    float    sn;
+    float    cs;
+
+} rpmNotchPhasor_t;
+
+FAST_RAM_ZERO_INIT static rpmNotchPhasor_t notchPhasor[RPM_NOTCH_PHASOR_STEPS + 1];
+
+// Hz to table steps
+FAST_RAM_ZERO_INIT static float phasorScale;
 
-PG_REGISTER_WITH_RESET_FN(rpmFilterConfig_t, rpmFilterConfig, PG_RPM_FILTER_CONFIG, 4);
+
+PG_REGISTER_WITH_RESET_FN(rpmFilterConfig_t, rpmFilterConfig, PG_RPM_FILTER_CONFIG, 5);
 
 void pgResetFn_rpmFilterConfig(rpmFilterConfig_t *config)
 {
@@ -75,81 +107,201 @@ void pgResetFn_rpmFilterConfig(rpmFilterConfig_t *config)
         config->filter_bank_min_hz[i]      = 20;
         config->filter_bank_max_hz[i]      = 4000;
     }
+    config->filter_fast_update = 0;
+}
+
+static void rpmNotchBankUpdate(rpmNotchBank_t *notch, float freq, float Q)
+{
+    biquadFilter_t coeffs;
+
+    biquadFilterInit(&coeffs, freq, gyro.targetLooptime, Q, FILTER_NOTCH);
+
+    notch->b0 = coeffs.b0;
+    notch->b1 = coeffs.b1;
+    notch->b2 = coeffs.b2;
+    notch->a1 = coeffs.a1;
+    notch->a2 = coeffs.a2;
+}
+
+/*
+ * Same coefficients as rpmNotchBankUpdate() without sin/cos. The phasor of
+ * the nearest table step is rotated by the remaining angle d, |d| <= PI/128,
+ * using cos(d) = 1 - d^2/2 and sin(d) = d - d^3/6. The truncation error of
+ * that is below 2e-8, well under the error of sin_approx() itself.
+ */
+static FAST_CODE void rpmNotchBankUpdateFast(rpmNotchBank_t *notch, float freq, float invTwoQ)
+{
+    const float pos = freq * phasorScale;
+    const int index = (int)(pos + 0.5f);
+    const float d = (pos - index) * (M_PIf / RPM_NOTCH_PHASOR_STEPS);
+    const float d2 = d * d;
+
+    const float cosD = 1 - d2 * 0.5f;
+    const float sinD = d - d * d2 * (1.0f / 6);
+
+    const rpmNotchPhasor_t *phasor = &notchPhasor[index];
+    const float sn = phasor->sn * cosD + phasor->cs * sinD;
+    const float cs = phasor->cs * cosD - phasor->sn * sinD;
+
+    const float alpha = sn * invTwoQ;
+    const float a0r = 1 / (1 + alpha);
+
+    notch->b0 = a0r;
+    notch->b1 = -2 * cs * a0r;
+    notch->b2 = a0r;
+    notch->a1 = notch->b1;
+    notch->a2 = (1 - alpha) * a0r;
+}
+
+static void rpmNotchPhasorInit(void)
+{
+    for (int i = 0; i <= RPM_NOTCH_PHASOR_STEPS; i++) {
+        const float omega = i * (M_PIf / RPM_NOTCH_PHASOR_STEPS);
+        notchPhasor[i].sn = sin_approx(omega);
+        notchPhasor[i].cs = cos_approx(omega);
+    }
+
+    // omega = 2 * PI * freq * looptime
+    phasorScale = 2 * RPM_NOTCH_PHASOR_STEPS * gyro.targetLooptime * 1e-6f;
 }
 
 void rpmFilterInit(const rpmFilterConfig_t *config)
 {
-    for (int bank = 0; bank < RPM_FILTER_BANK_COUNT; bank++) {
-        if (config->filter_bank_motor_index[bank] > 0 && config->filter_bank_motor_index[bank] <= getMotorCount()) {
-            rpmFilterBank_t *filt = &filterBank[bank];
+    activeBankCount = 0;
+    currentBank = 0;
+
+    fastUpdate = config->filter_fast_update;
+
+    rpmNotchPhasorInit();
+
+    for (int index = 0; index < RPM_FILTER_BANK_COUNT; index++) {
+        if (config->filter_bank_motor_index[index] > 0 && config->filter_bank_motor_index[index] <= getMotorCount()) {
+            rpmFilterBank_t *filt = &filterBank[activeBankCount];
+            rpmNotchBank_t *notch = &notchBank[activeBankCount];
 
             // Force bank config into reasonable limits
-            filt->motorIndex = config->filter_bank_motor_index[bank];
-            filt->rpmRatio   = constrainf(config->filter_bank_gear_ratio[bank], 1, 50000) / 1000 * 60;
-            filt->Q          = constrainf(config->filter_bank_notch_q[bank], 10, 10000) / 100;
-            filt->minHz      = constrainf(config->filter_bank_min_hz[bank], 20, 1000);
-            filt->maxHz      = constrainf(config->filter_bank_max_hz[bank], 100, 0.45e6 / gyro.targetLooptime);
+            filt->bankIndex  = index;
+            filt->motorIndex = config->filter_bank_motor_index[index];
+            filt->rpmRatio   = constrainf(config->filter_bank_gear_ratio[index], 1, 50000) / 1000 * 60;
+            filt->Q          = constrainf(config->filter_bank_notch_q[index], 10, 10000) / 100;
+            filt->invTwoQ    = 0.5f / filt->Q;
+            filt->minHz      = constrainf(config->filter_bank_min_hz[index], 20, 1000);
+            filt->maxHz      = constrainf(config->filter_bank_max_hz[index], 100, 0.45e6 / gyro.targetLooptime);
 
             // Init all filters @minHz. As soon as the motor is running, the filters are updated to the real RPM.
-            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-                biquadFilterInit(&filt->notch[axis], filt->minHz, gyro.targetLooptime, filt->Q, FILTER_NOTCH);
-            }
+            memset(notch, 0, sizeof(rpmNotchBank_t));
+            rpmNotchBankUpdate(notch, filt->minHz, filt->Q);
 
-            currentBank = bank;
+            currentBank = activeBankCount;
             activeBankCount++;
         }
     }
 }
 
+FAST_CODE_NOINLINE void rpmFilterGyroAxes(float *values)
+{
+    float roll  = values[FD_ROLL];
+    float pitch = values[FD_PITCH];
+    float yaw   = values[FD_YAW];
+
+    for (int bank = 0; bank < activeBankCount; bank++) {
+        rpmNotchBank_t *notch = &notchBank[bank];
+
+        const float b0 = notch->b0;
+        const float b1 = notch->b1;
+        const float b2 = notch->b2;
+        const float a1 = notch->a1;
+        const float a2 = notch->a2;
+
+        // Same arithmetic as biquadFilterApplyDF1(), for all three axes at once
+        const float rollOut  = b0 * roll + b1 * notch->x1[FD_ROLL] + b2 * notch->x2[FD_ROLL] - a1 * notch->y1[FD_ROLL] - a2 * notch->y2[FD_ROLL];
+        const float pitchOut = b0 * pitch + b1 * notch->x1[FD_PITCH] + b2 * notch->x2[FD_PITCH] - a1 * notch->y1[FD_PITCH] - a2 * notch->y2[FD_PITCH];
+        const float yawOut   = b0 * yaw + b1 * notch->x1[FD_YAW] + b2 * notch->x2[FD_YAW] - a1 * notch->y1[FD_YAW] - a2 * notch->y2[FD_YAW];
+
+        notch->x2[FD_ROLL]  = notch->x1[FD_ROLL];
+        notch->x2[FD_PITCH] = notch->x1[FD_PITCH];
+        notch->x2[FD_YAW]   = notch->x1[FD_YAW];
+
+        notch->x1[FD_ROLL]  = roll;
+        notch->x1[FD_PITCH] = pitch;
+        notch->x1[FD_YAW]   = yaw;
+
+        notch->y2[FD_ROLL]  = notch->y1[FD_ROLL];
+        notch->y2[FD_PITCH] = notch->y1[FD_PITCH];
+        notch->y2[FD_YAW]   = notch->y1[FD_YAW];
+
+        notch->y1[FD_ROLL]  = roll  = rollOut;
+        notch->y1[FD_PITCH] = pitch = pitchOut;
+        notch->y1[FD_YAW]   = yaw   = yawOut;
+    }
+
+    values[FD_ROLL]  = roll;
+    values[FD_PITCH] = pitch;
+    values[FD_YAW]   = yaw;
+}
+
 FAST_CODE_NOINLINE float rpmFilterGyro(int axis, float value)
 {
-    if (activeBankCount > 0) {
-        for (int bank=0; bank<RPM_FILTER_BANK_COUNT; bank++) {
-            if (filterBank[bank].motorIndex) {
-                value = biquadFilterApplyDF1(&filterBank[bank].notch[axis], value);
-            }
-        }
+    for (int bank = 0; bank < activeBankCount; bank++) {
+        rpmNotchBank_t *notch = &notchBank[bank];
+
+        const float result = notch->b0 * value + notch->b1 * notch->x1[axis] + notch->b2 * notch->x2[axis] - notch->a1 * notch->y1[axis] - notch->a2 * notch->y2[axis];
+
+        notch->x2[axis] = notch->x1[axis];
+        notch->x1[axis] = value;
+
+        notch->y2[axis] = notch->y1[axis];
+        notch->y1[axis] = result;
+
+        value = result;
     }
+
     return value;
 }
 
-void rpmFilterUpdate()
+void rpmFilterUpdate(timeUs_t currentTimeUs)
 {
     if (activeBankCount > 0) {
 
-        // Update one filter bank per cycle
+        if (fastUpdate) {
+            // Update all filter banks every cycle
+            for (int bank = 0; bank < activeBankCount; bank++) {
+                const rpmFilterBank_t *filt = &filterBank[bank];
+                const float rpm  = getMotorRPMAt(filt->motorIndex - 1, currentTimeUs);
+                const float freq = constrainf(rpm / filt->rpmRatio, filt->minHz, filt->maxHz);
+                rpmNotchBankUpdateFast(&notchBank[bank], freq, filt->invTwoQ);
+            }
+        }
+
+        // Debug and the exact update go through the banks one per cycle
         rpmFilterBank_t *filt = &filterBank[currentBank];
 
         // Calculate filter frequency
-        float rpm  = getMotorRPM(filt->motorIndex - 1);
+        float rpm  = getMotorRPMAt(filt->motorIndex - 1, currentTimeUs);
         float freq = constrainf(rpm / filt->rpmRatio, filt->minHz, filt->maxHz);
 
-        // Notches for Roll,Pitch,Yaw
-        biquadFilter_t *R = &filt->notch[0];
-        biquadFilter_t *P = &filt->notch[1];
-        biquadFilter_t *Y = &filt->notch[2];
-
-        // Update the filter coefficients
-        biquadFilterUpdate(R, freq, gyro.targetLooptime, filt->Q, FILTER_NOTCH);
-
-        // Transfer the filter coefficients from Roll axis filter into Pitch and Yaw
-        P->b0 = Y->b0 = R->b0;
-        P->b1 = Y->b1 = R->b1;
-        P->b2 = Y->b2 = R->b2;
-        P->a1 = Y->a1 = R->a1;
-        P->a2 = Y->a2 = R->a2;
+        // Update the filter coefficients, shared by Roll,Pitch,Yaw
+        if (!fastUpdate) {
+            rpmNotchBankUpdate(&notchBank[currentBank], freq, filt->Q);
+        }
 
-        DEBUG_SET(DEBUG_RPM_FILTER, 0, currentBank);
+        DEBUG_SET(DEBUG_RPM_FILTER, 0, filt->bankIndex);
         DEBUG_SET(DEBUG_RPM_FILTER, 1, filt->motorIndex);
         DEBUG_SET(DEBUG_RPM_FILTER, 2, rpm);
         DEBUG_SET(DEBUG_RPM_FILTER, 3, freq);
 
-        // Find next active bank - there must be at least one
-        do {
-            currentBank = (currentBank + 1) % RPM_FILTER_BANK_COUNT;
-        } while (filterBank[currentBank].motorIndex == 0);
+        // Next active bank
+        currentBank = (currentBank + 1) % activeBankCount;
     }
 }
 
+#ifdef UNIT_TEST
+void rpmFilterGetNotchCoeffs(int bank, float *b0, float *b1, float *a2)
+{
+    *b0 = notchBank[bank].b0;
+    *b1 = notchBank[bank].b1;
+    *a2 = notchBank[bank].a2;
+}
 #endif
 
+#endif
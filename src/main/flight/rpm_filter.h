@@ -21,6 +21,7 @@
 #pragma once
 
 #include "common/axis.h"
+#include "common/time.h"
 #include "pg/pg.h"
 
 #define RPM_FILTER_BANK_COUNT 16
@@ -33,6 +34,8 @@ typedef struct rpmFilteConfig_s
     uint16_t filter_bank_min_hz[RPM_FILTER_BANK_COUNT];         // Filter minimum frequency
     uint16_t filter_bank_max_hz[RPM_FILTER_BANK_COUNT];         // Filter maximum frequency
 
+    uint8_t  filter_fast_update;                                // Update all banks every loop from the phasor table
+
 } rpmFilterConfig_t;
 
 
@@ -40,4 +43,9 @@ PG_DECLARE(rpmFilterConfig_t, rpmFilterConfig);
 
 void  rpmFilterInit(const rpmFilterConfig_t *config);
 float rpmFilterGyro(int axis, float values);
-void  rpmFilterUpdate();
+void  rpmFilterGyroAxes(float *values);
+void  rpmFilterUpdate(timeUs_t currentTimeUs);
+
+#ifdef UNIT_TEST
+void  rpmFilterGetNotchCoeffs(int bank, float *b0, float *b1, float *a2);
+#endif
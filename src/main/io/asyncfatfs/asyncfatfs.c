@@ -261,8 +261,10 @@ typedef enum {
 
 typedef struct afatfsAppendSupercluster_t {
     uint32_t previousCluster;
+    uint32_t superclusterCount;
     uint32_t fatRewriteStartCluster;
     uint32_t fatRewriteEndCluster;
+    afatfsFileCallback_t callback; // Optional, called when a reservation completes
     afatfsAppendSuperclusterPhase_e phase;
 } afatfsAppendSupercluster_t;
 
@@ -329,8 +331,24 @@ typedef struct afatfsDeleteFile_t {
     afatfsCallback_t callback;
 } afatfsUnlinkFile_t;
 
+typedef enum {
+    AFATFS_CLOSE_FILE_INITIAL = 0,
+#ifdef AFATFS_USE_FREEFILE
+    AFATFS_CLOSE_FILE_TERMINATE_FAT_CHAIN = 0,
+    AFATFS_CLOSE_FILE_CHAIN_TO_FREEFILE,
+    AFATFS_CLOSE_FILE_PREPEND_TO_FREEFILE,
+#endif
+    AFATFS_CLOSE_FILE_UPDATE_DIRECTORY
+} afatfsCloseFilePhase_e;
+
 typedef struct afatfsCloseFile_t {
     afatfsCallback_t callback;
+#ifdef AFATFS_USE_FREEFILE
+    uint32_t releaseStartCluster; // First unused supercluster of a contiguous file to give back to the freefile
+    uint32_t releaseEndCluster;
+    uint32_t fatRewriteCluster; // Used to mark progress
+#endif
+    afatfsCloseFilePhase_e phase;
 } afatfsCloseFile_t;
 
 typedef enum {
@@ -1668,7 +1686,7 @@ uint32_t afatfs_superClusterSize(void)
 }
 
 /**
- * Continue to attempt to add a supercluster to the end of the given file.
+ * Continue to attempt to add superclusters to the end of the given file.
  *
  * If the file operation was set to AFATFS_FILE_OPERATION_APPEND_SUPERCLUSTER and the operation completes, the file's
  * operation is cleared.
@@ -1686,13 +1704,13 @@ static afatfsOperationStatus_e afatfs_appendSuperclusterContinue(afatfsFile_t *f
     doMore:
     switch (opState->phase) {
         case AFATFS_APPEND_SUPERCLUSTER_PHASE_INIT:
-            // Our file steals the first cluster of the freefile
+            // Our file steals the first clusters of the freefile
 
             // We can go ahead and write to that space before the FAT and directory are updated
             file->cursorCluster = afatfs.freeFile.firstCluster;
-            file->physicalSize += afatfs_superClusterSize();
+            file->physicalSize += opState->superclusterCount * afatfs_superClusterSize();
 
-            /* Remove the first supercluster from the freefile
+            /* Remove the first superclusters from the freefile
              *
              * Even if the freefile becomes empty, we still don't set its first cluster to zero. This is so that
              * afatfs_fileGetNextCluster() can tell where a contiguous file ends (at the start of the freefile).
@@ -1700,13 +1718,13 @@ static afatfsOperationStatus_e afatfs_appendSuperclusterContinue(afatfsFile_t *f
              * Note that normally the freefile can't become empty because it is allocated as a non-integer number
              * of superclusters to avoid precisely this situation.
              */
-            afatfs.freeFile.firstCluster += afatfs_fatEntriesPerSector();
-            afatfs.freeFile.logicalSize -= afatfs_superClusterSize();
-            afatfs.freeFile.physicalSize -= afatfs_superClusterSize();
+            afatfs.freeFile.firstCluster += opState->superclusterCount * afatfs_fatEntriesPerSector();
+            afatfs.freeFile.logicalSize -= opState->superclusterCount * afatfs_superClusterSize();
+            afatfs.freeFile.physicalSize -= opState->superclusterCount * afatfs_superClusterSize();
 
-            // The new supercluster needs to have its clusters chained contiguously and marked with a terminator at the end
+            // The new superclusters need to have their clusters chained contiguously and marked with a terminator at the end
             opState->fatRewriteStartCluster = file->cursorCluster;
-            opState->fatRewriteEndCluster = opState->fatRewriteStartCluster + afatfs_fatEntriesPerSector();
+            opState->fatRewriteEndCluster = afatfs.freeFile.firstCluster;
 
             if (opState->previousCluster == 0) {
                 // This is the new first cluster in the file so we need to update the directory entry
@@ -1747,14 +1765,18 @@ static afatfsOperationStatus_e afatfs_appendSuperclusterContinue(afatfsFile_t *f
 
     if ((status == AFATFS_OPERATION_FAILURE || status == AFATFS_OPERATION_SUCCESS) && file->operation.operation == AFATFS_FILE_OPERATION_APPEND_SUPERCLUSTER) {
         file->operation.operation = AFATFS_FILE_OPERATION_NONE;
+
+        if (opState->callback) {
+            opState->callback(status == AFATFS_OPERATION_SUCCESS ? file : NULL);
+        }
     }
 
     return status;
 }
 
 /**
- * Attempt to queue up an operation to append the first supercluster of the freefile to the given `file` (file's cursor
- * must be at end-of-file).
+ * Attempt to queue up an operation to append the first `superclusterCount` superclusters of the freefile to the given
+ * `file` (file's cursor must be at end-of-file). Fewer are appended if the freefile is smaller than that.
  *
  * The new cluster number will be set into the file's cursorCluster.
  *
@@ -1765,7 +1787,7 @@ static afatfsOperationStatus_e afatfs_appendSuperclusterContinue(afatfsFile_t *f
  *     AFATFS_OPERATION_FAILURE     - Operation could not be queued (file was busy) or append failed (filesystem is full).
  *                                    Check afatfs.fileSystemFull
  */
-static afatfsOperationStatus_e afatfs_appendSupercluster(afatfsFilePtr_t file)
+static afatfsOperationStatus_e afatfs_appendSupercluster(afatfsFilePtr_t file, uint32_t superclusterCount, afatfsFileCallback_t callback)
 {
     uint32_t superClusterSize = afatfs_superClusterSize();
 
@@ -1773,7 +1795,9 @@ static afatfsOperationStatus_e afatfs_appendSupercluster(afatfsFilePtr_t file)
         return AFATFS_OPERATION_IN_PROGRESS;
     }
 
-    if (afatfs.freeFile.logicalSize < superClusterSize) {
+    superclusterCount = MIN(superclusterCount, afatfs.freeFile.logicalSize / superClusterSize);
+
+    if (superclusterCount == 0) {
         afatfs.filesystemFull = true;
     }
 
@@ -1786,6 +1810,8 @@ static afatfsOperationStatus_e afatfs_appendSupercluster(afatfsFilePtr_t file)
     file->operation.operation = AFATFS_FILE_OPERATION_APPEND_SUPERCLUSTER;
     opState->phase = AFATFS_APPEND_SUPERCLUSTER_PHASE_INIT;
     opState->previousCluster = file->cursorPreviousCluster;
+    opState->superclusterCount = superclusterCount;
+    opState->callback = callback;
 
     return afatfs_appendSuperclusterContinue(file);
 }
@@ -1803,7 +1829,7 @@ static afatfsOperationStatus_e afatfs_appendFreeCluster(afatfsFilePtr_t file)
 #ifdef AFATFS_USE_FREEFILE
     if ((file->mode & AFATFS_FILE_MODE_CONTIGUOUS) != 0) {
         // Steal the first cluster from the beginning of the freefile if we can
-        status = afatfs_appendSupercluster(file);
+        status = afatfs_appendSupercluster(file, 1, NULL);
     } else
 #endif
     {
@@ -1918,11 +1944,13 @@ static uint8_t* afatfs_fileLockCursorSectorForWrite(afatfsFilePtr_t file)
             cacheFlags |= AFATFS_CACHE_READ;
         }
 
-        // In contiguous append mode, we'll pre-erase the whole supercluster
+        /*
+         * In contiguous append mode, we'll pre-erase everything up to the end of the allocation. That is the rest of
+         * the supercluster, or all of the space reserved with afatfs_freserve(), which the card can then take as one
+         * long multiple block write.
+         */
         if ((file->mode & (AFATFS_FILE_MODE_APPEND | AFATFS_FILE_MODE_CONTIGUOUS)) == (AFATFS_FILE_MODE_APPEND | AFATFS_FILE_MODE_CONTIGUOUS)) {
-            uint32_t cursorOffsetInSupercluster = file->cursorOffset & (afatfs_superClusterSize() - 1);
-
-            eraseBlockCount = afatfs_fatEntriesPerSector() * afatfs.sectorsPerCluster - cursorOffsetInSupercluster / AFATFS_SECTOR_SIZE;
+            eraseBlockCount = (file->physicalSize - offsetOfStartOfSector) / AFATFS_SECTOR_SIZE;
         } else {
             eraseBlockCount = 0;
         }
@@ -2141,7 +2169,7 @@ afatfsOperationStatus_e afatfs_fseek(afatfsFilePtr_t file, int32_t offset, afatf
         break;
 
         case AFATFS_SEEK_SET:
-            FALLTHROUGH;
+            ;
     }
 
     // Now we have a SEEK_SET with a positive offset. Begin by seeking to the start of the file
@@ -2568,6 +2596,37 @@ bool afatfs_ftruncate(afatfsFilePtr_t file, afatfsFileCallback_t callback)
     return true;
 }
 
+/**
+ * Queue an operation to allocate at least `size` bytes to the end of a file opened in contiguous append mode ("as"),
+ * whose cursor is at the end of its allocated space (e.g. a file that was just created). The space is taken from the
+ * start of the freefile, rounded up to whole superclusters, in one update of the FAT and directory. Writes into that
+ * space need no further FAT or directory updates, so the sectors can be streamed to the card as one long multiple
+ * block write. Any whole superclusters that are still unused are given back to the freefile by afatfs_fclose().
+ *
+ * Less space is reserved if the freefile is smaller than `size`.
+ *
+ * Returns true if the operation was queued, the callback is called with the file once the space is reserved (or NULL
+ * on failure). Returns false if the file is busy (try again later), isn't contiguous or the freefile is empty.
+ */
+bool afatfs_freserve(afatfsFilePtr_t file, uint32_t size, afatfsFileCallback_t callback)
+{
+#ifdef AFATFS_USE_FREEFILE
+    if ((file->mode & AFATFS_FILE_MODE_CONTIGUOUS) == 0 || afatfs_fileIsBusy(file) || !afatfs_isEndOfAllocatedFile(file)) {
+        return false;
+    }
+
+    uint32_t superclusterCount = (size + afatfs_superClusterSize() - 1) / afatfs_superClusterSize();
+
+    return afatfs_appendSupercluster(file, superclusterCount, callback) != AFATFS_OPERATION_FAILURE;
+#else
+    (void) file;
+    (void) size;
+    (void) callback;
+
+    return false;
+#endif
+}
+
 /**
  * Load details from the given FAT directory entry into the file.
  */
@@ -2859,6 +2918,55 @@ static void afatfs_fcloseContinue(afatfsFilePtr_t file)
     afatfsCacheBlockDescriptor_t *descriptor;
     afatfsCloseFile_t *opState = &file->operation.state.closeFile;
 
+#ifdef AFATFS_USE_FREEFILE
+    /*
+     * Give the unused superclusters at the end of a contiguous file back to the freefile. The file's chain is
+     * terminated first so the freefile never becomes cross-linked with it. The clusters being released are already
+     * chained to each other, so only the FAT sector of the last one needs to be linked on to the freefile.
+     */
+    switch (opState->phase) {
+        case AFATFS_CLOSE_FILE_TERMINATE_FAT_CHAIN:
+            if (opState->releaseStartCluster == opState->releaseEndCluster) {
+                opState->phase = AFATFS_CLOSE_FILE_UPDATE_DIRECTORY;
+                break;
+            }
+
+            if (afatfs_FATFillWithPattern(AFATFS_FAT_PATTERN_TERMINATED_CHAIN, &opState->fatRewriteCluster, opState->releaseStartCluster) != AFATFS_OPERATION_SUCCESS) {
+                return;
+            }
+
+            opState->fatRewriteCluster = opState->releaseEndCluster - afatfs_fatEntriesPerSector();
+            opState->phase = AFATFS_CLOSE_FILE_CHAIN_TO_FREEFILE;
+            FALLTHROUGH;
+        case AFATFS_CLOSE_FILE_CHAIN_TO_FREEFILE:
+            if (afatfs_FATFillWithPattern(AFATFS_FAT_PATTERN_UNTERMINATED_CHAIN, &opState->fatRewriteCluster, opState->releaseEndCluster) != AFATFS_OPERATION_SUCCESS) {
+                return;
+            }
+
+            opState->phase = AFATFS_CLOSE_FILE_PREPEND_TO_FREEFILE;
+            FALLTHROUGH;
+        case AFATFS_CLOSE_FILE_PREPEND_TO_FREEFILE:
+            if (afatfs.freeFile.firstCluster != opState->releaseStartCluster) {
+                uint32_t releaseSize = (opState->releaseEndCluster - opState->releaseStartCluster) * afatfs_clusterSize();
+
+                afatfs.freeFile.firstCluster = opState->releaseStartCluster;
+                afatfs.freeFile.logicalSize += releaseSize;
+                afatfs.freeFile.physicalSize += releaseSize;
+
+                file->physicalSize -= releaseSize;
+            }
+
+            if (afatfs_saveDirectoryEntry(&afatfs.freeFile, AFATFS_SAVE_DIRECTORY_NORMAL) != AFATFS_OPERATION_SUCCESS) {
+                return;
+            }
+
+            opState->phase = AFATFS_CLOSE_FILE_UPDATE_DIRECTORY;
+        break;
+        case AFATFS_CLOSE_FILE_UPDATE_DIRECTORY:
+        break;
+    }
+#endif
+
     /*
      * Directories don't update their parent directory entries over time, because their fileSize field in the directory
      * never changes (when we add the first cluster to the directory we save the directory entry at that point and it
@@ -2917,10 +3025,30 @@ bool afatfs_fclose(afatfsFilePtr_t file, afatfsCallback_t callback)
     } else if (afatfs_fileIsBusy(file)) {
         return false;
     } else {
+        afatfsCloseFile_t *opState = &file->operation.state.closeFile;
+
         afatfs_fileUpdateFilesize(file);
 
         file->operation.operation = AFATFS_FILE_OPERATION_CLOSE;
-        file->operation.state.closeFile.callback = callback;
+        opState->callback = callback;
+        opState->phase = AFATFS_CLOSE_FILE_INITIAL;
+
+#ifdef AFATFS_USE_FREEFILE
+        // A contiguous file ends where the freefile begins. Keep the superclusters that hold data, and at least one.
+        opState->releaseEndCluster = afatfs.freeFile.firstCluster;
+        opState->releaseStartCluster = opState->releaseEndCluster;
+
+        if ((file->mode & AFATFS_FILE_MODE_CONTIGUOUS) != 0 && file->firstCluster != 0) {
+            uint32_t keepSuperclusters = MAX((file->logicalSize + afatfs_superClusterSize() - 1) / afatfs_superClusterSize(), 1u);
+            uint32_t keepEndCluster = file->firstCluster + keepSuperclusters * afatfs_fatEntriesPerSector();
+
+            if (keepEndCluster < opState->releaseEndCluster) {
+                opState->releaseStartCluster = keepEndCluster;
+                opState->fatRewriteCluster = keepEndCluster - afatfs_fatEntriesPerSector();
+            }
+        }
+#endif
+
         afatfs_fcloseContinue(file);
         return true;
     }
@@ -65,6 +65,7 @@ typedef void (*afatfsCallback_t)(void);
 
 bool afatfs_fopen(const char *filename, const char *mode, afatfsFileCallback_t complete);
 bool afatfs_ftruncate(afatfsFilePtr_t file, afatfsFileCallback_t callback);
+bool afatfs_freserve(afatfsFilePtr_t file, uint32_t size, afatfsFileCallback_t callback);
 bool afatfs_fclose(afatfsFilePtr_t file, afatfsCallback_t callback);
 bool afatfs_funlink(afatfsFilePtr_t file, afatfsCallback_t callback);
 
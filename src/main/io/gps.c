@@ -65,6 +65,7 @@
 #define LOG_UBLOX_SVINFO 'I'
 #define LOG_UBLOX_POSLLH 'P'
 #define LOG_UBLOX_VELNED 'V'
+#define LOG_UBLOX_PVT    'T'
 
 #define GPS_SV_MAXSATS   16
 
@@ -101,6 +102,8 @@ uint8_t GPS_svinfo_cno[GPS_SV_MAXSATS];     // Carrier to Noise Ratio (Signal St
 #define GPS_BAUDRATE_CHANGE_DELAY (200)
 // Timeout for waiting ACK/NAK in GPS task cycles (0.1s at 100Hz)
 #define UBLOX_ACK_TIMEOUT_MAX_COUNT (10)
+// Bytes taken from the serial port at a time
+#define GPS_RX_BLOCK_SIZE (64)
 
 static serialPort_t *gpsPort;
 
@@ -140,7 +143,9 @@ static const uint8_t ubloxInit[] = {
     0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0xF0, 0x00, 0x00, 0xFA, 0x0F,           // GGA: Global positioning system fix data
     0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0xF0, 0x02, 0x00, 0xFC, 0x13,           // GSA: GNSS DOP and Active Satellites
     0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0xF0, 0x04, 0x00, 0xFE, 0x17,           // RMC: Recommended Minimum data
+};
 
+static const uint8_t ubloxMessages[] = {
     // Enable UBLOX messages
     0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x02, 0x01, 0x0E, 0x47,           // set POSLLH MSG rate
     0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x03, 0x01, 0x0F, 0x49,           // set STATUS MSG rate
@@ -152,6 +157,16 @@ static const uint8_t ubloxInit[] = {
     0xB5, 0x62, 0x06, 0x08, 0x06, 0x00, 0xC8, 0x00, 0x01, 0x00, 0x01, 0x00, 0xDE, 0x6A,             // set rate to 5Hz (measurement period: 200ms, navigation rate: 1 cycle)
 };
 
+// NAV-PVT alone carries all of the above but satellite info, in one message. The rate is set after.
+static const uint8_t ubloxMessagesPvt[] = {
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x02, 0x00, 0x0D, 0x46,           // disable POSLLH
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x03, 0x00, 0x0E, 0x48,           // disable STATUS
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x06, 0x00, 0x11, 0x4E,           // disable SOL
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x30, 0x00, 0x3B, 0xA2,           // disable SVINFO
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x12, 0x00, 0x1D, 0x66,           // disable VELNED
+    0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x07, 0x01, 0x13, 0x51,           // set PVT MSG rate
+};
+
 static const uint8_t ubloxAirborne[] = {
     //Preprocessor Airborne_1g Dynamic Platform Model Option
     #if defined(GPS_UBLOX_MODE_AIRBORNE_1G)
@@ -201,9 +216,16 @@ typedef struct {
     ubx_configblock configblocks[7];
 } ubx_gnss;
 
+typedef struct {
+    uint16_t measRate;
+    uint16_t navRate;
+    uint16_t timeRef;
+} ubx_rate;
+
 typedef union {
     ubx_sbas sbas;
     ubx_gnss gnss;
+    ubx_rate rate;
 } ubx_payload;
 
 typedef struct {
@@ -223,6 +245,7 @@ typedef struct {
 
 #define UBLOX_SBAS_MESSAGE_LENGTH 14
 #define UBLOX_GNSS_MESSAGE_LENGTH 66
+#define UBLOX_RATE_MESSAGE_LENGTH 12
 
 #endif // USE_GPS_UBLOX
 
@@ -239,7 +262,7 @@ typedef enum {
 gpsData_t gpsData;
 
 
-PG_REGISTER_WITH_RESET_TEMPLATE(gpsConfig_t, gpsConfig, PG_GPS_CONFIG, 0);
+PG_REGISTER_WITH_RESET_TEMPLATE(gpsConfig_t, gpsConfig, PG_GPS_CONFIG, 1);
 
 PG_RESET_TEMPLATE(gpsConfig_t, gpsConfig,
     .provider = GPS_NMEA,
@@ -250,7 +273,9 @@ PG_RESET_TEMPLATE(gpsConfig_t, gpsConfig,
     .gps_ublox_mode = UBLOX_AIRBORNE,
     .gps_set_home_point_once = false,
     .gps_use_3d_speed = false,
-    .sbas_integrity = false
+    .sbas_integrity = false,
+    .gps_ublox_nav_pvt = false,
+    .gps_ublox_rate_hz = 10
 );
 
 static void shiftPacketLog(void)
@@ -263,11 +288,14 @@ static void shiftPacketLog(void)
 }
 
 static void gpsNewData(uint16_t c);
+static void gpsNewDataBlock(const uint8_t *data, int count);
+static void gpsNewFrameParsed(void);
 #ifdef USE_GPS_NMEA
 static bool gpsNewFrameNMEA(char c);
 #endif
 #ifdef USE_GPS_UBLOX
 static bool gpsNewFrameUBLOX(uint8_t data);
+static bool gpsNewFrameUBLOXBlock(const uint8_t *data, int count, int *used);
 #endif
 
 static void gpsSetState(gpsState_e state)
@@ -463,6 +491,9 @@ void gpsInitUblox(void)
             }
 
             if (gpsData.messageState == GPS_MESSAGE_STATE_INIT) {
+                const uint8_t *messages = gpsConfig()->gps_ublox_nav_pvt ? ubloxMessagesPvt : ubloxMessages;
+                const uint32_t messagesSize = gpsConfig()->gps_ublox_nav_pvt ? sizeof(ubloxMessagesPvt) : sizeof(ubloxMessages);
+
                 if (gpsData.state_position < sizeof(ubloxInit)) {
                     if (gpsData.state_position < sizeof(ubloxAirborne)) {
                         if (gpsConfig()->gps_ublox_mode == UBLOX_AIRBORNE) {
@@ -474,6 +505,9 @@ void gpsInitUblox(void)
                         serialWrite(gpsPort, ubloxInit[gpsData.state_position]);
                     }
                     gpsData.state_position++;
+                } else if (gpsData.state_position < sizeof(ubloxInit) + messagesSize) {
+                    serialWrite(gpsPort, messages[gpsData.state_position - sizeof(ubloxInit)]);
+                    gpsData.state_position++;
                 } else {
                     gpsData.state_position = 0;
                     gpsData.messageState++;
@@ -633,6 +667,48 @@ void gpsInitUblox(void)
                 }
             }
 
+            if (gpsData.messageState == GPS_MESSAGE_STATE_RATE) {
+                // The legacy message set is sent with a fixed 5Hz rate
+                if (!gpsConfig()->gps_ublox_nav_pvt) {
+                    gpsData.messageState++;
+                }
+            }
+
+            if (gpsData.messageState == GPS_MESSAGE_STATE_RATE) {
+                switch (gpsData.ackState) {
+                    case UBLOX_ACK_IDLE:
+                        {
+                            ubx_message tx_buffer;
+                            tx_buffer.header.preamble1 = 0xB5;
+                            tx_buffer.header.preamble2 = 0x62;
+                            tx_buffer.header.msg_class = 0x06;
+                            tx_buffer.header.msg_id = 0x08;
+                            tx_buffer.header.length = 6;
+
+                            tx_buffer.payload.rate.measRate = 1000 / constrain(gpsConfig()->gps_ublox_rate_hz, GPS_UBLOX_RATE_MIN, GPS_UBLOX_RATE_MAX);
+                            tx_buffer.payload.rate.navRate = 1;
+                            tx_buffer.payload.rate.timeRef = 1;     //GPS time
+
+                            ubloxSendConfigMessage((const uint8_t *) &tx_buffer, UBLOX_RATE_MESSAGE_LENGTH);
+                        }
+                        break;
+                    case UBLOX_ACK_WAITING:
+                        if ((++gpsData.ackTimeoutCounter) == UBLOX_ACK_TIMEOUT_MAX_COUNT) {
+                            gpsData.ackState = UBLOX_ACK_GOT_TIMEOUT;
+                        }
+                        break;
+                    case UBLOX_ACK_GOT_TIMEOUT:
+                    case UBLOX_ACK_GOT_NACK:
+                    case UBLOX_ACK_GOT_ACK:
+                        gpsData.state_position = 0;
+                        gpsData.ackState = UBLOX_ACK_IDLE;
+                        gpsData.messageState++;
+                        break;
+                    default:
+                        break;
+                }
+            }
+
             if (gpsData.messageState >= GPS_MESSAGE_STATE_INITIALIZED) {
                 // ublox should be initialised, try receiving
                 gpsSetState(GPS_RECEIVING_DATA);
@@ -674,8 +750,11 @@ void gpsUpdate(timeUs_t currentTimeUs)
 {
     // read out available GPS bytes
     if (gpsPort) {
-        while (serialRxBytesWaiting(gpsPort))
-            gpsNewData(serialRead(gpsPort));
+        uint8_t block[GPS_RX_BLOCK_SIZE];
+        int count;
+        while ((count = serialReadBuf(gpsPort, block, sizeof(block))) > 0) {
+            gpsNewDataBlock(block, count);
+        }
     } else if (GPS_update & GPS_MSP_UPDATE) { // GPS data received via MSP
         gpsSetState(GPS_RECEIVING_DATA);
         gpsData.lastMessage = millis();
@@ -751,10 +830,37 @@ void gpsUpdate(timeUs_t currentTimeUs)
 
 static void gpsNewData(uint16_t c)
 {
-    if (!gpsNewFrame(c)) {
-        return;
+    if (gpsNewFrame(c)) {
+        gpsNewFrameParsed();
     }
+}
 
+static void gpsNewDataBlock(const uint8_t *data, int count)
+{
+    while (count > 0) {
+        int used = 1;
+        bool parsed;
+
+#ifdef USE_GPS_UBLOX
+        if (gpsConfig()->provider == GPS_UBLOX) {
+            parsed = gpsNewFrameUBLOXBlock(data, count, &used);
+        } else
+#endif
+        {
+            parsed = gpsNewFrame(*data);
+        }
+
+        if (parsed) {
+            gpsNewFrameParsed();
+        }
+
+        data += used;
+        count -= used;
+    }
+}
+
+static void gpsNewFrameParsed(void)
+{
     // new data received and parsed, we're in business
     gpsData.lastLastMessage = gpsData.lastMessage;
     gpsData.lastMessage = millis();
@@ -1147,6 +1253,38 @@ typedef struct {
     uint32_t heading_accuracy;
 } ubx_nav_velned;
 
+typedef struct {
+    uint32_t time;              // GPS msToW
+    uint16_t year;              // UTC
+    uint8_t month;
+    uint8_t day;
+    uint8_t hour;
+    uint8_t min;
+    uint8_t sec;
+    uint8_t valid;
+    uint32_t time_accuracy;
+    int32_t nano;
+    uint8_t fix_type;
+    uint8_t flags;
+    uint8_t flags2;
+    uint8_t satellites;
+    int32_t longitude;
+    int32_t latitude;
+    int32_t altitude_ellipsoid;
+    int32_t altitudeMslMm;
+    uint32_t horizontal_accuracy;
+    uint32_t vertical_accuracy;
+    int32_t ned_north;          // mm/s
+    int32_t ned_east;
+    int32_t ned_down;
+    int32_t speed_2d;
+    int32_t heading_2d;         // deg * 100000
+    uint32_t speed_accuracy;
+    uint32_t heading_accuracy;
+    uint16_t position_DOP;
+    uint8_t res[6];             // u-blox 7 ends here, u-blox 8 and later add vehicle heading
+} ubx_nav_pvt;
+
 typedef struct {
     uint8_t chn;                // Channel number, 255 for SVx not assigned to channel
     uint8_t svid;               // Satellite ID
@@ -1182,6 +1320,7 @@ enum {
     MSG_POSLLH = 0x2,
     MSG_STATUS = 0x3,
     MSG_SOL = 0x6,
+    MSG_PVT = 0x7,
     MSG_VELNED = 0x12,
     MSG_SVINFO = 0x30,
     MSG_CFG_PRT = 0x00,
@@ -1205,6 +1344,16 @@ enum {
     NAV_STATUS_TIME_SECOND_VALID = 8
 } ubx_nav_status_bits;
 
+enum {
+    NAV_PVT_VALID_DATE = 1,
+    NAV_PVT_VALID_TIME = 2,
+    NAV_PVT_FULLY_RESOLVED = 4
+} ubx_nav_pvt_valid_bits;
+
+enum {
+    NAV_PVT_FIX_OK = 1
+} ubx_nav_pvt_flags_bits;
+
 // Packet checksum accumulators
 static uint8_t _ck_a;
 static uint8_t _ck_b;
@@ -1248,6 +1397,7 @@ static union {
     ubx_nav_status status;
     ubx_nav_solution solution;
     ubx_nav_velned velned;
+    ubx_nav_pvt pvt;
     ubx_nav_svinfo svinfo;
     ubx_ack ack;
     uint8_t bytes[UBLOX_PAYLOAD_SIZE];
@@ -1312,6 +1462,43 @@ static bool UBLOX_parse_gps(void)
         gpsSol.groundCourse = (uint16_t) (_buffer.velned.heading_2d / 10000);     // Heading 2D deg * 100000 rescaled to deg * 10
         _new_speed = true;
         break;
+    case MSG_PVT:
+        *gpsPacketLogChar = LOG_UBLOX_PVT;
+        if (_payload_length < sizeof(ubx_nav_pvt)) {
+            return false;
+        }
+        next_fix = (_buffer.pvt.flags & NAV_PVT_FIX_OK) && (_buffer.pvt.fix_type == FIX_3D);
+        if (next_fix) {
+            ENABLE_STATE(GPS_FIX);
+        } else {
+            DISABLE_STATE(GPS_FIX);
+        }
+        gpsSol.llh.lon = _buffer.pvt.longitude;
+        gpsSol.llh.lat = _buffer.pvt.latitude;
+        gpsSol.llh.altCm = _buffer.pvt.altitudeMslMm / 10;  //alt in cm
+        gpsSol.numSat = _buffer.pvt.satellites;
+        gpsSol.hdop = _buffer.pvt.position_DOP;
+        gpsSol.groundSpeed = _buffer.pvt.speed_2d / 10;    // cm/s
+        gpsSol.speed3d = sqrtf(sq((float)_buffer.pvt.speed_2d) + sq((float)_buffer.pvt.ned_down)) / 10;   // cm/s
+        gpsSol.groundCourse = (uint16_t) (_buffer.pvt.heading_2d / 10000);     // Heading 2D deg * 100000 rescaled to deg * 10
+#ifdef USE_RTC_TIME
+        //set clock, when gps time is available
+        if (!rtcHasTime() && (_buffer.pvt.valid & NAV_PVT_VALID_DATE) && (_buffer.pvt.valid & NAV_PVT_VALID_TIME)) {
+            dateTime_t temp_time;
+            temp_time.year = _buffer.pvt.year;
+            temp_time.month = _buffer.pvt.month;
+            temp_time.day = _buffer.pvt.day;
+            temp_time.hours = _buffer.pvt.hour;
+            temp_time.minutes = _buffer.pvt.min;
+            temp_time.seconds = _buffer.pvt.sec;
+            temp_time.millis = MAX(_buffer.pvt.nano, 0) / 1000000;
+            rtcSetDateTime(&temp_time);
+        }
+#endif
+        // Position and speed of the same solution
+        _new_position = true;
+        _new_speed = true;
+        break;
     case MSG_SVINFO:
         *gpsPacketLogChar = LOG_UBLOX_SVINFO;
         GPS_numCh = _buffer.svinfo.numCh;
@@ -1439,6 +1626,42 @@ static bool gpsNewFrameUBLOX(uint8_t data)
     }
     return parsed;
 }
+
+// Skips to the next frame and takes payloads in runs, the rest a byte at a time as above
+static bool gpsNewFrameUBLOXBlock(const uint8_t *data, int count, int *used)
+{
+    *used = 1;
+
+    switch (_step) {
+        case 0:
+            if (data[0] != PREAMBLE1) {
+                const uint8_t *next = memchr(data, PREAMBLE1, count);
+                *used = next ? next - data : count;
+                return false;
+            }
+            break;
+        case 6:
+            {
+                const int run = MIN(count, _payload_length - _payload_counter);
+                for (int i = 0; i < run; i++) {
+                    _ck_b += (_ck_a += data[i]);
+                    if (_payload_counter < UBLOX_PAYLOAD_SIZE) {
+                        _buffer.bytes[_payload_counter] = data[i];
+                    }
+                    _payload_counter++;
+                }
+                if (_payload_counter >= _payload_length) {
+                    _step++;
+                }
+                *used = run;
+            }
+            return false;
+        default:
+            break;
+    }
+
+    return gpsNewFrameUBLOX(*data);
+}
 #endif // USE_GPS_UBLOX
 
 static void gpsHandlePassthrough(uint8_t data)
@@ -83,6 +83,9 @@ typedef enum {
 
 #define GPS_BAUDRATE_MAX GPS_BAUDRATE_9600
 
+#define GPS_UBLOX_RATE_MIN 1
+#define GPS_UBLOX_RATE_MAX 25
+
 typedef struct gpsConfig_s {
     gpsProvider_e provider;
     sbasMode_e sbasMode;
@@ -93,6 +96,8 @@ typedef struct gpsConfig_s {
     uint8_t gps_set_home_point_once;
     uint8_t gps_use_3d_speed;
     uint8_t sbas_integrity;
+    uint8_t gps_ublox_nav_pvt;      // configure UBX NAV-PVT as the only message
+    uint8_t gps_ublox_rate_hz;      // navigation rate with NAV-PVT
 } gpsConfig_t;
 
 PG_DECLARE(gpsConfig_t, gpsConfig);
@@ -123,6 +128,7 @@ typedef enum {
     GPS_MESSAGE_STATE_INIT,
     GPS_MESSAGE_STATE_SBAS,
     GPS_MESSAGE_STATE_GNSS,
+    GPS_MESSAGE_STATE_RATE,
     GPS_MESSAGE_STATE_INITIALIZED,
     GPS_MESSAGE_STATE_PEDESTRIAN_TO_AIRBORNE,
     GPS_MESSAGE_STATE_ENTRY_COUNT
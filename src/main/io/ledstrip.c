@@ -79,6 +79,7 @@
 
 static bool ledStripEnabled = false;
 static uint8_t previousProfileColorIndex = COLOR_UNDEFINED;
+static bool baseLayersValid = false;
 
 #define HZ_TO_US(hz) ((int32_t)((1000 * 1000) / (hz)))
 
@@ -274,6 +275,8 @@ void reevaluateLedConfig(void)
     updateDimensions();
     updateLedRingCounts();
     updateRequiredOverlay();
+
+    baseLayersValid = false;
 }
 
 // get specialColor by index
@@ -881,9 +884,14 @@ typedef enum {
     timTimerCount
 } timId_e;
 
+// Layers below this one are composed onto the fixed layers and kept
+#define timBaseLayerCount timIndicator
+
 static timeUs_t timerVal[timTimerCount];
 static uint16_t disabledTimerMask;
 
+static hsvColor_t baseLayerColors[LED_MAX_STRIP_LENGTH];
+
 STATIC_ASSERT(timTimerCount <= sizeof(disabledTimerMask) * 8, disabledTimerMask_too_small);
 
 // function to apply layer.
@@ -948,8 +956,27 @@ static void applyStatusProfile(timeUs_t now) {
     if (!timActive)
         return;          // no change this update, keep old state
 
-    applyLedFixedLayers();
-    for (timId_e timId = 0; timId < ARRAYLEN(layerTable); timId++) {
+    // The layers above are drawn over whatever is below them, but when only they
+    // fired the fixed and base layers are restored rather than composed again
+    timId_e timId = 0;
+    if (!baseLayersValid || (timActive & ((1 << timBaseLayerCount) - 1))) {
+        applyLedFixedLayers();
+        for (; timId < timBaseLayerCount; timId++) {
+            uint32_t *timer = &timerVal[timId];
+            bool updateNow = timActive & (1 << timId);
+            (*layerTable[timId])(updateNow, timer);
+        }
+        for (int ledIndex = 0; ledIndex < ledCounts.count; ledIndex++) {
+            getLedHsv(ledIndex, &baseLayerColors[ledIndex]);
+        }
+        baseLayersValid = true;
+    } else {
+        for (int ledIndex = 0; ledIndex < ledCounts.count; ledIndex++) {
+            setLedHsv(ledIndex, &baseLayerColors[ledIndex]);
+        }
+        timId = timBaseLayerCount;
+    }
+    for (; timId < ARRAYLEN(layerTable); timId++) {
         uint32_t *timer = &timerVal[timId];
         bool updateNow = timActive & (1 << timId);
         (*layerTable[timId])(updateNow, timer);
@@ -1041,6 +1068,7 @@ void ledStripDisable(void)
 {
     ledStripEnabled = false;
     previousProfileColorIndex = COLOR_UNDEFINED;
+    baseLayersValid = false;
 
     setStripColor(&HSV(BLACK));
     ws2811UpdateStrip((ledStripFormatRGB_e)ledStripConfig()->ledstrip_grb_rgb);
@@ -1119,6 +1147,7 @@ static void applySimpleProfile(timeUs_t currentTimeUs)
         setStripColor(&hsv[colorIndex]);
         ws2811UpdateStrip((ledStripFormatRGB_e)ledStripConfig()->ledstrip_grb_rgb);
         previousProfileColorIndex = colorIndex;
+        baseLayersValid = false;
         colorUpdateTimeUs = currentTimeUs + PROFILE_COLOR_UPDATE_INTERVAL_US;
     }
 }
@@ -1721,10 +1721,12 @@ static bool mspProcessOutCommand(int16_t cmdMSP, sbuf_t *dst)
 #endif
 
         break;
+#ifdef USE_RPM_FILTER
     case MSP_RPM_FILTER:
         sbufWriteData(dst, rpmFilterConfig(), sizeof(rpmFilterConfig_t));
 
         break;
+#endif
     case MSP_PID_ADVANCED:
         sbufWriteU16(dst, 0);
         sbufWriteU16(dst, 0);
@@ -1976,6 +1978,45 @@ static mspResult_e mspFcProcessOutCommandWithArg(mspDescriptor_t srcDesc, int16_
         }
         break;
 
+    case MSP2_BETAFLIGHT_SUBSCRIBE:
+        {
+            // u16 interval in ms, then the u16 commands
+            if (sbufBytesRemaining(src) < 2) {
+                return MSP_RESULT_ERROR;
+            }
+            const uint16_t intervalMs = sbufReadU16(src);
+
+            uint16_t cmds[MSP_SUBSCRIPTION_MAX];
+            uint8_t count = 0;
+            int frameSize = 0;
+
+            // Only plain replies that fit the frame together are taken
+            while (sbufBytesRemaining(src) >= 2 && count < MSP_SUBSCRIPTION_MAX) {
+                const uint16_t subCmd = sbufReadU16(src);
+                uint8_t *start = dst->ptr;
+                mspPostProcessFnPtr postFn = NULL;
+
+                const bool plain = (mspCommonProcessOutCommand(subCmd, dst, &postFn) || mspProcessOutCommand(subCmd, dst)) && !postFn;
+                const int size = dst->ptr - start;
+                dst->ptr = start;
+
+                if (plain && frameSize + MSP_SUBSCRIPTION_ENTRY_HEADER + size <= MSP_SUBSCRIPTION_FRAME_SIZE) {
+                    cmds[count++] = subCmd;
+                    frameSize += MSP_SUBSCRIPTION_ENTRY_HEADER + size;
+                }
+            }
+
+            if (!mspSerialSubscribe(srcDesc, intervalMs, cmds, count)) {
+                return MSP_RESULT_ERROR;
+            }
+
+            sbufWriteU8(dst, count);
+            for (int i = 0; i < count; i++) {
+                sbufWriteU16(dst, cmds[i]);
+            }
+        }
+        break;
+
     case MSP_RESET_CONF:
         {
 #if defined(USE_CUSTOM_DEFAULTS)
@@ -2009,6 +2050,28 @@ static mspResult_e mspFcProcessOutCommandWithArg(mspDescriptor_t srcDesc, int16_
         }
 
         break;
+
+#if defined(USE_SCHEDULER_TRACE)
+    case MSP_SCHEDULER_TRACE:
+        {
+            const int count = schedulerTraceCount();
+            int index = sbufBytesRemaining(src) >= 2 ? sbufReadU16(src) : 0;
+
+            sbufWriteU8(dst, schedulerTraceIsRunning());
+            sbufWriteU16(dst, count);
+            sbufWriteU16(dst, index);
+
+            // As many events from index as fit, keeping one byte for the checksum
+            schedulerTraceEvent_t event;
+            while (sbufBytesRemaining(dst) > 8 && schedulerTraceGetEvent(index++, &event)) {
+                sbufWriteU32(dst, event.startUs);
+                sbufWriteU16(dst, event.durationUs);
+                sbufWriteU8(dst, event.taskId);
+                sbufWriteU8(dst, event.flags);
+            }
+        }
+        break;
+#endif
     default:
         return MSP_RESULT_CMD_UNKNOWN;
     }
@@ -2516,10 +2579,13 @@ static mspResult_e mspProcessInCommand(mspDescriptor_t srcDesc, int16_t cmdMSP,
         pidInitFilters(currentPidProfile);
 
         break;
+#ifdef USE_RPM_FILTER
     case MSP_SET_RPM_FILTER:
-        sbufReadData(src, rpmFilterConfigMutable(), sizeof(rpmFilterConfig_t));
+        // Older clients do not send the trailing fields
+        sbufReadData(src, rpmFilterConfigMutable(), MIN(sizeof(rpmFilterConfig_t), (size_t)sbufBytesRemaining(src)));
 
         break;
+#endif
     case MSP_SET_PID_ADVANCED:
         sbufReadU16(src);
         sbufReadU16(src);
@@ -2770,6 +2836,16 @@ static mspResult_e mspProcessInCommand(mspDescriptor_t srcDesc, int16_t cmdMSP,
         mixerOverride[i] = sbufReadU16(src);
         break;
 
+#if defined(USE_SCHEDULER_TRACE)
+    case MSP_SET_SCHEDULER_TRACE:
+        if (sbufReadU8(src)) {
+            schedulerTraceStart(sbufBytesRemaining(src) >= 2 ? sbufReadU16(src) : 0);
+        } else {
+            schedulerTraceStop();
+        }
+        break;
+#endif
+
     case MSP_SET_RX_CONFIG:
         rxConfigMutable()->serialrx_provider = sbufReadU8(src);
         rxConfigMutable()->maxcheck = sbufReadU16(src);
@@ -352,3 +352,5 @@
 #define MSP_SET_SERVO_OVERRIDE   147    //in message          Sets servo output override
 #define MSP_MIXER_OVERRIDE       148    //out message         Gets mixer input override values
 #define MSP_SET_MIXER_OVERRIDE   149    //in message          Sets mixer input override
+#define MSP_SCHEDULER_TRACE      151    //out message         Gets scheduler trace events, starting at the index given
+#define MSP_SET_SCHEDULER_TRACE  152    //in message          Starts or stops the scheduler trace
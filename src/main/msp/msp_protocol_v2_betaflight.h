@@ -19,3 +19,5 @@
  */
 
 #define MSP2_BETAFLIGHT_BIND            0x3000
+#define MSP2_BETAFLIGHT_SUBSCRIBE       0x3001    //in message          Push replies to a set of commands periodically
+#define MSP2_BETAFLIGHT_TELEMETRY       0x3002    //out message         Packed replies of the subscribed commands
@@ -31,17 +31,22 @@
 #include "common/streambuf.h"
 #include "common/utils.h"
 #include "common/crc.h"
+#include "common/maths.h"
 
 #include "drivers/system.h"
 
 #include "io/displayport_msp.h"
 
 #include "msp/msp.h"
+#include "msp/msp_protocol_v2_betaflight.h"
 
 #include "msp_serial.h"
 
 static mspPort_t mspPorts[MAX_MSP_PORT_COUNT];
 
+// Replies are rendered here, one at a time
+static uint8_t outBuf[MSP_PORT_OUTBUF_SIZE];
+
 static void resetMspPort(mspPort_t *mspPortToReset, serialPort_t *serialPort, bool sharedWithTelemetry)
 {
     memset(mspPortToReset, 0, sizeof(mspPort_t));
@@ -393,8 +398,6 @@ static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet, mspVersion_e msp
 
 static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
 {
-    static uint8_t outBuf[MSP_PORT_OUTBUF_SIZE];
-
     mspPacket_t reply = {
         .buf = { .ptr = outBuf, .end = ARRAYEND(outBuf), },
         .cmd = -1,
@@ -483,6 +486,72 @@ static void mspSerialProcessReceivedReply(mspPort_t *msp, mspProcessReplyFnPtr m
     msp->c_state = MSP_IDLE;
 }
 
+/*
+ * Pushes the replies to the subscribed commands in one frame. Replies
+ * that would not fit are left out, and if the transmit buffer has no
+ * room for the frame this period is skipped. Nothing waits for the port.
+ */
+static void mspSerialPushSubscription(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
+{
+    static uint8_t frameBuf[MSP_SUBSCRIPTION_FRAME_SIZE];
+
+    mspSubscription_t *sub = &msp->subscription;
+    const timeMs_t now = millis();
+
+    if (cmp32(now, sub->lastPushMs + sub->intervalMs) < 0) {
+        return;
+    }
+
+    // Keep the rate unless the task has fallen a whole interval behind
+    sub->lastPushMs += sub->intervalMs;
+    if (cmp32(now, sub->lastPushMs + sub->intervalMs) >= 0) {
+        sub->lastPushMs = now;
+    }
+
+    sbuf_t frame = { .ptr = frameBuf, .end = ARRAYEND(frameBuf), };
+
+    for (int i = 0; i < sub->count; i++) {
+        mspPacket_t reply = {
+            .buf = { .ptr = outBuf, .end = ARRAYEND(outBuf), },
+            .cmd = -1,
+            .flags = 0,
+            .result = 0,
+            .direction = MSP_DIRECTION_REPLY,
+        };
+        mspPacket_t command = {
+            .buf = { .ptr = msp->inBuf, .end = msp->inBuf, },
+            .cmd = sub->cmd[i],
+            .flags = 0,
+            .result = 0,
+            .direction = MSP_DIRECTION_REQUEST,
+        };
+
+        mspPostProcessFnPtr mspPostProcessFn = NULL;
+        if (mspProcessCommandFn(msp->descriptor, &command, &reply, &mspPostProcessFn) != MSP_RESULT_ACK) {
+            continue;
+        }
+
+        const int size = reply.buf.ptr - outBuf;
+        if (size > UINT8_MAX || sbufBytesRemaining(&frame) < MSP_SUBSCRIPTION_ENTRY_HEADER + size) {
+            continue;
+        }
+
+        sbufWriteU16(&frame, sub->cmd[i]);
+        sbufWriteU8(&frame, size);
+        sbufWriteData(&frame, outBuf, size);
+    }
+
+    mspPacket_t push = {
+        .buf = { .ptr = frameBuf, .end = frame.ptr, },
+        .cmd = MSP2_BETAFLIGHT_TELEMETRY,
+        .flags = 0,
+        .result = 0,
+        .direction = MSP_DIRECTION_REPLY,
+    };
+
+    mspSerialEncode(msp, &push, MSP_V2_NATIVE);
+}
+
 /*
  * Process MSP commands from serial ports configured as MSP ports.
  *
@@ -530,6 +599,10 @@ void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessComm
         } else {
             mspProcessPendingRequest(mspPort);
         }
+
+        if (mspPort->subscription.count && mspPort->port) {
+            mspSerialPushSubscription(mspPort, mspProcessCommandFn);
+        }
     }
 }
 
@@ -602,3 +675,29 @@ uint32_t mspSerialTxBytesFree(void)
 
     return ret;
 }
+
+/*
+ * Replaces the subscription of the port the command came from. The
+ * commands must have been checked to be plain replies. No commands or
+ * no interval ends the subscription.
+ */
+bool mspSerialSubscribe(mspDescriptor_t descriptor, uint16_t intervalMs, const uint16_t *cmd, uint8_t count)
+{
+    for (int portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
+        mspPort_t * const mspPort = &mspPorts[portIndex];
+        if (!mspPort->port || mspPort->descriptor != descriptor) {
+            continue;
+        }
+
+        mspSubscription_t *sub = &mspPort->subscription;
+
+        sub->count = (intervalMs > 0) ? MIN(count, MSP_SUBSCRIPTION_MAX) : 0;
+        sub->intervalMs = intervalMs;
+        sub->lastPushMs = millis() - intervalMs;
+        memcpy(sub->cmd, cmd, sub->count * sizeof(sub->cmd[0]));
+
+        return true;
+    }
+
+    return false;
+}
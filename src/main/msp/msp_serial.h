@@ -97,6 +97,20 @@ typedef struct __attribute__((packed)) {
 
 #define MSP_MAX_HEADER_SIZE     9
 
+// Commands a client can subscribe to on one port
+#define MSP_SUBSCRIPTION_MAX            16
+// Payload of a pushed MSP2_BETAFLIGHT_TELEMETRY frame
+#define MSP_SUBSCRIPTION_FRAME_SIZE     250
+// Per command in the frame: u16 command, u8 size, then the reply
+#define MSP_SUBSCRIPTION_ENTRY_HEADER   3
+
+typedef struct mspSubscription_s {
+    uint16_t cmd[MSP_SUBSCRIPTION_MAX];
+    uint8_t count;
+    uint16_t intervalMs;
+    timeMs_t lastPushMs;
+} mspSubscription_t;
+
 struct serialPort_s;
 typedef struct mspPort_s {
     struct serialPort_s *port; // null when port unused.
@@ -114,6 +128,7 @@ typedef struct mspPort_s {
     uint8_t checksum2;
     bool sharedWithTelemetry;
     mspDescriptor_t descriptor;
+    mspSubscription_t subscription;
 } mspPort_t;
 
 void mspSerialInit(void);
@@ -124,3 +139,4 @@ void mspSerialReleasePortIfAllocated(struct serialPort_s *serialPort);
 void mspSerialReleaseSharedTelemetryPorts(void);
 int mspSerialPush(serialPortIdentifier_e port, uint8_t cmd, uint8_t *data, int datalen, mspDirection_e direction);
 uint32_t mspSerialTxBytesFree(void);
+bool mspSerialSubscribe(mspDescriptor_t descriptor, uint16_t intervalMs, const uint16_t *cmd, uint8_t count);
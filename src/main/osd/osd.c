@@ -77,6 +77,7 @@
 
 #include "osd/osd.h"
 #include "osd/osd_elements.h"
+#include "osd/osd_screen.h"
 
 #include "pg/motor.h"
 #include "pg/pg.h"
@@ -138,6 +139,9 @@ static uint8_t osdStatsRowCount = 0;
 
 static bool backgroundLayerSupported = false;
 
+// Display contents unknown, cleared before the elements are drawn again
+static bool osdScreenRedraw = true;
+
 #ifdef USE_ESC_SENSOR
 escSensorData_t *osdEscDataCombined;
 #endif
@@ -254,6 +258,19 @@ static void osdDrawElements(timeUs_t currentTimeUs)
     // Hide OSD when OSDSW mode is active
     if (IS_RC_MODE_ACTIVE(BOXOSD)) {
         displayClearScreen(osdDisplayPort);
+        osdScreenRedraw = true;
+        return;
+    }
+
+    if (osdScreenActive()) {
+        if (osdScreenRedraw) {
+            displayClearScreen(osdDisplayPort);
+            osdScreenReset();
+            osdScreenRedraw = false;
+        }
+        osdScreenBegin();
+        osdDrawActiveElements(osdDisplayPort, currentTimeUs);
+        osdScreenFlush(osdDisplayPort);
         return;
     }
 
@@ -379,7 +396,8 @@ static void osdCompleteInitialization(void)
 
     osdResetAlarms();
 
-    backgroundLayerSupported = displayLayerSupported(osdDisplayPort, DISPLAYPORT_LAYER_BACKGROUND);
+    // The shadow screen draws the element backgrounds into every frame, but only sends changes
+    backgroundLayerSupported = !osdScreenInit(osdDisplayPort) && displayLayerSupported(osdDisplayPort, DISPLAYPORT_LAYER_BACKGROUND);
     displayLayerSelect(osdDisplayPort, DISPLAYPORT_LAYER_FOREGROUND);
 
     displayBeginTransaction(osdDisplayPort, DISPLAY_TRANSACTION_OPT_RESET_DRAWING);
@@ -938,6 +956,7 @@ STATIC_UNIT_TESTED void osdRefresh(timeUs_t currentTimeUs)
                 resumeRefreshAt = currentTimeUs;
             }
             displayHeartbeat(osdDisplayPort);
+            osdScreenRedraw = true;
             return;
         } else {
             displayClearScreen(osdDisplayPort);
@@ -966,7 +985,9 @@ STATIC_UNIT_TESTED void osdRefresh(timeUs_t currentTimeUs)
 #endif
 
 #ifdef USE_CMS
-    if (!displayIsGrabbed(osdDisplayPort))
+    if (displayIsGrabbed(osdDisplayPort)) {
+        osdScreenRedraw = true;
+    } else
 #endif
     {
         osdUpdateAlarms();
@@ -110,6 +110,7 @@
 
 #include "osd/osd.h"
 #include "osd/osd_elements.h"
+#include "osd/osd_screen.h"
 
 #include "pg/motor.h"
 
@@ -185,6 +186,10 @@ static int osdDisplayWrite(osdElementParms_t *element, uint8_t x, uint8_t y, uin
         attr |= DISPLAYPORT_ATTR_BLINK;
     }
 
+    if (osdScreenActive()) {
+        return osdScreenWrite(x, y, attr, s);
+    }
+
     return displayWrite(element->osdDisplayPort, x, y, attr, s);
 }
 
@@ -0,0 +1,165 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Shadow screen for the OSD elements.
+ *
+ * The elements are drawn into a RAM frame instead of the display. The
+ * flush compares the frame with what the display is known to show and
+ * sends only the cells that changed, with nearby changes in a row joined
+ * into one write. Each cell holds the character and its attributes.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_OSD
+
+#include "drivers/display.h"
+
+#include "osd/osd_screen.h"
+
+#define CELL(c, attr)       ((uint16_t)(((attr) << 8) | (uint8_t)(c)))
+#define CELL_CHAR(cell)     ((char)((cell) & 0xff))
+#define CELL_ATTR(cell)     ((uint8_t)((cell) >> 8))
+#define CELL_BLANK          CELL(' ', DISPLAYPORT_ATTR_NONE)
+
+static uint16_t screenFrame[OSD_SCREEN_ROWS_MAX][OSD_SCREEN_COLS_MAX];
+static uint16_t screenShown[OSD_SCREEN_ROWS_MAX][OSD_SCREEN_COLS_MAX];
+
+static bool screenActive;
+static uint8_t screenRows;
+static uint8_t screenCols;
+static uint8_t flushCount;
+
+static void fillCells(uint16_t screen[OSD_SCREEN_ROWS_MAX][OSD_SCREEN_COLS_MAX], uint16_t cell)
+{
+    for (int row = 0; row < OSD_SCREEN_ROWS_MAX; row++) {
+        for (int col = 0; col < OSD_SCREEN_COLS_MAX; col++) {
+            screen[row][col] = cell;
+        }
+    }
+}
+
+bool osdScreenInit(const displayPort_t *displayPort)
+{
+    screenActive = displayPort->rows <= OSD_SCREEN_ROWS_MAX && displayPort->cols <= OSD_SCREEN_COLS_MAX;
+    screenRows = screenActive ? displayPort->rows : 0;
+    screenCols = screenActive ? displayPort->cols : 0;
+
+    osdScreenBegin();
+    osdScreenReset();
+
+    return screenActive;
+}
+
+bool osdScreenActive(void)
+{
+    return screenActive;
+}
+
+// The display has been cleared by other means
+void osdScreenReset(void)
+{
+    fillCells(screenShown, CELL_BLANK);
+    flushCount = 0;
+}
+
+// Starts a frame on a blank screen
+void osdScreenBegin(void)
+{
+    fillCells(screenFrame, CELL_BLANK);
+}
+
+int osdScreenWrite(uint8_t x, uint8_t y, uint8_t attr, const char *text)
+{
+    if (y >= screenRows) {
+        return 0;
+    }
+
+    uint16_t *cell = &screenFrame[y][0];
+    while (*text && x < screenCols) {
+        cell[x++] = CELL(*text++, attr);
+    }
+
+    return 0;
+}
+
+static void flushRun(displayPort_t *displayPort, uint8_t row, uint8_t start, uint8_t end)
+{
+    char text[OSD_SCREEN_WRITE_MAX + 1];
+    const uint16_t *frame = &screenFrame[row][0];
+
+    for (int col = start; col < end; col++) {
+        text[col - start] = CELL_CHAR(frame[col]);
+    }
+    text[end - start] = 0;
+
+    displayWrite(displayPort, start, row, CELL_ATTR(frame[start]), text);
+
+    memcpy(&screenShown[row][start], &frame[start], (end - start) * sizeof(uint16_t));
+}
+
+/*
+ * Sends the cells of the frame that differ from the display. A write
+ * runs on over unchanged cells while the next change is near enough,
+ * as long as the attributes stay the same.
+ */
+void osdScreenFlush(displayPort_t *displayPort)
+{
+    // Now and then everything that is not blank goes out again
+    const bool resend = (flushCount == 0);
+    flushCount = (flushCount + 1) % OSD_SCREEN_RESEND_FLUSHES;
+
+    for (int row = 0; row < screenRows; row++) {
+        const uint16_t *frame = &screenFrame[row][0];
+        const uint16_t *shown = &screenShown[row][0];
+
+#define CHANGED(col) (frame[col] != shown[col] || (resend && frame[col] != CELL_BLANK))
+
+        int col = 0;
+        while (col < screenCols) {
+            if (!CHANGED(col)) {
+                col++;
+                continue;
+            }
+
+            const int start = col;
+            const uint16_t attr = CELL_ATTR(frame[start]);
+            int end = col + 1;
+
+            for (col = end; col < screenCols && col - start < OSD_SCREEN_WRITE_MAX; col++) {
+                if (CELL_ATTR(frame[col]) != attr || col - end >= OSD_SCREEN_MERGE_GAP) {
+                    break;
+                }
+                if (CHANGED(col)) {
+                    end = col + 1;
+                }
+            }
+
+            flushRun(displayPort, row, start, end);
+            col = end;
+        }
+
+#undef CHANGED
+    }
+}
+
+#endif
@@ -0,0 +1,41 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "drivers/display.h"
+
+// Largest display the shadow screen takes, others are drawn directly
+#define OSD_SCREEN_ROWS_MAX         20
+#define OSD_SCREEN_COLS_MAX         32
+
+// Longest single write, as taken by the MSP displayport
+#define OSD_SCREEN_WRITE_MAX        30
+
+// Unchanged cells between two changes that are resent rather than starting a new write
+#define OSD_SCREEN_MERGE_GAP        6
+
+// Every this many flushes all of the screen is sent again, for displays that lose it
+#define OSD_SCREEN_RESEND_FLUSHES   64
+
+bool osdScreenInit(const displayPort_t *displayPort);
+bool osdScreenActive(void);
+
+void osdScreenReset(void);
+void osdScreenBegin(void);
+int  osdScreenWrite(uint8_t x, uint8_t y, uint8_t attr, const char *text);
+void osdScreenFlush(displayPort_t *displayPort);
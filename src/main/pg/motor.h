@@ -57,7 +57,7 @@ typedef struct motorConfig_s {
     uint16_t maxthrottle;                   // This is the maximum value for the ESCs at full power this value can be increased up to 2000
     uint16_t mincommand;                    // This is the value for the ESCs when they are not armed. In some cases, this value must be lowered down to 900 for some specific ESCs
     uint8_t motorPoleCount[MAX_SUPPORTED_MOTORS]; // Magnetic poles in the motors for calculating actual RPM from eRPM provided by ESC telemetry
-    uint16_t motorRpmLpf[MAX_SUPPORTED_MOTORS];   // RPM low pass filter
+    uint16_t motorRpmLpf[MAX_SUPPORTED_MOTORS];   // RPM estimator bandwidth in Hz, as the RPM low pass cutoff was
 } motorConfig_t;
 
 PG_DECLARE(motorConfig_t, motorConfig);
@@ -150,12 +150,21 @@ typedef struct crsfPayloadLinkstatistics_s {
     int8_t downlink_SNR;
 } crsfLinkStatistics_t;
 
+// Uplink packet rate of each RF mode, the receiver takes a telemetry frame per packet
+static const uint16_t crsfRfModeRateHz[CRSF_RF_MODE_COUNT] = {
+    [CRSF_RF_MODE_4_FPS] = 4,
+    [CRSF_RF_MODE_50_FPS] = 50,
+    [CRSF_RF_MODE_150_FPS] = 150,
+};
+
 static timeUs_t lastLinkStatisticsFrameUs;
+static uint16_t telemetrySlotRateHz;
 
 static void handleCrsfLinkStatisticsFrame(const crsfLinkStatistics_t* statsPtr, timeUs_t currentTimeUs)
 {
     const crsfLinkStatistics_t stats = *statsPtr;
     lastLinkStatisticsFrameUs = currentTimeUs;
+    telemetrySlotRateHz = stats.rf_Mode < CRSF_RF_MODE_COUNT ? crsfRfModeRateHz[stats.rf_Mode] : 0;
     int16_t rssiDbm = -1 * (stats.active_antenna ? stats.uplink_RSSI_2 : stats.uplink_RSSI_1);
     if (rssiSource == RSSI_SOURCE_RX_PROTOCOL_CRSF) {
         const uint16_t rssiPercentScaled = scaleRange(rssiDbm, CRSF_RSSI_MIN, 0, 0, RSSI_MAX_VALUE);
@@ -201,6 +210,7 @@ static void handleCrsfLinkStatisticsFrame(const crsfLinkStatistics_t* statsPtr,
 static void crsfCheckRssi(uint32_t currentTimeUs) {
 
     if (cmpTimeUs(currentTimeUs, lastLinkStatisticsFrameUs) > CRSF_LINK_STATUS_UPDATE_TIMEOUT_US) {
+        telemetrySlotRateHz = 0;
         if (rssiSource == RSSI_SOURCE_RX_PROTOCOL_CRSF) {
             setRssiDirect(0, RSSI_SOURCE_RX_PROTOCOL_CRSF);
 #ifdef USE_RX_RSSI_DBM
@@ -223,11 +233,10 @@ static void crsfCheckRssi(uint32_t currentTimeUs) {
 STATIC_UNIT_TESTED uint8_t crsfFrameCRC(void)
 {
     // CRC includes type and payload
-    uint8_t crc = crc8_dvb_s2(0, crsfFrame.frame.type);
-    for (int ii = 0; ii < crsfFrame.frame.frameLength - CRSF_FRAME_LENGTH_TYPE_CRC; ++ii) {
-        crc = crc8_dvb_s2(crc, crsfFrame.frame.payload[ii]);
-    }
-    return crc;
+    // A corrupt frame length may leave no payload
+    const int payloadLength = crsfFrame.frame.frameLength - CRSF_FRAME_LENGTH_TYPE_CRC;
+    const uint8_t crc = crc8_dvb_s2(0, crsfFrame.frame.type);
+    return crc8_dvb_s2_update(crc, crsfFrame.frame.payload, MAX(payloadLength, 0));
 }
 
 // Receive ISR callback, called back from serial port
@@ -375,6 +384,15 @@ void crsfRxSendTelemetryData(void)
     }
 }
 
+uint16_t crsfRxTelemetrySlotRate(void)
+{
+#if defined(USE_CRSF_LINK_STATISTICS)
+    return telemetrySlotRateHz;
+#else
+    return 0;
+#endif
+}
+
 static timeUs_t crsfFrameTimeUs(void)
 {
     return lastRcFrameTimeUs;
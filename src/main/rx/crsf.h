@@ -33,13 +33,13 @@
 #define CRSF_SNR_MIN (-30)
 #define CRSF_SNR_MAX 20
 
-/* For documentation purposes
+// RF modes of Crossfire, ExpressLRS reports its own packet rates as other values
 typedef enum {
     CRSF_RF_MODE_4_FPS = 0,
     CRSF_RF_MODE_50_FPS,
     CRSF_RF_MODE_150_FPS,
+    CRSF_RF_MODE_COUNT
 } crsfRfMode_e;
-*/
 
 typedef struct crsfFrameDef_s {
     uint8_t deviceAddress;
@@ -55,6 +55,8 @@ typedef union crsfFrame_u {
 
 void crsfRxWriteTelemetryData(const void *data, int len);
 void crsfRxSendTelemetryData(void);
+// Telemetry frames the receiver takes per second, 0 for an unknown RF mode
+uint16_t crsfRxTelemetrySlotRate(void);
 
 struct rxConfig_s;
 struct rxRuntimeState_s;
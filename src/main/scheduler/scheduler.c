@@ -67,11 +67,119 @@ static FAST_RAM_ZERO_INIT bool gyroEnabled;
 
 STATIC_UNIT_TESTED FAST_RAM_ZERO_INIT task_t* taskQueueArray[TASK_COUNT + 1]; // extra item for NULL pointer at end of queue
 
+#if defined(USE_SCHEDULER_DEADLINE_QUEUE)
+// Time driven tasks are kept in a binary min-heap ordered by their next due time,
+// so a scheduler pass only looks at tasks that are actually due. Event driven
+// tasks are kept in a separate list, in queue order, and polled every pass.
+// Off by default, built in with OPTIONS=USE_SCHEDULER_DEADLINE_QUEUE.
+
+static FAST_RAM_ZERO_INIT task_t *taskDeadlineHeap[TASK_COUNT];
+static FAST_RAM_ZERO_INIT int taskDeadlineCount;
+
+static FAST_RAM_ZERO_INIT task_t *taskEventArray[TASK_COUNT];
+static FAST_RAM_ZERO_INIT int taskEventCount;
+
+static inline timeUs_t taskDeadline(const task_t *task)
+{
+    return task->lastExecutedAtUs + task->desiredPeriodUs;
+}
+
+// Earlier deadline first, queue order on equal deadlines
+static inline bool taskDeadlineBefore(const task_t *a, const task_t *b)
+{
+    const timeDelta_t diff = cmpTimeUs(taskDeadline(a), taskDeadline(b));
+    return (diff < 0) || (diff == 0 && a->queueRank < b->queueRank);
+}
+
+static inline void deadlineHeapSet(int index, task_t *task)
+{
+    taskDeadlineHeap[index] = task;
+    task->heapIndex = index;
+}
+
+static void deadlineHeapSiftUp(int index)
+{
+    task_t *task = taskDeadlineHeap[index];
+
+    while (index > 0) {
+        const int parent = (index - 1) / 2;
+        if (!taskDeadlineBefore(task, taskDeadlineHeap[parent])) {
+            break;
+        }
+        deadlineHeapSet(index, taskDeadlineHeap[parent]);
+        index = parent;
+    }
+
+    deadlineHeapSet(index, task);
+}
+
+static void deadlineHeapSiftDown(int index)
+{
+    task_t *task = taskDeadlineHeap[index];
+
+    while (true) {
+        int child = 2 * index + 1;
+        if (child >= taskDeadlineCount) {
+            break;
+        }
+        if (child + 1 < taskDeadlineCount && taskDeadlineBefore(taskDeadlineHeap[child + 1], taskDeadlineHeap[child])) {
+            child++;
+        }
+        if (!taskDeadlineBefore(taskDeadlineHeap[child], task)) {
+            break;
+        }
+        deadlineHeapSet(index, taskDeadlineHeap[child]);
+        index = child;
+    }
+
+    deadlineHeapSet(index, task);
+}
+
+// Restore the heap order after the task's deadline has moved
+static void deadlineQueueUpdate(task_t *task)
+{
+    const int index = task->heapIndex;
+
+    if (index < taskDeadlineCount && taskDeadlineHeap[index] == task) {
+        deadlineHeapSiftUp(index);
+        deadlineHeapSiftDown(task->heapIndex);
+    }
+}
+
+// Called whenever the task queue changes, which only happens at startup
+// and when tasks are enabled or disabled
+static void deadlineQueueRebuild(void)
+{
+    taskDeadlineCount = 0;
+    taskEventCount = 0;
+
+    for (int ii = 0; ii < taskQueueSize; ++ii) {
+        task_t *task = taskQueueArray[ii];
+        task->queueRank = ii;
+        if (task->staticPriority == TASK_PRIORITY_REALTIME) {
+            continue;
+        }
+        if (task->checkFunc) {
+            taskEventArray[taskEventCount++] = task;
+        } else {
+            deadlineHeapSet(taskDeadlineCount++, task);
+        }
+    }
+
+    for (int ii = taskDeadlineCount / 2 - 1; ii >= 0; --ii) {
+        deadlineHeapSiftDown(ii);
+    }
+}
+#endif
+
 void queueClear(void)
 {
     memset(taskQueueArray, 0, sizeof(taskQueueArray));
     taskQueuePos = 0;
     taskQueueSize = 0;
+#if defined(USE_SCHEDULER_DEADLINE_QUEUE)
+    deadlineQueueRebuild();
+#endif
 }
 
 bool queueContains(task_t *task)
@@ -94,6 +202,9 @@ bool queueAdd(task_t *task)
             memmove(&taskQueueArray[ii+1], &taskQueueArray[ii], sizeof(task) * (taskQueueSize - ii));
             taskQueueArray[ii] = task;
             ++taskQueueSize;
+#if defined(USE_SCHEDULER_DEADLINE_QUEUE)
+            deadlineQueueRebuild();
+#endif
             return true;
         }
     }
@@ -106,6 +217,9 @@ bool queueRemove(task_t *task)
         if (taskQueueArray[ii] == task) {
             memmove(&taskQueueArray[ii], &taskQueueArray[ii+1], sizeof(task) * (taskQueueSize - ii));
             --taskQueueSize;
+#if defined(USE_SCHEDULER_DEADLINE_QUEUE)
+            deadlineQueueRebuild();
+#endif
             return true;
         }
     }
@@ -144,6 +258,85 @@ void taskSystemLoad(timeUs_t currentTimeUs)
 #endif
 }
 
+#if defined(USE_SCHEDULER_TRACE)
+// Every task run, and every task the gyro guard keeps from running, is
+// recorded in a ring holding the latest SCHEDULER_TRACE_SIZE events. With a
+// late gyro trigger set, the trace stops by itself half a ring after the first
+// gyro run that came later than the trigger, keeping what led up to it and
+// what followed. Built into debug builds, others take
+// OPTIONS=USE_SCHEDULER_TRACE.
+
+static schedulerTraceEvent_t traceRing[SCHEDULER_TRACE_SIZE];
+static FAST_RAM_ZERO_INIT uint16_t traceHead;
+static FAST_RAM_ZERO_INIT uint16_t traceCount;
+static FAST_RAM_ZERO_INIT uint16_t traceStopCountdown;
+static FAST_RAM_ZERO_INIT timeDelta_t traceLateGyroUs;
+static FAST_RAM_ZERO_INIT bool traceRunning;
+
+void schedulerTraceStart(timeDelta_t lateGyroUs)
+{
+    traceHead = 0;
+    traceCount = 0;
+    traceStopCountdown = 0;
+    traceLateGyroUs = MAX(0, lateGyroUs);
+    traceRunning = true;
+}
+
+void schedulerTraceStop(void)
+{
+    traceRunning = false;
+}
+
+bool schedulerTraceIsRunning(void)
+{
+    return traceRunning;
+}
+
+int schedulerTraceCount(void)
+{
+    return traceCount;
+}
+
+// Index 0 is the oldest event
+bool schedulerTraceGetEvent(int index, schedulerTraceEvent_t *event)
+{
+    if (index < 0 || index >= traceCount) {
+        return false;
+    }
+
+    *event = traceRing[(traceHead + SCHEDULER_TRACE_SIZE - traceCount + index) % SCHEDULER_TRACE_SIZE];
+
+    return true;
+}
+
+static FAST_CODE void schedulerTraceRecord(const task_t *task, timeUs_t startUs, timeUs_t durationUs, uint8_t flags)
+{
+    const int taskId = task - getTask(0);
+
+    if (taskId == TASK_GYRO && traceLateGyroUs > 0 && task->taskLatestDeltaTimeUs > task->desiredPeriodUs + traceLateGyroUs) {
+        flags |= SCHEDULER_TRACE_LATE_GYRO;
+        if (traceStopCountdown == 0) {
+            traceStopCountdown = SCHEDULER_TRACE_SIZE / 2;
+        }
+    }
+
+    schedulerTraceEvent_t *event = &traceRing[traceHead];
+    event->startUs = startUs;
+    event->durationUs = MIN(durationUs, (timeUs_t)UINT16_MAX);
+    event->taskId = taskId;
+    event->flags = flags;
+
+    traceHead = (traceHead + 1) % SCHEDULER_TRACE_SIZE;
+    if (traceCount < SCHEDULER_TRACE_SIZE) {
+        traceCount++;
+    }
+
+    if (traceStopCountdown > 0 && --traceStopCountdown == 0) {
+        traceRunning = false;
+    }
+}
+#endif
+
 #if defined(USE_TASK_STATISTICS)
 timeUs_t checkFuncMaxExecutionTimeUs;
 timeUs_t checkFuncTotalExecutionTimeUs;
@@ -181,9 +374,15 @@ void rescheduleTask(taskId_e taskId, timeDelta_t newPeriodUs)
     if (taskId == TASK_SELF) {
         task_t *task = currentTask;
         task->desiredPeriodUs = MAX(SCHEDULER_DELAY_LIMIT, newPeriodUs);  // Limit delay to 100us (10 kHz) to prevent scheduler clogging
+#if defined(USE_SCHEDULER_DEADLINE_QUEUE)
+        deadlineQueueUpdate(task);
+#endif
     } else if (taskId < TASK_COUNT) {
         task_t *task = getTask(taskId);
         task->desiredPeriodUs = MAX(SCHEDULER_DELAY_LIMIT, newPeriodUs);  // Limit delay to 100us (10 kHz) to prevent scheduler clogging
+#if defined(USE_SCHEDULER_DEADLINE_QUEUE)
+        deadlineQueueUpdate(task);
+#endif
     }
 }
 
@@ -289,6 +488,12 @@ FAST_CODE timeUs_t schedulerExecuteTask(task_t *selectedTask, timeUs_t currentTi
         selectedTask->lastDesiredAt += (cmpTimeUs(currentTimeUs, selectedTask->lastDesiredAt) / selectedTask->desiredPeriodUs) * selectedTask->desiredPeriodUs;
         selectedTask->dynamicPriority = 0;
 
+#if defined(USE_SCHEDULER_TRACE)
+        // Latched, as the task itself may start or stop the trace
+        const bool trace = traceRunning;
+        const timeUs_t traceStartUs = trace ? micros() : 0;
+#endif
+
         // Execute task
 #if defined(USE_TASK_STATISTICS)
         if (calculateTaskStatistics) {
@@ -305,11 +510,116 @@ FAST_CODE timeUs_t schedulerExecuteTask(task_t *selectedTask, timeUs_t currentTi
         {
             selectedTask->taskFunc(currentTimeUs);
         }
+
+#if defined(USE_SCHEDULER_TRACE)
+        if (trace) {
+            schedulerTraceRecord(selectedTask, traceStartUs, micros() - traceStartUs, 0);
+        }
+#endif
     }
 
     return taskExecutionTimeUs;
 }
 
+// Event driven task: raise the priority while it is waiting, otherwise poll its checkFunc
+static inline void schedulerUpdateEventTask(task_t *task, timeUs_t currentTimeUs, uint16_t *waitingTasks)
+{
+#if defined(SCHEDULER_DEBUG)
+    const timeUs_t currentTimeBeforeCheckFuncCallUs = micros();
+#else
+    const timeUs_t currentTimeBeforeCheckFuncCallUs = currentTimeUs;
+#endif
+    // Increase priority for event driven tasks
+    if (task->dynamicPriority > 0) {
+        task->taskAgeCycles = 1 + ((currentTimeUs - task->lastSignaledAtUs) / task->desiredPeriodUs);
+        task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+        (*waitingTasks)++;
+    } else if (task->checkFunc(currentTimeBeforeCheckFuncCallUs, cmpTimeUs(currentTimeBeforeCheckFuncCallUs, task->lastExecutedAtUs))) {
+#if defined(SCHEDULER_DEBUG)
+        DEBUG_SET(DEBUG_SCHEDULER, 3, micros() - currentTimeBeforeCheckFuncCallUs);
+#endif
+#if defined(USE_TASK_STATISTICS)
+        if (calculateTaskStatistics) {
+            const uint32_t checkFuncExecutionTimeUs = micros() - currentTimeBeforeCheckFuncCallUs;
+            checkFuncMovingSumExecutionTimeUs += checkFuncExecutionTimeUs - checkFuncMovingSumExecutionTimeUs / TASK_STATS_MOVING_SUM_COUNT;
+            checkFuncMovingSumDeltaTimeUs += task->taskLatestDeltaTimeUs - checkFuncMovingSumDeltaTimeUs / TASK_STATS_MOVING_SUM_COUNT;
+            checkFuncTotalExecutionTimeUs += checkFuncExecutionTimeUs;   // time consumed by scheduler + task
+            checkFuncMaxExecutionTimeUs = MAX(checkFuncMaxExecutionTimeUs, checkFuncExecutionTimeUs);
+        }
+#endif
+        task->lastSignaledAtUs = currentTimeBeforeCheckFuncCallUs;
+        task->taskAgeCycles = 1;
+        task->dynamicPriority = 1 + task->staticPriority;
+        (*waitingTasks)++;
+    } else {
+        task->taskAgeCycles = 0;
+    }
+}
+
+// Time driven task: dynamicPriority is last execution age (measured in desiredPeriods)
+static inline void schedulerUpdateTimedTask(task_t *task, timeUs_t currentTimeUs, uint16_t *waitingTasks)
+{
+    // Task age is calculated from last execution
+    task->taskAgeCycles = ((currentTimeUs - getPeriodCalculationBasis(task)) / task->desiredPeriodUs);
+    if (task->taskAgeCycles > 0) {
+        task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+        (*waitingTasks)++;
+    }
+}
+
+#if defined(USE_SCHEDULER_DEADLINE_QUEUE)
+// Same selection as the linear scan: highest dynamic priority, first in queue
+// order on a tie. Time driven tasks that are not yet due have a dynamic priority
+// of zero and cannot be selected, so the heap walk stops at the first subtree
+// whose root is not due.
+static FAST_CODE task_t *deadlineQueueSelect(timeUs_t currentTimeUs, uint16_t *selectedTaskDynamicPriority, uint16_t *waitingTasks)
+{
+    task_t *selectedTask = NULL;
+    int stack[TASK_COUNT];
+    int depth = 0;
+
+    for (int ii = 0; ii < taskEventCount; ++ii) {
+        task_t *task = taskEventArray[ii];
+        schedulerUpdateEventTask(task, currentTimeUs, waitingTasks);
+        if (task->dynamicPriority > *selectedTaskDynamicPriority ||
+            (task->dynamicPriority == *selectedTaskDynamicPriority && selectedTask && task->queueRank < selectedTask->queueRank)) {
+            *selectedTaskDynamicPriority = task->dynamicPriority;
+            selectedTask = task;
+        }
+    }
+
+    if (taskDeadlineCount > 0) {
+        stack[depth++] = 0;
+    }
+
+    while (depth > 0) {
+        const int index = stack[--depth];
+        task_t *task = taskDeadlineHeap[index];
+
+        if (cmpTimeUs(currentTimeUs, taskDeadline(task)) < 0) {
+            continue;
+        }
+
+        schedulerUpdateTimedTask(task, currentTimeUs, waitingTasks);
+        if (task->dynamicPriority > *selectedTaskDynamicPriority ||
+            (task->dynamicPriority == *selectedTaskDynamicPriority && selectedTask && task->queueRank < selectedTask->queueRank)) {
+            *selectedTaskDynamicPriority = task->dynamicPriority;
+            selectedTask = task;
+        }
+
+        const int child = 2 * index + 1;
+        if (child < taskDeadlineCount) {
+            stack[depth++] = child;
+        }
+        if (child + 1 < taskDeadlineCount) {
+            stack[depth++] = child + 1;
+        }
+    }
+
+    return selectedTask;
+}
+#endif
+
 #if defined(UNIT_TEST)
 task_t *unittest_scheduler_selectedTask;
 uint8_t unittest_scheduler_selectedTaskDynamicPriority;
@@ -356,49 +666,16 @@ FAST_CODE void scheduler(void)
     if (!gyroEnabled || realtimeTaskRan || (gyroTaskDelayUs > GYRO_TASK_GUARD_INTERVAL_US)) {
         // The task to be invoked
 
+#if defined(USE_SCHEDULER_DEADLINE_QUEUE)
+        selectedTask = deadlineQueueSelect(currentTimeUs, &selectedTaskDynamicPriority, &waitingTasks);
+#else
         // Update task dynamic priorities
         for (task_t *task = queueFirst(); task != NULL; task = queueNext()) {
             if (task->staticPriority != TASK_PRIORITY_REALTIME) {
-                // Task has checkFunc - event driven
                 if (task->checkFunc) {
-#if defined(SCHEDULER_DEBUG)
-                    const timeUs_t currentTimeBeforeCheckFuncCallUs = micros();
-#else
-                    const timeUs_t currentTimeBeforeCheckFuncCallUs = currentTimeUs;
-#endif
-                    // Increase priority for event driven tasks
-                    if (task->dynamicPriority > 0) {
-                        task->taskAgeCycles = 1 + ((currentTimeUs - task->lastSignaledAtUs) / task->desiredPeriodUs);
-                        task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
-                        waitingTasks++;
-                    } else if (task->checkFunc(currentTimeBeforeCheckFuncCallUs, cmpTimeUs(currentTimeBeforeCheckFuncCallUs, task->lastExecutedAtUs))) {
-#if defined(SCHEDULER_DEBUG)
-                        DEBUG_SET(DEBUG_SCHEDULER, 3, micros() - currentTimeBeforeCheckFuncCallUs);
-#endif
-#if defined(USE_TASK_STATISTICS)
-                        if (calculateTaskStatistics) {
-                            const uint32_t checkFuncExecutionTimeUs = micros() - currentTimeBeforeCheckFuncCallUs;
-                            checkFuncMovingSumExecutionTimeUs += checkFuncExecutionTimeUs - checkFuncMovingSumExecutionTimeUs / TASK_STATS_MOVING_SUM_COUNT;
-                            checkFuncMovingSumDeltaTimeUs += task->taskLatestDeltaTimeUs - checkFuncMovingSumDeltaTimeUs / TASK_STATS_MOVING_SUM_COUNT;
-                            checkFuncTotalExecutionTimeUs += checkFuncExecutionTimeUs;   // time consumed by scheduler + task
-                            checkFuncMaxExecutionTimeUs = MAX(checkFuncMaxExecutionTimeUs, checkFuncExecutionTimeUs);
-                        }
-#endif
-                        task->lastSignaledAtUs = currentTimeBeforeCheckFuncCallUs;
-                        task->taskAgeCycles = 1;
-                        task->dynamicPriority = 1 + task->staticPriority;
-                        waitingTasks++;
-                    } else {
-                        task->taskAgeCycles = 0;
-                    }
+                    schedulerUpdateEventTask(task, currentTimeUs, &waitingTasks);
                 } else {
-                    // Task is time-driven, dynamicPriority is last execution age (measured in desiredPeriods)
-                    // Task age is calculated from last execution
-                    task->taskAgeCycles = ((currentTimeUs - getPeriodCalculationBasis(task)) / task->desiredPeriodUs);
-                    if (task->taskAgeCycles > 0) {
-                        task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
-                        waitingTasks++;
-                    }
+                    schedulerUpdateTimedTask(task, currentTimeUs, &waitingTasks);
                 }
 
                 if (task->dynamicPriority > selectedTaskDynamicPriority) {
@@ -407,6 +684,7 @@ FAST_CODE void scheduler(void)
                 }
             }
         }
+#endif
 
         totalWaitingTasksSamples++;
         totalWaitingTasks += waitingTasks;
@@ -422,7 +700,15 @@ FAST_CODE void scheduler(void)
             taskRequiredTimeUs += cmpTimeUs(micros(), currentTimeUs);
             if (!gyroEnabled || realtimeTaskRan || (taskRequiredTimeUs < gyroTaskDelayUs)) {
                 taskExecutionTimeUs += schedulerExecuteTask(selectedTask, currentTimeUs);
+#if defined(USE_SCHEDULER_DEADLINE_QUEUE)
+                deadlineQueueUpdate(selectedTask);
+#endif
             } else {
+#if defined(USE_SCHEDULER_TRACE)
+                if (traceRunning) {
+                    schedulerTraceRecord(selectedTask, currentTimeUs, 0, SCHEDULER_TRACE_GUARD_SKIPPED);
+                }
+#endif
                 selectedTask = NULL;
             }
         }
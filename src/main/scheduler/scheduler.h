@@ -137,6 +137,24 @@ typedef enum {
     TASK_SELF
 } taskId_e;
 
+#if defined(USE_SCHEDULER_TRACE)
+#ifndef SCHEDULER_TRACE_SIZE
+#define SCHEDULER_TRACE_SIZE 256
+#endif
+
+typedef enum {
+    SCHEDULER_TRACE_GUARD_SKIPPED = (1 << 0),   // selected, but not run because the gyro task was due
+    SCHEDULER_TRACE_LATE_GYRO     = (1 << 1),   // gyro task ran later than the trigger allows
+} schedulerTraceFlag_e;
+
+typedef struct {
+    uint32_t startUs;                           // low 32 bits of the start time
+    uint16_t durationUs;
+    uint8_t  taskId;
+    uint8_t  flags;
+} schedulerTraceEvent_t;
+#endif
+
 typedef struct {
     // Configuration
 #if defined(USE_TASK_STATISTICS)
@@ -155,6 +173,10 @@ typedef struct {
     timeUs_t lastExecutedAtUs;        // last time of invocation
     timeUs_t lastSignaledAtUs;        // time of invocation event for event-driven tasks
     timeUs_t lastDesiredAt;         // time of last desired execution
+#if defined(USE_SCHEDULER_DEADLINE_QUEUE)
+    uint8_t queueRank;              // position in the task queue, breaks priority ties
+    uint8_t heapIndex;              // position in the deadline heap
+#endif
 
 #if defined(USE_TASK_STATISTICS)
     // Statistics
@@ -183,3 +205,11 @@ void taskSystemLoad(timeUs_t currentTimeUs);
 void schedulerOptimizeRate(bool optimizeRate);
 void schedulerEnableGyro(void);
 uint16_t getAverageSystemLoadPercent(void);
+
+#if defined(USE_SCHEDULER_TRACE)
+void schedulerTraceStart(timeDelta_t lateGyroUs);
+void schedulerTraceStop(void);
+bool schedulerTraceIsRunning(void);
+int schedulerTraceCount(void);
+bool schedulerTraceGetEvent(int index, schedulerTraceEvent_t *event);
+#endif
@@ -36,6 +36,7 @@
 #include "pg/pg_ids.h"
 #include "pg/motor.h"
 
+#include "common/crc.h"
 #include "common/maths.h"
 #include "common/utils.h"
 
@@ -124,6 +125,7 @@ static volatile uint8_t bufferPosition = 0;
 static serialPort_t *escSensorPort = NULL;
 
 static escSensorData_t escSensorData[MAX_SUPPORTED_MOTORS];
+static timeUs_t escSensorRPMTimeUs[MAX_SUPPORTED_MOTORS];
 
 static escSensorTriggerState_t escSensorTriggerState = ESC_SENSOR_TRIGGER_STARTUP;
 static uint32_t escTriggerTimestamp;
@@ -213,6 +215,16 @@ uint16_t getEscSensorRPM(uint8_t motorNumber)
     }
 }
 
+// When the RPM was received, for the RPM estimator in motors.c
+timeUs_t getEscSensorRPMTimeUs(uint8_t motorNumber)
+{
+    if (motorNumber < getMotorCount()) {
+        return escSensorRPMTimeUs[motorNumber];
+    } else {
+        return 0;
+    }
+}
+
 escSensorData_t *getEscSensorData(uint8_t motorNumber)
 {
     if (!featureIsEnabled(FEATURE_ESC_SENSOR)) {
@@ -325,36 +337,14 @@ bool escSensorInit(void)
     return escSensorPort != NULL;
 }
 
-static uint8_t updateCrc8(uint8_t crc, uint8_t crc_seed)
-{
-    uint8_t crc_u = crc;
-    crc_u ^= crc_seed;
-
-    for (int i=0; i<8; i++) {
-        crc_u = ( crc_u & 0x80 ) ? 0x7 ^ ( crc_u << 1 ) : ( crc_u << 1 );
-    }
-
-    return (crc_u);
-}
-
-uint8_t calculateCrc8(const uint8_t *Buf, const uint8_t BufLen)
-{
-    uint8_t crc = 0;
-    for (int i = 0; i < BufLen; i++) {
-        crc = updateCrc8(Buf[i], crc);
-    }
-
-    return crc;
-}
-
-static uint8_t decodeEscFrame(void)
+static uint8_t decodeEscFrame(timeUs_t currentTimeUs)
 {
     if (!isFrameComplete()) {
         return ESC_SENSOR_FRAME_PENDING;
     }
 
     // Get CRC8 checksum
-    uint16_t chksum = calculateCrc8(telemetryBuffer, TELEMETRY_FRAME_SIZE - 1);
+    uint16_t chksum = crc8_smbus_update(0, telemetryBuffer, TELEMETRY_FRAME_SIZE - 1);
     uint16_t tlmsum = telemetryBuffer[TELEMETRY_FRAME_SIZE - 1];     // last byte contains CRC value
     uint8_t frameStatus;
     if (chksum == tlmsum) {
@@ -364,6 +354,7 @@ static uint8_t decodeEscFrame(void)
         escSensorData[escSensorMotor].current = telemetryBuffer[3] << 8 | telemetryBuffer[4];
         escSensorData[escSensorMotor].consumption = telemetryBuffer[5] << 8 | telemetryBuffer[6];
         escSensorData[escSensorMotor].rpm = telemetryBuffer[7] << 8 | telemetryBuffer[8];
+        escSensorRPMTimeUs[escSensorMotor] = currentTimeUs;
 
         combinedDataNeedsUpdate = true;
 
@@ -502,7 +493,7 @@ void escSensorProcess(timeUs_t currentTimeUs)
                 break;
             case ESC_SENSOR_TRIGGER_PENDING:
                 if (currentTimeMs < escTriggerTimestamp + ESC_REQUEST_TIMEOUT) {
-                    uint8_t state = decodeEscFrame();
+                    uint8_t state = decodeEscFrame(currentTimeUs);
                     switch (state) {
                         case ESC_SENSOR_FRAME_COMPLETE:
                             selectNextMotor();
@@ -577,6 +568,7 @@ void escSensorProcess(timeUs_t currentTimeUs)
                 escSensorData[escSensorMotor].voltage = voltage * 100;
                 escSensorData[escSensorMotor].current = current * 100;
                 escSensorData[escSensorMotor].rpm = rpm / 100;
+                escSensorRPMTimeUs[escSensorMotor] = currentTimeUs;
 
                 // HF3D TODO:  Add a debug_ESC parameter for Hobbywing (Packet #, RPM, FET Temp, BEC Temp)
                 // HF3D TODO:  Hopefully we're bringing ESC Voltage and Current into the logs permanently anyway.... and probably should bring ESC Temp in permanently too.
@@ -67,8 +67,7 @@ escSensorData_t *getEscSensorData(uint8_t motorNumber);
 void startEscDataRead(uint8_t *frameBuffer, uint8_t frameLength);
 uint8_t getNumberEscBytesRead(void);
 
-uint8_t calculateCrc8(const uint8_t *Buf, const uint8_t BufLen);
-
 bool isEscSensorActive(void);
 uint16_t getEscSensorRPM(uint8_t motorNumber);
+timeUs_t getEscSensorRPMTimeUs(uint8_t motorNumber);
 
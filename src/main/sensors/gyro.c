@@ -90,7 +90,7 @@ STATIC_UNIT_TESTED gyroDev_t * const gyroDevPtr = &gyro.gyroSensor1.gyroDev;
 #define GYRO_OVERFLOW_TRIGGER_THRESHOLD 31980  // 97.5% full scale (1950dps for 2000dps gyro)
 #define GYRO_OVERFLOW_RESET_THRESHOLD 30340    // 92.5% full scale (1850dps for 2000dps gyro)
 
-PG_REGISTER_WITH_RESET_FN(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 8);
+PG_REGISTER_WITH_RESET_FN(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 9);
 
 #ifndef GYRO_CONFIG_USE_GYRO_DEFAULT
 #define GYRO_CONFIG_USE_GYRO_DEFAULT GYRO_CONFIG_USE_GYRO_1
@@ -122,6 +122,7 @@ void pgResetFn_gyroConfig(gyroConfig_t *gyroConfig)
     gyroConfig->dyn_notch_width_percent = 8;
     gyroConfig->dyn_notch_q = 120;
     gyroConfig->dyn_notch_min_hz = 150;
+    gyroConfig->dyn_notch_analyser = DYN_NOTCH_ANALYSER_FFT;
     gyroConfig->gyro_filter_debug_axis = FD_ROLL;
 }
 
@@ -327,12 +328,57 @@ static FAST_CODE void checkForOverflow(timeUs_t currentTimeUs)
 }
 #endif // USE_GYRO_OVERFLOW_CHECK
 
-static FAST_CODE FAST_CODE_NOINLINE void gyroUpdateSensor(gyroSensor_t *gyroSensor)
+// Number of new samples, in gyroADCRaw or else in the FIFO buffer
+static FAST_CODE int gyroReadSensor(gyroSensor_t *gyroSensor)
 {
-    if (!gyroSensor->gyroDev.readFn(&gyroSensor->gyroDev)) {
-        return;
+    gyroDev_t *gyroDev = &gyroSensor->gyroDev;
+
+    if (gyroDev->readFifoFn) {
+        if (!gyroDev->readFifoFn(gyroDev)) {
+            return 0;
+        }
+        gyroDev->dataReady = false;
+        return gyroDev->fifo.count;
+    }
+
+    if (!gyroDev->readFn(gyroDev)) {
+        return 0;
+    }
+    gyroDev->dataReady = false;
+    return 1;
+}
+
+/*
+ * Sample periods since the FIFO sample before, which the sample stands for in
+ * the average. More than one after samples were lost, and at least half, so a
+ * sample is not dropped when the time estimate starts again.
+ */
+static FAST_CODE float gyroFifoSampleWeight(gyroSensor_t *gyroSensor, int sampleIndex)
+{
+    const timeDelta_t samplePeriodUs = gyroSamplePeriodUs(&gyroSensor->gyroDev);
+    const timeUs_t sampleTimeUs = gyroSensor->gyroDev.fifo.timeUs[sampleIndex];
+    const timeDelta_t intervalUs = cmpTimeUs(sampleTimeUs, gyroSensor->sampleTimeUs);
+
+    gyroSensor->sampleTimeUs = sampleTimeUs;
+
+    if (!samplePeriodUs) {
+        return 1;
+    }
+
+    return constrainf((float)intervalUs / samplePeriodUs, 0.5f, GYRO_FIFO_SIZE);
+}
+
+// Returns the weight of the new sample in the downsampling average
+static FAST_CODE FAST_CODE_NOINLINE float gyroUpdateSensor(gyroSensor_t *gyroSensor, int sampleIndex)
+{
+    float weight = 1;
+
+    if (gyroSensor->gyroDev.readFifoFn) {
+        gyroSensor->gyroDev.gyroADCRaw[X] = gyroSensor->gyroDev.fifo.sample[sampleIndex][X];
+        gyroSensor->gyroDev.gyroADCRaw[Y] = gyroSensor->gyroDev.fifo.sample[sampleIndex][Y];
+        gyroSensor->gyroDev.gyroADCRaw[Z] = gyroSensor->gyroDev.fifo.sample[sampleIndex][Z];
+        weight = gyroFifoSampleWeight(gyroSensor, sampleIndex);
     }
-    gyroSensor->gyroDev.dataReady = false;
 
     if (isGyroSensorCalibrationComplete(gyroSensor)) {
         // move 16-bit gyro data into 32-bit variables to avoid overflows in calculations
@@ -355,76 +401,212 @@ static FAST_CODE FAST_CODE_NOINLINE void gyroUpdateSensor(gyroSensor_t *gyroSens
     } else {
         performGyroCalibration(gyroSensor, gyroConfig()->gyroMovementCalibrationThreshold);
     }
+
+    return weight;
+}
+
+// The lowpass 2 filter runs at the sample rate and takes FIFO samples as evenly spaced
+static FAST_CODE void gyroDownsampleSample(float weight)
+{
+    if (gyro.downsampleFilterEnabled) {
+        // using gyro lowpass 2 filter for downsampling
+        gyro.sampleSum[X] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[X], gyro.gyroADC[X]);
+        gyro.sampleSum[Y] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[Y], gyro.gyroADC[Y]);
+        gyro.sampleSum[Z] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[Z], gyro.gyroADC[Z]);
+    } else {
+        // using averaging over time for downsampling
+        gyro.sampleSum[X] += gyro.gyroADC[X] * weight;
+        gyro.sampleSum[Y] += gyro.gyroADC[Y] * weight;
+        gyro.sampleSum[Z] += gyro.gyroADC[Z] * weight;
+        gyro.sampleWeight += weight;
+        gyro.sampleCount++;
+    }
 }
 
+/*
+ * Every new sample goes through calibration, alignment and downsampling.
+ * A sensor with a FIFO may deliver several per call, each averaged over
+ * the time it stands for. With no new sample the last one is used again,
+ * as the filter task expects one.
+ */
 FAST_CODE void gyroUpdate(void)
 {
     switch (gyro.gyroToUse) {
     case GYRO_CONFIG_USE_GYRO_1:
-        gyroUpdateSensor(&gyro.gyroSensor1);
-        if (isGyroSensorCalibrationComplete(&gyro.gyroSensor1)) {
-            gyro.gyroADC[X] = gyro.gyroSensor1.gyroDev.gyroADC[X] * gyro.gyroSensor1.gyroDev.scale;
-            gyro.gyroADC[Y] = gyro.gyroSensor1.gyroDev.gyroADC[Y] * gyro.gyroSensor1.gyroDev.scale;
-            gyro.gyroADC[Z] = gyro.gyroSensor1.gyroDev.gyroADC[Z] * gyro.gyroSensor1.gyroDev.scale;
+        {
+            const int samples = gyroReadSensor(&gyro.gyroSensor1);
+            for (int i = 0; i < MAX(samples, 1); i++) {
+                float weight = 1;
+                if (samples) {
+                    weight = gyroUpdateSensor(&gyro.gyroSensor1, i);
+                }
+                if (isGyroSensorCalibrationComplete(&gyro.gyroSensor1)) {
+                    gyro.gyroADC[X] = gyro.gyroSensor1.gyroDev.gyroADC[X] * gyro.gyroSensor1.gyroDev.scale;
+                    gyro.gyroADC[Y] = gyro.gyroSensor1.gyroDev.gyroADC[Y] * gyro.gyroSensor1.gyroDev.scale;
+                    gyro.gyroADC[Z] = gyro.gyroSensor1.gyroDev.gyroADC[Z] * gyro.gyroSensor1.gyroDev.scale;
+                }
+                gyroDownsampleSample(weight);
+            }
         }
         break;
 #ifdef USE_MULTI_GYRO
     case GYRO_CONFIG_USE_GYRO_2:
-        gyroUpdateSensor(&gyro.gyroSensor2);
-        if (isGyroSensorCalibrationComplete(&gyro.gyroSensor2)) {
-            gyro.gyroADC[X] = gyro.gyroSensor2.gyroDev.gyroADC[X] * gyro.gyroSensor2.gyroDev.scale;
-            gyro.gyroADC[Y] = gyro.gyroSensor2.gyroDev.gyroADC[Y] * gyro.gyroSensor2.gyroDev.scale;
-            gyro.gyroADC[Z] = gyro.gyroSensor2.gyroDev.gyroADC[Z] * gyro.gyroSensor2.gyroDev.scale;
+        {
+            const int samples = gyroReadSensor(&gyro.gyroSensor2);
+            for (int i = 0; i < MAX(samples, 1); i++) {
+                float weight = 1;
+                if (samples) {
+                    weight = gyroUpdateSensor(&gyro.gyroSensor2, i);
+                }
+                if (isGyroSensorCalibrationComplete(&gyro.gyroSensor2)) {
+                    gyro.gyroADC[X] = gyro.gyroSensor2.gyroDev.gyroADC[X] * gyro.gyroSensor2.gyroDev.scale;
+                    gyro.gyroADC[Y] = gyro.gyroSensor2.gyroDev.gyroADC[Y] * gyro.gyroSensor2.gyroDev.scale;
+                    gyro.gyroADC[Z] = gyro.gyroSensor2.gyroDev.gyroADC[Z] * gyro.gyroSensor2.gyroDev.scale;
+                }
+                gyroDownsampleSample(weight);
+            }
         }
         break;
     case GYRO_CONFIG_USE_GYRO_BOTH:
-        gyroUpdateSensor(&gyro.gyroSensor1);
-        gyroUpdateSensor(&gyro.gyroSensor2);
-        if (isGyroSensorCalibrationComplete(&gyro.gyroSensor1) && isGyroSensorCalibrationComplete(&gyro.gyroSensor2)) {
-            gyro.gyroADC[X] = ((gyro.gyroSensor1.gyroDev.gyroADC[X] * gyro.gyroSensor1.gyroDev.scale) + (gyro.gyroSensor2.gyroDev.gyroADC[X] * gyro.gyroSensor2.gyroDev.scale)) / 2.0f;
-            gyro.gyroADC[Y] = ((gyro.gyroSensor1.gyroDev.gyroADC[Y] * gyro.gyroSensor1.gyroDev.scale) + (gyro.gyroSensor2.gyroDev.gyroADC[Y] * gyro.gyroSensor2.gyroDev.scale)) / 2.0f;
-            gyro.gyroADC[Z] = ((gyro.gyroSensor1.gyroDev.gyroADC[Z] * gyro.gyroSensor1.gyroDev.scale) + (gyro.gyroSensor2.gyroDev.gyroADC[Z] * gyro.gyroSensor2.gyroDev.scale)) / 2.0f;
+        {
+            // The sensor with fewer new samples repeats its last one, and the
+            // average goes by the times of the first while it has new ones
+            const int samples1 = gyroReadSensor(&gyro.gyroSensor1);
+            const int samples2 = gyroReadSensor(&gyro.gyroSensor2);
+            for (int i = 0; i < MAX(MAX(samples1, samples2), 1); i++) {
+                float weight = 1;
+                if (i < samples1) {
+                    weight = gyroUpdateSensor(&gyro.gyroSensor1, i);
+                }
+                if (i < samples2) {
+                    const float weight2 = gyroUpdateSensor(&gyro.gyroSensor2, i);
+                    if (i >= samples1) {
+                        weight = weight2;
+                    }
+                }
+                if (isGyroSensorCalibrationComplete(&gyro.gyroSensor1) && isGyroSensorCalibrationComplete(&gyro.gyroSensor2)) {
+                    const gyroDev_t *gyroDev1 = &gyro.gyroSensor1.gyroDev;
+                    const gyroDev_t *gyroDev2 = &gyro.gyroSensor2.gyroDev;
+                    const float sample1[XYZ_AXIS_COUNT] = { gyroDev1->gyroADC[X] * gyroDev1->scale, gyroDev1->gyroADC[Y] * gyroDev1->scale, gyroDev1->gyroADC[Z] * gyroDev1->scale };
+                    const float sample2[XYZ_AXIS_COUNT] = { gyroDev2->gyroADC[X] * gyroDev2->scale, gyroDev2->gyroADC[Y] * gyroDev2->scale, gyroDev2->gyroADC[Z] * gyroDev2->scale };
+                    gyroFusionApply(&gyro.fusion, sample1, gyroDev1->gyroADCRaw, sample2, gyroDev2->gyroADCRaw, gyro.gyroADC);
+                }
+                gyroDownsampleSample(weight);
+            }
         }
         break;
 #endif
     }
-
-    if (gyro.downsampleFilterEnabled) {
-        // using gyro lowpass 2 filter for downsampling
-        gyro.sampleSum[X] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[X], gyro.gyroADC[X]);
-        gyro.sampleSum[Y] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[Y], gyro.gyroADC[Y]);
-        gyro.sampleSum[Z] = gyro.lowpass2FilterApplyFn((filter_t *)&gyro.lowpass2Filter[Z], gyro.gyroADC[Z]);
-    } else {
-        // using simple averaging for downsampling
-        gyro.sampleSum[X] += gyro.gyroADC[X];
-        gyro.sampleSum[Y] += gyro.gyroADC[Y];
-        gyro.sampleSum[Z] += gyro.gyroADC[Z];
-        gyro.sampleCount++;
-    }
 }
 
-#define GYRO_FILTER_FUNCTION_NAME filterGyro
 #define GYRO_FILTER_DEBUG_SET(mode, index, value) do { UNUSED(mode); UNUSED(index); UNUSED(value); } while (0)
 #define GYRO_FILTER_AXIS_DEBUG_SET(axis, mode, index, value) do { UNUSED(axis); UNUSED(mode); UNUSED(index); UNUSED(value); } while (0)
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyro
+#define GYRO_FILTER_STATIC 1
+#define GYRO_FILTER_DYN_LPF 1
+#define GYRO_FILTER_DYN_NOTCH 2
+#define GYRO_FILTER_GENERIC 1
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+#undef GYRO_FILTER_STATIC
+#undef GYRO_FILTER_DYN_LPF
+#undef GYRO_FILTER_DYN_NOTCH
+#undef GYRO_FILTER_GENERIC
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroRpm
+#define GYRO_FILTER_STATIC 0
+#define GYRO_FILTER_DYN_LPF 0
+#define GYRO_FILTER_DYN_NOTCH 0
+#define GYRO_FILTER_GENERIC 0
 #include "gyro_filter_impl.c"
 #undef GYRO_FILTER_FUNCTION_NAME
+#undef GYRO_FILTER_STATIC
+#undef GYRO_FILTER_DYN_LPF
+#undef GYRO_FILTER_DYN_NOTCH
+#undef GYRO_FILTER_GENERIC
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroStatic
+#define GYRO_FILTER_STATIC 1
+#define GYRO_FILTER_DYN_LPF 0
+#define GYRO_FILTER_DYN_NOTCH 0
+#define GYRO_FILTER_GENERIC 0
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+#undef GYRO_FILTER_STATIC
+#undef GYRO_FILTER_DYN_LPF
+#undef GYRO_FILTER_DYN_NOTCH
+#undef GYRO_FILTER_GENERIC
+
+#ifdef USE_GYRO_DATA_ANALYSE
+#define GYRO_FILTER_FUNCTION_NAME filterGyroDynNotch
+#define GYRO_FILTER_STATIC 1
+#define GYRO_FILTER_DYN_LPF 0
+#define GYRO_FILTER_DYN_NOTCH 1
+#define GYRO_FILTER_GENERIC 0
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+#undef GYRO_FILTER_STATIC
+#undef GYRO_FILTER_DYN_LPF
+#undef GYRO_FILTER_DYN_NOTCH
+#undef GYRO_FILTER_GENERIC
+
+#define GYRO_FILTER_FUNCTION_NAME filterGyroDynNotch2
+#define GYRO_FILTER_STATIC 1
+#define GYRO_FILTER_DYN_LPF 0
+#define GYRO_FILTER_DYN_NOTCH 2
+#define GYRO_FILTER_GENERIC 0
+#include "gyro_filter_impl.c"
+#undef GYRO_FILTER_FUNCTION_NAME
+#undef GYRO_FILTER_STATIC
+#undef GYRO_FILTER_DYN_LPF
+#undef GYRO_FILTER_DYN_NOTCH
+#undef GYRO_FILTER_GENERIC
+#endif
+
 #undef GYRO_FILTER_DEBUG_SET
 #undef GYRO_FILTER_AXIS_DEBUG_SET
 
 #define GYRO_FILTER_FUNCTION_NAME filterGyroDebug
 #define GYRO_FILTER_DEBUG_SET DEBUG_SET
 #define GYRO_FILTER_AXIS_DEBUG_SET(axis, mode, index, value) if (axis == (int)gyro.gyroDebugAxis) DEBUG_SET(mode, index, value)
+#define GYRO_FILTER_STATIC 1
+#define GYRO_FILTER_DYN_LPF 1
+#define GYRO_FILTER_DYN_NOTCH 2
+#define GYRO_FILTER_GENERIC 1
 #include "gyro_filter_impl.c"
 #undef GYRO_FILTER_FUNCTION_NAME
 #undef GYRO_FILTER_DEBUG_SET
 #undef GYRO_FILTER_AXIS_DEBUG_SET
+#undef GYRO_FILTER_STATIC
+#undef GYRO_FILTER_DYN_LPF
+#undef GYRO_FILTER_DYN_NOTCH
+#undef GYRO_FILTER_GENERIC
 
 FAST_CODE void gyroFiltering(timeUs_t currentTimeUs)
 {
-    if (gyro.gyroDebugMode == DEBUG_NONE) {
-        filterGyro();
-    } else {
+    if (gyro.gyroDebugMode != DEBUG_NONE) {
         filterGyroDebug();
+    } else {
+        switch (gyro.filterChain) {
+        case GYRO_FILTER_CHAIN_RPM:
+            filterGyroRpm();
+            break;
+        case GYRO_FILTER_CHAIN_STATIC:
+            filterGyroStatic();
+            break;
+#ifdef USE_GYRO_DATA_ANALYSE
+        case GYRO_FILTER_CHAIN_DYN_NOTCH:
+            filterGyroDynNotch();
+            break;
+        case GYRO_FILTER_CHAIN_DYN_NOTCH2:
+            filterGyroDynNotch2();
+            break;
+#endif
+        default:
+            filterGyro();
+            break;
+        }
     }
 
 #ifdef USE_GYRO_DATA_ANALYSE
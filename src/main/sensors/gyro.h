@@ -36,6 +36,8 @@
 
 #include "pg/pg.h"
 
+#include "sensors/gyro_fusion.h"
+
 #define FILTER_FREQUENCY_MAX 4000 // maximum frequency for filter cutoffs (nyquist limit of 8K max sampling)
 
 typedef union gyroLowpassFilter_u {
@@ -62,6 +64,7 @@ typedef struct gyroCalibration_s {
 typedef struct gyroSensor_s {
     gyroDev_t gyroDev;
     gyroCalibration_t calibration;
+    timeUs_t sampleTimeUs;             // estimated time of the last FIFO sample downsampled
 } gyroSensor_t;
 
 typedef struct gyro_s {
@@ -73,16 +76,24 @@ typedef struct gyro_s {
     float gyroADCf[XYZ_AXIS_COUNT];    // filtered gyro data
     uint8_t sampleCount;               // gyro sensor sample counter
     float sampleSum[XYZ_AXIS_COUNT];   // summed samples used for downsampling
+    float sampleWeight;                // sample periods in sampleSum
     bool downsampleFilterEnabled;      // if true then downsample using gyro lowpass 2, otherwise use averaging
 
     gyroSensor_t gyroSensor1;
 #ifdef USE_MULTI_GYRO
     gyroSensor_t gyroSensor2;
+    gyroFusion_t fusion;               // combines both sensors for GYRO_CONFIG_USE_GYRO_BOTH
 #endif
 
     gyroDev_t *rawSensorDev;           // pointer to the sensor providing the raw data for DEBUG_GYRO_RAW
 
-    // lowpass gyro soft filter
+    // filter chain variant for the configuration, gyroFilterChain_e
+    uint8_t filterChain;
+
+    // static notches and the lowpass, unless it is dynamic
+    biquadCascade_t staticFilter[XYZ_AXIS_COUNT];
+
+    // dynamic lowpass gyro soft filter
     filterApplyFnPtr lowpassFilterApplyFn;
     gyroLowpassFilter_t lowpassFilter[XYZ_AXIS_COUNT];
 
@@ -90,13 +101,6 @@ typedef struct gyro_s {
     filterApplyFnPtr lowpass2FilterApplyFn;
     gyroLowpassFilter_t lowpass2Filter[XYZ_AXIS_COUNT];
 
-    // notch filters
-    filterApplyFnPtr notchFilter1ApplyFn;
-    biquadFilter_t notchFilter1[XYZ_AXIS_COUNT];
-
-    filterApplyFnPtr notchFilter2ApplyFn;
-    biquadFilter_t notchFilter2[XYZ_AXIS_COUNT];
-
     filterApplyFnPtr notchFilterDynApplyFn;
     filterApplyFnPtr notchFilterDynApplyFn2;
     biquadFilter_t notchFilterDyn[XYZ_AXIS_COUNT];
@@ -134,12 +138,25 @@ enum {
     GYRO_OVERFLOW_CHECK_ALL_AXES
 };
 
+typedef enum {
+    GYRO_FILTER_CHAIN_GENERIC = 0,      // every stage, disabled ones through nullFilterApply
+    GYRO_FILTER_CHAIN_RPM,              // RPM notches only
+    GYRO_FILTER_CHAIN_STATIC,           // RPM notches and the static cascade
+    GYRO_FILTER_CHAIN_DYN_NOTCH,        // the above and one dynamic notch
+    GYRO_FILTER_CHAIN_DYN_NOTCH2,       // the above and both dynamic notches
+} gyroFilterChain_e;
+
 enum {
     DYN_LPF_NONE = 0,
     DYN_LPF_PT1,
     DYN_LPF_BIQUAD
 };
 
+enum {
+    DYN_NOTCH_ANALYSER_FFT = 0,
+    DYN_NOTCH_ANALYSER_SDFT
+};
+
 #define GYRO_CONFIG_USE_GYRO_1      0
 #define GYRO_CONFIG_USE_GYRO_2      1
 #define GYRO_CONFIG_USE_GYRO_BOTH   2
@@ -179,6 +196,7 @@ typedef struct gyroConfig_s {
     uint8_t  dyn_notch_width_percent;
     uint16_t dyn_notch_q;
     uint16_t dyn_notch_min_hz;
+    uint8_t  dyn_notch_analyser;        // FFT over a window or sliding DFT
 
     uint8_t  gyro_filter_debug_axis;
 
@@ -20,8 +20,23 @@
 
 #include "platform.h"
 
+/*
+ * Which stages of the chain are compiled in:
+ *
+ *  GYRO_FILTER_STATIC      the static notch and lowpass cascade
+ *  GYRO_FILTER_DYN_LPF     the dynamic lowpass, through its apply function
+ *  GYRO_FILTER_DYN_NOTCH   how many dynamic notches run, 0 to 2
+ *  GYRO_FILTER_GENERIC     the dynamic notches go through their apply
+ *                          functions, when the dynamic filter is active
+ *
+ * The specialised chains are picked by gyroInitFilters() for the
+ * configuration, so they leave out the runtime checks.
+ */
+
 static FAST_CODE void GYRO_FILTER_FUNCTION_NAME(void)
 {
+    float gyroSample[XYZ_AXIS_COUNT];
+
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
         // DEBUG_GYRO_RAW records the raw value read from the sensor (not zero offset, not scaled)
         GYRO_FILTER_DEBUG_SET(DEBUG_GYRO_RAW, axis, gyro.rawSensorDev->gyroADCRaw[axis]);
@@ -39,9 +54,9 @@ static FAST_CODE void GYRO_FILTER_FUNCTION_NAME(void)
             // using gyro lowpass 2 filter for downsampling
             gyroADCf = gyro.sampleSum[axis];
         } else {
-            // using simple average for downsampling
-            if (gyro.sampleCount) {
-                gyroADCf = gyro.sampleSum[axis] / gyro.sampleCount;
+            // using average over time for downsampling
+            if (gyro.sampleWeight > 0) {
+                gyroADCf = gyro.sampleSum[axis] / gyro.sampleWeight;
             }
             gyro.sampleSum[axis] = 0;
         }
@@ -49,9 +64,10 @@ static FAST_CODE void GYRO_FILTER_FUNCTION_NAME(void)
         // DEBUG_GYRO_SAMPLE(1) Record the post-downsample value for the selected debug axis
         GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 1, lrintf(gyroADCf));
 
-#ifdef USE_GYRO_DATA_ANALYSE
+#if defined(USE_GYRO_DATA_ANALYSE) && GYRO_FILTER_GENERIC
+        // Only debug output, which the specialised chains compile out
         if (isDynamicFilterActive()) {
-            if (axis == gyro.gyroDebugAxis) {
+            if (axis == (int)gyro.gyroDebugAxis) {
                 GYRO_FILTER_DEBUG_SET(DEBUG_FFT, 0, lrintf(gyroADCf));
                 GYRO_FILTER_DEBUG_SET(DEBUG_FFT_FREQ, 3, lrintf(gyroADCf));
                 GYRO_FILTER_DEBUG_SET(DEBUG_DYN_LPF, 0, lrintf(gyroADCf));
@@ -59,31 +75,48 @@ static FAST_CODE void GYRO_FILTER_FUNCTION_NAME(void)
         }
 #endif
 
+        gyroSample[axis] = gyroADCf;
+    }
+
 #ifdef USE_RPM_FILTER
-        gyroADCf = rpmFilterGyro(axis, gyroADCf);
+    // RPM notches are applied to all axes in one pass
+    rpmFilterGyroAxes(gyroSample);
 #endif
 
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        float gyroADCf = gyroSample[axis];
+
         // DEBUG_GYRO_SAMPLE(2) Record the post-RPM Filter value for the selected debug axis
         GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 2, lrintf(gyroADCf));
 
         // apply static notch filters and software lowpass filters
-        gyroADCf = gyro.notchFilter1ApplyFn((filter_t *)&gyro.notchFilter1[axis], gyroADCf);
-        gyroADCf = gyro.notchFilter2ApplyFn((filter_t *)&gyro.notchFilter2[axis], gyroADCf);
+#if GYRO_FILTER_STATIC
+        gyroADCf = biquadCascadeApply(&gyro.staticFilter[axis], gyroADCf);
+#endif
+#if GYRO_FILTER_DYN_LPF
         gyroADCf = gyro.lowpassFilterApplyFn((filter_t *)&gyro.lowpassFilter[axis], gyroADCf);
+#endif
 
         // DEBUG_GYRO_SAMPLE(3) Record the post-static notch and lowpass filter value for the selected debug axis
         GYRO_FILTER_AXIS_DEBUG_SET(axis, DEBUG_GYRO_SAMPLE, 3, lrintf(gyroADCf));
 
-#ifdef USE_GYRO_DATA_ANALYSE
-        if (isDynamicFilterActive()) {
-            if (axis == gyro.gyroDebugAxis) {
+#if defined(USE_GYRO_DATA_ANALYSE) && GYRO_FILTER_DYN_NOTCH
+        if (!GYRO_FILTER_GENERIC || isDynamicFilterActive()) {
+            if (axis == (int)gyro.gyroDebugAxis) {
                 GYRO_FILTER_DEBUG_SET(DEBUG_FFT, 1, lrintf(gyroADCf));
                 GYRO_FILTER_DEBUG_SET(DEBUG_FFT_FREQ, 2, lrintf(gyroADCf));
                 GYRO_FILTER_DEBUG_SET(DEBUG_DYN_LPF, 3, lrintf(gyroADCf));
             }
             gyroDataAnalysePush(&gyro.gyroAnalyseState, axis, gyroADCf);
+#if GYRO_FILTER_GENERIC
             gyroADCf = gyro.notchFilterDynApplyFn((filter_t *)&gyro.notchFilterDyn[axis], gyroADCf);
             gyroADCf = gyro.notchFilterDynApplyFn2((filter_t *)&gyro.notchFilterDyn2[axis], gyroADCf);
+#else
+            gyroADCf = biquadFilterApplyDF1(&gyro.notchFilterDyn[axis], gyroADCf);
+#if GYRO_FILTER_DYN_NOTCH > 1
+            gyroADCf = biquadFilterApplyDF1(&gyro.notchFilterDyn2[axis], gyroADCf);
+#endif
+#endif
         }
 #endif
 
@@ -93,4 +126,5 @@ static FAST_CODE void GYRO_FILTER_FUNCTION_NAME(void)
         gyro.gyroADCf[axis] = gyroADCf;
     }
     gyro.sampleCount = 0;
+    gyro.sampleWeight = 0;
 }
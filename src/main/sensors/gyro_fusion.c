@@ -0,0 +1,134 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Fusion of two gyros on the same frame.
+ *
+ * The difference between the sensors carries no motion, so its variance
+ * is the noise of both together. It is shared out in proportion to how
+ * much each sensor's own reading moves between samples, which is where
+ * resonance and other local noise show. The samples are then weighted by
+ * the inverse of their noise.
+ *
+ * When the sensors disagree by far more than their noise, the quieter
+ * one is used alone for that sample. A sensor that clips or keeps
+ * returning the same reading is left out while it does.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+
+#include "sensors/gyro_fusion.h"
+
+#define NOISE_GAIN  (1.0f / GYRO_FUSION_NOISE_SAMPLES)
+
+void gyroFusionInit(gyroFusion_t *fusion)
+{
+    memset(fusion, 0, sizeof(*fusion));
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        fusion->weight[axis] = 0.5f;
+    }
+}
+
+// True if the sensor is to be left out
+static FAST_CODE bool gyroFusionUpdateFault(gyroFusionSensor_t *sensor, const int16_t *raw)
+{
+    bool clipped = false;
+    bool changed = false;
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        clipped |= (ABS(raw[axis]) >= GYRO_FUSION_CLIP_RAW);
+        changed |= (raw[axis] != sensor->previousRaw[axis]);
+        sensor->previousRaw[axis] = raw[axis];
+    }
+
+    if (clipped) {
+        sensor->clipHoldSamples = GYRO_FUSION_CLIP_HOLD_SAMPLES;
+    } else if (sensor->clipHoldSamples) {
+        sensor->clipHoldSamples--;
+    }
+
+    if (changed) {
+        sensor->stuckSamples = 0;
+    } else if (sensor->stuckSamples < GYRO_FUSION_STUCK_SAMPLES) {
+        sensor->stuckSamples++;
+    }
+
+    return sensor->clipHoldSamples || sensor->stuckSamples >= GYRO_FUSION_STUCK_SAMPLES;
+}
+
+static FAST_CODE void gyroFusionUpdateChange(gyroFusionSensor_t *sensor, int axis, float sample)
+{
+    const float change = sample - sensor->previous[axis];
+
+    sensor->change[axis] += (sq(change) - sensor->change[axis]) * NOISE_GAIN;
+    sensor->previous[axis] = sample;
+}
+
+FAST_CODE void gyroFusionApply(gyroFusion_t *fusion, const float *sample1, const int16_t *raw1, const float *sample2, const int16_t *raw2, float *fused)
+{
+    gyroFusionSensor_t *sensor1 = &fusion->sensor[0];
+    gyroFusionSensor_t *sensor2 = &fusion->sensor[1];
+
+    const bool fault1 = gyroFusionUpdateFault(sensor1, raw1);
+    const bool fault2 = gyroFusionUpdateFault(sensor2, raw2);
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyroFusionUpdateChange(sensor1, axis, sample1[axis]);
+        gyroFusionUpdateChange(sensor2, axis, sample2[axis]);
+
+        if (fault1 != fault2) {
+            fusion->weight[axis] = fault1 ? 0.0f : 1.0f;
+            fused[axis] = fault1 ? sample2[axis] : sample1[axis];
+            continue;
+        }
+
+        // Noise of each sensor, from the noise of the difference
+        const float change1 = sensor1->change[axis] + GYRO_FUSION_NOISE_FLOOR;
+        const float change2 = sensor2->change[axis] + GYRO_FUSION_NOISE_FLOOR;
+        const float share1 = change1 / (change1 + change2);
+        const float noise1 = fusion->diffVariance[axis] * share1 + GYRO_FUSION_NOISE_FLOOR;
+        const float noise2 = fusion->diffVariance[axis] * (1.0f - share1) + GYRO_FUSION_NOISE_FLOOR;
+
+        const float deviation = sample1[axis] - sample2[axis] - fusion->diffMean[axis];
+        const float rejectLimit = GYRO_FUSION_REJECT_SIGMA * sqrtf(fusion->diffVariance[axis]) + GYRO_FUSION_REJECT_MIN_DPS;
+
+        if (fault1 || fabsf(deviation) <= rejectLimit) {
+            // Both faulty gets an even split, as the noise estimates are of no use
+            const float weight1 = fault1 ? 0.5f : noise2 / (noise1 + noise2);
+            fusion->weight[axis] = weight1;
+            fused[axis] = sample1[axis] * weight1 + sample2[axis] * (1.0f - weight1);
+        } else {
+            fusion->weight[axis] = (noise1 < noise2) ? 1.0f : 0.0f;
+            fused[axis] = (noise1 < noise2) ? sample1[axis] : sample2[axis];
+        }
+
+        // An outlier counts no more than the rejection limit
+        if (!fault1) {
+            const float limited = constrainf(deviation, -rejectLimit, rejectLimit);
+            fusion->diffMean[axis] += limited * NOISE_GAIN;
+            fusion->diffVariance[axis] += (sq(limited) - fusion->diffVariance[axis]) * NOISE_GAIN;
+        }
+    }
+}
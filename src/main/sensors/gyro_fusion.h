@@ -0,0 +1,54 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "common/axis.h"
+
+// Time constant of the noise estimates, in samples
+#define GYRO_FUSION_NOISE_SAMPLES       64
+// Noise variance of a quiet sensor, (deg/s)^2
+#define GYRO_FUSION_NOISE_FLOOR         0.01f
+// Disagreement beyond which only the quieter sensor is used
+#define GYRO_FUSION_REJECT_SIGMA        6.0f
+#define GYRO_FUSION_REJECT_MIN_DPS      20.0f
+// Raw readings this large are taken as clipped
+#define GYRO_FUSION_CLIP_RAW            32000
+// Samples a sensor stays out after clipping
+#define GYRO_FUSION_CLIP_HOLD_SAMPLES   500
+// Identical raw readings after which a sensor is taken as stuck
+#define GYRO_FUSION_STUCK_SAMPLES       16
+
+typedef struct gyroFusionSensor_s {
+    float previous[XYZ_AXIS_COUNT];         // last sample
+    float change[XYZ_AXIS_COUNT];           // mean square change between samples
+    int16_t previousRaw[XYZ_AXIS_COUNT];
+    uint16_t stuckSamples;
+    uint16_t clipHoldSamples;
+} gyroFusionSensor_t;
+
+typedef struct gyroFusion_s {
+    gyroFusionSensor_t sensor[2];
+    float diffMean[XYZ_AXIS_COUNT];         // offset between the sensors
+    float diffVariance[XYZ_AXIS_COUNT];     // noise of the difference, that of both sensors together
+    float weight[XYZ_AXIS_COUNT];           // given to the first sensor in the last sample
+} gyroFusion_t;
+
+void gyroFusionInit(gyroFusion_t *fusion);
+void gyroFusionApply(gyroFusion_t *fusion, const float *sample1, const int16_t *raw1, const float *sample2, const int16_t *raw2, float *fused);
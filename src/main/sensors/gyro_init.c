@@ -98,32 +98,33 @@ static uint16_t calculateNyquistAdjustedNotchHz(uint16_t notchHz, uint16_t notch
     return notchHz;
 }
 
-static void gyroInitFilterNotch1(uint16_t notchHz, uint16_t notchCutoffHz)
+static void gyroInitFilterNotch(uint16_t notchHz, uint16_t notchCutoffHz)
 {
-    gyro.notchFilter1ApplyFn = nullFilterApply;
-
     notchHz = calculateNyquistAdjustedNotchHz(notchHz, notchCutoffHz);
 
     if (notchHz != 0 && notchCutoffHz != 0) {
-        gyro.notchFilter1ApplyFn = (filterApplyFnPtr)biquadFilterApply;
         const float notchQ = filterGetNotchQ(notchHz, notchCutoffHz);
         for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilterInit(&gyro.notchFilter1[axis], notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
+            biquadCascadeAdd(&gyro.staticFilter[axis], notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
         }
     }
 }
 
-static void gyroInitFilterNotch2(uint16_t notchHz, uint16_t notchCutoffHz)
+static void gyroInitFilterStaticLowpass(int type, uint16_t lpfHz)
 {
-    gyro.notchFilter2ApplyFn = nullFilterApply;
-
-    notchHz = calculateNyquistAdjustedNotchHz(notchHz, notchCutoffHz);
+    const uint32_t gyroFrequencyNyquist = 1000000 / 2 / gyro.targetLooptime;
+    const float gyroDt = gyro.targetLooptime * 1e-6f;
 
-    if (notchHz != 0 && notchCutoffHz != 0) {
-        gyro.notchFilter2ApplyFn = (filterApplyFnPtr)biquadFilterApply;
-        const float notchQ = filterGetNotchQ(notchHz, notchCutoffHz);
+    if (lpfHz && lpfHz <= gyroFrequencyNyquist) {
         for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
-            biquadFilterInit(&gyro.notchFilter2[axis], notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
+            switch (type) {
+            case FILTER_PT1:
+                biquadCascadeAddPT1(&gyro.staticFilter[axis], pt1FilterGain(lpfHz, gyroDt));
+                break;
+            case FILTER_BIQUAD:
+                biquadCascadeAddLPF(&gyro.staticFilter[axis], lpfHz, gyro.targetLooptime);
+                break;
+            }
         }
     }
 }
@@ -207,6 +208,22 @@ static bool gyroInitLowpassFilterLpf(int slot, int type, uint16_t lpfHz, uint32_
     return ret;
 }
 
+// The chain variant that runs only the stages the configuration uses
+static gyroFilterChain_e gyroFilterChainSelect(void)
+{
+    if (gyro.lowpassFilterApplyFn != nullFilterApply) {
+        return GYRO_FILTER_CHAIN_GENERIC;
+    }
+
+#ifdef USE_GYRO_DATA_ANALYSE
+    if (isDynamicFilterActive()) {
+        return (gyro.notchFilterDynApplyFn2 != nullFilterApply) ? GYRO_FILTER_CHAIN_DYN_NOTCH2 : GYRO_FILTER_CHAIN_DYN_NOTCH;
+    }
+#endif
+
+    return (gyro.staticFilter[0].stageCount > 0) ? GYRO_FILTER_CHAIN_STATIC : GYRO_FILTER_CHAIN_RPM;
+}
+
 #ifdef USE_DYN_LPF
 static void dynLpfFilterInit()
 {
@@ -232,20 +249,28 @@ static void dynLpfFilterInit()
 
 void gyroInitFilters(void)
 {
-    uint16_t gyro_lowpass_hz = gyroConfig()->gyro_lowpass_hz;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        biquadCascadeInit(&gyro.staticFilter[axis]);
+    }
+
+    gyroInitFilterNotch(gyroConfig()->gyro_soft_notch_hz_1, gyroConfig()->gyro_soft_notch_cutoff_1);
+    gyroInitFilterNotch(gyroConfig()->gyro_soft_notch_hz_2, gyroConfig()->gyro_soft_notch_cutoff_2);
 
 #ifdef USE_DYN_LPF
     if (gyroConfig()->dyn_lpf_gyro_min_hz > 0) {
-        gyro_lowpass_hz = gyroConfig()->dyn_lpf_gyro_min_hz;
+        // Coefficients change in flight, so not in the cascade
+        gyroInitLowpassFilterLpf(
+          FILTER_LOWPASS,
+          gyroConfig()->gyro_lowpass_type,
+          gyroConfig()->dyn_lpf_gyro_min_hz,
+          gyro.targetLooptime
+        );
+    } else
+#endif
+    {
+        gyro.lowpassFilterApplyFn = nullFilterApply;
+        gyroInitFilterStaticLowpass(gyroConfig()->gyro_lowpass_type, gyroConfig()->gyro_lowpass_hz);
     }
-#endif
-
-    gyroInitLowpassFilterLpf(
-      FILTER_LOWPASS,
-      gyroConfig()->gyro_lowpass_type,
-      gyro_lowpass_hz,
-      gyro.targetLooptime
-    );
 
     gyro.downsampleFilterEnabled = gyroInitLowpassFilterLpf(
       FILTER_LOWPASS2,
@@ -253,9 +278,6 @@ void gyroInitFilters(void)
       gyroConfig()->gyro_lowpass2_hz,
       gyro.sampleLooptime
     );
-
-    gyroInitFilterNotch1(gyroConfig()->gyro_soft_notch_hz_1, gyroConfig()->gyro_soft_notch_cutoff_1);
-    gyroInitFilterNotch2(gyroConfig()->gyro_soft_notch_hz_2, gyroConfig()->gyro_soft_notch_cutoff_2);
 #ifdef USE_GYRO_DATA_ANALYSE
     gyroInitFilterDynamicNotch();
 #endif
@@ -265,6 +287,8 @@ void gyroInitFilters(void)
 #ifdef USE_GYRO_DATA_ANALYSE
     gyroDataAnalyseStateInit(&gyro.gyroAnalyseState, gyro.targetLooptime);
 #endif
+
+    gyro.filterChain = gyroFilterChainSelect();
 }
 
 #if defined(USE_GYRO_SLEW_LIMITER)
@@ -550,6 +574,10 @@ bool gyroInit(void)
     gyro.useDualGyroDebugging = false;
     gyro.gyroHasOverflowProtection = true;
 
+#ifdef USE_MULTI_GYRO
+    gyroFusionInit(&gyro.fusion);
+#endif
+
     switch (debugMode) {
     case DEBUG_FFT:
     case DEBUG_FFT_FREQ:
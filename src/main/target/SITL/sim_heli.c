@@ -0,0 +1,162 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "common/maths.h"
+
+#include "sim_heli.h"
+
+
+void simHeliDefaults(simHeliParams_t *params)
+{
+    // Roughly a 700 size helicopter
+    params->headspeedMax     = 2600;
+    params->spoolTime        = 0.8f;
+    params->collectiveLoad   = 0.15f;
+    params->motorRatio       = 10.0f;
+    params->tailRatio        = 4.5f;
+    params->cyclicRate       = 450;
+    params->cyclicTime       = 0.05f;
+    params->yawRate          = 900;
+    params->yawTime          = 0.08f;
+    params->torqueYaw        = 250;
+    params->vibration        = 20;
+    params->noise            = 4;
+    params->swashAzimuth[0]  = 0;
+    params->swashAzimuth[1]  = 120;
+    params->swashAzimuth[2]  = 240;
+}
+
+void simHeliInit(simHeliState_t *state)
+{
+    memset(state, 0, sizeof(*state));
+
+    state->quat[0] = 1;
+    state->acc[2] = 1;
+    state->seed = 0x1234567;
+}
+
+static float simHeliNoise(uint32_t *seed)
+{
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 17;
+    *seed ^= *seed << 5;
+    return (*seed & 0xFFFFFF) / (float)0x800000 - 1.0f;
+}
+
+static float simHeliWrap(float phase)
+{
+    return (phase >= 2 * M_PIf) ? phase - 2 * M_PIf : phase;
+}
+
+// Servo i moves by collective + pitch * cos(azimuth) + roll * sin(azimuth)
+static void simHeliDecodeSwash(simHeliState_t *state, const simHeliParams_t *params, const float *swash)
+{
+    float collective = 0, roll = 0, pitch = 0;
+
+    for (int i = 0; i < SIM_HELI_SWASH_SERVOS; i++) {
+        const float azimuth = DEGREES_TO_RADIANS(params->swashAzimuth[i]);
+        collective += swash[i];
+        pitch += swash[i] * cos_approx(azimuth);
+        roll  += swash[i] * sin_approx(azimuth);
+    }
+
+    state->collective = collective / SIM_HELI_SWASH_SERVOS;
+    state->pitch = pitch * 2 / SIM_HELI_SWASH_SERVOS;
+    state->roll  = roll * 2 / SIM_HELI_SWASH_SERVOS;
+}
+
+static void simHeliIntegrateAttitude(simHeliState_t *state, float dt)
+{
+    const float gx = DEGREES_TO_RADIANS(state->rate[0]) * 0.5f * dt;
+    const float gy = DEGREES_TO_RADIANS(state->rate[1]) * 0.5f * dt;
+    const float gz = DEGREES_TO_RADIANS(state->rate[2]) * 0.5f * dt;
+
+    float *q = state->quat;
+    const float w = q[0], x = q[1], y = q[2], z = q[3];
+
+    // Same convention as imuMahonyAHRSupdate()
+    q[0] += (-x * gx - y * gy - z * gz);
+    q[1] += (+w * gx + y * gz - z * gy);
+    q[2] += (+w * gy - x * gz + z * gx);
+    q[3] += (+w * gz + x * gy - y * gx);
+
+    const float recipNorm = 1.0f / sqrtf(sq(q[0]) + sq(q[1]) + sq(q[2]) + sq(q[3]));
+    for (int i = 0; i < 4; i++) {
+        q[i] *= recipNorm;
+    }
+
+    // Gravity in body frame, as rMat[2][] in imu.c
+    state->acc[0] = 2.0f * (q[1] * q[3] - q[0] * q[2]);
+    state->acc[1] = 2.0f * (q[2] * q[3] + q[0] * q[1]);
+    state->acc[2] = 1.0f - 2.0f * (q[1] * q[1] + q[2] * q[2]);
+}
+
+void simHeliStep(simHeliState_t *state, const simHeliParams_t *params, const simHeliInput_t *input, float dt)
+{
+    simHeliDecodeSwash(state, params, input->swash);
+
+    // Rotor spool, loaded by blade pitch in either direction
+    const float throttle = constrainf(input->throttle, 0, 1);
+    const float target = throttle * params->headspeedMax * (1 - params->collectiveLoad * fabsf(state->collective));
+    state->headspeed += (target - state->headspeed) * dt / params->spoolTime;
+
+    // Control authority grows with the square of the rotor speed
+    const float speed = state->headspeed / params->headspeedMax;
+    const float authority = speed * speed;
+
+    const float rollCmd  = params->cyclicRate * state->roll * authority;
+    const float pitchCmd = params->cyclicRate * state->pitch * authority;
+    const float yawCmd   = params->yawRate * input->tail * authority -
+                           params->torqueYaw * fabsf(state->collective) * authority;
+
+    state->rate[0] += (rollCmd  - state->rate[0]) * dt / params->cyclicTime;
+    state->rate[1] += (pitchCmd - state->rate[1]) * dt / params->cyclicTime;
+    state->rate[2] += (yawCmd   - state->rate[2]) * dt / params->yawTime;
+
+    simHeliIntegrateAttitude(state, dt);
+
+    // Rotor harmonics
+    const float mainHz = state->headspeed / 60;
+    state->phaseMain  = simHeliWrap(state->phaseMain  + 2 * M_PIf * mainHz * dt);
+    state->phaseTail  = simHeliWrap(state->phaseTail  + 2 * M_PIf * mainHz * params->tailRatio * dt);
+    state->phaseMotor = simHeliWrap(state->phaseMotor + 2 * M_PIf * mainHz * params->motorRatio * dt);
+
+    const float vib = params->vibration * authority;
+    const float main1P = sin_approx(state->phaseMain);
+    const float main1Pq = cos_approx(state->phaseMain);
+    const float main2P = sin_approx(2 * state->phaseMain);
+    const float tail1P = sin_approx(state->phaseTail);
+    const float motor1P = sin_approx(state->phaseMotor);
+
+    state->gyro[0] = state->rate[0] + vib * (main1P + 0.4f * main2P + 0.2f * motor1P) + params->noise * simHeliNoise(&state->seed);
+    state->gyro[1] = state->rate[1] + vib * (main1Pq + 0.4f * main2P + 0.2f * motor1P) + params->noise * simHeliNoise(&state->seed);
+    state->gyro[2] = state->rate[2] + vib * (0.6f * tail1P + 0.2f * main1P + 0.2f * motor1P) + params->noise * simHeliNoise(&state->seed);
+}
+
+float simHeliMotorRPM(const simHeliState_t *state, const simHeliParams_t *params)
+{
+    return state->headspeed * params->motorRatio;
+}
+
+float simHeliTailRPM(const simHeliState_t *state, const simHeliParams_t *params)
+{
+    return state->headspeed * params->tailRatio;
+}
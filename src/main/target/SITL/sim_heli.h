@@ -0,0 +1,86 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Built-in helicopter plant for the headless SITL mode.
+ *
+ * A deliberately simple model: first order rotor spool with collective
+ * load, first order body rate response to cyclic and tail pitch scaled by
+ * rotor speed squared, main rotor torque coupling into yaw, and rotor
+ * harmonics on the gyro. Translation is not modelled; the accelerometer
+ * sees gravity only.
+ *
+ * All rates are in the flight controller body frame, in deg/s.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#define SIM_HELI_SWASH_SERVOS   3
+
+typedef struct simHeliParams_s {
+    float headspeedMax;         // rotor rpm at full throttle, unloaded
+    float spoolTime;            // s, rotor speed time constant
+    float collectiveLoad;       // relative headspeed droop at full collective
+    float motorRatio;           // motor rpm / main rotor rpm
+    float tailRatio;            // tail rotor rpm / main rotor rpm
+    float cyclicRate;           // deg/s at full cyclic, full headspeed
+    float cyclicTime;           // s, roll/pitch rate time constant
+    float yawRate;              // deg/s at full tail pitch, full headspeed
+    float yawTime;              // s, yaw rate time constant
+    float torqueYaw;            // deg/s yaw induced by full collective
+    float vibration;            // deg/s rotor 1P amplitude at full headspeed
+    float noise;                // deg/s broadband gyro noise
+    float swashAzimuth[SIM_HELI_SWASH_SERVOS];   // deg, servo positions from the nose, clockwise
+} simHeliParams_t;
+
+typedef struct simHeliInput_s {
+    float throttle;                             // main motor 0..1
+    float swash[SIM_HELI_SWASH_SERVOS];         // swash servos -1..1
+    float tail;                                 // tail pitch servo -1..1
+} simHeliInput_t;
+
+typedef struct simHeliState_s {
+    // Rotor
+    float headspeed;            // rpm
+    float phaseMain;            // rad
+    float phaseTail;            // rad
+    float phaseMotor;           // rad
+
+    // Decoded swash
+    float collective;
+    float roll;
+    float pitch;
+
+    // Airframe
+    float rate[3];              // deg/s, noise free
+    float quat[4];              // w, x, y, z
+
+    // Sensors
+    float gyro[3];              // deg/s
+    float acc[3];               // g
+
+    uint32_t seed;
+} simHeliState_t;
+
+void simHeliDefaults(simHeliParams_t *params);
+void simHeliInit(simHeliState_t *state);
+void simHeliStep(simHeliState_t *state, const simHeliParams_t *params, const simHeliInput_t *input, float dt);
+
+float simHeliMotorRPM(const simHeliState_t *state, const simHeliParams_t *params);
+float simHeliTailRPM(const simHeliState_t *state, const simHeliParams_t *params);
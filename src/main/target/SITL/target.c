@@ -19,6 +19,7 @@
  */
 
 #include <stdint.h>
+#include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
@@ -44,6 +45,8 @@ const timerHardware_t timerHardware[1]; // unused
 
 #include "drivers/accgyro/accgyro_fake.h"
 #include "flight/imu.h"
+#include "flight/pid.h"
+#include "flight/servos.h"
 
 #include "config/feature.h"
 #include "config/config.h"
@@ -53,9 +56,11 @@ const timerHardware_t timerHardware[1]; // unused
 #include "pg/motor.h"
 
 #include "rx/rx.h"
+#include "rx/msp.h"
 
 #include "dyad.h"
 #include "target/SITL/udplink.h"
+#include "target/SITL/sim_heli.h"
 
 uint32_t SystemCoreClock;
 
@@ -70,6 +75,36 @@ static udpLink_t stateLink, pwmLink;
 static pthread_mutex_t updateLock;
 static pthread_mutex_t mainLoopLock;
 
+// Headless lockstep mode
+static bool simLockstep = false;
+static uint64_t simTimeUs;
+static uint64_t simModelTimeUs;
+static uint64_t simDurationUs;
+static uint32_t simTickUs = SIMULATOR_LOCKSTEP_TICK_US;
+static simHeliParams_t simParams;
+static simHeliState_t simState;
+
+static FILE *simRcFile;
+static uint64_t simRcNextUs;
+static uint64_t simRcSentUs;
+static uint16_t simRcFrame[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+static uint16_t simRcNext[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+static int simRcChannels;
+static int simRcNextChannels;
+static bool simRcActive;
+
+static FILE *simLogFile;
+static uint64_t simLogNextUs;
+
+static uint64_t simPassCount;
+static uint64_t simPassStartNs;
+static uint64_t simCpuNs;
+static uint64_t simCpuMaxNs;
+static uint64_t simWallStartNs;
+
+static void simulatorLockstepInit(void);
+static void simulatorAdvance(uint64_t us);
+
 int timeval_sub(struct timespec *result, struct timespec *x, struct timespec *y);
 
 int lockMainPID(void) {
@@ -215,6 +250,9 @@ void systemInit(void) {
 
     SystemCoreClock = 500 * 1e6; // fake 500MHz
 
+    const char *lockstep = getenv("SITL_LOCKSTEP");
+    simLockstep = (lockstep != NULL && atoi(lockstep) > 0);
+
     if (pthread_mutex_init(&updateLock, NULL) != 0) {
         printf("Create updateLock error!\n");
         exit(1);
@@ -231,6 +269,11 @@ void systemInit(void) {
         exit(1);
     }
 
+    if (simLockstep) {
+        simulatorLockstepInit();
+        return;
+    }
+
     ret = udpInit(&pwmLink, "127.0.0.1", 9002, false);
     printf("init PwmOut UDP link...%d\n", ret);
 
@@ -251,7 +294,9 @@ void systemReset(void){
     printf("[system]Reset!\n");
     workerRunning = false;
     pthread_join(tcpWorker, NULL);
-    pthread_join(udpWorker, NULL);
+    if (!simLockstep) {
+        pthread_join(udpWorker, NULL);
+    }
     exit(0);
 }
 void systemResetToBootloader(bootloaderRequestType_e requestType) {
@@ -260,7 +305,9 @@ void systemResetToBootloader(bootloaderRequestType_e requestType) {
     printf("[system]ResetToBootloader!\n");
     workerRunning = false;
     pthread_join(tcpWorker, NULL);
-    pthread_join(udpWorker, NULL);
+    if (!simLockstep) {
+        pthread_join(udpWorker, NULL);
+    }
     exit(0);
 }
 
@@ -303,6 +350,10 @@ uint64_t millis64_real() {
 }
 
 uint64_t micros64() {
+    if (simLockstep) {
+        return simTimeUs;
+    }
+
     static uint64_t last = 0;
     static uint64_t out = 0;
     uint64_t now = nanos64_real();
@@ -315,6 +366,10 @@ uint64_t micros64() {
 }
 
 uint64_t millis64() {
+    if (simLockstep) {
+        return simTimeUs / 1000;
+    }
+
     static uint64_t last = 0;
     static uint64_t out = 0;
     uint64_t now = nanos64_real();
@@ -342,6 +397,11 @@ void microsleep(uint32_t usec) {
 }
 
 void delayMicroseconds(uint32_t us) {
+    if (simLockstep) {
+        simulatorAdvance(us);
+        return;
+    }
+
     microsleep(us / simRate);
 }
 
@@ -350,6 +410,11 @@ void delayMicroseconds_real(uint32_t us) {
 }
 
 void delay(uint32_t ms) {
+    if (simLockstep) {
+        simulatorAdvance(ms * 1000ULL);
+        return;
+    }
+
     uint64_t start = millis64();
 
     while ((millis64() - start) < ms) {
@@ -448,6 +513,10 @@ static void pwmCompleteMotorUpdate(void)
     // send to simulator
     // for gazebo8 ArduCopterPlugin remap, normal range = [0.0, 1.0], 3D rang = [-1.0, 1.0]
 
+    if (simLockstep) {
+        return;
+    }
+
     double outScale = 1000.0;
 
     pwmPkt.motor_speed[3] = motorsPwm[0] / outScale;
@@ -502,6 +571,253 @@ motorDevice_t *motorPwmDevInit(const motorDevConfig_t *motorConfig, uint16_t _id
     return &motorPwmDevice;
 }
 
+// Headless lockstep simulation
+//
+// The scheduler runs in virtual time against the helicopter model in
+// sim_heli.c. Time only moves by a fixed tick after each pass through the
+// main loop, and by the requested amount in delay(), so a run never waits
+// on the wall clock and is repeatable from one run to the next.
+
+static uint64_t simulatorCpuNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// RC script line: <time s> <ch1> <ch2> ... separated by spaces or commas
+static bool simulatorReadRc(void)
+{
+    char line[256];
+
+    while (fgets(line, sizeof(line), simRcFile)) {
+        char *ptr = line;
+        char *end;
+
+        if (*ptr == '#') {
+            continue;
+        }
+
+        const double time = strtod(ptr, &end);
+        if (end == ptr) {
+            continue;
+        }
+
+        simRcNextUs = time * 1e6;
+        simRcNextChannels = 0;
+
+        for (ptr = end; simRcNextChannels < MAX_SUPPORTED_RC_CHANNEL_COUNT; ptr = end) {
+            while (*ptr == ' ' || *ptr == '\t' || *ptr == ',') {
+                ptr++;
+            }
+            const long value = strtol(ptr, &end, 10);
+            if (end == ptr) {
+                break;
+            }
+            simRcNext[simRcNextChannels++] = value;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+static void simulatorUpdateRc(void)
+{
+    while (simRcFile && simTimeUs >= simRcNextUs) {
+        memcpy(simRcFrame, simRcNext, sizeof(simRcFrame));
+        simRcChannels = simRcNextChannels;
+        simRcActive = true;
+
+        if (!simulatorReadRc()) {
+            fclose(simRcFile);
+            simRcFile = NULL;
+        }
+    }
+
+    // Keep sending the last frame, so MSP RX does not drop into failsafe
+    if (simRcActive && simTimeUs >= simRcSentUs + SIMULATOR_RC_PERIOD_US) {
+        rxMspFrameReceive(simRcFrame, simRcChannels);
+        simRcSentUs = simTimeUs;
+    }
+}
+
+static float simulatorServoInput(int index)
+{
+    // Servo outputs not written yet read as centred
+    if (servosPwm[index] == 0) {
+        return 0;
+    }
+
+    return constrainf((servosPwm[index] - DEFAULT_SERVO_CENTER) / 500.0f, -1, 1);
+}
+
+static void simulatorModelStep(void)
+{
+    simHeliInput_t input;
+
+    input.throttle = motorsPwm[0] / 1000.0f;
+    for (int i = 0; i < SIM_HELI_SWASH_SERVOS; i++) {
+        input.swash[i] = simulatorServoInput(i);
+    }
+    input.tail = simulatorServoInput(SIM_HELI_SWASH_SERVOS);
+
+    simHeliStep(&simState, &simParams, &input, SIMULATOR_MODEL_STEP_US * 1e-6f);
+
+    if (fakeGyroDev) {
+        fakeGyroSet(fakeGyroDev,
+            constrain(simState.gyro[0] * (float)GYRO_SCALE, -32767, 32767),
+            constrain(simState.gyro[1] * (float)GYRO_SCALE, -32767, 32767),
+            constrain(simState.gyro[2] * (float)GYRO_SCALE, -32767, 32767));
+    }
+
+    if (fakeAccDev) {
+        fakeAccSet(fakeAccDev,
+            constrain(simState.acc[0] * 256, -32767, 32767),
+            constrain(simState.acc[1] * 256, -32767, 32767),
+            constrain(simState.acc[2] * 256, -32767, 32767));
+    }
+
+#if !defined(USE_IMU_CALC)
+    imuSetAttitudeQuat(simState.quat[0], simState.quat[1], simState.quat[2], simState.quat[3]);
+#endif
+
+    if (simLogFile && simModelTimeUs >= simLogNextUs) {
+        fprintf(simLogFile, "%" PRIu64 ",%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.1f,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+                simModelTimeUs,
+                (double)simState.gyro[0], (double)simState.gyro[1], (double)simState.gyro[2],
+                (double)simState.rate[0], (double)simState.rate[1], (double)simState.rate[2],
+                (double)simState.headspeed, (double)input.throttle,
+                (double)simState.collective, (double)simState.roll, (double)simState.pitch, (double)input.tail);
+        simLogNextUs += SIMULATOR_LOG_PERIOD_US;
+    }
+}
+
+static void simulatorAdvance(uint64_t us)
+{
+    simTimeUs += us;
+
+    while (simModelTimeUs + SIMULATOR_MODEL_STEP_US <= simTimeUs) {
+        simModelTimeUs += SIMULATOR_MODEL_STEP_US;
+        simulatorModelStep();
+    }
+}
+
+static void simulatorFinish(void)
+{
+    const double simTime = simTimeUs * 1e-6;
+    const double wallTime = (nanos64_real() - simWallStartNs) * 1e-9;
+    const uint64_t passes = simPassCount - 1;
+    const uint64_t pidLoops = targetPidLooptime ? simTimeUs / targetPidLooptime : 0;
+
+    printf("[sim]%.3f s simulated in %.3f s (x%.1f)\n", simTime, wallTime, simTime / wallTime);
+    printf("[sim]%" PRIu64 " scheduler passes, CPU %.0f ns/pass avg, %" PRIu64 " ns max\n",
+           passes, passes ? (double)simCpuNs / passes : 0.0, simCpuMaxNs);
+    printf("[sim]%" PRIu64 " PID loops, CPU %.2f us/loop\n",
+           pidLoops, pidLoops ? simCpuNs * 1e-3 / pidLoops : 0.0);
+
+    if (simLogFile) {
+        fclose(simLogFile);
+    }
+
+    workerRunning = false;
+    pthread_join(tcpWorker, NULL);
+    exit(0);
+}
+
+static void simulatorLockstepInit(void)
+{
+    const char *env;
+
+    simHeliDefaults(&simParams);
+    simHeliInit(&simState);
+
+    if ((env = getenv("SITL_TICK_US")) && atoi(env) > 0) {
+        simTickUs = atoi(env);
+    }
+
+    if ((env = getenv("SITL_DURATION"))) {
+        simDurationUs = strtod(env, NULL) * 1e6;
+    }
+
+    if ((env = getenv("SITL_RC"))) {
+        if ((simRcFile = fopen(env, "r")) == NULL) {
+            fprintf(stderr, "[sim]failed to open RC script '%s': %s\n", env, strerror(errno));
+            exit(1);
+        }
+        if (!simulatorReadRc()) {
+            fclose(simRcFile);
+            simRcFile = NULL;
+        }
+    }
+
+    if ((env = getenv("SITL_LOG"))) {
+        if ((simLogFile = fopen(env, "w")) == NULL) {
+            fprintf(stderr, "[sim]failed to create log '%s': %s\n", env, strerror(errno));
+            exit(1);
+        }
+        fprintf(simLogFile, "time,gyro[0],gyro[1],gyro[2],rate[0],rate[1],rate[2],headspeed,throttle,collective,roll,pitch,tail\n");
+    }
+
+    printf("[sim]Lockstep, tick %u us, model step %u us\n", simTickUs, SIMULATOR_MODEL_STEP_US);
+
+    simWallStartNs = nanos64_real();
+    simPassStartNs = simulatorCpuNs();
+}
+
+void simulatorLoop(void)
+{
+    if (!simLockstep) {
+        delayMicroseconds_real(50); // max rate 20kHz
+        return;
+    }
+
+    // CPU time of the scheduler pass that just finished
+    const uint64_t passNs = simulatorCpuNs() - simPassStartNs;
+    if (simPassCount++ > 0) {
+        simCpuNs += passNs;
+        simCpuMaxNs = MAX(simCpuMaxNs, passNs);
+    }
+
+    simulatorUpdateRc();
+    simulatorAdvance(simTickUs);
+
+    if (simDurationUs && simTimeUs >= simDurationUs) {
+        simulatorFinish();
+    }
+
+    simPassStartNs = simulatorCpuNs();
+}
+
+bool simulatorHasMotorRPM(void)
+{
+    return simLockstep;
+}
+
+int simulatorGetMotorERPM(uint8_t motor)
+{
+    float rpm;
+
+    if (!simLockstep) {
+        return 0;
+    }
+
+    // The tail rotor is driven off the main rotor, a tail motor turns with it
+    switch (motor) {
+        case 0:
+            rpm = simHeliMotorRPM(&simState, &simParams);
+            break;
+        case 1:
+            rpm = simHeliTailRPM(&simState, &simParams);
+            break;
+        default:
+            return 0;
+    }
+
+    return rpm * (motorConfig()->motorPoleCount[motor] / 2) / 100;
+}
+
 // ADC part
 uint16_t adcGetChannel(uint8_t channel) {
     UNUSED(channel);
@@ -513,7 +829,30 @@ char _estack;
 char _Min_Stack_Size;
 
 // fake EEPROM
+//
+// Behaves as flash: erasing sets a page to 0xFF, and only erased words can
+// be programmed. Every erase and word is written through to the file, so
+// the file holds what the flash would if the process is killed mid-save.
+// Setting SITL_EEPROM_CUT_WORDS=N in the environment ends the process after
+// N words are programmed, as a power cut.
 static FILE *eepromFd = NULL;
+static struct timespec eepromUnlockTime;
+static unsigned eepromPagesErased;
+static unsigned eepromWordsWritten;
+static long eepromCutWords = -1;
+
+static void eepromWriteThrough(uintptr_t addr, size_t size)
+{
+    const size_t offset = addr - (uintptr_t)eepromData;
+
+    if (eepromFd != NULL) {
+        fseek(eepromFd, offset, SEEK_SET);
+        if (fwrite(eepromData + offset, size, 1, eepromFd) != 1) {
+            fprintf(stderr, "[FLASH] write failed: %s\n", strerror(errno));
+        }
+        fflush(eepromFd);
+    }
+}
 
 void FLASH_Unlock(void) {
     if (eepromFd != NULL) {
@@ -521,6 +860,13 @@ void FLASH_Unlock(void) {
         return;
     }
 
+    clock_gettime(CLOCK_MONOTONIC, &eepromUnlockTime);
+    eepromPagesErased = 0;
+    eepromWordsWritten = 0;
+
+    const char *cut = getenv("SITL_EEPROM_CUT_WORDS");
+    eepromCutWords = cut ? atol(cut) : -1;
+
     // open or create
     eepromFd = fopen(EEPROM_FILENAME,"r+");
     if (eepromFd != NULL) {
@@ -529,6 +875,8 @@ void FLASH_Unlock(void) {
         size_t lSize = ftell(eepromFd);
         rewind(eepromFd);
 
+        // anything past the end of a shorter file is erased
+        memset(eepromData, 0xFF, sizeof(eepromData));
         size_t n = fread(eepromData, 1, sizeof(eepromData), eepromFd);
         if (n == lSize) {
             printf("[FLASH_Unlock] loaded '%s', size = %ld / %ld\n", EEPROM_FILENAME, lSize, sizeof(eepromData));
@@ -542,6 +890,7 @@ void FLASH_Unlock(void) {
             fprintf(stderr, "[FLASH_Unlock] failed to create '%s'\n", EEPROM_FILENAME);
             return;
         }
+        memset(eepromData, 0xFF, sizeof(eepromData));
         if (fwrite(eepromData, sizeof(eepromData), 1, eepromFd) != 1) {
             fprintf(stderr, "[FLASH_Unlock] write failed: %s\n", strerror(errno));
         }
@@ -551,28 +900,48 @@ void FLASH_Unlock(void) {
 void FLASH_Lock(void) {
     // flush & close
     if (eepromFd != NULL) {
-        fseek(eepromFd, 0, SEEK_SET);
-        fwrite(eepromData, 1, sizeof(eepromData), eepromFd);
         fclose(eepromFd);
         eepromFd = NULL;
-        printf("[FLASH_Lock] saved '%s'\n", EEPROM_FILENAME);
+
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        const long elapsedUs = (now.tv_sec - eepromUnlockTime.tv_sec) * 1000000 + (now.tv_nsec - eepromUnlockTime.tv_nsec) / 1000;
+
+        printf("[FLASH_Lock] saved '%s', %u pages erased, %u words written, %ld us\n",
+            EEPROM_FILENAME, eepromPagesErased, eepromWordsWritten, elapsedUs);
     } else {
         fprintf(stderr, "[FLASH_Lock] eeprom is not unlocked\n");
     }
 }
 
 FLASH_Status FLASH_ErasePage(uintptr_t Page_Address) {
-    UNUSED(Page_Address);
-//    printf("[FLASH_ErasePage]%x\n", Page_Address);
+    if ((Page_Address >= (uintptr_t)eepromData) && (Page_Address + FLASH_PAGE_SIZE <= (uintptr_t)ARRAYEND(eepromData))) {
+        memset((void *)Page_Address, 0xFF, FLASH_PAGE_SIZE);
+        eepromWriteThrough(Page_Address, FLASH_PAGE_SIZE);
+        eepromPagesErased++;
+    } else {
+        printf("[FLASH_ErasePage]%p out of range!\n", (void*)Page_Address);
+        return FLASH_ERROR_PG;
+    }
     return FLASH_COMPLETE;
 }
 
 FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t value) {
     if ((addr >= (uintptr_t)eepromData) && (addr < (uintptr_t)ARRAYEND(eepromData))) {
+        if (eepromCutWords >= 0 && eepromWordsWritten >= (unsigned long)eepromCutWords) {
+            printf("[FLASH_ProgramWord] power cut after %u words\n", eepromWordsWritten);
+            exit(1);
+        }
+        if (*((uint32_t*)addr) != 0xFFFFFFFF) {
+            printf("[FLASH_ProgramWord]%p = %08x over %08x, not erased!\n", (void*)addr, value, *((uint32_t*)addr));
+            return FLASH_ERROR_PG;
+        }
         *((uint32_t*)addr) = value;
-        printf("[FLASH_ProgramWord]%p = %08x\n", (void*)addr, *((uint32_t*)addr));
+        eepromWriteThrough(addr, sizeof(value));
+        eepromWordsWritten++;
     } else {
-            printf("[FLASH_ProgramWord]%p out of range!\n", (void*)addr);
+        printf("[FLASH_ProgramWord]%p out of range!\n", (void*)addr);
+        return FLASH_ERROR_PG;
     }
     return FLASH_COMPLETE;
 }
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
@@ -40,10 +41,17 @@
 //#define SIMULATOR_IMU_SYNC
 //#define SIMULATOR_GYROPID_SYNC
 
+// headless lockstep mode with the built-in helicopter model, SITL_LOCKSTEP=1
+#define SIMULATOR_LOCKSTEP_TICK_US      10      // virtual time per main loop pass
+#define SIMULATOR_MODEL_STEP_US         125     // helicopter model and gyro sample rate
+#define SIMULATOR_RC_PERIOD_US          20000   // scripted RC frame interval
+#define SIMULATOR_LOG_PERIOD_US         1000    // model log interval
+
 // file name to save config
 #define EEPROM_FILENAME "eeprom.bin"
 #define CONFIG_IN_FILE
 #define EEPROM_SIZE     32768
+#define FLASH_PAGE_SIZE 0x400
 
 #define U_ID_0 0
 #define U_ID_1 1
@@ -90,6 +98,9 @@
 
 #define USE_PARAMETER_GROUPS
 
+#define USE_SCHEDULER_TRACE
+#define SCHEDULER_TRACE_SIZE 4096
+
 #undef STACK_CHECK // I think SITL don't need this
 #undef USE_DASHBOARD
 #undef USE_TELEMETRY_LTM
@@ -250,4 +261,8 @@ uint64_t millis64(void);
 
 int lockMainPID(void);
 
+void simulatorLoop(void);
+bool simulatorHasMotorRPM(void);
+int simulatorGetMotorERPM(uint8_t motor);
+
 
@@ -255,6 +255,10 @@
 #undef USE_GYRO_DATA_ANALYSE
 #endif
 
+#ifndef USE_GYRO_DATA_ANALYSE
+#undef USE_DYN_NOTCH_SDFT
+#endif
+
 #ifndef USE_CMS
 #undef USE_CMS_FAILSAFE_MENU
 #endif
@@ -125,6 +125,9 @@
 #if defined(STM32F4) || defined(STM32F7) || defined(STM32H7)
 #define TASK_GYROPID_DESIRED_PERIOD     125 // 125us = 8kHz
 #define SCHEDULER_DELAY_LIMIT           10
+#if defined(DEBUG)
+#define USE_SCHEDULER_TRACE
+#endif
 #else
 #define TASK_GYROPID_DESIRED_PERIOD     1000 // 1000us = 1kHz
 #define SCHEDULER_DELAY_LIMIT           100
@@ -279,6 +282,7 @@
 
 #if ((TARGET_FLASH_SIZE > 256) || (FEATURE_CUT_LEVEL < 4))
 #define USE_HUFFMAN
+#define USE_BLACKBOX_COMPRESSION
 #define USE_PINIO
 #define USE_PINIOBOX
 #endif
@@ -68,6 +68,7 @@
 
 
 #define CRSF_CYCLETIME_US                   100000 // 100ms, 10 Hz
+#define CRSF_TELEMETRY_SLOT_RATE_DEFAULT    150    // Hz, until the link statistics tell a Crossfire RF mode, and for ExpressLRS
 #define CRSF_DEVICEINFO_VERSION             0x01
 #define CRSF_DEVICEINFO_PARAMETER_COUNT     0
 
@@ -85,10 +86,14 @@ typedef struct mspBuffer_s {
 } mspBuffer_t;
 
 static mspBuffer_t mspRxBuffer;
+static int mspRxBufferPos;
+static bool mspRequestPending;
+static bool mspReplyPending;
 
 void initCrsfMspBuffer(void)
 {
     mspRxBuffer.len = 0;
+    mspRxBufferPos = 0;
 }
 
 bool bufferCrsfMspFrame(uint8_t *frameStart, int frameLength)
@@ -104,27 +109,26 @@ bool bufferCrsfMspFrame(uint8_t *frameStart, int frameLength)
     }
 }
 
-bool handleCrsfMspFrameBuffer(uint8_t payloadSize, mspResponseFnPtr responseFn)
+// Feeds buffered request frames to the MSP handler until one completes a request.
+// Frames behind it stay buffered until its reply has been sent.
+static bool handleCrsfMspFrameBuffer(void)
 {
-    bool requestHandled = false;
-    if (!mspRxBuffer.len) {
-        return false;
-    }
-    int pos = 0;
     while (true) {
-        const int mspFrameLength = mspRxBuffer.bytes[pos];
-        if (handleMspFrame(&mspRxBuffer.bytes[CRSF_MSP_LENGTH_OFFSET + pos], mspFrameLength, NULL)) {
-            requestHandled |= sendMspReply(payloadSize, responseFn);
-        }
-        pos += CRSF_MSP_LENGTH_OFFSET + mspFrameLength;
         ATOMIC_BLOCK(NVIC_PRIO_SERIALUART1) {
-            if (pos >= mspRxBuffer.len) {
+            if (mspRxBufferPos >= mspRxBuffer.len) {
                 mspRxBuffer.len = 0;
-                return requestHandled;
+                mspRxBufferPos = 0;
+                mspRequestPending = false;
+                return false;
             }
         }
+        const int pos = mspRxBufferPos;
+        const int mspFrameLength = mspRxBuffer.bytes[pos];
+        mspRxBufferPos += CRSF_MSP_LENGTH_OFFSET + mspFrameLength;
+        if (handleMspFrame(&mspRxBuffer.bytes[CRSF_MSP_LENGTH_OFFSET + pos], mspFrameLength, NULL)) {
+            return true;
+        }
     }
-    return requestHandled;
 }
 #endif
 
@@ -220,12 +224,6 @@ typedef enum {
     CRSF_ACTIVE_ANTENNA2 = 1
 } crsfActiveAntenna_e;
 
-typedef enum {
-    CRSF_RF_MODE_4_HZ = 0,
-    CRSF_RF_MODE_50_HZ = 1,
-    CRSF_RF_MODE_150_HZ = 2
-} crsrRfMode_e;
-
 typedef enum {
     CRSF_RF_POWER_0_mW = 0,
     CRSF_RF_POWER_10_mW = 1,
@@ -380,13 +378,24 @@ typedef enum {
 static uint8_t crsfScheduleCount;
 static uint8_t crsfSchedule[CRSF_SCHEDULE_COUNT_MAX];
 
-#if defined(USE_MSP_OVER_TELEMETRY)
+// classes of frames sharing the telemetry slots
+typedef enum {
+    CRSF_TELEMETRY_CLASS_SENSOR = 0,
+    CRSF_TELEMETRY_CLASS_MSP,
+    CRSF_TELEMETRY_CLASS_DISPLAYPORT,
+    CRSF_TELEMETRY_CLASS_COUNT
+} crsfTelemetryClass_e;
 
-static bool mspReplyPending;
+static uint8_t crsfClassWeight[CRSF_TELEMETRY_CLASS_COUNT];
+static int16_t crsfClassCredit[CRSF_TELEMETRY_CLASS_COUNT];
+static timeUs_t crsfSlotTimeUs;
+static timeUs_t crsfLastCycleTime;
+
+#if defined(USE_MSP_OVER_TELEMETRY)
 
 void crsfScheduleMspResponse(void)
 {
-    mspReplyPending = true;
+    mspRequestPending = true;
 }
 
 void crsfSendMspResponse(uint8_t *payload)
@@ -457,9 +466,17 @@ void initCrsfTelemetry(void)
 
     deviceInfoReplyPending = false;
 #if defined(USE_MSP_OVER_TELEMETRY)
+    mspRequestPending = false;
     mspReplyPending = false;
 #endif
 
+    crsfClassWeight[CRSF_TELEMETRY_CLASS_SENSOR] = telemetryConfig()->crsf_sensor_weight;
+    crsfClassWeight[CRSF_TELEMETRY_CLASS_MSP] = telemetryConfig()->crsf_msp_weight;
+    crsfClassWeight[CRSF_TELEMETRY_CLASS_DISPLAYPORT] = telemetryConfig()->crsf_displayport_weight;
+    memset(crsfClassCredit, 0, sizeof(crsfClassCredit));
+    crsfSlotTimeUs = 0;
+    crsfLastCycleTime = 0;
+
     int index = 0;
     if (sensors(SENSOR_ACC) && telemetryIsSensorEnabled(SENSOR_PITCH | SENSOR_ROLL | SENSOR_HEADING)) {
         crsfSchedule[index++] = BV(CRSF_FRAME_ATTITUDE_INDEX);
@@ -509,69 +526,128 @@ void crsfProcessDisplayPortCmd(uint8_t *frameStart)
 #endif
 
 /*
- * Called periodically by the scheduler
+ * Smooth weighted round robin over the classes with a frame waiting: each slot,
+ * every waiting class earns its weight and the one with most credit pays back
+ * the total. Each class gets its weighted share of the slots in use, and the
+ * share of an idle class goes to the others. A class of weight zero only gets
+ * slots no other class wants.
  */
-void handleCrsfTelemetry(timeUs_t currentTimeUs)
+static int crsfSelectClass(const bool *pending)
 {
-    static uint32_t crsfLastCycleTime;
+    int selected = -1;
+    int totalWeight = 0;
 
-    if (!crsfTelemetryEnabled) {
-        return;
+    for (int i = 0; i < CRSF_TELEMETRY_CLASS_COUNT; i++) {
+        if (!pending[i]) {
+            crsfClassCredit[i] = 0;
+            continue;
+        }
+        crsfClassCredit[i] += crsfClassWeight[i];
+        totalWeight += crsfClassWeight[i];
+        if (selected < 0 || crsfClassCredit[i] > crsfClassCredit[selected]) {
+            selected = i;
+        }
     }
-    // Give the receiver a chance to send any outstanding telemetry data.
-    // This needs to be done at high frequency, to enable the RX to send the telemetry frame
-    // in between the RX frames.
-    crsfRxSendTelemetryData();
-
-    // Send ad-hoc response frames as soon as possible
-#if defined(USE_MSP_OVER_TELEMETRY)
-    if (mspReplyPending) {
-        mspReplyPending = handleCrsfMspFrameBuffer(CRSF_FRAME_TX_MSP_FRAME_SIZE, &crsfSendMspResponse);
-        crsfLastCycleTime = currentTimeUs; // reset telemetry timing due to ad-hoc request
-        return;
+    if (selected >= 0) {
+        crsfClassCredit[selected] -= totalWeight;
     }
-#endif
+    return selected;
+}
+
+// Fills one telemetry slot, returns false if nothing was waiting
+static bool crsfSendSlotFrame(timeUs_t currentTimeUs)
+{
+    sbuf_t crsfPayloadBuf;
+    sbuf_t *dst = &crsfPayloadBuf;
 
+    // Device info replies are rare and the client waits on them
     if (deviceInfoReplyPending) {
-        sbuf_t crsfPayloadBuf;
-        sbuf_t *dst = &crsfPayloadBuf;
         crsfInitializeFrame(dst);
         crsfFrameDeviceInfo(dst);
         crsfFinalize(dst);
         deviceInfoReplyPending = false;
-        crsfLastCycleTime = currentTimeUs; // reset telemetry timing due to ad-hoc request
-        return;
+        return true;
     }
 
+    bool pending[CRSF_TELEMETRY_CLASS_COUNT] = { false };
+
+    // Actual telemetry data only needs to be sent at a low frequency, ie 10Hz
+    // Spread out scheduled frames evenly so each frame is sent at the same frequency.
+    const timeDelta_t sensorIntervalUs = CRSF_CYCLETIME_US / crsfScheduleCount;
+    pending[CRSF_TELEMETRY_CLASS_SENSOR] = cmpTimeUs(currentTimeUs, crsfLastCycleTime) >= sensorIntervalUs;
+#if defined(USE_MSP_OVER_TELEMETRY)
+    pending[CRSF_TELEMETRY_CLASS_MSP] = mspReplyPending;
+#endif
+#if defined(USE_CRSF_CMS_TELEMETRY)
+    pending[CRSF_TELEMETRY_CLASS_DISPLAYPORT] = crsfDisplayPortScreen()->reset || crsfDisplayPortNextRow() >= 0;
+#endif
+
+    switch (crsfSelectClass(pending)) {
+    case CRSF_TELEMETRY_CLASS_SENSOR:
+        // Keep to the cadence, but when short of slots fall no more than a cycle behind
+        crsfLastCycleTime += sensorIntervalUs;
+        if (cmpTimeUs(currentTimeUs, crsfLastCycleTime) > CRSF_CYCLETIME_US) {
+            crsfLastCycleTime = currentTimeUs - CRSF_CYCLETIME_US;
+        }
+        processCrsf();
+        return true;
+#if defined(USE_MSP_OVER_TELEMETRY)
+    case CRSF_TELEMETRY_CLASS_MSP:
+        // The chunks of a reply go out in consecutive MSP slots, without waiting for a poll
+        mspReplyPending = sendMspReply(CRSF_FRAME_TX_MSP_FRAME_SIZE, &crsfSendMspResponse);
+        return true;
+#endif
 #if defined(USE_CRSF_CMS_TELEMETRY)
-    if (crsfDisplayPortScreen()->reset) {
-        crsfDisplayPortScreen()->reset = false;
-        sbuf_t crsfDisplayPortBuf;
-        sbuf_t *dst = &crsfDisplayPortBuf;
+    case CRSF_TELEMETRY_CLASS_DISPLAYPORT:
         crsfInitializeFrame(dst);
-        crsfFrameDisplayPortClear(dst);
+        if (crsfDisplayPortScreen()->reset) {
+            crsfDisplayPortScreen()->reset = false;
+            crsfFrameDisplayPortClear(dst);
+        } else {
+            const int nextRow = crsfDisplayPortNextRow();
+            crsfFrameDisplayPortRow(dst, nextRow);
+            crsfDisplayPortScreen()->pendingTransport[nextRow] = false;
+        }
         crsfFinalize(dst);
-        crsfLastCycleTime = currentTimeUs;
-        return;
+        return true;
+#endif
+    default:
+        return false;
     }
-    const int nextRow = crsfDisplayPortNextRow();
-    if (nextRow >= 0) {
-        sbuf_t crsfDisplayPortBuf;
-        sbuf_t *dst = &crsfDisplayPortBuf;
-        crsfInitializeFrame(dst);
-        crsfFrameDisplayPortRow(dst, nextRow);
-        crsfFinalize(dst);
-        crsfDisplayPortScreen()->pendingTransport[nextRow] = false;
-        crsfLastCycleTime = currentTimeUs;
+}
+
+/*
+ * Called periodically by the scheduler
+ */
+void handleCrsfTelemetry(timeUs_t currentTimeUs)
+{
+    if (!crsfTelemetryEnabled) {
         return;
     }
+    // Give the receiver a chance to send any outstanding telemetry data.
+    // This needs to be done at high frequency, to enable the RX to send the telemetry frame
+    // in between the RX frames.
+    crsfRxSendTelemetryData();
+
+#if defined(USE_MSP_OVER_TELEMETRY)
+    // Requests are taken in as soon as the last reply is out, the reply waits for MSP slots
+    if (mspRequestPending && !mspReplyPending) {
+        mspReplyPending = handleCrsfMspFrameBuffer();
+    }
 #endif
 
-    // Actual telemetry data only needs to be sent at a low frequency, ie 10Hz
-    // Spread out scheduled frames evenly so each frame is sent at the same frequency.
-    if (currentTimeUs >= crsfLastCycleTime + (CRSF_CYCLETIME_US / crsfScheduleCount)) {
-        crsfLastCycleTime = currentTimeUs;
-        processCrsf();
+    // The receiver takes one frame per uplink packet, more would be lost
+    if (cmpTimeUs(currentTimeUs, crsfSlotTimeUs) < 0) {
+        return;
+    }
+    if (crsfSendSlotFrame(currentTimeUs)) {
+        const uint16_t slotRateHz = crsfRxTelemetrySlotRate();
+        const timeDelta_t slotIntervalUs = 1000000 / (slotRateHz ? slotRateHz : CRSF_TELEMETRY_SLOT_RATE_DEFAULT);
+        // Slots missed while late are not made up for
+        if (cmpTimeUs(currentTimeUs, crsfSlotTimeUs) >= slotIntervalUs) {
+            crsfSlotTimeUs = currentTimeUs;
+        }
+        crsfSlotTimeUs += slotIntervalUs;
     }
 }
 
@@ -87,6 +87,9 @@ typedef struct telemetryConfig_s {
     uint8_t flysky_sensors[IBUS_SENSOR_COUNT];
     uint16_t mavlink_mah_as_heading_divisor;
     uint32_t disabledSensors; // bit flags
+    uint8_t crsf_sensor_weight;         // shares of the CRSF telemetry slots, see telemetry/crsf.c
+    uint8_t crsf_msp_weight;
+    uint8_t crsf_displayport_weight;
 } telemetryConfig_t;
 
 PG_DECLARE(telemetryConfig_t, telemetryConfig);
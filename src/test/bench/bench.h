@@ -0,0 +1,277 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Shared helpers for the host benchmarks in src/test/bench.
+ *
+ * Benchmarks are plain programs built at -O2 without coverage by
+ * 'make bench'. They report wall time per item and, on x86, TSC cycles.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_CYCLES 1
+#else
+#define BENCH_HAVE_CYCLES 0
+#endif
+
+static inline uint64_t benchNowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static inline uint64_t benchCycles(void)
+{
+#if BENCH_HAVE_CYCLES
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+typedef struct benchTimer_s {
+    const char *name;
+    uint64_t ns;
+    uint64_t cycles;
+    uint64_t count;
+    uint64_t startNs;
+    uint64_t startCycles;
+    uint64_t laps;
+} benchTimer_t;
+
+static inline void benchTimerStart(benchTimer_t *timer)
+{
+    timer->startCycles = benchCycles();
+    timer->startNs = benchNowNs();
+}
+
+static inline void benchTimerStop(benchTimer_t *timer, uint64_t count)
+{
+    timer->ns += benchNowNs() - timer->startNs;
+    timer->cycles += benchCycles() - timer->startCycles;
+    timer->count += count;
+    timer->laps++;
+}
+
+// Cost of an empty start/stop pair, subtracted from every lap when reporting
+static inline void benchTimerOverhead(double *ns, double *cycles)
+{
+    static bool calibrated;
+    static double overheadNs, overheadCycles;
+
+    if (!calibrated) {
+        benchTimer_t timer = { "overhead", 0, 0, 0, 0, 0, 0 };
+        for (int i = 0; i < 100000; i++) {
+            benchTimerStart(&timer);
+            benchTimerStop(&timer, 1);
+        }
+        overheadNs = (double)timer.ns / timer.laps;
+        overheadCycles = (double)timer.cycles / timer.laps;
+        calibrated = true;
+    }
+
+    *ns = overheadNs;
+    *cycles = overheadCycles;
+}
+
+static inline void benchReportHeader(const char *unit)
+{
+    printf("%-24s %12s %14s\n", "stage", "ns/", "cycles/");
+    printf("%-24s %12s %14s\n", "", unit, unit);
+}
+
+static inline void benchReport(const benchTimer_t *timer)
+{
+    double overheadNs, overheadCycles;
+    benchTimerOverhead(&overheadNs, &overheadCycles);
+
+    const double count = timer->count ? (double)timer->count : 1.0;
+    const double ns = fmax(0, timer->ns - overheadNs * timer->laps) / count;
+    const double cycles = fmax(0, timer->cycles - overheadCycles * timer->laps) / count;
+
+    if (BENCH_HAVE_CYCLES) {
+        printf("%-24s %12.2f %14.1f\n", timer->name, ns, cycles);
+    } else {
+        printf("%-24s %12.2f %14s\n", timer->name, ns, "n/a");
+    }
+}
+
+// Deterministic noise source, so runs are comparable between builds
+static inline uint32_t benchRandom(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static inline float benchRandomFloat(uint32_t *state)
+{
+    return (benchRandom(state) & 0xFFFFFF) / (float)0x800000 - 1.0f;
+}
+
+/*
+ * Three axis gyro trace in deg/s.
+ */
+typedef struct benchGyroTrace_s {
+    unsigned sampleRateHz;
+    std::vector<float> axis[3];
+    std::vector<float> headspeed;    // main rotor rpm per sample, if known
+} benchGyroTrace_t;
+
+/*
+ * Load gyro columns from a blackbox_decode CSV export. The gyroADC[0..2]
+ * columns are used, and the main rotor rpm from rpm[0] or erpm[0] if
+ * present. The sample rate is derived from "time (us)" when available.
+ */
+static inline bool benchLoadBlackboxCsv(benchGyroTrace_t *trace, const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        return false;
+    }
+
+    char line[8192];
+    int gyroCol[3] = { -1, -1, -1 };
+    int timeCol = -1;
+    int rpmCol = -1;
+
+    if (!fgets(line, sizeof(line), fp)) {
+        fclose(fp);
+        return false;
+    }
+
+    int col = 0;
+    for (char *tok = strtok(line, ",\r\n"); tok; tok = strtok(NULL, ",\r\n"), col++) {
+        while (*tok == ' ') {
+            tok++;
+        }
+        if (!strcmp(tok, "gyroADC[0]")) gyroCol[0] = col;
+        else if (!strcmp(tok, "gyroADC[1]")) gyroCol[1] = col;
+        else if (!strcmp(tok, "gyroADC[2]")) gyroCol[2] = col;
+        else if (!strcmp(tok, "time (us)")) timeCol = col;
+        else if (!strcmp(tok, "rpm[0]") || (rpmCol < 0 && !strcmp(tok, "erpm[0]"))) rpmCol = col;
+    }
+
+    if (gyroCol[0] < 0 || gyroCol[1] < 0 || gyroCol[2] < 0) {
+        fclose(fp);
+        return false;
+    }
+
+    double firstTime = -1, lastTime = -1;
+
+    while (fgets(line, sizeof(line), fp)) {
+        float values[3] = { 0, 0, 0 };
+        float rpm = 0;
+        col = 0;
+        for (char *tok = strtok(line, ",\r\n"); tok; tok = strtok(NULL, ",\r\n"), col++) {
+            for (int axis = 0; axis < 3; axis++) {
+                if (col == gyroCol[axis]) {
+                    values[axis] = strtof(tok, NULL);
+                }
+            }
+            if (col == timeCol) {
+                lastTime = strtod(tok, NULL);
+                if (firstTime < 0) {
+                    firstTime = lastTime;
+                }
+            }
+            if (col == rpmCol) {
+                rpm = strtof(tok, NULL);
+            }
+        }
+        for (int axis = 0; axis < 3; axis++) {
+            trace->axis[axis].push_back(values[axis]);
+        }
+        trace->headspeed.push_back(rpm);
+    }
+    fclose(fp);
+
+    const size_t count = trace->axis[0].size();
+    if (count > 1 && lastTime > firstTime) {
+        trace->sampleRateHz = lrint((count - 1) * 1e6 / (lastTime - firstTime));
+    }
+
+    return count > 0;
+}
+
+/*
+ * Synthesise a helicopter gyro spectrum: stick motion, main rotor 1P/2P,
+ * tail rotor 1P, motor rotation and broadband frame noise, with a slow
+ * headspeed sweep so the RPM notches have something to track.
+ */
+static inline void benchSynthHeliTrace(benchGyroTrace_t *trace, unsigned sampleRateHz, float seconds)
+{
+    const unsigned count = sampleRateHz * seconds;
+    const float dT = 1.0f / sampleRateHz;
+    const float tailRatio = 4.5f;
+    const float motorRatio = 10.0f;
+
+    uint32_t seed = 0x1234567;
+    float phaseMain = 0, phaseTail = 0, phaseMotor = 0;
+
+    trace->sampleRateHz = sampleRateHz;
+
+    for (int axis = 0; axis < 3; axis++) {
+        trace->axis[axis].resize(count);
+    }
+    trace->headspeed.resize(count);
+
+    for (unsigned i = 0; i < count; i++) {
+        const float t = i * dT;
+        const float headspeed = 1800 + 400 * sinf(2 * M_PI * 0.1f * t);
+        const float mainHz = headspeed / 60;
+
+        phaseMain  += 2 * M_PI * mainHz * dT;
+        phaseTail  += 2 * M_PI * mainHz * tailRatio * dT;
+        phaseMotor += 2 * M_PI * mainHz * motorRatio * dT;
+
+        phaseMain  = fmodf(phaseMain, 2 * M_PI);
+        phaseTail  = fmodf(phaseTail, 2 * M_PI);
+        phaseMotor = fmodf(phaseMotor, 2 * M_PI);
+
+        const float stick[3] = {
+            200 * sinf(2 * M_PI * 0.7f * t),
+            150 * sinf(2 * M_PI * 0.5f * t + 1),
+            300 * sinf(2 * M_PI * 0.3f * t + 2),
+        };
+        const float gain[3] = { 1.0f, 1.0f, 1.6f };
+
+        for (int axis = 0; axis < 3; axis++) {
+            trace->axis[axis][i] = stick[axis] + gain[axis] * (
+                25 * sinf(phaseMain + axis) +
+                12 * sinf(2 * phaseMain + axis) +
+                18 * sinf(phaseTail) +
+                6 * sinf(phaseMotor) +
+                8 * benchRandomFloat(&seed));
+        }
+        trace->headspeed[i] = headspeed;
+    }
+}
@@ -0,0 +1,301 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Blackbox frame encoding benchmark.
+ *
+ *   make bench_blackbox_encoding_benchmark [BENCH_OPTS=<blackbox.csv>]
+ *
+ * Encodes P-frames with the same field layout as writeInterframe(), with
+ * the gyro fields taken from a trace, in two ways: one blackboxWrite*() call
+ * per field with every byte handed to the device on its own, as before the
+ * frame encoders, and a whole frame built with the blackboxEncode*()
+ * functions and handed over in one write. The device is a ring buffer in
+ * RAM standing in for the flashfs write buffer.
+ *
+ * The whole frames are then written again through the blackbox compressor,
+ * reporting the cost per frame and the compression ratio. Only the gyro
+ * fields come from the trace, the rest are uniform noise, so a real log
+ * compresses better than this.
+ */
+
+#include "bench.h"
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox_compress.h"
+    #include "blackbox/blackbox_encoding.h"
+
+    #include "common/maths.h"
+    #include "common/streambuf.h"
+}
+
+#define DEVICE_BUFFER_SIZE  4096
+
+static uint8_t deviceBuffer[DEVICE_BUFFER_SIZE];
+static unsigned deviceHead;
+static uint64_t deviceBytes;
+static bool deviceByteAtATime;
+static blackboxCompressor_t *deviceCompressor;
+
+// As flashfsWriteByte()
+static __attribute__((noinline)) void devicePutByte(uint8_t value)
+{
+    deviceBuffer[deviceHead++] = value;
+    deviceBytes++;
+
+    if (deviceHead >= DEVICE_BUFFER_SIZE) {
+        deviceHead = 0;
+    }
+}
+
+// As the buffered part of flashfsWrite()
+static __attribute__((noinline)) void devicePutData(const uint8_t *data, int len)
+{
+    const int tail = MIN(len, (int)(DEVICE_BUFFER_SIZE - deviceHead));
+
+    memcpy(deviceBuffer + deviceHead, data, tail);
+    memcpy(deviceBuffer, data + tail, len - tail);
+
+    deviceHead = (deviceHead + len) % DEVICE_BUFFER_SIZE;
+    deviceBytes += len;
+}
+
+extern "C" {
+    int32_t blackboxHeaderBudget;
+
+    void blackboxWrite(uint8_t value)
+    {
+        devicePutByte(value);
+    }
+
+    void blackboxWriteData(const uint8_t *data, int len)
+    {
+        if (deviceCompressor) {
+            blackboxCompress(deviceCompressor, data, len);
+        } else if (deviceByteAtATime) {
+            while (len--) {
+                devicePutByte(*data++);
+            }
+        } else {
+            devicePutData(data, len);
+        }
+    }
+
+    int blackboxWriteString(const char *s)
+    {
+        const int len = strlen(s);
+        blackboxWriteData((const uint8_t *)s, len);
+        return len;
+    }
+}
+
+typedef struct {
+    int32_t pid[4][3];      // P, I, D, F
+    int32_t rc[4];
+    int32_t collective;
+    int32_t setpoint[4];
+    int32_t optional[2];
+    int32_t gyro[3];
+    int32_t motor[2];
+    int32_t servo[4];
+    int32_t headspeed;
+} frameDeltas_t;
+
+static void writeFrameByField(const frameDeltas_t *d)
+{
+    blackboxWrite('P');
+    blackboxWriteSignedVB(0);
+    blackboxWriteSignedVBArray((int32_t *)d->pid[0], 3);
+    blackboxWriteTag2_3S32((int32_t *)d->pid[1]);
+    blackboxWriteSignedVBArray((int32_t *)d->pid[2], 3);
+    blackboxWriteSignedVBArray((int32_t *)d->pid[3], 3);
+    blackboxWriteTag8_4S16((int32_t *)d->rc);
+    blackboxWriteSignedVB(d->collective);
+    blackboxWriteTag8_4S16((int32_t *)d->setpoint);
+    blackboxWriteTag8_8SVB((int32_t *)d->optional, 2);
+    blackboxWriteSignedVBArray((int32_t *)d->gyro, 3);
+    blackboxWriteSignedVBArray((int32_t *)d->motor, 2);
+    blackboxWriteTag8_4S16((int32_t *)d->servo);
+    blackboxWriteSignedVB(d->headspeed);
+}
+
+static void writeFrameWhole(const frameDeltas_t *d)
+{
+    uint8_t frame[256];
+    sbuf_t dst = { frame, frame + sizeof(frame) };
+
+    sbufWriteU8(&dst, 'P');
+    blackboxEncodeSignedVB(&dst, 0);
+    blackboxEncodeSignedVBArray(&dst, d->pid[0], 3);
+    blackboxEncodeTag2_3S32(&dst, d->pid[1]);
+    blackboxEncodeSignedVBArray(&dst, d->pid[2], 3);
+    blackboxEncodeSignedVBArray(&dst, d->pid[3], 3);
+    blackboxEncodeTag8_4S16(&dst, d->rc);
+    blackboxEncodeSignedVB(&dst, d->collective);
+    blackboxEncodeTag8_4S16(&dst, d->setpoint);
+    blackboxEncodeTag8_8SVB(&dst, d->optional, 2);
+    blackboxEncodeSignedVBArray(&dst, d->gyro, 3);
+    blackboxEncodeSignedVBArray(&dst, d->motor, 2);
+    blackboxEncodeTag8_4S16(&dst, d->servo);
+    blackboxEncodeSignedVB(&dst, d->headspeed);
+
+    blackboxWriteData(frame, dst.ptr - frame);
+}
+
+// Small deltas, mostly zero or a few counts, as in flight between P-frames
+static int32_t smallDelta(uint32_t *seed, int range)
+{
+    const uint32_t r = benchRandom(seed);
+    return (r & 3) ? (int32_t)(r >> 8) % range : 0;
+}
+
+static void buildFrames(std::vector<frameDeltas_t> &frames, const benchGyroTrace_t *trace)
+{
+    uint32_t seed = 1;
+    const size_t count = trace->axis[0].size();
+
+    frames.resize(count - 2);
+
+    for (size_t n = 2; n < count; n++) {
+        frameDeltas_t *d = &frames[n - 2];
+
+        for (int term = 0; term < 4; term++) {
+            for (int axis = 0; axis < 3; axis++) {
+                d->pid[term][axis] = smallDelta(&seed, term == 1 ? 3 : 200);
+            }
+        }
+        for (int i = 0; i < 4; i++) {
+            d->rc[i] = smallDelta(&seed, 20);
+            d->setpoint[i] = smallDelta(&seed, 50);
+            d->servo[i] = smallDelta(&seed, 30);
+        }
+        d->collective = smallDelta(&seed, 20);
+        d->optional[0] = smallDelta(&seed, 2);
+        d->optional[1] = 0;
+        // Average predictor residual, as the gyro is logged
+        for (int axis = 0; axis < 3; axis++) {
+            const std::vector<float> &gyro = trace->axis[axis];
+            d->gyro[axis] = lrintf(gyro[n] - (gyro[n - 1] + gyro[n - 2]) / 2);
+        }
+        d->motor[0] = smallDelta(&seed, 10);
+        d->motor[1] = smallDelta(&seed, 10);
+        d->headspeed = smallDelta(&seed, 5);
+    }
+}
+
+static void timeFrames(benchTimer_t *timer, const std::vector<frameDeltas_t> &frames, void (*writeFrame)(const frameDeltas_t *))
+{
+    const unsigned passes = 20;
+
+    deviceBytes = 0;
+
+    benchTimerStart(timer);
+    for (unsigned pass = 0; pass < passes; pass++) {
+        for (size_t i = 0; i < frames.size(); i++) {
+            writeFrame(&frames[i]);
+        }
+    }
+    benchTimerStop(timer, deviceBytes);
+}
+
+// Counts frames rather than bytes
+static void timeFramesCompressed(benchTimer_t *timer, const std::vector<frameDeltas_t> &frames, uint64_t *compressedBytes)
+{
+    static blackboxCompressor_t compressor;
+    const unsigned passes = 20;
+
+    deviceBytes = 0;
+    blackboxCompressInit(&compressor, devicePutData);
+    deviceCompressor = &compressor;
+
+    benchTimerStart(timer);
+    for (unsigned pass = 0; pass < passes; pass++) {
+        for (size_t i = 0; i < frames.size(); i++) {
+            writeFrameWhole(&frames[i]);
+        }
+    }
+    blackboxCompressFinish(&compressor);
+    benchTimerStop(timer, passes * frames.size());
+
+    deviceCompressor = NULL;
+    *compressedBytes = deviceBytes;
+}
+
+static void reportRate(const benchTimer_t *timer)
+{
+    printf("%-24s %12.1f MB/s\n", timer->name, timer->count * 1e3 / timer->ns);
+}
+
+int main(int argc, char *argv[])
+{
+    benchGyroTrace_t trace;
+
+    if (argc > 1) {
+        if (!benchLoadBlackboxCsv(&trace, argv[1])) {
+            fprintf(stderr, "Cannot read gyroADC columns from %s\n", argv[1]);
+            return 1;
+        }
+        printf("Trace: %s, %zu samples\n", argv[1], trace.axis[0].size());
+    } else {
+        benchSynthHeliTrace(&trace, 1000, 20);
+        printf("Trace: synthetic helicopter spectrum, %zu samples\n", trace.axis[0].size());
+    }
+
+    std::vector<frameDeltas_t> frames;
+    buildFrames(frames, &trace);
+
+    benchTimer_t byFieldTimer = { "byte at a time", 0, 0, 0, 0, 0, 0 };
+    benchTimer_t wholeTimer = { "whole frame", 0, 0, 0, 0, 0, 0 };
+
+    deviceByteAtATime = true;
+    timeFrames(&byFieldTimer, frames, writeFrameByField);
+
+    deviceByteAtATime = false;
+    timeFrames(&wholeTimer, frames, writeFrameWhole);
+
+    if (byFieldTimer.count != wholeTimer.count) {
+        fprintf(stderr, "Byte counts differ: %llu and %llu\n", (unsigned long long)byFieldTimer.count, (unsigned long long)wholeTimer.count);
+        return 1;
+    }
+
+    printf("%zu P-frames, %.1f bytes per frame\n\n", frames.size(), (double)wholeTimer.count / (20 * frames.size()));
+
+    benchReportHeader("byte");
+    benchReport(&byFieldTimer);
+    benchReport(&wholeTimer);
+
+    printf("\n");
+    reportRate(&byFieldTimer);
+    reportRate(&wholeTimer);
+
+    benchTimer_t wholeFrameTimer = wholeTimer;
+    wholeFrameTimer.count = 20 * frames.size();
+
+    benchTimer_t compressedTimer = { "whole frame compressed", 0, 0, 0, 0, 0, 0 };
+    uint64_t compressedBytes;
+    timeFramesCompressed(&compressedTimer, frames, &compressedBytes);
+
+    printf("\nCompressed %.1f bytes per frame, ratio %.2f\n\n", (double)compressedBytes / compressedTimer.count, (double)wholeTimer.count / compressedBytes);
+
+    benchReportHeader("frame");
+    benchReport(&wholeFrameTimer);
+    benchReport(&compressedTimer);
+
+    return 0;
+}
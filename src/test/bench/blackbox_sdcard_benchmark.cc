@@ -0,0 +1,585 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Blackbox logging to SD card benchmark.
+ *
+ *   make bench_blackbox_sdcard_benchmark
+ *
+ * Logs through asyncfatfs to a FAT16 card image in RAM, the way
+ * blackbox_io.c does, with and without the space for the log reserved
+ * at open. The card stand-in runs on simulated time with costs in the
+ * range of a class 10 card on SPI:
+ *
+ *   - every command, and a multiple block write start or stop, costs time
+ *   - a single block write waits for the card to program the block
+ *   - a block of a multiple block write costs little more than its transfer
+ *   - moving to another 4MB allocation unit costs the card extra work
+ *
+ * The filesystem is polled at 1kHz, as taskMain() does. The sustained
+ * test offers more than the card can take. The flight test logs frames at
+ * a fixed rate, dropping a frame when there is no buffer space for it, as
+ * blackboxUpdate() does. The stall is the longest run of dropped frames.
+ * Host time is for the fwrites and polls, per frame.
+ *
+ * The card is checked after each run: the log must read back and the
+ * freefile must have its unused space back.
+ */
+
+#include "bench.h"
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "drivers/sdcard.h"
+
+    #include "io/asyncfatfs/asyncfatfs.h"
+    #include "io/asyncfatfs/fat_standard.h"
+}
+
+#define CARD_BLOCKS             (256 * 1024)        // 128MB
+#define CARD_SECTORS_PER_CLUSTER 8
+#define CARD_ROOT_ENTRIES       512
+#define CARD_AU_BLOCKS          (8 * 1024)          // 4MB
+
+#define CARD_COMMAND_US         40
+#define CARD_TRANSFER_US        250
+#define CARD_READ_US            200
+#define CARD_PROGRAM_US         900
+#define CARD_MULTI_PROGRAM_US   40
+#define CARD_MULTI_START_US     100
+#define CARD_MULTI_STOP_US      600
+#define CARD_AU_SWITCH_US       2500
+
+#define LOG_RESERVE_SIZE        (64 * 1024 * 1024)
+
+#define POLL_INTERVAL_US        1000
+#define TICK_US                 125
+
+static uint8_t *cardImage;
+static uint32_t cardPartitionStart;
+
+static struct {
+    uint64_t nowUs;
+    uint64_t busyUntilUs;
+
+    bool multiWrite;
+    uint32_t multiWriteNextBlock;
+    uint32_t multiWriteBlocksRemain;
+
+    uint32_t lastWriteAU;
+
+    sdcard_operationCompleteCallback_c callback;
+    sdcardBlockOperation_e operation;
+    uint32_t blockIndex;
+    uint8_t *buffer;
+    uint32_t callbackData;
+
+    uint32_t singleWrites;
+    uint32_t multiWriteStarts;
+    uint32_t blocksWritten;
+} card;
+
+static uint32_t cardStopMultiWrite(void)
+{
+    if (card.multiWrite) {
+        card.multiWrite = false;
+        return CARD_MULTI_STOP_US;
+    }
+    return 0;
+}
+
+static void cardStart(sdcardBlockOperation_e operation, uint32_t blockIndex, uint8_t *buffer,
+    sdcard_operationCompleteCallback_c callback, uint32_t callbackData, uint32_t durationUs)
+{
+    card.operation = operation;
+    card.blockIndex = blockIndex;
+    card.buffer = buffer;
+    card.callback = callback;
+    card.callbackData = callbackData;
+    card.busyUntilUs = card.nowUs + durationUs;
+}
+
+static uint32_t cardWriteCost(uint32_t blockIndex)
+{
+    const uint32_t au = blockIndex / CARD_AU_BLOCKS;
+    uint32_t cost = 0;
+
+    if (au != card.lastWriteAU) {
+        card.lastWriteAU = au;
+        cost += CARD_AU_SWITCH_US;
+    }
+
+    return cost;
+}
+
+extern "C" {
+
+bool sdcard_readBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    if (card.callback || card.nowUs < card.busyUntilUs) {
+        return false;
+    }
+
+    memcpy(buffer, cardImage + (size_t)blockIndex * 512, 512);
+
+    cardStart(SDCARD_BLOCK_OPERATION_READ, blockIndex, buffer, callback, callbackData,
+        cardStopMultiWrite() + CARD_COMMAND_US + CARD_READ_US + CARD_TRANSFER_US);
+
+    return true;
+}
+
+sdcardOperationStatus_e sdcard_beginWriteBlocks(uint32_t blockIndex, uint32_t blockCount)
+{
+    if (card.callback || card.nowUs < card.busyUntilUs) {
+        return SDCARD_OPERATION_BUSY;
+    }
+
+    if (card.multiWrite && blockIndex == card.multiWriteNextBlock) {
+        return SDCARD_OPERATION_SUCCESS;
+    }
+
+    uint32_t durationUs = cardStopMultiWrite() + 2 * CARD_COMMAND_US + CARD_MULTI_START_US;
+
+    card.multiWrite = true;
+    card.multiWriteNextBlock = blockIndex;
+    card.multiWriteBlocksRemain = blockCount;
+    card.multiWriteStarts++;
+    card.busyUntilUs = card.nowUs + durationUs;
+
+    return SDCARD_OPERATION_SUCCESS;
+}
+
+sdcardOperationStatus_e sdcard_writeBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    if (card.callback || card.nowUs < card.busyUntilUs) {
+        return SDCARD_OPERATION_BUSY;
+    }
+
+    uint32_t durationUs;
+
+    if (card.multiWrite && blockIndex == card.multiWriteNextBlock) {
+        durationUs = CARD_TRANSFER_US + CARD_MULTI_PROGRAM_US;
+
+        card.multiWriteNextBlock++;
+        if (--card.multiWriteBlocksRemain == 0) {
+            durationUs += cardStopMultiWrite();
+        }
+    } else {
+        durationUs = cardStopMultiWrite() + CARD_COMMAND_US + CARD_TRANSFER_US + CARD_PROGRAM_US;
+        card.singleWrites++;
+    }
+
+    durationUs += cardWriteCost(blockIndex);
+
+    memcpy(cardImage + (size_t)blockIndex * 512, buffer, 512);
+    card.blocksWritten++;
+
+    cardStart(SDCARD_BLOCK_OPERATION_WRITE, blockIndex, buffer, callback, callbackData, durationUs);
+
+    return SDCARD_OPERATION_IN_PROGRESS;
+}
+
+bool sdcard_poll(void)
+{
+    if (card.callback && card.nowUs >= card.busyUntilUs) {
+        sdcard_operationCompleteCallback_c callback = card.callback;
+        card.callback = NULL;
+
+        callback(card.operation, card.blockIndex, card.buffer, card.callbackData);
+    }
+
+    return true;
+}
+
+void sdcard_setProfilerCallback(sdcard_profilerCallback_c callback)
+{
+    UNUSED(callback);
+}
+
+}
+
+static void put16(uint8_t *p, uint16_t v)
+{
+    memcpy(p, &v, sizeof(v));
+}
+
+static uint16_t get16(const uint8_t *p)
+{
+    uint16_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint32_t cardFatSectors;
+static uint32_t cardFatStart;
+static uint32_t cardDataStart;
+
+static uint16_t cardFatEntry(uint32_t cluster)
+{
+    return get16(cardImage + (size_t)cardFatStart * 512 + cluster * 2);
+}
+
+static uint8_t *cardCluster(uint32_t cluster)
+{
+    return cardImage + ((size_t)cardDataStart + (cluster - 2) * CARD_SECTORS_PER_CLUSTER) * 512;
+}
+
+// An empty FAT16 partition after an MBR
+static void cardFormat(void)
+{
+    memset(cardImage, 0, (size_t)CARD_BLOCKS * 512);
+    memset(&card, 0, sizeof(card));
+    card.lastWriteAU = UINT32_MAX;
+
+    cardPartitionStart = 1;
+    const uint32_t partitionSectors = CARD_BLOCKS - cardPartitionStart;
+    const uint32_t rootSectors = CARD_ROOT_ENTRIES * sizeof(fatDirectoryEntry_t) / 512;
+
+    cardFatSectors = 1;
+    for (;;) {
+        uint32_t clusters = (partitionSectors - 1 - 2 * cardFatSectors - rootSectors) / CARD_SECTORS_PER_CLUSTER;
+        uint32_t fatSectors = ((clusters + 2) * 2 + 511) / 512;
+        if (fatSectors <= cardFatSectors) {
+            break;
+        }
+        cardFatSectors = fatSectors;
+    }
+    cardFatStart = cardPartitionStart + 1;
+    cardDataStart = cardFatStart + 2 * cardFatSectors + rootSectors;
+
+    mbrPartitionEntry_t partition;
+    memset(&partition, 0, sizeof(partition));
+    partition.type = MBR_PARTITION_TYPE_FAT16_LBA;
+    partition.lbaBegin = cardPartitionStart;
+    partition.numSectors = partitionSectors;
+    memcpy(cardImage + 446, &partition, sizeof(partition));
+    cardImage[510] = 0x55;
+    cardImage[511] = 0xAA;
+
+    fatVolumeID_t volume;
+    memset(&volume, 0, sizeof(volume));
+    volume.bytesPerSector = 512;
+    volume.sectorsPerCluster = CARD_SECTORS_PER_CLUSTER;
+    volume.reservedSectorCount = 1;
+    volume.numFATs = 2;
+    volume.rootEntryCount = CARD_ROOT_ENTRIES;
+    volume.media = 0xF8;
+    volume.FATSize16 = cardFatSectors;
+    volume.totalSectors32 = partitionSectors;
+
+    uint8_t *volumeSector = cardImage + (size_t)cardPartitionStart * 512;
+    memcpy(volumeSector, &volume, sizeof(volume));
+    volumeSector[510] = FAT_VOLUME_ID_SIGNATURE_1;
+    volumeSector[511] = FAT_VOLUME_ID_SIGNATURE_2;
+
+    for (int fat = 0; fat < 2; fat++) {
+        uint8_t *entries = cardImage + ((size_t)cardFatStart + fat * cardFatSectors) * 512;
+        put16(entries, 0xFFF8);
+        put16(entries + 2, 0xFFFF);
+    }
+}
+
+static void cardAdvance(uint32_t us)
+{
+    card.nowUs += us;
+}
+
+static void pollUntil(bool (*done)(void))
+{
+    const uint64_t timeoutUs = card.nowUs + 60 * 1000000ULL;
+
+    while (!done() && card.nowUs < timeoutUs) {
+        afatfs_poll();
+        cardAdvance(10);
+    }
+}
+
+static afatfsFilePtr_t logFile;
+static bool logOpened;
+static bool logReserved;
+static bool logClosed;
+
+static void logFileCreated(afatfsFilePtr_t file)
+{
+    logFile = file;
+    logOpened = true;
+}
+
+static void logSpaceReserved(afatfsFilePtr_t file)
+{
+    UNUSED(file);
+    logReserved = true;
+}
+
+static void logFileClosed(void)
+{
+    logClosed = true;
+}
+
+static bool filesystemReady(void) { return afatfs_getFilesystemState() != AFATFS_FILESYSTEM_STATE_INITIALIZATION; }
+static bool logFileOpened(void) { return logOpened; }
+static bool logSpaceDone(void) { return logReserved; }
+static bool logFileDone(void) { return logClosed; }
+static bool filesystemDestroyed(void) { return afatfs_destroy(false); }
+
+static uint8_t logByte(uint32_t offset)
+{
+    return (uint8_t)(offset * 31 + (offset >> 11));
+}
+
+typedef struct {
+    const char *name;
+    bool reserve;
+    uint32_t frameIntervalUs;
+    uint32_t frameBytes;
+    uint32_t durationUs;
+} logRun_t;
+
+typedef struct {
+    uint32_t openUs;
+    uint32_t logged;
+    uint32_t framesDropped;
+    uint32_t frames;
+    uint32_t worstStallUs;
+    uint64_t hostNs;
+    uint32_t singleWrites;
+    uint32_t multiWriteStarts;
+    uint32_t freeBefore;
+    uint32_t freeAfter;
+    int failures;
+} logResult_t;
+
+static const fatDirectoryEntry_t *cardFindFile(const char *filename)
+{
+    const uint8_t *root = cardImage + ((size_t)cardFatStart + 2 * cardFatSectors) * 512;
+
+    for (int i = 0; i < CARD_ROOT_ENTRIES; i++) {
+        const fatDirectoryEntry_t *entry = (const fatDirectoryEntry_t *)(root + i * sizeof(fatDirectoryEntry_t));
+        if (memcmp(entry->filename, filename, FAT_FILENAME_LENGTH) == 0) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+// Reads the log back and follows the chains of the log and the freefile
+static int checkLog(const logResult_t *result)
+{
+    const fatDirectoryEntry_t *entry = cardFindFile("LOG00001BFL");
+    const fatDirectoryEntry_t *freeFile = cardFindFile("FREESPACE  ");
+
+    if (!entry || !freeFile) {
+        printf("  log or freefile not found\n");
+        return 1;
+    }
+
+    if (entry->fileSize != result->logged) {
+        printf("  log size %u, %u bytes logged\n", entry->fileSize, result->logged);
+        return 1;
+    }
+
+    const uint32_t clusterSize = CARD_SECTORS_PER_CLUSTER * 512;
+    uint32_t cluster = entry->firstClusterLow;
+    uint32_t offset = 0;
+
+    while (cluster < 0xFFF8) {
+        if (cluster < 2) {
+            printf("  chain broken at %u of %u bytes\n", offset, result->logged);
+            return 1;
+        }
+
+        const uint8_t *data = cardCluster(cluster);
+        for (uint32_t i = 0; i < clusterSize && offset + i < result->logged; i++) {
+            if (data[i] != logByte(offset + i)) {
+                printf("  log differs at byte %u\n", offset + i);
+                return 1;
+            }
+        }
+
+        offset += clusterSize;
+        cluster = cardFatEntry(cluster);
+    }
+
+    // Only the superclusters holding the log are kept
+    const uint32_t superclusterSize = 256 * clusterSize;
+    const uint32_t kept = result->freeBefore - result->freeAfter;
+    const uint32_t needed = (result->logged + superclusterSize - 1) / superclusterSize * superclusterSize;
+
+    if (kept != needed || offset != needed) {
+        printf("  log chain %u bytes, keeps %u bytes of the freefile, needs %u\n", offset, kept, needed);
+        return 1;
+    }
+
+    const uint32_t freeClusters = freeFile->fileSize / clusterSize;
+    cluster = freeFile->firstClusterLow;
+
+    if (cluster != entry->firstClusterLow + needed / clusterSize) {
+        printf("  freefile starts at cluster %u\n", cluster);
+        return 1;
+    }
+
+    for (uint32_t i = 1; i < freeClusters; i++, cluster++) {
+        if (cardFatEntry(cluster) != cluster + 1) {
+            printf("  freefile chain broken at cluster %u\n", cluster);
+            return 1;
+        }
+    }
+
+    if (cardFatEntry(cluster) < 0xFFF8) {
+        printf("  freefile chain not terminated\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+static logResult_t runLog(const logRun_t *run)
+{
+    logResult_t result;
+    memset(&result, 0, sizeof(result));
+
+    cardFormat();
+
+    afatfs_init();
+    pollUntil(filesystemReady);
+
+    result.freeBefore = afatfs_getContiguousFreeSpace();
+
+    logOpened = logReserved = logClosed = false;
+    logFile = NULL;
+
+    const uint64_t openStartUs = card.nowUs;
+
+    afatfs_fopen("LOG00001.BFL", "as", logFileCreated);
+    pollUntil(logFileOpened);
+
+    if (run->reserve && afatfs_freserve(logFile, LOG_RESERVE_SIZE, logSpaceReserved)) {
+        pollUntil(logSpaceDone);
+    }
+
+    // While the log headers are written
+    pollUntil(afatfs_sectorCacheInSync);
+
+    result.openUs = card.nowUs - openStartUs;
+
+    const uint32_t singleWritesBefore = card.singleWrites;
+    const uint32_t multiWriteStartsBefore = card.multiWriteStarts;
+
+    uint64_t stallStartUs = 0;
+    uint8_t frame[4096];
+
+    for (uint32_t tickUs = 0; tickUs < run->durationUs; tickUs += TICK_US) {
+        if (tickUs % run->frameIntervalUs == 0) {
+            for (uint32_t i = 0; i < run->frameBytes; i++) {
+                frame[i] = logByte(result.logged + i);
+            }
+
+            const uint64_t startNs = benchNowNs();
+            const bool space = afatfs_getFreeBufferSpace() >= run->frameBytes;
+            if (space) {
+                result.logged += afatfs_fwrite(logFile, frame, run->frameBytes);
+            }
+            result.hostNs += benchNowNs() - startNs;
+
+            if (space) {
+                stallStartUs = 0;
+            } else {
+                if (!stallStartUs) {
+                    stallStartUs = card.nowUs;
+                }
+                result.worstStallUs = MAX(result.worstStallUs, (uint32_t)(card.nowUs - stallStartUs + run->frameIntervalUs));
+                result.framesDropped++;
+            }
+            result.frames++;
+        }
+
+        if (tickUs % POLL_INTERVAL_US == 0) {
+            const uint64_t startNs = benchNowNs();
+            afatfs_poll();
+            result.hostNs += benchNowNs() - startNs;
+        }
+
+        cardAdvance(TICK_US);
+    }
+
+    result.singleWrites = card.singleWrites - singleWritesBefore;
+    result.multiWriteStarts = card.multiWriteStarts - multiWriteStartsBefore;
+
+    afatfs_fclose(logFile, logFileClosed);
+    pollUntil(logFileDone);
+
+    result.freeAfter = afatfs_getContiguousFreeSpace();
+
+    pollUntil(filesystemDestroyed);
+
+    result.failures = checkLog(&result);
+
+    return result;
+}
+
+static void printResult(const logRun_t *run, const logResult_t *result)
+{
+    const double seconds = run->durationUs / 1e6;
+
+    printf("%-24s %9.1f %9.0f %9u %9.1f %9u %9.2f\n",
+        run->name,
+        result->openUs / 1000.0,
+        result->logged / seconds / 1024,
+        result->framesDropped,
+        result->worstStallUs / 1000.0,
+        result->singleWrites + result->multiWriteStarts,
+        (double)result->hostNs / result->frames / 1000);
+}
+
+int main(void)
+{
+    cardImage = (uint8_t *)malloc((size_t)CARD_BLOCKS * 512);
+
+    const logRun_t runs[] = {
+        { "sustained, grown",     false, 250, 512, 20000000 },
+        { "sustained, reserved",  true,  250, 512, 20000000 },
+        { "2kHz x 96B, grown",    false, 500,  96, 60000000 },
+        { "2kHz x 96B, reserved", true,  500,  96, 60000000 },
+    };
+
+    int failures = 0;
+
+    printf("%-24s %9s %9s %9s %9s %9s %9s\n", "log", "open", "rate", "dropped", "stall", "commands", "host");
+    printf("%-24s %9s %9s %9s %9s %9s %9s\n", "", "ms", "KB/s", "frames", "ms", "", "us/frame");
+
+    for (unsigned i = 0; i < ARRAYLEN(runs); i++) {
+        const logResult_t result = runLog(&runs[i]);
+        printResult(&runs[i], &result);
+        failures += result.failures;
+    }
+
+    printf("\nCommands are single block writes and multiple block write starts.\n");
+
+    free(cardImage);
+
+    if (failures) {
+        printf("%d logs did not read back\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
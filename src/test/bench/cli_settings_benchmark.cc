@@ -0,0 +1,129 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CLI setting lookup benchmark.
+ *
+ *   make bench_cli_settings_benchmark
+ *
+ * Restores a diff of every setting in valueTable, as pasted into the CLI,
+ * looking each name up the way cliSet() used to, with strncasecmp()
+ * through the whole table, and with the sorted name index.
+ */
+
+#include "bench.h"
+
+#include <string>
+#include <strings.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "cli/settings.h"
+
+    #include "sensors/current.h"
+    #include "sensors/voltage.h"
+
+    // Lookup tables of other modules
+    const char * const debugModeNames[DEBUG_COUNT] = { 0 };
+    const char * const currentMeterSourceNames[CURRENT_METER_COUNT] = { 0 };
+    const char * const voltageMeterSourceNames[VOLTAGE_METER_COUNT] = { 0 };
+}
+
+// cliGetSettingIndex() before the index
+static uint16_t linearFind(const char *name, uint8_t length)
+{
+    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
+        const char *settingName = valueTable[i].name;
+
+        if (strncasecmp(name, settingName, strlen(settingName)) == 0 && length == strlen(settingName)) {
+            return i;
+        }
+    }
+    return valueTableEntryCount;
+}
+
+// Name length of a "name = value" line, as getWordLength() in cli.c
+static uint8_t nameLength(const char *line)
+{
+    const char *end = strchr(line, '=');
+    while (end > line && end[-1] == ' ') {
+        end--;
+    }
+    return end - line;
+}
+
+int main(void)
+{
+    std::vector<std::string> diff;
+    uint32_t sum = 0;
+
+    // In table order, as dump and diff print it, and some misspelt
+    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
+        diff.push_back(std::string(valueTable[i].name) + " = 1");
+        if (i % 50 == 0) {
+            diff.push_back(std::string(valueTable[i].name) + "x = 1");
+        }
+    }
+
+    benchTimer_t initTimer = { "index sort", 0, 0, 0, 0, 0, 0 };
+    benchTimerStart(&initTimer);
+    valueTableIndexInit();
+    benchTimerStop(&initTimer, 1);
+
+    int mismatches = 0;
+    for (const std::string &line : diff) {
+        const uint8_t length = nameLength(line.c_str());
+        if (linearFind(line.c_str(), length) != valueTableFind(line.c_str(), length)) {
+            printf("mismatch: %s\n", line.c_str());
+            mismatches++;
+        }
+    }
+
+    benchTimer_t linearTimer = { "linear", 0, 0, 0, 0, 0, 0 };
+    benchTimer_t indexTimer = { "sorted index", 0, 0, 0, 0, 0, 0 };
+
+    for (int pass = 0; pass < 20; pass++) {
+        benchTimerStart(&linearTimer);
+        for (const std::string &line : diff) {
+            sum += linearFind(line.c_str(), nameLength(line.c_str()));
+        }
+        benchTimerStop(&linearTimer, 1);
+
+        benchTimerStart(&indexTimer);
+        for (const std::string &line : diff) {
+            sum += valueTableFind(line.c_str(), nameLength(line.c_str()));
+        }
+        benchTimerStop(&indexTimer, 1);
+    }
+
+    printf("%u settings, %u lines in the diff\n\n", valueTableEntryCount, (unsigned)diff.size());
+    benchReportHeader("diff");
+    benchReport(&linearTimer);
+    benchReport(&indexTimer);
+    benchReport(&initTimer);
+    printf("%-24s %12u\n\n", "  checksum", sum);
+
+    if (mismatches) {
+        printf("%d lookups differ\n", mismatches);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,169 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CRC benchmark.
+ *
+ *   make bench_crc_benchmark
+ *
+ * Checks frames of the sizes the serial protocols send, with the bitwise
+ * loops common/crc.c and esc_sensor.c used to have and with the tables,
+ * a byte at a time as the MSP parser does and in bulk.
+ */
+
+#include "bench.h"
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/crc.h"
+}
+
+#define FRAMES      4096
+#define PASSES      20
+
+static uint16_t bitwiseCrc16Ccitt(uint16_t crc, const uint8_t *data, int length)
+{
+    for (int i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int ii = 0; ii < 8; ++ii) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static uint8_t bitwiseCrc8(uint8_t crc, const uint8_t *data, int length, uint8_t poly)
+{
+    for (int i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int ii = 0; ii < 8; ++ii) {
+            crc = (crc & 0x80) ? (crc << 1) ^ poly : crc << 1;
+        }
+    }
+    return crc;
+}
+
+typedef enum {
+    CRC_DVB_S2,
+    CRC_CCITT,
+    CRC_SMBUS,
+} crcKind_e;
+
+typedef struct {
+    const char *name;
+    crcKind_e kind;
+    int length;
+} frameSize_t;
+
+static const frameSize_t frameSizes[] = {
+    { "CRSF channels", CRC_DVB_S2, 23 },
+    { "CRSF telemetry", CRC_DVB_S2, 62 },
+    { "MSP v2 reply", CRC_DVB_S2, 133 },
+    { "SRXL2 channels", CRC_CCITT, 78 },
+    { "ESC telemetry", CRC_SMBUS, 9 },
+};
+
+static void runFrameSize(const frameSize_t *size)
+{
+    std::vector<uint8_t> frames(FRAMES * size->length);
+    uint32_t seed = 0x5eed1234;
+    uint32_t sum = 0;
+
+    for (uint8_t &byte : frames) {
+        byte = benchRandom(&seed);
+    }
+
+    benchTimer_t bitwiseTimer = { "  bitwise", 0, 0, 0, 0, 0, 0 };
+    benchTimer_t byteTimer = { "  table, per byte", 0, 0, 0, 0, 0, 0 };
+    benchTimer_t bulkTimer = { "  table, bulk", 0, 0, 0, 0, 0, 0 };
+
+    for (int pass = 0; pass < PASSES; pass++) {
+        benchTimerStart(&bitwiseTimer);
+        for (int frame = 0; frame < FRAMES; frame++) {
+            const uint8_t *data = &frames[frame * size->length];
+            switch (size->kind) {
+            case CRC_DVB_S2:
+                sum += bitwiseCrc8(0, data, size->length, 0xD5);
+                break;
+            case CRC_CCITT:
+                sum += bitwiseCrc16Ccitt(0, data, size->length);
+                break;
+            case CRC_SMBUS:
+                sum += bitwiseCrc8(0, data, size->length, 0x07);
+                break;
+            }
+        }
+        benchTimerStop(&bitwiseTimer, FRAMES);
+
+        benchTimerStart(&byteTimer);
+        for (int frame = 0; frame < FRAMES; frame++) {
+            const uint8_t *data = &frames[frame * size->length];
+            uint16_t crc = 0;
+            for (int i = 0; i < size->length; i++) {
+                switch (size->kind) {
+                case CRC_DVB_S2:
+                    crc = crc8_dvb_s2(crc, data[i]);
+                    break;
+                case CRC_CCITT:
+                    crc = crc16_ccitt(crc, data[i]);
+                    break;
+                case CRC_SMBUS:
+                    crc = crc8_smbus(crc, data[i]);
+                    break;
+                }
+            }
+            sum += crc;
+        }
+        benchTimerStop(&byteTimer, FRAMES);
+
+        benchTimerStart(&bulkTimer);
+        for (int frame = 0; frame < FRAMES; frame++) {
+            const uint8_t *data = &frames[frame * size->length];
+            switch (size->kind) {
+            case CRC_DVB_S2:
+                sum += crc8_dvb_s2_update(0, data, size->length);
+                break;
+            case CRC_CCITT:
+                sum += crc16_ccitt_update(0, data, size->length);
+                break;
+            case CRC_SMBUS:
+                sum += crc8_smbus_update(0, data, size->length);
+                break;
+            }
+        }
+        benchTimerStop(&bulkTimer, FRAMES);
+    }
+
+    printf("%s, %d bytes\n", size->name, size->length);
+    benchReport(&bitwiseTimer);
+    benchReport(&byteTimer);
+    benchReport(&bulkTimer);
+    printf("%-24s %12u\n\n", "  checksum", sum);
+}
+
+int main(void)
+{
+    benchReportHeader("frame");
+    printf("\n");
+
+    for (unsigned i = 0; i < sizeof(frameSizes) / sizeof(frameSizes[0]); i++) {
+        runFrameSize(&frameSizes[i]);
+    }
+
+    return 0;
+}
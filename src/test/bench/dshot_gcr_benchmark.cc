@@ -0,0 +1,148 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * DShot telemetry decoder benchmark.
+ *
+ *   make bench_dshot_gcr_benchmark
+ *
+ * Decodes synthesised bitbang captures of four motors on one GPIO port,
+ * once with a dshotGcrDecodePort() call per motor, as the bitbang driver
+ * used to walk the samples for each motor, and once for the whole port.
+ * The decode results of the corpus are then reported for a few levels of
+ * line noise.
+ */
+
+#include "bench.h"
+
+extern "C" {
+    #include "platform.h"
+
+    #include "drivers/dshot_gcr.h"
+}
+
+#include "dshot_gcr_corpus.h"
+
+#define CAPTURES    20000
+#define MOTORS      4
+
+typedef struct {
+    uint16_t samples[GCR_CORPUS_SAMPLES];
+    uint32_t period[MOTORS];
+    gcrCorpusKind_e kind[MOTORS];
+} portCapture_t;
+
+static void makeCorpus(std::vector<portCapture_t> &corpus, const gcrCorpusNoise_t *noise, bool allClean)
+{
+    uint32_t seed = 0x5eed1234;
+
+    corpus.resize(CAPTURES);
+    for (portCapture_t &capture : corpus) {
+        memset(capture.samples, 0xff, sizeof(capture.samples));
+        for (int motor = 0; motor < MOTORS; motor++) {
+            // Mostly good replies, as in flight
+            const uint32_t pick = gcrCorpusRandom(&seed) % 20;
+            const gcrCorpusKind_e kind = (allClean || pick >= GCR_CORPUS_KIND_COUNT) ? GCR_CORPUS_CLEAN : (gcrCorpusKind_e)pick;
+            gcrCorpusCase_t test;
+            gcrCorpusMake(&test, kind, noise, &seed);
+            gcrCorpusSetPin(capture.samples, motor, test.level);
+            capture.period[motor] = test.period;
+            capture.kind[motor] = kind;
+        }
+    }
+}
+
+static void runTiming(void)
+{
+    static const gcrCorpusNoise_t noise = { 3, 0.4f, 0.001f };
+    std::vector<portCapture_t> corpus;
+    uint16_t periods[DSHOT_GCR_PORT_PINS];
+    uint32_t sum = 0;
+
+    makeCorpus(corpus, &noise, false);
+
+    benchTimer_t perMotorTimer = { "per motor", 0, 0, 0, 0, 0, 0 };
+    benchTimer_t perPortTimer = { "whole port", 0, 0, 0, 0, 0, 0 };
+
+    for (int pass = 0; pass < 10; pass++) {
+        benchTimerStart(&perMotorTimer);
+        for (const portCapture_t &capture : corpus) {
+            for (int motor = 0; motor < MOTORS; motor++) {
+                dshotGcrDecodePort(capture.samples, GCR_CORPUS_SAMPLES, 1 << motor, periods);
+                sum += periods[motor];
+            }
+        }
+        benchTimerStop(&perMotorTimer, corpus.size());
+
+        benchTimerStart(&perPortTimer);
+        for (const portCapture_t &capture : corpus) {
+            dshotGcrDecodePort(capture.samples, GCR_CORPUS_SAMPLES, (1 << MOTORS) - 1, periods);
+            for (int motor = 0; motor < MOTORS; motor++) {
+                sum += periods[motor];
+            }
+        }
+        benchTimerStop(&perPortTimer, corpus.size());
+    }
+
+    printf("%d motors on a port, %d samples per capture\n\n", MOTORS, GCR_CORPUS_SAMPLES);
+    benchReportHeader("port");
+    benchReport(&perMotorTimer);
+    benchReport(&perPortTimer);
+    printf("%-24s %12u\n\n", "  checksum", sum);
+}
+
+static void runErrorRate(float glitchProbability)
+{
+    const gcrCorpusNoise_t noise = { 3, 0.4f, glitchProbability };
+    std::vector<portCapture_t> corpus;
+    uint16_t periods[DSHOT_GCR_PORT_PINS];
+    int correct = 0, wrong = 0, invalid = 0, noEdge = 0;
+
+    makeCorpus(corpus, &noise, true);
+
+    for (const portCapture_t &capture : corpus) {
+        dshotGcrDecodePort(capture.samples, GCR_CORPUS_SAMPLES, (1 << MOTORS) - 1, periods);
+        for (int motor = 0; motor < MOTORS; motor++) {
+            if (periods[motor] == capture.period[motor]) {
+                correct++;
+            } else if (periods[motor] == DSHOT_GCR_INVALID) {
+                invalid++;
+            } else if (periods[motor] == DSHOT_GCR_NOEDGE) {
+                noEdge++;
+            } else {
+                wrong++;
+            }
+        }
+    }
+
+    const double frames = CAPTURES * MOTORS / 100.0;
+    printf("%10.1f%% %10.2f%% %10.2f%% %10.2f%% %10.3f%%\n", glitchProbability * 100,
+        correct / frames, invalid / frames, noEdge / frames, wrong / frames);
+}
+
+int main(void)
+{
+    runTiming();
+
+    printf("%11s %11s %11s %11s %11s\n", "glitches", "decoded", "invalid", "no edge", "wrong");
+    static const float glitches[] = { 0, 0.001f, 0.003f, 0.01f, 0.03f };
+    for (unsigned i = 0; i < sizeof(glitches) / sizeof(glitches[0]); i++) {
+        runErrorRate(glitches[i]);
+    }
+
+    return 0;
+}
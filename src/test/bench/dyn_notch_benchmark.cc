@@ -0,0 +1,142 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Dynamic notch analyser benchmark.
+ *
+ *   make bench_dyn_notch_benchmark [BENCH_OPTS=<blackbox.csv>]
+ *
+ * Runs gyroDataAnalyse() once per gyro loop at 8kHz over a gyro trace with
+ * the FFT analyser and with the sliding DFT analyser, and times every call.
+ * The mean is the average load, the 99th percentile and the maximum show
+ * how bursty it is. CMSIS-DSP is built from its C sources, with a C
+ * version of the bit reversal that is only available as assembly, and the
+ * analyser is driven from dyn_notch_harness.c.
+ *
+ * With the synthetic trace the tail rotor 1P and the motor tones move with
+ * the headspeed, and the distance from each tone to the nearest notch is
+ * reported as well.
+ */
+
+#include <algorithm>
+
+#include "bench.h"
+
+extern "C" {
+    #include "dyn_notch_harness.h"
+}
+
+#define GYRO_LOOPTIME_US    125
+#define NOTCH_MIN_HZ        100
+#define NOTCH_MAX_HZ        600
+#define WARMUP_SECONDS      1
+#define TAIL_RATIO          4.5f
+#define MOTOR_RATIO         10.0f
+
+typedef struct {
+    const char *name;
+    std::vector<double> callNs;
+    double toneErrorHz;
+    unsigned toneCount;
+} analyserResult_t;
+
+static void runAnalyser(analyserResult_t *result, int analyser, const benchGyroTrace_t *trace)
+{
+    double overheadNs, overheadCycles;
+    benchTimerOverhead(&overheadNs, &overheadCycles);
+
+    dynNotchHarnessInit(analyser, NOTCH_MIN_HZ, NOTCH_MAX_HZ, GYRO_LOOPTIME_US);
+
+    const size_t count = trace->axis[0].size();
+    const size_t warmup = WARMUP_SECONDS * trace->sampleRateHz;
+    const bool haveTones = !trace->headspeed.empty();
+
+    result->callNs.reserve(count);
+
+    for (size_t n = 0; n < count; n++) {
+        const float sample[3] = { trace->axis[0][n], trace->axis[1][n], trace->axis[2][n] };
+
+        const uint64_t start = benchNowNs();
+        dynNotchHarnessUpdate(sample);
+        result->callNs.push_back(fmax(0, benchNowNs() - start - overheadNs));
+
+        if (haveTones && n >= warmup && (n % 8) == 0) {
+            const float mainHz = trace->headspeed[n] / 60;
+            const float tones[2] = { mainHz * TAIL_RATIO, mainHz * MOTOR_RATIO };
+            float notch[2];
+
+            dynNotchHarnessNotches(0, notch);
+
+            for (int t = 0; t < 2; t++) {
+                if (tones[t] >= NOTCH_MIN_HZ && tones[t] <= NOTCH_MAX_HZ) {
+                    result->toneErrorHz += fminf(fabsf(tones[t] - notch[0]), fabsf(tones[t] - notch[1]));
+                    result->toneCount++;
+                }
+            }
+        }
+    }
+}
+
+static void reportAnalyser(const analyserResult_t *result)
+{
+    std::vector<double> sorted = result->callNs;
+    std::sort(sorted.begin(), sorted.end());
+
+    double sum = 0;
+    for (size_t i = 0; i < sorted.size(); i++) {
+        sum += sorted[i];
+    }
+
+    printf("%-16s %10.1f %10.1f %10.1f", result->name,
+        sum / sorted.size(), sorted[sorted.size() * 99 / 100], sorted.back());
+    if (result->toneCount) {
+        printf(" %14.1f", result->toneErrorHz / result->toneCount);
+    }
+    printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+    benchGyroTrace_t trace;
+
+    if (argc > 1) {
+        if (!benchLoadBlackboxCsv(&trace, argv[1])) {
+            fprintf(stderr, "Cannot read gyroADC columns from %s\n", argv[1]);
+            return 1;
+        }
+        printf("Trace: %s, %zu samples\n", argv[1], trace.axis[0].size());
+        // analysed as if logged at the gyro rate
+        trace.headspeed.clear();
+        trace.sampleRateHz = 1000000 / GYRO_LOOPTIME_US;
+    } else {
+        benchSynthHeliTrace(&trace, 1000000 / GYRO_LOOPTIME_US, 20);
+        printf("Trace: synthetic helicopter spectrum, %zu samples\n", trace.axis[0].size());
+    }
+    printf("Gyro loop %dHz, notch range %d-%dHz\n\n", 1000000 / GYRO_LOOPTIME_US, NOTCH_MIN_HZ, NOTCH_MAX_HZ);
+
+    analyserResult_t fft = { "FFT", {}, 0, 0 };
+    analyserResult_t sdft = { "SDFT", {}, 0, 0 };
+
+    runAnalyser(&fft, DYN_NOTCH_HARNESS_FFT, &trace);
+    runAnalyser(&sdft, DYN_NOTCH_HARNESS_SDFT, &trace);
+
+    printf("%-16s %10s %10s %10s %14s\n", "analyser", "mean ns", "p99 ns", "max ns", "tone error Hz");
+    reportAnalyser(&fft);
+    reportAnalyser(&sdft);
+
+    return 0;
+}
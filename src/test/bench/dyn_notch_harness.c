@@ -0,0 +1,120 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * C side of dyn_notch_benchmark. arm_math.h does not build as C++ on a
+ * 64 bit host, so everything that needs the analyser state lives here.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#include "build/debug.h"
+
+#include "common/axis.h"
+#include "common/filter.h"
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "flight/gyroanalyse.h"
+
+#include "pg/pg.h"
+#include "pg/pg_ids.h"
+
+#include "sensors/gyro.h"
+
+#include "dyn_notch_harness.h"
+
+uint8_t debugMode;
+int16_t debug[DEBUG16_VALUE_COUNT];
+
+gyro_t gyro;
+
+PG_REGISTER(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 0);
+
+static gyroAnalyseState_t state;
+static int currentAnalyser;
+
+uint32_t micros(void)
+{
+    return 0;
+}
+
+uint8_t calculateThrottlePercentAbs(void)
+{
+    return 50;
+}
+
+// As arm_bitreversal2.S
+void arm_bitreversal_32(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTable)
+{
+    for (int i = 0; i < bitRevLen; i += 2) {
+        const int a = pBitRevTable[i] >> 2;
+        const int b = pBitRevTable[i + 1] >> 2;
+
+        uint32_t tmp = pSrc[a];
+        pSrc[a] = pSrc[b];
+        pSrc[b] = tmp;
+
+        tmp = pSrc[a + 1];
+        pSrc[a + 1] = pSrc[b + 1];
+        pSrc[b + 1] = tmp;
+    }
+}
+
+void dynNotchHarnessInit(int analyser, uint16_t minHz, uint16_t maxHz, uint32_t looptimeUs)
+{
+    pgResetAll();
+    gyroConfigMutable()->dyn_notch_min_hz = minHz;
+    gyroConfigMutable()->dyn_notch_max_hz = maxHz;
+    gyroConfigMutable()->dyn_notch_width_percent = 8;
+    gyroConfigMutable()->dyn_notch_q = 120;
+    gyroConfigMutable()->dyn_notch_analyser = (analyser == DYN_NOTCH_HARNESS_SDFT) ? DYN_NOTCH_ANALYSER_SDFT : DYN_NOTCH_ANALYSER_FFT;
+
+    gyro.targetLooptime = looptimeUs;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        biquadFilterInit(&gyro.notchFilterDyn[axis], maxHz, looptimeUs, 1.2f, FILTER_NOTCH);
+        biquadFilterInit(&gyro.notchFilterDyn2[axis], maxHz, looptimeUs, 1.2f, FILTER_NOTCH);
+    }
+
+    memset(&state, 0, sizeof(state));
+    gyroDataAnalyseStateInit(&state, looptimeUs);
+
+    currentAnalyser = analyser;
+}
+
+void dynNotchHarnessUpdate(const float *sample)
+{
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyroDataAnalysePush(&state, axis, sample[axis]);
+    }
+    gyroDataAnalyse(&state, gyro.notchFilterDyn, gyro.notchFilterDyn2);
+}
+
+void dynNotchHarnessNotches(int axis, float *notch)
+{
+    if (currentAnalyser == DYN_NOTCH_HARNESS_SDFT) {
+        notch[0] = state.notchFreq[axis][0];
+        notch[1] = state.notchFreq[axis][1];
+    } else {
+        const float width = gyroConfig()->dyn_notch_width_percent / 100.0f;
+        notch[0] = state.centerFreq[axis] * (1 - width);
+        notch[1] = state.centerFreq[axis] * (1 + width);
+    }
+}
@@ -0,0 +1,174 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Filter cascade benchmark.
+ *
+ *   make bench_filter_cascade_benchmark [BENCH_OPTS=<blackbox.csv>]
+ *
+ * Runs a gyro trace through the static gyro chain (two notches and a
+ * biquad lowpass) and the D-term chain (notch, PT1 and biquad lowpass) for
+ * all three axes, once with a filterApplyFnPtr call per filter as the gyro
+ * and PID code used to, and once with one biquadCascadeApply() per axis.
+ * Disabled filters cost a nullFilterApply() call in the first case and
+ * nothing in the second, so every chain is also run with only its first
+ * stage enabled. The largest difference between the two outputs is
+ * reported to show they filter the same.
+ */
+
+#include "bench.h"
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/axis.h"
+    #include "common/filter.h"
+    #include "common/maths.h"
+    #include "common/utils.h"
+}
+
+#define LOOPTIME_US     250
+
+typedef struct {
+    filterApplyFnPtr applyFn;
+    union {
+        biquadFilter_t biquad;
+        pt1Filter_t pt1;
+    } filter;
+} chainFilter_t;
+
+typedef struct {
+    const char *name;
+    int count;
+    float hz[BIQUAD_CASCADE_MAX_STAGES];
+    float cutoff[BIQUAD_CASCADE_MAX_STAGES];
+    lowpassFilterType_e type[BIQUAD_CASCADE_MAX_STAGES];
+    bool notch[BIQUAD_CASCADE_MAX_STAGES];
+} chainConfig_t;
+
+static const chainConfig_t chains[] = {
+    { "gyro", 3, { 400, 200, 250 }, { 300, 100, 0 }, { FILTER_BIQUAD, FILTER_BIQUAD, FILTER_BIQUAD }, { true, true, false } },
+    { "dterm", 3, { 260, 150, 200 }, { 160, 0, 0 }, { FILTER_BIQUAD, FILTER_PT1, FILTER_BIQUAD }, { true, false, false } },
+};
+
+static void initChain(const chainConfig_t *config, int enabled, chainFilter_t chain[XYZ_AXIS_COUNT][BIQUAD_CASCADE_MAX_STAGES], biquadCascade_t cascade[XYZ_AXIS_COUNT])
+{
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        biquadCascadeInit(&cascade[axis]);
+
+        for (int n = 0; n < config->count; n++) {
+            chainFilter_t *filter = &chain[axis][n];
+
+            if (n >= enabled) {
+                filter->applyFn = nullFilterApply;
+            } else if (config->notch[n]) {
+                const float q = filterGetNotchQ(config->hz[n], config->cutoff[n]);
+                filter->applyFn = (filterApplyFnPtr)biquadFilterApply;
+                biquadFilterInit(&filter->filter.biquad, config->hz[n], LOOPTIME_US, q, FILTER_NOTCH);
+                biquadCascadeAdd(&cascade[axis], config->hz[n], LOOPTIME_US, q, FILTER_NOTCH);
+            } else if (config->type[n] == FILTER_PT1) {
+                const float k = pt1FilterGain(config->hz[n], LOOPTIME_US * 1e-6f);
+                filter->applyFn = (filterApplyFnPtr)pt1FilterApply;
+                pt1FilterInit(&filter->filter.pt1, k);
+                biquadCascadeAddPT1(&cascade[axis], k);
+            } else {
+                filter->applyFn = (filterApplyFnPtr)biquadFilterApply;
+                biquadFilterInitLPF(&filter->filter.biquad, config->hz[n], LOOPTIME_US);
+                biquadCascadeAddLPF(&cascade[axis], config->hz[n], LOOPTIME_US);
+            }
+        }
+    }
+}
+
+static void runChain(const chainConfig_t *config, int enabled, const benchGyroTrace_t *trace)
+{
+    static chainFilter_t chain[XYZ_AXIS_COUNT][BIQUAD_CASCADE_MAX_STAGES];
+    static biquadCascade_t cascade[XYZ_AXIS_COUNT];
+
+    const size_t loops = trace->axis[X].size();
+    std::vector<float> chainOut[XYZ_AXIS_COUNT];
+    std::vector<float> cascadeOut[XYZ_AXIS_COUNT];
+
+    char chainName[32], cascadeName[32];
+    snprintf(chainName, sizeof(chainName), "%s %d/%d, fn ptrs", config->name, enabled, config->count);
+    snprintf(cascadeName, sizeof(cascadeName), "%s %d/%d, cascade", config->name, enabled, config->count);
+    benchTimer_t chainTimer = { chainName, 0, 0, 0, 0, 0, 0 };
+    benchTimer_t cascadeTimer = { cascadeName, 0, 0, 0, 0, 0, 0 };
+
+    initChain(config, enabled, chain, cascade);
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        chainOut[axis].resize(loops);
+        cascadeOut[axis].resize(loops);
+    }
+
+    benchTimerStart(&chainTimer);
+    for (size_t loop = 0; loop < loops; loop++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            float value = trace->axis[axis][loop];
+            for (int n = 0; n < config->count; n++) {
+                value = chain[axis][n].applyFn((filter_t *)&chain[axis][n].filter, value);
+            }
+            chainOut[axis][loop] = value;
+        }
+    }
+    benchTimerStop(&chainTimer, loops);
+
+    benchTimerStart(&cascadeTimer);
+    for (size_t loop = 0; loop < loops; loop++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            cascadeOut[axis][loop] = biquadCascadeApply(&cascade[axis], trace->axis[axis][loop]);
+        }
+    }
+    benchTimerStop(&cascadeTimer, loops);
+
+    float maxError = 0;
+    for (size_t loop = 0; loop < loops; loop++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            maxError = fmaxf(maxError, fabsf(chainOut[axis][loop] - cascadeOut[axis][loop]));
+        }
+    }
+
+    benchReport(&chainTimer);
+    benchReport(&cascadeTimer);
+    printf("%-24s %12.2e\n", "  max difference", maxError);
+}
+
+int main(int argc, char *argv[])
+{
+    benchGyroTrace_t trace;
+
+    if (argc > 1) {
+        if (!benchLoadBlackboxCsv(&trace, argv[1])) {
+            fprintf(stderr, "Cannot read gyroADC columns from %s\n", argv[1]);
+            return 1;
+        }
+        printf("Trace: %s, %zu samples\n", argv[1], trace.axis[X].size());
+    } else {
+        benchSynthHeliTrace(&trace, 1000000 / LOOPTIME_US, 20);
+        printf("Trace: synthetic helicopter spectrum, %zu samples\n", trace.axis[X].size());
+    }
+    printf("Filtered at %d Hz, three axes per loop\n\n", 1000000 / LOOPTIME_US);
+
+    benchReportHeader("loop");
+    for (unsigned i = 0; i < ARRAYLEN(chains); i++) {
+        runChain(&chains[i], chains[i].count, &trace);
+        runChain(&chains[i], 1, &trace);
+    }
+
+    return 0;
+}
@@ -0,0 +1,295 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Gyro filter chain benchmark.
+ *
+ *   make bench_gyro_filter_benchmark [BENCH_OPTS=<blackbox.csv>]
+ *
+ * Feeds a gyro trace through gyroUpdate() and gyroFiltering() exactly as
+ * the gyro task does, then times each filter stage on its own. The trace
+ * is either a blackbox_decode CSV export or a synthetic helicopter
+ * spectrum. The dynamic notch analyser needs CMSIS-DSP and is not built
+ * on the host, so only the dynamic notch filters themselves are timed.
+ */
+
+#include "bench.h"
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/axis.h"
+    #include "common/filter.h"
+    #include "common/maths.h"
+
+    #include "drivers/accgyro/accgyro_fake.h"
+    #include "drivers/sensor.h"
+
+    #include "fc/runtime_config.h"
+
+    #include "flight/rpm_filter.h"
+
+    #include "io/beeper.h"
+
+    #include "pg/pg.h"
+
+    #include "scheduler/scheduler.h"
+
+    #include "sensors/gyro.h"
+    #include "sensors/gyro_init.h"
+    #include "sensors/sensors.h"
+
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+
+    static const benchGyroTrace_t *benchTrace;
+    static size_t benchSample;
+}
+
+#define PID_DENOM           2
+#define MAIN_MOTOR          0
+#define TAIL_MOTOR          1
+#define MAIN_MOTOR_RATIO    10.0f
+#define TAIL_RATIO          4.5f
+
+static void configureFilters(void)
+{
+    pgResetAll();
+
+    gyroConfigMutable()->gyro_lowpass_type = FILTER_BIQUAD;
+    gyroConfigMutable()->gyro_lowpass_hz = 200;
+    gyroConfigMutable()->gyro_lowpass2_type = FILTER_PT1;
+    gyroConfigMutable()->gyro_lowpass2_hz = 500;
+    gyroConfigMutable()->gyro_soft_notch_hz_1 = 400;
+    gyroConfigMutable()->gyro_soft_notch_cutoff_1 = 300;
+    gyroConfigMutable()->gyro_soft_notch_hz_2 = 200;
+    gyroConfigMutable()->gyro_soft_notch_cutoff_2 = 100;
+
+    // Main rotor 1P/2P, motor, tail rotor 1P/2P
+    rpmFilterConfig_t *rpm = rpmFilterConfigMutable();
+    rpm->filter_bank_motor_index[0] = MAIN_MOTOR + 1;
+    rpm->filter_bank_gear_ratio[0]  = MAIN_MOTOR_RATIO * 1000;
+    rpm->filter_bank_motor_index[1] = MAIN_MOTOR + 1;
+    rpm->filter_bank_gear_ratio[1]  = MAIN_MOTOR_RATIO * 1000 / 2;
+    rpm->filter_bank_motor_index[2] = MAIN_MOTOR + 1;
+    rpm->filter_bank_gear_ratio[2]  = 1000;
+    rpm->filter_bank_motor_index[3] = TAIL_MOTOR + 1;
+    rpm->filter_bank_gear_ratio[3]  = 1000;
+    rpm->filter_bank_motor_index[4] = TAIL_MOTOR + 1;
+    rpm->filter_bank_gear_ratio[4]  = 500;
+}
+
+static void setupGyro(void)
+{
+    gyroInit();
+    gyroSetTargetLooptime(PID_DENOM);
+    gyroInitFilters();
+    rpmFilterInit(rpmFilterConfig());
+
+    // Dynamic notches as gyroInitFilterDynamicNotch() would set them up
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        biquadFilterInit(&gyro.notchFilterDyn[axis], 350, gyro.targetLooptime, filterGetNotchQ(350, 300), FILTER_NOTCH);
+        biquadFilterInit(&gyro.notchFilterDyn2[axis], 350, gyro.targetLooptime, filterGetNotchQ(350, 300), FILTER_NOTCH);
+    }
+
+    gyro.gyroSensor1.calibration.cyclesRemaining = 0;
+    gyro.gyroSensor1.gyroDev.gyroZero[X] = 0;
+    gyro.gyroSensor1.gyroDev.gyroZero[Y] = 0;
+    gyro.gyroSensor1.gyroDev.gyroZero[Z] = 0;
+}
+
+static void feedSample(size_t index)
+{
+    const float scale = gyro.gyroSensor1.gyroDev.scale;
+    benchSample = index;
+    fakeGyroSet(&gyro.gyroSensor1.gyroDev,
+        constrain(lrintf(benchTrace->axis[X][index] / scale), INT16_MIN, INT16_MAX),
+        constrain(lrintf(benchTrace->axis[Y][index] / scale), INT16_MIN, INT16_MAX),
+        constrain(lrintf(benchTrace->axis[Z][index] / scale), INT16_MIN, INT16_MAX));
+}
+
+int main(int argc, char *argv[])
+{
+    benchGyroTrace_t trace;
+
+    if (argc > 1) {
+        if (!benchLoadBlackboxCsv(&trace, argv[1])) {
+            fprintf(stderr, "Cannot read gyroADC columns from %s\n", argv[1]);
+            return 1;
+        }
+        printf("Trace: %s, %zu samples\n", argv[1], trace.axis[X].size());
+    } else {
+        benchSynthHeliTrace(&trace, 8000, 20);
+        printf("Trace: synthetic helicopter spectrum, %zu samples\n", trace.axis[X].size());
+    }
+    benchTrace = &trace;
+
+    configureFilters();
+    setupGyro();
+
+    const size_t samples = trace.axis[X].size() - trace.axis[X].size() % PID_DENOM;
+    const size_t loops = samples / PID_DENOM;
+
+    printf("Gyro %u Hz, PID %u Hz, %zu PID loops\n\n", 1000000 / gyro.sampleLooptime, 1000000 / gyro.targetLooptime, loops);
+
+    // Full chain, as run by the gyro task
+
+    benchTimer_t sensorTimer = { "gyroUpdate", 0, 0, 0, 0, 0, 0 };
+    benchTimer_t filterTimer = { "gyroFiltering", 0, 0, 0, 0, 0, 0 };
+
+    std::vector<float> filtered[XYZ_AXIS_COUNT];
+    std::vector<float> downsampled[XYZ_AXIS_COUNT];
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        filtered[axis].resize(loops);
+        downsampled[axis].resize(loops);
+    }
+
+    for (size_t loop = 0; loop < loops; loop++) {
+        for (int n = 0; n < PID_DENOM; n++) {
+            feedSample(loop * PID_DENOM + n);
+            benchTimerStart(&sensorTimer);
+            gyroUpdate();
+            benchTimerStop(&sensorTimer, 1);
+        }
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            downsampled[axis][loop] = gyro.downsampleFilterEnabled ? gyro.sampleSum[axis] : gyro.sampleSum[axis] / gyro.sampleWeight;
+        }
+
+        rpmFilterUpdate(0);
+
+        benchTimerStart(&filterTimer);
+        gyroFiltering(0);
+        benchTimerStop(&filterTimer, 1);
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            filtered[axis][loop] = gyro.gyroADCf[axis];
+        }
+    }
+
+    // Individual stages over the downsampled signal, one pass per stage
+
+    benchTimer_t rpmTimer = { "rpm notches", 0, 0, 0, 0, 0, 0 };
+    benchTimer_t staticTimer = { "static notches+lowpass", 0, 0, 0, 0, 0, 0 };
+    benchTimer_t dynNotchTimer = { "dynamic notches", 0, 0, 0, 0, 0, 0 };
+
+    setupGyro();
+
+    std::vector<float> stage[XYZ_AXIS_COUNT];
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        stage[axis] = downsampled[axis];
+    }
+
+    benchTimerStart(&rpmTimer);
+    for (size_t loop = 0; loop < loops; loop++) {
+        float values[XYZ_AXIS_COUNT] = { stage[X][loop], stage[Y][loop], stage[Z][loop] };
+        rpmFilterGyroAxes(values);
+        stage[X][loop] = values[X];
+        stage[Y][loop] = values[Y];
+        stage[Z][loop] = values[Z];
+    }
+    benchTimerStop(&rpmTimer, loops);
+
+    benchTimerStart(&staticTimer);
+    for (size_t loop = 0; loop < loops; loop++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            float value = stage[axis][loop];
+            value = biquadCascadeApply(&gyro.staticFilter[axis], value);
+            value = gyro.lowpassFilterApplyFn((filter_t *)&gyro.lowpassFilter[axis], value);
+            stage[axis][loop] = value;
+        }
+    }
+    benchTimerStop(&staticTimer, loops);
+
+    benchTimerStart(&dynNotchTimer);
+    for (size_t loop = 0; loop < loops; loop++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            float value = stage[axis][loop];
+            value = biquadFilterApplyDF1(&gyro.notchFilterDyn[axis], value);
+            value = biquadFilterApplyDF1(&gyro.notchFilterDyn2[axis], value);
+            stage[axis][loop] = value;
+        }
+    }
+    benchTimerStop(&dynNotchTimer, loops);
+
+    // Notch coefficient updates, all banks from the phasor table or one bank exactly
+
+    benchTimer_t rpmFastTimer = { "rpm update, all banks", 0, 0, 0, 0, 0, 0 };
+    benchTimer_t rpmExactTimer = { "rpm update, one bank", 0, 0, 0, 0, 0, 0 };
+
+    for (int fast = 1; fast >= 0; fast--) {
+        benchTimer_t *timer = fast ? &rpmFastTimer : &rpmExactTimer;
+        rpmFilterConfigMutable()->filter_fast_update = fast;
+        rpmFilterInit(rpmFilterConfig());
+        benchTimerStart(timer);
+        for (size_t loop = 0; loop < loops; loop++) {
+            benchSample = loop * PID_DENOM;
+            rpmFilterUpdate(0);
+        }
+        benchTimerStop(timer, loops);
+    }
+
+    benchReportHeader("sample");
+    benchReport(&sensorTimer);
+    benchReport(&filterTimer);
+    printf("\n");
+    benchReportHeader("PID loop");
+    benchReport(&rpmTimer);
+    benchReport(&staticTimer);
+    benchReport(&dynNotchTimer);
+    benchReport(&rpmFastTimer);
+    benchReport(&rpmExactTimer);
+
+    // Attenuation summary so a filter change that breaks the chain is obvious
+    double rawPower = 0, filteredPower = 0;
+    for (size_t loop = loops / 2; loop < loops; loop++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            const float raw = trace.axis[axis][loop * PID_DENOM];
+            rawPower += raw * raw;
+            filteredPower += filtered[axis][loop] * filtered[axis][loop];
+        }
+    }
+    printf("\nOutput/input RMS ratio: %.3f\n", sqrt(filteredPower / rawPower));
+
+    return 0;
+}
+
+
+// STUBS
+
+extern "C" {
+
+uint32_t micros(void) { return 0; }
+void beeper(beeperMode_e) {}
+uint8_t detectedSensors[] = { GYRO_NONE, ACC_NONE };
+timeDelta_t getGyroUpdateRate(void) { return gyro.targetLooptime; }
+void sensorsSet(uint32_t) {}
+void schedulerResetTaskStatistics(taskId_e) {}
+armingDisableFlags_e getArmingDisableFlags(void) { return (armingDisableFlags_e)0; }
+void writeEEPROM(void) {}
+
+uint8_t getMotorCount(void) { return 2; }
+
+float getMotorRPMAt(uint8_t motor, timeUs_t)
+{
+    const float headspeed = benchTrace->headspeed[benchSample];
+    return (motor == MAIN_MOTOR) ? headspeed * MAIN_MOTOR_RATIO : headspeed * TAIL_RATIO;
+}
+
+}
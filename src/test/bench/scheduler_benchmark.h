@@ -0,0 +1,154 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Scheduler overhead benchmark, shared by
+ *
+ *   make bench_scheduler_linear_benchmark
+ *   make bench_scheduler_deadline_benchmark
+ *
+ * which build scheduler.c without and with USE_SCHEDULER_DEADLINE_QUEUE.
+ * The task list is the full one from fc/tasks.c with typical rates. Task
+ * bodies only advance the simulated clock, so the figures are the cost of
+ * a scheduler() pass itself.
+ */
+
+#include "bench.h"
+
+extern "C" {
+    #include "platform.h"
+
+    #include "scheduler/scheduler.h"
+
+    static uint32_t simulatedTime;
+    static uint32_t taskSeed = 1;
+    static bool eventsPending;
+
+    uint32_t micros(void) { return simulatedTime; }
+
+    static void taskRun(timeUs_t)
+    {
+        simulatedTime += 5 + benchRandom(&taskSeed) % 40;
+    }
+
+    static bool taskEventCheck(timeUs_t, timeDelta_t)
+    {
+        return eventsPending && (benchRandom(&taskSeed) & 7) == 0;
+    }
+
+    bool gyroFilterReady(void) { return false; }
+    bool pidLoopReady(void) { return false; }
+}
+
+#define TASK_PERIOD_HZ(hz) (1000000 / (hz))
+
+// Positional, so the table also builds with compilers that lack array designators
+#if defined(USE_SCHEDULER_DEADLINE_QUEUE)
+#define BENCH_TASK_QUEUE_FIELDS     0, 0,
+#else
+#define BENCH_TASK_QUEUE_FIELDS
+#endif
+
+#define BENCH_TASK(name, check, hz, priority) \
+    { name, NULL, check, taskRun, TASK_PERIOD_HZ(hz), priority, 0, 0, 0, 0, 0, 0, BENCH_TASK_QUEUE_FIELDS 0, 0, 0, 0, 0 }
+
+static task_t tasks[TASK_COUNT] = {
+    BENCH_TASK("SYSTEM", NULL, 10, TASK_PRIORITY_MEDIUM_HIGH),
+    BENCH_TASK("MAIN", NULL, 1000, TASK_PRIORITY_MEDIUM_HIGH),
+    BENCH_TASK("GYRO", NULL, 8000, TASK_PRIORITY_REALTIME),
+    BENCH_TASK("FILTER", NULL, 4000, TASK_PRIORITY_REALTIME),
+    BENCH_TASK("PID", NULL, 4000, TASK_PRIORITY_REALTIME),
+    BENCH_TASK("ACC", NULL, 1000, TASK_PRIORITY_MEDIUM),
+    BENCH_TASK("ATTITUDE", NULL, 100, TASK_PRIORITY_MEDIUM),
+    BENCH_TASK("RX", taskEventCheck, 33, TASK_PRIORITY_HIGH),
+    BENCH_TASK("SERIAL", NULL, 100, TASK_PRIORITY_LOW),
+    BENCH_TASK("DISPATCH", taskEventCheck, 1000, TASK_PRIORITY_HIGH),
+    BENCH_TASK("BATTERY_VOLTAGE", NULL, 50, TASK_PRIORITY_MEDIUM),
+    BENCH_TASK("BATTERY_CURRENT", NULL, 50, TASK_PRIORITY_MEDIUM),
+    BENCH_TASK("BATTERY_ALERTS", taskEventCheck, 5, TASK_PRIORITY_MEDIUM),
+    BENCH_TASK("BEEPER", NULL, 100, TASK_PRIORITY_LOW),
+    BENCH_TASK("GPS", NULL, 100, TASK_PRIORITY_MEDIUM),
+    BENCH_TASK("COMPASS", NULL, 10, TASK_PRIORITY_LOW),
+    BENCH_TASK("BARO", NULL, 20, TASK_PRIORITY_LOW),
+    BENCH_TASK("ALTITUDE", NULL, 40, TASK_PRIORITY_LOW),
+    BENCH_TASK("TELEMETRY", NULL, 250, TASK_PRIORITY_LOW),
+    BENCH_TASK("LEDSTRIP", NULL, 100, TASK_PRIORITY_LOW),
+    BENCH_TASK("OSD", NULL, 60, TASK_PRIORITY_LOW),
+    BENCH_TASK("ESC_SENSOR", NULL, 100, TASK_PRIORITY_LOW),
+    BENCH_TASK("CMS", NULL, 20, TASK_PRIORITY_LOW),
+    BENCH_TASK("ADC_INTERNAL", NULL, 1, TASK_PRIORITY_LOW),
+};
+
+extern "C" task_t *getTask(unsigned taskId)
+{
+    return &tasks[taskId];
+}
+
+static void setupTasks(void)
+{
+    schedulerInit();
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        if (tasks[taskId].staticPriority != TASK_PRIORITY_REALTIME) {
+            setTaskEnabled((taskId_e)taskId, true);
+        }
+    }
+}
+
+int main(void)
+{
+#if defined(USE_SCHEDULER_DEADLINE_QUEUE)
+    printf("Scheduler core: deadline queue, %d tasks\n\n", TASK_COUNT);
+#else
+    printf("Scheduler core: linear scan, %d tasks\n\n", TASK_COUNT);
+#endif
+
+    const int passes = 2000000;
+
+    benchTimer_t idleTimer = { "idle pass", 0, 0, 0, 0, 0, 0 };
+    benchTimer_t loadedTimer = { "loaded pass", 0, 0, 0, 0, 0, 0 };
+
+    // Nothing due and no events: the common case between two gyro samples
+    simulatedTime = 1000;
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        tasks[taskId].lastExecutedAtUs = simulatedTime;
+    }
+    setupTasks();
+    eventsPending = false;
+
+    benchTimerStart(&idleTimer);
+    for (int pass = 0; pass < passes; pass++) {
+        scheduler();
+    }
+    benchTimerStop(&idleTimer, passes);
+
+    // Running flight: 4 us between passes plus the simulated task time
+    setupTasks();
+    eventsPending = true;
+
+    benchTimerStart(&loadedTimer);
+    for (int pass = 0; pass < passes; pass++) {
+        simulatedTime += 4;
+        scheduler();
+    }
+    benchTimerStop(&loadedTimer, passes);
+
+    benchReportHeader("pass");
+    benchReport(&idleTimer);
+    benchReport(&loadedTimer);
+
+    return 0;
+}
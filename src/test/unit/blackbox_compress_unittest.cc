@@ -0,0 +1,402 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox_compress.h"
+    #include "common/maths.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static std::vector<uint8_t> compressed;
+static int writeCalls;
+static int dropFirst = -1;
+static int dropCount;
+
+// Loses the writes from dropFirst on, as a full flash buffer or a failed SD card write does
+static void writeCompressed(const uint8_t *data, int len)
+{
+    EXPECT_LE(len, BLACKBOX_COMPRESS_BUFFER_SIZE);
+    if (writeCalls < dropFirst || writeCalls >= dropFirst + dropCount) {
+        compressed.insert(compressed.end(), data, data + len);
+    }
+    writeCalls++;
+}
+
+// One block, as src/utils/blackbox_decompress.py
+class Decompressor {
+public:
+    Decompressor(const std::vector<uint8_t> &data, size_t start, size_t limit) : data(data), pos(start + 5), limit(limit), range(0xFFFFFFFF), code(0), context(0)
+    {
+        for (size_t i = start + 1; i < start + 5; i++) {
+            code = (code << 8) | byteAt(i);
+        }
+        endProbability = 1 << (BLACKBOX_COMPRESS_PROB_BITS - 1);
+        for (int node = 0; node < 512; node++) {
+            probability[node] = 1 << (BLACKBOX_COMPRESS_PROB_BITS - 1);
+        }
+    }
+
+    // Returns false at the end of the block, or once past limit
+    bool next(uint8_t *value)
+    {
+        if (pos > limit || bit(&endProbability)) {
+            return false;
+        }
+
+        uint16_t *tree = probability + context * 256;
+        unsigned node = 1;
+        while (node < 256) {
+            node = (node << 1) | bit(&tree[node]);
+        }
+
+        *value = node & 0xFF;
+        context = *value >> 7;
+        return true;
+    }
+
+    size_t consumed(void) const
+    {
+        return pos;
+    }
+
+private:
+    uint8_t byteAt(size_t index) const
+    {
+        return index < data.size() ? data[index] : 0;
+    }
+
+    unsigned bit(uint16_t *p)
+    {
+        const uint32_t bound = (range >> BLACKBOX_COMPRESS_PROB_BITS) * *p;
+        unsigned result;
+
+        if (code < bound) {
+            range = bound;
+            *p += ((1 << BLACKBOX_COMPRESS_PROB_BITS) - *p) >> BLACKBOX_COMPRESS_ADAPT_SHIFT;
+            result = 0;
+        } else {
+            code -= bound;
+            range -= bound;
+            *p -= *p >> BLACKBOX_COMPRESS_ADAPT_SHIFT;
+            result = 1;
+        }
+
+        while (range < (1 << 24)) {
+            range <<= 8;
+            code = (code << 8) | byteAt(pos++);
+        }
+
+        return result;
+    }
+
+    const std::vector<uint8_t> &data;
+    size_t pos;
+    size_t limit;
+    uint32_t range;
+    uint32_t code;
+    unsigned context;
+    uint16_t endProbability;
+    uint16_t probability[512];
+};
+
+static uint16_t testCrc(const std::vector<uint8_t> &data)
+{
+    uint16_t crc = 0;
+    for (uint8_t value : data) {
+        crc ^= value << 8;
+        for (int i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static size_t findSync(const std::vector<uint8_t> &data, size_t from)
+{
+    for (size_t i = from; i + BLACKBOX_COMPRESS_SYNC_SIZE <= data.size(); i++) {
+        if (memcmp(&data[i], BLACKBOX_COMPRESS_SYNC, BLACKBOX_COMPRESS_SYNC_SIZE) == 0) {
+            return i;
+        }
+    }
+    return data.size();
+}
+
+static int blocksDecoded;
+static int blocksLost;
+
+// The blocks that check out, skipping on to the next marker past those that don't
+static std::vector<uint8_t> decompress(const std::vector<uint8_t> &data, size_t maxSize)
+{
+    std::vector<uint8_t> output;
+    size_t pos = 0;
+
+    blocksDecoded = 0;
+    blocksLost = 0;
+
+    while (pos < data.size()) {
+        if (findSync(data, pos) != pos) {
+            pos = findSync(data, pos);
+            if (pos == data.size()) {
+                break;
+            }
+            blocksLost++;
+        }
+
+        const size_t start = pos + BLACKBOX_COMPRESS_SYNC_SIZE;
+        const size_t limit = findSync(data, start);
+
+        std::vector<uint8_t> block;
+        Decompressor decompressor(data, start, limit);
+        uint8_t value;
+        while (output.size() + block.size() <= maxSize && decompressor.next(&value)) {
+            block.push_back(value);
+        }
+
+        const size_t end = decompressor.consumed();
+        if (end + 2 <= limit && testCrc(block) == ((data[end] << 8) | data[end + 1])) {
+            output.insert(output.end(), block.begin(), block.end());
+            blocksDecoded++;
+            pos = end + 2;
+        } else {
+            blocksLost++;
+            pos = limit;
+        }
+    }
+
+    return output;
+}
+
+static std::vector<uint8_t> roundTrip(const std::vector<uint8_t> &input, int chunk)
+{
+    static blackboxCompressor_t compressor;
+
+    compressed.clear();
+    writeCalls = 0;
+
+    blackboxCompressInit(&compressor, writeCompressed);
+    for (size_t i = 0; i < input.size(); i += chunk) {
+        blackboxCompress(&compressor, input.data() + i, MIN((size_t)chunk, input.size() - i));
+    }
+    blackboxCompressFinish(&compressor);
+
+    std::vector<uint8_t> output = decompress(compressed, input.size());
+
+    // The decoder reads exactly what the encoder wrote, in one block
+    EXPECT_EQ(1, blocksDecoded);
+    EXPECT_EQ(0, blocksLost);
+
+    return output;
+}
+
+static uint32_t testRandom(uint32_t *seed)
+{
+    *seed = *seed * 1664525 + 1013904223;
+    return *seed >> 8;
+}
+
+// Bytes in the shape of a P-frame, small signed variable byte deltas
+static void appendFrame(std::vector<uint8_t> *bytes, uint32_t *seed)
+{
+    bytes->push_back('P');
+    for (int field = 0; field < 30; field++) {
+        const int32_t delta = (testRandom(seed) & 3) ? (int32_t)(testRandom(seed) % 41) - 20 : 0;
+        uint32_t zigzag = (uint32_t)((delta << 1) ^ (delta >> 31));
+        while (zigzag > 127) {
+            bytes->push_back((uint8_t)(zigzag | 0x80));
+            zigzag >>= 7;
+        }
+        bytes->push_back(zigzag);
+    }
+}
+
+static std::vector<uint8_t> frameLikeBytes(size_t frames)
+{
+    std::vector<uint8_t> bytes;
+    uint32_t seed = 1;
+
+    for (size_t frame = 0; frame < frames; frame++) {
+        appendFrame(&bytes, &seed);
+    }
+
+    return bytes;
+}
+
+// Compresses frames with a sync point before each, as the log does before each I-frame.
+// Returns where in the input each block starts
+static std::vector<size_t> compressFrames(std::vector<uint8_t> *input, size_t frames)
+{
+    static blackboxCompressor_t compressor;
+    std::vector<size_t> blockStarts(1, 0);
+    uint32_t seed = 1;
+
+    compressed.clear();
+    writeCalls = 0;
+    input->clear();
+
+    blackboxCompressInit(&compressor, writeCompressed);
+    for (size_t frame = 0; frame < frames; frame++) {
+        if (blackboxCompressSync(&compressor)) {
+            blockStarts.push_back(input->size());
+        }
+
+        const size_t start = input->size();
+        appendFrame(input, &seed);
+        blackboxCompress(&compressor, input->data() + start, input->size() - start);
+    }
+    blackboxCompressFinish(&compressor);
+
+    return blockStarts;
+}
+
+// True if output is input with whole blocks first to last - 1 left out
+static bool isInputWithoutBlocks(const std::vector<uint8_t> &output, const std::vector<uint8_t> &input,
+    const std::vector<size_t> &blockStarts, size_t first, size_t last)
+{
+    const size_t gapStart = blockStarts[first];
+    const size_t gapEnd = last < blockStarts.size() ? blockStarts[last] : input.size();
+
+    std::vector<uint8_t> expected(input.begin(), input.begin() + gapStart);
+    expected.insert(expected.end(), input.begin() + gapEnd, input.end());
+
+    return output == expected;
+}
+
+TEST(BlackboxCompressTest, Empty)
+{
+    std::vector<uint8_t> input;
+
+    EXPECT_EQ(input, roundTrip(input, 1));
+    EXPECT_EQ(BLACKBOX_COMPRESS_SYNC_SIZE + 5 + 2, compressed.size());
+    EXPECT_EQ(0, memcmp(compressed.data(), BLACKBOX_COMPRESS_SYNC, BLACKBOX_COMPRESS_SYNC_SIZE));
+    EXPECT_EQ(0, compressed[BLACKBOX_COMPRESS_SYNC_SIZE]);
+}
+
+TEST(BlackboxCompressTest, Text)
+{
+    const char *text = "H Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:2\n";
+    std::vector<uint8_t> input(text, text + strlen(text));
+
+    EXPECT_EQ(input, roundTrip(input, 7));
+}
+
+TEST(BlackboxCompressTest, FrameLikeData)
+{
+    std::vector<uint8_t> input = frameLikeBytes(2000);
+
+    EXPECT_EQ(input, roundTrip(input, 31));
+    EXPECT_LT(compressed.size(), input.size() * 3 / 4);
+    EXPECT_EQ((compressed.size() + BLACKBOX_COMPRESS_BUFFER_SIZE - 1) / BLACKBOX_COMPRESS_BUFFER_SIZE, (size_t)writeCalls);
+}
+
+TEST(BlackboxCompressTest, RandomData)
+{
+    // Exercises the carry into held 0xFF bytes, and costs little over the input
+    std::vector<uint8_t> input;
+    uint32_t seed = 2;
+    for (int i = 0; i < 50000; i++) {
+        input.push_back(testRandom(&seed));
+    }
+
+    EXPECT_EQ(input, roundTrip(input, 1000));
+    EXPECT_LT(compressed.size(), input.size() * 102 / 100);
+}
+
+TEST(BlackboxCompressTest, ConstantData)
+{
+    std::vector<uint8_t> input(20000, 0xFF);
+
+    EXPECT_EQ(input, roundTrip(input, 1));
+    EXPECT_LT(compressed.size(), input.size() / 20);
+}
+
+TEST(BlackboxCompressTest, Blocks)
+{
+    std::vector<uint8_t> input;
+    const std::vector<size_t> blockStarts = compressFrames(&input, 2000);
+
+    // Each block holds at least BLACKBOX_COMPRESS_BLOCK_SIZE, and ends at the sync point after
+    EXPECT_GT(blockStarts.size(), 10);
+    for (size_t i = 1; i < blockStarts.size(); i++) {
+        EXPECT_GE(blockStarts[i] - blockStarts[i - 1], (size_t)BLACKBOX_COMPRESS_BLOCK_SIZE);
+        EXPECT_EQ('P', input[blockStarts[i]]);
+    }
+
+    EXPECT_EQ(input, decompress(compressed, input.size()));
+    EXPECT_EQ(blockStarts.size(), (size_t)blocksDecoded);
+    EXPECT_EQ(0, blocksLost);
+
+    // Starting each block afresh costs little
+    EXPECT_LT(compressed.size(), input.size() * 3 / 4);
+}
+
+TEST(BlackboxCompressTest, DroppedWriteRecovers)
+{
+    std::vector<uint8_t> input;
+
+    // One write lost in the middle of the log
+    dropFirst = 300;
+    dropCount = 1;
+    const std::vector<size_t> blockStarts = compressFrames(&input, 2000);
+    dropFirst = -1;
+
+    const std::vector<uint8_t> output = decompress(compressed, input.size());
+
+    // Only the block the write was in is lost, the log picks up again at the next
+    EXPECT_EQ(1, blocksLost);
+    EXPECT_EQ(blockStarts.size() - 1, (size_t)blocksDecoded);
+
+    bool recovered = false;
+    for (size_t first = 1; first + 1 < blockStarts.size(); first++) {
+        recovered |= isInputWithoutBlocks(output, input, blockStarts, first, first + 1);
+    }
+    EXPECT_TRUE(recovered);
+}
+
+TEST(BlackboxCompressTest, DroppedWritesAcrossBlocksRecover)
+{
+    std::vector<uint8_t> input;
+
+    // Writes lost for longer than a block, and at the very start of the log
+    for (int first : { 0, 200 }) {
+        dropFirst = first;
+        dropCount = 80;
+        const std::vector<size_t> blockStarts = compressFrames(&input, 2000);
+        dropFirst = -1;
+
+        const std::vector<uint8_t> output = decompress(compressed, input.size());
+
+        EXPECT_GT(blocksDecoded, 0);
+        EXPECT_LT(output.size(), input.size());
+
+        bool recovered = false;
+        for (size_t first = 0; first < blockStarts.size(); first++) {
+            for (size_t last = first + 1; last < blockStarts.size() && last <= first + 4; last++) {
+                recovered |= isInputWithoutBlocks(output, input, blockStarts, first, last);
+            }
+        }
+        EXPECT_TRUE(recovered);
+    }
+}
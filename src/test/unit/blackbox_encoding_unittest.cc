@@ -22,6 +22,8 @@ extern "C" {
 
     #include "blackbox/blackbox.h"
     #include "blackbox/blackbox_encoding.h"
+    #include "common/encoding.h"
+    #include "common/streambuf.h"
     #include "common/utils.h"
 
     #include "pg/pg.h"
@@ -240,12 +242,554 @@ TEST(BlackboxTest, TestWriteTag2_3SVariable_BITS887)
     EXPECT_EQ(0, buf[3]); // ensure next byte has not been written
     buf += 3;
 }
+
+/*
+ * Reference: the byte at a time encoders the frame encoders replaced, writing
+ * to their own buffer.
+ */
+
+static uint8_t refBuffer[1024];
+static int refPos;
+
+static void refWrite(uint8_t value)
+{
+    ASSERT_LT(refPos, (int)sizeof(refBuffer));
+    refBuffer[refPos++] = value;
+}
+
+/**
+ * Write an unsigned integer to the blackbox serial port using variable byte encoding.
+ */
+static void refWriteUnsignedVB(uint32_t value)
+{
+    //While this isn't the final byte (we can only write 7 bits at a time)
+    while (value > 127) {
+        refWrite((uint8_t) (value | 0x80)); // Set the high bit to mean "more bytes follow"
+        value >>= 7;
+    }
+    refWrite(value);
+}
+
+/**
+ * Write a signed integer to the blackbox serial port using ZigZig and variable byte encoding.
+ */
+static void refWriteSignedVB(int32_t value)
+{
+    //ZigZag encode to make the value always positive
+    refWriteUnsignedVB(zigzagEncode(value));
+}
+
+static void refWriteSignedVBArray(int32_t *array, int count)
+{
+    for (int i = 0; i < count; i++) {
+        refWriteSignedVB(array[i]);
+    }
+}
+
+static void refWriteSigned16VBArray(int16_t *array, int count)
+{
+    for (int i = 0; i < count; i++) {
+        refWriteSignedVB(array[i]);
+    }
+}
+
+static void refWriteS16(int16_t value)
+{
+    refWrite(value & 0xFF);
+    refWrite((value >> 8) & 0xFF);
+}
+
+/**
+ * Write a 2 bit tag followed by 3 signed fields of 2, 4, 6 or 32 bits
+ */
+static void refWriteTag2_3S32(int32_t *values)
+{
+    static const int NUM_FIELDS = 3;
+
+    //Need to be enums rather than const ints if we want to switch on them (due to being C)
+    enum {
+        BITS_2  = 0,
+        BITS_4  = 1,
+        BITS_6  = 2,
+        BITS_32 = 3
+    };
+
+    enum {
+        BYTES_1  = 0,
+        BYTES_2  = 1,
+        BYTES_3  = 2,
+        BYTES_4  = 3
+    };
+
+    int selector = BITS_2, selector2;
+
+    /*
+     * Find out how many bits the largest value requires to encode, and use it to choose one of the packing schemes
+     * below:
+     *
+     * Selector possibilities
+     *
+     * 2 bits per field  ss11 2233,
+     * 4 bits per field  ss00 1111 2222 3333
+     * 6 bits per field  ss11 1111 0022 2222 0033 3333
+     * 32 bits per field sstt tttt followed by fields of various byte counts
+     */
+    for (int x = 0; x < NUM_FIELDS; x++) {
+        //Require more than 6 bits?
+        if (values[x] >= 32 || values[x] < -32) {
+            selector = BITS_32;
+            break;
+        }
+
+        //Require more than 4 bits?
+        if (values[x] >= 8 || values[x] < -8) {
+             if (selector < BITS_6) {
+                 selector = BITS_6;
+             }
+        } else if (values[x] >= 2 || values[x] < -2) { //Require more than 2 bits?
+            if (selector < BITS_4) {
+                selector = BITS_4;
+            }
+        }
+    }
+
+    switch (selector) {
+    case BITS_2:
+        refWrite((selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
+        break;
+    case BITS_4:
+        refWrite((selector << 6) | (values[0] & 0x0F));
+        refWrite((values[1] << 4) | (values[2] & 0x0F));
+        break;
+    case BITS_6:
+        refWrite((selector << 6) | (values[0] & 0x3F));
+        refWrite((uint8_t)values[1]);
+        refWrite((uint8_t)values[2]);
+        break;
+    case BITS_32:
+        /*
+         * Do another round to compute a selector for each field, assuming that they are at least 8 bits each
+         *
+         * Selector2 field possibilities
+         * 0 - 8 bits
+         * 1 - 16 bits
+         * 2 - 24 bits
+         * 3 - 32 bits
+         */
+        selector2 = 0;
+
+        //Encode in reverse order so the first field is in the low bits:
+        for (int x = NUM_FIELDS - 1; x >= 0; x--) {
+            selector2 <<= 2;
+
+            if (values[x] < 128 && values[x] >= -128) {
+                selector2 |= BYTES_1;
+            } else if (values[x] < 32768 && values[x] >= -32768) {
+                selector2 |= BYTES_2;
+            } else if (values[x] < 8388608 && values[x] >= -8388608) {
+                selector2 |= BYTES_3;
+            } else {
+                selector2 |= BYTES_4;
+            }
+        }
+
+        //Write the selectors
+        refWrite((selector << 6) | selector2);
+
+        //And now the values according to the selectors we picked for them
+        for (int x = 0; x < NUM_FIELDS; x++, selector2 >>= 2) {
+            switch (selector2 & 0x03) {
+            case BYTES_1:
+                refWrite(values[x]);
+                break;
+            case BYTES_2:
+                refWrite(values[x]);
+                refWrite(values[x] >> 8);
+                break;
+            case BYTES_3:
+                refWrite(values[x]);
+                refWrite(values[x] >> 8);
+                refWrite(values[x] >> 16);
+                break;
+            case BYTES_4:
+                refWrite(values[x]);
+                refWrite(values[x] >> 8);
+                refWrite(values[x] >> 16);
+                refWrite(values[x] >> 24);
+                break;
+            }
+        }
+        break;
+    }
+}
+
+/**
+ * Write a 2 bit tag followed by 3 signed fields of 2, 554, 877 or 32 bits
+ */
+static int refWriteTag2_3SVariable(int32_t *values)
+{
+    static const int FIELD_COUNT = 3;
+    enum {
+        BITS_2  = 0,
+        BITS_554  = 1,
+        BITS_877  = 2,
+        BITS_32 = 3
+    };
+
+    enum {
+        BYTES_1  = 0,
+        BYTES_2  = 1,
+        BYTES_3  = 2,
+        BYTES_4  = 3
+    };
+
+
+    /*
+     * Find out how many bits the largest value requires to encode, and use it to choose one of the packing schemes
+     * below:
+     *
+     * Selector possibilities
+     *
+     * 2 bits per field  ss11 2233,
+     * 554 bits per field  ss11 1112 2222 3333
+     * 877 bits per field  ss11 1111 1122 2222 2333 3333
+     * 32 bits per field sstt tttt followed by fields of various byte counts
+     */
+    int selector = BITS_2;
+    int selector2 = 0;
+    // Require more than 877 bits?
+    if (values[0] >= 256 || values[0] < -256
+            || values[1] >= 128 || values[1] < -128
+            || values[2] >= 128 || values[2] < -128) {
+        selector = BITS_32;
+   // Require more than 554 bits?
+    } else if (values[0] >= 16 || values[0] < -16
+            || values[1] >= 16 || values[1] < -16
+            || values[2] >= 8 || values[2] < -8) {
+        selector = BITS_877;
+        // Require more than 2 bits?
+    } else if (values[0] >= 2 || values[0] < -2
+            || values[1] >= 2 || values[1] < -2
+            || values[2] >= 2 || values[2] < -2) {
+        selector = BITS_554;
+    }
+
+    switch (selector) {
+    case BITS_2:
+        refWrite((selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
+        break;
+    case BITS_554:
+        // 554 bits per field  ss11 1112 2222 3333
+        refWrite((selector << 6) | ((values[0] & 0x1F) << 1) | ((values[1] & 0x1F) >> 4));
+        refWrite(((values[1] & 0x0F) << 4) | (values[2] & 0x0F));
+        break;
+    case BITS_877:
+        // 877 bits per field  ss11 1111 1122 2222 2333 3333
+        refWrite((selector << 6) | ((values[0] & 0xFF) >> 2));
+        refWrite(((values[0] & 0x03) << 6) | ((values[1] & 0x7F) >> 1));
+        refWrite(((values[1] & 0x01) << 7) | (values[2] & 0x7F));
+        break;
+    case BITS_32:
+        /*
+         * Do another round to compute a selector for each field, assuming that they are at least 8 bits each
+         *
+         * Selector2 field possibilities
+         * 0 - 8 bits
+         * 1 - 16 bits
+         * 2 - 24 bits
+         * 3 - 32 bits
+         */
+        selector2 = 0;
+        //Encode in reverse order so the first field is in the low bits:
+        for (int x = FIELD_COUNT - 1; x >= 0; x--) {
+            selector2 <<= 2;
+
+            if (values[x] < 128 && values[x] >= -128) {
+                selector2 |= BYTES_1;
+            } else if (values[x] < 32768 && values[x] >= -32768) {
+                selector2 |= BYTES_2;
+            } else if (values[x] < 8388608 && values[x] >= -8388608) {
+                selector2 |= BYTES_3;
+            } else {
+                selector2 |= BYTES_4;
+            }
+        }
+
+        //Write the selectors
+        refWrite((selector << 6) | selector2);
+
+        //And now the values according to the selectors we picked for them
+        for (int x = 0; x < FIELD_COUNT; x++, selector2 >>= 2) {
+            switch (selector2 & 0x03) {
+            case BYTES_1:
+                refWrite(values[x]);
+                break;
+            case BYTES_2:
+                refWrite(values[x]);
+                refWrite(values[x] >> 8);
+                break;
+            case BYTES_3:
+                refWrite(values[x]);
+                refWrite(values[x] >> 8);
+                refWrite(values[x] >> 16);
+                break;
+            case BYTES_4:
+                refWrite(values[x]);
+                refWrite(values[x] >> 8);
+                refWrite(values[x] >> 16);
+                refWrite(values[x] >> 24);
+                break;
+            }
+        }
+    break;
+    }
+    return selector;
+}
+
+/**
+ * Write an 8-bit selector followed by four signed fields of size 0, 4, 8 or 16 bits.
+ */
+static void refWriteTag8_4S16(int32_t *values)
+{
+
+    //Need to be enums rather than const ints if we want to switch on them (due to being C)
+    enum {
+        FIELD_ZERO  = 0,
+        FIELD_4BIT  = 1,
+        FIELD_8BIT  = 2,
+        FIELD_16BIT = 3
+    };
+
+    uint8_t selector = 0;
+    //Encode in reverse order so the first field is in the low bits:
+    for (int x = 3; x >= 0; x--) {
+        selector <<= 2;
+
+        if (values[x] == 0) {
+            selector |= FIELD_ZERO;
+        } else if (values[x] < 8 && values[x] >= -8) {
+            selector |= FIELD_4BIT;
+        } else if (values[x] < 128 && values[x] >= -128) {
+            selector |= FIELD_8BIT;
+        } else {
+            selector |= FIELD_16BIT;
+        }
+    }
+
+    refWrite(selector);
+
+    int nibbleIndex = 0;
+    uint8_t buffer = 0;
+    for (int x = 0; x < 4; x++, selector >>= 2) {
+        switch (selector & 0x03) {
+        case FIELD_ZERO:
+            //No-op
+            break;
+        case FIELD_4BIT:
+            if (nibbleIndex == 0) {
+                //We fill high-bits first
+                buffer = values[x] << 4;
+                nibbleIndex = 1;
+            } else {
+                refWrite(buffer | (values[x] & 0x0F));
+                nibbleIndex = 0;
+            }
+            break;
+        case FIELD_8BIT:
+            if (nibbleIndex == 0) {
+                refWrite(values[x]);
+            } else {
+                //Write the high bits of the value first (mask to avoid sign extension)
+                refWrite(buffer | ((values[x] >> 4) & 0x0F));
+                //Now put the leftover low bits into the top of the next buffer entry
+                buffer = values[x] << 4;
+            }
+            break;
+        case FIELD_16BIT:
+            if (nibbleIndex == 0) {
+                //Write high byte first
+                refWrite(values[x] >> 8);
+                refWrite(values[x]);
+            } else {
+                //First write the highest 4 bits
+                refWrite(buffer | ((values[x] >> 12) & 0x0F));
+                // Then the middle 8
+                refWrite(values[x] >> 4);
+                //Only the smallest 4 bits are still left to write
+                buffer = values[x] << 4;
+            }
+            break;
+        }
+    }
+    //Anything left over to write?
+    if (nibbleIndex == 1) {
+        refWrite(buffer);
+    }
+}
+
+/**
+ * Write `valueCount` fields from `values` to the Blackbox using signed variable byte encoding. A 1-byte header is
+ * written first which specifies which fields are non-zero (so this encoding is compact when most fields are zero).
+ *
+ * valueCount must be 8 or less.
+ */
+static void refWriteTag8_8SVB(int32_t *values, int valueCount)
+{
+    uint8_t header;
+
+    if (valueCount > 0) {
+        //If we're only writing one field then we can skip the header
+        if (valueCount == 1) {
+            refWriteSignedVB(values[0]);
+        } else {
+            //First write a one-byte header that marks which fields are non-zero
+            header = 0;
+
+            // First field should be in low bits of header
+            for (int i = valueCount - 1; i >= 0; i--) {
+                header <<= 1;
+
+                if (values[i] != 0) {
+                    header |= 0x01;
+                }
+            }
+
+            refWrite(header);
+
+            for (int i = 0; i < valueCount; i++) {
+                if (values[i] != 0) {
+                    refWriteSignedVB(values[i]);
+                }
+            }
+        }
+    }
+}
+
+
+static uint32_t testSeed = 1;
+
+// Values spread over every encoded length, small ones being the most common
+static int32_t randomValue(void)
+{
+    testSeed = testSeed * 1664525 + 1013904223;
+    const int bits = (testSeed >> 8) % 33;
+    testSeed = testSeed * 1664525 + 1013904223;
+    const int32_t value = (bits == 32) ? (int32_t)testSeed : (int32_t)(testSeed & ((1u << bits) - 1));
+    return (testSeed & 0x80000000) ? -value : value;
+}
+
+static void randomValues(int32_t *values, int count)
+{
+    for (int i = 0; i < count; i++) {
+        values[i] = randomValue();
+    }
+}
+
+// Encode the same mix of fields as a P-frame, once into a frame buffer and once byte at a time
+static int encodeTestFrame(sbuf_t *dst)
+{
+    int32_t values[8];
+    int16_t values16[4];
+
+    sbufWriteU8(dst, 'P');
+    refWrite('P');
+
+    const uint32_t time = randomValue();
+    blackboxEncodeUnsignedVB(dst, time);
+    refWriteUnsignedVB(time);
+
+    randomValues(values, 3);
+    blackboxEncodeSignedVBArray(dst, values, 3);
+    refWriteSignedVBArray(values, 3);
+
+    randomValues(values, 3);
+    blackboxEncodeTag2_3S32(dst, values);
+    refWriteTag2_3S32(values);
+
+    randomValues(values, 3);
+    const int selector = blackboxEncodeTag2_3SVariable(dst, values);
+    EXPECT_EQ(refWriteTag2_3SVariable(values), selector);
+
+    randomValues(values, 4);
+    blackboxEncodeTag8_4S16(dst, values);
+    refWriteTag8_4S16(values);
+
+    const int count = (testSeed >> 4) % 9;
+    randomValues(values, count);
+    blackboxEncodeTag8_8SVB(dst, values, count);
+    refWriteTag8_8SVB(values, count);
+
+    for (int i = 0; i < 4; i++) {
+        values16[i] = randomValue();
+    }
+    blackboxEncodeSigned16VBArray(dst, values16, 4);
+    refWriteSigned16VBArray(values16, 4);
+
+    blackboxEncodeS16(dst, values16[0]);
+    refWriteS16(values16[0]);
+
+    return selector;
+}
+
+TEST(BlackboxEncodingTest, FrameEncodersMatchByteWriters)
+{
+    uint8_t frame[512];
+
+    for (int loop = 0; loop < 10000; loop++) {
+        sbuf_t dst = { frame, frame + sizeof(frame) };
+        refPos = 0;
+
+        encodeTestFrame(&dst);
+
+        ASSERT_EQ(refPos, dst.ptr - frame) << "loop " << loop;
+        ASSERT_EQ(0, memcmp(refBuffer, frame, refPos)) << "loop " << loop;
+    }
+}
+
+TEST(BlackboxEncodingTest, WritersMatchByteWriters)
+{
+    int32_t values[8];
+
+    for (int loop = 0; loop < 2000; loop++) {
+        serialTestResetBuffers();
+        refPos = 0;
+
+        const int32_t value = randomValue();
+        blackboxWriteUnsignedVB(value);
+        refWriteUnsignedVB(value);
+        blackboxWriteSignedVB(value);
+        refWriteSignedVB(value);
+
+        randomValues(values, 3);
+        blackboxWriteTag2_3S32(values);
+        refWriteTag2_3S32(values);
+        EXPECT_EQ(refWriteTag2_3SVariable(values), blackboxWriteTag2_3SVariable(values));
+
+        randomValues(values, 4);
+        blackboxWriteTag8_4S16(values);
+        refWriteTag8_4S16(values);
+
+        randomValues(values, 8);
+        blackboxWriteTag8_8SVB(values, 8);
+        refWriteTag8_8SVB(values, 8);
+
+        ASSERT_EQ(refPos, serialWritePos) << "loop " << loop;
+        ASSERT_EQ(0, memcmp(refBuffer, serialWriteBuffer, refPos)) << "loop " << loop;
+    }
+}
+
 // STUBS
 extern "C" {
 PG_REGISTER(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 0);
 int32_t blackboxHeaderBudget;
 void mspSerialAllocatePorts(void) {}
 void blackboxWrite(uint8_t value) {serialWrite(blackboxPort, value);}
+void blackboxWriteData(const uint8_t *data, int len)
+{
+    while (len--) {
+        serialWrite(blackboxPort, *data++);
+    }
+}
 int blackboxWriteString(const char *s)
 {
     const uint8_t *pos = (uint8_t*)s;
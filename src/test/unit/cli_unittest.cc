@@ -62,6 +62,7 @@ extern "C" {
         { "wos_unit_test",     VAR_UINT8 | MODE_STRING | MASTER_VALUE, .config.string = { 0, 16, STRING_FLAGS_WRITEONCE }, PG_RESERVED_FOR_TESTING_1, 0 },
     };
     const uint16_t valueTableEntryCount = ARRAYLEN(valueTable);
+    uint16_t valueTableIndex[ARRAYLEN(valueTable)];
     const lookupTableEntry_t lookupTables[] = {};
     const char * const lookupTableOsdDisplayPortDevice[] = {};
 
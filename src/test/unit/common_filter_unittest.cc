@@ -17,6 +17,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdlib.h>
 
 #include <limits.h>
 
@@ -114,3 +115,139 @@ TEST(FilterUnittest, TestSlewFilter)
     slewFilterApply(&filter, 200.0f);
     EXPECT_EQ(200, filter.state);
 }
+
+TEST(FilterUnittest, TestBiquadCascadeEmpty)
+{
+    biquadCascade_t cascade;
+    biquadCascadeInit(&cascade);
+
+    EXPECT_EQ(0, cascade.stageCount);
+    EXPECT_EQ(123.5f, biquadCascadeApply(&cascade, 123.5f));
+    EXPECT_EQ(-7.0f, biquadCascadeApply(&cascade, -7.0f));
+
+    for (int i = 0; i < BIQUAD_CASCADE_MAX_STAGES; i++) {
+        EXPECT_TRUE(biquadCascadeAddPT1(&cascade, 0.5f));
+    }
+    EXPECT_FALSE(biquadCascadeAddPT1(&cascade, 0.5f));
+    EXPECT_FALSE(biquadCascadeAddLPF(&cascade, 100, 250));
+    EXPECT_EQ(BIQUAD_CASCADE_MAX_STAGES, cascade.stageCount);
+}
+
+TEST(FilterUnittest, TestBiquadCascadeMatchesSeparateFilters)
+{
+    biquadCascade_t cascade;
+    biquadFilter_t notch, lowpass;
+    pt1Filter_t pt1;
+
+    const float notchQ = filterGetNotchQ(260, 160);
+    const float k = pt1FilterGain(150, 250 * 1e-6f);
+
+    biquadCascadeInit(&cascade);
+    biquadCascadeAdd(&cascade, 260, 250, notchQ, FILTER_NOTCH);
+    biquadCascadeAddPT1(&cascade, k);
+    biquadCascadeAddLPF(&cascade, 200, 250);
+
+    biquadFilterInit(&notch, 260, 250, notchQ, FILTER_NOTCH);
+    pt1FilterInit(&pt1, k);
+    biquadFilterInitLPF(&lowpass, 200, 250);
+
+    srand(1);
+    for (int n = 0; n < 10000; n++) {
+        const float input = (rand() % 4001 - 2000) / 2.0f;
+
+        float expected = biquadFilterApply(&notch, input);
+        expected = pt1FilterApply(&pt1, expected);
+        expected = biquadFilterApply(&lowpass, expected);
+
+        // The PT1 stage rounds differently from pt1FilterApply()
+        EXPECT_NEAR(expected, biquadCascadeApply(&cascade, input), 1e-3f) << "sample " << n;
+    }
+}
+
+TEST(FilterUnittest, TestBiquadCascadeAccuracy)
+{
+    biquadCascade_t cascade;
+    double b[BIQUAD_CASCADE_MAX_STAGES][3], a[BIQUAD_CASCADE_MAX_STAGES][2];
+    double x[BIQUAD_CASCADE_MAX_STAGES][2] = { { 0 } }, y[BIQUAD_CASCADE_MAX_STAGES][2] = { { 0 } };
+
+    // A low notch and lowpass at 8kHz are the worst case for float rounding
+    biquadCascadeInit(&cascade);
+    biquadCascadeAdd(&cascade, 40, 125, filterGetNotchQ(40, 30), FILTER_NOTCH);
+    biquadCascadeAdd(&cascade, 400, 125, filterGetNotchQ(400, 300), FILTER_NOTCH);
+    biquadCascadeAddLPF(&cascade, 50, 125);
+    biquadCascadeAddPT1(&cascade, pt1FilterGain(100, 125 * 1e-6f));
+
+    for (int i = 0; i < cascade.stageCount; i++) {
+        b[i][0] = cascade.stage[i].b0;
+        b[i][1] = cascade.stage[i].b1;
+        b[i][2] = cascade.stage[i].b2;
+        a[i][0] = cascade.stage[i].a1;
+        a[i][1] = cascade.stage[i].a2;
+    }
+
+    // Same coefficients in double precision direct form 1
+    double maxError = 0, maxOutput = 0;
+    srand(2);
+    for (int n = 0; n < 200000; n++) {
+        const float input = 500 * sinf(n * 0.01f) + (rand() % 2001 - 1000) / 10.0f;
+
+        double value = input;
+        for (int i = 0; i < cascade.stageCount; i++) {
+            const double result = b[i][0] * value + b[i][1] * x[i][0] + b[i][2] * x[i][1] - a[i][0] * y[i][0] - a[i][1] * y[i][1];
+            x[i][1] = x[i][0];
+            x[i][0] = value;
+            y[i][1] = y[i][0];
+            y[i][0] = result;
+            value = result;
+        }
+
+        const float output = biquadCascadeApply(&cascade, input);
+        maxError = fmax(maxError, fabs(output - value));
+        maxOutput = fmax(maxOutput, fabs(value));
+    }
+
+    EXPECT_GT(maxOutput, 100);
+    EXPECT_LT(maxError, 1e-3 * maxOutput);
+}
+
+TEST(FilterUnittest, TestAlphaBetaFilterRamp)
+{
+    alphaBetaFilter_t filter;
+    alphaBetaFilterInit(&filter, 20, 1000);
+
+    EXPECT_FLOAT_EQ(1000, filter.value);
+    EXPECT_FLOAT_EQ(0, filter.rate);
+
+    // 5000 per second, sampled every 1ms
+    for (int n = 1; n <= 1000; n++) {
+        alphaBetaFilterUpdate(&filter, 1000 + 5 * n, 0.001f, 0.001f);
+    }
+
+    EXPECT_NEAR(6000, filter.value, 1);
+    EXPECT_NEAR(5000, filter.rate, 10);
+    EXPECT_NEAR(6050, alphaBetaFilterPredict(&filter, 0.01f), 1);
+}
+
+TEST(FilterUnittest, TestAlphaBetaFilterIrregularSamples)
+{
+    alphaBetaFilter_t filter;
+    alphaBetaFilterInit(&filter, 20, 0);
+
+    // Fast source every 1 to 3ms, slow one every 20ms arriving 10ms late
+    float time = 0, lastSlow = 0;
+    srand(3);
+    for (int n = 0; n < 1000; n++) {
+        const float dT = (1 + rand() % 3) * 0.001f;
+        time += dT;
+        alphaBetaFilterUpdate(&filter, 2000 * time, dT, dT);
+
+        if (time - lastSlow >= 0.03f) {
+            lastSlow = time - 0.01f;
+            alphaBetaFilterUpdate(&filter, 2000 * lastSlow, -0.01f, 0.02f);
+            filter.value += filter.rate * 0.01f;
+        }
+    }
+
+    EXPECT_NEAR(2000 * time, filter.value, 2);
+    EXPECT_NEAR(2000, filter.rate, 10);
+}
@@ -0,0 +1,298 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/utils.h"
+
+    #include "config/config_eeprom.h"
+    #include "config/config_streamer.h"
+
+    #include "drivers/system.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    typedef struct testConfigA_s {
+        uint32_t value[4];
+    } testConfigA_t;
+
+    typedef struct testConfigB_s {
+        uint8_t bytes[100];
+    } testConfigB_t;
+
+    typedef struct testConfigC_s {
+        uint16_t value;
+    } testConfigC_t;
+
+    PG_DECLARE(testConfigA_t, testConfigA);
+    PG_DECLARE(testConfigB_t, testConfigB);
+    PG_DECLARE(testConfigC_t, testConfigC);
+
+    PG_REGISTER(testConfigA_t, testConfigA, PG_RESERVED_FOR_TESTING_1, 0);
+    PG_REGISTER(testConfigB_t, testConfigB, PG_RESERVED_FOR_TESTING_2, 0);
+    PG_REGISTER(testConfigC_t, testConfigC, PG_RESERVED_FOR_TESTING_3, 1);
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// Flash emulation, as on SITL. A power cut stops all writes after a set number.
+static int pagesErased;
+static bool firstPageErased;
+static int wordsWritten;
+static int cutAfterWrites = -1;
+static bool failed;
+
+extern "C" {
+    void FLASH_Unlock(void) { }
+    void FLASH_Lock(void) { }
+
+    static bool powerCut(void)
+    {
+        return cutAfterWrites >= 0 && pagesErased + wordsWritten >= cutAfterWrites;
+    }
+
+    FLASH_Status FLASH_ErasePage(uintptr_t addr)
+    {
+        EXPECT_EQ(0, addr % FLASH_PAGE_SIZE);
+        if (powerCut()) {
+            return FLASH_ERROR_PG;
+        }
+        memset((void *)addr, 0xFF, FLASH_PAGE_SIZE);
+        pagesErased++;
+        firstPageErased |= addr == (uintptr_t)eepromData;
+        return FLASH_COMPLETE;
+    }
+
+    FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t value)
+    {
+        if (powerCut()) {
+            return FLASH_ERROR_PG;
+        }
+        // Only erased words can be programmed
+        EXPECT_EQ(0xFFFFFFFF, *(uint32_t *)addr);
+        *(uint32_t *)addr = value;
+        wordsWritten++;
+        return FLASH_COMPLETE;
+    }
+
+    void failureMode(failureMode_e mode)
+    {
+        EXPECT_EQ(FAILURE_CONFIG_STORE_FAILURE, mode);
+        failed = true;
+    }
+}
+
+static void resetCounters(void)
+{
+    pagesErased = 0;
+    firstPageErased = false;
+    wordsWritten = 0;
+    cutAfterWrites = -1;
+    failed = false;
+}
+
+static void setConfig(uint32_t seed)
+{
+    for (int i = 0; i < 4; i++) {
+        testConfigAMutable()->value[i] = seed * 7 + i;
+    }
+    for (int i = 0; i < 100; i++) {
+        testConfigBMutable()->bytes[i] = seed + i;
+    }
+    testConfigCMutable()->value = seed;
+}
+
+static bool isConfig(uint32_t seed)
+{
+    testConfigA_t a;
+    testConfigB_t b;
+    testConfigC_t c;
+
+    memcpy(&a, testConfigA(), sizeof(a));
+    memcpy(&b, testConfigB(), sizeof(b));
+    memcpy(&c, testConfigC(), sizeof(c));
+
+    setConfig(seed);
+
+    const bool same = memcmp(&a, testConfigA(), sizeof(a)) == 0
+        && memcmp(&b, testConfigB(), sizeof(b)) == 0
+        && memcmp(&c, testConfigC(), sizeof(c)) == 0;
+
+    memcpy(testConfigAMutable(), &a, sizeof(a));
+    memcpy(testConfigBMutable(), &b, sizeof(b));
+    memcpy(testConfigCMutable(), &c, sizeof(c));
+
+    return same;
+}
+
+// As at boot, returns false if the stored config is not valid
+static bool reboot(void)
+{
+    memset(testConfigAMutable(), 0, sizeof(testConfigA_t));
+    memset(testConfigBMutable(), 0, sizeof(testConfigB_t));
+    memset(testConfigCMutable(), 0, sizeof(testConfigC_t));
+
+    return isEEPROMVersionValid() && isEEPROMStructureValid() && loadEEPROM();
+}
+
+// Erased flash, then a first save of config seed
+static void freshSave(uint32_t seed)
+{
+    memset(eepromData, 0xFF, sizeof(eepromData));
+    EXPECT_FALSE(isEEPROMStructureValid());
+
+    setConfig(seed);
+    resetCounters();
+    writeConfigToEEPROM();
+    EXPECT_FALSE(failed);
+}
+
+TEST(ConfigEepromTest, FirstSaveWritesEverything)
+{
+    freshSave(1);
+
+    EXPECT_TRUE(firstPageErased);
+    EXPECT_GT(wordsWritten * 4, (int)(sizeof(testConfigA_t) + sizeof(testConfigB_t) + sizeof(testConfigC_t)));
+
+    EXPECT_TRUE(reboot());
+    EXPECT_TRUE(isConfig(1));
+}
+
+TEST(ConfigEepromTest, SaveAppendsChangedGroups)
+{
+    freshSave(1);
+    const uint16_t savedSize = getEEPROMConfigSize();
+
+    testConfigCMutable()->value = 1000;
+    resetCounters();
+    writeConfigToEEPROM();
+
+    // An entry for C, 8 + 6 + 2 bytes, and a commit, 8 bytes
+    EXPECT_FALSE(failed);
+    EXPECT_EQ(0, pagesErased);
+    EXPECT_EQ(6, wordsWritten);
+    EXPECT_EQ(savedSize + 24, getEEPROMConfigSize());
+
+    EXPECT_TRUE(reboot());
+    EXPECT_EQ(1000, testConfigC()->value);
+    EXPECT_EQ(1u * 7, testConfigA()->value[0]);
+    EXPECT_EQ(1 + 99, testConfigB()->bytes[99]);
+}
+
+TEST(ConfigEepromTest, UnchangedSaveWritesNothing)
+{
+    freshSave(2);
+
+    resetCounters();
+    writeConfigToEEPROM();
+
+    EXPECT_FALSE(failed);
+    EXPECT_EQ(0, pagesErased);
+    EXPECT_EQ(0, wordsWritten);
+}
+
+TEST(ConfigEepromTest, RewritesWhenFull)
+{
+    freshSave(1);
+
+    int rewrites = 0;
+    for (uint32_t seed = 2; seed < 200; seed++) {
+        setConfig(seed);
+        resetCounters();
+        writeConfigToEEPROM();
+        EXPECT_FALSE(failed);
+
+        // Appends erase the pages they move into, a rewrite starts from the first
+        if (firstPageErased) {
+            rewrites++;
+        }
+
+        // Entries left from before the rewrite are not taken
+        EXPECT_TRUE(reboot());
+        EXPECT_TRUE(isConfig(seed));
+    }
+
+    // Each save appends entries of 32, 116 and 16 bytes, and a commit of 8
+    EXPECT_GE(rewrites, 198 * 172 / EEPROM_SIZE);
+    EXPECT_LE(rewrites, 198 * 172 / (EEPROM_SIZE - 200) + 1);
+}
+
+TEST(ConfigEepromTest, PowerCutDuringAppend)
+{
+    static uint8_t before[EEPROM_SIZE];
+
+    freshSave(1);
+    setConfig(2);
+    writeConfigToEEPROM();
+    memcpy(before, eepromData, sizeof(before));
+
+    // Find how many writes a whole save takes
+    setConfig(3);
+    resetCounters();
+    writeConfigToEEPROM();
+    const int writes = pagesErased + wordsWritten;
+    EXPECT_EQ(0, pagesErased);
+
+    for (int cut = 0; cut <= writes; cut++) {
+        memcpy(eepromData, before, sizeof(eepromData));
+        EXPECT_TRUE(reboot());
+
+        setConfig(3);
+        resetCounters();
+        cutAfterWrites = cut;
+        writeConfigToEEPROM();
+        EXPECT_EQ(cut < writes, failed);
+
+        // All of the save, or none of it
+        EXPECT_TRUE(reboot());
+        EXPECT_TRUE(isConfig(cut < writes ? 2 : 3)) << "cut after " << cut;
+
+        // The next save takes, compacting first if torn entries are in the way
+        setConfig(4);
+        resetCounters();
+        writeConfigToEEPROM();
+        EXPECT_FALSE(failed);
+        EXPECT_TRUE(reboot());
+        EXPECT_TRUE(isConfig(4));
+    }
+}
+
+TEST(ConfigEepromTest, TornJournalIsRewritten)
+{
+    freshSave(1);
+
+    // Anything but erased flash after the last commit is left from a save that did not finish
+    const uint16_t savedSize = getEEPROMConfigSize();
+    memset(eepromData + savedSize, 0, 8);
+    EXPECT_TRUE(reboot());
+    EXPECT_TRUE(isConfig(1));
+
+    testConfigCMutable()->value = 5;
+    resetCounters();
+    writeConfigToEEPROM();
+    EXPECT_FALSE(failed);
+    EXPECT_TRUE(firstPageErased);
+
+    EXPECT_TRUE(reboot());
+    EXPECT_EQ(5, testConfigC()->value);
+}
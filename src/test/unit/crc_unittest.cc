@@ -0,0 +1,166 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/crc.h"
+    #include "common/streambuf.h"
+    #include "common/utils.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// The bitwise implementations the tables replace
+
+static uint16_t referenceCrc16Ccitt(uint16_t crc, uint8_t a)
+{
+    crc ^= (uint16_t)a << 8;
+    for (int ii = 0; ii < 8; ++ii) {
+        if (crc & 0x8000) {
+            crc = (crc << 1) ^ 0x1021;
+        } else {
+            crc = crc << 1;
+        }
+    }
+    return crc;
+}
+
+static uint8_t referenceCrc8DvbS2(uint8_t crc, uint8_t a)
+{
+    crc ^= a;
+    for (int ii = 0; ii < 8; ++ii) {
+        if (crc & 0x80) {
+            crc = (crc << 1) ^ 0xD5;
+        } else {
+            crc = crc << 1;
+        }
+    }
+    return crc;
+}
+
+// As esc_sensor.c had it
+static uint8_t referenceEscCrc8(uint8_t crc, uint8_t crc_seed)
+{
+    uint8_t crc_u = crc;
+    crc_u ^= crc_seed;
+
+    for (int i = 0; i < 8; i++) {
+        crc_u = (crc_u & 0x80) ? 0x7 ^ (crc_u << 1) : (crc_u << 1);
+    }
+
+    return crc_u;
+}
+
+static uint32_t testRandom(uint32_t *seed)
+{
+    *seed = *seed * 1664525 + 1013904223;
+    return *seed >> 8;
+}
+
+static const uint8_t checkString[] = "123456789";
+
+TEST(CrcTest, CheckValues)
+{
+    // From the CRC catalogue
+    EXPECT_EQ(0x31C3, crc16_ccitt_update(0, checkString, 9));
+    EXPECT_EQ(0x29B1, crc16_ccitt_update(0xFFFF, checkString, 9));
+    EXPECT_EQ(0xBC, crc8_dvb_s2_update(0, checkString, 9));
+    EXPECT_EQ(0xF4, crc8_smbus_update(0, checkString, 9));
+    EXPECT_EQ(0x31, crc8_xor_update(0, checkString, 9));
+}
+
+TEST(CrcTest, MatchesBitwise)
+{
+    uint32_t seed = 1;
+    uint8_t data[300];
+
+    for (int pass = 0; pass < 200; pass++) {
+        const uint32_t length = testRandom(&seed) % sizeof(data);
+        for (uint32_t i = 0; i < length; i++) {
+            data[i] = testRandom(&seed);
+        }
+        const uint16_t start16 = testRandom(&seed);
+        const uint8_t start8 = testRandom(&seed);
+
+        uint16_t crc16 = start16;
+        uint8_t dvbS2 = start8;
+        uint8_t esc = start8;
+        for (uint32_t i = 0; i < length; i++) {
+            crc16 = referenceCrc16Ccitt(crc16, data[i]);
+            dvbS2 = referenceCrc8DvbS2(dvbS2, data[i]);
+            esc = referenceEscCrc8(data[i], esc);
+        }
+
+        EXPECT_EQ(crc16, crc16_ccitt_update(start16, data, length));
+        EXPECT_EQ(dvbS2, crc8_dvb_s2_update(start8, data, length));
+        EXPECT_EQ(esc, crc8_smbus_update(start8, data, length));
+
+        // A byte at a time, as the MSP and SUMD parsers do
+        uint16_t byteCrc16 = start16;
+        uint8_t byteDvbS2 = start8;
+        uint8_t byteEsc = start8;
+        for (uint32_t i = 0; i < length; i++) {
+            byteCrc16 = crc16_ccitt(byteCrc16, data[i]);
+            byteDvbS2 = crc8_dvb_s2(byteDvbS2, data[i]);
+            byteEsc = crc8_smbus(byteEsc, data[i]);
+        }
+
+        EXPECT_EQ(crc16, byteCrc16);
+        EXPECT_EQ(dvbS2, byteDvbS2);
+        EXPECT_EQ(esc, byteEsc);
+    }
+}
+
+TEST(CrcTest, EveryByteValue)
+{
+    for (int crc = 0; crc < 256; crc++) {
+        for (int a = 0; a < 256; a++) {
+            EXPECT_EQ(referenceCrc8DvbS2(crc, a), crc8_dvb_s2(crc, a));
+            EXPECT_EQ(referenceEscCrc8(a, crc), crc8_smbus(crc, a));
+            EXPECT_EQ(referenceCrc16Ccitt(crc << 8 | a, a), crc16_ccitt(crc << 8 | a, a));
+        }
+    }
+}
+
+TEST(CrcTest, SbufAppend)
+{
+    uint8_t buffer[32];
+    sbuf_t sbuf;
+
+    sbuf.ptr = buffer;
+    sbuf.end = ARRAYEND(buffer);
+    sbufWriteData(&sbuf, checkString, 9);
+    crc8_dvb_s2_sbuf_append(&sbuf, buffer);
+    EXPECT_EQ(buffer + 10, sbuf.ptr);
+    EXPECT_EQ(0xBC, buffer[9]);
+
+    sbuf.ptr = buffer;
+    sbufWriteData(&sbuf, checkString, 9);
+    crc16_ccitt_sbuf_append(&sbuf, buffer);
+    EXPECT_EQ(buffer + 11, sbuf.ptr);
+    EXPECT_EQ(0x31C3, buffer[9] | buffer[10] << 8);
+
+    sbuf.ptr = buffer;
+    sbufWriteData(&sbuf, checkString, 9);
+    crc8_xor_sbuf_append(&sbuf, buffer + 1);
+    EXPECT_EQ(0x31 ^ '1', buffer[9]);
+}
@@ -0,0 +1,243 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Synthesised bidirectional DShot telemetry, shared by dshot_gcr_unittest
+ * and dshot_gcr_benchmark.
+ *
+ * A frame is the 16 bit value eeem mmmm mmmm cccc, GCR coded into 20 bits
+ * and sent after a start bit as 21 NRZI bits, a 1 being a level change.
+ * The line idles high. The bitbang input samples it three times per bit,
+ * the timer input captures the time of each edge at 16 ticks per bit.
+ *
+ * The ESC clock is off by up to driftPercent, every edge is moved by up
+ * to jitter samples and each sample is flipped with glitchProbability.
+ */
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#define GCR_CORPUS_SAMPLES      140     // DSHOT_BITBANG_PORT_INPUT_BUFFER_LENGTH
+#define GCR_CORPUS_FRAME_BITS   21
+#define GCR_CORPUS_TIMER_TICKS  16
+
+typedef enum {
+    GCR_CORPUS_CLEAN = 0,
+    GCR_CORPUS_STOPPED,
+    GCR_CORPUS_BAD_CHECKSUM,
+    GCR_CORPUS_TRUNCATED,
+    GCR_CORPUS_NO_REPLY,
+    GCR_CORPUS_GARBAGE,
+    GCR_CORPUS_KIND_COUNT
+} gcrCorpusKind_e;
+
+typedef struct {
+    float driftPercent;
+    float jitter;
+    float glitchProbability;
+} gcrCorpusNoise_t;
+
+typedef struct {
+    gcrCorpusKind_e kind;
+    uint32_t period;            // decoded period of CLEAN and STOPPED frames
+    uint32_t frame;             // NRZI bits, start bit included
+    uint8_t level[GCR_CORPUS_SAMPLES];
+} gcrCorpusCase_t;
+
+static const uint8_t gcrCorpusCode[16] = {
+    0x19, 0x1b, 0x12, 0x13, 0x1d, 0x15, 0x16, 0x17,
+    0x1a, 0x09, 0x0a, 0x0b, 0x1e, 0x0d, 0x0e, 0x0f,
+};
+
+// xorshift32, so that a seed gives the same corpus everywhere
+static inline uint32_t gcrCorpusRandom(uint32_t *seed)
+{
+    uint32_t x = *seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *seed = x;
+    return x;
+}
+
+static inline float gcrCorpusUniform(uint32_t *seed, float min, float max)
+{
+    return min + (max - min) * (gcrCorpusRandom(seed) >> 8) / (float)(1 << 24);
+}
+
+// Period in us to eeem mmmm mmmm
+static inline uint32_t gcrCorpusEncodePeriod(uint32_t period)
+{
+    uint32_t exponent = 0;
+    while (period > 0x1ff) {
+        period >>= 1;
+        exponent++;
+    }
+    return (exponent << 9) | period;
+}
+
+static inline uint32_t gcrCorpusValuePeriod(uint32_t value)
+{
+    return (value & 0x1ff) << (value >> 9);
+}
+
+// 12 bit value to NRZI frame bits
+static inline uint32_t gcrCorpusFrame(uint32_t value, bool badChecksum)
+{
+    uint32_t csum = (value ^ (value >> 4) ^ (value >> 8)) & 0xf;
+    csum = ~csum & 0xf;
+    if (badChecksum) {
+        csum ^= 1 << (value % 4);
+    }
+
+    const uint32_t packet = (value << 4) | csum;
+
+    uint32_t gcr = 0;
+    for (int nibble = 3; nibble >= 0; nibble--) {
+        gcr = (gcr << 5) | gcrCorpusCode[(packet >> (nibble * 4)) & 0xf];
+    }
+
+    return (1 << 20) | gcr;
+}
+
+/*
+ * Samples a frame starting at sample start. The line is released after
+ * bitCount bits.
+ */
+static inline void gcrCorpusSampleFrame(uint8_t *level, uint32_t frame, int bitCount, float start, const gcrCorpusNoise_t *noise, uint32_t *seed)
+{
+    const float samplesPerBit = 3.0f * (1.0f + gcrCorpusUniform(seed, -noise->driftPercent, noise->driftPercent) / 100.0f);
+
+    float edges[GCR_CORPUS_FRAME_BITS + 1];
+    int edgeCount = 0;
+
+    for (int bit = 0; bit < bitCount; bit++) {
+        if (frame & (1 << (GCR_CORPUS_FRAME_BITS - 1 - bit))) {
+            edges[edgeCount++] = start + bit * samplesPerBit + gcrCorpusUniform(seed, -noise->jitter, noise->jitter);
+        }
+    }
+
+    // Back to idle when the line is released
+    if (edgeCount % 2) {
+        edges[edgeCount++] = start + bitCount * samplesPerBit + gcrCorpusUniform(seed, -noise->jitter, noise->jitter);
+    }
+
+    int edge = 0;
+    for (int i = 0; i < GCR_CORPUS_SAMPLES; i++) {
+        while (edge < edgeCount && edges[edge] <= i) {
+            edge++;
+        }
+        level[i] = !(edge % 2);
+    }
+}
+
+static inline void gcrCorpusAddGlitches(uint8_t *level, const gcrCorpusNoise_t *noise, uint32_t *seed)
+{
+    for (int i = 0; i < GCR_CORPUS_SAMPLES; i++) {
+        if (gcrCorpusUniform(seed, 0, 1) < noise->glitchProbability) {
+            level[i] ^= 1;
+        }
+    }
+}
+
+static inline void gcrCorpusMake(gcrCorpusCase_t *test, gcrCorpusKind_e kind, const gcrCorpusNoise_t *noise, uint32_t *seed)
+{
+    memset(test, 0, sizeof(*test));
+    test->kind = kind;
+
+    // The reply starts 30us after the command, with some slack in the capture
+    const float start = gcrCorpusUniform(seed, 4, 40);
+
+    // Periods of 10us to 2.5ms, roughly log distributed
+    const uint32_t period = 10 << (gcrCorpusRandom(seed) % 8);
+    const uint32_t value = gcrCorpusEncodePeriod(period + gcrCorpusRandom(seed) % period);
+
+    switch (kind) {
+    case GCR_CORPUS_CLEAN:
+    case GCR_CORPUS_BAD_CHECKSUM:
+        test->period = gcrCorpusValuePeriod(value);
+        test->frame = gcrCorpusFrame(value, kind == GCR_CORPUS_BAD_CHECKSUM);
+        gcrCorpusSampleFrame(test->level, test->frame, GCR_CORPUS_FRAME_BITS, start, noise, seed);
+        break;
+
+    case GCR_CORPUS_STOPPED:
+        test->period = 0;
+        test->frame = gcrCorpusFrame(0x0fff, false);
+        gcrCorpusSampleFrame(test->level, test->frame, GCR_CORPUS_FRAME_BITS, start, noise, seed);
+        break;
+
+    case GCR_CORPUS_TRUNCATED:
+        test->frame = gcrCorpusFrame(value, false);
+        gcrCorpusSampleFrame(test->level, test->frame, 6 + gcrCorpusRandom(seed) % 10, start, noise, seed);
+        break;
+
+    case GCR_CORPUS_NO_REPLY:
+        memset(test->level, 1, sizeof(test->level));
+        break;
+
+    case GCR_CORPUS_GARBAGE:
+        {
+            // Runs of 1 to 12 samples from the start on
+            int i = 0;
+            uint8_t garbage = 1;
+            while (i < GCR_CORPUS_SAMPLES) {
+                const int run = (i < start) ? (int)start : 1 + gcrCorpusRandom(seed) % 12;
+                for (int n = 0; n < run && i < GCR_CORPUS_SAMPLES; n++) {
+                    test->level[i++] = garbage;
+                }
+                garbage ^= 1;
+            }
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    gcrCorpusAddGlitches(test->level, noise, seed);
+}
+
+// Puts a pin capture into a port capture
+static inline void gcrCorpusSetPin(uint16_t *samples, int pin, const uint8_t *level)
+{
+    for (int i = 0; i < GCR_CORPUS_SAMPLES; i++) {
+        samples[i] = (samples[i] & ~(1 << pin)) | (level[i] << pin);
+    }
+}
+
+/*
+ * Timer capture of a frame, the time of each edge in 16 ticks per bit.
+ * Returns the edge count.
+ */
+static inline int gcrCorpusEdges(uint32_t *edges, uint32_t frame, const gcrCorpusNoise_t *noise, uint32_t *seed)
+{
+    const float ticksPerBit = GCR_CORPUS_TIMER_TICKS * (1.0f + gcrCorpusUniform(seed, -noise->driftPercent, noise->driftPercent) / 100.0f);
+    const uint32_t start = gcrCorpusRandom(seed);
+    int count = 0;
+
+    for (int bit = 0; bit < GCR_CORPUS_FRAME_BITS; bit++) {
+        if (frame & (1 << (GCR_CORPUS_FRAME_BITS - 1 - bit))) {
+            const float jitter = gcrCorpusUniform(seed, -noise->jitter, noise->jitter) * GCR_CORPUS_TIMER_TICKS / 3;
+            edges[count++] = start + (int32_t)floorf(bit * ticksPerBit + jitter + 0.5f);
+        }
+    }
+
+    return count;
+}
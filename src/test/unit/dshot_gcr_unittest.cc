@@ -0,0 +1,219 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "drivers/dshot_gcr.h"
+}
+
+#include "dshot_gcr_corpus.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static const gcrCorpusNoise_t noNoise = { 0, 0, 0 };
+
+// ESC clock error and edge jitter the decoder has to take
+static const gcrCorpusNoise_t jitterNoise = { 3, 0.4f, 0 };
+
+static uint32_t decodePin(const gcrCorpusCase_t *test)
+{
+    uint16_t samples[GCR_CORPUS_SAMPLES];
+    uint16_t periods[DSHOT_GCR_PORT_PINS];
+
+    memset(samples, 0xff, sizeof(samples));
+    gcrCorpusSetPin(samples, 3, test->level);
+
+    dshotGcrDecodePort(samples, GCR_CORPUS_SAMPLES, 1 << 3, periods);
+
+    return periods[3];
+}
+
+TEST(DshotGcrUnittest, DecodeValue)
+{
+    for (uint32_t value = 0; value < 0x1000; value++) {
+        const uint32_t frame = gcrCorpusFrame(value, false);
+
+        if (value == 0x0fff) {
+            EXPECT_EQ(0, dshotGcrDecodeValue(frame));
+        } else if ((value & 0x1ff) == 0) {
+            EXPECT_EQ(DSHOT_GCR_INVALID, dshotGcrDecodeValue(frame));
+        } else {
+            EXPECT_EQ(gcrCorpusValuePeriod(value), dshotGcrDecodeValue(frame)) << "value " << value;
+        }
+
+        // Any one bit error is caught
+        for (int bit = 0; bit < 20; bit++) {
+            EXPECT_EQ(DSHOT_GCR_INVALID, dshotGcrDecodeValue(frame ^ (1 << bit))) << "value " << value << " bit " << bit;
+        }
+
+        EXPECT_EQ(DSHOT_GCR_INVALID, dshotGcrDecodeValue(gcrCorpusFrame(value, true)));
+    }
+}
+
+TEST(DshotGcrUnittest, PeriodToErpm)
+{
+    EXPECT_EQ(0, dshotGcrPeriodToErpm(0));
+    EXPECT_EQ(6000, dshotGcrPeriodToErpm(100));
+    EXPECT_EQ(200, dshotGcrPeriodToErpm(3000));
+    EXPECT_EQ(9, dshotGcrPeriodToErpm(65408));
+    EXPECT_EQ(0, dshotGcrPeriodToErpm(DSHOT_GCR_NOEDGE));
+    EXPECT_EQ(0, dshotGcrPeriodToErpm(DSHOT_GCR_INVALID));
+}
+
+TEST(DshotGcrUnittest, NoReply)
+{
+    gcrCorpusCase_t test;
+    uint32_t seed = 1;
+
+    gcrCorpusMake(&test, GCR_CORPUS_NO_REPLY, &noNoise, &seed);
+    EXPECT_EQ(DSHOT_GCR_NOEDGE, decodePin(&test));
+
+    // Too short for a frame
+    uint16_t samples[GCR_CORPUS_SAMPLES];
+    uint16_t periods[DSHOT_GCR_PORT_PINS];
+    memset(samples, 0, sizeof(samples));
+    dshotGcrDecodePort(samples, 50, 0x0001, periods);
+    EXPECT_EQ(DSHOT_GCR_NOEDGE, periods[0]);
+    dshotGcrDecodePort(samples, 0, 0x0001, periods);
+    EXPECT_EQ(DSHOT_GCR_NOEDGE, periods[0]);
+}
+
+TEST(DshotGcrUnittest, CleanCorpus)
+{
+    uint32_t seed = 0x12345678;
+
+    for (int n = 0; n < 5000; n++) {
+        gcrCorpusCase_t test;
+        gcrCorpusMake(&test, (n % 10) ? GCR_CORPUS_CLEAN : GCR_CORPUS_STOPPED, &jitterNoise, &seed);
+
+        ASSERT_EQ(test.period, decodePin(&test)) << "case " << n;
+    }
+}
+
+TEST(DshotGcrUnittest, InvalidCorpus)
+{
+    uint32_t seed = 0x2468ace0;
+
+    for (int n = 0; n < 5000; n++) {
+        gcrCorpusCase_t test;
+
+        gcrCorpusMake(&test, GCR_CORPUS_BAD_CHECKSUM, &jitterNoise, &seed);
+        EXPECT_EQ(DSHOT_GCR_INVALID, decodePin(&test)) << "case " << n;
+
+        // Too few bits to be taken as a frame
+        gcrCorpusMake(&test, GCR_CORPUS_TRUNCATED, &jitterNoise, &seed);
+        EXPECT_EQ(DSHOT_GCR_NOEDGE, decodePin(&test)) << "case " << n;
+    }
+}
+
+TEST(DshotGcrUnittest, NoisyCorpus)
+{
+    static const gcrCorpusNoise_t noise = { 3, 0.4f, 0.01f };
+    uint32_t seed = 0x0badcafe;
+
+    int correct = 0, wrong = 0, garbageAccepted = 0;
+    const int count = 20000;
+
+    for (int n = 0; n < count; n++) {
+        gcrCorpusCase_t test;
+
+        gcrCorpusMake(&test, GCR_CORPUS_CLEAN, &noise, &seed);
+        const uint32_t period = decodePin(&test);
+        if (period == test.period) {
+            correct++;
+        } else if (period != DSHOT_GCR_INVALID && period != DSHOT_GCR_NOEDGE) {
+            wrong++;
+        }
+
+        gcrCorpusMake(&test, GCR_CORPUS_GARBAGE, &noise, &seed);
+        const uint32_t garbage = decodePin(&test);
+        if (garbage != DSHOT_GCR_INVALID && garbage != DSHOT_GCR_NOEDGE) {
+            garbageAccepted++;
+        }
+    }
+
+    printf("1%% glitches: %.1f%% decoded, %.2f%% wrong, %.2f%% of garbage accepted\n",
+        100.0 * correct / count, 100.0 * wrong / count, 100.0 * garbageAccepted / count);
+
+    // Any glitch up to the end of the frame breaks it, 0.99^80 or so
+    EXPECT_GT(correct, count * 45 / 100);
+    EXPECT_LT(wrong, count / 100);
+    EXPECT_LT(garbageAccepted, count / 100);
+}
+
+TEST(DshotGcrUnittest, PortMatchesSinglePins)
+{
+    static const int pins[] = { 0, 1, 5, 11, 15 };
+    static const gcrCorpusKind_e kinds[] = {
+        GCR_CORPUS_CLEAN, GCR_CORPUS_CLEAN, GCR_CORPUS_STOPPED, GCR_CORPUS_BAD_CHECKSUM,
+        GCR_CORPUS_TRUNCATED, GCR_CORPUS_NO_REPLY, GCR_CORPUS_GARBAGE,
+    };
+    static const gcrCorpusNoise_t noise = { 3, 0.4f, 0.002f };
+    uint32_t seed = 0xfeedbeef;
+
+    for (int n = 0; n < 2000; n++) {
+        uint16_t samples[GCR_CORPUS_SAMPLES];
+        uint16_t periods[DSHOT_GCR_PORT_PINS];
+        uint16_t pinMask = 0;
+
+        // Pins that are not decoded toggle at random
+        for (int i = 0; i < GCR_CORPUS_SAMPLES; i++) {
+            samples[i] = gcrCorpusRandom(&seed);
+        }
+
+        for (unsigned i = 0; i < sizeof(pins) / sizeof(pins[0]); i++) {
+            gcrCorpusCase_t test;
+            gcrCorpusMake(&test, kinds[gcrCorpusRandom(&seed) % (sizeof(kinds) / sizeof(kinds[0]))], &noise, &seed);
+            gcrCorpusSetPin(samples, pins[i], test.level);
+            pinMask |= 1 << pins[i];
+        }
+
+        dshotGcrDecodePort(samples, GCR_CORPUS_SAMPLES, pinMask, periods);
+
+        for (unsigned i = 0; i < sizeof(pins) / sizeof(pins[0]); i++) {
+            uint16_t single[DSHOT_GCR_PORT_PINS];
+            dshotGcrDecodePort(samples, GCR_CORPUS_SAMPLES, 1 << pins[i], single);
+            EXPECT_EQ(single[pins[i]], periods[pins[i]]) << "case " << n << " pin " << pins[i];
+        }
+    }
+}
+
+TEST(DshotGcrUnittest, TimerEdges)
+{
+    uint32_t seed = 0x13572468;
+
+    for (int n = 0; n < 5000; n++) {
+        uint32_t edges[GCR_CORPUS_FRAME_BITS];
+        const uint32_t value = gcrCorpusEncodePeriod(10 + gcrCorpusRandom(&seed) % 5000);
+
+        int count = gcrCorpusEdges(edges, gcrCorpusFrame(value, false), &jitterNoise, &seed);
+        ASSERT_EQ(gcrCorpusValuePeriod(value), dshotGcrDecodeEdges(edges, count)) << "case " << n;
+
+        count = gcrCorpusEdges(edges, gcrCorpusFrame(value, true), &jitterNoise, &seed);
+        ASSERT_EQ(DSHOT_GCR_INVALID, dshotGcrDecodeEdges(edges, count)) << "case " << n;
+    }
+
+    // Runs longer than the frame
+    const uint32_t edges[] = { 0, 16, 200, 216 };
+    EXPECT_EQ(DSHOT_GCR_INVALID, dshotGcrDecodeEdges(edges, 4));
+}
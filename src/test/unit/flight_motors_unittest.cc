@@ -0,0 +1,223 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/time.h"
+
+    #include "pg/pg.h"
+    #include "pg/motor.h"
+
+    #include "drivers/motor.h"
+
+    #include "flight/motors.h"
+
+    #include "sensors/gyro.h"
+
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+
+    uint8_t armingFlags;
+    uint8_t mixerActiveMotors;
+
+    gyro_t gyro;
+
+    static timeUs_t testTimeUs;
+
+    // Newest sample of each source, as the drivers hold them
+    static uint16_t testDshotERPM;
+    static timeUs_t testDshotTimeUs;
+    static uint16_t testEscERPM;
+    static timeUs_t testEscTimeUs;
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// Default six poles, eRPM/100 to RPM
+#define RPM_TO_ERPM(rpm)    ((uint16_t)lrintf((rpm) * 3 / 100.0f))
+
+static void initEstimator(void)
+{
+    pgResetAll();
+    motorConfigMutable()->dev.useDshotTelemetry = true;
+
+    gyro.targetLooptime = 125;
+    mixerActiveMotors = 1;
+    armingFlags = 0;
+
+    testTimeUs = 1000000;
+    testDshotERPM = testEscERPM = 0;
+    testDshotTimeUs = testEscTimeUs = 0;
+
+    motorInit();
+    rpmSourceInit();
+}
+
+// One loop of 1ms, the DShot frame arrives unless dropped
+static void runLoop(float rpm, bool dshotFrame)
+{
+    testTimeUs += 1000;
+
+    if (dshotFrame) {
+        testDshotERPM = RPM_TO_ERPM(rpm);
+        testDshotTimeUs = testTimeUs - 200;
+    }
+
+    motorUpdate();
+}
+
+TEST(FlightMotorsUnittest, TwoSourcesWithDroppedFrames)
+{
+    initEstimator();
+
+    for (int i = 0; i < 500; i++) {
+        // Every fourth DShot frame is lost
+        runLoop(3000, (i % 4) != 3);
+
+        // The ESC sensor reports every 50ms
+        if (i % 50 == 0) {
+            testEscERPM = RPM_TO_ERPM(3000);
+            testEscTimeUs = testTimeUs - 5000;
+        }
+    }
+
+    EXPECT_NEAR(3000, getMotorRPM(0), 5);
+    EXPECT_NEAR(3000, getMotorRPMAt(0, testTimeUs), 5);
+    EXPECT_NEAR(0, getMotorRPMRate(0), 100);
+
+    // Age of the newest sample of any source
+    runLoop(3000, true);
+    EXPECT_EQ(200, getMotorRPMAge(0, testTimeUs));
+    runLoop(3000, false);
+    EXPECT_EQ(1200, getMotorRPMAge(0, testTimeUs));
+}
+
+TEST(FlightMotorsUnittest, StaleTimestampIgnored)
+{
+    initEstimator();
+
+    testEscERPM = RPM_TO_ERPM(3000);
+    testEscTimeUs = testTimeUs;
+
+    for (int i = 0; i < 200; i++) {
+        runLoop(3000, true);
+    }
+    EXPECT_NEAR(3000, getMotorRPM(0), 5);
+
+    // A changed value under an old timestamp is not a new sample
+    testEscERPM = RPM_TO_ERPM(1000);
+
+    for (int i = 0; i < 50; i++) {
+        runLoop(3000, true);
+    }
+    EXPECT_NEAR(3000, getMotorRPM(0), 5);
+
+    // Neither is a repeated DShot timestamp
+    testDshotERPM = RPM_TO_ERPM(1000);
+    testTimeUs += 1000;
+    motorUpdate();
+    EXPECT_NEAR(3000, getMotorRPM(0), 5);
+}
+
+TEST(FlightMotorsUnittest, TimeoutInvalidates)
+{
+    initEstimator();
+
+    for (int i = 0; i < 200; i++) {
+        runLoop(3000, true);
+    }
+    const timeUs_t lastSampleUs = testDshotTimeUs;
+
+    // Held over a gap shorter than the timeout
+    while (cmpTimeUs(testTimeUs + 1000, lastSampleUs) <= MOTOR_RPM_TIMEOUT_US) {
+        runLoop(3000, false);
+    }
+    EXPECT_NEAR(3000, getMotorRPM(0), 5);
+    EXPECT_LE(getMotorRPMAge(0, testTimeUs), MOTOR_RPM_TIMEOUT_US);
+
+    runLoop(3000, false);
+    EXPECT_EQ(0, getMotorRPM(0));
+    EXPECT_EQ(0, getMotorRPMAt(0, testTimeUs));
+    EXPECT_EQ(INT32_MAX, getMotorRPMAge(0, testTimeUs));
+    EXPECT_EQ(0, getMotorRPMRate(0));
+
+    // Restarts from the next sample, without the old rate
+    runLoop(1500, true);
+    EXPECT_NEAR(1500, getMotorRPMAt(0, testTimeUs), 35);
+    EXPECT_EQ(200, getMotorRPMAge(0, testTimeUs));
+}
+
+TEST(FlightMotorsUnittest, PredictionClampedAtZero)
+{
+    initEstimator();
+
+    for (int i = 0; i < 200; i++) {
+        runLoop(3000, true);
+    }
+
+    // Spool down at 50000 RPM/s, then the samples stop
+    float rpm = 3000;
+    for (int i = 0; i < 54; i++) {
+        rpm -= 50;
+        runLoop(rpm, true);
+    }
+    const timeUs_t lastSampleUs = testDshotTimeUs;
+
+    EXPECT_NEAR(-50000, getMotorRPMRate(0), 2500);
+    EXPECT_GT(getMotorRPMAt(0, lastSampleUs), 0);
+    EXPECT_LT(getMotorRPMAt(0, lastSampleUs + 10000), getMotorRPMAt(0, lastSampleUs));
+
+    // Extrapolating the rate past zero gives zero, not a negative RPM
+    EXPECT_EQ(0, getMotorRPMAt(0, lastSampleUs + MOTOR_RPM_PREDICT_MAX_US));
+
+    // and the prediction stops at its horizon
+    EXPECT_EQ(getMotorRPMAt(0, lastSampleUs + MOTOR_RPM_PREDICT_MAX_US),
+              getMotorRPMAt(0, lastSampleUs + 2 * MOTOR_RPM_PREDICT_MAX_US));
+}
+
+
+// STUBS
+
+extern "C" {
+
+timeUs_t micros(void) { return testTimeUs; }
+void delay(timeMs_t) {}
+
+bool featureIsEnabled(uint32_t) { return true; }
+
+void checkMotorProtocol(const motorDevConfig_t *) {}
+bool isMotorProtocolDshot(void) { return true; }
+void motorDevInit(const motorDevConfig_t *, uint16_t, uint8_t) {}
+void motorWriteAll(float *) {}
+float mixerGetMotorOutput(uint8_t) { return 0; }
+
+uint16_t getDshotTelemetry(uint8_t) { return testDshotERPM; }
+timeUs_t getDshotTelemetryTimeUs(uint8_t) { return testDshotTimeUs; }
+
+bool isEscSensorActive(void) { return true; }
+uint16_t getEscSensorRPM(uint8_t) { return testEscERPM; }
+timeUs_t getEscSensorRPMTimeUs(uint8_t) { return testEscTimeUs; }
+
+}
@@ -0,0 +1,459 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/time.h"
+    #include "common/utils.h"
+
+    #include "drivers/serial.h"
+
+    #include "fc/runtime_config.h"
+
+    #include "io/gps.h"
+    #include "io/serial.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    #include "sensors/sensors.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// An RMC sentence left from before the receiver was configured, three NAV-PVT
+// frames at 10Hz, 2021-05-04 12:30:00.1 to .3 UTC, with an ACK among them.
+static const uint8_t pvtStream[] = {
+    0x24, 0x47, 0x4E, 0x52, 0x4D, 0x43, 0x2C, 0x31, 0x32, 0x33, 0x30, 0x30,
+    0x30, 0x2E, 0x30, 0x30, 0x2C, 0x41, 0x2C, 0x34, 0x37, 0x32, 0x33, 0x2E,
+    0x38, 0x36, 0x34, 0x35, 0x31, 0x2C, 0x4E, 0x2C, 0x30, 0x30, 0x38, 0x33,
+    0x32, 0x2E, 0x37, 0x33, 0x35, 0x36, 0x33, 0x2C, 0x45, 0x2C, 0x32, 0x2E,
+    0x39, 0x35, 0x35, 0x2C, 0x39, 0x30, 0x2E, 0x31, 0x32, 0x2C, 0x30, 0x34,
+    0x30, 0x35, 0x32, 0x31, 0x2C, 0x2C, 0x2C, 0x41, 0x2A, 0x34, 0x32, 0x0D,
+    0x0A, 0xB5, 0x62, 0x01, 0x07, 0x5C, 0x00, 0xA4, 0x01, 0xD5, 0x07, 0xE5,
+    0x07, 0x05, 0x04, 0x0C, 0x1E, 0x00, 0x07, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0xE1, 0xF5, 0x05, 0x03, 0x01, 0xEA, 0x0E, 0x42, 0xF4, 0x17, 0x05, 0x4B,
+    0x52, 0x40, 0x1C, 0x53, 0x2A, 0x08, 0x00, 0xBB, 0x72, 0x07, 0x00, 0xB0,
+    0x04, 0x00, 0x00, 0x6C, 0x07, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF0,
+    0x05, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xF0, 0x05, 0x00, 0x00, 0x79,
+    0x84, 0x89, 0x00, 0x5E, 0x01, 0x00, 0x00, 0x80, 0xA9, 0x03, 0x00, 0x84,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xB2, 0xCE, 0xB5, 0x62, 0x05, 0x01, 0x02, 0x00, 0x06,
+    0x08, 0x16, 0x3F, 0xB5, 0x62, 0x01, 0x07, 0x5C, 0x00, 0x08, 0x02, 0xD5,
+    0x07, 0xE5, 0x07, 0x05, 0x04, 0x0C, 0x1E, 0x00, 0x07, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0xC2, 0xEB, 0x0B, 0x03, 0x01, 0xEA, 0x0E, 0x8A, 0xF4, 0x17,
+    0x05, 0x4C, 0x52, 0x40, 0x1C, 0x3A, 0x2A, 0x08, 0x00, 0xA2, 0x72, 0x07,
+    0x00, 0xB0, 0x04, 0x00, 0x00, 0x6C, 0x07, 0x00, 0x00, 0x0A, 0x00, 0x00,
+    0x00, 0xFF, 0x05, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00,
+    0x00, 0x84, 0x83, 0x89, 0x00, 0x5E, 0x01, 0x00, 0x00, 0x80, 0xA9, 0x03,
+    0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x9B, 0xB5, 0x62, 0x01, 0x07, 0x5C,
+    0x00, 0x6C, 0x02, 0xD5, 0x07, 0xE5, 0x07, 0x05, 0x04, 0x0C, 0x1E, 0x00,
+    0x07, 0x19, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xE1, 0x11, 0x03, 0x01, 0xEA,
+    0x0E, 0xD2, 0xF4, 0x17, 0x05, 0x4D, 0x52, 0x40, 0x1C, 0x22, 0x2A, 0x08,
+    0x00, 0x8A, 0x72, 0x07, 0x00, 0xB0, 0x04, 0x00, 0x00, 0x6C, 0x07, 0x00,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+    0xFF, 0x04, 0x06, 0x00, 0x00, 0xBC, 0x82, 0x89, 0x00, 0x5E, 0x01, 0x00,
+    0x00, 0x80, 0xA9, 0x03, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xC7,
+};
+
+// The same frames with line noise between the first two, and a bit flipped in the second
+static const uint8_t pvtCorruptStream[] = {
+    0xB5, 0x62, 0x01, 0x07, 0x5C, 0x00, 0xA4, 0x01, 0xD5, 0x07, 0xE5, 0x07,
+    0x05, 0x04, 0x0C, 0x1E, 0x00, 0x07, 0x19, 0x00, 0x00, 0x00, 0x00, 0xE1,
+    0xF5, 0x05, 0x03, 0x01, 0xEA, 0x0E, 0x42, 0xF4, 0x17, 0x05, 0x4B, 0x52,
+    0x40, 0x1C, 0x53, 0x2A, 0x08, 0x00, 0xBB, 0x72, 0x07, 0x00, 0xB0, 0x04,
+    0x00, 0x00, 0x6C, 0x07, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xF0, 0x05,
+    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xF0, 0x05, 0x00, 0x00, 0x79, 0x84,
+    0x89, 0x00, 0x5E, 0x01, 0x00, 0x00, 0x80, 0xA9, 0x03, 0x00, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB2, 0xCE, 0x00, 0xB5, 0x00, 0xB5, 0x62, 0x01, 0x07, 0x5C,
+    0x00, 0x08, 0x02, 0xD5, 0x07, 0xE5, 0x07, 0x05, 0x04, 0x0C, 0x1E, 0x00,
+    0x07, 0x19, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xEB, 0x0B, 0x03, 0x01, 0xEA,
+    0x0E, 0x8A, 0xF4, 0x17, 0x05, 0x4C, 0x52, 0x40, 0x1C, 0x3A, 0x2A, 0x18,
+    0x00, 0xA2, 0x72, 0x07, 0x00, 0xB0, 0x04, 0x00, 0x00, 0x6C, 0x07, 0x00,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0xFF, 0x05, 0x00, 0x00, 0x10, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x05, 0x00, 0x00, 0x84, 0x83, 0x89, 0x00, 0x5E, 0x01, 0x00,
+    0x00, 0x80, 0xA9, 0x03, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x9B, 0xB5,
+    0x62, 0x01, 0x07, 0x5C, 0x00, 0x6C, 0x02, 0xD5, 0x07, 0xE5, 0x07, 0x05,
+    0x04, 0x0C, 0x1E, 0x00, 0x07, 0x19, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xE1,
+    0x11, 0x03, 0x01, 0xEA, 0x0E, 0xD2, 0xF4, 0x17, 0x05, 0x4D, 0x52, 0x40,
+    0x1C, 0x22, 0x2A, 0x08, 0x00, 0x8A, 0x72, 0x07, 0x00, 0xB0, 0x04, 0x00,
+    0x00, 0x6C, 0x07, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x04, 0x06, 0x00, 0x00, 0xBC, 0x82, 0x89,
+    0x00, 0x5E, 0x01, 0x00, 0x00, 0x80, 0xA9, 0x03, 0x00, 0x84, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD5, 0xC7,
+};
+
+// The first solution of pvtStream as NAV-SOL, NAV-POSLLH and NAV-VELNED
+static const uint8_t legacyStream[] = {
+    0xB5, 0x62, 0x01, 0x06, 0x34, 0x00, 0xA4, 0x01, 0xD5, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x6C, 0x08, 0x03, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
+    0x00, 0x00, 0x84, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x90, 0x17,
+    0xB5, 0x62, 0x01, 0x02, 0x1C, 0x00, 0xA4, 0x01, 0xD5, 0x07, 0x42, 0xF4,
+    0x17, 0x05, 0x4B, 0x52, 0x40, 0x1C, 0x53, 0x2A, 0x08, 0x00, 0xBB, 0x72,
+    0x07, 0x00, 0xB0, 0x04, 0x00, 0x00, 0x6C, 0x07, 0x00, 0x00, 0xCB, 0x36,
+    0xB5, 0x62, 0x01, 0x12, 0x24, 0x00, 0xA4, 0x01, 0xD5, 0x07, 0x0A, 0x00,
+    0x00, 0x00, 0xF0, 0x05, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x9A, 0x00,
+    0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x79, 0x84, 0x89, 0x00, 0x23, 0x00,
+    0x00, 0x00, 0x80, 0xA9, 0x03, 0x00, 0xC1, 0x4A,
+};
+
+static const char nmeaStream[] =
+    "$GNGGA,123000.00,4723.86451,N,00832.73563,E,1,14,0.93,488.1,M,47.0,M,,*4A\r\n"
+    "$GNRMC,123000.00,A,4723.86451,N,00832.73563,E,2.955,90.12,040521,,,A*42\r\n";
+
+// The GPS port, handing over what has arrived since the last task run
+static std::vector<uint8_t> rxData;
+static uint32_t rxArrived;
+static uint32_t rxTail;
+static std::vector<uint8_t> txData;
+static uint32_t simulatedTime;
+static int framesParsed;
+static dateTime_t rtcDateTime;
+static bool rtcTimeSet;
+
+extern "C" {
+    static void testWrite(serialPort_t *, uint8_t ch) { txData.push_back(ch); }
+    static uint32_t testTotalRxWaiting(const serialPort_t *) { return rxArrived - rxTail; }
+    static uint32_t testTotalTxFree(const serialPort_t *) { return 256; }
+    static uint8_t testRead(serialPort_t *) { return rxData[rxTail++]; }
+    static void testSetBaudRate(serialPort_t *instance, uint32_t baudRate) { instance->baudRate = baudRate; }
+    static bool testIsTransmitBufferEmpty(const serialPort_t *) { return true; }
+    static void testSetMode(serialPort_t *instance, portMode_e mode) { instance->mode = mode; }
+}
+
+static const struct serialPortVTable testVTable = {
+    .serialWrite = testWrite,
+    .serialTotalRxWaiting = testTotalRxWaiting,
+    .serialTotalTxFree = testTotalTxFree,
+    .serialRead = testRead,
+    .serialSetBaudRate = testSetBaudRate,
+    .isSerialTransmitBufferEmpty = testIsTransmitBufferEmpty,
+    .setMode = testSetMode,
+    .setCtrlLineStateCb = NULL,
+    .setBaudRateCb = NULL,
+    .writeBuf = NULL,
+    .beginWrite = NULL,
+    .endWrite = NULL,
+    .readBuf = NULL,
+};
+
+static serialPort_t testPort;
+
+static serialPortConfig_t testPortConfig;
+
+static void resetGps(gpsProvider_e provider, bool navPvt)
+{
+    testPort.vTable = &testVTable;
+
+    pgResetAll();
+    gpsConfigMutable()->provider = provider;
+    gpsConfigMutable()->gps_ublox_nav_pvt = navPvt;
+    gpsConfigMutable()->gps_ublox_rate_hz = 25;
+
+    rxData.clear();
+    rxArrived = rxTail = 0;
+    txData.clear();
+    framesParsed = 0;
+    rtcTimeSet = false;
+    GPS_packetCount = 0;
+    memset(&gpsSol, 0, sizeof(gpsSol));
+    DISABLE_STATE(GPS_FIX);
+
+    gpsInit();
+    gpsData.errors = 0;
+}
+
+static void receive(const uint8_t *data, size_t length)
+{
+    rxData.insert(rxData.end(), data, data + length);
+}
+
+// Runs the GPS task every time up to chunk more bytes have arrived
+static void runGps(uint32_t chunk)
+{
+    while (rxArrived < rxData.size()) {
+        rxArrived = std::min<uint32_t>(rxArrived + chunk, rxData.size());
+        gpsUpdate(simulatedTime * 1000);
+        simulatedTime++;
+    }
+}
+
+static void expectFirstSolution(void)
+{
+    EXPECT_TRUE(STATE(GPS_FIX));
+    EXPECT_EQ(473977419, gpsSol.llh.lat);
+    EXPECT_EQ(85455938, gpsSol.llh.lon);
+    EXPECT_EQ(48812, gpsSol.llh.altCm);
+    EXPECT_EQ(14, gpsSol.numSat);
+    EXPECT_EQ(132, gpsSol.hdop);
+    EXPECT_EQ(152, gpsSol.groundSpeed);
+    EXPECT_EQ(901, gpsSol.groundCourse);
+}
+
+TEST(GpsTest, NavPvt)
+{
+    resetGps(GPS_UBLOX, true);
+    receive(pvtStream, sizeof(pvtStream));
+    runGps(1000);
+
+    // The RMC sentence is passed over, the ACK is taken without a solution
+    EXPECT_EQ(3, framesParsed);
+    EXPECT_EQ(4u, GPS_packetCount);
+    EXPECT_EQ(0u, gpsData.errors);
+
+    EXPECT_TRUE(STATE(GPS_FIX));
+    EXPECT_EQ(473977421, gpsSol.llh.lat);
+    EXPECT_EQ(85456082, gpsSol.llh.lon);
+    EXPECT_EQ(48807, gpsSol.llh.altCm);
+    EXPECT_EQ(14, gpsSol.numSat);
+    EXPECT_EQ(132, gpsSol.hdop);
+    EXPECT_EQ(154, gpsSol.groundSpeed);
+    EXPECT_EQ(155, gpsSol.speed3d);
+    EXPECT_EQ(901, gpsSol.groundCourse);
+
+    // The clock is set from the first solution
+    EXPECT_TRUE(rtcTimeSet);
+    EXPECT_EQ(2021, rtcDateTime.year);
+    EXPECT_EQ(5, rtcDateTime.month);
+    EXPECT_EQ(4, rtcDateTime.day);
+    EXPECT_EQ(12, rtcDateTime.hours);
+    EXPECT_EQ(30, rtcDateTime.minutes);
+    EXPECT_EQ(0, rtcDateTime.seconds);
+    EXPECT_EQ(100, rtcDateTime.millis);
+}
+
+TEST(GpsTest, NavPvtNoFix)
+{
+    uint8_t frame[100];
+
+    // The first frame of pvtStream with a 2D fix, and its checksum made good again
+    memcpy(frame, &pvtStream[73], sizeof(frame));
+    frame[6 + 20] = 2;
+    uint8_t ck_a = 0, ck_b = 0;
+    for (int i = 2; i < 98; i++) {
+        ck_b += (ck_a += frame[i]);
+    }
+    frame[98] = ck_a;
+    frame[99] = ck_b;
+
+    resetGps(GPS_UBLOX, true);
+    receive(pvtStream, sizeof(pvtStream));
+    receive(frame, sizeof(frame));
+    runGps(1000);
+
+    EXPECT_EQ(4, framesParsed);
+    EXPECT_FALSE(STATE(GPS_FIX));
+}
+
+TEST(GpsTest, SplitAcrossReads)
+{
+    // Frames are taken the same however the bytes arrive
+    for (uint32_t chunk = 1; chunk <= sizeof(pvtStream) + 1; chunk += 7) {
+        resetGps(GPS_UBLOX, true);
+        receive(pvtStream, sizeof(pvtStream));
+        runGps(chunk);
+
+        EXPECT_EQ(3, framesParsed) << "chunk " << chunk;
+        EXPECT_EQ(4u, GPS_packetCount);
+        EXPECT_EQ(0u, gpsData.errors);
+        EXPECT_EQ(473977421, gpsSol.llh.lat);
+    }
+}
+
+TEST(GpsTest, CorruptFramesAsByteParser)
+{
+    // The frame parser fed a byte at a time, as in passthrough
+    resetGps(GPS_UBLOX, true);
+    int byteFrames = 0;
+    for (size_t i = 0; i < sizeof(pvtCorruptStream); i++) {
+        byteFrames += gpsNewFrame(pvtCorruptStream[i]);
+    }
+    const uint32_t bytePackets = GPS_packetCount;
+    const uint32_t byteErrors = gpsData.errors;
+
+    EXPECT_EQ(2, byteFrames);
+    EXPECT_EQ(2u, bytePackets);
+    EXPECT_GT(byteErrors, 0u);
+
+    for (uint32_t chunk = 1; chunk <= 200; chunk += 13) {
+        resetGps(GPS_UBLOX, true);
+        receive(pvtCorruptStream, sizeof(pvtCorruptStream));
+        runGps(chunk);
+
+        EXPECT_EQ(byteFrames, framesParsed) << "chunk " << chunk;
+        EXPECT_EQ(bytePackets, GPS_packetCount);
+        EXPECT_EQ(byteErrors, gpsData.errors);
+        EXPECT_EQ(473977421, gpsSol.llh.lat);
+    }
+}
+
+TEST(GpsTest, LegacyUblox)
+{
+    resetGps(GPS_UBLOX, false);
+    receive(legacyStream, sizeof(legacyStream));
+    runGps(40);
+
+    // Position and speed come in separate messages, a solution when both are in
+    EXPECT_EQ(1, framesParsed);
+    EXPECT_EQ(3u, GPS_packetCount);
+    EXPECT_EQ(0u, gpsData.errors);
+    expectFirstSolution();
+    EXPECT_EQ(154, gpsSol.speed3d);
+}
+
+TEST(GpsTest, Nmea)
+{
+    resetGps(GPS_NMEA, false);
+    receive((const uint8_t *)nmeaStream, strlen(nmeaStream));
+    runGps(16);
+
+    // Less precise, with fields cut short as the NMEA parser does
+    EXPECT_EQ(1, framesParsed);
+    EXPECT_EQ(2u, GPS_packetCount);
+    EXPECT_TRUE(STATE(GPS_FIX));
+    EXPECT_EQ(473977416, gpsSol.llh.lat);
+    EXPECT_EQ(85455933, gpsSol.llh.lon);
+    EXPECT_EQ(48810, gpsSol.llh.altCm);
+    EXPECT_EQ(14, gpsSol.numSat);
+    EXPECT_EQ(900, gpsSol.hdop);
+    EXPECT_EQ(149, gpsSol.groundSpeed);
+    EXPECT_EQ(901, gpsSol.groundCourse);
+}
+
+static bool txContains(const std::vector<uint8_t> &message)
+{
+    return std::search(txData.begin(), txData.end(), message.begin(), message.end()) != txData.end();
+}
+
+// Runs the configuration through, with the receiver never acknowledging
+static void configure(void)
+{
+    for (int i = 0; i < 1000 && !gpsIsHealthy(); i++) {
+        gpsUpdate(simulatedTime * 1000);
+        simulatedTime += 10;
+    }
+    EXPECT_TRUE(gpsIsHealthy());
+}
+
+static const std::vector<uint8_t> enablePvt = { 0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x07, 0x01, 0x13, 0x51 };
+static const std::vector<uint8_t> disableSvinfo = { 0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x30, 0x00, 0x3B, 0xA2 };
+static const std::vector<uint8_t> enableSvinfo = { 0xB5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x30, 0x05, 0x40, 0xA7 };
+static const std::vector<uint8_t> rate25Hz = { 0xB5, 0x62, 0x06, 0x08, 0x06, 0x00, 0x28, 0x00, 0x01, 0x00, 0x01, 0x00, 0x3E, 0xAA };
+static const std::vector<uint8_t> rate5Hz = { 0xB5, 0x62, 0x06, 0x08, 0x06, 0x00, 0xC8, 0x00, 0x01, 0x00, 0x01, 0x00, 0xDE, 0x6A };
+
+TEST(GpsTest, ConfigureNavPvt)
+{
+    resetGps(GPS_UBLOX, true);
+    configure();
+
+    EXPECT_TRUE(txContains(enablePvt));
+    EXPECT_TRUE(txContains(disableSvinfo));
+    EXPECT_TRUE(txContains(rate25Hz));
+    EXPECT_FALSE(txContains(enableSvinfo));
+    EXPECT_FALSE(txContains(rate5Hz));
+}
+
+TEST(GpsTest, ConfigureLegacy)
+{
+    resetGps(GPS_UBLOX, false);
+    configure();
+
+    EXPECT_FALSE(txContains(enablePvt));
+    EXPECT_TRUE(txContains(enableSvinfo));
+    EXPECT_TRUE(txContains(rate5Hz));
+    EXPECT_FALSE(txContains(rate25Hz));
+}
+
+// STUBS
+
+extern "C" {
+    uint8_t armingFlags;
+    uint16_t flightModeFlags;
+    uint8_t stateFlags;
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+    const uint32_t baudRates[] = { 0, 9600, 19200, 38400, 57600, 115200, 230400, 250000,
+        400000, 460800, 500000, 921600, 1000000, 1500000, 2000000, 2470000 };
+
+    uint32_t millis(void) { return simulatedTime; }
+    uint32_t micros(void) { return simulatedTime * 1000; }
+
+    bool sensors(uint32_t) { return false; }
+    void sensorsSet(uint32_t mask) { framesParsed += mask == SENSOR_GPS; }
+    void sensorsClear(uint32_t) { }
+
+    bool rtcHasTime(void) { return rtcTimeSet; }
+    bool rtcSetDateTime(dateTime_t *dt)
+    {
+        rtcDateTime = *dt;
+        rtcTimeSet = true;
+        return true;
+    }
+    bool rtcSet(rtcTime_t *) { return true; }
+
+    const serialPortConfig_t *findSerialPortConfig(serialPortFunction_e)
+    {
+        testPortConfig.gps_baudrateIndex = BAUD_115200;
+        return &testPortConfig;
+    }
+
+    serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *,
+        uint32_t baudRate, portMode_e mode, portOptions_e)
+    {
+        testPort.baudRate = baudRate;
+        testPort.mode = mode;
+        return &testPort;
+    }
+
+    baudRate_e lookupBaudRateIndex(uint32_t baudRate)
+    {
+        for (unsigned i = 0; i < ARRAYLEN(baudRates); i++) {
+            if (baudRates[i] == baudRate) {
+                return (baudRate_e)i;
+            }
+        }
+        return BAUD_AUTO;
+    }
+
+    void waitForSerialPortToFinishTransmitting(serialPort_t *) { }
+    void serialPassthrough(serialPort_t *, serialPort_t *, serialConsumer *, serialConsumer *) { }
+
+    float cos_approx(float x) { return cosf(x); }
+    float atan2_approx(float y, float x) { return atan2f(y, x); }
+
+    bool gpsRescueIsConfigured(void) { return false; }
+    void updateGPSRescueState(void) { }
+    void rescueNewGpsData(void) { }
+}
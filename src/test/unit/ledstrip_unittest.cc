@@ -68,12 +68,18 @@ extern "C" {
     void reevaluateLedConfig();
 
     PG_REGISTER(batteryConfig_t, batteryConfig, PG_BATTERY_CONFIG, 0);
+
+    static hsvColor_t testLedColors[LED_MAX_STRIP_LENGTH];
+    static bool testLedStripReady = false;
+    static bool testArmingDisabled = false;
+    static int testStripUpdateCount;
+    static int testFixedLayerCount;
 }
 
 TEST(LedStripTest, parseLedStripConfig)
 {
     // given
-    memset(&ledStripStatusModeConfigMutable()->ledConfigs, 0, LED_MAX_STRIP_LENGTH);
+    memset(&ledStripStatusModeConfigMutable()->ledConfigs, 0, sizeof(ledStripStatusModeConfig()->ledConfigs));
 
     // and
     static const ledConfig_t expectedLedStripConfig[WS2811_LED_STRIP_LENGTH] = {
@@ -194,7 +200,7 @@ TEST(LedStripTest, parseLedStripConfig)
 TEST(LedStripTest, smallestGridWithCenter)
 {
     // given
-    memset(&ledStripStatusModeConfigMutable()->ledConfigs, 0, LED_MAX_STRIP_LENGTH);
+    memset(&ledStripStatusModeConfigMutable()->ledConfigs, 0, sizeof(ledStripStatusModeConfig()->ledConfigs));
 
     // and
     static const ledConfig_t testLedConfigs[] = {
@@ -222,7 +228,7 @@ TEST(LedStripTest, smallestGridWithCenter)
 TEST(LedStripTest, smallestGrid)
 {
     // given
-    memset(&ledStripStatusModeConfigMutable()->ledConfigs, 0, LED_MAX_STRIP_LENGTH);
+    memset(&ledStripStatusModeConfigMutable()->ledConfigs, 0, sizeof(ledStripStatusModeConfig()->ledConfigs));
 
     // and
     static const ledConfig_t testLedConfigs[] = {
@@ -250,6 +256,51 @@ extern hsvColor_t *colors;
 
 #define TEST_COLOR_COUNT 4
 
+TEST(LedStripTest, baseLayersKeptForUpperLayers)
+{
+    // given
+    memset(&ledStripStatusModeConfigMutable()->ledConfigs, 0, sizeof(ledStripStatusModeConfig()->ledConfigs));
+    ledStripStatusModeConfigMutable()->ledConfigs[0] = DEFINE_LED(0, 0, 0, 0, LF(BATTERY), 0, 0);
+    ledStripStatusModeConfigMutable()->ledConfigs[1] = DEFINE_LED(1, 0, 0, 0, LF(COLOR), LO(WARNING), 0);
+    ledStripConfigMutable()->ledstrip_profile = LED_PROFILE_STATUS;
+    reevaluateLedConfig();
+
+    // and the warning layer blinks over the fixed layers at 10Hz, from its second cycle
+    testLedStripReady = true;
+    testArmingDisabled = true;
+    testStripUpdateCount = 0;
+    testFixedLayerCount = 0;
+
+    // when
+    hsvColor_t batteryColor = { 0, 0, 0 };
+    bool warningOn = false;
+    bool warningOff = false;
+    for (timeUs_t now = 1000000; now < 4000000; now += 1000) {
+        ledStripUpdate(now);
+
+        if (now == 1000000) {
+            batteryColor = testLedColors[0];
+        }
+        EXPECT_EQ(batteryColor.h, testLedColors[0].h);
+        EXPECT_EQ(batteryColor.s, testLedColors[0].s);
+        EXPECT_EQ(batteryColor.v, testLedColors[0].v);
+
+        warningOn |= testLedColors[1].v != 0;
+        warningOff |= testLedColors[1].v == 0;
+    }
+
+    testLedStripReady = false;
+    testArmingDisabled = false;
+
+    // then the fixed layers are only composed when a base layer fires,
+    // the 5Hz thrust ring here, while every warning step is drawn
+    EXPECT_TRUE(warningOn);
+    EXPECT_TRUE(warningOff);
+    EXPECT_GE(testStripUpdateCount, 30);
+    EXPECT_LE(testFixedLayerCount, 16);
+    EXPECT_LT(testFixedLayerCount, testStripUpdateCount);
+}
+
 TEST(ColorTest, parseColor)
 {
     // given
@@ -298,9 +349,8 @@ extern "C" {
 uint8_t armingFlags = 0;
 uint8_t stateFlags = 0;
 uint16_t flightModeFlags = 0;
-float rcCommand[4];
+float rcCommand[5];
 int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
-boxBitmask_t rcModeActivationMask;
 gpsSolutionData_t gpsSol;
 
 batteryState_e getBatteryState(void) {
@@ -311,7 +361,7 @@ void ws2811LedStripInit(ioTag_t ioTag) {
     UNUSED(ioTag);
 }
 
-void ws2811UpdateStrip(ledStripFormatRGB_e) {}
+void ws2811UpdateStrip(ledStripFormatRGB_e) { testStripUpdateCount++; }
 
 void setLedValue(uint16_t index, const uint8_t value) {
     UNUSED(index);
@@ -319,13 +369,11 @@ void setLedValue(uint16_t index, const uint8_t value) {
 }
 
 void setLedHsv(uint16_t index, const hsvColor_t *color) {
-    UNUSED(index);
-    UNUSED(color);
+    testLedColors[index] = *color;
 }
 
 void getLedHsv(uint16_t index, hsvColor_t *color) {
-    UNUSED(index);
-    UNUSED(color);
+    *color = testLedColors[index];
 }
 
 
@@ -342,7 +390,7 @@ void setStripColors(const hsvColor_t *colors) {
     UNUSED(colors);
 }
 
-bool isWS2811LedStripReady(void) { return false; }
+bool isWS2811LedStripReady(void) { return testLedStripReady; }
 
 void delay(uint32_t ms)
 {
@@ -377,7 +425,8 @@ bool rxIsReceivingSignal() { return true; }
 
 bool isBeeperOn() { return false; };
 
-uint8_t calculateBatteryPercentageRemaining() { return 0; }
+// Only read by the fixed layers
+uint8_t calculateBatteryPercentageRemaining() { testFixedLayerCount++; return 0; }
 
 bool sensors(uint32_t mask)
 {
@@ -387,7 +436,7 @@ bool sensors(uint32_t mask)
 
 const timerHardware_t timerHardware[USABLE_TIMER_CHANNEL_COUNT] = {};
 
-bool isArmingDisabled(void) { return false; }
+bool isArmingDisabled(void) { return testArmingDisabled; }
 
 uint8_t getRssiPercent(void) { return 0; }
 
@@ -0,0 +1,279 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/axis.h"
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "config/config.h"
+
+    #include "fc/rc_controls.h"
+    #include "fc/runtime_config.h"
+
+    #include "flight/mixer.h"
+    #include "flight/pid.h"
+
+    #include "pg/pg.h"
+    #include "pg/rx.h"
+
+    #include "rx/rx.h"
+
+    uint8_t armingFlags;
+    uint16_t flightModeFlags;
+
+    float rcCommand[5];
+    int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+
+    pidAxisData_t pidData[3];
+
+    static pidProfile_t testPidProfile;
+    pidProfile_t *currentPidProfile = &testPidProfile;
+
+    static float governorOutput[2];
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+
+/*
+ * Reference: the rule loop of mixerUpdate() before the rules were
+ * compiled, on the same inputs.
+ */
+
+static float refOutput[MIXER_OUTPUT_COUNT];
+
+static void refUpdate(void)
+{
+    for (int i = 0; i < MIXER_OUTPUT_COUNT; i++) {
+        refOutput[i] = 0;
+    }
+
+    for (int i = 0; i < MIXER_RULE_COUNT; i++) {
+        const mixer_t *rule = mixerRules(i);
+
+        if (rule->oper == MIXER_OP_NUL)
+            break;
+
+        const int oper   = constrain(rule->oper, 1, MIXER_OP_COUNT - 1);
+        const int src    = constrain(rule->input, 0, MIXER_INPUT_COUNT -1);
+        const int dst    = constrain(rule->output, 0, MIXER_OUTPUT_COUNT - 1);
+        const int offset = constrain(rule->offset, -2000, 2000);
+        const int rate   = constrain(rule->rate, -2000, 2000);
+        const int min    = constrain(rule->min, -2000, 2000);
+        const int max    = constrain(rule->max, min, 2000);
+
+        float val = constrainf(offset + mixerGetInput(src) * rate * mixScales[src]/1000.0f, min, max) / 1000.0f;
+
+        switch (oper)
+        {
+            case MIXER_OP_SET:
+                refOutput[dst] = val;
+                break;
+            case MIXER_OP_ADD:
+                refOutput[dst] += val;
+                break;
+            case MIXER_OP_MUL:
+                refOutput[dst] *= val;
+                break;
+        }
+    }
+}
+
+static float mixerOutputAt(int index)
+{
+    return (index < MIXER_OUTPUT_MOTORS) ? mixerGetServoOutput(index) : mixerGetMotorOutput(index - MIXER_OUTPUT_MOTORS);
+}
+
+static void setRule(int index, uint8_t oper, uint8_t input, uint8_t output, int16_t rate, int16_t offset = 0, int16_t min = -1000, int16_t max = 1000)
+{
+    mixer_t *rule = mixerRulesMutable(index);
+
+    rule->oper   = oper;
+    rule->input  = input;
+    rule->output = output;
+    rule->rate   = rate;
+    rule->offset = offset;
+    rule->min    = min;
+    rule->max    = max;
+}
+
+static void randomInputs(void)
+{
+    for (int axis = 0; axis < 3; axis++) {
+        pidData[axis].SumLim = rand() % 1001 - 500;
+    }
+    for (int axis = 0; axis < 5; axis++) {
+        rcCommand[axis] = rand() % 1001 - 500;
+    }
+    rcCommand[THROTTLE] = 1000 + rand() % 1001;
+    for (int ch = 0; ch < MAX_SUPPORTED_RC_CHANNEL_COUNT; ch++) {
+        rcData[ch] = 1000 + rand() % 1001;
+    }
+    governorOutput[0] = (rand() % 1001) / 1000.0f;
+    governorOutput[1] = (rand() % 1001) / 1000.0f;
+}
+
+class MixerTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        srand(42);
+        pgResetAll();
+        memset(mixerRulesMutable(0), 0, sizeof(mixer_t) * MIXER_RULE_COUNT);
+        testPidProfile.pidSumLimit = 500;
+        armingFlags = ARMED;
+        flightModeFlags = 0;
+    }
+
+    // Run both mixers over random inputs and compare every output
+    void compareOutputs(int loops) {
+        mixerInit();
+
+        for (int loop = 0; loop < loops; loop++) {
+            randomInputs();
+            mixerUpdate();
+            refUpdate();
+
+            for (int i = 0; i < MIXER_OUTPUT_COUNT; i++) {
+                const float tolerance = 1e-5f * MAX(1.0f, fabsf(refOutput[i]));
+                ASSERT_NEAR(refOutput[i], mixerOutputAt(i), tolerance) << "loop " << loop << " output " << i;
+            }
+        }
+    }
+};
+
+TEST_F(MixerTest, HeliCCPM120MatchesReference)
+{
+    // Swash servos at 0, 120 and 240 degrees, tail servo, main and tail motors
+    setRule(0,  MIXER_OP_SET, MIXER_IN_STABILIZED_COLLECTIVE, 0,  1000);
+    setRule(1,  MIXER_OP_ADD, MIXER_IN_STABILIZED_PITCH,      0,  1000);
+    setRule(2,  MIXER_OP_SET, MIXER_IN_STABILIZED_COLLECTIVE, 1,  1000);
+    setRule(3,  MIXER_OP_ADD, MIXER_IN_STABILIZED_ROLL,       1,  866);
+    setRule(4,  MIXER_OP_ADD, MIXER_IN_STABILIZED_PITCH,      1, -500);
+    setRule(5,  MIXER_OP_SET, MIXER_IN_STABILIZED_COLLECTIVE, 2,  1000);
+    setRule(6,  MIXER_OP_ADD, MIXER_IN_STABILIZED_ROLL,       2, -866);
+    setRule(7,  MIXER_OP_ADD, MIXER_IN_STABILIZED_PITCH,      2, -500);
+    setRule(8,  MIXER_OP_SET, MIXER_IN_STABILIZED_YAW,        3,  1000, 50, -800, 800);
+    setRule(9,  MIXER_OP_SET, MIXER_IN_GOVERNOR_MAIN,         MIXER_OUTPUT_MOTORS + 0, 1000, 0, 0, 1000);
+    setRule(10, MIXER_OP_SET, MIXER_IN_GOVERNOR_TAIL,         MIXER_OUTPUT_MOTORS + 1, 1000, 0, 0, 1000);
+
+    mixerScalesMutable()->scale[MIXER_IN_STABILIZED_COLLECTIVE] = 600;
+    mixerScalesMutable()->scale[MIXER_IN_STABILIZED_ROLL] = 1200;
+
+    compareOutputs(10000);
+
+    EXPECT_EQ(4, mixerGetActiveServos());
+    EXPECT_EQ(2, mixerGetActiveMotors());
+}
+
+TEST_F(MixerTest, CyclicRingAndOverrideMatchReference)
+{
+    setRule(0, MIXER_OP_SET, MIXER_IN_STABILIZED_ROLL,  0, 1000);
+    setRule(1, MIXER_OP_SET, MIXER_IN_STABILIZED_PITCH, 1, 1000);
+    setRule(2, MIXER_OP_SET, MIXER_IN_RCDATA_5,         2, 1000);
+
+    // Small ring so the cyclic limit is hit
+    testPidProfile.pidSumLimit = 200;
+    compareOutputs(2000);
+
+    // Overrides apply when disarmed
+    armingFlags = 0;
+    mixerInit();
+    mixerOverride[MIXER_IN_RCDATA_5] = 300;
+    randomInputs();
+    mixerUpdate();
+    refUpdate();
+    EXPECT_NEAR(0.3f, mixerGetServoOutput(2), 1e-6f);
+    EXPECT_NEAR(refOutput[0], mixerGetServoOutput(0), 1e-6f);
+    EXPECT_NEAR(refOutput[1], mixerGetServoOutput(1), 1e-6f);
+}
+
+TEST_F(MixerTest, RandomRuleSetsMatchReference)
+{
+    for (int set = 0; set < 500; set++) {
+        const int ruleCount = 1 + rand() % MIXER_RULE_COUNT;
+
+        memset(mixerRulesMutable(0), 0, sizeof(mixer_t) * MIXER_RULE_COUNT);
+
+        // Few outputs, so every output gets a mix of operations
+        for (int i = 0; i < ruleCount; i++) {
+            const int min = rand() % 2001 - 1000;
+            setRule(i, 1 + rand() % (MIXER_OP_COUNT - 1), rand() % MIXER_INPUT_COUNT,
+                    (rand() % 4 == 0) ? MIXER_OUTPUT_MOTORS + rand() % 2 : rand() % 6,
+                    rand() % 4001 - 2000, rand() % 1001 - 500, min, min + rand() % 1500);
+        }
+        for (int i = 1; i < MIXER_INPUT_COUNT; i++) {
+            mixerScalesMutable()->scale[i] = rand() % 4001 - 2000;
+        }
+
+        compareOutputs(20);
+        if (HasFatalFailure()) {
+            FAIL() << "rule set " << set;
+        }
+    }
+}
+
+TEST_F(MixerTest, UnusedOutputsStayZero)
+{
+    setRule(0, MIXER_OP_SET, MIXER_IN_STABILIZED_ROLL, 5, 1000);
+    setRule(1, MIXER_OP_ADD, MIXER_IN_STABILIZED_YAW,  6, 1000);
+    compareOutputs(10);
+
+    // Recompile with fewer rules, stale outputs must not stay around
+    memset(mixerRulesMutable(1), 0, sizeof(mixer_t));
+    compareOutputs(10);
+
+    for (int i = 0; i < MIXER_OUTPUT_COUNT; i++) {
+        if (i != 5) {
+            EXPECT_EQ(0, mixerOutputAt(i)) << "output " << i;
+        }
+    }
+}
+
+TEST_F(MixerTest, ScaleChangeRecompiles)
+{
+    setRule(0, MIXER_OP_SET, MIXER_IN_STABILIZED_PITCH, 0, 1000);
+    mixerInit();
+
+    pidData[FD_PITCH].SumLim = 250;
+    mixerUpdate();
+    EXPECT_NEAR(0.5f, mixerGetServoOutput(0), 1e-6f);
+
+    mixerSetInputScale(MIXER_IN_STABILIZED_PITCH, 500);
+    mixerUpdate();
+    EXPECT_NEAR(0.25f, mixerGetServoOutput(0), 1e-6f);
+}
+
+
+// STUBS
+
+extern "C" {
+
+void governorUpdate(void) { }
+void parseRcChannels(const char *, rxConfig_t *) { }
+float getGovernorOutput(uint8_t motor) { return governorOutput[motor]; }
+
+}
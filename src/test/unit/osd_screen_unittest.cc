@@ -0,0 +1,333 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/utils.h"
+
+    #include "drivers/display.h"
+
+    #include "osd/osd_screen.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_ROWS   16
+#define TEST_COLS   30
+
+// MSP displayport frame overhead and payload of each command
+#define MSP_FRAME_BYTES     6
+#define MSP_WRITE_BYTES     4
+#define MSP_COMMAND_BYTES   1
+
+static char deviceChars[TEST_ROWS][TEST_COLS];
+static uint8_t deviceAttrs[TEST_ROWS][TEST_COLS];
+
+static int writeCount;
+static int writeChars;
+static int clearCount;
+
+static int testClearScreen(displayPort_t *displayPort)
+{
+    UNUSED(displayPort);
+    memset(deviceChars, ' ', sizeof(deviceChars));
+    memset(deviceAttrs, 0, sizeof(deviceAttrs));
+    clearCount++;
+    return 0;
+}
+
+static int testWriteString(displayPort_t *displayPort, uint8_t x, uint8_t y, uint8_t attr, const char *s)
+{
+    UNUSED(displayPort);
+    EXPECT_LT(y, TEST_ROWS);
+    EXPECT_LE(strlen(s), (size_t)OSD_SCREEN_WRITE_MAX);
+    for (; *s && x < TEST_COLS; x++, s++) {
+        deviceChars[y][x] = *s;
+        deviceAttrs[y][x] = attr;
+        writeChars++;
+    }
+    writeCount++;
+    return 0;
+}
+
+static displayPortVTable_t testVTable;
+static displayPort_t testDisplayPort;
+
+static displayPort_t *testDisplayInit(void)
+{
+    memset(&testVTable, 0, sizeof(testVTable));
+    testVTable.clearScreen = testClearScreen;
+    testVTable.writeString = testWriteString;
+
+    displayInit(&testDisplayPort, &testVTable);
+    testDisplayPort.rows = TEST_ROWS;
+    testDisplayPort.cols = TEST_COLS;
+
+    writeCount = writeChars = clearCount = 0;
+
+    return &testDisplayPort;
+}
+
+static int mspBytes(void)
+{
+    return writeCount * (MSP_FRAME_BYTES + MSP_WRITE_BYTES) + writeChars + clearCount * (MSP_FRAME_BYTES + MSP_COMMAND_BYTES);
+}
+
+// The frame as a direct draw would leave it
+static char expectChars[TEST_ROWS][TEST_COLS];
+static uint8_t expectAttrs[TEST_ROWS][TEST_COLS];
+
+static void expectBegin(void)
+{
+    memset(expectChars, ' ', sizeof(expectChars));
+    memset(expectAttrs, 0, sizeof(expectAttrs));
+    osdScreenBegin();
+}
+
+static void expectWrite(uint8_t x, uint8_t y, uint8_t attr, const char *s)
+{
+    osdScreenWrite(x, y, attr, s);
+
+    for (int col = x; *s && col < TEST_COLS; col++, s++) {
+        expectChars[y][col] = *s;
+        expectAttrs[y][col] = attr;
+    }
+}
+
+static void expectDevice(void)
+{
+    for (int row = 0; row < TEST_ROWS; row++) {
+        for (int col = 0; col < TEST_COLS; col++) {
+            ASSERT_EQ(expectChars[row][col], deviceChars[row][col]) << "row " << row << " col " << col;
+            ASSERT_EQ(expectAttrs[row][col], deviceAttrs[row][col]) << "row " << row << " col " << col;
+        }
+    }
+}
+
+TEST(OsdScreenUnittest, TooLargeDisplay)
+{
+    displayPort_t *displayPort = testDisplayInit();
+
+    displayPort->cols = OSD_SCREEN_COLS_MAX + 1;
+    EXPECT_FALSE(osdScreenInit(displayPort));
+    EXPECT_FALSE(osdScreenActive());
+
+    displayPort->cols = TEST_COLS;
+    EXPECT_TRUE(osdScreenInit(displayPort));
+    EXPECT_TRUE(osdScreenActive());
+}
+
+TEST(OsdScreenUnittest, OnlyChangesAreWritten)
+{
+    displayPort_t *displayPort = testDisplayInit();
+    osdScreenInit(displayPort);
+
+    expectBegin();
+    expectWrite(2, 1, DISPLAYPORT_ATTR_NONE, "12.4V");
+    expectWrite(20, 1, DISPLAYPORT_ATTR_NONE, "345MAH");
+    osdScreenFlush(displayPort);
+    expectDevice();
+    EXPECT_EQ(2, writeCount);
+
+    // Nothing changed, nothing written, until the periodic resend
+    for (int n = 1; n < OSD_SCREEN_RESEND_FLUSHES; n++) {
+        writeCount = 0;
+        expectBegin();
+        expectWrite(2, 1, DISPLAYPORT_ATTR_NONE, "12.4V");
+        expectWrite(20, 1, DISPLAYPORT_ATTR_NONE, "345MAH");
+        osdScreenFlush(displayPort);
+        ASSERT_EQ(0, writeCount);
+    }
+
+    expectBegin();
+    expectWrite(2, 1, DISPLAYPORT_ATTR_NONE, "12.4V");
+    expectWrite(20, 1, DISPLAYPORT_ATTR_NONE, "345MAH");
+    osdScreenFlush(displayPort);
+    EXPECT_EQ(2, writeCount);
+
+    // One digit
+    writeCount = writeChars = 0;
+    expectBegin();
+    expectWrite(2, 1, DISPLAYPORT_ATTR_NONE, "12.3V");
+    expectWrite(20, 1, DISPLAYPORT_ATTR_NONE, "345MAH");
+    osdScreenFlush(displayPort);
+    expectDevice();
+    EXPECT_EQ(1, writeCount);
+    EXPECT_EQ(1, writeChars);
+
+    // A shorter value blanks the rest, nearby changes go in one write
+    writeCount = writeChars = 0;
+    expectBegin();
+    expectWrite(2, 1, DISPLAYPORT_ATTR_NONE, "9.9V");
+    expectWrite(20, 1, DISPLAYPORT_ATTR_NONE, "345MAH");
+    osdScreenFlush(displayPort);
+    expectDevice();
+    EXPECT_EQ(1, writeCount);
+    EXPECT_EQ(5, writeChars);
+}
+
+TEST(OsdScreenUnittest, AttributesSplitWrites)
+{
+    displayPort_t *displayPort = testDisplayInit();
+    osdScreenInit(displayPort);
+
+    expectBegin();
+    expectWrite(0, 5, DISPLAYPORT_ATTR_NONE, "AB");
+    expectWrite(2, 5, DISPLAYPORT_ATTR_WARNING | DISPLAYPORT_ATTR_BLINK, "LOW BATTERY");
+    expectWrite(13, 5, DISPLAYPORT_ATTR_NONE, "CD");
+    osdScreenFlush(displayPort);
+    expectDevice();
+    EXPECT_EQ(3, writeCount);
+
+    // Blinking off
+    expectBegin();
+    expectWrite(0, 5, DISPLAYPORT_ATTR_NONE, "AB");
+    expectWrite(13, 5, DISPLAYPORT_ATTR_NONE, "CD");
+    osdScreenFlush(displayPort);
+    expectDevice();
+}
+
+TEST(OsdScreenUnittest, LongWritesAreSplit)
+{
+    displayPort_t *displayPort = testDisplayInit();
+    osdScreenInit(displayPort);
+
+    expectBegin();
+    for (int row = 0; row < TEST_ROWS; row++) {
+        char line[TEST_COLS + 1];
+        for (int col = 0; col < TEST_COLS; col++) {
+            line[col] = 'A' + (row + col) % 26;
+        }
+        line[TEST_COLS] = 0;
+        expectWrite(0, row, DISPLAYPORT_ATTR_NONE, line);
+    }
+    osdScreenFlush(displayPort);
+    expectDevice();
+
+    // Past the edge of the screen
+    expectBegin();
+    expectWrite(25, 3, DISPLAYPORT_ATTR_NONE, "0123456789");
+    osdScreenWrite(0, TEST_ROWS, DISPLAYPORT_ATTR_NONE, "OFFSCREEN");
+    osdScreenFlush(displayPort);
+    expectDevice();
+}
+
+TEST(OsdScreenUnittest, RandomFrames)
+{
+    displayPort_t *displayPort = testDisplayInit();
+    osdScreenInit(displayPort);
+    srand(14);
+
+    for (int frame = 0; frame < 2000; frame++) {
+        expectBegin();
+        for (int n = rand() % 20; n > 0; n--) {
+            char text[12];
+            const int len = 1 + rand() % 10;
+            for (int i = 0; i < len; i++) {
+                text[i] = "0123456789 ABC"[rand() % 14];
+            }
+            text[len] = 0;
+            expectWrite(rand() % TEST_COLS, rand() % TEST_ROWS, (rand() % 8) ? DISPLAYPORT_ATTR_NONE : DISPLAYPORT_ATTR_CRITICAL, text);
+        }
+        osdScreenFlush(displayPort);
+        expectDevice();
+        if (HasFatalFailure()) {
+            FAIL() << "frame " << frame;
+        }
+    }
+}
+
+typedef struct {
+    uint8_t x, y;
+    int period;     // frames between value changes, 0 if static
+    const char *format;
+} testElement_t;
+
+// A heli layout at 12 frames per second
+static const testElement_t typicalLayout[] = {
+    { 1, 1, 12, "%d.%dV" },         // battery voltage
+    { 1, 2, 1, "%d.%dA" },          // current
+    { 1, 3, 6, "%dMAH" },           // consumption
+    { 23, 1, 12, "%02d:%02d" },     // flight timer
+    { 23, 2, 12, "%02d:%02d" },     // on timer
+    { 23, 3, 24, "%dDB" },          // link quality
+    { 12, 1, 0, "HELI 700" },       // craft name
+    { 12, 2, 0, "GOV ACTIVE" },     // governor
+    { 1, 13, 1, "%dRPM" },          // headspeed
+    { 1, 14, 1, "%d%%" },           // throttle
+    { 23, 13, 1, "%d.%dM" },        // altitude
+    { 23, 14, 24, "%dC" },          // ESC temperature
+    { 14, 7, 0, "-+-" },            // crosshairs
+    { 10, 11, 0, "ACRO" },          // flight mode
+    { 8, 12, 0, "\x90\x91\x91\x91\x91\x91\x91\x92" },   // battery bar
+};
+
+static void drawTypicalLayout(int frame, bool shadow, displayPort_t *displayPort)
+{
+    for (unsigned i = 0; i < ARRAYLEN(typicalLayout); i++) {
+        const testElement_t *element = &typicalLayout[i];
+        const int step = element->period ? frame / element->period : 0;
+        const int value = 100 + (step * 37 + (int)i * 11) % 900;
+        char text[OSD_SCREEN_WRITE_MAX + 1];
+
+        snprintf(text, sizeof(text), element->format, value / 10, value % 10);
+
+        if (shadow) {
+            expectWrite(element->x, element->y, DISPLAYPORT_ATTR_NONE, text);
+        } else {
+            displayWrite(displayPort, element->x, element->y, DISPLAYPORT_ATTR_NONE, text);
+        }
+    }
+}
+
+TEST(OsdScreenUnittest, TypicalLayoutBytes)
+{
+    const int frames = 12 * 60;
+
+    // Clear and redraw everything on every refresh
+    displayPort_t *displayPort = testDisplayInit();
+    for (int frame = 0; frame < frames; frame++) {
+        displayClearScreen(displayPort);
+        drawTypicalLayout(frame, false, displayPort);
+    }
+    const int directBytes = mspBytes();
+    const int directWrites = writeCount;
+
+    // Only what changed
+    displayPort = testDisplayInit();
+    osdScreenInit(displayPort);
+    for (int frame = 0; frame < frames; frame++) {
+        expectBegin();
+        drawTypicalLayout(frame, true, displayPort);
+        osdScreenFlush(displayPort);
+        expectDevice();
+    }
+    const int shadowBytes = mspBytes();
+    const int shadowWrites = writeCount;
+
+    printf("[ OSD      ] MSP displayport bytes/s, direct: %d (%d writes/s), shadow screen: %d (%d writes/s)\n",
+        directBytes / 60, directWrites / 60, shadowBytes / 60, shadowWrites / 60);
+
+    EXPECT_LT(shadowBytes * 3, directBytes);
+}
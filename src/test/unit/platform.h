@@ -111,6 +111,27 @@ typedef struct
 #define MCU_TYPE_ID   99
 #define MCU_TYPE_NAME "UNIT_TEST"
 
+#ifdef CONFIG_IN_FILE
+// Flash emulated by the test, as on SITL
+typedef enum
+{
+    FLASH_BUSY = 1,
+    FLASH_ERROR_PG,
+    FLASH_ERROR_WRP,
+    FLASH_COMPLETE,
+    FLASH_TIMEOUT
+} FLASH_Status;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address);
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data);
+
+extern uint8_t eepromData[EEPROM_SIZE];
+#define __config_start (*eepromData)
+#define __config_end (*ARRAYEND(eepromData))
+#endif
+
 #include "target.h"
 
 #include "target/common_defaults_post.h"
@@ -0,0 +1,378 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/axis.h"
+    #include "common/filter.h"
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+
+    #include "flight/motors.h"
+    #include "flight/rpm_filter.h"
+
+    #include "sensors/gyro.h"
+
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+
+    gyro_t gyro;
+
+    void pgResetFn_rpmFilterConfig(rpmFilterConfig_t *config);
+
+    static uint8_t testMotorCount;
+    static int testMotorRPM[4];
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+
+/*
+ * Reference implementation: the original per-axis bank layout, one
+ * biquadFilter_t per axis, walked once per axis over all 16 banks.
+ */
+
+typedef struct {
+    uint8_t motorIndex;
+    float rpmRatio;
+    float minHz;
+    float maxHz;
+    float Q;
+    biquadFilter_t notch[XYZ_AXIS_COUNT];
+} refBank_t;
+
+static refBank_t refBank[RPM_FILTER_BANK_COUNT];
+static uint8_t refActiveCount;
+static uint8_t refCurrentBank;
+
+static void refInit(const rpmFilterConfig_t *config)
+{
+    memset(refBank, 0, sizeof(refBank));
+    refActiveCount = 0;
+    refCurrentBank = 0;
+
+    for (int bank = 0; bank < RPM_FILTER_BANK_COUNT; bank++) {
+        if (config->filter_bank_motor_index[bank] > 0 && config->filter_bank_motor_index[bank] <= testMotorCount) {
+            refBank_t *filt = &refBank[bank];
+            filt->motorIndex = config->filter_bank_motor_index[bank];
+            filt->rpmRatio   = constrainf(config->filter_bank_gear_ratio[bank], 1, 50000) / 1000 * 60;
+            filt->Q          = constrainf(config->filter_bank_notch_q[bank], 10, 10000) / 100;
+            filt->minHz      = constrainf(config->filter_bank_min_hz[bank], 20, 1000);
+            filt->maxHz      = constrainf(config->filter_bank_max_hz[bank], 100, 0.45e6 / gyro.targetLooptime);
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                biquadFilterInit(&filt->notch[axis], filt->minHz, gyro.targetLooptime, filt->Q, FILTER_NOTCH);
+            }
+            refCurrentBank = bank;
+            refActiveCount++;
+        }
+    }
+}
+
+static float refGyro(int axis, float value)
+{
+    if (refActiveCount > 0) {
+        for (int bank = 0; bank < RPM_FILTER_BANK_COUNT; bank++) {
+            if (refBank[bank].motorIndex) {
+                value = biquadFilterApplyDF1(&refBank[bank].notch[axis], value);
+            }
+        }
+    }
+    return value;
+}
+
+static void refUpdate(void)
+{
+    if (refActiveCount > 0) {
+        refBank_t *filt = &refBank[refCurrentBank];
+        float rpm  = getMotorRPM(filt->motorIndex - 1);
+        float freq = constrainf(rpm / filt->rpmRatio, filt->minHz, filt->maxHz);
+        biquadFilter_t *R = &filt->notch[0];
+        biquadFilter_t *P = &filt->notch[1];
+        biquadFilter_t *Y = &filt->notch[2];
+        biquadFilterUpdate(R, freq, gyro.targetLooptime, filt->Q, FILTER_NOTCH);
+        P->b0 = Y->b0 = R->b0;
+        P->b1 = Y->b1 = R->b1;
+        P->b2 = Y->b2 = R->b2;
+        P->a1 = Y->a1 = R->a1;
+        P->a2 = Y->a2 = R->a2;
+        do {
+            refCurrentBank = (refCurrentBank + 1) % RPM_FILTER_BANK_COUNT;
+        } while (refBank[refCurrentBank].motorIndex == 0);
+    }
+}
+
+
+static void setupConfig(rpmFilterConfig_t *config)
+{
+    pgResetFn_rpmFilterConfig(config);
+
+    // Typical heli setup, banks scattered over the table
+    config->filter_bank_motor_index[0]  = 1;    // main rotor 1x
+    config->filter_bank_gear_ratio[0]   = 10000;
+    config->filter_bank_motor_index[2]  = 1;    // main rotor 2x
+    config->filter_bank_gear_ratio[2]   = 5000;
+    config->filter_bank_motor_index[3]  = 1;    // motor
+    config->filter_bank_gear_ratio[3]   = 1000;
+    config->filter_bank_notch_q[3]      = 500;
+    config->filter_bank_motor_index[7]  = 2;    // tail rotor
+    config->filter_bank_gear_ratio[7]   = 2000;
+    config->filter_bank_motor_index[8]  = 2;
+    config->filter_bank_gear_ratio[8]   = 1000;
+    config->filter_bank_min_hz[8]       = 50;
+    config->filter_bank_motor_index[11] = 3;    // more than motor count, must be ignored
+    config->filter_bank_motor_index[15] = 1;
+    config->filter_bank_gear_ratio[15]  = 3333;
+
+    // The reference updates one bank per loop with the exact coefficients
+    config->filter_fast_update = 0;
+}
+
+static float randomSample(void)
+{
+    return (rand() % 4001 - 2000) * 0.25f;
+}
+
+class RpmFilterTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        srand(1234);
+        gyro.targetLooptime = 125;
+        testMotorCount = 2;
+        testMotorRPM[0] = 0;
+        testMotorRPM[1] = 0;
+        setupConfig(&config);
+        rpmFilterInit(&config);
+        refInit(&config);
+    }
+
+    rpmFilterConfig_t config;
+};
+
+TEST_F(RpmFilterTest, PackedBanksMatchReferenceBitExact)
+{
+    for (int loop = 0; loop < 20000; loop++) {
+        // Spool up the motors, with some noise on the rpm
+        testMotorRPM[0] = MIN(loop, 12000) + rand() % 50;
+        testMotorRPM[1] = MIN(loop * 3, 40000) + rand() % 200;
+
+        rpmFilterUpdate(0);
+        refUpdate();
+
+        float values[XYZ_AXIS_COUNT];
+        float expected[XYZ_AXIS_COUNT];
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            values[axis] = randomSample();
+            expected[axis] = refGyro(axis, values[axis]);
+        }
+
+        rpmFilterGyroAxes(values);
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            ASSERT_EQ(0, memcmp(&expected[axis], &values[axis], sizeof(float))) << "loop " << loop << " axis " << axis;
+        }
+    }
+}
+
+TEST_F(RpmFilterTest, SingleAxisMatchesReferenceBitExact)
+{
+    for (int loop = 0; loop < 5000; loop++) {
+        testMotorRPM[0] = 9000 + rand() % 1000;
+        testMotorRPM[1] = 30000 + rand() % 4000;
+
+        rpmFilterUpdate(0);
+        refUpdate();
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            const float sample = randomSample();
+            const float expected = refGyro(axis, sample);
+            const float value = rpmFilterGyro(axis, sample);
+            ASSERT_EQ(0, memcmp(&expected, &value, sizeof(float))) << "loop " << loop << " axis " << axis;
+        }
+    }
+}
+
+TEST_F(RpmFilterTest, NoActiveBanksPassThrough)
+{
+    pgResetFn_rpmFilterConfig(&config);
+    rpmFilterInit(&config);
+
+    float values[XYZ_AXIS_COUNT] = { 1.5f, -2.5f, 100.0f };
+    rpmFilterUpdate(0);
+    rpmFilterGyroAxes(values);
+
+    EXPECT_EQ(1.5f, values[FD_ROLL]);
+    EXPECT_EQ(-2.5f, values[FD_PITCH]);
+    EXPECT_EQ(100.0f, values[FD_YAW]);
+    EXPECT_EQ(7.0f, rpmFilterGyro(FD_YAW, 7.0f));
+}
+
+// The notch coefficients in double precision, as in biquadFilterInit()
+static void exactNotchCoeffs(double freq, double Q, double *b0, double *b1, double *a2)
+{
+    const double omega = 2 * M_PI * freq * gyro.targetLooptime * 1e-6;
+    const double alpha = sin(omega) / (2 * Q);
+
+    *b0 = 1 / (1 + alpha);
+    *b1 = -2 * cos(omega) / (1 + alpha);
+    *a2 = (1 - alpha) / (1 + alpha);
+}
+
+static double coeffError(int bank, double freq, double Q)
+{
+    double b0, b1, a2;
+    float fb0, fb1, fa2;
+
+    exactNotchCoeffs(freq, Q, &b0, &b1, &a2);
+    rpmFilterGetNotchCoeffs(bank, &fb0, &fb1, &fa2);
+
+    return fmax(fabs(fb0 - b0), fmax(fabs(fb1 - b1), fabs(fa2 - a2)));
+}
+
+TEST_F(RpmFilterTest, FastCoefficientsWithinErrorBound)
+{
+    const uint16_t looptimes[] = { 125, 250, 500 };
+    const uint16_t notchQ[] = { 10, 250, 1000, 10000 };
+
+    double fastMax = 0, exactMax = 0;
+
+    for (unsigned lt = 0; lt < ARRAYLEN(looptimes); lt++) {
+        for (unsigned q = 0; q < ARRAYLEN(notchQ); q++) {
+            gyro.targetLooptime = looptimes[lt];
+
+            // Motor rpm is the notch frequency in Hz * 60
+            pgResetFn_rpmFilterConfig(&config);
+            config.filter_bank_motor_index[0] = 1;
+            config.filter_bank_notch_q[0] = notchQ[q];
+            config.filter_bank_max_hz[0] = 0.45e6 / gyro.targetLooptime;
+            const double Q = notchQ[q] / 100.0;
+            const int maxRpm = config.filter_bank_max_hz[0] * 60;
+
+            for (int rpm = 20 * 60; rpm <= maxRpm; rpm += 31) {
+                testMotorRPM[0] = rpm;
+
+                config.filter_fast_update = 1;
+                rpmFilterInit(&config);
+                rpmFilterUpdate(0);
+                const double fastError = coeffError(0, rpm / 60.0f, Q);
+
+                config.filter_fast_update = 0;
+                rpmFilterInit(&config);
+                rpmFilterUpdate(0);
+                const double exactError = coeffError(0, rpm / 60.0f, Q);
+
+                ASSERT_LT(fastError, 5e-6) << "looptime " << looptimes[lt] << " Q " << Q << " rpm " << rpm;
+
+                fastMax = fmax(fastMax, fastError);
+                exactMax = fmax(exactMax, exactError);
+            }
+        }
+    }
+
+    // The table is built with sin_approx(), so the fast path is about as good as the exact one
+    EXPECT_LT(fastMax, 2 * exactMax);
+
+    printf("[ RPM      ] max coefficient error, fast: %.2e, sin_approx: %.2e\n", fastMax, exactMax);
+}
+
+TEST_F(RpmFilterTest, FastUpdateRefreshesAllBanks)
+{
+    config.filter_fast_update = 1;
+    rpmFilterInit(&config);
+
+    testMotorRPM[0] = 15000;
+    testMotorRPM[1] = 45000;
+    rpmFilterUpdate(0);
+
+    // Active banks in config order: 0, 2, 3, 7, 8, 15
+    EXPECT_LT(coeffError(0, 15000 / 600.0f, 2.5), 1e-5);
+    EXPECT_LT(coeffError(1, 15000 / 300.0f, 2.5), 1e-5);
+    EXPECT_LT(coeffError(2, 15000 / 60.0f, 5.0), 1e-5);
+    EXPECT_LT(coeffError(3, 45000 / 120.0f, 2.5), 1e-5);
+    EXPECT_LT(coeffError(4, 45000 / 60.0f, 2.5), 1e-5);
+    EXPECT_LT(coeffError(5, 15000 / (3.333f * 60), 2.5), 1e-5);
+
+    // The exact path has only reached the first bank
+    config.filter_fast_update = 0;
+    rpmFilterInit(&config);
+    rpmFilterUpdate(0);
+
+    EXPECT_GT(coeffError(0, 15000 / 600.0f, 2.5), 1e-3);
+    EXPECT_LT(coeffError(5, 15000 / (3.333f * 60), 2.5), 1e-5);
+}
+
+static double elapsedNs(const struct timespec *start, const struct timespec *end)
+{
+    return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+TEST_F(RpmFilterTest, TimingComparison)
+{
+    const int loops = 200000;
+    static float samples[1024][XYZ_AXIS_COUNT];
+    volatile float sink = 0;
+    struct timespec t0, t1, t2;
+
+    for (int i = 0; i < 1024; i++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            samples[i][axis] = randomSample();
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int loop = 0; loop < loops; loop++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            sink = refGyro(axis, samples[loop & 1023][axis]);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    for (int loop = 0; loop < loops; loop++) {
+        float values[XYZ_AXIS_COUNT] = { samples[loop & 1023][0], samples[loop & 1023][1], samples[loop & 1023][2] };
+        rpmFilterGyroAxes(values);
+        sink = values[FD_YAW];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t2);
+    UNUSED(sink);
+
+    // Informational only; host timings are not stable enough to assert on
+    printf("[ RPM      ] per-axis reference: %.1f ns/sample, packed 3-axis: %.1f ns/sample\n",
+           elapsedNs(&t0, &t1) / loops, elapsedNs(&t1, &t2) / loops);
+}
+
+
+// STUBS
+
+extern "C" {
+
+uint8_t getMotorCount(void) { return testMotorCount; }
+int getMotorRPM(uint8_t motor) { return testMotorRPM[motor]; }
+float getMotorRPMAt(uint8_t motor, timeUs_t) { return testMotorRPM[motor]; }
+
+}
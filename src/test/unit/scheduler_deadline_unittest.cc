@@ -0,0 +1,379 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+    #include "common/utils.h"
+
+    #include "scheduler/scheduler.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+/*
+ * The scheduler built with USE_SCHEDULER_DEADLINE_QUEUE, checked pass by
+ * pass against the linear priority scan it replaces.
+ */
+
+#define TASK_PERIOD_HZ(hz) (1000000 / (hz))
+
+extern "C" {
+    extern task_t *unittest_scheduler_selectedTask;
+    extern uint16_t unittest_scheduler_waitingTasks;
+
+    uint32_t simulatedTime = 0;
+    uint32_t micros(void) { return simulatedTime; }
+
+    static uint32_t taskRunSeed = 1;
+    static uint32_t taskRuns[TASK_COUNT];
+
+    static uint32_t nextRandom(uint32_t *seed)
+    {
+        *seed ^= *seed << 13;
+        *seed ^= *seed >> 17;
+        *seed ^= *seed << 5;
+        return *seed;
+    }
+
+    // Every task takes a pseudo random 5..60us
+    static void taskRun(int taskId)
+    {
+        simulatedTime += 5 + nextRandom(&taskRunSeed) % 56;
+        taskRuns[taskId]++;
+    }
+
+    bool gyroFilterReady(void) { return false; }
+    bool pidLoopReady(void) { return false; }
+    void taskGyroSample(timeUs_t) { }
+    void taskFiltering(timeUs_t) { }
+    void taskMainPidLoop(timeUs_t) { }
+    void taskMain(timeUs_t) { taskRun(TASK_MAIN); }
+    void taskUpdateAccelerometer(timeUs_t) { taskRun(TASK_ACCEL); }
+    void imuUpdateAttitude(timeUs_t) { taskRun(TASK_ATTITUDE); }
+    void taskUpdateRxMain(timeUs_t) { taskRun(TASK_RX); }
+    void taskHandleSerial(timeUs_t) { taskRun(TASK_SERIAL); }
+    void dispatchProcess(timeUs_t) { taskRun(TASK_DISPATCH); }
+    void taskUpdateBatteryVoltage(timeUs_t) { taskRun(TASK_BATTERY_VOLTAGE); }
+    void taskUpdateBatteryCurrent(timeUs_t) { taskRun(TASK_BATTERY_CURRENT); }
+    void taskBatteryAlerts(timeUs_t) { taskRun(TASK_BATTERY_ALERTS); }
+
+    // Event checks depend on time only, so the reference scan can call them too
+    static bool eventFlood = false;
+    bool rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t) { return eventFlood || (currentTimeUs / 1300) % 4 == 0; }
+    bool dispatchCheck(timeUs_t currentTimeUs, timeDelta_t) { return eventFlood || (currentTimeUs / 700) % 3 == 1; }
+    bool alertsCheck(timeUs_t, timeDelta_t currentDeltaTimeUs) { return currentDeltaTimeUs > 30000; }
+
+    extern int taskQueueSize;
+    extern task_t* taskQueueArray[];
+
+    task_t tasks[TASK_COUNT] = {
+        [TASK_SYSTEM] = {
+            .taskName = "SYSTEM",
+            .taskFunc = taskSystemLoad,
+            .desiredPeriodUs = TASK_PERIOD_HZ(10),
+            .staticPriority = TASK_PRIORITY_MEDIUM_HIGH,
+        },
+        [TASK_MAIN] = {
+            .taskName = "MAIN",
+            .taskFunc = taskMain,
+            .desiredPeriodUs = TASK_PERIOD_HZ(1000),
+            .staticPriority = TASK_PRIORITY_MEDIUM_HIGH,
+        },
+        [TASK_GYRO] = {
+            .taskName = "GYRO",
+            .taskFunc = taskGyroSample,
+            .desiredPeriodUs = TASK_PERIOD_HZ(8000),
+            .staticPriority = TASK_PRIORITY_REALTIME,
+        },
+        [TASK_FILTER] = {
+            .taskName = "FILTER",
+            .taskFunc = taskFiltering,
+            .desiredPeriodUs = TASK_PERIOD_HZ(4000),
+            .staticPriority = TASK_PRIORITY_REALTIME,
+        },
+        [TASK_PID] = {
+            .taskName = "PID",
+            .taskFunc = taskMainPidLoop,
+            .desiredPeriodUs = TASK_PERIOD_HZ(4000),
+            .staticPriority = TASK_PRIORITY_REALTIME,
+        },
+        [TASK_ACCEL] = {
+            .taskName = "ACCEL",
+            .taskFunc = taskUpdateAccelerometer,
+            .desiredPeriodUs = TASK_PERIOD_HZ(1000),
+            .staticPriority = TASK_PRIORITY_MEDIUM,
+        },
+        [TASK_ATTITUDE] = {
+            .taskName = "ATTITUDE",
+            .taskFunc = imuUpdateAttitude,
+            .desiredPeriodUs = TASK_PERIOD_HZ(100),
+            .staticPriority = TASK_PRIORITY_MEDIUM,
+        },
+        [TASK_RX] = {
+            .taskName = "RX",
+            .checkFunc = rxUpdateCheck,
+            .taskFunc = taskUpdateRxMain,
+            .desiredPeriodUs = TASK_PERIOD_HZ(50),
+            .staticPriority = TASK_PRIORITY_HIGH,
+        },
+        [TASK_SERIAL] = {
+            .taskName = "SERIAL",
+            .taskFunc = taskHandleSerial,
+            .desiredPeriodUs = TASK_PERIOD_HZ(100),
+            .staticPriority = TASK_PRIORITY_LOW,
+        },
+        [TASK_DISPATCH] = {
+            .taskName = "DISPATCH",
+            .checkFunc = dispatchCheck,
+            .taskFunc = dispatchProcess,
+            .desiredPeriodUs = TASK_PERIOD_HZ(1000),
+            .staticPriority = TASK_PRIORITY_HIGH,
+        },
+        [TASK_BATTERY_VOLTAGE] = {
+            .taskName = "BATTERY_VOLTAGE",
+            .taskFunc = taskUpdateBatteryVoltage,
+            .desiredPeriodUs = TASK_PERIOD_HZ(50),
+            .staticPriority = TASK_PRIORITY_MEDIUM,
+        },
+        [TASK_BATTERY_CURRENT] = {
+            .taskName = "BATTERY_CURRENT",
+            .taskFunc = taskUpdateBatteryCurrent,
+            .desiredPeriodUs = TASK_PERIOD_HZ(50),
+            .staticPriority = TASK_PRIORITY_MEDIUM,
+        },
+        [TASK_BATTERY_ALERTS] = {
+            .taskName = "BATTERY_ALERTS",
+            .checkFunc = alertsCheck,
+            .taskFunc = taskBatteryAlerts,
+            .desiredPeriodUs = TASK_PERIOD_HZ(5),
+            .staticPriority = TASK_PRIORITY_LOW,
+        },
+    };
+
+    task_t *getTask(unsigned taskId)
+    {
+        return &tasks[taskId];
+    }
+}
+
+
+/*
+ * Reference: the linear scan over the whole task queue, as in scheduler()
+ * without the deadline queue. It works on its own copy of the dynamic
+ * task state so it can run just before the real scheduler pass.
+ */
+
+typedef struct {
+    uint16_t dynamicPriority;
+    uint16_t taskAgeCycles;
+    timeUs_t lastSignaledAtUs;
+} refState_t;
+
+static refState_t refState[TASK_COUNT];
+
+static void refSnapshot(void)
+{
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        refState[taskId].dynamicPriority = tasks[taskId].dynamicPriority;
+        refState[taskId].taskAgeCycles = tasks[taskId].taskAgeCycles;
+        refState[taskId].lastSignaledAtUs = tasks[taskId].lastSignaledAtUs;
+    }
+}
+
+static task_t *refSelect(timeUs_t currentTimeUs, uint16_t *waitingTasks)
+{
+    task_t *selectedTask = NULL;
+    uint16_t selectedTaskDynamicPriority = 0;
+
+    for (int ii = 0; ii < taskQueueSize; ii++) {
+        task_t *task = taskQueueArray[ii];
+        refState_t *ref = &refState[task - tasks];
+
+        if (task->staticPriority == TASK_PRIORITY_REALTIME) {
+            continue;
+        }
+
+        if (task->checkFunc) {
+            if (ref->dynamicPriority > 0) {
+                ref->taskAgeCycles = 1 + ((currentTimeUs - ref->lastSignaledAtUs) / task->desiredPeriodUs);
+                ref->dynamicPriority = 1 + task->staticPriority * ref->taskAgeCycles;
+                (*waitingTasks)++;
+            } else if (task->checkFunc(currentTimeUs, cmpTimeUs(currentTimeUs, task->lastExecutedAtUs))) {
+                ref->lastSignaledAtUs = currentTimeUs;
+                ref->taskAgeCycles = 1;
+                ref->dynamicPriority = 1 + task->staticPriority;
+                (*waitingTasks)++;
+            } else {
+                ref->taskAgeCycles = 0;
+            }
+        } else {
+            ref->taskAgeCycles = ((currentTimeUs - task->lastExecutedAtUs) / task->desiredPeriodUs);
+            if (ref->taskAgeCycles > 0) {
+                ref->dynamicPriority = 1 + task->staticPriority * ref->taskAgeCycles;
+                (*waitingTasks)++;
+            }
+        }
+
+        if (ref->dynamicPriority > selectedTaskDynamicPriority) {
+            selectedTaskDynamicPriority = ref->dynamicPriority;
+            selectedTask = task;
+        }
+    }
+
+    return selectedTask;
+}
+
+
+static const taskId_e testTasks[] = {
+    TASK_SYSTEM, TASK_MAIN, TASK_ACCEL, TASK_ATTITUDE, TASK_RX, TASK_SERIAL, TASK_DISPATCH,
+    TASK_BATTERY_VOLTAGE, TASK_BATTERY_CURRENT, TASK_BATTERY_ALERTS,
+};
+
+class SchedulerDeadlineTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        simulatedTime = 1000;
+        taskRunSeed = 1;
+        queueClearTasks();
+        for (unsigned ii = 0; ii < ARRAYLEN(testTasks); ii++) {
+            task_t *task = getTask(testTasks[ii]);
+            task->lastExecutedAtUs = 0;
+            task->lastSignaledAtUs = 0;
+            task->dynamicPriority = 0;
+            task->taskAgeCycles = 0;
+            setTaskEnabled(testTasks[ii], true);
+        }
+        memset(taskRuns, 0, sizeof(taskRuns));
+        eventFlood = false;
+    }
+
+    void queueClearTasks(void) {
+        schedulerInit();
+        for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+            setTaskEnabled(static_cast<taskId_e>(taskId), false);
+        }
+    }
+
+    // One scheduler pass, checked against the reference scan
+    void checkedPass(void) {
+        uint16_t expectedWaiting = 0;
+        refSnapshot();
+        task_t *expected = refSelect(simulatedTime, &expectedWaiting);
+
+        scheduler();
+
+        ASSERT_EQ(expected, unittest_scheduler_selectedTask) << "at " << simulatedTime;
+        ASSERT_EQ(expectedWaiting, unittest_scheduler_waitingTasks) << "at " << simulatedTime;
+        for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+            if (&tasks[taskId] != expected) {
+                ASSERT_EQ(refState[taskId].dynamicPriority, tasks[taskId].dynamicPriority) << "task " << taskId << " at " << simulatedTime;
+            }
+        }
+    }
+};
+
+TEST_F(SchedulerDeadlineTest, SameSelectionAsLinearScan)
+{
+    uint32_t seed = 12345;
+
+    for (int pass = 0; pass < 200000; pass++) {
+        checkedPass();
+        if (HasFatalFailure()) {
+            return;
+        }
+        simulatedTime += nextRandom(&seed) % 40;
+    }
+
+    // Every task got to run
+    for (unsigned ii = 0; ii < ARRAYLEN(testTasks); ii++) {
+        if (testTasks[ii] != TASK_SYSTEM) {
+            EXPECT_GT(taskRuns[testTasks[ii]], 0u) << "task " << testTasks[ii];
+        }
+    }
+}
+
+TEST_F(SchedulerDeadlineTest, SameSelectionWithQueueChanges)
+{
+    uint32_t seed = 777;
+
+    for (int pass = 0; pass < 200000; pass++) {
+        checkedPass();
+        if (HasFatalFailure()) {
+            return;
+        }
+
+        // Change the period of the task that just ran, its priority is zero
+        // again so the linear scan has no stale priority to act on
+        if (unittest_scheduler_selectedTask && nextRandom(&seed) % 16 == 0) {
+            rescheduleTask(static_cast<taskId_e>(unittest_scheduler_selectedTask - tasks), 500 + nextRandom(&seed) % 20000);
+        }
+
+        if (nextRandom(&seed) % 2000 == 0) {
+            const taskId_e taskId = testTasks[nextRandom(&seed) % ARRAYLEN(testTasks)];
+            taskInfo_t info;
+            getTaskInfo(taskId, &info);
+            setTaskEnabled(taskId, !info.isEnabled);
+        }
+
+        simulatedTime += nextRandom(&seed) % 40;
+    }
+}
+
+TEST_F(SchedulerDeadlineTest, SameSelectionOverTimerWrap)
+{
+    uint32_t seed = 4242;
+
+    simulatedTime = UINT32_MAX - 500000;
+    for (unsigned ii = 0; ii < ARRAYLEN(testTasks); ii++) {
+        getTask(testTasks[ii])->lastExecutedAtUs = simulatedTime;
+    }
+    queueClearTasks();
+    for (unsigned ii = 0; ii < ARRAYLEN(testTasks); ii++) {
+        setTaskEnabled(testTasks[ii], true);
+    }
+
+    for (int pass = 0; pass < 100000; pass++) {
+        checkedPass();
+        if (HasFatalFailure()) {
+            return;
+        }
+        simulatedTime += nextRandom(&seed) % 40;
+    }
+}
+
+TEST_F(SchedulerDeadlineTest, LowPriorityTaskNotStarved)
+{
+    // The high priority event tasks are signalled on every pass
+    eventFlood = true;
+
+    for (int pass = 0; pass < 20000; pass++) {
+        checkedPass();
+        if (HasFatalFailure()) {
+            return;
+        }
+    }
+
+    EXPECT_GT(taskRuns[TASK_SERIAL], 0u);
+    EXPECT_GT(taskRuns[TASK_ATTITUDE], 0u);
+    EXPECT_GT(taskRuns[TASK_BATTERY_ALERTS], 0u);
+}
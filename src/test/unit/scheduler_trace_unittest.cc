@@ -0,0 +1,269 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+    #include "common/utils.h"
+
+    #include "scheduler/scheduler.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+/*
+ * The scheduler built with USE_SCHEDULER_TRACE and a small trace ring.
+ */
+
+#define TASK_PERIOD_HZ(hz) (1000000 / (hz))
+
+#define GYRO_RUN_US     8
+#define MAIN_RUN_US     20
+#define SERIAL_RUN_US   30
+
+extern "C" {
+    uint32_t simulatedTime = 0;
+    uint32_t micros(void) { return simulatedTime; }
+
+    static void taskGyro(timeUs_t) { simulatedTime += GYRO_RUN_US; }
+    static void taskMainRun(timeUs_t) { simulatedTime += MAIN_RUN_US; }
+    static void taskSerialRun(timeUs_t) { simulatedTime += SERIAL_RUN_US; }
+    static void taskIdle(timeUs_t) { }
+
+    bool gyroFilterReady(void) { return false; }
+    bool pidLoopReady(void) { return false; }
+
+// Positional, so the table also builds with compilers that lack array designators
+#if defined(USE_SCHEDULER_DEADLINE_QUEUE)
+#define TEST_TASK_QUEUE_FIELDS  0, 0,
+#else
+#define TEST_TASK_QUEUE_FIELDS
+#endif
+
+#define TEST_TASK(name, func, hz, priority) \
+    { name, NULL, NULL, func, TASK_PERIOD_HZ(hz), priority, 0, 0, 0, 0, 0, 0, TEST_TASK_QUEUE_FIELDS 0, 0, 0, 0, 0 }
+
+    task_t tasks[TASK_COUNT] = {
+        TEST_TASK("SYSTEM", taskSystemLoad, 10, TASK_PRIORITY_MEDIUM_HIGH),
+        TEST_TASK("MAIN", taskMainRun, 1000, TASK_PRIORITY_MEDIUM_HIGH),
+        TEST_TASK("GYRO", taskGyro, 8000, TASK_PRIORITY_REALTIME),
+        TEST_TASK("FILTER", taskIdle, 4000, TASK_PRIORITY_REALTIME),
+        TEST_TASK("PID", taskIdle, 4000, TASK_PRIORITY_REALTIME),
+        TEST_TASK("ACCEL", taskIdle, 1000, TASK_PRIORITY_MEDIUM),
+        TEST_TASK("ATTITUDE", taskIdle, 100, TASK_PRIORITY_MEDIUM),
+        TEST_TASK("RX", taskIdle, 50, TASK_PRIORITY_HIGH),
+        TEST_TASK("SERIAL", taskSerialRun, 100, TASK_PRIORITY_LOW),
+        TEST_TASK("DISPATCH", taskIdle, 1000, TASK_PRIORITY_HIGH),
+        TEST_TASK("BATTERY_VOLTAGE", taskIdle, 50, TASK_PRIORITY_MEDIUM),
+        TEST_TASK("BATTERY_CURRENT", taskIdle, 50, TASK_PRIORITY_MEDIUM),
+        TEST_TASK("BATTERY_ALERTS", taskIdle, 5, TASK_PRIORITY_MEDIUM),
+    };
+
+    task_t *getTask(unsigned taskId)
+    {
+        return &tasks[taskId];
+    }
+}
+
+class SchedulerTraceTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        simulatedTime = 10000;
+        schedulerInit();
+        for (int taskId = 0; taskId < TASK_COUNT; ++taskId) {
+            setTaskEnabled(static_cast<taskId_e>(taskId), false);
+            tasks[taskId].lastExecutedAtUs = simulatedTime;
+            tasks[taskId].lastDesiredAt = simulatedTime;
+            tasks[taskId].dynamicPriority = 0;
+            tasks[taskId].movingSumExecutionTimeUs = 0;
+        }
+        schedulerTraceStop();
+    }
+
+    // Runs the scheduler every passUs for durationUs
+    void runFor(timeUs_t durationUs, timeUs_t passUs) {
+        const timeUs_t endUs = simulatedTime + durationUs;
+        while (cmpTimeUs(endUs, simulatedTime) > 0) {
+            scheduler();
+            simulatedTime += passUs;
+        }
+    }
+
+    void getEvent(int index, schedulerTraceEvent_t *event) {
+        ASSERT_TRUE(schedulerTraceGetEvent(index, event)) << "event " << index;
+    }
+};
+
+TEST_F(SchedulerTraceTest, NothingRecordedWhenStopped)
+{
+    setTaskEnabled(TASK_MAIN, true);
+
+    runFor(10000, 10);
+
+    EXPECT_FALSE(schedulerTraceIsRunning());
+    EXPECT_EQ(0, schedulerTraceCount());
+}
+
+TEST_F(SchedulerTraceTest, RecordsTaskRuns)
+{
+    setTaskEnabled(TASK_MAIN, true);
+    setTaskEnabled(TASK_SERIAL, true);
+    schedulerTraceStart(0);
+
+    runFor(30500, 10);
+
+    // 1kHz and 100Hz tasks
+    const int count = schedulerTraceCount();
+    EXPECT_GE(count, 32);
+    EXPECT_LE(count, 34);
+
+    int serialRuns = 0;
+    schedulerTraceEvent_t previous = { 0, 0, 0, 0 };
+    for (int i = 0; i < count; i++) {
+        schedulerTraceEvent_t event;
+        getEvent(i, &event);
+        if (i > 0) {
+            EXPECT_GE(cmpTimeUs(event.startUs, previous.startUs), (timeDelta_t)previous.durationUs);
+        }
+
+        ASSERT_TRUE(event.taskId == TASK_MAIN || event.taskId == TASK_SERIAL);
+        EXPECT_EQ(event.taskId == TASK_MAIN ? MAIN_RUN_US : SERIAL_RUN_US, event.durationUs);
+        EXPECT_EQ(0, event.flags);
+
+        if (event.taskId == TASK_SERIAL) {
+            serialRuns++;
+        }
+        previous = event;
+    }
+    EXPECT_EQ(3, serialRuns);
+
+    schedulerTraceEvent_t event;
+    EXPECT_FALSE(schedulerTraceGetEvent(count, &event));
+    EXPECT_FALSE(schedulerTraceGetEvent(-1, &event));
+}
+
+TEST_F(SchedulerTraceTest, RingKeepsLatestEvents)
+{
+    setTaskEnabled(TASK_MAIN, true);
+    schedulerTraceStart(0);
+
+    runFor(SCHEDULER_TRACE_SIZE * 3 * 1000 + 500, 10);
+
+    ASSERT_EQ(SCHEDULER_TRACE_SIZE, schedulerTraceCount());
+
+    // One run per ms, the newest at the end
+    schedulerTraceEvent_t first, last;
+    getEvent(0, &first);
+    getEvent(SCHEDULER_TRACE_SIZE - 1, &last);
+    EXPECT_EQ(tasks[TASK_MAIN].lastExecutedAtUs, last.startUs);
+    EXPECT_NEAR((SCHEDULER_TRACE_SIZE - 1) * 1000, cmpTimeUs(last.startUs, first.startUs), 10);
+
+    for (int i = 1; i < SCHEDULER_TRACE_SIZE; i++) {
+        schedulerTraceEvent_t prev, event;
+        getEvent(i - 1, &prev);
+        getEvent(i, &event);
+        EXPECT_GT(cmpTimeUs(event.startUs, prev.startUs), 0);
+    }
+}
+
+TEST_F(SchedulerTraceTest, StartClearsTrace)
+{
+    setTaskEnabled(TASK_MAIN, true);
+    schedulerTraceStart(0);
+    runFor(10000, 10);
+    EXPECT_GT(schedulerTraceCount(), 0);
+
+    schedulerTraceStop();
+    const int count = schedulerTraceCount();
+    runFor(10000, 10);
+    EXPECT_EQ(count, schedulerTraceCount());
+
+    schedulerTraceStart(0);
+    EXPECT_TRUE(schedulerTraceIsRunning());
+    EXPECT_EQ(0, schedulerTraceCount());
+}
+
+// The gyro stays enabled from here on
+
+TEST_F(SchedulerTraceTest, GuardSkipRecorded)
+{
+    schedulerEnableGyro();
+    setTaskEnabled(TASK_GYRO, true);
+    setTaskEnabled(TASK_MAIN, true);
+    schedulerTraceStart(0);
+
+    // Gyro due now
+    tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime - TASK_PERIOD_HZ(8000);
+    scheduler();
+
+    // MAIN is due, but looks too long to fit before the next gyro run
+    simulatedTime += 30;
+    tasks[TASK_MAIN].movingSumExecutionTimeUs = TASK_STATS_MOVING_SUM_COUNT * 100;
+    tasks[TASK_MAIN].lastExecutedAtUs = simulatedTime - 2000;
+    scheduler();
+
+    ASSERT_EQ(2, schedulerTraceCount());
+
+    schedulerTraceEvent_t event;
+    getEvent(0, &event);
+    EXPECT_EQ(TASK_GYRO, event.taskId);
+    EXPECT_EQ(GYRO_RUN_US, event.durationUs);
+    EXPECT_EQ(0, event.flags);
+
+    getEvent(1, &event);
+    EXPECT_EQ(TASK_MAIN, event.taskId);
+    EXPECT_EQ(simulatedTime, event.startUs);
+    EXPECT_EQ(0, event.durationUs);
+    EXPECT_EQ(SCHEDULER_TRACE_GUARD_SKIPPED, event.flags);
+}
+
+TEST_F(SchedulerTraceTest, LateGyroStopsTrace)
+{
+    schedulerEnableGyro();
+    setTaskEnabled(TASK_GYRO, true);
+    schedulerTraceStart(50);
+
+    // On time
+    tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime - TASK_PERIOD_HZ(8000);
+    runFor(TASK_PERIOD_HZ(8000) * 10, 1);
+    const int onTime = schedulerTraceCount();
+    EXPECT_GE(onTime, 9);
+    EXPECT_TRUE(schedulerTraceIsRunning());
+
+    // 100us late
+    tasks[TASK_GYRO].lastExecutedAtUs = simulatedTime - TASK_PERIOD_HZ(8000) - 100;
+    scheduler();
+    EXPECT_EQ(onTime + 1, schedulerTraceCount());
+
+    schedulerTraceEvent_t event;
+    getEvent(onTime, &event);
+    EXPECT_EQ(TASK_GYRO, event.taskId);
+    EXPECT_EQ(SCHEDULER_TRACE_LATE_GYRO, event.flags);
+
+    // Half a ring after the late run
+    runFor(TASK_PERIOD_HZ(8000) * SCHEDULER_TRACE_SIZE, 1);
+    EXPECT_FALSE(schedulerTraceIsRunning());
+    EXPECT_EQ(onTime + SCHEDULER_TRACE_SIZE / 2, schedulerTraceCount());
+
+    getEvent(schedulerTraceCount() - SCHEDULER_TRACE_SIZE / 2, &event);
+    EXPECT_EQ(SCHEDULER_TRACE_LATE_GYRO, event.flags);
+}
@@ -0,0 +1,173 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <vector>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/sdft.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define R   0.9999
+
+/*
+ * Reference: the damped DFT of the last SDFT_SAMPLE_SIZE samples computed
+ * directly, X_k = sum r^(i+1) e^(j2pik(i+1)/N) x(n-i), Hann windowed from
+ * the neighbour bins as sdftWinSq() does.
+ */
+static double refWinSq(const std::vector<float> &x, int bin)
+{
+    double re[3] = { 0, 0, 0 };
+    double im[3] = { 0, 0, 0 };
+
+    for (int k = 0; k < 3; k++) {
+        for (int i = 0; i < SDFT_SAMPLE_SIZE && i < (int)x.size(); i++) {
+            const double phi = 2 * M_PI * (bin - 1 + k) * (i + 1) / SDFT_SAMPLE_SIZE;
+            const double gain = pow(R, i + 1) * x[x.size() - 1 - i];
+            re[k] += gain * cos(phi);
+            im[k] += gain * sin(phi);
+        }
+    }
+
+    const double wre = 0.5 * re[1] - 0.25 * (re[0] + re[2]);
+    const double wim = 0.5 * im[1] - 0.25 * (im[0] + im[2]);
+
+    return wre * wre + wim * wim;
+}
+
+static float randomSample(void)
+{
+    return (rand() % 20001 - 10000) / 10.0f;
+}
+
+TEST(SdftUnittest, MatchesDirectDft)
+{
+    sdft_t sdft;
+    std::vector<float> x;
+    float output[SDFT_BIN_COUNT + 1];
+
+    srand(1);
+    sdftInit(&sdft, 2, SDFT_BIN_COUNT - 1, 1);
+
+    for (int n = 0; n < 1000; n++) {
+        x.push_back(randomSample());
+        sdftPush(&sdft, x.back());
+
+        if (n == 10 || n % 97 == 0) {
+            sdftWinSq(&sdft, output);
+            for (int bin = 2; bin <= SDFT_BIN_COUNT - 1; bin++) {
+                const double ref = refWinSq(x, bin);
+                EXPECT_NEAR(ref, output[bin], 1e-3 * ref + 1.0) << "sample " << n << " bin " << bin;
+            }
+        }
+    }
+}
+
+TEST(SdftUnittest, StaysStableOverLongRuns)
+{
+    sdft_t sdft;
+    std::vector<float> x;
+    float output[SDFT_BIN_COUNT + 1];
+
+    srand(2);
+    sdftInit(&sdft, 1, SDFT_BIN_COUNT - 1, 1);
+
+    for (int n = 0; n < 2000000; n++) {
+        sdftPush(&sdft, randomSample());
+    }
+
+    // Fill the window again with known data
+    for (int n = 0; n < SDFT_SAMPLE_SIZE; n++) {
+        x.push_back(randomSample());
+        sdftPush(&sdft, x.back());
+    }
+
+    sdftWinSq(&sdft, output);
+    for (int bin = 1; bin <= SDFT_BIN_COUNT - 1; bin++) {
+        const double ref = refWinSq(x, bin);
+        EXPECT_NEAR(ref, output[bin], 1e-2 * ref + 10.0) << "bin " << bin;
+    }
+}
+
+TEST(SdftUnittest, BatchesMatchSinglePush)
+{
+    sdft_t single, batched;
+    float singleOutput[SDFT_BIN_COUNT + 1];
+    float batchedOutput[SDFT_BIN_COUNT + 1];
+
+    srand(3);
+
+    for (int numBatches = 1; numBatches <= 8; numBatches++) {
+        sdftInit(&single, 5, 20, 1);
+        sdftInit(&batched, 5, 20, numBatches);
+
+        EXPECT_GE(batched.batchSize * batched.numBatches, 20 - 5 + 3);
+
+        for (int n = 0; n < 300; n++) {
+            const float sample = randomSample();
+
+            sdftPush(&single, sample);
+            for (int batch = 0; batch < batched.numBatches; batch++) {
+                sdftPushBatch(&batched, sample, batch);
+            }
+        }
+
+        sdftWinSq(&single, singleOutput);
+        sdftWinSq(&batched, batchedOutput);
+
+        for (int bin = 5; bin <= 20; bin++) {
+            EXPECT_FLOAT_EQ(singleOutput[bin], batchedOutput[bin]) << "batches " << numBatches << " bin " << bin;
+        }
+    }
+}
+
+TEST(SdftUnittest, SinePeaksAtItsBin)
+{
+    sdft_t sdft;
+    float output[SDFT_BIN_COUNT + 1];
+
+    for (int bin = 3; bin <= SDFT_BIN_COUNT - 2; bin++) {
+        sdftInit(&sdft, 2, SDFT_BIN_COUNT - 1, 1);
+
+        for (int n = 0; n < 4 * SDFT_SAMPLE_SIZE; n++) {
+            sdftPush(&sdft, 100 * sinf(2 * M_PIf * bin * n / SDFT_SAMPLE_SIZE));
+        }
+
+        sdftWinSq(&sdft, output);
+
+        int peak = 2;
+        for (int i = 2; i <= SDFT_BIN_COUNT - 1; i++) {
+            if (output[i] > output[peak]) {
+                peak = i;
+            }
+        }
+        EXPECT_EQ(bin, peak);
+
+        // Hann window leaks into the neighbours only
+        EXPECT_NEAR(output[bin - 1], output[bin] / 4, output[bin] * 0.01f);
+        EXPECT_LT(output[bin + 2], output[bin] * 1e-4f);
+    }
+}
@@ -0,0 +1,111 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "common/axis.h"
+#include "common/utils.h"
+
+#include "pg/pg.h"
+
+#include "sensors/gyro.h"
+#include "sensors/gyro_init.h"
+
+#include "sensor_gyro_dyn_notch_harness.h"
+
+static gyro_t generic;
+
+// Returns how many dynamic notches the chain picked for the configuration runs
+int gyroDynNotchHarnessInit(uint8_t widthPercent)
+{
+    pgResetAll();
+    gyroConfigMutable()->gyro_lowpass_hz = 0;
+    gyroConfigMutable()->gyro_lowpass2_hz = 0;
+    gyroConfigMutable()->gyro_soft_notch_hz_1 = 300;
+    gyroConfigMutable()->gyro_soft_notch_cutoff_1 = 200;
+    gyroConfigMutable()->gyro_soft_notch_hz_2 = 0;
+    gyroConfigMutable()->dyn_notch_width_percent = widthPercent;
+
+    gyroInit();
+    gyroSetTargetLooptime(1);
+    gyroInitFilters();
+
+    generic = gyro;
+    generic.filterChain = GYRO_FILTER_CHAIN_GENERIC;
+
+    switch (gyro.filterChain) {
+    case GYRO_FILTER_CHAIN_DYN_NOTCH:
+        return 1;
+    case GYRO_FILTER_CHAIN_DYN_NOTCH2:
+        return 2;
+    default:
+        return -1;
+    }
+}
+
+// Runs the picked chain and the generic one side by side
+void gyroDynNotchHarnessStep(const float *sample, float *specialised, float *genericOut)
+{
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyro.sampleSum[axis] = generic.sampleSum[axis] = sample[axis];
+    }
+    gyro.sampleCount = generic.sampleCount = 1;
+    gyro.sampleWeight = generic.sampleWeight = 1;
+
+    gyroFiltering(0);
+    const gyro_t picked = gyro;
+
+    gyro = generic;
+    gyroFiltering(0);
+    generic = gyro;
+
+    gyro = picked;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        specialised[axis] = gyro.gyroADCf[axis];
+        genericOut[axis] = generic.gyroADCf[axis];
+    }
+}
+
+float gyroDynNotchHarnessNotchCenter(int axis)
+{
+    return gyro.gyroAnalyseState.centerFreq[axis];
+}
+
+timeDelta_t getGyroUpdateRate(void)
+{
+    return gyro.targetLooptime;
+}
+
+// As arm_bitreversal2.S, which is Cortex-M assembly
+void arm_bitreversal_32(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTable)
+{
+    for (int i = 0; i < bitRevLen; i += 2) {
+        const int a = pBitRevTable[i] >> 2;
+        const int b = pBitRevTable[i + 1] >> 2;
+
+        uint32_t tmp = pSrc[a];
+        pSrc[a] = pSrc[b];
+        pSrc[b] = tmp;
+
+        tmp = pSrc[a + 1];
+        pSrc[a + 1] = pSrc[b + 1];
+        pSrc[b + 1] = tmp;
+    }
+}
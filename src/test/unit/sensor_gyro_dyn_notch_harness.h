@@ -0,0 +1,27 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// sensors/gyro.h pulls in arm_math.h, which does not build as C++ on the
+// host, so the gyro is driven from C and the test only sees the outputs
+
+int gyroDynNotchHarnessInit(uint8_t widthPercent);
+void gyroDynNotchHarnessStep(const float *sample, float *specialised, float *generic);
+float gyroDynNotchHarnessNotchCenter(int axis);
@@ -0,0 +1,90 @@
+/*
+ * This file is part of Heliflight 3D.
+ *
+ * Heliflight 3D is free software. You can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Heliflight 3D is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+    #include "common/maths.h"
+    #include "io/beeper.h"
+    #include "scheduler/scheduler.h"
+
+    #include "sensor_gyro_dyn_notch_harness.h"
+
+    uint8_t debugMode;
+    int16_t debug[DEBUG16_VALUE_COUNT];
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// The dynamic notch chains against the generic one, as sensor_gyro_unittest
+// does for the others, with a tone for the analyser to follow
+
+static void expectDynNotchChainMatchesGeneric(void)
+{
+    float peak = 0;
+
+    for (int n = 0; n < 4000; n++) {
+        float sample[3], specialised[3], generic[3];
+        for (int axis = 0; axis < 3; axis++) {
+            sample[axis] = 300 * sinf(n * 0.37f * (axis + 1)) + 40 * cosf(n * 2.1f) + 50 * sinf(n * 0.25f);
+        }
+        gyroDynNotchHarnessStep(sample, specialised, generic);
+        for (int axis = 0; axis < 3; axis++) {
+            EXPECT_FLOAT_EQ(generic[axis], specialised[axis]);
+        }
+        if (n == 0) {
+            peak = gyroDynNotchHarnessNotchCenter(0);
+        }
+    }
+
+    // The analyser moved the notches, so the coefficient updates were compared too
+    EXPECT_NE(peak, gyroDynNotchHarnessNotchCenter(0));
+}
+
+TEST(SensorGyroDynNotch, FilterChainDynNotch)
+{
+    EXPECT_EQ(1, gyroDynNotchHarnessInit(0));
+    expectDynNotchChainMatchesGeneric();
+}
+
+TEST(SensorGyroDynNotch, FilterChainDynNotch2)
+{
+    EXPECT_EQ(2, gyroDynNotchHarnessInit(8));
+    expectDynNotchChainMatchesGeneric();
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t micros(void) {return 0;}
+void beeper(beeperMode_e) {}
+uint8_t detectedSensors[] = { 0, 0 };
+void sensorsSet(uint32_t) {}
+void schedulerResetTaskStatistics(taskId_e) {}
+int getArmingDisableFlags(void) {return 0;}
+void writeEEPROM(void) {}
+bool featureIsEnabled(uint32_t) {return true;}
+uint8_t calculateThrottlePercentAbs(void) {return 50;}
+}
@@ -19,6 +19,8 @@
 #include <stdbool.h>
 
 #include <limits.h>
+#include <string.h>
+#include <math.h>
 #include <algorithm>
 
 extern "C" {
@@ -37,6 +39,7 @@ extern "C" {
     #include "pg/pg_ids.h"
     #include "scheduler/scheduler.h"
     #include "sensors/gyro.h"
+    #include "sensors/gyro_fusion.h"
     #include "sensors/gyro_init.h"
     #include "sensors/acceleration.h"
     #include "sensors/sensors.h"
@@ -55,6 +58,8 @@ extern "C" {
 extern gyroSensor_s * const gyroSensorPtr;
 extern gyroDev_t * const gyroDevPtr;
 
+static uint32_t currentTimeUs;
+
 
 TEST(SensorGyro, Detect)
 {
@@ -151,11 +156,332 @@ TEST(SensorGyro, Update)
     EXPECT_NEAR(90 * gyroDevPtr->scale, gyro.gyroADC[Z], 1e-3);
 }
 
+TEST(SensorGyro, UpdateFifo)
+{
+    pgResetAll();
+    // turn off filters
+    gyroConfigMutable()->gyro_lowpass_hz = 0;
+    gyroConfigMutable()->gyro_lowpass2_hz = 0;
+    gyroConfigMutable()->gyro_soft_notch_hz_1 = 0;
+    gyroConfigMutable()->gyro_soft_notch_hz_2 = 0;
+    gyroInit();
+    gyroSetTargetLooptime(1);
+    gyroInitFilters();
+    fakeGyroUseFifo(gyroDevPtr, true);
+    gyroStartCalibration(false);
+
+    while (!gyroIsCalibrationComplete()) {
+        for (int i = 0; i < 3; i++) {
+            fakeGyroFifoPush(gyroDevPtr, 5, 6, 7);
+        }
+        gyroUpdate();
+    }
+    EXPECT_EQ(5, gyroDevPtr->gyroZero[X]);
+    EXPECT_EQ(6, gyroDevPtr->gyroZero[Y]);
+    EXPECT_EQ(7, gyroDevPtr->gyroZero[Z]);
+    gyroFiltering(0);
+
+    // All samples drained in one update go into the average, with their times
+    const uint32_t samplePeriodUs = 1000000 / gyroDevPtr->gyroSampleRateHz;
+    currentTimeUs += 4 * samplePeriodUs;
+    fakeGyroFifoPush(gyroDevPtr, 15, 6, 7);
+    fakeGyroFifoPush(gyroDevPtr, 25, 6, 7);
+    fakeGyroFifoPush(gyroDevPtr, 35, 6, 7);
+    fakeGyroFifoPush(gyroDevPtr, 45, 16, 7);
+    gyroUpdate();
+    EXPECT_EQ(4, gyroDevPtr->fifo.count);
+    EXPECT_EQ(4, gyro.sampleCount);
+    EXPECT_EQ(45, gyroDevPtr->gyroADCRaw[X]);
+    EXPECT_EQ(currentTimeUs, gyroDevPtr->fifo.timeUs[3]);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(samplePeriodUs, gyroDevPtr->fifo.timeUs[i + 1] - gyroDevPtr->fifo.timeUs[i]);
+    }
+    EXPECT_FLOAT_EQ(4, gyro.sampleWeight);
+    gyroFiltering(0);
+    EXPECT_NEAR(25 * gyroDevPtr->scale, gyro.gyroADCf[X], 1e-3);
+    EXPECT_NEAR(2.5f * gyroDevPtr->scale, gyro.gyroADCf[Y], 1e-3);
+    EXPECT_NEAR(0, gyro.gyroADCf[Z], 1e-3);
+
+    // More than the buffer holds is left for the next update, and was taken before it
+    currentTimeUs += (GYRO_FIFO_SIZE + 4) * samplePeriodUs;
+    for (int i = 0; i < GYRO_FIFO_SIZE + 4; i++) {
+        fakeGyroFifoPush(gyroDevPtr, 5 + i, 6, 7);
+    }
+    gyroUpdate();
+    EXPECT_EQ(GYRO_FIFO_SIZE, gyro.sampleCount);
+    EXPECT_EQ(currentTimeUs - 4 * samplePeriodUs, gyroDevPtr->fifo.timeUs[GYRO_FIFO_SIZE - 1]);
+    gyroUpdate();
+    EXPECT_EQ(GYRO_FIFO_SIZE + 4, gyro.sampleCount);
+    EXPECT_EQ(currentTimeUs, gyroDevPtr->fifo.timeUs[3]);
+    EXPECT_FLOAT_EQ(GYRO_FIFO_SIZE + 4, gyro.sampleWeight);
+    gyroFiltering(0);
+    EXPECT_NEAR((GYRO_FIFO_SIZE + 3) / 2.0f * gyroDevPtr->scale, gyro.gyroADCf[X], 1e-3);
+
+    // With nothing new the last sample is used again
+    gyroUpdate();
+    EXPECT_EQ(1, gyro.sampleCount);
+    EXPECT_NEAR((GYRO_FIFO_SIZE + 3) * gyroDevPtr->scale, gyro.sampleSum[X], 1e-3);
+    gyroFiltering(0);
+
+    // After samples were lost the first one read stands for the gap
+    currentTimeUs += 4 * samplePeriodUs;
+    fakeGyroFifoPush(gyroDevPtr, 25, 6, 7);
+    fakeGyroFifoPush(gyroDevPtr, 45, 6, 7);
+    gyroUpdate();
+    EXPECT_EQ(currentTimeUs, gyroDevPtr->fifo.timeUs[1]);
+    EXPECT_EQ(currentTimeUs - samplePeriodUs, gyroDevPtr->fifo.timeUs[0]);
+    EXPECT_FLOAT_EQ(4, gyro.sampleWeight);
+    gyroFiltering(0);
+    EXPECT_NEAR((20 * 3 + 40) / 4.0f * gyroDevPtr->scale, gyro.gyroADCf[X], 1e-3);
+
+    // Read jitter does not move the times
+    currentTimeUs += 2 * samplePeriodUs + samplePeriodUs / 2;
+    fakeGyroFifoPush(gyroDevPtr, 5, 6, 7);
+    fakeGyroFifoPush(gyroDevPtr, 5, 6, 7);
+    gyroUpdate();
+    EXPECT_EQ(currentTimeUs - samplePeriodUs / 2, gyroDevPtr->fifo.timeUs[1]);
+    EXPECT_FLOAT_EQ(2, gyro.sampleWeight);
+}
+
+// Runs the chain picked for the configuration and the generic one side by side
+static void expectFilterChainMatchesGeneric(gyroFilterChain_e expectedChain)
+{
+    gyroInit();
+    gyroSetTargetLooptime(1);
+    gyroInitFilters();
+    EXPECT_EQ(expectedChain, gyro.filterChain);
+
+    gyro_t generic = gyro;
+    generic.filterChain = GYRO_FILTER_CHAIN_GENERIC;
+
+    for (int n = 0; n < 500; n++) {
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            const float sample = 300 * sinf(n * 0.37f * (axis + 1)) + 40 * cosf(n * 2.1f);
+            gyro.sampleSum[axis] = generic.sampleSum[axis] = sample;
+        }
+        gyro.sampleCount = generic.sampleCount = 1;
+        gyro.sampleWeight = generic.sampleWeight = 1;
+
+        gyroFiltering(0);
+        const gyro_t specialised = gyro;
+
+        gyro = generic;
+        gyroFiltering(0);
+        generic = gyro;
+
+        gyro = specialised;
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            EXPECT_FLOAT_EQ(generic.gyroADCf[axis], gyro.gyroADCf[axis]);
+        }
+    }
+}
+
+TEST(SensorGyro, FilterChainRpmOnly)
+{
+    pgResetAll();
+    gyroConfigMutable()->gyro_lowpass_hz = 0;
+    gyroConfigMutable()->gyro_lowpass2_hz = 0;
+    gyroConfigMutable()->gyro_soft_notch_hz_1 = 0;
+    gyroConfigMutable()->gyro_soft_notch_hz_2 = 0;
+    expectFilterChainMatchesGeneric(GYRO_FILTER_CHAIN_RPM);
+}
+
+TEST(SensorGyro, FilterChainStatic)
+{
+    pgResetAll();
+    gyroConfigMutable()->gyro_lowpass_type = FILTER_BIQUAD;
+    gyroConfigMutable()->gyro_lowpass_hz = 150;
+    gyroConfigMutable()->gyro_soft_notch_hz_1 = 300;
+    gyroConfigMutable()->gyro_soft_notch_cutoff_1 = 200;
+    gyroConfigMutable()->gyro_soft_notch_hz_2 = 200;
+    gyroConfigMutable()->gyro_soft_notch_cutoff_2 = 100;
+    expectFilterChainMatchesGeneric(GYRO_FILTER_CHAIN_STATIC);
+}
+
+TEST(SensorGyro, FilterChainStaticPT1)
+{
+    pgResetAll();
+    gyroConfigMutable()->gyro_lowpass_type = FILTER_PT1;
+    gyroConfigMutable()->gyro_lowpass_hz = 100;
+    gyroConfigMutable()->gyro_soft_notch_hz_1 = 0;
+    gyroConfigMutable()->gyro_soft_notch_hz_2 = 0;
+    expectFilterChainMatchesGeneric(GYRO_FILTER_CHAIN_STATIC);
+}
+
+// Dual gyro fusion, fed synthetic streams at 8kHz of a 5Hz 200deg/s swing
+
+#define FUSION_RATE_HZ      8000
+#define FUSION_SCALE        16.4f
+
+static uint32_t fusionSeed;
+
+static float fusionNoise(float sigma)
+{
+    // Box-Muller on a fixed LCG, so the streams are the same everywhere
+    fusionSeed = fusionSeed * 1664525 + 1013904223;
+    const float u1 = ((fusionSeed >> 8) + 1) / 16777217.0f;
+    fusionSeed = fusionSeed * 1664525 + 1013904223;
+    const float u2 = (fusionSeed >> 8) / 16777216.0f;
+    return sigma * sqrtf(-2.0f * logf(u1)) * cosf(2.0f * M_PIf * u2);
+}
+
+static float fusionTruth(int n)
+{
+    return 200.0f * sinf(2.0f * M_PIf * 5.0f * n / FUSION_RATE_HZ);
+}
+
+static void fusionSensor(float rate, float sigma, int16_t *raw, float *sample)
+{
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        raw[axis] = constrain(lrintf((rate + fusionNoise(sigma)) * FUSION_SCALE), -32767, 32767);
+        sample[axis] = raw[axis] / FUSION_SCALE;
+    }
+}
+
+TEST(SensorGyro, FusionEqualSensors)
+{
+    gyroFusion_t fusion;
+    gyroFusionInit(&fusion);
+    fusionSeed = 1;
+
+    float fusedError = 0, averageError = 0;
+    for (int n = 0; n < 4000; n++) {
+        int16_t raw1[3], raw2[3];
+        float sample1[3], sample2[3], fused[3];
+        const float truth = fusionTruth(n);
+        fusionSensor(truth, 0.3f, raw1, sample1);
+        fusionSensor(truth, 0.3f, raw2, sample2);
+        gyroFusionApply(&fusion, sample1, raw1, sample2, raw2, fused);
+        if (n >= 1000) {
+            fusedError += sq(fused[X] - truth);
+            averageError += sq((sample1[X] + sample2[X]) / 2 - truth);
+        }
+    }
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        EXPECT_NEAR(0.5f, fusion.weight[axis], 0.1f);
+    }
+    EXPECT_LT(fusedError, averageError * 1.1f);
+}
+
+TEST(SensorGyro, FusionResonance)
+{
+    gyroFusion_t fusion;
+    gyroFusionInit(&fusion);
+    fusionSeed = 2;
+
+    // The second sensor sits on a 150Hz resonance of 30deg/s
+    float fusedError = 0, averageError = 0;
+    for (int n = 0; n < 4000; n++) {
+        int16_t raw1[3], raw2[3];
+        float sample1[3], sample2[3], fused[3];
+        const float truth = fusionTruth(n);
+        const float resonance = 30.0f * sinf(2.0f * M_PIf * 150.0f * n / FUSION_RATE_HZ);
+        fusionSensor(truth, 0.3f, raw1, sample1);
+        fusionSensor(truth + resonance, 0.3f, raw2, sample2);
+        gyroFusionApply(&fusion, sample1, raw1, sample2, raw2, fused);
+        if (n >= 1000) {
+            fusedError += sq(fused[X] - truth);
+            averageError += sq((sample1[X] + sample2[X]) / 2 - truth);
+        }
+    }
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        EXPECT_GT(fusion.weight[axis], 0.85f);
+    }
+    EXPECT_LT(fusedError, averageError * 0.1f);
+}
+
+TEST(SensorGyro, FusionSpikes)
+{
+    gyroFusion_t fusion;
+    gyroFusionInit(&fusion);
+    fusionSeed = 3;
+
+    // Single sample 500deg/s spikes on the second sensor
+    float maxError = 0;
+    for (int n = 0; n < 4000; n++) {
+        int16_t raw1[3], raw2[3];
+        float sample1[3], sample2[3], fused[3];
+        const float truth = fusionTruth(n);
+        fusionSensor(truth, 0.3f, raw1, sample1);
+        fusionSensor((n % 200 == 199) ? truth + 500.0f : truth, 0.3f, raw2, sample2);
+        gyroFusionApply(&fusion, sample1, raw1, sample2, raw2, fused);
+        if (n >= 1000) {
+            maxError = fmaxf(maxError, fabsf(fused[X] - truth));
+        }
+    }
+
+    EXPECT_LT(maxError, 5.0f);
+}
+
+TEST(SensorGyro, FusionClipping)
+{
+    gyroFusion_t fusion;
+    gyroFusionInit(&fusion);
+    fusionSeed = 4;
+
+    // The second sensor jumps to full scale for 50 samples
+    float maxError = 0;
+    for (int n = 0; n < 4000; n++) {
+        int16_t raw1[3], raw2[3];
+        float sample1[3], sample2[3], fused[3];
+        const float truth = fusionTruth(n);
+        fusionSensor(truth, 0.3f, raw1, sample1);
+        fusionSensor((n >= 2000 && n < 2050) ? 2500.0f : truth, 0.3f, raw2, sample2);
+        gyroFusionApply(&fusion, sample1, raw1, sample2, raw2, fused);
+        if (n >= 2000 && n < 2049 + GYRO_FUSION_CLIP_HOLD_SAMPLES) {
+            EXPECT_FLOAT_EQ(1.0f, fusion.weight[X]);
+        }
+        if (n >= 1000) {
+            maxError = fmaxf(maxError, fabsf(fused[X] - truth));
+        }
+    }
+
+    EXPECT_LT(maxError, 5.0f);
+}
+
+TEST(SensorGyro, FusionStuck)
+{
+    gyroFusion_t fusion;
+    gyroFusionInit(&fusion);
+    fusionSeed = 5;
+
+    // The second sensor freezes halfway through
+    int16_t stuckRaw[3] = { 0 };
+    float stuckSample[3] = { 0 };
+    float maxError = 0;
+    for (int n = 0; n < 4000; n++) {
+        int16_t raw1[3], raw2[3];
+        float sample1[3], sample2[3], fused[3];
+        const float truth = fusionTruth(n);
+        fusionSensor(truth, 0.3f, raw1, sample1);
+        fusionSensor(truth, 0.3f, raw2, sample2);
+        if (n == 2000) {
+            memcpy(stuckRaw, raw2, sizeof(stuckRaw));
+            memcpy(stuckSample, sample2, sizeof(stuckSample));
+        }
+        if (n >= 2000) {
+            gyroFusionApply(&fusion, sample1, raw1, stuckSample, stuckRaw, fused);
+        } else {
+            gyroFusionApply(&fusion, sample1, raw1, sample2, raw2, fused);
+        }
+        if (n >= 2000 + GYRO_FUSION_STUCK_SAMPLES) {
+            EXPECT_FLOAT_EQ(1.0f, fusion.weight[X]);
+        }
+        if (n >= 1000) {
+            maxError = fmaxf(maxError, fabsf(fused[X] - truth));
+        }
+    }
+
+    EXPECT_LT(maxError, 10.0f);
+}
+
 // STUBS
 
 extern "C" {
 
-uint32_t micros(void) {return 0;}
+uint32_t micros(void) {return currentTimeUs;}
 void beeper(beeperMode_e) {}
 uint8_t detectedSensors[] = { GYRO_NONE, ACC_NONE };
 timeDelta_t getGyroUpdateRate(void) {return gyro.targetLooptime;}
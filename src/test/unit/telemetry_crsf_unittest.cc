@@ -64,6 +64,8 @@ extern "C" {
     rssiSource_e rssiSource;
     bool airMode;
 
+    void crsfDataReceive(uint16_t c, void *data);
+
     uint16_t testBatteryVoltage = 0;
     int32_t testAmperage = 0;
     int32_t testmAhDrawn = 0;
@@ -252,21 +254,21 @@ TEST(TelemetryCrsfTest, TestFlightMode)
     EXPECT_EQ(0, frame[7]);
     EXPECT_EQ(crfsCrc(frame, frameLen), frame[8]);
 
-    enableFlightMode(ANGLE_MODE);
-    EXPECT_EQ(ANGLE_MODE, FLIGHT_MODE(ANGLE_MODE));
+    enableFlightMode(RESCUE_MODE);
+    EXPECT_EQ(RESCUE_MODE, FLIGHT_MODE(RESCUE_MODE));
     frameLen = getCrsfFrame(frame, CRSF_FRAMETYPE_FLIGHT_MODE);
     EXPECT_EQ(5 + FRAME_HEADER_FOOTER_LEN, frameLen);
     EXPECT_EQ(CRSF_SYNC_BYTE, frame[0]); // address
     EXPECT_EQ(7, frame[1]); // length
     EXPECT_EQ(0x21, frame[2]); // type
-    EXPECT_EQ('S', frame[3]);
-    EXPECT_EQ('T', frame[4]);
-    EXPECT_EQ('A', frame[5]);
-    EXPECT_EQ('B', frame[6]);
+    EXPECT_EQ('R', frame[3]);
+    EXPECT_EQ('E', frame[4]);
+    EXPECT_EQ('S', frame[5]);
+    EXPECT_EQ('C', frame[6]);
     EXPECT_EQ(0, frame[7]);
     EXPECT_EQ(crfsCrc(frame, frameLen), frame[8]);
 
-    disableFlightMode(ANGLE_MODE);
+    disableFlightMode(RESCUE_MODE);
     enableFlightMode(HORIZON_MODE);
     EXPECT_EQ(HORIZON_MODE, FLIGHT_MODE(HORIZON_MODE));
     frameLen = getCrsfFrame(frame, CRSF_FRAMETYPE_FLIGHT_MODE);
@@ -282,16 +284,144 @@ TEST(TelemetryCrsfTest, TestFlightMode)
 
     disableFlightMode(HORIZON_MODE);
     airMode = true;
+    // air mode is not reported, so back to ACRO
     frameLen = getCrsfFrame(frame, CRSF_FRAMETYPE_FLIGHT_MODE);
-    EXPECT_EQ(4 + FRAME_HEADER_FOOTER_LEN, frameLen);
+    EXPECT_EQ(5 + FRAME_HEADER_FOOTER_LEN, frameLen);
     EXPECT_EQ(CRSF_SYNC_BYTE, frame[0]); // address
-    EXPECT_EQ(6, frame[1]); // length
+    EXPECT_EQ(7, frame[1]); // length
     EXPECT_EQ(0x21, frame[2]); // type
     EXPECT_EQ('A', frame[3]);
-    EXPECT_EQ('I', frame[4]);
+    EXPECT_EQ('C', frame[4]);
     EXPECT_EQ('R', frame[5]);
-    EXPECT_EQ(0, frame[6]);
-    EXPECT_EQ(crfsCrc(frame, frameLen), frame[7]);
+    EXPECT_EQ('O', frame[6]);
+    EXPECT_EQ(0, frame[7]);
+    EXPECT_EQ(crfsCrc(frame, frameLen), frame[8]);
+}
+
+// Telemetry scheduler, the receiver takes frames at the slot rate the link statistics give
+
+#define TASK_INTERVAL_US    2000    // telemetry task at 500Hz, as rescheduled for CRSF
+
+static timeUs_t testTimeUs;
+static int sensorFrames;
+static int mspFrames;
+static int otherFrames;
+static timeUs_t lastMspFrameUs;
+static int testMspChunksLeft;
+
+static void testLinkStatistics(uint8_t rfMode)
+{
+    uint8_t frame[] = {
+        CRSF_ADDRESS_FLIGHT_CONTROLLER, CRSF_FRAME_ORIGIN_DEST_SIZE + CRSF_FRAME_LINK_STATISTICS_PAYLOAD_SIZE,
+        CRSF_FRAMETYPE_LINK_STATISTICS,
+        50, 50, 100, 10, 0, rfMode, 3, 50, 100, 10,
+        0
+    };
+    frame[sizeof(frame) - 1] = crc8_dvb_s2_update(0, &frame[2], sizeof(frame) - 3);
+    for (unsigned i = 0; i < sizeof(frame); i++) {
+        crsfDataReceive(frame[i], NULL);
+    }
+}
+
+static void testInitCrsf(uint8_t rfMode, uint8_t sensorWeight, uint8_t mspWeight)
+{
+    telemetryConfigMutable()->crsf_sensor_weight = sensorWeight;
+    telemetryConfigMutable()->crsf_msp_weight = mspWeight;
+    telemetryConfigMutable()->crsf_displayport_weight = 20;
+
+    rssiSource = RSSI_SOURCE_RX_PROTOCOL_CRSF;
+    sensorsSet(SENSOR_ACC);
+    crsfRxInit(rxConfig(), &rxRuntimeState);
+    testLinkStatistics(rfMode);
+    initCrsfMspBuffer();
+    initCrsfTelemetry();
+    EXPECT_TRUE(checkCrsfTelemetryState());
+
+    // Let the first round of sensor frames go, then count from a second on
+    for (testTimeUs = 1000000; testTimeUs < 2000000; testTimeUs += TASK_INTERVAL_US) {
+        handleCrsfTelemetry(testTimeUs);
+    }
+    sensorFrames = 0;
+    mspFrames = 0;
+    otherFrames = 0;
+}
+
+static void testMspRequest(int chunks)
+{
+    uint8_t request[CRSF_FRAME_RX_MSP_FRAME_SIZE] = { 0x30, 0, 112 };
+
+    testMspChunksLeft = chunks;
+    bufferCrsfMspFrame(request, sizeof(request));
+    crsfScheduleMspResponse();
+}
+
+static void testRun(timeUs_t durationUs)
+{
+    const timeUs_t endUs = testTimeUs + durationUs;
+    for (; testTimeUs < endUs; testTimeUs += TASK_INTERVAL_US) {
+        handleCrsfTelemetry(testTimeUs);
+    }
+}
+
+TEST(TelemetryCrsfTest, SlotRateFromLinkStatistics)
+{
+    // 4Hz, long range
+    testInitCrsf(CRSF_RF_MODE_4_FPS, 30, 50);
+    testRun(2000000);
+    EXPECT_EQ(8, sensorFrames);
+
+    // 150Hz, more slots than the 4 sensor frames at 10Hz take
+    testInitCrsf(CRSF_RF_MODE_150_FPS, 30, 50);
+    testRun(1000000);
+    EXPECT_EQ(40, sensorFrames);
+    EXPECT_EQ(0, mspFrames);
+    EXPECT_EQ(0, otherFrames);
+
+    // RF mode other than Crossfire ones, as ExpressLRS reports, the default rate
+    testInitCrsf(7, 30, 50);
+    testMspRequest(1000);
+    testRun(1000000);
+    EXPECT_NEAR(150, sensorFrames + mspFrames, 1);
+}
+
+TEST(TelemetryCrsfTest, FrameMixWhileMspStreaming)
+{
+    // 50Hz, the slots are shared by weight
+    testInitCrsf(CRSF_RF_MODE_50_FPS, 30, 50);
+    testMspRequest(1000);
+    testRun(2000000);
+    EXPECT_EQ(100, sensorFrames + mspFrames);
+    EXPECT_NEAR(100 * 30 / 80, sensorFrames, 1);
+    EXPECT_NEAR(100 * 50 / 80, mspFrames, 1);
+
+    // 150Hz, the sensors get all they need and MSP the rest
+    testInitCrsf(CRSF_RF_MODE_150_FPS, 30, 50);
+    testMspRequest(1000);
+    testRun(1000000);
+    EXPECT_NEAR(40, sensorFrames, 1);
+    EXPECT_NEAR(110, mspFrames, 1);
+
+    // Weight zero, MSP only takes slots the sensors leave
+    testInitCrsf(CRSF_RF_MODE_50_FPS, 30, 0);
+    testMspRequest(1000);
+    testRun(1000000);
+    EXPECT_EQ(40, sensorFrames);
+    EXPECT_EQ(10, mspFrames);
+}
+
+TEST(TelemetryCrsfTest, MspTransferTime)
+{
+    testInitCrsf(CRSF_RF_MODE_150_FPS, 30, 50);
+
+    // The chunks of a reply follow each other without further requests
+    const timeUs_t startUs = testTimeUs;
+    testMspRequest(8);
+    testRun(1000000);
+    EXPECT_EQ(8, mspFrames);
+    EXPECT_LT(lastMspFrameUs - startUs, 8 * 1000000u / 110 + 10000);
+
+    // and the sensors kept going while they did
+    EXPECT_NEAR(40, sensorFrames, 1);
 }
 
 // STUBS
@@ -299,6 +429,11 @@ TEST(TelemetryCrsfTest, TestFlightMode)
 extern "C" {
 
 int16_t debug[DEBUG16_VALUE_COUNT];
+uint8_t debugMode;
+
+rxRuntimeState_t rxRuntimeState;
+void setRssi(uint16_t, rssiSource_e) {}
+void setRssiDirect(uint16_t, rssiSource_e) {}
 
 const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000, 400000}; // see baudRate_e
 
@@ -321,13 +456,32 @@ uint32_t serialRxBytesWaiting(const serialPort_t *) {return 0;}
 uint32_t serialTxBytesFree(const serialPort_t *) {return 0;}
 uint8_t serialRead(serialPort_t *) {return 0;}
 void serialWrite(serialPort_t *, uint8_t) {}
-void serialWriteBuf(serialPort_t *, const uint8_t *, int) {}
+void serialWriteBuf(serialPort_t *, const uint8_t *data, int)
+{
+    switch (data[2]) {
+    case CRSF_FRAMETYPE_GPS:
+    case CRSF_FRAMETYPE_BATTERY_SENSOR:
+    case CRSF_FRAMETYPE_ATTITUDE:
+    case CRSF_FRAMETYPE_FLIGHT_MODE:
+        sensorFrames++;
+        break;
+    case CRSF_FRAMETYPE_MSP_RESP:
+        mspFrames++;
+        lastMspFrameUs = testTimeUs;
+        break;
+    default:
+        otherFrames++;
+        break;
+    }
+}
 void serialSetMode(serialPort_t *, portMode_e) {}
-serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return NULL;}
+static serialPort_t testSerialPort;
+static const serialPortConfig_t testPortConfig = { 0, SERIAL_PORT_USART1, 0, 0, 0, 0 };
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return &testSerialPort;}
 void closeSerialPort(serialPort_t *) {}
 bool isSerialTransmitBufferEmpty(const serialPort_t *) { return true; }
 
-const serialPortConfig_t *findSerialPortConfig(serialPortFunction_e) {return NULL;}
+const serialPortConfig_t *findSerialPortConfig(serialPortFunction_e) {return &testPortConfig;}
 
 bool telemetryDetermineEnabledState(portSharing_e) {return true;}
 bool telemetryCheckRxPortShared(const serialPortConfig_t *, SerialRXType) {return true;}
@@ -369,9 +523,14 @@ int32_t getMAhDrawn(void){
   return testmAhDrawn;
 }
 
-bool sendMspReply(uint8_t, mspResponseFnPtr) { return false; }
-bool handleMspFrame(uint8_t *, int, uint8_t *)  { return false; }
-void crsfScheduleMspResponse(void) {};
+// Every request completes in one frame, and the reply takes testMspChunksLeft chunks
+bool sendMspReply(uint8_t, mspResponseFnPtr responseFn)
+{
+    uint8_t payload[CRSF_FRAME_TX_MSP_FRAME_SIZE] = { 0 };
+    responseFn(payload);
+    return --testMspChunksLeft > 0;
+}
+bool handleMspFrame(uint8_t *, int, uint8_t *)  { return true; }
 bool isBatteryVoltageConfigured(void) { return true; }
 bool isAmperageConfigured(void) { return true; }
 
@@ -25,6 +25,7 @@ extern "C" {
     #include "common/color.h"
 
     #include "drivers/light_ws2811strip.h"
+    #include "drivers/time.h"
 }
 
 #include "unittest_macros.h"
@@ -75,10 +76,96 @@ TEST(WS2812, updateDMABuffer) {
     byteIndex++;
 }
 
+static int conversions;
+static int transfers;
+static timeUs_t simulatedTimeUs;
+
+// Sends a frame, as the LED task would once the last transfer is done
+static void updateStrip(ledStripFormatRGB_e ledFormat)
+{
+    conversions = 0;
+    transfers = 0;
+    ws2811LedDataTransferInProgress = false;
+    ws2811UpdateStrip(ledFormat);
+    simulatedTimeUs += 20000;
+}
+
+TEST(WS2812, onlyChangedLedsAreConverted) {
+    const hsvColor_t red = { 0, 255, 255 };
+    const hsvColor_t blue = { 240, 255, 255 };
+
+    // given
+    ws2811LedStripEnable();
+    setUsedLedCount(10);
+    setStripColor(&red);
+
+    // when
+    updateStrip(LED_GRB);
+
+    // then every position is converted after the count changed
+    EXPECT_EQ(WS2811_DATA_BUFFER_SIZE, conversions);
+    EXPECT_EQ(1, transfers);
+
+    // when
+    setLedHsv(3, &blue);
+    updateStrip(LED_GRB);
+
+    // then
+    EXPECT_EQ(1, conversions);
+    EXPECT_EQ(1, transfers);
+
+    // when the frame is composed again the same
+    setStripColor(&red);
+    setLedHsv(3, &blue);
+    updateStrip(LED_GRB);
+
+    // then
+    EXPECT_EQ(0, conversions);
+    EXPECT_EQ(0, transfers);
+
+    // when
+    setLedValue(0, 100);
+    setLedValue(9, 100);
+    updateStrip(LED_GRB);
+
+    // then
+    EXPECT_EQ(2, conversions);
+    EXPECT_EQ(1, transfers);
+
+    // when the colour order changes
+    updateStrip(LED_RGB);
+
+    // then
+    EXPECT_EQ(WS2811_DATA_BUFFER_SIZE, conversions);
+    EXPECT_EQ(1, transfers);
+}
+
+TEST(WS2812, unchangedFrameIsRefreshed) {
+    // given
+    ws2811LedStripEnable();
+    updateStrip(LED_GRB);
+
+    // when
+    int sent = 0;
+    for (int i = 0; i < 100; i++) {
+        updateStrip(LED_GRB);
+        sent += transfers;
+        EXPECT_EQ(0, conversions);
+    }
+
+    // then once for each refresh interval, over 2s
+    EXPECT_EQ(2, sent);
+}
+
 extern "C" {
+static rgbColor24bpp_t rgb24;
+
 rgbColor24bpp_t* hsvToRgb24(const hsvColor_t *c) {
-    UNUSED(c);
-    return NULL;
+    rgb24.rgb.r = c->h;
+    rgb24.rgb.g = c->s;
+    rgb24.rgb.b = c->v;
+    conversions++;
+    return &rgb24;
 }
 
 bool ws2811LedStripHardwareInit(ioTag_t ioTag) {
@@ -87,5 +174,11 @@ bool ws2811LedStripHardwareInit(ioTag_t ioTag) {
     return true;
 }
 
-void ws2811LedStripDMAEnable(void) {}
+void ws2811LedStripDMAEnable(void) {
+    transfers++;
+}
+
+timeUs_t micros(void) {
+    return simulatedTimeUs;
+}
 }
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+
+# This file is part of Heliflight 3D.
+#
+# Heliflight 3D is free software. You can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# Heliflight 3D is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+# See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this software. If not, see <https://www.gnu.org/licenses/>.
+
+# Expands blackbox logs written with blackbox_compression = ON, so that
+# blackbox_decode and the log viewer can read them.
+#
+#   blackbox_decompress.py LOG.BFL [-o LOG_PLAIN.BFL]
+#
+# A file may hold several logs, compressed or not. Each compressed log has
+# plain text headers ending in "H Data compression:2", followed by the blocks
+# of blackbox/blackbox_compress.c. That header is dropped from the output.
+# Blocks that lost data on the way to the flash or card fail their CRC and
+# are left out, the log picks up again at the next block. The size of each
+# log before and after is reported, with any blocks lost.
+
+from optparse import OptionParser
+
+LOG_START = b'H Product:Blackbox flight data recorder by Nicholas Sherlock\n'
+COMPRESSION_HEADER = b'H Data compression:2\n'
+SYNC = b'\xA5BZ\x5A'
+
+PROB_BITS = 11
+PROB_ONE = 1 << PROB_BITS
+ADAPT_SHIFT = 5
+RANGE_TOP = 1 << 24
+
+def crc16_ccitt(data):
+  crc = 0
+  for value in data:
+    crc ^= value << 8
+    for _ in range(8):
+      crc = ((crc << 1) ^ 0x1021 if crc & 0x8000 else crc << 1) & 0xFFFF
+  return crc
+
+def decompress_block(data, start, limit):
+  """Returns the bytes coded in the block at data[start:], and where it ends,
+  or None if it runs past limit."""
+  out = bytearray()
+  probability = [ [ PROB_ONE // 2 ] * 256, [ PROB_ONE // 2 ] * 256 ]
+  end_probability = PROB_ONE // 2
+  context = 0
+
+  if start + 5 > limit:
+    return out, None
+  code = int.from_bytes(data[start + 1:start + 5], 'big')
+  rng = 0xFFFFFFFF
+  pos = start + 5
+
+  while pos <= limit:
+    # End of stream flag
+    bound = (rng >> PROB_BITS) * end_probability
+    if code < bound:
+      rng = bound
+      end_probability += (PROB_ONE - end_probability) >> ADAPT_SHIFT
+    else:
+      code -= bound
+      rng -= bound
+      while rng < RANGE_TOP:
+        rng = (rng << 8) & 0xFFFFFFFF
+        pos += 1
+      return out, pos
+    while rng < RANGE_TOP:
+      rng = (rng << 8) & 0xFFFFFFFF
+      code = ((code << 8) | data[pos]) & 0xFFFFFFFF
+      pos += 1
+
+    tree = probability[context]
+    node = 1
+    while node < 256:
+      p = tree[node]
+      bound = (rng >> PROB_BITS) * p
+      if code < bound:
+        rng = bound
+        tree[node] = p + ((PROB_ONE - p) >> ADAPT_SHIFT)
+        node <<= 1
+      else:
+        code -= bound
+        rng -= bound
+        tree[node] = p - (p >> ADAPT_SHIFT)
+        node = (node << 1) | 1
+      while rng < RANGE_TOP:
+        rng = (rng << 8) & 0xFFFFFFFF
+        code = ((code << 8) | data[pos]) & 0xFFFFFFFF
+        pos += 1
+
+    value = node & 0xFF
+    out.append(value)
+    context = value >> 7
+
+  return out, None
+
+def decompress(data):
+  """Returns the bytes coded in data, how much of data they took or None if
+  the stream is cut short, and the number of blocks lost."""
+  out = bytearray()
+  lost = 0
+  pos = 0
+
+  # Past the end of a cut short log, read zeros until a byte is wanted
+  size = len(data)
+  data = bytes(data) + bytes(8)
+
+  while True:
+    if data[pos:pos + len(SYNC)] != SYNC:
+      # Lost data where a block should start. After the last block, nothing
+      # but the free space of the flash or file follows
+      resync = data.find(SYNC, pos, size)
+      if resync < 0:
+        return out, pos, lost
+      lost += 1
+      pos = resync
+
+    # A block that lost data reads on into garbage, so stop it at the next
+    # marker. The rare marker that is really part of the coded bytes costs
+    # the block it is in
+    start = pos + len(SYNC)
+    resync = data.find(SYNC, start, size)
+    limit = size if resync < 0 else resync
+
+    block, end = decompress_block(data, start, limit)
+    if end is not None and end + 2 <= limit and \
+        crc16_ccitt(block) == int.from_bytes(data[end:end + 2], 'big'):
+      out += block
+      pos = end + 2
+      continue
+
+    if resync < 0:
+      return out, None, lost
+    lost += 1
+    pos = resync
+
+def split_logs(data):
+  starts = []
+  pos = data.find(LOG_START)
+  while pos >= 0:
+    starts.append(pos)
+    pos = data.find(LOG_START, pos + 1)
+  if not starts:
+    return [ data ]
+  return [ data[start:end] for start, end in zip(starts, starts[1:] + [ len(data) ]) ]
+
+def main():
+  parser = OptionParser(usage='%prog [options] LOG')
+  parser.add_option('-o', '--output', help='output file, LOG with .plain added by default')
+  (options, args) = parser.parse_args()
+  if len(args) != 1:
+    parser.error('one log file expected')
+
+  with open(args[0], 'rb') as f:
+    data = f.read()
+
+  output = bytearray()
+  for index, log in enumerate(split_logs(data)):
+    header_end = log.find(COMPRESSION_HEADER)
+    if header_end < 0:
+      output += log
+      print('log %d: %d bytes, not compressed' % (index + 1, len(log)))
+      continue
+
+    stream = log[header_end + len(COMPRESSION_HEADER):]
+    body, consumed, lost = decompress(stream)
+    output += log[:header_end] + body
+
+    plain = header_end + len(body)
+    stored = header_end + len(COMPRESSION_HEADER) + (consumed or len(stream))
+    print('log %d: %d bytes from %d, ratio %.2f%s%s' % (index + 1, plain, stored,
+      plain / max(stored, 1), ', %d blocks lost' % lost if lost else '',
+      '' if consumed else ', cut short'))
+
+  with open(options.output or args[0] + '.plain', 'wb') as f:
+    f.write(output)
+
+if __name__ == '__main__':
+  main()
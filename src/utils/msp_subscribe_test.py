@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+
+# This file is part of Heliflight 3D.
+#
+# Heliflight 3D is free software. You can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# Heliflight 3D is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+# See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this software. If not, see <https://www.gnu.org/licenses/>.
+
+# Compares polling a set of MSP commands with subscribing to them, against
+# SITL over TCP. An update is one reply to every command in the set.
+#
+#   obj/main/heliflight_SITL.elf &
+#   msp_subscribe_test.py [-p 5761] [--pid PID] [-t 10] [-i 20]
+#
+# Reports the bytes moved per update both ways and the update rate, with
+# the commands polled at the subscription interval. Given the SITL process
+# id, the CPU time SITL used per update is reported too.
+
+import os
+import socket
+import struct
+import time
+from optparse import OptionParser
+
+MSP2_BETAFLIGHT_SUBSCRIBE = 0x3001
+MSP2_BETAFLIGHT_TELEMETRY = 0x3002
+
+# MSP_STATUS, MSP_RAW_IMU, MSP_RC, MSP_ATTITUDE, MSP_ALTITUDE, MSP_ANALOG
+DEFAULT_COMMANDS = [ 101, 102, 105, 108, 109, 110 ]
+
+def crc8_dvb_s2(crc, data):
+  for b in data:
+    crc ^= b
+    for _ in range(8):
+      crc = ((crc << 1) ^ 0xd5) & 0xff if crc & 0x80 else (crc << 1) & 0xff
+  return crc
+
+def encode(cmd, payload=b''):
+  header = struct.pack('<BHH', 0, cmd, len(payload))
+  return b'$X<' + header + payload + bytes([crc8_dvb_s2(0, header + payload)])
+
+class MspReader:
+  def __init__(self, sock):
+    self.sock = sock
+    self.data = b''
+    self.received = 0
+
+  def frame(self, timeout):
+    deadline = time.monotonic() + timeout
+    while True:
+      start = self.data.find(b'$X')
+      if start >= 0 and len(self.data) >= start + 8:
+        flags, cmd, size = struct.unpack_from('<BHH', self.data, start + 3)
+        end = start + 8 + size + 1
+        if len(self.data) >= end:
+          body = self.data[start + 3:end - 1]
+          ok = crc8_dvb_s2(0, body) == self.data[end - 1]
+          direction = self.data[start + 2:start + 3]
+          self.data = self.data[end:]
+          if ok and direction in (b'>', b'!'):
+            return cmd, direction == b'>', body[5:]
+          continue
+      remaining = deadline - time.monotonic()
+      if remaining <= 0:
+        return None
+      self.sock.settimeout(remaining)
+      try:
+        chunk = self.sock.recv(4096)
+      except socket.timeout:
+        return None
+      if not chunk:
+        raise IOError('connection closed')
+      self.received += len(chunk)
+      self.data += chunk
+
+def cpuSeconds(pid):
+  if not pid:
+    return 0
+  with open('/proc/%d/stat' % pid) as f:
+    fields = f.read().rsplit(')', 1)[1].split()
+  return (int(fields[11]) + int(fields[12])) / os.sysconf('SC_CLK_TCK')
+
+def drain(reader):
+  while reader.frame(0.2):
+    pass
+
+# Requests go out a round per interval without waiting for the replies,
+# as SITL only flushes its TCP ports now and then. An update is counted
+# when the reply to the last command of a round arrives.
+def poll(sock, reader, commands, intervalMs, seconds, pid):
+  requests = b''.join(encode(cmd) for cmd in commands)
+  sent = 0
+  updates = 0
+  rounds = 0
+  received = reader.received
+  cpu = cpuSeconds(pid)
+  start = time.monotonic()
+  end = start + seconds
+  while time.monotonic() < end:
+    due = start + rounds * intervalMs / 1000
+    if time.monotonic() >= due and rounds - updates < 1000 / intervalMs:
+      sock.sendall(requests)
+      sent += len(requests)
+      rounds += 1
+    reply = reader.frame(min(max(due - time.monotonic(), 0.001), end - time.monotonic()))
+    if reply and reply[0] == commands[-1]:
+      updates += 1
+  result = (updates, sent, reader.received - received, cpuSeconds(pid) - cpu)
+  drain(reader)
+  return result
+
+def subscribe(sock, reader, commands, intervalMs, seconds, pid):
+  frame = encode(MSP2_BETAFLIGHT_SUBSCRIBE, struct.pack('<H%dH' % len(commands), intervalMs, *commands))
+  sock.sendall(frame)
+  sent = len(frame)
+  while True:
+    reply = reader.frame(1.0)
+    if reply is None:
+      raise IOError('no reply to MSP2_BETAFLIGHT_SUBSCRIBE')
+    cmd, ok, payload = reply
+    if cmd == MSP2_BETAFLIGHT_SUBSCRIBE:
+      if not ok:
+        raise IOError('subscription refused')
+      accepted = struct.unpack_from('<%dH' % payload[0], payload, 1)
+      break
+  if list(accepted) != list(commands):
+    print('accepted %s' % (list(accepted),))
+
+  updates = 0
+  received = reader.received
+  cpu = cpuSeconds(pid)
+  end = time.monotonic() + seconds
+  while time.monotonic() < end:
+    reply = reader.frame(end - time.monotonic())
+    if reply and reply[0] == MSP2_BETAFLIGHT_TELEMETRY:
+      updates += 1
+  result = (updates, sent, reader.received - received, cpuSeconds(pid) - cpu)
+
+  frame = encode(MSP2_BETAFLIGHT_SUBSCRIBE, struct.pack('<H', 0))
+  sock.sendall(frame)
+  drain(reader)
+  return result
+
+def report(name, updates, sent, received, cpu, seconds, pid):
+  updates = max(updates, 1)
+  line = '%-10s %8.1f/s %8.1f B out %8.1f B in' % (name, updates / seconds, sent / updates, received / updates)
+  if pid:
+    line += ' %8.1f us cpu' % (cpu * 1e6 / updates)
+  print(line + ' per update')
+
+def main():
+  parser = OptionParser(usage='%prog [options]')
+  parser.add_option('-H', '--host', default='127.0.0.1')
+  parser.add_option('-p', '--port', type='int', default=5761, help='TCP port of the MSP UART')
+  parser.add_option('--pid', type='int', default=0, help='SITL process, for the CPU time')
+  parser.add_option('-t', '--time', type='float', default=10, help='seconds per mode')
+  parser.add_option('-i', '--interval', type='int', default=20, help='subscription interval in ms')
+  parser.add_option('-c', '--commands', default=','.join(str(c) for c in DEFAULT_COMMANDS))
+  (options, args) = parser.parse_args()
+
+  commands = [ int(c, 0) for c in options.commands.split(',') ]
+
+  sock = socket.create_connection((options.host, options.port))
+  sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+  reader = MspReader(sock)
+  drain(reader)
+
+  polled = poll(sock, reader, commands, options.interval, options.time, options.pid)
+  pushed = subscribe(sock, reader, commands, options.interval, options.time, options.pid)
+
+  print('%d commands, %.0f s each\n' % (len(commands), options.time))
+  report('polling', *polled, options.time, options.pid)
+  report('subscribed', *pushed, options.time, options.pid)
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+
+# This file is part of Heliflight 3D.
+#
+# Heliflight 3D is free software. You can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# Heliflight 3D is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+# See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this software. If not, see <https://www.gnu.org/licenses/>.
+
+# Converts the output of the CLI 'sched_trace dump' command into the Chrome
+# trace event format, which chrome://tracing and ui.perfetto.dev can open.
+#
+#   sched_trace_to_json.py trace.txt [-o trace.json]
+#
+# Every task gets its own track. Tasks held back by the gyro guard and gyro
+# runs later than the trigger are marked with instant events.
+
+import sys
+import json
+from optparse import OptionParser
+
+TRACE_GUARD_SKIPPED = 1 << 0
+TRACE_LATE_GYRO = 1 << 1
+
+def parse(lines):
+  tasks = {}
+  events = []
+  for line in lines:
+    words = line.split()
+    if len(words) == 4 and words[0] == 'task':
+      tasks[int(words[1])] = (words[2], int(words[3]))
+    elif len(words) == 5 and words[0] == 'ev':
+      events.append(tuple(int(w) for w in words[1:]))
+  return tasks, events
+
+def convert(tasks, events):
+  trace = []
+  for taskId, (name, periodUs) in sorted(tasks.items()):
+    trace.append({ 'ph': 'M', 'name': 'thread_name', 'pid': 0, 'tid': taskId,
+                   'args': { 'name': '%s (%dus)' % (name, periodUs) } })
+    trace.append({ 'ph': 'M', 'name': 'thread_sort_index', 'pid': 0, 'tid': taskId,
+                   'args': { 'sort_index': taskId } })
+
+  # Start times are the low 32 bits of micros(), unwrapped here
+  base = 0
+  last = None
+  for startUs, durationUs, taskId, flags in events:
+    if last is not None and startUs < last and last - startUs > 0x80000000:
+      base += 0x100000000
+    last = startUs
+    ts = base + startUs
+    name = tasks.get(taskId, ('TASK%d' % taskId, 0))[0]
+
+    if flags & TRACE_GUARD_SKIPPED:
+      trace.append({ 'ph': 'i', 's': 't', 'name': 'gyro guard skip', 'pid': 0, 'tid': taskId, 'ts': ts })
+      continue
+
+    trace.append({ 'ph': 'X', 'name': name, 'pid': 0, 'tid': taskId, 'ts': ts, 'dur': durationUs })
+    if flags & TRACE_LATE_GYRO:
+      trace.append({ 'ph': 'i', 's': 'g', 'name': 'late gyro', 'pid': 0, 'tid': taskId, 'ts': ts })
+
+  return { 'traceEvents': trace, 'displayTimeUnit': 'ms' }
+
+def main():
+  parser = OptionParser(usage='%prog [options] <sched_trace dump>')
+  parser.add_option('-o', '--output', dest='output', help='write the JSON here instead of stdout')
+  (options, args) = parser.parse_args()
+  if len(args) != 1:
+    parser.print_help()
+    sys.exit(1)
+
+  with open(args[0]) as f:
+    tasks, events = parse(f)
+  if not events:
+    print('No trace events in %s' % args[0], file=sys.stderr)
+    sys.exit(1)
+
+  out = open(options.output, 'w') if options.output else sys.stdout
+  json.dump(convert(tasks, events), out)
+  out.write('\n')
+
+if __name__ == '__main__':
+  main()